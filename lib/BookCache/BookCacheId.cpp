@@ -0,0 +1,374 @@
+#include "BookCacheId.h"
+
+#include <BufferedFile.h>
+#include <Fnv1a.h>
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+#include <freertos/semphr.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace {
+constexpr char CACHE_ID_MAP_FILE[] = "/.crosspoint/cache_ids.bin";
+constexpr char CACHE_ID_MAP_TMP_FILE[] = "/.crosspoint/cache_ids.bin.tmp";
+constexpr uint8_t CACHE_ID_MAP_VERSION = 2;
+// Version 1 entries have no sample; they are read with none and re-hashed on the next open
+constexpr uint8_t CACHE_ID_MAP_VERSION_NO_SAMPLE = 1;
+// Sanity bound for paths read back from the map
+constexpr uint16_t MAX_PATH_LENGTH = 512;
+// Cache directory prefixes of the book types, for caches still named after the path hash
+constexpr const char* LEGACY_PREFIXES[] = {"epub", "xtc", "txt"};
+
+struct MapEntry {
+  std::string path;
+  uint32_t fileSize = 0;
+  uint32_t sample = 0;  // sampleOf() when the id was calculated
+  std::string dirName;  // <prefix>_<id>
+};
+
+bool readEntry(BufferedReader& reader, const uint8_t version, MapEntry& entry) {
+  uint16_t pathLength;
+  if (reader.read(&pathLength, sizeof(pathLength)) != sizeof(pathLength) || pathLength > MAX_PATH_LENGTH) {
+    return false;
+  }
+  entry.path.resize(pathLength);
+  if (reader.read(&entry.path[0], pathLength) != pathLength ||
+      reader.read(&entry.fileSize, sizeof(entry.fileSize)) != sizeof(entry.fileSize)) {
+    return false;
+  }
+  entry.sample = 0;
+  if (version != CACHE_ID_MAP_VERSION_NO_SAMPLE &&
+      reader.read(&entry.sample, sizeof(entry.sample)) != sizeof(entry.sample)) {
+    return false;
+  }
+  uint8_t dirLength;
+  if (reader.read(&dirLength, 1) != 1) {
+    return false;
+  }
+  entry.dirName.resize(dirLength);
+  return reader.read(&entry.dirName[0], dirLength) == dirLength;
+}
+
+void writeEntry(BufferedWriter& writer, const MapEntry& entry) {
+  serialization::writePod(writer, static_cast<uint16_t>(entry.path.size()));
+  writer.write(entry.path.data(), entry.path.size());
+  serialization::writePod(writer, entry.fileSize);
+  serialization::writePod(writer, entry.sample);
+  serialization::writePod(writer, static_cast<uint8_t>(entry.dirName.size()));
+  writer.write(entry.dirName.data(), entry.dirName.size());
+}
+
+// Visits every entry of the map until `visit` returns false. Returns false if the map is missing or unreadable.
+template <typename Visitor>
+bool forEachEntry(Visitor&& visit) {
+  FsFile file;
+  if (!Storage.exists(CACHE_ID_MAP_FILE) || !Storage.openFileForRead("BCI", CACHE_ID_MAP_FILE, file)) {
+    return false;
+  }
+  BufferedReader reader(file);
+  uint8_t version;
+  uint16_t count;
+  if (reader.read(&version, 1) != 1 ||
+      (version != CACHE_ID_MAP_VERSION && version != CACHE_ID_MAP_VERSION_NO_SAMPLE) ||
+      reader.read(&count, sizeof(count)) != sizeof(count)) {
+    LOG_ERR("BCI", "Unknown cache id map version, ignoring it");
+    file.close();
+    return false;
+  }
+  MapEntry entry;
+  for (uint16_t i = 0; i < count; i++) {
+    if (!readEntry(reader, version, entry)) {
+      LOG_ERR("BCI", "Cache id map truncated after %u entries", i);
+      break;
+    }
+    if (!visit(entry)) {
+      break;
+    }
+  }
+  file.close();
+  return true;
+}
+
+std::vector<MapEntry> loadMap() {
+  std::vector<MapEntry> entries;
+  forEachEntry([&entries](const MapEntry& entry) {
+    entries.push_back(entry);
+    return true;
+  });
+  return entries;
+}
+
+bool saveMap(const std::vector<MapEntry>& entries) {
+  FsFile file;
+  if (!Storage.openFileForWrite("BCI", CACHE_ID_MAP_TMP_FILE, file)) {
+    return false;
+  }
+  bool written;
+  {
+    BufferedWriter writer(file);
+    serialization::writePod(writer, CACHE_ID_MAP_VERSION);
+    serialization::writePod(writer, static_cast<uint16_t>(std::min<size_t>(entries.size(), UINT16_MAX)));
+    for (size_t i = 0; i < entries.size() && i < UINT16_MAX; i++) {
+      writeEntry(writer, entries[i]);
+    }
+    written = writer.flush() && !writer.hasError();
+  }
+  file.close();
+
+  // Swap the new map in only once it is complete, so an interrupted write leaves the old one in place
+  if (!written) {
+    LOG_ERR("BCI", "Failed to write cache id map");
+    Storage.remove(CACHE_ID_MAP_TMP_FILE);
+    return false;
+  }
+  Storage.remove(CACHE_ID_MAP_FILE);
+  return Storage.rename(CACHE_ID_MAP_TMP_FILE, CACHE_ID_MAP_FILE);
+}
+
+bool isSameOrInside(const std::string& path, const std::string& base) {
+  return path.compare(0, base.size(), base) == 0 && (path.size() == base.size() || path[base.size()] == '/');
+}
+
+std::string idOf(const std::string& dirName) {
+  const size_t separator = dirName.rfind('_');
+  return separator == std::string::npos ? dirName : dirName.substr(separator + 1);
+}
+
+// Size and a hash of the first and last 1KB of the file: two reads to tell whether a book still is the one its
+// recorded id was calculated from. The last 1KB of an EPUB holds its zip directory, which changes with any entry.
+bool sampleOf(const std::string& path, uint32_t& size, uint32_t& sample) {
+  FsFile file;
+  if (!Storage.exists(path.c_str()) || !Storage.openFileForRead("BCI", path, file)) {
+    return false;
+  }
+  size = file.fileSize();
+  sample = FNV1A32_OFFSET_BASIS;
+  uint8_t buffer[1024];
+  for (const size_t offset : {size_t{0}, size > sizeof(buffer) ? size - sizeof(buffer) : size_t{0}}) {
+    const int bytesRead = file.seekSet(offset) ? file.read(buffer, std::min<size_t>(sizeof(buffer), size)) : 0;
+    if (bytesRead > 0) {
+      sample = fnv1a32(buffer, bytesRead, sample);
+    }
+  }
+  file.close();
+  return true;
+}
+
+// Splits a cache path into the directory holding caches and the book type's prefix
+void splitCachePath(const std::string& cachePath, std::string& cacheDir, std::string& prefix) {
+  const size_t slash = cachePath.rfind('/');
+  cacheDir = slash == std::string::npos ? "" : cachePath.substr(0, slash);
+  const std::string dirName = cachePath.substr(slash + 1);
+  prefix = dirName.substr(0, dirName.find('_'));
+}
+
+// The map is read and rewritten from the main loop and from the thumbnail worker's task
+class MapLock {
+  static SemaphoreHandle_t mutex() {
+    static SemaphoreHandle_t handle = xSemaphoreCreateMutex();
+    return handle;
+  }
+
+ public:
+  MapLock() { xSemaphoreTake(mutex(), portMAX_DELAY); }
+  ~MapLock() { xSemaphoreGive(mutex()); }
+  MapLock(const MapLock&) = delete;
+  MapLock& operator=(const MapLock&) = delete;
+};
+
+std::string legacyCachePath(const std::string& bookPath, const std::string& cacheDir, const char* prefix) {
+  return cacheDir + "/" + prefix + "_" + std::to_string(std::hash<std::string>{}(bookPath));
+}
+}  // namespace
+
+std::string BookCacheId::calculate(const std::string& bookPath, uint32_t* fileSize) {
+  FsFile file;
+  if (!Storage.openFileForRead("BCI", bookPath, file)) {
+    return "";
+  }
+  const size_t size = file.fileSize();
+
+  // 64-bit FNV-1a over the file size and the sampled chunks
+  uint64_t hash = 14695981039346656037ull;
+  const auto mix = [&hash](const uint8_t* data, const size_t length) {
+    for (size_t i = 0; i < length; i++) {
+      hash ^= data[i];
+      hash *= 1099511628211ull;
+    }
+  };
+  const uint32_t size32 = size;
+  mix(reinterpret_cast<const uint8_t*>(&size32), sizeof(size32));
+
+  uint8_t buffer[CHUNK_SIZE];
+  const auto addChunk = [&](const size_t offset) {
+    if (offset >= size || !file.seekSet(offset)) {
+      return;
+    }
+    const int bytesRead = file.read(buffer, std::min(CHUNK_SIZE, size - offset));
+    if (bytesRead > 0) {
+      mix(buffer, bytesRead);
+    }
+  };
+  for (int i = 0; i < OFFSET_COUNT; i++) {
+    addChunk(i == 0 ? 0 : CHUNK_SIZE << (2 * (i - 1)));
+  }
+  if (size > CHUNK_SIZE) {
+    addChunk(size - CHUNK_SIZE);
+  }
+  file.close();
+
+  if (fileSize) {
+    *fileSize = size32;
+  }
+  char id[17];
+  snprintf(id, sizeof(id), "%016llx", static_cast<unsigned long long>(hash));
+  return id;
+}
+
+std::string BookCacheId::cachePathFor(const std::string& bookPath, const std::string& cacheDir, const char* prefix,
+                                      bool* recorded) {
+  MapLock lock;
+  const std::string legacyPath = legacyCachePath(bookPath, cacheDir, prefix);
+  if (recorded) {
+    *recorded = false;
+  }
+
+  MapEntry entry;
+  bool found = false;
+  forEachEntry([&](const MapEntry& candidate) {
+    if (candidate.path != bookPath) {
+      return true;
+    }
+    entry = candidate;
+    found = true;
+    return false;
+  });
+
+  uint32_t currentSize = 0;
+  uint32_t currentSample = 0;
+  const bool unchanged = found && entry.dirName.compare(0, strlen(prefix), prefix) == 0 &&
+                         sampleOf(bookPath, currentSize, currentSample) && currentSize == entry.fileSize &&
+                         currentSample == entry.sample;
+  if (unchanged) {
+    if (recorded) {
+      *recorded = true;
+    }
+    return cacheDir + "/" + entry.dirName;
+  }
+
+  const std::string id = calculate(bookPath);
+  if (id.empty()) {
+    return legacyPath;
+  }
+  const std::string cachePath = cacheDir + "/" + prefix + "_" + id;
+  // A cache built under the old path-hashed name stays in use until record() moves it
+  if (!Storage.exists(cachePath.c_str()) && Storage.exists(legacyPath.c_str())) {
+    return legacyPath;
+  }
+  return cachePath;
+}
+
+std::string BookCacheId::record(const std::string& bookPath, const std::string& cachePath) {
+  MapLock lock;
+  std::string cacheDir;
+  std::string prefix;
+  splitCachePath(cachePath, cacheDir, prefix);
+
+  // cachePathFor() already calculated the id, unless it handed out the cache from before content ids
+  const std::string legacyPath = legacyCachePath(bookPath, cacheDir, prefix.c_str());
+  const std::string id = cachePath == legacyPath ? calculate(bookPath) : idOf(cachePath.substr(cacheDir.size() + 1));
+  uint32_t fileSize = 0;
+  uint32_t sample = 0;
+  if (id.empty() || !sampleOf(bookPath, fileSize, sample)) {
+    return cachePath;
+  }
+  const std::string dirName = prefix + "_" + id;
+  const std::string idPath = cacheDir + "/" + dirName;
+
+  // Adopt a cache built under the old path-hashed name, so existing books are not re-indexed
+  if (!Storage.exists(idPath.c_str()) && Storage.exists(legacyPath.c_str())) {
+    LOG_DBG("BCI", "Adopting cache %s as %s", legacyPath.c_str(), dirName.c_str());
+    Storage.rename(legacyPath.c_str(), idPath.c_str());
+  }
+
+  auto entries = loadMap();
+  const auto it = std::find_if(entries.begin(), entries.end(),
+                               [&bookPath](const MapEntry& entry) { return entry.path == bookPath; });
+  if (it != entries.end()) {
+    it->fileSize = fileSize;
+    it->sample = sample;
+    it->dirName = dirName;
+  } else {
+    entries.push_back({bookPath, fileSize, sample, dirName});
+  }
+  saveMap(entries);
+  LOG_DBG("BCI", "%s -> %s", bookPath.c_str(), dirName.c_str());
+  return idPath;
+}
+
+void BookCacheId::onMoved(const std::string& fromPath, const std::string& toPath) {
+  MapLock lock;
+  auto entries = loadMap();
+  int moved = 0;
+  for (auto& entry : entries) {
+    if (isSameOrInside(entry.path, fromPath)) {
+      entry.path = toPath + entry.path.substr(fromPath.size());
+      moved++;
+    }
+  }
+  if (moved > 0) {
+    saveMap(entries);
+    LOG_DBG("BCI", "Moved %d cache id(s) from %s to %s", moved, fromPath.c_str(), toPath.c_str());
+  }
+}
+
+void BookCacheId::onRemoved(const std::string& bookPath, const std::string& cacheDir) {
+  MapLock lock;
+  // A cache from before content ids belongs to whatever was at this path, so it must not be adopted by new content
+  for (const char* prefix : LEGACY_PREFIXES) {
+    const std::string legacyPath = legacyCachePath(bookPath, cacheDir, prefix);
+    if (Storage.exists(legacyPath.c_str())) {
+      Storage.removeDir(legacyPath.c_str());
+    }
+  }
+
+  auto entries = loadMap();
+  std::vector<std::string> releasedDirs;
+  for (auto it = entries.begin(); it != entries.end();) {
+    if (!isSameOrInside(it->path, bookPath)) {
+      ++it;
+      continue;
+    }
+    // An overwrite with identical content (e.g. uploading the same book again) keeps its cache
+    uint32_t fileSize = 0;
+    uint32_t sample = 0;
+    if (it->path == bookPath && Storage.exists(bookPath.c_str()) &&
+        calculate(bookPath, &fileSize) == idOf(it->dirName) && sampleOf(bookPath, fileSize, sample)) {
+      it->fileSize = fileSize;
+      it->sample = sample;
+      ++it;
+      continue;
+    }
+    releasedDirs.push_back(it->dirName);
+    it = entries.erase(it);
+  }
+
+  for (const auto& dirName : releasedDirs) {
+    const bool shared = std::any_of(entries.begin(), entries.end(),
+                                    [&dirName](const MapEntry& entry) { return entry.dirName == dirName; });
+    if (!shared) {
+      const std::string cachePath = cacheDir + "/" + dirName;
+      if (Storage.exists(cachePath.c_str())) {
+        Storage.removeDir(cachePath.c_str());
+      }
+      LOG_DBG("BCI", "Removed cache %s", dirName.c_str());
+    }
+  }
+  if (!releasedDirs.empty()) {
+    saveMap(entries);
+  }
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+/**
+ * Content-addressed cache directories for books.
+ *
+ * A book's cache directory is named after its content rather than its path: the file size plus a hash of 1KB chunks
+ * sampled at the offsets KOReaderDocumentId uses (and the last 1KB, where an EPUB keeps its zip directory). Renaming
+ * or moving a book therefore keeps its cache, and identical copies under different paths share one.
+ *
+ * Hashing costs a dozen small reads, so the id is recorded per path in /.crosspoint/cache_ids.bin along with the file
+ * size and a hash of its first and last 1KB, and reused while both still match. Code that renames, moves, overwrites
+ * or deletes books keeps that map current through onMoved/onRemoved.
+ *
+ * Constructing a book only reads: cachePathFor() looks the id up or calculates it. The book's load() calls record(),
+ * which writes the map and moves a cache from before content ids into place.
+ */
+class BookCacheId {
+ public:
+  // Cache directory for the book at `bookPath`: `<cacheDir>/<prefix>_<id>`. Returns the path-hashed directory used
+  // before content ids when the book cannot be read, or while its cache is still there. Only reads the card.
+  // `recorded` tells whether the id came from the map, so record() has nothing to do.
+  static std::string cachePathFor(const std::string& bookPath, const std::string& cacheDir, const char* prefix,
+                                  bool* recorded = nullptr);
+
+  // Records the id of the book at `bookPath` in the map and moves a cache from before content ids to its content-id
+  // directory. `cachePath` is what cachePathFor() returned; the result is the cache directory to use from now on.
+  static std::string record(const std::string& bookPath, const std::string& cachePath);
+
+  // A book, or a folder holding books, was renamed or moved. Recorded ids follow the new path.
+  static void onMoved(const std::string& fromPath, const std::string& toPath);
+
+  // A book was deleted or overwritten. Forgets its id and deletes its cache unless another path shares it.
+  static void onRemoved(const std::string& bookPath, const std::string& cacheDir);
+
+  // Content id of the file (16 hex chars), or an empty string if it cannot be read
+  static std::string calculate(const std::string& bookPath, uint32_t* fileSize = nullptr);
+
+ private:
+  static constexpr size_t CHUNK_SIZE = 1024;
+  // Chunk offsets are 0, then 1024 << (2*i) for i = 0..10, as in KOReaderDocumentId
+  static constexpr int OFFSET_COUNT = 12;
+};
@@ -1,5 +1,6 @@
 #include "FontDecompressor.h"
 
+#include <HeapTags.h>
 #include <Logging.h>
 
 #include <cstdlib>
@@ -12,7 +13,7 @@ bool FontDecompressor::init() {
 void FontDecompressor::freeAllEntries() {
   for (auto& entry : cache) {
     if (entry.data) {
-      free(entry.data);
+      HeapTags::release(entry.data);
       entry.data = nullptr;
     }
     entry.valid = false;
@@ -67,13 +68,13 @@ bool FontDecompressor::decompressGroup(const EpdFontData* fontData, uint16_t gro
 
   // Free old buffer if reusing a slot
   if (entry->data) {
-    free(entry->data);
+    HeapTags::release(entry->data);
     entry->data = nullptr;
   }
   entry->valid = false;
 
   // Allocate output buffer
-  auto* outBuf = static_cast<uint8_t*>(malloc(group.uncompressedSize));
+  auto* outBuf = static_cast<uint8_t*>(HeapTags::allocate(group.uncompressedSize, HeapTag::FontCache));
   if (!outBuf) {
     LOG_ERR("FDC", "Failed to allocate %u bytes for group %u", group.uncompressedSize, groupIndex);
     return false;
@@ -83,7 +84,7 @@ bool FontDecompressor::decompressGroup(const EpdFontData* fontData, uint16_t gro
   inflateReader.setSource(&fontData->bitmap[group.compressedOffset], group.compressedSize);
   if (!inflateReader.read(outBuf, group.uncompressedSize)) {
     LOG_ERR("FDC", "Decompression failed for group %u", groupIndex);
-    free(outBuf);
+    HeapTags::release(outBuf);
     return false;
   }
 
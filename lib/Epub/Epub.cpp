@@ -2,11 +2,15 @@
 
 #include <FsHelpers.h>
 #include <HalStorage.h>
+#include <HeapTags.h>
 #include <JpegToBmpConverter.h>
 #include <Logging.h>
 #include <PngToBmpConverter.h>
 #include <ZipFile.h>
 
+#include <algorithm>
+
+#include "Epub/EpubStreamScanner.h"
 #include "Epub/parsers/ContainerParser.h"
 #include "Epub/parsers/ContentOpfParser.h"
 #include "Epub/parsers/TocNavParser.h"
@@ -258,6 +262,8 @@ bool Epub::parseTocNavFile() const {
 }
 
 void Epub::parseCssFiles() const {
+  HeapTagScope heapScope(HeapTag::Css);
+
   // Maximum CSS file size we'll attempt to parse (uncompressed)
   // Larger files risk memory exhaustion on ESP32
   constexpr size_t MAX_CSS_FILE_SIZE = 128 * 1024;  // 128KB
@@ -337,6 +343,11 @@ void Epub::parseCssFiles() const {
 bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss) {
   LOG_DBG("EBP", "Loading ePub: %s", filepath.c_str());
 
+  if (!cacheRecorded) {
+    cachePath = BookCacheId::record(filepath, cachePath);
+    cacheRecorded = true;
+  }
+
   // Initialize spine/TOC cache
   bookMetadataCache.reset(new BookMetadataCache(cachePath));
   // Always create CssParser - needed for inline style parsing even without CSS files
@@ -519,6 +530,10 @@ const std::string& Epub::getLanguage() const {
   return bookMetadataCache->coreMetadata.language;
 }
 
+bool Epub::hasCover() const {
+  return bookMetadataCache && bookMetadataCache->isLoaded() && !bookMetadataCache->coreMetadata.coverItemHref.empty();
+}
+
 std::string Epub::getCoverBmpPath(bool cropped) const {
   const auto coverFileName = std::string("cover") + (cropped ? "_crop" : "");
   return cachePath + "/" + coverFileName + ".bmp";
@@ -735,11 +750,26 @@ bool Epub::readItemContentsToStream(const std::string& itemHref, Print& out, con
   }
 
   const std::string path = FsHelpers::normalisePath(itemHref);
+  const uint8_t* data;
+  size_t size;
+  if (preloaded && preloaded->find(path, &data, &size)) {
+    for (size_t offset = 0; offset < size; offset += chunkSize) {
+      const size_t n = std::min(chunkSize, size - offset);
+      if (out.write(data + offset, n) != n) {
+        return false;
+      }
+    }
+    return true;
+  }
   return ZipFile(filepath).readFileToStream(path.c_str(), out, chunkSize);
 }
 
 bool Epub::getItemSize(const std::string& itemHref, size_t* size) const {
   const std::string path = FsHelpers::normalisePath(itemHref);
+  const uint8_t* data;
+  if (preloaded && preloaded->find(path, &data, size)) {
+    return true;
+  }
   return ZipFile(filepath).getInflatedFileSize(path.c_str(), size);
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <BookCacheId.h>
 #include <Print.h>
 
 #include <memory>
@@ -10,6 +11,7 @@
 #include "Epub/BookMetadataCache.h"
 #include "Epub/css/CssParser.h"
 
+class EpubStreamScanner;
 class ZipFile;
 
 class Epub {
@@ -21,14 +23,18 @@ class Epub {
   std::string filepath;
   // the base path for items in the EPUB file
   std::string contentBasePath;
-  // Uniq cache key based on filepath
+  // Cache directory keyed on the file's content, so it survives renames and moves
   std::string cachePath;
+  // The cache id is in the map; until then load() records it
+  bool cacheRecorded = false;
   // Spine and TOC cache
   std::unique_ptr<BookMetadataCache> bookMetadataCache;
   // CSS parser for styling
   std::unique_ptr<CssParser> cssParser;
   // CSS files
   std::vector<std::string> cssFiles;
+  // Items kept while the file was downloading, read from memory instead of the archive
+  const EpubStreamScanner* preloaded = nullptr;
 
   bool findContentOpfFile(std::string* contentOpfFile) const;
   bool parseContentOpf(BookMetadataCache::BookMetadata& bookMetadata);
@@ -38,19 +44,21 @@ class Epub {
 
  public:
   explicit Epub(std::string filepath, const std::string& cacheDir) : filepath(std::move(filepath)) {
-    // create a cache key based on the filepath
-    cachePath = cacheDir + "/epub_" + std::to_string(std::hash<std::string>{}(this->filepath));
+    cachePath = BookCacheId::cachePathFor(this->filepath, cacheDir, "epub", &cacheRecorded);
   }
   ~Epub() = default;
   std::string& getBasePath() { return contentBasePath; }
   bool load(bool buildIfMissing = true, bool skipLoadingCss = false);
   bool clearCache() const;
+  // Reads the items `scanner` kept (container.xml and the OPF) from it rather than the file. It must outlive load().
+  void preloadFrom(const EpubStreamScanner& scanner) { preloaded = &scanner; }
   void setupCacheDir() const;
   const std::string& getCachePath() const;
   const std::string& getPath() const;
   const std::string& getTitle() const;
   const std::string& getAuthor() const;
   const std::string& getLanguage() const;
+  bool hasCover() const;
   std::string getCoverBmpPath(bool cropped = false) const;
   bool generateCoverBmp(bool cropped = false) const;
   std::string getThumbBmpPath() const;
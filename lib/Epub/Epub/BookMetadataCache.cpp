@@ -13,6 +13,8 @@ constexpr uint8_t BOOK_CACHE_VERSION = 5;
 constexpr char bookBinFile[] = "/book.bin";
 constexpr char tmpSpineBinFile[] = "/spine.bin.tmp";
 constexpr char tmpTocBinFile[] = "/toc.bin.tmp";
+// Single entries are read with a random seek each, so keep their read block small
+constexpr size_t ENTRY_READ_BLOCK_SIZE = 128;
 }  // namespace
 
 /* ============= WRITING / BUILDING FUNCTIONS ================ */
@@ -52,8 +54,9 @@ bool BookMetadataCache::beginTocPass() {
     spineHrefIndex.clear();
     spineHrefIndex.reserve(spineCount);
     spineFile.seek(0);
+    BufferedReader spineReader(spineFile);
     for (int i = 0; i < spineCount; i++) {
-      auto entry = readSpineEntry(spineFile);
+      auto entry = readSpineEntry(spineReader);
       SpineHrefIndexEntry idx;
       idx.hrefHash = fnvHash64(entry.href);
       idx.hrefLen = static_cast<uint16_t>(entry.href.size());
@@ -113,6 +116,26 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
     return false;
   }
 
+  ZipFile zip(epubPath);
+  // Pre-open zip file to speed up size calculations
+  if (!zip.open()) {
+    LOG_ERR("BMC", "Could not open EPUB zip for size calculations");
+    bookFile.close();
+    spineFile.close();
+    tocFile.close();
+    return false;
+  }
+  // NOTE: We intentionally skip calling loadAllFileStatSlims() here.
+  // For large EPUBs (2000+ chapters), pre-loading all ZIP central directory entries
+  // into memory causes OOM crashes on ESP32-C3's limited ~380KB RAM.
+  // Instead, for large books we use a one-pass batch lookup that scans the ZIP
+  // central directory once and matches against spine targets using hash comparison.
+  // This is O(n*log(m)) instead of O(n*m) while avoiding memory exhaustion.
+  // See: https://github.com/crosspoint-reader/crosspoint-reader/issues/134
+
+  // Every write below goes through this, so book.bin is written a block at a time
+  BufferedWriter bookOut(bookFile);
+
   constexpr uint32_t headerASize =
       sizeof(BOOK_CACHE_VERSION) + /* LUT Offset */ sizeof(uint32_t) + sizeof(spineCount) + sizeof(tocCount);
   const uint32_t metadataSize = metadata.title.size() + metadata.author.size() + metadata.language.size() +
@@ -122,31 +145,39 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
   const uint32_t lutOffset = headerASize + metadataSize;
 
   // Header A
-  serialization::writePod(bookFile, BOOK_CACHE_VERSION);
-  serialization::writePod(bookFile, lutOffset);
-  serialization::writePod(bookFile, spineCount);
-  serialization::writePod(bookFile, tocCount);
+  serialization::writePod(bookOut, BOOK_CACHE_VERSION);
+  serialization::writePod(bookOut, lutOffset);
+  serialization::writePod(bookOut, spineCount);
+  serialization::writePod(bookOut, tocCount);
   // Metadata
-  serialization::writeString(bookFile, metadata.title);
-  serialization::writeString(bookFile, metadata.author);
-  serialization::writeString(bookFile, metadata.language);
-  serialization::writeString(bookFile, metadata.coverItemHref);
-  serialization::writeString(bookFile, metadata.textReferenceHref);
+  serialization::writeString(bookOut, metadata.title);
+  serialization::writeString(bookOut, metadata.author);
+  serialization::writeString(bookOut, metadata.language);
+  serialization::writeString(bookOut, metadata.coverItemHref);
+  serialization::writeString(bookOut, metadata.textReferenceHref);
 
   // Loop through spine entries, writing LUT positions
-  spineFile.seek(0);
-  for (int i = 0; i < spineCount; i++) {
-    uint32_t pos = spineFile.position();
-    auto spineEntry = readSpineEntry(spineFile);
-    serialization::writePod(bookFile, pos + lutOffset + lutSize);
+  uint32_t spineDataSize;
+  {
+    spineFile.seek(0);
+    BufferedReader spineReader(spineFile);
+    for (int i = 0; i < spineCount; i++) {
+      uint32_t pos = spineReader.position();
+      auto spineEntry = readSpineEntry(spineReader);
+      serialization::writePod(bookOut, pos + lutOffset + lutSize);
+    }
+    spineDataSize = spineReader.position();
   }
 
   // Loop through toc entries, writing LUT positions
-  tocFile.seek(0);
-  for (int i = 0; i < tocCount; i++) {
-    uint32_t pos = tocFile.position();
-    auto tocEntry = readTocEntry(tocFile);
-    serialization::writePod(bookFile, pos + lutOffset + lutSize + static_cast<uint32_t>(spineFile.position()));
+  {
+    tocFile.seek(0);
+    BufferedReader tocReader(tocFile);
+    for (int i = 0; i < tocCount; i++) {
+      uint32_t pos = tocReader.position();
+      auto tocEntry = readTocEntry(tocReader);
+      serialization::writePod(bookOut, pos + lutOffset + lutSize + spineDataSize);
+    }
   }
 
   // LUTs complete
@@ -154,33 +185,19 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
 
   // Build spineIndex->tocIndex mapping in one pass (O(n) instead of O(n*m))
   std::vector<int16_t> spineToTocIndex(spineCount, -1);
-  tocFile.seek(0);
-  for (int j = 0; j < tocCount; j++) {
-    auto tocEntry = readTocEntry(tocFile);
-    if (tocEntry.spineIndex >= 0 && tocEntry.spineIndex < spineCount) {
-      if (spineToTocIndex[tocEntry.spineIndex] == -1) {
-        spineToTocIndex[tocEntry.spineIndex] = static_cast<int16_t>(j);
+  {
+    tocFile.seek(0);
+    BufferedReader tocReader(tocFile);
+    for (int j = 0; j < tocCount; j++) {
+      auto tocEntry = readTocEntry(tocReader);
+      if (tocEntry.spineIndex >= 0 && tocEntry.spineIndex < spineCount) {
+        if (spineToTocIndex[tocEntry.spineIndex] == -1) {
+          spineToTocIndex[tocEntry.spineIndex] = static_cast<int16_t>(j);
+        }
       }
     }
   }
 
-  ZipFile zip(epubPath);
-  // Pre-open zip file to speed up size calculations
-  if (!zip.open()) {
-    LOG_ERR("BMC", "Could not open EPUB zip for size calculations");
-    bookFile.close();
-    spineFile.close();
-    tocFile.close();
-    return false;
-  }
-  // NOTE: We intentionally skip calling loadAllFileStatSlims() here.
-  // For large EPUBs (2000+ chapters), pre-loading all ZIP central directory entries
-  // into memory causes OOM crashes on ESP32-C3's limited ~380KB RAM.
-  // Instead, for large books we use a one-pass batch lookup that scans the ZIP
-  // central directory once and matches against spine targets using hash comparison.
-  // This is O(n*log(m)) instead of O(n*m) while avoiding memory exhaustion.
-  // See: https://github.com/crosspoint-reader/crosspoint-reader/issues/134
-
   std::vector<uint32_t> spineSizes;
   bool useBatchSizes = false;
 
@@ -191,8 +208,9 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
     targets.reserve(spineCount);
 
     spineFile.seek(0);
+    BufferedReader spineReader(spineFile);
     for (int i = 0; i < spineCount; i++) {
-      auto entry = readSpineEntry(spineFile);
+      auto entry = readSpineEntry(spineReader);
       std::string path = FsHelpers::normalisePath(entry.href);
 
       ZipFile::SizeTarget t;
@@ -218,9 +236,10 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
 
   uint32_t cumSize = 0;
   spineFile.seek(0);
+  BufferedReader spineReader(spineFile);
   int lastSpineTocIndex = -1;
   for (int i = 0; i < spineCount; i++) {
-    auto spineEntry = readSpineEntry(spineFile);
+    auto spineEntry = readSpineEntry(spineReader);
 
     spineEntry.tocIndex = spineToTocIndex[i];
 
@@ -253,22 +272,28 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
     spineEntry.cumulativeSize = cumSize;
 
     // Write out spine data to book.bin
-    writeSpineEntry(bookFile, spineEntry);
+    writeSpineEntry(bookOut, spineEntry);
   }
   // Close opened zip file
   zip.close();
 
   // Loop through toc entries from toc file writing to book.bin
   tocFile.seek(0);
+  BufferedReader tocReader(tocFile);
   for (int i = 0; i < tocCount; i++) {
-    auto tocEntry = readTocEntry(tocFile);
-    writeTocEntry(bookFile, tocEntry);
+    auto tocEntry = readTocEntry(tocReader);
+    writeTocEntry(bookOut, tocEntry);
   }
 
+  const bool written = bookOut.flush() && !bookOut.hasError();
   bookFile.close();
   spineFile.close();
   tocFile.close();
 
+  if (!written) {
+    LOG_ERR("BMC", "Failed to write book.bin");
+    return false;
+  }
   LOG_DBG("BMC", "Successfully built book.bin");
   return true;
 }
@@ -283,7 +308,8 @@ bool BookMetadataCache::cleanupTmpFiles() const {
   return true;
 }
 
-uint32_t BookMetadataCache::writeSpineEntry(FsFile& file, const SpineEntry& entry) const {
+template <typename File>
+uint32_t BookMetadataCache::writeSpineEntry(File& file, const SpineEntry& entry) const {
   const uint32_t pos = file.position();
   serialization::writeString(file, entry.href);
   serialization::writePod(file, entry.cumulativeSize);
@@ -291,7 +317,8 @@ uint32_t BookMetadataCache::writeSpineEntry(FsFile& file, const SpineEntry& entr
   return pos;
 }
 
-uint32_t BookMetadataCache::writeTocEntry(FsFile& file, const TocEntry& entry) const {
+template <typename File>
+uint32_t BookMetadataCache::writeTocEntry(File& file, const TocEntry& entry) const {
   const uint32_t pos = file.position();
   serialization::writeString(file, entry.title);
   serialization::writeString(file, entry.href);
@@ -343,8 +370,9 @@ void BookMetadataCache::createTocEntry(const std::string& title, const std::stri
     }
   } else {
     spineFile.seek(0);
+    BufferedReader spineReader(spineFile);
     for (int i = 0; i < spineCount; i++) {
-      auto spineEntry = readSpineEntry(spineFile);
+      auto spineEntry = readSpineEntry(spineReader);
       if (spineEntry.href == href) {
         spineIndex = static_cast<int16_t>(i);
         break;
@@ -403,10 +431,11 @@ BookMetadataCache::SpineEntry BookMetadataCache::getSpineEntry(const int index)
 
   // Seek to spine LUT item, read from LUT and get out data
   bookFile.seek(lutOffset + sizeof(uint32_t) * index);
+  BufferedReader reader(bookFile, ENTRY_READ_BLOCK_SIZE);
   uint32_t spineEntryPos;
-  serialization::readPod(bookFile, spineEntryPos);
-  bookFile.seek(spineEntryPos);
-  return readSpineEntry(bookFile);
+  serialization::readPod(reader, spineEntryPos);
+  reader.seek(spineEntryPos);
+  return readSpineEntry(reader);
 }
 
 BookMetadataCache::TocEntry BookMetadataCache::getTocEntry(const int index) {
@@ -422,13 +451,15 @@ BookMetadataCache::TocEntry BookMetadataCache::getTocEntry(const int index) {
 
   // Seek to TOC LUT item, read from LUT and get out data
   bookFile.seek(lutOffset + sizeof(uint32_t) * spineCount + sizeof(uint32_t) * index);
+  BufferedReader reader(bookFile, ENTRY_READ_BLOCK_SIZE);
   uint32_t tocEntryPos;
-  serialization::readPod(bookFile, tocEntryPos);
-  bookFile.seek(tocEntryPos);
-  return readTocEntry(bookFile);
+  serialization::readPod(reader, tocEntryPos);
+  reader.seek(tocEntryPos);
+  return readTocEntry(reader);
 }
 
-BookMetadataCache::SpineEntry BookMetadataCache::readSpineEntry(FsFile& file) const {
+template <typename File>
+BookMetadataCache::SpineEntry BookMetadataCache::readSpineEntry(File& file) const {
   SpineEntry entry;
   serialization::readString(file, entry.href);
   serialization::readPod(file, entry.cumulativeSize);
@@ -436,7 +467,8 @@ BookMetadataCache::SpineEntry BookMetadataCache::readSpineEntry(FsFile& file) co
   return entry;
 }
 
-BookMetadataCache::TocEntry BookMetadataCache::readTocEntry(FsFile& file) const {
+template <typename File>
+BookMetadataCache::TocEntry BookMetadataCache::readTocEntry(File& file) const {
   TocEntry entry;
   serialization::readString(file, entry.title);
   serialization::readString(file, entry.href);
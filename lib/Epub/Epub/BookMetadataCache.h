@@ -76,10 +76,15 @@ class BookMetadataCache {
     return hash;
   }
 
-  uint32_t writeSpineEntry(FsFile& file, const SpineEntry& entry) const;
-  uint32_t writeTocEntry(FsFile& file, const TocEntry& entry) const;
-  SpineEntry readSpineEntry(FsFile& file) const;
-  TocEntry readTocEntry(FsFile& file) const;
+  // Work on FsFile as well as BufferedReader/BufferedWriter
+  template <typename File>
+  uint32_t writeSpineEntry(File& file, const SpineEntry& entry) const;
+  template <typename File>
+  uint32_t writeTocEntry(File& file, const TocEntry& entry) const;
+  template <typename File>
+  SpineEntry readSpineEntry(File& file) const;
+  template <typename File>
+  TocEntry readTocEntry(File& file) const;
 
  public:
   BookMetadata coreMetadata;
@@ -0,0 +1,80 @@
+#include "EpubStreamScanner.h"
+
+#include <HeapTags.h>
+#include <Logging.h>
+
+#include <strings.h>
+
+#include "parsers/ContainerParser.h"
+
+namespace {
+bool hasOpfExtension(const std::string& name) {
+  return name.size() > 4 && strcasecmp(name.c_str() + name.size() - 4, ".opf") == 0;
+}
+}  // namespace
+
+EpubStreamScanner::EpubStreamScanner()
+    : zip([this](const ZipStreamScanner::Entry& entry) { return wants(entry); },
+          [this](const ZipStreamScanner::Entry& entry, uint8_t* data, const size_t size) {
+            return keep(entry, data, size);
+          }) {}
+
+EpubStreamScanner::~EpubStreamScanner() {
+  HeapTags::release(container);
+  dropOpf();
+}
+
+size_t EpubStreamScanner::write(const uint8_t byte) { return write(&byte, 1); }
+
+size_t EpubStreamScanner::write(const uint8_t* buffer, const size_t size) { return zip.write(buffer, size); }
+
+bool EpubStreamScanner::wants(const ZipStreamScanner::Entry& entry) const {
+  if (entry.name == CONTAINER_PATH) {
+    return !container;
+  }
+  // container.xml usually comes first and names the OPF; until it has, any .opf is worth keeping
+  return !opf && (opfPath.empty() ? hasOpfExtension(entry.name) : entry.name == opfPath);
+}
+
+bool EpubStreamScanner::keep(const ZipStreamScanner::Entry& entry, uint8_t* data, const size_t size) {
+  if (entry.name != CONTAINER_PATH) {
+    opf = data;
+    opfSize = size;
+    opfName = entry.name;
+    LOG_DBG("ESS", "Kept %s (%zu bytes)", opfName.c_str(), opfSize);
+    return true;
+  }
+
+  ContainerParser parser(size);
+  if (!parser.setup() || parser.write(data, size) != size || parser.fullPath.empty()) {
+    LOG_ERR("ESS", "No rootfile in container.xml");
+    return false;
+  }
+  container = data;
+  containerSize = size;
+  opfPath = std::move(parser.fullPath);
+  if (opf && opfName != opfPath) {
+    dropOpf();
+  }
+  return true;
+}
+
+bool EpubStreamScanner::find(const std::string& path, const uint8_t** data, size_t* size) const {
+  if (container && path == CONTAINER_PATH) {
+    *data = container;
+    *size = containerSize;
+    return true;
+  }
+  if (hasPackage() && path == opfPath) {
+    *data = opf;
+    *size = opfSize;
+    return true;
+  }
+  return false;
+}
+
+void EpubStreamScanner::dropOpf() {
+  HeapTags::release(opf);
+  opf = nullptr;
+  opfName.clear();
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <Print.h>
+#include <ZipStreamScanner.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * Sits beside the file as an EPUB downloads and keeps META-INF/container.xml and the package document (OPF) as they
+ * stream past, so Epub::load() can build book.bin as soon as the download ends without looking for them in the
+ * archive again (see Epub::preloadFrom).
+ *
+ * A download that isn't a ZIP archive at all, typically an HTML error or login page served with a 200, is rejected
+ * on its first bytes: write() refuses them so the download stops there.
+ */
+class EpubStreamScanner final : public Print {
+ public:
+  static constexpr const char* CONTAINER_PATH = "META-INF/container.xml";
+
+  EpubStreamScanner();
+  ~EpubStreamScanner() override;
+
+  EpubStreamScanner(const EpubStreamScanner&) = delete;
+  EpubStreamScanner& operator=(const EpubStreamScanner&) = delete;
+
+  size_t write(uint8_t byte) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+
+  // The stream isn't a ZIP archive
+  bool rejected() const { return zip.status() == ZipStreamScanner::Status::INVALID; }
+  // Both container.xml and the OPF it names were kept
+  bool hasPackage() const { return container && opf && opfPath == opfName; }
+  const std::string& getOpfPath() const { return opfPath; }
+  // Finds a kept item by its path in the archive. `data` stays valid as long as the scanner.
+  bool find(const std::string& path, const uint8_t** data, size_t* size) const;
+
+ private:
+  ZipStreamScanner zip;
+  uint8_t* container = nullptr;
+  size_t containerSize = 0;
+  std::string opfPath;  // From container.xml, once it has been seen
+  uint8_t* opf = nullptr;
+  size_t opfSize = 0;
+  std::string opfName;  // Entry name of the kept OPF
+
+  bool wants(const ZipStreamScanner::Entry& entry) const;
+  bool keep(const ZipStreamScanner::Entry& entry, uint8_t* data, size_t size);
+  void dropOpf();
+};
@@ -7,21 +7,21 @@ void PageLine::render(GfxRenderer& renderer, const int fontId, const int xOffset
   block->render(renderer, fontId, xPos + xOffset, yPos + yOffset);
 }
 
-bool PageLine::serialize(FsFile& file) {
-  serialization::writePod(file, xPos);
-  serialization::writePod(file, yPos);
+bool PageLine::serialize(BufferedWriter& writer) {
+  serialization::writePod(writer, xPos);
+  serialization::writePod(writer, yPos);
 
   // serialize TextBlock pointed to by PageLine
-  return block->serialize(file);
+  return block->serialize(writer);
 }
 
-std::unique_ptr<PageLine> PageLine::deserialize(FsFile& file) {
+std::unique_ptr<PageLine> PageLine::deserialize(BufferedReader& reader) {
   int16_t xPos;
   int16_t yPos;
-  serialization::readPod(file, xPos);
-  serialization::readPod(file, yPos);
+  serialization::readPod(reader, xPos);
+  serialization::readPod(reader, yPos);
 
-  auto tb = TextBlock::deserialize(file);
+  auto tb = TextBlock::deserialize(reader);
   return std::unique_ptr<PageLine>(new PageLine(std::move(tb), xPos, yPos));
 }
 
@@ -30,21 +30,21 @@ void PageImage::render(GfxRenderer& renderer, const int fontId, const int xOffse
   imageBlock->render(renderer, xPos + xOffset, yPos + yOffset);
 }
 
-bool PageImage::serialize(FsFile& file) {
-  serialization::writePod(file, xPos);
-  serialization::writePod(file, yPos);
+bool PageImage::serialize(BufferedWriter& writer) {
+  serialization::writePod(writer, xPos);
+  serialization::writePod(writer, yPos);
 
   // serialize ImageBlock
-  return imageBlock->serialize(file);
+  return imageBlock->serialize(writer);
 }
 
-std::unique_ptr<PageImage> PageImage::deserialize(FsFile& file) {
+std::unique_ptr<PageImage> PageImage::deserialize(BufferedReader& reader) {
   int16_t xPos;
   int16_t yPos;
-  serialization::readPod(file, xPos);
-  serialization::readPod(file, yPos);
+  serialization::readPod(reader, xPos);
+  serialization::readPod(reader, yPos);
 
-  auto ib = ImageBlock::deserialize(file);
+  auto ib = ImageBlock::deserialize(reader);
   return std::unique_ptr<PageImage>(new PageImage(std::move(ib), xPos, yPos));
 }
 
@@ -54,26 +54,26 @@ void Page::render(GfxRenderer& renderer, const int fontId, const int xOffset, co
   }
 }
 
-bool Page::serialize(FsFile& file) const {
+bool Page::serialize(BufferedWriter& writer) const {
   const uint16_t count = elements.size();
-  serialization::writePod(file, count);
+  serialization::writePod(writer, count);
 
   for (const auto& el : elements) {
     // Use getTag() method to determine type
-    serialization::writePod(file, static_cast<uint8_t>(el->getTag()));
+    serialization::writePod(writer, static_cast<uint8_t>(el->getTag()));
 
-    if (!el->serialize(file)) {
+    if (!el->serialize(writer)) {
       return false;
     }
   }
 
   // Serialize footnotes (clamp to MAX_FOOTNOTES_PER_PAGE to match addFootnote/deserialize limits)
   const uint16_t fnCount = std::min<uint16_t>(footnotes.size(), MAX_FOOTNOTES_PER_PAGE);
-  serialization::writePod(file, fnCount);
+  serialization::writePod(writer, fnCount);
   for (uint16_t i = 0; i < fnCount; i++) {
     const auto& fn = footnotes[i];
-    if (file.write(fn.number, sizeof(fn.number)) != sizeof(fn.number) ||
-        file.write(fn.href, sizeof(fn.href)) != sizeof(fn.href)) {
+    if (writer.write(fn.number, sizeof(fn.number)) != sizeof(fn.number) ||
+        writer.write(fn.href, sizeof(fn.href)) != sizeof(fn.href)) {
       LOG_ERR("PGE", "Failed to write footnote");
       return false;
     }
@@ -82,21 +82,21 @@ bool Page::serialize(FsFile& file) const {
   return true;
 }
 
-std::unique_ptr<Page> Page::deserialize(FsFile& file) {
+std::unique_ptr<Page> Page::deserialize(BufferedReader& reader) {
   auto page = std::unique_ptr<Page>(new Page());
 
   uint16_t count;
-  serialization::readPod(file, count);
+  serialization::readPod(reader, count);
 
   for (uint16_t i = 0; i < count; i++) {
     uint8_t tag;
-    serialization::readPod(file, tag);
+    serialization::readPod(reader, tag);
 
     if (tag == TAG_PageLine) {
-      auto pl = PageLine::deserialize(file);
+      auto pl = PageLine::deserialize(reader);
       page->elements.push_back(std::move(pl));
     } else if (tag == TAG_PageImage) {
-      auto pi = PageImage::deserialize(file);
+      auto pi = PageImage::deserialize(reader);
       page->elements.push_back(std::move(pi));
     } else {
       LOG_ERR("PGE", "Deserialization failed: Unknown tag %u", tag);
@@ -106,7 +106,7 @@ std::unique_ptr<Page> Page::deserialize(FsFile& file) {
 
   // Deserialize footnotes
   uint16_t fnCount;
-  serialization::readPod(file, fnCount);
+  serialization::readPod(reader, fnCount);
   if (fnCount > MAX_FOOTNOTES_PER_PAGE) {
     LOG_ERR("PGE", "Invalid footnote count %u", fnCount);
     return nullptr;
@@ -114,8 +114,8 @@ std::unique_ptr<Page> Page::deserialize(FsFile& file) {
   page->footnotes.resize(fnCount);
   for (uint16_t i = 0; i < fnCount; i++) {
     auto& entry = page->footnotes[i];
-    if (file.read(entry.number, sizeof(entry.number)) != sizeof(entry.number) ||
-        file.read(entry.href, sizeof(entry.href)) != sizeof(entry.href)) {
+    if (reader.read(entry.number, sizeof(entry.number)) != sizeof(entry.number) ||
+        reader.read(entry.href, sizeof(entry.href)) != sizeof(entry.href)) {
       LOG_ERR("PGE", "Failed to read footnote %u", i);
       return nullptr;
     }
@@ -1,5 +1,5 @@
 #pragma once
-#include <HalStorage.h>
+#include <BufferedFile.h>
 
 #include <algorithm>
 #include <utility>
@@ -22,7 +22,7 @@ class PageElement {
   explicit PageElement(const int16_t xPos, const int16_t yPos) : xPos(xPos), yPos(yPos) {}
   virtual ~PageElement() = default;
   virtual void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) = 0;
-  virtual bool serialize(FsFile& file) = 0;
+  virtual bool serialize(BufferedWriter& writer) = 0;
   virtual PageElementTag getTag() const = 0;  // Add type identification
 };
 
@@ -35,9 +35,9 @@ class PageLine final : public PageElement {
       : PageElement(xPos, yPos), block(std::move(block)) {}
   const std::shared_ptr<TextBlock>& getBlock() const { return block; }
   void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) override;
-  bool serialize(FsFile& file) override;
+  bool serialize(BufferedWriter& writer) override;
   PageElementTag getTag() const override { return TAG_PageLine; }
-  static std::unique_ptr<PageLine> deserialize(FsFile& file);
+  static std::unique_ptr<PageLine> deserialize(BufferedReader& reader);
 };
 
 // New PageImage class
@@ -48,9 +48,9 @@ class PageImage final : public PageElement {
   PageImage(std::shared_ptr<ImageBlock> block, const int16_t xPos, const int16_t yPos)
       : PageElement(xPos, yPos), imageBlock(std::move(block)) {}
   void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) override;
-  bool serialize(FsFile& file) override;
+  bool serialize(BufferedWriter& writer) override;
   PageElementTag getTag() const override { return TAG_PageImage; }
-  static std::unique_ptr<PageImage> deserialize(FsFile& file);
+  static std::unique_ptr<PageImage> deserialize(BufferedReader& reader);
   const ImageBlock& getImageBlock() const { return *imageBlock; }
 };
 
@@ -72,8 +72,8 @@ class Page {
   }
 
   void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) const;
-  bool serialize(FsFile& file) const;
-  static std::unique_ptr<Page> deserialize(FsFile& file);
+  bool serialize(BufferedWriter& writer) const;
+  static std::unique_ptr<Page> deserialize(BufferedReader& reader);
 
   // Check if page contains any images (used to force full refresh)
   bool hasImages() const {
@@ -0,0 +1,383 @@
+#include "PageLayoutBuilder.h"
+
+#include <GfxRenderer.h>
+#include <HalStorage.h>
+#include <Logging.h>
+
+#include <climits>
+
+#include "Page.h"
+
+namespace {
+// If we have > 750 words buffered up, perform the layout and consume out all but the last line
+// There should be enough here to build out 1-2 full pages and doing this will free up a lot of
+// memory.
+// Spotted when reading Intermezzo, there are some really long text blocks in there.
+constexpr size_t MAX_BUFFERED_WORDS = 750;
+}  // namespace
+
+float PageLayoutBuilder::emSize() const { return static_cast<float>(renderer.getLineHeight(fontId)) * lineCompression; }
+
+// Resolve the None ("Book's Style") sentinel to Justify for blocks that have no CSS context
+CssTextAlign PageLayoutBuilder::defaultAlignment() const {
+  if (paragraphAlignment == static_cast<uint8_t>(CssTextAlign::None)) {
+    return CssTextAlign::Justify;
+  }
+  return static_cast<CssTextAlign>(paragraphAlignment);
+}
+
+BlockStyle PageLayoutBuilder::resolveBlockStyle(const ParsedBlockKind kind, const CssStyle& cssStyle) const {
+  switch (kind) {
+    case ParsedBlockKind::Centered: {
+      BlockStyle centeredBlockStyle;
+      centeredBlockStyle.textAlignDefined = true;
+      centeredBlockStyle.alignment = CssTextAlign::Center;
+      return centeredBlockStyle;
+    }
+    case ParsedBlockKind::Header: {
+      auto headerBlockStyle = BlockStyle::fromCssStyle(cssStyle, emSize(), CssTextAlign::Center, viewportWidth);
+      headerBlockStyle.textAlignDefined = true;
+      if (embeddedStyle && cssStyle.hasTextAlign()) {
+        headerBlockStyle.alignment = cssStyle.textAlign;
+      }
+      return headerBlockStyle;
+    }
+    case ParsedBlockKind::Paragraph:
+      return BlockStyle::fromCssStyle(cssStyle, emSize(), static_cast<CssTextAlign>(paragraphAlignment),
+                                      viewportWidth);
+    case ParsedBlockKind::LineBreak:
+      return currentTextBlock ? currentTextBlock->getBlockStyle() : BlockStyle();
+    case ParsedBlockKind::Default:
+    default: {
+      BlockStyle paragraphAlignmentBlockStyle;
+      paragraphAlignmentBlockStyle.textAlignDefined = true;
+      paragraphAlignmentBlockStyle.alignment = defaultAlignment();
+      return paragraphAlignmentBlockStyle;
+    }
+  }
+}
+
+// start a new text block if needed
+void PageLayoutBuilder::startNewTextBlock(const BlockStyle& blockStyle) {
+  if (currentTextBlock) {
+    // already have a text block running and it is empty - just reuse it
+    if (currentTextBlock->isEmpty()) {
+      // Merge with existing block style to accumulate CSS styling from parent block elements.
+      // This handles cases like <div style="margin-bottom:2em"><h1>text</h1></div> where the
+      // div's margin should be preserved, even though it has no direct text content.
+      currentTextBlock->setBlockStyle(currentTextBlock->getBlockStyle().getCombinedBlockStyle(blockStyle));
+      return;
+    }
+
+    makePages();
+  }
+  currentTextBlock.reset(new ParsedText(extraParagraphSpacing, hyphenationEnabled, blockStyle));
+  wordsExtractedInBlock = 0;
+  // Anchors left at the end of the previous block point at the start of this one
+  for (auto& [wordIndex, hash] : pendingAnchors) {
+    wordIndex = 0;
+  }
+}
+
+void PageLayoutBuilder::addWord(ParsedContentRecord& record) {
+  if (!currentTextBlock) {
+    startNewTextBlock(resolveBlockStyle(ParsedBlockKind::Default, CssStyle()));
+  }
+  currentTextBlock->addWord(std::move(record.text), record.style, false, record.continues);
+
+  if (currentTextBlock->size() > MAX_BUFFERED_WORDS) {
+    LOG_DBG("PLB", "Text block too long, splitting into multiple pages");
+    currentTextBlock->layoutAndExtractLines(
+        renderer, fontId, viewportWidth,
+        [this](const std::shared_ptr<TextBlock>& textBlock) { addLineToPage(textBlock); }, false);
+  }
+}
+
+void PageLayoutBuilder::addImage(const ParsedContentRecord& record) {
+  const int16_t imageWidth = record.width;
+  const int16_t imageHeight = record.height;
+  const CssStyle& imgStyle = record.cssStyle;
+
+  int displayWidth = 0;
+  int displayHeight = 0;
+  const float em = emSize();
+  const bool hasCssHeight = imgStyle.hasImageHeight();
+  const bool hasCssWidth = imgStyle.hasImageWidth();
+
+  if (hasCssHeight && hasCssWidth && imageWidth > 0 && imageHeight > 0) {
+    // Both CSS height and width set: resolve both, then clamp to viewport preserving requested ratio
+    displayHeight = static_cast<int>(imgStyle.imageHeight.toPixels(em, static_cast<float>(viewportHeight)) + 0.5f);
+    displayWidth = static_cast<int>(imgStyle.imageWidth.toPixels(em, static_cast<float>(viewportWidth)) + 0.5f);
+    if (displayHeight < 1) displayHeight = 1;
+    if (displayWidth < 1) displayWidth = 1;
+    if (displayWidth > viewportWidth || displayHeight > viewportHeight) {
+      float scaleX = (displayWidth > viewportWidth) ? static_cast<float>(viewportWidth) / displayWidth : 1.0f;
+      float scaleY = (displayHeight > viewportHeight) ? static_cast<float>(viewportHeight) / displayHeight : 1.0f;
+      float scale = (scaleX < scaleY) ? scaleX : scaleY;
+      displayWidth = static_cast<int>(displayWidth * scale + 0.5f);
+      displayHeight = static_cast<int>(displayHeight * scale + 0.5f);
+      if (displayWidth < 1) displayWidth = 1;
+      if (displayHeight < 1) displayHeight = 1;
+    }
+    LOG_DBG("PLB", "Display size from CSS height+width: %dx%d", displayWidth, displayHeight);
+  } else if (hasCssHeight && !hasCssWidth && imageWidth > 0 && imageHeight > 0) {
+    // Use CSS height (resolve % against viewport height) and derive width from aspect ratio
+    displayHeight = static_cast<int>(imgStyle.imageHeight.toPixels(em, static_cast<float>(viewportHeight)) + 0.5f);
+    if (displayHeight < 1) displayHeight = 1;
+    displayWidth = static_cast<int>(displayHeight * (static_cast<float>(imageWidth) / imageHeight) + 0.5f);
+    if (displayHeight > viewportHeight) {
+      displayHeight = viewportHeight;
+      // Rescale width to preserve aspect ratio when height is clamped
+      displayWidth = static_cast<int>(displayHeight * (static_cast<float>(imageWidth) / imageHeight) + 0.5f);
+      if (displayWidth < 1) displayWidth = 1;
+    }
+    if (displayWidth > viewportWidth) {
+      displayWidth = viewportWidth;
+      // Rescale height to preserve aspect ratio when width is clamped
+      displayHeight = static_cast<int>(displayWidth * (static_cast<float>(imageHeight) / imageWidth) + 0.5f);
+      if (displayHeight < 1) displayHeight = 1;
+    }
+    if (displayWidth < 1) displayWidth = 1;
+    LOG_DBG("PLB", "Display size from CSS height: %dx%d", displayWidth, displayHeight);
+  } else if (hasCssWidth && !hasCssHeight && imageWidth > 0 && imageHeight > 0) {
+    // Use CSS width (resolve % against viewport width) and derive height from aspect ratio
+    displayWidth = static_cast<int>(imgStyle.imageWidth.toPixels(em, static_cast<float>(viewportWidth)) + 0.5f);
+    if (displayWidth > viewportWidth) displayWidth = viewportWidth;
+    if (displayWidth < 1) displayWidth = 1;
+    displayHeight = static_cast<int>(displayWidth * (static_cast<float>(imageHeight) / imageWidth) + 0.5f);
+    if (displayHeight > viewportHeight) {
+      displayHeight = viewportHeight;
+      // Rescale width to preserve aspect ratio when height is clamped
+      displayWidth = static_cast<int>(displayHeight * (static_cast<float>(imageWidth) / imageHeight) + 0.5f);
+      if (displayWidth < 1) displayWidth = 1;
+    }
+    if (displayHeight < 1) displayHeight = 1;
+    LOG_DBG("PLB", "Display size from CSS width: %dx%d", displayWidth, displayHeight);
+  } else {
+    // Scale to fit viewport while maintaining aspect ratio
+    int maxWidth = viewportWidth;
+    int maxHeight = viewportHeight;
+    float scaleX = (imageWidth > maxWidth) ? (float)maxWidth / imageWidth : 1.0f;
+    float scaleY = (imageHeight > maxHeight) ? (float)maxHeight / imageHeight : 1.0f;
+    float scale = (scaleX < scaleY) ? scaleX : scaleY;
+    if (scale > 1.0f) scale = 1.0f;
+
+    displayWidth = (int)(imageWidth * scale);
+    displayHeight = (int)(imageHeight * scale);
+    LOG_DBG("PLB", "Display size: %dx%d (scale %.2f)", displayWidth, displayHeight, scale);
+  }
+
+  // Create page for image - only break if image won't fit remaining space
+  if (currentPage && !currentPage->elements.empty() && (currentPageNextY + displayHeight > viewportHeight)) {
+    completePage();
+    currentPage.reset(new Page());
+    currentPageNextY = 0;
+  } else if (!currentPage) {
+    currentPage.reset(new Page());
+    currentPageNextY = 0;
+  }
+
+  // Anchors waiting for content with no words buffered ahead of them belong to this image's page
+  if (!currentTextBlock || currentTextBlock->isEmpty()) {
+    resolvePendingAnchors(INT_MAX);
+  }
+
+  auto imageBlock = std::make_shared<ImageBlock>(record.text, displayWidth, displayHeight);
+  int xPos = (viewportWidth - displayWidth) / 2;
+  currentPage->elements.push_back(std::make_shared<PageImage>(imageBlock, xPos, currentPageNextY));
+  currentPageNextY += displayHeight;
+}
+
+void PageLayoutBuilder::addFootnote(const ParsedContentRecord& record) {
+  FootnoteEntry entry;
+  strncpy(entry.number, record.text.c_str(), sizeof(entry.number) - 1);
+  entry.number[sizeof(entry.number) - 1] = '\0';
+  strncpy(entry.href, record.href.c_str(), sizeof(entry.href) - 1);
+  entry.href[sizeof(entry.href) - 1] = '\0';
+  const int wordIndex = wordsExtractedInBlock + (currentTextBlock ? static_cast<int>(currentTextBlock->size()) : 0);
+  pendingFootnotes.push_back({wordIndex, entry});
+}
+
+void PageLayoutBuilder::addAnchor(const ParsedContentRecord& record) {
+  const int wordIndex = wordsExtractedInBlock + (currentTextBlock ? static_cast<int>(currentTextBlock->size()) : 0);
+  pendingAnchors.push_back({wordIndex, record.anchorHash});
+}
+
+// Assign anchors whose target word comes before `beforeWordIndex` to the page currently being filled
+void PageLayoutBuilder::resolvePendingAnchors(const int beforeWordIndex) {
+  auto anchorIt = pendingAnchors.begin();
+  while (anchorIt != pendingAnchors.end() && anchorIt->first < beforeWordIndex) {
+    anchors.push_back({anchorIt->second, completedPageCount});
+    ++anchorIt;
+  }
+  pendingAnchors.erase(pendingAnchors.begin(), anchorIt);
+}
+
+void PageLayoutBuilder::completePage() {
+  completePageFn(std::move(currentPage));
+  completedPageCount++;
+}
+
+// Reset alignment on empty text blocks to prevent stale alignment from bleeding
+// into the next sibling element. This fixes issue #1026 where an empty <h1> (default
+// Center) followed by an image-only <p> causes Center to persist through the chain
+// of empty block reuse into subsequent text paragraphs.
+// Margins/padding are preserved so parent element spacing still accumulates correctly.
+void PageLayoutBuilder::resetEmptyBlockAlignment() {
+  if (currentTextBlock && currentTextBlock->isEmpty()) {
+    auto style = currentTextBlock->getBlockStyle();
+    style.textAlignDefined = false;
+    style.alignment = defaultAlignment();
+    currentTextBlock->setBlockStyle(style);
+  }
+}
+
+bool PageLayoutBuilder::buildPages(const std::string& parsedContentPath) {
+  FsFile file;
+  if (!Storage.openFileForRead("PLB", parsedContentPath, file)) {
+    return false;
+  }
+
+  BufferedReader in(file);
+  ParsedContentReader reader(in);
+  if (!reader.readHeader(embeddedStyle)) {
+    file.close();
+    return false;
+  }
+
+  const uint32_t layoutStartTime = millis();
+  ParsedContentRecord record;
+  bool ended = false;
+  while (!ended) {
+    if (!reader.next(record)) {
+      LOG_ERR("PLB", "Failed to read parsed content");
+      file.close();
+      return false;
+    }
+
+    switch (record.tag) {
+      case ParsedContentTag::Word:
+        addWord(record);
+        break;
+      case ParsedContentTag::Block:
+        startNewTextBlock(resolveBlockStyle(record.blockKind, record.cssStyle));
+        break;
+      case ParsedContentTag::ResetBlockAlignment:
+        resetEmptyBlockAlignment();
+        break;
+      case ParsedContentTag::Image:
+        addImage(record);
+        break;
+      case ParsedContentTag::Footnote:
+        addFootnote(record);
+        break;
+      case ParsedContentTag::Anchor:
+        addAnchor(record);
+        break;
+      case ParsedContentTag::End:
+        ended = true;
+        break;
+    }
+  }
+  file.close();
+
+  // Process last page if there is still text
+  if (currentTextBlock) {
+    makePages();
+    resolvePendingAnchors(INT_MAX);
+    completePage();
+    currentPage.reset();
+    currentTextBlock.reset();
+  }
+  // Anchors after the last content point at the last page
+  const uint16_t lastPage = completedPageCount > 0 ? completedPageCount - 1 : 0;
+  for (const auto& [wordIndex, hash] : pendingAnchors) {
+    anchors.push_back({hash, lastPage});
+  }
+  pendingAnchors.clear();
+  LOG_DBG("PLB", "Time to lay out pages: %lu ms", millis() - layoutStartTime);
+
+  return true;
+}
+
+void PageLayoutBuilder::addLineToPage(std::shared_ptr<TextBlock> line) {
+  const int lineHeight = renderer.getLineHeight(fontId) * lineCompression;
+
+  if (currentPageNextY + lineHeight > viewportHeight) {
+    completePage();
+    currentPage.reset(new Page());
+    currentPageNextY = 0;
+  }
+
+  // Anchors point at the word that follows them, so they belong to the page holding this line if that word is on it
+  resolvePendingAnchors(wordsExtractedInBlock + static_cast<int>(line->wordCount()));
+
+  // Track cumulative words to assign footnotes to the page containing their anchor
+  wordsExtractedInBlock += line->wordCount();
+  auto footnoteIt = pendingFootnotes.begin();
+  while (footnoteIt != pendingFootnotes.end() && footnoteIt->first <= wordsExtractedInBlock) {
+    currentPage->addFootnote(footnoteIt->second.number, footnoteIt->second.href);
+    ++footnoteIt;
+  }
+  pendingFootnotes.erase(pendingFootnotes.begin(), footnoteIt);
+
+  // Apply horizontal left inset (margin + padding) as x position offset
+  const int16_t xOffset = line->getBlockStyle().leftInset();
+  currentPage->elements.push_back(std::make_shared<PageLine>(line, xOffset, currentPageNextY));
+  currentPageNextY += lineHeight;
+}
+
+void PageLayoutBuilder::makePages() {
+  if (!currentTextBlock) {
+    LOG_ERR("PLB", "!! No text block to make pages for !!");
+    return;
+  }
+
+  if (!currentPage) {
+    currentPage.reset(new Page());
+    currentPageNextY = 0;
+  }
+
+  const int lineHeight = renderer.getLineHeight(fontId) * lineCompression;
+
+  // Apply top spacing before the paragraph (stored in pixels)
+  const BlockStyle& blockStyle = currentTextBlock->getBlockStyle();
+  if (blockStyle.marginTop > 0) {
+    currentPageNextY += blockStyle.marginTop;
+  }
+  if (blockStyle.paddingTop > 0) {
+    currentPageNextY += blockStyle.paddingTop;
+  }
+
+  // Calculate effective width accounting for horizontal margins/padding
+  const int horizontalInset = blockStyle.totalHorizontalInset();
+  const uint16_t effectiveWidth =
+      (horizontalInset < viewportWidth) ? static_cast<uint16_t>(viewportWidth - horizontalInset) : viewportWidth;
+
+  currentTextBlock->layoutAndExtractLines(
+      renderer, fontId, effectiveWidth,
+      [this](const std::shared_ptr<TextBlock>& textBlock) { addLineToPage(textBlock); });
+
+  // Fallback: transfer any remaining pending footnotes to current page.
+  // Normally addLineToPage handles this via word-index tracking, but this catches
+  // edge cases where a footnote's word index equals the exact block size.
+  if (!pendingFootnotes.empty() && currentPage) {
+    for (const auto& [idx, fn] : pendingFootnotes) {
+      currentPage->addFootnote(fn.number, fn.href);
+    }
+    pendingFootnotes.clear();
+  }
+
+  // Apply bottom spacing after the paragraph (stored in pixels)
+  if (blockStyle.marginBottom > 0) {
+    currentPageNextY += blockStyle.marginBottom;
+  }
+  if (blockStyle.paddingBottom > 0) {
+    currentPageNextY += blockStyle.paddingBottom;
+  }
+
+  // Extra paragraph spacing if enabled (default behavior)
+  if (extraParagraphSpacing) {
+    currentPageNextY += lineHeight / 2;
+  }
+}
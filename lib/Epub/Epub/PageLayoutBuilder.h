@@ -0,0 +1,83 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "FootnoteEntry.h"
+#include "ParsedContent.h"
+#include "ParsedText.h"
+#include "blocks/BlockStyle.h"
+#include "blocks/TextBlock.h"
+
+class Page;
+class GfxRenderer;
+
+struct AnchorEntry {
+  uint32_t hash;  // hashAnchorId() of the element id
+  uint16_t page;
+};
+
+// Lays out a parsed content stream (see ParsedContent.h) into pages for one set of reader settings.
+// This is the only part of section building that depends on font, spacing, alignment and viewport, so changing
+// those settings re-runs just this stage instead of re-inflating and re-parsing the chapter XHTML.
+class PageLayoutBuilder {
+  GfxRenderer& renderer;
+  std::function<void(std::unique_ptr<Page>)> completePageFn;
+  int fontId;
+  float lineCompression;
+  bool extraParagraphSpacing;
+  uint8_t paragraphAlignment;
+  uint16_t viewportWidth;
+  uint16_t viewportHeight;
+  bool hyphenationEnabled;
+  bool embeddedStyle;
+
+  std::unique_ptr<ParsedText> currentTextBlock = nullptr;
+  std::unique_ptr<Page> currentPage = nullptr;
+  int16_t currentPageNextY = 0;
+  std::vector<std::pair<int, FootnoteEntry>> pendingFootnotes;  // <wordIndex, entry>
+  std::vector<std::pair<int, uint32_t>> pendingAnchors;         // <wordIndex, hash>
+  std::vector<AnchorEntry> anchors;
+  uint16_t completedPageCount = 0;
+  int wordsExtractedInBlock = 0;
+
+  float emSize() const;
+  CssTextAlign defaultAlignment() const;
+  BlockStyle resolveBlockStyle(ParsedBlockKind kind, const CssStyle& cssStyle) const;
+  void startNewTextBlock(const BlockStyle& blockStyle);
+  void addWord(ParsedContentRecord& record);
+  void addImage(const ParsedContentRecord& record);
+  void addFootnote(const ParsedContentRecord& record);
+  void addAnchor(const ParsedContentRecord& record);
+  void resolvePendingAnchors(int beforeWordIndex);
+  void completePage();
+  void resetEmptyBlockAlignment();
+  void makePages();
+  void addLineToPage(std::shared_ptr<TextBlock> line);
+
+ public:
+  explicit PageLayoutBuilder(GfxRenderer& renderer, const int fontId, const float lineCompression,
+                             const bool extraParagraphSpacing, const uint8_t paragraphAlignment,
+                             const uint16_t viewportWidth, const uint16_t viewportHeight,
+                             const bool hyphenationEnabled, const bool embeddedStyle,
+                             const std::function<void(std::unique_ptr<Page>)>& completePageFn)
+      : renderer(renderer),
+        completePageFn(completePageFn),
+        fontId(fontId),
+        lineCompression(lineCompression),
+        extraParagraphSpacing(extraParagraphSpacing),
+        paragraphAlignment(paragraphAlignment),
+        viewportWidth(viewportWidth),
+        viewportHeight(viewportHeight),
+        hyphenationEnabled(hyphenationEnabled),
+        embeddedStyle(embeddedStyle) {}
+  ~PageLayoutBuilder() = default;
+
+  // Replay the parsed content file at `parsedContentPath` and emit its pages through completePageFn
+  bool buildPages(const std::string& parsedContentPath);
+  // Anchors seen while building, in document order. Valid after buildPages().
+  std::vector<AnchorEntry>& getAnchors() { return anchors; }
+};
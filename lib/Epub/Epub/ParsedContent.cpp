@@ -0,0 +1,261 @@
+#include "ParsedContent.h"
+
+#include <Fnv1a.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <cstring>
+
+namespace {
+constexpr uint8_t PARSED_CONTENT_VERSION = 2;
+
+constexpr uint8_t WORD_CONTINUES_FLAG = 0x80;
+constexpr uint8_t WORD_STYLE_MASK = 0x07;
+// Sanity bound for image paths, which live under the book's cache directory
+constexpr uint32_t MAX_IMAGE_PATH_LENGTH = 512;
+
+// Bit positions match CssParser's rules cache so the two stay easy to compare
+enum CssDefinedBit : uint16_t {
+  TEXT_ALIGN = 1 << 0,
+  FONT_STYLE = 1 << 1,
+  FONT_WEIGHT = 1 << 2,
+  TEXT_DECORATION = 1 << 3,
+  TEXT_INDENT = 1 << 4,
+  MARGIN_TOP = 1 << 5,
+  MARGIN_BOTTOM = 1 << 6,
+  MARGIN_LEFT = 1 << 7,
+  MARGIN_RIGHT = 1 << 8,
+  PADDING_TOP = 1 << 9,
+  PADDING_BOTTOM = 1 << 10,
+  PADDING_LEFT = 1 << 11,
+  PADDING_RIGHT = 1 << 12,
+  IMAGE_HEIGHT = 1 << 13,
+  IMAGE_WIDTH = 1 << 14,
+};
+
+void writeLength(BufferedWriter& out, const CssLength& length) {
+  serialization::writePod(out, length.value);
+  serialization::writePod(out, static_cast<uint8_t>(length.unit));
+}
+
+bool readLength(BufferedReader& in, CssLength& length) {
+  uint8_t unit;
+  if (in.read(&length.value, sizeof(length.value)) != sizeof(length.value) || in.read(&unit, 1) != 1) {
+    return false;
+  }
+  length.unit = static_cast<CssUnit>(unit);
+  return true;
+}
+}  // namespace
+
+uint32_t hashAnchorId(const char* id, const size_t length) { return fnv1a32(id, length); }
+
+// Only properties that are explicitly defined are written, keeping block records to a few bytes for unstyled text
+void ParsedContentWriter::writeCssStyle(const CssStyle& style) {
+  uint16_t definedBits = 0;
+  if (style.defined.textAlign) definedBits |= TEXT_ALIGN;
+  if (style.defined.fontStyle) definedBits |= FONT_STYLE;
+  if (style.defined.fontWeight) definedBits |= FONT_WEIGHT;
+  if (style.defined.textDecoration) definedBits |= TEXT_DECORATION;
+  if (style.defined.textIndent) definedBits |= TEXT_INDENT;
+  if (style.defined.marginTop) definedBits |= MARGIN_TOP;
+  if (style.defined.marginBottom) definedBits |= MARGIN_BOTTOM;
+  if (style.defined.marginLeft) definedBits |= MARGIN_LEFT;
+  if (style.defined.marginRight) definedBits |= MARGIN_RIGHT;
+  if (style.defined.paddingTop) definedBits |= PADDING_TOP;
+  if (style.defined.paddingBottom) definedBits |= PADDING_BOTTOM;
+  if (style.defined.paddingLeft) definedBits |= PADDING_LEFT;
+  if (style.defined.paddingRight) definedBits |= PADDING_RIGHT;
+  if (style.defined.imageHeight) definedBits |= IMAGE_HEIGHT;
+  if (style.defined.imageWidth) definedBits |= IMAGE_WIDTH;
+  serialization::writePod(out, definedBits);
+
+  if (definedBits & TEXT_ALIGN) serialization::writePod(out, static_cast<uint8_t>(style.textAlign));
+  if (definedBits & FONT_STYLE) serialization::writePod(out, static_cast<uint8_t>(style.fontStyle));
+  if (definedBits & FONT_WEIGHT) serialization::writePod(out, static_cast<uint8_t>(style.fontWeight));
+  if (definedBits & TEXT_DECORATION) serialization::writePod(out, static_cast<uint8_t>(style.textDecoration));
+  if (definedBits & TEXT_INDENT) writeLength(out, style.textIndent);
+  if (definedBits & MARGIN_TOP) writeLength(out, style.marginTop);
+  if (definedBits & MARGIN_BOTTOM) writeLength(out, style.marginBottom);
+  if (definedBits & MARGIN_LEFT) writeLength(out, style.marginLeft);
+  if (definedBits & MARGIN_RIGHT) writeLength(out, style.marginRight);
+  if (definedBits & PADDING_TOP) writeLength(out, style.paddingTop);
+  if (definedBits & PADDING_BOTTOM) writeLength(out, style.paddingBottom);
+  if (definedBits & PADDING_LEFT) writeLength(out, style.paddingLeft);
+  if (definedBits & PADDING_RIGHT) writeLength(out, style.paddingRight);
+  if (definedBits & IMAGE_HEIGHT) writeLength(out, style.imageHeight);
+  if (definedBits & IMAGE_WIDTH) writeLength(out, style.imageWidth);
+}
+
+void ParsedContentWriter::writeHeader(const bool embeddedStyle) {
+  serialization::writePod(out, PARSED_CONTENT_VERSION);
+  serialization::writePod(out, embeddedStyle);
+}
+
+void ParsedContentWriter::addWord(const char* word, const uint8_t length, const EpdFontFamily::Style style,
+                                  const bool continues) {
+  const uint8_t flags = (static_cast<uint8_t>(style) & WORD_STYLE_MASK) | (continues ? WORD_CONTINUES_FLAG : 0);
+  serialization::writePod(out, ParsedContentTag::Word);
+  serialization::writePod(out, flags);
+  serialization::writePod(out, length);
+  out.write(word, length);
+}
+
+void ParsedContentWriter::startBlock(const ParsedBlockKind kind, const CssStyle& cssStyle) {
+  serialization::writePod(out, ParsedContentTag::Block);
+  serialization::writePod(out, kind);
+  writeCssStyle(cssStyle);
+}
+
+void ParsedContentWriter::resetBlockAlignment() {
+  serialization::writePod(out, ParsedContentTag::ResetBlockAlignment);
+}
+
+void ParsedContentWriter::addImage(const std::string& path, const int16_t width, const int16_t height,
+                                   const CssStyle& cssStyle) {
+  serialization::writePod(out, ParsedContentTag::Image);
+  serialization::writeString(out, path);
+  serialization::writePod(out, width);
+  serialization::writePod(out, height);
+  writeCssStyle(cssStyle);
+}
+
+void ParsedContentWriter::addFootnote(const char* number, const char* href) {
+  const auto numberLen = static_cast<uint8_t>(strnlen(number, UINT8_MAX));
+  const auto hrefLen = static_cast<uint8_t>(strnlen(href, UINT8_MAX));
+  serialization::writePod(out, ParsedContentTag::Footnote);
+  serialization::writePod(out, numberLen);
+  out.write(number, numberLen);
+  serialization::writePod(out, hrefLen);
+  out.write(href, hrefLen);
+}
+
+void ParsedContentWriter::addAnchor(const char* id) {
+  serialization::writePod(out, ParsedContentTag::Anchor);
+  serialization::writePod(out, hashAnchorId(id, strlen(id)));
+}
+
+void ParsedContentWriter::end() { serialization::writePod(out, ParsedContentTag::End); }
+
+bool ParsedContentReader::readCssStyle(CssStyle& style) {
+  style.reset();
+  uint16_t definedBits;
+  if (in.read(&definedBits, sizeof(definedBits)) != sizeof(definedBits)) {
+    return false;
+  }
+
+  uint8_t enumVal;
+  if (definedBits & TEXT_ALIGN) {
+    if (in.read(&enumVal, 1) != 1) return false;
+    style.textAlign = static_cast<CssTextAlign>(enumVal);
+    style.defined.textAlign = 1;
+  }
+  if (definedBits & FONT_STYLE) {
+    if (in.read(&enumVal, 1) != 1) return false;
+    style.fontStyle = static_cast<CssFontStyle>(enumVal);
+    style.defined.fontStyle = 1;
+  }
+  if (definedBits & FONT_WEIGHT) {
+    if (in.read(&enumVal, 1) != 1) return false;
+    style.fontWeight = static_cast<CssFontWeight>(enumVal);
+    style.defined.fontWeight = 1;
+  }
+  if (definedBits & TEXT_DECORATION) {
+    if (in.read(&enumVal, 1) != 1) return false;
+    style.textDecoration = static_cast<CssTextDecoration>(enumVal);
+    style.defined.textDecoration = 1;
+  }
+
+  auto readDefinedLength = [this, definedBits](const uint16_t bit, CssLength& length) {
+    return (definedBits & bit) == 0 || readLength(in, length);
+  };
+  if (!readDefinedLength(TEXT_INDENT, style.textIndent) || !readDefinedLength(MARGIN_TOP, style.marginTop) ||
+      !readDefinedLength(MARGIN_BOTTOM, style.marginBottom) || !readDefinedLength(MARGIN_LEFT, style.marginLeft) ||
+      !readDefinedLength(MARGIN_RIGHT, style.marginRight) || !readDefinedLength(PADDING_TOP, style.paddingTop) ||
+      !readDefinedLength(PADDING_BOTTOM, style.paddingBottom) ||
+      !readDefinedLength(PADDING_LEFT, style.paddingLeft) || !readDefinedLength(PADDING_RIGHT, style.paddingRight) ||
+      !readDefinedLength(IMAGE_HEIGHT, style.imageHeight) || !readDefinedLength(IMAGE_WIDTH, style.imageWidth)) {
+    return false;
+  }
+  style.defined.textIndent = (definedBits & TEXT_INDENT) != 0;
+  style.defined.marginTop = (definedBits & MARGIN_TOP) != 0;
+  style.defined.marginBottom = (definedBits & MARGIN_BOTTOM) != 0;
+  style.defined.marginLeft = (definedBits & MARGIN_LEFT) != 0;
+  style.defined.marginRight = (definedBits & MARGIN_RIGHT) != 0;
+  style.defined.paddingTop = (definedBits & PADDING_TOP) != 0;
+  style.defined.paddingBottom = (definedBits & PADDING_BOTTOM) != 0;
+  style.defined.paddingLeft = (definedBits & PADDING_LEFT) != 0;
+  style.defined.paddingRight = (definedBits & PADDING_RIGHT) != 0;
+  style.defined.imageHeight = (definedBits & IMAGE_HEIGHT) != 0;
+  style.defined.imageWidth = (definedBits & IMAGE_WIDTH) != 0;
+  return true;
+}
+
+bool ParsedContentReader::readShortString(std::string& s) {
+  uint8_t len;
+  if (in.read(&len, 1) != 1) {
+    return false;
+  }
+  s.resize(len);
+  return len == 0 || in.read(&s[0], len) == len;
+}
+
+bool ParsedContentReader::readHeader(const bool embeddedStyle) {
+  uint8_t version;
+  bool fileEmbeddedStyle;
+  if (in.read(&version, 1) != 1 || version != PARSED_CONTENT_VERSION) {
+    LOG_DBG("PCT", "Unknown parsed content version %u", version);
+    return false;
+  }
+  if (in.read(&fileEmbeddedStyle, 1) != 1 || fileEmbeddedStyle != embeddedStyle) {
+    LOG_DBG("PCT", "Parsed content built with different embedded style setting");
+    return false;
+  }
+  return true;
+}
+
+bool ParsedContentReader::next(ParsedContentRecord& record) {
+  uint8_t tag;
+  if (in.read(&tag, 1) != 1) {
+    LOG_ERR("PCT", "Unexpected end of parsed content");
+    return false;
+  }
+  record.tag = static_cast<ParsedContentTag>(tag);
+
+  switch (record.tag) {
+    case ParsedContentTag::Word: {
+      uint8_t flags;
+      if (in.read(&flags, 1) != 1) return false;
+      record.style = static_cast<EpdFontFamily::Style>(flags & WORD_STYLE_MASK);
+      record.continues = (flags & WORD_CONTINUES_FLAG) != 0;
+      return readShortString(record.text);
+    }
+    case ParsedContentTag::Block: {
+      uint8_t kind;
+      if (in.read(&kind, 1) != 1) return false;
+      record.blockKind = static_cast<ParsedBlockKind>(kind);
+      return readCssStyle(record.cssStyle);
+    }
+    case ParsedContentTag::Image: {
+      uint32_t len;
+      if (in.read(&len, sizeof(len)) != sizeof(len) || len > MAX_IMAGE_PATH_LENGTH) return false;
+      record.text.resize(len);
+      if (in.read(&record.text[0], len) != static_cast<int>(len)) return false;
+      if (in.read(&record.width, sizeof(record.width)) != sizeof(record.width) ||
+          in.read(&record.height, sizeof(record.height)) != sizeof(record.height)) {
+        return false;
+      }
+      return readCssStyle(record.cssStyle);
+    }
+    case ParsedContentTag::Footnote:
+      return readShortString(record.text) && readShortString(record.href);
+    case ParsedContentTag::Anchor:
+      return in.read(&record.anchorHash, sizeof(record.anchorHash)) == sizeof(record.anchorHash);
+    case ParsedContentTag::ResetBlockAlignment:
+    case ParsedContentTag::End:
+      return true;
+  }
+
+  LOG_ERR("PCT", "Unknown parsed content tag %u", tag);
+  return false;
+}
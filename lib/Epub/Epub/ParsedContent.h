@@ -0,0 +1,89 @@
+#pragma once
+#include <EpdFontFamily.h>
+#include <BufferedFile.h>
+
+#include <cstdint>
+#include <string>
+
+#include "css/CssStyle.h"
+
+/**
+ * Parsed content stream - the layout-independent output of ChapterHtmlSlimParser.
+ *
+ * A spine item is parsed (inflate + expat + CSS cascade) once and written as a compact stream of records:
+ * styled words, block starts carrying their unresolved CSS, image references and footnote links. Lengths stay
+ * in their CSS units so the same stream can be laid out for any font, spacing, margin or orientation setting.
+ * PageLayoutBuilder replays the stream to produce pages.
+ */
+enum class ParsedContentTag : uint8_t {
+  Word = 1,
+  Block = 2,
+  ResetBlockAlignment = 3,  // closing a header/block element; resets alignment if the current block is still empty
+  Image = 4,
+  Footnote = 5,
+  Anchor = 6,  // element id; resolved to the page holding the content that follows it
+  End = 0xFF,
+};
+
+// How the layout stage should derive a BlockStyle for a new block
+enum class ParsedBlockKind : uint8_t {
+  Default = 0,    // user paragraph alignment, no CSS (chapter start, table cells)
+  Centered = 1,   // centered, no CSS (image alt text)
+  Header = 2,     // h1-h6: CSS with centered default alignment
+  Paragraph = 3,  // p, div, li, blockquote: CSS with user paragraph alignment
+  LineBreak = 4,  // br: repeat the current block's style
+};
+
+struct ParsedContentRecord {
+  ParsedContentTag tag = ParsedContentTag::End;
+  // Word
+  EpdFontFamily::Style style = EpdFontFamily::REGULAR;
+  bool continues = false;
+  // Word text, image path or footnote number
+  std::string text;
+  // Footnote href
+  std::string href;
+  // Block / Image
+  ParsedBlockKind blockKind = ParsedBlockKind::Default;
+  CssStyle cssStyle;
+  int16_t width = 0;
+  int16_t height = 0;
+  // Anchor
+  uint32_t anchorHash = 0;
+};
+
+// Hash of an element id (the fragment part of an href). Section anchor tables store these instead of the ids.
+uint32_t hashAnchorId(const char* id, size_t length);
+
+class ParsedContentWriter {
+  BufferedWriter& out;
+
+  void writeCssStyle(const CssStyle& style);
+
+ public:
+  explicit ParsedContentWriter(BufferedWriter& out) : out(out) {}
+
+  void writeHeader(bool embeddedStyle);
+  void addWord(const char* word, uint8_t length, EpdFontFamily::Style style, bool continues);
+  void startBlock(ParsedBlockKind kind, const CssStyle& cssStyle = CssStyle());
+  void resetBlockAlignment();
+  void addImage(const std::string& path, int16_t width, int16_t height, const CssStyle& cssStyle);
+  void addFootnote(const char* number, const char* href);
+  void addAnchor(const char* id);
+  void end();
+};
+
+class ParsedContentReader {
+  BufferedReader& in;
+
+  bool readCssStyle(CssStyle& style);
+  bool readShortString(std::string& s);
+
+ public:
+  explicit ParsedContentReader(BufferedReader& in) : in(in) {}
+
+  // Returns false if the header is missing, has an unknown version or was built with a different embeddedStyle
+  bool readHeader(bool embeddedStyle);
+  // Read the next record. Returns false on a truncated or corrupt stream; the End record ends a valid stream.
+  bool next(ParsedContentRecord& record);
+};
@@ -1,19 +1,31 @@
 #include "Section.h"
 
 #include <HalStorage.h>
+#include <HeapTags.h>
 #include <Logging.h>
 #include <Serialization.h>
 
+#include <algorithm>
+
 #include "Epub/css/CssParser.h"
 #include "Page.h"
+#include "PageLayoutBuilder.h"
+#include "ParsedContent.h"
 #include "hyphenation/Hyphenator.h"
 #include "parsers/ChapterHtmlSlimParser.h"
 
 namespace {
-constexpr uint8_t SECTION_FILE_VERSION = 14;
+// Minimum parsed content size (in bytes) to show the indexing popup for a layout-only rebuild
+constexpr size_t MIN_PARSED_CONTENT_SIZE_FOR_POPUP = 10 * 1024;  // 10KB
+constexpr uint8_t SECTION_FILE_VERSION = 15;
 constexpr uint32_t HEADER_SIZE = sizeof(uint8_t) + sizeof(int) + sizeof(float) + sizeof(bool) + sizeof(uint8_t) +
                                  sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(bool) + sizeof(bool) +
-                                 sizeof(uint32_t);
+                                 sizeof(uint32_t) + sizeof(uint32_t);
+// The header ends with pageCount, lutOffset and anchorTableOffset, which are filled in once pages are written
+constexpr uint32_t ANCHOR_TABLE_OFFSET_POSITION = HEADER_SIZE - sizeof(uint32_t);
+constexpr uint32_t LUT_OFFSET_POSITION = ANCHOR_TABLE_OFFSET_POSITION - sizeof(uint32_t);
+constexpr uint32_t PAGE_COUNT_POSITION = LUT_OFFSET_POSITION - sizeof(uint16_t);
+constexpr uint32_t ANCHOR_ENTRY_SIZE = sizeof(uint32_t) + sizeof(uint16_t);
 }  // namespace
 
 uint32_t Section::onPageComplete(std::unique_ptr<Page> page) {
@@ -22,8 +34,9 @@ uint32_t Section::onPageComplete(std::unique_ptr<Page> page) {
     return 0;
   }
 
-  const uint32_t position = file.position();
-  if (!page->serialize(file)) {
+  BufferedWriter writer(file);
+  const uint32_t position = writer.position();
+  if (!page->serialize(writer) || !writer.flush()) {
     LOG_ERR("SCT", "Failed to serialize page %d", pageCount);
     return 0;
   }
@@ -44,7 +57,7 @@ void Section::writeSectionFileHeader(const int fontId, const float lineCompressi
   static_assert(HEADER_SIZE == sizeof(SECTION_FILE_VERSION) + sizeof(fontId) + sizeof(lineCompression) +
                                    sizeof(extraParagraphSpacing) + sizeof(paragraphAlignment) + sizeof(viewportWidth) +
                                    sizeof(viewportHeight) + sizeof(pageCount) + sizeof(hyphenationEnabled) +
-                                   sizeof(embeddedStyle) + sizeof(uint32_t),
+                                   sizeof(embeddedStyle) + sizeof(uint32_t) + sizeof(uint32_t),
                 "Header size mismatch");
   serialization::writePod(file, SECTION_FILE_VERSION);
   serialization::writePod(file, fontId);
@@ -57,6 +70,7 @@ void Section::writeSectionFileHeader(const int fontId, const float lineCompressi
   serialization::writePod(file, embeddedStyle);
   serialization::writePod(file, pageCount);  // Placeholder for page count (will be initially 0 when written)
   serialization::writePod(file, static_cast<uint32_t>(0));  // Placeholder for LUT offset
+  serialization::writePod(file, static_cast<uint32_t>(0));  // Placeholder for anchor table offset
 }
 
 bool Section::loadSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
@@ -126,19 +140,22 @@ bool Section::clearCache() const {
   return true;
 }
 
-bool Section::createSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
-                                const uint8_t paragraphAlignment, const uint16_t viewportWidth,
-                                const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle,
-                                const std::function<void()>& popupFn) {
+bool Section::hasParsedContent(const bool embeddedStyle) const {
+  FsFile contentFile;
+  if (!Storage.exists(parsedContentPath.c_str()) || !Storage.openFileForRead("SCT", parsedContentPath, contentFile)) {
+    return false;
+  }
+  BufferedReader in(contentFile);
+  ParsedContentReader reader(in);
+  const bool valid = reader.readHeader(embeddedStyle);
+  contentFile.close();
+  return valid;
+}
+
+bool Section::buildParsedContent(const bool embeddedStyle, const std::function<void()>& popupFn) {
   const auto localPath = epub->getSpineItem(spineIndex).href;
   const auto tmpHtmlPath = epub->getCachePath() + "/.tmp_" + std::to_string(spineIndex) + ".html";
 
-  // Create cache directory if it doesn't exist
-  {
-    const auto sectionsDir = epub->getCachePath() + "/sections";
-    Storage.mkdir(sectionsDir.c_str());
-  }
-
   // Retry logic for SD card timing issues
   bool success = false;
   uint32_t fileSize = 0;
@@ -175,12 +192,17 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
 
   LOG_DBG("SCT", "Streamed temp HTML to %s (%d bytes)", tmpHtmlPath.c_str(), fileSize);
 
-  if (!Storage.openFileForWrite("SCT", filePath, file)) {
+  // Written beside the cached parse and renamed over it once complete, so a power cut mid-parse can't leave a file
+  // that passes the header check but ends early
+  const std::string tmpContentPath = parsedContentPath + ".tmp";
+  FsFile contentFile;
+  if (!Storage.openFileForWrite("SCT", tmpContentPath, contentFile)) {
+    Storage.remove(tmpHtmlPath.c_str());
     return false;
   }
-  writeSectionFileHeader(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
-                         viewportHeight, hyphenationEnabled, embeddedStyle);
-  std::vector<uint32_t> lut = {};
+  BufferedWriter out(contentFile);
+  ParsedContentWriter writer(out);
+  writer.writeHeader(embeddedStyle);
 
   // Derive the content base directory and image cache path prefix for the parser
   size_t lastSlash = localPath.find_last_of('/');
@@ -197,22 +219,97 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
     }
   }
 
-  ChapterHtmlSlimParser visitor(
-      epub, tmpHtmlPath, renderer, fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
-      viewportHeight, hyphenationEnabled,
-      [this, &lut](std::unique_ptr<Page> page) { lut.emplace_back(this->onPageComplete(std::move(page))); },
-      embeddedStyle, contentBase, imageBasePath, popupFn, cssParser);
-  Hyphenator::setPreferredLanguage(epub->getLanguage());
-  success = visitor.parseAndBuildPages();
+  ChapterHtmlSlimParser visitor(epub, tmpHtmlPath, writer, embeddedStyle, contentBase, imageBasePath, popupFn,
+                                cssParser);
+  success = visitor.parse();
+  // Flush before closing even on failure, so the writer has nothing left to write to the closed file
+  success = out.flush() && success;
+  contentFile.close();
 
   Storage.remove(tmpHtmlPath.c_str());
+  if (cssParser) {
+    cssParser->clear();
+  }
+  if (!success) {
+    LOG_ERR("SCT", "Failed to parse XML");
+    Storage.remove(tmpContentPath.c_str());
+    return false;
+  }
+  if (Storage.exists(parsedContentPath.c_str())) {
+    Storage.remove(parsedContentPath.c_str());
+  }
+  if (!Storage.rename(tmpContentPath.c_str(), parsedContentPath.c_str())) {
+    LOG_ERR("SCT", "Failed to move parsed content into place");
+    Storage.remove(tmpContentPath.c_str());
+    return false;
+  }
+  return true;
+}
+
+bool Section::prepareParsedContent(const bool embeddedStyle) {
+  HeapTagScope heapScope(HeapTag::SectionBuild);
+  if (hasParsedContent(embeddedStyle)) {
+    return true;
+  }
+  Storage.mkdir((epub->getCachePath() + "/sections").c_str());
+  return buildParsedContent(embeddedStyle, nullptr);
+}
+
+bool Section::createSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
+                                const uint8_t paragraphAlignment, const uint16_t viewportWidth,
+                                const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle,
+                                const std::function<void()>& popupFn) {
+  HeapTagScope heapScope(HeapTag::SectionBuild);
+
+  // Create cache directory if it doesn't exist
+  {
+    const auto sectionsDir = epub->getCachePath() + "/sections";
+    Storage.mkdir(sectionsDir.c_str());
+  }
+
+  // Only show the popup once, whichever stage decides the work is large enough to warrant it
+  bool popupShown = false;
+  const std::function<void()> showPopup = [&popupFn, &popupShown]() {
+    if (popupFn && !popupShown) {
+      popupShown = true;
+      popupFn();
+    }
+  };
+
+  // Parsing is independent of layout settings, so it only runs once per spine item (and embedded style setting)
+  if (hasParsedContent(embeddedStyle)) {
+    LOG_DBG("SCT", "Parsed content found, skipping XHTML parse");
+    FsFile contentFile;
+    if (Storage.openFileForRead("SCT", parsedContentPath, contentFile)) {
+      if (contentFile.size() >= MIN_PARSED_CONTENT_SIZE_FOR_POPUP) {
+        showPopup();
+      }
+      contentFile.close();
+    }
+  } else if (!buildParsedContent(embeddedStyle, showPopup)) {
+    return false;
+  }
+
+  if (!Storage.openFileForWrite("SCT", filePath, file)) {
+    return false;
+  }
+  writeSectionFileHeader(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
+                         viewportHeight, hyphenationEnabled, embeddedStyle);
+  std::vector<uint32_t> lut = {};
+
+  PageLayoutBuilder builder(
+      renderer, fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth, viewportHeight,
+      hyphenationEnabled, embeddedStyle,
+      [this, &lut](std::unique_ptr<Page> page) { lut.emplace_back(this->onPageComplete(std::move(page))); });
+  Hyphenator::setPreferredLanguage(epub->getLanguage());
+  const bool success = builder.buildPages(parsedContentPath);
+
   if (!success) {
-    LOG_ERR("SCT", "Failed to parse XML and build pages");
+    LOG_ERR("SCT", "Failed to build pages from parsed content");
     file.close();
     Storage.remove(filePath.c_str());
-    if (cssParser) {
-      cssParser->clear();
-    }
+    // Drop the parsed content as well so the next attempt re-parses from the EPUB
+    Storage.remove(parsedContentPath.c_str());
     return false;
   }
 
@@ -234,14 +331,25 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
     return false;
   }
 
-  // Go back and write LUT offset
-  file.seek(HEADER_SIZE - sizeof(uint32_t) - sizeof(pageCount));
+  // Write anchor table, sorted by hash so lookups are a binary search. The sort is stable, so duplicate ids (or hash
+  // collisions) resolve to the first occurrence in the chapter.
+  auto& anchors = builder.getAnchors();
+  std::stable_sort(anchors.begin(), anchors.end(),
+                   [](const AnchorEntry& a, const AnchorEntry& b) { return a.hash < b.hash; });
+  const uint32_t anchorTableOffset = file.position();
+  const uint16_t anchorCount = static_cast<uint16_t>(std::min<size_t>(anchors.size(), UINT16_MAX));
+  serialization::writePod(file, anchorCount);
+  for (uint16_t i = 0; i < anchorCount; i++) {
+    serialization::writePod(file, anchors[i].hash);
+    serialization::writePod(file, anchors[i].page);
+  }
+
+  // Go back and write LUT and anchor table offsets
+  file.seek(PAGE_COUNT_POSITION);
   serialization::writePod(file, pageCount);
   serialization::writePod(file, lutOffset);
+  serialization::writePod(file, anchorTableOffset);
   file.close();
-  if (cssParser) {
-    cssParser->clear();
-  }
   return true;
 }
 
@@ -250,7 +358,7 @@ std::unique_ptr<Page> Section::loadPageFromSectionFile() {
     return nullptr;
   }
 
-  file.seek(HEADER_SIZE - sizeof(uint32_t));
+  file.seek(LUT_OFFSET_POSITION);
   uint32_t lutOffset;
   serialization::readPod(file, lutOffset);
   file.seek(lutOffset + sizeof(uint32_t) * currentPage);
@@ -258,7 +366,60 @@ std::unique_ptr<Page> Section::loadPageFromSectionFile() {
   serialization::readPod(file, pagePos);
   file.seek(pagePos);
 
-  auto page = Page::deserialize(file);
+  BufferedReader reader(file);
+  auto page = Page::deserialize(reader);
   file.close();
   return page;
 }
+
+int Section::findPageForAnchor(const std::string& anchor) const {
+  if (anchor.empty()) {
+    return -1;
+  }
+
+  FsFile sectionFile;
+  if (!Storage.openFileForRead("SCT", filePath, sectionFile)) {
+    return -1;
+  }
+
+  uint32_t anchorTableOffset;
+  uint16_t anchorCount;
+  sectionFile.seek(ANCHOR_TABLE_OFFSET_POSITION);
+  serialization::readPod(sectionFile, anchorTableOffset);
+  sectionFile.seek(anchorTableOffset);
+  serialization::readPod(sectionFile, anchorCount);
+
+  const uint32_t hash = hashAnchorId(anchor.c_str(), anchor.size());
+  const uint32_t entriesOffset = anchorTableOffset + sizeof(anchorCount);
+
+  // Lower bound over the sorted hashes, so the first entry for a hash wins
+  uint16_t low = 0;
+  uint16_t high = anchorCount;
+  while (low < high) {
+    const uint16_t mid = low + (high - low) / 2;
+    uint32_t midHash;
+    sectionFile.seek(entriesOffset + mid * ANCHOR_ENTRY_SIZE);
+    serialization::readPod(sectionFile, midHash);
+    if (midHash < hash) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+
+  int page = -1;
+  if (low < anchorCount) {
+    uint32_t entryHash;
+    uint16_t entryPage;
+    sectionFile.seek(entriesOffset + low * ANCHOR_ENTRY_SIZE);
+    serialization::readPod(sectionFile, entryHash);
+    serialization::readPod(sectionFile, entryPage);
+    if (entryHash == hash) {
+      page = entryPage;
+    }
+  }
+  sectionFile.close();
+
+  LOG_DBG("SCT", "Anchor #%s -> page %d (%u anchors)", anchor.c_str(), page, anchorCount);
+  return page;
+}
@@ -12,12 +12,16 @@ class Section {
   const int spineIndex;
   GfxRenderer& renderer;
   std::string filePath;
+  // Layout-independent parse of the spine item, shared by every layout variant of this section
+  std::string parsedContentPath;
   FsFile file;
 
   void writeSectionFileHeader(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                               uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled,
                               bool embeddedStyle);
   uint32_t onPageComplete(std::unique_ptr<Page> page);
+  bool hasParsedContent(bool embeddedStyle) const;
+  bool buildParsedContent(bool embeddedStyle, const std::function<void()>& popupFn);
 
  public:
   uint16_t pageCount = 0;
@@ -27,13 +31,19 @@ class Section {
       : epub(epub),
         spineIndex(spineIndex),
         renderer(renderer),
-        filePath(epub->getCachePath() + "/sections/" + std::to_string(spineIndex) + ".bin") {}
+        filePath(epub->getCachePath() + "/sections/" + std::to_string(spineIndex) + ".bin"),
+        parsedContentPath(epub->getCachePath() + "/sections/" + std::to_string(spineIndex) + ".parsed.bin") {}
   ~Section() = default;
   bool loadSectionFile(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                        uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled, bool embeddedStyle);
   bool clearCache() const;
+  // Builds the layout-independent parse of the spine item unless it is cached, so a later createSectionFile() only
+  // has to paginate. Needs no layout settings, which lets it run before the book is opened.
+  bool prepareParsedContent(bool embeddedStyle);
   bool createSectionFile(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                          uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled, bool embeddedStyle,
                          const std::function<void()>& popupFn = nullptr);
   std::unique_ptr<Page> loadPageFromSectionFile();
+  // Page holding the element with the given id (href fragment without '#'), or -1 if it is not in this section
+  int findPageForAnchor(const std::string& anchor) const;
 };
@@ -156,18 +156,18 @@ void ImageBlock::render(GfxRenderer& renderer, const int x, const int y) {
   LOG_DBG("IMG", "Decode successful");
 }
 
-bool ImageBlock::serialize(FsFile& file) {
-  serialization::writeString(file, imagePath);
-  serialization::writePod(file, width);
-  serialization::writePod(file, height);
+bool ImageBlock::serialize(BufferedWriter& writer) {
+  serialization::writeString(writer, imagePath);
+  serialization::writePod(writer, width);
+  serialization::writePod(writer, height);
   return true;
 }
 
-std::unique_ptr<ImageBlock> ImageBlock::deserialize(FsFile& file) {
+std::unique_ptr<ImageBlock> ImageBlock::deserialize(BufferedReader& reader) {
   std::string path;
-  serialization::readString(file, path);
+  serialization::readString(reader, path);
   int16_t w, h;
-  serialization::readPod(file, w);
-  serialization::readPod(file, h);
+  serialization::readPod(reader, w);
+  serialization::readPod(reader, h);
   return std::unique_ptr<ImageBlock>(new ImageBlock(path, w, h));
 }
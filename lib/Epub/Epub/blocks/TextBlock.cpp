@@ -41,7 +41,7 @@ void TextBlock::render(const GfxRenderer& renderer, const int fontId, const int
   }
 }
 
-bool TextBlock::serialize(FsFile& file) const {
+bool TextBlock::serialize(BufferedWriter& writer) const {
   if (words.size() != wordXpos.size() || words.size() != wordStyles.size()) {
     LOG_ERR("TXB", "Serialization failed: size mismatch (words=%u, xpos=%u, styles=%u)\n", words.size(),
             wordXpos.size(), wordStyles.size());
@@ -49,29 +49,29 @@ bool TextBlock::serialize(FsFile& file) const {
   }
 
   // Word data
-  serialization::writePod(file, static_cast<uint16_t>(words.size()));
-  for (const auto& w : words) serialization::writeString(file, w);
-  for (auto x : wordXpos) serialization::writePod(file, x);
-  for (auto s : wordStyles) serialization::writePod(file, s);
+  serialization::writePod(writer, static_cast<uint16_t>(words.size()));
+  for (const auto& w : words) serialization::writeString(writer, w);
+  for (auto x : wordXpos) serialization::writePod(writer, x);
+  for (auto s : wordStyles) serialization::writePod(writer, s);
 
   // Style (alignment + margins/padding/indent)
-  serialization::writePod(file, blockStyle.alignment);
-  serialization::writePod(file, blockStyle.textAlignDefined);
-  serialization::writePod(file, blockStyle.marginTop);
-  serialization::writePod(file, blockStyle.marginBottom);
-  serialization::writePod(file, blockStyle.marginLeft);
-  serialization::writePod(file, blockStyle.marginRight);
-  serialization::writePod(file, blockStyle.paddingTop);
-  serialization::writePod(file, blockStyle.paddingBottom);
-  serialization::writePod(file, blockStyle.paddingLeft);
-  serialization::writePod(file, blockStyle.paddingRight);
-  serialization::writePod(file, blockStyle.textIndent);
-  serialization::writePod(file, blockStyle.textIndentDefined);
+  serialization::writePod(writer, blockStyle.alignment);
+  serialization::writePod(writer, blockStyle.textAlignDefined);
+  serialization::writePod(writer, blockStyle.marginTop);
+  serialization::writePod(writer, blockStyle.marginBottom);
+  serialization::writePod(writer, blockStyle.marginLeft);
+  serialization::writePod(writer, blockStyle.marginRight);
+  serialization::writePod(writer, blockStyle.paddingTop);
+  serialization::writePod(writer, blockStyle.paddingBottom);
+  serialization::writePod(writer, blockStyle.paddingLeft);
+  serialization::writePod(writer, blockStyle.paddingRight);
+  serialization::writePod(writer, blockStyle.textIndent);
+  serialization::writePod(writer, blockStyle.textIndentDefined);
 
   return true;
 }
 
-std::unique_ptr<TextBlock> TextBlock::deserialize(FsFile& file) {
+std::unique_ptr<TextBlock> TextBlock::deserialize(BufferedReader& reader) {
   uint16_t wc;
   std::vector<std::string> words;
   std::vector<uint16_t> wordXpos;
@@ -79,7 +79,7 @@ std::unique_ptr<TextBlock> TextBlock::deserialize(FsFile& file) {
   BlockStyle blockStyle;
 
   // Word count
-  serialization::readPod(file, wc);
+  serialization::readPod(reader, wc);
 
   // Sanity check: prevent allocation of unreasonably large vectors (max 10000 words per block)
   if (wc > 10000) {
@@ -91,23 +91,23 @@ std::unique_ptr<TextBlock> TextBlock::deserialize(FsFile& file) {
   words.resize(wc);
   wordXpos.resize(wc);
   wordStyles.resize(wc);
-  for (auto& w : words) serialization::readString(file, w);
-  for (auto& x : wordXpos) serialization::readPod(file, x);
-  for (auto& s : wordStyles) serialization::readPod(file, s);
+  for (auto& w : words) serialization::readString(reader, w);
+  for (auto& x : wordXpos) serialization::readPod(reader, x);
+  for (auto& s : wordStyles) serialization::readPod(reader, s);
 
   // Style (alignment + margins/padding/indent)
-  serialization::readPod(file, blockStyle.alignment);
-  serialization::readPod(file, blockStyle.textAlignDefined);
-  serialization::readPod(file, blockStyle.marginTop);
-  serialization::readPod(file, blockStyle.marginBottom);
-  serialization::readPod(file, blockStyle.marginLeft);
-  serialization::readPod(file, blockStyle.marginRight);
-  serialization::readPod(file, blockStyle.paddingTop);
-  serialization::readPod(file, blockStyle.paddingBottom);
-  serialization::readPod(file, blockStyle.paddingLeft);
-  serialization::readPod(file, blockStyle.paddingRight);
-  serialization::readPod(file, blockStyle.textIndent);
-  serialization::readPod(file, blockStyle.textIndentDefined);
+  serialization::readPod(reader, blockStyle.alignment);
+  serialization::readPod(reader, blockStyle.textAlignDefined);
+  serialization::readPod(reader, blockStyle.marginTop);
+  serialization::readPod(reader, blockStyle.marginBottom);
+  serialization::readPod(reader, blockStyle.marginLeft);
+  serialization::readPod(reader, blockStyle.marginRight);
+  serialization::readPod(reader, blockStyle.paddingTop);
+  serialization::readPod(reader, blockStyle.paddingBottom);
+  serialization::readPod(reader, blockStyle.paddingLeft);
+  serialization::readPod(reader, blockStyle.paddingRight);
+  serialization::readPod(reader, blockStyle.textIndent);
+  serialization::readPod(reader, blockStyle.textIndentDefined);
 
   return std::unique_ptr<TextBlock>(
       new TextBlock(std::move(words), std::move(wordXpos), std::move(wordStyles), blockStyle));
@@ -1,6 +1,6 @@
 #pragma once
 #include <EpdFontFamily.h>
-#include <HalStorage.h>
+#include <BufferedFile.h>
 
 #include <memory>
 #include <string>
@@ -33,6 +33,6 @@ class TextBlock final : public Block {
   // given a renderer works out where to break the words into lines
   void render(const GfxRenderer& renderer, int fontId, int x, int y) const;
   BlockType getType() override { return TEXT_BLOCK; }
-  bool serialize(FsFile& file) const;
-  static std::unique_ptr<TextBlock> deserialize(FsFile& file);
+  bool serialize(BufferedWriter& writer) const;
+  static std::unique_ptr<TextBlock> deserialize(BufferedReader& reader);
 };
@@ -2,6 +2,7 @@
 
 #include <GfxRenderer.h>
 #include <HalStorage.h>
+#include <HeapTags.h>
 #include <Logging.h>
 #include <picojpeg.h>
 
@@ -45,6 +46,7 @@ bool JpegToFramebufferConverter::getDimensionsStatic(const std::string& imagePat
 
 bool JpegToFramebufferConverter::decodeToFramebuffer(const std::string& imagePath, GfxRenderer& renderer,
                                                      const RenderConfig& config) {
+  HeapTagScope heapScope(HeapTag::ImageDecode);
   LOG_DBG("JPG", "Decoding JPEG: %s", imagePath.c_str());
 
   FsFile file;
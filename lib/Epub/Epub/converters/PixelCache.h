@@ -1,6 +1,7 @@
 #pragma once
 
 #include <HalStorage.h>
+#include <HeapTags.h>
 #include <Logging.h>
 #include <stdint.h>
 
@@ -34,7 +35,7 @@ struct PixelCache {
       LOG_ERR("IMG", "Cache buffer too large: %d bytes for %dx%d (limit %d)", bufferSize, w, h, MAX_CACHE_BYTES);
       return false;
     }
-    buffer = (uint8_t*)malloc(bufferSize);
+    buffer = static_cast<uint8_t*>(HeapTags::allocate(bufferSize, HeapTag::ImageDecode));
     if (buffer) {
       memset(buffer, 0, bufferSize);
       LOG_DBG("IMG", "Allocated cache buffer: %d bytes for %dx%d", bufferSize, w, h);
@@ -75,7 +76,7 @@ struct PixelCache {
 
   ~PixelCache() {
     if (buffer) {
-      free(buffer);
+      HeapTags::release(buffer);
       buffer = nullptr;
     }
   }
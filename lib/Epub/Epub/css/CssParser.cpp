@@ -1,6 +1,7 @@
 #include "CssParser.h"
 
 #include <Arduino.h>
+#include <BufferedFile.h>
 #include <Logging.h>
 
 #include <algorithm>
@@ -653,32 +654,33 @@ bool CssParser::saveToCache() const {
   if (!Storage.openFileForWrite("CSS", cachePath + rulesCache, file)) {
     return false;
   }
+  BufferedWriter out(file);
 
   // Write version
-  file.write(CssParser::CSS_CACHE_VERSION);
+  out.write(CssParser::CSS_CACHE_VERSION);
 
   // Write rule count
   const auto ruleCount = static_cast<uint16_t>(rulesBySelector_.size());
-  file.write(reinterpret_cast<const uint8_t*>(&ruleCount), sizeof(ruleCount));
+  out.write(reinterpret_cast<const uint8_t*>(&ruleCount), sizeof(ruleCount));
 
   // Write each rule: selector string + CssStyle fields
   for (const auto& pair : rulesBySelector_) {
     // Write selector string (length-prefixed)
     const auto selectorLen = static_cast<uint16_t>(pair.first.size());
-    file.write(reinterpret_cast<const uint8_t*>(&selectorLen), sizeof(selectorLen));
-    file.write(reinterpret_cast<const uint8_t*>(pair.first.data()), selectorLen);
+    out.write(reinterpret_cast<const uint8_t*>(&selectorLen), sizeof(selectorLen));
+    out.write(reinterpret_cast<const uint8_t*>(pair.first.data()), selectorLen);
 
     // Write CssStyle fields (all are POD types)
     const CssStyle& style = pair.second;
-    file.write(static_cast<uint8_t>(style.textAlign));
-    file.write(static_cast<uint8_t>(style.fontStyle));
-    file.write(static_cast<uint8_t>(style.fontWeight));
-    file.write(static_cast<uint8_t>(style.textDecoration));
+    out.write(static_cast<uint8_t>(style.textAlign));
+    out.write(static_cast<uint8_t>(style.fontStyle));
+    out.write(static_cast<uint8_t>(style.fontWeight));
+    out.write(static_cast<uint8_t>(style.textDecoration));
 
     // Write CssLength fields (value + unit)
-    auto writeLength = [&file](const CssLength& len) {
-      file.write(reinterpret_cast<const uint8_t*>(&len.value), sizeof(len.value));
-      file.write(static_cast<uint8_t>(len.unit));
+    auto writeLength = [&out](const CssLength& len) {
+      out.write(reinterpret_cast<const uint8_t*>(&len.value), sizeof(len.value));
+      out.write(static_cast<uint8_t>(len.unit));
     };
 
     writeLength(style.textIndent);
@@ -710,11 +712,16 @@ bool CssParser::saveToCache() const {
     if (style.defined.paddingRight) definedBits |= 1 << 12;
     if (style.defined.imageHeight) definedBits |= 1 << 13;
     if (style.defined.imageWidth) definedBits |= 1 << 14;
-    file.write(reinterpret_cast<const uint8_t*>(&definedBits), sizeof(definedBits));
+    out.write(reinterpret_cast<const uint8_t*>(&definedBits), sizeof(definedBits));
   }
 
-  LOG_DBG("CSS", "Saved %u rules to cache", ruleCount);
+  const bool written = out.flush();
   file.close();
+  if (!written) {
+    LOG_ERR("CSS", "Failed to write rules cache");
+    return false;
+  }
+  LOG_DBG("CSS", "Saved %u rules to cache", ruleCount);
   return true;
 }
 
@@ -728,12 +735,14 @@ bool CssParser::loadFromCache() {
     return false;
   }
 
+  BufferedReader in(file);
+
   // Clear existing rules
   clear();
 
   // Read and verify version
   uint8_t version = 0;
-  if (file.read(&version, 1) != 1 || version != CssParser::CSS_CACHE_VERSION) {
+  if (in.read(&version, 1) != 1 || version != CssParser::CSS_CACHE_VERSION) {
     LOG_DBG("CSS", "Cache version mismatch (got %u, expected %u), removing stale cache for rebuild", version,
             CssParser::CSS_CACHE_VERSION);
     file.close();
@@ -743,7 +752,7 @@ bool CssParser::loadFromCache() {
 
   // Read rule count
   uint16_t ruleCount = 0;
-  if (file.read(&ruleCount, sizeof(ruleCount)) != sizeof(ruleCount)) {
+  if (in.read(&ruleCount, sizeof(ruleCount)) != sizeof(ruleCount)) {
     file.close();
     return false;
   }
@@ -752,7 +761,7 @@ bool CssParser::loadFromCache() {
   for (uint16_t i = 0; i < ruleCount; ++i) {
     // Read selector string
     uint16_t selectorLen = 0;
-    if (file.read(&selectorLen, sizeof(selectorLen)) != sizeof(selectorLen)) {
+    if (in.read(&selectorLen, sizeof(selectorLen)) != sizeof(selectorLen)) {
       rulesBySelector_.clear();
       file.close();
       return false;
@@ -760,7 +769,7 @@ bool CssParser::loadFromCache() {
 
     std::string selector;
     selector.resize(selectorLen);
-    if (file.read(&selector[0], selectorLen) != selectorLen) {
+    if (in.read(&selector[0], selectorLen) != selectorLen) {
       rulesBySelector_.clear();
       file.close();
       return false;
@@ -770,28 +779,28 @@ bool CssParser::loadFromCache() {
     CssStyle style;
     uint8_t enumVal;
 
-    if (file.read(&enumVal, 1) != 1) {
+    if (in.read(&enumVal, 1) != 1) {
       rulesBySelector_.clear();
       file.close();
       return false;
     }
     style.textAlign = static_cast<CssTextAlign>(enumVal);
 
-    if (file.read(&enumVal, 1) != 1) {
+    if (in.read(&enumVal, 1) != 1) {
       rulesBySelector_.clear();
       file.close();
       return false;
     }
     style.fontStyle = static_cast<CssFontStyle>(enumVal);
 
-    if (file.read(&enumVal, 1) != 1) {
+    if (in.read(&enumVal, 1) != 1) {
       rulesBySelector_.clear();
       file.close();
       return false;
     }
     style.fontWeight = static_cast<CssFontWeight>(enumVal);
 
-    if (file.read(&enumVal, 1) != 1) {
+    if (in.read(&enumVal, 1) != 1) {
       rulesBySelector_.clear();
       file.close();
       return false;
@@ -799,12 +808,12 @@ bool CssParser::loadFromCache() {
     style.textDecoration = static_cast<CssTextDecoration>(enumVal);
 
     // Read CssLength fields
-    auto readLength = [&file](CssLength& len) -> bool {
-      if (file.read(&len.value, sizeof(len.value)) != sizeof(len.value)) {
+    auto readLength = [&in](CssLength& len) -> bool {
+      if (in.read(&len.value, sizeof(len.value)) != sizeof(len.value)) {
         return false;
       }
       uint8_t unitVal;
-      if (file.read(&unitVal, 1) != 1) {
+      if (in.read(&unitVal, 1) != 1) {
         return false;
       }
       len.unit = static_cast<CssUnit>(unitVal);
@@ -822,7 +831,7 @@ bool CssParser::loadFromCache() {
 
     // Read defined flags
     uint16_t definedBits = 0;
-    if (file.read(&definedBits, sizeof(definedBits)) != sizeof(definedBits)) {
+    if (in.read(&definedBits, sizeof(definedBits)) != sizeof(definedBits)) {
       rulesBySelector_.clear();
       file.close();
       return false;
@@ -26,6 +26,11 @@
  *       flash memory; no heap allocations besides the stack-local AutomatonState
  *       structs. getAutomaton caches parseAutomaton results per blob pointer so
  *       multiple words hitting the same language only pay the cost once.
+ *     - Generated headers normally carry the dense re-encoding instead
+ *       (DenseHyphenationTrie): the first two bytes of a match are looked up
+ *       in direct-indexed tables, deeper nodes have sorted labels with
+ *       absolute targets, and level data lives in its own array. scoreDense
+ *       walks it; scoreTypst remains for blobs in the original layout.
  *
  * 3.  Pattern application
  *     - We walk the augmented bytes left-to-right. For each starting byte we
@@ -309,6 +314,133 @@ bool transition(const EmbeddedAutomaton& automaton, const AutomatonState& state,
   return false;
 }
 
+// Raise the score at `splitByte` to `level` if it falls on a codepoint boundary outside the sentinels.
+void markSplit(const AugmentedWord& word, uint8_t* scores, const size_t splitByte, const uint8_t level) {
+  if (splitByte >= word.byteLen) {
+    return;
+  }
+  const int32_t boundary = word.byteToCharIndex[splitByte];
+  if (boundary < 0) {
+    return;  // Mid-codepoint byte, wait for the next one.
+  }
+  if (boundary < 2 || boundary + 2 > static_cast<int32_t>(word.charCount_)) {
+    return;  // Skip splits that land in the leading/trailing sentinels.
+  }
+  const size_t idx = static_cast<size_t>(boundary);
+  scores[idx] = std::max(scores[idx], level);
+}
+
+// Typst layout: decode every node on the way, following the relative target deltas.
+void scoreTypst(const EmbeddedAutomaton& automaton, const AugmentedWord& augmented, uint8_t* scores) {
+  const AutomatonState root = decodeState(automaton, automaton.rootOffset);
+  if (!root.valid()) {
+    return;
+  }
+
+  // Walk every starting character position and stream bytes through the trie.
+  for (size_t charStart = 0; charStart < augmented.charCount_; ++charStart) {
+    const size_t byteStart = augmented.charByteOffsets[charStart];
+    AutomatonState state = root;
+
+    for (size_t cursor = byteStart; cursor < augmented.byteLen; ++cursor) {
+      AutomatonState next;
+      if (!transition(automaton, state, augmented.bytes[cursor], next)) {
+        break;  // No more matches for this prefix.
+      }
+      state = next;
+
+      if (state.levels && state.levelsLen > 0) {
+        size_t offset = 0;
+        // Each packed byte stores the byte-distance delta and the Liang level digit.
+        for (size_t i = 0; i < state.levelsLen; ++i) {
+          const uint8_t packed = state.levels[i];
+          offset += static_cast<size_t>(packed / 10);
+          markSplit(augmented, scores, byteStart + offset, static_cast<uint8_t>(packed % 10));
+        }
+      }
+    }
+  }
+}
+
+// Dense layout record at `offset`: [count, levelsLen, levelsOffset (u16, only with levels), labels[count],
+// targets[count] (u24)]. Returns nullptr when it doesn't fit the arrays.
+const uint8_t* denseRecord(const DenseHyphenationTrie& trie, const uint32_t offset) {
+  if (offset + 2 > trie.nodesSize) {
+    return nullptr;
+  }
+  const uint8_t* record = trie.nodes + offset;
+  const size_t levelsLen = record[1];
+  const size_t header = levelsLen > 0 ? 4 : 2;
+  if (offset + header + record[0] * 4u > trie.nodesSize) {
+    return nullptr;
+  }
+  if (levelsLen > 0 && (record[2] | record[3] << 8) + levelsLen > trie.levelsSize) {
+    return nullptr;
+  }
+  return record;
+}
+
+// Apply the record's level data, whose distances count from the start of the match.
+void applyDenseLevels(const DenseHyphenationTrie& trie, const uint8_t* record, const AugmentedWord& augmented,
+                      const size_t byteStart, uint8_t* scores) {
+  const size_t levelsLen = record[1];
+  if (levelsLen == 0) {
+    return;
+  }
+  const uint8_t* levels = trie.levels + (record[2] | record[3] << 8);
+  for (size_t i = 0; i < levelsLen; ++i) {
+    markSplit(augmented, scores, byteStart + (levels[i] >> 4), levels[i] & 0x0Fu);
+  }
+}
+
+// Dense layout: the first two bytes of each match are table lookups, deeper nodes a scan of their sorted labels.
+void scoreDense(const DenseHyphenationTrie& trie, const AugmentedWord& augmented, uint8_t* scores) {
+  const size_t classCount = trie.classCount;
+  for (size_t charStart = 0; charStart < augmented.charCount_; ++charStart) {
+    const size_t byteStart = augmented.charByteOffsets[charStart];
+    const uint8_t first = trie.classes[augmented.bytes[byteStart]];
+    if (first == 0 || first >= classCount) {
+      continue;
+    }
+    const uint8_t* record = trie.dense[first] != 0 ? denseRecord(trie, trie.dense[first]) : nullptr;
+    if (!record) {
+      continue;
+    }
+    applyDenseLevels(trie, record, augmented, byteStart, scores);
+    if (byteStart + 1 >= augmented.byteLen) {
+      continue;
+    }
+    const uint8_t second = trie.classes[augmented.bytes[byteStart + 1]];
+    if (second == 0 || second >= classCount) {
+      continue;
+    }
+    uint32_t node = trie.dense[classCount + first * classCount + second];
+
+    for (size_t cursor = byteStart + 2; node != 0; ++cursor) {
+      record = denseRecord(trie, node);
+      if (!record) {
+        break;
+      }
+      applyDenseLevels(trie, record, augmented, byteStart, scores);
+      if (cursor >= augmented.byteLen) {
+        break;
+      }
+
+      const size_t count = record[0];
+      const uint8_t* labels = record + (record[1] > 0 ? 4 : 2);
+      const uint8_t letter = augmented.bytes[cursor];
+      node = 0;
+      for (size_t idx = 0; idx < count && labels[idx] <= letter; ++idx) {
+        if (labels[idx] == letter) {
+          const uint8_t* target = labels + count + idx * 3;
+          node = target[0] | target[1] << 8 | static_cast<uint32_t>(target[2]) << 16;
+          break;
+        }
+      }
+    }
+  }
+}
+
 // Converts odd score positions back into codepoint indexes, honoring min prefix/suffix constraints.
 // Each break corresponds to scores[breakIndex + 1] because of the leading '.' sentinel.
 // Convert odd score entries into hyphen positions while honoring prefix/suffix limits.
@@ -355,13 +487,6 @@ std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
     return {};
   }
 
-  const EmbeddedAutomaton& automaton = patterns;
-
-  const AutomatonState root = decodeState(automaton, automaton.rootOffset);
-  if (!root.valid()) {
-    return {};
-  }
-
   // Liang scores: one entry per augmented char (leading/trailing dots included).
   // Stack-allocated to avoid heap fragmentation (see memory design note above).
   uint8_t scores[MAX_WORD_CHARS];
@@ -369,48 +494,10 @@ std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
     scores[i] = 0;
   }
 
-  // Walk every starting character position and stream bytes through the trie.
-  for (size_t charStart = 0; charStart < augmented.charCount_; ++charStart) {
-    const size_t byteStart = augmented.charByteOffsets[charStart];
-    AutomatonState state = root;
-
-    for (size_t cursor = byteStart; cursor < augmented.byteLen; ++cursor) {
-      AutomatonState next;
-      if (!transition(automaton, state, augmented.bytes[cursor], next)) {
-        break;  // No more matches for this prefix.
-      }
-      state = next;
-
-      if (state.levels && state.levelsLen > 0) {
-        size_t offset = 0;
-        // Each packed byte stores the byte-distance delta and the Liang level digit.
-        for (size_t i = 0; i < state.levelsLen; ++i) {
-          const uint8_t packed = state.levels[i];
-          const size_t dist = static_cast<size_t>(packed / 10);
-          const uint8_t level = static_cast<uint8_t>(packed % 10);
-
-          offset += dist;
-          const size_t splitByte = byteStart + offset;
-          if (splitByte >= augmented.byteLen) {
-            continue;
-          }
-
-          const int32_t boundary = augmented.byteToCharIndex[splitByte];
-          if (boundary < 0) {
-            continue;  // Mid-codepoint byte, wait for the next one.
-          }
-          if (boundary < 2 || boundary + 2 > static_cast<int32_t>(augmented.charCount_)) {
-            continue;  // Skip splits that land in the leading/trailing sentinels.
-          }
-
-          const size_t idx = static_cast<size_t>(boundary);
-          if (idx >= augmented.charCount_) {
-            continue;
-          }
-          scores[idx] = std::max(scores[idx], level);
-        }
-      }
-    }
+  if (patterns.dense) {
+    scoreDense(*patterns.dense, augmented, scores);
+  } else {
+    scoreTypst(patterns, augmented, scores);
   }
 
   return collectBreakIndexes(cps, scores, augmented.charCount_, config.minPrefix, config.minSuffix);
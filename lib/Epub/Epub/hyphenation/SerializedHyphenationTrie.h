@@ -3,9 +3,24 @@
 #include <cstddef>
 #include <cstdint>
 
-// Lightweight descriptor that points at a serialized Liang hyphenation trie stored in flash.
+// The same automaton re-encoded by generate_hyphenation_trie.py for fewer flash reads per lookup (see
+// docs/hyphenation-trie-format.md). The first two bytes of a match index straight into `dense`; deeper nodes keep
+// their transitions sorted in `nodes`, and their level data lives apart from them in `levels`.
+struct DenseHyphenationTrie {
+  const std::uint8_t* classes;  // 256 entries: folded class of each byte, 0 when no pattern uses it
+  size_t classCount;
+  const std::uint32_t* dense;  // Node offsets by class: classCount for depth 1, then classCount^2 for depth 2
+  const std::uint8_t* nodes;
+  size_t nodesSize;
+  const std::uint8_t* levels;
+  size_t levelsSize;
+};
+
+// Lightweight descriptor that points at a serialized Liang hyphenation trie stored in flash. Tries in the dense
+// layout set `dense` and leave the Typst fields empty.
 struct SerializedHyphenationPatterns {
   size_t rootOffset;
   const std::uint8_t* data;
   size_t size;
+  const DenseHyphenationTrie* dense = nullptr;
 };
@@ -6,1695 +6,2560 @@
 #include "../SerializedHyphenationTrie.h"
 
 // Auto-generated by generate_hyphenation_trie.py. Do not edit manually.
-alignas(4) constexpr uint8_t en_trie_data[] = {
-    0x2C, 0x22, 0x1F, 0x21, 0x23, 0x2D, 0x37, 0x41, 0x2A, 0x20, 0x4B, 0x2B, 0x35, 0x23, 0x19, 0x2B,
-    0x0E, 0x29, 0x2D, 0x0F, 0x36, 0x04, 0x19, 0x19, 0x19, 0x0F, 0x17, 0x15, 0x04, 0x0C, 0x0D, 0x18,
-    0x02, 0x04, 0x18, 0x03, 0x16, 0x0E, 0x0E, 0x0B, 0x0F, 0x19, 0x05, 0x0F, 0x0E, 0x0F, 0x17, 0x0D,
-    0x02, 0x0C, 0x19, 0x18, 0x05, 0x0F, 0x18, 0x18, 0x0C, 0x01, 0x02, 0x0B, 0x04, 0x0B, 0x04, 0x16,
-    0x04, 0x22, 0x04, 0x0D, 0x02, 0x0D, 0x2D, 0x0E, 0x03, 0x17, 0x03, 0x23, 0x0C, 0x0C, 0x05, 0x22,
-    0x02, 0x0F, 0x0C, 0x04, 0x0F, 0x02, 0x22, 0x04, 0x17, 0x04, 0x15, 0x03, 0x20, 0x16, 0x0F, 0x01,
-    0x0E, 0x0E, 0x04, 0x0D, 0x0C, 0x23, 0x0E, 0x03, 0x0E, 0x01, 0x0C, 0x02, 0x0D, 0x0E, 0x16, 0x0C,
-    0x0B, 0x0E, 0x23, 0x0F, 0x0B, 0x0C, 0x01, 0x0E, 0x0D, 0x05, 0x17, 0x0E, 0x17, 0x01, 0x15, 0x04,
-    0x0B, 0x0E, 0x02, 0x0B, 0x0C, 0x0B, 0x0B, 0x18, 0x0B, 0x0F, 0x23, 0x0D, 0x21, 0x15, 0x16, 0x0E,
-    0x18, 0x0E, 0x0D, 0x17, 0x0B, 0x22, 0x0C, 0x0F, 0x20, 0x0F, 0x0B, 0x17, 0x0E, 0x0C, 0x04, 0x0B,
-    0x0C, 0x01, 0x18, 0x05, 0x0E, 0x03, 0x0E, 0x0E, 0x04, 0x0D, 0x0D, 0x05, 0x23, 0x02, 0x0F, 0x0D,
-    0x0F, 0x0F, 0x03, 0x22, 0x21, 0x0E, 0x18, 0x0D, 0x02, 0x18, 0x05, 0x19, 0x04, 0x0F, 0x0E, 0x40,
-    0x17, 0x17, 0x0E, 0x22, 0x05, 0x0F, 0x0C, 0x02, 0x15, 0x04, 0x23, 0x0C, 0x0F, 0x0F, 0x05, 0x0C,
-    0x04, 0x0E, 0x0E, 0x0C, 0x22, 0x0F, 0x22, 0x1F, 0x0D, 0x16, 0x0B, 0x0E, 0x19, 0x22, 0x0E, 0x19,
-    0x0E, 0x05, 0x23, 0x0F, 0x21, 0x17, 0x03, 0x18, 0x0C, 0x18, 0x01, 0x0B, 0x03, 0x15, 0x02, 0x0D,
-    0x0C, 0x01, 0x0C, 0x0C, 0x17, 0x19, 0x05, 0x18, 0x2C, 0x0D, 0x2C, 0x0F, 0x05, 0x2C, 0x16, 0x0D,
-    0x21, 0x0D, 0x21, 0x0C, 0x16, 0x16, 0x05, 0x21, 0x02, 0x16, 0x0E, 0x15, 0x2D, 0x19, 0x02, 0x0B,
-    0x0E, 0x01, 0x16, 0x29, 0x10, 0x0B, 0x37, 0x19, 0x22, 0x0B, 0x15, 0x23, 0x15, 0x21, 0x10, 0x2A,
-    0x0D, 0x24, 0x0B, 0x15, 0x22, 0x15, 0x2D, 0x0C, 0x0B, 0x1F, 0x0E, 0x24, 0x0D, 0x29, 0x0C, 0x33,
-    0x2D, 0x15, 0x42, 0x2E, 0x18, 0x2E, 0x15, 0x23, 0x1F, 0x21, 0x19, 0x23, 0x23, 0x20, 0x0D, 0x20,
-    0x0B, 0x1A, 0x15, 0x17, 0x19, 0x17, 0x15, 0x0C, 0x17, 0x23, 0x21, 0x15, 0x0B, 0x1A, 0x0B, 0x19,
-    0x0C, 0x0B, 0x0D, 0x2A, 0x0B, 0x2A, 0x0C, 0x1F, 0x19, 0x16, 0x0B, 0x0B, 0x24, 0x0C, 0x23, 0x0B,
-    0x1F, 0x0B, 0x0C, 0x1A, 0x15, 0x0D, 0x29, 0x0B, 0x0C, 0x21, 0x1A, 0x01, 0x16, 0x0B, 0x19, 0x29,
-    0x17, 0x21, 0x02, 0x0B, 0x16, 0x03, 0x19, 0x29, 0x0F, 0x0B, 0x17, 0x2D, 0x2B, 0x0F, 0x15, 0x15,
-    0x0B, 0x01, 0x10, 0x0D, 0x0D, 0x29, 0x0C, 0x0D, 0x0E, 0x0D, 0x2E, 0x1F, 0x10, 0x0B, 0x05, 0x16,
-    0x29, 0x02, 0x0B, 0x0E, 0x0D, 0x0B, 0x16, 0x0D, 0x19, 0x0D, 0x0F, 0x1F, 0x0E, 0x33, 0x0C, 0x2E,
-    0x0D, 0x01, 0x1A, 0x01, 0x19, 0x18, 0x0D, 0x0F, 0x0D, 0x2E, 0x0B, 0x01, 0x21, 0x1A, 0x17, 0x10,
-    0x16, 0x15, 0x1F, 0x0B, 0x01, 0x2B, 0x01, 0x23, 0x03, 0x1F, 0x0B, 0x21, 0x0B, 0x1F, 0x1F, 0x38,
-    0x0B, 0x17, 0x2B, 0x03, 0x17, 0x19, 0x1A, 0x0D, 0x15, 0x0C, 0x15, 0x05, 0x29, 0x15, 0x05, 0x1F,
-    0x15, 0x1F, 0x0F, 0x18, 0x15, 0x2E, 0x0F, 0x0F, 0x34, 0x20, 0x19, 0x0D, 0x16, 0x15, 0x05, 0x21,
-    0x15, 0x21, 0x1F, 0x0B, 0x0D, 0x38, 0x0D, 0x16, 0x0B, 0x0D, 0x18, 0x21, 0x18, 0x0F, 0x29, 0x21,
-    0x0B, 0x0B, 0x10, 0x0D, 0x0E, 0x38, 0x18, 0x23, 0x1F, 0x0D, 0x17, 0x29, 0x01, 0x35, 0x2B, 0x0D,
-    0x03, 0x2A, 0x2B, 0x10, 0x0D, 0x0C, 0x21, 0x22, 0x0F, 0x2B, 0x34, 0x0B, 0x1A, 0x0D, 0x17, 0x2D,
-    0x23, 0x03, 0x18, 0x0F, 0x0B, 0x0D, 0x1F, 0x16, 0x0D, 0x0B, 0x23, 0x10, 0x06, 0x19, 0x33, 0x0D,
-    0x23, 0x05, 0x17, 0x23, 0x33, 0x29, 0x01, 0x20, 0x17, 0x1F, 0x15, 0x1A, 0x0F, 0x03, 0x33, 0x03,
-    0x0C, 0x15, 0x0B, 0x3F, 0x0C, 0x0B, 0x0D, 0x1F, 0x0F, 0x2D, 0x0D, 0x0C, 0x0B, 0x23, 0x01, 0x29,
-    0x33, 0x0B, 0x1F, 0x18, 0x0B, 0x16, 0x1F, 0x10, 0x01, 0x2B, 0x0C, 0x05, 0x1F, 0x0B, 0x10, 0x1A,
-    0x05, 0x20, 0x15, 0x0F, 0x1F, 0x1F, 0x0C, 0x2B, 0x1F, 0x49, 0x0D, 0x3D, 0x03, 0x1F, 0x15, 0x03,
-    0x29, 0x0F, 0x0B, 0x15, 0x21, 0x33, 0x15, 0x0B, 0x23, 0x15, 0x15, 0x21, 0x0D, 0x35, 0x10, 0x0C,
-    0x29, 0x0E, 0xA0, 0x00, 0x41, 0x21, 0x68, 0xFD, 0xA0, 0x00, 0x51, 0x21, 0x72, 0xFD, 0x21, 0x65,
-    0xFD, 0x21, 0x64, 0xFD, 0xA0, 0x00, 0x61, 0x21, 0x74, 0xFD, 0xA0, 0x00, 0x71, 0x21, 0x74, 0xFD,
-    0xA0, 0x00, 0x81, 0x21, 0x74, 0xFD, 0x21, 0x61, 0xFD, 0xA0, 0x00, 0x91, 0x21, 0x6D, 0xFD, 0xA0,
-    0x00, 0xA1, 0x21, 0x73, 0xFD, 0xA2, 0x00, 0x41, 0x65, 0x69, 0xE5, 0xFD, 0x24, 0x63, 0x67, 0x69,
-    0x74, 0xE4, 0xC6, 0xF0, 0xF9, 0x21, 0x65, 0xC3, 0x22, 0x69, 0x79, 0xFD, 0xC0, 0x22, 0x73, 0x74,
-    0xD3, 0xFB, 0xA0, 0x00, 0xB1, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0x24, 0x63, 0x70, 0x73, 0x74,
-    0xBF, 0xB9, 0xB9, 0xFD, 0x21, 0x6D, 0xCB, 0x21, 0x6F, 0xFD, 0x41, 0x64, 0xFF, 0xAA, 0x41, 0x69,
-    0xFF, 0x9A, 0x41, 0x6E, 0xFF, 0x90, 0x4C, 0x63, 0x64, 0x66, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74,
-    0x75, 0x76, 0x77, 0xFF, 0x8F, 0xFF, 0x9B, 0xFF, 0xA1, 0xFF, 0xA7, 0xFF, 0xB0, 0xFF, 0xC6, 0xFF,
-    0xD7, 0xFF, 0xE5, 0xFF, 0xF1, 0xFF, 0xF4, 0xFF, 0xF8, 0xFF, 0xFC, 0x41, 0x61, 0xFF, 0x85, 0x41,
-    0x65, 0xFF, 0x63, 0x43, 0x67, 0x6E, 0x73, 0xFF, 0x65, 0xFF, 0xF8, 0xFF, 0xFC, 0xC1, 0x00, 0x41,
-    0x61, 0xFF, 0x73, 0x41, 0x6F, 0xFF, 0x6D, 0x42, 0x6D, 0x74, 0xFF, 0x63, 0xFF, 0xFC, 0x22, 0x72,
-    0x73, 0xEF, 0xF9, 0xA0, 0x00, 0xC1, 0x21, 0x69, 0xFD, 0x41, 0x69, 0xFF, 0x39, 0x21, 0x74, 0xFC,
-    0x21, 0x74, 0xFD, 0x24, 0x61, 0x65, 0x72, 0x75, 0xD0, 0xEB, 0xF3, 0xFD, 0x21, 0x70, 0xC3, 0x41,
-    0x63, 0xFF, 0x4A, 0x41, 0x62, 0xFF, 0x4C, 0x21, 0x61, 0xFC, 0x41, 0x6C, 0xFF, 0x3F, 0x21, 0x6F,
-    0xFC, 0x45, 0x6D, 0x6E, 0x70, 0x72, 0x74, 0xFF, 0xEB, 0xFF, 0xEE, 0xFF, 0xF6, 0xFF, 0xFD, 0xFF,
-    0x17, 0x41, 0x61, 0xFF, 0x07, 0x21, 0x6C, 0xFC, 0x41, 0x69, 0xFF, 0x4A, 0x21, 0x6C, 0xFC, 0x21,
-    0x6C, 0xFD, 0xA1, 0x00, 0x51, 0x69, 0xFD, 0x41, 0x72, 0xFF, 0x12, 0xA1, 0x00, 0xD1, 0x74, 0xFC,
-    0x21, 0x65, 0xF7, 0xA1, 0x00, 0x51, 0x6E, 0xFD, 0x21, 0x67, 0xEF, 0x43, 0x65, 0x72, 0x6E, 0xFE,
-    0xEF, 0xFF, 0xF8, 0xFF, 0xFD, 0x25, 0x61, 0x65, 0x68, 0x69, 0x6F, 0xBC, 0xD0, 0xDD, 0xE6, 0xF6,
-    0x41, 0x6F, 0xFF, 0x2E, 0xC1, 0x00, 0x71, 0x76, 0xFF, 0x57, 0x42, 0x61, 0x69, 0xFE, 0xD0, 0xFF,
-    0xFA, 0x41, 0x63, 0xFE, 0xB1, 0x44, 0x6D, 0x6F, 0x72, 0x73, 0xFF, 0xEB, 0xFE, 0xC5, 0xFF, 0xF5,
-    0xFF, 0xFC, 0xA0, 0x00, 0xE1, 0x21, 0x6F, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x63,
-    0xFD, 0x41, 0x74, 0xFE, 0x97, 0x42, 0x63, 0x6D, 0xFE, 0x93, 0xFF, 0x6E, 0xA0, 0x04, 0xA2, 0x21,
-    0x76, 0xFD, 0x21, 0x69, 0xFD, 0x25, 0x65, 0x69, 0x6F, 0x75, 0x72, 0xD0, 0xE9, 0xEC, 0xF0, 0xFD,
-    0x41, 0x68, 0xFE, 0xC2, 0x21, 0x74, 0xFC, 0xA0, 0x00, 0xF1, 0x21, 0x69, 0xFD, 0x22, 0x72, 0x73,
-    0xF7, 0xFD, 0x41, 0x72, 0xFE, 0x60, 0xA0, 0x00, 0xD1, 0x41, 0x6D, 0xFE, 0x71, 0x42, 0x64, 0x65,
-    0xFE, 0x73, 0xFF, 0xFC, 0xA0, 0x01, 0x01, 0x21, 0x6D, 0xFD, 0x43, 0x61, 0x67, 0x73, 0xFF, 0xFD,
-    0xFE, 0x60, 0xFE, 0x60, 0xA0, 0x01, 0x12, 0x21, 0x74, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x75, 0xFD,
-    0x41, 0x72, 0xFE, 0x9E, 0xC1, 0x00, 0x71, 0x6C, 0xFE, 0x3A, 0x41, 0x65, 0xFE, 0x4F, 0xA0, 0x11,
-    0x73, 0x21, 0x6C, 0xFD, 0x21, 0x79, 0xFD, 0x21, 0x68, 0xFD, 0xA0, 0x11, 0xA2, 0x21, 0x62, 0xFD,
-    0x21, 0x69, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x72, 0xFD, 0xA1, 0x00, 0xD1, 0x65, 0xFD, 0x4D, 0x61,
-    0x62, 0x65, 0x67, 0x6C, 0x6E, 0x71, 0x72, 0x73, 0x75, 0x79, 0x74, 0x76, 0xFF, 0x9F, 0xFE, 0x0A,
-    0xFF, 0xA4, 0xFF, 0xA8, 0xFF, 0xAF, 0xFF, 0xBC, 0xFF, 0xCF, 0xFF, 0xD2, 0xFE, 0x1C, 0xFF, 0xD6,
-    0xFF, 0xDC, 0xFF, 0xE9, 0xFF, 0xFB, 0x41, 0x73, 0xFF, 0x71, 0x41, 0x6D, 0xFE, 0xF6, 0x21, 0x72,
-    0xFC, 0x22, 0x65, 0x6F, 0xF5, 0xFD, 0xA0, 0x11, 0xC3, 0x21, 0x6D, 0xFD, 0x21, 0x6F, 0xFD, 0xA1,
-    0x00, 0xD1, 0x73, 0xFD, 0xA0, 0x01, 0x32, 0x21, 0x74, 0xFD, 0xA0, 0x11, 0xF2, 0x43, 0x67, 0x6D,
-    0x74, 0xFD, 0xD3, 0xFD, 0xF8, 0xFF, 0xFD, 0xA2, 0x00, 0xD1, 0x6E, 0x6F, 0xF0, 0xF6, 0x42, 0x61,
-    0x62, 0xFD, 0xC2, 0xFD, 0xAA, 0x44, 0x61, 0x65, 0x69, 0x6F, 0xFF, 0xDA, 0xFF, 0xF2, 0xFF, 0xF9,
-    0xFD, 0xA6, 0x41, 0x69, 0xFD, 0xBD, 0x42, 0x64, 0x6B, 0xFF, 0xFC, 0xFD, 0xB3, 0x21, 0x6E, 0xF9,
-    0x42, 0x69, 0x65, 0xFD, 0xAF, 0xFD, 0x9A, 0x21, 0x6F, 0xF9, 0xA0, 0x09, 0x02, 0x21, 0x6F, 0xFD,
-    0xA0, 0x12, 0x12, 0x21, 0x61, 0xFD, 0xC5, 0x00, 0xD1, 0x72, 0x73, 0x74, 0x6D, 0x70, 0xFF, 0xF1,
-    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0xF7, 0xFF, 0xFD, 0x41, 0x72, 0xFD, 0x72, 0x42, 0x62, 0x65, 0xFD,
-    0x6E, 0xFF, 0xFC, 0x41, 0x79, 0xFD, 0x76, 0x42, 0x65, 0x6F, 0xFF, 0xFC, 0xFE, 0xE0, 0x42, 0x6E,
-    0x76, 0xFF, 0xF9, 0xFD, 0x6B, 0x24, 0x61, 0x65, 0x69, 0x6F, 0xB8, 0xD1, 0xE7, 0xF9, 0x41, 0x6C,
-    0xFE, 0xE6, 0x42, 0x6C, 0x6F, 0xFD, 0x36, 0xFF, 0xFC, 0x41, 0x6E, 0xFD, 0x47, 0x21, 0x69, 0xFC,
-    0x42, 0x6D, 0x70, 0xFD, 0x3A, 0xFF, 0xFD, 0x41, 0x69, 0xFD, 0x33, 0xA0, 0x04, 0xF2, 0x21, 0x74,
-    0xFD, 0xC5, 0x00, 0x61, 0x63, 0x65, 0x6B, 0x73, 0x75, 0xFF, 0xF6, 0xFD, 0xD2, 0xFE, 0xB5, 0xFD,
-    0x29, 0xFF, 0xFD, 0x41, 0x72, 0xFD, 0x1D, 0x45, 0x64, 0x6D, 0x6E, 0x72, 0x73, 0xFF, 0xCB, 0xFF,
-    0xD9, 0xFF, 0xEA, 0xFF, 0xFC, 0xFD, 0x67, 0x41, 0x75, 0xFF, 0x91, 0x41, 0x79, 0xFC, 0xED, 0x42,
-    0x65, 0x68, 0xFD, 0xF8, 0xFD, 0x10, 0x43, 0x63, 0x6D, 0x74, 0xFF, 0xF5, 0xFC, 0xE2, 0xFF, 0xF9,
-    0xA0, 0x01, 0x51, 0xA0, 0x12, 0x51, 0x21, 0x73, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x63, 0xFD, 0xC5,
-    0x00, 0xD1, 0x67, 0x6E, 0x70, 0x76, 0x69, 0xFE, 0x9B, 0xFC, 0xC3, 0xFC, 0xEA, 0xFF, 0xF1, 0xFF,
-    0xFD, 0xC1, 0x00, 0x51, 0x61, 0xFC, 0xD8, 0x44, 0x67, 0x6E, 0x6F, 0x74, 0xFF, 0xFA, 0xFE, 0x4F,
-    0xFC, 0xC3, 0xFC, 0xB1, 0x23, 0x61, 0x65, 0x69, 0xC2, 0xDB, 0xF3, 0xA0, 0x01, 0x62, 0x21, 0x61,
-    0xFD, 0x41, 0x6F, 0xFC, 0xB8, 0x41, 0x61, 0xFC, 0xB4, 0x41, 0x69, 0xFC, 0xB0, 0x21, 0x74, 0xFC,
-    0x24, 0x67, 0x6C, 0x6E, 0x72, 0xEE, 0xF1, 0xF5, 0xFD, 0x41, 0x63, 0xFE, 0x0E, 0x41, 0x61, 0xFC,
-    0x75, 0x21, 0x6C, 0xFC, 0x42, 0x65, 0x61, 0xFF, 0x6F, 0xFF, 0xFD, 0xA0, 0x12, 0x82, 0x21, 0x6C,
-    0xFD, 0x21, 0x61, 0xFD, 0xA3, 0x00, 0xD1, 0x72, 0x74, 0x67, 0xE5, 0xF0, 0xFD, 0xA0, 0x12, 0xD2,
-    0x21, 0x73, 0xFD, 0x21, 0x72, 0xFD, 0xC2, 0x01, 0x51, 0x74, 0x65, 0xFE, 0xBC, 0xFF, 0xFD, 0xA0,
-    0x12, 0xA3, 0x21, 0x63, 0xFD, 0x21, 0x69, 0xFD, 0x22, 0x73, 0x6D, 0xEE, 0xFD, 0x41, 0x65, 0xFD,
-    0xCA, 0x41, 0x6F, 0xFC, 0x49, 0x22, 0x6E, 0x72, 0xF8, 0xFC, 0xC1, 0x00, 0x81, 0x62, 0xFC, 0x55,
-    0x21, 0x61, 0xFA, 0x21, 0x74, 0xFD, 0x45, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xFF, 0x9A, 0xFF, 0xBE,
-    0xFF, 0xE2, 0xFF, 0xEF, 0xFF, 0xFD, 0x41, 0x63, 0xFC, 0x12, 0xA0, 0x12, 0xF2, 0x21, 0x66, 0xFD,
-    0x21, 0x6F, 0xFD, 0x41, 0x68, 0xFF, 0x2D, 0x21, 0x74, 0xFC, 0xA0, 0x13, 0x12, 0x21, 0x6D, 0xFD,
-    0x21, 0x65, 0xFD, 0x22, 0x65, 0x6E, 0xF4, 0xFD, 0x23, 0x69, 0x65, 0x6F, 0xDE, 0xE8, 0xFB, 0xC1,
-    0x00, 0xD1, 0x64, 0xFC, 0x0A, 0x41, 0x65, 0xFB, 0xFB, 0x21, 0x74, 0xFC, 0x41, 0x74, 0xFC, 0x87,
-    0x44, 0x61, 0x63, 0x64, 0x74, 0xFF, 0xFC, 0xFB, 0xEA, 0xFB, 0xE4, 0xFB, 0xEA, 0x41, 0x6C, 0xFB,
-    0xCB, 0xA1, 0x00, 0x71, 0x74, 0xFC, 0x41, 0x68, 0xFD, 0x51, 0x41, 0x74, 0xFD, 0x4D, 0x26, 0x64,
-    0x66, 0x72, 0x73, 0x74, 0x75, 0xD1, 0xDB, 0xE2, 0xF3, 0xF8, 0xFC, 0x41, 0x61, 0xFC, 0x8F, 0x42,
-    0x65, 0x69, 0xFB, 0xC1, 0xFB, 0xC4, 0x22, 0x64, 0x74, 0xF5, 0xF9, 0x41, 0x6E, 0xFB, 0xBE, 0x43,
-    0x65, 0x6F, 0x74, 0xFB, 0x99, 0xFF, 0xFC, 0xFD, 0x37, 0x41, 0x6D, 0xFE, 0xB7, 0x42, 0x6D, 0x61,
-    0xFD, 0x1A, 0xFF, 0xFC, 0x21, 0x65, 0xF9, 0xA0, 0x13, 0x31, 0x21, 0x73, 0xFD, 0x21, 0x79, 0xFD,
-    0x21, 0x6D, 0xF7, 0x21, 0x61, 0xFD, 0x21, 0x74, 0xFD, 0x22, 0x6C, 0x73, 0xF4, 0xFD, 0x24, 0x65,
-    0x69, 0x72, 0x6F, 0xC8, 0xD1, 0xE6, 0xFB, 0x41, 0x74, 0xFB, 0x5B, 0x41, 0x61, 0xFB, 0xA7, 0x21,
-    0x6E, 0xFC, 0x21, 0x6F, 0xFD, 0x21, 0x69, 0xFD, 0xA0, 0x13, 0x42, 0x21, 0x6F, 0xFD, 0x21, 0x6E,
-    0xFD, 0x21, 0x65, 0xFD, 0x44, 0x63, 0x6E, 0x74, 0x76, 0xFB, 0x44, 0xFF, 0xE3, 0xFF, 0xF1, 0xFF,
-    0xFD, 0xC1, 0x00, 0xC1, 0x63, 0xFE, 0xDC, 0x41, 0x69, 0xFB, 0x4C, 0xC1, 0x00, 0xC1, 0x74, 0xFB,
-    0x4B, 0x23, 0x65, 0x6D, 0x73, 0xF0, 0xF6, 0xFA, 0x41, 0x75, 0xFB, 0x41, 0x42, 0x67, 0x74, 0xFB,
-    0x1C, 0xFF, 0xFC, 0x41, 0x74, 0xFB, 0x36, 0x41, 0x64, 0xFB, 0x32, 0x43, 0x71, 0x73, 0x77, 0xFB,
-    0x0D, 0xFF, 0xF8, 0xFF, 0xFC, 0x41, 0x64, 0xFB, 0x03, 0x25, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xBB,
-    0xD8, 0xE3, 0xF2, 0xFC, 0x41, 0x69, 0xFE, 0xB9, 0x42, 0x66, 0x6C, 0xFB, 0x17, 0xFB, 0x17, 0x41,
-    0x69, 0xFF, 0x06, 0xA0, 0x13, 0x61, 0xA0, 0x0C, 0x31, 0xA0, 0x13, 0x72, 0xC6, 0x00, 0xA1, 0x63,
-    0x64, 0x70, 0x72, 0x73, 0x76, 0xFA, 0xD6, 0xFF, 0xF7, 0xFF, 0xFA, 0xFF, 0xFA, 0xFF, 0xFD, 0xFF,
-    0xFA, 0x21, 0x69, 0xEB, 0x44, 0x6C, 0x6E, 0x72, 0x6D, 0xFF, 0xD4, 0xFC, 0x62, 0xFF, 0xDB, 0xFF,
-    0xFD, 0xA0, 0x01, 0x81, 0x21, 0x67, 0xFD, 0xA1, 0x00, 0xD1, 0x6E, 0xFD, 0x41, 0x62, 0xFB, 0x8E,
-    0xA1, 0x00, 0x51, 0x61, 0xFC, 0xA0, 0x13, 0x92, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0x41, 0x6F,
-    0xFF, 0x19, 0x21, 0x6E, 0xFC, 0x22, 0x68, 0x69, 0xF6, 0xFD, 0x47, 0x63, 0x65, 0x68, 0x69, 0x74,
-    0x79, 0x70, 0xFF, 0x9A, 0xFF, 0xCA, 0xFC, 0x2C, 0xFF, 0xDD, 0xFF, 0xE6, 0xFC, 0x2C, 0xFF, 0xFB,
-    0xA0, 0x13, 0xB2, 0x21, 0x72, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x65, 0xFD, 0xA1,
-    0x00, 0x51, 0x70, 0xFD, 0x41, 0x61, 0xFE, 0xC7, 0x41, 0x67, 0xFD, 0x00, 0x21, 0x65, 0xFC, 0xA2,
-    0x00, 0x51, 0x6E, 0x6C, 0xF5, 0xFD, 0x41, 0x6F, 0xFD, 0xB5, 0x42, 0x67, 0x6B, 0xFF, 0x97, 0xFA,
-    0x6F, 0xC3, 0x00, 0xD1, 0x6C, 0x6D, 0x6E, 0xFA, 0x41, 0xFF, 0xF5, 0xFF, 0xF9, 0x41, 0x67, 0xFD,
-    0x66, 0xC2, 0x00, 0x51, 0x69, 0x6F, 0xFA, 0x58, 0xFF, 0xFC, 0x41, 0x73, 0xFA, 0x4F, 0x44, 0x6E,
-    0x70, 0x75, 0x71, 0xFD, 0xAF, 0xFF, 0xF3, 0xFF, 0xFC, 0xFB, 0xC8, 0x41, 0x74, 0xFA, 0x44, 0x21,
-    0x75, 0xFC, 0x21, 0x62, 0xFD, 0x21, 0x69, 0xFD, 0x46, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0xFF,
-    0xA7, 0xFF, 0xB7, 0xFB, 0xAE, 0xFF, 0xC9, 0xFF, 0xE6, 0xFF, 0xFD, 0xA0, 0x13, 0xD2, 0x21, 0x74,
-    0xFD, 0xA1, 0x00, 0x61, 0x74, 0xFD, 0x41, 0x65, 0xFA, 0x04, 0xA0, 0x13, 0xF2, 0x21, 0x72, 0xFD,
-    0xA1, 0x00, 0x61, 0x72, 0xFD, 0x47, 0x61, 0x63, 0x64, 0x65, 0x6B, 0x6F, 0x75, 0xFF, 0xEC, 0xFF,
-    0xF1, 0xFA, 0x33, 0xFF, 0xFB, 0xF9, 0xFB, 0xF9, 0xFB, 0xF9, 0xF5, 0x44, 0x6E, 0x70, 0x72, 0x73,
-    0xFF, 0xEA, 0xF9, 0xDF, 0xFD, 0x92, 0xFA, 0x60, 0x41, 0x64, 0xFA, 0x57, 0x42, 0x6E, 0x72, 0xFF,
-    0xFC, 0xFA, 0x4F, 0xA0, 0x14, 0x12, 0x21, 0x72, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x63, 0xFD, 0x22,
-    0x65, 0x69, 0xED, 0xFD, 0x41, 0x6C, 0xFD, 0x15, 0xA0, 0x14, 0x32, 0x21, 0x6C, 0xFD, 0x21, 0x62,
-    0xFD, 0x22, 0x69, 0x65, 0xF3, 0xFD, 0xA0, 0x12, 0x32, 0x21, 0x69, 0xFD, 0x21, 0x6E, 0xFD, 0x21,
-    0x6C, 0xFD, 0xA0, 0x12, 0x53, 0x21, 0x65, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x72, 0xFD, 0x22, 0x69,
-    0x6F, 0xF1, 0xFD, 0x57, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6C, 0x6D,
-    0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x6B, 0xF9, 0xE3, 0xFA, 0x40, 0xFA,
-    0xA2, 0xFA, 0xF2, 0xFB, 0x6B, 0xFB, 0x9E, 0xFB, 0xD2, 0xFC, 0x32, 0xFC, 0x74, 0xFC, 0x84, 0xFC,
-    0xD1, 0xFD, 0x53, 0xFD, 0x85, 0xFD, 0xBB, 0xFE, 0x0B, 0xFE, 0x76, 0xFE, 0xE7, 0xFF, 0x65, 0xFF,
-    0xA8, 0xFF, 0xCC, 0xFF, 0xDE, 0xF9, 0xB2, 0xFF, 0xFB, 0xA0, 0x01, 0x91, 0xA0, 0x01, 0x71, 0x22,
-    0x6C, 0x6E, 0xFD, 0xFD, 0xA0, 0x01, 0x21, 0x21, 0x64, 0xFD, 0xA1, 0x00, 0xD1, 0x72, 0xFD, 0xA0,
-    0x01, 0xA2, 0x21, 0x62, 0xFD, 0x21, 0x61, 0xFD, 0x42, 0x61, 0x74, 0xF9, 0x28, 0xFF, 0xFD, 0x21,
-    0x74, 0xE5, 0x21, 0x61, 0xFD, 0xA0, 0x01, 0xC2, 0x22, 0x7A, 0x63, 0xFD, 0xD4, 0x21, 0x69, 0xFB,
-    0x21, 0x6C, 0xFD, 0x21, 0x67, 0xD1, 0xA1, 0x01, 0x91, 0x6F, 0xFD, 0xA0, 0x01, 0xE1, 0x21, 0x6C,
-    0xFD, 0x28, 0x2E, 0x61, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x75, 0xB8, 0xBE, 0xC9, 0xD7, 0xE1, 0xEF,
-    0xF5, 0xFD, 0xA2, 0x01, 0x41, 0x64, 0x6F, 0xB2, 0xB2, 0xA0, 0x02, 0x11, 0x21, 0x6C, 0xFD, 0x22,
-    0x72, 0x62, 0xF3, 0xFD, 0x41, 0x75, 0xFF, 0x98, 0xA0, 0x01, 0xF1, 0x22, 0x6F, 0x72, 0xF9, 0xFD,
-    0x41, 0x74, 0xFF, 0x8C, 0x21, 0x65, 0xFC, 0xA0, 0x02, 0x21, 0xA3, 0x02, 0x02, 0x65, 0x6E, 0x6F,
-    0xFD, 0xEE, 0xFD, 0x41, 0x62, 0xFF, 0x81, 0x21, 0x6F, 0xFC, 0x41, 0x66, 0xF8, 0xB6, 0x21, 0x69,
-    0xFC, 0xA0, 0x02, 0x31, 0x42, 0x6C, 0x6D, 0xFF, 0xA7, 0xFF, 0xFD, 0x27, 0x61, 0x65, 0x68, 0x69,
-    0x72, 0x74, 0x75, 0xC4, 0xD0, 0xD9, 0xDF, 0xEC, 0xF3, 0xF9, 0x21, 0x6E, 0xE7, 0x21, 0x69, 0xFD,
-    0x41, 0x2E, 0xFF, 0x54, 0x21, 0x72, 0xFC, 0x41, 0x61, 0xFF, 0x84, 0xC6, 0x02, 0x41, 0x61, 0x63,
-    0x65, 0x6F, 0x74, 0x75, 0xFF, 0xBC, 0xFF, 0xFC, 0xF8, 0x70, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0x41,
-    0x21, 0x65, 0xC1, 0x41, 0x77, 0xFF, 0x68, 0x41, 0x6E, 0xFF, 0x2D, 0x21, 0x61, 0xFC, 0x21, 0x75,
-    0xB3, 0xC2, 0x01, 0x91, 0x63, 0x6D, 0xFF, 0x96, 0xFF, 0x23, 0xA8, 0x02, 0x11, 0x64, 0x65, 0x69,
-    0x6C, 0x6F, 0x72, 0x73, 0x75, 0xC3, 0xCA, 0xD1, 0xE6, 0xE9, 0xF1, 0xF4, 0xF7, 0xC1, 0x02, 0x31,
-    0x69, 0xF8, 0xC2, 0x21, 0x72, 0xFA, 0xA0, 0x14, 0x51, 0x21, 0x68, 0xFD, 0x21, 0x73, 0xFD, 0xA1,
-    0x00, 0x51, 0x69, 0xFD, 0xA1, 0x02, 0x11, 0x66, 0xFB, 0xA0, 0x01, 0x41, 0x42, 0x62, 0x6E, 0xFF,
-    0xFD, 0xF8, 0x0C, 0x41, 0x6C, 0xFE, 0xE1, 0x43, 0x6C, 0x6F, 0x75, 0xFF, 0xFC, 0xF8, 0x01, 0xFE,
-    0xD2, 0xA0, 0x02, 0x52, 0xA0, 0x02, 0x71, 0x41, 0x69, 0xFF, 0x04, 0xA2, 0x02, 0x11, 0x67, 0x6E,
-    0xF9, 0xFC, 0x41, 0x72, 0xFE, 0xBA, 0x42, 0x65, 0x6C, 0xFF, 0xFC, 0xFE, 0xBE, 0x48, 0x61, 0x65,
-    0x69, 0x6C, 0x6E, 0x6F, 0x75, 0x79, 0xFF, 0xCF, 0xFF, 0xDA, 0xFF, 0x1B, 0xFF, 0xE4, 0xFF, 0x1B,
-    0xFF, 0xEE, 0xFF, 0xF9, 0xFF, 0xCC, 0x44, 0x61, 0x65, 0x6C, 0x6F, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
-    0x2B, 0xFF, 0x11, 0x41, 0x2E, 0xFF, 0x04, 0x41, 0x79, 0xFE, 0x8D, 0xC2, 0x02, 0x92, 0x69, 0x6F,
-    0xFA, 0x7E, 0xF7, 0xC5, 0x41, 0x65, 0xFA, 0x75, 0xC5, 0x02, 0x81, 0x61, 0x63, 0x6C, 0x6E, 0x74,
-    0xFE, 0x74, 0xFF, 0xEB, 0xFF, 0xEF, 0xFF, 0xF3, 0xFF, 0xFC, 0xA0, 0x02, 0xB1, 0x41, 0x6E, 0xFE,
-    0xCB, 0x21, 0x65, 0xFC, 0x43, 0x62, 0x64, 0x72, 0xFE, 0x60, 0xFE, 0x97, 0xFF, 0x75, 0x41, 0x69,
-    0xFE, 0x4B, 0x41, 0x69, 0xFF, 0x67, 0x42, 0x64, 0x74, 0xFE, 0x85, 0xFF, 0xFC, 0xA0, 0x02, 0xC2,
-    0xA2, 0x02, 0x41, 0x6E, 0x6F, 0xF6, 0xFD, 0x41, 0x2E, 0xFE, 0xCA, 0xC2, 0x01, 0xF1, 0x61, 0x65,
-    0xFF, 0xFC, 0xF7, 0x5D, 0x41, 0x76, 0xFE, 0x30, 0x41, 0x63, 0xFE, 0x21, 0x22, 0x65, 0x69, 0xF8,
-    0xFC, 0x41, 0x2E, 0xFE, 0x1B, 0x21, 0x67, 0xFC, 0xA0, 0x02, 0xE2, 0xA1, 0x01, 0x91, 0x74, 0xFD,
-    0xA0, 0x02, 0xE1, 0x44, 0x2E, 0x73, 0x74, 0x7A, 0xFF, 0x26, 0xFF, 0xF8, 0xFF, 0xFD, 0xFF, 0x41,
-    0x48, 0x61, 0x64, 0x65, 0x69, 0x6C, 0x6D, 0x6F, 0x79, 0xFF, 0xA4, 0xFF, 0xAE, 0xFF, 0xC0, 0xFF,
-    0xCB, 0xFF, 0xDC, 0xFD, 0xF9, 0xFF, 0xE5, 0xFF, 0xF3, 0x41, 0x63, 0xFD, 0xEB, 0x41, 0x73, 0xFE,
-    0xFC, 0xA0, 0x03, 0x02, 0x22, 0x69, 0x6F, 0xF9, 0xFD, 0xC5, 0x01, 0x91, 0x62, 0x67, 0x72, 0x73,
-    0x74, 0xFD, 0xDB, 0xFE, 0x12, 0xF7, 0x92, 0xFF, 0xF0, 0xFF, 0xFB, 0x41, 0x61, 0xFD, 0xC9, 0xA0,
-    0x14, 0x63, 0x21, 0x62, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x74, 0xFD, 0x22, 0x72, 0x6E, 0xF0, 0xFD,
-    0xC1, 0x01, 0xF1, 0x6F, 0xF6, 0xD8, 0x44, 0x63, 0x66, 0x6C, 0x6E, 0xFD, 0xE5, 0xFD, 0xAE, 0xFF,
-    0x21, 0xFF, 0xFA, 0xC2, 0x02, 0x11, 0x6E, 0x72, 0xFD, 0x99, 0xFA, 0x36, 0x45, 0x61, 0x65, 0x69,
-    0x6F, 0x70, 0xFF, 0xBD, 0xFF, 0xDF, 0xFF, 0xEA, 0xFF, 0xF7, 0xFF, 0x18, 0x41, 0x65, 0xFD, 0xBF,
-    0xA0, 0x13, 0x71, 0xA1, 0x02, 0x71, 0x73, 0xFD, 0x21, 0x79, 0xFB, 0xC2, 0x02, 0x21, 0x63, 0x69,
-    0xFD, 0xB0, 0xF6, 0x97, 0x41, 0x69, 0xFD, 0xE3, 0x24, 0x67, 0x6C, 0x72, 0x74, 0xE4, 0xF0, 0xF3,
-    0xFC, 0x41, 0x73, 0xF6, 0x81, 0x41, 0x73, 0xFD, 0x96, 0x41, 0x77, 0xFD, 0xE8, 0xC4, 0x01, 0x91,
-    0x65, 0x69, 0x6C, 0x6F, 0xFF, 0xF4, 0xFF, 0xF8, 0xFD, 0xBB, 0xFF, 0xFC, 0x41, 0x74, 0xFD, 0xF4,
-    0x44, 0x65, 0x6E, 0x73, 0x75, 0xFD, 0x3C, 0xFD, 0xB7, 0xFF, 0xFC, 0xFD, 0xB7, 0xC2, 0x02, 0x41,
-    0x69, 0x6C, 0xFA, 0x78, 0xFD, 0x9B, 0xA0, 0x02, 0xA2, 0x41, 0x73, 0xFD, 0x9E, 0xA0, 0x03, 0x22,
-    0x42, 0x65, 0x69, 0xFD, 0xB1, 0xFD, 0x1C, 0x41, 0x65, 0xFD, 0x15, 0x41, 0x68, 0xFD, 0x50, 0x4A,
-    0x63, 0x65, 0x66, 0x6D, 0x6E, 0x6F, 0x70, 0x73, 0x74, 0x75, 0xFF, 0xE7, 0xFF, 0xEA, 0xFF, 0xEE,
-    0xFF, 0xF1, 0xFF, 0xF8, 0xFD, 0x4C, 0xFD, 0x88, 0xFF, 0xFC, 0xFD, 0x4C, 0xFD, 0x88, 0x41, 0x69,
-    0xFD, 0x83, 0x21, 0x6C, 0xFC, 0x41, 0x7A, 0xFE, 0xDB, 0x21, 0x69, 0xFC, 0xC1, 0x01, 0x21, 0x68,
-    0xF6, 0x33, 0x41, 0x63, 0xF8, 0xE9, 0xA2, 0x00, 0x51, 0x74, 0x61, 0xF6, 0xFC, 0xA0, 0x02, 0x81,
-    0x41, 0x6F, 0xFD, 0x61, 0xC1, 0x02, 0x81, 0x6F, 0xF6, 0x06, 0x41, 0x72, 0xFD, 0x57, 0x48, 0x61,
-    0x63, 0x6E, 0x70, 0x74, 0x75, 0x67, 0x76, 0xFF, 0xEF, 0xFF, 0xF2, 0xFD, 0x53, 0xFF, 0xF6, 0xFD,
-    0x53, 0xFF, 0xFC, 0xF8, 0xE5, 0xF5, 0xFC, 0x41, 0x6C, 0xFB, 0x1A, 0xA0, 0x14, 0x93, 0x41, 0x65,
-    0xF8, 0xF2, 0x44, 0x65, 0x64, 0x6E, 0x72, 0xFD, 0x2F, 0xF8, 0xEE, 0xFF, 0xF9, 0xFF, 0xFC, 0x45,
-    0x61, 0x69, 0x6F, 0x72, 0x77, 0xFF, 0xE8, 0xFF, 0xF3, 0xFC, 0x8A, 0xFF, 0xBE, 0xFD, 0x22, 0x43,
-    0x61, 0x6C, 0x72, 0xFC, 0xBC, 0xFC, 0xBC, 0xFC, 0x7D, 0xCB, 0x02, 0x11, 0x61, 0x64, 0x65, 0x67,
-    0x69, 0x6B, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0xFF, 0x0F, 0xFF, 0x24, 0xFF, 0x37, 0xFF, 0x44, 0xFF,
-    0x66, 0xFF, 0x89, 0xFF, 0x90, 0xFF, 0x9D, 0xFF, 0xB5, 0xFF, 0xE6, 0xFF, 0xF6, 0x42, 0x72, 0x74,
-    0xF5, 0x75, 0xFC, 0x57, 0x41, 0x6F, 0xFC, 0x50, 0xA0, 0x0D, 0xF2, 0x21, 0x65, 0xFD, 0x21, 0x6C,
-    0xFD, 0x21, 0x62, 0xFD, 0x22, 0x72, 0x61, 0xF0, 0xFD, 0x41, 0x72, 0xFC, 0xAE, 0x42, 0x65, 0x69,
-    0xFF, 0xFC, 0xFC, 0x2C, 0xC1, 0x01, 0x41, 0x72, 0xFC, 0x30, 0x21, 0x61, 0xFA, 0x21, 0x6C, 0xFD,
-    0x42, 0x61, 0x75, 0xFC, 0x5B, 0xFC, 0x97, 0x43, 0x6C, 0x6E, 0x74, 0xFF, 0xF6, 0xFC, 0x54, 0xFF,
-    0xF9, 0x44, 0x63, 0x6C, 0x72, 0x73, 0xF5, 0x58, 0xFE, 0x4A, 0xF8, 0xA8, 0xF9, 0x79, 0x41, 0x73,
-    0xF5, 0x42, 0x21, 0x65, 0xFC, 0x48, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x73, 0x75, 0xFF, 0xA8,
-    0xFF, 0xBF, 0xFF, 0xC8, 0xFF, 0xE2, 0xFC, 0x54, 0xFF, 0xEC, 0xFF, 0xFD, 0xFC, 0x72, 0x41, 0x75,
-    0xF6, 0xDC, 0x41, 0x74, 0xFC, 0x19, 0x41, 0x73, 0xFB, 0xDE, 0x42, 0x65, 0x69, 0xFB, 0xD2, 0xFF,
-    0xFC, 0x41, 0x74, 0xFE, 0xB6, 0x21, 0x65, 0xFC, 0x41, 0x67, 0xF4, 0xEA, 0x42, 0x6F, 0x76, 0xFB,
-    0xC0, 0xFB, 0xC8, 0xA1, 0x02, 0x31, 0x69, 0xF9, 0xA0, 0x03, 0x62, 0x4A, 0x63, 0x64, 0x6C, 0x6D,
-    0x6E, 0x70, 0x74, 0x75, 0x76, 0x77, 0xFF, 0xD7, 0xFF, 0xDF, 0xFB, 0xF0, 0xFF, 0xEA, 0xFF, 0xED,
-    0xF4, 0xEF, 0xFF, 0xF8, 0xFB, 0xB1, 0xFF, 0xFD, 0xF4, 0xD7, 0x41, 0x61, 0xFE, 0xED, 0xA0, 0x14,
-    0xC2, 0x21, 0x74, 0xFD, 0x42, 0x61, 0x65, 0xFC, 0x36, 0xFF, 0xFD, 0x21, 0x68, 0xF9, 0x41, 0x65,
-    0xFB, 0x86, 0x21, 0x6E, 0xFC, 0x42, 0x69, 0x72, 0xFF, 0xFD, 0xFC, 0x0C, 0x41, 0x73, 0xFB, 0x70,
-    0x44, 0x61, 0x65, 0x6E, 0x73, 0xFF, 0x96, 0xFB, 0xE7, 0xFF, 0x92, 0xFF, 0xFC, 0x42, 0x69, 0x6C,
-    0xFB, 0xF4, 0xFB, 0xF4, 0x42, 0x6C, 0x6E, 0xFB, 0x60, 0xFB, 0x97, 0x41, 0x74, 0xFB, 0xCC, 0xC6,
-    0x01, 0xF1, 0x61, 0x65, 0x6D, 0x6E, 0x6F, 0x7A, 0xFF, 0xF5, 0xFF, 0xFC, 0xFB, 0xE2, 0xFB, 0x73,
-    0xFB, 0x8C, 0xFE, 0x7E, 0x41, 0x69, 0xFE, 0x69, 0x41, 0x69, 0xFB, 0x34, 0x43, 0x64, 0x6E, 0x6F,
-    0xFB, 0x59, 0xFF, 0xFC, 0xFB, 0xAB, 0x41, 0x65, 0xFE, 0x57, 0x21, 0x67, 0xFC, 0x21, 0x6E, 0xFD,
-    0x42, 0x65, 0x61, 0xF4, 0x42, 0xFF, 0xFD, 0x42, 0x61, 0x68, 0xFB, 0xAA, 0xFE, 0x46, 0xCD, 0x03,
-    0x42, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x69, 0x6D, 0x6F, 0x70, 0x71, 0x72, 0x73, 0xFF, 0x5D,
-    0xFF, 0x7C, 0xFF, 0x8D, 0xFF, 0x97, 0xFF, 0xA2, 0xFF, 0xAF, 0xFF, 0xC1, 0xFF, 0xD6, 0xFF, 0xDE,
-    0xFE, 0x3F, 0xFB, 0x4D, 0xFF, 0xF2, 0xFF, 0xF9, 0x42, 0x62, 0x6E, 0xFB, 0x79, 0xFF, 0x0A, 0xA0,
-    0x03, 0x83, 0x44, 0x61, 0x62, 0x63, 0x74, 0xFC, 0xBF, 0xFB, 0x55, 0xFB, 0x55, 0xFF, 0xFD, 0x41,
-    0x63, 0xFB, 0xEA, 0x41, 0x68, 0xFA, 0xD1, 0x41, 0x68, 0xFB, 0x5A, 0x41, 0x6E, 0xFB, 0x00, 0x42,
-    0x65, 0x72, 0xFF, 0xFC, 0xFB, 0x29, 0x41, 0x72, 0xF7, 0x4F, 0x41, 0x6F, 0xFA, 0xD5, 0x21, 0x74,
-    0xFC, 0x21, 0x70, 0xFD, 0x21, 0x6D, 0xFD, 0x4C, 0x2E, 0x61, 0x68, 0x69, 0x6B, 0x6C, 0x6F, 0x70,
-    0x73, 0x74, 0x75, 0x79, 0xFA, 0xA2, 0xFF, 0xC1, 0xF4, 0x92, 0xFF, 0xCB, 0xF6, 0xB0, 0xFB, 0x3A,
-    0xFF, 0xD8, 0xFF, 0xDC, 0xFF, 0xE0, 0xFF, 0xE8, 0xFF, 0xEF, 0xFF, 0xFD, 0x41, 0x6F, 0xFA, 0xBF,
-    0xC4, 0x02, 0x11, 0x62, 0x63, 0x6C, 0x70, 0xFA, 0xBE, 0xFA, 0x84, 0xFF, 0xFC, 0xFA, 0x84, 0xC1,
-    0x00, 0x81, 0x68, 0xFA, 0x75, 0x41, 0x2E, 0xFA, 0xA6, 0xC1, 0x00, 0x91, 0x61, 0xFA, 0x63, 0x42,
-    0x61, 0x6E, 0xFA, 0x9C, 0xFF, 0xFA, 0x46, 0x63, 0x67, 0x6E, 0x72, 0x73, 0x76, 0xFF, 0xE9, 0xFF,
-    0xD6, 0xFF, 0xEF, 0xFF, 0xF9, 0xFE, 0x7C, 0xFA, 0x5E, 0xA0, 0x14, 0xE3, 0x21, 0x73, 0xFD, 0x21,
-    0x6F, 0xFD, 0x43, 0x6D, 0x6E, 0x72, 0xF3, 0x7E, 0xFA, 0x3A, 0xFF, 0xFD, 0xC1, 0x02, 0x31, 0x6D,
-    0xF3, 0x74, 0xA2, 0x01, 0x91, 0x65, 0x6F, 0xF0, 0xFA, 0x41, 0x72, 0xF3, 0x76, 0x21, 0x61, 0xFC,
-    0x21, 0x6E, 0xFD, 0x41, 0x75, 0xFA, 0x58, 0x47, 0x2E, 0x61, 0x62, 0x63, 0x66, 0x6F, 0x74, 0xFA,
-    0x12, 0xFA, 0x15, 0xFA, 0x3E, 0xFA, 0x81, 0xFA, 0x54, 0xFF, 0xF9, 0xFF, 0xFC, 0x41, 0x7A, 0xFA,
-    0x07, 0xA1, 0x02, 0x11, 0x69, 0xFC, 0x44, 0x67, 0x6D, 0x70, 0x73, 0xFB, 0x13, 0xFF, 0xFB, 0xFB,
-    0x13, 0xFB, 0x13, 0x41, 0x70, 0xF9, 0xF1, 0xA1, 0x02, 0xB1, 0x6F, 0xFC, 0x41, 0x6B, 0xFA, 0x75,
-    0x41, 0x67, 0xFA, 0x71, 0x41, 0x2E, 0xFA, 0xE2, 0xA1, 0x01, 0x21, 0x73, 0xFC, 0x43, 0x61, 0x65,
-    0x68, 0xFF, 0xF3, 0xFF, 0xFB, 0xFA, 0x64, 0xC4, 0x02, 0x11, 0x61, 0x65, 0x6C, 0x72, 0xF9, 0xCD,
-    0xF9, 0xCD, 0xFA, 0x04, 0xFA, 0x80, 0x4A, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x73, 0x74, 0x75,
-    0x79, 0xFF, 0x3A, 0xFF, 0x60, 0xFF, 0x8C, 0xFF, 0xA1, 0xFF, 0xC0, 0xFF, 0xD1, 0xFF, 0xD6, 0xFF,
-    0xE7, 0xFF, 0xF1, 0xFA, 0x13, 0x41, 0x6C, 0xF2, 0xBD, 0xA1, 0x00, 0xF1, 0x74, 0xFC, 0x42, 0x68,
-    0x75, 0xFF, 0xFB, 0xF9, 0xCD, 0x41, 0x66, 0xF9, 0x9A, 0xA1, 0x03, 0xB2, 0x69, 0xFC, 0x41, 0x64,
-    0xF2, 0xC2, 0x41, 0x69, 0xFA, 0x01, 0x42, 0x65, 0x68, 0xF5, 0x73, 0xF9, 0xE2, 0x47, 0x62, 0x67,
-    0x6C, 0x6E, 0x72, 0x73, 0x74, 0xFA, 0x04, 0xFF, 0xE1, 0xFF, 0xEC, 0xFF, 0xF1, 0xF9, 0xAE, 0xFF,
-    0xF5, 0xFF, 0xF9, 0xC2, 0x02, 0x11, 0x67, 0x6E, 0xF9, 0x98, 0xF9, 0x59, 0x41, 0x6F, 0xF2, 0x7C,
-    0x43, 0x61, 0x6E, 0x79, 0xF9, 0x8B, 0xF9, 0x54, 0xF9, 0x54, 0x22, 0x6E, 0x72, 0xF2, 0xF6, 0xC3,
-    0x01, 0xF1, 0x65, 0x67, 0x6F, 0xF2, 0x6C, 0xF9, 0x7C, 0xFF, 0x24, 0x42, 0x63, 0x72, 0xF9, 0x39,
-    0xFA, 0xCF, 0x24, 0x61, 0x65, 0x69, 0x6F, 0xD1, 0xE8, 0xED, 0xF9, 0x41, 0x79, 0xFA, 0x59, 0x41,
-    0x79, 0xF9, 0xB2, 0x44, 0x61, 0x69, 0x6C, 0x73, 0xFF, 0xF8, 0xF9, 0x58, 0xFF, 0xFC, 0xF2, 0x45,
-    0x42, 0x63, 0x64, 0xF9, 0xA1, 0xF9, 0xA1, 0x21, 0x69, 0xF9, 0x43, 0x61, 0x65, 0x73, 0xFA, 0x29,
-    0xF2, 0x2E, 0xF2, 0x2E, 0x41, 0x69, 0xF2, 0x3C, 0x42, 0x69, 0x7A, 0xF2, 0x26, 0xFF, 0xFC, 0x59,
-    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71,
-    0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xF9, 0x32, 0xF9, 0x8C, 0xF9, 0xDB, 0xF9,
-    0xF4, 0xFA, 0x05, 0xFA, 0x3E, 0xFA, 0x57, 0xFA, 0x79, 0xFA, 0x8B, 0xFA, 0x92, 0xFA, 0xF1, 0xFB,
-    0x5D, 0xFC, 0x7A, 0xF8, 0xEA, 0xFC, 0xF6, 0xFD, 0x0F, 0xFD, 0xDF, 0xFE, 0x48, 0xFF, 0x37, 0xFF,
-    0x7E, 0xFF, 0xC3, 0xFF, 0xD4, 0xFF, 0xE8, 0xFF, 0xEB, 0xFF, 0xF9, 0x41, 0x65, 0xF4, 0xC8, 0x21,
-    0x67, 0xFC, 0x41, 0x61, 0xF1, 0xD2, 0x41, 0x67, 0xF1, 0xDA, 0x21, 0x61, 0xFC, 0x43, 0x64, 0x65,
-    0x69, 0xFF, 0xFD, 0xF1, 0xBB, 0xF1, 0xCD, 0xA0, 0x15, 0x12, 0x21, 0x65, 0xFD, 0x21, 0x69, 0xFD,
-    0x21, 0x6E, 0xFD, 0x43, 0x62, 0x69, 0x6F, 0xF4, 0x0F, 0xF5, 0x2A, 0xFF, 0xFD, 0x41, 0x73, 0xF2,
-    0x01, 0x41, 0x79, 0xF8, 0xD7, 0xA1, 0x03, 0xD1, 0x68, 0xFC, 0x41, 0x2E, 0xF2, 0x49, 0x21, 0x72,
-    0xFC, 0x21, 0x65, 0xFD, 0x21, 0x6B, 0xFD, 0x4A, 0x2E, 0x64, 0x67, 0x6C, 0x6E, 0x72, 0x73, 0x74,
-    0x7A, 0x63, 0xFA, 0x49, 0xFF, 0xB8, 0xF9, 0x29, 0xFF, 0xBB, 0xFF, 0xC6, 0xFF, 0xDC, 0xFF, 0xE6,
-    0xFF, 0xEE, 0xF8, 0xEA, 0xFF, 0xFD, 0xC1, 0x02, 0x11, 0x72, 0xF8, 0xB1, 0x42, 0x6E, 0x74, 0xF2,
-    0x55, 0xF1, 0x5C, 0xA2, 0x03, 0xE2, 0x65, 0x69, 0xF3, 0xF9, 0xA0, 0x04, 0x02, 0x42, 0x6B, 0x74,
-    0xF1, 0x45, 0xF2, 0xDA, 0xC3, 0x04, 0x22, 0x61, 0x65, 0x69, 0xF8, 0x57, 0xF8, 0x57, 0xF8, 0x57,
-    0x42, 0x69, 0x75, 0xF8, 0x4B, 0xF8, 0x14, 0xC2, 0x03, 0xD1, 0x69, 0x6F, 0xF8, 0x71, 0xF8, 0x44,
-    0xA0, 0x01, 0x92, 0x42, 0x69, 0x75, 0xF8, 0x30, 0xF8, 0x01, 0x41, 0x72, 0xF7, 0xFA, 0xC2, 0x04,
-    0x42, 0x70, 0x74, 0xF8, 0x2D, 0xFF, 0xFC, 0x41, 0x7A, 0xF1, 0x29, 0xC3, 0x02, 0x71, 0x69, 0x72,
-    0x77, 0xFF, 0xFC, 0xF7, 0xE9, 0xF8, 0x20, 0x41, 0x69, 0xFC, 0xAF, 0x4C, 0x2E, 0x61, 0x64, 0x67,
-    0x6C, 0x6D, 0x6E, 0x73, 0x74, 0x77, 0x79, 0x76, 0xF7, 0xCE, 0xFF, 0xB2, 0xFF, 0xB9, 0xFF, 0xC5,
-    0xFF, 0xCC, 0xFF, 0xD5, 0xFF, 0xD8, 0xFF, 0xE3, 0xFF, 0xF0, 0xF8, 0x10, 0xFB, 0x89, 0xFF, 0xFC,
-    0xA0, 0x02, 0x41, 0xA0, 0x04, 0x62, 0xA0, 0x15, 0x32, 0x21, 0x66, 0xFD, 0xA1, 0x02, 0x31, 0x69,
-    0xFD, 0xC2, 0x02, 0x71, 0x6E, 0x72, 0xF7, 0xA3, 0xF8, 0x30, 0xA0, 0x04, 0x82, 0x41, 0x7A, 0xF7,
-    0xCE, 0x41, 0x62, 0xF2, 0x55, 0x21, 0x61, 0xFC, 0xA2, 0x03, 0xD1, 0x69, 0x6C, 0xF5, 0xFD, 0x41,
-    0x72, 0xF2, 0x1D, 0x43, 0x61, 0x64, 0x65, 0xFF, 0xFC, 0xF0, 0xA5, 0xF7, 0x9C, 0x41, 0x72, 0xF7,
-    0xAE, 0x42, 0x62, 0x68, 0xF7, 0xD7, 0xF0, 0xA3, 0x44, 0x67, 0x75, 0x6D, 0x72, 0xFF, 0xF5, 0xF7,
-    0x6C, 0xF0, 0xA8, 0xFF, 0xF9, 0xA0, 0x04, 0xC2, 0xA0, 0x15, 0x52, 0x21, 0x65, 0xFD, 0x22, 0x6F,
-    0x76, 0xF7, 0xFD, 0xA0, 0x04, 0xE2, 0x21, 0x61, 0xFD, 0xC4, 0x02, 0x81, 0x69, 0x72, 0x75, 0x7A,
-    0xFF, 0xF5, 0xF7, 0x82, 0xFF, 0xFD, 0xF7, 0x43, 0x48, 0x62, 0x64, 0x65, 0x66, 0x6C, 0x6E, 0x6F,
-    0x74, 0xFA, 0x65, 0xFF, 0x94, 0xFF, 0x99, 0xFF, 0xA2, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xD0, 0xFF,
-    0xF1, 0x41, 0x68, 0xF0, 0x6E, 0xA0, 0x15, 0x72, 0x21, 0x64, 0xFD, 0x22, 0x74, 0x6E, 0xF6, 0xFD,
-    0x41, 0x70, 0xF9, 0x00, 0x43, 0x2E, 0x6E, 0x73, 0xF8, 0x25, 0xF0, 0x2E, 0xFF, 0xFC, 0x42, 0x73,
-    0x6E, 0xF7, 0x79, 0xFF, 0xEA, 0xA0, 0x15, 0x92, 0x21, 0x64, 0xFD, 0xA1, 0x01, 0x41, 0x6E, 0xFD,
-    0x41, 0x6E, 0xF4, 0xB7, 0xA5, 0x05, 0x02, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xD7, 0xE0, 0xEA, 0xF7,
-    0xFC, 0xC1, 0x04, 0x62, 0x65, 0xFE, 0x45, 0xC1, 0x02, 0x71, 0x69, 0xF0, 0x13, 0x41, 0x63, 0xF0,
-    0x0D, 0x21, 0x69, 0xFC, 0x41, 0x62, 0xF0, 0x5A, 0xC1, 0x00, 0x51, 0x74, 0xF0, 0x08, 0x21, 0x61,
-    0xFA, 0xA0, 0x15, 0xB2, 0x21, 0x6F, 0xFD, 0x46, 0x2E, 0x61, 0x64, 0x65, 0x69, 0x6E, 0xF8, 0xA9,
-    0xFE, 0x93, 0xEF, 0xF9, 0xF8, 0xA9, 0xF8, 0xA9, 0xFF, 0xFD, 0xA0, 0x05, 0x22, 0xA0, 0x15, 0xD3,
-    0x21, 0x6C, 0xFD, 0x44, 0x61, 0x68, 0x6F, 0x75, 0xF6, 0x99, 0xEF, 0xE6, 0xF7, 0x2E, 0xFF, 0xFD,
-    0x41, 0x64, 0xF1, 0x64, 0x21, 0x6E, 0xFC, 0x4A, 0x64, 0x65, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73,
-    0x74, 0x75, 0xFF, 0xB0, 0xF7, 0x1A, 0xFF, 0xBA, 0xFF, 0xBD, 0xFF, 0xC7, 0xF7, 0xBD, 0xFF, 0xD0,
-    0xFF, 0xE3, 0xFF, 0xEC, 0xFF, 0xFD, 0x41, 0x74, 0xF6, 0x63, 0x41, 0x68, 0xF1, 0x3A, 0x21, 0x74,
-    0xFC, 0x41, 0x71, 0xEF, 0x81, 0x21, 0x73, 0xFC, 0x23, 0x69, 0x6F, 0x75, 0xEE, 0xF6, 0xFD, 0xC1,
-    0x05, 0x43, 0x6F, 0xF1, 0x13, 0xC3, 0x02, 0x41, 0x6C, 0x6F, 0x72, 0xF6, 0xDC, 0xF7, 0x64, 0xF6,
-    0xC2, 0x41, 0x66, 0xEF, 0x6D, 0x41, 0x61, 0xF6, 0xCC, 0xC1, 0x02, 0x31, 0x74, 0xF0, 0x20, 0xA0,
-    0x16, 0x02, 0xA2, 0x00, 0x81, 0x72, 0x73, 0xFD, 0xFD, 0x21, 0x65, 0xF9, 0x41, 0x6E, 0xFA, 0x5C,
-    0x42, 0x65, 0x69, 0xEF, 0x42, 0xFF, 0xFC, 0x43, 0x69, 0x73, 0x74, 0xFF, 0xF2, 0xFF, 0xF9, 0xF8,
-    0x09, 0x41, 0x6F, 0xF7, 0x43, 0x41, 0x2E, 0xF0, 0xD1, 0x21, 0x64, 0xFC, 0x41, 0x65, 0xF4, 0x29,
-    0x45, 0x61, 0x69, 0x6F, 0x65, 0x74, 0xF5, 0xF9, 0xFF, 0xF1, 0xF5, 0xFC, 0xFF, 0xF9, 0xFF, 0xFC,
-    0x48, 0x66, 0x67, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0xFF, 0xB1, 0xFF, 0xB5, 0xF7, 0x27, 0xEF,
-    0xD9, 0xFF, 0xB9, 0xF8, 0x6C, 0xFF, 0xD7, 0xFF, 0xF0, 0xA0, 0x05, 0x72, 0x42, 0x2E, 0x73, 0xF7,
-    0xC4, 0xEE, 0xFC, 0x55, 0x61, 0x62, 0x64, 0x65, 0x66, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E,
-    0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0xFD, 0x74, 0xFD, 0xA0, 0xFD, 0xA7, 0xFD,
-    0xF8, 0xFE, 0x1D, 0xFE, 0x20, 0xFE, 0x95, 0xF7, 0x67, 0xF6, 0x5E, 0xFE, 0xE1, 0xFD, 0xA7, 0xFE,
-    0xEE, 0xFF, 0x44, 0xF5, 0xC6, 0xFF, 0x75, 0xFF, 0x7C, 0xFF, 0x82, 0xFF, 0xDD, 0xF7, 0x67, 0xFF,
-    0xF6, 0xFF, 0xF9, 0x41, 0x6E, 0xEE, 0xC7, 0x42, 0x69, 0x6C, 0xFF, 0xFC, 0xF5, 0xF1, 0xA0, 0x16,
-    0x22, 0x42, 0x6E, 0x6D, 0xF5, 0x83, 0xFF, 0xFD, 0x21, 0x65, 0xF9, 0xA0, 0x04, 0x42, 0xA0, 0x05,
-    0x42, 0x42, 0x61, 0x69, 0xEE, 0x97, 0xF2, 0xFA, 0x43, 0x61, 0x6C, 0x6F, 0xF9, 0x8A, 0xFF, 0xF9,
-    0xF5, 0x61, 0x43, 0x63, 0x73, 0x7A, 0xEE, 0x86, 0xEE, 0x9E, 0xEE, 0x98, 0x45, 0x64, 0x65, 0x69,
-    0x74, 0x79, 0xEE, 0x94, 0xEE, 0x7C, 0xFF, 0xF6, 0xF1, 0x8F, 0xEE, 0x76, 0x41, 0x65, 0xFD, 0x4E,
-    0x41, 0x6D, 0xEE, 0x80, 0x21, 0x6F, 0xFC, 0x42, 0x65, 0x69, 0xEF, 0x70, 0xFC, 0x9F, 0x42, 0x74,
-    0x79, 0xFF, 0xF9, 0xF5, 0x2B, 0x41, 0x76, 0xF5, 0x24, 0xA0, 0x16, 0x43, 0x21, 0x73, 0xFD, 0x43,
-    0x68, 0x69, 0x61, 0xF5, 0xB2, 0xFF, 0xF6, 0xFF, 0xFD, 0x41, 0x6C, 0xEE, 0x57, 0x21, 0x61, 0xFC,
-    0xCC, 0x03, 0xD1, 0x62, 0x63, 0x64, 0x67, 0x68, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x76, 0xFF,
-    0x87, 0xEE, 0x35, 0xFF, 0x98, 0xFF, 0x9B, 0xFF, 0x9E, 0xFF, 0xA8, 0xFF, 0xBC, 0xFF, 0xCC, 0xFF,
-    0xD4, 0xFF, 0xDE, 0xFF, 0xEF, 0xFF, 0xFD, 0x41, 0x70, 0xF2, 0xB4, 0x43, 0x6D, 0x6E, 0x75, 0xFF,
-    0xFC, 0xEE, 0x07, 0xF2, 0x4F, 0xC3, 0x02, 0x21, 0x68, 0x69, 0x6F, 0xF1, 0x70, 0xEE, 0xFC, 0xFF,
-    0xF6, 0x41, 0x6E, 0xF4, 0xC8, 0x42, 0x2E, 0x65, 0xF4, 0xC4, 0xFF, 0xFC, 0x42, 0x2E, 0x6C, 0xF6,
-    0xB4, 0xF5, 0xF8, 0xA0, 0x05, 0x92, 0xC4, 0x03, 0xD1, 0x63, 0x65, 0x69, 0x74, 0xF5, 0xEE, 0xFF,
-    0xFD, 0xF4, 0xB3, 0xF5, 0xEE, 0x41, 0x6D, 0xF4, 0xAF, 0x21, 0x61, 0xFC, 0xC1, 0x02, 0x71, 0x62,
-    0xEF, 0x88, 0x21, 0x69, 0xFA, 0x43, 0x61, 0x73, 0x74, 0xF4, 0x94, 0xFF, 0xFD, 0xED, 0xDB, 0xA0,
-    0x02, 0xF2, 0xA1, 0x00, 0x51, 0x61, 0xFD, 0x4A, 0x2E, 0x64, 0x69, 0x6C, 0x6E, 0x70, 0x72, 0x73,
-    0x74, 0x77, 0xFC, 0xD9, 0xFF, 0xBE, 0xF5, 0xBD, 0xFF, 0xC5, 0xFF, 0xCF, 0xF5, 0xBD, 0xFF, 0xE2,
-    0xFF, 0xEE, 0xFF, 0xFB, 0xED, 0xB1, 0xA0, 0x05, 0xB2, 0x42, 0x63, 0x73, 0xF6, 0x57, 0xF4, 0x8C,
-    0x21, 0x69, 0xF9, 0x22, 0x62, 0x6E, 0xF3, 0xFD, 0x41, 0x70, 0xEF, 0x2C, 0x41, 0x69, 0xF5, 0x88,
-    0x42, 0x2E, 0x73, 0xF4, 0x8B, 0xF4, 0x8B, 0xC6, 0x00, 0xD1, 0x61, 0x64, 0x6C, 0x6D, 0x6E, 0x72,
-    0xFF, 0xF1, 0xF4, 0x42, 0xEE, 0x1C, 0xFF, 0xF5, 0xF8, 0xC7, 0xFF, 0xF9, 0x42, 0x2E, 0x73, 0xF6,
-    0x24, 0xF8, 0x5A, 0xC2, 0x05, 0xD2, 0x65, 0x69, 0xFF, 0xF9, 0xF6, 0x1D, 0x41, 0x76, 0xF0, 0xB5,
-    0x45, 0x6E, 0x6F, 0x74, 0x7A, 0x65, 0xFF, 0xF3, 0xF6, 0x10, 0xF5, 0x54, 0xEE, 0xE6, 0xFF, 0xFC,
-    0xA0, 0x05, 0xF2, 0x41, 0x75, 0xED, 0x47, 0x42, 0x2E, 0x68, 0xF4, 0x02, 0xFF, 0xFC, 0xC7, 0x02,
-    0x41, 0x2E, 0x61, 0x65, 0x69, 0x6F, 0x74, 0x73, 0xF3, 0xFB, 0xFF, 0xA5, 0xFF, 0xB9, 0xFF, 0xE2,
-    0xFF, 0xF2, 0xF7, 0x10, 0xFF, 0xF9, 0xA0, 0x06, 0x12, 0xC2, 0x02, 0x71, 0x62, 0x72, 0xFF, 0xFD,
-    0xED, 0x27, 0x41, 0x72, 0xF3, 0xD7, 0x41, 0x2E, 0xF5, 0xCA, 0x21, 0x63, 0xFC, 0x21, 0x69, 0xFD,
-    0x42, 0x61, 0x69, 0xF4, 0x61, 0xF5, 0x04, 0xC1, 0x01, 0x41, 0x74, 0xF4, 0xFD, 0xC1, 0x02, 0xB1,
-    0x2E, 0xF3, 0xBF, 0xC5, 0x02, 0x41, 0x61, 0x65, 0x67, 0x6F, 0x71, 0xFF, 0xF4, 0xEE, 0x86, 0xFF,
-    0xFA, 0xF5, 0xAD, 0xEE, 0x83, 0x43, 0x65, 0x68, 0x69, 0xF3, 0xA4, 0xF3, 0xE6, 0xF5, 0x83, 0x42,
-    0x61, 0x69, 0xF3, 0x9A, 0xF3, 0x9A, 0x21, 0x74, 0xF9, 0x41, 0x7A, 0xEC, 0xD1, 0xA1, 0x03, 0xE2,
-    0x69, 0xFC, 0xA0, 0x10, 0x42, 0x21, 0x72, 0xFD, 0x21, 0x61, 0xFD, 0xCE, 0x03, 0xD1, 0x61, 0x63,
-    0x65, 0x66, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x73, 0x74, 0x7A, 0x67, 0xFF, 0x9E, 0xF3, 0x89,
-    0xFF, 0xA7, 0xFF, 0xB2, 0xF3, 0x7E, 0xFF, 0xB5, 0xFB, 0xD5, 0xFF, 0xC8, 0xED, 0x17, 0xFF, 0xDA,
-    0xFF, 0xEB, 0xFF, 0xF2, 0xF5, 0x75, 0xFF, 0xFD, 0xC1, 0x01, 0xF1, 0x69, 0xF3, 0x93, 0x41, 0x6F,
-    0xF3, 0x4E, 0x21, 0x69, 0xFC, 0x21, 0x74, 0xFD, 0xC2, 0x01, 0x91, 0x61, 0x65, 0xFF, 0xFD, 0xF5,
-    0x38, 0x21, 0x72, 0xF7, 0x42, 0x6D, 0x61, 0xEC, 0x64, 0xEC, 0x67, 0x42, 0x63, 0x6D, 0xF3, 0x2E,
-    0xEC, 0x57, 0xC4, 0x06, 0x33, 0x61, 0x65, 0x69, 0x79, 0xFF, 0xEF, 0xFF, 0xF2, 0xFF, 0xF9, 0xEC,
-    0x56, 0xC1, 0x02, 0x41, 0x72, 0xF3, 0xB0, 0x41, 0x63, 0xF3, 0x54, 0xA1, 0x00, 0x51, 0x6E, 0xFC,
-    0xC1, 0x02, 0xE1, 0x72, 0xEC, 0x4A, 0x42, 0x69, 0x6F, 0xEC, 0x4A, 0xFF, 0xFA, 0x44, 0x61, 0x65,
-    0x67, 0x74, 0xEC, 0x2B, 0xF4, 0x1C, 0xEC, 0x3D, 0xEC, 0x43, 0xA0, 0x16, 0x73, 0x21, 0x6E, 0xFD,
-    0x21, 0x6F, 0xFD, 0x44, 0x61, 0x69, 0x6C, 0x68, 0xF3, 0x28, 0xFC, 0x1A, 0xF3, 0x7E, 0xFF, 0xFD,
-    0x41, 0x6E, 0xED, 0x97, 0x42, 0x62, 0x6F, 0xF2, 0xD5, 0xFF, 0xFC, 0xC1, 0x00, 0x61, 0x65, 0xEB,
-    0xF7, 0x42, 0x65, 0x69, 0xEC, 0x0F, 0xF2, 0xD3, 0x41, 0x74, 0xEC, 0xAE, 0x21, 0x73, 0xFC, 0xCE,
-    0x03, 0xD1, 0x61, 0x65, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x76, 0x77, 0x7A, 0x75,
-    0xF2, 0xF4, 0xED, 0x87, 0xFF, 0xA2, 0xFF, 0xAC, 0xFF, 0xB7, 0xFA, 0x1C, 0xFF, 0xBE, 0xFF, 0xD4,
-    0xFF, 0xE5, 0xEC, 0x26, 0xFF, 0xEC, 0xEC, 0x7C, 0xFF, 0xF2, 0xFF, 0xFD, 0x41, 0x63, 0xF4, 0x84,
-    0x42, 0x2E, 0x69, 0xF4, 0x80, 0xFF, 0xFC, 0x42, 0x73, 0x74, 0xF0, 0x9C, 0xFF, 0xF9, 0x41, 0x61,
-    0xFA, 0xD5, 0x44, 0x61, 0x64, 0x74, 0x76, 0xEB, 0xBB, 0xF4, 0x6E, 0xFF, 0xFC, 0xEB, 0xA6, 0xC1,
-    0x02, 0xE1, 0x65, 0xEB, 0xAB, 0x21, 0x69, 0xFA, 0xC4, 0x00, 0xD1, 0x66, 0x6E, 0x73, 0x74, 0xEB,
-    0xA8, 0xF3, 0x81, 0xEB, 0x8A, 0xFF, 0xFD, 0x42, 0x6C, 0x6F, 0xEB, 0x81, 0xEB, 0xA2, 0xA0, 0x16,
-    0xA2, 0x21, 0x64, 0xFD, 0x21, 0x6F, 0xFD, 0x41, 0x6F, 0xEE, 0x54, 0x21, 0x63, 0xFC, 0x44, 0x70,
-    0x73, 0x63, 0x65, 0xFF, 0xE9, 0xEC, 0x01, 0xFF, 0xF6, 0xFF, 0xFD, 0x45, 0x61, 0x65, 0x69, 0x6F,
-    0x75, 0xFF, 0xAC, 0xFF, 0xB7, 0xFF, 0xCD, 0xFF, 0xF3, 0xF0, 0x5A, 0xA0, 0x06, 0x63, 0x42, 0x67,
-    0x74, 0xF2, 0x26, 0xF2, 0x1E, 0x42, 0x62, 0x6E, 0xEB, 0x43, 0xFF, 0xF9, 0x41, 0x75, 0xF3, 0x2D,
-    0x42, 0x63, 0x6D, 0xFF, 0xFC, 0xEC, 0xCA, 0xA0, 0x16, 0xC3, 0x21, 0x63, 0xFD, 0x21, 0x65, 0xFD,
-    0x21, 0x6D, 0xFD, 0x21, 0x6F, 0xFD, 0xC6, 0x03, 0xE2, 0x61, 0x65, 0x69, 0x75, 0x77, 0x72, 0xFF,
-    0xDF, 0xF9, 0xC0, 0xFF, 0xEA, 0xEB, 0x25, 0xF3, 0x13, 0xFF, 0xFD, 0xC1, 0x01, 0x41, 0x74, 0xF3,
-    0x5C, 0x41, 0x73, 0xEB, 0x07, 0x42, 0x69, 0x75, 0xFF, 0xFC, 0xF3, 0x0F, 0x42, 0x69, 0x74, 0xF3,
-    0xC4, 0xFF, 0xF9, 0x43, 0x61, 0x65, 0x69, 0xF4, 0xFA, 0xF2, 0x44, 0xF2, 0x5E, 0x42, 0x69, 0x79,
-    0xF1, 0xFE, 0xF1, 0xC7, 0xA0, 0x06, 0x92, 0xA0, 0x16, 0xF3, 0x21, 0x65, 0xFD, 0x21, 0x63, 0xFD,
-    0x22, 0x62, 0x6E, 0xF4, 0xFD, 0x42, 0x61, 0x69, 0xFF, 0xFB, 0xF3, 0xE6, 0xC1, 0x03, 0xD1, 0x73,
-    0xEB, 0x8D, 0x42, 0x65, 0x76, 0xF2, 0x2F, 0xFB, 0xC7, 0xC2, 0x06, 0xB2, 0x69, 0x72, 0xFF, 0xF9,
-    0xF1, 0x90, 0x4A, 0x64, 0x66, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0xEA, 0xCE, 0xF2,
-    0xA7, 0xFF, 0xA9, 0xFF, 0xBA, 0xFF, 0xC1, 0xF2, 0xC2, 0xFF, 0xCB, 0xFF, 0xE3, 0xFF, 0xEA, 0xFF,
-    0xF7, 0xA0, 0x03, 0xD1, 0x50, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6E, 0x6F, 0x71, 0x72,
-    0x73, 0x74, 0x75, 0x79, 0x7A, 0xFC, 0x5C, 0xFC, 0x91, 0xFC, 0xE3, 0xFD, 0x6A, 0xFD, 0xE7, 0xFE,
-    0x14, 0xFE, 0x3E, 0xF1, 0x68, 0xFE, 0xAB, 0xF3, 0x06, 0xFF, 0x37, 0xFF, 0x47, 0xFF, 0x72, 0xFF,
-    0xDE, 0xFF, 0xFD, 0xEA, 0xD1, 0xA0, 0x06, 0xF3, 0xA0, 0x07, 0x22, 0x41, 0x67, 0xEA, 0x6F, 0x43,
-    0x64, 0x6B, 0x79, 0xEA, 0x7A, 0xEA, 0x7A, 0xF1, 0x2A, 0x41, 0x62, 0xED, 0x77, 0xC3, 0x02, 0x71,
-    0x69, 0x6F, 0x61, 0xFB, 0xF8, 0xF1, 0x1C, 0xFF, 0xFC, 0xC1, 0x05, 0x22, 0x65, 0xEA, 0x57, 0x41,
-    0x65, 0xF9, 0x7B, 0x21, 0x6E, 0xFC, 0x21, 0x6F, 0xFD, 0xCC, 0x06, 0xD2, 0x2E, 0x62, 0x63, 0x66,
-    0x67, 0x6D, 0x6E, 0x72, 0x74, 0x76, 0x79, 0x6C, 0xF2, 0xF7, 0xFF, 0xCC, 0xEA, 0x2C, 0xF1, 0x00,
-    0xF9, 0x57, 0xFF, 0xCF, 0xFF, 0xD2, 0xFF, 0xD6, 0xFF, 0xE4, 0xFF, 0xF0, 0xF2, 0xF7, 0xFF, 0xFD,
-    0x41, 0x62, 0xF1, 0x05, 0xA0, 0x09, 0xA2, 0x21, 0x62, 0xFD, 0xA2, 0x07, 0x42, 0x61, 0x69, 0xF6,
-    0xFD, 0x41, 0x73, 0xF2, 0x96, 0x42, 0x66, 0x6C, 0xEA, 0x14, 0xFF, 0xFC, 0x42, 0x69, 0x6F, 0xEA,
-    0x07, 0xF1, 0x6E, 0x41, 0x6E, 0xEF, 0x2E, 0x41, 0x6C, 0xF1, 0x4A, 0xA0, 0x17, 0x22, 0x21, 0x72,
-    0xFD, 0x41, 0x61, 0xFC, 0xC5, 0x21, 0x6E, 0xFC, 0x22, 0x61, 0x69, 0xF6, 0xFD, 0x44, 0x61, 0x69,
-    0x6F, 0x6C, 0xFF, 0xE6, 0xFF, 0xEA, 0xFB, 0xF8, 0xFF, 0xFB, 0xA0, 0x03, 0xE2, 0x41, 0x2E, 0xF0,
-    0x8C, 0x41, 0x66, 0xF0, 0x93, 0xA0, 0x07, 0x62, 0x42, 0x65, 0x71, 0xE9, 0xAA, 0xFF, 0xFD, 0x42,
-    0x69, 0x6F, 0xFF, 0xF9, 0xF0, 0x85, 0xC1, 0x02, 0x71, 0x2E, 0xE9, 0xBA, 0x42, 0x63, 0x6C, 0xFF,
-    0xFA, 0xF0, 0x78, 0x41, 0x73, 0xF0, 0xFE, 0x43, 0x6E, 0x72, 0x73, 0xFF, 0xFC, 0xE9, 0xB8, 0xF3,
-    0x96, 0xC3, 0x01, 0x41, 0x2E, 0x69, 0x6F, 0xF2, 0x4F, 0xFF, 0xEB, 0xFF, 0xF6, 0x41, 0x66, 0xE9,
-    0xA2, 0x21, 0x69, 0xFC, 0xC4, 0x03, 0xD1, 0x61, 0x6F, 0x74, 0x75, 0xF3, 0x86, 0xF0, 0x87, 0xFF,
-    0xFD, 0xF0, 0x87, 0xC3, 0x01, 0xF1, 0x61, 0x69, 0x75, 0xF0, 0x78, 0xE9, 0x5F, 0xF3, 0x6A, 0x41,
-    0x7A, 0xE9, 0x7A, 0x21, 0x69, 0xFC, 0x44, 0x68, 0x6D, 0x6E, 0x73, 0xF1, 0x43, 0xF2, 0x1A, 0xFF,
-    0xFD, 0xE9, 0x6A, 0x42, 0x69, 0x72, 0xE9, 0x57, 0xF0, 0x58, 0xC6, 0x00, 0xD1, 0x2E, 0x63, 0x6F,
-    0x74, 0x75, 0x69, 0xF0, 0x6F, 0xF0, 0x7E, 0xFC, 0x2C, 0xFF, 0xF9, 0xF0, 0xA7, 0xF9, 0x43, 0x41,
-    0x63, 0xF3, 0x2E, 0xC2, 0x01, 0xF1, 0x6F, 0x69, 0xF3, 0x2A, 0xFF, 0xFC, 0x41, 0x6C, 0xE9, 0x2E,
-    0xA1, 0x01, 0xF1, 0x69, 0xFC, 0xA0, 0x17, 0x42, 0x21, 0x69, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x69,
-    0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0x52, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x69, 0x6C,
-    0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x79, 0x66, 0xF8, 0x29, 0xFF, 0x0E, 0xFF, 0x15,
-    0xFF, 0x36, 0xFF, 0x43, 0xFF, 0x46, 0xFF, 0x4A, 0xFF, 0x58, 0xFF, 0x7A, 0xFF, 0x8D, 0xFF, 0x9C,
-    0xF0, 0x50, 0xFF, 0xAF, 0xFF, 0xC3, 0xFF, 0xDC, 0xFF, 0xE9, 0xEF, 0xD2, 0xFF, 0xFD, 0xA0, 0x02,
-    0x22, 0x21, 0x74, 0xFD, 0x44, 0x61, 0x65, 0x69, 0x79, 0xF0, 0xB5, 0xFF, 0xFD, 0xF0, 0x04, 0xEF,
-    0xF5, 0xA0, 0x07, 0x82, 0xC1, 0x07, 0xA3, 0x62, 0xE8, 0xCC, 0x42, 0x6D, 0x69, 0xF0, 0x17, 0xE9,
-    0x10, 0x43, 0x61, 0x65, 0x74, 0xFF, 0xF9, 0xF0, 0x98, 0xF0, 0xB3, 0xA0, 0x07, 0xD2, 0x21, 0x6E,
-    0xFD, 0x41, 0x72, 0xE9, 0x2A, 0xA1, 0x02, 0xB1, 0x66, 0xFC, 0x41, 0x74, 0xF2, 0x96, 0x21, 0x61,
-    0xFC, 0x41, 0x2E, 0xF0, 0x93, 0xC1, 0x02, 0xE1, 0x7A, 0xEF, 0x5F, 0xC3, 0x02, 0xB1, 0x61, 0x65,
-    0x69, 0xFD, 0xE6, 0xFF, 0xF6, 0xFF, 0xFA, 0xC1, 0x03, 0xD1, 0x67, 0xE8, 0x89, 0xC2, 0x01, 0xF1,
-    0x6E, 0x72, 0xF2, 0x70, 0xF2, 0x70, 0xC2, 0x00, 0xD1, 0x65, 0x74, 0xFF, 0xF7, 0xEB, 0xD3, 0xA0,
-    0x07, 0xF2, 0xC2, 0x00, 0x61, 0x69, 0x74, 0xF1, 0x1E, 0xFF, 0xFD, 0x41, 0x69, 0xEF, 0x7E, 0xA0,
-    0x08, 0x12, 0xA0, 0x0F, 0x02, 0x21, 0x79, 0xFD, 0x21, 0x68, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x65,
-    0xFD, 0x50, 0x2E, 0x61, 0x63, 0x64, 0x65, 0x66, 0x67, 0x6C, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74,
-    0x76, 0x6D, 0xF0, 0xFF, 0xFF, 0x83, 0xFF, 0x90, 0xF0, 0x43, 0xFF, 0x9D, 0xFF, 0xA4, 0xF1, 0x8B,
-    0xFF, 0xAD, 0xFF, 0xBA, 0xFF, 0xC6, 0xFE, 0x56, 0xFF, 0xD5, 0xFF, 0xE1, 0xFF, 0xEA, 0xFF, 0xEE,
-    0xFF, 0xFD, 0xA0, 0x05, 0x52, 0x42, 0x2E, 0x73, 0xF0, 0x0F, 0xEE, 0xD4, 0x41, 0x64, 0xFE, 0x3E,
-    0x44, 0x2E, 0x64, 0x73, 0x61, 0xF0, 0x04, 0xF0, 0x04, 0xFF, 0xF5, 0xFF, 0xFC, 0xA0, 0x17, 0x63,
-    0x21, 0x65, 0xFD, 0x46, 0x61, 0x65, 0x6F, 0x75, 0x79, 0x69, 0xF8, 0xE6, 0xFF, 0xED, 0xF7, 0x27,
-    0xF8, 0xE6, 0xF7, 0x0D, 0xFF, 0xFD, 0xA0, 0x08, 0x33, 0x43, 0x61, 0x69, 0x6F, 0xEF, 0x38, 0xE7,
-    0xC9, 0xF6, 0xB1, 0x41, 0x69, 0xF6, 0xB4, 0x42, 0x61, 0x69, 0xF2, 0xBB, 0xE7, 0xBB, 0x41, 0x64,
-    0xE7, 0xCC, 0x41, 0x70, 0xE7, 0xB6, 0x41, 0x74, 0xF8, 0xB3, 0xA0, 0x17, 0x92, 0x21, 0x64, 0xFD,
-    0x21, 0x72, 0xFD, 0x21, 0x6F, 0xFD, 0xD0, 0x03, 0xD1, 0x2E, 0x64, 0x65, 0x66, 0x67, 0x6C, 0x6D,
-    0x6E, 0x6F, 0x70, 0x72, 0x73, 0x75, 0x76, 0x78, 0x77, 0xEF, 0xAE, 0xF2, 0xF8, 0xF0, 0x6A, 0xF9,
-    0x08, 0xEF, 0x93, 0xFF, 0xD3, 0xFF, 0xDD, 0xFF, 0xE1, 0xFF, 0xE8, 0xFF, 0xEC, 0xEF, 0x93, 0xEF,
-    0xAE, 0xFF, 0xF0, 0xEF, 0x0B, 0xEF, 0xAE, 0xFF, 0xFD, 0x41, 0x6F, 0xEB, 0xD2, 0x42, 0x67, 0x69,
-    0xFF, 0xFC, 0xEE, 0x3C, 0xA0, 0x17, 0xB2, 0x21, 0x6C, 0xFD, 0xA1, 0x02, 0xE1, 0x61, 0xFD, 0xC2,
-    0x00, 0x51, 0x61, 0x6E, 0xE8, 0x68, 0xFF, 0xFB, 0x41, 0x61, 0xF7, 0x0D, 0x21, 0x74, 0xFC, 0xA0,
-    0x17, 0xD3, 0x21, 0x67, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6C, 0xFD, 0x44, 0x62, 0x6C, 0x66, 0x70,
-    0xE7, 0x3D, 0xE7, 0x37, 0xFF, 0xF1, 0xFF, 0xFD, 0xA0, 0x18, 0x02, 0x21, 0x64, 0xFD, 0x21, 0x65,
-    0xFD, 0x43, 0x70, 0x77, 0x6D, 0xE7, 0x27, 0xED, 0xF8, 0xFF, 0xFD, 0x41, 0x69, 0xEF, 0xE5, 0x21,
-    0x6C, 0xFC, 0x21, 0x70, 0xFD, 0xC6, 0x03, 0xD1, 0x61, 0x65, 0x69, 0x6F, 0x75, 0x79, 0xFF, 0xA8,
-    0xFF, 0xBA, 0xFF, 0xD6, 0xFF, 0xEC, 0xFF, 0xFD, 0xED, 0xE4, 0xC3, 0x08, 0x63, 0x70, 0x77, 0x79,
-    0xEE, 0x67, 0xEE, 0xEF, 0xEE, 0xEF, 0x41, 0x62, 0xEE, 0x41, 0x42, 0x68, 0x61, 0xEE, 0x1F, 0xFF,
-    0xFC, 0x41, 0x2E, 0xF0, 0xEC, 0xA1, 0x08, 0x92, 0x6C, 0xFC, 0x42, 0x2E, 0x73, 0xED, 0xAF, 0xED,
-    0xAF, 0xC3, 0x02, 0x81, 0x61, 0x65, 0x74, 0xEF, 0x49, 0xE9, 0xD2, 0xFF, 0xF9, 0x41, 0x65, 0xEE,
-    0x1A, 0x41, 0x62, 0xE7, 0x04, 0xC1, 0x01, 0x91, 0x65, 0xEE, 0x2C, 0xA0, 0x18, 0x23, 0x21, 0x6C,
-    0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x70, 0xFD, 0xC9, 0x03, 0xD1, 0x61, 0x63, 0x65, 0x67, 0x6C, 0x6D,
-    0x6E, 0x70, 0x6F, 0xFF, 0xCE, 0xFF, 0xDA, 0xEE, 0xAC, 0xEE, 0x1A, 0xFF, 0xE6, 0xFF, 0xEA, 0xEE,
-    0x1A, 0xFF, 0xEE, 0xFF, 0xFD, 0x42, 0x65, 0x70, 0xED, 0xFC, 0xE6, 0xAB, 0xC2, 0x02, 0x11, 0x6E,
-    0x73, 0xEF, 0x54, 0xFF, 0xF9, 0x57, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A,
-    0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0xFC, 0x54, 0xEE,
-    0xF5, 0xED, 0x57, 0xFC, 0x85, 0xFD, 0x82, 0xF5, 0x35, 0xFD, 0xBF, 0xFD, 0xCC, 0xFE, 0x4C, 0xEE,
-    0xF5, 0xFE, 0x7D, 0xFE, 0x9E, 0xEE, 0xF5, 0xFE, 0xB1, 0xFE, 0xE1, 0xEE, 0xF5, 0xFF, 0x70, 0xFF,
-    0x85, 0xFF, 0x95, 0xFF, 0xD2, 0xEE, 0xF5, 0xEE, 0xF5, 0xFF, 0xF7, 0xA0, 0x07, 0x42, 0xC1, 0x00,
-    0x61, 0x69, 0xEA, 0x57, 0xC1, 0x02, 0x31, 0x72, 0xED, 0x10, 0x21, 0x65, 0xFA, 0xC2, 0x02, 0x31,
-    0x65, 0x6F, 0xE9, 0x26, 0xF8, 0xF6, 0x41, 0x65, 0xE8, 0xC2, 0xA0, 0x0B, 0xA2, 0x21, 0x73, 0xFD,
-    0x21, 0x65, 0xFD, 0x42, 0x64, 0x69, 0xEC, 0xE9, 0xFF, 0xFD, 0x42, 0x63, 0x6C, 0xE6, 0x0E, 0xE6,
-    0x0E, 0xC1, 0x00, 0xD1, 0x65, 0xE7, 0x96, 0x46, 0x61, 0x63, 0x65, 0x69, 0x6B, 0x74, 0xE6, 0x13,
-    0xE6, 0x01, 0xF0, 0xD7, 0xFF, 0xF3, 0xE6, 0x19, 0xFF, 0xFA, 0x43, 0x70, 0x73, 0x74, 0xEC, 0xCA,
-    0xED, 0x3D, 0xE7, 0x7D, 0x41, 0x66, 0xEC, 0xB8, 0xA0, 0x07, 0xB2, 0xC4, 0x02, 0x81, 0x65, 0x68,
-    0x69, 0x75, 0xE8, 0xAE, 0xE7, 0x6F, 0xFF, 0xF9, 0xFF, 0xFD, 0xC3, 0x02, 0x81, 0x65, 0x69, 0x6F,
-    0xF7, 0x19, 0xE5, 0xE6, 0xE5, 0xE6, 0x4B, 0x62, 0x63, 0x64, 0x67, 0x6C, 0x6D, 0x6E, 0x72, 0x73,
-    0x74, 0x76, 0xFF, 0x85, 0xF1, 0x45, 0xFF, 0x88, 0xFF, 0x94, 0xFF, 0x97, 0xFF, 0xA0, 0xFF, 0xAD,
-    0xFF, 0xC1, 0xFF, 0xD4, 0xFF, 0xE5, 0xFF, 0xF4, 0x42, 0x2E, 0x73, 0xED, 0x91, 0xED, 0x91, 0x42,
-    0x6C, 0x6E, 0xFF, 0xF9, 0xED, 0x8A, 0x41, 0x74, 0xED, 0x83, 0xC3, 0x03, 0xE2, 0x65, 0x69, 0x72,
-    0xFF, 0xF5, 0xFF, 0xFC, 0xEC, 0xDD, 0x42, 0x64, 0x6E, 0xED, 0x73, 0xE6, 0x59, 0x41, 0x73, 0xEE,
-    0x8E, 0xA1, 0x02, 0xB1, 0x73, 0xFC, 0x42, 0x63, 0x65, 0xEC, 0x6C, 0xEC, 0x4E, 0x42, 0x69, 0x79,
-    0xFF, 0xF9, 0xEC, 0x47, 0xC1, 0x00, 0x51, 0x65, 0xEC, 0x38, 0xC4, 0x02, 0x81, 0x62, 0x66, 0x6D,
-    0x74, 0xED, 0x4F, 0xFF, 0xF3, 0xEC, 0x71, 0xFF, 0xFA, 0x41, 0x6D, 0xED, 0x40, 0x42, 0x61, 0x75,
-    0xFF, 0xFC, 0xEE, 0x40, 0x41, 0x65, 0xED, 0x35, 0x42, 0x6D, 0x70, 0xED, 0x31, 0xFF, 0xFC, 0xC2,
-    0x02, 0x11, 0x61, 0x6F, 0xEC, 0x4C, 0xE5, 0x51, 0x44, 0x6C, 0x6D, 0x6E, 0x72, 0xEC, 0x61, 0xFF,
-    0xF0, 0xF1, 0x37, 0xFF, 0xF7, 0xA1, 0x02, 0xB1, 0x65, 0xD4, 0x42, 0x61, 0x65, 0xEC, 0xA0, 0xEC,
-    0x87, 0xC1, 0x01, 0x41, 0x61, 0xEC, 0x2A, 0xA1, 0x02, 0xB1, 0x6C, 0xFA, 0x41, 0x61, 0xEE, 0xBD,
-    0x4A, 0x61, 0x63, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x74, 0x75, 0x68, 0xFF, 0x86, 0xE8, 0x75, 0xFF,
-    0x91, 0xFF, 0xAA, 0xFF, 0xBD, 0xFF, 0xD8, 0xFF, 0xE5, 0xFF, 0xEA, 0xFF, 0xF7, 0xFF, 0xFC, 0xA0,
-    0x03, 0x42, 0x42, 0x72, 0x73, 0xEE, 0x94, 0xE4, 0xE6, 0xC6, 0x01, 0x91, 0x61, 0x62, 0x63, 0x6D,
-    0x74, 0x7A, 0xEC, 0x2E, 0xEB, 0xF2, 0xEC, 0x6E, 0xEB, 0xF2, 0xEC, 0x1F, 0xE4, 0xF7, 0xC2, 0x01,
-    0x91, 0x6C, 0x6E, 0xEC, 0xBB, 0xE5, 0x85, 0x41, 0x67, 0xEC, 0x01, 0x21, 0x6E, 0xFC, 0xC2, 0x01,
-    0x41, 0x6F, 0x69, 0xEB, 0x96, 0xFF, 0xFD, 0x21, 0x6C, 0xF7, 0x41, 0x6C, 0xE4, 0xBA, 0x48, 0x61,
-    0x64, 0x65, 0x69, 0x6F, 0x72, 0x75, 0x67, 0xFF, 0xC1, 0xF7, 0x18, 0xFF, 0xC4, 0xFF, 0xCB, 0xFF,
-    0xE0, 0xED, 0x34, 0xFF, 0xF9, 0xFF, 0xFC, 0x42, 0x69, 0x79, 0xE4, 0xA3, 0xEB, 0xFA, 0xA0, 0x08,
-    0xB2, 0xC1, 0x02, 0x82, 0x74, 0xE4, 0x81, 0x4A, 0x63, 0x64, 0x66, 0x6C, 0x6D, 0x6E, 0x70, 0x73,
-    0x74, 0x78, 0xEE, 0x86, 0xE7, 0x60, 0xEE, 0x86, 0xFF, 0xF0, 0xEE, 0x86, 0xF5, 0x1E, 0xFF, 0xF7,
-    0xFF, 0xFA, 0xF2, 0x38, 0xEB, 0x55, 0x41, 0x65, 0xFE, 0x82, 0x21, 0x72, 0xFC, 0xC1, 0x01, 0x41,
-    0x69, 0xED, 0x23, 0x41, 0x65, 0xEB, 0x52, 0x21, 0x74, 0xFC, 0x42, 0x65, 0x69, 0xEB, 0x9D, 0xFF,
-    0xFD, 0x44, 0x63, 0x6C, 0x6E, 0x74, 0xFF, 0xEC, 0xE4, 0x41, 0xFF, 0xF9, 0xEC, 0x53, 0x41, 0x65,
-    0xEA, 0x0C, 0x21, 0x72, 0xFC, 0x41, 0x2E, 0xEC, 0x24, 0x21, 0x65, 0xFC, 0x21, 0x73, 0xFD, 0xC5,
-    0x02, 0xB1, 0x65, 0x66, 0x69, 0x6F, 0x75, 0xFF, 0xCB, 0xF9, 0x92, 0xFF, 0xE2, 0xFF, 0xF3, 0xFF,
-    0xFD, 0x41, 0x6C, 0xEA, 0xE8, 0xA0, 0x08, 0xD2, 0x44, 0x62, 0x63, 0x6E, 0x74, 0xEA, 0xEC, 0xEB,
-    0x79, 0xEB, 0x1B, 0xFF, 0xFD, 0x42, 0x6C, 0x72, 0xEB, 0x43, 0xEA, 0xD7, 0x47, 0x61, 0x65, 0x69,
-    0x6E, 0x6F, 0x75, 0x79, 0xFF, 0xE5, 0xE5, 0x96, 0xFF, 0xEC, 0xEA, 0xD8, 0xFE, 0x5C, 0xFF, 0xF9,
-    0xEC, 0xC4, 0xC1, 0x07, 0x42, 0x65, 0xE5, 0x80, 0xC1, 0x00, 0xD1, 0x6C, 0xEA, 0xBC, 0x43, 0x66,
-    0x67, 0x73, 0xEB, 0x29, 0xEC, 0x4C, 0xEB, 0x22, 0x43, 0x65, 0x68, 0x79, 0xE3, 0xE2, 0xEA, 0xE3,
-    0xEA, 0xA4, 0xC7, 0x02, 0x81, 0x63, 0x64, 0x67, 0x6D, 0x6E, 0x72, 0x74, 0xEA, 0x9A, 0xEA, 0xA2,
-    0xFF, 0xE6, 0xFC, 0xD4, 0xFF, 0xEC, 0xE8, 0xC3, 0xFF, 0xF6, 0xC1, 0x01, 0x41, 0x69, 0xEA, 0x8A,
-    0x21, 0x64, 0xFA, 0xA1, 0x02, 0xB1, 0x75, 0xFD, 0x41, 0x6E, 0xE3, 0xA0, 0x42, 0x69, 0x6C, 0xFF,
-    0xFC, 0xF4, 0x39, 0x41, 0x64, 0xE3, 0x8F, 0x41, 0x69, 0xEC, 0x3D, 0x41, 0x61, 0xE8, 0xD6, 0xC6,
-    0x02, 0xB1, 0x2E, 0x63, 0x6E, 0x74, 0x77, 0x78, 0xEB, 0x7A, 0xEB, 0x7A, 0xFF, 0xF4, 0xFF, 0xF8,
-    0xEB, 0x7A, 0xFF, 0xFC, 0x41, 0x72, 0xEC, 0x87, 0x48, 0x61, 0x62, 0x63, 0x64, 0x67, 0x6E, 0x72,
-    0x73, 0xEA, 0xBF, 0xFF, 0xFC, 0xEC, 0x38, 0xEB, 0x61, 0xEA, 0xFF, 0xEA, 0x44, 0xED, 0x1E, 0xEB,
-    0xE2, 0x42, 0x2E, 0x61, 0xEC, 0x50, 0xEA, 0x6A, 0x41, 0x67, 0xFD, 0x70, 0xC1, 0x02, 0x11, 0x68,
-    0xEA, 0x28, 0xA0, 0x08, 0xF2, 0x41, 0x73, 0xE9, 0xA3, 0x21, 0x69, 0xFC, 0xCA, 0x02, 0x81, 0x62,
-    0x63, 0x65, 0x67, 0x6D, 0x6E, 0x6F, 0x73, 0x76, 0x74, 0xFC, 0x71, 0xFF, 0xE5, 0xED, 0xDD, 0xF0,
-    0x96, 0xEA, 0x10, 0xFF, 0xEC, 0xEA, 0x8B, 0xFF, 0xF0, 0xFF, 0xF6, 0xFF, 0xFD, 0xC1, 0x01, 0x91,
-    0x62, 0xEA, 0x84, 0x42, 0x61, 0x6F, 0xFF, 0xFA, 0xE3, 0x0F, 0x44, 0x63, 0x67, 0x70, 0x61, 0xE9,
-    0xE2, 0xE9, 0xEA, 0xEF, 0x7B, 0xEB, 0x80, 0x41, 0x68, 0xED, 0x06, 0x42, 0x64, 0x67, 0xE9, 0xD1,
-    0xE9, 0xD9, 0x49, 0x61, 0x65, 0x66, 0x69, 0x6C, 0x6F, 0x73, 0x74, 0x75, 0xFF, 0x6D, 0xFF, 0x86,
-    0xEC, 0xFB, 0xFF, 0xBA, 0xFF, 0xE1, 0xFF, 0xE8, 0xFF, 0xF5, 0xF3, 0x93, 0xFF, 0xF9, 0xC1, 0x01,
-    0x71, 0x61, 0xE9, 0xB6, 0x43, 0x63, 0x67, 0x6E, 0xEA, 0xC5, 0xEA, 0xC5, 0xFF, 0xFA, 0xC2, 0x02,
-    0xB1, 0x6C, 0x74, 0xE9, 0xFB, 0xEA, 0xBB, 0xC2, 0x09, 0x12, 0x65, 0x69, 0xE9, 0x9D, 0xEC, 0x76,
-    0xC2, 0x01, 0x41, 0x68, 0x73, 0xE9, 0x94, 0xE9, 0x8C, 0x46, 0x63, 0x65, 0x67, 0x6E, 0x73, 0x7A,
-    0xEA, 0x3E, 0xE2, 0xAF, 0xFF, 0x3B, 0xFF, 0xEE, 0xFF, 0xF7, 0xE9, 0xC2, 0x41, 0x6F, 0xE2, 0xC3,
-    0x21, 0x69, 0xFC, 0x42, 0x67, 0x6E, 0xE2, 0x95, 0xFF, 0xFD, 0xC1, 0x01, 0x41, 0x61, 0xE9, 0x6A,
-    0x42, 0x6C, 0x6E, 0xFF, 0xFA, 0xE2, 0x9A, 0x49, 0x61, 0x62, 0x65, 0x69, 0x6E, 0x6F, 0x70, 0x75,
-    0x79, 0xFF, 0xAD, 0xE9, 0x5D, 0xFF, 0xB7, 0xFF, 0xD2, 0xEC, 0x72, 0xFF, 0xEC, 0xEA, 0x90, 0xFF,
-    0xF9, 0xE9, 0xD0, 0x42, 0x6D, 0x6E, 0xEC, 0xF1, 0xFC, 0xD3, 0x41, 0x65, 0xE3, 0xF8, 0x21, 0x68,
-    0xFC, 0x42, 0x63, 0x78, 0xE9, 0x6A, 0xE9, 0x97, 0x21, 0x69, 0xF9, 0x42, 0x69, 0x74, 0xE9, 0x29,
-    0xE9, 0x29, 0x47, 0x61, 0x65, 0x6D, 0x72, 0x73, 0x74, 0x77, 0xE9, 0x1A, 0xE9, 0x1A, 0xE9, 0x59,
-    0xEC, 0xD2, 0xFF, 0xF9, 0xF1, 0xAB, 0xE9, 0x95, 0x48, 0x63, 0x65, 0x6C, 0x6F, 0x73, 0x74, 0x75,
-    0x7A, 0xED, 0x2E, 0xE9, 0x04, 0xE9, 0x04, 0xE9, 0x7F, 0xEB, 0xF3, 0xE9, 0x43, 0xE9, 0x04, 0xEA,
-    0xF8, 0xC3, 0x01, 0x91, 0x67, 0x73, 0x76, 0xE2, 0x17, 0xEA, 0x08, 0xE9, 0x2A, 0x41, 0x67, 0xE6,
-    0x28, 0x41, 0x73, 0xE8, 0xD8, 0x21, 0x65, 0xFC, 0x22, 0x61, 0x68, 0xF5, 0xFD, 0x42, 0x61, 0x66,
-    0xE9, 0x0E, 0xE8, 0xD7, 0x4C, 0x61, 0x63, 0x64, 0x65, 0x69, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0x79,
-    0x7A, 0xFF, 0x8F, 0xFF, 0x9A, 0xFF, 0xA4, 0xFF, 0xAE, 0xFF, 0xC4, 0xE8, 0xC5, 0xFF, 0xDD, 0xEB,
-    0x75, 0xFF, 0xF4, 0xFF, 0xF9, 0xEA, 0x3F, 0xF4, 0x62, 0x41, 0x70, 0xE8, 0xE2, 0x21, 0x61, 0xFC,
-    0xA1, 0x02, 0x81, 0x72, 0xFD, 0xA0, 0x09, 0x32, 0x41, 0x61, 0xE4, 0x60, 0xC2, 0x02, 0xB1, 0x65,
-    0x6F, 0xE8, 0xCF, 0xE9, 0xB7, 0xC1, 0x01, 0x41, 0x6F, 0xE9, 0x1C, 0x4A, 0x66, 0x67, 0x69, 0x6C,
-    0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0xE8, 0x81, 0xFF, 0xE5, 0xFF, 0xEA, 0xE8, 0xFC, 0xFF, 0xED,
-    0xFF, 0xF1, 0xE1, 0xAD, 0xFF, 0xFA, 0xE8, 0xF5, 0xE8, 0x81, 0xC2, 0x02, 0x11, 0x69, 0x6E, 0xE8,
-    0xDD, 0xEA, 0x7F, 0x41, 0x69, 0xEC, 0x11, 0x21, 0x74, 0xFC, 0x21, 0x69, 0xFD, 0x43, 0x6C, 0x6E,
-    0x74, 0xE8, 0x4F, 0xEC, 0xFE, 0xFF, 0xFD, 0x43, 0x63, 0x64, 0x68, 0xFE, 0xE3, 0xE9, 0x62, 0xE8,
-    0x84, 0xC1, 0x02, 0x21, 0x62, 0xE9, 0x58, 0x22, 0x65, 0x6F, 0xF0, 0xFA, 0x41, 0x69, 0xE8, 0x46,
-    0x41, 0x74, 0xFE, 0xCA, 0xA0, 0x18, 0x55, 0x21, 0x68, 0xFD, 0x21, 0x70, 0xFD, 0x21, 0x65, 0xFD,
-    0x21, 0x6E, 0xFD, 0x4A, 0x61, 0x65, 0x68, 0x6C, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x69, 0xFF, 0xB7,
-    0xFF, 0xCA, 0xE1, 0xDC, 0xE9, 0xCF, 0xE9, 0xB7, 0xFF, 0xE4, 0xED, 0x54, 0xFF, 0xE9, 0xFF, 0xED,
-    0xFF, 0xFD, 0xA0, 0x09, 0x53, 0x42, 0x6C, 0x73, 0xE2, 0xB2, 0xFF, 0xFD, 0x21, 0x69, 0xF9, 0xA1,
-    0x02, 0xB1, 0x75, 0xFD, 0x41, 0x64, 0xE7, 0xE5, 0x41, 0x69, 0xF7, 0x55, 0xC4, 0x01, 0xF1, 0x62,
-    0x6E, 0x72, 0x74, 0xE1, 0x0C, 0xFF, 0xF8, 0xE8, 0x1F, 0xFF, 0xFC, 0xC1, 0x02, 0x41, 0x6C, 0xE8,
-    0x66, 0xC1, 0x01, 0xE1, 0x65, 0xE8, 0x60, 0x21, 0x68, 0xFA, 0x41, 0x6C, 0xE8, 0x3D, 0x44, 0x61,
-    0x63, 0x65, 0x74, 0xE7, 0xC6, 0xEC, 0x40, 0xE7, 0xBB, 0xE7, 0xFD, 0x42, 0x73, 0x74, 0xE7, 0xB9,
-    0xE7, 0xF0, 0x4A, 0x2E, 0x61, 0x63, 0x69, 0x6C, 0x6D, 0x6E, 0x71, 0x73, 0x74, 0xEF, 0xFE, 0xFF,
-    0xE8, 0xE1, 0x81, 0xF2, 0x21, 0xE8, 0x5E, 0xED, 0x2A, 0xFF, 0xEC, 0xE0, 0xD6, 0xFF, 0xF9, 0xE0,
-    0xD0, 0xA0, 0x18, 0xA3, 0x21, 0x2E, 0xFD, 0xA1, 0x09, 0x82, 0x6E, 0xFD, 0x41, 0x6B, 0xE9, 0x74,
-    0x42, 0x6E, 0x72, 0xE7, 0xF7, 0xE0, 0xA8, 0xC1, 0x00, 0x51, 0x61, 0xE8, 0x92, 0xC8, 0x01, 0xF1,
-    0x61, 0x63, 0x65, 0x6E, 0x6F, 0x74, 0x75, 0x76, 0xFF, 0xEA, 0xFF, 0xEF, 0xFF, 0xF3, 0xE9, 0xEF,
-    0xE9, 0x0D, 0xE7, 0x6C, 0xE8, 0x04, 0xFF, 0xFA, 0xA0, 0x07, 0xE2, 0x43, 0x73, 0x74, 0x7A, 0xE7,
-    0xE6, 0xE7, 0x4E, 0xE9, 0x45, 0x42, 0x69, 0x6F, 0xFF, 0xF6, 0xE7, 0x86, 0xC4, 0x02, 0x41, 0x62,
-    0x63, 0x72, 0x75, 0xE7, 0x48, 0xE7, 0x40, 0xE0, 0x6C, 0xE7, 0xAC, 0xC1, 0x01, 0xF1, 0x65, 0xEB,
-    0x57, 0x43, 0x65, 0x6C, 0x77, 0xE2, 0xF7, 0xE7, 0x28, 0xE7, 0x6A, 0xC1, 0x01, 0x91, 0x74, 0xE0,
-    0x4D, 0x41, 0x75, 0xE9, 0x0F, 0x21, 0x61, 0xFC, 0x4D, 0x61, 0x62, 0x63, 0x65, 0x68, 0x69, 0x6D,
-    0x6E, 0x6F, 0x73, 0x74, 0x75, 0x77, 0xFF, 0x34, 0xFF, 0x43, 0xFF, 0x4F, 0xFF, 0x6A, 0xE7, 0x80,
-    0xFF, 0xA5, 0xFF, 0xC0, 0xFF, 0xCD, 0xFF, 0xD4, 0xFF, 0xE3, 0xFF, 0xE9, 0xFF, 0xF3, 0xFF, 0xFD,
-    0x41, 0x65, 0xFA, 0x78, 0xA1, 0x07, 0x42, 0x67, 0xFC, 0xC1, 0x02, 0x11, 0x6E, 0xE6, 0xEB, 0xC3,
-    0x02, 0x81, 0x61, 0x72, 0x75, 0xFF, 0xFA, 0xE7, 0x58, 0xE6, 0xE5, 0xC1, 0x02, 0x11, 0x72, 0xE6,
-    0xD9, 0x41, 0x61, 0xE7, 0xE8, 0x42, 0x74, 0x76, 0xFA, 0x53, 0xFF, 0xFC, 0xC3, 0x07, 0x82, 0x63,
-    0x6E, 0x72, 0xFF, 0xEF, 0xE8, 0xDD, 0xFF, 0xF9, 0xC2, 0x01, 0x91, 0x61, 0x65, 0xE7, 0x2F, 0xE2,
-    0xB1, 0xC1, 0x02, 0x11, 0x65, 0xE7, 0x86, 0x41, 0x6E, 0xE8, 0xE4, 0xA0, 0x09, 0x42, 0x41, 0x74,
-    0xE0, 0x61, 0xC7, 0x02, 0xB1, 0x63, 0x64, 0x67, 0x6D, 0x6E, 0x73, 0x75, 0xE6, 0xF7, 0xFF, 0xEF,
-    0xFF, 0xF5, 0xF5, 0xC2, 0xFF, 0xF9, 0xFF, 0xFC, 0xDF, 0xC6, 0x41, 0x6E, 0xE6, 0x82, 0x21, 0x69,
-    0xFC, 0xC1, 0x02, 0x11, 0x75, 0xE6, 0xBA, 0xC1, 0x02, 0x11, 0x61, 0xE6, 0x7D, 0x22, 0x6C, 0x6E,
-    0xF4, 0xFA, 0xA0, 0x18, 0xD2, 0x21, 0x69, 0xFD, 0x21, 0x63, 0xFD, 0xC4, 0x02, 0xB1, 0x65, 0x69,
-    0x72, 0x61, 0xEE, 0xF2, 0xFC, 0x19, 0xE7, 0x35, 0xFF, 0xFD, 0xA0, 0x03, 0xA2, 0x21, 0x62, 0xFD,
-    0xA1, 0x02, 0x41, 0x69, 0xFD, 0x42, 0x67, 0x6D, 0xE6, 0x86, 0xE6, 0x4F, 0xC1, 0x04, 0x22, 0x6E,
-    0xE6, 0xBB, 0x41, 0x63, 0xDF, 0xB0, 0xC2, 0x02, 0x41, 0x6F, 0x75, 0xE6, 0x36, 0xFF, 0xFC, 0x44,
-    0x61, 0x69, 0x6F, 0x72, 0xF5, 0x74, 0xFF, 0xE6, 0xFF, 0xED, 0xFF, 0xF7, 0x41, 0x72, 0xFF, 0x4F,
-    0x4D, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6B, 0x6D, 0x6F, 0x70, 0x73, 0x74, 0x75, 0x77, 0xFF, 0x34,
-    0xFF, 0x3F, 0xFF, 0x5C, 0xFF, 0x68, 0xFF, 0x82, 0xFF, 0x9E, 0xE9, 0x2E, 0xFF, 0xAD, 0xFF, 0xBB,
-    0xFF, 0xD0, 0xFF, 0xEF, 0xFF, 0xFC, 0xE6, 0xB1, 0x41, 0x62, 0xDF, 0x20, 0x42, 0x6E, 0x6F, 0xFB,
-    0x87, 0xE6, 0x6B, 0xA0, 0x18, 0xF3, 0x21, 0x65, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21,
-    0x6C, 0xFD, 0x42, 0x6F, 0x79, 0xEF, 0x4E, 0xFF, 0xFD, 0xC1, 0x00, 0x41, 0x6F, 0xDE, 0xFF, 0x41,
-    0x69, 0xEA, 0x0D, 0x45, 0x63, 0x64, 0x6E, 0x72, 0x74, 0xE6, 0x35, 0xE8, 0xB4, 0xFF, 0xF6, 0xE5,
-    0xC9, 0xFF, 0xFC, 0x42, 0x63, 0x66, 0xE5, 0xF8, 0xE5, 0xC1, 0x42, 0x67, 0x73, 0xE5, 0xF1, 0xE5,
-    0xBA, 0x44, 0x61, 0x65, 0x69, 0x6F, 0xE6, 0x26, 0xE6, 0x26, 0xFF, 0xF2, 0xFF, 0xF9, 0x4A, 0x61,
-    0x65, 0x68, 0x69, 0x6E, 0x6F, 0x72, 0x75, 0x79, 0x7A, 0xFF, 0xAA, 0xFF, 0xAE, 0xFF, 0xC4, 0xFF,
-    0xD5, 0xE5, 0x9B, 0xFE, 0xF9, 0xFF, 0xF3, 0xE6, 0x59, 0xF0, 0xF7, 0xE5, 0xA6, 0x43, 0x65, 0x69,
-    0x72, 0xDE, 0xA5, 0xDF, 0x8D, 0xE5, 0x87, 0xA0, 0x19, 0x23, 0x21, 0x64, 0xFD, 0x21, 0x69, 0xFD,
-    0x21, 0x6C, 0xFD, 0xC6, 0x01, 0x91, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x63, 0xE5, 0x69, 0xE5, 0xE4,
-    0xEA, 0xE9, 0xDE, 0x95, 0xFF, 0xEA, 0xFF, 0xFD, 0xA0, 0x09, 0xC2, 0xC1, 0x02, 0x11, 0x74, 0xE5,
-    0x59, 0x22, 0x70, 0x73, 0xF7, 0xFA, 0x42, 0x6C, 0x6F, 0xE5, 0x85, 0xE0, 0x01, 0x42, 0x67, 0x69,
-    0xE5, 0x3F, 0xDE, 0x65, 0xC1, 0x01, 0xF1, 0x62, 0xE5, 0x38, 0x44, 0x61, 0x6C, 0x6E, 0x72, 0xE5,
-    0x32, 0xFF, 0xEC, 0xFF, 0xF3, 0xFF, 0xFA, 0xC4, 0x02, 0xB1, 0x64, 0x6C, 0x6E, 0x76, 0xE5, 0x64,
-    0xDE, 0x51, 0xE6, 0x42, 0xDE, 0x51, 0x41, 0x63, 0xE5, 0x16, 0x45, 0x61, 0x65, 0x69, 0x6F, 0x75,
-    0xFF, 0xC7, 0xFF, 0xE0, 0xFF, 0xED, 0xFF, 0xFC, 0xE5, 0x12, 0xC1, 0x02, 0xB1, 0x67, 0xE6, 0x1F,
-    0x41, 0x67, 0xE5, 0x3B, 0x43, 0x6C, 0x6E, 0x74, 0xDE, 0x45, 0xFF, 0xFC, 0xE5, 0x73, 0x44, 0x61,
-    0x65, 0x68, 0x69, 0xFF, 0xEC, 0xE7, 0xD9, 0xE5, 0x69, 0xFF, 0xF6, 0x41, 0x70, 0xF3, 0x76, 0x43,
-    0x63, 0x65, 0x73, 0xE6, 0xD1, 0xF1, 0x07, 0xDE, 0x09, 0x59, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
-    0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
-    0x77, 0x78, 0x79, 0xF8, 0x3D, 0xF8, 0x71, 0xF8, 0xF7, 0xF9, 0x55, 0xF9, 0x7E, 0xF9, 0xD6, 0xFA,
-    0x03, 0xFA, 0x19, 0xFA, 0x39, 0xFA, 0x5A, 0xFA, 0x63, 0xFB, 0x09, 0xFB, 0x7E, 0xFC, 0x0B, 0xFC,
-    0x52, 0xFC, 0xBA, 0xFC, 0xE6, 0xFD, 0xBF, 0xFE, 0xB7, 0xFF, 0x35, 0xFF, 0x6A, 0xFF, 0xC1, 0xFF,
-    0xE5, 0xFF, 0xF2, 0xFF, 0xF6, 0x42, 0x6C, 0x72, 0xE4, 0xC6, 0xDD, 0xC5, 0x41, 0x6C, 0xDF, 0x7E,
-    0x42, 0x61, 0x69, 0xE5, 0xB1, 0xE8, 0x7E, 0x41, 0x68, 0xDD, 0xB9, 0xA1, 0x02, 0xE1, 0x74, 0xFC,
-    0x43, 0x61, 0x68, 0x6F, 0xE4, 0xAB, 0xE6, 0xEC, 0xE4, 0x69, 0x41, 0x6C, 0xE3, 0x71, 0xC9, 0x03,
-    0xD1, 0x62, 0x63, 0x67, 0x69, 0x6C, 0x6D, 0x72, 0x74, 0x75, 0xFF, 0xD7, 0xE5, 0x32, 0xE4, 0x5B,
-    0xDD, 0xF4, 0xFF, 0xDE, 0xFF, 0xE2, 0xFF, 0xED, 0xFF, 0xF2, 0xFF, 0xFC, 0x42, 0x73, 0x74, 0xDD,
-    0x66, 0xED, 0xDE, 0x41, 0x75, 0xEB, 0x9F, 0xA1, 0x02, 0x31, 0x72, 0xFC, 0x42, 0x61, 0x74, 0xE4,
-    0x2D, 0xE6, 0x24, 0xC1, 0x00, 0xD1, 0x65, 0xDD, 0x76, 0x21, 0x64, 0xFA, 0x41, 0x69, 0xE2, 0xB2,
-    0xC2, 0x00, 0x61, 0x72, 0x6D, 0xE6, 0x10, 0xFF, 0xFC, 0x4A, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x6C,
-    0x6D, 0x6E, 0x72, 0x76, 0xE4, 0x10, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xE3, 0xEC, 0x67, 0xE5, 0x4E,
-    0xE7, 0x47, 0xFF, 0xF0, 0xFF, 0xF7, 0xDD, 0x3F, 0x43, 0x65, 0x6E, 0x73, 0xE5, 0x11, 0xE5, 0xD9,
-    0xF3, 0x1C, 0x41, 0x79, 0xE5, 0x07, 0xC4, 0x04, 0x02, 0x65, 0x69, 0x6C, 0x79, 0xE6, 0x07, 0xFF,
-    0xF2, 0xFF, 0xFC, 0xE4, 0x43, 0x41, 0x65, 0xE3, 0xD4, 0x43, 0x6C, 0x6E, 0x74, 0xEC, 0x2A, 0xE4,
-    0x4E, 0xFF, 0xFC, 0x42, 0x6E, 0x72, 0xE4, 0x44, 0xE4, 0x08, 0xC2, 0x00, 0x51, 0x61, 0x65, 0xE5,
-    0xB6, 0xE5, 0xB6, 0x47, 0x2E, 0x61, 0x65, 0x69, 0x73, 0x75, 0x68, 0xEC, 0x27, 0xFF, 0xE6, 0xFF,
-    0xF0, 0xFF, 0xF7, 0xE3, 0xB6, 0xE3, 0xF8, 0xE4, 0xF1, 0x41, 0x65, 0xE4, 0xCA, 0x41, 0x68, 0xE2,
-    0xAE, 0x41, 0x69, 0xE1, 0x2A, 0x43, 0x69, 0x6C, 0x79, 0xDC, 0xDB, 0xFF, 0xFC, 0xE3, 0x94, 0xA0,
-    0x09, 0xE2, 0xC5, 0x02, 0x41, 0x61, 0x64, 0x65, 0x67, 0x6E, 0xE5, 0x7E, 0xFE, 0x36, 0xE6, 0xBB,
-    0xFF, 0xFD, 0xDC, 0xB6, 0x41, 0x74, 0xDD, 0x0A, 0x41, 0x2E, 0xDC, 0xB8, 0x21, 0x64, 0xFC, 0x21,
-    0x65, 0xFD, 0x21, 0x74, 0xFD, 0xC8, 0x03, 0xD1, 0x61, 0x63, 0x64, 0x67, 0x6C, 0x6E, 0x73, 0x74,
-    0xE3, 0xA6, 0xFF, 0xAE, 0xFF, 0xC4, 0xFF, 0xC8, 0xFF, 0xD0, 0xFF, 0xDD, 0xFF, 0xEF, 0xFF, 0xFD,
-    0x41, 0x73, 0xE7, 0xDC, 0x42, 0x72, 0x77, 0xE2, 0x82, 0xEA, 0xED, 0xA0, 0x03, 0x52, 0xA0, 0x18,
-    0xF2, 0x21, 0x6C, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x67, 0xFD, 0x41, 0x72, 0xE4, 0x6A, 0x21, 0x6F,
-    0xFC, 0xC6, 0x0A, 0x02, 0x65, 0x69, 0x6F, 0x79, 0x61, 0x75, 0xFF, 0xDF, 0xDC, 0xC1, 0xFF, 0xE3,
-    0xFF, 0xEA, 0xFF, 0xF6, 0xFF, 0xFD, 0xC2, 0x02, 0xE1, 0x64, 0x74, 0xDC, 0x7F, 0xDC, 0x42, 0x42,
-    0x74, 0x79, 0xE3, 0x15, 0xDC, 0x51, 0xC4, 0x02, 0x81, 0x61, 0x65, 0x69, 0x74, 0xFF, 0xF9, 0xE1,
-    0x1D, 0xDC, 0x32, 0xDF, 0x9F, 0xC3, 0x03, 0xD1, 0x6E, 0x72, 0x73, 0xFF, 0xE1, 0xFF, 0xF1, 0xDC,
-    0x3B, 0x42, 0x61, 0x73, 0xE2, 0xEB, 0xDC, 0xEE, 0xC1, 0x00, 0xD1, 0x6C, 0xDC, 0x0A, 0x44, 0x61,
-    0x65, 0x69, 0x6F, 0xDD, 0x73, 0xFF, 0xF3, 0xFF, 0xFA, 0xDC, 0xEC, 0xC2, 0x02, 0x41, 0x6F, 0x79,
-    0xE3, 0xEE, 0xE3, 0x2E, 0x42, 0x69, 0x73, 0xDB, 0xEE, 0xDB, 0xF4, 0x41, 0x61, 0xE2, 0xBE, 0xC7,
-    0x02, 0x71, 0x65, 0x67, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0xE3, 0xE4, 0xE2, 0xBA, 0xE3, 0x6E, 0xE7,
-    0x3F, 0xE3, 0xF8, 0xFF, 0xF5, 0xFF, 0xFC, 0x51, 0x61, 0x62, 0x64, 0x65, 0x66, 0x68, 0x69, 0x6C,
-    0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x79, 0xFE, 0x47, 0xEC, 0xD2, 0xE2, 0xA2, 0xFE,
-    0x92, 0xFE, 0xBF, 0xE2, 0xA2, 0xFF, 0x3E, 0xFF, 0x7A, 0xE2, 0xA2, 0xE2, 0xA2, 0xFF, 0xAE, 0xEC,
-    0xD2, 0xFF, 0xC7, 0xEB, 0x13, 0xFF, 0xD4, 0xFF, 0xE8, 0xF1, 0x3A, 0x43, 0x2E, 0x69, 0x6F, 0xE4,
-    0x65, 0xE3, 0xA9, 0xE2, 0xB0, 0xC2, 0x02, 0x41, 0x65, 0x6F, 0xE2, 0x8A, 0xE2, 0x67, 0xC1, 0x01,
-    0xE1, 0x61, 0xDB, 0xAB, 0x42, 0x73, 0x7A, 0xDB, 0x9C, 0xFF, 0xFA, 0x42, 0x69, 0x6F, 0xFF, 0xF9,
-    0xE2, 0x4E, 0x41, 0x6E, 0xF0, 0x92, 0x42, 0x68, 0x69, 0xDD, 0x01, 0xED, 0x1F, 0xC8, 0x03, 0xD1,
-    0x66, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x7A, 0xDB, 0x6B, 0xFF, 0xCE, 0xFF, 0xD8, 0xFF, 0xEE,
-    0xFF, 0xF5, 0xE4, 0xE4, 0xFF, 0xF9, 0xE2, 0x3C, 0x41, 0x7A, 0xDB, 0x4A, 0x43, 0x6E, 0x73, 0x7A,
-    0xDB, 0x4C, 0xE2, 0x28, 0xE2, 0x28, 0x42, 0x69, 0x79, 0xFF, 0xF6, 0xE2, 0x13, 0x41, 0x74, 0xE2,
-    0xA4, 0x41, 0x79, 0xEC, 0x04, 0xC5, 0x03, 0xD1, 0x61, 0x69, 0x6F, 0x79, 0x63, 0xFF, 0xF8, 0xE8,
-    0x08, 0xE2, 0x04, 0xE2, 0x04, 0xFF, 0xFC, 0xA0, 0x09, 0x72, 0xC2, 0x03, 0xD1, 0x6D, 0x64, 0xE2,
-    0x31, 0xFF, 0xFD, 0x41, 0x63, 0xEB, 0xE2, 0x44, 0x68, 0x6F, 0x79, 0x69, 0xDB, 0x32, 0xE1, 0xE2,
-    0xE2, 0x7A, 0xFF, 0xFC, 0x4A, 0x2E, 0x64, 0x65, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x76, 0xEA,
-    0x2C, 0xEA, 0x2C, 0xFF, 0xB4, 0xFF, 0xC2, 0xFF, 0xD1, 0xFF, 0xE6, 0xFD, 0xEE, 0xF3, 0xE7, 0xFF,
-    0xF3, 0xE2, 0x6D, 0xC3, 0x0A, 0x23, 0x65, 0x6C, 0x6F, 0xE9, 0x83, 0xDF, 0xC5, 0xDA, 0xE5, 0x41,
-    0x75, 0xE1, 0xD0, 0x41, 0x65, 0xDA, 0xE1, 0x42, 0x6F, 0x77, 0xE2, 0x3A, 0xFF, 0xFC, 0x43, 0x69,
-    0x6F, 0x74, 0xE6, 0xDD, 0xFF, 0xF1, 0xFF, 0xF9, 0xC1, 0x0A, 0x52, 0x72, 0xDA, 0xD8, 0x41, 0x61,
-    0xE3, 0x82, 0xC2, 0x02, 0xB1, 0x69, 0x6F, 0xFF, 0xFC, 0xE2, 0xA7, 0x42, 0x6E, 0x73, 0xDA, 0xCE,
-    0xED, 0xAB, 0x41, 0x6E, 0xE1, 0xF5, 0x21, 0x65, 0xFC, 0xA0, 0x06, 0xB2, 0xA0, 0x0A, 0x72, 0x43,
-    0x2E, 0x67, 0x73, 0xFF, 0xFA, 0xDE, 0xB6, 0xFF, 0xFD, 0xC1, 0x02, 0x71, 0x6C, 0xDA, 0x8F, 0x4D,
-    0x2E, 0x61, 0x63, 0x65, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x75, 0x76, 0x7A, 0xE3, 0x51, 0xFF,
-    0xC9, 0xFF, 0xD3, 0xFF, 0xDC, 0xDA, 0x89, 0xFF, 0xE7, 0xFF, 0xF0, 0xE3, 0x51, 0xFF, 0xFA, 0xF9,
-    0x9B, 0xE1, 0xF2, 0xE3, 0x51, 0xE2, 0x95, 0xC2, 0x00, 0x51, 0x64, 0x73, 0xDD, 0xD2, 0xE3, 0x29,
-    0x41, 0x64, 0xE2, 0xCA, 0xA1, 0x03, 0xD1, 0x61, 0xFC, 0x41, 0x68, 0xE9, 0x01, 0x43, 0x62, 0x67,
-    0x73, 0xDA, 0x4B, 0xE1, 0x9A, 0xFF, 0xFC, 0xA0, 0x0A, 0xF2, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD,
-    0xC2, 0x02, 0x71, 0x72, 0x62, 0xDA, 0x4A, 0xFF, 0xFD, 0xA4, 0x02, 0x81, 0x61, 0x65, 0x69, 0x6F,
-    0xCE, 0xDB, 0xE4, 0xF7, 0xC1, 0x02, 0xB1, 0x79, 0xE2, 0x15, 0xA0, 0x06, 0xD2, 0xC2, 0x02, 0x31,
-    0x2E, 0x63, 0xE2, 0x0C, 0xFF, 0xFD, 0x41, 0x73, 0xDE, 0x83, 0x42, 0x74, 0x69, 0xDA, 0x08, 0xFF,
-    0xFC, 0x21, 0x74, 0xF9, 0xC2, 0x02, 0xB1, 0x6E, 0x6F, 0xE1, 0x35, 0xE1, 0xF5, 0xA0, 0x07, 0x32,
-    0x41, 0x70, 0xE1, 0x29, 0x21, 0x73, 0xFC, 0x22, 0x2E, 0x65, 0xF6, 0xFD, 0xC3, 0x02, 0xB1, 0x6E,
-    0x6D, 0x72, 0xE1, 0xDD, 0xDA, 0x97, 0xFF, 0xFB, 0x24, 0x61, 0x65, 0x69, 0x6F, 0xC5, 0xD9, 0xDC,
-    0xF4, 0xA0, 0x0A, 0x93, 0xA0, 0x0A, 0xC3, 0xA0, 0x19, 0x55, 0x21, 0x61, 0xFD, 0xA1, 0x01, 0xE1,
-    0x7A, 0xFD, 0xC3, 0x00, 0xD1, 0x61, 0x64, 0x69, 0xFF, 0xF2, 0xF7, 0x2A, 0xFF, 0xFB, 0x41, 0x75,
-    0xD9, 0xD2, 0x42, 0x69, 0x6F, 0xE6, 0x8B, 0xFF, 0xFC, 0xCA, 0x03, 0xD1, 0x2E, 0x62, 0x65, 0x67,
-    0x69, 0x6E, 0x6F, 0x72, 0x73, 0x76, 0xE1, 0xBB, 0xD9, 0xC7, 0xE2, 0x77, 0xFF, 0xD8, 0xE3, 0x2C,
-    0xFF, 0xE9, 0xE2, 0x77, 0xFF, 0xF9, 0xEC, 0xAD, 0xD9, 0xBB, 0xC1, 0x01, 0x71, 0x2E, 0xD9, 0xB5,
-    0x21, 0x72, 0xFA, 0x44, 0x2E, 0x65, 0x69, 0x79, 0xE2, 0x4D, 0xFF, 0xFD, 0xED, 0xC9, 0xE0, 0x56,
-    0x21, 0x68, 0xF3, 0x45, 0x64, 0x69, 0x6E, 0x70, 0x79, 0xFD, 0x88, 0xE1, 0x66, 0xDA, 0x30, 0xFF,
-    0xFD, 0xE0, 0x46, 0x41, 0x73, 0xEF, 0xAA, 0x42, 0x6E, 0x73, 0xD9, 0x61, 0xFF, 0xFC, 0x41, 0x76,
-    0xDD, 0xD9, 0x42, 0x74, 0x65, 0xE0, 0x27, 0xFF, 0xFC, 0x41, 0x66, 0xD9, 0x49, 0xC5, 0x03, 0xD1,
-    0x61, 0x65, 0x69, 0x6F, 0x75, 0xFF, 0xD6, 0xFF, 0xEA, 0xFF, 0xF5, 0xE1, 0x3C, 0xFF, 0xFC, 0xC1,
-    0x02, 0x81, 0x74, 0xE2, 0xF8, 0x41, 0x68, 0xD9, 0x45, 0x41, 0x64, 0xE1, 0x3B, 0xA1, 0x02, 0x31,
-    0x72, 0xFC, 0x41, 0x74, 0xFE, 0xE5, 0x41, 0x6E, 0xE1, 0x94, 0xA1, 0x02, 0x52, 0x61, 0xFC, 0x46,
-    0x61, 0x65, 0x69, 0x6E, 0x73, 0x74, 0xFF, 0xEE, 0xE8, 0x41, 0xFF, 0xF3, 0xE1, 0x25, 0xE1, 0x25,
-    0xFF, 0xFB, 0xA0, 0x0B, 0x13, 0xC2, 0x03, 0xD1, 0x6E, 0x72, 0xFF, 0xFD, 0xE2, 0x16, 0x52, 0x61,
-    0x62, 0x64, 0x65, 0x67, 0x68, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77,
-    0x79, 0xFD, 0x8F, 0xE0, 0x49, 0xE0, 0x63, 0xFD, 0xF6, 0xFE, 0x15, 0xFE, 0x30, 0xFE, 0x71, 0xFE,
-    0xCB, 0xFE, 0xD6, 0xFF, 0x1A, 0xFF, 0x4B, 0xE0, 0x49, 0xFF, 0xAF, 0xFF, 0xC1, 0xFF, 0xC7, 0xFF,
-    0xE1, 0xE0, 0x49, 0xFF, 0xF7, 0x41, 0x6C, 0xEF, 0xF9, 0x42, 0x6D, 0x74, 0xD8, 0xBF, 0xD8, 0xBF,
-    0xC1, 0x01, 0xE1, 0x6D, 0xDA, 0x47, 0x21, 0x61, 0xFA, 0x42, 0x69, 0x79, 0xD8, 0xAF, 0xD8, 0xAF,
-    0xC2, 0x00, 0x51, 0x65, 0x6F, 0xD9, 0xB7, 0xD8, 0xC9, 0xA0, 0x0B, 0x42, 0x21, 0x7A, 0xFD, 0x46,
-    0x63, 0x64, 0x67, 0x69, 0x6B, 0x74, 0xFF, 0xEA, 0xEB, 0x97, 0xFF, 0xF1, 0xFF, 0xFD, 0xD8, 0x99,
-    0xD8, 0xD6, 0xA0, 0x19, 0xA3, 0x21, 0x72, 0xFD, 0x21, 0x72, 0xFD, 0x43, 0x6C, 0x74, 0x61, 0xD8,
-    0x8F, 0xD8, 0x95, 0xFF, 0xFD, 0x42, 0x6E, 0x73, 0xDF, 0x86, 0xDF, 0x4F, 0x41, 0x65, 0xDC, 0xCF,
-    0x45, 0x61, 0x64, 0x6C, 0x70, 0x74, 0xFF, 0xF5, 0xF2, 0x61, 0xD8, 0xA5, 0xFF, 0xFC, 0xE6, 0x9B,
-    0xC1, 0x02, 0xE1, 0x61, 0xD8, 0x6A, 0x41, 0x73, 0xDB, 0x7A, 0x21, 0x72, 0xFC, 0x41, 0x68, 0xDC,
-    0xCA, 0x21, 0x63, 0xFC, 0x4E, 0x62, 0x63, 0x65, 0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x75,
-    0x7A, 0x69, 0x74, 0xFF, 0x81, 0xD8, 0x41, 0xFF, 0x85, 0xDF, 0x80, 0xFF, 0x92, 0xDF, 0xAD, 0xFF,
-    0xAB, 0xFF, 0xC7, 0xFF, 0xDC, 0xE3, 0x1A, 0xD8, 0xAE, 0xFF, 0xEC, 0xFF, 0xF6, 0xFF, 0xFD, 0x42,
-    0x64, 0x72, 0xED, 0x82, 0xE0, 0x25, 0x42, 0x6E, 0x74, 0xDF, 0x7B, 0xDE, 0xE6, 0x21, 0x61, 0xF9,
-    0xC1, 0x01, 0x41, 0x6F, 0xDE, 0xEF, 0x42, 0x69, 0x79, 0xEC, 0xFB, 0xD8, 0x02, 0x43, 0x69, 0x6C,
-    0x6F, 0xF7, 0x7B, 0xFF, 0xF9, 0xDE, 0xCF, 0xC1, 0x00, 0x41, 0x74, 0xD8, 0x09, 0xA1, 0x02, 0x81,
-    0x61, 0xFA, 0xC1, 0x01, 0x41, 0x70, 0xD9, 0x75, 0x46, 0x61, 0x62, 0x65, 0x6E, 0x6F, 0x79, 0xFF,
-    0xFA, 0xD8, 0xD9, 0xDB, 0x4D, 0xDF, 0x2F, 0xDF, 0x1C, 0xDF, 0x2F, 0xC1, 0x02, 0xB1, 0x70, 0xEA,
-    0xBB, 0xC1, 0x02, 0x31, 0x65, 0xDC, 0xC4, 0x41, 0x61, 0xDE, 0x0C, 0x4D, 0x61, 0x63, 0x64, 0x6C,
-    0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x78, 0xFF, 0xA4, 0xFF, 0xB2, 0xFF, 0xB5, 0xFF,
-    0xC2, 0xF0, 0x07, 0xFF, 0xD2, 0xDA, 0xB8, 0xD7, 0xD5, 0xFF, 0xDD, 0xFF, 0xF0, 0xFF, 0xF6, 0xD7,
-    0xBD, 0xFF, 0xFC, 0x41, 0x68, 0xD7, 0xB6, 0xA0, 0x07, 0x12, 0x41, 0x72, 0xDC, 0xD7, 0x21, 0x65,
-    0xFC, 0x41, 0x6E, 0xD8, 0x1E, 0xA0, 0x19, 0xD4, 0x21, 0x61, 0xFD, 0x21, 0x6C, 0xFD, 0xA1, 0x02,
-    0x31, 0x65, 0xFD, 0x44, 0x6C, 0x6F, 0x70, 0x72, 0xD7, 0x75, 0xDE, 0x88, 0xD7, 0x75, 0xD7, 0x75,
-    0x42, 0x65, 0x73, 0xEE, 0x4C, 0xD7, 0x68, 0x41, 0x64, 0xD8, 0xF0, 0x21, 0x69, 0xFC, 0x21, 0x73,
-    0xFD, 0x42, 0x68, 0x65, 0xD8, 0x6F, 0xFF, 0xFD, 0x4C, 0x61, 0x63, 0x67, 0x6C, 0x6D, 0x6E, 0x6F,
-    0x70, 0x72, 0x73, 0x74, 0x76, 0xDE, 0xFF, 0xE1, 0x58, 0xFF, 0xBB, 0xFF, 0xBF, 0xFF, 0xC6, 0xF7,
-    0x59, 0xFF, 0xC9, 0xFF, 0xD6, 0xFF, 0xDB, 0xFF, 0xE8, 0xFF, 0xF9, 0xE1, 0x55, 0xC1, 0x02, 0x11,
-    0x72, 0xDA, 0x0A, 0xC2, 0x08, 0x33, 0x61, 0x6F, 0xD7, 0x8F, 0xFF, 0xFA, 0xC1, 0x04, 0x02, 0x65,
-    0xDB, 0xBB, 0x41, 0x7A, 0xD8, 0xA5, 0x21, 0x75, 0xFC, 0xA1, 0x03, 0xE2, 0x61, 0xFD, 0x41, 0x7A,
-    0xDD, 0xDE, 0x42, 0x69, 0x73, 0xFF, 0xFC, 0xDD, 0xDA, 0xC1, 0x02, 0x31, 0x65, 0xD6, 0xF9, 0xA0,
-    0x0B, 0x62, 0x42, 0x61, 0x65, 0xD9, 0xF1, 0xFF, 0xFD, 0x42, 0x61, 0x65, 0xDE, 0x58, 0xD8, 0x7E,
-    0x42, 0x61, 0x79, 0xD6, 0xE8, 0xDD, 0xC4, 0x42, 0x64, 0x6E, 0xDE, 0xED, 0xD6, 0xDB, 0x41, 0x2E,
-    0xE5, 0x29, 0x42, 0x73, 0x63, 0xDD, 0xB2, 0xFF, 0xFC, 0x44, 0x61, 0x69, 0x74, 0x75, 0xD6, 0xEA,
-    0xFF, 0xF9, 0xDA, 0x94, 0xDD, 0xAB, 0xC1, 0x00, 0x51, 0x6E, 0xDD, 0x9E, 0x42, 0x65, 0x70, 0xFF,
-    0xFA, 0xD6, 0xC8, 0xC1, 0x03, 0xD1, 0x65, 0xD8, 0x61, 0x21, 0x73, 0xFA, 0x41, 0x65, 0xE8, 0x6D,
-    0x2A, 0x64, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x75, 0x76, 0xA2, 0xA9, 0xB2, 0xB9, 0xC0,
-    0xC7, 0xD9, 0xEC, 0xF9, 0xFC, 0x42, 0x6E, 0x70, 0xEE, 0xCE, 0xDA, 0x5C, 0xC2, 0x02, 0x52, 0x65,
-    0x6F, 0xD8, 0x5E, 0xFF, 0xF9, 0xC1, 0x0A, 0x23, 0x68, 0xDE, 0x74, 0x41, 0x72, 0xDE, 0x6E, 0x41,
-    0x75, 0xFC, 0x7E, 0x43, 0x6E, 0x73, 0x6F, 0xDD, 0xB5, 0xDD, 0x51, 0xFF, 0xFC, 0x43, 0x61, 0x65,
-    0x79, 0xFF, 0xEE, 0xFF, 0xF6, 0xDE, 0x5C, 0x42, 0x6B, 0x74, 0xDA, 0x7E, 0xD6, 0x61, 0xA0, 0x0B,
-    0x82, 0x21, 0x74, 0xFD, 0x45, 0x67, 0x6D, 0x6E, 0x73, 0x74, 0xDD, 0xBD, 0xDD, 0xD9, 0xFF, 0xF3,
-    0xFF, 0xFD, 0xDD, 0xBD, 0x41, 0x72, 0xF0, 0xB2, 0xA1, 0x02, 0xB1, 0x61, 0xFC, 0x41, 0x61, 0xD9,
-    0x63, 0x21, 0x68, 0xFC, 0x21, 0x74, 0xFD, 0x43, 0x65, 0x68, 0x6F, 0xDD, 0x44, 0xDD, 0x44, 0xFF,
-    0xFD, 0x42, 0x70, 0x73, 0xFF, 0xF6, 0xE0, 0x2C, 0x52, 0x61, 0x62, 0x65, 0x66, 0x68, 0x69, 0x6B,
-    0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0x79, 0xFD, 0xDC, 0xDE, 0x92, 0xFE,
-    0x63, 0xDE, 0x92, 0xDE, 0x92, 0xFE, 0xD0, 0xDC, 0xF1, 0xFE, 0xFB, 0xFF, 0x04, 0xFF, 0x11, 0xFF,
-    0x78, 0xE7, 0x21, 0xFF, 0x94, 0xFF, 0x9D, 0xFF, 0xB5, 0xFF, 0xCC, 0xFF, 0xE0, 0xFF, 0xF9, 0xC1,
-    0x00, 0x51, 0x65, 0xDA, 0x0A, 0xC3, 0x02, 0x11, 0x63, 0x69, 0x74, 0xDC, 0xB4, 0xD5, 0xF5, 0xE7,
-    0x46, 0x41, 0x76, 0xDD, 0xC8, 0x41, 0x63, 0xDD, 0x3C, 0x21, 0x69, 0xFC, 0x43, 0x69, 0x72, 0x75,
-    0xFF, 0xF5, 0xFF, 0xFD, 0xDD, 0xBD, 0xC6, 0x03, 0xE2, 0x6C, 0x6D, 0x6E, 0x70, 0x73, 0x74, 0xDC,
-    0xF3, 0xFF, 0xD9, 0xFF, 0xDF, 0xE1, 0x18, 0xDF, 0x3B, 0xFF, 0xF6, 0x42, 0x61, 0x74, 0xDC, 0xC0,
-    0xDC, 0x89, 0xA1, 0x00, 0x51, 0x72, 0xF9, 0x42, 0x2E, 0x65, 0xDC, 0x7D, 0xDC, 0x7D, 0x43, 0x61,
-    0x6E, 0x74, 0xDC, 0x76, 0xDC, 0xAD, 0xFF, 0xF9, 0xC1, 0x02, 0xB1, 0x69, 0xDC, 0xA3, 0xC1, 0x02,
-    0xB1, 0x69, 0xEB, 0x86, 0x46, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x75, 0xFF, 0xDE, 0xFF, 0xEA, 0xFF,
-    0xF4, 0xDC, 0x58, 0xFF, 0xFA, 0xF5, 0xD6, 0xC2, 0x01, 0x91, 0x2E, 0x61, 0xDD, 0x62, 0xDD, 0x62,
-    0x45, 0x6D, 0x70, 0x72, 0x73, 0x79, 0xDC, 0x39, 0xDE, 0x30, 0xFF, 0xF7, 0xD5, 0x89, 0xDD, 0x59,
-    0x41, 0x75, 0xD5, 0x52, 0x41, 0x6F, 0xDC, 0x25, 0xC1, 0x02, 0x11, 0x61, 0xDC, 0x63, 0xC3, 0x02,
-    0x41, 0x64, 0x6E, 0x70, 0xDC, 0x1E, 0xDE, 0x5D, 0xFF, 0xFA, 0x41, 0x63, 0xEB, 0x3A, 0xC2, 0x04,
-    0x02, 0x61, 0x79, 0xDE, 0x02, 0xDD, 0x2B, 0xC1, 0x00, 0xC1, 0x61, 0xEF, 0x13, 0x42, 0x65, 0x75,
-    0xDC, 0x94, 0xFF, 0xFA, 0x44, 0x6C, 0x6D, 0x6F, 0x72, 0xDC, 0xB3, 0xDC, 0x8D, 0xDC, 0x00, 0xDC,
-    0x73, 0x4A, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x74, 0x75, 0xFF, 0xAF, 0xFF, 0xBF,
-    0xFF, 0xC3, 0xDB, 0xE8, 0xFF, 0xCD, 0xF8, 0x01, 0xFF, 0xD9, 0xFF, 0xDD, 0xFF, 0xEC, 0xFF, 0xF3,
-    0x42, 0x69, 0x6E, 0xDC, 0xE9, 0xDD, 0xE9, 0x42, 0x61, 0x73, 0xEB, 0xD5, 0xD4, 0xF1, 0x42, 0x6E,
-    0x72, 0xDB, 0xC6, 0xD4, 0xEA, 0xC2, 0x01, 0xE1, 0x75, 0x73, 0xD4, 0xFB, 0xDC, 0x4C, 0xC5, 0x02,
-    0x11, 0x61, 0x65, 0x6F, 0x74, 0x75, 0xFF, 0xF0, 0xDB, 0xAE, 0xFF, 0xF7, 0xDC, 0x1A, 0xDB, 0xB6,
-    0x42, 0x6D, 0x77, 0xDC, 0xB9, 0xDB, 0xDB, 0xC1, 0x02, 0x11, 0x6F, 0xDB, 0x9D, 0xC8, 0x02, 0x41,
-    0x61, 0x64, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x75, 0xFF, 0xC3, 0xDB, 0x97, 0xFF, 0xCA, 0xFF, 0xE1,
-    0xED, 0xF0, 0xFF, 0xF3, 0xDC, 0xAC, 0xFF, 0xFA, 0xA0, 0x0B, 0xE2, 0x21, 0x61, 0xFD, 0x44, 0x61,
-    0x65, 0x6E, 0x74, 0xE9, 0xB6, 0xD4, 0x9A, 0xDB, 0x6E, 0xDE, 0x06, 0x41, 0x2E, 0xDC, 0xFF, 0x42,
-    0x63, 0x74, 0xDB, 0xD8, 0xDC, 0xFB, 0xC7, 0x0B, 0xC2, 0x64, 0x67, 0x6C, 0x6E, 0x72, 0x73, 0x74,
-    0xD4, 0xBF, 0xFF, 0xE5, 0xFD, 0x21, 0xFF, 0xE8, 0xFF, 0xF5, 0xFF, 0xF9, 0xDB, 0xD1, 0x41, 0x72,
-    0xDE, 0xF6, 0x42, 0x65, 0x72, 0xD7, 0x37, 0xDB, 0xCF, 0x42, 0x63, 0x65, 0xEA, 0xA4, 0xDB, 0xAE,
-    0x41, 0x74, 0xD7, 0x80, 0x21, 0x65, 0xFC, 0x21, 0x63, 0xFD, 0x47, 0x2E, 0x65, 0x66, 0x69, 0x6C,
-    0x74, 0x61, 0xDB, 0x1F, 0xFF, 0xE4, 0xFF, 0xE8, 0xFF, 0xEF, 0xDB, 0x9D, 0xDB, 0x1F, 0xFF, 0xFD,
-    0x41, 0x62, 0xD4, 0x50, 0x41, 0x72, 0xDB, 0xC3, 0x41, 0x74, 0xD5, 0xC2, 0xC4, 0x01, 0x91, 0x62,
-    0x6C, 0x6E, 0x74, 0xDB, 0x7B, 0xDB, 0x3F, 0xDB, 0x3F, 0xDB, 0x3F, 0xA0, 0x02, 0x92, 0xC2, 0x02,
-    0x11, 0x72, 0x74, 0xDB, 0x2D, 0xDA, 0xF6, 0x42, 0x69, 0x72, 0xD4, 0x29, 0xDB, 0x51, 0x41, 0x72,
-    0xD8, 0x89, 0xA1, 0x00, 0x51, 0x65, 0xFC, 0x21, 0x74, 0xFB, 0x21, 0x69, 0xFD, 0xC9, 0x02, 0x41,
-    0x61, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x75, 0x6E, 0xFF, 0xC3, 0xFF, 0xC7, 0xFF, 0xCB, 0xFF,
-    0xCF, 0xFF, 0xDE, 0xFF, 0xE1, 0xDD, 0xBA, 0xFF, 0xEA, 0xFF, 0xFD, 0xA0, 0x0C, 0x03, 0xC1, 0x02,
-    0x21, 0x6B, 0xDB, 0xCB, 0xC4, 0x02, 0xB1, 0x62, 0x64, 0x6D, 0x72, 0xF3, 0x54, 0xEE, 0x90, 0xE9,
-    0xD0, 0xD4, 0x67, 0x43, 0x67, 0x72, 0x76, 0xDB, 0x14, 0xDB, 0x05, 0xD3, 0xBF, 0xC6, 0x01, 0xF1,
-    0x61, 0x62, 0x6F, 0x73, 0x74, 0x7A, 0xDA, 0xCE, 0xDD, 0xC0, 0xDA, 0xCE, 0xF8, 0x80, 0xE2, 0xE3,
-    0xDD, 0xC0, 0x41, 0x61, 0xFF, 0x6E, 0x41, 0x71, 0xDA, 0xB5, 0x4A, 0x61, 0x65, 0x66, 0x69, 0x6C,
-    0x6E, 0x6F, 0x74, 0x75, 0x76, 0xFF, 0xCA, 0xFF, 0xD9, 0xDA, 0x7A, 0xFF, 0xE3, 0xFF, 0xF8, 0xDA,
-    0x6F, 0xFF, 0xFC, 0xE1, 0x55, 0xE2, 0x80, 0xDA, 0xB1, 0xC1, 0x01, 0x41, 0x65, 0xDA, 0x92, 0x41,
-    0x79, 0xD3, 0x91, 0x22, 0x67, 0x72, 0xF6, 0xFC, 0x41, 0x61, 0xD3, 0xBD, 0x21, 0x74, 0xFC, 0x42,
-    0x6E, 0x74, 0xFF, 0xFD, 0xDA, 0x3A, 0xC4, 0x01, 0xF1, 0x64, 0x6C, 0x6E, 0x74, 0xDC, 0x75, 0xD7,
-    0x7F, 0xDF, 0x02, 0xDA, 0x33, 0xC1, 0x02, 0x11, 0x6C, 0xDA, 0xE2, 0x41, 0x61, 0xEA, 0x3A, 0x21,
-    0x64, 0xFC, 0x21, 0x65, 0xFD, 0x47, 0x61, 0x65, 0x69, 0x6E, 0x6F, 0x75, 0x70, 0xFF, 0xCE, 0xFF,
-    0xDA, 0xFF, 0xE1, 0xDD, 0x29, 0xF8, 0x9D, 0xFF, 0xF0, 0xFF, 0xFD, 0x42, 0x75, 0x76, 0xED, 0x4D,
-    0xD9, 0xFE, 0x42, 0x6C, 0x72, 0xD8, 0x6F, 0xDA, 0x39, 0x21, 0x65, 0xF9, 0x41, 0x6E, 0xDA, 0x27,
-    0x21, 0x69, 0xFC, 0xA1, 0x01, 0x91, 0x6C, 0xFD, 0x41, 0x61, 0xD4, 0xAA, 0xC3, 0x02, 0x41, 0x65,
-    0x72, 0x73, 0xDA, 0x5B, 0xFF, 0xFC, 0xDE, 0x70, 0xC1, 0x01, 0x91, 0x6E, 0xD9, 0xDC, 0x46, 0x61,
-    0x65, 0x69, 0x6C, 0x6F, 0x75, 0xD9, 0xCB, 0xFF, 0xFA, 0xD9, 0xCB, 0xFF, 0xE2, 0xD9, 0xCB, 0xD9,
-    0xCB, 0x41, 0x79, 0xDB, 0xA0, 0x42, 0x2E, 0x6C, 0xD9, 0xB7, 0xFF, 0xFC, 0x41, 0x6F, 0xDB, 0xA4,
-    0x43, 0x65, 0x69, 0x79, 0xFF, 0xF5, 0xFF, 0xFC, 0xD9, 0xEB, 0xC5, 0x02, 0x41, 0x2E, 0x61, 0x6F,
-    0x73, 0x74, 0xD9, 0xA2, 0xDA, 0xBF, 0xD9, 0xE1, 0xDA, 0x0E, 0xFF, 0xF6, 0xC3, 0x03, 0xE2, 0x63,
-    0x73, 0x74, 0xF0, 0xF9, 0xD2, 0xBC, 0xDA, 0xAD, 0x41, 0x61, 0xD2, 0xD7, 0x21, 0x72, 0xFC, 0xC2,
-    0x02, 0x41, 0x65, 0x75, 0xD9, 0xBC, 0xFF, 0xFD, 0xA0, 0x0B, 0xC2, 0x42, 0x2E, 0x68, 0xE1, 0xC5,
-    0xFF, 0xFD, 0xC1, 0x01, 0xF1, 0x73, 0xD9, 0x6A, 0xA0, 0x1A, 0x12, 0x21, 0x73, 0xFD, 0x21, 0x61,
-    0xFD, 0x21, 0x72, 0xFD, 0x50, 0x2E, 0x61, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6B, 0x6C, 0x6E, 0x6F,
-    0x73, 0x74, 0x75, 0x79, 0x66, 0xE1, 0xAC, 0xFF, 0x57, 0xFF, 0x65, 0xFF, 0x6F, 0xFF, 0x78, 0xFF,
-    0x8A, 0xFF, 0xB6, 0xD9, 0x55, 0xD9, 0x55, 0xE1, 0xAC, 0xFF, 0xC8, 0xFF, 0xDB, 0xFF, 0xE7, 0xFF,
-    0xEE, 0xD9, 0x55, 0xFF, 0xFD, 0x42, 0x65, 0x72, 0xD2, 0x4D, 0xDC, 0x58, 0x41, 0x72, 0xD5, 0x5F,
-    0x43, 0x61, 0x65, 0x69, 0xD2, 0x5D, 0xFF, 0xFC, 0xD2, 0x5A, 0x43, 0x68, 0x69, 0x6F, 0xD9, 0x1A,
-    0xD9, 0x12, 0xD9, 0xA7, 0xCA, 0x02, 0x41, 0x2E, 0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74,
-    0x75, 0xD9, 0x05, 0xFF, 0xE1, 0xDA, 0xA6, 0xD9, 0x9D, 0xFF, 0xEC, 0xDE, 0x3F, 0xD5, 0x13, 0xDA,
-    0x25, 0xFF, 0xF6, 0xFB, 0xB7, 0x41, 0x73, 0xD7, 0x31, 0x21, 0x61, 0xFC, 0x21, 0x72, 0xFD, 0xC1,
-    0x01, 0xE1, 0x63, 0xD9, 0x72, 0x41, 0x65, 0xF2, 0x85, 0xC5, 0x02, 0x41, 0x65, 0x68, 0x69, 0x72,
-    0x75, 0xD1, 0xFF, 0xFF, 0xF3, 0xFF, 0xF6, 0xFF, 0xFC, 0xD9, 0x15, 0xA0, 0x0C, 0x42, 0x42, 0x64,
-    0x74, 0xD8, 0xFD, 0xFF, 0xFD, 0x43, 0x61, 0x65, 0x69, 0xD9, 0x32, 0xE8, 0x2C, 0xFF, 0xF9, 0x21,
-    0x75, 0xF6, 0xC2, 0x02, 0xB1, 0x62, 0x63, 0xD1, 0xD6, 0xD9, 0xC7, 0xA0, 0x0C, 0x62, 0x44, 0x64,
-    0x66, 0x6C, 0x73, 0xD2, 0x07, 0xD9, 0xBB, 0xFF, 0xFD, 0xD9, 0xBB, 0x41, 0x69, 0xD8, 0x99, 0xA0,
-    0x0C, 0x83, 0xC4, 0x01, 0xF1, 0x64, 0x73, 0x74, 0x7A, 0xD5, 0xD3, 0xD9, 0x1F, 0xE4, 0x81, 0xFF,
-    0xFD, 0x42, 0x67, 0x6E, 0xD1, 0xA7, 0xE4, 0xA5, 0xA0, 0x1A, 0x32, 0x21, 0x63, 0xFD, 0x21, 0x6F,
-    0xFD, 0x21, 0x76, 0xFD, 0x21, 0x65, 0xFD, 0xC9, 0x01, 0x91, 0x61, 0x64, 0x65, 0x67, 0x69, 0x6D,
-    0x6F, 0x75, 0x72, 0xFF, 0xBB, 0xD5, 0xAE, 0xFF, 0xC7, 0xFF, 0xD4, 0xFF, 0xDB, 0xD9, 0x16, 0xFF,
-    0xEA, 0xD9, 0x8C, 0xFF, 0xFD, 0x43, 0x67, 0x72, 0x73, 0xD8, 0x4F, 0xD8, 0x86, 0xD1, 0x94, 0xC1,
-    0x0C, 0xB2, 0x68, 0xD8, 0x7C, 0xC1, 0x01, 0x91, 0x72, 0xD8, 0x76, 0x42, 0x6E, 0x70, 0xD8, 0x70,
-    0xD1, 0x75, 0x42, 0x61, 0x6F, 0xD9, 0x05, 0xFF, 0xF9, 0x44, 0x62, 0x64, 0x73, 0x74, 0xD8, 0x62,
-    0xD1, 0x4F, 0xD8, 0x23, 0xED, 0xBE, 0x41, 0x61, 0xE7, 0x5D, 0xC1, 0x02, 0x11, 0x6D, 0xDF, 0x71,
-    0xC2, 0x01, 0xF1, 0x69, 0x79, 0xDB, 0x3D, 0xD8, 0xA1, 0x42, 0x6E, 0x73, 0xD6, 0x78, 0xD8, 0x98,
-    0xC2, 0x05, 0xD2, 0x61, 0x65, 0xE7, 0x47, 0xFF, 0xF9, 0x41, 0x61, 0xED, 0x08, 0x45, 0x61, 0x65,
-    0x69, 0x6C, 0x72, 0xD9, 0xBA, 0xD8, 0x5B, 0xD8, 0x5B, 0xD4, 0x2E, 0xFF, 0xFC, 0xC1, 0x02, 0x11,
-    0x73, 0xD7, 0xE7, 0x4F, 0x2E, 0x61, 0x63, 0x65, 0x66, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6F, 0x70,
-    0x73, 0x74, 0x75, 0xE0, 0x2D, 0xFF, 0x92, 0xFF, 0x9C, 0xFF, 0xA2, 0xD9, 0x11, 0xFF, 0xAF, 0xFF,
-    0xB6, 0xD9, 0x0E, 0xFF, 0xC3, 0xEE, 0xFE, 0xFF, 0xC7, 0xFF, 0xCD, 0xFF, 0xDD, 0xFF, 0xEA, 0xFF,
-    0xFA, 0xA0, 0x0C, 0xD2, 0x46, 0x2E, 0x62, 0x67, 0x6D, 0x6E, 0x74, 0xD7, 0xA5, 0xD1, 0x3A, 0xD8,
-    0xC5, 0xFF, 0xFD, 0xD8, 0x23, 0xD8, 0x23, 0x42, 0x61, 0x69, 0xD7, 0xD4, 0xD7, 0x95, 0x41, 0x61,
-    0xD9, 0x2C, 0x21, 0x6D, 0xFC, 0xA1, 0x02, 0x31, 0x69, 0xFD, 0xA2, 0x02, 0x41, 0x72, 0x73, 0xED,
-    0xFB, 0x41, 0x6C, 0xD3, 0x8A, 0xA1, 0x02, 0x41, 0x69, 0xFC, 0xC2, 0x02, 0x02, 0x61, 0x6B, 0xD7,
-    0xB1, 0xD9, 0x5E, 0xC1, 0x01, 0x91, 0x6D, 0xD8, 0x86, 0xA0, 0x11, 0x02, 0x21, 0x72, 0xFD, 0x21,
-    0x61, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0xC8, 0x02, 0xB1, 0x61, 0x63, 0x67, 0x6C, 0x6D,
-    0x6F, 0x73, 0x6E, 0xD7, 0x51, 0xFF, 0xE2, 0xD7, 0x93, 0xD8, 0x7B, 0xD7, 0xB1, 0xDF, 0xA8, 0xFF,
-    0xEB, 0xFF, 0xFD, 0xA0, 0x0C, 0xF3, 0x42, 0x6D, 0x6E, 0xFF, 0xFD, 0xD7, 0x33, 0x42, 0x61, 0x79,
-    0xEB, 0x0C, 0xD7, 0x37, 0x43, 0x61, 0x64, 0x6C, 0xDB, 0x4E, 0xD7, 0x28, 0xD7, 0x67, 0x49, 0x61,
-    0x65, 0x68, 0x69, 0x6F, 0x72, 0x74, 0x75, 0x7A, 0xFF, 0x76, 0xFF, 0x9C, 0xFF, 0xA7, 0xFF, 0xCA,
-    0xFF, 0xE8, 0xFF, 0xEF, 0xD7, 0x1B, 0xFF, 0xF6, 0xE6, 0x8F, 0x42, 0x2E, 0x73, 0xEA, 0x4E, 0xEB,
-    0xFB, 0x43, 0x6C, 0x6E, 0x72, 0xD7, 0x3D, 0xDC, 0x94, 0xFF, 0xF9, 0x43, 0x6C, 0x6F, 0x74, 0xD7,
-    0xA5, 0xD6, 0xF9, 0xD7, 0x5D, 0x42, 0x65, 0x6F, 0xD6, 0xE7, 0xD9, 0xC8, 0x42, 0x72, 0x74, 0xFF,
-    0xF9, 0xEA, 0x2C, 0xA3, 0x02, 0x41, 0x65, 0x69, 0x6F, 0xDE, 0xE8, 0xF9, 0x41, 0x74, 0xD8, 0xC4,
-    0x21, 0x6E, 0xFC, 0x43, 0x61, 0x69, 0x6F, 0xE2, 0xEF, 0xCF, 0xF5, 0xFF, 0xFD, 0x5A, 0x61, 0x62,
+constexpr uint8_t en_trie_classes[256] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+    0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+constexpr uint32_t en_trie_dense[] = {
+    0x00000000u, 0x00000002u, 0x00000060u, 0x000000C6u, 0x0000011Cu, 0x0000015Eu, 0x000001BCu, 0x00000222u,
+    0x00000268u, 0x000002B2u, 0x000002FCu, 0x00000366u, 0x00000378u, 0x000003B6u, 0x00000414u, 0x0000045Eu,
+    0x000004C4u, 0x0000052Au, 0x00000578u, 0x0000057Eu, 0x000005E0u, 0x0000063Eu, 0x00000698u, 0x000006F2u,
+    0x0000070Cu, 0x0000074Au, 0x00000778u, 0x000007BEu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x000007E4u, 0x00000816u, 0x00000828u, 0x0000083Eu, 0x00000854u, 0x0000088Au,
+    0x00000894u, 0x000008A6u, 0x000008B8u, 0x000008CEu, 0x000008D4u, 0x000008DEu, 0x000008ECu, 0x00000902u,
+    0x00000910u, 0x0000092Au, 0x00000000u, 0x0000093Cu, 0x00000952u, 0x00000970u, 0x0000098Au, 0x0000099Cu,
+    0x000009A6u, 0x00000000u, 0x000009B0u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x000009B6u,
+    0x000009D8u, 0x000009F6u, 0x00000A1Au, 0x00000A20u, 0x00000A28u, 0x00000A4Au, 0x00000A5Cu, 0x00000A74u,
+    0x00000A78u, 0x00000A7Eu, 0x00000AA0u, 0x00000AB6u, 0x00000AE6u, 0x00000AEAu, 0x00000B0Cu, 0x00000B12u,
+    0x00000B4Au, 0x00000B7Cu, 0x00000BA6u, 0x00000BC4u, 0x00000BD6u, 0x00000BE8u, 0x00000BEEu, 0x00000BFCu,
+    0x00000000u, 0x00000000u, 0x00000C06u, 0x00000C30u, 0x00000000u, 0x00000C3Cu, 0x00000C40u, 0x00000C72u,
+    0x00000000u, 0x00000C76u, 0x00000C7Au, 0x00000A74u, 0x00000C9Cu, 0x00000CA0u, 0x00000C3Cu, 0x00000CB8u,
+    0x00000CC0u, 0x00000AE6u, 0x00000000u, 0x00000CEAu, 0x00000CF8u, 0x00000D00u, 0x00000D10u, 0x00000A74u,
+    0x00000D32u, 0x00000000u, 0x00000D36u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000D40u, 0x00000000u,
+    0x00000D74u, 0x00000000u, 0x00000D84u, 0x00000000u, 0x00000000u, 0x00000DAEu, 0x00000DCEu, 0x00000000u,
+    0x00000E0Au, 0x00000E12u, 0x00000000u, 0x00000E26u, 0x00000E2Au, 0x00000000u, 0x00000A74u, 0x00000E66u,
+    0x00000E7Cu, 0x00000E80u, 0x00000E9Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000EC6u, 0x000009B0u,
+    0x00000000u, 0x00000000u, 0x00000ECAu, 0x00000A74u, 0x00000E26u, 0x00000EFEu, 0x00000F0Au, 0x00000C3Cu,
+    0x00000F54u, 0x00000F66u, 0x00000F6Au, 0x00000A74u, 0x00000FACu, 0x00000FB0u, 0x00000A74u, 0x00000FCAu,
+    0x00000FCEu, 0x00000A74u, 0x00000000u, 0x00001012u, 0x0000102Eu, 0x0000103Eu, 0x00001048u, 0x00000A74u,
+    0x00000A74u, 0x00000000u, 0x00001070u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000107Cu, 0x000010AAu,
+    0x000010BAu, 0x000010E4u, 0x00001106u, 0x00001130u, 0x00001148u, 0x00001166u, 0x0000116Eu, 0x0000118Eu,
+    0x00001196u, 0x000011A0u, 0x000011C6u, 0x000011ECu, 0x0000121Eu, 0x00001248u, 0x00001272u, 0x0000127Au,
+    0x000012B0u, 0x000012E6u, 0x00001310u, 0x0000132Cu, 0x00001342u, 0x00001354u, 0x0000135Au, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00001368u, 0x00000D32u, 0x00000000u, 0x00000AE6u, 0x00001390u, 0x000013BAu,
+    0x00000000u, 0x00000AE6u, 0x000013CEu, 0x00000000u, 0x00000000u, 0x000013F2u, 0x00000AE6u, 0x00000AE6u,
+    0x0000140Eu, 0x00000D32u, 0x00000000u, 0x0000141Eu, 0x00001430u, 0x00001434u, 0x00001440u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000EC6u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00001460u, 0x00001484u,
+    0x00000000u, 0x00000C9Cu, 0x00001488u, 0x00000000u, 0x000014B2u, 0x000014C2u, 0x000014D0u, 0x00000000u,
+    0x00000000u, 0x00001506u, 0x0000151Au, 0x00001522u, 0x00001534u, 0x00001484u, 0x00000000u, 0x00001560u,
+    0x00001578u, 0x00001580u, 0x00001586u, 0x00000000u, 0x00001484u, 0x00000000u, 0x000015A0u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x000015ACu, 0x00000A74u, 0x00000000u, 0x00000000u, 0x000015E6u, 0x00000A74u,
+    0x00000000u, 0x00000A74u, 0x0000161Cu, 0x00000000u, 0x00000AE6u, 0x0000164Eu, 0x0000165Au, 0x00001662u,
+    0x0000166Au, 0x00000D32u, 0x00000000u, 0x00001694u, 0x000016A0u, 0x000016A8u, 0x000016B6u, 0x00000000u,
+    0x000016CCu, 0x00000000u, 0x000016D4u, 0x00000000u, 0x00000000u, 0x00000000u, 0x000016DEu, 0x000016FAu,
+    0x00001714u, 0x0000173Eu, 0x00001762u, 0x00001782u, 0x000017A0u, 0x00001484u, 0x000017C8u, 0x000017CCu,
+    0x00000AE6u, 0x000017D4u, 0x000017FEu, 0x0000181Cu, 0x0000185Eu, 0x0000188Au, 0x000018A2u, 0x000018A8u,
+    0x000018D0u, 0x0000190Eu, 0x00000A74u, 0x00001934u, 0x00000D32u, 0x00001944u, 0x00000AE6u, 0x0000194Au,
+    0x00000000u, 0x00000000u, 0x00001958u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00001968u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00001978u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000197Eu, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00001984u, 0x00000A74u,
+    0x00000000u, 0x00000000u, 0x0000199Au, 0x00001484u, 0x00000000u, 0x00000C9Cu, 0x000019BCu, 0x00000000u,
+    0x00000C9Cu, 0x000019DCu, 0x00000A74u, 0x000019E8u, 0x000019F2u, 0x00000000u, 0x00000000u, 0x00001A04u,
+    0x00001A0Au, 0x00000E26u, 0x00000000u, 0x00000000u, 0x00000A74u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00001A1Eu, 0x00001A4Cu, 0x00001A54u, 0x00001A64u, 0x00001A74u, 0x00001AA6u,
+    0x00001AAEu, 0x00001430u, 0x00001ABEu, 0x00000AE6u, 0x00001B00u, 0x00001B06u, 0x00001B1Eu, 0x00001B2Eu,
+    0x00001B32u, 0x00001B70u, 0x00000000u, 0x00000C3Cu, 0x00001B88u, 0x00001B98u, 0x00001BB4u, 0x00001BE6u,
+    0x00001BECu, 0x00000000u, 0x00001BF0u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00001C0Cu, 0x00001C3Cu,
+    0x00000D32u, 0x00000000u, 0x00001C48u, 0x00000C3Cu, 0x00000000u, 0x00000C72u, 0x00001C76u, 0x00000000u,
+    0x00000AE6u, 0x00000C3Cu, 0x00001CA0u, 0x00001CA8u, 0x00001CB8u, 0x00001CF4u, 0x00000000u, 0x00000C76u,
+    0x00001D14u, 0x00000AE6u, 0x00001D20u, 0x00000000u, 0x00000AE6u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00001D3Cu, 0x00000FCAu, 0x00001D70u, 0x00001D8Eu, 0x00001DA8u, 0x00001DEEu,
+    0x00001DF6u, 0x00001E1Cu, 0x00001E28u, 0x00000A74u, 0x00001E5Au, 0x00001E6Eu, 0x00001E76u, 0x00001E7Eu,
+    0x00001E8Au, 0x00001ECCu, 0x00000A74u, 0x00001ED8u, 0x00001EE0u, 0x00001F08u, 0x00001F24u, 0x00000F66u,
+    0x00001F4Au, 0x00000000u, 0x00001F4Eu, 0x00001F58u, 0x00000000u, 0x00000000u, 0x00001F60u, 0x00001F78u,
+    0x00001F92u, 0x00001FB4u, 0x00001FCAu, 0x00001FE0u, 0x00001FE6u, 0x00002008u, 0x00002010u, 0x00000E26u,
+    0x00002034u, 0x00002040u, 0x00002072u, 0x00002090u, 0x000020C4u, 0x000020DCu, 0x00000A74u, 0x000020FEu,
+    0x00002134u, 0x00002152u, 0x00002168u, 0x00002184u, 0x00002192u, 0x000021A8u, 0x000021AEu, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x000021B4u, 0x00000C3Cu, 0x00000000u, 0x00000C9Cu, 0x000021E4u, 0x00000AE6u,
+    0x00000AE6u, 0x00002212u, 0x0000223Cu, 0x00000000u, 0x00002262u, 0x00002266u, 0x00000C3Cu, 0x00001430u,
+    0x0000227Au, 0x000022ACu, 0x00000000u, 0x000022BCu, 0x000022D0u, 0x000022E0u, 0x00002304u, 0x00000000u,
+    0x00001484u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x0000232Au, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x0000233Au, 0x0000237Cu, 0x0000238Cu, 0x000023A0u, 0x000023AAu, 0x000023F4u,
+    0x00002400u, 0x00002418u, 0x00002424u, 0x00001484u, 0x00002462u, 0x0000247Cu, 0x0000248Cu, 0x000024A0u,
+    0x000024B6u, 0x000024F4u, 0x00000000u, 0x0000250Cu, 0x00002520u, 0x00002544u, 0x0000255Eu, 0x00002580u,
+    0x00000A74u, 0x00000000u, 0x0000258Eu, 0x0000259Cu, 0x00000000u, 0x00000000u, 0x000025A2u, 0x00000D32u,
+    0x000025CEu, 0x00000D32u, 0x000025F4u, 0x00000C76u, 0x00001430u, 0x00002636u, 0x0000264Eu, 0x00000000u,
+    0x00002684u, 0x00002694u, 0x000026A8u, 0x00001F4Au, 0x000026BCu, 0x000026E4u, 0x000026FEu, 0x00000A74u,
+    0x00002704u, 0x00002734u, 0x0000276Au, 0x00000AE6u, 0x00002792u, 0x00000000u, 0x0000279Eu, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x000027B6u, 0x00001BECu, 0x00002802u, 0x00000C3Cu, 0x0000280Eu, 0x00001BECu,
+    0x00000C3Cu, 0x00002854u, 0x00002876u, 0x00000000u, 0x00000000u, 0x000028BCu, 0x000028D0u, 0x00001B2Eu,
+    0x000028D8u, 0x00000C3Cu, 0x00000000u, 0x00002914u, 0x0000292Au, 0x0000293Au, 0x0000294Eu, 0x00000AE6u,
+    0x0000297Eu, 0x00000000u, 0x00002992u, 0x000029A2u, 0x00000000u, 0x00000000u, 0x000029AAu, 0x000029C8u,
+    0x000029D6u, 0x000029F0u, 0x00002A0Au, 0x00002A18u, 0x00002A22u, 0x00000000u, 0x00002A2Cu, 0x00000E26u,
+    0x00000AE6u, 0x00002A44u, 0x00002A7Au, 0x00002A90u, 0x00002AB2u, 0x00002AC0u, 0x00000000u, 0x00002AD6u,
+    0x00002B10u, 0x00002B38u, 0x00002B52u, 0x00000F66u, 0x00000000u, 0x00002B5Au, 0x00000000u, 0x00002B60u,
+    0x00000000u, 0x00000000u, 0x00002B66u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00002B96u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00002BB8u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00002BEEu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00002C0Cu,
+    0x00000000u, 0x00000000u, 0x00002C10u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00002C14u, 0x00000A74u,
+    0x00001484u, 0x00000000u, 0x00002C3Eu, 0x00000000u, 0x00000000u, 0x00002C5Cu, 0x00002C62u, 0x00000000u,
+    0x00002C10u, 0x00002C82u, 0x00000000u, 0x00002C8Cu, 0x00002C92u, 0x00000E26u, 0x00000000u, 0x00002CA2u,
+    0x00002CACu, 0x00000AE6u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000C9Cu, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00002CBEu, 0x00000000u, 0x00002CD6u, 0x00000000u, 0x00002CDAu, 0x00000000u,
+    0x00000000u, 0x00002CEAu, 0x00002CF6u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00002D0Au, 0x00002D12u, 0x00002D1Eu, 0x00000000u, 0x00000000u, 0x00002D26u, 0x00002D2Eu, 0x00000000u,
+    0x00000000u, 0x00000C9Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00002D36u, 0x00000A74u,
+    0x00002D44u, 0x00000A74u, 0x00002D54u, 0x00000000u, 0x00002D66u, 0x00000C76u, 0x00000A74u, 0x00000000u,
+    0x00000000u, 0x00002D6Cu, 0x00002D7Eu, 0x00002D8Cu, 0x00002DA2u, 0x00002DBAu, 0x00000000u, 0x00002DD0u,
+    0x00002DE2u, 0x00002E00u, 0x00000000u, 0x00000000u, 0x00000A74u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00002E0Au, 0x00000AE6u, 0x00000000u, 0x00000000u, 0x00002E16u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00002E2Au, 0x00000000u, 0x00000000u, 0x00002E3Au, 0x00000AE6u, 0x00000000u,
+    0x00002E3Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x000009B0u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00002E4Eu,
+};
+
+constexpr uint8_t en_trie_nodes[] = {
+    0x00, 0x00, 0x17, 0x00, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C,
+    0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0xE4, 0x07, 0x00, 0x16, 0x08,
+    0x00, 0x28, 0x08, 0x00, 0x3E, 0x08, 0x00, 0x54, 0x08, 0x00, 0x8A, 0x08, 0x00, 0x94, 0x08, 0x00,
+    0xA6, 0x08, 0x00, 0xB8, 0x08, 0x00, 0xCE, 0x08, 0x00, 0xD4, 0x08, 0x00, 0xDE, 0x08, 0x00, 0xEC,
+    0x08, 0x00, 0x02, 0x09, 0x00, 0x10, 0x09, 0x00, 0x2A, 0x09, 0x00, 0x3C, 0x09, 0x00, 0x52, 0x09,
+    0x00, 0x70, 0x09, 0x00, 0x8A, 0x09, 0x00, 0x9C, 0x09, 0x00, 0xA6, 0x09, 0x00, 0xB0, 0x09, 0x00,
+    0x19, 0x00, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xB6, 0x09, 0x00, 0xD8, 0x09,
+    0x00, 0xF6, 0x09, 0x00, 0x1A, 0x0A, 0x00, 0x20, 0x0A, 0x00, 0x28, 0x0A, 0x00, 0x4A, 0x0A, 0x00,
+    0x5C, 0x0A, 0x00, 0x74, 0x0A, 0x00, 0x78, 0x0A, 0x00, 0x7E, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xB6,
+    0x0A, 0x00, 0xE6, 0x0A, 0x00, 0xEA, 0x0A, 0x00, 0x0C, 0x0B, 0x00, 0x12, 0x0B, 0x00, 0x4A, 0x0B,
+    0x00, 0x7C, 0x0B, 0x00, 0xA6, 0x0B, 0x00, 0xC4, 0x0B, 0x00, 0xD6, 0x0B, 0x00, 0xE8, 0x0B, 0x00,
+    0xEE, 0x0B, 0x00, 0xFC, 0x0B, 0x00, 0x15, 0x00, 0x61, 0x62, 0x64, 0x65, 0x66, 0x68, 0x69, 0x6A,
+    0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x06, 0x0C, 0x00,
+    0x30, 0x0C, 0x00, 0x3C, 0x0C, 0x00, 0x40, 0x0C, 0x00, 0x72, 0x0C, 0x00, 0x76, 0x0C, 0x00, 0x7A,
+    0x0C, 0x00, 0x74, 0x0A, 0x00, 0x9C, 0x0C, 0x00, 0xA0, 0x0C, 0x00, 0x3C, 0x0C, 0x00, 0xB8, 0x0C,
+    0x00, 0xC0, 0x0C, 0x00, 0xE6, 0x0A, 0x00, 0xEA, 0x0C, 0x00, 0xF8, 0x0C, 0x00, 0x00, 0x0D, 0x00,
+    0x10, 0x0D, 0x00, 0x74, 0x0A, 0x00, 0x32, 0x0D, 0x00, 0x36, 0x0D, 0x00, 0x10, 0x00, 0x61, 0x63,
+    0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6E, 0x6F, 0x71, 0x72, 0x73, 0x74, 0x75, 0x79, 0x7A, 0x40, 0x0D,
+    0x00, 0x74, 0x0D, 0x00, 0x84, 0x0D, 0x00, 0xAE, 0x0D, 0x00, 0xCE, 0x0D, 0x00, 0x0A, 0x0E, 0x00,
+    0x12, 0x0E, 0x00, 0x26, 0x0E, 0x00, 0x2A, 0x0E, 0x00, 0x74, 0x0A, 0x00, 0x66, 0x0E, 0x00, 0x7C,
+    0x0E, 0x00, 0x80, 0x0E, 0x00, 0x9C, 0x0E, 0x00, 0xC6, 0x0E, 0x00, 0xB0, 0x09, 0x00, 0x17, 0x00,
+    0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+    0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0xCA, 0x0E, 0x00, 0x74, 0x0A, 0x00, 0x26, 0x0E, 0x00,
+    0xFE, 0x0E, 0x00, 0x0A, 0x0F, 0x00, 0x3C, 0x0C, 0x00, 0x54, 0x0F, 0x00, 0x66, 0x0F, 0x00, 0x6A,
+    0x0F, 0x00, 0x74, 0x0A, 0x00, 0xAC, 0x0F, 0x00, 0xB0, 0x0F, 0x00, 0x74, 0x0A, 0x00, 0xCA, 0x0F,
+    0x00, 0xCE, 0x0F, 0x00, 0x74, 0x0A, 0x00, 0x12, 0x10, 0x00, 0x2E, 0x10, 0x00, 0x3E, 0x10, 0x00,
+    0x48, 0x10, 0x00, 0x74, 0x0A, 0x00, 0x74, 0x0A, 0x00, 0x70, 0x10, 0x00, 0x19, 0x00, 0x61, 0x62,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7C, 0x10, 0x00, 0xAA, 0x10, 0x00, 0xBA, 0x10, 0x00,
+    0xE4, 0x10, 0x00, 0x06, 0x11, 0x00, 0x30, 0x11, 0x00, 0x48, 0x11, 0x00, 0x66, 0x11, 0x00, 0x6E,
+    0x11, 0x00, 0x8E, 0x11, 0x00, 0x96, 0x11, 0x00, 0xA0, 0x11, 0x00, 0xC6, 0x11, 0x00, 0xEC, 0x11,
+    0x00, 0x1E, 0x12, 0x00, 0x48, 0x12, 0x00, 0x72, 0x12, 0x00, 0x7A, 0x12, 0x00, 0xB0, 0x12, 0x00,
+    0xE6, 0x12, 0x00, 0x10, 0x13, 0x00, 0x2C, 0x13, 0x00, 0x42, 0x13, 0x00, 0x54, 0x13, 0x00, 0x5A,
+    0x13, 0x00, 0x11, 0x00, 0x61, 0x62, 0x64, 0x65, 0x66, 0x68, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+    0x72, 0x73, 0x74, 0x75, 0x79, 0x68, 0x13, 0x00, 0x32, 0x0D, 0x00, 0xE6, 0x0A, 0x00, 0x90, 0x13,
+    0x00, 0xBA, 0x13, 0x00, 0xE6, 0x0A, 0x00, 0xCE, 0x13, 0x00, 0xF2, 0x13, 0x00, 0xE6, 0x0A, 0x00,
+    0xE6, 0x0A, 0x00, 0x0E, 0x14, 0x00, 0x32, 0x0D, 0x00, 0x1E, 0x14, 0x00, 0x30, 0x14, 0x00, 0x34,
+    0x14, 0x00, 0x40, 0x14, 0x00, 0xC6, 0x0E, 0x00, 0x12, 0x00, 0x61, 0x62, 0x64, 0x65, 0x67, 0x68,
+    0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0x79, 0x60, 0x14, 0x00, 0x84,
+    0x14, 0x00, 0x9C, 0x0C, 0x00, 0x88, 0x14, 0x00, 0xB2, 0x14, 0x00, 0xC2, 0x14, 0x00, 0xD0, 0x14,
+    0x00, 0x06, 0x15, 0x00, 0x1A, 0x15, 0x00, 0x22, 0x15, 0x00, 0x34, 0x15, 0x00, 0x84, 0x14, 0x00,
+    0x60, 0x15, 0x00, 0x78, 0x15, 0x00, 0x80, 0x15, 0x00, 0x86, 0x15, 0x00, 0x84, 0x14, 0x00, 0xA0,
+    0x15, 0x00, 0x12, 0x00, 0x61, 0x62, 0x65, 0x66, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+    0x72, 0x73, 0x74, 0x75, 0x77, 0x79, 0xAC, 0x15, 0x00, 0x74, 0x0A, 0x00, 0xE6, 0x15, 0x00, 0x74,
+    0x0A, 0x00, 0x74, 0x0A, 0x00, 0x1C, 0x16, 0x00, 0xE6, 0x0A, 0x00, 0x4E, 0x16, 0x00, 0x5A, 0x16,
+    0x00, 0x62, 0x16, 0x00, 0x6A, 0x16, 0x00, 0x32, 0x0D, 0x00, 0x94, 0x16, 0x00, 0xA0, 0x16, 0x00,
+    0xA8, 0x16, 0x00, 0xB6, 0x16, 0x00, 0xCC, 0x16, 0x00, 0xD4, 0x16, 0x00, 0x1A, 0x00, 0x61, 0x62,
     0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72,
-    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xFA, 0x29, 0xFA, 0x67, 0xFA, 0xD4, 0xFB, 0x30,
-    0xFB, 0x69, 0xFB, 0x9D, 0xFB, 0xF0, 0xD7, 0x3A, 0xFC, 0x0E, 0xFC, 0x11, 0xD6, 0xBC, 0xFC, 0x4D,
-    0xFC, 0xA8, 0xFD, 0x67, 0xFD, 0xB7, 0xFD, 0xEC, 0xFE, 0x12, 0xFE, 0x5A, 0xFE, 0xE6, 0xFF, 0xA1,
-    0xD8, 0x5D, 0xFF, 0xE6, 0xE0, 0xEC, 0xD9, 0xF3, 0xD6, 0xBC, 0xFF, 0xF6, 0x41, 0x71, 0xCF, 0x9C,
-    0x41, 0x65, 0xFD, 0x0B, 0x21, 0x6E, 0xFC, 0xA1, 0x02, 0x31, 0x61, 0xFD, 0x41, 0x61, 0xD1, 0x1B,
-    0x21, 0x75, 0xFC, 0xA3, 0x02, 0xE1, 0x63, 0x70, 0x6E, 0xE9, 0xF4, 0xFD, 0xA0, 0x18, 0x22, 0x21,
-    0x6D, 0xFD, 0x42, 0x73, 0x65, 0xCF, 0x8E, 0xFF, 0xFD, 0x42, 0x69, 0x79, 0xF2, 0x6C, 0xD6, 0x40,
-    0x21, 0x74, 0xF9, 0xC3, 0x03, 0xD1, 0x72, 0x73, 0x77, 0xFF, 0xEF, 0xFF, 0xFD, 0xCF, 0x77, 0x41,
-    0x70, 0xD6, 0xC2, 0x41, 0x67, 0xD8, 0x1D, 0x21, 0x64, 0xFC, 0x24, 0x61, 0x65, 0x6F, 0x75, 0xC9,
-    0xE9, 0xF5, 0xFD, 0x45, 0x2E, 0x62, 0x67, 0x69, 0x6C, 0xD7, 0x51, 0xD6, 0x94, 0xD6, 0x19, 0xD8,
-    0xBE, 0xCF, 0x45, 0xA0, 0x1A, 0x52, 0x21, 0x67, 0xFD, 0xA1, 0x01, 0x21, 0x6E, 0xFD, 0x21, 0x69,
-    0xFB, 0x41, 0x64, 0xE6, 0x5D, 0xC1, 0x00, 0x51, 0x74, 0xD7, 0x6E, 0x48, 0x64, 0x65, 0x67, 0x6C,
-    0x6E, 0x72, 0x73, 0x74, 0xD6, 0x4E, 0xE4, 0x86, 0xD6, 0x86, 0xFF, 0xF3, 0xFF, 0xF6, 0xD7, 0x8F,
-    0xFF, 0xFA, 0xDC, 0xD4, 0xA0, 0x0D, 0x22, 0x42, 0x6C, 0x6F, 0xD6, 0xF2, 0xCF, 0x22, 0xA0, 0x1A,
-    0x72, 0x21, 0x63, 0xFD, 0x21, 0x69, 0xFD, 0x42, 0x73, 0x74, 0xDA, 0x55, 0xFF, 0xFD, 0x44, 0x2E,
-    0x64, 0x65, 0x67, 0xD6, 0xDB, 0xCF, 0x27, 0xFF, 0xF9, 0xCE, 0xEA, 0xC1, 0x00, 0x51, 0x68, 0xD5,
-    0xB1, 0xC7, 0x02, 0xB1, 0x2E, 0x63, 0x6C, 0x6D, 0x6E, 0x70, 0x73, 0xD7, 0x9F, 0xFF, 0xD3, 0xFF,
-    0xD6, 0xD6, 0xC8, 0xFF, 0xED, 0xD6, 0x40, 0xFF, 0xFA, 0x41, 0x79, 0xD5, 0x90, 0xC2, 0x02, 0xB1,
-    0x65, 0x79, 0xFF, 0xFC, 0xD5, 0x8C, 0x42, 0x65, 0x6F, 0xDA, 0x16, 0xF4, 0x94, 0x41, 0x6E, 0xE4,
-    0x14, 0x21, 0x61, 0xFC, 0x21, 0x69, 0xFD, 0x44, 0x72, 0x73, 0x75, 0x76, 0xD5, 0x7D, 0xCE, 0x9E,
-    0xD5, 0xF0, 0xFF, 0xFD, 0x41, 0x6F, 0xD1, 0x65, 0x41, 0x61, 0xD5, 0xDF, 0xC4, 0x0A, 0x23, 0x63,
-    0x6C, 0x79, 0x68, 0xD6, 0x7D, 0xD5, 0xF5, 0xD6, 0x7D, 0xFF, 0xFC, 0x4F, 0x61, 0x62, 0x65, 0x66,
-    0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x77, 0xFF, 0x38, 0xD6, 0xEF, 0xFF,
-    0x60, 0xD5, 0xCC, 0xD5, 0xE6, 0xFF, 0xA6, 0xD5, 0xE6, 0xFF, 0xC2, 0xD6, 0xEF, 0xFF, 0xCB, 0xFF,
-    0xDC, 0xFF, 0xE9, 0xFF, 0xF1, 0xD5, 0x51, 0xD6, 0xEF, 0x42, 0x69, 0x6F, 0xDE, 0x54, 0xD6, 0x40,
-    0xA0, 0x1A, 0x93, 0xA1, 0x00, 0x41, 0x65, 0xFD, 0x21, 0x69, 0xFB, 0x42, 0x65, 0x79, 0xD6, 0x2E,
-    0xD5, 0x50, 0x43, 0x64, 0x65, 0x74, 0xF3, 0xA7, 0xCE, 0x51, 0xCE, 0x73, 0x41, 0x6E, 0xD0, 0x6E,
-    0x21, 0x65, 0xFC, 0x43, 0x67, 0x69, 0x63, 0xCE, 0x25, 0xCE, 0x37, 0xFF, 0xFD, 0x41, 0x6C, 0xD6,
-    0xA1, 0x43, 0x61, 0x65, 0x69, 0xD5, 0xC6, 0xFF, 0xFC, 0xDF, 0xC4, 0xC1, 0x01, 0x91, 0x61, 0xEE,
-    0x40, 0x41, 0x73, 0xD1, 0xF9, 0x21, 0x73, 0xFC, 0x21, 0x65, 0xFD, 0x21, 0x6E, 0xFD, 0x4B, 0x62,
-    0x63, 0x64, 0x67, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x76, 0x69, 0xFF, 0xAB, 0xFF, 0xBA, 0xFF, 0xBD,
-    0xEA, 0x5A, 0xD1, 0xC3, 0xFF, 0xC4, 0xFF, 0xD5, 0xCE, 0x37, 0xFF, 0xE3, 0xFF, 0xED, 0xFF, 0xFD,
-    0xC1, 0x03, 0xE2, 0x69, 0xCE, 0x42, 0xA0, 0x1A, 0xC3, 0x21, 0x64, 0xFD, 0x21, 0x6C, 0xFD, 0x42,
-    0x61, 0x69, 0xD7, 0x35, 0xFF, 0xFD, 0xC3, 0x0A, 0x23, 0x65, 0x69, 0x68, 0xCD, 0xC2, 0xD5, 0x11,
-    0xFF, 0xF9, 0x42, 0x65, 0x69, 0xD5, 0x1F, 0xD5, 0x1F, 0xA1, 0x02, 0x11, 0x72, 0xF9, 0xC1, 0x00,
-    0x51, 0x73, 0xD4, 0x86, 0xC1, 0x02, 0x21, 0x69, 0xD5, 0x95, 0xA3, 0x02, 0x41, 0x65, 0x69, 0x72,
-    0xEF, 0xF4, 0xFA, 0x41, 0x2E, 0xD6, 0xED, 0x21, 0x72, 0xFC, 0x21, 0x65, 0xFD, 0xA0, 0x11, 0xC2,
-    0x21, 0x61, 0xFD, 0xA2, 0x02, 0x81, 0x64, 0x73, 0xF7, 0xFD, 0xA0, 0x1B, 0x23, 0x21, 0x65, 0xFD,
-    0x21, 0x72, 0xFD, 0x21, 0x64, 0xFD, 0x21, 0x6E, 0xFD, 0x43, 0x2E, 0x67, 0x65, 0xD6, 0x37, 0xD6,
-    0x37, 0xFF, 0xFD, 0x41, 0x63, 0xCD, 0x7D, 0xA1, 0x02, 0x31, 0x69, 0xFC, 0x21, 0x74, 0xFB, 0x21,
-    0x61, 0xFD, 0x41, 0x64, 0xE5, 0x0D, 0x21, 0x69, 0xFC, 0x45, 0x2E, 0x63, 0x65, 0x74, 0x6F, 0xD4,
-    0x20, 0xD5, 0x5B, 0xE0, 0x4D, 0xE2, 0xB8, 0xFF, 0xFD, 0x42, 0x68, 0x72, 0xD4, 0x52, 0xD4, 0xA8,
-    0x41, 0x62, 0xCD, 0x59, 0x45, 0x61, 0x65, 0x67, 0x69, 0x6F, 0xFF, 0xFC, 0xCD, 0x34, 0xD5, 0x40,
-    0xF2, 0x95, 0xD5, 0x25, 0xC1, 0x02, 0x71, 0x2E, 0xD5, 0xEC, 0xC3, 0x00, 0xD1, 0x63, 0x71, 0x73,
-    0xD7, 0xAA, 0xD5, 0xE6, 0xFF, 0xFA, 0x43, 0x2E, 0x61, 0x73, 0xCD, 0x12, 0xCD, 0x12, 0xCD, 0x12,
-    0x21, 0x72, 0xF6, 0x42, 0x61, 0x65, 0xD4, 0x54, 0xFF, 0xFD, 0xC1, 0x02, 0x71, 0x65, 0xD3, 0xCF,
-    0xA0, 0x1A, 0xF3, 0x21, 0x62, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x74, 0xFD, 0x4C, 0x61, 0x62, 0x66,
-    0x67, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x76, 0x79, 0x63, 0xFF, 0x67, 0xD6, 0xD2, 0xD1, 0xD7, 0xFF,
-    0x7D, 0xFF, 0x93, 0xFF, 0x9D, 0xFF, 0xAD, 0xFF, 0xB8, 0xFF, 0xCE, 0xFF, 0xE7, 0xFF, 0xEE, 0xFF,
-    0xFD, 0xC1, 0x02, 0x41, 0x72, 0xD3, 0x9B, 0xC1, 0x01, 0x71, 0x72, 0xCE, 0x50, 0xC3, 0x08, 0x33,
-    0x61, 0x65, 0x6F, 0xFF, 0xFA, 0xD5, 0xB0, 0xCC, 0xCD, 0x45, 0x67, 0x6D, 0x72, 0x73, 0x74, 0xD4,
-    0x18, 0xD6, 0xB4, 0xE3, 0x5A, 0xD4, 0x18, 0xD6, 0xB7, 0x46, 0x69, 0x6F, 0x73, 0x74, 0x75, 0x79,
-    0xF9, 0xC3, 0xD6, 0xB1, 0xD3, 0x70, 0xE2, 0xE4, 0xD4, 0x90, 0xD3, 0xEE, 0x43, 0x61, 0x65, 0x69,
-    0xD3, 0xDB, 0xCF, 0x87, 0xD4, 0x98, 0x43, 0x65, 0x66, 0x6C, 0xCF, 0x22, 0xD4, 0x73, 0xD3, 0xEB,
-    0x41, 0x65, 0xD5, 0x40, 0x21, 0x74, 0xFC, 0x43, 0x61, 0x68, 0x72, 0xFF, 0xFD, 0xD4, 0x7D, 0xDD,
-    0x0E, 0xA0, 0x0D, 0x43, 0x44, 0x62, 0x69, 0x6F, 0x70, 0xD0, 0x99, 0xCC, 0x76, 0xD3, 0xCD, 0xEA,
-    0xA1, 0xC1, 0x06, 0x32, 0x61, 0xCC, 0x69, 0x44, 0x61, 0x65, 0x69, 0x6B, 0xD4, 0x42, 0xFF, 0xFA,
-    0xCC, 0x63, 0xCD, 0x69, 0xA0, 0x0D, 0x42, 0x42, 0x61, 0x73, 0xD5, 0x09, 0xF3, 0xA2, 0x21, 0x63,
-    0xF9, 0x41, 0x67, 0xE4, 0xD3, 0x21, 0x6F, 0xFC, 0xC3, 0x02, 0xB1, 0x2E, 0x69, 0x68, 0xD3, 0x61,
-    0xFF, 0xF6, 0xFF, 0xFD, 0x50, 0x61, 0x62, 0x63, 0x64, 0x66, 0x67, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
-    0x71, 0x73, 0x74, 0x76, 0x7A, 0xFF, 0x75, 0xFA, 0x67, 0xFF, 0x85, 0xFF, 0x98, 0xFF, 0xA2, 0xFF,
-    0xB3, 0xD4, 0x30, 0xFF, 0xBD, 0xFF, 0xC0, 0xFF, 0xD3, 0xD3, 0x2F, 0xFF, 0xE0, 0xE4, 0x6E, 0xFF,
-    0xF4, 0xE6, 0x02, 0xD4, 0x96, 0xC2, 0x00, 0x71, 0x6C, 0x74, 0xD3, 0x42, 0xCB, 0xF3, 0x21, 0x61,
-    0xF7, 0x41, 0x77, 0xD3, 0xD8, 0xC6, 0x02, 0x11, 0x61, 0x63, 0x67, 0x6C, 0x6E, 0x74, 0xD2, 0xB7,
-    0xD3, 0x32, 0xD3, 0x32, 0xD3, 0x32, 0xE3, 0x19, 0xE3, 0x19, 0xC1, 0x0D, 0x72, 0x61, 0xD2, 0xA2,
-    0xA0, 0x02, 0x12, 0x21, 0x68, 0xFD, 0xA2, 0x02, 0x81, 0x6E, 0x73, 0xF4, 0xFD, 0x41, 0x75, 0xCC,
-    0xBB, 0xC3, 0x02, 0x31, 0x71, 0x75, 0x77, 0xFF, 0xFC, 0xD2, 0xAE, 0xD2, 0x8B, 0x41, 0x6C, 0xD2,
-    0xEB, 0xA5, 0x02, 0xB1, 0x61, 0x65, 0x69, 0x6F, 0x66, 0xC0, 0xC4, 0xE5, 0xF0, 0xFC, 0x41, 0x6E,
-    0xED, 0x72, 0xA0, 0x01, 0xD2, 0x21, 0x6C, 0xFD, 0x21, 0x6C, 0xFD, 0xA1, 0x00, 0x41, 0x65, 0xFD,
-    0x42, 0x64, 0x6E, 0xD3, 0x79, 0xFF, 0xFB, 0xC3, 0x02, 0x41, 0x65, 0x69, 0x6F, 0xD2, 0xC9, 0xFF,
-    0xE7, 0xFF, 0xF9, 0xA0, 0x08, 0x63, 0xA0, 0x1B, 0x53, 0x21, 0x6F, 0xFD, 0x21, 0x74, 0xFD, 0x42,
-    0x61, 0x6F, 0xDD, 0x2A, 0xFF, 0xFD, 0x41, 0x63, 0xD3, 0x6E, 0x41, 0x73, 0xE4, 0x77, 0x44, 0x69,
-    0x6F, 0x75, 0x65, 0xFF, 0xF8, 0xD2, 0x2E, 0xD3, 0x66, 0xFF, 0xFC, 0xA0, 0x0A, 0xD2, 0xA1, 0x00,
-    0x51, 0x7A, 0xFD, 0x42, 0x67, 0x69, 0xD4, 0x0D, 0xFF, 0xFB, 0x43, 0x65, 0x69, 0x6D, 0xDE, 0x3C,
-    0xCB, 0x50, 0xD2, 0x8D, 0xC1, 0x00, 0x41, 0x74, 0xD5, 0x3C, 0x43, 0x61, 0x69, 0x6F, 0xFF, 0xFA,
-    0xD6, 0x84, 0xF1, 0x74, 0x42, 0x69, 0x79, 0xD5, 0x11, 0xD3, 0xEC, 0x21, 0x68, 0xF9, 0x21, 0x70,
-    0xFD, 0x44, 0x2E, 0x65, 0x6F, 0x74, 0xD3, 0xDF, 0xCB, 0x32, 0xFF, 0xFD, 0xCB, 0x17, 0x42, 0x6E,
-    0x74, 0xCF, 0xF9, 0xDA, 0x32, 0x41, 0x2E, 0xCA, 0xFD, 0x42, 0x64, 0x72, 0xFF, 0xFC, 0xFD, 0x6A,
-    0x21, 0x65, 0xF9, 0x21, 0x64, 0xFD, 0x4F, 0x2E, 0x62, 0x63, 0x66, 0x67, 0x6D, 0x6E, 0x6F, 0x70,
-    0x72, 0x73, 0x74, 0x75, 0x76, 0x61, 0xD2, 0xFE, 0xFF, 0x89, 0xD4, 0xD8, 0xD1, 0xC3, 0xFF, 0x98,
-    0xE4, 0xD0, 0xFF, 0xAD, 0xCF, 0xE1, 0xFF, 0xB4, 0xFF, 0xC4, 0xFF, 0xDB, 0xDB, 0x8F, 0xFF, 0xE8,
-    0xD1, 0xC3, 0xFF, 0xFD, 0x42, 0x61, 0x69, 0xD2, 0x13, 0xD1, 0x98, 0x42, 0x6E, 0x74, 0xD1, 0xC8,
-    0xD2, 0x0C, 0xC5, 0x02, 0x41, 0x61, 0x68, 0x69, 0x6C, 0x72, 0xF6, 0x7E, 0xFF, 0xF2, 0xFF, 0xF9,
-    0xD2, 0xA7, 0xD1, 0x8A, 0xC3, 0x08, 0x63, 0x63, 0x65, 0x69, 0xD2, 0x95, 0xD1, 0xD5, 0xE5, 0x60,
-    0x41, 0x65, 0xCA, 0xBF, 0x42, 0x67, 0x6E, 0xD1, 0x70, 0xFF, 0xFC, 0xC3, 0x02, 0xB1, 0x6E, 0x72,
-    0x61, 0xCA, 0x87, 0xE7, 0x00, 0xD1, 0xDC, 0x41, 0x79, 0xCD, 0x64, 0xA1, 0x00, 0x71, 0x6C, 0xFC,
-    0x21, 0x69, 0xFB, 0x41, 0x73, 0xD3, 0x2E, 0x42, 0x65, 0x73, 0xFF, 0xFC, 0xCA, 0x6B, 0xC1, 0x00,
-    0xD1, 0x72, 0xFA, 0xDE, 0xC6, 0x01, 0x91, 0x61, 0x65, 0x68, 0x69, 0x72, 0x75, 0xFF, 0xD0, 0xFF,
-    0xD7, 0xFF, 0xEC, 0xFF, 0xF3, 0xD2, 0xD6, 0xFF, 0xFA, 0x42, 0x68, 0x69, 0xCA, 0x49, 0xD1, 0x62,
-    0x42, 0x6E, 0x70, 0xD1, 0x5B, 0xCA, 0x54, 0x42, 0x2E, 0x69, 0xD1, 0x15, 0xEF, 0x87, 0xA0, 0x1B,
-    0xA2, 0x21, 0x2E, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x69, 0xFD, 0x44, 0x61, 0x69, 0x6E, 0x62, 0xD1,
-    0x97, 0xD2, 0xF6, 0xFF, 0xED, 0xFF, 0xFD, 0xC1, 0x01, 0xE1, 0x72, 0xCA, 0x33, 0x42, 0x73, 0x74,
-    0xCA, 0x15, 0xD0, 0x29, 0xA0, 0x1B, 0x82, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6B, 0xFD,
-    0x4C, 0x61, 0x62, 0x63, 0x65, 0x66, 0x69, 0x6D, 0x6F, 0x70, 0x73, 0x74, 0x6E, 0xD0, 0xE4, 0xD9,
-    0x6D, 0xFF, 0xB9, 0xFF, 0xC0, 0xCA, 0x08, 0xD0, 0xE7, 0xFF, 0xDA, 0xFF, 0xE7, 0xD0, 0xD9, 0xFF,
-    0xED, 0xDF, 0x71, 0xFF, 0xFD, 0xA0, 0x0D, 0x92, 0x42, 0x6E, 0x74, 0xD0, 0xB4, 0xFF, 0xFD, 0x21,
-    0x65, 0xF9, 0x41, 0x79, 0xD8, 0xB8, 0xC2, 0x05, 0x92, 0x65, 0x74, 0xD0, 0xA6, 0xFF, 0xFC, 0xA0,
-    0x1B, 0xC3, 0x21, 0x69, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0x61, 0xFD, 0xC6, 0x03, 0xD1, 0x61, 0x62,
-    0x6D, 0x6E, 0x73, 0x67, 0xD0, 0x8E, 0xD0, 0x8E, 0xD5, 0x13, 0xD6, 0x11, 0xFF, 0xEB, 0xFF, 0xFD,
-    0x57, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
-    0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0xFB, 0xAE, 0xFB, 0xD0, 0xFB, 0xE6, 0xFC, 0x0A,
-    0xFC, 0xBC, 0xFC, 0xE1, 0xFC, 0xED, 0xD8, 0xEA, 0xFD, 0x84, 0xD0, 0x79, 0xFD, 0xBE, 0xFE, 0x01,
-    0xFE, 0x27, 0xFE, 0x33, 0xFE, 0xB6, 0xFE, 0xF2, 0xD8, 0x5A, 0xFF, 0x04, 0xFF, 0x44, 0xFF, 0xA0,
-    0xFF, 0xCF, 0xDF, 0xEA, 0xFF, 0xEB, 0x41, 0x69, 0xD4, 0xBC, 0x43, 0x61, 0x68, 0x6C, 0xD3, 0x63,
-    0xFF, 0xFC, 0xD0, 0xC7, 0x42, 0x69, 0x6E, 0xCC, 0x25, 0xD2, 0x1C, 0x42, 0x67, 0x6E, 0xD0, 0x60,
-    0xD0, 0x29, 0x41, 0x70, 0xF9, 0xCA, 0x45, 0x64, 0x69, 0x6C, 0x74, 0x61, 0xD0, 0x13, 0xFF, 0xF5,
-    0xC9, 0xA8, 0xCC, 0x55, 0xFF, 0xFC, 0x43, 0x61, 0x73, 0x7A, 0xD1, 0xFA, 0xC9, 0x4A, 0xC9, 0x44,
-    0xA0, 0x1B, 0xF2, 0x21, 0x63, 0xFD, 0x21, 0x73, 0xFD, 0x43, 0x69, 0x2E, 0x75, 0xFF, 0xED, 0xD0,
-    0x50, 0xFF, 0xFD, 0xA0, 0x1C, 0xF3, 0x21, 0x6F, 0xFD, 0x21, 0x72, 0xFD, 0xA1, 0x01, 0x91, 0x68,
-    0xFD, 0x41, 0x65, 0xD0, 0x8F, 0x42, 0x6E, 0x7A, 0xFF, 0xFC, 0xCF, 0xDF, 0xA0, 0x1C, 0x12, 0x21,
-    0x6E, 0xFD, 0x21, 0x69, 0xFD, 0x44, 0x69, 0x6C, 0x76, 0x67, 0xFF, 0xF0, 0xCC, 0x06, 0xC9, 0x05,
-    0xFF, 0xFD, 0x43, 0x63, 0x65, 0x74, 0xD4, 0x3C, 0xC8, 0xE6, 0xC8, 0xF2, 0x42, 0x73, 0x7A, 0xCF,
-    0xEF, 0xEC, 0xEF, 0x43, 0x65, 0x68, 0x69, 0xD1, 0x9D, 0xCA, 0x64, 0xFF, 0xF9, 0xCB, 0x03, 0xD1,
-    0x62, 0x63, 0x67, 0x68, 0x69, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74, 0xD7, 0xF3, 0xFF, 0x6D, 0xFF,
-    0x77, 0xD7, 0xF3, 0xCD, 0xBA, 0xFF, 0x89, 0xFF, 0xAC, 0xFF, 0xBF, 0xFF, 0xD8, 0xFF, 0xE5, 0xFF,
-    0xF6, 0xA0, 0x0D, 0x82, 0x21, 0x74, 0xFD, 0x43, 0x6C, 0x6E, 0x76, 0xCF, 0x75, 0xE5, 0x51, 0xC8,
-    0xA1, 0xA2, 0x04, 0x02, 0x61, 0x69, 0xF3, 0xF6, 0x41, 0x6E, 0xDB, 0xDA, 0xA1, 0x00, 0xC1, 0x69,
-    0xFC, 0xA0, 0x1C, 0x32, 0x21, 0x63, 0xFD, 0x44, 0x61, 0x65, 0x63, 0x6F, 0xD1, 0x49, 0xCF, 0x94,
-    0xFF, 0xF5, 0xFF, 0xFD, 0xC3, 0x02, 0x41, 0x2E, 0x69, 0x79, 0xCF, 0x45, 0xFF, 0xF3, 0xEF, 0xD5,
-    0xA0, 0x1C, 0x52, 0x21, 0x6E, 0xFD, 0x21, 0x61, 0xFD, 0xA1, 0x02, 0x81, 0x72, 0xFD, 0x42, 0x6F,
-    0x74, 0xCB, 0x2B, 0xC8, 0x5A, 0xA0, 0x0D, 0xB2, 0xA1, 0x02, 0x81, 0x6F, 0xFD, 0xC1, 0x00, 0x51,
-    0x63, 0xC8, 0x63, 0xC1, 0x00, 0x41, 0x75, 0xC8, 0x6C, 0xC1, 0x02, 0x71, 0x65, 0xC8, 0x3F, 0xC7,
-    0x03, 0xD1, 0x61, 0x64, 0x65, 0x69, 0x73, 0x74, 0x2E, 0xFF, 0xEE, 0xC8, 0x76, 0xCF, 0x0A, 0xC8,
-    0x39, 0xFF, 0xF4, 0xFF, 0xFA, 0xCF, 0x6A, 0x41, 0x61, 0xCE, 0xF5, 0x21, 0x73, 0xFC, 0xC1, 0x02,
-    0x41, 0x74, 0xDA, 0x9E, 0xC1, 0x02, 0x31, 0x6C, 0xC8, 0x26, 0x42, 0x63, 0x65, 0xD0, 0xD6, 0xCE,
-    0xEA, 0xC2, 0x01, 0x41, 0x69, 0x79, 0xFF, 0xF9, 0xCF, 0x1A, 0x44, 0x61, 0x65, 0x68, 0x72, 0xFF,
-    0xEA, 0xCF, 0x3E, 0xF6, 0x41, 0xFF, 0xF7, 0x4B, 0x2E, 0x64, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x72,
-    0x73, 0x74, 0x76, 0xCE, 0xC2, 0xFF, 0x7D, 0xFF, 0x92, 0xFF, 0x97, 0xFF, 0xA1, 0xFF, 0xB8, 0xCF,
-    0xA0, 0xFF, 0xD4, 0xFF, 0xD7, 0xFF, 0xF3, 0xCF, 0x5A, 0xA0, 0x1C, 0x73, 0xA1, 0x00, 0x51, 0x62,
-    0xFD, 0x42, 0x61, 0x67, 0xFF, 0xFB, 0xC7, 0xC7, 0x41, 0x61, 0xCF, 0xCC, 0x43, 0x61, 0x65, 0x74,
-    0xCF, 0xC8, 0xEF, 0x1D, 0xFF, 0xFC, 0x41, 0x67, 0xCE, 0x12, 0x41, 0x69, 0xC9, 0x6A, 0x21, 0x6C,
-    0xFC, 0xA2, 0x01, 0x41, 0x61, 0x69, 0xF5, 0xFD, 0x22, 0x69, 0x6C, 0xE4, 0xF9, 0xC2, 0x01, 0x41,
-    0x69, 0x79, 0xC7, 0xB3, 0xCE, 0x6F, 0x21, 0x6C, 0xF7, 0xA0, 0x1C, 0xC3, 0x21, 0x74, 0xFD, 0x22,
-    0x72, 0x73, 0xFA, 0xFD, 0x21, 0x65, 0xFB, 0xA1, 0x01, 0x41, 0x74, 0xFD, 0xA0, 0x1C, 0xA2, 0x21,
-    0x2E, 0xFD, 0x21, 0x73, 0xFD, 0x47, 0x61, 0x64, 0x65, 0x67, 0x74, 0x75, 0x69, 0xC7, 0x73, 0xCF,
-    0x7F, 0xD1, 0x32, 0xFF, 0xE1, 0xC7, 0x73, 0xFF, 0xF2, 0xFF, 0xFD, 0x41, 0x2E, 0xC7, 0x5D, 0x21,
-    0x72, 0xFC, 0x41, 0x79, 0xCE, 0x2A, 0x42, 0x69, 0x72, 0xC7, 0x52, 0xFF, 0xFC, 0xC3, 0x02, 0x11,
-    0x65, 0x6C, 0x74, 0xFF, 0xF2, 0xC7, 0x63, 0xFF, 0xF9, 0x41, 0x68, 0xCE, 0x10, 0x4A, 0x2E, 0x61,
-    0x64, 0x67, 0x6C, 0x6E, 0x6F, 0x73, 0x74, 0x7A, 0xD0, 0x03, 0xCE, 0x4E, 0xFF, 0x74, 0xC7, 0x3B,
-    0xFF, 0x9B, 0xFF, 0xC8, 0xCB, 0xDA, 0xFF, 0xF0, 0xFF, 0xFC, 0xCE, 0x6C, 0xA0, 0x1C, 0xB2, 0x42,
-    0x72, 0x62, 0xF3, 0xA0, 0xFF, 0xFD, 0xA1, 0x02, 0xB1, 0x61, 0xF9, 0x41, 0x6E, 0xCE, 0xFE, 0xC3,
-    0x04, 0x02, 0x61, 0x69, 0x6F, 0xCE, 0x72, 0xFF, 0xFC, 0xCE, 0x72, 0xC1, 0x1D, 0x23, 0x69, 0xD0,
-    0xEA, 0x21, 0x74, 0xFA, 0xA1, 0x01, 0x91, 0x61, 0xFD, 0x21, 0x72, 0xFB, 0xA0, 0x0D, 0xD2, 0xC1,
-    0x00, 0xC1, 0x65, 0xC7, 0x01, 0x21, 0x73, 0xFA, 0xA0, 0x1D, 0x52, 0x42, 0x73, 0x63, 0xCD, 0xD4,
-    0xFF, 0xFD, 0x21, 0x65, 0xF9, 0x42, 0x74, 0x79, 0xC6, 0xEB, 0xCA, 0x69, 0x43, 0x61, 0x73, 0x7A,
-    0xC8, 0x5B, 0xEE, 0x0D, 0xCD, 0xDF, 0xA0, 0x1D, 0x72, 0x21, 0x6E, 0xFD, 0xA0, 0x11, 0x72, 0x44,
-    0x6C, 0x63, 0x65, 0x73, 0xCC, 0x02, 0xCA, 0xF7, 0xFF, 0xFA, 0xFF, 0xFD, 0x45, 0x65, 0x67, 0x69,
-    0x6F, 0x79, 0xFF, 0xD9, 0xCA, 0xC9, 0xFF, 0xE0, 0xFF, 0xF3, 0xD3, 0x19, 0xA0, 0x1D, 0x92, 0x21,
-    0x73, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x6E, 0xFD, 0xC2, 0x02, 0x81, 0x61, 0x6F, 0xDC, 0xD5, 0xFF,
-    0xFD, 0xC2, 0x00, 0xD1, 0x65, 0x70, 0xCE, 0xD6, 0xCD, 0x9A, 0xA0, 0x10, 0x12, 0x21, 0x74, 0xFD,
-    0xA1, 0x00, 0xF1, 0x65, 0xFD, 0x21, 0x68, 0xFB, 0x41, 0x6E, 0xE9, 0xB7, 0xA1, 0x02, 0x71, 0x69,
-    0xFC, 0x42, 0x66, 0x73, 0xCD, 0x3B, 0xFF, 0xFB, 0x41, 0x73, 0xD5, 0x8E, 0x21, 0x61, 0xFC, 0x21,
-    0x6C, 0xFD, 0xCE, 0x03, 0xD1, 0x63, 0x64, 0x67, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74,
-    0x75, 0x76, 0x65, 0xFF, 0x67, 0xFF, 0x6A, 0xD0, 0x5E, 0xFF, 0x73, 0xCD, 0x27, 0xFF, 0x80, 0xCF,
-    0xAA, 0xFF, 0xAA, 0xFF, 0xC6, 0xFF, 0xCF, 0xFF, 0xE3, 0xFF, 0xEF, 0xD0, 0x5B, 0xFF, 0xFD, 0xC1,
-    0x00, 0xA1, 0x62, 0xC6, 0x41, 0x42, 0x61, 0x69, 0xFF, 0xFA, 0xC6, 0x44, 0x21, 0x72, 0xF9, 0x41,
-    0x73, 0xCB, 0x62, 0x21, 0x61, 0xFC, 0xC5, 0x02, 0x11, 0x61, 0x65, 0x6E, 0x72, 0x73, 0xC6, 0x12,
-    0xD1, 0x10, 0xCF, 0xC0, 0xCC, 0xE6, 0xCC, 0xEE, 0x41, 0x74, 0xC7, 0xD2, 0x21, 0x69, 0xFC, 0x44,
-    0x72, 0x73, 0x75, 0x76, 0xC8, 0xD8, 0xFF, 0xFD, 0xCE, 0xEE, 0xC6, 0x1A, 0xC7, 0x04, 0x02, 0x61,
-    0x65, 0x68, 0x69, 0x6F, 0x74, 0x79, 0xFF, 0xD0, 0xD1, 0x6F, 0xFF, 0xD7, 0xFF, 0xDA, 0xFF, 0xF3,
-    0xCF, 0xFE, 0xCD, 0x1D, 0xA0, 0x1D, 0xB2, 0x21, 0x6B, 0xFD, 0x21, 0x63, 0xFD, 0xA1, 0x01, 0x41,
-    0x61, 0xFD, 0xC2, 0x0A, 0x23, 0x68, 0x69, 0xFF, 0xFB, 0xCC, 0x9A, 0xA0, 0x1D, 0xD2, 0xA1, 0x01,
-    0x01, 0x75, 0xFD, 0xA1, 0x02, 0xE1, 0x69, 0xFB, 0x42, 0x61, 0x74, 0xD5, 0x07, 0xFF, 0xFB, 0x41,
-    0x6F, 0xCF, 0xAE, 0x21, 0x72, 0xFC, 0xC6, 0x03, 0xD1, 0x6C, 0x6D, 0x6E, 0x70, 0x75, 0x64, 0xFF,
-    0xF2, 0xCD, 0xAE, 0xC7, 0x40, 0xCC, 0x73, 0xCD, 0x0B, 0xFF, 0xFD, 0x52, 0x61, 0x62, 0x63, 0x65,
-    0x66, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0xFC, 0xC2,
-    0xFC, 0xF6, 0xD6, 0x8E, 0xFD, 0x9C, 0xD4, 0x3F, 0xD4, 0xB5, 0xFE, 0x52, 0xCC, 0x5E, 0xD4, 0x3F,
-    0xFE, 0x7B, 0xFE, 0x84, 0xFF, 0x37, 0xFF, 0xA1, 0xD4, 0xB8, 0xFF, 0xC7, 0xCC, 0x5E, 0xFF, 0xEB,
-    0xCC, 0x5E, 0xC1, 0x08, 0x63, 0x75, 0xCD, 0x47, 0x43, 0x2E, 0x61, 0x74, 0xCC, 0x21, 0xCC, 0xB9,
-    0xCC, 0x24, 0x41, 0x72, 0xE8, 0xA6, 0x21, 0x65, 0xFC, 0xC1, 0x02, 0x31, 0x61, 0xCC, 0x1B, 0x42,
-    0x69, 0x74, 0xFF, 0xFA, 0xCC, 0x0A, 0x41, 0x69, 0xCC, 0x29, 0x41, 0x69, 0xCA, 0x77, 0xC3, 0x02,
-    0x11, 0x63, 0x69, 0x6B, 0xFF, 0xFC, 0xC6, 0x93, 0xC5, 0x24, 0x41, 0x2E, 0xDC, 0x54, 0x21, 0x73,
-    0xFC, 0xA1, 0x00, 0x71, 0x68, 0xFD, 0x45, 0x63, 0x65, 0x69, 0x6C, 0x6D, 0xFF, 0xFB, 0xCB, 0xE3,
-    0xC5, 0x24, 0xC5, 0x12, 0xCB, 0xE6, 0xC2, 0x01, 0x41, 0x63, 0x74, 0xC5, 0x02, 0xD2, 0xDE, 0x41,
-    0x6D, 0xDB, 0xA4, 0xC2, 0x02, 0x11, 0x61, 0x6F, 0xCC, 0x0B, 0xFF, 0xFC, 0xC2, 0x02, 0x11, 0x73,
-    0x74, 0xCA, 0xFA, 0xCC, 0xF8, 0xCC, 0x03, 0xD1, 0x62, 0x63, 0x67, 0x6B, 0x6C, 0x6D, 0x6E, 0x72,
-    0x73, 0x74, 0x75, 0x76, 0xFF, 0x8D, 0xFF, 0x93, 0xFF, 0xA1, 0xC4, 0xE3, 0xFF, 0xAA, 0xFF, 0xB1,
-    0xFF, 0xB9, 0xFF, 0xD1, 0xFF, 0xE1, 0xFF, 0xEE, 0xFF, 0xF7, 0xC5, 0x20, 0x41, 0x73, 0xE0, 0x89,
-    0xA0, 0x1D, 0xF3, 0x21, 0x74, 0xFD, 0x42, 0x6F, 0x73, 0xCB, 0x86, 0xFF, 0xFD, 0x42, 0x6C, 0x73,
-    0xCB, 0x7F, 0xCB, 0xFA, 0x43, 0x61, 0x65, 0x69, 0xCB, 0xF3, 0xFF, 0xF2, 0xFF, 0xF9, 0x42, 0x6E,
-    0x74, 0xCB, 0xDA, 0xCC, 0x03, 0x41, 0x75, 0xF1, 0xE7, 0x47, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72,
-    0x75, 0xC5, 0x9E, 0xFF, 0xD3, 0xFF, 0xEB, 0xFF, 0xF5, 0xFF, 0xFC, 0xCD, 0x01, 0xCD, 0x01, 0x42,
-    0x69, 0x6E, 0xCC, 0x6A, 0xCB, 0x4D, 0xC1, 0x02, 0xB1, 0x73, 0xCE, 0x06, 0x41, 0x6B, 0xCC, 0xDE,
-    0x21, 0x63, 0xFC, 0x45, 0x62, 0x66, 0x74, 0x7A, 0x65, 0xC4, 0x65, 0xDC, 0x5F, 0xCC, 0xD7, 0xCB,
-    0xB4, 0xFF, 0xFD, 0x42, 0x63, 0x72, 0xCB, 0x29, 0xC4, 0x55, 0x41, 0x68, 0xD3, 0xB3, 0x46, 0x61,
-    0x65, 0x69, 0x75, 0x77, 0x74, 0xFF, 0xD1, 0xFF, 0xD8, 0xFF, 0xE5, 0xFF, 0xF5, 0xCF, 0xF8, 0xFF,
-    0xFC, 0x41, 0x6B, 0xCB, 0x4A, 0x21, 0x63, 0xFC, 0xC2, 0x02, 0x81, 0x75, 0x61, 0xC4, 0x42, 0xFF,
-    0xFD, 0xC1, 0x02, 0x81, 0x6B, 0xCC, 0xEF, 0x41, 0x76, 0xC4, 0x39, 0xA1, 0x02, 0x31, 0x69, 0xFC,
-    0x21, 0x74, 0xFB, 0x42, 0x61, 0x65, 0xFF, 0xFD, 0xCC, 0xDD, 0x42, 0x61, 0x69, 0xCB, 0x77, 0xD2,
-    0xFD, 0x42, 0x69, 0x6F, 0xCA, 0xE3, 0xCB, 0x70, 0xC1, 0x03, 0xD1, 0x65, 0xCA, 0xD1, 0x42, 0x62,
-    0x72, 0xC4, 0x1B, 0xCB, 0xEB, 0xC4, 0x02, 0xB1, 0x61, 0x65, 0x69, 0x72, 0xFF, 0xF9, 0xCB, 0x24,
-    0xCE, 0x83, 0xC3, 0xF3, 0xA0, 0x0C, 0xB2, 0x21, 0x69, 0xFD, 0xC5, 0x03, 0xD1, 0x2E, 0x70, 0x74,
-    0x77, 0x6B, 0xD3, 0x06, 0xCA, 0xAF, 0xD3, 0x06, 0xCA, 0xAF, 0xFF, 0xFD, 0x41, 0x69, 0xF8, 0x6A,
-    0xC1, 0x02, 0x31, 0x65, 0xCA, 0x9C, 0x51, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x67, 0x6C, 0x6D, 0x6E,
-    0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0xD2, 0xEA, 0xCE, 0x63, 0xFF, 0x92, 0xFF, 0x9B,
-    0xD2, 0xEA, 0xFF, 0xAD, 0xFF, 0xB4, 0xFF, 0xBB, 0xFF, 0xC2, 0xCB, 0xCE, 0xCD, 0xCA, 0xCD, 0xC7,
-    0xFF, 0xCF, 0xFF, 0xE4, 0xFF, 0xF6, 0xFF, 0xFA, 0xCB, 0x2B, 0x41, 0x65, 0xF5, 0x87, 0x21, 0x74,
-    0xFC, 0x21, 0x69, 0xFD, 0x21, 0x6E, 0xFD, 0xA1, 0x02, 0x21, 0x69, 0xFD, 0x41, 0x62, 0xCB, 0x6D,
-    0xC1, 0x0E, 0x12, 0x73, 0xC3, 0x90, 0x21, 0x65, 0xFA, 0x42, 0x65, 0x69, 0xCA, 0x43, 0xCA, 0xBE,
-    0x43, 0x6C, 0x6E, 0x72, 0xCA, 0xB7, 0xFF, 0xF6, 0xFF, 0xF9, 0x42, 0x61, 0x6F, 0xCA, 0x3A, 0xCA,
-    0x9E, 0x43, 0x62, 0x6E, 0x74, 0xCA, 0xA6, 0xCA, 0x97, 0xCA, 0x2B, 0x41, 0x76, 0xC3, 0x47, 0x41,
-    0x72, 0xCA, 0x89, 0x42, 0x68, 0x70, 0xCA, 0x21, 0xFF, 0xFC, 0xC1, 0x02, 0xB1, 0x6D, 0xCB, 0x2F,
-    0x49, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x73, 0x75, 0x79, 0xFF, 0xBC, 0xFF, 0xD0, 0xFF, 0xDA,
-    0xFF, 0xE1, 0xE3, 0x41, 0xFF, 0xEB, 0xFF, 0xF3, 0xFF, 0xFA, 0xCA, 0x69, 0xC1, 0x00, 0x51, 0x62,
-    0xC4, 0xAB, 0xC2, 0x08, 0x33, 0x61, 0x65, 0xFF, 0xFA, 0xC3, 0x16, 0xC1, 0x01, 0xE1, 0x2E, 0xEF,
-    0x30, 0xC2, 0x06, 0xB2, 0x6E, 0x70, 0xFF, 0xFA, 0xCA, 0x70, 0x42, 0x61, 0x6C, 0xCA, 0x11, 0xCA,
-    0x67, 0xC1, 0x02, 0x31, 0x69, 0xC9, 0xD3, 0xC1, 0x02, 0x81, 0x63, 0xC9, 0xEB, 0x21, 0x69, 0xFA,
-    0xC1, 0x02, 0xB1, 0x69, 0xD2, 0x2D, 0xC2, 0x02, 0xB1, 0x65, 0x67, 0xD5, 0xE0, 0xC2, 0xE2, 0x42,
-    0x2E, 0x74, 0xCB, 0xA1, 0xC3, 0xD2, 0xC4, 0x02, 0x11, 0x68, 0x69, 0x6F, 0x72, 0xCA, 0xC3, 0xD3,
-    0x9B, 0xCD, 0x73, 0xC9, 0xE5, 0x4C, 0x61, 0x62, 0x64, 0x65, 0x66, 0x67, 0x6B, 0x6D, 0x6E, 0x6F,
-    0x73, 0x74, 0xFF, 0xBC, 0xFF, 0xC5, 0xFF, 0xCC, 0xCC, 0xD5, 0xFF, 0xD8, 0xCA, 0xDD, 0xC2, 0xC3,
-    0xFF, 0xDB, 0xFF, 0xE1, 0xCA, 0x2C, 0xFF, 0xEA, 0xFF, 0xF1, 0x42, 0x72, 0x74, 0xD6, 0x24, 0xC9,
-    0xED, 0x41, 0x75, 0xE0, 0xC8, 0xC4, 0x04, 0x22, 0x65, 0x69, 0x6C, 0x72, 0xFF, 0xF5, 0xCE, 0xA6,
-    0xCB, 0x05, 0xFF, 0xFC, 0xC1, 0x04, 0x02, 0x65, 0xE6, 0x0C, 0xC1, 0x00, 0x51, 0x74, 0xC2, 0x78,
-    0xA1, 0x01, 0x71, 0x65, 0xFA, 0x42, 0x61, 0x76, 0xD9, 0x57, 0xC2, 0x73, 0xC2, 0x0A, 0x23, 0x65,
-    0x69, 0xC2, 0x6C, 0xFF, 0xF9, 0xC1, 0x00, 0x51, 0x65, 0xC9, 0x76, 0x21, 0x6C, 0xFA, 0xA0, 0x1E,
-    0x23, 0x21, 0x73, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x72, 0xFD, 0x42, 0x6C, 0x65, 0xC9, 0x22, 0xFF,
-    0xFD, 0xC1, 0x01, 0x91, 0x65, 0xC2, 0x41, 0x41, 0x73, 0xC5, 0xB2, 0xA0, 0x0E, 0x32, 0x41, 0x73,
-    0xCB, 0x02, 0x21, 0x69, 0xFC, 0x21, 0x67, 0xFD, 0x22, 0x69, 0x6F, 0xF3, 0xFD, 0xA0, 0x08, 0x92,
-    0x21, 0x74, 0xFD, 0x43, 0x63, 0x7A, 0x73, 0xCA, 0x31, 0xE9, 0x86, 0xFF, 0xFD, 0x41, 0x6F, 0xD3,
-    0x71, 0x21, 0x6E, 0xFC, 0x45, 0x69, 0x6F, 0x79, 0x61, 0x65, 0xFF, 0xEF, 0xC9, 0x7D, 0xC9, 0x27,
-    0xE5, 0xAD, 0xFF, 0xFD, 0x41, 0x67, 0xC2, 0x04, 0x41, 0x6F, 0xC5, 0xA5, 0xC2, 0x00, 0x81, 0x7A,
-    0x73, 0xC8, 0xD0, 0xFF, 0xFC, 0x41, 0x71, 0xC1, 0xFF, 0xA3, 0x02, 0x31, 0x61, 0x69, 0x65, 0xEB,
-    0xF3, 0xFC, 0xA0, 0x0E, 0x53, 0xA0, 0x1D, 0x22, 0x21, 0x2E, 0xFD, 0x22, 0x69, 0x79, 0xF7, 0xFD,
-    0x21, 0x6C, 0xFB, 0xA1, 0x01, 0x91, 0x6F, 0xFD, 0x42, 0x62, 0x72, 0xC1, 0xE8, 0xCF, 0x87, 0x21,
-    0x61, 0xF9, 0x43, 0x63, 0x65, 0x74, 0xC8, 0x97, 0xC1, 0xC6, 0xC1, 0xDE, 0xC1, 0x03, 0xD1, 0x6E,
-    0xC9, 0xC8, 0xA0, 0x0E, 0x82, 0x41, 0x62, 0xC8, 0xF3, 0x22, 0x6C, 0x6D, 0xF9, 0xFC, 0x21, 0x65,
-    0xFB, 0x41, 0x6C, 0xC3, 0x36, 0x50, 0x62, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x70,
-    0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0xFF, 0x46, 0xFF, 0x55, 0xD6, 0x56, 0xC9, 0xAF, 0xFF, 0x5C,
-    0xFF, 0x62, 0xFF, 0x73, 0xFF, 0x8F, 0xFF, 0xB4, 0xFF, 0xCE, 0xFF, 0xDA, 0xFF, 0xDD, 0xCA, 0xB6,
-    0xFF, 0xE7, 0xFF, 0xF9, 0xFF, 0xFC, 0x41, 0x65, 0xC2, 0xBB, 0xC2, 0x07, 0x42, 0x69, 0x72, 0xC1,
-    0x6E, 0xFF, 0xFC, 0xC1, 0x02, 0xB1, 0x75, 0xC1, 0x65, 0x42, 0x62, 0x74, 0xC8, 0x3B, 0xFC, 0x31,
-    0xC1, 0x02, 0x31, 0x65, 0xDD, 0xC7, 0xC1, 0x02, 0x11, 0x73, 0xDB, 0x72, 0x42, 0x64, 0x67, 0xC4,
-    0x74, 0xC1, 0x46, 0xC1, 0x01, 0xE1, 0x6F, 0xCB, 0x4D, 0x41, 0x61, 0xC6, 0x93, 0xC9, 0x08, 0x63,
-    0x61, 0x63, 0x65, 0x69, 0x6C, 0x6D, 0x6F, 0x70, 0x74, 0xFF, 0xDC, 0xFF, 0xE3, 0xFF, 0xE9, 0xFF,
-    0xEF, 0xC8, 0x6C, 0xFF, 0xF6, 0xCD, 0x42, 0xCA, 0xF3, 0xFF, 0xFC, 0x41, 0x72, 0xC3, 0x3B, 0x42,
-    0x65, 0x67, 0xC8, 0x68, 0xDB, 0x39, 0xC5, 0x02, 0x81, 0x62, 0x65, 0x66, 0x6E, 0x70, 0xC7, 0xE6,
-    0xC1, 0x15, 0xC2, 0xB0, 0xFF, 0xF9, 0xC1, 0x12, 0x41, 0x6C, 0xC3, 0x6A, 0x21, 0x6C, 0xFC, 0x41,
-    0x70, 0xC4, 0x21, 0x22, 0x6F, 0x65, 0xF9, 0xFC, 0x41, 0x6D, 0xC6, 0xFE, 0xC6, 0x02, 0xB1, 0x61,
-    0x65, 0x69, 0x72, 0x73, 0x75, 0xE1, 0xCC, 0xFF, 0xCF, 0xFF, 0xDA, 0xFF, 0xF7, 0xC8, 0x55, 0xFF,
-    0xFC, 0x41, 0x66, 0xC1, 0x14, 0x42, 0x6E, 0x74, 0xC8, 0x22, 0xD0, 0x50, 0xC2, 0x01, 0x41, 0x65,
-    0x69, 0xC8, 0x0C, 0xC7, 0xA0, 0xA0, 0x0E, 0xA2, 0x49, 0x61, 0x64, 0x65, 0x66, 0x69, 0x6D, 0x6E,
-    0x6F, 0x74, 0xC8, 0x00, 0xC8, 0x29, 0xC8, 0x6F, 0xFF, 0xE9, 0xFF, 0xED, 0xFF, 0xF4, 0xFF, 0xFD,
-    0xC8, 0x0F, 0xD0, 0x25, 0x42, 0x6D, 0x70, 0xC0, 0xA4, 0xC0, 0xA4, 0xC1, 0x01, 0x91, 0x61, 0xC7,
-    0xEC, 0x59, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E,
-    0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A, 0xFB, 0xB4, 0xD8, 0xC5, 0xFC,
-    0x08, 0xFC, 0x4D, 0xFC, 0xD5, 0xFD, 0x16, 0xFD, 0x5F, 0xFD, 0x81, 0xFD, 0xD4, 0xC9, 0x09, 0xFE,
-    0x04, 0xFE, 0x13, 0xFE, 0x1F, 0xFE, 0x2B, 0xFE, 0xF4, 0xFF, 0x29, 0xC9, 0x09, 0xFF, 0x32, 0xFF,
-    0x5C, 0xFF, 0xAB, 0xFF, 0xD7, 0xD7, 0xE0, 0xDA, 0x5A, 0xFF, 0xF3, 0xFF, 0xFA, 0x41, 0x73, 0xE7,
-    0xAC, 0x21, 0x65, 0xFC, 0x42, 0x65, 0x74, 0xC0, 0x44, 0xC2, 0x16, 0xC5, 0x01, 0x91, 0x64, 0x6C,
-    0x72, 0x73, 0x74, 0xC0, 0x4F, 0xFF, 0xF6, 0xE8, 0xDC, 0xFF, 0xF9, 0xCE, 0x19, 0x42, 0x62, 0x72,
-    0xC9, 0xE0, 0xC6, 0xFF, 0xC1, 0x02, 0x11, 0x67, 0xC7, 0x00, 0xA1, 0x02, 0xB1, 0x6E, 0xFA, 0x41,
-    0x67, 0xCF, 0xD6, 0x21, 0x69, 0xFC, 0x46, 0x61, 0x65, 0x69, 0x72, 0x75, 0x6C, 0xFF, 0xE7, 0xC4,
-    0x47, 0xFF, 0xF4, 0xC7, 0x61, 0xC7, 0x28, 0xFF, 0xFD, 0xC2, 0x00, 0x51, 0x65, 0x61, 0xCB, 0x82,
-    0xC9, 0xB0, 0x42, 0x66, 0x6C, 0xC1, 0x85, 0xC7, 0xE7, 0x41, 0x61, 0xDA, 0xA0, 0x41, 0x64, 0xC7,
-    0xDC, 0x41, 0x69, 0xCC, 0xBC, 0x42, 0x63, 0x74, 0xC6, 0xF6, 0xFF, 0xFC, 0x43, 0x61, 0x65, 0x69,
-    0xFF, 0xF9, 0xC1, 0x6B, 0xEF, 0xE0, 0x41, 0x6F, 0xED, 0x26, 0x42, 0x6C, 0x72, 0xC7, 0x5D, 0xC9,
-    0x8D, 0x48, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x74, 0x75, 0xC8, 0x39, 0xFF, 0xC8, 0xFF, 0xD1,
-    0xFF, 0xD8, 0xFF, 0xDC, 0xFF, 0xEB, 0xFF, 0xF5, 0xFF, 0xF9, 0x41, 0x65, 0xC6, 0x8D, 0x41, 0x63,
-    0xC2, 0xD2, 0x21, 0x69, 0xFC, 0x43, 0x63, 0x6F, 0x74, 0xC6, 0xB6, 0xBF, 0xB5, 0xFF, 0xFD, 0xC1,
-    0x0E, 0xC2, 0x72, 0xC1, 0x28, 0x42, 0x2E, 0x73, 0xC6, 0x6F, 0xC6, 0x6F, 0x21, 0x74, 0xF9, 0x21,
-    0x63, 0xFD, 0x41, 0x6C, 0xC1, 0x18, 0x21, 0x6C, 0xFC, 0x25, 0x64, 0x69, 0x6F, 0x75, 0x65, 0xD1,
-    0xDC, 0xE6, 0xF6, 0xFD, 0x41, 0x67, 0xC6, 0x48, 0xA0, 0x1D, 0xC1, 0x21, 0x74, 0xFD, 0xA1, 0x02,
-    0x21, 0x73, 0xFD, 0x45, 0x6C, 0x6E, 0x72, 0x74, 0x76, 0xC7, 0x56, 0xFF, 0xF1, 0xFF, 0xFB, 0xD0,
-    0x02, 0xC6, 0xB4, 0x42, 0x65, 0x74, 0xC6, 0x31, 0xBF, 0x4F, 0xA1, 0x02, 0x11, 0x74, 0xF9, 0x21,
-    0x69, 0xFB, 0x42, 0x69, 0x6F, 0xC7, 0xF2, 0xC7, 0x37, 0x42, 0x72, 0x74, 0xEE, 0xDA, 0xFF, 0xF9,
-    0xC3, 0x02, 0xB1, 0x6E, 0x6F, 0x72, 0xC8, 0xF7, 0xC6, 0x0C, 0xC7, 0x29, 0xA0, 0x0E, 0xE2, 0x43,
-    0x65, 0x73, 0x74, 0xC6, 0x78, 0xFF, 0xFD, 0xC6, 0x3C, 0xC1, 0x01, 0x41, 0x79, 0xD7, 0x19, 0x41,
-    0x7A, 0xC7, 0x25, 0x21, 0x69, 0xFC, 0x41, 0x6F, 0xC7, 0x03, 0xC1, 0x03, 0xD1, 0x6E, 0xCE, 0x36,
-    0x48, 0x61, 0x65, 0x69, 0x6C, 0x6E, 0x72, 0x75, 0x79, 0xFF, 0xC9, 0xFF, 0xD0, 0xFF, 0xDF, 0xFF,
-    0xE9, 0xFF, 0xF3, 0xFF, 0xF6, 0xCC, 0xE4, 0xFF, 0xFA, 0xC1, 0x07, 0x82, 0x61, 0xF1, 0xB7, 0x41,
-    0x73, 0xBE, 0xFB, 0x21, 0x65, 0xFC, 0x41, 0x65, 0xCE, 0x47, 0x41, 0x65, 0xC5, 0xD5, 0x42, 0x67,
-    0x74, 0xC6, 0x29, 0xBF, 0xF2, 0x43, 0x6D, 0x6F, 0x74, 0xC5, 0xA7, 0xC6, 0x82, 0xE6, 0x67, 0xC8,
-    0x02, 0x81, 0x63, 0x64, 0x66, 0x67, 0x6C, 0x6E, 0x73, 0x74, 0xFF, 0xE4, 0xFF, 0xE7, 0xE5, 0x7A,
-    0xBE, 0xC9, 0xFF, 0xEB, 0xFF, 0xEF, 0xFF, 0xF6, 0xFF, 0xE7, 0x42, 0x6E, 0x73, 0xC5, 0xFD, 0xBE,
-    0xBD, 0xC2, 0x02, 0x41, 0x65, 0x69, 0xFF, 0xF9, 0xC9, 0xFD, 0xC2, 0x02, 0xB1, 0x6E, 0x73, 0xC6,
-    0x8F, 0xF8, 0x85, 0xC1, 0x02, 0x81, 0x65, 0xBE, 0xA1, 0x41, 0x72, 0xDB, 0x49, 0x21, 0x65, 0xFC,
-    0x42, 0x63, 0x74, 0xC5, 0xD7, 0xFF, 0xFD, 0x43, 0x72, 0x73, 0x74, 0xC5, 0x94, 0xFF, 0xF9, 0xC5,
-    0xD0, 0x42, 0x2E, 0x68, 0xC5, 0x4B, 0xC5, 0x8A, 0x42, 0x65, 0x69, 0xC5, 0x44, 0xD1, 0xF6, 0xA0,
-    0x1E, 0x53, 0x21, 0x6F, 0xFD, 0x21, 0x70, 0xFD, 0x21, 0x6F, 0xFD, 0xCB, 0x02, 0x81, 0x61, 0x63,
-    0x64, 0x66, 0x6C, 0x6E, 0x6F, 0x73, 0x74, 0x76, 0x67, 0xC5, 0xAC, 0xD7, 0x92, 0xC5, 0xE5, 0xD5,
-    0x93, 0xC5, 0x31, 0xE0, 0x35, 0xC5, 0x31, 0xFF, 0xE6, 0xFF, 0xED, 0xC5, 0x31, 0xFF, 0xFD, 0x41,
-    0x69, 0xBE, 0xD0, 0xA0, 0x09, 0xE3, 0x21, 0x6D, 0xFD, 0x21, 0x6F, 0xFD, 0x43, 0x67, 0x72, 0x6E,
-    0xFE, 0x45, 0xBE, 0x2C, 0xFF, 0xFD, 0x44, 0x62, 0x6D, 0x6E, 0x73, 0xC5, 0x35, 0xC7, 0x76, 0xC5,
-    0x35, 0xC4, 0xF6, 0x4C, 0x61, 0x64, 0x65, 0x66, 0x69, 0x6C, 0x6F, 0x70, 0x74, 0x75, 0x76, 0x79,
-    0xFF, 0x77, 0xFF, 0x80, 0xFF, 0x94, 0xC7, 0xFB, 0xFF, 0xB8, 0xFF, 0xDC, 0xFF, 0xE9, 0xC6, 0x10,
-    0xC8, 0x1A, 0xFF, 0xF3, 0xC8, 0x1A, 0xC5, 0x46, 0x43, 0x68, 0x6C, 0x74, 0xC4, 0xCC, 0xBE, 0x08,
-    0xFE, 0x09, 0x42, 0x65, 0x6C, 0xC7, 0xEB, 0xC5, 0x4F, 0x41, 0x73, 0xC9, 0x35, 0xC1, 0x01, 0x41,
-    0x72, 0xC6, 0x2A, 0xA0, 0x1E, 0x82, 0x21, 0x61, 0xFD, 0x21, 0x68, 0xFD, 0xC4, 0x02, 0x11, 0x6E,
-    0x72, 0x74, 0x63, 0xC5, 0x5B, 0xFF, 0xED, 0xFF, 0xF1, 0xFF, 0xFD, 0x42, 0x2E, 0x61, 0xC4, 0xD0,
-    0xC4, 0xD0, 0xC1, 0x01, 0xF1, 0x69, 0xC4, 0x8A, 0x44, 0x61, 0x63, 0x64, 0x6E, 0xC4, 0xFF, 0xFF,
-    0xF3, 0xC4, 0x84, 0xFF, 0xFA, 0x41, 0x64, 0xC6, 0x6B, 0x21, 0x6E, 0xFC, 0x21, 0x65, 0xFD, 0x42,
-    0x67, 0x6E, 0xBD, 0xD6, 0xC5, 0x8A, 0x42, 0x69, 0x72, 0xC4, 0xA5, 0xDA, 0xF6, 0x47, 0x61, 0x62,
-    0x65, 0x69, 0x6D, 0x6F, 0x70, 0xFF, 0x9B, 0xFF, 0xA5, 0xFF, 0xBF, 0xFF, 0xDB, 0xFF, 0xEF, 0xFF,
-    0xF2, 0xFF, 0xF9, 0xC2, 0x01, 0xF1, 0x63, 0x6E, 0xC4, 0xDE, 0xC4, 0xC4, 0x41, 0x6C, 0xC5, 0x78,
-    0xA1, 0x01, 0xF1, 0x69, 0xFC, 0xC1, 0x02, 0x41, 0x6F, 0xC4, 0x3F, 0x42, 0x6E, 0x73, 0xC4, 0xAC,
-    0xC4, 0x54, 0x44, 0x63, 0x6F, 0x73, 0x75, 0xC4, 0x96, 0xC4, 0xA5, 0xC4, 0x96, 0xC4, 0x2A, 0x41,
-    0x79, 0xC4, 0x5C, 0x21, 0x65, 0xFC, 0x42, 0x79, 0x69, 0xC4, 0x55, 0xFD, 0x98, 0x41, 0x6D, 0xEE,
-    0xAB, 0xA0, 0x1E, 0xA4, 0x21, 0x6E, 0xFD, 0x21, 0x6F, 0xFD, 0x45, 0x64, 0x6D, 0x72, 0x74, 0x75,
-    0xC7, 0x14, 0xFF, 0xEC, 0xFF, 0xF3, 0xFF, 0xFD, 0xC4, 0x7D, 0xC1, 0x01, 0x81, 0x72, 0xC1, 0xC1,
-    0x21, 0x69, 0xFA, 0xC2, 0x01, 0xE1, 0x70, 0x75, 0xFF, 0xFD, 0xBD, 0x0F, 0xC1, 0x07, 0xE2, 0x66,
-    0xBD, 0x33, 0x42, 0x65, 0x69, 0xD3, 0x21, 0xFF, 0xFA, 0xCC, 0x02, 0x11, 0x61, 0x63, 0x64, 0x65,
-    0x67, 0x69, 0x6B, 0x6F, 0x73, 0x74, 0x75, 0x76, 0xFF, 0x8A, 0xFF, 0x97, 0xFF, 0x9C, 0xFF, 0xA2,
-    0xC4, 0xB5, 0xFF, 0xA9, 0xFF, 0xBA, 0xFF, 0xD1, 0xFF, 0xEA, 0xFF, 0xF9, 0xCF, 0x2C, 0xC0, 0x6C,
-    0x42, 0x65, 0x69, 0xBC, 0xF0, 0xBC, 0xF0, 0x41, 0x64, 0xC4, 0x20, 0xC5, 0x02, 0x81, 0x64, 0x6B,
-    0x70, 0x72, 0x73, 0xFF, 0xF5, 0xC4, 0x36, 0xBF, 0xAC, 0xFF, 0xFC, 0xC1, 0xB8, 0xC1, 0x02, 0x71,
-    0x67, 0xC3, 0x8C, 0xA1, 0x01, 0xF1, 0x61, 0xFA, 0x42, 0x64, 0x72, 0xBC, 0xC8, 0xFF, 0xFB, 0xC2,
-    0x02, 0x41, 0x61, 0x65, 0xDC, 0xFB, 0xC4, 0xC3, 0x41, 0x2E, 0xC3, 0xE0, 0x21, 0x6D, 0xFC, 0x43,
-    0x6E, 0x74, 0x73, 0xDE, 0x71, 0xC3, 0xE8, 0xFF, 0xFD, 0x42, 0x6E, 0x73, 0xC3, 0x63, 0xC5, 0x19,
-    0x48, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x75, 0x79, 0xC3, 0xB9, 0xFF, 0xD8, 0xFF, 0xDF, 0xFF,
-    0xEF, 0xFF, 0xF9, 0xC4, 0xFA, 0xC3, 0xC8, 0xBC, 0xA0, 0x41, 0x67, 0xC7, 0xC5, 0xC4, 0x02, 0xB1,
-    0x2E, 0x67, 0x6C, 0x6E, 0xC3, 0x3F, 0xD6, 0x8B, 0xFC, 0x84, 0xFF, 0xFC, 0xC1, 0x00, 0x81, 0x6C,
-    0xC3, 0x30, 0x42, 0x68, 0x74, 0xBC, 0x6E, 0xC3, 0xDE, 0x44, 0x61, 0x69, 0x73, 0x77, 0xFF, 0xF3,
-    0xC3, 0x62, 0xFF, 0xF9, 0xBC, 0x49, 0x47, 0x61, 0x63, 0x6C, 0x6E, 0x6F, 0x74, 0x75, 0xCD, 0x43,
-    0xC3, 0xD1, 0xC3, 0x16, 0xC3, 0x82, 0xC4, 0xB4, 0xFE, 0xF9, 0xC3, 0x91, 0x41, 0x65, 0xBD, 0xCA,
-    0x42, 0x66, 0x75, 0xC2, 0xFC, 0xDE, 0x00, 0x41, 0x68, 0xC4, 0x2D, 0xC1, 0x02, 0x31, 0x6E, 0xBC,
-    0x35, 0x42, 0x65, 0x74, 0xFF, 0xFA, 0xBC, 0x11, 0xA0, 0x1E, 0xE3, 0x21, 0x74, 0xFD, 0x21, 0x69,
-    0xFD, 0x21, 0x6E, 0xFD, 0x41, 0x69, 0xBF, 0x2C, 0x44, 0x69, 0x79, 0x6F, 0x72, 0xC3, 0x13, 0xC3,
-    0x13, 0xFF, 0xF9, 0xFF, 0xFC, 0x41, 0x6C, 0xC4, 0x42, 0x21, 0x65, 0xFC, 0x21, 0x76, 0xFD, 0x43,
-    0x68, 0x79, 0x69, 0xFF, 0xE9, 0xC3, 0x52, 0xFF, 0xFD, 0x41, 0x6D, 0xC2, 0xB3, 0x4D, 0x61, 0x65,
-    0x67, 0x69, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x79, 0xFF, 0x70, 0xFF, 0x8C, 0xC3,
-    0x91, 0xFF, 0x99, 0xC7, 0x77, 0xFF, 0xAF, 0xFF, 0xB3, 0xC7, 0x31, 0xFF, 0xBA, 0xFF, 0xC4, 0xFF,
-    0xF2, 0xFF, 0xFC, 0xC4, 0x4D, 0xC1, 0x02, 0x21, 0x69, 0xC2, 0x84, 0x21, 0x70, 0xFA, 0xC3, 0x02,
-    0x81, 0x65, 0x6F, 0x72, 0xC3, 0x13, 0xFF, 0xFD, 0xC2, 0x7E, 0x43, 0x69, 0x6F, 0x79, 0xC4, 0x4A,
-    0xC2, 0xB1, 0xC2, 0xB1, 0x43, 0x65, 0x74, 0x75, 0xDB, 0xC7, 0xFF, 0xF6, 0xBB, 0x94, 0x41, 0x72,
-    0xD5, 0xAA, 0x21, 0x65, 0xFC, 0x43, 0x61, 0x6F, 0x68, 0xC2, 0xEC, 0xC2, 0xEC, 0xFF, 0xFD, 0xC1,
-    0x02, 0x81, 0x74, 0xC7, 0x19, 0x42, 0x6C, 0x74, 0xC2, 0x4F, 0xC2, 0x4F, 0x22, 0x61, 0x69, 0xF3,
-    0xF9, 0x47, 0x61, 0x63, 0x69, 0x6C, 0x6F, 0x70, 0x74, 0xC2, 0x7D, 0xFF, 0xBD, 0xFF, 0xD3, 0xC2,
-    0xD0, 0xC2, 0x98, 0xFF, 0xE4, 0xFF, 0xFB, 0x41, 0x65, 0xC0, 0x9D, 0x42, 0x2E, 0x73, 0xC2, 0x60,
-    0xC2, 0x29, 0xA0, 0x1F, 0x12, 0x21, 0x72, 0xFD, 0xA0, 0x0E, 0x72, 0x21, 0x72, 0xFD, 0x22, 0x65,
-    0x6F, 0xF7, 0xFD, 0xA1, 0x01, 0x41, 0x74, 0xFB, 0x23, 0x6C, 0x72, 0x73, 0xDF, 0xE3, 0xFB, 0xA0,
-    0x1F, 0x33, 0x21, 0x73, 0xFD, 0x42, 0x73, 0x6F, 0xC8, 0xFF, 0xFF, 0xFD, 0xC2, 0x01, 0x91, 0x65,
-    0x69, 0xFF, 0xF9, 0xE4, 0xC2, 0x43, 0x2E, 0x61, 0x65, 0xC2, 0x26, 0xC1, 0xEF, 0xC2, 0x62, 0x43,
-    0x63, 0x66, 0x73, 0xFF, 0xF6, 0xC2, 0x58, 0xC2, 0x58, 0x45, 0x61, 0x65, 0x68, 0x69, 0x6F, 0xF3,
-    0xF2, 0xFF, 0xCF, 0xFF, 0xE3, 0xFF, 0xF6, 0xC5, 0xD5, 0x41, 0x6F, 0xE9, 0x02, 0x21, 0x64, 0xFC,
-    0x42, 0x6C, 0x61, 0xC1, 0xFB, 0xFF, 0xFD, 0x41, 0x68, 0xBE, 0x52, 0x42, 0x63, 0x64, 0xBB, 0xF5,
-    0xBC, 0x7B, 0xC6, 0x02, 0x81, 0x62, 0x63, 0x65, 0x6C, 0x6E, 0x76, 0xFF, 0xEE, 0xFF, 0xF5, 0xC1,
-    0xCD, 0xC2, 0x3F, 0xFF, 0xF9, 0xC1, 0xB2, 0x43, 0x6E, 0x73, 0x74, 0xBB, 0x58, 0xBC, 0x50, 0xC2,
-    0x2A, 0x42, 0x6E, 0x72, 0xC2, 0x20, 0xFF, 0xF6, 0xA0, 0x1F, 0x63, 0x21, 0x2E, 0xFD, 0x21, 0x6E,
-    0xFD, 0x43, 0x73, 0x74, 0x61, 0xC1, 0xF6, 0xF5, 0x79, 0xFF, 0xFD, 0x41, 0x6C, 0xCC, 0xE4, 0x23,
-    0x65, 0x69, 0x6F, 0xE2, 0xF2, 0xFC, 0x42, 0x6C, 0x73, 0xC1, 0xA5, 0xC1, 0x89, 0x45, 0x64, 0x65,
-    0x69, 0x6E, 0x6F, 0xFB, 0xA9, 0xFF, 0xF9, 0xC1, 0xCB, 0xC8, 0x67, 0xC2, 0x7C, 0x41, 0x61, 0xC1,
-    0xBB, 0xA0, 0x12, 0x52, 0x21, 0x63, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x64, 0xFD, 0x21, 0x69, 0xFD,
-    0x59, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
-    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x78, 0xFA, 0x2B, 0xFA, 0x56, 0xFA, 0xA1,
-    0xFA, 0xE9, 0xFB, 0x03, 0xFB, 0x1F, 0xFB, 0x60, 0xFB, 0x79, 0xFB, 0x9F, 0xC1, 0x3C, 0xFB, 0xC1,
-    0xFC, 0x53, 0xFC, 0xDD, 0xFD, 0x69, 0xFD, 0x9B, 0xFD, 0xE0, 0xC2, 0xDA, 0xFE, 0x8D, 0xFF, 0x01,
-    0xFF, 0x69, 0xFF, 0x92, 0xFF, 0xCF, 0xFF, 0xDD, 0xFF, 0xED, 0xFF, 0xFD, 0x43, 0x61, 0x65, 0x74,
-    0xC1, 0x85, 0xC1, 0x85, 0xBA, 0x1C, 0x42, 0x6E, 0x74, 0xC2, 0xDA, 0xC1, 0x61, 0x21, 0x61, 0xF9,
-    0xC1, 0x01, 0x41, 0x6E, 0xBA, 0x02, 0x41, 0x74, 0xBD, 0x2D, 0x21, 0x61, 0xFC, 0xA1, 0x01, 0x41,
-    0x6D, 0xFD, 0x44, 0x61, 0x65, 0x74, 0x79, 0xB9, 0xF6, 0xD0, 0xDA, 0xBD, 0x09, 0xC1, 0x09, 0xC1,
-    0x01, 0xF1, 0x75, 0xC1, 0x52, 0xA0, 0x1F, 0x92, 0x21, 0x61, 0xFD, 0x42, 0x65, 0x72, 0xB9, 0xF5,
-    0xFF, 0xFD, 0x41, 0x65, 0xEC, 0x4B, 0xC1, 0x01, 0x81, 0x65, 0xBB, 0x61, 0x44, 0x62, 0x67, 0x6C,
-    0x6D, 0xBA, 0xAE, 0xFF, 0xEF, 0xFF, 0xF6, 0xFF, 0xFA, 0xC1, 0x02, 0x71, 0x6C, 0xB9, 0xD7, 0xC1,
-    0x02, 0x92, 0x73, 0xB9, 0xB9, 0x44, 0x61, 0x64, 0x65, 0x69, 0xFF, 0xE7, 0xC7, 0x8F, 0xFF, 0xF4,
-    0xFF, 0xFA, 0xC1, 0x02, 0x81, 0x72, 0xC0, 0x82, 0x42, 0x69, 0x79, 0xCD, 0xE4, 0xC0, 0x7C, 0x43,
-    0x65, 0x68, 0x72, 0xFF, 0xF3, 0xFF, 0xF9, 0xE3, 0xCA, 0xCB, 0x03, 0xD1, 0x63, 0x64, 0x67, 0x69,
-    0x6C, 0x6E, 0x70, 0x72, 0x74, 0x76, 0x79, 0xFF, 0x73, 0xC1, 0x80, 0xFF, 0x84, 0xFF, 0x87, 0xFF,
-    0x94, 0xFF, 0x99, 0xFF, 0xA6, 0xFF, 0xDC, 0xFF, 0xF6, 0xB9, 0x8F, 0xC1, 0x9B, 0xC1, 0x0E, 0xA2,
-    0x72, 0xC6, 0xA8, 0xC2, 0x02, 0x71, 0x61, 0x63, 0xBE, 0xAE, 0xB9, 0x65, 0xC2, 0x03, 0x42, 0x65,
-    0x69, 0xC1, 0x68, 0xFF, 0xF7, 0xC2, 0x01, 0x41, 0x64, 0x76, 0xB9, 0x53, 0xBF, 0xB3, 0x42, 0x61,
-    0x69, 0xC0, 0xB3, 0xB9, 0xE1, 0x41, 0x68, 0xB9, 0x43, 0x43, 0x61, 0x63, 0x74, 0xC0, 0xC1, 0xC1,
-    0x30, 0xFF, 0xFC, 0x43, 0x2E, 0x62, 0x67, 0xC1, 0x26, 0xBA, 0x17, 0xC1, 0x26, 0xC1, 0x01, 0x41,
-    0x73, 0xBE, 0x16, 0x42, 0x61, 0x65, 0xBD, 0x5A, 0xB9, 0x4C, 0x48, 0x61, 0x69, 0x6D, 0x6E, 0x6F,
-    0x74, 0x75, 0x76, 0xFF, 0xE9, 0xFF, 0xF3, 0xFF, 0xF9, 0xC1, 0x0F, 0xB9, 0x30, 0xBB, 0xFD, 0xBF,
-    0xFA, 0xB9, 0x2A, 0xC2, 0x02, 0x81, 0x65, 0x69, 0xC0, 0xB4, 0xC5, 0xDA, 0x4B, 0x2E, 0x61, 0x63,
-    0x64, 0x65, 0x6B, 0x6C, 0x6E, 0x6F, 0x72, 0x74, 0xBF, 0xCD, 0xFF, 0x91, 0xC3, 0x01, 0xFF, 0xA0,
-    0xFF, 0xA9, 0xB8, 0xFC, 0xFF, 0xB2, 0xFF, 0xBD, 0xC0, 0xAB, 0xFF, 0xDE, 0xFF, 0xF7, 0x41, 0x72,
-    0xBC, 0x4B, 0x43, 0x6E, 0x72, 0x73, 0xBC, 0x9F, 0xC0, 0x3F, 0xC1, 0x75, 0x41, 0x74, 0xD1, 0xAF,
-    0x41, 0x74, 0xBF, 0x13, 0xA0, 0x1F, 0xB3, 0x21, 0x6C, 0xFD, 0x21, 0x65, 0xFD, 0x22, 0x6E, 0x74,
-    0xF3, 0xFD, 0x21, 0x61, 0xFB, 0x46, 0x63, 0x65, 0x6E, 0x73, 0x7A, 0x6C, 0xBF, 0xF3, 0xC1, 0x7B,
-    0xBF, 0xBE, 0xFF, 0xE7, 0xC0, 0xBF, 0xFF, 0xFD, 0x42, 0x65, 0x69, 0xC0, 0xAC, 0xC1, 0x68, 0x43,
-    0x62, 0x6E, 0x72, 0xC0, 0xA5, 0xFF, 0xF9, 0xB8, 0x99, 0x4A, 0x2E, 0x61, 0x65, 0x69, 0x6C, 0x6F,
-    0x73, 0x74, 0x75, 0x79, 0xBF, 0x60, 0xFF, 0xB5, 0xFF, 0xB9, 0xFF, 0xDC, 0xC2, 0x94, 0xFF, 0xF6,
-    0xBF, 0x60, 0xBF, 0xA2, 0xC1, 0x57, 0xCD, 0xF8, 0xC1, 0x01, 0xE1, 0x6E, 0xB8, 0x6A, 0xA0, 0x1E,
-    0xB3, 0x21, 0x64, 0xFD, 0x43, 0x69, 0x79, 0x61, 0xC0, 0x0C, 0xBF, 0xCD, 0xFF, 0xFD, 0xC3, 0x01,
-    0x41, 0x61, 0x65, 0x69, 0xBF, 0x2E, 0xBF, 0x6D, 0xC1, 0x22, 0x42, 0x63, 0x6E, 0xC0, 0x5A, 0xBF,
-    0x61, 0x41, 0x61, 0xE8, 0xEE, 0x21, 0x72, 0xFC, 0xC3, 0x02, 0x81, 0x2E, 0x64, 0x6F, 0xC0, 0x31,
-    0xB8, 0x3A, 0xC0, 0x31, 0xC1, 0x0F, 0x02, 0x6E, 0xB8, 0x2E, 0xC1, 0x02, 0x21, 0x61, 0xBF, 0x0A,
-    0x42, 0x68, 0x75, 0xFF, 0xFA, 0xC2, 0x2D, 0x49, 0x61, 0x63, 0x64, 0x65, 0x67, 0x6C, 0x6E, 0x6F,
-    0x74, 0xFF, 0xB1, 0xFF, 0xBD, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xDE, 0xC4, 0x75, 0xFF, 0xE1, 0xFF,
-    0xED, 0xFF, 0xF9, 0xA0, 0x0F, 0x23, 0x42, 0x6E, 0x73, 0xC0, 0x0E, 0xBC, 0xED, 0xC1, 0x00, 0x51,
-    0x61, 0xBA, 0xF6, 0x41, 0x62, 0xBE, 0x55, 0x21, 0x61, 0xFC, 0x45, 0x61, 0x65, 0x67, 0x6E, 0x63,
-    0xB8, 0x00, 0xBA, 0xE9, 0xBE, 0xBF, 0xFF, 0xF3, 0xFF, 0xFD, 0xC1, 0x00, 0x51, 0x62, 0xB7, 0xD8,
-    0x21, 0x6D, 0xFA, 0xC4, 0x0F, 0x53, 0x61, 0x69, 0x6F, 0x75, 0xFF, 0xD3, 0xFF, 0xE7, 0xB8, 0x96,
-    0xFF, 0xFD, 0xA0, 0x0F, 0x82, 0x42, 0x6D, 0x74, 0xBE, 0x9F, 0xFF, 0xFD, 0xA0, 0x0F, 0xA2, 0xC2,
-    0x00, 0xC1, 0x74, 0x63, 0xC0, 0x81, 0xE8, 0x2D, 0x21, 0x6E, 0xF7, 0xA0, 0x1F, 0xE2, 0x21, 0x6F,
-    0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x68, 0xFD, 0x43, 0x74, 0x65, 0x70, 0xB7, 0xBF,
-    0xBA, 0xC6, 0xFF, 0xFD, 0x41, 0x2E, 0xCC, 0xFD, 0x22, 0x79, 0x65, 0xF2, 0xFC, 0xC1, 0x06, 0x32,
-    0x79, 0xBE, 0xF4, 0xC1, 0x03, 0xD1, 0x73, 0xB7, 0x91, 0xC1, 0x01, 0x41, 0x61, 0xBE, 0xE8, 0x41,
-    0x6E, 0xC0, 0x41, 0x4C, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75,
-    0xBE, 0xDE, 0xCA, 0x73, 0xFF, 0xB2, 0xFF, 0xB9, 0xFF, 0xC5, 0xFF, 0xE5, 0xC1, 0x5B, 0xBE, 0xDE,
-    0xFF, 0xEA, 0xFF, 0xF0, 0xFF, 0xF6, 0xFF, 0xFC, 0xC5, 0x02, 0x11, 0x64, 0x6C, 0x6E, 0x72, 0x74,
-    0xBF, 0x41, 0xBE, 0x24, 0xBE, 0x9F, 0xBE, 0x9F, 0xBE, 0x9F, 0x41, 0x69, 0xBB, 0x5F, 0x21, 0x73,
-    0xFC, 0xC3, 0x04, 0x02, 0x61, 0x65, 0x6F, 0xCE, 0xA0, 0xFF, 0xE7, 0xFF, 0xFD, 0x41, 0x79, 0xB7,
-    0xC2, 0x42, 0x69, 0x6F, 0xBF, 0xEF, 0xB7, 0x3F, 0x41, 0x61, 0xB7, 0xF7, 0x41, 0x6C, 0xB7, 0xDA,
-    0x43, 0x65, 0x73, 0x70, 0xBE, 0x67, 0xBF, 0x24, 0xFF, 0xFC, 0xA0, 0x20, 0x02, 0x21, 0x63, 0xFD,
-    0x21, 0x61, 0xFD, 0x41, 0x75, 0xB7, 0x11, 0x21, 0x65, 0xFC, 0x4A, 0x63, 0x65, 0x66, 0x6C, 0x72,
-    0x73, 0x74, 0x76, 0x6D, 0x6E, 0xFF, 0xD7, 0xB8, 0x9F, 0xFF, 0xDE, 0xB7, 0xF7, 0xB7, 0x10, 0xFF,
-    0xE6, 0xBF, 0x5A, 0xB7, 0x10, 0xFF, 0xF6, 0xFF, 0xFD, 0xA0, 0x0F, 0xC2, 0x21, 0x74, 0xFD, 0xC1,
-    0x00, 0x51, 0x6F, 0xB8, 0x68, 0x43, 0x65, 0x6E, 0x73, 0xC7, 0x05, 0xFF, 0xF7, 0xFF, 0xFA, 0x41,
-    0x73, 0xB8, 0x67, 0x21, 0x73, 0xFC, 0xA0, 0x20, 0x22, 0x21, 0x2E, 0xFD, 0x21, 0x79, 0xFD, 0x21,
-    0x74, 0xFD, 0x43, 0x61, 0x65, 0x69, 0xBE, 0x05, 0xFF, 0xF1, 0xFF, 0xFD, 0x41, 0x69, 0xBB, 0x97,
-    0x41, 0x65, 0xBD, 0x08, 0x46, 0x63, 0x66, 0x6C, 0x73, 0x74, 0x67, 0xFF, 0xEE, 0xFF, 0xF8, 0xB6,
-    0xB6, 0xBA, 0x69, 0xB6, 0xB0, 0xFF, 0xFC, 0xC4, 0x02, 0x81, 0x61, 0x65, 0x69, 0x6F, 0xFF, 0x66,
-    0xFF, 0x93, 0xFF, 0xBE, 0xFF, 0xED, 0xA0, 0x20, 0x64, 0x22, 0x64, 0x66, 0xFD, 0xFD, 0xA1, 0x20,
-    0x42, 0x6F, 0xFB, 0x21, 0x64, 0xFB, 0xA1, 0x02, 0x11, 0x75, 0xFD, 0xC3, 0x08, 0x63, 0x65, 0x68,
-    0x69, 0xFF, 0xFB, 0xBD, 0xD6, 0xF2, 0xF1, 0x41, 0x62, 0xF4, 0x24, 0xA0, 0x20, 0xA2, 0x21, 0x74,
-    0xFD, 0x21, 0x61, 0xFD, 0x21, 0x6D, 0xFD, 0xA0, 0x20, 0xC2, 0x21, 0x6C, 0xFD, 0x21, 0x6F, 0xFD,
-    0xC8, 0x03, 0xE2, 0x61, 0x65, 0x68, 0x69, 0x75, 0x77, 0x6F, 0x72, 0xFF, 0xE7, 0xBD, 0x79, 0xBD,
-    0x79, 0xB7, 0xE9, 0xB6, 0x4B, 0xBE, 0x39, 0xFF, 0xF4, 0xFF, 0xFD, 0xA0, 0x13, 0xE2, 0x21, 0x63,
-    0xFD, 0x21, 0x73, 0xFD, 0xA1, 0x00, 0x71, 0x65, 0xFD, 0x42, 0x65, 0x69, 0xBB, 0x1C, 0xD2, 0x7F,
-    0xC3, 0x02, 0x81, 0x65, 0x72, 0x74, 0xC9, 0xE0, 0xBD, 0x2B, 0xFF, 0xF9, 0x49, 0x62, 0x65, 0x66,
-    0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0xFF, 0xE8, 0xB6, 0x0C, 0xB6, 0x0C, 0xC6, 0x11, 0xBD, 0x75,
-    0xC0, 0x11, 0xB6, 0x0F, 0xBE, 0xD4, 0xFF, 0xF4, 0x53, 0x61, 0x62, 0x64, 0x65, 0x66, 0x67, 0x68,
-    0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0xFC, 0x61, 0xC4, 0xA2,
-    0xBD, 0x59, 0xFC, 0xF4, 0xBC, 0xC1, 0xBC, 0xC1, 0xFD, 0x61, 0xFD, 0xCF, 0xFD, 0xEB, 0xFE, 0x1B,
-    0xC4, 0xA2, 0xC5, 0x32, 0xFE, 0x7B, 0xFE, 0xB9, 0xFF, 0x5F, 0xFF, 0x83, 0xFF, 0xA8, 0xFF, 0xE4,
-    0xBD, 0x3F, 0xA0, 0x20, 0xE2, 0x21, 0x65, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0xC2, 0x21,
-    0x03, 0x72, 0x73, 0xBA, 0xC5, 0xBA, 0xC5, 0x21, 0x69, 0xF7, 0x43, 0x76, 0x69, 0x73, 0xB5, 0xB6,
-    0xFF, 0xF1, 0xFF, 0xFD, 0x43, 0x2E, 0x72, 0x74, 0xC4, 0xBC, 0xBD, 0xA0, 0xBD, 0xA0, 0xA0, 0x21,
-    0x32, 0x21, 0x73, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x74, 0xFD, 0x41, 0x72, 0xDF,
-    0x21, 0x21, 0x61, 0xFC, 0x22, 0x6E, 0x76, 0xF6, 0xFD, 0xA3, 0x02, 0x81, 0x61, 0x65, 0x69, 0xD1,
-    0xDB, 0xFB, 0x21, 0x75, 0xF7, 0x41, 0x63, 0xBD, 0xD5, 0x42, 0x69, 0x6F, 0xFF, 0xFC, 0xEB, 0x99,
-    0x21, 0x6C, 0xF9, 0xC2, 0x02, 0x41, 0x69, 0x6F, 0xBC, 0x68, 0xFF, 0xFD, 0x42, 0x65, 0x75, 0xB5,
-    0x46, 0xBC, 0x5F, 0x42, 0x68, 0x6C, 0xFF, 0xF9, 0xBC, 0x19, 0x42, 0x66, 0x74, 0xC3, 0x1A, 0xB5,
-    0x3E, 0xA0, 0x21, 0x54, 0x21, 0x7A, 0xFD, 0x21, 0x69, 0xFD, 0xA1, 0x00, 0x71, 0x72, 0xFD, 0x42,
-    0x74, 0x6E, 0xFF, 0xFB, 0xBC, 0x5A, 0x43, 0x65, 0x69, 0x6F, 0xFF, 0xF9, 0xBC, 0x53, 0xC1, 0xDD,
-    0x45, 0x65, 0x67, 0x69, 0x6F, 0x68, 0xB8, 0x81, 0xB5, 0x55, 0xBD, 0x09, 0xBB, 0xF4, 0xEE, 0xBC,
-    0x42, 0x65, 0x68, 0xB7, 0xA8, 0xC2, 0xBB, 0xC1, 0x00, 0x41, 0x66, 0xB5, 0x19, 0x43, 0x63, 0x65,
-    0x69, 0xB5, 0x13, 0xFF, 0xFA, 0xD0, 0xE4, 0x41, 0x6E, 0xBA, 0x0F, 0x21, 0x6F, 0xFC, 0x21, 0x69,
-    0xFD, 0x42, 0x61, 0x65, 0xE3, 0x2A, 0xCB, 0xCB, 0x41, 0x69, 0xC0, 0x36, 0x41, 0x67, 0xEE, 0x20,
-    0x42, 0x67, 0x6F, 0xE9, 0x8B, 0xFF, 0xFC, 0x21, 0x69, 0xF9, 0x50, 0x62, 0x63, 0x66, 0x69, 0x6C,
-    0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x7A, 0x64, 0x6F, 0xFF, 0x79, 0xFF, 0x89, 0xFF,
-    0x90, 0xBB, 0xFF, 0xBE, 0xD6, 0xFF, 0xAC, 0xFF, 0xB6, 0xFF, 0xC6, 0xFF, 0xD3, 0xBB, 0xFF, 0xFF,
-    0xE4, 0xB6, 0x37, 0xFF, 0xE7, 0xFF, 0xEE, 0xFF, 0xFD, 0xF1, 0x85, 0x42, 0x62, 0x67, 0xBC, 0x8E,
-    0xBC, 0x8E, 0xA0, 0x21, 0x92, 0x42, 0x2E, 0x65, 0xBB, 0x6F, 0xFF, 0xFD, 0xC2, 0x02, 0x11, 0x65,
-    0x67, 0xBB, 0x60, 0xFF, 0xF9, 0xC2, 0x00, 0xD1, 0x66, 0x6E, 0xB4, 0x83, 0xFF, 0xF7, 0xC3, 0x02,
-    0xB1, 0x61, 0x69, 0x6F, 0xFF, 0xDD, 0xFF, 0xF7, 0xBB, 0xE3, 0xC1, 0x02, 0x11, 0x6E, 0xB4, 0x68,
-    0x42, 0x61, 0x65, 0xBB, 0xB7, 0xB4, 0x6B, 0x42, 0x62, 0x74, 0xD2, 0x9E, 0xBB, 0xCA, 0x41, 0x6D,
-    0xB5, 0xE9, 0xA4, 0x02, 0xB1, 0x65, 0x68, 0x69, 0x75, 0xE8, 0xEE, 0xF5, 0xFC, 0x41, 0x6C, 0xBC,
-    0x3C, 0xC1, 0x00, 0x41, 0x67, 0xBB, 0x5A, 0xC3, 0x02, 0x81, 0x61, 0x65, 0x6E, 0xB4, 0x41, 0xB4,
-    0x44, 0xFF, 0xFA, 0x22, 0x61, 0x69, 0xEA, 0xF4, 0x45, 0x6C, 0x6E, 0x72, 0x76, 0x77, 0xBB, 0x70,
-    0xBB, 0x43, 0xC3, 0x12, 0xBC, 0xF8, 0xBB, 0x99, 0x41, 0x61, 0xBB, 0x68, 0x21, 0x72, 0xFC, 0x41,
-    0x70, 0xB8, 0x36, 0x42, 0x6C, 0x6D, 0xC5, 0xD6, 0xFF, 0xFC, 0xA0, 0x21, 0xB3, 0x21, 0x72, 0xFD,
-    0x21, 0x70, 0xFD, 0xA0, 0x21, 0xE2, 0x21, 0x67, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x61, 0xFD, 0x44,
-    0x6F, 0x72, 0x69, 0x74, 0xFF, 0xE4, 0xBB, 0xA1, 0xFF, 0xF1, 0xFF, 0xFD, 0x42, 0x73, 0x74, 0xBA,
-    0xFF, 0xB4, 0x04, 0xC2, 0x03, 0x42, 0x65, 0x69, 0xBB, 0x25, 0xFF, 0xF9, 0xC1, 0x02, 0x81, 0x72,
-    0xBB, 0x64, 0x44, 0x61, 0x65, 0x69, 0x79, 0xDE, 0x03, 0xFF, 0xFA, 0xBA, 0xE9, 0xBB, 0x3F, 0x41,
-    0x69, 0xF4, 0xE0, 0x42, 0x69, 0x75, 0xBB, 0x05, 0xBA, 0xA1, 0x42, 0x61, 0x65, 0xD1, 0xFB, 0xB3,
-    0xBE, 0x21, 0x74, 0xF9, 0x41, 0x73, 0xBD, 0x9A, 0x43, 0x69, 0x6F, 0x75, 0xBB, 0x5F, 0xFF, 0xFC,
-    0xBA, 0xF0, 0xC3, 0x08, 0xA2, 0x69, 0x6F, 0x75, 0xBB, 0x97, 0xB3, 0xA0, 0xBA, 0x82, 0x41, 0x69,
-    0xE6, 0x62, 0xC2, 0x00, 0xD1, 0x61, 0x72, 0xBB, 0x91, 0xBA, 0xA9, 0x44, 0x2E, 0x70, 0x73, 0x74,
-    0xBB, 0x7E, 0xBD, 0x73, 0xFF, 0xF3, 0xFF, 0xF7, 0x41, 0x7A, 0xD4, 0x02, 0x41, 0x75, 0xCE, 0xF2,
-    0xA1, 0x01, 0xE1, 0x62, 0xFC, 0x21, 0x69, 0xFB, 0x43, 0x65, 0x69, 0x72, 0xBD, 0x82, 0xFF, 0xF0,
-    0xFF, 0xFD, 0xC1, 0x00, 0xD1, 0x74, 0xE1, 0xA9, 0x43, 0x2E, 0x73, 0x74, 0xBB, 0xF5, 0xBA, 0x3C,
-    0xBA, 0x3C, 0x42, 0x6C, 0x72, 0xB3, 0x68, 0xFF, 0xF6, 0x41, 0x6C, 0xD9, 0x95, 0xC4, 0x00, 0xD1,
-    0x61, 0x65, 0x69, 0x6F, 0xC9, 0x6A, 0xFF, 0xF5, 0xBB, 0x46, 0xFF, 0xFC, 0x52, 0x2E, 0x61, 0x62,
-    0x63, 0x64, 0x66, 0x67, 0x69, 0x6C, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0xC2,
-    0x64, 0xFF, 0x0C, 0xFF, 0x20, 0xFF, 0x43, 0xFF, 0x57, 0xFF, 0x66, 0xFF, 0x73, 0xBA, 0x33, 0xFF,
-    0x77, 0xFF, 0x85, 0xBA, 0x7C, 0xFF, 0x8C, 0xFF, 0x96, 0xFF, 0xAF, 0xFF, 0xCC, 0xFF, 0xD6, 0xFF,
-    0xF1, 0xBF, 0x4B, 0xC2, 0x02, 0xB1, 0x75, 0x79, 0xB3, 0x05, 0xBA, 0xF6, 0x42, 0x72, 0x74, 0xBA,
-    0x0F, 0xBA, 0x4B, 0xC1, 0x00, 0x51, 0x67, 0xBA, 0x08, 0x44, 0x63, 0x6E, 0x73, 0x74, 0xBA, 0x3E,
-    0xFF, 0xFA, 0xB9, 0xC3, 0xB9, 0xC3, 0xC5, 0x02, 0x81, 0x65, 0x69, 0x6C, 0x6F, 0x75, 0xFF, 0xE6,
-    0xFF, 0xF3, 0xBB, 0x54, 0xCF, 0x42, 0xBA, 0x31, 0xC2, 0x02, 0x31, 0x2E, 0x61, 0xB9, 0xA1, 0xCE,
-    0xB9, 0xC3, 0x01, 0xE1, 0x62, 0x67, 0x6C, 0xB2, 0xC7, 0xBA, 0x30, 0xBB, 0x12, 0xC1, 0x01, 0x41,
-    0x61, 0xB2, 0xCD, 0xC2, 0x01, 0x91, 0x64, 0x65, 0xBB, 0x7D, 0xBA, 0x1E, 0x44, 0x61, 0x65, 0x69,
-    0x6F, 0xBD, 0x82, 0xBA, 0x9D, 0xFF, 0xF7, 0xBA, 0x9D, 0x42, 0x63, 0x74, 0xB9, 0xB2, 0xB9, 0xB2,
-    0x43, 0x6E, 0x72, 0x74, 0xFF, 0xF9, 0xB9, 0xD8, 0xB9, 0x74, 0x42, 0x61, 0x69, 0xB5, 0x5F, 0xBB,
-    0x56, 0x41, 0x69, 0xC5, 0xC8, 0x44, 0x61, 0x69, 0x6F, 0x70, 0xFB, 0x0A, 0xB2, 0x9B, 0xBA, 0x8F,
-    0xB2, 0xC0, 0xC1, 0x02, 0x11, 0x2E, 0xBB, 0x3E, 0x44, 0x61, 0x64, 0x65, 0x67, 0xFF, 0xFA, 0xB2,
-    0x70, 0xB2, 0x70, 0xB2, 0x70, 0xC1, 0x02, 0xE1, 0x65, 0xB2, 0x84, 0xC1, 0x02, 0x81, 0x69, 0xE4,
-    0xF8, 0x22, 0x68, 0x6C, 0xF4, 0xFA, 0xC4, 0x02, 0x11, 0x2E, 0x63, 0x68, 0x70, 0xBA, 0x43, 0xB2,
-    0x52, 0xB9, 0xA1, 0xB2, 0x52, 0x41, 0x62, 0xE0, 0x56, 0x42, 0x2E, 0x73, 0xB2, 0x57, 0xB2, 0x57,
-    0x42, 0x64, 0x72, 0xBA, 0xF1, 0xFF, 0xF9, 0xC1, 0x02, 0x81, 0x72, 0xB2, 0x49, 0x44, 0x61, 0x65,
-    0x69, 0x75, 0xFF, 0xE8, 0xFF, 0xF3, 0xC2, 0x30, 0xFF, 0xFA, 0x42, 0x6C, 0x74, 0xB2, 0x36, 0xB2,
-    0x30, 0xA0, 0x16, 0x42, 0x21, 0x6C, 0xFD, 0x43, 0x65, 0x69, 0x6F, 0xFF, 0xF3, 0xB2, 0x23, 0xFF,
-    0xFD, 0x4F, 0x61, 0x62, 0x63, 0x64, 0x65, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x73, 0x74,
-    0x76, 0xFF, 0x40, 0xFF, 0x4C, 0xFF, 0x5B, 0xC0, 0x3A, 0xFF, 0x6F, 0xFF, 0x79, 0xFF, 0x80, 0xFF,
-    0x84, 0xFF, 0x97, 0xB9, 0x47, 0xFF, 0xB0, 0xB9, 0xF8, 0xFF, 0xB5, 0xFF, 0xDC, 0xFF, 0xF6, 0x42,
-    0x65, 0x69, 0xB9, 0x42, 0xB9, 0x5B, 0xA0, 0x22, 0x01, 0x41, 0x6F, 0xB9, 0x0F, 0x41, 0x75, 0xBA,
-    0x3D, 0x21, 0x61, 0xFC, 0x21, 0x2E, 0xF2, 0x46, 0x65, 0x6C, 0x2E, 0x68, 0x72, 0x73, 0xBD, 0x44,
-    0xFF, 0xE8, 0xFF, 0xEF, 0xFF, 0xF2, 0xFF, 0xFA, 0xFF, 0xFD, 0x41, 0x75, 0xBA, 0x43, 0xC2, 0x00,
-    0x51, 0x64, 0x71, 0xB8, 0xDB, 0xFF, 0xFC, 0xC1, 0x01, 0x41, 0x68, 0xB8, 0x7D, 0x42, 0x67, 0x73,
-    0xB9, 0x8C, 0xFF, 0xFA, 0xC3, 0x02, 0xB1, 0x65, 0x69, 0x6F, 0xFF, 0xEA, 0xFF, 0xF9, 0xC8, 0xCA,
-    0xC2, 0x02, 0x11, 0x6E, 0x72, 0xB8, 0xD7, 0xBC, 0x86, 0xC1, 0x01, 0xE1, 0x2E, 0xB9, 0x70, 0x21,
-    0x67, 0xFA, 0x43, 0x6E, 0x6F, 0x74, 0xFF, 0xFD, 0xB9, 0x67, 0xB8, 0xC5, 0xC4, 0x02, 0xB1, 0x61,
-    0x65, 0x69, 0x79, 0xE4, 0x07, 0xFF, 0xE4, 0xFF, 0xF6, 0xB9, 0x5D, 0x44, 0x6C, 0x72, 0x74, 0x79,
-    0xB8, 0xAC, 0xB9, 0x4E, 0xB8, 0x31, 0xB8, 0xAC, 0xA0, 0x09, 0x82, 0x44, 0x63, 0x73, 0x74, 0x76,
-    0xB8, 0x21, 0xFF, 0xFD, 0xB8, 0x9C, 0xB8, 0x9C, 0xC1, 0x00, 0x51, 0x75, 0xB9, 0x31, 0x45, 0x61,
-    0x65, 0x69, 0x6F, 0x75, 0xDA, 0xBD, 0xFF, 0xDD, 0xFF, 0xED, 0xFF, 0xFA, 0xB8, 0x89, 0xA0, 0x1B,
-    0x52, 0x21, 0x74, 0xFD, 0x42, 0x6C, 0x6F, 0xB1, 0x36, 0xFF, 0xFD, 0xC1, 0x02, 0x11, 0x72, 0xB8,
-    0x30, 0xA0, 0x22, 0x12, 0x21, 0x65, 0xFD, 0x21, 0x64, 0xFD, 0x21, 0x69, 0xFD, 0xC2, 0x02, 0x31,
-    0x6C, 0x70, 0xEA, 0xAF, 0xFF, 0xFD, 0x42, 0x65, 0x69, 0xB8, 0x42, 0xB8, 0xFD, 0xC1, 0x00, 0xD1,
-    0x65, 0xBF, 0xDD, 0x41, 0x65, 0xC3, 0xF3, 0x42, 0x74, 0x73, 0xB5, 0x0E, 0xBA, 0xB4, 0x43, 0x65,
-    0x69, 0x70, 0xFF, 0xF9, 0xB0, 0xEA, 0xB0, 0xEA, 0x41, 0x73, 0xEE, 0xA3, 0x44, 0x61, 0x65, 0x69,
-    0x74, 0xB5, 0x11, 0xB0, 0xDC, 0xFF, 0xFC, 0xB1, 0xD5, 0x42, 0x6D, 0x74, 0xC6, 0x38, 0xB9, 0x97,
-    0x42, 0x65, 0x69, 0xB7, 0xDE, 0xC0, 0xCD, 0x42, 0x69, 0x6F, 0xB0, 0xD3, 0xB7, 0x9D, 0x42, 0x70,
-    0x73, 0xBE, 0xED, 0xB0, 0xBA, 0x41, 0x6F, 0xB9, 0x28, 0x43, 0x68, 0x79, 0x72, 0xB8, 0x57, 0xB8,
-    0x18, 0xFF, 0xFC, 0x42, 0x61, 0x65, 0xB8, 0x0E, 0xC2, 0x66, 0x4F, 0x62, 0x63, 0x65, 0x66, 0x6B,
-    0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x76, 0x78, 0xFF, 0x7A, 0xFF, 0x81, 0xFF, 0x93,
-    0xFF, 0x9C, 0xFF, 0xA3, 0xFF, 0xA9, 0xFF, 0xB4, 0xFF, 0xC2, 0xFF, 0xCF, 0xFF, 0xD6, 0xFF, 0xDD,
-    0xFF, 0xE4, 0xFF, 0xEF, 0xFF, 0xF9, 0xB0, 0xB6, 0x44, 0x61, 0x6E, 0x72, 0x74, 0xB8, 0x61, 0xB7,
-    0xB8, 0xB7, 0xF8, 0xB7, 0xBF, 0xA0, 0x22, 0x32, 0x21, 0x69, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x75,
-    0xFD, 0xC5, 0x02, 0xB1, 0x65, 0x68, 0x69, 0x6F, 0x61, 0xFF, 0xE7, 0xD0, 0x8A, 0xE4, 0xBD, 0xB7,
-    0xA6, 0xFF, 0xFD, 0x44, 0x63, 0x66, 0x6F, 0x73, 0xB0, 0x45, 0xB0, 0x45, 0xB8, 0x36, 0xB1, 0xAE,
-    0x42, 0x6F, 0x76, 0xB0, 0x38, 0xB0, 0x38, 0x42, 0x6E, 0x73, 0xB0, 0x2B, 0xB0, 0x2B, 0xC4, 0x07,
-    0x42, 0x65, 0x69, 0x6F, 0x79, 0xFF, 0xE5, 0xFF, 0xF2, 0xFF, 0xF9, 0xB9, 0xA3, 0xC1, 0x02, 0xB1,
-    0x74, 0xBD, 0xF7, 0xC1, 0x02, 0x21, 0x72, 0xB0, 0x15, 0x41, 0x69, 0xE7, 0x13, 0x21, 0x64, 0xFC,
-    0x42, 0x2E, 0x61, 0xB6, 0xE4, 0xFF, 0xFD, 0xC4, 0x02, 0x11, 0x63, 0x72, 0x73, 0x76, 0xFF, 0xEC,
-    0xFF, 0xF9, 0xB7, 0x14, 0xB2, 0xE4, 0xC1, 0x02, 0xB1, 0x61, 0xB6, 0xC6, 0xC1, 0x02, 0xB1, 0x62,
-    0xCE, 0x29, 0xC8, 0x04, 0x22, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6F, 0x70, 0x77, 0xFF, 0xCB, 0xB7,
-    0x4F, 0xFF, 0xE5, 0xFF, 0xF4, 0xFF, 0xFA, 0xC3, 0xDE, 0xB8, 0x58, 0xB6, 0xBA, 0x41, 0x68, 0xB5,
-    0x14, 0x42, 0x63, 0x67, 0xFF, 0xFC, 0xB7, 0xB8, 0x43, 0x62, 0x6E, 0x6F, 0xB7, 0x0F, 0xCC, 0x2B,
-    0xAF, 0xD8, 0x43, 0x69, 0x6C, 0x79, 0xB1, 0x45, 0xAF, 0xB0, 0xB7, 0xA7, 0xC7, 0x02, 0xB1, 0x62,
-    0x64, 0x65, 0x67, 0x6C, 0x73, 0x76, 0xB6, 0x88, 0xAF, 0xAC, 0xD9, 0x2F, 0xB6, 0xFB, 0xFF, 0xF6,
-    0xCA, 0x1A, 0xB7, 0x9D, 0x41, 0x68, 0xB4, 0xB2, 0x21, 0x70, 0xFC, 0x43, 0x69, 0x6F, 0x65, 0xB6,
-    0xDC, 0xFF, 0xFD, 0xFD, 0xC2, 0x41, 0x6F, 0xFD, 0xB8, 0x46, 0x61, 0x65, 0x69, 0x72, 0x73, 0x68,
-    0xFF, 0xB8, 0xFF, 0xBF, 0xFF, 0xD3, 0xFF, 0xF2, 0xBB, 0x8E, 0xFF, 0xFC, 0x42, 0x6C, 0x6E, 0xCE,
-    0xEC, 0xB6, 0x7F, 0x41, 0x70, 0xC6, 0x49, 0xC2, 0x02, 0x81, 0x6B, 0x74, 0xAF, 0x82, 0xB2, 0x74,
-    0x48, 0x61, 0x65, 0x67, 0x69, 0x6D, 0x6E, 0x73, 0x74, 0xB6, 0x6B, 0xFF, 0xEC, 0xC5, 0x77, 0xBB,
-    0x6B, 0xFF, 0xF3, 0xFF, 0xF7, 0xD1, 0x16, 0xD2, 0x91, 0x41, 0x6C, 0xB7, 0xB1, 0xC6, 0x02, 0x31,
-    0x6C, 0x6E, 0x72, 0x73, 0x79, 0x69, 0xAF, 0xFC, 0xB6, 0x8A, 0xB6, 0xC3, 0xB6, 0x83, 0xB6, 0x8A,
-    0xFF, 0xFC, 0x42, 0x63, 0x76, 0xB6, 0x75, 0xAF, 0x26, 0x43, 0x65, 0x69, 0x6F, 0xFF, 0xE4, 0xFF,
-    0xF9, 0xB6, 0x6E, 0x41, 0x67, 0xE2, 0x9D, 0x43, 0x63, 0x6E, 0x74, 0xB6, 0x7A, 0xFF, 0xFC, 0xB6,
-    0x24, 0x41, 0x63, 0xB6, 0x47, 0x21, 0x73, 0xFC, 0x58, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
-    0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79,
-    0x7A, 0xFA, 0x32, 0xFA, 0x86, 0xFA, 0xAA, 0xFA, 0xCB, 0xFB, 0xC4, 0xFB, 0xFB, 0xFC, 0x1E, 0xFC,
-    0x30, 0xFC, 0xF9, 0xB6, 0x4F, 0xFD, 0x3F, 0xFD, 0x6C, 0xFD, 0x94, 0xFD, 0xC6, 0xFE, 0x62, 0xFE,
-    0xA9, 0xFE, 0xD6, 0xFF, 0x1A, 0xFF, 0x81, 0xFF, 0xA8, 0xFF, 0xE1, 0xB7, 0x72, 0xFF, 0xEF, 0xFF,
-    0xFD, 0x43, 0x6B, 0x72, 0x74, 0xB7, 0x7F, 0xB1, 0x96, 0xB6, 0x06, 0x42, 0x63, 0x77, 0xB0, 0x59,
-    0xAE, 0xD4, 0x21, 0x73, 0xF9, 0x45, 0x61, 0x6D, 0x6F, 0x74, 0x65, 0xD7, 0x15, 0xAE, 0xA3, 0xB5,
-    0x7F, 0xAE, 0xA3, 0xFF, 0xFD, 0x42, 0x63, 0x64, 0xB6, 0x9F, 0xAE, 0xD0, 0xA0, 0x22, 0x53, 0x21,
-    0x6C, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x72, 0xFD, 0xA1, 0x02, 0xB1, 0x61, 0xFD, 0x41, 0x6F, 0xC5,
-    0xDE, 0x43, 0x61, 0x69, 0x75, 0xB5, 0x53, 0xFF, 0xFC, 0xAE, 0x89, 0x41, 0x6F, 0xBD, 0x4F, 0xCA,
-    0x02, 0x81, 0x62, 0x63, 0x69, 0x6C, 0x6E, 0x70, 0x74, 0x75, 0x76, 0x77, 0xC4, 0xAB, 0xFF, 0xB2,
-    0xB7, 0x31, 0xFF, 0xC6, 0xFF, 0xD6, 0xFF, 0xE9, 0xFF, 0xF2, 0xAE, 0x69, 0xFF, 0xFC, 0xB7, 0x31,
-    0xA0, 0x0F, 0xE2, 0x21, 0x74, 0xFD, 0x41, 0x72, 0xF3, 0xCB, 0xA1, 0x00, 0x51, 0x65, 0xFC, 0x41,
-    0x6F, 0xB4, 0x9C, 0x44, 0x6E, 0x70, 0x76, 0x74, 0xFF, 0xF0, 0xFF, 0xF7, 0xAE, 0x56, 0xFF, 0xFC,
-    0x43, 0x64, 0x69, 0x73, 0xB6, 0x19, 0xB4, 0xF9, 0xB6, 0x19, 0x41, 0x7A, 0xB6, 0x0F, 0x21, 0x74,
-    0xFC, 0xA0, 0x22, 0x82, 0x21, 0x67, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x64, 0xFD,
-    0x21, 0x6F, 0xFD, 0xC3, 0x00, 0xD1, 0x6F, 0x69, 0x72, 0xB5, 0xF6, 0xFF, 0xEB, 0xFF, 0xFD, 0xA0,
-    0x10, 0x02, 0x21, 0x64, 0xFD, 0xA0, 0x22, 0xA2, 0x21, 0x74, 0xFD, 0x21, 0x74, 0xFD, 0x43, 0x65,
-    0x6E, 0x75, 0xD3, 0x4B, 0xFF, 0xF4, 0xFF, 0xFD, 0x42, 0x65, 0x69, 0xAE, 0x01, 0xB5, 0xD1, 0x43,
-    0x66, 0x70, 0x75, 0xAD, 0xD3, 0xDF, 0x1A, 0xDB, 0x2D, 0x41, 0x2E, 0xB3, 0x18, 0x21, 0x72, 0xFC,
-    0x21, 0x65, 0xFD, 0x21, 0x70, 0xFD, 0x21, 0x61, 0xFD, 0x41, 0x68, 0xB1, 0x52, 0x21, 0x74, 0xFC,
-    0x49, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x75, 0x72, 0x79, 0xFF, 0x83, 0xFF, 0x90, 0xFF, 0xB3,
-    0xFF, 0xCE, 0xFF, 0xD8, 0xFF, 0xDF, 0xB6, 0x2A, 0xFF, 0xF6, 0xFF, 0xFD, 0xC2, 0x02, 0x31, 0x73,
-    0x77, 0xAD, 0x96, 0xAD, 0xB4, 0xA0, 0x10, 0x22, 0x42, 0x6F, 0x74, 0xFF, 0xFD, 0xB5, 0x9C, 0xC2,
-    0x0D, 0x42, 0x65, 0x6C, 0xCD, 0xBC, 0xB4, 0x5D, 0xC1, 0x02, 0x81, 0x72, 0xAD, 0x92, 0x43, 0x65,
-    0x66, 0x76, 0xB4, 0xBA, 0xB6, 0x42, 0xB6, 0x42, 0xA0, 0x22, 0xC2, 0x21, 0x74, 0xFD, 0xA1, 0x01,
-    0x91, 0x73, 0xFD, 0x41, 0x68, 0xFB, 0x4E, 0x21, 0x70, 0xFC, 0xA0, 0x22, 0xE3, 0x21, 0x63, 0xFD,
-    0x21, 0x69, 0xFD, 0x21, 0x74, 0xFD, 0x44, 0x65, 0x6F, 0x61, 0x69, 0xFF, 0xE8, 0xC3, 0x71, 0xFF,
-    0xF1, 0xFF, 0xFD, 0x41, 0x64, 0xB4, 0x19, 0x42, 0x64, 0x6C, 0xB4, 0x12, 0xB4, 0x12, 0x47, 0x61,
-    0x63, 0x64, 0x65, 0x67, 0x69, 0x74, 0xAD, 0x55, 0xB4, 0x0B, 0xAD, 0x3A, 0xFF, 0xF5, 0xAD, 0x52,
-    0xCD, 0x8C, 0xFF, 0xF9, 0x41, 0x62, 0xAD, 0x36, 0x21, 0x6D, 0xFC, 0x21, 0x65, 0xFD, 0x42, 0x61,
-    0x74, 0xC0, 0x64, 0xFF, 0xFD, 0x44, 0x2E, 0x6C, 0x6F, 0x76, 0xBB, 0xC5, 0xB5, 0x04, 0xAD, 0x13,
-    0xD7, 0xBF, 0xC2, 0x07, 0x42, 0x68, 0x74, 0xB3, 0xE2, 0xAD, 0x1E, 0x41, 0x6D, 0xD8, 0x5D, 0xC1,
-    0x02, 0xE1, 0x65, 0xBE, 0x44, 0x50, 0x2E, 0x61, 0x63, 0x64, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x70,
-    0x72, 0x73, 0x75, 0x76, 0x77, 0x78, 0xB3, 0xC4, 0xFF, 0x57, 0xFF, 0x63, 0xFF, 0x6A, 0xFF, 0x73,
-    0xB5, 0xBB, 0xFF, 0x79, 0xFF, 0xA1, 0xFF, 0xB9, 0xFF, 0xD9, 0xFF, 0xE0, 0xFF, 0xED, 0xFF, 0xF6,
-    0xFF, 0xFA, 0xAD, 0x59, 0xB5, 0xBB, 0x42, 0x72, 0x76, 0xB4, 0x02, 0xB5, 0x8A, 0x44, 0x6E, 0x6F,
-    0x70, 0x76, 0xB3, 0xFB, 0xB3, 0xCE, 0xB4, 0xC7, 0xAC, 0xDC, 0xC1, 0x00, 0x41, 0x74, 0xAC, 0xD5,
-    0x41, 0x73, 0xD8, 0x50, 0xC4, 0x00, 0x51, 0x6C, 0x6E, 0x72, 0x65, 0xB3, 0x83, 0xAE, 0x33, 0xFF,
-    0xF6, 0xFF, 0xFC, 0xC5, 0x02, 0x11, 0x2E, 0x65, 0x69, 0x6F, 0x77, 0xBB, 0xBD, 0xFF, 0xD3, 0xFF,
-    0xDA, 0xFF, 0xF1, 0xB3, 0x66, 0xC2, 0x02, 0xE1, 0x74, 0x77, 0xAC, 0xA4, 0xAC, 0xA4, 0x43, 0x2E,
-    0x73, 0x64, 0xB4, 0x86, 0xFF, 0xF7, 0xBD, 0x47, 0x42, 0x65, 0x69, 0xFF, 0xF6, 0xC3, 0xED, 0x41,
-    0x6E, 0xD0, 0x7C, 0x42, 0x65, 0x79, 0xAC, 0x65, 0xB3, 0x36, 0xC3, 0x03, 0xE2, 0x61, 0x65, 0x67,
-    0xB3, 0x8F, 0xBF, 0x5C, 0xB3, 0xAD, 0xC1, 0x02, 0xE1, 0x61, 0xAC, 0x73, 0xA1, 0x03, 0xD1, 0x6E,
-    0xFA, 0x41, 0x69, 0xB3, 0x26, 0x21, 0x73, 0xFC, 0xC2, 0x02, 0x81, 0x61, 0x65, 0xAC, 0x58, 0xFF,
-    0xFD, 0x41, 0x69, 0xBD, 0x00, 0x4D, 0x62, 0x63, 0x64, 0x67, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x74,
-    0x75, 0x76, 0x7A, 0xB3, 0x73, 0xCD, 0xF1, 0xFF, 0xC3, 0xFF, 0xCA, 0xFF, 0xCE, 0xFF, 0xD5, 0xFF,
-    0xE7, 0xFF, 0xF3, 0xC1, 0x9C, 0xFF, 0xFC, 0xB4, 0xFB, 0xC1, 0x9C, 0xB4, 0xFB, 0xC1, 0x01, 0x91,
-    0x74, 0xB3, 0x5A, 0x42, 0x65, 0x67, 0xB2, 0xE1, 0xB2, 0xE1, 0x21, 0x6E, 0xF9, 0x41, 0x63, 0xAC,
-    0x07, 0x21, 0x73, 0xFC, 0xA3, 0x02, 0x81, 0x65, 0x69, 0x79, 0xE9, 0xF6, 0xFD, 0x41, 0x74, 0xBB,
-    0xA4, 0xA0, 0x23, 0x12, 0x21, 0x61, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x6B, 0xFD, 0x21, 0x61, 0xFD,
-    0x21, 0x76, 0xFD, 0xC4, 0x07, 0x82, 0x61, 0x65, 0x69, 0x6F, 0xB7, 0x58, 0xB3, 0x06, 0xFF, 0xEA,
-    0xFF, 0xFD, 0xC2, 0x02, 0x21, 0x6C, 0x6E, 0xAE, 0x8C, 0xAD, 0x55, 0x42, 0x6C, 0x6E, 0xAB, 0xB7,
-    0xB2, 0x91, 0x41, 0x68, 0xB4, 0x7E, 0x21, 0x74, 0xFC, 0x41, 0x64, 0xAD, 0x23, 0x21, 0x6C, 0xFC,
-    0xA4, 0x03, 0xE2, 0x61, 0x65, 0x69, 0x6F, 0xE2, 0xEB, 0xF6, 0xFD, 0x41, 0x62, 0xB3, 0x06, 0xA0,
-    0x10, 0x62, 0x41, 0x74, 0xB7, 0x44, 0x45, 0x61, 0x64, 0x69, 0x76, 0x75, 0xFF, 0xF5, 0xFF, 0xF9,
-    0xBF, 0x51, 0xB4, 0x5A, 0xFF, 0xFC, 0x43, 0x2E, 0x61, 0x67, 0xD0, 0xE3, 0xAB, 0x7C, 0xAB, 0x82,
-    0x42, 0x63, 0x7A, 0xB4, 0x40, 0xB2, 0x4C, 0x42, 0x69, 0x79, 0xFF, 0xF9, 0xB2, 0x45, 0xA1, 0x01,
-    0x41, 0x68, 0xF9, 0x42, 0x63, 0x64, 0xAB, 0x7D, 0xAB, 0x7D, 0xC1, 0x01, 0x91, 0x69, 0xB2, 0x3A,
-    0xA0, 0x23, 0x34, 0x21, 0x79, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0x61, 0xFD, 0xC9, 0x03, 0xD1, 0x63,
-    0x66, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x76, 0x67, 0xB2, 0xF4, 0xAF, 0x8E, 0xFF, 0xBA, 0xB3, 0x58,
-    0xFF, 0xCA, 0xFF, 0xE2, 0xFF, 0xE7, 0xFF, 0xEE, 0xFF, 0xFD, 0xA0, 0x23, 0x32, 0x41, 0x6E, 0xD1,
-    0x0D, 0x22, 0x65, 0x69, 0xF9, 0xFC, 0xC3, 0x02, 0x41, 0x69, 0x6E, 0x63, 0xB3, 0xEA, 0xAB, 0x22,
-    0xFF, 0xFB, 0x41, 0x69, 0xAE, 0xDF, 0x44, 0x6E, 0x6F, 0x72, 0x63, 0xC7, 0x7D, 0xBC, 0x78, 0xBA,
-    0x3A, 0xFF, 0xFC, 0xC1, 0x02, 0x71, 0x6F, 0xAF, 0x84, 0xA1, 0x02, 0x11, 0x72, 0xFA, 0x42, 0x65,
-    0x6F, 0xFF, 0xFB, 0xAB, 0x1B, 0x41, 0x69, 0xB1, 0x56, 0x44, 0x6C, 0x6E, 0x6F, 0x63, 0xAA, 0xE9,
-    0xB1, 0xFA, 0xB1, 0xC0, 0xFF, 0xFC, 0xA0, 0x23, 0x71, 0x22, 0x63, 0x77, 0xFD, 0xFD, 0x21, 0x73,
-    0xFB, 0xA1, 0x00, 0x41, 0x74, 0xFD, 0x41, 0x77, 0xAB, 0x1C, 0x21, 0x73, 0xFC, 0x21, 0x65, 0xFD,
-    0x44, 0x6E, 0x72, 0x74, 0x6B, 0xB2, 0xB9, 0xFF, 0xF1, 0xB1, 0x99, 0xFF, 0xFD, 0x46, 0x61, 0x65,
-    0x68, 0x69, 0x6C, 0x6F, 0xFF, 0x99, 0xFF, 0xA9, 0xFF, 0xC1, 0xFF, 0xCC, 0xCD, 0xA5, 0xFF, 0xF3,
-    0x41, 0x6C, 0xB4, 0xD7, 0x41, 0x6F, 0xC7, 0x5E, 0x21, 0x74, 0xFC, 0x22, 0x61, 0x69, 0xF5, 0xFD,
-    0x21, 0x75, 0xFB, 0xA0, 0x23, 0x84, 0x21, 0x75, 0xFD, 0x21, 0x68, 0xFD, 0xC2, 0x02, 0xB1, 0x73,
-    0x63, 0xAC, 0x1B, 0xFF, 0xFD, 0x44, 0x6C, 0x6E, 0x73, 0x74, 0xB1, 0xD2, 0xEB, 0x0F, 0xC6, 0x50,
-    0xB1, 0x57, 0xC1, 0x01, 0x41, 0x72, 0xAA, 0x76, 0x41, 0x6E, 0xC9, 0xBC, 0xA0, 0x23, 0xC3, 0x21,
-    0x62, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x6E, 0xFD, 0xC4, 0x02, 0xB1, 0x65, 0x6C, 0x61, 0x67, 0xFF,
-    0xEA, 0xB2, 0xAF, 0xFF, 0xF0, 0xFF, 0xFD, 0xC1, 0x01, 0x41, 0x69, 0xB1, 0xBA, 0x41, 0x64, 0xAF,
-    0x69, 0x21, 0x6E, 0xFC, 0x21, 0x65, 0xFD, 0x41, 0x61, 0xB5, 0x3B, 0xCB, 0x02, 0x41, 0x61, 0x63,
-    0x65, 0x69, 0x6C, 0x6E, 0x70, 0x74, 0x75, 0x77, 0x68, 0xFF, 0xB1, 0xC0, 0x39, 0xFF, 0xBA, 0xFF,
-    0xDD, 0xFF, 0xEC, 0xB2, 0x2E, 0xFF, 0xF9, 0xB4, 0x42, 0xB6, 0x5B, 0xB1, 0x19, 0xFF, 0xFC, 0x42,
-    0x69, 0x70, 0xAA, 0x13, 0xCF, 0xFB, 0xA0, 0x23, 0xF3, 0x21, 0x69, 0xFD, 0x21, 0x68, 0xFD, 0x21,
-    0x73, 0xFD, 0x42, 0x64, 0x74, 0xB2, 0xCE, 0xFF, 0xFD, 0x42, 0x2E, 0x69, 0xB2, 0xC7, 0xAA, 0x0B,
-    0x41, 0x74, 0xEA, 0x72, 0x47, 0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x74, 0x72, 0xB1, 0x25, 0xB1, 0x25,
-    0xFF, 0xDB, 0xFF, 0xEE, 0xC8, 0x31, 0xFF, 0xF5, 0xFF, 0xFC, 0x42, 0x6E, 0x6F, 0xAC, 0x48, 0xB0,
-    0xB2, 0xC1, 0x00, 0xD1, 0x61, 0xA9, 0xF8, 0x43, 0x64, 0x72, 0x77, 0xB1, 0xC2, 0xFF, 0xF3, 0xFF,
-    0xFA, 0xC1, 0x02, 0xB1, 0x6B, 0xB2, 0x8F, 0xC7, 0x02, 0x81, 0x2E, 0x61, 0x63, 0x65, 0x66, 0x6E,
-    0x72, 0xB1, 0xB2, 0xB0, 0x95, 0xFF, 0xFA, 0xB1, 0xB2, 0xB1, 0x10, 0xCB, 0x99, 0xB2, 0x89, 0x41,
-    0x65, 0xB2, 0x1B, 0xA0, 0x24, 0x22, 0x21, 0x62, 0xFD, 0x42, 0x65, 0x61, 0xB1, 0xAB, 0xFF, 0xFD,
-    0x45, 0x63, 0x6D, 0x6E, 0x70, 0x72, 0xC8, 0xEC, 0xDA, 0x0C, 0xDD, 0x20, 0xB1, 0x89, 0xFF, 0xF9,
-    0xA0, 0x24, 0x42, 0x21, 0x67, 0xFD, 0x42, 0x75, 0x61, 0xB2, 0x4A, 0xFF, 0xFD, 0x43, 0x64, 0x74,
-    0x79, 0xB1, 0x6C, 0xFF, 0xF9, 0xB1, 0x6C, 0x42, 0x64, 0x62, 0xB1, 0x62, 0xAF, 0x58, 0xC3, 0x02,
-    0x31, 0x61, 0x69, 0x79, 0xFF, 0xEF, 0xFF, 0xF9, 0xB0, 0x3B, 0x41, 0x69, 0xD1, 0x0C, 0xA1, 0x02,
-    0x11, 0x6C, 0xFC, 0x41, 0x63, 0xB8, 0x37, 0xA0, 0x24, 0x63, 0x21, 0x64, 0xFD, 0x21, 0x69, 0xFD,
-    0x21, 0x70, 0xFD, 0x4D, 0x2E, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x77, 0x79, 0x62, 0x73,
-    0x75, 0xB8, 0x6D, 0xFF, 0x51, 0xFF, 0x74, 0xC2, 0x7A, 0xFF, 0x84, 0xFF, 0x9C, 0xFF, 0xAD, 0xFF,
-    0xDB, 0xBB, 0xB3, 0xFF, 0xEB, 0xB0, 0x21, 0xFF, 0xF0, 0xFF, 0xFD, 0x42, 0x73, 0x74, 0xAF, 0xF9,
-    0xAA, 0xAC, 0xC1, 0x02, 0x81, 0x69, 0xA9, 0x28, 0xA0, 0x24, 0x93, 0x21, 0x65, 0xFD, 0x21, 0x72,
-    0xFD, 0x21, 0x65, 0xFD, 0xC9, 0x03, 0xD1, 0x61, 0x62, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x72, 0x70,
-    0xDD, 0x59, 0xC2, 0xE6, 0xFB, 0x71, 0xFF, 0xE7, 0xB0, 0xF5, 0xFF, 0xEE, 0xB3, 0x09, 0xB3, 0x09,
-    0xFF, 0xFD, 0xA0, 0x1C, 0x31, 0x21, 0x6D, 0xFD, 0x21, 0x6D, 0xFD, 0xC2, 0x02, 0x81, 0x6F, 0x69,
-    0xAF, 0xAE, 0xFF, 0xFD, 0x42, 0x6F, 0x63, 0xA8, 0xEC, 0xBE, 0x3D, 0x41, 0x69, 0xB0, 0x7C, 0xA0,
-    0x24, 0xC3, 0x21, 0x69, 0xFD, 0x21, 0x68, 0xFD, 0xC5, 0x01, 0x41, 0x63, 0x6C, 0x6E, 0x72, 0x74,
-    0xAF, 0x91, 0xB0, 0xCC, 0xFF, 0xEC, 0xFF, 0xF3, 0xFF, 0xFD, 0x57, 0x61, 0x62, 0x63, 0x64, 0x65,
-    0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
-    0x77, 0x79, 0xFA, 0x45, 0xB9, 0xAF, 0xFA, 0xF6, 0xB9, 0xAF, 0xFB, 0xBB, 0xB7, 0xD9, 0xB7, 0xF0,
-    0xFC, 0x19, 0xFC, 0x7B, 0xFC, 0xBA, 0xFC, 0xD9, 0xFD, 0x06, 0xC2, 0x71, 0xFD, 0x62, 0xFD, 0xF3,
-    0xFE, 0x16, 0xB1, 0x20, 0xFE, 0x71, 0xFF, 0x69, 0xFF, 0xAA, 0xAF, 0x7F, 0xFF, 0xD1, 0xFF, 0xEE,
-    0x41, 0x65, 0xB3, 0x66, 0xA0, 0x24, 0xF3, 0x21, 0x6D, 0xFD, 0x42, 0x7A, 0x73, 0xB1, 0x26, 0xFF,
-    0xFD, 0x21, 0x69, 0xF9, 0x21, 0x6C, 0xFD, 0xA2, 0x02, 0x41, 0x6C, 0x6F, 0xE9, 0xFD, 0x41, 0x6C,
-    0xA8, 0xF5, 0xC1, 0x01, 0x91, 0x61, 0xC0, 0xE2, 0x41, 0x69, 0xBD, 0x39, 0xC6, 0x02, 0x81, 0x61,
-    0x65, 0x69, 0x6B, 0x6C, 0x6F, 0xAF, 0x18, 0xAB, 0x0D, 0xA8, 0x4E, 0xFF, 0xF6, 0xFF, 0xFC, 0xAF,
-    0x47, 0x41, 0x6E, 0xE5, 0xFC, 0x42, 0x6F, 0x69, 0xAE, 0xFF, 0xFF, 0xFC, 0x41, 0x61, 0xA9, 0xC8,
-    0x42, 0x64, 0x74, 0xA8, 0x55, 0xFF, 0xFC, 0xA0, 0x25, 0x22, 0x21, 0x68, 0xFD, 0x21, 0x74, 0xFD,
-    0x43, 0x65, 0x6C, 0x61, 0xB6, 0xEA, 0xAE, 0xE4, 0xFF, 0xFD, 0xA0, 0x25, 0x42, 0x21, 0x68, 0xFD,
-    0x45, 0x61, 0x63, 0x65, 0x69, 0x72, 0xA7, 0xF8, 0xAE, 0xC9, 0xAE, 0xC9, 0xB7, 0x3D, 0xFF, 0xFD,
-    0x42, 0x65, 0x79, 0xA7, 0xE8, 0xAE, 0xC4, 0x42, 0x69, 0x75, 0xB0, 0x91, 0xB1, 0xF3, 0x41, 0x6E,
-    0xB4, 0x47, 0x21, 0x6F, 0xFC, 0xD2, 0x03, 0xD1, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x69, 0x6C, 0x6D,
-    0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x67, 0xAF, 0xDF, 0xFF, 0x82, 0xB0, 0x59,
-    0xB2, 0x5F, 0xB9, 0x36, 0xFF, 0x89, 0xFF, 0x97, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xCB, 0xFF, 0xDB,
-    0xFF, 0xEB, 0xFF, 0xF2, 0xA8, 0x3D, 0xA7, 0xD3, 0xB6, 0xFB, 0xFF, 0x93, 0xFF, 0xFD, 0x41, 0x72,
-    0xDE, 0x72, 0x21, 0x65, 0xFC, 0xC3, 0x01, 0x41, 0x65, 0x63, 0x69, 0xA7, 0xAE, 0xA7, 0x9F, 0xFF,
-    0xFD, 0xC2, 0x01, 0x91, 0x68, 0x72, 0xFF, 0xF4, 0xAF, 0xF9, 0x41, 0x68, 0xF9, 0xB6, 0x43, 0x64,
-    0x74, 0x63, 0xA8, 0x3B, 0xAE, 0x4B, 0xFF, 0xFC, 0x42, 0x65, 0x74, 0xA7, 0x6A, 0xB0, 0x38, 0xC1,
-    0x03, 0xE2, 0x69, 0xAE, 0x45, 0xC2, 0x00, 0x51, 0x65, 0x69, 0xB6, 0x45, 0xAE, 0x3F, 0x41, 0x6F,
-    0xE0, 0x9E, 0x42, 0x67, 0x72, 0xA8, 0x11, 0xFF, 0xFC, 0x44, 0x2E, 0x69, 0x73, 0x65, 0xAF, 0x5B,
-    0xA7, 0x49, 0xB0, 0x17, 0xFF, 0xF9, 0xC1, 0x10, 0x82, 0x74, 0xA7, 0x54, 0x21, 0x61, 0xFA, 0x41,
-    0x6E, 0xAF, 0x45, 0xC1, 0x03, 0xD1, 0x61, 0xE5, 0x31, 0x45, 0x61, 0x63, 0x64, 0x65, 0x74, 0xFF,
-    0xF6, 0xAF, 0x3B, 0xAF, 0x3B, 0xC5, 0x28, 0xFF, 0xFA, 0xC1, 0x02, 0x31, 0x65, 0xAD, 0xFB, 0xA0,
-    0x10, 0xA2, 0xC4, 0x03, 0xD1, 0x65, 0x73, 0x7A, 0x63, 0xB1, 0xEC, 0xA7, 0x28, 0xAA, 0x83, 0xB7,
-    0xE3, 0x41, 0x69, 0xD7, 0x0B, 0xA0, 0x1B, 0xC2, 0x21, 0x69, 0xFD, 0x21, 0x65, 0xFD, 0x46, 0x63,
-    0x64, 0x69, 0x6E, 0x76, 0x67, 0xA7, 0x0C, 0xFF, 0xE1, 0xFF, 0xE4, 0xFF, 0xF3, 0xA7, 0x12, 0xFF,
-    0xFD, 0xA0, 0x14, 0x22, 0x21, 0x73, 0xFD, 0xC2, 0x01, 0x91, 0x2E, 0x65, 0xAE, 0x30, 0xFF, 0xFD,
-    0x42, 0x2E, 0x73, 0xAD, 0xA9, 0xFF, 0xF7, 0x41, 0x68, 0xA8, 0xA3, 0x51, 0x2E, 0x61, 0x63, 0x64,
-    0x65, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x78, 0x79, 0xAD, 0x9E, 0xFF,
-    0x53, 0xFF, 0x5D, 0xFF, 0x64, 0xBC, 0x36, 0xFF, 0x6A, 0xFF, 0x7E, 0xFF, 0x91, 0xFF, 0x9E, 0xBC,
-    0x36, 0xFF, 0xAE, 0xFF, 0xD3, 0xFF, 0xF5, 0xFF, 0xFC, 0xAE, 0xD9, 0xAE, 0xD9, 0xAD, 0x9E, 0x41,
-    0x6D, 0xD9, 0x0E, 0x21, 0x61, 0xFC, 0x42, 0x6E, 0x6C, 0xA6, 0x8C, 0xFF, 0xFD, 0xC2, 0x01, 0x91,
-    0x73, 0x74, 0xAD, 0x9E, 0xA6, 0xA3, 0xC3, 0x02, 0x81, 0x61, 0x69, 0x74, 0xFF, 0xF7, 0xE7, 0x99,
-    0xAE, 0x8E, 0x42, 0x2E, 0x61, 0xAD, 0x52, 0xAD, 0x52, 0x43, 0x63, 0x6C, 0x6E, 0xFF, 0xF9, 0xAD,
-    0x40, 0xC5, 0xC3, 0x43, 0x65, 0x69, 0x6F, 0xAD, 0x41, 0xBA, 0xA9, 0xB7, 0xB0, 0x42, 0x74, 0x7A,
-    0xA6, 0x7C, 0xA6, 0x73, 0x21, 0x69, 0xF9, 0xA0, 0x25, 0x63, 0x21, 0x69, 0xFD, 0x21, 0x6E, 0xFD,
-    0x21, 0x65, 0xFD, 0xA0, 0x25, 0x92, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0x45, 0x64, 0x6F, 0x72,
-    0x67, 0x6B, 0xFF, 0xD7, 0xAD, 0x0D, 0xFF, 0xE8, 0xFF, 0xF4, 0xFF, 0xFD, 0x41, 0x6E, 0xD8, 0xA1,
-    0x21, 0x61, 0xFC, 0x42, 0x6C, 0x73, 0xFF, 0xFD, 0xB6, 0x2A, 0x48, 0x2E, 0x61, 0x65, 0x69, 0x6C,
-    0x6F, 0x73, 0x79, 0xB5, 0x46, 0xFF, 0x8C, 0xFF, 0x9C, 0xFF, 0xAF, 0xAC, 0xEF, 0xFF, 0xE2, 0xB5,
-    0x46, 0xFF, 0xF9, 0x41, 0x2E, 0xBB, 0xA2, 0xC3, 0x03, 0xD1, 0x62, 0x74, 0x6E, 0xAD, 0x6A, 0xB0,
-    0x09, 0xFF, 0xFC, 0xA0, 0x10, 0xC2, 0xA0, 0x10, 0xE2, 0x43, 0x6B, 0x6F, 0x75, 0xAC, 0xC0, 0xAD,
-    0xE0, 0xFF, 0xFD, 0xC1, 0x00, 0xD1, 0x79, 0xAC, 0xC1, 0xC1, 0x02, 0x41, 0x75, 0xAE, 0xA7, 0x41,
-    0x6C, 0xC9, 0x12, 0xC2, 0x03, 0xD1, 0x70, 0x75, 0xAC, 0xA6, 0xB7, 0x96, 0x41, 0x6D, 0xF1, 0xBE,
-    0xC4, 0x03, 0xE2, 0x61, 0x65, 0x69, 0x6F, 0xAC, 0xF9, 0xBD, 0x41, 0xAD, 0xD4, 0xFF, 0xFC, 0x41,
-    0x65, 0xA7, 0x8B, 0xC2, 0x03, 0xD1, 0x63, 0x6E, 0xAC, 0x91, 0xFF, 0xFC, 0x41, 0x63, 0xCA, 0xF2,
-    0x21, 0x69, 0xFC, 0x46, 0x61, 0x65, 0x6D, 0x6F, 0x70, 0x74, 0xAC, 0xB8, 0xAD, 0xB1, 0xA5, 0xA5,
-    0xAC, 0x81, 0xA5, 0xA5, 0xFF, 0xFD, 0xC1, 0x03, 0xD1, 0x61, 0xA5, 0x92, 0xC2, 0x03, 0xD1, 0x61,
-    0x65, 0xAC, 0x9F, 0xB1, 0x9F, 0x51, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x6C, 0x6D, 0x6E,
-    0x6F, 0x71, 0x73, 0x74, 0x75, 0x76, 0x7A, 0xFF, 0x82, 0xFF, 0x8E, 0xFF, 0x94, 0xBE, 0x66, 0xFE,
-    0x4A, 0xFF, 0x9E, 0xFF, 0xA4, 0xFF, 0xAA, 0xFF, 0xAE, 0xFF, 0xBB, 0xFF, 0xCE, 0xAE, 0x4B, 0xFF,
-    0xDE, 0xAC, 0x99, 0xAC, 0xEC, 0xFF, 0xF1, 0xFF, 0xF7, 0xC1, 0x01, 0x71, 0x6E, 0xA5, 0x49, 0x44,
-    0x2E, 0x64, 0x73, 0x74, 0xAD, 0x55, 0xAD, 0x55, 0xBC, 0xC2, 0xAE, 0x02, 0xA0, 0x17, 0x72, 0x21,
-    0x72, 0xFD, 0x21, 0x65, 0xFD, 0xC4, 0x02, 0x41, 0x61, 0x65, 0x6F, 0x69, 0xFF, 0xE4, 0xFF, 0xEA,
-    0xAC, 0x07, 0xFF, 0xFD, 0xC1, 0x04, 0x02, 0x65, 0xA5, 0x24, 0x41, 0x72, 0xAC, 0x18, 0x41, 0x72,
-    0xAF, 0x1F, 0x43, 0x61, 0x62, 0x79, 0xAF, 0x1B, 0xA5, 0x16, 0xAC, 0x29, 0x42, 0x6C, 0x74, 0xA5,
-    0x72, 0xAC, 0x1F, 0x43, 0x61, 0x6F, 0x79, 0xFF, 0xF9, 0xAB, 0xD6, 0xAB, 0xD6, 0x42, 0x65, 0x7A,
-    0xAC, 0x0E, 0xA5, 0x13, 0x42, 0x61, 0x69, 0xAE, 0xF9, 0xFF, 0xF9, 0x42, 0x72, 0x74, 0xAD, 0xB5,
-    0xAB, 0xBE, 0x41, 0x61, 0xB4, 0x4B, 0x41, 0x79, 0xA5, 0x9D, 0x21, 0x67, 0xFC, 0x21, 0x6F, 0xFD,
-    0xCE, 0x03, 0xD1, 0x62, 0x63, 0x64, 0x66, 0x67, 0x69, 0x6D, 0x6E, 0x72, 0x73, 0x75, 0x77, 0x6C,
-    0x74, 0xAB, 0xEB, 0xFF, 0xBA, 0xCF, 0x84, 0xB4, 0x00, 0xFF, 0xBE, 0xAD, 0xC9, 0xFF, 0xC2, 0xFF,
-    0xD3, 0xFF, 0xE4, 0xA6, 0x76, 0xFF, 0xEB, 0xFF, 0xF2, 0xFF, 0xFD, 0xB4, 0xE1, 0xC1, 0x01, 0x81,
-    0x74, 0xA4, 0xA5, 0x43, 0x68, 0x69, 0x74, 0xA4, 0xBD, 0xFF, 0xFA, 0xA5, 0x3C, 0xA0, 0x25, 0xD2,
-    0x21, 0x62, 0xFD, 0xA1, 0x00, 0x61, 0x61, 0xFD, 0x21, 0x73, 0xFB, 0x43, 0x6E, 0x73, 0x72, 0xA4,
-    0xA5, 0xD3, 0xFE, 0xFF, 0xFD, 0x21, 0x65, 0xF6, 0xA0, 0x25, 0xB2, 0x21, 0x72, 0xFD, 0x21, 0x6F,
-    0xFD, 0x21, 0x74, 0xFD, 0xC5, 0x03, 0xD1, 0x62, 0x63, 0x73, 0x76, 0x69, 0xA4, 0x86, 0xFF, 0xCF,
-    0xA4, 0x6E, 0xFF, 0xF1, 0xFF, 0xFD, 0xC1, 0x00, 0x51, 0x69, 0xA4, 0x83, 0xA0, 0x25, 0xF1, 0x21,
-    0x65, 0xFD, 0x21, 0x68, 0xFD, 0x21, 0x63, 0xFD, 0x43, 0x66, 0x6D, 0x61, 0xA4, 0x68, 0xFF, 0xEE,
-    0xFF, 0xFD, 0xC1, 0x02, 0xE1, 0x6C, 0xAC, 0xE5, 0x43, 0x65, 0x69, 0x73, 0xAF, 0x16, 0xC9, 0x86,
-    0xAB, 0x11, 0x44, 0x61, 0x63, 0x6D, 0x76, 0xFF, 0xF0, 0xFF, 0xF6, 0xB3, 0x5E, 0xA4, 0x36, 0x42,
-    0x69, 0x79, 0xA4, 0x4A, 0xAA, 0xFA, 0x41, 0x73, 0xFD, 0xDD, 0xA0, 0x26, 0x33, 0x21, 0x73, 0xFD,
-    0xA0, 0x26, 0x63, 0x22, 0x73, 0x74, 0xF7, 0xFD, 0x22, 0x65, 0x69, 0xF5, 0xFB, 0x21, 0x6C, 0xFB,
-    0x43, 0x68, 0x69, 0x6F, 0xA8, 0x25, 0xFF, 0xE6, 0xFF, 0xFD, 0x41, 0x70, 0xA4, 0x10, 0xA0, 0x26,
-    0x03, 0x21, 0x6D, 0xFD, 0x21, 0x75, 0xFD, 0x21, 0x65, 0xFD, 0x42, 0x63, 0x74, 0xD8, 0xEB, 0xA4,
-    0x00, 0x21, 0x69, 0xF9, 0x47, 0x6D, 0x6E, 0x70, 0x73, 0x76, 0x6C, 0x66, 0xB1, 0xC0, 0xFF, 0xBB,
-    0xFF, 0xDC, 0xFF, 0xE6, 0xA3, 0xF6, 0xFF, 0xF3, 0xFF, 0xFD, 0x42, 0x69, 0x73, 0xA3, 0xE6, 0xA3,
-    0xC8, 0x45, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xFF, 0x53, 0xFF, 0x77, 0xFF, 0x91, 0xFF, 0xE3, 0xFF,
-    0xF9, 0xC1, 0x01, 0x41, 0x68, 0xA8, 0xC3, 0xC3, 0x0A, 0x23, 0x63, 0x68, 0x77, 0xFF, 0xFA, 0xA3,
-    0xB1, 0xAB, 0xA2, 0xA0, 0x26, 0x92, 0x21, 0x74, 0xFD, 0x21, 0x75, 0xFD, 0x21, 0x62, 0xFD, 0x21,
-    0x69, 0xFD, 0xC4, 0x06, 0x63, 0x65, 0x6F, 0x75, 0x72, 0xAC, 0x8B, 0xAA, 0x6A, 0xA3, 0x96, 0xFF,
-    0xFD, 0xC1, 0x01, 0xF1, 0x72, 0xAA, 0x9A, 0x41, 0x69, 0xB9, 0xEC, 0x41, 0x2E, 0xB2, 0xBF, 0xC1,
-    0x02, 0xE1, 0x73, 0xA3, 0x8B, 0x41, 0x72, 0xA5, 0x02, 0x21, 0x61, 0xFC, 0x45, 0x65, 0x69, 0x6F,
-    0x79, 0x6E, 0xAB, 0x78, 0xFF, 0xF3, 0xA3, 0x84, 0xAA, 0x48, 0xFF, 0xFD, 0xCB, 0x03, 0xD1, 0x61,
-    0x62, 0x64, 0x65, 0x66, 0x69, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0xFF, 0xD5, 0xAD, 0x42, 0xA4, 0xFA,
-    0xAA, 0x2D, 0xB4, 0xBF, 0xBA, 0xBF, 0xAB, 0x68, 0xFF, 0xDB, 0xFF, 0xDF, 0xFF, 0xF0, 0xAB, 0x68,
-    0xC4, 0x02, 0x31, 0x61, 0x69, 0x6F, 0x68, 0xB1, 0xEA, 0xAC, 0xB1, 0xAA, 0x09, 0xAB, 0xAA, 0x41,
-    0x6C, 0xB6, 0x17, 0x43, 0x65, 0x68, 0x61, 0xA4, 0xB4, 0xAA, 0x01, 0xFF, 0xFC, 0xC3, 0x03, 0xD1,
-    0x61, 0x6C, 0x70, 0xA9, 0xEC, 0xB2, 0x43, 0xFF, 0xF6, 0x56, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
-    0x67, 0x68, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A,
-    0xFB, 0x3C, 0xB9, 0x51, 0xFB, 0x88, 0xB1, 0xC1, 0xFC, 0x42, 0xB9, 0x51, 0xB1, 0xC1, 0xFC, 0xF1,
-    0xFD, 0x8C, 0xFD, 0xDC, 0xFD, 0xEB, 0xD7, 0x9A, 0xFE, 0x37, 0xB1, 0xC1, 0xFF, 0x48, 0xFF, 0x5E,
-    0xFF, 0x79, 0xFF, 0xB3, 0xA9, 0xE0, 0xFF, 0xD7, 0xFF, 0xF4, 0xBC, 0x4C, 0x42, 0x61, 0x69, 0xA9,
-    0xA8, 0xA2, 0xCC, 0x41, 0x6E, 0xA2, 0xE0, 0x44, 0x61, 0x64, 0x69, 0x74, 0xFF, 0xFC, 0xA4, 0x5F,
-    0xA2, 0xD3, 0xA2, 0xD3, 0x42, 0x69, 0x75, 0xA9, 0xC7, 0xA2, 0xC0, 0x21, 0x74, 0xF9, 0x21, 0x61,
-    0xFD, 0x21, 0x72, 0xFD, 0x47, 0x62, 0x63, 0x6E, 0x72, 0x74, 0x76, 0x64, 0xA9, 0x75, 0xA2, 0xA4,
-    0xFF, 0xD8, 0xFF, 0xE3, 0xAB, 0x16, 0xA2, 0xA4, 0xFF, 0xFD, 0xC1, 0x02, 0x21, 0x6F, 0xAA, 0x7F,
-    0xC2, 0x02, 0x31, 0x6C, 0x72, 0xAA, 0x79, 0xFF, 0xFA, 0x41, 0x67, 0xAB, 0x78, 0xA1, 0x07, 0x42,
-    0x6E, 0xFC, 0x41, 0x65, 0xAA, 0xC1, 0x23, 0x65, 0x69, 0x6C, 0xEA, 0xF7, 0xFC, 0x42, 0x62, 0x74,
-    0xA2, 0x6B, 0xA9, 0xD4, 0x46, 0x61, 0x69, 0x6C, 0x72, 0x75, 0x79, 0xA9, 0xB3, 0xFF, 0xF9, 0xA6,
-    0x29, 0xA9, 0xB3, 0xA9, 0xB3, 0xAA, 0x55, 0x43, 0x72, 0x73, 0x76, 0xA9, 0x64, 0xA9, 0x48, 0xA2,
-    0x4B, 0x42, 0x64, 0x73, 0xA9, 0x5A, 0xA9, 0x5A, 0x44, 0x63, 0x65, 0x73, 0x74, 0xAA, 0xB2, 0xFF,
-    0xF9, 0xA9, 0x1C, 0xA9, 0x14, 0xC1, 0x01, 0x41, 0x79, 0xD6, 0x9D, 0x21, 0x6E, 0xFA, 0x46, 0x64,
-    0x65, 0x69, 0x6F, 0x73, 0x75, 0xA9, 0x06, 0xFF, 0xD9, 0xFF, 0xEA, 0xFF, 0xFD, 0xAC, 0x10, 0xAA,
-    0x1B, 0x43, 0x65, 0x73, 0x74, 0xAA, 0x08, 0xA2, 0x11, 0xA2, 0x54, 0x41, 0x69, 0xA6, 0x42, 0x41,
-    0x6D, 0xA2, 0x15, 0x23, 0x6E, 0x72, 0x61, 0xEE, 0xF8, 0xFC, 0x42, 0x61, 0x6C, 0xAA, 0x0A, 0xA9,
-    0x4D, 0x41, 0x65, 0xB3, 0x42, 0x42, 0x68, 0x69, 0xFF, 0xFC, 0xA9, 0xA2, 0xC1, 0x02, 0x31, 0x67,
-    0xAA, 0x5E, 0x41, 0x6D, 0xA1, 0xE6, 0xC1, 0x00, 0x71, 0x65, 0xDA, 0x89, 0xC5, 0x10, 0xC2, 0x6C,
-    0x6E, 0x72, 0x74, 0x76, 0xBA, 0x17, 0xFF, 0xF0, 0xFF, 0xF6, 0xA5, 0x61, 0xFF, 0xFA, 0xC2, 0x02,
-    0xB1, 0x62, 0x74, 0xA1, 0xE2, 0xAD, 0x6A, 0xC1, 0x00, 0x41, 0x65, 0xAA, 0x89, 0x21, 0x68, 0xFA,
-    0xC1, 0x02, 0x31, 0x6E, 0xAA, 0x2A, 0xC3, 0x02, 0x81, 0x61, 0x6E, 0x73, 0xA8, 0x86, 0xC3, 0x8A,
-    0xAD, 0xBD, 0x42, 0x62, 0x73, 0xC2, 0x28, 0xA9, 0x0F, 0x42, 0x61, 0x69, 0xAB, 0xB1, 0xFF, 0xF9,
-    0xC1, 0x01, 0x91, 0x65, 0xAC, 0x6E, 0x43, 0x69, 0x72, 0x75, 0xA8, 0xD2, 0xF9, 0x76, 0xA8, 0x63,
-    0xC1, 0x02, 0x21, 0x6C, 0xA8, 0x64, 0x4D, 0x61, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6C, 0x6D, 0x6F,
-    0x73, 0x74, 0x75, 0x76, 0xFF, 0xB8, 0xFF, 0xC7, 0xE2, 0xA0, 0xFF, 0xCA, 0xAB, 0x68, 0xFF, 0xD0,
-    0xFF, 0xE3, 0xB3, 0xF0, 0xBB, 0x45, 0xFF, 0xEA, 0xFF, 0xF0, 0xFF, 0xFA, 0xA8, 0x5E, 0x42, 0x69,
-    0x6C, 0xA8, 0xC3, 0xAF, 0x11, 0xC1, 0x02, 0xB1, 0x6E, 0xBE, 0x03, 0x41, 0x72, 0xA4, 0xB6, 0x45,
-    0x61, 0x62, 0x69, 0x6F, 0x70, 0xA8, 0xA4, 0xFF, 0xEF, 0xFF, 0xF6, 0xFF, 0xFC, 0xAB, 0x4E, 0xC1,
-    0x02, 0x11, 0x72, 0xA8, 0xA2, 0xC4, 0x02, 0xB1, 0x6D, 0x6E, 0x73, 0x76, 0xA8, 0x9C, 0xA8, 0x64,
-    0xAD, 0x3E, 0xA1, 0x45, 0xC1, 0x07, 0xE2, 0x77, 0xA8, 0x8D, 0x42, 0x72, 0x73, 0xA9, 0xBD, 0xA8,
-    0x87, 0x42, 0x61, 0x65, 0xF3, 0xF3, 0xFF, 0xF9, 0x48, 0x61, 0x65, 0x69, 0x73, 0x74, 0x75, 0x79,
-    0x7A, 0xA5, 0xAF, 0xFF, 0xD7, 0xFF, 0xDD, 0xFF, 0xEC, 0xFF, 0xF9, 0xA1, 0x10, 0xA7, 0xEC, 0xA7,
-    0xEC, 0x43, 0x72, 0x73, 0x75, 0xA9, 0xEC, 0xA7, 0xCB, 0xA9, 0x69, 0xC1, 0x02, 0xB1, 0x72, 0xA6,
-    0xBF, 0x42, 0x61, 0x6E, 0xA7, 0xBB, 0xC2, 0xBF, 0x41, 0x74, 0xA1, 0x2A, 0x21, 0x72, 0xFC, 0xA1,
-    0x01, 0xE1, 0x6F, 0xFD, 0x42, 0x69, 0x75, 0xCC, 0x9C, 0xA0, 0xCE, 0x45, 0x65, 0x69, 0x6C, 0x70,
-    0x74, 0xFF, 0xE0, 0xFF, 0xE6, 0xA8, 0x1C, 0xFF, 0xF4, 0xFF, 0xF9, 0x41, 0x2E, 0xC6, 0xC2, 0xC4,
-    0x02, 0xB1, 0x2E, 0x67, 0x73, 0x6C, 0xA7, 0x8A, 0xA8, 0xAA, 0xA8, 0xAA, 0xFF, 0xFC, 0x42, 0x65,
-    0x72, 0xAA, 0xBC, 0xA8, 0x13, 0xC1, 0x02, 0x21, 0x69, 0xA4, 0x91, 0x41, 0x6C, 0xD9, 0x40, 0x46,
-    0x66, 0x6E, 0x6F, 0x74, 0x7A, 0x61, 0xFF, 0xF6, 0xA7, 0xD9, 0xA7, 0xE8, 0xA9, 0x0B, 0xA7, 0xAC,
-    0xFF, 0xFC, 0x41, 0x67, 0xC3, 0xE6, 0x21, 0x6E, 0xFC, 0xA1, 0x02, 0x81, 0x69, 0xFD, 0xC1, 0x00,
-    0x41, 0x65, 0xA7, 0xE3, 0x43, 0x65, 0x68, 0x69, 0xAB, 0x72, 0xA9, 0xC8, 0xFF, 0xFA, 0x4E, 0x61,
-    0x62, 0x63, 0x64, 0x65, 0x66, 0x69, 0x6C, 0x6E, 0x6F, 0x70, 0x73, 0x74, 0x75, 0xFF, 0xB1, 0xA8,
-    0x12, 0xA0, 0x6A, 0xA7, 0xAA, 0xA0, 0x88, 0xFF, 0xC0, 0xFF, 0xD1, 0xFF, 0xEB, 0xAA, 0x72, 0xA9,
-    0xE3, 0xD2, 0xB4, 0xAE, 0x9D, 0xFF, 0xF6, 0xA7, 0xB9, 0x43, 0x64, 0x6E, 0x70, 0xA7, 0x13, 0xA7,
-    0x13, 0xA7, 0xA8, 0xC1, 0x00, 0xD1, 0x69, 0xA7, 0x48, 0x42, 0x61, 0x72, 0xA0, 0x47, 0xB9, 0x48,
-    0x42, 0x61, 0x63, 0xA6, 0xFC, 0xA7, 0x77, 0x41, 0x72, 0xAB, 0x77, 0x42, 0x65, 0x72, 0xFF, 0xFC,
-    0xA7, 0x5D, 0xC1, 0x02, 0x11, 0x72, 0xA0, 0x10, 0xC9, 0x02, 0x41, 0x61, 0x63, 0x65, 0x69, 0x6C,
-    0x70, 0x73, 0x74, 0x75, 0xFF, 0xD1, 0xFF, 0xDB, 0xFF, 0xE1, 0xFF, 0xE8, 0xA7, 0x95, 0xA7, 0x50,
-    0xA8, 0x0B, 0xFF, 0xF3, 0xFF, 0xFA, 0x42, 0x62, 0x74, 0x9F, 0xF2, 0xA7, 0x41, 0xC1, 0x01, 0x91,
-    0x69, 0x9F, 0xE5, 0x43, 0x2E, 0x6C, 0x6E, 0xA6, 0xB6, 0xA6, 0xB6, 0xFF, 0xFA, 0x42, 0x65, 0x67,
-    0xA7, 0x2A, 0xA6, 0xEE, 0x41, 0x6E, 0xCD, 0x24, 0xC5, 0x0A, 0x23, 0x6C, 0x6E, 0x6F, 0x73, 0x7A,
-    0xB8, 0x0B, 0xFF, 0xF5, 0xFF, 0xFC, 0xA7, 0xC1, 0xA8, 0x90, 0x41, 0x69, 0xD2, 0x59, 0x21, 0x74,
-    0xFC, 0x21, 0x61, 0xFD, 0x45, 0x66, 0x67, 0x6D, 0x6E, 0x75, 0xA6, 0x90, 0x9F, 0xCC, 0xFF, 0xFD,
-    0xA6, 0x88, 0xA7, 0xA5, 0x46, 0x61, 0x65, 0x69, 0x6C, 0x6F, 0x73, 0xFF, 0xB2, 0xFF, 0xBF, 0xFF,
-    0xD4, 0xA9, 0x52, 0xFF, 0xF0, 0x9F, 0xA4, 0xC1, 0x02, 0x21, 0x6D, 0xA6, 0xFA, 0x56, 0x61, 0x62,
-    0x63, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74,
-    0x75, 0x76, 0x78, 0x7A, 0xFC, 0xE7, 0xFD, 0x19, 0xFD, 0x27, 0xFD, 0x61, 0xFD, 0x86, 0xFD, 0x8D,
-    0xFD, 0x98, 0xFD, 0xAF, 0xA6, 0x5F, 0xA6, 0x5C, 0xFE, 0x09, 0xFE, 0x42, 0xFE, 0x7B, 0xFE, 0x94,
-    0xFE, 0xBE, 0xFF, 0x21, 0xFF, 0x7B, 0xFF, 0xE7, 0xFF, 0xFA, 0xB6, 0xD4, 0xB2, 0x56, 0xA7, 0x33,
-    0xA0, 0x11, 0x23, 0x42, 0x69, 0x75, 0xB1, 0x06, 0x9F, 0x57, 0x41, 0x72, 0xA7, 0x1C, 0x21, 0x65,
-    0xFC, 0xC2, 0x00, 0x51, 0x65, 0x75, 0xA6, 0xA0, 0xFF, 0xFD, 0x43, 0x69, 0x6F, 0x75, 0xAA, 0x84,
-    0x9F, 0x46, 0x9F, 0x3A, 0x41, 0x65, 0xAC, 0x7A, 0x21, 0x69, 0xFC, 0x41, 0x76, 0xA7, 0x8F, 0xA1,
-    0x02, 0x71, 0x69, 0xFC, 0x41, 0x76, 0xA0, 0xC0, 0x21, 0x65, 0xFC, 0x21, 0x64, 0xFD, 0xCB, 0x03,
-    0xD1, 0x2E, 0x62, 0x63, 0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x74, 0x75, 0xA7, 0xD2, 0xFF, 0xC2,
-    0xFF, 0xC5, 0xFF, 0xD3, 0xFF, 0xDC, 0xA9, 0x96, 0xDF, 0x23, 0xCD, 0x4D, 0xFF, 0xEA, 0xFF, 0xF1,
-    0xFF, 0xFD, 0x44, 0x2E, 0x6C, 0x6F, 0x79, 0xA6, 0x35, 0xA1, 0xC5, 0xA6, 0x4F, 0xA6, 0xD7, 0x42,
-    0x6F, 0x75, 0xA0, 0x7A, 0xA8, 0x98, 0xC1, 0x01, 0x41, 0x79, 0xE7, 0x3E, 0xE1, 0x02, 0x21, 0x63,
-    0x7F, 0x9E, 0xE4, 0xA0, 0x11, 0xD2, 0x21, 0x67, 0xFD, 0x45, 0x2E, 0x6C, 0x6E, 0x73, 0x69, 0xA7,
-    0x87, 0xFF, 0xED, 0xFF, 0xF3, 0xA6, 0xB0, 0xFF, 0xFD, 0x41, 0x69, 0xB4, 0xCA, 0x41, 0x65, 0xA6,
-    0xB7, 0x46, 0x64, 0x65, 0x69, 0x6D, 0x73, 0x74, 0xA6, 0x98, 0xFF, 0xE8, 0xA4, 0xB5, 0xFF, 0xF8,
-    0xFF, 0xFC, 0xC5, 0x74, 0x41, 0x74, 0xC3, 0xBF, 0x62, 0x65, 0x69, 0x7F, 0x9E, 0x90, 0x7F, 0xFF,
-    0xFC, 0xC2, 0x0A, 0x02, 0x2E, 0x74, 0xA5, 0x58, 0xFF, 0xF7, 0xE1, 0x02, 0x31, 0x72, 0x7F, 0x9E,
-    0x90, 0x42, 0x65, 0x79, 0xFF, 0xF9, 0xA5, 0xE0, 0x68, 0x2E, 0x64, 0x67, 0x6C, 0x6E, 0x72, 0x73,
-    0x74, 0x7F, 0xA5, 0x41, 0x7F, 0xA5, 0x41, 0x7F, 0x9E, 0x82, 0x7F, 0xFF, 0x8A, 0x7F, 0xFF, 0x97,
-    0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xE9, 0x7F, 0xFF, 0xF9, 0x42, 0x6C, 0x6E, 0xCC, 0x92, 0xA7, 0x17,
-    0x44, 0x2E, 0x64, 0x6E, 0x73, 0xA7, 0x10, 0xA7, 0x10, 0xAD, 0x73, 0xA7, 0x10, 0x42, 0x65, 0x69,
-    0xFF, 0xF3, 0xA7, 0x03, 0x42, 0x74, 0x7A, 0xA6, 0xFC, 0xD2, 0xE7, 0xA1, 0x02, 0x41, 0x69, 0xF9,
-    0xE4, 0x02, 0xB1, 0x61, 0x63, 0x64, 0x67, 0x7F, 0xA6, 0x31, 0x7F, 0xA5, 0x59, 0x7F, 0x9E, 0x40,
-    0x7F, 0xA4, 0xF9, 0x63, 0x6C, 0x72, 0x75, 0x7F, 0x9E, 0x27, 0x7F, 0xB5, 0x4B, 0x7F, 0xA5, 0x55,
-    0x63, 0x69, 0x6F, 0x75, 0x7F, 0x9E, 0x1D, 0x7F, 0xA5, 0x1B, 0x7F, 0xA5, 0x1B, 0x63, 0x69, 0x72,
-    0x79, 0x7F, 0xA4, 0xCC, 0x7F, 0x9E, 0x0D, 0x7F, 0xA4, 0xCC, 0xA0, 0x26, 0xE3, 0x21, 0x72, 0xFD,
-    0x21, 0x61, 0xFD, 0x21, 0x70, 0xFD, 0xA1, 0x02, 0x71, 0x69, 0xFD, 0x6D, 0x61, 0x64, 0x66, 0x67,
-    0x6B, 0x6C, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x76, 0x7F, 0xFF, 0x8E, 0x7F, 0xFF, 0xA2, 0x7F,
-    0xA5, 0x2C, 0x7F, 0xA5, 0x8C, 0x7F, 0x9D, 0xDD, 0x7F, 0xFF, 0xB0, 0x7F, 0xFF, 0xB5, 0x7F, 0xFF,
-    0xC8, 0x7F, 0xA5, 0x46, 0x7F, 0xA8, 0x69, 0x7F, 0xFF, 0xD5, 0x7F, 0xFF, 0xE2, 0x7F, 0xFF, 0xFB,
-    0xA0, 0x26, 0xB3, 0x21, 0x75, 0xFD, 0x21, 0x64, 0xFD, 0x41, 0x70, 0xA2, 0x1E, 0x21, 0x65, 0xFC,
-    0xA2, 0x00, 0x51, 0x72, 0x63, 0xF6, 0xFD, 0x44, 0x61, 0x65, 0x74, 0x76, 0xA4, 0xFA, 0xA4, 0x65,
-    0xA6, 0x59, 0xA5, 0x9D, 0x63, 0x61, 0x69, 0x79, 0x7F, 0xC9, 0x4C, 0x7F, 0x9D, 0x7E, 0x7F, 0xA4,
-    0xED, 0x42, 0x61, 0x65, 0xA4, 0xE0, 0xC0, 0x74, 0x47, 0x2E, 0x69, 0x6B, 0x6C, 0x6D, 0x72, 0x74,
-    0xA6, 0x38, 0xFF, 0xD8, 0xA5, 0x7C, 0xFF, 0xDF, 0xAB, 0x4C, 0xFF, 0xEC, 0xFF, 0xF9, 0x46, 0x61,
-    0x65, 0x69, 0x6F, 0x76, 0x79, 0xFE, 0x50, 0xFE, 0xEA, 0xFF, 0x7D, 0xFF, 0xEA, 0xA5, 0x63, 0xA5,
-    0x4B, 0x41, 0x6C, 0xA4, 0x1B, 0x62, 0x65, 0x6F, 0x7F, 0xAC, 0x25, 0x7F, 0x9D, 0x5B, 0xA0, 0x27,
-    0x13, 0x21, 0x61, 0xFD, 0x21, 0x77, 0xFD, 0xA1, 0x00, 0x51, 0x65, 0xFD, 0x21, 0x74, 0xFB, 0x41,
-    0x65, 0xA4, 0x69, 0xA0, 0x27, 0x42, 0x42, 0x72, 0x67, 0xA3, 0xFE, 0xFF, 0xFD, 0x21, 0x65, 0xF9,
-    0x6A, 0x62, 0x63, 0x67, 0x69, 0x6C, 0x6D, 0x72, 0x73, 0x74, 0x76, 0x7F, 0xFF, 0xD1, 0x7F, 0xAC,
-    0x40, 0x7F, 0xFF, 0xD5, 0x7F, 0xA2, 0x03, 0x7F, 0xA5, 0xD1, 0x7F, 0x9D, 0x18, 0x7F, 0x9E, 0x81,
-    0x7F, 0xFF, 0xEC, 0x7F, 0xFF, 0xEF, 0x7F, 0xFF, 0xFD, 0x42, 0x72, 0x74, 0xA2, 0x06, 0xAD, 0x61,
-    0x41, 0x6E, 0xA0, 0x10, 0x63, 0x74, 0x76, 0x6B, 0x7F, 0x9E, 0x73, 0x7F, 0x9C, 0xFC, 0x7F, 0xFF,
-    0xFC, 0x47, 0x61, 0x64, 0x65, 0x6C, 0x72, 0x73, 0x76, 0xFF, 0xE8, 0xB9, 0x37, 0xFF, 0xF3, 0xA1,
-    0x0C, 0xA5, 0x49, 0xA1, 0x19, 0xA4, 0x26, 0xC1, 0x00, 0xD1, 0x6C, 0xBF, 0xFA, 0x62, 0x64, 0x67,
-    0x7F, 0x9C, 0xF8, 0x7F, 0x9C, 0xBB, 0x61, 0x70, 0x7F, 0x9C, 0xD3, 0x21, 0x73, 0xFB, 0x21, 0x65,
-    0xFD, 0xE7, 0x02, 0x81, 0x6C, 0x6E, 0x72, 0x73, 0x74, 0x7A, 0x64, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF,
-    0xEC, 0x7F, 0x9C, 0xA7, 0x7F, 0xFD, 0xFC, 0x7F, 0xA0, 0xE5, 0x7F, 0x9C, 0xBF, 0x7F, 0xFF, 0xFD,
-    0x42, 0x65, 0x69, 0xB2, 0xF3, 0xA8, 0x9B, 0x41, 0x65, 0xA4, 0x30, 0x41, 0x6E, 0xB7, 0xF3, 0x21,
-    0x65, 0xFC, 0xE3, 0x11, 0x52, 0x6D, 0x76, 0x6B, 0x7F, 0x9C, 0x82, 0x7F, 0xFF, 0xF5, 0x7F, 0xFF,
-    0xFD, 0x61, 0x6F, 0x7F, 0x9D, 0xF6, 0x21, 0x72, 0xFB, 0x21, 0x61, 0xFD, 0xA1, 0x00, 0x51, 0x70,
-    0xFD, 0x42, 0x61, 0x65, 0xA1, 0xA0, 0xCE, 0xC6, 0xA1, 0x00, 0x51, 0x74, 0xF9, 0x22, 0x61, 0x69,
-    0xEF, 0xFB, 0x44, 0x68, 0x6C, 0x70, 0x74, 0xA3, 0x95, 0xA3, 0xAF, 0xA3, 0xEE, 0xAE, 0x8D, 0x6F,
-    0x61, 0x62, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x79, 0x63, 0x7F,
-    0xFF, 0x21, 0x7F, 0xA4, 0xAB, 0x7F, 0xFF, 0x62, 0x7F, 0x9C, 0x9F, 0x7F, 0xFF, 0x92, 0x7F, 0xA4,
-    0x2A, 0x7F, 0xFF, 0xB1, 0x7F, 0xDD, 0x27, 0x7F, 0xFF, 0xC3, 0x7F, 0xA3, 0x0D, 0x7F, 0xFF, 0xEE,
-    0x7F, 0xFF, 0xF3, 0x7F, 0xA3, 0x0A, 0x7F, 0xA3, 0xA2, 0x7F, 0xA3, 0x88, 0xE5, 0x02, 0xB1, 0x63,
-    0x67, 0x6D, 0x70, 0x73, 0x7F, 0xA0, 0x19, 0x7F, 0xDC, 0xEA, 0x7F, 0x9C, 0x0E, 0x7F, 0xA3, 0xED,
-    0x7F, 0x9C, 0x14, 0xA0, 0x06, 0x72, 0x41, 0x75, 0xB3, 0x54, 0x62, 0x69, 0x6F, 0x7F, 0x9B, 0xDE,
-    0x7F, 0xA2, 0xBA, 0xC3, 0x02, 0xB1, 0x63, 0x64, 0x72, 0xFF, 0xF3, 0xA3, 0x06, 0xFF, 0xF7, 0xE1,
-    0x00, 0xD1, 0x6C, 0x7F, 0x9B, 0xEA, 0xE2, 0x02, 0xB1, 0x69, 0x75, 0x7F, 0xFF, 0xF9, 0x7F, 0x9B,
-    0xC2, 0x42, 0x65, 0x69, 0xA3, 0xA8, 0xA8, 0x8C, 0xC4, 0x02, 0x21, 0x61, 0x63, 0x64, 0x6D, 0xA2,
-    0x8C, 0xA2, 0x8C, 0xC9, 0xF3, 0xFF, 0xF9, 0x41, 0x6E, 0xB8, 0x0C, 0x61, 0x6F, 0x7F, 0x9B, 0xE7,
-    0x21, 0x74, 0xFB, 0x62, 0x63, 0x64, 0x7F, 0xFF, 0xFD, 0x7F, 0x9B, 0xA7, 0xA2, 0x02, 0x21, 0x61,
-    0x65, 0xEB, 0xF7, 0xC1, 0x07, 0x82, 0x69, 0xA2, 0xD4, 0xC1, 0x02, 0xB1, 0x61, 0xA2, 0x92, 0x61,
-    0x73, 0x7F, 0x9D, 0x25, 0x21, 0x69, 0xFB, 0xA1, 0x02, 0xB1, 0x75, 0xFD, 0x4B, 0x61, 0x63, 0x65,
-    0x68, 0x69, 0x6F, 0x70, 0x74, 0x75, 0x78, 0x71, 0xFF, 0x70, 0xFF, 0x87, 0xFF, 0x97, 0xFF, 0xAA,
-    0xFF, 0xBC, 0xBA, 0x05, 0xFF, 0xE0, 0xFF, 0xE7, 0xFF, 0xED, 0xA2, 0xD5, 0xFF, 0xFB, 0x43, 0x63,
-    0x72, 0x74, 0xA2, 0x1E, 0xC4, 0x51, 0xA2, 0x1E, 0xC1, 0x00, 0x51, 0x64, 0xE0, 0x00, 0xA1, 0x02,
-    0x21, 0x65, 0xFA, 0x62, 0x6D, 0x74, 0x7F, 0x9B, 0x2F, 0x7F, 0x9B, 0x2F, 0xC3, 0x02, 0xB1, 0x65,
-    0x68, 0x6F, 0xBB, 0x2F, 0xFF, 0xF2, 0xFF, 0xF7, 0xC1, 0x02, 0xB1, 0x66, 0xA3, 0x11, 0x41, 0x79,
-    0xA0, 0xA2, 0x21, 0x72, 0xFC, 0x21, 0x65, 0xFD, 0xA1, 0x00, 0x51, 0x74, 0xFD, 0x44, 0x65, 0x72,
-    0x73, 0x74, 0xA1, 0xDF, 0xFF, 0xEB, 0xFF, 0xFB, 0xA2, 0x74, 0x44, 0x61, 0x6C, 0x6F, 0x75, 0xA2,
-    0x4D, 0xD9, 0xBF, 0xA2, 0x4D, 0xA1, 0xD2, 0x61, 0x6C, 0x7F, 0x9B, 0x18, 0x21, 0x6F, 0xFB, 0x41,
-    0x79, 0xA1, 0xE6, 0x21, 0x72, 0xFC, 0xA1, 0x00, 0x51, 0x74, 0xFD, 0x43, 0x62, 0x65, 0x70, 0xFF,
-    0xF1, 0xFF, 0xFB, 0xCB, 0x51, 0x45, 0x63, 0x64, 0x67, 0x69, 0x78, 0xD6, 0x85, 0xA1, 0xAF, 0xA1,
-    0xAF, 0xA3, 0xC4, 0xA3, 0x9B, 0x42, 0x65, 0x73, 0xA1, 0xBA, 0xA2, 0xB4, 0xE5, 0x07, 0x42, 0x64,
-    0x67, 0x6D, 0x6E, 0x73, 0x7F, 0xA1, 0x98, 0x7F, 0xA3, 0xB5, 0x7F, 0x9A, 0xBC, 0x7F, 0xFF, 0xF9,
-    0x7F, 0xA2, 0xAD, 0x62, 0x64, 0x72, 0x7F, 0xA2, 0x96, 0x7F, 0x9A, 0xC6, 0xC1, 0x02, 0x21, 0x63,
-    0xA2, 0x8D, 0x41, 0x61, 0xA4, 0x9B, 0x45, 0x65, 0x69, 0x6F, 0x74, 0x75, 0xFF, 0xED, 0xA1, 0xA5,
-    0xFF, 0xF6, 0xFF, 0xFC, 0xA1, 0x66, 0x44, 0x61, 0x69, 0x6F, 0x72, 0xAC, 0x1A, 0xA3, 0x95, 0xA1,
-    0xD1, 0xA1, 0xEB, 0x43, 0x63, 0x6F, 0x73, 0xA2, 0x04, 0xA1, 0x88, 0xA2, 0x81, 0x41, 0x6F, 0xA2,
-    0xDD, 0xC2, 0x01, 0xF1, 0x61, 0x72, 0xA1, 0x7A, 0xFF, 0xFC, 0x67, 0x63, 0x65, 0x69, 0x6F, 0x73,
-    0x74, 0x75, 0x7F, 0xA1, 0xC7, 0x7F, 0xFE, 0x79, 0x7F, 0xFF, 0xE9, 0x7F, 0xA2, 0x4F, 0x7F, 0x9A,
-    0x5E, 0x7F, 0xFF, 0xF7, 0x7F, 0x9B, 0xF8, 0x41, 0x69, 0xBF, 0x9B, 0x42, 0x68, 0x69, 0xFF, 0xFC,
-    0xAD, 0xFC, 0x51, 0x61, 0x62, 0x63, 0x64, 0x65, 0x67, 0x68, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
-    0x72, 0x73, 0x74, 0x77, 0xFE, 0xEC, 0xA2, 0xA8, 0xFF, 0x0A, 0xA2, 0xA8, 0xFF, 0x2B, 0xA5, 0xD6,
-    0xA9, 0x61, 0xA2, 0xA8, 0xFF, 0x38, 0xFF, 0x59, 0xFF, 0x63, 0xFF, 0x7A, 0xFF, 0xA4, 0xFF, 0xB4,
-    0xFF, 0xD8, 0xFF, 0xF9, 0xA2, 0xA8, 0xE2, 0x01, 0xF1, 0x62, 0x72, 0x7F, 0xB1, 0xFC, 0x7F, 0x9B,
-    0xA0, 0xC1, 0x02, 0xB1, 0x6F, 0xA1, 0x0A, 0xE4, 0x02, 0x41, 0x6E, 0x70, 0x72, 0x74, 0x7F, 0xA1,
-    0x5A, 0x7F, 0xA1, 0x5A, 0x7F, 0xFF, 0xFA, 0x7F, 0x99, 0xF1, 0x41, 0x6E, 0xA2, 0x29, 0xC3, 0x03,
-    0xE2, 0x6C, 0x73, 0x61, 0xA1, 0xCB, 0xA1, 0xCB, 0xFF, 0xFC, 0xA0, 0x19, 0x82, 0x21, 0x72, 0xFD,
-    0x21, 0x68, 0xFD, 0xC3, 0x03, 0xD1, 0x6D, 0x6F, 0x70, 0xA1, 0x2E, 0xA1, 0xC0, 0xFF, 0xFD, 0xC2,
-    0x0A, 0x23, 0x79, 0x77, 0xA1, 0xAA, 0xCD, 0xF1, 0x69, 0x61, 0x62, 0x65, 0x69, 0x6C, 0x6D, 0x6F,
-    0x74, 0x7A, 0x7F, 0xFF, 0xAE, 0x7F, 0xA0, 0x81, 0x7F, 0xFF, 0xBF, 0x7F, 0xFF, 0xD6, 0x7F, 0xA2,
-    0x78, 0x7F, 0xA0, 0x81, 0x7F, 0xFF, 0xEB, 0x7F, 0x99, 0xED, 0x7F, 0xFF, 0xF7, 0x5B, 0x2E, 0x61,
-    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71,
-    0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xA0, 0x16, 0xA7, 0x72, 0xAA, 0x96, 0xAE,
-    0xF7, 0xB3, 0x08, 0xBB, 0x8C, 0xBD, 0xBA, 0xC0, 0x91, 0xC3, 0x6B, 0xC9, 0xA0, 0xCA, 0x3D, 0xCB,
-    0x0E, 0xCF, 0xE3, 0xD3, 0xFE, 0xD8, 0xF4, 0xDF, 0x23, 0xE3, 0x9B, 0xE4, 0x25, 0xEA, 0x8B, 0xF0,
-    0xDD, 0xF6, 0x7C, 0xFA, 0x00, 0xFC, 0x31, 0xFD, 0x52, 0xFE, 0x1F, 0xFF, 0x55, 0xFF, 0xDB,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xDE, 0x16, 0x00, 0xFA, 0x16, 0x00, 0x14, 0x17,
+    0x00, 0x3E, 0x17, 0x00, 0x62, 0x17, 0x00, 0x82, 0x17, 0x00, 0xA0, 0x17, 0x00, 0x84, 0x14, 0x00,
+    0xC8, 0x17, 0x00, 0xCC, 0x17, 0x00, 0xE6, 0x0A, 0x00, 0xD4, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x1C,
+    0x18, 0x00, 0x5E, 0x18, 0x00, 0x8A, 0x18, 0x00, 0xA2, 0x18, 0x00, 0xA8, 0x18, 0x00, 0xD0, 0x18,
+    0x00, 0x0E, 0x19, 0x00, 0x74, 0x0A, 0x00, 0x34, 0x19, 0x00, 0x32, 0x0D, 0x00, 0x44, 0x19, 0x00,
+    0xE6, 0x0A, 0x00, 0x4A, 0x19, 0x00, 0x04, 0x00, 0x61, 0x65, 0x6F, 0x75, 0x58, 0x19, 0x00, 0x68,
+    0x19, 0x00, 0x78, 0x19, 0x00, 0x7E, 0x19, 0x00, 0x0F, 0x00, 0x61, 0x62, 0x65, 0x66, 0x68, 0x69,
+    0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x77, 0x84, 0x19, 0x00, 0x74, 0x0A, 0x00, 0x9A,
+    0x19, 0x00, 0x84, 0x14, 0x00, 0x9C, 0x0C, 0x00, 0xBC, 0x19, 0x00, 0x9C, 0x0C, 0x00, 0xDC, 0x19,
+    0x00, 0x74, 0x0A, 0x00, 0xE8, 0x19, 0x00, 0xF2, 0x19, 0x00, 0x04, 0x1A, 0x00, 0x0A, 0x1A, 0x00,
+    0x26, 0x0E, 0x00, 0x74, 0x0A, 0x00, 0x17, 0x00, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x1E,
+    0x1A, 0x00, 0x4C, 0x1A, 0x00, 0x54, 0x1A, 0x00, 0x64, 0x1A, 0x00, 0x74, 0x1A, 0x00, 0xA6, 0x1A,
+    0x00, 0xAE, 0x1A, 0x00, 0x30, 0x14, 0x00, 0xBE, 0x1A, 0x00, 0xE6, 0x0A, 0x00, 0x00, 0x1B, 0x00,
+    0x06, 0x1B, 0x00, 0x1E, 0x1B, 0x00, 0x2E, 0x1B, 0x00, 0x32, 0x1B, 0x00, 0x70, 0x1B, 0x00, 0x3C,
+    0x0C, 0x00, 0x88, 0x1B, 0x00, 0x98, 0x1B, 0x00, 0xB4, 0x1B, 0x00, 0xE6, 0x1B, 0x00, 0xEC, 0x1B,
+    0x00, 0xF0, 0x1B, 0x00, 0x12, 0x00, 0x61, 0x62, 0x63, 0x65, 0x66, 0x68, 0x69, 0x6B, 0x6C, 0x6D,
+    0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0x0C, 0x1C, 0x00, 0x3C, 0x1C, 0x00, 0x32, 0x0D,
+    0x00, 0x48, 0x1C, 0x00, 0x3C, 0x0C, 0x00, 0x72, 0x0C, 0x00, 0x76, 0x1C, 0x00, 0xE6, 0x0A, 0x00,
+    0x3C, 0x0C, 0x00, 0xA0, 0x1C, 0x00, 0xA8, 0x1C, 0x00, 0xB8, 0x1C, 0x00, 0xF4, 0x1C, 0x00, 0x76,
+    0x0C, 0x00, 0x14, 0x1D, 0x00, 0xE6, 0x0A, 0x00, 0x20, 0x1D, 0x00, 0xE6, 0x0A, 0x00, 0x19, 0x00,
+    0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+    0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A, 0x3C, 0x1D, 0x00, 0xCA, 0x0F, 0x00, 0x70,
+    0x1D, 0x00, 0x8E, 0x1D, 0x00, 0xA8, 0x1D, 0x00, 0xEE, 0x1D, 0x00, 0xF6, 0x1D, 0x00, 0x1C, 0x1E,
+    0x00, 0x28, 0x1E, 0x00, 0x74, 0x0A, 0x00, 0x5A, 0x1E, 0x00, 0x6E, 0x1E, 0x00, 0x76, 0x1E, 0x00,
+    0x7E, 0x1E, 0x00, 0x8A, 0x1E, 0x00, 0xCC, 0x1E, 0x00, 0x74, 0x0A, 0x00, 0xD8, 0x1E, 0x00, 0xE0,
+    0x1E, 0x00, 0x08, 0x1F, 0x00, 0x24, 0x1F, 0x00, 0x66, 0x0F, 0x00, 0x4A, 0x1F, 0x00, 0x4E, 0x1F,
+    0x00, 0x58, 0x1F, 0x00, 0x19, 0x00, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A,
+    0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x60,
+    0x1F, 0x00, 0x78, 0x1F, 0x00, 0x92, 0x1F, 0x00, 0xB4, 0x1F, 0x00, 0xCA, 0x1F, 0x00, 0xE0, 0x1F,
+    0x00, 0xE6, 0x1F, 0x00, 0x08, 0x20, 0x00, 0x10, 0x20, 0x00, 0x26, 0x0E, 0x00, 0x34, 0x20, 0x00,
+    0x40, 0x20, 0x00, 0x72, 0x20, 0x00, 0x90, 0x20, 0x00, 0xC4, 0x20, 0x00, 0xDC, 0x20, 0x00, 0x74,
+    0x0A, 0x00, 0xFE, 0x20, 0x00, 0x34, 0x21, 0x00, 0x52, 0x21, 0x00, 0x68, 0x21, 0x00, 0x84, 0x21,
+    0x00, 0x92, 0x21, 0x00, 0xA8, 0x21, 0x00, 0xAE, 0x21, 0x00, 0x13, 0x00, 0x61, 0x62, 0x64, 0x65,
+    0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0xB4,
+    0x21, 0x00, 0x3C, 0x0C, 0x00, 0x9C, 0x0C, 0x00, 0xE4, 0x21, 0x00, 0xE6, 0x0A, 0x00, 0xE6, 0x0A,
+    0x00, 0x12, 0x22, 0x00, 0x3C, 0x22, 0x00, 0x62, 0x22, 0x00, 0x66, 0x22, 0x00, 0x3C, 0x0C, 0x00,
+    0x30, 0x14, 0x00, 0x7A, 0x22, 0x00, 0xAC, 0x22, 0x00, 0xBC, 0x22, 0x00, 0xD0, 0x22, 0x00, 0xE0,
+    0x22, 0x00, 0x04, 0x23, 0x00, 0x84, 0x14, 0x00, 0x01, 0x00, 0x75, 0x2A, 0x23, 0x00, 0x18, 0x00,
+    0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+    0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A, 0x3A, 0x23, 0x00, 0x7C, 0x23, 0x00, 0x8C, 0x23,
+    0x00, 0xA0, 0x23, 0x00, 0xAA, 0x23, 0x00, 0xF4, 0x23, 0x00, 0x00, 0x24, 0x00, 0x18, 0x24, 0x00,
+    0x24, 0x24, 0x00, 0x84, 0x14, 0x00, 0x62, 0x24, 0x00, 0x7C, 0x24, 0x00, 0x8C, 0x24, 0x00, 0xA0,
+    0x24, 0x00, 0xB6, 0x24, 0x00, 0xF4, 0x24, 0x00, 0x0C, 0x25, 0x00, 0x20, 0x25, 0x00, 0x44, 0x25,
+    0x00, 0x5E, 0x25, 0x00, 0x80, 0x25, 0x00, 0x74, 0x0A, 0x00, 0x8E, 0x25, 0x00, 0x9C, 0x25, 0x00,
+    0x17, 0x00, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0xA2, 0x25, 0x00, 0x32, 0x0D, 0x00, 0xCE,
+    0x25, 0x00, 0x32, 0x0D, 0x00, 0xF4, 0x25, 0x00, 0x76, 0x0C, 0x00, 0x30, 0x14, 0x00, 0x36, 0x26,
+    0x00, 0x4E, 0x26, 0x00, 0x84, 0x26, 0x00, 0x94, 0x26, 0x00, 0xA8, 0x26, 0x00, 0x4A, 0x1F, 0x00,
+    0xBC, 0x26, 0x00, 0xE4, 0x26, 0x00, 0xFE, 0x26, 0x00, 0x74, 0x0A, 0x00, 0x04, 0x27, 0x00, 0x34,
+    0x27, 0x00, 0x6A, 0x27, 0x00, 0xE6, 0x0A, 0x00, 0x92, 0x27, 0x00, 0x9E, 0x27, 0x00, 0x16, 0x00,
+    0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73,
+    0x74, 0x75, 0x76, 0x77, 0x79, 0x7A, 0xB6, 0x27, 0x00, 0xEC, 0x1B, 0x00, 0x02, 0x28, 0x00, 0x3C,
+    0x0C, 0x00, 0x0E, 0x28, 0x00, 0xEC, 0x1B, 0x00, 0x3C, 0x0C, 0x00, 0x54, 0x28, 0x00, 0x76, 0x28,
+    0x00, 0xBC, 0x28, 0x00, 0xD0, 0x28, 0x00, 0x2E, 0x1B, 0x00, 0xD8, 0x28, 0x00, 0x3C, 0x0C, 0x00,
+    0x14, 0x29, 0x00, 0x2A, 0x29, 0x00, 0x3A, 0x29, 0x00, 0x4E, 0x29, 0x00, 0xE6, 0x0A, 0x00, 0x7E,
+    0x29, 0x00, 0x92, 0x29, 0x00, 0xA2, 0x29, 0x00, 0x16, 0x00, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
+    0x67, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x78, 0x7A,
+    0xAA, 0x29, 0x00, 0xC8, 0x29, 0x00, 0xD6, 0x29, 0x00, 0xF0, 0x29, 0x00, 0x0A, 0x2A, 0x00, 0x18,
+    0x2A, 0x00, 0x22, 0x2A, 0x00, 0x2C, 0x2A, 0x00, 0x26, 0x0E, 0x00, 0xE6, 0x0A, 0x00, 0x44, 0x2A,
+    0x00, 0x7A, 0x2A, 0x00, 0x90, 0x2A, 0x00, 0xB2, 0x2A, 0x00, 0xC0, 0x2A, 0x00, 0xD6, 0x2A, 0x00,
+    0x10, 0x2B, 0x00, 0x38, 0x2B, 0x00, 0x52, 0x2B, 0x00, 0x66, 0x0F, 0x00, 0x5A, 0x2B, 0x00, 0x60,
+    0x2B, 0x00, 0x06, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x76, 0x79, 0x66, 0x2B, 0x00, 0x96, 0x2B, 0x00,
+    0xB8, 0x2B, 0x00, 0xEE, 0x2B, 0x00, 0x0C, 0x2C, 0x00, 0x10, 0x2C, 0x00, 0x0F, 0x00, 0x61, 0x62,
+    0x63, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x79, 0x14, 0x2C, 0x00,
+    0x74, 0x0A, 0x00, 0x84, 0x14, 0x00, 0x3E, 0x2C, 0x00, 0x5C, 0x2C, 0x00, 0x62, 0x2C, 0x00, 0x10,
+    0x2C, 0x00, 0x82, 0x2C, 0x00, 0x8C, 0x2C, 0x00, 0x92, 0x2C, 0x00, 0x26, 0x0E, 0x00, 0xA2, 0x2C,
+    0x00, 0xAC, 0x2C, 0x00, 0xE6, 0x0A, 0x00, 0x9C, 0x0C, 0x00, 0x0B, 0x00, 0x61, 0x63, 0x65, 0x68,
+    0x69, 0x6F, 0x70, 0x71, 0x74, 0x75, 0x78, 0xBE, 0x2C, 0x00, 0xD6, 0x2C, 0x00, 0xDA, 0x2C, 0x00,
+    0xEA, 0x2C, 0x00, 0xF6, 0x2C, 0x00, 0x0A, 0x2D, 0x00, 0x12, 0x2D, 0x00, 0x1E, 0x2D, 0x00, 0x26,
+    0x2D, 0x00, 0x2E, 0x2D, 0x00, 0x9C, 0x0C, 0x00, 0x11, 0x00, 0x61, 0x62, 0x63, 0x64, 0x65, 0x67,
+    0x68, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x77, 0x36, 0x2D, 0x00, 0x74, 0x0A,
+    0x00, 0x44, 0x2D, 0x00, 0x74, 0x0A, 0x00, 0x54, 0x2D, 0x00, 0x66, 0x2D, 0x00, 0x76, 0x0C, 0x00,
+    0x74, 0x0A, 0x00, 0x6C, 0x2D, 0x00, 0x7E, 0x2D, 0x00, 0x8C, 0x2D, 0x00, 0xA2, 0x2D, 0x00, 0xBA,
+    0x2D, 0x00, 0xD0, 0x2D, 0x00, 0xE2, 0x2D, 0x00, 0x00, 0x2E, 0x00, 0x74, 0x0A, 0x00, 0x09, 0x00,
+    0x61, 0x62, 0x65, 0x69, 0x6C, 0x6D, 0x6F, 0x74, 0x7A, 0x0A, 0x2E, 0x00, 0xE6, 0x0A, 0x00, 0x16,
+    0x2E, 0x00, 0x2A, 0x2E, 0x00, 0x3A, 0x2E, 0x00, 0xE6, 0x0A, 0x00, 0x3E, 0x2E, 0x00, 0xB0, 0x09,
+    0x00, 0x4E, 0x2E, 0x00, 0x0C, 0x00, 0x63, 0x64, 0x66, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x5A, 0x2E, 0x00, 0x60, 0x2E, 0x00, 0x66, 0x2E, 0x00, 0x6C, 0x2E, 0x00, 0x72, 0x2E,
+    0x00, 0x78, 0x2E, 0x00, 0x8A, 0x2E, 0x00, 0x94, 0x2E, 0x00, 0xA6, 0x2E, 0x00, 0xAC, 0x2E, 0x00,
+    0x5C, 0x2C, 0x00, 0xB2, 0x2E, 0x00, 0x04, 0x00, 0x61, 0x65, 0x72, 0x75, 0xB8, 0x2E, 0x00, 0xC6,
+    0x2E, 0x00, 0xD0, 0x2E, 0x00, 0xD6, 0x2E, 0x00, 0x05, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0xDC,
+    0x2E, 0x00, 0xF2, 0x2E, 0x00, 0xF8, 0x2E, 0x00, 0x00, 0x2F, 0x00, 0x08, 0x2F, 0x00, 0x05, 0x00,
+    0x65, 0x69, 0x6F, 0x72, 0x75, 0x16, 0x2F, 0x00, 0x28, 0x2F, 0x00, 0x2E, 0x2F, 0x00, 0x34, 0x2F,
+    0x00, 0x3A, 0x2F, 0x00, 0x0D, 0x00, 0x61, 0x62, 0x65, 0x67, 0x6C, 0x6E, 0x71, 0x72, 0x73, 0x74,
+    0x75, 0x76, 0x79, 0x44, 0x2F, 0x00, 0x4E, 0x2F, 0x00, 0x52, 0x2F, 0x00, 0x58, 0x2F, 0x00, 0x5C,
+    0x2F, 0x00, 0x66, 0x2F, 0x00, 0x74, 0x2F, 0x00, 0x7A, 0x2F, 0x00, 0x80, 0x2F, 0x00, 0x84, 0x2F,
+    0x00, 0x8A, 0x2F, 0x00, 0x92, 0x2F, 0x00, 0x9A, 0x2F, 0x00, 0x02, 0x00, 0x65, 0x6F, 0xA0, 0x2F,
+    0x00, 0xA6, 0x2F, 0x00, 0x04, 0x00, 0x61, 0x65, 0x69, 0x6F, 0xAC, 0x2F, 0x00, 0xB4, 0x2F, 0x00,
+    0xC0, 0x2F, 0x00, 0xCA, 0x2F, 0x00, 0x04, 0x00, 0x61, 0x65, 0x69, 0x6F, 0xD0, 0x2F, 0x00, 0xD6,
+    0x2F, 0x00, 0xEE, 0x2F, 0x00, 0xF8, 0x2F, 0x00, 0x05, 0x00, 0x64, 0x6D, 0x6E, 0x72, 0x73, 0x02,
+    0x30, 0x00, 0x0C, 0x30, 0x00, 0x16, 0x30, 0x00, 0x2E, 0x30, 0x00, 0x5C, 0x2C, 0x00, 0x01, 0x00,
+    0x75, 0x34, 0x30, 0x00, 0x02, 0x00, 0x69, 0x6F, 0x3A, 0x30, 0x00, 0x40, 0x30, 0x00, 0x03, 0x00,
+    0x61, 0x65, 0x69, 0x46, 0x30, 0x00, 0x54, 0x30, 0x00, 0x6C, 0x30, 0x00, 0x05, 0x00, 0x61, 0x65,
+    0x69, 0x6F, 0x75, 0x7E, 0x30, 0x00, 0x90, 0x30, 0x00, 0xA0, 0x30, 0x00, 0xAA, 0x30, 0x00, 0xB4,
+    0x30, 0x00, 0x03, 0x00, 0x65, 0x69, 0x6F, 0xBA, 0x30, 0x00, 0xC0, 0x30, 0x00, 0xC6, 0x30, 0x00,
+    0x06, 0x00, 0x64, 0x66, 0x72, 0x73, 0x74, 0x75, 0xD0, 0x30, 0x00, 0xD8, 0x30, 0x00, 0xDE, 0x30,
+    0x00, 0xF0, 0x30, 0x00, 0xF8, 0x30, 0x00, 0xFE, 0x30, 0x00, 0x04, 0x00, 0x65, 0x69, 0x6F, 0x72,
+    0x04, 0x31, 0x00, 0x0E, 0x31, 0x00, 0x1C, 0x31, 0x00, 0x26, 0x31, 0x00, 0x05, 0x00, 0x61, 0x65,
+    0x69, 0x6F, 0x75, 0x2C, 0x31, 0x00, 0x3E, 0x31, 0x00, 0x4C, 0x31, 0x00, 0x56, 0x31, 0x00, 0x64,
+    0x31, 0x00, 0x07, 0x00, 0x63, 0x65, 0x68, 0x69, 0x70, 0x74, 0x79, 0x6A, 0x31, 0x00, 0x70, 0x31,
+    0x00, 0x58, 0x2F, 0x00, 0x82, 0x31, 0x00, 0x8A, 0x31, 0x00, 0x94, 0x31, 0x00, 0x58, 0x2F, 0x00,
+    0x06, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x9C, 0x31, 0x00, 0xA4, 0x31, 0x00, 0x58, 0x2F,
+    0x00, 0xB0, 0x31, 0x00, 0xC0, 0x31, 0x00, 0xD2, 0x31, 0x00, 0x04, 0x00, 0x6E, 0x70, 0x72, 0x73,
+    0xD8, 0x31, 0x00, 0x80, 0x2F, 0x00, 0xF6, 0x31, 0x00, 0xFC, 0x31, 0x00, 0x02, 0x00, 0x65, 0x69,
+    0x02, 0x32, 0x00, 0x0C, 0x32, 0x00, 0x02, 0x00, 0x65, 0x69, 0x12, 0x32, 0x00, 0x18, 0x32, 0x00,
+    0x01, 0x00, 0x65, 0x4E, 0x2F, 0x00, 0x08, 0x00, 0x2E, 0x61, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x75,
+    0xE6, 0x0A, 0x00, 0x1E, 0x32, 0x00, 0x28, 0x32, 0x00, 0x30, 0x32, 0x00, 0x3A, 0x32, 0x00, 0x40,
+    0x32, 0x00, 0x46, 0x32, 0x00, 0x4E, 0x32, 0x00, 0x07, 0x00, 0x61, 0x65, 0x68, 0x69, 0x72, 0x74,
+    0x75, 0x54, 0x32, 0x00, 0x5E, 0x32, 0x00, 0x68, 0x32, 0x00, 0x6E, 0x32, 0x00, 0x7E, 0x32, 0x00,
+    0x84, 0x32, 0x00, 0x8A, 0x32, 0x00, 0x08, 0x01, 0x2E, 0x00, 0x64, 0x65, 0x69, 0x6C, 0x6F, 0x72,
+    0x73, 0x75, 0x94, 0x32, 0x00, 0x9A, 0x32, 0x00, 0xA0, 0x32, 0x00, 0x60, 0x2B, 0x00, 0xBC, 0x32,
+    0x00, 0xC2, 0x32, 0x00, 0xC8, 0x32, 0x00, 0xCE, 0x32, 0x00, 0x01, 0x00, 0x72, 0xDA, 0x32, 0x00,
+    0x01, 0x01, 0x2E, 0x00, 0x66, 0xE2, 0x32, 0x00, 0x08, 0x00, 0x61, 0x65, 0x69, 0x6C, 0x6E, 0x6F,
+    0x75, 0x79, 0xEA, 0x32, 0x00, 0xF4, 0x32, 0x00, 0x02, 0x33, 0x00, 0x0C, 0x2C, 0x00, 0x02, 0x33,
+    0x00, 0x06, 0x33, 0x00, 0x12, 0x33, 0x00, 0x10, 0x2C, 0x00, 0x04, 0x00, 0x61, 0x65, 0x6C, 0x6F,
+    0x84, 0x14, 0x00, 0x84, 0x14, 0x00, 0x9C, 0x0C, 0x00, 0x84, 0x14, 0x00, 0x05, 0x01, 0x1E, 0x00,
+    0x61, 0x63, 0x6C, 0x6E, 0x74, 0x26, 0x0E, 0x00, 0x1C, 0x33, 0x00, 0x22, 0x33, 0x00, 0x28, 0x33,
+    0x00, 0x34, 0x33, 0x00, 0x00, 0x01, 0x12, 0x00, 0x01, 0x00, 0x65, 0x3A, 0x33, 0x00, 0x08, 0x00,
+    0x61, 0x64, 0x65, 0x69, 0x6C, 0x6D, 0x6F, 0x79, 0x40, 0x33, 0x00, 0x4E, 0x33, 0x00, 0x54, 0x33,
+    0x00, 0x60, 0x33, 0x00, 0x6C, 0x33, 0x00, 0xE6, 0x0A, 0x00, 0x76, 0x33, 0x00, 0x7C, 0x33, 0x00,
+    0x05, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x70, 0x8E, 0x33, 0x00, 0xA6, 0x33, 0x00, 0xB0, 0x33, 0x00,
+    0xC2, 0x33, 0x00, 0x34, 0x33, 0x00, 0x0B, 0x01, 0x2E, 0x00, 0x61, 0x64, 0x65, 0x67, 0x69, 0x6B,
+    0x6E, 0x6F, 0x73, 0x74, 0x75, 0xCE, 0x33, 0x00, 0xE0, 0x33, 0x00, 0xF4, 0x33, 0x00, 0x06, 0x34,
+    0x00, 0x12, 0x34, 0x00, 0x3C, 0x34, 0x00, 0x42, 0x34, 0x00, 0x48, 0x34, 0x00, 0x54, 0x34, 0x00,
+    0x76, 0x34, 0x00, 0x8C, 0x34, 0x00, 0x00, 0x01, 0x0C, 0x00, 0x08, 0x00, 0x61, 0x65, 0x68, 0x69,
+    0x6C, 0x6F, 0x73, 0x75, 0x9A, 0x34, 0x00, 0xA4, 0x34, 0x00, 0xAE, 0x34, 0x00, 0xB8, 0x34, 0x00,
+    0xC6, 0x34, 0x00, 0xCA, 0x34, 0x00, 0xDC, 0x34, 0x00, 0x84, 0x14, 0x00, 0x01, 0x00, 0x75, 0x9A,
+    0x2F, 0x00, 0x0D, 0x02, 0x2B, 0x01, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x69, 0x6D, 0x6F, 0x70,
+    0x71, 0x72, 0x73, 0xE2, 0x34, 0x00, 0x0C, 0x35, 0x00, 0x12, 0x35, 0x00, 0x18, 0x35, 0x00, 0x22,
+    0x35, 0x00, 0x34, 0x35, 0x00, 0x3E, 0x35, 0x00, 0x5A, 0x35, 0x00, 0x60, 0x35, 0x00, 0x6E, 0x35,
+    0x00, 0x72, 0x35, 0x00, 0x76, 0x35, 0x00, 0x80, 0x35, 0x00, 0x0C, 0x00, 0x2E, 0x61, 0x68, 0x69,
+    0x6B, 0x6C, 0x6F, 0x70, 0x73, 0x74, 0x75, 0x79, 0xE6, 0x0A, 0x00, 0x8A, 0x35, 0x00, 0x94, 0x35,
+    0x00, 0x9A, 0x35, 0x00, 0xAC, 0x35, 0x00, 0x9C, 0x0C, 0x00, 0xB2, 0x35, 0x00, 0xB8, 0x35, 0x00,
+    0xBE, 0x35, 0x00, 0xC4, 0x35, 0x00, 0xCE, 0x35, 0x00, 0xD4, 0x35, 0x00, 0x0A, 0x00, 0x61, 0x65,
+    0x68, 0x69, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x79, 0xDA, 0x35, 0x00, 0xEE, 0x35, 0x00, 0x08, 0x36,
+    0x00, 0x14, 0x36, 0x00, 0x32, 0x36, 0x00, 0x44, 0x36, 0x00, 0x4C, 0x36, 0x00, 0x52, 0x36, 0x00,
+    0x60, 0x36, 0x00, 0xC6, 0x34, 0x00, 0x07, 0x00, 0x62, 0x67, 0x6C, 0x6E, 0x72, 0x73, 0x74, 0x9C,
+    0x0C, 0x00, 0x74, 0x36, 0x00, 0x7E, 0x36, 0x00, 0x86, 0x36, 0x00, 0x72, 0x35, 0x00, 0x8C, 0x36,
+    0x00, 0x92, 0x36, 0x00, 0x04, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x9C, 0x36, 0x00, 0xA8, 0x36, 0x00,
+    0xB2, 0x36, 0x00, 0xC2, 0x36, 0x00, 0x04, 0x00, 0x61, 0x69, 0x6C, 0x73, 0xCC, 0x36, 0x00, 0x72,
+    0x35, 0x00, 0xD2, 0x36, 0x00, 0x4E, 0x2F, 0x00, 0x01, 0x00, 0x69, 0xD8, 0x36, 0x00, 0x03, 0x00,
+    0x61, 0x65, 0x73, 0xE2, 0x36, 0x00, 0x4E, 0x2F, 0x00, 0x4E, 0x2F, 0x00, 0x02, 0x00, 0x69, 0x7A,
+    0xE8, 0x36, 0x00, 0xEE, 0x36, 0x00, 0x0A, 0x00, 0x2E, 0x63, 0x64, 0x67, 0x6C, 0x6E, 0x72, 0x73,
+    0x74, 0x7A, 0x3A, 0x2E, 0x00, 0xF4, 0x36, 0x00, 0xFA, 0x36, 0x00, 0x60, 0x2B, 0x00, 0x00, 0x37,
+    0x00, 0x06, 0x37, 0x00, 0x14, 0x37, 0x00, 0x22, 0x37, 0x00, 0x28, 0x37, 0x00, 0x9C, 0x0C, 0x00,
+    0x02, 0x02, 0x0E, 0x00, 0x65, 0x69, 0x30, 0x37, 0x00, 0x38, 0x37, 0x00, 0x00, 0x02, 0x6E, 0x00,
+    0x0C, 0x00, 0x2E, 0x61, 0x64, 0x67, 0x6C, 0x6D, 0x6E, 0x73, 0x74, 0x76, 0x77, 0x79, 0xE6, 0x0A,
+    0x00, 0x42, 0x37, 0x00, 0x4C, 0x37, 0x00, 0x5C, 0x37, 0x00, 0x66, 0x37, 0x00, 0x72, 0x37, 0x00,
+    0x76, 0x37, 0x00, 0x80, 0x37, 0x00, 0x8C, 0x37, 0x00, 0x9C, 0x37, 0x00, 0x72, 0x35, 0x00, 0xA2,
+    0x37, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x02, 0x28, 0x00, 0x08, 0x00, 0x62, 0x64, 0x65, 0x66,
+    0x6C, 0x6E, 0x6F, 0x74, 0x6E, 0x35, 0x00, 0xA8, 0x37, 0x00, 0xB0, 0x37, 0x00, 0x30, 0x14, 0x00,
+    0xBC, 0x37, 0x00, 0xC8, 0x37, 0x00, 0xD6, 0x37, 0x00, 0xE8, 0x37, 0x00, 0x00, 0x01, 0x0B, 0x00,
+    0x05, 0x02, 0x96, 0x02, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xFC, 0x37, 0x00, 0x06, 0x38, 0x00, 0x14,
+    0x38, 0x00, 0x1E, 0x38, 0x00, 0x26, 0x38, 0x00, 0x01, 0x02, 0x28, 0x00, 0x65, 0x2C, 0x38, 0x00,
+    0x0A, 0x00, 0x64, 0x65, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x32, 0x38, 0x00, 0x9C,
+    0x0C, 0x00, 0x3A, 0x38, 0x00, 0x40, 0x38, 0x00, 0x46, 0x38, 0x00, 0x4C, 0x38, 0x00, 0x50, 0x38,
+    0x00, 0x6A, 0x38, 0x00, 0x6E, 0x38, 0x00, 0x80, 0x38, 0x00, 0x03, 0x00, 0x69, 0x6F, 0x75, 0x86,
+    0x38, 0x00, 0x8C, 0x38, 0x00, 0x92, 0x38, 0x00, 0x01, 0x03, 0x8E, 0x02, 0x6F, 0x52, 0x2F, 0x00,
+    0x03, 0x01, 0x11, 0x00, 0x6C, 0x6F, 0x72, 0x9C, 0x0C, 0x00, 0x10, 0x2C, 0x00, 0x84, 0x14, 0x00,
+    0x08, 0x00, 0x66, 0x67, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x98, 0x38, 0x00, 0x9E, 0x38, 0x00,
+    0xA4, 0x38, 0x00, 0x94, 0x35, 0x00, 0xAA, 0x38, 0x00, 0xB2, 0x38, 0x00, 0xB8, 0x38, 0x00, 0xC6,
+    0x38, 0x00, 0x00, 0x02, 0x01, 0x01, 0x02, 0x00, 0x2E, 0x73, 0x3A, 0x2E, 0x00, 0x4E, 0x2F, 0x00,
+    0x0C, 0x01, 0x07, 0x00, 0x62, 0x63, 0x64, 0x67, 0x68, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x76,
+    0xDC, 0x38, 0x00, 0x5A, 0x2E, 0x00, 0xE6, 0x38, 0x00, 0xEC, 0x38, 0x00, 0xF0, 0x38, 0x00, 0xF4,
+    0x38, 0x00, 0x02, 0x39, 0x00, 0x18, 0x39, 0x00, 0x1E, 0x39, 0x00, 0x24, 0x39, 0x00, 0x2E, 0x39,
+    0x00, 0x3C, 0x39, 0x00, 0x03, 0x01, 0x10, 0x00, 0x68, 0x69, 0x6F, 0x42, 0x39, 0x00, 0x48, 0x39,
+    0x00, 0x4E, 0x39, 0x00, 0x0A, 0x00, 0x2E, 0x64, 0x69, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x77,
+    0x72, 0x0C, 0x00, 0x5C, 0x39, 0x00, 0x4C, 0x38, 0x00, 0x66, 0x39, 0x00, 0x70, 0x39, 0x00, 0x4C,
+    0x38, 0x00, 0x84, 0x39, 0x00, 0x8A, 0x39, 0x00, 0x98, 0x39, 0x00, 0x4E, 0x2F, 0x00, 0x07, 0x01,
+    0x11, 0x00, 0x2E, 0x61, 0x65, 0x69, 0x6F, 0x73, 0x74, 0xE6, 0x0A, 0x00, 0xA0, 0x39, 0x00, 0xAA,
+    0x39, 0x00, 0xC6, 0x39, 0x00, 0xDC, 0x39, 0x00, 0xE0, 0x39, 0x00, 0xEA, 0x39, 0x00, 0x0E, 0x01,
+    0x07, 0x00, 0x61, 0x63, 0x65, 0x66, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x73, 0x74, 0x7A,
+    0xF0, 0x39, 0x00, 0xFC, 0x39, 0x00, 0x00, 0x3A, 0x00, 0x06, 0x3A, 0x00, 0x0C, 0x3A, 0x00, 0xE6,
+    0x0A, 0x00, 0x12, 0x3A, 0x00, 0x72, 0x0C, 0x00, 0x1C, 0x3A, 0x00, 0xB2, 0x2E, 0x00, 0x34, 0x3A,
+    0x00, 0x42, 0x3A, 0x00, 0x48, 0x3A, 0x00, 0x3A, 0x2E, 0x00, 0x01, 0x01, 0x14, 0x00, 0x69, 0x72,
+    0x35, 0x00, 0x04, 0x03, 0x84, 0x02, 0x61, 0x65, 0x69, 0x79, 0x50, 0x3A, 0x00, 0x56, 0x3A, 0x00,
+    0x60, 0x3A, 0x00, 0x4E, 0x2F, 0x00, 0x00, 0x01, 0x1D, 0x00, 0x0E, 0x01, 0x07, 0x00, 0x61, 0x65,
+    0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x75, 0x76, 0x77, 0x7A, 0x6A, 0x3A, 0x00, 0x58,
+    0x2F, 0x00, 0x70, 0x3A, 0x00, 0x78, 0x3A, 0x00, 0x80, 0x3A, 0x00, 0x8A, 0x3A, 0x00, 0x90, 0x3A,
+    0x00, 0xA2, 0x3A, 0x00, 0xB4, 0x3A, 0x00, 0xB0, 0x09, 0x00, 0xBE, 0x3A, 0x00, 0xC4, 0x3A, 0x00,
+    0xFC, 0x31, 0x00, 0xCC, 0x3A, 0x00, 0x05, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xD6, 0x3A, 0x00,
+    0xE0, 0x3A, 0x00, 0xF2, 0x3A, 0x00, 0x06, 0x3B, 0x00, 0x64, 0x31, 0x00, 0x00, 0x03, 0x76, 0x00,
+    0x06, 0x02, 0x0E, 0x00, 0x61, 0x65, 0x69, 0x72, 0x75, 0x77, 0x18, 0x3B, 0x00, 0x30, 0x37, 0x00,
+    0x22, 0x3B, 0x00, 0x2C, 0x3B, 0x00, 0xCA, 0x2F, 0x00, 0x10, 0x2C, 0x00, 0x0A, 0x00, 0x64, 0x66,
+    0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x32, 0x3B, 0x00, 0x10, 0x2C, 0x00, 0x36, 0x3B,
+    0x00, 0x3E, 0x3B, 0x00, 0x48, 0x3B, 0x00, 0x4C, 0x38, 0x00, 0x56, 0x3B, 0x00, 0x60, 0x3B, 0x00,
+    0x6A, 0x3B, 0x00, 0x72, 0x3B, 0x00, 0x00, 0x01, 0x07, 0x00, 0x0C, 0x02, 0xCE, 0x00, 0x2E, 0x62,
+    0x63, 0x66, 0x67, 0x6C, 0x6D, 0x6E, 0x72, 0x74, 0x76, 0x79, 0x3A, 0x2E, 0x00, 0x7E, 0x3B, 0x00,
+    0x5A, 0x2E, 0x00, 0xE6, 0x0A, 0x00, 0x72, 0x0C, 0x00, 0x82, 0x3B, 0x00, 0x88, 0x3B, 0x00, 0x8C,
+    0x3B, 0x00, 0x92, 0x3B, 0x00, 0xA0, 0x3B, 0x00, 0xB0, 0x3B, 0x00, 0x3A, 0x2E, 0x00, 0x02, 0x02,
+    0x20, 0x00, 0x61, 0x69, 0xB8, 0x3B, 0x00, 0xBE, 0x3B, 0x00, 0x12, 0x00, 0x2E, 0x61, 0x62, 0x63,
+    0x64, 0x65, 0x66, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x79, 0x72, 0x0C,
+    0x00, 0xC4, 0x3B, 0x00, 0xCE, 0x3B, 0x00, 0xD8, 0x3B, 0x00, 0xEC, 0x1B, 0x00, 0xEA, 0x3B, 0x00,
+    0xF0, 0x3B, 0x00, 0xF6, 0x3B, 0x00, 0xFC, 0x3B, 0x00, 0x06, 0x3C, 0x00, 0x16, 0x3C, 0x00, 0x2A,
+    0x3C, 0x00, 0x84, 0x14, 0x00, 0x3A, 0x3C, 0x00, 0x4C, 0x3C, 0x00, 0x68, 0x3C, 0x00, 0x74, 0x3C,
+    0x00, 0xE6, 0x0A, 0x00, 0x04, 0x00, 0x61, 0x65, 0x69, 0x79, 0x10, 0x2C, 0x00, 0x7C, 0x3C, 0x00,
+    0x02, 0x33, 0x00, 0xC6, 0x34, 0x00, 0x00, 0x02, 0x32, 0x00, 0x10, 0x00, 0x2E, 0x61, 0x63, 0x64,
+    0x65, 0x66, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x76, 0x3A, 0x2E, 0x00, 0x82,
+    0x3C, 0x00, 0x8A, 0x3C, 0x00, 0x4C, 0x38, 0x00, 0x98, 0x3C, 0x00, 0x9E, 0x3C, 0x00, 0xB2, 0x38,
+    0x00, 0xA6, 0x3C, 0x00, 0xAC, 0x3C, 0x00, 0xB2, 0x3C, 0x00, 0xC2, 0x3C, 0x00, 0xCA, 0x3C, 0x00,
+    0xD0, 0x3C, 0x00, 0xDC, 0x3C, 0x00, 0xE8, 0x3C, 0x00, 0xEE, 0x3C, 0x00, 0x00, 0x02, 0x16, 0x00,
+    0x06, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x75, 0x79, 0x32, 0x0D, 0x00, 0xF2, 0x3C, 0x00, 0x04, 0x3D,
+    0x00, 0x30, 0x14, 0x00, 0x32, 0x0D, 0x00, 0x72, 0x0C, 0x00, 0x00, 0x03, 0xAF, 0x01, 0x10, 0x01,
+    0x07, 0x00, 0x2E, 0x64, 0x65, 0x66, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x75, 0x76,
+    0x77, 0x78, 0x4C, 0x38, 0x00, 0x0A, 0x3D, 0x00, 0x3A, 0x2E, 0x00, 0xF0, 0x38, 0x00, 0x10, 0x2C,
+    0x00, 0x10, 0x3D, 0x00, 0x1E, 0x3D, 0x00, 0x24, 0x3D, 0x00, 0x2E, 0x3D, 0x00, 0x34, 0x3D, 0x00,
+    0x10, 0x2C, 0x00, 0x4C, 0x38, 0x00, 0x3A, 0x3D, 0x00, 0x9C, 0x0C, 0x00, 0x40, 0x3D, 0x00, 0x4C,
+    0x38, 0x00, 0x06, 0x01, 0x07, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x75, 0x79, 0x46, 0x3D, 0x00, 0x50,
+    0x3D, 0x00, 0x5C, 0x3D, 0x00, 0x6E, 0x3D, 0x00, 0x7C, 0x3D, 0x00, 0xE6, 0x0A, 0x00, 0x03, 0x03,
+    0x8E, 0x00, 0x70, 0x77, 0x79, 0x9C, 0x0C, 0x00, 0x10, 0x2C, 0x00, 0x10, 0x2C, 0x00, 0x02, 0x00,
+    0x61, 0x68, 0x82, 0x3D, 0x00, 0xC6, 0x34, 0x00, 0x09, 0x01, 0x07, 0x00, 0x61, 0x63, 0x65, 0x67,
+    0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x88, 0x3D, 0x00, 0x90, 0x3D, 0x00, 0xE2, 0x36, 0x00, 0x9C, 0x0C,
+    0x00, 0xA0, 0x3D, 0x00, 0xA6, 0x3D, 0x00, 0x9C, 0x0C, 0x00, 0xAC, 0x3D, 0x00, 0xA2, 0x29, 0x00,
+    0x02, 0x01, 0x2E, 0x00, 0x6E, 0x73, 0x3A, 0x2E, 0x00, 0xB2, 0x3D, 0x00, 0x0B, 0x00, 0x62, 0x63,
+    0x64, 0x67, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x76, 0x4A, 0x1F, 0x00, 0xBC, 0x3D, 0x00, 0xC2,
+    0x3D, 0x00, 0xCA, 0x3D, 0x00, 0xD0, 0x3D, 0x00, 0xDC, 0x3D, 0x00, 0xE2, 0x3D, 0x00, 0xEC, 0x3D,
+    0x00, 0x06, 0x3E, 0x00, 0x14, 0x3E, 0x00, 0x28, 0x3E, 0x00, 0x03, 0x02, 0x0E, 0x00, 0x65, 0x69,
+    0x72, 0x38, 0x3E, 0x00, 0x42, 0x3E, 0x00, 0x84, 0x14, 0x00, 0x0A, 0x00, 0x61, 0x63, 0x65, 0x68,
+    0x69, 0x6C, 0x6F, 0x72, 0x74, 0x75, 0x48, 0x3E, 0x00, 0x42, 0x39, 0x00, 0x52, 0x3E, 0x00, 0x5A,
+    0x3E, 0x00, 0x60, 0x3E, 0x00, 0x74, 0x3E, 0x00, 0x7E, 0x3E, 0x00, 0x90, 0x3E, 0x00, 0x98, 0x3E,
+    0x00, 0xA2, 0x3E, 0x00, 0x08, 0x00, 0x61, 0x64, 0x65, 0x67, 0x69, 0x6F, 0x72, 0x75, 0xAA, 0x3E,
+    0x00, 0xAE, 0x3E, 0x00, 0xB2, 0x3E, 0x00, 0xBC, 0x3E, 0x00, 0xC2, 0x3E, 0x00, 0xDE, 0x3E, 0x00,
+    0xEA, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0x0A, 0x00, 0x63, 0x64, 0x66, 0x6C, 0x6D, 0x6E, 0x70, 0x73,
+    0x74, 0x78, 0x6E, 0x35, 0x00, 0xAC, 0x35, 0x00, 0x6E, 0x35, 0x00, 0xF6, 0x3E, 0x00, 0x6E, 0x35,
+    0x00, 0x9E, 0x38, 0x00, 0x00, 0x3F, 0x00, 0x04, 0x3F, 0x00, 0xD2, 0x36, 0x00, 0x26, 0x0E, 0x00,
+    0x05, 0x01, 0x12, 0x00, 0x65, 0x66, 0x69, 0x6F, 0x75, 0x0C, 0x3F, 0x00, 0xC6, 0x0E, 0x00, 0x12,
+    0x3F, 0x00, 0x24, 0x3F, 0x00, 0x2A, 0x3F, 0x00, 0x07, 0x00, 0x61, 0x65, 0x69, 0x6E, 0x6F, 0x75,
+    0x79, 0x30, 0x3F, 0x00, 0x52, 0x2F, 0x00, 0x36, 0x3F, 0x00, 0xFC, 0x39, 0x00, 0x48, 0x3F, 0x00,
+    0x52, 0x3F, 0x00, 0x3A, 0x2E, 0x00, 0x01, 0x02, 0x20, 0x00, 0x65, 0x52, 0x2F, 0x00, 0x07, 0x01,
+    0x1E, 0x00, 0x63, 0x64, 0x67, 0x6D, 0x6E, 0x72, 0x74, 0x26, 0x0E, 0x00, 0xFC, 0x39, 0x00, 0x5C,
+    0x3F, 0x00, 0x82, 0x3D, 0x00, 0x64, 0x3F, 0x00, 0x64, 0x31, 0x00, 0x72, 0x3F, 0x00, 0x01, 0x01,
+    0x12, 0x00, 0x75, 0x80, 0x3F, 0x00, 0x02, 0x00, 0x69, 0x6C, 0x86, 0x3F, 0x00, 0x9E, 0x38, 0x00,
+    0x09, 0x00, 0x61, 0x65, 0x66, 0x69, 0x6C, 0x6F, 0x73, 0x74, 0x75, 0x8C, 0x3F, 0x00, 0xA8, 0x3F,
+    0x00, 0x6E, 0x35, 0x00, 0xCA, 0x3F, 0x00, 0xF6, 0x3F, 0x00, 0x00, 0x40, 0x00, 0x12, 0x40, 0x00,
+    0x9E, 0x38, 0x00, 0x18, 0x40, 0x00, 0x09, 0x00, 0x61, 0x62, 0x65, 0x69, 0x6E, 0x6F, 0x70, 0x75,
+    0x79, 0x22, 0x40, 0x00, 0xFC, 0x39, 0x00, 0x30, 0x40, 0x00, 0x3C, 0x40, 0x00, 0x42, 0x34, 0x00,
+    0x56, 0x40, 0x00, 0xA4, 0x38, 0x00, 0x60, 0x40, 0x00, 0x84, 0x14, 0x00, 0x0C, 0x00, 0x61, 0x63,
+    0x64, 0x65, 0x69, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0x79, 0x7A, 0x6A, 0x40, 0x00, 0x74, 0x40, 0x00,
+    0x7A, 0x40, 0x00, 0x80, 0x40, 0x00, 0x9E, 0x40, 0x00, 0xE6, 0x0A, 0x00, 0xC0, 0x40, 0x00, 0xD0,
+    0x40, 0x00, 0xD6, 0x40, 0x00, 0xE0, 0x40, 0x00, 0x1C, 0x33, 0x00, 0xAE, 0x3E, 0x00, 0x0A, 0x00,
+    0x66, 0x67, 0x69, 0x6C, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0x26, 0x0E, 0x00, 0xEA, 0x40, 0x00,
+    0xF2, 0x40, 0x00, 0x84, 0x14, 0x00, 0xF6, 0x40, 0x00, 0xFC, 0x40, 0x00, 0x4E, 0x2F, 0x00, 0x08,
+    0x41, 0x00, 0x10, 0x41, 0x00, 0x26, 0x0E, 0x00, 0x0A, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6F,
+    0x72, 0x73, 0x74, 0x75, 0x16, 0x41, 0x00, 0x22, 0x41, 0x00, 0x30, 0x41, 0x00, 0x36, 0x41, 0x00,
+    0xEA, 0x3E, 0x00, 0x74, 0x0A, 0x00, 0x3C, 0x41, 0x00, 0xBE, 0x35, 0x00, 0x46, 0x41, 0x00, 0x4C,
+    0x41, 0x00, 0x01, 0x01, 0x12, 0x00, 0x75, 0x52, 0x41, 0x00, 0x0D, 0x00, 0x61, 0x62, 0x63, 0x65,
+    0x68, 0x69, 0x6D, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0x77, 0x58, 0x41, 0x00, 0x6C, 0x41, 0x00, 0x74,
+    0x41, 0x00, 0x7A, 0x41, 0x00, 0x02, 0x33, 0x00, 0xA4, 0x41, 0x00, 0xC8, 0x41, 0x00, 0xCC, 0x41,
+    0x00, 0xD6, 0x41, 0x00, 0xEA, 0x41, 0x00, 0xF2, 0x41, 0x00, 0x00, 0x42, 0x00, 0x08, 0x42, 0x00,
+    0x0D, 0x00, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6B, 0x6D, 0x6F, 0x70, 0x73, 0x74, 0x75, 0x77, 0x0E,
+    0x42, 0x00, 0x16, 0x42, 0x00, 0x26, 0x42, 0x00, 0x36, 0x42, 0x00, 0x42, 0x42, 0x00, 0x62, 0x42,
+    0x00, 0xEA, 0x39, 0x00, 0x68, 0x42, 0x00, 0x72, 0x42, 0x00, 0x86, 0x42, 0x00, 0x8E, 0x42, 0x00,
+    0xA0, 0x42, 0x00, 0x9C, 0x0C, 0x00, 0x0A, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6E, 0x6F, 0x72, 0x75,
+    0x79, 0x7A, 0xA6, 0x42, 0x00, 0xAC, 0x42, 0x00, 0xB6, 0x42, 0x00, 0xC0, 0x42, 0x00, 0xE6, 0x0A,
+    0x00, 0xD6, 0x42, 0x00, 0xDC, 0x42, 0x00, 0xEE, 0x42, 0x00, 0xF4, 0x42, 0x00, 0xFC, 0x39, 0x00,
+    0x06, 0x01, 0x0C, 0x00, 0x63, 0x6E, 0x70, 0x72, 0x73, 0x74, 0xFA, 0x42, 0x00, 0x26, 0x0E, 0x00,
+    0x84, 0x14, 0x00, 0x00, 0x43, 0x00, 0x4E, 0x2F, 0x00, 0x06, 0x43, 0x00, 0x05, 0x00, 0x61, 0x65,
+    0x69, 0x6F, 0x75, 0x14, 0x43, 0x00, 0x1E, 0x43, 0x00, 0x30, 0x43, 0x00, 0x44, 0x43, 0x00, 0x26,
+    0x0E, 0x00, 0x04, 0x00, 0x61, 0x65, 0x68, 0x69, 0x4A, 0x43, 0x00, 0x52, 0x43, 0x00, 0x84, 0x14,
+    0x00, 0x58, 0x43, 0x00, 0x01, 0x00, 0x70, 0xC6, 0x0E, 0x00, 0x03, 0x00, 0x63, 0x65, 0x73, 0x3A,
+    0x2E, 0x00, 0x66, 0x43, 0x00, 0x4E, 0x2F, 0x00, 0x09, 0x01, 0x07, 0x00, 0x62, 0x63, 0x67, 0x69,
+    0x6C, 0x6D, 0x72, 0x74, 0x75, 0x6C, 0x43, 0x00, 0x60, 0x2B, 0x00, 0xE6, 0x0A, 0x00, 0xB2, 0x2E,
+    0x00, 0x76, 0x43, 0x00, 0x7C, 0x43, 0x00, 0x86, 0x43, 0x00, 0x8E, 0x43, 0x00, 0x9C, 0x43, 0x00,
+    0x0A, 0x00, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x6C, 0x6D, 0x6E, 0x72, 0x76, 0xE6, 0x0A, 0x00, 0xA2,
+    0x43, 0x00, 0xAC, 0x43, 0x00, 0xB4, 0x43, 0x00, 0x72, 0x0C, 0x00, 0xA4, 0x38, 0x00, 0x44, 0x19,
+    0x00, 0xBE, 0x43, 0x00, 0xC4, 0x43, 0x00, 0x4E, 0x2F, 0x00, 0x04, 0x02, 0x6E, 0x00, 0x65, 0x69,
+    0x6C, 0x79, 0xD0, 0x43, 0x00, 0xD6, 0x43, 0x00, 0xE4, 0x43, 0x00, 0xC6, 0x34, 0x00, 0x08, 0x01,
+    0x07, 0x00, 0x61, 0x63, 0x64, 0x67, 0x6C, 0x6E, 0x73, 0x74, 0x72, 0x35, 0x00, 0xEA, 0x43, 0x00,
+    0x08, 0x44, 0x00, 0x0E, 0x44, 0x00, 0x14, 0x44, 0x00, 0x22, 0x44, 0x00, 0x3A, 0x44, 0x00, 0x40,
+    0x44, 0x00, 0x06, 0x02, 0x52, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x75, 0x79, 0x46, 0x44, 0x00, 0x4C,
+    0x44, 0x00, 0xB2, 0x2E, 0x00, 0x52, 0x44, 0x00, 0x5C, 0x44, 0x00, 0x62, 0x44, 0x00, 0x03, 0x01,
+    0x07, 0x00, 0x6E, 0x72, 0x73, 0x66, 0x44, 0x00, 0x72, 0x44, 0x00, 0x32, 0x3B, 0x00, 0x04, 0x00,
+    0x61, 0x65, 0x69, 0x6F, 0x2E, 0x2F, 0x00, 0x86, 0x44, 0x00, 0x90, 0x44, 0x00, 0x98, 0x44, 0x00,
+    0x00, 0x02, 0x70, 0x00, 0x02, 0x01, 0x11, 0x00, 0x6F, 0x79, 0x10, 0x2C, 0x00, 0xC6, 0x34, 0x00,
+    0x07, 0x01, 0x19, 0x00, 0x65, 0x67, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0xE2, 0x36, 0x00, 0xE6, 0x0A,
+    0x00, 0x94, 0x32, 0x00, 0x0A, 0x3D, 0x00, 0xA4, 0x38, 0x00, 0x9E, 0x44, 0x00, 0xA8, 0x44, 0x00,
+    0x08, 0x01, 0x07, 0x00, 0x66, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x7A, 0x4E, 0x2F, 0x00, 0xAE,
+    0x44, 0x00, 0xBC, 0x44, 0x00, 0xC8, 0x44, 0x00, 0xD2, 0x44, 0x00, 0xD8, 0x44, 0x00, 0xDE, 0x44,
+    0x00, 0xE6, 0x0A, 0x00, 0x00, 0x01, 0x10, 0x00, 0x0A, 0x00, 0x2E, 0x64, 0x65, 0x6C, 0x6E, 0x6F,
+    0x72, 0x73, 0x74, 0x76, 0x72, 0x0C, 0x00, 0x72, 0x0C, 0x00, 0xE8, 0x44, 0x00, 0xEE, 0x44, 0x00,
+    0xF8, 0x44, 0x00, 0x10, 0x45, 0x00, 0xE4, 0x43, 0x00, 0x1C, 0x45, 0x00, 0x22, 0x45, 0x00, 0x9C,
+    0x0C, 0x00, 0x03, 0x03, 0x00, 0x00, 0x65, 0x6C, 0x6F, 0x30, 0x37, 0x00, 0x34, 0x45, 0x00, 0x4E,
+    0x2F, 0x00, 0x03, 0x00, 0x69, 0x6F, 0x74, 0x3A, 0x45, 0x00, 0x40, 0x45, 0x00, 0x46, 0x45, 0x00,
+    0x0D, 0x00, 0x2E, 0x61, 0x63, 0x65, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x75, 0x76, 0x7A, 0x3A,
+    0x2E, 0x00, 0x50, 0x45, 0x00, 0x58, 0x45, 0x00, 0x64, 0x45, 0x00, 0x4E, 0x2F, 0x00, 0x6E, 0x45,
+    0x00, 0x74, 0x45, 0x00, 0x3A, 0x2E, 0x00, 0x82, 0x45, 0x00, 0x8A, 0x45, 0x00, 0x9C, 0x0C, 0x00,
+    0x3A, 0x2E, 0x00, 0x4C, 0x38, 0x00, 0x04, 0x01, 0x1E, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x90, 0x45,
+    0x00, 0x9C, 0x45, 0x00, 0xA4, 0x45, 0x00, 0xB2, 0x45, 0x00, 0x01, 0x01, 0x12, 0x00, 0x79, 0x10,
+    0x2C, 0x00, 0x04, 0x00, 0x61, 0x65, 0x69, 0x6F, 0xBE, 0x45, 0x00, 0xCA, 0x45, 0x00, 0xD0, 0x45,
+    0x00, 0xDC, 0x45, 0x00, 0x0A, 0x01, 0x07, 0x00, 0x2E, 0x62, 0x65, 0x67, 0x69, 0x6E, 0x6F, 0x72,
+    0x73, 0x76, 0x4C, 0x38, 0x00, 0x32, 0x3B, 0x00, 0x3A, 0x2E, 0x00, 0xEC, 0x45, 0x00, 0xF0, 0x45,
+    0x00, 0xF6, 0x45, 0x00, 0x3A, 0x2E, 0x00, 0x06, 0x46, 0x00, 0x66, 0x43, 0x00, 0x10, 0x46, 0x00,
+    0x05, 0x01, 0x07, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x75, 0x14, 0x46, 0x00, 0x2A, 0x46, 0x00, 0x34,
+    0x46, 0x00, 0x10, 0x2C, 0x00, 0x3E, 0x46, 0x00, 0x01, 0x01, 0x1E, 0x00, 0x74, 0x52, 0x43, 0x00,
+    0x01, 0x00, 0x68, 0x80, 0x2F, 0x00, 0x06, 0x00, 0x61, 0x65, 0x69, 0x6E, 0x73, 0x74, 0x44, 0x46,
+    0x00, 0x72, 0x0C, 0x00, 0x4C, 0x46, 0x00, 0x4C, 0x38, 0x00, 0x4C, 0x38, 0x00, 0x52, 0x46, 0x00,
+    0x02, 0x01, 0x07, 0x00, 0x6E, 0x72, 0x5A, 0x46, 0x00, 0x5E, 0x46, 0x00, 0x0E, 0x00, 0x62, 0x63,
+    0x65, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0x7A, 0x64, 0x46, 0x00, 0x5A,
+    0x2E, 0x00, 0x6A, 0x46, 0x00, 0x74, 0x46, 0x00, 0x7A, 0x46, 0x00, 0x80, 0x46, 0x00, 0x9C, 0x0C,
+    0x00, 0x86, 0x46, 0x00, 0xA0, 0x46, 0x00, 0xAE, 0x46, 0x00, 0xC4, 0x46, 0x00, 0xCA, 0x46, 0x00,
+    0xB2, 0x2E, 0x00, 0xD0, 0x46, 0x00, 0x0D, 0x00, 0x61, 0x63, 0x64, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+    0x72, 0x73, 0x74, 0x75, 0x78, 0xD8, 0x46, 0x00, 0xE2, 0x46, 0x00, 0xE8, 0x46, 0x00, 0xF0, 0x46,
+    0x00, 0x34, 0x3D, 0x00, 0xFE, 0x46, 0x00, 0x2E, 0x30, 0x00, 0x32, 0x3B, 0x00, 0x06, 0x47, 0x00,
+    0x20, 0x47, 0x00, 0x28, 0x47, 0x00, 0x4E, 0x2F, 0x00, 0x30, 0x47, 0x00, 0x0C, 0x00, 0x61, 0x63,
+    0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x76, 0x36, 0x47, 0x00, 0x44, 0x19, 0x00,
+    0x3C, 0x47, 0x00, 0x42, 0x47, 0x00, 0x46, 0x47, 0x00, 0x4C, 0x47, 0x00, 0x52, 0x47, 0x00, 0x58,
+    0x47, 0x00, 0x60, 0x47, 0x00, 0x72, 0x47, 0x00, 0x7C, 0x47, 0x00, 0x6E, 0x35, 0x00, 0x02, 0x03,
+    0xAF, 0x01, 0x61, 0x6F, 0xB2, 0x2E, 0x00, 0x86, 0x47, 0x00, 0x01, 0x02, 0x6E, 0x00, 0x65, 0x8E,
+    0x47, 0x00, 0x01, 0x02, 0x0E, 0x00, 0x61, 0x94, 0x47, 0x00, 0x0A, 0x00, 0x64, 0x67, 0x6C, 0x6D,
+    0x6E, 0x6F, 0x72, 0x73, 0x75, 0x76, 0x9A, 0x47, 0x00, 0xA4, 0x47, 0x00, 0xAC, 0x47, 0x00, 0xB6,
+    0x47, 0x00, 0xC0, 0x47, 0x00, 0xCA, 0x47, 0x00, 0xD4, 0x47, 0x00, 0xE6, 0x47, 0x00, 0xF0, 0x47,
+    0x00, 0xF6, 0x47, 0x00, 0x02, 0x02, 0x45, 0x00, 0x65, 0x6F, 0x9A, 0x2F, 0x00, 0xFC, 0x47, 0x00,
+    0x01, 0x03, 0x00, 0x00, 0x68, 0x10, 0x2C, 0x00, 0x03, 0x00, 0x61, 0x65, 0x79, 0x06, 0x48, 0x00,
+    0x0C, 0x48, 0x00, 0x10, 0x2C, 0x00, 0x05, 0x00, 0x67, 0x6D, 0x6E, 0x73, 0x74, 0x9C, 0x0C, 0x00,
+    0x94, 0x32, 0x00, 0x1A, 0x48, 0x00, 0x24, 0x48, 0x00, 0x9C, 0x0C, 0x00, 0x01, 0x01, 0x12, 0x00,
+    0x61, 0x2A, 0x48, 0x00, 0x02, 0x00, 0x70, 0x73, 0x30, 0x48, 0x00, 0x6E, 0x35, 0x00, 0x06, 0x02,
+    0x0E, 0x00, 0x6C, 0x6D, 0x6E, 0x70, 0x73, 0x74, 0xC6, 0x34, 0x00, 0x3E, 0x48, 0x00, 0x46, 0x48,
+    0x00, 0x0A, 0x3D, 0x00, 0xD8, 0x44, 0x00, 0x56, 0x48, 0x00, 0x06, 0x00, 0x65, 0x69, 0x6C, 0x6F,
+    0x72, 0x75, 0x64, 0x48, 0x00, 0x6C, 0x48, 0x00, 0x7A, 0x48, 0x00, 0x26, 0x0E, 0x00, 0x82, 0x48,
+    0x00, 0x8A, 0x48, 0x00, 0x0A, 0x00, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x74, 0x75,
+    0x90, 0x48, 0x00, 0xA6, 0x48, 0x00, 0xAC, 0x48, 0x00, 0xE6, 0x0A, 0x00, 0xB2, 0x48, 0x00, 0xE4,
+    0x43, 0x00, 0xC2, 0x48, 0x00, 0xC8, 0x48, 0x00, 0xD4, 0x48, 0x00, 0xDE, 0x48, 0x00, 0x08, 0x01,
+    0x11, 0x00, 0x61, 0x64, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x75, 0xF0, 0x48, 0x00, 0xFC, 0x39, 0x00,
+    0xFA, 0x48, 0x00, 0x04, 0x49, 0x00, 0xA0, 0x3D, 0x00, 0x1C, 0x49, 0x00, 0x10, 0x2C, 0x00, 0x26,
+    0x49, 0x00, 0x07, 0x02, 0x1E, 0x02, 0x64, 0x67, 0x6C, 0x6E, 0x72, 0x73, 0x74, 0xB0, 0x09, 0x00,
+    0x2E, 0x49, 0x00, 0x34, 0x49, 0x00, 0x3A, 0x49, 0x00, 0x4C, 0x49, 0x00, 0x52, 0x49, 0x00, 0x84,
+    0x14, 0x00, 0x07, 0x00, 0x2E, 0x61, 0x65, 0x66, 0x69, 0x6C, 0x74, 0xE6, 0x0A, 0x00, 0x5C, 0x49,
+    0x00, 0x62, 0x49, 0x00, 0x68, 0x49, 0x00, 0x72, 0x49, 0x00, 0x84, 0x14, 0x00, 0xE6, 0x0A, 0x00,
+    0x09, 0x01, 0x11, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6E, 0x6F, 0x72, 0x75, 0x7C, 0x49, 0x00,
+    0x82, 0x49, 0x00, 0x88, 0x49, 0x00, 0x8E, 0x49, 0x00, 0xA2, 0x49, 0x00, 0xA6, 0x49, 0x00, 0xAC,
+    0x49, 0x00, 0x52, 0x43, 0x00, 0xB8, 0x49, 0x00, 0x00, 0x03, 0xAC, 0x01, 0x01, 0x01, 0x10, 0x00,
+    0x6B, 0x10, 0x2C, 0x00, 0x0A, 0x00, 0x61, 0x65, 0x66, 0x69, 0x6C, 0x6E, 0x6F, 0x74, 0x75, 0x76,
+    0xC2, 0x49, 0x00, 0xD6, 0x49, 0x00, 0xFC, 0x39, 0x00, 0xE4, 0x49, 0x00, 0x00, 0x4A, 0x00, 0xE6,
+    0x0A, 0x00, 0x06, 0x4A, 0x00, 0xD2, 0x36, 0x00, 0x0C, 0x4A, 0x00, 0x72, 0x35, 0x00, 0x07, 0x00,
+    0x61, 0x65, 0x69, 0x6E, 0x6F, 0x70, 0x75, 0x12, 0x4A, 0x00, 0x1C, 0x4A, 0x00, 0x26, 0x4A, 0x00,
+    0xEA, 0x39, 0x00, 0x3A, 0x4A, 0x00, 0x40, 0x4A, 0x00, 0x46, 0x4A, 0x00, 0x10, 0x00, 0x2E, 0x61,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6C, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0x79, 0x72, 0x0C,
+    0x00, 0x4E, 0x4A, 0x00, 0x58, 0x4A, 0x00, 0x5E, 0x4A, 0x00, 0x66, 0x4A, 0x00, 0x76, 0x4A, 0x00,
+    0x7C, 0x4A, 0x00, 0x96, 0x4A, 0x00, 0xE6, 0x0A, 0x00, 0xE6, 0x0A, 0x00, 0x72, 0x0C, 0x00, 0xAE,
+    0x4A, 0x00, 0xBE, 0x4A, 0x00, 0xCA, 0x4A, 0x00, 0xD4, 0x4A, 0x00, 0xE6, 0x0A, 0x00, 0x0A, 0x01,
+    0x11, 0x00, 0x2E, 0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0xE6, 0x0A, 0x00, 0xDC,
+    0x4A, 0x00, 0x74, 0x0A, 0x00, 0x9C, 0x0C, 0x00, 0xE6, 0x4A, 0x00, 0xB8, 0x35, 0x00, 0xAC, 0x35,
+    0x00, 0x10, 0x2C, 0x00, 0xF4, 0x4A, 0x00, 0x06, 0x48, 0x00, 0x05, 0x01, 0x11, 0x00, 0x65, 0x68,
+    0x69, 0x72, 0x75, 0x4E, 0x2F, 0x00, 0x02, 0x4B, 0x00, 0x08, 0x4B, 0x00, 0x10, 0x4B, 0x00, 0x4E,
+    0x32, 0x00, 0x01, 0x00, 0x75, 0x16, 0x4B, 0x00, 0x09, 0x01, 0x0C, 0x00, 0x61, 0x64, 0x65, 0x67,
+    0x69, 0x6D, 0x6F, 0x72, 0x75, 0x24, 0x4B, 0x00, 0x30, 0x4B, 0x00, 0x36, 0x4B, 0x00, 0x48, 0x4B,
+    0x00, 0x4E, 0x4B, 0x00, 0x94, 0x32, 0x00, 0x62, 0x4B, 0x00, 0x6C, 0x4B, 0x00, 0xE2, 0x36, 0x00,
+    0x0F, 0x00, 0x2E, 0x61, 0x63, 0x65, 0x66, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6F, 0x70, 0x73, 0x74,
+    0x75, 0x72, 0x0C, 0x00, 0x72, 0x4B, 0x00, 0x80, 0x4B, 0x00, 0x88, 0x4B, 0x00, 0x4C, 0x38, 0x00,
+    0x90, 0x4B, 0x00, 0x9A, 0x4B, 0x00, 0x0C, 0x2C, 0x00, 0xAC, 0x4B, 0x00, 0xB2, 0x4B, 0x00, 0xB8,
+    0x4B, 0x00, 0xC0, 0x4B, 0x00, 0xCC, 0x4B, 0x00, 0xD8, 0x4B, 0x00, 0xEE, 0x4B, 0x00, 0x09, 0x00,
+    0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x74, 0x75, 0x7A, 0xF6, 0x4B, 0x00, 0x10, 0x4C, 0x00, 0x1C,
+    0x4C, 0x00, 0x24, 0x4C, 0x00, 0x48, 0x4C, 0x00, 0x52, 0x4C, 0x00, 0xE6, 0x0A, 0x00, 0x5C, 0x4C,
+    0x00, 0xEA, 0x3B, 0x00, 0x03, 0x01, 0x11, 0x00, 0x65, 0x69, 0x6F, 0x6A, 0x4C, 0x00, 0x78, 0x4C,
+    0x00, 0x86, 0x4C, 0x00, 0x01, 0x00, 0x6F, 0x9C, 0x0C, 0x00, 0x03, 0x00, 0x61, 0x69, 0x6F, 0x00,
+    0x3A, 0x00, 0x4E, 0x2F, 0x00, 0x90, 0x4C, 0x00, 0x03, 0x01, 0x0D, 0x00, 0x63, 0x6E, 0x70, 0x96,
+    0x4C, 0x00, 0x9C, 0x4C, 0x00, 0xA2, 0x4C, 0x00, 0x03, 0x01, 0x07, 0x00, 0x72, 0x73, 0x77, 0xAA,
+    0x4C, 0x00, 0xB4, 0x4C, 0x00, 0x80, 0x2F, 0x00, 0x01, 0x00, 0x70, 0x9C, 0x0C, 0x00, 0x01, 0x00,
+    0x64, 0xBA, 0x4C, 0x00, 0x05, 0x00, 0x2E, 0x62, 0x67, 0x69, 0x6C, 0x4C, 0x38, 0x00, 0x84, 0x14,
+    0x00, 0x26, 0x0E, 0x00, 0xD8, 0x44, 0x00, 0x4E, 0x2F, 0x00, 0x08, 0x00, 0x64, 0x65, 0x67, 0x6C,
+    0x6E, 0x72, 0x73, 0x74, 0xC6, 0x34, 0x00, 0xC6, 0x0E, 0x00, 0x9C, 0x0C, 0x00, 0xC0, 0x4C, 0x00,
+    0xC6, 0x4C, 0x00, 0x74, 0x0A, 0x00, 0xCC, 0x4C, 0x00, 0xD2, 0x36, 0x00, 0x07, 0x01, 0x12, 0x00,
+    0x2E, 0x63, 0x6C, 0x6D, 0x6E, 0x70, 0x73, 0x3A, 0x2E, 0x00, 0xD4, 0x4C, 0x00, 0xD8, 0x4C, 0x00,
+    0x10, 0x2C, 0x00, 0xE2, 0x4C, 0x00, 0x9C, 0x0C, 0x00, 0xF4, 0x4C, 0x00, 0x02, 0x01, 0x12, 0x00,
+    0x65, 0x79, 0xFC, 0x4C, 0x00, 0xE6, 0x0A, 0x00, 0x02, 0x00, 0x65, 0x6F, 0x02, 0x4D, 0x00, 0x08,
+    0x4D, 0x00, 0x04, 0x00, 0x72, 0x73, 0x75, 0x76, 0xFC, 0x39, 0x00, 0x5A, 0x2E, 0x00, 0x84, 0x14,
+    0x00, 0x0C, 0x4D, 0x00, 0x01, 0x00, 0x6F, 0x12, 0x4D, 0x00, 0x04, 0x03, 0x00, 0x00, 0x63, 0x68,
+    0x6C, 0x79, 0x10, 0x2C, 0x00, 0x18, 0x4D, 0x00, 0x9C, 0x0C, 0x00, 0x10, 0x2C, 0x00, 0x0B, 0x00,
+    0x62, 0x63, 0x64, 0x67, 0x69, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x76, 0x1E, 0x4D, 0x00, 0x28, 0x4D,
+    0x00, 0x2E, 0x4D, 0x00, 0x86, 0x3F, 0x00, 0x38, 0x4D, 0x00, 0x3E, 0x4D, 0x00, 0x44, 0x4D, 0x00,
+    0x52, 0x4D, 0x00, 0xB0, 0x09, 0x00, 0x60, 0x4D, 0x00, 0x6E, 0x4D, 0x00, 0x01, 0x02, 0x0E, 0x00,
+    0x69, 0xB2, 0x2E, 0x00, 0x03, 0x03, 0x00, 0x00, 0x65, 0x68, 0x69, 0x4E, 0x2F, 0x00, 0x76, 0x4D,
+    0x00, 0x84, 0x14, 0x00, 0x03, 0x01, 0x11, 0x00, 0x65, 0x69, 0x72, 0x80, 0x4D, 0x00, 0x88, 0x4D,
+    0x00, 0x90, 0x4D, 0x00, 0x0C, 0x00, 0x61, 0x62, 0x63, 0x66, 0x67, 0x6D, 0x6E, 0x70, 0x72, 0x73,
+    0x76, 0x79, 0x98, 0x4D, 0x00, 0xEA, 0x39, 0x00, 0xA4, 0x4D, 0x00, 0xAA, 0x4D, 0x00, 0xB0, 0x4D,
+    0x00, 0xBE, 0x4D, 0x00, 0xC4, 0x4D, 0x00, 0xDA, 0x4D, 0x00, 0xE4, 0x4D, 0x00, 0xFA, 0x4D, 0x00,
+    0x0A, 0x4E, 0x00, 0x14, 0x4E, 0x00, 0x01, 0x01, 0x11, 0x00, 0x72, 0x26, 0x0E, 0x00, 0x03, 0x03,
+    0xAF, 0x01, 0x61, 0x65, 0x6F, 0x1C, 0x4E, 0x00, 0xD0, 0x43, 0x00, 0x80, 0x2F, 0x00, 0x10, 0x00,
+    0x61, 0x62, 0x63, 0x64, 0x66, 0x67, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x71, 0x73, 0x74, 0x76, 0x7A,
+    0x24, 0x4E, 0x00, 0x48, 0x4B, 0x00, 0x3A, 0x4E, 0x00, 0x54, 0x4E, 0x00, 0x62, 0x4E, 0x00, 0x70,
+    0x4E, 0x00, 0x4C, 0x38, 0x00, 0x7E, 0x4E, 0x00, 0x82, 0x4E, 0x00, 0x94, 0x4E, 0x00, 0x6A, 0x3A,
+    0x00, 0xA6, 0x4E, 0x00, 0x34, 0x3D, 0x00, 0xAA, 0x4E, 0x00, 0xDC, 0x3D, 0x00, 0x74, 0x0A, 0x00,
+    0x01, 0x00, 0x61, 0xBA, 0x4E, 0x00, 0x05, 0x01, 0x12, 0x00, 0x61, 0x65, 0x66, 0x69, 0x6F, 0xC6,
+    0x4E, 0x00, 0xCC, 0x4E, 0x00, 0xE8, 0x4E, 0x00, 0xEE, 0x4E, 0x00, 0xFA, 0x4E, 0x00, 0x03, 0x01,
+    0x11, 0x00, 0x65, 0x69, 0x6F, 0x10, 0x41, 0x00, 0x0A, 0x4F, 0x00, 0x10, 0x4F, 0x00, 0x00, 0x03,
+    0x8E, 0x00, 0x0F, 0x00, 0x2E, 0x61, 0x62, 0x63, 0x66, 0x67, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73,
+    0x74, 0x75, 0x76, 0x4C, 0x38, 0x00, 0x1A, 0x4F, 0x00, 0x20, 0x4F, 0x00, 0xEA, 0x39, 0x00, 0xE6,
+    0x0A, 0x00, 0x2A, 0x4F, 0x00, 0xDC, 0x3D, 0x00, 0x3C, 0x4F, 0x00, 0x46, 0x4F, 0x00, 0x4C, 0x4F,
+    0x00, 0x5A, 0x4F, 0x00, 0x68, 0x4F, 0x00, 0x9E, 0x38, 0x00, 0x7A, 0x4F, 0x00, 0xE6, 0x0A, 0x00,
+    0x05, 0x01, 0x11, 0x00, 0x61, 0x68, 0x69, 0x6C, 0x72, 0x7C, 0x49, 0x00, 0x84, 0x4F, 0x00, 0x8E,
+    0x4F, 0x00, 0x10, 0x2C, 0x00, 0x26, 0x0E, 0x00, 0x03, 0x03, 0x8E, 0x00, 0x63, 0x65, 0x69, 0x10,
+    0x2C, 0x00, 0xC6, 0x34, 0x00, 0x98, 0x4F, 0x00, 0x06, 0x01, 0x0C, 0x00, 0x61, 0x65, 0x68, 0x69,
+    0x72, 0x75, 0x9E, 0x4F, 0x00, 0xA8, 0x4F, 0x00, 0xB8, 0x4F, 0x00, 0xBE, 0x4F, 0x00, 0x74, 0x0A,
+    0x00, 0xC8, 0x4F, 0x00, 0x0C, 0x00, 0x61, 0x62, 0x63, 0x65, 0x66, 0x69, 0x6D, 0x6E, 0x6F, 0x70,
+    0x73, 0x74, 0xFC, 0x39, 0x00, 0xD0, 0x4F, 0x00, 0xD6, 0x4F, 0x00, 0xE0, 0x4F, 0x00, 0x4E, 0x2F,
+    0x00, 0xEA, 0x4F, 0x00, 0xF0, 0x4F, 0x00, 0x02, 0x50, 0x00, 0x08, 0x50, 0x00, 0xE6, 0x0A, 0x00,
+    0x10, 0x50, 0x00, 0xC6, 0x0E, 0x00, 0x01, 0x00, 0x65, 0x1A, 0x50, 0x00, 0x00, 0x02, 0x0E, 0x00,
+    0x06, 0x01, 0x07, 0x00, 0x61, 0x62, 0x67, 0x6D, 0x6E, 0x73, 0xE6, 0x0A, 0x00, 0xE6, 0x0A, 0x00,
+    0x24, 0x50, 0x00, 0x0A, 0x3D, 0x00, 0x00, 0x43, 0x00, 0x2A, 0x50, 0x00, 0x0B, 0x01, 0x07, 0x00,
+    0x62, 0x63, 0x67, 0x68, 0x69, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x72, 0x0C, 0x00, 0x36, 0x50,
+    0x00, 0x44, 0x50, 0x00, 0x72, 0x0C, 0x00, 0x46, 0x4F, 0x00, 0x4E, 0x50, 0x00, 0x64, 0x50, 0x00,
+    0x72, 0x50, 0x00, 0x7A, 0x50, 0x00, 0x8C, 0x50, 0x00, 0x9A, 0x50, 0x00, 0x02, 0x02, 0x6E, 0x00,
+    0x61, 0x69, 0xA8, 0x50, 0x00, 0xAE, 0x50, 0x00, 0x0B, 0x00, 0x2E, 0x64, 0x67, 0x6C, 0x6D, 0x6E,
+    0x6F, 0x72, 0x73, 0x74, 0x76, 0xE6, 0x0A, 0x00, 0xBC, 0x50, 0x00, 0xCC, 0x50, 0x00, 0xD4, 0x50,
+    0x00, 0xDE, 0x50, 0x00, 0xE6, 0x50, 0x00, 0x36, 0x47, 0x00, 0x06, 0x51, 0x00, 0x0C, 0x51, 0x00,
+    0x14, 0x51, 0x00, 0x9C, 0x0C, 0x00, 0x0A, 0x00, 0x2E, 0x61, 0x64, 0x67, 0x6C, 0x6E, 0x6F, 0x73,
+    0x74, 0x7A, 0x3A, 0x2E, 0x00, 0x72, 0x35, 0x00, 0x26, 0x51, 0x00, 0x4E, 0x2F, 0x00, 0x30, 0x51,
+    0x00, 0x3A, 0x51, 0x00, 0x8E, 0x47, 0x00, 0x58, 0x51, 0x00, 0x68, 0x51, 0x00, 0xC6, 0x34, 0x00,
+    0x01, 0x01, 0x12, 0x00, 0x61, 0x6E, 0x51, 0x00, 0x03, 0x02, 0x6E, 0x00, 0x61, 0x69, 0x6F, 0x9C,
+    0x0C, 0x00, 0x78, 0x51, 0x00, 0x9C, 0x0C, 0x00, 0x0E, 0x01, 0x07, 0x00, 0x63, 0x64, 0x65, 0x67,
+    0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x75, 0x76, 0x7E, 0x51, 0x00, 0x84, 0x51, 0x00,
+    0x88, 0x51, 0x00, 0x44, 0x19, 0x00, 0x8E, 0x51, 0x00, 0xE6, 0x0A, 0x00, 0x94, 0x51, 0x00, 0xB2,
+    0x38, 0x00, 0x9A, 0x51, 0x00, 0xB0, 0x51, 0x00, 0xBC, 0x51, 0x00, 0xC8, 0x51, 0x00, 0xCE, 0x51,
+    0x00, 0x6E, 0x35, 0x00, 0x07, 0x02, 0x6E, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x74, 0x79, 0xD8,
+    0x51, 0x00, 0xBC, 0x3D, 0x00, 0xDE, 0x51, 0x00, 0xE4, 0x51, 0x00, 0xFC, 0x51, 0x00, 0x0E, 0x52,
+    0x00, 0xC6, 0x34, 0x00, 0x02, 0x03, 0x00, 0x00, 0x68, 0x69, 0x14, 0x52, 0x00, 0x26, 0x0E, 0x00,
+    0x06, 0x01, 0x07, 0x00, 0x64, 0x6C, 0x6D, 0x6E, 0x70, 0x75, 0x1C, 0x52, 0x00, 0x22, 0x52, 0x00,
+    0x4C, 0x38, 0x00, 0x58, 0x2F, 0x00, 0xE6, 0x0A, 0x00, 0x9C, 0x0C, 0x00, 0x0C, 0x01, 0x07, 0x00,
+    0x62, 0x63, 0x67, 0x6B, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x75, 0x76, 0x2C, 0x52, 0x00, 0x34,
+    0x52, 0x00, 0x42, 0x52, 0x00, 0x4E, 0x2F, 0x00, 0x48, 0x52, 0x00, 0x52, 0x52, 0x00, 0x58, 0x52,
+    0x00, 0x68, 0x52, 0x00, 0x7E, 0x52, 0x00, 0x8A, 0x52, 0x00, 0x96, 0x52, 0x00, 0xB0, 0x09, 0x00,
+    0x07, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x75, 0xA2, 0x52, 0x00, 0xA8, 0x52, 0x00, 0xAE,
+    0x52, 0x00, 0xBC, 0x52, 0x00, 0xC6, 0x52, 0x00, 0x74, 0x0A, 0x00, 0x74, 0x0A, 0x00, 0x06, 0x00,
+    0x61, 0x65, 0x69, 0x74, 0x75, 0x77, 0xCC, 0x52, 0x00, 0xD6, 0x52, 0x00, 0xDE, 0x52, 0x00, 0xF4,
+    0x52, 0x00, 0xFA, 0x52, 0x00, 0x04, 0x53, 0x00, 0x11, 0x00, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x67,
+    0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x72, 0x0C, 0x00, 0x0A, 0x53,
+    0x00, 0x10, 0x53, 0x00, 0x1C, 0x53, 0x00, 0x72, 0x0C, 0x00, 0x24, 0x53, 0x00, 0x2E, 0x53, 0x00,
+    0x38, 0x53, 0x00, 0x42, 0x53, 0x00, 0x4C, 0x38, 0x00, 0x44, 0x19, 0x00, 0x6E, 0x35, 0x00, 0x4A,
+    0x53, 0x00, 0x5E, 0x53, 0x00, 0x76, 0x53, 0x00, 0x7C, 0x53, 0x00, 0x9C, 0x0C, 0x00, 0x01, 0x01,
+    0x10, 0x00, 0x69, 0x84, 0x53, 0x00, 0x09, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x73, 0x75,
+    0x79, 0x8A, 0x53, 0x00, 0x90, 0x53, 0x00, 0x9E, 0x53, 0x00, 0xA8, 0x53, 0x00, 0x4C, 0x47, 0x00,
+    0xB6, 0x53, 0x00, 0xBC, 0x53, 0x00, 0xC6, 0x53, 0x00, 0xC6, 0x34, 0x00, 0x02, 0x03, 0xAF, 0x01,
+    0x61, 0x65, 0xCE, 0x53, 0x00, 0x4E, 0x2F, 0x00, 0x0C, 0x00, 0x61, 0x62, 0x64, 0x65, 0x66, 0x67,
+    0x6B, 0x6D, 0x6E, 0x6F, 0x73, 0x74, 0xD6, 0x53, 0x00, 0xE2, 0x53, 0x00, 0xEC, 0x53, 0x00, 0x0E,
+    0x52, 0x00, 0xF4, 0x53, 0x00, 0xFA, 0x53, 0x00, 0x4E, 0x2F, 0x00, 0x00, 0x54, 0x00, 0x08, 0x54,
+    0x00, 0x9C, 0x0C, 0x00, 0x14, 0x54, 0x00, 0x1E, 0x54, 0x00, 0x04, 0x02, 0x12, 0x01, 0x65, 0x69,
+    0x6C, 0x72, 0x32, 0x54, 0x00, 0x3A, 0x45, 0x00, 0x74, 0x0A, 0x00, 0x3C, 0x54, 0x00, 0x01, 0x02,
+    0x6E, 0x00, 0x65, 0x4C, 0x44, 0x00, 0x01, 0x01, 0x1D, 0x00, 0x65, 0x42, 0x54, 0x00, 0x02, 0x03,
+    0x00, 0x00, 0x65, 0x69, 0x4E, 0x2F, 0x00, 0x4A, 0x54, 0x00, 0x10, 0x00, 0x62, 0x63, 0x64, 0x65,
+    0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x54, 0x54, 0x00, 0x5A,
+    0x54, 0x00, 0x7C, 0x0E, 0x00, 0x4C, 0x38, 0x00, 0x64, 0x54, 0x00, 0x6C, 0x54, 0x00, 0x72, 0x54,
+    0x00, 0x7C, 0x54, 0x00, 0x92, 0x54, 0x00, 0xA2, 0x54, 0x00, 0xAA, 0x54, 0x00, 0xB0, 0x54, 0x00,
+    0x5E, 0x46, 0x00, 0xBE, 0x54, 0x00, 0xC6, 0x54, 0x00, 0xCC, 0x54, 0x00, 0x02, 0x02, 0x20, 0x00,
+    0x69, 0x72, 0x4E, 0x2F, 0x00, 0xD2, 0x54, 0x00, 0x01, 0x01, 0x12, 0x00, 0x75, 0x4E, 0x2F, 0x00,
+    0x09, 0x03, 0x8E, 0x00, 0x61, 0x63, 0x65, 0x69, 0x6C, 0x6D, 0x6F, 0x70, 0x74, 0xD8, 0x54, 0x00,
+    0xE2, 0x54, 0x00, 0xEA, 0x54, 0x00, 0xF2, 0x54, 0x00, 0xC6, 0x34, 0x00, 0xFC, 0x54, 0x00, 0xB2,
+    0x35, 0x00, 0x04, 0x55, 0x00, 0x0E, 0x55, 0x00, 0x06, 0x01, 0x12, 0x00, 0x61, 0x65, 0x69, 0x72,
+    0x73, 0x75, 0xA6, 0x42, 0x00, 0x14, 0x55, 0x00, 0x1A, 0x55, 0x00, 0x32, 0x55, 0x00, 0x9C, 0x0C,
+    0x00, 0x3C, 0x55, 0x00, 0x09, 0x00, 0x61, 0x64, 0x65, 0x66, 0x69, 0x6D, 0x6E, 0x6F, 0x74, 0x02,
+    0x33, 0x00, 0x9C, 0x0C, 0x00, 0x36, 0x47, 0x00, 0x42, 0x55, 0x00, 0x48, 0x55, 0x00, 0x52, 0x55,
+    0x00, 0x5E, 0x55, 0x00, 0x84, 0x14, 0x00, 0xD0, 0x4F, 0x00, 0x00, 0x02, 0x20, 0x00, 0x02, 0x00,
+    0x6D, 0x70, 0x4E, 0x2F, 0x00, 0x4E, 0x2F, 0x00, 0x01, 0x01, 0x0C, 0x00, 0x61, 0x84, 0x14, 0x00,
+    0x05, 0x01, 0x0C, 0x00, 0x64, 0x6C, 0x72, 0x73, 0x74, 0x80, 0x2F, 0x00, 0x62, 0x55, 0x00, 0x34,
+    0x49, 0x00, 0x68, 0x55, 0x00, 0xEE, 0x36, 0x00, 0x06, 0x00, 0x61, 0x65, 0x69, 0x6C, 0x72, 0x75,
+    0x72, 0x55, 0x00, 0x7C, 0x55, 0x00, 0x82, 0x55, 0x00, 0x8A, 0x55, 0x00, 0x84, 0x14, 0x00, 0x4E,
+    0x32, 0x00, 0x08, 0x00, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x74, 0x75, 0x74, 0x0A, 0x00, 0x90,
+    0x55, 0x00, 0x9C, 0x55, 0x00, 0xA6, 0x55, 0x00, 0xAC, 0x55, 0x00, 0xB2, 0x55, 0x00, 0xC0, 0x55,
+    0x00, 0xC6, 0x55, 0x00, 0x05, 0x00, 0x64, 0x65, 0x69, 0x6F, 0x75, 0xD0, 0x55, 0x00, 0xD6, 0x55,
+    0x00, 0xDC, 0x55, 0x00, 0xEA, 0x55, 0x00, 0xF2, 0x55, 0x00, 0x05, 0x00, 0x6C, 0x6E, 0x72, 0x74,
+    0x76, 0x10, 0x2C, 0x00, 0xF8, 0x55, 0x00, 0xFE, 0x55, 0x00, 0x9E, 0x38, 0x00, 0x84, 0x14, 0x00,
+    0x01, 0x00, 0x69, 0x06, 0x56, 0x00, 0x08, 0x00, 0x61, 0x65, 0x69, 0x6C, 0x6E, 0x72, 0x75, 0x79,
+    0x0E, 0x56, 0x00, 0x18, 0x56, 0x00, 0x28, 0x56, 0x00, 0x36, 0x56, 0x00, 0x3E, 0x56, 0x00, 0x8C,
+    0x2C, 0x00, 0xEE, 0x36, 0x00, 0x44, 0x56, 0x00, 0x01, 0x02, 0x32, 0x00, 0x61, 0x4C, 0x56, 0x00,
+    0x08, 0x01, 0x1E, 0x00, 0x63, 0x64, 0x66, 0x67, 0x6C, 0x6E, 0x73, 0x74, 0x52, 0x56, 0x00, 0x58,
+    0x56, 0x00, 0x3E, 0x46, 0x00, 0x4E, 0x2F, 0x00, 0x5E, 0x56, 0x00, 0x64, 0x56, 0x00, 0x6E, 0x56,
+    0x00, 0x58, 0x56, 0x00, 0x02, 0x01, 0x11, 0x00, 0x65, 0x69, 0x7C, 0x56, 0x00, 0x0A, 0x3D, 0x00,
+    0x0C, 0x00, 0x61, 0x64, 0x65, 0x66, 0x69, 0x6C, 0x6F, 0x70, 0x74, 0x75, 0x76, 0x79, 0x86, 0x56,
+    0x00, 0x92, 0x56, 0x00, 0x9A, 0x56, 0x00, 0xEA, 0x39, 0x00, 0xA8, 0x56, 0x00, 0xD8, 0x56, 0x00,
+    0xDE, 0x56, 0x00, 0xE2, 0x36, 0x00, 0x6E, 0x35, 0x00, 0xEC, 0x56, 0x00, 0x6E, 0x35, 0x00, 0xC6,
+    0x34, 0x00, 0x07, 0x00, 0x61, 0x62, 0x65, 0x69, 0x6D, 0x6F, 0x70, 0xFE, 0x56, 0x00, 0x0C, 0x57,
+    0x00, 0x16, 0x57, 0x00, 0x2A, 0x57, 0x00, 0x3C, 0x57, 0x00, 0x42, 0x57, 0x00, 0x4C, 0x57, 0x00,
+    0x0C, 0x01, 0x2E, 0x00, 0x61, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6B, 0x6F, 0x73, 0x74, 0x75, 0x76,
+    0x56, 0x57, 0x00, 0x62, 0x57, 0x00, 0x6A, 0x57, 0x00, 0x72, 0x57, 0x00, 0xC8, 0x32, 0x00, 0x7C,
+    0x57, 0x00, 0x8E, 0x57, 0x00, 0x94, 0x57, 0x00, 0xAA, 0x57, 0x00, 0xB6, 0x57, 0x00, 0xF4, 0x42,
+    0x00, 0x42, 0x39, 0x00, 0x05, 0x01, 0x1E, 0x00, 0x64, 0x6B, 0x70, 0x72, 0x73, 0xC0, 0x57, 0x00,
+    0x9C, 0x0C, 0x00, 0xAC, 0x35, 0x00, 0xCA, 0x57, 0x00, 0xAA, 0x4D, 0x00, 0x08, 0x00, 0x61, 0x65,
+    0x68, 0x69, 0x6F, 0x72, 0x75, 0x79, 0xC6, 0x34, 0x00, 0xD0, 0x57, 0x00, 0xDA, 0x57, 0x00, 0xE6,
+    0x57, 0x00, 0xF4, 0x57, 0x00, 0x74, 0x0A, 0x00, 0x02, 0x33, 0x00, 0x32, 0x3B, 0x00, 0x0D, 0x00,
+    0x61, 0x65, 0x67, 0x69, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x79, 0xFE, 0x57, 0x00,
+    0x12, 0x58, 0x00, 0xC8, 0x32, 0x00, 0x24, 0x58, 0x00, 0x5A, 0x35, 0x00, 0x42, 0x58, 0x00, 0x48,
+    0x58, 0x00, 0x0A, 0x3D, 0x00, 0x52, 0x58, 0x00, 0x58, 0x58, 0x00, 0x62, 0x58, 0x00, 0x70, 0x58,
+    0x00, 0x74, 0x0A, 0x00, 0x07, 0x00, 0x61, 0x63, 0x69, 0x6C, 0x6F, 0x70, 0x74, 0x4E, 0x32, 0x00,
+    0x76, 0x58, 0x00, 0x86, 0x58, 0x00, 0x9C, 0x0C, 0x00, 0xC6, 0x34, 0x00, 0x94, 0x58, 0x00, 0xA2,
+    0x58, 0x00, 0x05, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x78, 0x51, 0x00, 0xAC, 0x58, 0x00, 0xBA,
+    0x58, 0x00, 0xC6, 0x58, 0x00, 0xC4, 0x46, 0x00, 0x06, 0x01, 0x1E, 0x00, 0x62, 0x63, 0x65, 0x6C,
+    0x6E, 0x76, 0xD4, 0x58, 0x00, 0xDE, 0x58, 0x00, 0xE4, 0x58, 0x00, 0x9C, 0x0C, 0x00, 0xEA, 0x58,
+    0x00, 0xFC, 0x39, 0x00, 0x03, 0x00, 0x65, 0x69, 0x6F, 0xF4, 0x58, 0x00, 0xFE, 0x58, 0x00, 0x0C,
+    0x59, 0x00, 0x05, 0x00, 0x64, 0x65, 0x69, 0x6E, 0x6F, 0x58, 0x56, 0x00, 0x12, 0x59, 0x00, 0x02,
+    0x33, 0x00, 0xEE, 0x36, 0x00, 0x10, 0x2C, 0x00, 0x01, 0x00, 0x69, 0x1C, 0x59, 0x00, 0x01, 0x00,
+    0x61, 0x02, 0x33, 0x00, 0x0B, 0x01, 0x07, 0x00, 0x63, 0x64, 0x67, 0x69, 0x6C, 0x6E, 0x70, 0x72,
+    0x74, 0x76, 0x79, 0x22, 0x59, 0x00, 0x10, 0x2C, 0x00, 0x30, 0x59, 0x00, 0x36, 0x59, 0x00, 0x3E,
+    0x59, 0x00, 0x46, 0x59, 0x00, 0x58, 0x59, 0x00, 0x60, 0x59, 0x00, 0x72, 0x59, 0x00, 0x4E, 0x2F,
+    0x00, 0x4C, 0x38, 0x00, 0x0B, 0x00, 0x2E, 0x61, 0x63, 0x64, 0x65, 0x6B, 0x6C, 0x6E, 0x6F, 0x72,
+    0x74, 0xE6, 0x0A, 0x00, 0x80, 0x59, 0x00, 0x6E, 0x35, 0x00, 0x88, 0x59, 0x00, 0x94, 0x59, 0x00,
+    0x4E, 0x2F, 0x00, 0xA0, 0x59, 0x00, 0xAA, 0x59, 0x00, 0x36, 0x47, 0x00, 0xB8, 0x59, 0x00, 0xDA,
+    0x59, 0x00, 0x0A, 0x00, 0x2E, 0x61, 0x65, 0x69, 0x6C, 0x6F, 0x73, 0x74, 0x75, 0x79, 0xE6, 0x0A,
+    0x00, 0xE6, 0x59, 0x00, 0xEC, 0x59, 0x00, 0xFA, 0x59, 0x00, 0x6E, 0x35, 0x00, 0x14, 0x5A, 0x00,
+    0xE6, 0x0A, 0x00, 0x72, 0x35, 0x00, 0x3A, 0x2E, 0x00, 0xC6, 0x0E, 0x00, 0x09, 0x00, 0x61, 0x63,
+    0x64, 0x65, 0x67, 0x6C, 0x6E, 0x6F, 0x74, 0x22, 0x5A, 0x00, 0x2A, 0x5A, 0x00, 0x38, 0x5A, 0x00,
+    0x48, 0x5A, 0x00, 0x52, 0x5A, 0x00, 0x00, 0x43, 0x00, 0x58, 0x5A, 0x00, 0x68, 0x5A, 0x00, 0x70,
+    0x5A, 0x00, 0x00, 0x03, 0x61, 0x01, 0x04, 0x03, 0x5E, 0x01, 0x61, 0x69, 0x6F, 0x75, 0x7A, 0x5A,
+    0x00, 0x84, 0x5A, 0x00, 0x94, 0x35, 0x00, 0x9A, 0x5A, 0x00, 0x0C, 0x00, 0x63, 0x64, 0x65, 0x67,
+    0x69, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0x9C, 0x0C, 0x00, 0x66, 0x43, 0x00, 0xA0, 0x5A,
+    0x00, 0xAA, 0x5A, 0x00, 0xAE, 0x5A, 0x00, 0xB4, 0x5A, 0x00, 0xEA, 0x39, 0x00, 0x9C, 0x0C, 0x00,
+    0xBE, 0x5A, 0x00, 0xC6, 0x5A, 0x00, 0xCE, 0x5A, 0x00, 0xD6, 0x5A, 0x00, 0x03, 0x02, 0x6E, 0x00,
+    0x61, 0x65, 0x6F, 0xDC, 0x5A, 0x00, 0xE2, 0x5A, 0x00, 0xFA, 0x5A, 0x00, 0x04, 0x01, 0x1E, 0x00,
+    0x61, 0x65, 0x69, 0x6F, 0x00, 0x5B, 0x00, 0x06, 0x5B, 0x00, 0x30, 0x5B, 0x00, 0x3E, 0x5B, 0x00,
+    0x03, 0x03, 0x8E, 0x00, 0x65, 0x68, 0x69, 0x58, 0x5B, 0x00, 0x9C, 0x0C, 0x00, 0x8A, 0x53, 0x00,
+    0x08, 0x02, 0x0E, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x75, 0x77, 0x60, 0x5B, 0x00, 0xC6,
+    0x34, 0x00, 0xC6, 0x34, 0x00, 0x66, 0x5B, 0x00, 0x6C, 0x5B, 0x00, 0x72, 0x5B, 0x00, 0xCA, 0x2F,
+    0x00, 0x10, 0x2C, 0x00, 0x09, 0x00, 0x62, 0x65, 0x66, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x78,
+    0x5B, 0x00, 0x4E, 0x2F, 0x00, 0x4E, 0x2F, 0x00, 0x80, 0x5B, 0x00, 0x9C, 0x0C, 0x00, 0x6E, 0x35,
+    0x00, 0xCA, 0x2F, 0x00, 0x3A, 0x2E, 0x00, 0x86, 0x5B, 0x00, 0x03, 0x01, 0x1E, 0x00, 0x61, 0x65,
+    0x69, 0x96, 0x5B, 0x00, 0xA4, 0x5B, 0x00, 0xB2, 0x5B, 0x00, 0x10, 0x00, 0x62, 0x63, 0x64, 0x66,
+    0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x7A, 0xBC, 0x5B, 0x00, 0xC8,
+    0x5B, 0x00, 0xD2, 0x5B, 0x00, 0xD8, 0x5B, 0x00, 0xC6, 0x34, 0x00, 0x44, 0x19, 0x00, 0xE2, 0x5B,
+    0x00, 0xF0, 0x5B, 0x00, 0x06, 0x5C, 0x00, 0x0C, 0x5C, 0x00, 0x16, 0x5C, 0x00, 0xC6, 0x34, 0x00,
+    0x24, 0x5C, 0x00, 0x2E, 0x2F, 0x00, 0x2A, 0x5C, 0x00, 0x34, 0x5C, 0x00, 0x03, 0x01, 0x12, 0x00,
+    0x61, 0x69, 0x6F, 0x3A, 0x5C, 0x00, 0x44, 0x5C, 0x00, 0x9C, 0x0C, 0x00, 0x04, 0x01, 0x12, 0x00,
+    0x65, 0x68, 0x69, 0x75, 0x50, 0x5C, 0x00, 0x58, 0x5C, 0x00, 0x62, 0x5C, 0x00, 0x6C, 0x5C, 0x00,
+    0x02, 0x00, 0x61, 0x69, 0x72, 0x5C, 0x00, 0x78, 0x5C, 0x00, 0x12, 0x00, 0x2E, 0x61, 0x62, 0x63,
+    0x64, 0x66, 0x67, 0x69, 0x6C, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x72, 0x0C,
+    0x00, 0x88, 0x5C, 0x00, 0x9E, 0x5C, 0x00, 0xA4, 0x5C, 0x00, 0xB6, 0x5C, 0x00, 0xC2, 0x5C, 0x00,
+    0xD4, 0x5C, 0x00, 0xE4, 0x58, 0x00, 0xDA, 0x5C, 0x00, 0xE4, 0x5C, 0x00, 0x02, 0x33, 0x00, 0xEA,
+    0x5C, 0x00, 0xF8, 0x5C, 0x00, 0x08, 0x5D, 0x00, 0x1A, 0x5D, 0x00, 0x28, 0x5D, 0x00, 0x30, 0x5D,
+    0x00, 0xBE, 0x35, 0x00, 0x02, 0x01, 0x12, 0x00, 0x75, 0x79, 0x4E, 0x2F, 0x00, 0x10, 0x2C, 0x00,
+    0x05, 0x01, 0x1E, 0x00, 0x65, 0x69, 0x6C, 0x6F, 0x75, 0x44, 0x5D, 0x00, 0x4E, 0x5D, 0x00, 0x74,
+    0x0A, 0x00, 0x86, 0x3F, 0x00, 0x84, 0x14, 0x00, 0x02, 0x01, 0x0B, 0x00, 0x2E, 0x61, 0xE6, 0x0A,
+    0x00, 0x30, 0x3F, 0x00, 0x0F, 0x00, 0x61, 0x62, 0x63, 0x64, 0x65, 0x67, 0x6C, 0x6D, 0x6E, 0x6F,
+    0x70, 0x71, 0x73, 0x74, 0x76, 0x60, 0x5D, 0x00, 0x70, 0x5D, 0x00, 0x78, 0x5D, 0x00, 0x8A, 0x3A,
+    0x00, 0x8A, 0x5D, 0x00, 0x98, 0x5D, 0x00, 0xA2, 0x5D, 0x00, 0xA8, 0x5D, 0x00, 0xBA, 0x5D, 0x00,
+    0x02, 0x33, 0x00, 0xCC, 0x5D, 0x00, 0x10, 0x2C, 0x00, 0xD6, 0x5D, 0x00, 0xEA, 0x5D, 0x00, 0xFC,
+    0x5D, 0x00, 0x06, 0x00, 0x2E, 0x65, 0x68, 0x6C, 0x72, 0x73, 0x0A, 0x5E, 0x00, 0xBC, 0x3D, 0x00,
+    0x0E, 0x5E, 0x00, 0x14, 0x5E, 0x00, 0x1E, 0x5E, 0x00, 0x24, 0x5E, 0x00, 0x03, 0x01, 0x12, 0x00,
+    0x65, 0x69, 0x6F, 0x2A, 0x5E, 0x00, 0x36, 0x5E, 0x00, 0x40, 0x5E, 0x00, 0x04, 0x01, 0x12, 0x00,
+    0x61, 0x65, 0x69, 0x79, 0x44, 0x5E, 0x00, 0x4A, 0x5E, 0x00, 0x56, 0x5E, 0x00, 0x10, 0x2C, 0x00,
+    0x05, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x75, 0x06, 0x48, 0x00, 0x64, 0x5E, 0x00, 0x76, 0x5E, 0x00,
+    0x88, 0x5E, 0x00, 0x84, 0x14, 0x00, 0x0F, 0x00, 0x62, 0x63, 0x65, 0x66, 0x6B, 0x6C, 0x6D, 0x6E,
+    0x6F, 0x70, 0x72, 0x73, 0x74, 0x76, 0x78, 0x90, 0x5E, 0x00, 0x9A, 0x5E, 0x00, 0xA2, 0x5E, 0x00,
+    0xAE, 0x5E, 0x00, 0xB8, 0x5E, 0x00, 0xC0, 0x5E, 0x00, 0xC6, 0x5E, 0x00, 0xD4, 0x5E, 0x00, 0xE6,
+    0x5E, 0x00, 0xF0, 0x5E, 0x00, 0xFA, 0x5E, 0x00, 0x04, 0x5F, 0x00, 0x0E, 0x5F, 0x00, 0x1C, 0x5F,
+    0x00, 0x32, 0x3B, 0x00, 0x05, 0x01, 0x12, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x26, 0x5F, 0x00,
+    0x2C, 0x5F, 0x00, 0x3E, 0x5F, 0x00, 0x0A, 0x4F, 0x00, 0x84, 0x14, 0x00, 0x04, 0x02, 0x20, 0x00,
+    0x65, 0x69, 0x6F, 0x79, 0x42, 0x5F, 0x00, 0x54, 0x5F, 0x00, 0x5E, 0x5F, 0x00, 0xD8, 0x44, 0x00,
+    0x08, 0x02, 0x12, 0x01, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6F, 0x70, 0x77, 0x68, 0x5F, 0x00, 0x9C,
+    0x0C, 0x00, 0x70, 0x5F, 0x00, 0x84, 0x5F, 0x00, 0x8C, 0x5F, 0x00, 0x94, 0x5F, 0x00, 0x74, 0x0A,
+    0x00, 0x26, 0x0E, 0x00, 0x06, 0x00, 0x61, 0x65, 0x68, 0x69, 0x72, 0x73, 0x9A, 0x5F, 0x00, 0xA4,
+    0x5F, 0x00, 0xB2, 0x5F, 0x00, 0xB8, 0x5F, 0x00, 0xD8, 0x5F, 0x00, 0xBE, 0x35, 0x00, 0x08, 0x00,
+    0x61, 0x65, 0x67, 0x69, 0x6D, 0x6E, 0x73, 0x74, 0x72, 0x35, 0x00, 0xE6, 0x5F, 0x00, 0xCA, 0x3C,
+    0x00, 0x3A, 0x45, 0x00, 0xF0, 0x5F, 0x00, 0xF6, 0x5F, 0x00, 0x44, 0x43, 0x00, 0x02, 0x60, 0x00,
+    0x03, 0x00, 0x65, 0x69, 0x6F, 0x08, 0x60, 0x00, 0x24, 0x60, 0x00, 0x84, 0x14, 0x00, 0x03, 0x00,
+    0x63, 0x6E, 0x74, 0x9C, 0x0C, 0x00, 0x2E, 0x60, 0x00, 0x72, 0x35, 0x00, 0x01, 0x00, 0x73, 0x34,
+    0x60, 0x00, 0x0A, 0x01, 0x1E, 0x00, 0x62, 0x63, 0x69, 0x6C, 0x6E, 0x70, 0x74, 0x75, 0x76, 0x77,
+    0xEC, 0x1B, 0x00, 0x3A, 0x60, 0x00, 0x3A, 0x2E, 0x00, 0x48, 0x60, 0x00, 0x5E, 0x60, 0x00, 0x68,
+    0x60, 0x00, 0x70, 0x60, 0x00, 0x4E, 0x2F, 0x00, 0x7E, 0x60, 0x00, 0x3A, 0x2E, 0x00, 0x09, 0x00,
+    0x61, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x75, 0x79, 0x84, 0x60, 0x00, 0x96, 0x60, 0x00, 0xA4,
+    0x60, 0x00, 0xB4, 0x60, 0x00, 0xC2, 0x60, 0x00, 0xCC, 0x60, 0x00, 0xDA, 0x60, 0x00, 0x74, 0x0A,
+    0x00, 0xE0, 0x60, 0x00, 0x10, 0x00, 0x2E, 0x61, 0x63, 0x64, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x70,
+    0x72, 0x73, 0x75, 0x76, 0x77, 0x78, 0xE6, 0x0A, 0x00, 0xE6, 0x60, 0x00, 0xF2, 0x60, 0x00, 0xFC,
+    0x60, 0x00, 0x08, 0x61, 0x00, 0x3A, 0x2E, 0x00, 0x10, 0x61, 0x00, 0x1E, 0x61, 0x00, 0x30, 0x61,
+    0x00, 0x4E, 0x61, 0x00, 0x58, 0x61, 0x00, 0x6A, 0x61, 0x00, 0x76, 0x61, 0x00, 0x7C, 0x61, 0x00,
+    0x5C, 0x2C, 0x00, 0x3A, 0x2E, 0x00, 0x05, 0x01, 0x2E, 0x00, 0x2E, 0x65, 0x69, 0x6F, 0x77, 0x72,
+    0x0C, 0x00, 0x84, 0x61, 0x00, 0x8E, 0x61, 0x00, 0xA0, 0x61, 0x00, 0xE6, 0x0A, 0x00, 0x0D, 0x00,
+    0x62, 0x63, 0x64, 0x67, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x76, 0x7A, 0x02, 0x33, 0x00,
+    0x44, 0x43, 0x00, 0xB4, 0x61, 0x00, 0xBE, 0x61, 0x00, 0xC4, 0x61, 0x00, 0xCE, 0x61, 0x00, 0xDE,
+    0x61, 0x00, 0xE6, 0x61, 0x00, 0xC6, 0x0E, 0x00, 0xF2, 0x61, 0x00, 0x3A, 0x2E, 0x00, 0xC6, 0x0E,
+    0x00, 0x3A, 0x2E, 0x00, 0x03, 0x01, 0x1E, 0x00, 0x65, 0x69, 0x79, 0xF8, 0x61, 0x00, 0x00, 0x62,
+    0x00, 0x06, 0x62, 0x00, 0x04, 0x02, 0x32, 0x00, 0x61, 0x65, 0x69, 0x6F, 0xBC, 0x3D, 0x00, 0xC6,
+    0x34, 0x00, 0x0C, 0x62, 0x00, 0x12, 0x62, 0x00, 0x04, 0x02, 0x0E, 0x00, 0x61, 0x65, 0x69, 0x6F,
+    0x18, 0x62, 0x00, 0x24, 0x62, 0x00, 0x2E, 0x62, 0x00, 0x34, 0x62, 0x00, 0x09, 0x01, 0x07, 0x00,
+    0x63, 0x66, 0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x76, 0x60, 0x2B, 0x00, 0xFE, 0x30, 0x00, 0x3A,
+    0x62, 0x00, 0x40, 0x62, 0x00, 0x4C, 0x38, 0x00, 0x56, 0x62, 0x00, 0x64, 0x62, 0x00, 0x6C, 0x62,
+    0x00, 0x76, 0x62, 0x00, 0x06, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x7E, 0x62, 0x00, 0x8E,
+    0x62, 0x00, 0xA0, 0x62, 0x00, 0xAA, 0x62, 0x00, 0xE4, 0x43, 0x00, 0xBC, 0x62, 0x00, 0x01, 0x00,
+    0x75, 0xCE, 0x62, 0x00, 0x0B, 0x01, 0x11, 0x00, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6C, 0x6E, 0x70,
+    0x74, 0x75, 0x77, 0xD8, 0x62, 0x00, 0xE4, 0x62, 0x00, 0xE8, 0x62, 0x00, 0xFA, 0x62, 0x00, 0x00,
+    0x63, 0x00, 0x14, 0x63, 0x00, 0x10, 0x2C, 0x00, 0x1C, 0x63, 0x00, 0x6E, 0x35, 0x00, 0xCE, 0x35,
+    0x00, 0xFC, 0x39, 0x00, 0x0D, 0x00, 0x2E, 0x61, 0x62, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x73,
+    0x75, 0x77, 0x79, 0x72, 0x0C, 0x00, 0x22, 0x63, 0x00, 0xFC, 0x39, 0x00, 0x40, 0x63, 0x00, 0xA0,
+    0x3D, 0x00, 0x4E, 0x63, 0x00, 0x6E, 0x63, 0x00, 0x74, 0x63, 0x00, 0x8A, 0x63, 0x00, 0x9A, 0x63,
+    0x00, 0xA0, 0x63, 0x00, 0xAE, 0x3E, 0x00, 0xA6, 0x63, 0x00, 0x09, 0x01, 0x07, 0x00, 0x61, 0x62,
+    0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0xE8, 0x4E, 0x00, 0xAE, 0x63, 0x00, 0xB2, 0x63, 0x00,
+    0xB6, 0x63, 0x00, 0x10, 0x2C, 0x00, 0xC0, 0x63, 0x00, 0x6E, 0x35, 0x00, 0xC8, 0x63, 0x00, 0x6E,
+    0x35, 0x00, 0x02, 0x01, 0x1E, 0x00, 0x69, 0x6F, 0xCE, 0x63, 0x00, 0xE6, 0x0A, 0x00, 0x05, 0x01,
+    0x05, 0x00, 0x63, 0x6C, 0x6E, 0x72, 0x74, 0xE6, 0x0A, 0x00, 0x4C, 0x38, 0x00, 0xD4, 0x63, 0x00,
+    0xDE, 0x63, 0x00, 0xE4, 0x63, 0x00, 0x12, 0x01, 0x07, 0x00, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67,
+    0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x4C, 0x38, 0x00, 0xEA,
+    0x63, 0x00, 0x4E, 0x33, 0x00, 0xA2, 0x37, 0x00, 0xEC, 0x38, 0x00, 0xF6, 0x63, 0x00, 0xFC, 0x63,
+    0x00, 0x02, 0x64, 0x00, 0x1E, 0x64, 0x00, 0x28, 0x64, 0x00, 0x32, 0x64, 0x00, 0x40, 0x64, 0x00,
+    0x56, 0x64, 0x00, 0x60, 0x64, 0x00, 0xB2, 0x2E, 0x00, 0x4E, 0x2F, 0x00, 0x72, 0x0C, 0x00, 0x6A,
+    0x64, 0x00, 0x02, 0x01, 0x0C, 0x00, 0x68, 0x72, 0x70, 0x64, 0x00, 0x74, 0x0A, 0x00, 0x11, 0x00,
+    0x2E, 0x61, 0x63, 0x64, 0x65, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x78,
+    0x79, 0xE6, 0x0A, 0x00, 0x80, 0x64, 0x00, 0x8E, 0x64, 0x00, 0x98, 0x64, 0x00, 0xC6, 0x0E, 0x00,
+    0xA0, 0x64, 0x00, 0xAC, 0x64, 0x00, 0xBE, 0x64, 0x00, 0xC4, 0x64, 0x00, 0xC6, 0x0E, 0x00, 0xDA,
+    0x64, 0x00, 0xE2, 0x64, 0x00, 0xFC, 0x64, 0x00, 0x06, 0x65, 0x00, 0x4C, 0x38, 0x00, 0x4C, 0x38,
+    0x00, 0xE6, 0x0A, 0x00, 0x08, 0x00, 0x2E, 0x61, 0x65, 0x69, 0x6C, 0x6F, 0x73, 0x79, 0x72, 0x0C,
+    0x00, 0x0C, 0x65, 0x00, 0x16, 0x65, 0x00, 0x26, 0x65, 0x00, 0xE6, 0x0A, 0x00, 0x34, 0x65, 0x00,
+    0x72, 0x0C, 0x00, 0x4A, 0x65, 0x00, 0x11, 0x00, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x6C,
+    0x6D, 0x6E, 0x6F, 0x71, 0x73, 0x74, 0x75, 0x76, 0x7A, 0x54, 0x65, 0x00, 0x64, 0x65, 0x00, 0x68,
+    0x65, 0x00, 0x1C, 0x45, 0x00, 0x76, 0x65, 0x00, 0x7C, 0x65, 0x00, 0x84, 0x65, 0x00, 0x8C, 0x65,
+    0x00, 0x92, 0x65, 0x00, 0x9E, 0x65, 0x00, 0xB2, 0x65, 0x00, 0x3A, 0x2E, 0x00, 0xBE, 0x65, 0x00,
+    0x4E, 0x32, 0x00, 0x9C, 0x0C, 0x00, 0xD8, 0x65, 0x00, 0xE0, 0x65, 0x00, 0x04, 0x01, 0x11, 0x00,
+    0x61, 0x65, 0x69, 0x6F, 0xEC, 0x65, 0x00, 0xF4, 0x65, 0x00, 0x06, 0x66, 0x00, 0x26, 0x0E, 0x00,
+    0x01, 0x02, 0x6E, 0x00, 0x65, 0x4E, 0x2F, 0x00, 0x0E, 0x01, 0x07, 0x00, 0x62, 0x63, 0x64, 0x66,
+    0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x75, 0x77, 0x72, 0x35, 0x00, 0x0C, 0x66, 0x00,
+    0xAC, 0x48, 0x00, 0x72, 0x0C, 0x00, 0x12, 0x66, 0x00, 0x18, 0x66, 0x00, 0x1E, 0x66, 0x00, 0x24,
+    0x66, 0x00, 0x32, 0x66, 0x00, 0x40, 0x66, 0x00, 0x58, 0x2F, 0x00, 0x3A, 0x38, 0x00, 0x4A, 0x66,
+    0x00, 0x54, 0x66, 0x00, 0x05, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x75, 0x5A, 0x66, 0x00, 0x72, 0x66,
+    0x00, 0x80, 0x66, 0x00, 0x92, 0x66, 0x00, 0xB0, 0x66, 0x00, 0x03, 0x03, 0x00, 0x00, 0x63, 0x68,
+    0x77, 0xBA, 0x66, 0x00, 0x4E, 0x2F, 0x00, 0x10, 0x2C, 0x00, 0x04, 0x03, 0x76, 0x00, 0x65, 0x6F,
+    0x72, 0x75, 0xD0, 0x43, 0x00, 0x26, 0x0E, 0x00, 0xC2, 0x66, 0x00, 0x4E, 0x2F, 0x00, 0x0B, 0x01,
+    0x07, 0x00, 0x61, 0x62, 0x64, 0x65, 0x66, 0x69, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0xC8, 0x66, 0x00,
+    0xEA, 0x39, 0x00, 0x58, 0x2F, 0x00, 0xE6, 0x0A, 0x00, 0xEC, 0x38, 0x00, 0xD0, 0x66, 0x00, 0x4C,
+    0x38, 0x00, 0xD4, 0x66, 0x00, 0xDA, 0x66, 0x00, 0xE0, 0x66, 0x00, 0x4C, 0x38, 0x00, 0x04, 0x01,
+    0x0B, 0x00, 0x61, 0x68, 0x69, 0x6F, 0x3C, 0x0C, 0x00, 0x74, 0x0A, 0x00, 0xD8, 0x44, 0x00, 0xE6,
+    0x0A, 0x00, 0x03, 0x01, 0x07, 0x00, 0x61, 0x6C, 0x70, 0xE6, 0x0A, 0x00, 0x72, 0x0C, 0x00, 0xF6,
+    0x66, 0x00, 0x01, 0x01, 0x0C, 0x00, 0x65, 0x9C, 0x0C, 0x00, 0x07, 0x00, 0x62, 0x63, 0x64, 0x6E,
+    0x72, 0x74, 0x76, 0xE6, 0x0A, 0x00, 0x4E, 0x2F, 0x00, 0x04, 0x67, 0x00, 0x0A, 0x67, 0x00, 0x14,
+    0x67, 0x00, 0x74, 0x0A, 0x00, 0x4E, 0x2F, 0x00, 0x03, 0x00, 0x65, 0x69, 0x6C, 0x26, 0x67, 0x00,
+    0x32, 0x67, 0x00, 0x3A, 0x67, 0x00, 0x06, 0x00, 0x61, 0x69, 0x6C, 0x72, 0x75, 0x79, 0x84, 0x14,
+    0x00, 0x40, 0x67, 0x00, 0xF6, 0x31, 0x00, 0x84, 0x14, 0x00, 0x84, 0x14, 0x00, 0x10, 0x2C, 0x00,
+    0x06, 0x00, 0x64, 0x65, 0x69, 0x6F, 0x73, 0x75, 0xFC, 0x39, 0x00, 0x4A, 0x67, 0x00, 0x58, 0x67,
+    0x00, 0x6A, 0x67, 0x00, 0xEA, 0x39, 0x00, 0x10, 0x2C, 0x00, 0x03, 0x00, 0x61, 0x6E, 0x72, 0x70,
+    0x67, 0x00, 0x76, 0x67, 0x00, 0x84, 0x67, 0x00, 0x02, 0x00, 0x61, 0x6C, 0x4C, 0x38, 0x00, 0x84,
+    0x14, 0x00, 0x02, 0x00, 0x68, 0x69, 0x8A, 0x67, 0x00, 0x36, 0x47, 0x00, 0x05, 0x02, 0x68, 0x00,
+    0x6C, 0x6E, 0x72, 0x74, 0x76, 0x1E, 0x3D, 0x00, 0x90, 0x67, 0x00, 0x98, 0x67, 0x00, 0x9E, 0x67,
+    0x00, 0xA4, 0x67, 0x00, 0x0D, 0x00, 0x61, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6C, 0x6D, 0x6F, 0x73,
+    0x74, 0x75, 0x76, 0xAC, 0x67, 0x00, 0xB8, 0x67, 0x00, 0x58, 0x56, 0x00, 0xBE, 0x67, 0x00, 0xEA,
+    0x39, 0x00, 0xC6, 0x67, 0x00, 0xD6, 0x67, 0x00, 0xAE, 0x3E, 0x00, 0x4A, 0x1F, 0x00, 0xE0, 0x67,
+    0x00, 0xE8, 0x67, 0x00, 0xF6, 0x67, 0x00, 0xFC, 0x39, 0x00, 0x05, 0x00, 0x61, 0x62, 0x69, 0x6F,
+    0x70, 0xFE, 0x67, 0x00, 0x04, 0x68, 0x00, 0x0E, 0x68, 0x00, 0x16, 0x68, 0x00, 0x6E, 0x35, 0x00,
+    0x08, 0x00, 0x61, 0x65, 0x69, 0x73, 0x74, 0x75, 0x79, 0x7A, 0x8E, 0x47, 0x00, 0x1C, 0x68, 0x00,
+    0x24, 0x68, 0x00, 0x38, 0x68, 0x00, 0x40, 0x68, 0x00, 0x4E, 0x2F, 0x00, 0xFC, 0x39, 0x00, 0xFC,
+    0x39, 0x00, 0x03, 0x00, 0x72, 0x73, 0x75, 0xD0, 0x43, 0x00, 0x26, 0x0E, 0x00, 0x74, 0x0A, 0x00,
+    0x05, 0x00, 0x65, 0x69, 0x6C, 0x70, 0x74, 0x4A, 0x68, 0x00, 0x52, 0x68, 0x00, 0x84, 0x14, 0x00,
+    0x5C, 0x68, 0x00, 0x64, 0x68, 0x00, 0x0E, 0x00, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x69, 0x6C,
+    0x6E, 0x6F, 0x70, 0x73, 0x74, 0x75, 0x6E, 0x68, 0x00, 0x60, 0x2B, 0x00, 0x4E, 0x2F, 0x00, 0x02,
+    0x33, 0x00, 0x72, 0x2E, 0x00, 0x82, 0x68, 0x00, 0x8C, 0x68, 0x00, 0xA6, 0x68, 0x00, 0x44, 0x19,
+    0x00, 0xD8, 0x44, 0x00, 0xAE, 0x68, 0x00, 0x8A, 0x3A, 0x00, 0xB8, 0x68, 0x00, 0x84, 0x14, 0x00,
+    0x09, 0x01, 0x11, 0x00, 0x61, 0x63, 0x65, 0x69, 0x6C, 0x70, 0x73, 0x74, 0x75, 0xC6, 0x68, 0x00,
+    0xD4, 0x68, 0x00, 0xDC, 0x68, 0x00, 0xE6, 0x68, 0x00, 0x94, 0x32, 0x00, 0x02, 0x33, 0x00, 0xE2,
+    0x36, 0x00, 0xF0, 0x68, 0x00, 0xFA, 0x68, 0x00, 0x06, 0x00, 0x61, 0x65, 0x69, 0x6C, 0x6F, 0x73,
+    0x02, 0x69, 0x00, 0x0C, 0x69, 0x00, 0x1A, 0x69, 0x00, 0x32, 0x69, 0x00, 0x36, 0x69, 0x00, 0x4E,
+    0x2F, 0x00, 0x01, 0x01, 0x10, 0x00, 0x6D, 0x9C, 0x0C, 0x00, 0x01, 0x00, 0x75, 0x80, 0x2F, 0x00,
+    0x01, 0x00, 0x65, 0x9C, 0x0C, 0x00, 0x0B, 0x01, 0x07, 0x00, 0x2E, 0x62, 0x63, 0x67, 0x6C, 0x6D,
+    0x6E, 0x70, 0x72, 0x74, 0x75, 0x3A, 0x2E, 0x00, 0x4C, 0x69, 0x00, 0x50, 0x69, 0x00, 0x5A, 0x69,
+    0x00, 0x66, 0x69, 0x00, 0xA2, 0x37, 0x00, 0x74, 0x69, 0x00, 0x48, 0x4B, 0x00, 0x7A, 0x69, 0x00,
+    0x80, 0x69, 0x00, 0x88, 0x69, 0x00, 0x08, 0x00, 0x2E, 0x64, 0x67, 0x6C, 0x6E, 0x72, 0x73, 0x74,
+    0xE6, 0x0A, 0x00, 0xE6, 0x0A, 0x00, 0x80, 0x2F, 0x00, 0x8E, 0x69, 0x00, 0xA0, 0x69, 0x00, 0xAA,
+    0x69, 0x00, 0xC4, 0x69, 0x00, 0xD0, 0x69, 0x00, 0x0D, 0x00, 0x61, 0x64, 0x66, 0x67, 0x6B, 0x6C,
+    0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x76, 0xDA, 0x69, 0x00, 0xE4, 0x69, 0x00, 0x84, 0x14, 0x00,
+    0x36, 0x47, 0x00, 0x4E, 0x2F, 0x00, 0xEE, 0x69, 0x00, 0xF6, 0x69, 0x00, 0x0A, 0x6A, 0x00, 0x9C,
+    0x0C, 0x00, 0xA2, 0x37, 0x00, 0x18, 0x6A, 0x00, 0x26, 0x6A, 0x00, 0x34, 0x6A, 0x00, 0x07, 0x00,
+    0x2E, 0x69, 0x6B, 0x6C, 0x6D, 0x72, 0x74, 0x3A, 0x2E, 0x00, 0x3C, 0x6A, 0x00, 0x4C, 0x38, 0x00,
+    0x48, 0x6A, 0x00, 0xEE, 0x36, 0x00, 0x5A, 0x6A, 0x00, 0x68, 0x6A, 0x00, 0x00, 0x02, 0x45, 0x00,
+    0x00, 0x01, 0x05, 0x00, 0x0A, 0x00, 0x62, 0x63, 0x67, 0x69, 0x6C, 0x6D, 0x72, 0x73, 0x74, 0x76,
+    0x72, 0x6A, 0x00, 0x72, 0x0C, 0x00, 0x78, 0x6A, 0x00, 0xAA, 0x4D, 0x00, 0x82, 0x6A, 0x00, 0x4E,
+    0x2F, 0x00, 0x2E, 0x2F, 0x00, 0x88, 0x6A, 0x00, 0x8E, 0x6A, 0x00, 0x94, 0x6A, 0x00, 0x07, 0x00,
+    0x61, 0x64, 0x65, 0x6C, 0x72, 0x73, 0x76, 0x9A, 0x6A, 0x00, 0x86, 0x3F, 0x00, 0xA4, 0x6A, 0x00,
+    0x7C, 0x55, 0x00, 0x74, 0x0A, 0x00, 0xFE, 0x30, 0x00, 0x84, 0x14, 0x00, 0x01, 0x00, 0x69, 0x4E,
+    0x2F, 0x00, 0x07, 0x01, 0x1E, 0x00, 0x64, 0x6C, 0x6E, 0x72, 0x73, 0x74, 0x7A, 0xB2, 0x6A, 0x00,
+    0xB8, 0x6A, 0x00, 0xC0, 0x6A, 0x00, 0x4E, 0x2F, 0x00, 0xCA, 0x6A, 0x00, 0xF8, 0x30, 0x00, 0x32,
+    0x3B, 0x00, 0x02, 0x00, 0x65, 0x69, 0xD0, 0x6A, 0x00, 0x3A, 0x45, 0x00, 0x01, 0x00, 0x6F, 0x10,
+    0x2C, 0x00, 0x03, 0x02, 0x3A, 0x00, 0x6B, 0x6D, 0x76, 0xD6, 0x6A, 0x00, 0x10, 0x46, 0x00, 0xDC,
+    0x6A, 0x00, 0x02, 0x00, 0x61, 0x69, 0xE2, 0x6A, 0x00, 0xEA, 0x6A, 0x00, 0x04, 0x00, 0x68, 0x6C,
+    0x70, 0x74, 0x84, 0x14, 0x00, 0x9C, 0x0C, 0x00, 0x60, 0x2B, 0x00, 0xF2, 0x6A, 0x00, 0x05, 0x01,
+    0x12, 0x00, 0x63, 0x67, 0x6D, 0x70, 0x73, 0x30, 0x4B, 0x00, 0x8C, 0x2C, 0x00, 0x80, 0x2F, 0x00,
+    0x10, 0x2C, 0x00, 0x32, 0x3B, 0x00, 0x00, 0x02, 0x1A, 0x00, 0x03, 0x01, 0x12, 0x00, 0x63, 0x64,
+    0x72, 0xF6, 0x6A, 0x00, 0xC6, 0x34, 0x00, 0xFC, 0x6A, 0x00, 0x02, 0x01, 0x12, 0x00, 0x69, 0x75,
+    0x06, 0x6B, 0x00, 0x4E, 0x2F, 0x00, 0x04, 0x01, 0x10, 0x00, 0x61, 0x63, 0x64, 0x6D, 0xFC, 0x39,
+    0x00, 0xFC, 0x39, 0x00, 0x48, 0x4B, 0x00, 0x0E, 0x6B, 0x00, 0x01, 0x01, 0x10, 0x00, 0x62, 0x10,
+    0x2C, 0x00, 0x02, 0x01, 0x10, 0x00, 0x61, 0x65, 0x18, 0x6B, 0x00, 0x1E, 0x6B, 0x00, 0x01, 0x01,
+    0x12, 0x00, 0x75, 0x28, 0x6B, 0x00, 0x01, 0x02, 0x32, 0x00, 0x69, 0x84, 0x14, 0x00, 0x01, 0x01,
+    0x12, 0x00, 0x61, 0x72, 0x35, 0x00, 0x03, 0x00, 0x63, 0x72, 0x74, 0x26, 0x0E, 0x00, 0x2E, 0x6B,
+    0x00, 0x26, 0x0E, 0x00, 0x03, 0x01, 0x12, 0x00, 0x65, 0x68, 0x6F, 0x32, 0x6B, 0x00, 0x3A, 0x6B,
+    0x00, 0x42, 0x6B, 0x00, 0x04, 0x00, 0x65, 0x72, 0x73, 0x74, 0x26, 0x0E, 0x00, 0x4C, 0x6B, 0x00,
+    0x54, 0x6B, 0x00, 0x9C, 0x0C, 0x00, 0x01, 0x00, 0x69, 0x26, 0x0E, 0x00, 0x04, 0x00, 0x61, 0x6C,
+    0x6F, 0x75, 0x84, 0x14, 0x00, 0x0E, 0x55, 0x00, 0x84, 0x14, 0x00, 0x26, 0x0E, 0x00, 0x03, 0x00,
+    0x62, 0x65, 0x70, 0x5C, 0x6B, 0x00, 0x62, 0x6B, 0x00, 0x6A, 0x6B, 0x00, 0x05, 0x00, 0x63, 0x64,
+    0x67, 0x69, 0x78, 0xF4, 0x52, 0x00, 0xFC, 0x39, 0x00, 0xFC, 0x39, 0x00, 0x18, 0x66, 0x00, 0x3A,
+    0x2E, 0x00, 0x05, 0x02, 0x20, 0x00, 0x64, 0x67, 0x6D, 0x6E, 0x73, 0xFC, 0x39, 0x00, 0x70, 0x6B,
+    0x00, 0x4E, 0x2F, 0x00, 0x74, 0x6B, 0x00, 0x10, 0x2C, 0x00, 0x05, 0x00, 0x65, 0x69, 0x6F, 0x74,
+    0x75, 0x7E, 0x6B, 0x00, 0x72, 0x35, 0x00, 0x88, 0x6B, 0x00, 0x90, 0x6B, 0x00, 0x26, 0x0E, 0x00,
+    0x04, 0x00, 0x61, 0x69, 0x6F, 0x72, 0x96, 0x6B, 0x00, 0x5E, 0x46, 0x00, 0x84, 0x14, 0x00, 0x9C,
+    0x0C, 0x00, 0x07, 0x00, 0x63, 0x65, 0x69, 0x6F, 0x73, 0x74, 0x75, 0x9C, 0x0C, 0x00, 0xD6, 0x2C,
+    0x00, 0x9C, 0x6B, 0x00, 0x10, 0x2C, 0x00, 0x4E, 0x2F, 0x00, 0xAA, 0x6B, 0x00, 0x52, 0x2F, 0x00,
+    0x02, 0x00, 0x68, 0x69, 0xB6, 0x6B, 0x00, 0xBC, 0x6B, 0x00, 0x02, 0x01, 0x14, 0x00, 0x62, 0x72,
+    0xAC, 0x0F, 0x00, 0x58, 0x2F, 0x00, 0x04, 0x01, 0x11, 0x00, 0x6E, 0x70, 0x72, 0x74, 0x9C, 0x0C,
+    0x00, 0x9C, 0x0C, 0x00, 0xC2, 0x6B, 0x00, 0x4E, 0x2F, 0x00, 0x03, 0x02, 0x0E, 0x00, 0x61, 0x6C,
+    0x73, 0xCA, 0x6B, 0x00, 0x10, 0x2C, 0x00, 0x10, 0x2C, 0x00, 0x00, 0x01, 0x0D, 0x00, 0x03, 0x01,
+    0x07, 0x00, 0x6D, 0x6F, 0x70, 0x9C, 0x0C, 0x00, 0xE2, 0x36, 0x00, 0xD0, 0x6B, 0x00, 0x02, 0x03,
+    0x00, 0x00, 0x77, 0x79, 0xD6, 0x6B, 0x00, 0x10, 0x2C, 0x00, 0x01, 0x00, 0x68, 0xDA, 0x6B, 0x00,
+    0x01, 0x00, 0x64, 0xE8, 0x36, 0x00, 0x01, 0x00, 0x74, 0x10, 0x46, 0x00, 0x01, 0x00, 0x74, 0x80,
+    0x2F, 0x00, 0x01, 0x00, 0x61, 0xDE, 0x6B, 0x00, 0x04, 0x00, 0x63, 0x67, 0x69, 0x74, 0x32, 0x3B,
+    0x00, 0xDA, 0x6B, 0x00, 0xE4, 0x6B, 0x00, 0xEA, 0x6B, 0x00, 0x02, 0x00, 0x73, 0x74, 0x32, 0x3B,
+    0x00, 0xF6, 0x6B, 0x00, 0x04, 0x00, 0x63, 0x70, 0x73, 0x74, 0x80, 0x2F, 0x00, 0x10, 0x46, 0x00,
+    0x10, 0x46, 0x00, 0x00, 0x6C, 0x00, 0x01, 0x00, 0x6F, 0x06, 0x6C, 0x00, 0x01, 0x00, 0x64, 0x10,
+    0x46, 0x00, 0x01, 0x00, 0x6E, 0xDA, 0x6B, 0x00, 0x03, 0x00, 0x67, 0x6E, 0x73, 0x4E, 0x2F, 0x00,
+    0xFC, 0x31, 0x00, 0x30, 0x41, 0x00, 0x02, 0x00, 0x72, 0x73, 0x0C, 0x6C, 0x00, 0x14, 0x6C, 0x00,
+    0x01, 0x00, 0x69, 0x1E, 0x6C, 0x00, 0x01, 0x00, 0x74, 0x22, 0x6C, 0x00, 0x05, 0x00, 0x6D, 0x6E,
+    0x70, 0x72, 0x74, 0x28, 0x6C, 0x00, 0x2E, 0x6C, 0x00, 0x34, 0x6C, 0x00, 0x3A, 0x6C, 0x00, 0x4E,
+    0x2F, 0x00, 0x01, 0x00, 0x6C, 0x48, 0x39, 0x00, 0x01, 0x01, 0x06, 0x00, 0x69, 0x40, 0x6C, 0x00,
+    0x01, 0x01, 0x15, 0x00, 0x74, 0xA2, 0x52, 0x00, 0x03, 0x00, 0x65, 0x6E, 0x72, 0x80, 0x2F, 0x00,
+    0x46, 0x6C, 0x00, 0x4C, 0x6C, 0x00, 0x04, 0x00, 0x6D, 0x6F, 0x72, 0x73, 0x54, 0x6C, 0x00, 0x80,
+    0x2F, 0x00, 0x5A, 0x6C, 0x00, 0x64, 0x6C, 0x00, 0x01, 0x00, 0x63, 0x6A, 0x6C, 0x00, 0x01, 0x00,
+    0x74, 0x4E, 0x2F, 0x00, 0x01, 0x00, 0x69, 0x70, 0x6C, 0x00, 0x02, 0x00, 0x63, 0x6D, 0x4E, 0x2F,
+    0x00, 0x76, 0x6C, 0x00, 0x02, 0x00, 0x72, 0x73, 0x7C, 0x6C, 0x00, 0x82, 0x6C, 0x00, 0x00, 0x01,
+    0x06, 0x00, 0x01, 0x00, 0x72, 0xDA, 0x6B, 0x00, 0x00, 0x01, 0x15, 0x00, 0x02, 0x00, 0x64, 0x65,
+    0x32, 0x3B, 0x00, 0x66, 0x5B, 0x00, 0x03, 0x00, 0x61, 0x67, 0x73, 0x88, 0x6C, 0x00, 0x80, 0x2F,
+    0x00, 0x80, 0x2F, 0x00, 0x01, 0x00, 0x75, 0x8E, 0x6C, 0x00, 0x01, 0x00, 0x72, 0x5C, 0x2C, 0x00,
+    0x00, 0x01, 0x34, 0x00, 0x01, 0x00, 0x68, 0x94, 0x6C, 0x00, 0x01, 0x01, 0x34, 0x00, 0x6C, 0xE8,
+    0x36, 0x00, 0x01, 0x01, 0x15, 0x00, 0x65, 0x9A, 0x6C, 0x00, 0x01, 0x00, 0x65, 0xA0, 0x6C, 0x00,
+    0x01, 0x00, 0x73, 0xA4, 0x6C, 0x00, 0x01, 0x00, 0x72, 0xA8, 0x6C, 0x00, 0x01, 0x01, 0x15, 0x00,
+    0x73, 0xAE, 0x6C, 0x00, 0x02, 0x01, 0x15, 0x00, 0x6E, 0x6F, 0xB4, 0x6C, 0x00, 0xBA, 0x6C, 0x00,
+    0x02, 0x00, 0x61, 0x62, 0x32, 0x3B, 0x00, 0x4E, 0x2F, 0x00, 0x01, 0x00, 0x72, 0x4E, 0x2F, 0x00,
+    0x01, 0x00, 0x6E, 0xC8, 0x6C, 0x00, 0x05, 0x01, 0x15, 0x00, 0x6D, 0x70, 0x72, 0x73, 0x74, 0xD2,
+    0x6C, 0x00, 0xD8, 0x6C, 0x00, 0xDE, 0x6C, 0x00, 0xA4, 0x6C, 0x00, 0xA4, 0x6C, 0x00, 0x02, 0x00,
+    0x62, 0x65, 0x80, 0x2F, 0x00, 0x34, 0x30, 0x00, 0x02, 0x00, 0x6E, 0x76, 0xE4, 0x6C, 0x00, 0xA0,
+    0x6C, 0x00, 0x02, 0x00, 0x6C, 0x6F, 0x4E, 0x2F, 0x00, 0xEE, 0x6C, 0x00, 0x02, 0x00, 0x6D, 0x70,
+    0x80, 0x2F, 0x00, 0xF4, 0x6C, 0x00, 0x05, 0x01, 0x3E, 0x00, 0x63, 0x65, 0x6B, 0x73, 0x75, 0xAC,
+    0x35, 0x00, 0x1E, 0x6C, 0x00, 0x58, 0x2F, 0x00, 0x80, 0x2F, 0x00, 0xFA, 0x6C, 0x00, 0x01, 0x00,
+    0x72, 0x32, 0x3B, 0x00, 0x01, 0x00, 0x72, 0x80, 0x2F, 0x00, 0x01, 0x00, 0x6C, 0x00, 0x6D, 0x00,
+    0x01, 0x00, 0x72, 0x06, 0x6D, 0x00, 0x03, 0x00, 0x63, 0x6D, 0x74, 0x0C, 0x6D, 0x00, 0x4E, 0x2F,
+    0x00, 0x12, 0x6D, 0x00, 0x05, 0x01, 0x15, 0x00, 0x67, 0x69, 0x6E, 0x70, 0x76, 0x9A, 0x2F, 0x00,
+    0x1C, 0x6D, 0x00, 0xDA, 0x6B, 0x00, 0xA0, 0x6C, 0x00, 0x22, 0x6D, 0x00, 0x04, 0x00, 0x67, 0x6E,
+    0x6F, 0x74, 0x26, 0x6D, 0x00, 0x58, 0x2F, 0x00, 0x80, 0x2F, 0x00, 0x4E, 0x2F, 0x00, 0x04, 0x00,
+    0x67, 0x6C, 0x6E, 0x72, 0x2E, 0x6D, 0x00, 0x34, 0x6D, 0x00, 0x42, 0x39, 0x00, 0x3A, 0x6D, 0x00,
+    0x03, 0x01, 0x15, 0x00, 0x67, 0x72, 0x74, 0x40, 0x6D, 0x00, 0x46, 0x6D, 0x00, 0x4C, 0x6D, 0x00,
+    0x02, 0x00, 0x6D, 0x73, 0x56, 0x6D, 0x00, 0x5C, 0x6D, 0x00, 0x02, 0x00, 0x6E, 0x72, 0xF6, 0x31,
+    0x00, 0x3E, 0x4D, 0x00, 0x01, 0x00, 0x74, 0x68, 0x6D, 0x00, 0x01, 0x00, 0x6F, 0x6E, 0x6D, 0x00,
+    0x01, 0x00, 0x63, 0x4E, 0x2F, 0x00, 0x02, 0x00, 0x65, 0x6E, 0x74, 0x6D, 0x00, 0x7A, 0x6D, 0x00,
+    0x01, 0x01, 0x15, 0x00, 0x64, 0xA0, 0x6C, 0x00, 0x01, 0x00, 0x74, 0x30, 0x4B, 0x00, 0x04, 0x00,
+    0x61, 0x63, 0x64, 0x74, 0x80, 0x6D, 0x00, 0x80, 0x2F, 0x00, 0x10, 0x46, 0x00, 0x80, 0x2F, 0x00,
+    0x01, 0x01, 0x34, 0x00, 0x74, 0x7C, 0x55, 0x00, 0x01, 0x00, 0x68, 0xA4, 0x6C, 0x00, 0x01, 0x00,
+    0x74, 0xA4, 0x6C, 0x00, 0x02, 0x00, 0x64, 0x74, 0x86, 0x6D, 0x00, 0x8C, 0x6D, 0x00, 0x03, 0x00,
+    0x65, 0x6F, 0x74, 0x4E, 0x2F, 0x00, 0x96, 0x6D, 0x00, 0x58, 0x2F, 0x00, 0x02, 0x00, 0x6C, 0x73,
+    0x9C, 0x6D, 0x00, 0xA2, 0x6D, 0x00, 0x01, 0x00, 0x65, 0xA8, 0x6D, 0x00, 0x04, 0x00, 0x63, 0x6E,
+    0x74, 0x76, 0x4E, 0x2F, 0x00, 0x8E, 0x47, 0x00, 0xB2, 0x6D, 0x00, 0xB8, 0x6D, 0x00, 0x03, 0x00,
+    0x65, 0x6D, 0x73, 0xBE, 0x6D, 0x00, 0xC6, 0x6D, 0x00, 0xCC, 0x6D, 0x00, 0x02, 0x00, 0x67, 0x74,
+    0x4E, 0x2F, 0x00, 0x34, 0x45, 0x00, 0x03, 0x00, 0x71, 0x73, 0x77, 0x4E, 0x2F, 0x00, 0xAA, 0x4D,
+    0x00, 0x46, 0x4F, 0x00, 0x01, 0x00, 0x64, 0x4E, 0x2F, 0x00, 0x01, 0x00, 0x69, 0xF6, 0x31, 0x00,
+    0x04, 0x00, 0x6C, 0x6D, 0x6E, 0x72, 0xD4, 0x6D, 0x00, 0xDE, 0x6D, 0x00, 0x58, 0x2F, 0x00, 0xE4,
+    0x6D, 0x00, 0x01, 0x01, 0x15, 0x00, 0x6E, 0xEA, 0x6D, 0x00, 0x02, 0x00, 0x68, 0x69, 0xF0, 0x6D,
+    0x00, 0xF6, 0x6D, 0x00, 0x01, 0x01, 0x06, 0x00, 0x61, 0xFC, 0x6D, 0x00, 0x01, 0x01, 0x06, 0x00,
+    0x70, 0x02, 0x6E, 0x00, 0x02, 0x01, 0x06, 0x00, 0x6C, 0x6E, 0x08, 0x6E, 0x00, 0x0E, 0x6E, 0x00,
+    0x03, 0x01, 0x15, 0x00, 0x6C, 0x6D, 0x6E, 0xDA, 0x6B, 0x00, 0x14, 0x6E, 0x00, 0x1A, 0x6E, 0x00,
+    0x04, 0x00, 0x6E, 0x70, 0x71, 0x75, 0x9E, 0x67, 0x00, 0x24, 0x6E, 0x00, 0x58, 0x2F, 0x00, 0x30,
+    0x6E, 0x00, 0x01, 0x00, 0x69, 0x36, 0x6E, 0x00, 0x07, 0x00, 0x61, 0x63, 0x64, 0x65, 0x6B, 0x6F,
+    0x75, 0x3C, 0x6E, 0x00, 0x44, 0x6E, 0x00, 0x00, 0x6C, 0x00, 0x4A, 0x6E, 0x00, 0x32, 0x3B, 0x00,
+    0x32, 0x3B, 0x00, 0x80, 0x2F, 0x00, 0x01, 0x00, 0x65, 0xA4, 0x6C, 0x00, 0x01, 0x00, 0x61, 0x32,
+    0x3B, 0x00, 0x02, 0x00, 0x6E, 0x72, 0x52, 0x6E, 0x00, 0xFC, 0x31, 0x00, 0x01, 0x00, 0x63, 0x58,
+    0x6E, 0x00, 0x01, 0x00, 0x62, 0x5E, 0x6E, 0x00, 0x01, 0x00, 0x6C, 0x64, 0x6E, 0x00, 0x02, 0x00,
+    0x6C, 0x6E, 0x26, 0x0E, 0x00, 0x26, 0x0E, 0x00, 0x01, 0x01, 0x15, 0x00, 0x72, 0xEA, 0x4F, 0x00,
+    0x02, 0x00, 0x61, 0x74, 0x32, 0x3B, 0x00, 0x6A, 0x6E, 0x00, 0x01, 0x00, 0x61, 0xE4, 0x58, 0x00,
+    0x01, 0x00, 0x6C, 0x70, 0x6E, 0x00, 0x01, 0x01, 0x0C, 0x00, 0x6F, 0x6A, 0x3A, 0x00, 0x01, 0x00,
+    0x6C, 0x72, 0x35, 0x00, 0x02, 0x00, 0x62, 0x72, 0x76, 0x6E, 0x00, 0x7C, 0x6E, 0x00, 0x02, 0x00,
+    0x6F, 0x72, 0x74, 0x46, 0x00, 0x02, 0x33, 0x00, 0x01, 0x00, 0x65, 0x10, 0x41, 0x00, 0x03, 0x02,
+    0x11, 0x02, 0x65, 0x6E, 0x6F, 0x84, 0x14, 0x00, 0x02, 0x33, 0x00, 0x84, 0x14, 0x00, 0x01, 0x00,
+    0x6F, 0xFE, 0x67, 0x00, 0x01, 0x00, 0x69, 0x88, 0x6E, 0x00, 0x02, 0x00, 0x6C, 0x6D, 0x72, 0x35,
+    0x00, 0x9C, 0x0C, 0x00, 0x01, 0x00, 0x69, 0x8E, 0x6E, 0x00, 0x01, 0x00, 0x72, 0x94, 0x6E, 0x00,
+    0x06, 0x01, 0x11, 0x00, 0x61, 0x63, 0x65, 0x6F, 0x74, 0x75, 0x84, 0x14, 0x00, 0xEE, 0x42, 0x00,
+    0xCA, 0x2F, 0x00, 0x84, 0x14, 0x00, 0x84, 0x14, 0x00, 0x26, 0x0E, 0x00, 0x01, 0x00, 0x77, 0x72,
+    0x35, 0x00, 0x01, 0x00, 0x61, 0x36, 0x47, 0x00, 0x01, 0x00, 0x75, 0x9C, 0x0C, 0x00, 0x02, 0x01,
+    0x0C, 0x00, 0x63, 0x6D, 0x84, 0x14, 0x00, 0xFC, 0x39, 0x00, 0x01, 0x01, 0x0B, 0x00, 0x69, 0x30,
+    0x41, 0x00, 0x01, 0x01, 0x06, 0x00, 0x69, 0x9A, 0x6E, 0x00, 0x02, 0x00, 0x62, 0x6E, 0x10, 0x2C,
+    0x00, 0x4E, 0x2F, 0x00, 0x03, 0x00, 0x6C, 0x6F, 0x75, 0xE2, 0x36, 0x00, 0x4E, 0x2F, 0x00, 0xE6,
+    0x0A, 0x00, 0x00, 0x01, 0x14, 0x00, 0x02, 0x01, 0x2E, 0x00, 0x67, 0x6E, 0x4C, 0x38, 0x00, 0xA4,
+    0x38, 0x00, 0x02, 0x00, 0x65, 0x6C, 0xFA, 0x53, 0x00, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x2E, 0x84,
+    0x14, 0x00, 0x01, 0x00, 0x79, 0xFC, 0x39, 0x00, 0x02, 0x02, 0x70, 0x01, 0x69, 0x6F, 0x12, 0x4D,
+    0x00, 0x32, 0x3B, 0x00, 0x01, 0x00, 0x65, 0x12, 0x4D, 0x00, 0x01, 0x00, 0x6E, 0x02, 0x33, 0x00,
+    0x03, 0x00, 0x62, 0x64, 0x72, 0xFC, 0x39, 0x00, 0x72, 0x35, 0x00, 0x10, 0x2C, 0x00, 0x01, 0x00,
+    0x69, 0xE6, 0x0A, 0x00, 0x02, 0x01, 0x11, 0x00, 0x6E, 0x6F, 0xA0, 0x6E, 0x00, 0xAA, 0x6E, 0x00,
+    0x02, 0x01, 0x14, 0x00, 0x61, 0x65, 0xAE, 0x6E, 0x00, 0x4E, 0x2F, 0x00, 0x02, 0x00, 0x65, 0x69,
+    0xB4, 0x6E, 0x00, 0xBA, 0x6E, 0x00, 0x01, 0x00, 0x67, 0x82, 0x6A, 0x00, 0x04, 0x00, 0x2E, 0x73,
+    0x74, 0x7A, 0x10, 0x2C, 0x00, 0xC0, 0x6E, 0x00, 0x3A, 0x2E, 0x00, 0x4C, 0x38, 0x00, 0x05, 0x01,
+    0x0C, 0x00, 0x62, 0x67, 0x72, 0x73, 0x74, 0xFC, 0x39, 0x00, 0x72, 0x35, 0x00, 0xFC, 0x31, 0x00,
+    0x18, 0x66, 0x00, 0xC8, 0x6E, 0x00, 0x02, 0x00, 0x6E, 0x72, 0xD2, 0x6E, 0x00, 0x5E, 0x46, 0x00,
+    0x04, 0x00, 0x63, 0x66, 0x6C, 0x6E, 0x72, 0x35, 0x00, 0xFC, 0x39, 0x00, 0x22, 0x33, 0x00, 0xD8,
+    0x6E, 0x00, 0x02, 0x01, 0x2E, 0x00, 0x6E, 0x72, 0x26, 0x0E, 0x00, 0x64, 0x6E, 0x00, 0x04, 0x00,
+    0x67, 0x6C, 0x72, 0x74, 0xB2, 0x38, 0x00, 0xE0, 0x6E, 0x00, 0xE6, 0x6E, 0x00, 0xF2, 0x6E, 0x00,
+    0x04, 0x01, 0x0C, 0x00, 0x65, 0x69, 0x6C, 0x6F, 0xD8, 0x44, 0x00, 0xF0, 0x45, 0x00, 0x02, 0x33,
+    0x00, 0xD0, 0x40, 0x00, 0x04, 0x00, 0x65, 0x6E, 0x73, 0x75, 0x26, 0x0E, 0x00, 0x84, 0x14, 0x00,
+    0xF8, 0x6E, 0x00, 0x84, 0x14, 0x00, 0x02, 0x01, 0x11, 0x00, 0x69, 0x6C, 0x30, 0x4B, 0x00, 0x02,
+    0x33, 0x00, 0x0A, 0x00, 0x63, 0x65, 0x66, 0x6D, 0x6E, 0x6F, 0x70, 0x73, 0x74, 0x75, 0x32, 0x69,
+    0x00, 0xFE, 0x6E, 0x00, 0x04, 0x6F, 0x00, 0x04, 0x55, 0x00, 0x52, 0x43, 0x00, 0x72, 0x35, 0x00,
+    0x84, 0x14, 0x00, 0x08, 0x6F, 0x00, 0x72, 0x35, 0x00, 0x84, 0x14, 0x00, 0x01, 0x00, 0x6C, 0xEA,
+    0x39, 0x00, 0x01, 0x00, 0x69, 0x0E, 0x6F, 0x00, 0x02, 0x01, 0x06, 0x00, 0x61, 0x74, 0x14, 0x6F,
+    0x00, 0x1A, 0x6F, 0x00, 0x08, 0x00, 0x61, 0x63, 0x67, 0x6E, 0x70, 0x74, 0x75, 0x76, 0x6E, 0x35,
+    0x00, 0x44, 0x19, 0x00, 0x2E, 0x30, 0x00, 0x9C, 0x0C, 0x00, 0x22, 0x6F, 0x00, 0x9C, 0x0C, 0x00,
+    0x0E, 0x52, 0x00, 0x80, 0x2F, 0x00, 0x05, 0x00, 0x61, 0x69, 0x6F, 0x72, 0x77, 0x2A, 0x6F, 0x00,
+    0x30, 0x6F, 0x00, 0xE6, 0x0A, 0x00, 0x6E, 0x35, 0x00, 0x9C, 0x0C, 0x00, 0x03, 0x00, 0x61, 0x6C,
+    0x72, 0x72, 0x35, 0x00, 0x72, 0x35, 0x00, 0x26, 0x0E, 0x00, 0x02, 0x00, 0x72, 0x74, 0xDA, 0x6B,
+    0x00, 0xFC, 0x39, 0x00, 0x02, 0x00, 0x61, 0x72, 0x42, 0x6F, 0x00, 0xA2, 0x37, 0x00, 0x02, 0x00,
+    0x65, 0x69, 0x0A, 0x53, 0x00, 0xE6, 0x0A, 0x00, 0x03, 0x00, 0x6C, 0x6E, 0x74, 0x48, 0x6F, 0x00,
+    0x72, 0x35, 0x00, 0x4E, 0x6F, 0x00, 0x00, 0x01, 0x2E, 0x00, 0x04, 0x00, 0x63, 0x6C, 0x72, 0x73,
+    0xA0, 0x6C, 0x00, 0x5E, 0x46, 0x00, 0x64, 0x6E, 0x00, 0xFE, 0x30, 0x00, 0x01, 0x00, 0x65, 0xC4,
+    0x46, 0x00, 0x0A, 0x00, 0x63, 0x64, 0x6C, 0x6D, 0x6E, 0x70, 0x74, 0x75, 0x76, 0x77, 0x58, 0x6F,
+    0x00, 0x5E, 0x6F, 0x00, 0x72, 0x35, 0x00, 0x68, 0x6F, 0x00, 0x6E, 0x6F, 0x00, 0x80, 0x2F, 0x00,
+    0x74, 0x6F, 0x00, 0x26, 0x0E, 0x00, 0x7C, 0x6F, 0x00, 0xDA, 0x6B, 0x00, 0x01, 0x00, 0x61, 0x2A,
+    0x6F, 0x00, 0x01, 0x00, 0x68, 0x80, 0x6F, 0x00, 0x02, 0x00, 0x69, 0x72, 0x8A, 0x6F, 0x00, 0x9C,
+    0x0C, 0x00, 0x04, 0x00, 0x61, 0x65, 0x6E, 0x73, 0x90, 0x6F, 0x00, 0x84, 0x14, 0x00, 0x58, 0x6F,
+    0x00, 0x02, 0x4D, 0x00, 0x02, 0x00, 0x69, 0x6C, 0x9C, 0x0C, 0x00, 0x9C, 0x0C, 0x00, 0x06, 0x01,
+    0x14, 0x00, 0x61, 0x65, 0x6D, 0x6E, 0x6F, 0x7A, 0x96, 0x6F, 0x00, 0xBC, 0x3D, 0x00, 0x9C, 0x0C,
+    0x00, 0x3A, 0x32, 0x00, 0x72, 0x35, 0x00, 0x6E, 0x35, 0x00, 0x01, 0x00, 0x69, 0x6E, 0x35, 0x00,
+    0x03, 0x00, 0x64, 0x6E, 0x6F, 0xA0, 0x6F, 0x00, 0x66, 0x2D, 0x00, 0x84, 0x14, 0x00, 0x00, 0x01,
+    0x1E, 0x00, 0x00, 0x01, 0x13, 0x00, 0x02, 0x00, 0x61, 0x65, 0xA4, 0x6F, 0x00, 0xDA, 0x6B, 0x00,
+    0x02, 0x00, 0x61, 0x68, 0x9C, 0x0C, 0x00, 0x6E, 0x35, 0x00, 0x02, 0x00, 0x62, 0x6E, 0x9C, 0x0C,
+    0x00, 0x58, 0x6F, 0x00, 0x01, 0x00, 0x69, 0xDA, 0x6B, 0x00, 0x04, 0x00, 0x61, 0x62, 0x63, 0x74,
+    0x82, 0x6A, 0x00, 0x84, 0x14, 0x00, 0x84, 0x14, 0x00, 0xAA, 0x6F, 0x00, 0x01, 0x00, 0x69, 0x80,
+    0x2F, 0x00, 0x01, 0x00, 0x63, 0x10, 0x2C, 0x00, 0x01, 0x00, 0x68, 0xFC, 0x39, 0x00, 0x01, 0x00,
+    0x68, 0x9C, 0x0C, 0x00, 0x02, 0x00, 0x65, 0x72, 0x3A, 0x45, 0x00, 0x02, 0x33, 0x00, 0x01, 0x00,
+    0x72, 0x42, 0x39, 0x00, 0x01, 0x00, 0x6D, 0xAE, 0x6F, 0x00, 0x04, 0x01, 0x2E, 0x00, 0x62, 0x63,
+    0x6C, 0x70, 0x4E, 0x32, 0x00, 0xFC, 0x39, 0x00, 0x00, 0x43, 0x00, 0xFC, 0x39, 0x00, 0x06, 0x00,
+    0x63, 0x67, 0x6E, 0x72, 0x73, 0x76, 0xB4, 0x6F, 0x00, 0x00, 0x43, 0x00, 0xBC, 0x6F, 0x00, 0xC2,
+    0x6F, 0x00, 0x58, 0x6F, 0x00, 0xFC, 0x39, 0x00, 0x02, 0x01, 0x0C, 0x00, 0x65, 0x6F, 0xCC, 0x6F,
+    0x00, 0xDA, 0x6F, 0x00, 0x07, 0x00, 0x2E, 0x61, 0x62, 0x63, 0x66, 0x6F, 0x74, 0xE6, 0x0A, 0x00,
+    0x26, 0x0E, 0x00, 0xA0, 0x6F, 0x00, 0x02, 0x33, 0x00, 0x72, 0x35, 0x00, 0xE2, 0x6F, 0x00, 0xE8,
+    0x6F, 0x00, 0x04, 0x00, 0x67, 0x6D, 0x70, 0x73, 0x10, 0x2C, 0x00, 0xEE, 0x6F, 0x00, 0x10, 0x2C,
+    0x00, 0x10, 0x2C, 0x00, 0x01, 0x01, 0x12, 0x00, 0x6F, 0xF6, 0x6F, 0x00, 0x01, 0x00, 0x6B, 0x9C,
+    0x0C, 0x00, 0x03, 0x00, 0x61, 0x65, 0x68, 0xFC, 0x6F, 0x00, 0x02, 0x70, 0x00, 0x9C, 0x0C, 0x00,
+    0x04, 0x01, 0x2E, 0x00, 0x61, 0x65, 0x6C, 0x72, 0xFC, 0x39, 0x00, 0xFC, 0x39, 0x00, 0x72, 0x35,
+    0x00, 0xEE, 0x42, 0x00, 0x02, 0x00, 0x68, 0x75, 0x0A, 0x70, 0x00, 0x72, 0x35, 0x00, 0x01, 0x02,
+    0xA0, 0x02, 0x69, 0x12, 0x70, 0x00, 0x01, 0x00, 0x64, 0x32, 0x3B, 0x00, 0x01, 0x00, 0x69, 0xFE,
+    0x67, 0x00, 0x02, 0x00, 0x65, 0x68, 0x12, 0x4D, 0x00, 0x02, 0x33, 0x00, 0x02, 0x01, 0x2E, 0x00,
+    0x67, 0x6E, 0x72, 0x35, 0x00, 0x26, 0x0E, 0x00, 0x02, 0x00, 0x6E, 0x72, 0x18, 0x70, 0x00, 0x1E,
+    0x70, 0x00, 0x03, 0x01, 0x14, 0x00, 0x65, 0x67, 0x6F, 0xCA, 0x2F, 0x00, 0x72, 0x35, 0x00, 0xE8,
+    0x6F, 0x00, 0x02, 0x00, 0x63, 0x72, 0xFC, 0x39, 0x00, 0x74, 0x0A, 0x00, 0x01, 0x00, 0x79, 0x4C,
+    0x38, 0x00, 0x01, 0x00, 0x79, 0x9C, 0x0C, 0x00, 0x02, 0x00, 0x63, 0x64, 0x9C, 0x0C, 0x00, 0x9C,
+    0x0C, 0x00, 0x01, 0x00, 0x6C, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x65, 0xCA, 0x2F, 0x00, 0x01, 0x00,
+    0x69, 0x32, 0x3B, 0x00, 0x01, 0x00, 0x6B, 0x2C, 0x70, 0x00, 0x01, 0x00, 0x67, 0x8A, 0x3A, 0x00,
+    0x01, 0x00, 0x61, 0x10, 0x46, 0x00, 0x03, 0x00, 0x64, 0x65, 0x69, 0x32, 0x70, 0x00, 0x4E, 0x2F,
+    0x00, 0x80, 0x2F, 0x00, 0x03, 0x00, 0x62, 0x69, 0x6F, 0x38, 0x70, 0x00, 0x9E, 0x67, 0x00, 0x3E,
+    0x70, 0x00, 0x01, 0x00, 0x73, 0x5C, 0x2C, 0x00, 0x01, 0x01, 0x07, 0x00, 0x68, 0x44, 0x70, 0x00,
+    0x01, 0x01, 0x2E, 0x00, 0x72, 0x84, 0x14, 0x00, 0x02, 0x00, 0x6E, 0x74, 0x48, 0x39, 0x00, 0x4E,
+    0x2F, 0x00, 0x02, 0x00, 0x6B, 0x74, 0xDA, 0x6B, 0x00, 0xA4, 0x6C, 0x00, 0x03, 0x02, 0x12, 0x01,
+    0x61, 0x65, 0x69, 0x72, 0x35, 0x00, 0x72, 0x35, 0x00, 0x72, 0x35, 0x00, 0x02, 0x00, 0x69, 0x75,
+    0x72, 0x35, 0x00, 0xFC, 0x39, 0x00, 0x02, 0x01, 0x07, 0x00, 0x69, 0x6F, 0x02, 0x33, 0x00, 0x72,
+    0x35, 0x00, 0x00, 0x02, 0x9E, 0x02, 0x02, 0x00, 0x69, 0x75, 0x6A, 0x3A, 0x00, 0xFC, 0x39, 0x00,
+    0x02, 0x02, 0x74, 0x00, 0x70, 0x74, 0x72, 0x35, 0x00, 0x0C, 0x4A, 0x00, 0x03, 0x01, 0x19, 0x00,
+    0x69, 0x72, 0x77, 0x4A, 0x70, 0x00, 0xFC, 0x39, 0x00, 0x72, 0x35, 0x00, 0x01, 0x00, 0x69, 0x04,
+    0x53, 0x00, 0x01, 0x00, 0x6F, 0xFC, 0x39, 0x00, 0x01, 0x01, 0x0B, 0x00, 0x69, 0x50, 0x70, 0x00,
+    0x02, 0x01, 0x19, 0x00, 0x6E, 0x72, 0xFC, 0x39, 0x00, 0x9C, 0x0C, 0x00, 0x02, 0x01, 0x07, 0x00,
+    0x69, 0x6C, 0x56, 0x70, 0x00, 0x5C, 0x70, 0x00, 0x03, 0x00, 0x61, 0x64, 0x65, 0x62, 0x70, 0x00,
+    0x4E, 0x2F, 0x00, 0xE4, 0x58, 0x00, 0x04, 0x00, 0x67, 0x6D, 0x72, 0x75, 0xD0, 0x4F, 0x00, 0x32,
+    0x3B, 0x00, 0x68, 0x70, 0x00, 0xFC, 0x39, 0x00, 0x04, 0x01, 0x1E, 0x00, 0x69, 0x72, 0x75, 0x7A,
+    0x72, 0x70, 0x00, 0x72, 0x35, 0x00, 0x7C, 0x70, 0x00, 0x26, 0x0E, 0x00, 0x02, 0x00, 0x6E, 0x74,
+    0x82, 0x70, 0x00, 0x88, 0x70, 0x00, 0x03, 0x00, 0x2E, 0x6E, 0x73, 0x10, 0x2C, 0x00, 0xDA, 0x6B,
+    0x00, 0x8E, 0x70, 0x00, 0x02, 0x00, 0x6E, 0x73, 0x82, 0x70, 0x00, 0x84, 0x14, 0x00, 0x01, 0x01,
+    0x05, 0x00, 0x6E, 0x94, 0x70, 0x00, 0x01, 0x00, 0x6E, 0x8E, 0x47, 0x00, 0x01, 0x00, 0x67, 0x32,
+    0x3B, 0x00, 0x01, 0x01, 0x19, 0x00, 0x69, 0x80, 0x2F, 0x00, 0x01, 0x00, 0x69, 0x80, 0x5B, 0x00,
+    0x01, 0x00, 0x62, 0x5C, 0x2C, 0x00, 0x01, 0x00, 0x61, 0x9A, 0x70, 0x00, 0x00, 0x01, 0x19, 0x00,
+    0x06, 0x00, 0x2E, 0x61, 0x64, 0x65, 0x69, 0x6E, 0x3A, 0x2E, 0x00, 0x3C, 0x0C, 0x00, 0x32, 0x3B,
+    0x00, 0x3A, 0x2E, 0x00, 0x3A, 0x2E, 0x00, 0xA2, 0x70, 0x00, 0x00, 0x02, 0x52, 0x01, 0x04, 0x00,
+    0x61, 0x68, 0x6F, 0x75, 0x26, 0x0E, 0x00, 0xA0, 0x6C, 0x00, 0x9C, 0x0C, 0x00, 0xA8, 0x70, 0x00,
+    0x01, 0x00, 0x6E, 0xAE, 0x70, 0x00, 0x01, 0x00, 0x74, 0xE6, 0x0A, 0x00, 0x01, 0x00, 0x74, 0xB4,
+    0x70, 0x00, 0x01, 0x00, 0x73, 0xBA, 0x70, 0x00, 0x01, 0x00, 0x66, 0xE8, 0x36, 0x00, 0x01, 0x00,
+    0x61, 0x9C, 0x0C, 0x00, 0x01, 0x00, 0x69, 0x72, 0x35, 0x00, 0x01, 0x01, 0x0B, 0x00, 0x74, 0x94,
+    0x35, 0x00, 0x01, 0x00, 0x65, 0x72, 0x35, 0x00, 0x03, 0x00, 0x69, 0x73, 0x74, 0xC0, 0x70, 0x00,
+    0xC6, 0x70, 0x00, 0x3A, 0x2E, 0x00, 0x05, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x74, 0xE6, 0x0A, 0x00,
+    0xD0, 0x70, 0x00, 0xD6, 0x70, 0x00, 0x26, 0x0E, 0x00, 0xDC, 0x70, 0x00, 0x02, 0x00, 0x69, 0x6C,
+    0xE2, 0x70, 0x00, 0x02, 0x33, 0x00, 0x01, 0x00, 0x65, 0xE8, 0x70, 0x00, 0x00, 0x02, 0x74, 0x00,
+    0x00, 0x02, 0xE2, 0x00, 0x03, 0x00, 0x61, 0x6C, 0x6F, 0x58, 0x6F, 0x00, 0xF2, 0x70, 0x00, 0xE6,
+    0x0A, 0x00, 0x05, 0x00, 0x64, 0x65, 0x69, 0x74, 0x79, 0x32, 0x3B, 0x00, 0x4E, 0x2F, 0x00, 0xFC,
+    0x70, 0x00, 0x0C, 0x6D, 0x00, 0xDA, 0x6B, 0x00, 0x01, 0x00, 0x65, 0x0C, 0x4A, 0x00, 0x01, 0x00,
+    0x6F, 0x96, 0x6B, 0x00, 0x02, 0x00, 0x74, 0x79, 0x0A, 0x71, 0x00, 0xE6, 0x0A, 0x00, 0x03, 0x00,
+    0x61, 0x68, 0x69, 0x14, 0x71, 0x00, 0x9C, 0x0C, 0x00, 0x1A, 0x71, 0x00, 0x01, 0x00, 0x61, 0x20,
+    0x71, 0x00, 0x01, 0x00, 0x61, 0xA0, 0x6C, 0x00, 0x01, 0x00, 0x61, 0x4E, 0x2F, 0x00, 0x03, 0x00,
+    0x6D, 0x6E, 0x75, 0x26, 0x71, 0x00, 0xDA, 0x6B, 0x00, 0xFE, 0x30, 0x00, 0x02, 0x00, 0x2E, 0x65,
+    0xE6, 0x0A, 0x00, 0x2C, 0x71, 0x00, 0x02, 0x00, 0x2E, 0x6C, 0x3A, 0x2E, 0x00, 0x4C, 0x38, 0x00,
+    0x04, 0x01, 0x07, 0x00, 0x63, 0x65, 0x69, 0x74, 0x4C, 0x38, 0x00, 0x32, 0x71, 0x00, 0xE6, 0x0A,
+    0x00, 0x4C, 0x38, 0x00, 0x01, 0x00, 0x61, 0xF4, 0x42, 0x00, 0x03, 0x00, 0x61, 0x73, 0x74, 0xE6,
+    0x0A, 0x00, 0x36, 0x71, 0x00, 0x32, 0x3B, 0x00, 0x01, 0x01, 0x06, 0x00, 0x61, 0xF2, 0x6A, 0x00,
+    0x02, 0x00, 0x62, 0x6E, 0xAE, 0x3E, 0x00, 0x3C, 0x71, 0x00, 0x06, 0x01, 0x15, 0x00, 0x61, 0x64,
+    0x6C, 0x6D, 0x6E, 0x72, 0x42, 0x71, 0x00, 0xE6, 0x0A, 0x00, 0x48, 0x71, 0x00, 0x4E, 0x71, 0x00,
+    0x0A, 0x3D, 0x00, 0x54, 0x71, 0x00, 0x05, 0x00, 0x65, 0x6E, 0x6F, 0x74, 0x7A, 0x5E, 0x71, 0x00,
+    0x64, 0x71, 0x00, 0x3A, 0x2E, 0x00, 0x4C, 0x38, 0x00, 0x58, 0x2F, 0x00, 0x00, 0x02, 0x87, 0x02,
+    0x02, 0x00, 0x2E, 0x68, 0xE6, 0x0A, 0x00, 0x5A, 0x2B, 0x00, 0x01, 0x00, 0x69, 0x9C, 0x0C, 0x00,
+    0x02, 0x01, 0x19, 0x00, 0x62, 0x72, 0x70, 0x71, 0x00, 0x32, 0x3B, 0x00, 0x00, 0x01, 0x0A, 0x00,
+    0x01, 0x00, 0x72, 0xE6, 0x0A, 0x00, 0x01, 0x00, 0x69, 0x74, 0x71, 0x00, 0x01, 0x00, 0x61, 0x7A,
+    0x71, 0x00, 0x02, 0x00, 0x61, 0x69, 0x9C, 0x0C, 0x00, 0x4C, 0x38, 0x00, 0x05, 0x01, 0x11, 0x00,
+    0x61, 0x65, 0x67, 0x6F, 0x71, 0x80, 0x71, 0x00, 0x66, 0x5B, 0x00, 0x88, 0x71, 0x00, 0x3A, 0x2E,
+    0x00, 0x58, 0x2F, 0x00, 0x03, 0x00, 0x65, 0x68, 0x69, 0xE6, 0x0A, 0x00, 0x72, 0x35, 0x00, 0xBA,
+    0x6E, 0x00, 0x01, 0x00, 0x74, 0x90, 0x71, 0x00, 0x01, 0x02, 0x0E, 0x00, 0x69, 0x9A, 0x71, 0x00,
+    0x01, 0x00, 0x72, 0xA0, 0x71, 0x00, 0x02, 0x00, 0x61, 0x6D, 0xCA, 0x2F, 0x00, 0x4E, 0x2F, 0x00,
+    0x02, 0x00, 0x63, 0x6D, 0xE6, 0x0A, 0x00, 0xDA, 0x6B, 0x00, 0x01, 0x00, 0x67, 0xFC, 0x39, 0x00,
+    0x01, 0x01, 0x11, 0x00, 0x72, 0x9C, 0x0C, 0x00, 0x01, 0x01, 0x06, 0x00, 0x6E, 0xBC, 0x6B, 0x00,
+    0x02, 0x00, 0x69, 0x6F, 0x32, 0x3B, 0x00, 0xAC, 0x71, 0x00, 0x01, 0x00, 0x65, 0x2E, 0x30, 0x00,
+    0x04, 0x00, 0x61, 0x65, 0x67, 0x74, 0x4E, 0x2F, 0x00, 0x10, 0x2C, 0x00, 0x80, 0x2F, 0x00, 0x32,
+    0x3B, 0x00, 0x04, 0x00, 0x61, 0x68, 0x69, 0x6C, 0x72, 0x35, 0x00, 0xB4, 0x71, 0x00, 0x80, 0x5B,
+    0x00, 0x9C, 0x0C, 0x00, 0x02, 0x00, 0x62, 0x6F, 0xE6, 0x0A, 0x00, 0x94, 0x5F, 0x00, 0x01, 0x00,
+    0x73, 0xBA, 0x71, 0x00, 0x01, 0x01, 0x3E, 0x00, 0x65, 0xDA, 0x6B, 0x00, 0x02, 0x00, 0x65, 0x69,
+    0x32, 0x3B, 0x00, 0xFC, 0x39, 0x00, 0x02, 0x00, 0x73, 0x74, 0xAA, 0x4D, 0x00, 0xC0, 0x71, 0x00,
+    0x04, 0x00, 0x61, 0x64, 0x74, 0x76, 0x6C, 0x2E, 0x00, 0x3A, 0x2E, 0x00, 0xCA, 0x71, 0x00, 0x4E,
+    0x2F, 0x00, 0x04, 0x01, 0x15, 0x00, 0x66, 0x6E, 0x73, 0x74, 0x32, 0x3B, 0x00, 0x10, 0x2C, 0x00,
+    0xDA, 0x6B, 0x00, 0xD0, 0x71, 0x00, 0x04, 0x00, 0x63, 0x65, 0x70, 0x73, 0xD6, 0x71, 0x00, 0xDC,
+    0x71, 0x00, 0xE2, 0x71, 0x00, 0x30, 0x41, 0x00, 0x02, 0x00, 0x62, 0x6E, 0x4E, 0x2F, 0x00, 0xEC,
+    0x71, 0x00, 0x02, 0x00, 0x63, 0x6D, 0xF6, 0x71, 0x00, 0x82, 0x6C, 0x00, 0x01, 0x00, 0x6F, 0xFC,
+    0x71, 0x00, 0x00, 0x01, 0x1C, 0x00, 0x01, 0x01, 0x05, 0x00, 0x74, 0x22, 0x33, 0x00, 0x02, 0x00,
+    0x69, 0x74, 0x3A, 0x2E, 0x00, 0x02, 0x72, 0x00, 0x03, 0x00, 0x61, 0x65, 0x69, 0x6E, 0x35, 0x00,
+    0x84, 0x14, 0x00, 0x9C, 0x0C, 0x00, 0x02, 0x00, 0x69, 0x79, 0x72, 0x35, 0x00, 0xFC, 0x39, 0x00,
+    0x02, 0x00, 0x61, 0x69, 0x0C, 0x72, 0x00, 0x5E, 0x46, 0x00, 0x01, 0x01, 0x07, 0x00, 0x73, 0x94,
+    0x35, 0x00, 0x02, 0x02, 0xEA, 0x00, 0x69, 0x72, 0x16, 0x72, 0x00, 0xE6, 0x0A, 0x00, 0x00, 0x03,
+    0x98, 0x00, 0x01, 0x00, 0x6F, 0x20, 0x72, 0x00, 0x00, 0x02, 0x77, 0x02, 0x01, 0x00, 0x67, 0x80,
+    0x2F, 0x00, 0x03, 0x00, 0x64, 0x6B, 0x79, 0xA0, 0x6C, 0x00, 0xA0, 0x6C, 0x00, 0xE6, 0x0A, 0x00,
+    0x03, 0x01, 0x19, 0x00, 0x61, 0x69, 0x6F, 0x26, 0x72, 0x00, 0x1A, 0x71, 0x00, 0xE6, 0x0A, 0x00,
+    0x01, 0x02, 0x52, 0x01, 0x65, 0x32, 0x3B, 0x00, 0x01, 0x00, 0x62, 0xA0, 0x6F, 0x00, 0x01, 0x00,
+    0x62, 0xE4, 0x62, 0x00, 0x02, 0x00, 0x66, 0x6C, 0xA0, 0x6C, 0x00, 0x2C, 0x72, 0x00, 0x02, 0x00,
+    0x69, 0x6F, 0xDE, 0x6B, 0x00, 0x8E, 0x6E, 0x00, 0x04, 0x00, 0x61, 0x69, 0x6C, 0x6F, 0x32, 0x72,
+    0x00, 0xCA, 0x3C, 0x00, 0x38, 0x72, 0x00, 0xF4, 0x42, 0x00, 0x01, 0x00, 0x2E, 0xE6, 0x0A, 0x00,
+    0x01, 0x00, 0x69, 0x42, 0x72, 0x00, 0x01, 0x00, 0x66, 0xFC, 0x39, 0x00, 0x02, 0x00, 0x69, 0x6F,
+    0x48, 0x72, 0x00, 0xFC, 0x39, 0x00, 0x03, 0x01, 0x05, 0x00, 0x2E, 0x69, 0x6F, 0x3A, 0x2E, 0x00,
+    0x52, 0x72, 0x00, 0x5C, 0x72, 0x00, 0x04, 0x01, 0x07, 0x00, 0x61, 0x6F, 0x74, 0x75, 0x0E, 0x52,
+    0x00, 0x72, 0x35, 0x00, 0x6A, 0x72, 0x00, 0x72, 0x35, 0x00, 0x03, 0x01, 0x14, 0x00, 0x61, 0x69,
+    0x75, 0x72, 0x35, 0x00, 0xDA, 0x6B, 0x00, 0x6E, 0x35, 0x00, 0x04, 0x00, 0x68, 0x6D, 0x6E, 0x73,
+    0x10, 0x2C, 0x00, 0x3A, 0x2E, 0x00, 0x70, 0x72, 0x00, 0x32, 0x3B, 0x00, 0x06, 0x01, 0x15, 0x00,
+    0x2E, 0x63, 0x69, 0x6F, 0x74, 0x75, 0xC6, 0x34, 0x00, 0x02, 0x33, 0x00, 0x80, 0x5B, 0x00, 0x70,
+    0x71, 0x00, 0x76, 0x72, 0x00, 0x9C, 0x0C, 0x00, 0x02, 0x01, 0x14, 0x00, 0x69, 0x6F, 0x80, 0x72,
+    0x00, 0x6E, 0x35, 0x00, 0x01, 0x01, 0x14, 0x00, 0x69, 0x86, 0x72, 0x00, 0x01, 0x00, 0x74, 0x40,
+    0x5E, 0x00, 0x01, 0x03, 0x70, 0x02, 0x62, 0x32, 0x3B, 0x00, 0x03, 0x00, 0x61, 0x65, 0x74, 0x8C,
+    0x72, 0x00, 0x10, 0x2C, 0x00, 0x4C, 0x38, 0x00, 0x01, 0x00, 0x6E, 0xD0, 0x66, 0x00, 0x01, 0x01,
+    0x12, 0x00, 0x66, 0xDC, 0x5A, 0x00, 0x01, 0x00, 0x61, 0x96, 0x72, 0x00, 0x01, 0x00, 0x65, 0x9C,
+    0x72, 0x00, 0x03, 0x01, 0x12, 0x00, 0x61, 0x65, 0x69, 0xC6, 0x0E, 0x00, 0xA2, 0x72, 0x00, 0xA8,
+    0x72, 0x00, 0x01, 0x01, 0x07, 0x00, 0x67, 0x32, 0x3B, 0x00, 0x01, 0x00, 0x6C, 0x9C, 0x0C, 0x00,
+    0x02, 0x01, 0x15, 0x00, 0x65, 0x74, 0xB0, 0x72, 0x00, 0x64, 0x6E, 0x00, 0x02, 0x01, 0x3E, 0x00,
+    0x69, 0x74, 0x3A, 0x2E, 0x00, 0xBC, 0x72, 0x00, 0x01, 0x00, 0x69, 0xC6, 0x34, 0x00, 0x00, 0x02,
+    0xFC, 0x01, 0x04, 0x00, 0x2E, 0x61, 0x64, 0x73, 0x4C, 0x38, 0x00, 0xC0, 0x72, 0x00, 0x4C, 0x38,
+    0x00, 0xC6, 0x72, 0x00, 0x01, 0x00, 0x65, 0xD0, 0x72, 0x00, 0x01, 0x00, 0x65, 0xFC, 0x39, 0x00,
+    0x03, 0x00, 0x61, 0x69, 0x6F, 0x9C, 0x0C, 0x00, 0xDA, 0x6B, 0x00, 0x0C, 0x4A, 0x00, 0x01, 0x00,
+    0x69, 0x4A, 0x70, 0x00, 0x02, 0x00, 0x61, 0x69, 0x58, 0x6F, 0x00, 0xDA, 0x6B, 0x00, 0x01, 0x00,
+    0x64, 0x80, 0x2F, 0x00, 0x01, 0x00, 0x70, 0x4E, 0x2F, 0x00, 0x01, 0x00, 0x74, 0x32, 0x0D, 0x00,
+    0x01, 0x00, 0x6F, 0xD4, 0x72, 0x00, 0x02, 0x00, 0x67, 0x69, 0xDA, 0x72, 0x00, 0xE6, 0x0A, 0x00,
+    0x02, 0x01, 0x06, 0x00, 0x61, 0x6E, 0xA2, 0x52, 0x00, 0xE0, 0x72, 0x00, 0x04, 0x00, 0x62, 0x66,
+    0x6C, 0x70, 0x4E, 0x2F, 0x00, 0xE8, 0x72, 0x00, 0xDA, 0x6B, 0x00, 0xEE, 0x72, 0x00, 0x03, 0x00,
+    0x6D, 0x70, 0x77, 0xF4, 0x72, 0x00, 0x4E, 0x2F, 0x00, 0xE6, 0x0A, 0x00, 0x01, 0x00, 0x70, 0xFA,
+    0x72, 0x00, 0x01, 0x00, 0x62, 0x84, 0x14, 0x00, 0x01, 0x02, 0xB0, 0x00, 0x6C, 0x00, 0x73, 0x00,
+    0x03, 0x01, 0x1E, 0x00, 0x61, 0x65, 0x74, 0x74, 0x0A, 0x00, 0x2E, 0x30, 0x00, 0x06, 0x73, 0x00,
+    0x01, 0x00, 0x65, 0x84, 0x14, 0x00, 0x01, 0x00, 0x62, 0xB0, 0x09, 0x00, 0x01, 0x00, 0x70, 0x10,
+    0x73, 0x00, 0x02, 0x00, 0x65, 0x70, 0x9C, 0x0C, 0x00, 0x32, 0x3B, 0x00, 0x01, 0x00, 0x74, 0x84,
+    0x14, 0x00, 0x01, 0x01, 0x3E, 0x00, 0x69, 0x30, 0x4B, 0x00, 0x01, 0x00, 0x65, 0x16, 0x73, 0x00,
+    0x02, 0x01, 0x0B, 0x00, 0x65, 0x6F, 0x2E, 0x30, 0x00, 0x5A, 0x2B, 0x00, 0x01, 0x00, 0x65, 0x34,
+    0x30, 0x00, 0x02, 0x00, 0x64, 0x69, 0x26, 0x0E, 0x00, 0x1E, 0x73, 0x00, 0x06, 0x00, 0x61, 0x63,
+    0x65, 0x69, 0x6B, 0x74, 0x80, 0x2F, 0x00, 0x4E, 0x2F, 0x00, 0xC4, 0x46, 0x00, 0x24, 0x73, 0x00,
+    0x32, 0x3B, 0x00, 0x2E, 0x73, 0x00, 0x03, 0x00, 0x70, 0x73, 0x74, 0xFC, 0x39, 0x00, 0x84, 0x14,
+    0x00, 0xA4, 0x6C, 0x00, 0x04, 0x01, 0x1E, 0x00, 0x65, 0x68, 0x69, 0x75, 0x12, 0x4D, 0x00, 0x82,
+    0x6C, 0x00, 0x36, 0x73, 0x00, 0x3C, 0x73, 0x00, 0x03, 0x01, 0x1E, 0x00, 0x65, 0x69, 0x6F, 0xE2,
+    0x70, 0x00, 0x32, 0x3B, 0x00, 0x32, 0x3B, 0x00, 0x02, 0x00, 0x6C, 0x6E, 0x48, 0x3F, 0x00, 0x10,
+    0x2C, 0x00, 0x01, 0x00, 0x74, 0x10, 0x2C, 0x00, 0x02, 0x00, 0x64, 0x6E, 0x10, 0x2C, 0x00, 0x2E,
+    0x6C, 0x00, 0x01, 0x01, 0x12, 0x00, 0x73, 0x40, 0x73, 0x00, 0x01, 0x00, 0x61, 0xFE, 0x6E, 0x00,
+    0x04, 0x01, 0x1E, 0x00, 0x62, 0x66, 0x6D, 0x74, 0x10, 0x2C, 0x00, 0x46, 0x73, 0x00, 0x72, 0x35,
+    0x00, 0x50, 0x73, 0x00, 0x02, 0x00, 0x61, 0x75, 0x58, 0x73, 0x00, 0xD0, 0x43, 0x00, 0x04, 0x00,
+    0x6C, 0x6D, 0x6E, 0x72, 0xC6, 0x34, 0x00, 0x5E, 0x73, 0x00, 0xB2, 0x35, 0x00, 0x68, 0x73, 0x00,
+    0x01, 0x01, 0x12, 0x00, 0x65, 0x58, 0x73, 0x00, 0x02, 0x00, 0x61, 0x65, 0x8E, 0x6E, 0x00, 0x9C,
+    0x0C, 0x00, 0x01, 0x01, 0x12, 0x00, 0x6C, 0x74, 0x73, 0x00, 0x00, 0x02, 0x2B, 0x01, 0x00, 0x02,
+    0x64, 0x00, 0x02, 0x00, 0x72, 0x73, 0x32, 0x69, 0x00, 0x4E, 0x2F, 0x00, 0x01, 0x00, 0x6C, 0x10,
+    0x46, 0x00, 0x06, 0x01, 0x0C, 0x00, 0x61, 0x62, 0x63, 0x6D, 0x74, 0x7A, 0x84, 0x14, 0x00, 0x72,
+    0x35, 0x00, 0xEE, 0x42, 0x00, 0x72, 0x35, 0x00, 0x02, 0x33, 0x00, 0x32, 0x3B, 0x00, 0x02, 0x01,
+    0x0C, 0x00, 0x6C, 0x6E, 0x10, 0x2C, 0x00, 0x1E, 0x6C, 0x00, 0x01, 0x00, 0x69, 0x10, 0x2C, 0x00,
+    0x01, 0x00, 0x6C, 0x7C, 0x73, 0x00, 0x02, 0x00, 0x69, 0x79, 0x80, 0x2F, 0x00, 0x9C, 0x0C, 0x00,
+    0x00, 0x02, 0x3C, 0x00, 0x01, 0x02, 0x5F, 0x02, 0x74, 0xDA, 0x6B, 0x00, 0x01, 0x00, 0x72, 0x88,
+    0x73, 0x00, 0x04, 0x00, 0x63, 0x6C, 0x6E, 0x74, 0x8E, 0x73, 0x00, 0xDA, 0x6B, 0x00, 0x96, 0x73,
+    0x00, 0x4C, 0x38, 0x00, 0x01, 0x00, 0x72, 0xA0, 0x73, 0x00, 0x01, 0x00, 0x73, 0xA6, 0x73, 0x00,
+    0x01, 0x00, 0x6C, 0xE6, 0x0A, 0x00, 0x04, 0x00, 0x62, 0x63, 0x6E, 0x74, 0xFC, 0x39, 0x00, 0x9C,
+    0x0C, 0x00, 0x6A, 0x3A, 0x00, 0xAC, 0x73, 0x00, 0x02, 0x00, 0x2E, 0x73, 0x10, 0x2C, 0x00, 0x10,
+    0x2C, 0x00, 0x02, 0x00, 0x6C, 0x72, 0x02, 0x33, 0x00, 0x26, 0x0E, 0x00, 0x01, 0x01, 0x15, 0x00,
+    0x6C, 0xFC, 0x39, 0x00, 0x03, 0x00, 0x66, 0x67, 0x73, 0x84, 0x14, 0x00, 0x74, 0x0A, 0x00, 0x10,
+    0x41, 0x00, 0x03, 0x00, 0x65, 0x68, 0x79, 0x80, 0x2F, 0x00, 0x72, 0x35, 0x00, 0x26, 0x0E, 0x00,
+    0x01, 0x00, 0x64, 0xB0, 0x73, 0x00, 0x01, 0x00, 0x6E, 0x4E, 0x2F, 0x00, 0x06, 0x01, 0x12, 0x00,
+    0x2E, 0x63, 0x6E, 0x74, 0x77, 0x78, 0x10, 0x2C, 0x00, 0x10, 0x2C, 0x00, 0xB8, 0x73, 0x00, 0xBE,
+    0x73, 0x00, 0x10, 0x2C, 0x00, 0xC4, 0x73, 0x00, 0x08, 0x00, 0x61, 0x62, 0x63, 0x64, 0x67, 0x6E,
+    0x72, 0x73, 0x84, 0x14, 0x00, 0xCA, 0x73, 0x00, 0x3A, 0x2E, 0x00, 0x10, 0x2C, 0x00, 0xEE, 0x42,
+    0x00, 0x26, 0x0E, 0x00, 0x32, 0x69, 0x00, 0x74, 0x0A, 0x00, 0x0A, 0x01, 0x1E, 0x00, 0x62, 0x63,
+    0x65, 0x67, 0x6D, 0x6E, 0x6F, 0x73, 0x74, 0x76, 0xA0, 0x3D, 0x00, 0xD0, 0x73, 0x00, 0x0A, 0x53,
+    0x00, 0x8C, 0x36, 0x00, 0x26, 0x0E, 0x00, 0xDA, 0x73, 0x00, 0x84, 0x14, 0x00, 0xE0, 0x73, 0x00,
+    0xE8, 0x73, 0x00, 0xEE, 0x73, 0x00, 0x02, 0x00, 0x61, 0x6F, 0xF2, 0x73, 0x00, 0xDA, 0x6B, 0x00,
+    0x04, 0x00, 0x61, 0x63, 0x67, 0x70, 0x74, 0x0A, 0x00, 0x26, 0x0E, 0x00, 0xFC, 0x39, 0x00, 0xBC,
+    0x6F, 0x00, 0x01, 0x00, 0x68, 0x6E, 0x35, 0x00, 0x02, 0x00, 0x64, 0x67, 0x26, 0x0E, 0x00, 0xFC,
+    0x39, 0x00, 0x03, 0x00, 0x63, 0x67, 0x6E, 0x10, 0x2C, 0x00, 0x10, 0x2C, 0x00, 0xFA, 0x73, 0x00,
+    0x02, 0x01, 0x12, 0x00, 0x6C, 0x74, 0xC6, 0x34, 0x00, 0x10, 0x2C, 0x00, 0x06, 0x00, 0x63, 0x65,
+    0x67, 0x6E, 0x73, 0x7A, 0xEE, 0x42, 0x00, 0x4E, 0x2F, 0x00, 0xCA, 0x73, 0x00, 0x02, 0x74, 0x00,
+    0x0E, 0x74, 0x00, 0x72, 0x35, 0x00, 0x02, 0x00, 0x67, 0x6E, 0x4E, 0x2F, 0x00, 0x1A, 0x74, 0x00,
+    0x02, 0x00, 0x6C, 0x6E, 0x20, 0x74, 0x00, 0x80, 0x2F, 0x00, 0x02, 0x00, 0x6D, 0x6E, 0xA2, 0x37,
+    0x00, 0x42, 0x3E, 0x00, 0x01, 0x00, 0x68, 0x28, 0x74, 0x00, 0x01, 0x00, 0x69, 0x2E, 0x74, 0x00,
+    0x07, 0x00, 0x61, 0x65, 0x6D, 0x72, 0x73, 0x74, 0x77, 0x26, 0x0E, 0x00, 0x26, 0x0E, 0x00, 0x72,
+    0x35, 0x00, 0xA2, 0x37, 0x00, 0x38, 0x74, 0x00, 0xD0, 0x4F, 0x00, 0x84, 0x14, 0x00, 0x08, 0x00,
+    0x63, 0x65, 0x6C, 0x6F, 0x73, 0x74, 0x75, 0x7A, 0x90, 0x6F, 0x00, 0x26, 0x0E, 0x00, 0x26, 0x0E,
+    0x00, 0x84, 0x14, 0x00, 0x08, 0x6F, 0x00, 0x72, 0x35, 0x00, 0x26, 0x0E, 0x00, 0x3A, 0x2E, 0x00,
+    0x03, 0x01, 0x0C, 0x00, 0x67, 0x73, 0x76, 0x4E, 0x2F, 0x00, 0x10, 0x2C, 0x00, 0x72, 0x35, 0x00,
+    0x01, 0x00, 0x77, 0x9C, 0x0C, 0x00, 0x02, 0x00, 0x61, 0x68, 0x42, 0x74, 0x00, 0x48, 0x74, 0x00,
+    0x02, 0x00, 0x61, 0x66, 0x72, 0x35, 0x00, 0xFC, 0x39, 0x00, 0x01, 0x01, 0x1E, 0x00, 0x72, 0x4E,
+    0x74, 0x00, 0x00, 0x02, 0xC9, 0x00, 0x01, 0x00, 0x61, 0x34, 0x30, 0x00, 0x02, 0x01, 0x12, 0x00,
+    0x65, 0x6F, 0x72, 0x35, 0x00, 0xE2, 0x36, 0x00, 0x01, 0x01, 0x05, 0x00, 0x6F, 0x9C, 0x0C, 0x00,
+    0x01, 0x00, 0x74, 0x26, 0x0E, 0x00, 0x02, 0x01, 0x2E, 0x00, 0x69, 0x6E, 0x84, 0x14, 0x00, 0x18,
+    0x66, 0x00, 0x03, 0x00, 0x6C, 0x6E, 0x74, 0x26, 0x0E, 0x00, 0xBC, 0x3D, 0x00, 0x54, 0x74, 0x00,
+    0x01, 0x00, 0x65, 0xDA, 0x6B, 0x00, 0x01, 0x00, 0x6E, 0x5A, 0x74, 0x00, 0x02, 0x00, 0x65, 0x6F,
+    0x60, 0x74, 0x00, 0x0A, 0x2D, 0x00, 0x01, 0x00, 0x69, 0x6E, 0x74, 0x00, 0x01, 0x00, 0x74, 0x20,
+    0x74, 0x00, 0x01, 0x00, 0x69, 0x74, 0x74, 0x00, 0x04, 0x01, 0x14, 0x00, 0x62, 0x6E, 0x72, 0x74,
+    0x4E, 0x2F, 0x00, 0x7E, 0x74, 0x00, 0x72, 0x35, 0x00, 0x84, 0x74, 0x00, 0x01, 0x01, 0x11, 0x00,
+    0x6C, 0x9C, 0x0C, 0x00, 0x01, 0x00, 0x68, 0x8A, 0x74, 0x00, 0x0A, 0x00, 0x2E, 0x61, 0x63, 0x69,
+    0x6C, 0x6D, 0x6E, 0x71, 0x73, 0x74, 0x72, 0x0C, 0x00, 0x8A, 0x45, 0x00, 0x48, 0x71, 0x00, 0xE2,
+    0x70, 0x00, 0x94, 0x6E, 0x00, 0x00, 0x43, 0x00, 0x92, 0x74, 0x00, 0x4E, 0x2F, 0x00, 0xA4, 0x74,
+    0x00, 0xDA, 0x6B, 0x00, 0x08, 0x01, 0x14, 0x00, 0x61, 0x63, 0x65, 0x6E, 0x6F, 0x74, 0x75, 0x76,
+    0xAE, 0x74, 0x00, 0xB6, 0x74, 0x00, 0xBC, 0x74, 0x00, 0xB2, 0x38, 0x00, 0x74, 0x0A, 0x00, 0xE6,
+    0x0A, 0x00, 0x9C, 0x0C, 0x00, 0xC6, 0x74, 0x00, 0x00, 0x02, 0x60, 0x00, 0x02, 0x00, 0x69, 0x6F,
+    0xCE, 0x74, 0x00, 0x72, 0x35, 0x00, 0x04, 0x01, 0x11, 0x00, 0x62, 0x63, 0x72, 0x75, 0xFC, 0x39,
+    0x00, 0x26, 0x0E, 0x00, 0x4E, 0x2F, 0x00, 0x02, 0x33, 0x00, 0x01, 0x01, 0x14, 0x00, 0x65, 0x58,
+    0x6F, 0x00, 0x03, 0x00, 0x65, 0x6C, 0x77, 0x34, 0x30, 0x00, 0xE6, 0x0A, 0x00, 0x72, 0x35, 0x00,
+    0x01, 0x01, 0x0C, 0x00, 0x74, 0x4E, 0x2F, 0x00, 0x01, 0x00, 0x61, 0xDC, 0x74, 0x00, 0x01, 0x02,
+    0x20, 0x00, 0x67, 0xE2, 0x74, 0x00, 0x03, 0x01, 0x1E, 0x00, 0x61, 0x72, 0x75, 0xE8, 0x74, 0x00,
+    0x84, 0x14, 0x00, 0xFC, 0x39, 0x00, 0x03, 0x02, 0x32, 0x00, 0x63, 0x6E, 0x72, 0x32, 0x6B, 0x00,
+    0x18, 0x66, 0x00, 0xF0, 0x74, 0x00, 0x02, 0x01, 0x0C, 0x00, 0x61, 0x65, 0x84, 0x14, 0x00, 0x12,
+    0x4D, 0x00, 0x07, 0x01, 0x12, 0x00, 0x63, 0x64, 0x67, 0x6D, 0x6E, 0x73, 0x75, 0xC6, 0x34, 0x00,
+    0xFA, 0x74, 0x00, 0xD6, 0x42, 0x00, 0xE4, 0x62, 0x00, 0x3E, 0x5F, 0x00, 0x02, 0x75, 0x00, 0x4E,
+    0x2F, 0x00, 0x01, 0x00, 0x69, 0x8A, 0x48, 0x00, 0x02, 0x00, 0x6C, 0x6E, 0x08, 0x75, 0x00, 0x10,
+    0x75, 0x00, 0x04, 0x01, 0x12, 0x00, 0x61, 0x65, 0x69, 0x72, 0x18, 0x75, 0x00, 0xD0, 0x4F, 0x00,
+    0xCA, 0x73, 0x00, 0x60, 0x2B, 0x00, 0x01, 0x01, 0x11, 0x00, 0x69, 0x1E, 0x75, 0x00, 0x04, 0x00,
+    0x61, 0x69, 0x6F, 0x72, 0x32, 0x72, 0x00, 0x24, 0x75, 0x00, 0x2E, 0x75, 0x00, 0x36, 0x75, 0x00,
+    0x01, 0x00, 0x72, 0x32, 0x6B, 0x00, 0x01, 0x00, 0x62, 0x4E, 0x2F, 0x00, 0x02, 0x00, 0x6E, 0x6F,
+    0xB8, 0x73, 0x00, 0x84, 0x14, 0x00, 0x02, 0x00, 0x6F, 0x79, 0xAE, 0x70, 0x00, 0x42, 0x75, 0x00,
+    0x05, 0x00, 0x63, 0x64, 0x6E, 0x72, 0x74, 0x02, 0x33, 0x00, 0x52, 0x43, 0x00, 0x48, 0x75, 0x00,
+    0x26, 0x0E, 0x00, 0x50, 0x75, 0x00, 0x01, 0x00, 0x6E, 0x5E, 0x46, 0x00, 0x04, 0x00, 0x61, 0x65,
+    0x69, 0x6F, 0x84, 0x14, 0x00, 0x84, 0x14, 0x00, 0x56, 0x75, 0x00, 0x60, 0x75, 0x00, 0x01, 0x00,
+    0x61, 0x72, 0x35, 0x00, 0x01, 0x00, 0x6D, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x6C, 0x6A, 0x75, 0x00,
+    0x01, 0x00, 0x6F, 0x72, 0x35, 0x00, 0x03, 0x00, 0x65, 0x69, 0x72, 0xDA, 0x6B, 0x00, 0x98, 0x44,
+    0x00, 0xFC, 0x39, 0x00, 0x02, 0x00, 0x70, 0x73, 0x70, 0x75, 0x00, 0x74, 0x75, 0x00, 0x04, 0x00,
+    0x61, 0x6C, 0x6E, 0x72, 0x26, 0x0E, 0x00, 0x7C, 0x75, 0x00, 0x86, 0x75, 0x00, 0x90, 0x75, 0x00,
+    0x04, 0x01, 0x12, 0x00, 0x64, 0x6C, 0x6E, 0x76, 0x72, 0x35, 0x00, 0x4E, 0x2F, 0x00, 0x10, 0x2C,
+    0x00, 0x4E, 0x2F, 0x00, 0x01, 0x00, 0x63, 0x26, 0x0E, 0x00, 0x01, 0x01, 0x12, 0x00, 0x67, 0x10,
+    0x2C, 0x00, 0x01, 0x00, 0x65, 0x26, 0x0E, 0x00, 0x03, 0x00, 0x6C, 0x6E, 0x74, 0xA0, 0x6C, 0x00,
+    0x98, 0x75, 0x00, 0x84, 0x14, 0x00, 0x01, 0x00, 0x2E, 0x3A, 0x2E, 0x00, 0x02, 0x00, 0x6C, 0x72,
+    0x72, 0x35, 0x00, 0x80, 0x2F, 0x00, 0x01, 0x00, 0x6C, 0x9A, 0x2F, 0x00, 0x02, 0x00, 0x61, 0x69,
+    0x0C, 0x2C, 0x00, 0xC4, 0x46, 0x00, 0x01, 0x01, 0x0D, 0x00, 0x74, 0x9E, 0x75, 0x00, 0x03, 0x00,
+    0x61, 0x68, 0x6F, 0x72, 0x35, 0x00, 0xB2, 0x38, 0x00, 0xE6, 0x0A, 0x00, 0x01, 0x00, 0x6C, 0xA4,
+    0x75, 0x00, 0x02, 0x00, 0x73, 0x74, 0xDA, 0x6B, 0x00, 0xB4, 0x70, 0x00, 0x01, 0x01, 0x0B, 0x00,
+    0x72, 0xAA, 0x75, 0x00, 0x02, 0x00, 0x61, 0x74, 0xE6, 0x0A, 0x00, 0x3A, 0x2E, 0x00, 0x01, 0x00,
+    0x64, 0xB0, 0x75, 0x00, 0x02, 0x01, 0x3E, 0x00, 0x6D, 0x72, 0xB8, 0x75, 0x00, 0x3A, 0x2E, 0x00,
+    0x01, 0x00, 0x73, 0x10, 0x2C, 0x00, 0x03, 0x00, 0x65, 0x6E, 0x73, 0x10, 0x2C, 0x00, 0x82, 0x6A,
+    0x00, 0xE4, 0x62, 0x00, 0x01, 0x00, 0x79, 0x10, 0x2C, 0x00, 0x07, 0x00, 0x2E, 0x61, 0x65, 0x68,
+    0x69, 0x73, 0x75, 0x30, 0x14, 0x00, 0xBE, 0x75, 0x00, 0xCC, 0x75, 0x00, 0x4C, 0x38, 0x00, 0xD6,
+    0x75, 0x00, 0xE6, 0x0A, 0x00, 0x72, 0x35, 0x00, 0x01, 0x00, 0x65, 0xE2, 0x36, 0x00, 0x01, 0x00,
+    0x68, 0xA4, 0x75, 0x00, 0x03, 0x00, 0x69, 0x6C, 0x79, 0x32, 0x3B, 0x00, 0x02, 0x60, 0x00, 0xE6,
+    0x0A, 0x00, 0x05, 0x01, 0x11, 0x00, 0x61, 0x64, 0x65, 0x67, 0x6E, 0x3A, 0x2E, 0x00, 0x70, 0x75,
+    0x00, 0x6E, 0x35, 0x00, 0xE2, 0x75, 0x00, 0x4E, 0x2F, 0x00, 0x01, 0x00, 0x74, 0x5C, 0x2C, 0x00,
+    0x01, 0x00, 0x74, 0xE6, 0x75, 0x00, 0x01, 0x00, 0x67, 0xEC, 0x75, 0x00, 0x01, 0x00, 0x73, 0x02,
+    0x4D, 0x00, 0x02, 0x00, 0x72, 0x77, 0x44, 0x6E, 0x00, 0x2C, 0x70, 0x00, 0x01, 0x00, 0x6F, 0xF2,
+    0x75, 0x00, 0x00, 0x02, 0x47, 0x02, 0x02, 0x01, 0x0D, 0x00, 0x64, 0x74, 0xB0, 0x09, 0x00, 0x4E,
+    0x2F, 0x00, 0x04, 0x01, 0x1E, 0x00, 0x61, 0x65, 0x69, 0x74, 0xF8, 0x75, 0x00, 0xAA, 0x4D, 0x00,
+    0x4E, 0x2F, 0x00, 0x42, 0x39, 0x00, 0x02, 0x00, 0x61, 0x73, 0x26, 0x0E, 0x00, 0x2E, 0x6C, 0x00,
+    0x01, 0x01, 0x15, 0x00, 0x6C, 0xDA, 0x6B, 0x00, 0x01, 0x00, 0x6C, 0xA0, 0x6C, 0x00, 0x02, 0x00,
+    0x69, 0x73, 0xDA, 0x6B, 0x00, 0x4E, 0x2F, 0x00, 0x01, 0x00, 0x61, 0xE6, 0x0A, 0x00, 0x03, 0x00,
+    0x2E, 0x69, 0x6F, 0x3A, 0x2E, 0x00, 0x4C, 0x38, 0x00, 0x72, 0x35, 0x00, 0x02, 0x01, 0x11, 0x00,
+    0x65, 0x6F, 0xE4, 0x58, 0x00, 0x26, 0x0E, 0x00, 0x02, 0x00, 0x69, 0x6F, 0x02, 0x76, 0x00, 0xE6,
+    0x0A, 0x00, 0x01, 0x00, 0x6E, 0x0C, 0x76, 0x00, 0x01, 0x00, 0x73, 0xDA, 0x6B, 0x00, 0x02, 0x00,
+    0x68, 0x69, 0xA4, 0x6C, 0x00, 0x1A, 0x71, 0x00, 0x01, 0x00, 0x7A, 0xDA, 0x6B, 0x00, 0x02, 0x00,
+    0x69, 0x79, 0x10, 0x76, 0x00, 0xE6, 0x0A, 0x00, 0x05, 0x01, 0x07, 0x00, 0x61, 0x63, 0x69, 0x6F,
+    0x79, 0x1E, 0x76, 0x00, 0x24, 0x76, 0x00, 0x2A, 0x76, 0x00, 0xE6, 0x0A, 0x00, 0xE6, 0x0A, 0x00,
+    0x02, 0x01, 0x07, 0x00, 0x64, 0x6D, 0x30, 0x76, 0x00, 0x72, 0x35, 0x00, 0x01, 0x00, 0x69, 0x3A,
+    0x2E, 0x00, 0x04, 0x00, 0x68, 0x69, 0x6F, 0x79, 0xA0, 0x6C, 0x00, 0x34, 0x76, 0x00, 0xE6, 0x0A,
+    0x00, 0x9C, 0x0C, 0x00, 0x01, 0x00, 0x75, 0xA0, 0x6C, 0x00, 0x01, 0x00, 0x6E, 0x72, 0x35, 0x00,
+    0x01, 0x00, 0x75, 0xE4, 0x58, 0x00, 0x02, 0x00, 0x6F, 0x77, 0x9C, 0x0C, 0x00, 0x3A, 0x76, 0x00,
+    0x01, 0x02, 0x43, 0x02, 0x72, 0x32, 0x3B, 0x00, 0x02, 0x01, 0x12, 0x00, 0x69, 0x6F, 0x40, 0x76,
+    0x00, 0x10, 0x2C, 0x00, 0x02, 0x00, 0x6E, 0x73, 0xA0, 0x6C, 0x00, 0x66, 0x43, 0x00, 0x01, 0x00,
+    0x65, 0x3A, 0x4A, 0x00, 0x03, 0x00, 0x2E, 0x67, 0x73, 0x46, 0x76, 0x00, 0x30, 0x4B, 0x00, 0x4A,
+    0x76, 0x00, 0x01, 0x01, 0x19, 0x00, 0x6C, 0x4E, 0x2F, 0x00, 0x01, 0x00, 0x6C, 0x84, 0x14, 0x00,
+    0x02, 0x01, 0x06, 0x00, 0x64, 0x73, 0x64, 0x6E, 0x00, 0x3A, 0x2E, 0x00, 0x01, 0x01, 0x07, 0x00,
+    0x61, 0x4E, 0x76, 0x00, 0x03, 0x00, 0x62, 0x67, 0x73, 0x4E, 0x2F, 0x00, 0x84, 0x14, 0x00, 0x54,
+    0x76, 0x00, 0x02, 0x01, 0x19, 0x00, 0x62, 0x72, 0x5A, 0x76, 0x00, 0x80, 0x2F, 0x00, 0x02, 0x01,
+    0x0B, 0x00, 0x2E, 0x63, 0x10, 0x2C, 0x00, 0x08, 0x4D, 0x00, 0x01, 0x00, 0x74, 0x60, 0x76, 0x00,
+    0x02, 0x01, 0x12, 0x00, 0x6E, 0x6F, 0xC6, 0x34, 0x00, 0x10, 0x2C, 0x00, 0x03, 0x01, 0x12, 0x00,
+    0x6D, 0x6E, 0x72, 0x48, 0x71, 0x00, 0x10, 0x2C, 0x00, 0x6A, 0x76, 0x00, 0x00, 0x03, 0x3E, 0x02,
+    0x01, 0x00, 0x73, 0x72, 0x35, 0x00, 0x03, 0x01, 0x15, 0x00, 0x61, 0x64, 0x69, 0x74, 0x76, 0x00,
+    0x78, 0x76, 0x00, 0x7E, 0x76, 0x00, 0x02, 0x00, 0x69, 0x6F, 0x2A, 0x76, 0x00, 0x86, 0x76, 0x00,
+    0x00, 0x01, 0x3E, 0x00, 0x05, 0x00, 0x64, 0x69, 0x6E, 0x70, 0x79, 0xA8, 0x44, 0x00, 0x10, 0x2C,
+    0x00, 0x1E, 0x6C, 0x00, 0x8C, 0x76, 0x00, 0xE6, 0x0A, 0x00, 0x02, 0x00, 0x6E, 0x73, 0x4E, 0x2F,
+    0x00, 0x92, 0x76, 0x00, 0x02, 0x00, 0x65, 0x74, 0x98, 0x76, 0x00, 0xE6, 0x0A, 0x00, 0x01, 0x00,
+    0x66, 0xDA, 0x6B, 0x00, 0x01, 0x01, 0x0B, 0x00, 0x72, 0x9E, 0x76, 0x00, 0x01, 0x00, 0x74, 0xA4,
+    0x76, 0x00, 0x01, 0x02, 0x45, 0x00, 0x61, 0xA8, 0x76, 0x00, 0x00, 0x03, 0x31, 0x02, 0x01, 0x00,
+    0x61, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x6C, 0x40, 0x5E, 0x00, 0x02, 0x00, 0x6D, 0x74, 0x4E, 0x2F,
+    0x00, 0x4E, 0x2F, 0x00, 0x01, 0x00, 0x75, 0x26, 0x0E, 0x00, 0x01, 0x00, 0x72, 0xAE, 0x76, 0x00,
+    0x01, 0x00, 0x61, 0xB4, 0x76, 0x00, 0x06, 0x00, 0x63, 0x64, 0x67, 0x69, 0x6B, 0x74, 0xBC, 0x76,
+    0x00, 0x66, 0x43, 0x00, 0xC6, 0x76, 0x00, 0xD2, 0x76, 0x00, 0x4E, 0x2F, 0x00, 0xB0, 0x09, 0x00,
+    0x03, 0x00, 0x61, 0x6C, 0x74, 0xD8, 0x76, 0x00, 0x80, 0x2F, 0x00, 0x32, 0x3B, 0x00, 0x05, 0x00,
+    0x61, 0x64, 0x6C, 0x70, 0x74, 0xDE, 0x76, 0x00, 0x2E, 0x73, 0x00, 0xB0, 0x09, 0x00, 0xE8, 0x76,
+    0x00, 0x8A, 0x3A, 0x00, 0x01, 0x00, 0x73, 0x32, 0x3B, 0x00, 0x01, 0x00, 0x63, 0xEE, 0x76, 0x00,
+    0x01, 0x01, 0x0D, 0x00, 0x61, 0x80, 0x2F, 0x00, 0x02, 0x00, 0x64, 0x72, 0xC6, 0x0E, 0x00, 0x4C,
+    0x38, 0x00, 0x01, 0x00, 0x61, 0xF4, 0x76, 0x00, 0x01, 0x01, 0x05, 0x00, 0x6F, 0xFE, 0x76, 0x00,
+    0x03, 0x00, 0x69, 0x6C, 0x6F, 0xC8, 0x41, 0x00, 0x02, 0x77, 0x00, 0x26, 0x0E, 0x00, 0x01, 0x01,
+    0x1E, 0x00, 0x61, 0x0C, 0x77, 0x00, 0x06, 0x00, 0x61, 0x62, 0x65, 0x6E, 0x6F, 0x79, 0x14, 0x77,
+    0x00, 0x48, 0x39, 0x00, 0x42, 0x39, 0x00, 0x84, 0x14, 0x00, 0x74, 0x46, 0x00, 0x84, 0x14, 0x00,
+    0x01, 0x01, 0x12, 0x00, 0x70, 0x70, 0x71, 0x00, 0x01, 0x01, 0x0B, 0x00, 0x65, 0x64, 0x31, 0x00,
+    0x01, 0x00, 0x61, 0x1C, 0x77, 0x00, 0x01, 0x00, 0x6E, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x68, 0xA0,
+    0x6C, 0x00, 0x00, 0x02, 0x2A, 0x02, 0x01, 0x00, 0x65, 0x20, 0x77, 0x00, 0x01, 0x00, 0x61, 0x10,
+    0x2C, 0x00, 0x01, 0x00, 0x6E, 0x30, 0x41, 0x00, 0x01, 0x01, 0x0B, 0x00, 0x65, 0x26, 0x77, 0x00,
+    0x04, 0x00, 0x6C, 0x6F, 0x70, 0x72, 0x4E, 0x2F, 0x00, 0x72, 0x35, 0x00, 0x4E, 0x2F, 0x00, 0x4E,
+    0x2F, 0x00, 0x02, 0x00, 0x65, 0x73, 0x86, 0x72, 0x00, 0x4E, 0x2F, 0x00, 0x02, 0x00, 0x65, 0x68,
+    0x2C, 0x77, 0x00, 0x32, 0x77, 0x00, 0x01, 0x01, 0x2E, 0x00, 0x72, 0xAC, 0x35, 0x00, 0x01, 0x00,
+    0x74, 0xDA, 0x6B, 0x00, 0x01, 0x00, 0x75, 0x38, 0x77, 0x00, 0x02, 0x00, 0x69, 0x73, 0x3E, 0x77,
+    0x00, 0x26, 0x0E, 0x00, 0x01, 0x01, 0x0B, 0x00, 0x65, 0xDA, 0x6B, 0x00, 0x02, 0x00, 0x61, 0x65,
+    0x2E, 0x30, 0x00, 0x2E, 0x6B, 0x00, 0x02, 0x00, 0x61, 0x65, 0x9C, 0x0C, 0x00, 0xA4, 0x6C, 0x00,
+    0x02, 0x00, 0x61, 0x79, 0x4E, 0x2F, 0x00, 0xFC, 0x39, 0x00, 0x02, 0x00, 0x64, 0x6E, 0x4C, 0x38,
+    0x00, 0xDA, 0x6B, 0x00, 0x04, 0x00, 0x61, 0x69, 0x74, 0x75, 0xDE, 0x6B, 0x00, 0x44, 0x77, 0x00,
+    0xF6, 0x31, 0x00, 0xFC, 0x39, 0x00, 0x02, 0x00, 0x65, 0x70, 0x4E, 0x77, 0x00, 0x10, 0x46, 0x00,
+    0x01, 0x00, 0x73, 0x56, 0x77, 0x00, 0x01, 0x00, 0x65, 0x20, 0x71, 0x00, 0x02, 0x00, 0x6E, 0x70,
+    0x1E, 0x3D, 0x00, 0x3E, 0x4D, 0x00, 0x01, 0x00, 0x72, 0x10, 0x2C, 0x00, 0x03, 0x00, 0x6E, 0x6F,
+    0x73, 0x02, 0x33, 0x00, 0x5E, 0x77, 0x00, 0xFC, 0x39, 0x00, 0x02, 0x00, 0x6B, 0x74, 0x30, 0x4B,
+    0x00, 0x4E, 0x2F, 0x00, 0x01, 0x00, 0x74, 0x64, 0x77, 0x00, 0x01, 0x00, 0x72, 0x42, 0x3E, 0x00,
+    0x03, 0x00, 0x65, 0x68, 0x6F, 0x72, 0x35, 0x00, 0x72, 0x35, 0x00, 0x68, 0x77, 0x00, 0x01, 0x01,
+    0x06, 0x00, 0x65, 0xD8, 0x30, 0x00, 0x03, 0x01, 0x2E, 0x00, 0x63, 0x69, 0x74, 0xE6, 0x0A, 0x00,
+    0x80, 0x2F, 0x00, 0xEC, 0x38, 0x00, 0x03, 0x00, 0x69, 0x72, 0x75, 0x6E, 0x77, 0x00, 0x74, 0x77,
+    0x00, 0x10, 0x2C, 0x00, 0x01, 0x01, 0x06, 0x00, 0x72, 0x7A, 0x77, 0x00, 0x03, 0x00, 0x61, 0x6E,
+    0x74, 0xFC, 0x39, 0x00, 0x72, 0x35, 0x00, 0x84, 0x77, 0x00, 0x01, 0x01, 0x12, 0x00, 0x69, 0x72,
+    0x35, 0x00, 0x01, 0x01, 0x12, 0x00, 0x69, 0xE4, 0x62, 0x00, 0x01, 0x00, 0x6E, 0x26, 0x0E, 0x00,
+    0x05, 0x00, 0x6D, 0x70, 0x72, 0x73, 0x79, 0xE6, 0x0A, 0x00, 0x3A, 0x2E, 0x00, 0x8E, 0x77, 0x00,
+    0xA0, 0x6C, 0x00, 0x10, 0x2C, 0x00, 0x01, 0x00, 0x75, 0xDA, 0x6B, 0x00, 0x01, 0x00, 0x6F, 0xE6,
+    0x0A, 0x00, 0x03, 0x01, 0x11, 0x00, 0x64, 0x6E, 0x70, 0x26, 0x0E, 0x00, 0x5E, 0x46, 0x00, 0x9A,
+    0x77, 0x00, 0x01, 0x00, 0x63, 0xE4, 0x62, 0x00, 0x02, 0x02, 0x6E, 0x00, 0x61, 0x79, 0x3A, 0x2E,
+    0x00, 0x10, 0x2C, 0x00, 0x02, 0x00, 0x65, 0x75, 0x9C, 0x0C, 0x00, 0xA2, 0x77, 0x00, 0x04, 0x00,
+    0x6C, 0x6D, 0x6F, 0x72, 0xEE, 0x42, 0x00, 0x9C, 0x0C, 0x00, 0xFC, 0x39, 0x00, 0x84, 0x14, 0x00,
+    0x02, 0x00, 0x69, 0x6E, 0x10, 0x2C, 0x00, 0x18, 0x66, 0x00, 0x02, 0x00, 0x61, 0x73, 0x86, 0x72,
+    0x00, 0x4E, 0x2F, 0x00, 0x05, 0x01, 0x2E, 0x00, 0x61, 0x65, 0x6F, 0x74, 0x75, 0xAA, 0x77, 0x00,
+    0x26, 0x0E, 0x00, 0xB4, 0x77, 0x00, 0x02, 0x33, 0x00, 0xFC, 0x39, 0x00, 0x02, 0x00, 0x6D, 0x77,
+    0x10, 0x2C, 0x00, 0x72, 0x35, 0x00, 0x01, 0x01, 0x2E, 0x00, 0x6F, 0xFC, 0x39, 0x00, 0x01, 0x00,
+    0x61, 0xC0, 0x77, 0x00, 0x01, 0x00, 0x64, 0xA4, 0x6C, 0x00, 0x04, 0x00, 0x61, 0x65, 0x6E, 0x74,
+    0x0C, 0x76, 0x00, 0x4E, 0x2F, 0x00, 0x26, 0x0E, 0x00, 0xF2, 0x6E, 0x00, 0x01, 0x00, 0x2E, 0x74,
+    0x0A, 0x00, 0x02, 0x00, 0x63, 0x74, 0x84, 0x14, 0x00, 0x74, 0x0A, 0x00, 0x01, 0x00, 0x63, 0xC4,
+    0x77, 0x00, 0x01, 0x00, 0x72, 0xA2, 0x37, 0x00, 0x02, 0x00, 0x65, 0x72, 0x12, 0x4D, 0x00, 0x9C,
+    0x0C, 0x00, 0x02, 0x00, 0x63, 0x65, 0xEA, 0x3B, 0x00, 0x84, 0x14, 0x00, 0x01, 0x00, 0x62, 0x32,
+    0x3B, 0x00, 0x01, 0x00, 0x72, 0xEE, 0x42, 0x00, 0x01, 0x00, 0x74, 0x82, 0x6C, 0x00, 0x04, 0x01,
+    0x0C, 0x00, 0x62, 0x6C, 0x6E, 0x74, 0x84, 0x14, 0x00, 0x72, 0x35, 0x00, 0x72, 0x35, 0x00, 0x72,
+    0x35, 0x00, 0x00, 0x02, 0x70, 0x01, 0x01, 0x00, 0x69, 0xCA, 0x77, 0x00, 0x02, 0x01, 0x2E, 0x00,
+    0x72, 0x74, 0x72, 0x35, 0x00, 0xFC, 0x39, 0x00, 0x02, 0x00, 0x69, 0x72, 0x32, 0x3B, 0x00, 0x02,
+    0x33, 0x00, 0x04, 0x01, 0x12, 0x00, 0x62, 0x64, 0x6D, 0x72, 0xC8, 0x41, 0x00, 0x98, 0x4F, 0x00,
+    0xE4, 0x62, 0x00, 0xFC, 0x31, 0x00, 0x03, 0x00, 0x67, 0x72, 0x76, 0x84, 0x14, 0x00, 0x02, 0x33,
+    0x00, 0xDA, 0x6B, 0x00, 0x06, 0x01, 0x14, 0x00, 0x61, 0x62, 0x6F, 0x73, 0x74, 0x7A, 0x72, 0x35,
+    0x00, 0x6E, 0x35, 0x00, 0x72, 0x35, 0x00, 0x1E, 0x76, 0x00, 0x72, 0x0C, 0x00, 0x6E, 0x35, 0x00,
+    0x01, 0x00, 0x61, 0x7C, 0x49, 0x00, 0x01, 0x00, 0x71, 0x72, 0x35, 0x00, 0x01, 0x00, 0x72, 0xFC,
+    0x39, 0x00, 0x02, 0x00, 0x67, 0x72, 0xD0, 0x77, 0x00, 0xD8, 0x77, 0x00, 0x02, 0x00, 0x6E, 0x74,
+    0xDE, 0x77, 0x00, 0xE6, 0x0A, 0x00, 0x04, 0x01, 0x14, 0x00, 0x64, 0x6C, 0x6E, 0x74, 0x5E, 0x46,
+    0x00, 0x30, 0x4B, 0x00, 0x66, 0x2D, 0x00, 0xE6, 0x0A, 0x00, 0x01, 0x00, 0x6E, 0x84, 0x14, 0x00,
+    0x01, 0x00, 0x65, 0xE4, 0x77, 0x00, 0x01, 0x01, 0x2E, 0x00, 0x6C, 0xEE, 0x42, 0x00, 0x02, 0x00,
+    0x75, 0x76, 0x3C, 0x73, 0x00, 0xE6, 0x0A, 0x00, 0x01, 0x00, 0x65, 0xEA, 0x77, 0x00, 0x01, 0x01,
+    0x0C, 0x00, 0x6C, 0xF4, 0x77, 0x00, 0x03, 0x01, 0x11, 0x00, 0x65, 0x72, 0x73, 0x84, 0x14, 0x00,
+    0xFA, 0x77, 0x00, 0x02, 0x4D, 0x00, 0x01, 0x00, 0x72, 0x00, 0x78, 0x00, 0x06, 0x00, 0x61, 0x65,
+    0x69, 0x6C, 0x6F, 0x75, 0xE6, 0x0A, 0x00, 0x06, 0x78, 0x00, 0xE6, 0x0A, 0x00, 0xF4, 0x77, 0x00,
+    0xE6, 0x0A, 0x00, 0xE6, 0x0A, 0x00, 0x05, 0x01, 0x11, 0x00, 0x2E, 0x61, 0x6F, 0x73, 0x74, 0x26,
+    0x0E, 0x00, 0x10, 0x2C, 0x00, 0x72, 0x35, 0x00, 0x02, 0x33, 0x00, 0x0E, 0x78, 0x00, 0x03, 0x02,
+    0x0E, 0x00, 0x63, 0x73, 0x74, 0xF2, 0x40, 0x00, 0x4E, 0x2F, 0x00, 0x10, 0x2C, 0x00, 0x02, 0x01,
+    0x11, 0x00, 0x65, 0x75, 0x72, 0x35, 0x00, 0x1C, 0x78, 0x00, 0x02, 0x00, 0x2E, 0x68, 0x72, 0x0C,
+    0x00, 0x22, 0x78, 0x00, 0x01, 0x01, 0x14, 0x00, 0x73, 0x26, 0x0E, 0x00, 0x02, 0x00, 0x65, 0x72,
+    0xDA, 0x6B, 0x00, 0x6E, 0x35, 0x00, 0x03, 0x00, 0x61, 0x65, 0x69, 0x6C, 0x2E, 0x00, 0x26, 0x78,
+    0x00, 0x80, 0x2F, 0x00, 0x03, 0x00, 0x68, 0x69, 0x6F, 0xFC, 0x39, 0x00, 0x26, 0x0E, 0x00, 0x9C,
+    0x0C, 0x00, 0x01, 0x00, 0x72, 0x2C, 0x78, 0x00, 0x01, 0x01, 0x13, 0x00, 0x63, 0x9C, 0x0C, 0x00,
+    0x01, 0x00, 0x65, 0x32, 0x78, 0x00, 0x03, 0x00, 0x61, 0x65, 0x69, 0x84, 0x14, 0x00, 0xF6, 0x3B,
+    0x00, 0x36, 0x78, 0x00, 0x02, 0x01, 0x12, 0x00, 0x62, 0x63, 0x4E, 0x2F, 0x00, 0x10, 0x2C, 0x00,
+    0x01, 0x00, 0x65, 0x32, 0x3B, 0x00, 0x04, 0x00, 0x64, 0x66, 0x6C, 0x73, 0xB0, 0x09, 0x00, 0x10,
+    0x2C, 0x00, 0x40, 0x78, 0x00, 0x10, 0x2C, 0x00, 0x01, 0x00, 0x69, 0xFC, 0x39, 0x00, 0x04, 0x01,
+    0x14, 0x00, 0x64, 0x73, 0x74, 0x7A, 0x30, 0x4B, 0x00, 0x9C, 0x0C, 0x00, 0x5A, 0x2B, 0x00, 0x44,
+    0x78, 0x00, 0x02, 0x00, 0x67, 0x6E, 0x4E, 0x2F, 0x00, 0x66, 0x43, 0x00, 0x01, 0x00, 0x65, 0x48,
+    0x78, 0x00, 0x03, 0x00, 0x67, 0x72, 0x73, 0xFC, 0x39, 0x00, 0x72, 0x35, 0x00, 0xA0, 0x6C, 0x00,
+    0x01, 0x02, 0xB6, 0x01, 0x68, 0x72, 0x35, 0x00, 0x01, 0x01, 0x0C, 0x00, 0x72, 0x72, 0x35, 0x00,
+    0x02, 0x00, 0x61, 0x6F, 0x36, 0x47, 0x00, 0x4E, 0x78, 0x00, 0x04, 0x00, 0x62, 0x64, 0x73, 0x74,
+    0x72, 0x35, 0x00, 0x4E, 0x2F, 0x00, 0x26, 0x0E, 0x00, 0xBE, 0x73, 0x00, 0x01, 0x00, 0x61, 0x32,
+    0x72, 0x00, 0x01, 0x00, 0x73, 0xE6, 0x0A, 0x00, 0x01, 0x01, 0x2E, 0x00, 0x6D, 0x8A, 0x3A, 0x00,
+    0x02, 0x01, 0x14, 0x00, 0x69, 0x79, 0x6E, 0x35, 0x00, 0x9C, 0x0C, 0x00, 0x02, 0x02, 0x15, 0x02,
+    0x61, 0x65, 0xCA, 0x3C, 0x00, 0x58, 0x78, 0x00, 0x05, 0x00, 0x61, 0x65, 0x69, 0x6C, 0x72, 0xAE,
+    0x6E, 0x00, 0x02, 0x33, 0x00, 0x02, 0x33, 0x00, 0x0C, 0x6D, 0x00, 0x62, 0x78, 0x00, 0x01, 0x01,
+    0x2E, 0x00, 0x73, 0xFC, 0x39, 0x00, 0x06, 0x00, 0x2E, 0x62, 0x67, 0x6D, 0x6E, 0x74, 0xE6, 0x0A,
+    0x00, 0x5C, 0x2C, 0x00, 0x10, 0x2C, 0x00, 0x68, 0x78, 0x00, 0x84, 0x14, 0x00, 0x84, 0x14, 0x00,
+    0x02, 0x01, 0x11, 0x00, 0x72, 0x73, 0x6C, 0x78, 0x00, 0x76, 0x78, 0x00, 0x01, 0x01, 0x11, 0x00,
+    0x69, 0x7E, 0x78, 0x00, 0x08, 0x01, 0x12, 0x00, 0x61, 0x63, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x73,
+    0xE6, 0x0A, 0x00, 0x84, 0x78, 0x00, 0x72, 0x35, 0x00, 0xE2, 0x36, 0x00, 0xC6, 0x34, 0x00, 0x90,
+    0x78, 0x00, 0x72, 0x0C, 0x00, 0x96, 0x78, 0x00, 0x02, 0x00, 0x6D, 0x6E, 0x9E, 0x78, 0x00, 0xE6,
+    0x0A, 0x00, 0x02, 0x00, 0x61, 0x79, 0x58, 0x73, 0x00, 0xFC, 0x39, 0x00, 0x03, 0x00, 0x61, 0x64,
+    0x6C, 0x58, 0x6F, 0x00, 0x26, 0x0E, 0x00, 0x72, 0x35, 0x00, 0x03, 0x00, 0x6C, 0x6E, 0x72, 0x4E,
+    0x32, 0x00, 0xBC, 0x6F, 0x00, 0xA2, 0x78, 0x00, 0x03, 0x00, 0x6C, 0x6F, 0x74, 0x94, 0x6E, 0x00,
+    0xFC, 0x39, 0x00, 0x02, 0x33, 0x00, 0x02, 0x00, 0x72, 0x74, 0xAC, 0x78, 0x00, 0x3C, 0x73, 0x00,
+    0x01, 0x00, 0x6E, 0xB6, 0x78, 0x00, 0x01, 0x00, 0x71, 0x4E, 0x2F, 0x00, 0x01, 0x00, 0x75, 0x6A,
+    0x6B, 0x00, 0x01, 0x01, 0x0B, 0x00, 0x61, 0xBC, 0x78, 0x00, 0x02, 0x00, 0x65, 0x73, 0xC2, 0x78,
+    0x00, 0x32, 0x3B, 0x00, 0x01, 0x00, 0x74, 0xC8, 0x78, 0x00, 0x01, 0x00, 0x67, 0x3A, 0x2E, 0x00,
+    0x01, 0x00, 0x69, 0xD2, 0x78, 0x00, 0x01, 0x00, 0x64, 0x40, 0x5E, 0x00, 0x01, 0x01, 0x06, 0x00,
+    0x74, 0x1C, 0x33, 0x00, 0x00, 0x02, 0x0B, 0x02, 0x02, 0x00, 0x6C, 0x6F, 0x10, 0x2C, 0x00, 0xA0,
+    0x6C, 0x00, 0x04, 0x00, 0x2E, 0x64, 0x65, 0x67, 0x10, 0x2C, 0x00, 0xB0, 0x09, 0x00, 0xDA, 0x78,
+    0x00, 0x4E, 0x2F, 0x00, 0x01, 0x01, 0x06, 0x00, 0x68, 0x26, 0x0E, 0x00, 0x01, 0x00, 0x79, 0xE6,
+    0x0A, 0x00, 0x01, 0x00, 0x73, 0x26, 0x0E, 0x00, 0x00, 0x02, 0xCE, 0x00, 0x01, 0x00, 0x69, 0xE4,
+    0x78, 0x00, 0x01, 0x00, 0x6E, 0x32, 0x3B, 0x00, 0x01, 0x00, 0x61, 0x84, 0x14, 0x00, 0x02, 0x00,
+    0x69, 0x6F, 0x80, 0x5B, 0x00, 0x10, 0x2C, 0x00, 0x01, 0x00, 0x69, 0xEA, 0x78, 0x00, 0x02, 0x00,
+    0x65, 0x79, 0x10, 0x2C, 0x00, 0x72, 0x35, 0x00, 0x01, 0x00, 0x6E, 0xF2, 0x78, 0x00, 0x01, 0x00,
+    0x6F, 0x80, 0x2F, 0x00, 0x03, 0x00, 0x64, 0x65, 0x74, 0x82, 0x45, 0x00, 0xDE, 0x6B, 0x00, 0xB0,
+    0x09, 0x00, 0x03, 0x00, 0x63, 0x67, 0x69, 0xF8, 0x78, 0x00, 0x4E, 0x2F, 0x00, 0x80, 0x2F, 0x00,
+    0x03, 0x00, 0x61, 0x65, 0x69, 0x36, 0x47, 0x00, 0xFE, 0x78, 0x00, 0x1A, 0x71, 0x00, 0x01, 0x01,
+    0x0C, 0x00, 0x61, 0x3E, 0x5F, 0x00, 0x02, 0x00, 0x61, 0x69, 0xF2, 0x6E, 0x00, 0x04, 0x79, 0x00,
+    0x01, 0x01, 0x2E, 0x00, 0x72, 0xAE, 0x68, 0x00, 0x01, 0x01, 0x06, 0x00, 0x73, 0xFC, 0x39, 0x00,
+    0x01, 0x01, 0x10, 0x00, 0x69, 0x10, 0x2C, 0x00, 0x02, 0x01, 0x1E, 0x00, 0x64, 0x73, 0x0A, 0x79,
+    0x00, 0x10, 0x79, 0x00, 0x01, 0x00, 0x74, 0x16, 0x79, 0x00, 0x01, 0x00, 0x74, 0xA0, 0x6C, 0x00,
+    0x03, 0x00, 0x2E, 0x65, 0x67, 0x3A, 0x2E, 0x00, 0x1C, 0x79, 0x00, 0x3A, 0x2E, 0x00, 0x01, 0x00,
+    0x61, 0x22, 0x79, 0x00, 0x05, 0x00, 0x2E, 0x63, 0x65, 0x6F, 0x74, 0xE6, 0x0A, 0x00, 0x4C, 0x38,
+    0x00, 0x66, 0x43, 0x00, 0x28, 0x79, 0x00, 0xC6, 0x0E, 0x00, 0x02, 0x00, 0x68, 0x72, 0x72, 0x35,
+    0x00, 0x9C, 0x0C, 0x00, 0x05, 0x00, 0x61, 0x65, 0x67, 0x69, 0x6F, 0x4C, 0x56, 0x00, 0x4E, 0x2F,
+    0x00, 0x4C, 0x38, 0x00, 0x46, 0x76, 0x00, 0x10, 0x2C, 0x00, 0x03, 0x01, 0x15, 0x00, 0x63, 0x71,
+    0x73, 0xA2, 0x37, 0x00, 0x3A, 0x2E, 0x00, 0x2E, 0x79, 0x00, 0x02, 0x00, 0x61, 0x65, 0x84, 0x14,
+    0x00, 0x36, 0x79, 0x00, 0x01, 0x01, 0x19, 0x00, 0x65, 0xE6, 0x0A, 0x00, 0x01, 0x01, 0x1D, 0x00,
+    0x72, 0xA4, 0x6C, 0x00, 0x05, 0x00, 0x67, 0x6D, 0x72, 0x73, 0x74, 0x9C, 0x0C, 0x00, 0x6E, 0x35,
+    0x00, 0x70, 0x72, 0x00, 0x9C, 0x0C, 0x00, 0x44, 0x19, 0x00, 0x06, 0x00, 0x69, 0x6F, 0x73, 0x74,
+    0x75, 0x79, 0x3C, 0x79, 0x00, 0x0E, 0x52, 0x00, 0xE6, 0x0A, 0x00, 0xEA, 0x3B, 0x00, 0x10, 0x2C,
+    0x00, 0x84, 0x14, 0x00, 0x03, 0x00, 0x61, 0x65, 0x69, 0x84, 0x14, 0x00, 0x2E, 0x30, 0x00, 0x4C,
+    0x38, 0x00, 0x03, 0x00, 0x65, 0x66, 0x6C, 0x34, 0x30, 0x00, 0x10, 0x2C, 0x00, 0x9C, 0x0C, 0x00,
+    0x03, 0x00, 0x61, 0x68, 0x72, 0x42, 0x79, 0x00, 0x4C, 0x38, 0x00, 0x9E, 0x38, 0x00, 0x00, 0x03,
+    0xF6, 0x01, 0x04, 0x00, 0x62, 0x69, 0x6F, 0x70, 0x7C, 0x55, 0x00, 0x80, 0x2F, 0x00, 0x9C, 0x0C,
+    0x00, 0xF2, 0x40, 0x00, 0x04, 0x00, 0x61, 0x65, 0x69, 0x6B, 0x10, 0x2C, 0x00, 0x48, 0x79, 0x00,
+    0x80, 0x2F, 0x00, 0x32, 0x77, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x03, 0x01, 0x12, 0x00, 0x2E, 0x68,
+    0x69, 0xC6, 0x34, 0x00, 0x50, 0x79, 0x00, 0x56, 0x79, 0x00, 0x02, 0x01, 0x34, 0x00, 0x6C, 0x74,
+    0x84, 0x14, 0x00, 0x4E, 0x2F, 0x00, 0x01, 0x00, 0x77, 0x10, 0x2C, 0x00, 0x06, 0x01, 0x2E, 0x00,
+    0x61, 0x63, 0x67, 0x6C, 0x6E, 0x74, 0x26, 0x0E, 0x00, 0x84, 0x14, 0x00, 0x84, 0x14, 0x00, 0x84,
+    0x14, 0x00, 0x40, 0x5E, 0x00, 0x40, 0x5E, 0x00, 0x01, 0x00, 0x6C, 0x02, 0x33, 0x00, 0x02, 0x01,
+    0x1E, 0x00, 0x6E, 0x73, 0x5C, 0x79, 0x00, 0x64, 0x79, 0x00, 0x03, 0x01, 0x0B, 0x00, 0x71, 0x75,
+    0x77, 0x6A, 0x79, 0x00, 0xE4, 0x58, 0x00, 0x26, 0x0E, 0x00, 0x01, 0x00, 0x6E, 0x98, 0x75, 0x00,
+    0x02, 0x00, 0x64, 0x6E, 0x10, 0x2C, 0x00, 0x70, 0x79, 0x00, 0x01, 0x00, 0x64, 0x78, 0x79, 0x00,
+    0x02, 0x00, 0x61, 0x6F, 0x20, 0x71, 0x00, 0x7E, 0x79, 0x00, 0x04, 0x00, 0x65, 0x69, 0x6F, 0x75,
+    0x84, 0x79, 0x00, 0x8A, 0x79, 0x00, 0x26, 0x0E, 0x00, 0x4C, 0x38, 0x00, 0x02, 0x00, 0x67, 0x69,
+    0x3A, 0x2E, 0x00, 0x90, 0x79, 0x00, 0x01, 0x00, 0x64, 0xA0, 0x6C, 0x00, 0x03, 0x00, 0x65, 0x69,
+    0x6D, 0x66, 0x43, 0x00, 0x80, 0x2F, 0x00, 0x84, 0x14, 0x00, 0x03, 0x00, 0x61, 0x69, 0x6F, 0x98,
+    0x79, 0x00, 0x0A, 0x3D, 0x00, 0x86, 0x76, 0x00, 0x04, 0x00, 0x2E, 0x65, 0x6F, 0x74, 0x3A, 0x2E,
+    0x00, 0xDE, 0x6B, 0x00, 0xA0, 0x79, 0x00, 0x4E, 0x2F, 0x00, 0x02, 0x00, 0x6E, 0x74, 0x46, 0x4F,
+    0x00, 0x72, 0x0C, 0x00, 0x02, 0x00, 0x61, 0x69, 0x84, 0x14, 0x00, 0x26, 0x0E, 0x00, 0x02, 0x00,
+    0x6E, 0x74, 0x6A, 0x3A, 0x00, 0x84, 0x14, 0x00, 0x01, 0x00, 0x65, 0x10, 0x2C, 0x00, 0x02, 0x00,
+    0x67, 0x6E, 0xFC, 0x39, 0x00, 0xA6, 0x79, 0x00, 0x03, 0x01, 0x12, 0x00, 0x61, 0x6E, 0x72, 0x84,
+    0x14, 0x00, 0xDA, 0x6B, 0x00, 0xC4, 0x73, 0x00, 0x01, 0x00, 0x69, 0xAC, 0x79, 0x00, 0x02, 0x00,
+    0x65, 0x73, 0xB4, 0x79, 0x00, 0xDA, 0x6B, 0x00, 0x01, 0x01, 0x15, 0x00, 0x72, 0x6A, 0x6B, 0x00,
+    0x01, 0x00, 0x72, 0x72, 0x35, 0x00, 0x02, 0x00, 0x68, 0x69, 0xDA, 0x6B, 0x00, 0x72, 0x35, 0x00,
+    0x02, 0x00, 0x6E, 0x70, 0x72, 0x35, 0x00, 0x10, 0x46, 0x00, 0x01, 0x00, 0x64, 0xFC, 0x39, 0x00,
+    0x04, 0x00, 0x61, 0x62, 0x69, 0x6E, 0x9C, 0x0C, 0x00, 0xBA, 0x79, 0x00, 0x3A, 0x2E, 0x00, 0xC0,
+    0x79, 0x00, 0x01, 0x00, 0x6B, 0xCA, 0x79, 0x00, 0x01, 0x01, 0x13, 0x00, 0x72, 0x80, 0x2F, 0x00,
+    0x02, 0x00, 0x73, 0x74, 0xDA, 0x6B, 0x00, 0x44, 0x6E, 0x00, 0x02, 0x00, 0x6E, 0x74, 0x26, 0x0E,
+    0x00, 0xD0, 0x79, 0x00, 0x01, 0x00, 0x61, 0xD4, 0x79, 0x00, 0x02, 0x02, 0xE9, 0x01, 0x65, 0x74,
+    0x26, 0x0E, 0x00, 0xDA, 0x79, 0x00, 0x03, 0x00, 0x61, 0x68, 0x6C, 0x6E, 0x35, 0x00, 0xE0, 0x79,
+    0x00, 0x9C, 0x0C, 0x00, 0x02, 0x00, 0x69, 0x6E, 0x12, 0x4D, 0x00, 0x3A, 0x2E, 0x00, 0x05, 0x00,
+    0x61, 0x64, 0x69, 0x6C, 0x74, 0xE6, 0x79, 0x00, 0xE6, 0x0A, 0x00, 0xEC, 0x79, 0x00, 0x5C, 0x2C,
+    0x00, 0x0C, 0x6D, 0x00, 0x03, 0x00, 0x2E, 0x69, 0x75, 0xC6, 0x34, 0x00, 0xF6, 0x79, 0x00, 0x04,
+    0x7A, 0x00, 0x01, 0x01, 0x0C, 0x00, 0x68, 0x0A, 0x7A, 0x00, 0x04, 0x00, 0x67, 0x69, 0x6C, 0x76,
+    0x10, 0x7A, 0x00, 0x16, 0x7A, 0x00, 0x0C, 0x6D, 0x00, 0x80, 0x2F, 0x00, 0x03, 0x00, 0x63, 0x65,
+    0x74, 0x0A, 0x3D, 0x00, 0x4E, 0x2F, 0x00, 0x10, 0x46, 0x00, 0x03, 0x00, 0x65, 0x68, 0x69, 0x3A,
+    0x2E, 0x00, 0xA4, 0x6C, 0x00, 0x20, 0x7A, 0x00, 0x01, 0x00, 0x74, 0x2A, 0x7A, 0x00, 0x03, 0x00,
+    0x6C, 0x6E, 0x76, 0x26, 0x0E, 0x00, 0xDA, 0x73, 0x00, 0x4E, 0x2F, 0x00, 0x03, 0x01, 0x11, 0x00,
+    0x2E, 0x69, 0x79, 0xE6, 0x0A, 0x00, 0x2E, 0x7A, 0x00, 0x40, 0x7A, 0x00, 0x01, 0x01, 0x1E, 0x00,
+    0x72, 0x44, 0x7A, 0x00, 0x02, 0x00, 0x6F, 0x74, 0x12, 0x4D, 0x00, 0x4E, 0x2F, 0x00, 0x01, 0x01,
+    0x1E, 0x00, 0x6F, 0x4A, 0x7A, 0x00, 0x07, 0x01, 0x07, 0x00, 0x2E, 0x61, 0x64, 0x65, 0x69, 0x73,
+    0x74, 0xC6, 0x34, 0x00, 0x4E, 0x7A, 0x00, 0xB0, 0x09, 0x00, 0xE6, 0x0A, 0x00, 0x4E, 0x2F, 0x00,
+    0x56, 0x7A, 0x00, 0x5E, 0x7A, 0x00, 0x01, 0x00, 0x73, 0x66, 0x7A, 0x00, 0x01, 0x01, 0x11, 0x00,
+    0x74, 0x4E, 0x71, 0x00, 0x04, 0x00, 0x61, 0x65, 0x68, 0x72, 0x6C, 0x7A, 0x00, 0x02, 0x33, 0x00,
+    0x48, 0x4B, 0x00, 0x74, 0x7A, 0x00, 0x02, 0x00, 0x61, 0x67, 0x80, 0x7A, 0x00, 0x4E, 0x2F, 0x00,
+    0x02, 0x00, 0x69, 0x6C, 0x88, 0x7A, 0x00, 0x96, 0x7A, 0x00, 0x07, 0x00, 0x61, 0x64, 0x65, 0x67,
+    0x69, 0x74, 0x75, 0x4E, 0x2F, 0x00, 0x4C, 0x38, 0x00, 0x52, 0x43, 0x00, 0xA2, 0x7A, 0x00, 0xA8,
+    0x7A, 0x00, 0x4E, 0x2F, 0x00, 0xAE, 0x7A, 0x00, 0x03, 0x01, 0x2E, 0x00, 0x65, 0x6C, 0x74, 0xB6,
+    0x7A, 0x00, 0x32, 0x3B, 0x00, 0xBC, 0x7A, 0x00, 0x01, 0x00, 0x68, 0xE6, 0x0A, 0x00, 0x02, 0x00,
+    0x62, 0x72, 0xC6, 0x7A, 0x00, 0xD8, 0x77, 0x00, 0x01, 0x00, 0x6E, 0x10, 0x2C, 0x00, 0x01, 0x00,
+    0x72, 0xCA, 0x7A, 0x00, 0x00, 0x02, 0xCB, 0x01, 0x01, 0x00, 0x6C, 0xD2, 0x7A, 0x00, 0x01, 0x00,
+    0x73, 0xD8, 0x7A, 0x00, 0x01, 0x00, 0x65, 0xE0, 0x7A, 0x00, 0x05, 0x00, 0x65, 0x67, 0x69, 0x6F,
+    0x79, 0xEA, 0x7A, 0x00, 0x30, 0x4B, 0x00, 0xF4, 0x7A, 0x00, 0x02, 0x7B, 0x00, 0xBC, 0x6F, 0x00,
+    0x02, 0x01, 0x1E, 0x00, 0x61, 0x6F, 0xEA, 0x3B, 0x00, 0x14, 0x7B, 0x00, 0x02, 0x01, 0x15, 0x00,
+    0x65, 0x70, 0x22, 0x33, 0x00, 0x72, 0x35, 0x00, 0x01, 0x00, 0x68, 0x1A, 0x7B, 0x00, 0x02, 0x00,
+    0x66, 0x73, 0x26, 0x0E, 0x00, 0x22, 0x7B, 0x00, 0x01, 0x00, 0x72, 0x2A, 0x7B, 0x00, 0x01, 0x00,
+    0x61, 0x34, 0x7B, 0x00, 0x05, 0x01, 0x2E, 0x00, 0x61, 0x65, 0x6E, 0x72, 0x73, 0x4E, 0x2F, 0x00,
+    0x90, 0x6F, 0x00, 0x32, 0x69, 0x00, 0x26, 0x0E, 0x00, 0xFC, 0x39, 0x00, 0x04, 0x00, 0x72, 0x73,
+    0x75, 0x76, 0xAC, 0x35, 0x00, 0x3A, 0x7B, 0x00, 0xD0, 0x43, 0x00, 0xA0, 0x6C, 0x00, 0x01, 0x00,
+    0x72, 0x9C, 0x0C, 0x00, 0x01, 0x01, 0x05, 0x00, 0x61, 0x40, 0x7B, 0x00, 0x01, 0x00, 0x72, 0x46,
+    0x7B, 0x00, 0x02, 0x00, 0x61, 0x74, 0x62, 0x70, 0x00, 0x4C, 0x7B, 0x00, 0x01, 0x03, 0x8E, 0x00,
+    0x75, 0x10, 0x2C, 0x00, 0x03, 0x00, 0x2E, 0x61, 0x74, 0xE6, 0x0A, 0x00, 0x9C, 0x0C, 0x00, 0x26,
+    0x0E, 0x00, 0x01, 0x00, 0x65, 0x54, 0x7B, 0x00, 0x02, 0x00, 0x69, 0x74, 0x5A, 0x7B, 0x00, 0xE6,
+    0x0A, 0x00, 0x01, 0x00, 0x69, 0xE4, 0x58, 0x00, 0x03, 0x01, 0x2E, 0x00, 0x63, 0x69, 0x6B, 0x62,
+    0x7B, 0x00, 0x2E, 0x2F, 0x00, 0xDA, 0x6B, 0x00, 0x05, 0x00, 0x63, 0x65, 0x69, 0x6C, 0x6D, 0x68,
+    0x7B, 0x00, 0xE6, 0x0A, 0x00, 0x80, 0x2F, 0x00, 0x4E, 0x2F, 0x00, 0x26, 0x0E, 0x00, 0x02, 0x01,
+    0x05, 0x00, 0x63, 0x74, 0x4E, 0x2F, 0x00, 0xEE, 0x36, 0x00, 0x02, 0x01, 0x2E, 0x00, 0x61, 0x6F,
+    0x4E, 0x32, 0x00, 0x70, 0x7B, 0x00, 0x02, 0x01, 0x2E, 0x00, 0x73, 0x74, 0x44, 0x6E, 0x00, 0x4C,
+    0x38, 0x00, 0x01, 0x00, 0x72, 0xA0, 0x6C, 0x00, 0x01, 0x00, 0x73, 0x76, 0x7B, 0x00, 0x03, 0x00,
+    0x61, 0x65, 0x69, 0x84, 0x14, 0x00, 0x7C, 0x7B, 0x00, 0x86, 0x7B, 0x00, 0x02, 0x00, 0x6E, 0x74,
+    0x02, 0x33, 0x00, 0x9C, 0x0C, 0x00, 0x01, 0x00, 0x75, 0x1C, 0x78, 0x00, 0x02, 0x00, 0x69, 0x6E,
+    0x10, 0x2C, 0x00, 0x26, 0x0E, 0x00, 0x01, 0x01, 0x12, 0x00, 0x73, 0xF8, 0x6E, 0x00, 0x05, 0x00,
+    0x62, 0x65, 0x66, 0x74, 0x7A, 0x4E, 0x2F, 0x00, 0x90, 0x7B, 0x00, 0xAC, 0x0F, 0x00, 0x74, 0x0A,
+    0x00, 0x84, 0x14, 0x00, 0x01, 0x00, 0x68, 0xD0, 0x4F, 0x00, 0x02, 0x00, 0x63, 0x72, 0x26, 0x0E,
+    0x00, 0x4E, 0x2F, 0x00, 0x01, 0x00, 0x65, 0x6E, 0x35, 0x00, 0x01, 0x00, 0x72, 0x84, 0x14, 0x00,
+    0x02, 0x01, 0x1E, 0x00, 0x61, 0x75, 0x96, 0x7B, 0x00, 0x80, 0x2F, 0x00, 0x01, 0x01, 0x1E, 0x00,
+    0x6B, 0x3A, 0x2E, 0x00, 0x02, 0x00, 0x61, 0x65, 0x9C, 0x7B, 0x00, 0x3A, 0x2E, 0x00, 0x02, 0x00,
+    0x61, 0x69, 0x9C, 0x0C, 0x00, 0x4A, 0x70, 0x00, 0x02, 0x00, 0x69, 0x6F, 0xFC, 0x39, 0x00, 0x9C,
+    0x0C, 0x00, 0x01, 0x01, 0x07, 0x00, 0x65, 0xE6, 0x0A, 0x00, 0x04, 0x01, 0x12, 0x00, 0x61, 0x65,
+    0x69, 0x72, 0xA2, 0x7B, 0x00, 0xC6, 0x34, 0x00, 0xAC, 0x7B, 0x00, 0x4E, 0x2F, 0x00, 0x05, 0x01,
+    0x07, 0x00, 0x2E, 0x6B, 0x70, 0x74, 0x77, 0x72, 0x0C, 0x00, 0xB0, 0x7B, 0x00, 0xE6, 0x0A, 0x00,
+    0x72, 0x0C, 0x00, 0xE6, 0x0A, 0x00, 0x01, 0x00, 0x69, 0x8A, 0x79, 0x00, 0x01, 0x01, 0x0B, 0x00,
+    0x65, 0x26, 0x0E, 0x00, 0x01, 0x00, 0x6E, 0xB6, 0x7B, 0x00, 0x01, 0x00, 0x62, 0x10, 0x2C, 0x00,
+    0x03, 0x00, 0x6C, 0x6E, 0x72, 0x84, 0x14, 0x00, 0xBC, 0x7B, 0x00, 0xC2, 0x7B, 0x00, 0x02, 0x00,
+    0x61, 0x6F, 0xFC, 0x39, 0x00, 0x02, 0x33, 0x00, 0x03, 0x00, 0x62, 0x6E, 0x74, 0x84, 0x14, 0x00,
+    0x02, 0x33, 0x00, 0x26, 0x0E, 0x00, 0x01, 0x00, 0x76, 0xDA, 0x6B, 0x00, 0x02, 0x00, 0x68, 0x70,
+    0xFC, 0x39, 0x00, 0x06, 0x5C, 0x00, 0x01, 0x01, 0x12, 0x00, 0x6D, 0x10, 0x2C, 0x00, 0x01, 0x01,
+    0x06, 0x00, 0x62, 0xA4, 0x6C, 0x00, 0x02, 0x02, 0xEA, 0x00, 0x6E, 0x70, 0xCC, 0x7B, 0x00, 0x9C,
+    0x0C, 0x00, 0x02, 0x00, 0x61, 0x6C, 0x72, 0x35, 0x00, 0x9C, 0x0C, 0x00, 0x01, 0x01, 0x0B, 0x00,
+    0x69, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x69, 0xD4, 0x7B, 0x00, 0x01, 0x00, 0x72, 0x26, 0x0E, 0x00,
+    0x01, 0x01, 0x12, 0x00, 0x69, 0x56, 0x70, 0x00, 0x02, 0x01, 0x12, 0x00, 0x65, 0x67, 0x66, 0x43,
+    0x00, 0x4E, 0x2F, 0x00, 0x02, 0x00, 0x2E, 0x74, 0x3A, 0x2E, 0x00, 0x48, 0x39, 0x00, 0x04, 0x01,
+    0x2E, 0x00, 0x68, 0x69, 0x6F, 0x72, 0x10, 0x2C, 0x00, 0xD6, 0x70, 0x00, 0x0A, 0x53, 0x00, 0x72,
+    0x35, 0x00, 0x02, 0x00, 0x72, 0x74, 0xDC, 0x7B, 0x00, 0x84, 0x14, 0x00, 0x01, 0x00, 0x75, 0xE2,
+    0x7B, 0x00, 0x01, 0x01, 0x06, 0x00, 0x74, 0xDA, 0x6B, 0x00, 0x02, 0x00, 0x61, 0x76, 0x86, 0x72,
+    0x00, 0x4E, 0x2F, 0x00, 0x01, 0x00, 0x6C, 0xE8, 0x7B, 0x00, 0x02, 0x00, 0x65, 0x6C, 0xF0, 0x7B,
+    0x00, 0x26, 0x0E, 0x00, 0x01, 0x01, 0x0C, 0x00, 0x65, 0xDA, 0x6B, 0x00, 0x01, 0x00, 0x73, 0x64,
+    0x6E, 0x00, 0x02, 0x00, 0x69, 0x6F, 0xF6, 0x7B, 0x00, 0xFA, 0x7B, 0x00, 0x05, 0x00, 0x61, 0x65,
+    0x69, 0x6F, 0x79, 0x00, 0x7C, 0x00, 0x06, 0x7C, 0x00, 0x0C, 0x7C, 0x00, 0x9C, 0x0C, 0x00, 0x72,
+    0x35, 0x00, 0x03, 0x01, 0x0B, 0x00, 0x61, 0x65, 0x69, 0x1A, 0x7C, 0x00, 0x20, 0x7C, 0x00, 0x26,
+    0x7C, 0x00, 0x01, 0x01, 0x0C, 0x00, 0x6F, 0x32, 0x7C, 0x00, 0x01, 0x00, 0x61, 0x38, 0x7C, 0x00,
+    0x03, 0x00, 0x63, 0x65, 0x74, 0xE6, 0x0A, 0x00, 0x4E, 0x2F, 0x00, 0x32, 0x3B, 0x00, 0x01, 0x01,
+    0x07, 0x00, 0x6E, 0x4C, 0x38, 0x00, 0x01, 0x00, 0x65, 0x42, 0x7C, 0x00, 0x01, 0x00, 0x6C, 0xA4,
+    0x6C, 0x00, 0x01, 0x00, 0x65, 0x64, 0x6C, 0x00, 0x02, 0x00, 0x62, 0x74, 0xFC, 0x39, 0x00, 0x62,
+    0x7B, 0x00, 0x01, 0x01, 0x0B, 0x00, 0x65, 0xBE, 0x73, 0x00, 0x01, 0x01, 0x2E, 0x00, 0x73, 0x3C,
+    0x73, 0x00, 0x02, 0x00, 0x64, 0x67, 0x22, 0x6D, 0x00, 0xDA, 0x6B, 0x00, 0x01, 0x01, 0x13, 0x00,
+    0x6F, 0x44, 0x19, 0x00, 0x02, 0x00, 0x65, 0x69, 0x9C, 0x0C, 0x00, 0x26, 0x0E, 0x00, 0x01, 0x00,
+    0x61, 0xFC, 0x6D, 0x00, 0x01, 0x00, 0x72, 0xA0, 0x2F, 0x00, 0x05, 0x01, 0x1E, 0x00, 0x62, 0x65,
+    0x66, 0x6E, 0x70, 0x26, 0x0E, 0x00, 0xCA, 0x2F, 0x00, 0x58, 0x2F, 0x00, 0x4C, 0x7C, 0x00, 0x4E,
+    0x2F, 0x00, 0x02, 0x00, 0x65, 0x6F, 0x56, 0x7C, 0x00, 0x5C, 0x7C, 0x00, 0x01, 0x00, 0x6D, 0x44,
+    0x6E, 0x00, 0x01, 0x00, 0x66, 0xB0, 0x09, 0x00, 0x02, 0x00, 0x6E, 0x74, 0x84, 0x14, 0x00, 0x62,
+    0x7C, 0x00, 0x02, 0x01, 0x05, 0x00, 0x65, 0x69, 0x02, 0x33, 0x00, 0x26, 0x0E, 0x00, 0x00, 0x02,
+    0x6E, 0x01, 0x01, 0x00, 0x65, 0x66, 0x7C, 0x00, 0x02, 0x00, 0x65, 0x74, 0x4E, 0x2F, 0x00, 0x9A,
+    0x2F, 0x00, 0x02, 0x00, 0x62, 0x72, 0x04, 0x6F, 0x00, 0x26, 0x0E, 0x00, 0x01, 0x00, 0x6C, 0x4E,
+    0x2F, 0x00, 0x01, 0x01, 0x12, 0x00, 0x6E, 0x6C, 0x7C, 0x00, 0x01, 0x00, 0x69, 0x74, 0x7C, 0x00,
+    0x02, 0x01, 0x06, 0x00, 0x61, 0x65, 0xFE, 0x6E, 0x00, 0xBC, 0x3D, 0x00, 0x02, 0x00, 0x66, 0x6C,
+    0xA4, 0x6C, 0x00, 0x10, 0x2C, 0x00, 0x01, 0x00, 0x61, 0x58, 0x73, 0x00, 0x01, 0x00, 0x64, 0x10,
+    0x2C, 0x00, 0x03, 0x00, 0x61, 0x65, 0x69, 0x7A, 0x7C, 0x00, 0xA4, 0x6C, 0x00, 0xB6, 0x78, 0x00,
+    0x01, 0x00, 0x6F, 0x1C, 0x78, 0x00, 0x02, 0x00, 0x6C, 0x72, 0xEE, 0x42, 0x00, 0x52, 0x43, 0x00,
+    0x01, 0x00, 0x65, 0xEA, 0x4F, 0x00, 0x01, 0x00, 0x6C, 0x84, 0x7C, 0x00, 0x03, 0x00, 0x63, 0x6F,
+    0x74, 0x72, 0x35, 0x00, 0x80, 0x2F, 0x00, 0x8A, 0x7C, 0x00, 0x01, 0x02, 0x92, 0x01, 0x72, 0xA4,
+    0x6C, 0x00, 0x01, 0x00, 0x63, 0x90, 0x7C, 0x00, 0x01, 0x00, 0x67, 0x26, 0x0E, 0x00, 0x01, 0x01,
+    0x10, 0x00, 0x73, 0x96, 0x7C, 0x00, 0x01, 0x01, 0x2E, 0x00, 0x74, 0x9C, 0x7C, 0x00, 0x02, 0x00,
+    0x72, 0x74, 0x9E, 0x78, 0x00, 0xA6, 0x7C, 0x00, 0x03, 0x01, 0x12, 0x00, 0x6E, 0x6F, 0x72, 0x52,
+    0x43, 0x00, 0x26, 0x0E, 0x00, 0x10, 0x2C, 0x00, 0x03, 0x00, 0x65, 0x73, 0x74, 0x84, 0x14, 0x00,
+    0xB0, 0x7C, 0x00, 0x72, 0x35, 0x00, 0x01, 0x01, 0x05, 0x00, 0x79, 0xAC, 0x0F, 0x00, 0x01, 0x00,
+    0x69, 0xB4, 0x7C, 0x00, 0x01, 0x01, 0x07, 0x00, 0x6E, 0x72, 0x0C, 0x00, 0x01, 0x00, 0x62, 0xA0,
+    0x6C, 0x00, 0x01, 0x00, 0x65, 0xBA, 0x7C, 0x00, 0x01, 0x00, 0x65, 0xD0, 0x4F, 0x00, 0x01, 0x00,
+    0x65, 0xE4, 0x58, 0x00, 0x02, 0x00, 0x67, 0x74, 0x84, 0x14, 0x00, 0x32, 0x77, 0x00, 0x03, 0x00,
+    0x6D, 0x6F, 0x74, 0x26, 0x0E, 0x00, 0x36, 0x47, 0x00, 0xE8, 0x76, 0x00, 0x02, 0x00, 0x6E, 0x73,
+    0x84, 0x14, 0x00, 0x66, 0x2E, 0x00, 0x02, 0x01, 0x12, 0x00, 0x6E, 0x73, 0x10, 0x2C, 0x00, 0x34,
+    0x7B, 0x00, 0x01, 0x01, 0x1E, 0x00, 0x65, 0x10, 0x46, 0x00, 0x03, 0x00, 0x72, 0x73, 0x74, 0x72,
+    0x35, 0x00, 0xC0, 0x7C, 0x00, 0x84, 0x14, 0x00, 0x0B, 0x01, 0x1E, 0x00, 0x61, 0x63, 0x64, 0x66,
+    0x67, 0x6C, 0x6E, 0x6F, 0x73, 0x74, 0x76, 0x84, 0x14, 0x00, 0xA0, 0x3D, 0x00, 0x94, 0x6E, 0x00,
+    0x40, 0x5E, 0x00, 0xCA, 0x7C, 0x00, 0x26, 0x0E, 0x00, 0x98, 0x75, 0x00, 0x26, 0x0E, 0x00, 0xD0,
+    0x7C, 0x00, 0xDA, 0x7C, 0x00, 0x26, 0x0E, 0x00, 0x01, 0x00, 0x69, 0x30, 0x41, 0x00, 0x03, 0x00,
+    0x67, 0x6E, 0x72, 0x74, 0x69, 0x00, 0xE4, 0x7C, 0x00, 0x4E, 0x2F, 0x00, 0x04, 0x00, 0x62, 0x6D,
+    0x6E, 0x73, 0x72, 0x35, 0x00, 0xB2, 0x38, 0x00, 0x72, 0x35, 0x00, 0x26, 0x0E, 0x00, 0x03, 0x00,
+    0x68, 0x6C, 0x74, 0xFC, 0x39, 0x00, 0x32, 0x3B, 0x00, 0x74, 0x69, 0x00, 0x02, 0x00, 0x65, 0x6C,
+    0x6E, 0x35, 0x00, 0x9C, 0x0C, 0x00, 0x04, 0x01, 0x2E, 0x00, 0x63, 0x6E, 0x72, 0x74, 0xEA, 0x7C,
+    0x00, 0xEE, 0x42, 0x00, 0xF0, 0x7C, 0x00, 0xF6, 0x7C, 0x00, 0x04, 0x00, 0x61, 0x63, 0x64, 0x6E,
+    0x84, 0x14, 0x00, 0xFE, 0x7C, 0x00, 0x26, 0x0E, 0x00, 0x08, 0x7D, 0x00, 0x01, 0x00, 0x65, 0x10,
+    0x7D, 0x00, 0x02, 0x00, 0x67, 0x6E, 0xB0, 0x09, 0x00, 0x10, 0x2C, 0x00, 0x02, 0x00, 0x69, 0x72,
+    0x72, 0x35, 0x00, 0x78, 0x76, 0x00, 0x02, 0x01, 0x14, 0x00, 0x63, 0x6E, 0x9C, 0x0C, 0x00, 0x84,
+    0x14, 0x00, 0x01, 0x01, 0x14, 0x00, 0x69, 0x16, 0x7D, 0x00, 0x01, 0x01, 0x11, 0x00, 0x6F, 0xFC,
+    0x39, 0x00, 0x02, 0x00, 0x6E, 0x73, 0x84, 0x14, 0x00, 0xE4, 0x58, 0x00, 0x04, 0x00, 0x63, 0x6F,
+    0x73, 0x75, 0x02, 0x33, 0x00, 0x84, 0x14, 0x00, 0x02, 0x33, 0x00, 0x26, 0x0E, 0x00, 0x01, 0x00,
+    0x65, 0x1C, 0x7D, 0x00, 0x05, 0x00, 0x64, 0x6D, 0x72, 0x74, 0x75, 0xEA, 0x39, 0x00, 0x22, 0x7D,
+    0x00, 0x2C, 0x7D, 0x00, 0x32, 0x7D, 0x00, 0x84, 0x14, 0x00, 0x02, 0x01, 0x13, 0x00, 0x70, 0x75,
+    0x38, 0x7D, 0x00, 0xDA, 0x6B, 0x00, 0x02, 0x00, 0x65, 0x69, 0x32, 0x72, 0x00, 0x3E, 0x7D, 0x00,
+    0x02, 0x00, 0x65, 0x69, 0x32, 0x3B, 0x00, 0x32, 0x3B, 0x00, 0x01, 0x00, 0x64, 0x84, 0x14, 0x00,
+    0x02, 0x00, 0x64, 0x72, 0x32, 0x3B, 0x00, 0x46, 0x7D, 0x00, 0x02, 0x01, 0x11, 0x00, 0x61, 0x65,
+    0x8A, 0x48, 0x00, 0xFA, 0x53, 0x00, 0x03, 0x00, 0x6E, 0x73, 0x74, 0x98, 0x75, 0x00, 0x4E, 0x7D,
+    0x00, 0x84, 0x14, 0x00, 0x02, 0x00, 0x6E, 0x73, 0x26, 0x0E, 0x00, 0xEA, 0x3E, 0x00, 0x04, 0x01,
+    0x12, 0x00, 0x2E, 0x67, 0x6C, 0x6E, 0x26, 0x0E, 0x00, 0x3C, 0x73, 0x00, 0x74, 0x69, 0x00, 0x54,
+    0x7D, 0x00, 0x04, 0x00, 0x61, 0x69, 0x73, 0x77, 0x5A, 0x7D, 0x00, 0x72, 0x35, 0x00, 0x62, 0x7D,
+    0x00, 0xDA, 0x6B, 0x00, 0x07, 0x00, 0x61, 0x63, 0x6C, 0x6E, 0x6F, 0x74, 0x75, 0x32, 0x0D, 0x00,
+    0xEE, 0x42, 0x00, 0x26, 0x0E, 0x00, 0x02, 0x33, 0x00, 0x74, 0x0A, 0x00, 0x1C, 0x7D, 0x00, 0x84,
+    0x14, 0x00, 0x01, 0x00, 0x65, 0x58, 0x2F, 0x00, 0x02, 0x00, 0x66, 0x75, 0x26, 0x0E, 0x00, 0x98,
+    0x75, 0x00, 0x01, 0x00, 0x68, 0x4C, 0x38, 0x00, 0x02, 0x00, 0x65, 0x74, 0x6C, 0x7D, 0x00, 0xDA,
+    0x6B, 0x00, 0x03, 0x00, 0x68, 0x69, 0x79, 0x74, 0x7D, 0x00, 0x86, 0x7D, 0x00, 0x9C, 0x0C, 0x00,
+    0x01, 0x00, 0x6D, 0x26, 0x0E, 0x00, 0x03, 0x01, 0x1E, 0x00, 0x65, 0x6F, 0x72, 0x9C, 0x0C, 0x00,
+    0x8C, 0x7D, 0x00, 0x26, 0x0E, 0x00, 0x03, 0x00, 0x65, 0x74, 0x75, 0x3E, 0x5F, 0x00, 0x92, 0x7D,
+    0x00, 0x4E, 0x2F, 0x00, 0x03, 0x00, 0x61, 0x68, 0x6F, 0x9C, 0x0C, 0x00, 0xA0, 0x7D, 0x00, 0x9C,
+    0x0C, 0x00, 0x02, 0x00, 0x61, 0x69, 0xA6, 0x7D, 0x00, 0xAE, 0x7D, 0x00, 0x03, 0x00, 0x6C, 0x72,
+    0x73, 0xB8, 0x7D, 0x00, 0xBE, 0x7D, 0x00, 0xC8, 0x7D, 0x00, 0x02, 0x01, 0x0C, 0x00, 0x65, 0x69,
+    0xD0, 0x7D, 0x00, 0x64, 0x77, 0x00, 0x03, 0x00, 0x63, 0x66, 0x73, 0xDA, 0x7D, 0x00, 0x84, 0x14,
+    0x00, 0x84, 0x14, 0x00, 0x02, 0x00, 0x61, 0x6C, 0xE8, 0x7D, 0x00, 0x72, 0x35, 0x00, 0x01, 0x00,
+    0x68, 0x64, 0x6E, 0x00, 0x01, 0x00, 0x74, 0xFC, 0x39, 0x00, 0x02, 0x00, 0x63, 0x64, 0x32, 0x77,
+    0x00, 0x58, 0x2F, 0x00, 0x02, 0x00, 0x6E, 0x72, 0x9C, 0x0C, 0x00, 0xEE, 0x7D, 0x00, 0x03, 0x00,
+    0x61, 0x73, 0x74, 0xFC, 0x7D, 0x00, 0x84, 0x14, 0x00, 0x62, 0x7B, 0x00, 0x01, 0x00, 0x6C, 0xF2,
+    0x6A, 0x00, 0x02, 0x00, 0x6C, 0x73, 0x72, 0x35, 0x00, 0xE4, 0x58, 0x00, 0x01, 0x00, 0x64, 0x02,
+    0x7E, 0x00, 0x03, 0x00, 0x61, 0x65, 0x74, 0x9C, 0x0C, 0x00, 0x9C, 0x0C, 0x00, 0x4E, 0x2F, 0x00,
+    0x01, 0x00, 0x61, 0x08, 0x7E, 0x00, 0x01, 0x01, 0x05, 0x00, 0x6E, 0xDA, 0x6B, 0x00, 0x01, 0x01,
+    0x05, 0x00, 0x6D, 0x12, 0x7E, 0x00, 0x04, 0x00, 0x61, 0x65, 0x74, 0x79, 0x4E, 0x2F, 0x00, 0x86,
+    0x72, 0x00, 0x0C, 0x6D, 0x00, 0x72, 0x35, 0x00, 0x01, 0x01, 0x14, 0x00, 0x75, 0x9C, 0x0C, 0x00,
+    0x04, 0x00, 0x61, 0x64, 0x65, 0x69, 0x18, 0x7E, 0x00, 0xEE, 0x36, 0x00, 0x2A, 0x7E, 0x00, 0x32,
+    0x7E, 0x00, 0x03, 0x00, 0x65, 0x68, 0x72, 0x3A, 0x7E, 0x00, 0x42, 0x7E, 0x00, 0x74, 0x77, 0x00,
+    0x01, 0x02, 0x6E, 0x01, 0x72, 0x4C, 0x7E, 0x00, 0x02, 0x02, 0x2B, 0x01, 0x65, 0x69, 0x4C, 0x38,
+    0x00, 0x52, 0x7E, 0x00, 0x02, 0x01, 0x05, 0x00, 0x64, 0x76, 0x4E, 0x2F, 0x00, 0x5E, 0x7E, 0x00,
+    0x02, 0x00, 0x61, 0x69, 0x9C, 0x0C, 0x00, 0x30, 0x41, 0x00, 0x03, 0x00, 0x61, 0x63, 0x74, 0x8E,
+    0x6E, 0x00, 0x10, 0x2C, 0x00, 0x62, 0x7E, 0x00, 0x08, 0x00, 0x61, 0x69, 0x6D, 0x6E, 0x6F, 0x74,
+    0x75, 0x76, 0x68, 0x7E, 0x00, 0x76, 0x7E, 0x00, 0x7E, 0x7E, 0x00, 0x10, 0x2C, 0x00, 0x80, 0x2F,
+    0x00, 0xAC, 0x35, 0x00, 0xFC, 0x39, 0x00, 0x10, 0x46, 0x00, 0x02, 0x01, 0x1E, 0x00, 0x65, 0x69,
+    0x36, 0x47, 0x00, 0x2A, 0x76, 0x00, 0x01, 0x00, 0x72, 0x64, 0x6E, 0x00, 0x03, 0x00, 0x6E, 0x72,
+    0x73, 0x3E, 0x4D, 0x00, 0x9C, 0x0C, 0x00, 0xAE, 0x6E, 0x00, 0x06, 0x00, 0x63, 0x65, 0x6C, 0x6E,
+    0x73, 0x7A, 0x02, 0x33, 0x00, 0x3A, 0x2E, 0x00, 0x88, 0x7E, 0x00, 0x6A, 0x3A, 0x00, 0x8E, 0x7E,
+    0x00, 0x4C, 0x38, 0x00, 0x03, 0x00, 0x62, 0x6E, 0x72, 0x4C, 0x38, 0x00, 0x94, 0x7E, 0x00, 0x4E,
+    0x2F, 0x00, 0x01, 0x01, 0x13, 0x00, 0x6E, 0xDA, 0x6B, 0x00, 0x03, 0x00, 0x61, 0x69, 0x79, 0x9E,
+    0x7E, 0x00, 0x60, 0x2B, 0x00, 0x9C, 0x0C, 0x00, 0x03, 0x01, 0x05, 0x00, 0x61, 0x65, 0x69, 0x26,
+    0x0E, 0x00, 0x72, 0x35, 0x00, 0x3A, 0x2E, 0x00, 0x02, 0x00, 0x63, 0x6E, 0x4C, 0x38, 0x00, 0x72,
+    0x35, 0x00, 0x01, 0x00, 0x72, 0xA4, 0x7E, 0x00, 0x03, 0x01, 0x1E, 0x00, 0x2E, 0x64, 0x6F, 0x10,
+    0x2C, 0x00, 0xDA, 0x6B, 0x00, 0x10, 0x2C, 0x00, 0x01, 0x02, 0x64, 0x01, 0x6E, 0xDA, 0x6B, 0x00,
+    0x02, 0x00, 0x68, 0x75, 0xAA, 0x7E, 0x00, 0x6E, 0x35, 0x00, 0x02, 0x00, 0x6E, 0x73, 0x4C, 0x38,
+    0x00, 0xAA, 0x4D, 0x00, 0x05, 0x00, 0x61, 0x63, 0x65, 0x67, 0x6E, 0x80, 0x2F, 0x00, 0xB2, 0x7E,
+    0x00, 0x2E, 0x30, 0x00, 0xE6, 0x0A, 0x00, 0xB8, 0x7E, 0x00, 0x01, 0x00, 0x6D, 0xC0, 0x7E, 0x00,
+    0x02, 0x00, 0x6D, 0x74, 0xFC, 0x39, 0x00, 0xC8, 0x7E, 0x00, 0x00, 0x02, 0x5A, 0x01, 0x01, 0x00,
+    0x6E, 0xCC, 0x7E, 0x00, 0x02, 0x00, 0x65, 0x79, 0xD8, 0x7E, 0x00, 0xDE, 0x7E, 0x00, 0x01, 0x02,
+    0x56, 0x01, 0x79, 0x9C, 0x0C, 0x00, 0x01, 0x01, 0x07, 0x00, 0x73, 0x10, 0x46, 0x00, 0x01, 0x01,
+    0x05, 0x00, 0x61, 0x9C, 0x0C, 0x00, 0x01, 0x00, 0x6E, 0x3A, 0x2E, 0x00, 0x01, 0x00, 0x72, 0xFC,
+    0x31, 0x00, 0x05, 0x01, 0x2E, 0x00, 0x64, 0x6C, 0x6E, 0x72, 0x74, 0x10, 0x2C, 0x00, 0x26, 0x0E,
+    0x00, 0x84, 0x14, 0x00, 0x84, 0x14, 0x00, 0x84, 0x14, 0x00, 0x01, 0x00, 0x73, 0xEC, 0x7E, 0x00,
+    0x01, 0x00, 0x79, 0x30, 0x41, 0x00, 0x0A, 0x00, 0x63, 0x65, 0x66, 0x6C, 0x6D, 0x6E, 0x72, 0x73,
+    0x74, 0x76, 0xF2, 0x7E, 0x00, 0x66, 0x5B, 0x00, 0xFC, 0x7E, 0x00, 0x48, 0x39, 0x00, 0x02, 0x7F,
+    0x00, 0x08, 0x7F, 0x00, 0x80, 0x2F, 0x00, 0x0E, 0x7F, 0x00, 0x34, 0x33, 0x00, 0x80, 0x2F, 0x00,
+    0x03, 0x00, 0x65, 0x6E, 0x73, 0x6A, 0x38, 0x00, 0x1C, 0x7F, 0x00, 0x22, 0x7F, 0x00, 0x06, 0x00,
+    0x63, 0x66, 0x67, 0x6C, 0x73, 0x74, 0x2A, 0x7F, 0x00, 0x38, 0x7F, 0x00, 0x3E, 0x7F, 0x00, 0x80,
+    0x2F, 0x00, 0xF6, 0x31, 0x00, 0x10, 0x46, 0x00, 0x01, 0x01, 0x2E, 0x00, 0x75, 0x44, 0x7F, 0x00,
+    0x01, 0x00, 0x62, 0xF6, 0x7B, 0x00, 0x01, 0x00, 0x6D, 0x80, 0x2F, 0x00, 0x01, 0x00, 0x6D, 0x4A,
+    0x7F, 0x00, 0x01, 0x00, 0x6F, 0x50, 0x7F, 0x00, 0x01, 0x01, 0x34, 0x00, 0x65, 0x56, 0x7F, 0x00,
+    0x01, 0x00, 0x63, 0x80, 0x2F, 0x00, 0x03, 0x01, 0x1E, 0x00, 0x65, 0x72, 0x74, 0xAC, 0x71, 0x00,
+    0x72, 0x35, 0x00, 0x5C, 0x7F, 0x00, 0x03, 0x00, 0x69, 0x73, 0x76, 0x66, 0x7F, 0x00, 0x6C, 0x7F,
+    0x00, 0x32, 0x3B, 0x00, 0x03, 0x00, 0x2E, 0x72, 0x74, 0x72, 0x0C, 0x00, 0x4C, 0x38, 0x00, 0x4C,
+    0x38, 0x00, 0x02, 0x00, 0x6E, 0x76, 0x72, 0x7F, 0x00, 0x78, 0x7F, 0x00, 0x02, 0x01, 0x11, 0x00,
+    0x69, 0x6F, 0x72, 0x35, 0x00, 0x7E, 0x7F, 0x00, 0x02, 0x00, 0x68, 0x6C, 0x84, 0x7F, 0x00, 0x26,
+    0x0E, 0x00, 0x01, 0x00, 0x69, 0x8E, 0x7F, 0x00, 0x02, 0x00, 0x66, 0x74, 0xEE, 0x36, 0x00, 0x4E,
+    0x2F, 0x00, 0x03, 0x00, 0x65, 0x69, 0x6F, 0x98, 0x7F, 0x00, 0xC6, 0x34, 0x00, 0xE8, 0x6F, 0x00,
+    0x05, 0x00, 0x65, 0x67, 0x68, 0x69, 0x6F, 0x34, 0x6D, 0x00, 0xB0, 0x09, 0x00, 0xD2, 0x7A, 0x00,
+    0x10, 0x2C, 0x00, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x72, 0x02, 0x33, 0x00, 0x02, 0x00, 0x65, 0x68,
+    0x34, 0x30, 0x00, 0xCC, 0x36, 0x00, 0x03, 0x00, 0x63, 0x65, 0x69, 0x32, 0x3B, 0x00, 0xA2, 0x7F,
+    0x00, 0x30, 0x3F, 0x00, 0x01, 0x00, 0x69, 0xAA, 0x7F, 0x00, 0x02, 0x00, 0x61, 0x65, 0x48, 0x4B,
+    0x00, 0x86, 0x72, 0x00, 0x01, 0x00, 0x69, 0x0A, 0x3D, 0x00, 0x02, 0x00, 0x62, 0x67, 0x10, 0x2C,
+    0x00, 0x10, 0x2C, 0x00, 0x02, 0x01, 0x15, 0x00, 0x66, 0x6E, 0x4E, 0x2F, 0x00, 0xB0, 0x7F, 0x00,
+    0x01, 0x01, 0x2E, 0x00, 0x6E, 0xDA, 0x6B, 0x00, 0x02, 0x00, 0x61, 0x65, 0x84, 0x14, 0x00, 0xCA,
+    0x2F, 0x00, 0x02, 0x00, 0x62, 0x74, 0xF2, 0x40, 0x00, 0x9C, 0x0C, 0x00, 0x01, 0x00, 0x6D, 0xA4,
+    0x6C, 0x00, 0x01, 0x00, 0x6C, 0x10, 0x2C, 0x00, 0x03, 0x01, 0x1E, 0x00, 0x61, 0x65, 0x6E, 0x4E,
+    0x2F, 0x00, 0xCA, 0x2F, 0x00, 0xBC, 0x7F, 0x00, 0x05, 0x00, 0x6C, 0x6E, 0x72, 0x76, 0x77, 0x02,
+    0x33, 0x00, 0x72, 0x35, 0x00, 0x0C, 0x4A, 0x00, 0x3A, 0x2E, 0x00, 0x9C, 0x0C, 0x00, 0x01, 0x00,
+    0x72, 0xC4, 0x7F, 0x00, 0x04, 0x00, 0x69, 0x6F, 0x72, 0x74, 0xCA, 0x7F, 0x00, 0xD0, 0x7F, 0x00,
+    0x60, 0x2B, 0x00, 0xDA, 0x7F, 0x00, 0x02, 0x02, 0x2B, 0x01, 0x65, 0x69, 0x02, 0x33, 0x00, 0xE0,
+    0x7F, 0x00, 0x04, 0x00, 0x61, 0x65, 0x69, 0x79, 0xEA, 0x7F, 0x00, 0xF0, 0x7F, 0x00, 0x72, 0x35,
+    0x00, 0x9C, 0x0C, 0x00, 0x01, 0x00, 0x69, 0xBA, 0x7C, 0x00, 0x02, 0x00, 0x69, 0x75, 0x02, 0x33,
+    0x00, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x74, 0xF8, 0x7F, 0x00, 0x03, 0x00, 0x69, 0x6F, 0x75, 0x36,
+    0x47, 0x00, 0x02, 0x80, 0x00, 0x02, 0x33, 0x00, 0x03, 0x02, 0x29, 0x01, 0x69, 0x6F, 0x75, 0x10,
+    0x2C, 0x00, 0xDA, 0x6B, 0x00, 0xFC, 0x39, 0x00, 0x04, 0x00, 0x2E, 0x70, 0x73, 0x74, 0x10, 0x2C,
+    0x00, 0xEA, 0x39, 0x00, 0x08, 0x80, 0x00, 0x0E, 0x80, 0x00, 0x03, 0x00, 0x65, 0x69, 0x72, 0x0E,
+    0x52, 0x00, 0x1A, 0x80, 0x00, 0x20, 0x80, 0x00, 0x01, 0x01, 0x15, 0x00, 0x74, 0x48, 0x4B, 0x00,
+    0x04, 0x01, 0x15, 0x00, 0x61, 0x65, 0x69, 0x6F, 0xCA, 0x3C, 0x00, 0x26, 0x80, 0x00, 0xE2, 0x36,
+    0x00, 0x30, 0x80, 0x00, 0x02, 0x00, 0x72, 0x74, 0x72, 0x35, 0x00, 0x84, 0x14, 0x00, 0x04, 0x00,
+    0x63, 0x6E, 0x73, 0x74, 0x84, 0x14, 0x00, 0x36, 0x80, 0x00, 0x26, 0x0E, 0x00, 0x26, 0x0E, 0x00,
+    0x03, 0x01, 0x13, 0x00, 0x62, 0x67, 0x6C, 0x4E, 0x2F, 0x00, 0x9C, 0x0C, 0x00, 0x1C, 0x33, 0x00,
+    0x01, 0x01, 0x05, 0x00, 0x61, 0x80, 0x2F, 0x00, 0x04, 0x00, 0x61, 0x65, 0x69, 0x6F, 0xC4, 0x46,
+    0x00, 0x10, 0x2C, 0x00, 0x3E, 0x80, 0x00, 0x10, 0x2C, 0x00, 0x03, 0x00, 0x6E, 0x72, 0x74, 0x4A,
+    0x80, 0x00, 0x02, 0x33, 0x00, 0xFC, 0x39, 0x00, 0x02, 0x00, 0x61, 0x69, 0x12, 0x4D, 0x00, 0x3A,
+    0x2E, 0x00, 0x01, 0x00, 0x69, 0x9A, 0x71, 0x00, 0x04, 0x00, 0x61, 0x69, 0x6F, 0x70, 0xD6, 0x5A,
+    0x00, 0x32, 0x3B, 0x00, 0x4C, 0x38, 0x00, 0xB0, 0x09, 0x00, 0x04, 0x00, 0x61, 0x64, 0x65, 0x67,
+    0x54, 0x80, 0x00, 0x4E, 0x2F, 0x00, 0x4E, 0x2F, 0x00, 0x4E, 0x2F, 0x00, 0x02, 0x00, 0x68, 0x6C,
+    0x5C, 0x80, 0x00, 0x64, 0x80, 0x00, 0x04, 0x01, 0x2E, 0x00, 0x2E, 0x63, 0x68, 0x70, 0x10, 0x2C,
+    0x00, 0x4E, 0x2F, 0x00, 0x84, 0x14, 0x00, 0x4E, 0x2F, 0x00, 0x04, 0x00, 0x61, 0x65, 0x69, 0x75,
+    0x6C, 0x80, 0x00, 0x72, 0x80, 0x00, 0x80, 0x5B, 0x00, 0x7C, 0x80, 0x00, 0x03, 0x00, 0x65, 0x69,
+    0x6F, 0x84, 0x80, 0x00, 0x80, 0x2F, 0x00, 0x8E, 0x80, 0x00, 0x00, 0x01, 0x26, 0x01, 0x01, 0x00,
+    0x6F, 0x02, 0x33, 0x00, 0x02, 0x00, 0x65, 0x69, 0x9C, 0x0C, 0x00, 0x8E, 0x6E, 0x00, 0x01, 0x00,
+    0x61, 0x94, 0x80, 0x00, 0x01, 0x00, 0x2E, 0x0A, 0x5E, 0x00, 0x02, 0x01, 0x06, 0x00, 0x64, 0x71,
+    0xC6, 0x34, 0x00, 0x9A, 0x80, 0x00, 0x02, 0x00, 0x67, 0x73, 0x10, 0x2C, 0x00, 0xA0, 0x80, 0x00,
+    0x00, 0x02, 0x4E, 0x00, 0x01, 0x00, 0x63, 0x32, 0x3B, 0x00, 0x02, 0x01, 0x2E, 0x00, 0x6E, 0x72,
+    0x84, 0x14, 0x00, 0x90, 0x6F, 0x00, 0x03, 0x00, 0x6E, 0x6F, 0x74, 0xA8, 0x80, 0x00, 0x10, 0x2C,
+    0x00, 0x84, 0x14, 0x00, 0x04, 0x00, 0x6C, 0x72, 0x74, 0x79, 0x84, 0x14, 0x00, 0x10, 0x2C, 0x00,
+    0x26, 0x0E, 0x00, 0x84, 0x14, 0x00, 0x04, 0x00, 0x63, 0x73, 0x74, 0x76, 0x26, 0x0E, 0x00, 0xAE,
+    0x80, 0x00, 0x84, 0x14, 0x00, 0x84, 0x14, 0x00, 0x01, 0x01, 0x06, 0x00, 0x75, 0x10, 0x2C, 0x00,
+    0x02, 0x00, 0x6C, 0x6F, 0x80, 0x2F, 0x00, 0xB2, 0x80, 0x00, 0x01, 0x01, 0x2E, 0x00, 0x72, 0x72,
+    0x35, 0x00, 0x02, 0x01, 0x0B, 0x00, 0x6C, 0x70, 0xD2, 0x7A, 0x00, 0xB8, 0x80, 0x00, 0x02, 0x00,
+    0x65, 0x69, 0x02, 0x33, 0x00, 0xE2, 0x36, 0x00, 0x01, 0x01, 0x15, 0x00, 0x65, 0x0C, 0x4A, 0x00,
+    0x01, 0x00, 0x65, 0x66, 0x43, 0x00, 0x03, 0x00, 0x65, 0x69, 0x70, 0xBE, 0x80, 0x00, 0x4E, 0x2F,
+    0x00, 0x4E, 0x2F, 0x00, 0x04, 0x00, 0x61, 0x65, 0x69, 0x74, 0x7C, 0x55, 0x00, 0x4E, 0x2F, 0x00,
+    0xC8, 0x80, 0x00, 0x48, 0x39, 0x00, 0x02, 0x00, 0x6D, 0x74, 0xC6, 0x0E, 0x00, 0x3A, 0x2E, 0x00,
+    0x02, 0x00, 0x65, 0x69, 0x4E, 0x32, 0x00, 0x80, 0x5B, 0x00, 0x02, 0x00, 0x69, 0x6F, 0x80, 0x2F,
+    0x00, 0xFC, 0x39, 0x00, 0x02, 0x00, 0x70, 0x73, 0x8A, 0x3A, 0x00, 0x4E, 0x2F, 0x00, 0x03, 0x00,
+    0x68, 0x72, 0x79, 0x60, 0x2B, 0x00, 0xCE, 0x80, 0x00, 0x9C, 0x0C, 0x00, 0x02, 0x00, 0x61, 0x65,
+    0x9C, 0x0C, 0x00, 0x20, 0x71, 0x00, 0x01, 0x00, 0x75, 0xD4, 0x80, 0x00, 0x04, 0x00, 0x61, 0x6E,
+    0x72, 0x74, 0x10, 0x2C, 0x00, 0x10, 0x41, 0x00, 0x94, 0x6E, 0x00, 0x84, 0x14, 0x00, 0x00, 0x02,
+    0xFF, 0x00, 0x04, 0x00, 0x63, 0x66, 0x6F, 0x73, 0x4E, 0x2F, 0x00, 0x4E, 0x2F, 0x00, 0x10, 0x2C,
+    0x00, 0x2E, 0x2F, 0x00, 0x02, 0x00, 0x6F, 0x76, 0x4E, 0x2F, 0x00, 0x4E, 0x2F, 0x00, 0x02, 0x00,
+    0x6E, 0x73, 0xDA, 0x6B, 0x00, 0xDA, 0x6B, 0x00, 0x01, 0x01, 0x12, 0x00, 0x74, 0xEE, 0x36, 0x00,
+    0x04, 0x01, 0x2E, 0x00, 0x63, 0x72, 0x73, 0x76, 0xDA, 0x80, 0x00, 0xE2, 0x80, 0x00, 0x72, 0x35,
+    0x00, 0xEC, 0x80, 0x00, 0x01, 0x01, 0x12, 0x00, 0x61, 0x26, 0x0E, 0x00, 0x01, 0x01, 0x12, 0x00,
+    0x62, 0xF2, 0x40, 0x00, 0x01, 0x00, 0x6E, 0xA4, 0x6C, 0x00, 0x02, 0x00, 0x63, 0x67, 0xF0, 0x80,
+    0x00, 0x10, 0x2C, 0x00, 0x03, 0x00, 0x62, 0x6E, 0x6F, 0x84, 0x14, 0x00, 0xB8, 0x73, 0x00, 0x32,
+    0x3B, 0x00, 0x01, 0x00, 0x6F, 0x94, 0x80, 0x00, 0x07, 0x01, 0x12, 0x00, 0x62, 0x64, 0x65, 0x67,
+    0x6C, 0x73, 0x76, 0xFC, 0x39, 0x00, 0x4E, 0x2F, 0x00, 0x06, 0x48, 0x00, 0x84, 0x14, 0x00, 0xF6,
+    0x80, 0x00, 0x42, 0x3E, 0x00, 0x10, 0x2C, 0x00, 0x03, 0x00, 0x65, 0x69, 0x6F, 0x94, 0x80, 0x00,
+    0x84, 0x14, 0x00, 0x04, 0x81, 0x00, 0x02, 0x00, 0x6C, 0x6E, 0xC8, 0x41, 0x00, 0x72, 0x35, 0x00,
+    0x01, 0x00, 0x70, 0x86, 0x72, 0x00, 0x02, 0x01, 0x1E, 0x00, 0x6B, 0x74, 0xA0, 0x6C, 0x00, 0x0C,
+    0x6D, 0x00, 0x01, 0x00, 0x69, 0x96, 0x6D, 0x00, 0x06, 0x01, 0x0B, 0x00, 0x69, 0x6C, 0x6E, 0x72,
+    0x73, 0x79, 0x0A, 0x81, 0x00, 0x94, 0x35, 0x00, 0x84, 0x14, 0x00, 0x94, 0x6E, 0x00, 0x10, 0x41,
+    0x00, 0x84, 0x14, 0x00, 0x02, 0x00, 0x63, 0x76, 0x84, 0x14, 0x00, 0x4E, 0x2F, 0x00, 0x01, 0x00,
+    0x67, 0x10, 0x81, 0x00, 0x01, 0x00, 0x63, 0x02, 0x33, 0x00, 0x03, 0x00, 0x6B, 0x72, 0x74, 0x3A,
+    0x2E, 0x00, 0xAC, 0x35, 0x00, 0x84, 0x14, 0x00, 0x05, 0x00, 0x61, 0x65, 0x6D, 0x6F, 0x74, 0x20,
+    0x77, 0x00, 0x16, 0x81, 0x00, 0x4E, 0x2F, 0x00, 0xFC, 0x39, 0x00, 0x4E, 0x2F, 0x00, 0x02, 0x00,
+    0x63, 0x64, 0x4C, 0x38, 0x00, 0xB0, 0x09, 0x00, 0x01, 0x01, 0x12, 0x00, 0x61, 0x1C, 0x81, 0x00,
+    0x03, 0x00, 0x61, 0x69, 0x75, 0xFC, 0x39, 0x00, 0x22, 0x81, 0x00, 0x80, 0x2F, 0x00, 0x01, 0x00,
+    0x6F, 0x0C, 0x4A, 0x00, 0x04, 0x00, 0x6E, 0x70, 0x74, 0x76, 0x28, 0x81, 0x00, 0x2E, 0x81, 0x00,
+    0x36, 0x81, 0x00, 0xA0, 0x6C, 0x00, 0x03, 0x00, 0x64, 0x69, 0x73, 0x10, 0x2C, 0x00, 0xE6, 0x0A,
+    0x00, 0x10, 0x2C, 0x00, 0x03, 0x01, 0x15, 0x00, 0x69, 0x6F, 0x72, 0x3C, 0x81, 0x00, 0x10, 0x2C,
+    0x00, 0x42, 0x81, 0x00, 0x03, 0x00, 0x65, 0x6E, 0x75, 0x46, 0x76, 0x00, 0x48, 0x81, 0x00, 0x4E,
+    0x81, 0x00, 0x02, 0x00, 0x65, 0x69, 0xA0, 0x6C, 0x00, 0x10, 0x2C, 0x00, 0x03, 0x00, 0x66, 0x70,
+    0x75, 0xDA, 0x6B, 0x00, 0xFC, 0x4C, 0x00, 0x1C, 0x78, 0x00, 0x01, 0x00, 0x61, 0x54, 0x81, 0x00,
+    0x01, 0x00, 0x74, 0x5A, 0x81, 0x00, 0x02, 0x01, 0x0B, 0x00, 0x73, 0x77, 0xDA, 0x6B, 0x00, 0x32,
+    0x3B, 0x00, 0x02, 0x00, 0x6F, 0x74, 0xB2, 0x63, 0x00, 0x4C, 0x38, 0x00, 0x02, 0x02, 0xFD, 0x00,
+    0x65, 0x6C, 0x3E, 0x5F, 0x00, 0x26, 0x0E, 0x00, 0x01, 0x01, 0x1E, 0x00, 0x72, 0x80, 0x2F, 0x00,
+    0x03, 0x00, 0x65, 0x66, 0x76, 0x02, 0x33, 0x00, 0x3A, 0x2E, 0x00, 0x3A, 0x2E, 0x00, 0x04, 0x00,
+    0x61, 0x65, 0x69, 0x6F, 0x60, 0x81, 0x00, 0x66, 0x81, 0x00, 0x6E, 0x81, 0x00, 0xCA, 0x3C, 0x00,
+    0x07, 0x00, 0x61, 0x63, 0x64, 0x65, 0x67, 0x69, 0x74, 0xDE, 0x6B, 0x00, 0xE6, 0x0A, 0x00, 0x4E,
+    0x2F, 0x00, 0x74, 0x81, 0x00, 0x32, 0x3B, 0x00, 0x8A, 0x48, 0x00, 0x7A, 0x81, 0x00, 0x02, 0x00,
+    0x61, 0x74, 0x84, 0x81, 0x00, 0x88, 0x81, 0x00, 0x04, 0x00, 0x2E, 0x6C, 0x6F, 0x76, 0x3C, 0x0C,
+    0x00, 0x10, 0x2C, 0x00, 0x4E, 0x2F, 0x00, 0xAC, 0x48, 0x00, 0x02, 0x02, 0x20, 0x00, 0x68, 0x74,
+    0xFC, 0x39, 0x00, 0x32, 0x3B, 0x00, 0x01, 0x00, 0x6D, 0xC0, 0x77, 0x00, 0x01, 0x01, 0x0D, 0x00,
+    0x65, 0xE2, 0x70, 0x00, 0x02, 0x00, 0x72, 0x76, 0x02, 0x33, 0x00, 0x3A, 0x2E, 0x00, 0x04, 0x00,
+    0x6E, 0x6F, 0x70, 0x76, 0x02, 0x33, 0x00, 0x72, 0x35, 0x00, 0x4C, 0x38, 0x00, 0xA0, 0x6C, 0x00,
+    0x04, 0x01, 0x06, 0x00, 0x65, 0x6C, 0x6E, 0x72, 0x8E, 0x81, 0x00, 0xEA, 0x4F, 0x00, 0xA4, 0x6C,
+    0x00, 0x94, 0x81, 0x00, 0x02, 0x00, 0x65, 0x69, 0x9C, 0x81, 0x00, 0xA8, 0x72, 0x00, 0x01, 0x00,
+    0x6E, 0xA8, 0x44, 0x00, 0x02, 0x00, 0x65, 0x79, 0x4E, 0x2F, 0x00, 0xE6, 0x0A, 0x00, 0x03, 0x02,
+    0x0E, 0x00, 0x61, 0x65, 0x67, 0xC6, 0x34, 0x00, 0x66, 0x43, 0x00, 0x84, 0x14, 0x00, 0x01, 0x01,
+    0x07, 0x00, 0x6E, 0xAA, 0x81, 0x00, 0x02, 0x01, 0x1E, 0x00, 0x61, 0x65, 0x32, 0x3B, 0x00, 0xB2,
+    0x81, 0x00, 0x01, 0x00, 0x69, 0xD6, 0x70, 0x00, 0x01, 0x01, 0x0C, 0x00, 0x74, 0x84, 0x14, 0x00,
+    0x01, 0x00, 0x6E, 0xB8, 0x81, 0x00, 0x01, 0x00, 0x73, 0xC2, 0x81, 0x00, 0x01, 0x00, 0x74, 0x88,
+    0x70, 0x00, 0x01, 0x00, 0x76, 0xC8, 0x81, 0x00, 0x02, 0x01, 0x10, 0x00, 0x6C, 0x6E, 0xEE, 0x6C,
+    0x00, 0xA4, 0x6C, 0x00, 0x02, 0x00, 0x6C, 0x6E, 0xDA, 0x6B, 0x00, 0x26, 0x0E, 0x00, 0x01, 0x00,
+    0x74, 0xCE, 0x81, 0x00, 0x01, 0x00, 0x6C, 0xD4, 0x81, 0x00, 0x01, 0x00, 0x61, 0xDA, 0x81, 0x00,
+    0x05, 0x00, 0x61, 0x64, 0x69, 0x75, 0x76, 0xE0, 0x81, 0x00, 0xE6, 0x81, 0x00, 0xBC, 0x6B, 0x00,
+    0xEA, 0x81, 0x00, 0x3A, 0x2E, 0x00, 0x03, 0x00, 0x2E, 0x61, 0x67, 0x46, 0x76, 0x00, 0xDA, 0x6B,
+    0x00, 0x4E, 0x2F, 0x00, 0x01, 0x01, 0x05, 0x00, 0x68, 0xF0, 0x81, 0x00, 0x02, 0x00, 0x63, 0x64,
+    0x32, 0x3B, 0x00, 0x32, 0x3B, 0x00, 0x01, 0x01, 0x0C, 0x00, 0x69, 0xFC, 0x39, 0x00, 0x03, 0x01,
+    0x11, 0x00, 0x63, 0x69, 0x6E, 0xFA, 0x81, 0x00, 0x3A, 0x2E, 0x00, 0x4E, 0x2F, 0x00, 0x04, 0x00,
+    0x63, 0x6E, 0x6F, 0x72, 0x04, 0x82, 0x00, 0xB8, 0x73, 0x00, 0xF0, 0x38, 0x00, 0x72, 0x0C, 0x00,
+    0x02, 0x00, 0x65, 0x6F, 0x0A, 0x82, 0x00, 0xA0, 0x6C, 0x00, 0x04, 0x00, 0x63, 0x6C, 0x6E, 0x6F,
+    0x12, 0x82, 0x00, 0xDA, 0x6B, 0x00, 0x6A, 0x3A, 0x00, 0xE6, 0x0A, 0x00, 0x04, 0x00, 0x6B, 0x6E,
+    0x72, 0x74, 0x18, 0x82, 0x00, 0x10, 0x2C, 0x00, 0x1E, 0x82, 0x00, 0xE6, 0x0A, 0x00, 0x02, 0x00,
+    0x61, 0x69, 0x26, 0x82, 0x00, 0x2C, 0x82, 0x00, 0x02, 0x01, 0x12, 0x00, 0x63, 0x73, 0x32, 0x82,
+    0x00, 0xA4, 0x6C, 0x00, 0x00, 0x02, 0xD7, 0x00, 0x04, 0x00, 0x6C, 0x6E, 0x73, 0x74, 0x84, 0x14,
+    0x00, 0xF8, 0x55, 0x00, 0x76, 0x7B, 0x00, 0x26, 0x0E, 0x00, 0x01, 0x00, 0x61, 0x58, 0x6F, 0x00,
+    0x04, 0x01, 0x12, 0x00, 0x61, 0x65, 0x67, 0x6C, 0x38, 0x82, 0x00, 0x3E, 0x82, 0x00, 0x46, 0x82,
+    0x00, 0x22, 0x33, 0x00, 0x01, 0x01, 0x05, 0x00, 0x69, 0x9C, 0x0C, 0x00, 0x01, 0x00, 0x65, 0x4C,
+    0x82, 0x00, 0x07, 0x00, 0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x74, 0xC6, 0x34, 0x00, 0xC6, 0x34,
+    0x00, 0x52, 0x82, 0x00, 0x5C, 0x82, 0x00, 0xF2, 0x40, 0x00, 0x66, 0x82, 0x00, 0x6C, 0x82, 0x00,
+    0x03, 0x00, 0x64, 0x72, 0x77, 0x10, 0x2C, 0x00, 0x76, 0x82, 0x00, 0x80, 0x82, 0x00, 0x07, 0x01,
+    0x1E, 0x00, 0x2E, 0x61, 0x63, 0x65, 0x66, 0x6E, 0x72, 0x10, 0x2C, 0x00, 0x26, 0x0E, 0x00, 0x88,
+    0x82, 0x00, 0x10, 0x2C, 0x00, 0x84, 0x14, 0x00, 0x98, 0x75, 0x00, 0x3A, 0x2E, 0x00, 0x01, 0x00,
+    0x65, 0x74, 0x0A, 0x00, 0x05, 0x00, 0x63, 0x6D, 0x6E, 0x70, 0x72, 0xB6, 0x74, 0x00, 0x6A, 0x6B,
+    0x00, 0x10, 0x81, 0x00, 0x10, 0x2C, 0x00, 0x90, 0x82, 0x00, 0x03, 0x01, 0x0B, 0x00, 0x61, 0x69,
+    0x79, 0x9A, 0x82, 0x00, 0xA8, 0x82, 0x00, 0xE6, 0x0A, 0x00, 0x01, 0x00, 0x63, 0x0C, 0x4A, 0x00,
+    0x01, 0x00, 0x70, 0xB2, 0x82, 0x00, 0x01, 0x01, 0x2E, 0x00, 0x6C, 0xB8, 0x82, 0x00, 0x00, 0x02,
+    0xC0, 0x00, 0x00, 0x02, 0xBE, 0x00, 0x02, 0x00, 0x73, 0x74, 0xFC, 0x39, 0x00, 0xA4, 0x6C, 0x00,
+    0x01, 0x01, 0x1E, 0x00, 0x69, 0x80, 0x2F, 0x00, 0x01, 0x00, 0x65, 0xBE, 0x82, 0x00, 0x01, 0x00,
+    0x6D, 0xC4, 0x82, 0x00, 0x02, 0x00, 0x63, 0x6F, 0xC6, 0x0E, 0x00, 0x32, 0x3B, 0x00, 0x01, 0x00,
+    0x69, 0x36, 0x47, 0x00, 0x01, 0x00, 0x68, 0xCA, 0x82, 0x00, 0x02, 0x01, 0x11, 0x00, 0x6C, 0x6F,
+    0xD0, 0x82, 0x00, 0xD6, 0x82, 0x00, 0x01, 0x00, 0x6F, 0xDC, 0x82, 0x00, 0x01, 0x00, 0x6C, 0x48,
+    0x71, 0x00, 0x06, 0x01, 0x1E, 0x00, 0x61, 0x65, 0x69, 0x6B, 0x6C, 0x6F, 0xFC, 0x39, 0x00, 0x12,
+    0x4D, 0x00, 0x80, 0x2F, 0x00, 0xE2, 0x82, 0x00, 0x6A, 0x64, 0x00, 0x6A, 0x3A, 0x00, 0x02, 0x00,
+    0x69, 0x6F, 0xEA, 0x82, 0x00, 0xFC, 0x39, 0x00, 0x02, 0x00, 0x64, 0x74, 0xB0, 0x09, 0x00, 0xF0,
+    0x82, 0x00, 0x03, 0x00, 0x61, 0x65, 0x6C, 0xF6, 0x82, 0x00, 0x0C, 0x4A, 0x00, 0xFC, 0x39, 0x00,
+    0x05, 0x00, 0x61, 0x63, 0x65, 0x69, 0x72, 0x4E, 0x2F, 0x00, 0xE6, 0x0A, 0x00, 0xE6, 0x0A, 0x00,
+    0x56, 0x70, 0x00, 0xFC, 0x82, 0x00, 0x02, 0x00, 0x65, 0x79, 0x4E, 0x2F, 0x00, 0xFC, 0x39, 0x00,
+    0x02, 0x00, 0x69, 0x75, 0xBA, 0x6E, 0x00, 0x0E, 0x52, 0x00, 0x01, 0x00, 0x69, 0x02, 0x83, 0x00,
+    0x03, 0x01, 0x05, 0x00, 0x63, 0x65, 0x69, 0x10, 0x46, 0x00, 0xDE, 0x6B, 0x00, 0x08, 0x83, 0x00,
+    0x03, 0x00, 0x63, 0x64, 0x74, 0x0E, 0x83, 0x00, 0x94, 0x35, 0x00, 0xE6, 0x0A, 0x00, 0x02, 0x00,
+    0x65, 0x74, 0xDA, 0x6B, 0x00, 0x3A, 0x2E, 0x00, 0x01, 0x02, 0x0E, 0x00, 0x69, 0xFC, 0x39, 0x00,
+    0x02, 0x01, 0x06, 0x00, 0x65, 0x69, 0x0C, 0x4A, 0x00, 0xFC, 0x39, 0x00, 0x04, 0x00, 0x2E, 0x65,
+    0x69, 0x73, 0x4C, 0x38, 0x00, 0x14, 0x83, 0x00, 0xDA, 0x6B, 0x00, 0x3A, 0x2E, 0x00, 0x01, 0x00,
+    0x61, 0x1E, 0x83, 0x00, 0x05, 0x00, 0x61, 0x63, 0x64, 0x65, 0x74, 0x76, 0x65, 0x00, 0x4C, 0x38,
+    0x00, 0x4C, 0x38, 0x00, 0xB2, 0x4B, 0x00, 0x26, 0x83, 0x00, 0x01, 0x01, 0x0B, 0x00, 0x65, 0xFC,
+    0x39, 0x00, 0x06, 0x00, 0x63, 0x64, 0x67, 0x69, 0x6E, 0x76, 0x80, 0x2F, 0x00, 0x2E, 0x83, 0x00,
+    0x32, 0x83, 0x00, 0x38, 0x83, 0x00, 0x4C, 0x83, 0x00, 0x32, 0x3B, 0x00, 0x02, 0x00, 0x2E, 0x73,
+    0xE6, 0x0A, 0x00, 0x52, 0x83, 0x00, 0x01, 0x00, 0x68, 0x9A, 0x2F, 0x00, 0x02, 0x00, 0x6C, 0x6E,
+    0x5E, 0x83, 0x00, 0xDA, 0x6B, 0x00, 0x03, 0x01, 0x1E, 0x00, 0x61, 0x69, 0x74, 0x64, 0x83, 0x00,
+    0xBA, 0x7C, 0x00, 0x4C, 0x38, 0x00, 0x03, 0x00, 0x63, 0x6C, 0x6E, 0x70, 0x83, 0x00, 0xE6, 0x0A,
+    0x00, 0xB6, 0x74, 0x00, 0x05, 0x00, 0x64, 0x67, 0x6B, 0x6F, 0x72, 0x7A, 0x83, 0x00, 0x88, 0x83,
+    0x00, 0x8E, 0x83, 0x00, 0xE6, 0x0A, 0x00, 0x94, 0x83, 0x00, 0x02, 0x00, 0x6C, 0x73, 0x9A, 0x83,
+    0x00, 0x80, 0x5B, 0x00, 0x03, 0x01, 0x07, 0x00, 0x62, 0x6E, 0x74, 0x9C, 0x0C, 0x00, 0xA0, 0x83,
+    0x00, 0x44, 0x19, 0x00, 0x00, 0x02, 0x68, 0x00, 0x03, 0x00, 0x6B, 0x6F, 0x75, 0xE6, 0x0A, 0x00,
+    0x10, 0x2C, 0x00, 0xA6, 0x83, 0x00, 0x01, 0x00, 0x6E, 0x4C, 0x38, 0x00, 0x01, 0x01, 0x15, 0x00,
+    0x79, 0xFC, 0x39, 0x00, 0x01, 0x01, 0x11, 0x00, 0x75, 0x3A, 0x2E, 0x00, 0x01, 0x00, 0x6C, 0x02,
+    0x60, 0x00, 0x02, 0x01, 0x07, 0x00, 0x70, 0x75, 0xE6, 0x0A, 0x00, 0x20, 0x71, 0x00, 0x04, 0x02,
+    0x0E, 0x00, 0x61, 0x65, 0x69, 0x6F, 0xC6, 0x34, 0x00, 0xA2, 0x72, 0x00, 0x4C, 0x38, 0x00, 0xAA,
+    0x83, 0x00, 0x02, 0x01, 0x07, 0x00, 0x63, 0x6E, 0xFC, 0x39, 0x00, 0xB0, 0x83, 0x00, 0x06, 0x00,
+    0x61, 0x65, 0x6D, 0x6F, 0x70, 0x74, 0x72, 0x35, 0x00, 0x4C, 0x38, 0x00, 0x4E, 0x2F, 0x00, 0xFC,
+    0x39, 0x00, 0x4E, 0x2F, 0x00, 0xB6, 0x83, 0x00, 0x01, 0x01, 0x07, 0x00, 0x61, 0x4E, 0x2F, 0x00,
+    0x02, 0x01, 0x07, 0x00, 0x61, 0x65, 0x72, 0x35, 0x00, 0x3A, 0x45, 0x00, 0x01, 0x01, 0x1D, 0x00,
+    0x6E, 0xDA, 0x6B, 0x00, 0x04, 0x00, 0x2E, 0x64, 0x73, 0x74, 0x4C, 0x38, 0x00, 0x4C, 0x38, 0x00,
+    0xA2, 0x72, 0x00, 0x82, 0x6A, 0x00, 0x01, 0x00, 0x65, 0xBC, 0x83, 0x00, 0x01, 0x00, 0x72, 0x3A,
+    0x32, 0x00, 0x01, 0x00, 0x72, 0x6E, 0x35, 0x00, 0x01, 0x00, 0x63, 0xFC, 0x39, 0x00, 0x01, 0x00,
+    0x6F, 0xC2, 0x83, 0x00, 0x03, 0x00, 0x61, 0x62, 0x79, 0x6E, 0x35, 0x00, 0x4E, 0x2F, 0x00, 0x72,
+    0x35, 0x00, 0x03, 0x00, 0x61, 0x6F, 0x79, 0xC8, 0x83, 0x00, 0xE6, 0x0A, 0x00, 0xE6, 0x0A, 0x00,
+    0x02, 0x00, 0x61, 0x69, 0x6E, 0x35, 0x00, 0xD2, 0x83, 0x00, 0x02, 0x00, 0x72, 0x74, 0x3A, 0x2E,
+    0x00, 0xE6, 0x0A, 0x00, 0x01, 0x00, 0x61, 0xD0, 0x4F, 0x00, 0x05, 0x01, 0x07, 0x00, 0x62, 0x63,
+    0x69, 0x73, 0x76, 0x80, 0x2F, 0x00, 0xDC, 0x83, 0x00, 0xEA, 0x83, 0x00, 0xDA, 0x6B, 0x00, 0xF0,
+    0x83, 0x00, 0x03, 0x00, 0x61, 0x66, 0x6D, 0xF6, 0x83, 0x00, 0x32, 0x3B, 0x00, 0xFC, 0x83, 0x00,
+    0x04, 0x00, 0x61, 0x63, 0x6D, 0x76, 0x04, 0x84, 0x00, 0x0C, 0x84, 0x00, 0x72, 0x0C, 0x00, 0x4E,
+    0x2F, 0x00, 0x07, 0x00, 0x66, 0x6C, 0x6D, 0x6E, 0x70, 0x73, 0x76, 0x1A, 0x84, 0x00, 0x20, 0x84,
+    0x00, 0xEE, 0x36, 0x00, 0x26, 0x84, 0x00, 0x30, 0x84, 0x00, 0x3E, 0x84, 0x00, 0x80, 0x2F, 0x00,
+    0x02, 0x00, 0x69, 0x73, 0x32, 0x3B, 0x00, 0xDA, 0x6B, 0x00, 0x01, 0x01, 0x05, 0x00, 0x68, 0x6A,
+    0x31, 0x00, 0x01, 0x00, 0x69, 0x44, 0x84, 0x00, 0x01, 0x01, 0x14, 0x00, 0x72, 0x72, 0x35, 0x00,
+    0x00, 0x02, 0x72, 0x00, 0x01, 0x00, 0x69, 0xD0, 0x6A, 0x00, 0x01, 0x00, 0x2E, 0x30, 0x14, 0x00,
+    0x05, 0x00, 0x65, 0x69, 0x6E, 0x6F, 0x79, 0x4C, 0x38, 0x00, 0x4A, 0x84, 0x00, 0x52, 0x84, 0x00,
+    0x32, 0x3B, 0x00, 0xFC, 0x39, 0x00, 0x03, 0x00, 0x61, 0x65, 0x68, 0x58, 0x84, 0x00, 0xA4, 0x6C,
+    0x00, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x72, 0x5E, 0x84, 0x00, 0x02, 0x00, 0x61, 0x69, 0xFC, 0x39,
+    0x00, 0x4E, 0x2F, 0x00, 0x04, 0x00, 0x61, 0x64, 0x69, 0x74, 0x64, 0x84, 0x00, 0x58, 0x2F, 0x00,
+    0x80, 0x2F, 0x00, 0x80, 0x2F, 0x00, 0x02, 0x01, 0x0B, 0x00, 0x6C, 0x72, 0x10, 0x2C, 0x00, 0x6A,
+    0x84, 0x00, 0x01, 0x02, 0x20, 0x00, 0x6E, 0x72, 0x84, 0x00, 0x01, 0x00, 0x65, 0x1C, 0x33, 0x00,
+    0x02, 0x00, 0x62, 0x74, 0x4E, 0x2F, 0x00, 0x9C, 0x0C, 0x00, 0x03, 0x00, 0x72, 0x73, 0x76, 0x72,
+    0x35, 0x00, 0xE4, 0x58, 0x00, 0xDA, 0x6B, 0x00, 0x04, 0x00, 0x63, 0x65, 0x73, 0x74, 0x74, 0x0A,
+    0x00, 0x78, 0x84, 0x00, 0xFC, 0x39, 0x00, 0x26, 0x0E, 0x00, 0x01, 0x00, 0x6E, 0x82, 0x84, 0x00,
+    0x01, 0x00, 0x6D, 0x10, 0x46, 0x00, 0x03, 0x00, 0x65, 0x73, 0x74, 0x10, 0x2C, 0x00, 0xDA, 0x6B,
+    0x00, 0xB0, 0x09, 0x00, 0x01, 0x00, 0x69, 0x7C, 0x55, 0x00, 0x01, 0x00, 0x65, 0xE2, 0x70, 0x00,
+    0x01, 0x01, 0x0B, 0x00, 0x67, 0x74, 0x0A, 0x00, 0x01, 0x00, 0x6D, 0x4E, 0x2F, 0x00, 0x01, 0x00,
+    0x61, 0xDA, 0x6B, 0x00, 0x01, 0x01, 0x34, 0x00, 0x65, 0xB6, 0x7A, 0x00, 0x02, 0x01, 0x12, 0x00,
+    0x62, 0x74, 0x32, 0x3B, 0x00, 0x66, 0x2D, 0x00, 0x01, 0x00, 0x68, 0x8A, 0x84, 0x00, 0x01, 0x01,
+    0x0B, 0x00, 0x6E, 0x74, 0x0A, 0x00, 0x03, 0x01, 0x1E, 0x00, 0x61, 0x6E, 0x73, 0x26, 0x0E, 0x00,
+    0x98, 0x75, 0x00, 0xB8, 0x35, 0x00, 0x02, 0x00, 0x61, 0x69, 0x0E, 0x52, 0x00, 0x92, 0x84, 0x00,
+    0x01, 0x01, 0x0C, 0x00, 0x65, 0xC4, 0x46, 0x00, 0x03, 0x00, 0x69, 0x72, 0x75, 0x02, 0x33, 0x00,
+    0xF0, 0x82, 0x00, 0xE6, 0x0A, 0x00, 0x01, 0x01, 0x10, 0x00, 0x6C, 0xFC, 0x39, 0x00, 0x01, 0x00,
+    0x62, 0xFC, 0x39, 0x00, 0x02, 0x00, 0x69, 0x6C, 0x9C, 0x0C, 0x00, 0xD2, 0x36, 0x00, 0x01, 0x01,
+    0x12, 0x00, 0x6E, 0xDA, 0x73, 0x00, 0x01, 0x00, 0x72, 0x34, 0x6D, 0x00, 0x01, 0x01, 0x2E, 0x00,
+    0x72, 0x9C, 0x0C, 0x00, 0x04, 0x01, 0x12, 0x00, 0x6D, 0x6E, 0x73, 0x76, 0x9C, 0x0C, 0x00, 0xC6,
+    0x34, 0x00, 0xB8, 0x35, 0x00, 0x80, 0x2F, 0x00, 0x01, 0x02, 0x60, 0x00, 0x77, 0x9C, 0x0C, 0x00,
+    0x02, 0x00, 0x61, 0x65, 0x9C, 0x84, 0x00, 0xA2, 0x84, 0x00, 0x01, 0x01, 0x12, 0x00, 0x72, 0x30,
+    0x6E, 0x00, 0x02, 0x00, 0x61, 0x6E, 0x26, 0x0E, 0x00, 0x98, 0x75, 0x00, 0x01, 0x01, 0x13, 0x00,
+    0x6F, 0xAC, 0x84, 0x00, 0x02, 0x00, 0x69, 0x75, 0x7C, 0x49, 0x00, 0xDA, 0x6B, 0x00, 0x04, 0x01,
+    0x12, 0x00, 0x2E, 0x67, 0x6C, 0x73, 0xE6, 0x0A, 0x00, 0x10, 0x2C, 0x00, 0xB2, 0x84, 0x00, 0x10,
+    0x2C, 0x00, 0x02, 0x00, 0x65, 0x72, 0x0E, 0x52, 0x00, 0x9C, 0x0C, 0x00, 0x06, 0x00, 0x61, 0x66,
+    0x6E, 0x6F, 0x74, 0x7A, 0xB8, 0x84, 0x00, 0xBE, 0x84, 0x00, 0x02, 0x33, 0x00, 0x84, 0x14, 0x00,
+    0x74, 0x0A, 0x00, 0x72, 0x35, 0x00, 0x01, 0x01, 0x1E, 0x00, 0x69, 0xC6, 0x84, 0x00, 0x02, 0x00,
+    0x65, 0x69, 0x9C, 0x0C, 0x00, 0x9C, 0x0C, 0x00, 0x03, 0x00, 0x65, 0x68, 0x69, 0x90, 0x6F, 0x00,
+    0xB2, 0x38, 0x00, 0xCC, 0x84, 0x00, 0x03, 0x00, 0x64, 0x6E, 0x70, 0x26, 0x0E, 0x00, 0x26, 0x0E,
+    0x00, 0x9C, 0x0C, 0x00, 0x01, 0x01, 0x15, 0x00, 0x69, 0x72, 0x35, 0x00, 0x02, 0x00, 0x61, 0x72,
+    0x32, 0x3B, 0x00, 0x00, 0x73, 0x00, 0x02, 0x00, 0x61, 0x63, 0x26, 0x0E, 0x00, 0x84, 0x14, 0x00,
+    0x02, 0x00, 0x65, 0x72, 0xD4, 0x84, 0x00, 0x02, 0x33, 0x00, 0x01, 0x01, 0x2E, 0x00, 0x72, 0xDA,
+    0x6B, 0x00, 0x02, 0x00, 0x62, 0x74, 0x4E, 0x2F, 0x00, 0x84, 0x14, 0x00, 0x03, 0x00, 0x2E, 0x6C,
+    0x6E, 0xE6, 0x0A, 0x00, 0xE6, 0x0A, 0x00, 0xDA, 0x84, 0x00, 0x05, 0x03, 0x00, 0x00, 0x6C, 0x6E,
+    0x6F, 0x73, 0x7A, 0x1E, 0x3D, 0x00, 0xE2, 0x84, 0x00, 0xEC, 0x84, 0x00, 0x10, 0x2C, 0x00, 0xF2,
+    0x84, 0x00, 0x00, 0x02, 0x5A, 0x00, 0x05, 0x00, 0x66, 0x67, 0x6D, 0x6E, 0x75, 0xFC, 0x39, 0x00,
+    0x32, 0x3B, 0x00, 0xF6, 0x84, 0x00, 0x26, 0x0E, 0x00, 0x10, 0x2C, 0x00, 0x00, 0x03, 0x57, 0x00,
+    0x02, 0x00, 0x69, 0x75, 0x20, 0x71, 0x00, 0x80, 0x2F, 0x00, 0x02, 0x01, 0x06, 0x00, 0x65, 0x75,
+    0x9C, 0x0C, 0x00, 0xFC, 0x84, 0x00, 0x03, 0x00, 0x69, 0x6F, 0x75, 0x0A, 0x3D, 0x00, 0x32, 0x3B,
+    0x00, 0x10, 0x46, 0x00, 0x01, 0x00, 0x69, 0x2A, 0x76, 0x00, 0x01, 0x00, 0x69, 0x02, 0x85, 0x00,
+    0x01, 0x01, 0x19, 0x00, 0x69, 0x08, 0x85, 0x00, 0x01, 0x00, 0x64, 0x0E, 0x85, 0x00, 0x04, 0x00,
+    0x2E, 0x6C, 0x6F, 0x79, 0x84, 0x14, 0x00, 0xAC, 0x35, 0x00, 0x9C, 0x0C, 0x00, 0x10, 0x2C, 0x00,
+    0x02, 0x00, 0x6F, 0x75, 0x66, 0x5B, 0x00, 0x52, 0x43, 0x00, 0x06, 0x00, 0x64, 0x65, 0x69, 0x6D,
+    0x73, 0x74, 0x10, 0x2C, 0x00, 0x14, 0x85, 0x00, 0x44, 0x6E, 0x00, 0x2A, 0x85, 0x00, 0xCA, 0x6A,
+    0x00, 0x80, 0x15, 0x00, 0x02, 0x02, 0x52, 0x00, 0x2E, 0x74, 0xE6, 0x0A, 0x00, 0x30, 0x85, 0x00,
+    0x02, 0x00, 0x65, 0x79, 0x3A, 0x85, 0x00, 0x9C, 0x0C, 0x00, 0x02, 0x00, 0x6C, 0x6E, 0x48, 0x4B,
+    0x00, 0x3A, 0x2E, 0x00, 0x02, 0x00, 0x65, 0x69, 0x42, 0x85, 0x00, 0x3A, 0x2E, 0x00, 0x01, 0x01,
+    0x11, 0x00, 0x69, 0x54, 0x85, 0x00, 0x04, 0x01, 0x12, 0x00, 0x61, 0x63, 0x64, 0x67, 0x0C, 0x2C,
+    0x00, 0xC6, 0x34, 0x00, 0x32, 0x3B, 0x00, 0xE6, 0x0A, 0x00, 0x03, 0x00, 0x6C, 0x72, 0x75, 0x80,
+    0x2F, 0x00, 0x40, 0x5E, 0x00, 0x02, 0x33, 0x00, 0x03, 0x00, 0x69, 0x6F, 0x75, 0x6C, 0x2E, 0x00,
+    0x72, 0x35, 0x00, 0x72, 0x35, 0x00, 0x03, 0x00, 0x69, 0x72, 0x79, 0xE6, 0x0A, 0x00, 0x80, 0x2F,
+    0x00, 0xE6, 0x0A, 0x00, 0x01, 0x01, 0x19, 0x00, 0x69, 0x5E, 0x85, 0x00, 0x02, 0x01, 0x06, 0x00,
+    0x63, 0x72, 0x64, 0x85, 0x00, 0x6A, 0x85, 0x00, 0x04, 0x00, 0x61, 0x65, 0x74, 0x76, 0x9C, 0x0C,
+    0x00, 0x26, 0x0E, 0x00, 0x3A, 0x2E, 0x00, 0x4C, 0x38, 0x00, 0x03, 0x00, 0x61, 0x69, 0x79, 0x7C,
+    0x49, 0x00, 0xDA, 0x6B, 0x00, 0x9C, 0x0C, 0x00, 0x02, 0x00, 0x61, 0x65, 0x9C, 0x0C, 0x00, 0x70,
+    0x85, 0x00, 0x01, 0x00, 0x6C, 0x26, 0x0E, 0x00, 0x02, 0x00, 0x65, 0x6F, 0x0C, 0x4A, 0x00, 0x32,
+    0x3B, 0x00, 0x01, 0x00, 0x2E, 0x26, 0x0E, 0x00, 0x01, 0x00, 0x74, 0x76, 0x85, 0x00, 0x01, 0x00,
+    0x65, 0x02, 0x33, 0x00, 0x01, 0x00, 0x65, 0x7E, 0x85, 0x00, 0x02, 0x00, 0x72, 0x74, 0xE4, 0x6D,
+    0x00, 0xB4, 0x70, 0x00, 0x03, 0x00, 0x6B, 0x74, 0x76, 0x88, 0x85, 0x00, 0xA4, 0x6C, 0x00, 0x32,
+    0x3B, 0x00, 0x01, 0x00, 0x65, 0x8E, 0x85, 0x00, 0x01, 0x01, 0x15, 0x00, 0x6C, 0x02, 0x60, 0x00,
+    0x02, 0x00, 0x64, 0x67, 0xB0, 0x09, 0x00, 0x4E, 0x2F, 0x00, 0x01, 0x00, 0x65, 0x4C, 0x38, 0x00,
+    0x01, 0x00, 0x73, 0x9C, 0x0C, 0x00, 0x01, 0x00, 0x65, 0x94, 0x85, 0x00, 0x01, 0x00, 0x65, 0x36,
+    0x47, 0x00, 0x01, 0x01, 0x06, 0x00, 0x70, 0x9A, 0x85, 0x00, 0x01, 0x01, 0x06, 0x00, 0x74, 0xA0,
+    0x85, 0x00, 0x00, 0x02, 0x36, 0x00, 0x01, 0x00, 0x75, 0x96, 0x72, 0x00, 0x02, 0x00, 0x69, 0x6F,
+    0x4E, 0x2F, 0x00, 0xFC, 0x39, 0x00, 0x01, 0x01, 0x15, 0x00, 0x6C, 0xA0, 0x6C, 0x00, 0x02, 0x00,
+    0x65, 0x69, 0x10, 0x2C, 0x00, 0x2A, 0x76, 0x00, 0x01, 0x00, 0x6E, 0xB8, 0x73, 0x00, 0x02, 0x00,
+    0x63, 0x64, 0xAA, 0x85, 0x00, 0x80, 0x2F, 0x00, 0x01, 0x00, 0x69, 0xB0, 0x85, 0x00, 0x00, 0x02,
+    0x2F, 0x00, 0x01, 0x01, 0x2E, 0x00, 0x72, 0xFC, 0x39, 0x00, 0x01, 0x01, 0x10, 0x00, 0x65, 0xB6,
+    0x85, 0x00, 0x02, 0x00, 0x6D, 0x74, 0xDA, 0x6B, 0x00, 0xDA, 0x6B, 0x00, 0x01, 0x01, 0x12, 0x00,
+    0x66, 0x10, 0x2C, 0x00, 0x01, 0x01, 0x06, 0x00, 0x74, 0xBE, 0x85, 0x00, 0x01, 0x00, 0x6F, 0xC4,
+    0x85, 0x00, 0x01, 0x01, 0x06, 0x00, 0x74, 0xCA, 0x85, 0x00, 0x01, 0x00, 0x61, 0xA4, 0x6C, 0x00,
+    0x00, 0x02, 0x22, 0x00, 0x02, 0x00, 0x65, 0x73, 0xE4, 0x58, 0x00, 0x10, 0x2C, 0x00, 0x02, 0x00,
+    0x64, 0x72, 0x10, 0x2C, 0x00, 0xA0, 0x6C, 0x00, 0x01, 0x01, 0x10, 0x00, 0x63, 0x10, 0x2C, 0x00,
+    0x01, 0x00, 0x61, 0x6E, 0x35, 0x00, 0x01, 0x00, 0x6D, 0x32, 0x3B, 0x00, 0x03, 0x00, 0x63, 0x6F,
+    0x73, 0xEE, 0x42, 0x00, 0x72, 0x35, 0x00, 0x4C, 0x38, 0x00, 0x02, 0x01, 0x14, 0x00, 0x61, 0x72,
+    0x72, 0x35, 0x00, 0xD0, 0x85, 0x00, 0x01, 0x00, 0x69, 0x3A, 0x4A, 0x00, 0x01, 0x00, 0x63, 0x72,
+    0x35, 0x00, 0x01, 0x01, 0x12, 0x00, 0x6F, 0x72, 0x35, 0x00, 0x01, 0x00, 0x6E, 0x1C, 0x33, 0x00,
+    0x01, 0x00, 0x68, 0xD6, 0x85, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x01, 0x18, 0x00, 0x01, 0x00,
+    0x74, 0x32, 0x3B, 0x00, 0x01, 0x00, 0x6D, 0xA0, 0x6C, 0x00, 0x02, 0x01, 0x18, 0x00, 0x65, 0x69,
+    0x80, 0x2F, 0x00, 0xDC, 0x85, 0x00, 0x02, 0x00, 0x69, 0x79, 0xB0, 0x09, 0x00, 0x4E, 0x2F, 0x00,
+    0x01, 0x00, 0x65, 0xE2, 0x85, 0x00, 0x01, 0x00, 0x6D, 0xE8, 0x85, 0x00, 0x01, 0x01, 0x18, 0x00,
+    0x61, 0x32, 0x3B, 0x00, 0x02, 0x00, 0x6D, 0x74, 0x80, 0x2F, 0x00, 0x48, 0x71, 0x00, 0x00, 0x01,
+    0x8D, 0x00, 0x01, 0x00, 0x74, 0x94, 0x35, 0x00, 0x01, 0x00, 0x70, 0x30, 0x41, 0x00, 0x01, 0x00,
+    0x63, 0xA0, 0x6C, 0x00, 0x01, 0x00, 0x61, 0x76, 0x6C, 0x00, 0x01, 0x00, 0x6F, 0x98, 0x44, 0x00,
+    0x01, 0x00, 0x6C, 0xEC, 0x85, 0x00, 0x01, 0x00, 0x67, 0xA2, 0x52, 0x00, 0x01, 0x01, 0x06, 0x00,
+    0x6E, 0x32, 0x77, 0x00, 0x01, 0x00, 0x6F, 0x5C, 0x2C, 0x00, 0x02, 0x00, 0x61, 0x69, 0x80, 0x2F,
+    0x00, 0xF2, 0x85, 0x00, 0x01, 0x00, 0x63, 0xDA, 0x6B, 0x00, 0x01, 0x00, 0x74, 0xFA, 0x85, 0x00,
+    0x01, 0x00, 0x76, 0x00, 0x86, 0x00, 0x01, 0x00, 0x62, 0xE8, 0x85, 0x00, 0x01, 0x00, 0x74, 0x04,
+    0x86, 0x00, 0x01, 0x00, 0x69, 0xA4, 0x6C, 0x00, 0x01, 0x00, 0x6D, 0x0A, 0x86, 0x00, 0x01, 0x00,
+    0x69, 0x0E, 0x86, 0x00, 0x01, 0x00, 0x79, 0x14, 0x86, 0x00, 0x01, 0x00, 0x72, 0x1A, 0x86, 0x00,
+    0x00, 0x01, 0x1F, 0x00, 0x00, 0x01, 0x24, 0x00, 0x01, 0x00, 0x6D, 0x32, 0x77, 0x00, 0x01, 0x00,
+    0x6F, 0x20, 0x86, 0x00, 0x01, 0x00, 0x74, 0x26, 0x86, 0x00, 0x03, 0x00, 0x67, 0x6D, 0x74, 0x32,
+    0x3B, 0x00, 0xB0, 0x09, 0x00, 0x2A, 0x86, 0x00, 0x02, 0x00, 0x64, 0x6B, 0x38, 0x70, 0x00, 0xA0,
+    0x6C, 0x00, 0x01, 0x00, 0x6F, 0x2E, 0x86, 0x00, 0x01, 0x00, 0x61, 0x32, 0x86, 0x00, 0x01, 0x00,
+    0x6F, 0x36, 0x86, 0x00, 0x02, 0x00, 0x65, 0x6F, 0x40, 0x86, 0x00, 0xA4, 0x6C, 0x00, 0x01, 0x00,
+    0x6C, 0x0A, 0x86, 0x00, 0x01, 0x00, 0x69, 0x12, 0x4D, 0x00, 0x01, 0x00, 0x74, 0xEC, 0x80, 0x00,
+    0x01, 0x00, 0x6E, 0x46, 0x86, 0x00, 0x01, 0x00, 0x74, 0x4C, 0x86, 0x00, 0x01, 0x00, 0x79, 0x4E,
+    0x2F, 0x00, 0x02, 0x00, 0x65, 0x68, 0xA2, 0x52, 0x00, 0xE8, 0x85, 0x00, 0x01, 0x00, 0x63, 0x52,
+    0x86, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x01, 0x01, 0x06, 0x00, 0x61, 0xA0, 0x6C, 0x00, 0x01, 0x00,
+    0x61, 0x58, 0x86, 0x00, 0x01, 0x00, 0x6F, 0xA0, 0x6C, 0x00, 0x01, 0x00, 0x74, 0x64, 0x6E, 0x00,
+    0x01, 0x00, 0x61, 0x5C, 0x86, 0x00, 0x01, 0x00, 0x63, 0xA4, 0x6C, 0x00, 0x02, 0x00, 0x61, 0x65,
+    0x62, 0x86, 0x00, 0x2E, 0x30, 0x00, 0x01, 0x00, 0x69, 0x68, 0x86, 0x00, 0x02, 0x01, 0x3F, 0x00,
+    0x65, 0x74, 0x6E, 0x86, 0x00, 0x38, 0x70, 0x00, 0x01, 0x00, 0x61, 0x74, 0x86, 0x00, 0x01, 0x00,
+    0x66, 0x7C, 0x86, 0x00, 0x01, 0x00, 0x74, 0x80, 0x86, 0x00, 0x01, 0x00, 0x65, 0x86, 0x86, 0x00,
+    0x01, 0x00, 0x74, 0x48, 0x71, 0x00, 0x01, 0x00, 0x61, 0x98, 0x44, 0x00, 0x02, 0x00, 0x65, 0x69,
+    0x32, 0x3B, 0x00, 0xDE, 0x6B, 0x00, 0x01, 0x00, 0x6E, 0xA0, 0x6C, 0x00, 0x01, 0x00, 0x79, 0x8C,
+    0x86, 0x00, 0x01, 0x00, 0x74, 0x92, 0x86, 0x00, 0x02, 0x00, 0x61, 0x6D, 0x98, 0x86, 0x00, 0xA4,
+    0x6C, 0x00, 0x01, 0x00, 0x69, 0x9E, 0x86, 0x00, 0x01, 0x00, 0x65, 0xA4, 0x86, 0x00, 0x01, 0x01,
+    0x8D, 0x00, 0x63, 0xAA, 0x86, 0x00, 0x01, 0x00, 0x69, 0xDE, 0x6B, 0x00, 0x01, 0x01, 0x8D, 0x00,
+    0x74, 0x72, 0x2E, 0x00, 0x02, 0x00, 0x66, 0x6C, 0xE8, 0x85, 0x00, 0xE8, 0x85, 0x00, 0x01, 0x00,
+    0x69, 0xAE, 0x86, 0x00, 0x01, 0x00, 0x69, 0x30, 0x4B, 0x00, 0x01, 0x00, 0x67, 0xCA, 0x86, 0x00,
+    0x01, 0x00, 0x69, 0xCE, 0x86, 0x00, 0x01, 0x00, 0x6E, 0xD4, 0x86, 0x00, 0x01, 0x00, 0x62, 0x98,
+    0x44, 0x00, 0x01, 0x00, 0x65, 0xDA, 0x86, 0x00, 0x01, 0x00, 0x65, 0xE0, 0x86, 0x00, 0x01, 0x00,
+    0x61, 0x96, 0x6D, 0x00, 0x01, 0x00, 0x6F, 0x58, 0x86, 0x00, 0x02, 0x00, 0x67, 0x6B, 0xCA, 0x86,
+    0x00, 0xA0, 0x6C, 0x00, 0x02, 0x01, 0x06, 0x00, 0x69, 0x6F, 0xA0, 0x6C, 0x00, 0xE6, 0x86, 0x00,
+    0x01, 0x00, 0x73, 0xA0, 0x6C, 0x00, 0x01, 0x00, 0x62, 0xEC, 0x86, 0x00, 0x01, 0x01, 0x3E, 0x00,
+    0x74, 0xF2, 0x86, 0x00, 0x01, 0x00, 0x65, 0x80, 0x2F, 0x00, 0x01, 0x01, 0x3E, 0x00, 0x72, 0xF8,
+    0x86, 0x00, 0x01, 0x00, 0x64, 0x30, 0x41, 0x00, 0x01, 0x00, 0x61, 0xFE, 0x86, 0x00, 0x01, 0x00,
+    0x6C, 0x5E, 0x7E, 0x00, 0x01, 0x00, 0x69, 0xA0, 0x6C, 0x00, 0x01, 0x00, 0x61, 0x6E, 0x74, 0x00,
+    0x01, 0x00, 0x69, 0x04, 0x87, 0x00, 0x01, 0x00, 0x6C, 0xC6, 0x34, 0x00, 0x02, 0x01, 0x05, 0x00,
+    0x64, 0x6F, 0xFC, 0x39, 0x00, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x66, 0x32, 0x3B, 0x00, 0x01, 0x00,
+    0x6E, 0x9C, 0x0C, 0x00, 0x01, 0x00, 0x2E, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x73, 0x0E, 0x87, 0x00,
+    0x02, 0x00, 0x64, 0x74, 0x72, 0x35, 0x00, 0xEA, 0x3E, 0x00, 0x00, 0x02, 0x24, 0x01, 0x01, 0x00,
+    0x2E, 0x9C, 0x0C, 0x00, 0x01, 0x00, 0x76, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x63, 0xE6, 0x0A, 0x00,
+    0x01, 0x01, 0x0C, 0x00, 0x74, 0xF2, 0x84, 0x00, 0x02, 0x00, 0x69, 0x6F, 0xD0, 0x43, 0x00, 0x70,
+    0x6B, 0x00, 0x01, 0x00, 0x74, 0x14, 0x87, 0x00, 0x01, 0x01, 0x14, 0x00, 0x6F, 0x4E, 0x2F, 0x00,
+    0x01, 0x00, 0x79, 0x1A, 0x87, 0x00, 0x02, 0x01, 0x10, 0x00, 0x63, 0x69, 0x72, 0x35, 0x00, 0xDA,
+    0x6B, 0x00, 0x01, 0x00, 0x69, 0x84, 0x14, 0x00, 0x01, 0x00, 0x74, 0x94, 0x6E, 0x00, 0x01, 0x00,
+    0x73, 0x84, 0x14, 0x00, 0x00, 0x02, 0x96, 0x01, 0x01, 0x00, 0x68, 0x72, 0x35, 0x00, 0x01, 0x00,
+    0x7A, 0x3A, 0x2E, 0x00, 0x01, 0x00, 0x63, 0xEC, 0x80, 0x00, 0x01, 0x01, 0x0A, 0x00, 0x68, 0xE8,
+    0x85, 0x00, 0x01, 0x01, 0x1E, 0x00, 0x6F, 0x80, 0x2F, 0x00, 0x01, 0x00, 0x6C, 0xCA, 0x86, 0x00,
+    0x04, 0x00, 0x64, 0x65, 0x6E, 0x72, 0x22, 0x6D, 0x00, 0x9C, 0x0C, 0x00, 0x22, 0x87, 0x00, 0x26,
+    0x87, 0x00, 0x01, 0x00, 0x62, 0x2C, 0x87, 0x00, 0x01, 0x00, 0x6C, 0x32, 0x87, 0x00, 0x02, 0x00,
+    0x61, 0x75, 0x72, 0x35, 0x00, 0x84, 0x14, 0x00, 0x01, 0x00, 0x74, 0x72, 0x35, 0x00, 0x02, 0x00,
+    0x65, 0x69, 0x26, 0x0E, 0x00, 0x90, 0x6F, 0x00, 0x01, 0x00, 0x65, 0x38, 0x87, 0x00, 0x01, 0x00,
+    0x67, 0xDA, 0x6B, 0x00, 0x01, 0x01, 0x0B, 0x00, 0x69, 0x3E, 0x87, 0x00, 0x00, 0x02, 0xAA, 0x02,
+    0x02, 0x00, 0x61, 0x65, 0x8E, 0x6E, 0x00, 0x48, 0x87, 0x00, 0x01, 0x00, 0x6E, 0x0A, 0x3D, 0x00,
+    0x01, 0x00, 0x73, 0xFC, 0x39, 0x00, 0x02, 0x00, 0x6C, 0x6E, 0xFC, 0x39, 0x00, 0x72, 0x35, 0x00,
+    0x00, 0x02, 0x25, 0x00, 0x01, 0x00, 0x6E, 0x4E, 0x87, 0x00, 0x00, 0x03, 0xA5, 0x02, 0x01, 0x00,
+    0x70, 0x54, 0x87, 0x00, 0x01, 0x01, 0x1C, 0x00, 0x68, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x2E, 0x72,
+    0x35, 0x00, 0x02, 0x00, 0x61, 0x6E, 0x72, 0x35, 0x00, 0x5A, 0x87, 0x00, 0x03, 0x00, 0x6D, 0x6E,
+    0x72, 0x32, 0x3B, 0x00, 0x26, 0x0E, 0x00, 0x62, 0x87, 0x00, 0x01, 0x01, 0x0B, 0x00, 0x6D, 0x32,
+    0x3B, 0x00, 0x01, 0x00, 0x6E, 0x68, 0x87, 0x00, 0x01, 0x00, 0x75, 0x72, 0x35, 0x00, 0x01, 0x01,
+    0x2E, 0x00, 0x69, 0x2A, 0x76, 0x00, 0x01, 0x00, 0x70, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x67, 0x9C,
+    0x0C, 0x00, 0x01, 0x01, 0x0A, 0x00, 0x73, 0x6E, 0x87, 0x00, 0x01, 0x01, 0x24, 0x00, 0x74, 0x4C,
+    0x7E, 0x00, 0x01, 0x00, 0x66, 0xFE, 0x76, 0x00, 0x01, 0x00, 0x6F, 0x4E, 0x2F, 0x00, 0x03, 0x00,
+    0x61, 0x6E, 0x79, 0x72, 0x35, 0x00, 0xFC, 0x39, 0x00, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x65, 0x74,
+    0x87, 0x00, 0x01, 0x00, 0x61, 0x2C, 0x38, 0x00, 0x01, 0x00, 0x69, 0xE8, 0x85, 0x00, 0x01, 0x00,
+    0x6E, 0x7A, 0x87, 0x00, 0x01, 0x00, 0x79, 0x02, 0x33, 0x00, 0x01, 0x00, 0x7A, 0x32, 0x3B, 0x00,
+    0x01, 0x00, 0x66, 0x80, 0x87, 0x00, 0x01, 0x00, 0x7A, 0x72, 0x35, 0x00, 0x01, 0x00, 0x61, 0x84,
+    0x87, 0x00, 0x01, 0x00, 0x72, 0x00, 0x86, 0x00, 0x02, 0x00, 0x62, 0x68, 0x02, 0x33, 0x00, 0x10,
+    0x46, 0x00, 0x02, 0x00, 0x6F, 0x76, 0x62, 0x7C, 0x00, 0x8A, 0x87, 0x00, 0x01, 0x00, 0x61, 0x90,
+    0x87, 0x00, 0x01, 0x00, 0x64, 0x94, 0x87, 0x00, 0x01, 0x00, 0x68, 0xE8, 0x85, 0x00, 0x01, 0x00,
+    0x70, 0x3A, 0x2E, 0x00, 0x01, 0x00, 0x64, 0x98, 0x87, 0x00, 0x01, 0x01, 0x06, 0x00, 0x74, 0x32,
+    0x3B, 0x00, 0x01, 0x00, 0x6F, 0x9C, 0x87, 0x00, 0x01, 0x00, 0x6C, 0xA0, 0x87, 0x00, 0x01, 0x00,
+    0x64, 0x0A, 0x86, 0x00, 0x01, 0x00, 0x68, 0x0A, 0x86, 0x00, 0x01, 0x00, 0x71, 0xDA, 0x6B, 0x00,
+    0x01, 0x00, 0x65, 0xA4, 0x87, 0x00, 0x02, 0x00, 0x65, 0x69, 0xDA, 0x6B, 0x00, 0xB0, 0x87, 0x00,
+    0x01, 0x00, 0x64, 0xB6, 0x87, 0x00, 0x01, 0x00, 0x6F, 0x4C, 0x38, 0x00, 0x01, 0x00, 0x65, 0x64,
+    0x31, 0x00, 0x01, 0x00, 0x6E, 0x80, 0x2F, 0x00, 0x02, 0x00, 0x6D, 0x6E, 0xBC, 0x87, 0x00, 0xFC,
+    0x39, 0x00, 0x02, 0x00, 0x61, 0x69, 0x4E, 0x2F, 0x00, 0x96, 0x6D, 0x00, 0x03, 0x00, 0x63, 0x73,
+    0x7A, 0x4E, 0x2F, 0x00, 0x32, 0x3B, 0x00, 0x80, 0x2F, 0x00, 0x02, 0x00, 0x65, 0x69, 0xA2, 0x52,
+    0x00, 0x2C, 0x38, 0x00, 0x01, 0x00, 0x73, 0xC0, 0x87, 0x00, 0x01, 0x00, 0x76, 0xE6, 0x0A, 0x00,
+    0x01, 0x00, 0x6C, 0x32, 0x3B, 0x00, 0x01, 0x00, 0x70, 0xC4, 0x87, 0x00, 0x01, 0x00, 0x6E, 0xE6,
+    0x0A, 0x00, 0x00, 0x02, 0xE9, 0x01, 0x01, 0x00, 0x69, 0xCA, 0x87, 0x00, 0x01, 0x00, 0x69, 0xD2,
+    0x87, 0x00, 0x01, 0x00, 0x70, 0x0A, 0x86, 0x00, 0x01, 0x00, 0x6F, 0x32, 0x3B, 0x00, 0x01, 0x00,
+    0x69, 0x4C, 0x38, 0x00, 0x02, 0x00, 0x2E, 0x73, 0x72, 0x35, 0x00, 0x72, 0x35, 0x00, 0x01, 0x00,
+    0x76, 0x34, 0x6D, 0x00, 0x02, 0x02, 0x15, 0x02, 0x65, 0x69, 0xDC, 0x87, 0x00, 0x3A, 0x2E, 0x00,
+    0x00, 0x02, 0x6C, 0x00, 0x01, 0x00, 0x63, 0x66, 0x43, 0x00, 0x01, 0x00, 0x72, 0x84, 0x81, 0x00,
+    0x01, 0x01, 0x05, 0x00, 0x74, 0x4C, 0x38, 0x00, 0x01, 0x01, 0x12, 0x00, 0x2E, 0x26, 0x0E, 0x00,
+    0x02, 0x00, 0x61, 0x69, 0xE6, 0x0A, 0x00, 0xE6, 0x0A, 0x00, 0x01, 0x00, 0x7A, 0x80, 0x2F, 0x00,
+    0x02, 0x01, 0x0C, 0x00, 0x61, 0x65, 0xE6, 0x87, 0x00, 0x3A, 0x2E, 0x00, 0x01, 0x01, 0x0D, 0x00,
+    0x72, 0x80, 0x2F, 0x00, 0x01, 0x00, 0x6F, 0xEC, 0x87, 0x00, 0x01, 0x00, 0x74, 0xD0, 0x2E, 0x00,
+    0x02, 0x00, 0x2E, 0x69, 0x3A, 0x2E, 0x00, 0xF2, 0x87, 0x00, 0x01, 0x00, 0x61, 0x76, 0x0C, 0x00,
+    0x01, 0x00, 0x69, 0xF8, 0x87, 0x00, 0x01, 0x00, 0x6F, 0x00, 0x88, 0x00, 0x01, 0x00, 0x63, 0x06,
+    0x88, 0x00, 0x02, 0x00, 0x6C, 0x6F, 0x4E, 0x2F, 0x00, 0xA0, 0x6C, 0x00, 0x02, 0x00, 0x67, 0x74,
+    0xFC, 0x39, 0x00, 0x26, 0x0E, 0x00, 0x01, 0x00, 0x75, 0x10, 0x2C, 0x00, 0x01, 0x00, 0x6D, 0x0C,
+    0x88, 0x00, 0x02, 0x00, 0x69, 0x75, 0x02, 0x83, 0x00, 0x4C, 0x38, 0x00, 0x02, 0x00, 0x62, 0x6E,
+    0x0C, 0x76, 0x00, 0x12, 0x88, 0x00, 0x02, 0x00, 0x65, 0x76, 0x9C, 0x0C, 0x00, 0x32, 0x0D, 0x00,
+    0x01, 0x00, 0x6E, 0x18, 0x88, 0x00, 0x01, 0x00, 0x62, 0x22, 0x6D, 0x00, 0x01, 0x00, 0x73, 0xAE,
+    0x6E, 0x00, 0x01, 0x00, 0x6E, 0xCA, 0x86, 0x00, 0x02, 0x00, 0x61, 0x69, 0x1E, 0x88, 0x00, 0x24,
+    0x88, 0x00, 0x01, 0x00, 0x6E, 0x2A, 0x88, 0x00, 0x02, 0x00, 0x65, 0x71, 0xDA, 0x6B, 0x00, 0x30,
+    0x88, 0x00, 0x02, 0x00, 0x63, 0x6C, 0x34, 0x88, 0x00, 0xFC, 0x39, 0x00, 0x03, 0x00, 0x6E, 0x72,
+    0x73, 0xD0, 0x6A, 0x00, 0xE8, 0x85, 0x00, 0x6E, 0x35, 0x00, 0x01, 0x00, 0x69, 0x3C, 0x88, 0x00,
+    0x01, 0x00, 0x69, 0x42, 0x88, 0x00, 0x02, 0x00, 0x69, 0x72, 0x80, 0x2F, 0x00, 0x72, 0x35, 0x00,
+    0x01, 0x00, 0x63, 0x6E, 0x35, 0x00, 0x01, 0x00, 0x6C, 0x80, 0x2F, 0x00, 0x02, 0x00, 0x69, 0x6D,
+    0xAC, 0x2E, 0x00, 0x9C, 0x0C, 0x00, 0x01, 0x00, 0x74, 0x44, 0x19, 0x00, 0x01, 0x00, 0x74, 0x48,
+    0x88, 0x00, 0x01, 0x00, 0x2E, 0x4C, 0x38, 0x00, 0x01, 0x01, 0x0D, 0x00, 0x7A, 0xFC, 0x39, 0x00,
+    0x02, 0x01, 0x14, 0x00, 0x6E, 0x72, 0x6E, 0x35, 0x00, 0x6E, 0x35, 0x00, 0x00, 0x02, 0x6E, 0x02,
+    0x01, 0x00, 0x64, 0xEC, 0x1B, 0x00, 0x02, 0x00, 0x2E, 0x73, 0x4C, 0x38, 0x00, 0xE6, 0x0A, 0x00,
+    0x00, 0x03, 0x6B, 0x02, 0x01, 0x00, 0x72, 0x4E, 0x88, 0x00, 0x01, 0x00, 0x6F, 0x96, 0x6D, 0x00,
+    0x01, 0x01, 0x0D, 0x00, 0x61, 0x54, 0x88, 0x00, 0x01, 0x00, 0x74, 0x5A, 0x88, 0x00, 0x01, 0x00,
+    0x6C, 0x60, 0x88, 0x00, 0x01, 0x00, 0x65, 0x66, 0x88, 0x00, 0x01, 0x00, 0x6C, 0x1C, 0x45, 0x00,
+    0x01, 0x00, 0x2E, 0x6E, 0x35, 0x00, 0x02, 0x00, 0x2E, 0x73, 0xE6, 0x0A, 0x00, 0xE6, 0x0A, 0x00,
+    0x01, 0x00, 0x6F, 0x6C, 0x88, 0x00, 0x01, 0x01, 0x0B, 0x00, 0x72, 0xFC, 0x39, 0x00, 0x01, 0x00,
+    0x65, 0x72, 0x88, 0x00, 0x02, 0x00, 0x63, 0x6C, 0x4E, 0x2F, 0x00, 0x4E, 0x2F, 0x00, 0x01, 0x01,
+    0x15, 0x00, 0x65, 0xA4, 0x6C, 0x00, 0x01, 0x00, 0x66, 0x26, 0x0E, 0x00, 0x00, 0x02, 0x62, 0x00,
+    0x01, 0x00, 0x73, 0x5E, 0x46, 0x00, 0x02, 0x00, 0x69, 0x79, 0x78, 0x88, 0x00, 0xFC, 0x39, 0x00,
+    0x01, 0x01, 0x06, 0x00, 0x65, 0x26, 0x0E, 0x00, 0x01, 0x00, 0x6D, 0x10, 0x2C, 0x00, 0x02, 0x00,
+    0x6D, 0x70, 0x10, 0x2C, 0x00, 0x98, 0x4F, 0x00, 0x02, 0x01, 0x2E, 0x00, 0x61, 0x6F, 0x72, 0x35,
+    0x00, 0x32, 0x3B, 0x00, 0x01, 0x01, 0x05, 0x00, 0x61, 0x72, 0x35, 0x00, 0x02, 0x01, 0x05, 0x00,
+    0x69, 0x6F, 0x82, 0x88, 0x00, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x65, 0x3C, 0x73, 0x00, 0x01, 0x01,
+    0x05, 0x00, 0x69, 0x3A, 0x2E, 0x00, 0x02, 0x00, 0x65, 0x69, 0x84, 0x14, 0x00, 0x88, 0x88, 0x00,
+    0x01, 0x00, 0x65, 0x30, 0x6E, 0x00, 0x01, 0x00, 0x65, 0x76, 0x7B, 0x00, 0x00, 0x02, 0x5D, 0x02,
+    0x01, 0x01, 0x05, 0x00, 0x69, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x64, 0xDA, 0x6B, 0x00, 0x01, 0x00,
+    0x69, 0xB4, 0x6E, 0x00, 0x01, 0x00, 0x61, 0xCA, 0x86, 0x00, 0x01, 0x00, 0x72, 0x5E, 0x46, 0x00,
+    0x02, 0x00, 0x2E, 0x61, 0x70, 0x6B, 0x00, 0x72, 0x35, 0x00, 0x01, 0x00, 0x67, 0x3C, 0x73, 0x00,
+    0x01, 0x01, 0x2E, 0x00, 0x68, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x69, 0x8E, 0x88, 0x00, 0x00, 0x02,
+    0xDD, 0x00, 0x01, 0x01, 0x0C, 0x00, 0x62, 0x9C, 0x0C, 0x00, 0x01, 0x01, 0x1D, 0x00, 0x61, 0xFC,
+    0x39, 0x00, 0x02, 0x02, 0x5B, 0x02, 0x65, 0x69, 0xFC, 0x39, 0x00, 0x04, 0x6F, 0x00, 0x02, 0x01,
+    0x05, 0x00, 0x68, 0x73, 0xFC, 0x39, 0x00, 0x26, 0x0E, 0x00, 0x01, 0x00, 0x69, 0x78, 0x76, 0x00,
+    0x01, 0x01, 0x05, 0x00, 0x61, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x65, 0x52, 0x2F, 0x00, 0x02, 0x00,
+    0x63, 0x78, 0x72, 0x35, 0x00, 0x02, 0x33, 0x00, 0x02, 0x00, 0x69, 0x74, 0xFC, 0x39, 0x00, 0xFC,
+    0x39, 0x00, 0x01, 0x00, 0x67, 0x30, 0x4B, 0x00, 0x01, 0x00, 0x65, 0xB2, 0x4B, 0x00, 0x01, 0x00,
+    0x61, 0xE2, 0x7B, 0x00, 0x01, 0x00, 0x69, 0x94, 0x88, 0x00, 0x01, 0x00, 0x65, 0x9A, 0x88, 0x00,
+    0x03, 0x00, 0x63, 0x64, 0x68, 0x20, 0x74, 0x00, 0x10, 0x2C, 0x00, 0x72, 0x35, 0x00, 0x01, 0x00,
+    0x62, 0xFE, 0x76, 0x00, 0x02, 0x00, 0x6C, 0x73, 0xA4, 0x6C, 0x00, 0xA0, 0x88, 0x00, 0x01, 0x00,
+    0x64, 0xE6, 0x0A, 0x00, 0x01, 0x00, 0x69, 0xEA, 0x3B, 0x00, 0x01, 0x01, 0x13, 0x00, 0x65, 0x9C,
+    0x0C, 0x00, 0x04, 0x00, 0x61, 0x63, 0x65, 0x74, 0xFC, 0x39, 0x00, 0x0A, 0x3D, 0x00, 0xE6, 0x0A,
+    0x00, 0x72, 0x35, 0x00, 0x02, 0x00, 0x73, 0x74, 0xFC, 0x39, 0x00, 0x72, 0x35, 0x00, 0x01, 0x02,
+    0x22, 0x01, 0x6E, 0xA4, 0x88, 0x00, 0x01, 0x00, 0x6B, 0x3A, 0x2E, 0x00, 0x02, 0x00, 0x6E, 0x72,
+    0x84, 0x14, 0x00, 0x4E, 0x2F, 0x00, 0x01, 0x01, 0x06, 0x00, 0x61, 0x10, 0x2C, 0x00, 0x03, 0x00,
+    0x73, 0x74, 0x7A, 0x9C, 0x0C, 0x00, 0xE6, 0x0A, 0x00, 0x3A, 0x2E, 0x00, 0x01, 0x00, 0x75, 0x3A,
+    0x2E, 0x00, 0x01, 0x00, 0x65, 0x48, 0x3F, 0x00, 0x01, 0x01, 0x2E, 0x00, 0x6E, 0xFC, 0x39, 0x00,
+    0x02, 0x00, 0x74, 0x76, 0x48, 0x3F, 0x00, 0x4C, 0x47, 0x00, 0x01, 0x01, 0x2E, 0x00, 0x65, 0x36,
+    0x47, 0x00, 0x01, 0x00, 0x74, 0x30, 0x41, 0x00, 0x01, 0x01, 0x2E, 0x00, 0x75, 0x72, 0x35, 0x00,
+    0x01, 0x01, 0x2E, 0x00, 0x61, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x63, 0xAA, 0x88, 0x00, 0x01, 0x00,
+    0x62, 0x32, 0x78, 0x00, 0x02, 0x00, 0x67, 0x6D, 0x72, 0x35, 0x00, 0xFC, 0x39, 0x00, 0x01, 0x02,
+    0x12, 0x01, 0x6E, 0x84, 0x14, 0x00, 0x02, 0x01, 0x11, 0x00, 0x6F, 0x75, 0x26, 0x0E, 0x00, 0xB0,
+    0x88, 0x00, 0x01, 0x00, 0x6C, 0xB6, 0x88, 0x00, 0x01, 0x01, 0x18, 0x00, 0x6F, 0x4E, 0x2F, 0x00,
+    0x01, 0x00, 0x69, 0x3E, 0x87, 0x00, 0x02, 0x00, 0x63, 0x66, 0x72, 0x35, 0x00, 0xFC, 0x39, 0x00,
+    0x02, 0x00, 0x67, 0x73, 0x72, 0x35, 0x00, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x69, 0xBC, 0x88, 0x00,
+    0x00, 0x02, 0x49, 0x02, 0x01, 0x01, 0x2E, 0x00, 0x74, 0xFC, 0x39, 0x00, 0x02, 0x00, 0x6C, 0x6F,
+    0x72, 0x35, 0x00, 0xA4, 0x6C, 0x00, 0x02, 0x00, 0x67, 0x69, 0x26, 0x0E, 0x00, 0xDA, 0x6B, 0x00,
+    0x01, 0x01, 0x14, 0x00, 0x62, 0x26, 0x0E, 0x00, 0x01, 0x00, 0x67, 0x72, 0x35, 0x00, 0x01, 0x00,
+    0x68, 0x32, 0x3B, 0x00, 0x01, 0x00, 0x74, 0xE8, 0x85, 0x00, 0x01, 0x00, 0x75, 0x00, 0x37, 0x00,
+    0x01, 0x01, 0x15, 0x00, 0x65, 0xA0, 0x6C, 0x00, 0x01, 0x00, 0x69, 0xD4, 0x86, 0x00, 0x03, 0x00,
+    0x6C, 0x6E, 0x74, 0x76, 0x0C, 0x00, 0x84, 0x14, 0x00, 0x70, 0x85, 0x00, 0x02, 0x00, 0x6E, 0x72,
+    0x84, 0x14, 0x00, 0x72, 0x35, 0x00, 0x02, 0x01, 0x06, 0x00, 0x61, 0x65, 0x3A, 0x2E, 0x00, 0x3A,
+    0x2E, 0x00, 0x00, 0x02, 0xC1, 0x01, 0x01, 0x00, 0x65, 0xC2, 0x88, 0x00, 0x01, 0x00, 0x65, 0x00,
+    0x7C, 0x00, 0x01, 0x00, 0x72, 0x4C, 0x38, 0x00, 0x02, 0x00, 0x74, 0x79, 0xFC, 0x39, 0x00, 0x32,
+    0x3B, 0x00, 0x02, 0x00, 0x73, 0x7A, 0x32, 0x3B, 0x00, 0xC8, 0x88, 0x00, 0x00, 0x02, 0x22, 0x02,
+    0x03, 0x00, 0x6E, 0x73, 0x7A, 0x4E, 0x2F, 0x00, 0xFC, 0x39, 0x00, 0xFC, 0x39, 0x00, 0x01, 0x00,
+    0x74, 0x9C, 0x0C, 0x00, 0x01, 0x00, 0x79, 0xB6, 0x87, 0x00, 0x01, 0x00, 0x7A, 0xFC, 0x39, 0x00,
+    0x00, 0x02, 0x45, 0x02, 0x01, 0x00, 0x63, 0xB6, 0x87, 0x00, 0x01, 0x00, 0x65, 0x10, 0x46, 0x00,
+    0x01, 0x00, 0x61, 0x3A, 0x2E, 0x00, 0x00, 0x02, 0xEA, 0x00, 0x00, 0x02, 0x41, 0x02, 0x01, 0x00,
+    0x64, 0x74, 0x0A, 0x00, 0x01, 0x00, 0x68, 0x3C, 0x0C, 0x00, 0x01, 0x00, 0x69, 0xD0, 0x88, 0x00,
+    0x02, 0x00, 0x69, 0x74, 0xD6, 0x88, 0x00, 0xDA, 0x6B, 0x00, 0x02, 0x00, 0x2E, 0x65, 0xDC, 0x88,
+    0x00, 0xE0, 0x88, 0x00, 0x00, 0x03, 0x3B, 0x02, 0x01, 0x00, 0x6F, 0xE8, 0x85, 0x00, 0x01, 0x01,
+    0x13, 0x00, 0x7A, 0xE6, 0x88, 0x00, 0x01, 0x00, 0x75, 0x32, 0x3B, 0x00, 0x01, 0x00, 0x68, 0xEC,
+    0x88, 0x00, 0x01, 0x00, 0x73, 0xEA, 0x3B, 0x00, 0x01, 0x00, 0x76, 0xFE, 0x88, 0x00, 0x01, 0x00,
+    0x64, 0x4C, 0x38, 0x00, 0x00, 0x02, 0x34, 0x02, 0x01, 0x00, 0x6E, 0x74, 0x0A, 0x00, 0x01, 0x00,
+    0x73, 0x22, 0x6D, 0x00, 0x01, 0x01, 0x13, 0x00, 0x6D, 0xA4, 0x6C, 0x00, 0x02, 0x00, 0x69, 0x79,
+    0x4E, 0x2F, 0x00, 0x4E, 0x2F, 0x00, 0x02, 0x01, 0x06, 0x00, 0x65, 0x6F, 0xA2, 0x52, 0x00, 0xA0,
+    0x6C, 0x00, 0x01, 0x00, 0x7A, 0x40, 0x7A, 0x00, 0x01, 0x00, 0x72, 0x02, 0x89, 0x00, 0x02, 0x00,
+    0x6E, 0x73, 0x72, 0x35, 0x00, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x65, 0x96, 0x6D, 0x00, 0x01, 0x00,
+    0x68, 0xFE, 0x88, 0x00, 0x02, 0x00, 0x6E, 0x74, 0x9C, 0x0C, 0x00, 0x26, 0x0E, 0x00, 0x00, 0x02,
+    0x2C, 0x02, 0x02, 0x00, 0x69, 0x79, 0x02, 0x83, 0x00, 0x4E, 0x2F, 0x00, 0x01, 0x01, 0x18, 0x00,
+    0x74, 0x32, 0x3B, 0x00, 0x01, 0x01, 0x05, 0x00, 0x70, 0xA4, 0x6C, 0x00, 0x00, 0x02, 0x6C, 0x01,
+    0x01, 0x00, 0x72, 0xCA, 0x86, 0x00, 0x01, 0x00, 0x6C, 0x08, 0x89, 0x00, 0x01, 0x00, 0x73, 0x0E,
+    0x89, 0x00, 0x01, 0x00, 0x65, 0xA2, 0x52, 0x00, 0x01, 0x00, 0x7A, 0xA4, 0x6C, 0x00, 0x01, 0x00,
+    0x7A, 0x26, 0x0E, 0x00, 0x02, 0x00, 0x63, 0x73, 0x14, 0x89, 0x00, 0xFC, 0x39, 0x00, 0x01, 0x01,
+    0x06, 0x00, 0x6E, 0xFC, 0x39, 0x00, 0x01, 0x01, 0x07, 0x00, 0x65, 0x0A, 0x86, 0x00, 0x01, 0x00,
+    0x75, 0xDC, 0x88, 0x00, 0x00, 0x02, 0x38, 0x01, 0x01, 0x00, 0x74, 0x1A, 0x89, 0x00, 0x01, 0x00,
+    0x76, 0x10, 0x2C, 0x00, 0x01, 0x00, 0x69, 0xEA, 0x7F, 0x00, 0x02, 0x00, 0x61, 0x74, 0x72, 0x35,
+    0x00, 0xFC, 0x39, 0x00, 0x02, 0x00, 0x2E, 0x65, 0xFC, 0x39, 0x00, 0xFC, 0x39, 0x00, 0x02, 0x01,
+    0x0C, 0x00, 0x2E, 0x61, 0x10, 0x2C, 0x00, 0x10, 0x2C, 0x00, 0x01, 0x01, 0x2E, 0x00, 0x61, 0x72,
+    0x35, 0x00, 0x01, 0x01, 0x8D, 0x00, 0x61, 0xAE, 0x63, 0x00, 0x02, 0x00, 0x6E, 0x72, 0xFC, 0x39,
+    0x00, 0x4E, 0x2F, 0x00, 0x02, 0x01, 0x13, 0x00, 0x73, 0x75, 0x9C, 0x0C, 0x00, 0x32, 0x3B, 0x00,
+    0x00, 0x02, 0xF2, 0x00, 0x01, 0x00, 0x65, 0x20, 0x89, 0x00, 0x01, 0x00, 0x74, 0x26, 0x89, 0x00,
+    0x01, 0x01, 0x05, 0x00, 0x65, 0x72, 0x35, 0x00, 0x01, 0x00, 0x79, 0x32, 0x3B, 0x00, 0x01, 0x00,
+    0x74, 0x2E, 0x89, 0x00, 0x01, 0x00, 0x64, 0x34, 0x89, 0x00, 0x02, 0x00, 0x6C, 0x72, 0xCA, 0x86,
+    0x00, 0x72, 0x35, 0x00, 0x01, 0x00, 0x69, 0x3A, 0x89, 0x00, 0x01, 0x00, 0x61, 0x52, 0x2F, 0x00,
+    0x01, 0x00, 0x61, 0x40, 0x89, 0x00, 0x01, 0x01, 0x0C, 0x00, 0x6E, 0xFC, 0x39, 0x00, 0x03, 0x00,
+    0x65, 0x69, 0x79, 0x46, 0x89, 0x00, 0x3C, 0x79, 0x00, 0x72, 0x35, 0x00, 0x01, 0x00, 0x72, 0x50,
+    0x89, 0x00, 0x00, 0x02, 0x1E, 0x02, 0x01, 0x00, 0x72, 0x0C, 0x6D, 0x00, 0x01, 0x00, 0x61, 0x56,
+    0x89, 0x00, 0x00, 0x02, 0x66, 0x00, 0x02, 0x00, 0x64, 0x74, 0x72, 0x35, 0x00, 0x5C, 0x89, 0x00,
+    0x00, 0x02, 0x1C, 0x02, 0x00, 0x03, 0x19, 0x02, 0x01, 0x00, 0x76, 0x60, 0x89, 0x00, 0x02, 0x00,
+    0x6E, 0x70, 0x72, 0x35, 0x00, 0x32, 0x3B, 0x00, 0x02, 0x00, 0x6E, 0x73, 0xCA, 0x86, 0x00, 0x9C,
+    0x0C, 0x00, 0x01, 0x00, 0x61, 0x30, 0x3F, 0x00, 0x00, 0x02, 0x13, 0x02, 0x02, 0x00, 0x61, 0x69,
+    0x72, 0x35, 0x00, 0x26, 0x0E, 0x00, 0x01, 0x01, 0x0B, 0x00, 0x69, 0x66, 0x89, 0x00, 0x01, 0x00,
+    0x6C, 0xEC, 0x80, 0x00, 0x02, 0x02, 0x11, 0x02, 0x61, 0x6B, 0x72, 0x35, 0x00, 0xF2, 0x84, 0x00,
+    0x01, 0x00, 0x65, 0x6C, 0x89, 0x00, 0x01, 0x01, 0x0C, 0x00, 0x6D, 0x10, 0x2C, 0x00, 0x00, 0x03,
+    0x8E, 0x01, 0x02, 0x00, 0x2E, 0x73, 0x3C, 0x73, 0x00, 0x76, 0x7B, 0x00, 0x02, 0x00, 0x65, 0x6F,
+    0x26, 0x0E, 0x00, 0x04, 0x6F, 0x00, 0x01, 0x00, 0x74, 0x3A, 0x2E, 0x00, 0x01, 0x00, 0x6E, 0x72,
+    0x89, 0x00, 0x01, 0x00, 0x6D, 0x78, 0x89, 0x00, 0x02, 0x00, 0x69, 0x79, 0x70, 0x85, 0x00, 0xE6,
+    0x0A, 0x00, 0x01, 0x01, 0x0A, 0x00, 0x6E, 0x7C, 0x89, 0x00, 0x02, 0x00, 0x73, 0x74, 0x02, 0x4D,
+    0x00, 0x82, 0x89, 0x00, 0x01, 0x00, 0x61, 0x88, 0x89, 0x00, 0x01, 0x01, 0x18, 0x00, 0x65, 0x8E,
+    0x89, 0x00, 0x01, 0x00, 0x65, 0x92, 0x89, 0x00, 0x01, 0x00, 0x65, 0x98, 0x89, 0x00, 0x01, 0x00,
+    0x6C, 0x4E, 0x33, 0x00, 0x01, 0x00, 0x6C, 0x9E, 0x89, 0x00, 0x01, 0x00, 0x65, 0xA4, 0x89, 0x00,
+    0x01, 0x00, 0x61, 0xAA, 0x89, 0x00, 0x01, 0x00, 0x61, 0xAE, 0x89, 0x00, 0x01, 0x00, 0x6E, 0xB4,
+    0x89, 0x00, 0x01, 0x00, 0x74, 0xBA, 0x89, 0x00, 0x01, 0x00, 0x69, 0xC2, 0x89, 0x00, 0x01, 0x01,
+    0x19, 0x00, 0x2E, 0x3A, 0x2E, 0x00, 0x01, 0x00, 0x72, 0xC8, 0x89, 0x00, 0x01, 0x00, 0x6F, 0x3A,
+    0x2E, 0x00, 0x01, 0x00, 0x74, 0x10, 0x81, 0x00, 0x01, 0x02, 0x56, 0x01, 0x61, 0x80, 0x2F, 0x00,
+    0x01, 0x00, 0x6F, 0xD6, 0x89, 0x00, 0x01, 0x00, 0x63, 0xDC, 0x89, 0x00, 0x01, 0x02, 0xF4, 0x01,
+    0x61, 0x26, 0x0E, 0x00, 0x01, 0x00, 0x68, 0xD6, 0x6B, 0x00, 0x01, 0x00, 0x75, 0xE6, 0x89, 0x00,
+    0x01, 0x01, 0x18, 0x00, 0x65, 0xEC, 0x89, 0x00, 0x01, 0x00, 0x65, 0xF2, 0x89, 0x00, 0x01, 0x00,
+    0x74, 0xFC, 0x89, 0x00, 0x01, 0x00, 0x73, 0x00, 0x73, 0x00, 0x01, 0x00, 0x63, 0x4C, 0x38, 0x00,
+    0x01, 0x01, 0x06, 0x00, 0x7A, 0x02, 0x8A, 0x00, 0x01, 0x01, 0x18, 0x00, 0x74, 0x44, 0x19, 0x00,
+    0x01, 0x00, 0x70, 0x06, 0x8A, 0x00, 0x01, 0x00, 0x65, 0xE8, 0x85, 0x00, 0x01, 0x01, 0x34, 0x00,
+    0x6C, 0x0C, 0x8A, 0x00, 0x01, 0x00, 0x73, 0x82, 0x6A, 0x00, 0x01, 0x00, 0x69, 0x12, 0x8A, 0x00,
+    0x02, 0x00, 0x2E, 0x69, 0x26, 0x0E, 0x00, 0x40, 0x76, 0x00, 0x01, 0x00, 0x65, 0x18, 0x8A, 0x00,
+    0x00, 0x02, 0xEB, 0x01, 0x01, 0x00, 0x6D, 0x1E, 0x8A, 0x00, 0x01, 0x00, 0x79, 0x0C, 0x4A, 0x00,
+    0x01, 0x00, 0x69, 0x8A, 0x6F, 0x00, 0x01, 0x00, 0x70, 0x78, 0x89, 0x00, 0x02, 0x00, 0x67, 0x6E,
+    0x72, 0x35, 0x00, 0xFC, 0x39, 0x00, 0x03, 0x00, 0x61, 0x73, 0x7A, 0x3A, 0x2E, 0x00, 0x32, 0x3B,
+    0x00, 0x80, 0x2F, 0x00, 0x01, 0x00, 0x73, 0x24, 0x8A, 0x00, 0x01, 0x00, 0x72, 0x2A, 0x8A, 0x00,
+    0x01, 0x00, 0x69, 0x30, 0x8A, 0x00, 0x02, 0x00, 0x6E, 0x7A, 0x36, 0x8A, 0x00, 0xFC, 0x39, 0x00,
+    0x02, 0x00, 0x73, 0x7A, 0x72, 0x35, 0x00, 0xA8, 0x44, 0x00, 0x00, 0x02, 0xE2, 0x01, 0x04, 0x00,
+    0x61, 0x63, 0x65, 0x6F, 0x3A, 0x2E, 0x00, 0x3C, 0x8A, 0x00, 0x72, 0x35, 0x00, 0x44, 0x8A, 0x00,
+    0x00, 0x02, 0x98, 0x01, 0x01, 0x00, 0x61, 0x4A, 0x8A, 0x00, 0x00, 0x02, 0xDC, 0x01, 0x01, 0x01,
+    0x06, 0x00, 0x63, 0x32, 0x3B, 0x00, 0x01, 0x01, 0x18, 0x00, 0x75, 0xE8, 0x85, 0x00, 0x01, 0x01,
+    0x19, 0x00, 0x65, 0x4E, 0x2F, 0x00, 0x01, 0x00, 0x61, 0x26, 0x0E, 0x00, 0x01, 0x01, 0x0B, 0x00,
+    0x6C, 0x80, 0x2F, 0x00, 0x02, 0x01, 0x05, 0x00, 0x69, 0x79, 0x50, 0x8A, 0x00, 0x72, 0x35, 0x00,
+    0x01, 0x01, 0x06, 0x00, 0x62, 0x5A, 0x8A, 0x00, 0x03, 0x00, 0x61, 0x65, 0x74, 0x4C, 0x38, 0x00,
+    0x40, 0x7A, 0x00, 0x5E, 0x8A, 0x00, 0x02, 0x01, 0x05, 0x00, 0x61, 0x69, 0x64, 0x8A, 0x00, 0x6A,
+    0x8A, 0x00, 0x01, 0x00, 0x6C, 0x70, 0x8A, 0x00, 0x01, 0x00, 0x73, 0x7C, 0x8A, 0x00, 0x01, 0x01,
+    0x05, 0x00, 0x74, 0x82, 0x8A, 0x00, 0x01, 0x00, 0x72, 0x88, 0x8A, 0x00, 0x02, 0x00, 0x69, 0x72,
+    0x4E, 0x2F, 0x00, 0x8E, 0x8A, 0x00, 0x00, 0x02, 0xD0, 0x01, 0x01, 0x01, 0x0C, 0x00, 0x61, 0x94,
+    0x8A, 0x00, 0x01, 0x00, 0x61, 0x9A, 0x8A, 0x00, 0x01, 0x01, 0x8D, 0x00, 0x65, 0x32, 0x3B, 0x00,
+    0x02, 0x00, 0x63, 0x73, 0xA0, 0x8A, 0x00, 0xE4, 0x58, 0x00, 0x02, 0x00, 0x74, 0x79, 0x32, 0x3B,
+    0x00, 0x5C, 0x86, 0x00, 0x03, 0x00, 0x61, 0x73, 0x7A, 0xA4, 0x6C, 0x00, 0x6A, 0x46, 0x00, 0x72,
+    0x35, 0x00, 0x04, 0x00, 0x63, 0x65, 0x6C, 0x73, 0xF8, 0x30, 0x00, 0xA4, 0x8A, 0x00, 0xCA, 0x86,
+    0x00, 0xAA, 0x8A, 0x00, 0x01, 0x00, 0x6E, 0xAE, 0x8A, 0x00, 0x01, 0x01, 0x24, 0x00, 0x65, 0xB4,
+    0x8A, 0x00, 0x01, 0x01, 0x19, 0x00, 0x69, 0xBA, 0x8A, 0x00, 0x02, 0x00, 0x61, 0x69, 0xC0, 0x8A,
+    0x00, 0xA0, 0x6C, 0x00, 0x01, 0x00, 0x73, 0xCA, 0x86, 0x00, 0x01, 0x00, 0x69, 0xC8, 0x8A, 0x00,
+    0x01, 0x00, 0x63, 0xCE, 0x8A, 0x00, 0x01, 0x00, 0x6F, 0x6E, 0x35, 0x00, 0x01, 0x01, 0x0D, 0x00,
+    0x69, 0xD4, 0x8A, 0x00, 0x01, 0x00, 0x72, 0xDC, 0x8A, 0x00, 0x01, 0x01, 0x0B, 0x00, 0x61, 0xFC,
+    0x39, 0x00, 0x01, 0x00, 0x69, 0xCA, 0x86, 0x00, 0x01, 0x01, 0x34, 0x00, 0x68, 0xE2, 0x8A, 0x00,
+    0x01, 0x00, 0x6D, 0x70, 0x72, 0x00, 0x01, 0x00, 0x2E, 0x10, 0x2C, 0x00, 0x02, 0x00, 0x6F, 0x73,
+    0x26, 0x0E, 0x00, 0xE8, 0x8A, 0x00, 0x02, 0x00, 0x6C, 0x73, 0x26, 0x0E, 0x00, 0x84, 0x14, 0x00,
+    0x01, 0x00, 0x63, 0xEE, 0x8A, 0x00, 0x01, 0x00, 0x63, 0xF4, 0x8A, 0x00, 0x01, 0x00, 0x74, 0xFA,
+    0x8A, 0x00, 0x02, 0x00, 0x62, 0x72, 0xA0, 0x6C, 0x00, 0x10, 0x2C, 0x00, 0x00, 0x02, 0xB8, 0x01,
+    0x01, 0x00, 0x69, 0x02, 0x8B, 0x00, 0x01, 0x00, 0x69, 0x06, 0x8B, 0x00, 0x01, 0x00, 0x65, 0x0C,
+    0x8B, 0x00, 0x02, 0x00, 0x65, 0x69, 0x26, 0x0E, 0x00, 0x84, 0x14, 0x00, 0x01, 0x01, 0x13, 0x00,
+    0x2E, 0xC8, 0x17, 0x00, 0x01, 0x01, 0x1E, 0x00, 0x63, 0x3A, 0x32, 0x00, 0x01, 0x00, 0x6F, 0x26,
+    0x0E, 0x00, 0x01, 0x00, 0x70, 0x72, 0x35, 0x00, 0x01, 0x01, 0x06, 0x00, 0x65, 0x72, 0x35, 0x00,
+    0x01, 0x00, 0x72, 0x14, 0x8B, 0x00, 0x00, 0x02, 0x1A, 0x01, 0x01, 0x00, 0x67, 0x1A, 0x8B, 0x00,
+    0x01, 0x00, 0x6C, 0x20, 0x8B, 0x00, 0x01, 0x00, 0x6E, 0x24, 0x8B, 0x00, 0x03, 0x00, 0x63, 0x73,
+    0x7A, 0x4C, 0x38, 0x00, 0x2A, 0x8B, 0x00, 0x40, 0x7A, 0x00, 0x01, 0x00, 0x67, 0x4E, 0x2F, 0x00,
+    0x01, 0x00, 0x71, 0x10, 0x46, 0x00, 0x02, 0x01, 0x1C, 0x00, 0x73, 0x7A, 0x30, 0x8B, 0x00, 0x26,
+    0x0E, 0x00, 0x01, 0x00, 0x6C, 0x36, 0x8B, 0x00, 0x02, 0x00, 0x62, 0x72, 0x32, 0x3B, 0x00, 0xD2,
+    0x36, 0x00, 0x02, 0x00, 0x6C, 0x6D, 0x40, 0x8B, 0x00, 0x44, 0x8B, 0x00, 0x02, 0x00, 0x65, 0x67,
+    0x84, 0x14, 0x00, 0x3C, 0x73, 0x00, 0x01, 0x00, 0x70, 0x22, 0x6D, 0x00, 0x01, 0x00, 0x6C, 0x4A,
+    0x8B, 0x00, 0x00, 0x02, 0x9A, 0x01, 0x01, 0x00, 0x73, 0x40, 0x7A, 0x00, 0x01, 0x01, 0x2E, 0x00,
+    0x67, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x67, 0x94, 0x87, 0x00, 0x02, 0x00, 0x63, 0x74, 0x72, 0x35,
+    0x00, 0x74, 0x69, 0x00, 0x01, 0x00, 0x6C, 0x82, 0x6C, 0x00, 0x01, 0x00, 0x69, 0x50, 0x8B, 0x00,
+    0x01, 0x00, 0x74, 0x56, 0x8B, 0x00, 0x01, 0x00, 0x74, 0x60, 0x8B, 0x00, 0x02, 0x00, 0x65, 0x74,
+    0xFC, 0x39, 0x00, 0xDA, 0x6B, 0x00, 0x02, 0x00, 0x69, 0x6F, 0xB4, 0x6E, 0x00, 0x10, 0x2C, 0x00,
+    0x00, 0x02, 0x8C, 0x01, 0x01, 0x00, 0x7A, 0x4C, 0x38, 0x00, 0x01, 0x00, 0x73, 0x80, 0x2F, 0x00,
+    0x02, 0x00, 0x63, 0x74, 0x84, 0x14, 0x00, 0x64, 0x8B, 0x00, 0x01, 0x00, 0x6F, 0x6A, 0x8B, 0x00,
+    0x02, 0x00, 0x2E, 0x68, 0x26, 0x0E, 0x00, 0x72, 0x35, 0x00, 0x02, 0x00, 0x65, 0x69, 0x26, 0x0E,
+    0x00, 0xDC, 0x7B, 0x00, 0x01, 0x00, 0x6F, 0x70, 0x8B, 0x00, 0x01, 0x00, 0x68, 0x76, 0x8B, 0x00,
+    0x01, 0x00, 0x73, 0x0A, 0x3D, 0x00, 0x01, 0x01, 0x05, 0x00, 0x72, 0x22, 0x33, 0x00, 0x02, 0x00,
+    0x2E, 0x61, 0x72, 0x35, 0x00, 0x72, 0x35, 0x00, 0x01, 0x01, 0x14, 0x00, 0x69, 0x26, 0x0E, 0x00,
+    0x01, 0x00, 0x6E, 0x7C, 0x8B, 0x00, 0x01, 0x00, 0x6C, 0x4C, 0x38, 0x00, 0x01, 0x00, 0x79, 0x72,
+    0x35, 0x00, 0x02, 0x00, 0x69, 0x79, 0x50, 0x8B, 0x00, 0x72, 0x35, 0x00, 0x01, 0x00, 0x6D, 0x18,
+    0x4D, 0x00, 0x01, 0x00, 0x6F, 0x82, 0x8B, 0x00, 0x01, 0x00, 0x69, 0x88, 0x8B, 0x00, 0x01, 0x02,
+    0x60, 0x00, 0x66, 0xE8, 0x85, 0x00, 0x01, 0x01, 0x14, 0x00, 0x61, 0x90, 0x8B, 0x00, 0x01, 0x00,
+    0x6D, 0x98, 0x8B, 0x00, 0x01, 0x00, 0x67, 0x0A, 0x3D, 0x00, 0x01, 0x01, 0x1C, 0x00, 0x6C, 0x26,
+    0x0E, 0x00, 0x02, 0x00, 0x68, 0x74, 0x32, 0x3B, 0x00, 0x94, 0x6E, 0x00, 0x01, 0x01, 0x0B, 0x00,
+    0x6E, 0x32, 0x3B, 0x00, 0x04, 0x00, 0x69, 0x6F, 0x72, 0x79, 0x72, 0x35, 0x00, 0x9E, 0x8B, 0x00,
+    0xA4, 0x8B, 0x00, 0x72, 0x35, 0x00, 0x01, 0x00, 0x76, 0xAA, 0x8B, 0x00, 0x01, 0x00, 0x70, 0xB0,
+    0x8B, 0x00, 0x03, 0x00, 0x69, 0x6F, 0x79, 0xB4, 0x6E, 0x00, 0x72, 0x35, 0x00, 0x72, 0x35, 0x00,
+    0x01, 0x00, 0x65, 0xB8, 0x8B, 0x00, 0x01, 0x01, 0x1E, 0x00, 0x74, 0x66, 0x2D, 0x00, 0x02, 0x00,
+    0x6C, 0x74, 0xFC, 0x39, 0x00, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x65, 0xEA, 0x6D, 0x00, 0x02, 0x00,
+    0x2E, 0x73, 0x72, 0x35, 0x00, 0xFC, 0x39, 0x00, 0x01, 0x01, 0x05, 0x00, 0x74, 0xBE, 0x8B, 0x00,
+    0x02, 0x00, 0x6F, 0x73, 0xC8, 0x8B, 0x00, 0xEE, 0x36, 0x00, 0x03, 0x00, 0x2E, 0x61, 0x65, 0x72,
+    0x35, 0x00, 0xFC, 0x39, 0x00, 0x84, 0x14, 0x00, 0x01, 0x00, 0x64, 0xCE, 0x8B, 0x00, 0x03, 0x00,
+    0x6E, 0x73, 0x74, 0x30, 0x41, 0x00, 0xA4, 0x6C, 0x00, 0x9C, 0x0C, 0x00, 0x01, 0x00, 0x6E, 0xD4,
+    0x8B, 0x00, 0x01, 0x00, 0x69, 0xDA, 0x8B, 0x00, 0x02, 0x00, 0x6E, 0x74, 0x3A, 0x2E, 0x00, 0x84,
+    0x14, 0x00, 0x01, 0x00, 0x61, 0xE0, 0x8B, 0x00, 0x04, 0x00, 0x62, 0x67, 0x6C, 0x6D, 0x98, 0x44,
+    0x00, 0xE6, 0x8B, 0x00, 0xF0, 0x8B, 0x00, 0xF6, 0x8B, 0x00, 0x01, 0x01, 0x19, 0x00, 0x6C, 0x32,
+    0x3B, 0x00, 0x01, 0x02, 0x70, 0x01, 0x73, 0x4E, 0x2F, 0x00, 0x01, 0x01, 0x1E, 0x00, 0x72, 0xFC,
+    0x39, 0x00, 0x02, 0x00, 0x69, 0x79, 0xF2, 0x87, 0x00, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x6C, 0xDA,
+    0x6B, 0x00, 0x02, 0x01, 0x19, 0x00, 0x61, 0x63, 0xCA, 0x86, 0x00, 0x4E, 0x2F, 0x00, 0x00, 0x02,
+    0xE0, 0x00, 0x01, 0x00, 0x68, 0x4E, 0x2F, 0x00, 0x03, 0x00, 0x2E, 0x62, 0x67, 0x10, 0x2C, 0x00,
+    0x98, 0x44, 0x00, 0x10, 0x2C, 0x00, 0x01, 0x01, 0x05, 0x00, 0x73, 0xAA, 0x4D, 0x00, 0x02, 0x00,
+    0x61, 0x65, 0x7C, 0x55, 0x00, 0xE8, 0x85, 0x00, 0x01, 0x00, 0x61, 0xFE, 0x8B, 0x00, 0x01, 0x00,
+    0x74, 0x1C, 0x45, 0x00, 0x02, 0x00, 0x65, 0x69, 0x4C, 0x38, 0x00, 0x3A, 0x2E, 0x00, 0x01, 0x00,
+    0x64, 0x08, 0x8C, 0x00, 0x01, 0x00, 0x61, 0x78, 0x19, 0x00, 0x01, 0x01, 0x10, 0x00, 0x61, 0xFC,
+    0x39, 0x00, 0x01, 0x00, 0x61, 0x0C, 0x8C, 0x00, 0x01, 0x01, 0x06, 0x00, 0x61, 0x2E, 0x30, 0x00,
+    0x01, 0x01, 0x06, 0x00, 0x62, 0xDA, 0x6B, 0x00, 0x00, 0x02, 0x5C, 0x01, 0x02, 0x01, 0x8D, 0x00,
+    0x63, 0x74, 0x6A, 0x6B, 0x00, 0x3A, 0x2E, 0x00, 0x01, 0x00, 0x2E, 0xC6, 0x0E, 0x00, 0x03, 0x00,
+    0x65, 0x70, 0x74, 0x22, 0x6D, 0x00, 0x12, 0x8C, 0x00, 0xA0, 0x6C, 0x00, 0x01, 0x00, 0x69, 0xD8,
+    0x30, 0x00, 0x02, 0x00, 0x69, 0x6F, 0x3A, 0x2E, 0x00, 0x32, 0x3B, 0x00, 0x01, 0x00, 0x61, 0x2E,
+    0x6C, 0x00, 0x01, 0x00, 0x61, 0x18, 0x8C, 0x00, 0x01, 0x00, 0x65, 0x1E, 0x8C, 0x00, 0x03, 0x00,
+    0x65, 0x70, 0x73, 0x84, 0x14, 0x00, 0x24, 0x8C, 0x00, 0x4C, 0x38, 0x00, 0x01, 0x00, 0x74, 0x2A,
+    0x8C, 0x00, 0x01, 0x01, 0x06, 0x00, 0x6F, 0xA4, 0x6C, 0x00, 0x03, 0x00, 0x61, 0x65, 0x69, 0x84,
+    0x14, 0x00, 0x2E, 0x8C, 0x00, 0x34, 0x8C, 0x00, 0x01, 0x00, 0x69, 0xAA, 0x4D, 0x00, 0x01, 0x00,
+    0x65, 0x5E, 0x7E, 0x00, 0x01, 0x00, 0x64, 0x3A, 0x8C, 0x00, 0x01, 0x00, 0x61, 0x42, 0x8C, 0x00,
+    0x01, 0x00, 0x6C, 0x48, 0x8C, 0x00, 0x01, 0x00, 0x73, 0x4C, 0x8C, 0x00, 0x02, 0x00, 0x65, 0x69,
+    0x64, 0x31, 0x00, 0x86, 0x3F, 0x00, 0x01, 0x00, 0x6E, 0x52, 0x8C, 0x00, 0x01, 0x00, 0x69, 0x58,
+    0x8C, 0x00, 0x01, 0x00, 0x74, 0x64, 0x8C, 0x00, 0x01, 0x00, 0x61, 0x6A, 0x8C, 0x00, 0x01, 0x00,
+    0x6C, 0x70, 0x8C, 0x00, 0x02, 0x00, 0x65, 0x75, 0xDA, 0x6B, 0x00, 0x72, 0x35, 0x00, 0x02, 0x00,
+    0x67, 0x6F, 0x02, 0x8A, 0x00, 0x7A, 0x8C, 0x00, 0x02, 0x00, 0x6E, 0x74, 0xC6, 0x34, 0x00, 0x80,
+    0x8C, 0x00, 0x01, 0x01, 0x18, 0x00, 0x66, 0x32, 0x3B, 0x00, 0x01, 0x00, 0x6F, 0x88, 0x8C, 0x00,
+    0x02, 0x01, 0x2E, 0x00, 0x65, 0x67, 0x26, 0x0E, 0x00, 0x8E, 0x8C, 0x00, 0x01, 0x01, 0x18, 0x00,
+    0x67, 0x72, 0x35, 0x00, 0x01, 0x00, 0x61, 0x10, 0x41, 0x00, 0x01, 0x00, 0x70, 0x98, 0x8C, 0x00,
+    0x02, 0x00, 0x6C, 0x6D, 0x20, 0x71, 0x00, 0x9E, 0x8C, 0x00, 0x01, 0x00, 0x61, 0xA4, 0x8C, 0x00,
+    0x02, 0x00, 0x73, 0x74, 0x72, 0x35, 0x00, 0x32, 0x3B, 0x00, 0x01, 0x00, 0x63, 0x9C, 0x0C, 0x00,
+    0x01, 0x01, 0x1E, 0x00, 0x72, 0x94, 0x6E, 0x00, 0x02, 0x00, 0x61, 0x65, 0xF2, 0x40, 0x00, 0x4E,
+    0x2F, 0x00, 0x01, 0x00, 0x73, 0xEA, 0x39, 0x00, 0x01, 0x00, 0x69, 0x4C, 0x56, 0x00, 0x02, 0x01,
+    0x15, 0x00, 0x61, 0x72, 0xE2, 0x36, 0x00, 0x72, 0x35, 0x00, 0x01, 0x00, 0x7A, 0x32, 0x78, 0x00,
+    0x01, 0x00, 0x69, 0xAA, 0x8C, 0x00, 0x02, 0x00, 0x6C, 0x72, 0x80, 0x2F, 0x00, 0xB2, 0x8C, 0x00,
+    0x01, 0x00, 0x6C, 0x86, 0x76, 0x00, 0x01, 0x01, 0x06, 0x00, 0x67, 0x72, 0x35, 0x00, 0x02, 0x01,
+    0x0C, 0x00, 0x64, 0x65, 0x3A, 0x2E, 0x00, 0x9C, 0x0C, 0x00, 0x02, 0x00, 0x63, 0x74, 0x72, 0x35,
+    0x00, 0x72, 0x35, 0x00, 0x01, 0x01, 0x2E, 0x00, 0x2E, 0x3A, 0x2E, 0x00, 0x01, 0x01, 0x0D, 0x00,
+    0x65, 0xA0, 0x6C, 0x00, 0x01, 0x01, 0x1E, 0x00, 0x69, 0x44, 0x5E, 0x00, 0x01, 0x00, 0x62, 0x5C,
+    0x89, 0x00, 0x02, 0x00, 0x64, 0x72, 0x82, 0x6A, 0x00, 0xC0, 0x8C, 0x00, 0x01, 0x01, 0x1E, 0x00,
+    0x72, 0x32, 0x3B, 0x00, 0x02, 0x00, 0x6C, 0x74, 0x32, 0x3B, 0x00, 0x80, 0x2F, 0x00, 0x01, 0x00,
+    0x6C, 0xCA, 0x8C, 0x00, 0x01, 0x00, 0x75, 0x74, 0x0A, 0x00, 0x01, 0x00, 0x75, 0xAA, 0x6E, 0x00,
+    0x01, 0x01, 0x05, 0x00, 0x68, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x67, 0xCE, 0x8C, 0x00, 0x00, 0x02,
+    0x22, 0x01, 0x01, 0x00, 0x74, 0xD6, 0x8C, 0x00, 0x01, 0x00, 0x69, 0xDA, 0x8C, 0x00, 0x02, 0x00,
+    0x73, 0x74, 0x08, 0x6F, 0x00, 0x30, 0x4B, 0x00, 0x01, 0x00, 0x73, 0xF6, 0x7B, 0x00, 0x01, 0x00,
+    0x6F, 0x3A, 0x33, 0x00, 0x01, 0x00, 0x6C, 0xE0, 0x8C, 0x00, 0x01, 0x01, 0x10, 0x00, 0x72, 0x4E,
+    0x2F, 0x00, 0x02, 0x00, 0x2E, 0x61, 0xFC, 0x39, 0x00, 0xE6, 0x8C, 0x00, 0x00, 0x02, 0x14, 0x01,
+    0x01, 0x00, 0x68, 0xCA, 0x86, 0x00, 0x03, 0x00, 0x69, 0x6C, 0x79, 0xA4, 0x6C, 0x00, 0xDA, 0x6B,
+    0x00, 0x10, 0x2C, 0x00, 0x01, 0x00, 0x70, 0xEC, 0x8C, 0x00, 0x01, 0x00, 0x6C, 0x74, 0x0A, 0x00,
+    0x01, 0x00, 0x65, 0x3A, 0x2E, 0x00, 0x01, 0x00, 0x73, 0xF2, 0x8C, 0x00, 0x01, 0x00, 0x72, 0xFC,
+    0x8C, 0x00, 0x01, 0x00, 0x6F, 0xD0, 0x66, 0x00, 0x01, 0x00, 0x74, 0x02, 0x8D, 0x00, 0x01, 0x01,
+    0x06, 0x00, 0x65, 0x06, 0x8D, 0x00, 0x01, 0x00, 0x6F, 0x5E, 0x6E, 0x00, 0x01, 0x00, 0x74, 0x0C,
+    0x8D, 0x00, 0x01, 0x00, 0x6F, 0x12, 0x8D, 0x00, 0x01, 0x00, 0x64, 0x18, 0x8D, 0x00, 0x01, 0x00,
+    0x74, 0x1C, 0x8D, 0x00, 0x01, 0x00, 0x70, 0x22, 0x8D, 0x00, 0x01, 0x00, 0x68, 0x28, 0x8D, 0x00,
+    0x01, 0x00, 0x70, 0x2C, 0x8D, 0x00, 0x01, 0x01, 0x0C, 0x00, 0x73, 0x32, 0x8D, 0x00, 0x01, 0x00,
+    0x74, 0x38, 0x8D, 0x00, 0x01, 0x00, 0x64, 0x26, 0x0E, 0x00, 0x02, 0x00, 0x64, 0x6C, 0xE6, 0x0A,
+    0x00, 0xE6, 0x0A, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x01, 0x00, 0x65, 0x3E, 0x8D, 0x00, 0x01, 0x00,
+    0x73, 0x20, 0x89, 0x00, 0x01, 0x01, 0x18, 0x00, 0x74, 0xE8, 0x85, 0x00, 0x03, 0x00, 0x2E, 0x64,
+    0x73, 0x4C, 0x38, 0x00, 0xB6, 0x87, 0x00, 0x44, 0x8D, 0x00, 0x01, 0x01, 0x0D, 0x00, 0x61, 0xA0,
+    0x6C, 0x00, 0x01, 0x00, 0x73, 0x50, 0x8D, 0x00, 0x02, 0x00, 0x65, 0x67, 0xFC, 0x39, 0x00, 0xFC,
+    0x39, 0x00, 0x01, 0x00, 0x63, 0x10, 0x46, 0x00, 0x01, 0x00, 0x61, 0x56, 0x8D, 0x00, 0x01, 0x00,
+    0x68, 0x3A, 0x2E, 0x00, 0x01, 0x00, 0x64, 0x00, 0x86, 0x00, 0x01, 0x00, 0x6D, 0x5C, 0x8D, 0x00,
+    0x01, 0x00, 0x62, 0x9C, 0x0C, 0x00, 0x00, 0x02, 0xEC, 0x00, 0x01, 0x00, 0x74, 0x04, 0x53, 0x00,
+    0x02, 0x00, 0x69, 0x79, 0x62, 0x8D, 0x00, 0x26, 0x0E, 0x00, 0x02, 0x00, 0x65, 0x69, 0x6C, 0x8D,
+    0x00, 0x70, 0x8D, 0x00, 0x01, 0x00, 0x69, 0x3E, 0x4D, 0x00, 0x01, 0x01, 0x2E, 0x00, 0x72, 0x76,
+    0x8D, 0x00, 0x01, 0x00, 0x69, 0x5E, 0x6E, 0x00, 0x01, 0x00, 0x65, 0x7E, 0x8D, 0x00, 0x01, 0x01,
+    0x18, 0x00, 0x74, 0x84, 0x8D, 0x00, 0x01, 0x00, 0x6C, 0x2A, 0x6F, 0x00, 0x01, 0x00, 0x74, 0x8A,
+    0x8D, 0x00, 0x01, 0x00, 0x68, 0x90, 0x8D, 0x00, 0x01, 0x00, 0x6E, 0xA4, 0x88, 0x00, 0x01, 0x01,
+    0x05, 0x00, 0x72, 0x4E, 0x2F, 0x00, 0x01, 0x00, 0x6E, 0x96, 0x8D, 0x00, 0x01, 0x00, 0x6E, 0x9C,
+    0x8D, 0x00, 0x02, 0x00, 0x69, 0x70, 0xDA, 0x6B, 0x00, 0x08, 0x4D, 0x00, 0x02, 0x00, 0x64, 0x74,
+    0x3A, 0x2E, 0x00, 0xA2, 0x8D, 0x00, 0x01, 0x00, 0x74, 0x84, 0x7C, 0x00, 0x02, 0x00, 0x2E, 0x69,
+    0x3A, 0x2E, 0x00, 0x10, 0x46, 0x00, 0x02, 0x00, 0x6E, 0x6F, 0x38, 0x70, 0x00, 0x26, 0x0E, 0x00,
+    0x01, 0x01, 0x15, 0x00, 0x61, 0xA0, 0x6C, 0x00, 0x01, 0x01, 0x12, 0x00, 0x6B, 0x3A, 0x2E, 0x00,
+    0x02, 0x00, 0x61, 0x65, 0xA8, 0x8D, 0x00, 0x4C, 0x38, 0x00, 0x03, 0x00, 0x64, 0x74, 0x79, 0x10,
+    0x2C, 0x00, 0xAE, 0x8D, 0x00, 0x10, 0x2C, 0x00, 0x02, 0x00, 0x62, 0x64, 0xEC, 0x86, 0x00, 0x10,
+    0x2C, 0x00, 0x01, 0x00, 0x69, 0xB8, 0x8D, 0x00, 0x01, 0x00, 0x69, 0xAE, 0x76, 0x00, 0x01, 0x00,
+    0x72, 0xBE, 0x8D, 0x00, 0x01, 0x00, 0x6D, 0xC4, 0x8D, 0x00, 0x01, 0x00, 0x69, 0xC8, 0x8D, 0x00,
+    0x01, 0x00, 0x65, 0x90, 0x6F, 0x00, 0x01, 0x00, 0x6C, 0xCC, 0x8D, 0x00, 0x01, 0x00, 0x6E, 0xBC,
+    0x6F, 0x00, 0x01, 0x01, 0x0C, 0x00, 0x61, 0xD2, 0x8D, 0x00, 0x01, 0x00, 0x6E, 0xD6, 0x8D, 0x00,
+    0x01, 0x00, 0x61, 0x0A, 0x86, 0x00, 0x01, 0x00, 0x74, 0xDA, 0x8D, 0x00, 0x01, 0x00, 0x68, 0xE0,
+    0x8D, 0x00, 0x01, 0x00, 0x73, 0x4E, 0x2F, 0x00, 0x01, 0x00, 0x65, 0xE4, 0x8D, 0x00, 0x01, 0x00,
+    0x68, 0x22, 0x8D, 0x00, 0x02, 0x00, 0x67, 0x72, 0x1E, 0x6C, 0x00, 0xEA, 0x8D, 0x00, 0x01, 0x02,
+    0xA6, 0x00, 0x74, 0x80, 0x2F, 0x00, 0x01, 0x01, 0x07, 0x00, 0x61, 0x1A, 0x7C, 0x00, 0x00, 0x02,
+    0xA4, 0x00, 0x01, 0x00, 0x65, 0xF0, 0x8D, 0x00, 0x04, 0x01, 0x07, 0x00, 0x63, 0x65, 0x73, 0x7A,
+    0xB6, 0x87, 0x00, 0xC4, 0x46, 0x00, 0x80, 0x2F, 0x00, 0x42, 0x39, 0x00, 0x01, 0x00, 0x69, 0xB6,
+    0x78, 0x00, 0x02, 0x01, 0x0C, 0x00, 0x2E, 0x65, 0x84, 0x14, 0x00, 0xF6, 0x8D, 0x00, 0x01, 0x00,
+    0x61, 0xFC, 0x8D, 0x00, 0x02, 0x01, 0x0C, 0x00, 0x73, 0x74, 0x72, 0x35, 0x00, 0x32, 0x3B, 0x00,
+    0x02, 0x00, 0x2E, 0x61, 0xFC, 0x39, 0x00, 0xFC, 0x39, 0x00, 0x03, 0x00, 0x65, 0x69, 0x6F, 0xFC,
+    0x39, 0x00, 0xF2, 0x87, 0x00, 0xE2, 0x70, 0x00, 0x01, 0x00, 0x65, 0x02, 0x8E, 0x00, 0x01, 0x00,
+    0x65, 0x08, 0x8E, 0x00, 0x01, 0x00, 0x69, 0x0E, 0x8E, 0x00, 0x01, 0x00, 0x61, 0x18, 0x8E, 0x00,
+    0x01, 0x00, 0x2E, 0x7E, 0x3B, 0x00, 0x00, 0x02, 0x96, 0x00, 0x01, 0x00, 0x6D, 0x1E, 0x8E, 0x00,
+    0x01, 0x00, 0x65, 0x9A, 0x2F, 0x00, 0x01, 0x00, 0x69, 0x22, 0x8E, 0x00, 0x01, 0x00, 0x72, 0x28,
+    0x8E, 0x00, 0x01, 0x00, 0x67, 0x2C, 0x8E, 0x00, 0x02, 0x00, 0x6C, 0x74, 0x5C, 0x2C, 0x00, 0x72,
+    0x35, 0x00, 0x02, 0x00, 0x65, 0x7A, 0x72, 0x35, 0x00, 0x32, 0x3B, 0x00, 0x03, 0x00, 0x68, 0x69,
+    0x74, 0x32, 0x3B, 0x00, 0x32, 0x8E, 0x00, 0x30, 0x41, 0x00, 0x01, 0x00, 0x74, 0x3A, 0x8E, 0x00,
+    0x01, 0x00, 0x65, 0x40, 0x8E, 0x00, 0x01, 0x00, 0x63, 0x4E, 0x8E, 0x00, 0x01, 0x01, 0x06, 0x00,
+    0x69, 0xA0, 0x6C, 0x00, 0x01, 0x01, 0x0D, 0x00, 0x6C, 0xAE, 0x6E, 0x00, 0x03, 0x00, 0x65, 0x69,
+    0x73, 0xC4, 0x46, 0x00, 0x40, 0x76, 0x00, 0xE6, 0x0A, 0x00, 0x01, 0x00, 0x69, 0x54, 0x8E, 0x00,
+    0x01, 0x00, 0x65, 0x5E, 0x8E, 0x00, 0x02, 0x00, 0x69, 0x79, 0xA0, 0x6C, 0x00, 0xE6, 0x0A, 0x00,
+    0x03, 0x00, 0x68, 0x69, 0x6F, 0x30, 0x4B, 0x00, 0x64, 0x8E, 0x00, 0x6A, 0x8E, 0x00, 0x01, 0x00,
+    0x70, 0x80, 0x2F, 0x00, 0x01, 0x00, 0x62, 0x70, 0x8E, 0x00, 0x01, 0x01, 0x0D, 0x00, 0x73, 0x80,
+    0x2F, 0x00, 0x01, 0x00, 0x61, 0x76, 0x8E, 0x00, 0x01, 0x00, 0x6C, 0x70, 0x71, 0x00, 0x01, 0x00,
+    0x61, 0x7C, 0x8E, 0x00, 0x01, 0x00, 0x6E, 0xDE, 0x6B, 0x00, 0x01, 0x01, 0x10, 0x00, 0x6F, 0x10,
+    0x2C, 0x00, 0x01, 0x00, 0x67, 0x70, 0x6B, 0x00, 0x02, 0x00, 0x64, 0x73, 0x72, 0x35, 0x00, 0x72,
+    0x35, 0x00, 0x01, 0x01, 0x05, 0x00, 0x79, 0x82, 0x8E, 0x00, 0x01, 0x01, 0x18, 0x00, 0x65, 0x3A,
+    0x2E, 0x00, 0x02, 0x00, 0x62, 0x73, 0x32, 0x78, 0x00, 0x9C, 0x0C, 0x00, 0x01, 0x00, 0x62, 0x80,
+    0x2F, 0x00, 0x02, 0x00, 0x72, 0x73, 0xAE, 0x6E, 0x00, 0x9C, 0x0C, 0x00, 0x01, 0x00, 0x72, 0x86,
+    0x8E, 0x00, 0x01, 0x00, 0x2E, 0xDC, 0x88, 0x00, 0x01, 0x00, 0x6C, 0x88, 0x8A, 0x00, 0x01, 0x01,
+    0x10, 0x00, 0x69, 0xC0, 0x30, 0x00, 0x01, 0x00, 0x6E, 0x8C, 0x8E, 0x00, 0x01, 0x01, 0x18, 0x00,
+    0x65, 0x9C, 0x0C, 0x00, 0x01, 0x00, 0x72, 0x0A, 0x3D, 0x00, 0x01, 0x01, 0x0C, 0x00, 0x69, 0xDA,
+    0x6B, 0x00, 0x02, 0x00, 0x65, 0x67, 0x84, 0x14, 0x00, 0x72, 0x35, 0x00, 0x01, 0x00, 0x6E, 0x50,
+    0x89, 0x00, 0x00, 0x02, 0x5C, 0x00, 0x01, 0x00, 0x61, 0x92, 0x8E, 0x00, 0x01, 0x00, 0x65, 0x98,
+    0x8E, 0x00, 0x01, 0x00, 0x65, 0x86, 0x36, 0x00, 0x01, 0x00, 0x76, 0x74, 0x0A, 0x00, 0x01, 0x00,
+    0x65, 0x9E, 0x8E, 0x00, 0x05, 0x00, 0x2E, 0x69, 0x6C, 0x6E, 0x73, 0x3A, 0x2E, 0x00, 0xA4, 0x8E,
+    0x00, 0xAA, 0x8E, 0x00, 0xB2, 0x8E, 0x00, 0x10, 0x2C, 0x00, 0x01, 0x00, 0x69, 0x32, 0x72, 0x00,
+    0x02, 0x00, 0x65, 0x69, 0x4E, 0x2F, 0x00, 0xBA, 0x8E, 0x00, 0x01, 0x01, 0x0B, 0x00, 0x72, 0x80,
+    0x2F, 0x00, 0x04, 0x00, 0x2E, 0x64, 0x6E, 0x73, 0x3A, 0x2E, 0x00, 0x3A, 0x2E, 0x00, 0x76, 0x0C,
+    0x00, 0x3A, 0x2E, 0x00, 0x02, 0x00, 0x74, 0x7A, 0x3A, 0x2E, 0x00, 0x02, 0x8A, 0x00, 0x01, 0x00,
+    0x70, 0xC0, 0x8E, 0x00, 0x01, 0x00, 0x65, 0xC6, 0x8E, 0x00, 0x01, 0x00, 0x64, 0xCC, 0x8E, 0x00,
+    0x01, 0x00, 0x65, 0xE6, 0x0A, 0x00, 0x01, 0x01, 0x06, 0x00, 0x65, 0xD2, 0x8E, 0x00, 0x02, 0x00,
+    0x67, 0x72, 0xD8, 0x8E, 0x00, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x6E, 0x22, 0x6D, 0x00, 0x01, 0x00,
+    0x73, 0xDC, 0x8E, 0x00, 0x01, 0x00, 0x6E, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x61, 0xE2, 0x8E, 0x00,
+    0x02, 0x00, 0x61, 0x65, 0xCA, 0x86, 0x00, 0xA4, 0x89, 0x00, 0x01, 0x00, 0x74, 0xE8, 0x8E, 0x00,
+    0x01, 0x00, 0x73, 0x0A, 0x86, 0x00, 0x01, 0x01, 0x06, 0x00, 0x64, 0xEE, 0x8E, 0x00, 0x01, 0x00,
+    0x65, 0xF2, 0x8E, 0x00, 0x01, 0x00, 0x6C, 0xE8, 0x85, 0x00, 0x01, 0x00, 0x72, 0xF8, 0x8E, 0x00,
+    0x01, 0x00, 0x6F, 0x74, 0x0A, 0x00, 0x01, 0x00, 0x72, 0xFE, 0x8E, 0x00, 0x01, 0x00, 0x73, 0xE8,
+    0x85, 0x00, 0x01, 0x00, 0x72, 0x02, 0x8F, 0x00, 0x00, 0x01, 0x27, 0x00, 0x01, 0x00, 0x6C, 0xE6,
+    0x89, 0x00, 0x01, 0x01, 0x34, 0x00, 0x76, 0xFC, 0x31, 0x00, 0x01, 0x00, 0x69, 0x06, 0x8F, 0x00,
+    0x00, 0x02, 0xEE, 0x00, 0x01, 0x00, 0x68, 0x02, 0x8F, 0x00, 0x00, 0x01, 0x31, 0x00, 0x01, 0x00,
+    0x74, 0x0C, 0x8F, 0x00, 0x01, 0x00, 0x6C, 0x10, 0x8F, 0x00, 0x01, 0x00, 0x73, 0x14, 0x8F, 0x00,
+    0x01, 0x00, 0x6D, 0x1A, 0x8F, 0x00, 0x00, 0x02, 0xCC, 0x02, 0x00, 0x02, 0x04, 0x02, 0x00, 0x02,
+    0xCA, 0x02, 0x00, 0x02, 0xC8, 0x02, 0x02, 0x00, 0x65, 0x69, 0x80, 0x2F, 0x00, 0xE8, 0x85, 0x00,
+    0x01, 0x00, 0x79, 0xA0, 0x6C, 0x00, 0x01, 0x00, 0x69, 0x1E, 0x8F, 0x00, 0x01, 0x00, 0x65, 0x22,
+    0x8F, 0x00, 0x01, 0x00, 0x65, 0x26, 0x8F, 0x00, 0x00, 0x02, 0xBB, 0x02, 0x01, 0x00, 0x6C, 0x28,
+    0x8D, 0x00, 0x01, 0x00, 0x6C, 0x9E, 0x67, 0x00, 0x01, 0x00, 0x63, 0x2C, 0x8F, 0x00, 0x01, 0x00,
+    0x72, 0x30, 0x8F, 0x00, 0x01, 0x01, 0x1C, 0x00, 0x62, 0xE8, 0x85, 0x00, 0x00, 0x02, 0xB4, 0x01,
+    0x01, 0x00, 0x68, 0x22, 0x6D, 0x00, 0x01, 0x00, 0x6D, 0x36, 0x8F, 0x00, 0x01, 0x00, 0x73, 0xFE,
+    0x88, 0x00, 0x01, 0x00, 0x61, 0x3A, 0x8F, 0x00, 0x01, 0x00, 0x6D, 0x22, 0x6D, 0x00, 0x01, 0x00,
+    0x6F, 0x40, 0x8F, 0x00, 0x01, 0x00, 0x6E, 0x46, 0x8F, 0x00, 0x00, 0x02, 0xA3, 0x01, 0x06, 0x01,
+    0x27, 0x00, 0x63, 0x64, 0x70, 0x72, 0x73, 0x76, 0xDA, 0x6B, 0x00, 0x4C, 0x8F, 0x00, 0x50, 0x8F,
+    0x00, 0x50, 0x8F, 0x00, 0x54, 0x8F, 0x00, 0x50, 0x8F, 0x00, 0x00, 0x01, 0x39, 0x00, 0x01, 0x00,
+    0x6E, 0x58, 0x8F, 0x00, 0x01, 0x00, 0x6F, 0xFE, 0x88, 0x00, 0x01, 0x00, 0x73, 0x5C, 0x8F, 0x00,
+    0x01, 0x00, 0x67, 0x34, 0x30, 0x00, 0x01, 0x00, 0x67, 0x62, 0x8F, 0x00, 0x01, 0x00, 0x75, 0xA4,
+    0x75, 0x00, 0x01, 0x00, 0x74, 0x66, 0x8F, 0x00, 0x01, 0x00, 0x72, 0x6A, 0x8F, 0x00, 0x01, 0x00,
+    0x72, 0x1C, 0x77, 0x00, 0x02, 0x00, 0x63, 0x7A, 0x26, 0x0E, 0x00, 0xA0, 0x6F, 0x00, 0x01, 0x00,
+    0x68, 0x6E, 0x8F, 0x00, 0x01, 0x00, 0x61, 0x72, 0x8F, 0x00, 0x01, 0x01, 0x19, 0x00, 0x73, 0x78,
+    0x8F, 0x00, 0x00, 0x03, 0xAC, 0x02, 0x01, 0x00, 0x65, 0x22, 0x6D, 0x00, 0x01, 0x00, 0x6C, 0x7C,
+    0x8F, 0x00, 0x01, 0x00, 0x61, 0x82, 0x8F, 0x00, 0x01, 0x00, 0x74, 0x52, 0x43, 0x00, 0x02, 0x00,
+    0x6F, 0x76, 0x26, 0x0E, 0x00, 0xFC, 0x39, 0x00, 0x01, 0x00, 0x74, 0x8A, 0x8F, 0x00, 0x01, 0x00,
+    0x67, 0x04, 0x53, 0x00, 0x01, 0x00, 0x74, 0x8E, 0x8F, 0x00, 0x01, 0x01, 0x1F, 0x00, 0x61, 0x26,
+    0x0E, 0x00, 0x01, 0x00, 0x6F, 0x94, 0x8F, 0x00, 0x01, 0x00, 0x61, 0x9A, 0x8F, 0x00, 0x01, 0x00,
+    0x2E, 0x6E, 0x8F, 0x00, 0x01, 0x00, 0x72, 0xA0, 0x8F, 0x00, 0x01, 0x00, 0x69, 0xA6, 0x8F, 0x00,
+    0x00, 0x02, 0x1E, 0x01, 0x01, 0x00, 0x62, 0x58, 0x2F, 0x00, 0x01, 0x00, 0x65, 0xAC, 0x8F, 0x00,
+    0x00, 0x02, 0x9A, 0x02, 0x00, 0x02, 0x94, 0x01, 0x00, 0x02, 0x98, 0x02, 0x00, 0x02, 0x94, 0x02,
+    0x00, 0x03, 0x91, 0x02, 0x02, 0x01, 0x1C, 0x00, 0x72, 0x73, 0xB0, 0x8F, 0x00, 0xB0, 0x8F, 0x00,
+    0x01, 0x00, 0x6E, 0x6E, 0x6F, 0x00, 0x01, 0x00, 0x2E, 0x58, 0x2F, 0x00, 0x00, 0x02, 0xA5, 0x01,
+    0x00, 0x03, 0x89, 0x02, 0x01, 0x00, 0x61, 0x02, 0x8F, 0x00, 0x01, 0x01, 0x19, 0x00, 0x62, 0x0C,
+    0x8F, 0x00, 0x02, 0x00, 0x63, 0x73, 0x3A, 0x2E, 0x00, 0xA0, 0x6F, 0x00, 0x02, 0x00, 0x2E, 0x73,
+    0x3A, 0x2E, 0x00, 0x90, 0x6F, 0x00, 0x01, 0x00, 0x74, 0xB4, 0x8F, 0x00, 0x01, 0x00, 0x6E, 0xBA,
+    0x8F, 0x00, 0x01, 0x00, 0x63, 0x3A, 0x2E, 0x00, 0x01, 0x01, 0x0D, 0x00, 0x65, 0x80, 0x2F, 0x00,
+    0x01, 0x00, 0x64, 0xBE, 0x8F, 0x00, 0x01, 0x00, 0x6F, 0xEC, 0x80, 0x00, 0x01, 0x00, 0x65, 0xC2,
+    0x8F, 0x00, 0x01, 0x00, 0x63, 0xC8, 0x8F, 0x00, 0x01, 0x00, 0x65, 0x30, 0x14, 0x00, 0x01, 0x00,
+    0x72, 0xCE, 0x8F, 0x00, 0x01, 0x00, 0x6E, 0xD2, 0x8F, 0x00, 0x01, 0x00, 0x69, 0xD8, 0x8F, 0x00,
+    0x00, 0x02, 0x73, 0x02, 0x01, 0x01, 0x19, 0x00, 0x2E, 0x32, 0x3B, 0x00, 0x01, 0x00, 0x66, 0xE8,
+    0x85, 0x00, 0x01, 0x00, 0x7A, 0xA0, 0x6C, 0x00, 0x01, 0x00, 0x68, 0xDE, 0x8F, 0x00, 0x01, 0x00,
+    0x64, 0xE4, 0x8F, 0x00, 0x01, 0x00, 0x6C, 0xD2, 0x8D, 0x00, 0x01, 0x00, 0x61, 0x94, 0x87, 0x00,
+    0x01, 0x00, 0x65, 0xE8, 0x8F, 0x00, 0x01, 0x00, 0x64, 0xEE, 0x8F, 0x00, 0x01, 0x00, 0x6C, 0xF2,
+    0x8F, 0x00, 0x01, 0x00, 0x73, 0xAE, 0x63, 0x00, 0x02, 0x00, 0x63, 0x65, 0x3A, 0x32, 0x00, 0xFC,
+    0x39, 0x00, 0x01, 0x00, 0x6E, 0xF6, 0x8F, 0x00, 0x01, 0x00, 0x74, 0xFC, 0x8F, 0x00, 0x01, 0x00,
+    0x73, 0x5E, 0x7E, 0x00, 0x01, 0x00, 0x74, 0x02, 0x90, 0x00, 0x01, 0x00, 0x70, 0x08, 0x90, 0x00,
+    0x00, 0x03, 0x53, 0x02, 0x01, 0x00, 0x2E, 0x0E, 0x90, 0x00, 0x01, 0x00, 0x69, 0x12, 0x90, 0x00,
+    0x01, 0x00, 0x63, 0x02, 0x8F, 0x00, 0x01, 0x00, 0x65, 0x16, 0x90, 0x00, 0x01, 0x00, 0x64, 0x1C,
+    0x90, 0x00, 0x01, 0x00, 0x64, 0xDC, 0x8A, 0x00, 0x01, 0x01, 0x13, 0x00, 0x61, 0xA0, 0x6C, 0x00,
+    0x01, 0x00, 0x6E, 0xA4, 0x76, 0x00, 0x01, 0x00, 0x73, 0x98, 0x86, 0x00, 0x00, 0x02, 0x5E, 0x00,
+    0x01, 0x00, 0x73, 0x20, 0x90, 0x00, 0x01, 0x00, 0x61, 0x26, 0x90, 0x00, 0x04, 0x00, 0x2E, 0x65,
+    0x69, 0x79, 0x3A, 0x2E, 0x00, 0x2A, 0x90, 0x00, 0xF2, 0x87, 0x00, 0xE6, 0x0A, 0x00, 0x00, 0x01,
+    0x47, 0x00, 0x01, 0x00, 0x72, 0x30, 0x90, 0x00, 0x01, 0x00, 0x61, 0x34, 0x90, 0x00, 0x01, 0x00,
+    0x69, 0x34, 0x49, 0x00, 0x01, 0x00, 0x2E, 0x38, 0x90, 0x00, 0x01, 0x00, 0x68, 0x3C, 0x90, 0x00,
+    0x01, 0x00, 0x74, 0x22, 0x6D, 0x00, 0x01, 0x01, 0x06, 0x00, 0x65, 0x42, 0x90, 0x00, 0x01, 0x00,
+    0x61, 0xE2, 0x85, 0x00, 0x01, 0x00, 0x61, 0x48, 0x90, 0x00, 0x01, 0x00, 0x6E, 0x6A, 0x3A, 0x00,
+    0x01, 0x00, 0x73, 0x4C, 0x90, 0x00, 0x02, 0x00, 0x2E, 0x6C, 0x26, 0x0E, 0x00, 0x50, 0x90, 0x00,
+    0x01, 0x00, 0x61, 0xE8, 0x85, 0x00, 0x01, 0x00, 0x73, 0x50, 0x8F, 0x00, 0x00, 0x02, 0x27, 0x01,
+    0x01, 0x00, 0x6F, 0x56, 0x90, 0x00, 0x01, 0x00, 0x6D, 0x5C, 0x90, 0x00, 0x01, 0x00, 0x72, 0x62,
+    0x90, 0x00, 0x01, 0x00, 0x65, 0x40, 0x89, 0x00, 0x00, 0x02, 0xE7, 0x01, 0x01, 0x00, 0x67, 0x68,
+    0x90, 0x00, 0x01, 0x00, 0x69, 0x6C, 0x90, 0x00, 0x01, 0x00, 0x6E, 0xC6, 0x0E, 0x00, 0x00, 0x03,
+    0x06, 0x02, 0x01, 0x00, 0x73, 0x72, 0x90, 0x00, 0x01, 0x00, 0x6E, 0x2A, 0x86, 0x00, 0x01, 0x00,
+    0x64, 0x78, 0x90, 0x00, 0x01, 0x00, 0x72, 0x7C, 0x90, 0x00, 0x00, 0x02, 0x9B, 0x00, 0x01, 0x00,
+    0x62, 0x82, 0x90, 0x00, 0x01, 0x00, 0x64, 0x86, 0x90, 0x00, 0x01, 0x01, 0x0B, 0x00, 0x69, 0x44,
+    0x5E, 0x00, 0x01, 0x00, 0x64, 0xEE, 0x3C, 0x00, 0x03, 0x00, 0x2E, 0x61, 0x73, 0x4E, 0x2F, 0x00,
+    0x4E, 0x2F, 0x00, 0x4E, 0x2F, 0x00, 0x01, 0x00, 0x67, 0xD2, 0x8D, 0x00, 0x02, 0x00, 0x61, 0x73,
+    0x3A, 0x2E, 0x00, 0x40, 0x7A, 0x00, 0x01, 0x00, 0x69, 0x02, 0x8F, 0x00, 0x01, 0x00, 0x6C, 0x8C,
+    0x90, 0x00, 0x02, 0x00, 0x64, 0x72, 0x92, 0x90, 0x00, 0x7C, 0x90, 0x00, 0x01, 0x00, 0x6F, 0x98,
+    0x90, 0x00, 0x00, 0x02, 0x50, 0x00, 0x01, 0x00, 0x68, 0x9C, 0x90, 0x00, 0x01, 0x00, 0x79, 0xEC,
+    0x80, 0x00, 0x01, 0x00, 0x61, 0xA6, 0x90, 0x00, 0x01, 0x00, 0x72, 0xAC, 0x90, 0x00, 0x01, 0x00,
+    0x69, 0xB0, 0x90, 0x00, 0x01, 0x00, 0x63, 0xB4, 0x90, 0x00, 0x01, 0x00, 0x6F, 0xB8, 0x90, 0x00,
+    0x01, 0x00, 0x6E, 0xBC, 0x90, 0x00, 0x01, 0x00, 0x65, 0x94, 0x6E, 0x00, 0x01, 0x01, 0x8D, 0x00,
+    0x69, 0xC0, 0x90, 0x00, 0x01, 0x00, 0x63, 0xC6, 0x90, 0x00, 0x01, 0x00, 0x6E, 0xCA, 0x90, 0x00,
+    0x02, 0x00, 0x63, 0x65, 0x3A, 0x2E, 0x00, 0xFC, 0x39, 0x00, 0x00, 0x03, 0xD9, 0x01, 0x01, 0x00,
+    0x61, 0x4C, 0x38, 0x00, 0x01, 0x00, 0x67, 0x5E, 0x7E, 0x00, 0x01, 0x00, 0x6C, 0xCE, 0x90, 0x00,
+    0x02, 0x01, 0x05, 0x00, 0x69, 0x79, 0x32, 0x3B, 0x00, 0x26, 0x0E, 0x00, 0x01, 0x00, 0x2E, 0xD4,
+    0x90, 0x00, 0x01, 0x00, 0x65, 0xD8, 0x90, 0x00, 0x01, 0x00, 0x2E, 0x4E, 0x2F, 0x00, 0x01, 0x00,
+    0x79, 0x26, 0x0E, 0x00, 0x01, 0x00, 0x74, 0xE2, 0x90, 0x00, 0x01, 0x00, 0x73, 0x80, 0x87, 0x00,
+    0x00, 0x02, 0xC9, 0x01, 0x01, 0x00, 0x6E, 0xEA, 0x90, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x01, 0x00,
+    0x69, 0xEE, 0x90, 0x00, 0x01, 0x00, 0x74, 0xF4, 0x90, 0x00, 0x01, 0x00, 0x6E, 0xE2, 0x75, 0x00,
+    0x01, 0x01, 0x27, 0x00, 0x62, 0x32, 0x3B, 0x00, 0x01, 0x00, 0x74, 0x9A, 0x2F, 0x00, 0x01, 0x00,
+    0x6B, 0xF8, 0x90, 0x00, 0x01, 0x01, 0x31, 0x00, 0x75, 0xFC, 0x90, 0x00, 0x01, 0x00, 0x2E, 0x32,
+    0x3B, 0x00, 0x01, 0x00, 0x73, 0x00, 0x91, 0x00, 0x01, 0x00, 0x74, 0x06, 0x91, 0x00, 0x01, 0x00,
+    0x6B, 0x74, 0x0A, 0x00, 0x01, 0x00, 0x6B, 0x72, 0x35, 0x00, 0x01, 0x01, 0x0B, 0x00, 0x69, 0x0A,
+    0x91, 0x00, 0x00, 0x02, 0xB6, 0x01, 0x01, 0x00, 0x74, 0x10, 0x91, 0x00, 0x01, 0x02, 0xB2, 0x01,
+    0x73, 0x32, 0x3B, 0x00, 0x01, 0x00, 0x6F, 0x16, 0x91, 0x00, 0x01, 0x00, 0x69, 0x1C, 0x91, 0x00,
+    0x00, 0x02, 0xA7, 0x01, 0x01, 0x00, 0x6F, 0xBC, 0x87, 0x00, 0x01, 0x00, 0x74, 0xD6, 0x8D, 0x00,
+    0x01, 0x00, 0x6F, 0xAA, 0x86, 0x00, 0x02, 0x00, 0x69, 0x79, 0x22, 0x91, 0x00, 0x26, 0x91, 0x00,
+    0x00, 0x02, 0x9C, 0x01, 0x01, 0x00, 0x62, 0x02, 0x33, 0x00, 0x01, 0x00, 0x6C, 0x38, 0x70, 0x00,
+    0x01, 0x00, 0x63, 0x22, 0x6D, 0x00, 0x02, 0x00, 0x2E, 0x73, 0xFC, 0x39, 0x00, 0xFC, 0x39, 0x00,
+    0x00, 0x01, 0x91, 0x01, 0x01, 0x00, 0x65, 0x2C, 0x91, 0x00, 0x01, 0x00, 0x70, 0x32, 0x91, 0x00,
+    0x01, 0x00, 0x6D, 0x38, 0x91, 0x00, 0x01, 0x00, 0x61, 0x3C, 0x91, 0x00, 0x01, 0x00, 0x64, 0x3A,
+    0x2E, 0x00, 0x01, 0x00, 0x6E, 0x40, 0x91, 0x00, 0x01, 0x01, 0x39, 0x00, 0x72, 0xC4, 0x87, 0x00,
+    0x01, 0x01, 0x19, 0x00, 0x67, 0xE6, 0x0A, 0x00, 0x01, 0x00, 0x2E, 0x02, 0x33, 0x00, 0x01, 0x00,
+    0x6E, 0x44, 0x91, 0x00, 0x01, 0x00, 0x69, 0x22, 0x6D, 0x00, 0x01, 0x00, 0x65, 0x4A, 0x91, 0x00,
+    0x01, 0x01, 0x10, 0x00, 0x69, 0xE6, 0x0A, 0x00, 0x01, 0x00, 0x72, 0x3C, 0x73, 0x00, 0x02, 0x00,
+    0x65, 0x6F, 0x50, 0x91, 0x00, 0x56, 0x91, 0x00, 0x01, 0x00, 0x73, 0x5C, 0x91, 0x00, 0x01, 0x00,
+    0x6F, 0x5C, 0x89, 0x00, 0x01, 0x00, 0x2E, 0x60, 0x91, 0x00, 0x01, 0x00, 0x63, 0x64, 0x91, 0x00,
+    0x01, 0x00, 0x74, 0x62, 0x8F, 0x00, 0x02, 0x00, 0x65, 0x72, 0x32, 0x3B, 0x00, 0x68, 0x91, 0x00,
+    0x01, 0x00, 0x65, 0xAA, 0x89, 0x00, 0x01, 0x01, 0x39, 0x00, 0x65, 0xA4, 0x6C, 0x00, 0x02, 0x00,
+    0x6E, 0x74, 0x6E, 0x91, 0x00, 0x74, 0x91, 0x00, 0x00, 0x03, 0x66, 0x01, 0x01, 0x00, 0x62, 0x5E,
+    0x7E, 0x00, 0x01, 0x00, 0x68, 0x7A, 0x91, 0x00, 0x01, 0x00, 0x63, 0x80, 0x91, 0x00, 0x01, 0x00,
+    0x75, 0x10, 0x46, 0x00, 0x01, 0x00, 0x6C, 0xD0, 0x2E, 0x00, 0x00, 0x02, 0x50, 0x01, 0x01, 0x00,
+    0x73, 0x84, 0x91, 0x00, 0x01, 0x00, 0x74, 0x8A, 0x91, 0x00, 0x01, 0x02, 0x48, 0x01, 0x6F, 0x90,
+    0x91, 0x00, 0x01, 0x00, 0x74, 0x9A, 0x91, 0x00, 0x00, 0x02, 0x44, 0x01, 0x01, 0x00, 0x63, 0x9E,
+    0x91, 0x00, 0x01, 0x00, 0x74, 0xA2, 0x91, 0x00, 0x02, 0x03, 0x3C, 0x01, 0x72, 0x73, 0x4C, 0x8F,
+    0x00, 0x4C, 0x8F, 0x00, 0x01, 0x00, 0x65, 0xA8, 0x91, 0x00, 0x01, 0x00, 0x72, 0x64, 0x77, 0x00,
+    0x02, 0x00, 0x69, 0x6F, 0xAE, 0x91, 0x00, 0x1E, 0x8A, 0x00, 0x01, 0x00, 0x67, 0xAA, 0x8A, 0x00,
+    0x01, 0x01, 0x34, 0x00, 0x72, 0xB4, 0x91, 0x00, 0x01, 0x00, 0x6E, 0x50, 0x8F, 0x00, 0x02, 0x00,
+    0x2E, 0x65, 0xFC, 0x39, 0x00, 0xBA, 0x91, 0x00, 0x01, 0x00, 0x72, 0x1E, 0x8E, 0x00, 0x01, 0x00,
+    0x70, 0x30, 0x4B, 0x00, 0x01, 0x00, 0x6E, 0xBE, 0x91, 0x00, 0x01, 0x01, 0x13, 0x00, 0x62, 0xC4,
+    0x91, 0x00, 0x03, 0x00, 0x2E, 0x73, 0x74, 0xAA, 0x6E, 0x00, 0xFC, 0x39, 0x00, 0xFC, 0x39, 0x00,
+    0x02, 0x00, 0x2E, 0x73, 0x32, 0x3B, 0x00, 0x32, 0x3B, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x01, 0x01,
+    0x13, 0x00, 0x2E, 0x10, 0x2C, 0x00, 0x00, 0x02, 0x20, 0x01, 0x01, 0x00, 0x64, 0xCA, 0x91, 0x00,
+    0x01, 0x00, 0x69, 0xD0, 0x91, 0x00, 0x01, 0x00, 0x64, 0xD4, 0x91, 0x00, 0x01, 0x00, 0x68, 0x50,
+    0x8F, 0x00, 0x02, 0x00, 0x63, 0x77, 0x0A, 0x86, 0x00, 0xE8, 0x85, 0x00, 0x01, 0x00, 0x69, 0xDA,
+    0x91, 0x00, 0x00, 0x02, 0x0D, 0x01, 0x01, 0x00, 0x72, 0x64, 0x91, 0x00, 0x01, 0x00, 0x7A, 0x10,
+    0x2C, 0x00, 0x01, 0x00, 0x64, 0xE0, 0x91, 0x00, 0x00, 0x02, 0x07, 0x01, 0x01, 0x00, 0x74, 0xE6,
+    0x91, 0x00, 0x01, 0x00, 0x65, 0xEA, 0x91, 0x00, 0x00, 0x02, 0x03, 0x01, 0x01, 0x00, 0x68, 0xCA,
+    0x8C, 0x00, 0x01, 0x00, 0x74, 0xF0, 0x91, 0x00, 0x01, 0x00, 0x69, 0xF4, 0x91, 0x00, 0x01, 0x00,
+    0x6D, 0x9C, 0x84, 0x00, 0x02, 0x01, 0x0D, 0x00, 0x74, 0x77, 0xA0, 0x6C, 0x00, 0xA0, 0x6C, 0x00,
+    0x01, 0x00, 0x69, 0xEA, 0x4F, 0x00, 0x01, 0x00, 0x6B, 0xFA, 0x91, 0x00, 0x01, 0x00, 0x79, 0x00,
+    0x92, 0x00, 0x02, 0x00, 0x63, 0x7A, 0x3A, 0x2E, 0x00, 0x26, 0x0E, 0x00, 0x00, 0x02, 0xE4, 0x00,
+    0x01, 0x00, 0x6E, 0x08, 0x4D, 0x00, 0x01, 0x01, 0x19, 0x00, 0x6F, 0xFE, 0x88, 0x00, 0x01, 0x00,
+    0x73, 0x04, 0x92, 0x00, 0x01, 0x00, 0x73, 0x0A, 0x92, 0x00, 0x01, 0x00, 0x6F, 0xEE, 0x73, 0x00,
+    0x01, 0x00, 0x75, 0x14, 0x92, 0x00, 0x01, 0x00, 0x61, 0x18, 0x92, 0x00, 0x01, 0x00, 0x64, 0x50,
+    0x8F, 0x00, 0x01, 0x00, 0x73, 0x1E, 0x92, 0x00, 0x01, 0x00, 0x62, 0x24, 0x92, 0x00, 0x02, 0x00,
+    0x61, 0x75, 0x28, 0x92, 0x00, 0x3A, 0x2E, 0x00, 0x01, 0x00, 0x64, 0x2E, 0x92, 0x00, 0x01, 0x00,
+    0x65, 0x32, 0x92, 0x00, 0x00, 0x01, 0xBA, 0x00, 0x00, 0x03, 0xB7, 0x00, 0x01, 0x00, 0x69, 0x36,
+    0x92, 0x00, 0x00, 0x02, 0xB2, 0x00, 0x00, 0x02, 0xB0, 0x00, 0x01, 0x00, 0x68, 0x40, 0x92, 0x00,
+    0x00, 0x02, 0xAC, 0x00, 0x01, 0x00, 0x72, 0xB4, 0x90, 0x00, 0x01, 0x00, 0x6F, 0xAA, 0x8A, 0x00,
+    0x01, 0x00, 0x69, 0x44, 0x92, 0x00, 0x01, 0x00, 0x73, 0x48, 0x92, 0x00, 0x01, 0x00, 0x6D, 0xAA,
+    0x89, 0x00, 0x01, 0x00, 0x6E, 0x4C, 0x92, 0x00, 0x01, 0x00, 0x72, 0x52, 0x92, 0x00, 0x02, 0x00,
+    0x74, 0x7A, 0xA0, 0x6C, 0x00, 0x32, 0x3B, 0x00, 0x01, 0x00, 0x6E, 0xAA, 0x89, 0x00, 0x00, 0x03,
+    0x93, 0x00, 0x01, 0x00, 0x63, 0x40, 0x76, 0x00, 0x00, 0x02, 0x91, 0x00, 0x01, 0x00, 0x79, 0x1E,
+    0x6C, 0x00, 0x01, 0x01, 0x39, 0x00, 0x74, 0xDA, 0x6B, 0x00, 0x01, 0x00, 0x6F, 0x56, 0x92, 0x00,
+    0x03, 0x00, 0x6E, 0x72, 0x73, 0x32, 0x3B, 0x00, 0x5C, 0x92, 0x00, 0x62, 0x92, 0x00, 0x01, 0x00,
+    0x68, 0x66, 0x92, 0x00, 0x02, 0x00, 0x63, 0x74, 0x92, 0x90, 0x00, 0x80, 0x2F, 0x00, 0x01, 0x00,
+    0x75, 0x6C, 0x92, 0x00, 0x01, 0x00, 0x73, 0x52, 0x92, 0x00, 0x01, 0x00, 0x6C, 0x72, 0x92, 0x00,
+    0x01, 0x00, 0x75, 0x7C, 0x92, 0x00, 0x01, 0x00, 0x72, 0xA4, 0x6C, 0x00, 0x01, 0x00, 0x74, 0x82,
+    0x92, 0x00, 0x00, 0x02, 0x6A, 0x00, 0x01, 0x00, 0x74, 0x02, 0x8F, 0x00, 0x01, 0x00, 0x67, 0xDC,
+    0x8A, 0x00, 0x01, 0x00, 0x74, 0x8C, 0x92, 0x00, 0x01, 0x00, 0x72, 0x6E, 0x8F, 0x00, 0x01, 0x00,
+    0x76, 0x0A, 0x86, 0x00, 0x01, 0x00, 0x67, 0x92, 0x92, 0x00, 0x01, 0x01, 0x05, 0x00, 0x79, 0xD8,
+    0x7E, 0x00, 0x01, 0x01, 0x10, 0x00, 0x63, 0x32, 0x3B, 0x00, 0x01, 0x00, 0x74, 0x3A, 0x76, 0x00,
+    0x01, 0x00, 0x61, 0x96, 0x92, 0x00, 0x01, 0x00, 0x70, 0xFE, 0x88, 0x00, 0x01, 0x00, 0x75, 0x9C,
+    0x92, 0x00, 0x01, 0x00, 0x77, 0xA0, 0x92, 0x00, 0x00, 0x02, 0x40, 0x00, 0x01, 0x00, 0x70, 0xA0,
+    0x6C, 0x00, 0x01, 0x00, 0x72, 0xA6, 0x92, 0x00, 0x01, 0x00, 0x6F, 0x02, 0x8F, 0x00, 0x00, 0x02,
+    0x2C, 0x00, 0x01, 0x00, 0x72, 0xAC, 0x92, 0x00, 0x01, 0x00, 0x79, 0xA0, 0x6F, 0x00, 0x00, 0x02,
+    0x08, 0x00, 0x00, 0x01, 0x35, 0x00, 0x01, 0x00, 0x6F, 0xB2, 0x92, 0x00, 0x00, 0x02, 0xD7, 0x01,
+    0x00, 0x03, 0xD3, 0x02, 0x01, 0x00, 0x69, 0xB6, 0x92, 0x00, 0x00, 0x03, 0xCE, 0x02, 0x00, 0x02,
+    0xB5, 0x02, 0x00, 0x03, 0xB2, 0x02, 0x01, 0x00, 0x73, 0x62, 0x8F, 0x00, 0x00, 0x03, 0xC5, 0x02,
+    0x01, 0x00, 0x73, 0xAA, 0x86, 0x00, 0x00, 0x02, 0xC3, 0x02, 0x01, 0x00, 0x6D, 0xFE, 0x88, 0x00,
+    0x01, 0x00, 0x6E, 0xC4, 0x87, 0x00, 0x01, 0x00, 0x6F, 0xBC, 0x92, 0x00, 0x00, 0x01, 0x3F, 0x01,
+    0x00, 0x01, 0xD0, 0x00, 0x00, 0x02, 0xBF, 0x02, 0x00, 0x02, 0xBD, 0x02, 0x01, 0x00, 0x74, 0xC0,
+    0x92, 0x00, 0x00, 0x01, 0x74, 0x01, 0x00, 0x02, 0xB9, 0x02, 0x00, 0x02, 0xB7, 0x02, 0x00, 0x01,
+    0x56, 0x00, 0x01, 0x00, 0x62, 0xC6, 0x92, 0x00, 0x00, 0x01, 0x38, 0x00, 0x01, 0x00, 0x65, 0xAC,
+    0x7B, 0x00, 0x01, 0x01, 0x05, 0x00, 0x72, 0xFC, 0x39, 0x00, 0x00, 0x02, 0xA8, 0x02, 0x01, 0x00,
+    0x6F, 0xE4, 0x58, 0x00, 0x01, 0x00, 0x73, 0xCA, 0x92, 0x00, 0x01, 0x00, 0x72, 0xE8, 0x85, 0x00,
+    0x01, 0x00, 0x2E, 0x1E, 0x6C, 0x00, 0x01, 0x00, 0x65, 0x38, 0x90, 0x00, 0x00, 0x02, 0x9C, 0x02,
+    0x00, 0x02, 0x8C, 0x02, 0x01, 0x00, 0x69, 0xDC, 0x7B, 0x00, 0x00, 0x03, 0x81, 0x02, 0x00, 0x02,
+    0x7F, 0x02, 0x01, 0x00, 0x63, 0xCE, 0x92, 0x00, 0x01, 0x00, 0x65, 0xD2, 0x92, 0x00, 0x00, 0x02,
+    0x75, 0x02, 0x01, 0x00, 0x61, 0x70, 0x71, 0x00, 0x01, 0x00, 0x74, 0xD6, 0x92, 0x00, 0x01, 0x00,
+    0x79, 0xDC, 0x92, 0x00, 0x00, 0x02, 0x69, 0x02, 0x01, 0x00, 0x67, 0xE0, 0x92, 0x00, 0x00, 0x02,
+    0x64, 0x02, 0x00, 0x03, 0x61, 0x02, 0x01, 0x00, 0x67, 0x02, 0x33, 0x00, 0x01, 0x00, 0x65, 0xA0,
+    0x6F, 0x00, 0x01, 0x00, 0x69, 0xA2, 0x37, 0x00, 0x01, 0x00, 0x68, 0xE4, 0x92, 0x00, 0x00, 0x03,
+    0xD4, 0x00, 0x00, 0x02, 0x51, 0x02, 0x01, 0x00, 0x6E, 0xE8, 0x92, 0x00, 0x00, 0x03, 0x4B, 0x02,
+    0x01, 0x00, 0x70, 0xC6, 0x34, 0x00, 0x00, 0x05, 0x36, 0x02, 0x01, 0x00, 0x72, 0xEE, 0x92, 0x00,
+    0x00, 0x03, 0x2E, 0x02, 0x00, 0x04, 0x26, 0x02, 0x00, 0x02, 0x24, 0x02, 0x01, 0x00, 0x61, 0x22,
+    0x6D, 0x00, 0x01, 0x00, 0x72, 0xFE, 0x88, 0x00, 0x00, 0x02, 0x20, 0x02, 0x00, 0x02, 0x0F, 0x02,
+    0x01, 0x00, 0x79, 0x82, 0x6A, 0x00, 0x01, 0x00, 0x63, 0xF6, 0x92, 0x00, 0x01, 0x00, 0x61, 0x74,
+    0x0A, 0x00, 0x01, 0x00, 0x61, 0xFA, 0x92, 0x00, 0x00, 0x02, 0x0D, 0x02, 0x01, 0x00, 0x63, 0x00,
+    0x93, 0x00, 0x01, 0x00, 0x73, 0x7C, 0x86, 0x00, 0x00, 0x03, 0x01, 0x02, 0x01, 0x00, 0x2E, 0x78,
+    0x8F, 0x00, 0x00, 0x03, 0xF9, 0x01, 0x01, 0x00, 0x72, 0x04, 0x93, 0x00, 0x01, 0x00, 0x6C, 0x82,
+    0x8E, 0x00, 0x01, 0x00, 0x2E, 0xDA, 0x6B, 0x00, 0x00, 0x03, 0xF1, 0x01, 0x02, 0x00, 0x69, 0x79,
+    0x0E, 0x6F, 0x00, 0x3A, 0x2E, 0x00, 0x01, 0x00, 0x2E, 0x0A, 0x93, 0x00, 0x00, 0x02, 0xED, 0x01,
+    0x00, 0x03, 0x35, 0x01, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x03, 0xE4, 0x01, 0x00, 0x02, 0x16, 0x01,
+    0x01, 0x00, 0x6E, 0x84, 0x81, 0x00, 0x00, 0x02, 0xE0, 0x01, 0x00, 0x02, 0xDE, 0x01, 0x01, 0x00,
+    0x69, 0x0C, 0x8F, 0x00, 0x00, 0x02, 0xD2, 0x01, 0x02, 0x00, 0x72, 0x73, 0x0E, 0x93, 0x00, 0x12,
+    0x93, 0x00, 0x01, 0x03, 0xCD, 0x01, 0x69, 0x0E, 0x6F, 0x00, 0x00, 0x02, 0xC7, 0x01, 0x01, 0x00,
+    0x73, 0x18, 0x93, 0x00, 0x00, 0x02, 0xC3, 0x01, 0x00, 0x02, 0xBF, 0x01, 0x00, 0x02, 0xBD, 0x01,
+    0x01, 0x00, 0x2E, 0x40, 0x5E, 0x00, 0x00, 0x03, 0xBA, 0x01, 0x01, 0x00, 0x76, 0x32, 0x3B, 0x00,
+    0x01, 0x00, 0x65, 0x72, 0x90, 0x00, 0x01, 0x00, 0x73, 0x1C, 0x93, 0x00, 0x01, 0x00, 0x73, 0x3A,
+    0x2E, 0x00, 0x00, 0x03, 0xA0, 0x01, 0x01, 0x00, 0x2E, 0x20, 0x93, 0x00, 0x01, 0x00, 0x72, 0xEE,
+    0x73, 0x00, 0x01, 0x00, 0x6F, 0x24, 0x93, 0x00, 0x00, 0x03, 0x86, 0x01, 0x00, 0x02, 0x84, 0x01,
+    0x00, 0x04, 0x80, 0x01, 0x01, 0x00, 0x69, 0x28, 0x93, 0x00, 0x01, 0x00, 0x6C, 0x22, 0x33, 0x00,
+    0x01, 0x00, 0x72, 0x2E, 0x93, 0x00, 0x01, 0x00, 0x72, 0xEE, 0x8E, 0x00, 0x00, 0x03, 0x78, 0x01,
+    0x00, 0x03, 0x75, 0x01, 0x00, 0x02, 0x0B, 0x01, 0x01, 0x00, 0x61, 0x32, 0x93, 0x00, 0x01, 0x00,
+    0x74, 0x1C, 0x77, 0x00, 0x01, 0x00, 0x65, 0x36, 0x93, 0x00, 0x01, 0x00, 0x6F, 0x3C, 0x93, 0x00,
+    0x00, 0x02, 0x54, 0x01, 0x01, 0x00, 0x73, 0x58, 0x2F, 0x00, 0x01, 0x00, 0x79, 0x42, 0x93, 0x00,
+    0x02, 0x00, 0x64, 0x66, 0x48, 0x93, 0x00, 0x48, 0x93, 0x00, 0x00, 0x02, 0x46, 0x01, 0x00, 0x02,
+    0x42, 0x01, 0x01, 0x00, 0x65, 0x4C, 0x93, 0x00, 0x01, 0x00, 0x73, 0x50, 0x93, 0x00, 0x01, 0x00,
+    0x63, 0x74, 0x0A, 0x00, 0x01, 0x00, 0x69, 0x56, 0x93, 0x00, 0x00, 0x02, 0x2F, 0x01, 0x01, 0x00,
+    0x67, 0x5C, 0x93, 0x00, 0x01, 0x00, 0x75, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x65, 0x60, 0x93, 0x00,
+    0x00, 0x02, 0x18, 0x01, 0x01, 0x00, 0x69, 0xBC, 0x90, 0x00, 0x01, 0x00, 0x6C, 0x64, 0x93, 0x00,
+    0x01, 0x00, 0x69, 0x68, 0x93, 0x00, 0x00, 0x02, 0x05, 0x01, 0x01, 0x00, 0x72, 0x6E, 0x93, 0x00,
+    0x00, 0x02, 0xFB, 0x00, 0x01, 0x00, 0x63, 0x74, 0x93, 0x00, 0x01, 0x00, 0x69, 0x78, 0x93, 0x00,
+    0x00, 0x04, 0xE6, 0x00, 0x01, 0x00, 0x77, 0x02, 0x8F, 0x00, 0x02, 0x00, 0x63, 0x77, 0x7E, 0x93,
+    0x00, 0x7E, 0x93, 0x00, 0x00, 0x04, 0xD9, 0x00, 0x01, 0x00, 0x62, 0x82, 0x93, 0x00, 0x01, 0x00,
+    0x68, 0x86, 0x93, 0x00, 0x00, 0x02, 0xC7, 0x00, 0x01, 0x00, 0x67, 0x8C, 0x93, 0x00, 0x00, 0x03,
+    0xC2, 0x00, 0x00, 0x03, 0xBB, 0x00, 0x02, 0x00, 0x73, 0x7A, 0x90, 0x93, 0x00, 0x3A, 0x2E, 0x00,
+    0x00, 0x02, 0xAE, 0x00, 0x00, 0x02, 0xA2, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x01, 0x00, 0x69, 0x96,
+    0x93, 0x00, 0x00, 0x02, 0x84, 0x00, 0x01, 0x00, 0x72, 0x9A, 0x93, 0x00, 0x01, 0x00, 0x73, 0x9E,
+    0x93, 0x00, 0x00, 0x02, 0x8B, 0x00, 0x01, 0x00, 0x65, 0xA6, 0x93, 0x00, 0x01, 0x00, 0x6D, 0xAA,
+    0x93, 0x00, 0x02, 0x00, 0x65, 0x69, 0xAE, 0x93, 0x00, 0xB4, 0x93, 0x00, 0x01, 0x00, 0x74, 0xBE,
+    0x93, 0x00, 0x02, 0x00, 0x69, 0x75, 0x72, 0x35, 0x00, 0x10, 0x46, 0x00, 0x01, 0x00, 0x69, 0x44,
+    0x5E, 0x00, 0x00, 0x02, 0x54, 0x00, 0x01, 0x00, 0x72, 0xC2, 0x93, 0x00, 0x00, 0x03, 0x48, 0x00,
+    0x01, 0x00, 0x61, 0xC6, 0x93, 0x00, 0x01, 0x00, 0x6F, 0xA4, 0x6C, 0x00, 0x01, 0x00, 0x79, 0xCA,
+    0x93, 0x00, 0x00, 0x01, 0xD6, 0x02, 0x01, 0x00, 0x62, 0xCE, 0x93, 0x00, 0x00, 0x02, 0xC1, 0x02,
+    0x01, 0x00, 0x72, 0xCA, 0x93, 0x00, 0x00, 0x03, 0xAF, 0x02, 0x00, 0x03, 0xA2, 0x02, 0x00, 0x03,
+    0x7C, 0x02, 0x00, 0x03, 0x79, 0x02, 0x01, 0x00, 0x69, 0x48, 0x90, 0x00, 0x00, 0x02, 0x64, 0x01,
+    0x00, 0x03, 0x66, 0x02, 0x00, 0x05, 0x56, 0x02, 0x01, 0x00, 0x65, 0xD2, 0x93, 0x00, 0x01, 0x01,
+    0x1D, 0x00, 0x2E, 0xE8, 0x85, 0x00, 0x00, 0x02, 0x17, 0x02, 0x01, 0x00, 0x72, 0x62, 0x92, 0x00,
+    0x00, 0x02, 0x09, 0x02, 0x01, 0x00, 0x65, 0xD6, 0x93, 0x00, 0x00, 0x02, 0xEF, 0x01, 0x00, 0x03,
+    0xD4, 0x01, 0x01, 0x00, 0x74, 0x0E, 0x93, 0x00, 0x00, 0x02, 0xC5, 0x01, 0x00, 0x03, 0xA9, 0x01,
+    0x00, 0x02, 0x9E, 0x01, 0x00, 0x03, 0x89, 0x01, 0x01, 0x00, 0x74, 0xDA, 0x93, 0x00, 0x00, 0x02,
+    0x7B, 0x01, 0x00, 0x02, 0x72, 0x01, 0x01, 0x00, 0x6C, 0xDE, 0x93, 0x00, 0x01, 0x00, 0x6E, 0xE2,
+    0x93, 0x00, 0x01, 0x00, 0x2E, 0xE8, 0x93, 0x00, 0x00, 0x04, 0x4A, 0x01, 0x00, 0x02, 0x40, 0x01,
+    0x01, 0x00, 0x73, 0xEC, 0x93, 0x00, 0x01, 0x00, 0x7A, 0xF0, 0x93, 0x00, 0x00, 0x02, 0x2D, 0x01,
+    0x00, 0x02, 0x1C, 0x01, 0x00, 0x03, 0x0F, 0x01, 0x01, 0x00, 0x6E, 0xF4, 0x93, 0x00, 0x01, 0x00,
+    0x2E, 0xCA, 0x86, 0x00, 0x00, 0x03, 0xF6, 0x00, 0x01, 0x00, 0x61, 0xFA, 0x93, 0x00, 0x00, 0x01,
+    0xDF, 0x00, 0x00, 0x03, 0xD1, 0x00, 0x01, 0x00, 0x69, 0xFE, 0x93, 0x00, 0x00, 0x02, 0xC5, 0x00,
+    0x01, 0x00, 0x6D, 0x02, 0x94, 0x00, 0x00, 0x03, 0x9D, 0x00, 0x00, 0x02, 0x87, 0x00, 0x01, 0x01,
+    0x3E, 0x00, 0x61, 0x06, 0x94, 0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x03, 0x7B, 0x00, 0x01, 0x00,
+    0x73, 0x0C, 0x94, 0x00, 0x02, 0x00, 0x73, 0x74, 0x0C, 0x94, 0x00, 0x10, 0x94, 0x00, 0x00, 0x02,
+    0x79, 0x00, 0x00, 0x03, 0x4B, 0x00, 0x00, 0x03, 0x42, 0x00, 0x00, 0x02, 0x2A, 0x00, 0x00, 0x02,
+    0xD1, 0x02, 0x00, 0x03, 0x4E, 0x02, 0x00, 0x03, 0xFE, 0x01, 0x00, 0x03, 0x7D, 0x01, 0x00, 0x03,
+    0x69, 0x01, 0x01, 0x00, 0x6F, 0x14, 0x94, 0x00, 0x00, 0x02, 0x4E, 0x01, 0x00, 0x02, 0x3A, 0x01,
+    0x00, 0x04, 0x31, 0x01, 0x01, 0x00, 0x67, 0x18, 0x94, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03,
+    0xCB, 0x00, 0x00, 0x03, 0xB4, 0x00, 0x01, 0x00, 0x62, 0x1C, 0x94, 0x00, 0x00, 0x03, 0x81, 0x00,
+    0x00, 0x03, 0x7E, 0x00, 0x00, 0x02, 0x58, 0x01, 0x00, 0x02, 0x09, 0x01, 0x00, 0x02, 0x89, 0x00,
+};
+
+constexpr uint8_t en_trie_levels[] = {
+    0x04, 0x11, 0x22, 0x12, 0x23, 0x14, 0x34, 0x01, 0x13, 0x21, 0x25, 0x24, 0x04, 0x05, 0x02, 0x11,
+    0x13, 0x02, 0x11, 0x23, 0x21, 0x32, 0x15, 0x22, 0x44, 0x03, 0x13, 0x22, 0x35, 0x15, 0x22, 0x45,
+    0x11, 0x24, 0x14, 0x25, 0x43, 0x25, 0x35, 0x55, 0x04, 0x13, 0x35, 0x61, 0x15, 0x43, 0x12, 0x03,
+    0x34, 0x53, 0x11, 0x22, 0x33, 0x65, 0x15, 0x24, 0x46, 0x54, 0x01, 0x22, 0x24, 0x31, 0x31, 0x41,
+    0x41, 0x54, 0x53, 0x66, 0x72, 0x04, 0x24, 0x51, 0x11, 0x45, 0x61, 0x21, 0x53, 0x63, 0x13, 0x34,
+    0x13, 0x23, 0x14, 0x22, 0x11, 0x31, 0x26, 0x02, 0x11, 0x24, 0x14, 0x21, 0x05, 0x15, 0x12, 0x21,
+    0x23, 0x34, 0x14, 0x23, 0x04, 0x23, 0x24, 0x44, 0x02, 0x22, 0x15, 0x33, 0x22, 0x35, 0x04, 0x11,
+    0x02, 0x13, 0x05, 0x23, 0x04, 0x34, 0x04, 0x13, 0x22, 0x51, 0x71, 0x03, 0x31, 0x51, 0x11, 0x31,
+    0x63, 0x03, 0x41, 0x55, 0x31, 0x42, 0x61, 0x43, 0x71, 0x73, 0x83, 0x45, 0x65, 0x42, 0x02, 0x11,
+    0x22, 0x11, 0x32, 0x22, 0x33, 0x41, 0x14, 0x31, 0x02, 0x13, 0x24, 0x34, 0x41, 0x21, 0x35, 0x61,
+    0x13, 0x42, 0x03, 0x31, 0x05, 0x33, 0x22, 0x42, 0x41, 0x56, 0x33, 0x41, 0x05, 0x32, 0x16, 0x36,
+    0x11, 0x21, 0x41, 0x55, 0x05, 0x31, 0x41, 0x01, 0x43, 0x52, 0x56, 0x22, 0x51, 0x66, 0x22, 0x33,
+    0x24, 0x33, 0x31, 0x54, 0x61, 0x51, 0x61, 0x01, 0x41, 0x14, 0x34, 0x12, 0x21, 0x55, 0x01, 0x12,
+    0x64, 0x15, 0x55, 0x63, 0x12, 0x23, 0x34, 0x12, 0x25, 0x12, 0x21, 0x33, 0x61, 0x13, 0x43, 0x63,
+    0x32, 0x41, 0x02, 0x15, 0x03, 0x12, 0x03, 0x12, 0x31, 0x41, 0x03, 0x14, 0x33, 0x42, 0x45, 0x54,
+    0x03, 0x51, 0x05, 0x25, 0x33, 0x43, 0x21, 0x46, 0x55, 0x31, 0x41, 0x23, 0x51, 0x04, 0x14, 0x24,
+    0x34, 0x04, 0x15, 0x34, 0x51, 0x01, 0x32, 0x05, 0x44, 0x51, 0x91, 0x36, 0x41, 0x44, 0x55, 0x05,
+    0x23, 0x55, 0x04, 0x22, 0x35, 0x42, 0x31, 0x61, 0x13, 0x45, 0x25, 0x34, 0x25, 0x71, 0x25, 0x32,
+    0x21, 0x51, 0x11, 0x44, 0x15, 0x35, 0x06, 0x23, 0x43, 0x11, 0x34, 0x02, 0x12, 0x35, 0x46, 0x13,
+    0x41, 0x03, 0x24, 0x35, 0x41, 0x03, 0x31, 0x41, 0x33, 0x44, 0x45, 0x75, 0x26, 0x33, 0x53, 0x66,
+    0x52, 0x61, 0x25, 0x55, 0x15, 0x53, 0x33, 0x64, 0x03, 0x42, 0x43, 0x56, 0x63, 0x72, 0x43, 0x53,
+    0x44, 0x53, 0x05, 0x34, 0x01, 0x53, 0x01, 0x14, 0x23, 0x61, 0x05, 0x24, 0x23, 0x45, 0x01, 0x12,
+    0x22, 0x02, 0x13, 0x22, 0x03, 0x21, 0x22, 0x31, 0x43, 0x35, 0x61, 0x73, 0x32, 0x43, 0x03, 0x24,
+    0x14, 0x24, 0x56, 0x74, 0x36, 0x16, 0x23, 0x34, 0x33, 0x41, 0x51, 0x15, 0x51, 0x24, 0x53, 0x74,
+    0x13, 0x32, 0x41, 0x53, 0x13, 0x66, 0x11, 0x33, 0x44, 0x33, 0x61, 0x71, 0x01, 0x11, 0x12, 0x25,
+    0x35, 0x52, 0x12, 0x34, 0x42, 0x51, 0x23, 0x33, 0x15, 0x25, 0x03, 0x23, 0x33, 0x53, 0x05, 0x31,
+    0x05, 0x35, 0x45, 0x31, 0x44, 0x35, 0x41, 0x31, 0x46, 0x05, 0x33, 0x51, 0x04, 0x15, 0x24, 0x04,
+    0x11, 0x24, 0x34, 0x44, 0x36, 0x43, 0x02, 0x21, 0x14, 0x35, 0x13, 0x32, 0x51, 0x32, 0x55, 0x15,
+    0x62, 0x11, 0x33, 0x44, 0x62, 0x46, 0x55, 0x24, 0x41, 0x31, 0x45, 0x22, 0x31, 0x05, 0x31, 0x51,
+    0x13, 0x31, 0x26, 0x33, 0x21, 0x32, 0x51, 0x35, 0x55, 0x03, 0x23, 0x45, 0x31, 0x43, 0x23, 0x63,
+    0x56, 0x61, 0x34, 0x45, 0x05, 0x41, 0x61, 0x21, 0x41, 0x02, 0x34, 0x15, 0x44, 0x01, 0x43, 0x01,
+    0x35, 0x21, 0x51, 0x61, 0x12, 0x44, 0x04, 0x14, 0x24, 0x01, 0x33, 0x56, 0x01, 0x21, 0x23, 0x36,
+    0x52, 0x13, 0x56, 0x61, 0x35, 0x51, 0x24, 0x33, 0x45, 0x01, 0x25, 0x05, 0x12, 0x01, 0x26, 0x51,
+    0x62, 0x04, 0x12, 0x04, 0x35, 0x04, 0x21, 0x46, 0x53, 0x05, 0x15, 0x22, 0x14, 0x44, 0x02, 0x24,
+    0x23, 0x53, 0x35, 0x44, 0x26, 0x31, 0x13, 0x25, 0x51, 0x64, 0x14, 0x32, 0x25, 0x45, 0x22, 0x33,
+    0x55, 0x02, 0x15, 0x23, 0x05, 0x35, 0x02, 0x11, 0x24, 0x33, 0x41, 0x04, 0x13, 0x23, 0x03, 0x14,
+    0x24, 0x05, 0x14, 0x01, 0x24, 0x23, 0x31, 0x12, 0x35, 0x32, 0x45, 0x05, 0x22, 0x61, 0x31, 0x46,
+    0x51, 0x13, 0x56, 0x14, 0x23, 0x43, 0x01, 0x16, 0x23, 0x33, 0x71, 0x21, 0x42, 0x15, 0x45, 0x22,
+    0x34, 0x21, 0x41, 0x51, 0x43, 0x55, 0x11, 0x33, 0x75, 0x03, 0x25, 0x02, 0x11, 0x32, 0x14, 0x33,
+    0x01, 0x14, 0x23, 0x35, 0x45, 0x25, 0x61, 0x22, 0x32, 0x01, 0x22, 0x31, 0x12, 0x43, 0x66, 0x41,
+    0x51, 0x26, 0x41, 0x53, 0x01, 0x14, 0x24, 0x03, 0x32, 0x31, 0x41, 0x52, 0x36, 0x42, 0x02, 0x15,
+    0x22, 0x22, 0x31, 0x41, 0x31, 0x55, 0x12, 0x22, 0x42, 0x52, 0x03, 0x35, 0x11, 0x23, 0x04, 0x25,
+    0x24, 0x32, 0x33, 0x51, 0x61, 0x05, 0x15, 0x34, 0x23, 0x55, 0x25, 0x44, 0x23, 0x41, 0x52, 0x21,
+    0x43, 0x65, 0x36, 0x41, 0x61, 0x42, 0x53, 0x35, 0x65, 0x33, 0x55, 0x45, 0x55, 0x46, 0x61, 0x46,
+    0x64, 0x45, 0x61, 0x41, 0x52, 0x45, 0x52, 0x61, 0x33, 0x46, 0x33, 0x51, 0x43, 0x54, 0x34, 0x41,
+    0x61, 0x55, 0x75, 0x41, 0x56, 0x61, 0x75,
+};
+
+constexpr DenseHyphenationTrie en_dense_trie = {
+    en_trie_classes, 28u, en_trie_dense, en_trie_nodes, sizeof(en_trie_nodes),
+    en_trie_levels, sizeof(en_trie_levels),
 };
 
 constexpr SerializedHyphenationPatterns en_patterns = {
-    0x68EDu,
-    en_trie_data,
-    sizeof(en_trie_data),
+    0u,
+    nullptr,
+    0,
+    &en_dense_trie,
 };
@@ -6,864 +6,1527 @@
 #include "../SerializedHyphenationTrie.h"
 
 // Auto-generated by generate_hyphenation_trie.py. Do not edit manually.
-alignas(4) constexpr uint8_t es_trie_data[] = {
-    0x01, 0x04, 0x16, 0x02, 0x0E, 0x0C, 0x02, 0x16, 0x02, 0x0D, 0x0C, 0x22, 0x0F, 0x2C, 0x0F, 0x22,
-    0x0D, 0x2C, 0x0D, 0x0B, 0x16, 0x0B, 0x20, 0x15, 0x16, 0x15, 0x0C, 0x02, 0x0C, 0x17, 0x0E, 0x04,
-    0x2C, 0x05, 0x04, 0x0D, 0x04, 0x21, 0x04, 0x18, 0x0D, 0x04, 0x17, 0x04, 0x0D, 0x17, 0x04, 0x0E,
-    0x0D, 0x04, 0x0D, 0x21, 0x04, 0x0D, 0x21, 0x21, 0x0F, 0x0E, 0x0F, 0x0E, 0x0D, 0x0F, 0x0E, 0x17,
-    0x33, 0x33, 0x0C, 0x33, 0x16, 0x29, 0x29, 0x0C, 0x29, 0x16, 0x21, 0x0C, 0x21, 0x0E, 0x34, 0x0D,
-    0x3E, 0x36, 0x0D, 0x3F, 0x2B, 0x16, 0x0D, 0x3D, 0x3D, 0x0C, 0x3D, 0x16, 0x1F, 0x1F, 0x16, 0x2A,
-    0x2C, 0x0D, 0x0E, 0x0E, 0x21, 0x1F, 0x0C, 0x2A, 0x0D, 0x2A, 0x0B, 0x2A, 0x0B, 0x0C, 0x2A, 0x0B,
-    0x16, 0x37, 0x20, 0x0C, 0x20, 0x16, 0x35, 0x24, 0x47, 0x47, 0x0C, 0x47, 0x16, 0x20, 0x0B, 0x20,
-    0x0D, 0x0C, 0x20, 0x0D, 0x16, 0x20, 0x20, 0x03, 0x17, 0x0E, 0x0D, 0x23, 0x0E, 0x17, 0x17, 0x17,
-    0x21, 0x16, 0x0D, 0x18, 0x48, 0x49, 0x16, 0x0C, 0x0C, 0x16, 0x0C, 0x16, 0x2D, 0x2B, 0x0E, 0x0D,
-    0x2B, 0x0E, 0x17, 0x17, 0x2B, 0x34, 0x0B, 0x34, 0x0B, 0x0C, 0x34, 0x0B, 0x16, 0x21, 0x20, 0x0D,
-    0x21, 0x0E, 0x17, 0x20, 0x0D, 0x04, 0x0F, 0x19, 0x0C, 0x0D, 0x2E, 0x0F, 0x0E, 0x21, 0x17, 0x0E,
-    0x2D, 0x0E, 0x2B, 0x0E, 0x22, 0x17, 0x17, 0x0E, 0x22, 0x0D, 0x0E, 0x38, 0x19, 0x18, 0x03, 0x0C,
-    0x22, 0x0B, 0x0E, 0x22, 0x0B, 0x18, 0x40, 0x2A, 0x0C, 0x0C, 0x2A, 0x0C, 0x16, 0x18, 0x0D, 0x0C,
-    0x18, 0x0D, 0x0E, 0x2B, 0x21, 0x2B, 0x17, 0x2A, 0x16, 0x02, 0x33, 0x02, 0x33, 0x0C, 0x02, 0x33,
-    0x16, 0x35, 0x0E, 0x04, 0x0C, 0x20, 0x0C, 0x0C, 0x20, 0x0C, 0x16, 0x2B, 0x0E, 0x0E, 0x2B, 0x0E,
-    0x18, 0x04, 0x0D, 0x0E, 0x0D, 0x19, 0x0E, 0x41, 0x10, 0x2A, 0x20, 0x04, 0x0C, 0x0D, 0x03, 0x0E,
-    0x16, 0x0D, 0x0E, 0x18, 0x0F, 0x05, 0x0E, 0x07, 0x0E, 0xA0, 0x00, 0x51, 0xA0, 0x00, 0x71, 0xA0,
-    0x00, 0xC3, 0xA3, 0x00, 0x71, 0x74, 0x6E, 0x7A, 0xFD, 0xFD, 0xFD, 0xA1, 0x00, 0x71, 0x74, 0xF4,
-    0xA1, 0x00, 0x71, 0x6E, 0xEF, 0xA3, 0x00, 0x71, 0x74, 0x73, 0x6E, 0xEA, 0xEA, 0xEA, 0xA2, 0x00,
-    0x71, 0x7A, 0x73, 0xE1, 0xE1, 0xA0, 0x00, 0xA2, 0xB6, 0x00, 0x91, 0x2E, 0x62, 0x63, 0x64, 0x66,
-    0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79,
-    0x7A, 0xD1, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xA0, 0x01, 0xD2, 0x21, 0xAD, 0xFD, 0x21, 0xC3, 0xFD,
-    0x21, 0x6E, 0xFD, 0xA0, 0x05, 0xB1, 0xA0, 0x05, 0xC2, 0xA0, 0x05, 0xE2, 0x25, 0xA1, 0xA9, 0xAD,
-    0xB3, 0xBA, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x27, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xEC,
-    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF5, 0x21, 0x6F, 0xF1, 0x21, 0x69, 0xFD, 0x21, 0x6C, 0xFD, 0xA0,
-    0x05, 0x81, 0xA0, 0x06, 0x72, 0x21, 0x2E, 0xFD, 0x21, 0x73, 0xFD, 0xA2, 0x05, 0x81, 0x6F, 0x61,
-    0xFA, 0xFD, 0xAE, 0x06, 0x31, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6C, 0x6D, 0x70, 0x71, 0x73,
-    0x74, 0x76, 0x7A, 0xED, 0xED, 0xF9, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED,
-    0xED, 0x21, 0x6E, 0xE1, 0xA0, 0x06, 0x01, 0xA0, 0x06, 0x92, 0xA0, 0x06, 0x12, 0x25, 0xA1, 0xA9,
-    0xAD, 0xB3, 0xBA, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xA0, 0x02, 0x51, 0x21, 0x61, 0xFD, 0x21, 0xAD,
-    0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x67, 0xFD, 0x21, 0x6F, 0xFD, 0x28, 0x68, 0x61, 0x65, 0x69, 0x6F,
-    0x75, 0xC3, 0x6C, 0xDA, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xE3, 0xFD, 0x44, 0x75, 0x62, 0x65, 0x6F,
-    0xFF, 0x65, 0xFF, 0x91, 0xFF, 0xC6, 0xFF, 0xEF, 0xA0, 0x04, 0x41, 0xA0, 0x04, 0x52, 0xA0, 0x04,
-    0x72, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x27, 0x68, 0x61, 0x65,
-    0x69, 0x6F, 0x75, 0xC3, 0xEC, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF5, 0x21, 0x61, 0xF1, 0x21, 0x63,
-    0xFD, 0x21, 0x73, 0xFD, 0xD8, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B,
-    0x6D, 0x6E, 0x70, 0x71, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x6C, 0x72, 0x69, 0x75, 0xFE,
-    0xC5, 0xFE, 0xC8, 0xFE, 0xCE, 0xFE, 0xC8, 0xFE, 0xD7, 0xFE, 0xDC, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE,
-    0xC8, 0xFE, 0xDC, 0xFE, 0xC8, 0xFE, 0xE1, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xEA, 0xFE, 0xC8, 0xFE,
-    0xC8, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xF4, 0xFE, 0xF4, 0xFF, 0xC7, 0xFF, 0xFD, 0x41,
-    0x6C, 0xFF, 0x45, 0x21, 0x61, 0xFC, 0x21, 0x75, 0xFD, 0x41, 0x72, 0xFF, 0x3B, 0x22, 0x6E, 0x75,
-    0xF9, 0xFC, 0x41, 0x78, 0xFF, 0x32, 0x41, 0x78, 0xFF, 0x34, 0x21, 0xB3, 0xFC, 0x41, 0x6E, 0xFF,
-    0x27, 0xA0, 0x01, 0x52, 0x21, 0x64, 0xFD, 0xA0, 0x06, 0x43, 0x21, 0x61, 0xFD, 0x21, 0x65, 0xFA,
-    0x23, 0x6E, 0x70, 0x76, 0xF4, 0xFA, 0xFD, 0x21, 0x74, 0xEA, 0x21, 0x73, 0xFD, 0x21, 0x6E, 0xFA,
-    0x21, 0x69, 0xED, 0x21, 0x6C, 0xFD, 0x24, 0x61, 0x65, 0x69, 0x6F, 0xEA, 0xF4, 0xF7, 0xFD, 0x21,
-    0x6E, 0xF7, 0x25, 0x61, 0x6F, 0xC3, 0x75, 0x65, 0xBB, 0xC0, 0xC8, 0xCB, 0xFD, 0xA1, 0x00, 0x61,
-    0x69, 0xF5, 0xA0, 0x07, 0xB1, 0x21, 0x62, 0xFD, 0xA0, 0x00, 0xF1, 0x21, 0x68, 0xFD, 0x22, 0x69,
-    0x6F, 0xFA, 0xFA, 0x21, 0x74, 0xF5, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x24, 0x63, 0x73, 0x72,
-    0x74, 0xEF, 0xF2, 0xFD, 0xEC, 0xA2, 0x06, 0x01, 0x69, 0x65, 0xE0, 0xF7, 0xA0, 0x02, 0x91, 0x21,
-    0x72, 0xFD, 0x21, 0x65, 0xFA, 0x21, 0x65, 0xFD, 0x22, 0x65, 0x72, 0xF7, 0xFD, 0x21, 0x6E, 0xEF,
-    0x41, 0x6C, 0xFE, 0x6F, 0x22, 0x65, 0x75, 0xF9, 0xFC, 0x21, 0x74, 0xE3, 0x21, 0x73, 0xFD, 0x21,
-    0xB3, 0xFD, 0x21, 0xC3, 0xFD, 0x41, 0x63, 0xFE, 0x5A, 0x21, 0x73, 0xFC, 0x22, 0x65, 0x69, 0xFD,
-    0xF9, 0x21, 0x64, 0xCB, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x61, 0xD3,
-    0x21, 0x69, 0xFD, 0x21, 0x6F, 0xB9, 0x21, 0x74, 0xFD, 0xA7, 0x07, 0x62, 0x63, 0x67, 0x70, 0x6C,
-    0x72, 0x78, 0x75, 0xBF, 0xCB, 0xD9, 0xE3, 0xF1, 0xF7, 0xFD, 0x42, 0x63, 0x74, 0xFF, 0xA2, 0xFF,
-    0xA2, 0x41, 0x63, 0xFF, 0x9B, 0x22, 0x69, 0x75, 0xF5, 0xFC, 0x41, 0x69, 0xFF, 0x92, 0x21, 0x63,
-    0xFC, 0x21, 0x69, 0xFD, 0x41, 0xA1, 0xFE, 0x0B, 0x21, 0xC3, 0xFC, 0x41, 0x73, 0xFF, 0x81, 0x21,
-    0x69, 0xFC, 0xA4, 0x07, 0x62, 0x64, 0x66, 0x74, 0x78, 0xE3, 0xEF, 0xF6, 0xFD, 0x41, 0x75, 0xFF,
-    0x8C, 0x21, 0x70, 0xFC, 0x41, 0x6F, 0xFD, 0xEB, 0xA2, 0x07, 0x62, 0x6D, 0x74, 0xF9, 0xFC, 0xA0,
-    0x00, 0xF2, 0x21, 0x69, 0xFD, 0xA0, 0x01, 0x32, 0x21, 0x72, 0xFD, 0x21, 0xA9, 0xFD, 0x43, 0x65,
-    0xC3, 0x74, 0xFF, 0xFA, 0xFF, 0xFD, 0xFF, 0x2A, 0x41, 0x6E, 0xFF, 0x20, 0x21, 0xAD, 0xFC, 0x23,
-    0x65, 0x69, 0xC3, 0xF9, 0xF9, 0xFD, 0x21, 0x64, 0xF9, 0xA3, 0x05, 0x02, 0x6B, 0x70, 0x72, 0xD9,
-    0xE5, 0xFD, 0xA0, 0x07, 0x62, 0xA0, 0x07, 0xA1, 0x21, 0x6C, 0xFD, 0x21, 0x75, 0xFD, 0xA1, 0x07,
-    0x82, 0x67, 0xFD, 0xA0, 0x07, 0x82, 0xC1, 0x07, 0x82, 0x70, 0xFE, 0xFD, 0x25, 0xA1, 0xA9, 0xAD,
-    0xB3, 0xBA, 0xF2, 0xF7, 0xF7, 0xFA, 0xF7, 0xA0, 0x01, 0xA1, 0x21, 0x62, 0xFD, 0x21, 0x72, 0xFD,
-    0x21, 0x75, 0xFD, 0x48, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0x6E, 0xFE, 0xF2, 0xFF, 0x46,
-    0xFF, 0x7F, 0xFF, 0x95, 0xFF, 0xC6, 0xFF, 0xCF, 0xFF, 0xE9, 0xFF, 0xFD, 0xA0, 0x0A, 0x01, 0x21,
-    0x74, 0xFD, 0x21, 0x75, 0xFD, 0xA2, 0x00, 0x61, 0x6F, 0x61, 0xDE, 0xFD, 0xA0, 0x08, 0x12, 0xA0,
-    0x08, 0x33, 0xC2, 0x07, 0x82, 0x6D, 0x6E, 0xFD, 0x4D, 0xFD, 0x4D, 0xA0, 0x0B, 0x45, 0x23, 0xA1,
-    0xA9, 0xB3, 0xFD, 0xFD, 0xFD, 0x24, 0x61, 0x65, 0x6F, 0xC3, 0xF6, 0xF6, 0xF6, 0xF9, 0x21, 0x73,
-    0xF7, 0x21, 0x65, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x74, 0xFD, 0xA1, 0x07, 0x82,
-    0x6E, 0xFD, 0xA0, 0x08, 0x63, 0xA0, 0x08, 0x92, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFA, 0xFD,
-    0xFD, 0xFD, 0xFD, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xFF, 0xB9, 0xFF, 0xBC, 0xFF,
-    0xBF, 0xFF, 0xEA, 0xFF, 0x70, 0xFF, 0x70, 0xFF, 0xF5, 0x42, 0x73, 0x75, 0xFF, 0xEA, 0xFF, 0x96,
-    0xA0, 0x09, 0x91, 0x21, 0x68, 0xFD, 0xA1, 0x09, 0x81, 0x63, 0xFD, 0x21, 0x6F, 0xFB, 0x21, 0x69,
-    0xFD, 0x21, 0x63, 0xFD, 0x21, 0x65, 0xFD, 0xA2, 0x00, 0x61, 0x65, 0x69, 0xE2, 0xFD, 0xA0, 0x00,
-    0x61, 0xA0, 0x0C, 0xC3, 0x21, 0x75, 0xFD, 0xA0, 0x04, 0x91, 0x21, 0x74, 0xFD, 0x22, 0x64, 0x73,
-    0xF7, 0xFD, 0x22, 0x6E, 0x73, 0xF5, 0xF5, 0x21, 0x6F, 0xFB, 0x22, 0x74, 0x7A, 0xED, 0xED, 0x21,
-    0x6E, 0xFB, 0x21, 0x61, 0xFD, 0x21, 0x64, 0xFD, 0x43, 0x63, 0x65, 0x6E, 0xFF, 0xEF, 0xFD, 0x20,
-    0xFF, 0xFD, 0x21, 0x6E, 0xD8, 0x23, 0x65, 0x61, 0x69, 0xD8, 0xF3, 0xFD, 0x21, 0x6C, 0xF9, 0x41,
-    0x69, 0xFD, 0x1D, 0xA0, 0x04, 0xA2, 0xA0, 0x04, 0xC2, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFD,
-    0xFD, 0xFD, 0xFD, 0xFD, 0x27, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xB3, 0xEF, 0xEF, 0xEF,
-    0xEF, 0xEF, 0xF5, 0x22, 0x6C, 0x6F, 0xDC, 0xF1, 0xA2, 0x00, 0x61, 0x61, 0x69, 0xD4, 0xFB, 0xA0,
-    0x0D, 0x43, 0x21, 0x69, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x62, 0xF4, 0x21, 0xA1,
-    0xFD, 0x22, 0xC3, 0x61, 0xFD, 0xFA, 0x23, 0x66, 0x6D, 0x72, 0xEF, 0xF2, 0xFB, 0xA0, 0x0D, 0x73,
-    0x21, 0x62, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x72, 0xFD, 0xA0, 0x0D, 0x42, 0x21, 0x69, 0xFD, 0x21,
-    0x74, 0xFD, 0x21, 0x70, 0xFD, 0x22, 0xA1, 0xB3, 0xF1, 0xFD, 0x21, 0x70, 0xEF, 0x21, 0x6F, 0xFD,
-    0x21, 0x72, 0xFD, 0x21, 0x75, 0xFD, 0x21, 0x6D, 0xE3, 0x21, 0xA1, 0xFD, 0x22, 0x61, 0xC3, 0xFA,
-    0xFD, 0x21, 0x6C, 0xFB, 0x21, 0x73, 0xFD, 0x41, 0x70, 0xFE, 0x28, 0x21, 0x73, 0xFC, 0x21, 0x6C,
-    0xCB, 0x22, 0x69, 0x65, 0xFA, 0xFD, 0x45, 0x61, 0xC3, 0x65, 0x69, 0x68, 0xFF, 0xB0, 0xFF, 0xCF,
-    0xFF, 0xDD, 0xFF, 0xEE, 0xFF, 0xFB, 0x21, 0x6E, 0xF0, 0xA0, 0x06, 0xD2, 0x41, 0x69, 0xFB, 0xE3,
-    0xA0, 0x0E, 0x92, 0x21, 0x65, 0xFD, 0xC3, 0x0D, 0xB3, 0x63, 0x72, 0x6A, 0xFF, 0xF6, 0xFB, 0xD9,
-    0xFF, 0xFD, 0x21, 0x6F, 0xEE, 0x21, 0xAD, 0xFD, 0x43, 0x67, 0x69, 0xC3, 0xFB, 0xC7, 0xFF, 0xE8,
-    0xFF, 0xFD, 0xA0, 0x06, 0xB2, 0xA1, 0x0E, 0x92, 0x61, 0xDB, 0x22, 0x63, 0x72, 0xF8, 0xFB, 0x21,
-    0x65, 0xFB, 0x41, 0x72, 0xFB, 0xAD, 0xA1, 0x0E, 0x92, 0x73, 0xCA, 0x23, 0x65, 0x61, 0x69, 0xC5,
-    0xFB, 0xC5, 0x21, 0x61, 0xBE, 0xC6, 0x0D, 0xB3, 0x72, 0x6C, 0x61, 0x6D, 0x74, 0x6F, 0xFF, 0xD3,
-    0xFF, 0xEA, 0xFF, 0xED, 0xFF, 0xF6, 0xFF, 0xFD, 0xFB, 0x9A, 0xA0, 0x05, 0x71, 0x21, 0x6F, 0xFD,
-    0x21, 0x64, 0xFD, 0xC3, 0x05, 0x81, 0x64, 0x65, 0x75, 0xFC, 0x8E, 0xFF, 0x9D, 0xFF, 0xFD, 0xC1,
-    0x0E, 0x92, 0x6F, 0xFF, 0x91, 0x43, 0xA1, 0xA9, 0xB3, 0xFF, 0x8B, 0xFF, 0x8B, 0xFF, 0x8B, 0x45,
-    0x61, 0x65, 0x6C, 0x6F, 0xC3, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0xF0, 0xFF, 0x81, 0xFF, 0xF6, 0x42,
-    0x61, 0x6F, 0xFF, 0x71, 0xFF, 0x71, 0x41, 0x72, 0xFF, 0x8C, 0x21, 0x70, 0xFC, 0x41, 0x72, 0xFF,
-    0x63, 0x21, 0x65, 0xFC, 0x41, 0x61, 0xFB, 0x3B, 0x42, 0x6D, 0x74, 0xFB, 0x37, 0xFF, 0xFC, 0xC7,
-    0x0D, 0xB3, 0x6E, 0x67, 0x6C, 0x7A, 0x6D, 0x63, 0x73, 0xFF, 0xB4, 0xFF, 0x63, 0xFF, 0xD0, 0xFF,
-    0xE0, 0xFF, 0xEB, 0xFF, 0xF2, 0xFF, 0xF9, 0x41, 0x65, 0xFF, 0x5B, 0x41, 0x73, 0xFF, 0x8F, 0x21,
-    0x65, 0xFC, 0xA2, 0x0D, 0xB3, 0x70, 0x72, 0xF5, 0xFD, 0x42, 0x61, 0x65, 0xFF, 0x27, 0xFF, 0x39,
-    0x44, 0x61, 0xC3, 0x65, 0x6F, 0xFF, 0x20, 0xFF, 0x95, 0xFF, 0x20, 0xFF, 0x20, 0xA2, 0x0D, 0xB3,
-    0x72, 0x6C, 0xEC, 0xF3, 0xA0, 0x0D, 0xE3, 0xC1, 0x0D, 0xE3, 0x6E, 0xFA, 0xE8, 0xA0, 0x0E, 0x72,
-    0xA1, 0x05, 0x81, 0x69, 0xFD, 0xA1, 0x0D, 0xE3, 0x6E, 0xFB, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA,
-    0xEA, 0xEA, 0xED, 0xFB, 0xEA, 0x41, 0x76, 0xFF, 0x0D, 0x41, 0x6D, 0xFF, 0x09, 0x22, 0x65, 0x6F,
-    0xF8, 0xFC, 0x48, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0x72, 0xFE, 0xD7, 0xFE, 0xE4, 0xFF,
-    0x23, 0xFF, 0x8D, 0xFF, 0xB0, 0xFF, 0xCB, 0xFF, 0xE8, 0xFF, 0xFB, 0x21, 0x74, 0xE7, 0x21, 0x73,
-    0xFD, 0x41, 0x70, 0xFB, 0xB0, 0x21, 0xBA, 0xFC, 0x22, 0x75, 0xC3, 0xF9, 0xFD, 0xA0, 0x01, 0x11,
-    0x21, 0x6E, 0xFD, 0x21, 0xAD, 0xFD, 0x22, 0x69, 0xC3, 0xFA, 0xFD, 0x21, 0x64, 0xFB, 0xA2, 0x04,
-    0xA2, 0x63, 0x72, 0xEA, 0xFD, 0x21, 0x6C, 0xE8, 0x21, 0x75, 0xFD, 0x21, 0x62, 0xFD, 0xA1, 0x04,
-    0xC2, 0x6D, 0xFD, 0x45, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFF, 0xFB, 0xFD, 0xE3, 0xFD, 0xE3, 0xFD,
-    0xE3, 0xFD, 0xE3, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xFD, 0x94, 0xFD, 0xD0, 0xFD,
-    0xD0, 0xFD, 0xD0, 0xFF, 0xDB, 0xFD, 0xD0, 0xFF, 0xF0, 0x22, 0xA1, 0xAD, 0xB4, 0xB4, 0x24, 0x61,
-    0xC3, 0x65, 0x69, 0xAF, 0xFB, 0xAF, 0xAF, 0x21, 0x62, 0xF7, 0xC2, 0x01, 0x11, 0x61, 0x6F, 0xFF,
-    0xA3, 0xFF, 0xA3, 0x21, 0x62, 0xF7, 0x21, 0xAD, 0xFD, 0xA2, 0x04, 0x91, 0x69, 0xC3, 0xEE, 0xFD,
-    0x41, 0x74, 0xFA, 0x1F, 0x21, 0x72, 0xFC, 0x21, 0x6F, 0xFD, 0xA1, 0x0D, 0xB2, 0x62, 0xFD, 0x41,
-    0x72, 0xFE, 0x63, 0x21, 0x61, 0xFC, 0xA1, 0x0D, 0xB2, 0x74, 0xFD, 0xA0, 0x0D, 0xB2, 0xA0, 0x0E,
-    0xB2, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x27, 0x68, 0x61, 0x65,
-    0x69, 0x6F, 0x75, 0xC3, 0xCD, 0xDE, 0xEA, 0xEF, 0xEF, 0xEF, 0xF5, 0x42, 0x65, 0x6F, 0xFF, 0x88,
-    0xFF, 0xF1, 0xC3, 0x00, 0x61, 0x61, 0x6F, 0x72, 0xFD, 0xF4, 0xFF, 0x3C, 0xFF, 0xF9, 0x41, 0x72,
-    0xFB, 0x6B, 0x21, 0x65, 0xFC, 0x41, 0xB3, 0xFB, 0x4A, 0x42, 0x6F, 0xC3, 0xFB, 0x46, 0xFF, 0xFC,
-    0x43, 0x72, 0x69, 0x73, 0xFB, 0x3C, 0xFF, 0xF2, 0xFF, 0xF9, 0x42, 0x73, 0x74, 0xFB, 0x32, 0xFB,
-    0x32, 0x41, 0xAD, 0xFB, 0x48, 0x22, 0x69, 0xC3, 0xF5, 0xFC, 0x21, 0x6D, 0xFB, 0x41, 0x6D, 0xFB,
-    0x1F, 0x21, 0x72, 0xFC, 0x21, 0xAD, 0xFD, 0x22, 0x69, 0xC3, 0xFA, 0xFD, 0x41, 0x76, 0xFB, 0x10,
-    0x21, 0xA1, 0xFC, 0xA0, 0x04, 0xE2, 0x21, 0x70, 0xFD, 0x23, 0x61, 0xC3, 0x75, 0xF3, 0xF7, 0xFD,
-    0x21, 0x72, 0xF9, 0x41, 0x69, 0xFB, 0x5E, 0x21, 0x64, 0xFC, 0x21, 0x6E, 0xFD, 0x41, 0xB1, 0xFA,
-    0xEF, 0x21, 0xC3, 0xFC, 0x21, 0xBA, 0xFD, 0x23, 0x6F, 0x75, 0xC3, 0xF3, 0xFA, 0xFD, 0x41, 0x73,
-    0xFF, 0x42, 0x21, 0xBA, 0xFC, 0x42, 0x75, 0xC3, 0xFA, 0xF7, 0xFF, 0xFD, 0x41, 0x67, 0xFA, 0xD3,
-    0x41, 0x7A, 0xFE, 0x14, 0x41, 0x6A, 0xFA, 0xC8, 0x23, 0xA9, 0xAD, 0xB3, 0xF4, 0xF8, 0xFC, 0x42,
-    0x61, 0xC3, 0xF9, 0x40, 0xFB, 0x35, 0x42, 0x6D, 0x74, 0xF9, 0x39, 0xF9, 0x39, 0x43, 0x7A, 0x6D,
-    0x73, 0xFF, 0xF2, 0xFA, 0xAF, 0xFF, 0xF9, 0x45, 0x65, 0xC3, 0x69, 0x6F, 0x71, 0xFF, 0xD5, 0xFF,
-    0xE1, 0xFF, 0xF6, 0xFF, 0xDD, 0xFA, 0xA5, 0x41, 0xAD, 0xFF, 0x76, 0x42, 0x69, 0xC3, 0xFF, 0x72,
-    0xFF, 0xFC, 0x43, 0xA1, 0xA9, 0xB3, 0xFA, 0x8A, 0xFA, 0x8A, 0xFA, 0x8A, 0x44, 0x61, 0xC3, 0x65,
-    0x6F, 0xFA, 0x80, 0xFF, 0xF6, 0xFA, 0x80, 0xFA, 0x80, 0x41, 0x65, 0xFA, 0xD8, 0x21, 0x72, 0xFC,
-    0x42, 0x6E, 0x74, 0xFA, 0xA1, 0xFA, 0x6C, 0xA0, 0x00, 0x40, 0x21, 0x74, 0xFD, 0x21, 0x65, 0xFD,
-    0x42, 0xA9, 0xAD, 0xFA, 0x94, 0xFF, 0xFD, 0x22, 0x65, 0xC3, 0xE9, 0xF9, 0x22, 0x61, 0x72, 0xE1,
-    0xFB, 0x41, 0x67, 0xFF, 0x42, 0x41, 0xBA, 0xFF, 0x28, 0x42, 0x75, 0xC3, 0xFF, 0x24, 0xFF, 0xFC,
-    0xCE, 0x07, 0x62, 0x62, 0x64, 0x66, 0x67, 0x63, 0x6A, 0x6C, 0x6E, 0x6D, 0x70, 0x65, 0x71, 0x7A,
-    0x73, 0xFF, 0x00, 0xFF, 0x1A, 0xFF, 0x27, 0xFF, 0x40, 0xFF, 0x57, 0xFF, 0x65, 0xFF, 0x97, 0xFF,
-    0xAB, 0xFF, 0xBC, 0xFF, 0xEC, 0xFF, 0xF1, 0xFF, 0x33, 0xFF, 0x33, 0xFF, 0xF9, 0xA0, 0x05, 0x02,
-    0x49, 0x6F, 0x63, 0x69, 0x66, 0x67, 0x76, 0x61, 0x73, 0x74, 0xF8, 0x8F, 0xFA, 0x0C, 0xFA, 0x71,
-    0xFA, 0x0C, 0xFA, 0x0C, 0xFA, 0x0C, 0xF8, 0x8F, 0xFA, 0x0C, 0xFA, 0x0C, 0x41, 0x64, 0xF8, 0x73,
-    0x21, 0x6E, 0xFC, 0x21, 0x69, 0xFD, 0xC3, 0x07, 0x62, 0x6E, 0x6D, 0x76, 0xFF, 0xDA, 0xFE, 0xDD,
-    0xFF, 0xFD, 0x41, 0x6E, 0xF9, 0xF7, 0x21, 0x65, 0xFC, 0x41, 0x61, 0xF9, 0xD3, 0x22, 0x69, 0x67,
-    0xF9, 0xFC, 0xC4, 0x07, 0x62, 0x62, 0x72, 0x63, 0x6A, 0xFE, 0xC1, 0xFF, 0xFB, 0xF9, 0xCA, 0xFA,
-    0x73, 0x42, 0xA1, 0xB3, 0xF9, 0xBB, 0xF9, 0xBB, 0x43, 0x61, 0xC3, 0x6F, 0xF9, 0xB4, 0xFF, 0xF9,
-    0xF9, 0xB4, 0x42, 0x63, 0x71, 0xFF, 0xF6, 0xF9, 0xAA, 0x42, 0x63, 0x71, 0xFF, 0xD0, 0xF9, 0xA3,
-    0x21, 0xAD, 0xF9, 0x22, 0x69, 0xC3, 0xEF, 0xFD, 0xC1, 0x05, 0x81, 0x74, 0xFC, 0x34, 0x41, 0x74,
-    0xFC, 0x2E, 0x21, 0xA1, 0xFC, 0x22, 0x61, 0xC3, 0xF3, 0xFD, 0x42, 0xA9, 0xB3, 0xF8, 0x05, 0xF8,
-    0x05, 0x48, 0x72, 0x61, 0x73, 0x6D, 0x65, 0xC3, 0x64, 0x66, 0xF7, 0xFE, 0xF7, 0xFE, 0xF7, 0xFE,
-    0xFF, 0x16, 0xF7, 0xFE, 0xFF, 0xF9, 0xF7, 0xFE, 0xF9, 0x7B, 0xC1, 0x05, 0x81, 0x72, 0xF7, 0xE5,
-    0x42, 0xAD, 0xA1, 0xFF, 0xFA, 0xF7, 0xDF, 0x43, 0x69, 0xC3, 0x74, 0xFF, 0xDA, 0xFF, 0xF9, 0xF9,
-    0x55, 0x41, 0xA1, 0xF9, 0x4E, 0x42, 0x61, 0xC3, 0xF9, 0x4A, 0xFF, 0xFC, 0x41, 0x7A, 0xF9, 0x40,
-    0x21, 0xAD, 0xFC, 0x22, 0x69, 0xC3, 0xF9, 0xFD, 0x21, 0x6C, 0xFB, 0x21, 0x69, 0xFD, 0xC5, 0x07,
-    0x62, 0x62, 0x6D, 0x6E, 0x73, 0x74, 0xFF, 0x95, 0xFF, 0xA7, 0xFF, 0xD9, 0xFF, 0xE7, 0xFF, 0xFD,
-    0x43, 0x61, 0x65, 0x6F, 0xF9, 0x1C, 0xF9, 0x1C, 0xF9, 0x1C, 0xC2, 0x07, 0x82, 0x62, 0x6D, 0xF9,
-    0x15, 0xFF, 0xF6, 0x45, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFF, 0xF7, 0xF9, 0xF0, 0xF9, 0xF0, 0xF9,
-    0xF0, 0xF9, 0xF0, 0x46, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xFE, 0xBD, 0xFE, 0xEA, 0xFF, 0x13,
-    0xFF, 0x2F, 0xFF, 0xCB, 0xFF, 0xF0, 0xA1, 0x00, 0x61, 0x65, 0xED, 0x43, 0x6E, 0x72, 0x73, 0xFE,
-    0xD2, 0xF8, 0xE1, 0xF8, 0xE1, 0xA0, 0x0C, 0x12, 0xA1, 0x0C, 0x12, 0x72, 0xFD, 0x21, 0x6E, 0xF8,
-    0x21, 0xB3, 0xFD, 0x23, 0x61, 0x6F, 0xC3, 0xF2, 0xF5, 0xFD, 0x41, 0x70, 0xF7, 0x45, 0x41, 0x6E,
-    0xF7, 0x41, 0x21, 0x65, 0xFC, 0x21, 0x64, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x22, 0x73,
-    0x74, 0xEC, 0xFD, 0x41, 0xA9, 0xF8, 0xBA, 0x21, 0x65, 0xD6, 0x21, 0x69, 0xFD, 0xC7, 0x0F, 0x93,
-    0x65, 0x6C, 0x64, 0x6E, 0x72, 0xC3, 0x6D, 0xFF, 0xBE, 0xF9, 0x7B, 0xFF, 0xD6, 0xFF, 0xF1, 0xF8,
-    0x9F, 0xFF, 0xF6, 0xFF, 0xFD, 0x41, 0xA1, 0xFC, 0xEB, 0x21, 0xC3, 0xFC, 0x42, 0x70, 0x74, 0xF8,
-    0xA9, 0xF7, 0x03, 0x22, 0x75, 0x65, 0xF6, 0xF9, 0x41, 0xA1, 0xF8, 0x74, 0x44, 0x61, 0xC3, 0x65,
-    0x6F, 0xF8, 0x70, 0xFF, 0xFC, 0xF8, 0x70, 0xF8, 0x70, 0x21, 0x74, 0xF3, 0x41, 0x65, 0xF6, 0xE3,
-    0x21, 0x75, 0xFC, 0x21, 0x6C, 0xFD, 0x41, 0x61, 0xFA, 0xF6, 0x41, 0x6E, 0xFC, 0xB6, 0x21, 0x65,
-    0xFC, 0x21, 0x6D, 0xFD, 0x41, 0x65, 0xF8, 0x4B, 0x23, 0x63, 0x69, 0x74, 0xEE, 0xF9, 0xFC, 0x41,
-    0x69, 0xF8, 0x66, 0x21, 0x6D, 0xFC, 0x21, 0xB3, 0xFD, 0x21, 0xC3, 0xFD, 0xC6, 0x0F, 0x93, 0x63,
-    0x73, 0x66, 0x6C, 0x72, 0x74, 0xFF, 0xB7, 0xFF, 0xCD, 0xFF, 0xD7, 0xFF, 0xEC, 0xFB, 0x06, 0xFF,
-    0xFD, 0x41, 0x75, 0xFC, 0x7F, 0x21, 0x63, 0xFC, 0x21, 0x65, 0xFD, 0x41, 0x6D, 0xFF, 0x57, 0x21,
-    0x65, 0xFC, 0x21, 0x6C, 0xAA, 0x21, 0x70, 0xFD, 0x41, 0x74, 0xFF, 0x4A, 0x41, 0x65, 0xF8, 0x29,
-    0x41, 0x6D, 0xF6, 0x7F, 0x21, 0xAD, 0xFC, 0x41, 0x75, 0xF8, 0x1E, 0x44, 0x61, 0x69, 0xC3, 0x72,
-    0xF8, 0x1A, 0xFF, 0xF5, 0xFF, 0xF9, 0xFF, 0xFC, 0x22, 0x70, 0x74, 0xE4, 0xF3, 0xA5, 0x0F, 0x93,
-    0x6A, 0x6C, 0x6D, 0x6E, 0x73, 0xCB, 0xD2, 0xD8, 0xDB, 0xFB, 0x41, 0x69, 0xFC, 0x36, 0x21, 0x70,
-    0xFC, 0x21, 0x69, 0xFD, 0x21, 0x63, 0xFD, 0x41, 0x63, 0xFA, 0x65, 0x21, 0x69, 0xFC, 0x41, 0xAD,
-    0xF7, 0xCF, 0x42, 0x69, 0xC3, 0xF7, 0xCB, 0xFF, 0xFC, 0x21, 0x64, 0xF9, 0xA3, 0x0F, 0x93, 0x63,
-    0x66, 0x72, 0xE8, 0xEF, 0xFD, 0x41, 0x62, 0xFA, 0xEF, 0xA1, 0x0F, 0x93, 0x72, 0xFC, 0x42, 0xA9,
-    0xB3, 0xF7, 0x9E, 0xF7, 0x9E, 0x42, 0x61, 0xC3, 0xF7, 0x97, 0xFF, 0xF9, 0x21, 0x74, 0xF9, 0x41,
-    0x74, 0xFF, 0x50, 0xA2, 0x0F, 0xC3, 0x73, 0x72, 0xF9, 0xFC, 0xA0, 0x0F, 0xC3, 0xC3, 0x0F, 0xC3,
-    0x6E, 0x6D, 0x72, 0xFD, 0x8F, 0xFA, 0x1F, 0xF7, 0x7F, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xEA,
-    0xF1, 0xF4, 0xF1, 0xF1, 0x41, 0x79, 0xF8, 0x11, 0x21, 0x61, 0xFC, 0x48, 0x69, 0x68, 0x61, 0x65,
-    0x6F, 0x75, 0xC3, 0x72, 0xFE, 0xC2, 0xF8, 0x91, 0xFF, 0x31, 0xFF, 0x82, 0xFF, 0xB1, 0xFF, 0xBE,
-    0xFF, 0xEE, 0xFF, 0xFD, 0x41, 0x74, 0xF8, 0x78, 0x21, 0x73, 0xFC, 0x41, 0x73, 0xF8, 0x71, 0x21,
-    0x65, 0xFC, 0x22, 0x65, 0x6F, 0xF6, 0xFD, 0x22, 0x62, 0x72, 0xD4, 0xFB, 0x41, 0x73, 0xFD, 0x21,
-    0x21, 0x61, 0xFC, 0x41, 0x61, 0xFD, 0x39, 0x21, 0x72, 0xFC, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD,
-    0x21, 0x65, 0xFD, 0x21, 0x62, 0xFD, 0xA3, 0x00, 0x61, 0x75, 0x6F, 0x65, 0xE1, 0xEA, 0xFD, 0x41,
-    0x70, 0xF6, 0x09, 0x21, 0x6D, 0xFC, 0x41, 0x6A, 0xF6, 0x02, 0xA0, 0x05, 0x52, 0x21, 0x74, 0xFD,
-    0x21, 0xB3, 0xFD, 0x21, 0xC3, 0xFD, 0x22, 0x62, 0x6C, 0xF0, 0xFD, 0x22, 0x69, 0x6F, 0xE8, 0xFB,
-    0x21, 0x65, 0xFB, 0x21, 0x6C, 0xFD, 0xC1, 0x0E, 0xB2, 0x67, 0xF9, 0x8A, 0x41, 0x67, 0xF5, 0x63,
-    0xA1, 0x0E, 0xB2, 0x65, 0xFC, 0x41, 0xB1, 0xF9, 0x7B, 0xA1, 0x0E, 0xB2, 0xC3, 0xFC, 0x43, 0xA1,
-    0xA9, 0xB3, 0xF5, 0x51, 0xF5, 0x51, 0xF5, 0x51, 0x44, 0x61, 0xC3, 0x65, 0x6F, 0xF5, 0x47, 0xFF,
-    0xF6, 0xF5, 0x47, 0xF5, 0x47, 0x21, 0x74, 0xF3, 0xC2, 0x0E, 0xB2, 0x64, 0x6E, 0xFA, 0x38, 0xFF,
-    0xFD, 0xA0, 0x10, 0xD2, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x47,
-    0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xF9, 0x3A, 0xFB, 0x1F, 0xFF, 0xB7, 0xFF, 0xC1, 0xFF,
-    0xCA, 0xFF, 0xE9, 0xFF, 0xF5, 0x21, 0x73, 0xEA, 0x41, 0x78, 0xF8, 0x7E, 0x21, 0xB3, 0xFC, 0x21,
-    0xC3, 0xFD, 0x22, 0x61, 0x69, 0xF3, 0xFD, 0xC2, 0x00, 0x61, 0x65, 0x72, 0xFF, 0x8C, 0xFF, 0xFB,
-    0x42, 0x61, 0x6F, 0xF6, 0x48, 0xF6, 0x48, 0x21, 0x65, 0xF9, 0x21, 0x6D, 0xFD, 0x41, 0x65, 0xF6,
-    0x3B, 0x21, 0x65, 0xFC, 0x21, 0x6D, 0xFD, 0x22, 0x75, 0x65, 0xF3, 0xFD, 0x41, 0x65, 0xF5, 0x60,
-    0x21, 0x72, 0xFC, 0x41, 0x6F, 0xF5, 0x59, 0x21, 0x72, 0xFC, 0x41, 0x72, 0xFB, 0x39, 0x21, 0x67,
-    0xFC, 0x21, 0x69, 0xFD, 0x21, 0x70, 0xFD, 0x41, 0x68, 0xFB, 0x2C, 0x21, 0x6F, 0xFC, 0x21, 0x63,
-    0xFD, 0x41, 0x69, 0xF6, 0x72, 0x21, 0x6E, 0xFC, 0x41, 0x72, 0xF6, 0x6B, 0x23, 0x6C, 0x6D, 0x65,
-    0xF2, 0xF9, 0xFC, 0x41, 0xB3, 0xFC, 0x0A, 0x42, 0x6F, 0xC3, 0xFC, 0x06, 0xFF, 0xFC, 0x21, 0x73,
-    0xF9, 0xA0, 0x05, 0x22, 0x21, 0x65, 0xFD, 0x42, 0x6A, 0x6E, 0xFF, 0xFD, 0xF9, 0x78, 0x21, 0x6F,
-    0xF9, 0x42, 0x65, 0x69, 0xFF, 0xFD, 0xF5, 0x0B, 0x24, 0x65, 0x61, 0x69, 0x74, 0xBC, 0xD4, 0xE6,
-    0xF9, 0x41, 0x74, 0xFF, 0xA2, 0xC4, 0x02, 0xB1, 0x62, 0x63, 0x6E, 0x74, 0xFF, 0x9B, 0xFF, 0xA2,
-    0xFF, 0xF3, 0xFF, 0xFC, 0x41, 0x74, 0xF6, 0xD3, 0x21, 0x73, 0xFC, 0xA1, 0x01, 0x82, 0x65, 0xFD,
-    0x42, 0x6F, 0xC3, 0xF8, 0xA2, 0xFA, 0x85, 0x41, 0x69, 0xF5, 0xE2, 0x21, 0x65, 0xFC, 0x41, 0xA9,
-    0xFD, 0x00, 0x42, 0x65, 0xC3, 0xFC, 0xFC, 0xFF, 0xFC, 0x41, 0x62, 0xF5, 0xB3, 0xA4, 0x09, 0xA3,
-    0x6D, 0x63, 0x6A, 0x72, 0xE3, 0xEE, 0xF5, 0xFC, 0x41, 0xAD, 0xFA, 0xC6, 0x42, 0x69, 0xC3, 0xFA,
-    0xC2, 0xFF, 0xFC, 0xA1, 0x09, 0xA3, 0x6D, 0xF9, 0xA0, 0x09, 0xA3, 0x44, 0x61, 0xC3, 0x65, 0x6F,
-    0xFC, 0x2F, 0xFE, 0xC3, 0xF4, 0x14, 0xF4, 0x14, 0xA1, 0x09, 0xA3, 0x6A, 0xF3, 0x43, 0x61, 0xC3,
-    0x65, 0xF4, 0x02, 0xF5, 0xF7, 0xF4, 0x02, 0x21, 0x72, 0xF6, 0x21, 0x65, 0xFD, 0xA1, 0x09, 0xA3,
-    0x6D, 0xFD, 0xA0, 0x09, 0xD3, 0xC1, 0x09, 0xD3, 0x6A, 0xF6, 0x40, 0x25, 0xA1, 0xA9, 0xAD, 0xB3,
-    0xBA, 0xF7, 0xF7, 0xF7, 0xFA, 0xF7, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xFF, 0x85,
-    0xFF, 0xA7, 0xFF, 0xBD, 0xFF, 0xC2, 0xFF, 0xD2, 0xFF, 0xE7, 0xFF, 0xF5, 0x41, 0x73, 0xF6, 0x3B,
-    0x42, 0x6C, 0x75, 0xF6, 0x37, 0xFF, 0xFC, 0x41, 0x6C, 0xF6, 0x30, 0x41, 0x72, 0xFF, 0x59, 0x41,
-    0x6D, 0xF6, 0x28, 0x44, 0xA1, 0xAD, 0xB3, 0xBA, 0xFF, 0xF4, 0xF6, 0x27, 0xFF, 0xF8, 0xFF, 0xFC,
-    0xC5, 0x01, 0x82, 0x61, 0xC3, 0x69, 0x6F, 0x75, 0xFF, 0xE0, 0xFF, 0xF3, 0xF6, 0x1A, 0xFF, 0xEB,
-    0xFF, 0xEF, 0x45, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFF, 0xA0, 0xFF, 0xA0, 0xFF, 0xA0, 0xFF, 0xA0,
-    0xFF, 0xA0, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xFF, 0xDE, 0xFF, 0x66, 0xFF, 0x66,
-    0xFF, 0x66, 0xFF, 0x66, 0xFF, 0x66, 0xFF, 0xF0, 0x42, 0x6E, 0x78, 0xFF, 0x8E, 0xFF, 0xEA, 0xA0,
-    0x01, 0x82, 0x41, 0x72, 0xF5, 0x3F, 0x41, 0x72, 0xF5, 0x0B, 0x22, 0x61, 0x6F, 0xF8, 0xFC, 0x42,
-    0x6E, 0x70, 0xF4, 0xEA, 0xF4, 0xEA, 0x21, 0x65, 0xF9, 0x41, 0x70, 0xF4, 0xE0, 0x22, 0x61, 0x6F,
-    0xFC, 0xFC, 0x41, 0x61, 0xFA, 0xE0, 0x21, 0x75, 0xFC, 0x41, 0x6D, 0xFF, 0x00, 0x21, 0xA1, 0xFC,
-    0x41, 0x65, 0xF4, 0xBD, 0x22, 0xC3, 0x69, 0xF9, 0xFC, 0x41, 0x69, 0xFB, 0x63, 0x21, 0x6C, 0xFC,
-    0x42, 0x6D, 0x63, 0xF4, 0x9C, 0xF3, 0x1F, 0x22, 0x61, 0x69, 0xF6, 0xF9, 0x41, 0x61, 0xFE, 0xDD,
-    0x21, 0x67, 0xFC, 0x41, 0x6C, 0xF4, 0x89, 0x42, 0x61, 0x69, 0xFB, 0x45, 0xF4, 0xEA, 0x43, 0x63,
-    0x68, 0x6E, 0xF4, 0xEC, 0xFF, 0xD2, 0xF4, 0xFD, 0x21, 0x65, 0xF6, 0x24, 0x61, 0x65, 0x6C, 0x72,
-    0xE5, 0xE8, 0xEC, 0xFD, 0x41, 0x63, 0xF4, 0x85, 0x21, 0x65, 0xFC, 0x41, 0xB3, 0xF4, 0x72, 0x21,
-    0xC3, 0xFC, 0x41, 0x67, 0xF4, 0x5A, 0x21, 0x75, 0xFC, 0x22, 0x6D, 0x72, 0xF6, 0xFD, 0x41, 0x69,
-    0xF4, 0x6E, 0x41, 0x62, 0xF2, 0xCD, 0x21, 0x69, 0xFC, 0x21, 0x76, 0xFD, 0x21, 0x6F, 0xFD, 0xCC,
-    0x09, 0xA3, 0x62, 0x63, 0x64, 0x67, 0x6C, 0x6E, 0x70, 0x66, 0x72, 0x73, 0x74, 0x6D, 0xFF, 0x6B,
-    0xFF, 0x77, 0xFF, 0x7E, 0xFF, 0x87, 0xFF, 0x95, 0xFF, 0xA8, 0xFF, 0xCC, 0xFF, 0xD9, 0xFF, 0xEA,
-    0xFF, 0xEF, 0xFA, 0x67, 0xFF, 0xFD, 0xC1, 0x02, 0x91, 0x69, 0xF4, 0x16, 0x21, 0x63, 0xFA, 0x21,
-    0x69, 0xFD, 0x41, 0x64, 0xF4, 0x78, 0x22, 0x75, 0x65, 0xFC, 0xAC, 0x41, 0x6F, 0xFA, 0x27, 0x42,
-    0x63, 0x61, 0xFF, 0xFC, 0xF8, 0x70, 0x41, 0x76, 0xF2, 0x79, 0x21, 0xAD, 0xFC, 0x42, 0x69, 0xC3,
-    0xF4, 0x24, 0xFF, 0xFD, 0x21, 0x75, 0xF9, 0xC2, 0x02, 0x91, 0x61, 0x68, 0xFF, 0x7D, 0xFA, 0x12,
-    0xC6, 0x09, 0xA3, 0x66, 0x6C, 0x6E, 0x71, 0x78, 0x76, 0xFF, 0xCF, 0xFF, 0xD6, 0xFF, 0xDF, 0xFF,
-    0xF4, 0xFF, 0xF7, 0xFE, 0x17, 0x42, 0x6F, 0x61, 0xF2, 0x4A, 0xF2, 0x4A, 0x21, 0x75, 0xF9, 0x41,
-    0x6C, 0xFF, 0x2D, 0x21, 0x61, 0xFC, 0x21, 0x75, 0xFD, 0xC3, 0x09, 0xA3, 0x63, 0x67, 0x6E, 0xFF,
-    0xF3, 0xFF, 0xFD, 0xF3, 0xB3, 0x41, 0x73, 0xFB, 0x5F, 0x44, 0x74, 0x61, 0xC3, 0x65, 0xF3, 0xA3,
-    0xF2, 0x26, 0xF4, 0x1B, 0xF2, 0x26, 0x43, 0x6F, 0x61, 0x6C, 0xF2, 0x19, 0xF2, 0x19, 0xFF, 0xF3,
-    0x42, 0x63, 0x74, 0xF2, 0x0F, 0xF2, 0x0F, 0x21, 0x6E, 0xF9, 0x22, 0x75, 0x65, 0xEC, 0xFD, 0x41,
-    0x73, 0xF2, 0x00, 0x21, 0x6E, 0xFC, 0x21, 0x65, 0xFD, 0x41, 0x6F, 0xF8, 0x25, 0xA4, 0x09, 0xA3,
-    0x62, 0x63, 0x66, 0x70, 0xC8, 0xED, 0xF9, 0xFC, 0x41, 0x7A, 0xF1, 0xE7, 0x21, 0x69, 0xFC, 0x21,
-    0x6C, 0xFD, 0x21, 0x69, 0xFD, 0xA1, 0x09, 0xA3, 0x74, 0xFD, 0x41, 0x6D, 0xF4, 0x2B, 0x21, 0x69,
-    0xFC, 0xA1, 0x09, 0xD3, 0x6E, 0xFD, 0x41, 0x74, 0xF4, 0x1F, 0x21, 0x69, 0xFC, 0xA1, 0x09, 0xD3,
-    0x64, 0xFD, 0x41, 0x69, 0xF4, 0x16, 0xA1, 0x09, 0xD3, 0x74, 0xFC, 0x45, 0xA1, 0xA9, 0xAD, 0xB3,
-    0xBA, 0xFF, 0xE6, 0xFF, 0xF2, 0xFD, 0xC7, 0xFD, 0xC7, 0xFF, 0xFB, 0xA0, 0x0C, 0x13, 0x21, 0x67,
-    0xFD, 0x22, 0x63, 0x74, 0xFA, 0xFA, 0x21, 0x70, 0xF5, 0x22, 0x70, 0x6D, 0xF8, 0xFD, 0xA2, 0x05,
-    0x22, 0x6F, 0x75, 0xF0, 0xFB, 0xA0, 0x0A, 0x92, 0xA0, 0x0A, 0xB3, 0xA0, 0x0B, 0x13, 0x23, 0xA1,
-    0xA9, 0xB3, 0xFD, 0xFD, 0xFD, 0x24, 0x61, 0x65, 0x6F, 0xC3, 0xF6, 0xF6, 0xF6, 0xF9, 0xA1, 0x0A,
-    0xB3, 0x73, 0xF7, 0xA0, 0x0A, 0xE3, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0x28, 0x72, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xCD, 0xD4, 0xD7, 0xED, 0xD7, 0xD7,
-    0xD7, 0xF5, 0x21, 0x72, 0xEF, 0x21, 0x65, 0xFD, 0x48, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3,
-    0x74, 0xFD, 0xE7, 0xFE, 0x87, 0xFE, 0xE8, 0xFF, 0x11, 0xFF, 0x55, 0xFF, 0x6D, 0xFF, 0x93, 0xFF,
-    0xFD, 0x21, 0x6E, 0xE7, 0x58, 0x62, 0x63, 0x64, 0x66, 0x67, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70,
-    0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x68, 0x61, 0x65, 0x69, 0xF2, 0x79, 0xF3,
-    0xD1, 0xF4, 0x53, 0xF4, 0x5A, 0xF4, 0x5A, 0xF4, 0x5A, 0xF4, 0x5A, 0xF4, 0x5A, 0xF4, 0xC4, 0xF4,
-    0x5A, 0xF7, 0x4E, 0xF4, 0x5A, 0xF9, 0xC2, 0xFB, 0x92, 0xFC, 0x33, 0xF4, 0x5A, 0xF4, 0x5A, 0xF4,
-    0x5A, 0xF4, 0x5A, 0xF4, 0x5A, 0xFC, 0x53, 0xFC, 0xC1, 0xFD, 0xC4, 0xFF, 0xFD, 0x41, 0x63, 0xFC,
-    0x16, 0xA0, 0x0D, 0x22, 0x21, 0x72, 0xFD, 0x21, 0x6F, 0xFD, 0xC3, 0x00, 0x71, 0x2E, 0x69, 0x65,
-    0xF0, 0x3F, 0xFF, 0xF3, 0xFF, 0xFD, 0xC3, 0x00, 0x71, 0x2E, 0x7A, 0x73, 0xF0, 0x33, 0xF0, 0x39,
-    0xF0, 0x39, 0xC1, 0x00, 0x71, 0x2E, 0xF0, 0x27, 0xD6, 0x00, 0x81, 0x2E, 0x62, 0x63, 0x64, 0x66,
-    0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79,
-    0x7A, 0xF0, 0x21, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
-    0x24, 0xF0, 0x24, 0xF3, 0xE6, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF3, 0xE6, 0xF0,
-    0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0x41, 0x74, 0xF0,
-    0x69, 0x21, 0x70, 0xFC, 0xD7, 0x00, 0x91, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B,
-    0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x65, 0xEF, 0xD5,
-    0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01,
-    0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01,
-    0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xFF, 0xFD, 0x42, 0x6F, 0x70, 0xF3,
-    0xA8, 0xFF, 0xB1, 0x41, 0x6E, 0xFB, 0x50, 0xD8, 0x00, 0x91, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67,
-    0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A,
-    0x69, 0x6F, 0xEF, 0x82, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE,
-    0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE,
-    0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xFF, 0xF5,
-    0xFF, 0xFC, 0x41, 0x74, 0xF1, 0xF3, 0x21, 0x70, 0xFC, 0x41, 0x6F, 0xFC, 0x90, 0x21, 0x6C, 0xFC,
-    0x41, 0x74, 0xF0, 0x5B, 0x41, 0x6D, 0xFA, 0xEF, 0x41, 0x61, 0xEF, 0x9F, 0x21, 0x72, 0xFC, 0x21,
-    0x74, 0xFD, 0x25, 0x6D, 0x75, 0x72, 0x73, 0x6E, 0xE4, 0xEB, 0xEE, 0xF2, 0xFD, 0xA0, 0x02, 0x32,
-    0x21, 0x61, 0xFD, 0x41, 0x2E, 0xEF, 0x06, 0xA1, 0x02, 0x32, 0x73, 0xFC, 0x22, 0x6F, 0x61, 0xF1,
-    0xFB, 0x41, 0x64, 0xEF, 0x88, 0x23, 0x63, 0x67, 0x72, 0xEB, 0xF7, 0xFC, 0x21, 0x6F, 0xE1, 0x41,
-    0x75, 0xEF, 0x68, 0x21, 0x72, 0xFC, 0x42, 0x64, 0x73, 0xFF, 0xFD, 0xF2, 0xE9, 0x22, 0x6C, 0x61,
-    0xEF, 0xF9, 0x41, 0x6C, 0xEF, 0x64, 0x21, 0x61, 0xFC, 0xA0, 0x07, 0x51, 0x21, 0x61, 0xFD, 0x21,
-    0x65, 0xFD, 0xA1, 0x04, 0x72, 0x72, 0xFD, 0x45, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFF, 0xFB, 0xEF,
-    0xD7, 0xEF, 0xD7, 0xEF, 0xD7, 0xEF, 0xD7, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xEF,
-    0xC1, 0xEF, 0xC4, 0xEF, 0xC4, 0xEF, 0xC4, 0xEF, 0xC4, 0xEF, 0xC4, 0xFF, 0xF0, 0x21, 0x69, 0xEA,
-    0x21, 0x74, 0xFD, 0x22, 0x66, 0x6E, 0xC3, 0xFD, 0x42, 0x68, 0x6F, 0xF2, 0x5F, 0xEF, 0xB4, 0x21,
-    0x6E, 0xF9, 0xA0, 0x06, 0xF3, 0xA0, 0x07, 0x23, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFD, 0xFD,
-    0xFD, 0xFD, 0xFD, 0x48, 0x72, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xF3, 0x4F, 0xF3, 0x26,
-    0xFF, 0xEF, 0xFF, 0xEF, 0xFF, 0xEF, 0xFF, 0xEF, 0xFF, 0xEF, 0xFF, 0xF5, 0x21, 0x72, 0xE7, 0x21,
-    0x65, 0xFD, 0x41, 0x6C, 0xFA, 0x21, 0x41, 0x6F, 0xF2, 0x6E, 0x24, 0x61, 0x62, 0x63, 0x74, 0xC5,
-    0xF5, 0xF8, 0xFC, 0x41, 0x6F, 0xEF, 0x25, 0x21, 0x63, 0xFC, 0x21, 0x69, 0xFD, 0x21, 0x72, 0xFD,
-    0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0xA9, 0xFD, 0xDC, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64,
-    0x66, 0x67, 0x6A, 0x6B, 0x6D, 0x6E, 0x70, 0x71, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x68,
-    0x6C, 0x72, 0x6F, 0x61, 0x75, 0x65, 0x69, 0xC3, 0xEE, 0x30, 0xEE, 0x33, 0xEE, 0x39, 0xEE, 0x33,
-    0xEE, 0x42, 0xEE, 0x47, 0xEE, 0x33, 0xEE, 0x33, 0xEE, 0x47, 0xFD, 0xF1, 0xEE, 0x4C, 0xEE, 0x33,
-    0xEE, 0x33, 0xFD, 0xFD, 0xEE, 0x33, 0xEE, 0x33, 0xEE, 0x33, 0xEE, 0x33, 0xFE, 0x09, 0xFE, 0x0F,
-    0xFE, 0x5B, 0xFE, 0xAE, 0xFF, 0x19, 0xFF, 0x3C, 0xFF, 0x54, 0xFF, 0x9A, 0xFF, 0xE1, 0xFF, 0xFD,
-    0x41, 0x74, 0xF2, 0xB2, 0x21, 0x6E, 0xFC, 0x21, 0x65, 0xFD, 0x21, 0x69, 0xFD, 0xA1, 0x04, 0xA2,
-    0x6D, 0xFD, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xF1, 0x95, 0xF1, 0xD1, 0xF1, 0xD1,
-    0xFF, 0xFB, 0xF1, 0xD1, 0xF1, 0xD1, 0xF1, 0xD7, 0x21, 0x61, 0xEA, 0xA0, 0x07, 0xC1, 0xA0, 0x07,
-    0xD2, 0xA0, 0x07, 0xF2, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x27,
-    0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xEC, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF5, 0x21, 0x6F,
-    0xF1, 0x21, 0x74, 0xFD, 0x42, 0x61, 0x6F, 0xFF, 0xFD, 0xEE, 0xA8, 0x21, 0x6D, 0xF9, 0xA0, 0x05,
-    0x92, 0x21, 0x65, 0xFD, 0x21, 0x64, 0xFD, 0xA0, 0x09, 0x32, 0x21, 0x61, 0xFD, 0x22, 0x72, 0x6C,
-    0xF7, 0xFD, 0xA0, 0x02, 0x12, 0x21, 0x69, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0x75, 0xFD, 0x41, 0x61,
-    0xEF, 0x4A, 0x22, 0x68, 0x6C, 0xF9, 0xFC, 0x22, 0x61, 0x65, 0xE0, 0xE0, 0x21, 0x68, 0xFB, 0x21,
-    0x74, 0xE3, 0x22, 0x63, 0x72, 0xFA, 0xFD, 0x23, 0xB3, 0xA1, 0xA9, 0xD6, 0xEB, 0xFB, 0x21, 0x6A,
-    0xC0, 0x21, 0x6C, 0xBD, 0x21, 0x74, 0xBA, 0x21, 0x6E, 0xFD, 0x22, 0x6C, 0x65, 0xF7, 0xFD, 0xA0,
-    0x02, 0x11, 0x21, 0x6A, 0xFD, 0x21, 0x69, 0xFD, 0x41, 0x69, 0xFF, 0xA6, 0x21, 0x6E, 0xFC, 0x21,
-    0x61, 0xFD, 0x41, 0x6D, 0xFF, 0x9C, 0x21, 0x61, 0xFC, 0x46, 0x64, 0x65, 0x69, 0x74, 0x67, 0x6E,
-    0xFF, 0x98, 0xFF, 0xD5, 0xFF, 0xE1, 0xFF, 0xEC, 0xFF, 0xF6, 0xFF, 0xFD, 0x42, 0x63, 0x7A, 0xFF,
-    0x82, 0xFF, 0x82, 0x41, 0x6E, 0xFF, 0x7B, 0x21, 0x65, 0xFC, 0x22, 0x65, 0x69, 0xF2, 0xFD, 0x21,
-    0x64, 0xFB, 0x41, 0x67, 0xFF, 0x6C, 0x21, 0x69, 0xFC, 0x41, 0x72, 0xFF, 0x65, 0x21, 0x74, 0xFC,
-    0x23, 0x65, 0x6C, 0x73, 0xEF, 0xF6, 0xFD, 0xA0, 0x09, 0x12, 0x21, 0x73, 0xFD, 0x41, 0x70, 0xFF,
-    0x51, 0x21, 0xBA, 0xFC, 0x23, 0x61, 0x75, 0xC3, 0xF6, 0xF9, 0xFD, 0x21, 0x6F, 0xDE, 0xC2, 0x09,
-    0x12, 0x63, 0x64, 0xFF, 0x91, 0xFF, 0x91, 0x23, 0xA1, 0xA9, 0xB3, 0xE0, 0xE0, 0xE0, 0x45, 0x61,
-    0xC3, 0x65, 0x6F, 0x6C, 0xFF, 0xF0, 0xFF, 0xF9, 0xFF, 0xD9, 0xFF, 0xD9, 0xFF, 0x81, 0x41, 0x69,
-    0xFF, 0x84, 0x21, 0x72, 0xFC, 0x41, 0x65, 0xFF, 0x6A, 0x21, 0x63, 0xFC, 0x42, 0xA1, 0xA9, 0xFF,
-    0x12, 0xFF, 0x12, 0x43, 0x61, 0xC3, 0x69, 0xFF, 0x0B, 0xFF, 0xF9, 0xFF, 0x0B, 0x41, 0xA9, 0xFF,
-    0x01, 0x42, 0x65, 0xC3, 0xFE, 0xFD, 0xFF, 0xFC, 0x41, 0x67, 0xFF, 0x0A, 0x21, 0x65, 0xFC, 0x4B,
-    0x72, 0x62, 0x63, 0x64, 0x6C, 0x70, 0x6E, 0x76, 0x78, 0x79, 0x73, 0xFF, 0x5A, 0xFF, 0x91, 0xFF,
-    0xA5, 0xFF, 0xAC, 0xFF, 0xBF, 0xFF, 0xD3, 0xFF, 0xDA, 0xFF, 0xE4, 0xFF, 0x49, 0xFF, 0xF2, 0xFF,
-    0xFD, 0xA0, 0x08, 0xC3, 0x21, 0x64, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x72, 0xF7, 0x22, 0x72, 0x6F,
-    0xFA, 0xFD, 0x22, 0x7A, 0x63, 0xEF, 0xEF, 0x21, 0x69, 0xFB, 0x21, 0x6C, 0xFD, 0x21, 0x61, 0xFD,
-    0x21, 0x72, 0xFD, 0x23, 0xA1, 0xA9, 0xB3, 0xDE, 0xDE, 0xDE, 0x22, 0x61, 0xC3, 0xD7, 0xF9, 0x23,
-    0x61, 0x65, 0x6F, 0xD2, 0xD2, 0xD2, 0x21, 0xAD, 0xF9, 0x22, 0x69, 0xC3, 0xF1, 0xFD, 0xA0, 0x08,
-    0xF2, 0x21, 0x73, 0xC0, 0x22, 0x61, 0x69, 0xFA, 0xFD, 0x21, 0x75, 0xFB, 0x21, 0xAD, 0xC6, 0x22,
-    0x69, 0xC3, 0xC3, 0xFD, 0x42, 0x76, 0x6E, 0xFF, 0xAD, 0xFF, 0xFB, 0x42, 0x61, 0x69, 0xED, 0xDD,
-    0xFF, 0xF9, 0x41, 0x6C, 0xFE, 0x80, 0x42, 0x72, 0x65, 0xFE, 0x7C, 0xFF, 0xFC, 0x21, 0x67, 0xF9,
-    0x41, 0x76, 0xFF, 0x91, 0x21, 0x69, 0xFC, 0x21, 0x73, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD,
-    0x21, 0x72, 0xFD, 0x41, 0x6C, 0xFF, 0x7E, 0x21, 0x6C, 0xFC, 0x21, 0x6F, 0xFD, 0x21, 0x72, 0xFD,
-    0x41, 0x72, 0xFE, 0x52, 0x43, 0x61, 0x65, 0x74, 0xF1, 0xB9, 0xF1, 0xB9, 0xFF, 0xFC, 0x41, 0x73,
-    0xFF, 0xA0, 0x21, 0x65, 0xFC, 0x41, 0x6E, 0xFF, 0x5C, 0x21, 0x75, 0xFC, 0x21, 0xB3, 0xF9, 0x22,
-    0xC3, 0x6F, 0xFD, 0xF6, 0x4D, 0x62, 0x63, 0x66, 0x67, 0x68, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74,
-    0x79, 0x7A, 0xFF, 0x59, 0xFF, 0x6C, 0xFF, 0x85, 0xFF, 0x95, 0xFE, 0x37, 0xFF, 0xA7, 0xFF, 0xB9,
-    0xFF, 0xCC, 0xFF, 0xD9, 0xFF, 0xE0, 0xFF, 0xEE, 0xFF, 0xF5, 0xFF, 0xFB, 0x44, 0x61, 0xC3, 0x65,
-    0x6F, 0xFF, 0x25, 0xFF, 0x47, 0xFF, 0x25, 0xFF, 0x25, 0x21, 0x6A, 0xF3, 0x41, 0x6A, 0xFF, 0x43,
-    0x21, 0xA9, 0xFC, 0x41, 0xB1, 0xFD, 0xEF, 0x21, 0xC3, 0xFC, 0x21, 0xA9, 0xFD, 0x22, 0x65, 0xC3,
-    0xFA, 0xFD, 0x23, 0x65, 0xC3, 0x70, 0xE7, 0xEE, 0xFB, 0x41, 0x6E, 0xFD, 0xD9, 0x21, 0xA9, 0xFC,
-    0x22, 0x65, 0xC3, 0xF9, 0xFD, 0x21, 0x72, 0xFB, 0x21, 0x66, 0xFD, 0xC6, 0x02, 0x11, 0x6E, 0x72,
-    0x62, 0x64, 0x6D, 0x73, 0xFE, 0x04, 0xFE, 0x04, 0xFE, 0x04, 0xFE, 0x04, 0xFE, 0x04, 0xFE, 0x04,
-    0x46, 0x6E, 0x72, 0x62, 0x64, 0x6D, 0x73, 0xFD, 0xEF, 0xFD, 0xEF, 0xFD, 0xEF, 0xFD, 0xEF, 0xFD,
-    0xEF, 0xFD, 0xEF, 0x21, 0xA1, 0xED, 0xC6, 0x09, 0x12, 0x6E, 0x72, 0x62, 0x64, 0x6D, 0x73, 0xFE,
-    0x31, 0xFE, 0x31, 0xFE, 0x31, 0xFE, 0x31, 0xFE, 0x31, 0xFE, 0x31, 0x42, 0xA1, 0xB3, 0xFF, 0xEB,
-    0xFE, 0x1C, 0x44, 0x61, 0xC3, 0x65, 0x6F, 0xFE, 0x15, 0xFE, 0x35, 0xFE, 0x15, 0xFE, 0x15, 0x44,
-    0x6F, 0x61, 0xC3, 0x68, 0xFE, 0x08, 0xFF, 0xD7, 0xFF, 0xEC, 0xFF, 0xF3, 0x41, 0xA9, 0xFE, 0x85,
-    0x42, 0x65, 0xC3, 0xFE, 0x81, 0xFF, 0xFC, 0xA1, 0x05, 0x92, 0x75, 0xF9, 0x41, 0x66, 0xFD, 0x42,
-    0x42, 0x63, 0x71, 0xFD, 0x3E, 0xFD, 0x3E, 0x22, 0x69, 0x75, 0xF5, 0xF9, 0x41, 0x62, 0xFD, 0xCD,
-    0x21, 0x6D, 0xFC, 0x21, 0x6F, 0xFD, 0x41, 0x7A, 0xFD, 0x28, 0x42, 0x63, 0x6E, 0xFD, 0x75, 0xFF,
-    0xFC, 0x21, 0x61, 0xF9, 0x21, 0x72, 0xFD, 0x44, 0x61, 0x65, 0x69, 0x75, 0xFD, 0x17, 0xFF, 0xFD,
-    0xFD, 0x9C, 0xFD, 0x7B, 0x41, 0x69, 0xFD, 0x4D, 0x41, 0x69, 0xFD, 0x8B, 0x43, 0x62, 0x63, 0x6C,
-    0xFF, 0xF8, 0xFD, 0x5C, 0xFF, 0xFC, 0x41, 0x73, 0xFC, 0xF8, 0x41, 0x63, 0xFC, 0xF4, 0x22, 0x65,
-    0x75, 0xF8, 0xFC, 0x43, 0x61, 0x69, 0x72, 0xFF, 0xE9, 0xFD, 0x4F, 0xFF, 0xFB, 0x23, 0x63, 0x70,
-    0x74, 0xB6, 0xCA, 0xF6, 0x42, 0x63, 0x74, 0xFC, 0xF1, 0xFC, 0xEE, 0x4A, 0x6D, 0x6E, 0x6F, 0x61,
-    0xC3, 0x63, 0x71, 0x64, 0x73, 0x72, 0xFF, 0x07, 0xFF, 0x1D, 0xFD, 0x24, 0xFF, 0x20, 0xFF, 0x48,
-    0xFF, 0x74, 0xFF, 0x8C, 0xFF, 0x9C, 0xFF, 0xF2, 0xFF, 0xF9, 0x42, 0x72, 0x6F, 0xFD, 0x05, 0xFC,
-    0xF7, 0x42, 0x61, 0x6F, 0xFC, 0xFE, 0xFC, 0xFE, 0x22, 0x65, 0x69, 0xF2, 0xF9, 0x41, 0x74, 0xFC,
-    0xF2, 0x21, 0x72, 0xFC, 0x41, 0xA1, 0xFC, 0xDD, 0x42, 0x61, 0xC3, 0xFC, 0xD9, 0xFF, 0xFC, 0x42,
-    0x6E, 0x75, 0xFC, 0xE0, 0xFF, 0xF9, 0x41, 0xB3, 0xFD, 0x0D, 0x42, 0x6F, 0xC3, 0xFD, 0x09, 0xFF,
-    0xFC, 0x21, 0x69, 0xF9, 0x21, 0x73, 0xFD, 0x21, 0x75, 0xFD, 0x42, 0x67, 0x6E, 0xFF, 0x6E, 0xFC,
-    0x74, 0x41, 0x65, 0xFF, 0x75, 0x42, 0x6F, 0x72, 0xFC, 0xEE, 0xFF, 0xFC, 0x22, 0x61, 0x70, 0xEE,
-    0xF9, 0x41, 0x72, 0xFD, 0x0C, 0x41, 0x73, 0xFC, 0x9F, 0x21, 0x75, 0xFC, 0x44, 0x65, 0x6C, 0x6F,
-    0x72, 0xFC, 0x9B, 0xFF, 0x4C, 0xFF, 0xF5, 0xFF, 0xFD, 0x42, 0x63, 0x74, 0xFC, 0xEE, 0xFC, 0xEE,
-    0x21, 0x6E, 0xF9, 0x41, 0x63, 0xFC, 0x8C, 0x41, 0x72, 0xFC, 0x7D, 0xC1, 0x05, 0x92, 0x61, 0xFC,
-    0x97, 0x41, 0x72, 0xFC, 0x91, 0x24, 0x65, 0x61, 0x6C, 0x6F, 0xEE, 0xF2, 0xF6, 0xFC, 0x41, 0x62,
-    0xFC, 0x20, 0x21, 0x69, 0xFC, 0x41, 0x63, 0xFC, 0x5F, 0x41, 0x61, 0xFC, 0x58, 0x22, 0x65, 0x74,
-    0xF8, 0xFC, 0x42, 0x67, 0x72, 0xFD, 0xCE, 0xFC, 0x20, 0x41, 0x78, 0xFC, 0x05, 0x23, 0x65, 0x6F,
-    0x75, 0xF5, 0xFC, 0xE1, 0x41, 0x65, 0xFC, 0x95, 0x47, 0x63, 0x65, 0x66, 0x68, 0x73, 0x74, 0x76,
-    0xFF, 0xA4, 0xFF, 0xB8, 0xFF, 0xCD, 0xFF, 0xDA, 0xFF, 0xE5, 0xFF, 0xF5, 0xFF, 0xFC, 0x41, 0x6E,
-    0xFC, 0x31, 0x21, 0x65, 0xFC, 0x21, 0x74, 0xFD, 0x47, 0x64, 0x65, 0x67, 0x6C, 0x6D, 0x6E, 0x73,
-    0xFF, 0x30, 0xFF, 0x39, 0xFF, 0x47, 0xFF, 0x5F, 0xFF, 0x74, 0xFF, 0xE0, 0xFF, 0xFD, 0x43, 0x72,
-    0x73, 0x6E, 0xFC, 0x69, 0xFC, 0x69, 0xFC, 0x69, 0x21, 0x61, 0xF6, 0x41, 0x6C, 0xFC, 0x04, 0x21,
-    0x6C, 0xFC, 0x41, 0x61, 0xFD, 0xE7, 0x21, 0x74, 0xFC, 0xA0, 0x09, 0x53, 0x22, 0x63, 0x71, 0xFD,
-    0xFD, 0x22, 0x73, 0x69, 0xF5, 0xFB, 0xC1, 0x05, 0x92, 0x61, 0xFB, 0x98, 0x43, 0x6E, 0x72, 0x73,
-    0xFB, 0x92, 0xFF, 0xFA, 0xFB, 0x92, 0x43, 0x6E, 0x72, 0x73, 0xFB, 0x88, 0xFB, 0x88, 0xFB, 0x88,
-    0x42, 0xA9, 0xB3, 0xFF, 0xF6, 0xFB, 0x7E, 0x45, 0x72, 0x64, 0x65, 0xC3, 0x6D, 0xFB, 0x77, 0xFB,
-    0x77, 0xFF, 0xE5, 0xFF, 0xF9, 0xFB, 0x77, 0x42, 0x6E, 0x73, 0xFB, 0x67, 0xFB, 0x67, 0x42, 0xA1,
-    0xAD, 0xFB, 0x60, 0xFF, 0xC8, 0x45, 0x69, 0x61, 0x65, 0x6F, 0xC3, 0xFF, 0xE2, 0xFF, 0xF2, 0xFB,
-    0x59, 0xFB, 0x59, 0xFF, 0xF9, 0x41, 0xA1, 0xFB, 0x49, 0x42, 0x61, 0xC3, 0xFB, 0x45, 0xFF, 0xFC,
-    0x21, 0xB1, 0xF9, 0x41, 0x62, 0xFB, 0x9C, 0x47, 0x64, 0x65, 0x62, 0x73, 0x6E, 0xC3, 0x72, 0xFF,
-    0x81, 0xFF, 0x88, 0xFF, 0x9A, 0xFF, 0x8F, 0xFF, 0xDE, 0xFF, 0xF9, 0xFF, 0xFC, 0x46, 0xC3, 0x6F,
-    0x61, 0x65, 0x69, 0x75, 0xFB, 0x5A, 0xFC, 0x32, 0xFD, 0x07, 0xFE, 0x4E, 0xFF, 0x4B, 0xFF, 0xEA,
-    0x41, 0x69, 0xFB, 0x5F, 0x21, 0x74, 0xFC, 0x21, 0x73, 0xFD, 0x45, 0x63, 0x6E, 0x72, 0x73, 0x69,
-    0xFA, 0xCE, 0xF4, 0xA7, 0xFB, 0x01, 0xFF, 0xE3, 0xFF, 0xFD, 0xA0, 0x11, 0x72, 0x21, 0x63, 0xFD,
-    0x21, 0xA9, 0xFD, 0x22, 0x65, 0xC3, 0xFA, 0xFD, 0x21, 0x6C, 0xFB, 0x21, 0x65, 0xFD, 0xD8, 0x00,
-    0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x73,
-    0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x72, 0x65, 0x69, 0xE8, 0x5B, 0xE8, 0x5E, 0xE8, 0x64, 0xE8,
-    0x5E, 0xE8, 0x6D, 0xE8, 0x72, 0xE8, 0x5E, 0xE8, 0x5E, 0xE8, 0x5E, 0xE8, 0x5E, 0xE8, 0x72, 0xE8,
-    0x5E, 0xE8, 0x77, 0xE8, 0x5E, 0xE8, 0x5E, 0xE8, 0x80, 0xE8, 0x5E, 0xE8, 0x5E, 0xE8, 0x5E, 0xE8,
-    0x5E, 0xE8, 0x5E, 0xE8, 0x8A, 0xFF, 0xDC, 0xFF, 0xFD, 0x42, 0x6D, 0x72, 0xF4, 0x38, 0xF3, 0xDE,
-    0x41, 0x69, 0xF3, 0xD3, 0x43, 0x6C, 0x73, 0x74, 0xF9, 0xB2, 0xFF, 0xFC, 0xF9, 0xB2, 0x42, 0x6E,
-    0x74, 0xF9, 0xA8, 0xF9, 0xA8, 0x41, 0x69, 0xEB, 0x9B, 0x21, 0x72, 0xFC, 0x21, 0x61, 0xFD, 0x21,
-    0x69, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x6D, 0xFD, 0xDA, 0x00, 0x41, 0x2E, 0x62,
-    0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6D, 0x6E, 0x70, 0x71, 0x73, 0x74, 0x76, 0x77, 0x78,
-    0x79, 0x7A, 0x6C, 0x72, 0x65, 0x69, 0x6F, 0x61, 0xE7, 0xDE, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1,
-    0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1,
-    0xE7, 0xE1, 0xE7, 0xE1, 0xF7, 0xB7, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1,
-    0xE8, 0x0D, 0xE8, 0x0D, 0xFF, 0xCE, 0xFF, 0xD9, 0xFF, 0xE3, 0xFF, 0xFD, 0xD7, 0x00, 0x91, 0x2E,
-    0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74,
-    0x76, 0x77, 0x78, 0x79, 0x7A, 0x75, 0xE7, 0x8D, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9,
-    0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9,
-    0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9,
-    0xE7, 0xB9, 0xF7, 0x41, 0xA0, 0x08, 0xB1, 0x21, 0x2E, 0xFD, 0x49, 0x68, 0x61, 0x65, 0x69, 0x6F,
-    0x75, 0xC3, 0x2E, 0x73, 0xE8, 0x4E, 0xE8, 0x51, 0xE8, 0x51, 0xE8, 0x51, 0xE8, 0x51, 0xE8, 0x51,
-    0xE8, 0x57, 0xFF, 0xFA, 0xFF, 0xFD, 0x22, 0x2E, 0x73, 0xDE, 0xE1, 0x21, 0x61, 0xFB, 0x21, 0xAD,
-    0xFD, 0x23, 0x6F, 0x61, 0xC3, 0xD9, 0xF5, 0xFD, 0x21, 0x66, 0xF9, 0xD7, 0x00, 0x91, 0x2E, 0x62,
-    0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76,
-    0x77, 0x78, 0x79, 0x7A, 0x61, 0xE7, 0x0E, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7,
-    0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7,
-    0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7,
-    0x3A, 0xFF, 0xFD, 0x41, 0x73, 0xFF, 0x84, 0x42, 0x2E, 0x65, 0xFF, 0x7D, 0xFF, 0xFC, 0x21, 0x6C,
-    0xF9, 0x42, 0x6F, 0x61, 0xFF, 0x95, 0xFF, 0xFD, 0x21, 0x6E, 0xF9, 0x41, 0x72, 0xF9, 0x23, 0x42,
-    0x65, 0x72, 0xFF, 0xFC, 0xE7, 0x37, 0x21, 0x74, 0xF9, 0x42, 0x6C, 0x73, 0xF8, 0x4D, 0xFF, 0xFD,
-    0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xE7, 0x64, 0xE7, 0x67, 0xE7, 0x67, 0xE7, 0x67,
-    0xE7, 0x67, 0xE7, 0x67, 0xE7, 0x6D, 0x41, 0x6E, 0xF8, 0xFB, 0x21, 0x6F, 0xFC, 0x22, 0x6F, 0x72,
-    0xE3, 0xFD, 0x41, 0x63, 0xE7, 0x04, 0x21, 0x65, 0xFC, 0x41, 0x61, 0xEA, 0x8B, 0x22, 0x6E, 0x67,
-    0xF9, 0xFC, 0x41, 0x64, 0xF7, 0x46, 0x21, 0x72, 0xFC, 0x21, 0x61, 0xFD, 0xDB, 0x00, 0x41, 0x2E,
-    0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6D, 0x6E, 0x70, 0x71, 0x73, 0x74, 0x76, 0x77,
-    0x78, 0x79, 0x7A, 0x6C, 0x72, 0x6F, 0x61, 0x65, 0x69, 0x75, 0xE6, 0x5D, 0xE6, 0x60, 0xE6, 0x60,
-    0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xF6, 0x36,
-    0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60,
-    0xE6, 0x60, 0xFE, 0xD0, 0xFF, 0x4F, 0xFF, 0xAC, 0xFF, 0xBD, 0xFF, 0xE1, 0xFF, 0xF1, 0xFF, 0xFD,
-    0x41, 0x2E, 0xE6, 0x0C, 0x42, 0x2E, 0x73, 0xE6, 0x08, 0xFF, 0xFC, 0x22, 0x6F, 0x61, 0xF9, 0xF9,
-    0x21, 0x6C, 0xFB, 0x42, 0x6F, 0x61, 0xE6, 0xD5, 0xE6, 0xD5, 0x21, 0x6E, 0xF9, 0x21, 0x61, 0xFD,
-    0x22, 0x65, 0x6D, 0xF0, 0xFD, 0x41, 0x65, 0xFE, 0x9F, 0x21, 0x74, 0xFC, 0x21, 0x6E, 0xFD, 0x21,
-    0x61, 0xFD, 0x21, 0x65, 0xFA, 0x22, 0x6C, 0x69, 0xFA, 0xFD, 0x42, 0x6C, 0x62, 0xF7, 0x7C, 0xFF,
-    0xFB, 0x42, 0x63, 0x6F, 0xE6, 0x55, 0xE6, 0xEB, 0x21, 0x69, 0xF9, 0x41, 0x2E, 0xE8, 0xAA, 0x42,
-    0x2E, 0x73, 0xE8, 0xA6, 0xFF, 0xFC, 0x21, 0x61, 0xF9, 0xA1, 0x04, 0xA2, 0x6C, 0xFD, 0x47, 0x68,
-    0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xE9, 0x79, 0xE9, 0xB5, 0xE9, 0xB5, 0xE9, 0xB5, 0xFF, 0xFB,
-    0xE9, 0xB5, 0xE9, 0xBB, 0x43, 0x61, 0x69, 0x6F, 0xF5, 0xB9, 0xFF, 0xEA, 0xE9, 0xB0, 0x42, 0x61,
-    0x74, 0xF5, 0xAF, 0xE6, 0xBD, 0x41, 0x72, 0xE6, 0x11, 0x21, 0x65, 0xFC, 0x46, 0x63, 0x6C, 0x6D,
-    0x70, 0x74, 0x78, 0xF1, 0xA5, 0xFF, 0xBC, 0xFF, 0xE8, 0xFF, 0xF2, 0xFF, 0xFD, 0xFF, 0x0D, 0xA0,
-    0x0A, 0x13, 0x21, 0x65, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0xAD, 0xFD, 0x21, 0xC3, 0xFD, 0xA1, 0x06,
-    0xF3, 0x63, 0xFD, 0x21, 0x69, 0xEC, 0x21, 0x6D, 0xFD, 0x21, 0xAD, 0xFD, 0x22, 0x69, 0xC3, 0xFA,
-    0xFD, 0x21, 0x61, 0xDE, 0x21, 0x69, 0xFD, 0xA2, 0x06, 0xF3, 0x6E, 0x78, 0xF5, 0xFD, 0xA0, 0x0A,
-    0x43, 0x21, 0x6F, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0x69, 0xFD, 0xA1, 0x07, 0x23, 0x6E, 0xFD, 0x45,
-    0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xF6, 0xA6, 0xF6, 0xA6, 0xF6, 0xA6, 0xFF, 0xFB, 0xF6, 0xA6, 0x48,
-    0x72, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xE9, 0xF3, 0xE9, 0xCA, 0xF6, 0x93, 0xF6, 0x93,
-    0xFF, 0xBF, 0xFF, 0xD8, 0xF6, 0x93, 0xFF, 0xF0, 0x21, 0x72, 0xE7, 0x42, 0x65, 0x6F, 0xFF, 0xFD,
-    0xE9, 0x19, 0x43, 0x64, 0x70, 0x73, 0xF0, 0xC5, 0xFF, 0xF9, 0xF1, 0x1F, 0x42, 0x6F, 0x65, 0xE9,
-    0x08, 0xF0, 0xB7, 0x42, 0x6C, 0x6D, 0xF6, 0x93, 0xFF, 0xF9, 0x5B, 0x2E, 0x62, 0x63, 0x64, 0x66,
-    0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79,
-    0x7A, 0x75, 0x61, 0x65, 0x69, 0x6F, 0xE4, 0xDF, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2,
-    0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2,
-    0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2,
-    0xE4, 0xE2, 0xFE, 0xF6, 0xFF, 0x10, 0xFF, 0x62, 0xFF, 0xE8, 0xFF, 0xF9, 0xD6, 0x00, 0x41, 0x2E,
-    0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74,
-    0x76, 0x77, 0x78, 0x79, 0x7A, 0xE4, 0x8D, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4,
-    0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4,
-    0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4,
-    0x90, 0x41, 0x6C, 0xF5, 0xF5, 0xD7, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A,
-    0x6B, 0x6D, 0x6E, 0x70, 0x71, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x6C, 0x72, 0x69, 0xE4,
-    0x44, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4,
-    0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4,
-    0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x73, 0xE4, 0x73, 0xFF, 0xFC, 0xD6, 0x00, 0x81,
-    0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73,
-    0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xE3, 0xFC, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF,
-    0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF,
-    0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF,
-    0xE3, 0xFF, 0x41, 0x75, 0xF3, 0x6B, 0x41, 0x66, 0xEF, 0x7D, 0xA0, 0x0D, 0x02, 0x21, 0x61, 0xFD,
-    0x21, 0x65, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0xA1, 0xFD, 0x44, 0x6E, 0x70, 0x74, 0xC3, 0xFF, 0xED,
-    0xF5, 0x4D, 0xF5, 0x4D, 0xFF, 0xFD, 0x41, 0x61, 0xFC, 0x4E, 0x21, 0xAD, 0xFC, 0x21, 0xC3, 0xFD,
-    0x21, 0x67, 0xFD, 0xD9, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6D,
-    0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x6C, 0x65, 0x69, 0x6F, 0xE3,
-    0x86, 0xE3, 0x89, 0xE3, 0x8F, 0xE3, 0x89, 0xE3, 0x98, 0xE3, 0x9D, 0xE3, 0x89, 0xE3, 0x89, 0xE3,
-    0x89, 0xE3, 0x9D, 0xE3, 0x89, 0xE3, 0xA2, 0xE3, 0x89, 0xE3, 0x89, 0xE3, 0x89, 0xE3, 0xAB, 0xE3,
-    0x89, 0xE3, 0x89, 0xE3, 0x89, 0xE3, 0x89, 0xE3, 0x89, 0xFF, 0x8A, 0xFF, 0xCF, 0xFF, 0xE6, 0xFF,
-    0xFD, 0x42, 0x2E, 0x73, 0xE3, 0x38, 0xF4, 0x32, 0x21, 0x65, 0xF9, 0x21, 0x6C, 0xFD, 0x21, 0x62,
-    0xFD, 0x41, 0x2E, 0xE4, 0x07, 0x21, 0x65, 0xFC, 0x21, 0x74, 0xFD, 0x48, 0x6C, 0x68, 0x61, 0x65,
-    0x69, 0x6F, 0x75, 0xC3, 0xE3, 0xAB, 0xE6, 0xEC, 0xE7, 0x28, 0xE7, 0x28, 0xE7, 0x28, 0xE7, 0x28,
-    0xE7, 0x28, 0xE7, 0x2E, 0x21, 0x61, 0xE7, 0x41, 0x6E, 0xE3, 0x8F, 0x21, 0x61, 0xFC, 0x47, 0x6F,
-    0x61, 0x6E, 0x67, 0x6C, 0x73, 0x74, 0xF3, 0xF5, 0xFF, 0xD0, 0xFF, 0xDA, 0xFF, 0xF6, 0xFF, 0xFD,
-    0xF4, 0xA8, 0xFC, 0x8B, 0xA0, 0x05, 0x51, 0x21, 0x61, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x74, 0xFD,
-    0xA0, 0x02, 0xB2, 0xCC, 0x01, 0xA1, 0x68, 0x62, 0x63, 0x64, 0x66, 0x67, 0x6D, 0x70, 0x71, 0x73,
-    0x74, 0x76, 0xFF, 0xFD, 0xE4, 0xE9, 0xE4, 0xE9, 0xE4, 0xE9, 0xE4, 0xE9, 0xE4, 0xE9, 0xE4, 0xE9,
-    0xE4, 0xE9, 0xE4, 0xE9, 0xE4, 0xE9, 0xE4, 0xE9, 0xE4, 0xE9, 0x41, 0x69, 0xE6, 0xCA, 0x44, 0x6E,
-    0x63, 0x6C, 0x78, 0xFF, 0xCF, 0xEE, 0x79, 0xFF, 0xD5, 0xFF, 0xFC, 0x41, 0x72, 0xE8, 0xA2, 0x21,
-    0x61, 0xFC, 0x21, 0x69, 0xFD, 0xA0, 0x01, 0x12, 0x21, 0x72, 0xFD, 0x21, 0x75, 0xFD, 0xA1, 0x04,
-    0xA2, 0x74, 0xFD, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xE6, 0x54, 0xFF, 0xFB, 0xE6,
-    0x90, 0xE6, 0x90, 0xE6, 0x90, 0xE6, 0x90, 0xE6, 0x96, 0x21, 0x69, 0xEA, 0x41, 0x69, 0xE3, 0x9F,
-    0x44, 0x63, 0x6C, 0x6E, 0x72, 0xEE, 0x37, 0xFF, 0xD2, 0xFF, 0xF9, 0xFF, 0xFC, 0x41, 0x74, 0xE6,
-    0x62, 0x21, 0x6C, 0xFC, 0x43, 0x6E, 0x72, 0x74, 0xF4, 0x02, 0xFE, 0xA2, 0xF4, 0x02, 0xDB, 0x00,
-    0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72,
-    0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x65, 0x61, 0x69, 0x75, 0x6F, 0xE2, 0x4B, 0xE2, 0x4E,
-    0xE2, 0x54, 0xE2, 0x4E, 0xE2, 0x5D, 0xE2, 0x62, 0xE2, 0x4E, 0xE2, 0x4E, 0xE2, 0x4E, 0xE2, 0x4E,
-    0xE2, 0x62, 0xF2, 0x24, 0xE2, 0x67, 0xE2, 0x4E, 0xE2, 0x4E, 0xE2, 0x4E, 0xE2, 0x70, 0xE2, 0x4E,
-    0xE2, 0x4E, 0xE2, 0x4E, 0xE2, 0x4E, 0xE2, 0x4E, 0xFF, 0x50, 0xFF, 0xA0, 0xFF, 0xE2, 0xFF, 0xF3,
-    0xFF, 0xF6, 0xA0, 0x0B, 0x95, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x72, 0xFD, 0xC3, 0x00,
-    0x71, 0x7A, 0x73, 0x65, 0xE1, 0xF1, 0xE1, 0xF1, 0xFF, 0xFD, 0x41, 0x74, 0xED, 0xA2, 0x42, 0x2E,
-    0x72, 0xE1, 0xDE, 0xFF, 0xFC, 0x43, 0x6D, 0x6E, 0x72, 0xF3, 0x81, 0xF3, 0x81, 0xF1, 0x88, 0x45,
-    0x63, 0x66, 0x6F, 0x74, 0x75, 0xED, 0x98, 0xED, 0x98, 0xFB, 0x31, 0xF3, 0x77, 0xF2, 0xA5, 0xD9,
-    0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71,
-    0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x6F, 0x61, 0x65, 0xE1, 0xBA, 0xE1, 0xBD, 0xE1,
-    0xC3, 0xE1, 0xBD, 0xE1, 0xCC, 0xE1, 0xD1, 0xE1, 0xBD, 0xE1, 0xBD, 0xE1, 0xBD, 0xE1, 0xBD, 0xE1,
-    0xD1, 0xE1, 0xBD, 0xE1, 0xD6, 0xE1, 0xBD, 0xE1, 0xBD, 0xE1, 0xBD, 0xFF, 0xCF, 0xE1, 0xBD, 0xE1,
-    0xBD, 0xE1, 0xBD, 0xE1, 0xBD, 0xE1, 0xBD, 0xFF, 0xDF, 0xFF, 0xE6, 0xFF, 0xF0, 0xC1, 0x0D, 0x22,
-    0x6F, 0xE2, 0x8F, 0x42, 0x63, 0x71, 0xFF, 0xFA, 0xF1, 0x1E, 0xC2, 0x00, 0x71, 0x2E, 0x69, 0xE1,
-    0x5F, 0xFF, 0xF9, 0xC2, 0x00, 0x71, 0x2E, 0x65, 0xE1, 0x56, 0xED, 0x24, 0x41, 0x74, 0xFE, 0xB9,
-    0x21, 0x63, 0xFC, 0x21, 0x6E, 0xFD, 0x41, 0x72, 0xE5, 0x49, 0xD8, 0x00, 0x91, 0x2E, 0x62, 0x63,
+constexpr uint8_t es_trie_classes[256] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+    0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00,
+    0x00, 0x1F, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+constexpr uint32_t es_trie_dense[] = {
+    0x00000000u, 0x00000002u, 0x00000064u, 0x000000B2u, 0x00000116u, 0x0000018Au, 0x000001EEu, 0x0000022Cu,
+    0x00000298u, 0x00000308u, 0x00000376u, 0x000003A0u, 0x000003FCu, 0x0000045Cu, 0x000004C4u, 0x00000534u,
+    0x0000059Cu, 0x000005D2u, 0x00000642u, 0x000006A2u, 0x0000070Au, 0x00000776u, 0x000007EAu, 0x000007F8u,
+    0x00000858u, 0x000008B8u, 0x0000091Cu, 0x00000978u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x000009D8u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x000009EEu, 0x00000A02u, 0x00000A0Au, 0x00000A16u, 0x00000A22u, 0x00000A2Cu, 0x00000A2Cu, 0x00000A30u,
+    0x00000A3Au, 0x00000A2Cu, 0x00000A2Cu, 0x00000A2Cu, 0x00000A40u, 0x00000A2Cu, 0x00000000u, 0x00000A4Cu,
+    0x00000A2Cu, 0x00000A5Cu, 0x00000A64u, 0x00000A74u, 0x00000000u, 0x00000A2Cu, 0x00000A2Cu, 0x00000A2Cu,
+    0x00000A2Cu, 0x00000A2Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000A80u, 0x00000A84u, 0x00000A8Eu, 0x00000A94u, 0x00000AA2u, 0x00000AC4u,
+    0x00000ACAu, 0x00000AC4u, 0x00000000u, 0x00000AD4u, 0x00000000u, 0x00000000u, 0x00000ADAu, 0x00000AE4u,
+    0x00000AF2u, 0x00000B08u, 0x00000B0Eu, 0x00000000u, 0x00000B14u, 0x00000B46u, 0x00000B54u, 0x00000B5Au,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000B68u, 0x00000000u, 0x00000A80u, 0x00000000u, 0x00000B6Eu,
+    0x00000B72u, 0x00000B6Eu, 0x00000000u, 0x00000B82u, 0x00000B8Au, 0x00000B6Eu, 0x00000B92u, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000BA4u, 0x00000B8Au, 0x00000B6Eu, 0x00000000u, 0x00000C00u, 0x00000B6Eu, 0x00000BA4u,
+    0x00000B6Eu, 0x00000C10u, 0x00000C1Cu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000A80u, 0x00000C22u, 0x00000B6Eu, 0x00000B72u, 0x00000B6Eu, 0x00000C30u, 0x00000B82u, 0x00000B8Au,
+    0x00000C3Au, 0x00000C96u, 0x00000B6Eu, 0x00000B6Eu, 0x00000CA8u, 0x00000B8Au, 0x00000D08u, 0x00000D18u,
+    0x00000C00u, 0x00000B6Eu, 0x00000D2Eu, 0x00000B6Eu, 0x00000D92u, 0x00000DA2u, 0x00000B6Eu, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000B6Eu, 0x00000DACu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000DB4u, 0x00000000u, 0x00000A80u, 0x00000000u, 0x00000B6Eu, 0x00000B72u, 0x00000B6Eu,
+    0x00000DBAu, 0x00000B82u, 0x00000B8Au, 0x00000B6Eu, 0x00000DD0u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu,
+    0x00000B8Au, 0x00000B6Eu, 0x00000000u, 0x00000C00u, 0x00000B6Eu, 0x00000BA4u, 0x00000B6Eu, 0x00000C10u,
+    0x00000000u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000A80u, 0x00000DD6u,
+    0x00000000u, 0x00000DE4u, 0x00000DF6u, 0x00000E10u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000E16u, 0x00000E20u, 0x00000E2Eu, 0x00000E44u, 0x00000000u, 0x00000000u,
+    0x00000E52u, 0x00000E80u, 0x00000E8Eu, 0x00000E94u, 0x00000000u, 0x00000000u, 0x00000E9Eu, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000EC0u,
+    0x00000000u, 0x00000A80u, 0x00000EC6u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000ECCu, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000B6Eu, 0x00000ED6u, 0x00000B6Eu, 0x00000B6Eu, 0x00000BA4u, 0x00000B6Eu, 0x00000B6Eu,
+    0x00000EE4u, 0x00000B6Eu, 0x00000B6Eu, 0x00000BA4u, 0x00000B6Eu, 0x00000DACu, 0x00000000u, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000A80u, 0x00000EEEu, 0x00000B6Eu, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000EF8u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000F02u, 0x00000B6Eu, 0x00000B6Eu,
+    0x00000F0Cu, 0x00000B6Eu, 0x00000DACu, 0x00000F6Cu, 0x00000B6Eu, 0x00000B6Eu, 0x00000F72u, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000FD2u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000A80u,
+    0x00000FD8u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000FE2u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu,
+    0x00000FFCu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x0000100Au, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00001014u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000B6Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x0000101Eu, 0x00001030u, 0x00001036u, 0x00001040u, 0x0000104Eu,
+    0x00000000u, 0x00001054u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00001062u, 0x0000108Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00001096u, 0x000010A8u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000A80u, 0x00000000u, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000B6Eu, 0x00000000u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000000u, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000000u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000B6Eu, 0x00000000u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000A80u, 0x00000000u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000000u, 0x00000B6Eu, 0x00000B6Eu,
+    0x00000B6Eu, 0x000010AEu, 0x00000B6Eu, 0x00000B6Eu, 0x00000BA4u, 0x00000B6Eu, 0x00000B6Eu, 0x00000000u,
+    0x00000B6Eu, 0x00000B6Eu, 0x00000BA4u, 0x00000B6Eu, 0x00000B6Eu, 0x00000000u, 0x00000B6Eu, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000A80u, 0x00000000u, 0x00000B6Eu, 0x00000B72u, 0x00000B6Eu,
+    0x000010B4u, 0x00000B82u, 0x00000B8Au, 0x00000B6Eu, 0x000010BAu, 0x00000B6Eu, 0x00000B6Eu, 0x000010CCu,
+    0x00000B8Au, 0x00000B6Eu, 0x00001128u, 0x00000C00u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000C10u,
+    0x00000000u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000A80u, 0x0000112Eu,
+    0x00000B6Eu, 0x00000B72u, 0x00000B6Eu, 0x00001140u, 0x00000B82u, 0x00000B8Au, 0x00000B6Eu, 0x0000115Eu,
+    0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B8Au, 0x00000DACu, 0x00001170u, 0x00000C00u, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000B6Eu, 0x00000C10u, 0x0000117Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000A80u, 0x00001184u, 0x00000B6Eu, 0x00000B72u, 0x00000B6Eu, 0x00001192u, 0x00000B82u,
+    0x00000B8Au, 0x00000B6Eu, 0x00000000u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B8Au, 0x00000B6Eu,
+    0x000011A8u, 0x00000C00u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x000011B2u, 0x00000000u, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000A80u, 0x000011C2u, 0x00000000u, 0x000011C8u,
+    0x00000000u, 0x000011CEu, 0x00000000u, 0x00000000u, 0x00000000u, 0x000011D8u, 0x00000000u, 0x00000000u,
+    0x000011E2u, 0x000011F0u, 0x000011F6u, 0x00001204u, 0x0000120Au, 0x00000000u, 0x00001210u, 0x0000121Au,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000122Cu, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000A80u,
+    0x00001232u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00001240u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu,
+    0x00001252u, 0x00000B6Eu, 0x00000B6Eu, 0x00001260u, 0x00000B6Eu, 0x00000DACu, 0x000012C4u, 0x00000B6Eu,
+    0x00000B6Eu, 0x000012D2u, 0x00001332u, 0x0000133Eu, 0x0000134Au, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000B6Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000A80u, 0x00000000u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000000u,
+    0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000000u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000000u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00001350u,
+    0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000A80u, 0x0000135Au, 0x00000B6Eu,
+    0x00000B72u, 0x00000B6Eu, 0x00001368u, 0x00000B82u, 0x00000B8Au, 0x00000B6Eu, 0x00000000u, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000B6Eu, 0x00001372u, 0x00000B6Eu, 0x0000137Eu, 0x00000C00u, 0x00000B6Eu, 0x00000BA4u,
+    0x00000B6Eu, 0x00000C10u, 0x00000000u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000A80u, 0x00001384u, 0x00000B6Eu, 0x00000B72u, 0x00000B6Eu, 0x00001396u, 0x00000B82u, 0x00000B8Au,
+    0x00000B6Eu, 0x00000000u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B8Au, 0x00000B6Eu, 0x000013A8u,
+    0x000013B2u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x000013C6u, 0x000013E2u, 0x00000B6Eu, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000A80u, 0x000013F0u, 0x00000B6Eu, 0x00000B72u, 0x00000B6Eu,
+    0x000013F6u, 0x00000B82u, 0x00000B8Au, 0x00000B6Eu, 0x00001408u, 0x00000B6Eu, 0x00000B6Eu, 0x0000140Eu,
+    0x00000B8Au, 0x00000B6Eu, 0x00001412u, 0x00000C00u, 0x00000B6Eu, 0x00001418u, 0x0000147Cu, 0x00000C10u,
+    0x00001484u, 0x00000B6Eu, 0x00000B6Eu, 0x0000140Eu, 0x00000B6Eu, 0x0000148Au, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00001496u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x0000149Cu, 0x00000000u, 0x000014A2u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x000014A8u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000A80u, 0x00000000u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000000u, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000B6Eu, 0x000014AEu, 0x00000B6Eu, 0x00000B6Eu, 0x00000BA4u, 0x00000B6Eu, 0x00000B6Eu,
+    0x00000000u, 0x00000B6Eu, 0x00000B6Eu, 0x00000BA4u, 0x00000B6Eu, 0x00000B6Eu, 0x00000000u, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000A80u, 0x000014B8u, 0x00000B6Eu, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000000u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000000u, 0x00000B6Eu, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000000u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000000u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000A80u,
+    0x00000000u, 0x00000B6Eu, 0x00000B72u, 0x00000B6Eu, 0x000014BEu, 0x00000B82u, 0x00000B8Au, 0x00000B6Eu,
+    0x000010AEu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B8Au, 0x00000B6Eu, 0x00000000u, 0x00000C00u,
+    0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000C10u, 0x00000000u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000B6Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000A80u, 0x00000000u, 0x00000B6Eu, 0x00000B72u, 0x00000B6Eu, 0x00000000u,
+    0x00000B82u, 0x00000B8Au, 0x00000B6Eu, 0x00000000u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B8Au,
+    0x00000B6Eu, 0x00000000u, 0x00000C00u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000C10u, 0x00000000u,
+    0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000A80u, 0x00000000u, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000B6Eu, 0x00000000u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000000u, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x000014C8u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu,
+    0x00000B6Eu, 0x00000B6Eu, 0x00000000u, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu, 0x00000B6Eu,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x000014CEu, 0x000014ECu, 0x00001506u,
+    0x00001524u, 0x0000152Cu, 0x00000000u, 0x00000000u,
+};
+
+constexpr uint8_t es_trie_nodes[] = {
+    0x00, 0x00, 0x18, 0x00, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C,
+    0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xEE, 0x09, 0x00, 0x02,
+    0x0A, 0x00, 0x0A, 0x0A, 0x00, 0x16, 0x0A, 0x00, 0x22, 0x0A, 0x00, 0x2C, 0x0A, 0x00, 0x2C, 0x0A,
+    0x00, 0x30, 0x0A, 0x00, 0x3A, 0x0A, 0x00, 0x2C, 0x0A, 0x00, 0x2C, 0x0A, 0x00, 0x2C, 0x0A, 0x00,
+    0x40, 0x0A, 0x00, 0x2C, 0x0A, 0x00, 0x4C, 0x0A, 0x00, 0x2C, 0x0A, 0x00, 0x5C, 0x0A, 0x00, 0x64,
+    0x0A, 0x00, 0x74, 0x0A, 0x00, 0x2C, 0x0A, 0x00, 0x2C, 0x0A, 0x00, 0x2C, 0x0A, 0x00, 0x2C, 0x0A,
+    0x00, 0x2C, 0x0A, 0x00, 0x13, 0x00, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6C,
+    0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0xC3, 0x80, 0x0A, 0x00, 0x84, 0x0A, 0x00, 0x8E,
+    0x0A, 0x00, 0x94, 0x0A, 0x00, 0xA2, 0x0A, 0x00, 0xC4, 0x0A, 0x00, 0xCA, 0x0A, 0x00, 0xC4, 0x0A,
+    0x00, 0xD4, 0x0A, 0x00, 0xDA, 0x0A, 0x00, 0xE4, 0x0A, 0x00, 0xF2, 0x0A, 0x00, 0x08, 0x0B, 0x00,
+    0x0E, 0x0B, 0x00, 0x14, 0x0B, 0x00, 0x46, 0x0B, 0x00, 0x54, 0x0B, 0x00, 0x5A, 0x0B, 0x00, 0x68,
+    0x0B, 0x00, 0x18, 0x01, 0x78, 0x00, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B,
+    0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x80, 0x0A,
+    0x00, 0x6E, 0x0B, 0x00, 0x72, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x82, 0x0B, 0x00, 0x8A, 0x0B, 0x00,
+    0x6E, 0x0B, 0x00, 0x92, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0xA4, 0x0B, 0x00, 0x8A,
+    0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x00, 0x0C, 0x00, 0x6E, 0x0B, 0x00, 0xA4, 0x0B, 0x00, 0x6E, 0x0B,
+    0x00, 0x10, 0x0C, 0x00, 0x1C, 0x0C, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00,
+    0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x1C, 0x01, 0x78, 0x00, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65,
+    0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x78, 0x79, 0x7A, 0xC3, 0x80, 0x0A, 0x00, 0x22, 0x0C, 0x00, 0x6E, 0x0B, 0x00, 0x72,
+    0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x30, 0x0C, 0x00, 0x82, 0x0B, 0x00, 0x8A, 0x0B, 0x00, 0x3A, 0x0C,
+    0x00, 0x96, 0x0C, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0xA8, 0x0C, 0x00, 0x8A, 0x0B, 0x00,
+    0x08, 0x0D, 0x00, 0x18, 0x0D, 0x00, 0x00, 0x0C, 0x00, 0x6E, 0x0B, 0x00, 0x2E, 0x0D, 0x00, 0x6E,
+    0x0B, 0x00, 0x92, 0x0D, 0x00, 0xA2, 0x0D, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B,
+    0x00, 0x6E, 0x0B, 0x00, 0xAC, 0x0D, 0x00, 0xB4, 0x0D, 0x00, 0x18, 0x01, 0x78, 0x00, 0x2E, 0x62,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73,
+    0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x80, 0x0A, 0x00, 0x6E, 0x0B, 0x00, 0x72, 0x0B, 0x00, 0x6E,
+    0x0B, 0x00, 0xBA, 0x0D, 0x00, 0x82, 0x0B, 0x00, 0x8A, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0xD0, 0x0D,
+    0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x8A, 0x0B, 0x00, 0x6E, 0x0B, 0x00,
+    0x00, 0x0C, 0x00, 0x6E, 0x0B, 0x00, 0xA4, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x10, 0x0C, 0x00, 0x6E,
+    0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x0F, 0x00,
+    0x2E, 0x61, 0x63, 0x64, 0x65, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x78, 0xC3, 0x80,
+    0x0A, 0x00, 0xD6, 0x0D, 0x00, 0xE4, 0x0D, 0x00, 0xF6, 0x0D, 0x00, 0x10, 0x0E, 0x00, 0x16, 0x0E,
+    0x00, 0x20, 0x0E, 0x00, 0x2E, 0x0E, 0x00, 0x44, 0x0E, 0x00, 0x52, 0x0E, 0x00, 0x80, 0x0E, 0x00,
+    0x8E, 0x0E, 0x00, 0x94, 0x0E, 0x00, 0x9E, 0x0E, 0x00, 0xC0, 0x0E, 0x00, 0x1A, 0x01, 0x78, 0x00,
+    0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x80, 0x0A, 0x00, 0xC6, 0x0E, 0x00,
+    0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0xCC, 0x0E, 0x00, 0x6E, 0x0B, 0x00, 0x6E,
+    0x0B, 0x00, 0x6E, 0x0B, 0x00, 0xD6, 0x0E, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0xA4, 0x0B,
+    0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0xE4, 0x0E, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00,
+    0xA4, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0xAC, 0x0D, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E,
+    0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x1B, 0x01, 0x78, 0x00, 0x2E, 0x61, 0x62, 0x63,
+    0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73,
+    0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x80, 0x0A, 0x00, 0xEE, 0x0E, 0x00, 0x6E, 0x0B, 0x00,
+    0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0xF8, 0x0E, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E,
+    0x0B, 0x00, 0x02, 0x0F, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x0C, 0x0F, 0x00, 0x6E, 0x0B,
+    0x00, 0xAC, 0x0D, 0x00, 0x6C, 0x0F, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x72, 0x0F, 0x00,
+    0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0xD2, 0x0F, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E,
+    0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x1B, 0x00, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65,
+    0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x78, 0x79, 0x7A, 0x80, 0x0A, 0x00, 0xD8, 0x0F, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B,
+    0x00, 0x6E, 0x0B, 0x00, 0xE2, 0x0F, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00,
+    0xFC, 0x0F, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E,
+    0x0B, 0x00, 0x0A, 0x10, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B,
+    0x00, 0x6E, 0x0B, 0x00, 0x14, 0x10, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00,
+    0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x0A, 0x00, 0x61, 0x62, 0x63, 0x64, 0x65, 0x67, 0x6E, 0x6F,
+    0x73, 0x74, 0x1E, 0x10, 0x00, 0x30, 0x10, 0x00, 0x36, 0x10, 0x00, 0x40, 0x10, 0x00, 0x4E, 0x10,
+    0x00, 0x54, 0x10, 0x00, 0x62, 0x10, 0x00, 0x8C, 0x10, 0x00, 0x96, 0x10, 0x00, 0xA8, 0x10, 0x00,
+    0x16, 0x01, 0x78, 0x00, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x80, 0x0A, 0x00, 0x6E, 0x0B, 0x00,
+    0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E,
+    0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B,
+    0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00,
+    0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x17, 0x01, 0x78, 0x00,
+    0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72,
+    0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x80, 0x0A, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00,
+    0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0xAE, 0x10, 0x00, 0x6E,
+    0x0B, 0x00, 0x6E, 0x0B, 0x00, 0xA4, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B,
+    0x00, 0x6E, 0x0B, 0x00, 0xA4, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00,
+    0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x19, 0x01, 0x78, 0x00,
+    0x2E, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+    0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x80, 0x0A, 0x00, 0x6E, 0x0B, 0x00, 0x72,
+    0x0B, 0x00, 0x6E, 0x0B, 0x00, 0xB4, 0x10, 0x00, 0x82, 0x0B, 0x00, 0x8A, 0x0B, 0x00, 0x6E, 0x0B,
+    0x00, 0xBA, 0x10, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0xCC, 0x10, 0x00, 0x8A, 0x0B, 0x00,
+    0x6E, 0x0B, 0x00, 0x28, 0x11, 0x00, 0x00, 0x0C, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E,
+    0x0B, 0x00, 0x10, 0x0C, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B,
+    0x00, 0x6E, 0x0B, 0x00, 0x1B, 0x01, 0x78, 0x00, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x7A, 0x80, 0x0A, 0x00, 0x2E, 0x11, 0x00, 0x6E, 0x0B, 0x00, 0x72, 0x0B, 0x00, 0x6E,
+    0x0B, 0x00, 0x40, 0x11, 0x00, 0x82, 0x0B, 0x00, 0x8A, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x5E, 0x11,
+    0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x8A, 0x0B, 0x00, 0xAC, 0x0D, 0x00,
+    0x70, 0x11, 0x00, 0x00, 0x0C, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x10,
+    0x0C, 0x00, 0x7E, 0x11, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B,
+    0x00, 0x6E, 0x0B, 0x00, 0x19, 0x01, 0x78, 0x00, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79,
+    0x7A, 0x80, 0x0A, 0x00, 0x84, 0x11, 0x00, 0x6E, 0x0B, 0x00, 0x72, 0x0B, 0x00, 0x6E, 0x0B, 0x00,
+    0x92, 0x11, 0x00, 0x82, 0x0B, 0x00, 0x8A, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E,
+    0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x8A, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0xA8, 0x11, 0x00, 0x00, 0x0C,
+    0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0xB2, 0x11, 0x00, 0x6E, 0x0B, 0x00,
+    0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x0D, 0x00, 0x2E, 0x61,
+    0x63, 0x65, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x78, 0x80, 0x0A, 0x00, 0xC2, 0x11,
+    0x00, 0xC8, 0x11, 0x00, 0xCE, 0x11, 0x00, 0xD8, 0x11, 0x00, 0xE2, 0x11, 0x00, 0xF0, 0x11, 0x00,
+    0xF6, 0x11, 0x00, 0x04, 0x12, 0x00, 0x0A, 0x12, 0x00, 0x10, 0x12, 0x00, 0x1A, 0x12, 0x00, 0x2C,
+    0x12, 0x00, 0x1B, 0x01, 0x78, 0x00, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+    0x7A, 0x80, 0x0A, 0x00, 0x32, 0x12, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00,
+    0x40, 0x12, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x52, 0x12, 0x00, 0x6E,
+    0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x60, 0x12, 0x00, 0x6E, 0x0B, 0x00, 0xAC, 0x0D, 0x00, 0xC4, 0x12,
+    0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0xD2, 0x12, 0x00, 0x32, 0x13, 0x00, 0x3E, 0x13, 0x00,
+    0x4A, 0x13, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E,
+    0x0B, 0x00, 0x17, 0x01, 0x78, 0x00, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C,
+    0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x80, 0x0A, 0x00,
+    0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E,
+    0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B,
+    0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00,
+    0x50, 0x13, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E,
+    0x0B, 0x00, 0x19, 0x01, 0x78, 0x00, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x6A,
+    0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x80,
+    0x0A, 0x00, 0x5A, 0x13, 0x00, 0x6E, 0x0B, 0x00, 0x72, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x68, 0x13,
+    0x00, 0x82, 0x0B, 0x00, 0x8A, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00,
+    0x6E, 0x0B, 0x00, 0x72, 0x13, 0x00, 0x6E, 0x0B, 0x00, 0x7E, 0x13, 0x00, 0x00, 0x0C, 0x00, 0x6E,
+    0x0B, 0x00, 0xA4, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x10, 0x0C, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B,
+    0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x1A, 0x01, 0x78, 0x00, 0x2E, 0x61,
+    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x80, 0x0A, 0x00, 0x84, 0x13, 0x00, 0x6E, 0x0B,
+    0x00, 0x72, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x96, 0x13, 0x00, 0x82, 0x0B, 0x00, 0x8A, 0x0B, 0x00,
+    0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x8A, 0x0B, 0x00, 0x6E,
+    0x0B, 0x00, 0xA8, 0x13, 0x00, 0xB2, 0x13, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B,
+    0x00, 0xC6, 0x13, 0x00, 0xE2, 0x13, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00,
+    0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x1C, 0x01, 0x78, 0x00, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65,
+    0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x78, 0x79, 0x7A, 0xC3, 0x80, 0x0A, 0x00, 0xF0, 0x13, 0x00, 0x6E, 0x0B, 0x00, 0x72,
+    0x0B, 0x00, 0x6E, 0x0B, 0x00, 0xF6, 0x13, 0x00, 0x82, 0x0B, 0x00, 0x8A, 0x0B, 0x00, 0x6E, 0x0B,
+    0x00, 0x08, 0x14, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x0E, 0x14, 0x00, 0x8A, 0x0B, 0x00,
+    0x6E, 0x0B, 0x00, 0x12, 0x14, 0x00, 0x00, 0x0C, 0x00, 0x6E, 0x0B, 0x00, 0x18, 0x14, 0x00, 0x7C,
+    0x14, 0x00, 0x10, 0x0C, 0x00, 0x84, 0x14, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x0E, 0x14,
+    0x00, 0x6E, 0x0B, 0x00, 0x8A, 0x14, 0x00, 0x96, 0x14, 0x00, 0x03, 0x00, 0x6C, 0x6E, 0x74, 0x9C,
+    0x14, 0x00, 0xA2, 0x14, 0x00, 0xA8, 0x14, 0x00, 0x17, 0x01, 0x78, 0x00, 0x2E, 0x62, 0x63, 0x64,
+    0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77,
+    0x78, 0x79, 0x7A, 0x80, 0x0A, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E,
+    0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0xAE, 0x14, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B,
+    0x00, 0xA4, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00,
+    0xA4, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E,
+    0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x17, 0x01, 0x78, 0x00, 0x2E, 0x61, 0x62, 0x63,
     0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77,
-    0x78, 0x79, 0x7A, 0x61, 0x75, 0xE1, 0x3F, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1,
-    0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1,
-    0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1,
-    0x6B, 0xFF, 0xF9, 0xFF, 0xFC, 0x41, 0x70, 0xE2, 0xB2, 0x42, 0x6D, 0x74, 0xFF, 0xFC, 0xEC, 0xBA,
-    0xD7, 0x00, 0x91, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70,
-    0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x6F, 0xE0, 0xE9, 0xE1, 0x15, 0xE1, 0x15,
-    0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15,
-    0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15,
-    0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xFF, 0xF9, 0x42, 0x61, 0x6F, 0xF1, 0x95, 0xF1, 0x95, 0x21,
-    0x74, 0xF9, 0x41, 0x61, 0xF4, 0x4F, 0x21, 0x69, 0xFC, 0x21, 0x6D, 0xFD, 0xA0, 0x10, 0x92, 0x21,
-    0x65, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0xA0, 0x10, 0xB2, 0x21, 0x72, 0xFD, 0x21, 0x64,
-    0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x6F, 0xFD, 0x23, 0x65, 0x61, 0x70, 0xE2, 0xEE, 0xFD, 0x44, 0x64,
-    0x72, 0x6E, 0x74, 0xF1, 0x7E, 0xFF, 0xF9, 0xF1, 0x42, 0xF9, 0xFB, 0x41, 0x6E, 0xEB, 0x6F, 0x21,
-    0x6F, 0xFC, 0x21, 0x65, 0xFD, 0x21, 0x74, 0xFD, 0x41, 0x65, 0xEC, 0x1B, 0xA0, 0x06, 0x31, 0x41,
-    0xB1, 0xE1, 0xF2, 0x21, 0xC3, 0xFC, 0x22, 0x2E, 0x65, 0xF6, 0xFD, 0xA1, 0x04, 0xA2, 0x73, 0xFB,
-    0x41, 0x61, 0xE6, 0x3D, 0x21, 0x74, 0xFC, 0x21, 0x61, 0xFD, 0xA1, 0x04, 0xA2, 0x6C, 0xFD, 0x41,
-    0x6F, 0xE6, 0x2E, 0xA1, 0x04, 0xC2, 0x73, 0xFC, 0x45, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xE4, 0x2E,
-    0xE4, 0x2E, 0xFF, 0xFB, 0xE4, 0x2E, 0xE4, 0x2E, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3,
-    0xE3, 0xDF, 0xE4, 0x1B, 0xE4, 0x1B, 0xFF, 0xD3, 0xE4, 0x1B, 0xFF, 0xE2, 0xFF, 0xF0, 0x21, 0x61,
-    0xEA, 0x23, 0x6E, 0x6C, 0x72, 0xA4, 0xA7, 0xFD, 0x41, 0x7A, 0xEB, 0xBB, 0x43, 0x63, 0x65, 0x72,
-    0xF1, 0x9A, 0xFF, 0xFC, 0xF1, 0x9A, 0x42, 0x71, 0x63, 0xE5, 0xE7, 0xFF, 0xAA, 0x41, 0x65, 0xFF,
-    0xA3, 0x42, 0x64, 0x74, 0xFD, 0x3A, 0xFF, 0xFC, 0xA2, 0x04, 0xA2, 0x72, 0x6E, 0xEE, 0xF9, 0x41,
-    0x65, 0xFD, 0x36, 0x21, 0x69, 0xFC, 0xA1, 0x04, 0xA2, 0x6D, 0xFD, 0xC1, 0x04, 0xA2, 0x72, 0xE1,
-    0x66, 0x41, 0x71, 0xE5, 0xBC, 0xA1, 0x04, 0xC2, 0x72, 0xFC, 0x41, 0x65, 0xE5, 0xB3, 0x21, 0x74,
-    0xFC, 0xA1, 0x04, 0xC2, 0x73, 0xFD, 0x45, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFF, 0xEF, 0xFF, 0xFB,
-    0xE3, 0xB0, 0xE3, 0xB0, 0xE3, 0xB0, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xE3, 0x61,
-    0xFF, 0xC2, 0xE3, 0x9D, 0xE3, 0x9D, 0xFF, 0xD0, 0xFF, 0xD5, 0xFF, 0xF0, 0x21, 0x69, 0xEA, 0x41,
-    0x6F, 0xEA, 0x8B, 0xA1, 0x04, 0x52, 0x72, 0xFC, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3,
-    0xE0, 0x80, 0xE0, 0x83, 0xFF, 0xFB, 0xE0, 0x83, 0xE0, 0x83, 0xE0, 0x83, 0xE0, 0x89, 0x21, 0x61,
-    0xEA, 0x21, 0x74, 0xFD, 0x41, 0x72, 0xFC, 0x7C, 0x21, 0x70, 0xFC, 0x41, 0x64, 0xFC, 0x75, 0x22,
-    0x6D, 0x6E, 0xF9, 0xFC, 0xA0, 0x0E, 0x13, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x70, 0xFD,
-    0xA0, 0x0E, 0x43, 0x21, 0x74, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x74, 0xD8, 0x22,
-    0x6C, 0x73, 0xFA, 0xFD, 0x41, 0x2E, 0xE1, 0x38, 0x42, 0x2E, 0x73, 0xE1, 0x34, 0xFF, 0xFC, 0x42,
-    0x61, 0x73, 0xFF, 0xF9, 0xE1, 0xD0, 0x24, 0x69, 0x6F, 0x65, 0x74, 0xC9, 0xD7, 0xE9, 0xF9, 0x43,
-    0x6C, 0x72, 0x73, 0xFF, 0x8D, 0xFF, 0xB2, 0xFF, 0xF7, 0xDB, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64,
-    0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6D, 0x6E, 0x70, 0x71, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A,
-    0x6C, 0x72, 0x75, 0x65, 0x61, 0x69, 0x6F, 0xDF, 0x00, 0xDF, 0x03, 0xDF, 0x03, 0xDF, 0x03, 0xDF,
-    0x03, 0xDF, 0x03, 0xDF, 0x03, 0xDF, 0x03, 0xDF, 0x03, 0xDF, 0x03, 0xEE, 0xD9, 0xDF, 0x03, 0xDF,
-    0x03, 0xFD, 0xA1, 0xFD, 0xAA, 0xDF, 0x03, 0xDF, 0x03, 0xDF, 0x03, 0xDF, 0x03, 0xDF, 0x03, 0xFD,
-    0xC1, 0xFE, 0x17, 0xFE, 0x66, 0xFE, 0x95, 0xFF, 0x08, 0xFF, 0x13, 0xFF, 0xF6, 0x42, 0x6D, 0x72,
-    0xDF, 0x3C, 0xEA, 0x76, 0x42, 0x65, 0x69, 0xFC, 0xC6, 0xFF, 0xF9, 0xD7, 0x00, 0x41, 0x2E, 0x62,
-    0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76,
-    0x77, 0x78, 0x79, 0x7A, 0x75, 0xDE, 0x9E, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE,
-    0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE,
-    0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE,
-    0xA1, 0xFF, 0xF9, 0xC2, 0x00, 0x71, 0x6E, 0x61, 0xDE, 0x5C, 0xEE, 0xD0, 0x41, 0xA1, 0xF0, 0xDB,
-    0x43, 0x61, 0xC3, 0x65, 0xF0, 0xD7, 0xFF, 0xFC, 0xF0, 0xD7, 0x21, 0x69, 0xF6, 0x21, 0x63, 0xFD,
-    0xA0, 0x0A, 0x72, 0x21, 0x61, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0xAD, 0xFD, 0x22,
-    0x69, 0xC3, 0xEE, 0xFD, 0x21, 0x6E, 0xFB, 0x42, 0x65, 0x72, 0xE2, 0x3D, 0xE9, 0xEC, 0x22, 0x69,
-    0x74, 0xF6, 0xF9, 0xA0, 0x0B, 0xB1, 0x23, 0xA1, 0xA9, 0xAD, 0xFD, 0xFD, 0xFD, 0x24, 0x61, 0xC3,
-    0x65, 0x6F, 0xF6, 0xF9, 0xF6, 0xF6, 0x43, 0x64, 0x6E, 0x72, 0xF5, 0xFA, 0xED, 0xB7, 0xFF, 0xF7,
-    0x41, 0x6D, 0xEF, 0xA6, 0xD9, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B,
-    0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x72, 0x65, 0x61, 0x6F,
-    0xDD, 0xF5, 0xDD, 0xF8, 0xDD, 0xFE, 0xDD, 0xF8, 0xDE, 0x07, 0xDE, 0x0C, 0xDD, 0xF8, 0xDD, 0xF8,
-    0xDD, 0xF8, 0xDD, 0xF8, 0xFF, 0x9F, 0xDD, 0xF8, 0xDE, 0x11, 0xDD, 0xF8, 0xDD, 0xF8, 0xDE, 0x1A,
-    0xDD, 0xF8, 0xDD, 0xF8, 0xDD, 0xF8, 0xDD, 0xF8, 0xDD, 0xF8, 0xDE, 0x24, 0xFF, 0xDA, 0xFF, 0xF2,
-    0xFF, 0xFC, 0xC4, 0x00, 0x71, 0x74, 0x73, 0x6E, 0x61, 0xDD, 0xAD, 0xDD, 0xAD, 0xDD, 0xAD, 0xEE,
-    0x21, 0xA0, 0x00, 0xD1, 0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73, 0xFA, 0xFD, 0xA0, 0x03, 0x02, 0x21,
-    0x2E, 0xFD, 0x21, 0x73, 0xFD, 0x22, 0x2E, 0x65, 0xEC, 0xFD, 0x21, 0x6C, 0xFB, 0x22, 0x2E, 0x73,
-    0xEF, 0xF2, 0x21, 0x6E, 0xED, 0x21, 0xB3, 0xFD, 0x21, 0x65, 0xEA, 0x21, 0x6E, 0xFD, 0x23, 0x61,
-    0xC3, 0x6F, 0xEF, 0xF7, 0xFD, 0x21, 0x6C, 0xF9, 0x21, 0x6C, 0xFD, 0x21, 0x73, 0xC9, 0x23, 0x2E,
-    0x61, 0x65, 0xC3, 0xC9, 0xFD, 0x21, 0x72, 0xF9, 0xC6, 0x00, 0x71, 0x7A, 0x73, 0x65, 0x61, 0x69,
-    0x6F, 0xDD, 0x57, 0xDD, 0x57, 0xFF, 0xBF, 0xFF, 0xD2, 0xFF, 0xF0, 0xFF, 0xFD, 0x41, 0x74, 0xDF,
-    0xF2, 0x21, 0x63, 0xFC, 0x41, 0x76, 0xDE, 0x67, 0x44, 0x6E, 0x2E, 0x73, 0x6C, 0xFF, 0xF9, 0xF5,
-    0xEC, 0xF5, 0xEF, 0xFF, 0xFC, 0x41, 0x65, 0xFA, 0x22, 0x41, 0x76, 0xE8, 0xEA, 0xA0, 0x0E, 0xD2,
-    0xA0, 0x0E, 0xF3, 0xA0, 0x0F, 0x23, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0x27, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xEC, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF5,
-    0x21, 0x6F, 0xF1, 0x21, 0x64, 0xFD, 0x44, 0x6C, 0x6D, 0x72, 0x75, 0xFF, 0xCF, 0xFA, 0x44, 0xFF,
-    0xD3, 0xFF, 0xFD, 0xA0, 0x0F, 0x52, 0xA1, 0x0F, 0x52, 0x73, 0xFD, 0x21, 0x61, 0xFB, 0xA1, 0x04,
-    0x52, 0x73, 0xFD, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xDD, 0xE5, 0xFF, 0xFB, 0xDD,
-    0xE8, 0xDD, 0xE8, 0xDD, 0xE8, 0xDD, 0xE8, 0xDD, 0xEE, 0x21, 0x65, 0xEA, 0x21, 0x72, 0xFD, 0x42,
-    0x62, 0x63, 0xFF, 0xFD, 0xF4, 0xB1, 0xA0, 0x0F, 0xF3, 0xA1, 0x06, 0xF3, 0x72, 0xFD, 0x41, 0x72,
-    0xF9, 0xC6, 0xA1, 0x06, 0xF3, 0x6F, 0xFC, 0xA0, 0x10, 0x23, 0x41, 0x2E, 0xF7, 0x64, 0x42, 0x2E,
-    0x73, 0xF7, 0x60, 0xFF, 0xFC, 0x21, 0x74, 0xF9, 0x21, 0x69, 0xFD, 0xA2, 0x07, 0x23, 0x72, 0x76,
-    0xEC, 0xFD, 0x45, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFF, 0xF9, 0xEE, 0x03, 0xEE, 0x03, 0xEE, 0x03,
-    0xEE, 0x03, 0x48, 0x72, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xE1, 0x50, 0xE1, 0x27, 0xFF,
-    0xC7, 0xED, 0xF0, 0xFF, 0xD0, 0xED, 0xF0, 0xED, 0xF0, 0xFF, 0xF0, 0x21, 0x72, 0xE7, 0xC7, 0x07,
-    0xB1, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xDD, 0x6A, 0xDD, 0x6D, 0xDD, 0x6D, 0xDD, 0x6D,
-    0xDD, 0x6D, 0xDD, 0x6D, 0xDD, 0x73, 0x21, 0x61, 0xE8, 0x22, 0x65, 0x72, 0xE2, 0xFD, 0xA0, 0x11,
-    0x43, 0x21, 0x6E, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x72, 0xFD,
-    0x21, 0x65, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0x61, 0xFD, 0x23, 0x70, 0x64, 0x72, 0xE0, 0xFD, 0xFD,
-    0xDA, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70,
-    0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x61, 0x65, 0x6F, 0x75, 0xDC, 0x19, 0xDC,
-    0x1C, 0xDC, 0x22, 0xDC, 0x1C, 0xDC, 0x2B, 0xDC, 0x30, 0xDC, 0x1C, 0xDC, 0x1C, 0xDC, 0x1C, 0xDC,
-    0x1C, 0xDC, 0x30, 0xDC, 0x1C, 0xFE, 0x72, 0xDC, 0x1C, 0xDC, 0x1C, 0xDC, 0x1C, 0xFE, 0xC8, 0xDC,
-    0x1C, 0xDC, 0x1C, 0xDC, 0x1C, 0xDC, 0x1C, 0xDC, 0x1C, 0xFE, 0xE8, 0xFF, 0x26, 0xFF, 0x5F, 0xFF,
-    0xF9, 0x41, 0x65, 0xE1, 0x23, 0x41, 0x6E, 0xDF, 0x92, 0x21, 0x69, 0xFC, 0x22, 0x74, 0x64, 0xF5,
-    0xFD, 0x41, 0x6C, 0xDF, 0x86, 0x21, 0x65, 0xFC, 0x21, 0x75, 0xFD, 0x41, 0x62, 0xDF, 0x7C, 0x21,
-    0x6F, 0xFC, 0x41, 0x72, 0xDF, 0x75, 0x21, 0x61, 0xFC, 0x43, 0x63, 0x70, 0x74, 0xFF, 0xF6, 0xDF,
-    0x6E, 0xFF, 0xFD, 0x41, 0xA1, 0xDF, 0x8F, 0x21, 0xC3, 0xFC, 0x21, 0x6C, 0xFD, 0x24, 0x6E, 0x62,
-    0x6C, 0x74, 0xCF, 0xDB, 0xEC, 0xFD, 0x21, 0xA1, 0xBF, 0x21, 0xC3, 0xFD, 0x21, 0x65, 0xFD, 0x21,
-    0x63, 0xFD, 0x41, 0x2E, 0xE4, 0xB3, 0x42, 0x2E, 0x73, 0xE4, 0xAF, 0xFF, 0xFC, 0x22, 0x6F, 0x61,
-    0xF9, 0xF9, 0x21, 0x72, 0xFB, 0x23, 0x61, 0x6F, 0x65, 0xD8, 0xEA, 0xFD, 0x41, 0x73, 0xDE, 0x49,
-    0x21, 0x61, 0xFC, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0x41, 0x64, 0xE0, 0x00, 0x41, 0x6C, 0xDF,
-    0xFC, 0x41, 0x69, 0xE9, 0x65, 0x42, 0x63, 0x74, 0xDF, 0xF7, 0xFF, 0xFC, 0xA4, 0x0E, 0xB2, 0x6D,
-    0x6E, 0x74, 0x63, 0xEA, 0xED, 0xF1, 0xF9, 0x41, 0xBA, 0xE4, 0x87, 0x41, 0x75, 0xDF, 0xE5, 0xA2,
-    0x0E, 0xB2, 0xC3, 0x78, 0xF8, 0xFC, 0x41, 0x6E, 0xDF, 0xDA, 0x21, 0x61, 0xFC, 0x21, 0x69, 0xFD,
-    0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0xB3, 0xF0, 0x22, 0x6F, 0xC3, 0xED, 0xFD, 0x21, 0x69,
-    0xFB, 0x41, 0x2E, 0xDB, 0x9E, 0x42, 0x2E, 0x73, 0xDB, 0x9A, 0xFF, 0xFC, 0x22, 0x6F, 0x61, 0xF9,
-    0xF9, 0x41, 0xAD, 0xDF, 0xAF, 0x43, 0x69, 0xC3, 0x65, 0xDF, 0xAB, 0xFF, 0xFC, 0xDF, 0xAB, 0x41,
-    0xA1, 0xDF, 0xA1, 0x43, 0x61, 0xC3, 0x6F, 0xDF, 0x9D, 0xFF, 0xFC, 0xDF, 0x9D, 0x41, 0x61, 0xE4,
-    0x31, 0x21, 0x76, 0xFC, 0x41, 0x74, 0xDD, 0x80, 0x41, 0x69, 0xDF, 0x88, 0xA1, 0x0E, 0x92, 0x72,
-    0xFC, 0x41, 0x76, 0xDF, 0x7F, 0x45, 0x61, 0xC3, 0x65, 0x6F, 0x69, 0xDF, 0x7B, 0xDF, 0xF0, 0xDF,
-    0x7B, 0xFF, 0xF7, 0xFF, 0xFC, 0xC8, 0x0E, 0xB2, 0x62, 0x63, 0x64, 0x67, 0x6A, 0x6C, 0x73, 0x74,
-    0xFF, 0x9E, 0xFF, 0xA9, 0xFF, 0xB7, 0xFF, 0xC0, 0xFF, 0xCE, 0xFF, 0xDC, 0xFF, 0xDF, 0xFF, 0xF0,
-    0x41, 0x65, 0xDF, 0x49, 0x41, 0x69, 0xDD, 0x81, 0x21, 0x63, 0xFC, 0x21, 0x61, 0xFD, 0xA2, 0x0E,
-    0xB2, 0x63, 0x72, 0xF2, 0xFD, 0xC3, 0x0E, 0xB2, 0x72, 0x62, 0x73, 0xDF, 0x34, 0xE1, 0xB9, 0xE0,
-    0xFB, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xDF, 0x28, 0xFF, 0x3B, 0xFF, 0x4E, 0xFF,
-    0xC4, 0xFF, 0xED, 0xFF, 0xF4, 0xE5, 0xE3, 0x21, 0x73, 0xEA, 0x42, 0x73, 0x6E, 0xFE, 0xFB, 0xFF,
-    0xFD, 0x41, 0x70, 0xE6, 0x22, 0xD8, 0x00, 0x91, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A,
-    0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x61, 0x6F,
-    0xDA, 0x54, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80,
-    0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80,
-    0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xFF, 0xF5, 0xFF, 0xFC,
-    0x41, 0x68, 0xEC, 0xA2, 0x21, 0x63, 0xFC, 0xC2, 0x01, 0xF2, 0x2E, 0x73, 0xDA, 0x02, 0xFF, 0xFD,
-    0xC1, 0x01, 0xF2, 0x2E, 0xD9, 0xF9, 0xA0, 0x01, 0xF2, 0x42, 0x61, 0x72, 0xF6, 0xB8, 0xDB, 0x22,
-    0x41, 0x65, 0xDE, 0x04, 0x42, 0x61, 0x6D, 0xDE, 0x00, 0xE5, 0xAF, 0x44, 0x74, 0x6C, 0x63, 0x72,
-    0xFF, 0xEE, 0xFF, 0xF5, 0xEA, 0x58, 0xFF, 0xF9, 0x41, 0x75, 0xEC, 0x56, 0x41, 0x6F, 0xEC, 0x52,
-    0x22, 0x71, 0x63, 0xF8, 0xFC, 0x21, 0x6F, 0xFB, 0x41, 0x6C, 0xEA, 0x9C, 0x41, 0x70, 0xEB, 0x6A,
-    0x41, 0x62, 0xE5, 0x83, 0x21, 0x72, 0xFC, 0x41, 0x63, 0xDA, 0x91, 0x21, 0x69, 0xFC, 0x21, 0x6E,
-    0xFD, 0x21, 0x63, 0xFD, 0x21, 0xA9, 0xFD, 0xDC, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67,
-    0x68, 0x6A, 0x6B, 0x6D, 0x6E, 0x70, 0x71, 0x74, 0x76, 0x77, 0x79, 0x72, 0x7A, 0x73, 0x6C, 0x78,
-    0x65, 0x69, 0x61, 0x6F, 0x75, 0xC3, 0xD9, 0xA2, 0xD9, 0xA5, 0xD9, 0xAB, 0xD9, 0xA5, 0xD9, 0xB4,
-    0xD9, 0xB9, 0xD9, 0xA5, 0xD9, 0xA5, 0xD9, 0xA5, 0xD9, 0xB9, 0xD9, 0xA5, 0xD9, 0xBE, 0xD9, 0xA5,
-    0xD9, 0xC7, 0xD9, 0xA5, 0xD9, 0xA5, 0xD9, 0xA5, 0xFF, 0x4E, 0xFF, 0xA0, 0xFF, 0xA9, 0xFF, 0xAF,
-    0xFF, 0xAF, 0xFF, 0xC4, 0xFF, 0xDE, 0xFF, 0xE1, 0xFF, 0xE5, 0xFF, 0xED, 0xFF, 0xFD, 0x42, 0x63,
-    0x64, 0xFF, 0x62, 0xF8, 0xFA, 0xD7, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A,
-    0x6B, 0x6D, 0x6E, 0x70, 0x71, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x6C, 0x72, 0x69, 0xD9,
-    0x44, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9,
-    0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9,
-    0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x73, 0xD9, 0x73, 0xFF, 0xF9, 0x41, 0x73, 0xFE,
-    0xF3, 0xD7, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E,
-    0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x61, 0xD8, 0xF8, 0xD8, 0xFB, 0xD8,
-    0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8,
-    0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8,
-    0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xFF, 0xFC, 0x42, 0x6E, 0x72, 0xEA, 0x5D, 0xEA, 0x5D,
-    0xD8, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70,
-    0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x65, 0x69, 0xD8, 0xA9, 0xD8, 0xAC, 0xD8,
-    0xB2, 0xD8, 0xAC, 0xD8, 0xBB, 0xD8, 0xC0, 0xD8, 0xAC, 0xD8, 0xAC, 0xD8, 0xAC, 0xD8, 0xAC, 0xD8,
-    0xC0, 0xD8, 0xAC, 0xD8, 0xC5, 0xD8, 0xAC, 0xD8, 0xAC, 0xD8, 0xAC, 0xD8, 0xCE, 0xD8, 0xAC, 0xD8,
-    0xAC, 0xD8, 0xAC, 0xD8, 0xAC, 0xD8, 0xAC, 0xFF, 0xF9, 0xF4, 0x61, 0xD6, 0x00, 0x41, 0x2E, 0x62,
+    0x78, 0x79, 0x7A, 0x80, 0x0A, 0x00, 0xB8, 0x14, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E,
+    0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B,
+    0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00,
+    0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E,
+    0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x18, 0x01, 0x78, 0x00, 0x2E, 0x62, 0x63, 0x64,
+    0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76,
+    0x77, 0x78, 0x79, 0x7A, 0x80, 0x0A, 0x00, 0x6E, 0x0B, 0x00, 0x72, 0x0B, 0x00, 0x6E, 0x0B, 0x00,
+    0xBE, 0x14, 0x00, 0x82, 0x0B, 0x00, 0x8A, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0xAE, 0x10, 0x00, 0x6E,
+    0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x8A, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x00, 0x0C,
+    0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x10, 0x0C, 0x00, 0x6E, 0x0B, 0x00,
+    0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x16, 0x01, 0x78, 0x00,
+    0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73,
+    0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x80, 0x0A, 0x00, 0x6E, 0x0B, 0x00, 0x72, 0x0B, 0x00, 0x6E,
+    0x0B, 0x00, 0x82, 0x0B, 0x00, 0x8A, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B,
+    0x00, 0x6E, 0x0B, 0x00, 0x8A, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x00, 0x0C, 0x00, 0x6E, 0x0B, 0x00,
+    0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x10, 0x0C, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E,
+    0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x17, 0x01, 0x78, 0x00, 0x2E, 0x62, 0x63, 0x64,
+    0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77,
+    0x78, 0x79, 0x7A, 0x80, 0x0A, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E,
+    0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B,
+    0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0xC8, 0x14, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00,
+    0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E,
+    0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x05, 0x00, 0xA1, 0xA9, 0xAD, 0xB1, 0xB3, 0xCE,
+    0x14, 0x00, 0xEC, 0x14, 0x00, 0x06, 0x15, 0x00, 0x24, 0x15, 0x00, 0x2C, 0x15, 0x00, 0x04, 0x01,
+    0x25, 0x00, 0x62, 0x63, 0x6E, 0x74, 0x42, 0x15, 0x00, 0x48, 0x15, 0x00, 0x4E, 0x15, 0x00, 0x60,
+    0x15, 0x00, 0x01, 0x01, 0xE9, 0x00, 0x69, 0x66, 0x15, 0x00, 0x02, 0x01, 0xE9, 0x00, 0x61, 0x6F,
+    0x7C, 0x15, 0x00, 0x82, 0x15, 0x00, 0x02, 0x01, 0xE9, 0x00, 0x65, 0x69, 0xA4, 0x15, 0x00, 0xAE,
+    0x15, 0x00, 0x02, 0x00, 0x6E, 0x78, 0xB4, 0x15, 0x00, 0xD2, 0x15, 0x00, 0x00, 0x01, 0xE9, 0x00,
+    0x02, 0x00, 0x65, 0x75, 0xF0, 0x15, 0x00, 0xF6, 0x15, 0x00, 0x01, 0x00, 0x6E, 0xFC, 0x15, 0x00,
+    0x02, 0x01, 0xE9, 0x00, 0x61, 0x69, 0x1E, 0x16, 0x00, 0x24, 0x16, 0x00, 0x03, 0x01, 0xE9, 0x00,
+    0x61, 0x6F, 0x72, 0x2E, 0x16, 0x00, 0x34, 0x16, 0x00, 0x3A, 0x16, 0x00, 0x01, 0x01, 0xE9, 0x00,
+    0x65, 0x44, 0x16, 0x00, 0x03, 0x01, 0xE9, 0x00, 0x65, 0x6F, 0x75, 0x5E, 0x16, 0x00, 0x64, 0x16,
+    0x00, 0x6A, 0x16, 0x00, 0x02, 0x01, 0xE9, 0x00, 0x65, 0x72, 0x74, 0x16, 0x00, 0x7A, 0x16, 0x00,
+    0x00, 0x01, 0x11, 0x00, 0x02, 0x00, 0x65, 0xC3, 0x84, 0x16, 0x00, 0x88, 0x16, 0x00, 0x01, 0x00,
+    0x61, 0x8E, 0x16, 0x00, 0x03, 0x00, 0x61, 0x69, 0x74, 0xA0, 0x16, 0x00, 0xA6, 0x16, 0x00, 0xB0,
+    0x16, 0x00, 0x08, 0x00, 0x2E, 0x61, 0x65, 0x6C, 0x6D, 0x6E, 0x6F, 0x74, 0x80, 0x0A, 0x00, 0xB6,
+    0x16, 0x00, 0xC0, 0x16, 0x00, 0xC6, 0x16, 0x00, 0xD4, 0x16, 0x00, 0xDA, 0x16, 0x00, 0xE0, 0x16,
+    0x00, 0xD4, 0x16, 0x00, 0x01, 0x00, 0x72, 0xB0, 0x16, 0x00, 0x02, 0x00, 0x69, 0x72, 0xEE, 0x16,
+    0x00, 0xB0, 0x16, 0x00, 0x01, 0x00, 0x67, 0xF4, 0x16, 0x00, 0x02, 0x00, 0x2E, 0x65, 0x6E, 0x0B,
+    0x00, 0xFA, 0x16, 0x00, 0x03, 0x00, 0x65, 0x69, 0x6F, 0x00, 0x17, 0x00, 0x06, 0x17, 0x00, 0x0C,
+    0x17, 0x00, 0x05, 0x00, 0x2E, 0x64, 0x66, 0x67, 0x74, 0x80, 0x0A, 0x00, 0x12, 0x17, 0x00, 0x1C,
+    0x17, 0x00, 0x22, 0x17, 0x00, 0x28, 0x17, 0x00, 0x01, 0x00, 0x73, 0x2E, 0x17, 0x00, 0x01, 0x00,
+    0x69, 0x34, 0x17, 0x00, 0x0C, 0x00, 0x2E, 0x61, 0x63, 0x65, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x73,
+    0x74, 0xC3, 0x80, 0x0A, 0x00, 0x8E, 0x16, 0x00, 0x3A, 0x17, 0x00, 0x40, 0x17, 0x00, 0x56, 0x17,
+    0x00, 0x60, 0x17, 0x00, 0x6E, 0x17, 0x00, 0x74, 0x17, 0x00, 0x7A, 0x17, 0x00, 0x84, 0x17, 0x00,
+    0x84, 0x17, 0x00, 0x8A, 0x17, 0x00, 0x03, 0x00, 0x2E, 0x65, 0x74, 0x80, 0x0A, 0x00, 0x8E, 0x16,
+    0x00, 0x98, 0x17, 0x00, 0x01, 0x00, 0x65, 0x08, 0x0B, 0x00, 0x03, 0x00, 0x64, 0x73, 0x74, 0x9E,
+    0x17, 0x00, 0xA4, 0x17, 0x00, 0xB0, 0x16, 0x00, 0x01, 0x00, 0xAD, 0xAA, 0x17, 0x00, 0x00, 0x01,
+    0x5F, 0x00, 0x03, 0x01, 0x5F, 0x00, 0x6E, 0x74, 0x7A, 0xB0, 0x17, 0x00, 0xB0, 0x17, 0x00, 0xB0,
+    0x17, 0x00, 0x01, 0x01, 0x5F, 0x00, 0x74, 0xB0, 0x17, 0x00, 0x01, 0x01, 0x5F, 0x00, 0x6E, 0xB0,
+    0x17, 0x00, 0x04, 0x00, 0x62, 0x65, 0x6F, 0x75, 0xB4, 0x17, 0x00, 0xBA, 0x17, 0x00, 0xC0, 0x17,
+    0x00, 0xE2, 0x17, 0x00, 0x16, 0x01, 0x0A, 0x00, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A,
+    0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x80, 0x0A,
+    0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00,
+    0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8,
+    0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17,
+    0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00,
+    0x03, 0x01, 0x5F, 0x00, 0x6E, 0x73, 0x74, 0xB0, 0x17, 0x00, 0xB0, 0x17, 0x00, 0xB0, 0x17, 0x00,
+    0x02, 0x01, 0x5F, 0x00, 0x73, 0x7A, 0xB0, 0x17, 0x00, 0xB0, 0x17, 0x00, 0x01, 0x00, 0x73, 0xEC,
+    0x17, 0x00, 0x03, 0x00, 0x63, 0x67, 0x72, 0xF2, 0x17, 0x00, 0xF8, 0x17, 0x00, 0x02, 0x18, 0x00,
+    0x02, 0x00, 0x66, 0x6E, 0x08, 0x18, 0x00, 0x0E, 0x18, 0x00, 0x16, 0x01, 0x09, 0x00, 0x2E, 0x62,
     0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76,
-    0x77, 0x78, 0x79, 0x7A, 0xD8, 0x5E, 0xD8, 0x61, 0xD8, 0x67, 0xD8, 0x61, 0xD8, 0x70, 0xD8, 0x75,
-    0xD8, 0x61, 0xD8, 0x61, 0xD8, 0x61, 0xD8, 0x61, 0xD8, 0x75, 0xD8, 0x61, 0xD8, 0x7A, 0xD8, 0x61,
-    0xD8, 0x61, 0xD8, 0x61, 0xD8, 0x83, 0xD8, 0x61, 0xD8, 0x61, 0xD8, 0x61, 0xD8, 0x61, 0xD8, 0x61,
-    0x41, 0x6F, 0xF1, 0x80, 0xD7, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B,
-    0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x6F, 0xD8, 0x15,
-    0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18,
-    0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18,
-    0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xFF, 0xFC, 0xC1, 0x00, 0x41, 0x2E,
-    0xD7, 0xCD, 0x41, 0x73, 0xE8, 0xC1, 0xA0, 0x02, 0x82, 0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73, 0xFA,
-    0xFD, 0x43, 0x65, 0x6F, 0x61, 0xF4, 0x80, 0xF4, 0x80, 0xFF, 0xFB, 0x21, 0x6C, 0xF6, 0x21, 0x65,
-    0xFD, 0x43, 0x65, 0x6F, 0x61, 0xF4, 0x70, 0xF4, 0x70, 0xF4, 0x70, 0x21, 0x6C, 0xF6, 0x21, 0x65,
-    0xFD, 0x21, 0x73, 0xFA, 0x21, 0x6F, 0xFD, 0xA0, 0x02, 0xD2, 0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73,
-    0xFA, 0xFD, 0x22, 0x6F, 0x61, 0xFB, 0xFB, 0x21, 0x63, 0xFB, 0x21, 0x69, 0xFD, 0x25, 0x6D, 0x74,
-    0x73, 0x6E, 0x72, 0xD1, 0xD1, 0xE1, 0xE7, 0xFD, 0x23, 0x65, 0x6F, 0x61, 0xE5, 0xE5, 0xE5, 0x21,
-    0x6C, 0xF9, 0x21, 0x73, 0xFD, 0x25, 0x6D, 0x74, 0x73, 0x6E, 0x6F, 0xB9, 0xB9, 0xC9, 0xCF, 0xFD,
-    0x46, 0x73, 0x69, 0x2E, 0x64, 0x6F, 0x72, 0xD7, 0x59, 0xFF, 0x92, 0xD7, 0x59, 0xFF, 0xDD, 0xFF,
-    0xC1, 0xFF, 0xF5, 0x41, 0x73, 0xFF, 0x86, 0x21, 0x6F, 0xFC, 0x45, 0x2E, 0x73, 0x6D, 0x69, 0x6E,
-    0xD7, 0x3F, 0xE8, 0x39, 0xFF, 0xFD, 0xFF, 0x78, 0xE8, 0x39, 0xA0, 0x02, 0xA3, 0x21, 0x2E, 0xFD,
-    0x23, 0x2E, 0x73, 0x69, 0xFA, 0xFD, 0xE3, 0x42, 0x6F, 0x61, 0xF3, 0xEA, 0xF3, 0xEA, 0x21, 0x63,
-    0xF9, 0x43, 0x65, 0x61, 0x69, 0xFF, 0xEF, 0xF3, 0xE0, 0xFF, 0xFD, 0x41, 0x6F, 0xF3, 0xD6, 0x22,
-    0x74, 0x6D, 0xF2, 0xFC, 0x41, 0x73, 0xFF, 0x76, 0x21, 0x65, 0xFC, 0x21, 0x6F, 0xF9, 0x41, 0x65,
-    0xFF, 0x6F, 0x21, 0x6C, 0xFC, 0x47, 0x61, 0x2E, 0x73, 0x74, 0x6D, 0x64, 0x62, 0xFF, 0xB5, 0xD6,
-    0xF4, 0xFF, 0xEA, 0xFF, 0xF3, 0xFF, 0xF6, 0xFF, 0x6D, 0xFF, 0xFD, 0x21, 0x6D, 0xE0, 0x42, 0x2E,
-    0x65, 0xD6, 0xDB, 0xFF, 0xFD, 0x21, 0x61, 0xF6, 0xA0, 0x02, 0xA2, 0x42, 0x2E, 0x73, 0xFF, 0xFD,
-    0xFF, 0xA2, 0x42, 0x2E, 0x73, 0xFF, 0x98, 0xFF, 0x9B, 0x23, 0x65, 0x6F, 0x61, 0xF2, 0xF2, 0xF9,
-    0x21, 0x6C, 0xF9, 0x21, 0x65, 0xFD, 0x23, 0x65, 0x6F, 0x61, 0xEC, 0xEC, 0xEC, 0x21, 0x6C, 0xF9,
-    0x21, 0x65, 0xFD, 0x21, 0x73, 0xFA, 0x21, 0x6F, 0xFD, 0x47, 0x61, 0x65, 0x6D, 0x74, 0x73, 0x6E,
-    0x6F, 0xFF, 0xC2, 0xFF, 0xC2, 0xFF, 0xEA, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFD, 0xFF, 0x08, 0x44,
-    0x6D, 0x74, 0x73, 0x6E, 0xFE, 0xDF, 0xFE, 0xDF, 0xFE, 0xEF, 0xFE, 0xF5, 0x41, 0x6F, 0xFE, 0xB6,
-    0x43, 0x6F, 0x61, 0x65, 0xF3, 0x41, 0xF3, 0x41, 0xF3, 0x41, 0x42, 0x2E, 0x6C, 0xD6, 0x6F, 0xFF,
-    0xF6, 0x21, 0x65, 0xF9, 0x41, 0x65, 0xE7, 0x5F, 0x44, 0x2E, 0x6D, 0x6C, 0x6E, 0xD6, 0x61, 0xFF,
-    0xFC, 0xFF, 0xE8, 0xFF, 0xE4, 0x21, 0x65, 0xF3, 0x46, 0x6C, 0x6E, 0x6F, 0x6D, 0x74, 0x73, 0xFE,
-    0xA9, 0xFF, 0xD4, 0xFE, 0x8A, 0xFF, 0xE9, 0xFF, 0xFD, 0xFF, 0xFD, 0x21, 0x6F, 0xED, 0x21, 0x64,
-    0xFD, 0x47, 0x73, 0x69, 0x62, 0x72, 0x64, 0x6F, 0x6E, 0xFF, 0x5D, 0xFE, 0x71, 0xFF, 0x64, 0xFF,
-    0x98, 0xFF, 0xAE, 0xFE, 0xA0, 0xFF, 0xFD, 0x41, 0x67, 0xFE, 0x9B, 0x21, 0x6F, 0xFC, 0x41, 0x63,
-    0xD6, 0x1E, 0x21, 0x69, 0xFC, 0x41, 0x65, 0xFF, 0x06, 0x21, 0x74, 0xFC, 0x45, 0x2E, 0x6C, 0x74,
-    0x6E, 0x73, 0xD6, 0x0D, 0xFF, 0xEF, 0xFF, 0xF6, 0xE7, 0x07, 0xFF, 0xFD, 0x45, 0xB1, 0xA9, 0xAD,
-    0xA1, 0xB3, 0xFE, 0x30, 0xFE, 0xA4, 0xFF, 0x09, 0xFF, 0xC5, 0xFF, 0xF0, 0xA0, 0x01, 0x72, 0xA0,
-    0x01, 0x92, 0x21, 0xB3, 0xFD, 0x22, 0x75, 0xC3, 0xF7, 0xFD, 0x21, 0x65, 0xF2, 0xA0, 0x02, 0x62,
-    0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73, 0xFA, 0xFD, 0x21, 0x6F, 0xFB, 0x21, 0x65, 0xF5, 0x21, 0x74,
-    0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x23, 0x2E, 0x73, 0x6D, 0xE6, 0xE9, 0xFD, 0x22, 0x6F,
-    0x61, 0xE5, 0xF9, 0x21, 0x63, 0xFB, 0x21, 0x69, 0xFD, 0x21, 0x67, 0xFD, 0x21, 0xB3, 0xFD, 0x21,
-    0x61, 0xD4, 0x21, 0xAD, 0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x67, 0xFD, 0x41, 0x67, 0xE1, 0x68, 0x23,
-    0xC3, 0x6F, 0x69, 0xED, 0xF9, 0xFC, 0xA0, 0x00, 0xC2, 0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73, 0xFA,
-    0xFD, 0x21, 0x65, 0xF8, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x23, 0x2E, 0x73,
-    0x6D, 0xE9, 0xEC, 0xFD, 0x44, 0x2E, 0x6F, 0x61, 0x74, 0xD5, 0x78, 0xFF, 0xE8, 0xFF, 0xF9, 0xF5,
-    0x24, 0x42, 0x6F, 0x61, 0xD9, 0x83, 0xD9, 0x83, 0x21, 0x74, 0xF9, 0x41, 0x6E, 0xF2, 0xAF, 0x43,
-    0x63, 0x74, 0x65, 0xE7, 0x07, 0xE7, 0x07, 0xFD, 0x93, 0x41, 0x74, 0xE6, 0xFD, 0x41, 0x69, 0xE5,
-    0x70, 0x41, 0x61, 0xD6, 0xF0, 0x21, 0xAD, 0xFC, 0x21, 0xC3, 0xFD, 0xA1, 0x04, 0xA2, 0x70, 0xFD,
-    0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xD9, 0x07, 0xD9, 0x43, 0xFF, 0xFB, 0xD9, 0x43,
-    0xD9, 0x43, 0xD9, 0x43, 0xD9, 0x49, 0x21, 0x6F, 0xEA, 0x22, 0x6E, 0x74, 0xD4, 0xFD, 0xA0, 0x00,
-    0x91, 0x21, 0x2E, 0xFD, 0x21, 0x73, 0xFD, 0xA0, 0x0F, 0x72, 0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73,
-    0xFA, 0xFD, 0x22, 0x6F, 0x61, 0xFB, 0xFB, 0xA0, 0x03, 0x32, 0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73,
-    0xFA, 0xFD, 0xA0, 0x10, 0xF3, 0x21, 0x2E, 0xFD, 0x23, 0x61, 0x2E, 0x73, 0xF5, 0xFA, 0xFD, 0x21,
-    0x73, 0xEB, 0x22, 0x2E, 0x65, 0xE5, 0xFD, 0x21, 0x6C, 0xFB, 0x22, 0x65, 0x61, 0xEE, 0xFD, 0x22,
-    0x63, 0x64, 0xD3, 0xFB, 0x4D, 0x65, 0x61, 0x2E, 0x78, 0x6C, 0x73, 0x63, 0x6D, 0x6E, 0x70, 0x72,
-    0x6F, 0x69, 0xFE, 0xF1, 0xFE, 0xF6, 0xD4, 0xD5, 0xFF, 0x04, 0xFF, 0x3B, 0xFF, 0x60, 0xFF, 0x74,
-    0xFF, 0x77, 0xFF, 0x7B, 0xFF, 0x85, 0xFF, 0xB5, 0xFF, 0xC0, 0xFF, 0xFB, 0x42, 0x65, 0xC3, 0xFE,
-    0xC0, 0xFE, 0xC6, 0xA0, 0x03, 0x23, 0x21, 0x2E, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x61, 0xFD, 0x21,
-    0x67, 0xFD, 0x43, 0x2E, 0x73, 0x69, 0xD4, 0x97, 0xE5, 0x91, 0xFC, 0xD0, 0x21, 0x65, 0xF6, 0x41,
-    0x73, 0xFE, 0xB1, 0x44, 0x2E, 0x73, 0x69, 0x6E, 0xFE, 0xAA, 0xFE, 0xAD, 0xFF, 0xFC, 0xFE, 0xAD,
-    0x43, 0x2E, 0x74, 0x65, 0xD4, 0x79, 0xFF, 0xEC, 0xFF, 0xF3, 0xA0, 0x0C, 0xF1, 0x21, 0x61, 0xFD,
-    0x21, 0x69, 0xFD, 0x21, 0x6C, 0xFD, 0xA0, 0x11, 0x22, 0x21, 0x6E, 0xFD, 0x21, 0x61, 0xFD, 0x21,
-    0x63, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x72, 0xFD, 0x23, 0x6F, 0x69, 0x65, 0xC7, 0xEB, 0xFD, 0x42,
-    0x6F, 0x72, 0xD4, 0x4A, 0xE0, 0x14, 0x45, 0x2E, 0x64, 0x66, 0x67, 0x74, 0xD4, 0x43, 0xFF, 0xF9,
-    0xF1, 0x94, 0xE5, 0xEC, 0xFA, 0x5A, 0x41, 0x65, 0xFC, 0x6C, 0x42, 0x6E, 0x73, 0xFE, 0x56, 0xFE,
-    0x56, 0x41, 0x6F, 0xFF, 0x9E, 0x41, 0x73, 0xFE, 0x48, 0x45, 0x2E, 0x73, 0x6D, 0x69, 0x6E, 0xFE,
-    0x44, 0xFE, 0x47, 0xFF, 0xF8, 0xFF, 0xFC, 0xFE, 0x47, 0x42, 0x61, 0x73, 0xFF, 0xF0, 0xFE, 0x37,
-    0x43, 0x2E, 0x73, 0x69, 0xFE, 0x2D, 0xFE, 0x30, 0xFF, 0x7F, 0x43, 0x73, 0x2E, 0x6E, 0xFE, 0x26,
-    0xFE, 0x23, 0xFE, 0x26, 0x23, 0xAD, 0xA9, 0xA1, 0xE5, 0xEC, 0xF6, 0x45, 0x6D, 0x2E, 0x73, 0x69,
-    0x6E, 0xFF, 0xC6, 0xFE, 0x12, 0xFE, 0x15, 0xFF, 0x64, 0xFE, 0x15, 0xA0, 0x03, 0x22, 0x21, 0x2E,
-    0xFD, 0x21, 0x65, 0xFD, 0x41, 0x65, 0xFF, 0x32, 0x42, 0x2E, 0x73, 0xFF, 0x2B, 0xFF, 0x2E, 0x23,
-    0x65, 0x61, 0x6F, 0xF9, 0xF9, 0xF9, 0x41, 0x73, 0xFF, 0x20, 0x21, 0x6F, 0xFC, 0x41, 0x68, 0xD7,
-    0xC2, 0xC2, 0x00, 0xD1, 0x2E, 0x73, 0xFD, 0xDC, 0xFD, 0xDF, 0x22, 0x6F, 0x61, 0xF7, 0xF7, 0x4C,
-    0x6F, 0xC3, 0x65, 0x61, 0x2E, 0x6D, 0x74, 0x6C, 0x73, 0x6E, 0x63, 0x69, 0xFF, 0x7B, 0xFF, 0xB5,
-    0xFF, 0xBC, 0xFF, 0x24, 0xD3, 0xAA, 0xFF, 0xD2, 0xFF, 0xD5, 0xFF, 0xE0, 0xFF, 0xD5, 0xFF, 0xEB,
-    0xFF, 0xEE, 0xFF, 0xFB, 0x41, 0x61, 0xFE, 0xFF, 0x43, 0x65, 0x6F, 0x61, 0xF0, 0x49, 0xF0, 0x49,
-    0xFB, 0xBA, 0x43, 0x2E, 0x61, 0x65, 0xFD, 0x9B, 0xFD, 0xA1, 0xFE, 0xED, 0x43, 0x2E, 0x73, 0x72,
-    0xFD, 0x91, 0xFD, 0x94, 0xFF, 0xF6, 0x48, 0x2E, 0x6D, 0x74, 0x6C, 0x6E, 0x6F, 0x61, 0x65, 0xD3,
-    0x63, 0xFC, 0xFE, 0xFC, 0xFE, 0xFF, 0xE2, 0xFC, 0xE6, 0xFF, 0xF6, 0xFD, 0x8D, 0xE3, 0xDD, 0xA0,
-    0x05, 0x41, 0x21, 0x65, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x41, 0x6E, 0xFD, 0x65, 0x21,
-    0xB3, 0xFC, 0x41, 0x65, 0xFE, 0xAD, 0x21, 0x6E, 0xFC, 0x22, 0xC3, 0x6F, 0xF6, 0xFD, 0x43, 0x74,
-    0x61, 0x69, 0xE4, 0xD8, 0xFF, 0xEA, 0xFF, 0xFB, 0x41, 0x72, 0xE4, 0xCE, 0x41, 0x64, 0xFE, 0xBA,
-    0x21, 0x61, 0xFC, 0x21, 0x6E, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x63, 0xFD, 0x42,
-    0x72, 0x69, 0xE4, 0xB7, 0xFF, 0xFD, 0x41, 0x69, 0xE2, 0xB7, 0x41, 0x74, 0xED, 0x7B, 0x43, 0x64,
-    0x73, 0x74, 0xEA, 0xF2, 0xFF, 0xFC, 0xE4, 0xA8, 0x41, 0x73, 0xEC, 0xE8, 0x42, 0x2E, 0x65, 0xD2,
-    0xF0, 0xFF, 0xFC, 0xA0, 0x08, 0xF1, 0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73, 0xFA, 0xFD, 0x21, 0x6F,
-    0xFB, 0x21, 0x73, 0xFD, 0x21, 0xAD, 0xFD, 0x53, 0x61, 0x69, 0x73, 0x2E, 0x6D, 0x6E, 0x74, 0x72,
-    0x62, 0x64, 0x6F, 0x63, 0x65, 0x66, 0x67, 0x70, 0x75, 0x6C, 0xC3, 0xFE, 0x25, 0xFE, 0x38, 0xFE,
-    0x59, 0xD2, 0xD2, 0xFE, 0x81, 0xFE, 0x8F, 0xFE, 0x9F, 0xFF, 0x28, 0xFF, 0x4D, 0xFF, 0x6F, 0xFB,
-    0x0B, 0xFF, 0xA7, 0xFF, 0xB1, 0xFF, 0xC8, 0xFF, 0xB1, 0xFF, 0xCF, 0xFF, 0xD7, 0xFF, 0xE5, 0xFF,
-    0xFD, 0xA0, 0x01, 0xB2, 0x21, 0xA1, 0xFD, 0x43, 0xC3, 0x65, 0x73, 0xFF, 0xFD, 0xD2, 0xF0, 0xE3,
-    0x8C, 0x41, 0x65, 0xEB, 0xDA, 0x21, 0x6C, 0xFC, 0x41, 0x65, 0xE4, 0xF6, 0x21, 0x72, 0xFC, 0x21,
-    0x65, 0xFD, 0x43, 0x2E, 0x63, 0x74, 0xD2, 0x77, 0xFF, 0xF3, 0xFF, 0xFD, 0x41, 0x61, 0xD2, 0x6D,
-    0x21, 0x63, 0xFC, 0x21, 0x6F, 0xFD, 0x41, 0x6F, 0xD5, 0x4C, 0x43, 0x6F, 0x62, 0x69, 0xFD, 0xD5,
-    0xFF, 0xF9, 0xFF, 0xFC, 0xA0, 0x01, 0xB1, 0x21, 0x72, 0xFD, 0x21, 0x62, 0xFD, 0x21, 0x65, 0xFD,
-    0x43, 0x65, 0x6F, 0x72, 0xEC, 0xC5, 0xD6, 0x64, 0xDE, 0x0C, 0x45, 0x2E, 0x68, 0x64, 0x65, 0x74,
-    0xD2, 0x3F, 0xFF, 0xF3, 0xE3, 0xEC, 0xEB, 0xCF, 0xFF, 0xF6, 0xA0, 0x04, 0x13, 0x21, 0x2E, 0xFD,
-    0x21, 0x73, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x6D, 0xFD, 0x42, 0x2E, 0x65, 0xFC, 0x44, 0xFF, 0xFD,
-    0xA0, 0x03, 0xC2, 0x21, 0x2E, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x61, 0xED, 0x22, 0x61, 0x65, 0xEA,
-    0xEA, 0x46, 0x73, 0x2E, 0x6E, 0x69, 0x62, 0x72, 0xFF, 0xE8, 0xFC, 0x2C, 0xFC, 0x2F, 0xFF, 0xF5,
-    0xFF, 0xF8, 0xFF, 0xFB, 0x45, 0x2E, 0x73, 0x6D, 0x69, 0x6E, 0xFC, 0x19, 0xFC, 0x1C, 0xFD, 0xCD,
-    0xFD, 0x6B, 0xFC, 0x1C, 0x42, 0x73, 0x61, 0xFC, 0x0C, 0xFF, 0xF0, 0x43, 0xA9, 0xA1, 0xAD, 0xFD,
-    0xD5, 0xFF, 0xD6, 0xFF, 0xF9, 0xA0, 0x02, 0xF3, 0x21, 0x2E, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x6F,
-    0xFD, 0x21, 0x6D, 0xFD, 0x43, 0x65, 0x61, 0x6F, 0xEE, 0x8D, 0xEE, 0x8D, 0xEE, 0x8D, 0x43, 0x2E,
-    0x73, 0x69, 0xFF, 0xA2, 0xFF, 0xA5, 0xFF, 0xA8, 0x21, 0x65, 0xF6, 0xA0, 0x03, 0xE3, 0x21, 0x2E,
-    0xFD, 0x21, 0x73, 0xFD, 0x24, 0x2E, 0x73, 0x69, 0x6E, 0xF7, 0xFA, 0xFD, 0xFA, 0x43, 0x2E, 0x74,
-    0x65, 0xFF, 0x83, 0xFF, 0xEB, 0xFF, 0xF7, 0x21, 0x6F, 0xEA, 0x41, 0x65, 0xFF, 0x7C, 0x21, 0x6E,
-    0xE0, 0x21, 0x73, 0xDA, 0x25, 0x2E, 0x73, 0x6D, 0x69, 0x6E, 0xD7, 0xDA, 0xF3, 0xFD, 0xDA, 0x22,
-    0x61, 0x73, 0xF5, 0xCF, 0x23, 0x2E, 0x73, 0x69, 0xC7, 0xCA, 0xCD, 0x23, 0x73, 0x2E, 0x6E, 0xC3,
-    0xC0, 0xC3, 0x23, 0xAD, 0xA9, 0xA1, 0xED, 0xF2, 0xF9, 0x45, 0x6D, 0x2E, 0x73, 0x69, 0x6E, 0xFF,
-    0xCE, 0xFF, 0xB2, 0xFF, 0xB5, 0xFF, 0xB8, 0xFF, 0xB5, 0x44, 0x6F, 0xC3, 0x65, 0x61, 0xFF, 0xC5,
-    0xFF, 0xE9, 0xFF, 0xF0, 0xFF, 0xAB, 0xA0, 0x10, 0x54, 0x21, 0x2E, 0xFD, 0x21, 0x65, 0xFD, 0x21,
-    0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x23, 0x2E, 0x73, 0x6D, 0xEE, 0xF1, 0xFD, 0x21,
-    0x65, 0xF9, 0x42, 0x61, 0x6C, 0xFF, 0x82, 0xFF, 0xFD, 0x42, 0x2E, 0x73, 0xFF, 0x72, 0xFF, 0x75,
-    0x43, 0x2E, 0x61, 0x65, 0xFF, 0x6B, 0xFF, 0xF9, 0xFF, 0x71, 0x43, 0x2E, 0x73, 0x72, 0xFF, 0x61,
-    0xFF, 0x64, 0xFF, 0xF6, 0x43, 0x2E, 0x6F, 0x61, 0xFE, 0xEC, 0xFF, 0xF6, 0xFF, 0xE5, 0x47, 0x73,
-    0x6D, 0x6E, 0x74, 0x72, 0x62, 0x64, 0xFF, 0x5F, 0xFF, 0x69, 0xFE, 0xE5, 0xFF, 0x6C, 0xFF, 0xAB,
-    0xFF, 0xD4, 0xFF, 0xF6, 0x42, 0x2E, 0x65, 0xFB, 0x09, 0xFC, 0x5B, 0x21, 0x64, 0xF9, 0x21, 0x61,
-    0xFD, 0x21, 0x64, 0xFD, 0x45, 0x2E, 0x65, 0x61, 0x6D, 0x69, 0xFA, 0xF9, 0xFC, 0x4B, 0xFA, 0xFF,
-    0xFB, 0x10, 0xFF, 0xFD, 0x21, 0x72, 0xF0, 0x21, 0x6F, 0xFD, 0x4B, 0xC3, 0x65, 0x2E, 0x6D, 0x74,
-    0x6C, 0x73, 0x6E, 0x6F, 0x61, 0x69, 0xFE, 0xE1, 0xFE, 0xF7, 0xD0, 0xBF, 0xFA, 0x5A, 0xFA, 0x5A,
-    0xFE, 0xFA, 0xFA, 0x5A, 0xFA, 0x42, 0xFC, 0x35, 0xFF, 0xC4, 0xFF, 0xFD, 0x46, 0x2E, 0x6D, 0x74,
-    0x6C, 0x6E, 0x72, 0xD0, 0x9D, 0xFA, 0x38, 0xFA, 0x38, 0xFD, 0x1C, 0xFA, 0x20, 0xFA, 0xCC, 0x41,
-    0x61, 0xE1, 0x84, 0x21, 0x6C, 0xFC, 0x21, 0x64, 0xFD, 0x41, 0x6F, 0xFB, 0x7E, 0x21, 0x74, 0xFC,
-    0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x69, 0xFD, 0x41, 0x2E, 0xE3, 0x46, 0x42, 0x2E, 0x73,
-    0xE3, 0x42, 0xFF, 0xFC, 0x22, 0x6F, 0x61, 0xF9, 0xF9, 0x21, 0x69, 0xFB, 0x23, 0x64, 0x6D, 0x63,
-    0xD7, 0xEA, 0xFD, 0xA0, 0x00, 0x81, 0x21, 0x6F, 0xFD, 0x21, 0x64, 0xFD, 0x21, 0x6E, 0xFD, 0x21,
-    0xA1, 0xFD, 0x42, 0x6F, 0x72, 0xD4, 0x62, 0xDC, 0x11, 0xA0, 0x11, 0x92, 0x21, 0x6C, 0xFD, 0x21,
-    0x61, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x61,
-    0xFD, 0x44, 0x61, 0x6F, 0x74, 0x75, 0xE0, 0xA2, 0xE9, 0x8F, 0xFF, 0xE1, 0xFF, 0xFD, 0x41, 0x6E,
-    0xE1, 0xC8, 0x42, 0x63, 0x72, 0xE1, 0xC4, 0xE1, 0xC4, 0x42, 0x6D, 0x72, 0xD9, 0x69, 0xD4, 0xC3,
-    0x41, 0x67, 0xD9, 0xBC, 0x42, 0x61, 0x6F, 0xD0, 0x9B, 0xD0, 0x9B, 0x43, 0x61, 0x65, 0x6F, 0xD0,
-    0x94, 0xD0, 0x94, 0xD0, 0x94, 0x21, 0x69, 0xF6, 0x44, 0x61, 0x69, 0x65, 0x6F, 0xD0, 0x87, 0xD0,
-    0x87, 0xD0, 0x87, 0xD0, 0x87, 0x44, 0x6A, 0x67, 0x6C, 0x6D, 0xFF, 0xDF, 0xD9, 0x97, 0xFF, 0xF0,
-    0xFF, 0xF3, 0x44, 0xA1, 0xA9, 0xB3, 0xAD, 0xFF, 0xC7, 0xFF, 0xCE, 0xD8, 0x5C, 0xFF, 0xF3, 0x41,
-    0x72, 0xDC, 0x2A, 0x21, 0x65, 0xFC, 0x41, 0x6D, 0xE2, 0x99, 0x21, 0x75, 0xFC, 0x41, 0x69, 0xD1,
-    0xE0, 0x44, 0x63, 0x67, 0x6C, 0x6D, 0xFF, 0xF2, 0xD9, 0x83, 0xFF, 0xF9, 0xFF, 0xFC, 0x41, 0x74,
-    0xD2, 0x2C, 0x21, 0xA9, 0xFC, 0x21, 0xC3, 0xFD, 0x41, 0x69, 0xD7, 0xE1, 0x21, 0x75, 0xFC, 0x43,
-    0x63, 0x67, 0x71, 0xD1, 0xB0, 0xFF, 0xF6, 0xFF, 0xFD, 0x43, 0x61, 0xC3, 0x6F, 0xD1, 0xA3, 0xD9,
-    0x2F, 0xD1, 0xA3, 0x41, 0xAD, 0xD1, 0x99, 0x43, 0x65, 0x69, 0xC3, 0xD1, 0x95, 0xD1, 0x95, 0xFF,
-    0xFC, 0x42, 0x69, 0x61, 0xD7, 0x0B, 0xD1, 0x8E, 0x44, 0xA1, 0xAD, 0xA9, 0xB3, 0xD1, 0x84, 0xD1,
-    0x84, 0xD1, 0x84, 0xD1, 0x84, 0x45, 0x61, 0xC3, 0x69, 0x65, 0x6F, 0xD1, 0x77, 0xFF, 0xF3, 0xD1,
-    0x77, 0xD1, 0x77, 0xD1, 0x77, 0x41, 0x6F, 0xD1, 0xE6, 0x25, 0x6A, 0x67, 0x6C, 0x6D, 0x74, 0xC0,
-    0xCE, 0xD8, 0xEC, 0xFC, 0x41, 0xB3, 0xD1, 0x58, 0x21, 0xC3, 0xFC, 0x21, 0x69, 0xFD, 0x41, 0x72,
-    0xFF, 0x7F, 0x41, 0xA9, 0xD1, 0x4D, 0x43, 0x63, 0x71, 0x73, 0xD1, 0x46, 0xD1, 0x46, 0xD6, 0x27,
-    0x22, 0xC3, 0x69, 0xF2, 0xF6, 0x41, 0x6D, 0xD1, 0xA5, 0x21, 0xA1, 0xFC, 0x22, 0x61, 0xC3, 0xF9,
-    0xFD, 0x41, 0x71, 0xD1, 0x2B, 0x21, 0x73, 0xFC, 0x41, 0x61, 0xD1, 0x35, 0x21, 0x6C, 0xFC, 0x47,
-    0x62, 0x6E, 0x63, 0x74, 0x67, 0x65, 0x70, 0xFF, 0xCC, 0xD8, 0xD5, 0xFF, 0xCF, 0xFF, 0xE1, 0xFF,
-    0xED, 0xFF, 0xF6, 0xFF, 0xFD, 0x43, 0x72, 0x74, 0x63, 0xD1, 0x07, 0xD1, 0x07, 0xD1, 0x07, 0x21,
-    0x61, 0xF6, 0x42, 0x62, 0x64, 0xD8, 0xB2, 0xFF, 0xFD, 0x41, 0x72, 0xD0, 0x12, 0xA0, 0x0D, 0xA1,
-    0x21, 0x69, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x6F, 0xFD, 0x48, 0xC3, 0x61, 0x65, 0x69, 0x6F, 0x75,
-    0x74, 0x70, 0xFE, 0xF9, 0xFF, 0x18, 0xFF, 0x36, 0xFF, 0x80, 0xFF, 0xC6, 0xFF, 0xE9, 0xFF, 0xF0,
-    0xFF, 0xFD, 0x41, 0x72, 0xFA, 0x54, 0x21, 0x74, 0xFC, 0x21, 0x63, 0xFD, 0x21, 0xA9, 0xFD, 0x22,
-    0x65, 0xC3, 0xFA, 0xFD, 0x4F, 0x6F, 0x73, 0x2E, 0x6D, 0x6E, 0x72, 0x64, 0x65, 0x61, 0xC3, 0x63,
-    0x74, 0x75, 0x78, 0x6C, 0xFC, 0x13, 0xFC, 0x2E, 0xCE, 0xA5, 0xFC, 0x46, 0xFC, 0x66, 0xFD, 0xE6,
-    0xFE, 0x08, 0xFE, 0x22, 0xFE, 0x48, 0xFE, 0x5B, 0xFE, 0x7D, 0xFE, 0x8A, 0xFE, 0x8E, 0xFF, 0xD5,
-    0xFF, 0xFB, 0x43, 0x2E, 0x73, 0x6D, 0xF8, 0x9B, 0xF8, 0x9E, 0xFA, 0x4F, 0xA0, 0x03, 0x53, 0x21,
-    0x2E, 0xFD, 0x22, 0x2E, 0x73, 0xFA, 0xFD, 0xA0, 0x03, 0x84, 0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73,
-    0xFA, 0xFD, 0x23, 0x65, 0x6F, 0x61, 0xF0, 0xF0, 0xFB, 0x22, 0x2E, 0x6C, 0xE3, 0xF9, 0x21, 0x65,
-    0xFB, 0x23, 0x65, 0x61, 0x6F, 0xE1, 0xE1, 0xE1, 0x23, 0x65, 0x6F, 0x61, 0xDA, 0xDA, 0xDA, 0x21,
-    0x6C, 0xF9, 0x24, 0x6D, 0x74, 0x6C, 0x65, 0xEC, 0xEC, 0xEF, 0xFD, 0x22, 0x2E, 0x6C, 0xC1, 0xED,
-    0x21, 0x73, 0xFB, 0x21, 0x6F, 0xFD, 0x23, 0x73, 0x6E, 0x6F, 0xEC, 0xFD, 0xFA, 0x21, 0x6F, 0xF9,
-    0x43, 0x73, 0x69, 0x6D, 0xF8, 0x40, 0xF9, 0x8F, 0xFF, 0xFD, 0x21, 0xA1, 0xF6, 0x43, 0x6F, 0x61,
-    0xC3, 0xF8, 0x33, 0xFF, 0x95, 0xFF, 0xFD, 0x41, 0x69, 0xF9, 0x78, 0x21, 0x74, 0xFC, 0x41, 0x73,
-    0xF8, 0xEC, 0x42, 0x2E, 0x65, 0xF8, 0xE5, 0xFF, 0xFC, 0x21, 0x6C, 0xF9, 0x43, 0x69, 0x61, 0x65,
-    0xFF, 0xEF, 0xFF, 0xFD, 0xF8, 0x1C, 0x41, 0x61, 0xEA, 0xAB, 0x42, 0x6F, 0x69, 0xCE, 0x5D, 0xCE,
-    0xBE, 0x21, 0x6D, 0xF9, 0x41, 0x69, 0xCE, 0xB4, 0x21, 0x6D, 0xFC, 0x21, 0xA1, 0xFD, 0x22, 0x61,
-    0xC3, 0xF3, 0xFD, 0x44, 0x6D, 0x74, 0x6C, 0x6F, 0xF6, 0xB8, 0xFF, 0xE3, 0xFF, 0xFB, 0xE7, 0x2D,
-    0xC3, 0x02, 0x91, 0x61, 0xC3, 0x65, 0xCF, 0xCC, 0xD7, 0x58, 0xCF, 0xCC, 0x21, 0x69, 0xF4, 0x21,
-    0x63, 0xFD, 0xC1, 0x05, 0x81, 0x61, 0xCE, 0x3D, 0x21, 0x69, 0xFA, 0x21, 0x63, 0xFD, 0x21, 0xAD,
-    0xFD, 0xA0, 0x02, 0xB1, 0x21, 0x74, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0xA9, 0xFD, 0x23, 0x62, 0x65,
-    0xC3, 0xF4, 0xFA, 0xFD, 0x21, 0x62, 0xED, 0x21, 0x6C, 0xEA, 0x21, 0x6D, 0xE7, 0x21, 0x69, 0xE7,
-    0x21, 0x70, 0xFD, 0x21, 0x73, 0xFD, 0x25, 0xAD, 0xA1, 0xA9, 0xBA, 0xB3, 0xEE, 0xF1, 0xE1, 0xF4,
-    0xFD, 0x22, 0x74, 0x69, 0xD0, 0xD0, 0x21, 0x6E, 0xCE, 0x21, 0x65, 0xFD, 0x22, 0x73, 0x72, 0xF5,
-    0xFD, 0x25, 0x69, 0xC3, 0x61, 0x65, 0x75, 0xCC, 0xE5, 0xD6, 0xFB, 0xD9, 0x41, 0x75, 0xEA, 0x4B,
-    0xA0, 0x0B, 0xE3, 0x22, 0x75, 0x74, 0xFD, 0xFD, 0x22, 0x73, 0x64, 0xFB, 0xF8, 0xA0, 0x0C, 0x63,
-    0x21, 0x72, 0xFD, 0xA0, 0x0C, 0x93, 0x21, 0x2E, 0xFD, 0x23, 0x6E, 0x6F, 0x6D, 0xEF, 0xF7, 0xFD,
-    0x41, 0x73, 0xEA, 0x44, 0x21, 0xA9, 0xFC, 0xA0, 0x0A, 0x12, 0x21, 0x72, 0xFD, 0x21, 0x61, 0xFD,
-    0x21, 0x73, 0xFD, 0xA0, 0x0C, 0x42, 0x21, 0x6F, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x67, 0xFD, 0x21,
-    0x65, 0xFD, 0x24, 0x69, 0xC3, 0x65, 0x72, 0xD7, 0xE2, 0xEE, 0xFD, 0x21, 0x72, 0xF7, 0x42, 0x65,
-    0x72, 0xFF, 0xFD, 0xCE, 0x2D, 0x41, 0x72, 0xFC, 0xB4, 0x21, 0x74, 0xFC, 0x21, 0x73, 0xFD, 0x21,
-    0x75, 0xFD, 0x41, 0x72, 0xCD, 0xC6, 0x21, 0x65, 0xFC, 0x21, 0x69, 0xFD, 0x21, 0x6E, 0xFD, 0x21,
-    0x65, 0xFD, 0x4A, 0x69, 0xC3, 0x68, 0x66, 0x6D, 0x74, 0x6F, 0x61, 0x64, 0x67, 0xFF, 0x2D, 0xFF,
-    0x3C, 0xFF, 0x7F, 0xFD, 0xF7, 0xFF, 0x8A, 0xFF, 0xDC, 0xE9, 0x9F, 0xE9, 0x9F, 0xFF, 0xED, 0xFF,
-    0xFD, 0x41, 0x65, 0xD8, 0x86, 0x43, 0x6E, 0x2E, 0x73, 0xD8, 0x7E, 0xF7, 0x21, 0xF7, 0x24, 0x42,
-    0x6F, 0x61, 0xFF, 0xF6, 0xF7, 0x1D, 0x42, 0x2E, 0x73, 0xF8, 0xC5, 0xF8, 0xC8, 0x22, 0x6F, 0x61,
-    0xF9, 0xF9, 0x41, 0x2E, 0xEE, 0x81, 0x21, 0x73, 0xFC, 0x21, 0x65, 0xFD, 0x44, 0x6E, 0x72, 0x2E,
-    0x73, 0xFF, 0xF1, 0xFF, 0xFD, 0xF7, 0x72, 0xF7, 0x75, 0x41, 0x61, 0xDE, 0x29, 0x41, 0x72, 0xF8,
-    0xA1, 0x42, 0x2E, 0x73, 0xF7, 0x5D, 0xF7, 0x60, 0x4A, 0x67, 0x64, 0x73, 0x6E, 0x62, 0x63, 0x61,
-    0x74, 0x65, 0x6F, 0xFE, 0x65, 0xFE, 0x84, 0xFE, 0xAB, 0xFF, 0x9A, 0xFF, 0xB9, 0xFF, 0xC7, 0xFF,
-    0xE4, 0xFF, 0xF1, 0xFF, 0xF5, 0xFF, 0xF9, 0x41, 0x69, 0xFB, 0xFC, 0x21, 0x72, 0xFC, 0x21, 0x65,
-    0xFD, 0x41, 0x74, 0xFD, 0x68, 0xA0, 0x11, 0xB2, 0x42, 0x64, 0x74, 0xFF, 0xFD, 0xFC, 0x01, 0x21,
-    0x69, 0xF9, 0x21, 0x73, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x76, 0xFD, 0x21, 0x69,
-    0xFD, 0x23, 0x74, 0x6C, 0x6E, 0xDD, 0xE0, 0xFD, 0x5C, 0x62, 0x2E, 0x63, 0x64, 0x66, 0x67, 0x68,
-    0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xC3,
-    0x6F, 0x61, 0x65, 0x69, 0x75, 0xCD, 0x5C, 0xDB, 0x8C, 0xDD, 0xF1, 0xE3, 0xC6, 0xE4, 0x43, 0xE5,
-    0xC4, 0xE7, 0x42, 0xE7, 0x94, 0xE7, 0xDD, 0xE8, 0x9B, 0xE9, 0xD6, 0xEA, 0x67, 0xED, 0x21, 0xED,
-    0x83, 0xEE, 0x2C, 0xF0, 0x08, 0xF2, 0x7F, 0xF2, 0xDD, 0xF3, 0x29, 0xF3, 0x78, 0xF3, 0xC3, 0xF4,
-    0x0C, 0xF6, 0x24, 0xF7, 0x4C, 0xF9, 0x4F, 0xFD, 0x7C, 0xFF, 0xB0, 0xFF, 0xF9,
+    0x77, 0x78, 0x79, 0x7A, 0x80, 0x0A, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00,
+    0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x2C,
+    0x0A, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x2C, 0x0A,
+    0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00,
+    0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x04, 0x00, 0x61, 0x62, 0x63, 0x74, 0x14, 0x18, 0x00, 0x1A,
+    0x18, 0x00, 0x22, 0x17, 0x00, 0xB0, 0x16, 0x00, 0x17, 0x01, 0x0A, 0x00, 0x2E, 0x62, 0x63, 0x64,
+    0x65, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77,
+    0x78, 0x79, 0x7A, 0x80, 0x0A, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0x20,
+    0x18, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17,
+    0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00,
+    0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8,
+    0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0x03, 0x01, 0x5F, 0x00, 0x2E, 0x65, 0x69, 0x80,
+    0x0A, 0x00, 0x26, 0x18, 0x00, 0x34, 0x17, 0x00, 0x05, 0x00, 0x6D, 0x6E, 0x72, 0x73, 0x75, 0x2C,
+    0x18, 0x00, 0x32, 0x18, 0x00, 0x38, 0x18, 0x00, 0x3E, 0x18, 0x00, 0x44, 0x18, 0x00, 0x18, 0x01,
+    0x0A, 0x00, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x80, 0x0A, 0x00, 0xE8, 0x17, 0x00,
+    0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0x4A,
+    0x18, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17,
+    0x00, 0xC0, 0x16, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00,
+    0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8,
+    0x17, 0x00, 0x03, 0x01, 0x5F, 0x00, 0x2E, 0x73, 0x7A, 0x80, 0x0A, 0x00, 0xB0, 0x17, 0x00, 0xB0,
+    0x17, 0x00, 0x02, 0x00, 0x61, 0x6C, 0x54, 0x18, 0x00, 0x5E, 0x18, 0x00, 0x01, 0x01, 0x5F, 0x00,
+    0x2E, 0x80, 0x0A, 0x00, 0x01, 0x00, 0xA9, 0x64, 0x18, 0x00, 0x05, 0x00, 0x63, 0x69, 0x6E, 0x72,
+    0x73, 0x6A, 0x18, 0x00, 0x70, 0x18, 0x00, 0x60, 0x15, 0x00, 0x76, 0x18, 0x00, 0x7C, 0x18, 0x00,
+    0x01, 0x00, 0x65, 0x96, 0x18, 0x00, 0x03, 0x00, 0x63, 0x64, 0x6D, 0x9C, 0x18, 0x00, 0xA2, 0x18,
+    0x00, 0xA8, 0x18, 0x00, 0x04, 0x00, 0x61, 0x6F, 0x74, 0x75, 0xC0, 0x16, 0x00, 0xAE, 0x18, 0x00,
+    0xCC, 0x18, 0x00, 0xD6, 0x18, 0x00, 0x06, 0x00, 0x2E, 0x6C, 0x6D, 0x6E, 0x72, 0x74, 0x80, 0x0A,
+    0x00, 0xC6, 0x16, 0x00, 0xD4, 0x16, 0x00, 0xDA, 0x16, 0x00, 0x2C, 0x12, 0x00, 0xD4, 0x16, 0x00,
+    0x01, 0x00, 0x64, 0xA2, 0x18, 0x00, 0x02, 0x00, 0x65, 0xC3, 0xDC, 0x18, 0x00, 0xE2, 0x18, 0x00,
+    0x03, 0x00, 0x62, 0x69, 0x6F, 0xE8, 0x18, 0x00, 0xEE, 0x18, 0x00, 0x0C, 0x17, 0x00, 0x05, 0x00,
+    0x2E, 0x64, 0x65, 0x68, 0x74, 0x80, 0x0A, 0x00, 0xB0, 0x16, 0x00, 0xF4, 0x18, 0x00, 0xFA, 0x18,
+    0x00, 0x00, 0x19, 0x00, 0x03, 0x00, 0x65, 0x73, 0xC3, 0x0E, 0x19, 0x00, 0x2E, 0x17, 0x00, 0x12,
+    0x19, 0x00, 0x0B, 0x00, 0x2E, 0x61, 0x65, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x73, 0x74, 0xC3, 0x80,
+    0x0A, 0x00, 0x18, 0x19, 0x00, 0x36, 0x19, 0x00, 0x3C, 0x19, 0x00, 0x42, 0x19, 0x00, 0xD4, 0x16,
+    0x00, 0xDA, 0x16, 0x00, 0x0C, 0x17, 0x00, 0xD4, 0x16, 0x00, 0xD4, 0x16, 0x00, 0x50, 0x19, 0x00,
+    0x03, 0x00, 0x2E, 0x63, 0x74, 0x80, 0x0A, 0x00, 0x5E, 0x19, 0x00, 0x64, 0x19, 0x00, 0x01, 0x00,
+    0x6E, 0xB0, 0x16, 0x00, 0x02, 0x00, 0x63, 0x72, 0xB0, 0x16, 0x00, 0xB0, 0x16, 0x00, 0x08, 0x00,
+    0x61, 0x65, 0x69, 0x6F, 0x70, 0x74, 0x75, 0xC3, 0x6A, 0x19, 0x00, 0x7C, 0x19, 0x00, 0x8A, 0x19,
+    0x00, 0xA0, 0x19, 0x00, 0xBE, 0x19, 0x00, 0xC4, 0x19, 0x00, 0xCA, 0x19, 0x00, 0xD4, 0x19, 0x00,
+    0x01, 0x00, 0xA1, 0xE6, 0x19, 0x00, 0x01, 0x00, 0x6D, 0xEC, 0x19, 0x00, 0x02, 0x00, 0x6D, 0x72,
+    0x60, 0x15, 0x00, 0x48, 0x15, 0x00, 0x03, 0x00, 0x6C, 0x73, 0x74, 0xB0, 0x16, 0x00, 0x9E, 0x17,
+    0x00, 0xB0, 0x16, 0x00, 0x02, 0x00, 0x6E, 0x74, 0xB0, 0x16, 0x00, 0xB0, 0x16, 0x00, 0x02, 0x00,
+    0x6C, 0x73, 0xB0, 0x16, 0x00, 0xF2, 0x19, 0x00, 0x02, 0x00, 0x6F, 0x72, 0xAE, 0x18, 0x00, 0xF8,
+    0x19, 0x00, 0x02, 0x00, 0x67, 0x6E, 0xF4, 0x18, 0x00, 0xFE, 0x19, 0x00, 0x17, 0x01, 0x0A, 0x00,
+    0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73,
+    0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x80, 0x0A, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00,
+    0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8,
+    0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17,
+    0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0x34, 0x17, 0x00, 0xE8, 0x17, 0x00,
+    0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0x01, 0x00, 0x6E, 0x04,
+    0x1A, 0x00, 0x17, 0x01, 0x0A, 0x00, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B,
+    0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x80, 0x0A, 0x00,
+    0x0E, 0x1A, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8,
+    0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17,
+    0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00,
+    0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8,
+    0x17, 0x00, 0x01, 0x00, 0x61, 0x14, 0x1A, 0x00, 0x02, 0x00, 0x62, 0x6C, 0x1A, 0x1A, 0x00, 0xB0,
+    0x16, 0x00, 0x06, 0x00, 0x63, 0x6C, 0x6D, 0x70, 0x74, 0x78, 0x60, 0x15, 0x00, 0x24, 0x1A, 0x00,
+    0x2A, 0x1A, 0x00, 0x38, 0x1A, 0x00, 0x42, 0x1A, 0x00, 0xF4, 0x18, 0x00, 0x03, 0x00, 0x64, 0x70,
+    0x73, 0x48, 0x15, 0x00, 0x48, 0x1A, 0x00, 0x60, 0x15, 0x00, 0x02, 0x00, 0x6C, 0x6D, 0xB0, 0x16,
+    0x00, 0x52, 0x1A, 0x00, 0x02, 0x00, 0x65, 0x6D, 0x5C, 0x1A, 0x00, 0x62, 0x1A, 0x00, 0x04, 0x00,
+    0x2E, 0x6E, 0x72, 0x73, 0x68, 0x1A, 0x00, 0x6C, 0x1A, 0x00, 0x76, 0x1A, 0x00, 0x7C, 0x1A, 0x00,
+    0x01, 0x00, 0x65, 0x48, 0x15, 0x00, 0x02, 0x00, 0x61, 0x6F, 0x82, 0x1A, 0x00, 0x8C, 0x1A, 0x00,
+    0x03, 0x00, 0x61, 0x65, 0x69, 0x9A, 0x1A, 0x00, 0x2C, 0x12, 0x00, 0xA0, 0x1A, 0x00, 0x01, 0x00,
+    0x72, 0xA6, 0x1A, 0x00, 0x03, 0x00, 0x61, 0x6F, 0xC3, 0xAC, 0x1A, 0x00, 0xBA, 0x1A, 0x00, 0xC0,
+    0x1A, 0x00, 0x0A, 0x00, 0x61, 0x64, 0x66, 0x67, 0x68, 0x69, 0x6D, 0x6F, 0x74, 0xC3, 0xC6, 0x1A,
+    0x00, 0xD0, 0x1A, 0x00, 0xC4, 0x19, 0x00, 0xD6, 0x1A, 0x00, 0xDC, 0x1A, 0x00, 0xF2, 0x1A, 0x00,
+    0xF8, 0x1A, 0x00, 0xC6, 0x1A, 0x00, 0xFE, 0x1A, 0x00, 0x08, 0x1B, 0x00, 0x02, 0x00, 0x2E, 0x73,
+    0x68, 0x1A, 0x00, 0x7C, 0x1A, 0x00, 0x04, 0x00, 0x6C, 0x6D, 0x6F, 0x74, 0x0E, 0x1B, 0x00, 0x18,
+    0x1B, 0x00, 0xAE, 0x18, 0x00, 0x1E, 0x1B, 0x00, 0x01, 0x00, 0x61, 0x22, 0x17, 0x00, 0x01, 0x00,
+    0x6C, 0xB0, 0x16, 0x00, 0x01, 0x00, 0x75, 0x34, 0x17, 0x00, 0x04, 0x00, 0x6E, 0x70, 0x74, 0xC3,
+    0x24, 0x1B, 0x00, 0xB0, 0x16, 0x00, 0xB0, 0x16, 0x00, 0x2A, 0x1B, 0x00, 0x16, 0x01, 0x09, 0x00,
+    0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73,
+    0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x80, 0x0A, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E,
+    0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B,
+    0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00,
+    0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E,
+    0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x6E, 0x0B, 0x00, 0x01, 0x00, 0x67, 0x30, 0x1B, 0x00, 0x04, 0x00,
+    0x63, 0x6C, 0x6E, 0x78, 0x48, 0x15, 0x00, 0x36, 0x1B, 0x00, 0x6A, 0x1B, 0x00, 0x1C, 0x17, 0x00,
+    0x07, 0x00, 0x61, 0x67, 0x6C, 0x6E, 0x6F, 0x73, 0x74, 0x70, 0x1B, 0x00, 0x76, 0x1B, 0x00, 0x7C,
+    0x1B, 0x00, 0x82, 0x1B, 0x00, 0x2E, 0x17, 0x00, 0xB0, 0x16, 0x00, 0xF4, 0x18, 0x00, 0x04, 0x00,
+    0x63, 0x6C, 0x6E, 0x72, 0x48, 0x15, 0x00, 0x88, 0x1B, 0x00, 0x8E, 0x1B, 0x00, 0x94, 0x1B, 0x00,
+    0x03, 0x00, 0x6E, 0x72, 0x74, 0xB0, 0x16, 0x00, 0x24, 0x1B, 0x00, 0xB0, 0x16, 0x00, 0x01, 0x00,
+    0x6C, 0x9A, 0x1B, 0x00, 0x03, 0x00, 0x6D, 0x6E, 0x72, 0xB0, 0x16, 0x00, 0xB0, 0x16, 0x00, 0x34,
+    0x17, 0x00, 0x05, 0x00, 0x63, 0x66, 0x6F, 0x74, 0x75, 0x48, 0x15, 0x00, 0x48, 0x15, 0x00, 0xAE,
+    0x18, 0x00, 0xB0, 0x16, 0x00, 0x3E, 0x18, 0x00, 0x02, 0x00, 0x2E, 0x72, 0x6E, 0x0B, 0x00, 0xA0,
+    0x1B, 0x00, 0x03, 0x01, 0x5F, 0x00, 0x65, 0x73, 0x7A, 0xA6, 0x1B, 0x00, 0xB0, 0x17, 0x00, 0xB0,
+    0x17, 0x00, 0x01, 0x00, 0x65, 0x84, 0x16, 0x00, 0x01, 0x00, 0x74, 0xAC, 0x1B, 0x00, 0x02, 0x00,
+    0x75, 0xC3, 0x84, 0x16, 0x00, 0x88, 0x16, 0x00, 0x02, 0x00, 0x63, 0x64, 0xB6, 0x1B, 0x00, 0xC0,
+    0x1B, 0x00, 0x03, 0x00, 0x69, 0x6F, 0xC3, 0xCA, 0x1B, 0x00, 0xD0, 0x1B, 0x00, 0xD6, 0x1B, 0x00,
+    0x01, 0x00, 0x6E, 0x1C, 0x17, 0x00, 0x03, 0x00, 0x63, 0x65, 0x74, 0xB0, 0x16, 0x00, 0x08, 0x0B,
+    0x00, 0xB0, 0x16, 0x00, 0x01, 0x00, 0x73, 0x7C, 0x1A, 0x00, 0x01, 0x00, 0x74, 0xB0, 0x16, 0x00,
+    0x02, 0x00, 0x6E, 0x74, 0xDC, 0x1B, 0x00, 0xE2, 0x1B, 0x00, 0x04, 0x00, 0x2E, 0x61, 0x6F, 0x74,
+    0x6E, 0x0B, 0x00, 0xE8, 0x1B, 0x00, 0x82, 0x1A, 0x00, 0xF6, 0x1B, 0x00, 0x01, 0x00, 0x6F, 0xB6,
+    0x16, 0x00, 0x03, 0x00, 0x6C, 0x6E, 0x72, 0xF6, 0x1B, 0x00, 0xFC, 0x1B, 0x00, 0x02, 0x1C, 0x00,
+    0x04, 0x00, 0x64, 0x6E, 0x72, 0x74, 0x5E, 0x18, 0x00, 0x38, 0x18, 0x00, 0x08, 0x1C, 0x00, 0xF4,
+    0x18, 0x00, 0x03, 0x00, 0x63, 0x65, 0x72, 0xB0, 0x16, 0x00, 0x16, 0x1C, 0x00, 0xB0, 0x16, 0x00,
+    0x18, 0x01, 0x0A, 0x00, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D,
+    0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x80, 0x0A, 0x00, 0x1C,
+    0x1C, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17,
+    0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00,
+    0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8,
+    0x17, 0x00, 0x22, 0x1C, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17,
+    0x00, 0xE8, 0x17, 0x00, 0x03, 0x00, 0x6C, 0x72, 0x73, 0x28, 0x1C, 0x00, 0x2E, 0x1C, 0x00, 0x34,
+    0x1C, 0x00, 0x17, 0x01, 0x0A, 0x00, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C,
+    0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x80, 0x0A, 0x00,
+    0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8,
+    0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17,
+    0x00, 0x46, 0x1C, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00,
+    0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8,
+    0x17, 0x00, 0x02, 0x01, 0x5F, 0x00, 0x2E, 0x69, 0x80, 0x0A, 0x00, 0x50, 0x1C, 0x00, 0x02, 0x01,
+    0x5F, 0x00, 0x2E, 0x65, 0x80, 0x0A, 0x00, 0x48, 0x15, 0x00, 0x01, 0x00, 0x74, 0x5A, 0x1C, 0x00,
+    0x02, 0x00, 0x65, 0x69, 0xA0, 0x1B, 0x00, 0x64, 0x1C, 0x00, 0x03, 0x00, 0x64, 0x6E, 0x72, 0x9E,
+    0x17, 0x00, 0x34, 0x17, 0x00, 0x6E, 0x1C, 0x00, 0x02, 0x00, 0x69, 0x74, 0x80, 0x1C, 0x00, 0x86,
+    0x1C, 0x00, 0x02, 0x01, 0x5F, 0x00, 0x61, 0x6E, 0xC0, 0x16, 0x00, 0xB0, 0x17, 0x00, 0x01, 0x00,
+    0x6D, 0xB0, 0x16, 0x00, 0x04, 0x00, 0x2E, 0x6C, 0x6E, 0x73, 0x90, 0x1C, 0x00, 0x94, 0x1C, 0x00,
+    0x9A, 0x1C, 0x00, 0xA0, 0x1C, 0x00, 0x04, 0x00, 0x6C, 0x6D, 0x72, 0x75, 0xA6, 0x1C, 0x00, 0x1C,
+    0x17, 0x00, 0xAC, 0x1C, 0x00, 0xB2, 0x1C, 0x00, 0x02, 0x00, 0x62, 0x63, 0xB8, 0x1C, 0x00, 0x9E,
+    0x17, 0x00, 0x04, 0x01, 0x5F, 0x00, 0x61, 0x6E, 0x73, 0x74, 0xC0, 0x16, 0x00, 0xB0, 0x17, 0x00,
+    0xB0, 0x17, 0x00, 0xB0, 0x17, 0x00, 0x06, 0x01, 0x5F, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x73, 0x7A,
+    0xBE, 0x1C, 0x00, 0xC4, 0x1C, 0x00, 0xCE, 0x1C, 0x00, 0xD4, 0x1C, 0x00, 0xB0, 0x17, 0x00, 0xB0,
+    0x17, 0x00, 0x03, 0x00, 0x64, 0x70, 0x72, 0xDA, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xDA, 0x1C, 0x00,
+    0x01, 0x00, 0x6C, 0x3E, 0x18, 0x00, 0x04, 0x00, 0x63, 0x6C, 0x72, 0x74, 0xC0, 0x16, 0x00, 0x28,
+    0x17, 0x00, 0xEA, 0x1C, 0x00, 0xF4, 0x1C, 0x00, 0x01, 0x00, 0x6F, 0xFE, 0x1C, 0x00, 0x00, 0x02,
+    0x82, 0x00, 0x01, 0x00, 0x70, 0xB0, 0x16, 0x00, 0x18, 0x01, 0x0A, 0x00, 0x2E, 0x61, 0x62, 0x63,
+    0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76,
+    0x77, 0x78, 0x79, 0x7A, 0x80, 0x0A, 0x00, 0x08, 0x1D, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00,
+    0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8,
+    0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0x12, 0x1D, 0x00, 0xE8, 0x17,
+    0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00,
+    0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0xE8, 0x17, 0x00, 0x01, 0x02, 0x82, 0x00,
+    0x2E, 0x80, 0x0A, 0x00, 0x01, 0x00, 0x72, 0x18, 0x1D, 0x00, 0x02, 0x02, 0x82, 0x00, 0x2E, 0x73,
+    0x80, 0x0A, 0x00, 0x1E, 0x1D, 0x00, 0x01, 0x00, 0xA9, 0x24, 0x1D, 0x00, 0x01, 0x00, 0x74, 0xC4,
+    0x19, 0x00, 0x01, 0x00, 0x69, 0x2A, 0x1D, 0x00, 0x01, 0x00, 0x65, 0x30, 0x1D, 0x00, 0x02, 0x00,
+    0x63, 0x64, 0x28, 0x17, 0x00, 0xF6, 0x1B, 0x00, 0x01, 0x00, 0x73, 0x36, 0x1D, 0x00, 0x02, 0x00,
+    0x6E, 0x72, 0xB0, 0x16, 0x00, 0xB0, 0x16, 0x00, 0x01, 0x00, 0x6F, 0xAE, 0x18, 0x00, 0x07, 0x00,
+    0x62, 0x64, 0x69, 0x6E, 0x6F, 0x72, 0x73, 0x3C, 0x1D, 0x00, 0x42, 0x1D, 0x00, 0x08, 0x0B, 0x00,
+    0x54, 0x1D, 0x00, 0x5A, 0x1D, 0x00, 0x60, 0x1D, 0x00, 0x7E, 0x1D, 0x00, 0x06, 0x00, 0x2E, 0x64,
+    0x69, 0x6F, 0x72, 0x73, 0x80, 0x0A, 0x00, 0x88, 0x1D, 0x00, 0x08, 0x0B, 0x00, 0x5A, 0x1D, 0x00,
+    0x9E, 0x1D, 0x00, 0x80, 0x0A, 0x00, 0x07, 0x00, 0x2E, 0x61, 0x62, 0x64, 0x6D, 0x73, 0x74, 0x80,
+    0x0A, 0x00, 0xB4, 0x1D, 0x00, 0xCA, 0x1D, 0x00, 0xD0, 0x1D, 0x00, 0xDA, 0x1D, 0x00, 0xE0, 0x1D,
+    0x00, 0xEA, 0x1D, 0x00, 0x01, 0x01, 0x78, 0x00, 0x2E, 0x80, 0x0A, 0x00, 0x05, 0x00, 0x2E, 0x6C,
+    0x6E, 0x73, 0x74, 0x80, 0x0A, 0x00, 0xF0, 0x1D, 0x00, 0x2E, 0x17, 0x00, 0xF6, 0x1D, 0x00, 0xFC,
+    0x1D, 0x00, 0x01, 0x00, 0x72, 0x02, 0x1E, 0x00, 0x01, 0x00, 0x72, 0x08, 0x1E, 0x00, 0x04, 0x00,
+    0x61, 0x65, 0x69, 0x74, 0x0E, 0x1E, 0x00, 0x1C, 0x1E, 0x00, 0x22, 0x1E, 0x00, 0x28, 0x1E, 0x00,
+    0x01, 0x00, 0x74, 0x08, 0x1E, 0x00, 0x05, 0x00, 0x61, 0x65, 0x6F, 0x75, 0xC3, 0x32, 0x1E, 0x00,
+    0x3C, 0x1E, 0x00, 0x42, 0x1E, 0x00, 0x48, 0x1E, 0x00, 0x4E, 0x1E, 0x00, 0x01, 0x00, 0x75, 0x54,
+    0x1E, 0x00, 0x08, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6E, 0x6F, 0x75, 0xC3, 0x5A, 0x1E, 0x00, 0x7A,
+    0x1E, 0x00, 0x8E, 0x1E, 0x00, 0x9A, 0x1E, 0x00, 0xA6, 0x1E, 0x00, 0xAC, 0x1E, 0x00, 0xBC, 0x1E,
+    0x00, 0xC0, 0x1E, 0x00, 0x02, 0x00, 0x73, 0x75, 0xD6, 0x1E, 0x00, 0x54, 0x1E, 0x00, 0x01, 0x00,
+    0x65, 0xF4, 0x1E, 0x00, 0x07, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0xFA, 0x1E, 0x00,
+    0x0E, 0x1F, 0x00, 0x16, 0x1F, 0x00, 0x1E, 0x1F, 0x00, 0x22, 0x1F, 0x00, 0x2A, 0x1F, 0x00, 0x32,
+    0x1F, 0x00, 0x07, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x1E, 0x1F, 0x00, 0x1E, 0x1F,
+    0x00, 0x48, 0x1F, 0x00, 0x1E, 0x1F, 0x00, 0x1E, 0x1F, 0x00, 0x1E, 0x1F, 0x00, 0x60, 0x1F, 0x00,
+    0x01, 0x00, 0x6D, 0x76, 0x1F, 0x00, 0x01, 0x00, 0x6D, 0x7C, 0x1F, 0x00, 0x08, 0x00, 0x61, 0x65,
+    0x68, 0x69, 0x6F, 0x74, 0x75, 0xC3, 0x82, 0x1F, 0x00, 0xB6, 0x1F, 0x00, 0xD2, 0x1F, 0x00, 0xD6,
+    0x1F, 0x00, 0xE6, 0x1F, 0x00, 0xFA, 0x1F, 0x00, 0x00, 0x20, 0x00, 0x08, 0x20, 0x00, 0x01, 0x00,
+    0x6C, 0x1E, 0x20, 0x00, 0x02, 0x00, 0x6C, 0x6F, 0x2C, 0x20, 0x00, 0x32, 0x20, 0x00, 0x01, 0x00,
+    0x6E, 0x50, 0x20, 0x00, 0x01, 0x00, 0x73, 0x66, 0x20, 0x00, 0x02, 0x00, 0x65, 0x6F, 0x6C, 0x20,
+    0x00, 0x8A, 0x20, 0x00, 0x06, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xA8, 0x20, 0x00, 0xE4,
+    0x20, 0x00, 0xE8, 0x20, 0x00, 0xF8, 0x20, 0x00, 0x0C, 0x21, 0x00, 0x24, 0x21, 0x00, 0x01, 0x00,
+    0x62, 0x3A, 0x21, 0x00, 0x01, 0x00, 0x61, 0x40, 0x21, 0x00, 0x02, 0x00, 0x62, 0x72, 0x46, 0x21,
+    0x00, 0x68, 0x21, 0x00, 0x01, 0x00, 0x6C, 0x72, 0x21, 0x00, 0x02, 0x00, 0x61, 0x69, 0x78, 0x21,
+    0x00, 0x7E, 0x21, 0x00, 0x00, 0x02, 0x68, 0x00, 0x01, 0x00, 0xB3, 0x84, 0x21, 0x00, 0x04, 0x00,
+    0x2E, 0x69, 0x6E, 0x73, 0x88, 0x21, 0x00, 0x0C, 0x17, 0x00, 0xBA, 0x1A, 0x00, 0xBA, 0x1A, 0x00,
+    0x01, 0x00, 0x6E, 0x8C, 0x21, 0x00, 0x02, 0x00, 0x6F, 0xC3, 0x92, 0x21, 0x00, 0x98, 0x21, 0x00,
+    0x01, 0x00, 0x6F, 0x32, 0x20, 0x00, 0x02, 0x00, 0x2E, 0x73, 0x88, 0x21, 0x00, 0xBA, 0x1A, 0x00,
+    0x01, 0x00, 0x6E, 0x08, 0x1E, 0x00, 0x03, 0x00, 0x61, 0x65, 0x6F, 0x08, 0x0B, 0x00, 0xC6, 0x1A,
+    0x00, 0xC6, 0x1A, 0x00, 0x01, 0x00, 0x65, 0x2E, 0x17, 0x00, 0x01, 0x00, 0x6F, 0x08, 0x0B, 0x00,
+    0x03, 0x00, 0x2E, 0x72, 0x73, 0x88, 0x21, 0x00, 0x9E, 0x21, 0x00, 0xBA, 0x1A, 0x00, 0x01, 0x00,
+    0x63, 0xAC, 0x21, 0x00, 0x01, 0x00, 0x61, 0xB2, 0x21, 0x00, 0x01, 0x00, 0x73, 0xB8, 0x21, 0x00,
+    0x01, 0x00, 0x72, 0xBE, 0x21, 0x00, 0x01, 0x00, 0x6C, 0xC4, 0x21, 0x00, 0x01, 0x00, 0x73, 0xBA,
+    0x1A, 0x00, 0x02, 0x00, 0x6F, 0x72, 0x80, 0x0A, 0x00, 0x08, 0x1E, 0x00, 0x01, 0x00, 0x69, 0x32,
+    0x20, 0x00, 0x01, 0x00, 0x6C, 0x08, 0x1E, 0x00, 0x01, 0x00, 0x65, 0x32, 0x20, 0x00, 0x01, 0x00,
+    0x2E, 0x80, 0x0A, 0x00, 0x01, 0x00, 0x63, 0x08, 0x1E, 0x00, 0x01, 0x00, 0x68, 0x2C, 0x20, 0x00,
+    0x05, 0x00, 0x2E, 0x69, 0x6D, 0x6E, 0x73, 0x88, 0x21, 0x00, 0x0C, 0x17, 0x00, 0xCA, 0x21, 0x00,
+    0xBA, 0x1A, 0x00, 0xBA, 0x1A, 0x00, 0x02, 0x00, 0x61, 0x6F, 0xD0, 0x21, 0x00, 0xD0, 0x21, 0x00,
+    0x03, 0x00, 0x61, 0x65, 0x6F, 0xDC, 0x21, 0x00, 0xDC, 0x21, 0x00, 0xDC, 0x21, 0x00, 0x01, 0x00,
+    0x65, 0xA6, 0x1A, 0x00, 0x01, 0x00, 0x6F, 0xE6, 0x21, 0x00, 0x02, 0x00, 0x6E, 0x73, 0xBA, 0x1A,
+    0x00, 0xBA, 0x1A, 0x00, 0x01, 0x00, 0x65, 0xEC, 0x21, 0x00, 0x03, 0x00, 0xA1, 0xA9, 0xAD, 0xF2,
+    0x21, 0x00, 0x00, 0x22, 0x00, 0x0E, 0x22, 0x00, 0x01, 0x00, 0x65, 0x18, 0x22, 0x00, 0x01, 0x00,
+    0x69, 0x08, 0x1E, 0x00, 0x01, 0x00, 0x74, 0x26, 0x22, 0x00, 0x01, 0x00, 0x73, 0x2C, 0x22, 0x00,
+    0x00, 0x03, 0x79, 0x00, 0x01, 0x00, 0x6C, 0x32, 0x22, 0x00, 0x01, 0x00, 0x6E, 0x38, 0x22, 0x00,
+    0x08, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x75, 0xC3, 0x74, 0x22, 0x00, 0x74, 0x22, 0x00,
+    0x78, 0x22, 0x00, 0x74, 0x22, 0x00, 0x7C, 0x22, 0x00, 0x74, 0x22, 0x00, 0x74, 0x22, 0x00, 0x82,
+    0x22, 0x00, 0x01, 0x00, 0x6E, 0x98, 0x22, 0x00, 0x00, 0x02, 0x7E, 0x00, 0x01, 0x00, 0x63, 0x9E,
+    0x22, 0x00, 0x01, 0x00, 0x61, 0xA4, 0x22, 0x00, 0x02, 0x00, 0x61, 0x6F, 0xA8, 0x22, 0x00, 0xA4,
+    0x22, 0x00, 0x01, 0x00, 0x64, 0x32, 0x22, 0x00, 0x01, 0x00, 0x61, 0xB0, 0x22, 0x00, 0x01, 0x00,
+    0x74, 0xB6, 0x22, 0x00, 0x01, 0x00, 0x6E, 0xBC, 0x22, 0x00, 0x01, 0x00, 0x65, 0xC6, 0x22, 0x00,
+    0x01, 0x00, 0x70, 0xCC, 0x22, 0x00, 0x01, 0x00, 0x6F, 0xD2, 0x22, 0x00, 0x01, 0x00, 0x70, 0xD8,
+    0x22, 0x00, 0x01, 0x00, 0x74, 0xDE, 0x22, 0x00, 0x01, 0x00, 0x74, 0x9E, 0x22, 0x00, 0x01, 0x00,
+    0x6D, 0x08, 0x1E, 0x00, 0x01, 0x00, 0x6C, 0xE4, 0x22, 0x00, 0x02, 0x00, 0x6F, 0x70, 0x32, 0x20,
+    0x00, 0xCC, 0x22, 0x00, 0x02, 0x00, 0x64, 0x73, 0xEA, 0x22, 0x00, 0x2C, 0x20, 0x00, 0x01, 0x00,
+    0x6F, 0xA4, 0x22, 0x00, 0x01, 0x00, 0x6E, 0xF0, 0x22, 0x00, 0x01, 0x00, 0x61, 0xF6, 0x22, 0x00,
+    0x01, 0x00, 0x73, 0x14, 0x23, 0x00, 0x01, 0x00, 0x6D, 0x1A, 0x23, 0x00, 0x06, 0x00, 0x61, 0x65,
+    0x69, 0x6F, 0x75, 0xC3, 0x24, 0x23, 0x00, 0x5A, 0x23, 0x00, 0x84, 0x23, 0x00, 0xA2, 0x23, 0x00,
+    0xD0, 0x23, 0x00, 0xEE, 0x23, 0x00, 0x01, 0x00, 0x6C, 0xFC, 0x23, 0x00, 0x01, 0x00, 0x69, 0x06,
+    0x24, 0x00, 0x01, 0x00, 0x6C, 0x10, 0x24, 0x00, 0x01, 0x00, 0x69, 0x16, 0x24, 0x00, 0x07, 0x00,
+    0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x74, 0x22, 0x00, 0x74, 0x22, 0x00, 0x78, 0x22, 0x00,
+    0x74, 0x22, 0x00, 0x74, 0x22, 0x00, 0x74, 0x22, 0x00, 0x82, 0x22, 0x00, 0x02, 0x00, 0x6F, 0x72,
+    0x32, 0x20, 0x00, 0x08, 0x1E, 0x00, 0x01, 0x00, 0x61, 0x1C, 0x24, 0x00, 0x01, 0x00, 0x63, 0x22,
+    0x24, 0x00, 0x01, 0x00, 0xA9, 0xDC, 0x18, 0x00, 0x01, 0x00, 0x6F, 0x28, 0x24, 0x00, 0x01, 0x00,
+    0x6F, 0xBC, 0x1E, 0x00, 0x01, 0x00, 0x61, 0x32, 0x20, 0x00, 0x01, 0x00, 0x65, 0x2E, 0x24, 0x00,
+    0x03, 0x00, 0x65, 0x6F, 0x72, 0x26, 0x22, 0x00, 0x32, 0x20, 0x00, 0x02, 0x1E, 0x00, 0x00, 0x02,
+    0x5A, 0x00, 0x01, 0x00, 0xA1, 0x34, 0x24, 0x00, 0x07, 0x00, 0x62, 0x64, 0x6D, 0x6E, 0x72, 0x73,
+    0x74, 0x38, 0x24, 0x00, 0x42, 0x24, 0x00, 0x50, 0x24, 0x00, 0x56, 0x24, 0x00, 0x5C, 0x24, 0x00,
+    0x6E, 0x24, 0x00, 0x7C, 0x24, 0x00, 0x01, 0x00, 0x6D, 0x82, 0x24, 0x00, 0x01, 0x00, 0x6F, 0x88,
+    0x24, 0x00, 0x03, 0x00, 0x61, 0x65, 0x6F, 0xC6, 0x1A, 0x00, 0xC6, 0x1A, 0x00, 0xC6, 0x1A, 0x00,
+    0x03, 0x00, 0xA1, 0xA9, 0xAD, 0x8E, 0x24, 0x00, 0x00, 0x22, 0x00, 0xA8, 0x24, 0x00, 0x01, 0x00,
+    0x6C, 0xB2, 0x24, 0x00, 0x01, 0x00, 0x65, 0xB8, 0x24, 0x00, 0x04, 0x00, 0x63, 0x67, 0x6C, 0x6D,
+    0xBE, 0x24, 0x00, 0xC4, 0x24, 0x00, 0xCA, 0x24, 0x00, 0xD0, 0x24, 0x00, 0x03, 0x00, 0x63, 0x67,
+    0x71, 0xD6, 0x24, 0x00, 0xDC, 0x24, 0x00, 0xE2, 0x24, 0x00, 0x05, 0x00, 0x67, 0x6A, 0x6C, 0x6D,
+    0x74, 0xE8, 0x24, 0x00, 0xF6, 0x24, 0x00, 0x04, 0x25, 0x00, 0x0E, 0x25, 0x00, 0x24, 0x25, 0x00,
+    0x07, 0x00, 0x62, 0x63, 0x65, 0x67, 0x6E, 0x70, 0x74, 0x2A, 0x25, 0x00, 0x30, 0x25, 0x00, 0x36,
+    0x25, 0x00, 0x3C, 0x25, 0x00, 0xC4, 0x24, 0x00, 0x46, 0x25, 0x00, 0x4C, 0x25, 0x00, 0x01, 0x00,
+    0x6F, 0x56, 0x25, 0x00, 0x01, 0x00, 0x72, 0x9E, 0x22, 0x00, 0x02, 0x00, 0x62, 0x64, 0xC4, 0x24,
+    0x00, 0x5C, 0x25, 0x00, 0x04, 0x00, 0xA1, 0xA9, 0xAD, 0xB3, 0x62, 0x25, 0x00, 0x6C, 0x25, 0x00,
+    0x72, 0x25, 0x00, 0x84, 0x25, 0x00, 0x01, 0x00, 0x6E, 0x8A, 0x25, 0x00, 0x01, 0x00, 0x69, 0x90,
+    0x25, 0x00, 0x01, 0x00, 0x74, 0x96, 0x25, 0x00, 0x01, 0x00, 0x6F, 0xA0, 0x25, 0x00, 0x01, 0x00,
+    0x65, 0xA6, 0x25, 0x00, 0x02, 0x00, 0x61, 0x6F, 0xAC, 0x25, 0x00, 0xB2, 0x25, 0x00, 0x01, 0x00,
+    0x66, 0xBC, 0x25, 0x00, 0x01, 0x00, 0x72, 0xCA, 0x25, 0x00, 0x02, 0x00, 0x69, 0x6C, 0xD0, 0x25,
+    0x00, 0xD6, 0x25, 0x00, 0x01, 0x00, 0x69, 0xDC, 0x25, 0x00, 0x03, 0x00, 0x61, 0x69, 0x6F, 0xCC,
+    0x22, 0x00, 0xE6, 0x25, 0x00, 0x32, 0x20, 0x00, 0x02, 0x00, 0x61, 0x74, 0xCC, 0x22, 0x00, 0x9E,
+    0x22, 0x00, 0x01, 0x00, 0x65, 0x26, 0x22, 0x00, 0x02, 0x00, 0x65, 0x6F, 0x04, 0x26, 0x00, 0x32,
+    0x20, 0x00, 0x02, 0x00, 0x65, 0x6F, 0x08, 0x1E, 0x00, 0x32, 0x20, 0x00, 0x01, 0x00, 0x6C, 0x0A,
+    0x26, 0x00, 0x01, 0x00, 0x61, 0x14, 0x26, 0x00, 0x00, 0x01, 0x0A, 0x00, 0x02, 0x00, 0x61, 0x6F,
+    0x1A, 0x26, 0x00, 0x1A, 0x26, 0x00, 0x01, 0x00, 0x65, 0x24, 0x26, 0x00, 0x01, 0x00, 0x2E, 0x68,
+    0x1A, 0x00, 0x02, 0x00, 0x2E, 0x73, 0x2A, 0x26, 0x00, 0x2E, 0x26, 0x00, 0x03, 0x00, 0x2E, 0x6E,
+    0x73, 0x2A, 0x26, 0x00, 0x08, 0x1E, 0x00, 0x2E, 0x26, 0x00, 0x01, 0x00, 0x6C, 0x34, 0x26, 0x00,
+    0x01, 0x00, 0x74, 0x3E, 0x26, 0x00, 0x01, 0x00, 0x2E, 0x44, 0x26, 0x00, 0x03, 0x00, 0x2E, 0x6D,
+    0x73, 0x88, 0x21, 0x00, 0xCA, 0x21, 0x00, 0xBA, 0x1A, 0x00, 0x01, 0x00, 0x2E, 0x88, 0x21, 0x00,
+    0x01, 0x00, 0xA1, 0x48, 0x26, 0x00, 0x02, 0x00, 0x2E, 0x73, 0x80, 0x0A, 0x00, 0x2E, 0x17, 0x00,
+    0x01, 0x00, 0x75, 0x56, 0x26, 0x00, 0x01, 0x00, 0x65, 0x5C, 0x26, 0x00, 0x05, 0x00, 0x61, 0x65,
+    0x69, 0x75, 0xC3, 0x62, 0x26, 0x00, 0x68, 0x26, 0x00, 0x72, 0x26, 0x00, 0x80, 0x26, 0x00, 0x86,
+    0x26, 0x00, 0x01, 0x00, 0x63, 0x9C, 0x26, 0x00, 0x01, 0x00, 0x75, 0xA2, 0x26, 0x00, 0x02, 0x00,
+    0x65, 0x72, 0xA8, 0x26, 0x00, 0x9E, 0x22, 0x00, 0x01, 0x00, 0xAD, 0xAE, 0x26, 0x00, 0x02, 0x00,
+    0x61, 0xC3, 0xB4, 0x26, 0x00, 0xBA, 0x26, 0x00, 0x01, 0x00, 0x6F, 0xC6, 0x1A, 0x00, 0x01, 0x00,
+    0x61, 0xC6, 0x1A, 0x00, 0x01, 0x00, 0x66, 0x08, 0x1E, 0x00, 0x01, 0x00, 0xA1, 0xC0, 0x26, 0x00,
+    0x01, 0x00, 0xC3, 0xC6, 0x26, 0x00, 0x0C, 0x01, 0xD5, 0x00, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68,
+    0x6D, 0x70, 0x71, 0x73, 0x74, 0x76, 0xCC, 0x26, 0x00, 0xCC, 0x26, 0x00, 0xCC, 0x26, 0x00, 0xCC,
+    0x26, 0x00, 0xCC, 0x26, 0x00, 0xD0, 0x26, 0x00, 0xCC, 0x26, 0x00, 0xCC, 0x26, 0x00, 0xCC, 0x26,
+    0x00, 0xCC, 0x26, 0x00, 0xCC, 0x26, 0x00, 0xCC, 0x26, 0x00, 0x01, 0x00, 0x74, 0xD4, 0x26, 0x00,
+    0x01, 0x00, 0x62, 0xDA, 0x26, 0x00, 0x01, 0x00, 0x61, 0xE0, 0x26, 0x00, 0x01, 0x00, 0x61, 0xA2,
+    0x26, 0x00, 0x01, 0x00, 0x74, 0x02, 0x27, 0x00, 0x01, 0x00, 0x69, 0x08, 0x27, 0x00, 0x01, 0x00,
+    0x69, 0x0E, 0x27, 0x00, 0x01, 0x00, 0x69, 0x9E, 0x22, 0x00, 0x01, 0x00, 0x74, 0x2C, 0x20, 0x00,
+    0x01, 0x00, 0x74, 0x02, 0x1E, 0x00, 0x01, 0x00, 0x72, 0x2C, 0x27, 0x00, 0x02, 0x00, 0x61, 0x6F,
+    0x32, 0x20, 0x00, 0x32, 0x20, 0x00, 0x02, 0x00, 0x61, 0x6F, 0x32, 0x27, 0x00, 0x32, 0x27, 0x00,
+    0x02, 0x00, 0x61, 0x65, 0x3C, 0x27, 0x00, 0x42, 0x27, 0x00, 0x01, 0x00, 0x67, 0x08, 0x1E, 0x00,
+    0x01, 0x00, 0x67, 0x50, 0x27, 0x00, 0x01, 0x00, 0xB3, 0x56, 0x27, 0x00, 0x01, 0x00, 0x69, 0xCC,
+    0x22, 0x00, 0x01, 0x00, 0x6F, 0x5C, 0x27, 0x00, 0x03, 0x00, 0x2E, 0x6D, 0x73, 0x2A, 0x26, 0x00,
+    0x7A, 0x27, 0x00, 0x2E, 0x26, 0x00, 0x01, 0x00, 0x65, 0x08, 0x1E, 0x00, 0x01, 0x00, 0x74, 0x80,
+    0x27, 0x00, 0x01, 0x00, 0x61, 0x86, 0x27, 0x00, 0x03, 0x00, 0x61, 0x65, 0x70, 0xA4, 0x27, 0x00,
+    0xAA, 0x27, 0x00, 0xB0, 0x27, 0x00, 0x01, 0x00, 0x7A, 0x08, 0x1E, 0x00, 0x01, 0x00, 0x6E, 0xB6,
+    0x27, 0x00, 0x01, 0x00, 0x72, 0x2C, 0x20, 0x00, 0x01, 0x00, 0x69, 0xBC, 0x27, 0x00, 0x01, 0x00,
+    0x74, 0xDA, 0x27, 0x00, 0x04, 0x00, 0x65, 0x69, 0x6F, 0x74, 0xE0, 0x27, 0x00, 0xEA, 0x27, 0x00,
+    0xF4, 0x27, 0x00, 0xFA, 0x27, 0x00, 0x02, 0x00, 0x6D, 0x74, 0x04, 0x28, 0x00, 0x08, 0x1E, 0x00,
+    0x02, 0x00, 0x63, 0x71, 0x0A, 0x28, 0x00, 0x12, 0x28, 0x00, 0x02, 0x00, 0x61, 0x6F, 0xA4, 0x22,
+    0x00, 0xA4, 0x22, 0x00, 0x02, 0x00, 0x6D, 0x72, 0x32, 0x22, 0x00, 0x08, 0x1E, 0x00, 0x04, 0x00,
+    0x61, 0x65, 0x6F, 0xC3, 0x16, 0x28, 0x00, 0x16, 0x28, 0x00, 0x16, 0x28, 0x00, 0x1A, 0x28, 0x00,
+    0x01, 0x00, 0x6E, 0x28, 0x28, 0x00, 0x02, 0x00, 0x65, 0x72, 0x32, 0x20, 0x00, 0x08, 0x1E, 0x00,
+    0x00, 0x01, 0xAE, 0x00, 0x01, 0x00, 0x76, 0x9E, 0x22, 0x00, 0x01, 0x00, 0x63, 0x32, 0x28, 0x00,
+    0x01, 0x00, 0x2E, 0x90, 0x1C, 0x00, 0x01, 0x00, 0x65, 0xA2, 0x26, 0x00, 0x01, 0x00, 0x76, 0x08,
+    0x1E, 0x00, 0x01, 0x00, 0x64, 0x38, 0x28, 0x00, 0x01, 0x00, 0x72, 0x3E, 0x28, 0x00, 0x01, 0x00,
+    0x6C, 0x44, 0x28, 0x00, 0x02, 0x00, 0x2E, 0x73, 0x4E, 0x28, 0x00, 0x52, 0x28, 0x00, 0x01, 0x00,
+    0x6C, 0x58, 0x28, 0x00, 0x01, 0x00, 0x72, 0x5E, 0x28, 0x00, 0x01, 0x00, 0x61, 0x6C, 0x28, 0x00,
+    0x02, 0x00, 0x65, 0x72, 0x72, 0x28, 0x00, 0x78, 0x28, 0x00, 0x02, 0x00, 0x61, 0x6D, 0x32, 0x20,
+    0x00, 0x08, 0x1E, 0x00, 0x02, 0x00, 0x61, 0x72, 0xC6, 0x1A, 0x00, 0x9E, 0x22, 0x00, 0x02, 0x00,
+    0x63, 0x71, 0x7E, 0x28, 0x00, 0x84, 0x28, 0x00, 0x02, 0x00, 0x6E, 0x73, 0x8A, 0x28, 0x00, 0x90,
+    0x28, 0x00, 0x01, 0x00, 0x70, 0x08, 0x1E, 0x00, 0x01, 0x00, 0x62, 0x08, 0x1E, 0x00, 0x01, 0x00,
+    0x63, 0x36, 0x1D, 0x00, 0x01, 0x00, 0x63, 0x9E, 0x28, 0x00, 0x01, 0x00, 0x76, 0xA4, 0x28, 0x00,
+    0x01, 0x00, 0x72, 0xAA, 0x28, 0x00, 0x01, 0x00, 0x68, 0xB0, 0x28, 0x00, 0x01, 0x00, 0x61, 0xB4,
+    0x28, 0x00, 0x04, 0x00, 0x6D, 0x6E, 0x73, 0x74, 0xBA, 0x28, 0x00, 0xC0, 0x28, 0x00, 0xC6, 0x28,
+    0x00, 0xBA, 0x28, 0x00, 0x01, 0x00, 0x64, 0xCC, 0x28, 0x00, 0x01, 0x00, 0x73, 0xD2, 0x28, 0x00,
+    0x07, 0x00, 0x61, 0x65, 0x6D, 0x6E, 0x6F, 0x73, 0x74, 0xB4, 0x28, 0x00, 0xB4, 0x28, 0x00, 0xD8,
+    0x28, 0x00, 0xDE, 0x28, 0x00, 0x5A, 0x1D, 0x00, 0xE4, 0x28, 0x00, 0xE4, 0x28, 0x00, 0x02, 0x00,
+    0x2E, 0x65, 0x80, 0x0A, 0x00, 0xB4, 0x28, 0x00, 0x05, 0x00, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0xBA,
+    0x28, 0x00, 0xC0, 0x28, 0x00, 0xEA, 0x28, 0x00, 0xC6, 0x28, 0x00, 0xBA, 0x28, 0x00, 0x05, 0x00,
+    0x6D, 0x6E, 0x6F, 0x73, 0x74, 0xBA, 0x28, 0x00, 0xC0, 0x28, 0x00, 0xF0, 0x28, 0x00, 0xC6, 0x28,
+    0x00, 0xBA, 0x28, 0x00, 0x05, 0x00, 0x2E, 0x69, 0x6D, 0x6E, 0x73, 0x80, 0x0A, 0x00, 0x08, 0x0B,
+    0x00, 0xF6, 0x28, 0x00, 0x2E, 0x17, 0x00, 0x2E, 0x17, 0x00, 0x01, 0x00, 0x6C, 0xFC, 0x28, 0x00,
+    0x02, 0x00, 0x61, 0x6F, 0x02, 0x29, 0x00, 0x02, 0x29, 0x00, 0x01, 0x00, 0x6F, 0x0C, 0x29, 0x00,
+    0x02, 0x00, 0x6D, 0x74, 0x18, 0x1B, 0x00, 0x12, 0x29, 0x00, 0x01, 0x00, 0x65, 0x0C, 0x29, 0x00,
+    0x01, 0x00, 0x6F, 0x20, 0x29, 0x00, 0x01, 0x00, 0x74, 0x26, 0x29, 0x00, 0x01, 0x00, 0x69, 0x2C,
+    0x29, 0x00, 0x01, 0x00, 0x65, 0x32, 0x29, 0x00, 0x01, 0x00, 0x6F, 0x32, 0x29, 0x00, 0x03, 0x00,
+    0x65, 0x6C, 0x6D, 0x50, 0x29, 0x00, 0x56, 0x29, 0x00, 0x5C, 0x29, 0x00, 0x01, 0x00, 0x70, 0x62,
+    0x29, 0x00, 0x01, 0x00, 0x73, 0x68, 0x29, 0x00, 0x02, 0x00, 0x65, 0x69, 0x72, 0x29, 0x00, 0x32,
+    0x29, 0x00, 0x02, 0x00, 0x6E, 0x75, 0x78, 0x29, 0x00, 0x7E, 0x29, 0x00, 0x01, 0x00, 0x6E, 0x84,
+    0x29, 0x00, 0x01, 0x00, 0x78, 0x78, 0x22, 0x00, 0x01, 0x00, 0x6E, 0x78, 0x22, 0x00, 0x01, 0x00,
+    0xB3, 0x96, 0x29, 0x00, 0x01, 0x00, 0x74, 0x9C, 0x29, 0x00, 0x07, 0x02, 0x53, 0x00, 0x63, 0x67,
+    0x6C, 0x70, 0x72, 0x75, 0x78, 0xA0, 0x29, 0x00, 0xAA, 0x29, 0x00, 0xB4, 0x29, 0x00, 0xBE, 0x29,
+    0x00, 0xC4, 0x29, 0x00, 0xCA, 0x29, 0x00, 0xD0, 0x29, 0x00, 0x04, 0x02, 0x53, 0x00, 0x64, 0x66,
+    0x74, 0x78, 0xD6, 0x29, 0x00, 0xE0, 0x29, 0x00, 0xE6, 0x29, 0x00, 0xEC, 0x29, 0x00, 0x02, 0x01,
+    0x2C, 0x00, 0x65, 0x69, 0xF2, 0x29, 0x00, 0x04, 0x2A, 0x00, 0x02, 0x02, 0x53, 0x00, 0x6D, 0x74,
+    0x0A, 0x2A, 0x00, 0x10, 0x2A, 0x00, 0x01, 0x00, 0x75, 0x16, 0x2A, 0x00, 0x03, 0x02, 0x03, 0x01,
+    0x6B, 0x70, 0x72, 0x1C, 0x2A, 0x00, 0x22, 0x2A, 0x00, 0x30, 0x2A, 0x00, 0x00, 0x02, 0x53, 0x00,
+    0x05, 0x00, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0x36, 0x2A, 0x00, 0x3E, 0x2A, 0x00, 0x3E, 0x2A, 0x00,
+    0x42, 0x2A, 0x00, 0x3E, 0x2A, 0x00, 0x07, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x4A,
+    0x2A, 0x00, 0x4E, 0x2A, 0x00, 0x5A, 0x2A, 0x00, 0x5E, 0x2A, 0x00, 0x3E, 0x2A, 0x00, 0x3E, 0x2A,
+    0x00, 0x66, 0x2A, 0x00, 0x01, 0x00, 0x63, 0x7C, 0x2A, 0x00, 0x04, 0x03, 0xFD, 0x00, 0x63, 0x6A,
+    0x6D, 0x72, 0x82, 0x2A, 0x00, 0x88, 0x2A, 0x00, 0x92, 0x2A, 0x00, 0x9C, 0x2A, 0x00, 0x01, 0x03,
+    0xFD, 0x00, 0x6D, 0xA2, 0x2A, 0x00, 0x01, 0x02, 0x00, 0x01, 0x65, 0xAC, 0x2A, 0x00, 0x00, 0x03,
+    0xFD, 0x00, 0x01, 0x03, 0xFD, 0x00, 0x6A, 0xB2, 0x2A, 0x00, 0x01, 0x03, 0xFD, 0x00, 0x6D, 0xC4,
+    0x2A, 0x00, 0x05, 0x00, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xCA, 0x2A, 0x00, 0xCA, 0x2A, 0x00, 0xCA,
+    0x2A, 0x00, 0xCE, 0x2A, 0x00, 0xCA, 0x2A, 0x00, 0x05, 0x02, 0x00, 0x01, 0x61, 0x69, 0x6F, 0x75,
+    0xC3, 0xD6, 0x2A, 0x00, 0xE0, 0x2A, 0x00, 0xE6, 0x2A, 0x00, 0xEC, 0x2A, 0x00, 0xF2, 0x2A, 0x00,
+    0x05, 0x00, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xCA, 0x2A, 0x00, 0xCA, 0x2A, 0x00, 0xCA, 0x2A, 0x00,
+    0xCA, 0x2A, 0x00, 0xCA, 0x2A, 0x00, 0x01, 0x00, 0x65, 0x04, 0x2B, 0x00, 0x01, 0x00, 0x65, 0x0A,
+    0x2B, 0x00, 0x0C, 0x03, 0xFD, 0x00, 0x62, 0x63, 0x64, 0x66, 0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x72,
+    0x73, 0x74, 0x14, 0x2B, 0x00, 0x1E, 0x2B, 0x00, 0x24, 0x2B, 0x00, 0x2E, 0x2B, 0x00, 0x34, 0x2B,
+    0x00, 0x3A, 0x2B, 0x00, 0x44, 0x2B, 0x00, 0x4A, 0x2B, 0x00, 0x54, 0x2B, 0x00, 0x66, 0x2B, 0x00,
+    0x70, 0x2B, 0x00, 0x76, 0x2B, 0x00, 0x06, 0x03, 0xFD, 0x00, 0x66, 0x6C, 0x6E, 0x71, 0x76, 0x78,
+    0x7C, 0x2B, 0x00, 0x82, 0x2B, 0x00, 0x8C, 0x2B, 0x00, 0x96, 0x2B, 0x00, 0x9C, 0x2B, 0x00, 0xA2,
+    0x2B, 0x00, 0x00, 0x02, 0x00, 0x01, 0x03, 0x03, 0xFD, 0x00, 0x63, 0x67, 0x6E, 0xAE, 0x2B, 0x00,
+    0xB4, 0x2B, 0x00, 0xCC, 0x26, 0x00, 0x04, 0x03, 0xFD, 0x00, 0x62, 0x63, 0x66, 0x70, 0xBA, 0x2B,
+    0x00, 0xC0, 0x2B, 0x00, 0xCA, 0x2B, 0x00, 0xD0, 0x2B, 0x00, 0x01, 0x00, 0x65, 0xD6, 0x2B, 0x00,
+    0x01, 0x03, 0xFD, 0x00, 0x74, 0xDC, 0x2B, 0x00, 0x05, 0x00, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xE2,
+    0x2B, 0x00, 0xEA, 0x2B, 0x00, 0xCA, 0x2A, 0x00, 0xCA, 0x2A, 0x00, 0xF2, 0x2B, 0x00, 0x03, 0x00,
+    0x61, 0x65, 0x69, 0xFA, 0x2B, 0x00, 0x08, 0x2C, 0x00, 0x12, 0x2C, 0x00, 0x01, 0x00, 0x69, 0x32,
+    0x29, 0x00, 0x07, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x18, 0x2C, 0x00, 0x18, 0x2C,
+    0x00, 0x1C, 0x2C, 0x00, 0x18, 0x2C, 0x00, 0x18, 0x2C, 0x00, 0x18, 0x2C, 0x00, 0x20, 0x2C, 0x00,
+    0x05, 0x00, 0x61, 0x65, 0x68, 0x69, 0xC3, 0x36, 0x2C, 0x00, 0x44, 0x2C, 0x00, 0x4A, 0x2C, 0x00,
+    0x54, 0x2C, 0x00, 0x5A, 0x2C, 0x00, 0x01, 0x00, 0x74, 0x64, 0x2C, 0x00, 0x07, 0x00, 0x61, 0x65,
+    0x68, 0x69, 0x6F, 0x75, 0xC3, 0x18, 0x2C, 0x00, 0x18, 0x2C, 0x00, 0x1C, 0x2C, 0x00, 0x18, 0x2C,
+    0x00, 0x86, 0x2C, 0x00, 0x18, 0x2C, 0x00, 0x92, 0x2C, 0x00, 0x07, 0x00, 0x61, 0x65, 0x68, 0x69,
+    0x6F, 0x75, 0xC3, 0xA8, 0x2C, 0x00, 0xB0, 0x2C, 0x00, 0xB8, 0x2C, 0x00, 0xC4, 0x2C, 0x00, 0xC4,
+    0x2C, 0x00, 0xC4, 0x2C, 0x00, 0xC8, 0x2C, 0x00, 0x0E, 0x02, 0x53, 0x00, 0x62, 0x63, 0x64, 0x65,
+    0x66, 0x67, 0x6A, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x73, 0x7A, 0xDE, 0x2C, 0x00, 0xEC, 0x2C, 0x00,
+    0xFA, 0x2C, 0x00, 0x00, 0x2D, 0x00, 0x06, 0x2D, 0x00, 0x10, 0x2D, 0x00, 0x16, 0x2D, 0x00, 0x20,
+    0x2D, 0x00, 0x36, 0x2D, 0x00, 0x48, 0x2D, 0x00, 0x52, 0x2D, 0x00, 0x5C, 0x2D, 0x00, 0x60, 0x2D,
+    0x00, 0x5C, 0x2D, 0x00, 0x00, 0x02, 0x03, 0x01, 0x03, 0x02, 0x53, 0x00, 0x6D, 0x6E, 0x76, 0x5C,
+    0x2D, 0x00, 0x6A, 0x2D, 0x00, 0x90, 0x2D, 0x00, 0x04, 0x02, 0x53, 0x00, 0x62, 0x63, 0x6A, 0x72,
+    0x5C, 0x2D, 0x00, 0xCC, 0x26, 0x00, 0x96, 0x2D, 0x00, 0x9A, 0x2D, 0x00, 0x05, 0x02, 0x53, 0x00,
+    0x62, 0x6D, 0x6E, 0x73, 0x74, 0xA4, 0x2D, 0x00, 0xAE, 0x2D, 0x00, 0xB8, 0x2D, 0x00, 0xC6, 0x2D,
+    0x00, 0xD0, 0x2D, 0x00, 0x05, 0x00, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xD6, 0x2D, 0x00, 0x3E, 0x2A,
+    0x00, 0x3E, 0x2A, 0x00, 0x3E, 0x2A, 0x00, 0x3E, 0x2A, 0x00, 0x01, 0x00, 0x65, 0xE2, 0x2D, 0x00,
+    0x01, 0x00, 0x73, 0xE4, 0x20, 0x00, 0x08, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x75, 0xC3,
+    0xE8, 0x2D, 0x00, 0x04, 0x2E, 0x00, 0x5A, 0x2A, 0x00, 0x1C, 0x2E, 0x00, 0x3C, 0x2E, 0x00, 0x4C,
+    0x2E, 0x00, 0x52, 0x2E, 0x00, 0x5A, 0x2E, 0x00, 0x02, 0x00, 0x65, 0x6F, 0x70, 0x2E, 0x00, 0x76,
+    0x2E, 0x00, 0x01, 0x00, 0x65, 0x7C, 0x2E, 0x00, 0x01, 0x00, 0x73, 0x86, 0x2E, 0x00, 0x01, 0x00,
+    0xC3, 0xA4, 0x2E, 0x00, 0x00, 0x02, 0x66, 0x00, 0x00, 0x02, 0x2D, 0x00, 0x01, 0x00, 0x74, 0xAA,
+    0x2E, 0x00, 0x01, 0x00, 0x6E, 0xB0, 0x2E, 0x00, 0x01, 0x00, 0xB3, 0xB6, 0x2E, 0x00, 0x03, 0x00,
+    0x2E, 0x61, 0x65, 0x88, 0x21, 0x00, 0xB6, 0x16, 0x00, 0x0C, 0x17, 0x00, 0x01, 0x00, 0x69, 0xBC,
+    0x2E, 0x00, 0x01, 0x00, 0x6E, 0xEC, 0x21, 0x00, 0x01, 0x00, 0x2E, 0x6E, 0x0B, 0x00, 0x01, 0x00,
+    0x69, 0xC2, 0x2E, 0x00, 0x01, 0x00, 0x69, 0xC8, 0x2E, 0x00, 0x01, 0x00, 0x6F, 0x0C, 0x17, 0x00,
+    0x02, 0x01, 0x61, 0x00, 0x2E, 0x73, 0x88, 0x21, 0x00, 0xBA, 0x1A, 0x00, 0x02, 0x00, 0x2E, 0x73,
+    0xCE, 0x2E, 0x00, 0xEC, 0x21, 0x00, 0x01, 0x00, 0x73, 0xEC, 0x21, 0x00, 0x01, 0x00, 0x2E, 0xCE,
+    0x2E, 0x00, 0x03, 0x00, 0x2E, 0x6E, 0x73, 0x88, 0x21, 0x00, 0xBA, 0x1A, 0x00, 0xBA, 0x1A, 0x00,
+    0x03, 0x00, 0x2E, 0x69, 0x73, 0x88, 0x21, 0x00, 0x0C, 0x17, 0x00, 0xBA, 0x1A, 0x00, 0x02, 0x00,
+    0x61, 0x73, 0xD2, 0x2E, 0x00, 0xBA, 0x1A, 0x00, 0x03, 0x00, 0x2E, 0x69, 0x73, 0x80, 0x0A, 0x00,
+    0x08, 0x0B, 0x00, 0x2E, 0x17, 0x00, 0x01, 0x00, 0x72, 0xE8, 0x2E, 0x00, 0x01, 0x00, 0x6F, 0xEE,
+    0x2E, 0x00, 0x01, 0x00, 0x69, 0xE8, 0x2E, 0x00, 0x0E, 0x01, 0xC4, 0x00, 0x62, 0x63, 0x64, 0x66,
+    0x67, 0x68, 0x6C, 0x6D, 0x70, 0x71, 0x73, 0x74, 0x76, 0x7A, 0xF8, 0x2E, 0x00, 0xF8, 0x2E, 0x00,
+    0xFC, 0x2E, 0x00, 0xF8, 0x2E, 0x00, 0xF8, 0x2E, 0x00, 0xF8, 0x2E, 0x00, 0xF8, 0x2E, 0x00, 0xF8,
+    0x2E, 0x00, 0xF8, 0x2E, 0x00, 0xF8, 0x2E, 0x00, 0xF8, 0x2E, 0x00, 0xF8, 0x2E, 0x00, 0xF8, 0x2E,
+    0x00, 0xF8, 0x2E, 0x00, 0x00, 0x02, 0x2A, 0x00, 0x00, 0x01, 0x2C, 0x00, 0x01, 0x00, 0x6F, 0x08,
+    0x2F, 0x00, 0x05, 0x00, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0x0E, 0x2F, 0x00, 0x0E, 0x2F, 0x00, 0x0E,
+    0x2F, 0x00, 0x0E, 0x2F, 0x00, 0x0E, 0x2F, 0x00, 0x01, 0x00, 0xC3, 0x12, 0x2F, 0x00, 0x01, 0x00,
+    0x61, 0x32, 0x29, 0x00, 0x00, 0x02, 0xCC, 0x00, 0x01, 0x02, 0xCC, 0x00, 0x73, 0x2E, 0x17, 0x00,
+    0x01, 0x00, 0x6C, 0xE8, 0x2E, 0x00, 0x01, 0x00, 0x69, 0x18, 0x2F, 0x00, 0x02, 0x00, 0x68, 0x6F,
+    0x1C, 0x2C, 0x00, 0x32, 0x29, 0x00, 0x01, 0x00, 0x72, 0x36, 0x2F, 0x00, 0x01, 0x00, 0x74, 0xE8,
+    0x2E, 0x00, 0x01, 0x00, 0x72, 0x12, 0x28, 0x00, 0x01, 0x00, 0x74, 0x96, 0x2D, 0x00, 0x01, 0x00,
+    0x72, 0x58, 0x2F, 0x00, 0x01, 0x00, 0x6F, 0x5E, 0x2F, 0x00, 0x01, 0x00, 0x72, 0x64, 0x2F, 0x00,
+    0x01, 0x00, 0x74, 0x6A, 0x2F, 0x00, 0x07, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x18,
+    0x2C, 0x00, 0x18, 0x2C, 0x00, 0x1C, 0x2C, 0x00, 0x70, 0x2F, 0x00, 0x18, 0x2C, 0x00, 0x18, 0x2C,
+    0x00, 0x20, 0x2C, 0x00, 0x01, 0x00, 0x74, 0x78, 0x2F, 0x00, 0x02, 0x00, 0x61, 0x6F, 0x7E, 0x2F,
+    0x00, 0x32, 0x29, 0x00, 0x0D, 0x00, 0x62, 0x63, 0x66, 0x67, 0x68, 0x6C, 0x6E, 0x70, 0x72, 0x73,
+    0x74, 0x79, 0x7A, 0x84, 0x2F, 0x00, 0x8E, 0x2F, 0x00, 0x94, 0x2F, 0x00, 0x9E, 0x2F, 0x00, 0xA4,
+    0x2F, 0x00, 0xAA, 0x2F, 0x00, 0xB4, 0x2F, 0x00, 0xBA, 0x2F, 0x00, 0xC0, 0x2F, 0x00, 0xC6, 0x2F,
+    0x00, 0xD4, 0x2F, 0x00, 0xDA, 0x2F, 0x00, 0xE0, 0x2F, 0x00, 0x0A, 0x00, 0x61, 0x63, 0x64, 0x6D,
+    0x6E, 0x6F, 0x71, 0x72, 0x73, 0xC3, 0xEA, 0x2F, 0x00, 0x06, 0x30, 0x00, 0x18, 0x30, 0x00, 0x22,
+    0x30, 0x00, 0x30, 0x30, 0x00, 0x36, 0x30, 0x00, 0x3A, 0x30, 0x00, 0x42, 0x30, 0x00, 0x4C, 0x30,
+    0x00, 0x5A, 0x30, 0x00, 0x07, 0x00, 0x64, 0x65, 0x67, 0x6C, 0x6D, 0x6E, 0x73, 0x60, 0x30, 0x00,
+    0x6A, 0x30, 0x00, 0x70, 0x30, 0x00, 0x7A, 0x30, 0x00, 0x80, 0x30, 0x00, 0x8A, 0x30, 0x00, 0xA8,
+    0x30, 0x00, 0x0B, 0x00, 0x62, 0x63, 0x64, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x76, 0x78, 0x79, 0xAE,
+    0x30, 0x00, 0xBC, 0x30, 0x00, 0xCA, 0x30, 0x00, 0xD0, 0x30, 0x00, 0xE6, 0x30, 0x00, 0xEC, 0x30,
+    0x00, 0xF2, 0x30, 0x00, 0x0C, 0x31, 0x00, 0x12, 0x31, 0x00, 0x20, 0x31, 0x00, 0x26, 0x31, 0x00,
+    0x07, 0x00, 0x62, 0x64, 0x65, 0x6E, 0x72, 0x73, 0xC3, 0x30, 0x31, 0x00, 0x3A, 0x31, 0x00, 0x40,
+    0x31, 0x00, 0x46, 0x31, 0x00, 0x5C, 0x31, 0x00, 0x62, 0x31, 0x00, 0x68, 0x31, 0x00, 0x03, 0x00,
+    0xA1, 0xA9, 0xB3, 0x6E, 0x31, 0x00, 0x78, 0x31, 0x00, 0x82, 0x31, 0x00, 0x02, 0x00, 0x65, 0xC3,
+    0x8C, 0x31, 0x00, 0x92, 0x31, 0x00, 0x02, 0x00, 0x61, 0x6F, 0x98, 0x31, 0x00, 0x98, 0x31, 0x00,
+    0x01, 0x00, 0x61, 0x2E, 0x17, 0x00, 0x01, 0x00, 0x65, 0xA2, 0x31, 0x00, 0x01, 0x00, 0x74, 0xA8,
+    0x31, 0x00, 0x01, 0x00, 0x74, 0xAE, 0x31, 0x00, 0x01, 0x00, 0x63, 0xB4, 0x31, 0x00, 0x01, 0x00,
+    0x62, 0xBA, 0x31, 0x00, 0x00, 0x02, 0x5C, 0x00, 0x02, 0x00, 0x61, 0x6C, 0xC0, 0x31, 0x00, 0xD2,
+    0x31, 0x00, 0x03, 0x00, 0x2E, 0x61, 0x6F, 0xD8, 0x31, 0x00, 0xDC, 0x31, 0x00, 0xE6, 0x31, 0x00,
+    0x01, 0x00, 0x6F, 0xF4, 0x31, 0x00, 0x01, 0x00, 0x2E, 0xD8, 0x31, 0x00, 0x04, 0x00, 0x61, 0x65,
+    0x6F, 0xC3, 0xC0, 0x31, 0x00, 0xFA, 0x31, 0x00, 0x10, 0x32, 0x00, 0x16, 0x32, 0x00, 0x03, 0x00,
+    0x2E, 0x65, 0x74, 0xD8, 0x31, 0x00, 0xC0, 0x31, 0x00, 0x24, 0x32, 0x00, 0x01, 0x00, 0x65, 0x2A,
+    0x32, 0x00, 0x01, 0x00, 0x6F, 0x30, 0x32, 0x00, 0x01, 0x00, 0x72, 0x36, 0x32, 0x00, 0x06, 0x00,
+    0x2E, 0x62, 0x69, 0x6E, 0x72, 0x73, 0x88, 0x21, 0x00, 0x4C, 0x32, 0x00, 0x2A, 0x32, 0x00, 0xBA,
+    0x1A, 0x00, 0x52, 0x32, 0x00, 0x5C, 0x32, 0x00, 0x02, 0x00, 0x61, 0x73, 0x66, 0x32, 0x00, 0xBA,
+    0x1A, 0x00, 0x01, 0x00, 0x65, 0x7C, 0x32, 0x00, 0x01, 0x00, 0x72, 0x82, 0x32, 0x00, 0x01, 0x00,
+    0x65, 0x88, 0x32, 0x00, 0x01, 0x00, 0x65, 0xD6, 0x24, 0x00, 0x01, 0x00, 0x75, 0x8E, 0x32, 0x00,
+    0x01, 0x00, 0x69, 0x94, 0x32, 0x00, 0x01, 0x00, 0x72, 0xCC, 0x26, 0x00, 0x01, 0x00, 0xC3, 0x9A,
+    0x32, 0x00, 0x01, 0x00, 0x75, 0xA0, 0x32, 0x00, 0x03, 0x00, 0x65, 0x69, 0xC3, 0xCC, 0x26, 0x00,
+    0xCC, 0x26, 0x00, 0xA6, 0x32, 0x00, 0x03, 0x00, 0x61, 0x6F, 0xC3, 0xCC, 0x26, 0x00, 0xCC, 0x26,
+    0x00, 0xAC, 0x32, 0x00, 0x02, 0x00, 0x61, 0x69, 0xD6, 0x24, 0x00, 0x36, 0x2D, 0x00, 0x05, 0x00,
+    0x61, 0x65, 0x69, 0x6F, 0xC3, 0xCC, 0x26, 0x00, 0xCC, 0x26, 0x00, 0xCC, 0x26, 0x00, 0xCC, 0x26,
+    0x00, 0xB2, 0x32, 0x00, 0x01, 0x00, 0x6F, 0xC4, 0x32, 0x00, 0x01, 0x00, 0x69, 0xCA, 0x32, 0x00,
+    0x01, 0x00, 0x72, 0xD0, 0x24, 0x00, 0x01, 0x00, 0x73, 0xD0, 0x32, 0x00, 0x02, 0x00, 0x61, 0xC3,
+    0xD6, 0x32, 0x00, 0xDC, 0x32, 0x00, 0x01, 0x00, 0x6C, 0xE2, 0x32, 0x00, 0x02, 0x00, 0x69, 0xC3,
+    0xE8, 0x32, 0x00, 0xF6, 0x32, 0x00, 0x01, 0x00, 0x6C, 0xFC, 0x32, 0x00, 0x01, 0x00, 0x61, 0x02,
+    0x33, 0x00, 0x02, 0x00, 0x6D, 0x72, 0x10, 0x33, 0x00, 0x16, 0x33, 0x00, 0x01, 0x00, 0x67, 0x1C,
+    0x33, 0x00, 0x04, 0x00, 0x67, 0x6A, 0x6C, 0x6D, 0x1C, 0x33, 0x00, 0x22, 0x33, 0x00, 0x2C, 0x33,
+    0x00, 0x32, 0x33, 0x00, 0x01, 0x00, 0x74, 0x16, 0x33, 0x00, 0x01, 0x00, 0x64, 0x44, 0x33, 0x00,
+    0x01, 0x00, 0x6C, 0x4A, 0x33, 0x00, 0x02, 0x00, 0x65, 0x72, 0x7C, 0x32, 0x00, 0xE8, 0x2E, 0x00,
+    0x01, 0x00, 0x6E, 0x7E, 0x2F, 0x00, 0x01, 0x00, 0x63, 0xE8, 0x2E, 0x00, 0x01, 0x00, 0x6C, 0x50,
+    0x33, 0x00, 0x02, 0x00, 0x2E, 0x73, 0x90, 0x1C, 0x00, 0xA0, 0x1C, 0x00, 0x03, 0x00, 0x61, 0x6F,
+    0xC3, 0xB2, 0x25, 0x00, 0x5A, 0x33, 0x00, 0x80, 0x33, 0x00, 0x01, 0x00, 0x64, 0x58, 0x2F, 0x00,
+    0x01, 0x00, 0x65, 0x86, 0x33, 0x00, 0x01, 0x00, 0x61, 0x86, 0x33, 0x00, 0x02, 0x00, 0x63, 0x6F,
+    0xE8, 0x2E, 0x00, 0x32, 0x29, 0x00, 0x07, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x18,
+    0x2C, 0x00, 0x18, 0x2C, 0x00, 0x1C, 0x2C, 0x00, 0x18, 0x2C, 0x00, 0x8C, 0x33, 0x00, 0x18, 0x2C,
+    0x00, 0x20, 0x2C, 0x00, 0x01, 0x00, 0x72, 0x94, 0x33, 0x00, 0x02, 0x00, 0x61, 0x6F, 0xB6, 0x33,
+    0x00, 0xB6, 0x33, 0x00, 0x01, 0x00, 0x6E, 0xC0, 0x33, 0x00, 0x02, 0x00, 0x2E, 0x73, 0x44, 0x26,
+    0x00, 0xA6, 0x1A, 0x00, 0x01, 0x00, 0x73, 0xCA, 0x33, 0x00, 0x00, 0x02, 0x0E, 0x00, 0x01, 0x00,
+    0x2E, 0x2A, 0x26, 0x00, 0x02, 0x00, 0x2E, 0x65, 0xD0, 0x33, 0x00, 0xD4, 0x33, 0x00, 0x01, 0x00,
+    0x69, 0x0C, 0x17, 0x00, 0x00, 0x02, 0x0B, 0x00, 0x03, 0x00, 0x69, 0x6D, 0x73, 0x0C, 0x17, 0x00,
+    0xDA, 0x33, 0x00, 0xBA, 0x1A, 0x00, 0x01, 0x00, 0x73, 0xE0, 0x33, 0x00, 0x01, 0x00, 0x6E, 0xE6,
+    0x33, 0x00, 0x01, 0x00, 0x6C, 0xEC, 0x33, 0x00, 0x02, 0x00, 0x72, 0x73, 0xF0, 0x33, 0x00, 0xF6,
+    0x33, 0x00, 0x03, 0x00, 0x62, 0x65, 0xC3, 0xEC, 0x33, 0x00, 0x00, 0x34, 0x00, 0x06, 0x34, 0x00,
+    0x01, 0x00, 0x6D, 0xEC, 0x33, 0x00, 0x05, 0x00, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0x62, 0x26, 0x00,
+    0x00, 0x34, 0x00, 0x0C, 0x34, 0x00, 0x12, 0x34, 0x00, 0x80, 0x26, 0x00, 0x01, 0x00, 0x69, 0x18,
+    0x34, 0x00, 0x01, 0x00, 0x6E, 0xE8, 0x2E, 0x00, 0x01, 0x00, 0x72, 0x28, 0x34, 0x00, 0x01, 0x00,
+    0x63, 0x3A, 0x34, 0x00, 0x01, 0x00, 0x6D, 0x40, 0x34, 0x00, 0x01, 0x00, 0xA1, 0x4A, 0x34, 0x00,
+    0x01, 0x00, 0x72, 0x50, 0x34, 0x00, 0x01, 0x00, 0xAD, 0x56, 0x34, 0x00, 0x00, 0x01, 0x27, 0x00,
+    0x00, 0x02, 0xB7, 0x00, 0x01, 0x00, 0x65, 0x5C, 0x34, 0x00, 0x01, 0x00, 0x6C, 0x62, 0x34, 0x00,
+    0x08, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x75, 0xC3, 0x18, 0x2C, 0x00, 0x18, 0x2C, 0x00,
+    0x1C, 0x2C, 0x00, 0x18, 0x2C, 0x00, 0xE8, 0x2E, 0x00, 0x18, 0x2C, 0x00, 0x18, 0x2C, 0x00, 0x20,
+    0x2C, 0x00, 0x01, 0x00, 0x65, 0x68, 0x34, 0x00, 0x01, 0x00, 0x61, 0x6E, 0x34, 0x00, 0x07, 0x00,
+    0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x74, 0x34, 0x00, 0x18, 0x2C, 0x00, 0x1C, 0x2C, 0x00,
+    0x18, 0x2C, 0x00, 0x18, 0x2C, 0x00, 0x18, 0x2C, 0x00, 0x20, 0x2C, 0x00, 0x01, 0x00, 0x69, 0x7C,
+    0x34, 0x00, 0x02, 0x00, 0x2E, 0x73, 0xD0, 0x33, 0x00, 0x82, 0x34, 0x00, 0x01, 0x00, 0x6C, 0x88,
+    0x34, 0x00, 0x03, 0x00, 0x2E, 0x61, 0x73, 0x92, 0x34, 0x00, 0x96, 0x34, 0x00, 0xA0, 0x34, 0x00,
+    0x01, 0x00, 0xC3, 0xA6, 0x34, 0x00, 0x01, 0x00, 0x67, 0xAC, 0x34, 0x00, 0x07, 0x00, 0x61, 0x65,
+    0x68, 0x69, 0x6F, 0x75, 0xC3, 0x18, 0x2C, 0x00, 0xB2, 0x34, 0x00, 0x1C, 0x2C, 0x00, 0x18, 0x2C,
+    0x00, 0x18, 0x2C, 0x00, 0x18, 0x2C, 0x00, 0x20, 0x2C, 0x00, 0x01, 0x00, 0x65, 0xBA, 0x34, 0x00,
+    0x01, 0x00, 0x65, 0xC0, 0x34, 0x00, 0x07, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x18,
+    0x2C, 0x00, 0x18, 0x2C, 0x00, 0x1C, 0x2C, 0x00, 0xC6, 0x34, 0x00, 0x18, 0x2C, 0x00, 0xCE, 0x34,
+    0x00, 0xD6, 0x34, 0x00, 0x01, 0x00, 0x6E, 0xEC, 0x34, 0x00, 0x01, 0x00, 0x6D, 0xF2, 0x34, 0x00,
+    0x01, 0x00, 0x6F, 0xF8, 0x34, 0x00, 0x01, 0x00, 0x63, 0xFE, 0x34, 0x00, 0x07, 0x00, 0x61, 0x65,
+    0x68, 0x69, 0x6F, 0x75, 0xC3, 0x04, 0x35, 0x00, 0x18, 0x2C, 0x00, 0x1C, 0x2C, 0x00, 0x18, 0x2C,
+    0x00, 0x10, 0x35, 0x00, 0x18, 0x35, 0x00, 0x20, 0x35, 0x00, 0x01, 0x00, 0x61, 0x36, 0x35, 0x00,
+    0x02, 0x00, 0x6C, 0x73, 0x54, 0x35, 0x00, 0x5A, 0x35, 0x00, 0x02, 0x00, 0x6D, 0x6E, 0x60, 0x35,
+    0x00, 0x66, 0x35, 0x00, 0x01, 0x00, 0x70, 0x6C, 0x35, 0x00, 0x02, 0x00, 0x61, 0x73, 0x72, 0x35,
+    0x00, 0x7C, 0x35, 0x00, 0x01, 0x00, 0x70, 0x80, 0x35, 0x00, 0x01, 0x02, 0xCE, 0x00, 0x6F, 0x32,
+    0x29, 0x00, 0x00, 0x02, 0xCE, 0x00, 0x00, 0x01, 0x0D, 0x00, 0x03, 0x00, 0xA1, 0xA9, 0xAD, 0x16,
+    0x28, 0x00, 0x16, 0x28, 0x00, 0x16, 0x28, 0x00, 0x02, 0x00, 0x69, 0xC3, 0x86, 0x35, 0x00, 0x8C,
+    0x35, 0x00, 0x01, 0x00, 0x74, 0x7C, 0x35, 0x00, 0x01, 0x00, 0x6F, 0x92, 0x35, 0x00, 0x01, 0x00,
+    0x65, 0xB0, 0x35, 0x00, 0x02, 0x00, 0x2E, 0x65, 0x4E, 0x28, 0x00, 0xCE, 0x35, 0x00, 0x00, 0x01,
+    0x61, 0x00, 0x01, 0x00, 0x2E, 0x4E, 0x28, 0x00, 0x01, 0x00, 0x6C, 0xD4, 0x35, 0x00, 0x03, 0x00,
+    0x2E, 0x61, 0x65, 0x4E, 0x28, 0x00, 0xC4, 0x1C, 0x00, 0xE2, 0x35, 0x00, 0x01, 0x00, 0x6D, 0xE8,
+    0x35, 0x00, 0x01, 0x00, 0x72, 0xEE, 0x35, 0x00, 0x01, 0x00, 0x61, 0x10, 0x36, 0x00, 0x01, 0x00,
+    0x6F, 0x30, 0x36, 0x00, 0x01, 0x00, 0x75, 0x30, 0x36, 0x00, 0x01, 0x00, 0x73, 0x34, 0x36, 0x00,
+    0x03, 0x00, 0x61, 0x65, 0x6F, 0x52, 0x36, 0x00, 0x64, 0x36, 0x00, 0x6A, 0x36, 0x00, 0x01, 0x00,
+    0x6E, 0x70, 0x36, 0x00, 0x01, 0x00, 0x65, 0x76, 0x36, 0x00, 0x01, 0x00, 0x69, 0x7C, 0x36, 0x00,
+    0x00, 0x02, 0x7C, 0x00, 0x01, 0x00, 0x6D, 0xDA, 0x1D, 0x00, 0x01, 0x00, 0x65, 0x80, 0x36, 0x00,
+    0x01, 0x00, 0x6F, 0x5A, 0x1D, 0x00, 0x01, 0x00, 0x65, 0xD2, 0x28, 0x00, 0x01, 0x00, 0x6F, 0x86,
+    0x36, 0x00, 0x01, 0x00, 0x6C, 0xA0, 0x36, 0x00, 0x01, 0x00, 0x65, 0xAE, 0x36, 0x00, 0x01, 0x00,
+    0x6F, 0xB4, 0x36, 0x00, 0x01, 0x00, 0x65, 0xBA, 0x36, 0x00, 0x01, 0x00, 0x69, 0xC0, 0x36, 0x00,
+    0x01, 0x00, 0x73, 0xC6, 0x36, 0x00, 0x01, 0x00, 0x6F, 0xCC, 0x36, 0x00, 0x01, 0x00, 0x65, 0x02,
+    0x29, 0x00, 0x02, 0x00, 0x2E, 0x73, 0xD2, 0x36, 0x00, 0xD6, 0x36, 0x00, 0x01, 0x00, 0x73, 0xD6,
+    0x36, 0x00, 0x03, 0x00, 0x61, 0x65, 0x69, 0xC6, 0x1A, 0x00, 0xDC, 0x36, 0x00, 0xEA, 0x36, 0x00,
+    0x01, 0x00, 0x67, 0xD0, 0x1D, 0x00, 0x01, 0x00, 0x65, 0x18, 0x1B, 0x00, 0x01, 0x00, 0x63, 0x6E,
+    0x0B, 0x00, 0x07, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0xF0, 0x36, 0x00, 0xF0, 0x36,
+    0x00, 0xF4, 0x36, 0x00, 0xF0, 0x36, 0x00, 0xF0, 0x36, 0x00, 0xF0, 0x36, 0x00, 0xF8, 0x36, 0x00,
+    0x01, 0x00, 0x72, 0x0E, 0x37, 0x00, 0x01, 0x00, 0x63, 0x14, 0x37, 0x00, 0x01, 0x00, 0x6E, 0x1A,
+    0x37, 0x00, 0x01, 0x00, 0x69, 0x20, 0x37, 0x00, 0x02, 0x00, 0x6F, 0xC3, 0xE4, 0x20, 0x00, 0x26,
+    0x37, 0x00, 0x01, 0x00, 0x6F, 0x2C, 0x37, 0x00, 0x01, 0x00, 0x75, 0x36, 0x37, 0x00, 0x01, 0x00,
+    0x72, 0x78, 0x22, 0x00, 0x04, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x3C, 0x37, 0x00, 0x4A, 0x37, 0x00,
+    0x50, 0x37, 0x00, 0x56, 0x37, 0x00, 0x01, 0x00, 0x78, 0x0E, 0x2F, 0x00, 0x00, 0x01, 0x27, 0x01,
+    0x02, 0x00, 0x65, 0x72, 0xD6, 0x24, 0x00, 0x5C, 0x37, 0x00, 0x02, 0x00, 0x65, 0x75, 0x94, 0x32,
+    0x00, 0x62, 0x37, 0x00, 0x02, 0x00, 0x65, 0x69, 0x68, 0x37, 0x00, 0x6E, 0x37, 0x00, 0x01, 0x00,
+    0xC3, 0x74, 0x37, 0x00, 0x01, 0x00, 0x72, 0x7A, 0x37, 0x00, 0x01, 0x00, 0x74, 0x0E, 0x37, 0x00,
+    0x01, 0x00, 0x69, 0x80, 0x37, 0x00, 0x02, 0x00, 0x69, 0x75, 0x86, 0x37, 0x00, 0x90, 0x37, 0x00,
+    0x01, 0x00, 0x69, 0x96, 0x37, 0x00, 0x01, 0x00, 0xC3, 0x9C, 0x37, 0x00, 0x01, 0x00, 0x69, 0xC4,
+    0x32, 0x00, 0x04, 0x00, 0x63, 0x72, 0x73, 0x74, 0xA2, 0x37, 0x00, 0xA8, 0x37, 0x00, 0xAE, 0x37,
+    0x00, 0xB8, 0x37, 0x00, 0x01, 0x00, 0x62, 0xBC, 0x37, 0x00, 0x01, 0x00, 0x70, 0xC0, 0x37, 0x00,
+    0x01, 0x00, 0x6F, 0xF8, 0x2E, 0x00, 0x01, 0x00, 0x72, 0xE0, 0x2A, 0x00, 0x01, 0x00, 0x69, 0x7C,
+    0x35, 0x00, 0x03, 0x00, 0x65, 0x74, 0xC3, 0xC6, 0x37, 0x00, 0xB8, 0x37, 0x00, 0xCC, 0x37, 0x00,
+    0x01, 0x00, 0x64, 0xD2, 0x37, 0x00, 0x01, 0x02, 0x0F, 0x01, 0x67, 0xE0, 0x37, 0x00, 0x00, 0x02,
+    0x0F, 0x01, 0x01, 0x02, 0x0F, 0x01, 0x70, 0xE6, 0x37, 0x00, 0x00, 0x03, 0x32, 0x01, 0x02, 0x02,
+    0x0F, 0x01, 0x6D, 0x6E, 0xF8, 0x2E, 0x00, 0xF8, 0x2E, 0x00, 0x00, 0x02, 0x07, 0x01, 0x01, 0x02,
+    0x0F, 0x01, 0x6E, 0xEC, 0x37, 0x00, 0x05, 0x00, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xF2, 0x37, 0x00,
+    0xF6, 0x37, 0x00, 0xF6, 0x37, 0x00, 0xF6, 0x37, 0x00, 0xF6, 0x37, 0x00, 0x01, 0x00, 0x69, 0xFA,
+    0x37, 0x00, 0x01, 0x00, 0x65, 0x9C, 0x2B, 0x00, 0x02, 0x00, 0x65, 0xC3, 0x00, 0x38, 0x00, 0x06,
+    0x38, 0x00, 0x02, 0x00, 0x6F, 0xC3, 0x0C, 0x38, 0x00, 0x12, 0x38, 0x00, 0x01, 0x00, 0x62, 0xCC,
+    0x26, 0x00, 0x02, 0x00, 0x69, 0xC3, 0x18, 0x38, 0x00, 0x1E, 0x38, 0x00, 0x01, 0x00, 0x73, 0x24,
+    0x38, 0x00, 0x04, 0x00, 0x61, 0x65, 0x6F, 0xC3, 0x2A, 0x38, 0x00, 0xF8, 0x2E, 0x00, 0xF8, 0x2E,
+    0x00, 0x32, 0x38, 0x00, 0x01, 0x00, 0x65, 0x40, 0x38, 0x00, 0x00, 0x03, 0xFA, 0x00, 0x01, 0x03,
+    0xFA, 0x00, 0x6A, 0x46, 0x38, 0x00, 0x02, 0x00, 0x6C, 0x75, 0x4A, 0x38, 0x00, 0x4E, 0x38, 0x00,
+    0x01, 0x00, 0x62, 0x4A, 0x38, 0x00, 0x01, 0x00, 0x72, 0x24, 0x38, 0x00, 0x01, 0x00, 0x6D, 0x4A,
+    0x38, 0x00, 0x04, 0x00, 0xA1, 0xAD, 0xB3, 0xBA, 0x54, 0x38, 0x00, 0xE0, 0x2A, 0x00, 0xE6, 0x2A,
+    0x00, 0xEC, 0x2A, 0x00, 0x01, 0x00, 0x65, 0xB8, 0x37, 0x00, 0x02, 0x00, 0x61, 0x6F, 0xB8, 0x37,
+    0x00, 0xB8, 0x37, 0x00, 0x02, 0x00, 0x61, 0x6F, 0x5A, 0x38, 0x00, 0x60, 0x38, 0x00, 0x01, 0x00,
+    0x65, 0x66, 0x38, 0x00, 0x02, 0x00, 0x61, 0x6F, 0x70, 0x38, 0x00, 0x70, 0x38, 0x00, 0x01, 0x00,
+    0x65, 0x76, 0x38, 0x00, 0x01, 0x00, 0x75, 0x7C, 0x38, 0x00, 0x02, 0x00, 0x69, 0xC3, 0x82, 0x38,
+    0x00, 0x88, 0x38, 0x00, 0x01, 0x00, 0x6F, 0x8E, 0x38, 0x00, 0x02, 0x00, 0x61, 0x69, 0x94, 0x38,
+    0x00, 0x9A, 0x38, 0x00, 0x04, 0x00, 0x61, 0x65, 0x6C, 0x72, 0xA4, 0x38, 0x00, 0xAA, 0x38, 0x00,
+    0xB0, 0x38, 0x00, 0xBA, 0x38, 0x00, 0x02, 0x00, 0x6D, 0x72, 0xC0, 0x38, 0x00, 0xC6, 0x38, 0x00,
+    0x01, 0x00, 0x69, 0xCC, 0x38, 0x00, 0x01, 0x00, 0x65, 0xD2, 0x38, 0x00, 0x01, 0x00, 0x69, 0xD8,
+    0x38, 0x00, 0x02, 0x00, 0x65, 0x75, 0xDE, 0x38, 0x00, 0xE4, 0x38, 0x00, 0x02, 0x00, 0x61, 0x63,
+    0xEA, 0x38, 0x00, 0xF0, 0x38, 0x00, 0x01, 0x00, 0x75, 0xF6, 0x38, 0x00, 0x01, 0x00, 0x69, 0x00,
+    0x39, 0x00, 0x02, 0x01, 0x27, 0x00, 0x61, 0x68, 0x76, 0x38, 0x00, 0x06, 0x39, 0x00, 0x01, 0x00,
+    0x75, 0x0C, 0x39, 0x00, 0x01, 0x00, 0x75, 0x16, 0x39, 0x00, 0x01, 0x00, 0x73, 0xC4, 0x24, 0x00,
+    0x02, 0x00, 0x65, 0x75, 0x1C, 0x39, 0x00, 0x22, 0x39, 0x00, 0x01, 0x00, 0x65, 0x30, 0x39, 0x00,
+    0x01, 0x00, 0x6F, 0x36, 0x39, 0x00, 0x01, 0x00, 0x72, 0x3C, 0x39, 0x00, 0x01, 0x00, 0x69, 0x5E,
+    0x39, 0x00, 0x01, 0x03, 0xFA, 0x00, 0x6E, 0x64, 0x39, 0x00, 0x01, 0x03, 0xFA, 0x00, 0x64, 0x6A,
+    0x39, 0x00, 0x01, 0x03, 0xFA, 0x00, 0x74, 0x70, 0x39, 0x00, 0x03, 0x00, 0x63, 0x65, 0x6E, 0x76,
+    0x39, 0x00, 0xF4, 0x36, 0x00, 0x7C, 0x39, 0x00, 0x02, 0x00, 0x64, 0x73, 0x82, 0x39, 0x00, 0x88,
+    0x39, 0x00, 0x01, 0x00, 0x6E, 0x88, 0x39, 0x00, 0x00, 0x02, 0x3E, 0x00, 0x00, 0x01, 0x40, 0x00,
+    0x05, 0x00, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0x8E, 0x39, 0x00, 0x8E, 0x39, 0x00, 0x8E, 0x39, 0x00,
+    0x8E, 0x39, 0x00, 0x8E, 0x39, 0x00, 0x03, 0x00, 0x66, 0x6D, 0x72, 0x92, 0x39, 0x00, 0x98, 0x39,
+    0x00, 0x9E, 0x39, 0x00, 0x01, 0x00, 0x75, 0xA8, 0x39, 0x00, 0x02, 0x00, 0x65, 0x69, 0xAE, 0x39,
+    0x00, 0xB4, 0x39, 0x00, 0x01, 0x00, 0x73, 0xBA, 0x39, 0x00, 0x02, 0x00, 0xA1, 0xB3, 0xC0, 0x39,
+    0x00, 0xC6, 0x39, 0x00, 0x08, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x75, 0xC3, 0xCC, 0x39,
+    0x00, 0xDC, 0x39, 0x00, 0xF8, 0x39, 0x00, 0xFC, 0x39, 0x00, 0x1C, 0x3A, 0x00, 0x28, 0x3A, 0x00,
+    0x32, 0x3A, 0x00, 0x3E, 0x3A, 0x00, 0x02, 0x02, 0x3E, 0x00, 0x63, 0x72, 0x54, 0x3A, 0x00, 0x5E,
+    0x3A, 0x00, 0x05, 0x00, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0x64, 0x3A, 0x00, 0x8E, 0x39, 0x00, 0x8E,
+    0x39, 0x00, 0x8E, 0x39, 0x00, 0x8E, 0x39, 0x00, 0x01, 0x02, 0x11, 0x01, 0x62, 0x6C, 0x3A, 0x00,
+    0x01, 0x02, 0x11, 0x01, 0x74, 0x72, 0x3A, 0x00, 0x02, 0x01, 0x40, 0x00, 0x69, 0xC3, 0x78, 0x3A,
+    0x00, 0x7E, 0x3A, 0x00, 0x00, 0x02, 0x11, 0x01, 0x05, 0x00, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0x84,
+    0x3A, 0x00, 0x84, 0x3A, 0x00, 0x84, 0x3A, 0x00, 0x84, 0x3A, 0x00, 0x84, 0x3A, 0x00, 0x03, 0x00,
+    0x69, 0x72, 0x73, 0x88, 0x3A, 0x00, 0xCC, 0x26, 0x00, 0x8E, 0x3A, 0x00, 0x03, 0x00, 0x6F, 0x75,
+    0xC3, 0x98, 0x3A, 0x00, 0x9E, 0x3A, 0x00, 0xA4, 0x3A, 0x00, 0x01, 0x00, 0x6D, 0xAA, 0x3A, 0x00,
+    0x01, 0x00, 0x67, 0x5C, 0x2D, 0x00, 0x02, 0x00, 0x69, 0xC3, 0xB4, 0x3A, 0x00, 0xBA, 0x3A, 0x00,
+    0x01, 0x00, 0x72, 0xC0, 0x3A, 0x00, 0x02, 0x00, 0x75, 0xC3, 0xCC, 0x38, 0x00, 0xCE, 0x3A, 0x00,
+    0x05, 0x00, 0x65, 0x69, 0x6F, 0x71, 0xC3, 0xD4, 0x3A, 0x00, 0xDA, 0x3A, 0x00, 0xE8, 0x3A, 0x00,
+    0xCC, 0x26, 0x00, 0xEE, 0x3A, 0x00, 0x04, 0x00, 0x61, 0x65, 0x6F, 0xC3, 0xCC, 0x26, 0x00, 0xCC,
+    0x26, 0x00, 0xCC, 0x26, 0x00, 0xFC, 0x3A, 0x00, 0x02, 0x00, 0x69, 0xC3, 0x0A, 0x3B, 0x00, 0x10,
+    0x3B, 0x00, 0x02, 0x00, 0x61, 0x72, 0x16, 0x3B, 0x00, 0x1C, 0x3B, 0x00, 0x00, 0x02, 0x05, 0x01,
+    0x02, 0x00, 0x75, 0xC3, 0x0A, 0x3B, 0x00, 0x26, 0x3B, 0x00, 0x09, 0x00, 0x61, 0x63, 0x66, 0x67,
+    0x69, 0x6F, 0x73, 0x74, 0x76, 0xF8, 0x2E, 0x00, 0xCC, 0x26, 0x00, 0xCC, 0x26, 0x00, 0xCC, 0x26,
+    0x00, 0x90, 0x37, 0x00, 0xF8, 0x2E, 0x00, 0xCC, 0x26, 0x00, 0xCC, 0x26, 0x00, 0xCC, 0x26, 0x00,
+    0x01, 0x00, 0x69, 0x2C, 0x3B, 0x00, 0x00, 0x02, 0xE7, 0x00, 0x02, 0x00, 0x67, 0x69, 0x06, 0x39,
+    0x00, 0x76, 0x2B, 0x00, 0x02, 0x00, 0x69, 0xC3, 0x32, 0x3B, 0x00, 0x3C, 0x3B, 0x00, 0x02, 0x00,
+    0x61, 0xC3, 0x42, 0x3B, 0x00, 0x4A, 0x3B, 0x00, 0x03, 0x00, 0x69, 0x74, 0xC3, 0x50, 0x3B, 0x00,
+    0xCC, 0x26, 0x00, 0x72, 0x3B, 0x00, 0x02, 0x00, 0x61, 0xC3, 0xD6, 0x24, 0x00, 0x7C, 0x3B, 0x00,
+    0x01, 0x00, 0x69, 0x82, 0x3B, 0x00, 0x02, 0x02, 0x0F, 0x01, 0x62, 0x6D, 0xD6, 0x24, 0x00, 0x88,
+    0x3B, 0x00, 0x01, 0x00, 0x6E, 0x96, 0x3B, 0x00, 0x06, 0x03, 0x0C, 0x01, 0x63, 0x66, 0x6C, 0x72,
+    0x73, 0x74, 0x9C, 0x3B, 0x00, 0xA6, 0x3B, 0x00, 0xAC, 0x3B, 0x00, 0x0C, 0x38, 0x00, 0xBA, 0x3B,
+    0x00, 0xC0, 0x3B, 0x00, 0x05, 0x03, 0x0C, 0x01, 0x6A, 0x6C, 0x6D, 0x6E, 0x73, 0xC6, 0x3B, 0x00,
+    0xCC, 0x3B, 0x00, 0xD2, 0x3B, 0x00, 0xD8, 0x3B, 0x00, 0xDE, 0x3B, 0x00, 0x07, 0x03, 0x0C, 0x01,
+    0x64, 0x65, 0x6C, 0x6D, 0x6E, 0x72, 0xC3, 0xE8, 0x3B, 0x00, 0xF6, 0x3B, 0x00, 0x04, 0x3C, 0x00,
+    0x0A, 0x3C, 0x00, 0x10, 0x3C, 0x00, 0xCC, 0x26, 0x00, 0x1A, 0x3C, 0x00, 0x03, 0x03, 0x0C, 0x01,
+    0x63, 0x66, 0x72, 0x20, 0x3C, 0x00, 0x26, 0x3C, 0x00, 0x2C, 0x3C, 0x00, 0x01, 0x00, 0x61, 0x32,
+    0x3C, 0x00, 0x01, 0x03, 0x0C, 0x01, 0x72, 0x38, 0x3C, 0x00, 0x05, 0x00, 0xA1, 0xA9, 0xAD, 0xB3,
+    0xBA, 0x3E, 0x3C, 0x00, 0x4A, 0x3C, 0x00, 0x4E, 0x3C, 0x00, 0x4A, 0x3C, 0x00, 0x4A, 0x3C, 0x00,
+    0x01, 0x00, 0x73, 0x5E, 0x3C, 0x00, 0x01, 0x00, 0x65, 0x64, 0x3C, 0x00, 0x02, 0x00, 0x69, 0x6F,
+    0x6A, 0x3C, 0x00, 0x70, 0x3C, 0x00, 0x07, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x84,
+    0x3A, 0x00, 0x7A, 0x3C, 0x00, 0xF8, 0x39, 0x00, 0x82, 0x3C, 0x00, 0x8A, 0x3C, 0x00, 0x92, 0x3C,
+    0x00, 0x9E, 0x3C, 0x00, 0x01, 0x00, 0xB3, 0xB4, 0x3C, 0x00, 0x01, 0x00, 0x65, 0xBA, 0x3C, 0x00,
+    0x01, 0x00, 0x65, 0x0C, 0x17, 0x00, 0x01, 0x00, 0x6E, 0xBA, 0x1A, 0x00, 0x01, 0x00, 0x6F, 0xBE,
+    0x3C, 0x00, 0x01, 0x00, 0x63, 0xC4, 0x3C, 0x00, 0x01, 0x00, 0x61, 0xCA, 0x3C, 0x00, 0x00, 0x03,
+    0x62, 0x00, 0x05, 0x00, 0x2E, 0x69, 0x6D, 0x6E, 0x73, 0x88, 0x21, 0x00, 0xCE, 0x3C, 0x00, 0xCA,
+    0x21, 0x00, 0xBA, 0x1A, 0x00, 0xBA, 0x1A, 0x00, 0x01, 0x00, 0x6F, 0xD4, 0x3C, 0x00, 0x02, 0x00,
+    0x2E, 0x73, 0xF2, 0x3C, 0x00, 0xF6, 0x3C, 0x00, 0x00, 0x01, 0x26, 0x00, 0x02, 0x01, 0x26, 0x00,
+    0x61, 0x6F, 0xFC, 0x3C, 0x00, 0x02, 0x3D, 0x00, 0x01, 0x00, 0x67, 0x08, 0x3D, 0x00, 0x00, 0x02,
+    0x28, 0x00, 0x01, 0x00, 0xAD, 0x0E, 0x19, 0x00, 0x07, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75,
+    0xC3, 0xF0, 0x36, 0x00, 0xF0, 0x36, 0x00, 0xF4, 0x36, 0x00, 0xF0, 0x36, 0x00, 0xF0, 0x36, 0x00,
+    0xF0, 0x36, 0x00, 0x0E, 0x3D, 0x00, 0x08, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x75, 0xC3,
+    0x24, 0x3D, 0x00, 0x24, 0x3D, 0x00, 0xF8, 0x39, 0x00, 0x24, 0x3D, 0x00, 0x24, 0x3D, 0x00, 0x28,
+    0x3D, 0x00, 0x24, 0x3D, 0x00, 0x2C, 0x3D, 0x00, 0x01, 0x00, 0x61, 0xD4, 0x3C, 0x00, 0x01, 0x00,
+    0x6D, 0x9C, 0x2A, 0x00, 0x01, 0x00, 0x75, 0xD4, 0x3C, 0x00, 0x01, 0x00, 0x72, 0x42, 0x3D, 0x00,
+    0x01, 0x02, 0x3E, 0x00, 0x6D, 0x48, 0x3D, 0x00, 0x01, 0x00, 0x69, 0x36, 0x30, 0x00, 0x01, 0x00,
+    0x74, 0x4E, 0x3D, 0x00, 0x02, 0x00, 0x6F, 0x72, 0x54, 0x3D, 0x00, 0x5A, 0x3D, 0x00, 0x01, 0x00,
+    0x72, 0x60, 0x3D, 0x00, 0x02, 0x00, 0x69, 0xC3, 0x66, 0x3D, 0x00, 0x70, 0x3D, 0x00, 0x01, 0x00,
+    0x75, 0x76, 0x3D, 0x00, 0x01, 0x00, 0x75, 0x80, 0x3D, 0x00, 0x02, 0x00, 0x61, 0x69, 0xB8, 0x37,
+    0x00, 0x86, 0x3D, 0x00, 0x01, 0x00, 0x67, 0x90, 0x3D, 0x00, 0x01, 0x00, 0x72, 0x9A, 0x3D, 0x00,
+    0x01, 0x00, 0x72, 0xA0, 0x3D, 0x00, 0x03, 0x00, 0x61, 0x65, 0x74, 0xA6, 0x3D, 0x00, 0xA6, 0x3D,
+    0x00, 0xAA, 0x3D, 0x00, 0x01, 0x00, 0x65, 0xB0, 0x3D, 0x00, 0x01, 0x00, 0x75, 0xB6, 0x3D, 0x00,
+    0x02, 0x00, 0x6F, 0xC3, 0xB6, 0x3D, 0x00, 0xBC, 0x3D, 0x00, 0x06, 0x01, 0x3B, 0x00, 0x62, 0x64,
+    0x6D, 0x6E, 0x72, 0x73, 0x36, 0x30, 0x00, 0x36, 0x30, 0x00, 0x36, 0x30, 0x00, 0x36, 0x30, 0x00,
+    0x36, 0x30, 0x00, 0x36, 0x30, 0x00, 0x04, 0x00, 0x61, 0x68, 0x6F, 0xC3, 0xC2, 0x3D, 0x00, 0xDE,
+    0x3D, 0x00, 0xF0, 0x3D, 0x00, 0xF4, 0x3D, 0x00, 0x02, 0x00, 0x69, 0x75, 0xFE, 0x3D, 0x00, 0x04,
+    0x3E, 0x00, 0x03, 0x00, 0x65, 0x70, 0xC3, 0x0E, 0x3E, 0x00, 0x14, 0x3E, 0x00, 0x1E, 0x3E, 0x00,
+    0x01, 0x00, 0x66, 0x24, 0x3E, 0x00, 0x00, 0x01, 0x3B, 0x00, 0x01, 0x02, 0x80, 0x00, 0x75, 0x2A,
+    0x3E, 0x00, 0x02, 0x00, 0x63, 0x74, 0x34, 0x3E, 0x00, 0xB0, 0x28, 0x00, 0x03, 0x00, 0x63, 0x70,
+    0x74, 0x3A, 0x3E, 0x00, 0x40, 0x3E, 0x00, 0x52, 0x3E, 0x00, 0x01, 0x00, 0xA1, 0x60, 0x3E, 0x00,
+    0x02, 0x00, 0x65, 0x69, 0x7A, 0x3E, 0x00, 0x84, 0x3E, 0x00, 0x01, 0x00, 0x72, 0x8E, 0x3E, 0x00,
+    0x02, 0x00, 0x6E, 0x75, 0x36, 0x30, 0x00, 0x94, 0x3E, 0x00, 0x01, 0x00, 0x75, 0x9E, 0x3E, 0x00,
+    0x02, 0x00, 0x61, 0x70, 0xA4, 0x3E, 0x00, 0xAE, 0x3E, 0x00, 0x07, 0x00, 0x63, 0x65, 0x66, 0x68,
+    0x73, 0x74, 0x76, 0xB8, 0x3E, 0x00, 0xCA, 0x3E, 0x00, 0xD0, 0x3E, 0x00, 0xE2, 0x3E, 0x00, 0xE8,
+    0x3E, 0x00, 0xF2, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x74, 0x06, 0x3F, 0x00, 0x03, 0x00,
+    0x65, 0x6C, 0x73, 0x0C, 0x3F, 0x00, 0x12, 0x3F, 0x00, 0x18, 0x3F, 0x00, 0x03, 0x00, 0x61, 0x75,
+    0xC3, 0x1E, 0x3F, 0x00, 0x24, 0x3F, 0x00, 0x2A, 0x3F, 0x00, 0x01, 0x00, 0x6F, 0x30, 0x3F, 0x00,
+    0x05, 0x00, 0x61, 0x65, 0x6C, 0x6F, 0xC3, 0x36, 0x3F, 0x00, 0xF0, 0x3D, 0x00, 0x36, 0x30, 0x00,
+    0xF0, 0x3D, 0x00, 0x42, 0x3F, 0x00, 0x01, 0x00, 0x63, 0x50, 0x3F, 0x00, 0x01, 0x00, 0x72, 0x56,
+    0x3F, 0x00, 0x06, 0x00, 0x64, 0x65, 0x67, 0x69, 0x6E, 0x74, 0x5C, 0x3F, 0x00, 0x62, 0x3F, 0x00,
+    0x68, 0x3F, 0x00, 0x6E, 0x3F, 0x00, 0x78, 0x3F, 0x00, 0x7E, 0x3F, 0x00, 0x01, 0x00, 0x65, 0x84,
+    0x3F, 0x00, 0x03, 0x00, 0x61, 0x69, 0xC3, 0x30, 0x36, 0x00, 0x30, 0x36, 0x00, 0x8A, 0x3F, 0x00,
+    0x01, 0x00, 0x69, 0x30, 0x36, 0x00, 0x02, 0x00, 0x65, 0xC3, 0x30, 0x36, 0x00, 0x94, 0x3F, 0x00,
+    0x02, 0x00, 0x69, 0x73, 0x9A, 0x3F, 0x00, 0x62, 0x31, 0x00, 0x01, 0x00, 0x61, 0xA4, 0x3F, 0x00,
+    0x01, 0x00, 0x6C, 0xB2, 0x3F, 0x00, 0x05, 0x00, 0x61, 0x65, 0x69, 0x6F, 0xC3, 0xB8, 0x3F, 0x00,
+    0x30, 0x36, 0x00, 0xC2, 0x3F, 0x00, 0x30, 0x36, 0x00, 0xD8, 0x3F, 0x00, 0x01, 0x00, 0x62, 0x68,
+    0x3F, 0x00, 0x01, 0x00, 0x74, 0xE2, 0x3F, 0x00, 0x01, 0x00, 0xB1, 0xE8, 0x3F, 0x00, 0x02, 0x00,
+    0x68, 0x6C, 0xA4, 0x2F, 0x00, 0xF2, 0x3F, 0x00, 0x02, 0x00, 0x63, 0x72, 0xF8, 0x3F, 0x00, 0xFE,
+    0x3F, 0x00, 0x02, 0x00, 0x6C, 0x72, 0x04, 0x40, 0x00, 0x0A, 0x40, 0x00, 0x01, 0x00, 0x63, 0x10,
+    0x40, 0x00, 0x01, 0x00, 0xA9, 0x8C, 0x31, 0x00, 0x02, 0x00, 0x2E, 0x73, 0x36, 0x30, 0x00, 0x14,
+    0x40, 0x00, 0x01, 0x00, 0x6E, 0x1A, 0x40, 0x00, 0x01, 0x00, 0x6F, 0x20, 0x40, 0x00, 0x01, 0x00,
+    0x72, 0x26, 0x40, 0x00, 0x01, 0x00, 0x61, 0x80, 0x0A, 0x00, 0x01, 0x00, 0x72, 0x2A, 0x40, 0x00,
+    0x04, 0x00, 0x2E, 0x69, 0x6E, 0x73, 0x2E, 0x40, 0x00, 0xF4, 0x31, 0x00, 0x32, 0x40, 0x00, 0x32,
+    0x40, 0x00, 0x01, 0x00, 0x65, 0x38, 0x40, 0x00, 0x00, 0x02, 0x46, 0x00, 0x02, 0x00, 0x2E, 0x73,
+    0x2E, 0x40, 0x00, 0x32, 0x40, 0x00, 0x03, 0x00, 0x2E, 0x72, 0x73, 0x2E, 0x40, 0x00, 0x46, 0x40,
+    0x00, 0x32, 0x40, 0x00, 0x01, 0x00, 0x73, 0x32, 0x40, 0x00, 0x05, 0x00, 0x2E, 0x69, 0x6D, 0x6E,
+    0x73, 0x2E, 0x40, 0x00, 0xF4, 0x31, 0x00, 0x50, 0x24, 0x00, 0x32, 0x40, 0x00, 0x32, 0x40, 0x00,
+    0x01, 0x00, 0x6E, 0x32, 0x40, 0x00, 0x03, 0x00, 0xA1, 0xA9, 0xAD, 0x54, 0x40, 0x00, 0x62, 0x40,
+    0x00, 0x70, 0x40, 0x00, 0x01, 0x00, 0x65, 0x7A, 0x40, 0x00, 0x01, 0x00, 0x73, 0x56, 0x24, 0x00,
+    0x01, 0x00, 0x73, 0x88, 0x40, 0x00, 0x05, 0x00, 0x2E, 0x61, 0x65, 0x69, 0x6D, 0x88, 0x21, 0x00,
+    0xB6, 0x16, 0x00, 0x0C, 0x17, 0x00, 0x8E, 0x40, 0x00, 0x94, 0x40, 0x00, 0x01, 0x00, 0x61, 0x9A,
+    0x40, 0x00, 0x02, 0x00, 0x61, 0x65, 0x9A, 0x40, 0x00, 0x9A, 0x40, 0x00, 0x02, 0x00, 0x2E, 0x65,
+    0x88, 0x21, 0x00, 0x9A, 0x40, 0x00, 0x05, 0x00, 0x2E, 0x69, 0x6D, 0x6E, 0x73, 0x88, 0x21, 0x00,
+    0x0C, 0x17, 0x00, 0xCA, 0x21, 0x00, 0xBA, 0x1A, 0x00, 0xBA, 0x1A, 0x00, 0x01, 0x00, 0x72, 0x4E,
+    0x3D, 0x00, 0x01, 0x00, 0x65, 0x4E, 0x3D, 0x00, 0x01, 0x00, 0x72, 0x9C, 0x2A, 0x00, 0x01, 0x00,
+    0x6D, 0x36, 0x30, 0x00, 0x01, 0x00, 0x6E, 0xCC, 0x26, 0x00, 0x01, 0x00, 0xA9, 0xA0, 0x40, 0x00,
+    0x01, 0x00, 0x69, 0x06, 0x39, 0x00, 0x01, 0x00, 0xAD, 0xCC, 0x26, 0x00, 0x01, 0x00, 0xA1, 0xCC,
+    0x26, 0x00, 0x04, 0x00, 0xA1, 0xA9, 0xAD, 0xB3, 0xCC, 0x26, 0x00, 0xCC, 0x26, 0x00, 0xCC, 0x26,
+    0x00, 0xCC, 0x26, 0x00, 0x01, 0x00, 0x73, 0xCC, 0x26, 0x00, 0x01, 0x00, 0xC3, 0xA6, 0x40, 0x00,
+    0x01, 0x00, 0x71, 0xCC, 0x26, 0x00, 0x01, 0x00, 0x6D, 0xAC, 0x40, 0x00, 0x01, 0x00, 0xA1, 0xD6,
+    0x32, 0x00, 0x01, 0x00, 0x61, 0x94, 0x32, 0x00, 0x03, 0x00, 0x63, 0x71, 0x73, 0xCC, 0x26, 0x00,
+    0xCC, 0x26, 0x00, 0x0A, 0x3B, 0x00, 0x01, 0x00, 0xA9, 0xD6, 0x24, 0x00, 0x01, 0x00, 0x69, 0xB2,
+    0x40, 0x00, 0x03, 0x00, 0x63, 0x72, 0x74, 0xCC, 0x26, 0x00, 0xCC, 0x26, 0x00, 0xCC, 0x26, 0x00,
+    0x01, 0x00, 0x65, 0x00, 0x38, 0x00, 0x01, 0x00, 0x69, 0xF8, 0x2E, 0x00, 0x01, 0x00, 0x65, 0xF8,
+    0x2E, 0x00, 0x02, 0x00, 0x61, 0x6F, 0xF8, 0x2E, 0x00, 0xF8, 0x2E, 0x00, 0x01, 0x00, 0x69, 0xB6,
+    0x40, 0x00, 0x04, 0x00, 0x61, 0x65, 0x69, 0x6F, 0xF8, 0x2E, 0x00, 0xF8, 0x2E, 0x00, 0xF8, 0x2E,
+    0x00, 0xF8, 0x2E, 0x00, 0x01, 0x00, 0x6F, 0x7C, 0x36, 0x00, 0x01, 0x00, 0x69, 0xC4, 0x40, 0x00,
+    0x02, 0x00, 0x2E, 0x65, 0x90, 0x1C, 0x00, 0xCA, 0x40, 0x00, 0x09, 0x00, 0x2E, 0x61, 0x65, 0x68,
+    0x69, 0x6F, 0x73, 0x75, 0xC3, 0x90, 0x1C, 0x00, 0xF0, 0x36, 0x00, 0xF0, 0x36, 0x00, 0xF4, 0x36,
+    0x00, 0xF0, 0x36, 0x00, 0xF0, 0x36, 0x00, 0xA0, 0x1C, 0x00, 0xF0, 0x36, 0x00, 0xF8, 0x36, 0x00,
+    0x01, 0x00, 0xAD, 0xD0, 0x40, 0x00, 0x01, 0x00, 0x6E, 0xD6, 0x40, 0x00, 0x01, 0x02, 0x3E, 0x00,
+    0x6C, 0xDC, 0x40, 0x00, 0x08, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x75, 0xC3, 0x24, 0x3D,
+    0x00, 0x24, 0x3D, 0x00, 0xF8, 0x39, 0x00, 0xE2, 0x40, 0x00, 0xEA, 0x40, 0x00, 0x28, 0x3D, 0x00,
+    0x24, 0x3D, 0x00, 0xF6, 0x40, 0x00, 0x02, 0x00, 0x2E, 0x73, 0x6E, 0x0B, 0x00, 0xB8, 0x21, 0x00,
+    0x02, 0x00, 0x61, 0x6F, 0x0C, 0x41, 0x00, 0x0C, 0x41, 0x00, 0x01, 0x00, 0x2E, 0x16, 0x28, 0x00,
+    0x00, 0x02, 0x2F, 0x00, 0x01, 0x00, 0x73, 0x82, 0x34, 0x00, 0x01, 0x00, 0x6F, 0x10, 0x41, 0x00,
+    0x01, 0x00, 0x74, 0x1E, 0x41, 0x00, 0x01, 0x00, 0x69, 0x24, 0x41, 0x00, 0x00, 0x01, 0x25, 0x00,
+    0x01, 0x00, 0x65, 0x2A, 0x41, 0x00, 0x02, 0x00, 0x69, 0x74, 0xEC, 0x33, 0x00, 0xEC, 0x33, 0x00,
+    0x01, 0x00, 0x73, 0x30, 0x41, 0x00, 0x01, 0x00, 0xA9, 0x00, 0x34, 0x00, 0x01, 0x00, 0x62, 0xEC,
+    0x33, 0x00, 0x01, 0x00, 0x73, 0x36, 0x41, 0x00, 0x03, 0x01, 0x27, 0x00, 0x61, 0x65, 0xC3, 0xCC,
+    0x26, 0x00, 0xCC, 0x26, 0x00, 0xAC, 0x32, 0x00, 0x04, 0x00, 0x65, 0x69, 0x72, 0xC3, 0x3C, 0x41,
+    0x00, 0x42, 0x41, 0x00, 0x50, 0x41, 0x00, 0x56, 0x41, 0x00, 0x01, 0x00, 0x69, 0x5C, 0x41, 0x00,
+    0x02, 0x00, 0x69, 0x6F, 0x0C, 0x41, 0x00, 0xD4, 0x3C, 0x00, 0x01, 0x00, 0x6D, 0x64, 0x41, 0x00,
+    0x01, 0x00, 0x65, 0x6A, 0x41, 0x00, 0x01, 0x00, 0x61, 0x90, 0x1C, 0x00, 0x01, 0x00, 0x61, 0x70,
+    0x41, 0x00, 0x01, 0x00, 0x65, 0xC6, 0x1A, 0x00, 0x01, 0x00, 0x2E, 0x0C, 0x41, 0x00, 0x01, 0x00,
+    0x72, 0xA6, 0x3D, 0x00, 0x01, 0x02, 0x3E, 0x00, 0x74, 0x74, 0x41, 0x00, 0x01, 0x00, 0x6E, 0x7A,
+    0x41, 0x00, 0x01, 0x00, 0x2E, 0xD0, 0x33, 0x00, 0x02, 0x00, 0x2E, 0x65, 0x7E, 0x41, 0x00, 0x82,
+    0x41, 0x00, 0x00, 0x03, 0x6A, 0x00, 0x02, 0x00, 0x2E, 0x73, 0x7E, 0x41, 0x00, 0x88, 0x41, 0x00,
+    0x01, 0x00, 0x2E, 0x92, 0x34, 0x00, 0x01, 0x00, 0xAD, 0x8E, 0x41, 0x00, 0x01, 0x00, 0x69, 0x94,
+    0x41, 0x00, 0x01, 0x02, 0x3E, 0x00, 0x70, 0x9A, 0x41, 0x00, 0x01, 0x00, 0x6E, 0xA0, 0x41, 0x00,
+    0x01, 0x00, 0x6F, 0xA6, 0x41, 0x00, 0x01, 0x02, 0x3E, 0x00, 0x73, 0xAC, 0x41, 0x00, 0x01, 0x02,
+    0x3E, 0x00, 0x6C, 0xB6, 0x41, 0x00, 0x05, 0x00, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0x8E, 0x39, 0x00,
+    0x8E, 0x39, 0x00, 0xBC, 0x41, 0x00, 0x8E, 0x39, 0x00, 0x8E, 0x39, 0x00, 0x01, 0x00, 0x74, 0xC4,
+    0x41, 0x00, 0x01, 0x00, 0x69, 0xCA, 0x41, 0x00, 0x01, 0x00, 0x6E, 0xD0, 0x41, 0x00, 0x01, 0x00,
+    0x74, 0xD6, 0x41, 0x00, 0x02, 0x02, 0x3E, 0x00, 0x6E, 0x72, 0xDA, 0x41, 0x00, 0xE4, 0x41, 0x00,
+    0x01, 0x02, 0x3E, 0x00, 0x6D, 0xEE, 0x41, 0x00, 0x01, 0x02, 0x3E, 0x00, 0x72, 0xF4, 0x41, 0x00,
+    0x05, 0x00, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xF8, 0x41, 0x00, 0x00, 0x42, 0x00, 0x8E, 0x39, 0x00,
+    0x8E, 0x39, 0x00, 0x8E, 0x39, 0x00, 0x07, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0xF0,
+    0x36, 0x00, 0x08, 0x42, 0x00, 0xF4, 0x36, 0x00, 0xF0, 0x36, 0x00, 0xF0, 0x36, 0x00, 0xF0, 0x36,
+    0x00, 0xF8, 0x36, 0x00, 0x01, 0x00, 0x65, 0x10, 0x42, 0x00, 0x01, 0x00, 0x74, 0x16, 0x42, 0x00,
+    0x01, 0x00, 0x70, 0x16, 0x42, 0x00, 0x01, 0x00, 0x64, 0xD0, 0x26, 0x00, 0x01, 0x00, 0x65, 0x1C,
+    0x42, 0x00, 0x02, 0x00, 0x2E, 0x73, 0xCC, 0x26, 0x00, 0x22, 0x42, 0x00, 0x00, 0x02, 0xAF, 0x00,
+    0x01, 0x00, 0x74, 0xF4, 0x41, 0x00, 0x01, 0x00, 0x63, 0x28, 0x42, 0x00, 0x01, 0x00, 0xAD, 0x2E,
+    0x42, 0x00, 0x07, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x34, 0x42, 0x00, 0x34, 0x42,
+    0x00, 0x38, 0x42, 0x00, 0x34, 0x42, 0x00, 0x34, 0x42, 0x00, 0x34, 0x42, 0x00, 0x3C, 0x42, 0x00,
+    0x07, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x52, 0x42, 0x00, 0xF0, 0x36, 0x00, 0xF4,
+    0x36, 0x00, 0xF0, 0x36, 0x00, 0xF0, 0x36, 0x00, 0xF0, 0x36, 0x00, 0xF8, 0x36, 0x00, 0x01, 0x00,
+    0x73, 0x5A, 0x42, 0x00, 0x03, 0x00, 0x61, 0x6F, 0xC3, 0x60, 0x42, 0x00, 0x6A, 0x42, 0x00, 0x70,
+    0x42, 0x00, 0x01, 0x00, 0x73, 0x52, 0x28, 0x00, 0x01, 0x00, 0x65, 0x76, 0x42, 0x00, 0x08, 0x00,
+    0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x75, 0xC3, 0x7C, 0x42, 0x00, 0x24, 0x3D, 0x00, 0xF8, 0x39,
+    0x00, 0x84, 0x42, 0x00, 0x24, 0x3D, 0x00, 0x28, 0x3D, 0x00, 0x24, 0x3D, 0x00, 0x8C, 0x42, 0x00,
+    0x07, 0x01, 0x92, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0xF0, 0x36, 0x00, 0xF0, 0x36,
+    0x00, 0xF4, 0x36, 0x00, 0xF0, 0x36, 0x00, 0xF0, 0x36, 0x00, 0xF0, 0x36, 0x00, 0xF8, 0x36, 0x00,
+    0x00, 0x02, 0x80, 0x00, 0x07, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0xA2, 0x42, 0x00,
+    0xB6, 0x42, 0x00, 0xF8, 0x39, 0x00, 0xC2, 0x42, 0x00, 0xE6, 0x42, 0x00, 0xF2, 0x42, 0x00, 0x9E,
+    0x3C, 0x00, 0x04, 0x00, 0x62, 0x6C, 0x6E, 0x74, 0x02, 0x43, 0x00, 0x08, 0x43, 0x00, 0x16, 0x43,
+    0x00, 0x20, 0x43, 0x00, 0x01, 0x00, 0x72, 0x26, 0x43, 0x00, 0x01, 0x00, 0x63, 0x30, 0x43, 0x00,
+    0x01, 0x00, 0x69, 0x36, 0x43, 0x00, 0x01, 0x00, 0x72, 0x3C, 0x43, 0x00, 0x00, 0x01, 0x09, 0x00,
+    0x01, 0x00, 0x6C, 0x42, 0x43, 0x00, 0x06, 0x00, 0x6C, 0x6D, 0x6E, 0x6F, 0x73, 0x74, 0xA0, 0x36,
+    0x00, 0x50, 0x43, 0x00, 0xDA, 0x16, 0x00, 0x08, 0x0B, 0x00, 0x56, 0x43, 0x00, 0x56, 0x43, 0x00,
+    0x03, 0x00, 0x61, 0x65, 0x6F, 0xC6, 0x1A, 0x00, 0xC6, 0x1A, 0x00, 0xC6, 0x1A, 0x00, 0x01, 0x00,
+    0x6C, 0x5C, 0x43, 0x00, 0x01, 0x00, 0x73, 0xBA, 0x36, 0x00, 0x01, 0x00, 0x6C, 0x6A, 0x43, 0x00,
+    0x01, 0x00, 0x63, 0xD0, 0x1D, 0x00, 0x01, 0x00, 0x6C, 0x78, 0x43, 0x00, 0x01, 0x00, 0x73, 0x86,
+    0x43, 0x00, 0x00, 0x02, 0x6F, 0x00, 0x01, 0x00, 0x2E, 0xD2, 0x36, 0x00, 0x03, 0x00, 0x2E, 0x69,
+    0x73, 0x8C, 0x43, 0x00, 0xCC, 0x36, 0x00, 0x90, 0x43, 0x00, 0x01, 0x00, 0x63, 0x96, 0x43, 0x00,
+    0x00, 0x02, 0x06, 0x00, 0x00, 0x01, 0x08, 0x00, 0x05, 0x00, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xA0,
+    0x43, 0x00, 0xA0, 0x43, 0x00, 0xA0, 0x43, 0x00, 0xA0, 0x43, 0x00, 0xA0, 0x43, 0x00, 0x01, 0x00,
+    0x6F, 0xCC, 0x26, 0x00, 0x01, 0x00, 0x6F, 0xA4, 0x43, 0x00, 0x01, 0x00, 0x69, 0x0E, 0x37, 0x00,
+    0x01, 0x00, 0x67, 0xAA, 0x43, 0x00, 0x01, 0x00, 0xB3, 0xE4, 0x20, 0x00, 0x02, 0x00, 0x6A, 0x6E,
+    0xB0, 0x43, 0x00, 0xB6, 0x43, 0x00, 0x01, 0x00, 0x61, 0xBC, 0x43, 0x00, 0x03, 0x00, 0x6E, 0x70,
+    0x76, 0xC2, 0x43, 0x00, 0xC8, 0x43, 0x00, 0xCE, 0x43, 0x00, 0x01, 0x00, 0x73, 0x80, 0x35, 0x00,
+    0x01, 0x00, 0x6E, 0x80, 0x35, 0x00, 0x01, 0x00, 0x6C, 0xD4, 0x43, 0x00, 0x01, 0x00, 0x65, 0xDA,
+    0x43, 0x00, 0x01, 0x00, 0x6C, 0xF8, 0x2E, 0x00, 0x01, 0x00, 0x73, 0x6E, 0x37, 0x00, 0x01, 0x00,
+    0x63, 0xF8, 0x2E, 0x00, 0x01, 0x00, 0xB3, 0xCC, 0x38, 0x00, 0x01, 0x00, 0x65, 0xE0, 0x43, 0x00,
+    0x01, 0x00, 0x61, 0x62, 0x37, 0x00, 0x02, 0x00, 0x63, 0x74, 0xCC, 0x26, 0x00, 0xCC, 0x26, 0x00,
+    0x01, 0x00, 0x63, 0xCC, 0x26, 0x00, 0x01, 0x00, 0x63, 0xAC, 0x40, 0x00, 0x01, 0x00, 0xA1, 0xF8,
+    0x2E, 0x00, 0x01, 0x00, 0x68, 0xB8, 0x37, 0x00, 0x01, 0x00, 0x65, 0xE6, 0x43, 0x00, 0x02, 0x00,
+    0x69, 0x6F, 0xB8, 0x37, 0x00, 0xB8, 0x37, 0x00, 0x00, 0x01, 0xE5, 0x00, 0x00, 0x01, 0x92, 0x00,
+    0x01, 0x00, 0x75, 0x00, 0x39, 0x00, 0x01, 0x00, 0x72, 0x96, 0x2D, 0x00, 0x01, 0x00, 0xA9, 0xC6,
+    0x37, 0x00, 0x03, 0x00, 0x65, 0x69, 0xC3, 0xEC, 0x43, 0x00, 0xEC, 0x43, 0x00, 0xF2, 0x43, 0x00,
+    0x01, 0x00, 0x75, 0x04, 0x3C, 0x00, 0x01, 0x00, 0x74, 0xB8, 0x37, 0x00, 0x01, 0x00, 0x74, 0xF8,
+    0x43, 0x00, 0x00, 0x03, 0x2A, 0x01, 0x00, 0x02, 0x28, 0x01, 0x01, 0x00, 0x6F, 0xFE, 0x43, 0x00,
+    0x01, 0x00, 0x6E, 0xF8, 0x2E, 0x00, 0x01, 0x00, 0xA9, 0x00, 0x38, 0x00, 0x01, 0x00, 0x72, 0xF8,
+    0x2E, 0x00, 0x01, 0x00, 0xB3, 0xD6, 0x24, 0x00, 0x01, 0x00, 0x73, 0x06, 0x44, 0x00, 0x01, 0x00,
+    0xAD, 0x18, 0x38, 0x00, 0x01, 0x00, 0x74, 0x4A, 0x38, 0x00, 0x01, 0x01, 0x26, 0x00, 0x72, 0xF8,
+    0x2E, 0x00, 0x03, 0x00, 0xA1, 0xA9, 0xB3, 0xF8, 0x2E, 0x00, 0xF8, 0x2E, 0x00, 0xF8, 0x2E, 0x00,
+    0x01, 0x00, 0x72, 0x0C, 0x44, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x00, 0x01, 0xD5, 0x00, 0x01, 0x00,
+    0x73, 0x4A, 0x38, 0x00, 0x01, 0x00, 0x6C, 0x4A, 0x38, 0x00, 0x01, 0x00, 0x72, 0x90, 0x37, 0x00,
+    0x01, 0x00, 0x72, 0x1A, 0x44, 0x00, 0x02, 0x00, 0x6E, 0x70, 0x00, 0x39, 0x00, 0x00, 0x39, 0x00,
+    0x01, 0x00, 0x70, 0x00, 0x39, 0x00, 0x01, 0x00, 0x63, 0x00, 0x39, 0x00, 0x01, 0x00, 0x61, 0xD2,
+    0x38, 0x00, 0x01, 0x00, 0x65, 0x94, 0x32, 0x00, 0x01, 0x00, 0xA1, 0x5E, 0x2F, 0x00, 0x01, 0x00,
+    0x76, 0x20, 0x44, 0x00, 0x01, 0x00, 0x6C, 0x26, 0x44, 0x00, 0x02, 0x00, 0x63, 0x6D, 0xF8, 0x2E,
+    0x00, 0xCC, 0x26, 0x00, 0x01, 0x00, 0x67, 0x2C, 0x44, 0x00, 0x01, 0x00, 0x6C, 0xCC, 0x26, 0x00,
+    0x02, 0x00, 0x61, 0x69, 0x32, 0x44, 0x00, 0x90, 0x37, 0x00, 0x01, 0x00, 0x65, 0x38, 0x44, 0x00,
+    0x01, 0x00, 0xC3, 0x46, 0x44, 0x00, 0x01, 0x00, 0x75, 0xDE, 0x38, 0x00, 0x01, 0x00, 0x73, 0x00,
+    0x39, 0x00, 0x01, 0x00, 0x6E, 0x00, 0x39, 0x00, 0x01, 0x00, 0x63, 0x4C, 0x44, 0x00, 0x01, 0x00,
+    0x67, 0xCC, 0x26, 0x00, 0x01, 0x00, 0x64, 0xAC, 0x40, 0x00, 0x01, 0x00, 0x72, 0x0C, 0x38, 0x00,
+    0x01, 0x00, 0x6F, 0xD2, 0x38, 0x00, 0x02, 0x00, 0x69, 0xC3, 0x1A, 0x44, 0x00, 0x54, 0x44, 0x00,
+    0x01, 0x00, 0x74, 0xCC, 0x26, 0x00, 0x01, 0x00, 0x61, 0xCC, 0x26, 0x00, 0x02, 0x00, 0x61, 0x6F,
+    0xF8, 0x2E, 0x00, 0xF8, 0x2E, 0x00, 0x01, 0x00, 0x61, 0x5A, 0x44, 0x00, 0x01, 0x00, 0x6E, 0x60,
+    0x44, 0x00, 0x03, 0x00, 0x61, 0x6C, 0x6F, 0xF8, 0x2E, 0x00, 0x6A, 0x44, 0x00, 0xF8, 0x2E, 0x00,
+    0x01, 0x00, 0x6E, 0x7C, 0x44, 0x00, 0x01, 0x00, 0x72, 0x00, 0x39, 0x00, 0x08, 0x00, 0x61, 0x65,
+    0x68, 0x69, 0x6F, 0x72, 0x75, 0xC3, 0x82, 0x44, 0x00, 0x86, 0x44, 0x00, 0x8E, 0x44, 0x00, 0x82,
+    0x44, 0x00, 0x82, 0x44, 0x00, 0x92, 0x44, 0x00, 0x82, 0x44, 0x00, 0x9E, 0x44, 0x00, 0x01, 0x00,
+    0x6C, 0xB4, 0x44, 0x00, 0x01, 0x00, 0x69, 0xBA, 0x44, 0x00, 0x01, 0x00, 0x69, 0xC0, 0x44, 0x00,
+    0x01, 0x00, 0x69, 0x04, 0x3C, 0x00, 0x01, 0x00, 0x6F, 0xC6, 0x44, 0x00, 0x01, 0x00, 0x64, 0xD0,
+    0x44, 0x00, 0x01, 0x00, 0x75, 0xD6, 0x44, 0x00, 0x01, 0x00, 0x74, 0x1C, 0x2C, 0x00, 0x00, 0x02,
+    0x3C, 0x00, 0x01, 0x00, 0x72, 0xDA, 0x44, 0x00, 0x01, 0x00, 0x65, 0x92, 0x39, 0x00, 0x02, 0x00,
+    0x61, 0xC3, 0xE0, 0x44, 0x00, 0xE6, 0x44, 0x00, 0x01, 0x00, 0x72, 0xEC, 0x44, 0x00, 0x01, 0x00,
+    0x6C, 0xF2, 0x44, 0x00, 0x01, 0x00, 0x73, 0xF6, 0x44, 0x00, 0x01, 0x00, 0x6C, 0xFC, 0x44, 0x00,
+    0x01, 0x00, 0x72, 0x06, 0x45, 0x00, 0x01, 0x00, 0x70, 0x0C, 0x45, 0x00, 0x03, 0x03, 0x18, 0x01,
+    0x63, 0x6A, 0x72, 0x16, 0x33, 0x00, 0x12, 0x45, 0x00, 0xF8, 0x2E, 0x00, 0x06, 0x03, 0x18, 0x01,
+    0x61, 0x6C, 0x6D, 0x6F, 0x72, 0x74, 0x0C, 0x38, 0x00, 0x18, 0x45, 0x00, 0x1E, 0x45, 0x00, 0xF8,
+    0x2E, 0x00, 0x2C, 0x45, 0x00, 0x3A, 0x45, 0x00, 0x00, 0x02, 0x88, 0x00, 0x07, 0x03, 0x18, 0x01,
+    0x63, 0x67, 0x6C, 0x6D, 0x6E, 0x73, 0x7A, 0x40, 0x45, 0x00, 0x46, 0x45, 0x00, 0x4C, 0x45, 0x00,
+    0x62, 0x45, 0x00, 0x68, 0x45, 0x00, 0x78, 0x45, 0x00, 0x82, 0x45, 0x00, 0x02, 0x03, 0x18, 0x01,
+    0x70, 0x72, 0x8C, 0x45, 0x00, 0xB6, 0x43, 0x00, 0x02, 0x00, 0x65, 0x6F, 0x92, 0x45, 0x00, 0x98,
+    0x45, 0x00, 0x02, 0x03, 0x18, 0x01, 0x6C, 0x72, 0x9E, 0x45, 0x00, 0xB0, 0x45, 0x00, 0x05, 0x00,
+    0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xBA, 0x45, 0x00, 0xBA, 0x45, 0x00, 0xBE, 0x45, 0x00, 0xC6, 0x45,
+    0x00, 0xBA, 0x45, 0x00, 0x02, 0x00, 0x75, 0xC3, 0xCE, 0x45, 0x00, 0xD4, 0x45, 0x00, 0x01, 0x00,
+    0x64, 0xDA, 0x45, 0x00, 0x01, 0x02, 0x3C, 0x00, 0x6D, 0xE4, 0x45, 0x00, 0x01, 0x00, 0x6F, 0xEA,
+    0x45, 0x00, 0x01, 0x00, 0x61, 0xEA, 0x38, 0x00, 0x01, 0x00, 0x62, 0xF0, 0x45, 0x00, 0x01, 0x00,
+    0xAD, 0x02, 0x46, 0x00, 0x00, 0x02, 0x86, 0x00, 0x01, 0x00, 0x65, 0x36, 0x39, 0x00, 0x02, 0x00,
+    0x6F, 0xC3, 0xD6, 0x24, 0x00, 0x12, 0x38, 0x00, 0x01, 0x00, 0x6E, 0x08, 0x46, 0x00, 0x01, 0x00,
+    0xC3, 0x0E, 0x46, 0x00, 0x01, 0x00, 0xBA, 0x9E, 0x3A, 0x00, 0x02, 0x00, 0x69, 0xC3, 0x14, 0x46,
+    0x00, 0x1E, 0x46, 0x00, 0x01, 0x00, 0x72, 0x0A, 0x3B, 0x00, 0x01, 0x00, 0xAD, 0xB4, 0x3A, 0x00,
+    0x03, 0x00, 0x61, 0x75, 0xC3, 0x24, 0x46, 0x00, 0x2A, 0x46, 0x00, 0x30, 0x46, 0x00, 0x01, 0x00,
+    0xBA, 0x18, 0x38, 0x00, 0x01, 0x00, 0x67, 0xD6, 0x24, 0x00, 0x03, 0x00, 0x6D, 0x73, 0x7A, 0xCC,
+    0x26, 0x00, 0x36, 0x46, 0x00, 0x40, 0x46, 0x00, 0x01, 0x00, 0x6A, 0xCC, 0x26, 0x00, 0x03, 0x00,
+    0xA9, 0xAD, 0xB3, 0xD4, 0x3A, 0x00, 0x4A, 0x46, 0x00, 0xE8, 0x3A, 0x00, 0x03, 0x00, 0xA1, 0xA9,
+    0xB3, 0xCC, 0x26, 0x00, 0xCC, 0x26, 0x00, 0xCC, 0x26, 0x00, 0x01, 0x00, 0x6D, 0xCC, 0x26, 0x00,
+    0x01, 0x00, 0xAD, 0x0A, 0x3B, 0x00, 0x01, 0x00, 0x72, 0x50, 0x46, 0x00, 0x02, 0x00, 0x65, 0xC3,
+    0x56, 0x46, 0x00, 0x60, 0x46, 0x00, 0x01, 0x00, 0xBA, 0x0A, 0x3B, 0x00, 0x01, 0x00, 0x6E, 0x6A,
+    0x46, 0x00, 0x02, 0x00, 0x63, 0x71, 0x70, 0x46, 0x00, 0xCC, 0x26, 0x00, 0x01, 0x00, 0xAD, 0x7E,
+    0x46, 0x00, 0x01, 0x01, 0x26, 0x00, 0x74, 0x16, 0x33, 0x00, 0x01, 0x00, 0xA1, 0x84, 0x25, 0x00,
+    0x08, 0x00, 0x61, 0x64, 0x65, 0x66, 0x6D, 0x72, 0x73, 0xC3, 0xF8, 0x2E, 0x00, 0xF8, 0x2E, 0x00,
+    0xF8, 0x2E, 0x00, 0xCC, 0x26, 0x00, 0x88, 0x46, 0x00, 0xF8, 0x2E, 0x00, 0xF8, 0x2E, 0x00, 0x8A,
+    0x46, 0x00, 0x02, 0x00, 0xA1, 0xAD, 0xF8, 0x2E, 0x00, 0x2A, 0x38, 0x00, 0x01, 0x00, 0xA1, 0xD6,
+    0x24, 0x00, 0x01, 0x00, 0x6C, 0x94, 0x46, 0x00, 0x03, 0x00, 0x61, 0x65, 0x6F, 0xCC, 0x26, 0x00,
+    0xCC, 0x26, 0x00, 0xCC, 0x26, 0x00, 0x01, 0x00, 0x74, 0x9E, 0x46, 0x00, 0x02, 0x00, 0x65, 0x75,
+    0xA4, 0x46, 0x00, 0xAE, 0x46, 0x00, 0x01, 0x00, 0x6C, 0xB4, 0x46, 0x00, 0x03, 0x00, 0x63, 0x69,
+    0x74, 0xBA, 0x46, 0x00, 0xC0, 0x46, 0x00, 0xC4, 0x24, 0x00, 0x01, 0x00, 0x74, 0xC6, 0x46, 0x00,
+    0x01, 0x00, 0xC3, 0xD8, 0x46, 0x00, 0x01, 0x00, 0x65, 0xDE, 0x46, 0x00, 0x01, 0x00, 0x65, 0xE4,
+    0x46, 0x00, 0x01, 0x00, 0x70, 0xEA, 0x46, 0x00, 0x01, 0x00, 0x74, 0x10, 0x33, 0x00, 0x02, 0x00,
+    0x70, 0x74, 0xF0, 0x46, 0x00, 0xF6, 0x46, 0x00, 0x03, 0x00, 0x61, 0x6F, 0xC3, 0x08, 0x47, 0x00,
+    0x0C, 0x47, 0x00, 0x14, 0x47, 0x00, 0x03, 0x00, 0x6E, 0x72, 0x73, 0xE4, 0x20, 0x00, 0xCC, 0x26,
+    0x00, 0xCC, 0x26, 0x00, 0x01, 0x00, 0x6C, 0x46, 0x38, 0x00, 0x01, 0x00, 0x69, 0x1A, 0x47, 0x00,
+    0x02, 0x00, 0x73, 0x74, 0x20, 0x47, 0x00, 0x26, 0x47, 0x00, 0x01, 0x00, 0xA9, 0x94, 0x32, 0x00,
+    0x01, 0x00, 0x63, 0x2C, 0x47, 0x00, 0x01, 0x00, 0x69, 0x32, 0x47, 0x00, 0x01, 0x00, 0x64, 0x38,
+    0x47, 0x00, 0x01, 0x00, 0x79, 0x96, 0x2D, 0x00, 0x01, 0x00, 0x62, 0x42, 0x47, 0x00, 0x02, 0x03,
+    0x09, 0x01, 0x72, 0x73, 0x48, 0x47, 0x00, 0x4E, 0x47, 0x00, 0x00, 0x03, 0x09, 0x01, 0x03, 0x03,
+    0x09, 0x01, 0x6D, 0x6E, 0x72, 0x16, 0x33, 0x00, 0x6A, 0x46, 0x00, 0xCC, 0x26, 0x00, 0x01, 0x00,
+    0x74, 0x5A, 0x2A, 0x00, 0x01, 0x00, 0x73, 0x5A, 0x2A, 0x00, 0x01, 0x00, 0x6D, 0x54, 0x47, 0x00,
+    0x02, 0x00, 0x62, 0x6C, 0x5A, 0x47, 0x00, 0x60, 0x47, 0x00, 0x01, 0x02, 0x86, 0x00, 0x67, 0x66,
+    0x47, 0x00, 0x01, 0x02, 0x86, 0x00, 0x65, 0x6A, 0x47, 0x00, 0x01, 0x02, 0x86, 0x00, 0xC3, 0x70,
+    0x47, 0x00, 0x02, 0x02, 0x86, 0x00, 0x64, 0x6E, 0x9E, 0x45, 0x00, 0x76, 0x47, 0x00, 0x05, 0x00,
+    0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0x7C, 0x47, 0x00, 0x7C, 0x47, 0x00, 0x7C, 0x47, 0x00, 0x7C, 0x47,
+    0x00, 0x7C, 0x47, 0x00, 0x01, 0x00, 0x78, 0x8E, 0x39, 0x00, 0x00, 0x01, 0x60, 0x00, 0x01, 0x00,
+    0x6E, 0x80, 0x47, 0x00, 0x01, 0x00, 0x61, 0x86, 0x47, 0x00, 0x00, 0x01, 0x65, 0x00, 0x01, 0x00,
+    0x73, 0x88, 0x21, 0x00, 0x07, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x75, 0xC3, 0x8C, 0x47, 0x00,
+    0x8C, 0x47, 0x00, 0x90, 0x47, 0x00, 0x8C, 0x47, 0x00, 0x8C, 0x47, 0x00, 0x8C, 0x47, 0x00, 0x94,
+    0x47, 0x00, 0x00, 0x01, 0x5E, 0x00, 0x01, 0x00, 0x2E, 0xF2, 0x3C, 0x00, 0x01, 0x00, 0x73, 0x02,
+    0x3D, 0x00, 0x01, 0x00, 0x2E, 0xAA, 0x47, 0x00, 0x01, 0x00, 0xC3, 0xAE, 0x47, 0x00, 0x05, 0x00,
+    0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xB4, 0x47, 0x00, 0xA0, 0x43, 0x00, 0xA0, 0x43, 0x00, 0xA0, 0x43,
+    0x00, 0xA0, 0x43, 0x00, 0x00, 0x03, 0x9C, 0x00, 0x00, 0x02, 0xA2, 0x00, 0x05, 0x00, 0xA1, 0xA9,
+    0xAD, 0xB3, 0xBA, 0xBC, 0x47, 0x00, 0xBC, 0x47, 0x00, 0xBC, 0x47, 0x00, 0xBC, 0x47, 0x00, 0xBC,
+    0x47, 0x00, 0x01, 0x00, 0x69, 0xC0, 0x47, 0x00, 0x01, 0x00, 0x69, 0xC6, 0x47, 0x00, 0x01, 0x00,
+    0x6F, 0xCC, 0x47, 0x00, 0x01, 0x00, 0x72, 0xEA, 0x47, 0x00, 0x01, 0x00, 0x69, 0xEE, 0x47, 0x00,
+    0x01, 0x00, 0x61, 0xF4, 0x47, 0x00, 0x02, 0x00, 0x61, 0xC3, 0xEA, 0x47, 0x00, 0xFA, 0x47, 0x00,
+    0x01, 0x00, 0xAD, 0x08, 0x48, 0x00, 0x02, 0x00, 0x61, 0x69, 0x16, 0x48, 0x00, 0x1A, 0x48, 0x00,
+    0x01, 0x00, 0x63, 0x34, 0x3E, 0x00, 0x02, 0x00, 0x6E, 0x76, 0x20, 0x48, 0x00, 0xEA, 0x47, 0x00,
+    0x02, 0x00, 0x65, 0x72, 0x2A, 0x48, 0x00, 0xB0, 0x28, 0x00, 0x01, 0x00, 0x65, 0x30, 0x48, 0x00,
+    0x01, 0x00, 0x6F, 0x36, 0x48, 0x00, 0x00, 0x01, 0xC1, 0x00, 0x01, 0x00, 0x72, 0xB0, 0x28, 0x00,
+    0x01, 0x00, 0x73, 0x16, 0x48, 0x00, 0x01, 0x00, 0x6E, 0xEA, 0x47, 0x00, 0x01, 0x00, 0xB3, 0xB6,
+    0x3D, 0x00, 0x06, 0x02, 0xE1, 0x00, 0x62, 0x64, 0x6D, 0x6E, 0x72, 0x73, 0xF0, 0x3D, 0x00, 0xF0,
+    0x3D, 0x00, 0xF0, 0x3D, 0x00, 0xF0, 0x3D, 0x00, 0xF0, 0x3D, 0x00, 0xF0, 0x3D, 0x00, 0x04, 0x00,
+    0x61, 0x65, 0x6F, 0xC3, 0xF0, 0x3D, 0x00, 0xF0, 0x3D, 0x00, 0xF0, 0x3D, 0x00, 0x42, 0x3F, 0x00,
+    0x00, 0x02, 0xE1, 0x00, 0x02, 0x00, 0xA1, 0xB3, 0xC2, 0x3D, 0x00, 0xF0, 0x3D, 0x00, 0x01, 0x00,
+    0x66, 0x30, 0x36, 0x00, 0x02, 0x00, 0x63, 0x71, 0x30, 0x36, 0x00, 0x30, 0x36, 0x00, 0x01, 0x00,
+    0x6A, 0x3C, 0x48, 0x00, 0x02, 0x00, 0x65, 0xC3, 0x4E, 0x48, 0x00, 0x54, 0x48, 0x00, 0x01, 0x00,
+    0xA9, 0x5A, 0x48, 0x00, 0x01, 0x00, 0x72, 0x60, 0x48, 0x00, 0x02, 0x00, 0x65, 0xC3, 0xEA, 0x47,
+    0x00, 0x6A, 0x48, 0x00, 0x01, 0x00, 0x69, 0xB0, 0x28, 0x00, 0x01, 0x00, 0x6F, 0x70, 0x48, 0x00,
+    0x04, 0x00, 0x61, 0x65, 0x69, 0x75, 0x30, 0x36, 0x00, 0x76, 0x48, 0x00, 0x7C, 0x48, 0x00, 0x82,
+    0x48, 0x00, 0x03, 0x00, 0x61, 0x69, 0x72, 0x88, 0x48, 0x00, 0x82, 0x48, 0x00, 0x96, 0x48, 0x00,
+    0x06, 0x00, 0x62, 0x64, 0x6D, 0x6E, 0x72, 0x73, 0x36, 0x30, 0x00, 0x36, 0x30, 0x00, 0x36, 0x30,
+    0x00, 0x36, 0x30, 0x00, 0x36, 0x30, 0x00, 0x36, 0x30, 0x00, 0x02, 0x00, 0x6F, 0x72, 0xA0, 0x48,
+    0x00, 0x36, 0x30, 0x00, 0x02, 0x00, 0x61, 0x6F, 0x36, 0x30, 0x00, 0x36, 0x30, 0x00, 0x01, 0x00,
+    0x74, 0x36, 0x30, 0x00, 0x02, 0x00, 0x61, 0xC3, 0xA0, 0x48, 0x00, 0xA6, 0x48, 0x00, 0x01, 0x00,
+    0x73, 0xAC, 0x48, 0x00, 0x02, 0x00, 0x67, 0x6E, 0xB2, 0x48, 0x00, 0x30, 0x36, 0x00, 0x02, 0x00,
+    0x6F, 0x72, 0x7C, 0x48, 0x00, 0xB8, 0x48, 0x00, 0x04, 0x00, 0x65, 0x6C, 0x6F, 0x72, 0xBE, 0x48,
+    0x00, 0xB2, 0x48, 0x00, 0xC4, 0x48, 0x00, 0xCA, 0x48, 0x00, 0x01, 0x00, 0x6E, 0xD0, 0x48, 0x00,
+    0x04, 0x00, 0x61, 0x65, 0x6C, 0x6F, 0xDA, 0x48, 0x00, 0xE0, 0x48, 0x00, 0xE6, 0x48, 0x00, 0xEE,
+    0x48, 0x00, 0x01, 0x00, 0x69, 0xF4, 0x48, 0x00, 0x02, 0x00, 0x65, 0x74, 0xFA, 0x48, 0x00, 0x00,
+    0x49, 0x00, 0x03, 0x00, 0x65, 0x6F, 0x75, 0x06, 0x49, 0x00, 0x10, 0x49, 0x00, 0xF4, 0x48, 0x00,
+    0x01, 0x00, 0x65, 0x30, 0x3F, 0x00, 0x01, 0x00, 0x65, 0x16, 0x49, 0x00, 0x01, 0x00, 0x64, 0x1C,
+    0x49, 0x00, 0x01, 0x00, 0x69, 0x26, 0x49, 0x00, 0x01, 0x00, 0x74, 0x30, 0x3F, 0x00, 0x01, 0x00,
+    0x73, 0xF0, 0x3D, 0x00, 0x01, 0x00, 0x70, 0x30, 0x36, 0x00, 0x01, 0x00, 0xBA, 0x24, 0x3F, 0x00,
+    0x01, 0x00, 0x72, 0x30, 0x36, 0x00, 0x02, 0x02, 0xE1, 0x00, 0x63, 0x64, 0x36, 0x30, 0x00, 0x36,
+    0x30, 0x00, 0x03, 0x00, 0xA1, 0xA9, 0xB3, 0xF0, 0x3D, 0x00, 0xF0, 0x3D, 0x00, 0xF0, 0x3D, 0x00,
+    0x01, 0x00, 0x65, 0x36, 0x30, 0x00, 0x01, 0x00, 0x69, 0x82, 0x48, 0x00, 0x01, 0x00, 0x65, 0x30,
+    0x36, 0x00, 0x01, 0x00, 0x6A, 0x30, 0x36, 0x00, 0x01, 0x00, 0x61, 0x2C, 0x49, 0x00, 0x02, 0x00,
+    0x65, 0x6C, 0xBE, 0x48, 0x00, 0xA0, 0x48, 0x00, 0x01, 0x00, 0x61, 0x82, 0x48, 0x00, 0x01, 0x00,
+    0x69, 0x32, 0x49, 0x00, 0x01, 0x00, 0x67, 0xB0, 0x28, 0x00, 0x02, 0x00, 0xA1, 0xA9, 0x30, 0x36,
+    0x00, 0x30, 0x36, 0x00, 0x01, 0x00, 0xA9, 0x30, 0x36, 0x00, 0x02, 0x00, 0x63, 0x71, 0x38, 0x49,
+    0x00, 0x38, 0x49, 0x00, 0x03, 0x00, 0x6E, 0x72, 0x73, 0xF0, 0x3D, 0x00, 0xF0, 0x3D, 0x00, 0xF0,
+    0x3D, 0x00, 0x01, 0x00, 0x6C, 0x36, 0x30, 0x00, 0x02, 0x00, 0x6E, 0x73, 0x30, 0x36, 0x00, 0x30,
+    0x36, 0x00, 0x05, 0x00, 0x64, 0x65, 0x6D, 0x72, 0xC3, 0x30, 0x36, 0x00, 0x3C, 0x49, 0x00, 0x30,
+    0x36, 0x00, 0x30, 0x36, 0x00, 0x4A, 0x49, 0x00, 0x02, 0x00, 0xA1, 0xAD, 0x30, 0x36, 0x00, 0x54,
+    0x49, 0x00, 0x01, 0x00, 0x61, 0x5C, 0x49, 0x00, 0x02, 0x00, 0x61, 0xC3, 0x30, 0x36, 0x00, 0x62,
+    0x49, 0x00, 0x01, 0x00, 0x61, 0xB8, 0x37, 0x00, 0x01, 0x00, 0x68, 0x68, 0x49, 0x00, 0x01, 0x00,
+    0x74, 0xB0, 0x28, 0x00, 0x01, 0x00, 0x61, 0x72, 0x49, 0x00, 0x01, 0x00, 0x64, 0x5C, 0x3F, 0x00,
+    0x00, 0x02, 0xDC, 0x00, 0x01, 0x00, 0x2E, 0x36, 0x30, 0x00, 0x01, 0x00, 0x74, 0x76, 0x49, 0x00,
+    0x01, 0x00, 0x72, 0x7C, 0x49, 0x00, 0x00, 0x02, 0x38, 0x00, 0x00, 0x01, 0x52, 0x00, 0x00, 0x03,
+    0x43, 0x00, 0x01, 0x00, 0x2E, 0x2E, 0x40, 0x00, 0x03, 0x00, 0x2E, 0x6D, 0x73, 0x82, 0x49, 0x00,
+    0x86, 0x49, 0x00, 0x8C, 0x49, 0x00, 0x03, 0x00, 0x2E, 0x61, 0x65, 0x2E, 0x40, 0x00, 0xDC, 0x31,
+    0x00, 0xF4, 0x31, 0x00, 0x03, 0x00, 0x2E, 0x6E, 0x73, 0x2E, 0x40, 0x00, 0x32, 0x40, 0x00, 0x32,
+    0x40, 0x00, 0x03, 0x00, 0x2E, 0x69, 0x73, 0x2E, 0x40, 0x00, 0xF4, 0x31, 0x00, 0x32, 0x40, 0x00,
+    0x02, 0x00, 0x61, 0x73, 0x92, 0x49, 0x00, 0x32, 0x40, 0x00, 0x03, 0x00, 0x2E, 0x69, 0x73, 0xD8,
+    0x31, 0x00, 0x2A, 0x32, 0x00, 0x56, 0x24, 0x00, 0x01, 0x00, 0x2E, 0xA8, 0x49, 0x00, 0x01, 0x00,
+    0x64, 0xAC, 0x49, 0x00, 0x01, 0x00, 0x65, 0xB2, 0x49, 0x00, 0x01, 0x00, 0x6D, 0xB8, 0x49, 0x00,
+    0x01, 0x00, 0x74, 0xAC, 0x40, 0x00, 0x01, 0x00, 0xB3, 0xCC, 0x26, 0x00, 0x01, 0x00, 0x69, 0xCC,
+    0x26, 0x00, 0x00, 0x01, 0x3A, 0x00, 0x03, 0x00, 0x61, 0x65, 0x6F, 0xF8, 0x2E, 0x00, 0xF8, 0x2E,
+    0x00, 0xF8, 0x2E, 0x00, 0x01, 0x00, 0x61, 0xBE, 0x49, 0x00, 0x01, 0x00, 0x73, 0xA0, 0x1C, 0x00,
+    0x01, 0x00, 0x61, 0xB2, 0x25, 0x00, 0x01, 0x00, 0x74, 0xC4, 0x49, 0x00, 0x01, 0x00, 0x61, 0xCA,
+    0x49, 0x00, 0x01, 0x03, 0x9C, 0x00, 0x63, 0xD4, 0x49, 0x00, 0x02, 0x03, 0x9C, 0x00, 0x6E, 0x78,
+    0xDA, 0x49, 0x00, 0xE4, 0x49, 0x00, 0x05, 0x00, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xBC, 0x47, 0x00,
+    0xBC, 0x47, 0x00, 0xBC, 0x47, 0x00, 0xEA, 0x49, 0x00, 0xBC, 0x47, 0x00, 0x00, 0x01, 0x10, 0x00,
+    0x03, 0x00, 0x6E, 0x6F, 0x73, 0xF2, 0x49, 0x00, 0xF8, 0x49, 0x00, 0xFE, 0x49, 0x00, 0x01, 0x00,
+    0x72, 0x10, 0x4A, 0x00, 0x01, 0x00, 0x65, 0x14, 0x4A, 0x00, 0x01, 0x00, 0x6E, 0x30, 0x41, 0x00,
+    0x01, 0x00, 0x74, 0xEC, 0x33, 0x00, 0x01, 0x00, 0x70, 0x1A, 0x4A, 0x00, 0x01, 0x00, 0x73, 0x20,
+    0x4A, 0x00, 0x03, 0x00, 0x6D, 0x6E, 0x6F, 0x26, 0x4A, 0x00, 0x2C, 0x4A, 0x00, 0x36, 0x4A, 0x00,
+    0x01, 0x00, 0x65, 0x3C, 0x4A, 0x00, 0x01, 0x00, 0xA9, 0x42, 0x4A, 0x00, 0x01, 0x01, 0x26, 0x00,
+    0x61, 0xF8, 0x2E, 0x00, 0x01, 0x00, 0x69, 0x0C, 0x41, 0x00, 0x01, 0x00, 0x61, 0x48, 0x4A, 0x00,
+    0x00, 0x01, 0x16, 0x00, 0x01, 0x00, 0x75, 0x4C, 0x4A, 0x00, 0x00, 0x05, 0xD0, 0x00, 0x00, 0x02,
+    0x41, 0x00, 0x01, 0x00, 0x73, 0x88, 0x41, 0x00, 0x01, 0x00, 0x2E, 0x7E, 0x41, 0x00, 0x01, 0x00,
+    0x61, 0xB6, 0x16, 0x00, 0x01, 0x00, 0x63, 0x52, 0x4A, 0x00, 0x01, 0x00, 0xC3, 0x5C, 0x4A, 0x00,
+    0x01, 0x00, 0x74, 0x62, 0x4A, 0x00, 0x01, 0x00, 0x6E, 0x68, 0x4A, 0x00, 0x02, 0x00, 0x2E, 0x65,
+    0x6C, 0x4A, 0x00, 0x70, 0x4A, 0x00, 0x01, 0x00, 0x61, 0x76, 0x4A, 0x00, 0x01, 0x02, 0x3C, 0x00,
+    0x73, 0x7C, 0x4A, 0x00, 0x01, 0x00, 0x65, 0x82, 0x4A, 0x00, 0x01, 0x00, 0x61, 0xEA, 0x47, 0x00,
+    0x01, 0x00, 0x64, 0x86, 0x4A, 0x00, 0x00, 0x02, 0xC2, 0x00, 0x02, 0x00, 0x64, 0x74, 0x6E, 0x34,
+    0x00, 0x8C, 0x4A, 0x00, 0x02, 0x00, 0x63, 0x71, 0x92, 0x4A, 0x00, 0xA6, 0x3D, 0x00, 0x01, 0x00,
+    0x69, 0x98, 0x4A, 0x00, 0x00, 0x02, 0x6D, 0x00, 0x01, 0x02, 0x3C, 0x00, 0x72, 0x9E, 0x4A, 0x00,
+    0x01, 0x02, 0x3C, 0x00, 0x73, 0xA4, 0x4A, 0x00, 0x01, 0x02, 0x06, 0x00, 0x72, 0xAA, 0x4A, 0x00,
+    0x01, 0x00, 0x63, 0xB0, 0x4A, 0x00, 0x01, 0x00, 0x72, 0xD0, 0x26, 0x00, 0x01, 0x00, 0x72, 0xB6,
+    0x4A, 0x00, 0x01, 0x00, 0x2E, 0xCC, 0x26, 0x00, 0x01, 0x00, 0x69, 0xBA, 0x4A, 0x00, 0x01, 0x00,
+    0x63, 0xC8, 0x4A, 0x00, 0x00, 0x03, 0xA9, 0x00, 0x00, 0x02, 0xAC, 0x00, 0x05, 0x00, 0xA1, 0xA9,
+    0xAD, 0xB3, 0xBA, 0xCE, 0x4A, 0x00, 0xCE, 0x4A, 0x00, 0xCE, 0x4A, 0x00, 0xCE, 0x4A, 0x00, 0xCE,
+    0x4A, 0x00, 0x01, 0x02, 0x06, 0x00, 0x73, 0xD2, 0x4A, 0x00, 0x01, 0x00, 0x2E, 0xD8, 0x4A, 0x00,
+    0x02, 0x00, 0x2E, 0x73, 0xD8, 0x4A, 0x00, 0x5A, 0x42, 0x00, 0x01, 0x00, 0x6E, 0xDC, 0x4A, 0x00,
+    0x01, 0x00, 0xB3, 0xE2, 0x4A, 0x00, 0x01, 0x00, 0x72, 0xE8, 0x4A, 0x00, 0x01, 0x03, 0x9C, 0x00,
+    0x72, 0xEE, 0x4A, 0x00, 0x01, 0x03, 0x9C, 0x00, 0x6F, 0xF2, 0x4A, 0x00, 0x05, 0x00, 0xA1, 0xA9,
+    0xAD, 0xB3, 0xBA, 0xF8, 0x4A, 0x00, 0xBC, 0x47, 0x00, 0xBC, 0x47, 0x00, 0xBC, 0x47, 0x00, 0xBC,
+    0x47, 0x00, 0x04, 0x02, 0x86, 0x00, 0x63, 0x6D, 0x6E, 0x74, 0x04, 0x4B, 0x00, 0x0E, 0x4B, 0x00,
+    0x14, 0x4B, 0x00, 0x1A, 0x4B, 0x00, 0x02, 0x02, 0x86, 0x00, 0x78, 0xC3, 0x20, 0x4B, 0x00, 0x26,
+    0x4B, 0x00, 0x08, 0x02, 0x86, 0x00, 0x62, 0x63, 0x64, 0x67, 0x6A, 0x6C, 0x73, 0x74, 0x2C, 0x4B,
+    0x00, 0x32, 0x4B, 0x00, 0x38, 0x4B, 0x00, 0x42, 0x4B, 0x00, 0x50, 0x4B, 0x00, 0x5E, 0x4B, 0x00,
+    0x64, 0x4B, 0x00, 0x6A, 0x4B, 0x00, 0x02, 0x02, 0x86, 0x00, 0x63, 0x72, 0x80, 0x4B, 0x00, 0x86,
+    0x4B, 0x00, 0x03, 0x02, 0x86, 0x00, 0x62, 0x72, 0x73, 0x18, 0x38, 0x00, 0xF8, 0x39, 0x00, 0x06,
+    0x44, 0x00, 0x01, 0x00, 0x75, 0x8C, 0x4B, 0x00, 0x03, 0x00, 0x63, 0x70, 0x74, 0x92, 0x4B, 0x00,
+    0x1C, 0x2C, 0x00, 0x98, 0x4B, 0x00, 0x02, 0x00, 0x64, 0x74, 0x9E, 0x4B, 0x00, 0xA4, 0x4B, 0x00,
+    0x01, 0x00, 0x6C, 0xAA, 0x4B, 0x00, 0x02, 0x00, 0x61, 0x6F, 0xB0, 0x4B, 0x00, 0xB0, 0x4B, 0x00,
+    0x01, 0x00, 0x65, 0xBA, 0x4B, 0x00, 0x01, 0x00, 0x63, 0x0C, 0x41, 0x00, 0x01, 0x00, 0x73, 0xC0,
+    0x4B, 0x00, 0x03, 0x00, 0x61, 0x65, 0x6F, 0xC6, 0x4B, 0x00, 0xC6, 0x1A, 0x00, 0xC6, 0x1A, 0x00,
+    0x01, 0x00, 0x65, 0xD0, 0x4B, 0x00, 0x01, 0x00, 0x65, 0xDA, 0x4B, 0x00, 0x03, 0x00, 0x61, 0x65,
+    0x6F, 0xEC, 0x4B, 0x00, 0xF6, 0x4B, 0x00, 0xF6, 0x4B, 0x00, 0x03, 0x00, 0x61, 0x65, 0x6F, 0xEC,
+    0x4B, 0x00, 0xEC, 0x4B, 0x00, 0xEC, 0x4B, 0x00, 0x03, 0x00, 0x61, 0x65, 0x6F, 0x02, 0x29, 0x00,
+    0x02, 0x29, 0x00, 0x02, 0x29, 0x00, 0x01, 0x00, 0x2E, 0x00, 0x4C, 0x00, 0x00, 0x03, 0x73, 0x00,
+    0x01, 0x00, 0x2E, 0x8C, 0x43, 0x00, 0x02, 0x00, 0x61, 0x6F, 0xC6, 0x1A, 0x00, 0xC6, 0x1A, 0x00,
+    0x00, 0x02, 0x04, 0x00, 0x01, 0x00, 0x68, 0x5C, 0x2D, 0x00, 0x01, 0x00, 0x72, 0x5C, 0x2D, 0x00,
+    0x01, 0x00, 0x65, 0x04, 0x4C, 0x00, 0x01, 0x00, 0x65, 0x08, 0x4C, 0x00, 0x01, 0x00, 0x6C, 0x78,
+    0x22, 0x00, 0x01, 0x00, 0x64, 0xF4, 0x41, 0x00, 0x01, 0x00, 0x61, 0x0E, 0x4C, 0x00, 0x01, 0x00,
+    0x65, 0x0E, 0x4C, 0x00, 0x01, 0x00, 0x69, 0xCE, 0x43, 0x00, 0x01, 0x00, 0x65, 0xCC, 0x26, 0x00,
+    0x01, 0x00, 0x6E, 0x1A, 0x44, 0x00, 0x01, 0x00, 0x6E, 0xE6, 0x37, 0x00, 0x01, 0x00, 0x6E, 0xB8,
+    0x37, 0x00, 0x01, 0x00, 0xAD, 0xEC, 0x43, 0x00, 0x01, 0x00, 0x65, 0x12, 0x4C, 0x00, 0x01, 0x01,
+    0x26, 0x01, 0x63, 0x18, 0x4C, 0x00, 0x01, 0x00, 0x74, 0xF8, 0x2E, 0x00, 0x03, 0x00, 0x61, 0x65,
+    0xC3, 0xF8, 0x2E, 0x00, 0xF8, 0x2E, 0x00, 0x9C, 0x37, 0x00, 0x01, 0x00, 0x64, 0xCC, 0x26, 0x00,
+    0x01, 0x00, 0x69, 0x1E, 0x4C, 0x00, 0x01, 0x00, 0x69, 0x32, 0x44, 0x00, 0x01, 0x00, 0x61, 0x9C,
+    0x2A, 0x00, 0x01, 0x00, 0x7A, 0xCC, 0x26, 0x00, 0x03, 0x00, 0x63, 0x68, 0x6E, 0xAC, 0x40, 0x00,
+    0x82, 0x38, 0x00, 0xC4, 0x32, 0x00, 0x01, 0x00, 0xB3, 0x94, 0x32, 0x00, 0x01, 0x01, 0x27, 0x00,
+    0x69, 0xCC, 0x26, 0x00, 0x01, 0x00, 0xAD, 0x24, 0x4C, 0x00, 0x01, 0x00, 0x6C, 0x2C, 0x44, 0x00,
+    0x02, 0x00, 0x63, 0x74, 0xF8, 0x2E, 0x00, 0xF8, 0x2E, 0x00, 0x04, 0x00, 0x61, 0x65, 0x74, 0xC3,
+    0xF8, 0x2E, 0x00, 0xF8, 0x2E, 0x00, 0xCC, 0x26, 0x00, 0x9C, 0x37, 0x00, 0x01, 0x00, 0x73, 0xF8,
+    0x2E, 0x00, 0x00, 0x03, 0xED, 0x00, 0x01, 0x03, 0xED, 0x00, 0x73, 0x2A, 0x4C, 0x00, 0x00, 0x02,
+    0xF3, 0x00, 0x02, 0x02, 0xF5, 0x00, 0x6F, 0x75, 0x3C, 0x4C, 0x00, 0x42, 0x4C, 0x00, 0x05, 0x00,
+    0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0x4C, 0x4C, 0x00, 0x4C, 0x4C, 0x00, 0x4C, 0x4C, 0x00, 0x4C, 0x4C,
+    0x00, 0x4C, 0x4C, 0x00, 0x01, 0x00, 0x69, 0x50, 0x4C, 0x00, 0x01, 0x00, 0x6D, 0x46, 0x38, 0x00,
+    0x01, 0x00, 0x74, 0x46, 0x38, 0x00, 0x02, 0x00, 0x6E, 0x73, 0x1C, 0x2C, 0x00, 0x1C, 0x2C, 0x00,
+    0x01, 0x00, 0x61, 0x56, 0x4C, 0x00, 0x00, 0x03, 0x23, 0x01, 0x01, 0x00, 0x69, 0x5C, 0x4C, 0x00,
+    0x01, 0x00, 0x62, 0x5C, 0x4C, 0x00, 0x01, 0x00, 0xA1, 0xE0, 0x44, 0x00, 0x01, 0x00, 0x6F, 0x60,
+    0x4C, 0x00, 0x00, 0x02, 0x1B, 0x01, 0x01, 0x00, 0x70, 0x7C, 0x35, 0x00, 0x02, 0x00, 0x61, 0xC3,
+    0x66, 0x4C, 0x00, 0x6C, 0x4C, 0x00, 0x01, 0x00, 0x61, 0x72, 0x4C, 0x00, 0x01, 0x00, 0x74, 0x78,
+    0x4C, 0x00, 0x01, 0x00, 0x65, 0x66, 0x47, 0x00, 0x01, 0x00, 0x65, 0x7E, 0x4C, 0x00, 0x03, 0x00,
+    0x61, 0x65, 0x69, 0x88, 0x4C, 0x00, 0x66, 0x47, 0x00, 0x66, 0x47, 0x00, 0x03, 0x00, 0x67, 0x69,
+    0xC3, 0xF8, 0x2E, 0x00, 0x66, 0x47, 0x00, 0x90, 0x4C, 0x00, 0x01, 0x00, 0x61, 0x66, 0x47, 0x00,
+    0x01, 0x00, 0x65, 0x96, 0x4C, 0x00, 0x01, 0x00, 0x6F, 0x66, 0x47, 0x00, 0x05, 0x00, 0x61, 0x65,
+    0x6C, 0x6F, 0xC3, 0x66, 0x47, 0x00, 0x66, 0x47, 0x00, 0x9C, 0x4C, 0x00, 0x66, 0x47, 0x00, 0xA4,
+    0x4C, 0x00, 0x01, 0x00, 0x70, 0xB2, 0x4C, 0x00, 0x03, 0x01, 0x26, 0x00, 0x64, 0x65, 0x75, 0xF4,
+    0x41, 0x00, 0x66, 0x47, 0x00, 0xB8, 0x4C, 0x00, 0x02, 0x00, 0x6D, 0x74, 0xF8, 0x2E, 0x00, 0x42,
+    0x47, 0x00, 0x02, 0x00, 0x61, 0x6F, 0x66, 0x47, 0x00, 0x66, 0x47, 0x00, 0x01, 0x00, 0x65, 0x28,
+    0x3D, 0x00, 0x01, 0x00, 0x76, 0x28, 0x3D, 0x00, 0x01, 0x00, 0x6D, 0x28, 0x3D, 0x00, 0x04, 0x00,
+    0x61, 0x65, 0x6F, 0xC3, 0x66, 0x47, 0x00, 0x66, 0x47, 0x00, 0x66, 0x47, 0x00, 0xA4, 0x4C, 0x00,
+    0x02, 0x00, 0x61, 0x65, 0x66, 0x47, 0x00, 0x46, 0x45, 0x00, 0x00, 0x03, 0x13, 0x01, 0x01, 0x03,
+    0x13, 0x01, 0x6E, 0xF8, 0x2E, 0x00, 0x01, 0x03, 0x13, 0x01, 0x6E, 0xBE, 0x4C, 0x00, 0x01, 0x00,
+    0x70, 0xF4, 0x41, 0x00, 0x01, 0x00, 0xBA, 0xCE, 0x45, 0x00, 0x02, 0x00, 0x69, 0xC3, 0xC6, 0x4C,
+    0x00, 0xCC, 0x4C, 0x00, 0x01, 0x00, 0x62, 0xD2, 0x4C, 0x00, 0x01, 0x00, 0x72, 0x06, 0x44, 0x00,
+    0x04, 0x00, 0x61, 0x65, 0x69, 0xC3, 0xA6, 0x3D, 0x00, 0xA6, 0x3D, 0x00, 0xA6, 0x3D, 0x00, 0xD8,
+    0x4C, 0x00, 0x01, 0x00, 0x62, 0xE2, 0x4C, 0x00, 0x01, 0x00, 0x64, 0xEE, 0x4C, 0x00, 0x01, 0x00,
+    0xB1, 0xCC, 0x26, 0x00, 0x02, 0x00, 0x73, 0x74, 0xCC, 0x26, 0x00, 0xCC, 0x26, 0x00, 0x01, 0x00,
+    0xAD, 0x00, 0x39, 0x00, 0x01, 0x00, 0x76, 0xCC, 0x26, 0x00, 0x01, 0x00, 0x70, 0x5C, 0x2D, 0x00,
+    0x01, 0x00, 0xA1, 0x24, 0x46, 0x00, 0x02, 0x00, 0x6D, 0x74, 0xF8, 0x2E, 0x00, 0xF8, 0x2E, 0x00,
+    0x02, 0x00, 0x61, 0xC3, 0xF8, 0x2E, 0x00, 0x9C, 0x37, 0x00, 0x01, 0x00, 0x7A, 0x42, 0x47, 0x00,
+    0x01, 0x00, 0x65, 0x90, 0x37, 0x00, 0x02, 0x00, 0x6E, 0x74, 0x1A, 0x44, 0x00, 0xCC, 0x26, 0x00,
+    0x02, 0x00, 0xA9, 0xAD, 0xE0, 0x43, 0x00, 0xF4, 0x4C, 0x00, 0x01, 0x00, 0x64, 0xF8, 0x2E, 0x00,
+    0x03, 0x00, 0x61, 0x6F, 0xC3, 0xCC, 0x26, 0x00, 0xCC, 0x26, 0x00, 0xFA, 0x4C, 0x00, 0x02, 0x00,
+    0x63, 0x71, 0x06, 0x39, 0x00, 0xCC, 0x26, 0x00, 0x00, 0x00, 0x02, 0x00, 0xA9, 0xB3, 0xF8, 0x2E,
+    0x00, 0xF8, 0x2E, 0x00, 0x02, 0x00, 0x69, 0xC3, 0x32, 0x44, 0x00, 0x04, 0x4D, 0x00, 0x01, 0x00,
+    0x72, 0x0A, 0x4D, 0x00, 0x02, 0x00, 0x70, 0x74, 0x6E, 0x37, 0x00, 0xF8, 0x2E, 0x00, 0x01, 0x00,
+    0xC3, 0x10, 0x4D, 0x00, 0x01, 0x00, 0x75, 0x1C, 0x33, 0x00, 0x01, 0x00, 0x61, 0x16, 0x33, 0x00,
+    0x01, 0x00, 0x6D, 0x16, 0x4D, 0x00, 0x04, 0x00, 0x61, 0x65, 0x6F, 0xC3, 0xCC, 0x26, 0x00, 0xCC,
+    0x26, 0x00, 0xCC, 0x26, 0x00, 0xAC, 0x32, 0x00, 0x01, 0x00, 0xB3, 0x1C, 0x4D, 0x00, 0x01, 0x00,
+    0x63, 0x22, 0x4D, 0x00, 0x01, 0x00, 0x6D, 0x10, 0x33, 0x00, 0x01, 0x00, 0x6C, 0x1C, 0x33, 0x00,
+    0x01, 0x00, 0x65, 0x6E, 0x37, 0x00, 0x04, 0x00, 0x61, 0x69, 0x72, 0xC3, 0x6E, 0x37, 0x00, 0x28,
+    0x4D, 0x00, 0x2E, 0x4D, 0x00, 0x34, 0x4D, 0x00, 0x00, 0x02, 0x8D, 0x00, 0x01, 0x02, 0x8D, 0x00,
+    0x72, 0x08, 0x47, 0x00, 0x01, 0x00, 0xB3, 0x3A, 0x4D, 0x00, 0x01, 0x00, 0x65, 0x3A, 0x4D, 0x00,
+    0x01, 0x00, 0x70, 0xF8, 0x2E, 0x00, 0x01, 0x00, 0x65, 0x40, 0x4D, 0x00, 0x01, 0x00, 0x69, 0x46,
+    0x4D, 0x00, 0x01, 0x00, 0x63, 0x16, 0x33, 0x00, 0x02, 0x00, 0x69, 0xC3, 0x94, 0x32, 0x00, 0x4C,
+    0x4D, 0x00, 0x01, 0x00, 0x61, 0xF8, 0x2E, 0x00, 0x01, 0x00, 0x74, 0x52, 0x4D, 0x00, 0x01, 0x00,
+    0x74, 0x58, 0x4D, 0x00, 0x01, 0x00, 0x70, 0xF4, 0x36, 0x00, 0x01, 0x00, 0x6A, 0xF4, 0x36, 0x00,
+    0x01, 0x00, 0xC3, 0x62, 0x4D, 0x00, 0x00, 0x02, 0x8B, 0x00, 0x01, 0x00, 0x67, 0xF8, 0x2E, 0x00,
+    0x01, 0x00, 0xB1, 0x66, 0x47, 0x00, 0x01, 0x00, 0x74, 0x68, 0x4D, 0x00, 0x00, 0x02, 0x84, 0x00,
+    0x01, 0x00, 0x61, 0x7A, 0x4D, 0x00, 0x01, 0x00, 0x6E, 0x26, 0x40, 0x00, 0x00, 0x02, 0x22, 0x00,
+    0x00, 0x01, 0x24, 0x00, 0x05, 0x00, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0x80, 0x4D, 0x00, 0x80, 0x4D,
+    0x00, 0x80, 0x4D, 0x00, 0x80, 0x4D, 0x00, 0x80, 0x4D, 0x00, 0x00, 0x02, 0x38, 0x01, 0x01, 0x00,
+    0xAD, 0x84, 0x4D, 0x00, 0x01, 0x02, 0x04, 0x00, 0x72, 0x8A, 0x4D, 0x00, 0x00, 0x03, 0x93, 0x00,
+    0x01, 0x00, 0x63, 0x90, 0x4D, 0x00, 0x01, 0x00, 0x65, 0x96, 0x4D, 0x00, 0x07, 0x00, 0x61, 0x65,
+    0x68, 0x69, 0x6F, 0x75, 0xC3, 0x9C, 0x4D, 0x00, 0x9C, 0x4D, 0x00, 0xA0, 0x4D, 0x00, 0x9C, 0x4D,
+    0x00, 0x9C, 0x4D, 0x00, 0x9C, 0x4D, 0x00, 0xA4, 0x4D, 0x00, 0x00, 0x03, 0xC9, 0x00, 0x01, 0x00,
+    0x64, 0xEA, 0x47, 0x00, 0x01, 0x00, 0x6C, 0xBA, 0x4D, 0x00, 0x03, 0x00, 0xA1, 0xA9, 0xB3, 0xEA,
+    0x47, 0x00, 0xEA, 0x47, 0x00, 0xEA, 0x47, 0x00, 0x03, 0x00, 0x61, 0x65, 0x6F, 0xEA, 0x47, 0x00,
+    0xEA, 0x47, 0x00, 0xEA, 0x47, 0x00, 0x00, 0x02, 0xE3, 0x00, 0x01, 0x00, 0x73, 0xEA, 0x47, 0x00,
+    0x02, 0x00, 0x69, 0xC3, 0xC0, 0x4D, 0x00, 0xCA, 0x4D, 0x00, 0x01, 0x00, 0x6C, 0xB0, 0x28, 0x00,
+    0x01, 0x00, 0x6E, 0xD0, 0x4D, 0x00, 0x01, 0x00, 0x6C, 0xD6, 0x4D, 0x00, 0x04, 0x00, 0x61, 0x65,
+    0x6F, 0xC3, 0xEA, 0x47, 0x00, 0xEA, 0x47, 0x00, 0xEA, 0x47, 0x00, 0xFA, 0x47, 0x00, 0x01, 0x00,
+    0xC3, 0xDC, 0x4D, 0x00, 0x01, 0x00, 0xA9, 0x4E, 0x48, 0x00, 0x01, 0x00, 0x6A, 0x08, 0x48, 0x00,
+    0x02, 0x00, 0x65, 0xC3, 0x5C, 0x49, 0x00, 0xE2, 0x4D, 0x00, 0x01, 0x00, 0xA9, 0xEA, 0x47, 0x00,
+    0x01, 0x00, 0x6D, 0xE8, 0x4D, 0x00, 0x01, 0x00, 0x72, 0xEE, 0x4D, 0x00, 0x01, 0x00, 0x6E, 0x30,
+    0x36, 0x00, 0x01, 0x00, 0x6D, 0x30, 0x36, 0x00, 0x03, 0x00, 0x62, 0x63, 0x6C, 0xF4, 0x4D, 0x00,
+    0x20, 0x31, 0x00, 0xB2, 0x48, 0x00, 0x02, 0x00, 0x65, 0x75, 0xFA, 0x4D, 0x00, 0x00, 0x4E, 0x00,
+    0x01, 0x00, 0x6C, 0x30, 0x36, 0x00, 0x01, 0x00, 0xA1, 0xA0, 0x48, 0x00, 0x01, 0x00, 0x69, 0x06,
+    0x4E, 0x00, 0x01, 0x00, 0x69, 0x7C, 0x48, 0x00, 0x01, 0x00, 0x65, 0xFA, 0x4D, 0x00, 0x01, 0x00,
+    0x6E, 0x10, 0x4E, 0x00, 0x01, 0x00, 0x72, 0x24, 0x3F, 0x00, 0x01, 0x00, 0x75, 0x16, 0x4E, 0x00,
+    0x02, 0x00, 0x63, 0x74, 0xF0, 0x3D, 0x00, 0xF0, 0x3D, 0x00, 0x01, 0x00, 0x72, 0x10, 0x4E, 0x00,
+    0x01, 0x00, 0x63, 0x36, 0x30, 0x00, 0x01, 0x02, 0x80, 0x00, 0x61, 0x82, 0x48, 0x00, 0x01, 0x00,
+    0x72, 0x82, 0x48, 0x00, 0x01, 0x00, 0x62, 0x30, 0x36, 0x00, 0x01, 0x00, 0x63, 0x10, 0x4E, 0x00,
+    0x01, 0x00, 0x61, 0xA0, 0x48, 0x00, 0x02, 0x00, 0x67, 0x72, 0xAA, 0x3D, 0x00, 0xB0, 0x28, 0x00,
+    0x01, 0x00, 0x78, 0x30, 0x36, 0x00, 0x01, 0x00, 0x6E, 0x36, 0x30, 0x00, 0x02, 0x00, 0x65, 0x69,
+    0x1C, 0x4E, 0x00, 0x26, 0x4E, 0x00, 0x01, 0x00, 0x67, 0x30, 0x36, 0x00, 0x01, 0x00, 0x6E, 0x20,
+    0x31, 0x00, 0x01, 0x00, 0x6A, 0x36, 0x30, 0x00, 0x00, 0x03, 0xDE, 0x00, 0x03, 0x00, 0x6E, 0x72,
+    0x73, 0x30, 0x36, 0x00, 0x54, 0x49, 0x00, 0x30, 0x36, 0x00, 0x02, 0x00, 0xA9, 0xB3, 0x2C, 0x4E,
+    0x00, 0x30, 0x36, 0x00, 0x01, 0x02, 0x80, 0x00, 0x61, 0x30, 0x36, 0x00, 0x01, 0x00, 0x6E, 0xB0,
+    0x28, 0x00, 0x01, 0x00, 0xA1, 0x30, 0x36, 0x00, 0x02, 0x00, 0x61, 0x65, 0x72, 0x49, 0x00, 0x72,
+    0x49, 0x00, 0x00, 0x02, 0xB5, 0x00, 0x01, 0x00, 0x6F, 0x7E, 0x41, 0x00, 0x01, 0x00, 0x69, 0x3A,
+    0x4E, 0x00, 0x00, 0x04, 0x48, 0x00, 0x01, 0x00, 0x65, 0x40, 0x4E, 0x00, 0x01, 0x00, 0x2E, 0x82,
+    0x49, 0x00, 0x05, 0x00, 0x2E, 0x69, 0x6D, 0x6E, 0x73, 0x2E, 0x40, 0x00, 0x46, 0x4E, 0x00, 0x50,
+    0x24, 0x00, 0x32, 0x40, 0x00, 0x32, 0x40, 0x00, 0x00, 0x03, 0x4C, 0x00, 0x01, 0x00, 0x61, 0x4C,
+    0x4E, 0x00, 0x01, 0x00, 0x6E, 0x52, 0x4E, 0x00, 0x01, 0x00, 0x6F, 0x58, 0x4E, 0x00, 0x01, 0x00,
+    0x72, 0x5E, 0x4E, 0x00, 0x01, 0x00, 0x65, 0x90, 0x1C, 0x00, 0x02, 0x00, 0x2E, 0x73, 0x46, 0x38,
+    0x00, 0x64, 0x4E, 0x00, 0x01, 0x00, 0xC3, 0x6A, 0x4E, 0x00, 0x02, 0x00, 0x69, 0xC3, 0x70, 0x4E,
+    0x00, 0x76, 0x4E, 0x00, 0x01, 0x00, 0x69, 0x7C, 0x4E, 0x00, 0x01, 0x03, 0x93, 0x00, 0x6E, 0x82,
+    0x4E, 0x00, 0x01, 0x00, 0x6F, 0xF8, 0x49, 0x00, 0x01, 0x00, 0x73, 0x88, 0x4E, 0x00, 0x04, 0x00,
+    0x65, 0x6C, 0x6D, 0x74, 0x92, 0x4E, 0x00, 0x98, 0x4E, 0x00, 0xA6, 0x4E, 0x00, 0xA6, 0x4E, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x72, 0x0C, 0x41, 0x00, 0x01, 0x00, 0x69, 0x30, 0x41, 0x00,
+    0x01, 0x00, 0x61, 0xAC, 0x4E, 0x00, 0x01, 0x00, 0x2E, 0xB2, 0x4E, 0x00, 0x02, 0x00, 0x64, 0x73,
+    0xB6, 0x4E, 0x00, 0xBA, 0x4E, 0x00, 0x01, 0x00, 0x72, 0xC4, 0x4E, 0x00, 0x01, 0x00, 0x67, 0xC8,
+    0x4E, 0x00, 0x01, 0x00, 0x73, 0x70, 0x41, 0x00, 0x00, 0x02, 0xD6, 0x00, 0x01, 0x00, 0x72, 0xD6,
+    0x41, 0x00, 0x02, 0x00, 0x61, 0x6F, 0xCE, 0x4E, 0x00, 0xB6, 0x16, 0x00, 0x01, 0x00, 0xAD, 0xDC,
+    0x4E, 0x00, 0x01, 0x00, 0x65, 0x2E, 0x26, 0x00, 0x00, 0x02, 0xBF, 0x00, 0x00, 0x01, 0xC4, 0x00,
+    0x01, 0x00, 0xC3, 0xE2, 0x4E, 0x00, 0x01, 0x00, 0x74, 0x92, 0x4A, 0x00, 0x01, 0x00, 0x6F, 0xA6,
+    0x3D, 0x00, 0x00, 0x02, 0xC7, 0x00, 0x01, 0x00, 0x72, 0xE8, 0x4E, 0x00, 0x01, 0x00, 0x65, 0x92,
+    0x4A, 0x00, 0x01, 0x00, 0x61, 0xA6, 0x3D, 0x00, 0x01, 0x00, 0x65, 0xD6, 0x41, 0x00, 0x01, 0x00,
+    0x71, 0xA6, 0x3D, 0x00, 0x01, 0x00, 0x74, 0xEC, 0x4E, 0x00, 0x01, 0x00, 0x6F, 0x68, 0x4A, 0x00,
+    0x01, 0x00, 0x74, 0xF2, 0x4E, 0x00, 0x00, 0x03, 0xBC, 0x00, 0x03, 0x00, 0x61, 0x65, 0xC3, 0x72,
+    0x49, 0x00, 0x72, 0x49, 0x00, 0xF6, 0x4E, 0x00, 0x01, 0x00, 0x69, 0xFC, 0x4E, 0x00, 0x00, 0x03,
+    0xA6, 0x00, 0x01, 0x00, 0x61, 0x02, 0x4F, 0x00, 0x00, 0x02, 0xB1, 0x00, 0x01, 0x00, 0x65, 0xCE,
+    0x35, 0x00, 0x01, 0x00, 0x6E, 0x5A, 0x42, 0x00, 0x01, 0x00, 0x69, 0x0A, 0x4F, 0x00, 0x00, 0x03,
+    0x9F, 0x00, 0x01, 0x00, 0x72, 0x70, 0x41, 0x00, 0x02, 0x03, 0x93, 0x00, 0x72, 0x76, 0x10, 0x4F,
+    0x00, 0x14, 0x4F, 0x00, 0x02, 0x00, 0x63, 0x74, 0x16, 0x33, 0x00, 0x1A, 0x4F, 0x00, 0x01, 0x00,
+    0x69, 0x20, 0x4F, 0x00, 0x01, 0x00, 0x64, 0xF8, 0x39, 0x00, 0x01, 0x00, 0x6C, 0xF8, 0x39, 0x00,
+    0x01, 0x00, 0x75, 0x66, 0x47, 0x00, 0x01, 0x00, 0xBA, 0x00, 0x38, 0x00, 0x01, 0x00, 0x65, 0x26,
+    0x4F, 0x00, 0x01, 0x00, 0x69, 0x2C, 0x4F, 0x00, 0x02, 0x00, 0x61, 0x6F, 0x36, 0x4F, 0x00, 0x36,
+    0x4F, 0x00, 0x03, 0x00, 0x65, 0x69, 0xC3, 0x66, 0x47, 0x00, 0x66, 0x47, 0x00, 0x40, 0x4F, 0x00,
+    0x03, 0x00, 0x61, 0x6F, 0xC3, 0x66, 0x47, 0x00, 0x66, 0x47, 0x00, 0x46, 0x4F, 0x00, 0x01, 0x00,
+    0x76, 0x4C, 0x4F, 0x00, 0x01, 0x00, 0x74, 0x10, 0x2A, 0x00, 0x05, 0x00, 0x61, 0x65, 0x69, 0x6F,
+    0xC3, 0x66, 0x47, 0x00, 0x66, 0x47, 0x00, 0x52, 0x4F, 0x00, 0x58, 0x4F, 0x00, 0xA4, 0x4C, 0x00,
+    0x01, 0x00, 0x65, 0xF8, 0x39, 0x00, 0x01, 0x00, 0x61, 0x60, 0x4F, 0x00, 0x01, 0x00, 0x65, 0x66,
+    0x4F, 0x00, 0x01, 0x00, 0x6F, 0x6C, 0x4F, 0x00, 0x01, 0x00, 0x61, 0x72, 0x4F, 0x00, 0x01, 0x00,
+    0x69, 0x78, 0x4F, 0x00, 0x01, 0x00, 0x65, 0x42, 0x47, 0x00, 0x01, 0x00, 0xC3, 0x7E, 0x4F, 0x00,
+    0x02, 0x00, 0x2E, 0x73, 0x08, 0x47, 0x00, 0x84, 0x4F, 0x00, 0x01, 0x00, 0xC3, 0x8A, 0x4F, 0x00,
+    0x01, 0x00, 0x69, 0x90, 0x4F, 0x00, 0x02, 0x00, 0x2E, 0x73, 0x00, 0x4C, 0x00, 0x86, 0x43, 0x00,
+    0x02, 0x00, 0x2E, 0x6C, 0x80, 0x0A, 0x00, 0x9A, 0x4F, 0x00, 0x04, 0x00, 0x2E, 0x6C, 0x6D, 0x6E,
+    0x80, 0x0A, 0x00, 0x9A, 0x4F, 0x00, 0xD4, 0x16, 0x00, 0xDA, 0x16, 0x00, 0x02, 0x00, 0x2E, 0x73,
+    0x8C, 0x43, 0x00, 0x90, 0x43, 0x00, 0x02, 0x00, 0x2E, 0x73, 0xA8, 0x4F, 0x00, 0x90, 0x43, 0x00,
+    0x00, 0x02, 0x71, 0x00, 0x00, 0x02, 0xF5, 0x00, 0x01, 0x00, 0x73, 0xAC, 0x4F, 0x00, 0x00, 0x03,
+    0x35, 0x01, 0x01, 0x00, 0x72, 0xB0, 0x4F, 0x00, 0x01, 0x00, 0x68, 0xB6, 0x4F, 0x00, 0x01, 0x00,
+    0x62, 0xF8, 0x2E, 0x00, 0x01, 0x00, 0x76, 0xF8, 0x2E, 0x00, 0x04, 0x00, 0x61, 0x65, 0x6F, 0xC3,
+    0xBA, 0x4F, 0x00, 0xBA, 0x4F, 0x00, 0xBA, 0x4F, 0x00, 0xBE, 0x4F, 0x00, 0x01, 0x00, 0x67, 0xCC,
+    0x4F, 0x00, 0x02, 0x00, 0x6D, 0x70, 0xD0, 0x4F, 0x00, 0xD6, 0x4F, 0x00, 0x00, 0x03, 0xEA, 0x00,
+    0x01, 0x00, 0x7A, 0xF8, 0x2E, 0x00, 0x01, 0x00, 0x6E, 0xE0, 0x4F, 0x00, 0x00, 0x03, 0x20, 0x01,
+    0x01, 0x00, 0x70, 0xF2, 0x44, 0x00, 0x01, 0x00, 0x6D, 0xF2, 0x44, 0x00, 0x01, 0x00, 0xA1, 0x66,
+    0x4C, 0x00, 0x01, 0x00, 0x62, 0xEA, 0x4F, 0x00, 0x01, 0x00, 0x69, 0xF2, 0x44, 0x00, 0x02, 0x00,
+    0x63, 0x72, 0x28, 0x3D, 0x00, 0xEE, 0x4F, 0x00, 0x01, 0x02, 0x8B, 0x00, 0x73, 0x66, 0x47, 0x00,
+    0x01, 0x00, 0xAD, 0x46, 0x45, 0x00, 0x01, 0x00, 0x72, 0x66, 0x47, 0x00, 0x01, 0x02, 0x8B, 0x00,
+    0x6F, 0x66, 0x47, 0x00, 0x03, 0x00, 0xA1, 0xA9, 0xB3, 0x66, 0x47, 0x00, 0x66, 0x47, 0x00, 0x66,
+    0x47, 0x00, 0x01, 0x00, 0x72, 0x28, 0x3D, 0x00, 0x01, 0x00, 0x64, 0xF6, 0x4F, 0x00, 0x01, 0x01,
+    0x26, 0x00, 0x69, 0xFC, 0x4F, 0x00, 0x01, 0x00, 0x6E, 0xA6, 0x3D, 0x00, 0x01, 0x00, 0xAD, 0xC6,
+    0x4C, 0x00, 0x01, 0x00, 0x75, 0x00, 0x50, 0x00, 0x02, 0x00, 0xA1, 0xAD, 0xA6, 0x3D, 0x00, 0xA6,
+    0x3D, 0x00, 0x02, 0x01, 0xC1, 0x00, 0x61, 0x6F, 0xA6, 0x3D, 0x00, 0xA6, 0x3D, 0x00, 0x01, 0x00,
+    0x69, 0x90, 0x37, 0x00, 0x01, 0x00, 0x65, 0x06, 0x50, 0x00, 0x02, 0x00, 0xA1, 0xB3, 0xCC, 0x26,
+    0x00, 0xCC, 0x26, 0x00, 0x01, 0x00, 0xAD, 0x32, 0x44, 0x00, 0x01, 0x00, 0x61, 0x6A, 0x46, 0x00,
+    0x01, 0x00, 0xA1, 0x06, 0x44, 0x00, 0x01, 0x00, 0x65, 0x0C, 0x50, 0x00, 0x01, 0x00, 0x6D, 0x52,
+    0x4D, 0x00, 0x01, 0x00, 0x75, 0x06, 0x44, 0x00, 0x01, 0x00, 0x6D, 0xF8, 0x2E, 0x00, 0x01, 0x00,
+    0x75, 0x6E, 0x37, 0x00, 0x01, 0x00, 0xAD, 0x28, 0x4D, 0x00, 0x01, 0x00, 0x6E, 0x08, 0x47, 0x00,
+    0x01, 0x00, 0x6E, 0x12, 0x50, 0x00, 0x01, 0x00, 0x70, 0x18, 0x50, 0x00, 0x01, 0x00, 0xAD, 0x94,
+    0x32, 0x00, 0x01, 0x00, 0x69, 0x6E, 0x37, 0x00, 0x02, 0x00, 0x61, 0xC3, 0xCC, 0x26, 0x00, 0x1E,
+    0x50, 0x00, 0x01, 0x00, 0xB3, 0x28, 0x50, 0x00, 0x04, 0x00, 0x61, 0x65, 0x6F, 0xC3, 0xF8, 0x2E,
+    0x00, 0xF8, 0x2E, 0x00, 0xF8, 0x2E, 0x00, 0x32, 0x38, 0x00, 0x01, 0x00, 0x64, 0x26, 0x40, 0x00,
+    0x00, 0x02, 0x20, 0x00, 0x01, 0x00, 0x61, 0x0C, 0x41, 0x00, 0x01, 0x00, 0x65, 0x2E, 0x50, 0x00,
+    0x01, 0x00, 0x6F, 0x0C, 0x41, 0x00, 0x01, 0x00, 0x6E, 0x34, 0x50, 0x00, 0x00, 0x02, 0x57, 0x00,
+    0x00, 0x01, 0x59, 0x00, 0x05, 0x00, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0x3A, 0x50, 0x00, 0x3A, 0x50,
+    0x00, 0x3A, 0x50, 0x00, 0x3A, 0x50, 0x00, 0x3A, 0x50, 0x00, 0x01, 0x00, 0x69, 0xC0, 0x4D, 0x00,
+    0x02, 0x00, 0x63, 0x7A, 0xEA, 0x47, 0x00, 0xEA, 0x47, 0x00, 0x01, 0x00, 0xAD, 0xC0, 0x4D, 0x00,
+    0x01, 0x00, 0x73, 0x3E, 0x50, 0x00, 0x01, 0x00, 0x6C, 0xEA, 0x47, 0x00, 0x01, 0x00, 0xB1, 0xB0,
+    0x28, 0x00, 0x01, 0x00, 0xA9, 0x5C, 0x49, 0x00, 0x01, 0x00, 0x62, 0x30, 0x3F, 0x00, 0x01, 0x00,
+    0x61, 0x44, 0x50, 0x00, 0x01, 0x00, 0x69, 0xA0, 0x48, 0x00, 0x01, 0x00, 0x73, 0x30, 0x36, 0x00,
+    0x01, 0x00, 0x63, 0x30, 0x36, 0x00, 0x02, 0x00, 0x6F, 0xC3, 0x7C, 0x48, 0x00, 0x4E, 0x50, 0x00,
+    0x01, 0x00, 0x74, 0x30, 0x36, 0x00, 0x01, 0x00, 0x73, 0x10, 0x4E, 0x00, 0x02, 0x00, 0x63, 0x7A,
+    0x30, 0x36, 0x00, 0x30, 0x36, 0x00, 0x01, 0x00, 0x65, 0x7C, 0x48, 0x00, 0x03, 0x00, 0x6E, 0x72,
+    0x73, 0x30, 0x36, 0x00, 0x30, 0x36, 0x00, 0x30, 0x36, 0x00, 0x01, 0x00, 0x61, 0x54, 0x50, 0x00,
+    0x01, 0x00, 0x6E, 0x5A, 0x50, 0x00, 0x01, 0x00, 0x73, 0x2E, 0x40, 0x00, 0x01, 0x00, 0x64, 0x60,
+    0x50, 0x00, 0x01, 0x00, 0x74, 0x6A, 0x50, 0x00, 0x01, 0x00, 0x73, 0x70, 0x50, 0x00, 0x01, 0x00,
+    0x69, 0xB6, 0x4F, 0x00, 0x01, 0x00, 0x2E, 0x46, 0x38, 0x00, 0x01, 0x00, 0xAD, 0x76, 0x50, 0x00,
+    0x01, 0x00, 0x6D, 0x7C, 0x50, 0x00, 0x01, 0x00, 0xAD, 0x70, 0x4E, 0x00, 0x01, 0x00, 0x61, 0x82,
+    0x50, 0x00, 0x01, 0x00, 0x69, 0x86, 0x50, 0x00, 0x02, 0x00, 0x2E, 0x6C, 0x8C, 0x50, 0x00, 0x90,
+    0x50, 0x00, 0x01, 0x00, 0x6C, 0x90, 0x50, 0x00, 0x03, 0x00, 0x61, 0x65, 0x6F, 0x9E, 0x50, 0x00,
+    0x9E, 0x50, 0x00, 0x9E, 0x50, 0x00, 0x01, 0x00, 0x65, 0xA8, 0x50, 0x00, 0x01, 0x00, 0x72, 0xB2,
+    0x50, 0x00, 0x00, 0x03, 0x17, 0x00, 0x00, 0x03, 0x1D, 0x00, 0x02, 0x00, 0x74, 0x75, 0xB6, 0x4E,
+    0x00, 0xB6, 0x4E, 0x00, 0x00, 0x03, 0x1A, 0x00, 0x01, 0x00, 0x6E, 0xB6, 0x50, 0x00, 0x03, 0x00,
+    0x2E, 0x6D, 0x73, 0x88, 0x21, 0x00, 0x94, 0x40, 0x00, 0xBA, 0x1A, 0x00, 0x01, 0x00, 0x61, 0xF4,
+    0x41, 0x00, 0x01, 0x00, 0xB1, 0xF4, 0x41, 0x00, 0x00, 0x02, 0xC5, 0x00, 0x01, 0x00, 0x65, 0xA6,
+    0x3D, 0x00, 0x00, 0x03, 0xB9, 0x00, 0x01, 0x00, 0xA1, 0x72, 0x49, 0x00, 0x01, 0x00, 0x61, 0xBC,
+    0x50, 0x00, 0x01, 0x02, 0xA4, 0x00, 0x73, 0xC0, 0x50, 0x00, 0x01, 0x00, 0x63, 0xC4, 0x50, 0x00,
+    0x00, 0x03, 0x99, 0x00, 0x01, 0x00, 0x69, 0xCA, 0x50, 0x00, 0x01, 0x00, 0x69, 0x24, 0x4C, 0x00,
+    0x01, 0x00, 0x6E, 0xD0, 0x50, 0x00, 0x01, 0x00, 0x72, 0xD6, 0x50, 0x00, 0x02, 0x00, 0x6F, 0xC3,
+    0xDC, 0x50, 0x00, 0xE2, 0x50, 0x00, 0x02, 0x00, 0x2E, 0x73, 0xF8, 0x2E, 0x00, 0xE8, 0x50, 0x00,
+    0x01, 0x00, 0xAD, 0x66, 0x47, 0x00, 0x01, 0x00, 0xA1, 0x66, 0x47, 0x00, 0x01, 0x00, 0x61, 0x00,
+    0x38, 0x00, 0x01, 0x00, 0x76, 0x66, 0x47, 0x00, 0x01, 0x02, 0x8B, 0x00, 0x72, 0xEE, 0x50, 0x00,
+    0x01, 0x00, 0x63, 0xF4, 0x50, 0x00, 0x01, 0x00, 0x6C, 0x1C, 0x2C, 0x00, 0x01, 0x00, 0x62, 0x1C,
+    0x2C, 0x00, 0x01, 0x00, 0x72, 0x1C, 0x2C, 0x00, 0x01, 0x00, 0x6E, 0x1C, 0x2C, 0x00, 0x01, 0x00,
+    0xA1, 0x12, 0x2C, 0x00, 0x01, 0x00, 0x2E, 0x08, 0x47, 0x00, 0x01, 0x00, 0xA1, 0x78, 0x4F, 0x00,
+    0x02, 0x00, 0x64, 0x74, 0xFA, 0x50, 0x00, 0x10, 0x4A, 0x00, 0x03, 0x00, 0x61, 0x65, 0x6F, 0xC6,
+    0x1A, 0x00, 0xC6, 0x1A, 0x00, 0xC6, 0x1A, 0x00, 0x00, 0x02, 0x76, 0x00, 0x00, 0x01, 0x02, 0x01,
+    0x01, 0x00, 0x65, 0xFE, 0x50, 0x00, 0x00, 0x01, 0xDB, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x03, 0x00,
+    0xA1, 0xA9, 0xB3, 0xBA, 0x4F, 0x00, 0xBA, 0x4F, 0x00, 0xBA, 0x4F, 0x00, 0x00, 0x03, 0xF7, 0x00,
+    0x01, 0x00, 0x70, 0xCC, 0x4F, 0x00, 0x02, 0x00, 0x63, 0x74, 0xCC, 0x4F, 0x00, 0xCC, 0x4F, 0x00,
+    0x02, 0x00, 0x74, 0x7A, 0x1C, 0x2C, 0x00, 0x1C, 0x2C, 0x00, 0x00, 0x03, 0x1D, 0x01, 0x01, 0x02,
+    0x8B, 0x00, 0x61, 0x66, 0x47, 0x00, 0x01, 0x00, 0x6F, 0xAC, 0x4F, 0x00, 0x00, 0x02, 0x16, 0x01,
+    0x01, 0x00, 0x6C, 0xA6, 0x3D, 0x00, 0x01, 0x00, 0x74, 0x88, 0x46, 0x00, 0x01, 0x00, 0x6E, 0x06,
+    0x44, 0x00, 0x01, 0x00, 0x64, 0x10, 0x33, 0x00, 0x01, 0x00, 0x69, 0x06, 0x44, 0x00, 0x02, 0x00,
+    0xA9, 0xB3, 0xCC, 0x26, 0x00, 0xCC, 0x26, 0x00, 0x01, 0x00, 0x74, 0x68, 0x4A, 0x00, 0x01, 0x00,
+    0x61, 0x04, 0x51, 0x00, 0x01, 0x00, 0x74, 0x28, 0x3D, 0x00, 0x00, 0x02, 0x55, 0x00, 0x01, 0x00,
+    0x69, 0x08, 0x51, 0x00, 0x02, 0x00, 0x63, 0x6E, 0x36, 0x30, 0x00, 0x0E, 0x51, 0x00, 0x01, 0x00,
+    0xB3, 0x7C, 0x48, 0x00, 0x01, 0x00, 0x6C, 0x10, 0x4A, 0x00, 0x01, 0x00, 0x74, 0x14, 0x51, 0x00,
+    0x02, 0x00, 0x2E, 0x65, 0x88, 0x21, 0x00, 0x0C, 0x17, 0x00, 0x01, 0x00, 0x65, 0xBA, 0x1A, 0x00,
+    0x01, 0x00, 0x2E, 0x1A, 0x51, 0x00, 0x01, 0x00, 0x6E, 0x1E, 0x51, 0x00, 0x01, 0x00, 0x69, 0x82,
+    0x50, 0x00, 0x00, 0x03, 0xD8, 0x00, 0x01, 0x00, 0x6D, 0x24, 0x51, 0x00, 0x00, 0x03, 0x31, 0x00,
+    0x03, 0x00, 0x61, 0x65, 0x6F, 0x9E, 0x50, 0x00, 0x9E, 0x50, 0x00, 0x9E, 0x50, 0x00, 0x02, 0x00,
+    0x2E, 0x73, 0x8C, 0x50, 0x00, 0x2A, 0x51, 0x00, 0x02, 0x00, 0x2E, 0x6C, 0x8C, 0x50, 0x00, 0x30,
+    0x51, 0x00, 0x00, 0x02, 0x14, 0x00, 0x01, 0x00, 0x6F, 0x3E, 0x51, 0x00, 0x00, 0x02, 0xB3, 0x00,
+    0x00, 0x02, 0xA4, 0x00, 0x01, 0x00, 0x61, 0x42, 0x51, 0x00, 0x01, 0x00, 0x74, 0x48, 0x51, 0x00,
+    0x01, 0x00, 0x61, 0x52, 0x51, 0x00, 0x01, 0x00, 0x69, 0x58, 0x51, 0x00, 0x01, 0x00, 0x6E, 0x66,
+    0x47, 0x00, 0x01, 0x00, 0xB3, 0xDC, 0x50, 0x00, 0x01, 0x00, 0x2E, 0xF8, 0x2E, 0x00, 0x01, 0x00,
+    0x69, 0x66, 0x47, 0x00, 0x01, 0x00, 0x69, 0x46, 0x38, 0x00, 0x00, 0x02, 0x02, 0x00, 0x01, 0x00,
+    0x73, 0x5E, 0x51, 0x00, 0x00, 0x01, 0xE6, 0x00, 0x01, 0x00, 0x76, 0xEA, 0x47, 0x00, 0x01, 0x00,
+    0x7A, 0x30, 0x36, 0x00, 0x01, 0x00, 0x65, 0x8C, 0x49, 0x00, 0x00, 0x03, 0x4F, 0x00, 0x01, 0x00,
+    0x65, 0x82, 0x50, 0x00, 0x01, 0x00, 0x6F, 0x70, 0x51, 0x00, 0x01, 0x00, 0x2E, 0x8C, 0x50, 0x00,
+    0x03, 0x00, 0x61, 0x65, 0x6F, 0x74, 0x51, 0x00, 0x9E, 0x50, 0x00, 0x9E, 0x50, 0x00, 0x00, 0x02,
+    0x12, 0x00, 0x01, 0x00, 0x6E, 0x7E, 0x51, 0x00, 0x02, 0x00, 0x2E, 0x73, 0x70, 0x51, 0x00, 0x82,
+    0x51, 0x00, 0x01, 0x00, 0x73, 0x46, 0x38, 0x00, 0x01, 0x00, 0x61, 0xDC, 0x50, 0x00, 0x04, 0x00,
+    0x61, 0x65, 0x6F, 0xC3, 0x88, 0x51, 0x00, 0x88, 0x51, 0x00, 0x88, 0x51, 0x00, 0x8C, 0x51, 0x00,
+    0x00, 0x03, 0x96, 0x00, 0x02, 0x00, 0x2E, 0x73, 0x9A, 0x51, 0x00, 0x9E, 0x51, 0x00, 0x00, 0x03,
+    0x8F, 0x00, 0x01, 0x00, 0x2E, 0x70, 0x51, 0x00, 0x00, 0x05, 0x2D, 0x01, 0x03, 0x00, 0xA1, 0xA9,
+    0xB3, 0x88, 0x51, 0x00, 0x88, 0x51, 0x00, 0x88, 0x51, 0x00, 0x00, 0x04, 0x34, 0x00, 0x01, 0x00,
+    0x2E, 0x9A, 0x51, 0x00,
+};
+
+constexpr uint8_t es_trie_levels[] = {
+    0x05, 0x14, 0x07, 0x14, 0x51, 0x72, 0x51, 0x62, 0x51, 0x14, 0x12, 0x04, 0x14, 0x25, 0x02, 0x13,
+    0x05, 0x04, 0x45, 0x54, 0x43, 0x54, 0x54, 0x23, 0x43, 0x54, 0x43, 0x54, 0x84, 0x46, 0x55, 0x64,
+    0x61, 0x82, 0x61, 0x72, 0x61, 0x24, 0x43, 0x33, 0x31, 0x52, 0x31, 0x42, 0x31, 0x04, 0x13, 0x04,
+    0x12, 0x04, 0x13, 0x43, 0x04, 0x13, 0x43, 0x73, 0x03, 0x14, 0x64, 0x23, 0x41, 0x62, 0x41, 0x52,
+    0x41, 0x14, 0x23, 0x15, 0x24, 0x33, 0x15, 0x24, 0x04, 0x13, 0x24, 0x33, 0x04, 0x13, 0x33, 0x15,
+    0x24, 0x43, 0x21, 0x32, 0x42, 0x71, 0x92, 0x71, 0x82, 0x71, 0x21, 0x32, 0x21, 0x42, 0x35, 0x02,
+    0x62, 0x13, 0x04, 0x14, 0x23, 0x56, 0x11, 0x42, 0x11, 0x32, 0x04, 0x12, 0x23, 0x44, 0x53, 0x04,
+    0x23, 0x04, 0x33, 0x04, 0x24, 0x33, 0x04, 0x24, 0x01, 0x02, 0x13, 0x22, 0x23, 0x34, 0x02, 0x22,
+    0x22, 0x33, 0x02, 0x12, 0x42, 0x72, 0x42, 0x62, 0x42, 0x51, 0x53, 0x43, 0x63, 0x33, 0x53, 0x22,
+    0x33, 0x44, 0x36, 0x42, 0x51, 0x72, 0x43, 0x54, 0x73, 0x43, 0x54, 0x74, 0x42, 0x51, 0x62, 0x43,
+    0x54, 0x64, 0x42, 0x53, 0x53, 0x64, 0x02, 0x51, 0x72, 0x02, 0x51, 0x62, 0x02, 0x51, 0x03, 0x34,
+    0x45, 0x13, 0x33, 0x23, 0x63, 0x23, 0x53, 0x24, 0x33, 0x24, 0x33, 0x44, 0x24, 0x33, 0x42, 0x54,
+    0x63, 0x44, 0x44, 0x55, 0x42, 0x65, 0x76, 0x25, 0x34, 0x23, 0x34, 0x43, 0x04, 0x44, 0x03, 0x12,
+    0x04, 0x15, 0x35, 0x42, 0x53, 0x32, 0x25, 0x44, 0x43, 0x54, 0x63, 0x73, 0x24, 0x35, 0x22, 0x33,
+    0x54, 0x23, 0x43, 0x35, 0x44, 0x34, 0x55, 0x34, 0x43, 0x22, 0x52, 0x61, 0x82, 0x52, 0x61, 0x72,
+    0x33, 0x62, 0x73, 0x52, 0x61, 0x52, 0x63, 0x33, 0x53, 0x64, 0x22, 0x32, 0x52, 0x22, 0x32, 0x42,
+    0x22, 0x31, 0x63, 0x33, 0x44, 0x33, 0x42, 0x32, 0x41, 0x32, 0x42, 0x62, 0x32, 0x42, 0x52, 0x32,
+    0x52, 0x42, 0x52, 0x42, 0x52, 0x72, 0x43, 0x73, 0x42, 0x52, 0x62, 0x34, 0x41, 0x34, 0x41, 0x64,
+    0x34, 0x41, 0x54, 0x34, 0x43, 0x54, 0x72, 0x45, 0x32, 0x62, 0x32, 0x43, 0x62, 0x33, 0x44, 0x63,
+    0x92, 0xA3, 0x32, 0x43, 0x52, 0x44, 0x53, 0x64, 0x14, 0x43,
+};
+
+constexpr DenseHyphenationTrie es_dense_trie = {
+    es_trie_classes, 35u, es_trie_dense, es_trie_nodes, sizeof(es_trie_nodes),
+    es_trie_levels, sizeof(es_trie_levels),
 };
 
 constexpr SerializedHyphenationPatterns es_patterns = {
-    0x34F8u,
-    es_trie_data,
-    sizeof(es_trie_data),
+    0u,
+    nullptr,
+    0,
+    &es_dense_trie,
 };
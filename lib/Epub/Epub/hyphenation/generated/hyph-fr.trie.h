@@ -6,448 +6,959 @@
 #include "../SerializedHyphenationTrie.h"
 
 // Auto-generated by generate_hyphenation_trie.py. Do not edit manually.
-alignas(4) constexpr uint8_t fr_trie_data[] = {
-    0x02, 0x0C, 0x18, 0x22, 0x16, 0x21, 0x0B, 0x16, 0x21, 0x0E, 0x01, 0x0C, 0x0B, 0x3D, 0x0C, 0x2B,
-    0x0E, 0x0C, 0x0C, 0x33, 0x0C, 0x33, 0x16, 0x34, 0x2A, 0x0D, 0x20, 0x0D, 0x0C, 0x0D, 0x2A, 0x17,
-    0x04, 0x1F, 0x0C, 0x29, 0x0C, 0x20, 0x0B, 0x0C, 0x17, 0x17, 0x0C, 0x3F, 0x35, 0x53, 0x4A, 0x36,
-    0x34, 0x21, 0x2A, 0x0D, 0x0C, 0x2A, 0x0D, 0x16, 0x02, 0x17, 0x15, 0x15, 0x0C, 0x15, 0x16, 0x2C,
-    0x47, 0x0C, 0x49, 0x2B, 0x0C, 0x0D, 0x34, 0x0D, 0x2A, 0x0B, 0x16, 0x2B, 0x0C, 0x17, 0x2A, 0x0B,
-    0x0C, 0x03, 0x0C, 0x16, 0x0D, 0x01, 0x16, 0x0C, 0x0B, 0x0C, 0x3E, 0x48, 0x2C, 0x0B, 0x29, 0x16,
-    0x37, 0x40, 0x1F, 0x16, 0x20, 0x17, 0x36, 0x0D, 0x52, 0x3D, 0x16, 0x1F, 0x0C, 0x16, 0x3E, 0x0D,
-    0x49, 0x0C, 0x03, 0x16, 0x35, 0x0C, 0x22, 0x0F, 0x02, 0x0D, 0x51, 0x0C, 0x21, 0x0C, 0x20, 0x0B,
-    0x16, 0x21, 0x0C, 0x17, 0x21, 0x0C, 0x0D, 0xA0, 0x00, 0x91, 0x21, 0x61, 0xFD, 0x21, 0xA9, 0xFD,
-    0x21, 0xC3, 0xFD, 0x21, 0x72, 0xFD, 0xA0, 0x00, 0xC2, 0x21, 0x68, 0xFD, 0x21, 0x63, 0xFD, 0x21,
-    0x73, 0xFD, 0xA0, 0x00, 0x51, 0x21, 0x6C, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x63,
-    0xFD, 0xA0, 0x01, 0x12, 0x21, 0x63, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x6E, 0xFD,
-    0x21, 0x69, 0xFD, 0xA0, 0x01, 0x32, 0x21, 0x72, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x73, 0xFD, 0xA0,
-    0x01, 0x52, 0x21, 0x69, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0xA9, 0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x68,
-    0xFD, 0x21, 0x74, 0xFD, 0x21, 0x73, 0xFD, 0xA0, 0x01, 0x72, 0xA0, 0x01, 0xB1, 0x21, 0x65, 0xFD,
-    0x21, 0x6E, 0xFD, 0xA1, 0x01, 0x72, 0x6E, 0xFD, 0xA0, 0x01, 0x92, 0x21, 0xA9, 0xFD, 0x24, 0x61,
-    0x65, 0xC3, 0x73, 0xE9, 0xF5, 0xFD, 0xE9, 0x21, 0x69, 0xF7, 0x23, 0x61, 0x65, 0x74, 0xC2, 0xDA,
-    0xFD, 0xA0, 0x01, 0xC2, 0x21, 0x61, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x6F, 0xFD,
-    0xA0, 0x01, 0xE1, 0x21, 0x61, 0xFD, 0x21, 0x74, 0xFD, 0x41, 0x2E, 0xFF, 0x5E, 0x21, 0x74, 0xFC,
-    0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x22, 0x67, 0x70, 0xFD, 0xFD, 0xA0, 0x05, 0x72, 0x21, 0x74,
-    0xFD, 0x21, 0x61, 0xFD, 0x21, 0x6E, 0xFD, 0xC9, 0x00, 0x61, 0x62, 0x65, 0x6C, 0x6D, 0x6E, 0x70,
-    0x73, 0x72, 0x67, 0xFF, 0x4C, 0xFF, 0x58, 0xFF, 0x67, 0xFF, 0x79, 0xFF, 0xC3, 0xFF, 0xD6, 0xFF,
-    0xDF, 0xFF, 0xEF, 0xFF, 0xFD, 0xA0, 0x00, 0x71, 0x27, 0xA2, 0xAA, 0xA9, 0xA8, 0xAE, 0xB4, 0xBB,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xA0, 0x02, 0x52, 0x22, 0x61, 0x6F, 0xFD, 0xFD, 0xA0,
-    0x02, 0x93, 0x21, 0x61, 0xFD, 0x21, 0x72, 0xFD, 0xA2, 0x00, 0x61, 0x6E, 0x75, 0xF2, 0xFD, 0x21,
-    0xA9, 0xAC, 0x42, 0xC3, 0x69, 0xFF, 0xFD, 0xFF, 0xA9, 0x21, 0x6E, 0xF9, 0x41, 0x74, 0xFF, 0x06,
-    0x21, 0x61, 0xFC, 0x21, 0x6D, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x6F, 0xFD, 0xA0, 0x01, 0xE2, 0x21,
-    0x74, 0xFD, 0x21, 0x69, 0xFD, 0x41, 0x72, 0xFF, 0x6B, 0x21, 0x75, 0xFC, 0x21, 0x67, 0xFD, 0xA2,
-    0x02, 0x52, 0x6E, 0x75, 0xF3, 0xFD, 0x41, 0x62, 0xFF, 0x5A, 0x21, 0x61, 0xFC, 0x21, 0x66, 0xFD,
-    0x41, 0x74, 0xFF, 0x50, 0x41, 0x72, 0xFF, 0x4F, 0x21, 0x6F, 0xFC, 0xC4, 0x02, 0x52, 0x66, 0x70,
-    0x72, 0x78, 0xFF, 0xF2, 0xFF, 0xF5, 0xFF, 0x45, 0xFF, 0xFD, 0xA0, 0x06, 0x82, 0x21, 0x61, 0xFD,
-    0x21, 0x74, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0x75, 0xFD, 0x21, 0x72, 0xF4, 0x21, 0x72, 0xFD, 0x21,
-    0x61, 0xFD, 0xA2, 0x06, 0x62, 0x6C, 0x6E, 0xF4, 0xFD, 0x21, 0xA9, 0xF9, 0x41, 0x69, 0xFF, 0xA0,
-    0x21, 0x74, 0xFC, 0x21, 0x69, 0xFD, 0xC3, 0x02, 0x52, 0x6D, 0x71, 0x74, 0xFF, 0xFD, 0xFF, 0x96,
-    0xFF, 0x96, 0x41, 0x6C, 0xFF, 0x8A, 0x21, 0x75, 0xFC, 0x41, 0x64, 0xFE, 0xF7, 0xA2, 0x02, 0x52,
-    0x63, 0x6E, 0xF9, 0xFC, 0x41, 0x62, 0xFF, 0x43, 0x21, 0x61, 0xFC, 0x21, 0x74, 0xFD, 0xA0, 0x05,
-    0xF1, 0xA0, 0x06, 0xC1, 0x21, 0xA9, 0xFD, 0xA7, 0x06, 0xA2, 0x61, 0x65, 0xC3, 0x69, 0x6F, 0x75,
-    0x73, 0xF7, 0xF7, 0xFD, 0xF7, 0xF7, 0xF7, 0xF7, 0x21, 0x72, 0xEF, 0x21, 0x65, 0xFD, 0xC2, 0x02,
-    0x52, 0x69, 0x6C, 0xFF, 0x72, 0xFF, 0x4E, 0x49, 0x66, 0x61, 0x65, 0xC3, 0x69, 0x6F, 0x73, 0x74,
-    0x75, 0xFF, 0x42, 0xFF, 0x58, 0xFF, 0x74, 0xFF, 0xA2, 0xFF, 0xAF, 0xFF, 0xC6, 0xFF, 0xD4, 0xFF,
-    0xF4, 0xFF, 0xF7, 0xC2, 0x00, 0x61, 0x67, 0x6E, 0xFF, 0x16, 0xFF, 0xE4, 0x41, 0x75, 0xFE, 0xA7,
-    0x21, 0x67, 0xFC, 0x41, 0x65, 0xFF, 0x09, 0x21, 0x74, 0xFC, 0xA0, 0x02, 0x71, 0x21, 0x75, 0xFD,
-    0x21, 0x6F, 0xFD, 0x21, 0x61, 0xFD, 0xA0, 0x02, 0x72, 0x21, 0x63, 0xFD, 0x21, 0x73, 0xFD, 0x21,
-    0x69, 0xFD, 0xA4, 0x00, 0x61, 0x6E, 0x63, 0x75, 0x76, 0xDE, 0xE5, 0xF1, 0xFD, 0xA0, 0x00, 0x61,
-    0xC7, 0x00, 0x42, 0x61, 0xC3, 0x65, 0x69, 0x6F, 0x75, 0x79, 0xFE, 0x87, 0xFE, 0xA8, 0xFE, 0xC8,
-    0xFF, 0xC3, 0xFF, 0xF2, 0xFF, 0xFD, 0xFF, 0xFD, 0x42, 0x61, 0x74, 0xFD, 0xF4, 0xFE, 0x2F, 0x43,
-    0x64, 0x67, 0x70, 0xFE, 0x54, 0xFE, 0x54, 0xFE, 0x54, 0xC8, 0x00, 0x61, 0x62, 0x65, 0x6D, 0x6E,
-    0x70, 0x73, 0x72, 0x67, 0xFD, 0xAA, 0xFD, 0xB6, 0xFD, 0xD7, 0xFF, 0xEF, 0xFE, 0x34, 0xFE, 0x3D,
-    0xFF, 0xF6, 0xFE, 0x5B, 0xA0, 0x03, 0x01, 0x21, 0x2E, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD,
-    0x21, 0x65, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0xA1, 0x00, 0x71, 0x6D, 0xFD, 0x47, 0xA2,
-    0xAA, 0xA9, 0xA8, 0xAE, 0xB4, 0xBB, 0xFE, 0x47, 0xFE, 0x47, 0xFF, 0xFB, 0xFE, 0x47, 0xFE, 0x47,
-    0xFE, 0x47, 0xFE, 0x47, 0xA0, 0x02, 0x22, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x61, 0xFD,
-    0x21, 0x6D, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x69, 0xFD, 0xA0, 0x02, 0x51, 0x43,
-    0x63, 0x74, 0x75, 0xFE, 0x28, 0xFE, 0x28, 0xFF, 0xFD, 0x41, 0x61, 0xFF, 0x4D, 0x44, 0x61, 0x6F,
-    0x73, 0x75, 0xFF, 0xF2, 0xFF, 0xFC, 0xFE, 0x25, 0xFE, 0x1A, 0x22, 0x61, 0x69, 0xDF, 0xF3, 0xA0,
-    0x03, 0x42, 0x21, 0x65, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x75,
-    0xFD, 0x21, 0x65, 0xFD, 0x21, 0x66, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x76, 0xFD,
-    0x21, 0xA8, 0xFD, 0xA1, 0x00, 0x71, 0xC3, 0xFD, 0xA0, 0x02, 0x92, 0x21, 0x70, 0xFD, 0x21, 0x6C,
-    0xFD, 0x21, 0x61, 0xFD, 0x21, 0x73, 0xFD, 0xA0, 0x03, 0x31, 0xA0, 0x04, 0x42, 0x21, 0x63, 0xFD,
-    0xA0, 0x04, 0x61, 0x21, 0x65, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0xAE, 0xFD, 0x21,
-    0xC3, 0xFD, 0x21, 0x61, 0xFD, 0x22, 0x73, 0x6D, 0xE8, 0xFD, 0x21, 0x65, 0xFB, 0x21, 0x72, 0xFD,
-    0xA2, 0x04, 0x31, 0x73, 0x74, 0xD7, 0xFD, 0x41, 0x65, 0xFD, 0xD5, 0x21, 0x69, 0xFC, 0xA1, 0x02,
-    0x52, 0x6C, 0xFD, 0xA0, 0x01, 0x31, 0x21, 0x2E, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x21,
-    0x65, 0xFD, 0x21, 0x6D, 0xFD, 0x23, 0x6E, 0x6F, 0x6D, 0xDB, 0xE9, 0xFD, 0xA0, 0x04, 0x31, 0x21,
-    0x6C, 0xFD, 0x44, 0x68, 0x69, 0x6F, 0x75, 0xFF, 0x91, 0xFF, 0xA2, 0xFF, 0xF3, 0xFF, 0xFD, 0x41,
-    0x61, 0xFF, 0x9B, 0x21, 0x6F, 0xFC, 0x21, 0x79, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x63, 0xFD, 0x41,
-    0x6F, 0xFE, 0x7B, 0xA0, 0x04, 0x73, 0x21, 0x72, 0xFD, 0xA0, 0x04, 0xA2, 0x21, 0x6C, 0xF7, 0x21,
-    0x6C, 0xFD, 0x21, 0x65, 0xFD, 0xA0, 0x04, 0x72, 0x21, 0x72, 0xFD, 0x21, 0x74, 0xFD, 0x24, 0x63,
-    0x6D, 0x74, 0x73, 0xE8, 0xEB, 0xF4, 0xFD, 0xA0, 0x04, 0xF3, 0x21, 0x72, 0xFD, 0xA1, 0x04, 0xC3,
-    0x67, 0xFD, 0x21, 0xA9, 0xFB, 0x21, 0x62, 0xE0, 0x21, 0x69, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x74,
-    0xD7, 0x21, 0x75, 0xD4, 0x23, 0x6E, 0x72, 0x78, 0xF7, 0xFA, 0xFD, 0x21, 0x6E, 0xB8, 0x21, 0x69,
-    0xB5, 0x21, 0x6F, 0xC4, 0x22, 0x65, 0x76, 0xF7, 0xFD, 0xC6, 0x05, 0x23, 0x64, 0x67, 0x6C, 0x6E,
-    0x72, 0x73, 0xFF, 0xAA, 0xFF, 0xF2, 0xFF, 0xF5, 0xFF, 0xFB, 0xFF, 0xAA, 0xFF, 0xE5, 0x41, 0xA9,
-    0xFF, 0x95, 0x21, 0xC3, 0xFC, 0x41, 0x69, 0xFF, 0x97, 0x42, 0x6D, 0x70, 0xFF, 0x9C, 0xFF, 0x9C,
-    0x41, 0x66, 0xFF, 0x98, 0x45, 0x64, 0x6C, 0x70, 0x72, 0x75, 0xFF, 0xEE, 0xFF, 0x7F, 0xFF, 0xF1,
-    0xFF, 0xF5, 0xFF, 0xFC, 0xA0, 0x04, 0xC2, 0x21, 0x93, 0xFD, 0xA0, 0x05, 0x23, 0x21, 0x6E, 0xFD,
-    0xCA, 0x01, 0xC1, 0x61, 0x63, 0xC3, 0x65, 0x69, 0x6F, 0xC5, 0x70, 0x74, 0x75, 0xFF, 0x7E, 0xFF,
-    0x75, 0xFF, 0x92, 0xFF, 0xA4, 0xFF, 0xB9, 0xFF, 0xE4, 0xFF, 0xF7, 0xFF, 0x75, 0xFF, 0x75, 0xFF,
-    0xFD, 0x44, 0x61, 0x69, 0x6F, 0x73, 0xFD, 0xC5, 0xFF, 0x3E, 0xFD, 0xC5, 0xFF, 0xDF, 0x21, 0xA9,
-    0xF3, 0x41, 0xA9, 0xFC, 0x86, 0x41, 0x64, 0xFC, 0x82, 0x22, 0xC3, 0x69, 0xF8, 0xFC, 0x41, 0x64,
-    0xFE, 0x4E, 0x41, 0x69, 0xFC, 0x75, 0x41, 0x6D, 0xFC, 0x71, 0x21, 0x6F, 0xFC, 0x24, 0x63, 0x6C,
-    0x6D, 0x74, 0xEC, 0xF1, 0xF5, 0xFD, 0x41, 0x6E, 0xFC, 0x61, 0x41, 0x68, 0xFC, 0x92, 0x23, 0x61,
-    0x65, 0x73, 0xEF, 0xF8, 0xFC, 0xC4, 0x01, 0xE2, 0x61, 0x69, 0x6F, 0x75, 0xFC, 0x5A, 0xFC, 0x5A,
-    0xFC, 0x5A, 0xFC, 0x5A, 0x21, 0x73, 0xF1, 0x41, 0x6C, 0xFB, 0xFC, 0x45, 0x61, 0xC3, 0x69, 0x79,
-    0x6F, 0xFE, 0xE1, 0xFF, 0xB3, 0xFF, 0xE3, 0xFF, 0xF9, 0xFF, 0xFC, 0x48, 0x61, 0x65, 0xC3, 0x69,
-    0x6F, 0x73, 0x74, 0x75, 0xFC, 0x74, 0xFC, 0x90, 0xFC, 0xBE, 0xFC, 0xCB, 0xFC, 0xE2, 0xFC, 0xF0,
-    0xFD, 0x10, 0xFD, 0x13, 0xC2, 0x00, 0x61, 0x67, 0x6E, 0xFC, 0x35, 0xFF, 0xE7, 0x41, 0x64, 0xFE,
-    0x6A, 0x21, 0x69, 0xFC, 0x41, 0x61, 0xFC, 0x3B, 0x21, 0x63, 0xFC, 0x21, 0x69, 0xFD, 0x22, 0x63,
-    0x66, 0xF3, 0xFD, 0x41, 0x6D, 0xFC, 0x29, 0x22, 0x69, 0x75, 0xF7, 0xFC, 0x21, 0x6E, 0xFB, 0x41,
-    0x73, 0xFB, 0x25, 0x21, 0x6F, 0xFC, 0x42, 0x6B, 0x72, 0xFC, 0x16, 0xFF, 0xFD, 0x41, 0x73, 0xFB,
-    0xE2, 0x42, 0x65, 0x6F, 0xFF, 0xFC, 0xFB, 0xDE, 0x21, 0x72, 0xF9, 0x41, 0xA9, 0xFD, 0xED, 0x21,
-    0xC3, 0xFC, 0x21, 0x73, 0xFD, 0x44, 0x64, 0x69, 0x70, 0x76, 0xFF, 0xF3, 0xFF, 0xFD, 0xFD, 0xE3,
-    0xFB, 0xCA, 0x41, 0x6E, 0xFD, 0xD6, 0x41, 0x74, 0xFD, 0xD2, 0x21, 0x6E, 0xFC, 0x42, 0x63, 0x64,
-    0xFD, 0xCB, 0xFB, 0xB2, 0x24, 0x61, 0x65, 0x69, 0x6F, 0xE1, 0xEE, 0xF6, 0xF9, 0x41, 0x78, 0xFD,
-    0xBB, 0x24, 0x67, 0x63, 0x6C, 0x72, 0xAB, 0xB5, 0xF3, 0xFC, 0x41, 0x68, 0xFE, 0xCA, 0x21, 0x6F,
-    0xFC, 0xC1, 0x01, 0xC1, 0x6E, 0xFD, 0xF2, 0x41, 0x73, 0xFE, 0xBD, 0x41, 0x73, 0xFE, 0xBF, 0x44,
-    0x61, 0x65, 0x69, 0x75, 0xFF, 0xF2, 0xFF, 0xF8, 0xFE, 0xB5, 0xFF, 0xFC, 0x41, 0x61, 0xFA, 0xA5,
-    0x21, 0x74, 0xFC, 0x21, 0x73, 0xFD, 0x21, 0x61, 0xFD, 0x23, 0x67, 0x73, 0x74, 0xD5, 0xE6, 0xFD,
-    0x21, 0xA9, 0xF9, 0xA0, 0x01, 0x11, 0x21, 0x6D, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x69, 0xFD, 0x21,
-    0x6C, 0xFD, 0x21, 0x6C, 0xFD, 0x41, 0xC3, 0xFA, 0xC6, 0x21, 0x64, 0xFC, 0x42, 0xA9, 0xAF, 0xFA,
-    0xBC, 0xFF, 0xFD, 0x47, 0x61, 0x65, 0xC3, 0x69, 0x6F, 0x75, 0x73, 0xFA, 0xA4, 0xFA, 0xA4, 0xFF,
-    0xF9, 0xFA, 0xA4, 0xFA, 0xA4, 0xFA, 0xA4, 0xFA, 0xA4, 0x21, 0x6F, 0xEA, 0x21, 0x6E, 0xFD, 0x44,
-    0x61, 0xC3, 0x69, 0x6F, 0xFF, 0x82, 0xFF, 0xC1, 0xFF, 0xD3, 0xFF, 0xFD, 0x41, 0x68, 0xFA, 0xA5,
-    0x21, 0x74, 0xFC, 0x21, 0x61, 0xFD, 0x21, 0x6E, 0xFD, 0xA0, 0x06, 0x22, 0x21, 0xA9, 0xFD, 0x41,
-    0xA9, 0xFC, 0x27, 0x21, 0xC3, 0xFC, 0x21, 0x63, 0xFD, 0xA0, 0x07, 0x82, 0x21, 0x68, 0xFD, 0x21,
-    0x64, 0xFD, 0x24, 0x67, 0xC3, 0x73, 0x75, 0xE4, 0xEA, 0xF4, 0xFD, 0x41, 0x61, 0xFD, 0x8E, 0xC2,
-    0x01, 0x72, 0x6C, 0x75, 0xFF, 0xFC, 0xFA, 0x4B, 0x47, 0x61, 0xC3, 0x65, 0x69, 0x6F, 0x75, 0x73,
-    0xFF, 0xF7, 0xFA, 0x53, 0xFA, 0x3F, 0xFA, 0x3F, 0xFA, 0x3F, 0xFA, 0x3F, 0xFA, 0x3F, 0x21, 0xA9,
-    0xEA, 0x22, 0x6F, 0xC3, 0xD1, 0xFD, 0x41, 0xA9, 0xFA, 0xB9, 0x21, 0xC3, 0xFC, 0x43, 0x66, 0x6D,
-    0x72, 0xFA, 0xB2, 0xFF, 0xFD, 0xFA, 0xB5, 0x41, 0x73, 0xFC, 0xC1, 0x42, 0x68, 0x74, 0xFA, 0xA4,
-    0xFC, 0xBD, 0x21, 0x70, 0xF9, 0x23, 0x61, 0x69, 0x6F, 0xE8, 0xF2, 0xFD, 0x41, 0xA8, 0xFA, 0x93,
-    0x42, 0x65, 0xC3, 0xFA, 0x8F, 0xFF, 0xFC, 0x21, 0x68, 0xF9, 0x42, 0x63, 0x73, 0xFF, 0xFD, 0xF9,
-    0xED, 0x41, 0xA9, 0xFA, 0xAB, 0x21, 0xC3, 0xFC, 0x43, 0x61, 0x68, 0x65, 0xFF, 0xF2, 0xFF, 0xFD,
-    0xFA, 0x28, 0x43, 0x6E, 0x72, 0x74, 0xFF, 0xD3, 0xFF, 0xF6, 0xFA, 0x21, 0xA0, 0x01, 0xC1, 0x21,
-    0x61, 0xFD, 0x21, 0x74, 0xFD, 0xC6, 0x00, 0x71, 0x61, 0x65, 0xC3, 0x69, 0x6F, 0x75, 0xFB, 0x81,
-    0xFB, 0x81, 0xFF, 0x57, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x81, 0x22, 0x6E, 0x72, 0xE8, 0xEB, 0x41,
-    0x73, 0xFE, 0xE4, 0xA0, 0x07, 0x22, 0x21, 0x61, 0xFD, 0xA2, 0x01, 0x12, 0x73, 0x74, 0xFA, 0xFD,
-    0x43, 0x6F, 0x73, 0x75, 0xFF, 0xEF, 0xFF, 0xF9, 0xF9, 0x61, 0x21, 0x69, 0xF6, 0x21, 0x72, 0xFD,
-    0x21, 0xA9, 0xFD, 0xA0, 0x07, 0x42, 0x21, 0x74, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x6E, 0xFD, 0x21,
-    0x61, 0xFD, 0x21, 0x6C, 0xFD, 0xA1, 0x00, 0x71, 0x61, 0xFD, 0x41, 0x61, 0xFE, 0xA9, 0x21, 0x69,
-    0xFC, 0x21, 0x72, 0xFD, 0x21, 0x75, 0xFD, 0x41, 0x74, 0xFF, 0x95, 0x21, 0x65, 0xFC, 0x21, 0x74,
-    0xFD, 0x41, 0x6E, 0xFD, 0x23, 0x45, 0x68, 0x69, 0x6F, 0x72, 0x73, 0xF9, 0x7C, 0xFF, 0xFC, 0xFD,
-    0x25, 0xF9, 0x7C, 0xF9, 0x52, 0x21, 0x74, 0xF0, 0x22, 0x6E, 0x73, 0xE6, 0xFD, 0x41, 0x6E, 0xFB,
-    0xFD, 0x21, 0x61, 0xFC, 0x21, 0x6F, 0xFD, 0x21, 0x68, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0x79, 0xFD,
-    0x41, 0x6C, 0xFA, 0xE6, 0x21, 0x64, 0xFC, 0x21, 0x64, 0xFD, 0x49, 0x72, 0x61, 0x65, 0xC3, 0x68,
-    0x6C, 0x6F, 0x73, 0x75, 0xFE, 0xF7, 0xFF, 0x48, 0xFF, 0x70, 0xFF, 0x96, 0xFF, 0xAB, 0xFF, 0xBA,
-    0xFF, 0xDE, 0xFF, 0xF3, 0xFF, 0xFD, 0x41, 0x6E, 0xF9, 0x2B, 0x21, 0x67, 0xFC, 0x41, 0x6C, 0xFB,
-    0x17, 0x21, 0x6C, 0xFC, 0x22, 0x61, 0x69, 0xF6, 0xFD, 0x41, 0x67, 0xFE, 0x7D, 0x21, 0x6E, 0xFC,
-    0x41, 0x72, 0xFB, 0xF2, 0x41, 0x65, 0xFF, 0x18, 0x21, 0x6C, 0xFC, 0x42, 0x72, 0x75, 0xFB, 0xE7,
-    0xFF, 0xFD, 0x41, 0x68, 0xFB, 0xEA, 0xA0, 0x08, 0x02, 0x21, 0x74, 0xFD, 0xA1, 0x02, 0x93, 0x6C,
-    0xFD, 0xA0, 0x08, 0x53, 0xA1, 0x08, 0x23, 0x72, 0xFD, 0x21, 0xA9, 0xFB, 0x41, 0x6E, 0xF9, 0x80,
-    0x21, 0x69, 0xFC, 0x42, 0x6D, 0x6E, 0xFF, 0xFD, 0xF9, 0x79, 0x42, 0x69, 0x75, 0xFF, 0xF9, 0xF9,
-    0x72, 0x41, 0x72, 0xFB, 0x57, 0x45, 0x61, 0xC3, 0x69, 0x6C, 0x75, 0xFF, 0xD7, 0xFF, 0xE4, 0xFD,
-    0x7D, 0xFF, 0xF5, 0xFF, 0xFC, 0xA0, 0x08, 0x83, 0xA1, 0x02, 0x93, 0x74, 0xFD, 0x21, 0x75, 0xB9,
-    0x21, 0x6C, 0xB6, 0xA3, 0x02, 0x93, 0x61, 0x6C, 0x74, 0xFA, 0xFD, 0xB3, 0xA0, 0x08, 0x23, 0x21,
-    0xA9, 0xFD, 0x42, 0x66, 0x74, 0xFB, 0x26, 0xFB, 0x26, 0x42, 0x6D, 0x6E, 0xF9, 0x06, 0xFF, 0xF9,
-    0x42, 0x66, 0x78, 0xFB, 0x18, 0xFB, 0x18, 0x46, 0x61, 0x65, 0xC3, 0x68, 0x69, 0x6F, 0xFF, 0xD1,
-    0xFF, 0xDC, 0xFF, 0xE8, 0xF9, 0x25, 0xFF, 0xF2, 0xFF, 0xF9, 0x22, 0x62, 0x72, 0xAB, 0xED, 0x41,
-    0x76, 0xFB, 0x50, 0x21, 0x75, 0xFC, 0x48, 0x74, 0x79, 0x61, 0x65, 0x63, 0x68, 0x75, 0x6F, 0xFF,
-    0x4E, 0xFF, 0x57, 0xFF, 0x5A, 0xFF, 0x65, 0xFF, 0x6C, 0xF8, 0xBF, 0xFF, 0xF4, 0xFF, 0xFD, 0xC3,
-    0x00, 0x61, 0x6E, 0x75, 0x76, 0xF9, 0xD1, 0xF9, 0xE4, 0xF9, 0xF0, 0x41, 0x68, 0xF8, 0x9A, 0x43,
-    0x63, 0x6E, 0x74, 0xF9, 0xD7, 0xF9, 0xD7, 0xF9, 0xD7, 0x41, 0x6E, 0xF9, 0xCD, 0x22, 0x61, 0x6F,
-    0xF2, 0xFC, 0x21, 0x69, 0xFB, 0x43, 0x61, 0x68, 0x72, 0xFC, 0x52, 0xF8, 0x80, 0xFF, 0xFD, 0x41,
-    0x2E, 0xFE, 0x2D, 0x21, 0x74, 0xFC, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6D, 0xFD, 0x21,
-    0x6D, 0xFD, 0x21, 0x65, 0xFD, 0x41, 0x62, 0xFD, 0xD2, 0x21, 0x6F, 0xFC, 0x21, 0x6E, 0xFD, 0x21,
-    0x6F, 0xFD, 0x42, 0x73, 0x74, 0xF7, 0xFF, 0xF7, 0xFF, 0x42, 0x65, 0x69, 0xF7, 0xF8, 0xFF, 0xF9,
-    0x41, 0x78, 0xFD, 0xFC, 0xA2, 0x02, 0x72, 0x6C, 0x75, 0xF5, 0xFC, 0x41, 0x72, 0xFD, 0xF1, 0x42,
-    0xA9, 0xA8, 0xFD, 0x4A, 0xFF, 0xFC, 0xC2, 0x02, 0x72, 0x6C, 0x72, 0xFD, 0xE6, 0xFD, 0xE6, 0x41,
-    0x69, 0xF7, 0xD2, 0xA1, 0x02, 0x72, 0x66, 0xFC, 0x41, 0x73, 0xFD, 0xD4, 0xA1, 0x01, 0xB1, 0x73,
-    0xFC, 0x41, 0x72, 0xFA, 0xC2, 0x47, 0x61, 0xC3, 0x65, 0x69, 0x6F, 0x75, 0x74, 0xFF, 0xCF, 0xFF,
-    0xDA, 0xFF, 0xE1, 0xFF, 0xEE, 0xF9, 0x51, 0xFF, 0xF7, 0xFF, 0xFC, 0x21, 0xA9, 0xEA, 0x41, 0x70,
-    0xF8, 0x3E, 0x42, 0x69, 0x6F, 0xF8, 0x3A, 0xF8, 0x3A, 0x21, 0x73, 0xF9, 0x41, 0x75, 0xF8, 0x30,
-    0x44, 0x61, 0x69, 0x6F, 0x72, 0xFF, 0xEE, 0xFF, 0xF9, 0xFF, 0xFC, 0xF8, 0x8C, 0x41, 0x63, 0xF8,
-    0x22, 0x41, 0x72, 0xF8, 0x1B, 0x41, 0x64, 0xF8, 0x17, 0x21, 0x6E, 0xFC, 0x21, 0x65, 0xFD, 0x41,
-    0x73, 0xF8, 0x0D, 0x21, 0x6E, 0xFC, 0x24, 0x65, 0x69, 0x6C, 0x6F, 0xE7, 0xEB, 0xF6, 0xFD, 0x41,
-    0x69, 0xF8, 0x73, 0x21, 0x75, 0xFC, 0xC1, 0x01, 0xE2, 0x65, 0xFA, 0x36, 0x41, 0x64, 0xF6, 0xDA,
-    0x44, 0x62, 0x67, 0x6E, 0x74, 0xF6, 0xD6, 0xF6, 0xD6, 0xFF, 0xFC, 0xF6, 0xD6, 0x42, 0x6E, 0x72,
-    0xF6, 0xC9, 0xF6, 0xC9, 0x21, 0xA9, 0xF9, 0x42, 0x6D, 0x70, 0xF6, 0xBF, 0xF6, 0xBF, 0x42, 0x63,
-    0x70, 0xF6, 0xB8, 0xF6, 0xB8, 0xA0, 0x07, 0xA2, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x74,
-    0xF7, 0x22, 0x63, 0x6E, 0xFD, 0xF4, 0xA2, 0x00, 0xC2, 0x65, 0x69, 0xF5, 0xFB, 0xC7, 0x01, 0xE2,
-    0x61, 0xC3, 0x69, 0x6F, 0x72, 0x75, 0x79, 0xFF, 0xC3, 0xFF, 0xD7, 0xFF, 0xDA, 0xFF, 0xE1, 0xFF,
-    0xF9, 0xF6, 0x99, 0xF6, 0x99, 0xC5, 0x02, 0x52, 0x63, 0x70, 0x71, 0x73, 0x74, 0xFF, 0x6B, 0xFF,
-    0x91, 0xFF, 0x9E, 0xFF, 0xA1, 0xFF, 0xE8, 0x21, 0x73, 0xEE, 0x42, 0xC3, 0x65, 0xFF, 0x41, 0xFF,
-    0xFD, 0x41, 0x74, 0xF7, 0x02, 0x21, 0x61, 0xFC, 0x53, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x69,
-    0x6D, 0x70, 0x73, 0x6F, 0x6B, 0x74, 0x67, 0x6E, 0x72, 0x6C, 0x75, 0x79, 0xF8, 0xB1, 0xF8, 0xE6,
-    0xF9, 0x32, 0xF9, 0xCA, 0xFB, 0x03, 0xF7, 0x50, 0xFB, 0x2C, 0xFC, 0x27, 0xFD, 0x92, 0xFE, 0x6E,
-    0xFE, 0x87, 0xFE, 0x93, 0xFE, 0xAD, 0xFE, 0xCA, 0xFE, 0xD7, 0xFF, 0xF2, 0xFF, 0xFD, 0xF8, 0x85,
-    0xF8, 0x85, 0xA0, 0x00, 0x81, 0x41, 0xAE, 0xFE, 0x87, 0xA0, 0x02, 0x31, 0x21, 0x2E, 0xFD, 0x21,
-    0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x42, 0x74, 0x65, 0xF8, 0x91, 0xFF, 0xFD, 0x23, 0x68, 0xC3, 0x73,
-    0xE6, 0xE9, 0xF9, 0x21, 0x68, 0xDF, 0xA0, 0x00, 0xA2, 0x21, 0x65, 0xFD, 0x21, 0x72, 0xFD, 0x21,
-    0x64, 0xFD, 0x21, 0xA8, 0xFD, 0xA0, 0x00, 0xE1, 0x21, 0x6C, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x6F,
-    0xFD, 0xA0, 0x00, 0xF2, 0x21, 0x69, 0xFD, 0x21, 0x67, 0xFD, 0x21, 0x6C, 0xFD, 0x22, 0x63, 0x61,
-    0xF1, 0xFD, 0xA0, 0x00, 0xE2, 0x21, 0x69, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0xA9, 0xFD, 0x21, 0xC3,
-    0xFD, 0x21, 0x68, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x73, 0xFD, 0x41, 0x2E, 0xF6, 0x46, 0x21, 0x74,
-    0xFC, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6D, 0xFD, 0x41, 0x2E, 0xF8, 0xC6, 0x21, 0x74,
-    0xFC, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD,
-    0x21, 0x66, 0xFD, 0x21, 0x69, 0xFD, 0x23, 0x65, 0x69, 0x74, 0xD1, 0xE1, 0xFD, 0x41, 0x74, 0xFE,
-    0x84, 0x21, 0x73, 0xFC, 0x41, 0x72, 0xF8, 0xDB, 0x21, 0x61, 0xFC, 0x22, 0x6F, 0x70, 0xF6, 0xFD,
-    0x41, 0x73, 0xF5, 0xD8, 0x21, 0x69, 0xFC, 0x21, 0x70, 0xFD, 0x21, 0xA9, 0xFD, 0x21, 0xC3, 0xFD,
-    0x21, 0x69, 0xFD, 0x21, 0x68, 0xFD, 0xA0, 0x06, 0x41, 0x21, 0x6C, 0xFD, 0x21, 0x6C, 0xFD, 0x41,
-    0x2E, 0xFF, 0x33, 0x21, 0x74, 0xFC, 0x21, 0x6E, 0xFD, 0x22, 0x69, 0x65, 0xF3, 0xFD, 0x22, 0x63,
-    0x6D, 0xE5, 0xFB, 0xA0, 0x02, 0x02, 0x21, 0x6F, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xEA, 0x22,
-    0x74, 0x6D, 0xFA, 0xFD, 0x41, 0x65, 0xFF, 0x1E, 0xA0, 0x03, 0x21, 0x21, 0x2E, 0xFD, 0x21, 0x74,
-    0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x65, 0xFD,
-    0x21, 0x69, 0xFD, 0x21, 0x75, 0xFD, 0x22, 0x63, 0x71, 0xDE, 0xFD, 0x21, 0x73, 0xC8, 0x21, 0x6F,
-    0xFD, 0x21, 0x6E, 0xFD, 0x41, 0x6C, 0xF8, 0x6B, 0x21, 0x69, 0xFC, 0xA0, 0x05, 0xE1, 0x21, 0x2E,
-    0xFD, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0x61, 0xFD,
-    0x21, 0x67, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x61, 0xFD, 0x41, 0x6D, 0xFF, 0xA3, 0x4E, 0x62, 0x64,
-    0xC3, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x63, 0x67, 0x76, 0x6D, 0x69, 0x75, 0xFE, 0xCF, 0xFE, 0xD6,
-    0xFE, 0xE5, 0xFF, 0x00, 0xFF, 0x49, 0xFF, 0x5E, 0xFF, 0x91, 0xFF, 0xA2, 0xFF, 0xC9, 0xFF, 0xD4,
-    0xFF, 0xDB, 0xFF, 0xF9, 0xFF, 0xFC, 0xFF, 0xFC, 0x47, 0xA2, 0xA9, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB,
-    0xFE, 0xBD, 0xFE, 0xBD, 0xFE, 0xBD, 0xFE, 0xBD, 0xFE, 0xBD, 0xFE, 0xBD, 0xFE, 0xBD, 0xA0, 0x02,
-    0x41, 0x21, 0x2E, 0xFD, 0xA0, 0x00, 0x41, 0x21, 0x2E, 0xFD, 0x21, 0x74, 0xFD, 0xA3, 0x00, 0xE1,
-    0x2E, 0x73, 0x6E, 0xF1, 0xF4, 0xFD, 0x23, 0x2E, 0x73, 0x6E, 0xE8, 0xEB, 0xF4, 0xA1, 0x00, 0xE2,
-    0x65, 0xF9, 0xA0, 0x02, 0xF1, 0x21, 0x6C, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x69, 0xFD, 0x42, 0x74,
-    0x6D, 0xFF, 0xFD, 0xFE, 0xB6, 0xA1, 0x00, 0xE1, 0x75, 0xF9, 0xC2, 0x00, 0xE2, 0x65, 0x75, 0xFF,
-    0xDC, 0xFE, 0xAD, 0x49, 0x61, 0xC3, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x75, 0x79, 0xFE, 0x62, 0xFF,
-    0xA5, 0xFF, 0xCA, 0xFE, 0x62, 0xFF, 0xDA, 0xFF, 0xF2, 0xFF, 0xF7, 0xFE, 0x62, 0xFE, 0x62, 0x43,
-    0x65, 0x69, 0x75, 0xFE, 0x23, 0xFC, 0x9D, 0xFC, 0x9D, 0x41, 0x69, 0xF4, 0xB7, 0xA0, 0x05, 0x92,
-    0x21, 0x65, 0xFD, 0x21, 0x75, 0xFD, 0x22, 0x65, 0x71, 0xF7, 0xFD, 0x21, 0x69, 0xFB, 0x43, 0x65,
-    0x68, 0x72, 0xFE, 0x04, 0xFF, 0xEB, 0xFF, 0xFD, 0x21, 0x72, 0xE5, 0x21, 0x74, 0xFD, 0x21, 0x63,
-    0xFD, 0x21, 0x74, 0xDC, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0xA9, 0xFD,
-    0x41, 0x75, 0xF7, 0x4F, 0x21, 0x71, 0xFC, 0x44, 0x65, 0xC3, 0x69, 0x6F, 0xFF, 0xE7, 0xFF, 0xF6,
-    0xFC, 0x55, 0xFF, 0xFD, 0x21, 0x67, 0xB9, 0x21, 0x72, 0xFD, 0x41, 0x74, 0xF7, 0x35, 0x22, 0x65,
-    0x69, 0xF9, 0xFC, 0xC1, 0x01, 0xC2, 0x65, 0xF4, 0x00, 0x21, 0x70, 0xFA, 0x21, 0x6F, 0xFD, 0x21,
-    0x63, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x69, 0xFD, 0x41, 0x6C, 0xF6, 0xCF, 0x21, 0x6C, 0xFC, 0x21,
-    0x69, 0xFD, 0x41, 0x6C, 0xFE, 0x92, 0x21, 0x61, 0xFC, 0x41, 0x74, 0xFE, 0x0B, 0x21, 0x6F, 0xFC,
-    0x22, 0x76, 0x70, 0xF6, 0xFD, 0x42, 0x69, 0x65, 0xFF, 0xFB, 0xFD, 0x8D, 0x21, 0x75, 0xF9, 0x48,
-    0x63, 0x64, 0x6C, 0x6E, 0x70, 0x6D, 0x71, 0x72, 0xFF, 0x60, 0xFF, 0x7F, 0xFF, 0xA8, 0xFF, 0xBF,
-    0xFF, 0xD6, 0xFF, 0xE0, 0xFF, 0xFD, 0xFE, 0x65, 0x45, 0xA7, 0xA9, 0xA2, 0xA8, 0xB4, 0xFD, 0x8D,
-    0xFF, 0xE7, 0xFE, 0xA1, 0xFE, 0xA1, 0xFE, 0xA1, 0xA0, 0x02, 0xC3, 0x21, 0x74, 0xFD, 0x21, 0x75,
-    0xFD, 0x41, 0x69, 0xFA, 0xC0, 0x41, 0x2E, 0xF3, 0xB5, 0x21, 0x74, 0xFC, 0x21, 0x6E, 0xFD, 0x21,
-    0x65, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0xAA, 0xFD, 0x21, 0xC3, 0xFD, 0xA3, 0x00, 0xE1, 0x6F, 0x70,
-    0x72, 0xE3, 0xE6, 0xFD, 0xA0, 0x06, 0x51, 0x21, 0x6C, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x69, 0xFD,
-    0x44, 0x2E, 0x73, 0x6E, 0x76, 0xFE, 0x9E, 0xFE, 0xA1, 0xFE, 0xAA, 0xFF, 0xFD, 0x42, 0x2E, 0x73,
-    0xFE, 0x91, 0xFE, 0x94, 0xA0, 0x03, 0x63, 0x21, 0x63, 0xFD, 0xA0, 0x03, 0x93, 0x21, 0x74, 0xFD,
-    0x21, 0xA9, 0xFD, 0x22, 0x61, 0xC3, 0xF4, 0xFD, 0x21, 0x72, 0xFB, 0xA2, 0x00, 0x81, 0x65, 0x6F,
-    0xE2, 0xFD, 0xC2, 0x00, 0x81, 0x65, 0x6F, 0xFF, 0xDB, 0xFB, 0x6A, 0x41, 0x64, 0xF5, 0x75, 0x21,
-    0x6E, 0xFC, 0x21, 0x65, 0xFD, 0xCD, 0x00, 0xE2, 0x2E, 0x62, 0x65, 0x67, 0x6C, 0x6D, 0x6E, 0x70,
-    0x72, 0x73, 0x74, 0x77, 0x69, 0xFE, 0x59, 0xFE, 0x5F, 0xFF, 0xBB, 0xFE, 0x5F, 0xFF, 0xE6, 0xFE,
-    0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFF, 0xED, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFF, 0xFD, 0x41,
-    0x6C, 0xF2, 0xB8, 0xA1, 0x00, 0xE1, 0x6C, 0xFC, 0xA0, 0x03, 0xC2, 0xC9, 0x00, 0xE2, 0x2E, 0x62,
-    0x65, 0x66, 0x67, 0x68, 0x70, 0x73, 0x74, 0xFE, 0x23, 0xFE, 0x29, 0xFE, 0x3B, 0xFE, 0x29, 0xFE,
-    0x29, 0xFF, 0xFD, 0xFE, 0x29, 0xFE, 0x29, 0xFE, 0x29, 0xC2, 0x00, 0xE2, 0x65, 0x61, 0xFE, 0x1D,
-    0xFC, 0xEE, 0xA0, 0x03, 0xE1, 0x22, 0x63, 0x71, 0xFD, 0xFD, 0xA0, 0x03, 0xF2, 0x21, 0x63, 0xF5,
-    0x21, 0x72, 0xF2, 0x22, 0x6F, 0x75, 0xFA, 0xFD, 0x21, 0x73, 0xFB, 0x27, 0x63, 0x64, 0x70, 0x72,
-    0x73, 0x75, 0x78, 0xEA, 0xEF, 0xE7, 0xE7, 0xFD, 0xE7, 0xE7, 0xA0, 0x04, 0x12, 0x21, 0xA9, 0xFD,
-    0x23, 0x66, 0x6E, 0x78, 0xD2, 0xD2, 0xD2, 0x41, 0x62, 0xFC, 0x3B, 0x21, 0x72, 0xFC, 0x41, 0x69,
-    0xFF, 0x5D, 0x41, 0x2E, 0xFD, 0xE0, 0x21, 0x74, 0xFC, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x42,
-    0x67, 0x65, 0xFF, 0xFD, 0xF4, 0xBE, 0x21, 0x6E, 0xF9, 0x21, 0x69, 0xFD, 0x41, 0x76, 0xF4, 0xB4,
-    0x21, 0x69, 0xFC, 0x24, 0x75, 0x66, 0x74, 0x6E, 0xD8, 0xDB, 0xF6, 0xFD, 0x41, 0x69, 0xF2, 0xCF,
-    0x21, 0x74, 0xFC, 0x21, 0x69, 0xFD, 0x21, 0x6E, 0xFD, 0x41, 0x6C, 0xF4, 0x97, 0x21, 0x75, 0xFC,
-    0x21, 0x70, 0xFD, 0x21, 0x74, 0xC9, 0x21, 0xA9, 0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x70, 0xFD, 0xC7,
-    0x00, 0xE1, 0x61, 0xC3, 0x65, 0x6E, 0x67, 0x72, 0x6D, 0xFF, 0x8C, 0xFF, 0x9E, 0xFF, 0xA1, 0xFF,
-    0xD4, 0xFF, 0xE7, 0xFF, 0xF1, 0xFF, 0xFD, 0x41, 0x93, 0xFB, 0xFE, 0x41, 0x72, 0xF2, 0x88, 0xA1,
-    0x00, 0xE1, 0x72, 0xFC, 0xC1, 0x00, 0xE1, 0x72, 0xFE, 0x7D, 0x41, 0x64, 0xF2, 0x79, 0x21, 0x69,
-    0xFC, 0x4D, 0x61, 0xC3, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6F, 0xC5, 0x72, 0x75, 0x79, 0x63, 0xFE,
-    0x8A, 0xFD, 0x27, 0xFD, 0x4C, 0xFE, 0xE4, 0xFF, 0x12, 0xFF, 0x1A, 0xFF, 0x38, 0xFF, 0xCE, 0xFF,
-    0xE6, 0xFD, 0x5C, 0xFF, 0xEE, 0xFF, 0xF3, 0xFF, 0xFD, 0x41, 0x63, 0xFC, 0x7B, 0xC3, 0x00, 0xE1,
-    0x61, 0x6B, 0x65, 0xFF, 0xFC, 0xFD, 0x17, 0xFD, 0x29, 0x41, 0x63, 0xFF, 0x53, 0x21, 0x69, 0xFC,
-    0x21, 0x66, 0xFD, 0x21, 0x69, 0xFD, 0xA1, 0x00, 0xE1, 0x6E, 0xFD, 0x41, 0x74, 0xF2, 0x5A, 0xA1,
-    0x00, 0x91, 0x65, 0xFC, 0x21, 0x6C, 0xFB, 0xC3, 0x00, 0xE1, 0x6C, 0x6D, 0x74, 0xFF, 0xFD, 0xFC,
-    0x45, 0xFB, 0x1A, 0x41, 0x6C, 0xFF, 0x29, 0x21, 0x61, 0xFC, 0x21, 0x76, 0xFD, 0x41, 0x61, 0xF2,
-    0xF5, 0x21, 0xA9, 0xFC, 0x21, 0xC3, 0xFD, 0x21, 0x72, 0xFD, 0x22, 0x6F, 0x74, 0xF0, 0xFD, 0xA0,
-    0x04, 0xC3, 0x21, 0x67, 0xFD, 0x21, 0xA2, 0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65,
-    0xFD, 0xA2, 0x00, 0xE1, 0x6E, 0x79, 0xE9, 0xFD, 0x41, 0x6E, 0xFF, 0x2B, 0x21, 0x6F, 0xFC, 0xA1,
-    0x00, 0xE1, 0x63, 0xFD, 0x47, 0xA2, 0xA9, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB, 0xFB, 0x41, 0xFF, 0xFB,
-    0xFB, 0x41, 0xFB, 0x41, 0xFB, 0x41, 0xFB, 0x41, 0xFB, 0x41, 0xC2, 0x00, 0xE1, 0x2E, 0x73, 0xFC,
-    0x84, 0xFC, 0x87, 0x41, 0x6F, 0xFB, 0x3F, 0x42, 0x6D, 0x73, 0xFF, 0xFC, 0xFB, 0x3E, 0x41, 0x73,
-    0xFB, 0x34, 0x22, 0xA9, 0xA8, 0xF5, 0xFC, 0x21, 0xC3, 0xFB, 0xA0, 0x02, 0xA2, 0x4A, 0x75, 0x69,
-    0x6F, 0x61, 0xC3, 0x65, 0x6E, 0xC5, 0x73, 0x79, 0xFF, 0x69, 0xFF, 0x7A, 0xFF, 0xB4, 0xFB, 0x08,
-    0xFF, 0xC7, 0xFF, 0xDD, 0xFF, 0xFA, 0xFF, 0x0A, 0xFF, 0xFD, 0xFB, 0x08, 0x41, 0x63, 0xF3, 0x54,
-    0x21, 0x69, 0xFC, 0x41, 0x67, 0xFE, 0x89, 0x21, 0x72, 0xFC, 0x21, 0x75, 0xFD, 0x41, 0x61, 0xF3,
-    0x46, 0xC4, 0x00, 0xE1, 0x74, 0x67, 0x73, 0x6D, 0xFF, 0xEF, 0xF1, 0x62, 0xFF, 0xF9, 0xFF, 0xFC,
-    0x47, 0xA9, 0xA2, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB, 0xFF, 0xF1, 0xFA, 0xC5, 0xFA, 0xC5, 0xFA, 0xC5,
-    0xFA, 0xC5, 0xFA, 0xC5, 0xFA, 0xC5, 0x41, 0x67, 0xF1, 0x3D, 0xC2, 0x00, 0xE1, 0x6E, 0x6D, 0xFF,
-    0xFC, 0xFB, 0x62, 0x42, 0x65, 0x69, 0xFA, 0x7F, 0xF8, 0xF9, 0xC5, 0x00, 0xE1, 0x6C, 0x70, 0x2E,
-    0x73, 0x6E, 0xFF, 0xF9, 0xFB, 0x5A, 0xFB, 0xF4, 0xFB, 0xF7, 0xFC, 0x00, 0xC1, 0x00, 0xE1, 0x6C,
-    0xFB, 0x48, 0x41, 0x6D, 0xF1, 0x11, 0x41, 0x61, 0xF0, 0xC1, 0x21, 0x6F, 0xFC, 0x21, 0x69, 0xFD,
-    0xC3, 0x00, 0xE1, 0x6D, 0x69, 0x64, 0xFB, 0x2C, 0xFF, 0xF2, 0xFF, 0xFD, 0x41, 0x68, 0xF8, 0xC0,
-    0xA1, 0x00, 0xE1, 0x74, 0xFC, 0xA0, 0x07, 0xC2, 0x21, 0x72, 0xFD, 0x43, 0x2E, 0x73, 0x75, 0xFB,
-    0xB3, 0xFB, 0xB6, 0xFF, 0xFD, 0x21, 0x64, 0xF3, 0xA2, 0x00, 0xE2, 0x65, 0x79, 0xF3, 0xFD, 0x4A,
-    0xC3, 0x69, 0x63, 0x6D, 0x65, 0x75, 0x61, 0x79, 0x68, 0x6F, 0xFF, 0x81, 0xFF, 0x9B, 0xFB, 0x39,
-    0xFB, 0x39, 0xFF, 0xAB, 0xFF, 0xBD, 0xFF, 0xD1, 0xFF, 0xE1, 0xFF, 0xF9, 0xFA, 0x46, 0xA0, 0x03,
-    0x11, 0x21, 0x2E, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x22, 0x63, 0x7A,
-    0xFD, 0xFD, 0x21, 0x6F, 0xFB, 0x21, 0x64, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x76,
-    0xFD, 0x21, 0x6E, 0xE9, 0x21, 0x69, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0xA9, 0xFD, 0x42, 0xC3, 0x73,
-    0xFF, 0xFD, 0xF3, 0x42, 0x21, 0xA9, 0xF9, 0x41, 0x6E, 0xFA, 0x3D, 0x21, 0x69, 0xFC, 0x21, 0x6D,
-    0xFD, 0x21, 0xA9, 0xFD, 0x41, 0x74, 0xF4, 0xB0, 0x22, 0xC3, 0x73, 0xF9, 0xFC, 0xC5, 0x00, 0xE2,
-    0x69, 0x75, 0xC3, 0x6F, 0x65, 0xFF, 0xD1, 0xFD, 0xED, 0xFF, 0xE7, 0xFF, 0xFB, 0xFB, 0x49, 0x41,
-    0x65, 0xF0, 0x5C, 0x21, 0x6C, 0xFC, 0x42, 0x62, 0x63, 0xFF, 0xFD, 0xF0, 0x55, 0x21, 0x61, 0xF9,
-    0x21, 0x6E, 0xFD, 0xC3, 0x00, 0xE1, 0x67, 0x70, 0x73, 0xFF, 0xFD, 0xFC, 0x3E, 0xFC, 0x3E, 0x41,
-    0x6D, 0xF2, 0x05, 0x44, 0x61, 0x65, 0x69, 0x6F, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xFF, 0xFC,
-    0x21, 0x6C, 0xF3, 0x21, 0x6C, 0xFD, 0x21, 0x69, 0xFD, 0xA0, 0x06, 0xD2, 0x21, 0xA9, 0xFD, 0x21,
-    0xC3, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0xA9, 0xFD, 0x21, 0xC3, 0xFD, 0xA2, 0x00, 0xE1, 0x70, 0x6C,
-    0xEB, 0xFD, 0x42, 0xA9, 0xA8, 0xF5, 0x47, 0xF5, 0x47, 0x48, 0x76, 0x61, 0x65, 0xC3, 0x69, 0x6F,
-    0x73, 0x75, 0xFD, 0xEE, 0xF1, 0x6D, 0xF1, 0x6D, 0xFF, 0xF9, 0xF1, 0x6D, 0xF1, 0x6D, 0xF1, 0x6D,
-    0xF1, 0x6D, 0x21, 0x79, 0xE7, 0x41, 0x65, 0xFC, 0xAD, 0x21, 0x72, 0xFC, 0x21, 0x74, 0xFD, 0x21,
-    0x73, 0xFD, 0xA2, 0x00, 0xE1, 0x6C, 0x61, 0xF0, 0xFD, 0xC2, 0x00, 0xE2, 0x75, 0x65, 0xF9, 0x7E,
-    0xFA, 0xAD, 0x43, 0x6D, 0x74, 0x68, 0xFE, 0x5B, 0xF1, 0xA4, 0xEF, 0x15, 0xC4, 0x00, 0xE1, 0x72,
-    0x2E, 0x73, 0x6E, 0xFF, 0xF6, 0xFA, 0x82, 0xFA, 0x85, 0xFA, 0x8E, 0x41, 0x6C, 0xEF, 0x95, 0x21,
-    0x75, 0xFC, 0xA0, 0x06, 0xF3, 0x21, 0x71, 0xFD, 0x21, 0xA9, 0xFD, 0x21, 0xC3, 0xFD, 0xA2, 0x00,
-    0xE1, 0x6E, 0x72, 0xF1, 0xFD, 0x47, 0xA2, 0xA9, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB, 0xF9, 0x00, 0xFF,
-    0xF9, 0xF9, 0x00, 0xF9, 0x00, 0xF9, 0x00, 0xF9, 0x00, 0xF9, 0x00, 0xC1, 0x00, 0x81, 0x65, 0xFB,
-    0xB2, 0x41, 0x73, 0xEF, 0x26, 0x21, 0x6F, 0xFC, 0x21, 0x74, 0xFD, 0xA0, 0x07, 0x62, 0x21, 0xA9,
-    0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x73, 0xF4, 0xA2, 0x00, 0x41, 0x61, 0x69, 0xFA,
-    0xFD, 0xC8, 0x00, 0xE2, 0x2E, 0x65, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0xFA, 0x1D, 0xFA, 0x35,
-    0xFF, 0xDA, 0xFA, 0x23, 0xFF, 0xE7, 0xFF, 0xDA, 0xFA, 0x23, 0xFF, 0xF9, 0x41, 0xA9, 0xF8, 0xC6,
-    0x41, 0x75, 0xF8, 0xC2, 0x22, 0xC3, 0x65, 0xF8, 0xFC, 0x41, 0x68, 0xF8, 0xB9, 0x21, 0x63, 0xFC,
-    0x21, 0x79, 0xFD, 0x41, 0x72, 0xF8, 0xAF, 0x22, 0xA8, 0xA9, 0xFC, 0xFC, 0x21, 0xC3, 0xFB, 0x4D,
-    0x72, 0x75, 0x61, 0x69, 0x6F, 0x6C, 0x65, 0xC3, 0x68, 0x6E, 0x73, 0x74, 0x79, 0xFE, 0xAE, 0xFE,
-    0xD4, 0xFF, 0x0C, 0xFC, 0x95, 0xFF, 0x43, 0xFF, 0x4A, 0xFF, 0x5D, 0xFF, 0x86, 0xFF, 0xC2, 0xFF,
-    0xE5, 0xFF, 0xF1, 0xFF, 0xFD, 0xF8, 0x86, 0x41, 0x63, 0xF1, 0xA8, 0x21, 0x6F, 0xFC, 0x41, 0x64,
-    0xF1, 0xA1, 0x21, 0x69, 0xFC, 0x41, 0x67, 0xF1, 0x9A, 0x41, 0x67, 0xF0, 0xB7, 0x21, 0x6C, 0xFC,
-    0x41, 0x6C, 0xF1, 0x8F, 0x23, 0x69, 0x75, 0x6F, 0xF1, 0xF9, 0xFC, 0x41, 0x67, 0xF8, 0x89, 0x21,
-    0x69, 0xFC, 0x21, 0x6C, 0xFD, 0x21, 0x6C, 0xFD, 0x42, 0x65, 0x69, 0xFF, 0xFD, 0xF6, 0x84, 0x42,
-    0x74, 0x6F, 0xF9, 0xAC, 0xFF, 0xE1, 0x41, 0x74, 0xF8, 0x1F, 0x21, 0x61, 0xFC, 0x21, 0x6D, 0xFD,
-    0x21, 0x72, 0xFD, 0x21, 0x6F, 0xFD, 0x26, 0x6E, 0x63, 0x64, 0x74, 0x73, 0x66, 0xB5, 0xBC, 0xCE,
-    0xE2, 0xE9, 0xFD, 0x41, 0xA9, 0xF8, 0xB0, 0x42, 0x61, 0x6F, 0xF8, 0xAC, 0xF8, 0xAC, 0x22, 0xC3,
-    0x69, 0xF5, 0xF9, 0x42, 0x65, 0x68, 0xF7, 0xCF, 0xFF, 0xFB, 0x41, 0x74, 0xFC, 0xE0, 0x21, 0x61,
-    0xFC, 0x22, 0x63, 0x74, 0xF2, 0xFD, 0x41, 0x2E, 0xF0, 0xE1, 0x21, 0x74, 0xFC, 0x21, 0x6E, 0xFD,
-    0x21, 0x65, 0xFD, 0x21, 0x63, 0xFD, 0x42, 0x73, 0x6E, 0xFF, 0xFD, 0xF1, 0x19, 0x41, 0x6E, 0xF1,
-    0x12, 0x22, 0x69, 0x61, 0xF5, 0xFC, 0x42, 0x75, 0x6F, 0xFF, 0x68, 0xF9, 0xD4, 0x22, 0x6D, 0x70,
-    0xF4, 0xF9, 0xA0, 0x00, 0xA1, 0x21, 0x69, 0xFD, 0x21, 0x67, 0xFD, 0x21, 0x72, 0xF7, 0x21, 0x68,
-    0xFD, 0x21, 0x74, 0xFD, 0x22, 0x6C, 0x72, 0xF4, 0xFD, 0x41, 0x6C, 0xF7, 0x69, 0x41, 0x72, 0xFA,
-    0x24, 0x41, 0x74, 0xFA, 0xF9, 0x21, 0x63, 0xFC, 0x21, 0x79, 0xDA, 0x22, 0x61, 0x78, 0xFA, 0xFD,
-    0x41, 0x61, 0xF2, 0x17, 0x49, 0x6E, 0x73, 0x6D, 0x61, 0xC3, 0x6C, 0x62, 0x6F, 0x76, 0xFF, 0x72,
-    0xFF, 0x9D, 0xFF, 0xC9, 0xFF, 0xE0, 0xF7, 0x7E, 0xFF, 0xE5, 0xFF, 0xE9, 0xFF, 0xF7, 0xFF, 0xFC,
-    0x41, 0x70, 0xF8, 0x13, 0x43, 0x65, 0x6F, 0x68, 0xF7, 0x3E, 0xFF, 0xFC, 0xF8, 0x0F, 0x41, 0x69,
-    0xF5, 0xAE, 0x22, 0x63, 0x74, 0xF2, 0xFC, 0xA0, 0x05, 0xB3, 0x21, 0x72, 0xFD, 0x21, 0x76, 0xFD,
-    0x41, 0x65, 0xFE, 0xF9, 0x21, 0x72, 0xFC, 0x22, 0x69, 0x74, 0xF6, 0xFD, 0x41, 0x61, 0xFF, 0xA5,
-    0x21, 0x74, 0xFC, 0x21, 0x73, 0xFD, 0xC2, 0x01, 0x71, 0x63, 0x69, 0xED, 0x74, 0xED, 0x74, 0x21,
-    0x61, 0xF7, 0x21, 0x72, 0xFD, 0x21, 0x74, 0xFD, 0x45, 0x73, 0x6E, 0x75, 0x78, 0x72, 0xFF, 0xCA,
-    0xFF, 0xDF, 0xFF, 0xEB, 0xFF, 0xFD, 0xF8, 0x31, 0xC1, 0x00, 0xE1, 0x6D, 0xF7, 0xC4, 0x41, 0x61,
-    0xF9, 0xFD, 0x41, 0x6D, 0xFA, 0xAA, 0x21, 0x69, 0xFC, 0x21, 0x72, 0xFD, 0xA2, 0x00, 0xE1, 0x63,
-    0x74, 0xF2, 0xFD, 0x47, 0xA2, 0xA9, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB, 0xF6, 0xF2, 0xFF, 0xF9, 0xF6,
-    0xF2, 0xF6, 0xF2, 0xF6, 0xF2, 0xF6, 0xF2, 0xF6, 0xF2, 0x41, 0x68, 0xFB, 0xD1, 0x41, 0x70, 0xED,
-    0x6E, 0x21, 0x6F, 0xFC, 0x43, 0x73, 0x63, 0x74, 0xFA, 0x6A, 0xFF, 0xFD, 0xF8, 0x57, 0x41, 0x69,
-    0xFE, 0x77, 0x41, 0x2E, 0xEE, 0x5F, 0x21, 0x74, 0xFC, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21,
-    0x6D, 0xFD, 0x21, 0x67, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x68, 0xFD, 0x21, 0x70,
-    0xFD, 0xA3, 0x00, 0xE1, 0x73, 0x6C, 0x61, 0xD3, 0xDD, 0xFD, 0xA0, 0x05, 0x52, 0x21, 0x6C, 0xFD,
-    0x21, 0x64, 0xFA, 0x21, 0x75, 0xFD, 0x22, 0x61, 0x6F, 0xF7, 0xFD, 0x41, 0x6E, 0xF7, 0xEF, 0x21,
-    0x65, 0xFC, 0x4D, 0x27, 0x61, 0xC3, 0x64, 0x65, 0x69, 0x68, 0x6C, 0x6F, 0x72, 0x73, 0x75, 0x79,
-    0xF6, 0x83, 0xFF, 0x76, 0xFF, 0x91, 0xFF, 0xA7, 0xF7, 0xEB, 0xFF, 0xDF, 0xFF, 0xF4, 0xFF, 0xFD,
-    0xF6, 0x83, 0xF7, 0xFB, 0xFB, 0x78, 0xF6, 0x83, 0xF6, 0x83, 0x41, 0x63, 0xFA, 0x33, 0x41, 0x72,
-    0xF6, 0xA6, 0xA1, 0x01, 0xC2, 0x61, 0xFC, 0x41, 0x73, 0xEF, 0xDE, 0xC2, 0x05, 0x23, 0x63, 0x74,
-    0xF0, 0x03, 0xFF, 0xFC, 0x45, 0x70, 0x61, 0x68, 0x6F, 0x75, 0xFF, 0xEE, 0xFF, 0xF7, 0xEC, 0xAD,
-    0xF0, 0x56, 0xF0, 0x56, 0x21, 0x73, 0xF0, 0x21, 0x6E, 0xFD, 0xC4, 0x00, 0xE2, 0x69, 0x75, 0x61,
-    0x65, 0xFA, 0x40, 0xFF, 0xD0, 0xFF, 0xFD, 0xF7, 0x9C, 0x41, 0x79, 0xFB, 0x9D, 0x21, 0x68, 0xFC,
-    0xC3, 0x00, 0xE1, 0x6E, 0x6D, 0x63, 0xFB, 0x66, 0xF6, 0xCC, 0xFF, 0xFD, 0x41, 0x6D, 0xFB, 0xEE,
-    0x21, 0x61, 0xFC, 0x21, 0x72, 0xFD, 0x21, 0xA9, 0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x70, 0xFD, 0x41,
-    0x6D, 0xEE, 0x61, 0x21, 0x61, 0xFC, 0x42, 0x74, 0x2E, 0xFF, 0xFD, 0xF7, 0x48, 0xC5, 0x00, 0xE1,
-    0x72, 0x6D, 0x73, 0x2E, 0x6E, 0xFB, 0x39, 0xFF, 0xEF, 0xFF, 0xF9, 0xF7, 0x41, 0xF7, 0x4D, 0xC2,
-    0x00, 0x81, 0x69, 0x65, 0xF3, 0x22, 0xF8, 0x9E, 0x41, 0x73, 0xEB, 0xD9, 0x21, 0x6F, 0xFC, 0x21,
-    0x6D, 0xFD, 0x44, 0x2E, 0x73, 0x72, 0x75, 0xF7, 0x1C, 0xF7, 0x1F, 0xFF, 0xFD, 0xFB, 0x66, 0xC7,
-    0x00, 0xE2, 0x72, 0x2E, 0x65, 0x6C, 0x6D, 0x6E, 0x73, 0xFF, 0xE0, 0xF7, 0x0F, 0xFF, 0xF3, 0xF7,
-    0x15, 0xF7, 0x15, 0xF7, 0x15, 0xF7, 0x15, 0x41, 0x62, 0xF9, 0x76, 0x41, 0x73, 0xEC, 0x06, 0x21,
-    0x67, 0xFC, 0xC3, 0x00, 0xE1, 0x72, 0x6D, 0x6E, 0xFF, 0xF5, 0xF6, 0x4A, 0xFF, 0xFD, 0xC2, 0x00,
-    0xE1, 0x6D, 0x72, 0xF6, 0x3E, 0xF9, 0x8D, 0x42, 0x62, 0x70, 0xEB, 0x8A, 0xEB, 0x8A, 0x44, 0x65,
-    0x69, 0x6F, 0x73, 0xEB, 0x83, 0xEB, 0x83, 0xFF, 0xF9, 0xEB, 0x83, 0x21, 0xA9, 0xF3, 0x21, 0xC3,
-    0xFD, 0xA1, 0x00, 0xE1, 0x6C, 0xFD, 0x48, 0xA2, 0xA0, 0xA9, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB, 0xF5,
-    0x5F, 0xF5, 0x5F, 0xFF, 0xFB, 0xF5, 0x5F, 0xF5, 0x5F, 0xF5, 0x5F, 0xF5, 0x5F, 0xF5, 0x5F, 0x41,
-    0x74, 0xF1, 0x2A, 0x21, 0x6E, 0xFC, 0x21, 0x69, 0xFD, 0x21, 0x68, 0xFD, 0x41, 0x6C, 0xFA, 0x2E,
-    0x4B, 0x72, 0x61, 0x65, 0x68, 0x75, 0x6F, 0xC3, 0x63, 0x69, 0x74, 0x79, 0xFF, 0x0A, 0xFF, 0x20,
-    0xFF, 0x4D, 0xFF, 0x7F, 0xFF, 0xA2, 0xFF, 0xAE, 0xFF, 0xD6, 0xFF, 0xF9, 0xF5, 0x35, 0xFF, 0xFC,
-    0xF5, 0x35, 0xC1, 0x00, 0xE1, 0x63, 0xF8, 0xEB, 0x47, 0xA2, 0xA9, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB,
-    0xF5, 0x0D, 0xFF, 0xFA, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0x41, 0x75,
-    0xFF, 0x01, 0x21, 0x68, 0xFC, 0xC2, 0x00, 0xE1, 0x72, 0x63, 0xF5, 0x32, 0xFF, 0xFD, 0xC2, 0x00,
-    0xE2, 0x65, 0x61, 0xF6, 0x58, 0xF3, 0x41, 0x41, 0x74, 0xF6, 0x64, 0xC2, 0x00, 0xE2, 0x65, 0x69,
-    0xF6, 0x4B, 0xFF, 0xFC, 0x4A, 0x61, 0xC3, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x73, 0x75, 0x79, 0xFD,
-    0xC4, 0xFF, 0xC4, 0xF6, 0x39, 0xFF, 0xE1, 0xFF, 0xEA, 0xF4, 0xD1, 0xFF, 0xF7, 0xF9, 0xC6, 0xFD,
-    0xC4, 0xF4, 0xD1, 0x45, 0x61, 0x65, 0x69, 0x6F, 0x79, 0xF4, 0xCF, 0xF4, 0xCF, 0xF4, 0xCF, 0xF4,
-    0xCF, 0xF4, 0xCF, 0x41, 0x75, 0xFA, 0x87, 0x21, 0x71, 0xFC, 0x21, 0x6F, 0xFD, 0x21, 0x6C, 0xFD,
-    0x21, 0x69, 0xFD, 0x21, 0x64, 0xFD, 0x42, 0x6D, 0x6E, 0xF2, 0xE6, 0xFF, 0xFD, 0xC2, 0x00, 0xE2,
-    0x65, 0x61, 0xF5, 0xF9, 0xFF, 0xF9, 0xC1, 0x00, 0xE1, 0x65, 0xF5, 0xF0, 0x4C, 0x61, 0xC3, 0x65,
-    0x68, 0x69, 0x6C, 0x6E, 0x6F, 0x72, 0x75, 0x73, 0x79, 0xF4, 0x79, 0xF5, 0xBC, 0xF5, 0xE1, 0xFF,
-    0xC7, 0xF7, 0xA7, 0xF5, 0xF1, 0xF5, 0xF1, 0xF4, 0x79, 0xFF, 0xF1, 0xFF, 0xFA, 0xF9, 0x6E, 0xF4,
-    0x79, 0x41, 0x69, 0xEF, 0xBB, 0x21, 0x75, 0xFC, 0x42, 0x71, 0x2E, 0xFF, 0xFD, 0xF5, 0xA6, 0xC5,
-    0x00, 0xE1, 0x72, 0x6D, 0x73, 0x2E, 0x6E, 0xEA, 0xD7, 0xF6, 0x80, 0xFF, 0xF9, 0xF5, 0x9F, 0xF5,
-    0xAB, 0x41, 0x69, 0xF6, 0xD1, 0x42, 0x6C, 0x73, 0xFF, 0xFC, 0xEB, 0x02, 0xA0, 0x02, 0xD2, 0x21,
-    0x68, 0xFD, 0x42, 0xC3, 0x61, 0xFA, 0x3F, 0xFF, 0xFD, 0xC2, 0x06, 0x02, 0x6F, 0x73, 0xF5, 0x12,
-    0xF5, 0x12, 0x21, 0x72, 0xF7, 0x21, 0x65, 0xFD, 0xC5, 0x00, 0xE1, 0x63, 0x62, 0x6D, 0x72, 0x70,
-    0xFD, 0xB2, 0xFF, 0xDD, 0xF4, 0xC4, 0xFF, 0xEA, 0xFF, 0xFD, 0x41, 0x6C, 0xFC, 0x26, 0xA1, 0x00,
-    0xE2, 0x75, 0xFC, 0x21, 0x72, 0xFB, 0x41, 0x61, 0xF4, 0x0C, 0x21, 0x69, 0xFC, 0x21, 0x74, 0xFD,
-    0x41, 0x6D, 0xF4, 0x02, 0x21, 0x72, 0xFC, 0x41, 0x6C, 0xF3, 0xFB, 0x41, 0x6F, 0xF8, 0xC3, 0x22,
-    0x65, 0x72, 0xF8, 0xFC, 0x45, 0x6F, 0x61, 0x65, 0x68, 0x69, 0xFF, 0xDF, 0xFF, 0xE9, 0xFF, 0xF0,
-    0xFB, 0x48, 0xFF, 0xFB, 0x41, 0x6F, 0xF6, 0x5E, 0x42, 0x6C, 0x76, 0xFF, 0xFC, 0xF3, 0xDA, 0x41,
-    0x76, 0xF3, 0xD3, 0x22, 0x61, 0x6F, 0xF5, 0xFC, 0x41, 0x70, 0xFB, 0x11, 0x41, 0xA9, 0xFB, 0x17,
-    0x21, 0xC3, 0xFC, 0x41, 0x70, 0xF3, 0xBF, 0xC3, 0x00, 0xE2, 0x2E, 0x65, 0x73, 0xF4, 0xF7, 0xF6,
-    0x66, 0xF4, 0xFD, 0x24, 0x61, 0x6C, 0x6F, 0x68, 0xE5, 0xED, 0xF0, 0xF4, 0x41, 0x6D, 0xF9, 0x29,
-    0xC6, 0x00, 0xE2, 0x2E, 0x65, 0x6D, 0x6F, 0x72, 0x73, 0xF4, 0xDE, 0xF4, 0xF6, 0xF4, 0xE4, 0xFF,
-    0xFC, 0xF4, 0xE4, 0xF4, 0xE4, 0x41, 0x64, 0xF3, 0x8D, 0x21, 0x72, 0xFC, 0x21, 0x61, 0xFD, 0x21,
-    0x64, 0xFD, 0x21, 0x6E, 0xFD, 0x41, 0x6E, 0xF3, 0x7D, 0x21, 0x69, 0xFC, 0xA0, 0x07, 0xE2, 0x21,
-    0x73, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0xA9, 0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0xA9,
-    0xFD, 0x41, 0x67, 0xFF, 0x5F, 0x41, 0x6B, 0xF3, 0x5D, 0x42, 0x63, 0x6D, 0xFF, 0xFC, 0xFF, 0x62,
-    0x41, 0x74, 0xFA, 0x90, 0x21, 0x63, 0xFC, 0x42, 0x6F, 0x75, 0xFF, 0x81, 0xFF, 0xFD, 0x41, 0x65,
-    0xF3, 0x44, 0x21, 0x6C, 0xFC, 0x27, 0x61, 0x65, 0xC3, 0x69, 0x6F, 0x72, 0x79, 0xBD, 0xC4, 0xD9,
-    0xDC, 0xE4, 0xF2, 0xFD, 0x4D, 0x65, 0x75, 0x70, 0x6C, 0x61, 0xC3, 0x63, 0x68, 0x69, 0x6F, 0xC5,
-    0x74, 0x79, 0xFE, 0xCB, 0xFF, 0x04, 0xFF, 0x40, 0xFF, 0x5F, 0xF3, 0x11, 0xF4, 0x54, 0xFF, 0x7F,
-    0xFF, 0x8C, 0xF3, 0x11, 0xF3, 0x11, 0xF7, 0x13, 0xFF, 0xF1, 0xF3, 0x11, 0x41, 0x69, 0xF3, 0x97,
-    0x21, 0x6E, 0xFC, 0x21, 0x6F, 0xFD, 0x22, 0x6D, 0x73, 0xFD, 0xF6, 0x21, 0x6F, 0xFB, 0x21, 0x6E,
-    0xFD, 0x41, 0x75, 0xED, 0x66, 0x41, 0x73, 0xEC, 0x54, 0x21, 0x64, 0xFC, 0x21, 0x75, 0xFD, 0x41,
-    0x6F, 0xF6, 0xA4, 0x42, 0x73, 0x70, 0xEA, 0xC3, 0xFF, 0xFC, 0x21, 0x69, 0xF9, 0x43, 0x6D, 0x62,
-    0x6E, 0xF3, 0x6F, 0xFF, 0xEF, 0xFF, 0xFD, 0x41, 0x67, 0xF3, 0x5C, 0x21, 0x6E, 0xFC, 0x21, 0x6F,
-    0xFD, 0x21, 0x6C, 0xFD, 0x41, 0x65, 0xFA, 0x82, 0x21, 0x74, 0xFC, 0x41, 0x6E, 0xFA, 0xEA, 0x21,
-    0x6F, 0xFC, 0x42, 0x73, 0x74, 0xF7, 0x88, 0xF7, 0x88, 0x41, 0x6F, 0xF7, 0x81, 0x21, 0x72, 0xFC,
-    0x21, 0xA9, 0xFD, 0x41, 0x6D, 0xF7, 0x77, 0x41, 0x75, 0xF7, 0x73, 0x42, 0x64, 0x74, 0xF7, 0x6F,
-    0xFF, 0xFC, 0x41, 0x6E, 0xF7, 0x68, 0x21, 0x6F, 0xFC, 0x21, 0x69, 0xFD, 0x21, 0x74, 0xFD, 0x21,
-    0x63, 0xFD, 0x22, 0x61, 0x69, 0xE9, 0xFD, 0x25, 0x61, 0xC3, 0x69, 0x6F, 0x72, 0xCB, 0xD9, 0xDC,
-    0xDC, 0xFB, 0x21, 0x74, 0xF5, 0x41, 0x61, 0xE9, 0x22, 0x21, 0x79, 0xFC, 0x4B, 0x67, 0x70, 0x6D,
-    0x72, 0x62, 0x63, 0x64, 0xC3, 0x69, 0x73, 0x78, 0xFF, 0x72, 0xFF, 0x75, 0xFF, 0x91, 0xF3, 0x5D,
-    0xFF, 0xA5, 0xFF, 0xAC, 0xFD, 0x10, 0xF2, 0x46, 0xFF, 0xB3, 0xFF, 0xF6, 0xFF, 0xFD, 0x41, 0x6E,
-    0xE8, 0xBD, 0xA1, 0x00, 0xE1, 0x67, 0xFC, 0x46, 0x61, 0x65, 0x69, 0x6F, 0x75, 0x72, 0xFF, 0xFB,
-    0xF3, 0x86, 0xF2, 0x1E, 0xF2, 0x1E, 0xF2, 0x1E, 0xF2, 0x3B, 0xA0, 0x01, 0x71, 0x21, 0xA9, 0xFD,
-    0x21, 0xC3, 0xFD, 0x41, 0x74, 0xE8, 0x44, 0x21, 0x70, 0xFC, 0x22, 0x69, 0x6F, 0xF6, 0xFD, 0xA1,
-    0x00, 0xE1, 0x6D, 0xFB, 0x47, 0xA2, 0xA9, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB, 0xF1, 0xF1, 0xFF, 0xFB,
-    0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0x41, 0xA9, 0xE9, 0x74, 0xC7, 0x06,
-    0x02, 0x61, 0x65, 0xC3, 0x69, 0x6F, 0x73, 0x75, 0xF2, 0xCD, 0xF2, 0xCD, 0xFF, 0xFC, 0xF2, 0xCD,
-    0xF2, 0xCD, 0xF2, 0xCD, 0xF2, 0xCD, 0x21, 0x72, 0xE8, 0x47, 0x61, 0x65, 0xC3, 0x69, 0x6F, 0x73,
-    0x75, 0xE9, 0xBD, 0xE9, 0xBD, 0xED, 0x93, 0xE9, 0xBD, 0xE9, 0xBD, 0xE9, 0xBD, 0xE9, 0xBD, 0x22,
-    0x65, 0x6F, 0xE7, 0xEA, 0xA1, 0x00, 0xE1, 0x70, 0xFB, 0x47, 0x61, 0xC3, 0x65, 0x69, 0x6F, 0x75,
-    0x79, 0xF1, 0x9C, 0xFF, 0xAB, 0xF6, 0x71, 0xF4, 0xCA, 0xF1, 0x9C, 0xFA, 0x8F, 0xFF, 0xFB, 0x41,
-    0x76, 0xF3, 0xC0, 0x41, 0x76, 0xE8, 0x54, 0x41, 0x78, 0xE8, 0x50, 0x22, 0x6F, 0x61, 0xF8, 0xFC,
-    0x21, 0x69, 0xFB, 0x41, 0x72, 0xF2, 0x20, 0x21, 0x74, 0xFC, 0x45, 0x63, 0x65, 0x76, 0x6E, 0x73,
-    0xF2, 0x5E, 0xFF, 0xE5, 0xF2, 0x5E, 0xFF, 0xF6, 0xFF, 0xFD, 0x42, 0x6E, 0x73, 0xE9, 0xBA, 0xE9,
-    0xBA, 0x21, 0x69, 0xF9, 0x21, 0x6C, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x69, 0xFD, 0xC2, 0x00, 0xE1,
-    0x63, 0x6E, 0xF3, 0x82, 0xFF, 0xFD, 0xC2, 0x00, 0xE1, 0x6C, 0x64, 0xF4, 0x69, 0xF9, 0xE8, 0x41,
-    0x74, 0xF7, 0x1B, 0x21, 0x6F, 0xFC, 0x21, 0x70, 0xFD, 0x21, 0x69, 0xFD, 0x42, 0x72, 0x2E, 0xFF,
-    0xFD, 0xF2, 0x88, 0x42, 0x69, 0x74, 0xEF, 0x79, 0xFF, 0xF9, 0xC3, 0x00, 0xE1, 0x6E, 0x2E, 0x73,
-    0xFF, 0xF9, 0xF2, 0x74, 0xF2, 0x77, 0x41, 0x69, 0xE7, 0x51, 0x21, 0x6B, 0xFC, 0x21, 0x73, 0xFD,
-    0x21, 0x6F, 0xFD, 0xA1, 0x00, 0xE1, 0x6C, 0xFD, 0x47, 0xA2, 0xA9, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB,
-    0xF0, 0xFD, 0xFF, 0xFB, 0xF0, 0xFD, 0xF0, 0xFD, 0xF0, 0xFD, 0xF0, 0xFD, 0xF0, 0xFD, 0x41, 0x6D,
-    0xE9, 0xDD, 0x21, 0x61, 0xFC, 0x21, 0x74, 0xFD, 0xA1, 0x00, 0xE1, 0x6C, 0xFD, 0x48, 0x61, 0x69,
-    0x65, 0xC3, 0x6F, 0x72, 0x75, 0x79, 0xFF, 0x90, 0xFF, 0x99, 0xFF, 0xBD, 0xFF, 0xDB, 0xFF, 0xFB,
-    0xF2, 0x50, 0xF0, 0xD8, 0xF0, 0xD8, 0xA0, 0x01, 0xD1, 0x21, 0x6E, 0xFD, 0x21, 0x6F, 0xFD, 0x42,
-    0x69, 0x75, 0xFF, 0xFD, 0xF0, 0xF8, 0x41, 0x72, 0xF6, 0xE9, 0xA1, 0x00, 0xE1, 0x77, 0xFC, 0x48,
-    0xA2, 0xA0, 0xA9, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB, 0xF0, 0xA6, 0xF0, 0xA6, 0xF0, 0xA6, 0xF0, 0xA6,
-    0xF0, 0xA6, 0xF0, 0xA6, 0xF0, 0xA6, 0xF0, 0xA6, 0x41, 0x2E, 0xE6, 0x8A, 0x21, 0x74, 0xFC, 0x21,
-    0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x4A, 0x69, 0x6C, 0x61, 0xC3, 0x65, 0x6F, 0x73, 0x75, 0x79, 0x6D,
-    0xF3, 0xAE, 0xFF, 0xCA, 0xFF, 0xD5, 0xFF, 0xDA, 0xF1, 0xE8, 0xF0, 0x80, 0xF8, 0x95, 0xF0, 0x80,
-    0xF0, 0x80, 0xFF, 0xFD, 0x41, 0x6C, 0xF3, 0x8B, 0x42, 0x69, 0x65, 0xFF, 0xFC, 0xF9, 0xD3, 0xC1,
-    0x00, 0xE2, 0x2E, 0xF1, 0xAF, 0x49, 0x61, 0xC3, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x75, 0x79, 0xF0,
-    0x50, 0xF1, 0x93, 0xF1, 0xB8, 0xFF, 0xFA, 0xF0, 0x50, 0xF0, 0x50, 0xF0, 0x6D, 0xF0, 0x50, 0xF0,
-    0x50, 0x42, 0x61, 0x65, 0xF0, 0x76, 0xF1, 0xA5, 0xA1, 0x00, 0xE1, 0x75, 0xF9, 0x41, 0x69, 0xFA,
-    0x32, 0x21, 0x72, 0xFC, 0xA1, 0x00, 0xE1, 0x74, 0xFD, 0xA0, 0x01, 0xF2, 0x21, 0x2E, 0xFD, 0x22,
-    0x2E, 0x73, 0xFA, 0xFD, 0x21, 0x74, 0xFB, 0x21, 0x61, 0xFD, 0x4A, 0x75, 0x61, 0xC3, 0x65, 0x69,
-    0x6F, 0xC5, 0x73, 0x78, 0x79, 0xFF, 0xEA, 0xF0, 0x0B, 0xF1, 0x4E, 0xF1, 0x73, 0xF0, 0x0B, 0xF0,
-    0x0B, 0xF4, 0x0D, 0xFF, 0xFD, 0xF8, 0x58, 0xF0, 0x0B, 0x41, 0x68, 0xF8, 0x39, 0x21, 0x74, 0xFC,
-    0x42, 0x73, 0x6C, 0xFF, 0xFD, 0xF8, 0x38, 0x41, 0x6F, 0xFD, 0x5C, 0x21, 0x74, 0xFC, 0x22, 0x61,
-    0x73, 0xF2, 0xFD, 0x42, 0xA9, 0xA8, 0xEF, 0xD2, 0xEF, 0xD2, 0x47, 0x61, 0x65, 0xC3, 0x69, 0x6F,
-    0x75, 0x79, 0xEF, 0xCB, 0xF1, 0x33, 0xFF, 0xF9, 0xEF, 0xCB, 0xEF, 0xCB, 0xEF, 0xCB, 0xEF, 0xCB,
-    0x5D, 0x27, 0x2E, 0x61, 0x62, 0xC3, 0x63, 0x6A, 0x6D, 0x72, 0x70, 0x69, 0x65, 0x64, 0x74, 0x66,
-    0x67, 0x73, 0x6F, 0x77, 0x68, 0x75, 0x76, 0x6C, 0x78, 0x6B, 0x71, 0x6E, 0x79, 0x7A, 0xE7, 0xD0,
-    0xEF, 0x48, 0xF0, 0xCD, 0xF1, 0x53, 0xF2, 0x28, 0xF3, 0xD1, 0xF3, 0xFD, 0xF4, 0xAD, 0xF5, 0x6F,
-    0xF7, 0x2F, 0xF8, 0x34, 0xF8, 0x98, 0xF9, 0x32, 0xFA, 0x80, 0xFA, 0xE4, 0xFB, 0x3C, 0xFC, 0xA4,
-    0xFD, 0x6C, 0xFD, 0x97, 0xFE, 0x19, 0xFE, 0x4A, 0xFE, 0xDD, 0xFF, 0x35, 0xFF, 0x58, 0xFF, 0x65,
-    0xFF, 0x88, 0xFF, 0xAA, 0xFF, 0xDE, 0xFF, 0xEA,
+constexpr uint8_t fr_trie_classes[256] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11,
+    0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x20, 0x21, 0x22, 0x23, 0x00, 0x00, 0x00, 0x24, 0x25,
+    0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x28, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+constexpr uint32_t fr_trie_dense[] = {
+    0x00000000u, 0x00000002u, 0x00000022u, 0x00000070u, 0x000000AAu, 0x000000D0u, 0x00000106u, 0x0000013Cu,
+    0x00000152u, 0x0000017Cu, 0x000001AEu, 0x000001CCu, 0x000001F2u, 0x00000202u, 0x00000228u, 0x00000252u,
+    0x0000027Cu, 0x000002A6u, 0x000002D4u, 0x0000030Au, 0x00000312u, 0x0000033Cu, 0x00000372u, 0x000003A0u,
+    0x000003B6u, 0x000003D8u, 0x000003F2u, 0x000003FCu, 0x00000406u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000424u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000043Au,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000462u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000046Eu,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000047Au, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x0000048Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000048Eu,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000492u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x000004B0u, 0x000004D4u, 0x000004DEu, 0x000004F0u, 0x00000462u, 0x00000000u, 0x00000506u,
+    0x00000000u, 0x0000050Cu, 0x00000000u, 0x00000518u, 0x0000051Eu, 0x00000524u, 0x00000536u, 0x0000053Cu,
+    0x0000054Cu, 0x00000000u, 0x00000572u, 0x0000057Cu, 0x0000059Eu, 0x0000048Eu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x0000048Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x000005ACu, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x000005CAu, 0x000005D8u, 0x000005E2u, 0x00000000u,
+    0x00000000u, 0x000005E8u, 0x00000000u, 0x000005EEu, 0x00000000u, 0x00000000u, 0x000005F4u, 0x000005FEu,
+    0x00000604u, 0x00000000u, 0x00000612u, 0x00000000u, 0x0000061Cu, 0x00000626u, 0x00000000u, 0x000005EEu,
+    0x00000630u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000636u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000640u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u,
+    0x00000650u, 0x00000000u, 0x00000000u, 0x00000658u, 0x00000000u, 0x00000000u, 0x00000660u, 0x00000000u,
+    0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x0000066Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000068Au,
+    0x00000000u, 0x0000069Au, 0x00000000u, 0x00000640u, 0x00000000u, 0x00000000u, 0x000006A0u, 0x000006D8u,
+    0x00000000u, 0x000006E0u, 0x00000708u, 0x00000000u, 0x00000000u, 0x00000714u, 0x00000000u, 0x00000000u,
+    0x00000650u, 0x00000000u, 0x00000000u, 0x00000734u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000073Cu,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000066Cu, 0x00000744u, 0x00000000u, 0x0000063Cu,
+    0x00000000u, 0x0000074Au, 0x00000000u, 0x00000000u, 0x00000752u, 0x00000640u, 0x00000000u, 0x00000000u,
+    0x00000758u, 0x00000762u, 0x00000000u, 0x00000000u, 0x00000772u, 0x00000000u, 0x00000000u, 0x0000063Cu,
+    0x00000000u, 0x00000000u, 0x00000650u, 0x00000778u, 0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000077Cu, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x0000079Au, 0x00000000u, 0x00000000u, 0x00000000u, 0x000005EEu, 0x000007A4u, 0x00000000u, 0x000007AEu,
+    0x00000000u, 0x00000000u, 0x000007B4u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000074Au, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000640u, 0x00000000u, 0x00000000u, 0x00000000u, 0x000007BAu, 0x00000000u, 0x00000000u,
+    0x000007C6u, 0x00000000u, 0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u, 0x000007D2u, 0x00000778u,
+    0x00000000u, 0x0000074Au, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x000007DEu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000063Cu,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000640u, 0x00000000u, 0x00000000u, 0x000007FCu, 0x000006D8u,
+    0x00000000u, 0x00000000u, 0x00000650u, 0x00000000u, 0x00000650u, 0x0000063Cu, 0x00000000u, 0x00000000u,
+    0x00000812u, 0x00000778u, 0x00000000u, 0x0000081Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000063Cu,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000066Cu, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000826u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x000006D8u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000063Cu,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000074Au, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000832u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000083Au, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000858u, 0x00000862u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000868u, 0x0000086Eu,
+    0x00000878u, 0x00000892u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000089Cu, 0x00000000u, 0x00000000u,
+    0x000008A6u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000636u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x000008ACu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x000008B2u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x000008C0u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000063Cu,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000640u, 0x00000000u, 0x00000000u, 0x000008C4u, 0x0000063Cu,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u,
+    0x000008CCu, 0x00000000u, 0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000063Cu,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000066Cu, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x000008D0u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000640u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x000006D8u, 0x00000000u, 0x00000000u, 0x000008D8u, 0x000008E2u, 0x00000000u, 0x0000063Cu,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x000008E8u, 0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x000008EEu, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000826u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000910u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000920u, 0x00000926u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000778u, 0x00000000u, 0x00000932u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x0000093Au, 0x00000744u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000640u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000958u,
+    0x00000000u, 0x0000095Eu, 0x00000000u, 0x00000000u, 0x00000966u, 0x0000063Cu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x0000066Cu, 0x00000744u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x0000096Au, 0x00000970u, 0x00000976u, 0x00000000u, 0x00000000u, 0x0000097Cu, 0x00000000u, 0x00000982u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000988u, 0x00000000u, 0x00000000u, 0x00000996u, 0x00000000u,
+    0x000005EEu, 0x0000099Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x000009A2u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000636u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x000009A8u, 0x00000000u, 0x00000000u, 0x00000000u, 0x000009B4u, 0x00000000u, 0x00000000u,
+    0x000009C8u, 0x0000073Cu, 0x00000000u, 0x00000000u, 0x000009ECu, 0x00000000u, 0x000009F8u, 0x00000A02u,
+    0x00000000u, 0x00000000u, 0x00000A0Eu, 0x00000A26u, 0x00000A2Cu, 0x00000A32u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000A42u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000A60u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000A6Au, 0x00000000u, 0x00000630u,
+    0x00000000u, 0x00000A7Au, 0x00000000u, 0x00000000u, 0x00000A92u, 0x00000A9Eu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000630u, 0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000AAAu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000AB2u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000ABAu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000063Cu,
+    0x00000000u, 0x00000AD8u, 0x00000000u, 0x00000AEAu, 0x00000000u, 0x00000000u, 0x00000B02u, 0x0000063Cu,
+    0x00000000u, 0x00000000u, 0x00000B1Eu, 0x00000000u, 0x00000000u, 0x0000063Cu, 0x00000B28u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000B3Eu, 0x00000B5Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000063Cu,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000066Cu, 0x00000744u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000B74u, 0x00000000u, 0x00000B84u, 0x00000000u, 0x00000B8Au, 0x00000000u, 0x00000000u,
+    0x00000BA2u, 0x0000063Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000BC2u,
+    0x00000000u, 0x00000000u, 0x00000BCEu, 0x00000000u, 0x00000976u, 0x00000BE2u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000BF2u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000630u, 0x00000000u, 0x00000C14u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000C1Au, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000C20u, 0x00000000u, 0x00000000u,
+    0x00000630u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000C26u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000C32u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000C42u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000C4Eu, 0x00000000u, 0x00000000u, 0x00000650u, 0x00000000u,
+    0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000C56u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000C74u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000640u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000063Cu,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u,
+    0x000008CCu, 0x00000000u, 0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000C7Cu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000C82u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000C88u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000C92u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000640u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000063Cu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000C98u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x000005EEu, 0x0000063Cu, 0x000005EEu, 0x00000CA2u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x000005EEu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+};
+
+constexpr uint8_t fr_trie_nodes[] = {
+    0x00, 0x00, 0x07, 0x02, 0x9D, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x75, 0x79, 0xC3, 0x3A, 0x04, 0x00,
+    0x62, 0x04, 0x00, 0x6E, 0x04, 0x00, 0x7A, 0x04, 0x00, 0x8E, 0x04, 0x00, 0x8E, 0x04, 0x00, 0x92,
+    0x04, 0x00, 0x13, 0x00, 0x61, 0x62, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+    0x70, 0x72, 0x73, 0x74, 0x75, 0x79, 0xC3, 0xB0, 0x04, 0x00, 0xD4, 0x04, 0x00, 0xDE, 0x04, 0x00,
+    0xF0, 0x04, 0x00, 0x62, 0x04, 0x00, 0x06, 0x05, 0x00, 0x0C, 0x05, 0x00, 0x18, 0x05, 0x00, 0x1E,
+    0x05, 0x00, 0x24, 0x05, 0x00, 0x36, 0x05, 0x00, 0x3C, 0x05, 0x00, 0x4C, 0x05, 0x00, 0x72, 0x05,
+    0x00, 0x7C, 0x05, 0x00, 0x9E, 0x05, 0x00, 0x8E, 0x04, 0x00, 0x8E, 0x04, 0x00, 0xAC, 0x05, 0x00,
+    0x0E, 0x00, 0x62, 0x63, 0x64, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x75, 0x76, 0xC3,
+    0xCA, 0x05, 0x00, 0xD8, 0x05, 0x00, 0xE2, 0x05, 0x00, 0xE8, 0x05, 0x00, 0xEE, 0x05, 0x00, 0xF4,
+    0x05, 0x00, 0xFE, 0x05, 0x00, 0x04, 0x06, 0x00, 0x12, 0x06, 0x00, 0x1C, 0x06, 0x00, 0x26, 0x06,
+    0x00, 0xEE, 0x05, 0x00, 0x30, 0x06, 0x00, 0x36, 0x06, 0x00, 0x09, 0x00, 0x61, 0x65, 0x69, 0x6C,
+    0x6F, 0x72, 0x75, 0x79, 0xC3, 0x3C, 0x06, 0x00, 0x40, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x50, 0x06,
+    0x00, 0x58, 0x06, 0x00, 0x60, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x6C, 0x06, 0x00,
+    0x0D, 0x00, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6F, 0x72, 0x75, 0x79, 0xC3, 0xC5, 0x8A,
+    0x06, 0x00, 0x9A, 0x06, 0x00, 0x40, 0x06, 0x00, 0xA0, 0x06, 0x00, 0xD8, 0x06, 0x00, 0xE0, 0x06,
+    0x00, 0x08, 0x07, 0x00, 0x14, 0x07, 0x00, 0x50, 0x06, 0x00, 0x34, 0x07, 0x00, 0x3C, 0x07, 0x00,
+    0x6C, 0x06, 0x00, 0x44, 0x07, 0x00, 0x0D, 0x00, 0x27, 0x61, 0x64, 0x65, 0x68, 0x69, 0x6C, 0x6F,
+    0x72, 0x73, 0x75, 0x79, 0xC3, 0x3C, 0x06, 0x00, 0x4A, 0x07, 0x00, 0x52, 0x07, 0x00, 0x40, 0x06,
+    0x00, 0x58, 0x07, 0x00, 0x62, 0x07, 0x00, 0x72, 0x07, 0x00, 0x3C, 0x06, 0x00, 0x50, 0x06, 0x00,
+    0x78, 0x07, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x7C, 0x07, 0x00, 0x05, 0x00, 0x6E, 0x72,
+    0x73, 0x75, 0x78, 0x9A, 0x07, 0x00, 0xEE, 0x05, 0x00, 0xA4, 0x07, 0x00, 0xAE, 0x07, 0x00, 0xB4,
+    0x07, 0x00, 0x0A, 0x00, 0x61, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x73, 0x75, 0x79, 0xC3, 0x4A, 0x07,
+    0x00, 0x40, 0x06, 0x00, 0xBA, 0x07, 0x00, 0xC6, 0x07, 0x00, 0x3C, 0x06, 0x00, 0xD2, 0x07, 0x00,
+    0x78, 0x07, 0x00, 0x4A, 0x07, 0x00, 0x3C, 0x06, 0x00, 0xDE, 0x07, 0x00, 0x0C, 0x00, 0x61, 0x65,
+    0x68, 0x69, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x75, 0x79, 0xC3, 0x3C, 0x06, 0x00, 0x40, 0x06, 0x00,
+    0xFC, 0x07, 0x00, 0xD8, 0x06, 0x00, 0x50, 0x06, 0x00, 0x50, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x12,
+    0x08, 0x00, 0x78, 0x07, 0x00, 0x1E, 0x08, 0x00, 0x3C, 0x06, 0x00, 0x6C, 0x06, 0x00, 0x07, 0x00,
+    0x61, 0x65, 0x69, 0x6F, 0x75, 0x79, 0xC3, 0x3C, 0x06, 0x00, 0x26, 0x08, 0x00, 0xD8, 0x06, 0x00,
+    0x3C, 0x06, 0x00, 0x4A, 0x07, 0x00, 0x32, 0x08, 0x00, 0x3A, 0x08, 0x00, 0x09, 0x00, 0x61, 0x62,
+    0x6C, 0x6D, 0x6E, 0x6F, 0x73, 0x76, 0xC3, 0x58, 0x08, 0x00, 0x62, 0x08, 0x00, 0x68, 0x08, 0x00,
+    0x6E, 0x08, 0x00, 0x78, 0x08, 0x00, 0x92, 0x08, 0x00, 0x9C, 0x08, 0x00, 0xA6, 0x08, 0x00, 0x36,
+    0x06, 0x00, 0x03, 0x01, 0x00, 0x00, 0x61, 0x65, 0x6B, 0xAC, 0x08, 0x00, 0xB2, 0x08, 0x00, 0xC0,
+    0x08, 0x00, 0x09, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x75, 0x79, 0xC3, 0x3C, 0x06, 0x00,
+    0x40, 0x06, 0x00, 0xC4, 0x08, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0xCC, 0x08, 0x00, 0x3C,
+    0x06, 0x00, 0x3C, 0x06, 0x00, 0x6C, 0x06, 0x00, 0x0A, 0x00, 0x61, 0x65, 0x69, 0x6C, 0x6D, 0x6F,
+    0x73, 0x75, 0x79, 0xC3, 0xD0, 0x08, 0x00, 0x40, 0x06, 0x00, 0xD8, 0x06, 0x00, 0xD8, 0x08, 0x00,
+    0xE2, 0x08, 0x00, 0x3C, 0x06, 0x00, 0xE8, 0x08, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0xEE,
+    0x08, 0x00, 0x0A, 0x00, 0x61, 0x65, 0x69, 0x6E, 0x6F, 0x73, 0x75, 0x79, 0xC3, 0xC5, 0x3C, 0x06,
+    0x00, 0x26, 0x08, 0x00, 0x10, 0x09, 0x00, 0x20, 0x09, 0x00, 0x26, 0x09, 0x00, 0x78, 0x07, 0x00,
+    0x32, 0x09, 0x00, 0x3C, 0x06, 0x00, 0x3A, 0x09, 0x00, 0x44, 0x07, 0x00, 0x0A, 0x00, 0x61, 0x65,
+    0x69, 0x6F, 0x73, 0x75, 0x78, 0x79, 0xC3, 0xC5, 0x3C, 0x06, 0x00, 0x40, 0x06, 0x00, 0x3C, 0x06,
+    0x00, 0x3C, 0x06, 0x00, 0x58, 0x09, 0x00, 0x5E, 0x09, 0x00, 0x66, 0x09, 0x00, 0x3C, 0x06, 0x00,
+    0x6C, 0x06, 0x00, 0x44, 0x07, 0x00, 0x0B, 0x00, 0x62, 0x63, 0x64, 0x67, 0x69, 0x6D, 0x70, 0x72,
+    0x73, 0x78, 0xC3, 0x6A, 0x09, 0x00, 0x70, 0x09, 0x00, 0x76, 0x09, 0x00, 0x7C, 0x09, 0x00, 0x82,
+    0x09, 0x00, 0x88, 0x09, 0x00, 0x96, 0x09, 0x00, 0xEE, 0x05, 0x00, 0x9C, 0x09, 0x00, 0xA2, 0x09,
+    0x00, 0x36, 0x06, 0x00, 0x0D, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x74,
+    0x75, 0x79, 0xC3, 0xA8, 0x09, 0x00, 0xB4, 0x09, 0x00, 0xC8, 0x09, 0x00, 0x3C, 0x07, 0x00, 0xEC,
+    0x09, 0x00, 0xF8, 0x09, 0x00, 0x02, 0x0A, 0x00, 0x0E, 0x0A, 0x00, 0x26, 0x0A, 0x00, 0x2C, 0x0A,
+    0x00, 0x32, 0x0A, 0x00, 0x3C, 0x06, 0x00, 0x42, 0x0A, 0x00, 0x01, 0x01, 0x00, 0x00, 0x75, 0x60,
+    0x0A, 0x00, 0x0A, 0x00, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6D, 0x6F, 0x75, 0x79, 0xC3, 0x6A, 0x0A,
+    0x00, 0x30, 0x06, 0x00, 0x7A, 0x0A, 0x00, 0x92, 0x0A, 0x00, 0x9E, 0x0A, 0x00, 0x30, 0x06, 0x00,
+    0x3C, 0x06, 0x00, 0xAA, 0x0A, 0x00, 0xB2, 0x0A, 0x00, 0xBA, 0x0A, 0x00, 0x0D, 0x00, 0x61, 0x63,
+    0x65, 0x68, 0x69, 0x6C, 0x6F, 0x70, 0x74, 0x75, 0x79, 0xC3, 0xC5, 0x3C, 0x06, 0x00, 0xD8, 0x0A,
+    0x00, 0xEA, 0x0A, 0x00, 0x02, 0x0B, 0x00, 0x3C, 0x06, 0x00, 0x1E, 0x0B, 0x00, 0x3C, 0x06, 0x00,
+    0x28, 0x0B, 0x00, 0x3E, 0x0B, 0x00, 0x5C, 0x0B, 0x00, 0x3C, 0x06, 0x00, 0x6C, 0x06, 0x00, 0x44,
+    0x07, 0x00, 0x0B, 0x00, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x74, 0x75, 0x79, 0xC3, 0x74,
+    0x0B, 0x00, 0x84, 0x0B, 0x00, 0x8A, 0x0B, 0x00, 0xA2, 0x0B, 0x00, 0x3C, 0x06, 0x00, 0xC2, 0x0B,
+    0x00, 0xCE, 0x0B, 0x00, 0x76, 0x09, 0x00, 0xE2, 0x0B, 0x00, 0x3C, 0x06, 0x00, 0xF2, 0x0B, 0x00,
+    0x05, 0x00, 0x63, 0x65, 0x6E, 0x73, 0x76, 0x30, 0x06, 0x00, 0x14, 0x0C, 0x00, 0x1A, 0x0C, 0x00,
+    0x20, 0x0C, 0x00, 0x30, 0x06, 0x00, 0x08, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x72, 0x75, 0x79, 0xC3,
+    0x26, 0x0C, 0x00, 0x32, 0x0C, 0x00, 0x42, 0x0C, 0x00, 0x4E, 0x0C, 0x00, 0x50, 0x06, 0x00, 0x3C,
+    0x06, 0x00, 0x3C, 0x06, 0x00, 0x56, 0x0C, 0x00, 0x06, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x72, 0x75,
+    0x74, 0x0C, 0x00, 0x40, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0xCC, 0x08, 0x00, 0x3C,
+    0x06, 0x00, 0x02, 0x00, 0x65, 0x69, 0x7C, 0x0C, 0x00, 0x82, 0x0C, 0x00, 0x02, 0x00, 0x61, 0x73,
+    0x88, 0x0C, 0x00, 0x92, 0x0C, 0x00, 0x07, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x75, 0x79, 0xC3, 0x3C,
+    0x06, 0x00, 0x40, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06,
+    0x00, 0x98, 0x0C, 0x00, 0x05, 0x00, 0xA2, 0xA7, 0xA8, 0xA9, 0xB4, 0xEE, 0x05, 0x00, 0x3C, 0x06,
+    0x00, 0xEE, 0x05, 0x00, 0xA2, 0x0C, 0x00, 0xEE, 0x05, 0x00, 0x09, 0x01, 0x6F, 0x00, 0x62, 0x65,
+    0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0xC4, 0x0C, 0x00, 0xCA, 0x0C, 0x00, 0xD0, 0x0C, 0x00,
+    0xD6, 0x0C, 0x00, 0xDC, 0x0C, 0x00, 0xE2, 0x0C, 0x00, 0xF0, 0x0C, 0x00, 0xF6, 0x0C, 0x00, 0x00,
+    0x0D, 0x00, 0x02, 0x01, 0x6F, 0x00, 0x6E, 0x75, 0x06, 0x0D, 0x00, 0x10, 0x0D, 0x00, 0x02, 0x01,
+    0x6F, 0x00, 0x67, 0x6E, 0x16, 0x0D, 0x00, 0x1C, 0x0D, 0x00, 0x04, 0x01, 0x6F, 0x00, 0x63, 0x6E,
+    0x75, 0x76, 0x42, 0x0D, 0x00, 0x48, 0x0D, 0x00, 0x4E, 0x0D, 0x00, 0x54, 0x0D, 0x00, 0x00, 0x01,
+    0x6F, 0x00, 0x07, 0x00, 0xA2, 0xA8, 0xA9, 0xAA, 0xAE, 0xB4, 0xBB, 0x5A, 0x0D, 0x00, 0x5A, 0x0D,
+    0x00, 0x5A, 0x0D, 0x00, 0x5A, 0x0D, 0x00, 0x5A, 0x0D, 0x00, 0x5A, 0x0D, 0x00, 0x5A, 0x0D, 0x00,
+    0x08, 0x01, 0x6F, 0x00, 0x62, 0x65, 0x67, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0xC4, 0x0C, 0x00, 0xCA,
+    0x0C, 0x00, 0xD0, 0x0C, 0x00, 0xDC, 0x0C, 0x00, 0x5E, 0x0D, 0x00, 0xF0, 0x0C, 0x00, 0x68, 0x0D,
+    0x00, 0x00, 0x0D, 0x00, 0x02, 0x00, 0x61, 0x69, 0x76, 0x0D, 0x00, 0x7C, 0x0D, 0x00, 0x04, 0x00,
+    0x68, 0x69, 0x6F, 0x75, 0x8E, 0x0D, 0x00, 0x96, 0x0D, 0x00, 0x9C, 0x0D, 0x00, 0xAA, 0x0D, 0x00,
+    0x05, 0x00, 0x61, 0x69, 0x6F, 0x79, 0xC3, 0xB0, 0x0D, 0x00, 0xB6, 0x0D, 0x00, 0xC4, 0x0D, 0x00,
+    0xCA, 0x0D, 0x00, 0xD0, 0x0D, 0x00, 0x01, 0x00, 0x65, 0xD6, 0x0D, 0x00, 0x02, 0x01, 0x6F, 0x00,
+    0x67, 0x6E, 0x16, 0x0D, 0x00, 0xDC, 0x0D, 0x00, 0x01, 0x00, 0x68, 0x5A, 0x0D, 0x00, 0x01, 0x00,
+    0x61, 0xFE, 0x0D, 0x00, 0x04, 0x00, 0x61, 0x69, 0x6F, 0xC3, 0x04, 0x0E, 0x00, 0x16, 0x0E, 0x00,
+    0x1C, 0x0E, 0x00, 0x22, 0x0E, 0x00, 0x01, 0x00, 0x6F, 0x28, 0x0E, 0x00, 0x03, 0x01, 0x6F, 0x00,
+    0x6E, 0x75, 0x76, 0x48, 0x0D, 0x00, 0x4E, 0x0D, 0x00, 0x54, 0x0D, 0x00, 0x09, 0x00, 0x61, 0x65,
+    0x68, 0x6C, 0x6F, 0x72, 0x73, 0x75, 0xC3, 0x2E, 0x0E, 0x00, 0x3C, 0x0E, 0x00, 0x46, 0x0E, 0x00,
+    0x4E, 0x0E, 0x00, 0x54, 0x0E, 0x00, 0x5E, 0x0E, 0x00, 0x68, 0x0E, 0x00, 0x6E, 0x0E, 0x00, 0x74,
+    0x0E, 0x00, 0x02, 0x00, 0x65, 0xC3, 0x7A, 0x0E, 0x00, 0x80, 0x0E, 0x00, 0x08, 0x00, 0x61, 0x63,
+    0x65, 0x68, 0x6F, 0x74, 0x75, 0x79, 0x86, 0x0E, 0x00, 0x8C, 0x0E, 0x00, 0x92, 0x0E, 0x00, 0x5A,
+    0x0D, 0x00, 0x9C, 0x0E, 0x00, 0xA2, 0x0E, 0x00, 0xAC, 0x0E, 0x00, 0xB6, 0x0E, 0x00, 0x03, 0x00,
+    0x61, 0x68, 0x72, 0xC4, 0x0D, 0x00, 0x5A, 0x0D, 0x00, 0xBC, 0x0E, 0x00, 0x07, 0x00, 0xA2, 0xA8,
+    0xA9, 0xAA, 0xAE, 0xB4, 0xBB, 0x5A, 0x0D, 0x00, 0x5A, 0x0D, 0x00, 0xC2, 0x0E, 0x00, 0x5A, 0x0D,
+    0x00, 0x5A, 0x0D, 0x00, 0x5A, 0x0D, 0x00, 0x5A, 0x0D, 0x00, 0x03, 0x00, 0x68, 0x73, 0xC3, 0xCA,
+    0x0E, 0x00, 0xCE, 0x0E, 0x00, 0xD8, 0x0E, 0x00, 0x02, 0x00, 0x63, 0x71, 0xDE, 0x0E, 0x00, 0xE4,
+    0x0E, 0x00, 0x01, 0x00, 0x68, 0xCA, 0x0E, 0x00, 0x01, 0x00, 0x6E, 0xEA, 0x0E, 0x00, 0x01, 0x00,
+    0x6D, 0xF0, 0x0E, 0x00, 0x02, 0x00, 0x61, 0x63, 0xF6, 0x0E, 0x00, 0xFC, 0x0E, 0x00, 0x01, 0x00,
+    0x61, 0x02, 0x0F, 0x00, 0x03, 0x00, 0x65, 0x69, 0x74, 0x08, 0x0F, 0x00, 0x0E, 0x0F, 0x00, 0x14,
+    0x0F, 0x00, 0x02, 0x00, 0x6F, 0x70, 0x1A, 0x0F, 0x00, 0x20, 0x0F, 0x00, 0x02, 0x00, 0x63, 0x6D,
+    0x26, 0x0F, 0x00, 0x2C, 0x0F, 0x00, 0x02, 0x00, 0x6D, 0x74, 0xF0, 0x0E, 0x00, 0x36, 0x0F, 0x00,
+    0x01, 0x00, 0x69, 0x3C, 0x0F, 0x00, 0x01, 0x00, 0xA8, 0x42, 0x0F, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x03, 0x01, 0x00, 0x00, 0x2E, 0x6E, 0x73, 0x48, 0x0F, 0x00, 0x4C, 0x0F, 0x00, 0x52, 0x0F, 0x00,
+    0x01, 0x02, 0x0A, 0x00, 0x65, 0xB2, 0x08, 0x00, 0x01, 0x01, 0x00, 0x00, 0x75, 0x58, 0x0F, 0x00,
+    0x02, 0x02, 0x0A, 0x00, 0x65, 0x75, 0xB2, 0x08, 0x00, 0x0E, 0x0F, 0x00, 0x07, 0x00, 0xA2, 0xA8,
+    0xA9, 0xAA, 0xAE, 0xB4, 0xBB, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06,
+    0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x03, 0x01, 0x00, 0x00, 0x6F, 0x70,
+    0x72, 0x62, 0x0F, 0x00, 0x68, 0x0F, 0x00, 0x6E, 0x0F, 0x00, 0x01, 0x00, 0x69, 0x74, 0x0F, 0x00,
+    0x0D, 0x02, 0x0A, 0x00, 0x2E, 0x62, 0x65, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74,
+    0x77, 0x48, 0x0F, 0x00, 0xC0, 0x08, 0x00, 0x7A, 0x0F, 0x00, 0xC0, 0x08, 0x00, 0x8C, 0x0F, 0x00,
+    0x92, 0x0F, 0x00, 0xC0, 0x08, 0x00, 0xC0, 0x08, 0x00, 0xC0, 0x08, 0x00, 0x9E, 0x0F, 0x00, 0xC0,
+    0x08, 0x00, 0xC0, 0x08, 0x00, 0xC0, 0x08, 0x00, 0x01, 0x01, 0x00, 0x00, 0x6C, 0xAA, 0x0F, 0x00,
+    0x09, 0x02, 0x0A, 0x00, 0x2E, 0x62, 0x65, 0x66, 0x67, 0x68, 0x70, 0x73, 0x74, 0x48, 0x0F, 0x00,
+    0xC0, 0x08, 0x00, 0xB2, 0x08, 0x00, 0xC0, 0x08, 0x00, 0xC0, 0x08, 0x00, 0xB0, 0x0F, 0x00, 0xC0,
+    0x08, 0x00, 0xC0, 0x08, 0x00, 0xC0, 0x08, 0x00, 0x02, 0x02, 0x0A, 0x00, 0x61, 0x65, 0x0E, 0x0F,
+    0x00, 0xB2, 0x08, 0x00, 0x07, 0x01, 0x00, 0x00, 0x61, 0x65, 0x67, 0x6D, 0x6E, 0x72, 0xC3, 0xB4,
+    0x0F, 0x00, 0xD2, 0x0F, 0x00, 0xE0, 0x0F, 0x00, 0xE6, 0x0F, 0x00, 0xEC, 0x0F, 0x00, 0xFE, 0x0F,
+    0x00, 0x04, 0x10, 0x00, 0x01, 0x01, 0x00, 0x00, 0x72, 0x0A, 0x10, 0x00, 0x01, 0x01, 0x00, 0x00,
+    0x72, 0x68, 0x0F, 0x00, 0x01, 0x00, 0x93, 0x3C, 0x06, 0x00, 0x01, 0x01, 0x00, 0x00, 0x6D, 0xF0,
+    0x0E, 0x00, 0x01, 0x00, 0x68, 0x78, 0x07, 0x00, 0x02, 0x00, 0x61, 0x6F, 0x10, 0x10, 0x00, 0x16,
+    0x10, 0x00, 0x03, 0x01, 0x00, 0x00, 0x61, 0x6C, 0x73, 0x1C, 0x10, 0x00, 0x22, 0x10, 0x00, 0x28,
+    0x10, 0x00, 0x01, 0x00, 0x65, 0x7C, 0x0C, 0x00, 0x00, 0x02, 0x03, 0x00, 0x07, 0x00, 0xA2, 0xA8,
+    0xA9, 0xAA, 0xAE, 0xB4, 0xBB, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x36, 0x10, 0x00, 0x3C, 0x06,
+    0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x02, 0x00, 0x69, 0x74, 0x42, 0x10,
+    0x00, 0x48, 0x10, 0x00, 0x02, 0x00, 0x63, 0x74, 0x4E, 0x10, 0x00, 0x5C, 0x10, 0x00, 0x01, 0x00,
+    0x73, 0x62, 0x10, 0x00, 0x01, 0x00, 0x74, 0x68, 0x10, 0x00, 0x02, 0x01, 0x00, 0x00, 0x63, 0x72,
+    0x6E, 0x10, 0x00, 0x0E, 0x0F, 0x00, 0x02, 0x02, 0x0A, 0x00, 0x61, 0x65, 0xD6, 0x0D, 0x00, 0xB2,
+    0x08, 0x00, 0x02, 0x02, 0x0A, 0x00, 0x65, 0x69, 0xB2, 0x08, 0x00, 0x74, 0x10, 0x00, 0x07, 0x00,
+    0xA2, 0xA8, 0xA9, 0xAA, 0xAE, 0xB4, 0xBB, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x7A, 0x10, 0x00,
+    0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x05, 0x00, 0x61, 0x65,
+    0x69, 0x6F, 0x79, 0xCC, 0x08, 0x00, 0xCC, 0x08, 0x00, 0xCC, 0x08, 0x00, 0xCC, 0x08, 0x00, 0xCC,
+    0x08, 0x00, 0x02, 0x02, 0x0A, 0x00, 0x61, 0x65, 0x82, 0x10, 0x00, 0xB2, 0x08, 0x00, 0x01, 0x01,
+    0x00, 0x00, 0x65, 0xB2, 0x08, 0x00, 0x02, 0x01, 0x00, 0x00, 0x2E, 0x73, 0x48, 0x0F, 0x00, 0x52,
+    0x0F, 0x00, 0x01, 0x01, 0x00, 0x00, 0x70, 0x8C, 0x10, 0x00, 0x07, 0x00, 0xA2, 0xA8, 0xA9, 0xAA,
+    0xAE, 0xB4, 0xBB, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x96, 0x10, 0x00, 0x3C, 0x06, 0x00, 0x3C,
+    0x06, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x02, 0x00, 0x6C, 0x72, 0x9E, 0x10, 0x00, 0xA4,
+    0x10, 0x00, 0x01, 0x00, 0x72, 0x68, 0x0F, 0x00, 0x01, 0x00, 0x6C, 0xCA, 0x0E, 0x00, 0x02, 0x00,
+    0x6D, 0x70, 0xAA, 0x10, 0x00, 0xB4, 0x10, 0x00, 0x06, 0x00, 0x63, 0x64, 0x66, 0x6E, 0x73, 0x74,
+    0xBE, 0x10, 0x00, 0xC4, 0x10, 0x00, 0xD2, 0x10, 0x00, 0xD8, 0x10, 0x00, 0xDE, 0x10, 0x00, 0xE8,
+    0x10, 0x00, 0x02, 0x00, 0x61, 0x78, 0xF2, 0x10, 0x00, 0xF8, 0x10, 0x00, 0x02, 0x00, 0x63, 0x74,
+    0xFE, 0x10, 0x00, 0x08, 0x11, 0x00, 0x01, 0x00, 0x61, 0xC4, 0x0D, 0x00, 0x01, 0x00, 0x63, 0xDE,
+    0x0E, 0x00, 0x03, 0x00, 0x2E, 0x6E, 0x73, 0x48, 0x0F, 0x00, 0x4C, 0x0F, 0x00, 0x52, 0x0F, 0x00,
+    0x00, 0x01, 0x01, 0x00, 0x01, 0x02, 0x0A, 0x00, 0x2E, 0x48, 0x0F, 0x00, 0x00, 0x02, 0x0A, 0x00,
+    0x01, 0x01, 0x00, 0x00, 0x77, 0x0E, 0x11, 0x00, 0x02, 0x00, 0x69, 0x75, 0x14, 0x11, 0x00, 0x0E,
+    0x0F, 0x00, 0x01, 0x00, 0x65, 0x1A, 0x11, 0x00, 0x01, 0x00, 0x74, 0x78, 0x07, 0x00, 0x08, 0x00,
+    0xA0, 0xA2, 0xA8, 0xA9, 0xAA, 0xAE, 0xB4, 0xBB, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06,
+    0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00,
+    0x03, 0x01, 0x00, 0x00, 0x6C, 0x6D, 0x74, 0x20, 0x11, 0x00, 0xF0, 0x0E, 0x00, 0xFE, 0x0D, 0x00,
+    0x01, 0x00, 0xC3, 0x26, 0x11, 0x00, 0x02, 0x01, 0x00, 0x00, 0x6E, 0x79, 0x30, 0x11, 0x00, 0x3A,
+    0x11, 0x00, 0x01, 0x01, 0x00, 0x00, 0x6E, 0x40, 0x11, 0x00, 0x07, 0x00, 0xA2, 0xA8, 0xA9, 0xAA,
+    0xAE, 0xB4, 0xBB, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x46, 0x11, 0x00, 0x3C, 0x06, 0x00, 0x3C,
+    0x06, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x01, 0x00, 0x61, 0x4E, 0x11, 0x00, 0x01, 0x01,
+    0x00, 0x00, 0x74, 0x54, 0x11, 0x00, 0x00, 0x01, 0x05, 0x00, 0x01, 0x00, 0x6C, 0x5A, 0x11, 0x00,
+    0x01, 0x00, 0x74, 0x60, 0x11, 0x00, 0x01, 0x00, 0x6C, 0x78, 0x07, 0x00, 0x01, 0x00, 0x6E, 0x66,
+    0x11, 0x00, 0x01, 0x00, 0x6F, 0x6C, 0x11, 0x00, 0x03, 0x00, 0x62, 0x6D, 0x6E, 0x72, 0x11, 0x00,
+    0xF0, 0x0E, 0x00, 0x78, 0x11, 0x00, 0x01, 0x00, 0x75, 0xC4, 0x0D, 0x00, 0x01, 0x00, 0x74, 0x7E,
+    0x11, 0x00, 0x01, 0x00, 0x79, 0x94, 0x11, 0x00, 0x02, 0x01, 0x00, 0x00, 0x6C, 0x70, 0x9A, 0x11,
+    0x00, 0xA0, 0x11, 0x00, 0x04, 0x01, 0x00, 0x00, 0x2E, 0x6E, 0x72, 0x73, 0x48, 0x0F, 0x00, 0x4C,
+    0x0F, 0x00, 0xA6, 0x11, 0x00, 0x52, 0x0F, 0x00, 0x08, 0x02, 0x0A, 0x00, 0x2E, 0x65, 0x6C, 0x6E,
+    0x6F, 0x72, 0x73, 0x74, 0x48, 0x0F, 0x00, 0xB2, 0x08, 0x00, 0xB4, 0x11, 0x00, 0xC0, 0x08, 0x00,
+    0xBC, 0x11, 0x00, 0xB4, 0x11, 0x00, 0xC0, 0x08, 0x00, 0xC2, 0x11, 0x00, 0x02, 0x02, 0x0A, 0x00,
+    0x65, 0x75, 0xB2, 0x08, 0x00, 0x0E, 0x0F, 0x00, 0x02, 0x00, 0x65, 0xC3, 0xCE, 0x11, 0x00, 0xD4,
+    0x11, 0x00, 0x02, 0x01, 0x00, 0x00, 0x61, 0x6C, 0xDA, 0x11, 0x00, 0xE0, 0x11, 0x00, 0x05, 0x02,
+    0x0A, 0x00, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xB2, 0x08, 0x00, 0xE6, 0x11, 0x00, 0xEC, 0x11, 0x00,
+    0x74, 0x0F, 0x00, 0xF6, 0x11, 0x00, 0x01, 0x00, 0x79, 0xFC, 0x11, 0x00, 0x01, 0x00, 0xC3, 0x02,
+    0x12, 0x00, 0x03, 0x01, 0x00, 0x00, 0x67, 0x70, 0x73, 0x0C, 0x12, 0x00, 0x68, 0x0F, 0x00, 0x68,
+    0x0F, 0x00, 0x07, 0x00, 0xA2, 0xA8, 0xA9, 0xAA, 0xAE, 0xB4, 0xBB, 0x3C, 0x06, 0x00, 0x3C, 0x06,
+    0x00, 0x12, 0x12, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00,
+    0x02, 0x00, 0x61, 0x65, 0x0E, 0x0F, 0x00, 0xB2, 0x08, 0x00, 0x03, 0x01, 0x00, 0x00, 0x64, 0x69,
+    0x6D, 0x1E, 0x12, 0x00, 0x24, 0x12, 0x00, 0xF0, 0x0E, 0x00, 0x05, 0x01, 0x00, 0x00, 0x2E, 0x6C,
+    0x6E, 0x70, 0x73, 0x48, 0x0F, 0x00, 0x2A, 0x12, 0x00, 0x4C, 0x0F, 0x00, 0xDE, 0x0E, 0x00, 0x52,
+    0x0F, 0x00, 0x02, 0x02, 0x0A, 0x00, 0x65, 0x79, 0x34, 0x12, 0x00, 0x42, 0x12, 0x00, 0x02, 0x01,
+    0x00, 0x00, 0x6D, 0x6E, 0xF0, 0x0E, 0x00, 0x48, 0x12, 0x00, 0x01, 0x01, 0x00, 0x00, 0x6C, 0xDE,
+    0x0E, 0x00, 0x01, 0x01, 0x00, 0x00, 0x74, 0x4E, 0x12, 0x00, 0x07, 0x00, 0xA2, 0xA8, 0xA9, 0xAA,
+    0xAE, 0xB4, 0xBB, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x54, 0x12, 0x00, 0x3C, 0x06, 0x00, 0x3C,
+    0x06, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x04, 0x00, 0x61, 0x68, 0x6C, 0x6F, 0x68, 0x12,
+    0x00, 0x6E, 0x12, 0x00, 0x7E, 0x12, 0x00, 0x84, 0x12, 0x00, 0x05, 0x01, 0x00, 0x00, 0x2E, 0x6D,
+    0x6E, 0x72, 0x73, 0x48, 0x0F, 0x00, 0x8A, 0x12, 0x00, 0x4C, 0x0F, 0x00, 0xF6, 0x0C, 0x00, 0x90,
+    0x12, 0x00, 0x06, 0x02, 0x0A, 0x00, 0x2E, 0x65, 0x6D, 0x6F, 0x72, 0x73, 0x48, 0x0F, 0x00, 0xB2,
+    0x08, 0x00, 0xC0, 0x08, 0x00, 0x9A, 0x12, 0x00, 0xC0, 0x08, 0x00, 0xC0, 0x08, 0x00, 0x02, 0x00,
+    0x61, 0x6F, 0xA0, 0x12, 0x00, 0xAA, 0x12, 0x00, 0x05, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0xB0,
+    0x12, 0x00, 0xB6, 0x12, 0x00, 0x2C, 0x0A, 0x00, 0xBC, 0x12, 0x00, 0xC6, 0x12, 0x00, 0x07, 0x00,
+    0x61, 0x65, 0x69, 0x6F, 0x72, 0x79, 0xC3, 0xCC, 0x12, 0x00, 0xD2, 0x12, 0x00, 0xD8, 0x12, 0x00,
+    0xDE, 0x12, 0x00, 0xE8, 0x12, 0x00, 0xF2, 0x12, 0x00, 0xF8, 0x12, 0x00, 0x05, 0x01, 0x00, 0x00,
+    0x62, 0x63, 0x6D, 0x70, 0x72, 0xFE, 0x12, 0x00, 0x08, 0x13, 0x00, 0xF0, 0x0E, 0x00, 0x0E, 0x13,
+    0x00, 0x14, 0x13, 0x00, 0x03, 0x01, 0x00, 0x00, 0x63, 0x6D, 0x6E, 0x1E, 0x13, 0x00, 0xF0, 0x0E,
+    0x00, 0x48, 0x12, 0x00, 0x01, 0x00, 0x68, 0x24, 0x13, 0x00, 0x05, 0x01, 0x00, 0x00, 0x2E, 0x6D,
+    0x6E, 0x72, 0x73, 0x48, 0x0F, 0x00, 0x2A, 0x13, 0x00, 0x4C, 0x0F, 0x00, 0x48, 0x12, 0x00, 0x30,
+    0x13, 0x00, 0x07, 0x02, 0x0A, 0x00, 0x2E, 0x65, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x48, 0x0F, 0x00,
+    0x3A, 0x13, 0x00, 0xC0, 0x08, 0x00, 0xC0, 0x08, 0x00, 0xC0, 0x08, 0x00, 0x4C, 0x13, 0x00, 0xC0,
+    0x08, 0x00, 0x02, 0x01, 0x00, 0x00, 0x6D, 0x72, 0xF0, 0x0E, 0x00, 0x0A, 0x10, 0x00, 0x04, 0x02,
+    0x0A, 0x00, 0x61, 0x65, 0x69, 0x75, 0x58, 0x13, 0x00, 0xB2, 0x08, 0x00, 0x74, 0x0F, 0x00, 0x08,
+    0x13, 0x00, 0x03, 0x01, 0x00, 0x00, 0x6D, 0x6E, 0x72, 0xF0, 0x0E, 0x00, 0x5E, 0x13, 0x00, 0x64,
+    0x13, 0x00, 0x08, 0x00, 0xA0, 0xA2, 0xA8, 0xA9, 0xAA, 0xAE, 0xB4, 0xBB, 0x3C, 0x06, 0x00, 0x3C,
+    0x06, 0x00, 0x3C, 0x06, 0x00, 0x6A, 0x13, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06,
+    0x00, 0x3C, 0x06, 0x00, 0x01, 0x00, 0x76, 0x8A, 0x12, 0x00, 0x01, 0x00, 0x69, 0x72, 0x13, 0x00,
+    0x01, 0x00, 0x74, 0x7C, 0x13, 0x00, 0x02, 0x01, 0x00, 0x00, 0x63, 0x6E, 0x8A, 0x12, 0x00, 0x82,
+    0x13, 0x00, 0x03, 0x01, 0x00, 0x00, 0x2E, 0x6E, 0x73, 0x48, 0x0F, 0x00, 0x88, 0x13, 0x00, 0x52,
+    0x0F, 0x00, 0x02, 0x01, 0x00, 0x00, 0x64, 0x6C, 0x5C, 0x10, 0x00, 0xAA, 0x0F, 0x00, 0x01, 0x01,
+    0x00, 0x00, 0x6C, 0x92, 0x13, 0x00, 0x07, 0x00, 0xA2, 0xA8, 0xA9, 0xAA, 0xAE, 0xB4, 0xBB, 0x3C,
+    0x06, 0x00, 0x3C, 0x06, 0x00, 0x98, 0x13, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x3C, 0x06,
+    0x00, 0x3C, 0x06, 0x00, 0x01, 0x01, 0x00, 0x00, 0x67, 0xA0, 0x13, 0x00, 0x01, 0x00, 0x6E, 0x4C,
+    0x0F, 0x00, 0x01, 0x00, 0x6C, 0xAA, 0x0F, 0x00, 0x02, 0x00, 0x6C, 0x73, 0x9E, 0x10, 0x00, 0xA6,
+    0x13, 0x00, 0x01, 0x00, 0x74, 0xAC, 0x13, 0x00, 0x02, 0x00, 0xA8, 0xA9, 0x3C, 0x06, 0x00, 0x3C,
+    0x06, 0x00, 0x08, 0x00, 0x63, 0x64, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0xB2, 0x13, 0x00, 0xC0,
+    0x13, 0x00, 0xCE, 0x13, 0x00, 0x8A, 0x12, 0x00, 0xE0, 0x13, 0x00, 0xEA, 0x13, 0x00, 0xF0, 0x13,
+    0x00, 0xDE, 0x0E, 0x00, 0x01, 0x00, 0x72, 0xF6, 0x13, 0x00, 0x01, 0x00, 0x73, 0xFC, 0x13, 0x00,
+    0x01, 0x00, 0x6E, 0x02, 0x14, 0x00, 0x01, 0x00, 0x63, 0x08, 0x14, 0x00, 0x01, 0x00, 0x69, 0x0E,
+    0x14, 0x00, 0x03, 0x00, 0x61, 0x65, 0x74, 0x14, 0x14, 0x00, 0x1A, 0x14, 0x00, 0x20, 0x14, 0x00,
+    0x01, 0x00, 0x6F, 0x26, 0x14, 0x00, 0x02, 0x00, 0x67, 0x70, 0x2C, 0x14, 0x00, 0x2C, 0x14, 0x00,
+    0x01, 0x00, 0x74, 0x32, 0x14, 0x00, 0x02, 0x00, 0x61, 0x6F, 0x38, 0x14, 0x00, 0x38, 0x14, 0x00,
+    0x01, 0x00, 0x72, 0x3C, 0x14, 0x00, 0x01, 0x00, 0x6E, 0x42, 0x14, 0x00, 0x09, 0x00, 0x61, 0x65,
+    0x66, 0x69, 0x6F, 0x73, 0x74, 0x75, 0xC3, 0x4C, 0x14, 0x00, 0x58, 0x14, 0x00, 0x6C, 0x14, 0x00,
+    0x72, 0x14, 0x00, 0x82, 0x14, 0x00, 0x8E, 0x14, 0x00, 0x94, 0x14, 0x00, 0x9A, 0x14, 0x00, 0xA6,
+    0x14, 0x00, 0x01, 0x00, 0x74, 0xAC, 0x14, 0x00, 0x01, 0x00, 0x67, 0xB2, 0x14, 0x00, 0x01, 0x00,
+    0x61, 0xB8, 0x14, 0x00, 0x01, 0x00, 0x69, 0xBE, 0x14, 0x00, 0x00, 0x01, 0x56, 0x00, 0x02, 0x00,
+    0x61, 0x74, 0x14, 0x14, 0x00, 0x20, 0x14, 0x00, 0x03, 0x00, 0x64, 0x67, 0x70, 0x2C, 0x14, 0x00,
+    0x2C, 0x14, 0x00, 0x2C, 0x14, 0x00, 0x01, 0x00, 0x69, 0xC4, 0x14, 0x00, 0x04, 0x00, 0x61, 0x6F,
+    0x73, 0x75, 0xCA, 0x14, 0x00, 0xD8, 0x14, 0x00, 0x3C, 0x14, 0x00, 0x38, 0x14, 0x00, 0x01, 0x01,
+    0x56, 0x00, 0xC3, 0xDE, 0x14, 0x00, 0x01, 0x00, 0x73, 0xE4, 0x14, 0x00, 0x03, 0x00, 0x6D, 0x6E,
+    0x6F, 0xEA, 0x14, 0x00, 0xF0, 0x14, 0x00, 0xFC, 0x14, 0x00, 0x01, 0x00, 0x6C, 0x04, 0x15, 0x00,
+    0x01, 0x00, 0x63, 0x08, 0x15, 0x00, 0x03, 0x00, 0x61, 0x65, 0x73, 0x0E, 0x15, 0x00, 0x20, 0x15,
+    0x00, 0x26, 0x15, 0x00, 0x01, 0x00, 0x6C, 0x2C, 0x14, 0x00, 0x01, 0x00, 0x73, 0x2C, 0x15, 0x00,
+    0x01, 0x00, 0xA9, 0x40, 0x15, 0x00, 0x01, 0x00, 0x6D, 0x52, 0x15, 0x00, 0x08, 0x00, 0x61, 0x65,
+    0x69, 0x6F, 0x73, 0x74, 0x75, 0xC3, 0x4C, 0x14, 0x00, 0x58, 0x14, 0x00, 0x72, 0x14, 0x00, 0x82,
+    0x14, 0x00, 0x8E, 0x14, 0x00, 0x94, 0x14, 0x00, 0x9A, 0x14, 0x00, 0xA6, 0x14, 0x00, 0x01, 0x00,
+    0x74, 0x2C, 0x14, 0x00, 0x04, 0x00, 0x63, 0x67, 0x6C, 0x72, 0x58, 0x15, 0x00, 0x62, 0x15, 0x00,
+    0x68, 0x15, 0x00, 0x7A, 0x15, 0x00, 0x01, 0x00, 0x6C, 0x80, 0x15, 0x00, 0x01, 0x00, 0x6E, 0x86,
+    0x15, 0x00, 0x01, 0x00, 0xA9, 0x8C, 0x15, 0x00, 0x01, 0x00, 0x6E, 0x9A, 0x15, 0x00, 0x03, 0x00,
+    0x6E, 0x72, 0x74, 0xA0, 0x15, 0x00, 0xAE, 0x15, 0x00, 0x2C, 0x14, 0x00, 0x02, 0x00, 0x6E, 0x72,
+    0xBC, 0x15, 0x00, 0xC2, 0x15, 0x00, 0x01, 0x01, 0x56, 0x00, 0x61, 0xDE, 0x15, 0x00, 0x01, 0x00,
+    0x75, 0xE4, 0x15, 0x00, 0x02, 0x00, 0x6E, 0x73, 0xEA, 0x15, 0x00, 0xF0, 0x15, 0x00, 0x02, 0x00,
+    0x6F, 0xC3, 0xF6, 0x15, 0x00, 0x08, 0x16, 0x00, 0x01, 0x00, 0x79, 0x0E, 0x16, 0x00, 0x01, 0x00,
+    0x64, 0x14, 0x16, 0x00, 0x01, 0x00, 0xA9, 0x1A, 0x16, 0x00, 0x01, 0x00, 0x73, 0x20, 0x16, 0x00,
+    0x01, 0x00, 0xA9, 0x38, 0x16, 0x00, 0x01, 0x00, 0x72, 0xEA, 0x14, 0x00, 0x01, 0x00, 0x68, 0x04,
+    0x15, 0x00, 0x02, 0x00, 0x72, 0x75, 0xEA, 0x14, 0x00, 0x56, 0x16, 0x00, 0x01, 0x00, 0x75, 0x5C,
+    0x16, 0x00, 0x02, 0x00, 0x61, 0x69, 0x62, 0x16, 0x00, 0x68, 0x16, 0x00, 0x02, 0x00, 0x62, 0x72,
+    0x6E, 0x16, 0x00, 0x84, 0x16, 0x00, 0x01, 0x00, 0x6E, 0x9E, 0x16, 0x00, 0x01, 0x00, 0x69, 0xA4,
+    0x16, 0x00, 0x01, 0x01, 0x56, 0x00, 0x6D, 0xAE, 0x16, 0x00, 0x00, 0x01, 0x25, 0x00, 0x02, 0x00,
+    0x65, 0x74, 0xB4, 0x16, 0x00, 0xAE, 0x16, 0x00, 0x01, 0x00, 0xAE, 0x52, 0x15, 0x00, 0x01, 0x00,
+    0x65, 0xB4, 0x16, 0x00, 0x01, 0x00, 0x75, 0xBA, 0x16, 0x00, 0x01, 0x00, 0x6F, 0xC0, 0x16, 0x00,
+    0x01, 0x00, 0x65, 0xC6, 0x16, 0x00, 0x01, 0x00, 0x6C, 0xCC, 0x16, 0x00, 0x01, 0x00, 0x6F, 0xD2,
+    0x16, 0x00, 0x01, 0x00, 0x6C, 0xD8, 0x16, 0x00, 0x01, 0x00, 0x73, 0xDE, 0x16, 0x00, 0x01, 0x00,
+    0x6D, 0xE4, 0x16, 0x00, 0x01, 0x00, 0x69, 0xEA, 0x16, 0x00, 0x01, 0x00, 0x73, 0xF0, 0x16, 0x00,
+    0x01, 0x00, 0x61, 0xF6, 0x16, 0x00, 0x01, 0x00, 0x68, 0xFC, 0x16, 0x00, 0x02, 0x00, 0x65, 0x69,
+    0xC6, 0x16, 0x00, 0x02, 0x17, 0x00, 0x01, 0x00, 0x72, 0x08, 0x17, 0x00, 0x01, 0x00, 0x6C, 0xAA,
+    0x0D, 0x00, 0x01, 0x00, 0x64, 0x0E, 0x17, 0x00, 0x00, 0x01, 0x02, 0x00, 0x01, 0x00, 0x74, 0x14,
+    0x17, 0x00, 0x01, 0x00, 0x2E, 0x48, 0x0F, 0x00, 0x02, 0x00, 0x6D, 0x74, 0xE4, 0x16, 0x00, 0x1A,
+    0x17, 0x00, 0x01, 0x00, 0x75, 0x20, 0x17, 0x00, 0x01, 0x00, 0x69, 0x68, 0x16, 0x00, 0x01, 0x00,
+    0xC3, 0x26, 0x17, 0x00, 0x01, 0x00, 0x64, 0x2C, 0x14, 0x00, 0x04, 0x00, 0x2E, 0x6E, 0x73, 0x76,
+    0x48, 0x0F, 0x00, 0x4C, 0x0F, 0x00, 0x52, 0x0F, 0x00, 0x2C, 0x17, 0x00, 0x01, 0x00, 0x65, 0x32,
+    0x17, 0x00, 0x02, 0x01, 0x25, 0x00, 0x65, 0x6F, 0x38, 0x17, 0x00, 0x42, 0x17, 0x00, 0x02, 0x01,
+    0x25, 0x00, 0x65, 0x6F, 0x38, 0x17, 0x00, 0x52, 0x15, 0x00, 0x01, 0x00, 0x6C, 0x48, 0x17, 0x00,
+    0x00, 0x02, 0x59, 0x00, 0x07, 0x00, 0x63, 0x64, 0x70, 0x72, 0x73, 0x75, 0x78, 0x4C, 0x17, 0x00,
+    0x56, 0x17, 0x00, 0x5A, 0x17, 0x00, 0x5A, 0x17, 0x00, 0x5E, 0x17, 0x00, 0x5A, 0x17, 0x00, 0x5A,
+    0x17, 0x00, 0x03, 0x00, 0x66, 0x6E, 0x78, 0x5A, 0x17, 0x00, 0x5A, 0x17, 0x00, 0x5A, 0x17, 0x00,
+    0x01, 0x00, 0x6E, 0x64, 0x17, 0x00, 0x01, 0x00, 0x70, 0x6A, 0x17, 0x00, 0x04, 0x00, 0x66, 0x6E,
+    0x74, 0x75, 0x70, 0x17, 0x00, 0x76, 0x17, 0x00, 0x7C, 0x17, 0x00, 0x82, 0x17, 0x00, 0x01, 0x00,
+    0x70, 0x88, 0x17, 0x00, 0x01, 0x00, 0xA9, 0x8E, 0x17, 0x00, 0x01, 0x00, 0x72, 0x2C, 0x14, 0x00,
+    0x01, 0x00, 0x6C, 0x92, 0x17, 0x00, 0x01, 0x00, 0x75, 0x96, 0x17, 0x00, 0x01, 0x00, 0x70, 0x9C,
+    0x17, 0x00, 0x01, 0x00, 0x69, 0xA2, 0x17, 0x00, 0x03, 0x00, 0x63, 0x73, 0x74, 0xA8, 0x17, 0x00,
+    0x70, 0x17, 0x00, 0x1A, 0x17, 0x00, 0x02, 0x01, 0x00, 0x00, 0x63, 0x74, 0xAE, 0x17, 0x00, 0xB4,
+    0x17, 0x00, 0x01, 0x00, 0x76, 0xBA, 0x17, 0x00, 0x01, 0x00, 0x72, 0xC0, 0x17, 0x00, 0x03, 0x00,
+    0x65, 0x68, 0x6F, 0xB4, 0x16, 0x00, 0xC6, 0x17, 0x00, 0xCA, 0x17, 0x00, 0x01, 0x00, 0x69, 0x52,
+    0x15, 0x00, 0x01, 0x00, 0x74, 0xD0, 0x17, 0x00, 0x01, 0x00, 0x72, 0xD6, 0x17, 0x00, 0x01, 0x00,
+    0x68, 0xDC, 0x17, 0x00, 0x01, 0x00, 0x74, 0x1A, 0x17, 0x00, 0x01, 0x01, 0x00, 0x00, 0x63, 0x88,
+    0x17, 0x00, 0x02, 0x00, 0x6D, 0x6E, 0x52, 0x15, 0x00, 0xE2, 0x17, 0x00, 0x02, 0x00, 0x65, 0x6F,
+    0xE8, 0x17, 0x00, 0xEE, 0x17, 0x00, 0x01, 0x01, 0x00, 0x00, 0x6D, 0x0C, 0x18, 0x00, 0x01, 0x00,
+    0x67, 0x16, 0x18, 0x00, 0x01, 0x00, 0x74, 0x1C, 0x18, 0x00, 0x02, 0x00, 0x61, 0x69, 0x22, 0x18,
+    0x00, 0x28, 0x18, 0x00, 0x02, 0x00, 0x6F, 0x75, 0x32, 0x18, 0x00, 0x38, 0x18, 0x00, 0x01, 0x00,
+    0x69, 0x38, 0x18, 0x00, 0x03, 0x00, 0x69, 0x6F, 0x75, 0xA2, 0x17, 0x00, 0x3E, 0x18, 0x00, 0x44,
+    0x18, 0x00, 0x01, 0x00, 0x6F, 0x4A, 0x18, 0x00, 0x01, 0x00, 0x6F, 0x50, 0x18, 0x00, 0x02, 0x00,
+    0x6F, 0x74, 0x3E, 0x18, 0x00, 0x1A, 0x17, 0x00, 0x02, 0x00, 0x65, 0x69, 0x56, 0x18, 0x00, 0x52,
+    0x15, 0x00, 0x01, 0x00, 0x63, 0x5C, 0x18, 0x00, 0x01, 0x00, 0x79, 0x66, 0x09, 0x00, 0x02, 0x00,
+    0x65, 0x68, 0xB4, 0x16, 0x00, 0x62, 0x18, 0x00, 0x01, 0x00, 0x61, 0xE8, 0x08, 0x00, 0x01, 0x00,
+    0x72, 0x6C, 0x18, 0x00, 0x01, 0x00, 0x6F, 0x72, 0x18, 0x00, 0x01, 0x00, 0x6E, 0x78, 0x18, 0x00,
+    0x01, 0x00, 0x6C, 0x7E, 0x18, 0x00, 0x02, 0x00, 0xA8, 0xA9, 0x86, 0x18, 0x00, 0x8C, 0x18, 0x00,
+    0x02, 0x00, 0x6F, 0x74, 0x96, 0x18, 0x00, 0x9C, 0x18, 0x00, 0x01, 0x00, 0x65, 0xA2, 0x18, 0x00,
+    0x01, 0x00, 0x69, 0xA8, 0x18, 0x00, 0x01, 0x01, 0x00, 0x00, 0x63, 0xAE, 0x18, 0x00, 0x01, 0x00,
+    0x74, 0xB4, 0x18, 0x00, 0x01, 0x00, 0x72, 0xBE, 0x18, 0x00, 0x01, 0x00, 0x6F, 0xC4, 0x18, 0x00,
+    0x01, 0x00, 0x65, 0xCA, 0x18, 0x00, 0x01, 0x00, 0x6F, 0xD0, 0x18, 0x00, 0x01, 0x00, 0x6E, 0x16,
+    0x18, 0x00, 0x01, 0x00, 0x75, 0xDA, 0x18, 0x00, 0x01, 0x00, 0x69, 0xE0, 0x18, 0x00, 0x05, 0x00,
+    0x61, 0x69, 0x6F, 0x72, 0xC3, 0xEA, 0x18, 0x00, 0xF4, 0x18, 0x00, 0xF4, 0x18, 0x00, 0xFA, 0x18,
+    0x00, 0x04, 0x19, 0x00, 0x01, 0x00, 0x61, 0x38, 0x14, 0x00, 0x01, 0x00, 0xC3, 0x0A, 0x19, 0x00,
+    0x01, 0x00, 0x69, 0x10, 0x19, 0x00, 0x03, 0x00, 0x68, 0x6D, 0x74, 0x48, 0x17, 0x00, 0x16, 0x19,
+    0x00, 0xAE, 0x16, 0x00, 0x01, 0x01, 0x25, 0x00, 0x65, 0x38, 0x17, 0x00, 0x01, 0x00, 0x74, 0x1C,
+    0x19, 0x00, 0x02, 0x01, 0x01, 0x00, 0x61, 0x69, 0x22, 0x19, 0x00, 0x28, 0x19, 0x00, 0x01, 0x00,
+    0x75, 0xCC, 0x08, 0x00, 0x01, 0x00, 0xA9, 0xCC, 0x08, 0x00, 0x01, 0x00, 0x73, 0x2E, 0x19, 0x00,
+    0x01, 0x00, 0x79, 0x34, 0x19, 0x00, 0x01, 0x00, 0x76, 0x56, 0x19, 0x00, 0x02, 0x00, 0x73, 0xC3,
+    0x5C, 0x19, 0x00, 0x62, 0x19, 0x00, 0x01, 0x00, 0xA9, 0x68, 0x19, 0x00, 0x01, 0x00, 0x63, 0x72,
+    0x19, 0x00, 0x02, 0x00, 0xA8, 0xA9, 0x78, 0x19, 0x00, 0x78, 0x19, 0x00, 0x01, 0x00, 0x6E, 0x7E,
+    0x19, 0x00, 0x02, 0x01, 0x00, 0x00, 0x6E, 0x72, 0x84, 0x19, 0x00, 0x8A, 0x19, 0x00, 0x01, 0x00,
+    0x69, 0x90, 0x19, 0x00, 0x01, 0x00, 0x6D, 0x2C, 0x14, 0x00, 0x02, 0x00, 0x65, 0x69, 0xB4, 0x16,
+    0x00, 0x52, 0x15, 0x00, 0x03, 0x00, 0x2E, 0x73, 0x75, 0x48, 0x0F, 0x00, 0x52, 0x0F, 0x00, 0x96,
+    0x19, 0x00, 0x01, 0x00, 0x64, 0x96, 0x19, 0x00, 0x01, 0x00, 0x67, 0x2C, 0x14, 0x00, 0x01, 0x00,
+    0x68, 0x52, 0x15, 0x00, 0x04, 0x01, 0x00, 0x00, 0x67, 0x6D, 0x73, 0x74, 0x2C, 0x14, 0x00, 0x16,
+    0x19, 0x00, 0x9C, 0x19, 0x00, 0xA2, 0x19, 0x00, 0x01, 0x00, 0x70, 0x72, 0x19, 0x00, 0x03, 0x02,
+    0x0A, 0x00, 0x2E, 0x65, 0x73, 0x48, 0x0F, 0x00, 0x38, 0x17, 0x00, 0xC0, 0x08, 0x00, 0x01, 0x00,
+    0xC3, 0xA8, 0x19, 0x00, 0x01, 0x00, 0x70, 0xCC, 0x08, 0x00, 0x01, 0x00, 0x69, 0xAE, 0x19, 0x00,
+    0x02, 0x00, 0x2E, 0x71, 0x48, 0x0F, 0x00, 0xB4, 0x19, 0x00, 0x01, 0x00, 0x6D, 0xBA, 0x19, 0x00,
+    0x02, 0x00, 0x6C, 0x76, 0xBE, 0x19, 0x00, 0xCC, 0x08, 0x00, 0x01, 0x00, 0x76, 0xCC, 0x08, 0x00,
+    0x01, 0x00, 0x74, 0xC4, 0x19, 0x00, 0x01, 0x00, 0x72, 0xCA, 0x19, 0x00, 0x02, 0x00, 0x65, 0x72,
+    0xD0, 0x19, 0x00, 0xD6, 0x19, 0x00, 0x01, 0x00, 0x72, 0xDC, 0x19, 0x00, 0x01, 0x00, 0x6E, 0xE4,
+    0x19, 0x00, 0x01, 0x00, 0x69, 0xEA, 0x19, 0x00, 0x01, 0x00, 0x67, 0xCA, 0x19, 0x00, 0x02, 0x00,
+    0x63, 0x6D, 0xF0, 0x19, 0x00, 0xD6, 0x19, 0x00, 0x02, 0x00, 0x6F, 0x75, 0x68, 0x12, 0x00, 0xF6,
+    0x19, 0x00, 0x01, 0x00, 0x6C, 0xFC, 0x19, 0x00, 0x01, 0x00, 0xA9, 0x02, 0x1A, 0x00, 0x02, 0x00,
+    0x6C, 0x73, 0x08, 0x1A, 0x00, 0x38, 0x14, 0x00, 0x01, 0x00, 0x63, 0x88, 0x17, 0x00, 0x01, 0x00,
+    0x65, 0x0E, 0x1A, 0x00, 0x02, 0x00, 0x61, 0xC3, 0x14, 0x1A, 0x00, 0x62, 0x19, 0x00, 0x01, 0x00,
+    0x68, 0x1A, 0x1A, 0x00, 0x01, 0x00, 0x69, 0x20, 0x1A, 0x00, 0x01, 0x00, 0x70, 0x26, 0x1A, 0x00,
+    0x02, 0x00, 0x2E, 0x74, 0x48, 0x0F, 0x00, 0x2C, 0x1A, 0x00, 0x04, 0x00, 0x2E, 0x72, 0x73, 0x75,
+    0x48, 0x0F, 0x00, 0x32, 0x1A, 0x00, 0x52, 0x0F, 0x00, 0x96, 0x19, 0x00, 0x02, 0x01, 0x25, 0x00,
+    0x65, 0x69, 0x38, 0x17, 0x00, 0x68, 0x16, 0x00, 0x01, 0x00, 0x6E, 0x38, 0x1A, 0x00, 0x01, 0x00,
+    0x67, 0x3E, 0x1A, 0x00, 0x01, 0x00, 0x62, 0x88, 0x17, 0x00, 0x01, 0x01, 0x00, 0x00, 0x6C, 0x44,
+    0x1A, 0x00, 0x02, 0x00, 0x61, 0x6F, 0x4A, 0x1A, 0x00, 0x50, 0x1A, 0x00, 0x01, 0x00, 0x72, 0xC6,
+    0x17, 0x00, 0x01, 0x00, 0x69, 0x56, 0x1A, 0x00, 0x02, 0x00, 0x69, 0x74, 0x52, 0x15, 0x00, 0x5C,
+    0x1A, 0x00, 0x01, 0x00, 0x74, 0x66, 0x1A, 0x00, 0x01, 0x01, 0x00, 0x00, 0x6C, 0x6C, 0x1A, 0x00,
+    0x01, 0x00, 0x6E, 0x72, 0x1A, 0x00, 0x01, 0x00, 0x74, 0x76, 0x1A, 0x00, 0x01, 0x00, 0x6F, 0xF4,
+    0x18, 0x00, 0x03, 0x00, 0x65, 0x69, 0x75, 0xB4, 0x16, 0x00, 0x52, 0x15, 0x00, 0x52, 0x15, 0x00,
+    0x03, 0x00, 0x65, 0x68, 0x72, 0xB4, 0x16, 0x00, 0x7C, 0x1A, 0x00, 0x82, 0x1A, 0x00, 0x04, 0x00,
+    0x65, 0x69, 0x6F, 0xC3, 0x88, 0x1A, 0x00, 0x52, 0x15, 0x00, 0x8E, 0x1A, 0x00, 0x94, 0x1A, 0x00,
+    0x02, 0x00, 0x65, 0x69, 0x9A, 0x1A, 0x00, 0x32, 0x18, 0x00, 0x01, 0x00, 0x69, 0xA0, 0x1A, 0x00,
+    0x01, 0x00, 0x75, 0xA6, 0x1A, 0x00, 0x01, 0x00, 0xC3, 0xB0, 0x1A, 0x00, 0x01, 0x00, 0x63, 0xB6,
+    0x1A, 0x00, 0x01, 0x00, 0x61, 0xBC, 0x1A, 0x00, 0x01, 0x00, 0x6F, 0xC2, 0x1A, 0x00, 0x01, 0x00,
+    0x6E, 0xC8, 0x1A, 0x00, 0x01, 0x00, 0x73, 0xCE, 0x1A, 0x00, 0x01, 0x00, 0x73, 0xD4, 0x1A, 0x00,
+    0x01, 0x00, 0x69, 0xDA, 0x1A, 0x00, 0x01, 0x00, 0x73, 0xEC, 0x1A, 0x00, 0x01, 0x00, 0x65, 0xF2,
+    0x1A, 0x00, 0x01, 0x00, 0x61, 0xF8, 0x1A, 0x00, 0x00, 0x02, 0x1A, 0x00, 0x01, 0x00, 0x61, 0xFC,
+    0x1A, 0x00, 0x02, 0x00, 0x69, 0xC3, 0x72, 0x1A, 0x00, 0x00, 0x1B, 0x00, 0x02, 0x02, 0x1A, 0x00,
+    0x6E, 0x75, 0x06, 0x1B, 0x00, 0x0C, 0x1B, 0x00, 0x04, 0x02, 0x1A, 0x00, 0x66, 0x70, 0x72, 0x78,
+    0x12, 0x1B, 0x00, 0x18, 0x1B, 0x00, 0xF8, 0x1A, 0x00, 0x1E, 0x1B, 0x00, 0x01, 0x00, 0x6F, 0x24,
+    0x1B, 0x00, 0x03, 0x02, 0x1A, 0x00, 0x6D, 0x71, 0x74, 0x2A, 0x1B, 0x00, 0x30, 0x1B, 0x00, 0x30,
+    0x1B, 0x00, 0x02, 0x02, 0x1A, 0x00, 0x63, 0x6E, 0x34, 0x1B, 0x00, 0x3A, 0x1B, 0x00, 0x01, 0x00,
+    0x74, 0x40, 0x1B, 0x00, 0x01, 0x00, 0x65, 0x46, 0x1B, 0x00, 0x02, 0x02, 0x1A, 0x00, 0x69, 0x6C,
+    0x18, 0x1B, 0x00, 0x30, 0x1B, 0x00, 0x01, 0x00, 0xA9, 0x4C, 0x1B, 0x00, 0x01, 0x00, 0x65, 0x58,
+    0x1B, 0x00, 0x01, 0x00, 0x75, 0x2C, 0x14, 0x00, 0x01, 0x00, 0x6F, 0x5E, 0x1B, 0x00, 0x01, 0x00,
+    0x73, 0x64, 0x1B, 0x00, 0x01, 0x00, 0x73, 0x6A, 0x1B, 0x00, 0x03, 0x00, 0x63, 0x74, 0x75, 0x38,
+    0x14, 0x00, 0x38, 0x14, 0x00, 0x70, 0x1B, 0x00, 0x01, 0x00, 0x61, 0x74, 0x1B, 0x00, 0x01, 0x00,
+    0xA8, 0x78, 0x1B, 0x00, 0x01, 0x00, 0x61, 0x7E, 0x1B, 0x00, 0x01, 0x00, 0x6D, 0x84, 0x1B, 0x00,
+    0x02, 0x01, 0x1C, 0x00, 0x73, 0x74, 0x8A, 0x1B, 0x00, 0x8E, 0x1B, 0x00, 0x01, 0x02, 0x1A, 0x00,
+    0x6C, 0x94, 0x1B, 0x00, 0x00, 0x01, 0x1C, 0x00, 0x01, 0x00, 0x72, 0x9A, 0x1B, 0x00, 0x04, 0x00,
+    0x63, 0x6C, 0x6D, 0x74, 0xA0, 0x1B, 0x00, 0xAA, 0x1B, 0x00, 0xB0, 0x1B, 0x00, 0xB6, 0x1B, 0x00,
+    0x01, 0x00, 0x6E, 0x38, 0x14, 0x00, 0x01, 0x00, 0x68, 0x30, 0x1B, 0x00, 0x04, 0x02, 0x51, 0x00,
+    0x61, 0x69, 0x6F, 0x75, 0xFC, 0x1A, 0x00, 0xFC, 0x1A, 0x00, 0xFC, 0x1A, 0x00, 0xFC, 0x1A, 0x00,
+    0x04, 0x00, 0x61, 0x69, 0x6F, 0x73, 0x74, 0x1B, 0x00, 0xBC, 0x1B, 0x00, 0x74, 0x1B, 0x00, 0xC2,
+    0x1B, 0x00, 0x01, 0x00, 0x6D, 0xEE, 0x1B, 0x00, 0x02, 0x00, 0x6B, 0x72, 0x30, 0x1B, 0x00, 0xF4,
+    0x1B, 0x00, 0x01, 0x00, 0x6E, 0xFA, 0x1B, 0x00, 0x04, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x04, 0x1C,
+    0x00, 0x16, 0x1C, 0x00, 0x1C, 0x1C, 0x00, 0x22, 0x1C, 0x00, 0x01, 0x00, 0x78, 0x2C, 0x1C, 0x00,
+    0x01, 0x00, 0x6C, 0x30, 0x1C, 0x00, 0x01, 0x00, 0x6F, 0x36, 0x1C, 0x00, 0x03, 0x00, 0x67, 0x73,
+    0x74, 0x54, 0x1C, 0x00, 0x5A, 0x1C, 0x00, 0x6C, 0x1C, 0x00, 0x01, 0x00, 0x6F, 0x72, 0x1C, 0x00,
+    0x03, 0x00, 0x61, 0x69, 0x6F, 0x78, 0x1C, 0x00, 0x86, 0x1C, 0x00, 0x8C, 0x1C, 0x00, 0x03, 0x00,
+    0x61, 0x65, 0x68, 0x92, 0x1C, 0x00, 0xF2, 0x1A, 0x00, 0x9C, 0x1C, 0x00, 0x01, 0x00, 0x74, 0xA2,
+    0x1C, 0x00, 0x06, 0x01, 0x56, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0x74, 0x1B, 0x00, 0x74,
+    0x1B, 0x00, 0x74, 0x1B, 0x00, 0x74, 0x1B, 0x00, 0x74, 0x1B, 0x00, 0xA8, 0x1C, 0x00, 0x01, 0x00,
+    0x6C, 0xAE, 0x1C, 0x00, 0x01, 0x00, 0x72, 0xB4, 0x1C, 0x00, 0x01, 0x00, 0x74, 0xBA, 0x1C, 0x00,
+    0x01, 0x00, 0x74, 0xC0, 0x1C, 0x00, 0x04, 0x00, 0x67, 0x73, 0x75, 0xC3, 0xD6, 0x1C, 0x00, 0xDC,
+    0x1C, 0x00, 0xE2, 0x1C, 0x00, 0xA8, 0x1C, 0x00, 0x01, 0x00, 0xA9, 0xE8, 0x1C, 0x00, 0x01, 0x00,
+    0x63, 0x06, 0x1D, 0x00, 0x01, 0x00, 0x64, 0x0C, 0x1D, 0x00, 0x01, 0x00, 0x72, 0x12, 0x1D, 0x00,
+    0x05, 0x02, 0x1A, 0x00, 0x63, 0x70, 0x71, 0x73, 0x74, 0x18, 0x1D, 0x00, 0x2A, 0x1D, 0x00, 0x3C,
+    0x1D, 0x00, 0x42, 0x1D, 0x00, 0x4A, 0x1D, 0x00, 0x07, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x74, 0x75,
+    0xC3, 0x6A, 0x1D, 0x00, 0x76, 0x1D, 0x00, 0x82, 0x1D, 0x00, 0x74, 0x1B, 0x00, 0x8A, 0x1D, 0x00,
+    0x90, 0x1D, 0x00, 0x98, 0x1D, 0x00, 0x01, 0x00, 0x6C, 0xA2, 0x1D, 0x00, 0x01, 0x00, 0x76, 0x84,
+    0x1B, 0x00, 0x01, 0x00, 0x67, 0xA8, 0x1D, 0x00, 0x01, 0x00, 0x6C, 0xAE, 0x1D, 0x00, 0x05, 0x00,
+    0x61, 0x69, 0x6C, 0x75, 0xC3, 0xB4, 0x1D, 0x00, 0x16, 0x1C, 0x00, 0xBC, 0x1D, 0x00, 0xC6, 0x1D,
+    0x00, 0xCC, 0x1D, 0x00, 0x06, 0x00, 0x61, 0x65, 0x68, 0x69, 0x6F, 0xC3, 0xD2, 0x1D, 0x00, 0xDA,
+    0x1D, 0x00, 0x30, 0x1B, 0x00, 0xEA, 0x1D, 0x00, 0xF4, 0x1D, 0x00, 0xFE, 0x1D, 0x00, 0x01, 0x00,
+    0x67, 0xD6, 0x1C, 0x00, 0x02, 0x00, 0x61, 0x6F, 0x04, 0x1E, 0x00, 0x12, 0x1E, 0x00, 0x01, 0x00,
+    0x69, 0x18, 0x1E, 0x00, 0x01, 0x00, 0x6E, 0x1E, 0x1E, 0x00, 0x01, 0x00, 0x69, 0x24, 0x1E, 0x00,
+    0x01, 0x00, 0x73, 0xC6, 0x17, 0x00, 0x01, 0x00, 0x6E, 0x2A, 0x1E, 0x00, 0x01, 0x00, 0x67, 0x30,
+    0x1E, 0x00, 0x01, 0x00, 0x6F, 0x36, 0x1E, 0x00, 0x01, 0x00, 0x67, 0x3C, 0x1E, 0x00, 0x01, 0x00,
+    0x74, 0x42, 0x1E, 0x00, 0x01, 0x00, 0x65, 0x48, 0x1E, 0x00, 0x01, 0x00, 0x66, 0x4E, 0x1E, 0x00,
+    0x01, 0x00, 0x74, 0x54, 0x1E, 0x00, 0x01, 0x00, 0x72, 0x84, 0x1B, 0x00, 0x01, 0x00, 0x69, 0x5A,
+    0x1E, 0x00, 0x01, 0x00, 0x6C, 0x60, 0x1E, 0x00, 0x01, 0x00, 0x6F, 0xC6, 0x17, 0x00, 0x01, 0x00,
+    0x72, 0x66, 0x1E, 0x00, 0x01, 0x00, 0x2E, 0xC0, 0x08, 0x00, 0x01, 0x00, 0x69, 0x6C, 0x1E, 0x00,
+    0x01, 0x00, 0x74, 0x72, 0x1E, 0x00, 0x01, 0x00, 0xAA, 0x76, 0x1E, 0x00, 0x01, 0x00, 0x69, 0x7C,
+    0x1E, 0x00, 0x01, 0x00, 0x6E, 0x82, 0x1E, 0x00, 0x02, 0x00, 0x2E, 0x73, 0x48, 0x0F, 0x00, 0x52,
+    0x0F, 0x00, 0x01, 0x00, 0x72, 0x88, 0x1E, 0x00, 0x00, 0x01, 0x0C, 0x00, 0x02, 0x00, 0x63, 0x71,
+    0x5A, 0x17, 0x00, 0x5A, 0x17, 0x00, 0x00, 0x02, 0x43, 0x00, 0x00, 0x01, 0x4E, 0x00, 0x01, 0x00,
+    0x73, 0x92, 0x1E, 0x00, 0x01, 0x00, 0x69, 0x9C, 0x1E, 0x00, 0x01, 0x00, 0xC3, 0xA2, 0x1E, 0x00,
+    0x01, 0x00, 0x69, 0x82, 0x1E, 0x00, 0x01, 0x00, 0x69, 0xA8, 0x1E, 0x00, 0x01, 0x00, 0x69, 0xAE,
+    0x1E, 0x00, 0x01, 0x00, 0x72, 0xB4, 0x1E, 0x00, 0x01, 0x00, 0x75, 0xBA, 0x1E, 0x00, 0x00, 0x02,
+    0x57, 0x00, 0x00, 0x02, 0x3F, 0x00, 0x01, 0x00, 0x64, 0x92, 0x17, 0x00, 0x01, 0x00, 0x68, 0xC0,
+    0x1E, 0x00, 0x01, 0x00, 0x67, 0x84, 0x1B, 0x00, 0x01, 0x00, 0x6F, 0xC6, 0x1E, 0x00, 0x01, 0x00,
+    0x61, 0x82, 0x1E, 0x00, 0x01, 0x00, 0x72, 0xCC, 0x1E, 0x00, 0x01, 0x00, 0x72, 0xD2, 0x1E, 0x00,
+    0x01, 0x00, 0x65, 0xD6, 0x1E, 0x00, 0x00, 0x02, 0x18, 0x00, 0x01, 0x00, 0x70, 0xC6, 0x17, 0x00,
+    0x01, 0x00, 0x61, 0x5C, 0x18, 0x00, 0x01, 0x00, 0x61, 0xDC, 0x1E, 0x00, 0x01, 0x00, 0x75, 0xE8,
+    0x1E, 0x00, 0x01, 0x00, 0x64, 0xEE, 0x1E, 0x00, 0x01, 0x00, 0x72, 0xF4, 0x1E, 0x00, 0x07, 0x00,
+    0x61, 0x65, 0x69, 0x6F, 0x73, 0x75, 0xC3, 0x74, 0x1B, 0x00, 0x74, 0x1B, 0x00, 0x74, 0x1B, 0x00,
+    0x74, 0x1B, 0x00, 0x74, 0x1B, 0x00, 0x74, 0x1B, 0x00, 0xA8, 0x1C, 0x00, 0x02, 0x00, 0x69, 0x6F,
+    0x14, 0x1F, 0x00, 0x1A, 0x1F, 0x00, 0x01, 0x00, 0x69, 0x66, 0x09, 0x00, 0x01, 0x00, 0x68, 0x20,
+    0x1F, 0x00, 0x01, 0x00, 0x6E, 0x84, 0x1B, 0x00, 0x02, 0x00, 0x6E, 0x73, 0x84, 0x1B, 0x00, 0x26,
+    0x1F, 0x00, 0x01, 0x00, 0x74, 0x84, 0x1B, 0x00, 0x01, 0x00, 0x64, 0x84, 0x1B, 0x00, 0x01, 0x00,
+    0x6C, 0x84, 0x1B, 0x00, 0x01, 0x00, 0x6C, 0xD6, 0x1E, 0x00, 0x01, 0x00, 0x72, 0x2C, 0x1F, 0x00,
+    0x01, 0x00, 0x63, 0x84, 0x1B, 0x00, 0x01, 0x00, 0x6C, 0x32, 0x1F, 0x00, 0x01, 0x00, 0x74, 0x56,
+    0x17, 0x00, 0x02, 0x00, 0x69, 0xC3, 0x38, 0x1F, 0x00, 0x42, 0x1F, 0x00, 0x01, 0x00, 0x65, 0x72,
+    0x1A, 0x00, 0x01, 0x00, 0x6E, 0x48, 0x1F, 0x00, 0x01, 0x00, 0x74, 0x4C, 0x1F, 0x00, 0x01, 0x01,
+    0x0C, 0x00, 0x65, 0x52, 0x1F, 0x00, 0x01, 0x00, 0x73, 0xCC, 0x08, 0x00, 0x02, 0x00, 0x6D, 0x73,
+    0x58, 0x1F, 0x00, 0x5E, 0x1F, 0x00, 0x01, 0x00, 0x76, 0x64, 0x1F, 0x00, 0x01, 0x00, 0x72, 0x6A,
+    0x1F, 0x00, 0x01, 0x00, 0x6E, 0x70, 0x1F, 0x00, 0x01, 0x00, 0x66, 0x76, 0x1F, 0x00, 0x01, 0x00,
+    0x6F, 0x7C, 0x1F, 0x00, 0x02, 0x00, 0x2E, 0x73, 0x82, 0x1F, 0x00, 0x86, 0x1F, 0x00, 0x01, 0x00,
+    0x69, 0xE8, 0x1E, 0x00, 0x01, 0x00, 0x6E, 0x8C, 0x1F, 0x00, 0x01, 0x00, 0x74, 0x3C, 0x06, 0x00,
+    0x02, 0x00, 0x6D, 0x73, 0x92, 0x1F, 0x00, 0x98, 0x1F, 0x00, 0x01, 0x00, 0x64, 0x9E, 0x1F, 0x00,
+    0x02, 0x00, 0x70, 0x73, 0xA4, 0x1F, 0x00, 0x74, 0x1B, 0x00, 0x02, 0x00, 0x73, 0x74, 0x78, 0x07,
+    0x00, 0x78, 0x07, 0x00, 0x01, 0x00, 0x6D, 0x78, 0x07, 0x00, 0x02, 0x00, 0x61, 0x69, 0xAA, 0x1F,
+    0x00, 0xB4, 0x1F, 0x00, 0x01, 0x00, 0xA9, 0xBA, 0x1F, 0x00, 0x01, 0x00, 0xA9, 0xC0, 0x1F, 0x00,
+    0x01, 0x00, 0x6C, 0xC6, 0x1F, 0x00, 0x01, 0x00, 0x61, 0x18, 0x1E, 0x00, 0x01, 0x00, 0x6F, 0xCC,
+    0x1F, 0x00, 0x01, 0x00, 0x6C, 0xD2, 0x1F, 0x00, 0x01, 0x00, 0x73, 0xD8, 0x1F, 0x00, 0x01, 0x00,
+    0x74, 0xDC, 0x1F, 0x00, 0x08, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x73, 0x75, 0x76, 0xC3, 0x74, 0x1B,
+    0x00, 0x74, 0x1B, 0x00, 0x74, 0x1B, 0x00, 0x74, 0x1B, 0x00, 0x74, 0x1B, 0x00, 0x74, 0x1B, 0x00,
+    0x64, 0x1F, 0x00, 0xE2, 0x1F, 0x00, 0x01, 0x00, 0x61, 0xEC, 0x1F, 0x00, 0x01, 0x00, 0x74, 0xF2,
+    0x1F, 0x00, 0x01, 0x00, 0xA9, 0xF8, 0x1F, 0x00, 0x02, 0x00, 0x73, 0xC3, 0x84, 0x1B, 0x00, 0xFE,
+    0x1F, 0x00, 0x01, 0x00, 0x68, 0xCC, 0x08, 0x00, 0x01, 0x00, 0x72, 0xCC, 0x08, 0x00, 0x01, 0x00,
+    0x61, 0x04, 0x20, 0x00, 0x01, 0x00, 0x75, 0x0E, 0x20, 0x00, 0x01, 0x00, 0xC3, 0x14, 0x20, 0x00,
+    0x01, 0x00, 0x6F, 0x1A, 0x20, 0x00, 0x01, 0x00, 0x72, 0xBA, 0x19, 0x00, 0x01, 0x00, 0x75, 0x20,
+    0x20, 0x00, 0x01, 0x00, 0x69, 0x26, 0x20, 0x00, 0x01, 0x00, 0xA9, 0x78, 0x19, 0x00, 0x01, 0x00,
+    0x6C, 0x2C, 0x20, 0x00, 0x01, 0x00, 0x75, 0x32, 0x20, 0x00, 0x00, 0x02, 0x2E, 0x00, 0x01, 0x00,
+    0x6F, 0x76, 0x1E, 0x00, 0x01, 0x00, 0x69, 0x38, 0x20, 0x00, 0x01, 0x00, 0x6D, 0xCC, 0x08, 0x00,
+    0x01, 0x00, 0x6C, 0xCC, 0x08, 0x00, 0x01, 0x00, 0x6F, 0x86, 0x18, 0x00, 0x01, 0x02, 0x0A, 0x00,
+    0x75, 0x3E, 0x20, 0x00, 0x01, 0x00, 0x64, 0x44, 0x20, 0x00, 0x01, 0x00, 0x6E, 0xCC, 0x08, 0x00,
+    0x01, 0x00, 0x6B, 0xCC, 0x08, 0x00, 0x01, 0x00, 0x63, 0x4A, 0x20, 0x00, 0x01, 0x00, 0x65, 0xCC,
+    0x08, 0x00, 0x01, 0x00, 0x72, 0x50, 0x20, 0x00, 0x01, 0x00, 0x69, 0x76, 0x1E, 0x00, 0x01, 0x00,
+    0x72, 0x56, 0x20, 0x00, 0x01, 0x00, 0x68, 0x62, 0x20, 0x00, 0x01, 0x00, 0x79, 0x1A, 0x20, 0x00,
+    0x01, 0x00, 0x6E, 0x66, 0x20, 0x00, 0x01, 0x00, 0xC3, 0x6C, 0x20, 0x00, 0x01, 0x00, 0x61, 0xE8,
+    0x1E, 0x00, 0x01, 0x00, 0x6D, 0x72, 0x20, 0x00, 0x01, 0x00, 0x73, 0x78, 0x20, 0x00, 0x01, 0x00,
+    0x73, 0x8E, 0x20, 0x00, 0x01, 0x00, 0xC3, 0x92, 0x20, 0x00, 0x01, 0x00, 0x78, 0x38, 0x14, 0x00,
+    0x01, 0x00, 0x76, 0x38, 0x14, 0x00, 0x01, 0x00, 0x6C, 0x98, 0x20, 0x00, 0x02, 0x00, 0x2E, 0x72,
+    0xC0, 0x08, 0x00, 0x9E, 0x20, 0x00, 0x01, 0x00, 0x61, 0xA4, 0x20, 0x00, 0x01, 0x00, 0x6F, 0xAA,
+    0x20, 0x00, 0x00, 0x02, 0x0E, 0x00, 0x01, 0x00, 0x68, 0x66, 0x09, 0x00, 0x01, 0x00, 0x69, 0xF8,
+    0x1A, 0x00, 0x01, 0x00, 0x69, 0xB0, 0x20, 0x00, 0x01, 0x00, 0x63, 0xBA, 0x20, 0x00, 0x01, 0x00,
+    0x71, 0xC0, 0x20, 0x00, 0x01, 0x00, 0xA9, 0xC6, 0x20, 0x00, 0x01, 0x00, 0x72, 0xCC, 0x20, 0x00,
+    0x01, 0x00, 0x73, 0xD2, 0x20, 0x00, 0x02, 0x00, 0x65, 0x69, 0xB4, 0x16, 0x00, 0xD8, 0x20, 0x00,
+    0x01, 0x00, 0xA9, 0xE2, 0x20, 0x00, 0x01, 0x00, 0x68, 0xE8, 0x20, 0x00, 0x01, 0x00, 0x74, 0x72,
+    0x1A, 0x00, 0x01, 0x00, 0x6F, 0xEC, 0x20, 0x00, 0x01, 0x00, 0x6F, 0xF2, 0x20, 0x00, 0x01, 0x00,
+    0x74, 0xF8, 0x20, 0x00, 0x01, 0x00, 0x74, 0xFE, 0x20, 0x00, 0x04, 0x00, 0x61, 0x65, 0x73, 0xC3,
+    0x04, 0x21, 0x00, 0x08, 0x21, 0x00, 0x04, 0x21, 0x00, 0x10, 0x21, 0x00, 0x01, 0x00, 0x74, 0x16,
+    0x21, 0x00, 0x01, 0x00, 0x6E, 0x1C, 0x21, 0x00, 0x00, 0x01, 0x09, 0x00, 0x00, 0x03, 0x77, 0x00,
+    0x01, 0x00, 0xA9, 0x72, 0x1A, 0x00, 0x01, 0x00, 0x69, 0x22, 0x21, 0x00, 0x01, 0x00, 0x67, 0x28,
+    0x21, 0x00, 0x01, 0x00, 0x66, 0x2E, 0x21, 0x00, 0x01, 0x00, 0x74, 0xF8, 0x1A, 0x00, 0x01, 0x00,
+    0x6F, 0x34, 0x21, 0x00, 0x01, 0x00, 0x72, 0x3A, 0x21, 0x00, 0x01, 0x00, 0x69, 0x40, 0x21, 0x00,
+    0x00, 0x02, 0x51, 0x00, 0x01, 0x00, 0x75, 0x46, 0x21, 0x00, 0x01, 0x00, 0x64, 0xF8, 0x1A, 0x00,
+    0x01, 0x00, 0x61, 0x4C, 0x21, 0x00, 0x01, 0x00, 0x72, 0x52, 0x21, 0x00, 0x02, 0x02, 0x8E, 0x00,
+    0x6C, 0x6E, 0x72, 0x21, 0x00, 0x78, 0x21, 0x00, 0x01, 0x00, 0x74, 0x7E, 0x21, 0x00, 0x01, 0x00,
+    0x75, 0x82, 0x21, 0x00, 0x01, 0x00, 0x63, 0x74, 0x1B, 0x00, 0x01, 0x00, 0x65, 0x86, 0x21, 0x00,
+    0x00, 0x01, 0x92, 0x00, 0x00, 0x02, 0x1D, 0x00, 0x01, 0x00, 0x76, 0x8C, 0x21, 0x00, 0x01, 0x00,
+    0x6C, 0x92, 0x21, 0x00, 0x01, 0x00, 0x65, 0x98, 0x21, 0x00, 0x00, 0x01, 0x17, 0x00, 0x01, 0x00,
+    0x72, 0x9E, 0x21, 0x00, 0x01, 0x00, 0x69, 0xA4, 0x21, 0x00, 0x01, 0x00, 0x79, 0xAA, 0x21, 0x00,
+    0x02, 0x00, 0x69, 0xC3, 0xB0, 0x21, 0x00, 0xB6, 0x21, 0x00, 0x01, 0x00, 0x64, 0x70, 0x1B, 0x00,
+    0x01, 0x00, 0x69, 0x38, 0x14, 0x00, 0x01, 0x00, 0x6F, 0xBC, 0x21, 0x00, 0x01, 0x00, 0x6F, 0x82,
+    0x21, 0x00, 0x0A, 0x01, 0x16, 0x00, 0x61, 0x63, 0x65, 0x69, 0x6F, 0x70, 0x74, 0x75, 0xC3, 0xC5,
+    0xC2, 0x21, 0x00, 0xD4, 0x21, 0x00, 0xD8, 0x21, 0x00, 0xE6, 0x21, 0x00, 0x02, 0x22, 0x00, 0xD4,
+    0x21, 0x00, 0xD4, 0x21, 0x00, 0x18, 0x22, 0x00, 0x1E, 0x22, 0x00, 0x24, 0x22, 0x00, 0x01, 0x00,
+    0x65, 0x2A, 0x22, 0x00, 0x01, 0x00, 0x6F, 0x30, 0x22, 0x00, 0x02, 0x00, 0x69, 0x75, 0x36, 0x22,
+    0x00, 0x40, 0x22, 0x00, 0x04, 0x00, 0x64, 0x69, 0x70, 0x76, 0x46, 0x22, 0x00, 0x4C, 0x22, 0x00,
+    0x2C, 0x1C, 0x00, 0xFC, 0x1A, 0x00, 0x01, 0x00, 0x6E, 0x2C, 0x1C, 0x00, 0x01, 0x00, 0x6E, 0x52,
+    0x22, 0x00, 0x02, 0x00, 0x63, 0x64, 0x2C, 0x1C, 0x00, 0xFC, 0x1A, 0x00, 0x00, 0x02, 0x11, 0x00,
+    0x01, 0x00, 0x69, 0x58, 0x22, 0x00, 0x07, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x73, 0x75, 0xC3, 0x04,
+    0x21, 0x00, 0x04, 0x21, 0x00, 0x04, 0x21, 0x00, 0x04, 0x21, 0x00, 0x04, 0x21, 0x00, 0x04, 0x21,
+    0x00, 0x5E, 0x22, 0x00, 0x01, 0x00, 0x6F, 0x68, 0x22, 0x00, 0x04, 0x00, 0x61, 0x65, 0x69, 0x75,
+    0x6E, 0x22, 0x00, 0x76, 0x22, 0x00, 0x7C, 0x22, 0x00, 0x80, 0x22, 0x00, 0x01, 0x00, 0x61, 0x86,
+    0x22, 0x00, 0x01, 0x00, 0x62, 0x86, 0x1C, 0x00, 0x03, 0x00, 0x66, 0x6D, 0x72, 0xFC, 0x1A, 0x00,
+    0x8C, 0x22, 0x00, 0x3C, 0x14, 0x00, 0x01, 0x00, 0x73, 0x2C, 0x1C, 0x00, 0x01, 0x00, 0x70, 0x92,
+    0x22, 0x00, 0x02, 0x00, 0x63, 0x73, 0x9C, 0x22, 0x00, 0x04, 0x21, 0x00, 0x01, 0x00, 0xC3, 0xA2,
+    0x22, 0x00, 0x01, 0x00, 0x61, 0xA8, 0x22, 0x00, 0x01, 0x00, 0xA9, 0xAC, 0x22, 0x00, 0x01, 0x00,
+    0x61, 0xB0, 0x22, 0x00, 0x01, 0x00, 0x69, 0xB6, 0x22, 0x00, 0x01, 0x00, 0x65, 0xBC, 0x22, 0x00,
+    0x05, 0x00, 0x68, 0x69, 0x6F, 0x72, 0x73, 0x8E, 0x20, 0x00, 0xC2, 0x22, 0x00, 0xC8, 0x22, 0x00,
+    0x8E, 0x20, 0x00, 0x04, 0x21, 0x00, 0x01, 0x00, 0x6E, 0xCC, 0x22, 0x00, 0x01, 0x00, 0x63, 0xD2,
+    0x22, 0x00, 0x01, 0x00, 0x64, 0xD8, 0x22, 0x00, 0x07, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x73, 0x75,
+    0xC3, 0xDE, 0x22, 0x00, 0x04, 0x21, 0x00, 0x04, 0x21, 0x00, 0x04, 0x21, 0x00, 0x04, 0x21, 0x00,
+    0x04, 0x21, 0x00, 0x10, 0x21, 0x00, 0x01, 0x00, 0x68, 0xEA, 0x22, 0x00, 0x01, 0x00, 0x6C, 0x74,
+    0x1B, 0x00, 0x01, 0x00, 0x69, 0xF0, 0x22, 0x00, 0x04, 0x00, 0x61, 0x69, 0x6F, 0x72, 0xFE, 0x22,
+    0x00, 0x04, 0x23, 0x00, 0x0A, 0x23, 0x00, 0x10, 0x23, 0x00, 0x04, 0x00, 0x65, 0x69, 0x6C, 0x6F,
+    0x16, 0x23, 0x00, 0x54, 0x1E, 0x00, 0x1C, 0x23, 0x00, 0x22, 0x23, 0x00, 0x01, 0x00, 0x75, 0x28,
+    0x23, 0x00, 0x01, 0x02, 0x51, 0x00, 0x65, 0x98, 0x21, 0x00, 0x07, 0x02, 0x51, 0x00, 0x61, 0x69,
+    0x6F, 0x72, 0x75, 0x79, 0xC3, 0x2E, 0x23, 0x00, 0x40, 0x23, 0x00, 0x4A, 0x23, 0x00, 0x54, 0x23,
+    0x00, 0xE8, 0x20, 0x00, 0xE8, 0x20, 0x00, 0x60, 0x23, 0x00, 0x02, 0x02, 0x1D, 0x00, 0x6C, 0x75,
+    0x66, 0x23, 0x00, 0x70, 0x23, 0x00, 0x02, 0x02, 0x1D, 0x00, 0x6C, 0x72, 0xA8, 0x22, 0x00, 0xA8,
+    0x22, 0x00, 0x01, 0x02, 0x1D, 0x00, 0x66, 0x76, 0x23, 0x00, 0x01, 0x00, 0x72, 0xAA, 0x21, 0x00,
+    0x01, 0x01, 0x30, 0x00, 0x73, 0x7C, 0x23, 0x00, 0x02, 0x00, 0xA8, 0xA9, 0x82, 0x23, 0x00, 0xAC,
+    0x22, 0x00, 0x01, 0x00, 0x65, 0xA8, 0x22, 0x00, 0x01, 0x00, 0x6E, 0x8E, 0x20, 0x00, 0x01, 0x00,
+    0x6C, 0x88, 0x23, 0x00, 0x01, 0x03, 0x77, 0x00, 0x6C, 0x8C, 0x23, 0x00, 0x02, 0x00, 0x69, 0x75,
+    0x92, 0x23, 0x00, 0x30, 0x1B, 0x00, 0x01, 0x00, 0x72, 0x2C, 0x1C, 0x00, 0x01, 0x00, 0xA9, 0x9C,
+    0x23, 0x00, 0x01, 0x03, 0x77, 0x00, 0x74, 0xA4, 0x23, 0x00, 0x03, 0x03, 0x77, 0x00, 0x61, 0x6C,
+    0x74, 0xA8, 0x23, 0x00, 0xAE, 0x23, 0x00, 0xB4, 0x23, 0x00, 0x02, 0x00, 0x6D, 0x6E, 0xFC, 0x1A,
+    0x00, 0xB8, 0x23, 0x00, 0x02, 0x00, 0x66, 0x78, 0x2C, 0x1C, 0x00, 0x2C, 0x1C, 0x00, 0x01, 0x00,
+    0xA9, 0xC2, 0x23, 0x00, 0x03, 0x00, 0x63, 0x6E, 0x74, 0x74, 0x1B, 0x00, 0x74, 0x1B, 0x00, 0x74,
+    0x1B, 0x00, 0x01, 0x00, 0x6E, 0x74, 0x1B, 0x00, 0x01, 0x00, 0x6E, 0xC6, 0x23, 0x00, 0x01, 0x00,
+    0x74, 0xCC, 0x23, 0x00, 0x01, 0x00, 0x65, 0xD2, 0x23, 0x00, 0x01, 0x00, 0x74, 0xD8, 0x23, 0x00,
+    0x01, 0x00, 0x69, 0xDE, 0x23, 0x00, 0x01, 0x00, 0x6C, 0x3C, 0x06, 0x00, 0x01, 0x00, 0x61, 0xE2,
+    0x23, 0x00, 0x01, 0x00, 0x68, 0xE8, 0x23, 0x00, 0x01, 0x00, 0x6E, 0xEE, 0x23, 0x00, 0x01, 0x00,
+    0x65, 0xF4, 0x23, 0x00, 0x01, 0x00, 0x72, 0x30, 0x1B, 0x00, 0x01, 0x00, 0xC3, 0xFA, 0x23, 0x00,
+    0x01, 0x00, 0x6C, 0x00, 0x24, 0x00, 0x01, 0x00, 0x65, 0x04, 0x24, 0x00, 0x01, 0x00, 0x6C, 0x08,
+    0x24, 0x00, 0x00, 0x03, 0x62, 0x00, 0x01, 0x00, 0x6D, 0x0E, 0x24, 0x00, 0x01, 0x00, 0x6C, 0x14,
+    0x24, 0x00, 0x01, 0x00, 0x64, 0xC6, 0x23, 0x00, 0x02, 0x00, 0x61, 0xC3, 0x1A, 0x24, 0x00, 0x20,
+    0x24, 0x00, 0x02, 0x00, 0x6F, 0x75, 0x26, 0x24, 0x00, 0x2C, 0x24, 0x00, 0x01, 0x00, 0x74, 0x32,
+    0x24, 0x00, 0x01, 0x00, 0xA9, 0x38, 0x24, 0x00, 0x01, 0x00, 0x76, 0xC6, 0x23, 0x00, 0x01, 0x00,
+    0x6E, 0x3E, 0x24, 0x00, 0x01, 0x00, 0x62, 0xCA, 0x0E, 0x00, 0x01, 0x00, 0x6C, 0xC6, 0x23, 0x00,
+    0x01, 0x00, 0x72, 0x48, 0x24, 0x00, 0x01, 0x00, 0x70, 0x72, 0x1A, 0x00, 0x01, 0x00, 0x69, 0x4E,
+    0x24, 0x00, 0x00, 0x03, 0x45, 0x00, 0x01, 0x00, 0x67, 0xC6, 0x23, 0x00, 0x02, 0x01, 0x26, 0x00,
+    0x63, 0x69, 0x54, 0x24, 0x00, 0x54, 0x24, 0x00, 0x01, 0x00, 0x6D, 0xC6, 0x23, 0x00, 0x01, 0x00,
+    0x69, 0x58, 0x24, 0x00, 0x07, 0x02, 0x21, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x73, 0x75, 0xC3, 0x5E,
+    0x24, 0x00, 0x5E, 0x24, 0x00, 0x5E, 0x24, 0x00, 0x5E, 0x24, 0x00, 0x5E, 0x24, 0x00, 0x5E, 0x24,
+    0x00, 0x62, 0x24, 0x00, 0x01, 0x00, 0xC3, 0x68, 0x24, 0x00, 0x01, 0x00, 0x70, 0x6E, 0x24, 0x00,
+    0x01, 0x00, 0x72, 0x66, 0x09, 0x00, 0x01, 0x00, 0x63, 0x74, 0x24, 0x00, 0x01, 0x00, 0x6D, 0x7A,
+    0x24, 0x00, 0x01, 0x00, 0x6C, 0x80, 0x24, 0x00, 0x02, 0x00, 0x61, 0x6F, 0xC6, 0x17, 0x00, 0xC6,
+    0x17, 0x00, 0x01, 0x00, 0xA9, 0xC6, 0x17, 0x00, 0x00, 0x01, 0x10, 0x00, 0x01, 0x00, 0x2E, 0x7E,
+    0x21, 0x00, 0x01, 0x00, 0x74, 0x5A, 0x0D, 0x00, 0x01, 0x00, 0x6F, 0xCC, 0x08, 0x00, 0x01, 0x00,
+    0x69, 0xCC, 0x08, 0x00, 0x01, 0x00, 0x61, 0x86, 0x24, 0x00, 0x01, 0x00, 0xC3, 0x8C, 0x24, 0x00,
+    0x01, 0x00, 0xC3, 0x92, 0x24, 0x00, 0x01, 0x00, 0x69, 0x98, 0x24, 0x00, 0x01, 0x00, 0x6E, 0x38,
+    0x24, 0x00, 0x00, 0x02, 0x06, 0x00, 0x01, 0x00, 0x2E, 0x82, 0x1F, 0x00, 0x01, 0x00, 0x67, 0xC6,
+    0x17, 0x00, 0x01, 0x00, 0x6F, 0x9E, 0x24, 0x00, 0x01, 0x00, 0x69, 0xC6, 0x17, 0x00, 0x01, 0x00,
+    0x73, 0xA4, 0x24, 0x00, 0x01, 0x00, 0x6F, 0x38, 0x24, 0x00, 0x02, 0x00, 0x64, 0x74, 0x78, 0x07,
+    0x00, 0xA8, 0x24, 0x00, 0x01, 0x00, 0x63, 0xAE, 0x24, 0x00, 0x01, 0x00, 0x72, 0xB4, 0x24, 0x00,
+    0x01, 0x00, 0x6F, 0xBA, 0x24, 0x00, 0x01, 0x00, 0x6C, 0xC0, 0x24, 0x00, 0x01, 0x00, 0x73, 0x04,
+    0x21, 0x00, 0x01, 0x00, 0xC3, 0xD2, 0x24, 0x00, 0x00, 0x02, 0x49, 0x00, 0x01, 0x00, 0x72, 0xD8,
+    0x24, 0x00, 0x02, 0x00, 0xA8, 0xA9, 0xAC, 0x22, 0x00, 0xAC, 0x22, 0x00, 0x01, 0x00, 0x74, 0xDE,
+    0x24, 0x00, 0x01, 0x00, 0x61, 0x22, 0x21, 0x00, 0x01, 0x00, 0x6D, 0xE4, 0x24, 0x00, 0x01, 0x00,
+    0xA9, 0xEA, 0x24, 0x00, 0x02, 0x00, 0x62, 0x63, 0xF0, 0x24, 0x00, 0x72, 0x1A, 0x00, 0x01, 0x00,
+    0x6C, 0xF8, 0x1A, 0x00, 0x01, 0x00, 0xA9, 0xF6, 0x24, 0x00, 0x01, 0x00, 0x61, 0x04, 0x21, 0x00,
+    0x01, 0x00, 0x72, 0xFC, 0x24, 0x00, 0x01, 0x00, 0x63, 0xC6, 0x23, 0x00, 0x01, 0x00, 0x6C, 0x8A,
+    0x1B, 0x00, 0x01, 0x00, 0x69, 0x02, 0x25, 0x00, 0x01, 0x00, 0x61, 0xCC, 0x08, 0x00, 0x01, 0x00,
+    0x6C, 0x74, 0x24, 0x00, 0x01, 0x00, 0x61, 0x08, 0x25, 0x00, 0x01, 0x00, 0x74, 0xCE, 0x11, 0x00,
+    0x01, 0x00, 0xC3, 0x0E, 0x25, 0x00, 0x02, 0x02, 0x21, 0x00, 0x6F, 0x73, 0x5E, 0x24, 0x00, 0x5E,
+    0x24, 0x00, 0x00, 0x02, 0x31, 0x00, 0x01, 0x00, 0x74, 0x14, 0x25, 0x00, 0x01, 0x00, 0xA9, 0x18,
+    0x25, 0x00, 0x01, 0x00, 0x6F, 0x1E, 0x25, 0x00, 0x05, 0x00, 0x61, 0x68, 0x6F, 0x70, 0x75, 0x24,
+    0x25, 0x00, 0x8E, 0x20, 0x00, 0xC8, 0x22, 0x00, 0x30, 0x25, 0x00, 0xC8, 0x22, 0x00, 0x00, 0x02,
+    0x38, 0x00, 0x01, 0x00, 0xA9, 0x38, 0x25, 0x00, 0x01, 0x00, 0x6C, 0x4A, 0x25, 0x00, 0x01, 0x00,
+    0x69, 0x50, 0x25, 0x00, 0x01, 0x00, 0x6D, 0x92, 0x21, 0x00, 0x01, 0x00, 0x73, 0x56, 0x25, 0x00,
+    0x02, 0x00, 0x65, 0x71, 0x5C, 0x25, 0x00, 0x60, 0x25, 0x00, 0x01, 0x00, 0x74, 0x66, 0x25, 0x00,
+    0x01, 0x00, 0x75, 0x84, 0x1B, 0x00, 0x01, 0x00, 0x6D, 0x6C, 0x25, 0x00, 0x01, 0x00, 0x67, 0x5C,
+    0x25, 0x00, 0x01, 0x00, 0x63, 0x72, 0x25, 0x00, 0x02, 0x00, 0x70, 0x76, 0x78, 0x25, 0x00, 0x7E,
+    0x25, 0x00, 0x01, 0x00, 0x61, 0x48, 0x17, 0x00, 0x00, 0x02, 0x70, 0x00, 0x01, 0x00, 0x6C, 0x7E,
+    0x21, 0x00, 0x01, 0x00, 0x61, 0x84, 0x25, 0x00, 0x01, 0x00, 0x72, 0x8A, 0x25, 0x00, 0x01, 0x00,
+    0x68, 0x8E, 0x25, 0x00, 0x00, 0x02, 0x13, 0x00, 0x01, 0x02, 0x13, 0x00, 0x6E, 0x94, 0x25, 0x00,
+    0x01, 0x00, 0xA9, 0x9A, 0x25, 0x00, 0x01, 0x00, 0x61, 0x8E, 0x20, 0x00, 0x01, 0x00, 0x74, 0x9E,
+    0x25, 0x00, 0x01, 0x00, 0x74, 0x30, 0x1B, 0x00, 0x01, 0x00, 0x75, 0xA4, 0x25, 0x00, 0x01, 0x00,
+    0x61, 0xAA, 0x25, 0x00, 0x01, 0x00, 0x72, 0x32, 0x14, 0x00, 0x01, 0x00, 0x6D, 0xB0, 0x25, 0x00,
+    0x01, 0x00, 0x74, 0x10, 0x23, 0x00, 0x01, 0x00, 0x6C, 0x30, 0x1B, 0x00, 0x01, 0x00, 0x62, 0x38,
+    0x14, 0x00, 0x07, 0x02, 0x8C, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x73, 0x75, 0xC3, 0xB6, 0x25, 0x00,
+    0xB6, 0x25, 0x00, 0xB6, 0x25, 0x00, 0xB6, 0x25, 0x00, 0xB6, 0x25, 0x00, 0xB6, 0x25, 0x00, 0xBA,
+    0x25, 0x00, 0x01, 0x00, 0x75, 0xC0, 0x25, 0x00, 0x01, 0x00, 0x61, 0xC6, 0x25, 0x00, 0x00, 0x01,
+    0x0D, 0x00, 0x00, 0x01, 0x76, 0x00, 0x01, 0x00, 0x6D, 0xCC, 0x25, 0x00, 0x01, 0x00, 0x72, 0xD2,
+    0x25, 0x00, 0x01, 0x00, 0x70, 0x2C, 0x1C, 0x00, 0x01, 0x00, 0x6E, 0xD8, 0x25, 0x00, 0x01, 0x00,
+    0x65, 0xDE, 0x25, 0x00, 0x01, 0x00, 0x65, 0x30, 0x1B, 0x00, 0x01, 0x00, 0x6F, 0xE8, 0x25, 0x00,
+    0x01, 0x00, 0x64, 0x38, 0x14, 0x00, 0x01, 0x00, 0xA9, 0x38, 0x14, 0x00, 0x01, 0x00, 0x6D, 0x38,
+    0x14, 0x00, 0x04, 0x00, 0x63, 0x6D, 0x73, 0x74, 0xEE, 0x25, 0x00, 0xA4, 0x24, 0x00, 0xF4, 0x25,
+    0x00, 0xFA, 0x25, 0x00, 0x00, 0x02, 0x3D, 0x00, 0x03, 0x00, 0x6E, 0x72, 0x78, 0x00, 0x26, 0x00,
+    0x06, 0x26, 0x00, 0x0C, 0x26, 0x00, 0x06, 0x03, 0x3A, 0x00, 0x64, 0x67, 0x6C, 0x6E, 0x72, 0x73,
+    0x12, 0x26, 0x00, 0x16, 0x26, 0x00, 0x1C, 0x26, 0x00, 0x22, 0x26, 0x00, 0x12, 0x26, 0x00, 0x06,
+    0x26, 0x00, 0x05, 0x00, 0x64, 0x6C, 0x70, 0x72, 0x75, 0x2C, 0x26, 0x00, 0x12, 0x26, 0x00, 0x32,
+    0x26, 0x00, 0x38, 0x26, 0x00, 0x42, 0x26, 0x00, 0x01, 0x00, 0x6E, 0xC8, 0x22, 0x00, 0x01, 0x00,
+    0xA9, 0x48, 0x26, 0x00, 0x01, 0x00, 0x93, 0x7C, 0x22, 0x00, 0x01, 0x00, 0x6E, 0x50, 0x26, 0x00,
+    0x01, 0x00, 0x73, 0x84, 0x25, 0x00, 0x02, 0x00, 0x63, 0x66, 0x56, 0x26, 0x00, 0x5C, 0x26, 0x00,
+    0x01, 0x00, 0x6D, 0x30, 0x1B, 0x00, 0x01, 0x00, 0x72, 0x62, 0x26, 0x00, 0x01, 0x00, 0x73, 0x6C,
+    0x26, 0x00, 0x01, 0x00, 0x74, 0x2C, 0x1C, 0x00, 0x01, 0x00, 0x61, 0x72, 0x26, 0x00, 0x02, 0x00,
+    0xA9, 0xAF, 0x9A, 0x25, 0x00, 0x78, 0x26, 0x00, 0x01, 0x00, 0x68, 0x7C, 0x22, 0x00, 0x01, 0x01,
+    0x16, 0x00, 0x6E, 0x7E, 0x26, 0x00, 0x01, 0x00, 0x73, 0x7C, 0x22, 0x00, 0x00, 0x02, 0x85, 0x00,
+    0x01, 0x00, 0x73, 0xC8, 0x22, 0x00, 0x01, 0x00, 0x73, 0x82, 0x26, 0x00, 0x01, 0x00, 0xC3, 0x88,
+    0x26, 0x00, 0x02, 0x00, 0x68, 0x74, 0xFC, 0x1A, 0x00, 0x2C, 0x1C, 0x00, 0x01, 0x00, 0x68, 0x8E,
+    0x26, 0x00, 0x01, 0x00, 0xA9, 0x30, 0x1B, 0x00, 0x00, 0x01, 0x16, 0x00, 0x00, 0x02, 0x1F, 0x00,
+    0x01, 0x00, 0x6E, 0x98, 0x26, 0x00, 0x01, 0x00, 0x61, 0x9E, 0x26, 0x00, 0x01, 0x00, 0x74, 0xA8,
+    0x22, 0x00, 0x01, 0x00, 0x6E, 0x7C, 0x22, 0x00, 0x00, 0x03, 0x3A, 0x00, 0x01, 0x00, 0x61, 0xA2,
+    0x26, 0x00, 0x01, 0x00, 0xC3, 0xA8, 0x26, 0x00, 0x01, 0x00, 0x68, 0x14, 0x25, 0x00, 0x02, 0x02,
+    0x13, 0x00, 0x6C, 0x75, 0xAE, 0x26, 0x00, 0x54, 0x24, 0x00, 0x01, 0x00, 0x6F, 0xB4, 0x26, 0x00,
+    0x03, 0x00, 0x6F, 0x73, 0x75, 0xBA, 0x26, 0x00, 0xC0, 0x26, 0x00, 0xCC, 0x26, 0x00, 0x01, 0x00,
+    0x70, 0x30, 0x1B, 0x00, 0x01, 0x00, 0x73, 0xD0, 0x26, 0x00, 0x01, 0x00, 0x75, 0x30, 0x1B, 0x00,
+    0x01, 0x00, 0x69, 0x30, 0x1B, 0x00, 0x01, 0x00, 0x63, 0x22, 0x21, 0x00, 0x01, 0x00, 0x65, 0xDA,
+    0x26, 0x00, 0x01, 0x00, 0x6E, 0xE0, 0x26, 0x00, 0x01, 0x00, 0x69, 0x46, 0x21, 0x00, 0x04, 0x00,
+    0x62, 0x67, 0x6E, 0x74, 0xE8, 0x20, 0x00, 0xE8, 0x20, 0x00, 0xE6, 0x26, 0x00, 0xE8, 0x20, 0x00,
+    0x02, 0x00, 0x6D, 0x70, 0xE8, 0x20, 0x00, 0xE8, 0x20, 0x00, 0x02, 0x00, 0x63, 0x70, 0xE8, 0x20,
+    0x00, 0xE8, 0x20, 0x00, 0x02, 0x02, 0x70, 0x00, 0x65, 0x69, 0xEC, 0x26, 0x00, 0xF2, 0x26, 0x00,
+    0x01, 0x00, 0xA9, 0xFC, 0x26, 0x00, 0x02, 0x00, 0x65, 0x69, 0x8E, 0x20, 0x00, 0x06, 0x27, 0x00,
+    0x01, 0x00, 0x78, 0xA8, 0x22, 0x00, 0x01, 0x00, 0x69, 0x8E, 0x20, 0x00, 0x01, 0x00, 0x73, 0xA8,
+    0x22, 0x00, 0x01, 0x00, 0x72, 0xA8, 0x22, 0x00, 0x00, 0x01, 0x08, 0x00, 0x01, 0x00, 0x74, 0xB4,
+    0x23, 0x00, 0x02, 0x00, 0x6D, 0x6E, 0x10, 0x27, 0x00, 0x30, 0x1B, 0x00, 0x01, 0x03, 0x7A, 0x00,
+    0x72, 0x16, 0x27, 0x00, 0x00, 0x03, 0x7F, 0x00, 0x01, 0x00, 0x75, 0xB4, 0x23, 0x00, 0x01, 0x00,
+    0x6C, 0xB4, 0x23, 0x00, 0x00, 0x02, 0x7D, 0x00, 0x02, 0x00, 0x66, 0x74, 0x2C, 0x1C, 0x00, 0x2C,
+    0x1C, 0x00, 0x00, 0x03, 0x7A, 0x00, 0x01, 0x00, 0x65, 0x1A, 0x27, 0x00, 0x01, 0x00, 0x2E, 0x20,
+    0x27, 0x00, 0x01, 0x00, 0x73, 0x24, 0x27, 0x00, 0x01, 0x00, 0x2E, 0xCA, 0x0E, 0x00, 0x00, 0x02,
+    0x6D, 0x00, 0x01, 0x00, 0x6D, 0x2A, 0x27, 0x00, 0x01, 0x00, 0xC3, 0x30, 0x27, 0x00, 0x01, 0x00,
+    0x74, 0x36, 0x27, 0x00, 0x01, 0x00, 0x72, 0x3C, 0x27, 0x00, 0x01, 0x00, 0xA9, 0x42, 0x27, 0x00,
+    0x00, 0x01, 0x6A, 0x00, 0x00, 0x02, 0x27, 0x00, 0x01, 0x00, 0x6C, 0x48, 0x27, 0x00, 0x01, 0x00,
+    0x65, 0x4C, 0x27, 0x00, 0x01, 0x00, 0x6C, 0x52, 0x27, 0x00, 0x01, 0x00, 0x63, 0x56, 0x27, 0x00,
+    0x01, 0x00, 0xA9, 0x5A, 0x27, 0x00, 0x01, 0x00, 0x63, 0x5A, 0x17, 0x00, 0x01, 0x00, 0x72, 0x5A,
+    0x17, 0x00, 0x01, 0x00, 0x69, 0x72, 0x1A, 0x00, 0x01, 0x00, 0x74, 0x60, 0x27, 0x00, 0x02, 0x00,
+    0x65, 0x67, 0x1A, 0x27, 0x00, 0x60, 0x27, 0x00, 0x01, 0x00, 0x61, 0x66, 0x27, 0x00, 0x01, 0x00,
+    0x6D, 0x60, 0x27, 0x00, 0x00, 0x01, 0x30, 0x00, 0x01, 0x00, 0x6C, 0x6C, 0x27, 0x00, 0x00, 0x01,
+    0x23, 0x00, 0x01, 0x00, 0xA9, 0xB6, 0x25, 0x00, 0x01, 0x00, 0xA9, 0x72, 0x27, 0x00, 0x01, 0x00,
+    0x74, 0x04, 0x21, 0x00, 0x01, 0x00, 0x65, 0x76, 0x27, 0x00, 0x01, 0x00, 0x61, 0xCA, 0x18, 0x00,
+    0x01, 0x00, 0x69, 0x7C, 0x27, 0x00, 0x01, 0x00, 0x6C, 0x60, 0x27, 0x00, 0x01, 0x00, 0xA9, 0x82,
+    0x27, 0x00, 0x01, 0x00, 0xA2, 0x88, 0x27, 0x00, 0x01, 0x00, 0x63, 0x60, 0x27, 0x00, 0x01, 0x00,
+    0x6E, 0x98, 0x1F, 0x00, 0x00, 0x02, 0x2A, 0x00, 0x01, 0x00, 0x75, 0x78, 0x07, 0x00, 0x01, 0x00,
+    0x74, 0x8E, 0x27, 0x00, 0x01, 0x00, 0x6F, 0x78, 0x07, 0x00, 0x01, 0x00, 0xC3, 0x94, 0x27, 0x00,
+    0x04, 0x00, 0x61, 0x65, 0x69, 0x6F, 0x88, 0x23, 0x00, 0x88, 0x23, 0x00, 0x88, 0x23, 0x00, 0x9A,
+    0x27, 0x00, 0x01, 0x00, 0xA9, 0xD8, 0x1F, 0x00, 0x01, 0x00, 0x65, 0x5A, 0x17, 0x00, 0x01, 0x00,
+    0x64, 0xA0, 0x27, 0x00, 0x01, 0x00, 0x69, 0xA6, 0x27, 0x00, 0x01, 0x00, 0x6D, 0xAC, 0x27, 0x00,
+    0x01, 0x00, 0x6C, 0x6C, 0x18, 0x00, 0x01, 0x00, 0x71, 0xB2, 0x27, 0x00, 0x01, 0x00, 0x67, 0x60,
+    0x27, 0x00, 0x01, 0x00, 0x61, 0xCC, 0x26, 0x00, 0x01, 0x00, 0x72, 0xB6, 0x27, 0x00, 0x01, 0x00,
+    0xA9, 0xBC, 0x27, 0x00, 0x00, 0x02, 0x36, 0x00, 0x01, 0x00, 0x72, 0xC2, 0x27, 0x00, 0x01, 0x00,
+    0x73, 0xCC, 0x26, 0x00, 0x02, 0x03, 0x3A, 0x00, 0x63, 0x74, 0x06, 0x26, 0x00, 0xC8, 0x27, 0x00,
+    0x01, 0x02, 0x38, 0x00, 0x61, 0xCE, 0x27, 0x00, 0x04, 0x00, 0x65, 0x69, 0x6F, 0x73, 0xCC, 0x26,
+    0x00, 0xCC, 0x26, 0x00, 0xD4, 0x27, 0x00, 0xCC, 0x26, 0x00, 0x01, 0x00, 0x69, 0xDE, 0x27, 0x00,
+    0x01, 0x00, 0x70, 0xE8, 0x27, 0x00, 0x01, 0x00, 0x6B, 0xEE, 0x27, 0x00, 0x00, 0x02, 0x68, 0x00,
+    0x01, 0x00, 0x75, 0xF4, 0x27, 0x00, 0x01, 0x00, 0x72, 0x5C, 0x25, 0x00, 0x01, 0x00, 0x65, 0xFA,
+    0x27, 0x00, 0x01, 0x00, 0x6F, 0x00, 0x28, 0x00, 0x01, 0x00, 0x6F, 0x06, 0x28, 0x00, 0x01, 0x00,
+    0x61, 0x0C, 0x28, 0x00, 0x01, 0x00, 0x63, 0xCC, 0x26, 0x00, 0x00, 0x02, 0x66, 0x00, 0x01, 0x00,
+    0xC3, 0x12, 0x28, 0x00, 0x01, 0x00, 0x6E, 0x18, 0x28, 0x00, 0x00, 0x02, 0x6B, 0x00, 0x01, 0x00,
+    0x2E, 0x48, 0x17, 0x00, 0x01, 0x00, 0x72, 0xF8, 0x1A, 0x00, 0x01, 0x00, 0x62, 0xF8, 0x1A, 0x00,
+    0x01, 0x00, 0x61, 0x58, 0x1B, 0x00, 0x00, 0x01, 0x24, 0x00, 0x01, 0x00, 0xA9, 0x1E, 0x28, 0x00,
+    0x01, 0x00, 0x63, 0x22, 0x28, 0x00, 0x01, 0x00, 0x72, 0x28, 0x28, 0x00, 0x01, 0x00, 0x61, 0x2E,
+    0x28, 0x00, 0x01, 0x00, 0x65, 0x34, 0x28, 0x00, 0x01, 0x00, 0x74, 0x3A, 0x28, 0x00, 0x02, 0x00,
+    0x6D, 0x73, 0x40, 0x28, 0x00, 0x46, 0x28, 0x00, 0x01, 0x00, 0x61, 0x4C, 0x28, 0x00, 0x01, 0x00,
+    0x72, 0x12, 0x26, 0x00, 0x01, 0x00, 0x74, 0x50, 0x28, 0x00, 0x01, 0x00, 0x65, 0x56, 0x28, 0x00,
+    0x01, 0x00, 0x73, 0x5C, 0x28, 0x00, 0x01, 0x00, 0x74, 0xD4, 0x21, 0x00, 0x01, 0x00, 0x75, 0xD4,
+    0x21, 0x00, 0x00, 0x03, 0x93, 0x00, 0x01, 0x00, 0x6E, 0x12, 0x26, 0x00, 0x01, 0x00, 0x69, 0x12,
+    0x26, 0x00, 0x02, 0x00, 0x65, 0x76, 0x16, 0x26, 0x00, 0x62, 0x28, 0x00, 0x01, 0x00, 0xC3, 0x68,
+    0x28, 0x00, 0x01, 0x00, 0x69, 0x6E, 0x28, 0x00, 0x02, 0x00, 0x6D, 0x70, 0xD4, 0x21, 0x00, 0xD4,
+    0x21, 0x00, 0x01, 0x00, 0x66, 0x50, 0x28, 0x00, 0x01, 0x03, 0x53, 0x00, 0x67, 0x74, 0x28, 0x00,
+    0x01, 0x00, 0x74, 0x7A, 0x28, 0x00, 0x01, 0x00, 0x69, 0x80, 0x28, 0x00, 0x01, 0x00, 0x69, 0x86,
+    0x28, 0x00, 0x02, 0x00, 0x65, 0x6F, 0x8C, 0x28, 0x00, 0xFC, 0x1A, 0x00, 0x01, 0x00, 0xC3, 0x92,
+    0x28, 0x00, 0x01, 0x00, 0x6D, 0x9E, 0x26, 0x00, 0x01, 0x00, 0x64, 0x98, 0x28, 0x00, 0x00, 0x01,
+    0x42, 0x00, 0x01, 0x00, 0x74, 0x02, 0x25, 0x00, 0x01, 0x00, 0xA9, 0xFC, 0x1A, 0x00, 0x02, 0x00,
+    0x65, 0xC3, 0xFC, 0x1A, 0x00, 0x9E, 0x28, 0x00, 0x01, 0x00, 0x73, 0xA4, 0x28, 0x00, 0x00, 0x01,
+    0x87, 0x00, 0x01, 0x00, 0x74, 0xAA, 0x28, 0x00, 0x01, 0x00, 0xA9, 0x74, 0x1B, 0x00, 0x01, 0x00,
+    0x61, 0xA4, 0x24, 0x00, 0x01, 0x00, 0x61, 0xB0, 0x28, 0x00, 0x01, 0x00, 0x73, 0x9E, 0x26, 0x00,
+    0x02, 0x02, 0x34, 0x00, 0x73, 0x74, 0xB6, 0x28, 0x00, 0xBA, 0x28, 0x00, 0x00, 0x02, 0x34, 0x00,
+    0x02, 0x00, 0x69, 0x6F, 0x30, 0x1B, 0x00, 0x30, 0x1B, 0x00, 0x01, 0x00, 0x6E, 0xC0, 0x28, 0x00,
+    0x01, 0x00, 0x73, 0x30, 0x1B, 0x00, 0x01, 0x00, 0x64, 0xE8, 0x20, 0x00, 0x01, 0x00, 0x69, 0xC6,
+    0x28, 0x00, 0x02, 0x00, 0x63, 0x6E, 0xCC, 0x28, 0x00, 0xD2, 0x28, 0x00, 0x02, 0x00, 0x6E, 0x72,
+    0xE8, 0x20, 0x00, 0xE8, 0x20, 0x00, 0x02, 0x00, 0x73, 0x74, 0x8E, 0x20, 0x00, 0x8E, 0x20, 0x00,
+    0x01, 0x00, 0x69, 0xD6, 0x28, 0x00, 0x00, 0x03, 0x82, 0x00, 0x01, 0x00, 0x6E, 0xDC, 0x28, 0x00,
+    0x00, 0x01, 0x48, 0x00, 0x01, 0x00, 0x63, 0xE2, 0x28, 0x00, 0x01, 0x00, 0x65, 0xE8, 0x28, 0x00,
+    0x01, 0x00, 0xA9, 0xEE, 0x28, 0x00, 0x01, 0x00, 0x2E, 0xF8, 0x1A, 0x00, 0x01, 0x00, 0x6D, 0xF4,
+    0x28, 0x00, 0x01, 0x00, 0x70, 0xFA, 0x28, 0x00, 0x00, 0x01, 0x29, 0x00, 0x01, 0x00, 0x6E, 0x00,
+    0x29, 0x00, 0x00, 0x01, 0x61, 0x00, 0x00, 0x03, 0x5E, 0x00, 0x01, 0x00, 0x74, 0x06, 0x29, 0x00,
+    0x01, 0x00, 0x65, 0x0A, 0x29, 0x00, 0x01, 0x00, 0x67, 0x10, 0x29, 0x00, 0x01, 0x00, 0x6F, 0x16,
+    0x29, 0x00, 0x00, 0x01, 0x26, 0x00, 0x01, 0x00, 0x6E, 0x1C, 0x29, 0x00, 0x01, 0x00, 0x67, 0xF4,
+    0x28, 0x00, 0x01, 0x00, 0x61, 0x46, 0x21, 0x00, 0x01, 0x00, 0x67, 0x22, 0x29, 0x00, 0x01, 0x00,
+    0x69, 0x26, 0x29, 0x00, 0x01, 0x00, 0xA9, 0x2C, 0x29, 0x00, 0x01, 0x00, 0x6D, 0x88, 0x23, 0x00,
+    0x01, 0x00, 0x6F, 0x30, 0x29, 0x00, 0x01, 0x00, 0x6E, 0xF4, 0x28, 0x00, 0x01, 0x00, 0x69, 0x3A,
+    0x29, 0x00, 0x00, 0x03, 0x4B, 0x00, 0x01, 0x00, 0x64, 0xCC, 0x08, 0x00, 0x01, 0x00, 0x6F, 0x40,
+    0x29, 0x00, 0x01, 0x00, 0x61, 0x46, 0x29, 0x00, 0x01, 0x00, 0x73, 0xD4, 0x21, 0x00, 0x01, 0x00,
+    0x72, 0xF4, 0x28, 0x00, 0x02, 0x00, 0x62, 0x70, 0xCC, 0x26, 0x00, 0xCC, 0x26, 0x00, 0x02, 0x00,
+    0x6E, 0x73, 0x88, 0x23, 0x00, 0x88, 0x23, 0x00, 0x01, 0x00, 0x6F, 0x4C, 0x29, 0x00, 0x01, 0x00,
+    0x69, 0x04, 0x21, 0x00, 0x01, 0x00, 0x65, 0x5C, 0x25, 0x00, 0x01, 0x00, 0x6E, 0x52, 0x29, 0x00,
+    0x01, 0x00, 0x70, 0x58, 0x29, 0x00, 0x01, 0x00, 0x74, 0xF4, 0x28, 0x00, 0x01, 0x00, 0x6C, 0xE2,
+    0x28, 0x00, 0x01, 0x00, 0xA9, 0x60, 0x29, 0x00, 0x01, 0x00, 0x65, 0x54, 0x24, 0x00, 0x00, 0x01,
+    0x41, 0x00, 0x01, 0x00, 0x74, 0x66, 0x29, 0x00, 0x01, 0x00, 0x72, 0x66, 0x29, 0x00, 0x01, 0x00,
+    0x69, 0x6C, 0x29, 0x00, 0x01, 0x00, 0x66, 0x72, 0x29, 0x00, 0x01, 0x00, 0x2E, 0x7E, 0x26, 0x00,
+    0x01, 0x00, 0x61, 0x78, 0x29, 0x00, 0x01, 0x00, 0x63, 0x4C, 0x28, 0x00, 0x00, 0x02, 0x74, 0x00,
+    0x01, 0x00, 0x72, 0xD4, 0x21, 0x00, 0x01, 0x00, 0x6C, 0x6E, 0x28, 0x00, 0x01, 0x00, 0x69, 0x7E,
+    0x29, 0x00, 0x01, 0x00, 0x6F, 0xD4, 0x21, 0x00, 0x01, 0x00, 0xA9, 0x12, 0x26, 0x00, 0x01, 0x00,
+    0x6C, 0x12, 0x26, 0x00, 0x01, 0x00, 0x72, 0x84, 0x29, 0x00, 0x01, 0x00, 0x2E, 0xA8, 0x22, 0x00,
+    0x01, 0x00, 0x64, 0xA4, 0x21, 0x00, 0x01, 0x00, 0x63, 0xF2, 0x1F, 0x00, 0x01, 0x00, 0x73, 0xFC,
+    0x1A, 0x00, 0x01, 0x00, 0xA9, 0x2C, 0x1C, 0x00, 0x01, 0x00, 0xC3, 0x10, 0x21, 0x00, 0x01, 0x00,
+    0xA8, 0xFC, 0x1A, 0x00, 0x01, 0x00, 0x74, 0x88, 0x29, 0x00, 0x01, 0x00, 0x68, 0x8E, 0x20, 0x00,
+    0x01, 0x00, 0x6E, 0x4C, 0x28, 0x00, 0x00, 0x02, 0x8A, 0x00, 0x01, 0x00, 0x61, 0xB6, 0x28, 0x00,
+    0x01, 0x00, 0x64, 0x30, 0x1B, 0x00, 0x01, 0x00, 0x6E, 0xD2, 0x28, 0x00, 0x01, 0x00, 0x74, 0xD2,
+    0x28, 0x00, 0x00, 0x02, 0x72, 0x00, 0x01, 0x00, 0x6E, 0x30, 0x1B, 0x00, 0x01, 0x00, 0x74, 0x8C,
+    0x29, 0x00, 0x01, 0x00, 0x65, 0x92, 0x29, 0x00, 0x01, 0x00, 0x6E, 0x98, 0x29, 0x00, 0x01, 0x00,
+    0x73, 0x5E, 0x1F, 0x00, 0x01, 0x00, 0x65, 0x9E, 0x29, 0x00, 0x01, 0x00, 0x69, 0xA4, 0x29, 0x00,
+    0x01, 0x00, 0x74, 0xAA, 0x29, 0x00, 0x00, 0x03, 0x5B, 0x00, 0x01, 0x00, 0x6E, 0xB0, 0x29, 0x00,
+    0x01, 0x00, 0x6D, 0xB6, 0x29, 0x00, 0x01, 0x00, 0x71, 0xBC, 0x29, 0x00, 0x01, 0x00, 0x74, 0xC2,
+    0x29, 0x00, 0x00, 0x03, 0x53, 0x00, 0x01, 0x00, 0x6F, 0xC8, 0x29, 0x00, 0x00, 0x02, 0x4F, 0x00,
+    0x02, 0x00, 0x63, 0x7A, 0xCE, 0x29, 0x00, 0xCE, 0x29, 0x00, 0x01, 0x00, 0x6E, 0xCE, 0x29, 0x00,
+    0x01, 0x00, 0x73, 0xD4, 0x29, 0x00, 0x01, 0x00, 0x6D, 0xCE, 0x29, 0x00, 0x01, 0x00, 0x74, 0xCE,
+    0x29, 0x00, 0x01, 0x00, 0x74, 0x5C, 0x25, 0x00, 0x01, 0x02, 0x38, 0x00, 0x65, 0x8A, 0x25, 0x00,
+    0x01, 0x00, 0x73, 0xD8, 0x29, 0x00, 0x01, 0x00, 0x61, 0xDE, 0x29, 0x00, 0x01, 0x00, 0x6E, 0xE2,
+    0x29, 0x00, 0x01, 0x00, 0x65, 0xE6, 0x29, 0x00, 0x01, 0x00, 0xC3, 0xEC, 0x29, 0x00, 0x01, 0x00,
+    0x62, 0xD4, 0x21, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x02, 0x88, 0x00, 0x01, 0x00, 0x2E, 0x88,
+    0x23, 0x00, 0x01, 0x00, 0x6E, 0xF2, 0x29, 0x00, 0x01, 0x00, 0x74, 0xF8, 0x29, 0x00, 0x01, 0x00,
+    0x6E, 0xFE, 0x29, 0x00, 0x01, 0x00, 0x73, 0x9A, 0x25, 0x00, 0x01, 0x00, 0x2E, 0x54, 0x24, 0x00,
+    0x01, 0x00, 0x74, 0x04, 0x2A, 0x00, 0x01, 0x00, 0x65, 0x0A, 0x2A, 0x00, 0x01, 0x00, 0x75, 0xCE,
+    0x29, 0x00, 0x01, 0x00, 0x2E, 0x8A, 0x1B, 0x00, 0x01, 0x00, 0x6E, 0x78, 0x07, 0x00, 0x01, 0x00,
+    0x65, 0x10, 0x2A, 0x00, 0x00, 0x02, 0x2C, 0x00, 0x01, 0x00, 0x69, 0x16, 0x2A, 0x00, 0x00, 0x02,
+    0x90, 0x00, 0x00, 0x02, 0x9B, 0x00, 0x01, 0x00, 0x75, 0x1A, 0x2A, 0x00, 0x01, 0x00, 0xAE, 0x20,
+    0x2A, 0x00, 0x01, 0x00, 0x74, 0x26, 0x2A, 0x00, 0x01, 0x00, 0x2E, 0x5E, 0x24, 0x00, 0x01, 0x00,
+    0x74, 0x2C, 0x2A, 0x00, 0x01, 0x00, 0x2E, 0x48, 0x27, 0x00, 0x01, 0x00, 0x6E, 0x32, 0x2A, 0x00,
+    0x01, 0x00, 0x6E, 0x38, 0x2A, 0x00, 0x00, 0x02, 0x9F, 0x00, 0x01, 0x00, 0x69, 0x3E, 0x2A, 0x00,
+    0x01, 0x00, 0x74, 0x44, 0x2A, 0x00, 0x01, 0x00, 0x2E, 0x4A, 0x2A, 0x00, 0x01, 0x00, 0x2E, 0x4E,
+    0x2A, 0x00, 0x01, 0x00, 0x74, 0x52, 0x2A, 0x00, 0x01, 0x00, 0x74, 0x58, 0x2A, 0x00, 0x01, 0x00,
+    0x6C, 0x5E, 0x2A, 0x00, 0x01, 0x00, 0x72, 0x64, 0x2A, 0x00, 0x00, 0x01, 0x65, 0x00, 0x00, 0x01,
+    0x33, 0x00, 0x01, 0x00, 0x2E, 0x1E, 0x28, 0x00, 0x01, 0x00, 0x2E, 0x6A, 0x2A, 0x00, 0x01, 0x00,
+    0x6C, 0x6E, 0x2A, 0x00, 0x01, 0x00, 0x65, 0x4E, 0x2A, 0x00, 0x00, 0x01, 0x15, 0x00, 0x01, 0x00,
+    0x65, 0x74, 0x2A, 0x00, 0x00, 0x02, 0x99, 0x00,
+};
+
+constexpr uint8_t fr_trie_levels[] = {
+    0x01, 0x02, 0x04, 0x11, 0x22, 0x11, 0x13, 0x22, 0x53, 0x32, 0x01, 0x12, 0x33, 0x12, 0x22, 0x33,
+    0x13, 0x32, 0x41, 0x51, 0x62, 0x83, 0x42, 0x54, 0x12, 0x23, 0x31, 0x42, 0x44, 0x41, 0x52, 0x41,
+    0x62, 0x44, 0x51, 0x62, 0x72, 0x22, 0x51, 0x11, 0x32, 0x63, 0x52, 0x63, 0x81, 0x92, 0x02, 0x13,
+    0x52, 0x23, 0x32, 0x73, 0x61, 0x72, 0x53, 0x62, 0x42, 0x53, 0x42, 0x51, 0x62, 0x43, 0x52, 0x03,
+    0x12, 0x82, 0x43, 0x21, 0x32, 0x12, 0x21, 0x32, 0x23, 0x03, 0x22, 0x31, 0x42, 0x62, 0x21, 0x61,
+    0x82, 0x32, 0x43, 0x42, 0x51, 0x72, 0x34, 0x21, 0x42, 0x02, 0x23, 0x42, 0x53, 0x72, 0x42, 0x53,
+    0x62, 0x64, 0x23, 0x43, 0x52, 0x74, 0x43, 0x54, 0x01, 0x22, 0x55, 0x51, 0x72, 0x12, 0x21, 0x24,
+    0x33, 0x44, 0x34, 0x45, 0x71, 0x82, 0x41, 0x32, 0x41, 0x52, 0x32, 0x41, 0x62, 0x33, 0x42, 0x33,
+    0x42, 0x53, 0x33, 0x42, 0x63, 0x42, 0x51, 0x61, 0x73, 0x82, 0x62, 0x73, 0x54, 0x63, 0x31, 0x52,
+    0x32, 0x53, 0x31, 0x43, 0x52, 0x63, 0x43, 0x52, 0x73, 0x52, 0x83, 0x42, 0x63, 0x02, 0x12, 0x12,
+    0x22,
+};
+
+constexpr DenseHyphenationTrie fr_dense_trie = {
+    fr_trie_classes, 42u, fr_trie_dense, fr_trie_nodes, sizeof(fr_trie_nodes),
+    fr_trie_levels, sizeof(fr_trie_levels),
 };
 
 constexpr SerializedHyphenationPatterns fr_patterns = {
-    0x1AF0u,
-    fr_trie_data,
-    sizeof(fr_trie_data),
+    0u,
+    nullptr,
+    0,
+    &fr_dense_trie,
 };
@@ -6,108 +6,289 @@
 #include "../SerializedHyphenationTrie.h"
 
 // Auto-generated by generate_hyphenation_trie.py. Do not edit manually.
-alignas(4) constexpr uint8_t it_trie_data[] = {
-    0x17, 0x0C, 0x33, 0x35, 0x0C, 0x29, 0x22, 0x0D, 0x3E, 0x0B, 0x47, 0x20, 0x0D, 0x16, 0x0B, 0x34,
-    0x0D, 0x21, 0x0C, 0x3D, 0x1F, 0x0C, 0x2A, 0x17, 0x2A, 0x0B, 0x02, 0x0C, 0x01, 0x02, 0x16, 0x02,
-    0x0D, 0x0C, 0x0C, 0x0D, 0x03, 0x0C, 0x01, 0x0C, 0x0E, 0x0D, 0x04, 0x02, 0x0B, 0xA0, 0x00, 0x42,
-    0x21, 0x6E, 0xFD, 0xA0, 0x00, 0x72, 0x21, 0x6E, 0xFD, 0xA1, 0x00, 0x61, 0x6D, 0xFD, 0x21, 0x69,
-    0xFB, 0x21, 0x74, 0xFD, 0x22, 0x70, 0x6E, 0xEC, 0xFD, 0xA0, 0x00, 0x91, 0x21, 0x6F, 0xFD, 0x21,
-    0x69, 0xFD, 0xA0, 0x00, 0xA2, 0x21, 0x73, 0xFD, 0x21, 0x70, 0xFD, 0xA0, 0x00, 0xC2, 0x21, 0x6D,
-    0xFD, 0x21, 0x75, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0x72, 0xFD, 0xA0, 0x00, 0xE1, 0x21, 0x6F, 0xFD,
-    0x21, 0x72, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0xA3, 0x01, 0x11, 0x61, 0x69, 0x6F, 0xDF,
-    0xEE, 0xFD, 0xA0, 0x00, 0xF2, 0x21, 0x65, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x63,
-    0xFD, 0x21, 0x73, 0xFD, 0xA1, 0x01, 0x11, 0x69, 0xFD, 0xA0, 0x01, 0x12, 0x21, 0x75, 0xFD, 0x21,
-    0x65, 0xFD, 0x21, 0x78, 0xFD, 0xA0, 0x01, 0x32, 0x21, 0x6B, 0xFD, 0x21, 0x6E, 0xFD, 0xA0, 0x00,
-    0x71, 0x21, 0x65, 0xFD, 0x22, 0x61, 0x65, 0xF7, 0xFD, 0x21, 0x72, 0xFB, 0xA0, 0x01, 0x52, 0x21,
-    0x61, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x70, 0xFD, 0x21, 0x69, 0xFD, 0xA0, 0x01, 0x71, 0x21, 0x6F,
-    0xFD, 0x21, 0x63, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x61, 0xFD, 0xA0, 0x00, 0x61, 0x21, 0x6F, 0xFD,
-    0x21, 0x74, 0xFD, 0x41, 0x70, 0xFF, 0x50, 0x21, 0x6F, 0xFC, 0x21, 0x74, 0xFD, 0x22, 0x70, 0x72,
-    0xF3, 0xFD, 0x21, 0x61, 0xE8, 0x21, 0x72, 0xFD, 0xA0, 0x00, 0xF1, 0x22, 0x6C, 0x72, 0xFD, 0xFD,
-    0x21, 0x69, 0xE3, 0x21, 0x6C, 0xFD, 0x41, 0x65, 0xFF, 0x43, 0xA0, 0x01, 0x11, 0x25, 0x61, 0x68,
-    0x6F, 0x72, 0x73, 0xE8, 0xEE, 0xF6, 0xF9, 0xFD, 0xA0, 0x01, 0x82, 0x21, 0x72, 0xFD, 0x21, 0x63,
-    0xFD, 0x21, 0x73, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x65, 0xFD, 0xA0, 0x01, 0xA2, 0x21, 0x65, 0xFD,
-    0x21, 0x72, 0xFD, 0x21, 0x61, 0xFD, 0x41, 0x75, 0xFF, 0x4C, 0x42, 0x6C, 0x72, 0xFF, 0xFC, 0xFF,
-    0x48, 0x21, 0x62, 0xF9, 0x22, 0x68, 0x75, 0xEF, 0xFD, 0x47, 0x63, 0x64, 0x6C, 0x6E, 0x70, 0x72,
-    0x74, 0xFF, 0x5C, 0xFF, 0x5C, 0xFF, 0x5C, 0xFF, 0x5C, 0xFF, 0x5C, 0xFF, 0x5C, 0xFF, 0x5C, 0x21,
-    0x73, 0xEA, 0x21, 0x6E, 0xFD, 0x21, 0x61, 0xFD, 0xA1, 0x01, 0x11, 0x72, 0xFD, 0x41, 0x6E, 0xFF,
-    0x15, 0x21, 0x67, 0xFC, 0xA0, 0x01, 0xC2, 0x21, 0x74, 0xFD, 0x21, 0x6C, 0xFD, 0x22, 0x61, 0x65,
-    0xF4, 0xFD, 0x52, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x6C, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74,
-    0x77, 0x68, 0x6A, 0x6B, 0x7A, 0xFE, 0xC2, 0xFE, 0xCD, 0xFE, 0xF7, 0xFF, 0x12, 0xFF, 0x20, 0xFF,
-    0x37, 0xFF, 0x46, 0xFF, 0x55, 0xFF, 0x6B, 0xFF, 0x8B, 0xFF, 0xA5, 0xFF, 0xC2, 0xFF, 0xE6, 0xFF,
-    0xFB, 0xFF, 0x88, 0xFF, 0x88, 0xFF, 0x88, 0xFF, 0x88, 0xA0, 0x01, 0xE2, 0xA0, 0x00, 0xD1, 0x24,
-    0x61, 0x65, 0x6F, 0x75, 0xFD, 0xFD, 0xFD, 0xFD, 0x21, 0x6F, 0xF4, 0x21, 0x61, 0xF1, 0xA0, 0x01,
-    0xE1, 0x21, 0x2E, 0xFD, 0x24, 0x69, 0x75, 0x79, 0x74, 0xEB, 0xF4, 0xF7, 0xFD, 0x21, 0x75, 0xDF,
-    0xA0, 0x00, 0x51, 0x22, 0x69, 0x77, 0xFA, 0xFD, 0x21, 0x69, 0xD7, 0xAE, 0x02, 0x01, 0x62, 0x63,
-    0x64, 0x66, 0x6D, 0x6E, 0x70, 0x73, 0x74, 0x76, 0x6C, 0x72, 0x2E, 0x27, 0xE3, 0xE3, 0xE3, 0xE3,
-    0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xF5, 0xF5, 0xE3, 0xE3, 0x22, 0x2E, 0x27, 0xC4, 0xC7, 0xC6,
-    0x00, 0x51, 0x68, 0x2E, 0x27, 0x62, 0x72, 0x6E, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xFB, 0xFF, 0xBF,
-    0xFE, 0xFB, 0xFF, 0xBF, 0xD0, 0x02, 0x01, 0x62, 0x63, 0x64, 0x66, 0x6B, 0x6D, 0x6E, 0x71, 0x73,
-    0x74, 0x7A, 0x68, 0x6C, 0x72, 0x2E, 0x27, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF,
-    0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xEB, 0xFF,
-    0xBC, 0xFF, 0xBC, 0xFF, 0xAA, 0xFF, 0xAA, 0xCE, 0x02, 0x01, 0x62, 0x64, 0x67, 0x6C, 0x6D, 0x6E,
-    0x70, 0x72, 0x73, 0x74, 0x76, 0x77, 0x2E, 0x27, 0xFF, 0x77, 0xFF, 0x77, 0xFF, 0x77, 0xFF, 0x77,
-    0xFF, 0x77, 0xFF, 0x77, 0xFF, 0x77, 0xFF, 0x89, 0xFF, 0x77, 0xFF, 0x77, 0xFF, 0x77, 0xFF, 0x77,
-    0xFF, 0x77, 0xFF, 0x77, 0xCA, 0x02, 0x01, 0x62, 0x67, 0x66, 0x6E, 0x6C, 0x72, 0x73, 0x74, 0x2E,
-    0x27, 0xFF, 0x4A, 0xFF, 0x4A, 0xFF, 0x4A, 0xFF, 0x4A, 0xFF, 0x5C, 0xFF, 0x5C, 0xFF, 0x4A, 0xFF,
-    0x4A, 0xFF, 0x4A, 0xFF, 0x4A, 0xA0, 0x02, 0x12, 0xA1, 0x00, 0x51, 0x74, 0xFD, 0xD1, 0x02, 0x01,
-    0x62, 0x64, 0x66, 0x67, 0x68, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x76, 0x77, 0x7A, 0x2E,
-    0x27, 0xFF, 0x21, 0xFF, 0x21, 0xFF, 0x21, 0xFF, 0x21, 0xFF, 0xFB, 0xFF, 0x33, 0xFF, 0x21, 0xFF,
-    0x33, 0xFF, 0x21, 0xFF, 0x33, 0xFF, 0x21, 0xFF, 0x21, 0xFF, 0x21, 0xFF, 0x21, 0xFF, 0x21, 0xFF,
-    0x21, 0xFF, 0x21, 0x41, 0x70, 0xFD, 0x4D, 0xCB, 0x02, 0x01, 0x62, 0x64, 0x68, 0x69, 0x6C, 0x6D,
-    0x6E, 0x72, 0x76, 0x2E, 0x27, 0xFE, 0xE7, 0xFE, 0xE7, 0xFE, 0xE7, 0xFF, 0xFC, 0xFE, 0xF9, 0xFE,
-    0xE7, 0xFE, 0xE7, 0xFE, 0xE7, 0xFE, 0xE7, 0xFE, 0xE7, 0xFE, 0xE7, 0xC2, 0x02, 0x01, 0x2E, 0x27,
-    0xFE, 0xC3, 0xFE, 0xC3, 0xCB, 0x02, 0x01, 0x67, 0x66, 0x68, 0x6B, 0x6C, 0x6D, 0x72, 0x73, 0x74,
-    0x2E, 0x27, 0xFE, 0xBA, 0xFE, 0xBA, 0xFE, 0xCC, 0xFE, 0xBA, 0xFE, 0xCC, 0xFE, 0xBA, 0xFE, 0xCC,
-    0xFE, 0xBA, 0xFE, 0xBA, 0xFE, 0xBA, 0xFE, 0xBA, 0xA0, 0x02, 0x33, 0x42, 0x2E, 0x27, 0xFE, 0x93,
-    0xFE, 0x93, 0xD5, 0x02, 0x01, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E,
-    0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x7A, 0x2E, 0x27, 0xFE, 0x8C, 0xFE, 0x8C, 0xFE, 0x8C,
-    0xFF, 0xF6, 0xFE, 0x8C, 0xFE, 0x9E, 0xFE, 0x9E, 0xFE, 0x8C, 0xFE, 0x8C, 0xFE, 0x8C, 0xFE, 0x8C,
-    0xFE, 0x8C, 0xFE, 0x8C, 0xFE, 0x8C, 0xFE, 0x8C, 0xFE, 0x8C, 0xFE, 0x8C, 0xFE, 0x8C, 0xFE, 0x8C,
-    0xFE, 0x8C, 0xFF, 0xF9, 0xCF, 0x02, 0x01, 0x62, 0x63, 0x66, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72,
-    0x73, 0x74, 0x76, 0x77, 0x2E, 0x27, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A,
-    0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A,
-    0xFE, 0x4A, 0xFE, 0x4A, 0xA0, 0x02, 0x62, 0xA1, 0x01, 0xE1, 0x6E, 0xFD, 0x21, 0x72, 0xF8, 0x21,
-    0x65, 0xFD, 0xA1, 0x01, 0xE1, 0x66, 0xFD, 0x41, 0x74, 0xFE, 0x07, 0x21, 0x69, 0xFC, 0x21, 0x65,
-    0xFD, 0xD3, 0x02, 0x01, 0x62, 0x63, 0x64, 0x66, 0x67, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72,
-    0x73, 0x74, 0x76, 0x7A, 0x68, 0x2E, 0x27, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFF,
-    0xE6, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFF,
-    0xF1, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFF, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xA0, 0x02, 0x82,
-    0xA1, 0x01, 0xE1, 0x65, 0xFD, 0x21, 0x63, 0xF8, 0xA1, 0x01, 0xE1, 0x69, 0xFD, 0xCB, 0x02, 0x01,
-    0x64, 0x68, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x7A, 0x2E, 0x27, 0xFD, 0xB1, 0xFD, 0xC3, 0xFD,
-    0xC3, 0xFF, 0xF3, 0xFD, 0xB1, 0xFD, 0xC3, 0xFF, 0xFB, 0xFD, 0xB1, 0xFD, 0xB1, 0xFD, 0xB1, 0xFD,
-    0xB1, 0xC3, 0x02, 0x01, 0x71, 0x2E, 0x27, 0xFD, 0x8D, 0xFD, 0x8D, 0xFD, 0x8D, 0xA0, 0x02, 0x53,
-    0xA1, 0x01, 0xE1, 0x73, 0xFD, 0xD5, 0x02, 0x01, 0x62, 0x63, 0x64, 0x66, 0x68, 0x67, 0x6B, 0x6C,
-    0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x78, 0x77, 0x7A, 0x2E, 0x27, 0xFD, 0x79, 0xFD,
-    0x79, 0xFD, 0x79, 0xFD, 0x79, 0xFD, 0x8B, 0xFD, 0x79, 0xFD, 0x79, 0xFD, 0x79, 0xFD, 0x79, 0xFD,
-    0x79, 0xFD, 0x79, 0xFD, 0x79, 0xFD, 0x79, 0xFD, 0x79, 0xFF, 0xFB, 0xFD, 0x79, 0xFD, 0x79, 0xFD,
-    0x79, 0xFD, 0x79, 0xFD, 0x79, 0xFD, 0x79, 0x43, 0x6D, 0x2E, 0x27, 0xFD, 0x37, 0xFD, 0x37, 0xFD,
-    0x37, 0xA0, 0x02, 0xC2, 0xA1, 0x02, 0x32, 0x6D, 0xFD, 0x41, 0x6E, 0xFE, 0x8F, 0x4B, 0x62, 0x63,
-    0x64, 0x66, 0x67, 0x6D, 0x6E, 0x70, 0x73, 0x74, 0x76, 0xFD, 0x21, 0xFD, 0x21, 0xFD, 0x21, 0xFD,
-    0x21, 0xFD, 0x21, 0xFD, 0x21, 0xFD, 0x21, 0xFD, 0x21, 0xFD, 0x21, 0xFD, 0x21, 0xFD, 0x21, 0xA0,
-    0x02, 0xE1, 0x22, 0x2E, 0x27, 0xFD, 0xFD, 0xC7, 0x02, 0xA2, 0x68, 0x73, 0x70, 0x74, 0x7A, 0x2E,
-    0x27, 0xFF, 0xC0, 0xFF, 0xCD, 0xFF, 0xD2, 0xFF, 0xD6, 0xFC, 0xF7, 0xFF, 0xF8, 0xFF, 0xFB, 0xC1,
-    0x00, 0x51, 0x2E, 0xFC, 0xDF, 0x41, 0x68, 0xFF, 0x18, 0xA1, 0x00, 0x51, 0x63, 0xFC, 0xC1, 0x01,
-    0xE1, 0x73, 0xFE, 0xB6, 0xC2, 0x00, 0x51, 0x6B, 0x73, 0xFC, 0xCA, 0xFC, 0x06, 0xD2, 0x02, 0x01,
-    0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x76, 0x77, 0x7A,
-    0x2E, 0x27, 0xFC, 0xC1, 0xFC, 0xC1, 0xFC, 0xC1, 0xFC, 0xC1, 0xFC, 0xC1, 0xFF, 0xE2, 0xFC, 0xD3,
-    0xFC, 0xC1, 0xFC, 0xC1, 0xFC, 0xC1, 0xFC, 0xD3, 0xFF, 0xEC, 0xFF, 0xF1, 0xFC, 0xC1, 0xFC, 0xC1,
-    0xFF, 0xF7, 0xFC, 0xC1, 0xFE, 0x2E, 0xC6, 0x02, 0x01, 0x63, 0x6C, 0x72, 0x76, 0x2E, 0x27, 0xFC,
-    0x88, 0xFC, 0x9A, 0xFC, 0x9A, 0xFC, 0x88, 0xFC, 0x88, 0xFD, 0xF5, 0x41, 0x72, 0xFB, 0xAF, 0xA0,
-    0x02, 0xF2, 0xC5, 0x02, 0x01, 0x68, 0x61, 0x79, 0x2E, 0x27, 0xFC, 0x7E, 0xFF, 0xF9, 0xFF, 0xFD,
-    0xFC, 0x6C, 0xFC, 0x6C, 0xCA, 0x02, 0x01, 0x62, 0x63, 0x66, 0x68, 0x6D, 0x70, 0x74, 0x77, 0x2E,
-    0x27, 0xFC, 0x5A, 0xFC, 0x5A, 0xFC, 0x5A, 0xFC, 0x5A, 0xFC, 0x5A, 0xFC, 0x5A, 0xFC, 0x5A, 0xFC,
-    0x5A, 0xFC, 0x5A, 0xFC, 0x5A, 0x42, 0x6F, 0x69, 0xFC, 0x48, 0xFC, 0x27, 0xCB, 0x02, 0x01, 0x62,
-    0x64, 0x6C, 0x6E, 0x70, 0x74, 0x73, 0x76, 0x7A, 0x2E, 0x27, 0xFC, 0x32, 0xFC, 0x32, 0xFC, 0x32,
-    0xFC, 0x32, 0xFC, 0x32, 0xFC, 0x32, 0xFC, 0x32, 0xFC, 0x32, 0xFC, 0x32, 0xFC, 0x32, 0xFD, 0x9F,
-    0x5A, 0x2E, 0x27, 0x61, 0x65, 0x6F, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D,
-    0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xFB, 0xC2, 0xFB, 0xF9, 0xFC,
-    0x14, 0xFC, 0x23, 0xFC, 0x28, 0xFC, 0x2B, 0xFC, 0x64, 0xFC, 0x97, 0xFC, 0xC4, 0xFC, 0xED, 0xFD,
-    0x27, 0xFD, 0x4B, 0xFD, 0x54, 0xFD, 0x82, 0xFD, 0xC4, 0xFE, 0x11, 0xFE, 0x5D, 0xFE, 0x81, 0xFE,
-    0x95, 0xFF, 0x17, 0xFF, 0x4D, 0xFF, 0x86, 0xFF, 0xA2, 0xFF, 0xB4, 0xFF, 0xD5, 0xFF, 0xDC,
+constexpr uint8_t it_trie_classes[256] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11,
+    0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+constexpr uint32_t it_trie_dense[] = {
+    0x00000000u, 0x00000002u, 0x00000006u, 0x00000050u, 0x00000062u, 0x0000009Eu, 0x000000E2u, 0x0000011Eu,
+    0x00000128u, 0x00000154u, 0x0000019Cu, 0x00000000u, 0x000001CCu, 0x000001D8u, 0x00000208u, 0x00000260u,
+    0x000002A0u, 0x000002F0u, 0x000002F6u, 0x00000326u, 0x00000336u, 0x0000038Eu, 0x000003AEu, 0x00000000u,
+    0x000003FAu, 0x00000416u, 0x0000042Eu, 0x0000045Au, 0x00000464u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000494u, 0x0000049Eu, 0x000004A4u, 0x000004B4u, 0x000004BCu, 0x000004C2u,
+    0x00000000u, 0x000004C8u, 0x00000000u, 0x000004C8u, 0x000004C8u, 0x000004CCu, 0x00000000u, 0x000004D2u,
+    0x000004D8u, 0x000004E2u, 0x00000000u, 0x000004F8u, 0x000004FEu, 0x00000508u, 0x00000000u, 0x00000000u,
+    0x00000510u, 0x00000000u, 0x00000000u, 0x000004C8u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000051Au,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x0000052Cu, 0x00000532u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000538u,
+    0x00000000u, 0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x0000053Eu,
+    0x00000000u, 0x0000053Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000542u,
+    0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x00000000u, 0x00000542u, 0x0000053Eu, 0x0000053Eu,
+    0x00000000u, 0x0000053Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000053Eu,
+    0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x00000000u,
+    0x00000546u, 0x00000000u, 0x00000000u, 0x0000053Eu, 0x00000542u, 0x0000053Eu, 0x0000053Eu, 0x00000000u,
+    0x00000000u, 0x0000053Eu, 0x00000542u, 0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x0000053Eu,
+    0x00000000u, 0x0000053Eu, 0x00000000u, 0x00000000u, 0x0000053Eu, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x00000000u, 0x00000542u,
+    0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000562u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000542u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000053Eu, 0x0000053Eu,
+    0x00000000u, 0x0000053Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000542u, 0x00000000u, 0x0000053Eu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000542u, 0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x00000000u,
+    0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x00000568u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000542u, 0x0000053Eu, 0x00000542u, 0x00000000u, 0x0000053Eu, 0x00000000u, 0x00000542u, 0x0000053Eu,
+    0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x00000000u, 0x0000053Eu, 0x00000000u,
+    0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x0000053Eu, 0x00000570u, 0x00000000u, 0x00000000u, 0x00000542u, 0x0000053Eu, 0x0000053Eu,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x0000053Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000053Eu,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000053Eu,
+    0x0000053Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000053Eu, 0x0000053Eu,
+    0x00000542u, 0x00000000u, 0x00000000u, 0x0000053Eu, 0x00000542u, 0x0000053Eu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000542u, 0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000576u, 0x0000053Eu, 0x00000000u, 0x0000053Eu,
+    0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x00000580u, 0x0000053Eu, 0x00000542u, 0x00000000u, 0x00000542u,
+    0x0000053Eu, 0x0000053Eu, 0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x0000053Eu,
+    0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x00000000u, 0x0000053Eu,
+    0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x00000000u,
+    0x0000053Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000053Eu, 0x0000053Eu,
+    0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x0000053Eu, 0x0000053Eu, 0x0000053Eu, 0x00000000u,
+    0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000053Eu, 0x0000053Eu,
+    0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x00000584u, 0x0000058Cu,
+    0x00000000u, 0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x0000053Eu,
+    0x0000053Eu, 0x0000053Eu, 0x00000592u, 0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x0000053Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000051Au, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000053Eu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000542u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000542u, 0x00000000u, 0x0000059Au,
+    0x00000000u, 0x0000053Eu, 0x00000000u, 0x00000542u, 0x000005A2u, 0x0000053Eu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000053Eu,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x0000053Eu,
+    0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x00000542u, 0x00000000u, 0x00000000u, 0x0000053Eu, 0x0000053Eu,
+    0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x0000053Eu, 0x0000053Eu, 0x000005AAu,
+    0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x00000000u, 0x000005B2u,
+    0x000005BCu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x000005C0u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x000005CEu, 0x00000000u, 0x00000000u, 0x000005D4u, 0x000005DCu, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x0000053Eu, 0x00000000u, 0x00000576u, 0x0000053Eu, 0x00000000u, 0x0000053Eu,
+    0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x0000060Au, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000542u, 0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x00000000u, 0x00000542u,
+    0x00000612u, 0x0000061Au, 0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x00000000u, 0x00000622u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000576u, 0x0000053Eu,
+    0x00000000u, 0x00000000u, 0x0000053Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000542u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000542u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000053Eu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x0000062Eu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000542u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000634u, 0x00000000u, 0x00000000u,
+    0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x0000053Eu, 0x00000000u, 0x00000000u, 0x0000053Eu,
+    0x00000000u, 0x0000053Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000053Eu, 0x00000000u,
+    0x00000000u, 0x0000053Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000053Eu, 0x00000000u, 0x00000000u,
+    0x0000053Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000638u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000562u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000576u, 0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x00000000u, 0x0000053Eu,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000053Eu,
+    0x00000000u, 0x0000053Eu, 0x00000000u, 0x0000053Eu, 0x00000000u, 0x00000000u, 0x0000053Eu, 0x0000053Eu,
+    0x00000000u, 0x0000053Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000053Eu,
+};
+
+constexpr uint8_t it_trie_nodes[] = {
+    0x00, 0x00, 0x00, 0x02, 0x1C, 0x00, 0x12, 0x00, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x68, 0x6A,
+    0x6B, 0x6C, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x77, 0x7A, 0x94, 0x04, 0x00, 0x9E, 0x04, 0x00,
+    0xA4, 0x04, 0x00, 0xB4, 0x04, 0x00, 0xBC, 0x04, 0x00, 0xC2, 0x04, 0x00, 0xC8, 0x04, 0x00, 0xC8,
+    0x04, 0x00, 0xC8, 0x04, 0x00, 0xCC, 0x04, 0x00, 0xD2, 0x04, 0x00, 0xD8, 0x04, 0x00, 0xE2, 0x04,
+    0x00, 0xF8, 0x04, 0x00, 0xFE, 0x04, 0x00, 0x08, 0x05, 0x00, 0x10, 0x05, 0x00, 0xC8, 0x04, 0x00,
+    0x04, 0x00, 0x69, 0x74, 0x75, 0x79, 0x1A, 0x05, 0x00, 0x2C, 0x05, 0x00, 0x32, 0x05, 0x00, 0x38,
+    0x05, 0x00, 0x0E, 0x01, 0x00, 0x00, 0x27, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x6C, 0x6D, 0x6E, 0x70,
+    0x72, 0x73, 0x74, 0x76, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00,
+    0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x42, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E,
+    0x05, 0x00, 0x42, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x10, 0x01,
+    0x00, 0x00, 0x27, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x68, 0x6B, 0x6C, 0x6D, 0x6E, 0x71, 0x72, 0x73,
+    0x74, 0x7A, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05,
+    0x00, 0x3E, 0x05, 0x00, 0x46, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x42, 0x05, 0x00, 0x3E, 0x05, 0x00,
+    0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x42, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E,
+    0x05, 0x00, 0x0E, 0x01, 0x00, 0x00, 0x27, 0x2E, 0x62, 0x64, 0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x72,
+    0x73, 0x74, 0x76, 0x77, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00,
+    0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x42,
+    0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x02, 0x00,
+    0x69, 0x77, 0x62, 0x05, 0x00, 0x42, 0x05, 0x00, 0x0A, 0x01, 0x00, 0x00, 0x27, 0x2E, 0x62, 0x66,
+    0x67, 0x6C, 0x6E, 0x72, 0x73, 0x74, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E,
+    0x05, 0x00, 0x3E, 0x05, 0x00, 0x42, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x42, 0x05, 0x00, 0x3E, 0x05,
+    0x00, 0x3E, 0x05, 0x00, 0x11, 0x01, 0x00, 0x00, 0x27, 0x2E, 0x62, 0x64, 0x66, 0x67, 0x68, 0x6C,
+    0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x76, 0x77, 0x7A, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E,
+    0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x68, 0x05, 0x00, 0x42, 0x05,
+    0x00, 0x3E, 0x05, 0x00, 0x42, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x42, 0x05, 0x00, 0x3E, 0x05, 0x00,
+    0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x0B, 0x01, 0x00, 0x00,
+    0x27, 0x2E, 0x62, 0x64, 0x68, 0x69, 0x6C, 0x6D, 0x6E, 0x72, 0x76, 0x3E, 0x05, 0x00, 0x3E, 0x05,
+    0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x70, 0x05, 0x00, 0x42, 0x05, 0x00,
+    0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x02, 0x01, 0x00, 0x00,
+    0x27, 0x2E, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x0B, 0x01, 0x00, 0x00, 0x27, 0x2E, 0x66, 0x67,
+    0x68, 0x6B, 0x6C, 0x6D, 0x72, 0x73, 0x74, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00,
+    0x3E, 0x05, 0x00, 0x42, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x42, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x42,
+    0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x15, 0x01, 0x00, 0x00, 0x27, 0x2E, 0x62, 0x63,
+    0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77,
+    0x7A, 0x76, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00,
+    0x80, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x42, 0x05, 0x00, 0x42, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E,
+    0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05,
+    0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00,
+    0x0F, 0x01, 0x00, 0x00, 0x27, 0x2E, 0x62, 0x63, 0x66, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73,
+    0x74, 0x76, 0x77, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E,
+    0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05,
+    0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00,
+    0x13, 0x01, 0x00, 0x00, 0x27, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6B, 0x6C, 0x6D, 0x6E,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x7A, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00,
+    0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x84, 0x05, 0x00, 0x8C, 0x05, 0x00, 0x3E,
+    0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05,
+    0x00, 0x3E, 0x05, 0x00, 0x92, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00,
+    0x01, 0x00, 0x69, 0x1A, 0x05, 0x00, 0x0B, 0x01, 0x00, 0x00, 0x27, 0x2E, 0x64, 0x68, 0x6C, 0x6E,
+    0x70, 0x72, 0x73, 0x74, 0x7A, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x42, 0x05,
+    0x00, 0x42, 0x05, 0x00, 0x9A, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x42, 0x05, 0x00, 0xA2, 0x05, 0x00,
+    0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x03, 0x01, 0x00, 0x00, 0x27, 0x2E, 0x71, 0x3E, 0x05, 0x00,
+    0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x15, 0x01, 0x00, 0x00, 0x27, 0x2E, 0x62, 0x63, 0x64, 0x66,
+    0x67, 0x68, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x7A, 0x3E,
+    0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05,
+    0x00, 0x3E, 0x05, 0x00, 0x42, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00,
+    0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0xAA,
+    0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x07, 0x02,
+    0x0B, 0x00, 0x27, 0x2E, 0x68, 0x70, 0x73, 0x74, 0x7A, 0xB2, 0x05, 0x00, 0xBC, 0x05, 0x00, 0xC0,
+    0x05, 0x00, 0xCE, 0x05, 0x00, 0xD4, 0x05, 0x00, 0xDC, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x12, 0x01,
+    0x00, 0x00, 0x27, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73,
+    0x74, 0x76, 0x77, 0x7A, 0x76, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00,
+    0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x0A, 0x06, 0x00, 0x42, 0x05, 0x00, 0x3E,
+    0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x42, 0x05, 0x00, 0x12, 0x06, 0x00, 0x1A, 0x06,
+    0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x22, 0x06, 0x00, 0x06, 0x01, 0x00, 0x00, 0x27, 0x2E,
+    0x63, 0x6C, 0x72, 0x76, 0x76, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x42, 0x05, 0x00,
+    0x42, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x05, 0x01, 0x00, 0x00, 0x27, 0x2E, 0x61, 0x68, 0x79, 0x3E,
+    0x05, 0x00, 0x3E, 0x05, 0x00, 0x2E, 0x06, 0x00, 0x42, 0x05, 0x00, 0x34, 0x06, 0x00, 0x0A, 0x01,
+    0x00, 0x00, 0x27, 0x2E, 0x62, 0x63, 0x66, 0x68, 0x6D, 0x70, 0x74, 0x77, 0x3E, 0x05, 0x00, 0x3E,
+    0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05,
+    0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x02, 0x00, 0x69, 0x6F, 0x38, 0x06,
+    0x00, 0x62, 0x05, 0x00, 0x0B, 0x01, 0x00, 0x00, 0x27, 0x2E, 0x62, 0x64, 0x6C, 0x6E, 0x70, 0x73,
+    0x74, 0x76, 0x7A, 0x76, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E,
+    0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05,
+    0x00, 0x3E, 0x05, 0x00, 0x02, 0x00, 0x6E, 0x70, 0x3C, 0x06, 0x00, 0x42, 0x06, 0x00, 0x01, 0x00,
+    0x69, 0x48, 0x06, 0x00, 0x03, 0x01, 0x05, 0x00, 0x61, 0x69, 0x6F, 0x4E, 0x06, 0x00, 0x54, 0x06,
+    0x00, 0x5A, 0x06, 0x00, 0x01, 0x01, 0x05, 0x00, 0x69, 0x60, 0x06, 0x00, 0x01, 0x00, 0x78, 0x66,
+    0x06, 0x00, 0x01, 0x00, 0x72, 0x6C, 0x06, 0x00, 0x00, 0x01, 0x05, 0x00, 0x01, 0x00, 0x69, 0x76,
+    0x06, 0x00, 0x01, 0x00, 0x61, 0x7C, 0x06, 0x00, 0x02, 0x00, 0x70, 0x72, 0x82, 0x06, 0x00, 0x88,
+    0x06, 0x00, 0x05, 0x00, 0x61, 0x68, 0x6F, 0x72, 0x73, 0x8E, 0x06, 0x00, 0x94, 0x06, 0x00, 0x9E,
+    0x06, 0x00, 0xA4, 0x06, 0x00, 0xC8, 0x04, 0x00, 0x01, 0x00, 0x65, 0xAA, 0x06, 0x00, 0x02, 0x00,
+    0x68, 0x75, 0xB0, 0x06, 0x00, 0xB6, 0x06, 0x00, 0x01, 0x01, 0x05, 0x00, 0x72, 0xBC, 0x06, 0x00,
+    0x02, 0x00, 0x61, 0x65, 0xC2, 0x06, 0x00, 0xC8, 0x06, 0x00, 0x04, 0x00, 0x61, 0x65, 0x6F, 0x75,
+    0x38, 0x06, 0x00, 0x38, 0x06, 0x00, 0x38, 0x06, 0x00, 0x38, 0x06, 0x00, 0x01, 0x00, 0x2E, 0x3E,
+    0x05, 0x00, 0x01, 0x00, 0x6F, 0x38, 0x06, 0x00, 0x01, 0x00, 0x61, 0x38, 0x06, 0x00, 0x00, 0x01,
+    0x01, 0x00, 0x00, 0x01, 0x06, 0x00, 0x06, 0x01, 0x06, 0x00, 0x27, 0x2E, 0x62, 0x68, 0x6E, 0x72,
+    0xCE, 0x06, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0xC8,
+    0x04, 0x00, 0x01, 0x00, 0x75, 0x38, 0x06, 0x00, 0x01, 0x01, 0x06, 0x00, 0x74, 0xD8, 0x06, 0x00,
+    0x01, 0x00, 0x70, 0x42, 0x06, 0x00, 0x02, 0x00, 0x27, 0x2E, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00,
+    0x00, 0x03, 0x0E, 0x00, 0x01, 0x01, 0x01, 0x00, 0x6E, 0xDC, 0x06, 0x00, 0x01, 0x00, 0x65, 0xE0,
+    0x06, 0x00, 0x01, 0x01, 0x01, 0x00, 0x66, 0xE6, 0x06, 0x00, 0x01, 0x01, 0x01, 0x00, 0x65, 0xEC,
+    0x06, 0x00, 0x01, 0x01, 0x01, 0x00, 0x69, 0xF0, 0x06, 0x00, 0x01, 0x01, 0x01, 0x00, 0x73, 0xF6,
+    0x06, 0x00, 0x02, 0x00, 0x27, 0x2E, 0xBC, 0x05, 0x00, 0xBC, 0x05, 0x00, 0x00, 0x01, 0x0D, 0x00,
+    0x03, 0x00, 0x27, 0x2E, 0x6D, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x01, 0x00,
+    0x6E, 0x80, 0x05, 0x00, 0x01, 0x02, 0x11, 0x00, 0x6D, 0xFA, 0x06, 0x00, 0x0B, 0x00, 0x62, 0x63,
+    0x64, 0x66, 0x67, 0x6D, 0x6E, 0x70, 0x73, 0x74, 0x76, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E,
+    0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05,
+    0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x01, 0x01, 0x06, 0x00, 0x2E, 0x3E,
+    0x05, 0x00, 0x01, 0x01, 0x06, 0x00, 0x63, 0xFE, 0x06, 0x00, 0x01, 0x01, 0x01, 0x00, 0x73, 0xDC,
+    0x06, 0x00, 0x02, 0x01, 0x06, 0x00, 0x6B, 0x73, 0x3E, 0x05, 0x00, 0xC8, 0x04, 0x00, 0x01, 0x00,
+    0x72, 0xC8, 0x04, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x01, 0x02, 0x00, 0x01, 0x00, 0x74, 0x04,
+    0x07, 0x00, 0x01, 0x00, 0x6E, 0x0A, 0x07, 0x00, 0x01, 0x00, 0x6F, 0x0E, 0x07, 0x00, 0x01, 0x00,
+    0x70, 0x12, 0x07, 0x00, 0x01, 0x00, 0x72, 0x18, 0x07, 0x00, 0x01, 0x00, 0x6E, 0x1E, 0x07, 0x00,
+    0x01, 0x00, 0x73, 0x24, 0x07, 0x00, 0x01, 0x00, 0x65, 0x2A, 0x07, 0x00, 0x02, 0x00, 0x61, 0x65,
+    0x30, 0x07, 0x00, 0x36, 0x07, 0x00, 0x01, 0x00, 0x70, 0x3C, 0x07, 0x00, 0x01, 0x00, 0x72, 0x42,
+    0x07, 0x00, 0x01, 0x00, 0x74, 0x48, 0x07, 0x00, 0x01, 0x00, 0x74, 0x4E, 0x07, 0x00, 0x01, 0x00,
+    0x72, 0x54, 0x07, 0x00, 0x02, 0x00, 0x6C, 0x72, 0x5A, 0x07, 0x00, 0x5A, 0x07, 0x00, 0x01, 0x00,
+    0x6C, 0x5E, 0x07, 0x00, 0x01, 0x00, 0x65, 0x0E, 0x07, 0x00, 0x01, 0x00, 0x69, 0x64, 0x07, 0x00,
+    0x01, 0x00, 0x61, 0x6A, 0x07, 0x00, 0x01, 0x00, 0x62, 0x70, 0x07, 0x00, 0x01, 0x00, 0x61, 0x7A,
+    0x07, 0x00, 0x01, 0x00, 0x67, 0x80, 0x07, 0x00, 0x01, 0x00, 0x6C, 0x86, 0x07, 0x00, 0x02, 0x00,
+    0x27, 0x2E, 0x2C, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x00, 0x02, 0x1A, 0x00, 0x00, 0x02, 0x07, 0x00,
+    0x01, 0x00, 0x69, 0x8C, 0x07, 0x00, 0x01, 0x00, 0x65, 0x92, 0x07, 0x00, 0x00, 0x02, 0x09, 0x00,
+    0x01, 0x00, 0x63, 0xEC, 0x06, 0x00, 0x00, 0x03, 0x15, 0x00, 0x00, 0x02, 0x13, 0x00, 0x01, 0x00,
+    0x68, 0xEC, 0x06, 0x00, 0x01, 0x00, 0x69, 0x98, 0x07, 0x00, 0x00, 0x02, 0x18, 0x00, 0x00, 0x01,
+    0x28, 0x00, 0x01, 0x00, 0x73, 0xA0, 0x07, 0x00, 0x01, 0x00, 0x63, 0xA4, 0x07, 0x00, 0x01, 0x00,
+    0x74, 0xAA, 0x07, 0x00, 0x01, 0x00, 0x63, 0xB0, 0x07, 0x00, 0x01, 0x00, 0x75, 0xB6, 0x07, 0x00,
+    0x01, 0x00, 0x6E, 0xBA, 0x07, 0x00, 0x01, 0x00, 0x65, 0xC0, 0x07, 0x00, 0x01, 0x00, 0x73, 0xC4,
+    0x07, 0x00, 0x01, 0x00, 0x63, 0xCA, 0x07, 0x00, 0x01, 0x00, 0x6F, 0xD0, 0x07, 0x00, 0x01, 0x00,
+    0x6F, 0xD4, 0x07, 0x00, 0x01, 0x00, 0x61, 0xD0, 0x07, 0x00, 0x00, 0x01, 0x2B, 0x00, 0x01, 0x00,
+    0x69, 0xD4, 0x07, 0x00, 0x01, 0x00, 0x73, 0xDA, 0x07, 0x00, 0x01, 0x00, 0x72, 0xE0, 0x07, 0x00,
+    0x02, 0x00, 0x6C, 0x72, 0xE6, 0x07, 0x00, 0xEC, 0x07, 0x00, 0x01, 0x00, 0x6E, 0xF0, 0x07, 0x00,
+    0x01, 0x00, 0x6E, 0xEC, 0x07, 0x00, 0x01, 0x00, 0x74, 0xF6, 0x07, 0x00, 0x01, 0x00, 0x74, 0x3E,
+    0x05, 0x00, 0x01, 0x00, 0x72, 0xDC, 0x06, 0x00, 0x01, 0x01, 0x2C, 0x00, 0x6D, 0xFA, 0x07, 0x00,
+    0x00, 0x02, 0x36, 0x00, 0x01, 0x00, 0x75, 0x00, 0x08, 0x00, 0x01, 0x00, 0x72, 0x06, 0x08, 0x00,
+    0x01, 0x00, 0x69, 0x0C, 0x08, 0x00, 0x00, 0x02, 0x31, 0x00, 0x01, 0x00, 0x6B, 0x12, 0x08, 0x00,
+    0x00, 0x01, 0x30, 0x00, 0x01, 0x00, 0x61, 0x16, 0x08, 0x00, 0x01, 0x00, 0x6F, 0x1A, 0x08, 0x00,
+    0x00, 0x01, 0x2C, 0x00, 0x01, 0x00, 0x70, 0x1E, 0x08, 0x00, 0x01, 0x00, 0x63, 0x22, 0x08, 0x00,
+    0x01, 0x00, 0x65, 0x28, 0x08, 0x00, 0x01, 0x00, 0x75, 0xEC, 0x07, 0x00, 0x00, 0x02, 0x20, 0x00,
+    0x01, 0x00, 0x73, 0x2C, 0x08, 0x00, 0x00, 0x02, 0x1E, 0x00, 0x01, 0x00, 0x6E, 0x1E, 0x08, 0x00,
+    0x01, 0x00, 0x6D, 0x4A, 0x08, 0x00, 0x01, 0x00, 0x6F, 0x4E, 0x08, 0x00, 0x01, 0x00, 0x6E, 0x52,
+    0x08, 0x00, 0x00, 0x02, 0x22, 0x00, 0x00, 0x02, 0x2E, 0x00, 0x00, 0x01, 0x2D, 0x00, 0x00, 0x02,
+    0x29, 0x00, 0x01, 0x00, 0x72, 0x58, 0x08, 0x00, 0x00, 0x02, 0x24, 0x00, 0x07, 0x00, 0x63, 0x64,
+    0x6C, 0x6E, 0x70, 0x72, 0x74, 0x12, 0x08, 0x00, 0x12, 0x08, 0x00, 0x12, 0x08, 0x00, 0x12, 0x08,
+    0x00, 0x12, 0x08, 0x00, 0x12, 0x08, 0x00, 0x12, 0x08, 0x00, 0x00, 0x02, 0x34, 0x00, 0x00, 0x01,
+    0x33, 0x00, 0x01, 0x00, 0x65, 0xEC, 0x07, 0x00, 0x00, 0x02, 0x26, 0x00,
+};
+
+constexpr uint8_t it_trie_levels[] = {
+    0x01, 0x02, 0x11, 0x02, 0x11, 0x22, 0x12, 0x12, 0x23, 0x03, 0x12, 0x01, 0x12, 0x04, 0x02, 0x13,
+    0x22, 0x02, 0x13, 0x14, 0x23, 0x12, 0x22, 0x33, 0x23, 0x32, 0x02, 0x22, 0x02, 0x12, 0x42, 0x51,
+    0x32, 0x43, 0x52, 0x63, 0x42, 0x63, 0x31, 0x42, 0x41, 0x53, 0x62, 0x32, 0x51, 0x61, 0x33, 0x42,
+    0x53, 0x22, 0x31, 0x71, 0x62, 0x71, 0x34, 0x43,
+};
+
+constexpr DenseHyphenationTrie it_dense_trie = {
+    it_trie_classes, 29u, it_trie_dense, it_trie_nodes, sizeof(it_trie_nodes),
+    it_trie_levels, sizeof(it_trie_levels),
 };
 
 constexpr SerializedHyphenationPatterns it_patterns = {
-    0x5C0u,
-    it_trie_data,
-    sizeof(it_trie_data),
+    0u,
+    nullptr,
+    0,
+    &it_dense_trie,
 };
@@ -6,2095 +6,3193 @@
 #include "../SerializedHyphenationTrie.h"
 
 // Auto-generated by generate_hyphenation_trie.py. Do not edit manually.
-alignas(4) constexpr uint8_t ru_trie_data[] = {
-    0x33, 0x48, 0x34, 0x49, 0x34, 0x15, 0x16, 0x47, 0x34, 0x17, 0x35, 0x16, 0x36, 0x5B, 0x34, 0x29,
-    0x33, 0x16, 0x49, 0x16, 0x5C, 0x04, 0x17, 0x2A, 0x3F, 0x2B, 0x3E, 0x3D, 0x17, 0x16, 0x02, 0x3D,
-    0x16, 0x16, 0x15, 0x40, 0x17, 0x2A, 0x15, 0x01, 0x51, 0x52, 0x16, 0x15, 0x16, 0x29, 0x16, 0x02,
-    0x15, 0x3F, 0x16, 0x02, 0x29, 0x03, 0x03, 0x2A, 0x41, 0x18, 0x01, 0x16, 0x53, 0x16, 0x02, 0x17,
-    0x16, 0x3D, 0x02, 0x16, 0x2B, 0x16, 0x3E, 0x15, 0x02, 0x15, 0x16, 0x2C, 0x03, 0x16, 0x02, 0x2A,
-    0x2A, 0x29, 0x01, 0x16, 0x16, 0x2A, 0x15, 0x16, 0x2A, 0x17, 0x03, 0x3F, 0x01, 0x29, 0x01, 0x16,
-    0x15, 0x29, 0x2A, 0x66, 0x16, 0x17, 0x04, 0x17, 0x29, 0x15, 0x2A, 0x17, 0x3E, 0x17, 0x02, 0x2A,
-    0x15, 0x67, 0x18, 0x17, 0x3D, 0x18, 0x18, 0x15, 0x15, 0x18, 0x04, 0x16, 0x02, 0x15, 0x16, 0x15,
-    0x01, 0x3E, 0x01, 0x16, 0x17, 0x02, 0x15, 0x2B, 0x52, 0x15, 0x65, 0x52, 0x17, 0x29, 0x16, 0x17,
-    0x29, 0x18, 0x04, 0x15, 0x03, 0x29, 0x16, 0x02, 0x3F, 0x03, 0x2B, 0x16, 0x51, 0x16, 0x54, 0x01,
-    0x2A, 0x02, 0x3F, 0x16, 0x04, 0x19, 0x01, 0x18, 0x2C, 0x15, 0x03, 0x3E, 0x03, 0x16, 0x2A, 0x04,
-    0x15, 0x16, 0x54, 0x17, 0x17, 0x18, 0x29, 0x17, 0x15, 0x29, 0x16, 0x06, 0x2B, 0x18, 0x2C, 0x15,
-    0x16, 0x66, 0x15, 0x3F, 0x16, 0x17, 0x02, 0x65, 0x3A, 0x08, 0x08, 0x11, 0x1C, 0x30, 0x26, 0x1C,
-    0x08, 0x1C, 0xA0, 0x00, 0x41, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xF7, 0x21, 0xD0,
-    0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0xA0, 0x00, 0x51, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD,
-    0xA0, 0x00, 0x61, 0xA0, 0x00, 0x71, 0x21, 0x8F, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x8C, 0xFD, 0x21,
-    0xD1, 0xFD, 0x26, 0xB1, 0xB3, 0xB4, 0xB8, 0xBA, 0xBB, 0xD6, 0xE2, 0xEB, 0xEE, 0xD6, 0xFD, 0xA0,
-    0x00, 0x83, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0xA0, 0x00,
-    0xB1, 0x21, 0x80, 0xFD, 0x22, 0xD0, 0xD1, 0xB7, 0xFD, 0x21, 0x82, 0xFB, 0x21, 0xD1, 0xFD, 0x23,
-    0x80, 0x81, 0x83, 0xEC, 0xFD, 0xC1, 0xA0, 0x0D, 0x11, 0x23, 0xD0, 0xD1, 0x2D, 0xC9, 0xF6, 0xFD,
-    0x41, 0xBE, 0xFF, 0xB0, 0x21, 0xD0, 0xFC, 0x41, 0xB0, 0xFF, 0xA9, 0x21, 0xD0, 0xFC, 0x21, 0x80,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB8, 0xBE, 0xEA, 0xFD, 0x22,
-    0xD0, 0x2D, 0xFB, 0xD7, 0xA0, 0x00, 0xC2, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0xA0, 0x00, 0xE2,
-    0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB1, 0xB6, 0xF4, 0xFD, 0x21, 0xD0, 0xFB, 0x21, 0xBE,
-    0xFD, 0x41, 0x80, 0xFF, 0x66, 0x21, 0xD1, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81,
-    0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xED, 0xFF, 0xFD, 0xFF, 0xA5, 0x41, 0x84, 0xFF, 0x55, 0x21,
-    0xD1, 0xFC, 0x21, 0xBE, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xFF, 0x91, 0x41, 0xB2, 0xFF, 0x26,
-    0xA1, 0x00, 0x51, 0xD0, 0xFC, 0x21, 0xBA, 0xFB, 0x21, 0xD0, 0xFD, 0x41, 0xBA, 0xFF, 0x35, 0x21,
-    0xD0, 0xFC, 0x42, 0xB0, 0xBE, 0xFF, 0xFD, 0xFF, 0x10, 0x21, 0xD0, 0xF9, 0xA0, 0x00, 0xE1, 0x41,
-    0xBB, 0xFF, 0x18, 0x21, 0xD0, 0xFC, 0xA0, 0x01, 0x42, 0x22, 0xB5, 0xB8, 0xFA, 0xFD, 0x21, 0x91,
-    0xF5, 0x22, 0xD0, 0xD1, 0xF8, 0xFD, 0x21, 0x80, 0xFB, 0x21, 0xD1, 0xFD, 0x22, 0xBF, 0xB1, 0xE0,
-    0xFD, 0x41, 0x82, 0xFF, 0x7C, 0x22, 0xD0, 0xD1, 0xF7, 0xFC, 0x23, 0xB5, 0xB8, 0xBE, 0xBE, 0xCF,
-    0xFB, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xFF, 0x35, 0x41, 0xB8, 0xFE, 0xEB, 0x21, 0xD0, 0xFC, 0x21,
-    0xBF, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xFF, 0x24, 0x41, 0xBD, 0xFF, 0x54, 0x21, 0xD0, 0xFC,
-    0x43, 0xB2, 0xBC, 0xBF, 0xFF, 0x65, 0xFF, 0xFD, 0xFF, 0xAC, 0x21, 0xD0, 0xF6, 0x21, 0xB0, 0xFD,
-    0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xFF, 0x06, 0x42, 0xB3, 0xBD, 0xFE, 0xB0, 0xFF, 0x95, 0x21, 0xD0,
-    0xF9, 0xA0, 0x01, 0x01, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0xA1, 0x00, 0x61,
-    0xD0, 0xFD, 0x45, 0xB3, 0xB7, 0xB8, 0xBA, 0xBE, 0xFE, 0x86, 0xFF, 0xEC, 0xFE, 0x9E, 0xFE, 0x86,
-    0xFF, 0xFB, 0x41, 0x81, 0xFF, 0x6A, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xFC, 0xFE, 0xD0,
-    0x41, 0x80, 0xFE, 0xF4, 0x21, 0xD1, 0xFC, 0x42, 0xBE, 0xBF, 0xFE, 0x79, 0xFF, 0xFD, 0x41, 0xBA,
-    0xFE, 0xA0, 0x21, 0xD0, 0xFC, 0x21, 0x81, 0xFD, 0x22, 0xD0, 0xD1, 0xEF, 0xFD, 0x21, 0xB5, 0xFB,
-    0xA0, 0x01, 0x11, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x42,
-    0x8C, 0x8E, 0xFE, 0x51, 0xFF, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE7, 0xFF, 0xF9, 0xFE, 0x90,
-    0x41, 0x83, 0xFE, 0x5F, 0x21, 0xD1, 0xFC, 0x21, 0xB6, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xBC, 0xFE,
-    0x15, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0xA0, 0x00, 0x82, 0x21, 0xBA, 0xFD,
-    0x21, 0xD0, 0xFD, 0x23, 0xB5, 0xB8, 0xBE, 0xE7, 0xF4, 0xFD, 0xA0, 0x01, 0x22, 0x21, 0x82, 0xFD,
-    0x21, 0xD1, 0xFD, 0x21, 0x88, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x83, 0xFD, 0x43, 0xD0, 0xD1, 0x2D,
-    0xFF, 0xE7, 0xFF, 0xFD, 0xFE, 0x4A, 0x42, 0x82, 0x88, 0xFE, 0xD6, 0xFE, 0x77, 0x42, 0xD0, 0xD1,
-    0xFE, 0xAF, 0xFF, 0xF9, 0x41, 0xBD, 0xFE, 0xC8, 0x21, 0xD0, 0xFC, 0x43, 0xB2, 0xB4, 0xB7, 0xFF,
-    0xFD, 0xFD, 0xCD, 0xFE, 0xCB, 0x41, 0xBB, 0xFD, 0xBD, 0x41, 0x86, 0xFE, 0xBD, 0x22, 0xD0, 0xD1,
-    0xF8, 0xFC, 0x42, 0x81, 0x82, 0xFF, 0xFB, 0xFE, 0xAA, 0xA2, 0x0C, 0xC1, 0xD0, 0xD1, 0xE2, 0xF9,
-    0x41, 0xD1, 0xFF, 0x55, 0x23, 0xB0, 0xB5, 0xBE, 0xC9, 0xF5, 0xFC, 0x41, 0xBB, 0xFD, 0xE3, 0x21,
-    0xD0, 0xFC, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x83, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF,
-    0xE9, 0xFF, 0xFD, 0xFD, 0xEB, 0xA0, 0x01, 0x62, 0x21, 0xB6, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x8E,
-    0xFD, 0x92, 0x21, 0xD1, 0xFC, 0x21, 0x8E, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0xBE, 0xBB, 0xF0, 0xFD,
-    0x42, 0xB5, 0xB9, 0xFD, 0x80, 0xFD, 0x80, 0x22, 0xD0, 0xD1, 0xF9, 0xE7, 0x42, 0xB2, 0xBB, 0xFD,
-    0x74, 0xFD, 0x74, 0x41, 0x82, 0xFD, 0x6D, 0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0x22, 0xB5, 0xB8, 0xEB,
-    0xFB, 0x21, 0xD0, 0xFB, 0x21, 0x80, 0xFD, 0x22, 0xD0, 0xD1, 0xD4, 0xFD, 0x41, 0xBE, 0xFD, 0x82,
-    0x21, 0xD0, 0xFC, 0x44, 0xB1, 0xB2, 0xB3, 0xB7, 0xFF, 0xF4, 0xFF, 0xFD, 0xFF, 0x65, 0xFE, 0x9E,
-    0x41, 0xB8, 0xFE, 0x1C, 0xA1, 0x00, 0x61, 0xD0, 0xFC, 0x42, 0xBA, 0xBF, 0xFD, 0x92, 0xFF, 0xFB,
-    0x21, 0xD0, 0xF9, 0x41, 0x83, 0xFD, 0x0F, 0x42, 0xD0, 0xD1, 0xFD, 0x14, 0xFF, 0xFC, 0x41, 0xB6,
-    0xFD, 0x04, 0x21, 0xD0, 0xFC, 0x22, 0x80, 0x83, 0xF2, 0xFD, 0x42, 0xD0, 0xD1, 0xFD, 0xD2, 0xFF,
-    0xFB, 0x22, 0x81, 0x82, 0xDF, 0xF9, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xBD, 0xFF, 0xFB, 0xFD, 0x50,
-    0x41, 0xBD, 0xFC, 0xF7, 0x21, 0xD0, 0xFC, 0x41, 0x83, 0xFC, 0xF0, 0x21, 0xD1, 0xFC, 0x21, 0xBD,
-    0xFD, 0x21, 0xD0, 0xFD, 0x44, 0xB2, 0xB6, 0xB7, 0xBC, 0xFD, 0x69, 0xFD, 0x69, 0xFF, 0xF0, 0xFF,
-    0xFD, 0x21, 0xD0, 0xF3, 0x41, 0x81, 0xFE, 0xB6, 0x21, 0xD1, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xBE, 0xB0, 0xEA, 0xFD, 0xA0, 0x01, 0x81, 0x21,
-    0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x43, 0xD0,
-    0xD1, 0x2D, 0xFF, 0xE9, 0xFF, 0xFD, 0xFC, 0xF8, 0x41, 0x2D, 0xFC, 0xEE, 0x50, 0xB0, 0xB1, 0xB2,
-    0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB6, 0xB9, 0xBA, 0xFC, 0xED, 0xFD,
-    0x13, 0xFD, 0x45, 0xFD, 0x59, 0xFD, 0xB5, 0xFD, 0xC6, 0xFD, 0xE4, 0xFE, 0x1A, 0xFE, 0x5A, 0xFE,
-    0xA0, 0xFE, 0xFF, 0xFF, 0x9A, 0xFF, 0xF2, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x41, 0x82, 0xFC,
-    0xE7, 0x21, 0xD1, 0xFC, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0x80, 0xFC, 0x66, 0x21, 0xD1,
-    0xFC, 0x41, 0xB2, 0xFC, 0xD3, 0x21, 0xD0, 0xFC, 0x43, 0xB1, 0xB7, 0xB0, 0xFF, 0xF6, 0xFF, 0xFD,
-    0xFF, 0x5C, 0x21, 0xD0, 0xF6, 0x42, 0x81, 0x87, 0xFD, 0x1A, 0xFC, 0x4B, 0x21, 0xD1, 0xF9, 0x21,
-    0xB7, 0xE6, 0x41, 0xB8, 0xFC, 0xB2, 0x21, 0xD0, 0xFC, 0x42, 0xBB, 0xBF, 0xFC, 0xAB, 0xFF, 0xFD,
-    0x21, 0xD0, 0xF9, 0x42, 0x81, 0x85, 0xFF, 0xFD, 0xFC, 0x2D, 0x22, 0xD0, 0xD1, 0xE5, 0xF9, 0x24,
-    0xB0, 0xB5, 0xB8, 0xBE, 0xB8, 0xD3, 0xDD, 0xFB, 0x21, 0xB1, 0xB6, 0x21, 0xD0, 0xFD, 0x21, 0x91,
-    0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEE, 0xFF, 0xFD, 0xFC, 0x55, 0x41, 0x82, 0xFF, 0x41, 0x21,
-    0xD1, 0xFC, 0x21, 0xBF, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xBB, 0xFC, 0x53, 0x21, 0xD0, 0xFC, 0x21,
-    0xBF, 0xFD, 0x21, 0xD0, 0xFD, 0x43, 0xB5, 0xBA, 0xBE, 0xFF, 0xF0, 0xFB, 0xEB, 0xFF, 0xFD, 0x41,
-    0xB6, 0xFB, 0xE1, 0x21, 0xD0, 0xFC, 0x42, 0x82, 0x83, 0xFB, 0xDA, 0xFF, 0xFD, 0x43, 0xD0, 0xD1,
-    0x2D, 0xFF, 0xE8, 0xFF, 0xF9, 0xFC, 0x19, 0x41, 0xBE, 0xFC, 0x3D, 0x21, 0xD0, 0xFC, 0xC1, 0x00,
-    0x61, 0xD1, 0xFB, 0xF3, 0x43, 0xB0, 0xB3, 0xBE, 0xFB, 0xBF, 0xFF, 0xFA, 0xFB, 0xBC, 0x21, 0xD0,
-    0xF6, 0x22, 0xB5, 0xB8, 0xEA, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFB, 0xFB, 0xF0, 0x41, 0xBD, 0xFB,
-    0xFE, 0x21, 0xD0, 0xFC, 0x41, 0x87, 0xFB, 0x9C, 0x21, 0xD1, 0xFC, 0x48, 0xB1, 0xB4, 0xB5, 0xB7,
-    0xBA, 0xBC, 0xBE, 0xBF, 0xFB, 0x95, 0xFB, 0x95, 0xFB, 0x95, 0xFF, 0xF6, 0xFB, 0x95, 0xFF, 0xFD,
-    0xFC, 0x71, 0xFB, 0x95, 0x41, 0xB2, 0xFB, 0x7C, 0x21, 0xD0, 0xFC, 0x45, 0x80, 0x81, 0x82, 0x8E,
-    0x91, 0xFF, 0xFD, 0xFB, 0x75, 0xFF, 0x13, 0xFB, 0x75, 0xFB, 0x75, 0x43, 0xD0, 0xD1, 0x2D, 0xFF,
-    0xD0, 0xFF, 0xF0, 0xFB, 0xAB, 0x41, 0x80, 0xFF, 0x00, 0x21, 0xD1, 0xFC, 0x21, 0xBE, 0xFD, 0x42,
-    0xD0, 0x2D, 0xFF, 0xFD, 0xFB, 0x97, 0x41, 0x81, 0xFD, 0x2A, 0x21, 0xD1, 0xFC, 0x21, 0xB5, 0xFD,
-    0x21, 0x91, 0xFA, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xFA, 0xFF, 0xFD, 0xFB, 0x83, 0x41, 0x81, 0xFB,
-    0x15, 0x42, 0xD1, 0x2D, 0xFF, 0xFC, 0xFB, 0x75, 0x51, 0x80, 0x81, 0x82, 0x83, 0x85, 0x87, 0x8E,
-    0x91, 0x84, 0x86, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8F, 0xFF, 0x19, 0xFF, 0x55, 0xFF, 0x7E,
-    0xFF, 0xC3, 0xFF, 0xD7, 0xFF, 0xEB, 0xFF, 0xF9, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80,
-    0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0x42, 0xD0, 0xD1, 0xFE,
-    0x50, 0xFF, 0xCC, 0xA0, 0x01, 0xB1, 0x21, 0xBF, 0xFD, 0x22, 0x80, 0x86, 0xFA, 0xFA, 0xA0, 0x0D,
-    0x42, 0xA3, 0x01, 0x92, 0xD0, 0xD1, 0x2D, 0xF5, 0xF8, 0xFD, 0xA0, 0x01, 0xC1, 0x21, 0x82, 0xFD,
-    0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0xA0, 0x00, 0xD1, 0x21, 0xB0, 0xFD, 0x21,
-    0x8E, 0xD4, 0x22, 0xD0, 0xD1, 0xFA, 0xFD, 0x22, 0xB5, 0xBB, 0xEF, 0xFB, 0xA0, 0x01, 0x31, 0x21,
-    0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x80, 0x83, 0xFD, 0xE4, 0xA3, 0x00, 0x91, 0xD0, 0xD1, 0x2D,
-    0xED, 0xFB, 0xC4, 0xA0, 0x00, 0x91, 0xA0, 0x01, 0xD1, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0xA0,
-    0x01, 0xE1, 0x21, 0xB0, 0xFD, 0xA1, 0x00, 0x91, 0xD0, 0xFD, 0xA0, 0x01, 0xF1, 0xA0, 0x00, 0xA1,
-    0x22, 0x81, 0x82, 0xFA, 0xFD, 0xA1, 0x00, 0x91, 0xD1, 0xFB, 0x25, 0xB2, 0xB5, 0xB7, 0xB8, 0xBE,
-    0xC2, 0xD9, 0xE2, 0xEB, 0xFB, 0x21, 0xB0, 0xB7, 0x21, 0xD0, 0xFD, 0x41, 0xB5, 0xFF, 0x78, 0x21,
-    0xD0, 0xFC, 0xA0, 0x02, 0x02, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x27, 0x80, 0x81, 0x82, 0x83,
-    0x85, 0x87, 0x91, 0xED, 0xF4, 0xD2, 0xB8, 0xD2, 0xFD, 0xB8, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD0,
-    0xFF, 0xF1, 0xFF, 0x64, 0xA0, 0x02, 0x32, 0x21, 0x81, 0xFD, 0xA1, 0x02, 0x21, 0xD1, 0xFD, 0x41,
-    0xB8, 0xFF, 0xAE, 0x21, 0xD0, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x42, 0x81, 0x82, 0xFF,
-    0xA1, 0xFF, 0x37, 0x21, 0xD1, 0xF9, 0x43, 0xB5, 0xB8, 0xBE, 0xFF, 0x97, 0xFF, 0x2D, 0xFF, 0xFD,
-    0x21, 0xD0, 0xF6, 0xA0, 0x02, 0x21, 0x45, 0xB0, 0xB4, 0xB8, 0xBB, 0xBE, 0xFF, 0xD4, 0xFF, 0x87,
-    0xFF, 0xE3, 0xFF, 0xFA, 0xFF, 0xFD, 0x41, 0x83, 0xFF, 0x33, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC,
-    0xFF, 0xFC, 0xFF, 0x14, 0x41, 0xB5, 0xFF, 0x69, 0x41, 0x91, 0xFF, 0x65, 0xA2, 0x02, 0x21, 0xD0,
-    0xD1, 0xF8, 0xFC, 0x41, 0xB8, 0xFE, 0xF0, 0x21, 0xD0, 0xFC, 0x41, 0xB4, 0xFF, 0x45, 0x21, 0xD0,
-    0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0xA0, 0x02, 0x52, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0xB1, 0xFD, 0x21, 0xD0, 0xFD, 0x45, 0xB2, 0xB6, 0xB8, 0xBB, 0xBE, 0xFF, 0xD6, 0xFF, 0xE1,
-    0xFF, 0xEE, 0xFF, 0x37, 0xFF, 0xFD, 0x41, 0xBE, 0xFE, 0xF6, 0x21, 0x83, 0xDD, 0x22, 0xD0, 0xD1,
-    0xF9, 0xFD, 0x41, 0x87, 0xFE, 0xC8, 0x21, 0xD1, 0xFC, 0x41, 0xBD, 0xFF, 0x14, 0x21, 0xD0, 0xFC,
-    0x44, 0x80, 0x83, 0x86, 0x8B, 0xFF, 0xED, 0xFF, 0xF6, 0xFE, 0xA3, 0xFF, 0xFD, 0xC3, 0x00, 0x91,
-    0xD0, 0xD1, 0x2D, 0xFF, 0xC9, 0xFF, 0xF3, 0xFE, 0xA1, 0x41, 0xBE, 0xFE, 0x8A, 0x21, 0xD0, 0xFC,
-    0x44, 0xB3, 0xB4, 0xBB, 0xBF, 0xFF, 0xFD, 0xFF, 0x97, 0xFE, 0x83, 0xFE, 0xED, 0x42, 0x80, 0x81,
-    0xFF, 0x02, 0xFE, 0x76, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xF9, 0xFE, 0x7A,
-    0xA0, 0x02, 0x72, 0x21, 0x88, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xB7, 0xFE, 0xAD, 0x21, 0xD0, 0xFC,
-    0x42, 0xB5, 0xBB, 0xFF, 0xFD, 0xFE, 0x8C, 0x21, 0x91, 0xF6, 0xA2, 0x01, 0xE1, 0xD0, 0xD1, 0xF6,
-    0xFD, 0x41, 0x80, 0xFE, 0x7B, 0x21, 0xD1, 0xFC, 0xA0, 0x02, 0x92, 0x21, 0x80, 0xFD, 0xA1, 0x01,
-    0x31, 0xD1, 0xFD, 0x41, 0x8C, 0xFE, 0x9A, 0x21, 0xD1, 0xFC, 0x23, 0xB1, 0xB2, 0xBB, 0xF4, 0xFD,
-    0xFD, 0x41, 0xB8, 0xFE, 0x72, 0x21, 0xD0, 0xFC, 0x22, 0x80, 0x81, 0xFD, 0xE0, 0x22, 0xD0, 0xD1,
-    0xED, 0xFB, 0x45, 0xB0, 0xB2, 0xB3, 0xB4, 0xBE, 0xFF, 0xB4, 0xFF, 0xC8, 0xFE, 0x6D, 0xFF, 0xD3,
-    0xFF, 0xFB, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF0, 0xFF, 0xBF, 0xFE, 0x0C, 0x41, 0xBB, 0xFE, 0x4A,
-    0xA1, 0x02, 0x92, 0xD0, 0xFC, 0x21, 0xB3, 0xFB, 0x41, 0x85, 0xFE, 0x55, 0xC3, 0x00, 0x91, 0xD0,
-    0xD1, 0x2D, 0xFF, 0xF9, 0xFF, 0xFC, 0xFD, 0xF2, 0xA0, 0x02, 0xB1, 0x41, 0xBC, 0xFE, 0x2B, 0x21,
-    0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0xA1, 0x01, 0xB1, 0xD0, 0xFD, 0x41, 0x81, 0xFE, 0xA9, 0x21, 0xD1,
-    0xFC, 0x42, 0xB1, 0xBD, 0xFE, 0x73, 0xFF, 0xFD, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xFD, 0xD5, 0x44,
-    0xB2, 0xBA, 0xBB, 0xBE, 0xFD, 0xED, 0xFF, 0xD9, 0xFF, 0xE6, 0xFF, 0xF9, 0x41, 0xB8, 0xFE, 0x87,
-    0x21, 0xD0, 0xFC, 0x42, 0x80, 0x81, 0xFF, 0xFD, 0xFD, 0xD9, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D,
-    0xFF, 0xE5, 0xFF, 0xF9, 0xFD, 0xA4, 0x41, 0xB3, 0xFD, 0xB3, 0xA1, 0x00, 0x91, 0xD0, 0xFC, 0x41,
-    0xBA, 0xFE, 0x64, 0xA1, 0x00, 0x91, 0xD0, 0xFC, 0x41, 0xB7, 0xFD, 0xE2, 0x21, 0xD0, 0xFC, 0x44,
-    0xB0, 0xB5, 0xB8, 0xBE, 0xFF, 0xEB, 0xFF, 0xF4, 0xFD, 0x9A, 0xFF, 0xFD, 0xA0, 0x02, 0xC1, 0x21,
-    0x82, 0xFD, 0xA1, 0x01, 0xE1, 0xD1, 0xFD, 0x21, 0x88, 0xFB, 0xA1, 0x00, 0x91, 0xD1, 0xFD, 0x41,
-    0x89, 0xFD, 0xBE, 0x21, 0xD1, 0xFC, 0x45, 0x83, 0x8B, 0x8C, 0x8E, 0x91, 0xFF, 0xF4, 0xFD, 0x9D,
-    0xFF, 0xFD, 0xFD, 0x9D, 0xFF, 0xCD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xC9, 0xFF, 0xF0, 0xFD, 0x48,
-    0xA0, 0x02, 0x71, 0x41, 0x82, 0xFE, 0x10, 0x21, 0xD1, 0xFC, 0x41, 0x82, 0xFD, 0x93, 0x21, 0xD1,
-    0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x82, 0xFD, 0x1C, 0x21, 0xD1, 0xFC, 0x21, 0xB5,
-    0xFD, 0x21, 0x91, 0xFA, 0x22, 0xD0, 0xD1, 0xFA, 0xFD, 0xA0, 0x02, 0xD1, 0x42, 0xB7, 0xB8, 0xFD,
-    0xB8, 0xFF, 0xFD, 0xA1, 0x02, 0x21, 0xD0, 0xF9, 0x46, 0xB0, 0xB1, 0xB5, 0xB8, 0xBD, 0xBE, 0xFD,
-    0xDB, 0xFF, 0xC8, 0xFF, 0xCF, 0xFF, 0xDC, 0xFF, 0xEC, 0xFF, 0xFB, 0x42, 0x87, 0x91, 0xFD, 0x52,
-    0xFF, 0xBC, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE6, 0xFF, 0xF9, 0xFC, 0xEC, 0x41, 0x86, 0xFD, 0x33,
-    0x21, 0xD1, 0xFC, 0xA0, 0x02, 0xE3, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB4, 0xBC, 0xF4,
-    0xFD, 0x41, 0x84, 0xFD, 0x2C, 0x22, 0xD0, 0xD1, 0xF7, 0xFC, 0x41, 0xB0, 0xFC, 0xB9, 0x21, 0xD0,
-    0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB1, 0xDC, 0xA0, 0x03, 0x12, 0x21, 0x80, 0xFD,
-    0x21, 0xD1, 0xFD, 0x21, 0x85, 0xFD, 0x22, 0xD0, 0xD1, 0xF1, 0xFD, 0x23, 0xB0, 0xB4, 0xBE, 0xDA,
-    0xE9, 0xFB, 0x41, 0x80, 0xFC, 0x91, 0xA1, 0x01, 0xF1, 0xD1, 0xFC, 0x21, 0x83, 0xFB, 0x42, 0xD0,
-    0xD1, 0xFC, 0x88, 0xFF, 0xFD, 0x41, 0xB7, 0xFD, 0xA2, 0x21, 0xD0, 0xFC, 0x41, 0x88, 0xFC, 0xE1,
-    0xA1, 0x00, 0x91, 0xD1, 0xFC, 0x44, 0x80, 0x81, 0x83, 0x8C, 0xFC, 0xA7, 0xFF, 0xE9, 0xFF, 0xF4,
-    0xFF, 0xFB, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xC9, 0xFF, 0xF3, 0xFC, 0x6C, 0x42, 0xB4, 0xBA, 0xFC,
-    0x57, 0xFC, 0x57, 0xC1, 0x01, 0xB1, 0xD1, 0xFE, 0xEC, 0x42, 0x80, 0x81, 0xFC, 0x4A, 0xFF, 0xFA,
-    0xC3, 0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xF9, 0xFC, 0x4E, 0x41, 0xBC, 0xFC, 0x37,
-    0x21, 0xD0, 0xFC, 0x42, 0xB0, 0xBE, 0xFC, 0x56, 0xFF, 0xFD, 0x21, 0xD0, 0xF9, 0x41, 0x81, 0xFE,
-    0xF3, 0x21, 0xD1, 0xFC, 0x21, 0xB2, 0xFD, 0xA0, 0x03, 0x52, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD,
-    0x21, 0x87, 0xFD, 0xA2, 0x02, 0x21, 0xD0, 0xD1, 0xF1, 0xFD, 0x22, 0xBB, 0xBE, 0xE0, 0xF9, 0x41,
-    0xBB, 0xFC, 0x3D, 0x21, 0xD0, 0xFC, 0x42, 0xB0, 0xB5, 0xFB, 0xFD, 0xFF, 0xFD, 0x21, 0xD0, 0xF9,
-    0x21, 0x80, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE7, 0xFF, 0xFD, 0xFB, 0xFB, 0x41, 0x2D, 0xFB,
-    0xF1, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
-    0xB6, 0xB9, 0xFB, 0xF0, 0xFC, 0x29, 0xFC, 0x89, 0xFC, 0xD9, 0xFD, 0x4C, 0xFD, 0x73, 0xFD, 0xE1,
-    0xFD, 0xFB, 0xFE, 0x49, 0xFE, 0xA5, 0xFF, 0x01, 0xFF, 0x81, 0xFF, 0x9F, 0xFF, 0xF2, 0xFF, 0xFC,
-    0xFF, 0xFC, 0x41, 0x82, 0xFC, 0x0D, 0x21, 0xD1, 0xFC, 0x21, 0x81, 0xFD, 0xA1, 0x00, 0x91, 0xD1,
-    0xFD, 0x41, 0xBA, 0xFB, 0xA2, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xBB,
-    0xFB, 0x95, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x83, 0xFD, 0xAD, 0x21,
-    0xD1, 0xFC, 0x41, 0xB2, 0xFB, 0xE8, 0x21, 0xD0, 0xFC, 0x41, 0xBB, 0xFB, 0xE1, 0x21, 0xD0, 0xFC,
-    0x22, 0xB4, 0xBE, 0xF6, 0xFD, 0xA1, 0x00, 0x91, 0xD0, 0xFB, 0x48, 0xB0, 0xB1, 0xB2, 0xB3, 0xB5,
-    0xB6, 0xB8, 0xBE, 0xFF, 0xC2, 0xFF, 0xD1, 0xFF, 0xDE, 0xFF, 0xE5, 0xFF, 0xFB, 0xFE, 0xB4, 0xFB,
-    0xB9, 0xFB, 0xB9, 0x41, 0xD1, 0xFE, 0xBF, 0x21, 0xBE, 0xFC, 0x42, 0xD0, 0xD1, 0xFF, 0xFD, 0xFD,
-    0x11, 0x47, 0x82, 0x83, 0x85, 0x8B, 0x8E, 0x8F, 0x91, 0xFF, 0xF9, 0xFB, 0x92, 0xFB, 0x7B, 0xFB,
-    0x92, 0xFB, 0x92, 0xFB, 0x92, 0xFB, 0x92, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xC3, 0xFF, 0xEA, 0xFB,
-    0x37, 0xA0, 0x03, 0x72, 0x41, 0xB8, 0xFB, 0x72, 0x21, 0xD0, 0xFC, 0x43, 0xBA, 0xBC, 0xBD, 0xFF,
-    0xF6, 0xFF, 0xFD, 0xFB, 0x71, 0x41, 0xB3, 0xFD, 0x33, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21,
-    0xD0, 0xFD, 0x41, 0x83, 0xFB, 0x68, 0x21, 0xD1, 0xFC, 0x41, 0xBD, 0xFA, 0xFA, 0x41, 0x8F, 0xFA,
-    0xF6, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x41, 0xD0, 0xFC, 0x30, 0x44, 0xB2, 0xB5, 0xB8, 0xBE, 0xFF,
-    0xEC, 0xFD, 0x15, 0xFF, 0xF7, 0xFF, 0xFC, 0x41, 0x85, 0xFB, 0x15, 0x21, 0xD1, 0xFC, 0x41, 0xB5,
-    0xFB, 0x25, 0x21, 0xD0, 0xFC, 0x43, 0x83, 0x8C, 0x91, 0xFF, 0xF6, 0xFF, 0xFD, 0xFC, 0xFA, 0x22,
-    0xD0, 0xD1, 0xDB, 0xF6, 0x41, 0xB4, 0xFA, 0xBF, 0x41, 0x81, 0xFA, 0xBB, 0x22, 0xD0, 0xD1, 0xF8,
-    0xFC, 0x21, 0xB5, 0xFB, 0x21, 0xD0, 0xFD, 0x44, 0x81, 0x82, 0x88, 0x8C, 0xFF, 0xA8, 0xFF, 0xE8,
-    0xFF, 0xFD, 0xFC, 0x8E, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0x87, 0xFF, 0xF3, 0xFA, 0xAA, 0x41, 0xBA,
-    0xFC, 0xBA, 0xA1, 0x00, 0x91, 0xD0, 0xFC, 0x42, 0xB0, 0xB8, 0xFA, 0xDF, 0xFA, 0xC5, 0x41, 0x83,
-    0xFA, 0xBE, 0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0x41, 0xB7, 0xFB, 0x5C, 0x21, 0xD0, 0xFC, 0x41, 0xB5,
-    0xFA, 0xAE, 0x21, 0xD0, 0xFC, 0x42, 0xB1, 0xBC, 0xFF, 0xFD, 0xFB, 0xC8, 0x41, 0x88, 0xFA, 0xC3,
-    0xA2, 0x00, 0x91, 0xD0, 0xD1, 0xF5, 0xFC, 0x45, 0xB0, 0xB2, 0xB5, 0xB8, 0xBE, 0xFF, 0xCB, 0xFF,
-    0xDB, 0xFF, 0xE4, 0xFA, 0xAC, 0xFF, 0xF9, 0x41, 0xBA, 0xFD, 0x42, 0x21, 0xD0, 0xFC, 0x21, 0x81,
-    0xFD, 0x21, 0xD1, 0xFD, 0x43, 0xB0, 0xB8, 0xBE, 0xFF, 0x67, 0xFA, 0x78, 0xFF, 0xFD, 0x21, 0xD0,
-    0xF6, 0x43, 0x8E, 0x8F, 0x91, 0xFA, 0x58, 0xFA, 0x58, 0xFA, 0x82, 0x42, 0xD0, 0xD1, 0xFF, 0x53,
-    0xFF, 0xF6, 0x47, 0x80, 0x83, 0x85, 0x8B, 0x8C, 0x8E, 0x8F, 0xFF, 0xEC, 0xFA, 0x71, 0xFA, 0x21,
-    0xFA, 0x71, 0xFF, 0xF9, 0xFA, 0x71, 0xFA, 0x71, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xAF, 0xFF, 0xEA,
-    0xFA, 0x16, 0xC1, 0x01, 0xB1, 0xD0, 0xFA, 0x57, 0x41, 0xD0, 0xFA, 0xFC, 0x43, 0xB1, 0xB4, 0xBB,
-    0xFA, 0x61, 0xFF, 0xF6, 0xFF, 0xFC, 0x41, 0x80, 0xFA, 0x54, 0x21, 0xD1, 0xFC, 0x41, 0x8C, 0xFA,
-    0x39, 0xA1, 0x01, 0xB1, 0xD1, 0xFC, 0x44, 0x82, 0x85, 0x87, 0x8D, 0xFF, 0xF4, 0xF9, 0xDD, 0xFF,
-    0xFB, 0xFA, 0x44, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xD9, 0xFF, 0xF3, 0xF9, 0xDB, 0x42,
-    0xD0, 0x2D, 0xFA, 0xEB, 0xF9, 0xCF, 0x41, 0xB8, 0xFC, 0xB3, 0x21, 0xD0, 0xFC, 0x42, 0xB0, 0xBC,
-    0xF9, 0xB6, 0xFF, 0xFD, 0x41, 0x81, 0xFA, 0x02, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF5, 0xFF, 0xFC,
-    0xF9, 0xB6, 0x42, 0xB0, 0xBB, 0xFA, 0x81, 0xFA, 0x0B, 0x41, 0x82, 0xF9, 0xD3, 0xC3, 0x00, 0x91,
-    0xD0, 0xD1, 0x2D, 0xFF, 0xF5, 0xFF, 0xFC, 0xF9, 0xA1, 0x41, 0xBB, 0xF9, 0xF4, 0x42, 0xD0, 0x2D,
-    0xFF, 0xFC, 0xF9, 0x91, 0x41, 0xBB, 0xFA, 0x93, 0x41, 0x80, 0xF9, 0xE5, 0x43, 0xD0, 0xD1, 0x2D,
-    0xFF, 0xF8, 0xFF, 0xFC, 0xF9, 0x82, 0x41, 0x82, 0xF9, 0xF2, 0x42, 0xD1, 0x2D, 0xFF, 0xFC, 0xF9,
-    0x74, 0x43, 0xB1, 0xB2, 0xB7, 0xF9, 0x62, 0xF9, 0x62, 0xF9, 0x62, 0xC2, 0x00, 0x91, 0xD0, 0x2D,
-    0xFF, 0xF6, 0xF9, 0x63, 0xC1, 0x00, 0x91, 0x2D, 0xF9, 0x5A, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84,
-    0x85, 0x87, 0x88, 0x8D, 0x8E, 0x8F, 0x91, 0x86, 0x89, 0x8A, 0x8B, 0x8C, 0xFE, 0x1D, 0xFE, 0xAA,
-    0xFF, 0x3E, 0xFF, 0x79, 0xFF, 0x85, 0xFF, 0x9E, 0xFF, 0xB3, 0xFF, 0xC3, 0xFF, 0xD2, 0xFF, 0xE0,
-    0xFF, 0xF1, 0xFF, 0xFA, 0xFD, 0x63, 0xFD, 0x63, 0xFD, 0x63, 0xFD, 0x63, 0xFD, 0x63, 0x42, 0xD0,
-    0xD1, 0xFD, 0x33, 0xFF, 0xCC, 0x41, 0xB2, 0xF9, 0x0E, 0x21, 0xD0, 0xFC, 0x41, 0xD1, 0xFA, 0xCF,
-    0x41, 0x83, 0xF9, 0x56, 0xA1, 0x01, 0x31, 0xD1, 0xFC, 0x41, 0x8E, 0xFB, 0x93, 0x21, 0xD1, 0xFC,
-    0x46, 0xB1, 0xB3, 0xB4, 0xB7, 0xBB, 0xBE, 0xFF, 0xE9, 0xFF, 0xEC, 0xFD, 0xA3, 0xFF, 0xF4, 0xFF,
-    0xFD, 0xF8, 0xF3, 0x41, 0xBC, 0xF8, 0xF7, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xFF, 0x42, 0x42, 0x81,
-    0x82, 0xFF, 0xF9, 0xFA, 0x97, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xDB, 0xFF, 0xF9, 0xF8,
-    0xD9, 0xC1, 0x03, 0x32, 0x2D, 0xF8, 0xCD, 0x41, 0x8B, 0xF9, 0x18, 0xC2, 0x00, 0x91, 0xD1, 0x2D,
-    0xFF, 0xFC, 0xF8, 0xC3, 0xC1, 0x01, 0xB1, 0x2D, 0xF8, 0xBA, 0xA0, 0x03, 0x91, 0x42, 0xBB, 0xBD,
-    0xF8, 0xA6, 0xF8, 0xA6, 0x21, 0xD0, 0xF9, 0xA0, 0x03, 0xC2, 0x45, 0xB0, 0xB4, 0xB8, 0xBD, 0xBE,
-    0xF9, 0x4A, 0xFF, 0xFD, 0xF8, 0xEC, 0xF8, 0xB0, 0xF9, 0x4A, 0x41, 0x81, 0xFB, 0x7F, 0x21, 0xD1,
-    0xFC, 0x42, 0x80, 0x83, 0xF8, 0xE9, 0xFF, 0xFD, 0xA2, 0x03, 0xA2, 0xD0, 0xD1, 0xE2, 0xF9, 0x45,
-    0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xFF, 0xCB, 0xFF, 0xD5, 0xFF, 0x6D, 0xFF, 0xCB, 0xFF, 0xF9, 0x42,
-    0xBA, 0xBF, 0xFA, 0x29, 0xF8, 0x7B, 0x42, 0xB5, 0xB8, 0xF8, 0x74, 0xF8, 0x74, 0xA1, 0x02, 0x92,
-    0xD0, 0xF9, 0x21, 0x82, 0xFB, 0x22, 0xD0, 0xD1, 0xEA, 0xFD, 0x43, 0x81, 0x86, 0x89, 0xFF, 0xFB,
-    0xFF, 0xA0, 0xF9, 0x29, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xCB, 0xFF, 0xF6, 0xF8, 0x4A,
-    0xC1, 0x02, 0x21, 0x2D, 0xF8, 0x3E, 0xC1, 0x00, 0x92, 0x2D, 0xF8, 0x38, 0xA0, 0x04, 0x02, 0x21,
-    0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x43, 0xB1, 0xB4, 0xBD, 0xF8,
-    0x18, 0xF8, 0x18, 0xF8, 0x18, 0xC2, 0x03, 0x91, 0xD0, 0xD1, 0xFF, 0xF6, 0xFB, 0x7D, 0x41, 0xBE,
-    0xFD, 0xC3, 0x21, 0xD0, 0xFC, 0x47, 0xB0, 0xB1, 0xB6, 0xBA, 0xBB, 0xBE, 0xBD, 0xFF, 0x55, 0xF7,
-    0xFE, 0xF8, 0xDE, 0xFF, 0x55, 0xFF, 0xE3, 0xFF, 0xF0, 0xFF, 0xFD, 0x42, 0x82, 0x85, 0xFE, 0xDE,
-    0xF8, 0x21, 0xC3, 0x03, 0xE2, 0xD0, 0xD1, 0x2D, 0xFF, 0xE3, 0xFF, 0xF9, 0xF7, 0xEC, 0xC1, 0x04,
-    0x22, 0x2D, 0xF7, 0xE0, 0x41, 0xB8, 0xF7, 0xF5, 0xA1, 0x03, 0xE2, 0xD0, 0xFC, 0x43, 0xB3, 0xB7,
-    0xBD, 0xF9, 0xEB, 0xFF, 0xFB, 0xF8, 0x30, 0x21, 0xD0, 0xF6, 0xA0, 0x03, 0xE2, 0x42, 0xB5, 0xBD,
-    0xFF, 0xFD, 0xF7, 0xDC, 0xA0, 0x04, 0x42, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x81, 0x8F,
-    0xFD, 0xED, 0x22, 0xD0, 0xD1, 0xEB, 0xFB, 0x22, 0xB0, 0xB5, 0xE0, 0xFB, 0x42, 0xB4, 0xB6, 0xF8,
-    0x01, 0xFF, 0xDE, 0x21, 0xD0, 0xF9, 0xA0, 0x04, 0x62, 0xA0, 0x04, 0x22, 0x43, 0xB4, 0xB5, 0xBB,
-    0xF7, 0xF1, 0xF7, 0xF1, 0xF7, 0xF1, 0x21, 0x8C, 0xF3, 0x21, 0xD1, 0xFD, 0x42, 0x81, 0x91, 0xFF,
-    0xFD, 0xF7, 0xE1, 0x23, 0x2E, 0xD0, 0xD1, 0xE6, 0xE9, 0xF9, 0x41, 0xBD, 0xF7, 0x8F, 0x21, 0x81,
-    0xBC, 0x22, 0xD0, 0xD1, 0xF9, 0xFD, 0x46, 0x83, 0x8B, 0x8C, 0x8E, 0x8F, 0x91, 0xFF, 0xCD, 0xF8,
-    0x3D, 0xFF, 0xD0, 0xFF, 0xED, 0xF8, 0x3D, 0xFF, 0xFB, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF,
-    0xAE, 0xFF, 0xED, 0xF7, 0x55, 0x41, 0x80, 0xF7, 0xC3, 0x21, 0xD1, 0xFC, 0x41, 0x88, 0xF7, 0x8A,
-    0x21, 0xD1, 0xFC, 0x41, 0xD0, 0xFC, 0x71, 0x41, 0xB6, 0xFA, 0x83, 0x41, 0x81, 0xF7, 0x61, 0x21,
-    0xD1, 0xFC, 0x21, 0x8C, 0xFD, 0x22, 0xD0, 0xD1, 0xF2, 0xFD, 0xA0, 0x04, 0x82, 0x21, 0xBB, 0xFD,
-    0x42, 0x87, 0x88, 0xF7, 0x13, 0xF7, 0x66, 0x22, 0xD0, 0xD1, 0xF6, 0xF9, 0x41, 0x83, 0xF9, 0xA0,
-    0x21, 0xD1, 0xFC, 0x48, 0xB1, 0xB2, 0xB3, 0xB4, 0xB7, 0xBB, 0xBC, 0xBD, 0xFF, 0xC6, 0xFF, 0xCD,
-    0xFF, 0xD0, 0xFF, 0xC6, 0xFA, 0x57, 0xFF, 0xE2, 0xFF, 0xF4, 0xFF, 0xFD, 0x41, 0xD1, 0xFC, 0x62,
-    0xC1, 0x01, 0x31, 0xD0, 0xF7, 0x39, 0x42, 0xB0, 0xBA, 0xF6, 0xDD, 0xFF, 0xFA, 0x41, 0x82, 0xFB,
-    0xBB, 0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0x41, 0x80, 0xF7, 0x29, 0xC2, 0x03, 0x91, 0xD0, 0xD1, 0xFD,
-    0xBB, 0xFF, 0xFC, 0x21, 0xD1, 0xF3, 0x24, 0x80, 0x81, 0x82, 0x8F, 0xD6, 0xEB, 0xF4, 0xFD, 0xC3,
-    0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xB4, 0xFF, 0xF7, 0xF6, 0xBF, 0x50, 0xB0, 0xB1, 0xB2, 0xB3,
-    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBD, 0xBE, 0xB9, 0xBC, 0xBF, 0xFD, 0xDA, 0xFD, 0xE6,
-    0xFD, 0xF0, 0xFD, 0xF9, 0xFD, 0xE6, 0xFE, 0x69, 0xFE, 0x75, 0xFE, 0x7B, 0xFE, 0xC7, 0xFE, 0xD3,
-    0xFF, 0x5E, 0xFE, 0xD3, 0xFF, 0xF4, 0xFA, 0xC2, 0xFA, 0xC2, 0xFA, 0xC2, 0x41, 0xBE, 0xF6, 0xDE,
-    0x21, 0xD0, 0xFC, 0xA0, 0x03, 0x32, 0x46, 0xB1, 0xB2, 0xB7, 0xBB, 0xBC, 0xBD, 0xF6, 0x93, 0xF6,
-    0xD7, 0xFF, 0xFA, 0xFE, 0xB4, 0xFF, 0xFD, 0xF6, 0xD7, 0x45, 0x81, 0x82, 0x85, 0x87, 0x8F, 0xF8,
-    0x7F, 0xF8, 0x2E, 0xF6, 0xAA, 0xFE, 0xA1, 0xFE, 0xD0, 0x22, 0xD0, 0xD1, 0xDD, 0xF0, 0x44, 0xB4,
-    0xB9, 0xBA, 0xBC, 0xFE, 0x8C, 0xF6, 0x95, 0xF6, 0x95, 0xF6, 0xAF, 0x42, 0xD0, 0xD1, 0xFF, 0xF3,
-    0xF8, 0x4D, 0x41, 0xB4, 0xF6, 0x9B, 0x41, 0xBE, 0xF6, 0x97, 0x41, 0x8B, 0xF6, 0x93, 0x22, 0xD0,
-    0xD1, 0xF8, 0xFC, 0x21, 0x82, 0xFB, 0x22, 0xD0, 0xD1, 0xEC, 0xFD, 0x41, 0xB8, 0xFE, 0x5F, 0x21,
-    0xD0, 0xFC, 0x41, 0x2E, 0xF6, 0x61, 0x43, 0xB4, 0xBB, 0xBC, 0xFF, 0xF9, 0xF6, 0x5D, 0xFF, 0xFC,
-    0xA0, 0x04, 0xA2, 0x42, 0xB8, 0xBA, 0xFE, 0x47, 0xFF, 0xFD, 0x21, 0xD0, 0xF9, 0x21, 0x81, 0xFD,
-    0x22, 0xD0, 0xD1, 0xE6, 0xFD, 0x44, 0xB0, 0xB5, 0xB8, 0xBE, 0xFF, 0xA4, 0xFF, 0xB6, 0xFF, 0xD1,
-    0xFF, 0xFB, 0x41, 0x81, 0xFD, 0x38, 0x21, 0xD1, 0xFC, 0x21, 0xBA, 0xFD, 0xA1, 0x00, 0x91, 0xD0,
-    0xFD, 0xC1, 0x03, 0xE2, 0x2E, 0xFE, 0x48, 0x42, 0xBA, 0xBC, 0xF6, 0x1C, 0xF6, 0x36, 0x42, 0xD0,
-    0xD1, 0xFF, 0xF9, 0xF7, 0xDA, 0x46, 0x81, 0x83, 0x8C, 0x8E, 0x8F, 0x91, 0xF6, 0x9E, 0xFF, 0xE7,
-    0xF6, 0x9E, 0xFF, 0xEC, 0xF6, 0x0E, 0xFF, 0xF9, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xF6, 0x8B, 0xFF,
-    0xBD, 0xFF, 0xED, 0xF5, 0xB6, 0xA0, 0x04, 0xF1, 0x42, 0xBA, 0xBB, 0xF5, 0xC1, 0xFF, 0xFD, 0xC2,
-    0x04, 0xC3, 0xD0, 0x2D, 0xFF, 0xF9, 0xF5, 0x9F, 0x42, 0xB3, 0xBA, 0xFC, 0x84, 0xFA, 0x15, 0xC3,
-    0x03, 0xE2, 0xD0, 0xD1, 0x2D, 0xFF, 0xF9, 0xFE, 0x5C, 0xF5, 0x8F, 0x41, 0xB3, 0xF7, 0x3D, 0x41,
-    0xBA, 0xF5, 0xDB, 0xC2, 0x01, 0xB1, 0xD0, 0xD1, 0xFF, 0xFC, 0xF8, 0x0C, 0x21, 0x81, 0xF7, 0xC3,
-    0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xFD, 0xF5, 0x6F, 0x42, 0x81, 0x82, 0xF6, 0x38,
-    0xF6, 0x38, 0xC3, 0x02, 0xB1, 0x2E, 0xD1, 0x2D, 0xF6, 0x31, 0xFF, 0xF9, 0xF5, 0x5C, 0x42, 0xD1,
-    0x2D, 0xF7, 0x03, 0xF5, 0x50, 0xC2, 0x05, 0x02, 0xD1, 0x2D, 0xFB, 0xD1, 0xF5, 0x49, 0xC1, 0x02,
-    0xB1, 0x2D, 0xF5, 0x40, 0x41, 0xB4, 0xFC, 0x28, 0xC2, 0x02, 0xB1, 0xD0, 0x2D, 0xFF, 0xFC, 0xF5,
-    0x36, 0xA0, 0x0C, 0xD1, 0x42, 0x2E, 0x2D, 0xFF, 0xFD, 0xF5, 0x2A, 0x51, 0x80, 0x81, 0x82, 0x83,
-    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x8A, 0xFF, 0x6D, 0xFF,
-    0x84, 0xFB, 0xC9, 0xFF, 0x94, 0xFC, 0xE5, 0xFC, 0x56, 0xFC, 0xE5, 0xFC, 0x56, 0xFC, 0xE5, 0xFC,
-    0xE5, 0xFF, 0xB4, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xDA, 0xFF, 0xE3, 0xFF, 0xED, 0xFF, 0xF9, 0x42,
-    0xD0, 0xD1, 0xFE, 0x3C, 0xFF, 0xCC, 0x42, 0x80, 0x8C, 0xF6, 0xA2, 0xF7, 0xD3, 0x21, 0xD1, 0xF9,
-    0x41, 0xB4, 0xFD, 0xBA, 0x21, 0xD0, 0xFC, 0x46, 0xB1, 0xB3, 0xB4, 0xB6, 0xB7, 0xBD, 0xF9, 0x7C,
-    0xFC, 0x23, 0xFF, 0xF6, 0xFF, 0xFD, 0xF5, 0x05, 0xFC, 0x47, 0xC1, 0x01, 0x31, 0xD1, 0xF8, 0x28,
-    0x21, 0x82, 0xFA, 0x21, 0xD1, 0xFD, 0x45, 0x81, 0x82, 0x85, 0x86, 0x8F, 0xFF, 0xFD, 0xF6, 0x6F,
-    0xF5, 0x14, 0xFC, 0x04, 0xFC, 0x04, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xD1, 0xFF, 0xF0,
-    0xF4, 0xA8, 0x41, 0x80, 0xF4, 0xE1, 0x43, 0xD0, 0xD1, 0x2D, 0xF6, 0x6B, 0xFF, 0xFC, 0xF4, 0x98,
-    0xC1, 0x05, 0x22, 0x2D, 0xF4, 0x8E, 0x41, 0xD1, 0xF6, 0x92, 0x21, 0xBE, 0xFC, 0xC2, 0x00, 0x91,
-    0xD0, 0x2D, 0xFF, 0xFD, 0xF4, 0x81, 0x42, 0x80, 0x83, 0xF4, 0xD4, 0xF4, 0xC0, 0x21, 0xD1, 0xF9,
-    0x42, 0xB5, 0xBB, 0xFB, 0xBA, 0xFB, 0xBA, 0x42, 0x83, 0x91, 0xF4, 0xB8, 0xFB, 0xB3, 0xA2, 0x02,
-    0xB1, 0xD0, 0xD1, 0xF2, 0xF9, 0x41, 0x2E, 0xF6, 0x73, 0x47, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB9,
-    0xBF, 0xF6, 0x6F, 0xFB, 0xA1, 0xFF, 0xE4, 0xF6, 0x6F, 0xFF, 0xF5, 0xFF, 0xFC, 0xF6, 0x0F, 0x41,
-    0xB4, 0xF5, 0x14, 0x21, 0xD0, 0xFC, 0x41, 0xBA, 0xF5, 0xF2, 0xA0, 0x05, 0x42, 0x21, 0xB2, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0xA2, 0x02, 0xB1, 0xD0, 0xD1, 0xF0, 0xFD, 0x41, 0x80, 0xF4,
-    0x2D, 0x21, 0xD1, 0xFC, 0x47, 0x80, 0x81, 0x82, 0x86, 0x8E, 0x8F, 0x91, 0xFF, 0xDF, 0xFF, 0xF2,
-    0xFF, 0xFD, 0xF6, 0x34, 0xF6, 0x34, 0xF6, 0x34, 0xF6, 0x34, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xAF,
-    0xFF, 0xEA, 0xF4, 0x04, 0x41, 0xB1, 0xF4, 0x56, 0x21, 0xD0, 0xFC, 0x43, 0xB3, 0xB4, 0xBE, 0xF4,
-    0x44, 0xF4, 0x44, 0xFF, 0xFD, 0xA0, 0x04, 0x01, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5,
-    0xFD, 0xA1, 0x01, 0xE1, 0xD0, 0xFD, 0x21, 0x8A, 0xFB, 0xC3, 0x05, 0x63, 0xD0, 0xD1, 0x2D, 0xFF,
-    0xE2, 0xFF, 0xFD, 0xF3, 0xD5, 0x42, 0xB7, 0xBA, 0xF3, 0xBE, 0xF3, 0xBE, 0xA0, 0x05, 0x93, 0x44,
-    0x80, 0x81, 0x82, 0x84, 0xF3, 0xB4, 0xFF, 0xFD, 0xF4, 0x1B, 0xF4, 0x07, 0x22, 0xD0, 0xD1, 0xE9,
-    0xF3, 0x42, 0xB2, 0xBB, 0xF3, 0xA2, 0xF3, 0xA2, 0x21, 0xD0, 0xF9, 0x41, 0xBD, 0xF3, 0xF4, 0x21,
-    0xD0, 0xFC, 0x21, 0xB3, 0xFD, 0xA1, 0x02, 0xB1, 0xD0, 0xFD, 0x42, 0x82, 0x87, 0xF5, 0xAE, 0xF5,
-    0xAE, 0x21, 0xD1, 0xF9, 0x45, 0xB0, 0xB3, 0xB7, 0xBD, 0xBE, 0xFF, 0xD8, 0xFF, 0xE4, 0xFF, 0xF1,
-    0xFF, 0xFD, 0xF3, 0xB8, 0x41, 0xB8, 0xF6, 0xC6, 0x21, 0xD0, 0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0,
-    0xFD, 0x43, 0x81, 0x83, 0x84, 0xFF, 0xFD, 0xF3, 0x79, 0xF3, 0x62, 0x43, 0xD0, 0xD1, 0x2D, 0xFF,
-    0xD9, 0xFF, 0xF6, 0xF3, 0x63, 0xA0, 0x05, 0x02, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x83,
-    0xFD, 0xC3, 0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xF7, 0xAD, 0xFF, 0xFD, 0xF3, 0x4D, 0x41, 0xB1, 0xFB,
-    0xAC, 0xA1, 0x00, 0xA1, 0xD0, 0xFC, 0x42, 0xB2, 0xBA, 0xF3, 0x97, 0xF3, 0x97, 0x42, 0x82, 0x87,
-    0xF3, 0x90, 0xF3, 0x90, 0x22, 0xD0, 0xD1, 0xF2, 0xF9, 0x41, 0x8F, 0xF3, 0x84, 0xA1, 0x02, 0x21,
-    0xD1, 0xFC, 0x23, 0xB0, 0xB5, 0xB8, 0xDF, 0xF2, 0xFB, 0x41, 0xB1, 0xF3, 0x74, 0xA1, 0x02, 0x21,
-    0xD0, 0xFC, 0x41, 0xBA, 0xF3, 0x6B, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xF5, 0xD4, 0x43, 0x8E, 0x8F,
-    0x91, 0xFF, 0xF0, 0xF3, 0xD6, 0xFF, 0xF9, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xDB, 0xFF,
-    0xF6, 0xF2, 0xF7, 0x41, 0xB5, 0xF5, 0x05, 0x41, 0x91, 0xF5, 0x01, 0xC3, 0x02, 0x21, 0xD0, 0xD1,
-    0x2D, 0xFF, 0xF8, 0xFF, 0xFC, 0xF2, 0xE3, 0xA0, 0x01, 0x92, 0x41, 0x81, 0xF3, 0x33, 0x21, 0xD1,
-    0xFC, 0x43, 0xB0, 0xB5, 0xBE, 0xFF, 0xF6, 0xFF, 0xFD, 0xF3, 0x29, 0x41, 0xBA, 0xFF, 0x6A, 0x41,
-    0x87, 0xFF, 0x66, 0x43, 0x2E, 0xD0, 0xD1, 0xF2, 0xD6, 0xFF, 0xF8, 0xFF, 0xFC, 0x43, 0x83, 0x8B,
-    0x91, 0xFF, 0xF6, 0xF2, 0xCC, 0xFF, 0xE1, 0xC3, 0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xDA, 0xFF,
-    0xF6, 0xF2, 0xA7, 0xA0, 0x05, 0xC2, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBB, 0xFD, 0xA1,
-    0x03, 0x12, 0xD0, 0xFD, 0x41, 0xBA, 0xF2, 0xD2, 0xA1, 0x01, 0xE1, 0xD0, 0xFC, 0x41, 0xB2, 0xF2,
-    0xAF, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xFF, 0xFC, 0xF4, 0x30, 0x41, 0xB6, 0xF2, 0x69, 0x21, 0xD0,
-    0xFC, 0x41, 0x81, 0xFC, 0x5F, 0x21, 0xD1, 0xFC, 0x49, 0xB1, 0xB2, 0xB4, 0xB5, 0xB6, 0xB8, 0xBA,
-    0xBC, 0xBF, 0xFF, 0xD7, 0xFF, 0xE0, 0xFF, 0xE9, 0xF7, 0x0B, 0xFF, 0xF6, 0xFF, 0xFD, 0xF4, 0x80,
-    0xFB, 0x42, 0xF2, 0xB7, 0x43, 0x83, 0x86, 0x8C, 0xF2, 0x78, 0xF3, 0x1F, 0xF3, 0x1F, 0x21, 0xD1,
-    0xF6, 0x41, 0xB5, 0xF2, 0x49, 0x21, 0xD0, 0xFC, 0x44, 0xBA, 0xBC, 0xBD, 0xBF, 0xF2, 0x92, 0xF2,
-    0x64, 0xF2, 0x64, 0xFF, 0xFD, 0x41, 0x82, 0xF6, 0xCE, 0x22, 0xD0, 0xD1, 0xEF, 0xFC, 0x41, 0x82,
-    0xFA, 0xFC, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xF6, 0x0D, 0xFF, 0xFC, 0x45, 0x80, 0x81, 0x82, 0x85,
-    0x8E, 0xFF, 0xD3, 0xFF, 0xEE, 0xFB, 0x48, 0xFF, 0xF7, 0xF4, 0x2D, 0x43, 0xD0, 0xD1, 0x2D, 0xFF,
-    0x9D, 0xFF, 0xF0, 0xF2, 0x03, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xBA, 0xBB,
-    0xBC, 0xBD, 0xBE, 0xBF, 0xB6, 0xB9, 0xFD, 0x51, 0xF9, 0x2C, 0xFD, 0x61, 0xFD, 0x6B, 0xFD, 0x78,
-    0xFD, 0xF5, 0xFE, 0x24, 0xFE, 0x96, 0xFE, 0xAC, 0xFF, 0x02, 0xFF, 0x16, 0xFF, 0x52, 0xFF, 0xF6,
-    0xFD, 0x6B, 0xF6, 0x08, 0xF6, 0x08, 0x42, 0xB2, 0xBC, 0xF2, 0x27, 0xFB, 0x4D, 0x43, 0x81, 0x85,
-    0x86, 0xF2, 0x06, 0xFB, 0x46, 0xF2, 0x96, 0x43, 0x2E, 0xD0, 0xD1, 0xF2, 0x8C, 0xFF, 0xEF, 0xFF,
-    0xF6, 0x41, 0xBD, 0xFB, 0x32, 0x42, 0x2E, 0xD0, 0xF2, 0x7E, 0xFF, 0xFC, 0x45, 0xB4, 0xB7, 0xB8,
-    0xBA, 0xBB, 0xF3, 0xBC, 0xF9, 0xDE, 0xF1, 0xE7, 0xF1, 0xE7, 0xF1, 0xE7, 0x42, 0x81, 0x82, 0xF1,
-    0xD7, 0xF1, 0xD7, 0x22, 0xD0, 0xD1, 0xE9, 0xF9, 0xC1, 0x03, 0x32, 0xD1, 0xF5, 0x62, 0x24, 0xB0,
-    0xB5, 0xB8, 0xBE, 0xC9, 0xD7, 0xF5, 0xFA, 0x21, 0xD0, 0xCA, 0x44, 0x8B, 0x8E, 0x8F, 0x91, 0xFA,
-    0xF9, 0xF3, 0x8E, 0xF1, 0xB9, 0xFF, 0xFD, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xF2, 0x3C, 0xFF, 0xE7,
-    0xFF, 0xF3, 0xF1, 0x67, 0xA0, 0x05, 0xE2, 0x41, 0x8F, 0xF1, 0x72, 0x21, 0xD1, 0xFC, 0x42, 0xB0,
-    0xB8, 0xFF, 0xFD, 0xFE, 0x79, 0x41, 0x83, 0xFE, 0x72, 0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0x43, 0xB5,
-    0xBA, 0xBF, 0xFF, 0xE6, 0xFF, 0xFB, 0xFD, 0xE7, 0x42, 0x8E, 0x91, 0xFD, 0xDD, 0xFF, 0xDC, 0xC3,
-    0x04, 0xC3, 0xD0, 0xD1, 0x2D, 0xFF, 0xEF, 0xFF, 0xF9, 0xF1, 0x2F, 0x41, 0xB1, 0xF1, 0xC9, 0x41,
-    0x88, 0xF1, 0x2B, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x21, 0xBE, 0xFB, 0xC2, 0x00, 0x92, 0xD0, 0x2D,
-    0xFF, 0xFD, 0xF1, 0x13, 0xA0, 0x06, 0x02, 0x46, 0xB0, 0xB3, 0xB7, 0xB8, 0xBA, 0xBF, 0xF3, 0x21,
-    0xF1, 0x4F, 0xFF, 0xFD, 0xF1, 0xDC, 0xF5, 0xDA, 0xF1, 0x4F, 0x42, 0xB0, 0xB2, 0xF2, 0xAE, 0xF1,
-    0x00, 0x21, 0xD0, 0xF9, 0x43, 0x81, 0x85, 0x87, 0xF4, 0x36, 0xFF, 0xFD, 0xF4, 0xDF, 0x43, 0xD0,
-    0xD1, 0x2D, 0xFF, 0xD9, 0xFF, 0xF6, 0xF0, 0xE0, 0x41, 0xBE, 0xF2, 0xF0, 0x42, 0xD0, 0x2D, 0xFF,
-    0xFC, 0xF0, 0xD2, 0x41, 0xB2, 0xFD, 0x72, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0xC2, 0x02, 0x21,
-    0xD0, 0x2D, 0xFF, 0xFD, 0xF0, 0xC1, 0xC2, 0x01, 0xB1, 0x2E, 0x2D, 0xFB, 0x8B, 0xF0, 0xB8, 0x41,
-    0xBD, 0xF0, 0xF7, 0x21, 0xD0, 0xFC, 0x41, 0xB5, 0xF0, 0xF9, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD,
-    0x21, 0xD1, 0xFD, 0x44, 0xB3, 0xB7, 0xBF, 0xB1, 0xF9, 0x77, 0xFF, 0xF0, 0xF0, 0xEC, 0xFF, 0xFD,
-    0x41, 0xD0, 0xF9, 0x6D, 0x43, 0x82, 0x85, 0x88, 0xF9, 0x66, 0xF0, 0xDB, 0xFF, 0xFC, 0xC3, 0x02,
-    0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xE5, 0xFF, 0xF6, 0xF0, 0x80, 0x41, 0xBD, 0xF2, 0x8E, 0x21, 0xD0,
-    0xFC, 0x42, 0xB5, 0xB8, 0xF2, 0x87, 0xFF, 0xFD, 0x45, 0x81, 0x82, 0x8E, 0x8F, 0x91, 0xF1, 0x3B,
-    0xF1, 0x3B, 0xF2, 0x80, 0xF2, 0x80, 0xF2, 0x80, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xF1, 0x2B, 0xFF,
-    0xE9, 0xFF, 0xF0, 0xF0, 0x56, 0xC1, 0x06, 0x23, 0x2D, 0xF0, 0x49, 0xC1, 0x03, 0xE2, 0x2D, 0xF0,
-    0x43, 0x42, 0xB4, 0xB7, 0xF6, 0x49, 0xF2, 0x57, 0x42, 0x80, 0x81, 0xFB, 0xFB, 0xF2, 0x50, 0x43,
-    0xD0, 0xD1, 0x2D, 0xFF, 0xF2, 0xFF, 0xF9, 0xF0, 0x2F, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
-    0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xFE, 0xBE, 0xFE, 0xF6, 0xFF,
-    0x12, 0xFF, 0x45, 0xF7, 0x6B, 0xFF, 0x53, 0xF7, 0xE7, 0xF7, 0x58, 0xFF, 0x64, 0xF7, 0xE7, 0xFF,
-    0x6D, 0xFF, 0xA5, 0xFF, 0xCF, 0xFF, 0xDC, 0xFF, 0xE2, 0xFA, 0xE5, 0xFF, 0xF6, 0x42, 0xD0, 0xD1,
-    0xFD, 0xF8, 0xFF, 0xCC, 0x41, 0xB7, 0xF0, 0x18, 0xA0, 0x06, 0x52, 0x21, 0x82, 0xFD, 0x21, 0xD1,
-    0xFD, 0x42, 0x81, 0x83, 0xFF, 0xFD, 0xEF, 0xD2, 0xC3, 0x00, 0xA1, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC,
-    0xFF, 0xF9, 0xEF, 0xD6, 0xC2, 0x04, 0x22, 0xD0, 0x2D, 0xF0, 0x1E, 0xEF, 0xCA, 0x42, 0xD0, 0x2D,
-    0xF1, 0x94, 0xEF, 0xC1, 0x41, 0xD0, 0xF8, 0x46, 0x42, 0xB0, 0xB8, 0xFF, 0xFC, 0xF8, 0x21, 0x42,
-    0xD0, 0x2D, 0xFF, 0xF9, 0xEF, 0xAF, 0x41, 0xBE, 0xF2, 0x36, 0x21, 0xD0, 0xFC, 0x42, 0xB1, 0xB4,
-    0xEF, 0x96, 0xEF, 0x96, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xF1, 0x4D, 0x43, 0xB1, 0xBD, 0xBE, 0xF1,
-    0x4D, 0xFF, 0xEF, 0xFF, 0xF9, 0x43, 0x2E, 0xD0, 0x2D, 0xF6, 0xD5, 0xFF, 0xF6, 0xEF, 0x89, 0x41,
-    0x80, 0xEF, 0xC7, 0x42, 0xD0, 0xD1, 0xF3, 0xDB, 0xFF, 0xFC, 0x42, 0xB1, 0xB3, 0xFF, 0xF9, 0xF4,
-    0x19, 0x41, 0x82, 0xF2, 0x58, 0x42, 0xD0, 0xD1, 0xF3, 0x5A, 0xFF, 0xFC, 0x21, 0x81, 0xF9, 0xC3,
-    0x00, 0xA1, 0xD0, 0xD1, 0x2D, 0xFF, 0xEB, 0xFF, 0xFD, 0xEF, 0x5F, 0x43, 0xB2, 0xB9, 0xBC, 0xEF,
-    0xB2, 0xEF, 0x98, 0xF1, 0x2A, 0x41, 0x8C, 0xF0, 0x1E, 0x21, 0xD1, 0xFC, 0x42, 0x81, 0x8F, 0xFF,
-    0xFD, 0xF0, 0x17, 0x43, 0x2E, 0xD0, 0xD1, 0xF0, 0x10, 0xFF, 0xE8, 0xFF, 0xF9, 0xC1, 0x00, 0x91,
-    0xD1, 0xF1, 0xFD, 0x41, 0x84, 0xFB, 0xD2, 0x43, 0x2E, 0xD0, 0xD1, 0xEF, 0xFC, 0xF0, 0x72, 0xFF,
-    0xFC, 0x41, 0xBB, 0xEF, 0x38, 0x21, 0xD0, 0xFC, 0x45, 0xB1, 0xB2, 0xB3, 0xB5, 0xB9, 0xFF, 0xFD,
-    0xEF, 0xEB, 0xEF, 0xEB, 0xEF, 0xEB, 0xEF, 0xEB, 0x41, 0x8E, 0xEF, 0xDB, 0x43, 0x2E, 0xD0, 0xD1,
-    0xEF, 0xD7, 0xFF, 0xEC, 0xFF, 0xFC, 0x24, 0xB0, 0xB5, 0xB8, 0xBE, 0xBD, 0xC7, 0xD1, 0xF6, 0x21,
-    0xD1, 0xE9, 0x42, 0xB6, 0xBA, 0xEF, 0x4B, 0xEF, 0xC1, 0x21, 0xD0, 0xF9, 0x44, 0x83, 0x8B, 0x8F,
-    0x91, 0xFF, 0xF3, 0xF8, 0x67, 0xFF, 0xFD, 0xFF, 0xB1, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xDD, 0xFF,
-    0xF3, 0xEE, 0xD5, 0x42, 0xB2, 0xBD, 0xEF, 0x2A, 0xEF, 0x2A, 0x21, 0xD0, 0xF9, 0x43, 0xB2, 0xBD,
-    0xBF, 0xEF, 0x20, 0xEE, 0xDC, 0xEE, 0xDC, 0x41, 0x81, 0xEE, 0xD2, 0x43, 0x2E, 0xD0, 0xD1, 0xEE,
-    0xCE, 0xFF, 0xF2, 0xFF, 0xFC, 0x41, 0x80, 0xF1, 0x94, 0x21, 0xD1, 0xFC, 0x42, 0x80, 0x82, 0xEF,
-    0x01, 0xFF, 0xFD, 0x21, 0xD1, 0xF9, 0x42, 0xB5, 0xB8, 0xEE, 0xF7, 0xEE, 0xF7, 0x42, 0x81, 0x91,
-    0xEE, 0xF0, 0xEE, 0xF0, 0x22, 0xD0, 0xD1, 0xF2, 0xF9, 0x24, 0xB0, 0xB5, 0xB8, 0xBE, 0xC1, 0xD2,
-    0xEA, 0xFB, 0x42, 0xB2, 0xBD, 0xEE, 0xDB, 0xEE, 0x97, 0x21, 0xD0, 0xF9, 0x42, 0x8F, 0x91, 0xEE,
-    0x8D, 0xFF, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE6, 0xFF, 0xF9, 0xEE, 0x6B, 0x42, 0xBB, 0xBD,
-    0xEE, 0x56, 0xEE, 0xB2, 0xA1, 0x01, 0x31, 0xD0, 0xF9, 0x41, 0xB3, 0xF1, 0x40, 0x21, 0xD0, 0xFC,
-    0x48, 0xB1, 0xB2, 0xB6, 0xB7, 0xB8, 0xB9, 0xBB, 0xBC, 0xF1, 0x9A, 0xF2, 0xB2, 0xF9, 0x74, 0xFF,
-    0xF4, 0xFF, 0xFD, 0xF5, 0x9A, 0xEE, 0xAD, 0xF4, 0x8A, 0x45, 0xB0, 0xB4, 0xBA, 0xBD, 0xBF, 0xEF,
-    0xEF, 0xEE, 0x2A, 0xF2, 0x2A, 0xEE, 0x63, 0xEE, 0xAF, 0x21, 0xD0, 0xF0, 0x45, 0x81, 0x82, 0x83,
-    0x87, 0x8E, 0xFF, 0xFD, 0xF9, 0xE7, 0xEE, 0x34, 0xF2, 0x17, 0xF5, 0x6E, 0x43, 0xD0, 0xD1, 0x2D,
-    0xFF, 0xC4, 0xFF, 0xF0, 0xEE, 0x12, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8,
-    0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB9, 0xFE, 0x32, 0xFE, 0x3E, 0xFE, 0x47, 0xF5, 0xCA, 0xFE,
-    0x59, 0xFE, 0x7F, 0xF6, 0x28, 0xF5, 0x3B, 0xFE, 0xA9, 0xF5, 0x3B, 0xFF, 0x33, 0xF6, 0x28, 0xFF,
-    0x9D, 0xFF, 0xF6, 0xF5, 0xCA, 0xF2, 0x17, 0x42, 0xB5, 0xB9, 0xEE, 0x1C, 0xEE, 0x1C, 0x42, 0xD0,
-    0xD1, 0xFF, 0xF9, 0xF9, 0x34, 0x42, 0xB3, 0xBA, 0xEE, 0x0E, 0xEE, 0x0E, 0x41, 0x86, 0xEE, 0x07,
-    0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0x41, 0xBD, 0xEF, 0x4B, 0x21, 0xD0, 0xFC, 0x44, 0xB2, 0xBA, 0xBB,
-    0xBD, 0xFF, 0xFD, 0xED, 0xF7, 0xED, 0xF7, 0xED, 0xF7, 0x42, 0x81, 0x87, 0xED, 0xEA, 0xED, 0xEA,
-    0x22, 0xD0, 0xD1, 0xEC, 0xF9, 0x45, 0xB2, 0xB7, 0xBA, 0xBD, 0xBF, 0xED, 0xDE, 0xED, 0xF8, 0xED,
-    0xDE, 0xED, 0xDE, 0xED, 0xDE, 0x42, 0x82, 0x84, 0xED, 0xCE, 0xED, 0xCE, 0x22, 0xD0, 0xD1, 0xE9,
-    0xF9, 0x24, 0xB0, 0xB5, 0xB8, 0xBE, 0xAD, 0xBF, 0xDF, 0xFB, 0x41, 0xBF, 0xED, 0xC5, 0x21, 0xD0,
-    0xFC, 0x41, 0xB2, 0xED, 0xB2, 0x21, 0xD0, 0xFC, 0x42, 0xB5, 0xBB, 0xED, 0xAB, 0xED, 0xAB, 0x41,
-    0x82, 0xED, 0xA4, 0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0x44, 0x83, 0x8B, 0x8E, 0x8F, 0xFF, 0xE6, 0xFF,
-    0xED, 0xEE, 0x2B, 0xFF, 0xFB, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xEE, 0x1E, 0xFF, 0xCC, 0xFF, 0xF3,
-    0xED, 0x49, 0xA0, 0x03, 0xD1, 0x22, 0xB0, 0xB1, 0xFD, 0xFD, 0x41, 0x80, 0xEF, 0xF6, 0x21, 0xD1,
-    0xFC, 0x21, 0x82, 0xFD, 0xC3, 0x04, 0x23, 0xD0, 0xD1, 0x2D, 0xFF, 0xF1, 0xFF, 0xFD, 0xED, 0x2A,
-    0xC1, 0x01, 0x31, 0xD0, 0xF8, 0xE6, 0x21, 0x81, 0xFA, 0x43, 0xD0, 0xD1, 0x2D, 0xFA, 0x94, 0xFF,
-    0xFD, 0xED, 0x15, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x87, 0x88, 0x8D, 0x8A, 0x91, 0x85, 0x86,
-    0x89, 0x8B, 0x8C, 0x8E, 0x8F, 0xFF, 0xC2, 0xFF, 0xE1, 0xF5, 0x2B, 0xFF, 0xF6, 0xF4, 0xCD, 0xF4,
-    0x3E, 0xF5, 0x2B, 0xF5, 0x2B, 0xF7, 0xE1, 0xF1, 0x1A, 0xF1, 0x1A, 0xF1, 0x1A, 0xF1, 0x1A, 0xF1,
-    0x1A, 0xF1, 0x1A, 0xF1, 0x1A, 0xF1, 0x1A, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xFE, 0xCF, 0xFF, 0xCC,
-    0x41, 0xD0, 0xF1, 0xC9, 0x21, 0xB5, 0xFC, 0x42, 0xD0, 0xD1, 0xFF, 0xFD, 0xF0, 0x2B, 0x44, 0xB1,
-    0xB3, 0xB7, 0xBE, 0xEE, 0x7A, 0xFF, 0xF9, 0xEC, 0xEE, 0xEC, 0xB5, 0x41, 0x80, 0xEF, 0x41, 0x21,
-    0xD1, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x42, 0x81, 0x82, 0xFF, 0xFD, 0xF2, 0xB2, 0xC3,
-    0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xDF, 0xFF, 0xF9, 0xEC, 0x9F, 0x42, 0x82, 0x87, 0xED, 0x68,
-    0xED, 0x68, 0x21, 0xD1, 0xF9, 0x43, 0xB4, 0xB7, 0xBD, 0xF6, 0x0E, 0xED, 0x5E, 0xFF, 0xFD, 0x42,
-    0x81, 0x82, 0xF6, 0x04, 0xF6, 0x04, 0xA2, 0x02, 0xB1, 0xD0, 0xD1, 0xEF, 0xF9, 0x42, 0xB4, 0xB7,
-    0xED, 0x46, 0xEC, 0xB6, 0x41, 0x8C, 0xEE, 0x84, 0x21, 0xD1, 0xFC, 0x21, 0x80, 0xFD, 0x22, 0xD0,
-    0xD1, 0xEF, 0xFD, 0x45, 0xB5, 0xB8, 0xBA, 0xBB, 0xBE, 0xEC, 0xA0, 0xFF, 0xE3, 0xEC, 0x76, 0xEC,
-    0xA0, 0xFF, 0xFB, 0x42, 0x8F, 0x91, 0xED, 0x20, 0xEC, 0x90, 0xC3, 0x01, 0xB1, 0xD0, 0xD1, 0x2D,
-    0xFF, 0xE9, 0xFF, 0xF9, 0xEC, 0x44, 0xC1, 0x04, 0xC3, 0x2D, 0xEC, 0x38, 0x41, 0xBB, 0xEF, 0x7E,
-    0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xEF, 0x7D, 0x41, 0x80, 0xF3, 0x73, 0x21, 0xD1, 0xFC, 0x43, 0xB0,
-    0xB8, 0xBE, 0xF8, 0x5E, 0xEC, 0x15, 0xEC, 0xC6, 0x41, 0x83, 0xEC, 0x0B, 0xA2, 0x03, 0x91, 0xD0,
-    0xD1, 0xF2, 0xFC, 0x41, 0xBE, 0xEE, 0xF6, 0x21, 0xD0, 0xFC, 0x41, 0xB5, 0xF3, 0x50, 0x21, 0xD0,
-    0xFC, 0x42, 0xB4, 0xBF, 0xEB, 0xF2, 0xEC, 0x09, 0x21, 0xD0, 0xF9, 0x41, 0xD0, 0xED, 0xF1, 0x48,
-    0xB1, 0xB2, 0xB7, 0xB8, 0xBA, 0xBC, 0xBE, 0xBF, 0xFF, 0xC1, 0xFF, 0xCC, 0xFF, 0xDD, 0xFF, 0xE8,
-    0xEF, 0xE4, 0xFF, 0xEF, 0xFF, 0xF9, 0xFF, 0xFC, 0xA0, 0x06, 0x71, 0x21, 0x81, 0xFD, 0x21, 0xD1,
-    0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xB2, 0xBA, 0xF9, 0x2C, 0xEC, 0x18, 0x42, 0xD0,
-    0xD1, 0xFF, 0xF9, 0xEF, 0x24, 0x43, 0x80, 0x81, 0x85, 0xFF, 0xEF, 0xFF, 0xF9, 0xEF, 0xAE, 0xC3,
-    0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xC0, 0xFF, 0xF6, 0xEB, 0xAF, 0x41, 0xBC, 0xEC, 0x02, 0x21,
-    0xD0, 0xFC, 0xA0, 0x06, 0x82, 0x22, 0xB0, 0xBC, 0xFA, 0xFD, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xEC,
-    0x69, 0xFF, 0xFB, 0xED, 0xC0, 0xEB, 0x94, 0x42, 0xB8, 0xBE, 0xEB, 0x7C, 0xEB, 0x7C, 0x21, 0xD0,
-    0xF9, 0x43, 0xB4, 0xB7, 0xBB, 0xEB, 0x72, 0xEB, 0xCE, 0xFF, 0xFD, 0x42, 0x80, 0x81, 0xEB, 0x68,
-    0xEB, 0x68, 0x22, 0xD0, 0xD1, 0xEF, 0xF9, 0x42, 0xB1, 0xB4, 0xEB, 0x5C, 0xF9, 0x2E, 0x43, 0x80,
-    0x81, 0x82, 0xEB, 0x55, 0xEB, 0xBC, 0xEB, 0x94, 0x22, 0xD0, 0xD1, 0xEF, 0xF6, 0x41, 0x82, 0xEB,
-    0x99, 0xC2, 0x01, 0xE1, 0xD0, 0xD1, 0xEC, 0x52, 0xFF, 0xFC, 0x23, 0xB0, 0xBE, 0xBF, 0xD8, 0xEE,
-    0xF7, 0x41, 0x82, 0xF2, 0x2B, 0x41, 0xB2, 0xEE, 0x85, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0xBB, 0xFD, 0x22, 0xD1, 0xD0, 0xEC, 0xFD, 0x42, 0x80, 0x82, 0xEB, 0x6C, 0xEB,
-    0x72, 0x21, 0xD1, 0xF9, 0x44, 0x81, 0x83, 0x84, 0x85, 0xFF, 0xF1, 0xEB, 0x26, 0xFF, 0xFD, 0xEB,
-    0x48, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xC9, 0xFF, 0xF3, 0xEB, 0x0D, 0x41, 0xB2, 0xEB,
-    0x60, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0xC2, 0x00, 0x91, 0xD0, 0x2D, 0xFF, 0xFD, 0xEA, 0xF7,
-    0xC1, 0x04, 0x23, 0x2D, 0xEA, 0xEE, 0x41, 0xBD, 0xF2, 0x34, 0x21, 0xD0, 0xFC, 0x42, 0xB0, 0xB2,
-    0xED, 0xCC, 0xFF, 0xFD, 0x21, 0xD0, 0xF9, 0x41, 0xB4, 0xEE, 0xB0, 0xC2, 0x06, 0xA3, 0xD0, 0xD1,
-    0xFF, 0xFC, 0xF2, 0x3F, 0x43, 0xB0, 0xB5, 0xBE, 0xEA, 0xE5, 0xFF, 0xF0, 0xFF, 0xF7, 0x41, 0x88,
-    0xF7, 0x67, 0x21, 0xD1, 0xFC, 0x42, 0x8B, 0x8F, 0xF7, 0xE2, 0xFF, 0xFD, 0xC3, 0x03, 0x32, 0xD0,
-    0xD1, 0x2D, 0xFF, 0xE8, 0xFF, 0xF9, 0xEA, 0xB2, 0xA0, 0x04, 0xC3, 0x21, 0xB4, 0xFD, 0x21, 0xD0,
-    0xFD, 0x41, 0xB0, 0xF4, 0x22, 0xA1, 0x01, 0xB1, 0xD0, 0xFC, 0x22, 0xB5, 0xBB, 0xF4, 0xFB, 0x41,
-    0xB0, 0xED, 0xDB, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x22, 0xD0, 0xD1, 0xF1, 0xFD, 0x42, 0xBB,
-    0xBC, 0xEA, 0xD1, 0xF3, 0x5C, 0x21, 0xD0, 0xF9, 0xC1, 0x03, 0x12, 0xD0, 0xF9, 0xC7, 0xC1, 0x01,
-    0x31, 0xD0, 0xF6, 0xCD, 0x41, 0xBC, 0xEB, 0x3F, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0,
-    0xFD, 0x41, 0xB5, 0xEB, 0x32, 0x41, 0x91, 0xEB, 0x2E, 0xA2, 0x01, 0xD1, 0xD0, 0xD1, 0xF8, 0xFC,
-    0x21, 0xBB, 0xF9, 0x41, 0x91, 0xEA, 0x40, 0x42, 0xD0, 0xD1, 0xEA, 0xC4, 0xFF, 0xFC, 0x21, 0x80,
-    0xF9, 0xA2, 0x01, 0xE1, 0xD0, 0xD1, 0xEF, 0xFD, 0x4A, 0xB1, 0xB2, 0xB4, 0xB6, 0xB7, 0xB8, 0xBA,
-    0xBB, 0xBC, 0xBF, 0xFF, 0xB1, 0xFF, 0xBD, 0xFF, 0xC0, 0xF5, 0x5C, 0xFF, 0xC6, 0xF3, 0x6B, 0xEC,
-    0xFF, 0xFF, 0xD6, 0xF1, 0x24, 0xFF, 0xF9, 0x41, 0xB1, 0xEA, 0x0C, 0x21, 0xD0, 0xFC, 0x21, 0x83,
-    0xFD, 0x21, 0xD1, 0xFD, 0xA0, 0x00, 0x92, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xBE, 0xF3,
-    0x86, 0x41, 0x8F, 0xEA, 0x4E, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x44, 0xB5, 0xB8, 0xBD, 0xBF, 0xFF,
-    0xF0, 0xFF, 0xF0, 0xFF, 0xFB, 0xEA, 0x45, 0xA1, 0x01, 0x31, 0xD0, 0xF3, 0x42, 0xB4, 0xBB, 0xEA,
-    0xB7, 0xEA, 0xB7, 0x41, 0xB8, 0xEA, 0x2C, 0x41, 0x8F, 0xF3, 0x5C, 0x22, 0xD0, 0xD1, 0xF8, 0xFC,
-    0x43, 0x80, 0x8A, 0x8C, 0xFF, 0xFB, 0xEA, 0xA3, 0xEA, 0x16, 0x22, 0xD0, 0xD1, 0xE2, 0xF6, 0x41,
-    0xBB, 0xF1, 0x0B, 0x21, 0xD0, 0xFC, 0x41, 0x8B, 0xE9, 0xAD, 0x21, 0xD1, 0xFC, 0x43, 0xB2, 0xBA,
-    0xBB, 0xF7, 0x16, 0xF2, 0x8D, 0xFF, 0xFD, 0x21, 0xD0, 0xF6, 0x41, 0xD1, 0xFD, 0x8E, 0x46, 0x80,
-    0x81, 0x82, 0x85, 0x88, 0x89, 0xFF, 0x93, 0xFF, 0xB9, 0xFF, 0xDC, 0xFF, 0xE5, 0xFF, 0xF9, 0xFF,
-    0xFC, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0x57, 0xFF, 0xED, 0xE9, 0x8D, 0x50, 0xB0, 0xB1,
-    0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB9, 0xFC, 0xE2,
-    0xF0, 0xB4, 0xFD, 0x3D, 0xF4, 0xF3, 0xFD, 0x49, 0xFD, 0xD2, 0xFD, 0xED, 0xFD, 0x49, 0xFE, 0x74,
-    0xF0, 0xB4, 0xFE, 0x8A, 0xFE, 0x93, 0xFE, 0xCF, 0xFF, 0xF4, 0xF1, 0x43, 0xED, 0x90, 0x41, 0x88,
-    0xEB, 0x6A, 0x21, 0xD1, 0xFC, 0x42, 0xB2, 0xBD, 0xEA, 0x1E, 0xF1, 0x85, 0x21, 0xD0, 0xF9, 0x44,
-    0xB1, 0xB2, 0xB7, 0xBD, 0xE9, 0x84, 0xFF, 0xF3, 0xFF, 0xFD, 0xEE, 0x63, 0xA0, 0x06, 0xD3, 0x45,
-    0x80, 0x81, 0x85, 0x87, 0x8E, 0xE9, 0x74, 0xFF, 0xFD, 0xE9, 0x74, 0xE9, 0x74, 0xE9, 0x8E, 0x22,
-    0xD0, 0xD1, 0xE0, 0xF0, 0x43, 0xB0, 0xBB, 0xBD, 0xEB, 0x34, 0xEB, 0x34, 0xF5, 0x31, 0x41, 0x8B,
-    0xEB, 0x2A, 0xA2, 0x00, 0xA1, 0xD0, 0xD1, 0xF2, 0xFC, 0x46, 0xB1, 0xB6, 0xB7, 0xBB, 0xBC, 0xBD,
-    0xE9, 0x64, 0xF1, 0x70, 0xE9, 0xDA, 0xE9, 0x64, 0xFF, 0xF9, 0xF1, 0x70, 0x41, 0xBA, 0xE9, 0x43,
-    0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xF6, 0x1A, 0x21, 0x81, 0xF9, 0xA2, 0x00, 0x91, 0xD0, 0xD1, 0xDF,
-    0xFD, 0x43, 0xB9, 0xBD, 0xBF, 0xE9, 0x3C, 0xE9, 0xB2, 0xE9, 0x3C, 0xC2, 0x00, 0x91, 0xD0, 0xD1,
-    0xFF, 0xF6, 0xEA, 0xDD, 0xA0, 0x07, 0x02, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB6, 0xF7,
-    0xA1, 0x03, 0xE2, 0xD0, 0xFD, 0x48, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB9, 0xBB, 0xBD, 0xFF, 0xF5,
-    0xE8, 0xFE, 0xE8, 0xFE, 0xFF, 0xFB, 0xF1, 0x24, 0xE8, 0xFE, 0xE8, 0xFE, 0xE8, 0xFE, 0x43, 0x81,
-    0x82, 0x8E, 0xE8, 0xE5, 0xE8, 0xE5, 0xE8, 0xE5, 0x22, 0xD0, 0xD1, 0xDD, 0xF6, 0x44, 0xB0, 0xB5,
-    0xB8, 0xBE, 0xFF, 0x72, 0xFF, 0xAD, 0xFF, 0xBE, 0xFF, 0xFB, 0x41, 0xB9, 0xE9, 0x59, 0x21, 0xD0,
-    0xFC, 0x21, 0xB5, 0xFD, 0xA1, 0x02, 0xB1, 0xD0, 0xFD, 0x44, 0xB1, 0xB3, 0xB6, 0xBC, 0xE8, 0xBA,
-    0xEA, 0x8F, 0xFF, 0xFB, 0xE8, 0xBA, 0x41, 0x8E, 0xE8, 0xAD, 0x22, 0xD0, 0xD1, 0xEF, 0xFC, 0x42,
-    0xB2, 0xB3, 0xE9, 0x34, 0xF0, 0x9B, 0xA1, 0x00, 0x91, 0xD0, 0xF9, 0x42, 0xB1, 0xB3, 0xE8, 0xB2,
-    0xF0, 0x8F, 0xC2, 0x00, 0x91, 0xD0, 0xD1, 0xFF, 0xF9, 0xEA, 0x56, 0x41, 0xB0, 0xEA, 0x5D, 0xC2,
-    0x00, 0xA1, 0xD0, 0xD1, 0xFF, 0xFC, 0xFF, 0x2F, 0x44, 0xB1, 0xB6, 0xBC, 0xBD, 0xE8, 0x95, 0xF0,
-    0xA1, 0xFF, 0xF7, 0xF0, 0xA1, 0xA1, 0x00, 0x91, 0xD0, 0xF3, 0x24, 0x83, 0x8B, 0x8F, 0x91, 0xC0,
-    0xCC, 0xD8, 0xFB, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xE8, 0xF0, 0xFF, 0x8A, 0xFF, 0xF7, 0xE8, 0x1B,
-    0xC1, 0x01, 0xE1, 0xD0, 0xF7, 0x5F, 0x21, 0xBA, 0xFA, 0xC2, 0x04, 0xC3, 0xD0, 0x2D, 0xFF, 0xFD,
-    0xE8, 0x05, 0xC1, 0x03, 0x32, 0xD0, 0xEB, 0x38, 0x45, 0xB1, 0xB3, 0xB4, 0xBE, 0xBF, 0xF3, 0xD9,
-    0xE8, 0x3E, 0xFF, 0xFA, 0xE7, 0xEB, 0xEC, 0x75, 0x42, 0xBA, 0xBB, 0xE8, 0x42, 0xE8, 0x2B, 0xC1,
-    0x01, 0x31, 0xD0, 0xEB, 0x1B, 0x21, 0x82, 0xFA, 0x22, 0xD0, 0xD1, 0xF0, 0xFD, 0xA0, 0x02, 0x22,
-    0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0x82, 0xE8, 0x24, 0x21, 0xD1, 0xFC, 0x45, 0x81, 0x82,
-    0x85, 0x87, 0x8D, 0xFF, 0xEB, 0xFF, 0xF6, 0xE7, 0xEF, 0xE8, 0xCA, 0xFF, 0xFD, 0xC3, 0x02, 0xB1,
-    0xD0, 0xD1, 0x2D, 0xFF, 0xBB, 0xFF, 0xF0, 0xE7, 0xB1, 0x41, 0xB5, 0xF0, 0x10, 0x42, 0x83, 0x8B,
-    0xE8, 0x76, 0xE8, 0x76, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF5, 0xFF, 0xF9, 0xE7, 0x9A, 0x41, 0xBC,
-    0xE7, 0xE1, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0x21, 0x91, 0xFA, 0xC4, 0x02, 0x21, 0xD0, 0xD1,
-    0x2E, 0x2D, 0xFF, 0xFA, 0xFF, 0xFD, 0xF2, 0x56, 0xE7, 0x83, 0xC1, 0x02, 0x21, 0xD1, 0xE9, 0x31,
-    0x41, 0xD0, 0xFD, 0x11, 0x43, 0xB3, 0xB4, 0xBC, 0xFF, 0xF6, 0xE8, 0x3F, 0xFF, 0xFC, 0xA0, 0x07,
-    0x23, 0x43, 0x81, 0x82, 0x89, 0xFF, 0xFD, 0xE8, 0x32, 0xE8, 0x32, 0xC3, 0x02, 0xB1, 0xD0, 0xD1,
-    0x2D, 0xFF, 0xE9, 0xFF, 0xF6, 0xE7, 0x53, 0x42, 0xB5, 0xBA, 0xE9, 0x61, 0xE8, 0x1C, 0xC1, 0x02,
-    0xB1, 0xD1, 0xF7, 0xC1, 0x44, 0x82, 0x8E, 0x8F, 0x91, 0xE8, 0x0F, 0xE9, 0x54, 0xFF, 0xFA, 0xE9,
-    0x54, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xE8, 0x02, 0xFF, 0xE6, 0xFF, 0xF3, 0xE7, 0x2D, 0x51, 0x80,
-    0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8E, 0x8F, 0x91, 0x8D,
-    0xFF, 0x05, 0xFF, 0x1B, 0xEE, 0x53, 0xFF, 0x6F, 0xEE, 0xE2, 0xED, 0xC6, 0xFF, 0x86, 0xEE, 0x53,
-    0xFC, 0x32, 0xEE, 0xE2, 0xFF, 0x9D, 0xFF, 0xCD, 0xFF, 0xF3, 0xF6, 0xDD, 0xF1, 0xE0, 0xF1, 0xE0,
-    0xEB, 0x2F, 0x42, 0xD0, 0xD1, 0xFD, 0x6B, 0xFF, 0xCC, 0x42, 0xB8, 0xBE, 0xF2, 0xFC, 0xE7, 0x2D,
-    0xA1, 0x01, 0xB1, 0xD0, 0xF9, 0x41, 0x80, 0xF0, 0xCB, 0x21, 0xD1, 0xFC, 0x21, 0xB4, 0xFD, 0x21,
-    0xD0, 0xFD, 0x43, 0xB4, 0xB7, 0xBD, 0xFF, 0xEE, 0xE6, 0xC1, 0xFF, 0xFD, 0x41, 0x82, 0xEC, 0xCE,
-    0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xF2, 0xFF, 0xFC, 0xE6, 0xBE, 0x41, 0x81, 0xE7, 0x03,
-    0x21, 0xD1, 0xFC, 0x21, 0xB0, 0xFD, 0x41, 0xBD, 0xE6, 0xD6, 0x21, 0xD0, 0xFC, 0xC1, 0x00, 0x91,
-    0xD0, 0xF4, 0x20, 0x44, 0xB0, 0xB5, 0xB8, 0xBE, 0xE6, 0xE0, 0xFF, 0xF7, 0xE6, 0xC9, 0xFF, 0xFA,
-    0x43, 0x8B, 0x8E, 0x91, 0xE6, 0xBC, 0xFA, 0xF2, 0xFF, 0xEA, 0x22, 0xD0, 0xD1, 0xE9, 0xF6, 0x21,
-    0x80, 0xFB, 0xC3, 0x02, 0x21, 0xD0, 0xD1, 0x2D, 0xFF, 0xD1, 0xFF, 0xFD, 0xE6, 0x7C, 0x41, 0x80,
-    0xE7, 0x45, 0xA1, 0x00, 0x91, 0xD1, 0xFC, 0x41, 0xB8, 0xEA, 0x29, 0x41, 0x8F, 0xE9, 0x40, 0x22,
-    0xD0, 0xD1, 0xF8, 0xFC, 0x41, 0xBB, 0xE7, 0x2F, 0xA1, 0x00, 0x91, 0xD0, 0xFC, 0x45, 0xB5, 0xB8,
-    0xBC, 0xBD, 0xBE, 0xFF, 0xE5, 0xE6, 0x96, 0xE6, 0xDB, 0xFF, 0xF2, 0xFF, 0xFB, 0x41, 0x81, 0xE8,
-    0xCF, 0x21, 0xD1, 0xFC, 0x42, 0xB5, 0xB9, 0xE6, 0x68, 0xE6, 0x68, 0x41, 0x8F, 0xE6, 0x61, 0xA2,
-    0x03, 0x32, 0xD0, 0xD1, 0xF5, 0xFC, 0x43, 0xB0, 0xB5, 0xB8, 0xFF, 0xEB, 0xFF, 0xF9, 0xE6, 0x56,
-    0x41, 0x91, 0xEF, 0xA3, 0x22, 0xD0, 0xD1, 0xF2, 0xFC, 0xC1, 0x00, 0x91, 0xD0, 0xE7, 0x80, 0x46,
-    0x80, 0x82, 0x83, 0x85, 0x8C, 0x91, 0xFF, 0xF5, 0xE6, 0x6E, 0xE6, 0x54, 0xFF, 0xFA, 0xE6, 0x54,
-    0xFF, 0xA3, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xAB, 0xFF, 0xED, 0xE5, 0xFC, 0x41, 0xD1, 0xE6, 0x9B,
-    0x44, 0xB0, 0xB5, 0xB8, 0xBE, 0xE7, 0x3D, 0xE6, 0x4D, 0xE6, 0x4D, 0xE6, 0x4D, 0x42, 0xD0, 0xD1,
-    0xFF, 0xF3, 0xE6, 0xDB, 0x42, 0xB0, 0xBE, 0xE5, 0xCF, 0xE5, 0xCF, 0x21, 0xD0, 0xF9, 0x44, 0xB0,
-    0xB4, 0xBB, 0xBD, 0xFF, 0xDE, 0xE5, 0xC5, 0xFF, 0xEF, 0xFF, 0xFD, 0xA0, 0x05, 0x22, 0x21, 0x80,
-    0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xED, 0xFF, 0xFD, 0xE5, 0xBD, 0xC1, 0x01, 0xB1, 0xD0, 0xEA,
-    0xD3, 0x41, 0xB8, 0xFB, 0xA9, 0x21, 0xD0, 0xFC, 0xA0, 0x07, 0x51, 0x21, 0x83, 0xFD, 0x21, 0xD1,
-    0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xBF, 0xE7, 0x4E, 0x43, 0x82, 0x85, 0x89, 0xFA,
-    0x96, 0xE5, 0xF2, 0xE6, 0xAC, 0x22, 0xD0, 0xD1, 0xF2, 0xF6, 0x45, 0xB2, 0xB6, 0xBB, 0xBD, 0xBE,
-    0xEA, 0x8C, 0xFF, 0xD1, 0xFF, 0xDB, 0xFF, 0xEA, 0xFF, 0xFB, 0xC1, 0x00, 0x91, 0x2E, 0xE5, 0xD3,
-    0x21, 0x83, 0xFA, 0x21, 0xD1, 0xFD, 0xC1, 0x05, 0x82, 0xD0, 0xE6, 0xA0, 0x43, 0xB1, 0xB2, 0xB3,
-    0xFF, 0xFA, 0xEB, 0x5C, 0xE5, 0xC1, 0xC1, 0x00, 0xA1, 0xD1, 0xEB, 0xB3, 0x42, 0x81, 0x88, 0xFF,
-    0xFA, 0xED, 0xBD, 0x22, 0xD0, 0xD1, 0xE9, 0xF9, 0x43, 0x80, 0x83, 0x8B, 0xFF, 0xDB, 0xFF, 0xFB,
-    0xE6, 0x95, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xB8, 0xFF, 0xF6, 0xE5, 0x3C, 0x41, 0xD0, 0xEE, 0xF6,
-    0x21, 0xB8, 0xFC, 0x42, 0xD0, 0xD1, 0xFF, 0xFD, 0xE6, 0xE8, 0x42, 0xB2, 0xB3, 0xFF, 0xF9, 0xE6,
-    0x2D, 0xC1, 0x01, 0xB1, 0xD1, 0xF8, 0x6A, 0x21, 0x82, 0xFA, 0xA1, 0x03, 0x12, 0xD1, 0xFD, 0x42,
-    0x81, 0x85, 0xFF, 0xFB, 0xE5, 0x04, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xE4, 0xFF, 0xF9,
-    0xE5, 0x08, 0x41, 0xB2, 0xF7, 0xC0, 0x21, 0xD0, 0xFC, 0x42, 0xB5, 0xB8, 0xFF, 0xFD, 0xE5, 0x3D,
-    0x21, 0xD0, 0xF9, 0x43, 0xB3, 0xB4, 0xB5, 0xE5, 0x4A, 0xFF, 0xFD, 0xE5, 0xC0, 0x42, 0x80, 0x91,
-    0xE5, 0xFA, 0xE5, 0xB6, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEF, 0xFF, 0xF9, 0xE4, 0xDA, 0x41, 0xB2,
-    0xEE, 0x05, 0x41, 0x83, 0xF0, 0xE3, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x41, 0xB0, 0xFA, 0xB9, 0x21,
-    0xD0, 0xFC, 0x21, 0xD1, 0xF0, 0x41, 0x82, 0xE4, 0xD4, 0x21, 0xD1, 0xFC, 0x44, 0xB1, 0xB3, 0xBC,
-    0xBF, 0xE4, 0xE0, 0xE7, 0xFE, 0xE4, 0xF7, 0xE4, 0xE0, 0x43, 0x80, 0x82, 0x88, 0xE7, 0xF1, 0xE4,
-    0xD3, 0xE4, 0xD3, 0x22, 0xD0, 0xD1, 0xE9, 0xF6, 0x47, 0xB0, 0xB2, 0xB4, 0xB5, 0xB7, 0xB8, 0xBE,
-    0xFF, 0xCE, 0xFF, 0xD7, 0xEA, 0xA2, 0xE4, 0xB1, 0xFF, 0xDA, 0xFF, 0xE1, 0xFF, 0xFB, 0x41, 0xD1,
-    0xE9, 0x7F, 0x43, 0xB4, 0xBA, 0xBF, 0xE7, 0xC8, 0xE7, 0xC8, 0xE4, 0xAA, 0x41, 0xBE, 0xE4, 0xC3,
-    0xC2, 0x01, 0x31, 0xD0, 0xD1, 0xFF, 0xFC, 0xEB, 0xA7, 0x43, 0x81, 0x85, 0x87, 0xFF, 0xF7, 0xE7,
-    0xB1, 0xE4, 0xDF, 0x22, 0xD0, 0xD1, 0xDF, 0xF6, 0x44, 0x80, 0x83, 0x8F, 0x91, 0xFF, 0xD6, 0xFF,
-    0xFB, 0xE4, 0x71, 0xE4, 0x71, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xB3, 0xFF, 0xF3, 0xE4, 0x49, 0x44,
-    0xB3, 0xB4, 0xBC, 0xBE, 0xE5, 0xF9, 0xE4, 0x34, 0xE4, 0x34, 0xE4, 0x34, 0x42, 0xD0, 0xD1, 0xE8,
-    0xAD, 0xFD, 0x70, 0x21, 0x81, 0xF9, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xE9, 0xFF, 0xFD,
-    0xE4, 0x28, 0x41, 0xB1, 0xE4, 0x6D, 0xA1, 0x00, 0x91, 0xD0, 0xFC, 0x44, 0xB0, 0xB7, 0xB8, 0xBE,
-    0xFF, 0xFB, 0xE4, 0x08, 0xE4, 0x58, 0xED, 0x98, 0xC1, 0x03, 0x32, 0xD0, 0xE5, 0x71, 0x41, 0xBA,
-    0xE4, 0x2E, 0x41, 0x82, 0xE9, 0x80, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x43, 0x80, 0x81, 0x83, 0xFF,
-    0xED, 0xFF, 0xFB, 0xE4, 0x38, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD6, 0xFF, 0xF6, 0xE3, 0xE9, 0x41,
-    0xBA, 0xE3, 0xEB, 0x41, 0x86, 0xE4, 0x37, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x21, 0x81, 0xFB, 0xA1,
-    0x00, 0x91, 0xD1, 0xFD, 0x42, 0xB0, 0xB5, 0xE4, 0x0F, 0xFF, 0xFB, 0x45, 0x83, 0x8B, 0x8E, 0x8F,
-    0x91, 0xE4, 0x08, 0xE4, 0x08, 0xE4, 0x08, 0xE3, 0xDE, 0xE4, 0x08, 0x43, 0xD0, 0xD1, 0x2D, 0xFF,
-    0xE9, 0xFF, 0xF0, 0xE3, 0xB3, 0x42, 0xB4, 0xBA, 0xE7, 0x82, 0xE3, 0xB5, 0x21, 0xD0, 0xF9, 0x41,
-    0x81, 0xE3, 0xFB, 0x21, 0xD1, 0xFC, 0x22, 0xB8, 0xBE, 0xF6, 0xFD, 0x41, 0xB6, 0xE4, 0x68, 0x21,
-    0xD0, 0xFC, 0x44, 0x83, 0x87, 0x8B, 0x8C, 0xFF, 0xFD, 0xE3, 0xEB, 0xE5, 0xBC, 0xFE, 0x5A, 0x43,
-    0xD0, 0xD1, 0x2D, 0xFF, 0xE7, 0xFF, 0xF3, 0xE3, 0x7F, 0x42, 0xB0, 0xB4, 0xE3, 0x90, 0xEA, 0x63,
-    0x44, 0x80, 0x81, 0x88, 0x8D, 0xEC, 0xF3, 0xE3, 0xBF, 0xEC, 0x4A, 0xE3, 0xB3, 0x43, 0xD0, 0xD1,
-    0x2D, 0xFF, 0xEC, 0xFF, 0xF3, 0xE3, 0x61, 0x41, 0xD0, 0xFE, 0xE5, 0x21, 0x80, 0xFC, 0xA1, 0x00,
-    0x92, 0xD1, 0xFD, 0x41, 0xBB, 0xF7, 0xAF, 0x41, 0x80, 0xE4, 0xB6, 0x22, 0xD0, 0xD1, 0xF8, 0xFC,
-    0x41, 0xB7, 0xEF, 0x55, 0xA1, 0x01, 0xB1, 0xD0, 0xFC, 0x43, 0xB0, 0xB5, 0xBE, 0xE3, 0x7D, 0xFF,
-    0xFB, 0xE3, 0x2A, 0xA1, 0x00, 0x91, 0xD0, 0xF6, 0x43, 0xB0, 0xB8, 0xBA, 0xE3, 0x6B, 0xE3, 0x6E,
-    0xE3, 0x6B, 0x42, 0x8B, 0x8C, 0xE3, 0x61, 0xE3, 0x61, 0x43, 0x2E, 0xD0, 0xD1, 0xE3, 0x5A, 0xFF,
-    0xEF, 0xFF, 0xF9, 0x43, 0xB0, 0xB8, 0xBE, 0xE3, 0x6A, 0xE3, 0x6A, 0xE3, 0x53, 0x41, 0x81, 0xE3,
-    0x46, 0x43, 0x2E, 0xD0, 0xD1, 0xE3, 0x42, 0xFF, 0xF2, 0xFF, 0xFC, 0x41, 0xBE, 0xF7, 0x57, 0x21,
-    0xD0, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB8,
-    0xF7, 0x44, 0x21, 0xD0, 0xFC, 0x21, 0xB7, 0xFD, 0x21, 0xD0, 0xFD, 0x43, 0xB5, 0xBB, 0xBE, 0xE3,
-    0x18, 0xFF, 0xF0, 0xFF, 0xFD, 0x42, 0x80, 0x83, 0xE2, 0xBE, 0xED, 0x20, 0xA2, 0x01, 0xE1, 0xD0,
-    0xD1, 0xEF, 0xF9, 0x4A, 0xB1, 0xB3, 0xB4, 0xB6, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xFF, 0x6B,
-    0xFF, 0x78, 0xFF, 0x90, 0xF8, 0xB1, 0xE3, 0x1A, 0xF6, 0xC8, 0xFF, 0xA6, 0xE3, 0x1A, 0xFF, 0xBE,
-    0xFF, 0xF9, 0x41, 0xB8, 0xF8, 0x92, 0x21, 0xD0, 0xFC, 0x44, 0xB2, 0xBA, 0xBC, 0xBD, 0xFF, 0xFD,
-    0xE2, 0xC3, 0xE2, 0xDA, 0xE2, 0xDA, 0x42, 0x82, 0x85, 0xF5, 0xD9, 0xE2, 0xD0, 0xA2, 0x01, 0xE1,
-    0xD0, 0xD1, 0xEC, 0xF9, 0x41, 0xBB, 0xE2, 0xBF, 0x41, 0x83, 0xE2, 0xC7, 0x21, 0xD1, 0xFC, 0x21,
-    0x80, 0xFD, 0x22, 0xD0, 0xD1, 0xF2, 0xFD, 0x45, 0x80, 0x81, 0x82, 0x87, 0x89, 0xFF, 0x78, 0xFF,
-    0xE6, 0xFF, 0xFB, 0xF8, 0x5D, 0xF8, 0x5D, 0xC3, 0x02, 0x21, 0xD0, 0xD1, 0x2D, 0xFF, 0x9C, 0xFF,
-    0xF0, 0xE2, 0x57, 0xC1, 0x02, 0xD1, 0xD1, 0xE8, 0x53, 0x21, 0x82, 0xFA, 0x21, 0xD1, 0xFD, 0x41,
-    0x88, 0xE2, 0x6D, 0x21, 0xD1, 0xFC, 0x41, 0xB4, 0xE2, 0xBC, 0x21, 0xD0, 0xFC, 0x43, 0xB0, 0xB5,
-    0xBE, 0xE2, 0x4C, 0xFF, 0xF6, 0xFF, 0xFD, 0x41, 0x89, 0xE2, 0x55, 0x21, 0xD1, 0xFC, 0x43, 0x83,
-    0x8B, 0x8E, 0xE2, 0x4E, 0xE2, 0x3B, 0xFF, 0xFD, 0xA2, 0x00, 0xA1, 0xD0, 0xD1, 0xE5, 0xF6, 0x46,
-    0xB0, 0xB5, 0xB8, 0xBB, 0xBD, 0xBE, 0xFF, 0xCD, 0xE2, 0xE4, 0xE7, 0xC2, 0xFF, 0xF9, 0xF4, 0xD3,
-    0xE2, 0xE4, 0xA0, 0x07, 0x62, 0x43, 0x81, 0x82, 0x91, 0xFF, 0xFD, 0xF4, 0xBD, 0xE2, 0xCE, 0x43,
-    0xD0, 0xD1, 0x2D, 0xFF, 0xE0, 0xFF, 0xF6, 0xE1, 0xEF, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5,
-    0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB9, 0xFB, 0x27, 0xFB, 0x69, 0xFB, 0xE9,
-    0xFC, 0x28, 0xFC, 0xA9, 0xFC, 0xDD, 0xFD, 0x0B, 0xFD, 0x9C, 0xFD, 0xBD, 0xFD, 0xFC, 0xFE, 0x32,
-    0xFE, 0x66, 0xFE, 0x84, 0xFF, 0x8E, 0xFF, 0xF6, 0xE5, 0xF4, 0x41, 0xD1, 0xE8, 0x0F, 0x21, 0xBA,
-    0xFC, 0xA1, 0x00, 0x91, 0xD0, 0xFD, 0x41, 0x91, 0xE1, 0xD6, 0xC2, 0x00, 0xA1, 0xD0, 0xD1, 0xE7,
-    0x24, 0xFF, 0xFC, 0x41, 0xBE, 0xE1, 0xA7, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xE7, 0x9F, 0x41, 0xBD,
-    0xE5, 0x69, 0x21, 0xD0, 0xFC, 0x44, 0xB4, 0xBA, 0xBC, 0xBF, 0xFF, 0xF2, 0xE2, 0x2F, 0xFF, 0xFD,
-    0xE1, 0x95, 0xA0, 0x07, 0x82, 0x41, 0xBE, 0xE5, 0x52, 0x21, 0xD0, 0xFC, 0x21, 0x81, 0xFD, 0x21,
-    0xD1, 0xFD, 0x22, 0x85, 0x81, 0xF0, 0xFD, 0xC3, 0x00, 0x91, 0x2E, 0xD0, 0xD1, 0xE1, 0x82, 0xFF,
-    0xDE, 0xFF, 0xFB, 0x41, 0xD0, 0xFE, 0x1D, 0x21, 0xBE, 0xFC, 0xA1, 0x00, 0x91, 0xD0, 0xFD, 0xC1,
-    0x01, 0xE1, 0xD0, 0xE5, 0x40, 0x41, 0xD1, 0xFA, 0xD9, 0x44, 0xB1, 0xB2, 0xBA, 0xBB, 0xFF, 0xF6,
-    0xE3, 0x97, 0xFF, 0xFC, 0xE2, 0x1A, 0x41, 0x84, 0xE5, 0x11, 0xA2, 0x00, 0x91, 0xD0, 0xD1, 0xEF,
-    0xFC, 0x45, 0xB0, 0xB2, 0xB5, 0xB8, 0xBE, 0xFF, 0x80, 0xFF, 0x89, 0xFF, 0xC6, 0xFF, 0xD9, 0xFF,
-    0xF9, 0x41, 0xD0, 0xEE, 0x93, 0x41, 0xBF, 0xE4, 0x3E, 0xA1, 0x00, 0x91, 0xD0, 0xFC, 0x41, 0xD0,
-    0xFF, 0x75, 0x42, 0xB4, 0xBA, 0xFF, 0xFC, 0xE1, 0xB2, 0xA1, 0x00, 0x91, 0xD0, 0xF9, 0x46, 0x81,
-    0x83, 0x8B, 0x8E, 0x8F, 0x91, 0xFF, 0xE3, 0xFF, 0xEB, 0xE1, 0x45, 0xE1, 0x45, 0xE1, 0x45, 0xFF,
-    0xFB, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xC0, 0xFF, 0xED, 0xE0, 0xED, 0x42, 0x2E, 0xD0, 0xE1, 0xFC,
-    0xE4, 0xD4, 0x43, 0xB0, 0xB5, 0xBE, 0xFF, 0xF9, 0xE1, 0x3B, 0xF5, 0xDF, 0xA0, 0x07, 0xA2, 0x21,
-    0x2E, 0xFD, 0x21, 0x83, 0xFD, 0xA2, 0x00, 0x91, 0xD0, 0xD1, 0xED, 0xFD, 0x42, 0xB2, 0xBC, 0xE0,
-    0xB7, 0xE0, 0xB7, 0x21, 0xD0, 0xF9, 0x43, 0xB0, 0xB8, 0xBE, 0xE9, 0x89, 0xF3, 0xEA, 0xFF, 0xFD,
-    0x42, 0x83, 0x8B, 0xE0, 0xF3, 0xE0, 0xF3, 0xA2, 0x02, 0x21, 0xD0, 0xD1, 0xEF, 0xF9, 0xA0, 0x07,
-    0xC2, 0x42, 0xB5, 0xBE, 0xE4, 0xF4, 0xF4, 0xAA, 0x41, 0x83, 0xE0, 0xF5, 0xA2, 0x02, 0x21, 0xD0,
-    0xD1, 0xF5, 0xFC, 0x48, 0xB0, 0xB1, 0xB3, 0xBA, 0xBB, 0xBC, 0xBE, 0xBF, 0xE1, 0x0F, 0xE3, 0xCB,
-    0xE0, 0xD0, 0xFF, 0xC2, 0xFF, 0xE4, 0xFF, 0xEB, 0xE0, 0xA6, 0xFF, 0xF9, 0x42, 0xB0, 0xBB, 0xF3,
-    0xA4, 0xE0, 0xD1, 0xC2, 0x00, 0x91, 0xD0, 0xD1, 0xFF, 0xF9, 0xE1, 0x53, 0x42, 0x82, 0x87, 0xFF,
-    0xF7, 0xE3, 0x48, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD0, 0xFF, 0xF9, 0xE0, 0x5B, 0x43, 0xB5, 0xB8,
-    0xBE, 0xE0, 0x7F, 0xE0, 0x7F, 0xE0, 0x96, 0x42, 0xD0, 0xD1, 0xFF, 0xF6, 0xFE, 0x9F, 0x41, 0x87,
-    0xE1, 0x15, 0x21, 0xD1, 0xFC, 0xC1, 0x00, 0x91, 0xD1, 0xFC, 0x9A, 0x45, 0xB0, 0xB2, 0xB5, 0xB8,
-    0xBE, 0xE0, 0x78, 0xFF, 0xEC, 0xFF, 0xF7, 0xE0, 0x78, 0xFF, 0xFA, 0xC1, 0x01, 0x31, 0xD1, 0xE5,
-    0x22, 0x46, 0x80, 0x83, 0x8B, 0x8C, 0x8E, 0x8F, 0xFF, 0xFA, 0xE0, 0x62, 0xE0, 0x62, 0xE5, 0xEA,
-    0xE0, 0x62, 0xE0, 0x62, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD7, 0xFF, 0xED, 0xE0, 0x0A, 0xC1, 0x02,
-    0x21, 0xD1, 0xEB, 0xDF, 0x41, 0xBB, 0xFC, 0xA3, 0x21, 0xD0, 0xFC, 0x43, 0xB1, 0xB7, 0xBA, 0xFF,
-    0xF3, 0xE0, 0x44, 0xFF, 0xFD, 0xC2, 0x00, 0x92, 0xD0, 0x2D, 0xFF, 0xF6, 0xDF, 0xE9, 0x41, 0xB1,
-    0xE3, 0xB9, 0x21, 0xD0, 0xFC, 0x42, 0xB8, 0xBB, 0xFF, 0xFD, 0xDF, 0xCE, 0x41, 0x80, 0xE5, 0x56,
-    0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF5, 0xFF, 0xFC, 0xDF, 0xCE, 0xC1, 0x01, 0xE1, 0xD0, 0xE0, 0xFC,
-    0x21, 0x82, 0xFA, 0x21, 0xD1, 0xFD, 0x41, 0xB0, 0xF3, 0xC5, 0x21, 0xD0, 0xFC, 0x41, 0xBF, 0xDF,
-    0xF9, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xB1, 0xBF, 0xDF, 0xD2, 0xE4,
-    0xAC, 0x21, 0xD0, 0xF9, 0x24, 0xB0, 0xB2, 0xBB, 0xBE, 0xDF, 0xE6, 0xF3, 0xFD, 0x42, 0xD0, 0xD1,
-    0xE5, 0x11, 0xE5, 0x01, 0x41, 0x87, 0xE2, 0xD6, 0x21, 0xD1, 0xFC, 0x22, 0x80, 0x83, 0xF2, 0xFD,
-    0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE4, 0xFF, 0xFB, 0xDF, 0x7E, 0x41, 0xB2, 0xE0, 0x49, 0x42, 0xD0,
-    0x2D, 0xFF, 0xFC, 0xDF, 0x70, 0x42, 0xD0, 0x2D, 0xFC, 0xEF, 0xDF, 0x69, 0x41, 0xB3, 0xDF, 0x57,
-    0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xDF, 0x5E, 0x41, 0xB7, 0xDF, 0x4C, 0xC2, 0x00, 0x91, 0xD0, 0x2D,
-    0xFF, 0xFC, 0xDF, 0x53, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x8D, 0x8E,
-    0x8F, 0x91, 0x89, 0x8A, 0x8B, 0x8C, 0xFE, 0x5D, 0xFE, 0xEF, 0xFF, 0x40, 0xFF, 0x61, 0xFF, 0x7C,
-    0xFF, 0xCC, 0xFF, 0xDA, 0xFF, 0xE1, 0xE5, 0xB9, 0xE6, 0x90, 0xFF, 0xEC, 0xFF, 0xF7, 0xE5, 0xF0,
-    0xE3, 0x59, 0xE3, 0x59, 0xE3, 0x59, 0xE3, 0x59, 0x42, 0xD0, 0xD1, 0xFD, 0x31, 0xFF, 0xCC, 0x42,
-    0xD0, 0xD1, 0xE3, 0x6F, 0xE2, 0x73, 0x42, 0xB1, 0xB7, 0xFF, 0xF9, 0xDF, 0x36, 0x41, 0x82, 0xE3,
-    0x79, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF5, 0xFF, 0xFC, 0xDE, 0xFD, 0x43, 0xB0, 0xB8, 0xBB, 0xDF,
-    0xC8, 0xDF, 0x52, 0xEB, 0x9A, 0xC3, 0x01, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xF6, 0xFE, 0x53, 0xDE,
-    0xE9, 0x41, 0x87, 0xDF, 0x3C, 0x42, 0xD0, 0xD1, 0xEB, 0xCD, 0xFF, 0xFC, 0xA0, 0x01, 0x91, 0x21,
-    0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x43, 0xBB, 0xBC, 0xBF, 0xEB, 0x70, 0xFF, 0xFD, 0xDF, 0x28, 0x21,
-    0xD0, 0xF6, 0x41, 0xBA, 0xEB, 0xE5, 0x41, 0x87, 0xEB, 0xE1, 0xA2, 0x00, 0xA1, 0xD0, 0xD1, 0xF8,
-    0xFC, 0xA0, 0x07, 0xE2, 0x45, 0xB0, 0xB5, 0xB8, 0xBB, 0xBE, 0xFF, 0xD1, 0xFF, 0xEB, 0xFF, 0xF6,
-    0xFF, 0xFD, 0xDE, 0xB6, 0x43, 0x83, 0x8C, 0x8F, 0xDE, 0xF6, 0xFF, 0xC8, 0xEB, 0x41, 0xC3, 0x03,
-    0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xE6, 0xFF, 0xF6, 0xDE, 0x90, 0x42, 0xB2, 0xBB, 0xE1, 0xD0, 0xDE,
-    0xB2, 0x21, 0xD0, 0xF9, 0x45, 0xB2, 0xB4, 0xBA, 0xBE, 0xBF, 0xE5, 0xC6, 0xE7, 0x56, 0xFF, 0xFD,
-    0xE1, 0xC6, 0xE7, 0x56, 0xC1, 0x03, 0x12, 0xD0, 0xEB, 0xE0, 0x21, 0x81, 0xFA, 0x43, 0xD0, 0xD1,
-    0x2D, 0xFF, 0xE7, 0xFF, 0xFD, 0xDE, 0x61, 0xC1, 0x00, 0xA1, 0xD0, 0xFE, 0xE3, 0x42, 0xB0, 0xB5,
-    0xDF, 0x26, 0xFF, 0xFA, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF9, 0xDF, 0x44, 0xDE, 0x4A, 0x41, 0x80,
-    0xFC, 0xF7, 0x43, 0xD0, 0xD1, 0x2D, 0xDF, 0x74, 0xFF, 0xFC, 0xDE, 0x3C, 0x42, 0xB0, 0xBE, 0xDE,
-    0x4D, 0xE6, 0x9D, 0xC2, 0x00, 0xA1, 0xD0, 0x2D, 0xFF, 0xF9, 0xDE, 0x2B, 0xC2, 0x03, 0x32, 0xD0,
-    0x2D, 0xE7, 0xA0, 0xDE, 0x22, 0x41, 0xB1, 0xE7, 0x9E, 0xA0, 0x08, 0x04, 0xC1, 0x01, 0xC1, 0xD1,
-    0xFA, 0x73, 0x22, 0x82, 0x83, 0xF7, 0xFA, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEE, 0xFF, 0xFB, 0xDE,
-    0x07, 0xC2, 0x05, 0x22, 0xD0, 0x2D, 0xE7, 0x7B, 0xDD, 0xFD, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4,
-    0xB5, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB9, 0xFE, 0xF7, 0xF1, 0xBC, 0xE5,
-    0x27, 0xFF, 0x0B, 0xFF, 0x64, 0xFF, 0x93, 0xFF, 0xAA, 0xF1, 0xBC, 0xFF, 0xB8, 0xE5, 0x27, 0xE5,
-    0x27, 0xFF, 0xC9, 0xFF, 0xD2, 0xFF, 0xED, 0xFF, 0xF7, 0xE2, 0x03, 0x42, 0xD1, 0x2D, 0xFD, 0x2D,
-    0xDD, 0xC3, 0xC2, 0x02, 0x21, 0x2E, 0x2D, 0xE8, 0x8F, 0xDD, 0xBC, 0x43, 0x2E, 0xD1, 0x2D, 0xDE,
-    0x88, 0xE8, 0x50, 0xDD, 0xB3, 0x41, 0xB2, 0xE4, 0xF5, 0x41, 0x81, 0xE0, 0xF1, 0x43, 0xD0, 0xD1,
-    0x2D, 0xFF, 0xF8, 0xFF, 0xFC, 0xDD, 0xA1, 0x51, 0x80, 0x81, 0x84, 0x86, 0x87, 0x8A, 0x8C, 0x91,
-    0x82, 0x83, 0x85, 0x88, 0x89, 0x8B, 0x8D, 0x8E, 0x8F, 0xFF, 0xD4, 0xE4, 0xCA, 0xE5, 0x59, 0xE5,
-    0x59, 0xE4, 0xCA, 0xFF, 0xDB, 0xFF, 0xE4, 0xFF, 0xF6, 0xE1, 0xA6, 0xE1, 0xA6, 0xE1, 0xA6, 0xE1,
-    0xA6, 0xE1, 0xA6, 0xE1, 0xA6, 0xE1, 0xA6, 0xE1, 0xA6, 0xE1, 0xA6, 0xC2, 0x02, 0xB1, 0xD0, 0xD1,
-    0xFF, 0x6F, 0xFF, 0xCC, 0x41, 0xB8, 0xDF, 0x14, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xF1, 0x40, 0x42,
-    0x80, 0x83, 0xFF, 0xF9, 0xDD, 0x94, 0x21, 0xD1, 0xF9, 0x41, 0xD1, 0xE8, 0xA9, 0x41, 0x85, 0xDD,
-    0x92, 0x42, 0xD0, 0xD1, 0xDE, 0x49, 0xFF, 0xFC, 0x41, 0xD1, 0xEF, 0xD7, 0x41, 0xB5, 0xDD, 0x7A,
-    0x41, 0x91, 0xDD, 0x76, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x21, 0xBD, 0xFB, 0x21, 0xD0, 0xFD, 0x41,
-    0xB0, 0xDD, 0x67, 0xC2, 0x05, 0x02, 0xD0, 0xD1, 0xFF, 0xFC, 0xE4, 0x87, 0x41, 0xBB, 0xDD, 0x63,
-    0x21, 0xD0, 0xFC, 0x41, 0xB7, 0xDD, 0x5C, 0x21, 0xD0, 0xFC, 0x4E, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4,
-    0xB5, 0xB6, 0xB7, 0xBA, 0xBC, 0xBD, 0xBF, 0xB8, 0xBE, 0xDD, 0x55, 0xDD, 0x55, 0xFF, 0xBC, 0xDF,
-    0xC6, 0xFF, 0xBF, 0xFF, 0xC7, 0xE8, 0x2A, 0xE5, 0xE0, 0xFF, 0xCE, 0xFF, 0xE2, 0xFF, 0xE9, 0xDD,
-    0x55, 0xFF, 0xF6, 0xFF, 0xFD, 0x43, 0xB2, 0xB4, 0xB6, 0xDD, 0x2A, 0xE5, 0xB5, 0xDD, 0x2A, 0x21,
-    0xD0, 0xF6, 0xC1, 0x01, 0xE1, 0xD1, 0xED, 0x5F, 0x41, 0xB2, 0xF2, 0x20, 0x21, 0xD0, 0xFC, 0x21,
-    0xB0, 0xFD, 0xA1, 0x01, 0xE1, 0xD0, 0xFD, 0x49, 0x80, 0x81, 0x82, 0x83, 0x85, 0x87, 0x88, 0x8F,
-    0x8E, 0xFF, 0xE8, 0xFF, 0xEB, 0xEA, 0x31, 0xDD, 0x08, 0xFF, 0xFB, 0xE0, 0xFF, 0xE5, 0x93, 0xDD,
-    0x08, 0xFF, 0xA9, 0xC3, 0x06, 0x02, 0xD0, 0xD1, 0x2D, 0xFF, 0x97, 0xFF, 0xE4, 0xDC, 0x9B, 0x41,
-    0x8C, 0xDC, 0xAA, 0x21, 0xD1, 0xFC, 0x43, 0xB2, 0xBB, 0xBD, 0xDC, 0xE7, 0xFF, 0xFD, 0xDC, 0xE7,
-    0x41, 0x8F, 0xDD, 0x53, 0x43, 0x2E, 0xD0, 0xD1, 0xE4, 0xE5, 0xFF, 0xF2, 0xFF, 0xFC, 0x41, 0xB7,
-    0xDC, 0xCF, 0xA1, 0x00, 0x91, 0xD0, 0xFC, 0x41, 0xB0, 0xDC, 0xAC, 0x21, 0xD0, 0xFC, 0x42, 0xBB,
-    0xBD, 0xDD, 0x35, 0xE4, 0x9C, 0xA1, 0x00, 0x91, 0xD0, 0xF9, 0x46, 0xB0, 0xB5, 0xB8, 0xBA, 0xBB,
-    0xBE, 0xFF, 0xDA, 0xFF, 0xE8, 0xDC, 0x99, 0xDC, 0xD8, 0xFF, 0xF1, 0xFF, 0xFB, 0x41, 0x8E, 0xE5,
-    0xC6, 0xA1, 0x02, 0xB1, 0xD1, 0xFC, 0x44, 0x80, 0x83, 0x8C, 0x91, 0xDC, 0x7D, 0xFF, 0xFB, 0xDC,
-    0x7D, 0xFF, 0xCC, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD7, 0xFF, 0xF3, 0xDC, 0x2B, 0x42, 0xD0, 0xD1,
-    0xDF, 0x5D, 0xFB, 0x8B, 0x43, 0xB0, 0xBB, 0xBD, 0xDC, 0x35, 0xDC, 0xCF, 0xFF, 0xF9, 0xC2, 0x02,
-    0x21, 0xD0, 0x2D, 0xFF, 0xF6, 0xDC, 0x10, 0x41, 0xD1, 0xDF, 0x85, 0x41, 0xB6, 0xE8, 0x1A, 0x21,
-    0xD0, 0xFC, 0x43, 0xB2, 0xB5, 0xBE, 0xF1, 0xF2, 0xFF, 0xF5, 0xFF, 0xFD, 0x42, 0xD0, 0x2D, 0xFF,
-    0xF6, 0xDB, 0xF2, 0x43, 0xB1, 0xB5, 0xBE, 0xDD, 0xA5, 0xE2, 0xD6, 0xE4, 0xB0, 0xC2, 0x02, 0xB1,
-    0xD0, 0x2D, 0xFF, 0xF6, 0xDB, 0xE1, 0xC1, 0x02, 0x02, 0x2D, 0xDB, 0xD8, 0x41, 0x2E, 0xE3, 0x1E,
-    0x43, 0xB7, 0xBD, 0xBF, 0xDB, 0xC3, 0xDD, 0x3D, 0xDB, 0xFC, 0x21, 0xD0, 0xF6, 0x43, 0xB9, 0xBD,
-    0xBE, 0xFF, 0xEF, 0xFE, 0x8B, 0xFF, 0xFD, 0x41, 0x80, 0xE4, 0x93, 0x21, 0xD1, 0xFC, 0x41, 0xD0,
-    0xE2, 0xC5, 0x44, 0x81, 0x82, 0x83, 0x87, 0xE2, 0xF8, 0xFF, 0xF9, 0xFF, 0xFC, 0xE2, 0xF8, 0xC4,
-    0x02, 0xB1, 0x2E, 0xD0, 0xD1, 0x2D, 0xE2, 0xEB, 0xFF, 0xDE, 0xFF, 0xF3, 0xDB, 0x9F, 0x41, 0xBF,
-    0xDF, 0x69, 0xA1, 0x01, 0xF1, 0xD0, 0xFC, 0x21, 0xBE, 0xFB, 0xC2, 0x03, 0x32, 0xD0, 0x2D, 0xFF,
-    0xFD, 0xDB, 0x84, 0x42, 0xB1, 0xBF, 0xDB, 0xDA, 0xDB, 0xDA, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xE1,
-    0xEE, 0x42, 0xB0, 0xBE, 0xDE, 0x12, 0xFF, 0xF9, 0x41, 0x8E, 0xDE, 0x0B, 0xC3, 0x00, 0x91, 0xD0,
-    0xD1, 0x2D, 0xFF, 0xF5, 0xFF, 0xFC, 0xDB, 0x62, 0xC2, 0x05, 0x22, 0xD0, 0x2D, 0xE3, 0xE2, 0xDB,
-    0x56, 0x45, 0xB2, 0xB5, 0xB9, 0xBA, 0xBD, 0xDB, 0xAC, 0xDB, 0xAC, 0xDB, 0xAC, 0xDB, 0xAC, 0xDB,
-    0xAC, 0x44, 0x82, 0x8E, 0x8F, 0x91, 0xDB, 0x9C, 0xDB, 0x9C, 0xDC, 0x12, 0xDB, 0x9C, 0x43, 0x2E,
-    0xD0, 0xD1, 0xDC, 0x05, 0xFF, 0xE3, 0xFF, 0xF3, 0x44, 0xB0, 0xB5, 0xB8, 0xBE, 0xFF, 0xF6, 0xDB,
-    0xFB, 0xE3, 0x91, 0xDB, 0xFB, 0x43, 0x83, 0x8B, 0x91, 0xDB, 0xEE, 0xE3, 0x84, 0xDB, 0xEE, 0xC3,
-    0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xE9, 0xFF, 0xF6, 0xDB, 0x0F, 0x42, 0xB5, 0xB8, 0xDB, 0x62,
-    0xDA, 0xF8, 0x21, 0xD0, 0xF9, 0x41, 0xBC, 0xE3, 0xD5, 0xA1, 0x02, 0xB1, 0xD0, 0xFC, 0x42, 0x2E,
-    0xD1, 0xDD, 0x0A, 0xF7, 0xEF, 0x42, 0xB3, 0xB6, 0xDB, 0x17, 0xDB, 0x17, 0xA1, 0x08, 0x42, 0xD0,
-    0xF9, 0x41, 0xBD, 0xDB, 0xB2, 0xC2, 0x04, 0x82, 0x2E, 0xD0, 0xDC, 0xF3, 0xFF, 0xFC, 0xC1, 0x02,
-    0xB1, 0xD1, 0xF4, 0x60, 0x41, 0xBF, 0xE8, 0x2F, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xFF, 0xFC, 0xE0,
-    0x00, 0x42, 0xB0, 0xBB, 0xDA, 0xB2, 0xDB, 0x1C, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xE1, 0x30, 0x4E,
-    0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFF, 0xB3,
-    0xFF, 0xBA, 0xDF, 0x13, 0xDC, 0x66, 0xDC, 0xC9, 0xDD, 0xFB, 0xDC, 0xC9, 0xE6, 0x56, 0xFF, 0xBF,
-    0xFF, 0xCD, 0xFF, 0xD6, 0xFF, 0xDF, 0xFF, 0xE9, 0xFF, 0xF9, 0xA0, 0x08, 0x63, 0x42, 0xB3, 0xB5,
-    0xDA, 0xC6, 0xFF, 0xFD, 0x21, 0x91, 0xF6, 0x22, 0xD0, 0xD1, 0xF6, 0xFD, 0x42, 0xBD, 0xBF, 0xDA,
-    0xB7, 0xDA, 0xA0, 0xA1, 0x01, 0xE1, 0xD0, 0xF9, 0x44, 0xB2, 0xB5, 0xBA, 0xBE, 0xDA, 0x5B, 0xDA,
-    0xC5, 0xDA, 0xAB, 0xDA, 0xC5, 0x42, 0xB5, 0xB8, 0xDA, 0xAA, 0xDA, 0xAA, 0x41, 0x91, 0xDA, 0xA3,
-    0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0x42, 0x80, 0x91, 0xFF, 0xFB, 0xDA, 0xA8, 0x22, 0xD0, 0xD1, 0xDC,
-    0xF9, 0xC1, 0x01, 0xE1, 0xD0, 0xDB, 0x42, 0x47, 0x80, 0x81, 0x82, 0x85, 0x88, 0x8D, 0x8E, 0xFF,
-    0xC0, 0xFF, 0xCC, 0xFF, 0xF5, 0xDC, 0x51, 0xFF, 0xFA, 0xDC, 0x51, 0xDC, 0x51, 0x43, 0xD0, 0xD1,
-    0x2D, 0xFF, 0x72, 0xFF, 0xEA, 0xDA, 0x21, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
-    0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xB9, 0xBF, 0xFD, 0x7C, 0xE1, 0xDF, 0xFD, 0xEC, 0xFE, 0x07,
-    0xFE, 0x25, 0xFE, 0x36, 0xE5, 0x89, 0xFE, 0x3F, 0xFE, 0x78, 0xFE, 0x93, 0xFE, 0xB5, 0xFE, 0xC1,
-    0xFF, 0x08, 0xFF, 0xF6, 0xDE, 0x26, 0xDE, 0x26, 0x42, 0x81, 0x87, 0xDA, 0x37, 0xDA, 0x45, 0xC2,
-    0x00, 0x91, 0xD0, 0xD1, 0xE6, 0xD3, 0xFF, 0xF9, 0x42, 0xD0, 0xD1, 0xDB, 0x21, 0xF6, 0xD5, 0x41,
-    0x81, 0xF1, 0x05, 0xA1, 0x00, 0x91, 0xD1, 0xFC, 0x44, 0xB0, 0xB5, 0xB8, 0xBE, 0xFF, 0xE7, 0xFF,
-    0xF0, 0xFD, 0xBF, 0xFF, 0xFB, 0x43, 0x83, 0x8E, 0x8F, 0xD9, 0xFE, 0xDA, 0x18, 0xEA, 0x88, 0x43,
-    0xD0, 0xD1, 0x2D, 0xFF, 0xE9, 0xFF, 0xF6, 0xD9, 0xAF, 0xC2, 0x02, 0x21, 0xD0, 0x2D, 0xDB, 0x78,
-    0xD9, 0xA5, 0x41, 0xB5, 0xEE, 0xF6, 0x41, 0x80, 0xE6, 0xFD, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0xC1,
-    0x01, 0x31, 0xD0, 0xEF, 0x32, 0xA0, 0x08, 0x93, 0x42, 0xB5, 0xBE, 0xE0, 0xD2, 0xEF, 0x7C, 0x41,
-    0x8C, 0xD9, 0x74, 0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0xC1, 0x02, 0x21, 0xD1, 0xDC, 0xDA, 0x48, 0xB1,
-    0xB2, 0xB3, 0xB5, 0xB7, 0xBA, 0xBC, 0xBF, 0xFF, 0xDC, 0xFF, 0xE1, 0xF3, 0xAD, 0xE0, 0xBC, 0xFF,
-    0xE7, 0xDE, 0x43, 0xFF, 0xF5, 0xFF, 0xFA, 0x41, 0xB1, 0xD9, 0x9C, 0x21, 0xD0, 0xFC, 0x41, 0xB5,
-    0xEF, 0x46, 0x21, 0xD0, 0xFC, 0x41, 0xD1, 0xDE, 0x83, 0x21, 0xB0, 0xFC, 0x21, 0xD0, 0xFD, 0x44,
-    0x80, 0x82, 0x87, 0x91, 0xFF, 0xEC, 0xFF, 0xF3, 0xFF, 0xFD, 0xE0, 0x8B, 0xC4, 0x02, 0xB1, 0x2E,
-    0xD0, 0xD1, 0x2D, 0xE0, 0x7E, 0xFF, 0xC2, 0xFF, 0xF3, 0xD9, 0x32, 0x44, 0xD0, 0xD1, 0x2E, 0x2D,
-    0xF1, 0x9A, 0xF1, 0x9D, 0xE3, 0xF6, 0xD9, 0x23, 0x42, 0x87, 0x91, 0xD9, 0xEB, 0xD9, 0xEB, 0x42,
-    0xD0, 0xD1, 0xEE, 0xB2, 0xFF, 0xF9, 0x43, 0xB3, 0xB7, 0xBC, 0xF1, 0xA8, 0xD8, 0xFD, 0xFF, 0xF9,
-    0x42, 0x81, 0x89, 0xF1, 0x9E, 0xD9, 0xD3, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xEF, 0xFF,
-    0xF9, 0xD8, 0xF7, 0x42, 0xB5, 0xB8, 0xDB, 0x05, 0xDB, 0x05, 0x42, 0x8E, 0x8F, 0xDA, 0xFE, 0xE0,
-    0x30, 0xA0, 0x0B, 0xF1, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF, 0xEF, 0xFF, 0xF6, 0xFF, 0xFD, 0xD8,
-    0xDA, 0x51, 0x80, 0x81, 0x82, 0x83, 0x86, 0x87, 0x88, 0x8A, 0x8B, 0x8C, 0x8E, 0x8F, 0x91, 0x84,
-    0x85, 0x89, 0x8D, 0xFF, 0x1E, 0xE0, 0x00, 0xFF, 0x28, 0xFF, 0x9B, 0xE0, 0x8F, 0xDF, 0x73, 0xE0,
-    0x8F, 0xFF, 0xAA, 0xFF, 0xD6, 0xFF, 0xF3, 0xE8, 0x8A, 0xE3, 0x8D, 0xE3, 0x8D, 0xDC, 0xDC, 0xDC,
-    0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0x42, 0xD0, 0xD1, 0xFE, 0x82, 0xFF, 0xCC, 0xC1, 0x01, 0xE1, 0xD1,
-    0xDF, 0x0C, 0x41, 0xD0, 0xE9, 0xF4, 0x41, 0xBE, 0xDF, 0x73, 0x21, 0xD0, 0xFC, 0xC1, 0x00, 0xD1,
-    0xD0, 0xDC, 0xE1, 0x42, 0xB0, 0xB4, 0xFF, 0xFA, 0xDB, 0x66, 0x21, 0xD0, 0xF9, 0x49, 0xB1, 0xB2,
-    0xB3, 0xB4, 0xB7, 0xBC, 0xBD, 0xBE, 0xBF, 0xD8, 0xD0, 0xD8, 0xD0, 0xFF, 0xDF, 0xFF, 0xE5, 0xFF,
-    0xED, 0xEE, 0xCD, 0xFF, 0xFD, 0xD8, 0xC2, 0xD8, 0xD0, 0x41, 0xBA, 0xDB, 0xA1, 0x42, 0xB0, 0xBE,
-    0xD8, 0x7F, 0xD8, 0x7F, 0x21, 0xD0, 0xF9, 0x21, 0x82, 0xFD, 0x22, 0xD0, 0xD1, 0xEF, 0xFD, 0x42,
-    0x80, 0x83, 0xE1, 0xC1, 0xD8, 0x5A, 0x21, 0xD1, 0xF9, 0x45, 0x81, 0x82, 0x84, 0x85, 0x86, 0xFF,
-    0xF1, 0xFF, 0xFD, 0xD8, 0x94, 0xD9, 0x4E, 0xD8, 0xB6, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF,
-    0xB4, 0xFF, 0xF0, 0xD8, 0x25, 0x41, 0x80, 0xD9, 0x32, 0xC2, 0x03, 0x32, 0xD1, 0x2D, 0xFF, 0xFC,
-    0xD8, 0x15, 0x45, 0xB0, 0xB5, 0xB7, 0xB8, 0xBE, 0xF4, 0x7D, 0xE1, 0x91, 0xEC, 0x70, 0xD8, 0x51,
-    0xE1, 0x91, 0x46, 0x80, 0x81, 0x83, 0x85, 0x8B, 0x91, 0xED, 0xF2, 0xD8, 0x80, 0xD8, 0x41, 0xD9,
-    0x6B, 0xD8, 0xD1, 0xE1, 0x81, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xDD, 0xFF, 0xED, 0xD7, 0xE9, 0xC1,
-    0x02, 0x21, 0xD0, 0xE9, 0x47, 0x41, 0xB8, 0xE3, 0xF0, 0xA1, 0x00, 0xA1, 0xD0, 0xFC, 0x44, 0xB4,
-    0xB5, 0xBB, 0xBD, 0xD7, 0xC5, 0xD7, 0xEB, 0xFF, 0xF1, 0xFF, 0xFB, 0x42, 0xB5, 0xBE, 0xF1, 0x1F,
-    0xD7, 0xF1, 0x44, 0x83, 0x8B, 0x8F, 0x91, 0xD7, 0xEA, 0xD7, 0xEA, 0xD8, 0xD5, 0xF1, 0x18, 0x22,
-    0xD0, 0xD1, 0xEC, 0xF3, 0x21, 0x80, 0xFB, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD7, 0xFF, 0xFD, 0xD7,
-    0xA7, 0x41, 0xB9, 0xD7, 0xFC, 0x21, 0xD0, 0xFC, 0x41, 0xBC, 0xD7, 0xF2, 0x42, 0xD0, 0xD1, 0xFF,
-    0xFC, 0xEF, 0xCA, 0x21, 0xBE, 0xF9, 0x21, 0xD0, 0xFD, 0x44, 0xB2, 0xB5, 0xB6, 0xB8, 0xD7, 0xCA,
-    0xFF, 0xEC, 0xED, 0x7B, 0xFF, 0xFD, 0x42, 0x80, 0x8C, 0xD7, 0xA6, 0xD7, 0xBD, 0x43, 0xD0, 0xD1,
-    0x2D, 0xFF, 0xEC, 0xFF, 0xF9, 0xD7, 0x71, 0x41, 0xBE, 0xF2, 0x35, 0x21, 0xD0, 0xFC, 0xC1, 0x01,
-    0xB1, 0xD0, 0xFA, 0x2E, 0x41, 0xD0, 0xDF, 0x80, 0x41, 0xB8, 0xD9, 0xE4, 0x21, 0xD0, 0xFC, 0x47,
-    0xB2, 0xB3, 0xB4, 0xB7, 0xBD, 0xBE, 0xBF, 0xFF, 0xEC, 0xD7, 0x44, 0xFF, 0xEF, 0xED, 0xAB, 0xFF,
-    0xF5, 0xDA, 0x9B, 0xFF, 0xFD, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xEA, 0xDA, 0x9D, 0xD7,
-    0x39, 0x42, 0xD0, 0x2D, 0xF4, 0xF5, 0xD7, 0x2D, 0x41, 0xBD, 0xD7, 0xA7, 0x21, 0xD0, 0xFC, 0xC1,
-    0x00, 0x91, 0xD0, 0xF2, 0xAD, 0x45, 0xB2, 0xB3, 0xB4, 0xBD, 0xBE, 0xDA, 0x65, 0xFF, 0xF7, 0xE6,
-    0x0F, 0xDB, 0x83, 0xFF, 0xFA, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF0, 0xD8, 0xBC, 0xD7, 0x09, 0x42,
-    0xD1, 0x2D, 0xF0, 0x4D, 0xD6, 0xFF, 0xC1, 0x02, 0x02, 0xD1, 0xD7, 0xA1, 0x42, 0xB0, 0xB8, 0xD6,
-    0xE7, 0xD7, 0x51, 0x21, 0xD0, 0xF9, 0x41, 0xD1, 0xE3, 0xC3, 0x44, 0xB0, 0xB2, 0xBB, 0xBE, 0xFF,
-    0xEC, 0xFF, 0xF9, 0xFF, 0xFC, 0xD6, 0xFF, 0x41, 0x82, 0xD8, 0x91, 0x42, 0xD0, 0xD1, 0xF2, 0xD3,
-    0xFF, 0xFC, 0x43, 0x80, 0x81, 0x83, 0xDB, 0xD4, 0xFF, 0xF9, 0xD6, 0xE7, 0xC3, 0x00, 0x91, 0xD0,
-    0xD1, 0x2D, 0xFF, 0xDE, 0xFF, 0xF6, 0xD6, 0xC2, 0x41, 0x86, 0xD9, 0xDB, 0x41, 0xBD, 0xD9, 0xD7,
-    0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x22, 0xD1, 0xD0, 0xEC,
-    0xFD, 0x41, 0xD0, 0xE1, 0x1E, 0x21, 0x81, 0xFC, 0x21, 0xD1, 0xFD, 0x41, 0xBA, 0xDE, 0x61, 0x21,
-    0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x44, 0xB0, 0xBE, 0xBF, 0xBB, 0xFF, 0xE4, 0xFF,
-    0xF0, 0xD6, 0xD7, 0xFF, 0xFD, 0x41, 0xD0, 0xF5, 0x60, 0xC1, 0x00, 0xA1, 0xD1, 0xE7, 0x08, 0x22,
-    0x83, 0x8C, 0xF6, 0xFA, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xE4, 0xFF, 0xFB, 0xD6, 0x6A,
-    0x42, 0x83, 0x8C, 0xD6, 0xBD, 0xD7, 0x33, 0x42, 0xD0, 0xD1, 0xE0, 0x1F, 0xFF, 0xF9, 0x21, 0xBD,
-    0xF9, 0x21, 0xD0, 0xFD, 0x45, 0xB0, 0xB5, 0xB8, 0xBE, 0xBF, 0xD7, 0x1F, 0xFF, 0xFD, 0xD6, 0x65,
-    0xDC, 0x86, 0xEA, 0x57, 0xC1, 0x00, 0xA1, 0xD0, 0xD9, 0x76, 0x42, 0x80, 0x87, 0xD7, 0x4D, 0xFF,
-    0xFA, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE3, 0xFF, 0xF9, 0xD6, 0x2D, 0x41, 0xBB, 0xED, 0x59, 0x21,
-    0xD0, 0xFC, 0x41, 0xBB, 0xD9, 0xF5, 0x21, 0xD0, 0xFC, 0x22, 0xBA, 0xBF, 0xF6, 0xFD, 0x42, 0xD0,
-    0xD1, 0xFF, 0xFB, 0xF2, 0x71, 0x43, 0xB4, 0xB6, 0xBE, 0xD6, 0x5A, 0xD8, 0x23, 0xFF, 0xF9, 0x41,
-    0xBF, 0xD8, 0x19, 0x41, 0xB8, 0xD8, 0x15, 0x21, 0xD0, 0xFC, 0x42, 0x82, 0x83, 0xFF, 0xFD, 0xD8,
-    0x0E, 0xA2, 0x01, 0xE1, 0xD0, 0xD1, 0xEE, 0xF9, 0x43, 0x81, 0x84, 0x8A, 0xFF, 0xF9, 0xD8, 0x00,
-    0xD8, 0x00, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD3, 0xFF, 0xF6, 0xD5, 0xDC, 0xC1, 0x00, 0x91, 0xD0,
-    0xD6, 0x4F, 0xC1, 0x00, 0x91, 0xD0, 0xD6, 0x17, 0x41, 0xD1, 0xF2, 0xC5, 0x41, 0xB2, 0xD5, 0xDD,
-    0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0xA1, 0x00, 0x91, 0xD0, 0xFD, 0x49, 0xB1, 0xB2, 0xB3, 0xB4,
-    0xB7, 0xBA, 0xBB, 0xBD, 0xBF, 0xEF, 0x9E, 0xDA, 0x58, 0xD6, 0x12, 0xFF, 0xE1, 0xFF, 0xE7, 0xFF,
-    0xED, 0xDA, 0xD7, 0xFF, 0xFB, 0xF8, 0x7D, 0xC2, 0x00, 0x91, 0xD0, 0xD1, 0xD5, 0xB5, 0xDB, 0x07,
-    0x43, 0xB0, 0xBA, 0xBF, 0xD5, 0x83, 0xE9, 0x9B, 0xD8, 0xDA, 0x21, 0xD0, 0xF6, 0x43, 0xB0, 0xB2,
-    0xBA, 0xD5, 0xC6, 0xD7, 0x3B, 0xD5, 0xC6, 0x42, 0xD0, 0xD1, 0xFF, 0xF6, 0xF2, 0x76, 0x46, 0x80,
-    0x81, 0x82, 0x83, 0x85, 0x88, 0xFF, 0xD9, 0xFF, 0xEC, 0xFF, 0xF9, 0xE7, 0x1F, 0xD6, 0xDF, 0xD5,
-    0xB5, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xAA, 0xFF, 0xED, 0xD5, 0x5D, 0x41, 0xBA, 0xD9, 0x2C, 0x21,
-    0xD0, 0xFC, 0x44, 0xB0, 0xBB, 0xBD, 0xBE, 0xF3, 0x0A, 0xF0, 0xCC, 0xD5, 0x94, 0xFF, 0xFD, 0xC2,
-    0x02, 0x21, 0xD0, 0x2D, 0xFF, 0xF3, 0xD5, 0x3F, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6,
-    0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFD, 0x11, 0xFD, 0x21, 0xFD, 0x4D, 0xFD,
-    0x8F, 0xFD, 0xC5, 0xFD, 0xFD, 0xFE, 0x09, 0xFE, 0x2D, 0xDB, 0xDC, 0xFE, 0x37, 0xFE, 0x74, 0xFE,
-    0xCC, 0xFF, 0x09, 0xFF, 0x5A, 0xFF, 0xD9, 0xFF, 0xF7, 0x42, 0x81, 0x83, 0xD9, 0x4D, 0xD6, 0x1E,
-    0x21, 0xD1, 0xF9, 0x41, 0xD0, 0xEC, 0x09, 0x42, 0x81, 0x83, 0xFF, 0xFC, 0xE1, 0x0E, 0x21, 0xD1,
-    0xF9, 0x41, 0xB7, 0xD5, 0x93, 0x21, 0xD0, 0xFC, 0x45, 0xB0, 0xB2, 0xB6, 0xB8, 0xBE, 0xFF, 0xE8,
-    0xD5, 0x45, 0xD5, 0x45, 0xFF, 0xF6, 0xFF, 0xFD, 0x41, 0x80, 0xD6, 0xF0, 0xC3, 0x00, 0x91, 0xD0,
-    0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xFC, 0xD4, 0xD2, 0xA0, 0x08, 0xC2, 0x21, 0xB4, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x85, 0xD4, 0xFF, 0x43, 0x2E, 0xD0, 0xD1, 0xD4,
-    0xFB, 0xD6, 0xD0, 0xFF, 0xFC, 0x41, 0xB2, 0xD4, 0xF1, 0x21, 0xD0, 0xFC, 0x44, 0xB0, 0xB5, 0xB8,
-    0xBE, 0xFF, 0xEF, 0xD4, 0xEA, 0xD4, 0xEA, 0xFF, 0xFD, 0x41, 0x2E, 0xD4, 0xDD, 0x21, 0x83, 0xFC,
-    0xA2, 0x01, 0x31, 0xD0, 0xD1, 0xEC, 0xFD, 0x41, 0xB0, 0xE8, 0xE8, 0x41, 0x8B, 0xD4, 0xB1, 0x22,
-    0xD0, 0xD1, 0xF8, 0xFC, 0x42, 0xD0, 0xD1, 0xF7, 0x48, 0xDB, 0x6C, 0x41, 0x81, 0xFF, 0x78, 0x21,
-    0xD1, 0xFC, 0x41, 0x80, 0xE8, 0xD0, 0x21, 0xD1, 0xFC, 0x49, 0xB0, 0xB1, 0xB4, 0xBA, 0xBB, 0xBC,
-    0xBD, 0xBE, 0xBF, 0xFF, 0xAB, 0xD4, 0xC4, 0xD4, 0xC4, 0xFF, 0xD7, 0xFF, 0xE6, 0xFF, 0xEB, 0xD4,
-    0xB3, 0xFF, 0xF6, 0xFF, 0xFD, 0xA0, 0x03, 0x02, 0x42, 0xB2, 0xBB, 0xFF, 0xFD, 0xD4, 0xA5, 0x41,
-    0xD0, 0xE4, 0x55, 0x21, 0x8F, 0xFC, 0xA2, 0x00, 0x91, 0xD0, 0xD1, 0xF2, 0xFD, 0x43, 0x81, 0x82,
-    0x8C, 0xE6, 0xF5, 0xFF, 0xF9, 0xD6, 0x08, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xC2, 0xFF, 0xF6, 0xD4,
-    0x27, 0x41, 0xB2, 0xD4, 0x6E, 0x21, 0xD0, 0xFC, 0x43, 0xB0, 0xB5, 0xB8, 0xD4, 0x5E, 0xD5, 0x2F,
-    0xD4, 0x44, 0x42, 0xD0, 0xD1, 0xFF, 0xF6, 0xD9, 0x7C, 0x43, 0xB0, 0xB2, 0xBC, 0xFF, 0xEC, 0xFF,
-    0xF9, 0xD4, 0x64, 0x42, 0xB5, 0xBE, 0xFA, 0xB2, 0xD6, 0x1C, 0xA1, 0x02, 0x52, 0xD0, 0xF9, 0x41,
-    0x87, 0xD5, 0x08, 0x21, 0xD1, 0xFC, 0x42, 0x8E, 0x8F, 0xD4, 0x03, 0xD4, 0x03, 0x21, 0xD1, 0xF9,
-    0x23, 0x80, 0x83, 0x8C, 0xEA, 0xF3, 0xFD, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xD2, 0xFF,
-    0xF9, 0xD3, 0xD7, 0xC2, 0x00, 0x92, 0xD0, 0x2D, 0xF4, 0x1A, 0xD3, 0xCB, 0xC1, 0x01, 0x31, 0xD1,
-    0xD3, 0xE3, 0x21, 0xBB, 0xFA, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xFD, 0xDA, 0x33, 0xD3, 0xB9, 0x41,
-    0xB4, 0xD3, 0xBB, 0x41, 0x81, 0xD4, 0xC4, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0xA0, 0x08, 0xE1, 0x21,
-    0x80, 0xFD, 0xA1, 0x05, 0x32, 0xD1, 0xFD, 0x21, 0xBE, 0xFB, 0x21, 0xD0, 0xFD, 0xC1, 0x02, 0x02,
-    0xD0, 0xEF, 0xB2, 0x23, 0xB0, 0xBB, 0xBE, 0xE4, 0xF7, 0xFA, 0x42, 0xB5, 0xB8, 0xD3, 0xB2, 0xD3,
-    0xB2, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xF1, 0xD5, 0x42, 0x80, 0x83, 0xFF, 0xF9, 0xD3, 0xBB, 0x43,
-    0xD0, 0xD1, 0x2D, 0xFF, 0xE4, 0xFF, 0xF9, 0xD3, 0x6F, 0x42, 0xD0, 0xD1, 0xD4, 0x6A, 0xDD, 0x31,
-    0x21, 0xBB, 0xF9, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xFD, 0xD6, 0x27, 0xD3, 0x5B, 0x42, 0xBB, 0xBD,
-    0xDD, 0xA8, 0xD3, 0x46, 0xC1, 0x01, 0xB1, 0xD0, 0xF6, 0x2B, 0x21, 0x82, 0xFA, 0x43, 0xD0, 0xD1,
-    0x2D, 0xFF, 0xF0, 0xFF, 0xFD, 0xD3, 0x41, 0xC2, 0x00, 0x91, 0xD0, 0x2D, 0xD8, 0x6D, 0xD3, 0x37,
-    0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x8E, 0x8F, 0x91, 0x86, 0x89, 0x8A, 0x8B,
-    0x8C, 0x8D, 0xFE, 0x5C, 0xFF, 0x07, 0xFF, 0x57, 0xFF, 0x63, 0xFF, 0x75, 0xFF, 0xBF, 0xD9, 0xD4,
-    0xFF, 0xD3, 0xFF, 0xED, 0xFF, 0xF7, 0xD9, 0xD4, 0xD7, 0x3D, 0xD7, 0x3D, 0xD7, 0x3D, 0xD7, 0x3D,
-    0xD7, 0x3D, 0xD7, 0x3D, 0x42, 0xD0, 0xD1, 0xFD, 0xC4, 0xFF, 0xCC, 0x41, 0xB2, 0xE7, 0x57, 0xC2,
-    0x01, 0xB1, 0xD0, 0x2D, 0xFF, 0xFC, 0xD2, 0xEF, 0x42, 0xD0, 0x2D, 0xDC, 0x64, 0xD2, 0xE6, 0x42,
-    0x81, 0x82, 0xD3, 0xF8, 0xD7, 0x84, 0x42, 0xD1, 0x2D, 0xFF, 0xF9, 0xD2, 0xD8, 0x42, 0xD0, 0x2D,
-    0xD7, 0x31, 0xD2, 0xD1, 0x42, 0xD1, 0x2D, 0xD4, 0x8F, 0xD2, 0xCA, 0x50, 0xB4, 0xBD, 0xBE, 0xBF,
-    0xBA, 0xB0, 0xB1, 0xB2, 0xB3, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBB, 0xBC, 0xFF, 0xD4, 0xFF, 0xDD,
-    0xFF, 0xEB, 0xFF, 0xF2, 0xFF, 0xF9, 0xD6, 0xD2, 0xD6, 0xD2, 0xD6, 0xD2, 0xD6, 0xD2, 0xD6, 0xD2,
-    0xD6, 0xD2, 0xD6, 0xD2, 0xD6, 0xD2, 0xD6, 0xD2, 0xD6, 0xD2, 0xD6, 0xD2, 0x42, 0xB0, 0xB5, 0xD2,
-    0xAD, 0xD2, 0x87, 0x21, 0xD0, 0xF9, 0x41, 0xBE, 0xDC, 0xDF, 0x41, 0x83, 0xE6, 0xE8, 0x22, 0xD0,
-    0xD1, 0xF8, 0xFC, 0x44, 0xB1, 0xBA, 0xBC, 0xBD, 0xD2, 0xDA, 0xFF, 0xF0, 0xFF, 0xFB, 0xD2, 0xDA,
-    0x42, 0x84, 0x88, 0xE6, 0xD2, 0xD2, 0xCD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xF9, 0xD2,
-    0x67, 0x42, 0xD0, 0x2D, 0xE6, 0xBA, 0xD2, 0x5D, 0x41, 0x81, 0xDF, 0xBB, 0x43, 0xD0, 0xD1, 0x2D,
-    0xE6, 0xAF, 0xFF, 0xFC, 0xD2, 0x52, 0xC1, 0x01, 0x31, 0x2D, 0xD2, 0x48, 0x51, 0x81, 0x82, 0x85,
-    0x8F, 0x91, 0x80, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0xFF, 0xDB,
-    0xFF, 0xE5, 0xFF, 0xF0, 0xFF, 0xFA, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51,
-    0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51,
-    0xC2, 0x03, 0x32, 0xD0, 0xD1, 0xFF, 0x4B, 0xFF, 0xCC, 0x41, 0x80, 0xD3, 0x0E, 0x42, 0xD0, 0xD1,
-    0xD6, 0x61, 0xFF, 0xFC, 0x41, 0xD0, 0xF4, 0xC8, 0x21, 0xBD, 0xFC, 0xC2, 0x00, 0xA1, 0xD0, 0xD1,
-    0xFF, 0xFD, 0xD3, 0xB0, 0x42, 0xBD, 0xBE, 0xD1, 0xF6, 0xD2, 0x18, 0x21, 0xD0, 0xF9, 0x41, 0x81,
-    0xD3, 0xFA, 0x43, 0x2E, 0xD0, 0xD1, 0xD3, 0xF6, 0xE1, 0x06, 0xFF, 0xFC, 0x41, 0xBB, 0xD3, 0x8C,
-    0x41, 0x80, 0xD2, 0x4F, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x4A, 0xB1, 0xB2, 0xB4, 0xB5, 0xB7, 0xB9,
-    0xBB, 0xBC, 0xBD, 0xBF, 0xFF, 0xC4, 0xD3, 0xDF, 0xFF, 0xD2, 0xD3, 0xDF, 0xFF, 0xE2, 0xD3, 0xDF,
-    0xFF, 0xE9, 0xD3, 0xDF, 0xD3, 0xDF, 0xFF, 0xFB, 0x41, 0x82, 0xDD, 0x89, 0x21, 0xD1, 0xFC, 0xC1,
-    0x05, 0x02, 0xD1, 0xD7, 0xFA, 0xC1, 0x02, 0xB1, 0xD1, 0xD4, 0xE8, 0x41, 0xD1, 0xFA, 0xBC, 0x47,
-    0x80, 0x81, 0x82, 0x85, 0x88, 0x8E, 0x91, 0xFF, 0xED, 0xFF, 0xF0, 0xFF, 0xF6, 0xD3, 0xA9, 0xFF,
-    0xFC, 0xD3, 0xA9, 0xD3, 0xA9, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xB4, 0xFF, 0xEA, 0xD1, 0x79, 0x42,
-    0x81, 0x88, 0xD1, 0xCE, 0xD1, 0xCE, 0x42, 0xD0, 0xD1, 0xDE, 0x5C, 0xFF, 0xF9, 0x41, 0xD0, 0xF4,
-    0xF1, 0x43, 0xB0, 0xB8, 0xBE, 0xFF, 0xF5, 0xD1, 0xA2, 0xFF, 0xFC, 0x41, 0x83, 0xD1, 0x98, 0x43,
-    0xD0, 0xD1, 0x2D, 0xFF, 0xF2, 0xFF, 0xFC, 0xD1, 0x4F, 0xC2, 0x03, 0x32, 0xD0, 0x2D, 0xD1, 0x99,
-    0xD1, 0x45, 0x43, 0xB0, 0xB3, 0xB4, 0xD2, 0x11, 0xD5, 0xA0, 0xD7, 0x48, 0x41, 0x82, 0xDC, 0xFE,
-    0x42, 0xD0, 0xD1, 0xDC, 0xF6, 0xFF, 0xFC, 0x21, 0x81, 0xF9, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D,
-    0xFF, 0xE8, 0xFF, 0xFD, 0xD1, 0x24, 0xC1, 0x01, 0x31, 0xD1, 0xEA, 0xD7, 0x43, 0xB2, 0xBE, 0xBF,
-    0xD3, 0x2C, 0xFF, 0xFA, 0xD5, 0x76, 0x42, 0x81, 0x82, 0xDD, 0x98, 0xD3, 0x22, 0x43, 0xD0, 0xD1,
-    0x2D, 0xFF, 0xEF, 0xFF, 0xF9, 0xD1, 0x01, 0xC2, 0x04, 0xC3, 0xD1, 0x2D, 0xD7, 0x3D, 0xD0, 0xF7,
-    0x41, 0x81, 0xD9, 0x69, 0x42, 0x2E, 0xD1, 0xD9, 0x55, 0xFF, 0xFC, 0xC1, 0x02, 0x21, 0x2E, 0xD0,
-    0xFE, 0x43, 0xBC, 0xBD, 0xBE, 0xFF, 0xFA, 0xD0, 0xF8, 0xD1, 0x22, 0x42, 0x2E, 0xD0, 0xD9, 0x3E,
-    0xFF, 0xF6, 0x43, 0xB2, 0xBA, 0xBD, 0xD9, 0x37, 0xD1, 0x2B, 0xD1, 0x2B, 0x42, 0x81, 0x8F, 0xD9,
-    0x2D, 0xD0, 0xDD, 0x43, 0x2E, 0xD0, 0xD1, 0xD9, 0x26, 0xFF, 0xEF, 0xFF, 0xF9, 0x42, 0xB7, 0xBC,
-    0xD1, 0x10, 0xD0, 0xCC, 0x42, 0x81, 0x82, 0xD9, 0x15, 0xD0, 0xB6, 0x43, 0x2E, 0xD0, 0xD1, 0xD9,
-    0x0E, 0xFF, 0xF2, 0xFF, 0xF9, 0x24, 0xB0, 0xB5, 0xB8, 0xBE, 0xAF, 0xC6, 0xDE, 0xF6, 0x41, 0xD0,
-    0xD5, 0xF0, 0xC1, 0x02, 0xB1, 0x2E, 0xD8, 0xF7, 0x41, 0x85, 0xD1, 0x5B, 0x43, 0x2E, 0xD0, 0xD1,
-    0xD1, 0x57, 0xE6, 0x18, 0xFF, 0xFC, 0x46, 0x83, 0x8B, 0x8C, 0x8E, 0x8F, 0x91, 0xFF, 0xE8, 0xD0,
-    0x93, 0xD1, 0x4D, 0xFF, 0xEC, 0xFF, 0xF6, 0xE0, 0xBE, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xCC, 0xFF,
-    0xED, 0xD0, 0x65, 0x41, 0xB6, 0xDD, 0x02, 0x21, 0xD0, 0xFC, 0x41, 0xBF, 0xD0, 0xB3, 0x21, 0xD0,
-    0xFC, 0x22, 0xB8, 0xBE, 0xF6, 0xFD, 0x21, 0x8F, 0xF1, 0xC3, 0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF,
-    0xF8, 0xFF, 0xFD, 0xD0, 0x45, 0x41, 0x80, 0xDC, 0xC3, 0x21, 0xD1, 0xFC, 0x41, 0xB0, 0xD7, 0x7E,
-    0xA1, 0x02, 0xB1, 0xD0, 0xFC, 0xC1, 0x02, 0xB1, 0xD1, 0xD1, 0xDC, 0x41, 0xD1, 0xFE, 0x43, 0x21,
-    0x8C, 0xFC, 0x21, 0xD1, 0xFD, 0x41, 0xD0, 0xF5, 0x3C, 0x21, 0xB8, 0xFC, 0x21, 0xD0, 0xFD, 0x48,
-    0xB1, 0xB2, 0xB4, 0xB7, 0xBB, 0xBC, 0xBD, 0xBF, 0xFF, 0xDA, 0xFF, 0xE1, 0xFF, 0xE6, 0xD2, 0x29,
-    0xFF, 0xF3, 0xFF, 0xFD, 0xDA, 0x27, 0xD9, 0x44, 0x41, 0xB2, 0xDD, 0x5B, 0x42, 0xD0, 0xD1, 0xFF,
-    0xFC, 0xD5, 0x62, 0x43, 0xBA, 0xBC, 0xBF, 0xD0, 0x19, 0xCF, 0xF7, 0xD0, 0x19, 0xA1, 0x02, 0xB1,
-    0xD0, 0xF6, 0xA0, 0x08, 0xF2, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0,
-    0xFD, 0x46, 0x80, 0x81, 0x82, 0x84, 0x85, 0x88, 0xFF, 0xDB, 0xFF, 0xEC, 0xDF, 0x5D, 0xD4, 0x72,
-    0xFF, 0xFD, 0xD1, 0xE7, 0xC3, 0x00, 0xA1, 0xD0, 0xD1, 0x2D, 0xFF, 0xAB, 0xFF, 0xED, 0xCF, 0xBA,
-    0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB6,
-    0xB9, 0xFE, 0x35, 0xD6, 0xE1, 0xFE, 0x5F, 0xD7, 0x70, 0xFE, 0x69, 0xFE, 0x8A, 0xD6, 0xE1, 0xFE,
-    0xAD, 0xFE, 0xB7, 0xFF, 0x49, 0xD7, 0x70, 0xFF, 0x69, 0xFF, 0xF4, 0xD7, 0x70, 0xD3, 0xBD, 0xD3,
-    0xBD, 0x42, 0xBB, 0xBE, 0xCF, 0xC2, 0xCF, 0xD9, 0x42, 0x81, 0x87, 0xF2, 0x68, 0xCF, 0xBB, 0x22,
-    0xD0, 0xD1, 0xF2, 0xF9, 0x44, 0xB1, 0xB4, 0xB7, 0xBE, 0xD1, 0x84, 0xCF, 0xAF, 0xCF, 0xC9, 0xE6,
-    0xA0, 0x42, 0x82, 0x85, 0xCF, 0xBC, 0xCF, 0xA2, 0x22, 0xD0, 0xD1, 0xEC, 0xF9, 0x45, 0xB0, 0xB1,
-    0xB5, 0xBA, 0xBE, 0xCF, 0x96, 0xCF, 0x96, 0xCF, 0xB0, 0xCF, 0x96, 0xCF, 0x96, 0x46, 0x80, 0x81,
-    0x84, 0x85, 0x8D, 0x91, 0xCF, 0x86, 0xCF, 0x86, 0xCF, 0x86, 0xCF, 0x86, 0xCF, 0x86, 0xCF, 0xA0,
-    0x22, 0xD0, 0xD1, 0xDD, 0xED, 0x23, 0xB5, 0xB8, 0xBE, 0xBA, 0xD3, 0xFB, 0x41, 0xB4, 0xCF, 0x67,
-    0x21, 0xD0, 0xFC, 0x42, 0x83, 0x8F, 0xEB, 0x80, 0xFF, 0xFD, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xCF,
-    0xE9, 0xFF, 0xEB, 0xFF, 0xF9, 0xCF, 0x14, 0x41, 0xB4, 0xE3, 0x31, 0x21, 0xD0, 0xFC, 0x21, 0xBD,
-    0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xD0, 0xDB, 0xE5, 0x43, 0xB8, 0xBB, 0xBE, 0xCF, 0x3B, 0xCF, 0x24,
-    0xCF, 0x3B, 0x21, 0xD0, 0xF6, 0x48, 0xB0, 0xB2, 0xB3, 0xB4, 0xB8, 0xBA, 0xBC, 0xBE, 0xFF, 0xEC,
-    0xE3, 0x4D, 0xCF, 0x31, 0xE3, 0x4D, 0xFF, 0xEF, 0xFF, 0xFD, 0xCF, 0x31, 0xCF, 0x04, 0x42, 0xBC,
-    0xBD, 0xCF, 0x15, 0xCF, 0x15, 0x21, 0xD0, 0xF9, 0x43, 0xB0, 0xB5, 0xBE, 0xFF, 0xFD, 0xCF, 0x0E,
-    0xCF, 0x0B, 0x42, 0x80, 0x83, 0xCE, 0xEA, 0xCF, 0x01, 0x22, 0xD0, 0xD1, 0xEF, 0xF9, 0x42, 0x82,
-    0x83, 0xFF, 0xFB, 0xCE, 0xCB, 0xC3, 0x02, 0x21, 0xD0, 0xD1, 0x2D, 0xFF, 0xC0, 0xFF, 0xF9, 0xCE,
-    0xA9, 0x42, 0x2E, 0xD1, 0xDB, 0x44, 0xEA, 0xFE, 0x42, 0xB0, 0xBE, 0xF9, 0x9B, 0xFF, 0xF9, 0xC3,
-    0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xF9, 0xD1, 0xF3, 0xCE, 0x8F, 0x41, 0x8F, 0xD0, 0x9D, 0x21,
-    0xD1, 0xFC, 0x42, 0xD0, 0xD1, 0xD2, 0xF7, 0xD0, 0x39, 0x46, 0xB2, 0xB5, 0xB9, 0xBB, 0xBC, 0xBF,
-    0xD3, 0xF9, 0xD5, 0xC1, 0xD0, 0x8F, 0xFF, 0xF6, 0xD5, 0xC1, 0xFF, 0xF9, 0xC1, 0x02, 0xB1, 0xD0,
-    0xCE, 0xAD, 0x42, 0xD0, 0xD1, 0xD8, 0xDD, 0xD4, 0xB7, 0xC1, 0x02, 0xB1, 0xD1, 0xD4, 0x64, 0x41,
-    0xD0, 0xDB, 0x64, 0x42, 0x82, 0x89, 0xD0, 0x65, 0xD5, 0x97, 0x21, 0xD1, 0xF9, 0x46, 0x80, 0x81,
-    0x82, 0x87, 0x8E, 0x91, 0xFF, 0xDF, 0xFF, 0xE5, 0xFF, 0xEC, 0xFF, 0xF2, 0xFF, 0xFD, 0xD5, 0x8D,
-    0xC3, 0x00, 0xA1, 0xD0, 0xD1, 0x2D, 0xFF, 0xB9, 0xFF, 0xED, 0xCE, 0x2E, 0xC1, 0x00, 0xA1, 0x2D,
-    0xCE, 0x22, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x8C, 0x8E, 0x91, 0x8A,
-    0x89, 0x8B, 0x8D, 0x8F, 0xFF, 0x08, 0xFF, 0x73, 0xFF, 0x8D, 0xFF, 0xEE, 0xD5, 0xDE, 0xE1, 0xE4,
-    0xD5, 0xDE, 0xD5, 0x4F, 0xD5, 0xDE, 0xD8, 0xDC, 0xFF, 0xFA, 0xD8, 0xDC, 0xD8, 0xF2, 0xD2, 0x2B,
-    0xD2, 0x2B, 0xD2, 0x2B, 0xD2, 0x2B, 0x42, 0xD0, 0xD1, 0xFE, 0x3A, 0xFF, 0xCC, 0x42, 0xB5, 0xBB,
-    0xCE, 0xB6, 0xCD, 0xD6, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xCF, 0x97, 0x41, 0xBE, 0xCE, 0xA8, 0x42,
-    0xD0, 0xD1, 0xFF, 0xFC, 0xD1, 0x33, 0x41, 0xD0, 0xD8, 0x45, 0x21, 0xB0, 0xFC, 0x21, 0xD0, 0xFD,
-    0xC1, 0x00, 0xA1, 0xD1, 0xD6, 0xE6, 0x41, 0xB8, 0xD9, 0x5F, 0x42, 0x2E, 0xD0, 0xCF, 0xCE, 0xFF,
-    0xFC, 0x49, 0xB1, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xBA, 0xBC, 0xBD, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF,
-    0xEC, 0xCF, 0xC7, 0xD8, 0xD3, 0xD2, 0xB5, 0xFF, 0xEF, 0xFF, 0xF9, 0xE6, 0xDE, 0x44, 0xB0, 0xB2,
-    0xB5, 0xBE, 0xCD, 0xBF, 0xD0, 0x1F, 0xCD, 0xBF, 0xCD, 0xBF, 0x44, 0x80, 0x83, 0x8F, 0x91, 0xD9,
-    0x50, 0xCD, 0xB2, 0xCD, 0xB2, 0xCD, 0xB2, 0x22, 0xD0, 0xD1, 0xE6, 0xF3, 0x21, 0x82, 0xFB, 0x21,
-    0xD1, 0xFD, 0xC1, 0x01, 0xF1, 0xD1, 0xD2, 0xA6, 0x46, 0x81, 0x82, 0x83, 0x84, 0x85, 0x8F, 0xFF,
-    0xF7, 0xD0, 0xB8, 0xFF, 0xFA, 0xD2, 0x0B, 0xDC, 0x5C, 0xCF, 0x80, 0x44, 0x2E, 0xD0, 0xD1, 0x2D,
-    0xCF, 0x6D, 0xFF, 0xA6, 0xFF, 0xED, 0xCD, 0x53, 0xC2, 0x02, 0x21, 0xD1, 0x2D, 0xD8, 0xAA, 0xCD,
-    0x46, 0x43, 0xB5, 0xB8, 0xBE, 0xCD, 0x82, 0xCD, 0x82, 0xCD, 0x82, 0x43, 0xD0, 0xD1, 0x2D, 0xFF,
-    0xF6, 0xFB, 0xE0, 0xCD, 0x33, 0x41, 0xBB, 0xD5, 0x65, 0x21, 0xD0, 0xFC, 0x43, 0xB0, 0xBB, 0xBE,
-    0xFF, 0xFD, 0xCD, 0x81, 0xCD, 0x7E, 0x42, 0xD0, 0x2D, 0xFF, 0xF6, 0xCD, 0x18, 0x41, 0xB0, 0xCD,
-    0x6D, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x42, 0xD0, 0xD1, 0xD0, 0xF8, 0xFF, 0xFD, 0x41, 0xD0,
-    0xFB, 0x2E, 0x42, 0xB6, 0xBE, 0xCD, 0x2A, 0xCD, 0x44, 0x21, 0xD0, 0xF9, 0xA0, 0x09, 0x13, 0x21,
-    0xBE, 0xFD, 0x42, 0xD0, 0xD1, 0xFF, 0xFD, 0xCE, 0x9F, 0x41, 0xBD, 0xEB, 0x31, 0x42, 0xD0, 0xD1,
-    0xFF, 0xFC, 0xEF, 0x3C, 0x48, 0xB2, 0xB3, 0xB4, 0xB7, 0xBA, 0xBC, 0xBD, 0xBE, 0xFF, 0xD3, 0xFF,
-    0xDA, 0xFF, 0xE5, 0xFF, 0xEE, 0xD1, 0x59, 0xFC, 0xC1, 0xCE, 0xF4, 0xFF, 0xF9, 0x41, 0xB0, 0xD7,
-    0x18, 0xA1, 0x01, 0xB1, 0xD0, 0xFC, 0x44, 0xB1, 0xBA, 0xBB, 0xBF, 0xCC, 0xAD, 0xFF, 0xFB, 0xD0,
-    0x04, 0xD2, 0x3C, 0x21, 0xD0, 0xF3, 0x42, 0xD0, 0xD1, 0xDA, 0x27, 0xCF, 0xF7, 0x43, 0x81, 0x82,
-    0x85, 0xFF, 0xF6, 0xFF, 0xF9, 0xFC, 0x78, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xCE, 0xB1, 0xFF, 0xBD,
-    0xFF, 0xF6, 0xCC, 0x97, 0x41, 0xBE, 0xCC, 0xCF, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xCC, 0x86, 0x41,
-    0xBE, 0xD3, 0xCB, 0x41, 0x8B, 0xD3, 0xC7, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x42, 0xD0, 0xD1, 0xEF,
-    0x60, 0xE9, 0x2B, 0x41, 0xBF, 0xCD, 0x40, 0x21, 0xD0, 0xFC, 0x48, 0xB0, 0xB2, 0xB3, 0xB5, 0xBA,
-    0xBC, 0xBE, 0xBF, 0xE4, 0xD8, 0xFF, 0xED, 0xFF, 0xF2, 0xD8, 0x47, 0xD3, 0x4F, 0xFF, 0xFD, 0xE8,
-    0xC9, 0xD0, 0xC8, 0x42, 0xBC, 0xBF, 0xCC, 0x57, 0xD5, 0xD0, 0x21, 0xD0, 0xF9, 0x42, 0xB2, 0xBB,
-    0xD9, 0xA6, 0xCC, 0x6F, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xCD, 0xED, 0x44, 0x81, 0x82, 0x83, 0x85,
-    0xFF, 0xEF, 0xD3, 0x1E, 0xF0, 0x83, 0xFF, 0xF9, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xC2,
-    0xFF, 0xF3, 0xCC, 0x26, 0x42, 0xB2, 0xBB, 0xCC, 0x0F, 0xCD, 0x33, 0xC2, 0x03, 0x32, 0xD0, 0x2D,
-    0xFF, 0xF9, 0xCC, 0x13, 0x42, 0x8C, 0x8E, 0xCC, 0x69, 0xCC, 0x66, 0xC2, 0x03, 0x32, 0xD1, 0x2D,
-    0xFF, 0xF9, 0xCC, 0x03, 0x41, 0xB8, 0xDB, 0x56, 0xC2, 0x03, 0x32, 0xD0, 0x2D, 0xFF, 0xFC, 0xCB,
-    0xF6, 0x42, 0xD0, 0xD1, 0xD0, 0x4D, 0xCF, 0x3C, 0x41, 0xD1, 0xEF, 0x68, 0x41, 0xB4, 0xD3, 0x2E,
-    0x21, 0xD0, 0xFC, 0x43, 0xB8, 0xBB, 0xBE, 0xFF, 0xF5, 0xCB, 0xD0, 0xFF, 0xFD, 0x21, 0xD0, 0xF6,
-    0x42, 0xB4, 0xBE, 0xD9, 0x33, 0xE5, 0x91, 0x21, 0xD0, 0xF9, 0x41, 0xD0, 0xD9, 0x43, 0x41, 0x83,
-    0xD7, 0xFE, 0x21, 0xD1, 0xFC, 0x41, 0xB0, 0xCB, 0xC5, 0xA1, 0x01, 0xB1, 0xD0, 0xFC, 0x22, 0xB0,
-    0xBB, 0xF4, 0xFB, 0x21, 0xD0, 0xFB, 0x41, 0xB0, 0xD5, 0xC0, 0x21, 0xD0, 0xFC, 0x48, 0xB1, 0xB2,
-    0xB3, 0xB4, 0xB5, 0xB7, 0xBA, 0xBF, 0xFF, 0xB4, 0xFF, 0xD0, 0xFF, 0xDA, 0xCD, 0x58, 0xFB, 0x88,
-    0xFF, 0xDD, 0xFF, 0xF6, 0xFF, 0xFD, 0x42, 0xB2, 0xB3, 0xCB, 0x7D, 0xD5, 0x0D, 0x42, 0xD0, 0xD1,
-    0xFF, 0xF9, 0xD0, 0xF1, 0x42, 0xBA, 0xBF, 0xCB, 0xD6, 0xCE, 0xC6, 0x21, 0xD0, 0xF9, 0x42, 0xD0,
-    0xD1, 0xD7, 0x31, 0xD4, 0x98, 0x45, 0x80, 0x81, 0x82, 0x88, 0x91, 0xFF, 0xE8, 0xFF, 0xF6, 0xFF,
-    0xF9, 0xCF, 0xCD, 0xFB, 0x50, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xB8, 0xFF, 0xF0, 0xCB,
-    0x59, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
-    0xB6, 0xB9, 0xFD, 0xFA, 0xFE, 0x07, 0xFE, 0x1A, 0xFE, 0x35, 0xE0, 0x5F, 0xFE, 0xB6, 0xFE, 0xC7,
-    0xFF, 0x27, 0xFF, 0x3A, 0xFF, 0x4A, 0xD3, 0x0F, 0xFF, 0x57, 0xFF, 0xF4, 0xD3, 0x0F, 0xCF, 0x5C,
-    0xCF, 0x5C, 0x41, 0xB1, 0xCB, 0x64, 0xC2, 0x04, 0xC3, 0xD0, 0x2D, 0xFF, 0xFC, 0xCB, 0x18, 0xA0,
-    0x09, 0x42, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xBE, 0xD3, 0xE2, 0x21, 0xD0, 0xFC, 0x21,
-    0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x4A, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xBA, 0xBD, 0xBE, 0xBF,
-    0xCC, 0xB0, 0xCB, 0x27, 0xCB, 0x41, 0xFF, 0xF0, 0xCD, 0x13, 0xE4, 0x55, 0xCC, 0xB0, 0xCD, 0x13,
-    0xCC, 0x09, 0xFF, 0xFD, 0xA0, 0x0C, 0x02, 0x21, 0xBD, 0xFD, 0xA1, 0x01, 0x31, 0xD0, 0xFD, 0x41,
-    0xD1, 0xD0, 0xDE, 0x44, 0x81, 0x82, 0x8E, 0x91, 0xFF, 0xF7, 0xFF, 0xFC, 0xCC, 0xE5, 0xCC, 0xE5,
-    0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xCC, 0xD8, 0xFF, 0xC5, 0xFF, 0xF3, 0xCA, 0xBE, 0xC2, 0x04, 0xC3,
-    0xD0, 0x2D, 0xF7, 0xBE, 0xCA, 0xB1, 0x44, 0xB5, 0xB6, 0xB9, 0xBC, 0xCC, 0xC2, 0xCC, 0xC2, 0xCC,
-    0xC2, 0xCC, 0xC2, 0x41, 0x85, 0xD6, 0x42, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xCC, 0xB1, 0xFF, 0xEF,
-    0xFF, 0xFC, 0xCA, 0x97, 0x47, 0xB4, 0xB5, 0xB8, 0xBA, 0xBC, 0xBD, 0xBE, 0xCB, 0x5F, 0xD1, 0xD6,
-    0xD1, 0xD6, 0xCB, 0x5F, 0xCB, 0x5F, 0xCB, 0x5F, 0xD1, 0xD6, 0x42, 0xD0, 0xD1, 0xF4, 0x79, 0xFB,
-    0xF1, 0x21, 0x82, 0xF9, 0x42, 0xD0, 0xD1, 0xCC, 0xDB, 0xFF, 0xFD, 0x42, 0xB0, 0xB5, 0xCC, 0x7D,
-    0xCC, 0x7D, 0x42, 0x83, 0x91, 0xCC, 0x76, 0xCC, 0x76, 0x22, 0xD0, 0xD1, 0xF2, 0xF9, 0x48, 0x81,
-    0x82, 0x86, 0x87, 0x89, 0x8E, 0x8F, 0x91, 0xFF, 0xE6, 0xCB, 0x25, 0xCB, 0x25, 0xCB, 0x25, 0xFF,
-    0xFB, 0xD1, 0x9C, 0xD1, 0x9C, 0xD1, 0x9C, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xEB, 0x65, 0xFF, 0xAD,
-    0xFF, 0xE7, 0xCA, 0x37, 0x41, 0xB6, 0xCC, 0x44, 0x42, 0x81, 0x82, 0xDD, 0xC0, 0xCA, 0xA0, 0xC4,
-    0x00, 0xA1, 0x2E, 0xD0, 0xD1, 0x2D, 0xCC, 0x39, 0xFF, 0xF5, 0xFF, 0xF9, 0xCA, 0x1F, 0x42, 0xB8,
-    0xBE, 0xCA, 0x3E, 0xD1, 0x5C, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xFD, 0x8E, 0x43, 0xB2, 0xB4, 0xBC,
-    0xFF, 0xF9, 0xCA, 0xD7, 0xD1, 0x4E, 0x42, 0x80, 0x85, 0xEA, 0x67, 0xD1, 0x44, 0xC4, 0x02, 0xB1,
-    0x2E, 0xD0, 0xD1, 0x2D, 0xD1, 0x3D, 0xFF, 0xEF, 0xFF, 0xF9, 0xC9, 0xF1, 0x41, 0xD0, 0xFC, 0xF3,
-    0x44, 0xB4, 0xB7, 0xBA, 0xBD, 0xCA, 0x2C, 0xFF, 0xFC, 0xCE, 0x5D, 0xCB, 0xF8, 0x41, 0xBA, 0xFD,
-    0x14, 0x21, 0xD0, 0xFC, 0x42, 0x81, 0x85, 0xFF, 0xFD, 0xCB, 0xE4, 0x43, 0xD0, 0xD1, 0x2D, 0xFF,
-    0xE5, 0xFF, 0xF9, 0xC9, 0xC3, 0x51, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x8B, 0x8C, 0x8E,
-    0x8F, 0x91, 0x8A, 0x80, 0x88, 0x89, 0x8D, 0xFE, 0xA1, 0xD0, 0x5F, 0xFE, 0xFB, 0xDE, 0xCB, 0xFF,
-    0x08, 0xD1, 0x7B, 0xD0, 0x5F, 0xFF, 0x22, 0xFF, 0x82, 0xFF, 0x9A, 0xFF, 0xC8, 0xFF, 0xF6, 0xD4,
-    0x8F, 0xCD, 0xC8, 0xCD, 0xC8, 0xCD, 0xC8, 0xCD, 0xC8, 0x42, 0xD0, 0xD1, 0xFE, 0x38, 0xFF, 0xCC,
-    0x41, 0xD0, 0xEA, 0x27, 0xC1, 0x03, 0x91, 0xD0, 0xCE, 0x75, 0x42, 0x80, 0x8C, 0xC9, 0x69, 0xC9,
-    0x69, 0x21, 0xD1, 0xF9, 0x41, 0xBB, 0xD2, 0xEF, 0x21, 0xD0, 0xFC, 0x47, 0xB2, 0xB3, 0xB4, 0xB7,
-    0xBA, 0xBB, 0xBD, 0xFF, 0xE5, 0xFF, 0xE9, 0xFF, 0xF6, 0xCE, 0x6B, 0xD0, 0x51, 0xFF, 0xFD, 0xE2,
-    0x94, 0x41, 0xBB, 0xC9, 0x59, 0x41, 0x82, 0xFE, 0x3A, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x41, 0xBE,
-    0xDF, 0x2D, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xCA, 0xF9, 0xC1, 0x03, 0x91, 0xD1, 0xCC, 0x0E, 0x45,
-    0x81, 0x82, 0x83, 0x84, 0x87, 0xFF, 0xEA, 0xFF, 0xF3, 0xC9, 0x24, 0xC9, 0x80, 0xFF, 0xFA, 0x43,
-    0xD0, 0xD1, 0x2D, 0xFF, 0xBC, 0xFF, 0xF0, 0xC9, 0x1F, 0xC1, 0x01, 0xB1, 0xD1, 0xD7, 0xBE, 0x42,
-    0xB8, 0xBB, 0xC9, 0x2A, 0xFF, 0xFA, 0xC2, 0x09, 0x62, 0xD0, 0x2D, 0xFF, 0xF9, 0xC9, 0x08, 0x41,
-    0xBB, 0xD5, 0xA6, 0xC2, 0x05, 0x22, 0xD0, 0x2D, 0xFF, 0xFC, 0xC8, 0xFB, 0x41, 0xBD, 0xCB, 0xDD,
-    0x21, 0xD0, 0xFC, 0x42, 0xB3, 0xBB, 0xC8, 0xE0, 0xC8, 0xE0, 0x21, 0xD0, 0xF9, 0x41, 0xB0, 0xF7,
-    0x4E, 0x21, 0xD0, 0xFC, 0x41, 0xBD, 0xEF, 0x91, 0x21, 0xD0, 0xFC, 0x41, 0xBC, 0xD5, 0x11, 0x21,
-    0xD0, 0xFC, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0xB8, 0xBE, 0xF0, 0xFD, 0x21, 0xD0, 0xFB,
-    0x45, 0xB0, 0xB5, 0xB6, 0xB7, 0xB4, 0xFF, 0xD0, 0xFF, 0xDA, 0xFF, 0xE1, 0xCD, 0xC6, 0xFF, 0xFD,
-    0x41, 0x80, 0xD4, 0x7A, 0x21, 0xD1, 0xFC, 0x21, 0x82, 0xFD, 0x42, 0xD0, 0xD1, 0xD4, 0x6C, 0xFF,
-    0xFD, 0x41, 0xBC, 0xF3, 0xD7, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBB,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x43, 0x81, 0x87, 0x82, 0xFF, 0xE0,
-    0xE0, 0xC0, 0xFF, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xBC, 0xFF, 0xF6, 0xC8, 0x7A, 0x41, 0xD1,
-    0xF6, 0xA2, 0x43, 0xB2, 0xB4, 0xBD, 0xC8, 0x9A, 0xC9, 0x41, 0xC8, 0x9A, 0x21, 0xD0, 0xF6, 0x41,
-    0xB8, 0xC8, 0xBB, 0xA1, 0x01, 0xB1, 0xD0, 0xFC, 0x21, 0x80, 0xFB, 0x21, 0xD1, 0xFD, 0x42, 0xB7,
-    0xBF, 0xC8, 0x45, 0xC8, 0x84, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xCB, 0xAD, 0x24, 0xB3, 0xB7, 0xBA,
-    0xBE, 0xD2, 0xE0, 0xEF, 0xF9, 0x41, 0x81, 0xDA, 0x84, 0x42, 0xD0, 0xD1, 0xDC, 0x03, 0xFF, 0xFC,
-    0x21, 0x81, 0xF9, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE9, 0xFF, 0xFD, 0xC8, 0x2B, 0xC2, 0x04, 0xC3,
-    0xD0, 0x2D, 0xDD, 0x39, 0xC8, 0x21, 0x42, 0xB5, 0xBB, 0xC8, 0x77, 0xC8, 0x77, 0x21, 0xD0, 0xF9,
-    0x21, 0xB5, 0xFD, 0xC2, 0x03, 0x32, 0xD0, 0x2D, 0xFF, 0xFD, 0xC8, 0x0B, 0x41, 0xB4, 0xC8, 0x5E,
-    0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xDD, 0x3E, 0x44, 0xB5, 0xB6, 0xB9, 0xBC, 0xE9, 0x25, 0xC8, 0x56,
-    0xE9, 0x25, 0xE9, 0x25, 0x42, 0x80, 0x8E, 0xC8, 0x49, 0xE9, 0x18, 0x22, 0xD0, 0xD1, 0xEC, 0xF9,
-    0x43, 0xB0, 0xB5, 0xBE, 0xD5, 0x07, 0xFF, 0xE0, 0xFF, 0xFB, 0x43, 0x83, 0x8B, 0x91, 0xCA, 0xA4,
-    0xD4, 0xFD, 0xDD, 0x18, 0xC3, 0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xF6, 0xC7, 0xCA,
-    0xC1, 0x03, 0x91, 0xD1, 0xC9, 0x71, 0x42, 0xD0, 0xD1, 0xD5, 0x37, 0xC9, 0x6B, 0x41, 0xD1, 0xCA,
-    0x42, 0x21, 0x81, 0xFC, 0x21, 0xD1, 0xFD, 0x41, 0xD0, 0xF7, 0xB1, 0x4A, 0xB1, 0xB2, 0xB4, 0xB6,
-    0xB7, 0xB8, 0xBA, 0xBC, 0xBD, 0xBF, 0xCA, 0xEF, 0xDB, 0xB0, 0xFF, 0xE5, 0xD5, 0x33, 0xFF, 0xEB,
-    0xFF, 0xF9, 0xFF, 0xFC, 0xD0, 0x7F, 0xCE, 0xEF, 0xCE, 0xEF, 0x44, 0xBA, 0xBC, 0xBD, 0xBF, 0xFA,
-    0x77, 0xC7, 0xB2, 0xC7, 0xB2, 0xCA, 0xD0, 0x21, 0xD0, 0xF3, 0x41, 0xB8, 0xCE, 0xC0, 0x42, 0xD0,
-    0xD1, 0xFF, 0xFC, 0xC9, 0x2D, 0x44, 0x80, 0x81, 0x82, 0x84, 0xD0, 0x77, 0xFF, 0xF2, 0xFF, 0xF9,
-    0xCE, 0xB5, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xB9, 0xFF, 0xF3, 0xC7, 0x5C, 0xC2, 0x02, 0x21, 0xD0,
-    0x2D, 0xCB, 0xB2, 0xC7, 0x52, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xBA,
-    0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB9, 0xFE, 0x2A, 0xFE, 0x41, 0xDC, 0x5B, 0xFE, 0x4E, 0xCE, 0x7C,
-    0xFE, 0xCF, 0xCF, 0x0B, 0xDB, 0x11, 0xFF, 0x1E, 0xFF, 0x28, 0xFF, 0x3E, 0xCF, 0x0B, 0xFF, 0x7F,
-    0xFF, 0xED, 0xFF, 0xF7, 0xCB, 0x58, 0x43, 0xB0, 0xB8, 0xBE, 0xED, 0xC5, 0xC7, 0xED, 0xD0, 0x9D,
-    0x41, 0x8B, 0xC7, 0x53, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF2, 0xFF, 0xFC, 0xC7, 0x0A, 0x41, 0xD1,
-    0xEE, 0xE7, 0x43, 0xBA, 0xBD, 0xBE, 0xC6, 0xF1, 0xC6, 0xF1, 0xFF, 0xFC, 0x41, 0xB8, 0xD3, 0x99,
-    0x21, 0xD0, 0xFC, 0x21, 0x82, 0xFD, 0xC3, 0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xFD,
-    0xC6, 0xE8, 0x42, 0xBA, 0xBB, 0xCA, 0x28, 0xFB, 0xCD, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xCD, 0x30,
-    0x42, 0x80, 0x8C, 0xC7, 0x2A, 0xC7, 0x16, 0x21, 0xD1, 0xF9, 0x22, 0x81, 0x82, 0xEF, 0xFD, 0x42,
-    0xD1, 0x2D, 0xFF, 0xFB, 0xC6, 0xBF, 0x41, 0xB8, 0xC6, 0xC4, 0xC2, 0x02, 0x21, 0xD0, 0x2D, 0xFF,
-    0xFC, 0xC6, 0xB4, 0x42, 0xB2, 0xBB, 0xC7, 0x0A, 0xC7, 0x0A, 0x21, 0xD0, 0xF9, 0x42, 0x82, 0x88,
-    0xC7, 0x00, 0xC7, 0x00, 0x21, 0xD1, 0xF9, 0x22, 0xB0, 0xB8, 0xF3, 0xFD, 0x42, 0xD0, 0x2D, 0xFF,
-    0xFB, 0xC6, 0x92, 0x41, 0xB5, 0xD3, 0x32, 0x41, 0x91, 0xD3, 0x2E, 0xC3, 0x02, 0x21, 0xD0, 0xD1,
-    0x2D, 0xFF, 0xF8, 0xFF, 0xFC, 0xC6, 0x83, 0x41, 0xBC, 0xC9, 0xDF, 0x43, 0xD0, 0xD1, 0x2D, 0xFF,
-    0xFC, 0xCB, 0xAD, 0xC6, 0x73, 0x42, 0x81, 0x8E, 0xC7, 0x3E, 0xC6, 0xC5, 0x43, 0x2E, 0xD1, 0x2D,
-    0xC7, 0x37, 0xFF, 0xF9, 0xC6, 0x62, 0xC2, 0x02, 0x21, 0xD1, 0x2D, 0xC8, 0x0B, 0xC6, 0x58, 0x42,
-    0x80, 0x81, 0xC6, 0x7D, 0xE4, 0x9B, 0x42, 0xD1, 0x2D, 0xFF, 0xF9, 0xC6, 0x48, 0x51, 0x80, 0x81,
-    0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x8A, 0x91, 0xFF,
-    0x37, 0xFF, 0x59, 0xCD, 0x74, 0xFF, 0x82, 0xFF, 0x8D, 0xCD, 0x74, 0xCE, 0x03, 0xFF, 0xAF, 0xD1,
-    0xB3, 0xFF, 0xBE, 0xFF, 0xCE, 0xFF, 0xDF, 0xFF, 0xE9, 0xF8, 0x1F, 0xFF, 0xF9, 0xD1, 0x17, 0xCA,
-    0x50, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xFE, 0xC4, 0xFF, 0xCC, 0x41, 0xB8, 0xD6, 0x60, 0x42, 0xD0,
-    0xD1, 0xFF, 0xFC, 0xCF, 0x28, 0x41, 0xB4, 0xC6, 0x41, 0x21, 0xD0, 0xFC, 0x41, 0x81, 0xD2, 0x30,
-    0x42, 0xD0, 0xD1, 0xCD, 0x3D, 0xFF, 0xFC, 0x41, 0xBA, 0xE7, 0x15, 0x21, 0xD0, 0xFC, 0x41, 0xBD,
-    0xCE, 0xBC, 0x21, 0xD0, 0xFC, 0x49, 0xB1, 0xB2, 0xB3, 0xB6, 0xB7, 0xB8, 0xBA, 0xBC, 0xBF, 0xFF,
-    0xD9, 0xC9, 0x2B, 0xD2, 0x3A, 0xFF, 0xE4, 0xC9, 0x25, 0xFF, 0xEB, 0xFF, 0xF6, 0xFF, 0xFD, 0xE8,
-    0xCB, 0xC1, 0x01, 0x31, 0xD1, 0xCA, 0x01, 0x42, 0xB0, 0xB8, 0xFF, 0xFA, 0xC9, 0x03, 0x21, 0xD0,
-    0xF9, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x80, 0xDB, 0x9D, 0x21, 0xD1, 0xFC, 0x4A, 0x80,
-    0x81, 0x82, 0x84, 0x85, 0x87, 0x88, 0x89, 0x8D, 0x8F, 0xFF, 0xF6, 0xC8, 0xEC, 0xF8, 0xF8, 0xFF,
-    0xFD, 0xC8, 0xEC, 0xC6, 0x75, 0xD5, 0x12, 0xC6, 0x75, 0xCB, 0xAC, 0xCC, 0xEC, 0xC3, 0x02, 0xB1,
-    0xD0, 0xD1, 0x2D, 0xFF, 0xA8, 0xFF, 0xE1, 0xC5, 0x81, 0x44, 0xB2, 0xB8, 0xBB, 0xBE, 0xC6, 0x8E,
-    0xE2, 0x1E, 0xCF, 0xCC, 0xE1, 0xDA, 0xC3, 0x02, 0x21, 0xD0, 0xD1, 0x2D, 0xFF, 0xF3, 0xC8, 0xCC,
-    0xC5, 0x68, 0x41, 0xD0, 0xD2, 0x50, 0x41, 0xB7, 0xC5, 0x64, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xDE,
-    0xA2, 0x46, 0xB0, 0xB2, 0xB5, 0xB6, 0xB7, 0xBB, 0xFF, 0xF1, 0xC6, 0x66, 0xFF, 0xF9, 0xC5, 0x42,
-    0xC5, 0xD1, 0xC5, 0xAC, 0x41, 0xD0, 0xEA, 0x51, 0x43, 0xB0, 0xB5, 0xB8, 0xFF, 0xFC, 0xC5, 0x2B,
-    0xC8, 0x76, 0x42, 0x8F, 0x91, 0xC5, 0x8B, 0xC5, 0x21, 0x22, 0xD0, 0xD1, 0xEF, 0xF9, 0x41, 0xD0,
-    0xC5, 0x18, 0x43, 0x80, 0x81, 0x86, 0xFF, 0xF7, 0xFF, 0xFC, 0xC5, 0x7B, 0xC3, 0x03, 0x32, 0xD0,
-    0xD1, 0x2D, 0xFF, 0xC5, 0xFF, 0xF6, 0xC5, 0x12, 0x41, 0x8F, 0xC5, 0x4E, 0xA1, 0x02, 0x21, 0xD1,
-    0xFC, 0x42, 0xB4, 0xBD, 0xC8, 0x49, 0xFF, 0xFB, 0x21, 0xD0, 0xF9, 0x42, 0xBB, 0xBE, 0xC8, 0x3F,
-    0xC5, 0x44, 0x42, 0xB0, 0xBE, 0xC4, 0xE1, 0xC5, 0x1A, 0x21, 0xD0, 0xF9, 0x42, 0x80, 0x83, 0xFF,
-    0xFD, 0xC5, 0x2A, 0xA2, 0x03, 0x91, 0xD0, 0xD1, 0xE8, 0xF9, 0xC1, 0x01, 0xD1, 0xD0, 0xC5, 0xE0,
-    0x44, 0xB2, 0xBB, 0xBD, 0xBE, 0xC4, 0xFC, 0xC8, 0x1A, 0xC4, 0xFC, 0xC4, 0xFC, 0x42, 0xD0, 0xD1,
-    0xFF, 0xF3, 0xC6, 0x74, 0x42, 0xB4, 0xBB, 0xC7, 0xFA, 0xC4, 0xAF, 0x41, 0xB5, 0xD2, 0x18, 0x21,
-    0xD0, 0xFC, 0x21, 0x80, 0xFD, 0xA2, 0x09, 0x83, 0xD0, 0xD1, 0xEF, 0xFD, 0x4C, 0xB1, 0xB2, 0xB3,
-    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xBA, 0xBC, 0xBE, 0xBF, 0xC7, 0xEE, 0xFF, 0xAC, 0xC4, 0xF3, 0xFF,
-    0xC7, 0xFF, 0xCE, 0xCF, 0xC8, 0xFF, 0xE1, 0xC4, 0xF3, 0xE6, 0x25, 0xFE, 0xC6, 0xFF, 0xF9, 0xCD,
-    0x7E, 0x42, 0xB6, 0xBE, 0xC7, 0xC9, 0xF2, 0xEA, 0x21, 0xD0, 0xF9, 0x43, 0xBA, 0xBD, 0xBF, 0xC4,
-    0xC4, 0xCD, 0x4F, 0xC7, 0xBF, 0x43, 0x82, 0x85, 0x87, 0xC7, 0x54, 0xC7, 0xB5, 0xC7, 0xB5, 0x22,
-    0xD0, 0xD1, 0xEC, 0xF6, 0x42, 0xB2, 0xBB, 0xC7, 0xA6, 0xCD, 0x36, 0x42, 0xD0, 0xD1, 0xFF, 0xF9,
-    0xC7, 0xA2, 0x49, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x88, 0x8F, 0x91, 0xFF, 0xD6, 0xFF, 0xED,
-    0xFF, 0xF9, 0xCB, 0x98, 0xC8, 0xF1, 0xC6, 0x03, 0xE3, 0x2F, 0xC4, 0x9D, 0xC4, 0x94, 0xC4, 0x02,
-    0xB1, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF, 0x8E, 0xFF, 0xE4, 0xCF, 0x03, 0xC4, 0x30, 0x41, 0xBE, 0xE0,
-    0x86, 0xC2, 0x04, 0xC3, 0xD0, 0x2D, 0xFF, 0xFC, 0xC4, 0x1D, 0x42, 0xBB, 0xBC, 0xC5, 0xCE, 0xC5,
-    0xCE, 0xA1, 0x02, 0xD1, 0xD0, 0xF9, 0x21, 0xB0, 0xFB, 0x21, 0xD0, 0xFD, 0x41, 0x82, 0xCD, 0x87,
-    0x42, 0xD0, 0xD1, 0xF7, 0x93, 0xFF, 0xFC, 0x21, 0x81, 0xF9, 0x21, 0xD1, 0xFD, 0x46, 0xB1, 0xB5,
-    0xB9, 0xBA, 0xBB, 0xBD, 0xCC, 0xCD, 0xD7, 0x23, 0xCB, 0x3D, 0xC8, 0x55, 0xFF, 0xEC, 0xFF, 0xFD,
-    0x41, 0xD0, 0xD7, 0xAC, 0x21, 0xBE, 0xFC, 0x21, 0xD0, 0xFD, 0x43, 0xBB, 0xBF, 0xBA, 0xC4, 0x02,
-    0xC3, 0xE0, 0xFF, 0xFD, 0x41, 0x2E, 0xCE, 0x21, 0x42, 0x82, 0x8C, 0xD5, 0x21, 0xFF, 0xFC, 0x22,
-    0xD0, 0xD1, 0xEB, 0xF9, 0x45, 0x81, 0x83, 0x85, 0x86, 0x89, 0xFF, 0xFB, 0xC3, 0xC6, 0xC3, 0xE8,
-    0xCB, 0x06, 0xCB, 0x06, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xB9, 0xFF, 0xF0, 0xC3, 0xAA,
-    0x42, 0xB1, 0xBF, 0xC6, 0x89, 0xC7, 0x77, 0x21, 0xD0, 0xF9, 0x43, 0xB2, 0xBB, 0xBE, 0xC3, 0x89,
-    0xC3, 0x89, 0xFF, 0xFD, 0x41, 0xBE, 0xC4, 0xA3, 0x21, 0xD0, 0xFC, 0x42, 0x80, 0x81, 0xFF, 0xFD,
-    0xC3, 0xB1, 0xC3, 0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xE8, 0xFF, 0xF9, 0xC3, 0x7C, 0x41, 0xD0,
-    0xE7, 0xE0, 0x21, 0xBE, 0xFC, 0xC2, 0x03, 0x32, 0xD0, 0x2D, 0xFF, 0xFD, 0xC3, 0x69, 0xC1, 0x01,
-    0xE1, 0xD1, 0xC5, 0x13, 0x43, 0xB2, 0xB4, 0xBE, 0xC3, 0x88, 0xC3, 0x4F, 0xCC, 0x36, 0x42, 0xD0,
-    0xD1, 0xFF, 0xF6, 0xC5, 0x03, 0x42, 0x88, 0x91, 0xC3, 0x55, 0xCA, 0x95, 0x42, 0xD0, 0xD1, 0xD7,
-    0x3E, 0xFF, 0xF9, 0xA0, 0x0C, 0x23, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB8, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x48, 0xB1,
-    0xB2, 0xB4, 0xB5, 0xB7, 0xBA, 0xBC, 0xBB, 0xFF, 0xC0, 0xC7, 0x84, 0xFB, 0x68, 0xC7, 0xC5, 0xFF,
-    0xD0, 0xD2, 0x75, 0xFF, 0xDE, 0xFF, 0xFD, 0x42, 0xD0, 0xD1, 0xC9, 0xEE, 0xC8, 0x77, 0x43, 0xBA,
-    0xBB, 0xBF, 0xC6, 0xF5, 0xC4, 0x09, 0xC6, 0x4C, 0x41, 0x87, 0xC2, 0xEB, 0x22, 0xD0, 0xD1, 0xF2,
-    0xFC, 0x45, 0x80, 0x81, 0x82, 0x84, 0x8D, 0xFF, 0xE6, 0xFF, 0xFB, 0xCE, 0xB2, 0xCB, 0xC9, 0xC3,
-    0x3E, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xBD, 0xFF, 0xF0, 0xC2, 0xDD, 0x50, 0xB0, 0xB1,
-    0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xBA, 0xBB, 0xBD, 0xBE, 0xBF, 0xB6, 0xB9, 0xBC, 0xFD, 0x50,
-    0xD6, 0x99, 0xCA, 0x04, 0xFD, 0x69, 0xFD, 0xBF, 0xFE, 0xA1, 0xFE, 0xB4, 0xFF, 0x27, 0xFF, 0x55,
-    0xC9, 0x77, 0xFF, 0x68, 0xFF, 0xF4, 0xE6, 0xF9, 0xC6, 0xE0, 0xC6, 0xE0, 0xC6, 0xE0, 0x43, 0xB5,
-    0xB8, 0xBE, 0xCC, 0x25, 0xCC, 0x25, 0xC2, 0xE5, 0x42, 0xD0, 0x2D, 0xFF, 0xF6, 0xC2, 0x96, 0x42,
-    0xB5, 0xBE, 0xC2, 0x84, 0xC3, 0xDE, 0x21, 0xD0, 0xF9, 0xC1, 0x00, 0xA1, 0xD0, 0xC2, 0xA3, 0x41,
-    0xBA, 0xC3, 0x98, 0x21, 0xD0, 0xFC, 0x48, 0xB2, 0xB3, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xD6,
-    0xDC, 0xC2, 0xD7, 0xFF, 0xF0, 0xFF, 0xF3, 0xD6, 0xDC, 0xC2, 0xD7, 0xFF, 0xFD, 0xC3, 0x02, 0xA0,
-    0x04, 0x72, 0x44, 0x82, 0x83, 0x84, 0x8A, 0xCB, 0x91, 0xCB, 0x91, 0xD6, 0xC0, 0xFF, 0xFD, 0xC3,
-    0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xD7, 0xFF, 0xF3, 0xC2, 0x4F, 0x41, 0xBA, 0xC2, 0xE9, 0x21,
-    0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x43, 0xB2, 0xB8, 0xBC, 0xC3, 0x4F, 0xFF, 0xFD,
-    0xC2, 0x95, 0xA0, 0x03, 0x03, 0x42, 0xB3, 0xB6, 0xFF, 0xFD, 0xC2, 0x85, 0xC1, 0x06, 0x71, 0xD1,
-    0xCF, 0x4E, 0x42, 0x80, 0x81, 0xC2, 0x7B, 0xFF, 0xFA, 0xA2, 0x01, 0xB1, 0xD0, 0xD1, 0xEC, 0xF9,
-    0x44, 0xB0, 0xB5, 0xB8, 0xBE, 0xFF, 0xF9, 0xC2, 0x03, 0xD7, 0x11, 0xFC, 0xB2, 0xC1, 0x01, 0xB1,
-    0xD0, 0xF9, 0xFF, 0x43, 0x83, 0x8B, 0x8F, 0xFF, 0xFA, 0xC1, 0xF0, 0xC3, 0x14, 0x22, 0xD0, 0xD1,
-    0xE3, 0xF6, 0x21, 0x80, 0xFB, 0xC3, 0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xB3, 0xFF, 0xFD, 0xC1,
-    0xE9, 0x43, 0x82, 0x85, 0x8E, 0xC7, 0xE9, 0xC2, 0x0B, 0xC9, 0x29, 0xC2, 0x02, 0xB1, 0xD1, 0x2D,
-    0xFF, 0xF6, 0xC1, 0xD3, 0xC2, 0x00, 0x91, 0xD0, 0x2D, 0xCB, 0x48, 0xC1, 0xCA, 0xC2, 0x03, 0x32,
-    0xD0, 0x2D, 0xC8, 0x2C, 0xC1, 0xC1, 0xC2, 0x02, 0x21, 0xD1, 0x2D, 0xC4, 0x91, 0xC1, 0xB8, 0xC2,
-    0x02, 0xB1, 0x2E, 0x2D, 0xC8, 0xFB, 0xC1, 0xAF, 0x44, 0xB5, 0xB8, 0xBA, 0xBE, 0xC3, 0xC0, 0xC3,
-    0xC0, 0xC2, 0x7B, 0xC3, 0xC0, 0x46, 0x81, 0x82, 0x87, 0x8E, 0x8F, 0x91, 0xC2, 0x6E, 0xC2, 0x6E,
-    0xC2, 0x6E, 0xC3, 0xB3, 0xC3, 0xB3, 0xC3, 0xB3, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xC2, 0x5B, 0xFF,
-    0xE0, 0xFF, 0xED, 0xC1, 0x86, 0xA0, 0x04, 0x23, 0x21, 0x80, 0xFD, 0xC2, 0x03, 0xE2, 0xD1, 0x2D,
-    0xFF, 0xFD, 0xC1, 0x73, 0x41, 0xB2, 0xC1, 0x9E, 0xC2, 0x02, 0xB1, 0xD0, 0x2D, 0xFF, 0xFC, 0xC1,
-    0x66, 0x41, 0xB1, 0xC4, 0xA9, 0xC2, 0x02, 0xB1, 0xD0, 0x2D, 0xFF, 0xFC, 0xC1, 0x59, 0x51, 0x80,
-    0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x8A,
-    0xFE, 0xBA, 0xFF, 0x01, 0xFF, 0x67, 0xFF, 0x7D, 0xCC, 0xC2, 0xFF, 0x86, 0xC9, 0x12, 0xFF, 0x8F,
-    0xFF, 0x98, 0xC9, 0x12, 0xFF, 0xA1, 0xFF, 0xCA, 0xF3, 0x2E, 0xFF, 0xDD, 0xFF, 0xEA, 0xFF, 0xF7,
-    0xCC, 0x26, 0x42, 0xD0, 0xD1, 0xFE, 0x4B, 0xFF, 0xCC, 0x42, 0xB2, 0xBF, 0xC1, 0x30, 0xC1, 0x71,
-    0xC2, 0x04, 0xC3, 0xD0, 0x2D, 0xFF, 0xF9, 0xC1, 0x0E, 0x41, 0xD0, 0xF3, 0x32, 0x41, 0xB5, 0xE0,
-    0x46, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xD8, 0x95, 0x41, 0xB3, 0xC1, 0x9C, 0x21, 0xD0, 0xFC, 0x42,
-    0xBB, 0xBC, 0xFF, 0xFD, 0xC4, 0xC8, 0x42, 0x81, 0x82, 0xC1, 0x39, 0xC1, 0xBD, 0x22, 0xD0, 0xD1,
-    0xF2, 0xF9, 0x45, 0xB0, 0xB8, 0xBB, 0xBC, 0xBE, 0xC1, 0xB1, 0xFF, 0xD7, 0xFF, 0xDF, 0xC2, 0xF6,
-    0xFF, 0xFB, 0x42, 0xB2, 0xBD, 0xC1, 0x11, 0xC1, 0x11, 0x42, 0x2E, 0xD0, 0xC1, 0x24, 0xFF, 0xF9,
-    0x21, 0xB0, 0xF9, 0xA1, 0x01, 0x31, 0xD0, 0xFD, 0x43, 0x80, 0x8A, 0x8C, 0xFF, 0xFB, 0xC2, 0xD0,
-    0xC1, 0x8B, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD0, 0xFF, 0xF6, 0xC0, 0xAC, 0x42, 0xB0, 0xBE, 0xC0,
-    0xBD, 0xC1, 0x26, 0x21, 0xD0, 0xF9, 0x41, 0x88, 0xC1, 0x1C, 0x21, 0xD1, 0xFC, 0x21, 0x83, 0xFD,
-    0x42, 0xD0, 0xD1, 0xC0, 0xD9, 0xFF, 0xFD, 0x22, 0xBB, 0xBD, 0xEC, 0xF9, 0x41, 0xB8, 0xC1, 0x9B,
-    0x21, 0xD0, 0xFC, 0x42, 0xB5, 0xBA, 0xC0, 0x70, 0xC0, 0xC9, 0x21, 0xD0, 0xF9, 0x44, 0x80, 0x81,
-    0x82, 0x85, 0xFF, 0xF3, 0xFF, 0xFD, 0xC0, 0x66, 0xC0, 0xD0, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D,
-    0xFF, 0xDD, 0xFF, 0xF3, 0xC0, 0x64, 0x43, 0xB0, 0xB8, 0xBE, 0xEB, 0xC3, 0xEB, 0xC3, 0xEB, 0xC3,
-    0x21, 0xD0, 0xF6, 0x42, 0xB5, 0xBB, 0xC8, 0xB6, 0xFF, 0xFD, 0x41, 0x80, 0xCE, 0xF1, 0xC3, 0x01,
-    0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xF5, 0xFF, 0xFC, 0xC0, 0x40, 0x41, 0xBE, 0xC5, 0xB8, 0x21, 0xD0,
-    0xFC, 0x41, 0x8F, 0xF3, 0x08, 0x42, 0x2E, 0xD1, 0xC0, 0x44, 0xFF, 0xFC, 0xA0, 0x09, 0xB2, 0x42,
-    0xB0, 0xBC, 0xFF, 0xFD, 0xC8, 0x8A, 0x21, 0xD0, 0xF9, 0x41, 0xB8, 0xC2, 0xF2, 0x21, 0xD0, 0xFC,
-    0x42, 0x80, 0x8B, 0xC0, 0x1A, 0xC3, 0x33, 0x42, 0xD0, 0xD1, 0xC3, 0x2F, 0xFF, 0xF9, 0x41, 0xBB,
-    0xC3, 0x25, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xBF, 0xB1, 0xEC, 0xFD,
-    0x42, 0x81, 0x82, 0xC0, 0xA3, 0xEC, 0x03, 0x22, 0xD0, 0xD1, 0xF4, 0xF9, 0x46, 0xB0, 0xB2, 0xB5,
-    0xB8, 0xBB, 0xBE, 0xEF, 0xC9, 0xFF, 0xB2, 0xFF, 0xB9, 0xFF, 0xCA, 0xFF, 0xD1, 0xFF, 0xFB, 0x45,
-    0xB3, 0xB6, 0xB7, 0xBA, 0xBB, 0xC0, 0x14, 0xBF, 0xFD, 0xBF, 0xFD, 0xBF, 0xFD, 0xC0, 0x14, 0x21,
-    0xD0, 0xF0, 0x41, 0xD0, 0xF4, 0xA0, 0x42, 0xB1, 0xB2, 0xBF, 0xFD, 0xBF, 0xE6, 0x21, 0xD0, 0xF9,
-    0x23, 0xB0, 0xB5, 0xBE, 0xEF, 0xF2, 0xFD, 0x21, 0x91, 0xEB, 0x22, 0xD0, 0xD1, 0xF6, 0xFD, 0x41,
-    0x87, 0xC2, 0xC4, 0x21, 0xD1, 0xFC, 0x41, 0xB0, 0xBF, 0xF7, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xDE,
-    0xFE, 0x42, 0xBC, 0xBD, 0xFF, 0xF9, 0xBF, 0xEC, 0x21, 0xD0, 0xF9, 0xC1, 0x00, 0x91, 0xD0, 0xCC,
-    0x6E, 0x24, 0x80, 0x83, 0x8B, 0x8C, 0xD9, 0xE2, 0xF7, 0xFA, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0x92,
-    0xFF, 0xF7, 0xBF, 0x74, 0x41, 0xBA, 0xBF, 0x85, 0x21, 0xD0, 0xFC, 0x42, 0xB5, 0xB8, 0xFF, 0xFD,
-    0xBF, 0x58, 0x21, 0xD0, 0xF9, 0x45, 0xB1, 0xB2, 0xB4, 0xB6, 0xBE, 0xBF, 0x87, 0xC0, 0x78, 0xBF,
-    0x4E, 0xFF, 0xFD, 0xBF, 0x87, 0xC1, 0x03, 0x12, 0xD1, 0xC2, 0x22, 0x41, 0xD0, 0xC9, 0x0B, 0x43,
-    0x81, 0x82, 0x86, 0xFF, 0xF6, 0xFF, 0xFC, 0xBF, 0x34, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF,
-    0xDC, 0xFF, 0xF6, 0xBF, 0x35, 0x41, 0xB2, 0xDD, 0x2D, 0x21, 0xD0, 0xFC, 0x42, 0xB8, 0xB5, 0xBF,
-    0x3D, 0xFF, 0xFD, 0x41, 0x83, 0xBF, 0x9F, 0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0x21, 0xB4, 0xFB, 0x42,
-    0xD0, 0x2D, 0xFF, 0xFD, 0xBF, 0x0F, 0x41, 0xB2, 0xD6, 0x3E, 0x21, 0xD0, 0xFC, 0x42, 0xB1, 0xB2,
-    0xFF, 0xFD, 0xBF, 0xD6, 0x21, 0xD0, 0xF9, 0x43, 0xB0, 0xB5, 0xB8, 0xD4, 0xED, 0xD2, 0x29, 0xBE,
-    0xEC, 0x41, 0x8F, 0xD4, 0xE3, 0x22, 0xD0, 0xD1, 0xF2, 0xFC, 0x41, 0xBB, 0xC0, 0x53, 0x21, 0xD0,
-    0xFC, 0x42, 0xD0, 0xD1, 0xC3, 0x86, 0xCA, 0x41, 0x43, 0xB1, 0xBD, 0xBF, 0xBF, 0xEF, 0xBF, 0xAB,
-    0xBF, 0x35, 0x41, 0x80, 0xC3, 0xC4, 0xA2, 0x00, 0x91, 0xD0, 0xD1, 0xF2, 0xFC, 0x47, 0xB0, 0xB2,
-    0xB3, 0xB4, 0xB5, 0xBD, 0xBE, 0xFF, 0xC7, 0xFF, 0xD8, 0xFF, 0xE1, 0xFF, 0xE4, 0xC8, 0x43, 0xBF,
-    0x0F, 0xFF, 0xF9, 0x41, 0xB3, 0xBE, 0xD9, 0x21, 0xD0, 0xFC, 0x42, 0xD0, 0xD1, 0xD3, 0x01, 0xCF,
-    0xED, 0x22, 0x83, 0x8B, 0xF6, 0xF9, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD7, 0xFF, 0xFB, 0xBE, 0x98,
-    0xC1, 0x02, 0x92, 0xD0, 0xCA, 0xEB, 0x45, 0xB3, 0xB5, 0xB7, 0xBC, 0xBE, 0xFF, 0xFA, 0xBE, 0x94,
-    0xBE, 0x7D, 0xC4, 0x7C, 0xBE, 0x7D, 0xA0, 0x08, 0x13, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21,
-    0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0xC3, 0x00, 0xD1, 0xD0, 0xD1, 0x2D, 0xFF, 0xDE,
-    0xFF, 0xFD, 0xBE, 0x66, 0x41, 0xB2, 0xC1, 0x1C, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xBA, 0xFD, 0xA1, 0x01, 0xE1, 0xD0, 0xFD, 0x21, 0x81, 0xFB, 0xC2, 0x02, 0x21, 0xD1,
-    0x2D, 0xFF, 0xFD, 0xBE, 0x42, 0x41, 0xBD, 0xC6, 0xA4, 0x21, 0xD0, 0xFC, 0x41, 0x8E, 0xBE, 0x4D,
-    0xA1, 0x05, 0x22, 0xD1, 0xFC, 0x43, 0xB1, 0xBB, 0xBF, 0xBE, 0x85, 0xC6, 0x94, 0xE8, 0x11, 0x21,
-    0xD0, 0xF6, 0x44, 0xB0, 0xB2, 0xBB, 0xBE, 0xFF, 0xE7, 0xBE, 0x11, 0xFF, 0xEE, 0xFF, 0xFD, 0x41,
-    0xD0, 0xDA, 0x0F, 0xC1, 0x02, 0xB1, 0xD0, 0xC0, 0x59, 0x43, 0x81, 0x82, 0x83, 0xFF, 0xF6, 0xFF,
-    0xFA, 0xD3, 0x9F, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xDF, 0xFF, 0xF6, 0xBD, 0xFB, 0x41,
-    0xB0, 0xD1, 0x21, 0x21, 0xD0, 0xFC, 0x41, 0xD0, 0xE7, 0xE9, 0x21, 0xBC, 0xFC, 0x21, 0xD0, 0xFD,
-    0x45, 0xB0, 0xB3, 0xB5, 0xB8, 0xBE, 0xBD, 0xF9, 0xFF, 0xF3, 0xBE, 0x23, 0xFF, 0xFD, 0xBD, 0xF9,
-    0xC1, 0x00, 0x91, 0xD0, 0xD2, 0xF7, 0x45, 0x83, 0x8B, 0x8E, 0x8F, 0x91, 0xFF, 0xFA, 0xBE, 0x0D,
-    0xBE, 0x0D, 0xBD, 0xE3, 0xBE, 0x0D, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xDA, 0xFF, 0xF0, 0xBD, 0xB8,
-    0x41, 0xBC, 0xBE, 0x32, 0x41, 0x82, 0xBE, 0x2E, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x41, 0xB6, 0xBD,
-    0xBC, 0x21, 0xD0, 0xFC, 0x22, 0xB5, 0xBE, 0xF4, 0xFD, 0x21, 0x91, 0xEF, 0x22, 0xD0, 0xD1, 0xF8,
-    0xFD, 0x44, 0xB0, 0xB1, 0xB5, 0xBD, 0xBD, 0xA8, 0xC1, 0xF1, 0xBE, 0x62, 0xFF, 0xFB, 0x41, 0x2E,
-    0xD1, 0xE4, 0x21, 0xB5, 0xFC, 0xA1, 0x01, 0xB1, 0xD0, 0xFD, 0xC1, 0x00, 0xA1, 0xD1, 0xCC, 0x1D,
-    0x45, 0x80, 0x87, 0x88, 0x8C, 0x91, 0xBD, 0xA2, 0xFF, 0xF5, 0xBD, 0xEF, 0xFF, 0xFA, 0xBE, 0x43,
-    0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD1, 0xFF, 0xF0, 0xBD, 0x5E, 0x41, 0xD1, 0xDC, 0x1C, 0x41, 0xBC,
-    0xC1, 0x29, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBB, 0xFD, 0x21, 0xD0,
-    0xFD, 0x45, 0xB0, 0xB4, 0xB5, 0xBE, 0xB8, 0xBD, 0x58, 0xBD, 0x8E, 0xFF, 0xE9, 0xC9, 0x47, 0xFF,
-    0xFD, 0x41, 0xB0, 0xC0, 0x0A, 0x42, 0xD1, 0xD0, 0xD1, 0x13, 0xFF, 0xFC, 0x21, 0x80, 0xF9, 0x21,
-    0xD1, 0xFD, 0x43, 0x80, 0x81, 0x82, 0xBD, 0x61, 0xBD, 0x6D, 0xFF, 0xFD, 0x43, 0xD0, 0xD1, 0x2D,
-    0xFF, 0xD5, 0xFF, 0xF6, 0xBD, 0x12, 0x41, 0xD1, 0xC3, 0x4E, 0x42, 0xBB, 0xBF, 0xBD, 0x63, 0xFF,
-    0xFC, 0x42, 0xD0, 0xD1, 0xC4, 0x12, 0xD0, 0x51, 0x43, 0x81, 0x82, 0x84, 0xFF, 0xF9, 0xBD, 0xAB,
-    0xBD, 0x55, 0xC3, 0x00, 0x92, 0xD0, 0xD1, 0x2D, 0xFF, 0xE8, 0xFF, 0xF6, 0xBC, 0xEC, 0x41, 0x80,
-    0xBC, 0xFB, 0x42, 0xD0, 0xD1, 0xFD, 0x72, 0xFF, 0xFC, 0x41, 0xB9, 0xBD, 0xEE, 0x42, 0x2E, 0xD0,
-    0xBD, 0x30, 0xFF, 0xFC, 0xC1, 0x00, 0xA1, 0xD1, 0xBF, 0xA3, 0x43, 0xB5, 0xB8, 0xBE, 0xFF, 0xF3,
-    0xFF, 0xFA, 0xBC, 0xB9, 0x42, 0x2E, 0xD1, 0xBD, 0x02, 0xC9, 0xE6, 0xC1, 0x00, 0xA1, 0xD1, 0xCD,
-    0xFC, 0x21, 0xD0, 0xD8, 0x23, 0x8E, 0x8F, 0x91, 0xF0, 0xF7, 0xFD, 0x22, 0xD0, 0xD1, 0xDF, 0xF9,
-    0x42, 0xB2, 0xB7, 0xC0, 0x71, 0xF3, 0xB0, 0x41, 0x88, 0xE6, 0x78, 0x22, 0xD0, 0xD1, 0xF5, 0xFC,
-    0x23, 0xB0, 0xBB, 0xBE, 0xB2, 0xEB, 0xFB, 0x42, 0xB5, 0xBE, 0xBD, 0x0B, 0xBC, 0x7C, 0x21, 0xD0,
-    0xF9, 0x42, 0x80, 0x82, 0xBD, 0x86, 0xFF, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE8, 0xFF, 0xF9,
-    0xBC, 0x76, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC,
-    0xBD, 0xBE, 0xBF, 0xFB, 0x5E, 0xFB, 0xC0, 0xFC, 0x08, 0xFC, 0x2C, 0xFC, 0xF8, 0xFD, 0x37, 0xFD,
-    0x5D, 0xFD, 0xD4, 0xFE, 0x06, 0xFE, 0x2A, 0xFE, 0x71, 0xFE, 0xB4, 0xFF, 0x0E, 0xFF, 0x5A, 0xFF,
-    0x80, 0xFF, 0xF6, 0x41, 0xBB, 0xC9, 0xA0, 0x21, 0xD0, 0xFC, 0x41, 0xB3, 0xC4, 0x9F, 0xC2, 0x00,
-    0x91, 0xD0, 0xD1, 0xFF, 0xFC, 0xE7, 0xBD, 0x41, 0xBF, 0xBC, 0x55, 0x21, 0xD0, 0xFC, 0x21, 0x81,
-    0xFD, 0xA1, 0x00, 0x91, 0xD1, 0xFD, 0x41, 0x81, 0xE5, 0xF9, 0xA1, 0x00, 0x91, 0xD1, 0xFC, 0x46,
-    0xB0, 0xB1, 0xB2, 0xB5, 0xB8, 0xBE, 0xE2, 0x44, 0xFF, 0xD8, 0xD2, 0x05, 0xFF, 0xDF, 0xFF, 0xF2,
-    0xFF, 0xFB, 0xC1, 0x00, 0x91, 0xD1, 0xC4, 0xC9, 0x42, 0xB5, 0xBA, 0xBC, 0x3B, 0xFF, 0xFA, 0x42,
-    0xD0, 0xD1, 0xFF, 0xF9, 0xD8, 0xEE, 0x47, 0x82, 0x83, 0x86, 0x8B, 0x8E, 0x8F, 0x91, 0xC0, 0x8D,
-    0xFF, 0xF9, 0xBC, 0xBD, 0xBC, 0x2D, 0xBC, 0x2D, 0xBC, 0x2D, 0xBC, 0x2D, 0x43, 0xD0, 0xD1, 0x2D,
-    0xFF, 0xC3, 0xFF, 0xEA, 0xBB, 0xD2, 0x42, 0xB4, 0xB6, 0xBB, 0xE3, 0xBF, 0xA1, 0x21, 0xD0, 0xF9,
-    0x41, 0xB0, 0xD0, 0x22, 0xA1, 0x01, 0xB1, 0xD0, 0xFC, 0x42, 0x2E, 0xD1, 0xBC, 0xCE, 0xCC, 0x36,
-    0xC1, 0x01, 0x31, 0x2E, 0xBC, 0x0D, 0x44, 0xB2, 0xB9, 0xBC, 0xBF, 0xBC, 0x07, 0xBB, 0xD6, 0xBB,
-    0xD6, 0xD1, 0x9E, 0x41, 0x8E, 0xBB, 0xC9, 0x22, 0xD0, 0xD1, 0xEF, 0xFC, 0x45, 0xB0, 0xB2, 0xB5,
-    0xB8, 0xBE, 0xFF, 0xDD, 0xC5, 0x14, 0xBB, 0xF1, 0xFF, 0xE4, 0xFF, 0xFB, 0x42, 0x2E, 0xD1, 0xBC,
-    0x9B, 0xFF, 0xE7, 0x42, 0x83, 0x91, 0xFF, 0xF9, 0xBB, 0xDA, 0x22, 0xD0, 0xD1, 0xE2, 0xF9, 0x41,
-    0xB9, 0xBB, 0xB7, 0x21, 0xD0, 0xFC, 0x41, 0xB3, 0xBB, 0xB0, 0x21, 0xD0, 0xFC, 0x22, 0xB5, 0xBE,
-    0xF6, 0xFD, 0x41, 0xD1, 0xE6, 0xA5, 0x21, 0x8B, 0xFC, 0xA2, 0x00, 0x92, 0xD0, 0xD1, 0xF4, 0xFD,
-    0x42, 0xB8, 0xBE, 0xBB, 0x96, 0xFE, 0x46, 0x21, 0xD0, 0xF9, 0x41, 0xBC, 0xD1, 0x3A, 0x21, 0xD0,
-    0xFC, 0x21, 0xB8, 0xFD, 0x41, 0x8F, 0xBF, 0x9E, 0x22, 0xD0, 0xD1, 0xF9, 0xFC, 0x42, 0x83, 0x8F,
-    0xD1, 0x27, 0xBB, 0x26, 0x42, 0xD0, 0xD1, 0xE1, 0xE5, 0xFF, 0xF9, 0x41, 0xBC, 0xCD, 0x6E, 0x21,
-    0xD0, 0xFC, 0x48, 0xB0, 0xB1, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xBE, 0xFF, 0x5B, 0xFF, 0x62, 0xFF,
-    0xA8, 0xFF, 0xC7, 0xFF, 0xD5, 0xFF, 0xE6, 0xFF, 0xF2, 0xFF, 0xFD, 0x42, 0xB2, 0xBC, 0xBA, 0xF8,
-    0xC8, 0x68, 0x21, 0xD0, 0xF9, 0x41, 0xD0, 0xBB, 0x17, 0x21, 0x80, 0xFC, 0xC2, 0x00, 0x91, 0xD0,
-    0xD1, 0xBE, 0x2E, 0xFF, 0xFD, 0x41, 0xD1, 0xDC, 0x0C, 0x41, 0xD0, 0xCE, 0x1B, 0x41, 0xB2, 0xD0,
-    0xD7, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x47, 0x81, 0x82, 0x83, 0x85, 0x86,
-    0x87, 0x88, 0xFF, 0xD8, 0xFF, 0xE2, 0xFF, 0xEB, 0xBB, 0xA9, 0xFF, 0xEF, 0xD0, 0xCA, 0xFF, 0xFD,
-    0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xA2, 0xFF, 0xEA, 0xBA, 0xBE, 0x44, 0xB0, 0xB5, 0xB8, 0xBB, 0xBA,
-    0xFC, 0xBA, 0xE2, 0xBA, 0xE2, 0xBA, 0xE2, 0xC2, 0x01, 0xE1, 0xD0, 0xD1, 0xFF, 0xF3, 0xD8, 0xFF,
-    0x41, 0xBA, 0xC3, 0x09, 0x42, 0x80, 0x85, 0xBA, 0xB5, 0xC3, 0x05, 0x22, 0xD0, 0xD1, 0xF5, 0xF9,
-    0x41, 0xBD, 0xBD, 0x50, 0x21, 0xD0, 0xFC, 0x21, 0xB4, 0xFD, 0xA1, 0x00, 0xD1, 0xD0, 0xFD, 0x41,
-    0xB0, 0xCB, 0x66, 0x21, 0xD0, 0xFC, 0x47, 0xB2, 0xB3, 0xB4, 0xB5, 0xB8, 0xBA, 0xBC, 0xFF, 0xD1,
-    0xBC, 0x92, 0xBC, 0x92, 0xFF, 0xE5, 0xFF, 0xF4, 0xFF, 0xFD, 0xBA, 0xD7, 0x43, 0xB1, 0xB4, 0xB7,
-    0xBA, 0x90, 0xBA, 0x90, 0xBA, 0x90, 0x42, 0xD0, 0xD1, 0xFF, 0xF6, 0xC1, 0xC4, 0x42, 0xB6, 0xBA,
-    0xBA, 0x7F, 0xBA, 0x7F, 0x42, 0x87, 0x88, 0xBA, 0x78, 0xBA, 0x78, 0x22, 0xD0, 0xD1, 0xF2, 0xF9,
-    0x43, 0xB4, 0xB5, 0xBA, 0xBA, 0x6C, 0xBA, 0x6C, 0xBA, 0x6C, 0x42, 0x81, 0x87, 0xBA, 0x62, 0xBA,
-    0x62, 0x22, 0xD0, 0xD1, 0xEF, 0xF9, 0x44, 0xB0, 0xB5, 0xB8, 0xBE, 0xFF, 0xD0, 0xFF, 0xE5, 0xBA,
-    0x56, 0xFF, 0xFB, 0x42, 0xD0, 0xD1, 0xD6, 0x1B, 0xD7, 0xDC, 0x42, 0x83, 0x91, 0xFB, 0x6D, 0xFF,
-    0xF9, 0x22, 0xD0, 0xD1, 0xE5, 0xF9, 0x42, 0xD0, 0xD1, 0xBA, 0x5C, 0xDA, 0x7E, 0x42, 0xD0, 0xD1,
-    0xFF, 0x63, 0xFD, 0x21, 0x46, 0x80, 0x81, 0x83, 0x85, 0x8C, 0x91, 0xFF, 0xED, 0xBC, 0x1B, 0xFF,
-    0xF2, 0xBC, 0x14, 0xE6, 0x19, 0xFF, 0xF9, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0x6F, 0xFF,
-    0xED, 0xB9, 0xE7, 0x42, 0xB0, 0xBE, 0xBA, 0x23, 0xBA, 0x23, 0x21, 0xD0, 0xF9, 0x42, 0x81, 0x82,
-    0xE4, 0xD6, 0xFF, 0xFD, 0xC3, 0x00, 0x92, 0xD0, 0xD1, 0x2D, 0xCC, 0x56, 0xFF, 0xF9, 0xB9, 0xCA,
-    0x41, 0x88, 0xBA, 0x93, 0x21, 0xD1, 0xFC, 0x42, 0x80, 0x82, 0xBA, 0x6C, 0xBA, 0x8C, 0x42, 0xD0,
-    0xD1, 0xDE, 0xD3, 0xFF, 0xF9, 0x44, 0xB0, 0xB5, 0xB8, 0xBE, 0xFF, 0xEF, 0xB9, 0xC4, 0xBC, 0x72,
-    0xFF, 0xF9, 0x42, 0x80, 0x91, 0xBA, 0x51, 0xB9, 0xB7, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF,
-    0xF9, 0xB9, 0x95, 0x42, 0x8B, 0x8F, 0xB9, 0xB9, 0xB9, 0xEA, 0x21, 0xD1, 0xF9, 0x44, 0xB8, 0xBB,
-    0xBC, 0xBE, 0xBA, 0x56, 0xFF, 0xFD, 0xBA, 0x02, 0xD8, 0x38, 0x42, 0x80, 0x83, 0xB9, 0xB9, 0xB9,
-    0xB9, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xF9, 0xB9, 0x6D, 0x42, 0xD0, 0x2D, 0xC3, 0x2B,
-    0xB9, 0x63, 0x42, 0xB5, 0xB8, 0xB9, 0x8A, 0xB9, 0x77, 0xA1, 0x01, 0xB1, 0xD0, 0xF9, 0x42, 0xB0,
-    0xBB, 0xD5, 0xB5, 0xFF, 0xFB, 0xC1, 0x00, 0x91, 0xD0, 0xF5, 0xBF, 0x21, 0x82, 0xFA, 0x43, 0xD0,
-    0xD1, 0x2D, 0xFF, 0xF0, 0xFF, 0xFD, 0xB9, 0x40, 0x41, 0xD0, 0xDC, 0x17, 0x41, 0xBA, 0xE9, 0x56,
-    0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x43, 0xB2, 0xBB, 0xBF, 0xFF, 0xEF, 0xBC,
-    0x65, 0xFF, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF6, 0xBB, 0xF4, 0xB9, 0x1B, 0x41, 0x82, 0xB9,
-    0x45, 0x42, 0xD1, 0x2D, 0xFF, 0xFC, 0xB9, 0x0D, 0x43, 0xB2, 0xB4, 0xB7, 0xB8, 0xFB, 0xB8, 0xFB,
-    0xB8, 0xFB, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xF6, 0xE6, 0xF7, 0xB8, 0xFC, 0x41, 0xB6,
-    0xB9, 0xF9, 0xC2, 0x00, 0x91, 0xD0, 0x2D, 0xFF, 0xFC, 0xB8, 0xEC, 0x51, 0x80, 0x81, 0x82, 0x83,
-    0x84, 0x85, 0x86, 0x87, 0x88, 0x8D, 0x8E, 0x8F, 0x91, 0x89, 0x8A, 0x8B, 0x8C, 0xFD, 0x11, 0xFE,
-    0x25, 0xFE, 0xFC, 0xFF, 0x19, 0xFF, 0x4E, 0xFF, 0x76, 0xFF, 0x80, 0xFF, 0xA3, 0xFF, 0xC8, 0xFF,
-    0xD6, 0xC0, 0xA5, 0xFF, 0xE7, 0xFF, 0xF7, 0xBC, 0xF2, 0xBC, 0xF2, 0xBC, 0xF2, 0xBC, 0xF2, 0x42,
-    0xD0, 0xD1, 0xFC, 0x43, 0xFF, 0xCC, 0x42, 0xB8, 0xBB, 0xC4, 0xBF, 0xB8, 0xB4, 0x42, 0xD0, 0xD1,
-    0xFF, 0xF9, 0xDF, 0x22, 0x44, 0xB2, 0xB4, 0xB5, 0xB7, 0xFF, 0xF9, 0xBD, 0x3F, 0xCB, 0xCC, 0xBD,
-    0xA2, 0x43, 0xB0, 0xB5, 0xBE, 0xB8, 0xE9, 0xB8, 0xBB, 0xB8, 0xE9, 0x42, 0x83, 0x8B, 0xB8, 0xDF,
-    0xBA, 0x3D, 0x22, 0xD0, 0xD1, 0xEF, 0xF9, 0x21, 0x82, 0xFB, 0x42, 0xD0, 0xD1, 0xBC, 0xEF, 0xFF,
-    0xFD, 0x41, 0x80, 0xBD, 0x75, 0x21, 0xD1, 0xFC, 0x46, 0x81, 0x82, 0x83, 0x84, 0x85, 0x88, 0xFF,
-    0xF2, 0xFF, 0xFD, 0xCB, 0x98, 0xB8, 0xAE, 0xC1, 0x74, 0xBB, 0x43, 0x43, 0xD0, 0xD1, 0x2D, 0xFF,
-    0xB9, 0xFF, 0xED, 0xB8, 0x53, 0x41, 0xBD, 0xBA, 0x03, 0x21, 0xD0, 0xFC, 0x42, 0xB2, 0xB8, 0xB8,
-    0x37, 0xFF, 0xFD, 0x21, 0xD0, 0xF9, 0xC1, 0x01, 0xB1, 0xD0, 0xFE, 0x5D, 0x41, 0xB0, 0xB9, 0xEC,
-    0x21, 0xD0, 0xFC, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xD1, 0xDE, 0xA6, 0x41, 0xBB, 0xC2,
-    0x78, 0x21, 0xD0, 0xFC, 0x25, 0xB4, 0xB7, 0xBA, 0xBB, 0xBF, 0xDF, 0xE2, 0xF2, 0xF5, 0xFD, 0xA0,
-    0x0A, 0x02, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x42, 0xB8,
-    0xB5, 0xC8, 0x5C, 0xFF, 0xFD, 0x21, 0xD0, 0xF9, 0x42, 0xBA, 0xBD, 0xB9, 0xB0, 0xB7, 0xEB, 0x43,
-    0x82, 0x86, 0x87, 0xEF, 0x45, 0xB7, 0xE4, 0xB7, 0xE4, 0x22, 0xD0, 0xD1, 0xEF, 0xF6, 0x44, 0x80,
-    0x81, 0x82, 0x88, 0xFF, 0xE7, 0xFF, 0xFB, 0xBC, 0x85, 0xBA, 0xBD, 0xC3, 0x01, 0x31, 0xD0, 0xD1,
-    0x2D, 0xFF, 0xB9, 0xFF, 0xF3, 0xB7, 0xD3, 0x41, 0x82, 0xE4, 0x25, 0x21, 0xD1, 0xFC, 0x21, 0x81,
-    0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xBC, 0xC5, 0x1F, 0x21, 0xD0, 0xFC, 0x41, 0xBA, 0xBE, 0xFF, 0x21,
-    0xD0, 0xFC, 0x44, 0xB0, 0xB6, 0xBA, 0xBD, 0xFF, 0xEF, 0xFF, 0xF6, 0xBE, 0x9A, 0xFF, 0xFD, 0x41,
-    0x8F, 0xBE, 0xEB, 0x21, 0xD1, 0xFC, 0x21, 0x81, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE9, 0xFF,
-    0xFD, 0xB7, 0x95, 0xC1, 0x01, 0x92, 0x2D, 0xB7, 0x8B, 0x42, 0x2E, 0xD1, 0xD8, 0xB3, 0xD3, 0xE6,
-    0x42, 0x2E, 0xD1, 0xB7, 0xC3, 0xD4, 0x7D, 0xC1, 0x02, 0x21, 0xD0, 0xC4, 0x6B, 0xA0, 0x06, 0xD2,
-    0x23, 0xBC, 0xBD, 0xBE, 0xF0, 0xF7, 0xFD, 0x41, 0xBA, 0xB9, 0xF5, 0x21, 0xD0, 0xFC, 0x42, 0x81,
-    0x8E, 0xFF, 0xFD, 0xB7, 0xA5, 0x22, 0xD0, 0xD1, 0xEB, 0xF9, 0x42, 0xB2, 0xBA, 0xB8, 0x29, 0xC3,
-    0xFB, 0x21, 0xD0, 0xF9, 0x42, 0xB2, 0xB3, 0xB8, 0x1F, 0xB8, 0x1F, 0x42, 0x2E, 0xD0, 0xB8, 0x18,
-    0xFF, 0xF9, 0x24, 0xB0, 0xB5, 0xB8, 0xBE, 0xB7, 0xE3, 0xEF, 0xF9, 0x43, 0xB9, 0xBC, 0xBD, 0xB8,
-    0x08, 0xB8, 0x08, 0xB7, 0x78, 0x41, 0x85, 0xB7, 0x6E, 0x22, 0xD0, 0xD1, 0xF2, 0xFC, 0x42, 0x2E,
-    0xD1, 0xB7, 0xF5, 0xC9, 0xC1, 0x41, 0xD1, 0xE5, 0xAA, 0x41, 0xBD, 0xFF, 0x9E, 0x22, 0xD0, 0xD1,
-    0xFC, 0xB1, 0x24, 0x8B, 0x8E, 0x8F, 0x91, 0xE7, 0xEC, 0xF3, 0xFB, 0x44, 0x2E, 0xD0, 0xD1, 0x2D,
-    0xB7, 0xD8, 0xFF, 0xC7, 0xFF, 0xF7, 0xB7, 0x03, 0xA0, 0x06, 0xB2, 0x42, 0xB0, 0xBE, 0xB7, 0x0E,
-    0xFF, 0xFD, 0x41, 0x8B, 0xB7, 0x07, 0xC3, 0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xF5, 0xFF, 0xFC,
-    0xB6, 0xE8, 0x41, 0x81, 0xBF, 0xB8, 0x42, 0xD0, 0xD1, 0xB8, 0xD6, 0xFF, 0xFC, 0x43, 0xBA, 0xBC,
-    0xB4, 0xC3, 0x0F, 0xBE, 0x9F, 0xB7, 0x52, 0x21, 0xD0, 0xF6, 0x42, 0xB2, 0xBE, 0xC0, 0x46, 0xFF,
-    0xFD, 0x41, 0xBE, 0xC2, 0xFB, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x83,
-    0xFD, 0x22, 0xD0, 0xD1, 0xE9, 0xFD, 0x42, 0xBB, 0xB6, 0xB6, 0xF9, 0xB6, 0xF9, 0x42, 0xD0, 0xD1,
-    0xFF, 0xF9, 0xD9, 0x60, 0x44, 0xB2, 0xB4, 0xBB, 0xBD, 0xBC, 0x1E, 0xBB, 0xA2, 0xB9, 0xE6, 0xB6,
-    0xC8, 0x21, 0xD0, 0xF3, 0x41, 0x89, 0xB6, 0xDB, 0x21, 0xD1, 0xFC, 0x42, 0xD0, 0xD1, 0xB6, 0xCE,
-    0xBD, 0x75, 0x21, 0xBD, 0xF9, 0x21, 0xD0, 0xFD, 0xA0, 0x09, 0xD3, 0x4A, 0xB1, 0xB2, 0xB4, 0xB5,
-    0xB7, 0xB8, 0xB9, 0xBB, 0xBC, 0xBF, 0xB9, 0xBF, 0xFF, 0x9B, 0xFF, 0xC6, 0xFF, 0xD2, 0xFF, 0xE6,
-    0xFF, 0xED, 0xBD, 0xBF, 0xFE, 0xC4, 0xFF, 0xFA, 0xFF, 0xFD, 0x42, 0xB3, 0xB6, 0xB6, 0x99, 0xB6,
-    0xA5, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xBB, 0xBD, 0x41, 0xB8, 0xC9, 0x78, 0x21, 0xD0, 0xFC, 0x42,
-    0x81, 0x82, 0xB6, 0x87, 0xFF, 0xFD, 0xC2, 0x09, 0x42, 0xD0, 0xD1, 0xCC, 0x79, 0xFF, 0xF9, 0x42,
-    0xD0, 0xD1, 0xE2, 0x12, 0xBF, 0x57, 0x42, 0x8B, 0x8F, 0xB6, 0x1D, 0xB6, 0x1D, 0x42, 0xD0, 0xD1,
-    0xB7, 0x8C, 0xFF, 0xF9, 0x21, 0xBB, 0xF9, 0x21, 0xD0, 0xFD, 0x41, 0xB6, 0xB6, 0x65, 0x21, 0xD0,
-    0xFC, 0x47, 0x80, 0x81, 0x82, 0x85, 0x88, 0x8D, 0x91, 0xFF, 0xC0, 0xFF, 0xD5, 0xFF, 0xDE, 0xB9,
-    0x59, 0xFF, 0xF6, 0xDA, 0x5D, 0xFF, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0x84, 0xFF, 0xEA, 0xB5,
-    0xF7, 0x41, 0xD0, 0xED, 0xEB, 0x21, 0xBE, 0xFC, 0xC2, 0x05, 0x22, 0xD0, 0x2D, 0xFF, 0xFD, 0xB5,
-    0xE6, 0x50, 0xB0, 0xB2, 0xB4, 0xB5, 0xB8, 0xBA, 0xBB, 0xBD, 0xBE, 0xBF, 0xB1, 0xB3, 0xB6, 0xB7,
-    0xB9, 0xBC, 0xFD, 0x8A, 0xC9, 0xA5, 0xBD, 0x10, 0xFE, 0x0A, 0xFE, 0x48, 0xFE, 0x52, 0xFE, 0xDA,
-    0xFE, 0xF5, 0xFF, 0xE6, 0xFF, 0xF7, 0xB9, 0xEC, 0xB9, 0xEC, 0xB9, 0xEC, 0xB9, 0xEC, 0xB9, 0xEC,
-    0xB9, 0xEC, 0x41, 0xB3, 0xB6, 0x08, 0x21, 0xD0, 0xFC, 0x41, 0xBD, 0xC9, 0x9E, 0x21, 0xD0, 0xFC,
-    0x46, 0xB2, 0xB7, 0xB9, 0xBB, 0xBE, 0xBC, 0xBC, 0xEA, 0xB5, 0xFA, 0xB8, 0x89, 0xB5, 0xFA, 0xFF,
-    0xF6, 0xFF, 0xFD, 0x41, 0x82, 0xBC, 0xD7, 0x22, 0xD0, 0xD1, 0xE9, 0xFC, 0x41, 0x8C, 0xC9, 0xAC,
-    0xA1, 0x01, 0xC1, 0xD1, 0xFC, 0x46, 0xB2, 0xB3, 0xB4, 0xBA, 0xBB, 0xBF, 0xB5, 0x85, 0xB8, 0x64,
-    0xB9, 0x52, 0xB5, 0x85, 0xFF, 0xFB, 0xB8, 0x64, 0xA0, 0x0C, 0x52, 0x21, 0xBA, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0x91, 0xFA, 0x22, 0xD0, 0xD1,
-    0xFA, 0xFD, 0x42, 0x86, 0x87, 0xB5, 0xAB, 0xFF, 0xFB, 0xA2, 0x01, 0xF1, 0xD0, 0xD1, 0xCC, 0xF9,
-    0x41, 0xBB, 0xB8, 0x29, 0x21, 0xD0, 0xFC, 0xC1, 0x02, 0x32, 0xD0, 0xE8, 0xAD, 0x46, 0xB1, 0xB4,
-    0xB6, 0xB7, 0xB8, 0xBF, 0xB9, 0xB0, 0xFF, 0xF7, 0xB9, 0x0A, 0xFF, 0xFA, 0xBC, 0x7D, 0xB5, 0x3D,
-    0x41, 0xBE, 0xC9, 0x48, 0x21, 0xD0, 0xFC, 0x21, 0x84, 0xFD, 0x22, 0xD0, 0xD1, 0xE3, 0xFD, 0x43,
-    0xB5, 0xB8, 0xBE, 0xFF, 0x88, 0xFF, 0xCA, 0xFF, 0xFB, 0x41, 0xD1, 0xFF, 0x7A, 0x43, 0x81, 0x83,
-    0x91, 0xB5, 0xD6, 0xB5, 0x60, 0xFF, 0xFC, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xB5, 0xCC, 0xFF, 0xE8,
-    0xFF, 0xF6, 0xB4, 0xF7, 0x41, 0xD0, 0xEB, 0xEB, 0x41, 0x85, 0xC1, 0x8D, 0x42, 0xD0, 0xD1, 0xBD,
-    0x6E, 0xFF, 0xFC, 0x43, 0xB0, 0xB8, 0xBE, 0xFF, 0xF1, 0xFF, 0xF9, 0xB4, 0xF6, 0xC2, 0x04, 0xC3,
-    0xD0, 0x2D, 0xFF, 0xF6, 0xB4, 0xD1, 0x42, 0xD1, 0xD0, 0xFF, 0xE2, 0xFA, 0x41, 0x42, 0xB2, 0xB8,
-    0xC9, 0x25, 0xFF, 0xF9, 0xC3, 0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xF9, 0xB5, 0xA2, 0xB4, 0xBA,
-    0x41, 0xBD, 0xB4, 0xBA, 0x21, 0xD0, 0xFC, 0x42, 0xB1, 0xB3, 0xBB, 0xF3, 0xFF, 0xFD, 0x41, 0xBA,
-    0xB9, 0x98, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xBA, 0xF7, 0x42, 0x81, 0x82, 0xFF, 0xF9, 0xE9, 0xC6,
-    0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE7, 0xFF, 0xF9, 0xB4, 0x8E, 0x43, 0x2E, 0xD1, 0x2D, 0xB5, 0x59,
-    0xB7, 0x49, 0xB4, 0x84, 0x42, 0xD1, 0x2D, 0xBD, 0x31, 0xB4, 0x7A, 0xC1, 0x02, 0x52, 0x2D, 0xB4,
-    0x73, 0x41, 0xD1, 0xEB, 0xC6, 0x42, 0x81, 0x82, 0xFF, 0xFC, 0xB9, 0x0E, 0xC2, 0x01, 0x31, 0xD1,
-    0x2D, 0xFF, 0xF9, 0xB4, 0x62, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-    0x8C, 0x8D, 0x8E, 0x91, 0x8A, 0x8B, 0x8F, 0xFF, 0x62, 0xFF, 0x88, 0xFF, 0x9F, 0xFF, 0xCB, 0xBF,
-    0xCB, 0xBB, 0x9F, 0xBC, 0x1B, 0xFC, 0xCE, 0xBC, 0x1B, 0xBC, 0x1B, 0xFF, 0xD5, 0xFF, 0xDF, 0xFF,
-    0xE6, 0xFF, 0xF7, 0xBF, 0x2F, 0xB8, 0x68, 0xB8, 0x68, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xFE, 0x48,
-    0xFF, 0xCC, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC,
-    0xBD, 0xBE, 0xBF, 0xBA, 0xFC, 0xBF, 0x2D, 0xC4, 0x2B, 0xC7, 0x45, 0xCD, 0x30, 0xD5, 0x06, 0xD6,
-    0xB9, 0xDB, 0x83, 0xE1, 0x22, 0xE2, 0x0E, 0xE6, 0x34, 0xEA, 0x97, 0xEE, 0x0F, 0xF3, 0x00, 0xFB,
-    0x6D, 0xFF, 0xF7, 0x42, 0xBB, 0xBE, 0xB3, 0xE0, 0xB6, 0x05, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xB5,
-    0xA1, 0x41, 0xBD, 0xE5, 0x5E, 0x21, 0xD0, 0xFC, 0x41, 0xB1, 0xFB, 0xC7, 0x21, 0xD0, 0xFC, 0x42,
-    0xB6, 0xBE, 0xB4, 0x20, 0xFF, 0xFD, 0x41, 0x86, 0xB3, 0xBD, 0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0x41,
-    0x83, 0xB8, 0x64, 0x21, 0xD1, 0xFC, 0x41, 0xB9, 0xB3, 0xAD, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD,
-    0x42, 0xD0, 0xD1, 0xFF, 0xFD, 0xC9, 0x9E, 0x41, 0xB7, 0xB5, 0xC1, 0x21, 0xD0, 0xFC, 0x43, 0xB2,
-    0xB8, 0xBB, 0xB3, 0xF1, 0xFF, 0xFD, 0xC1, 0x05, 0x21, 0xD0, 0xF6, 0x42, 0xBA, 0xBD, 0xB5, 0xAD,
-    0xB5, 0xAD, 0x21, 0xD0, 0xF9, 0x41, 0x85, 0xB3, 0x7E, 0x21, 0xD1, 0xFC, 0x21, 0xBE, 0xFD, 0x41,
-    0x81, 0xB6, 0xA1, 0x22, 0xD0, 0xD1, 0xF9, 0xFC, 0x4C, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xB7,
-    0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xB3, 0xC7, 0xFF, 0x92, 0xFF, 0x9D, 0xBF, 0xD0, 0xFF, 0xB2, 0xFF,
-    0xBB, 0xFF, 0xC8, 0xFF, 0xE0, 0xB8, 0x61, 0xFF, 0xEA, 0xFF, 0xFB, 0xE6, 0x76, 0x43, 0xBA, 0xBB,
-    0xBF, 0xB7, 0x2A, 0xB5, 0x6B, 0xB3, 0x5D, 0x42, 0xB0, 0xBB, 0xB5, 0x61, 0xB7, 0x20, 0xA1, 0x01,
-    0xF1, 0xD0, 0xF9, 0x21, 0x82, 0xFB, 0x22, 0xD0, 0xD1, 0xE7, 0xFD, 0x42, 0xB0, 0xB2, 0xB7, 0x8A,
-    0xB3, 0x8F, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xB6, 0x7B, 0xC1, 0x02, 0xB1, 0xD1, 0xB5, 0xEA, 0x46,
-    0x81, 0x82, 0x85, 0x89, 0x8E, 0x8F, 0xFF, 0xE7, 0xFF, 0xF3, 0xB5, 0x71, 0xDD, 0x28, 0xB5, 0x39,
-    0xFF, 0xFA, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xB5, 0x26, 0xFF, 0x96, 0xFF, 0xED, 0xB3, 0x0C, 0x43,
-    0xB0, 0xB5, 0xBE, 0xB2, 0xF4, 0xB3, 0x5E, 0xB2, 0xF4, 0x42, 0x8E, 0x91, 0xB2, 0xEA, 0xB3, 0x54,
-    0x22, 0xD0, 0xD1, 0xEF, 0xF9, 0x41, 0x81, 0xB2, 0xF5, 0x21, 0xD1, 0xFC, 0x22, 0xBB, 0xBE, 0xF4,
-    0xFD, 0xC2, 0x03, 0x32, 0xD0, 0x2D, 0xFF, 0xFB, 0xB2, 0xDD, 0x42, 0xB2, 0xBA, 0xBB, 0x10, 0xB2,
-    0xEF, 0x42, 0x80, 0x82, 0xB2, 0xE8, 0xF7, 0xD4, 0x22, 0xD0, 0xD1, 0xF2, 0xF9, 0x42, 0xB6, 0xBE,
-    0xB2, 0xDC, 0xB3, 0x20, 0x41, 0x82, 0xB4, 0xD4, 0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0xC2, 0x00, 0x91,
-    0xD0, 0xD1, 0xBB, 0x3D, 0xB5, 0x7D, 0x41, 0xB4, 0xB3, 0x4E, 0x21, 0xD0, 0xFC, 0x21, 0xB7, 0xFD,
-    0xA1, 0x00, 0x91, 0xD0, 0xFD, 0x24, 0xB0, 0xB5, 0xB8, 0xBE, 0xD3, 0xE3, 0xE8, 0xFB, 0x21, 0xD1,
-    0xD6, 0x42, 0x8C, 0x91, 0xB2, 0xD2, 0xFF, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xED, 0xFF, 0xF9,
-    0xB2, 0x86, 0x43, 0xB2, 0xBB, 0xBD, 0xB2, 0xDB, 0xB3, 0x95, 0xB2, 0xDB, 0xC3, 0x02, 0x21, 0xD0,
-    0xD1, 0x2D, 0xFF, 0xF6, 0xB5, 0xD6, 0xB2, 0x72, 0x41, 0xD0, 0xB2, 0xBA, 0x46, 0xB0, 0xB2, 0xB6,
-    0xB8, 0xBB, 0xBE, 0xCE, 0xC7, 0xB3, 0x7B, 0xB2, 0x57, 0xFF, 0xFC, 0xB2, 0xC1, 0xB9, 0xD2, 0x41,
-    0x86, 0xB2, 0xAE, 0xC3, 0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xE9, 0xFF, 0xFC, 0xB2, 0x4B, 0x41,
-    0xD1, 0xC8, 0x42, 0x42, 0xBB, 0xBD, 0xFF, 0xFC, 0xB2, 0x8C, 0x21, 0xD0, 0xF9, 0xA0, 0x0A, 0x21,
-    0x21, 0xBB, 0xFD, 0xA1, 0x05, 0x93, 0xD0, 0xFD, 0x21, 0xBF, 0xFB, 0x42, 0xD0, 0xD1, 0xFF, 0xFD,
-    0xB7, 0x5D, 0x21, 0xBE, 0xF9, 0x21, 0xD0, 0xFD, 0x43, 0xB2, 0xB4, 0xBB, 0xB2, 0x67, 0xB2, 0x67,
-    0xB2, 0x67, 0x21, 0xD0, 0xF6, 0x41, 0xB8, 0xB4, 0xCB, 0xA1, 0x04, 0x82, 0xD0, 0xFC, 0x21, 0xB4,
-    0xFB, 0x21, 0xD0, 0xFD, 0x44, 0xBA, 0xBB, 0xBD, 0xBE, 0xB4, 0x14, 0xB5, 0x46, 0xB2, 0x74, 0xC0,
-    0xF0, 0x42, 0x80, 0x83, 0xB2, 0x1B, 0xB2, 0x3E, 0x22, 0xD0, 0xD1, 0xEC, 0xF9, 0x42, 0xD0, 0xD1,
-    0xC5, 0xAF, 0xC8, 0x91, 0x41, 0xB3, 0xE1, 0xFE, 0xA1, 0x03, 0x91, 0xD0, 0xFC, 0x42, 0xBD, 0xBE,
-    0xB2, 0x1F, 0xFF, 0xFB, 0x21, 0xD0, 0xF9, 0x42, 0xD0, 0xD1, 0xB7, 0x27, 0xC5, 0x5D, 0x42, 0xBD,
-    0xBF, 0xB1, 0xEE, 0xB1, 0xEE, 0x44, 0x80, 0x84, 0x85, 0x86, 0xB5, 0x05, 0xB5, 0x05, 0xB1, 0xE7,
-    0xB5, 0x05, 0x22, 0xD0, 0xD1, 0xEC, 0xF3, 0x4C, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB9, 0xBA,
-    0xBC, 0xBD, 0xBE, 0xBF, 0xB3, 0x5E, 0xFF, 0x73, 0xFF, 0x8E, 0xFF, 0x9B, 0xFF, 0xAA, 0xFF, 0xC1,
-    0xC8, 0x5B, 0xFF, 0xC6, 0xFF, 0xDD, 0xFF, 0xE0, 0xFF, 0xFB, 0xC5, 0x41, 0x41, 0xD0, 0xE9, 0x23,
-    0x43, 0xBA, 0xBB, 0xBF, 0xFF, 0xFC, 0xB1, 0xAC, 0xB4, 0xCA, 0x41, 0xBC, 0xC8, 0xAA, 0x21, 0xD0,
-    0xFC, 0x43, 0x81, 0x82, 0x87, 0xFF, 0xFD, 0xF7, 0x99, 0xB1, 0x9B, 0x22, 0xD0, 0xD1, 0xE5, 0xF6,
-    0x41, 0x82, 0xBD, 0x75, 0x21, 0xD1, 0xFC, 0x21, 0x87, 0xFD, 0x21, 0xD1, 0xFD, 0x46, 0x80, 0x81,
-    0x82, 0x83, 0x87, 0x88, 0xBA, 0x2D, 0xFF, 0xEE, 0xE4, 0xA9, 0xFF, 0xFD, 0xCF, 0x9D, 0xC5, 0x5E,
-    0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xB3, 0x58, 0xFF, 0x97, 0xFF, 0xED, 0xB1, 0x3E, 0x42, 0xBC, 0xBD,
-    0xB1, 0x4C, 0xB1, 0x4C, 0x42, 0x2E, 0xD0, 0xB1, 0x45, 0xFF, 0xF9, 0x42, 0xB0, 0xB4, 0xFF, 0xF9,
-    0xB1, 0xA7, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xB1, 0x1C, 0x42, 0xB2, 0xBE, 0xC7, 0x0B, 0xB1, 0x5A,
-    0xC2, 0x02, 0x21, 0xD0, 0x2D, 0xFF, 0xF9, 0xB1, 0x0E, 0xC1, 0x01, 0xE1, 0xD1, 0xC1, 0x86, 0x43,
-    0xB8, 0xBB, 0xBD, 0xB1, 0xD4, 0xB2, 0x6E, 0xB9, 0xDB, 0x21, 0xD0, 0xF6, 0x42, 0xD0, 0xD1, 0xCD,
-    0x5F, 0xB4, 0x41, 0x42, 0xD0, 0xD1, 0xD3, 0xD9, 0xBC, 0xCA, 0x41, 0x87, 0xB9, 0xC0, 0x42, 0xD0,
-    0xD1, 0xEB, 0x00, 0xFF, 0xFC, 0xC1, 0x00, 0xA1, 0xD1, 0xDE, 0xF9, 0x42, 0x81, 0x82, 0xB1, 0x24,
-    0xB1, 0x01, 0x42, 0xD0, 0xD1, 0xD3, 0xC1, 0xFF, 0xF9, 0x4B, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5,
-    0xB7, 0xBA, 0xBC, 0xBD, 0xBE, 0xB1, 0x0D, 0xFF, 0xC0, 0xEA, 0xE9, 0xFF, 0xD0, 0xFF, 0xD3, 0xFF,
-    0xDA, 0xDC, 0xAC, 0xB9, 0xFA, 0xFF, 0xE5, 0xFF, 0xEC, 0xFF, 0xF9, 0x42, 0xB1, 0xBF, 0xB0, 0xEB,
-    0xB1, 0x78, 0x41, 0x82, 0xDB, 0xF7, 0xA2, 0x03, 0x12, 0xD0, 0xD1, 0xF5, 0xFC, 0x41, 0xB8, 0xC4,
-    0xBB, 0x21, 0xD0, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x49, 0x80, 0x81, 0x82, 0x83, 0x84,
-    0x85, 0x86, 0x88, 0x8D, 0xB9, 0x60, 0xFF, 0xEC, 0xD4, 0xD1, 0xB2, 0x9E, 0xC1, 0x09, 0xB4, 0x79,
-    0xB2, 0x9E, 0xB2, 0x9E, 0xFF, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xA3, 0xFF, 0xE4, 0xB0, 0x68,
-    0x42, 0xB2, 0xBB, 0xB0, 0xBD, 0xB1, 0x77, 0xC3, 0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xF9, 0xB9,
-    0x24, 0xB0, 0x57, 0x43, 0x8C, 0x8E, 0x8F, 0xB0, 0xAA, 0xB0, 0xA7, 0xB0, 0x66, 0xC2, 0x04, 0xC3,
-    0xD1, 0x2D, 0xFF, 0xF6, 0xB0, 0x41, 0xC2, 0x02, 0x21, 0xD1, 0x2D, 0xD1, 0x5B, 0xB0, 0x38, 0x41,
-    0x81, 0xFD, 0xFE, 0x21, 0xD1, 0xFC, 0x42, 0xD0, 0xD1, 0xCE, 0x8D, 0xB0, 0xD1, 0x41, 0xD0, 0xE6,
-    0xD4, 0x21, 0x81, 0xFC, 0x21, 0xD1, 0xFD, 0xA0, 0x0C, 0x73, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x24, 0xB0, 0xB5, 0xBE,
-    0xB8, 0xD7, 0xDA, 0xE8, 0xFD, 0xC2, 0x03, 0x32, 0xD0, 0x2D, 0xFF, 0xF7, 0xAF, 0xF9, 0x41, 0x8E,
-    0xB0, 0x41, 0x21, 0xD1, 0xFC, 0x21, 0xB5, 0xFD, 0x42, 0xD1, 0xD0, 0xB0, 0x07, 0xFF, 0xFD, 0x21,
-    0xBB, 0xF9, 0x42, 0xD0, 0xD1, 0xFF, 0xFD, 0xB3, 0x2B, 0x41, 0xBB, 0xB1, 0xEF, 0x21, 0xD0, 0xFC,
-    0x21, 0xBE, 0xFD, 0x41, 0x80, 0xB4, 0x3C, 0x22, 0xD0, 0xD1, 0xF9, 0xFC, 0xC2, 0x01, 0x31, 0xD0,
-    0xD1, 0xBF, 0x1A, 0xD5, 0x70, 0x44, 0xB2, 0xB7, 0xBB, 0xBE, 0xAF, 0xE7, 0xB8, 0x95, 0xFF, 0xF7,
-    0xDE, 0x26, 0x42, 0x80, 0x8C, 0xAF, 0xDA, 0xB1, 0xC6, 0x22, 0xD0, 0xD1, 0xEC, 0xF9, 0x42, 0xBB,
-    0xBC, 0xAF, 0xF1, 0xAF, 0xF1, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xD2, 0x58, 0x41, 0xD1, 0xDA, 0xBC,
-    0x42, 0xB0, 0xB2, 0xFF, 0xFC, 0xB2, 0xDA, 0x42, 0x80, 0x8B, 0xAF, 0xB5, 0xB9, 0x9F, 0x22, 0xD0,
-    0xD1, 0xF2, 0xF9, 0x41, 0xD1, 0xD5, 0xAC, 0x41, 0xBE, 0xBF, 0x07, 0x42, 0xD0, 0xD1, 0xFF, 0xFC,
-    0xDA, 0x9D, 0x42, 0x81, 0x86, 0xB1, 0x86, 0xB1, 0x86, 0x21, 0xD1, 0xF9, 0x21, 0xB8, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0xBE, 0xCA, 0x21, 0xD0, 0xFD, 0x42, 0xB6, 0xBF, 0xB1, 0x70, 0xB1, 0x70, 0x21,
-    0xD0, 0xF9, 0x42, 0xB0, 0xBE, 0xFF, 0xFD, 0xDF, 0x29, 0x21, 0xD0, 0xF9, 0x41, 0xBF, 0xC2, 0x93,
-    0x21, 0xD0, 0xFC, 0x41, 0xD1, 0xAF, 0x5C, 0x21, 0xBB, 0xFC, 0x42, 0xD0, 0xD1, 0xFF, 0xFD, 0xB5,
-    0x7A, 0x4D, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFF,
-    0x51, 0xB3, 0x91, 0xFF, 0x66, 0xFF, 0x88, 0xFF, 0x94, 0xFF, 0xAD, 0xFF, 0xB2, 0xFF, 0xBA, 0xFF,
-    0xCE, 0xFF, 0xD4, 0xFF, 0xE8, 0xFF, 0xEF, 0xFF, 0xF9, 0x42, 0xB3, 0xB6, 0xB8, 0x8A, 0xB2, 0x51,
-    0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xB4, 0x6E, 0xC2, 0x01, 0x31, 0xD0, 0xD1, 0xAF, 0xFC, 0xC2, 0xE1,
-    0x44, 0xBA, 0xBB, 0xBC, 0xBF, 0xFF, 0xF7, 0xB1, 0x08, 0xAF, 0x1C, 0xB2, 0x3A, 0x43, 0x84, 0x88,
-    0x8E, 0xAF, 0x32, 0xB0, 0xFB, 0xB0, 0xFB, 0x22, 0xD0, 0xD1, 0xE9, 0xF6, 0xA0, 0x08, 0x42, 0x42,
-    0xB2, 0xBA, 0xFF, 0xFD, 0xB0, 0xE9, 0x41, 0xD0, 0xC4, 0xED, 0x21, 0x80, 0xFC, 0x22, 0xD0, 0xD1,
-    0xF2, 0xFD, 0xC1, 0x02, 0xB1, 0xD0, 0xC0, 0x67, 0x41, 0xD0, 0xBA, 0x7E, 0x21, 0xB0, 0xFC, 0x42,
-    0xD0, 0xD1, 0xFF, 0xFD, 0xB2, 0x13, 0x42, 0xBB, 0xBD, 0xAE, 0xF9, 0xAE, 0xF0, 0x21, 0xD0, 0xF9,
-    0x49, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x88, 0x8F, 0x91, 0xFF, 0xA0, 0xFF, 0xC7, 0xFF, 0xDD,
-    0xFF, 0xE2, 0xFF, 0xEF, 0xB2, 0x93, 0xFF, 0xFD, 0xFA, 0xFB, 0xC7, 0x12, 0x44, 0x2E, 0xD0, 0xD1,
-    0x2D, 0xB0, 0x9C, 0xFF, 0x55, 0xFF, 0xE4, 0xAE, 0x82, 0x41, 0x8E, 0xAE, 0xD4, 0x42, 0xD0, 0xD1,
-    0xAF, 0xDC, 0xFF, 0xFC, 0x21, 0xBB, 0xF9, 0xC2, 0x02, 0x21, 0xD0, 0x2D, 0xFF, 0xFD, 0xAE, 0x67,
-    0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
-    0xB9, 0xFB, 0x52, 0xFB, 0x81, 0xFB, 0xD8, 0xFB, 0xEC, 0xFC, 0x13, 0xFD, 0x20, 0xFD, 0x42, 0xFD,
-    0x50, 0xFD, 0xF6, 0xFE, 0x07, 0xFE, 0x1D, 0xFE, 0x26, 0xFE, 0x65, 0xFF, 0xDC, 0xFF, 0xF7, 0xB2,
-    0x6D, 0x43, 0xBA, 0xBD, 0xBF, 0xAE, 0x22, 0xAE, 0x8C, 0xAE, 0x22, 0xC1, 0x02, 0xD1, 0xD0, 0xBF,
-    0x06, 0x21, 0xB2, 0xFA, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0xC3, 0x09, 0x62, 0xD0, 0xD1, 0x2D,
-    0xFF, 0xE7, 0xFF, 0xFD, 0xAE, 0x14, 0x41, 0x82, 0xAF, 0x21, 0x42, 0xD0, 0xD1, 0xBA, 0xF8, 0xFF,
-    0xFC, 0x21, 0xBA, 0xF9, 0x21, 0xD0, 0xFD, 0x42, 0xB0, 0xBB, 0xAE, 0x3F, 0xAD, 0xEC, 0xA1, 0x02,
-    0x52, 0xD0, 0xF9, 0x41, 0xB1, 0xAF, 0x04, 0x41, 0x80, 0xEF, 0x40, 0x22, 0xD0, 0xD1, 0xF8, 0xFC,
-    0x44, 0xB0, 0xB2, 0xBC, 0xBE, 0xFF, 0xE4, 0xFF, 0xEE, 0xAE, 0x3D, 0xFF, 0xFB, 0xC1, 0x01, 0x31,
-    0xD0, 0xB2, 0xCC, 0x43, 0xB0, 0xB5, 0xB8, 0xFF, 0xFA, 0xAD, 0xF9, 0xAD, 0xF9, 0x21, 0xD0, 0xF6,
-    0x41, 0xB8, 0xB0, 0xE3, 0x21, 0xD0, 0xFC, 0x42, 0x81, 0x87, 0xB0, 0x45, 0xFF, 0xFD, 0x21, 0xD1,
-    0xF9, 0x41, 0xD1, 0xEF, 0x7B, 0x41, 0x87, 0xAD, 0xD7, 0x21, 0xD1, 0xFC, 0x24, 0x80, 0x83, 0x8C,
-    0x8F, 0xE1, 0xF2, 0xF5, 0xFD, 0xC3, 0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xBB, 0xFF, 0xF7, 0xAD,
-    0x99, 0x41, 0xD0, 0xC5, 0x4A, 0x41, 0xB0, 0xB2, 0x2E, 0x21, 0xD0, 0xFC, 0x41, 0xB9, 0xAF, 0x9C,
-    0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x46, 0xB1, 0xB3, 0xB4, 0xB6, 0xBA, 0xBB,
-    0xFF, 0xE8, 0xF8, 0xCB, 0xFF, 0xF0, 0xFF, 0xFD, 0xAF, 0xA5, 0xAF, 0x8F, 0x42, 0xBA, 0xBB, 0xAD,
-    0xBE, 0xAD, 0x6E, 0x42, 0xD0, 0xD1, 0xAD, 0xD2, 0xC0, 0xA8, 0x21, 0x82, 0xF9, 0x22, 0xD0, 0xD1,
-    0xEF, 0xFD, 0x42, 0xB0, 0xBE, 0xAF, 0x66, 0xAF, 0x66, 0x21, 0xD0, 0xF9, 0x44, 0x81, 0x82, 0x85,
-    0x87, 0xFF, 0xF1, 0xE2, 0x73, 0xFF, 0xFD, 0xBC, 0xD2, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xAF, 0x4F,
-    0xFF, 0xC0, 0xFF, 0xF3, 0xAD, 0x35, 0x41, 0xBD, 0xAE, 0x41, 0x21, 0xD0, 0xFC, 0x41, 0xBE, 0xC3,
-    0x17, 0xA1, 0x01, 0x31, 0xD0, 0xFC, 0x41, 0xBF, 0xAE, 0x31, 0x21, 0xD0, 0xFC, 0x44, 0xB2, 0xB8,
-    0xBB, 0xBE, 0xAD, 0x70, 0xFF, 0xED, 0xFF, 0xF4, 0xFF, 0xFD, 0xC3, 0x02, 0x21, 0xD0, 0xD1, 0x2D,
-    0xFF, 0xF3, 0xAE, 0xB7, 0xAD, 0x04, 0xC2, 0x02, 0x21, 0xD0, 0x2D, 0xC1, 0xF7, 0xAC, 0xF8, 0x42,
-    0xBB, 0xBC, 0xAD, 0x4E, 0xAD, 0x4E, 0xC2, 0x03, 0x32, 0xD0, 0x2D, 0xFF, 0xF9, 0xAC, 0xE8, 0xC3,
-    0x02, 0x21, 0xD0, 0xD1, 0x2D, 0xEF, 0x31, 0xAF, 0xB8, 0xAC, 0xDF, 0x45, 0xB1, 0xB4, 0xB7, 0xBA,
-    0xBC, 0xAE, 0xED, 0xB3, 0xBE, 0xAD, 0xA8, 0xB1, 0x37, 0xAE, 0xED, 0x42, 0x81, 0x85, 0xFE, 0x0D,
-    0xAE, 0x7D, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xAE, 0xD6, 0xFF, 0xE9, 0xFF, 0xF9, 0xAC, 0xBC, 0x43,
-    0xB5, 0xB8, 0xBA, 0xAE, 0xC9, 0xAE, 0xC9, 0xAD, 0x84, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xAD, 0x7A,
-    0xFF, 0xF6, 0xBC, 0x3F, 0xAC, 0xA5, 0x42, 0xD0, 0x2D, 0xB0, 0x89, 0xAC, 0x98, 0xC3, 0x00, 0xA1,
-    0x2E, 0xD1, 0x2D, 0xAE, 0xAB, 0xDA, 0xB1, 0xAC, 0x91, 0x41, 0x8E, 0xAE, 0x9F, 0x43, 0xD0, 0xD1,
-    0x2D, 0xEB, 0x17, 0xFF, 0xFC, 0xAC, 0x81, 0x43, 0xBA, 0xBD, 0xBE, 0xAE, 0x91, 0xAC, 0xF1, 0xBB,
-    0x6D, 0x42, 0xD0, 0xD1, 0xFF, 0xF6, 0xC9, 0xF7, 0x41, 0xD0, 0xDF, 0xE7, 0x44, 0xB7, 0xBA, 0xBC,
-    0xBD, 0xFF, 0xF5, 0xC3, 0x16, 0xFF, 0xFC, 0xDB, 0xD2, 0x41, 0x82, 0xF2, 0x81, 0x21, 0xD1, 0xFC,
-    0x21, 0x81, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE9, 0xFF, 0xFD, 0xAC, 0x4B, 0x51, 0x80, 0x81,
-    0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xB3,
-    0x74, 0xFE, 0x2D, 0xFE, 0xA8, 0xFF, 0x0C, 0xE4, 0xEF, 0xFF, 0x3D, 0xFF, 0x49, 0xFF, 0x59, 0xFF,
-    0x62, 0xB4, 0x03, 0xCE, 0x85, 0xFF, 0x85, 0xFF, 0x9C, 0xFF, 0xA9, 0xFF, 0xB0, 0xFF, 0xC0, 0xFF,
-    0xF6, 0x42, 0xD0, 0xD1, 0xFD, 0xAF, 0xFF, 0xCC, 0x41, 0xBF, 0xB5, 0x8B, 0x21, 0xD0, 0xFC, 0x21,
-    0x8C, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xBF, 0xAC, 0x3E, 0x21, 0xD0, 0xFC, 0x45, 0xB1, 0xB4, 0xBA,
-    0xBB, 0xBF, 0xB0, 0x56, 0xF3, 0xCD, 0xB8, 0x4C, 0xFF, 0xF6, 0xFF, 0xFD, 0x41, 0xBA, 0xB5, 0x67,
-    0x21, 0xD0, 0xFC, 0x42, 0xD0, 0xD1, 0xE2, 0x71, 0xAD, 0x8E, 0x45, 0x80, 0x82, 0x83, 0x84, 0x85,
-    0xFF, 0xF6, 0xFF, 0xF9, 0xBF, 0x06, 0xB2, 0xC2, 0xAF, 0x20, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D,
-    0xFF, 0xD2, 0xFF, 0xF0, 0xAB, 0xC4, 0x41, 0xBE, 0xC6, 0x12, 0xA1, 0x0A, 0x53, 0xD0, 0xFC, 0x21,
-    0xB7, 0xFB, 0x41, 0x81, 0xAF, 0x85, 0x22, 0xD0, 0xD1, 0xF9, 0xFC, 0x21, 0xB5, 0xFB, 0xA0, 0x0C,
-    0xA2, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x83, 0xFD, 0x21, 0xD1, 0xFD, 0x44, 0x83, 0x8B,
-    0x8E, 0x80, 0xB3, 0xFC, 0xAB, 0xF0, 0xAC, 0x66, 0xFF, 0xFD, 0xC3, 0x0A, 0x32, 0xD0, 0xD1, 0x2D,
-    0xFF, 0xE1, 0xFF, 0xF3, 0xAB, 0x84, 0x41, 0xB5, 0xED, 0x43, 0xC2, 0x03, 0xE2, 0xD0, 0x2D, 0xFF,
-    0xFC, 0xAB, 0x74, 0x43, 0xB8, 0xBD, 0xBE, 0xAB, 0xCA, 0xAB, 0xCA, 0xAB, 0xCA, 0xC2, 0x01, 0xB1,
-    0xD0, 0x2D, 0xFF, 0xF6, 0xAB, 0x61, 0x44, 0xB0, 0xB5, 0xB8, 0xBE, 0xAB, 0xB7, 0xAB, 0xB7, 0xAB,
-    0x73, 0xAB, 0xB7, 0xC3, 0x0A, 0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xF3, 0xAC, 0x45, 0xAB, 0x4B, 0x42,
-    0xB2, 0xBB, 0xAB, 0x6D, 0xAB, 0x9B, 0x42, 0x80, 0x81, 0xAC, 0xF2, 0xF9, 0x07, 0x22, 0xD0, 0xD1,
-    0xF2, 0xF9, 0x44, 0xB3, 0xB7, 0xBA, 0xBC, 0xB7, 0x8D, 0xAE, 0x78, 0xFF, 0xFB, 0xD3, 0xDA, 0x41,
-    0xB1, 0xAE, 0x0A, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xB0, 0xB5, 0xAB,
-    0x5A, 0xAB, 0x5A, 0x42, 0x80, 0x91, 0xAD, 0x99, 0xAB, 0x53, 0xA2, 0x01, 0xB1, 0xD0, 0xD1, 0xF2,
-    0xF9, 0x21, 0x82, 0xF9, 0x42, 0xD0, 0xD1, 0xAF, 0x4D, 0xFF, 0xFD, 0x22, 0x80, 0x81, 0xDE, 0xF9,
-    0xC3, 0x03, 0xE2, 0xD0, 0xD1, 0x2D, 0xFF, 0xC2, 0xFF, 0xFB, 0xAA, 0xEE, 0x42, 0xBC, 0xBF, 0xAB,
-    0x10, 0xAB, 0x10, 0x21, 0xD0, 0xF9, 0x43, 0xB7, 0xBE, 0xBF, 0xB2, 0x24, 0xFF, 0xFD, 0xAF, 0x3C,
-    0xC3, 0x03, 0xE2, 0xD0, 0xD1, 0x2D, 0xFF, 0xF6, 0xAF, 0xE7, 0xAA, 0xCE, 0x42, 0xBC, 0xBD, 0xAB,
-    0x97, 0xC5, 0x90, 0x42, 0x84, 0x85, 0xB2, 0xF7, 0xAB, 0x90, 0x22, 0xD0, 0xD1, 0xF2, 0xF9, 0x41,
-    0xBD, 0xFE, 0x49, 0x21, 0xD0, 0xFC, 0xC1, 0x00, 0xA1, 0xD0, 0xD5, 0xFF, 0x21, 0x8F, 0xFA, 0xA1,
-    0x01, 0xB1, 0xD1, 0xFD, 0x41, 0xB0, 0xAB, 0x6F, 0xA1, 0x00, 0x91, 0xD0, 0xFC, 0x42, 0xBD, 0xBF,
-    0xFF, 0xFB, 0xB7, 0xC1, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xF0, 0xCC, 0x46, 0xB0, 0xB2, 0xB8, 0xBB,
-    0xBD, 0xBE, 0xFF, 0xCF, 0xD3, 0x98, 0xFF, 0xD8, 0xFF, 0xE4, 0xAB, 0x58, 0xFF, 0xF9, 0x41, 0xB1,
-    0xAB, 0x45, 0x21, 0xD0, 0xFC, 0x42, 0xB0, 0xB8, 0xAA, 0xAE, 0xFF, 0xFD, 0xA1, 0x01, 0xB1, 0xD0,
-    0xF9, 0x42, 0xD0, 0xD1, 0xC0, 0x00, 0xC0, 0x04, 0x43, 0x80, 0x81, 0x83, 0xFF, 0xF4, 0xAA, 0x84,
-    0xFF, 0xF9, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xCB, 0x7A, 0xFF, 0xC9, 0xFF, 0xF6, 0xAA, 0x4C, 0x43,
-    0xB2, 0xB4, 0xBC, 0xAC, 0x59, 0xAC, 0x59, 0xAA, 0x84, 0x41, 0x8F, 0xB2, 0xA0, 0x43, 0x2E, 0xD0,
-    0xD1, 0xB2, 0x9C, 0xFF, 0xF2, 0xFF, 0xFC, 0x44, 0xB2, 0xB5, 0xB9, 0xBE, 0xAA, 0x42, 0xAA, 0x42,
-    0xAA, 0x6C, 0xAD, 0x12, 0x42, 0x82, 0x8E, 0xAA, 0x5F, 0xAA, 0x35, 0x22, 0xD0, 0xD1, 0xEC, 0xF9,
-    0x41, 0x86, 0xAA, 0xE3, 0x42, 0x2E, 0xD1, 0xB2, 0x75, 0xFF, 0xFC, 0x41, 0xD1, 0xAA, 0xEB, 0x42,
-    0xB6, 0xBC, 0xAA, 0x5E, 0xFF, 0xFC, 0x41, 0x81, 0xB2, 0x63, 0x43, 0x2E, 0xD0, 0xD1, 0xB2, 0x5F,
-    0xFF, 0xF5, 0xFF, 0xFC, 0x24, 0xB0, 0xB5, 0xB8, 0xBE, 0xB9, 0xD7, 0xE0, 0xF6, 0x41, 0x8E, 0xB2,
-    0x4C, 0x21, 0xD1, 0xFC, 0x43, 0xB5, 0xB9, 0xBC, 0xB2, 0x45, 0xB2, 0x45, 0xB2, 0x45, 0x21, 0xD0,
-    0xF6, 0x46, 0x83, 0x8B, 0x8C, 0x8E, 0x8F, 0x91, 0xFF, 0xF0, 0xFF, 0xFD, 0xAA, 0xA2, 0xD4, 0x07,
-    0xB2, 0x38, 0xCC, 0x97, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD0, 0xFF, 0xED, 0xA9, 0xBA, 0x42, 0x81,
-    0x8F, 0xAB, 0xCA, 0xBC, 0x74, 0x21, 0xD1, 0xF9, 0x21, 0xB5, 0xFD, 0x41, 0xD1, 0xEC, 0xC3, 0x21,
-    0x83, 0xFC, 0xC3, 0x00, 0xA1, 0xD0, 0xD1, 0x2D, 0xFF, 0xF6, 0xFF, 0xFD, 0xA9, 0x9C, 0x41, 0xB1,
-    0xB1, 0xCC, 0x42, 0x81, 0x8F, 0xA9, 0xEB, 0xAA, 0x61, 0x22, 0xD0, 0xD1, 0xF5, 0xF9, 0x41, 0xB6,
-    0xB1, 0xBC, 0x21, 0xD0, 0xFC, 0x41, 0xD0, 0xEE, 0xDB, 0xC1, 0x02, 0x21, 0xD0, 0xD4, 0x88, 0x24,
-    0xB0, 0xB5, 0xB8, 0xBE, 0xEA, 0xF3, 0xF6, 0xFA, 0x42, 0x83, 0x8B, 0xBA, 0x77, 0xB1, 0xD1, 0xC3,
-    0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xF0, 0xFF, 0xF9, 0xA9, 0x5F, 0x41, 0xB3, 0xAC, 0x9F, 0x21,
-    0xD0, 0xFC, 0x46, 0xB1, 0xB2, 0xB4, 0xB7, 0xBB, 0xBC, 0xAC, 0x9E, 0xDB, 0x8E, 0xA9, 0x7A, 0xAC,
-    0x98, 0xFF, 0xFD, 0xB2, 0x28, 0x41, 0xB8, 0xA9, 0xBA, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xAE, 0xA5,
-    0x42, 0xBA, 0xBF, 0xA9, 0x5C, 0xAC, 0x7A, 0x41, 0x80, 0xE9, 0x16, 0x21, 0xD1, 0xFC, 0x42, 0x8C,
-    0x82, 0xA9, 0x15, 0xFF, 0xFD, 0x22, 0xD0, 0xD1, 0xEB, 0xF9, 0x41, 0xB0, 0xB8, 0x86, 0x21, 0xD0,
-    0xFC, 0x21, 0xBA, 0xFD, 0x42, 0xD1, 0xD0, 0xB2, 0x32, 0xFF, 0xFD, 0x45, 0x80, 0x81, 0x82, 0x87,
-    0x88, 0xFF, 0xCE, 0xFF, 0xEA, 0xFF, 0xF9, 0xAC, 0xF8, 0xCB, 0xF5, 0xC3, 0x02, 0xB1, 0xD0, 0xD1,
-    0x2D, 0xFF, 0xA7, 0xFF, 0xF0, 0xA8, 0xF3, 0x43, 0xB5, 0xBB, 0xBD, 0xA9, 0x46, 0xA9, 0x46, 0xA9,
-    0x46, 0x44, 0x85, 0x86, 0x88, 0x8E, 0xA9, 0x3C, 0xB1, 0x19, 0xA9, 0x3C, 0xA9, 0x3C, 0x22, 0xD0,
-    0xD1, 0xE9, 0xF3, 0x41, 0x81, 0xDC, 0xE5, 0x42, 0xD0, 0xD1, 0xBD, 0x24, 0xFF, 0xFC, 0x42, 0xB7,
-    0xBB, 0xA9, 0x66, 0xA9, 0x95, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xB5, 0xE5, 0x45, 0xB0, 0xB5, 0xB8,
-    0xBD, 0xBE, 0xBD, 0xB5, 0xFF, 0xE2, 0xFF, 0xEB, 0xA8, 0xCD, 0xFF, 0xF9, 0xC3, 0x01, 0xB1, 0xD0,
-    0xD1, 0x2D, 0xFF, 0xF0, 0xB9, 0x59, 0xA8, 0xA2, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6,
-    0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB9, 0xFC, 0xD2, 0xFD, 0x12, 0xFD, 0x22, 0xFD,
-    0x35, 0xFD, 0x4B, 0xFD, 0xA8, 0xB8, 0x53, 0xAF, 0x3C, 0xFD, 0xC8, 0xFE, 0x4A, 0xFE, 0xDC, 0xFE,
-    0xFA, 0xFF, 0x37, 0xFF, 0xA3, 0xFF, 0xF4, 0xAC, 0xA5, 0x42, 0x81, 0x82, 0xA8, 0xB6, 0xA8, 0xAA,
-    0x42, 0xD0, 0xD1, 0xB5, 0x49, 0xFF, 0xF9, 0x42, 0xB1, 0xB4, 0xB2, 0x49, 0xC7, 0x47, 0x21, 0xD0,
-    0xF9, 0x22, 0xB0, 0xB5, 0xEF, 0xFD, 0xC3, 0x02, 0xB1, 0x2E, 0xD0, 0x2D, 0xA9, 0x1D, 0xFF, 0xFB,
-    0xA8, 0x48, 0xA0, 0x0A, 0x82, 0xC1, 0x00, 0xA1, 0xD0, 0xA8, 0xC0, 0x41, 0x80, 0xA8, 0xE8, 0x21,
-    0xD1, 0xFC, 0x49, 0xB0, 0xB1, 0xB2, 0xB8, 0xBA, 0xBB, 0xBD, 0xBE, 0xBF, 0xD9, 0x2F, 0xA8, 0x8B,
-    0xA8, 0x7A, 0xFF, 0xF0, 0xA8, 0xB0, 0xA8, 0x21, 0xFF, 0xF3, 0xFF, 0xFD, 0xA8, 0x21, 0x42, 0x82,
-    0x87, 0xA8, 0x61, 0xA8, 0x05, 0xC3, 0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xDD, 0xFF, 0xF9, 0xA8,
-    0x09, 0x43, 0xB5, 0xBB, 0xBE, 0xA9, 0xB4, 0xA8, 0xD2, 0xAC, 0x61, 0x43, 0x2E, 0xD0, 0xD1, 0xC9,
-    0x21, 0xFF, 0xF6, 0xAC, 0xF2, 0xA0, 0x0A, 0xA2, 0x43, 0xB9, 0xBB, 0xBD, 0xAA, 0x00, 0xAA, 0x00,
-    0xB3, 0x8D, 0x41, 0xB5, 0xA7, 0xF7, 0x42, 0x2E, 0xD0, 0xA7, 0xF3, 0xFF, 0xFC, 0x43, 0x82, 0x85,
-    0x88, 0xFF, 0xF9, 0xA7, 0xDD, 0xA7, 0xEC, 0xA3, 0x00, 0xA1, 0x2E, 0xD0, 0xD1, 0xDE, 0xE1, 0xF6,
-    0x42, 0x84, 0x8A, 0xA8, 0x93, 0xA8, 0x93, 0x42, 0xD0, 0xD1, 0xB3, 0x78, 0xFF, 0xF9, 0x44, 0xB5,
-    0xB8, 0xBC, 0xBD, 0xA8, 0x0F, 0xA8, 0x0F, 0xDB, 0x49, 0xFF, 0xF9, 0x43, 0x87, 0x88, 0x8E, 0xA8,
-    0x02, 0xE2, 0x47, 0xA8, 0x02, 0xA2, 0x02, 0xB1, 0xD0, 0xD1, 0xE9, 0xF6, 0xC2, 0x02, 0x21, 0xD0,
-    0xD1, 0xAB, 0xF2, 0xAA, 0x6B, 0x43, 0xB0, 0xB5, 0xB8, 0xA7, 0x7E, 0xA8, 0x0D, 0xFF, 0xF7, 0x42,
-    0x8F, 0x91, 0xA8, 0x54, 0xA8, 0x03, 0x22, 0xD0, 0xD1, 0xEF, 0xF9, 0xC1, 0x02, 0xB1, 0xD0, 0xBE,
-    0xAC, 0x49, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB8, 0xBA, 0xBC, 0xBD, 0xD3, 0x24, 0xA9, 0x87, 0xFF,
-    0xFA, 0xA9, 0x87, 0xA9, 0x87, 0xB4, 0x14, 0xA9, 0x87, 0xA9, 0x87, 0xA9, 0x87, 0x42, 0xB3, 0xB6,
-    0xA8, 0x26, 0xA8, 0x26, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xA9, 0x76, 0x45, 0x80, 0x81, 0x82, 0x86,
-    0x8E, 0xFF, 0xF9, 0xA9, 0x5D, 0xA9, 0x5D, 0xA7, 0xA2, 0xA9, 0x5D, 0x43, 0x2E, 0xD0, 0xD1, 0xA9,
-    0x4D, 0xFF, 0xC6, 0xFF, 0xF0, 0x4B, 0xB0, 0xB1, 0xB2, 0xB5, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE,
-    0xBF, 0xB2, 0xD0, 0xA7, 0xFE, 0xFF, 0x36, 0xFF, 0x62, 0xFF, 0x90, 0xA7, 0xFE, 0xFF, 0xB1, 0xA7,
-    0xFE, 0xA7, 0xFE, 0xFF, 0xF6, 0xA7, 0xFE, 0x42, 0x81, 0x8F, 0xBB, 0x31, 0xC8, 0x35, 0x21, 0xD1,
-    0xF9, 0x42, 0xB4, 0xB9, 0xA7, 0xD2, 0xA7, 0x2B, 0x21, 0xD0, 0xF9, 0x43, 0xB2, 0xB7, 0xBB, 0xA7,
-    0xC8, 0xA7, 0x21, 0xA7, 0xC8, 0x41, 0x89, 0xA7, 0xBE, 0x22, 0xD0, 0xD1, 0xF2, 0xFC, 0x43, 0xB0,
-    0xB2, 0xB4, 0xA7, 0x0E, 0xC6, 0x0E, 0xA7, 0x0E, 0x42, 0xD0, 0xD1, 0xFF, 0xF6, 0xAB, 0xEF, 0x24,
-    0xB0, 0xB5, 0xB8, 0xBE, 0xCF, 0xD9, 0xEA, 0xF9, 0x42, 0xD0, 0xD1, 0xBC, 0xAF, 0xC4, 0x87, 0x21,
-    0x83, 0xF9, 0x43, 0x2E, 0xD0, 0xD1, 0xA7, 0x91, 0xFF, 0xED, 0xFF, 0xFD, 0x42, 0x82, 0x8E, 0xA6,
-    0xF7, 0xA8, 0xCC, 0x21, 0xD1, 0xF9, 0xC1, 0x02, 0xB1, 0xD0, 0xBB, 0xA7, 0x44, 0x81, 0x8E, 0x8F,
-    0x82, 0xA7, 0x77, 0xAD, 0xEE, 0xA8, 0xBC, 0xA7, 0x77, 0xC2, 0x03, 0xD1, 0x2E, 0xD1, 0xA7, 0x6A,
-    0xFF, 0xF3, 0x41, 0xBC, 0xA8, 0xA6, 0x41, 0x85, 0xA8, 0xA2, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x41,
-    0x2E, 0xA7, 0x54, 0x21, 0xB5, 0xFC, 0x21, 0xD0, 0xFD, 0x42, 0xBB, 0xBD, 0xA8, 0x8F, 0xB2, 0x1C,
-    0xC2, 0x00, 0xA1, 0xD0, 0xD1, 0xFF, 0xF9, 0xFE, 0x9D, 0x4A, 0x80, 0x81, 0x83, 0x84, 0x86, 0x8B,
-    0x8C, 0x8F, 0x87, 0x91, 0xFF, 0xA9, 0xA7, 0x3A, 0xFF, 0xBA, 0xA7, 0x3A, 0xA7, 0x3A, 0xFF, 0xBD,
-    0xFF, 0xD0, 0xFF, 0xE1, 0xFF, 0xED, 0xFF, 0xF7, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xA7, 0x1B, 0xFF,
-    0x1D, 0xFF, 0xE1, 0xA6, 0x46, 0x42, 0xB0, 0xBE, 0xA6, 0xDF, 0xA6, 0x95, 0xA1, 0x01, 0xB1, 0xD0,
-    0xF9, 0x41, 0xB0, 0xA8, 0xBB, 0x21, 0xD0, 0xFC, 0x41, 0xB5, 0xA9, 0x11, 0x21, 0xD0, 0xFC, 0x48,
-    0xB1, 0xB2, 0xB3, 0xB5, 0xB7, 0xBA, 0xBC, 0xBF, 0xFF, 0xED, 0xA6, 0x4D, 0xBA, 0x2C, 0xAD, 0x0A,
-    0xA6, 0x14, 0xA7, 0xD6, 0xFF, 0xF6, 0xFF, 0xFD, 0x42, 0xBB, 0xBF, 0xA6, 0x12, 0xA6, 0x12, 0x42,
-    0xD0, 0xD1, 0xFF, 0xF9, 0xAC, 0x5A, 0x44, 0x81, 0x82, 0x84, 0x85, 0xFF, 0xF9, 0xAC, 0x04, 0xB3,
-    0x5D, 0xA6, 0x26, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xCC, 0xFF, 0xF3, 0xA5, 0xEB, 0x41,
-    0xB5, 0xAE, 0x1B, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xA5, 0xDB, 0xC2, 0x00, 0x92, 0xD0, 0x2D, 0xFF,
-    0xF5, 0xA5, 0xD4, 0x41, 0xD0, 0xE6, 0x33, 0x21, 0xBD, 0xFC, 0x21, 0xD0, 0xFD, 0x44, 0xB0, 0xB5,
-    0xB8, 0xBE, 0xA6, 0x96, 0xFF, 0xFD, 0xAE, 0x2C, 0xA6, 0x96, 0x42, 0xD0, 0x2D, 0xFF, 0xF3, 0xA5,
-    0xB4, 0xC1, 0x02, 0xB1, 0xD1, 0xB2, 0xD9, 0x41, 0xBA, 0xAF, 0x99, 0x21, 0xD0, 0xFC, 0x21, 0x81,
-    0xFD, 0x21, 0xD1, 0xFD, 0x42, 0xB2, 0xBA, 0xA5, 0xB5, 0xA6, 0x6F, 0x42, 0xD0, 0xD1, 0xFF, 0xF9,
-    0xA8, 0x5F, 0x45, 0xB0, 0xB5, 0xB8, 0xBB, 0xBE, 0xFF, 0xDF, 0xFF, 0xEF, 0xFF, 0xF9, 0xA5, 0xD1,
-    0xA6, 0x61, 0x21, 0x91, 0xDF, 0xC3, 0x01, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xED, 0xFF, 0xFD, 0xA5,
-    0x79, 0xC2, 0x01, 0xB1, 0xD0, 0x2D, 0xAD, 0xF9, 0xA5, 0x6D, 0x42, 0xB4, 0xBB, 0xA5, 0x70, 0xA5,
-    0x70, 0x21, 0xD0, 0xF9, 0x21, 0xB5, 0xFD, 0xC3, 0x0A, 0x32, 0xD0, 0x2E, 0x2D, 0xFF, 0xFD, 0xB0,
-    0x2A, 0xA5, 0x57, 0x44, 0xB3, 0xB7, 0xBF, 0xBC, 0xA7, 0x05, 0xA5, 0x40, 0xD8, 0x4B, 0xE5, 0x3A,
-    0x41, 0xBA, 0xD8, 0x31, 0xA1, 0x01, 0xB1, 0xD0, 0xFC, 0x21, 0x81, 0xFB, 0xC3, 0x02, 0xB1, 0xD0,
-    0xD1, 0x2D, 0xFF, 0xE7, 0xFF, 0xFD, 0xA5, 0x32, 0x41, 0x8F, 0xFE, 0xA7, 0x21, 0xD1, 0xFC, 0x45,
-    0x82, 0x8E, 0x8F, 0x81, 0x91, 0xA5, 0xF4, 0xA7, 0x39, 0xA7, 0x39, 0xFF, 0xFD, 0xA7, 0x39, 0x44,
-    0x2E, 0xD0, 0xD1, 0x2D, 0xA5, 0xE4, 0xBD, 0xC8, 0xFF, 0xF0, 0xA5, 0x0F, 0x42, 0x80, 0x81, 0xA5,
-    0x30, 0xA5, 0x61, 0x42, 0xD1, 0x2D, 0xFF, 0xF9, 0xA4, 0xFB, 0xC2, 0x03, 0xE2, 0xD1, 0x2D, 0xAD,
-    0xC1, 0xA4, 0xF4, 0x41, 0x82, 0xDA, 0x1C, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xAA, 0x60, 0xFF,
-    0xFC, 0xA4, 0xE7, 0x41, 0xBA, 0xF4, 0xB0, 0x41, 0xD1, 0xBF, 0xC0, 0x21, 0x81, 0xFC, 0xC3, 0x03,
-    0xE2, 0xD0, 0xD1, 0x2D, 0xFF, 0xF5, 0xFF, 0xFD, 0xA4, 0xD0, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84,
-    0x85, 0x86, 0x87, 0x88, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x89, 0xFC, 0x7C, 0xFC, 0xBB,
-    0xFE, 0x7E, 0xFE, 0xD9, 0xFE, 0xE9, 0xFE, 0xF0, 0xFF, 0x10, 0xFF, 0x4B, 0xFF, 0x57, 0xFF, 0x6D,
-    0xFF, 0x92, 0xFF, 0xB5, 0xFF, 0xC9, 0xFF, 0xD0, 0xFF, 0xDD, 0xFF, 0xF4, 0xA8, 0xD3, 0x42, 0xD0,
-    0xD1, 0xFB, 0xFA, 0xFF, 0xCC, 0x42, 0xD0, 0xD1, 0xA8, 0xE9, 0xAD, 0xB1, 0x41, 0x80, 0xA4, 0xB6,
-    0x21, 0xD1, 0xFC, 0xC1, 0x02, 0xB1, 0xD0, 0xA9, 0x76, 0x41, 0xBB, 0xB2, 0x3C, 0x21, 0xD0, 0xFC,
-    0x47, 0xB1, 0xB2, 0xB3, 0xB7, 0xBA, 0xBD, 0xBF, 0xFF, 0xE5, 0xFF, 0xF0, 0xFF, 0xF3, 0xA7, 0xBA,
-    0xFF, 0xFD, 0xA4, 0xCD, 0xA8, 0xD2, 0xC1, 0x02, 0xB1, 0xD1, 0xAA, 0xB3, 0x43, 0x81, 0x82, 0x89,
-    0xFF, 0xFA, 0xA6, 0x09, 0xA6, 0x6C, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xDA, 0xFF, 0xF6, 0xA4, 0x48,
-    0x42, 0xB9, 0xBB, 0xA4, 0x83, 0xA4, 0x83, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xB6, 0xD8, 0xA0, 0x06,
-    0x42, 0x43, 0xB5, 0xB7, 0xB9, 0xA4, 0x72, 0xFF, 0xFD, 0xAD, 0xB2, 0x43, 0x81, 0x8E, 0x91, 0xA4,
-    0x68, 0xA4, 0xF8, 0xA4, 0x68, 0x22, 0xD0, 0xD1, 0xEC, 0xF6, 0x44, 0xB0, 0xB5, 0xB8, 0xBE, 0xAC,
-    0x7C, 0xFF, 0xDD, 0xA4, 0xE9, 0xFF, 0xFB, 0x41, 0xD0, 0xC1, 0x8D, 0x45, 0x80, 0x83, 0x8B, 0x8F,
-    0x91, 0xAD, 0x88, 0xA4, 0xD8, 0xA4, 0xD8, 0xA4, 0xD8, 0xFF, 0xFC, 0x44, 0x2E, 0xD0, 0xD1, 0x2D,
-    0xA4, 0xC8, 0xFF, 0xDF, 0xFF, 0xF0, 0xA3, 0xF3, 0x42, 0xB0, 0xBB, 0xAB, 0x32, 0xA4, 0x42, 0x41,
-    0x88, 0xAB, 0x2B, 0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0x41, 0xB5, 0xB4, 0x32, 0x21, 0xD0, 0xFC, 0x41,
-    0xB1, 0xAD, 0xC1, 0x21, 0xD0, 0xFC, 0x41, 0xB4, 0xB1, 0x2D, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xA8,
-    0xDD, 0xA0, 0x0A, 0xC2, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x48, 0xB3, 0xB4, 0xB7, 0xBA, 0xBB,
-    0xBC, 0xBE, 0xBF, 0xB6, 0xE6, 0xA3, 0xE2, 0xA8, 0xBC, 0xFF, 0xD9, 0xFF, 0xE2, 0xFF, 0xE9, 0xFF,
-    0xF0, 0xFF, 0xFD, 0x44, 0xB0, 0xB5, 0xB7, 0xBA, 0xA7, 0xF2, 0xB7, 0x94, 0xAA, 0xE7, 0xA3, 0xA7,
-    0x42, 0xD0, 0xD1, 0xFF, 0xF3, 0xEB, 0xEF, 0x43, 0xB0, 0xB8, 0xBE, 0xA3, 0x7C, 0xA5, 0x41, 0xA5,
-    0x41, 0x42, 0xD0, 0xD1, 0xFF, 0xF6, 0xB7, 0x67, 0x21, 0xBA, 0xF9, 0x42, 0xD0, 0xD1, 0xFF, 0xFD,
-    0xB4, 0x06, 0x43, 0x80, 0x81, 0x85, 0xFF, 0xDE, 0xFF, 0xF9, 0xA4, 0xDB, 0xC3, 0x03, 0xE2, 0xD0,
-    0xD1, 0x2D, 0xFF, 0xAE, 0xFF, 0xF6, 0xA3, 0x62, 0x41, 0xBD, 0xA3, 0xD0, 0x21, 0xD0, 0xFC, 0xC1,
-    0x01, 0xE1, 0xD1, 0xBD, 0x0E, 0x41, 0xBC, 0xA6, 0x34, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21,
-    0xD0, 0xFD, 0x43, 0xB2, 0xB4, 0xB6, 0xAC, 0xC1, 0xA3, 0x81, 0xA4, 0x11, 0x41, 0x84, 0xA4, 0x07,
-    0x22, 0xD0, 0xD1, 0xF2, 0xFC, 0x49, 0xB0, 0xB1, 0xB4, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBB,
-    0x9D, 0xA7, 0x8D, 0xAC, 0x05, 0xFF, 0xD7, 0xFF, 0xDA, 0xA3, 0x7A, 0xFF, 0xEA, 0xF7, 0x34, 0xFF,
-    0xFB, 0x42, 0xD0, 0xD1, 0xB6, 0xDB, 0xF2, 0x71, 0x43, 0x81, 0x84, 0x85, 0xFF, 0xF9, 0xC7, 0x53,
-    0xA4, 0xBD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD3, 0xFF, 0xF6, 0xA2, 0xFC, 0x42, 0xB2, 0xBD, 0xAF,
-    0x99, 0xAF, 0x99, 0x21, 0xD0, 0xF9, 0x41, 0x82, 0xAF, 0x8F, 0x21, 0xD1, 0xFC, 0x43, 0xB0, 0xB5,
-    0xBD, 0xFF, 0xF6, 0xFF, 0xFD, 0xAA, 0x2D, 0x21, 0x91, 0xF3, 0xC3, 0x04, 0xC3, 0xD0, 0xD1, 0x2D,
-    0xFF, 0xF3, 0xFF, 0xFD, 0xA2, 0xD4, 0x41, 0xD0, 0xBE, 0xAC, 0x21, 0xBE, 0xFC, 0xC3, 0x03, 0x32,
-    0xD0, 0xD1, 0x2D, 0xFF, 0xFD, 0xA4, 0x86, 0xA2, 0xC1, 0xC1, 0x01, 0xE1, 0xD1, 0xEA, 0xEE, 0x21,
-    0x81, 0xFA, 0x21, 0xD1, 0xFD, 0x21, 0xB8, 0xFD, 0x41, 0x89, 0xA2, 0xC1, 0xC3, 0x01, 0xB1, 0xD0,
-    0xD1, 0x2D, 0xFF, 0xF9, 0xFF, 0xFC, 0xA2, 0xA2, 0x42, 0xB5, 0xBB, 0xC9, 0x4D, 0xA5, 0xE2, 0x41,
-    0x8A, 0xA3, 0x64, 0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0xC1, 0x01, 0x31, 0xD1, 0xC6, 0xCF, 0x41, 0xBC,
-    0xAC, 0x05, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xA4, 0xA8, 0x41, 0xB3, 0xA3, 0x4A, 0x21, 0xD0, 0xFC,
-    0x47, 0xB1, 0xB2, 0xB4, 0xB7, 0xBA, 0xBC, 0xBD, 0xFF, 0xE3, 0xA6, 0xD2, 0xFF, 0xE8, 0xA5, 0xBA,
-    0xAB, 0xA3, 0xFF, 0xF2, 0xFF, 0xFD, 0x42, 0xB3, 0xB6, 0xA4, 0x72, 0xA4, 0x72, 0x43, 0x81, 0x83,
-    0x88, 0xA4, 0x6B, 0xA2, 0x7F, 0xA4, 0x6B, 0x22, 0xD0, 0xD1, 0xEF, 0xF6, 0x42, 0xBD, 0xBF, 0xA5,
-    0x8E, 0xA5, 0x8E, 0x41, 0x86, 0xA5, 0x87, 0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0x42, 0xB4, 0xBA, 0xA3,
-    0x07, 0xA2, 0x7A, 0x21, 0xD0, 0xF9, 0x44, 0x80, 0x81, 0x82, 0x89, 0xFF, 0xE1, 0xFF, 0xF1, 0xFF,
-    0xFD, 0xA4, 0x42, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xAD, 0xFF, 0xF3, 0xA2, 0x1B, 0x41, 0xB0, 0xBA,
-    0x4D, 0xC2, 0x05, 0x22, 0xD0, 0x2D, 0xFF, 0xFC, 0xA2, 0x0D, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4,
-    0xB5, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB9, 0xFD, 0xBC, 0xB5, 0xCC, 0xFE,
-    0x11, 0xA9, 0xC6, 0xA9, 0x37, 0xFE, 0xA2, 0xA9, 0xC6, 0xA9, 0x37, 0xFF, 0x08, 0xFF, 0x30, 0xFF,
-    0x43, 0xFF, 0x62, 0xA9, 0x37, 0xFF, 0xE9, 0xFF, 0xF7, 0xA6, 0x13, 0x42, 0xB3, 0xB6, 0xC5, 0x70,
-    0xAB, 0x58, 0x21, 0xD0, 0xF9, 0xC1, 0x02, 0x21, 0xD0, 0xB5, 0xBE, 0x42, 0x83, 0x8C, 0xA3, 0xDD,
-    0xA2, 0x08, 0x42, 0xD0, 0xD1, 0xB0, 0xE6, 0xFF, 0xF9, 0x42, 0x88, 0x91, 0xA1, 0xFA, 0xA1, 0xFA,
-    0x42, 0xD0, 0xD1, 0xA6, 0xCE, 0xFF, 0xF9, 0x42, 0xB0, 0xBD, 0xA1, 0xEC, 0xA1, 0xEC, 0x21, 0xD0,
-    0xF9, 0x41, 0xBB, 0xA4, 0x2B, 0x21, 0xD0, 0xFC, 0x48, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7,
-    0xBF, 0xA1, 0xDB, 0xFF, 0xDA, 0xFF, 0xE8, 0xA1, 0xDB, 0xA1, 0xDB, 0xA1, 0xDB, 0xFF, 0xF6, 0xFF,
-    0xFD, 0xC2, 0x0A, 0xE2, 0xD0, 0xD1, 0xEA, 0x16, 0xB4, 0x1E, 0x41, 0xD1, 0xD0, 0x21, 0xA0, 0x0B,
-    0x03, 0x46, 0x81, 0x82, 0x85, 0x86, 0x88, 0x8E, 0xFF, 0xF0, 0xFF, 0xF9, 0xFF, 0xFD, 0xA1, 0xB2,
-    0xA3, 0x36, 0xA1, 0xB2, 0x22, 0xD0, 0xD1, 0xC4, 0xED, 0x41, 0xBB, 0xAB, 0x47, 0x21, 0xD0, 0xFC,
-    0x41, 0x81, 0xC2, 0x7C, 0x21, 0xD1, 0xFC, 0x47, 0xB1, 0xB2, 0xB3, 0xBB, 0xBC, 0xBD, 0xBE, 0xA3,
-    0x61, 0xA1, 0x8C, 0xFF, 0xF6, 0xA1, 0x8C, 0xA1, 0x8C, 0xFF, 0xFD, 0xA1, 0xA3, 0x43, 0x82, 0x84,
-    0x89, 0xA1, 0x76, 0xA1, 0x3D, 0xA1, 0x76, 0x22, 0xD0, 0xD1, 0xE0, 0xF6, 0x41, 0xB5, 0xBA, 0x74,
-    0x41, 0x91, 0xBA, 0x70, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x21, 0x82, 0xFB, 0x21, 0xD1, 0xFD, 0x45,
-    0xB3, 0xB8, 0xB9, 0xBF, 0xB5, 0xFD, 0x08, 0xD1, 0xF1, 0xA1, 0xE4, 0xF0, 0xEE, 0xFF, 0xFD, 0x41,
-    0xD0, 0xD4, 0x75, 0x65, 0x80, 0x81, 0x82, 0x86, 0x8E, 0x7F, 0xA1, 0x40, 0x7F, 0xFF, 0xFC, 0x7F,
-    0xA1, 0x07, 0x7F, 0xAE, 0x24, 0x7F, 0xA1, 0xD0, 0x22, 0xD0, 0xD1, 0xD7, 0xEB, 0x4B, 0xB0, 0xB1,
-    0xB2, 0xB3, 0xB4, 0xB5, 0xB8, 0xBC, 0xBD, 0xBE, 0xBF, 0xFF, 0x15, 0xA1, 0xB6, 0xA1, 0xB6, 0xA1,
-    0xB6, 0xFF, 0x18, 0xFF, 0x87, 0xFF, 0xBA, 0xA1, 0xB6, 0xA1, 0xB6, 0xFF, 0xFB, 0xA1, 0xB6, 0x64,
-    0xB1, 0xB4, 0xBA, 0xBC, 0x7F, 0xA2, 0xD9, 0x7F, 0xA1, 0x1E, 0x7F, 0xA1, 0x94, 0x7F, 0xA1, 0x1E,
-    0x42, 0xD0, 0xD1, 0xFF, 0xEF, 0xA3, 0x7A, 0x66, 0xB2, 0xB4, 0xB5, 0xB6, 0xB9, 0xBA, 0x7F, 0xA0,
-    0xEC, 0x7F, 0xAA, 0x2C, 0x7F, 0xA0, 0xEC, 0x7F, 0xA0, 0xEC, 0x7F, 0xA0, 0xEC, 0x7F, 0xA0, 0xC2,
-    0x63, 0x82, 0x89, 0x8F, 0x7F, 0xA0, 0xD3, 0x7F, 0xA0, 0xD3, 0x7F, 0xA0, 0xD3, 0x63, 0x2E, 0xD0,
-    0xD1, 0x7F, 0xA0, 0xC6, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF, 0xF3, 0x42, 0x85, 0x88, 0xFF, 0x04, 0xA2,
-    0x3D, 0x21, 0xD1, 0xF9, 0x68, 0x80, 0x83, 0x84, 0x89, 0x8A, 0x8B, 0x8F, 0x91, 0x7F, 0xA1, 0x3F,
-    0x7F, 0xFF, 0xBC, 0x7F, 0xA1, 0x3F, 0x7F, 0xA1, 0x3F, 0x7F, 0xA1, 0x3F, 0x7F, 0xA0, 0xAF, 0x7F,
-    0xFF, 0xE9, 0x7F, 0xFF, 0xFD, 0x64, 0xD0, 0xD1, 0x2E, 0x2D, 0x7F, 0xFF, 0x68, 0x7F, 0xFF, 0xDF,
-    0x7F, 0xC7, 0x6C, 0x7F, 0xA0, 0x49, 0x41, 0xBF, 0xA3, 0x23, 0x21, 0xD0, 0xFC, 0x65, 0xB1, 0xB4,
-    0xB5, 0xBC, 0xBF, 0x7F, 0xA0, 0x90, 0x7F, 0xB4, 0x95, 0x7F, 0xFF, 0xFD, 0x7F, 0xB4, 0x95, 0x7F,
-    0xB4, 0x95, 0xE2, 0x0B, 0x33, 0xD0, 0x2D, 0x7F, 0xFF, 0xEB, 0x7F, 0xA0, 0x1C, 0xE2, 0x03, 0x32,
-    0xD0, 0x2D, 0x7F, 0xB4, 0x6E, 0x7F, 0xA0, 0x11, 0x41, 0x80, 0xB5, 0x60, 0x21, 0xD1, 0xFC, 0x43,
-    0xB3, 0xB6, 0xBF, 0xA4, 0xA4, 0xE9, 0xBD, 0xFF, 0xFD, 0x42, 0xD0, 0xD1, 0xA3, 0xE6, 0xA6, 0x50,
-    0x42, 0xD0, 0xD1, 0xF2, 0xA2, 0xB3, 0x84, 0x44, 0x81, 0x84, 0x88, 0x89, 0xFF, 0xF2, 0xA4, 0x4B,
-    0xFF, 0xF9, 0xA2, 0x01, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xDB, 0x7F, 0xFF, 0xF3, 0x7F, 0x9F,
-    0xDA, 0xE1, 0x01, 0x91, 0x2D, 0x7F, 0x9F, 0xCD, 0x41, 0x81, 0xF1, 0x10, 0x63, 0xD0, 0xD1, 0x2D,
-    0x7F, 0xAA, 0x3F, 0x7F, 0xFF, 0xFC, 0x7F, 0x9F, 0xC2, 0x63, 0xB5, 0xB8, 0xBC, 0x7F, 0xA7, 0x01,
-    0x7F, 0xA7, 0x01, 0x7F, 0x9F, 0xAA, 0x63, 0x82, 0x8E, 0x91, 0x7F, 0xC0, 0xD6, 0x7F, 0xA0, 0x04,
-    0x7F, 0xA6, 0xF4, 0xE4, 0x02, 0x21, 0x2E, 0xD0, 0xD1, 0x2D, 0x7F, 0xC0, 0xC9, 0x7F, 0xFF, 0xE6,
-    0x7F, 0xFF, 0xF3, 0x7F, 0x9F, 0x9B, 0xE2, 0x00, 0xA1, 0xD1, 0x2D, 0x7F, 0xA5, 0xE3, 0x7F, 0x9F,
-    0x88, 0x43, 0xB3, 0xB6, 0xBF, 0xA1, 0x97, 0xA1, 0x97, 0xA1, 0x97, 0x41, 0x87, 0xB9, 0xB0, 0x63,
-    0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF2, 0x7F, 0xFF, 0xFC, 0x7F, 0x9F, 0x6F, 0x44, 0xB3, 0xB7, 0xBA,
-    0xBF, 0xB2, 0x94, 0xA4, 0x6A, 0xFB, 0x87, 0xFB, 0xAB, 0x41, 0xD0, 0xBB, 0x76, 0x41, 0xD0, 0xFB,
-    0xDB, 0x63, 0x80, 0x81, 0x85, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0x7F, 0xA0, 0xBC, 0xE3, 0x03,
-    0xE2, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xDE, 0x7F, 0xFF, 0xF3, 0x7F, 0x9F, 0x40, 0x51, 0x80, 0x81,
-    0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xFE,
-    0xE8, 0xFF, 0x15, 0xFF, 0x20, 0xFF, 0x57, 0xA6, 0xF3, 0xA6, 0x64, 0xFF, 0x64, 0xA6, 0x64, 0xAA,
-    0xA3, 0xA6, 0xF3, 0xC1, 0x75, 0xFF, 0x6F, 0xFF, 0x96, 0xA6, 0xF3, 0xFF, 0xA9, 0xFF, 0xC2, 0xFF,
-    0xF1, 0x42, 0xD0, 0xD1, 0xFC, 0xF9, 0xFF, 0xCC, 0x41, 0xBB, 0xA4, 0xF0, 0xE3, 0x00, 0x91, 0xD0,
-    0xD1, 0x2D, 0x7F, 0xFF, 0xFC, 0x7F, 0xAC, 0x1E, 0x7F, 0x9E, 0xF2, 0x42, 0xD0, 0xD1, 0xD6, 0xE1,
-    0xA6, 0x4F, 0x42, 0xB5, 0xBE, 0xAF, 0xC3, 0xFF, 0xF9, 0x61, 0x8E, 0x7F, 0x9F, 0x1D, 0xC2, 0x01,
-    0x31, 0xD0, 0xD1, 0xB6, 0x8D, 0xFF, 0xFB, 0x41, 0x82, 0xA7, 0x03, 0x21, 0xD1, 0xFC, 0x22, 0x80,
-    0x8B, 0xF0, 0xFD, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xDF, 0x7F, 0xFF, 0xFB, 0x7F, 0x9E, 0xBB,
-    0x64, 0xB5, 0xB8, 0xBB, 0xBE, 0x7F, 0xA8, 0x92, 0x7F, 0x9E, 0xF3, 0x7F, 0x9E, 0xA3, 0x7F, 0x9E,
-    0xF3, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xEF, 0x7F, 0xCD, 0x4A, 0x7F, 0x9E, 0x9D, 0x62, 0xB0,
-    0xB5, 0x7F, 0x9E, 0x85, 0x7F, 0x9E, 0x85, 0xC2, 0x00, 0xA1, 0xD0, 0xD1, 0xFF, 0xF7, 0xB4, 0x3C,
-    0x63, 0xB2, 0xBB, 0xBD, 0x7F, 0x9E, 0xDD, 0x7F, 0x9E, 0xDD, 0x7F, 0xFF, 0xF7, 0x62, 0x8F, 0x91,
-    0x7F, 0x9E, 0x9F, 0x7F, 0x9E, 0x9F, 0x42, 0xD0, 0xD1, 0xA3, 0xE8, 0xFF, 0xF7, 0x21, 0x80, 0xF9,
-    0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xFD, 0x7F, 0x9E, 0x5E, 0x62, 0xB0, 0xB2,
-    0x7F, 0xBA, 0xB6, 0x7F, 0x9E, 0x46, 0x61, 0xBC, 0x7F, 0x9E, 0x76, 0x21, 0xD0, 0xFB, 0x62, 0xB0,
-    0xBE, 0x7F, 0xFF, 0xFD, 0x7F, 0x9E, 0x6E, 0x21, 0xD0, 0xF7, 0x62, 0x80, 0x83, 0x7F, 0xFF, 0xFD,
-    0x7F, 0x9E, 0x4F, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF, 0xF7, 0x7F, 0x9E, 0x2B,
-    0x62, 0xB4, 0xBB, 0x7F, 0x9E, 0x13, 0x7F, 0x9E, 0x13, 0x62, 0xBA, 0xBB, 0x7F, 0x9F, 0xCF, 0x7F,
-    0x9E, 0x66, 0xA1, 0x01, 0x31, 0xD0, 0xF7, 0x62, 0x81, 0x85, 0x7F, 0xFF, 0xFB, 0x7F, 0x9D, 0xFC,
-    0xE3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xF7, 0x7F, 0x9D, 0xFE, 0x61,
-    0xB6, 0x7F, 0x9E, 0x4E, 0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xFB, 0x7F, 0x9D, 0xEA, 0x61, 0xBF, 0x7F,
-    0x9D, 0xED, 0xA1, 0x00, 0x91, 0xD0, 0xFB, 0x42, 0xB2, 0xBE, 0xB3, 0xCD, 0xFF, 0xFB, 0x62, 0xD0,
-    0x2D, 0x7F, 0xFF, 0xF9, 0x7F, 0x9D, 0xD0, 0xC1, 0x00, 0x91, 0xD0, 0xA9, 0xCD, 0x64, 0xB0, 0xB2,
-    0xB8, 0xBE, 0x7F, 0x9E, 0x06, 0x7F, 0x9D, 0xEF, 0x7F, 0x9E, 0x06, 0x7F, 0xFF, 0xFA, 0x41, 0x83,
-    0xF9, 0x80, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xEB, 0x7F, 0xFF, 0xFC, 0x7F, 0x9D, 0xAC, 0x62,
-    0xB0, 0xB5, 0x7F, 0x9D, 0xE4, 0x7F, 0x9D, 0xE4, 0x41, 0xD1, 0xE6, 0x6D, 0x64, 0x83, 0x8B, 0x8E,
-    0x91, 0x7F, 0x9D, 0xD7, 0x7F, 0xFF, 0xFC, 0x7F, 0x9D, 0xD7, 0x7F, 0x9D, 0xD7, 0x63, 0xD0, 0xD1,
-    0x2D, 0x7F, 0xFF, 0xE2, 0x7F, 0xFF, 0xEF, 0x7F, 0x9D, 0x81, 0x62, 0xD1, 0x2D, 0x7F, 0xBE, 0x97,
-    0x7F, 0x9D, 0x74, 0x61, 0x8C, 0x7F, 0x9D, 0xB0, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xB9, 0xF1, 0x7F,
-    0xFF, 0xFB, 0x7F, 0x9D, 0x66, 0x65, 0xB1, 0xB2, 0xB7, 0xBA, 0xBF, 0x7F, 0x9D, 0x4E, 0x7F, 0x9D,
-    0x4E, 0x7F, 0xF7, 0x8E, 0x7F, 0x9D, 0x4E, 0x7F, 0x9D, 0x4E, 0x63, 0x81, 0x82, 0x84, 0x7F, 0xA0,
-    0xE9, 0x7F, 0x9E, 0xFE, 0x7F, 0x9D, 0x39, 0xE3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xDE,
-    0x7F, 0xFF, 0xF3, 0x7F, 0x9D, 0x37, 0xC1, 0x00, 0xA1, 0xD1, 0xE1, 0x8D, 0x21, 0xBB, 0xFA, 0x61,
-    0xBE, 0x7F, 0x9D, 0x3A, 0x21, 0xD0, 0xFB, 0x21, 0x80, 0xFD, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF,
-    0xF2, 0x7F, 0xFF, 0xFD, 0x7F, 0x9D, 0x14, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
-    0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB9, 0xFE, 0x15, 0xFE, 0x4C, 0xFE, 0x6A, 0xFE, 0xA9,
-    0xFE, 0xDC, 0xFF, 0x09, 0xFF, 0x1D, 0xFF, 0x37, 0xA3, 0xAD, 0xFF, 0x5B, 0xFF, 0x86, 0xFF, 0x93,
-    0xFF, 0xA1, 0xFF, 0xD0, 0xFF, 0xF3, 0xA1, 0x16, 0x41, 0x80, 0xB4, 0x0C, 0x21, 0xD1, 0xFC, 0x21,
-    0x82, 0xFD, 0xA1, 0x00, 0x91, 0xD1, 0xFD, 0x41, 0xB5, 0xA8, 0xDE, 0x21, 0xD0, 0xFC, 0xC1, 0x00,
-    0xA1, 0xD0, 0xBF, 0xAE, 0x21, 0xB4, 0xFA, 0xA1, 0x00, 0x91, 0xD0, 0xFD, 0x65, 0xB0, 0xB5, 0xB8,
-    0xBA, 0xBE, 0x7F, 0x9C, 0xF7, 0x7F, 0xFF, 0xE6, 0x7F, 0x9C, 0xF7, 0x7F, 0xFF, 0xEF, 0x7F, 0xFF,
-    0xFB, 0x66, 0x82, 0x83, 0x8B, 0x8E, 0x8F, 0x91, 0x7F, 0xA5, 0xD2, 0x7F, 0x9C, 0xB8, 0x7F, 0x9C,
-    0xE2, 0x7F, 0x9C, 0xE2, 0x7F, 0x9C, 0xE2, 0x7F, 0x9C, 0xE2, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF,
-    0xD2, 0x7F, 0xFF, 0xE7, 0x7F, 0x9C, 0x84, 0x64, 0xB0, 0xB8, 0xBB, 0xBE, 0x7F, 0x9C, 0xA5, 0x7F,
-    0x9C, 0xA5, 0x7F, 0x9C, 0x83, 0x7F, 0xFE, 0x34, 0x61, 0x2E, 0x7F, 0x9C, 0x94, 0x62, 0x80, 0x83,
-    0x7F, 0x9C, 0xA6, 0x7F, 0xFF, 0xFB, 0x22, 0xD0, 0xD1, 0xE1, 0xF7, 0xA0, 0x0B, 0x62, 0x21, 0xB6,
-    0xFD, 0x21, 0xD0, 0xFD, 0x62, 0xB0, 0xB8, 0x7F, 0xFF, 0xFD, 0x7F, 0x9C, 0x92, 0xA1, 0x01, 0xB1,
-    0xD0, 0xF7, 0x67, 0xB0, 0xB3, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0x7F, 0xB7, 0x0A, 0x7F, 0x9C, 0x81,
-    0x7F, 0xFF, 0xE4, 0x7F, 0xFF, 0xFB, 0x7F, 0x9C, 0x81, 0x7F, 0x9C, 0x9B, 0x7F, 0x9C, 0x31, 0x62,
-    0x8F, 0x91, 0x7F, 0x9C, 0x64, 0x7F, 0x9C, 0x64, 0x42, 0xD0, 0xD1, 0xA1, 0x36, 0xFF, 0xF7, 0x66,
-    0x81, 0x82, 0x84, 0x86, 0x87, 0x8C, 0x7F, 0x9C, 0x57, 0x7F, 0xFF, 0xF9, 0x7F, 0x9C, 0x54, 0x7F,
-    0x9C, 0xE4, 0x7F, 0x9C, 0x6E, 0x7F, 0xDE, 0x9B, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xBA, 0x7F,
-    0xFF, 0xE7, 0x7F, 0x9B, 0xF6, 0x41, 0xD1, 0xF0, 0x3D, 0x21, 0xBF, 0xFC, 0xA1, 0x00, 0x91, 0xD0,
-    0xFD, 0x65, 0xB0, 0xB5, 0xB8, 0xBB, 0xBE, 0x7F, 0x9C, 0x22, 0x7F, 0xF2, 0x3A, 0x7F, 0x9C, 0x22,
-    0x7F, 0xB7, 0x5D, 0x7F, 0xFF, 0xFB, 0x62, 0x8E, 0x91, 0x7F, 0x9B, 0xE3, 0x7F, 0x9C, 0x0D, 0x42,
-    0xD0, 0xD1, 0xA0, 0xDF, 0xFF, 0xF7, 0x67, 0x80, 0x83, 0x8B, 0x8C, 0x8E, 0x8F, 0x91, 0x7F, 0x9B,
-    0xEC, 0x7F, 0x9B, 0xFD, 0x7F, 0x9B, 0xFD, 0x7F, 0xFF, 0xF9, 0x7F, 0x9D, 0xD2, 0x7F, 0x9B, 0xFD,
-    0x7F, 0xF2, 0x15, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xBE, 0x7F, 0xFF, 0xE3, 0x7F, 0x9B, 0x9B,
-    0x61, 0xB3, 0x7F, 0x9B, 0xDF, 0xE3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xFB, 0x7F, 0xA0,
-    0xC3, 0x7F, 0x9B, 0x89, 0x62, 0xB8, 0xBB, 0x7F, 0x9B, 0x95, 0x7F, 0xBB, 0x57, 0x63, 0xD0, 0xD1,
-    0x2D, 0x7F, 0xFF, 0xF7, 0x7F, 0xA1, 0xEB, 0x7F, 0x9B, 0x71, 0x61, 0xB4, 0x7F, 0x9B, 0x92, 0x62,
-    0xD0, 0xD1, 0x7F, 0xFF, 0xFB, 0x7F, 0x9F, 0xA3, 0xA0, 0x0B, 0x82, 0x21, 0xBE, 0xFD, 0xA1, 0x00,
-    0xA1, 0xD0, 0xFD, 0xC1, 0x01, 0x31, 0xD1, 0xD6, 0x45, 0x23, 0xB0, 0xB2, 0xBB, 0xE6, 0xF5, 0xFA,
-    0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF9, 0x7F, 0x9C, 0xF1, 0x7F, 0x9B, 0x3E, 0x41, 0xB5, 0xCC,
-    0x37, 0x63, 0x80, 0x8C, 0x91, 0x7F, 0x9D, 0x47, 0x7F, 0x9B, 0x72, 0x7F, 0xCC, 0x33, 0x63, 0xD0,
-    0xD1, 0x2D, 0x7F, 0xFF, 0xEF, 0x7F, 0xFF, 0xF3, 0x7F, 0x9B, 0x20, 0xE1, 0x00, 0xA1, 0xD0, 0x7F,
-    0x9B, 0x8A, 0x64, 0xB5, 0xB8, 0xBB, 0xBF, 0x7F, 0x9B, 0x27, 0x7F, 0x9B, 0x27, 0x7F, 0xFF, 0xF9,
-    0x7F, 0x9B, 0x6B, 0x61, 0x91, 0x7F, 0x9B, 0x16, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xEA, 0x7F,
-    0xFF, 0xFB, 0x7F, 0x9A, 0xF6, 0x71, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x8D, 0x8F,
-    0x91, 0x86, 0x89, 0x8A, 0x8B, 0x8C, 0x8E, 0x7F, 0xFE, 0x65, 0x7F, 0xFE, 0xF3, 0x7F, 0xFF, 0x4E,
-    0x7F, 0xFF, 0x60, 0x7F, 0xFF, 0x78, 0x7F, 0xFF, 0xAB, 0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xF3, 0x7F,
-    0xA2, 0xAB, 0x7F, 0xBB, 0x96, 0x7F, 0xA1, 0x8F, 0x7F, 0x9E, 0xF8, 0x7F, 0x9E, 0xF8, 0x7F, 0x9E,
-    0xF8, 0x7F, 0x9E, 0xF8, 0x7F, 0x9E, 0xF8, 0x7F, 0x9E, 0xF8, 0x42, 0xD0, 0xD1, 0xFD, 0x9D, 0xFF,
-    0xBB, 0xC1, 0x01, 0xE1, 0xD1, 0xAD, 0xEA, 0x21, 0xB4, 0xFA, 0x21, 0xD0, 0xFD, 0x64, 0xB1, 0xB3,
-    0xB7, 0xBD, 0x7F, 0x9C, 0x4B, 0x7F, 0xAD, 0xC3, 0x7F, 0x9F, 0x99, 0x7F, 0xFF, 0xFD, 0x64, 0x82,
-    0x85, 0x88, 0x8D, 0x7F, 0x9C, 0x37, 0x7F, 0x9A, 0x75, 0x7F, 0xA1, 0xCC, 0x7F, 0x9A, 0xDC, 0x63,
-    0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xDE, 0x7F, 0xFF, 0xEF, 0x7F, 0x9A, 0x6F, 0xA0, 0x0B, 0xA2, 0x43,
-    0xB2, 0xB4, 0xBE, 0xA0, 0x6B, 0xA0, 0x6B, 0xFF, 0xFD, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF6,
-    0x7F, 0xFA, 0x8F, 0x7F, 0x9A, 0x55, 0x66, 0xB0, 0xB3, 0xB6, 0xB7, 0xBD, 0xBE, 0x7F, 0xF4, 0xA5,
-    0x7F, 0x9E, 0xAC, 0x7F, 0x9A, 0x3D, 0x7F, 0x9B, 0xB7, 0x7F, 0xE4, 0x06, 0x7F, 0x9A, 0x76, 0xE3,
-    0x03, 0xD1, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE7, 0x7F, 0xE4, 0xA4, 0x7F, 0x9A, 0x2F, 0x63, 0xB0,
-    0xB8, 0xBE, 0x7F, 0x9A, 0x7F, 0x7F, 0x9A, 0x7F, 0x7F, 0x9A, 0x7F, 0x62, 0xD0, 0x2D, 0x7F, 0xFF,
-    0xF3, 0x7F, 0x9A, 0x13, 0x41, 0xD1, 0xF7, 0x7B, 0x42, 0xB1, 0xBD, 0xFF, 0xFC, 0xA1, 0x52, 0x62,
-    0x82, 0x83, 0x7F, 0xA5, 0xE2, 0x7F, 0x9A, 0x2D, 0x42, 0xD0, 0xD1, 0xCE, 0x6E, 0xFF, 0xF7, 0x41,
-    0xBF, 0xA6, 0x06, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0xA1, 0x03, 0x91, 0xD0, 0xFD, 0x43, 0x80,
-    0x81, 0x82, 0xFF, 0xEA, 0xC3, 0x43, 0xFF, 0xFB, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xD0, 0x7F,
-    0xFF, 0xF6, 0x7F, 0x99, 0xD6, 0x70, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB8, 0xBA, 0xBB, 0xBC,
-    0xBD, 0xBE, 0xB6, 0xB7, 0xB9, 0xBF, 0x7F, 0xFF, 0x5A, 0x7F, 0xA0, 0xFC, 0x7F, 0xA0, 0xFC, 0x7F,
-    0xA1, 0x8B, 0x7F, 0xA0, 0xFC, 0x7F, 0xFF, 0x74, 0x7F, 0xFF, 0x9A, 0x7F, 0xA0, 0xFC, 0x7F, 0xFF,
-    0xB6, 0x7F, 0xA1, 0x8B, 0x7F, 0xA0, 0xFC, 0x7F, 0xFF, 0xF3, 0x7F, 0x9D, 0xD8, 0x7F, 0x9D, 0xD8,
-    0x7F, 0x9D, 0xD8, 0x7F, 0x9D, 0xD8, 0x62, 0xB1, 0xB7, 0x7F, 0x99, 0xCD, 0x7F, 0x99, 0xE4, 0x62,
-    0x81, 0x82, 0x7F, 0x99, 0xDB, 0x7F, 0x99, 0xC4, 0x22, 0xD0, 0xD1, 0xEE, 0xF7, 0x62, 0xD0, 0xD1,
-    0x7F, 0x9A, 0xBC, 0x7F, 0xB2, 0xBF, 0x62, 0xB6, 0xB7, 0x7F, 0x99, 0xC7, 0x7F, 0x99, 0xC7, 0xA1,
-    0x00, 0x91, 0xD0, 0xF7, 0xE1, 0x00, 0x91, 0xD0, 0x7F, 0x9A, 0xA5, 0x24, 0xB0, 0xB5, 0xB8, 0xBE,
-    0xDD, 0xE2, 0xF4, 0xF9, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF7, 0x7F, 0xC7, 0xF7, 0x7F, 0x99,
-    0x4A, 0x41, 0xD1, 0x9F, 0xB7, 0x62, 0xBC, 0xBE, 0x7F, 0x99, 0x98, 0x7F, 0xFF, 0xFC, 0xE2, 0x03,
-    0x32, 0xD0, 0x2D, 0x7F, 0xFF, 0xF7, 0x7F, 0x99, 0x30, 0x41, 0xBF, 0xAE, 0x7F, 0x62, 0x82, 0x84,
-    0x7F, 0xAD, 0x2E, 0x7F, 0x99, 0xF6, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF3, 0x7F, 0xFF, 0xF7,
-    0x7F, 0x99, 0x18, 0x62, 0x2E, 0x2D, 0x7F, 0x99, 0xE0, 0x7F, 0x99, 0x0B, 0x71, 0x80, 0x81, 0x82,
-    0x83, 0x84, 0x87, 0x88, 0x8C, 0x8E, 0x8A, 0x91, 0x85, 0x86, 0x89, 0x8B, 0x8D, 0x8F, 0x7F, 0xFF,
-    0xB8, 0x7F, 0xA1, 0x22, 0x7F, 0xFF, 0xD2, 0x7F, 0xFF, 0xEA, 0x7F, 0xA0, 0xC4, 0x7F, 0xA0, 0x35,
-    0x7F, 0xA4, 0x74, 0x7F, 0xFF, 0xF7, 0x7F, 0xE4, 0x8F, 0x7F, 0xA3, 0xD8, 0x7F, 0x9D, 0x11, 0x7F,
-    0x9D, 0x11, 0x7F, 0x9D, 0x11, 0x7F, 0x9D, 0x11, 0x7F, 0x9D, 0x11, 0x7F, 0x9D, 0x11, 0x7F, 0x9D,
-    0x11, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xFE, 0xF4, 0xFF, 0xBB, 0x65, 0xB1, 0xB4, 0xBA, 0xBD, 0xBE,
-    0x7F, 0x9D, 0x18, 0x7F, 0x98, 0xA9, 0x7F, 0xA2, 0x39, 0x7F, 0x99, 0xC4, 0x7F, 0x98, 0xC0, 0x61,
-    0x88, 0x7F, 0x98, 0xE4, 0x21, 0xD1, 0xFB, 0x21, 0x80, 0xFD, 0xE3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D,
-    0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xFD, 0x7F, 0x98, 0x94, 0x42, 0xB5, 0xB8, 0xA0, 0xF0, 0xA0, 0xF0,
-    0x62, 0x8B, 0x91, 0x7F, 0x98, 0x99, 0x7F, 0xA0, 0xE9, 0xE3, 0x03, 0xE2, 0xD0, 0xD1, 0x2D, 0x7F,
-    0xFF, 0xF0, 0x7F, 0xFF, 0xF7, 0x7F, 0x98, 0x75, 0xE2, 0x02, 0xB1, 0xD0, 0x2D, 0x7F, 0xB6, 0xCB,
-    0x7F, 0x98, 0x66, 0x41, 0x8B, 0xA1, 0xE0, 0x21, 0xD1, 0xFC, 0x63, 0xB0, 0xB5, 0xB7, 0x7F, 0xD0,
-    0xA3, 0x7F, 0x98, 0xA5, 0x7F, 0xFF, 0xFD, 0xE3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF3,
-    0x7F, 0xBA, 0xA2, 0x7F, 0x98, 0x47, 0x63, 0x81, 0x82, 0x86, 0x7F, 0x98, 0x7D, 0x7F, 0x98, 0x7D,
-    0x7F, 0x98, 0x7D, 0x42, 0xD0, 0xD1, 0xAA, 0xBE, 0xFF, 0xF3, 0x61, 0xB1, 0x7F, 0x9A, 0x3E, 0x62,
-    0x81, 0x82, 0x7F, 0x98, 0x7E, 0x7F, 0x98, 0x64, 0x22, 0xD0, 0xD1, 0xF2, 0xF7, 0x41, 0x80, 0xA0,
-    0x4D, 0x63, 0x2E, 0xD0, 0xD1, 0x7F, 0x98, 0x28, 0x7F, 0xC7, 0xB9, 0x7F, 0xFF, 0xFC, 0x23, 0xB0,
-    0xB5, 0xBE, 0xD5, 0xEA, 0xF3, 0x42, 0xD0, 0xD1, 0xFF, 0xD5, 0xA5, 0x25, 0x62, 0x83, 0x91, 0x7F,
-    0x98, 0x37, 0x7F, 0xFF, 0xF9, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE9, 0x7F, 0xFF, 0xF7, 0x7F,
-    0x97, 0xE9, 0x41, 0x83, 0xA0, 0x18, 0x62, 0xD1, 0x2D, 0x7F, 0xFF, 0xFC, 0x7F, 0x97, 0xD8, 0x41,
-    0x8B, 0xA4, 0x76, 0xE2, 0x03, 0x32, 0xD1, 0x2D, 0x7F, 0xFF, 0xFC, 0x7F, 0x97, 0xCB, 0x62, 0xB5,
-    0xBE, 0x7F, 0x97, 0xB5, 0x7F, 0x9C, 0x65, 0xA1, 0x01, 0xE1, 0xD0, 0xF7, 0x42, 0xBA, 0xBF, 0xAD,
-    0x0C, 0xFF, 0xFB, 0x62, 0xBC, 0xBD, 0x7F, 0x97, 0xF0, 0x7F, 0xA1, 0x30, 0x21, 0xD0, 0xF7, 0x65,
-    0x80, 0x81, 0x84, 0x85, 0x8F, 0x7F, 0xA0, 0xAD, 0x7F, 0xFF, 0xFD, 0x7F, 0x97, 0xF0, 0x7F, 0x9C,
-    0x1E, 0x7F, 0x97, 0xF0, 0xE3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xD8, 0x7F, 0xFF, 0xEB,
-    0x7F, 0x97, 0x8A, 0x70, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD,
-    0xBE, 0xBF, 0xB6, 0xB9, 0x7F, 0xFE, 0xE7, 0x7F, 0x9E, 0xAE, 0x7F, 0xFF, 0x06, 0x7F, 0x9F, 0x3D,
-    0x7F, 0xBB, 0xA3, 0x7F, 0xFF, 0x15, 0x7F, 0x9F, 0x43, 0x7F, 0xFF, 0x34, 0x7F, 0x9F, 0x43, 0x7F,
-    0xFF, 0x92, 0x7F, 0xFF, 0xA3, 0x7F, 0xFF, 0xB0, 0x7F, 0xFF, 0xF1, 0x7F, 0x9E, 0xC1, 0x7F, 0x9B,
-    0x8A, 0x7F, 0x9B, 0x8A, 0x62, 0xB7, 0xBD, 0x7F, 0x97, 0x7F, 0x7F, 0x99, 0x54, 0xA0, 0x0B, 0xC3,
-    0x21, 0x81, 0xFD, 0x22, 0xD0, 0xD1, 0xF1, 0xFD, 0x61, 0xB9, 0x7F, 0x97, 0x6B, 0x21, 0xD0, 0xFB,
-    0x41, 0xBF, 0xBA, 0x10, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xA4, 0x46, 0x61, 0x87, 0x7F, 0x97, 0x64,
-    0xA1, 0x02, 0xB1, 0xD1, 0xFB, 0x62, 0xB2, 0xBC, 0x7F, 0x97, 0x4E, 0x7F, 0xFF, 0xFB, 0x21, 0xD0,
-    0xF7, 0x24, 0xB0, 0xB5, 0xB8, 0xBE, 0xD2, 0xDC, 0xE3, 0xFD, 0x62, 0x8B, 0x8F, 0x7F, 0x97, 0x39,
-    0x7F, 0x97, 0x39, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xF7, 0x7F, 0x96, 0xEB,
-    0x64, 0xB3, 0xB5, 0xB9, 0xBD, 0x7F, 0xAC, 0xD4, 0x7F, 0x97, 0xB3, 0x7F, 0x97, 0xB3, 0x7F, 0x98,
-    0xF8, 0xC1, 0x00, 0x92, 0xD0, 0xB9, 0xAE, 0x41, 0x2E, 0xBD, 0xEA, 0x65, 0x80, 0x81, 0x88, 0x8E,
-    0x8F, 0x7F, 0xFF, 0xF6, 0x7F, 0x98, 0xDD, 0x7F, 0x98, 0xDD, 0x7F, 0x97, 0x98, 0x7F, 0xFF, 0xFC,
-    0x64, 0x2E, 0xD0, 0xD1, 0x2D, 0x7F, 0x98, 0xC8, 0x7F, 0xFF, 0xD0, 0x7F, 0xFF, 0xEB, 0x7F, 0x96,
-    0xAE, 0x61, 0x8E, 0x7F, 0x96, 0xF9, 0x62, 0xD1, 0x2D, 0x7F, 0xFF, 0xFB, 0x7F, 0x96, 0x98, 0x71,
-    0x80, 0x81, 0x82, 0x83, 0x85, 0x87, 0x88, 0x8C, 0x8A, 0x91, 0x84, 0x86, 0x89, 0x8B, 0x8D, 0x8E,
-    0x8F, 0x7F, 0xFF, 0xA4, 0x7F, 0xAA, 0x57, 0x7F, 0x9D, 0xC2, 0x7F, 0xFF, 0xE1, 0x7F, 0x9E, 0x57,
-    0x7F, 0xAA, 0x57, 0x7F, 0x9E, 0x51, 0x7F, 0xFF, 0xF7, 0x7F, 0xA1, 0x65, 0x7F, 0x9A, 0x9E, 0x7F,
-    0x9A, 0x9E, 0x7F, 0x9A, 0x9E, 0x7F, 0x9A, 0x9E, 0x7F, 0x9A, 0x9E, 0x7F, 0x9A, 0x9E, 0x7F, 0x9A,
-    0x9E, 0x7F, 0x9A, 0x9E, 0x42, 0xD0, 0xD1, 0xFE, 0xCF, 0xFF, 0xBB, 0x62, 0xBC, 0xBF, 0x7F, 0x9D,
-    0x8F, 0x7F, 0x9A, 0xA7, 0x61, 0x85, 0x7F, 0x9D, 0x86, 0xE4, 0x01, 0x31, 0x2E, 0xD0, 0xD1, 0x2D,
-    0x7F, 0x9D, 0x81, 0x7F, 0xFF, 0xF2, 0x7F, 0xFF, 0xFB, 0x7F, 0x96, 0x35, 0x62, 0x8B, 0x91, 0x7F,
-    0x96, 0xF7, 0x7F, 0x96, 0x81, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0x97, 0x0F, 0x7F, 0xFF, 0xF7, 0x7F,
-    0x96, 0x19, 0x64, 0xB7, 0xBA, 0xBE, 0xBF, 0x7F, 0x96, 0x3A, 0x7F, 0x96, 0x3A, 0x7F, 0xB4, 0x58,
-    0x7F, 0x9A, 0x8B, 0x61, 0xB0, 0x7F, 0x98, 0xC4, 0xA1, 0x01, 0x31, 0xD0, 0xFB, 0x42, 0x81, 0x82,
-    0xB8, 0xE3, 0xFF, 0xFB, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xDE, 0x7F, 0xFF, 0xF9, 0x7F, 0x95,
-    0xEA, 0xC1, 0x02, 0x92, 0xD0, 0xCC, 0x90, 0x63, 0xBA, 0xBE, 0xBF, 0x7F, 0xFF, 0xFA, 0x7F, 0x9A,
-    0x3B, 0x7F, 0x96, 0x28, 0x63, 0x81, 0x83, 0x84, 0x7F, 0x9A, 0x21, 0x7F, 0x95, 0xD6, 0x7F, 0x9B,
-    0xD6, 0xE3, 0x01, 0x31, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xF3, 0x7F, 0x95, 0xBD,
-    0x42, 0xB1, 0xB4, 0xAB, 0xA4, 0xAB, 0x08, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF9, 0x7F, 0xD1,
-    0xA5, 0x7F, 0x95, 0xA7, 0x70, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC,
-    0xBD, 0xBE, 0xBF, 0xB6, 0xB9, 0x7F, 0xFF, 0x65, 0x7F, 0x9C, 0xCD, 0x7F, 0xFF, 0x81, 0x7F, 0x9D,
-    0x5C, 0x7F, 0x9C, 0xCD, 0x7F, 0xFF, 0xB0, 0x7F, 0x9C, 0xCD, 0x7F, 0xFF, 0xDD, 0x7F, 0xA9, 0x62,
-    0x7F, 0x9C, 0xCD, 0x7F, 0x9D, 0x5C, 0x7F, 0x9C, 0xCD, 0x7F, 0xFF, 0xF3, 0x7F, 0xA1, 0x0C, 0x7F,
-    0x99, 0xA9, 0x7F, 0x99, 0xA9, 0xE1, 0x03, 0x91, 0x2D, 0x7F, 0x95, 0x59, 0xC1, 0x01, 0xB1, 0xD0,
-    0xCC, 0x05, 0x21, 0xBF, 0xFA, 0xE2, 0x03, 0x91, 0xD0, 0x2D, 0x7F, 0xFF, 0xFD, 0x7F, 0x95, 0x49,
-    0x71, 0x80, 0x81, 0x82, 0x83, 0x86, 0x88, 0x8B, 0x8E, 0x8A, 0x91, 0x84, 0x85, 0x87, 0x89, 0x8C,
-    0x8D, 0x8F, 0x7F, 0x9C, 0x71, 0x7F, 0x9C, 0x71, 0x7F, 0x9C, 0x71, 0x7F, 0xFF, 0xE5, 0x7F, 0x9D,
-    0x00, 0x7F, 0xAA, 0x50, 0x7F, 0xFF, 0xF5, 0x7F, 0xC2, 0xF6, 0x7F, 0xA0, 0x14, 0x7F, 0x99, 0x4D,
-    0x7F, 0x99, 0x4D, 0x7F, 0x99, 0x4D, 0x7F, 0x99, 0x4D, 0x7F, 0x99, 0x4D, 0x7F, 0x99, 0x4D, 0x7F,
-    0x99, 0x4D, 0x7F, 0x99, 0x4D, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xFF, 0x5F, 0xFF, 0xBB, 0x61, 0xD1,
-    0x7F, 0x94, 0xEB, 0x62, 0xD0, 0xD1, 0x7F, 0x96, 0x56, 0x7F, 0xAB, 0x33, 0x21, 0xB2, 0xF7, 0x62,
-    0xD0, 0xD1, 0x7F, 0xFF, 0xFD, 0x7F, 0x98, 0x43, 0x22, 0xB4, 0xB5, 0xE6, 0xF7, 0x62, 0xB2, 0xB5,
-    0x7F, 0x97, 0x5F, 0x7F, 0x94, 0xFF, 0x62, 0x83, 0x8F, 0x7F, 0x94, 0xF6, 0x7F, 0x94, 0xF6, 0x22,
-    0xD0, 0xD1, 0xEE, 0xF7, 0x21, 0x82, 0xFB, 0x21, 0xD1, 0xFD, 0x42, 0x81, 0x82, 0xFF, 0xFD, 0xC8,
-    0x3D, 0xE3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xD7, 0x7F, 0xFF, 0xF9, 0x7F, 0x94, 0xAD,
-    0x63, 0xB2, 0xB3, 0xBE, 0x7F, 0x98, 0x93, 0x7F, 0x99, 0x02, 0x7F, 0x94, 0xCC, 0x62, 0x80, 0x81,
-    0x7F, 0xF1, 0xE5, 0x7F, 0x98, 0x86, 0xE3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xEA, 0x7F,
-    0xFF, 0xF7, 0x7F, 0x94, 0x88, 0xE2, 0x00, 0xA1, 0xD0, 0x2D, 0x7F, 0xB0, 0x07, 0x7F, 0x94, 0x79,
-    0x61, 0x86, 0x7F, 0x9B, 0xBA, 0xE3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0x7F, 0xDC, 0xB6, 0x7F, 0xFF,
-    0xFB, 0x7F, 0x94, 0x69, 0x62, 0xB3, 0xB6, 0x7F, 0x94, 0x75, 0x7F, 0x94, 0x75, 0xA1, 0x00, 0xA1,
-    0xD0, 0xF7, 0xE1, 0x02, 0x21, 0x2E, 0x7F, 0x94, 0xAB, 0x64, 0xB0, 0xB5, 0xB8, 0xBE, 0x7F, 0x9C,
-    0x81, 0x7F, 0xFF, 0xF4, 0x7F, 0xFF, 0xF9, 0x7F, 0x9C, 0x81, 0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xEF,
-    0x7F, 0x94, 0x34, 0x63, 0xB0, 0xB5, 0xBE, 0x7F, 0x95, 0x00, 0x7F, 0x95, 0x00, 0x7F, 0x94, 0x8A,
-    0xE2, 0x02, 0xB1, 0xD0, 0x2D, 0x7F, 0xFF, 0xF3, 0x7F, 0x94, 0x1E, 0x70, 0xB0, 0xB1, 0xB2, 0xB4,
-    0xB5, 0xB6, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xB3, 0xB7, 0xB9, 0xBF, 0x7F, 0xFF, 0x66, 0x7F,
-    0x9B, 0x46, 0x7F, 0x9A, 0xB9, 0x7F, 0x9B, 0x46, 0x7F, 0xFF, 0x8B, 0x7F, 0xFF, 0x9A, 0x7F, 0xFF,
-    0xAA, 0x7F, 0x9B, 0x46, 0x7F, 0xFF, 0xDF, 0x7F, 0xFF, 0xF5, 0x7F, 0x9B, 0x46, 0x7F, 0xFE, 0xBA,
-    0x7F, 0x98, 0x22, 0x7F, 0x98, 0x22, 0x7F, 0x98, 0x22, 0x7F, 0x98, 0x22, 0x63, 0xB0, 0xB5, 0xBC,
-    0x7F, 0x9D, 0x57, 0x7F, 0x94, 0x31, 0x7F, 0x94, 0xA7, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF3,
-    0x7F, 0x94, 0xBF, 0x7F, 0x93, 0xC5, 0xE2, 0x02, 0xB1, 0xD0, 0x2D, 0x7F, 0xDC, 0x05, 0x7F, 0x93,
-    0xB8, 0x64, 0x2E, 0xD0, 0xD1, 0x2D, 0x7F, 0x94, 0x82, 0x7F, 0xBA, 0xC2, 0x7F, 0xA3, 0x47, 0x7F,
-    0x93, 0xAD, 0x41, 0x80, 0xF0, 0xF0, 0xE2, 0x02, 0xB1, 0xD1, 0x2D, 0x7F, 0xFF, 0xFC, 0x7F, 0x93,
-    0x98, 0x71, 0x81, 0x82, 0x83, 0x85, 0x87, 0x8C, 0x91, 0x8A, 0x80, 0x84, 0x86, 0x88, 0x89, 0x8B,
-    0x8D, 0x8E, 0x8F, 0x7F, 0x9A, 0xC0, 0x7F, 0xFF, 0xC8, 0x7F, 0xFF, 0xD5, 0x7F, 0xC5, 0x6B, 0x7F,
-    0x9A, 0xC0, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xF5, 0x7F, 0x9E, 0x63, 0x7F, 0x97, 0x9C, 0x7F, 0x97,
-    0x9C, 0x7F, 0x97, 0x9C, 0x7F, 0x97, 0x9C, 0x7F, 0x97, 0x9C, 0x7F, 0x97, 0x9C, 0x7F, 0x97, 0x9C,
-    0x7F, 0x97, 0x9C, 0x7F, 0x97, 0x9C, 0x42, 0xD0, 0xD1, 0xFF, 0x35, 0xFF, 0xBB, 0x62, 0xD0, 0xD1,
-    0x7F, 0x98, 0x3C, 0x7F, 0x94, 0xFE, 0x61, 0xBA, 0x7F, 0x9C, 0x6D, 0x21, 0xD0, 0xFB, 0x64, 0xB1,
-    0xB3, 0xB4, 0xBD, 0x7F, 0x97, 0x94, 0x7F, 0xFF, 0xEF, 0x7F, 0x97, 0xD5, 0x7F, 0xFF, 0xFD, 0x63,
-    0x80, 0x81, 0x82, 0x7F, 0x96, 0xFE, 0x7F, 0xB1, 0x6B, 0x7F, 0xDA, 0xB6, 0x63, 0xD0, 0xD1, 0x2D,
-    0x7F, 0xFF, 0xE2, 0x7F, 0xFF, 0xF3, 0x7F, 0x93, 0x12, 0x41, 0xB5, 0xA3, 0x4B, 0xE2, 0x00, 0xA1,
-    0xD0, 0x2D, 0x7F, 0xFF, 0xFC, 0x7F, 0x93, 0x01, 0x64, 0xB3, 0xBA, 0xBE, 0xBF, 0x7F, 0x97, 0x5A,
-    0x7F, 0x93, 0x24, 0x7F, 0x96, 0x42, 0x7F, 0xA7, 0x03, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xEF,
-    0x7F, 0xB5, 0x40, 0x7F, 0x92, 0xE5, 0x62, 0xB1, 0xBF, 0x7F, 0x97, 0x3C, 0x7F, 0x97, 0x3C, 0x61,
-    0x84, 0x7F, 0x98, 0xDB, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF2, 0x7F, 0xFF, 0xFB, 0x7F, 0x92,
-    0xCA, 0x41, 0xBE, 0xDD, 0xD3, 0xE2, 0x04, 0xC3, 0xD0, 0x2D, 0x7F, 0xFF, 0xFC, 0x7F, 0x92, 0xB9,
-    0x62, 0xB9, 0xBD, 0x7F, 0x9C, 0x33, 0x7F, 0x93, 0x83, 0x21, 0xD0, 0xF7, 0x63, 0xB2, 0xBB, 0xBD,
-    0x7F, 0x93, 0x77, 0x7F, 0x93, 0x77, 0x7F, 0x93, 0x01, 0x63, 0x81, 0x82, 0x84, 0x7F, 0x92, 0xF4,
-    0x7F, 0x98, 0x8F, 0x7F, 0x92, 0xF4, 0x63, 0x2E, 0xD0, 0xD1, 0x7F, 0x92, 0xE7, 0x7F, 0xFF, 0xE6,
-    0x7F, 0xFF, 0xF3, 0x62, 0xB2, 0xB3, 0x7F, 0x93, 0x50, 0x7F, 0x92, 0xDA, 0x62, 0x2E, 0xD0, 0x7F,
-    0x92, 0xD1, 0x7F, 0xFF, 0xF7, 0x23, 0xB5, 0xB8, 0xBE, 0xC4, 0xE1, 0xF7, 0x63, 0xB5, 0xBA, 0xBF,
-    0x7F, 0x93, 0x37, 0x7F, 0x93, 0x37, 0x7F, 0x92, 0xC1, 0x63, 0x82, 0x87, 0x8E, 0x7F, 0x93, 0x2A,
-    0x7F, 0x93, 0x2A, 0x7F, 0x93, 0x2A, 0x22, 0xD0, 0xD1, 0xE6, 0xF3, 0x64, 0x8B, 0x8E, 0x8F, 0x91,
-    0x7F, 0x92, 0x88, 0x7F, 0x92, 0xA2, 0x7F, 0xFF, 0xFB, 0x7F, 0xC2, 0x2A, 0x63, 0xD0, 0xD1, 0x2D,
-    0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xEF, 0x7F, 0x92, 0x32, 0xC1, 0x05, 0x02, 0x2E, 0x9F, 0x4E, 0x21,
-    0x8B, 0xFA, 0xE2, 0x02, 0x21, 0xD1, 0x2D, 0x7F, 0xFF, 0xFD, 0x7F, 0x92, 0x1C, 0x41, 0xB8, 0xB3,
-    0x3F, 0x41, 0x83, 0xF8, 0xD0, 0xE3, 0x03, 0x32, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF,
-    0xFC, 0x7F, 0x92, 0x09, 0xE2, 0x02, 0x42, 0xD1, 0x2D, 0x7F, 0xD5, 0x1A, 0x7F, 0x91, 0xFA, 0x70,
-    0xB0, 0xB1, 0xB2, 0xB5, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xB3, 0xB4, 0xB6, 0xB7, 0xB9, 0xBE,
-    0x7F, 0xFE, 0xDD, 0x7F, 0x99, 0x22, 0x7F, 0xFE, 0xEE, 0x7F, 0xFF, 0x0A, 0x7F, 0xFF, 0x25, 0x7F,
-    0xFF, 0x36, 0x7F, 0xFF, 0xBD, 0x7F, 0xFF, 0xD3, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xF5, 0x7F, 0x95,
-    0xFE, 0x7F, 0x95, 0xFE, 0x7F, 0x95, 0xFE, 0x7F, 0x95, 0xFE, 0x7F, 0x95, 0xFE, 0x7F, 0x95, 0xFE,
-    0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0x93, 0x81, 0x7F, 0x93, 0xDA, 0x7F, 0x91, 0xAE, 0x61, 0xB5, 0x7F,
-    0x98, 0x8C, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xFB, 0x7F, 0xC9, 0xEF, 0x7F, 0x91, 0x9C, 0x62,
-    0xB5, 0xB8, 0x7F, 0x98, 0xDB, 0x7F, 0x98, 0xDB, 0x63, 0x8E, 0x8F, 0x91, 0x7F, 0x98, 0xD2, 0x7F,
-    0x98, 0xD2, 0x7F, 0x98, 0xD2, 0xE4, 0x02, 0x21, 0x2E, 0xD0, 0xD1, 0x2D, 0x7F, 0xB2, 0xA7, 0x7F,
-    0xFF, 0xEA, 0x7F, 0xFF, 0xF3, 0x7F, 0x91, 0x79, 0x71, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86,
-    0x87, 0x8C, 0x8E, 0x8A, 0x91, 0x88, 0x89, 0x8B, 0x8D, 0x8F, 0x7F, 0x98, 0x99, 0x7F, 0x98, 0x99,
-    0x7F, 0xFF, 0xB8, 0x7F, 0xFF, 0xCA, 0x7F, 0x99, 0x28, 0x7F, 0x98, 0x0C, 0x7F, 0x99, 0x28, 0x7F,
-    0x98, 0x99, 0x7F, 0xFF, 0xED, 0x7F, 0xDC, 0xF3, 0x7F, 0x9C, 0x3C, 0x7F, 0x95, 0x75, 0x7F, 0x95,
-    0x75, 0x7F, 0x95, 0x75, 0x7F, 0x95, 0x75, 0x7F, 0x95, 0x75, 0x7F, 0x95, 0x75, 0xC2, 0x02, 0xB1,
-    0xD0, 0xD1, 0xFF, 0x32, 0xFF, 0xBB, 0x64, 0xB1, 0xB3, 0xB4, 0xB8, 0x7F, 0xCD, 0x3A, 0x7F, 0x95,
-    0x7C, 0x7F, 0x97, 0x24, 0x7F, 0xED, 0xC9, 0x63, 0x81, 0x85, 0x88, 0x7F, 0x91, 0x35, 0x7F, 0x91,
-    0x35, 0x7F, 0x9E, 0x81, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE2, 0x7F, 0xFF, 0xF3, 0x7F, 0x90,
-    0xFA, 0x41, 0xBF, 0xC3, 0xED, 0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xFC, 0x7F, 0x90, 0xE9, 0x70, 0xB2,
-    0xB5, 0xB8, 0xBC, 0xBD, 0xB0, 0xB1, 0xB3, 0xB4, 0xB6, 0xB7, 0xB9, 0xBA, 0xBB, 0xBE, 0xBF, 0x7F,
-    0xA5, 0xF2, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xF7, 0x7F, 0x98, 0xA2, 0x7F, 0x98, 0x13, 0x7F, 0x94,
-    0xEF, 0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF,
-    0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF, 0x71,
-    0x80, 0x8C, 0x8A, 0x91, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8B, 0x8D, 0x8E,
-    0x8F, 0x7F, 0x97, 0xD2, 0x7F, 0xF7, 0x94, 0x7F, 0x9B, 0x75, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE,
-    0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F,
-    0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F, 0x94,
-    0xAE, 0x7F, 0x94, 0xAE, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xFF, 0x7A, 0xFF, 0xBB, 0x63, 0xB3, 0xB4,
-    0xBB, 0x7F, 0x90, 0x46, 0x7F, 0x96, 0x45, 0x7F, 0x90, 0x46, 0xA0, 0x02, 0x42, 0x63, 0x80, 0x81,
-    0x85, 0x7F, 0xFF, 0xFD, 0x7F, 0x90, 0x36, 0x7F, 0x91, 0x4A, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF,
-    0xE3, 0x7F, 0xFF, 0xF3, 0x7F, 0x90, 0x34, 0x70, 0xB5, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xB7,
-    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x7F, 0xFF, 0xF3, 0x7F, 0x94, 0x36, 0x7F, 0x94,
-    0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36,
-    0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F,
-    0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0xE2, 0x01, 0xB1, 0xD0, 0x2D, 0x7F, 0x9F, 0x37,
-    0x7F, 0x8F, 0xE6, 0x21, 0x80, 0x97, 0x62, 0xD1, 0x2D, 0x7F, 0xFF, 0xFD, 0x7F, 0x8F, 0xD8, 0x71,
-    0x8E, 0x8F, 0x91, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C,
-    0x8D, 0x7F, 0x97, 0x15, 0x7F, 0xFF, 0xE9, 0x7F, 0xFF, 0xF7, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE,
-    0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F,
-    0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93,
-    0xDE, 0x7F, 0x93, 0xDE, 0xC2, 0x00, 0x91, 0xD0, 0xD1, 0xFF, 0x63, 0xFF, 0xBB, 0x64, 0xB0, 0xB8,
-    0xBB, 0xBD, 0x7F, 0x8F, 0x9C, 0x7F, 0x8F, 0x9C, 0x7F, 0x8F, 0x76, 0x7F, 0x8F, 0xE0, 0x62, 0xD0,
-    0x2D, 0x7F, 0xFF, 0xEF, 0x7F, 0x8F, 0x70, 0x62, 0xB5, 0xBE, 0x7F, 0x8F, 0x5C, 0x7F, 0x90, 0x80,
-    0x42, 0xD0, 0xD1, 0xFF, 0xF7, 0xCA, 0x32, 0x21, 0x80, 0xF9, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0x95,
-    0xBF, 0x7F, 0xFF, 0xFD, 0x7F, 0x8F, 0x54, 0x64, 0xB2, 0xB4, 0xBB, 0xBD, 0x7F, 0x92, 0x87, 0x7F,
-    0x8F, 0x3C, 0x7F, 0x8F, 0xA6, 0x7F, 0xB9, 0x0D, 0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xEF, 0x7F, 0x8F,
-    0x36, 0xE2, 0x01, 0xB1, 0xD0, 0x2D, 0x7F, 0xD9, 0x81, 0x7F, 0x8F, 0x2D, 0xC1, 0x01, 0xB1, 0xD0,
-    0xAC, 0x2F, 0x63, 0xB2, 0xBB, 0xBE, 0x7F, 0x90, 0x35, 0x7F, 0xFF, 0xFA, 0x7F, 0x91, 0x9A, 0x63,
-    0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF3, 0x7F, 0x97, 0xDC, 0x7F, 0x8F, 0x0F, 0x61, 0xBB, 0x7F, 0x9B,
-    0x19, 0x21, 0xD0, 0xFB, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x62, 0xD0, 0x2D,
-    0x7F, 0xFF, 0xFD, 0x7F, 0x8E, 0xF1, 0x62, 0xD0, 0x2D, 0x7F, 0xF1, 0xC9, 0x7F, 0x8E, 0xE8, 0x70,
-    0xB1, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xB0, 0xB2, 0xB9, 0xBE,
-    0x7F, 0x95, 0x4E, 0x7F, 0xFF, 0x6F, 0x7F, 0xFF, 0x8B, 0x7F, 0x96, 0x25, 0x7F, 0xB7, 0xB2, 0x7F,
-    0xFF, 0xA9, 0x7F, 0xFF, 0xB2, 0x7F, 0xFF, 0xD0, 0x7F, 0xBC, 0x15, 0x7F, 0xF1, 0x6B, 0x7F, 0xFF,
-    0xEE, 0x7F, 0xFF, 0xF7, 0x7F, 0x92, 0xEE, 0x7F, 0x92, 0xEE, 0x7F, 0x92, 0xEE, 0x7F, 0x92, 0xEE,
-    0x41, 0xD1, 0xB1, 0x5D, 0x63, 0xB0, 0xB2, 0xB5, 0x7F, 0xDF, 0x1F, 0x7F, 0x8E, 0x8F, 0x7F, 0xFF,
-    0xFC, 0x42, 0x8C, 0x91, 0xA2, 0xEE, 0xFF, 0xEF, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xEC, 0x7F,
-    0xFF, 0xF9, 0x7F, 0x8E, 0x86, 0x62, 0xD0, 0xD1, 0x7F, 0x8E, 0xAA, 0x7F, 0x93, 0xE9, 0x66, 0xB0,
-    0xB5, 0xBA, 0xBD, 0xBE, 0xBF, 0x7F, 0x8E, 0x8B, 0x7F, 0x8E, 0x8B, 0x7F, 0xFF, 0xF7, 0x7F, 0x8E,
-    0xCF, 0x7F, 0x8E, 0x8B, 0x7F, 0x8E, 0x65, 0x64, 0x85, 0x87, 0x88, 0x91, 0x7F, 0x8E, 0xB6, 0x7F,
-    0x8E, 0x4C, 0x7F, 0x8E, 0xB6, 0x7F, 0x8E, 0x72, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xD6, 0x7F,
-    0xFF, 0xEF, 0x7F, 0x8E, 0x46, 0x62, 0x80, 0x8C, 0x7F, 0x8E, 0x2E, 0x7F, 0xBA, 0x58, 0x63, 0xD0,
-    0xD1, 0x2D, 0x7F, 0xCC, 0xC6, 0x7F, 0xFF, 0xF7, 0x7F, 0x8E, 0x30, 0x63, 0xD0, 0xD1, 0x2D, 0x7F,
-    0x8F, 0x3F, 0x7F, 0xB1, 0x94, 0x7F, 0x8E, 0x23, 0x41, 0xB2, 0xA9, 0x96, 0x62, 0xD0, 0x2D, 0x7F,
-    0xFF, 0xFC, 0x7F, 0x8E, 0x12, 0x71, 0x80, 0x81, 0x82, 0x83, 0x88, 0x8F, 0x91, 0x84, 0x85, 0x86,
-    0x87, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x7F, 0xFF, 0x83, 0x7F, 0xFF, 0xC3, 0x7F, 0xFF, 0xD9,
-    0x7F, 0x95, 0x4F, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xF7, 0x7F, 0x92, 0x18, 0x7F, 0x92, 0x18, 0x7F,
-    0x92, 0x18, 0x7F, 0x92, 0x18, 0x7F, 0x92, 0x18, 0x7F, 0x92, 0x18, 0x7F, 0x92, 0x18, 0x7F, 0x92,
-    0x18, 0x7F, 0x92, 0x18, 0x7F, 0x92, 0x18, 0x7F, 0x92, 0x18, 0xC2, 0x00, 0x91, 0xD0, 0xD1, 0xFE,
-    0xE5, 0xFF, 0xBB, 0x41, 0xD1, 0x9E, 0x4E, 0x21, 0xB0, 0xFC, 0xE2, 0x01, 0xB1, 0xD0, 0x2D, 0x7F,
-    0xFF, 0xFD, 0x7F, 0x8D, 0xB4, 0x62, 0xD1, 0x2D, 0x7F, 0x9A, 0x84, 0x7F, 0x8D, 0xA9, 0x62, 0xD1,
-    0x2D, 0x7F, 0xDB, 0x51, 0x7F, 0x8D, 0xA0, 0x62, 0xB7, 0xBA, 0x7F, 0x92, 0x9F, 0x7F, 0x8D, 0xC5,
-    0xE3, 0x00, 0xA1, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF7, 0x7F, 0xED, 0xC8, 0x7F, 0x8D, 0x8E, 0x62,
-    0xD0, 0x2D, 0x7F, 0x8E, 0xCA, 0x7F, 0x8D, 0x7F, 0x62, 0xB4, 0xBA, 0x7F, 0x8D, 0x82, 0x7F, 0x8D,
-    0x82, 0x21, 0xD0, 0xF7, 0x62, 0xB8, 0xBE, 0x7F, 0xFF, 0xFD, 0x7F, 0x8D, 0xC6, 0x62, 0xD0, 0x2D,
-    0x7F, 0xFF, 0xF7, 0x7F, 0x8D, 0x61, 0x41, 0xB5, 0xAA, 0x01, 0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xFC,
-    0x7F, 0x8D, 0x54, 0x61, 0xBE, 0x7F, 0x8D, 0xCF, 0x21, 0xD0, 0xFB, 0x21, 0x82, 0xFD, 0x63, 0xD0,
-    0xD1, 0x2D, 0x7F, 0x8E, 0x5C, 0x7F, 0xFF, 0xFD, 0x7F, 0x8D, 0x40, 0x70, 0xB1, 0xB2, 0xB4, 0xB5,
-    0xB7, 0xB8, 0xBA, 0xBC, 0xBD, 0xBE, 0xBF, 0xB0, 0xB3, 0xB6, 0xB9, 0xBB, 0x7F, 0xFF, 0x7F, 0x7F,
-    0xFF, 0x8A, 0x7F, 0xFF, 0x93, 0x7F, 0xFF, 0xA5, 0x7F, 0xFF, 0xB4, 0x7F, 0xD8, 0xC0, 0x7F, 0x93,
-    0xA2, 0x7F, 0xFF, 0xD2, 0x7F, 0xFF, 0xDF, 0x7F, 0xBF, 0x11, 0x7F, 0xFF, 0xF3, 0x7F, 0x91, 0x42,
-    0x7F, 0x91, 0x42, 0x7F, 0x91, 0x42, 0x7F, 0x91, 0x42, 0x7F, 0x91, 0x42, 0x62, 0xBA, 0xBD, 0x7F,
-    0x8C, 0xE7, 0x7F, 0x8D, 0x51, 0x62, 0xD0, 0xD1, 0x7F, 0x8D, 0x9A, 0x7F, 0x99, 0xC4, 0x21, 0x82,
-    0xF7, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xEB, 0x7F, 0xFF, 0xFD, 0x7F, 0x8C, 0xDD, 0x41, 0xBC,
-    0xDF, 0xBC, 0x21, 0xD0, 0xFC, 0x64, 0xB0, 0xB8, 0xBC, 0xBE, 0x7F, 0xFF, 0xFD, 0x7F, 0xB1, 0x19,
-    0x7F, 0x8D, 0x28, 0x7F, 0x8F, 0x99, 0x62, 0xB0, 0xB5, 0x7F, 0xBD, 0xBE, 0x7F, 0x8C, 0xAD, 0x62,
-    0x83, 0x8B, 0x7F, 0x8C, 0xA4, 0x7F, 0x8C, 0xA4, 0x22, 0xD0, 0xD1, 0xEE, 0xF7, 0x21, 0x80, 0xFB,
-    0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xD5, 0x7F, 0xFF, 0xFD, 0x7F, 0x8C, 0x9E, 0x61, 0xB7, 0x7F,
-    0x8F, 0x1F, 0xA1, 0x01, 0xE1, 0xD0, 0xFB, 0x21, 0xBE, 0xFB, 0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xFD,
-    0x7F, 0x8C, 0x84, 0x62, 0xB0, 0xB5, 0x7F, 0x8C, 0xDA, 0x7F, 0x8C, 0xDA, 0x62, 0x83, 0x91, 0x7F,
-    0x8C, 0xD1, 0x7F, 0x8C, 0xD1, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xF7, 0x7F,
-    0x8C, 0x69, 0x41, 0xD1, 0x9D, 0xA5, 0x62, 0xB2, 0xB3, 0x7F, 0x8C, 0x86, 0x7F, 0xFF, 0xFC, 0xE2,
-    0x00, 0xA1, 0xD0, 0x2D, 0x7F, 0xFF, 0xF7, 0x7F, 0x8C, 0x4F, 0x61, 0xB7, 0x7F, 0x91, 0x4C, 0xE2,
-    0x00, 0xA1, 0xD0, 0x2D, 0x7F, 0xFF, 0xFB, 0x7F, 0x8C, 0x3F, 0x71, 0x81, 0x82, 0x85, 0x89, 0x8E,
-    0x8F, 0x91, 0x80, 0x83, 0x84, 0x86, 0x87, 0x88, 0x8A, 0x8B, 0x8C, 0x8D, 0x7F, 0xFF, 0x57, 0x7F,
-    0xFF, 0x96, 0x7F, 0xFF, 0xB0, 0x7F, 0xFF, 0xCB, 0x7F, 0xBE, 0x12, 0x7F, 0xFF, 0xE5, 0x7F, 0xFF,
-    0xF5, 0x7F, 0x90, 0x43, 0x7F, 0x90, 0x43, 0x7F, 0x90, 0x43, 0x7F, 0x90, 0x43, 0x7F, 0x90, 0x43,
-    0x7F, 0x90, 0x43, 0x7F, 0x90, 0x43, 0x7F, 0x90, 0x43, 0x7F, 0x90, 0x43, 0x7F, 0x90, 0x43, 0xC2,
-    0x00, 0x91, 0xD0, 0xD1, 0xFE, 0xBC, 0xFF, 0xBB, 0xE2, 0x00, 0x91, 0xD1, 0x2D, 0x7F, 0x8D, 0x99,
-    0x7F, 0x8B, 0xE6, 0xE1, 0x01, 0xF1, 0xD1, 0x7F, 0x8E, 0xB4, 0x21, 0x81, 0xF9, 0x63, 0xD0, 0xD1,
-    0x2D, 0x7F, 0x8F, 0xC2, 0x7F, 0xFF, 0xFD, 0x7F, 0x8B, 0xD1, 0x61, 0xB5, 0x7F, 0x95, 0x46, 0x62,
-    0xD0, 0x2D, 0x7F, 0xFF, 0xFB, 0x7F, 0x8B, 0xBF, 0xE2, 0x00, 0xA1, 0xD0, 0x2D, 0x7F, 0x8B, 0xD4,
-    0x7F, 0x8B, 0xB6, 0xE2, 0x00, 0xA1, 0xD1, 0x2D, 0x7F, 0xAF, 0x1C, 0x7F, 0x8B, 0xAB, 0x62, 0xD0,
-    0x2D, 0x7F, 0xAC, 0x49, 0x7F, 0x8B, 0xA0, 0x41, 0xB8, 0xEC, 0x42, 0xE2, 0x00, 0xA1, 0xD0, 0x2D,
-    0x7F, 0xFF, 0xFC, 0x7F, 0x8B, 0x93, 0x70, 0xB2, 0xB3, 0xB4, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
-    0xB0, 0xB1, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0x7F, 0xFF, 0xA2, 0x7F, 0x93, 0x4A, 0x7F, 0x96, 0x38,
-    0x7F, 0xFF, 0xB7, 0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xD2, 0x7F, 0xFF, 0xDD, 0x7F, 0xFF, 0xE8, 0x7F,
-    0xFF, 0xF5, 0x7F, 0x8F, 0x97, 0x7F, 0x8F, 0x97, 0x7F, 0x8F, 0x97, 0x7F, 0x8F, 0x97, 0x7F, 0x8F,
-    0x97, 0x7F, 0x8F, 0x97, 0x7F, 0x8F, 0x97, 0xC1, 0x00, 0x91, 0xD1, 0x9E, 0x1A, 0x63, 0xB5, 0xB8,
-    0xBE, 0x7F, 0x8B, 0x86, 0x7F, 0xFF, 0xFA, 0x7F, 0xA5, 0x4F, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF,
-    0xF3, 0x7F, 0xAA, 0x86, 0x7F, 0x8B, 0x34, 0x63, 0xBA, 0xBC, 0xBE, 0x7F, 0x8B, 0x78, 0x7F, 0x8B,
-    0x6F, 0x7F, 0x8B, 0x86, 0x62, 0xD0, 0xD1, 0x7F, 0xAD, 0xE8, 0x7F, 0x8C, 0xD7, 0x21, 0x82, 0xF7,
-    0xE3, 0x01, 0x31, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE7, 0x7F, 0xFF, 0xFD, 0x7F, 0x8B, 0x0E, 0x41,
-    0xBB, 0xE4, 0xD6, 0x21, 0xD0, 0xFC, 0x62, 0xB5, 0xB8, 0x7F, 0x8B, 0x57, 0x7F, 0xFF, 0xFD, 0x63,
-    0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF7, 0x7F, 0x93, 0xA6, 0x7F, 0x8A, 0xEF, 0xE2, 0x01, 0xB1, 0xD0,
-    0x2D, 0x7F, 0xA9, 0x47, 0x7F, 0x8A, 0xE2, 0x71, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x8F, 0x91,
-    0x83, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x7F, 0xFF, 0xA3, 0x7F, 0xFF, 0xC9, 0x7F,
-    0xFF, 0xE8, 0x7F, 0xBC, 0xB5, 0x7F, 0xFF, 0xF5, 0x7F, 0xBC, 0xB5, 0x7F, 0x92, 0x1D, 0x7F, 0x8E,
-    0xE6, 0x7F, 0x8E, 0xE6, 0x7F, 0x8E, 0xE6, 0x7F, 0x8E, 0xE6, 0x7F, 0x8E, 0xE6, 0x7F, 0x8E, 0xE6,
-    0x7F, 0x8E, 0xE6, 0x7F, 0x8E, 0xE6, 0x7F, 0x8E, 0xE6, 0x7F, 0x8E, 0xE6, 0xC2, 0x02, 0xB1, 0xD0,
-    0xD1, 0xFF, 0x0A, 0xFF, 0xBB, 0x61, 0xB5, 0x7F, 0x8B, 0xA2, 0x21, 0xD0, 0xFB, 0x21, 0x80, 0xFD,
-    0xE3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0x7F, 0xC3, 0xD3, 0x7F, 0xFF, 0xFD, 0x7F, 0x8A, 0x7E, 0x62,
-    0xD1, 0x2D, 0x7F, 0xED, 0x04, 0x7F, 0x8A, 0x6F, 0x63, 0xB3, 0xB8, 0xBE, 0x7F, 0x8A, 0x5B, 0x7F,
-    0xB5, 0x6B, 0x7F, 0x8A, 0xAB, 0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xF3, 0x7F, 0x8A, 0x59, 0x61, 0xD0,
-    0x7F, 0x90, 0xBB, 0x21, 0xB0, 0xFB, 0x21, 0xD0, 0xFD, 0x21, 0xB4, 0xFD, 0xE2, 0x00, 0x91, 0xD0,
-    0x2D, 0x7F, 0xFF, 0xFD, 0x7F, 0x8A, 0x42, 0x61, 0xB2, 0x7F, 0x8B, 0x50, 0xE2, 0x00, 0x91, 0xD0,
-    0x2D, 0x7F, 0xFF, 0xFB, 0x7F, 0x8A, 0x32, 0x63, 0xB0, 0xB5, 0xB8, 0x7F, 0x8A, 0x6C, 0x7F, 0x8A,
-    0x6C, 0x7F, 0x8A, 0x86, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF3, 0x7F, 0xA1, 0xB2, 0x7F, 0x8A,
-    0x1A, 0xE1, 0x07, 0xB2, 0x2D, 0x7F, 0x8A, 0x0D, 0x70, 0xB0, 0xB1, 0xB2, 0xB4, 0xB5, 0xB7, 0xB8,
-    0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xB3, 0xB6, 0xB9, 0xBF, 0x7F, 0x90, 0xAC, 0x7F, 0xFF, 0x88, 0x7F,
-    0x90, 0xAC, 0x7F, 0xFF, 0x97, 0x7F, 0x90, 0xAC, 0x7F, 0xFF, 0xAD, 0x7F, 0xFF, 0xC4, 0x7F, 0xFF,
-    0xD4, 0x7F, 0xFF, 0xEC, 0x7F, 0xD9, 0xCE, 0x7F, 0xB7, 0x3C, 0x7F, 0xFF, 0xF9, 0x7F, 0x8E, 0x15,
-    0x7F, 0x8E, 0x15, 0x7F, 0x8E, 0x15, 0x7F, 0x8E, 0x15, 0x61, 0xBC, 0x7F, 0x8C, 0x87, 0xA1, 0x00,
-    0x91, 0xD0, 0xFB, 0xC1, 0x00, 0x91, 0xD1, 0xB5, 0x48, 0x64, 0xB0, 0xB5, 0xB8, 0xBE, 0x7F, 0x89,
-    0xFA, 0x7F, 0xFF, 0xF5, 0x7F, 0xFF, 0xFA, 0x7F, 0x89, 0xFA, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF,
-    0xEF, 0x7F, 0xA8, 0xF6, 0x7F, 0x89, 0xA4, 0x63, 0xB0, 0xB5, 0xBE, 0x7F, 0x89, 0xDC, 0x7F, 0x89,
-    0xDC, 0x7F, 0x89, 0xDC, 0x61, 0x8F, 0x7F, 0x89, 0xCF, 0x22, 0xD0, 0xD1, 0xEE, 0xFB, 0x21, 0x82,
-    0xFB, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xC6, 0xFE, 0x7F, 0xFF, 0xFD, 0x7F, 0x89, 0x7D, 0x62, 0xB8,
-    0xBE, 0x7F, 0x89, 0xB5, 0x7F, 0x89, 0xB5, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF7, 0x7F, 0xA8,
-    0xB9, 0x7F, 0x89, 0x67, 0x41, 0xB0, 0xA5, 0xBF, 0xE2, 0x00, 0x91, 0xD0, 0x2D, 0x7F, 0xFF, 0xFC,
-    0x7F, 0x89, 0x56, 0x71, 0x80, 0x81, 0x82, 0x85, 0x87, 0x89, 0x8F, 0x91, 0x83, 0x84, 0x86, 0x88,
-    0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x7F, 0xFF, 0xA7, 0x7F, 0xFF, 0xCE, 0x7F, 0xFF, 0xE4, 0x7F, 0xFF,
-    0xF5, 0x7F, 0x8F, 0xF1, 0x7F, 0xB6, 0x81, 0x7F, 0x8F, 0xF1, 0x7F, 0x8F, 0xF1, 0x7F, 0x8D, 0x5A,
-    0x7F, 0x8D, 0x5A, 0x7F, 0x8D, 0x5A, 0x7F, 0x8D, 0x5A, 0x7F, 0x8D, 0x5A, 0x7F, 0x8D, 0x5A, 0x7F,
-    0x8D, 0x5A, 0x7F, 0x8D, 0x5A, 0x7F, 0x8D, 0x5A, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xFF, 0x00, 0xFF,
-    0xBB, 0x63, 0xB0, 0xB5, 0xB8, 0x7F, 0x89, 0x2B, 0x7F, 0x89, 0x45, 0x7F, 0x89, 0x2B, 0x62, 0x8E,
-    0x91, 0x7F, 0x89, 0x38, 0x7F, 0x89, 0x38, 0xA2, 0x00, 0xA1, 0xD0, 0xD1, 0xEA, 0xF7, 0x21, 0x80,
-    0xF9, 0x62, 0xD1, 0x2D, 0x7F, 0xFF, 0xFD, 0x7F, 0x88, 0xDD, 0x61, 0xD0, 0x7F, 0x92, 0xEF, 0x62,
-    0xB8, 0xBE, 0x7F, 0xFF, 0xFB, 0x7F, 0x89, 0x14, 0x62, 0x83, 0x85, 0x7F, 0x89, 0x0B, 0x7F, 0x9E,
-    0xBC, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xF7, 0x7F, 0x88, 0xBD, 0x62, 0xBB,
-    0xBD, 0x7F, 0x89, 0xC9, 0x7F, 0x89, 0x0F, 0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xF7, 0x7F, 0x88, 0xA7,
-    0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0x96, 0x1D, 0x7F, 0x8A, 0x51, 0x7F, 0x88, 0x9E, 0x62, 0xB3, 0xBE,
-    0x7F, 0x9B, 0xC3, 0x7F, 0x88, 0xD6, 0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xF7, 0x7F, 0x88, 0x88, 0x62,
-    0xB2, 0xBB, 0x7F, 0x89, 0x98, 0x7F, 0x89, 0x98, 0xE3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF,
-    0xF7, 0x7F, 0x91, 0x43, 0x7F, 0x88, 0x76, 0xE2, 0x00, 0x91, 0xD1, 0x2D, 0x7F, 0x8A, 0x2C, 0x7F,
-    0x88, 0x67, 0x41, 0xB1, 0xCC, 0x25, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xFC, 0x7F, 0x8A, 0x1D,
-    0x7F, 0x88, 0x58, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0x88, 0x69, 0x7F, 0xA1, 0x99, 0x7F, 0x88, 0x4B,
-    0x70, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xB0, 0xB6, 0xB9, 0xBE,
-    0xBF, 0x7F, 0xFF, 0x61, 0x7F, 0xFF, 0x81, 0x7F, 0xFF, 0x97, 0x7F, 0xFF, 0xA0, 0x7F, 0x8E, 0xE4,
-    0x7F, 0xFF, 0xB6, 0x7F, 0x8E, 0xE4, 0x7F, 0xFF, 0xC8, 0x7F, 0xFF, 0xD7, 0x7F, 0xFF, 0xE6, 0x7F,
-    0xFF, 0xF3, 0x7F, 0x8C, 0x4D, 0x7F, 0x8C, 0x4D, 0x7F, 0x8C, 0x4D, 0x7F, 0x8C, 0x4D, 0x7F, 0x8C,
-    0x4D, 0x63, 0xB0, 0xB8, 0xBE, 0x7F, 0x88, 0x42, 0x7F, 0x88, 0x42, 0x7F, 0x88, 0x42, 0x63, 0xD0,
-    0xD1, 0x2D, 0x7F, 0xFF, 0xF3, 0x7F, 0xEA, 0x85, 0x7F, 0x87, 0xF0, 0x62, 0xBA, 0xBB, 0x7F, 0x88,
-    0x11, 0x7F, 0x88, 0x11, 0x62, 0xB2, 0xBE, 0x7F, 0x87, 0xE6, 0x7F, 0x88, 0x1F, 0xE2, 0x01, 0xB1,
-    0xD0, 0xD1, 0x7F, 0xFF, 0xF7, 0x7F, 0x8D, 0xD9, 0x21, 0x82, 0xF5, 0x63, 0xD0, 0xD1, 0x2D, 0x7F,
-    0xFF, 0xE0, 0x7F, 0xFF, 0xFD, 0x7F, 0x87, 0xC3, 0xE1, 0x00, 0xD1, 0xD0, 0x7F, 0x8A, 0x30, 0x64,
-    0xB0, 0xB2, 0xB8, 0xBE, 0x7F, 0x87, 0xF4, 0x7F, 0x87, 0xF7, 0x7F, 0xFF, 0xF9, 0x7F, 0x87, 0xF4,
-    0x64, 0x83, 0x8B, 0x8C, 0x8F, 0x7F, 0x87, 0xE3, 0x7F, 0x87, 0xE3, 0x7F, 0xB3, 0xBD, 0x7F, 0x87,
-    0xE3, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xDE, 0x7F, 0xFF, 0xEF, 0x7F, 0x87, 0x8D, 0x63, 0xD0,
-    0xD1, 0x2D, 0x7F, 0x8B, 0x71, 0x7F, 0xB6, 0x2D, 0x7F, 0x87, 0x80, 0x61, 0xB5, 0x7F, 0x87, 0xCF,
-    0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xFB, 0x7F, 0x87, 0x6E, 0x71, 0x80, 0x81, 0x82, 0x83, 0x85, 0x86,
-    0x88, 0x8E, 0x8F, 0x91, 0x84, 0x87, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x7F, 0xFF, 0x75, 0x7F, 0xFF,
-    0xA2, 0x7F, 0xFF, 0xD8, 0x7F, 0x8E, 0x0B, 0x7F, 0xFF, 0xE5, 0x7F, 0xFF, 0xF7, 0x7F, 0x8D, 0xD4,
-    0x7F, 0xEE, 0x5A, 0x7F, 0x8E, 0x98, 0x7F, 0x8B, 0x74, 0x7F, 0x8B, 0x74, 0x7F, 0x8B, 0x74, 0x7F,
-    0x8B, 0x74, 0x7F, 0x8B, 0x74, 0x7F, 0x8B, 0x74, 0x7F, 0x8B, 0x74, 0x7F, 0x8B, 0x74, 0x42, 0xD0,
-    0xD1, 0xFE, 0xE2, 0xFF, 0xBB, 0x42, 0xD0, 0xD1, 0xAA, 0xB2, 0xB2, 0x96, 0x21, 0x80, 0xF9, 0xE2,
-    0x02, 0x21, 0xD1, 0x2D, 0x7F, 0xFF, 0xFD, 0x7F, 0x87, 0x0F, 0x62, 0xB5, 0xBE, 0x7F, 0x87, 0x49,
-    0x7F, 0x87, 0x49, 0x61, 0xB5, 0x7F, 0x90, 0x80, 0x21, 0xD0, 0xFB, 0x62, 0x80, 0x83, 0x7F, 0xFF,
-    0xFD, 0x7F, 0x87, 0x38, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xF7, 0x7F, 0x86,
-    0xEA, 0x61, 0x88, 0x7F, 0x8F, 0x48, 0x21, 0xD1, 0xFB, 0x42, 0x80, 0x83, 0xE5, 0x61, 0xFF, 0xFD,
-    0x62, 0xD1, 0x2D, 0x7F, 0xFF, 0xF9, 0x7F, 0x86, 0xCE, 0x62, 0xD0, 0x2D, 0x7F, 0x9C, 0x68, 0x7F,
-    0x86, 0xC5, 0x62, 0xB3, 0xBC, 0x7F, 0x8A, 0x08, 0x7F, 0x87, 0x01, 0x21, 0xD0, 0xF7, 0x62, 0xB5,
-    0xBE, 0x7F, 0x86, 0xCB, 0x7F, 0xFF, 0xFD, 0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xF7, 0x7F, 0x86, 0xA7,
-    0x63, 0xB0, 0xB8, 0xBE, 0x7F, 0x86, 0xE3, 0x7F, 0x86, 0xE3, 0x7F, 0x90, 0x23, 0x62, 0x80, 0x83,
-    0x7F, 0xA2, 0x8B, 0x7F, 0x86, 0xD6, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xEA, 0x7F, 0xFF, 0xF7,
-    0x7F, 0x86, 0x88, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xE8, 0xDC, 0x7F, 0xA5, 0xCD, 0x7F, 0x86, 0x7B,
-    0x62, 0x83, 0x87, 0x7F, 0xA2, 0xDF, 0x7F, 0x86, 0xCD, 0x62, 0xD1, 0x2D, 0x7F, 0xFF, 0xF7, 0x7F,
-    0x86, 0x65, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xA2, 0xE7, 0x7F, 0x9F, 0xAA, 0x7F, 0x86, 0x5C, 0x62,
-    0x83, 0x8B, 0x7F, 0x86, 0x7D, 0x7F, 0x86, 0x6A, 0xE2, 0x00, 0xA1, 0xD0, 0xD1, 0x7F, 0x86, 0x64,
-    0x7F, 0xFF, 0xF7, 0x65, 0xB0, 0xB5, 0xBB, 0xBD, 0xBE, 0x7F, 0xF8, 0x80, 0x7F, 0x87, 0x10, 0x7F,
-    0xFF, 0xF5, 0x7F, 0x98, 0xFF, 0x7F, 0x87, 0x10, 0x61, 0x82, 0x7F, 0x98, 0xEA, 0x63, 0xD0, 0xD1,
-    0x2D, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xFB, 0x7F, 0x86, 0x21, 0x70, 0xB1, 0xB2, 0xB4, 0xB6, 0xB7,
-    0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xB0, 0xB3, 0xB5, 0xB8, 0xB9, 0xBE, 0x7F, 0xFF, 0x05, 0x7F, 0xFF,
-    0x2A, 0x7F, 0xFF, 0x46, 0x7F, 0xFF, 0x4F, 0x7F, 0xFF, 0x6D, 0x7F, 0xFF, 0x8C, 0x7F, 0xFF, 0x99,
-    0x7F, 0xFF, 0xAF, 0x7F, 0xFF, 0xB8, 0x7F, 0xFF, 0xF3, 0x7F, 0x8A, 0x23, 0x7F, 0x8A, 0x23, 0x7F,
-    0x8A, 0x23, 0x7F, 0x8A, 0x23, 0x7F, 0x8A, 0x23, 0x7F, 0x8A, 0x23, 0xE1, 0x00, 0x91, 0x2E, 0x7F,
-    0x85, 0xEE, 0x64, 0xB0, 0xB5, 0xB8, 0xBE, 0x7F, 0x86, 0x11, 0x7F, 0xFF, 0xF9, 0x7F, 0x86, 0x11,
-    0x7F, 0x86, 0x11, 0x63, 0x81, 0x83, 0x8B, 0x7F, 0xA4, 0x9E, 0x7F, 0x86, 0x00, 0x7F, 0x86, 0x00,
-    0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE2, 0x7F, 0xFF, 0xF3, 0x7F, 0x85, 0xAE, 0x61, 0x2E, 0x7F,
-    0x86, 0xBA, 0x62, 0xB0, 0xB5, 0x7F, 0xFF, 0xFB, 0x7F, 0x85, 0xFB, 0xC2, 0x00, 0x91, 0xD0, 0xD1,
-    0xFF, 0xF7, 0xA4, 0xC7, 0x64, 0xB0, 0xBA, 0xBB, 0xBE, 0x7F, 0x86, 0x0E, 0x7F, 0xFF, 0xF7, 0x7F,
-    0x86, 0x5F, 0x7F, 0x85, 0xA5, 0xE2, 0x00, 0x91, 0xD0, 0xD1, 0x7F, 0xC7, 0x8A, 0x7F, 0x86, 0x61,
-    0x21, 0x82, 0xF5, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE1, 0x7F, 0xFF, 0xFD, 0x7F, 0x85, 0x6B,
-    0x64, 0xB0, 0xB5, 0xB8, 0xBE, 0x7F, 0x85, 0xA3, 0x7F, 0xA5, 0x22, 0x7F, 0x85, 0xA3, 0x7F, 0xA5,
-    0x25, 0x65, 0x80, 0x83, 0x8B, 0x8E, 0x8F, 0x7F, 0x85, 0x7B, 0x7F, 0x85, 0x92, 0x7F, 0x85, 0x92,
-    0x7F, 0x85, 0x92, 0x7F, 0x85, 0x92, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF, 0xEB,
-    0x7F, 0x85, 0x38, 0x61, 0xBF, 0x7F, 0x8A, 0x33, 0x21, 0xD0, 0xFB, 0x44, 0xB0, 0xB2, 0xBB, 0xBE,
-    0xA5, 0x68, 0xA5, 0x6F, 0xA5, 0x7C, 0xFF, 0xFD, 0x61, 0x80, 0x7F, 0x8E, 0x24, 0x63, 0xD0, 0xD1,
-    0x2D, 0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xFB, 0x7F, 0x85, 0x11, 0x71, 0x80, 0x81, 0x82, 0x85, 0x91,
-    0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x7F, 0xFF, 0x56, 0x7F,
-    0xFF, 0x99, 0x7F, 0xFF, 0xCC, 0x7F, 0xFF, 0xF3, 0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13, 0x7F, 0x89,
-    0x13, 0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13,
-    0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13, 0x42,
-    0xD0, 0xD1, 0xFE, 0xAB, 0xFF, 0xBB, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
-    0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xD8, 0xAB, 0xE0, 0x28, 0xE5, 0xBB, 0xEA, 0x14,
-    0xEB, 0xFB, 0xEE, 0x6E, 0xEF, 0xBF, 0xF1, 0x70, 0xF3, 0x97, 0xF4, 0x5E, 0xF5, 0x2E, 0xF6, 0xF4,
-    0xF8, 0xC9, 0xFA, 0x26, 0xFB, 0xB2, 0xFD, 0x98, 0xFF, 0xF9, 0xA0, 0x0D, 0x01, 0xA0, 0x0D, 0x22,
-    0x30, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE,
-    0xBF, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0x31, 0x91, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C,
-    0x8D, 0x8E, 0x8F, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC,
-    0xDC, 0xDC, 0xDC, 0xDC, 0x42, 0xD0, 0xD1, 0xFF, 0xBC, 0xFF, 0xDD, 0x30, 0xB0, 0xB1, 0xB2, 0xB3,
-    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xF9, 0xF9, 0xF9, 0xF9,
-    0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0x31, 0x91, 0x80, 0x81,
-    0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0xD8, 0xD8,
-    0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xC3,
-    0x0C, 0xE2, 0x2D, 0xD0, 0xD1, 0xFF, 0x6B, 0xFF, 0xBC, 0xFF, 0xDD, 0x64, 0x2E, 0xD0, 0xD1, 0x2D,
-    0x7F, 0x83, 0xD1, 0x7F, 0xCF, 0xC7, 0x7F, 0xFF, 0x2B, 0x7F, 0xFF, 0xF4,
+constexpr uint8_t ru_trie_classes[256] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12,
+    0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+constexpr uint32_t ru_trie_dense[] = {
+    0x00000000u, 0x00000002u, 0x00000012u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000001Cu, 0x0000005Eu, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x000000A4u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x000000A8u, 0x000000EAu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000130u, 0x00000172u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x000001B8u, 0x000001C2u, 0x000001CCu, 0x000001D6u, 0x000001E2u, 0x000001ECu,
+    0x000001F6u, 0x00000202u, 0x0000020Cu, 0x00000216u, 0x00000222u, 0x0000022Cu, 0x00000236u, 0x00000242u,
+    0x0000024Cu, 0x00000256u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000262u,
+    0x0000026Cu, 0x00000276u, 0x00000280u, 0x0000028Au, 0x00000296u, 0x000002A0u, 0x000002ACu, 0x000002B6u,
+    0x000002C2u, 0x000002CEu, 0x000002DAu, 0x000002E6u, 0x000002F2u, 0x000002FEu, 0x0000030Au, 0x00000314u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u,
+};
+
+constexpr uint8_t ru_trie_nodes[] = {
+    0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x2D, 0xD0, 0xD1, 0xA4, 0x00, 0x00, 0xA8, 0x00, 0x00, 0xEA,
+    0x00, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x30, 0x01, 0x00, 0x72, 0x01, 0x00, 0x10, 0x00, 0xB0, 0xB1,
+    0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB8, 0x01,
+    0x00, 0xC2, 0x01, 0x00, 0xCC, 0x01, 0x00, 0xD6, 0x01, 0x00, 0xE2, 0x01, 0x00, 0xEC, 0x01, 0x00,
+    0xF6, 0x01, 0x00, 0x02, 0x02, 0x00, 0x0C, 0x02, 0x00, 0x16, 0x02, 0x00, 0x22, 0x02, 0x00, 0x2C,
+    0x02, 0x00, 0x36, 0x02, 0x00, 0x42, 0x02, 0x00, 0x4C, 0x02, 0x00, 0x56, 0x02, 0x00, 0x11, 0x00,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F,
+    0x91, 0x62, 0x02, 0x00, 0x6C, 0x02, 0x00, 0x76, 0x02, 0x00, 0x80, 0x02, 0x00, 0x8A, 0x02, 0x00,
+    0x96, 0x02, 0x00, 0xA0, 0x02, 0x00, 0xAC, 0x02, 0x00, 0xB6, 0x02, 0x00, 0xC2, 0x02, 0x00, 0xCE,
+    0x02, 0x00, 0xDA, 0x02, 0x00, 0xE6, 0x02, 0x00, 0xF2, 0x02, 0x00, 0xFE, 0x02, 0x00, 0x0A, 0x03,
+    0x00, 0x14, 0x03, 0x00, 0x00, 0x01, 0x04, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5,
+    0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x1E, 0x03, 0x00, 0x1E, 0x03, 0x00,
+    0x1E, 0x03, 0x00, 0x1E, 0x03, 0x00, 0x1E, 0x03, 0x00, 0x1E, 0x03, 0x00, 0x1E, 0x03, 0x00, 0x1E,
+    0x03, 0x00, 0x1E, 0x03, 0x00, 0x1E, 0x03, 0x00, 0x1E, 0x03, 0x00, 0x1E, 0x03, 0x00, 0x1E, 0x03,
+    0x00, 0x1E, 0x03, 0x00, 0x1E, 0x03, 0x00, 0x1E, 0x03, 0x00, 0x11, 0x00, 0x80, 0x81, 0x82, 0x83,
+    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x1E, 0x03, 0x00,
+    0x1E, 0x03, 0x00, 0x1E, 0x03, 0x00, 0x1E, 0x03, 0x00, 0x1E, 0x03, 0x00, 0x1E, 0x03, 0x00, 0x1E,
+    0x03, 0x00, 0x1E, 0x03, 0x00, 0x1E, 0x03, 0x00, 0x1E, 0x03, 0x00, 0x1E, 0x03, 0x00, 0x1E, 0x03,
+    0x00, 0x1E, 0x03, 0x00, 0x1E, 0x03, 0x00, 0x1E, 0x03, 0x00, 0x1E, 0x03, 0x00, 0x1E, 0x03, 0x00,
+    0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0x28, 0x03, 0x00, 0x36, 0x03, 0x00, 0x40, 0x03, 0x00, 0x4E, 0x03, 0x00, 0x58, 0x03,
+    0x00, 0x62, 0x03, 0x00, 0x6C, 0x03, 0x00, 0x72, 0x03, 0x00, 0x7C, 0x03, 0x00, 0x6C, 0x03, 0x00,
+    0x6C, 0x03, 0x00, 0x8A, 0x03, 0x00, 0x98, 0x03, 0x00, 0xA6, 0x03, 0x00, 0xB4, 0x03, 0x00, 0xC2,
+    0x03, 0x00, 0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B,
+    0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xD0, 0x03, 0x00, 0xDE, 0x03, 0x00, 0xEC, 0x03, 0x00, 0xF6, 0x03,
+    0x00, 0x6C, 0x03, 0x00, 0x04, 0x04, 0x00, 0x6C, 0x03, 0x00, 0x0E, 0x04, 0x00, 0x6C, 0x03, 0x00,
+    0x6C, 0x03, 0x00, 0x6C, 0x03, 0x00, 0x6C, 0x03, 0x00, 0x6C, 0x03, 0x00, 0x6C, 0x03, 0x00, 0x1C,
+    0x04, 0x00, 0x6C, 0x03, 0x00, 0x6C, 0x03, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x26, 0x04, 0x00, 0x68,
+    0x04, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xAE, 0x04, 0x00, 0xF0, 0x04, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x36, 0x05, 0x00, 0x78, 0x05, 0x00, 0x02, 0x01, 0x26, 0x00, 0xD0, 0xD1, 0xBE, 0x05, 0x00, 0x00,
+    0x06, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x46, 0x06, 0x00, 0x88, 0x06, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xCE, 0x06, 0x00, 0x10, 0x07, 0x00, 0x02, 0x01, 0x26, 0x00, 0xD0, 0xD1, 0x56, 0x07, 0x00, 0x98,
+    0x07, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xDE, 0x07, 0x00, 0x20, 0x08, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x66, 0x08, 0x00, 0xA8, 0x08, 0x00, 0x02, 0x02, 0x1A, 0x00, 0xD0, 0xD1, 0xEE, 0x08, 0x00, 0x30,
+    0x09, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x76, 0x09, 0x00, 0xB8, 0x09, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xFE, 0x09, 0x00, 0x40, 0x0A, 0x00, 0x02, 0x01, 0x26, 0x00, 0xD0, 0xD1, 0x86, 0x0A, 0x00, 0xC8,
+    0x0A, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x0E, 0x0B, 0x00, 0x50, 0x0B, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x96, 0x0B, 0x00, 0xD8, 0x0B, 0x00, 0x02, 0x01, 0x26, 0x00, 0xD0, 0xD1, 0x1E, 0x0C, 0x00, 0x60,
+    0x0C, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xA6, 0x0C, 0x00, 0xE8, 0x0C, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x2E, 0x0D, 0x00, 0x70, 0x0D, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xB6, 0x0D, 0x00, 0xF8, 0x0D, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x3E, 0x0E, 0x00, 0x80, 0x0E, 0x00, 0x02, 0x01, 0x26, 0x00, 0xD0, 0xD1,
+    0xC6, 0x0E, 0x00, 0x08, 0x0F, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x4E, 0x0F, 0x00, 0x90, 0x0F, 0x00,
+    0x02, 0x01, 0x26, 0x00, 0xD0, 0xD1, 0xD6, 0x0F, 0x00, 0x18, 0x10, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x5E, 0x10, 0x00, 0xA0, 0x10, 0x00, 0x02, 0x01, 0x26, 0x00, 0xD0, 0xD1, 0xE6, 0x10, 0x00, 0x28,
+    0x11, 0x00, 0x02, 0x01, 0x26, 0x00, 0xD0, 0xD1, 0x6E, 0x11, 0x00, 0xB0, 0x11, 0x00, 0x02, 0x01,
+    0x0A, 0x00, 0xD0, 0xD1, 0xF6, 0x11, 0x00, 0x38, 0x12, 0x00, 0x02, 0x01, 0x0A, 0x00, 0xD0, 0xD1,
+    0x7E, 0x12, 0x00, 0xC0, 0x12, 0x00, 0x02, 0x01, 0x0A, 0x00, 0xD0, 0xD1, 0x06, 0x13, 0x00, 0x48,
+    0x13, 0x00, 0x02, 0x01, 0x26, 0x00, 0xD0, 0xD1, 0x8E, 0x13, 0x00, 0xD0, 0x13, 0x00, 0x02, 0x01,
+    0x26, 0x00, 0xD0, 0xD1, 0x16, 0x14, 0x00, 0x58, 0x14, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x9E, 0x14,
+    0x00, 0xE0, 0x14, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x26, 0x15, 0x00, 0x68, 0x15, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0xAE, 0x15, 0x00, 0xF0, 0x15, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x36, 0x16, 0x00,
+    0x3A, 0x16, 0x00, 0x54, 0x16, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x36, 0x16, 0x00, 0x62, 0x16, 0x00,
+    0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x36, 0x16, 0x00, 0x6C, 0x16, 0x00, 0x72, 0x16, 0x00, 0x02, 0x00,
+    0x2D, 0xD0, 0x36, 0x16, 0x00, 0x78, 0x16, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x36, 0x16, 0x00, 0x7E,
+    0x16, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x36, 0x16, 0x00, 0x8C, 0x16, 0x00, 0x01, 0x00, 0x2D, 0x36,
+    0x16, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x36, 0x16, 0x00, 0x92, 0x16, 0x00, 0x03, 0x00, 0x2D, 0xD0,
+    0xD1, 0x36, 0x16, 0x00, 0x98, 0x16, 0x00, 0xAE, 0x16, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x36,
+    0x16, 0x00, 0xB4, 0x16, 0x00, 0xBA, 0x16, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x36, 0x16, 0x00,
+    0xC4, 0x16, 0x00, 0xD2, 0x16, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x36, 0x16, 0x00, 0xD8, 0x16,
+    0x00, 0xE6, 0x16, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x36, 0x16, 0x00, 0xEC, 0x16, 0x00, 0xFE,
+    0x16, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x36, 0x16, 0x00, 0x08, 0x17, 0x00, 0x12, 0x17, 0x00,
+    0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x36, 0x16, 0x00, 0x18, 0x17, 0x00, 0x2A, 0x17, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0x36, 0x16, 0x00, 0x30, 0x17, 0x00, 0x3E, 0x17, 0x00, 0x02, 0x00, 0x2D, 0xD0,
+    0x36, 0x16, 0x00, 0x48, 0x17, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x36, 0x16, 0x00, 0x52, 0x17,
+    0x00, 0x74, 0x17, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x36, 0x16, 0x00, 0x8A, 0x17, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0x36, 0x16, 0x00, 0x90, 0x17, 0x00, 0x96, 0x17, 0x00, 0x02, 0x00, 0x2D, 0xD1,
+    0x36, 0x16, 0x00, 0x9C, 0x17, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
+    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xA2, 0x17, 0x00, 0xB2, 0x17, 0x00, 0xC2, 0x17,
+    0x00, 0xD0, 0x17, 0x00, 0xDE, 0x17, 0x00, 0xEE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x04, 0x18, 0x00,
+    0x12, 0x18, 0x00, 0xFE, 0x17, 0x00, 0x22, 0x18, 0x00, 0x32, 0x18, 0x00, 0x40, 0x18, 0x00, 0x4E,
+    0x18, 0x00, 0x5C, 0x18, 0x00, 0x6C, 0x18, 0x00, 0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+    0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x7A, 0x18, 0x00, 0x88, 0x18,
+    0x00, 0x96, 0x18, 0x00, 0xA4, 0x18, 0x00, 0xB4, 0x18, 0x00, 0xBE, 0x18, 0x00, 0xFE, 0x17, 0x00,
+    0xCC, 0x18, 0x00, 0xDC, 0x18, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE,
+    0x17, 0x00, 0xE6, 0x18, 0x00, 0xF4, 0x18, 0x00, 0xFE, 0x18, 0x00, 0x0A, 0x19, 0x00, 0x10, 0x00,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0x12, 0x19, 0x00, 0x22, 0x19, 0x00, 0x2A, 0x19, 0x00, 0x36, 0x19, 0x00, 0x22, 0x19, 0x00, 0x3E,
+    0x19, 0x00, 0x4E, 0x19, 0x00, 0x56, 0x19, 0x00, 0x5E, 0x19, 0x00, 0xFE, 0x17, 0x00, 0x6E, 0x19,
+    0x00, 0x76, 0x19, 0x00, 0xFE, 0x17, 0x00, 0x6E, 0x19, 0x00, 0x86, 0x19, 0x00, 0xFE, 0x17, 0x00,
+    0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D,
+    0x8E, 0x8F, 0x91, 0x96, 0x19, 0x00, 0xA8, 0x19, 0x00, 0x0A, 0x19, 0x00, 0xB4, 0x19, 0x00, 0x4E,
+    0x19, 0x00, 0x22, 0x19, 0x00, 0x4E, 0x19, 0x00, 0x22, 0x19, 0x00, 0x4E, 0x19, 0x00, 0x4E, 0x19,
+    0x00, 0xC4, 0x19, 0x00, 0xCE, 0x19, 0x00, 0xDE, 0x19, 0x00, 0xEE, 0x19, 0x00, 0xF8, 0x19, 0x00,
+    0x04, 0x1A, 0x00, 0x0C, 0x1A, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
+    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x18, 0x1A, 0x00, 0x22, 0x19, 0x00, 0x28, 0x1A,
+    0x00, 0x36, 0x1A, 0x00, 0x3E, 0x1A, 0x00, 0x4A, 0x1A, 0x00, 0xFE, 0x17, 0x00, 0x58, 0x1A, 0x00,
+    0x68, 0x1A, 0x00, 0xFE, 0x17, 0x00, 0x76, 0x1A, 0x00, 0x86, 0x1A, 0x00, 0x96, 0x1A, 0x00, 0xA6,
+    0x1A, 0x00, 0xB6, 0x1A, 0x00, 0x36, 0x1A, 0x00, 0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+    0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xC4, 0x1A, 0x00, 0xD6, 0x1A,
+    0x00, 0xE6, 0x1A, 0x00, 0xF2, 0x1A, 0x00, 0x36, 0x19, 0x00, 0x00, 0x1B, 0x00, 0x4E, 0x19, 0x00,
+    0x22, 0x19, 0x00, 0x0A, 0x1B, 0x00, 0x4E, 0x19, 0x00, 0x16, 0x1B, 0x00, 0x22, 0x1B, 0x00, 0x32,
+    0x1B, 0x00, 0x44, 0x1B, 0x00, 0x4C, 0x1B, 0x00, 0x04, 0x1A, 0x00, 0x54, 0x1B, 0x00, 0x10, 0x00,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0x62, 0x1B, 0x00, 0x72, 0x1B, 0x00, 0x7E, 0x1B, 0x00, 0x4E, 0x19, 0x00, 0x88, 0x1B, 0x00, 0x92,
+    0x1B, 0x00, 0x6E, 0x19, 0x00, 0x22, 0x19, 0x00, 0xA0, 0x1B, 0x00, 0xFE, 0x17, 0x00, 0x22, 0x19,
+    0x00, 0xB0, 0x1B, 0x00, 0x6E, 0x19, 0x00, 0xBE, 0x1B, 0x00, 0xCC, 0x1B, 0x00, 0x4E, 0x19, 0x00,
+    0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D,
+    0x8E, 0x8F, 0x91, 0xDA, 0x1B, 0x00, 0xEC, 0x1B, 0x00, 0x6E, 0x19, 0x00, 0xFC, 0x1B, 0x00, 0x4E,
+    0x19, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x22, 0x19, 0x00, 0x6E, 0x19, 0x00, 0xFE, 0x17,
+    0x00, 0xC4, 0x19, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x6E, 0x19, 0x00, 0xFE, 0x17, 0x00,
+    0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
+    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x0A, 0x1C, 0x00, 0x22, 0x19, 0x00, 0x1A, 0x1C,
+    0x00, 0x36, 0x1A, 0x00, 0x2A, 0x1C, 0x00, 0x32, 0x1C, 0x00, 0x42, 0x1C, 0x00, 0x2A, 0x1C, 0x00,
+    0x54, 0x1C, 0x00, 0xFE, 0x17, 0x00, 0x22, 0x19, 0x00, 0x64, 0x1C, 0x00, 0x70, 0x1C, 0x00, 0x78,
+    0x1C, 0x00, 0x88, 0x1C, 0x00, 0x4E, 0x19, 0x00, 0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+    0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x98, 0x1C, 0x00, 0xAA, 0x1C,
+    0x00, 0x22, 0x19, 0x00, 0xB6, 0x1C, 0x00, 0x4E, 0x19, 0x00, 0x0A, 0x19, 0x00, 0xC6, 0x1C, 0x00,
+    0x22, 0x19, 0x00, 0x70, 0x1C, 0x00, 0x4E, 0x19, 0x00, 0xD4, 0x1C, 0x00, 0xE8, 0x1C, 0x00, 0xF8,
+    0x1C, 0x00, 0xFE, 0x17, 0x00, 0x4C, 0x1B, 0x00, 0x04, 0x1A, 0x00, 0x04, 0x1A, 0x00, 0x10, 0x00,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0x0A, 0x1D, 0x00, 0x1A, 0x1D, 0x00, 0x2A, 0x1D, 0x00, 0x38, 0x1D, 0x00, 0x46, 0x1D, 0x00, 0x54,
+    0x1D, 0x00, 0x64, 0x1D, 0x00, 0x72, 0x1D, 0x00, 0x80, 0x1D, 0x00, 0xFE, 0x17, 0x00, 0x90, 0x1D,
+    0x00, 0x9E, 0x1D, 0x00, 0xAC, 0x1D, 0x00, 0xBA, 0x1D, 0x00, 0xC8, 0x1D, 0x00, 0xD8, 0x1D, 0x00,
+    0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D,
+    0x8E, 0x8F, 0x91, 0xE6, 0x1D, 0x00, 0xF4, 0x1D, 0x00, 0x02, 0x1E, 0x00, 0x10, 0x1E, 0x00, 0x1C,
+    0x1E, 0x00, 0x2A, 0x1E, 0x00, 0x38, 0x1E, 0x00, 0x42, 0x1E, 0x00, 0xDC, 0x18, 0x00, 0xFE, 0x17,
+    0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x36, 0x19, 0x00, 0x4C, 0x1E, 0x00,
+    0x56, 0x1E, 0x00, 0x0A, 0x19, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
+    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x62, 0x1E, 0x00, 0x2A, 0x1C, 0x00, 0x22, 0x19,
+    0x00, 0x70, 0x1E, 0x00, 0x80, 0x1E, 0x00, 0x90, 0x1E, 0x00, 0x9E, 0x1E, 0x00, 0x2A, 0x1C, 0x00,
+    0xAC, 0x1E, 0x00, 0xFE, 0x17, 0x00, 0x22, 0x19, 0x00, 0x22, 0x19, 0x00, 0xBA, 0x1E, 0x00, 0xC6,
+    0x1E, 0x00, 0xD2, 0x1E, 0x00, 0xE0, 0x1E, 0x00, 0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+    0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xEC, 0x1E, 0x00, 0x22, 0x19,
+    0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x4E, 0x19, 0x00, 0xFE, 0x17, 0x00, 0x4E, 0x19, 0x00,
+    0x22, 0x19, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xF6, 0x1E, 0x00, 0xFE, 0x17, 0x00, 0x02,
+    0x1F, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x10, 0x1F, 0x00, 0x10, 0x00,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0x1E, 0x1F, 0x00, 0x56, 0x19, 0x00, 0x2E, 0x1F, 0x00, 0x3C, 0x1F, 0x00, 0x48, 0x1F, 0x00, 0x52,
+    0x1F, 0x00, 0x36, 0x1A, 0x00, 0x5E, 0x1F, 0x00, 0x66, 0x1F, 0x00, 0xFE, 0x17, 0x00, 0x7A, 0x1F,
+    0x00, 0x86, 0x1F, 0x00, 0x96, 0x1F, 0x00, 0xA2, 0x1F, 0x00, 0xB2, 0x1F, 0x00, 0xFE, 0x17, 0x00,
+    0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D,
+    0x8E, 0x8F, 0x91, 0xC0, 0x1F, 0x00, 0x22, 0x19, 0x00, 0xCE, 0x1F, 0x00, 0xDA, 0x1F, 0x00, 0xFE,
+    0x17, 0x00, 0xFE, 0x17, 0x00, 0x4E, 0x19, 0x00, 0x0A, 0x19, 0x00, 0x4E, 0x19, 0x00, 0xFE, 0x17,
+    0x00, 0xEE, 0x1F, 0x00, 0x00, 0x20, 0x00, 0x10, 0x20, 0x00, 0xFE, 0x17, 0x00, 0x4C, 0x1B, 0x00,
+    0x04, 0x1A, 0x00, 0x04, 0x1A, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
+    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x22, 0x20, 0x00, 0x32, 0x20, 0x00, 0x3E, 0x20,
+    0x00, 0x4C, 0x20, 0x00, 0x5A, 0x20, 0x00, 0x68, 0x20, 0x00, 0x78, 0x20, 0x00, 0x82, 0x20, 0x00,
+    0x0A, 0x19, 0x00, 0x90, 0x20, 0x00, 0x9A, 0x20, 0x00, 0xAA, 0x20, 0x00, 0xBA, 0x20, 0x00, 0xC8,
+    0x20, 0x00, 0xD6, 0x20, 0x00, 0xE4, 0x20, 0x00, 0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+    0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xF0, 0x20, 0x00, 0x00, 0x21,
+    0x00, 0x0E, 0x21, 0x00, 0x1E, 0x21, 0x00, 0x2A, 0x21, 0x00, 0x38, 0x21, 0x00, 0xFE, 0x17, 0x00,
+    0x0A, 0x19, 0x00, 0x46, 0x21, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE,
+    0x17, 0x00, 0xFE, 0x17, 0x00, 0x54, 0x21, 0x00, 0x62, 0x21, 0x00, 0x0A, 0x19, 0x00, 0x10, 0x00,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x6E, 0x21, 0x00, 0xFE,
+    0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x7A, 0x21,
+    0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x84, 0x21, 0x00, 0x8E, 0x21, 0x00, 0x98, 0x21, 0x00,
+    0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D,
+    0x8E, 0x8F, 0x91, 0xFE, 0x17, 0x00, 0xA2, 0x21, 0x00, 0xB0, 0x21, 0x00, 0xFE, 0x17, 0x00, 0xFE,
+    0x17, 0x00, 0xBA, 0x21, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17,
+    0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00,
+    0xC8, 0x21, 0x00, 0xFE, 0x17, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
+    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xD0, 0x21, 0x00, 0x22, 0x19, 0x00, 0xDE, 0x21,
+    0x00, 0x4E, 0x19, 0x00, 0xEC, 0x21, 0x00, 0xF8, 0x21, 0x00, 0xFE, 0x17, 0x00, 0x22, 0x19, 0x00,
+    0x08, 0x22, 0x00, 0xFE, 0x17, 0x00, 0x16, 0x22, 0x00, 0x22, 0x22, 0x00, 0x4E, 0x19, 0x00, 0x30,
+    0x22, 0x00, 0x40, 0x22, 0x00, 0x4E, 0x19, 0x00, 0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+    0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x50, 0x22, 0x00, 0x62, 0x22,
+    0x00, 0x72, 0x22, 0x00, 0x82, 0x22, 0x00, 0x4E, 0x19, 0x00, 0x2A, 0x1C, 0x00, 0x4E, 0x19, 0x00,
+    0x22, 0x19, 0x00, 0x4E, 0x19, 0x00, 0xFE, 0x17, 0x00, 0xC4, 0x19, 0x00, 0xFE, 0x17, 0x00, 0x04,
+    0x1A, 0x00, 0xFE, 0x17, 0x00, 0x92, 0x22, 0x00, 0xFE, 0x17, 0x00, 0x04, 0x1A, 0x00, 0x10, 0x00,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0x9A, 0x22, 0x00, 0xAC, 0x22, 0x00, 0xB8, 0x22, 0x00, 0xC6, 0x22, 0x00, 0x70, 0x1C, 0x00, 0xD0,
+    0x22, 0x00, 0xFE, 0x17, 0x00, 0xE2, 0x22, 0x00, 0xEC, 0x22, 0x00, 0xFE, 0x17, 0x00, 0xFC, 0x22,
+    0x00, 0x08, 0x23, 0x00, 0x4E, 0x19, 0x00, 0x14, 0x23, 0x00, 0x20, 0x23, 0x00, 0x4E, 0x19, 0x00,
+    0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D,
+    0x8E, 0x8F, 0x91, 0xFE, 0x17, 0x00, 0x30, 0x23, 0x00, 0x0A, 0x19, 0x00, 0x3C, 0x23, 0x00, 0x70,
+    0x1C, 0x00, 0x4E, 0x23, 0x00, 0x4E, 0x19, 0x00, 0x0A, 0x19, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17,
+    0x00, 0xC4, 0x19, 0x00, 0x5A, 0x23, 0x00, 0x6C, 0x23, 0x00, 0xFE, 0x17, 0x00, 0x7E, 0x23, 0x00,
+    0x92, 0x23, 0x00, 0xA6, 0x23, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
+    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB4, 0x23, 0x00, 0xC2, 0x23, 0x00, 0x70, 0x1C,
+    0x00, 0xCE, 0x23, 0x00, 0x22, 0x19, 0x00, 0xDA, 0x23, 0x00, 0x4E, 0x19, 0x00, 0x2A, 0x1C, 0x00,
+    0xE8, 0x23, 0x00, 0xFE, 0x17, 0x00, 0xF6, 0x23, 0x00, 0x02, 0x24, 0x00, 0x4E, 0x19, 0x00, 0x0E,
+    0x24, 0x00, 0x1E, 0x24, 0x00, 0x2C, 0x24, 0x00, 0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+    0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x38, 0x24, 0x00, 0x46, 0x24,
+    0x00, 0x22, 0x19, 0x00, 0x56, 0x24, 0x00, 0x60, 0x24, 0x00, 0x22, 0x19, 0x00, 0x4E, 0x19, 0x00,
+    0x6C, 0x24, 0x00, 0x36, 0x1A, 0x00, 0x76, 0x24, 0x00, 0xC4, 0x19, 0x00, 0x86, 0x24, 0x00, 0x94,
+    0x24, 0x00, 0xA2, 0x24, 0x00, 0x92, 0x22, 0x00, 0xAE, 0x24, 0x00, 0xFE, 0x17, 0x00, 0x10, 0x00,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xB8, 0x24, 0x00, 0x2A, 0x1C, 0x00, 0x22, 0x19, 0x00, 0xC8, 0x24, 0x00, 0xD8, 0x24, 0x00, 0xE8,
+    0x24, 0x00, 0xFE, 0x17, 0x00, 0xFC, 0x24, 0x00, 0x08, 0x25, 0x00, 0xFE, 0x17, 0x00, 0x18, 0x25,
+    0x00, 0x0A, 0x19, 0x00, 0xFE, 0x17, 0x00, 0x28, 0x25, 0x00, 0x34, 0x25, 0x00, 0x5E, 0x1F, 0x00,
+    0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D,
+    0x8E, 0x8F, 0x91, 0x44, 0x25, 0x00, 0x4E, 0x25, 0x00, 0x5E, 0x25, 0x00, 0x6E, 0x25, 0x00, 0x36,
+    0x1A, 0x00, 0x7A, 0x25, 0x00, 0x4E, 0x19, 0x00, 0x86, 0x25, 0x00, 0x92, 0x25, 0x00, 0x4E, 0x19,
+    0x00, 0xC4, 0x19, 0x00, 0x9E, 0x25, 0x00, 0xAA, 0x25, 0x00, 0x92, 0x22, 0x00, 0xBC, 0x25, 0x00,
+    0xC8, 0x25, 0x00, 0xD4, 0x25, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
+    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE0, 0x25, 0x00, 0xEC, 0x25, 0x00, 0xFA, 0x25,
+    0x00, 0x0A, 0x26, 0x00, 0x1A, 0x26, 0x00, 0x28, 0x26, 0x00, 0x38, 0x26, 0x00, 0x42, 0x26, 0x00,
+    0x50, 0x26, 0x00, 0x60, 0x26, 0x00, 0x6C, 0x26, 0x00, 0x7C, 0x26, 0x00, 0x8A, 0x26, 0x00, 0x98,
+    0x26, 0x00, 0xA6, 0x26, 0x00, 0xB6, 0x26, 0x00, 0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+    0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xC4, 0x26, 0x00, 0xD2, 0x26,
+    0x00, 0xE0, 0x26, 0x00, 0xF0, 0x26, 0x00, 0x00, 0x27, 0x00, 0x0E, 0x27, 0x00, 0x1C, 0x27, 0x00,
+    0x26, 0x27, 0x00, 0x34, 0x27, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE,
+    0x17, 0x00, 0x42, 0x27, 0x00, 0x4E, 0x19, 0x00, 0x4C, 0x27, 0x00, 0x5C, 0x27, 0x00, 0x10, 0x00,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0x68, 0x27, 0x00, 0xFE, 0x17, 0x00, 0x2A, 0x1C, 0x00, 0xFE, 0x17, 0x00, 0x22, 0x19, 0x00, 0x76,
+    0x27, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x86, 0x27, 0x00, 0xFE, 0x17, 0x00, 0x94, 0x27,
+    0x00, 0x9C, 0x27, 0x00, 0xFE, 0x17, 0x00, 0xAE, 0x27, 0x00, 0xBE, 0x27, 0x00, 0xCC, 0x27, 0x00,
+    0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D,
+    0x8E, 0x8F, 0x91, 0xD8, 0x27, 0x00, 0xEA, 0x27, 0x00, 0xF6, 0x27, 0x00, 0x06, 0x28, 0x00, 0x36,
+    0x1A, 0x00, 0x36, 0x19, 0x00, 0x4E, 0x19, 0x00, 0x94, 0x27, 0x00, 0x4E, 0x19, 0x00, 0x4E, 0x19,
+    0x00, 0xC4, 0x19, 0x00, 0xFE, 0x17, 0x00, 0x14, 0x28, 0x00, 0x22, 0x28, 0x00, 0x2C, 0x28, 0x00,
+    0xFE, 0x17, 0x00, 0x34, 0x28, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
+    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x40, 0x28, 0x00, 0x52, 0x28, 0x00, 0x5E, 0x28,
+    0x00, 0x6C, 0x28, 0x00, 0x7C, 0x28, 0x00, 0x8C, 0x28, 0x00, 0x9E, 0x28, 0x00, 0xA8, 0x28, 0x00,
+    0xB4, 0x28, 0x00, 0xFE, 0x17, 0x00, 0xC2, 0x28, 0x00, 0xD2, 0x28, 0x00, 0xDE, 0x28, 0x00, 0xEA,
+    0x28, 0x00, 0xF6, 0x28, 0x00, 0x08, 0x29, 0x00, 0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+    0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x22, 0x19, 0x00, 0x14, 0x29,
+    0x00, 0x24, 0x29, 0x00, 0x34, 0x29, 0x00, 0x2C, 0x24, 0x00, 0x46, 0x29, 0x00, 0x56, 0x29, 0x00,
+    0x62, 0x29, 0x00, 0x6E, 0x29, 0x00, 0x4E, 0x19, 0x00, 0xF6, 0x1E, 0x00, 0x7E, 0x29, 0x00, 0x90,
+    0x29, 0x00, 0xA2, 0x29, 0x00, 0xAC, 0x29, 0x00, 0xBC, 0x29, 0x00, 0xCA, 0x29, 0x00, 0x10, 0x00,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xD8, 0x29, 0x00, 0xE8, 0x29, 0x00, 0xF8, 0x29, 0x00, 0x04, 0x2A, 0x00, 0x10, 0x2A, 0x00, 0x20,
+    0x2A, 0x00, 0x4C, 0x1B, 0x00, 0x0A, 0x19, 0x00, 0x30, 0x2A, 0x00, 0xFE, 0x17, 0x00, 0x40, 0x2A,
+    0x00, 0x52, 0x2A, 0x00, 0x60, 0x2A, 0x00, 0x70, 0x2A, 0x00, 0x80, 0x2A, 0x00, 0x90, 0x2A, 0x00,
+    0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D,
+    0x8E, 0x8F, 0x91, 0xA0, 0x2A, 0x00, 0xB0, 0x2A, 0x00, 0xC0, 0x2A, 0x00, 0xD2, 0x2A, 0x00, 0xE2,
+    0x2A, 0x00, 0xEC, 0x2A, 0x00, 0xF8, 0x2A, 0x00, 0x02, 0x2B, 0x00, 0x12, 0x2B, 0x00, 0xFE, 0x17,
+    0x00, 0x1E, 0x2B, 0x00, 0x2E, 0x2B, 0x00, 0x3E, 0x2B, 0x00, 0x50, 0x2B, 0x00, 0x5A, 0x2B, 0x00,
+    0x66, 0x2B, 0x00, 0x76, 0x2B, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
+    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x86, 0x2B, 0x00, 0x2A, 0x1C, 0x00, 0x94, 0x2B,
+    0x00, 0x4E, 0x19, 0x00, 0x22, 0x19, 0x00, 0xA6, 0x2B, 0x00, 0x4E, 0x19, 0x00, 0x22, 0x19, 0x00,
+    0xB6, 0x2B, 0x00, 0xFE, 0x17, 0x00, 0xC4, 0x2B, 0x00, 0xD4, 0x2B, 0x00, 0xE4, 0x2B, 0x00, 0x22,
+    0x19, 0x00, 0xF4, 0x2B, 0x00, 0x02, 0x2C, 0x00, 0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+    0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x0E, 0x2C, 0x00, 0x20, 0x2C,
+    0x00, 0x2C, 0x2C, 0x00, 0x38, 0x2C, 0x00, 0x4E, 0x19, 0x00, 0x22, 0x19, 0x00, 0x46, 0x2C, 0x00,
+    0x22, 0x19, 0x00, 0x36, 0x1A, 0x00, 0x4E, 0x19, 0x00, 0xF6, 0x1E, 0x00, 0x4E, 0x2C, 0x00, 0x5C,
+    0x2C, 0x00, 0x4E, 0x19, 0x00, 0x70, 0x2C, 0x00, 0x7C, 0x2C, 0x00, 0x8A, 0x2C, 0x00, 0x10, 0x00,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0x9A, 0x2C, 0x00, 0xAA, 0x2C, 0x00, 0xB8, 0x2C, 0x00, 0xC6, 0x2C, 0x00, 0xD4, 0x2C, 0x00, 0xE2,
+    0x2C, 0x00, 0xF2, 0x2C, 0x00, 0xFC, 0x2C, 0x00, 0x0A, 0x19, 0x00, 0xFE, 0x17, 0x00, 0x06, 0x2D,
+    0x00, 0x14, 0x2D, 0x00, 0x22, 0x2D, 0x00, 0x2C, 0x2D, 0x00, 0x3A, 0x2D, 0x00, 0x4A, 0x2D, 0x00,
+    0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D,
+    0x8E, 0x8F, 0x91, 0x58, 0x2D, 0x00, 0x66, 0x2D, 0x00, 0x74, 0x2D, 0x00, 0x82, 0x2D, 0x00, 0x92,
+    0x2D, 0x00, 0xA0, 0x2D, 0x00, 0xFE, 0x17, 0x00, 0xAE, 0x2D, 0x00, 0xBC, 0x2D, 0x00, 0xFE, 0x17,
+    0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x4E, 0x19, 0x00, 0xFE, 0x17, 0x00,
+    0x56, 0x1E, 0x00, 0x0A, 0x19, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
+    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xCA, 0x2D, 0x00, 0x22, 0x19, 0x00, 0x22, 0x19,
+    0x00, 0x4E, 0x19, 0x00, 0x22, 0x19, 0x00, 0xD8, 0x2D, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00,
+    0xE6, 0x2D, 0x00, 0xFE, 0x17, 0x00, 0x22, 0x19, 0x00, 0xF6, 0x2D, 0x00, 0x4E, 0x19, 0x00, 0x22,
+    0x19, 0x00, 0x00, 0x2E, 0x00, 0xFE, 0x17, 0x00, 0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+    0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x0E, 0x2E, 0x00, 0x6E, 0x19,
+    0x00, 0x1C, 0x2E, 0x00, 0x28, 0x2E, 0x00, 0x4E, 0x19, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00,
+    0x22, 0x19, 0x00, 0x36, 0x1A, 0x00, 0xFE, 0x17, 0x00, 0xC4, 0x19, 0x00, 0xFE, 0x17, 0x00, 0x36,
+    0x2E, 0x00, 0xFE, 0x17, 0x00, 0x2C, 0x28, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x10, 0x00,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0x40, 0x2E, 0x00, 0x22, 0x19, 0x00, 0x50, 0x2E, 0x00, 0x4E, 0x19, 0x00, 0x5E, 0x1F, 0x00, 0x60,
+    0x2E, 0x00, 0xFE, 0x17, 0x00, 0x56, 0x19, 0x00, 0x6C, 0x2E, 0x00, 0xFE, 0x17, 0x00, 0x56, 0x19,
+    0x00, 0x7C, 0x2E, 0x00, 0x8A, 0x2E, 0x00, 0x94, 0x2E, 0x00, 0xA0, 0x2E, 0x00, 0x36, 0x19, 0x00,
+    0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D,
+    0x8E, 0x8F, 0x91, 0xB0, 0x2E, 0x00, 0x2A, 0x1C, 0x00, 0x22, 0x19, 0x00, 0xBE, 0x2E, 0x00, 0xFE,
+    0x17, 0x00, 0x56, 0x19, 0x00, 0xFE, 0x17, 0x00, 0x2A, 0x1C, 0x00, 0x4E, 0x19, 0x00, 0xFE, 0x17,
+    0x00, 0xC4, 0x19, 0x00, 0xFE, 0x17, 0x00, 0xD0, 0x2E, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00,
+    0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
+    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xDA, 0x2E, 0x00, 0x22, 0x19, 0x00, 0xEE, 0x2E,
+    0x00, 0x4E, 0x19, 0x00, 0x22, 0x19, 0x00, 0xFC, 0x2E, 0x00, 0xFE, 0x17, 0x00, 0x22, 0x19, 0x00,
+    0x0A, 0x2F, 0x00, 0xFE, 0x17, 0x00, 0x2A, 0x1C, 0x00, 0x22, 0x19, 0x00, 0x4E, 0x19, 0x00, 0x22,
+    0x19, 0x00, 0x1A, 0x2F, 0x00, 0x36, 0x1A, 0x00, 0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+    0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x22, 0x19, 0x00, 0x22, 0x19,
+    0x00, 0x22, 0x19, 0x00, 0x28, 0x2F, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x4E, 0x19, 0x00,
+    0xFE, 0x17, 0x00, 0x70, 0x1C, 0x00, 0xFE, 0x17, 0x00, 0xC4, 0x19, 0x00, 0x30, 0x2F, 0x00, 0xFE,
+    0x17, 0x00, 0xFE, 0x17, 0x00, 0xC8, 0x21, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x10, 0x00,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0x3C, 0x2F, 0x00, 0x22, 0x19, 0x00, 0x0A, 0x19, 0x00, 0xFE, 0x17, 0x00, 0x22, 0x19, 0x00, 0x4C,
+    0x2F, 0x00, 0x5C, 0x2F, 0x00, 0xFE, 0x17, 0x00, 0x68, 0x2F, 0x00, 0xFE, 0x17, 0x00, 0x22, 0x19,
+    0x00, 0x78, 0x2F, 0x00, 0x82, 0x2F, 0x00, 0x22, 0x19, 0x00, 0x28, 0x2F, 0x00, 0xFE, 0x17, 0x00,
+    0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D,
+    0x8E, 0x8F, 0x91, 0xFE, 0x17, 0x00, 0x22, 0x19, 0x00, 0x8E, 0x2F, 0x00, 0x9C, 0x2F, 0x00, 0xFE,
+    0x17, 0x00, 0x92, 0x22, 0x00, 0xFE, 0x17, 0x00, 0x22, 0x19, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17,
+    0x00, 0xC4, 0x19, 0x00, 0xFE, 0x17, 0x00, 0xA8, 0x2F, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00,
+    0xFE, 0x17, 0x00, 0xBA, 0x2F, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
+    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xC6, 0x2F, 0x00, 0x22, 0x19, 0x00, 0xD4, 0x2F,
+    0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xE0, 0x2F, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00,
+    0xEE, 0x2F, 0x00, 0xFE, 0x17, 0x00, 0xFC, 0x2F, 0x00, 0x08, 0x30, 0x00, 0x16, 0x30, 0x00, 0x22,
+    0x30, 0x00, 0xFE, 0x17, 0x00, 0x32, 0x30, 0x00, 0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+    0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x22, 0x19, 0x00, 0x22, 0x19,
+    0x00, 0x3E, 0x30, 0x00, 0x4C, 0x30, 0x00, 0x4E, 0x19, 0x00, 0x0A, 0x19, 0x00, 0x4E, 0x19, 0x00,
+    0x22, 0x19, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xC4, 0x19, 0x00, 0xFE, 0x17, 0x00, 0x5A,
+    0x30, 0x00, 0xFE, 0x17, 0x00, 0x2C, 0x28, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x10, 0x00,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x70, 0x1C, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x6E,
+    0x30, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x7C, 0x30, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17,
+    0x00, 0xFE, 0x17, 0x00, 0x4E, 0x19, 0x00, 0x22, 0x19, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00,
+    0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D,
+    0x8E, 0x8F, 0x91, 0x22, 0x19, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE,
+    0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17,
+    0x00, 0xC4, 0x19, 0x00, 0xFE, 0x17, 0x00, 0x36, 0x2E, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00,
+    0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
+    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17,
+    0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x86, 0x30, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00,
+    0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE,
+    0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+    0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xFE, 0x17, 0x00, 0xFE, 0x17,
+    0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00,
+    0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE,
+    0x17, 0x00, 0xFE, 0x17, 0x00, 0x36, 0x19, 0x00, 0x94, 0x30, 0x00, 0xA0, 0x30, 0x00, 0x10, 0x00,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xFE, 0x17, 0x00, 0xDC, 0x18, 0x00, 0xFE, 0x17, 0x00, 0xAA, 0x30, 0x00, 0xB4, 0x30, 0x00, 0x36,
+    0x19, 0x00, 0x78, 0x20, 0x00, 0xC2, 0x30, 0x00, 0xCC, 0x30, 0x00, 0xFE, 0x17, 0x00, 0xD8, 0x30,
+    0x00, 0x7A, 0x21, 0x00, 0x22, 0x2D, 0x00, 0xE6, 0x30, 0x00, 0xFE, 0x17, 0x00, 0xF0, 0x30, 0x00,
+    0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D,
+    0x8E, 0x8F, 0x91, 0xFA, 0x30, 0x00, 0x08, 0x31, 0x00, 0x16, 0x31, 0x00, 0x36, 0x19, 0x00, 0xFE,
+    0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x24, 0x31, 0x00, 0xFE, 0x17,
+    0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00,
+    0x32, 0x31, 0x00, 0xFE, 0x17, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
+    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFE, 0x17, 0x00, 0x3C, 0x31, 0x00, 0x48, 0x31,
+    0x00, 0xFE, 0x17, 0x00, 0x52, 0x31, 0x00, 0x5C, 0x31, 0x00, 0xFE, 0x17, 0x00, 0x6C, 0x31, 0x00,
+    0x2C, 0x28, 0x00, 0xFE, 0x17, 0x00, 0xDC, 0x18, 0x00, 0xFE, 0x17, 0x00, 0x76, 0x31, 0x00, 0x80,
+    0x31, 0x00, 0x92, 0x22, 0x00, 0x8A, 0x31, 0x00, 0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+    0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xFE, 0x17, 0x00, 0x98, 0x31,
+    0x00, 0xA6, 0x31, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xB4, 0x31, 0x00, 0xFE, 0x17, 0x00,
+    0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xBE, 0x31, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE,
+    0x17, 0x00, 0xFE, 0x17, 0x00, 0x92, 0x22, 0x00, 0xCC, 0x31, 0x00, 0xD8, 0x31, 0x00, 0x10, 0x00,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xE4, 0x31, 0x00, 0x4E, 0x19, 0x00, 0xEE, 0x19, 0x00, 0xFE,
+    0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xF0, 0x31,
+    0x00, 0xFE, 0x31, 0x00, 0x08, 0x32, 0x00, 0x14, 0x32, 0x00, 0x20, 0x32, 0x00, 0x2A, 0x32, 0x00,
+    0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D,
+    0x8E, 0x8F, 0x91, 0x36, 0x32, 0x00, 0x44, 0x32, 0x00, 0x54, 0x32, 0x00, 0xFE, 0x17, 0x00, 0x92,
+    0x22, 0x00, 0x62, 0x32, 0x00, 0x92, 0x22, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17,
+    0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00,
+    0x36, 0x19, 0x00, 0xFE, 0x17, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
+    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x0A, 0x19, 0x00, 0x6E, 0x32, 0x00, 0x0A, 0x19,
+    0x00, 0xFE, 0x17, 0x00, 0x7E, 0x32, 0x00, 0x0A, 0x19, 0x00, 0xFE, 0x17, 0x00, 0x88, 0x32, 0x00,
+    0x92, 0x32, 0x00, 0xFE, 0x17, 0x00, 0x9E, 0x32, 0x00, 0xAA, 0x32, 0x00, 0xDE, 0x28, 0x00, 0x7A,
+    0x21, 0x00, 0xB8, 0x32, 0x00, 0xFE, 0x17, 0x00, 0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+    0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xC0, 0x32, 0x00, 0xCE, 0x32,
+    0x00, 0xDC, 0x32, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xEA, 0x32, 0x00, 0xFE, 0x17, 0x00,
+    0x0A, 0x19, 0x00, 0xFE, 0x17, 0x00, 0x7A, 0x21, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE,
+    0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x0A, 0x19, 0x00, 0x0A, 0x19, 0x00, 0x10, 0x00,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xFE, 0x17, 0x00, 0xF6, 0x32, 0x00, 0x00, 0x33, 0x00, 0x0E, 0x33, 0x00, 0x18, 0x33, 0x00, 0x0A,
+    0x19, 0x00, 0xFE, 0x17, 0x00, 0x26, 0x33, 0x00, 0x0A, 0x19, 0x00, 0xFE, 0x17, 0x00, 0x30, 0x33,
+    0x00, 0x40, 0x33, 0x00, 0x4C, 0x33, 0x00, 0x5A, 0x33, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00,
+    0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D,
+    0x8E, 0x8F, 0x91, 0x68, 0x33, 0x00, 0x76, 0x33, 0x00, 0x84, 0x33, 0x00, 0x0A, 0x19, 0x00, 0xFE,
+    0x17, 0x00, 0x92, 0x33, 0x00, 0xA0, 0x33, 0x00, 0xFE, 0x17, 0x00, 0xDC, 0x18, 0x00, 0xFE, 0x17,
+    0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x36, 0x2E, 0x00,
+    0x22, 0x19, 0x00, 0xFE, 0x17, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
+    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFE, 0x17, 0x00, 0xAA, 0x33, 0x00, 0xB6, 0x33,
+    0x00, 0xFE, 0x17, 0x00, 0xC4, 0x33, 0x00, 0xFE, 0x17, 0x00, 0xCE, 0x33, 0x00, 0xD8, 0x33, 0x00,
+    0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xE2, 0x33, 0x00, 0xF0, 0x33, 0x00, 0xFE, 0x33, 0x00, 0x08,
+    0x34, 0x00, 0xFE, 0x17, 0x00, 0x16, 0x34, 0x00, 0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+    0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x24, 0x34, 0x00, 0x32, 0x34,
+    0x00, 0x40, 0x34, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x4E, 0x34, 0x00, 0xFE, 0x17, 0x00,
+    0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE,
+    0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0xFE, 0x17, 0x00, 0x10, 0x00,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0x5C, 0x34, 0x00, 0x5C, 0x34, 0x00, 0x5C, 0x34, 0x00, 0x5C, 0x34, 0x00, 0x5C, 0x34, 0x00, 0x5C,
+    0x34, 0x00, 0x5C, 0x34, 0x00, 0x5C, 0x34, 0x00, 0x5C, 0x34, 0x00, 0x5C, 0x34, 0x00, 0x5C, 0x34,
+    0x00, 0x5C, 0x34, 0x00, 0x5C, 0x34, 0x00, 0x5C, 0x34, 0x00, 0x5C, 0x34, 0x00, 0x5C, 0x34, 0x00,
+    0x11, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D,
+    0x8E, 0x8F, 0x91, 0x5C, 0x34, 0x00, 0x5C, 0x34, 0x00, 0x5C, 0x34, 0x00, 0x5C, 0x34, 0x00, 0x5C,
+    0x34, 0x00, 0x5C, 0x34, 0x00, 0x5C, 0x34, 0x00, 0x5C, 0x34, 0x00, 0x5C, 0x34, 0x00, 0x5C, 0x34,
+    0x00, 0x5C, 0x34, 0x00, 0x5C, 0x34, 0x00, 0x5C, 0x34, 0x00, 0x5C, 0x34, 0x00, 0x5C, 0x34, 0x00,
+    0x5C, 0x34, 0x00, 0x5C, 0x34, 0x00, 0x00, 0x01, 0xE2, 0x00, 0x06, 0x00, 0xB1, 0xB3, 0xB4, 0xB8,
+    0xBA, 0xBB, 0x60, 0x34, 0x00, 0x66, 0x34, 0x00, 0x6C, 0x34, 0x00, 0x72, 0x34, 0x00, 0x60, 0x34,
+    0x00, 0x76, 0x34, 0x00, 0x03, 0x00, 0x80, 0x81, 0x83, 0x7C, 0x34, 0x00, 0x82, 0x34, 0x00, 0x72,
+    0x34, 0x00, 0x02, 0x00, 0xB8, 0xBE, 0x88, 0x34, 0x00, 0x8E, 0x34, 0x00, 0x01, 0x00, 0xBE, 0x94,
+    0x34, 0x00, 0x01, 0x00, 0x81, 0x9A, 0x34, 0x00, 0x01, 0x00, 0xBE, 0xA0, 0x34, 0x00, 0x03, 0x00,
+    0xB5, 0xB8, 0xBE, 0xA6, 0x34, 0x00, 0xAC, 0x34, 0x00, 0xB2, 0x34, 0x00, 0x01, 0x00, 0xBF, 0xBC,
+    0x34, 0x00, 0x01, 0x00, 0xB0, 0xC2, 0x34, 0x00, 0x05, 0x00, 0xB3, 0xB7, 0xB8, 0xBA, 0xBE, 0x60,
+    0x34, 0x00, 0xC8, 0x34, 0x00, 0x72, 0x34, 0x00, 0x60, 0x34, 0x00, 0xCE, 0x34, 0x00, 0x01, 0x00,
+    0x81, 0xD6, 0x34, 0x00, 0x01, 0x00, 0xB5, 0xDA, 0x34, 0x00, 0x02, 0x00, 0x8C, 0x8E, 0x72, 0x34,
+    0x00, 0xE4, 0x34, 0x00, 0x03, 0x00, 0xB5, 0xB8, 0xBE, 0xEA, 0x34, 0x00, 0xF0, 0x34, 0x00, 0xF6,
+    0x34, 0x00, 0x01, 0x00, 0x83, 0xFC, 0x34, 0x00, 0x03, 0x00, 0xB0, 0xB5, 0xBE, 0x02, 0x35, 0x00,
+    0x0C, 0x35, 0x00, 0x18, 0x35, 0x00, 0x01, 0x00, 0x83, 0x1E, 0x35, 0x00, 0x04, 0x00, 0xB1, 0xB2,
+    0xB3, 0xB7, 0x24, 0x35, 0x00, 0x2E, 0x35, 0x00, 0x34, 0x35, 0x00, 0x3A, 0x35, 0x00, 0x02, 0x00,
+    0x81, 0x82, 0x3E, 0x35, 0x00, 0x44, 0x35, 0x00, 0x02, 0x00, 0xB0, 0xBE, 0x4E, 0x35, 0x00, 0x54,
+    0x35, 0x00, 0x01, 0x00, 0x80, 0x5A, 0x35, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE, 0x60, 0x35,
+    0x00, 0x66, 0x35, 0x00, 0x6C, 0x35, 0x00, 0x72, 0x35, 0x00, 0x01, 0x00, 0x91, 0x7C, 0x35, 0x00,
+    0x03, 0x00, 0xB5, 0xBA, 0xBE, 0x82, 0x35, 0x00, 0x72, 0x34, 0x00, 0x88, 0x35, 0x00, 0x02, 0x00,
+    0x82, 0x83, 0x72, 0x34, 0x00, 0x8E, 0x35, 0x00, 0x02, 0x00, 0xB5, 0xB8, 0x94, 0x35, 0x00, 0x9A,
+    0x35, 0x00, 0x08, 0x00, 0xB1, 0xB4, 0xB5, 0xB7, 0xBA, 0xBC, 0xBE, 0xBF, 0x72, 0x34, 0x00, 0x72,
+    0x34, 0x00, 0x72, 0x34, 0x00, 0xA0, 0x35, 0x00, 0x72, 0x34, 0x00, 0xA6, 0x35, 0x00, 0xD6, 0x34,
+    0x00, 0x72, 0x34, 0x00, 0x05, 0x00, 0x80, 0x81, 0x82, 0x8E, 0x91, 0xAC, 0x35, 0x00, 0x72, 0x34,
+    0x00, 0xB2, 0x35, 0x00, 0x72, 0x34, 0x00, 0x72, 0x34, 0x00, 0x01, 0x00, 0xBE, 0xB8, 0x35, 0x00,
+    0x01, 0x00, 0xB5, 0xBE, 0x35, 0x00, 0x01, 0x00, 0x91, 0xBE, 0x35, 0x00, 0x01, 0x00, 0x81, 0xC4,
+    0x35, 0x00, 0x03, 0x02, 0x3B, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xCC, 0x35, 0x00, 0xD2,
+    0x35, 0x00, 0x03, 0x01, 0x0A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xDC, 0x35, 0x00, 0xE6,
+    0x35, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xF0, 0x35, 0x00, 0x06, 0x36, 0x00,
+    0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x24, 0x36, 0x00, 0x3A, 0x36, 0x00, 0x03, 0x01,
+    0x0A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x40, 0x36, 0x00, 0x56, 0x36, 0x00, 0x03, 0x01,
+    0x0A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x68, 0x36, 0x00, 0x7A, 0x36, 0x00, 0x01, 0x00,
+    0x2D, 0xC8, 0x35, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x84, 0x36, 0x00, 0x9A,
+    0x36, 0x00, 0x03, 0x01, 0x0A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xA0, 0x36, 0x00, 0xA6,
+    0x36, 0x00, 0x03, 0x01, 0x0A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xAC, 0x36, 0x00, 0xBE,
+    0x36, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xC8, 0x36, 0x00, 0xDA, 0x36, 0x00,
+    0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xF0, 0x36, 0x00, 0x0A, 0x37, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x14, 0x37, 0x00, 0x22, 0x37, 0x00, 0x03, 0x02, 0x1A, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x34, 0x37, 0x00, 0x3E, 0x37, 0x00, 0x03, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0x48, 0x37, 0x00, 0x52, 0x37, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x58, 0x37, 0x00, 0x7A, 0x37, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0x98, 0x37, 0x00, 0xA6, 0x37, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xB8, 0x37,
+    0x00, 0xCE, 0x37, 0x00, 0x03, 0x01, 0x0A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xEC, 0x37,
+    0x00, 0xFA, 0x37, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x0C, 0x38, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x12, 0x38, 0x00, 0x1C, 0x38, 0x00, 0x03, 0x01, 0x0A, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x22, 0x38, 0x00, 0x2C, 0x38, 0x00, 0x02, 0x00, 0x2D, 0xD0,
+    0xC8, 0x35, 0x00, 0x32, 0x38, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x38, 0x38,
+    0x00, 0x3E, 0x38, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0x44, 0x38, 0x00, 0x02, 0x01,
+    0x0A, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x4A, 0x38, 0x00, 0x01, 0x01, 0x0A, 0x00, 0x2D, 0xC8,
+    0x35, 0x00, 0x03, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x58, 0x38, 0x00, 0x72,
+    0x38, 0x00, 0x01, 0x02, 0x1A, 0x00, 0x2D, 0xC8, 0x35, 0x00, 0x02, 0x01, 0x0A, 0x00, 0x2D, 0xD1,
+    0xC8, 0x35, 0x00, 0x7C, 0x38, 0x00, 0x01, 0x01, 0x0E, 0x00, 0x2D, 0xC8, 0x35, 0x00, 0x03, 0x01,
+    0x26, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x82, 0x38, 0x00, 0x98, 0x38, 0x00, 0x01, 0x01,
+    0x0C, 0x00, 0x2D, 0xC8, 0x35, 0x00, 0x01, 0x02, 0x23, 0x00, 0x2D, 0xC8, 0x35, 0x00, 0x03, 0x02,
+    0x43, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xA6, 0x38, 0x00, 0xC4, 0x38, 0x00, 0x01, 0x02,
+    0x1E, 0x00, 0x2D, 0xC8, 0x35, 0x00, 0x03, 0x01, 0x0A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0xCE, 0x38, 0x00, 0xD8, 0x38, 0x00, 0x03, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0xF2, 0x38, 0x00, 0x14, 0x39, 0x00, 0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x26,
+    0x39, 0x00, 0x2A, 0x39, 0x00, 0x3C, 0x39, 0x00, 0x02, 0x03, 0x3D, 0x00, 0x2D, 0xD0, 0xC8, 0x35,
+    0x00, 0x56, 0x39, 0x00, 0x03, 0x02, 0x43, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x60, 0x39,
+    0x00, 0x6A, 0x39, 0x00, 0x02, 0x00, 0x2D, 0x2E, 0xC8, 0x35, 0x00, 0x70, 0x39, 0x00, 0x03, 0x01,
+    0x26, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x74, 0x39, 0x00, 0x7A, 0x39, 0x00, 0x03, 0x01,
+    0x26, 0x00, 0x2D, 0x2E, 0xD1, 0xC8, 0x35, 0x00, 0x26, 0x39, 0x00, 0x80, 0x39, 0x00, 0x02, 0x00,
+    0x2D, 0xD1, 0xC8, 0x35, 0x00, 0x9A, 0x36, 0x00, 0x02, 0x02, 0x39, 0x00, 0x2D, 0xD1, 0xC8, 0x35,
+    0x00, 0x44, 0x38, 0x00, 0x01, 0x01, 0x26, 0x00, 0x2D, 0xC8, 0x35, 0x00, 0x02, 0x01, 0x26, 0x00,
+    0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x8A, 0x39, 0x00, 0x03, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x90, 0x39, 0x00, 0xAA, 0x39, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0xC0, 0x39, 0x00, 0xC6, 0x39, 0x00, 0x01, 0x02, 0x45, 0x00, 0x2D, 0xC8, 0x35, 0x00, 0x02, 0x01,
+    0x0A, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xCC, 0x39, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0xD2, 0x39, 0x00, 0xF0, 0x39, 0x00, 0x03, 0x03, 0xD9, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x0E, 0x3A, 0x00, 0x1C, 0x3A, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0x22, 0x3A, 0x00, 0x38, 0x3A, 0x00, 0x03, 0x02, 0x1A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0x46, 0x3A, 0x00, 0x4C, 0x3A, 0x00, 0x03, 0x01, 0x0A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0x52, 0x3A, 0x00, 0x60, 0x3A, 0x00, 0x03, 0x01, 0x0C, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0x6E, 0x3A, 0x00, 0x74, 0x3A, 0x00, 0x03, 0x02, 0x1A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0x7A, 0x3A, 0x00, 0x88, 0x3A, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x96, 0x3A,
+    0x00, 0xBC, 0x3A, 0x00, 0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x26, 0x39, 0x00,
+    0xD2, 0x3A, 0x00, 0xE4, 0x3A, 0x00, 0x03, 0x03, 0x3D, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0xF6, 0x3A, 0x00, 0x04, 0x3B, 0x00, 0x02, 0x02, 0x23, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x0E,
+    0x3B, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x14, 0x3B, 0x00, 0x2E, 0x3B, 0x00,
+    0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x3C, 0x3B, 0x00, 0x02, 0x01, 0x0C, 0x00, 0x2D, 0xD0,
+    0xC8, 0x35, 0x00, 0x42, 0x3B, 0x00, 0x02, 0x01, 0x0E, 0x00, 0x2D, 0x2E, 0xC8, 0x35, 0x00, 0x70,
+    0x39, 0x00, 0x03, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x48, 0x3B, 0x00, 0x5A,
+    0x3B, 0x00, 0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x26, 0x39, 0x00, 0x68, 0x3B,
+    0x00, 0x72, 0x3B, 0x00, 0x01, 0x03, 0xD4, 0x00, 0x2D, 0xC8, 0x35, 0x00, 0x01, 0x02, 0x43, 0x00,
+    0x2D, 0xC8, 0x35, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x88, 0x3B, 0x00, 0x92,
+    0x3B, 0x00, 0x03, 0x01, 0x11, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x9C, 0x3B, 0x00, 0xA2,
+    0x3B, 0x00, 0x02, 0x02, 0x1E, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xAC, 0x3B, 0x00, 0x02, 0x00,
+    0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xC0, 0x39, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xB2,
+    0x3B, 0x00, 0x03, 0x00, 0x2D, 0x2E, 0xD0, 0xC8, 0x35, 0x00, 0xBC, 0x3B, 0x00, 0xC0, 0x3B, 0x00,
+    0x03, 0x01, 0x11, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xCE, 0x3B, 0x00, 0xD8, 0x3B, 0x00,
+    0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xDE, 0x3B, 0x00, 0xF0, 0x3B, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x02, 0x3C, 0x00, 0x14, 0x3C, 0x00, 0x03, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0x1E, 0x3C, 0x00, 0x40, 0x3C, 0x00, 0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1,
+    0xC8, 0x35, 0x00, 0x26, 0x39, 0x00, 0x56, 0x3C, 0x00, 0x68, 0x3C, 0x00, 0x03, 0x03, 0x35, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x7A, 0x3C, 0x00, 0x84, 0x3C, 0x00, 0x03, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0x8A, 0x3C, 0x00, 0x90, 0x3C, 0x00, 0x03, 0x01, 0x26, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0x96, 0x3C, 0x00, 0xA8, 0x3C, 0x00, 0x03, 0x01, 0x0E, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0xB2, 0x3C, 0x00, 0xC8, 0x3C, 0x00, 0x01, 0x03, 0x3D, 0x00, 0x2D, 0xC8,
+    0x35, 0x00, 0x03, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xD2, 0x3C, 0x00, 0xF4,
+    0x3C, 0x00, 0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x26, 0x39, 0x00, 0x02, 0x3D,
+    0x00, 0x0C, 0x3D, 0x00, 0x03, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x12, 0x3D,
+    0x00, 0x20, 0x3D, 0x00, 0x02, 0x01, 0x0A, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x32, 0x3D, 0x00,
+    0x01, 0x03, 0x35, 0x00, 0x2D, 0xC8, 0x35, 0x00, 0x03, 0x02, 0x1A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x38, 0x3D, 0x00, 0x46, 0x3D, 0x00, 0x03, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x50, 0x3D, 0x00, 0x7A, 0x3D, 0x00, 0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35,
+    0x00, 0x26, 0x39, 0x00, 0x94, 0x3D, 0x00, 0xA6, 0x3D, 0x00, 0x02, 0x03, 0x3D, 0x00, 0x2D, 0xD0,
+    0xC8, 0x35, 0x00, 0xB8, 0x3D, 0x00, 0x03, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0xBE, 0x3D, 0x00, 0xD4, 0x3D, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xEA, 0x3D,
+    0x00, 0xF0, 0x3D, 0x00, 0x04, 0x01, 0x0C, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x70,
+    0x39, 0x00, 0xFA, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x03, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x06, 0x3E, 0x00, 0x14, 0x3E, 0x00, 0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35,
+    0x00, 0x26, 0x39, 0x00, 0x22, 0x3E, 0x00, 0x2C, 0x3E, 0x00, 0x03, 0x01, 0x0A, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0x3E, 0x3E, 0x00, 0x4C, 0x3E, 0x00, 0x03, 0x01, 0x0C, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0x52, 0x3E, 0x00, 0x58, 0x3E, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x5E, 0x3E, 0x00, 0x74, 0x3E, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0x8E, 0x3E, 0x00, 0xA0, 0x3E, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xA6, 0x3E,
+    0x00, 0xBC, 0x3E, 0x00, 0x03, 0x01, 0x0A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xCA, 0x3E,
+    0x00, 0xD4, 0x3E, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xDE, 0x3E, 0x00, 0xEC,
+    0x3E, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xF6, 0x3E, 0x00, 0x14, 0x3F, 0x00,
+    0x03, 0x01, 0x0A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x26, 0x3F, 0x00, 0x38, 0x3F, 0x00,
+    0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x3E, 0x3F, 0x00, 0x50, 0x3F, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x5E, 0x3F, 0x00, 0x68, 0x3F, 0x00, 0x03, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0x7E, 0x3F, 0x00, 0x88, 0x3F, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x9A, 0x3F, 0x00, 0xA4, 0x3F, 0x00, 0x03, 0x01, 0x0C, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0xB6, 0x3F, 0x00, 0xE0, 0x3F, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0xF6, 0x3F, 0x00, 0x10, 0x40, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x1E, 0x40,
+    0x00, 0x34, 0x40, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x4E, 0x40, 0x00, 0x70,
+    0x40, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x7A, 0x40, 0x00, 0x90, 0x40, 0x00,
+    0x02, 0x02, 0x23, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xAA, 0x40, 0x00, 0x03, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0xB8, 0x40, 0x00, 0xC2, 0x40, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0xC8, 0x40, 0x00, 0xDA, 0x40, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xE4,
+    0x40, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xEA, 0x40, 0x00, 0x02, 0x00, 0x2D, 0xD0,
+    0xC8, 0x35, 0x00, 0xF0, 0x40, 0x00, 0x02, 0x01, 0x0A, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xF6,
+    0x40, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xFC, 0x40, 0x00, 0x06, 0x41, 0x00,
+    0x03, 0x01, 0x0E, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x0C, 0x41, 0x00, 0x1A, 0x41, 0x00,
+    0x03, 0x02, 0x1A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x20, 0x41, 0x00, 0x36, 0x41, 0x00,
+    0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x44, 0x41, 0x00, 0x5A, 0x41, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x60, 0x41, 0x00, 0x6A, 0x41, 0x00, 0x03, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0x70, 0x41, 0x00, 0x76, 0x41, 0x00, 0x02, 0x01, 0x11, 0x00, 0x2D, 0xD0,
+    0xC8, 0x35, 0x00, 0x7C, 0x41, 0x00, 0x02, 0x02, 0x1A, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x86,
+    0x41, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x8C, 0x41, 0x00, 0x92, 0x41, 0x00,
+    0x02, 0x02, 0x45, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x86, 0x41, 0x00, 0x02, 0x00, 0x2D, 0xD1,
+    0xC8, 0x35, 0x00, 0x1A, 0x41, 0x00, 0x02, 0x01, 0x0C, 0x00, 0x2D, 0x2E, 0xC8, 0x35, 0x00, 0x70,
+    0x39, 0x00, 0x03, 0x00, 0x2D, 0x2E, 0xD1, 0xC8, 0x35, 0x00, 0x26, 0x39, 0x00, 0x80, 0x39, 0x00,
+    0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x9C, 0x41, 0x00, 0xA2, 0x41, 0x00, 0x03, 0x02,
+    0x73, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xA8, 0x41, 0x00, 0xE2, 0x41, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x08, 0x42, 0x00, 0x22, 0x42, 0x00, 0x02, 0x01, 0x0C, 0x00,
+    0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x34, 0x42, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x42,
+    0x42, 0x00, 0x02, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x50, 0x42, 0x00, 0x01, 0x02,
+    0x14, 0x00, 0x2D, 0xC8, 0x35, 0x00, 0x04, 0x01, 0x26, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35,
+    0x00, 0xBC, 0x3B, 0x00, 0x5E, 0x42, 0x00, 0x6C, 0x42, 0x00, 0x02, 0x02, 0x1A, 0x00, 0x2D, 0xD0,
+    0xC8, 0x35, 0x00, 0x7E, 0x42, 0x00, 0x03, 0x01, 0x0A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0x84, 0x42, 0x00, 0x8E, 0x42, 0x00, 0x02, 0x02, 0x45, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x94,
+    0x42, 0x00, 0x03, 0x01, 0x0A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x9A, 0x42, 0x00, 0xAC,
+    0x42, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xBA, 0x42, 0x00, 0xF4, 0x42, 0x00,
+    0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x12, 0x43, 0x00, 0x24, 0x43, 0x00, 0x02, 0x01,
+    0x0C, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xC0, 0x39, 0x00, 0x04, 0x01, 0x26, 0x00, 0x2D, 0x2E,
+    0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xBC, 0x3B, 0x00, 0x32, 0x43, 0x00, 0x54, 0x43, 0x00, 0x04, 0x00,
+    0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x70, 0x39, 0x00, 0xFA, 0x3D, 0x00, 0x00, 0x3E, 0x00,
+    0x03, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x66, 0x43, 0x00, 0x74, 0x43, 0x00,
+    0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x7E, 0x43, 0x00, 0x82, 0x43, 0x00, 0x8C,
+    0x43, 0x00, 0x03, 0x01, 0x0A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x96, 0x43, 0x00, 0xBC,
+    0x43, 0x00, 0x02, 0x02, 0x1A, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0xD2, 0x43, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xD8, 0x43, 0x00, 0xEE, 0x43, 0x00, 0x03, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0x08, 0x44, 0x00, 0x1A, 0x44, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x20, 0x44, 0x00, 0x32, 0x44, 0x00, 0x03, 0x01, 0x0A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x3C, 0x44, 0x00, 0x5A, 0x44, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x60,
+    0x44, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x66, 0x44, 0x00, 0x9A, 0x36, 0x00,
+    0x02, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0x7C, 0x44, 0x00, 0x03, 0x01, 0x0A, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0x82, 0x44, 0x00, 0x94, 0x44, 0x00, 0x03, 0x01, 0x0A, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0xA2, 0x44, 0x00, 0xB4, 0x44, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0xBE, 0x44, 0x00, 0xD4, 0x44, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0xDE, 0x44, 0x00, 0xEC, 0x44, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xFA, 0x44,
+    0x00, 0x20, 0x45, 0x00, 0x02, 0x01, 0x0C, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x3A, 0x45, 0x00,
+    0x03, 0x01, 0x0A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x4C, 0x45, 0x00, 0x62, 0x45, 0x00,
+    0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x68, 0x45, 0x00, 0x8E, 0x45, 0x00, 0x03, 0x01,
+    0x0A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x9C, 0x45, 0x00, 0xAA, 0x45, 0x00, 0x02, 0x02,
+    0x23, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xB8, 0x45, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0xBE, 0x45, 0x00, 0x3E, 0x38, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0xC4, 0x45, 0x00, 0xD2, 0x45, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xDC, 0x45,
+    0x00, 0xE2, 0x45, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xE8, 0x45, 0x00, 0xF2,
+    0x45, 0x00, 0x02, 0x01, 0x0A, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xF8, 0x45, 0x00, 0x02, 0x01,
+    0x0E, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xFE, 0x45, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0xC8, 0x35,
+    0x00, 0x04, 0x46, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x86, 0x41, 0x00, 0x02, 0x00,
+    0x2D, 0xD1, 0xC8, 0x35, 0x00, 0x0A, 0x46, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x46,
+    0x3A, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x14, 0x46, 0x00, 0x26, 0x46, 0x00,
+    0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x30, 0x46, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x30, 0x46, 0x00, 0x36, 0x46, 0x00, 0x01, 0x01, 0x07, 0x00, 0x2D, 0xC8, 0x35, 0x00,
+    0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x3C, 0x46, 0x00, 0x66, 0x46, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x84, 0x46, 0x00, 0x92, 0x46, 0x00, 0x02, 0x02, 0x1A, 0x00,
+    0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xAC, 0x3B, 0x00, 0x03, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x98, 0x46, 0x00, 0xA6, 0x46, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0xAC, 0x46, 0x00, 0xBA, 0x46, 0x00, 0x02, 0x03, 0x3D, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0x1C,
+    0x38, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xC4, 0x46, 0x00, 0xD6, 0x46, 0x00,
+    0x03, 0x02, 0x1A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xF0, 0x46, 0x00, 0xFA, 0x46, 0x00,
+    0x03, 0x01, 0x11, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x00, 0x47, 0x00, 0x22, 0x47, 0x00,
+    0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x26, 0x39, 0x00, 0x3C, 0x47, 0x00, 0x4A,
+    0x47, 0x00, 0x03, 0x01, 0x0C, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x54, 0x47, 0x00, 0x76,
+    0x47, 0x00, 0x03, 0x02, 0x1A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x80, 0x47, 0x00, 0x5A,
+    0x44, 0x00, 0x03, 0x01, 0x11, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x8A, 0x47, 0x00, 0xA4,
+    0x47, 0x00, 0x01, 0x01, 0x11, 0x00, 0x2D, 0xC8, 0x35, 0x00, 0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1,
+    0xC8, 0x35, 0x00, 0xBE, 0x47, 0x00, 0xC2, 0x47, 0x00, 0xE8, 0x47, 0x00, 0x02, 0x01, 0x0C, 0x00,
+    0x2D, 0xD1, 0xC8, 0x35, 0x00, 0xC6, 0x39, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0x02, 0x48, 0x00, 0x92, 0x46, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x10, 0x48, 0x00,
+    0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xBE, 0x47, 0x00, 0x1E, 0x48, 0x00, 0x40,
+    0x48, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x4E, 0x48, 0x00, 0x03, 0x01, 0x26, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x54, 0x48, 0x00, 0x76, 0x48, 0x00, 0x02, 0x02, 0x1A, 0x00,
+    0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x88, 0x48, 0x00, 0x02, 0x02, 0x1A, 0x00, 0x2D, 0xD1, 0xC8, 0x35,
+    0x00, 0x92, 0x48, 0x00, 0x02, 0x02, 0x1A, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x9C, 0x48, 0x00,
+    0x03, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xA2, 0x48, 0x00, 0xC4, 0x48, 0x00,
+    0x02, 0x03, 0x3D, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xDA, 0x48, 0x00, 0x04, 0x00, 0x2D, 0x2E,
+    0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xBE, 0x47, 0x00, 0xE0, 0x48, 0x00, 0x0A, 0x49, 0x00, 0x02, 0x03,
+    0x3D, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xFE, 0x45, 0x00, 0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1,
+    0xC8, 0x35, 0x00, 0xBE, 0x47, 0x00, 0x1C, 0x49, 0x00, 0x2E, 0x49, 0x00, 0x04, 0x00, 0x2D, 0x2E,
+    0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x34, 0x49, 0x00, 0x38, 0x49, 0x00, 0x56, 0x49, 0x00, 0x04, 0x01,
+    0x11, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xBE, 0x47, 0x00, 0x78, 0x49, 0x00, 0x7E,
+    0x49, 0x00, 0x04, 0x01, 0x26, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xBC, 0x3B, 0x00,
+    0x88, 0x49, 0x00, 0x96, 0x49, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xA0, 0x49,
+    0x00, 0xB2, 0x49, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xBC, 0x49, 0x00, 0xDA,
+    0x49, 0x00, 0x02, 0x02, 0x78, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xF0, 0x49, 0x00, 0x02, 0x02,
+    0x45, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xFA, 0x49, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x00, 0x4A, 0x00, 0x16, 0x4A, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0x24, 0x4A, 0x00, 0x36, 0x4A, 0x00, 0x02, 0x03, 0x3D, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x3C,
+    0x4A, 0x00, 0x02, 0x02, 0x1A, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x42, 0x4A, 0x00, 0x03, 0x02,
+    0x1A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x48, 0x4A, 0x00, 0x56, 0x4A, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x64, 0x4A, 0x00, 0x8E, 0x4A, 0x00, 0x02, 0x01, 0x0C, 0x00,
+    0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x46, 0x3A, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0xA0, 0x4A, 0x00, 0xAE, 0x4A, 0x00, 0x03, 0x02, 0x1A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0xB4, 0x4A, 0x00, 0xC2, 0x4A, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0xC8, 0x4A, 0x00,
+    0x02, 0x01, 0x0C, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xD2, 0x4A, 0x00, 0x02, 0x00, 0x2D, 0xD0,
+    0xC8, 0x35, 0x00, 0xD8, 0x4A, 0x00, 0x03, 0x01, 0x0C, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0xE2, 0x4A, 0x00, 0xE8, 0x4A, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xEE, 0x4A,
+    0x00, 0xF4, 0x4A, 0x00, 0x03, 0x00, 0x2D, 0x2E, 0xD1, 0xC8, 0x35, 0x00, 0x26, 0x39, 0x00, 0xFA,
+    0x4A, 0x00, 0x02, 0x01, 0x0C, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0x9A, 0x36, 0x00, 0x02, 0x00,
+    0x2D, 0xD1, 0xC8, 0x35, 0x00, 0x04, 0x4B, 0x00, 0x03, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x0E, 0x4B, 0x00, 0x34, 0x4B, 0x00, 0x03, 0x01, 0x0C, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x5E, 0x4B, 0x00, 0x5A, 0x44, 0x00, 0x03, 0x02, 0x1A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x70, 0x4B, 0x00, 0x8A, 0x4B, 0x00, 0x04, 0x01, 0x26, 0x00, 0x2D, 0x2E, 0xD0, 0xD1,
+    0xC8, 0x35, 0x00, 0x70, 0x39, 0x00, 0x98, 0x4B, 0x00, 0xCA, 0x4B, 0x00, 0x02, 0x03, 0x3D, 0x00,
+    0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xF0, 0x4B, 0x00, 0x03, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0xF6, 0x4B, 0x00, 0x10, 0x4C, 0x00, 0x03, 0x02, 0x1A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x26, 0x4C, 0x00, 0x34, 0x4C, 0x00, 0x02, 0x02, 0x1A, 0x00, 0x2D, 0xD0, 0xC8, 0x35,
+    0x00, 0x3E, 0x4C, 0x00, 0x03, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x44, 0x4C,
+    0x00, 0x66, 0x4C, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x7C, 0x4C, 0x00, 0x03, 0x02,
+    0x1A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x8A, 0x4C, 0x00, 0xAC, 0x4C, 0x00, 0x03, 0x02,
+    0x1A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xBE, 0x4C, 0x00, 0xCC, 0x4C, 0x00, 0x02, 0x01,
+    0x26, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0xD2, 0x4C, 0x00, 0x02, 0x01, 0x0A, 0x00, 0x2D, 0xD0,
+    0xC8, 0x35, 0x00, 0x86, 0x41, 0x00, 0x02, 0x02, 0x1A, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x32,
+    0x38, 0x00, 0x02, 0x01, 0x0C, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0xE0, 0x4C, 0x00, 0x02, 0x01,
+    0x26, 0x00, 0x2D, 0x2E, 0xC8, 0x35, 0x00, 0xBC, 0x3B, 0x00, 0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1,
+    0xC8, 0x35, 0x00, 0x26, 0x39, 0x00, 0xE6, 0x4C, 0x00, 0xF8, 0x4C, 0x00, 0x02, 0x02, 0x43, 0x00,
+    0x2D, 0xD1, 0xC8, 0x35, 0x00, 0x12, 0x4D, 0x00, 0x02, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xC8, 0x35,
+    0x00, 0x18, 0x4D, 0x00, 0x02, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x1E, 0x4D, 0x00,
+    0x02, 0x03, 0x3D, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x24, 0x4D, 0x00, 0x03, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0x2E, 0x4D, 0x00, 0x44, 0x4D, 0x00, 0x03, 0x01, 0x0A, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0x52, 0x4D, 0x00, 0x5C, 0x4D, 0x00, 0x03, 0x01, 0x0E, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0x6E, 0x4D, 0x00, 0x78, 0x4D, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x7E, 0x4D, 0x00, 0x98, 0x4D, 0x00, 0x03, 0x01, 0x0A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0xAA, 0x4D, 0x00, 0xC0, 0x4D, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xCE,
+    0x4D, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xD4, 0x4D, 0x00, 0xF2, 0x4D, 0x00,
+    0x03, 0x01, 0x0D, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xFC, 0x4D, 0x00, 0x12, 0x4E, 0x00,
+    0x02, 0x01, 0x0C, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0x18, 0x4E, 0x00, 0x03, 0x01, 0x0A, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x1E, 0x4E, 0x00, 0x30, 0x4E, 0x00, 0x03, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0x3E, 0x4E, 0x00, 0x54, 0x4E, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x6A, 0x4E, 0x00, 0x7C, 0x4E, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0x92, 0x4E, 0x00, 0xA8, 0x4E, 0x00, 0x03, 0x02, 0x23, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0xB6, 0x4E, 0x00, 0xC0, 0x4E, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xCE, 0x4E,
+    0x00, 0xDC, 0x4E, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xE6, 0x4E, 0x00, 0x00,
+    0x4F, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x1E, 0x4F, 0x00, 0x40, 0x4F, 0x00,
+    0x03, 0x01, 0x0A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x5E, 0x4F, 0x00, 0x7C, 0x4F, 0x00,
+    0x03, 0x02, 0x23, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x96, 0x4F, 0x00, 0x9C, 0x4F, 0x00,
+    0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xA6, 0x4F, 0x00, 0xB8, 0x4F, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xC2, 0x4F, 0x00, 0xD4, 0x4F, 0x00, 0x02, 0x00, 0x2D, 0xD0,
+    0xC8, 0x35, 0x00, 0xDE, 0x4F, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xE4, 0x4F,
+    0x00, 0xEE, 0x4F, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xF4, 0x4F, 0x00, 0xE0,
+    0x4C, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0x02, 0x50, 0x00, 0x03, 0x01, 0x0A, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x08, 0x50, 0x00, 0x16, 0x50, 0x00, 0x02, 0x01, 0x0A, 0x00,
+    0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x1C, 0x50, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0x22, 0x50, 0x00, 0x34, 0x50, 0x00, 0x03, 0x01, 0x07, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0x4E, 0x50, 0x00, 0x64, 0x50, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x76, 0x50,
+    0x00, 0x88, 0x50, 0x00, 0x01, 0x02, 0x3B, 0x00, 0x2D, 0xC8, 0x35, 0x00, 0x04, 0x00, 0x2D, 0x2E,
+    0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x26, 0x39, 0x00, 0x8E, 0x50, 0x00, 0xA0, 0x50, 0x00, 0x03, 0x02,
+    0x1A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xB2, 0x50, 0x00, 0xBC, 0x50, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xC2, 0x50, 0x00, 0xEC, 0x50, 0x00, 0x02, 0x02, 0x45, 0x00,
+    0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x0A, 0x51, 0x00, 0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35,
+    0x00, 0x26, 0x39, 0x00, 0x10, 0x51, 0x00, 0x1E, 0x51, 0x00, 0x02, 0x03, 0x3D, 0x00, 0x2D, 0xD0,
+    0xC8, 0x35, 0x00, 0x2C, 0x51, 0x00, 0x03, 0x02, 0x1A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0x3A, 0x51, 0x00, 0x3A, 0x36, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x44, 0x51,
+    0x00, 0x4E, 0x51, 0x00, 0x03, 0x00, 0x2D, 0x2E, 0xD1, 0xC8, 0x35, 0x00, 0x26, 0x39, 0x00, 0x58,
+    0x51, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0x5E, 0x51, 0x00, 0x01, 0x02, 0x12, 0x00,
+    0x2D, 0xC8, 0x35, 0x00, 0x02, 0x01, 0x07, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0x64, 0x51, 0x00,
+    0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xBE, 0x47, 0x00, 0x6E, 0x51, 0x00, 0xA0,
+    0x51, 0x00, 0x02, 0x02, 0x1A, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xBA, 0x51, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xC4, 0x51, 0x00, 0xD6, 0x51, 0x00, 0x03, 0x01, 0x0C, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xE0, 0x51, 0x00, 0x5A, 0x44, 0x00, 0x03, 0x02, 0x1A, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xEE, 0x51, 0x00, 0x08, 0x52, 0x00, 0x04, 0x00, 0x2D, 0x2E,
+    0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xBE, 0x47, 0x00, 0x0E, 0x52, 0x00, 0x40, 0x52, 0x00, 0x02, 0x00,
+    0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x5A, 0x52, 0x00, 0x02, 0x01, 0x0C, 0x00, 0x2D, 0xD0, 0xC8, 0x35,
+    0x00, 0x64, 0x52, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x6E, 0x52, 0x00, 0x9C,
+    0x52, 0x00, 0x03, 0x02, 0x1A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xC2, 0x52, 0x00, 0x6A,
+    0x39, 0x00, 0x02, 0x03, 0x3D, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0xCC, 0x52, 0x00, 0x02, 0x01,
+    0x0C, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0xDA, 0x52, 0x00, 0x02, 0x02, 0x1A, 0x00, 0x2D, 0xD0,
+    0xC8, 0x35, 0x00, 0xE0, 0x52, 0x00, 0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xBE,
+    0x47, 0x00, 0xF2, 0x52, 0x00, 0x28, 0x53, 0x00, 0x02, 0x01, 0x0C, 0x00, 0x2D, 0xD0, 0xC8, 0x35,
+    0x00, 0x4E, 0x53, 0x00, 0x03, 0x02, 0x78, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x54, 0x53,
+    0x00, 0x62, 0x53, 0x00, 0x03, 0x02, 0x1A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x68, 0x53,
+    0x00, 0x7A, 0x53, 0x00, 0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xBE, 0x47, 0x00,
+    0x8C, 0x53, 0x00, 0xA6, 0x53, 0x00, 0x03, 0x01, 0x0C, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0xB8, 0x53, 0x00, 0x9A, 0x36, 0x00, 0x02, 0x01, 0x0C, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xCA,
+    0x53, 0x00, 0x02, 0x02, 0x1A, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xD0, 0x53, 0x00, 0x03, 0x01,
+    0x0C, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xDA, 0x53, 0x00, 0xE0, 0x4C, 0x00, 0x04, 0x00,
+    0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xBE, 0x47, 0x00, 0xE0, 0x53, 0x00, 0xF6, 0x53, 0x00,
+    0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x26, 0x39, 0x00, 0x00, 0x54, 0x00, 0x72,
+    0x3B, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x0E, 0x54, 0x00, 0x03, 0x01, 0x11, 0x00,
+    0x2D, 0x2E, 0xD1, 0xC8, 0x35, 0x00, 0xBE, 0x47, 0x00, 0x14, 0x54, 0x00, 0x03, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0x18, 0x4D, 0x00, 0x1A, 0x54, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x20, 0x54, 0x00, 0x32, 0x54, 0x00, 0x03, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x38, 0x54, 0x00, 0x4E, 0x54, 0x00, 0x03, 0x02, 0x64, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x64, 0x54, 0x00, 0x6A, 0x54, 0x00, 0x02, 0x02, 0x43, 0x00, 0x2D, 0xD0, 0xC8, 0x35,
+    0x00, 0x7C, 0x54, 0x00, 0x02, 0x01, 0x0E, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x82, 0x54, 0x00,
+    0x03, 0x02, 0x64, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x90, 0x54, 0x00, 0x6A, 0x41, 0x00,
+    0x03, 0x02, 0x43, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xA2, 0x54, 0x00, 0xB4, 0x54, 0x00,
+    0x03, 0x02, 0x43, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xBE, 0x54, 0x00, 0xCC, 0x54, 0x00,
+    0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x34, 0x49, 0x00, 0xD2, 0x54, 0x00, 0xEC,
+    0x54, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xFA, 0x54, 0x00, 0x0C, 0x55, 0x00,
+    0x03, 0x01, 0x11, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x26, 0x55, 0x00, 0x2C, 0x55, 0x00,
+    0x03, 0x01, 0x0A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x32, 0x55, 0x00, 0x44, 0x55, 0x00,
+    0x03, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x4E, 0x55, 0x00, 0x68, 0x55, 0x00,
+    0x03, 0x01, 0x0E, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x7E, 0x55, 0x00, 0x94, 0x55, 0x00,
+    0x03, 0x01, 0x26, 0x00, 0x2D, 0x2E, 0xD0, 0xC8, 0x35, 0x00, 0x26, 0x39, 0x00, 0x9A, 0x55, 0x00,
+    0x03, 0x02, 0x1A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xA4, 0x55, 0x00, 0xCA, 0x55, 0x00,
+    0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x26, 0x39, 0x00, 0xD4, 0x55, 0x00, 0x02,
+    0x56, 0x00, 0x03, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x2C, 0x56, 0x00, 0x4E,
+    0x56, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x60, 0x56, 0x00, 0x02, 0x02, 0x23, 0x00,
+    0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x60, 0x56, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x66,
+    0x56, 0x00, 0x03, 0x01, 0x0E, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x78, 0x56, 0x00, 0x8E,
+    0x56, 0x00, 0x02, 0x01, 0x0E, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x94, 0x42, 0x00, 0x03, 0x02,
+    0x64, 0x00, 0x2D, 0x2E, 0xD0, 0xC8, 0x35, 0x00, 0x70, 0x39, 0x00, 0x94, 0x56, 0x00, 0x03, 0x01,
+    0x26, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x9A, 0x56, 0x00, 0xAC, 0x56, 0x00, 0x04, 0x00,
+    0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x26, 0x39, 0x00, 0x22, 0x3E, 0x00, 0xB2, 0x56, 0x00,
+    0x02, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0xC8, 0x56, 0x00, 0x02, 0x02, 0x43, 0x00, 0x2D, 0xD1,
+    0xC8, 0x35, 0x00, 0x6A, 0x39, 0x00, 0x03, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0xD2, 0x56, 0x00, 0xD8, 0x56, 0x00, 0x03, 0x02, 0x43, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0xDE, 0x56, 0x00, 0xE4, 0x56, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xEA, 0x56,
+    0x00, 0x08, 0x57, 0x00, 0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x26, 0x39, 0x00,
+    0x16, 0x57, 0x00, 0x28, 0x57, 0x00, 0x03, 0x02, 0x43, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0x3E, 0x57, 0x00, 0x60, 0x57, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x6E, 0x57,
+    0x00, 0x94, 0x57, 0x00, 0x03, 0x03, 0x3D, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xA2, 0x57,
+    0x00, 0xB0, 0x57, 0x00, 0x03, 0x02, 0x1A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xB6, 0x57,
+    0x00, 0x04, 0x46, 0x00, 0x03, 0x01, 0x0E, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xBC, 0x57,
+    0x00, 0xC2, 0x57, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xC8, 0x57, 0x00, 0xE6,
+    0x57, 0x00, 0x02, 0x02, 0x45, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xF8, 0x57, 0x00, 0x04, 0x00,
+    0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x7E, 0x43, 0x00, 0xFE, 0x57, 0x00, 0x2C, 0x58, 0x00,
+    0x02, 0x03, 0x57, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x4E, 0x58, 0x00, 0x02, 0x02, 0x1A, 0x00,
+    0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x30, 0x46, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0x64, 0x58, 0x00, 0x72, 0x58, 0x00, 0x01, 0x01, 0x38, 0x00, 0x2D, 0xC8, 0x35, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x74, 0x39, 0x00, 0x84, 0x58, 0x00, 0x04, 0x01, 0x0C, 0x00,
+    0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x34, 0x49, 0x00, 0x8A, 0x58, 0x00, 0x98, 0x58, 0x00,
+    0x02, 0x01, 0x11, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0x2C, 0x38, 0x00, 0x03, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0xA6, 0x58, 0x00, 0xB4, 0x58, 0x00, 0x03, 0x02, 0x43, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0xBA, 0x58, 0x00, 0xCC, 0x58, 0x00, 0x03, 0x01, 0x0A, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0xDA, 0x58, 0x00, 0xE0, 0x58, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0xE6, 0x58, 0x00, 0xF0, 0x58, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0xFA, 0x58, 0x00, 0x92, 0x46, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x0C, 0x59,
+    0x00, 0x1A, 0x59, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x20, 0x59, 0x00, 0x2A,
+    0x59, 0x00, 0x03, 0x01, 0x0A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x34, 0x59, 0x00, 0x3E,
+    0x59, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x48, 0x59, 0x00, 0x02, 0x00, 0x2D, 0xD0,
+    0xC8, 0x35, 0x00, 0x4E, 0x59, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x58, 0x59,
+    0x00, 0x6A, 0x59, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x70, 0x59, 0x00, 0x7A,
+    0x59, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0xDA, 0x52, 0x00, 0x03, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0x9A, 0x3F, 0x00, 0x8C, 0x59, 0x00, 0x03, 0x01, 0x0A, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0x92, 0x59, 0x00, 0xA8, 0x59, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0xB6, 0x59, 0x00, 0xBC, 0x59, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0xC2, 0x59, 0x00, 0xD8, 0x59, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xF2, 0x59,
+    0x00, 0x10, 0x5A, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x2A, 0x5A, 0x00, 0x40,
+    0x5A, 0x00, 0x03, 0x01, 0x0A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x5E, 0x5A, 0x00, 0xF4,
+    0x4A, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x64, 0x5A, 0x00, 0x3E, 0x38, 0x00,
+    0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x6E, 0x5A, 0x00, 0x9A, 0x36, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x7C, 0x5A, 0x00, 0x82, 0x5A, 0x00, 0x03, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0x90, 0x5A, 0x00, 0xA2, 0x5A, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0xA8, 0x5A, 0x00, 0xBA, 0x5A, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0xCC, 0x5A, 0x00, 0x84, 0x58, 0x00, 0x03, 0x01, 0x16, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0xDA, 0x5A, 0x00, 0xF4, 0x5A, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xFA, 0x5A, 0x00,
+    0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x08, 0x5B, 0x00, 0x12, 0x5B, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x20, 0x5B, 0x00, 0x92, 0x46, 0x00, 0x02, 0x02, 0x1A, 0x00,
+    0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x32, 0x5B, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0x3C, 0x5B, 0x00, 0x42, 0x5B, 0x00, 0x02, 0x00, 0x2D, 0x2E, 0xC8, 0x35, 0x00, 0x26, 0x39, 0x00,
+    0x03, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x4C, 0x5B, 0x00, 0x62, 0x5B, 0x00,
+    0x03, 0x02, 0x43, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x68, 0x5B, 0x00, 0x72, 0x5B, 0x00,
+    0x02, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x7C, 0x5B, 0x00, 0x03, 0x01, 0x26, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x82, 0x5B, 0x00, 0xA2, 0x41, 0x00, 0x03, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0x90, 0x5B, 0x00, 0x9E, 0x5B, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0xC8, 0x35,
+    0x00, 0xA8, 0x5B, 0x00, 0x02, 0x02, 0x1A, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0xAE, 0x5B, 0x00,
+    0x03, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xB4, 0x5B, 0x00, 0xBE, 0x5B, 0x00,
+    0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xD4, 0x5B, 0x00, 0xE6, 0x5B, 0x00, 0x04, 0x00,
+    0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xBE, 0x47, 0x00, 0xF0, 0x5B, 0x00, 0x02, 0x5C, 0x00,
+    0x02, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0x18, 0x5C, 0x00, 0x04, 0x01, 0x07, 0x00, 0x2D, 0x2E,
+    0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xBC, 0x3B, 0x00, 0x1E, 0x5C, 0x00, 0x28, 0x5C, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x2E, 0x5C, 0x00, 0x34, 0x5C, 0x00, 0x03, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0x3E, 0x5C, 0x00, 0x50, 0x5C, 0x00, 0x03, 0x01, 0x07, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0x5A, 0x5C, 0x00, 0x68, 0x5C, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x76, 0x5C, 0x00, 0x80, 0x5C, 0x00, 0x01, 0x01, 0x25, 0x00, 0x2D, 0xC8, 0x35, 0x00,
+    0x02, 0x01, 0x25, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x86, 0x5C, 0x00, 0x03, 0x01, 0x26, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x8C, 0x5C, 0x00, 0x96, 0x5C, 0x00, 0x03, 0x01, 0x26, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xA0, 0x5C, 0x00, 0xAE, 0x5C, 0x00, 0x02, 0x01, 0x11, 0x00,
+    0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xB8, 0x5C, 0x00, 0x03, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0xBE, 0x5C, 0x00, 0xC4, 0x5C, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xCA,
+    0x5C, 0x00, 0x02, 0x01, 0x26, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xDC, 0x5C, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xEA, 0x5C, 0x00, 0x6A, 0x41, 0x00, 0x02, 0x01, 0x26, 0x00,
+    0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xBE, 0x5C, 0x00, 0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0xC8, 0x35,
+    0x00, 0x26, 0x39, 0x00, 0x82, 0x43, 0x00, 0x72, 0x3B, 0x00, 0x02, 0x01, 0x26, 0x00, 0x2D, 0xD1,
+    0xC8, 0x35, 0x00, 0xF8, 0x5C, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xFE, 0x5C,
+    0x00, 0x10, 0x5D, 0x00, 0x02, 0x01, 0x11, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x1E, 0x5D, 0x00,
+    0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x24, 0x5D, 0x00, 0xA2, 0x41, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x36, 0x5D, 0x00, 0x40, 0x5D, 0x00, 0x02, 0x03, 0x3D, 0x00,
+    0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x46, 0x5D, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0x4C, 0x5D, 0x00, 0x5A, 0x5D, 0x00, 0x02, 0x01, 0x0C, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0x6C,
+    0x5D, 0x00, 0x03, 0x02, 0x1A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x72, 0x5D, 0x00, 0x78,
+    0x5D, 0x00, 0x02, 0x02, 0x32, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0x7E, 0x5D, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xC0, 0x39, 0x00, 0x0C, 0x3D, 0x00, 0x03, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0x84, 0x5D, 0x00, 0x8A, 0x5D, 0x00, 0x04, 0x01, 0x0C, 0x00, 0x2D, 0x2E,
+    0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x34, 0x49, 0x00, 0x90, 0x5D, 0x00, 0x9A, 0x5D, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xA8, 0x5D, 0x00, 0xBA, 0x5D, 0x00, 0x02, 0x00, 0x2D, 0xD0,
+    0xC8, 0x35, 0x00, 0xC8, 0x5D, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xCE, 0x5D,
+    0x00, 0xDC, 0x5D, 0x00, 0x02, 0x01, 0x0E, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xEA, 0x5D, 0x00,
+    0x02, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0xF0, 0x5D, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35,
+    0x00, 0xF6, 0x5D, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x32, 0x38, 0x00, 0x08,
+    0x5E, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x0E, 0x5E, 0x00, 0x02, 0x01, 0x0E, 0x00,
+    0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x20, 0x5E, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0x26, 0x5E, 0x00, 0x6A, 0x39, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x34, 0x5E, 0x00,
+    0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x3A, 0x5E, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x40, 0x5E, 0x00, 0x4E, 0x5E, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0x58, 0x5E, 0x00, 0x72, 0x5E, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x18, 0x4D,
+    0x00, 0x84, 0x5E, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x0C, 0x38, 0x00, 0x8E,
+    0x5E, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x94, 0x5E, 0x00, 0x02, 0x01, 0x0E, 0x00,
+    0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x9A, 0x5E, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0xA0,
+    0x5E, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0x08, 0x52, 0x00, 0x03, 0x01, 0x11, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xA6, 0x5E, 0x00, 0x84, 0x58, 0x00, 0x02, 0x00, 0x2D, 0xD0,
+    0xC8, 0x35, 0x00, 0xB0, 0x5E, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xB6, 0x5E, 0x00,
+    0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xC0, 0x5E, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x0C, 0x38, 0x00, 0xC6, 0x5E, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0xCC, 0x5E, 0x00, 0xD6, 0x5E, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xDC, 0x5E,
+    0x00, 0xEE, 0x5E, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xF4, 0x5E, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xFA, 0x5E, 0x00, 0x04, 0x5F, 0x00, 0x02, 0x01, 0x11, 0x00,
+    0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x0E, 0x5F, 0x00, 0x02, 0x01, 0x11, 0x00, 0x2D, 0xD0, 0xC8, 0x35,
+    0x00, 0x18, 0x5F, 0x00, 0x02, 0x01, 0x0A, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0x9A, 0x36, 0x00,
+    0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x0E, 0x54, 0x00, 0x1E, 0x5F, 0x00, 0x02, 0x00,
+    0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x24, 0x5F, 0x00, 0x02, 0x01, 0x11, 0x00, 0x2D, 0xD0, 0xC8, 0x35,
+    0x00, 0x2A, 0x5F, 0x00, 0x02, 0x01, 0x11, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0x8E, 0x5E, 0x00,
+    0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xF6, 0x40, 0x00, 0x02, 0x01, 0x11, 0x00, 0x2D, 0xD0,
+    0xC8, 0x35, 0x00, 0x30, 0x5F, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x36, 0x5F,
+    0x00, 0x44, 0x5F, 0x00, 0x03, 0x01, 0x07, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x4E, 0x5F,
+    0x00, 0x5C, 0x5F, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x62, 0x5F, 0x00, 0x5E,
+    0x51, 0x00, 0x02, 0x01, 0x0E, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x7C, 0x5B, 0x00, 0x03, 0x01,
+    0x0A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x6C, 0x5F, 0x00, 0x76, 0x5F, 0x00, 0x02, 0x00,
+    0x2D, 0xD1, 0xC8, 0x35, 0x00, 0x8C, 0x59, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x7C,
+    0x5F, 0x00, 0x02, 0x01, 0x0A, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x8A, 0x5F, 0x00, 0x02, 0x01,
+    0x0A, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x90, 0x5F, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x96, 0x5F, 0x00, 0xA4, 0x5F, 0x00, 0x01, 0x02, 0x28, 0x00, 0x2D, 0xC8, 0x35, 0x00,
+    0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xAA, 0x5F, 0x00, 0x44, 0x5F, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xBC, 0x5F, 0x00, 0xC2, 0x5F, 0x00, 0x03, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0xC8, 0x5F, 0x00, 0x44, 0x5F, 0x00, 0x02, 0x01, 0x0A, 0x00, 0x2D, 0xD0,
+    0xC8, 0x35, 0x00, 0xD2, 0x5F, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0xD8, 0x5F, 0x00,
+    0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xDE, 0x5F, 0x00, 0xE8, 0x5F, 0x00, 0x02, 0x00,
+    0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xF2, 0x5F, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0x8A, 0x3C, 0x00, 0x9A, 0x36, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0xFC, 0x5F, 0x00,
+    0x03, 0x01, 0x0A, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x06, 0x60, 0x00, 0x6A, 0x39, 0x00,
+    0x02, 0x01, 0x0A, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0x04, 0x46, 0x00, 0x03, 0x00, 0x2D, 0xD0,
+    0xD1, 0xC8, 0x35, 0x00, 0x10, 0x60, 0x00, 0x04, 0x46, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8,
+    0x35, 0x00, 0x2A, 0x5F, 0x00, 0x7C, 0x44, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0x16, 0x60, 0x00, 0x8C, 0x59, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x24, 0x60,
+    0x00, 0x2E, 0x60, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x34, 0x60, 0x00, 0x46,
+    0x60, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x0E, 0x54, 0x00, 0x92, 0x46, 0x00,
+    0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x58, 0x60, 0x00, 0x02, 0x01, 0x0C, 0x00, 0x2D, 0xD1,
+    0xC8, 0x35, 0x00, 0x5E, 0x60, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x64, 0x60,
+    0x00, 0x6E, 0x60, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0xC8, 0x35, 0x00, 0x78, 0x60, 0x00, 0x02, 0x00,
+    0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x82, 0x60, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0xC8, 0x35, 0x00, 0x88,
+    0x60, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x92, 0x60, 0x00, 0xA0, 0x60, 0x00,
+    0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x70, 0x59, 0x00, 0x44, 0x5F, 0x00, 0x02, 0x00,
+    0x2D, 0xD1, 0xC8, 0x35, 0x00, 0xAA, 0x60, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00,
+    0x9A, 0x3F, 0x00, 0x7C, 0x44, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xB4, 0x60,
+    0x00, 0xCA, 0x60, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xD0, 0x60, 0x00, 0xE2,
+    0x60, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0xF0, 0x60, 0x00, 0x02, 0x61, 0x00,
+    0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x08, 0x61, 0x00, 0x1A, 0x61, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0xC8, 0x35, 0x00, 0x30, 0x61, 0x00, 0x42, 0x61, 0x00, 0x00, 0x02, 0x02, 0x00,
+    0x01, 0x00, 0xD1, 0x48, 0x61, 0x00, 0x01, 0x00, 0xD1, 0x4E, 0x61, 0x00, 0x01, 0x00, 0xD0, 0x54,
+    0x61, 0x00, 0x00, 0x01, 0xE8, 0x00, 0x01, 0x00, 0xD1, 0x5A, 0x61, 0x00, 0x01, 0x00, 0xD1, 0x60,
+    0x61, 0x00, 0x01, 0x00, 0xD1, 0x66, 0x61, 0x00, 0x01, 0x00, 0xD0, 0x6C, 0x61, 0x00, 0x01, 0x00,
+    0xD0, 0x72, 0x61, 0x00, 0x01, 0x00, 0xD0, 0x78, 0x61, 0x00, 0x01, 0x00, 0xD1, 0x82, 0x61, 0x00,
+    0x01, 0x00, 0xD1, 0x88, 0x61, 0x00, 0x01, 0x00, 0xD0, 0x8E, 0x61, 0x00, 0x01, 0x00, 0xD0, 0x94,
+    0x61, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x9E, 0x61, 0x00, 0xA8, 0x61, 0x00, 0x01, 0x00, 0xD0, 0xAE,
+    0x61, 0x00, 0x01, 0x00, 0xD0, 0xB4, 0x61, 0x00, 0x01, 0x00, 0xD0, 0xC2, 0x61, 0x00, 0x01, 0x01,
+    0xE8, 0x00, 0xD0, 0xCC, 0x61, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xD2, 0x61,
+    0x00, 0xDC, 0x61, 0x00, 0x01, 0x00, 0xD1, 0xE2, 0x61, 0x00, 0x01, 0x00, 0xD0, 0xE8, 0x61, 0x00,
+    0x01, 0x00, 0xD0, 0xEE, 0x61, 0x00, 0x01, 0x00, 0xD0, 0xF4, 0x61, 0x00, 0x01, 0x00, 0xD1, 0xFA,
+    0x61, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x00, 0x62, 0x00, 0x06, 0x62, 0x00, 0x02, 0x01, 0xF3, 0x00,
+    0xD0, 0xD1, 0x10, 0x62, 0x00, 0x1E, 0x62, 0x00, 0x01, 0x00, 0xD1, 0xDC, 0x61, 0x00, 0x01, 0x00,
+    0xD0, 0x28, 0x62, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x2E, 0x62, 0x00, 0x38, 0x62, 0x00, 0x01, 0x00,
+    0xD0, 0x3E, 0x62, 0x00, 0x01, 0x00, 0xD0, 0x44, 0x62, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x01, 0x00,
+    0xD0, 0x4A, 0x62, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x00, 0x62, 0x00, 0x54, 0x62, 0x00, 0x01, 0x00,
+    0xD0, 0x5E, 0x62, 0x00, 0x01, 0x00, 0xD0, 0x64, 0x62, 0x00, 0x01, 0x00, 0xD0, 0x76, 0x62, 0x00,
+    0x01, 0x00, 0xD1, 0x7C, 0x62, 0x00, 0x01, 0x00, 0xD0, 0x82, 0x62, 0x00, 0x01, 0x00, 0xD1, 0x90,
+    0x62, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x9A, 0x62, 0x00, 0xA0, 0x62, 0x00, 0x01, 0x00, 0xD0, 0xAA,
+    0x62, 0x00, 0x01, 0x00, 0xD0, 0xB0, 0x62, 0x00, 0x01, 0x00, 0xD0, 0xB6, 0x62, 0x00, 0x01, 0x00,
+    0xD0, 0xBC, 0x62, 0x00, 0x01, 0x00, 0xD0, 0xC2, 0x62, 0x00, 0x01, 0x00, 0xD0, 0xC8, 0x62, 0x00,
+    0x01, 0x00, 0xD0, 0xD6, 0x62, 0x00, 0x01, 0x00, 0xD1, 0xDC, 0x62, 0x00, 0x01, 0x00, 0xD0, 0xE2,
+    0x62, 0x00, 0x01, 0x00, 0xD1, 0xE8, 0x62, 0x00, 0x01, 0x00, 0xD1, 0xEE, 0x62, 0x00, 0x01, 0x00,
+    0xD1, 0xF4, 0x62, 0x00, 0x00, 0x01, 0xE3, 0x00, 0x00, 0x02, 0x05, 0x00, 0x01, 0x00, 0xBF, 0xFA,
+    0x62, 0x00, 0x02, 0x00, 0x80, 0x86, 0xFA, 0x62, 0x00, 0xFA, 0x62, 0x00, 0x02, 0x00, 0xB5, 0xBB,
+    0xFE, 0x62, 0x00, 0x04, 0x63, 0x00, 0x02, 0x00, 0x80, 0x83, 0x0E, 0x63, 0x00, 0x14, 0x63, 0x00,
+    0x05, 0x00, 0xB2, 0xB5, 0xB7, 0xB8, 0xBE, 0x18, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x20, 0x63, 0x00,
+    0x26, 0x63, 0x00, 0x2E, 0x63, 0x00, 0x07, 0x00, 0x80, 0x81, 0x82, 0x83, 0x85, 0x87, 0x91, 0x36,
+    0x63, 0x00, 0x3C, 0x63, 0x00, 0x42, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x42, 0x63, 0x00, 0x46, 0x63,
+    0x00, 0x1C, 0x63, 0x00, 0x05, 0x00, 0xB0, 0xB4, 0xB8, 0xBB, 0xBE, 0x4C, 0x63, 0x00, 0x42, 0x63,
+    0x00, 0x54, 0x63, 0x00, 0x5A, 0x63, 0x00, 0x26, 0x39, 0x00, 0x01, 0x00, 0x83, 0x14, 0x63, 0x00,
+    0x05, 0x00, 0xB2, 0xB6, 0xB8, 0xBB, 0xBE, 0x60, 0x63, 0x00, 0x6C, 0x63, 0x00, 0x72, 0x63, 0x00,
+    0x42, 0x63, 0x00, 0x78, 0x63, 0x00, 0x04, 0x00, 0x80, 0x83, 0x86, 0x8B, 0x7E, 0x63, 0x00, 0x88,
+    0x63, 0x00, 0xFA, 0x62, 0x00, 0x8E, 0x63, 0x00, 0x04, 0x00, 0xB3, 0xB4, 0xBB, 0xBF, 0x94, 0x63,
+    0x00, 0x6C, 0x63, 0x00, 0xFA, 0x62, 0x00, 0x42, 0x63, 0x00, 0x02, 0x00, 0x80, 0x81, 0x3C, 0x63,
+    0x00, 0xFA, 0x62, 0x00, 0x05, 0x00, 0xB0, 0xB2, 0xB3, 0xB4, 0xBE, 0x9A, 0x63, 0x00, 0xA0, 0x63,
+    0x00, 0xAC, 0x63, 0x00, 0xB0, 0x63, 0x00, 0xB6, 0x63, 0x00, 0x01, 0x00, 0x80, 0x18, 0x63, 0x00,
+    0x01, 0x00, 0xB3, 0xC0, 0x63, 0x00, 0x01, 0x00, 0x85, 0x42, 0x63, 0x00, 0x04, 0x00, 0xB2, 0xBA,
+    0xBB, 0xBE, 0x18, 0x63, 0x00, 0xBE, 0x47, 0x00, 0xC8, 0x63, 0x00, 0xD0, 0x63, 0x00, 0x02, 0x00,
+    0x80, 0x81, 0xDA, 0x63, 0x00, 0x18, 0x63, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE, 0xE0, 0x63,
+    0x00, 0xE8, 0x63, 0x00, 0x14, 0x63, 0x00, 0xF0, 0x63, 0x00, 0x05, 0x00, 0x83, 0x8B, 0x8C, 0x8E,
+    0x91, 0xF6, 0x63, 0x00, 0x1C, 0x63, 0x00, 0xFE, 0x63, 0x00, 0x1C, 0x63, 0x00, 0xE8, 0x63, 0x00,
+    0x06, 0x00, 0xB0, 0xB1, 0xB5, 0xB8, 0xBD, 0xBE, 0x26, 0x39, 0x00, 0x04, 0x64, 0x00, 0x08, 0x64,
+    0x00, 0x0E, 0x64, 0x00, 0x14, 0x64, 0x00, 0x1E, 0x64, 0x00, 0x02, 0x00, 0x87, 0x91, 0x42, 0x63,
+    0x00, 0x08, 0x64, 0x00, 0x03, 0x00, 0xB0, 0xB4, 0xBE, 0x26, 0x64, 0x00, 0x30, 0x64, 0x00, 0x36,
+    0x64, 0x00, 0x04, 0x00, 0x80, 0x81, 0x83, 0x8C, 0x18, 0x63, 0x00, 0x40, 0x64, 0x00, 0x4A, 0x64,
+    0x00, 0x50, 0x64, 0x00, 0x02, 0x00, 0xB4, 0xBA, 0xFA, 0x62, 0x00, 0xFA, 0x62, 0x00, 0x02, 0x00,
+    0x80, 0x81, 0xFA, 0x62, 0x00, 0x58, 0x64, 0x00, 0x02, 0x00, 0xBB, 0xBE, 0x60, 0x64, 0x00, 0x66,
+    0x64, 0x00, 0x01, 0x00, 0x80, 0x72, 0x64, 0x00, 0x08, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB5, 0xB6,
+    0xB8, 0xBE, 0x78, 0x64, 0x00, 0x80, 0x64, 0x00, 0x86, 0x64, 0x00, 0x8C, 0x64, 0x00, 0x92, 0x64,
+    0x00, 0x9A, 0x64, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x07, 0x00, 0x82, 0x83, 0x85, 0x8B,
+    0x8E, 0x8F, 0x91, 0xA0, 0x64, 0x00, 0x1C, 0x63, 0x00, 0x18, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x1C,
+    0x63, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x03, 0x00, 0xBA, 0xBC, 0xBD, 0xAA, 0x64, 0x00,
+    0xAE, 0x64, 0x00, 0x20, 0x63, 0x00, 0x04, 0x00, 0x81, 0x82, 0x88, 0x8C, 0xB4, 0x64, 0x00, 0xBA,
+    0x64, 0x00, 0xC4, 0x64, 0x00, 0xCA, 0x64, 0x00, 0x05, 0x00, 0xB0, 0xB2, 0xB5, 0xB8, 0xBE, 0xD0,
+    0x64, 0x00, 0xD8, 0x64, 0x00, 0xE2, 0x64, 0x00, 0x1C, 0x63, 0x00, 0xE8, 0x64, 0x00, 0x07, 0x00,
+    0x80, 0x83, 0x85, 0x8B, 0x8C, 0x8E, 0x8F, 0xF4, 0x64, 0x00, 0x1C, 0x63, 0x00, 0xFA, 0x62, 0x00,
+    0x1C, 0x63, 0x00, 0xFA, 0x64, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x03, 0x00, 0xB1, 0xB4,
+    0xBB, 0x42, 0x63, 0x00, 0x04, 0x65, 0x00, 0x0C, 0x65, 0x00, 0x04, 0x00, 0x82, 0x85, 0x87, 0x8D,
+    0x12, 0x65, 0x00, 0xFA, 0x62, 0x00, 0x18, 0x65, 0x00, 0x20, 0x65, 0x00, 0x01, 0x00, 0xBB, 0x24,
+    0x65, 0x00, 0x02, 0x00, 0xB0, 0xBC, 0xFA, 0x62, 0x00, 0x28, 0x65, 0x00, 0x01, 0x00, 0x81, 0x2E,
+    0x65, 0x00, 0x02, 0x00, 0xB0, 0xBB, 0x26, 0x39, 0x00, 0x42, 0x63, 0x00, 0x01, 0x00, 0x82, 0x18,
+    0x63, 0x00, 0x01, 0x00, 0xBB, 0x42, 0x63, 0x00, 0x01, 0x00, 0xBB, 0x6C, 0x63, 0x00, 0x01, 0x00,
+    0x80, 0x42, 0x63, 0x00, 0x01, 0x00, 0x82, 0x36, 0x63, 0x00, 0x03, 0x00, 0xB1, 0xB2, 0xB7, 0xFA,
+    0x62, 0x00, 0xFA, 0x62, 0x00, 0xFA, 0x62, 0x00, 0x06, 0x00, 0xB1, 0xB3, 0xB4, 0xB7, 0xBB, 0xBE,
+    0x32, 0x65, 0x00, 0x38, 0x65, 0x00, 0x3E, 0x65, 0x00, 0x44, 0x65, 0x00, 0x4C, 0x65, 0x00, 0xFA,
+    0x62, 0x00, 0x02, 0x00, 0x81, 0x82, 0x52, 0x65, 0x00, 0xB0, 0x63, 0x00, 0x01, 0x00, 0x8B, 0xAC,
+    0x63, 0x00, 0x05, 0x00, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xBC, 0x3B, 0x00, 0x5C, 0x65, 0x00, 0x38,
+    0x65, 0x00, 0xBC, 0x3B, 0x00, 0x62, 0x65, 0x00, 0x03, 0x00, 0x81, 0x86, 0x89, 0x6E, 0x65, 0x00,
+    0xBC, 0x3B, 0x00, 0x26, 0x39, 0x00, 0x07, 0x00, 0xB0, 0xB1, 0xB6, 0xBA, 0xBB, 0xBD, 0xBE, 0xBC,
+    0x3B, 0x00, 0xFA, 0x62, 0x00, 0x26, 0x39, 0x00, 0xBC, 0x3B, 0x00, 0x78, 0x65, 0x00, 0x7E, 0x65,
+    0x00, 0x84, 0x65, 0x00, 0x02, 0x00, 0x82, 0x85, 0x32, 0x65, 0x00, 0x18, 0x63, 0x00, 0x02, 0x00,
+    0xB0, 0xB5, 0x90, 0x65, 0x00, 0x96, 0x65, 0x00, 0x06, 0x00, 0x83, 0x8B, 0x8C, 0x8E, 0x8F, 0x91,
+    0xA0, 0x65, 0x00, 0x26, 0x39, 0x00, 0xA6, 0x65, 0x00, 0xAA, 0x65, 0x00, 0x26, 0x39, 0x00, 0xB8,
+    0x65, 0x00, 0x08, 0x00, 0xB1, 0xB2, 0xB3, 0xB4, 0xB7, 0xBB, 0xBC, 0xBD, 0xC2, 0x65, 0x00, 0xC8,
+    0x65, 0x00, 0xCE, 0x65, 0x00, 0xC2, 0x65, 0x00, 0xD4, 0x65, 0x00, 0xD8, 0x65, 0x00, 0xE2, 0x65,
+    0x00, 0xEC, 0x65, 0x00, 0x04, 0x00, 0x80, 0x81, 0x82, 0x8F, 0xF2, 0x65, 0x00, 0xF8, 0x65, 0x00,
+    0x02, 0x66, 0x00, 0x0E, 0x66, 0x00, 0x00, 0x01, 0x0C, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE,
+    0x14, 0x66, 0x00, 0x1E, 0x66, 0x00, 0x28, 0x66, 0x00, 0x32, 0x66, 0x00, 0x06, 0x00, 0x81, 0x83,
+    0x8C, 0x8E, 0x8F, 0x91, 0x26, 0x39, 0x00, 0x3C, 0x66, 0x00, 0x26, 0x39, 0x00, 0x44, 0x66, 0x00,
+    0x1C, 0x63, 0x00, 0x4C, 0x66, 0x00, 0x02, 0x00, 0xBA, 0xBB, 0x14, 0x63, 0x00, 0x56, 0x66, 0x00,
+    0x02, 0x00, 0xB3, 0xBA, 0x38, 0x65, 0x00, 0x5A, 0x66, 0x00, 0x01, 0x00, 0x81, 0x18, 0x63, 0x00,
+    0x00, 0x01, 0x34, 0x00, 0x01, 0x00, 0xB3, 0x60, 0x66, 0x00, 0x01, 0x00, 0x81, 0x64, 0x66, 0x00,
+    0x02, 0x00, 0x81, 0x82, 0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0x01, 0x00, 0xB4, 0x38, 0x65, 0x00,
+    0x06, 0x00, 0xB1, 0xB3, 0xB4, 0xB6, 0xB7, 0xBD, 0x3E, 0x65, 0x00, 0xBC, 0x3B, 0x00, 0x70, 0x66,
+    0x00, 0x76, 0x66, 0x00, 0x18, 0x63, 0x00, 0x7C, 0x66, 0x00, 0x05, 0x00, 0x81, 0x82, 0x85, 0x86,
+    0x8F, 0x82, 0x66, 0x00, 0xB0, 0x63, 0x00, 0x20, 0x65, 0x00, 0xBC, 0x3B, 0x00, 0xBC, 0x3B, 0x00,
+    0x01, 0x00, 0xB8, 0x1C, 0x63, 0x00, 0x01, 0x00, 0x80, 0x1C, 0x63, 0x00, 0x01, 0x00, 0xBE, 0x88,
+    0x66, 0x00, 0x07, 0x00, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB9, 0xBF, 0xBE, 0x47, 0x00, 0xBC, 0x3B,
+    0x00, 0x8E, 0x66, 0x00, 0xBE, 0x47, 0x00, 0x94, 0x66, 0x00, 0xA0, 0x66, 0x00, 0x60, 0x66, 0x00,
+    0x07, 0x00, 0x80, 0x81, 0x82, 0x86, 0x8E, 0x8F, 0x91, 0xA6, 0x66, 0x00, 0xAC, 0x66, 0x00, 0xB8,
+    0x66, 0x00, 0xBE, 0x47, 0x00, 0xBE, 0x47, 0x00, 0xBE, 0x47, 0x00, 0xBE, 0x47, 0x00, 0x03, 0x00,
+    0xB3, 0xB4, 0xBE, 0xAC, 0x63, 0x00, 0xAC, 0x63, 0x00, 0xBE, 0x66, 0x00, 0x01, 0x00, 0x8A, 0xC4,
+    0x66, 0x00, 0x05, 0x00, 0xB0, 0xB3, 0xB7, 0xBD, 0xBE, 0xCC, 0x66, 0x00, 0xD6, 0x66, 0x00, 0xDC,
+    0x66, 0x00, 0xE4, 0x66, 0x00, 0x18, 0x63, 0x00, 0x03, 0x00, 0x81, 0x83, 0x84, 0xEA, 0x66, 0x00,
+    0xF0, 0x66, 0x00, 0xFA, 0x62, 0x00, 0x01, 0x00, 0xBB, 0xFA, 0x62, 0x00, 0x01, 0x00, 0x83, 0xF4,
+    0x66, 0x00, 0x03, 0x00, 0xB0, 0xB5, 0xB8, 0xFA, 0x66, 0x00, 0x02, 0x67, 0x00, 0x0C, 0x67, 0x00,
+    0x03, 0x00, 0x8E, 0x8F, 0x91, 0x14, 0x67, 0x00, 0x26, 0x39, 0x00, 0x1C, 0x67, 0x00, 0x01, 0x00,
+    0xB5, 0xBE, 0x47, 0x00, 0x01, 0x00, 0x91, 0xBE, 0x47, 0x00, 0x03, 0x00, 0xB0, 0xB5, 0xBE, 0x26,
+    0x67, 0x00, 0x2A, 0x67, 0x00, 0x20, 0x65, 0x00, 0x03, 0x00, 0x83, 0x8B, 0x91, 0x30, 0x67, 0x00,
+    0x14, 0x63, 0x00, 0x2A, 0x67, 0x00, 0x09, 0x00, 0xB1, 0xB2, 0xB4, 0xB5, 0xB6, 0xB8, 0xBA, 0xBC,
+    0xBF, 0x3E, 0x67, 0x00, 0x46, 0x67, 0x00, 0x4E, 0x67, 0x00, 0x3E, 0x65, 0x00, 0x5A, 0x67, 0x00,
+    0x60, 0x67, 0x00, 0xBE, 0x47, 0x00, 0x66, 0x67, 0x00, 0xAC, 0x63, 0x00, 0x05, 0x00, 0x80, 0x81,
+    0x82, 0x85, 0x8E, 0x6A, 0x67, 0x00, 0x70, 0x67, 0x00, 0x0E, 0x66, 0x00, 0x7A, 0x67, 0x00, 0xBE,
+    0x47, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE, 0x86, 0x67, 0x00, 0x94, 0x67, 0x00, 0x9E, 0x67,
+    0x00, 0xA8, 0x67, 0x00, 0x04, 0x00, 0x8B, 0x8E, 0x8F, 0x91, 0xB0, 0x67, 0x00, 0xBE, 0x47, 0x00,
+    0x1C, 0x63, 0x00, 0xB4, 0x67, 0x00, 0x03, 0x00, 0xB5, 0xBA, 0xBF, 0xBA, 0x67, 0x00, 0xBE, 0x67,
+    0x00, 0xC8, 0x67, 0x00, 0x02, 0x00, 0x8E, 0x91, 0xC8, 0x67, 0x00, 0xBA, 0x67, 0x00, 0x01, 0x00,
+    0xBE, 0xCC, 0x67, 0x00, 0x06, 0x00, 0xB0, 0xB3, 0xB7, 0xB8, 0xBA, 0xBF, 0xBE, 0x47, 0x00, 0x2E,
+    0x65, 0x00, 0xD6, 0x67, 0x00, 0x26, 0x39, 0x00, 0xAA, 0x64, 0x00, 0x2E, 0x65, 0x00, 0x03, 0x00,
+    0x81, 0x85, 0x87, 0xD4, 0x65, 0x00, 0xDA, 0x67, 0x00, 0xE0, 0x67, 0x00, 0x01, 0x00, 0xBE, 0xBE,
+    0x47, 0x00, 0x01, 0x00, 0xB8, 0xE6, 0x67, 0x00, 0x04, 0x00, 0xB1, 0xB3, 0xB7, 0xBF, 0xEC, 0x67,
+    0x00, 0x66, 0x67, 0x00, 0xF2, 0x67, 0x00, 0xAC, 0x63, 0x00, 0x03, 0x00, 0x82, 0x85, 0x88, 0x66,
+    0x67, 0x00, 0xAC, 0x63, 0x00, 0xF8, 0x67, 0x00, 0x02, 0x00, 0xB5, 0xB8, 0xBE, 0x47, 0x00, 0xFE,
+    0x67, 0x00, 0x05, 0x00, 0x81, 0x82, 0x8E, 0x8F, 0x91, 0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0xBE,
+    0x47, 0x00, 0xBE, 0x47, 0x00, 0xBE, 0x47, 0x00, 0x02, 0x00, 0xB4, 0xB7, 0x12, 0x65, 0x00, 0xBE,
+    0x47, 0x00, 0x02, 0x00, 0x80, 0x81, 0xA6, 0x66, 0x00, 0xBE, 0x47, 0x00, 0x01, 0x00, 0xB7, 0x18,
+    0x63, 0x00, 0x02, 0x00, 0x81, 0x83, 0x04, 0x68, 0x00, 0xFA, 0x62, 0x00, 0x01, 0x00, 0xB0, 0xAC,
+    0x63, 0x00, 0x02, 0x00, 0xB0, 0xB8, 0x0A, 0x68, 0x00, 0x10, 0x68, 0x00, 0x00, 0x01, 0x25, 0x00,
+    0x03, 0x00, 0xB1, 0xBD, 0xBE, 0x60, 0x66, 0x00, 0x14, 0x68, 0x00, 0x1A, 0x68, 0x00, 0x02, 0x00,
+    0xB1, 0xB3, 0x24, 0x68, 0x00, 0x3E, 0x65, 0x00, 0x01, 0x00, 0x81, 0x2E, 0x68, 0x00, 0x04, 0x00,
+    0xB0, 0xB5, 0xB8, 0xBE, 0x38, 0x68, 0x00, 0x46, 0x68, 0x00, 0x4E, 0x68, 0x00, 0x5C, 0x68, 0x00,
+    0x04, 0x00, 0x83, 0x8B, 0x8F, 0x91, 0x6A, 0x68, 0x00, 0xB0, 0x67, 0x00, 0x70, 0x68, 0x00, 0x46,
+    0x68, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE, 0x76, 0x68, 0x00, 0x7C, 0x68, 0x00, 0x8A, 0x68,
+    0x00, 0x90, 0x68, 0x00, 0x02, 0x00, 0x8F, 0x91, 0x14, 0x63, 0x00, 0x9A, 0x68, 0x00, 0x08, 0x00,
+    0xB1, 0xB2, 0xB6, 0xB7, 0xB8, 0xB9, 0xBB, 0xBC, 0xD4, 0x65, 0x00, 0xA0, 0x68, 0x00, 0x76, 0x66,
+    0x00, 0xA6, 0x68, 0x00, 0xAE, 0x68, 0x00, 0xBC, 0x3B, 0x00, 0x42, 0x63, 0x00, 0x28, 0x65, 0x00,
+    0x05, 0x00, 0x81, 0x82, 0x83, 0x87, 0x8E, 0xB4, 0x68, 0x00, 0xA6, 0x66, 0x00, 0xBA, 0x68, 0x00,
+    0xE0, 0x67, 0x00, 0xBC, 0x3B, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE, 0xC0, 0x68, 0x00, 0xCA,
+    0x68, 0x00, 0xD4, 0x68, 0x00, 0xDE, 0x68, 0x00, 0x04, 0x00, 0x83, 0x8B, 0x8E, 0x8F, 0xE8, 0x68,
+    0x00, 0xEE, 0x68, 0x00, 0x26, 0x39, 0x00, 0xF4, 0x68, 0x00, 0x02, 0x00, 0xB0, 0xB1, 0xFE, 0x68,
+    0x00, 0xFE, 0x68, 0x00, 0x01, 0x00, 0x82, 0x02, 0x69, 0x00, 0x01, 0x00, 0xB2, 0x18, 0x63, 0x00,
+    0x01, 0x00, 0x81, 0x08, 0x69, 0x00, 0x04, 0x00, 0xB1, 0xB3, 0xB7, 0xBE, 0x60, 0x66, 0x00, 0x10,
+    0x69, 0x00, 0x18, 0x63, 0x00, 0xFA, 0x62, 0x00, 0x02, 0x00, 0x81, 0x82, 0x1A, 0x69, 0x00, 0x12,
+    0x65, 0x00, 0x05, 0x00, 0xB5, 0xB8, 0xBA, 0xBB, 0xBE, 0x1C, 0x63, 0x00, 0x20, 0x69, 0x00, 0x14,
+    0x63, 0x00, 0x1C, 0x63, 0x00, 0x2C, 0x69, 0x00, 0x02, 0x00, 0x8F, 0x91, 0x26, 0x39, 0x00, 0x1C,
+    0x63, 0x00, 0x08, 0x00, 0xB1, 0xB2, 0xB7, 0xB8, 0xBA, 0xBC, 0xBE, 0xBF, 0x36, 0x69, 0x00, 0x40,
+    0x69, 0x00, 0x46, 0x69, 0x00, 0x52, 0x69, 0x00, 0xE0, 0x67, 0x00, 0x58, 0x69, 0x00, 0x5E, 0x69,
+    0x00, 0x64, 0x69, 0x00, 0x03, 0x00, 0x80, 0x81, 0x85, 0x6A, 0x69, 0x00, 0x70, 0x69, 0x00, 0xE0,
+    0x67, 0x00, 0x02, 0x00, 0xB0, 0xBC, 0x7A, 0x69, 0x00, 0x80, 0x69, 0x00, 0x01, 0x00, 0x81, 0x26,
+    0x39, 0x00, 0x03, 0x00, 0xB0, 0xBE, 0xBF, 0x84, 0x69, 0x00, 0x8E, 0x69, 0x00, 0x98, 0x69, 0x00,
+    0x04, 0x00, 0x81, 0x83, 0x84, 0x85, 0xA4, 0x69, 0x00, 0xF0, 0x66, 0x00, 0xAE, 0x69, 0x00, 0x18,
+    0x63, 0x00, 0x01, 0x00, 0xB5, 0xB4, 0x69, 0x00, 0x03, 0x00, 0xB0, 0xB5, 0xBE, 0x14, 0x63, 0x00,
+    0xBA, 0x69, 0x00, 0xC0, 0x69, 0x00, 0x02, 0x00, 0x8B, 0x8F, 0x26, 0x67, 0x00, 0xCC, 0x69, 0x00,
+    0x0A, 0x00, 0xB1, 0xB2, 0xB4, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBF, 0xD2, 0x69, 0x00, 0xDC,
+    0x69, 0x00, 0xE2, 0x69, 0x00, 0x76, 0x66, 0x00, 0xEA, 0x69, 0x00, 0x0E, 0x66, 0x00, 0x08, 0x64,
+    0x00, 0xF2, 0x69, 0x00, 0x38, 0x65, 0x00, 0xF8, 0x69, 0x00, 0x06, 0x00, 0x80, 0x81, 0x82, 0x85,
+    0x88, 0x89, 0x04, 0x6A, 0x00, 0x0A, 0x6A, 0x00, 0x12, 0x6A, 0x00, 0x1C, 0x6A, 0x00, 0x22, 0x6A,
+    0x00, 0x28, 0x6A, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE, 0x2E, 0x6A, 0x00, 0x38, 0x6A, 0x00,
+    0x44, 0x6A, 0x00, 0x50, 0x6A, 0x00, 0x04, 0x00, 0x83, 0x8B, 0x8F, 0x91, 0x5A, 0x6A, 0x00, 0x64,
+    0x6A, 0x00, 0x6C, 0x6A, 0x00, 0x78, 0x6A, 0x00, 0x01, 0x00, 0xBA, 0x80, 0x6A, 0x00, 0x05, 0x00,
+    0xB1, 0xB3, 0xB4, 0xBE, 0xBF, 0xB8, 0x66, 0x00, 0x2E, 0x65, 0x00, 0x88, 0x6A, 0x00, 0xFA, 0x62,
+    0x00, 0x5A, 0x66, 0x00, 0x05, 0x00, 0x81, 0x82, 0x85, 0x87, 0x8D, 0x90, 0x6A, 0x00, 0x9A, 0x6A,
+    0x00, 0x18, 0x63, 0x00, 0x6C, 0x63, 0x00, 0xA0, 0x6A, 0x00, 0x01, 0x00, 0xB5, 0x10, 0x68, 0x00,
+    0x02, 0x00, 0x83, 0x8B, 0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0x01, 0x00, 0xB5, 0xA6, 0x6A, 0x00,
+    0x01, 0x00, 0x91, 0xA6, 0x6A, 0x00, 0x03, 0x00, 0xB3, 0xB4, 0xBC, 0xAC, 0x6A, 0x00, 0x26, 0x39,
+    0x00, 0xB4, 0x6A, 0x00, 0x03, 0x00, 0x81, 0x82, 0x89, 0xBA, 0x6A, 0x00, 0x26, 0x39, 0x00, 0x26,
+    0x39, 0x00, 0x02, 0x00, 0xB5, 0xBA, 0xBE, 0x47, 0x00, 0x26, 0x39, 0x00, 0x04, 0x00, 0x82, 0x8E,
+    0x8F, 0x91, 0x26, 0x39, 0x00, 0xBE, 0x47, 0x00, 0xBE, 0x6A, 0x00, 0xBE, 0x47, 0x00, 0x03, 0x00,
+    0xB4, 0xB7, 0xBD, 0xC6, 0x6A, 0x00, 0xFA, 0x62, 0x00, 0xCE, 0x6A, 0x00, 0x01, 0x00, 0x82, 0x12,
+    0x65, 0x00, 0x01, 0x00, 0xB0, 0xD4, 0x6A, 0x00, 0x01, 0x00, 0x80, 0xDA, 0x6A, 0x00, 0x05, 0x00,
+    0xB5, 0xB8, 0xBC, 0xBD, 0xBE, 0xE4, 0x6A, 0x00, 0x1C, 0x63, 0x00, 0x46, 0x63, 0x00, 0xEC, 0x6A,
+    0x00, 0xF6, 0x6A, 0x00, 0x06, 0x00, 0x80, 0x82, 0x83, 0x85, 0x8C, 0x91, 0xFE, 0x6A, 0x00, 0x42,
+    0x63, 0x00, 0x1C, 0x63, 0x00, 0x08, 0x6B, 0x00, 0x1C, 0x63, 0x00, 0xE4, 0x6A, 0x00, 0x04, 0x00,
+    0xB0, 0xB4, 0xBB, 0xBD, 0x10, 0x6B, 0x00, 0xFA, 0x62, 0x00, 0x16, 0x6B, 0x00, 0x20, 0x6B, 0x00,
+    0x01, 0x00, 0x80, 0x26, 0x6B, 0x00, 0x05, 0x00, 0xB2, 0xB6, 0xBB, 0xBD, 0xBE, 0x2A, 0x6B, 0x00,
+    0x30, 0x6B, 0x00, 0x38, 0x6B, 0x00, 0x3E, 0x6B, 0x00, 0x44, 0x6B, 0x00, 0x03, 0x00, 0x80, 0x83,
+    0x8B, 0x4E, 0x6B, 0x00, 0x54, 0x6B, 0x00, 0x8E, 0x63, 0x00, 0x02, 0x00, 0xB2, 0xB3, 0x5E, 0x6B,
+    0x00, 0x6C, 0x63, 0x00, 0x02, 0x00, 0x81, 0x85, 0x68, 0x6B, 0x00, 0xFA, 0x62, 0x00, 0x03, 0x00,
+    0xB3, 0xB4, 0xB5, 0x42, 0x63, 0x00, 0x70, 0x6B, 0x00, 0x26, 0x39, 0x00, 0x02, 0x00, 0x80, 0x91,
+    0x24, 0x65, 0x00, 0x26, 0x39, 0x00, 0x07, 0x00, 0xB0, 0xB2, 0xB4, 0xB5, 0xB7, 0xB8, 0xBE, 0x76,
+    0x6B, 0x00, 0x80, 0x6B, 0x00, 0x12, 0x65, 0x00, 0x14, 0x63, 0x00, 0x86, 0x6B, 0x00, 0x8C, 0x6B,
+    0x00, 0x92, 0x6B, 0x00, 0x04, 0x00, 0x80, 0x83, 0x8F, 0x91, 0x9C, 0x6B, 0x00, 0xA2, 0x6B, 0x00,
+    0x14, 0x63, 0x00, 0x14, 0x63, 0x00, 0x04, 0x00, 0xB3, 0xB4, 0xBC, 0xBE, 0x60, 0x66, 0x00, 0xFA,
+    0x62, 0x00, 0xFA, 0x62, 0x00, 0xFA, 0x62, 0x00, 0x01, 0x00, 0x81, 0xAC, 0x6B, 0x00, 0x04, 0x00,
+    0xB0, 0xB7, 0xB8, 0xBE, 0xB6, 0x6B, 0x00, 0xFA, 0x62, 0x00, 0x1C, 0x63, 0x00, 0xB0, 0x67, 0x00,
+    0x03, 0x00, 0x80, 0x81, 0x83, 0xBE, 0x6B, 0x00, 0xC6, 0x6B, 0x00, 0x1C, 0x63, 0x00, 0x02, 0x00,
+    0xB0, 0xB5, 0x1C, 0x63, 0x00, 0xD0, 0x6B, 0x00, 0x05, 0x00, 0x83, 0x8B, 0x8E, 0x8F, 0x91, 0x1C,
+    0x63, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x14, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x02, 0x00,
+    0xB8, 0xBE, 0xD8, 0x6B, 0x00, 0xDE, 0x6B, 0x00, 0x04, 0x00, 0x83, 0x87, 0x8B, 0x8C, 0xE4, 0x6B,
+    0x00, 0x42, 0x63, 0x00, 0xEA, 0x6B, 0x00, 0xF0, 0x6B, 0x00, 0x02, 0x00, 0xB0, 0xB4, 0x14, 0x63,
+    0x00, 0x38, 0x65, 0x00, 0x04, 0x00, 0x80, 0x81, 0x88, 0x8D, 0xB0, 0x67, 0x00, 0xAC, 0x63, 0x00,
+    0x66, 0x67, 0x00, 0x1C, 0x63, 0x00, 0x0A, 0x00, 0xB1, 0xB3, 0xB4, 0xB6, 0xB8, 0xBA, 0xBB, 0xBC,
+    0xBD, 0xBF, 0xF6, 0x6B, 0x00, 0xFE, 0x6B, 0x00, 0x08, 0x6C, 0x00, 0x10, 0x6C, 0x00, 0x42, 0x63,
+    0x00, 0x64, 0x69, 0x00, 0x14, 0x6C, 0x00, 0x42, 0x63, 0x00, 0x22, 0x6C, 0x00, 0x30, 0x6C, 0x00,
+    0x05, 0x00, 0x80, 0x81, 0x82, 0x87, 0x89, 0x3C, 0x6C, 0x00, 0x42, 0x6C, 0x00, 0x4E, 0x6C, 0x00,
+    0x10, 0x6C, 0x00, 0x10, 0x6C, 0x00, 0x06, 0x00, 0xB0, 0xB5, 0xB8, 0xBB, 0xBD, 0xBE, 0x58, 0x6C,
+    0x00, 0x26, 0x39, 0x00, 0x5E, 0x6C, 0x00, 0x64, 0x6C, 0x00, 0xFE, 0x68, 0x00, 0x26, 0x39, 0x00,
+    0x03, 0x00, 0x81, 0x82, 0x91, 0x70, 0x6C, 0x00, 0xFE, 0x68, 0x00, 0x26, 0x39, 0x00, 0x05, 0x00,
+    0xB0, 0xB2, 0xB5, 0xB8, 0xBE, 0x74, 0x6C, 0x00, 0x7C, 0x6C, 0x00, 0x88, 0x6C, 0x00, 0x98, 0x6C,
+    0x00, 0xA0, 0x6C, 0x00, 0x06, 0x00, 0x81, 0x83, 0x8B, 0x8E, 0x8F, 0x91, 0xAC, 0x6C, 0x00, 0xB2,
+    0x6C, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0xBA, 0x6C, 0x00, 0x08, 0x00,
+    0xB0, 0xB1, 0xB3, 0xBA, 0xBB, 0xBC, 0xBE, 0xBF, 0xC2, 0x6C, 0x00, 0x9A, 0x64, 0x00, 0x1C, 0x63,
+    0x00, 0xC6, 0x6C, 0x00, 0xD2, 0x6C, 0x00, 0xDE, 0x6C, 0x00, 0x14, 0x63, 0x00, 0xE2, 0x6C, 0x00,
+    0x02, 0x00, 0x82, 0x87, 0xEE, 0x6C, 0x00, 0x14, 0x64, 0x00, 0x05, 0x00, 0xB0, 0xB2, 0xB5, 0xB8,
+    0xBE, 0x1C, 0x63, 0x00, 0xFA, 0x6C, 0x00, 0x04, 0x6D, 0x00, 0x1C, 0x63, 0x00, 0x0A, 0x6D, 0x00,
+    0x06, 0x00, 0x80, 0x83, 0x8B, 0x8C, 0x8E, 0x8F, 0x12, 0x6D, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63,
+    0x00, 0xFA, 0x64, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x03, 0x00, 0xB1, 0xB7, 0xBA, 0x1A,
+    0x6D, 0x00, 0xAC, 0x63, 0x00, 0x22, 0x6D, 0x00, 0x02, 0x00, 0xB8, 0xBB, 0x28, 0x6D, 0x00, 0xFA,
+    0x62, 0x00, 0x01, 0x00, 0x80, 0x2E, 0x6D, 0x00, 0x04, 0x00, 0xB0, 0xB2, 0xBB, 0xBE, 0x34, 0x6D,
+    0x00, 0x3A, 0x6D, 0x00, 0x40, 0x6D, 0x00, 0x46, 0x6D, 0x00, 0x02, 0x00, 0x80, 0x83, 0x4C, 0x6D,
+    0x00, 0x56, 0x6D, 0x00, 0x01, 0x00, 0xB2, 0x26, 0x39, 0x00, 0x01, 0x00, 0xBB, 0x1C, 0x63, 0x00,
+    0x01, 0x00, 0xB3, 0xFA, 0x62, 0x00, 0x01, 0x00, 0xB7, 0xFA, 0x62, 0x00, 0x02, 0x00, 0xB1, 0xB7,
+    0x5C, 0x6D, 0x00, 0x18, 0x63, 0x00, 0x01, 0x00, 0x82, 0x66, 0x6D, 0x00, 0x03, 0x00, 0xB0, 0xB8,
+    0xBB, 0x26, 0x39, 0x00, 0x42, 0x63, 0x00, 0xC8, 0x67, 0x00, 0x01, 0x00, 0x83, 0x42, 0x63, 0x00,
+    0x05, 0x00, 0xB0, 0xB5, 0xB8, 0xBB, 0xBE, 0x6C, 0x6D, 0x00, 0x76, 0x6D, 0x00, 0x7C, 0x6D, 0x00,
+    0x88, 0x6D, 0x00, 0xF0, 0x66, 0x00, 0x03, 0x00, 0x83, 0x8C, 0x8F, 0x20, 0x65, 0x00, 0x34, 0x49,
+    0x00, 0xC8, 0x67, 0x00, 0x05, 0x00, 0xB2, 0xB4, 0xBA, 0xBE, 0xBF, 0xBC, 0x3B, 0x00, 0x66, 0x67,
+    0x00, 0x8C, 0x6D, 0x00, 0xD4, 0x65, 0x00, 0x66, 0x67, 0x00, 0x01, 0x00, 0x81, 0x92, 0x6D, 0x00,
+    0x02, 0x00, 0xB0, 0xB5, 0x26, 0x39, 0x00, 0x9A, 0x6D, 0x00, 0x01, 0x00, 0x91, 0x42, 0x63, 0x00,
+    0x01, 0x00, 0xBE, 0x18, 0x63, 0x00, 0x01, 0x00, 0x80, 0xA2, 0x6D, 0x00, 0x02, 0x00, 0xB0, 0xBE,
+    0x14, 0x63, 0x00, 0x10, 0x68, 0x00, 0x01, 0x00, 0xBE, 0x20, 0x65, 0x00, 0x01, 0x00, 0xB1, 0xB0,
+    0x67, 0x00, 0x02, 0x00, 0x82, 0x83, 0xA8, 0x6D, 0x00, 0xAC, 0x6D, 0x00, 0x01, 0x00, 0xB2, 0xBC,
+    0x3B, 0x00, 0x01, 0x00, 0x81, 0xD4, 0x65, 0x00, 0x0E, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5,
+    0xB6, 0xB7, 0xB8, 0xBA, 0xBC, 0xBD, 0xBE, 0xBF, 0xAC, 0x63, 0x00, 0xAC, 0x63, 0x00, 0xB4, 0x6D,
+    0x00, 0x04, 0x64, 0x00, 0xBA, 0x6D, 0x00, 0xC0, 0x6D, 0x00, 0x76, 0x66, 0x00, 0x66, 0x67, 0x00,
+    0xCA, 0x6D, 0x00, 0xD0, 0x6D, 0x00, 0xD6, 0x6D, 0x00, 0xDC, 0x6D, 0x00, 0xE8, 0x6D, 0x00, 0xAC,
+    0x63, 0x00, 0x09, 0x00, 0x80, 0x81, 0x82, 0x83, 0x85, 0x87, 0x88, 0x8E, 0x8F, 0xEE, 0x6D, 0x00,
+    0xF4, 0x6D, 0x00, 0x46, 0x67, 0x00, 0xAC, 0x63, 0x00, 0xFC, 0x6D, 0x00, 0x04, 0x6E, 0x00, 0x66,
+    0x67, 0x00, 0xCA, 0x6D, 0x00, 0xAC, 0x63, 0x00, 0x06, 0x00, 0xB0, 0xB5, 0xB8, 0xBA, 0xBB, 0xBE,
+    0x0A, 0x6E, 0x00, 0x18, 0x6E, 0x00, 0x1C, 0x63, 0x00, 0xC2, 0x6C, 0x00, 0x20, 0x6E, 0x00, 0x26,
+    0x6E, 0x00, 0x04, 0x00, 0x80, 0x83, 0x8C, 0x91, 0x1C, 0x63, 0x00, 0x2E, 0x6E, 0x00, 0x1C, 0x63,
+    0x00, 0x18, 0x6E, 0x00, 0x03, 0x00, 0xB0, 0xBB, 0xBD, 0x14, 0x63, 0x00, 0x36, 0x6E, 0x00, 0x3C,
+    0x6E, 0x00, 0x03, 0x00, 0xB2, 0xB5, 0xBE, 0x10, 0x6C, 0x00, 0x46, 0x6E, 0x00, 0x4C, 0x6E, 0x00,
+    0x03, 0x00, 0xB1, 0xB5, 0xBE, 0x60, 0x66, 0x00, 0x32, 0x65, 0x00, 0xCE, 0x65, 0x00, 0x03, 0x00,
+    0xB9, 0xBD, 0xBE, 0x52, 0x6E, 0x00, 0xD0, 0x6D, 0x00, 0x58, 0x6E, 0x00, 0x04, 0x00, 0x81, 0x82,
+    0x83, 0x87, 0xBC, 0x3B, 0x00, 0x5E, 0x6E, 0x00, 0x64, 0x6E, 0x00, 0xBC, 0x3B, 0x00, 0x01, 0x00,
+    0xBE, 0x6A, 0x6E, 0x00, 0x02, 0x00, 0xB0, 0xBE, 0xFE, 0x63, 0x00, 0x72, 0x6E, 0x00, 0x01, 0x00,
+    0x8E, 0xFE, 0x63, 0x00, 0x01, 0x00, 0xBD, 0x14, 0x63, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE,
+    0x7C, 0x6E, 0x00, 0x26, 0x39, 0x00, 0x10, 0x68, 0x00, 0x26, 0x39, 0x00, 0x03, 0x00, 0x83, 0x8B,
+    0x91, 0x26, 0x39, 0x00, 0x10, 0x68, 0x00, 0x26, 0x39, 0x00, 0x0E, 0x00, 0xB1, 0xB2, 0xB3, 0xB4,
+    0xB5, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x8A, 0x6E, 0x00, 0x90, 0x6E, 0x00,
+    0xA0, 0x68, 0x00, 0xB0, 0x63, 0x00, 0xBE, 0x47, 0x00, 0xD4, 0x65, 0x00, 0xBE, 0x47, 0x00, 0xA0,
+    0x66, 0x00, 0x98, 0x6E, 0x00, 0xA2, 0x6E, 0x00, 0xAA, 0x6E, 0x00, 0xB6, 0x6E, 0x00, 0xBE, 0x6E,
+    0x00, 0xCA, 0x6E, 0x00, 0x07, 0x00, 0x80, 0x81, 0x82, 0x85, 0x88, 0x8D, 0x8E, 0xD4, 0x6E, 0x00,
+    0xDE, 0x6E, 0x00, 0xE6, 0x6E, 0x00, 0xBE, 0x47, 0x00, 0xF0, 0x6E, 0x00, 0xBE, 0x47, 0x00, 0xBE,
+    0x47, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE, 0xF8, 0x6E, 0x00, 0x04, 0x6F, 0x00, 0x46, 0x6E,
+    0x00, 0x0E, 0x6F, 0x00, 0x03, 0x00, 0x83, 0x8E, 0x8F, 0x1C, 0x63, 0x00, 0x42, 0x63, 0x00, 0x46,
+    0x68, 0x00, 0x08, 0x00, 0xB1, 0xB2, 0xB3, 0xB5, 0xB7, 0xBA, 0xBC, 0xBF, 0x16, 0x6F, 0x00, 0x20,
+    0x6F, 0x00, 0x26, 0x6B, 0x00, 0xBC, 0x3B, 0x00, 0x28, 0x6F, 0x00, 0xAA, 0x64, 0x00, 0x2C, 0x6F,
+    0x00, 0x36, 0x6F, 0x00, 0x04, 0x00, 0x80, 0x82, 0x87, 0x91, 0x3E, 0x6F, 0x00, 0x44, 0x6F, 0x00,
+    0x4A, 0x6F, 0x00, 0xBC, 0x3B, 0x00, 0x03, 0x00, 0xB3, 0xB7, 0xBC, 0xBA, 0x6A, 0x00, 0xFA, 0x62,
+    0x00, 0x50, 0x6F, 0x00, 0x02, 0x00, 0x81, 0x89, 0xBA, 0x6A, 0x00, 0x26, 0x39, 0x00, 0x00, 0x01,
+    0x47, 0x00, 0x02, 0x00, 0xB5, 0xB8, 0xBE, 0x47, 0x00, 0xBE, 0x47, 0x00, 0x02, 0x00, 0x8E, 0x8F,
+    0xBE, 0x47, 0x00, 0xBC, 0x3B, 0x00, 0x09, 0x00, 0xB1, 0xB2, 0xB3, 0xB4, 0xB7, 0xBC, 0xBD, 0xBE,
+    0xBF, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00, 0x5A, 0x6F, 0x00, 0x62, 0x6F, 0x00, 0x68, 0x6F, 0x00,
+    0x28, 0x6A, 0x00, 0x6E, 0x6F, 0x00, 0xAC, 0x63, 0x00, 0x42, 0x63, 0x00, 0x05, 0x00, 0x81, 0x82,
+    0x84, 0x85, 0x86, 0x74, 0x6F, 0x00, 0x7E, 0x6F, 0x00, 0x42, 0x63, 0x00, 0x24, 0x65, 0x00, 0x3C,
+    0x63, 0x00, 0x01, 0x00, 0x80, 0x24, 0x65, 0x00, 0x05, 0x00, 0xB0, 0xB5, 0xB7, 0xB8, 0xBE, 0xE4,
+    0x6B, 0x00, 0xB0, 0x67, 0x00, 0x80, 0x69, 0x00, 0x1C, 0x63, 0x00, 0xB0, 0x67, 0x00, 0x06, 0x00,
+    0x80, 0x81, 0x83, 0x85, 0x8B, 0x91, 0x10, 0x6C, 0x00, 0xC2, 0x6C, 0x00, 0x1C, 0x63, 0x00, 0x94,
+    0x63, 0x00, 0x26, 0x39, 0x00, 0xB0, 0x67, 0x00, 0x04, 0x00, 0xB4, 0xB5, 0xBB, 0xBD, 0xFA, 0x62,
+    0x00, 0x14, 0x63, 0x00, 0x84, 0x6F, 0x00, 0x8C, 0x6F, 0x00, 0x01, 0x00, 0x80, 0x94, 0x6F, 0x00,
+    0x04, 0x00, 0xB2, 0xB5, 0xB6, 0xB8, 0x1C, 0x63, 0x00, 0x9E, 0x6F, 0x00, 0x10, 0x6C, 0x00, 0xA4,
+    0x6F, 0x00, 0x02, 0x00, 0x80, 0x8C, 0x18, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x07, 0x00, 0xB2, 0xB3,
+    0xB4, 0xB7, 0xBD, 0xBE, 0xBF, 0xAA, 0x6F, 0x00, 0xFA, 0x62, 0x00, 0xB0, 0x6F, 0x00, 0x28, 0x6A,
+    0x00, 0xB8, 0x6F, 0x00, 0xD4, 0x65, 0x00, 0xBE, 0x6F, 0x00, 0x01, 0x00, 0x80, 0xFA, 0x62, 0x00,
+    0x01, 0x00, 0xB4, 0xC2, 0x6C, 0x00, 0x05, 0x00, 0xB2, 0xB3, 0xB4, 0xBD, 0xBE, 0xD4, 0x65, 0x00,
+    0xC4, 0x6F, 0x00, 0xD6, 0x67, 0x00, 0x86, 0x64, 0x00, 0xCA, 0x6F, 0x00, 0x01, 0x00, 0x81, 0xAC,
+    0x63, 0x00, 0x04, 0x00, 0xB0, 0xB2, 0xBB, 0xBE, 0xD2, 0x6F, 0x00, 0xDA, 0x6F, 0x00, 0xE0, 0x6F,
+    0x00, 0x14, 0x63, 0x00, 0x03, 0x00, 0x80, 0x81, 0x83, 0x2A, 0x6B, 0x00, 0xE6, 0x6F, 0x00, 0x14,
+    0x63, 0x00, 0x04, 0x00, 0xB0, 0xBB, 0xBE, 0xBF, 0xF0, 0x6F, 0x00, 0xFA, 0x6F, 0x00, 0x00, 0x70,
+    0x00, 0xAC, 0x63, 0x00, 0x02, 0x00, 0x83, 0x8C, 0x06, 0x70, 0x00, 0x0C, 0x70, 0x00, 0x05, 0x00,
+    0xB0, 0xB5, 0xB8, 0xBE, 0xBF, 0x26, 0x39, 0x00, 0x14, 0x70, 0x00, 0x14, 0x63, 0x00, 0x28, 0x65,
+    0x00, 0x64, 0x69, 0x00, 0x02, 0x00, 0x80, 0x87, 0x24, 0x65, 0x00, 0x1A, 0x70, 0x00, 0x03, 0x00,
+    0xB4, 0xB6, 0xBE, 0xAC, 0x63, 0x00, 0xBE, 0x47, 0x00, 0x22, 0x70, 0x00, 0x03, 0x00, 0x81, 0x84,
+    0x8A, 0x2C, 0x70, 0x00, 0xBE, 0x47, 0x00, 0xBE, 0x47, 0x00, 0x09, 0x00, 0xB1, 0xB2, 0xB3, 0xB4,
+    0xB7, 0xBA, 0xBB, 0xBD, 0xBF, 0x08, 0x6B, 0x00, 0x3E, 0x65, 0x00, 0x42, 0x63, 0x00, 0x38, 0x70,
+    0x00, 0x40, 0x70, 0x00, 0x48, 0x70, 0x00, 0x4E, 0x70, 0x00, 0x54, 0x70, 0x00, 0xD0, 0x6D, 0x00,
+    0x06, 0x00, 0x80, 0x81, 0x82, 0x83, 0x85, 0x88, 0x5C, 0x70, 0x00, 0x68, 0x70, 0x00, 0x6E, 0x70,
+    0x00, 0xAE, 0x68, 0x00, 0x94, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x04, 0x00, 0xB0, 0xBB, 0xBD, 0xBE,
+    0x58, 0x6C, 0x00, 0x9C, 0x6B, 0x00, 0x2E, 0x65, 0x00, 0x78, 0x70, 0x00, 0x05, 0x00, 0xB0, 0xB2,
+    0xB6, 0xB8, 0xBE, 0x7E, 0x70, 0x00, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00, 0x84, 0x70, 0x00, 0x8A,
+    0x70, 0x00, 0x01, 0x00, 0x80, 0xBE, 0x47, 0x00, 0x09, 0x00, 0xB0, 0xB1, 0xB4, 0xBA, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0x90, 0x70, 0x00, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00, 0x96, 0x70, 0x00, 0xA2,
+    0x70, 0x00, 0xAC, 0x70, 0x00, 0x20, 0x63, 0x00, 0xB6, 0x70, 0x00, 0xBC, 0x70, 0x00, 0x03, 0x00,
+    0x81, 0x82, 0x8C, 0xFE, 0x68, 0x00, 0xC2, 0x70, 0x00, 0xCA, 0x64, 0x00, 0x03, 0x00, 0xB0, 0xB2,
+    0xBC, 0xCE, 0x70, 0x00, 0xD4, 0x70, 0x00, 0x42, 0x63, 0x00, 0x03, 0x00, 0x80, 0x83, 0x8C, 0xDE,
+    0x70, 0x00, 0xE6, 0x70, 0x00, 0xEC, 0x70, 0x00, 0x01, 0x00, 0xBF, 0x2E, 0x65, 0x00, 0x01, 0x00,
+    0xBB, 0xF2, 0x70, 0x00, 0x03, 0x00, 0xB0, 0xBB, 0xBE, 0xFA, 0x70, 0x00, 0x04, 0x71, 0x00, 0x0A,
+    0x71, 0x00, 0x02, 0x00, 0x80, 0x83, 0x12, 0x71, 0x00, 0x1C, 0x63, 0x00, 0x01, 0x00, 0xBB, 0x1C,
+    0x71, 0x00, 0x01, 0x00, 0x82, 0x42, 0x63, 0x00, 0x02, 0x00, 0xBB, 0xBD, 0x56, 0x66, 0x00, 0xFA,
+    0x62, 0x00, 0x01, 0x00, 0x82, 0x26, 0x71, 0x00, 0x01, 0x00, 0xB4, 0xFA, 0x62, 0x00, 0x01, 0x00,
+    0xB2, 0x80, 0x69, 0x00, 0x01, 0x00, 0x8C, 0x42, 0x63, 0x00, 0x02, 0x00, 0x81, 0x82, 0x24, 0x65,
+    0x00, 0x3E, 0x65, 0x00, 0x04, 0x00, 0xB1, 0xBA, 0xBC, 0xBD, 0x42, 0x63, 0x00, 0x2E, 0x71, 0x00,
+    0x34, 0x71, 0x00, 0x42, 0x63, 0x00, 0x02, 0x00, 0x84, 0x88, 0x80, 0x69, 0x00, 0x42, 0x63, 0x00,
+    0x01, 0x00, 0xBC, 0x42, 0x63, 0x00, 0x01, 0x00, 0x81, 0x3E, 0x71, 0x00, 0x0A, 0x00, 0xB1, 0xB2,
+    0xB4, 0xB5, 0xB7, 0xB9, 0xBB, 0xBC, 0xBD, 0xBF, 0x42, 0x71, 0x00, 0xBE, 0x47, 0x00, 0x4C, 0x71,
+    0x00, 0xBE, 0x47, 0x00, 0x58, 0x71, 0x00, 0xBE, 0x47, 0x00, 0x5E, 0x71, 0x00, 0xBE, 0x47, 0x00,
+    0xBE, 0x47, 0x00, 0x6C, 0x71, 0x00, 0x07, 0x00, 0x80, 0x81, 0x82, 0x85, 0x88, 0x8E, 0x91, 0x76,
+    0x71, 0x00, 0x7C, 0x71, 0x00, 0x84, 0x71, 0x00, 0xBE, 0x47, 0x00, 0x8C, 0x71, 0x00, 0xBE, 0x47,
+    0x00, 0xBE, 0x47, 0x00, 0x03, 0x00, 0xB0, 0xB8, 0xBE, 0x92, 0x71, 0x00, 0x1C, 0x63, 0x00, 0x9C,
+    0x71, 0x00, 0x01, 0x00, 0x83, 0x1C, 0x63, 0x00, 0x03, 0x00, 0xB0, 0xB3, 0xB4, 0x26, 0x39, 0x00,
+    0xA0, 0x68, 0x00, 0x12, 0x65, 0x00, 0x01, 0x00, 0x81, 0xA2, 0x71, 0x00, 0x03, 0x00, 0xB2, 0xBE,
+    0xBF, 0xBE, 0x47, 0x00, 0xAC, 0x71, 0x00, 0xA0, 0x68, 0x00, 0x02, 0x00, 0x81, 0x82, 0xEA, 0x66,
+    0x00, 0xBE, 0x47, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE, 0xB4, 0x71, 0x00, 0xBE, 0x71, 0x00,
+    0xC8, 0x71, 0x00, 0xD6, 0x71, 0x00, 0x06, 0x00, 0x83, 0x8B, 0x8C, 0x8E, 0x8F, 0x91, 0xE4, 0x71,
+    0x00, 0x14, 0x63, 0x00, 0x26, 0x39, 0x00, 0xEA, 0x71, 0x00, 0xF2, 0x71, 0x00, 0x0A, 0x68, 0x00,
+    0x02, 0x00, 0xB8, 0xBE, 0x00, 0x72, 0x00, 0x06, 0x72, 0x00, 0x01, 0x00, 0x8F, 0x00, 0x72, 0x00,
+    0x08, 0x00, 0xB1, 0xB2, 0xB4, 0xB7, 0xBB, 0xBC, 0xBD, 0xBF, 0x0C, 0x72, 0x00, 0x12, 0x72, 0x00,
+    0x1A, 0x72, 0x00, 0xBE, 0x47, 0x00, 0x22, 0x72, 0x00, 0x28, 0x72, 0x00, 0x2E, 0x72, 0x00, 0x0E,
+    0x66, 0x00, 0x06, 0x00, 0x80, 0x81, 0x82, 0x84, 0x85, 0x88, 0x34, 0x72, 0x00, 0x3E, 0x72, 0x00,
+    0xFE, 0x67, 0x00, 0x3E, 0x65, 0x00, 0x46, 0x72, 0x00, 0xBE, 0x47, 0x00, 0x03, 0x00, 0xB5, 0xB8,
+    0xBE, 0x4C, 0x72, 0x00, 0x56, 0x72, 0x00, 0x60, 0x72, 0x00, 0x02, 0x00, 0x83, 0x8F, 0xDE, 0x6B,
+    0x00, 0x6A, 0x72, 0x00, 0x08, 0x00, 0xB0, 0xB2, 0xB3, 0xB4, 0xB8, 0xBA, 0xBC, 0xBE, 0x70, 0x72,
+    0x00, 0x80, 0x69, 0x00, 0x2E, 0x65, 0x00, 0x80, 0x69, 0x00, 0x76, 0x72, 0x00, 0x7C, 0x72, 0x00,
+    0x2E, 0x65, 0x00, 0x14, 0x63, 0x00, 0x02, 0x00, 0x82, 0x83, 0x82, 0x72, 0x00, 0x14, 0x63, 0x00,
+    0x02, 0x00, 0xB0, 0xBE, 0x8C, 0x72, 0x00, 0x92, 0x72, 0x00, 0x06, 0x00, 0xB2, 0xB5, 0xB9, 0xBB,
+    0xBC, 0xBF, 0x2E, 0x6D, 0x00, 0xBC, 0x3B, 0x00, 0xBE, 0x47, 0x00, 0x9C, 0x72, 0x00, 0xBC, 0x3B,
+    0x00, 0xA2, 0x72, 0x00, 0x06, 0x00, 0x80, 0x81, 0x82, 0x87, 0x8E, 0x91, 0xAC, 0x72, 0x00, 0xB4,
+    0x72, 0x00, 0xBE, 0x72, 0x00, 0xC6, 0x72, 0x00, 0xCC, 0x72, 0x00, 0xBC, 0x3B, 0x00, 0x00, 0x01,
+    0x26, 0x00, 0x09, 0x00, 0xB1, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xBA, 0xBC, 0xBD, 0xD2, 0x72, 0x00,
+    0xDC, 0x72, 0x00, 0xE6, 0x72, 0x00, 0xBE, 0x47, 0x00, 0x76, 0x66, 0x00, 0x2A, 0x6B, 0x00, 0xEC,
+    0x72, 0x00, 0xF4, 0x72, 0x00, 0xCE, 0x6A, 0x00, 0x06, 0x00, 0x81, 0x82, 0x83, 0x84, 0x85, 0x8F,
+    0xFE, 0x72, 0x00, 0x04, 0x73, 0x00, 0x0A, 0x73, 0x00, 0x3E, 0x65, 0x00, 0xD6, 0x67, 0x00, 0xBE,
+    0x47, 0x00, 0x03, 0x00, 0xB5, 0xB8, 0xBE, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00,
+    0x03, 0x00, 0xB0, 0xBB, 0xBE, 0x12, 0x73, 0x00, 0x42, 0x63, 0x00, 0x20, 0x65, 0x00, 0x08, 0x00,
+    0xB2, 0xB3, 0xB4, 0xB7, 0xBA, 0xBC, 0xBD, 0xBE, 0x18, 0x73, 0x00, 0x22, 0x73, 0x00, 0x28, 0x73,
+    0x00, 0x2E, 0x73, 0x00, 0x5A, 0x66, 0x00, 0x38, 0x73, 0x00, 0xBE, 0x47, 0x00, 0x3E, 0x73, 0x00,
+    0x03, 0x00, 0x81, 0x82, 0x85, 0x48, 0x73, 0x00, 0x4E, 0x73, 0x00, 0x1A, 0x72, 0x00, 0x01, 0x00,
+    0xBE, 0x1C, 0x63, 0x00, 0x08, 0x00, 0xB0, 0xB2, 0xB3, 0xB5, 0xBA, 0xBC, 0xBE, 0xBF, 0xA6, 0x6A,
+    0x00, 0x58, 0x73, 0x00, 0x62, 0x73, 0x00, 0xB8, 0x66, 0x00, 0x32, 0x65, 0x00, 0x6C, 0x73, 0x00,
+    0xDE, 0x6B, 0x00, 0xA0, 0x68, 0x00, 0x04, 0x00, 0x81, 0x82, 0x83, 0x85, 0x72, 0x73, 0x00, 0x32,
+    0x65, 0x00, 0x64, 0x6E, 0x00, 0x78, 0x73, 0x00, 0x02, 0x00, 0xB2, 0xBB, 0xFA, 0x62, 0x00, 0x24,
+    0x65, 0x00, 0x02, 0x00, 0x8C, 0x8E, 0x42, 0x63, 0x00, 0x20, 0x65, 0x00, 0x01, 0x00, 0xB8, 0x82,
+    0x73, 0x00, 0x08, 0x00, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xBA, 0xBF, 0x88, 0x73, 0x00, 0x92,
+    0x73, 0x00, 0x98, 0x73, 0x00, 0xB0, 0x63, 0x00, 0x38, 0x73, 0x00, 0x9E, 0x73, 0x00, 0xA4, 0x73,
+    0x00, 0xAA, 0x73, 0x00, 0x05, 0x00, 0x80, 0x81, 0x82, 0x88, 0x91, 0xB0, 0x73, 0x00, 0xBA, 0x73,
+    0x00, 0xC0, 0x73, 0x00, 0xA0, 0x68, 0x00, 0x38, 0x73, 0x00, 0x01, 0x00, 0xB1, 0x2E, 0x65, 0x00,
+    0x0A, 0x00, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xBA, 0xBD, 0xBE, 0xBF, 0xB0, 0x63, 0x00, 0x18,
+    0x63, 0x00, 0x2E, 0x65, 0x00, 0xCA, 0x73, 0x00, 0xBE, 0x47, 0x00, 0xD0, 0x73, 0x00, 0xB0, 0x63,
+    0x00, 0xBE, 0x47, 0x00, 0xD6, 0x73, 0x00, 0xDC, 0x73, 0x00, 0x04, 0x00, 0x81, 0x82, 0x8E, 0x91,
+    0xE2, 0x73, 0x00, 0xEA, 0x73, 0x00, 0xBE, 0x47, 0x00, 0xBE, 0x47, 0x00, 0x04, 0x00, 0xB5, 0xB6,
+    0xB9, 0xBC, 0xBE, 0x47, 0x00, 0xBE, 0x47, 0x00, 0xBE, 0x47, 0x00, 0xBE, 0x47, 0x00, 0x01, 0x00,
+    0x85, 0xA0, 0x66, 0x00, 0x00, 0x01, 0x38, 0x00, 0x07, 0x00, 0xB4, 0xB5, 0xB8, 0xBA, 0xBC, 0xBD,
+    0xBE, 0x26, 0x39, 0x00, 0xBC, 0x3B, 0x00, 0xBC, 0x3B, 0x00, 0x26, 0x39, 0x00, 0x26, 0x39, 0x00,
+    0x26, 0x39, 0x00, 0xBC, 0x3B, 0x00, 0x08, 0x00, 0x81, 0x82, 0x86, 0x87, 0x89, 0x8E, 0x8F, 0x91,
+    0xF0, 0x73, 0x00, 0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0xFA, 0x73, 0x00, 0xBC,
+    0x3B, 0x00, 0xBC, 0x3B, 0x00, 0xBC, 0x3B, 0x00, 0x01, 0x00, 0xB6, 0xBE, 0x47, 0x00, 0x02, 0x00,
+    0x81, 0x82, 0x04, 0x74, 0x00, 0x36, 0x63, 0x00, 0x03, 0x00, 0xB2, 0xB4, 0xBC, 0x0A, 0x74, 0x00,
+    0x26, 0x39, 0x00, 0xBC, 0x3B, 0x00, 0x02, 0x00, 0x80, 0x85, 0x4C, 0x6D, 0x00, 0xBC, 0x3B, 0x00,
+    0x04, 0x00, 0xB4, 0xB7, 0xBA, 0xBD, 0x20, 0x63, 0x00, 0x14, 0x74, 0x00, 0x5A, 0x66, 0x00, 0xBE,
+    0x47, 0x00, 0x02, 0x00, 0x81, 0x85, 0x1A, 0x74, 0x00, 0xBE, 0x47, 0x00, 0x07, 0x00, 0xB2, 0xB3,
+    0xB4, 0xB7, 0xBA, 0xBB, 0xBD, 0x20, 0x74, 0x00, 0x26, 0x74, 0x00, 0x2E, 0x74, 0x00, 0x2A, 0x6B,
+    0x00, 0x38, 0x65, 0x00, 0x34, 0x74, 0x00, 0xCE, 0x6A, 0x00, 0x05, 0x00, 0x81, 0x82, 0x83, 0x84,
+    0x87, 0x3A, 0x74, 0x00, 0x44, 0x74, 0x00, 0xFA, 0x62, 0x00, 0xAC, 0x63, 0x00, 0x4E, 0x74, 0x00,
+    0x02, 0x00, 0xB8, 0xBB, 0x14, 0x63, 0x00, 0x56, 0x74, 0x00, 0x01, 0x00, 0xBB, 0xC8, 0x67, 0x00,
+    0x05, 0x00, 0xB0, 0xB4, 0xB5, 0xB6, 0xB7, 0x5E, 0x74, 0x00, 0x64, 0x74, 0x00, 0x6A, 0x74, 0x00,
+    0x70, 0x74, 0x00, 0x2A, 0x6B, 0x00, 0x03, 0x00, 0x81, 0x82, 0x87, 0x76, 0x74, 0x00, 0x80, 0x74,
+    0x00, 0xA0, 0x6A, 0x00, 0x04, 0x00, 0xB3, 0xB7, 0xBA, 0xBE, 0x86, 0x74, 0x00, 0x8C, 0x74, 0x00,
+    0x92, 0x74, 0x00, 0x98, 0x74, 0x00, 0x01, 0x00, 0x81, 0xA2, 0x74, 0x00, 0x01, 0x00, 0xBD, 0xBC,
+    0x3B, 0x00, 0x01, 0x00, 0xB5, 0xAC, 0x74, 0x00, 0x03, 0x00, 0xB0, 0xB5, 0xBE, 0x26, 0x67, 0x00,
+    0xB2, 0x74, 0x00, 0xBC, 0x74, 0x00, 0x03, 0x00, 0x83, 0x8B, 0x91, 0xC6, 0x74, 0x00, 0x26, 0x67,
+    0x00, 0xCC, 0x69, 0x00, 0x0A, 0x00, 0xB1, 0xB2, 0xB4, 0xB6, 0xB7, 0xB8, 0xBA, 0xBC, 0xBD, 0xBF,
+    0xD4, 0x65, 0x00, 0x64, 0x69, 0x00, 0xCC, 0x74, 0x00, 0x5A, 0x67, 0x00, 0xD4, 0x74, 0x00, 0xDE,
+    0x74, 0x00, 0xE4, 0x74, 0x00, 0x66, 0x67, 0x00, 0xBC, 0x3B, 0x00, 0xBC, 0x3B, 0x00, 0x04, 0x00,
+    0x80, 0x81, 0x82, 0x84, 0xF2, 0x65, 0x00, 0xEA, 0x74, 0x00, 0xF0, 0x74, 0x00, 0xBC, 0x3B, 0x00,
+    0x03, 0x00, 0xB0, 0xB8, 0xBE, 0x3E, 0x6F, 0x00, 0x26, 0x39, 0x00, 0xB0, 0x67, 0x00, 0x01, 0x00,
+    0x8B, 0x1C, 0x63, 0x00, 0x03, 0x00, 0xBA, 0xBD, 0xBE, 0xFA, 0x62, 0x00, 0xFA, 0x62, 0x00, 0xFA,
+    0x74, 0x00, 0x01, 0x00, 0x82, 0x00, 0x75, 0x00, 0x02, 0x00, 0x81, 0x82, 0x06, 0x75, 0x00, 0x10,
+    0x75, 0x00, 0x01, 0x00, 0xB8, 0xF0, 0x66, 0x00, 0x02, 0x00, 0xB0, 0xB8, 0x16, 0x75, 0x00, 0x1C,
+    0x75, 0x00, 0x01, 0x00, 0xB5, 0xC8, 0x67, 0x00, 0x01, 0x00, 0x91, 0xC8, 0x67, 0x00, 0x01, 0x00,
+    0xBC, 0x22, 0x75, 0x00, 0x01, 0x00, 0x81, 0xFA, 0x62, 0x00, 0x02, 0x00, 0x81, 0x8E, 0x26, 0x39,
+    0x00, 0x20, 0x65, 0x00, 0x02, 0x00, 0x80, 0x81, 0x18, 0x63, 0x00, 0x2A, 0x75, 0x00, 0x09, 0x00,
+    0xB1, 0xB2, 0xB3, 0xB6, 0xB7, 0xB8, 0xBA, 0xBC, 0xBF, 0x30, 0x75, 0x00, 0x04, 0x73, 0x00, 0x3A,
+    0x75, 0x00, 0x40, 0x75, 0x00, 0xD4, 0x65, 0x00, 0x46, 0x75, 0x00, 0x50, 0x75, 0x00, 0x56, 0x75,
+    0x00, 0xCA, 0x6D, 0x00, 0x0A, 0x00, 0x80, 0x81, 0x82, 0x84, 0x85, 0x87, 0x88, 0x89, 0x8D, 0x8F,
+    0x5C, 0x75, 0x00, 0xD4, 0x65, 0x00, 0x4E, 0x73, 0x00, 0x62, 0x75, 0x00, 0xD4, 0x65, 0x00, 0x26,
+    0x39, 0x00, 0xF8, 0x67, 0x00, 0x26, 0x39, 0x00, 0x12, 0x65, 0x00, 0xBC, 0x3B, 0x00, 0x04, 0x00,
+    0xB2, 0xB8, 0xBB, 0xBE, 0x24, 0x65, 0x00, 0x68, 0x75, 0x00, 0x56, 0x66, 0x00, 0xDE, 0x6B, 0x00,
+    0x06, 0x00, 0xB0, 0xB2, 0xB5, 0xB6, 0xB7, 0xBB, 0x6E, 0x75, 0x00, 0x24, 0x65, 0x00, 0x74, 0x75,
+    0x00, 0xFA, 0x62, 0x00, 0xC2, 0x6C, 0x00, 0x42, 0x63, 0x00, 0x03, 0x00, 0x80, 0x81, 0x86, 0x7E,
+    0x75, 0x00, 0x88, 0x75, 0x00, 0x42, 0x63, 0x00, 0x0C, 0x00, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6,
+    0xB7, 0xB8, 0xBA, 0xBC, 0xBE, 0xBF, 0xD4, 0x65, 0x00, 0x8E, 0x75, 0x00, 0xAC, 0x63, 0x00, 0x94,
+    0x75, 0x00, 0xA0, 0x75, 0x00, 0x76, 0x66, 0x00, 0xA8, 0x75, 0x00, 0xAC, 0x63, 0x00, 0x8C, 0x6D,
+    0x00, 0x56, 0x75, 0x00, 0xB2, 0x75, 0x00, 0x66, 0x67, 0x00, 0x09, 0x00, 0x80, 0x81, 0x82, 0x83,
+    0x84, 0x85, 0x88, 0x8F, 0x91, 0xBE, 0x75, 0x00, 0xC4, 0x75, 0x00, 0xCE, 0x75, 0x00, 0xBC, 0x3B,
+    0x00, 0x3E, 0x65, 0x00, 0xB0, 0x63, 0x00, 0xAC, 0x6C, 0x00, 0xAC, 0x63, 0x00, 0x2E, 0x65, 0x00,
+    0x01, 0x00, 0xBE, 0xDE, 0x6B, 0x00, 0x06, 0x00, 0xB1, 0xB5, 0xB9, 0xBA, 0xBB, 0xBD, 0x66, 0x67,
+    0x00, 0xD8, 0x75, 0x00, 0xBC, 0x3B, 0x00, 0xA0, 0x68, 0x00, 0xDE, 0x75, 0x00, 0xE4, 0x75, 0x00,
+    0x05, 0x00, 0x81, 0x83, 0x85, 0x86, 0x89, 0xEA, 0x75, 0x00, 0xF0, 0x66, 0x00, 0x18, 0x63, 0x00,
+    0xBC, 0x3B, 0x00, 0xBC, 0x3B, 0x00, 0x03, 0x00, 0xB2, 0xBB, 0xBE, 0xFA, 0x62, 0x00, 0xFA, 0x62,
+    0x00, 0xF4, 0x75, 0x00, 0x02, 0x00, 0x80, 0x81, 0xFA, 0x75, 0x00, 0x18, 0x63, 0x00, 0x01, 0x00,
+    0xBE, 0x00, 0x76, 0x00, 0x08, 0x00, 0xB1, 0xB2, 0xB4, 0xB5, 0xB7, 0xBA, 0xBB, 0xBC, 0x06, 0x76,
+    0x00, 0xA0, 0x68, 0x00, 0xD4, 0x74, 0x00, 0x3E, 0x65, 0x00, 0x0E, 0x76, 0x00, 0xF2, 0x67, 0x00,
+    0x18, 0x76, 0x00, 0x1E, 0x76, 0x00, 0x05, 0x00, 0x80, 0x81, 0x82, 0x84, 0x8D, 0x28, 0x76, 0x00,
+    0x32, 0x76, 0x00, 0xA6, 0x66, 0x00, 0x66, 0x67, 0x00, 0xAC, 0x63, 0x00, 0x03, 0x00, 0xB5, 0xB8,
+    0xBE, 0xB0, 0x67, 0x00, 0xB0, 0x67, 0x00, 0x1C, 0x63, 0x00, 0x08, 0x00, 0xB2, 0xB3, 0xBA, 0xBB,
+    0xBC, 0xBD, 0xBE, 0xBF, 0x80, 0x69, 0x00, 0x42, 0x63, 0x00, 0x3C, 0x76, 0x00, 0x42, 0x76, 0x00,
+    0x80, 0x69, 0x00, 0x42, 0x63, 0x00, 0x4A, 0x76, 0x00, 0x46, 0x63, 0x00, 0x04, 0x00, 0x82, 0x83,
+    0x84, 0x8A, 0x0E, 0x66, 0x00, 0x0E, 0x66, 0x00, 0x80, 0x69, 0x00, 0x50, 0x76, 0x00, 0x03, 0x00,
+    0xB2, 0xB8, 0xBC, 0x24, 0x65, 0x00, 0x54, 0x76, 0x00, 0x42, 0x63, 0x00, 0x01, 0x00, 0x80, 0x5A,
+    0x76, 0x00, 0x03, 0x00, 0x82, 0x85, 0x8E, 0x12, 0x65, 0x00, 0x18, 0x63, 0x00, 0xBC, 0x3B, 0x00,
+    0x01, 0x00, 0x82, 0xFA, 0x62, 0x00, 0x04, 0x00, 0xB5, 0xB8, 0xBA, 0xBE, 0xBE, 0x47, 0x00, 0xBE,
+    0x47, 0x00, 0x26, 0x39, 0x00, 0xBE, 0x47, 0x00, 0x06, 0x00, 0x81, 0x82, 0x87, 0x8E, 0x8F, 0x91,
+    0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0xBE, 0x47, 0x00, 0xBE, 0x47, 0x00, 0xBE,
+    0x47, 0x00, 0x01, 0x00, 0x80, 0x64, 0x76, 0x00, 0x01, 0x00, 0xB2, 0x0E, 0x63, 0x00, 0x01, 0x00,
+    0xB1, 0xD4, 0x65, 0x00, 0x02, 0x00, 0xB2, 0xBF, 0x14, 0x63, 0x00, 0x20, 0x65, 0x00, 0x05, 0x00,
+    0xB0, 0xB8, 0xBB, 0xBC, 0xBE, 0x26, 0x39, 0x00, 0x68, 0x76, 0x00, 0x6E, 0x76, 0x00, 0xBE, 0x47,
+    0x00, 0x78, 0x76, 0x00, 0x03, 0x00, 0x80, 0x8A, 0x8C, 0x82, 0x76, 0x00, 0xBE, 0x47, 0x00, 0x26,
+    0x39, 0x00, 0x02, 0x00, 0xBB, 0xBD, 0x8A, 0x76, 0x00, 0x90, 0x76, 0x00, 0x04, 0x00, 0x80, 0x81,
+    0x82, 0x85, 0x9A, 0x76, 0x00, 0xA0, 0x76, 0x00, 0xFA, 0x62, 0x00, 0x42, 0x63, 0x00, 0x02, 0x00,
+    0xB5, 0xBB, 0x10, 0x68, 0x00, 0xA6, 0x76, 0x00, 0x01, 0x00, 0x80, 0xAC, 0x76, 0x00, 0x06, 0x00,
+    0xB0, 0xB2, 0xB5, 0xB8, 0xBB, 0xBE, 0x38, 0x73, 0x00, 0xB2, 0x76, 0x00, 0xB8, 0x76, 0x00, 0xC2,
+    0x76, 0x00, 0xC8, 0x76, 0x00, 0xCE, 0x76, 0x00, 0x04, 0x00, 0x80, 0x83, 0x8B, 0x8C, 0xD8, 0x76,
+    0x00, 0xE2, 0x76, 0x00, 0xE8, 0x76, 0x00, 0xEE, 0x76, 0x00, 0x05, 0x00, 0xB1, 0xB2, 0xB4, 0xB6,
+    0xBE, 0x18, 0x63, 0x00, 0xF6, 0x76, 0x00, 0xFA, 0x62, 0x00, 0xFC, 0x76, 0x00, 0x18, 0x63, 0x00,
+    0x03, 0x00, 0x81, 0x82, 0x86, 0x02, 0x77, 0x00, 0x0A, 0x77, 0x00, 0xFA, 0x62, 0x00, 0x01, 0x00,
+    0xB4, 0x10, 0x77, 0x00, 0x07, 0x00, 0xB0, 0xB2, 0xB3, 0xB4, 0xB5, 0xBD, 0xBE, 0x1A, 0x77, 0x00,
+    0x20, 0x77, 0x00, 0x2A, 0x77, 0x00, 0x30, 0x77, 0x00, 0x3A, 0x77, 0x00, 0x20, 0x63, 0x00, 0x40,
+    0x77, 0x00, 0x02, 0x00, 0x83, 0x8B, 0x4C, 0x77, 0x00, 0x52, 0x77, 0x00, 0x05, 0x00, 0xB3, 0xB5,
+    0xB7, 0xBC, 0xBE, 0x5C, 0x77, 0x00, 0xF0, 0x66, 0x00, 0xFA, 0x62, 0x00, 0x04, 0x65, 0x00, 0xFA,
+    0x62, 0x00, 0x01, 0x00, 0x81, 0x64, 0x77, 0x00, 0x01, 0x00, 0x81, 0x6A, 0x77, 0x00, 0x04, 0x00,
+    0xB0, 0xB2, 0xBB, 0xBE, 0x72, 0x77, 0x00, 0xFA, 0x62, 0x00, 0x78, 0x77, 0x00, 0x80, 0x77, 0x00,
+    0x03, 0x00, 0x81, 0x82, 0x83, 0x86, 0x77, 0x00, 0x8C, 0x77, 0x00, 0x94, 0x77, 0x00, 0x05, 0x00,
+    0xB0, 0xB3, 0xB5, 0xB8, 0xBE, 0x14, 0x63, 0x00, 0x9A, 0x77, 0x00, 0x1C, 0x63, 0x00, 0xA0, 0x77,
+    0x00, 0x14, 0x63, 0x00, 0x05, 0x00, 0x83, 0x8B, 0x8E, 0x8F, 0x91, 0xA6, 0x77, 0x00, 0x1C, 0x63,
+    0x00, 0x1C, 0x63, 0x00, 0x14, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x04, 0x00, 0xB0, 0xB1, 0xB5, 0xBD,
+    0x14, 0x63, 0x00, 0xA0, 0x68, 0x00, 0x26, 0x39, 0x00, 0xAE, 0x77, 0x00, 0x05, 0x00, 0x80, 0x87,
+    0x88, 0x8C, 0x91, 0x0E, 0x63, 0x00, 0xB8, 0x77, 0x00, 0x3C, 0x63, 0x00, 0xC0, 0x77, 0x00, 0x26,
+    0x39, 0x00, 0x05, 0x00, 0xB0, 0xB4, 0xB5, 0xB8, 0xBE, 0x14, 0x63, 0x00, 0xAC, 0x63, 0x00, 0xC8,
+    0x77, 0x00, 0xCE, 0x77, 0x00, 0xBE, 0x66, 0x00, 0x03, 0x00, 0x80, 0x81, 0x82, 0x1C, 0x63, 0x00,
+    0xAC, 0x63, 0x00, 0xD4, 0x77, 0x00, 0x02, 0x00, 0xBB, 0xBF, 0x42, 0x63, 0x00, 0xDA, 0x77, 0x00,
+    0x03, 0x00, 0x81, 0x82, 0x84, 0xE0, 0x77, 0x00, 0x36, 0x6E, 0x00, 0x42, 0x63, 0x00, 0x03, 0x00,
+    0xB0, 0xBB, 0xBE, 0xEA, 0x77, 0x00, 0xF4, 0x77, 0x00, 0xFE, 0x77, 0x00, 0x02, 0x00, 0x80, 0x82,
+    0x6C, 0x63, 0x00, 0x08, 0x78, 0x00, 0x06, 0x00, 0xB0, 0xB1, 0xB2, 0xB5, 0xB8, 0xBE, 0x0E, 0x6F,
+    0x00, 0x0E, 0x78, 0x00, 0x10, 0x6C, 0x00, 0x14, 0x78, 0x00, 0x20, 0x78, 0x00, 0x28, 0x78, 0x00,
+    0x07, 0x00, 0x82, 0x83, 0x86, 0x8B, 0x8E, 0x8F, 0x91, 0x3E, 0x65, 0x00, 0x30, 0x78, 0x00, 0x26,
+    0x39, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x08, 0x00,
+    0xB0, 0xB1, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x3A, 0x78, 0x00, 0x40, 0x78, 0x00, 0x48, 0x78,
+    0x00, 0x52, 0x78, 0x00, 0x5E, 0x78, 0x00, 0x64, 0x78, 0x00, 0x6E, 0x78, 0x00, 0x74, 0x78, 0x00,
+    0x07, 0x00, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x7E, 0x78, 0x00, 0x84, 0x78, 0x00, 0x90,
+    0x78, 0x00, 0x26, 0x39, 0x00, 0x96, 0x78, 0x00, 0x10, 0x6C, 0x00, 0x9C, 0x78, 0x00, 0x07, 0x00,
+    0xB2, 0xB3, 0xB4, 0xB5, 0xB8, 0xBA, 0xBC, 0xA2, 0x78, 0x00, 0xBE, 0x47, 0x00, 0xBE, 0x47, 0x00,
+    0xAE, 0x78, 0x00, 0xB8, 0x78, 0x00, 0xC0, 0x78, 0x00, 0x42, 0x63, 0x00, 0x06, 0x00, 0x80, 0x81,
+    0x83, 0x85, 0x8C, 0x91, 0xC6, 0x78, 0x00, 0xD0, 0x78, 0x00, 0xD6, 0x78, 0x00, 0xBE, 0x47, 0x00,
+    0xEC, 0x70, 0x00, 0xE0, 0x78, 0x00, 0x01, 0x00, 0xBF, 0xAC, 0x63, 0x00, 0x02, 0x00, 0x81, 0x82,
+    0x8C, 0x72, 0x00, 0xEA, 0x78, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE, 0xF0, 0x78, 0x00, 0x14,
+    0x63, 0x00, 0x08, 0x64, 0x00, 0xF6, 0x78, 0x00, 0x02, 0x00, 0x80, 0x91, 0x36, 0x6E, 0x00, 0x14,
+    0x63, 0x00, 0x04, 0x00, 0xB8, 0xBB, 0xBC, 0xBE, 0x26, 0x39, 0x00, 0x00, 0x79, 0x00, 0x3C, 0x63,
+    0x00, 0xA2, 0x6D, 0x00, 0x02, 0x00, 0x80, 0x83, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x01, 0x00,
+    0xBE, 0x42, 0x63, 0x00, 0x02, 0x00, 0xB0, 0xBB, 0xDE, 0x6B, 0x00, 0x06, 0x79, 0x00, 0x01, 0x00,
+    0x82, 0x0E, 0x79, 0x00, 0x03, 0x00, 0xB2, 0xBB, 0xBF, 0x16, 0x79, 0x00, 0x9A, 0x64, 0x00, 0x1C,
+    0x79, 0x00, 0x01, 0x00, 0x82, 0x0E, 0x63, 0x00, 0x03, 0x00, 0xB2, 0xB4, 0xB7, 0xFA, 0x62, 0x00,
+    0xFA, 0x62, 0x00, 0xFA, 0x62, 0x00, 0x01, 0x00, 0x80, 0x6C, 0x63, 0x00, 0x01, 0x00, 0xB6, 0x6C,
+    0x63, 0x00, 0x04, 0x00, 0xB2, 0xB4, 0xB5, 0xB7, 0x22, 0x79, 0x00, 0x3E, 0x65, 0x00, 0xD8, 0x75,
+    0x00, 0x2A, 0x6B, 0x00, 0x06, 0x00, 0x81, 0x82, 0x83, 0x84, 0x85, 0x88, 0x2C, 0x79, 0x00, 0x36,
+    0x79, 0x00, 0xD8, 0x75, 0x00, 0x2E, 0x65, 0x00, 0xF2, 0x65, 0x00, 0x3C, 0x79, 0x00, 0x05, 0x00,
+    0xB4, 0xB7, 0xBA, 0xBB, 0xBF, 0x42, 0x79, 0x00, 0x48, 0x79, 0x00, 0x50, 0x79, 0x00, 0x56, 0x79,
+    0x00, 0x5C, 0x79, 0x00, 0x04, 0x00, 0x80, 0x81, 0x82, 0x88, 0x62, 0x79, 0x00, 0x68, 0x79, 0x00,
+    0x3E, 0x65, 0x00, 0x3C, 0x79, 0x00, 0x04, 0x00, 0xB0, 0xB6, 0xBA, 0xBD, 0x72, 0x79, 0x00, 0x78,
+    0x79, 0x00, 0x38, 0x65, 0x00, 0x7E, 0x79, 0x00, 0x01, 0x00, 0x81, 0x84, 0x79, 0x00, 0x04, 0x00,
+    0xB0, 0xB5, 0xB8, 0xBE, 0x8A, 0x79, 0x00, 0x94, 0x79, 0x00, 0x9E, 0x79, 0x00, 0xA4, 0x79, 0x00,
+    0x04, 0x00, 0x8B, 0x8E, 0x8F, 0x91, 0xAE, 0x79, 0x00, 0xB8, 0x79, 0x00, 0xC2, 0x79, 0x00, 0xC8,
+    0x79, 0x00, 0x02, 0x00, 0xB0, 0xBE, 0x14, 0x63, 0x00, 0xD2, 0x79, 0x00, 0x01, 0x00, 0x8B, 0x14,
+    0x63, 0x00, 0x0A, 0x00, 0xB1, 0xB2, 0xB4, 0xB5, 0xB7, 0xB8, 0xB9, 0xBB, 0xBC, 0xBF, 0xD4, 0x65,
+    0x00, 0xD6, 0x79, 0x00, 0xE0, 0x79, 0x00, 0xEA, 0x79, 0x00, 0xF4, 0x79, 0x00, 0xFA, 0x79, 0x00,
+    0xBC, 0x3B, 0x00, 0x7E, 0x79, 0x00, 0x00, 0x7A, 0x00, 0x06, 0x7A, 0x00, 0x07, 0x00, 0x80, 0x81,
+    0x82, 0x85, 0x88, 0x8D, 0x91, 0x0A, 0x7A, 0x00, 0x14, 0x7A, 0x00, 0x20, 0x7A, 0x00, 0xD4, 0x65,
+    0x00, 0x2A, 0x7A, 0x00, 0x64, 0x6E, 0x00, 0x30, 0x7A, 0x00, 0x01, 0x00, 0xBE, 0x36, 0x7A, 0x00,
+    0x03, 0x00, 0xB5, 0xB8, 0xBE, 0x3C, 0x7A, 0x00, 0x46, 0x7A, 0x00, 0x52, 0x7A, 0x00, 0x03, 0x00,
+    0x81, 0x83, 0x91, 0x26, 0x39, 0x00, 0x42, 0x63, 0x00, 0x5C, 0x7A, 0x00, 0x03, 0x00, 0xB0, 0xB8,
+    0xBE, 0x62, 0x7A, 0x00, 0x68, 0x7A, 0x00, 0x14, 0x63, 0x00, 0x02, 0x00, 0xB2, 0xB8, 0x80, 0x69,
+    0x00, 0x72, 0x7A, 0x00, 0x02, 0x00, 0xB1, 0xB3, 0xBC, 0x3B, 0x00, 0x7C, 0x7A, 0x00, 0x02, 0x00,
+    0x81, 0x82, 0x82, 0x7A, 0x00, 0xEA, 0x73, 0x00, 0x01, 0x00, 0x82, 0x26, 0x39, 0x00, 0x01, 0x00,
+    0x80, 0x36, 0x63, 0x00, 0x02, 0x00, 0x81, 0x82, 0x8C, 0x7A, 0x00, 0x3E, 0x65, 0x00, 0x0C, 0x00,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xB7, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xAC, 0x63, 0x00, 0x92,
+    0x7A, 0x00, 0x9C, 0x7A, 0x00, 0xD6, 0x66, 0x00, 0xA2, 0x7A, 0x00, 0xAC, 0x7A, 0x00, 0xB2, 0x7A,
+    0x00, 0xBC, 0x7A, 0x00, 0xC2, 0x7A, 0x00, 0xC8, 0x7A, 0x00, 0xCE, 0x7A, 0x00, 0x22, 0x73, 0x00,
+    0x06, 0x00, 0x81, 0x82, 0x85, 0x89, 0x8E, 0x8F, 0xD8, 0x7A, 0x00, 0xE2, 0x7A, 0x00, 0xDA, 0x63,
+    0x00, 0xEC, 0x7A, 0x00, 0xBE, 0x47, 0x00, 0xF2, 0x7A, 0x00, 0x02, 0x00, 0xBB, 0xBE, 0xFA, 0x7A,
+    0x00, 0x04, 0x7B, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE, 0x0A, 0x7B, 0x00, 0x14, 0x7B, 0x00,
+    0x1E, 0x7B, 0x00, 0x2A, 0x7B, 0x00, 0x02, 0x00, 0x8C, 0x91, 0x1C, 0x63, 0x00, 0x32, 0x7B, 0x00,
+    0x03, 0x00, 0xB2, 0xBB, 0xBD, 0x42, 0x63, 0x00, 0x24, 0x65, 0x00, 0x42, 0x63, 0x00, 0x06, 0x00,
+    0xB0, 0xB2, 0xB6, 0xB8, 0xBB, 0xBE, 0xDE, 0x6B, 0x00, 0x24, 0x65, 0x00, 0xFA, 0x62, 0x00, 0x38,
+    0x7B, 0x00, 0x42, 0x63, 0x00, 0x7C, 0x66, 0x00, 0x01, 0x00, 0x86, 0x42, 0x63, 0x00, 0x0C, 0x00,
+    0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB9, 0xBA, 0xBC, 0xBD, 0xBE, 0xBF, 0xB0, 0x63, 0x00, 0x3E,
+    0x7B, 0x00, 0x44, 0x7B, 0x00, 0x4A, 0x7B, 0x00, 0x50, 0x7B, 0x00, 0x56, 0x7B, 0x00, 0x60, 0x7B,
+    0x00, 0x66, 0x7B, 0x00, 0x70, 0x7B, 0x00, 0x76, 0x7B, 0x00, 0x80, 0x7B, 0x00, 0x04, 0x74, 0x00,
+    0x06, 0x00, 0x80, 0x81, 0x82, 0x83, 0x87, 0x88, 0x66, 0x67, 0x00, 0x8A, 0x7B, 0x00, 0x4E, 0x73,
+    0x00, 0x94, 0x7B, 0x00, 0x2A, 0x75, 0x00, 0x64, 0x69, 0x00, 0x02, 0x00, 0xB0, 0xB4, 0x9A, 0x7B,
+    0x00, 0xC2, 0x6C, 0x00, 0x02, 0x00, 0xB2, 0xBE, 0x10, 0x6C, 0x00, 0x1C, 0x63, 0x00, 0x0B, 0x00,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xBA, 0xBC, 0xBD, 0xBE, 0x2E, 0x65, 0x00, 0xA4, 0x7B,
+    0x00, 0x56, 0x75, 0x00, 0xAC, 0x7B, 0x00, 0xB2, 0x7B, 0x00, 0xBC, 0x7B, 0x00, 0xCE, 0x70, 0x00,
+    0x0E, 0x66, 0x00, 0xC6, 0x7B, 0x00, 0xD0, 0x7B, 0x00, 0xD8, 0x7B, 0x00, 0x09, 0x00, 0x80, 0x81,
+    0x82, 0x83, 0x84, 0x85, 0x86, 0x88, 0x8D, 0x66, 0x67, 0x00, 0xE2, 0x7B, 0x00, 0x5E, 0x6E, 0x00,
+    0xBE, 0x47, 0x00, 0x24, 0x68, 0x00, 0xE0, 0x67, 0x00, 0xBE, 0x47, 0x00, 0xBE, 0x47, 0x00, 0xEE,
+    0x7B, 0x00, 0x02, 0x00, 0xB2, 0xBB, 0x42, 0x63, 0x00, 0x24, 0x65, 0x00, 0x03, 0x00, 0x8C, 0x8E,
+    0x8F, 0x42, 0x63, 0x00, 0x20, 0x65, 0x00, 0x14, 0x63, 0x00, 0x01, 0x00, 0x87, 0x42, 0x63, 0x00,
+    0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE, 0xF4, 0x7B, 0x00, 0xFA, 0x7B, 0x00, 0x04, 0x7C, 0x00, 0x0A,
+    0x7C, 0x00, 0x0D, 0x00, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE,
+    0xBF, 0x10, 0x7C, 0x00, 0xA0, 0x68, 0x00, 0x1A, 0x7C, 0x00, 0x24, 0x7C, 0x00, 0x2E, 0x7C, 0x00,
+    0x38, 0x7C, 0x00, 0x42, 0x7C, 0x00, 0x48, 0x7C, 0x00, 0x52, 0x7C, 0x00, 0x58, 0x7C, 0x00, 0x5E,
+    0x7C, 0x00, 0x64, 0x7C, 0x00, 0x6A, 0x7C, 0x00, 0x09, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+    0x88, 0x8F, 0x91, 0x74, 0x7C, 0x00, 0x7E, 0x7C, 0x00, 0x88, 0x7C, 0x00, 0x92, 0x7C, 0x00, 0x9A,
+    0x7C, 0x00, 0xE0, 0x67, 0x00, 0xA4, 0x7C, 0x00, 0xAA, 0x7C, 0x00, 0xA6, 0x6A, 0x00, 0x01, 0x00,
+    0xBB, 0xB0, 0x7C, 0x00, 0x03, 0x00, 0xBA, 0xBD, 0xBF, 0xFA, 0x62, 0x00, 0x42, 0x63, 0x00, 0xFA,
+    0x62, 0x00, 0x01, 0x00, 0x82, 0xBA, 0x7C, 0x00, 0x04, 0x00, 0xB0, 0xB2, 0xBC, 0xBE, 0xC0, 0x7C,
+    0x00, 0xC6, 0x7C, 0x00, 0x42, 0x63, 0x00, 0xCE, 0x7C, 0x00, 0x04, 0x00, 0x80, 0x83, 0x8C, 0x8F,
+    0xD8, 0x7C, 0x00, 0xDE, 0x7C, 0x00, 0xE4, 0x7C, 0x00, 0xEA, 0x7C, 0x00, 0x06, 0x00, 0xB1, 0xB3,
+    0xB4, 0xB6, 0xBA, 0xBB, 0xF0, 0x7C, 0x00, 0x7C, 0x7A, 0x00, 0xF6, 0x7C, 0x00, 0xFC, 0x7C, 0x00,
+    0xEA, 0x6B, 0x00, 0xBE, 0x47, 0x00, 0x04, 0x00, 0x81, 0x82, 0x85, 0x87, 0x02, 0x7D, 0x00, 0xEA,
+    0x73, 0x00, 0x0C, 0x7D, 0x00, 0xFE, 0x67, 0x00, 0x04, 0x00, 0xB2, 0xB8, 0xBB, 0xBE, 0x42, 0x63,
+    0x00, 0x12, 0x7D, 0x00, 0x18, 0x7D, 0x00, 0x20, 0x7D, 0x00, 0x01, 0x00, 0xB2, 0x42, 0x63, 0x00,
+    0x02, 0x00, 0xBB, 0xBC, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00, 0x01, 0x00, 0xBC, 0xC2, 0x6C, 0x00,
+    0x05, 0x00, 0xB1, 0xB4, 0xB7, 0xBA, 0xBC, 0xBE, 0x47, 0x00, 0x32, 0x65, 0x00, 0x26, 0x39, 0x00,
+    0xA0, 0x68, 0x00, 0xBE, 0x47, 0x00, 0x02, 0x00, 0x81, 0x85, 0x26, 0x7D, 0x00, 0x60, 0x66, 0x00,
+    0x03, 0x00, 0xB5, 0xB8, 0xBA, 0xBE, 0x47, 0x00, 0xBE, 0x47, 0x00, 0x26, 0x39, 0x00, 0x01, 0x00,
+    0xBB, 0x18, 0x63, 0x00, 0x01, 0x00, 0x81, 0xBE, 0x47, 0x00, 0x01, 0x00, 0x8E, 0xBE, 0x47, 0x00,
+    0x04, 0x00, 0xB7, 0xBA, 0xBC, 0xBD, 0x2C, 0x7D, 0x00, 0x60, 0x7B, 0x00, 0x36, 0x7D, 0x00, 0xE4,
+    0x71, 0x00, 0x01, 0x00, 0x81, 0x3C, 0x7D, 0x00, 0x05, 0x00, 0xB1, 0xB4, 0xBA, 0xBB, 0xBF, 0xA0,
+    0x68, 0x00, 0x56, 0x79, 0x00, 0xD6, 0x66, 0x00, 0x42, 0x7D, 0x00, 0x48, 0x7D, 0x00, 0x05, 0x00,
+    0x80, 0x82, 0x83, 0x84, 0x85, 0x4E, 0x7D, 0x00, 0x54, 0x7D, 0x00, 0xD8, 0x75, 0x00, 0x38, 0x65,
+    0x00, 0xD4, 0x65, 0x00, 0x01, 0x00, 0xB5, 0x5E, 0x7D, 0x00, 0x04, 0x00, 0x80, 0x83, 0x8B, 0x8E,
+    0x68, 0x7D, 0x00, 0x10, 0x68, 0x00, 0x42, 0x63, 0x00, 0x26, 0x39, 0x00, 0x01, 0x00, 0xB5, 0x72,
+    0x77, 0x00, 0x03, 0x00, 0xB8, 0xBD, 0xBE, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00,
+    0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00, 0x14, 0x63, 0x00, 0x42,
+    0x63, 0x00, 0x04, 0x00, 0xB3, 0xB7, 0xBA, 0xBC, 0x3A, 0x75, 0x00, 0xD4, 0x65, 0x00, 0x6E, 0x7D,
+    0x00, 0xBE, 0x6F, 0x00, 0x02, 0x00, 0x80, 0x81, 0x78, 0x7D, 0x00, 0x7E, 0x7D, 0x00, 0x03, 0x00,
+    0xB7, 0xBE, 0xBF, 0xBC, 0x3B, 0x00, 0x88, 0x7D, 0x00, 0xA0, 0x68, 0x00, 0x01, 0x00, 0x85, 0x18,
+    0x63, 0x00, 0x06, 0x00, 0xB0, 0xB2, 0xB8, 0xBB, 0xBD, 0xBE, 0x8E, 0x7D, 0x00, 0xDA, 0x6F, 0x00,
+    0x98, 0x7D, 0x00, 0x9E, 0x7D, 0x00, 0x26, 0x39, 0x00, 0xA6, 0x7D, 0x00, 0x03, 0x00, 0x80, 0x81,
+    0x83, 0xB0, 0x7D, 0x00, 0x18, 0x63, 0x00, 0xB8, 0x7D, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE,
+    0xC2, 0x7D, 0x00, 0xD0, 0x7D, 0x00, 0xDA, 0x7D, 0x00, 0xE4, 0x7D, 0x00, 0x06, 0x00, 0x83, 0x8B,
+    0x8C, 0x8E, 0x8F, 0x91, 0xF2, 0x7D, 0x00, 0xF8, 0x7D, 0x00, 0x26, 0x39, 0x00, 0x48, 0x70, 0x00,
+    0x10, 0x68, 0x00, 0xD0, 0x6D, 0x00, 0x01, 0x00, 0xB5, 0xFE, 0x7D, 0x00, 0x01, 0x00, 0x83, 0x04,
+    0x7E, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE, 0x0A, 0x7E, 0x00, 0x14, 0x7E, 0x00, 0x1A, 0x7E,
+    0x00, 0x20, 0x7E, 0x00, 0x02, 0x00, 0x83, 0x8B, 0x6A, 0x68, 0x00, 0x10, 0x68, 0x00, 0x06, 0x00,
+    0xB1, 0xB2, 0xB4, 0xB7, 0xBB, 0xBC, 0x04, 0x73, 0x00, 0xEC, 0x72, 0x00, 0x18, 0x63, 0x00, 0xD4,
+    0x65, 0x00, 0x28, 0x7E, 0x00, 0x66, 0x67, 0x00, 0x05, 0x00, 0x80, 0x81, 0x82, 0x87, 0x88, 0x2E,
+    0x7E, 0x00, 0x38, 0x7E, 0x00, 0x42, 0x7E, 0x00, 0xE0, 0x67, 0x00, 0xCA, 0x6D, 0x00, 0x05, 0x00,
+    0xB0, 0xB5, 0xB8, 0xBD, 0xBE, 0xB4, 0x69, 0x00, 0x4C, 0x7E, 0x00, 0x56, 0x7E, 0x00, 0x14, 0x63,
+    0x00, 0x60, 0x7E, 0x00, 0x01, 0x00, 0x8C, 0x26, 0x39, 0x00, 0x02, 0x00, 0xB0, 0xB5, 0x6A, 0x7E,
+    0x00, 0x74, 0x7E, 0x00, 0x09, 0x00, 0xB0, 0xB1, 0xB2, 0xB8, 0xBA, 0xBB, 0xBD, 0xBE, 0xBF, 0x70,
+    0x72, 0x00, 0x42, 0x63, 0x00, 0x20, 0x63, 0x00, 0x7A, 0x7E, 0x00, 0xC2, 0x6C, 0x00, 0xFA, 0x62,
+    0x00, 0x7E, 0x7E, 0x00, 0x86, 0x7E, 0x00, 0xFA, 0x62, 0x00, 0x02, 0x00, 0x82, 0x87, 0xAC, 0x63,
+    0x00, 0xFA, 0x62, 0x00, 0x0B, 0x00, 0xB0, 0xB1, 0xB2, 0xB5, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE,
+    0xBF, 0xA0, 0x66, 0x00, 0x26, 0x39, 0x00, 0x8C, 0x7E, 0x00, 0x9A, 0x7E, 0x00, 0xAA, 0x7E, 0x00,
+    0x26, 0x39, 0x00, 0xB6, 0x7E, 0x00, 0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0xC0, 0x7E, 0x00, 0x26,
+    0x39, 0x00, 0x0A, 0x00, 0x80, 0x81, 0x83, 0x84, 0x86, 0x87, 0x8B, 0x8C, 0x8F, 0x91, 0xCE, 0x7E,
+    0x00, 0x26, 0x39, 0x00, 0xDC, 0x7E, 0x00, 0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0xE2, 0x7E, 0x00,
+    0xE8, 0x7E, 0x00, 0xF0, 0x7E, 0x00, 0xFC, 0x7E, 0x00, 0x06, 0x7F, 0x00, 0x08, 0x00, 0xB1, 0xB2,
+    0xB3, 0xB5, 0xB7, 0xBA, 0xBC, 0xBF, 0x12, 0x7F, 0x00, 0x18, 0x63, 0x00, 0x64, 0x69, 0x00, 0x32,
+    0x65, 0x00, 0xFA, 0x62, 0x00, 0xB0, 0x63, 0x00, 0x1A, 0x7F, 0x00, 0x20, 0x7F, 0x00, 0x04, 0x00,
+    0x81, 0x82, 0x84, 0x85, 0x26, 0x7F, 0x00, 0x12, 0x65, 0x00, 0x3E, 0x71, 0x00, 0x18, 0x63, 0x00,
+    0x01, 0x00, 0xB5, 0x30, 0x7F, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE, 0x26, 0x39, 0x00, 0x34,
+    0x7F, 0x00, 0x10, 0x68, 0x00, 0x26, 0x39, 0x00, 0x05, 0x00, 0xB0, 0xB5, 0xB8, 0xBB, 0xBE, 0x3A,
+    0x7F, 0x00, 0x42, 0x7F, 0x00, 0x48, 0x7F, 0x00, 0x1C, 0x63, 0x00, 0x26, 0x39, 0x00, 0x01, 0x00,
+    0x91, 0x42, 0x7F, 0x00, 0x01, 0x00, 0xB5, 0x52, 0x7F, 0x00, 0x04, 0x00, 0xB3, 0xB7, 0xBC, 0xBF,
+    0x60, 0x66, 0x00, 0xFA, 0x62, 0x00, 0xC8, 0x76, 0x00, 0x22, 0x73, 0x00, 0x01, 0x00, 0x81, 0x58,
+    0x7F, 0x00, 0x05, 0x00, 0x81, 0x82, 0x8E, 0x8F, 0x91, 0x60, 0x7F, 0x00, 0x26, 0x39, 0x00, 0xBE,
+    0x47, 0x00, 0xBE, 0x47, 0x00, 0xBE, 0x47, 0x00, 0x02, 0x00, 0x80, 0x81, 0x18, 0x63, 0x00, 0x42,
+    0x63, 0x00, 0x01, 0x00, 0xB7, 0x26, 0x39, 0x00, 0x01, 0x00, 0x82, 0xEA, 0x73, 0x00, 0x01, 0x00,
+    0xBA, 0xF4, 0x7B, 0x00, 0x01, 0x00, 0x81, 0x66, 0x7F, 0x00, 0x07, 0x00, 0xB1, 0xB2, 0xB3, 0xB7,
+    0xBA, 0xBD, 0xBF, 0x6C, 0x7F, 0x00, 0x76, 0x7F, 0x00, 0x7C, 0x7F, 0x00, 0xD4, 0x65, 0x00, 0x84,
+    0x7F, 0x00, 0x42, 0x63, 0x00, 0xA0, 0x68, 0x00, 0x03, 0x00, 0x81, 0x82, 0x89, 0x8A, 0x7F, 0x00,
+    0xB0, 0x63, 0x00, 0xBE, 0x47, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE, 0xA6, 0x65, 0x00, 0x92,
+    0x7F, 0x00, 0x26, 0x39, 0x00, 0x9C, 0x7F, 0x00, 0x05, 0x00, 0x80, 0x83, 0x8B, 0x8F, 0x91, 0xB0,
+    0x67, 0x00, 0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0xA6, 0x7F, 0x00, 0x08, 0x00,
+    0xB3, 0xB4, 0xB7, 0xBA, 0xBB, 0xBC, 0xBE, 0xBF, 0xD8, 0x75, 0x00, 0x18, 0x63, 0x00, 0x2A, 0x6B,
+    0x00, 0xAC, 0x7F, 0x00, 0xB6, 0x7F, 0x00, 0xBC, 0x7F, 0x00, 0xC2, 0x7F, 0x00, 0xCC, 0x7F, 0x00,
+    0x03, 0x00, 0x80, 0x81, 0x85, 0xD2, 0x7F, 0x00, 0xDC, 0x7F, 0x00, 0x94, 0x63, 0x00, 0x09, 0x00,
+    0xB0, 0xB1, 0xB4, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xA6, 0x6A, 0x00, 0xA0, 0x68, 0x00, 0x66,
+    0x67, 0x00, 0xE6, 0x7F, 0x00, 0xEC, 0x7F, 0x00, 0xAC, 0x63, 0x00, 0xF4, 0x7F, 0x00, 0x48, 0x7D,
+    0x00, 0xFA, 0x7F, 0x00, 0x03, 0x00, 0x81, 0x84, 0x85, 0x04, 0x80, 0x00, 0x5E, 0x6E, 0x00, 0xB0,
+    0x63, 0x00, 0x03, 0x00, 0xB0, 0xB5, 0xBD, 0x0E, 0x80, 0x00, 0x14, 0x80, 0x00, 0xBC, 0x3B, 0x00,
+    0x01, 0x00, 0x91, 0x14, 0x80, 0x00, 0x01, 0x00, 0xBE, 0x1A, 0x80, 0x00, 0x01, 0x00, 0xB8, 0x20,
+    0x80, 0x00, 0x01, 0x00, 0x89, 0x14, 0x63, 0x00, 0x07, 0x00, 0xB1, 0xB2, 0xB4, 0xB7, 0xBA, 0xBC,
+    0xBD, 0x26, 0x80, 0x00, 0xA0, 0x68, 0x00, 0x30, 0x80, 0x00, 0xD4, 0x65, 0x00, 0x0E, 0x66, 0x00,
+    0x38, 0x80, 0x00, 0x42, 0x80, 0x00, 0x04, 0x00, 0x80, 0x81, 0x82, 0x89, 0x48, 0x80, 0x00, 0x52,
+    0x80, 0x00, 0x5C, 0x80, 0x00, 0xBE, 0x47, 0x00, 0x01, 0x00, 0xB0, 0xA0, 0x6A, 0x00, 0x0B, 0x00,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB8, 0xBC, 0xBD, 0xBE, 0xBF, 0x62, 0x80, 0x00, 0x26, 0x39,
+    0x00, 0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0x68, 0x80, 0x00, 0x70, 0x80, 0x00, 0x7A, 0x80, 0x00,
+    0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0x84, 0x80, 0x00, 0x26, 0x39, 0x00, 0x08, 0x00, 0x80, 0x83,
+    0x84, 0x89, 0x8A, 0x8B, 0x8F, 0x91, 0x26, 0x39, 0x00, 0x8E, 0x80, 0x00, 0x26, 0x39, 0x00, 0x26,
+    0x39, 0x00, 0x26, 0x39, 0x00, 0x1C, 0x63, 0x00, 0x98, 0x80, 0x00, 0xA6, 0x80, 0x00, 0x05, 0x00,
+    0xB1, 0xB4, 0xB5, 0xBC, 0xBF, 0x42, 0x63, 0x00, 0x80, 0x69, 0x00, 0xAC, 0x80, 0x00, 0x80, 0x69,
+    0x00, 0x80, 0x69, 0x00, 0x03, 0x00, 0xB3, 0xB6, 0xBF, 0x3E, 0x65, 0x00, 0xB2, 0x80, 0x00, 0xB8,
+    0x80, 0x00, 0x04, 0x00, 0x81, 0x84, 0x88, 0x89, 0xBE, 0x80, 0x00, 0xA0, 0x68, 0x00, 0xC8, 0x80,
+    0x00, 0xBE, 0x47, 0x00, 0x01, 0x00, 0x81, 0x26, 0x7D, 0x00, 0x03, 0x00, 0xB5, 0xB8, 0xBC, 0xBC,
+    0x3B, 0x00, 0xBC, 0x3B, 0x00, 0xFA, 0x62, 0x00, 0x03, 0x00, 0x82, 0x8E, 0x91, 0x34, 0x49, 0x00,
+    0x20, 0x65, 0x00, 0xBC, 0x3B, 0x00, 0x03, 0x00, 0xB3, 0xB6, 0xBF, 0xBE, 0x47, 0x00, 0xBE, 0x47,
+    0x00, 0xBE, 0x47, 0x00, 0x01, 0x00, 0x87, 0x26, 0x6B, 0x00, 0x04, 0x00, 0xB3, 0xB7, 0xBA, 0xBF,
+    0xD8, 0x75, 0x00, 0x2A, 0x6B, 0x00, 0xAC, 0x7F, 0x00, 0xCC, 0x7F, 0x00, 0x03, 0x00, 0x80, 0x81,
+    0x85, 0xD2, 0x80, 0x00, 0xD8, 0x80, 0x00, 0x94, 0x63, 0x00, 0x01, 0x00, 0xBB, 0x0C, 0x65, 0x00,
+    0x01, 0x00, 0x81, 0x42, 0x63, 0x00, 0x02, 0x00, 0xB5, 0xBE, 0xDE, 0x80, 0x00, 0xE4, 0x80, 0x00,
+    0x02, 0x00, 0x80, 0x8B, 0xEE, 0x80, 0x00, 0xFA, 0x80, 0x00, 0x04, 0x00, 0xB5, 0xB8, 0xBB, 0xBE,
+    0x00, 0x81, 0x00, 0x1C, 0x63, 0x00, 0xFA, 0x62, 0x00, 0x1C, 0x63, 0x00, 0x03, 0x00, 0xB2, 0xBB,
+    0xBD, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00, 0x06, 0x81, 0x00, 0x01, 0x00, 0x80, 0x12, 0x81, 0x00,
+    0x02, 0x00, 0xB0, 0xB2, 0xDE, 0x6B, 0x00, 0xFA, 0x62, 0x00, 0x02, 0x00, 0x80, 0x83, 0x1C, 0x81,
+    0x00, 0x14, 0x63, 0x00, 0x02, 0x00, 0xB4, 0xBB, 0xFA, 0x62, 0x00, 0xFA, 0x62, 0x00, 0x02, 0x00,
+    0x81, 0x85, 0x22, 0x81, 0x00, 0xFA, 0x62, 0x00, 0x01, 0x00, 0xB6, 0x42, 0x63, 0x00, 0x02, 0x00,
+    0xB2, 0xBE, 0x10, 0x6C, 0x00, 0x2A, 0x81, 0x00, 0x04, 0x00, 0xB0, 0xB2, 0xB8, 0xBE, 0x1C, 0x63,
+    0x00, 0x18, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x32, 0x81, 0x00, 0x01, 0x00, 0x83, 0x3A, 0x81, 0x00,
+    0x02, 0x00, 0xB0, 0xB5, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x04, 0x00, 0x83, 0x8B, 0x8E, 0x91,
+    0x1C, 0x63, 0x00, 0x3E, 0x81, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x01, 0x00, 0x8C, 0x1C,
+    0x63, 0x00, 0x05, 0x00, 0xB1, 0xB2, 0xB7, 0xBA, 0xBF, 0xFA, 0x62, 0x00, 0xFA, 0x62, 0x00, 0x44,
+    0x81, 0x00, 0xFA, 0x62, 0x00, 0xFA, 0x62, 0x00, 0x03, 0x00, 0x81, 0x82, 0x84, 0x58, 0x64, 0x00,
+    0x60, 0x66, 0x00, 0xFA, 0x62, 0x00, 0x01, 0x00, 0xBB, 0x4A, 0x81, 0x00, 0x01, 0x00, 0x80, 0x52,
+    0x81, 0x00, 0x05, 0x00, 0xB0, 0xB5, 0xB8, 0xBA, 0xBE, 0x1C, 0x63, 0x00, 0x58, 0x81, 0x00, 0x1C,
+    0x63, 0x00, 0x60, 0x81, 0x00, 0x66, 0x81, 0x00, 0x06, 0x00, 0x82, 0x83, 0x8B, 0x8E, 0x8F, 0x91,
+    0x0E, 0x66, 0x00, 0x14, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x1C,
+    0x63, 0x00, 0x07, 0x00, 0xB0, 0xB3, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xF0, 0x6B, 0x00, 0x1C, 0x63,
+    0x00, 0x6E, 0x81, 0x00, 0x78, 0x81, 0x00, 0x1C, 0x63, 0x00, 0x42, 0x63, 0x00, 0xFA, 0x62, 0x00,
+    0x06, 0x00, 0x81, 0x82, 0x84, 0x86, 0x87, 0x8C, 0x2E, 0x65, 0x00, 0x80, 0x81, 0x00, 0x1C, 0x63,
+    0x00, 0x26, 0x39, 0x00, 0x42, 0x63, 0x00, 0xC0, 0x77, 0x00, 0x05, 0x00, 0xB0, 0xB5, 0xB8, 0xBB,
+    0xBE, 0x1C, 0x63, 0x00, 0x04, 0x7E, 0x00, 0x1C, 0x63, 0x00, 0x9C, 0x6B, 0x00, 0x8A, 0x81, 0x00,
+    0x07, 0x00, 0x80, 0x83, 0x8B, 0x8C, 0x8E, 0x8F, 0x91, 0x0E, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x1C,
+    0x63, 0x00, 0x92, 0x81, 0x00, 0xBE, 0x47, 0x00, 0x1C, 0x63, 0x00, 0x04, 0x7E, 0x00, 0x01, 0x00,
+    0xB3, 0xAC, 0x63, 0x00, 0x02, 0x00, 0xB8, 0xBB, 0x14, 0x63, 0x00, 0x12, 0x6D, 0x00, 0x03, 0x00,
+    0xB0, 0xB2, 0xBB, 0x9C, 0x81, 0x00, 0xA6, 0x81, 0x00, 0xAE, 0x81, 0x00, 0x01, 0x00, 0xB5, 0x76,
+    0x72, 0x00, 0x03, 0x00, 0x80, 0x8C, 0x91, 0xBE, 0x47, 0x00, 0x1C, 0x63, 0x00, 0x76, 0x72, 0x00,
+    0x04, 0x00, 0xB5, 0xB8, 0xBB, 0xBF, 0x14, 0x63, 0x00, 0x14, 0x63, 0x00, 0xB6, 0x81, 0x00, 0x42,
+    0x63, 0x00, 0x01, 0x00, 0x91, 0x14, 0x63, 0x00, 0x04, 0x00, 0xB1, 0xB3, 0xB7, 0xBD, 0x60, 0x66,
+    0x00, 0xD8, 0x75, 0x00, 0x2A, 0x6B, 0x00, 0xBE, 0x81, 0x00, 0x04, 0x00, 0x82, 0x85, 0x88, 0x8D,
+    0xB0, 0x63, 0x00, 0xFA, 0x62, 0x00, 0xBC, 0x3B, 0x00, 0x20, 0x65, 0x00, 0x03, 0x00, 0xB2, 0xB4,
+    0xBE, 0x12, 0x65, 0x00, 0x12, 0x65, 0x00, 0xC4, 0x81, 0x00, 0x06, 0x00, 0xB0, 0xB3, 0xB6, 0xB7,
+    0xBD, 0xBE, 0xC8, 0x81, 0x00, 0xA0, 0x68, 0x00, 0xFA, 0x62, 0x00, 0x94, 0x63, 0x00, 0xB2, 0x80,
+    0x00, 0x18, 0x63, 0x00, 0x01, 0x00, 0x82, 0xBC, 0x3B, 0x00, 0x03, 0x00, 0xB0, 0xB8, 0xBE, 0x42,
+    0x63, 0x00, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00, 0x02, 0x00, 0xB1, 0xBD, 0xCE, 0x81, 0x00, 0xBC,
+    0x3B, 0x00, 0x03, 0x00, 0x80, 0x81, 0x82, 0xD4, 0x81, 0x00, 0xDE, 0x81, 0x00, 0xE4, 0x81, 0x00,
+    0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE, 0xEC, 0x81, 0x00, 0xF6, 0x81, 0x00, 0x00, 0x82, 0x00, 0x08,
+    0x82, 0x00, 0x02, 0x00, 0xBC, 0xBE, 0x42, 0x63, 0x00, 0x10, 0x82, 0x00, 0x01, 0x00, 0xBF, 0x16,
+    0x82, 0x00, 0x02, 0x00, 0x82, 0x84, 0x64, 0x69, 0x00, 0x26, 0x39, 0x00, 0x05, 0x00, 0xB1, 0xB4,
+    0xBA, 0xBD, 0xBE, 0xA0, 0x68, 0x00, 0xFA, 0x62, 0x00, 0xB0, 0x67, 0x00, 0xD6, 0x73, 0x00, 0xF0,
+    0x66, 0x00, 0x01, 0x00, 0x80, 0x1A, 0x82, 0x00, 0x02, 0x00, 0xB5, 0xB8, 0x10, 0x68, 0x00, 0x10,
+    0x68, 0x00, 0x02, 0x00, 0x8B, 0x91, 0x14, 0x63, 0x00, 0x10, 0x68, 0x00, 0x01, 0x00, 0xBE, 0xF0,
+    0x66, 0x00, 0x03, 0x00, 0xB0, 0xB5, 0xB7, 0x20, 0x82, 0x00, 0xAC, 0x63, 0x00, 0x26, 0x82, 0x00,
+    0x03, 0x00, 0xB0, 0xB5, 0xBE, 0x2C, 0x82, 0x00, 0x36, 0x82, 0x00, 0x40, 0x82, 0x00, 0x02, 0x00,
+    0x83, 0x91, 0x1C, 0x63, 0x00, 0x4E, 0x82, 0x00, 0x01, 0x00, 0x83, 0x30, 0x7F, 0x00, 0x01, 0x00,
+    0x8B, 0xC8, 0x67, 0x00, 0x02, 0x00, 0xBA, 0xBF, 0x16, 0x82, 0x00, 0x58, 0x82, 0x00, 0x05, 0x00,
+    0x80, 0x81, 0x84, 0x85, 0x8F, 0xF2, 0x65, 0x00, 0x60, 0x82, 0x00, 0xAC, 0x63, 0x00, 0x5A, 0x66,
+    0x00, 0xAC, 0x63, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE, 0x66, 0x82, 0x00, 0x70, 0x82, 0x00,
+    0x76, 0x82, 0x00, 0x80, 0x82, 0x00, 0x02, 0x00, 0x8B, 0x8F, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00,
+    0x04, 0x00, 0xB3, 0xB5, 0xB9, 0xBD, 0x10, 0x6C, 0x00, 0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0xBE,
+    0x47, 0x00, 0x05, 0x00, 0x80, 0x81, 0x88, 0x8E, 0x8F, 0x86, 0x82, 0x00, 0xBE, 0x47, 0x00, 0xBE,
+    0x47, 0x00, 0x26, 0x39, 0x00, 0x8E, 0x82, 0x00, 0x01, 0x00, 0x8E, 0x20, 0x65, 0x00, 0x02, 0x00,
+    0xBC, 0xBF, 0xBC, 0x3B, 0x00, 0xA0, 0x68, 0x00, 0x01, 0x00, 0x85, 0xBC, 0x3B, 0x00, 0x01, 0x00,
+    0xB5, 0x42, 0x63, 0x00, 0x02, 0x00, 0x8B, 0x91, 0x26, 0x39, 0x00, 0x42, 0x63, 0x00, 0x04, 0x00,
+    0xB7, 0xBA, 0xBE, 0xBF, 0x18, 0x63, 0x00, 0x18, 0x63, 0x00, 0x2A, 0x75, 0x00, 0x5A, 0x66, 0x00,
+    0x02, 0x00, 0x81, 0x82, 0xCA, 0x6D, 0x00, 0x94, 0x82, 0x00, 0x03, 0x00, 0xBA, 0xBE, 0xBF, 0x9C,
+    0x82, 0x00, 0xA0, 0x68, 0x00, 0xAC, 0x63, 0x00, 0x03, 0x00, 0x81, 0x83, 0x84, 0xA4, 0x82, 0x00,
+    0xF0, 0x66, 0x00, 0x12, 0x65, 0x00, 0x02, 0x00, 0xB1, 0xB4, 0x10, 0x6C, 0x00, 0x16, 0x82, 0x00,
+    0x01, 0x00, 0x82, 0xB0, 0x67, 0x00, 0x01, 0x00, 0xBF, 0xAA, 0x82, 0x00, 0x02, 0x00, 0xB4, 0xB5,
+    0xB2, 0x82, 0x00, 0xB8, 0x82, 0x00, 0x02, 0x00, 0x81, 0x82, 0xC2, 0x82, 0x00, 0x58, 0x73, 0x00,
+    0x03, 0x00, 0xB2, 0xB3, 0xBE, 0xE0, 0x67, 0x00, 0xA0, 0x68, 0x00, 0x18, 0x63, 0x00, 0x02, 0x00,
+    0x80, 0x81, 0x20, 0x80, 0x00, 0xE0, 0x67, 0x00, 0x01, 0x00, 0xBE, 0xAC, 0x63, 0x00, 0x01, 0x00,
+    0xBA, 0xBC, 0x3B, 0x00, 0x01, 0x00, 0x86, 0xBC, 0x3B, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE,
+    0x30, 0x7F, 0x00, 0xC8, 0x82, 0x00, 0xD0, 0x82, 0x00, 0x30, 0x7F, 0x00, 0x03, 0x00, 0xB0, 0xB5,
+    0xBE, 0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0x42, 0x63, 0x00, 0x03, 0x00, 0xB0, 0xB5, 0xBC, 0xB0,
+    0x67, 0x00, 0x42, 0x63, 0x00, 0x26, 0x39, 0x00, 0x01, 0x00, 0x80, 0x20, 0x80, 0x00, 0x04, 0x00,
+    0xB1, 0xB3, 0xB4, 0xBD, 0xA0, 0x68, 0x00, 0xD8, 0x82, 0x00, 0x3E, 0x65, 0x00, 0xE2, 0x82, 0x00,
+    0x03, 0x00, 0x80, 0x81, 0x82, 0xE8, 0x82, 0x00, 0x2A, 0x75, 0x00, 0x36, 0x79, 0x00, 0x01, 0x00,
+    0xB5, 0x0A, 0x68, 0x00, 0x04, 0x00, 0xB3, 0xBA, 0xBE, 0xBF, 0xA0, 0x68, 0x00, 0x18, 0x63, 0x00,
+    0xD4, 0x65, 0x00, 0x64, 0x69, 0x00, 0x02, 0x00, 0xB1, 0xBF, 0xA0, 0x68, 0x00, 0xA0, 0x68, 0x00,
+    0x01, 0x00, 0x84, 0x12, 0x65, 0x00, 0x01, 0x00, 0xBE, 0x62, 0x7A, 0x00, 0x03, 0x00, 0xB5, 0xB8,
+    0xBE, 0xEE, 0x82, 0x00, 0xF4, 0x82, 0x00, 0x02, 0x83, 0x00, 0x04, 0x00, 0x8B, 0x8E, 0x8F, 0x91,
+    0x1C, 0x63, 0x00, 0x42, 0x63, 0x00, 0x0C, 0x83, 0x00, 0x38, 0x73, 0x00, 0x01, 0x00, 0x8B, 0x16,
+    0x83, 0x00, 0x01, 0x00, 0xB8, 0x34, 0x49, 0x00, 0x01, 0x00, 0x83, 0x10, 0x82, 0x00, 0x01, 0x00,
+    0x80, 0x14, 0x63, 0x00, 0x01, 0x00, 0xB5, 0x32, 0x65, 0x00, 0x01, 0x00, 0x81, 0x20, 0x82, 0x00,
+    0x02, 0x00, 0xB5, 0xB8, 0xBC, 0x3B, 0x00, 0xBC, 0x3B, 0x00, 0x03, 0x00, 0x8E, 0x8F, 0x91, 0xBC,
+    0x3B, 0x00, 0xBC, 0x3B, 0x00, 0xBC, 0x3B, 0x00, 0x04, 0x00, 0xB1, 0xB3, 0xB4, 0xB8, 0x1E, 0x83,
+    0x00, 0xA0, 0x68, 0x00, 0x12, 0x65, 0x00, 0xEC, 0x7F, 0x00, 0x03, 0x00, 0x81, 0x85, 0x88, 0x18,
+    0x63, 0x00, 0x18, 0x63, 0x00, 0x46, 0x67, 0x00, 0x01, 0x00, 0xBF, 0x22, 0x73, 0x00, 0x03, 0x00,
+    0xB3, 0xB4, 0xBB, 0xFA, 0x62, 0x00, 0x04, 0x65, 0x00, 0xFA, 0x62, 0x00, 0x03, 0x00, 0x80, 0x81,
+    0x85, 0x24, 0x83, 0x00, 0xFA, 0x62, 0x00, 0x6C, 0x63, 0x00, 0x01, 0x00, 0xBD, 0x2E, 0x65, 0x00,
+    0x01, 0x00, 0x80, 0x24, 0x83, 0x00, 0x04, 0x00, 0xB0, 0xB8, 0xBB, 0xBD, 0x14, 0x63, 0x00, 0x14,
+    0x63, 0x00, 0xFA, 0x62, 0x00, 0x42, 0x63, 0x00, 0x01, 0x00, 0x80, 0x28, 0x83, 0x00, 0x04, 0x00,
+    0xB2, 0xB4, 0xBB, 0xBD, 0x9A, 0x64, 0x00, 0xFA, 0x62, 0x00, 0x42, 0x63, 0x00, 0x1A, 0x70, 0x00,
+    0x01, 0x00, 0xB3, 0x20, 0x65, 0x00, 0x03, 0x00, 0xB2, 0xBB, 0xBE, 0x24, 0x65, 0x00, 0x32, 0x83,
+    0x00, 0xF0, 0x63, 0x00, 0x01, 0x00, 0xBE, 0x3A, 0x83, 0x00, 0x01, 0x00, 0xBE, 0x14, 0x63, 0x00,
+    0x03, 0x00, 0xB0, 0xB2, 0xB5, 0x42, 0x7C, 0x00, 0xFA, 0x62, 0x00, 0x40, 0x83, 0x00, 0x02, 0x00,
+    0x8C, 0x91, 0x7A, 0x69, 0x00, 0x40, 0x83, 0x00, 0x06, 0x00, 0xB0, 0xB5, 0xBA, 0xBD, 0xBE, 0xBF,
+    0x14, 0x63, 0x00, 0x14, 0x63, 0x00, 0x46, 0x83, 0x00, 0x42, 0x63, 0x00, 0x14, 0x63, 0x00, 0xFA,
+    0x62, 0x00, 0x04, 0x00, 0x85, 0x87, 0x88, 0x91, 0x42, 0x63, 0x00, 0xFA, 0x62, 0x00, 0x42, 0x63,
+    0x00, 0x14, 0x63, 0x00, 0x02, 0x00, 0x80, 0x8C, 0xFA, 0x62, 0x00, 0xEC, 0x70, 0x00, 0x01, 0x00,
+    0x8C, 0x14, 0x63, 0x00, 0x01, 0x00, 0xB2, 0x9C, 0x6B, 0x00, 0x01, 0x00, 0xB0, 0x50, 0x83, 0x00,
+    0x01, 0x00, 0x8F, 0x42, 0x63, 0x00, 0x02, 0x00, 0xB7, 0xBA, 0x2A, 0x6B, 0x00, 0x18, 0x63, 0x00,
+    0x01, 0x00, 0xBD, 0x42, 0x63, 0x00, 0x02, 0x00, 0xB8, 0xBE, 0x56, 0x83, 0x00, 0x20, 0x65, 0x00,
+    0x01, 0x00, 0xB5, 0x68, 0x75, 0x00, 0x01, 0x00, 0x82, 0x5C, 0x83, 0x00, 0x02, 0x00, 0xBA, 0xBD,
+    0xFA, 0x62, 0x00, 0x42, 0x63, 0x00, 0x01, 0x00, 0x82, 0x62, 0x83, 0x00, 0x04, 0x00, 0xB0, 0xB8,
+    0xBC, 0xBE, 0x6C, 0x83, 0x00, 0x64, 0x6E, 0x00, 0x42, 0x63, 0x00, 0xC6, 0x74, 0x00, 0x01, 0x00,
+    0x80, 0x72, 0x83, 0x00, 0x01, 0x00, 0xBE, 0x7C, 0x83, 0x00, 0x02, 0x00, 0xB0, 0xB5, 0x42, 0x63,
+    0x00, 0x42, 0x63, 0x00, 0x02, 0x00, 0x83, 0x91, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00, 0x02, 0x00,
+    0xB2, 0xB3, 0x18, 0x63, 0x00, 0x84, 0x83, 0x00, 0x01, 0x00, 0xB7, 0x2A, 0x6B, 0x00, 0x01, 0x00,
+    0x81, 0x8A, 0x83, 0x00, 0x01, 0x00, 0xB5, 0x3A, 0x77, 0x00, 0x01, 0x00, 0xB0, 0x14, 0x63, 0x00,
+    0x01, 0x00, 0xB8, 0xD2, 0x80, 0x00, 0x03, 0x00, 0xB5, 0xB8, 0xBE, 0x1C, 0x63, 0x00, 0x92, 0x83,
+    0x00, 0x10, 0x6B, 0x00, 0x02, 0x00, 0x83, 0x8B, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x03, 0x00,
+    0xBA, 0xBC, 0xBE, 0xAC, 0x63, 0x00, 0x2E, 0x65, 0x00, 0x42, 0x63, 0x00, 0x01, 0x00, 0x82, 0x9A,
+    0x83, 0x00, 0x02, 0x00, 0xB5, 0xB8, 0x42, 0x63, 0x00, 0xA4, 0x83, 0x00, 0x02, 0x00, 0xB2, 0xBB,
+    0x42, 0x63, 0x00, 0x42, 0x63, 0x00, 0x01, 0x00, 0x80, 0xAA, 0x83, 0x00, 0x03, 0x00, 0xB3, 0xB8,
+    0xBE, 0xFA, 0x62, 0x00, 0x8C, 0x72, 0x00, 0x1C, 0x63, 0x00, 0x01, 0x00, 0xB4, 0xB0, 0x83, 0x00,
+    0x01, 0x00, 0xB2, 0x24, 0x65, 0x00, 0x03, 0x00, 0xB0, 0xB5, 0xB8, 0x1C, 0x63, 0x00, 0x1C, 0x63,
+    0x00, 0x42, 0x63, 0x00, 0x01, 0x00, 0x8E, 0x1C, 0x63, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE,
+    0x1C, 0x63, 0x00, 0xB6, 0x83, 0x00, 0xBE, 0x83, 0x00, 0x1C, 0x63, 0x00, 0x01, 0x00, 0xBA, 0x24,
+    0x65, 0x00, 0x01, 0x00, 0x82, 0xC6, 0x83, 0x00, 0x02, 0x00, 0xB8, 0xBE, 0x1C, 0x63, 0x00, 0x1C,
+    0x63, 0x00, 0x01, 0x00, 0xB0, 0xDE, 0x6B, 0x00, 0x01, 0x00, 0x80, 0xD0, 0x83, 0x00, 0x02, 0x00,
+    0xB8, 0xBE, 0xDC, 0x83, 0x00, 0x1C, 0x63, 0x00, 0x02, 0x00, 0x83, 0x85, 0x1C, 0x63, 0x00, 0x10,
+    0x6C, 0x00, 0x02, 0x00, 0xBB, 0xBD, 0x24, 0x65, 0x00, 0x42, 0x63, 0x00, 0x02, 0x00, 0xB3, 0xBE,
+    0xD8, 0x75, 0x00, 0x1C, 0x63, 0x00, 0x02, 0x00, 0xB2, 0xBB, 0x24, 0x65, 0x00, 0x24, 0x65, 0x00,
+    0x01, 0x00, 0xB1, 0x0E, 0x78, 0x00, 0x03, 0x00, 0xB0, 0xB8, 0xBE, 0x1C, 0x63, 0x00, 0x1C, 0x63,
+    0x00, 0x1C, 0x63, 0x00, 0x02, 0x00, 0xBA, 0xBB, 0x18, 0x63, 0x00, 0x18, 0x63, 0x00, 0x01, 0x00,
+    0x82, 0xE2, 0x83, 0x00, 0x04, 0x00, 0xB0, 0xB2, 0xB8, 0xBE, 0x1C, 0x63, 0x00, 0x2E, 0x65, 0x00,
+    0xEE, 0x83, 0x00, 0x1C, 0x63, 0x00, 0x04, 0x00, 0x83, 0x8B, 0x8C, 0x8F, 0x1C, 0x63, 0x00, 0x1C,
+    0x63, 0x00, 0xEC, 0x70, 0x00, 0x1C, 0x63, 0x00, 0x01, 0x00, 0xB5, 0x20, 0x65, 0x00, 0x01, 0x00,
+    0x80, 0xF6, 0x83, 0x00, 0x02, 0x00, 0xB5, 0xBE, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x02, 0x00,
+    0x80, 0x83, 0x00, 0x84, 0x00, 0x1C, 0x63, 0x00, 0x02, 0x00, 0x80, 0x83, 0x06, 0x84, 0x00, 0x0C,
+    0x84, 0x00, 0x01, 0x00, 0xB5, 0x26, 0x39, 0x00, 0x02, 0x00, 0xB5, 0xBE, 0x14, 0x63, 0x00, 0x12,
+    0x84, 0x00, 0x03, 0x00, 0xB0, 0xB8, 0xBE, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0xB0, 0x67, 0x00,
+    0x02, 0x00, 0x80, 0x83, 0xBE, 0x6B, 0x00, 0x1C, 0x63, 0x00, 0x02, 0x00, 0x83, 0x87, 0xE4, 0x6B,
+    0x00, 0x42, 0x63, 0x00, 0x05, 0x00, 0xB0, 0xB5, 0xBB, 0xBD, 0xBE, 0x50, 0x83, 0x00, 0x26, 0x39,
+    0x00, 0x18, 0x84, 0x00, 0xFE, 0x68, 0x00, 0x26, 0x39, 0x00, 0x01, 0x00, 0x82, 0xFE, 0x68, 0x00,
+    0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE, 0x1C, 0x63, 0x00, 0x24, 0x84, 0x00, 0x1C, 0x63, 0x00, 0x1C,
+    0x63, 0x00, 0x03, 0x00, 0x81, 0x83, 0x8B, 0xAC, 0x6C, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00,
+    0x04, 0x00, 0xB0, 0xBA, 0xBB, 0xBE, 0xC2, 0x6C, 0x00, 0x2C, 0x84, 0x00, 0x26, 0x39, 0x00, 0x14,
+    0x63, 0x00, 0x01, 0x00, 0x82, 0x38, 0x84, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE, 0x1C, 0x63,
+    0x00, 0x04, 0x6D, 0x00, 0x1C, 0x63, 0x00, 0x0A, 0x6D, 0x00, 0x05, 0x00, 0x80, 0x83, 0x8B, 0x8E,
+    0x8F, 0x18, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00,
+    0x04, 0x00, 0xB0, 0xB2, 0xBB, 0xBE, 0x34, 0x6D, 0x00, 0x3A, 0x6D, 0x00, 0x40, 0x6D, 0x00, 0x44,
+    0x84, 0x00, 0x01, 0x00, 0x80, 0xF2, 0x65, 0x00, 0x01, 0x00, 0x80, 0xC4, 0x35, 0x00, 0x01, 0x00,
+    0x80, 0x4A, 0x84, 0x00, 0x01, 0x00, 0xB8, 0x50, 0x84, 0x00, 0x01, 0x00, 0x8C, 0x54, 0x84, 0x00,
+    0x01, 0x00, 0x82, 0x5A, 0x84, 0x00, 0x01, 0x00, 0x82, 0x60, 0x84, 0x00, 0x01, 0x00, 0xBE, 0x72,
+    0x34, 0x00, 0x01, 0x00, 0xB4, 0x6A, 0x84, 0x00, 0x02, 0x00, 0xB1, 0xB6, 0x70, 0x84, 0x00, 0x76,
+    0x84, 0x00, 0x01, 0x00, 0x82, 0x7C, 0x84, 0x00, 0x01, 0x00, 0x84, 0x72, 0x34, 0x00, 0x01, 0x00,
+    0xBA, 0x82, 0x84, 0x00, 0x02, 0x00, 0xB0, 0xBE, 0x8A, 0x84, 0x00, 0xC4, 0x35, 0x00, 0x02, 0x00,
+    0xB1, 0xBF, 0x90, 0x84, 0x00, 0xD6, 0x34, 0x00, 0x01, 0x00, 0x82, 0x96, 0x84, 0x00, 0x01, 0x00,
+    0xB8, 0x9A, 0x84, 0x00, 0x03, 0x00, 0xB2, 0xBC, 0xBF, 0x7C, 0x84, 0x00, 0x9E, 0x84, 0x00, 0xD6,
+    0x34, 0x00, 0x02, 0x00, 0xB3, 0xBD, 0x50, 0x84, 0x00, 0xD6, 0x34, 0x00, 0x01, 0x00, 0xBD, 0xA4,
+    0x84, 0x00, 0x02, 0x00, 0xBE, 0xBF, 0x72, 0x34, 0x00, 0xAA, 0x84, 0x00, 0x01, 0x00, 0x81, 0xB0,
+    0x84, 0x00, 0x01, 0x00, 0x81, 0xB6, 0x84, 0x00, 0x01, 0x00, 0xB6, 0xBC, 0x84, 0x00, 0x01, 0x00,
+    0xBE, 0xC2, 0x84, 0x00, 0x01, 0x00, 0xBA, 0xC8, 0x84, 0x00, 0x01, 0x00, 0x88, 0xCC, 0x84, 0x00,
+    0x01, 0x00, 0xB2, 0xC4, 0x35, 0x00, 0x02, 0x00, 0x82, 0x88, 0xD6, 0x34, 0x00, 0x96, 0x84, 0x00,
+    0x03, 0x00, 0xB2, 0xB4, 0xB7, 0x34, 0x35, 0x00, 0x60, 0x34, 0x00, 0xD2, 0x84, 0x00, 0x02, 0x00,
+    0x81, 0x82, 0xD6, 0x84, 0x00, 0xD6, 0x34, 0x00, 0x01, 0x00, 0xBA, 0xE0, 0x84, 0x00, 0x02, 0x00,
+    0xBB, 0xBE, 0xE6, 0x84, 0x00, 0xEC, 0x84, 0x00, 0x01, 0x00, 0x80, 0xF2, 0x84, 0x00, 0x01, 0x00,
+    0xBE, 0xF8, 0x84, 0x00, 0x01, 0x00, 0xBD, 0xD6, 0x34, 0x00, 0x02, 0x00, 0xBA, 0xBF, 0xFC, 0x84,
+    0x00, 0x02, 0x85, 0x00, 0x02, 0x00, 0x80, 0x83, 0x0A, 0x85, 0x00, 0x14, 0x85, 0x00, 0x01, 0x00,
+    0xBD, 0x1A, 0x85, 0x00, 0x04, 0x00, 0xB2, 0xB6, 0xB7, 0xBC, 0x96, 0x84, 0x00, 0x96, 0x84, 0x00,
+    0x20, 0x85, 0x00, 0x26, 0x85, 0x00, 0x01, 0x00, 0xBE, 0x2C, 0x85, 0x00, 0x01, 0x00, 0x81, 0x32,
+    0x85, 0x00, 0x03, 0x00, 0xB0, 0xB1, 0xB7, 0x20, 0x85, 0x00, 0xB2, 0x35, 0x00, 0x38, 0x85, 0x00,
+    0x02, 0x00, 0x81, 0x87, 0x8A, 0x84, 0x00, 0x72, 0x34, 0x00, 0x01, 0x00, 0xB7, 0x38, 0x85, 0x00,
+    0x02, 0x00, 0x81, 0x85, 0x3E, 0x85, 0x00, 0x72, 0x34, 0x00, 0x01, 0x00, 0xB1, 0xB2, 0x35, 0x00,
+    0x01, 0x00, 0xBF, 0x44, 0x85, 0x00, 0x01, 0x00, 0xBF, 0x4A, 0x85, 0x00, 0x01, 0x00, 0xB6, 0x72,
+    0x34, 0x00, 0x01, 0x00, 0xBE, 0x50, 0x85, 0x00, 0x03, 0x00, 0xB0, 0xB3, 0xBE, 0x9A, 0x84, 0x00,
+    0x54, 0x85, 0x00, 0x72, 0x34, 0x00, 0x01, 0x00, 0xBD, 0xFC, 0x84, 0x00, 0x01, 0x00, 0x87, 0x72,
+    0x34, 0x00, 0x01, 0x00, 0xB2, 0x72, 0x34, 0x00, 0x01, 0x00, 0x80, 0x72, 0x34, 0x00, 0x01, 0x00,
+    0x80, 0x38, 0x85, 0x00, 0x01, 0x00, 0x81, 0xF6, 0x34, 0x00, 0x00, 0x01, 0x0E, 0x00, 0x01, 0x00,
+    0xD1, 0x5C, 0x85, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x2A, 0x5F, 0x00, 0x62, 0x85, 0x00, 0x01, 0x00,
+    0xD0, 0x68, 0x85, 0x00, 0x00, 0x01, 0x0D, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x01, 0x0A, 0x00,
+    0x01, 0x00, 0xD0, 0x6E, 0x85, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0xAC, 0x3B, 0x00, 0x01, 0x01,
+    0x0A, 0x00, 0xD1, 0x74, 0x85, 0x00, 0x01, 0x00, 0xD0, 0x7E, 0x85, 0x00, 0x01, 0x00, 0xD0, 0x84,
+    0x85, 0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0xD0, 0x8A, 0x85, 0x00, 0x01, 0x01, 0x0C, 0x00,
+    0xD1, 0x90, 0x85, 0x00, 0x01, 0x00, 0xD1, 0x96, 0x85, 0x00, 0x01, 0x00, 0xD0, 0x9C, 0x85, 0x00,
+    0x02, 0x01, 0x0C, 0x00, 0xD0, 0xD1, 0x2E, 0x5C, 0x00, 0x6A, 0x41, 0x00, 0x01, 0x00, 0xD0, 0xAA,
+    0x85, 0x00, 0x01, 0x00, 0xD0, 0xB0, 0x85, 0x00, 0x01, 0x00, 0xD0, 0xB6, 0x85, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x70, 0x41, 0x00, 0xBC, 0x85, 0x00, 0x01, 0x00, 0xD1, 0xC2, 0x85, 0x00, 0x01, 0x00,
+    0xD0, 0xB0, 0x5E, 0x00, 0x01, 0x00, 0xD0, 0xC8, 0x85, 0x00, 0x01, 0x00, 0xD1, 0xCE, 0x85, 0x00,
+    0x02, 0x01, 0x09, 0x00, 0xD0, 0xD1, 0xD4, 0x85, 0x00, 0xDE, 0x85, 0x00, 0x00, 0x01, 0x09, 0x00,
+    0x01, 0x00, 0xD1, 0x9A, 0x36, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xE4, 0x85, 0x00, 0xF2, 0x85, 0x00,
+    0x01, 0x02, 0x18, 0x00, 0xD0, 0xFC, 0x85, 0x00, 0x01, 0x01, 0x0E, 0x00, 0xD0, 0x02, 0x86, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x08, 0x86, 0x00, 0x12, 0x86, 0x00, 0x01, 0x00, 0xD0, 0x18, 0x86, 0x00,
+    0x01, 0x01, 0x0A, 0x00, 0xD0, 0x1E, 0x86, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0x24, 0x86, 0x00,
+    0x01, 0x00, 0xD0, 0x2A, 0x86, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD1, 0x30, 0x86, 0x00, 0x01, 0x00,
+    0xD1, 0x36, 0x86, 0x00, 0x00, 0x01, 0x27, 0x00, 0x01, 0x00, 0xD1, 0x58, 0x51, 0x00, 0x01, 0x00,
+    0xD0, 0x3C, 0x86, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x42, 0x86, 0x00, 0x48, 0x86, 0x00, 0x01, 0x01,
+    0x0C, 0x00, 0xD0, 0x4E, 0x86, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x58, 0x86, 0x00, 0x62, 0x86, 0x00,
+    0x01, 0x00, 0xD1, 0x68, 0x86, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x6E, 0x86, 0x00, 0x74, 0x86, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0xCC, 0x35, 0x00, 0x7A, 0x86, 0x00, 0x01, 0x00, 0xD0, 0x80, 0x86, 0x00,
+    0x01, 0x01, 0x0A, 0x00, 0xD1, 0x86, 0x86, 0x00, 0x01, 0x01, 0x0E, 0x00, 0xD1, 0x8C, 0x86, 0x00,
+    0x01, 0x00, 0xD0, 0x92, 0x86, 0x00, 0x02, 0x01, 0x0C, 0x00, 0xD0, 0xD1, 0x9C, 0x86, 0x00, 0xA2,
+    0x86, 0x00, 0x01, 0x00, 0xD0, 0xA8, 0x86, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD1, 0xB2, 0x86, 0x00,
+    0x01, 0x00, 0xD0, 0xB8, 0x86, 0x00, 0x01, 0x00, 0xD0, 0xBE, 0x86, 0x00, 0x01, 0x00, 0xD1, 0xC4,
+    0x86, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0xCA, 0x86, 0x00, 0x01, 0x00, 0xD0, 0xD4, 0x86, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0xDA, 0x86, 0x00, 0xE0, 0x86, 0x00, 0x00, 0x02, 0xB6, 0x00, 0x01, 0x00,
+    0xD0, 0xE6, 0x86, 0x00, 0x01, 0x00, 0xD0, 0xEC, 0x86, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xF2, 0x86,
+    0x00, 0x04, 0x87, 0x00, 0x01, 0x00, 0xD0, 0x12, 0x87, 0x00, 0x01, 0x00, 0xD0, 0xC0, 0x39, 0x00,
+    0x01, 0x01, 0x0A, 0x00, 0xD0, 0x18, 0x87, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x1E, 0x87, 0x00, 0x28,
+    0x87, 0x00, 0x01, 0x00, 0xD0, 0xD2, 0x56, 0x00, 0x02, 0x01, 0x0A, 0x00, 0xD0, 0xD1, 0x2E, 0x87,
+    0x00, 0x38, 0x87, 0x00, 0x01, 0x00, 0xD0, 0x3E, 0x87, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x4C, 0x87,
+    0x00, 0x52, 0x87, 0x00, 0x01, 0x01, 0x0E, 0x00, 0xD0, 0x6E, 0x85, 0x00, 0x01, 0x00, 0xD0, 0x2E,
+    0x5C, 0x00, 0x01, 0x00, 0xD1, 0x60, 0x87, 0x00, 0x01, 0x01, 0x0E, 0x00, 0xD1, 0x66, 0x87, 0x00,
+    0x00, 0x01, 0x0B, 0x00, 0x00, 0x02, 0x12, 0x00, 0x01, 0x00, 0xD0, 0x6C, 0x87, 0x00, 0x00, 0x01,
+    0x08, 0x00, 0x01, 0x00, 0xD0, 0x72, 0x87, 0x00, 0x01, 0x00, 0xD1, 0xE0, 0x86, 0x00, 0x01, 0x00,
+    0xD1, 0x5A, 0x44, 0x00, 0x01, 0x01, 0x07, 0x00, 0xD1, 0x78, 0x87, 0x00, 0x01, 0x00, 0xD1, 0x7E,
+    0x87, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x84, 0x87, 0x00, 0x2C, 0x38, 0x00, 0x01, 0x00, 0xD0, 0x8A,
+    0x87, 0x00, 0x02, 0x02, 0xDE, 0x00, 0xD0, 0xD1, 0x94, 0x87, 0x00, 0xAA, 0x87, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0xB4, 0x87, 0x00, 0xBE, 0x87, 0x00, 0x01, 0x00, 0xD0, 0xC4, 0x87, 0x00, 0x01, 0x00,
+    0xD0, 0xCA, 0x87, 0x00, 0x02, 0x01, 0x25, 0x00, 0xD0, 0xD1, 0xD0, 0x87, 0x00, 0x5A, 0x44, 0x00,
+    0x01, 0x00, 0xD0, 0xDE, 0x87, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xEC, 0x87, 0x00, 0xF6, 0x87, 0x00,
+    0x01, 0x00, 0xD0, 0x00, 0x88, 0x00, 0x00, 0x02, 0x61, 0x00, 0x03, 0x00, 0x2E, 0xD0, 0xD1, 0x10,
+    0x68, 0x00, 0x0A, 0x88, 0x00, 0x18, 0x88, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x94, 0x42, 0x00, 0x22,
+    0x88, 0x00, 0x01, 0x00, 0xD1, 0x5E, 0x51, 0x00, 0x01, 0x00, 0xD1, 0x28, 0x88, 0x00, 0x01, 0x00,
+    0xD0, 0xF8, 0x45, 0x00, 0x00, 0x02, 0x1C, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x2E, 0x88, 0x00, 0x34,
+    0x88, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x3A, 0x88, 0x00, 0x40, 0x88, 0x00, 0x01, 0x00, 0xD1, 0x4A,
+    0x88, 0x00, 0x01, 0x00, 0xD1, 0x28, 0x87, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x50, 0x88, 0x00, 0x5A,
+    0x88, 0x00, 0x02, 0x01, 0x25, 0x00, 0xD0, 0xD1, 0x72, 0x87, 0x00, 0x60, 0x88, 0x00, 0x01, 0x00,
+    0xD1, 0x60, 0x88, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x66, 0x88, 0x00, 0x80, 0x88, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x96, 0x88, 0x00, 0xA6, 0x36, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xA8, 0x88, 0x00, 0xAE,
+    0x88, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xB4, 0x88, 0x00, 0xC2, 0x88, 0x00, 0x01, 0x01, 0x0A, 0x00,
+    0xD0, 0xC8, 0x88, 0x00, 0x01, 0x02, 0x43, 0x00, 0x2E, 0x10, 0x68, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xCE, 0x88, 0x00, 0xA6, 0x36, 0x00, 0x00, 0x01, 0x95, 0x00, 0x01, 0x00, 0xD0, 0xD8, 0x88, 0x00,
+    0x00, 0x02, 0x18, 0x00, 0x02, 0x01, 0x0E, 0x00, 0xD0, 0xD1, 0xDE, 0x88, 0x00, 0x8C, 0x86, 0x00,
+    0x01, 0x00, 0xD1, 0xE4, 0x88, 0x00, 0x01, 0x00, 0xD0, 0xEE, 0x88, 0x00, 0x01, 0x00, 0xD1, 0xF4,
+    0x88, 0x00, 0x01, 0x00, 0xD1, 0xFA, 0x88, 0x00, 0x01, 0x00, 0xD1, 0xA6, 0x36, 0x00, 0x01, 0x00,
+    0xD1, 0x00, 0x89, 0x00, 0x02, 0x01, 0x26, 0x00, 0xD0, 0xD1, 0x0A, 0x89, 0x00, 0x14, 0x89, 0x00,
+    0x01, 0x00, 0x2E, 0xBE, 0x47, 0x00, 0x01, 0x00, 0xD0, 0x1E, 0x89, 0x00, 0x02, 0x01, 0x26, 0x00,
+    0xD0, 0xD1, 0x24, 0x89, 0x00, 0x2A, 0x89, 0x00, 0x01, 0x00, 0xD1, 0x30, 0x89, 0x00, 0x01, 0x00,
+    0xD0, 0x36, 0x89, 0x00, 0x01, 0x01, 0x09, 0x00, 0xD0, 0x3C, 0x89, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x42, 0x89, 0x00, 0x4C, 0x89, 0x00, 0x01, 0x00, 0xD0, 0x5E, 0x89, 0x00, 0x01, 0x01, 0x26, 0x00,
+    0xD0, 0x68, 0x89, 0x00, 0x01, 0x00, 0xD1, 0x6E, 0x89, 0x00, 0x01, 0x00, 0xD0, 0x78, 0x89, 0x00,
+    0x00, 0x01, 0x20, 0x00, 0x01, 0x00, 0xD1, 0x7E, 0x89, 0x00, 0x01, 0x01, 0x11, 0x00, 0xD0, 0x84,
+    0x89, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x8A, 0x89, 0x00, 0x94, 0x89, 0x00, 0x01, 0x01, 0x0C, 0x00,
+    0xD1, 0xA0, 0x5E, 0x00, 0x01, 0x01, 0x0C, 0x00, 0xD0, 0x9E, 0x89, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xA4, 0x89, 0x00, 0xE2, 0x45, 0x00, 0x00, 0x02, 0x3B, 0x00, 0x01, 0x00, 0xD1, 0xE0, 0x58, 0x00,
+    0x03, 0x00, 0x2E, 0xD0, 0xD1, 0x14, 0x63, 0x00, 0xAA, 0x89, 0x00, 0xB0, 0x89, 0x00, 0x01, 0x02,
+    0x1C, 0x00, 0xD0, 0xB6, 0x89, 0x00, 0x01, 0x01, 0x09, 0x00, 0xD0, 0xBC, 0x89, 0x00, 0x02, 0x01,
+    0x26, 0x00, 0xD0, 0xD1, 0x8A, 0x3C, 0x00, 0x9A, 0x36, 0x00, 0x01, 0x00, 0xD0, 0xC2, 0x89, 0x00,
+    0x01, 0x00, 0xD1, 0xC8, 0x89, 0x00, 0x00, 0x02, 0x5F, 0x00, 0x01, 0x00, 0xD1, 0xCE, 0x89, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0xDC, 0x89, 0x00, 0xEE, 0x89, 0x00, 0x02, 0x01, 0x26, 0x00, 0xD0, 0xD1,
+    0x0E, 0x54, 0x00, 0xF4, 0x89, 0x00, 0x03, 0x00, 0x2E, 0xD0, 0xD1, 0x26, 0x39, 0x00, 0xFA, 0x89,
+    0x00, 0x04, 0x8A, 0x00, 0x02, 0x00, 0x2E, 0xD0, 0x26, 0x39, 0x00, 0x12, 0x8A, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x18, 0x8A, 0x00, 0x2E, 0x8A, 0x00, 0x01, 0x02, 0x1A, 0x00, 0xD1, 0x38, 0x8A, 0x00,
+    0x00, 0x02, 0x1A, 0x00, 0x01, 0x00, 0xD0, 0x12, 0x8A, 0x00, 0x00, 0x02, 0xD7, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x3E, 0x8A, 0x00, 0x48, 0x8A, 0x00, 0x00, 0x02, 0x39, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x4E, 0x8A, 0x00, 0x54, 0x8A, 0x00, 0x00, 0x02, 0x73, 0x00, 0x01, 0x00, 0xD0, 0x5A, 0x8A, 0x00,
+    0x01, 0x00, 0xD0, 0x0E, 0x54, 0x00, 0x01, 0x00, 0xD0, 0x64, 0x8A, 0x00, 0x01, 0x00, 0xD1, 0x6A,
+    0x8A, 0x00, 0x01, 0x00, 0xD0, 0xEA, 0x5D, 0x00, 0x01, 0x00, 0xD0, 0x3A, 0x88, 0x00, 0x01, 0x00,
+    0xD0, 0x70, 0x8A, 0x00, 0x01, 0x00, 0xD1, 0x76, 0x8A, 0x00, 0x01, 0x00, 0xD0, 0x94, 0x42, 0x00,
+    0x00, 0x02, 0x1E, 0x00, 0x01, 0x00, 0xD0, 0x7C, 0x8A, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x82, 0x8A,
+    0x00, 0x9A, 0x36, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x46, 0x3A, 0x00, 0x8C, 0x8A, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x0E, 0x54, 0x00, 0x92, 0x8A, 0x00, 0x03, 0x00, 0x2E, 0xD0, 0xD1, 0x26, 0x39, 0x00,
+    0x98, 0x8A, 0x00, 0xA6, 0x8A, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD1, 0xE2, 0x45, 0x00, 0x03, 0x00,
+    0x2E, 0xD0, 0xD1, 0x26, 0x39, 0x00, 0xB0, 0x5E, 0x00, 0xB0, 0x8A, 0x00, 0x03, 0x00, 0x2E, 0xD0,
+    0xD1, 0x26, 0x39, 0x00, 0xB6, 0x8A, 0x00, 0xCC, 0x8A, 0x00, 0x01, 0x00, 0xD1, 0xCC, 0x8A, 0x00,
+    0x01, 0x00, 0xD0, 0xD2, 0x8A, 0x00, 0x01, 0x00, 0xD0, 0xDC, 0x8A, 0x00, 0x03, 0x00, 0x2E, 0xD0,
+    0xD1, 0x14, 0x63, 0x00, 0xE6, 0x8A, 0x00, 0xF4, 0x8A, 0x00, 0x01, 0x00, 0xD1, 0xFA, 0x8A, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x04, 0x8B, 0x00, 0x0E, 0x8B, 0x00, 0x01, 0x00, 0xD0, 0x18, 0x8B, 0x00,
+    0x01, 0x00, 0xD0, 0x46, 0x3A, 0x00, 0x01, 0x01, 0x07, 0x00, 0xD0, 0x22, 0x8B, 0x00, 0x01, 0x00,
+    0xD0, 0x2C, 0x8B, 0x00, 0x01, 0x00, 0xD0, 0x32, 0x8B, 0x00, 0x01, 0x00, 0xD1, 0x12, 0x86, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x48, 0x8B, 0x00, 0xC6, 0x39, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x52, 0x8B,
+    0x00, 0x5C, 0x8B, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x62, 0x8B, 0x00, 0x74, 0x8B, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x7E, 0x8B, 0x00, 0x94, 0x8B, 0x00, 0x01, 0x00, 0xD0, 0x96, 0x4F, 0x00, 0x01, 0x00,
+    0xD0, 0x9E, 0x8B, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xA4, 0x8B, 0x00, 0xAE, 0x8B, 0x00, 0x00, 0x01,
+    0x16, 0x00, 0x01, 0x00, 0xD1, 0xB4, 0x8B, 0x00, 0x01, 0x01, 0x07, 0x00, 0xD0, 0x24, 0x89, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0xBA, 0x8B, 0x00, 0x5A, 0x44, 0x00, 0x01, 0x00, 0xD1, 0xC0, 0x8B, 0x00,
+    0x02, 0x01, 0x26, 0x00, 0xD0, 0xD1, 0xC6, 0x8B, 0x00, 0xD4, 0x8B, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xDE, 0x8B, 0x00, 0xE8, 0x8B, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xEE, 0x8B, 0x00, 0xF4, 0x8B, 0x00,
+    0x01, 0x00, 0xD1, 0xFA, 0x8B, 0x00, 0x02, 0x01, 0x25, 0x00, 0xD0, 0xD1, 0x00, 0x8C, 0x00, 0x0E,
+    0x8C, 0x00, 0x01, 0x00, 0xD0, 0x14, 0x8C, 0x00, 0x01, 0x00, 0xD0, 0x1A, 0x8C, 0x00, 0x01, 0x00,
+    0xD0, 0x20, 0x8C, 0x00, 0x01, 0x00, 0xD0, 0xFC, 0x85, 0x00, 0x01, 0x00, 0xD0, 0x2A, 0x8C, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x30, 0x8C, 0x00, 0x5A, 0x44, 0x00, 0x01, 0x00, 0xD0, 0x30, 0x46, 0x00,
+    0x00, 0x02, 0x30, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x3A, 0x8C, 0x00, 0x48, 0x8C, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x52, 0x8C, 0x00, 0x5C, 0x8C, 0x00, 0x02, 0x01, 0x09, 0x00, 0xD0, 0xD1, 0xAA, 0x85,
+    0x00, 0x6A, 0x8C, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x70, 0x8C, 0x00, 0x76, 0x8C, 0x00, 0x01, 0x00,
+    0xD1, 0x7C, 0x8C, 0x00, 0x01, 0x00, 0xD0, 0xCA, 0x53, 0x00, 0x01, 0x00, 0xD0, 0x86, 0x8C, 0x00,
+    0x02, 0x03, 0xCF, 0x00, 0xD0, 0xD1, 0x90, 0x8C, 0x00, 0xF4, 0x88, 0x00, 0x01, 0x00, 0xD1, 0x96,
+    0x8C, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x9C, 0x8C, 0x00, 0xA6, 0x8C, 0x00, 0x01, 0x00, 0xD0, 0xAC,
+    0x8C, 0x00, 0x01, 0x02, 0x1C, 0x00, 0xD0, 0xEA, 0x5D, 0x00, 0x01, 0x01, 0x07, 0x00, 0xD0, 0xB6,
+    0x8C, 0x00, 0x01, 0x00, 0xD0, 0xBC, 0x8C, 0x00, 0x02, 0x01, 0x09, 0x00, 0xD0, 0xD1, 0xC2, 0x8C,
+    0x00, 0xC8, 0x8C, 0x00, 0x01, 0x00, 0xD1, 0xCE, 0x8C, 0x00, 0x01, 0x01, 0x07, 0x00, 0xD0, 0xD4,
+    0x8C, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xE6, 0x8C, 0x00, 0xF0, 0x8C, 0x00, 0x01, 0x00, 0xD0, 0xFE,
+    0x8C, 0x00, 0x01, 0x00, 0xD0, 0x04, 0x8D, 0x00, 0x01, 0x00, 0xD1, 0x0E, 0x8C, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x12, 0x8D, 0x00, 0x24, 0x8D, 0x00, 0x02, 0x01, 0x0A, 0x00, 0xD0, 0xD1, 0x3A, 0x8D,
+    0x00, 0x54, 0x8D, 0x00, 0x02, 0x01, 0x0A, 0x00, 0xD0, 0xD1, 0x5A, 0x8D, 0x00, 0xA6, 0x36, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x68, 0x8D, 0x00, 0x8A, 0x8D, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x98, 0x8D,
+    0x00, 0xA4, 0x5F, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0xAA, 0x8D, 0x00, 0x02, 0x01, 0x0A, 0x00,
+    0xD0, 0xD1, 0xB4, 0x8D, 0x00, 0xA6, 0x36, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0xBE, 0x8D, 0x00,
+    0x01, 0x01, 0x09, 0x00, 0xD0, 0xEA, 0x5D, 0x00, 0x01, 0x02, 0x1A, 0x00, 0xD0, 0xD4, 0x86, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0xD0, 0x8D, 0x00, 0xDA, 0x8D, 0x00, 0x01, 0x00, 0xD1, 0xE0, 0x8D, 0x00,
+    0x01, 0x00, 0xD1, 0xE6, 0x8D, 0x00, 0x01, 0x00, 0xD0, 0xEC, 0x8D, 0x00, 0x01, 0x01, 0x0C, 0x00,
+    0xD1, 0xE0, 0x86, 0x00, 0x01, 0x00, 0xD0, 0x82, 0x60, 0x00, 0x00, 0x03, 0xB3, 0x00, 0x01, 0x01,
+    0x26, 0x00, 0xD1, 0x8C, 0x8A, 0x00, 0x01, 0x01, 0x0E, 0x00, 0xD0, 0xF2, 0x8D, 0x00, 0x01, 0x00,
+    0xD0, 0xFC, 0x8D, 0x00, 0x01, 0x00, 0xD1, 0x7C, 0x44, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x02, 0x8E,
+    0x00, 0x14, 0x8E, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD1, 0x22, 0x8E, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x28, 0x8E, 0x00, 0x2E, 0x8E, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0x34, 0x8E, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x3A, 0x8E, 0x00, 0x48, 0x8E, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0xC8, 0x85, 0x00,
+    0x01, 0x00, 0xD1, 0x90, 0x85, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x4E, 0x8E, 0x00, 0x6A, 0x41, 0x00,
+    0x01, 0x00, 0xD0, 0x60, 0x8E, 0x00, 0x00, 0x02, 0x45, 0x00, 0x01, 0x00, 0xD0, 0x70, 0x41, 0x00,
+    0x01, 0x01, 0x0E, 0x00, 0xD0, 0x4C, 0x87, 0x00, 0x01, 0x00, 0xD0, 0x6A, 0x8E, 0x00, 0x01, 0x00,
+    0xD0, 0x70, 0x8E, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x76, 0x8E, 0x00, 0x7C, 0x8E, 0x00, 0x01, 0x00,
+    0xD1, 0x8A, 0x8E, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x90, 0x8E, 0x00, 0x9E, 0x8E, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0xA8, 0x8E, 0x00, 0xE0, 0x86, 0x00, 0x01, 0x02, 0x1C, 0x00, 0xD1, 0xAE, 0x8E, 0x00,
+    0x01, 0x00, 0xD0, 0xB4, 0x8E, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xBE, 0x8E, 0x00, 0xC4, 0x8E, 0x00,
+    0x01, 0x00, 0xD0, 0xCA, 0x8E, 0x00, 0x01, 0x00, 0xD1, 0xC4, 0x8E, 0x00, 0x01, 0x00, 0xD1, 0xD0,
+    0x8E, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xD6, 0x8E, 0x00, 0xE8, 0x8E, 0x00, 0x01, 0x00, 0xD1, 0xF6,
+    0x8E, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xFC, 0x8E, 0x00, 0x0A, 0x8F, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xD8, 0x88, 0x00, 0x4C, 0x3E, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0x18, 0x8F, 0x00, 0x01, 0x02,
+    0x1A, 0x00, 0xD0, 0xC8, 0x85, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x1E, 0x8F, 0x00, 0x24, 0x8F, 0x00,
+    0x01, 0x01, 0x0A, 0x00, 0xD1, 0x2A, 0x8F, 0x00, 0x01, 0x00, 0xD0, 0x30, 0x8F, 0x00, 0x01, 0x00,
+    0xD1, 0x3A, 0x8F, 0x00, 0x01, 0x00, 0xD0, 0x40, 0x8F, 0x00, 0x01, 0x00, 0xD1, 0x0C, 0x3D, 0x00,
+    0x01, 0x00, 0xD0, 0xA8, 0x88, 0x00, 0x01, 0x02, 0x23, 0x00, 0xD1, 0x46, 0x8F, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x4C, 0x8F, 0x00, 0x52, 0x8F, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0x58, 0x8F, 0x00,
+    0x00, 0x02, 0x23, 0x00, 0x03, 0x00, 0x2E, 0xD0, 0xD1, 0x1C, 0x63, 0x00, 0x66, 0x8F, 0x00, 0x74,
+    0x8F, 0x00, 0x03, 0x00, 0x2E, 0xD0, 0xD1, 0x1C, 0x63, 0x00, 0x7E, 0x8F, 0x00, 0x8C, 0x8F, 0x00,
+    0x02, 0x01, 0x09, 0x00, 0xD0, 0xD1, 0x92, 0x8F, 0x00, 0xA0, 0x8F, 0x00, 0x01, 0x00, 0xD0, 0xAA,
+    0x8F, 0x00, 0x02, 0x01, 0x09, 0x00, 0xD0, 0xD1, 0xB0, 0x8F, 0x00, 0xC2, 0x8F, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0xEA, 0x40, 0x00, 0xCC, 0x8F, 0x00, 0x01, 0x00, 0xD1, 0xD2, 0x8F, 0x00, 0x01, 0x00,
+    0xD1, 0xD8, 0x8F, 0x00, 0x02, 0x01, 0x11, 0x00, 0xD0, 0xD1, 0xDE, 0x8F, 0x00, 0xEC, 0x8F, 0x00,
+    0x00, 0x02, 0x9B, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0xFA, 0x8F, 0x00, 0x02, 0x01, 0x11, 0x00,
+    0xD0, 0xD1, 0x00, 0x90, 0x00, 0x06, 0x90, 0x00, 0x03, 0x01, 0x0A, 0x00, 0x2E, 0xD0, 0xD1, 0x14,
+    0x63, 0x00, 0x0C, 0x90, 0x00, 0x1E, 0x90, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0x28, 0x90, 0x00,
+    0x02, 0x01, 0x0A, 0x00, 0xD0, 0xD1, 0x2E, 0x90, 0x00, 0x40, 0x90, 0x00, 0x01, 0x00, 0xD0, 0xBC,
+    0x89, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0x46, 0x90, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0x4C,
+    0x90, 0x00, 0x00, 0x02, 0x14, 0x00, 0x02, 0x01, 0x0A, 0x00, 0xD0, 0xD1, 0x56, 0x90, 0x00, 0x64,
+    0x90, 0x00, 0x02, 0x01, 0x0C, 0x00, 0xD0, 0xD1, 0x6A, 0x90, 0x00, 0x44, 0x5F, 0x00, 0x00, 0x02,
+    0xC4, 0x00, 0x02, 0x01, 0x0C, 0x00, 0xD0, 0xD1, 0x78, 0x90, 0x00, 0x1A, 0x41, 0x00, 0x02, 0x01,
+    0x0A, 0x00, 0xD0, 0xD1, 0x82, 0x90, 0x00, 0x3A, 0x36, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x8C, 0x90,
+    0x00, 0x06, 0x90, 0x00, 0x01, 0x00, 0xD1, 0x9A, 0x90, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD1, 0x3A,
+    0x8F, 0x00, 0x01, 0x01, 0x07, 0x00, 0xD1, 0xF6, 0x8E, 0x00, 0x01, 0x01, 0x0C, 0x00, 0xD1, 0x30,
+    0x89, 0x00, 0x01, 0x00, 0xD0, 0xA0, 0x90, 0x00, 0x01, 0x00, 0xD0, 0xA6, 0x90, 0x00, 0x01, 0x00,
+    0xD0, 0x00, 0x90, 0x00, 0x01, 0x00, 0xD1, 0xAC, 0x90, 0x00, 0x01, 0x00, 0xD0, 0xB2, 0x90, 0x00,
+    0x01, 0x00, 0xD0, 0xB8, 0x90, 0x00, 0x01, 0x00, 0xD0, 0xBE, 0x90, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x00, 0x90, 0x00, 0x28, 0x87, 0x00, 0x01, 0x00, 0xD1, 0xC8, 0x90, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x46, 0x3A, 0x00, 0x5A, 0x44, 0x00, 0x01, 0x00, 0xD0, 0xCE, 0x90, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xA4, 0x89, 0x00, 0xDA, 0x52, 0x00, 0x01, 0x00, 0xD0, 0xD4, 0x90, 0x00, 0x02, 0x01, 0x11, 0x00,
+    0xD0, 0xD1, 0xE2, 0x90, 0x00, 0xE8, 0x90, 0x00, 0x00, 0x02, 0xC2, 0x00, 0x01, 0x00, 0xD0, 0xEE,
+    0x90, 0x00, 0x01, 0x02, 0x1C, 0x00, 0xD0, 0xBC, 0x89, 0x00, 0x01, 0x01, 0x11, 0x00, 0xD0, 0xE4,
+    0x40, 0x00, 0x01, 0x00, 0xD1, 0x22, 0x8E, 0x00, 0x00, 0x04, 0xBE, 0x00, 0x01, 0x01, 0x20, 0x00,
+    0xD1, 0x3A, 0x8F, 0x00, 0x01, 0x00, 0xD1, 0xF8, 0x90, 0x00, 0x01, 0x00, 0xD1, 0xC6, 0x39, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x02, 0x91, 0x00, 0x08, 0x91, 0x00, 0x01, 0x00, 0xD0, 0x0E, 0x91, 0x00,
+    0x01, 0x00, 0xD1, 0xAE, 0x8B, 0x00, 0x01, 0x00, 0xD0, 0x14, 0x91, 0x00, 0x02, 0x02, 0x39, 0x00,
+    0xD0, 0xD1, 0x1A, 0x91, 0x00, 0xF4, 0x88, 0x00, 0x01, 0x00, 0xD0, 0x20, 0x91, 0x00, 0x01, 0x00,
+    0xD0, 0x26, 0x91, 0x00, 0x01, 0x01, 0x09, 0x00, 0xD1, 0x92, 0x8A, 0x00, 0x01, 0x01, 0x09, 0x00,
+    0xD0, 0x34, 0x91, 0x00, 0x01, 0x00, 0xD1, 0x3A, 0x91, 0x00, 0x03, 0x00, 0x2E, 0xD0, 0xD1, 0x10,
+    0x68, 0x00, 0x40, 0x91, 0x00, 0x4E, 0x91, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0x54, 0x91, 0x00,
+    0x01, 0x00, 0xD0, 0x5A, 0x91, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0x60, 0x91, 0x00, 0x01, 0x01,
+    0x26, 0x00, 0xD1, 0x6A, 0x91, 0x00, 0x01, 0x00, 0xD0, 0x70, 0x91, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xD4, 0x86, 0x00, 0x1A, 0x41, 0x00, 0x01, 0x00, 0xD1, 0x86, 0x86, 0x00, 0x01, 0x00, 0xD0, 0x76,
+    0x91, 0x00, 0x01, 0x00, 0x2E, 0xBC, 0x3B, 0x00, 0x01, 0x00, 0xD0, 0x7C, 0x91, 0x00, 0x01, 0x00,
+    0xD1, 0x8A, 0x91, 0x00, 0x01, 0x00, 0xD0, 0x84, 0x87, 0x00, 0x01, 0x01, 0x0B, 0x00, 0xD0, 0x90,
+    0x91, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x96, 0x91, 0x00, 0x3E, 0x38, 0x00, 0x03, 0x00, 0x2E, 0xD0,
+    0xD1, 0x26, 0x39, 0x00, 0xA0, 0x91, 0x00, 0xB6, 0x91, 0x00, 0x01, 0x00, 0xD0, 0xC8, 0x91, 0x00,
+    0x01, 0x01, 0x26, 0x00, 0xD0, 0xD2, 0x91, 0x00, 0x02, 0x00, 0x2E, 0xD1, 0xBE, 0x47, 0x00, 0x8C,
+    0x8F, 0x00, 0x01, 0x02, 0x7A, 0x00, 0xD0, 0xD8, 0x91, 0x00, 0x02, 0x02, 0x5F, 0x00, 0x2E, 0xD0,
+    0xBE, 0x47, 0x00, 0xE2, 0x91, 0x00, 0x01, 0x01, 0x26, 0x00, 0xD1, 0x22, 0x8E, 0x00, 0x02, 0x01,
+    0x26, 0x00, 0xD0, 0xD1, 0xE8, 0x91, 0x00, 0xF4, 0x4A, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xEE, 0x91,
+    0x00, 0x3E, 0x38, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xF8, 0x91, 0x00, 0x02, 0x92, 0x00, 0x01, 0x01,
+    0x09, 0x00, 0xD0, 0x08, 0x92, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x12, 0x92, 0x00, 0x24, 0x92, 0x00,
+    0x01, 0x01, 0x09, 0x00, 0xD0, 0xAA, 0x85, 0x00, 0x02, 0x01, 0x0A, 0x00, 0xD0, 0xD1, 0xA4, 0x89,
+    0x00, 0x2E, 0x92, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xB0, 0x5E, 0x00, 0x8C, 0x8F, 0x00, 0x01, 0x01,
+    0x0A, 0x00, 0xD1, 0x38, 0x92, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x3E, 0x92, 0x00, 0x44, 0x92, 0x00,
+    0x01, 0x01, 0x07, 0x00, 0xD0, 0x82, 0x60, 0x00, 0x00, 0x03, 0xB8, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x4A, 0x92, 0x00, 0x54, 0x92, 0x00, 0x01, 0x01, 0x0C, 0x00, 0xD1, 0x5A, 0x44, 0x00, 0x01, 0x00,
+    0xD0, 0x5A, 0x92, 0x00, 0x01, 0x00, 0xD0, 0x60, 0x92, 0x00, 0x01, 0x00, 0xD0, 0x66, 0x92, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x82, 0x60, 0x00, 0x6C, 0x92, 0x00, 0x01, 0x01, 0x09, 0x00, 0xD1, 0x3E,
+    0x38, 0x00, 0x01, 0x00, 0xD0, 0x04, 0x8B, 0x00, 0x01, 0x00, 0xD0, 0x76, 0x92, 0x00, 0x01, 0x00,
+    0xD0, 0x7C, 0x92, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x86, 0x92, 0x00, 0x8C, 0x92, 0x00, 0x01, 0x00,
+    0xD1, 0x92, 0x92, 0x00, 0x01, 0x01, 0x0C, 0x00, 0xD0, 0x04, 0x8B, 0x00, 0x01, 0x01, 0x11, 0x00,
+    0xD0, 0x9C, 0x92, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xA2, 0x92, 0x00, 0xAC, 0x92, 0x00, 0x01, 0x00,
+    0xD0, 0xBE, 0x92, 0x00, 0x01, 0x00, 0xD0, 0xC4, 0x92, 0x00, 0x01, 0x00, 0xD0, 0xCA, 0x92, 0x00,
+    0x01, 0x01, 0x0E, 0x00, 0xD0, 0xD0, 0x92, 0x00, 0x01, 0x00, 0xD0, 0xD6, 0x92, 0x00, 0x01, 0x00,
+    0xD0, 0xDC, 0x92, 0x00, 0x01, 0x00, 0xD0, 0xE2, 0x92, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0xB8,
+    0x5C, 0x00, 0x01, 0x02, 0x14, 0x00, 0xD1, 0x90, 0x85, 0x00, 0x01, 0x00, 0xD0, 0xE8, 0x92, 0x00,
+    0x01, 0x00, 0xD1, 0xA0, 0x5E, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x1E, 0x8F, 0x00, 0xF2, 0x92, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0xF8, 0x92, 0x00, 0xFE, 0x92, 0x00, 0x01, 0x00, 0xD0, 0x04, 0x93, 0x00,
+    0x01, 0x00, 0xD1, 0x0A, 0x93, 0x00, 0x01, 0x00, 0xD0, 0x46, 0x90, 0x00, 0x01, 0x01, 0x11, 0x00,
+    0xD1, 0x92, 0x8A, 0x00, 0x01, 0x00, 0xD0, 0x10, 0x93, 0x00, 0x01, 0x01, 0x11, 0x00, 0xD0, 0xD4,
+    0x86, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x16, 0x93, 0x00, 0x3A, 0x8F, 0x00, 0x02, 0x01, 0x09, 0x00,
+    0xD0, 0xD1, 0x20, 0x93, 0x00, 0x26, 0x93, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0x84, 0x85, 0x00,
+    0x01, 0x01, 0x0A, 0x00, 0xD0, 0x6E, 0x85, 0x00, 0x01, 0x00, 0xD1, 0x8C, 0x8F, 0x00, 0x01, 0x00,
+    0xD0, 0x4C, 0x87, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0x30, 0x93, 0x00, 0x02, 0x01, 0x0A, 0x00,
+    0xD0, 0xD1, 0x2A, 0x5F, 0x00, 0x28, 0x87, 0x00, 0x01, 0x00, 0xD0, 0x36, 0x93, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x44, 0x93, 0x00, 0x8C, 0x8F, 0x00, 0x01, 0x00, 0xD0, 0x52, 0x93, 0x00, 0x01, 0x00,
+    0xD1, 0x58, 0x93, 0x00, 0x01, 0x00, 0xD1, 0x62, 0x93, 0x00, 0x01, 0x00, 0xD0, 0x6C, 0x93, 0x00,
+    0x01, 0x00, 0xD0, 0x72, 0x93, 0x00, 0x02, 0x01, 0x07, 0x00, 0xD0, 0xD1, 0x78, 0x93, 0x00, 0x8A,
+    0x93, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x90, 0x93, 0x00, 0x96, 0x93, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xD0, 0x92, 0x00, 0x78, 0x87, 0x00, 0x01, 0x00, 0xD1, 0x9C, 0x93, 0x00, 0x01, 0x00, 0xD1, 0xA2,
+    0x93, 0x00, 0x02, 0x01, 0x0A, 0x00, 0xD0, 0xD1, 0xA8, 0x93, 0x00, 0xB2, 0x93, 0x00, 0x01, 0x00,
+    0xD0, 0xB8, 0x93, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xBE, 0x93, 0x00, 0x28, 0x87, 0x00, 0x01, 0x02,
+    0x12, 0x00, 0xD0, 0xCC, 0x93, 0x00, 0x01, 0x00, 0xD1, 0xD6, 0x93, 0x00, 0x01, 0x00, 0xD1, 0xDC,
+    0x93, 0x00, 0x01, 0x01, 0x07, 0x00, 0xD1, 0x62, 0x85, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xE6, 0x93,
+    0x00, 0xEC, 0x93, 0x00, 0x01, 0x00, 0xD0, 0xF2, 0x93, 0x00, 0x01, 0x02, 0x14, 0x00, 0xD0, 0xF8,
+    0x93, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xFE, 0x93, 0x00, 0x06, 0x90, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xAA, 0x85, 0x00, 0x08, 0x94, 0x00, 0x01, 0x01, 0x0E, 0x00, 0xD0, 0x1A, 0x91, 0x00, 0x01, 0x00,
+    0xD0, 0x0E, 0x94, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x18, 0x94, 0x00, 0x1E, 0x94, 0x00, 0x00, 0x02,
+    0x21, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x46, 0x3A, 0x00, 0x16, 0x50, 0x00, 0x02, 0x01, 0x11, 0x00,
+    0xD0, 0xD1, 0x24, 0x94, 0x00, 0xE0, 0x86, 0x00, 0x01, 0x00, 0xD0, 0x2A, 0x94, 0x00, 0x03, 0x00,
+    0x2E, 0xD0, 0xD1, 0xBE, 0x47, 0x00, 0x3C, 0x3B, 0x00, 0x14, 0x54, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x34, 0x94, 0x00, 0x3A, 0x94, 0x00, 0x01, 0x00, 0xD1, 0x40, 0x94, 0x00, 0x01, 0x02, 0x39, 0x00,
+    0xD1, 0x2C, 0x38, 0x00, 0x01, 0x01, 0x26, 0x00, 0xD1, 0xF4, 0x8B, 0x00, 0x01, 0x00, 0xD1, 0xF2,
+    0x92, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xA4, 0x89, 0x00, 0x46, 0x94, 0x00, 0x01, 0x00, 0xD0, 0x54,
+    0x91, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x24, 0x89, 0x00, 0x50, 0x94, 0x00, 0x01, 0x01, 0x07, 0x00,
+    0xD1, 0x56, 0x94, 0x00, 0x02, 0x00, 0x2E, 0xD1, 0x10, 0x68, 0x00, 0x5C, 0x94, 0x00, 0x02, 0x00,
+    0x2E, 0xD0, 0x10, 0x68, 0x00, 0x62, 0x94, 0x00, 0x03, 0x00, 0x2E, 0xD0, 0xD1, 0x10, 0x68, 0x00,
+    0x70, 0x94, 0x00, 0x7E, 0x94, 0x00, 0x03, 0x00, 0x2E, 0xD0, 0xD1, 0x10, 0x68, 0x00, 0x88, 0x94,
+    0x00, 0x92, 0x94, 0x00, 0x01, 0x00, 0xD0, 0x18, 0x87, 0x00, 0x01, 0x01, 0x26, 0x00, 0x2E, 0x10,
+    0x68, 0x00, 0x03, 0x00, 0x2E, 0xD0, 0xD1, 0x26, 0x39, 0x00, 0x9C, 0x94, 0x00, 0xA2, 0x94, 0x00,
+    0x01, 0x00, 0xD0, 0xA8, 0x94, 0x00, 0x01, 0x00, 0xD0, 0xAE, 0x94, 0x00, 0x01, 0x00, 0xD1, 0xB4,
+    0x94, 0x00, 0x01, 0x01, 0x26, 0x00, 0xD0, 0xBA, 0x94, 0x00, 0x01, 0x01, 0x26, 0x00, 0xD1, 0x9A,
+    0x36, 0x00, 0x01, 0x00, 0xD1, 0xC0, 0x94, 0x00, 0x01, 0x00, 0xD0, 0xC6, 0x94, 0x00, 0x01, 0x00,
+    0xD1, 0xCC, 0x94, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xD2, 0x94, 0x00, 0x28, 0x87, 0x00, 0x01, 0x01,
+    0x26, 0x00, 0xD0, 0xD8, 0x94, 0x00, 0x01, 0x00, 0xD0, 0xE6, 0x94, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xEC, 0x94, 0x00, 0xF6, 0x94, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x00, 0x95, 0x00, 0x12, 0x95, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x1C, 0x95, 0x00, 0x32, 0x95, 0x00, 0x01, 0x00, 0xD0, 0x4C, 0x95, 0x00,
+    0x01, 0x00, 0xD0, 0x52, 0x95, 0x00, 0x01, 0x00, 0xD0, 0x9E, 0x89, 0x00, 0x01, 0x00, 0xD0, 0x58,
+    0x95, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x66, 0x95, 0x00, 0x74, 0x95, 0x00, 0x01, 0x00, 0xD0, 0x7E,
+    0x95, 0x00, 0x02, 0x00, 0x2E, 0xD1, 0xC8, 0x67, 0x00, 0x3A, 0x8F, 0x00, 0x01, 0x00, 0xD1, 0x84,
+    0x95, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xD8, 0x88, 0x00, 0xE0, 0x86, 0x00, 0x01, 0x01, 0x26, 0x00,
+    0xD0, 0x6E, 0x85, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xDE, 0x88, 0x00, 0x2C, 0x38, 0x00, 0x01, 0x01,
+    0x26, 0x00, 0xD1, 0x66, 0x87, 0x00, 0x01, 0x00, 0xD0, 0x6E, 0x3A, 0x00, 0x01, 0x00, 0xD1, 0x8A,
+    0x95, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x94, 0x95, 0x00, 0xE0, 0x86, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x9E, 0x95, 0x00, 0x5A, 0x44, 0x00, 0x01, 0x00, 0xD0, 0xA4, 0x95, 0x00, 0x01, 0x01, 0x11, 0x00,
+    0xD1, 0x60, 0x88, 0x00, 0x02, 0x00, 0x2E, 0xD0, 0xBE, 0x47, 0x00, 0xAA, 0x95, 0x00, 0x01, 0x00,
+    0xD1, 0xB0, 0x95, 0x00, 0x01, 0x00, 0xD1, 0xF4, 0x8B, 0x00, 0x01, 0x01, 0x0B, 0x00, 0xD1, 0xF4,
+    0x4A, 0x00, 0x01, 0x00, 0xD0, 0xB6, 0x95, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x0E, 0x54, 0x00, 0xBC,
+    0x95, 0x00, 0x01, 0x00, 0xD0, 0x34, 0x94, 0x00, 0x01, 0x00, 0xD0, 0xC2, 0x95, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0xCC, 0x95, 0x00, 0x9A, 0x36, 0x00, 0x01, 0x00, 0xD0, 0xE2, 0x91, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0xD2, 0x95, 0x00, 0xA2, 0x41, 0x00, 0x01, 0x00, 0xD0, 0xD8, 0x95, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x8A, 0x3C, 0x00, 0xF4, 0x8B, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xEA, 0x95, 0x00, 0xF0,
+    0x95, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x0E, 0x91, 0x00, 0x52, 0x8F, 0x00, 0x01, 0x00, 0xD0, 0xF6,
+    0x95, 0x00, 0x01, 0x00, 0xD0, 0xFC, 0x95, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x06, 0x96, 0x00, 0x9A,
+    0x36, 0x00, 0x01, 0x00, 0xD0, 0x10, 0x96, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x46, 0x3A, 0x00, 0xF4,
+    0x8B, 0x00, 0x01, 0x00, 0xD0, 0x16, 0x96, 0x00, 0x01, 0x00, 0xD0, 0x24, 0x96, 0x00, 0x01, 0x00,
+    0xD0, 0x8A, 0x3C, 0x00, 0x01, 0x00, 0xD0, 0x2E, 0x96, 0x00, 0x01, 0x00, 0xD0, 0x38, 0x96, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x3E, 0x96, 0x00, 0x28, 0x87, 0x00, 0x01, 0x00, 0xD0, 0x48, 0x96, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x1E, 0x89, 0x00, 0x60, 0x88, 0x00, 0x01, 0x00, 0xD1, 0x52, 0x96, 0x00,
+    0x01, 0x00, 0xD0, 0x58, 0x96, 0x00, 0x01, 0x00, 0xD0, 0x02, 0x91, 0x00, 0x01, 0x00, 0xD0, 0x5E,
+    0x96, 0x00, 0x01, 0x01, 0x07, 0x00, 0xD0, 0x64, 0x96, 0x00, 0x01, 0x00, 0xD1, 0x66, 0x87, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x24, 0x86, 0x00, 0x6A, 0x96, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x70, 0x96,
+    0x00, 0x7A, 0x96, 0x00, 0x01, 0x00, 0xD1, 0x84, 0x96, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x8A, 0x96,
+    0x00, 0xF0, 0x95, 0x00, 0x01, 0x00, 0xD0, 0xCC, 0x95, 0x00, 0x01, 0x00, 0xD0, 0x94, 0x96, 0x00,
+    0x01, 0x00, 0xD0, 0xF6, 0x40, 0x00, 0x01, 0x01, 0x25, 0x00, 0xD0, 0x9A, 0x96, 0x00, 0x01, 0x00,
+    0xD1, 0xA0, 0x96, 0x00, 0x01, 0x00, 0xD0, 0xAA, 0x96, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xB0, 0x96,
+    0x00, 0xB6, 0x96, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xBC, 0x96, 0x00, 0xE0, 0x86, 0x00, 0x01, 0x01,
+    0x25, 0x00, 0xD1, 0xE0, 0x4C, 0x00, 0x01, 0x01, 0x0E, 0x00, 0xD1, 0xC2, 0x96, 0x00, 0x01, 0x00,
+    0xD0, 0xC8, 0x96, 0x00, 0x01, 0x00, 0xD0, 0xCE, 0x96, 0x00, 0x01, 0x00, 0xD0, 0xD8, 0x96, 0x00,
+    0x01, 0x00, 0xD0, 0xE2, 0x96, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x24, 0x89, 0x00, 0xE8, 0x96, 0x00,
+    0x01, 0x00, 0xD0, 0xEE, 0x96, 0x00, 0x01, 0x00, 0xD1, 0x3A, 0x94, 0x00, 0x01, 0x00, 0xD0, 0xF4,
+    0x96, 0x00, 0x01, 0x00, 0xD1, 0x02, 0x97, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x08, 0x97, 0x00, 0x5A,
+    0x44, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xEE, 0x8B, 0x00, 0x12, 0x97, 0x00, 0x01, 0x00, 0xD0, 0x18,
+    0x97, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x22, 0x97, 0x00, 0x96, 0x8C, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x28, 0x97, 0x00, 0x3A, 0x97, 0x00, 0x01, 0x00, 0xD1, 0xE2, 0x45, 0x00, 0x01, 0x01, 0x25, 0x00,
+    0xD1, 0x9A, 0x36, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x8A, 0x3C, 0x00, 0x9A, 0x36, 0x00, 0x01, 0x00,
+    0xD1, 0x8A, 0x5D, 0x00, 0x01, 0x00, 0xD0, 0xD2, 0x94, 0x00, 0x01, 0x00, 0xD0, 0x44, 0x97, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x56, 0x97, 0x00, 0xE0, 0x86, 0x00, 0x01, 0x00, 0xD1, 0xD2, 0x43, 0x00,
+    0x01, 0x00, 0xD0, 0x5C, 0x97, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x62, 0x97, 0x00, 0x2C, 0x38, 0x00,
+    0x01, 0x00, 0xD1, 0x6C, 0x97, 0x00, 0x01, 0x00, 0xD0, 0x6C, 0x5F, 0x00, 0x01, 0x00, 0xD1, 0x76,
+    0x97, 0x00, 0x01, 0x01, 0x0B, 0x00, 0xD1, 0x5A, 0x44, 0x00, 0x01, 0x00, 0xD1, 0x2C, 0x38, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x80, 0x97, 0x00, 0x60, 0x88, 0x00, 0x01, 0x00, 0xD0, 0xB6, 0x8C, 0x00,
+    0x01, 0x00, 0xD0, 0x86, 0x97, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x8A, 0x87, 0x00, 0x8C, 0x97, 0x00,
+    0x01, 0x00, 0xD0, 0x92, 0x97, 0x00, 0x01, 0x00, 0xD0, 0x98, 0x97, 0x00, 0x01, 0x00, 0xD0, 0x9E,
+    0x97, 0x00, 0x01, 0x00, 0xD1, 0xA4, 0x97, 0x00, 0x01, 0x00, 0xD0, 0xB8, 0x5C, 0x00, 0x01, 0x00,
+    0xD0, 0xA4, 0x89, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xAA, 0x97, 0x00, 0x7C, 0x44, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0xB0, 0x97, 0x00, 0xBE, 0x97, 0x00, 0x01, 0x00, 0xD0, 0xCC, 0x35, 0x00, 0x01, 0x00,
+    0xD0, 0xC8, 0x97, 0x00, 0x02, 0x01, 0x25, 0x00, 0xD0, 0xD1, 0xD2, 0x97, 0x00, 0xDC, 0x97, 0x00,
+    0x01, 0x01, 0x08, 0x00, 0xD0, 0x02, 0x91, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xE6, 0x97, 0x00, 0x9A,
+    0x36, 0x00, 0x02, 0x03, 0xA7, 0x00, 0xD0, 0xD1, 0xF8, 0x97, 0x00, 0x02, 0x98, 0x00, 0x01, 0x00,
+    0xD0, 0x08, 0x98, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x12, 0x98, 0x00, 0x20, 0x98, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x2E, 0x98, 0x00, 0xF4, 0x8B, 0x00, 0x01, 0x00, 0xD0, 0x9A, 0x96, 0x00, 0x01, 0x00,
+    0xD0, 0x38, 0x98, 0x00, 0x01, 0x00, 0xD1, 0x3E, 0x98, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x44, 0x98,
+    0x00, 0x52, 0x98, 0x00, 0x01, 0x00, 0xD0, 0x5C, 0x98, 0x00, 0x01, 0x00, 0xD0, 0x66, 0x98, 0x00,
+    0x01, 0x00, 0xD0, 0x90, 0x91, 0x00, 0x01, 0x01, 0x09, 0x00, 0xD1, 0x9A, 0x36, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x6C, 0x98, 0x00, 0x9A, 0x36, 0x00, 0x01, 0x00, 0xD0, 0x7A, 0x98, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x1A, 0x8C, 0x00, 0x80, 0x98, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x72, 0x87, 0x00, 0x28,
+    0x87, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x8A, 0x98, 0x00, 0x98, 0x98, 0x00, 0x01, 0x00, 0xD0, 0x9E,
+    0x98, 0x00, 0x01, 0x01, 0x11, 0x00, 0xD0, 0x2A, 0x5F, 0x00, 0x01, 0x00, 0xD0, 0xBC, 0x5F, 0x00,
+    0x00, 0x02, 0xA2, 0x00, 0x01, 0x00, 0xD0, 0xA8, 0x98, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xAE, 0x98,
+    0x00, 0xC0, 0x98, 0x00, 0x00, 0x03, 0x35, 0x00, 0x01, 0x00, 0xD0, 0x9E, 0x95, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0xCE, 0x98, 0x00, 0xA4, 0x5F, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xD4, 0x98, 0x00, 0xDE,
+    0x98, 0x00, 0x01, 0x01, 0x07, 0x00, 0xD0, 0xE8, 0x98, 0x00, 0x01, 0x00, 0xD0, 0xEE, 0x98, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x6E, 0x85, 0x00, 0xF8, 0x98, 0x00, 0x01, 0x00, 0xD0, 0xFE, 0x98, 0x00,
+    0x01, 0x00, 0xD0, 0x04, 0x99, 0x00, 0x01, 0x00, 0xD0, 0x0E, 0x99, 0x00, 0x01, 0x00, 0xD1, 0xC2,
+    0x96, 0x00, 0x01, 0x00, 0xD0, 0x1C, 0x99, 0x00, 0x02, 0x00, 0x2E, 0xD1, 0x14, 0x63, 0x00, 0x22,
+    0x99, 0x00, 0x01, 0x00, 0xD0, 0x28, 0x99, 0x00, 0x01, 0x00, 0xD0, 0x32, 0x99, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x38, 0x99, 0x00, 0x42, 0x99, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x4C, 0x99, 0x00, 0x5A,
+    0x99, 0x00, 0x01, 0x00, 0xD1, 0x60, 0x99, 0x00, 0x01, 0x00, 0xD0, 0x66, 0x99, 0x00, 0x01, 0x01,
+    0x0A, 0x00, 0xD0, 0x9E, 0x89, 0x00, 0x01, 0x00, 0xD0, 0x0C, 0x38, 0x00, 0x01, 0x00, 0xD0, 0x70,
+    0x99, 0x00, 0x01, 0x02, 0x1C, 0x00, 0xD1, 0xE0, 0x4C, 0x00, 0x01, 0x00, 0xD0, 0xDE, 0x4F, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x7A, 0x99, 0x00, 0x84, 0x99, 0x00, 0x01, 0x00, 0xD0, 0x8A, 0x99, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x94, 0x99, 0x00, 0xA2, 0x99, 0x00, 0x01, 0x00, 0xD0, 0xA8, 0x99, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0xDA, 0x86, 0x00, 0xC6, 0x39, 0x00, 0x01, 0x00, 0xD0, 0x86, 0x41, 0x00,
+    0x02, 0x01, 0x0A, 0x00, 0xD0, 0xD1, 0xAE, 0x99, 0x00, 0xBC, 0x99, 0x00, 0x01, 0x00, 0xD0, 0xC2,
+    0x99, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x30, 0x46, 0x00, 0xF4, 0x8A, 0x00, 0x01, 0x02, 0x18, 0x00,
+    0xD0, 0xB6, 0x8C, 0x00, 0x01, 0x00, 0xD1, 0xC8, 0x99, 0x00, 0x01, 0x01, 0x09, 0x00, 0xD0, 0xCE,
+    0x99, 0x00, 0x01, 0x00, 0xD0, 0xD4, 0x99, 0x00, 0x01, 0x02, 0x45, 0x00, 0xD1, 0xDA, 0x99, 0x00,
+    0x01, 0x00, 0xD0, 0xE0, 0x99, 0x00, 0x01, 0x00, 0xD0, 0x1E, 0x8F, 0x00, 0x01, 0x01, 0x26, 0x00,
+    0xD0, 0x18, 0x86, 0x00, 0x01, 0x00, 0xD0, 0x9C, 0x94, 0x00, 0x01, 0x00, 0xD0, 0xEE, 0x99, 0x00,
+    0x01, 0x00, 0xD0, 0xF4, 0x99, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0x90, 0x8C, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0xFA, 0x99, 0x00, 0x04, 0x9A, 0x00, 0x01, 0x01, 0x0E, 0x00, 0xD0, 0x0A, 0x9A, 0x00,
+    0x01, 0x01, 0x11, 0x00, 0xD1, 0xC2, 0x96, 0x00, 0x01, 0x00, 0xD1, 0x40, 0x90, 0x00, 0x01, 0x00,
+    0xD0, 0x10, 0x9A, 0x00, 0x01, 0x00, 0xD1, 0x16, 0x9A, 0x00, 0x01, 0x00, 0xD1, 0x1C, 0x38, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x84, 0x87, 0x00, 0xC0, 0x8B, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x1C, 0x9A,
+    0x00, 0x7E, 0x5D, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x22, 0x9A, 0x00, 0x30, 0x9A, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x3E, 0x9A, 0x00, 0x48, 0x9A, 0x00, 0x01, 0x00, 0xD0, 0x4E, 0x9A, 0x00, 0x01, 0x00,
+    0xD0, 0x58, 0x9A, 0x00, 0x02, 0x01, 0x0A, 0x00, 0xD0, 0xD1, 0x5E, 0x9A, 0x00, 0x9C, 0x93, 0x00,
+    0x01, 0x01, 0x0A, 0x00, 0xD1, 0x64, 0x9A, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD1, 0x6A, 0x9A, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x70, 0x9A, 0x00, 0x8C, 0x8F, 0x00, 0x01, 0x00, 0xD0, 0x7A, 0x9A, 0x00,
+    0x01, 0x01, 0x0E, 0x00, 0xD0, 0x84, 0x9A, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x8A, 0x9A, 0x00, 0xA0,
+    0x9A, 0x00, 0x02, 0x02, 0x23, 0x00, 0xD0, 0xD1, 0xAA, 0x9A, 0x00, 0xB4, 0x9A, 0x00, 0x01, 0x00,
+    0xD0, 0xBA, 0x9A, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xC4, 0x9A, 0x00, 0xCA, 0x9A, 0x00, 0x01, 0x00,
+    0xD0, 0xD0, 0x9A, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x66, 0x92, 0x00, 0xD6, 0x9A, 0x00, 0x01, 0x00,
+    0xD0, 0xE0, 0x9A, 0x00, 0x02, 0x01, 0x0A, 0x00, 0xD0, 0xD1, 0xD4, 0x86, 0x00, 0xEA, 0x9A, 0x00,
+    0x01, 0x00, 0xD1, 0xDA, 0x52, 0x00, 0x01, 0x00, 0xD0, 0xBA, 0x8B, 0x00, 0x01, 0x00, 0xD0, 0xF0,
+    0x9A, 0x00, 0x02, 0x01, 0x09, 0x00, 0xD0, 0xD1, 0xF6, 0x9A, 0x00, 0x06, 0x90, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x08, 0x9B, 0x00, 0x0E, 0x9B, 0x00, 0x01, 0x01, 0x0D, 0x00, 0xD0, 0x18, 0x9B, 0x00,
+    0x01, 0x00, 0xD0, 0x1E, 0x9B, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x24, 0x9B, 0x00, 0x36, 0x9B, 0x00,
+    0x01, 0x00, 0xD0, 0x40, 0x9B, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xAC, 0x3B, 0x00, 0xC8, 0x90, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x08, 0x9B, 0x00, 0x7E, 0x5D, 0x00, 0x01, 0x00, 0xD0, 0x46, 0x9B, 0x00,
+    0x01, 0x00, 0xD1, 0x50, 0x9B, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xE2, 0x91, 0x00, 0x56, 0x9B, 0x00,
+    0x01, 0x00, 0xD1, 0x60, 0x9B, 0x00, 0x01, 0x01, 0x0E, 0x00, 0xD0, 0x6A, 0x9B, 0x00, 0x01, 0x01,
+    0x0A, 0x00, 0xD0, 0x66, 0x98, 0x00, 0x01, 0x00, 0xD0, 0x1A, 0x91, 0x00, 0x01, 0x00, 0xD0, 0x74,
+    0x9B, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x7A, 0x9B, 0x00, 0x54, 0x92, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xD8, 0x88, 0x00, 0x84, 0x9B, 0x00, 0x01, 0x00, 0xD1, 0x8A, 0x9B, 0x00, 0x01, 0x00, 0xD1, 0xE0,
+    0x4C, 0x00, 0x01, 0x00, 0xD0, 0x90, 0x9B, 0x00, 0x01, 0x01, 0x0E, 0x00, 0xD0, 0x46, 0x9B, 0x00,
+    0x01, 0x00, 0xD0, 0x9A, 0x9B, 0x00, 0x01, 0x00, 0xD1, 0x54, 0x92, 0x00, 0x01, 0x00, 0xD0, 0xA0,
+    0x9B, 0x00, 0x01, 0x00, 0xD0, 0xA6, 0x9B, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xB0, 0x9B, 0x00, 0xBA,
+    0x9B, 0x00, 0x01, 0x00, 0xD1, 0xC8, 0x9B, 0x00, 0x01, 0x00, 0xD0, 0xCE, 0x9B, 0x00, 0x01, 0x00,
+    0xD0, 0xBE, 0x5C, 0x00, 0x01, 0x00, 0xD1, 0xD4, 0x9B, 0x00, 0x02, 0x00, 0x2E, 0xD1, 0x34, 0x49,
+    0x00, 0x3A, 0x8F, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xDA, 0x9B, 0x00, 0xE8, 0x9B, 0x00, 0x01, 0x00,
+    0xD0, 0xF2, 0x9B, 0x00, 0x02, 0x00, 0x2E, 0xD0, 0x26, 0x39, 0x00, 0xFC, 0x9B, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x06, 0x9C, 0x00, 0x14, 0x9C, 0x00, 0x02, 0x00, 0x2E, 0xD1, 0x26, 0x39, 0x00, 0xAE,
+    0x8B, 0x00, 0x01, 0x00, 0xD1, 0x46, 0x94, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x1A, 0x9C, 0x00, 0xE8,
+    0x9B, 0x00, 0x00, 0x02, 0x91, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xFC, 0x85, 0x00, 0x20, 0x9C, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x26, 0x9C, 0x00, 0x30, 0x9C, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x36, 0x9C,
+    0x00, 0x08, 0x91, 0x00, 0x01, 0x00, 0xD0, 0x40, 0x9C, 0x00, 0x01, 0x00, 0xD1, 0x52, 0x9C, 0x00,
+    0x01, 0x00, 0xD0, 0x58, 0x9C, 0x00, 0x00, 0x03, 0x8C, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x5E, 0x9C,
+    0x00, 0x28, 0x87, 0x00, 0x02, 0x02, 0x8A, 0x00, 0xD0, 0xD1, 0xFE, 0x8C, 0x00, 0x68, 0x9C, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0xB8, 0x93, 0x00, 0x60, 0x88, 0x00, 0x01, 0x00, 0xD0, 0x72, 0x9C, 0x00,
+    0x01, 0x00, 0xD0, 0x78, 0x9C, 0x00, 0x01, 0x00, 0xD0, 0x22, 0x97, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x7E, 0x9C, 0x00, 0xF4, 0x5A, 0x00, 0x02, 0x01, 0x0B, 0x00, 0xD0, 0xD1, 0x98, 0x9C, 0x00, 0xB2,
+    0x9C, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xBC, 0x9C, 0x00, 0xD6, 0x9C, 0x00, 0x01, 0x00, 0xD1, 0xF4,
+    0x5A, 0x00, 0x01, 0x00, 0xD0, 0xFA, 0x49, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x94, 0x42, 0x00, 0xDC,
+    0x9C, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x18, 0x9B, 0x00, 0xDC, 0x9C, 0x00, 0x01, 0x00, 0xD0, 0xE2,
+    0x9C, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xE8, 0x9C, 0x00, 0x2C, 0x38, 0x00, 0x01, 0x00, 0xD1, 0xE8,
+    0x96, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xEE, 0x9C, 0x00, 0xE0, 0x86, 0x00, 0x01, 0x00, 0xD0, 0xF8,
+    0x9C, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xFE, 0x9C, 0x00, 0x08, 0x9D, 0x00, 0x01, 0x00, 0xD1, 0x0E,
+    0x9D, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x14, 0x9D, 0x00, 0xCE, 0x8C, 0x00, 0x01, 0x00, 0xD0, 0x1A,
+    0x9D, 0x00, 0x01, 0x00, 0xD0, 0x28, 0x9D, 0x00, 0x01, 0x00, 0xD0, 0x2E, 0x9D, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x38, 0x9D, 0x00, 0x3E, 0x9D, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x44, 0x9D, 0x00, 0x52,
+    0x9D, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x58, 0x9D, 0x00, 0xF4, 0x8B, 0x00, 0x01, 0x00, 0xD0, 0x62,
+    0x9D, 0x00, 0x01, 0x01, 0x26, 0x00, 0xD1, 0x58, 0x51, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x68, 0x9D,
+    0x00, 0x76, 0x9D, 0x00, 0x01, 0x00, 0xD1, 0x80, 0x9D, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x86, 0x9D,
+    0x00, 0x90, 0x9D, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x9A, 0x9D, 0x00, 0xA4, 0x9D, 0x00, 0x02, 0x01,
+    0x0A, 0x00, 0xD0, 0xD1, 0x94, 0x42, 0x00, 0xE2, 0x45, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0xAA,
+    0x9D, 0x00, 0x01, 0x00, 0xD1, 0xA4, 0x9D, 0x00, 0x01, 0x00, 0xD0, 0xAC, 0x3B, 0x00, 0x01, 0x00,
+    0xD0, 0xB0, 0x9D, 0x00, 0x01, 0x00, 0xD0, 0xBA, 0x9D, 0x00, 0x01, 0x00, 0xD0, 0xC0, 0x9D, 0x00,
+    0x01, 0x00, 0xD0, 0xCE, 0x9D, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xD4, 0x9D, 0x00, 0xE6, 0x9D, 0x00,
+    0x01, 0x00, 0xD1, 0xF0, 0x9D, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xEE, 0x8B, 0x00, 0xF0, 0x9D, 0x00,
+    0x01, 0x00, 0xD0, 0xF6, 0x9D, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x18, 0x87, 0x00, 0x84, 0x96, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x00, 0x9E, 0x00, 0x0A, 0x9E, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x1C, 0x9E,
+    0x00, 0x2A, 0x9E, 0x00, 0x01, 0x00, 0xD1, 0x38, 0x9E, 0x00, 0x02, 0x00, 0x2E, 0xD0, 0x14, 0x63,
+    0x00, 0x3E, 0x9E, 0x00, 0x01, 0x01, 0x09, 0x00, 0xD1, 0x8C, 0x8A, 0x00, 0x01, 0x00, 0xD0, 0x48,
+    0x9E, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x40, 0x8F, 0x00, 0xF4, 0x8B, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x0E, 0x91, 0x00, 0x30, 0x89, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x98, 0x97, 0x00, 0x56, 0x9E, 0x00,
+    0x01, 0x01, 0x11, 0x00, 0xD1, 0x14, 0x54, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x20, 0x91, 0x00, 0x5C,
+    0x9E, 0x00, 0x02, 0x02, 0x1C, 0x00, 0xD0, 0xD1, 0x66, 0x9E, 0x00, 0x70, 0x9E, 0x00, 0x01, 0x00,
+    0xD1, 0x76, 0x9E, 0x00, 0x01, 0x00, 0xD1, 0x7C, 0x9E, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x7C, 0x5B,
+    0x00, 0x90, 0x85, 0x00, 0x01, 0x00, 0xD0, 0x82, 0x9E, 0x00, 0x01, 0x00, 0xD1, 0x88, 0x9E, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x8E, 0x9E, 0x00, 0xF4, 0x8B, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x94, 0x9E,
+    0x00, 0x9A, 0x9E, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xA0, 0x9E, 0x00, 0xB2, 0x9E, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0xBC, 0x9E, 0x00, 0x08, 0x91, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xC6, 0x9E, 0x00, 0xD0,
+    0x9E, 0x00, 0x01, 0x00, 0xD1, 0x38, 0x92, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xDA, 0x9E, 0x00, 0x62,
+    0x45, 0x00, 0x01, 0x00, 0xD0, 0xE0, 0x9E, 0x00, 0x01, 0x00, 0xD0, 0xE6, 0x9E, 0x00, 0x01, 0x00,
+    0xD0, 0xEC, 0x9E, 0x00, 0x01, 0x00, 0xD0, 0xF6, 0x9E, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xFC, 0x9E,
+    0x00, 0x1C, 0x38, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x02, 0x9F, 0x00, 0x28, 0x87, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x0C, 0x9F, 0x00, 0x1E, 0x9F, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x2C, 0x9F, 0x00, 0x36,
+    0x9F, 0x00, 0x01, 0x01, 0x26, 0x00, 0xD0, 0x2C, 0x8B, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x3C, 0x9F,
+    0x00, 0x5A, 0x44, 0x00, 0x01, 0x00, 0xD0, 0x42, 0x9F, 0x00, 0x01, 0x00, 0xD0, 0x4C, 0x9F, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0xC8, 0x85, 0x00, 0x52, 0x9F, 0x00, 0x01, 0x00, 0xD0, 0x58, 0x9F, 0x00,
+    0x01, 0x00, 0xD0, 0x5E, 0x9F, 0x00, 0x01, 0x02, 0x12, 0x00, 0xD0, 0x64, 0x9F, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x6E, 0x9F, 0x00, 0x74, 0x9F, 0x00, 0x01, 0x00, 0xD0, 0x7A, 0x9F, 0x00, 0x01, 0x00,
+    0xD1, 0x88, 0x9F, 0x00, 0x01, 0x00, 0xD1, 0xDA, 0x99, 0x00, 0x01, 0x00, 0xD1, 0x92, 0x9F, 0x00,
+    0x01, 0x00, 0xD0, 0x98, 0x9F, 0x00, 0x01, 0x00, 0xD0, 0x9E, 0x9F, 0x00, 0x01, 0x00, 0xD0, 0xA4,
+    0x9F, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xAA, 0x9F, 0x00, 0xB4, 0x9F, 0x00, 0x01, 0x00, 0xD0, 0xBA,
+    0x9F, 0x00, 0x01, 0x00, 0xD0, 0xC4, 0x9F, 0x00, 0x01, 0x01, 0x07, 0x00, 0xD0, 0xCA, 0x9F, 0x00,
+    0x01, 0x00, 0xD0, 0xD0, 0x9F, 0x00, 0x01, 0x00, 0xD0, 0x24, 0x89, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xD6, 0x9F, 0x00, 0xE4, 0x9F, 0x00, 0x01, 0x00, 0xD0, 0xEA, 0x95, 0x00, 0x01, 0x00, 0xD1, 0xEA,
+    0x9F, 0x00, 0x01, 0x00, 0xD1, 0xF0, 0x9F, 0x00, 0x01, 0x00, 0xD0, 0xF6, 0x9F, 0x00, 0x01, 0x00,
+    0xD0, 0xFC, 0x9F, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xAA, 0x96, 0x00, 0x9A, 0x36, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x02, 0xA0, 0x00, 0x08, 0xA0, 0x00, 0x01, 0x00, 0xD1, 0x0E, 0xA0, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x14, 0xA0, 0x00, 0x1E, 0xA0, 0x00, 0x01, 0x00, 0xD0, 0x28, 0xA0, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x2E, 0xA0, 0x00, 0x34, 0xA0, 0x00, 0x01, 0x00, 0xD0, 0x3A, 0xA0, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x44, 0xA0, 0x00, 0x4E, 0xA0, 0x00, 0x01, 0x00, 0xD0, 0x58, 0xA0, 0x00, 0x01, 0x01,
+    0x0E, 0x00, 0xD1, 0x5E, 0xA0, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x64, 0xA0, 0x00, 0x50, 0x9B, 0x00,
+    0x01, 0x01, 0x0E, 0x00, 0xD0, 0x6E, 0xA0, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x82, 0x60, 0x00, 0x78,
+    0xA0, 0x00, 0x03, 0x00, 0x2E, 0xD0, 0xD1, 0x10, 0x68, 0x00, 0x7E, 0xA0, 0x00, 0x8C, 0xA0, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x92, 0xA0, 0x00, 0xA4, 0xA0, 0x00, 0x02, 0x00, 0x2E, 0xD1, 0x10, 0x68,
+    0x00, 0xAE, 0xA0, 0x00, 0x03, 0x00, 0x2E, 0xD0, 0xD1, 0x10, 0x68, 0x00, 0xB4, 0xA0, 0x00, 0xBE,
+    0xA0, 0x00, 0x01, 0x00, 0xD1, 0xC4, 0xA0, 0x00, 0x01, 0x00, 0xD0, 0xCA, 0xA0, 0x00, 0x01, 0x00,
+    0xD1, 0xD8, 0xA0, 0x00, 0x01, 0x00, 0xD1, 0x7E, 0x5D, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xE2, 0xA0,
+    0x00, 0xE8, 0xA0, 0x00, 0x01, 0x00, 0xD0, 0xF2, 0xA0, 0x00, 0x01, 0x00, 0xD0, 0x08, 0x9B, 0x00,
+    0x01, 0x01, 0x0C, 0x00, 0xD0, 0x6C, 0x93, 0x00, 0x01, 0x00, 0xD0, 0xF8, 0xA0, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0xFE, 0xA0, 0x00, 0x28, 0x87, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x04, 0xA1, 0x00, 0x0E,
+    0xA1, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x18, 0xA1, 0x00, 0x60, 0x88, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x1E, 0xA1, 0x00, 0x2C, 0xA1, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x30, 0x46, 0x00, 0x3E, 0xA1, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x44, 0xA1, 0x00, 0xE0, 0x58, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x9E, 0x89,
+    0x00, 0x4E, 0xA1, 0x00, 0x01, 0x00, 0xD0, 0x58, 0xA1, 0x00, 0x00, 0x02, 0x6B, 0x00, 0x01, 0x01,
+    0x11, 0x00, 0xD0, 0x8A, 0x85, 0x00, 0x01, 0x00, 0xD1, 0x62, 0xA1, 0x00, 0x03, 0x00, 0x2E, 0xD0,
+    0xD1, 0x34, 0x49, 0x00, 0x68, 0xA1, 0x00, 0xF6, 0x8E, 0x00, 0x03, 0x01, 0x11, 0x00, 0x2E, 0xD0,
+    0xD1, 0x76, 0xA1, 0x00, 0x7A, 0xA1, 0x00, 0x88, 0xA1, 0x00, 0x02, 0x01, 0x26, 0x00, 0xD0, 0xD1,
+    0x96, 0xA1, 0x00, 0xA8, 0xA1, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xB6, 0xA1, 0x00, 0xC4, 0xA1, 0x00,
+    0x03, 0x00, 0x2E, 0xD0, 0xD1, 0xBE, 0x47, 0x00, 0xCE, 0xA1, 0x00, 0xF4, 0xA1, 0x00, 0x03, 0x00,
+    0x2E, 0xD0, 0xD1, 0x26, 0x39, 0x00, 0x0A, 0xA2, 0x00, 0x1C, 0xA2, 0x00, 0x01, 0x00, 0xD1, 0x22,
+    0xA2, 0x00, 0x01, 0x00, 0xD0, 0x2C, 0xA2, 0x00, 0x01, 0x01, 0x26, 0x00, 0xD0, 0xCA, 0x53, 0x00,
+    0x02, 0x01, 0x16, 0x00, 0x2E, 0xD1, 0x26, 0x39, 0x00, 0x32, 0xA2, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x44, 0xA2, 0x00, 0x4A, 0xA2, 0x00, 0x02, 0x01, 0x11, 0x00, 0xD0, 0xD1, 0x50, 0xA2, 0x00, 0x88,
+    0xA1, 0x00, 0x01, 0x01, 0x0E, 0x00, 0xD0, 0x5A, 0xA2, 0x00, 0x01, 0x00, 0xD0, 0x64, 0xA2, 0x00,
+    0x01, 0x00, 0xD0, 0x6A, 0xA2, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x70, 0xA2, 0x00, 0x2C, 0x38, 0x00,
+    0x00, 0x02, 0x43, 0x00, 0x01, 0x00, 0xD0, 0x7A, 0xA2, 0x00, 0x01, 0x01, 0x26, 0x00, 0xD1, 0xE0,
+    0x58, 0x00, 0x01, 0x00, 0xD1, 0x80, 0xA2, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x86, 0xA2, 0x00, 0xE2,
+    0x45, 0x00, 0x01, 0x00, 0xD0, 0x90, 0xA2, 0x00, 0x01, 0x01, 0x0E, 0x00, 0xD0, 0x9A, 0xA2, 0x00,
+    0x01, 0x00, 0xD1, 0xA0, 0xA2, 0x00, 0x01, 0x00, 0xD1, 0xAE, 0x8E, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x46, 0x3A, 0x00, 0x60, 0x88, 0x00, 0x01, 0x00, 0xD1, 0xA6, 0xA2, 0x00, 0x01, 0x01, 0x26, 0x00,
+    0xD0, 0x9A, 0x96, 0x00, 0x01, 0x00, 0xD0, 0xAC, 0xA2, 0x00, 0x01, 0x01, 0x26, 0x00, 0xD1, 0x2C,
+    0x38, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xB2, 0xA2, 0x00, 0xAE, 0x8B, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xBC, 0xA2, 0x00, 0xCA, 0xA2, 0x00, 0x01, 0x00, 0xD0, 0xEA, 0x40, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xD8, 0xA2, 0x00, 0xE2, 0xA2, 0x00, 0x01, 0x00, 0xD0, 0xE8, 0xA2, 0x00, 0x01, 0x00, 0xD0, 0xEE,
+    0xA2, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xF4, 0xA2, 0x00, 0xCC, 0x54, 0x00, 0x01, 0x00, 0xD0, 0xFA,
+    0xA2, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x00, 0xA3, 0x00, 0xD4, 0x9B, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x12, 0xA3, 0x00, 0x92, 0x8A, 0x00, 0x01, 0x00, 0xD0, 0x18, 0xA3, 0x00, 0x01, 0x01, 0x09, 0x00,
+    0xD1, 0x56, 0x94, 0x00, 0x01, 0x00, 0xD0, 0x1E, 0xA3, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x24, 0xA3,
+    0x00, 0x32, 0xA3, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xEE, 0x8B, 0x00, 0x70, 0x9E, 0x00, 0x01, 0x00,
+    0xD0, 0x38, 0xA3, 0x00, 0x01, 0x00, 0xD1, 0x42, 0xA3, 0x00, 0x01, 0x00, 0xD0, 0x18, 0x8F, 0x00,
+    0x01, 0x00, 0xD1, 0x48, 0xA3, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x4E, 0xA3, 0x00, 0x58, 0xA3, 0x00,
+    0x01, 0x01, 0x07, 0x00, 0xD1, 0x8A, 0x91, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x5E, 0xA3, 0x00, 0x0C,
+    0x3D, 0x00, 0x01, 0x00, 0xD0, 0x64, 0xA3, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x6A, 0xA3, 0x00, 0x74,
+    0xA3, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x82, 0xA3, 0x00, 0x8C, 0xA3, 0x00, 0x01, 0x00, 0xD0, 0x92,
+    0xA3, 0x00, 0x01, 0x00, 0xD0, 0x9C, 0xA3, 0x00, 0x01, 0x01, 0x0C, 0x00, 0xD0, 0x14, 0x8C, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0xA6, 0xA3, 0x00, 0xC8, 0xA3, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xE2, 0xA3,
+    0x00, 0x00, 0xA4, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x0E, 0xA4, 0x00, 0x24, 0xA4, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x3A, 0xA4, 0x00, 0xE2, 0x45, 0x00, 0x03, 0x00, 0x2E, 0xD0, 0xD1, 0x1C, 0x63, 0x00,
+    0x4C, 0xA4, 0x00, 0x66, 0xA4, 0x00, 0x01, 0x00, 0xD1, 0x74, 0xA4, 0x00, 0x01, 0x00, 0xD0, 0x7E,
+    0xA4, 0x00, 0x01, 0x00, 0xD0, 0x84, 0xA4, 0x00, 0x01, 0x00, 0xD1, 0x8A, 0xA4, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x0E, 0x54, 0x00, 0x2C, 0x38, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xBA, 0x9F, 0x00, 0x84,
+    0x96, 0x00, 0x01, 0x00, 0xD0, 0xF8, 0x93, 0x00, 0x01, 0x00, 0xD0, 0x12, 0xA3, 0x00, 0x01, 0x00,
+    0xD0, 0x90, 0xA4, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x22, 0x97, 0x00, 0xF4, 0x88, 0x00, 0x02, 0x01,
+    0x07, 0x00, 0xD0, 0xD1, 0x98, 0x9F, 0x00, 0x96, 0xA4, 0x00, 0x01, 0x00, 0xD1, 0x9C, 0xA4, 0x00,
+    0x01, 0x00, 0x2E, 0x1C, 0x63, 0x00, 0x02, 0x01, 0x11, 0x00, 0xD0, 0xD1, 0xA2, 0xA4, 0x00, 0xAC,
+    0xA4, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x00, 0x90, 0x00, 0xB2, 0xA4, 0x00, 0x01, 0x00, 0xD0, 0xBC,
+    0xA4, 0x00, 0x01, 0x01, 0x07, 0x00, 0xD0, 0xC6, 0xA4, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0xD0,
+    0xA4, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0x36, 0x89, 0x00, 0x00, 0x02, 0x53, 0x00, 0x01, 0x00,
+    0xD1, 0x14, 0x9C, 0x00, 0x01, 0x00, 0xD0, 0xD6, 0xA4, 0x00, 0x01, 0x01, 0x11, 0x00, 0xD1, 0xDC,
+    0xA4, 0x00, 0x01, 0x00, 0xD0, 0x3A, 0x5E, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD1, 0xE2, 0xA4, 0x00,
+    0x01, 0x00, 0xD0, 0xE8, 0xA4, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0xEE, 0xA4, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0xF4, 0xA4, 0x00, 0x06, 0xA5, 0x00, 0x01, 0x01, 0x0E, 0x00, 0xD0, 0x10, 0xA5, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x4C, 0x87, 0x00, 0x1A, 0xA5, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0x24,
+    0xA5, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x4C, 0x87, 0x00, 0x2A, 0xA5, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x34, 0xA5, 0x00, 0x3A, 0x91, 0x00, 0x01, 0x01, 0x11, 0x00, 0xD0, 0x3A, 0xA5, 0x00, 0x01, 0x01,
+    0x07, 0x00, 0xD1, 0x40, 0xA5, 0x00, 0x01, 0x01, 0x11, 0x00, 0xD0, 0x7E, 0x85, 0x00, 0x01, 0x00,
+    0xD0, 0x46, 0xA5, 0x00, 0x00, 0x02, 0x4D, 0x00, 0x01, 0x00, 0xD0, 0x4C, 0xA5, 0x00, 0x01, 0x00,
+    0xD1, 0x58, 0xA3, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x3E, 0x96, 0x00, 0x52, 0xA5, 0x00, 0x01, 0x00,
+    0xD0, 0xDE, 0x88, 0x00, 0x01, 0x01, 0x25, 0x00, 0xD0, 0x5C, 0xA5, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x62, 0xA5, 0x00, 0x6C, 0xA5, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xB0, 0x5E, 0x00, 0x7C, 0x44, 0x00,
+    0x01, 0x01, 0x0A, 0x00, 0xD0, 0x76, 0xA5, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0xB0, 0x5E, 0x00,
+    0x01, 0x00, 0xD1, 0x3E, 0x38, 0x00, 0x00, 0x03, 0x3D, 0x00, 0x01, 0x00, 0xD1, 0x80, 0xA5, 0x00,
+    0x01, 0x00, 0xD1, 0x8C, 0x86, 0x00, 0x01, 0x00, 0xD1, 0x86, 0xA5, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x9E, 0x8B, 0x00, 0x8C, 0xA5, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x9A, 0xA5, 0x00, 0xA0, 0xA5, 0x00,
+    0x03, 0x00, 0x2E, 0xD0, 0xD1, 0x14, 0x63, 0x00, 0xAE, 0x94, 0x00, 0xAA, 0xA5, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x9A, 0xA5, 0x00, 0xE0, 0x58, 0x00, 0x01, 0x01, 0x09, 0x00, 0xD0, 0xB0, 0xA5, 0x00,
+    0x01, 0x00, 0xD0, 0xBA, 0xA5, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xC4, 0xA5, 0x00, 0xCE, 0xA5, 0x00,
+    0x01, 0x00, 0xD0, 0xD4, 0xA5, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xDA, 0xA5, 0x00, 0xE0, 0x58, 0x00,
+    0x01, 0x00, 0xD0, 0xE0, 0xA5, 0x00, 0x01, 0x02, 0x23, 0x00, 0xD0, 0x1A, 0x91, 0x00, 0x01, 0x00,
+    0x2E, 0x7E, 0x43, 0x00, 0x01, 0x01, 0x07, 0x00, 0xD0, 0xEA, 0xA5, 0x00, 0x01, 0x02, 0x18, 0x00,
+    0xD0, 0xB0, 0x96, 0x00, 0x01, 0x00, 0xD0, 0x2E, 0xA0, 0x00, 0x01, 0x01, 0x0E, 0x00, 0xD0, 0xB0,
+    0x96, 0x00, 0x01, 0x00, 0xD1, 0xD2, 0x35, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xF0, 0xA5, 0x00, 0x5A,
+    0x44, 0x00, 0x01, 0x00, 0xD1, 0xF6, 0xA5, 0x00, 0x01, 0x01, 0x11, 0x00, 0xD0, 0xFC, 0xA5, 0x00,
+    0x01, 0x01, 0x0C, 0x00, 0x2E, 0x42, 0x63, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x9A, 0x96, 0x00, 0xE0,
+    0x86, 0x00, 0x01, 0x00, 0xD0, 0x06, 0xA6, 0x00, 0x01, 0x00, 0xD1, 0x38, 0x8A, 0x00, 0x01, 0x00,
+    0xD0, 0x0C, 0xA6, 0x00, 0x03, 0x00, 0x2E, 0xD0, 0xD1, 0x42, 0x63, 0x00, 0x16, 0xA6, 0x00, 0x24,
+    0xA6, 0x00, 0x02, 0x00, 0x2E, 0xD0, 0x42, 0x63, 0x00, 0x32, 0xA6, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x3C, 0xA6, 0x00, 0x4A, 0xA6, 0x00, 0x01, 0x02, 0x39, 0x00, 0x2E, 0x26, 0x67, 0x00, 0x01, 0x00,
+    0xD0, 0xEE, 0x8B, 0x00, 0x00, 0x02, 0x32, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x58, 0xA6, 0x00, 0xBE,
+    0x97, 0x00, 0x01, 0x01, 0x0E, 0x00, 0xD0, 0xAA, 0x8F, 0x00, 0x01, 0x00, 0xD1, 0x62, 0xA6, 0x00,
+    0x01, 0x00, 0xD1, 0x08, 0x91, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x68, 0x85, 0x00, 0x28, 0x87, 0x00,
+    0x01, 0x00, 0xD1, 0x92, 0x8A, 0x00, 0x01, 0x00, 0xD0, 0x68, 0xA6, 0x00, 0x01, 0x00, 0xD0, 0x72,
+    0xA6, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x70, 0x91, 0x00, 0xA0, 0x5E, 0x00, 0x01, 0x00, 0xD0, 0x78,
+    0xA6, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x7E, 0xA6, 0x00, 0x88, 0xA6, 0x00, 0x01, 0x01, 0x09, 0x00,
+    0xD0, 0x92, 0xA6, 0x00, 0x01, 0x00, 0xD1, 0xF4, 0x8A, 0x00, 0x01, 0x01, 0x0B, 0x00, 0xD1, 0xE0,
+    0x4C, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD1, 0x84, 0x3C, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xD0, 0x92,
+    0x00, 0xE0, 0x86, 0x00, 0x01, 0x00, 0xD0, 0x98, 0xA6, 0x00, 0x01, 0x00, 0xD0, 0x9E, 0xA6, 0x00,
+    0x01, 0x00, 0xD0, 0xA4, 0xA6, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0xAA, 0xA6, 0x00, 0x01, 0x01,
+    0x0A, 0x00, 0xD1, 0x9C, 0x93, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xB0, 0xA6, 0x00, 0xBE, 0xA6, 0x00,
+    0x02, 0x01, 0x11, 0x00, 0xD0, 0xD1, 0xC4, 0xA6, 0x00, 0xD2, 0xA6, 0x00, 0x01, 0x00, 0xD0, 0xC8,
+    0x88, 0x00, 0x02, 0x01, 0x0E, 0x00, 0xD0, 0xD1, 0xDC, 0xA6, 0x00, 0x60, 0x87, 0x00, 0x01, 0x01,
+    0x0D, 0x00, 0xD0, 0x2A, 0x86, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x5A, 0x91, 0x00, 0x96, 0x93, 0x00,
+    0x01, 0x00, 0xD0, 0xE6, 0xA6, 0x00, 0x01, 0x00, 0xD1, 0x92, 0x46, 0x00, 0x01, 0x00, 0xD1, 0xEC,
+    0xA6, 0x00, 0x01, 0x00, 0xD0, 0xF2, 0xA6, 0x00, 0x02, 0x01, 0x11, 0x00, 0xD0, 0xD1, 0x2A, 0x5F,
+    0x00, 0xFC, 0xA6, 0x00, 0x01, 0x01, 0x0A, 0x00, 0x2E, 0x14, 0x63, 0x00, 0x02, 0x01, 0x0A, 0x00,
+    0xD0, 0xD1, 0x06, 0xA7, 0x00, 0x64, 0x90, 0x00, 0x02, 0x01, 0x0A, 0x00, 0xD0, 0xD1, 0xEE, 0x99,
+    0x00, 0x3A, 0x36, 0x00, 0x01, 0x00, 0xD0, 0x10, 0xA7, 0x00, 0x01, 0x00, 0xD0, 0x16, 0xA7, 0x00,
+    0x00, 0x01, 0xED, 0x00, 0x01, 0x00, 0xD1, 0x1C, 0xA7, 0x00, 0x01, 0x00, 0xD0, 0x22, 0xA7, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x16, 0xA7, 0x00, 0x28, 0xA7, 0x00, 0x01, 0x00, 0xD1, 0x2E, 0xA7, 0x00,
+    0x01, 0x00, 0xD0, 0x34, 0xA7, 0x00, 0x01, 0x00, 0xD0, 0x3A, 0xA7, 0x00, 0x01, 0x00, 0xD1, 0x40,
+    0xA7, 0x00, 0x01, 0x01, 0xED, 0x00, 0xD0, 0x00, 0x62, 0x00, 0x01, 0x00, 0xD0, 0x46, 0xA7, 0x00,
+    0x01, 0x00, 0xD1, 0x4C, 0xA7, 0x00, 0x00, 0x02, 0xEE, 0x00, 0x00, 0x01, 0xEB, 0x00, 0x01, 0x00,
+    0xD0, 0x52, 0xA7, 0x00, 0x01, 0x00, 0xD0, 0x58, 0xA7, 0x00, 0x01, 0x00, 0xD1, 0x5E, 0xA7, 0x00,
+    0x01, 0x00, 0xD0, 0x64, 0xA7, 0x00, 0x01, 0x00, 0xD1, 0x6A, 0xA7, 0x00, 0x01, 0x00, 0xD1, 0x70,
+    0xA7, 0x00, 0x01, 0x00, 0xD0, 0x76, 0xA7, 0x00, 0x00, 0x02, 0xE4, 0x00, 0x01, 0x00, 0xD1, 0x7C,
+    0xA7, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x82, 0xA7, 0x00, 0x88, 0xA7, 0x00,
+    0x01, 0x00, 0xD0, 0x8E, 0xA7, 0x00, 0x01, 0x00, 0xD1, 0x94, 0xA7, 0x00, 0x01, 0x00, 0xD0, 0x9A,
+    0xA7, 0x00, 0x01, 0x00, 0xD0, 0xA0, 0xA7, 0x00, 0x00, 0x01, 0xEA, 0x00, 0x01, 0x00, 0xD0, 0xAA,
+    0xA7, 0x00, 0x01, 0x01, 0xE8, 0x00, 0xD0, 0xB0, 0xA7, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x16, 0xA7,
+    0x00, 0xB6, 0xA7, 0x00, 0x01, 0x00, 0xD0, 0xBC, 0xA7, 0x00, 0x01, 0x00, 0xD0, 0xC2, 0xA7, 0x00,
+    0x01, 0x00, 0xD0, 0xC8, 0xA7, 0x00, 0x01, 0x00, 0xD0, 0xCE, 0xA7, 0x00, 0x01, 0x00, 0xD1, 0xD4,
+    0xA7, 0x00, 0x01, 0x00, 0xD1, 0xDA, 0xA7, 0x00, 0x01, 0x00, 0xD0, 0xE0, 0xA7, 0x00, 0x01, 0x00,
+    0xD0, 0xE6, 0xA7, 0x00, 0x01, 0x00, 0xD1, 0xF0, 0xA7, 0x00, 0x01, 0x00, 0xD0, 0xF6, 0xA7, 0x00,
+    0x00, 0x02, 0xE6, 0x00, 0x01, 0x01, 0xE8, 0x00, 0xD1, 0x28, 0xA7, 0x00, 0x01, 0x00, 0x81, 0xBA,
+    0x68, 0x00, 0x01, 0x00, 0x8E, 0xFA, 0x62, 0x00, 0x01, 0x00, 0xB8, 0x18, 0x63, 0x00, 0x01, 0x00,
+    0xBE, 0x2E, 0x65, 0x00, 0x02, 0x00, 0x81, 0x82, 0x20, 0x65, 0x00, 0x42, 0x63, 0x00, 0x01, 0x00,
+    0xB0, 0x18, 0x63, 0x00, 0x01, 0x00, 0xB5, 0xFA, 0x62, 0x00, 0x01, 0x00, 0xB5, 0xC2, 0x6C, 0x00,
+    0x01, 0x00, 0x81, 0xFC, 0xA7, 0x00, 0x01, 0x00, 0x82, 0x36, 0x6E, 0x00, 0x03, 0x00, 0xB5, 0xB8,
+    0xBE, 0x42, 0x63, 0x00, 0xFA, 0x62, 0x00, 0x00, 0xA8, 0x00, 0x01, 0x00, 0xB8, 0xFA, 0x62, 0x00,
+    0x01, 0x00, 0xBE, 0xD6, 0x73, 0x00, 0x01, 0x00, 0xB1, 0xF6, 0x76, 0x00, 0x01, 0x00, 0x83, 0x24,
+    0x65, 0x00, 0x01, 0x00, 0x87, 0xF0, 0x66, 0x00, 0x01, 0x00, 0xBE, 0xFA, 0x62, 0x00, 0x01, 0x00,
+    0x88, 0x06, 0xA8, 0x00, 0x02, 0x00, 0xB5, 0xBB, 0x0A, 0xA8, 0x00, 0x18, 0x63, 0x00, 0x01, 0x00,
+    0x91, 0x0A, 0xA8, 0x00, 0x03, 0x00, 0xB1, 0xB2, 0xBB, 0x10, 0xA8, 0x00, 0x18, 0xA8, 0x00, 0x18,
+    0xA8, 0x00, 0x02, 0x00, 0x80, 0x81, 0xCA, 0x64, 0x00, 0x60, 0x66, 0x00, 0x01, 0x00, 0xBB, 0x2E,
+    0x65, 0x00, 0x01, 0x00, 0xB5, 0xD0, 0x78, 0x00, 0x02, 0x00, 0xB1, 0xBD, 0xFC, 0xA7, 0x00, 0xEA,
+    0x6B, 0x00, 0x01, 0x00, 0x82, 0xF0, 0x66, 0x00, 0x01, 0x00, 0xB8, 0x26, 0x39, 0x00, 0x01, 0x00,
+    0xB3, 0x14, 0x63, 0x00, 0x01, 0x00, 0xBA, 0x26, 0x39, 0x00, 0x01, 0x00, 0xB7, 0x20, 0x65, 0x00,
+    0x01, 0x00, 0x88, 0x1E, 0xA8, 0x00, 0x01, 0x00, 0x89, 0x42, 0x63, 0x00, 0x01, 0x00, 0xBD, 0xC6,
+    0x74, 0x00, 0x01, 0x00, 0xB5, 0x3C, 0x79, 0x00, 0x01, 0x00, 0x91, 0x3C, 0x79, 0x00, 0x02, 0x00,
+    0xB7, 0xB8, 0xFC, 0xA7, 0x00, 0x26, 0xA8, 0x00, 0x02, 0x00, 0xB4, 0xBC, 0x2A, 0xA8, 0x00, 0x30,
+    0xA8, 0x00, 0x01, 0x00, 0x84, 0x42, 0x63, 0x00, 0x01, 0x00, 0x80, 0x9A, 0x64, 0x00, 0x01, 0x00,
+    0xB1, 0x36, 0xA8, 0x00, 0x01, 0x00, 0x85, 0x04, 0x73, 0x00, 0x01, 0x00, 0x83, 0x22, 0x75, 0x00,
+    0x01, 0x00, 0xB7, 0x24, 0x65, 0x00, 0x01, 0x00, 0x88, 0x42, 0x63, 0x00, 0x01, 0x00, 0x82, 0x3A,
+    0xA8, 0x00, 0x02, 0x00, 0xB0, 0xBE, 0x14, 0x63, 0x00, 0x3E, 0xA8, 0x00, 0x01, 0x00, 0xB2, 0x44,
+    0xA8, 0x00, 0x01, 0x00, 0x87, 0xE8, 0x82, 0x00, 0x02, 0x00, 0xB0, 0xB5, 0xFA, 0x62, 0x00, 0xE0,
+    0x67, 0x00, 0x01, 0x00, 0x81, 0x04, 0x6E, 0x00, 0x01, 0x00, 0xBE, 0xA4, 0x82, 0x00, 0x01, 0x00,
+    0xB0, 0xA0, 0x68, 0x00, 0x01, 0x00, 0x83, 0xBE, 0x47, 0x00, 0x02, 0x00, 0xB4, 0xBE, 0x66, 0x6D,
+    0x00, 0x5A, 0x66, 0x00, 0x01, 0x00, 0xB0, 0xFA, 0x62, 0x00, 0x01, 0x00, 0xBE, 0x3E, 0x65, 0x00,
+    0x01, 0x00, 0x80, 0x60, 0x66, 0x00, 0x01, 0x00, 0xB8, 0x2E, 0x65, 0x00, 0x01, 0x00, 0xB8, 0xC2,
+    0x7A, 0x00, 0x04, 0x00, 0xB2, 0xB5, 0xB8, 0xBE, 0x4A, 0xA8, 0x00, 0xD0, 0x78, 0x00, 0x50, 0xA8,
+    0x00, 0x2A, 0x6B, 0x00, 0x03, 0x00, 0x83, 0x8C, 0x91, 0x5A, 0xA8, 0x00, 0x4E, 0x70, 0x00, 0xD0,
+    0x78, 0x00, 0x01, 0x00, 0xB5, 0x60, 0xA8, 0x00, 0x01, 0x00, 0xBA, 0xBE, 0x47, 0x00, 0x02, 0x00,
+    0xB0, 0xB8, 0x2E, 0x65, 0x00, 0x18, 0x63, 0x00, 0x01, 0x00, 0x83, 0x18, 0x63, 0x00, 0x02, 0x00,
+    0xB1, 0xBC, 0x2E, 0x6D, 0x00, 0x8E, 0x63, 0x00, 0x01, 0x00, 0x88, 0xAC, 0x63, 0x00, 0x03, 0x00,
+    0xB0, 0xB8, 0xBE, 0x5A, 0xA8, 0x00, 0x18, 0x63, 0x00, 0x5E, 0x6C, 0x00, 0x01, 0x00, 0xB5, 0x1C,
+    0x63, 0x00, 0x03, 0x00, 0x8E, 0x8F, 0x91, 0x14, 0x63, 0x00, 0x14, 0x63, 0x00, 0x1C, 0x63, 0x00,
+    0x01, 0x00, 0x80, 0x20, 0x65, 0x00, 0x01, 0x00, 0x8C, 0x2E, 0x65, 0x00, 0x01, 0x00, 0xB8, 0x26,
+    0xA8, 0x00, 0x01, 0x00, 0xB2, 0xFA, 0x62, 0x00, 0x01, 0x00, 0x83, 0x2E, 0x65, 0x00, 0x01, 0x00,
+    0x8E, 0x3A, 0xA8, 0x00, 0x01, 0x00, 0xBC, 0xF0, 0x66, 0x00, 0x02, 0x00, 0xBB, 0xBD, 0xFA, 0x62,
+    0x00, 0xFA, 0x62, 0x00, 0x05, 0x00, 0xB0, 0xB4, 0xB8, 0xBD, 0xBE, 0xFC, 0xA7, 0x00, 0x6A, 0xA8,
+    0x00, 0x2E, 0x65, 0x00, 0xF0, 0x66, 0x00, 0xFC, 0xA7, 0x00, 0x02, 0x00, 0x80, 0x83, 0x20, 0x65,
+    0x00, 0x7C, 0x66, 0x00, 0x02, 0x00, 0xBA, 0xBF, 0x60, 0x66, 0x00, 0xF0, 0x66, 0x00, 0x01, 0x00,
+    0x82, 0x6E, 0xA8, 0x00, 0x01, 0x00, 0xB8, 0x76, 0xA8, 0x00, 0x01, 0x00, 0xBE, 0x5E, 0x6C, 0x00,
+    0x03, 0x00, 0xB1, 0xB4, 0xBD, 0xFA, 0x62, 0x00, 0xFA, 0x62, 0x00, 0xFA, 0x62, 0x00, 0x03, 0x00,
+    0xB3, 0xB7, 0xBD, 0xBE, 0x47, 0x00, 0x7C, 0xA8, 0x00, 0x42, 0x63, 0x00, 0x02, 0x00, 0xB5, 0xBD,
+    0x30, 0x7F, 0x00, 0x14, 0x63, 0x00, 0x02, 0x00, 0x81, 0x8F, 0x84, 0xA8, 0x00, 0x30, 0x7F, 0x00,
+    0x02, 0x00, 0xB4, 0xB6, 0x42, 0x63, 0x00, 0x30, 0x7F, 0x00, 0x03, 0x00, 0xB4, 0xB5, 0xBB, 0x42,
+    0x63, 0x00, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00, 0x02, 0x00, 0x81, 0x91, 0x8A, 0xA8, 0x00, 0x42,
+    0x63, 0x00, 0x01, 0x00, 0x81, 0x84, 0xA8, 0x00, 0x01, 0x00, 0x88, 0x2E, 0x65, 0x00, 0x01, 0x00,
+    0xB6, 0xD4, 0x65, 0x00, 0x01, 0x00, 0x8C, 0x90, 0xA8, 0x00, 0x01, 0x00, 0xBB, 0x66, 0x67, 0x00,
+    0x02, 0x00, 0x87, 0x88, 0xFA, 0x62, 0x00, 0x2E, 0x65, 0x00, 0x01, 0x00, 0x83, 0x3A, 0xA8, 0x00,
+    0x02, 0x00, 0xB0, 0xBA, 0xFA, 0x62, 0x00, 0x96, 0xA8, 0x00, 0x01, 0x00, 0x82, 0xAE, 0x64, 0x00,
+    0x01, 0x00, 0x80, 0xAC, 0x63, 0x00, 0x06, 0x00, 0xB1, 0xB2, 0xB7, 0xBB, 0xBC, 0xBD, 0x14, 0x63,
+    0x00, 0x42, 0x63, 0x00, 0x3A, 0x77, 0x00, 0x30, 0x7F, 0x00, 0xB0, 0x67, 0x00, 0x42, 0x63, 0x00,
+    0x05, 0x00, 0x81, 0x82, 0x85, 0x87, 0x8F, 0xBE, 0x47, 0x00, 0x18, 0xA8, 0x00, 0x1C, 0x63, 0x00,
+    0x30, 0x7F, 0x00, 0x10, 0x68, 0x00, 0x04, 0x00, 0xB4, 0xB9, 0xBA, 0xBC, 0x30, 0x7F, 0x00, 0x1C,
+    0x63, 0x00, 0x1C, 0x63, 0x00, 0x42, 0x63, 0x00, 0x01, 0x00, 0xB4, 0x42, 0x63, 0x00, 0x01, 0x00,
+    0x82, 0x9E, 0xA8, 0x00, 0x03, 0x00, 0xB4, 0xBB, 0xBC, 0xA8, 0xA8, 0x00, 0x1C, 0x63, 0x00, 0x00,
+    0x81, 0x00, 0x01, 0x00, 0x81, 0xAE, 0xA8, 0x00, 0x01, 0x00, 0xBA, 0x2E, 0x72, 0x00, 0x02, 0x00,
+    0xBA, 0xBC, 0x1C, 0x63, 0x00, 0x42, 0x63, 0x00, 0x01, 0x00, 0xBB, 0x20, 0x65, 0x00, 0x01, 0x00,
+    0xBA, 0x20, 0x65, 0x00, 0x02, 0x00, 0x80, 0x8C, 0x60, 0x66, 0x00, 0x26, 0xA8, 0x00, 0x01, 0x00,
+    0xB4, 0x66, 0x67, 0x00, 0x01, 0x00, 0x81, 0x26, 0xA8, 0x00, 0x01, 0x00, 0x82, 0xB4, 0xA8, 0x00,
+    0x02, 0x00, 0x80, 0x83, 0x20, 0x65, 0x00, 0x2E, 0x65, 0x00, 0x02, 0x00, 0xB5, 0xBB, 0xBC, 0x3B,
+    0x00, 0xBC, 0x3B, 0x00, 0x02, 0x00, 0x83, 0x91, 0xAC, 0x63, 0x00, 0xBC, 0x3B, 0x00, 0x01, 0x00,
+    0xB4, 0x26, 0x39, 0x00, 0x01, 0x00, 0xBA, 0x60, 0x66, 0x00, 0x01, 0x00, 0x82, 0xBC, 0xA8, 0x00,
+    0x01, 0x00, 0x80, 0xF0, 0x66, 0x00, 0x01, 0x00, 0xB1, 0x20, 0x65, 0x00, 0x01, 0x00, 0xB5, 0xC2,
+    0xA8, 0x00, 0x02, 0x00, 0xB7, 0xBA, 0xFA, 0x62, 0x00, 0xFA, 0x62, 0x00, 0x04, 0x00, 0x80, 0x81,
+    0x82, 0x84, 0xFA, 0x62, 0x00, 0xC8, 0xA8, 0x00, 0x20, 0x65, 0x00, 0x2E, 0x65, 0x00, 0x02, 0x00,
+    0xB2, 0xBB, 0xFA, 0x62, 0x00, 0xFA, 0x62, 0x00, 0x01, 0x00, 0xB3, 0x3A, 0x75, 0x00, 0x02, 0x00,
+    0x82, 0x87, 0xBE, 0x47, 0x00, 0xBE, 0x47, 0x00, 0x01, 0x00, 0xBD, 0xCC, 0xA8, 0x00, 0x01, 0x00,
+    0x81, 0xC8, 0x67, 0x00, 0x01, 0x00, 0xB1, 0x10, 0x68, 0x00, 0x02, 0x00, 0xB2, 0xBA, 0x42, 0x63,
+    0x00, 0x42, 0x63, 0x00, 0x02, 0x00, 0x82, 0x87, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00, 0x01, 0x00,
+    0xB1, 0x42, 0x63, 0x00, 0x01, 0x00, 0xBA, 0x42, 0x63, 0x00, 0x01, 0x00, 0xBA, 0xC8, 0x67, 0x00,
+    0x01, 0x00, 0x87, 0xC8, 0x67, 0x00, 0x01, 0x00, 0xBB, 0xD2, 0xA8, 0x00, 0x01, 0x00, 0xBA, 0x2E,
+    0x65, 0x00, 0x01, 0x00, 0xB6, 0xFA, 0x62, 0x00, 0x01, 0x00, 0x81, 0xD8, 0xA8, 0x00, 0x03, 0x00,
+    0x83, 0x86, 0x8C, 0x18, 0x63, 0x00, 0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0x04, 0x00, 0xBA, 0xBC,
+    0xBD, 0xBF, 0x20, 0x65, 0x00, 0x18, 0x63, 0x00, 0x18, 0x63, 0x00, 0xDC, 0xA8, 0x00, 0x01, 0x00,
+    0x82, 0x3E, 0x65, 0x00, 0x01, 0x00, 0x82, 0x66, 0x67, 0x00, 0x02, 0x00, 0xB2, 0xBC, 0x42, 0x63,
+    0x00, 0xB0, 0x67, 0x00, 0x03, 0x00, 0x81, 0x85, 0x86, 0x1C, 0x63, 0x00, 0xB0, 0x67, 0x00, 0x26,
+    0x39, 0x00, 0x01, 0x00, 0xBD, 0xB0, 0x67, 0x00, 0x05, 0x00, 0xB4, 0xB7, 0xB8, 0xBA, 0xBB, 0xBE,
+    0x47, 0x00, 0x30, 0x7F, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x02, 0x00,
+    0x81, 0x82, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x01, 0x00, 0x82, 0xE2, 0xA8, 0x00, 0x02, 0x00,
+    0xB0, 0xB8, 0xAC, 0x76, 0x00, 0x26, 0x67, 0x00, 0x01, 0x00, 0x83, 0x26, 0x67, 0x00, 0x01, 0x00,
+    0xB1, 0xFC, 0xA7, 0x00, 0x01, 0x00, 0x88, 0xF0, 0x66, 0x00, 0x02, 0x00, 0xB0, 0xB2, 0x60, 0x66,
+    0x00, 0xF0, 0x66, 0x00, 0x01, 0x00, 0xB2, 0xC8, 0x67, 0x00, 0x01, 0x00, 0x80, 0x82, 0x73, 0x00,
+    0x01, 0x00, 0xBD, 0xBE, 0x47, 0x00, 0x01, 0x00, 0x82, 0xE6, 0xA8, 0x00, 0x01, 0x00, 0xBE, 0x3A,
+    0xA8, 0x00, 0x02, 0x00, 0xB1, 0xB4, 0xFA, 0x62, 0x00, 0xFA, 0x62, 0x00, 0x01, 0x00, 0x80, 0x2E,
+    0x65, 0x00, 0x01, 0x00, 0x82, 0x26, 0xA8, 0x00, 0x03, 0x00, 0xB2, 0xB9, 0xBC, 0x42, 0x63, 0x00,
+    0x1C, 0x63, 0x00, 0xCA, 0x64, 0x00, 0x02, 0x00, 0x81, 0x8F, 0xEA, 0xA8, 0x00, 0x26, 0x39, 0x00,
+    0x01, 0x00, 0x84, 0xC8, 0x67, 0x00, 0x05, 0x00, 0xB1, 0xB2, 0xB3, 0xB5, 0xB9, 0xDE, 0x80, 0x00,
+    0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0x01, 0x00, 0x8E, 0x26,
+    0x39, 0x00, 0x02, 0x00, 0xB6, 0xBA, 0x42, 0x63, 0x00, 0x26, 0x39, 0x00, 0x02, 0x00, 0xB2, 0xBD,
+    0x42, 0x63, 0x00, 0x42, 0x63, 0x00, 0x03, 0x00, 0xB2, 0xBD, 0xBF, 0x42, 0x63, 0x00, 0x14, 0x63,
+    0x00, 0x14, 0x63, 0x00, 0x01, 0x00, 0x81, 0x14, 0x63, 0x00, 0x02, 0x00, 0x80, 0x82, 0x42, 0x63,
+    0x00, 0xF0, 0xA8, 0x00, 0x02, 0x00, 0xB5, 0xB8, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00, 0x02, 0x00,
+    0x81, 0x91, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00, 0x02, 0x00, 0xB2, 0xBD, 0x42, 0x63, 0x00, 0x14,
+    0x63, 0x00, 0x02, 0x00, 0xBB, 0xBD, 0xFA, 0x62, 0x00, 0xAC, 0x63, 0x00, 0x01, 0x00, 0xB3, 0x26,
+    0xA8, 0x00, 0x05, 0x00, 0xB0, 0xB4, 0xBA, 0xBD, 0xBF, 0x60, 0x66, 0x00, 0xFA, 0x62, 0x00, 0xE0,
+    0x67, 0x00, 0x18, 0x63, 0x00, 0x36, 0x63, 0x00, 0x02, 0x00, 0xB5, 0xB9, 0x1C, 0x63, 0x00, 0x1C,
+    0x63, 0x00, 0x02, 0x00, 0xB3, 0xBA, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x01, 0x00, 0x86, 0x1C,
+    0x63, 0x00, 0x04, 0x00, 0xB2, 0xBA, 0xBB, 0xBD, 0xF6, 0xA8, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63,
+    0x00, 0x1C, 0x63, 0x00, 0x02, 0x00, 0x81, 0x87, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x05, 0x00,
+    0xB2, 0xB7, 0xBA, 0xBD, 0xBF, 0x1C, 0x63, 0x00, 0x42, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63,
+    0x00, 0x1C, 0x63, 0x00, 0x02, 0x00, 0x82, 0x84, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x01, 0x00,
+    0xB2, 0x1C, 0x63, 0x00, 0x02, 0x00, 0xB5, 0xBB, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x01, 0x00,
+    0x82, 0x1C, 0x63, 0x00, 0x01, 0x00, 0x80, 0x04, 0x64, 0x00, 0x01, 0x00, 0xB5, 0xD8, 0x75, 0x00,
+    0x01, 0x00, 0x82, 0xFC, 0xA8, 0x00, 0x03, 0x00, 0xB4, 0xB7, 0xBD, 0xB0, 0x67, 0x00, 0x26, 0x39,
+    0x00, 0x02, 0xA9, 0x00, 0x02, 0x00, 0x81, 0x82, 0xB0, 0x67, 0x00, 0xB0, 0x67, 0x00, 0x02, 0x00,
+    0xB4, 0xB7, 0x26, 0x39, 0x00, 0x1C, 0x63, 0x00, 0x01, 0x00, 0x80, 0x04, 0x74, 0x00, 0x01, 0x00,
+    0xBB, 0xD4, 0x65, 0x00, 0x01, 0x00, 0x80, 0xD4, 0x65, 0x00, 0x01, 0x00, 0x80, 0xBC, 0x3B, 0x00,
+    0x03, 0x00, 0xB0, 0xB8, 0xBE, 0xC8, 0xA8, 0x00, 0xFA, 0x62, 0x00, 0xFC, 0xA7, 0x00, 0x01, 0x00,
+    0x83, 0xFA, 0x62, 0x00, 0x01, 0x00, 0xBE, 0x26, 0xA8, 0x00, 0x01, 0x00, 0xB5, 0xBC, 0x3B, 0x00,
+    0x02, 0x00, 0xB4, 0xBF, 0xFA, 0x62, 0x00, 0xF0, 0x66, 0x00, 0x01, 0x00, 0xB0, 0x08, 0xA9, 0x00,
+    0x02, 0x00, 0xB2, 0xBA, 0x3E, 0x71, 0x00, 0xAC, 0x63, 0x00, 0x03, 0x00, 0xB4, 0xB7, 0xBB, 0xFA,
+    0x62, 0x00, 0xAC, 0x63, 0x00, 0x0E, 0xA9, 0x00, 0x02, 0x00, 0x80, 0x81, 0xFA, 0x62, 0x00, 0xFA,
+    0x62, 0x00, 0x02, 0x00, 0xB1, 0xB4, 0xFA, 0x62, 0x00, 0xDC, 0xA8, 0x00, 0x03, 0x00, 0x80, 0x81,
+    0x82, 0xFA, 0x62, 0x00, 0x20, 0x65, 0x00, 0x0E, 0x63, 0x00, 0x01, 0x00, 0x82, 0x2E, 0x65, 0x00,
+    0x01, 0x00, 0xBB, 0x14, 0xA9, 0x00, 0x01, 0x00, 0x82, 0x38, 0x65, 0x00, 0x02, 0x00, 0x80, 0x82,
+    0x2E, 0x65, 0x00, 0x20, 0x63, 0x00, 0x02, 0x00, 0xB0, 0xB2, 0x26, 0xA8, 0x00, 0x1A, 0xA9, 0x00,
+    0x01, 0x00, 0xB4, 0xE2, 0xA8, 0x00, 0x01, 0x00, 0x88, 0xC8, 0x67, 0x00, 0x02, 0x00, 0xB5, 0xBB,
+    0x20, 0xA9, 0x00, 0x26, 0xA9, 0x00, 0x01, 0x00, 0x80, 0x2E, 0xA9, 0x00, 0x02, 0x00, 0xBB, 0xBC,
+    0xAC, 0x63, 0x00, 0x66, 0x67, 0x00, 0x01, 0x00, 0xBD, 0xAC, 0x63, 0x00, 0x01, 0x00, 0xB8, 0x94,
+    0x77, 0x00, 0x01, 0x00, 0xBB, 0x34, 0xA9, 0x00, 0x01, 0x00, 0x80, 0x40, 0xA9, 0x00, 0x01, 0x00,
+    0x83, 0x4A, 0xA9, 0x00, 0x04, 0x00, 0xB5, 0xB8, 0xBD, 0xBF, 0x50, 0xA9, 0x00, 0x50, 0xA9, 0x00,
+    0x56, 0xA9, 0x00, 0xAC, 0x63, 0x00, 0x02, 0x00, 0xB4, 0xBB, 0x26, 0x39, 0x00, 0x26, 0x39, 0x00,
+    0x03, 0x00, 0x80, 0x8A, 0x8C, 0x60, 0xA9, 0x00, 0x26, 0x39, 0x00, 0x2E, 0x65, 0x00, 0x01, 0x00,
+    0xBB, 0xBC, 0x3B, 0x00, 0x03, 0x00, 0xB2, 0xBA, 0xBB, 0x3E, 0x71, 0x00, 0x66, 0x67, 0x00, 0x6A,
+    0xA9, 0x00, 0x04, 0x00, 0xB1, 0xB2, 0xB7, 0xBD, 0x1C, 0x63, 0x00, 0x60, 0x7B, 0x00, 0x70, 0xA9,
+    0x00, 0x4E, 0x70, 0x00, 0x05, 0x00, 0x80, 0x81, 0x85, 0x87, 0x8E, 0x1C, 0x63, 0x00, 0x76, 0xA9,
+    0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x42, 0x63, 0x00, 0x06, 0x00, 0xB1, 0xB6, 0xB7, 0xBB,
+    0xBC, 0xBD, 0x42, 0x63, 0x00, 0x10, 0x68, 0x00, 0x26, 0x39, 0x00, 0x42, 0x63, 0x00, 0x7A, 0xA9,
+    0x00, 0x10, 0x68, 0x00, 0x01, 0x00, 0x81, 0x86, 0xA9, 0x00, 0x03, 0x00, 0xB9, 0xBD, 0xBF, 0x42,
+    0x63, 0x00, 0x26, 0x39, 0x00, 0x42, 0x63, 0x00, 0x08, 0x00, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB9,
+    0xBB, 0xBD, 0x90, 0xA9, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x96, 0xA9, 0x00, 0x10, 0x68,
+    0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x03, 0x00, 0x81, 0x82, 0x8E, 0x1C,
+    0x63, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x04, 0x00, 0xB1, 0xB3, 0xB6, 0xBC, 0x1C, 0x63,
+    0x00, 0xBE, 0x47, 0x00, 0x9E, 0xA9, 0x00, 0x1C, 0x63, 0x00, 0x02, 0x00, 0xB2, 0xB3, 0x26, 0x39,
+    0x00, 0x30, 0x7F, 0x00, 0x02, 0x00, 0xB1, 0xB3, 0x42, 0x63, 0x00, 0x30, 0x7F, 0x00, 0x04, 0x00,
+    0xB1, 0xB6, 0xBC, 0xBD, 0x42, 0x63, 0x00, 0x10, 0x68, 0x00, 0xA6, 0xA9, 0x00, 0x10, 0x68, 0x00,
+    0x02, 0x00, 0xBA, 0xBB, 0x20, 0x65, 0x00, 0x1C, 0x63, 0x00, 0x01, 0x00, 0x82, 0xB2, 0xA9, 0x00,
+    0x01, 0x00, 0x80, 0xBA, 0xA9, 0x00, 0x01, 0x00, 0x82, 0x20, 0x65, 0x00, 0x01, 0x00, 0xBC, 0xAC,
+    0x63, 0x00, 0x02, 0x00, 0xB8, 0xBE, 0xBE, 0xA9, 0x00, 0x2E, 0x65, 0x00, 0x01, 0x00, 0xB4, 0xC2,
+    0xA9, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE, 0x1C, 0x63, 0x00, 0xD0, 0x73, 0x00, 0x18, 0x63,
+    0x00, 0xC8, 0xA9, 0x00, 0x03, 0x00, 0x8B, 0x8E, 0x91, 0x18, 0x63, 0x00, 0x80, 0x69, 0x00, 0xD0,
+    0x73, 0x00, 0x01, 0x00, 0x80, 0x26, 0x39, 0x00, 0x01, 0x00, 0xB8, 0x3E, 0xA8, 0x00, 0x01, 0x00,
+    0x8F, 0x3C, 0x79, 0x00, 0x01, 0x00, 0xBB, 0x26, 0x39, 0x00, 0x03, 0x00, 0xB0, 0xB5, 0xB8, 0xD0,
+    0xA9, 0x00, 0xD6, 0xA9, 0x00, 0x18, 0x63, 0x00, 0x01, 0x00, 0x91, 0xB0, 0x67, 0x00, 0x04, 0x00,
+    0xB0, 0xB5, 0xB8, 0xBE, 0x8E, 0x63, 0x00, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00,
+    0x02, 0x00, 0xB0, 0xBE, 0xFA, 0x62, 0x00, 0xFA, 0x62, 0x00, 0x01, 0x00, 0xB8, 0x50, 0xA9, 0x00,
+    0x01, 0x00, 0xBE, 0xE2, 0xA9, 0x00, 0x01, 0x00, 0xBF, 0xB0, 0x63, 0x00, 0x03, 0x00, 0x82, 0x85,
+    0x89, 0xB4, 0x69, 0x00, 0x42, 0x63, 0x00, 0x24, 0x65, 0x00, 0x01, 0x00, 0x83, 0xE8, 0xA9, 0x00,
+    0x03, 0x00, 0xB1, 0xB2, 0xB3, 0xF0, 0xA9, 0x00, 0x0C, 0x65, 0x00, 0x42, 0x63, 0x00, 0x02, 0x00,
+    0x81, 0x88, 0xF8, 0xA9, 0x00, 0x10, 0x68, 0x00, 0x01, 0x00, 0xB8, 0xF0, 0x6B, 0x00, 0x01, 0x00,
+    0x82, 0x00, 0xAA, 0x00, 0x02, 0x00, 0xB5, 0xB8, 0x08, 0xAA, 0x00, 0x2E, 0x65, 0x00, 0x01, 0x00,
+    0xB2, 0x0E, 0x66, 0x00, 0x01, 0x00, 0x83, 0xBE, 0xA9, 0x00, 0x01, 0x00, 0xB0, 0x10, 0x6C, 0x00,
+    0x01, 0x00, 0x82, 0x14, 0x63, 0x00, 0x04, 0x00, 0xB1, 0xB3, 0xBC, 0xBF, 0x18, 0x63, 0x00, 0xD4,
+    0x65, 0x00, 0x1C, 0x63, 0x00, 0x18, 0x63, 0x00, 0x03, 0x00, 0x80, 0x82, 0x88, 0xD4, 0x65, 0x00,
+    0x18, 0x63, 0x00, 0x18, 0x63, 0x00, 0x01, 0x00, 0x8F, 0xFA, 0x62, 0x00, 0x03, 0x00, 0xB4, 0xBA,
+    0xBF, 0xD4, 0x65, 0x00, 0xD4, 0x65, 0x00, 0x18, 0x63, 0x00, 0x03, 0x00, 0x81, 0x85, 0x87, 0x0E,
+    0xAA, 0x00, 0xD4, 0x65, 0x00, 0x36, 0x63, 0x00, 0x01, 0x00, 0xB1, 0xAC, 0x63, 0x00, 0x01, 0x00,
+    0xBA, 0x18, 0x63, 0x00, 0x01, 0x00, 0x82, 0x2E, 0x6D, 0x00, 0x01, 0x00, 0x81, 0x1A, 0xAA, 0x00,
+    0x02, 0x00, 0xB4, 0xBA, 0xE2, 0xA8, 0x00, 0xF0, 0x66, 0x00, 0x01, 0x00, 0x81, 0x20, 0x65, 0x00,
+    0x01, 0x00, 0xB6, 0x26, 0x39, 0x00, 0x01, 0x00, 0x80, 0x68, 0x75, 0x00, 0x01, 0x00, 0xBB, 0x80,
+    0x69, 0x00, 0x01, 0x00, 0x80, 0x94, 0x63, 0x00, 0x03, 0x00, 0xB0, 0xB5, 0xBE, 0x2E, 0x65, 0x00,
+    0x24, 0xAA, 0x00, 0xFA, 0x62, 0x00, 0x03, 0x00, 0xB0, 0xB8, 0xBA, 0x1C, 0x63, 0x00, 0x2E, 0x65,
+    0x00, 0x1C, 0x63, 0x00, 0x02, 0x00, 0x8B, 0x8C, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x03, 0x00,
+    0xB0, 0xB8, 0xBE, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00, 0x2E, 0x65, 0x00, 0x01, 0x00, 0x81, 0x1C,
+    0x63, 0x00, 0x03, 0x00, 0xB5, 0xBB, 0xBE, 0x1C, 0x63, 0x00, 0x2C, 0xAA, 0x00, 0x32, 0xAA, 0x00,
+    0x02, 0x00, 0x80, 0x83, 0xFA, 0x62, 0x00, 0x56, 0x66, 0x00, 0x01, 0x00, 0xBE, 0x80, 0x69, 0x00,
+    0x04, 0x00, 0xB2, 0xBA, 0xBC, 0xBD, 0x38, 0xAA, 0x00, 0x18, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x1C,
+    0x63, 0x00, 0x02, 0x00, 0x82, 0x85, 0xFC, 0xA8, 0x00, 0x2E, 0x65, 0x00, 0x01, 0x00, 0x80, 0x3E,
+    0xAA, 0x00, 0x01, 0x00, 0x82, 0x44, 0xAA, 0x00, 0x01, 0x00, 0x81, 0x4C, 0xAA, 0x00, 0x03, 0x00,
+    0xB0, 0xB5, 0xBE, 0x14, 0x63, 0x00, 0x52, 0xAA, 0x00, 0x58, 0xAA, 0x00, 0x03, 0x00, 0x83, 0x8B,
+    0x8E, 0x18, 0x63, 0x00, 0x14, 0x63, 0x00, 0x5E, 0xAA, 0x00, 0x01, 0x00, 0xBA, 0x2A, 0x75, 0x00,
+    0x01, 0x00, 0xB5, 0x18, 0x63, 0x00, 0x01, 0x00, 0x91, 0x18, 0x63, 0x00, 0x04, 0x00, 0xB4, 0xBA,
+    0xBC, 0xBF, 0x64, 0xAA, 0x00, 0xFC, 0xA7, 0x00, 0x6E, 0xAA, 0x00, 0xF0, 0x66, 0x00, 0x02, 0x00,
+    0x81, 0x85, 0x74, 0xAA, 0x00, 0x7A, 0xAA, 0x00, 0x01, 0x00, 0xBE, 0x7E, 0xAA, 0x00, 0x04, 0x00,
+    0xB1, 0xB2, 0xBA, 0xBB, 0x84, 0xAA, 0x00, 0xDA, 0x63, 0x00, 0xA2, 0x6D, 0x00, 0x26, 0x39, 0x00,
+    0x01, 0x00, 0x84, 0xE2, 0xA8, 0x00, 0x01, 0x00, 0xBF, 0x36, 0xA8, 0x00, 0x02, 0x00, 0xB4, 0xBA,
+    0x8C, 0xAA, 0x00, 0xFC, 0xA7, 0x00, 0x03, 0x00, 0xB0, 0xB5, 0xBE, 0x92, 0xAA, 0x00, 0x42, 0x63,
+    0x00, 0xB4, 0x69, 0x00, 0x01, 0x00, 0x83, 0x9C, 0xAA, 0x00, 0x03, 0x00, 0xB0, 0xB8, 0xBE, 0x90,
+    0xA8, 0x00, 0xD8, 0x75, 0x00, 0xA2, 0xAA, 0x00, 0x02, 0x00, 0xB5, 0xBE, 0xA4, 0x82, 0x00, 0x64,
+    0x69, 0x00, 0x02, 0x00, 0xB0, 0xBB, 0xD8, 0x75, 0x00, 0x42, 0x63, 0x00, 0x03, 0x00, 0xB5, 0xB8,
+    0xBE, 0x18, 0x63, 0x00, 0x18, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x01, 0x00, 0x87, 0x26, 0x39, 0x00,
+    0x01, 0x00, 0xBB, 0x68, 0x75, 0x00, 0x01, 0x00, 0xB1, 0xE2, 0xA8, 0x00, 0x01, 0x00, 0x82, 0xA8,
+    0xAA, 0x00, 0x01, 0x00, 0xB0, 0x64, 0x69, 0x00, 0x01, 0x00, 0xBE, 0xB0, 0xAA, 0x00, 0x02, 0x00,
+    0xB1, 0xBF, 0x18, 0x63, 0x00, 0x2A, 0x6B, 0x00, 0x01, 0x00, 0x87, 0xD4, 0x65, 0x00, 0x01, 0x00,
+    0xB2, 0x20, 0x65, 0x00, 0x03, 0x00, 0xBB, 0xBC, 0xBF, 0xC8, 0x67, 0x00, 0xB6, 0xAA, 0x00, 0x42,
+    0x63, 0x00, 0x01, 0x00, 0xBA, 0x26, 0x67, 0x00, 0x01, 0x00, 0x87, 0x26, 0x67, 0x00, 0x02, 0x00,
+    0xB2, 0xBB, 0xD4, 0x65, 0x00, 0x18, 0x63, 0x00, 0x02, 0x00, 0x80, 0x83, 0xBC, 0xAA, 0x00, 0x1C,
+    0x63, 0x00, 0x01, 0x00, 0xB4, 0xAC, 0x63, 0x00, 0x01, 0x00, 0x85, 0xAC, 0x63, 0x00, 0x01, 0x00,
+    0xBB, 0xAC, 0x63, 0x00, 0x01, 0x00, 0xBD, 0xC6, 0xAA, 0x00, 0x01, 0x00, 0xB0, 0x2E, 0x65, 0x00,
+    0x01, 0x00, 0xB7, 0xAC, 0x63, 0x00, 0x03, 0x00, 0xB2, 0xB4, 0xB6, 0xAC, 0x63, 0x00, 0x66, 0x67,
+    0x00, 0xAC, 0x63, 0x00, 0x01, 0x00, 0xB0, 0xD0, 0xAA, 0x00, 0x01, 0x00, 0x82, 0xAC, 0x63, 0x00,
+    0x03, 0x00, 0xB2, 0xBB, 0xBD, 0x42, 0x63, 0x00, 0xD6, 0xAA, 0x00, 0x42, 0x63, 0x00, 0x01, 0x00,
+    0x8F, 0x26, 0x39, 0x00, 0x01, 0x00, 0xB7, 0x42, 0x63, 0x00, 0x01, 0x00, 0xB0, 0x1C, 0x63, 0x00,
+    0x02, 0x00, 0xBB, 0xBD, 0x26, 0x39, 0x00, 0x30, 0x7F, 0x00, 0x01, 0x00, 0x8E, 0xB0, 0x67, 0x00,
+    0x01, 0x00, 0xB8, 0x42, 0x63, 0x00, 0x01, 0x00, 0xB6, 0xBE, 0xA9, 0x00, 0x03, 0x00, 0xB7, 0xBD,
+    0xBF, 0xFA, 0x62, 0x00, 0x94, 0x63, 0x00, 0x18, 0x63, 0x00, 0x01, 0x00, 0x80, 0x66, 0x67, 0x00,
+    0x01, 0x00, 0xBF, 0xE2, 0xA8, 0x00, 0x02, 0x00, 0xB1, 0xBF, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00,
+    0x05, 0x00, 0xB2, 0xB5, 0xB9, 0xBA, 0xBD, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00,
+    0x42, 0x63, 0x00, 0x42, 0x63, 0x00, 0x04, 0x00, 0x82, 0x8E, 0x8F, 0x91, 0x42, 0x63, 0x00, 0x42,
+    0x63, 0x00, 0x26, 0x39, 0x00, 0x42, 0x63, 0x00, 0x02, 0x00, 0xB5, 0xB8, 0x42, 0x63, 0x00, 0xFA,
+    0x62, 0x00, 0x01, 0x00, 0xBC, 0x66, 0x67, 0x00, 0x02, 0x00, 0xB3, 0xB6, 0x18, 0x63, 0x00, 0x18,
+    0x63, 0x00, 0x01, 0x00, 0xBD, 0x26, 0x39, 0x00, 0x01, 0x00, 0xBF, 0x3E, 0x71, 0x00, 0x02, 0x00,
+    0xB0, 0xBB, 0xFA, 0x62, 0x00, 0x42, 0x63, 0x00, 0x02, 0x00, 0xB3, 0xB5, 0x1C, 0x63, 0x00, 0xDC,
+    0xAA, 0x00, 0x01, 0x00, 0x91, 0xDC, 0xAA, 0x00, 0x02, 0x00, 0xBD, 0xBF, 0x1C, 0x63, 0x00, 0x18,
+    0x63, 0x00, 0x04, 0x00, 0xB2, 0xB5, 0xBA, 0xBE, 0xFA, 0x62, 0x00, 0x42, 0x63, 0x00, 0x1C, 0x63,
+    0x00, 0x42, 0x63, 0x00, 0x02, 0x00, 0x80, 0x91, 0xE0, 0xAA, 0x00, 0x42, 0x63, 0x00, 0x02, 0x00,
+    0x81, 0x87, 0xAC, 0x63, 0x00, 0x42, 0x63, 0x00, 0x01, 0x00, 0x81, 0xEA, 0xAA, 0x00, 0x01, 0x00,
+    0xB5, 0x16, 0x82, 0x00, 0x01, 0x00, 0x80, 0x3E, 0x71, 0x00, 0x02, 0x00, 0xB5, 0xBE, 0xBC, 0x3B,
+    0x00, 0x10, 0x6C, 0x00, 0x01, 0x00, 0x8C, 0xFA, 0x62, 0x00, 0x01, 0x00, 0xB1, 0x1C, 0x63, 0x00,
+    0x01, 0x00, 0xB5, 0x10, 0x6C, 0x00, 0x01, 0x00, 0xB0, 0xEE, 0xAA, 0x00, 0x02, 0x00, 0x87, 0x91,
+    0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0x01, 0x00, 0xBE, 0x32, 0x65, 0x00, 0x02, 0x00, 0xB0, 0xB4,
+    0xF4, 0xAA, 0x00, 0x26, 0xA8, 0x00, 0x01, 0x00, 0xBA, 0xD4, 0x65, 0x00, 0x01, 0x00, 0x82, 0xFC,
+    0xAA, 0x00, 0x02, 0x00, 0x80, 0x83, 0x3A, 0x77, 0x00, 0x14, 0x63, 0x00, 0x01, 0x00, 0xB8, 0xBE,
+    0xA9, 0x00, 0x02, 0x00, 0xB5, 0xBE, 0xD0, 0x73, 0x00, 0x18, 0x63, 0x00, 0x04, 0x00, 0x83, 0x8B,
+    0x8F, 0x91, 0x18, 0x63, 0x00, 0x18, 0x63, 0x00, 0x24, 0x65, 0x00, 0xD0, 0x73, 0x00, 0x01, 0x00,
+    0xB9, 0x42, 0x63, 0x00, 0x01, 0x00, 0xBE, 0x02, 0xAB, 0x00, 0x01, 0x00, 0xBE, 0xF0, 0x6B, 0x00,
+    0x01, 0x00, 0xB5, 0x2E, 0x65, 0x00, 0x01, 0x00, 0xB8, 0x14, 0x63, 0x00, 0x01, 0x00, 0xB8, 0x3A,
+    0xA8, 0x00, 0x01, 0x00, 0xBD, 0x3C, 0x63, 0x00, 0x02, 0x00, 0xB0, 0xB8, 0xFA, 0x62, 0x00, 0x42,
+    0x63, 0x00, 0x01, 0x00, 0x82, 0x60, 0x66, 0x00, 0x01, 0x00, 0xBC, 0x0C, 0xAB, 0x00, 0x01, 0x00,
+    0x86, 0x36, 0xA8, 0x00, 0x01, 0x00, 0xBE, 0x12, 0xAB, 0x00, 0x01, 0x00, 0x81, 0xDE, 0x81, 0x00,
+    0x01, 0x00, 0xBD, 0x18, 0xAB, 0x00, 0x02, 0x00, 0xBA, 0xBF, 0x22, 0xAB, 0x00, 0x28, 0xAB, 0x00,
+    0x01, 0x00, 0xBF, 0xBE, 0x47, 0x00, 0x02, 0x00, 0x82, 0x83, 0xEC, 0x7A, 0x00, 0xBE, 0x47, 0x00,
+    0x01, 0x00, 0xBE, 0x2E, 0xAB, 0x00, 0x03, 0x00, 0xB0, 0xBA, 0xBF, 0xFA, 0x62, 0x00, 0x64, 0x69,
+    0x00, 0xD4, 0x65, 0x00, 0x03, 0x00, 0xB0, 0xB2, 0xBA, 0x1C, 0x63, 0x00, 0x60, 0x66, 0x00, 0x1C,
+    0x63, 0x00, 0x01, 0x00, 0xBA, 0xE2, 0xA8, 0x00, 0x02, 0x00, 0x81, 0x83, 0x04, 0x6E, 0x00, 0x24,
+    0x65, 0x00, 0x02, 0x00, 0x81, 0x83, 0x8C, 0x72, 0x00, 0xBE, 0xA9, 0x00, 0x01, 0x00, 0xB7, 0xFC,
+    0xA7, 0x00, 0x01, 0x00, 0xBD, 0x34, 0xAB, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE, 0x3A, 0xAB,
+    0x00, 0x2E, 0x65, 0x00, 0x2E, 0x65, 0x00, 0x48, 0xAB, 0x00, 0x01, 0x00, 0x83, 0x4E, 0xAB, 0x00,
+    0x01, 0x00, 0xB0, 0x7A, 0x69, 0x00, 0x01, 0x00, 0x8B, 0x18, 0x63, 0x00, 0x01, 0x00, 0x81, 0x8C,
+    0x72, 0x00, 0x01, 0x00, 0x80, 0x80, 0x69, 0x00, 0x02, 0x00, 0xB2, 0xBB, 0x54, 0xAB, 0x00, 0x42,
+    0x63, 0x00, 0x01, 0x00, 0x8F, 0x58, 0xAB, 0x00, 0x01, 0x00, 0xB2, 0xAC, 0x63, 0x00, 0x03, 0x00,
+    0xB0, 0xB5, 0xB8, 0x2E, 0x65, 0x00, 0x24, 0x65, 0x00, 0x18, 0x63, 0x00, 0x02, 0x00, 0xB5, 0xBE,
+    0xEE, 0xAA, 0x00, 0xD0, 0x78, 0x00, 0x01, 0x00, 0x87, 0x24, 0x65, 0x00, 0x02, 0x00, 0x8E, 0x8F,
+    0x14, 0x63, 0x00, 0x14, 0x63, 0x00, 0x01, 0x00, 0xB4, 0xF0, 0x66, 0x00, 0x01, 0x00, 0x81, 0x24,
+    0x65, 0x00, 0x01, 0x00, 0xBE, 0x5E, 0xAB, 0x00, 0x01, 0x00, 0xBA, 0xF0, 0x66, 0x00, 0x02, 0x00,
+    0xB5, 0xB8, 0x18, 0x63, 0x00, 0x18, 0x63, 0x00, 0x01, 0x00, 0x8B, 0x42, 0x63, 0x00, 0x02, 0x00,
+    0xB0, 0xB5, 0x14, 0x63, 0x00, 0xFA, 0x62, 0x00, 0x01, 0x00, 0xBE, 0x56, 0x66, 0x00, 0x01, 0x00,
+    0x83, 0x80, 0x69, 0x00, 0x01, 0x00, 0xBD, 0x66, 0xAB, 0x00, 0x02, 0x00, 0xBD, 0xBE, 0xF0, 0x66,
+    0x00, 0x18, 0x63, 0x00, 0x01, 0x00, 0xBB, 0x60, 0x66, 0x00, 0x01, 0x00, 0x80, 0x3C, 0x63, 0x00,
+    0x01, 0x00, 0x82, 0xB8, 0x66, 0x00, 0x02, 0x00, 0x81, 0x88, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00,
+    0x01, 0x00, 0x82, 0x6C, 0xAB, 0x00, 0x01, 0x00, 0x81, 0x3A, 0xA8, 0x00, 0x01, 0x00, 0x81, 0x8A,
+    0xA8, 0x00, 0x03, 0x00, 0xBC, 0xBD, 0xBE, 0x70, 0xAB, 0x00, 0x14, 0x63, 0x00, 0x1C, 0x63, 0x00,
+    0x03, 0x00, 0xB2, 0xBA, 0xBD, 0x10, 0x68, 0x00, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00, 0x02, 0x00,
+    0x81, 0x8F, 0x10, 0x68, 0x00, 0x14, 0x63, 0x00, 0x02, 0x00, 0xB7, 0xBC, 0x42, 0x63, 0x00, 0x14,
+    0x63, 0x00, 0x02, 0x00, 0x81, 0x82, 0x10, 0x68, 0x00, 0xF0, 0x66, 0x00, 0x01, 0x00, 0xBC, 0x26,
+    0x39, 0x00, 0x01, 0x00, 0x85, 0x26, 0x39, 0x00, 0x01, 0x00, 0xB6, 0xC8, 0x67, 0x00, 0x01, 0x00,
+    0xBF, 0x42, 0x63, 0x00, 0x01, 0x00, 0x80, 0xCC, 0xA8, 0x00, 0x01, 0x00, 0xB0, 0xBC, 0x3B, 0x00,
+    0x01, 0x00, 0x8C, 0x78, 0xAB, 0x00, 0x01, 0x00, 0xB8, 0x38, 0x73, 0x00, 0x01, 0x00, 0x81, 0xBC,
+    0x3B, 0x00, 0x01, 0x00, 0xB2, 0x3E, 0x71, 0x00, 0x03, 0x00, 0xBA, 0xBC, 0xBF, 0x18, 0x63, 0x00,
+    0xF0, 0x66, 0x00, 0x18, 0x63, 0x00, 0x01, 0x00, 0xBE, 0x7E, 0xAB, 0x00, 0x02, 0x00, 0xBB, 0xBE,
+    0x1C, 0x63, 0x00, 0x20, 0x65, 0x00, 0x02, 0x00, 0x81, 0x87, 0xCA, 0x6D, 0x00, 0x1C, 0x63, 0x00,
+    0x04, 0x00, 0xB1, 0xB4, 0xB7, 0xBE, 0xBE, 0x47, 0x00, 0x1C, 0x63, 0x00, 0x42, 0x63, 0x00, 0xEA,
+    0xAA, 0x00, 0x02, 0x00, 0x82, 0x85, 0x42, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x05, 0x00, 0xB0, 0xB1,
+    0xB5, 0xBA, 0xBE, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x42, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x1C,
+    0x63, 0x00, 0x06, 0x00, 0x80, 0x81, 0x84, 0x85, 0x8D, 0x91, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00,
+    0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x42, 0x63, 0x00, 0x01, 0x00, 0xB4, 0x1C,
+    0x63, 0x00, 0x01, 0x00, 0xBD, 0x84, 0xAB, 0x00, 0x03, 0x00, 0xB8, 0xBB, 0xBE, 0x1C, 0x63, 0x00,
+    0x18, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x03, 0x00, 0xB0, 0xB5, 0xBE, 0x8A, 0xAB, 0x00, 0x2E, 0x65,
+    0x00, 0x1C, 0x63, 0x00, 0x02, 0x00, 0x80, 0x83, 0x18, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x01, 0x00,
+    0xBA, 0xAC, 0x63, 0x00, 0x01, 0x00, 0x8F, 0xBE, 0x47, 0x00, 0x02, 0x00, 0x82, 0x89, 0xBE, 0x47,
+    0x00, 0xBC, 0x3B, 0x00, 0x02, 0x00, 0xB5, 0xBB, 0x26, 0x39, 0x00, 0xFA, 0x62, 0x00, 0x01, 0x00,
+    0xBE, 0x26, 0x39, 0x00, 0x01, 0x00, 0xB0, 0x90, 0xAB, 0x00, 0x01, 0x00, 0xB8, 0xA0, 0x66, 0x00,
+    0x01, 0x00, 0x82, 0x96, 0xAB, 0x00, 0x01, 0x00, 0xBB, 0x30, 0x7F, 0x00, 0x01, 0x00, 0x80, 0xA0,
+    0xAB, 0x00, 0x02, 0x00, 0xB6, 0xBE, 0x18, 0x63, 0x00, 0x2E, 0x65, 0x00, 0x01, 0x00, 0xBE, 0xA6,
+    0xAB, 0x00, 0x01, 0x00, 0xBD, 0x2A, 0x75, 0x00, 0x04, 0x00, 0xB1, 0xBA, 0xBB, 0xBF, 0xFA, 0x62,
+    0x00, 0xAA, 0xAB, 0x00, 0xD4, 0x65, 0x00, 0x2E, 0x6D, 0x00, 0x01, 0x00, 0xBE, 0xBC, 0x3B, 0x00,
+    0x01, 0x00, 0x8B, 0xBC, 0x3B, 0x00, 0x01, 0x00, 0xBF, 0x26, 0x39, 0x00, 0x02, 0x00, 0xBC, 0xBF,
+    0xF0, 0x66, 0x00, 0xB0, 0x67, 0x00, 0x02, 0x00, 0xB2, 0xBB, 0x3E, 0x71, 0x00, 0x18, 0x63, 0x00,
+    0x01, 0x00, 0xB5, 0xAC, 0x63, 0x00, 0x03, 0x00, 0xB8, 0xBB, 0xBE, 0xB2, 0xAB, 0x00, 0xFA, 0x62,
+    0x00, 0xB8, 0xAB, 0x00, 0x02, 0x00, 0xB4, 0xBE, 0x3E, 0x71, 0x00, 0xD0, 0xA9, 0x00, 0x02, 0x00,
+    0xB0, 0xBB, 0xBE, 0xAB, 0x00, 0xC4, 0xAB, 0x00, 0x01, 0x00, 0xB0, 0x2E, 0x72, 0x00, 0x02, 0x00,
+    0xB2, 0xB3, 0xFA, 0x62, 0x00, 0xB0, 0x67, 0x00, 0x02, 0x00, 0xBA, 0xBF, 0x20, 0x65, 0x00, 0xD4,
+    0x65, 0x00, 0x01, 0x00, 0x80, 0xCC, 0xAB, 0x00, 0x01, 0x00, 0xBD, 0x18, 0x63, 0x00, 0x01, 0x00,
+    0xBB, 0xD0, 0xAB, 0x00, 0x01, 0x00, 0xBD, 0xD6, 0xAB, 0x00, 0x01, 0x00, 0x82, 0xDA, 0xAB, 0x00,
+    0x02, 0x00, 0xB0, 0xB5, 0xBE, 0x47, 0x00, 0xBE, 0x47, 0x00, 0x02, 0x00, 0x83, 0x91, 0xBE, 0x47,
+    0x00, 0xBE, 0x47, 0x00, 0x01, 0x00, 0x8C, 0xBE, 0x47, 0x00, 0x02, 0x00, 0xB8, 0xBE, 0x18, 0x63,
+    0x00, 0xBC, 0x3B, 0x00, 0x01, 0x00, 0xBA, 0xAA, 0xAB, 0x00, 0x01, 0x00, 0xBD, 0xFA, 0x62, 0x00,
+    0x02, 0x00, 0x80, 0x8C, 0xFA, 0x62, 0x00, 0xFA, 0x62, 0x00, 0x01, 0x00, 0xBB, 0xB0, 0x67, 0x00,
+    0x01, 0x00, 0xBB, 0xF0, 0x66, 0x00, 0x01, 0x00, 0x82, 0xCC, 0xAB, 0x00, 0x01, 0x00, 0xBE, 0x4A,
+    0xA9, 0x00, 0x01, 0x00, 0x8F, 0x14, 0x63, 0x00, 0x01, 0x00, 0xBD, 0x26, 0xA8, 0x00, 0x02, 0x00,
+    0xB8, 0xBE, 0xE4, 0xAB, 0x00, 0xEA, 0xAB, 0x00, 0x02, 0x00, 0xB3, 0xBB, 0xFA, 0x62, 0x00, 0xFA,
+    0x62, 0x00, 0x01, 0x00, 0xB0, 0x8C, 0x71, 0x00, 0x01, 0x00, 0x82, 0xF0, 0xAB, 0x00, 0x01, 0x00,
+    0xB8, 0xF6, 0xAB, 0x00, 0x03, 0x00, 0xB2, 0xB4, 0xBD, 0x18, 0x63, 0x00, 0x26, 0x39, 0x00, 0x18,
+    0x63, 0x00, 0x01, 0x00, 0x80, 0xFC, 0xAB, 0x00, 0x02, 0x00, 0xB7, 0xBF, 0xFA, 0x62, 0x00, 0x0E,
+    0x63, 0x00, 0x01, 0x00, 0x81, 0xF6, 0xA8, 0x00, 0x02, 0x00, 0xB5, 0xBB, 0x42, 0x63, 0x00, 0x42,
+    0x63, 0x00, 0x01, 0x00, 0xB4, 0x20, 0x65, 0x00, 0x04, 0x00, 0xB5, 0xB6, 0xB9, 0xBC, 0x34, 0x49,
+    0x00, 0x42, 0x63, 0x00, 0x34, 0x49, 0x00, 0x34, 0x49, 0x00, 0x02, 0x00, 0x80, 0x8E, 0x42, 0x63,
+    0x00, 0x34, 0x49, 0x00, 0x04, 0x00, 0xBA, 0xBC, 0xBD, 0xBF, 0xA0, 0xAB, 0x00, 0x18, 0x63, 0x00,
+    0x18, 0x63, 0x00, 0xD4, 0x65, 0x00, 0x01, 0x00, 0xB8, 0xBC, 0x3B, 0x00, 0x01, 0x00, 0xB8, 0xC8,
+    0x67, 0x00, 0x02, 0x00, 0xBA, 0xBB, 0xD4, 0x65, 0x00, 0xCC, 0xAB, 0x00, 0x02, 0x00, 0x80, 0x8C,
+    0x20, 0x65, 0x00, 0x2E, 0x65, 0x00, 0x02, 0x00, 0x82, 0x88, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00,
+    0x01, 0x00, 0xB8, 0x14, 0x68, 0x00, 0x01, 0x00, 0xB4, 0x2E, 0x65, 0x00, 0x01, 0x00, 0x81, 0xC8,
+    0xA8, 0x00, 0x01, 0x00, 0xBA, 0x34, 0x49, 0x00, 0x01, 0x00, 0xBD, 0x66, 0x67, 0x00, 0x01, 0x00,
+    0xB2, 0x04, 0xAC, 0x00, 0x01, 0x00, 0x80, 0x10, 0x6C, 0x00, 0x01, 0x00, 0xB7, 0xF0, 0x66, 0x00,
+    0x03, 0x00, 0xB0, 0xB5, 0xB8, 0x0A, 0xAC, 0x00, 0xFA, 0x62, 0x00, 0x9A, 0x64, 0x00, 0x02, 0x00,
+    0x8F, 0x91, 0x42, 0x63, 0x00, 0xFA, 0x62, 0x00, 0x02, 0x00, 0xB4, 0xBD, 0xD4, 0x65, 0x00, 0x10,
+    0xAC, 0x00, 0x02, 0x00, 0xBB, 0xBE, 0xD4, 0x65, 0x00, 0xAC, 0x63, 0x00, 0x02, 0x00, 0x80, 0x83,
+    0x18, 0xAC, 0x00, 0x2E, 0x65, 0x00, 0x04, 0x00, 0xB2, 0xBB, 0xBD, 0xBE, 0x18, 0x63, 0x00, 0xD4,
+    0x65, 0x00, 0x18, 0x63, 0x00, 0x18, 0x63, 0x00, 0x02, 0x00, 0xB4, 0xBB, 0x9A, 0x64, 0x00, 0xFA,
+    0x62, 0x00, 0x01, 0x00, 0x80, 0x1E, 0xAC, 0x00, 0x02, 0x00, 0xB6, 0xBE, 0xD4, 0x65, 0x00, 0x8C,
+    0x71, 0x00, 0x03, 0x00, 0xBA, 0xBD, 0xBF, 0xAC, 0x63, 0x00, 0x66, 0x67, 0x00, 0xD4, 0x65, 0x00,
+    0x03, 0x00, 0x82, 0x85, 0x87, 0x26, 0xA8, 0x00, 0xD4, 0x65, 0x00, 0xD4, 0x65, 0x00, 0x02, 0x00,
+    0xB2, 0xBB, 0xD4, 0x65, 0x00, 0x66, 0x67, 0x00, 0x01, 0x00, 0xB0, 0x24, 0xAC, 0x00, 0x01, 0x00,
+    0x81, 0x2C, 0xAC, 0x00, 0x03, 0x00, 0xBA, 0xBB, 0xBF, 0x36, 0xAC, 0x00, 0x18, 0x63, 0x00, 0xF0,
+    0x66, 0x00, 0x02, 0x00, 0x82, 0x8C, 0xF0, 0xA8, 0x00, 0x3C, 0xAC, 0x00, 0x02, 0x00, 0xB1, 0xBF,
+    0x26, 0xA8, 0x00, 0xE2, 0xA8, 0x00, 0x01, 0x00, 0xBE, 0x24, 0x65, 0x00, 0x03, 0x00, 0xB2, 0xB4,
+    0xBE, 0x18, 0x63, 0x00, 0xFA, 0x62, 0x00, 0x66, 0x67, 0x00, 0x01, 0x00, 0xB0, 0x42, 0xAC, 0x00,
+    0x02, 0x00, 0x88, 0x91, 0xF0, 0x66, 0x00, 0xBC, 0x3B, 0x00, 0x03, 0x00, 0xBA, 0xBB, 0xBF, 0xE0,
+    0x67, 0x00, 0x6C, 0x63, 0x00, 0xD4, 0x65, 0x00, 0x01, 0x00, 0x87, 0xFA, 0x62, 0x00, 0x02, 0x00,
+    0xB5, 0xBE, 0xFA, 0x62, 0x00, 0x8E, 0x63, 0x00, 0x01, 0x00, 0xBE, 0x48, 0xAC, 0x00, 0x04, 0x00,
+    0xB0, 0xB5, 0xB8, 0xBE, 0x4E, 0xAC, 0x00, 0xFA, 0x62, 0x00, 0xB4, 0x69, 0x00, 0x6E, 0x75, 0x00,
+    0x03, 0x00, 0x83, 0x8B, 0x8F, 0x5A, 0xAC, 0x00, 0xFA, 0x62, 0x00, 0x24, 0x65, 0x00, 0x01, 0x00,
+    0xB5, 0xA2, 0xAA, 0x00, 0x02, 0x00, 0xBB, 0xBC, 0x62, 0xAC, 0x00, 0xE2, 0xA8, 0x00, 0x02, 0x00,
+    0x81, 0x82, 0xAC, 0x63, 0x00, 0x26, 0x39, 0x00, 0x01, 0x00, 0xB0, 0x68, 0xAC, 0x00, 0x02, 0x00,
+    0xB0, 0xBE, 0x14, 0x63, 0x00, 0xC2, 0x6C, 0x00, 0x01, 0x00, 0x83, 0x72, 0xAC, 0x00, 0x01, 0x00,
+    0xB8, 0x24, 0x65, 0x00, 0x02, 0x00, 0xB5, 0xBA, 0xFA, 0x62, 0x00, 0x20, 0x63, 0x00, 0x03, 0x00,
+    0xB0, 0xB8, 0xBE, 0x4E, 0xAB, 0x00, 0x4E, 0xAB, 0x00, 0x4E, 0xAB, 0x00, 0x01, 0x00, 0xBE, 0x2E,
+    0x6D, 0x00, 0x01, 0x00, 0x8F, 0x12, 0x73, 0x00, 0x02, 0x00, 0xB0, 0xBC, 0x78, 0xAC, 0x00, 0x10,
+    0x68, 0x00, 0x01, 0x00, 0xB8, 0x3C, 0x79, 0x00, 0x02, 0x00, 0xB1, 0xBF, 0x7C, 0xAC, 0x00, 0x82,
+    0xAC, 0x00, 0x02, 0x00, 0x81, 0x82, 0x36, 0x6E, 0x00, 0xE6, 0x70, 0x00, 0x03, 0x00, 0xB0, 0xB5,
+    0xBE, 0x8C, 0xAC, 0x00, 0x92, 0xAC, 0x00, 0x98, 0xAC, 0x00, 0x01, 0x00, 0x91, 0x92, 0xAC, 0x00,
+    0x01, 0x00, 0x87, 0x36, 0xA8, 0x00, 0x02, 0x00, 0xBC, 0xBD, 0x9E, 0xAC, 0x00, 0x42, 0x63, 0x00,
+    0x02, 0x00, 0xB5, 0xB8, 0xA8, 0xAC, 0x00, 0xFA, 0x62, 0x00, 0x02, 0x00, 0xB5, 0xB8, 0xAE, 0xAC,
+    0x00, 0x14, 0x63, 0x00, 0x01, 0x00, 0x83, 0xC2, 0x6C, 0x00, 0x02, 0x00, 0xB1, 0xB2, 0xB4, 0xAC,
+    0x00, 0x26, 0x39, 0x00, 0x03, 0x00, 0xB0, 0xB5, 0xB8, 0x10, 0x6C, 0x00, 0xD8, 0x75, 0x00, 0xFA,
+    0x62, 0x00, 0x01, 0x00, 0x8F, 0x10, 0x6C, 0x00, 0x01, 0x00, 0xBB, 0x94, 0x63, 0x00, 0x03, 0x00,
+    0xB1, 0xBD, 0xBF, 0x24, 0x65, 0x00, 0x26, 0x39, 0x00, 0x42, 0x63, 0x00, 0x01, 0x00, 0x80, 0x4A,
+    0xA8, 0x00, 0x01, 0x00, 0xB3, 0x18, 0x63, 0x00, 0x01, 0x00, 0x82, 0xBA, 0xAC, 0x00, 0x01, 0x00,
+    0xBA, 0xC0, 0xAC, 0x00, 0x01, 0x00, 0xBD, 0x10, 0x68, 0x00, 0x01, 0x00, 0x8E, 0x14, 0x63, 0x00,
+    0x03, 0x00, 0xB1, 0xBB, 0xBF, 0x20, 0x65, 0x00, 0x10, 0x68, 0x00, 0x28, 0xAB, 0x00, 0x01, 0x00,
+    0xB0, 0xD8, 0x75, 0x00, 0x01, 0x00, 0xBC, 0xC6, 0xAC, 0x00, 0x02, 0x00, 0xB5, 0xBE, 0xCC, 0xAC,
+    0x00, 0xD6, 0xAC, 0x00, 0x01, 0x00, 0x91, 0xCC, 0xAC, 0x00, 0x01, 0x00, 0xB5, 0xDC, 0xAC, 0x00,
+    0x01, 0x00, 0xBB, 0xE2, 0xAC, 0x00, 0x01, 0x00, 0x80, 0xE8, 0xAC, 0x00, 0x01, 0x00, 0xBA, 0x14,
+    0x63, 0x00, 0x03, 0x00, 0xB5, 0xB8, 0xBE, 0xF2, 0xAC, 0x00, 0xFC, 0xAC, 0x00, 0xFA, 0x62, 0x00,
+    0x03, 0x00, 0x8E, 0x8F, 0x91, 0x04, 0xAD, 0x00, 0x0E, 0xAD, 0x00, 0x16, 0xAD, 0x00, 0x02, 0x00,
+    0xB2, 0xB7, 0x44, 0xA8, 0x00, 0x5E, 0x74, 0x00, 0x01, 0x00, 0x88, 0x22, 0xAB, 0x00, 0x02, 0x00,
+    0xB5, 0xBE, 0xC2, 0x6C, 0x00, 0xFA, 0x62, 0x00, 0x01, 0x00, 0xBB, 0x3E, 0x71, 0x00, 0x01, 0x00,
+    0xB3, 0x10, 0x68, 0x00, 0x01, 0x00, 0x81, 0x1C, 0xAD, 0x00, 0x01, 0x00, 0x81, 0x22, 0xAB, 0x00,
+    0x02, 0x00, 0xB5, 0xBA, 0x1C, 0x63, 0x00, 0x22, 0xAD, 0x00, 0x02, 0x00, 0xB4, 0xB6, 0x14, 0x63,
+    0x00, 0xE2, 0xA8, 0x00, 0x01, 0x00, 0xB0, 0x80, 0x69, 0x00, 0x05, 0x00, 0xB0, 0xB2, 0xB5, 0xB8,
+    0xBE, 0x2A, 0xAD, 0x00, 0x3A, 0x77, 0x00, 0x42, 0x63, 0x00, 0x34, 0xAD, 0x00, 0x3C, 0xAD, 0x00,
+    0x02, 0x00, 0x83, 0x91, 0x46, 0xAD, 0x00, 0x42, 0x63, 0x00, 0x02, 0x00, 0xB5, 0xBE, 0x50, 0xAD,
+    0x00, 0x56, 0xAD, 0x00, 0x01, 0x00, 0x8B, 0x5C, 0xAD, 0x00, 0x02, 0x00, 0xB8, 0xBE, 0x2E, 0x65,
+    0x00, 0xDA, 0x77, 0x00, 0x01, 0x00, 0xB8, 0x62, 0xAD, 0x00, 0x01, 0x00, 0x8F, 0xA0, 0x68, 0x00,
+    0x01, 0x00, 0xBC, 0xF6, 0xA8, 0x00, 0x02, 0x00, 0x83, 0x8F, 0x10, 0x6C, 0x00, 0xFA, 0x62, 0x00,
+    0x02, 0x00, 0xB2, 0xBC, 0xFA, 0x62, 0x00, 0x3E, 0x71, 0x00, 0x01, 0x00, 0x80, 0x68, 0xAD, 0x00,
+    0x01, 0x00, 0xB8, 0x6E, 0xAD, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBB, 0x2E, 0x65, 0x00, 0x18,
+    0x63, 0x00, 0x18, 0x63, 0x00, 0x18, 0x63, 0x00, 0x01, 0x00, 0xBA, 0x10, 0x68, 0x00, 0x02, 0x00,
+    0x80, 0x85, 0x14, 0x63, 0x00, 0x10, 0x68, 0x00, 0x01, 0x00, 0xB4, 0x74, 0xAD, 0x00, 0x01, 0x00,
+    0xB0, 0xDE, 0x80, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE, 0x7A, 0xAD, 0x00, 0x84, 0xAD, 0x00,
+    0x18, 0x63, 0x00, 0x8E, 0xAD, 0x00, 0x02, 0x00, 0x83, 0x91, 0x4C, 0x77, 0x00, 0x98, 0xAD, 0x00,
+    0x01, 0x00, 0xBC, 0x2E, 0x65, 0x00, 0x02, 0x00, 0xB0, 0xBE, 0x2E, 0x65, 0x00, 0x2E, 0x65, 0x00,
+    0x01, 0x00, 0x88, 0x26, 0x39, 0x00, 0x02, 0x00, 0x80, 0x82, 0x36, 0x6E, 0x00, 0x26, 0x39, 0x00,
+    0x02, 0x00, 0x8B, 0x8F, 0x18, 0x63, 0x00, 0x42, 0x63, 0x00, 0x02, 0x00, 0xB5, 0xB8, 0x18, 0x63,
+    0x00, 0x14, 0x63, 0x00, 0x01, 0x00, 0xB0, 0xA2, 0xAD, 0x00, 0x02, 0x00, 0xB8, 0xBB, 0xBE, 0xA9,
+    0x00, 0xF0, 0x66, 0x00, 0x01, 0x00, 0x82, 0xA8, 0xAD, 0x00, 0x01, 0x00, 0x80, 0x2A, 0x6B, 0x00,
+    0x02, 0x00, 0xB2, 0xB8, 0xFA, 0x62, 0x00, 0xB2, 0xAD, 0x00, 0x01, 0x00, 0xBB, 0xB8, 0xAD, 0x00,
+    0x01, 0x00, 0xBB, 0x56, 0x66, 0x00, 0x02, 0x00, 0xB5, 0xB8, 0xBE, 0xAD, 0x00, 0x14, 0x68, 0x00,
+    0x02, 0x00, 0xBA, 0xBD, 0x60, 0x66, 0x00, 0xFA, 0x62, 0x00, 0x03, 0x00, 0x82, 0x86, 0x87, 0xF0,
+    0xAB, 0x00, 0xFA, 0x62, 0x00, 0xFA, 0x62, 0x00, 0x01, 0x00, 0x81, 0xC4, 0xAD, 0x00, 0x01, 0x00,
+    0xBC, 0x3E, 0x71, 0x00, 0x01, 0x00, 0x8F, 0xBC, 0x3B, 0x00, 0x03, 0x00, 0xBC, 0xBD, 0xBE, 0xCA,
+    0xAD, 0x00, 0xD4, 0xAD, 0x00, 0xDC, 0xAD, 0x00, 0x02, 0x00, 0x81, 0x8E, 0xE0, 0xAD, 0x00, 0x1C,
+    0x63, 0x00, 0x02, 0x00, 0xB2, 0xBA, 0x26, 0x39, 0x00, 0xC8, 0x67, 0x00, 0x02, 0x00, 0xB2, 0xB3,
+    0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0x03, 0x00, 0xB9, 0xBC, 0xBD, 0x26, 0x39, 0x00, 0x26, 0x39,
+    0x00, 0x1C, 0x63, 0x00, 0x01, 0x00, 0x85, 0x1C, 0x63, 0x00, 0x01, 0x00, 0xBD, 0xD4, 0xAD, 0x00,
+    0x01, 0x00, 0x81, 0x66, 0x67, 0x00, 0x02, 0x00, 0xB2, 0xBE, 0x3A, 0x77, 0x00, 0xE6, 0xAD, 0x00,
+    0x01, 0x00, 0x83, 0xEC, 0xAD, 0x00, 0x02, 0x00, 0xB6, 0xBB, 0xAC, 0x63, 0x00, 0xAC, 0x63, 0x00,
+    0x04, 0x00, 0xB2, 0xB4, 0xBB, 0xBD, 0x2E, 0x6D, 0x00, 0x2A, 0x6B, 0x00, 0xD4, 0x65, 0x00, 0x18,
+    0x63, 0x00, 0x01, 0x00, 0x89, 0xAC, 0x63, 0x00, 0x01, 0x00, 0xBD, 0xF2, 0xAD, 0x00, 0x02, 0x00,
+    0xB3, 0xB6, 0x1C, 0x63, 0x00, 0xAC, 0x63, 0x00, 0x02, 0x00, 0x81, 0x82, 0x2E, 0x65, 0x00, 0xB2,
+    0x80, 0x00, 0x01, 0x00, 0xBB, 0xFC, 0xAD, 0x00, 0x01, 0x00, 0xB6, 0xAC, 0x63, 0x00, 0x06, 0x00,
+    0xB2, 0xB7, 0xB9, 0xBB, 0xBC, 0xBE, 0xBC, 0x3B, 0x00, 0x20, 0x65, 0x00, 0x26, 0xA8, 0x00, 0x20,
+    0x65, 0x00, 0x06, 0xAE, 0x00, 0x0C, 0xAE, 0x00, 0x06, 0x00, 0xB2, 0xB3, 0xB4, 0xBA, 0xBB, 0xBF,
+    0xF0, 0x66, 0x00, 0x26, 0xA8, 0x00, 0xE2, 0xA8, 0x00, 0xF0, 0x66, 0x00, 0x12, 0xAE, 0x00, 0x26,
+    0xA8, 0x00, 0x02, 0x00, 0x86, 0x87, 0x42, 0x63, 0x00, 0x1A, 0xAE, 0x00, 0x06, 0x00, 0xB1, 0xB4,
+    0xB6, 0xB7, 0xB8, 0xBF, 0x5A, 0x66, 0x00, 0x24, 0xAE, 0x00, 0xE2, 0xA8, 0x00, 0x2A, 0xAE, 0x00,
+    0xBC, 0x3B, 0x00, 0xF0, 0x66, 0x00, 0x01, 0x00, 0x84, 0x32, 0xAE, 0x00, 0x01, 0x00, 0x85, 0xC8,
+    0x67, 0x00, 0x01, 0x00, 0xBD, 0xF0, 0x66, 0x00, 0x01, 0x00, 0xBA, 0x4A, 0xA8, 0x00, 0x02, 0x00,
+    0xBB, 0xBE, 0xFA, 0x62, 0x00, 0xBE, 0x47, 0x00, 0x01, 0x00, 0xBD, 0x9C, 0x72, 0x00, 0x02, 0x00,
+    0xB6, 0xBE, 0xAC, 0x63, 0x00, 0x38, 0xAE, 0x00, 0x01, 0x00, 0x86, 0xFA, 0x62, 0x00, 0x01, 0x00,
+    0x83, 0x3E, 0x65, 0x00, 0x01, 0x00, 0xB8, 0x3E, 0xAE, 0x00, 0x03, 0x00, 0xB2, 0xB8, 0xBB, 0xAC,
+    0x63, 0x00, 0xAA, 0x7C, 0x00, 0x3E, 0x71, 0x00, 0x01, 0x00, 0xB3, 0xBE, 0x47, 0x00, 0x02, 0x00,
+    0xBA, 0xBD, 0xBE, 0x47, 0x00, 0xBE, 0x47, 0x00, 0x01, 0x00, 0xBE, 0x44, 0xAE, 0x00, 0x01, 0x00,
+    0x81, 0x2A, 0xA8, 0x00, 0x03, 0x00, 0xBA, 0xBB, 0xBF, 0xE2, 0xA8, 0x00, 0xBE, 0x47, 0x00, 0xF0,
+    0x66, 0x00, 0x01, 0x00, 0x82, 0x4A, 0xAE, 0x00, 0x02, 0x00, 0xB0, 0xB2, 0xA4, 0x82, 0x00, 0x20,
+    0x65, 0x00, 0x01, 0x00, 0xB8, 0xBE, 0x47, 0x00, 0x03, 0x00, 0xB0, 0xB5, 0xBE, 0xFA, 0x62, 0x00,
+    0x42, 0x63, 0x00, 0xFA, 0x62, 0x00, 0x02, 0x00, 0x8E, 0x91, 0xFA, 0x62, 0x00, 0x42, 0x63, 0x00,
+    0x01, 0x00, 0x81, 0xF0, 0x66, 0x00, 0x02, 0x00, 0xB2, 0xBA, 0x30, 0x7F, 0x00, 0x14, 0x63, 0x00,
+    0x02, 0x00, 0x80, 0x82, 0x14, 0x63, 0x00, 0x68, 0xAD, 0x00, 0x02, 0x00, 0xB6, 0xBE, 0x14, 0x63,
+    0x00, 0x42, 0x63, 0x00, 0x01, 0x00, 0x82, 0xBE, 0x47, 0x00, 0x01, 0x00, 0xB7, 0x52, 0xAE, 0x00,
+    0x02, 0x00, 0xBB, 0xBD, 0x58, 0xAE, 0x00, 0xAC, 0x63, 0x00, 0x01, 0x00, 0xBE, 0x5E, 0xAE, 0x00,
+    0x03, 0x00, 0xB2, 0xB4, 0xBB, 0xAC, 0x63, 0x00, 0xAC, 0x63, 0x00, 0xAC, 0x63, 0x00, 0x01, 0x00,
+    0xB4, 0x68, 0xAE, 0x00, 0x04, 0x00, 0xBA, 0xBB, 0xBD, 0xBE, 0xBE, 0x47, 0x00, 0xD4, 0x65, 0x00,
+    0x36, 0x63, 0x00, 0xD6, 0x67, 0x00, 0x02, 0x00, 0x80, 0x83, 0x18, 0x63, 0x00, 0xAC, 0x63, 0x00,
+    0x01, 0x00, 0x88, 0xBE, 0x47, 0x00, 0x02, 0x00, 0xBD, 0xBE, 0x20, 0x63, 0x00, 0x70, 0xAE, 0x00,
+    0x02, 0x00, 0xBD, 0xBF, 0x18, 0x63, 0x00, 0x18, 0x63, 0x00, 0x04, 0x00, 0x80, 0x84, 0x85, 0x86,
+    0xD4, 0x65, 0x00, 0xD4, 0x65, 0x00, 0x18, 0x63, 0x00, 0xD4, 0x65, 0x00, 0x03, 0x00, 0xBA, 0xBB,
+    0xBF, 0x78, 0xAE, 0x00, 0x18, 0x63, 0x00, 0xD4, 0x65, 0x00, 0x03, 0x00, 0x81, 0x82, 0x87, 0x7E,
+    0xAE, 0x00, 0xEA, 0x78, 0x00, 0x18, 0x63, 0x00, 0x01, 0x00, 0x87, 0x84, 0xAE, 0x00, 0x02, 0x00,
+    0xBC, 0xBD, 0x14, 0x63, 0x00, 0x14, 0x63, 0x00, 0x03, 0x00, 0xB8, 0xBB, 0xBD, 0x26, 0x39, 0x00,
+    0x94, 0x63, 0x00, 0x66, 0x67, 0x00, 0x01, 0x00, 0x87, 0x66, 0x67, 0x00, 0x02, 0x00, 0x81, 0x82,
+    0xAC, 0x63, 0x00, 0x18, 0x63, 0x00, 0x02, 0x00, 0xB1, 0xBF, 0x2E, 0x65, 0x00, 0x26, 0x39, 0x00,
+    0x01, 0x00, 0x82, 0x48, 0xAB, 0x00, 0x01, 0x00, 0x82, 0x8A, 0xAE, 0x00, 0x01, 0x00, 0x81, 0x90,
+    0xAE, 0x00, 0x01, 0x00, 0xBB, 0x94, 0xAE, 0x00, 0x01, 0x00, 0x81, 0x9A, 0xAE, 0x00, 0x01, 0x00,
+    0xBB, 0xA0, 0xAE, 0x00, 0x01, 0x00, 0xBE, 0xAA, 0xAE, 0x00, 0x01, 0x00, 0x80, 0x8C, 0x64, 0x00,
+    0x04, 0x00, 0xB2, 0xB7, 0xBB, 0xBE, 0x18, 0x63, 0x00, 0x66, 0x67, 0x00, 0xB0, 0xAE, 0x00, 0x8C,
+    0x71, 0x00, 0x02, 0x00, 0x80, 0x8C, 0x18, 0x63, 0x00, 0xBE, 0x47, 0x00, 0x02, 0x00, 0xBB, 0xBC,
+    0xAC, 0x63, 0x00, 0xAC, 0x63, 0x00, 0x02, 0x00, 0xB0, 0xB2, 0xBC, 0xAE, 0x00, 0xD4, 0x65, 0x00,
+    0x02, 0x00, 0x80, 0x8B, 0x18, 0x63, 0x00, 0x2E, 0x72, 0x00, 0x01, 0x00, 0xBE, 0xFE, 0x67, 0x00,
+    0x01, 0x00, 0xB8, 0xC2, 0xAE, 0x00, 0x01, 0x00, 0xBE, 0xBC, 0xAE, 0x00, 0x02, 0x00, 0xB0, 0xBE,
+    0xC8, 0xAE, 0x00, 0x78, 0xAB, 0x00, 0x01, 0x00, 0xBF, 0xFC, 0xA8, 0x00, 0x01, 0x00, 0xBB, 0xCE,
+    0xAE, 0x00, 0x02, 0x00, 0xB3, 0xB6, 0xB0, 0x67, 0x00, 0xD4, 0x65, 0x00, 0x04, 0x00, 0xBA, 0xBB,
+    0xBC, 0xBF, 0xD4, 0xAE, 0x00, 0xBE, 0x47, 0x00, 0x18, 0x63, 0x00, 0xD4, 0x65, 0x00, 0x03, 0x00,
+    0x84, 0x88, 0x8E, 0xAC, 0x63, 0x00, 0xBE, 0x47, 0x00, 0xBE, 0x47, 0x00, 0x02, 0x00, 0xB2, 0xBA,
+    0xE0, 0xAE, 0x00, 0xBE, 0x47, 0x00, 0x01, 0x00, 0x80, 0xE4, 0xAE, 0x00, 0x01, 0x00, 0xB0, 0x26,
+    0x7D, 0x00, 0x02, 0x00, 0xBB, 0xBD, 0xAC, 0x63, 0x00, 0x2E, 0x65, 0x00, 0x01, 0x00, 0xB7, 0xBE,
+    0x47, 0x00, 0x01, 0x00, 0x8E, 0x42, 0x63, 0x00, 0x01, 0x00, 0xB2, 0xEA, 0xAE, 0x00, 0x01, 0x00,
+    0xBA, 0xF2, 0xAE, 0x00, 0x02, 0x00, 0xB0, 0xBB, 0x2E, 0x65, 0x00, 0xFA, 0x62, 0x00, 0x01, 0x00,
+    0xB1, 0x24, 0x65, 0x00, 0x01, 0x00, 0x80, 0x4C, 0x77, 0x00, 0x03, 0x00, 0xB0, 0xB5, 0xB8, 0xFC,
+    0xAE, 0x00, 0x18, 0x63, 0x00, 0x18, 0x63, 0x00, 0x02, 0x00, 0x81, 0x87, 0x3A, 0xA8, 0x00, 0x04,
+    0xAF, 0x00, 0x01, 0x00, 0x87, 0x18, 0x63, 0x00, 0x01, 0x00, 0xB0, 0xBE, 0x47, 0x00, 0x01, 0x00,
+    0xB0, 0x3E, 0x65, 0x00, 0x01, 0x00, 0xB5, 0x0A, 0xAF, 0x00, 0x02, 0x00, 0xBA, 0xBB, 0x20, 0x65,
+    0x00, 0xF0, 0x66, 0x00, 0x01, 0x00, 0x82, 0x10, 0xAF, 0x00, 0x02, 0x00, 0xB0, 0xBE, 0xBE, 0x47,
+    0x00, 0xBE, 0x47, 0x00, 0x01, 0x00, 0xBD, 0x24, 0x65, 0x00, 0x01, 0x00, 0xBE, 0x10, 0x6C, 0x00,
+    0x01, 0x00, 0xBF, 0x24, 0x65, 0x00, 0x03, 0x00, 0xBA, 0xBD, 0xBE, 0xBE, 0x47, 0x00, 0x36, 0x63,
+    0x00, 0xD6, 0x67, 0x00, 0x01, 0x00, 0x83, 0xAC, 0x63, 0x00, 0x01, 0x00, 0x82, 0xEA, 0x78, 0x00,
+    0x01, 0x00, 0x8C, 0x1A, 0xAF, 0x00, 0x01, 0x00, 0xBF, 0x1C, 0x63, 0x00, 0x01, 0x00, 0xBA, 0xB0,
+    0x67, 0x00, 0x01, 0x00, 0xB7, 0x20, 0xAF, 0x00, 0x01, 0x00, 0x81, 0xE2, 0xA8, 0x00, 0x01, 0x00,
+    0x83, 0x28, 0xAF, 0x00, 0x02, 0x00, 0xB2, 0xBB, 0x18, 0x63, 0x00, 0x20, 0x65, 0x00, 0x02, 0x00,
+    0x80, 0x81, 0x60, 0x66, 0x00, 0x90, 0xAE, 0x00, 0x01, 0x00, 0xB5, 0x2E, 0xAF, 0x00, 0x01, 0x00,
+    0xBA, 0xFA, 0x62, 0x00, 0x01, 0x00, 0x82, 0x34, 0xAF, 0x00, 0x02, 0x00, 0xBC, 0xBF, 0x18, 0x63,
+    0x00, 0x18, 0x63, 0x00, 0x02, 0x00, 0xBC, 0xBD, 0x26, 0x39, 0x00, 0xF0, 0x6B, 0x00, 0x02, 0x00,
+    0x84, 0x85, 0x30, 0x7F, 0x00, 0x26, 0x39, 0x00, 0x01, 0x00, 0xBD, 0x36, 0x7D, 0x00, 0x01, 0x00,
+    0x8F, 0x40, 0xAF, 0x00, 0x02, 0x00, 0xBD, 0xBF, 0x48, 0xAF, 0x00, 0x2A, 0x67, 0x00, 0x02, 0x00,
+    0xB0, 0xB8, 0x1C, 0x63, 0x00, 0x50, 0xAF, 0x00, 0x01, 0x00, 0x91, 0x26, 0x39, 0x00, 0x03, 0x00,
+    0xB2, 0xB4, 0xBC, 0xBE, 0x47, 0x00, 0xBE, 0x47, 0x00, 0x1C, 0x63, 0x00, 0x01, 0x00, 0x8F, 0x10,
+    0x68, 0x00, 0x04, 0x00, 0xB2, 0xB5, 0xB9, 0xBE, 0x14, 0x63, 0x00, 0x14, 0x63, 0x00, 0x1C, 0x63,
+    0x00, 0x26, 0xA8, 0x00, 0x02, 0x00, 0x82, 0x8E, 0x1C, 0x63, 0x00, 0x14, 0x63, 0x00, 0x01, 0x00,
+    0x86, 0x26, 0x39, 0x00, 0x02, 0x00, 0xB6, 0xBC, 0x42, 0x63, 0x00, 0x56, 0xAF, 0x00, 0x01, 0x00,
+    0x81, 0x10, 0x68, 0x00, 0x01, 0x00, 0x8E, 0x10, 0x68, 0x00, 0x03, 0x00, 0xB5, 0xB9, 0xBC, 0x10,
+    0x68, 0x00, 0x10, 0x68, 0x00, 0x10, 0x68, 0x00, 0x02, 0x00, 0x81, 0x8F, 0xBE, 0x47, 0x00, 0xFE,
+    0x68, 0x00, 0x01, 0x00, 0xB1, 0x30, 0x7F, 0x00, 0x02, 0x00, 0x81, 0x8F, 0x42, 0x63, 0x00, 0x26,
+    0x39, 0x00, 0x01, 0x00, 0xB6, 0x30, 0x7F, 0x00, 0x01, 0x00, 0xB3, 0xD4, 0x65, 0x00, 0x01, 0x00,
+    0xB8, 0x3C, 0x63, 0x00, 0x02, 0x00, 0xBA, 0xBF, 0x18, 0x63, 0x00, 0xD4, 0x65, 0x00, 0x02, 0x00,
+    0x82, 0x8C, 0x5C, 0xAF, 0x00, 0xFA, 0x62, 0x00, 0x01, 0x00, 0xBA, 0x62, 0xAF, 0x00, 0x03, 0x00,
+    0xB5, 0xBB, 0xBD, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00, 0x04, 0x00, 0x85, 0x86,
+    0x88, 0x8E, 0x42, 0x63, 0x00, 0x30, 0x7F, 0x00, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00, 0x01, 0x00,
+    0x81, 0xB2, 0xAB, 0x00, 0x02, 0x00, 0xB7, 0xBB, 0xFC, 0xA7, 0x00, 0x26, 0x39, 0x00, 0x02, 0x00,
+    0x81, 0x82, 0xAC, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x02, 0x00, 0xB1, 0xB4, 0xD8, 0xA8, 0x00, 0x8C,
+    0xAA, 0x00, 0x01, 0x00, 0x80, 0x36, 0x6E, 0x00, 0x03, 0x00, 0xB5, 0xBB, 0xBE, 0xB0, 0x63, 0x00,
+    0x26, 0x39, 0x00, 0xA0, 0x68, 0x00, 0x00, 0x02, 0x69, 0x00, 0x03, 0x00, 0xB9, 0xBB, 0xBD, 0xBE,
+    0x47, 0x00, 0xBE, 0x47, 0x00, 0xA0, 0x66, 0x00, 0x03, 0x00, 0x82, 0x85, 0x88, 0x68, 0xAF, 0x00,
+    0xF0, 0x66, 0x00, 0x14, 0x63, 0x00, 0x04, 0x00, 0xB5, 0xB8, 0xBC, 0xBD, 0x42, 0x63, 0x00, 0x42,
+    0x63, 0x00, 0x6C, 0x73, 0x00, 0x72, 0xAF, 0x00, 0x03, 0x00, 0x87, 0x88, 0x8E, 0x42, 0x63, 0x00,
+    0x6E, 0x75, 0x00, 0x42, 0x63, 0x00, 0x03, 0x00, 0xB0, 0xB5, 0xB8, 0xFA, 0x62, 0x00, 0xC2, 0x6C,
+    0x00, 0x7C, 0xAF, 0x00, 0x02, 0x00, 0x8F, 0x91, 0x26, 0x39, 0x00, 0xC2, 0x6C, 0x00, 0x09, 0x00,
+    0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB8, 0xBA, 0xBC, 0xBD, 0x54, 0xAB, 0x00, 0xBE, 0x47, 0x00, 0x88,
+    0xAF, 0x00, 0xBE, 0x47, 0x00, 0xBE, 0x47, 0x00, 0xC8, 0x67, 0x00, 0xBE, 0x47, 0x00, 0xBE, 0x47,
+    0x00, 0xBE, 0x47, 0x00, 0x05, 0x00, 0x80, 0x81, 0x82, 0x86, 0x8E, 0x90, 0xAF, 0x00, 0xBE, 0x47,
+    0x00, 0xBE, 0x47, 0x00, 0x42, 0x63, 0x00, 0xBE, 0x47, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE,
+    0x9A, 0xAF, 0x00, 0xA0, 0xAF, 0x00, 0xA6, 0xAF, 0x00, 0xB0, 0xAF, 0x00, 0x01, 0x00, 0x83, 0xBA,
+    0xAF, 0x00, 0x02, 0x00, 0x82, 0x8E, 0x1C, 0x63, 0x00, 0xBE, 0x47, 0x00, 0x01, 0x00, 0xB5, 0xC4,
+    0xAF, 0x00, 0x04, 0x00, 0x81, 0x82, 0x8E, 0x8F, 0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0xBC, 0x3B,
+    0x00, 0xBE, 0x47, 0x00, 0x01, 0x00, 0xBC, 0xBE, 0x47, 0x00, 0x01, 0x00, 0x85, 0xBE, 0x47, 0x00,
+    0x02, 0x00, 0xBB, 0xBD, 0xBE, 0x47, 0x00, 0xA0, 0x66, 0x00, 0x02, 0x00, 0xB0, 0xBE, 0xFC, 0xA7,
+    0x00, 0x20, 0x65, 0x00, 0x01, 0x00, 0xB0, 0x3A, 0xA8, 0x00, 0x01, 0x00, 0xB5, 0x26, 0xA8, 0x00,
+    0x02, 0x00, 0xBB, 0xBF, 0xF0, 0x66, 0x00, 0xF0, 0x66, 0x00, 0x01, 0x00, 0xBD, 0x44, 0x81, 0x00,
+    0x01, 0x00, 0x81, 0xC8, 0x81, 0x00, 0x02, 0x00, 0xB2, 0xBA, 0x14, 0x63, 0x00, 0x26, 0x39, 0x00,
+    0x02, 0x00, 0xB4, 0xBB, 0xF0, 0x66, 0x00, 0xF0, 0x66, 0x00, 0x01, 0x00, 0xBA, 0xA0, 0xAB, 0x00,
+    0x01, 0x00, 0x8F, 0xC4, 0xAF, 0x00, 0x01, 0x00, 0x80, 0x0E, 0x63, 0x00, 0x01, 0x00, 0xBB, 0xDC,
+    0xA8, 0x00, 0x02, 0x00, 0xB9, 0xBB, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x03, 0x00, 0xB5, 0xB7,
+    0xB9, 0x1C, 0x63, 0x00, 0x3A, 0x81, 0x00, 0xB0, 0x67, 0x00, 0x03, 0x00, 0x81, 0x8E, 0x91, 0x1C,
+    0x63, 0x00, 0x26, 0x39, 0x00, 0x1C, 0x63, 0x00, 0x02, 0x00, 0xB0, 0xBB, 0xBC, 0x3B, 0x00, 0x20,
+    0x65, 0x00, 0x01, 0x00, 0x88, 0xBC, 0x3B, 0x00, 0x01, 0x00, 0xB5, 0x14, 0x68, 0x00, 0x01, 0x00,
+    0xB1, 0xD8, 0xA8, 0x00, 0x01, 0x00, 0xB4, 0x3E, 0x71, 0x00, 0x01, 0x00, 0xBB, 0xCA, 0xAF, 0x00,
+    0x04, 0x00, 0xB0, 0xB5, 0xB7, 0xBA, 0xA4, 0x82, 0x00, 0x52, 0x69, 0x00, 0xBC, 0x3B, 0x00, 0xF0,
+    0x66, 0x00, 0x01, 0x00, 0xBA, 0xCE, 0xAF, 0x00, 0x01, 0x00, 0xBD, 0x36, 0x63, 0x00, 0x01, 0x00,
+    0xB0, 0xD8, 0xAF, 0x00, 0x03, 0x00, 0xB2, 0xB4, 0xB6, 0xB0, 0x67, 0x00, 0x1C, 0x63, 0x00, 0x26,
+    0x39, 0x00, 0x01, 0x00, 0x84, 0x26, 0x39, 0x00, 0x02, 0x00, 0xB2, 0xBD, 0xC8, 0x67, 0x00, 0xC8,
+    0x67, 0x00, 0x01, 0x00, 0x82, 0xC8, 0x67, 0x00, 0x01, 0x00, 0x81, 0xDE, 0xAF, 0x00, 0x02, 0x00,
+    0xB5, 0xBB, 0xEE, 0xAA, 0x00, 0xD4, 0x65, 0x00, 0x01, 0x00, 0x8A, 0x26, 0x39, 0x00, 0x01, 0x00,
+    0xBC, 0xB0, 0x67, 0x00, 0x01, 0x00, 0xB3, 0x26, 0x39, 0x00, 0x02, 0x00, 0xB3, 0xB6, 0xBE, 0x47,
+    0x00, 0xBE, 0x47, 0x00, 0x03, 0x00, 0x81, 0x83, 0x88, 0xBE, 0x47, 0x00, 0x18, 0x63, 0x00, 0xBE,
+    0x47, 0x00, 0x02, 0x00, 0xBD, 0xBF, 0xD4, 0x65, 0x00, 0xD4, 0x65, 0x00, 0x01, 0x00, 0x86, 0xD4,
+    0x65, 0x00, 0x02, 0x00, 0xB4, 0xBA, 0x26, 0x39, 0x00, 0x2E, 0x65, 0x00, 0x02, 0x00, 0xB3, 0xB6,
+    0x20, 0x6E, 0x00, 0xB0, 0x67, 0x00, 0x08, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xBF,
+    0x1C, 0x63, 0x00, 0xE6, 0xAF, 0x00, 0xF0, 0xAF, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x1C,
+    0x63, 0x00, 0xFA, 0xAF, 0x00, 0x00, 0xB0, 0x00, 0x06, 0x00, 0x81, 0x82, 0x85, 0x86, 0x88, 0x8E,
+    0x06, 0xB0, 0x00, 0x06, 0x84, 0x00, 0x12, 0xB0, 0x00, 0x1C, 0x63, 0x00, 0x18, 0xA8, 0x00, 0x1C,
+    0x63, 0x00, 0x07, 0x00, 0xB1, 0xB2, 0xB3, 0xBB, 0xBC, 0xBD, 0xBE, 0xBE, 0x47, 0x00, 0x1C, 0x63,
+    0x00, 0x16, 0xB0, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0xB0, 0x00, 0x20, 0x65, 0x00,
+    0x03, 0x00, 0x82, 0x84, 0x89, 0x1C, 0x63, 0x00, 0xF0, 0x66, 0x00, 0x1C, 0x63, 0x00, 0x05, 0x00,
+    0xB3, 0xB5, 0xB8, 0xB9, 0xBF, 0xA6, 0x7F, 0x00, 0x22, 0xB0, 0x00, 0x6A, 0x72, 0x00, 0x26, 0x39,
+    0x00, 0x9A, 0xAE, 0x00, 0x05, 0x00, 0x80, 0x81, 0x82, 0x86, 0x8E, 0x1C, 0x63, 0x00, 0x28, 0xB0,
+    0x00, 0xF0, 0x66, 0x00, 0x26, 0x67, 0x00, 0x26, 0x39, 0x00, 0x04, 0x00, 0xB1, 0xB4, 0xBA, 0xBC,
+    0xBE, 0x47, 0x00, 0x42, 0x63, 0x00, 0x26, 0x39, 0x00, 0x42, 0x63, 0x00, 0x06, 0x00, 0xB2, 0xB4,
+    0xB5, 0xB6, 0xB9, 0xBA, 0x1C, 0x63, 0x00, 0xB0, 0x67, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00,
+    0x1C, 0x63, 0x00, 0x14, 0x63, 0x00, 0x03, 0x00, 0x82, 0x89, 0x8F, 0x1C, 0x63, 0x00, 0x1C, 0x63,
+    0x00, 0x1C, 0x63, 0x00, 0x02, 0x00, 0x85, 0x88, 0x12, 0xB0, 0x00, 0x18, 0xA8, 0x00, 0x01, 0x00,
+    0xBF, 0x26, 0xA8, 0x00, 0x01, 0x00, 0xB8, 0xD8, 0x75, 0x00, 0x01, 0x00, 0x80, 0x16, 0x82, 0x00,
+    0x01, 0x00, 0xBB, 0x14, 0x63, 0x00, 0x01, 0x00, 0x8E, 0x2E, 0x65, 0x00, 0x01, 0x00, 0x82, 0x30,
+    0x7F, 0x00, 0x02, 0x00, 0xB0, 0xB5, 0xFA, 0x62, 0x00, 0xFA, 0x62, 0x00, 0x01, 0x00, 0x91, 0xFA,
+    0x62, 0x00, 0x02, 0x00, 0x8F, 0x91, 0x18, 0x63, 0x00, 0x18, 0x63, 0x00, 0x02, 0x00, 0xB0, 0xBE,
+    0x2E, 0xB0, 0x00, 0x18, 0x63, 0x00, 0x02, 0x00, 0xBA, 0xBB, 0x60, 0x66, 0x00, 0xAC, 0x63, 0x00,
+    0x01, 0x00, 0xBF, 0xF0, 0x66, 0x00, 0x01, 0x00, 0xB0, 0x42, 0x63, 0x00, 0x01, 0x00, 0x8E, 0x18,
+    0x63, 0x00, 0x01, 0x00, 0x82, 0x34, 0xB0, 0x00, 0x01, 0x00, 0xB5, 0xBE, 0xA9, 0x00, 0x01, 0x00,
+    0xB4, 0x3A, 0xB0, 0x00, 0x04, 0x00, 0xB0, 0xB8, 0xBB, 0xBE, 0x18, 0x63, 0x00, 0x18, 0x63, 0x00,
+    0xF0, 0x66, 0x00, 0x2E, 0xB0, 0x00, 0x02, 0x00, 0x80, 0x83, 0x1C, 0x63, 0x00, 0x42, 0xB0, 0x00,
+    0x02, 0x00, 0xB0, 0xB8, 0x48, 0xB0, 0x00, 0x2E, 0x65, 0x00, 0x02, 0x00, 0x8F, 0x91, 0x1C, 0x63,
+    0x00, 0x1C, 0x63, 0x00, 0x01, 0x00, 0xBF, 0x4E, 0xB0, 0x00, 0x02, 0x00, 0x8E, 0x91, 0x14, 0x63,
+    0x00, 0x1C, 0x63, 0x00, 0x01, 0x00, 0xB4, 0x18, 0x63, 0x00, 0x01, 0x00, 0xBE, 0x54, 0xB0, 0x00,
+    0x01, 0x00, 0x8F, 0x2E, 0x65, 0x00, 0x01, 0x00, 0xB4, 0x58, 0xB0, 0x00, 0x01, 0x00, 0xBA, 0xD8,
+    0xA8, 0x00, 0x02, 0x00, 0x82, 0x83, 0xB8, 0x66, 0x00, 0x18, 0x63, 0x00, 0x01, 0x00, 0xBE, 0x60,
+    0xB0, 0x00, 0x02, 0x00, 0xB1, 0xB7, 0x1C, 0x63, 0x00, 0x20, 0x65, 0x00, 0x02, 0x00, 0x81, 0x82,
+    0x20, 0x65, 0x00, 0x1C, 0x63, 0x00, 0x02, 0x00, 0xB6, 0xB7, 0x42, 0x63, 0x00, 0x42, 0x63, 0x00,
+    0x01, 0x00, 0x88, 0x1C, 0x63, 0x00, 0x01, 0x00, 0x8B, 0xB0, 0x67, 0x00, 0x03, 0x00, 0x81, 0x82,
+    0x86, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x01, 0x00, 0xB1, 0xBE, 0x47, 0x00,
+    0x02, 0x00, 0x81, 0x82, 0x42, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x01, 0x00, 0x80, 0x30, 0x7F, 0x00,
+    0x02, 0x00, 0xB5, 0xBE, 0xFA, 0x62, 0x00, 0x3E, 0x65, 0x00, 0x02, 0x00, 0xBC, 0xBD, 0x1C, 0x63,
+    0x00, 0xB0, 0x67, 0x00, 0x02, 0x00, 0xB7, 0xBD, 0x1C, 0x63, 0x00, 0xBE, 0x47, 0x00, 0x01, 0x00,
+    0x81, 0x66, 0xB0, 0x00, 0x01, 0x00, 0xB9, 0x1C, 0x63, 0x00, 0x01, 0x00, 0xBF, 0xCA, 0x6D, 0x00,
+    0x02, 0x00, 0xB2, 0xBC, 0x1C, 0x63, 0x00, 0x6A, 0xB0, 0x00, 0x01, 0x00, 0xB0, 0x08, 0x64, 0x00,
+    0x01, 0x00, 0xB2, 0x72, 0xB0, 0x00, 0x01, 0x00, 0x82, 0x7C, 0xB0, 0x00, 0x02, 0x00, 0xB3, 0xB6,
+    0x14, 0x63, 0x00, 0x14, 0x63, 0x00, 0x01, 0x00, 0xBA, 0x0E, 0x66, 0x00, 0x02, 0x00, 0xB9, 0xBD,
+    0xB0, 0x67, 0x00, 0x26, 0x39, 0x00, 0x03, 0x00, 0xB2, 0xBB, 0xBD, 0x26, 0x39, 0x00, 0x26, 0x39,
+    0x00, 0x42, 0x63, 0x00, 0x03, 0x00, 0x81, 0x82, 0x84, 0x42, 0x63, 0x00, 0x0C, 0x65, 0x00, 0x42,
+    0x63, 0x00, 0x02, 0x00, 0xB2, 0xB3, 0x26, 0x39, 0x00, 0x42, 0x63, 0x00, 0x03, 0x00, 0xB5, 0xBA,
+    0xBF, 0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0x42, 0x63, 0x00, 0x03, 0x00, 0x82, 0x87, 0x8E, 0x26,
+    0x39, 0x00, 0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0x02, 0x00, 0xB5, 0xBE, 0xFA, 0x62, 0x00, 0x24,
+    0x65, 0x00, 0x01, 0x00, 0x81, 0x86, 0xB0, 0x00, 0x02, 0x00, 0xB4, 0xBA, 0xF0, 0x66, 0x00, 0xF0,
+    0x66, 0x00, 0x01, 0x00, 0xBE, 0xC2, 0x6C, 0x00, 0x01, 0x00, 0xBC, 0x20, 0x7D, 0x00, 0x02, 0x00,
+    0xB0, 0xB5, 0x76, 0x72, 0x00, 0xFA, 0x62, 0x00, 0x02, 0x00, 0x83, 0x8B, 0xFA, 0x62, 0x00, 0xFA,
+    0x62, 0x00, 0x01, 0x00, 0xB7, 0x3A, 0xA8, 0x00, 0x01, 0x00, 0xBB, 0x1A, 0x7F, 0x00, 0x01, 0x00,
+    0xB5, 0x24, 0x65, 0x00, 0x01, 0x00, 0xB0, 0x8C, 0xB0, 0x00, 0x01, 0x00, 0xBC, 0x04, 0x64, 0x00,
+    0x03, 0x00, 0xB0, 0xB5, 0xBE, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x01, 0x00,
+    0x8F, 0x1C, 0x63, 0x00, 0x03, 0x00, 0xB0, 0xB5, 0xB8, 0x18, 0x63, 0x00, 0x2E, 0x65, 0x00, 0x18,
+    0x63, 0x00, 0x02, 0x00, 0x8E, 0x91, 0x2E, 0x65, 0x00, 0x2E, 0x65, 0x00, 0x02, 0x00, 0xB2, 0xBE,
+    0xF0, 0x66, 0x00, 0x1C, 0x63, 0x00, 0x01, 0x00, 0xB5, 0xB0, 0x67, 0x00, 0x01, 0x00, 0x88, 0x10,
+    0x68, 0x00, 0x02, 0x00, 0xB3, 0xBC, 0xD4, 0x65, 0x00, 0x1C, 0x63, 0x00, 0x02, 0x00, 0x83, 0x8B,
+    0x18, 0x63, 0x00, 0x14, 0x63, 0x00, 0x02, 0x00, 0xB0, 0xB5, 0x92, 0xB0, 0x00, 0x42, 0x63, 0x00,
+    0x01, 0x00, 0xBF, 0x2A, 0x6B, 0x00, 0x01, 0x00, 0xBE, 0xC4, 0x35, 0x00, 0x01, 0x00, 0x8F, 0x9A,
+    0x84, 0x00, 0x01, 0x00, 0xBE, 0x98, 0xB0, 0x00, 0x01, 0x00, 0x80, 0xF8, 0x84, 0x00, 0x01, 0x00,
+    0x80, 0xFC, 0x84, 0x00, 0x01, 0x00, 0xBB, 0x50, 0x85, 0x00, 0x01, 0x00, 0xB4, 0x96, 0x84, 0x00,
+    0x01, 0x00, 0x80, 0x50, 0x84, 0x00, 0x01, 0x00, 0xBA, 0x72, 0x34, 0x00, 0x01, 0x00, 0x80, 0x9C,
+    0xB0, 0x00, 0x01, 0x00, 0xBD, 0x96, 0x84, 0x00, 0x01, 0x00, 0xB0, 0x3A, 0x35, 0x00, 0x01, 0x00,
+    0x80, 0x50, 0x85, 0x00, 0x01, 0x00, 0xBA, 0xF8, 0x84, 0x00, 0x01, 0x00, 0x82, 0xA6, 0xB0, 0x00,
+    0x01, 0x00, 0x83, 0x98, 0xB0, 0x00, 0x01, 0x00, 0xBC, 0xC4, 0x35, 0x00, 0x01, 0x00, 0x82, 0xAA,
+    0xB0, 0x00, 0x01, 0x00, 0xBB, 0xC4, 0x35, 0x00, 0x01, 0x00, 0x86, 0xD2, 0x84, 0x00, 0x01, 0x00,
+    0xBB, 0xF8, 0x84, 0x00, 0x01, 0x00, 0x8E, 0xAE, 0xB0, 0x00, 0x01, 0x00, 0xB6, 0xB4, 0xB0, 0x00,
+    0x02, 0x00, 0xB5, 0xB8, 0xB8, 0xB0, 0x00, 0xC2, 0xB0, 0x00, 0x01, 0x00, 0xB0, 0x72, 0x34, 0x00,
+    0x01, 0x00, 0xB8, 0xD6, 0x34, 0x00, 0x01, 0x00, 0x83, 0xC4, 0x35, 0x00, 0x01, 0x00, 0xB6, 0xC4,
+    0x35, 0x00, 0x01, 0x00, 0xB8, 0xCC, 0xB0, 0x00, 0x01, 0x00, 0xBD, 0x50, 0x84, 0x00, 0x01, 0x00,
+    0xBD, 0xD2, 0xB0, 0x00, 0x01, 0x00, 0x81, 0xD8, 0xB0, 0x00, 0x01, 0x00, 0x82, 0x50, 0x85, 0x00,
+    0x01, 0x00, 0xB2, 0x50, 0x85, 0x00, 0x02, 0x00, 0xBB, 0xBF, 0x50, 0x85, 0x00, 0xDC, 0xB0, 0x00,
+    0x01, 0x00, 0x82, 0xD8, 0xB0, 0x00, 0x01, 0x00, 0xBB, 0xFC, 0x84, 0x00, 0x00, 0x02, 0x2B, 0x00,
+    0x01, 0x00, 0xD1, 0xE2, 0xB0, 0x00, 0x00, 0x02, 0x96, 0x00, 0x01, 0x00, 0xD0, 0xEC, 0xB0, 0x00,
+    0x01, 0x01, 0x07, 0x00, 0xD1, 0xE0, 0x86, 0x00, 0x01, 0x00, 0xD1, 0x04, 0x46, 0x00, 0x01, 0x01,
+    0x09, 0x00, 0xD1, 0x8C, 0x86, 0x00, 0x00, 0x01, 0x17, 0x00, 0x01, 0x00, 0xD1, 0xF2, 0xB0, 0x00,
+    0x01, 0x00, 0xD0, 0xF8, 0xB0, 0x00, 0x00, 0x03, 0x75, 0x00, 0x00, 0x01, 0x2A, 0x00, 0x01, 0x00,
+    0xD0, 0xFE, 0xB0, 0x00, 0x01, 0x00, 0xD1, 0x04, 0xB1, 0x00, 0x01, 0x00, 0xD1, 0x0A, 0xB1, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x9A, 0x96, 0x00, 0xF6, 0x8E, 0x00, 0x01, 0x00, 0xD1, 0xCC, 0x54, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0xF8, 0x45, 0x00, 0xF4, 0x4A, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x01, 0x02,
+    0x18, 0x00, 0xD0, 0x10, 0xB1, 0x00, 0x01, 0x00, 0xD1, 0x1A, 0xB1, 0x00, 0x01, 0x02, 0x43, 0x00,
+    0xD0, 0xD6, 0x92, 0x00, 0x01, 0x00, 0xD0, 0x20, 0xB1, 0x00, 0x01, 0x00, 0xD1, 0x26, 0xB1, 0x00,
+    0x01, 0x00, 0xD1, 0x6A, 0x39, 0x00, 0x01, 0x01, 0x07, 0x00, 0xD0, 0x6E, 0x85, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0xDE, 0x4F, 0x00, 0x08, 0x94, 0x00, 0x01, 0x00, 0xD0, 0x2C, 0xB1, 0x00, 0x01, 0x00,
+    0xD0, 0x32, 0xB1, 0x00, 0x01, 0x01, 0x07, 0x00, 0xD1, 0x5A, 0x44, 0x00, 0x01, 0x00, 0xD0, 0x3C,
+    0xB1, 0x00, 0x01, 0x00, 0xD0, 0x42, 0xB1, 0x00, 0x00, 0x03, 0x81, 0x00, 0x01, 0x00, 0xD0, 0x48,
+    0xB1, 0x00, 0x01, 0x00, 0xD0, 0x4E, 0xB1, 0x00, 0x00, 0x02, 0x4B, 0x00, 0x01, 0x00, 0xD0, 0x54,
+    0xB1, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x02, 0xD2, 0x00, 0x01, 0x00, 0xD1, 0x94, 0x55, 0x00,
+    0x01, 0x00, 0xD1, 0x5A, 0xB1, 0x00, 0x01, 0x00, 0xD0, 0x60, 0xB1, 0x00, 0x01, 0x00, 0xD1, 0x66,
+    0xB1, 0x00, 0x01, 0x00, 0xD1, 0x6C, 0xB1, 0x00, 0x01, 0x00, 0xD1, 0x76, 0xB1, 0x00, 0x01, 0x00,
+    0xD0, 0x7C, 0xB1, 0x00, 0x01, 0x00, 0xD0, 0x86, 0xB1, 0x00, 0x01, 0x00, 0xD0, 0x3C, 0x4A, 0x00,
+    0x01, 0x00, 0xD0, 0x8C, 0xB1, 0x00, 0x01, 0x01, 0x0E, 0x00, 0xD0, 0x92, 0xB1, 0x00, 0x01, 0x00,
+    0xD0, 0x98, 0xB1, 0x00, 0x02, 0x01, 0x08, 0x00, 0xD0, 0xD1, 0x82, 0x60, 0x00, 0x78, 0xA0, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x84, 0x85, 0x00, 0xAC, 0xA4, 0x00, 0x01, 0x00, 0xD0, 0x9E, 0xB1, 0x00,
+    0x01, 0x00, 0xD0, 0xA4, 0xB1, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xAA, 0xB1, 0x00, 0xB0, 0xB1, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0xB6, 0xB1, 0x00, 0xBC, 0xB1, 0x00, 0x01, 0x00, 0xD1, 0xC2, 0xB1, 0x00,
+    0x01, 0x00, 0xD0, 0xC8, 0xB1, 0x00, 0x00, 0x03, 0xCC, 0x00, 0x02, 0x01, 0x11, 0x00, 0xD0, 0xD1,
+    0xD2, 0xB1, 0x00, 0xE0, 0xB1, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x7E, 0x95, 0x00, 0xE0, 0x58, 0x00,
+    0x01, 0x00, 0xD0, 0xE6, 0xB1, 0x00, 0x01, 0x02, 0x43, 0x00, 0xD0, 0xEC, 0xB1, 0x00, 0x01, 0x01,
+    0x26, 0x00, 0xD0, 0xF2, 0xB1, 0x00, 0x02, 0x01, 0x11, 0x00, 0xD0, 0xD1, 0x98, 0x9F, 0x00, 0xE0,
+    0xB1, 0x00, 0x01, 0x01, 0x07, 0x00, 0xD0, 0xD4, 0x86, 0x00, 0x00, 0x02, 0xCA, 0x00, 0x00, 0x01,
+    0x2F, 0x00, 0x01, 0x00, 0xD1, 0xF8, 0xB1, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0x8A, 0x3C, 0x00,
+    0x01, 0x00, 0xD1, 0x56, 0x94, 0x00, 0x02, 0x02, 0x1A, 0x00, 0xD0, 0xD1, 0xFE, 0xB1, 0x00, 0x08,
+    0xB2, 0x00, 0x01, 0x00, 0xD1, 0x0E, 0xB2, 0x00, 0x01, 0x01, 0x0A, 0x00, 0x2E, 0x42, 0x63, 0x00,
+    0x01, 0x02, 0xC8, 0x00, 0xD0, 0x70, 0x41, 0x00, 0x01, 0x01, 0x11, 0x00, 0xD1, 0x2C, 0x38, 0x00,
+    0x01, 0x01, 0x0E, 0x00, 0xD1, 0x66, 0xB1, 0x00, 0x01, 0x00, 0xD0, 0x14, 0xB2, 0x00, 0x02, 0x01,
+    0x07, 0x00, 0xD0, 0xD1, 0xB8, 0x5C, 0x00, 0x7C, 0x38, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xF8, 0x93,
+    0x00, 0x1A, 0xB2, 0x00, 0x01, 0x01, 0x0E, 0x00, 0xD0, 0x20, 0xB2, 0x00, 0x01, 0x00, 0xD0, 0x26,
+    0xB2, 0x00, 0x01, 0x00, 0xD0, 0x2C, 0xB2, 0x00, 0x01, 0x00, 0xD0, 0x32, 0xB2, 0x00, 0x01, 0x00,
+    0xD1, 0xE4, 0x9F, 0x00, 0x01, 0x01, 0x17, 0x00, 0xD1, 0x60, 0x87, 0x00, 0x01, 0x00, 0xD0, 0x38,
+    0xB2, 0x00, 0x01, 0x00, 0xD1, 0x3E, 0xB2, 0x00, 0x01, 0x00, 0xD0, 0x60, 0x44, 0x00, 0x01, 0x00,
+    0xD1, 0x44, 0xB2, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x7C, 0x5B, 0x00, 0x60, 0x87, 0x00, 0x01, 0x00,
+    0xD0, 0x4A, 0xB2, 0x00, 0x01, 0x00, 0xD1, 0x50, 0xB2, 0x00, 0x00, 0x02, 0xC6, 0x00, 0x01, 0x00,
+    0xD0, 0x20, 0xB2, 0x00, 0x01, 0x01, 0x09, 0x00, 0xD0, 0x0E, 0x54, 0x00, 0x01, 0x00, 0xD0, 0x7C,
+    0x5B, 0x00, 0x02, 0x00, 0x2E, 0xD0, 0x24, 0x65, 0x00, 0x0E, 0x54, 0x00, 0x01, 0x00, 0x2E, 0x56,
+    0xB2, 0x00, 0x01, 0x00, 0xD0, 0x5A, 0xB2, 0x00, 0x01, 0x01, 0x09, 0x00, 0xD0, 0x70, 0x41, 0x00,
+    0x01, 0x00, 0xD0, 0xB8, 0x45, 0x00, 0x01, 0x00, 0xD0, 0x64, 0xB2, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x6A, 0xB2, 0x00, 0x0E, 0x8C, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xD0, 0x92, 0x00, 0x70, 0xB2, 0x00,
+    0x01, 0x00, 0xD0, 0x76, 0xB2, 0x00, 0x01, 0x00, 0xD1, 0x8E, 0x5E, 0x00, 0x00, 0x03, 0xBB, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x7C, 0xB2, 0x00, 0x86, 0xB2, 0x00, 0x00, 0x02, 0x2D, 0x00, 0x01, 0x00,
+    0xD1, 0xF4, 0x4A, 0x00, 0x01, 0x01, 0x0D, 0x00, 0xD0, 0x46, 0x3A, 0x00, 0x01, 0x00, 0xD0, 0x8C,
+    0xB2, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x96, 0xB2, 0x00, 0xE6, 0x8D, 0x00, 0x01, 0x00, 0xD0, 0x9C,
+    0xB2, 0x00, 0x01, 0x00, 0xD0, 0xA2, 0xB2, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xDE, 0x4F, 0x00, 0xA8,
+    0xB2, 0x00, 0x01, 0x00, 0xD0, 0xB2, 0xB2, 0x00, 0x01, 0x00, 0xD0, 0xB8, 0xB2, 0x00, 0x01, 0x00,
+    0xD0, 0xBE, 0xB2, 0x00, 0x01, 0x00, 0xD0, 0xC4, 0xB2, 0x00, 0x03, 0x00, 0x2E, 0xD0, 0xD1, 0x2E,
+    0x65, 0x00, 0x40, 0x9B, 0x00, 0xCA, 0xB2, 0x00, 0x01, 0x00, 0xD0, 0xD0, 0xB2, 0x00, 0x01, 0x00,
+    0x2E, 0x2E, 0x65, 0x00, 0x00, 0x02, 0x67, 0x00, 0x01, 0x00, 0xD0, 0x9C, 0x3B, 0x00, 0x01, 0x02,
+    0xB1, 0x00, 0xD1, 0xD6, 0xB2, 0x00, 0x01, 0x00, 0xD0, 0xD0, 0x92, 0x00, 0x00, 0x02, 0x86, 0x00,
+    0x01, 0x01, 0x0C, 0x00, 0x2E, 0x14, 0x63, 0x00, 0x01, 0x00, 0xD1, 0x14, 0x54, 0x00, 0x01, 0x00,
+    0xD1, 0xDC, 0xB2, 0x00, 0x01, 0x00, 0xD0, 0xE2, 0xB2, 0x00, 0x01, 0x00, 0xD0, 0xE8, 0xB2, 0x00,
+    0x01, 0x00, 0xD0, 0x74, 0x39, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xF2, 0xB2, 0x00, 0x04, 0xB3, 0x00,
+    0x01, 0x00, 0xD0, 0x16, 0xB3, 0x00, 0x00, 0x03, 0xAC, 0x00, 0x01, 0x01, 0x0E, 0x00, 0xD0, 0x1C,
+    0xB3, 0x00, 0x01, 0x00, 0xD1, 0x4E, 0x91, 0x00, 0x01, 0x00, 0xD0, 0x22, 0xB3, 0x00, 0x01, 0x00,
+    0xD1, 0x28, 0xB3, 0x00, 0x01, 0x01, 0x0E, 0x00, 0xD0, 0x2E, 0xB3, 0x00, 0x00, 0x02, 0x8A, 0x00,
+    0x01, 0x00, 0xD0, 0x34, 0xB3, 0x00, 0x00, 0x02, 0xAF, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x62, 0x9D,
+    0x00, 0x84, 0x95, 0x00, 0x01, 0x00, 0xD0, 0x3A, 0xB3, 0x00, 0x01, 0x00, 0xD1, 0x40, 0xB3, 0x00,
+    0x01, 0x00, 0xD1, 0x46, 0xB3, 0x00, 0x01, 0x00, 0xD0, 0x4C, 0xB3, 0x00, 0x01, 0x01, 0x0E, 0x00,
+    0xD0, 0x52, 0xB3, 0x00, 0x01, 0x00, 0xD0, 0x58, 0xB3, 0x00, 0x01, 0x00, 0xD0, 0xD8, 0x91, 0x00,
+    0x01, 0x01, 0x0C, 0x00, 0xD1, 0x40, 0xA5, 0x00, 0x01, 0x00, 0xD0, 0x62, 0xB3, 0x00, 0x01, 0x00,
+    0xD0, 0x6C, 0xB3, 0x00, 0x01, 0x01, 0x17, 0x00, 0xD0, 0x72, 0xB3, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xF6, 0x95, 0x00, 0x80, 0x5C, 0x00, 0x01, 0x00, 0xD0, 0x7C, 0xB3, 0x00, 0x01, 0x00, 0x2E, 0x56,
+    0x66, 0x00, 0x01, 0x00, 0xD0, 0x82, 0xB3, 0x00, 0x01, 0x00, 0xD0, 0x88, 0xB3, 0x00, 0x02, 0x01,
+    0x0E, 0x00, 0xD0, 0xD1, 0x8E, 0xB3, 0x00, 0x98, 0xB3, 0x00, 0x01, 0x01, 0x0E, 0x00, 0xD0, 0x22,
+    0x97, 0x00, 0x01, 0x00, 0xD0, 0xA2, 0xB3, 0x00, 0x02, 0x00, 0x2E, 0xD0, 0x42, 0x63, 0x00, 0xA8,
+    0xB3, 0x00, 0x01, 0x00, 0xD1, 0xB2, 0xB3, 0x00, 0x00, 0x02, 0x9D, 0x00, 0x01, 0x00, 0xD0, 0xB8,
+    0xB3, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xF8, 0xB0, 0x00, 0xBE, 0xB3, 0x00, 0x01, 0x00, 0xD0, 0xC8,
+    0xB3, 0x00, 0x01, 0x00, 0xD0, 0xDA, 0x48, 0x00, 0x01, 0x00, 0xD0, 0xDE, 0xB3, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0xD6, 0xA4, 0x00, 0x1A, 0x41, 0x00, 0x01, 0x00, 0xD0, 0x1C, 0x9A, 0x00, 0x01, 0x00,
+    0xD0, 0xE8, 0xB3, 0x00, 0x01, 0x00, 0xD0, 0xEE, 0xB3, 0x00, 0x01, 0x00, 0xD1, 0xF4, 0xB3, 0x00,
+    0x01, 0x00, 0xD0, 0xFA, 0xB3, 0x00, 0x01, 0x00, 0xD0, 0x20, 0x93, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xDA, 0x53, 0x00, 0x00, 0xB4, 0x00, 0x01, 0x00, 0xD0, 0x06, 0xB4, 0x00, 0x01, 0x00, 0x2E, 0x80,
+    0x69, 0x00, 0x01, 0x00, 0xD0, 0x0C, 0xB4, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x12, 0xB4, 0x00, 0x0E,
+    0x8C, 0x00, 0x02, 0x00, 0x2E, 0xD0, 0x42, 0x63, 0x00, 0x18, 0xB4, 0x00, 0x01, 0x01, 0x11, 0x00,
+    0xD1, 0xE0, 0x4C, 0x00, 0x02, 0x00, 0x2E, 0xD1, 0x2E, 0x65, 0x00, 0xE0, 0x58, 0x00, 0x01, 0x01,
+    0x11, 0x00, 0xD1, 0xF4, 0x8A, 0x00, 0x01, 0x00, 0xD0, 0x18, 0xB4, 0x00, 0x01, 0x00, 0xD0, 0x1E,
+    0xB4, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD1, 0x6A, 0x39, 0x00, 0x02, 0x00, 0x2E, 0xD1, 0x24, 0x65,
+    0x00, 0x8C, 0x8A, 0x00, 0x01, 0x01, 0x07, 0x00, 0x2E, 0x42, 0x63, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x24, 0xB4, 0x00, 0xDC, 0xA4, 0x00, 0x02, 0x00, 0x2E, 0xD1, 0x24, 0x65, 0x00, 0xDC, 0xA4, 0x00,
+    0x01, 0x00, 0xD0, 0x36, 0xB4, 0x00, 0x01, 0x00, 0xD0, 0x3C, 0xB4, 0x00, 0x01, 0x00, 0xD1, 0xCA,
+    0xB2, 0x00, 0x01, 0x00, 0xD0, 0x42, 0xB4, 0x00, 0x01, 0x00, 0xD0, 0x2A, 0x5F, 0x00, 0x01, 0x00,
+    0xD0, 0x48, 0xB4, 0x00, 0x01, 0x00, 0xD0, 0x4E, 0xB4, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x54, 0xB4,
+    0x00, 0xF4, 0x88, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x62, 0xB4, 0x00, 0x6C, 0xB4, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x76, 0xB4, 0x00, 0x84, 0xB4, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x1E, 0x8F, 0x00, 0x3E,
+    0xB2, 0x00, 0x01, 0x00, 0xD0, 0x8E, 0xB4, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x94, 0xB4, 0x00, 0xA2,
+    0xB4, 0x00, 0x01, 0x00, 0xD0, 0xAC, 0xB4, 0x00, 0x01, 0x00, 0xD0, 0xB2, 0xB4, 0x00, 0x01, 0x00,
+    0xD1, 0xB8, 0xB4, 0x00, 0x01, 0x00, 0xD1, 0xBE, 0xB4, 0x00, 0x02, 0x00, 0x2E, 0xD1, 0x1C, 0x63,
+    0x00, 0x8C, 0x8F, 0x00, 0x01, 0x01, 0x0C, 0x00, 0xD0, 0xA4, 0x89, 0x00, 0x00, 0x02, 0x93, 0x00,
+    0x01, 0x00, 0xD0, 0xC4, 0xB4, 0x00, 0x01, 0x00, 0xD0, 0xCA, 0xB4, 0x00, 0x01, 0x00, 0xD1, 0xD8,
+    0xB4, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x6E, 0x85, 0x00, 0x78, 0x87, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xC8, 0x85, 0x00, 0xDE, 0xB4, 0x00, 0x01, 0x00, 0xD0, 0xE8, 0xB4, 0x00, 0x01, 0x00, 0xD0, 0x20,
+    0x5E, 0x00, 0x01, 0x01, 0x20, 0x00, 0xD1, 0xEE, 0xB4, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xF4, 0xB4,
+    0x00, 0xFA, 0xB4, 0x00, 0x01, 0x00, 0xD0, 0x00, 0xB5, 0x00, 0x01, 0x02, 0x2B, 0x00, 0xD0, 0x4E,
+    0x48, 0x00, 0x01, 0x00, 0xD0, 0x06, 0xB5, 0x00, 0x01, 0x00, 0xD0, 0x0C, 0xB5, 0x00, 0x01, 0x00,
+    0xD0, 0x12, 0xB5, 0x00, 0x01, 0x00, 0xD1, 0x18, 0xB5, 0x00, 0x01, 0x01, 0x0B, 0x00, 0xD0, 0x1E,
+    0xB5, 0x00, 0x01, 0x00, 0xD0, 0x28, 0xB5, 0x00, 0x01, 0x00, 0xD1, 0xB0, 0xB1, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x2E, 0xB5, 0x00, 0xF4, 0x4A, 0x00, 0x01, 0x02, 0x5F, 0x00, 0xD0, 0x34, 0xB5, 0x00,
+    0x01, 0x01, 0x25, 0x00, 0xD0, 0x3A, 0xB5, 0x00, 0x01, 0x00, 0xD0, 0x52, 0xB3, 0x00, 0x01, 0x00,
+    0xD0, 0x40, 0xB5, 0x00, 0x01, 0x00, 0xD1, 0x46, 0xB5, 0x00, 0x01, 0x00, 0xD0, 0x4C, 0xB5, 0x00,
+    0x00, 0x01, 0x63, 0x00, 0x01, 0x00, 0xD0, 0x52, 0xB5, 0x00, 0x01, 0x00, 0xD0, 0xB0, 0x96, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x58, 0xB5, 0x00, 0x62, 0x85, 0x00, 0x01, 0x00, 0xD0, 0x5E, 0xB5, 0x00,
+    0x02, 0x01, 0x07, 0x00, 0xD0, 0xD1, 0x10, 0x96, 0x00, 0x86, 0xB2, 0x00, 0x01, 0x00, 0xD1, 0x62,
+    0x45, 0x00, 0x01, 0x00, 0xD1, 0x64, 0xB5, 0x00, 0x01, 0x00, 0xD0, 0x6E, 0xB5, 0x00, 0x01, 0x00,
+    0xD1, 0x62, 0x85, 0x00, 0x02, 0x01, 0x07, 0x00, 0xD0, 0xD1, 0xAA, 0x85, 0x00, 0x0E, 0x8C, 0x00,
+    0x00, 0x02, 0x7A, 0x00, 0x01, 0x00, 0xD0, 0xB6, 0xB1, 0x00, 0x01, 0x01, 0x17, 0x00, 0xD0, 0x90,
+    0xA4, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xA4, 0x89, 0x00, 0x78, 0xB5, 0x00, 0x01, 0x01, 0x07, 0x00,
+    0xD0, 0x9A, 0x96, 0x00, 0x01, 0x00, 0xD0, 0x7E, 0xB5, 0x00, 0x01, 0x00, 0xD0, 0x84, 0xB5, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x7E, 0x85, 0x00, 0x66, 0xB1, 0x00, 0x01, 0x00, 0xD0, 0x8A, 0xB5, 0x00,
+    0x01, 0x03, 0x6F, 0x00, 0xD0, 0x90, 0xB5, 0x00, 0x01, 0x00, 0xD0, 0x96, 0xB5, 0x00, 0x01, 0x00,
+    0xD0, 0x9C, 0xB5, 0x00, 0x02, 0x01, 0x0E, 0x00, 0xD0, 0xD1, 0xA2, 0xB5, 0x00, 0xAC, 0xB5, 0x00,
+    0x01, 0x01, 0x11, 0x00, 0xD0, 0xD0, 0xB2, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xD0, 0xB6, 0xB5, 0x00,
+    0x01, 0x00, 0xD0, 0xBC, 0xB5, 0x00, 0x01, 0x00, 0xD1, 0x3A, 0x36, 0x00, 0x01, 0x00, 0xD1, 0xC2,
+    0xB5, 0x00, 0x01, 0x00, 0xD0, 0xC8, 0xB5, 0x00, 0x02, 0x00, 0x2E, 0xD0, 0x14, 0x63, 0x00, 0xCE,
+    0xB5, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x1E, 0x89, 0x00, 0xD4, 0xB5, 0x00, 0x02, 0x01, 0x0C, 0x00,
+    0xD0, 0xD1, 0x46, 0x3A, 0x00, 0xE0, 0x4C, 0x00, 0x01, 0x01, 0x26, 0x00, 0xD0, 0xE6, 0xB1, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0xDE, 0xB5, 0x00, 0x0C, 0x3D, 0x00, 0x01, 0x00, 0xD1, 0xE8, 0xB5, 0x00,
+    0x01, 0x00, 0xD0, 0xF2, 0xB5, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xFC, 0xB5, 0x00, 0x0A, 0xB6, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x10, 0xB6, 0x00, 0xCC, 0x54, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x9E, 0xB1,
+    0x00, 0x3E, 0xB2, 0x00, 0x01, 0x00, 0x2E, 0x26, 0x39, 0x00, 0x00, 0x02, 0x55, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x1E, 0xB6, 0x00, 0x0E, 0x8C, 0x00, 0x01, 0x00, 0xD0, 0x2C, 0xB6, 0x00, 0x01, 0x01,
+    0x09, 0x00, 0xD1, 0xBE, 0xB4, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x3C, 0x3B, 0x00, 0x32, 0xB6, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x4C, 0x87, 0x00, 0x3C, 0xB6, 0x00, 0x01, 0x00, 0xD0, 0x46, 0xB6, 0x00,
+    0x01, 0x00, 0xD0, 0x50, 0xB6, 0x00, 0x02, 0x02, 0x5D, 0x00, 0xD0, 0xD1, 0xC4, 0xB4, 0x00, 0xAE,
+    0x8B, 0x00, 0x00, 0x03, 0x5A, 0x00, 0x01, 0x00, 0xD0, 0x56, 0xB6, 0x00, 0x01, 0x00, 0xD1, 0x5C,
+    0xB6, 0x00, 0x01, 0x00, 0xD1, 0x62, 0xB6, 0x00, 0x01, 0x00, 0xD0, 0x4E, 0x48, 0x00, 0x01, 0x00,
+    0xD0, 0x68, 0xB6, 0x00, 0x01, 0x00, 0xD1, 0x6E, 0xB6, 0x00, 0x01, 0x01, 0x11, 0x00, 0xD0, 0x0E,
+    0x91, 0x00, 0x01, 0x00, 0x2E, 0x18, 0x63, 0x00, 0x01, 0x00, 0xD0, 0x74, 0xB6, 0x00, 0x01, 0x00,
+    0xD1, 0x08, 0xA0, 0x00, 0x00, 0x02, 0x4F, 0x00, 0x01, 0x01, 0x09, 0x00, 0xD1, 0x66, 0xB1, 0x00,
+    0x01, 0x00, 0xD0, 0x7A, 0xB6, 0x00, 0x00, 0x03, 0x48, 0x00, 0x01, 0x01, 0x26, 0x00, 0xD1, 0x80,
+    0xB6, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xC8, 0x85, 0x00, 0xC2, 0xB1, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x86, 0xB6, 0x00, 0x90, 0xB6, 0x00, 0x01, 0x00, 0xD0, 0x9A, 0xB6, 0x00, 0x01, 0x00, 0xD0, 0x32,
+    0x38, 0x00, 0x01, 0x00, 0x2E, 0x24, 0x65, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xA0, 0xB6, 0x00, 0xAA, 0xB6, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x02, 0xF6, 0x00, 0x01, 0x00,
+    0xD1, 0xB0, 0xB6, 0x00, 0x00, 0x02, 0xF1, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xB6, 0xB6, 0x00, 0xB0,
+    0xB6, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xC0, 0xB6, 0x00, 0xCA, 0xB6, 0x00, 0x01, 0x00, 0xD1, 0xD0,
+    0xB6, 0x00, 0x01, 0x00, 0xD1, 0xD6, 0xB6, 0x00, 0x00, 0x01, 0xEC, 0x00, 0x01, 0x00, 0xD0, 0xDC,
+    0xB6, 0x00, 0x02, 0x00, 0x81, 0x82, 0x42, 0x63, 0x00, 0xFA, 0x62, 0x00, 0x01, 0x00, 0xB7, 0x2E,
+    0x65, 0x00, 0x01, 0x00, 0x86, 0xAC, 0x63, 0x00, 0x01, 0x00, 0xB5, 0x36, 0xA8, 0x00, 0x01, 0x00,
+    0xBC, 0xFA, 0x62, 0x00, 0x01, 0x00, 0x81, 0x04, 0x64, 0x00, 0x01, 0x00, 0x83, 0x20, 0x65, 0x00,
+    0x02, 0x00, 0xB5, 0xB8, 0xF0, 0x66, 0x00, 0xF0, 0x66, 0x00, 0x01, 0x00, 0x82, 0xE2, 0xB6, 0x00,
+    0x01, 0x00, 0xBA, 0xE6, 0xB6, 0x00, 0x01, 0x00, 0x8C, 0x10, 0x68, 0x00, 0x01, 0x00, 0xB8, 0x30,
+    0x7F, 0x00, 0x02, 0x00, 0xB8, 0xBA, 0x30, 0x7F, 0x00, 0xD8, 0xA8, 0x00, 0x01, 0x00, 0xB2, 0x6C,
+    0xAB, 0x00, 0x01, 0x00, 0xB4, 0xBE, 0xA9, 0x00, 0x01, 0x00, 0xB8, 0xD4, 0x65, 0x00, 0x01, 0x00,
+    0xB0, 0x3E, 0x71, 0x00, 0x01, 0x00, 0xB5, 0xF0, 0x66, 0x00, 0x01, 0x00, 0x80, 0x26, 0xA8, 0x00,
+    0x01, 0x00, 0xBD, 0x06, 0xA8, 0x00, 0x01, 0x00, 0x80, 0x3A, 0xA8, 0x00, 0x02, 0x00, 0x82, 0x87,
+    0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0x01, 0x00, 0x81, 0xEA, 0xB6, 0x00, 0x02, 0x00, 0xB8, 0xBE,
+    0xFA, 0x62, 0x00, 0xFA, 0x62, 0x00, 0x01, 0x00, 0xBE, 0xEE, 0xB6, 0x00, 0x01, 0x00, 0xB4, 0x16,
+    0x82, 0x00, 0x01, 0x00, 0xB0, 0xB0, 0x67, 0x00, 0x01, 0x00, 0xB0, 0xD4, 0x65, 0x00, 0x01, 0x00,
+    0xB1, 0xFA, 0x62, 0x00, 0x01, 0x00, 0xBD, 0x10, 0x6C, 0x00, 0x01, 0x00, 0xBE, 0xB0, 0x67, 0x00,
+    0x01, 0x00, 0x8F, 0xAC, 0x63, 0x00, 0x01, 0x00, 0xB8, 0xAC, 0x63, 0x00, 0x01, 0x00, 0x8F, 0xB0,
+    0x67, 0x00, 0x01, 0x00, 0x8B, 0xFA, 0x62, 0x00, 0x02, 0x00, 0xB2, 0xBD, 0x26, 0x39, 0x00, 0x30,
+    0x7F, 0x00, 0x03, 0x00, 0xB0, 0xBB, 0xBD, 0xBE, 0x47, 0x00, 0xBE, 0x47, 0x00, 0xBE, 0xA9, 0x00,
+    0x01, 0x00, 0x8B, 0xBE, 0x47, 0x00, 0x01, 0x00, 0xBD, 0xEA, 0xAA, 0x00, 0x01, 0x00, 0xB6, 0xEA,
+    0xAA, 0x00, 0x01, 0x00, 0xB5, 0xF4, 0xB6, 0x00, 0x01, 0x00, 0x80, 0xD8, 0xA8, 0x00, 0x02, 0x00,
+    0xB5, 0xB9, 0x18, 0x63, 0x00, 0x18, 0x63, 0x00, 0x01, 0x00, 0x8F, 0x18, 0x63, 0x00, 0x01, 0x00,
+    0x83, 0xFA, 0xB6, 0x00, 0x01, 0x00, 0xB2, 0xFE, 0x68, 0x00, 0x01, 0x00, 0x86, 0x20, 0x65, 0x00,
+    0x01, 0x00, 0xB7, 0xBE, 0xA9, 0x00, 0x01, 0x00, 0xB0, 0xFE, 0xB6, 0x00, 0x01, 0x00, 0xB7, 0x04,
+    0xB7, 0x00, 0x01, 0x00, 0xB8, 0x10, 0x6C, 0x00, 0x01, 0x00, 0xBA, 0x26, 0xA8, 0x00, 0x01, 0x00,
+    0x88, 0x18, 0x63, 0x00, 0x01, 0x00, 0x89, 0x18, 0x63, 0x00, 0x01, 0x00, 0xBD, 0xE2, 0xA8, 0x00,
+    0x01, 0x00, 0x81, 0x0A, 0xB7, 0x00, 0x00, 0x02, 0x0F, 0x00, 0x02, 0x00, 0xB2, 0xBC, 0xFA, 0x62,
+    0x00, 0xFA, 0x62, 0x00, 0x01, 0x00, 0xB5, 0x34, 0x49, 0x00, 0x01, 0x00, 0xB8, 0x60, 0x66, 0x00,
+    0x01, 0x00, 0x91, 0x2E, 0x65, 0x00, 0x01, 0x00, 0xB2, 0x16, 0x82, 0x00, 0x02, 0x00, 0xB5, 0xB8,
+    0xAC, 0x63, 0x00, 0xAC, 0x63, 0x00, 0x01, 0x00, 0x91, 0xAC, 0x63, 0x00, 0x02, 0x00, 0xB0, 0xBE,
+    0x18, 0x63, 0x00, 0x18, 0x63, 0x00, 0x01, 0x00, 0xBC, 0x20, 0x65, 0x00, 0x01, 0x00, 0xB8, 0x10,
+    0xB7, 0x00, 0x01, 0x00, 0xBA, 0xE2, 0xB6, 0x00, 0x02, 0x00, 0x83, 0x8C, 0x42, 0x63, 0x00, 0x26,
+    0x39, 0x00, 0x01, 0x00, 0xBB, 0xEA, 0xAA, 0x00, 0x01, 0x00, 0xBB, 0xE2, 0xA8, 0x00, 0x01, 0x00,
+    0xB2, 0x14, 0x63, 0x00, 0x01, 0x00, 0xB4, 0x16, 0xB7, 0x00, 0x01, 0x00, 0x85, 0x2E, 0x65, 0x00,
+    0x01, 0x00, 0xB2, 0x2E, 0x65, 0x00, 0x01, 0x00, 0x80, 0x1A, 0xB7, 0x00, 0x01, 0x00, 0x80, 0x1E,
+    0xB7, 0x00, 0x01, 0x00, 0xB4, 0xEA, 0xB6, 0x00, 0x02, 0x00, 0xBC, 0xBD, 0x1C, 0x63, 0x00, 0x1C,
+    0x63, 0x00, 0x04, 0x00, 0xB0, 0xB2, 0xB5, 0xBE, 0x18, 0x63, 0x00, 0x3A, 0xA8, 0x00, 0x18, 0x63,
+    0x00, 0x18, 0x63, 0x00, 0x04, 0x00, 0x80, 0x83, 0x8F, 0x91, 0x6C, 0xAB, 0x00, 0x18, 0x63, 0x00,
+    0x18, 0x63, 0x00, 0x18, 0x63, 0x00, 0x01, 0x00, 0xB0, 0x20, 0x65, 0x00, 0x01, 0x00, 0xB0, 0x56,
+    0x66, 0x00, 0x01, 0x00, 0xB4, 0xBC, 0x3B, 0x00, 0x01, 0x00, 0x83, 0xC8, 0xA8, 0x00, 0x01, 0x00,
+    0xB0, 0xF0, 0x66, 0x00, 0x01, 0x00, 0xBE, 0x66, 0x67, 0x00, 0x01, 0x00, 0xBD, 0xEE, 0xAA, 0x00,
+    0x01, 0x00, 0x81, 0x22, 0xB7, 0x00, 0x01, 0x00, 0x80, 0x6C, 0xAB, 0x00, 0x01, 0x00, 0xBB, 0x28,
+    0xB7, 0x00, 0x01, 0x00, 0xB8, 0x20, 0x65, 0x00, 0x02, 0x00, 0xB0, 0xB8, 0x2E, 0xB7, 0x00, 0xD4,
+    0x65, 0x00, 0x02, 0x00, 0xB0, 0xBE, 0xFA, 0x62, 0x00, 0x18, 0x63, 0x00, 0x01, 0x00, 0xB5, 0x3E,
+    0x71, 0x00, 0x02, 0x00, 0xBB, 0xBC, 0x60, 0x66, 0x00, 0x60, 0x66, 0x00, 0x01, 0x00, 0xBE, 0x1E,
+    0x83, 0x00, 0x01, 0x00, 0xBC, 0x36, 0xB7, 0x00, 0x01, 0x00, 0xBA, 0xFC, 0xA7, 0x00, 0x02, 0x00,
+    0xB3, 0xB6, 0x3C, 0xB7, 0x00, 0x20, 0x65, 0x00, 0x02, 0x00, 0x80, 0x81, 0x42, 0x63, 0x00, 0x40,
+    0xB7, 0x00, 0x01, 0x00, 0xB3, 0xFC, 0xA7, 0x00, 0x02, 0x00, 0xB2, 0xBD, 0x1C, 0x63, 0x00, 0x1C,
+    0x63, 0x00, 0x01, 0x00, 0x88, 0xC2, 0x6C, 0x00, 0x01, 0x00, 0xBE, 0x48, 0xB7, 0x00, 0x02, 0x00,
+    0x80, 0x8B, 0xF0, 0x66, 0x00, 0x36, 0xA8, 0x00, 0x05, 0x00, 0xB3, 0xB6, 0xB7, 0xBA, 0xBB, 0x1C,
+    0x63, 0x00, 0x18, 0x63, 0x00, 0x18, 0x63, 0x00, 0x18, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x02, 0x00,
+    0xB1, 0xB2, 0x1C, 0x63, 0x00, 0x18, 0x63, 0x00, 0x01, 0x00, 0xB2, 0x70, 0x6C, 0x00, 0x01, 0x00,
+    0xB2, 0xEA, 0xAA, 0x00, 0x01, 0x00, 0x80, 0x4E, 0xB7, 0x00, 0x01, 0x00, 0xBE, 0x52, 0xB7, 0x00,
+    0x01, 0x00, 0x82, 0xC2, 0x6C, 0x00, 0x01, 0x00, 0xB6, 0x14, 0x63, 0x00, 0x01, 0x00, 0xB0, 0x58,
+    0xB7, 0x00, 0x01, 0x00, 0xB0, 0x3C, 0x79, 0x00, 0x01, 0x00, 0xB9, 0x24, 0x65, 0x00, 0x01, 0x00,
+    0xBF, 0x18, 0x63, 0x00, 0x04, 0x00, 0xB2, 0xB9, 0xBC, 0xBF, 0x42, 0x63, 0x00, 0x18, 0x63, 0x00,
+    0x18, 0x63, 0x00, 0x10, 0x6C, 0x00, 0x01, 0x00, 0xB9, 0x2E, 0x65, 0x00, 0x01, 0x00, 0xB3, 0x2E,
+    0x65, 0x00, 0x01, 0x00, 0xBC, 0x10, 0x6C, 0x00, 0x01, 0x00, 0xB2, 0x10, 0x6C, 0x00, 0x01, 0x00,
+    0xBD, 0x04, 0x64, 0x00, 0x03, 0x00, 0xB1, 0xB4, 0xB7, 0x18, 0x63, 0x00, 0x18, 0x63, 0x00, 0x18,
+    0x63, 0x00, 0x02, 0x00, 0xB6, 0xBA, 0x18, 0x63, 0x00, 0x18, 0x63, 0x00, 0x02, 0x00, 0x87, 0x88,
+    0x18, 0x63, 0x00, 0x18, 0x63, 0x00, 0x03, 0x00, 0xB4, 0xB5, 0xBA, 0x18, 0x63, 0x00, 0x18, 0x63,
+    0x00, 0x18, 0x63, 0x00, 0x02, 0x00, 0x81, 0x87, 0x18, 0x63, 0x00, 0x18, 0x63, 0x00, 0x01, 0x00,
+    0xBA, 0x1E, 0xB7, 0x00, 0x03, 0x00, 0xB0, 0xB5, 0xBE, 0x20, 0x65, 0x00, 0x18, 0x63, 0x00, 0x20,
+    0x65, 0x00, 0x02, 0x00, 0x83, 0x8B, 0x20, 0x65, 0x00, 0x60, 0x66, 0x00, 0x01, 0x00, 0xBD, 0x60,
+    0x66, 0x00, 0x01, 0x00, 0xB0, 0x60, 0x66, 0x00, 0x01, 0x00, 0x81, 0x5E, 0xB7, 0x00, 0x01, 0x00,
+    0x82, 0x1A, 0xB7, 0x00, 0x01, 0x00, 0xBA, 0x3A, 0xA8, 0x00, 0x03, 0x00, 0xB4, 0xBA, 0xBC, 0x3C,
+    0x63, 0x00, 0xC8, 0xA8, 0x00, 0xE2, 0xB6, 0x00, 0x01, 0x00, 0x80, 0x64, 0xB7, 0x00, 0x02, 0x00,
+    0x8B, 0x8F, 0xFA, 0x62, 0x00, 0xFA, 0x62, 0x00, 0x01, 0x00, 0xBD, 0x52, 0x69, 0x00, 0x01, 0x00,
+    0x8C, 0xEA, 0xB6, 0x00, 0x01, 0x00, 0xB5, 0x6A, 0xB7, 0x00, 0x01, 0x00, 0x91, 0x6A, 0xB7, 0x00,
+    0x01, 0x00, 0xBB, 0x26, 0xA8, 0x00, 0x01, 0x00, 0xBE, 0xEA, 0xB6, 0x00, 0x01, 0x00, 0xB1, 0x70,
+    0xB7, 0x00, 0x01, 0x00, 0xB9, 0xFA, 0x62, 0x00, 0x01, 0x00, 0x85, 0xFA, 0x62, 0x00, 0x02, 0x00,
+    0xB0, 0xBB, 0xBE, 0x47, 0x00, 0xE2, 0xA8, 0x00, 0x01, 0x00, 0xB4, 0xFC, 0xA7, 0x00, 0x01, 0x00,
+    0xBF, 0x74, 0xB7, 0x00, 0x01, 0x00, 0xB8, 0x04, 0x64, 0x00, 0x01, 0x00, 0xB3, 0x1E, 0xB7, 0x00,
+    0x01, 0x00, 0xBC, 0xEA, 0xAA, 0x00, 0x01, 0x00, 0x82, 0xBE, 0xA9, 0x00, 0x01, 0x00, 0xB8, 0xEA,
+    0xB6, 0x00, 0x01, 0x00, 0xB0, 0x7C, 0xB7, 0x00, 0x01, 0x00, 0xB5, 0x82, 0xB7, 0x00, 0x01, 0x00,
+    0xBB, 0xBE, 0x47, 0x00, 0x02, 0x00, 0x81, 0x86, 0xBE, 0x47, 0x00, 0xBE, 0x47, 0x00, 0x02, 0x00,
+    0xB6, 0xBF, 0xBE, 0x47, 0x00, 0xBE, 0x47, 0x00, 0x01, 0x00, 0x82, 0x24, 0x65, 0x00, 0x01, 0x00,
+    0xB8, 0x36, 0xA8, 0x00, 0x01, 0x00, 0xB9, 0xBE, 0x47, 0x00, 0x01, 0x00, 0xBF, 0xB0, 0x67, 0x00,
+    0x01, 0x00, 0xBE, 0xFA, 0xB6, 0x00, 0x01, 0x00, 0xBA, 0x88, 0xB7, 0x00, 0x01, 0x00, 0xB1, 0x26,
+    0xA8, 0x00, 0x02, 0x00, 0xB0, 0xB5, 0x2E, 0x65, 0x00, 0x2E, 0x65, 0x00, 0x02, 0x00, 0x80, 0x91,
+    0x3A, 0xA8, 0x00, 0x2E, 0x65, 0x00, 0x01, 0x00, 0xB0, 0x26, 0x39, 0x00, 0x01, 0x00, 0xB1, 0x26,
+    0x39, 0x00, 0x01, 0x00, 0x80, 0xC8, 0x76, 0x00, 0x01, 0x00, 0xB0, 0xF8, 0x67, 0x00, 0x01, 0x00,
+    0xB5, 0x14, 0x63, 0x00, 0x02, 0x00, 0x84, 0x8A, 0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0x02, 0x00,
+    0xB3, 0xB6, 0x26, 0x39, 0x00, 0x26, 0x39, 0x00, 0x02, 0x00, 0x81, 0x8F, 0xEA, 0xB6, 0x00, 0x34,
+    0x49, 0x00, 0x02, 0x00, 0xB4, 0xB9, 0x26, 0x39, 0x00, 0x18, 0x63, 0x00, 0x03, 0x00, 0xB2, 0xB7,
+    0xBB, 0x26, 0x39, 0x00, 0x18, 0x63, 0x00, 0x26, 0x39, 0x00, 0x01, 0x00, 0x89, 0x26, 0x39, 0x00,
+    0x03, 0x00, 0xB0, 0xB2, 0xB4, 0x18, 0x63, 0x00, 0x56, 0xB2, 0x00, 0x18, 0x63, 0x00, 0x03, 0x00,
+    0xB0, 0xB8, 0xBE, 0xFA, 0x62, 0x00, 0x60, 0x66, 0x00, 0x60, 0x66, 0x00, 0x01, 0x00, 0xBC, 0x26,
+    0xA8, 0x00, 0x02, 0x00, 0x83, 0x8C, 0xBE, 0x47, 0x00, 0x1C, 0x63, 0x00, 0x02, 0x00, 0x88, 0x91,
+    0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00, 0x02, 0x00, 0xB0, 0xBD, 0x1C, 0x63, 0x00, 0x1C, 0x63, 0x00,
+    0x01, 0x00, 0xBB, 0x3A, 0xA8, 0x00, 0x01, 0x00, 0xBB, 0xD8, 0xA8, 0x00, 0x01, 0x00, 0x81, 0x34,
+    0x49, 0x00, 0x01, 0x00, 0x82, 0x8C, 0xB7, 0x00, 0x01, 0x00, 0xBC, 0x18, 0x63, 0x00, 0x01, 0x00,
+    0x80, 0xEA, 0xAA, 0x00, 0x01, 0x00, 0xB6, 0x96, 0xB7, 0x00, 0x01, 0x00, 0xBF, 0xBE, 0xA9, 0x00,
+    0x01, 0x00, 0x87, 0xAC, 0x63, 0x00, 0x02, 0x00, 0xB2, 0xB5, 0x3A, 0xA8, 0x00, 0x18, 0x63, 0x00,
+    0x02, 0x00, 0x83, 0x8F, 0x18, 0x63, 0x00, 0x18, 0x63, 0x00, 0x01, 0x00, 0xBB, 0xBE, 0xA9, 0x00,
+    0x02, 0x00, 0xB5, 0xB8, 0x9A, 0xB7, 0x00, 0xD2, 0x84, 0x00, 0x01, 0x00, 0x91, 0x9A, 0xB7, 0x00,
+    0x01, 0x00, 0x8E, 0x72, 0x34, 0x00, 0x02, 0x00, 0xB5, 0xB9, 0x72, 0x34, 0x00, 0x72, 0x34, 0x00,
+    0x02, 0x00, 0xB2, 0xBB, 0x72, 0x34, 0x00, 0x72, 0x34, 0x00, 0x01, 0x00, 0x82, 0x72, 0x34, 0x00,
+    0x01, 0x00, 0x81, 0xC8, 0x84, 0x00, 0x01, 0x00, 0x83, 0x50, 0x84, 0x00, 0x01, 0x00, 0xB8, 0x50,
+    0x85, 0x00, 0x00, 0x02, 0x8F, 0x00, 0x00, 0x02, 0xDC, 0x00, 0x00, 0x01, 0x66, 0x00, 0x01, 0x00,
+    0xD0, 0xA0, 0xB7, 0x00, 0x01, 0x00, 0xD0, 0xA6, 0xB7, 0x00, 0x00, 0x01, 0x72, 0x00, 0x01, 0x00,
+    0xD1, 0xAC, 0xB7, 0x00, 0x01, 0x00, 0xD0, 0xB2, 0xB7, 0x00, 0x01, 0x00, 0xD0, 0xB8, 0xB7, 0x00,
+    0x01, 0x00, 0xD0, 0xBE, 0xB7, 0x00, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x01, 0x42, 0x00, 0x00, 0x02,
+    0x7F, 0x00, 0x01, 0x00, 0xD0, 0xC4, 0xB7, 0x00, 0x01, 0x00, 0xD0, 0xCA, 0xB7, 0x00, 0x01, 0x01,
+    0x07, 0x00, 0xD1, 0x3A, 0x91, 0x00, 0x01, 0x00, 0xD0, 0xD0, 0xB7, 0x00, 0x00, 0x03, 0x9F, 0x00,
+    0x01, 0x01, 0x66, 0x00, 0xD1, 0xE0, 0x58, 0x00, 0x01, 0x00, 0xD0, 0xD6, 0xB7, 0x00, 0x00, 0x03,
+    0x98, 0x00, 0x01, 0x00, 0xD0, 0xDC, 0xB7, 0x00, 0x01, 0x00, 0xD0, 0xE2, 0xB7, 0x00, 0x01, 0x00,
+    0xD0, 0xE8, 0xB7, 0x00, 0x01, 0x00, 0xD0, 0xEE, 0xB7, 0x00, 0x01, 0x00, 0xD1, 0xF4, 0xB7, 0x00,
+    0x00, 0x02, 0x84, 0x00, 0x01, 0x03, 0x81, 0x00, 0xD0, 0xFA, 0xB7, 0x00, 0x01, 0x00, 0xD0, 0x00,
+    0xB8, 0x00, 0x01, 0x00, 0xD1, 0x06, 0xB8, 0x00, 0x00, 0x02, 0x6D, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x0C, 0xB8, 0x00, 0x12, 0xB8, 0x00, 0x00, 0x02, 0x51, 0x00, 0x01, 0x00, 0xD0, 0x18, 0xB8, 0x00,
+    0x01, 0x00, 0xB2, 0xD4, 0x65, 0x00, 0x01, 0x00, 0xB9, 0x26, 0x39, 0x00, 0x01, 0x00, 0x82, 0x3C,
+    0x6C, 0x00, 0x01, 0x00, 0xB8, 0x80, 0x69, 0x00, 0x01, 0x00, 0xBE, 0xE2, 0xA8, 0x00, 0x01, 0x00,
+    0xBD, 0x36, 0xA8, 0x00, 0x01, 0x00, 0xBC, 0xC8, 0xA8, 0x00, 0x01, 0x00, 0xB0, 0x1E, 0xB8, 0x00,
+    0x01, 0x00, 0xB8, 0x24, 0xB8, 0x00, 0x01, 0x00, 0xBB, 0x36, 0xA8, 0x00, 0x01, 0x00, 0xB2, 0x04,
+    0x64, 0x00, 0x01, 0x00, 0xBC, 0xE2, 0xA8, 0x00, 0x01, 0x00, 0xBD, 0x70, 0xB7, 0x00, 0x01, 0x00,
+    0xBE, 0xC8, 0xA8, 0x00, 0x01, 0x00, 0x81, 0x2A, 0xB8, 0x00, 0x01, 0x00, 0xBB, 0x90, 0xAE, 0x00,
+    0x01, 0x00, 0xBC, 0x30, 0xB8, 0x00, 0x01, 0x00, 0x8E, 0xAC, 0x63, 0x00, 0x01, 0x00, 0xB5, 0xD4,
+    0x6A, 0x00, 0x01, 0x00, 0x91, 0xD4, 0x6A, 0x00, 0x01, 0x00, 0xBB, 0x50, 0x84, 0x00, 0x01, 0x00,
+    0xD0, 0x34, 0xB8, 0x00, 0x01, 0x00, 0xD0, 0x3A, 0xB8, 0x00, 0x01, 0x00, 0xD0, 0x40, 0xB8, 0x00,
+    0x00, 0x03, 0x7C, 0x00, 0x01, 0x00, 0xBC, 0x16, 0xB7, 0x00, 0x01, 0x00, 0xBD, 0x46, 0xB8, 0x00,
+    0x01, 0x00, 0xBA, 0x4A, 0xB8, 0x00, 0x00, 0x03, 0xA4, 0x00, 0x00, 0x02, 0x88, 0x00,
+};
+
+constexpr uint8_t ru_trie_levels[] = {
+    0x08, 0x17, 0x38, 0x58, 0x28, 0x08, 0x28, 0x41, 0x43, 0x62, 0x21, 0x61, 0x02, 0x23, 0x42, 0x24,
+    0x41, 0x22, 0x22, 0x41, 0x23, 0x42, 0x24, 0x82, 0x42, 0x61, 0x02, 0x21, 0x41, 0x62, 0x02, 0x23,
+    0x63, 0x42, 0x63, 0x21, 0x42, 0x03, 0x01, 0x64, 0x21, 0x41, 0x81, 0x61, 0x82, 0x62, 0x83, 0x83,
+    0x22, 0x43, 0x22, 0x42, 0x08, 0x02, 0x23, 0x42, 0x04, 0x03, 0x22, 0x04, 0x23, 0x02, 0x21, 0x42,
+    0x63, 0x82, 0xA1, 0x01, 0x22, 0x02, 0x42, 0x06, 0x21, 0x61, 0x82, 0x62, 0x81, 0x41, 0x63, 0x23,
+    0x44, 0x84, 0xA3, 0x21, 0x61, 0x44, 0x61, 0x04, 0x21, 0x42, 0x03, 0x22, 0x62, 0x03, 0x62, 0x43,
+    0x62, 0x02, 0x22, 0x84, 0x01, 0x42, 0xA2, 0x22, 0x61, 0x01, 0x24, 0x04, 0x25, 0x02, 0xA1, 0x02,
+    0x63, 0x82, 0xA3, 0x01, 0x41, 0x22, 0x41, 0x62, 0x04, 0x21, 0x01, 0x62, 0x63, 0x82, 0xA3, 0x82,
+    0xA3, 0x42, 0x61, 0x82, 0x81, 0xA2, 0x42, 0x81, 0xA2, 0xC1, 0x41, 0x64, 0x03, 0x43, 0x62, 0x83,
+    0xA2, 0x23, 0x61, 0x21, 0x62, 0x44, 0x64, 0x83, 0x21, 0x42, 0x61, 0x24, 0x43, 0x02, 0x63, 0x22,
+    0x61, 0x82, 0x22, 0x63, 0x44, 0x61, 0x82, 0x03, 0x41, 0x62, 0x82, 0xA1, 0x41, 0x62, 0x83, 0x43,
+    0x64, 0x42, 0x82, 0x02, 0x42, 0x61, 0x02, 0x41, 0x02, 0x21, 0x63, 0x01, 0x22, 0x43, 0x02, 0x21,
+    0x42, 0x61, 0x04, 0x22, 0x21, 0x44, 0x61, 0x84, 0x22, 0x62, 0x02, 0x61, 0x21, 0x62, 0x83, 0x04,
+    0x23, 0x61, 0x41, 0x82, 0x01, 0x22, 0x41, 0x03, 0x63, 0x01, 0x22, 0x42, 0x22, 0x81, 0x03, 0x42,
+    0x65, 0x84, 0x48, 0x51, 0x52, 0x71, 0x52, 0x73, 0x52, 0x53, 0x71, 0x73, 0x92, 0x72, 0x53, 0x72,
+    0x54, 0x73, 0x92, 0x58, 0x51, 0x72, 0x52, 0x91, 0x52, 0x71, 0x92, 0x91,
+};
+
+constexpr DenseHyphenationTrie ru_dense_trie = {
+    ru_trie_classes, 38u, ru_trie_dense, ru_trie_nodes, sizeof(ru_trie_nodes),
+    ru_trie_levels, sizeof(ru_trie_levels),
 };
 
 constexpr SerializedHyphenationPatterns ru_patterns = {
-    0x822Bu,
-    ru_trie_data,
-    sizeof(ru_trie_data),
+    0u,
+    nullptr,
+    0,
+    &ru_dense_trie,
 };
@@ -6,1343 +6,2421 @@
 #include "../SerializedHyphenationTrie.h"
 
 // Auto-generated by generate_hyphenation_trie.py. Do not edit manually.
-alignas(4) constexpr uint8_t uk_trie_data[] = {
-    0x02, 0x15, 0x17, 0x02, 0x21, 0x02, 0x29, 0x03, 0x18, 0x16, 0x03, 0x1A, 0x06, 0x30, 0x38, 0x38,
-    0x10, 0x38, 0x1A, 0x06, 0x1A, 0x06, 0x1A, 0x1A, 0x36, 0x21, 0x36, 0x17, 0x5E, 0x37, 0x18, 0x17,
-    0x4B, 0x18, 0x72, 0x17, 0x49, 0x2C, 0x17, 0x40, 0x54, 0x53, 0x68, 0x17, 0x40, 0x17, 0x2C, 0x40,
-    0x17, 0x54, 0x21, 0x54, 0x17, 0x40, 0x17, 0x2C, 0x17, 0x7C, 0x17, 0x2C, 0x17, 0x2C, 0x17, 0x5E,
-    0x17, 0x5E, 0x21, 0x5D, 0x5F, 0x18, 0x4A, 0x17, 0x2D, 0x18, 0x3F, 0x35, 0x2C, 0x21, 0x55, 0x18,
-    0x2E, 0x19, 0x18, 0x2C, 0x19, 0x18, 0x2B, 0x22, 0x3F, 0x22, 0x17, 0x22, 0x2B, 0x18, 0x53, 0x22,
-    0x67, 0x22, 0x2C, 0x17, 0x18, 0x03, 0x18, 0x18, 0x03, 0x18, 0x17, 0x69, 0x90, 0x40, 0x2B, 0x41,
-    0x18, 0x54, 0x19, 0x04, 0x17, 0x53, 0x18, 0x43, 0x2D, 0x18, 0x18, 0x03, 0x22, 0x2A, 0x2B, 0x2C,
-    0x18, 0x19, 0x2C, 0x19, 0x2D, 0x04, 0x1B, 0x40, 0x19, 0x18, 0x18, 0x2B, 0x18, 0x7D, 0x18, 0x7B,
-    0x18, 0x2A, 0x15, 0x3F, 0x18, 0x18, 0x17, 0x18, 0x2C, 0x1B, 0x18, 0x2C, 0x54, 0x40, 0x18, 0x69,
-    0x18, 0x41, 0x18, 0x18, 0x2C, 0x18, 0x17, 0x40, 0x3F, 0x2C, 0x23, 0x40, 0x18, 0x17, 0x54, 0x18,
-    0x17, 0x67, 0x18, 0x40, 0x17, 0x18, 0x2D, 0x18, 0x19, 0x43, 0x18, 0x2C, 0x2C, 0x17, 0x54, 0x2B,
-    0x68, 0x18, 0x17, 0x2C, 0x18, 0x18, 0x17, 0x4A, 0x17, 0x18, 0x2C, 0x18, 0x17, 0x18, 0x35, 0x18,
-    0x49, 0x18, 0x5D, 0x18, 0x08, 0x11, 0x1C, 0x26, 0x26, 0x1C, 0x08, 0x1C, 0x26, 0x12, 0x1C, 0x1C,
-    0x08, 0x12, 0x1C, 0x12, 0xA0, 0x02, 0x91, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB4, 0xFD, 0xA0, 0x0D, 0xE2, 0xA2,
-    0x00, 0x61, 0xD0, 0x2D, 0xFA, 0xFD, 0x21, 0xBB, 0xDE, 0x21, 0xD0, 0xFD, 0x21, 0xB8, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0x82, 0xD2, 0x21, 0xD1, 0xFD, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5,
-    0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x82, 0x84, 0xEB, 0xFD, 0xA2, 0x00, 0x61, 0xD1, 0x2D, 0xFB, 0xD3,
-    0x21, 0xBA, 0xB4, 0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD, 0x41, 0xB8, 0xFF, 0xB1, 0x22, 0xD1, 0xD0,
-    0xF9, 0xFC, 0x41, 0xB7, 0xFF, 0xA2, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0xBF, 0xB1, 0xE8, 0xFD, 0x42, 0xB0, 0xBE, 0xFF, 0x8A, 0xFF,
-    0xBB, 0x21, 0xD0, 0xF9, 0x41, 0xB4, 0xFF, 0x80, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0,
-    0xFD, 0x22, 0x85, 0x89, 0xF0, 0xFD, 0xC3, 0x00, 0x61, 0xD0, 0xD1, 0x2D, 0xFF, 0xDF, 0xFF, 0xFB,
-    0xFF, 0x86, 0xA0, 0x02, 0x92, 0x21, 0xB3, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1,
-    0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB1, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x81, 0xFD,
-    0xC2, 0x00, 0xD1, 0xD1, 0x2D, 0xFF, 0xFD, 0xFF, 0x5C, 0xA0, 0x00, 0xB2, 0x21, 0x82, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE,
-    0xFD, 0x21, 0xD0, 0xFD, 0xA0, 0x02, 0xB1, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x82, 0x96,
-    0xF4, 0xFD, 0xA0, 0x02, 0xC1, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x97, 0xFD, 0x21, 0xD1,
-    0xFD, 0x21, 0xBE, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xE9, 0xFF, 0xFD, 0xFF, 0x18, 0x21, 0xBD,
-    0xC1, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0x81, 0xB2, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEE, 0xFF, 0xFD, 0xFE, 0xF6,
-    0x41, 0xB0, 0xFF, 0x9F, 0x21, 0xD0, 0xFC, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBA, 0xFD,
-    0x21, 0xD0, 0xFD, 0x41, 0xB2, 0xFF, 0x86, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0xB5, 0xB8, 0xEA, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFB,
-    0xFE, 0xC1, 0x41, 0x80, 0xFF, 0x6D, 0x21, 0xD1, 0xFC, 0x21, 0xB0, 0xFD, 0x42, 0xD0, 0x2D, 0xFF,
-    0xFD, 0xFE, 0xB0, 0x41, 0xBB, 0xFF, 0x56, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0x83, 0xFD, 0x22, 0xD0, 0xD1, 0xC7, 0xFD, 0x42, 0x80, 0x81, 0xFF, 0xAC, 0xFF, 0x47, 0x21,
-    0xD1, 0xF9, 0x41, 0xBF, 0xFF, 0x3D, 0x21, 0xD0, 0xFC, 0x41, 0xB7, 0xFF, 0x30, 0x21, 0xD0, 0xFC,
-    0x22, 0xB5, 0xB8, 0xF6, 0xFD, 0x21, 0xD0, 0xFB, 0x23, 0x82, 0x83, 0x86, 0xDB, 0xE7, 0xFD, 0x42,
-    0xD1, 0x2D, 0xFF, 0xF9, 0xFE, 0x6D, 0x41, 0x96, 0xFF, 0x13, 0x21, 0xD1, 0xFC, 0x21, 0xB3, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0xA0, 0x06, 0xF1, 0x21,
-    0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD, 0x21, 0xD1,
-    0xFD, 0x21, 0xB1, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x8C, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xDF,
-    0xFF, 0xFD, 0xFE, 0x32, 0x41, 0x80, 0xFE, 0xD5, 0x21, 0xD1, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xFE,
-    0x12, 0x41, 0x96, 0xFF, 0x8C, 0x21, 0xD1, 0xFC, 0xA0, 0x09, 0x72, 0x21, 0x87, 0xFD, 0x21, 0xD1,
-    0xFD, 0x22, 0xBB, 0xB2, 0xF4, 0xFD, 0x41, 0xBC, 0xFE, 0xA3, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x22, 0xD0, 0xD1, 0xEB, 0xFD, 0x21, 0xB0, 0xFB, 0x42, 0xD0,
-    0x2D, 0xFF, 0xFD, 0xFD, 0xDE, 0x41, 0x80, 0xFE, 0xEF, 0x21, 0xD1, 0xFC, 0x41, 0x86, 0xFE, 0x7D,
-    0x21, 0xD1, 0xFC, 0x21, 0x8F, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x41,
-    0xBE, 0xFF, 0x18, 0x21, 0xD0, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21,
-    0xD1, 0xFD, 0x23, 0xB0, 0xB5, 0xBE, 0xD7, 0xEA, 0xFD, 0x41, 0x87, 0xFE, 0x50, 0x21, 0xD1, 0xFC,
-    0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE9, 0xFF,
-    0xFD, 0xFD, 0x93, 0x41, 0xBA, 0xFE, 0x5F, 0x21, 0xD0, 0xFC, 0x21, 0x8F, 0xFD, 0x21, 0xD1, 0xFD,
-    0x21, 0xB8, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xFD, 0x79, 0x41, 0x2D, 0xFD, 0x72, 0x50, 0xB0,
-    0xB5, 0xBE, 0xB9, 0xB2, 0xB3, 0xB4, 0xB7, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xB1, 0xB6, 0xB8, 0xFD,
-    0x71, 0xFD, 0x9B, 0xFD, 0xE8, 0xFE, 0x12, 0xFE, 0x56, 0xFE, 0x78, 0xFE, 0xAD, 0xFE, 0xBE, 0xFF,
-    0x01, 0xFF, 0x3C, 0xFF, 0x5C, 0xFF, 0x90, 0xFF, 0xDB, 0xFF, 0xF5, 0xFF, 0xFC, 0xFF, 0xFC, 0xA0,
-    0x06, 0x72, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0xC2, 0x00, 0x61, 0xD1, 0x2D, 0xFF, 0xFD, 0xFD, 0x25,
-    0x41, 0xBE, 0xFD, 0xF2, 0x21, 0xD0, 0xFC, 0x21, 0x96, 0xFD, 0x21, 0xB0, 0xDB, 0x22, 0xD1, 0xD0,
-    0xFA, 0xFD, 0x41, 0xBE, 0xFD, 0x76, 0x21, 0xD0, 0xFC, 0x22, 0xB4, 0xB3, 0xF4, 0xFD, 0x41, 0xBB,
-    0xFD, 0x84, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBA, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0xC3, 0x00, 0x61, 0xD0, 0xD1, 0x2D,
-    0xFF, 0xDF, 0xFF, 0xFD, 0xFC, 0xE2, 0xC1, 0x00, 0x61, 0x2D, 0xFC, 0xD6, 0x41, 0xBD, 0xFD, 0x7D,
-    0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0x83, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xBC, 0xFD, 0xCF, 0x21, 0xD0, 0xFC, 0x22, 0xB3, 0xBE, 0xF6,
-    0xFD, 0x41, 0x88, 0xFD, 0x31, 0x21, 0xD1, 0xFC, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x84,
-    0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xB4, 0xFD, 0x1E, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB7, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x82, 0xFD,
-    0x05, 0x21, 0xD1, 0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB5, 0xFC, 0xE6,
-    0x21, 0xD0, 0xFC, 0x21, 0x84, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x41,
-    0x81, 0xFC, 0xD3, 0x21, 0xD1, 0xFC, 0x21, 0xB9, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB0, 0xFC, 0xC6,
-    0x21, 0xD0, 0xFC, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0xA1, 0x02, 0x92, 0xD1, 0xB4, 0x21, 0x81,
-    0xFB, 0x21, 0xD1, 0xFD, 0x22, 0xB4, 0xB9, 0xF2, 0xFD, 0x21, 0xD0, 0xFB, 0x22, 0xB0, 0xB5, 0xDD,
-    0xFD, 0x41, 0xBD, 0xFC, 0xA1, 0x21, 0xD0, 0xFC, 0x21, 0x96, 0xFD, 0x22, 0xD0, 0xD1, 0xF1, 0xFD,
-    0xA0, 0x06, 0x63, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21,
-    0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBD, 0xEB, 0x21, 0xD0, 0xFD, 0x21, 0xB8, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xB1, 0xE5, 0x21, 0xD0, 0xFD, 0x23, 0xB1, 0xB4, 0xB7, 0xEB, 0xF7, 0xFD, 0x21, 0xD0,
-    0xF9, 0x41, 0x96, 0xFF, 0x47, 0x21, 0xD1, 0xFC, 0x47, 0xB0, 0xB2, 0xB4, 0xBA, 0xBC, 0xBE, 0xBF,
-    0xFF, 0x39, 0xFF, 0x52, 0xFF, 0x71, 0xFF, 0x84, 0xFF, 0xC3, 0xFF, 0xF6, 0xFF, 0xFD, 0x41, 0xB8,
-    0xFF, 0xA7, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xC3, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1,
-    0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xBA, 0xFF, 0x2A, 0x21, 0xD0, 0xFC, 0x21, 0xB0,
-    0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xBC, 0xFC, 0x1E, 0x21, 0xD0, 0xFC, 0x21, 0x96, 0xFD, 0x21, 0xD1,
-    0xFD, 0x41, 0x80, 0xFC, 0x11, 0x21, 0xD1, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBD,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x25, 0x80, 0x83, 0x84, 0x85, 0x86,
-    0xB8, 0xCA, 0xD7, 0xE4, 0xFD, 0x42, 0xD0, 0xD1, 0xFF, 0x93, 0xFF, 0xF5, 0x21, 0x82, 0xF9, 0x43,
-    0xD0, 0xD1, 0x2D, 0xFE, 0xAD, 0xFF, 0xFD, 0xFB, 0x5D, 0x41, 0x86, 0xFC, 0xF1, 0x21, 0xD1, 0xFC,
-    0x41, 0xBA, 0xFB, 0xFF, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xBE, 0xBF,
-    0xF0, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFB, 0xFB, 0x3A, 0x41, 0xB5, 0xFB, 0xE6, 0x21, 0xD0, 0xFC,
-    0x21, 0xBB, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xFB, 0x29, 0x41, 0xBB, 0xFC, 0xC0, 0x21, 0xD0,
-    0xFC, 0x42, 0xB0, 0xBE, 0xFF, 0xFD, 0xFB, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xFB, 0x14, 0x50,
-    0x96, 0x83, 0x8E, 0x8F, 0x94, 0x97, 0x80, 0x81, 0x82, 0x85, 0x84, 0x86, 0x87, 0x88, 0x89, 0x8C,
-    0xFD, 0xE8, 0xFE, 0x2B, 0xFE, 0x37, 0xFE, 0x37, 0xFE, 0x37, 0xFE, 0x37, 0xFF, 0xB0, 0xFF, 0xD3,
-    0xFF, 0xE4, 0xFF, 0xF9, 0xFD, 0x9B, 0xFD, 0x9B, 0xFD, 0x9B, 0xFD, 0x9B, 0xFD, 0x9B, 0xFD, 0x9B,
-    0x41, 0x91, 0xFD, 0x6A, 0xC4, 0x00, 0x42, 0xD0, 0xD1, 0xD2, 0x27, 0xFD, 0x6A, 0xFF, 0xCB, 0xFF,
-    0xFC, 0xFD, 0x66, 0x41, 0x96, 0xFA, 0xB1, 0x21, 0xD1, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD,
-    0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x43, 0xBA, 0xB2, 0xB4, 0xFA, 0xCF, 0xFF, 0xFD, 0xFA, 0xB0,
-    0xC2, 0x00, 0x61, 0xD0, 0x2D, 0xFF, 0xF6, 0xFA, 0xAC, 0x41, 0xB5, 0xFA, 0xBC, 0x21, 0xD0, 0xFC,
-    0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x42, 0x84, 0x81, 0xFA, 0xBB, 0xFF, 0xFD, 0x21, 0x81, 0xCA,
-    0x21, 0xD1, 0xFD, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBC, 0xFD, 0xC3, 0x00, 0x61, 0xD1,
-    0xD0, 0x2D, 0xFF, 0xEA, 0xFF, 0xFD, 0xFA, 0x80, 0x21, 0xB2, 0xAF, 0x21, 0xD0, 0xFD, 0x41, 0xBD,
-    0xFA, 0x56, 0x21, 0xD0, 0xFC, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x44, 0x81, 0x85, 0x86, 0x89,
-    0xFF, 0xF0, 0xFA, 0xC6, 0xFF, 0xFD, 0xFA, 0xD3, 0x41, 0xB2, 0xFA, 0x3C, 0x21, 0xD0, 0xFC, 0x21,
-    0x83, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x87, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0,
-    0xFD, 0x43, 0xB0, 0xB8, 0xBB, 0xFA, 0x48, 0xFA, 0x29, 0xFF, 0xFD, 0x21, 0xD0, 0xF6, 0x41, 0x80,
-    0xFA, 0x16, 0x21, 0xD1, 0xFC, 0x42, 0x83, 0x80, 0xFF, 0xFD, 0xFA, 0x77, 0x21, 0xD1, 0xF9, 0x41,
-    0x88, 0xFA, 0x05, 0x21, 0xD1, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBB, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xDA, 0x21, 0xD0, 0xFD, 0x41, 0xBB,
-    0xFC, 0xC1, 0x21, 0xD0, 0xFC, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB8, 0xFD, 0x21, 0xD0,
-    0xFD, 0x25, 0xBF, 0xB1, 0xB3, 0xB7, 0xBA, 0xBA, 0xCB, 0xE4, 0xEA, 0xFD, 0xC3, 0x00, 0x61, 0xD1,
-    0xD0, 0x2D, 0xFF, 0x7F, 0xFF, 0xF5, 0xF9, 0xE0, 0xC1, 0x00, 0xD1, 0x2D, 0xF9, 0xD4, 0x41, 0xB3,
-    0xFA, 0x7B, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xBB, 0xBD, 0xFF, 0xFD,
-    0xFB, 0xD5, 0x21, 0xD0, 0xF9, 0x21, 0xBE, 0xFD, 0xA0, 0x09, 0x52, 0x22, 0xBA, 0xBF, 0xFD, 0xFD,
-    0x22, 0x82, 0x86, 0xF8, 0xF8, 0x22, 0xD0, 0xD1, 0xF6, 0xFB, 0x21, 0x81, 0xFB, 0x43, 0xD0, 0xD1,
-    0x2D, 0xFF, 0xE8, 0xFF, 0xFD, 0xF9, 0x9F, 0x41, 0xB0, 0xFA, 0x8A, 0x21, 0xD0, 0xFC, 0x41, 0x82,
-    0xFB, 0x6A, 0x21, 0xD1, 0xFC, 0x41, 0xD0, 0xFA, 0x7F, 0x23, 0xB3, 0xBA, 0xBC, 0xF2, 0xF9, 0xFC,
-    0x21, 0xD0, 0xF9, 0x21, 0xB5, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xF9, 0x76, 0x41, 0xBE, 0xFE,
-    0x20, 0x41, 0xB3, 0xFB, 0x47, 0x21, 0xD0, 0xFC, 0x41, 0xB9, 0xFC, 0x27, 0x21, 0xD0, 0xFC, 0x21,
-    0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0x96, 0x80, 0xF0, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE3,
-    0xFF, 0xFB, 0xF9, 0x52, 0xA0, 0x09, 0x32, 0x21, 0xB6, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD,
-    0x21, 0xB3, 0xF4, 0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD, 0x22, 0xD0, 0xD1, 0xF4, 0xFD, 0x21, 0x80,
-    0xFB, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB1, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0xB7, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0xA1, 0x00, 0xB2, 0xD0, 0xFD, 0x21, 0xB3,
-    0xFB, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xB2, 0xFB, 0x04, 0x21, 0xD0,
-    0xFC, 0x22, 0xB5, 0xB0, 0xF6, 0xFD, 0xA0, 0x0B, 0xD2, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBA, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x8C, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD7,
-    0xFF, 0xFD, 0xF8, 0xD2, 0x41, 0xB7, 0xFB, 0x8B, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0,
-    0xFD, 0x22, 0xB8, 0xBA, 0xBD, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFB, 0xF8, 0xB6, 0x21, 0xBE, 0xB1,
-    0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xF8, 0xAC, 0x50, 0xB0, 0xB5, 0xBE, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD,
-    0xB2, 0xB4, 0xB1, 0xB3, 0xB6, 0xB7, 0xB8, 0xBF, 0xFD, 0xF9, 0xFE, 0x25, 0xFE, 0xC5, 0xFE, 0xD1,
-    0xFF, 0x06, 0xFF, 0x2F, 0xFF, 0x53, 0xFF, 0xD3, 0xFF, 0xEF, 0xFF, 0xF9, 0xFB, 0x33, 0xFB, 0x33,
-    0xFB, 0x33, 0xFB, 0x33, 0xFB, 0x33, 0xFB, 0x33, 0x42, 0x80, 0x82, 0xFB, 0x37, 0xF8, 0x5C, 0x21,
-    0xD1, 0xF9, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81,
-    0xFD, 0xC2, 0x00, 0x61, 0xD1, 0x2D, 0xFF, 0xFD, 0xF8, 0x5B, 0x41, 0x82, 0xFE, 0x28, 0x21, 0xD1,
-    0xFC, 0x21, 0x81, 0xFD, 0x41, 0xB3, 0xF8, 0x30, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0,
-    0xFD, 0x42, 0xB1, 0xB3, 0xFF, 0xFD, 0xFB, 0x35, 0xC3, 0x00, 0x61, 0xD1, 0xD0, 0x2D, 0xFF, 0xE9,
-    0xFF, 0xF9, 0xF8, 0x34, 0x41, 0xB4, 0xF8, 0xD5, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xB0, 0xB5, 0xFF, 0xFD, 0xF8, 0xC8, 0x21, 0xD0,
-    0xF9, 0x21, 0x82, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xF8, 0x08, 0x41, 0xBF, 0xF8, 0xAE, 0x21,
-    0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x41, 0xBE, 0xF8, 0xBF, 0x21, 0xD0, 0xFC, 0x21, 0x96, 0xFD, 0x43,
-    0xD0, 0xD1, 0x2D, 0xFF, 0xF3, 0xFF, 0xFD, 0xF7, 0xED, 0x50, 0x96, 0x83, 0x8E, 0x8F, 0x94, 0x97,
-    0x81, 0x82, 0x80, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0xFF, 0x88, 0xFF, 0xAF, 0xFB, 0x0D,
-    0xFB, 0x0D, 0xFB, 0x0D, 0xFB, 0x0D, 0xFF, 0xDB, 0xFF, 0xF6, 0xFA, 0x71, 0xFA, 0x71, 0xFA, 0x71,
-    0xFA, 0x71, 0xFA, 0x71, 0xFA, 0x71, 0xFA, 0x71, 0xFA, 0x71, 0xC4, 0x00, 0x42, 0xD0, 0xD1, 0xD2,
-    0x27, 0xFF, 0x0D, 0xFF, 0xCF, 0xFC, 0xD6, 0xFA, 0x40, 0x41, 0xB2, 0xFC, 0xEA, 0xC2, 0x00, 0x61,
-    0xD0, 0x2D, 0xFF, 0xFC, 0xF7, 0x9F, 0x41, 0x81, 0xFC, 0xFD, 0xC3, 0x00, 0x61, 0xD0, 0xD1, 0x2D,
-    0xFD, 0x0F, 0xFF, 0xFC, 0xF7, 0x92, 0x41, 0xBA, 0xFD, 0x98, 0xC2, 0x00, 0x61, 0xD0, 0x2D, 0xFF,
-    0xFC, 0xF7, 0x82, 0x41, 0xB8, 0xF7, 0x61, 0x21, 0xD0, 0xFC, 0x21, 0x82, 0xFD, 0x41, 0x8F, 0xF7,
-    0x57, 0x21, 0xD1, 0xFC, 0x21, 0xBD, 0xFD, 0xC3, 0x00, 0xD1, 0xD1, 0xD0, 0x2D, 0xFF, 0xF3, 0xFF,
-    0xFD, 0xF7, 0x65, 0x42, 0xD0, 0x2D, 0xF8, 0x3E, 0xF7, 0x59, 0x50, 0xB0, 0xB5, 0xBE, 0xB9, 0xB3,
-    0xB1, 0xB2, 0xB4, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xFF, 0xB3, 0xFF, 0xC0, 0xFF,
-    0xD0, 0xFF, 0xED, 0xFF, 0xF9, 0xF9, 0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0xF9,
-    0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0x50, 0x96, 0x83, 0x8E, 0x8F,
-    0x94, 0x97, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0xF9, 0xFC, 0xFA, 0x4B,
-    0xFA, 0x4B, 0xFA, 0x4B, 0xFA, 0x4B, 0xFA, 0x4B, 0xF9, 0xAF, 0xF9, 0xAF, 0xF9, 0xAF, 0xF9, 0xAF,
-    0xF9, 0xAF, 0xF9, 0xAF, 0xF9, 0xAF, 0xF9, 0xAF, 0xF9, 0xAF, 0xF9, 0xAF, 0xC4, 0x00, 0x42, 0xD0,
-    0xD1, 0xD2, 0x27, 0xFF, 0x9E, 0xFF, 0xCF, 0xFC, 0x14, 0xF9, 0x7E, 0x41, 0xBC, 0xF6, 0xC9, 0x21,
-    0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x41, 0x86, 0xFC, 0x0C, 0x21,
-    0xD1, 0xFC, 0x21, 0xB0, 0xFD, 0x42, 0xD1, 0xD0, 0xF6, 0xDD, 0xFF, 0xFD, 0x41, 0x96, 0xFD, 0xFC,
-    0x21, 0xD1, 0xFC, 0x21, 0xBB, 0xFD, 0xA1, 0x02, 0x91, 0xD0, 0xFD, 0x21, 0xB0, 0xFB, 0x21, 0xD0,
-    0xFD, 0x44, 0xBA, 0xB2, 0xB4, 0xBD, 0xFF, 0xE4, 0xFB, 0xF2, 0xF6, 0xA5, 0xFF, 0xFD, 0xC3, 0x00,
-    0x61, 0xD1, 0xD0, 0x2D, 0xFF, 0xCA, 0xFF, 0xF3, 0xF6, 0x9E, 0x41, 0xBE, 0xF6, 0x7A, 0x21, 0xD0,
-    0xFC, 0x42, 0xBA, 0xBC, 0xFF, 0xFD, 0xFC, 0x05, 0xC3, 0x00, 0x61, 0xD0, 0xD1, 0x2D, 0xFF, 0xF9,
-    0xFB, 0xEE, 0xF6, 0x84, 0xA0, 0x02, 0x81, 0xA0, 0x04, 0xE1, 0x21, 0xBC, 0xFD, 0x42, 0xBE, 0xB0,
-    0xFF, 0xFA, 0xF6, 0xB9, 0x21, 0xD0, 0xF9, 0x42, 0x80, 0x96, 0xFF, 0xFD, 0xFE, 0x21, 0xA3, 0x02,
-    0x91, 0x27, 0xD0, 0xD1, 0xE6, 0xEC, 0xF9, 0x41, 0xB0, 0xFB, 0xEB, 0x21, 0xD0, 0xFC, 0x21, 0x82,
-    0xFD, 0xC2, 0x02, 0x91, 0xD0, 0xD1, 0xFC, 0x5A, 0xFF, 0xFD, 0x41, 0xBE, 0xF6, 0x79, 0x21, 0xD0,
-    0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB6, 0xF6, 0x1D, 0x21, 0xD0, 0xFC, 0x21, 0x80,
-    0xFD, 0x21, 0xD1, 0xFD, 0x22, 0xB8, 0xB5, 0xF0, 0xFD, 0x21, 0xD0, 0xFB, 0x44, 0xB1, 0xBF, 0xBA,
-    0xB4, 0xFF, 0xC2, 0xFB, 0xEF, 0xFF, 0xD5, 0xFF, 0xFD, 0x42, 0x89, 0x81, 0xF5, 0xFB, 0xF6, 0x2C,
-    0x21, 0xD1, 0xF9, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x43, 0x81, 0x86, 0x87, 0xFB, 0x92, 0xFB,
-    0x9F, 0xFF, 0xFD, 0xC3, 0x00, 0x61, 0xD0, 0xD1, 0x2D, 0xFF, 0xD9, 0xFF, 0xF6, 0xF5, 0xF9, 0xA0,
-    0x03, 0x02, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF,
-    0xFD, 0xFD, 0x26, 0xF5, 0xE1, 0x42, 0xB4, 0xBA, 0xF9, 0x0B, 0xF6, 0x8A, 0x21, 0xD0, 0xF9, 0x21,
-    0x94, 0xFD, 0xA1, 0x04, 0xF1, 0xD1, 0xFD, 0xA0, 0x05, 0xC2, 0x21, 0x94, 0xFD, 0x21, 0xD1, 0xFD,
-    0x21, 0x27, 0xFD, 0x41, 0xBD, 0xF7, 0xB5, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0x80, 0xFD, 0xA1, 0x00, 0xB2, 0xD1, 0xFD, 0x41, 0x8F, 0xF6, 0x7A, 0x21, 0xD1, 0xFC, 0x43,
-    0xB4, 0xBD, 0xBC, 0xF7, 0x99, 0xFF, 0xFD, 0xF6, 0x73, 0x41, 0x82, 0xF7, 0x8F, 0x22, 0xD0, 0xD1,
-    0xF2, 0xFC, 0x23, 0xB2, 0xB4, 0xB9, 0xCE, 0xE1, 0xFB, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xF7, 0xB3,
-    0xA0, 0x04, 0xC2, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x96, 0x83, 0xE4, 0xFD, 0xA0, 0x05, 0xA2, 0x21, 0x8F, 0xFD,
-    0x21, 0xD1, 0xFD, 0x21, 0x27, 0xFD, 0x41, 0xB6, 0xF6, 0x03, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xB0, 0xF5, 0xF0, 0x21, 0xD0, 0xFC,
-    0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xBE, 0xF8, 0x6A, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD,
-    0x41, 0xBC, 0xF6, 0x02, 0x21, 0xD0, 0xFC, 0x21, 0xB9, 0xFD, 0x22, 0xD1, 0xD0, 0xF3, 0xFD, 0xA0,
-    0x09, 0xF2, 0x21, 0xB6, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5,
-    0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x96, 0xF9, 0x14, 0x21, 0xD1, 0xFC, 0x21, 0xBC, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB4, 0xB0, 0xEA, 0xFD, 0x21, 0xD0, 0xFB, 0x46,
-    0xB2, 0xBC, 0xB5, 0xB8, 0xBE, 0xBB, 0xFF, 0x94, 0xFF, 0x94, 0xFF, 0xA7, 0xFF, 0xB4, 0xFF, 0xCB,
-    0xFF, 0xFD, 0x44, 0x27, 0xD1, 0xD0, 0x2D, 0xFF, 0x10, 0xFF, 0x73, 0xFF, 0xED, 0xF4, 0xDA, 0xA0,
-    0x04, 0xF1, 0x41, 0x8C, 0xF5, 0x77, 0x21, 0xD1, 0xFC, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0xB0, 0xFD, 0x41, 0x8F, 0xFA, 0xF0, 0x44, 0x27, 0xD0, 0xD1, 0x2D, 0xFF, 0xE9, 0xFF, 0xF9, 0xFF,
-    0xFC, 0xF4, 0xB6, 0x41, 0xBE, 0xF5, 0x56, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD,
-    0x42, 0xB1, 0xB0, 0xFF, 0xFD, 0xFB, 0x9E, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xF4, 0x95, 0x41, 0xB5,
-    0xF6, 0x9C, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xF4, 0x84, 0x42,
-    0xB5, 0xBB, 0xF6, 0xAA, 0xF5, 0x95, 0x41, 0xB8, 0xF6, 0x84, 0x21, 0xD0, 0xFC, 0x41, 0xB5, 0xF5,
-    0x1C, 0x21, 0xD0, 0xFC, 0x43, 0x81, 0x88, 0x89, 0xF5, 0x1B, 0xFF, 0xFD, 0xFF, 0xFD, 0x21, 0xD1,
-    0xF6, 0x22, 0x82, 0x83, 0xE9, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD9, 0xFF, 0xFB, 0xF4, 0x56,
-    0x42, 0xBE, 0xB0, 0xF5, 0x2E, 0xF5, 0x2E, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xF4, 0x45, 0x50, 0xB0,
-    0xB5, 0xBE, 0xB9, 0xB2, 0xB1, 0xB4, 0xB7, 0xBA, 0xBF, 0xBD, 0xB3, 0xB6, 0xB8, 0xBB, 0xBC, 0xFD,
-    0xA0, 0xFD, 0xBA, 0xFE, 0x45, 0xFA, 0x6A, 0xFE, 0x5D, 0xFF, 0x64, 0xFF, 0x88, 0xFF, 0xA9, 0xFF,
-    0xBA, 0xFF, 0xE8, 0xFF, 0xF9, 0xF6, 0xCC, 0xF6, 0xCC, 0xF6, 0xCC, 0xF6, 0xCC, 0xF6, 0xCC, 0x41,
-    0xBE, 0xF4, 0x1A, 0x21, 0xD0, 0xFC, 0x21, 0xB7, 0xFD, 0xC3, 0x00, 0x61, 0xD0, 0xD1, 0x2D, 0xFF,
-    0xFD, 0xFB, 0xA5, 0xF4, 0x03, 0x42, 0x82, 0x83, 0xF9, 0xCD, 0xF9, 0x8D, 0xA1, 0x02, 0x91, 0xD1,
-    0xF9, 0x21, 0x81, 0xFB, 0x41, 0xD0, 0xF6, 0xD6, 0x43, 0xBA, 0xB4, 0xB3, 0xFD, 0x0D, 0xFF, 0xFC,
-    0xF6, 0xDE, 0xC3, 0x00, 0x61, 0xD1, 0xD0, 0x2D, 0xFF, 0xEF, 0xFF, 0xF6, 0xF3, 0xDA, 0x41, 0xB0,
-    0xF6, 0x02, 0x21, 0xD0, 0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB8, 0xFD, 0x21, 0xD0,
-    0xFD, 0x41, 0xBD, 0xFB, 0x97, 0x21, 0xD0, 0xFC, 0x22, 0xB4, 0xB5, 0xF6, 0xFD, 0x42, 0xD0, 0x2D,
-    0xFF, 0xFB, 0xF3, 0xAF, 0x41, 0xB1, 0xF4, 0x55, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x41, 0xB6,
-    0xF6, 0xD2, 0x21, 0xD0, 0xFC, 0x21, 0x8F, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF3, 0xFF, 0xFD,
-    0xF3, 0x94, 0x41, 0xBB, 0xFE, 0xE5, 0x42, 0x80, 0x87, 0xFE, 0x54, 0xF4, 0x33, 0x22, 0xD0, 0xD1,
-    0xF5, 0xF9, 0x21, 0xBE, 0xFB, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xF3, 0x77, 0x42, 0x81, 0x89, 0xF6,
-    0xA4, 0xF4, 0x1D, 0x21, 0xD1, 0xF9, 0x21, 0xB8, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xF3, 0x63,
-    0x50, 0x96, 0x83, 0x8E, 0x8F, 0x94, 0x97, 0x80, 0x81, 0x85, 0x87, 0x82, 0x84, 0x86, 0x88, 0x89,
-    0x8C, 0xFF, 0x59, 0xFF, 0x82, 0xF6, 0x86, 0xF6, 0x86, 0xF6, 0x86, 0xF6, 0x86, 0xFF, 0xAD, 0xFF,
-    0xC8, 0xFF, 0xE5, 0xFF, 0xF9, 0xF5, 0xEA, 0xF5, 0xEA, 0xF5, 0xEA, 0xF5, 0xEA, 0xF5, 0xEA, 0xF5,
-    0xEA, 0xC4, 0x00, 0x42, 0xD0, 0xD1, 0xD2, 0x27, 0xFE, 0xED, 0xFF, 0xCF, 0xF8, 0x4F, 0xF5, 0xB9,
-    0xC1, 0x00, 0x42, 0x2D, 0xF3, 0x1C, 0xA0, 0x01, 0x01, 0x42, 0x2E, 0x2D, 0xFF, 0xFD, 0xF3, 0x13,
-    0x41, 0x81, 0xF3, 0xE2, 0x21, 0xD1, 0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD,
-    0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x43, 0x2E, 0xD0, 0x2D, 0xFF, 0xE0, 0xFF, 0xFD, 0xF2, 0xF6,
-    0xA0, 0x01, 0x72, 0x21, 0x2E, 0xFD, 0x21, 0x8C, 0xFD, 0xA0, 0x00, 0xB1, 0x21, 0xB6, 0xFD, 0x21,
-    0xD0, 0xFD, 0x22, 0xB6, 0xB7, 0xF7, 0xF7, 0x21, 0xBA, 0xF2, 0x21, 0xD0, 0xFD, 0x21, 0x81, 0xFD,
-    0x22, 0xD0, 0xD1, 0xF2, 0xFD, 0x41, 0x82, 0xFC, 0xDA, 0x21, 0xD1, 0xFC, 0x21, 0x81, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBF, 0xFD, 0xA1, 0x00, 0xB1, 0xD0, 0xFD,
-    0x21, 0xBA, 0xFB, 0x21, 0x96, 0xC6, 0x21, 0xD1, 0xFD, 0x21, 0x86, 0xFD, 0x22, 0xD0, 0xD1, 0xF4,
-    0xFD, 0x23, 0xB0, 0xB8, 0xBE, 0xBE, 0xCF, 0xFB, 0x44, 0x2E, 0xD1, 0xD0, 0x2D, 0xFF, 0x7E, 0xFF,
-    0xAE, 0xFF, 0xF9, 0xF2, 0x94, 0xA0, 0x02, 0xE2, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96,
-    0xFD, 0x21, 0xD1, 0xFD, 0x41, 0x96, 0xF3, 0x4E, 0x21, 0xD1, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1,
-    0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x81, 0xF4, 0x61, 0x21, 0xD1, 0xFC, 0x21, 0xB5,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0xB2, 0xB4, 0xEA, 0xFD, 0x21,
-    0xD0, 0xFB, 0x21, 0x81, 0xD6, 0x21, 0xD1, 0xFD, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBC,
-    0xFD, 0x21, 0xD0, 0xFD, 0x23, 0xB2, 0xB0, 0xB5, 0xBD, 0xEB, 0xFD, 0xA0, 0x05, 0x73, 0x21, 0xB9,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0xA0, 0x07, 0x32, 0x21, 0xBD, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB4, 0xBC, 0xEE, 0xFD, 0x21, 0xD0,
-    0xFB, 0x41, 0xBB, 0xF2, 0xE1, 0x21, 0xD0, 0xFC, 0x41, 0xBD, 0xF2, 0xDA, 0x21, 0xD0, 0xFC, 0x21,
-    0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB3, 0xBF, 0xF0, 0xFD, 0x21, 0xD0, 0xFB, 0x22, 0x96, 0x83,
-    0xE1, 0xFD, 0x22, 0xD0, 0xD1, 0xB2, 0xFB, 0x41, 0xBB, 0xF2, 0xAD, 0x21, 0xD0, 0xFC, 0x21, 0xBE,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB1, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD,
-    0xA0, 0x04, 0xC1, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x23,
-    0xB7, 0xB9, 0xBA, 0xD3, 0xEE, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xF1, 0xB6, 0xA0, 0x07, 0x01,
-    0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x80, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x41, 0xB7, 0xF3, 0x8D, 0x21,
-    0xD0, 0xFC, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x22, 0xD1, 0xD0,
-    0xDB, 0xFD, 0xA0, 0x03, 0xD1, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x8C, 0xFD, 0xA0, 0x03, 0x72, 0x21, 0x82, 0xFD,
-    0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB9, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1,
-    0xFD, 0x21, 0xB5, 0xFD, 0x22, 0xD1, 0xD0, 0xD3, 0xFD, 0x21, 0x80, 0xEF, 0x21, 0xD1, 0xFD, 0x21,
-    0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x43, 0xBA, 0xBB, 0xB3, 0xFF, 0xA8, 0xFF, 0xEF, 0xFF, 0xFD, 0x41,
-    0xB5, 0xF5, 0x86, 0x21, 0xD0, 0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x80, 0xF4, 0xC4,
-    0x21, 0xD1, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x22,
-    0xB5, 0xB0, 0xEA, 0xFD, 0x21, 0xD0, 0xFB, 0x21, 0x81, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xCB,
-    0xFF, 0xFD, 0xF0, 0xE2, 0x41, 0xB0, 0xF4, 0xC1, 0x21, 0xD0, 0xFC, 0x21, 0xB4, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xB3, 0xFD, 0x42, 0xD0, 0xD1, 0xF3, 0xCA, 0xF4, 0x49, 0x21, 0xBE, 0xF9, 0x21, 0xD0,
-    0xFD, 0x41, 0xBF, 0xF1, 0x41, 0x21, 0xD0, 0xFC, 0x41, 0xB0, 0xF4, 0x39, 0x21, 0xD0, 0xFC, 0x22,
-    0xB0, 0xB4, 0xF6, 0xFD, 0x21, 0xD0, 0xFB, 0x21, 0xBC, 0xEE, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD,
-    0x21, 0xD0, 0xFD, 0x41, 0x81, 0xF4, 0x1E, 0x21, 0xD1, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xB8, 0xD8,
-    0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x22, 0xD0, 0xD1, 0xF4, 0xFD, 0x24, 0xB3, 0xB7, 0xBA, 0xBF,
-    0xC3, 0xD9, 0xE5, 0xFB, 0x21, 0xD0, 0xF7, 0xA0, 0x07, 0x52, 0x21, 0xBF, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB8, 0xFD, 0xA0, 0x0A, 0x83, 0x21, 0x85, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0xA0, 0x0C, 0xE4, 0x21, 0x80, 0xFD, 0x21, 0xD1,
-    0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBF, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xDC,
-    0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x23, 0xBC, 0xBE, 0xBF, 0xDC, 0xF1, 0xFD,
-    0x21, 0xB4, 0xC9, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB6, 0xCC, 0x21,
-    0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x80, 0x96, 0xF1, 0xFD, 0x22, 0xD0, 0xD1,
-    0xDC, 0xFB, 0x21, 0x82, 0xFB, 0x42, 0xD0, 0xD1, 0xFF, 0xA1, 0xFF, 0xFD, 0x42, 0x94, 0x80, 0xFF,
-    0x88, 0xFF, 0xF9, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0x2E, 0xFF, 0xF9, 0xEF, 0xF9, 0x50, 0xBA, 0xBF,
-    0xB1, 0xB2, 0xB7, 0xB9, 0xBB, 0xBD, 0xB5, 0xB0, 0xBE, 0xB3, 0xB4, 0xB6, 0xB8, 0xBC, 0xFC, 0xD3,
-    0xFC, 0xD3, 0xFC, 0xD3, 0xFC, 0xDC, 0xFC, 0xDC, 0xFC, 0xF9, 0xFD, 0x5B, 0xFC, 0xDC, 0xFE, 0x39,
-    0xFF, 0x0D, 0xFF, 0xF6, 0xF2, 0x7D, 0xF2, 0x7D, 0xF2, 0x7D, 0xF2, 0x7D, 0xF2, 0x7D, 0xA0, 0x01,
-    0x93, 0x21, 0x2E, 0xFD, 0x21, 0xB2, 0xFD, 0x21, 0x80, 0xFA, 0x43, 0x2E, 0xD0, 0xD1, 0xFC, 0xC6,
-    0xFF, 0xFA, 0xFF, 0xFD, 0x21, 0xBA, 0xED, 0x21, 0xD0, 0xFD, 0x22, 0x82, 0x8C, 0xF0, 0xFD, 0xC3,
-    0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xFC, 0x87, 0xFF, 0xFB, 0xEF, 0x9D, 0xC2, 0x00, 0x42, 0xD1, 0x2D,
-    0xFC, 0xAB, 0xEF, 0x91, 0xC1, 0x02, 0xC1, 0xD0, 0xFE, 0x51, 0x21, 0xB4, 0xFA, 0xA1, 0x00, 0xB1,
-    0xD0, 0xFD, 0x21, 0xBD, 0xFB, 0x41, 0xB8, 0xFC, 0x94, 0x21, 0xD0, 0xFC, 0x21, 0x82, 0xFD, 0x22,
-    0xD0, 0xD1, 0xF3, 0xFD, 0x41, 0x82, 0xFC, 0x85, 0x21, 0xD1, 0xFC, 0x21, 0x81, 0xFD, 0x21, 0xD1,
-    0xFD, 0x41, 0xB7, 0xFC, 0x89, 0x41, 0xBD, 0xFC, 0x74, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x22, 0xD0, 0xD1, 0xEC, 0xFD, 0x23, 0xB0, 0xB5, 0xB8, 0xD5, 0xE4,
-    0xFB, 0x41, 0xB4, 0xFC, 0x58, 0x21, 0xD0, 0xFC, 0xA0, 0x07, 0x12, 0x21, 0x82, 0xFD, 0x21, 0xD1,
-    0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBF, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0xB6, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x22,
-    0x83, 0x96, 0xD6, 0xFD, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xFB, 0xF2, 0xFF, 0xC6, 0xFF, 0xFB, 0xEF,
-    0x08, 0xA0, 0x02, 0xE1, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD,
-    0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xBE, 0xB1, 0xEF, 0x6C, 0xFF, 0xFD, 0x42, 0xD0, 0x2D,
-    0xFF, 0xF9, 0xEE, 0xDF, 0x50, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x80, 0x96, 0x94,
-    0x97, 0x83, 0x8C, 0x8E, 0x8F, 0xFF, 0x3B, 0xFB, 0xBC, 0xFB, 0xBC, 0xFB, 0xBC, 0xFF, 0x47, 0xFB,
-    0xBC, 0xFB, 0xBC, 0xFB, 0xBC, 0xFF, 0xD0, 0xFF, 0xF9, 0xF1, 0x66, 0xF1, 0x66, 0xF1, 0x66, 0xF1,
-    0x66, 0xF1, 0x66, 0xF1, 0x66, 0xA0, 0x05, 0xB1, 0x21, 0x8C, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x82,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x94, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xEE, 0x95, 0x44, 0xD0,
-    0xD1, 0x27, 0xD2, 0xFE, 0x9F, 0xFF, 0xB6, 0xFF, 0xF9, 0xF3, 0xB2, 0xA0, 0x06, 0x93, 0x21, 0xB3,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xBB, 0xB8, 0xFF, 0xFD, 0xEF,
-    0x9D, 0xC3, 0x00, 0x42, 0x2E, 0xD0, 0x2D, 0xFB, 0x55, 0xFF, 0xF9, 0xEE, 0x6B, 0x42, 0x80, 0x8C,
-    0xFB, 0x76, 0xFB, 0x76, 0x42, 0xB7, 0xBE, 0xEF, 0x05, 0xEF, 0xB3, 0x21, 0xD0, 0xF9, 0x21, 0xB2,
-    0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xB0, 0xBE, 0xEF, 0xA3, 0xFF, 0xFD, 0xC4, 0x00, 0x42, 0x2E, 0xD1,
-    0xD0, 0x2D, 0xFB, 0x2B, 0xFF, 0xE2, 0xFF, 0xF9, 0xEE, 0x41, 0x41, 0xB0, 0xF1, 0x66, 0x21, 0xD0,
-    0xFC, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB8, 0xFD, 0xC3, 0x00, 0x42, 0x2E, 0xD0, 0x2D,
-    0xFB, 0x0C, 0xFF, 0xFD, 0xEE, 0x22, 0xC3, 0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xFB, 0x00, 0xFB, 0x30,
-    0xEE, 0x16, 0x41, 0xB4, 0xFF, 0x89, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0xBB, 0xFD, 0xC3, 0x00, 0x42, 0x2E, 0xD0, 0x2D, 0xFA, 0xE4, 0xFF, 0xFD, 0xED, 0xFA, 0x42, 0x81,
-    0x88, 0xF1, 0x22, 0xEE, 0xA1, 0x42, 0xD0, 0xD1, 0xF5, 0xBF, 0xFF, 0xF9, 0x42, 0xB0, 0xBE, 0xFF,
-    0xF9, 0xEF, 0x0B, 0xC4, 0x00, 0x42, 0x2E, 0xD1, 0xD0, 0x2D, 0xFA, 0xC3, 0xFA, 0xF3, 0xFF, 0xF9,
-    0xED, 0xD9, 0xA0, 0x05, 0xE2, 0x21, 0x8F, 0xFD, 0x21, 0xD1, 0xFD, 0xC3, 0x00, 0x42, 0x2E, 0x27,
-    0x2D, 0xFA, 0xAB, 0xFF, 0xFD, 0xED, 0xC1, 0xC2, 0x00, 0x42, 0x2E, 0x2D, 0xFA, 0x9F, 0xED, 0xB5,
-    0x41, 0xB2, 0xFF, 0x2B, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB2, 0xF0,
-    0xD3, 0x21, 0xD0, 0xFC, 0x41, 0x8F, 0xF5, 0x74, 0x21, 0xD1, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1,
-    0xFD, 0x23, 0xBB, 0xB5, 0xBE, 0xE9, 0xF0, 0xFD, 0x41, 0xBD, 0xFF, 0x03, 0x21, 0xD0, 0xFC, 0x21,
-    0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0xC4, 0x00,
-    0x42, 0x2E, 0xD0, 0xD1, 0x2D, 0xFA, 0x58, 0xFF, 0xE3, 0xFF, 0xFD, 0xED, 0x6E, 0x41, 0xB4, 0xF0,
-    0x99, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0xC3, 0x00, 0x42, 0x2E, 0xD0, 0x2D, 0xFA, 0x3F, 0xFF,
-    0xFD, 0xED, 0x55, 0xA0, 0x06, 0x02, 0x21, 0x87, 0xFD, 0x41, 0xB8, 0xEE, 0x0B, 0x21, 0xD0, 0xFC,
-    0x21, 0xB4, 0xFD, 0x22, 0xD1, 0xD0, 0xF3, 0xFD, 0x41, 0xB2, 0xED, 0xFC, 0x41, 0xBD, 0xED, 0xF8,
-    0x21, 0xD0, 0xFC, 0x21, 0x81, 0xFD, 0x22, 0xD0, 0xD1, 0xF2, 0xFD, 0x43, 0x97, 0x83, 0x8F, 0xED,
-    0xE9, 0xFF, 0xE8, 0xFF, 0xFB, 0x42, 0xB4, 0xBC, 0xFF, 0xCE, 0xED, 0xDF, 0x21, 0x82, 0xC7, 0x22,
-    0xD0, 0xD1, 0xF6, 0xFD, 0xA0, 0x07, 0x92, 0x21, 0xB4, 0xFD, 0x21, 0x82, 0xFA, 0x22, 0xD0, 0xD1,
-    0xFA, 0xFD, 0x21, 0xB9, 0xFB, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB9,
-    0xBD, 0xE1, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xC8, 0xFF, 0xFB, 0xEC, 0xE9, 0xA0, 0x07, 0x72,
-    0x21, 0x86, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0xA0, 0x0B, 0xF3, 0x21, 0x82, 0xFD, 0x21, 0xD1,
-    0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB9, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0x8C, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0xBD, 0xBB, 0xD0, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFB, 0xEC,
-    0x92, 0x41, 0xBD, 0xF6, 0x9E, 0x21, 0xD0, 0xFC, 0x21, 0x85, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x80,
-    0xFD, 0x21, 0x82, 0xD5, 0x21, 0xD1, 0xFD, 0x21, 0x8C, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBB, 0xFD,
-    0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xEE, 0xFF, 0xFD, 0xEC, 0x6C, 0xA0, 0x05, 0x72, 0x21, 0xBE, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0xBA, 0xFD, 0x41, 0x94, 0xEC, 0x3E, 0x21, 0xD1, 0xFC, 0x21, 0xBD, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0x82, 0xFD, 0x22, 0xD0, 0xD1, 0xE1, 0xFD, 0x41, 0x87, 0xEC, 0x1D, 0x21, 0xD1, 0xFC, 0x21, 0xB0,
-    0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xB2, 0xBD, 0xEF, 0x22, 0xFF, 0xFD, 0x21, 0xD0, 0xF9, 0x22, 0x81,
-    0x94, 0xE4, 0xFD, 0xA0, 0x05, 0x22, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0x80, 0xE8, 0x21, 0xD1,
-    0xFD, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB1, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB7, 0xFD,
-    0x22, 0xD1, 0xD0, 0xE8, 0xFD, 0x21, 0xBE, 0xFB, 0x21, 0xD0, 0xFD, 0x41, 0x80, 0xFA, 0x8F, 0x21,
-    0xD1, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5,
-    0xF1, 0x21, 0xD0, 0xFD, 0x21, 0xBF, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD,
-    0x22, 0xBC, 0xB0, 0xEB, 0xFD, 0x21, 0xD0, 0xFB, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x8C,
-    0xFD, 0x21, 0xD1, 0xFD, 0x22, 0xB4, 0xBB, 0xC4, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0x85, 0xFF,
-    0xFB, 0xEB, 0xA3, 0x50, 0xB1, 0xB3, 0xB4, 0xB6, 0xB7, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xB9, 0xB2,
-    0xB8, 0xB0, 0xB5, 0xBE, 0xFD, 0x2E, 0xF8, 0x7D, 0xFD, 0x58, 0xFD, 0x77, 0xFD, 0x83, 0xFD, 0x9F,
-    0xFD, 0xC0, 0xFD, 0xD8, 0xFD, 0xE4, 0xFE, 0x2B, 0xFD, 0xE4, 0xFE, 0x44, 0xFE, 0xB0, 0xFF, 0x07,
-    0xFF, 0x2D, 0xFF, 0xF6, 0x41, 0xBB, 0xFD, 0xC6, 0x21, 0xD0, 0xFC, 0x41, 0xB9, 0xEC, 0x0E, 0x21,
-    0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB4, 0xB6, 0xF0, 0xFD, 0x21, 0xD0, 0xFB,
-    0x41, 0xBB, 0xEC, 0x7D, 0x21, 0xD0, 0xFC, 0x21, 0xB7, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xBE, 0xB0,
-    0xF0, 0xFD, 0xC3, 0x00, 0x42, 0x2E, 0xD0, 0x2D, 0xF8, 0x24, 0xFF, 0xFB, 0xEB, 0x3A, 0x41, 0x8C,
-    0xFB, 0x73, 0x42, 0xD0, 0xD1, 0xFB, 0x72, 0xFF, 0xFC, 0x42, 0x2E, 0xD0, 0xF8, 0x37, 0xFB, 0x7B,
-    0x43, 0x82, 0x8C, 0x8E, 0xFF, 0xF2, 0xFF, 0xF9, 0xF2, 0xF8, 0xC3, 0x00, 0x42, 0x2E, 0xD1, 0x2D,
-    0xF7, 0xFC, 0xFF, 0xF6, 0xEB, 0x12, 0x42, 0x82, 0x87, 0xFC, 0x85, 0xFC, 0x85, 0x21, 0xD1, 0xF9,
-    0x21, 0x83, 0xFD, 0x21, 0xD1, 0xFD, 0x42, 0x80, 0x96, 0xFF, 0xFD, 0xEC, 0x51, 0xC3, 0x00, 0x42,
-    0x2E, 0xD1, 0x2D, 0xF7, 0xD9, 0xFF, 0xF9, 0xEA, 0xEF, 0x41, 0x87, 0xEB, 0xB9, 0x21, 0xD1, 0xFC,
-    0x21, 0x83, 0xFD, 0x41, 0x8F, 0xF5, 0x14, 0x21, 0xD1, 0xFC, 0x21, 0x27, 0xFD, 0xA0, 0x07, 0xB1,
-    0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0xA0, 0x07, 0xC3, 0x42,
-    0xBD, 0xBE, 0xF5, 0x41, 0xFF, 0xFD, 0x21, 0xD0, 0xF9, 0x42, 0xB6, 0xB7, 0xF8, 0x91, 0xF8, 0x91,
-    0x21, 0xD0, 0xF9, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x42,
-    0xBC, 0xB1, 0xF5, 0x21, 0xFF, 0xFD, 0x21, 0xD0, 0xF9, 0x24, 0xB2, 0xB7, 0xB5, 0xBE, 0xC1, 0xD0,
-    0xDD, 0xFD, 0x22, 0xD1, 0xD0, 0xAE, 0xF7, 0x21, 0xB4, 0xFB, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xEA,
-    0x82, 0x41, 0xB4, 0xF6, 0x93, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xEA, 0x77, 0x50, 0x80, 0x81, 0x82,
-    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x96, 0x83, 0x94, 0x97, 0x8C, 0x8E, 0x8F, 0xFF, 0x36, 0xFF,
-    0x5E, 0xFF, 0x81, 0xF7, 0x54, 0xFC, 0xBB, 0xFA, 0xDF, 0xFC, 0xBB, 0xFC, 0xBB, 0xFC, 0xBB, 0xFF,
-    0xEE, 0xFF, 0xF9, 0xEC, 0xFE, 0xEC, 0xFE, 0xEC, 0xFE, 0xEC, 0xFE, 0xEC, 0xFE, 0xA0, 0x07, 0xF2,
-    0x21, 0xB7, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x8F, 0xFD, 0xC2, 0x00, 0x72, 0xD1, 0x2D, 0xFF, 0xFD,
-    0xEA, 0x33, 0x44, 0xD0, 0xD1, 0x27, 0xD2, 0xFE, 0x91, 0xFF, 0xBA, 0xFF, 0xF7, 0xEF, 0x4E, 0x41,
-    0xB7, 0xF7, 0x3A, 0x41, 0x88, 0xF7, 0x36, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x42, 0xB4, 0xBD, 0xF7,
-    0x2D, 0xF7, 0x2D, 0x21, 0xD0, 0xF9, 0x43, 0x8C, 0x83, 0x8F, 0xF7, 0x1D, 0xFF, 0xF1, 0xFF, 0xFD,
-    0x42, 0xB1, 0xBD, 0xF7, 0x19, 0xF7, 0x19, 0x21, 0xD0, 0xF9, 0x41, 0xB1, 0xF7, 0x0F, 0x21, 0xD0,
-    0xFC, 0x43, 0xB0, 0xB8, 0xBE, 0xFA, 0xB4, 0xFF, 0xF6, 0xFF, 0xFD, 0x44, 0x2E, 0xD1, 0xD0, 0x2D,
-    0xF6, 0xCB, 0xFF, 0xDB, 0xFF, 0xF6, 0xE9, 0xE1, 0x41, 0xBB, 0xF6, 0xF1, 0x21, 0xD0, 0xFC, 0x21,
-    0xD0, 0xB0, 0x43, 0xB0, 0xB8, 0xBE, 0xFA, 0x77, 0xFF, 0xFA, 0xFF, 0xFD, 0x41, 0x87, 0xF6, 0xEE,
-    0x21, 0xD1, 0xFC, 0x21, 0x83, 0xFD, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xF6, 0xA0, 0xFF, 0xEC, 0xFF,
-    0xFD, 0xE9, 0xB6, 0xA0, 0x08, 0x12, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x8C, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x82,
-    0xFD, 0x41, 0xD1, 0xEC, 0x76, 0x41, 0xD0, 0xF8, 0x15, 0x43, 0xBE, 0xBB, 0xBD, 0xE9, 0x6B, 0xFF,
-    0xF8, 0xFF, 0xFC, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xEB, 0xFF, 0xF6, 0xE9, 0x79, 0xA0, 0x08, 0x33,
-    0x21, 0xB7, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0xA0, 0x0B, 0x73, 0x21,
-    0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB3, 0xFD, 0x21, 0xD0,
-    0xFD, 0x22, 0x80, 0x83, 0xE8, 0xFD, 0x21, 0xD1, 0xFB, 0x21, 0xBF, 0xFD, 0x21, 0xD0, 0xFD, 0x41,
-    0xB9, 0xF8, 0xA8, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21,
-    0xD0, 0xFD, 0x22, 0x81, 0x84, 0xEA, 0xFD, 0x41, 0xB5, 0xEC, 0x0D, 0x21, 0xD0, 0xFC, 0x21, 0xBC,
-    0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xF1, 0xFF, 0xFD, 0xE9, 0x1B, 0x50, 0xBA, 0xBF, 0xB3, 0xB2,
-    0xB4, 0xBB, 0xBC, 0xBD, 0xB5, 0xBE, 0xB0, 0xB1, 0xB6, 0xB7, 0xB8, 0xB9, 0xF5, 0xF5, 0xF5, 0xF5,
-    0xFB, 0x5C, 0xF5, 0xFE, 0xF5, 0xFE, 0xFF, 0x30, 0xF5, 0xFE, 0xFF, 0x5B, 0xFF, 0x98, 0xFF, 0xF6,
-    0xEB, 0x9F, 0xEB, 0x9F, 0xEB, 0x9F, 0xEB, 0x9F, 0xEB, 0x9F, 0xEB, 0x9F, 0x41, 0xD0, 0xF9, 0x28,
-    0x42, 0x82, 0x8C, 0xFF, 0xFC, 0xF5, 0xF3, 0xC3, 0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xF5, 0xBF, 0xFF,
-    0xF9, 0xE8, 0xD5, 0x45, 0xB2, 0xB4, 0xB9, 0xBC, 0xBD, 0xF5, 0xE6, 0xF5, 0xE6, 0xF5, 0xE6, 0xF5,
-    0xE6, 0xF5, 0xE6, 0x41, 0xB7, 0xFB, 0xB1, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB1, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0xA1,
-    0x00, 0xB1, 0xD0, 0xFD, 0x45, 0x82, 0x84, 0x88, 0x8E, 0x94, 0xF9, 0x25, 0xFF, 0xFB, 0xF5, 0xB5,
-    0xF5, 0xB5, 0xF5, 0xB5, 0x22, 0xD0, 0xD1, 0xBF, 0xF0, 0x41, 0x8C, 0xF5, 0xA0, 0x21, 0xD1, 0xFC,
-    0x42, 0x81, 0x86, 0xF5, 0x99, 0xFF, 0xFD, 0x21, 0xD1, 0xF9, 0x41, 0xB0, 0xF9, 0x3B, 0x21, 0xD0,
-    0xFC, 0x44, 0xB1, 0xB6, 0xB7, 0xBC, 0xF5, 0x88, 0xF5, 0x88, 0xF5, 0x88, 0xFF, 0xFD, 0x41, 0xB9,
-    0xF5, 0xA1, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0x81, 0xFD, 0x22, 0xD0, 0xD1, 0xDD, 0xFD, 0x23, 0xB0, 0xB5, 0xBE, 0xBB, 0xCE, 0xFB,
-    0x43, 0xB2, 0xBD, 0xBF, 0xF8, 0xEF, 0xF8, 0xD8, 0xF5, 0x59, 0x21, 0xD0, 0xF6, 0x41, 0xB2, 0xF5,
-    0x4C, 0x42, 0x82, 0x88, 0xF5, 0x48, 0xF5, 0x48, 0x22, 0xD0, 0xD1, 0xF5, 0xF9, 0x22, 0x83, 0x96,
-    0xED, 0xFB, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xF5, 0x04, 0xFF, 0xD7, 0xFF, 0xFB, 0xE8, 0x1A, 0xA0,
-    0x08, 0x63, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC,
-    0xFD, 0xA1, 0x00, 0xB2, 0xD0, 0xFD, 0x21, 0xBE, 0xFB, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21,
-    0xD1, 0xFD, 0xA0, 0x0B, 0x52, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBA, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0x96, 0xF1, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x96, 0xFD,
-    0x21, 0xD1, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB0, 0xB5, 0xE5, 0xFD, 0x21, 0xD0,
-    0xFB, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB4, 0xBF,
-    0xC2, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFB, 0xE7, 0xAA, 0x50, 0x81, 0x82, 0x84, 0x86, 0x87, 0x88,
-    0x80, 0x96, 0x94, 0x97, 0x83, 0x85, 0x89, 0x8C, 0x8E, 0x8F, 0xFE, 0xCE, 0xF9, 0xEE, 0xF4, 0x87,
-    0xF4, 0x87, 0xF4, 0x87, 0xF4, 0x87, 0xFF, 0x89, 0xFF, 0xF9, 0xEA, 0x31, 0xEA, 0x31, 0xEA, 0x31,
-    0xEA, 0x31, 0xEA, 0x31, 0xEA, 0x31, 0xEA, 0x31, 0xEA, 0x31, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFE,
-    0x61, 0xFF, 0xCF, 0xEC, 0x96, 0xEA, 0x00, 0x41, 0x8F, 0xF4, 0x82, 0xC2, 0x00, 0x42, 0xD1, 0x2D,
-    0xFF, 0xFC, 0xE7, 0x61, 0x41, 0x8C, 0xE8, 0x2E, 0x21, 0xD1, 0xFC, 0x21, 0xBB, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD,
-    0xC3, 0x00, 0xC1, 0x2E, 0xD0, 0x2D, 0xF4, 0x26, 0xFF, 0xFD, 0xE7, 0x3C, 0xA0, 0x08, 0x92, 0x21,
-    0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0xC4, 0x00, 0xC1, 0x2E, 0xD1, 0xD0, 0x2D, 0xF4,
-    0x0E, 0xF4, 0x3E, 0xFF, 0xFD, 0xE7, 0x24, 0xA0, 0x08, 0xE3, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD,
-    0x21, 0xBF, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD, 0x43, 0x2E, 0xD1, 0x2D, 0xF3, 0xED, 0xFF,
-    0xFD, 0xE7, 0x03, 0x41, 0x80, 0xF1, 0x7D, 0x21, 0xD1, 0xFC, 0x42, 0x94, 0x8E, 0xF1, 0x90, 0xF1,
-    0x90, 0x21, 0xD1, 0xF9, 0x21, 0x27, 0xFD, 0x41, 0xBB, 0xF9, 0x9C, 0x21, 0xD0, 0xFC, 0x21, 0xBE,
-    0xFD, 0x21, 0x96, 0xFA, 0x22, 0xD0, 0xD1, 0xFA, 0xFD, 0x21, 0xB2, 0xFB, 0x21, 0xD0, 0xFD, 0xA0,
-    0x09, 0x93, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x45, 0xBE, 0xB2, 0xB7, 0xBA, 0xB9, 0xFF, 0xCF,
-    0xFF, 0xDC, 0xFF, 0xF4, 0xFD, 0x97, 0xFF, 0xFD, 0x43, 0xB4, 0xBC, 0xB6, 0xE7, 0x7C, 0xE7, 0x7C,
-    0xE7, 0x7C, 0x41, 0x82, 0xE7, 0x72, 0x21, 0xD1, 0xFC, 0x42, 0x85, 0x81, 0xE7, 0x6B, 0xFF, 0xFD,
-    0x22, 0xD0, 0xD1, 0xE8, 0xF9, 0xA0, 0x09, 0x12, 0x21, 0xB7, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB3, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21,
-    0xD0, 0xFD, 0x42, 0xBA, 0xBC, 0xE7, 0x32, 0xE7, 0x32, 0x21, 0xD0, 0xF9, 0x23, 0x97, 0x80, 0x83,
-    0xC4, 0xF3, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0x95, 0xFF, 0xF9, 0xE6, 0x59, 0x42, 0xD0, 0x2D,
-    0xE9, 0x7F, 0xE6, 0x4F, 0x43, 0xB2, 0xBB, 0xBD, 0xE6, 0xF5, 0xE6, 0xF5, 0xE6, 0xF5, 0x42, 0x82,
-    0x94, 0xE6, 0xEB, 0xE6, 0xEB, 0x22, 0xD0, 0xD1, 0xEF, 0xF9, 0x21, 0xB0, 0xFB, 0x42, 0xD0, 0x2D,
-    0xFF, 0xFD, 0xE6, 0x2F, 0x41, 0xB3, 0xF3, 0x45, 0x21, 0xD0, 0xFC, 0x41, 0xBC, 0xF5, 0xAC, 0x21,
-    0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0,
-    0xFD, 0x21, 0xD0, 0xFD, 0x43, 0x8E, 0x94, 0x85, 0xF3, 0x25, 0xF3, 0x25, 0xFF, 0xFD, 0x21, 0xD1,
-    0xF6, 0x22, 0xB8, 0xBE, 0xD7, 0xFD, 0x41, 0xB9, 0xF3, 0x13, 0x42, 0x80, 0x87, 0xF3, 0x0F, 0xF3,
-    0x4C, 0x22, 0xD0, 0xD1, 0xF5, 0xF9, 0x21, 0x96, 0xFB, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE8, 0xFF,
-    0xFD, 0xE5, 0xE3, 0xA0, 0x08, 0xB3, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xB4, 0xF4, 0x22, 0xD1, 0xD0, 0xFA, 0xFD, 0xA0, 0x08, 0xB2,
-    0x21, 0xB6, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x8E, 0xFD, 0x41,
-    0xB7, 0xEF, 0xC0, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0x22, 0xD1, 0xD0, 0xF3, 0xFD, 0x21, 0xB4,
-    0xDF, 0x21, 0xD0, 0xFD, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xD3, 0x21, 0xD0, 0xFD,
-    0x21, 0x83, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB2, 0xC7, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE,
-    0xDF, 0x21, 0xD0, 0xFD, 0x41, 0x82, 0xFF, 0xA9, 0x21, 0xD1, 0xFC, 0x21, 0x84, 0xFD, 0x21, 0xD1,
-    0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x47, 0xB0, 0xB1, 0xB2, 0xB4, 0xB7, 0xBA, 0xBD, 0xFF,
-    0x91, 0xFF, 0xB2, 0xFF, 0xC0, 0xFF, 0xCC, 0xFF, 0xE4, 0xFF, 0xEA, 0xFF, 0xFD, 0x41, 0x81, 0xFF,
-    0x80, 0x21, 0xD1, 0xFC, 0x21, 0x94, 0xFD, 0x41, 0xB2, 0xEF, 0x48, 0x21, 0xD0, 0xFC, 0x21, 0x80,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB7, 0xFD, 0x22, 0xD1, 0xD0,
-    0xE7, 0xFD, 0x21, 0xB5, 0xFB, 0x21, 0xD0, 0xFD, 0x41, 0x80, 0xFF, 0x55, 0x21, 0xD1, 0xFC, 0x21,
-    0x82, 0xFD, 0x41, 0x83, 0xFF, 0x51, 0x21, 0xD1, 0xFC, 0x21, 0xBB, 0xFD, 0x22, 0xD1, 0xD0, 0xF3,
-    0xFD, 0x22, 0x80, 0x81, 0xE4, 0xFB, 0x42, 0xD0, 0xD1, 0xFF, 0xA1, 0xFF, 0xFB, 0x21, 0xB6, 0xF9,
-    0x21, 0xD0, 0xFD, 0x41, 0xBA, 0xE5, 0xB1, 0x21, 0xD0, 0xFC, 0x22, 0x80, 0x8F, 0xF6, 0xFD, 0x41,
-    0x82, 0xF2, 0x56, 0x21, 0xD1, 0xFC, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB9, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD,
-    0x21, 0xBA, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xC7, 0xFF, 0xFD, 0xE4, 0xA9, 0xA0, 0x00, 0x40,
-    0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x80,
-    0xE8, 0xEA, 0x21, 0xD1, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB0, 0xE7, 0x77, 0x21,
-    0xD0, 0xFC, 0x41, 0x84, 0xE4, 0xF0, 0x21, 0xD1, 0xFC, 0x42, 0xBC, 0xBD, 0xFF, 0xFD, 0xE7, 0xE8,
-    0x21, 0xD0, 0xF9, 0x22, 0xB2, 0xBE, 0xEC, 0xFD, 0x42, 0x82, 0x86, 0xE4, 0xDA, 0xE4, 0xDA, 0x42,
-    0xD0, 0xD1, 0xE7, 0xB5, 0xFF, 0xF9, 0x42, 0xB5, 0xB8, 0xFF, 0xF9, 0xE8, 0xB2, 0x21, 0xD0, 0xF9,
-    0x41, 0x96, 0xE4, 0xC2, 0x21, 0xD1, 0xFC, 0x41, 0x83, 0xE4, 0xBB, 0x21, 0xD1, 0xFC, 0x22, 0x81,
-    0x82, 0xF6, 0xFD, 0x21, 0xD1, 0xFB, 0x22, 0x80, 0x83, 0xE7, 0xFD, 0x22, 0xD0, 0xD1, 0xC8, 0xFB,
-    0x41, 0xBA, 0xE4, 0xA2, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB8, 0xE7,
-    0x94, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0x87, 0xE4, 0x88, 0x21, 0xD1,
-    0xFC, 0x42, 0x80, 0x82, 0xE7, 0xB2, 0xFF, 0xFD, 0x21, 0xD1, 0xF9, 0x41, 0xB9, 0xE4, 0x77, 0xA1,
-    0x02, 0x92, 0xD0, 0xFC, 0x21, 0xB5, 0xFB, 0x21, 0xD0, 0xFD, 0x41, 0xB8, 0xE4, 0x68, 0x21, 0xD0,
-    0xFC, 0x21, 0xB7, 0xFD, 0x21, 0xD0, 0xFD, 0x24, 0xB0, 0xB5, 0xBB, 0xBE, 0xD0, 0xE1, 0xF0, 0xFD,
-    0x41, 0xBE, 0xF3, 0x15, 0x21, 0xD0, 0xFC, 0x42, 0x80, 0x83, 0xFF, 0xFD, 0xE7, 0x4A, 0x22, 0xD0,
-    0xD1, 0xE9, 0xF9, 0x45, 0xB1, 0xB3, 0xBA, 0xBB, 0xBF, 0xFF, 0x38, 0xFF, 0x45, 0xFF, 0x98, 0xFF,
-    0xA7, 0xFF, 0xFB, 0x41, 0xB8, 0xE6, 0xAF, 0x41, 0xB1, 0xE4, 0x2B, 0x21, 0xD0, 0xFC, 0x42, 0xB8,
-    0xBE, 0xFF, 0xFD, 0xFF, 0x38, 0x21, 0xD0, 0xF9, 0x21, 0x80, 0xFD, 0x22, 0xD0, 0xD1, 0xE8, 0xFD,
-    0x41, 0x86, 0xE4, 0x12, 0x21, 0xD1, 0xFC, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0x83, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0x82, 0x84, 0xE2, 0xFD, 0x22, 0xD0,
-    0xD1, 0xB5, 0xFB, 0x21, 0x81, 0xFB, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xE3, 0x66, 0x50, 0xBA, 0xBF,
-    0xB4, 0xB6, 0xB7, 0xBB, 0xBC, 0xBD, 0xBE, 0xB0, 0xB1, 0xB2, 0xB5, 0xB8, 0xB3, 0xB9, 0xF0, 0x43,
-    0xF0, 0x43, 0xFB, 0xFE, 0xFC, 0x23, 0xFC, 0x3B, 0xF0, 0x4C, 0xF0, 0x4C, 0xFC, 0x5C, 0xFD, 0x06,
-    0xFD, 0x10, 0xFD, 0x30, 0xFD, 0x7C, 0xFE, 0xB6, 0xFF, 0xF9, 0xE5, 0xED, 0xE5, 0xED, 0x42, 0x82,
-    0x8C, 0xFA, 0x4E, 0xF3, 0x89, 0xC2, 0x00, 0x42, 0xD1, 0x2D, 0xFF, 0xF9, 0xE3, 0x27, 0xA0, 0x00,
-    0x92, 0x21, 0xBA, 0xFD, 0xC1, 0x00, 0x92, 0xD1, 0xF7, 0xEA, 0x23, 0x81, 0x82, 0x86, 0xFA, 0xF4,
-    0xF4, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF, 0xF0, 0xFF, 0xF9, 0xEF, 0xF5, 0xE3, 0x0B, 0x41, 0xBC,
-    0xF0, 0x1B, 0x21, 0xD0, 0xFC, 0x42, 0xB0, 0xBE, 0xF0, 0x1A, 0xFF, 0xFD, 0x42, 0xB6, 0xBA, 0xF0,
-    0x0D, 0xF0, 0x0D, 0x21, 0xD0, 0xF9, 0x41, 0xBF, 0xF0, 0x03, 0x21, 0xD0, 0xFC, 0x41, 0xB0, 0xEF,
-    0xFC, 0x21, 0xD0, 0xFC, 0x42, 0xB1, 0xBC, 0xEF, 0xF5, 0xFF, 0xFD, 0x21, 0xD0, 0xF9, 0x23, 0x83,
-    0x8F, 0x96, 0xE5, 0xEC, 0xFD, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xEF, 0xB1, 0xFF, 0xD0, 0xFF, 0xF9,
-    0xE2, 0xC7, 0xA0, 0x03, 0x23, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD, 0x21, 0xD1,
-    0xFD, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x94, 0xFD, 0x42, 0xB4, 0xBC, 0xF5, 0x59, 0xE3,
-    0x70, 0x42, 0xD1, 0xD0, 0xF5, 0x8B, 0xFF, 0xF9, 0x41, 0xB5, 0xE8, 0x2A, 0x21, 0xD0, 0xFC, 0x21,
-    0xB3, 0xFD, 0xA1, 0x02, 0x91, 0xD0, 0xFD, 0x41, 0xBB, 0xEA, 0x47, 0x21, 0xD0, 0xFC, 0x23, 0xB9,
-    0xBE, 0xB0, 0xE3, 0xF4, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xD2, 0xFF, 0xF9, 0xE2, 0x77, 0x41,
-    0xBC, 0xE5, 0x30, 0x21, 0xD0, 0xFC, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x42,
-    0xD1, 0x2D, 0xFF, 0xFD, 0xE2, 0x5D, 0x50, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C,
-    0x80, 0x96, 0x83, 0x94, 0x97, 0x8E, 0x8F, 0xFF, 0x2F, 0xF4, 0xA1, 0xEF, 0x3A, 0xEF, 0x3A, 0xEF,
-    0x3A, 0xEF, 0x3A, 0xEF, 0x3A, 0xEF, 0x3A, 0xFF, 0x4B, 0xFF, 0x8F, 0xFF, 0xDF, 0xFF, 0xF9, 0xE4,
-    0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFE, 0xC6, 0xFF, 0xCF,
-    0xE7, 0x49, 0xE4, 0xB3, 0x41, 0xD1, 0xFC, 0x4E, 0x21, 0xB0, 0xFC, 0x21, 0xD0, 0xFD, 0x21, 0xBC,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0xC2, 0x00, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xE2, 0x05,
-    0x41, 0xD0, 0xF9, 0xCD, 0x21, 0xB0, 0xFC, 0x43, 0x2E, 0xD0, 0x2D, 0xEE, 0xDF, 0xFF, 0xFD, 0xE1,
-    0xF5, 0x42, 0xD1, 0x2D, 0xEF, 0x05, 0xE1, 0xEB, 0x41, 0x82, 0xF9, 0x65, 0x21, 0xD1, 0xFC, 0x21,
-    0x96, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xE1, 0xDA, 0x41, 0x87, 0xF4, 0xCB, 0x21, 0xD1, 0xFC,
-    0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x42,
-    0xD0, 0x2D, 0xFF, 0xFD, 0xE1, 0xBD, 0x50, 0xBA, 0xBF, 0xB6, 0xB1, 0xB2, 0xB4, 0xBC, 0xBE, 0xB0,
-    0xB3, 0xB5, 0xB7, 0xB8, 0xB9, 0xBB, 0xBD, 0xFF, 0xB1, 0xEE, 0x9A, 0xEE, 0x9A, 0xEE, 0xA3, 0xFF,
-    0xC1, 0xFF, 0xCB, 0xFF, 0xDC, 0xFF, 0xF9, 0xE4, 0x44, 0xE4, 0x44, 0xE4, 0x44, 0xE4, 0x44, 0xE4,
-    0x44, 0xE4, 0x44, 0xE4, 0x44, 0xE4, 0x44, 0x50, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x80,
-    0x94, 0x96, 0x97, 0x83, 0x89, 0x8C, 0x8E, 0x8F, 0xF1, 0xF4, 0xEE, 0x69, 0xEE, 0x69, 0xEE, 0x69,
-    0xEE, 0x69, 0xEE, 0x69, 0xEE, 0x69, 0xFF, 0xAB, 0xE4, 0x13, 0xE4, 0x13, 0xE4, 0x13, 0xE4, 0x13,
-    0xE4, 0x13, 0xE4, 0x13, 0xE4, 0x13, 0xE4, 0x13, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x9E, 0xFF,
-    0xCF, 0xE6, 0x78, 0xE3, 0xE2, 0x41, 0xB7, 0xF2, 0xC6, 0xA1, 0x05, 0xE2, 0xD0, 0xFC, 0x21, 0x8F,
-    0xFB, 0x21, 0xD1, 0xFD, 0x42, 0xB6, 0xBD, 0xEE, 0x55, 0xEE, 0x55, 0x21, 0xD0, 0xF9, 0x42, 0xB4,
-    0xBB, 0xEE, 0x4B, 0xEE, 0x4B, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xF1, 0xC6, 0x43, 0x81, 0x87, 0x89,
-    0xF8, 0xA1, 0xEE, 0x3D, 0xEE, 0x3D, 0x21, 0xD1, 0xF6, 0x41, 0xD1, 0xF6, 0xFA, 0x21, 0x83, 0xFC,
-    0x21, 0xD1, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x24, 0xB0, 0xB5, 0xB8, 0xBE, 0xD2, 0xDC,
-    0xED, 0xFD, 0x41, 0x87, 0xEE, 0x17, 0x42, 0xD0, 0xD1, 0xEE, 0x21, 0xFF, 0xFC, 0x42, 0x83, 0x96,
-    0xFF, 0xF9, 0xF1, 0x8B, 0x45, 0x2E, 0x27, 0xD0, 0xD1, 0x2D, 0xED, 0xD2, 0xFF, 0xAD, 0xFF, 0xE5,
-    0xFF, 0xF9, 0xE0, 0xE8, 0x41, 0xBE, 0xE8, 0xB4, 0x43, 0x2E, 0xD0, 0x2D, 0xED, 0xBE, 0xFF, 0xFC,
-    0xE0, 0xD4, 0x41, 0xB2, 0xEB, 0x78, 0x41, 0xBE, 0xE1, 0xF1, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD,
-    0x22, 0xD0, 0xD1, 0xF2, 0xFD, 0x44, 0xB2, 0xBD, 0xB0, 0xBE, 0xED, 0xCE, 0xED, 0xCE, 0xE1, 0x6A,
-    0xFF, 0xFB, 0x41, 0x81, 0xE3, 0xDE, 0x41, 0xBD, 0xEB, 0x06, 0x22, 0xD1, 0xD0, 0xF8, 0xFC, 0x21,
-    0xB9, 0xFB, 0x21, 0xD0, 0xFD, 0x42, 0x8C, 0x96, 0xED, 0xAE, 0xFF, 0xFD, 0x44, 0x2E, 0xD0, 0xD1,
-    0x2D, 0xED, 0x7A, 0xFF, 0xD9, 0xFF, 0xF9, 0xE0, 0x90, 0x42, 0xD0, 0xD1, 0xF1, 0x2C, 0xF6, 0x6A,
-    0x21, 0x96, 0xF9, 0x44, 0x2E, 0x27, 0xD1, 0x2D, 0xED, 0x63, 0xF2, 0xB5, 0xFF, 0xFD, 0xE0, 0x79,
-    0x42, 0x8C, 0x96, 0xED, 0x83, 0xFD, 0x72, 0x41, 0xB4, 0xE2, 0x61, 0xC2, 0x00, 0xB1, 0xD0, 0xD1,
-    0xFF, 0xFC, 0xEA, 0xCE, 0x45, 0xB2, 0xB9, 0xBA, 0xBB, 0xBD, 0xED, 0x75, 0xFF, 0xF7, 0xED, 0x75,
-    0xED, 0x75, 0xED, 0x75, 0x41, 0xBE, 0xF1, 0x11, 0x21, 0xD0, 0xFC, 0x45, 0x82, 0x85, 0x87, 0x8E,
-    0x94, 0xED, 0x5E, 0xFF, 0xFD, 0xED, 0x5E, 0xED, 0x5E, 0xED, 0x5E, 0x22, 0xD0, 0xD1, 0xD9, 0xF0,
-    0x42, 0xB0, 0xB8, 0xFF, 0xFB, 0xED, 0x4F, 0x44, 0x2E, 0xD1, 0xD0, 0x2D, 0xED, 0x0F, 0xFF, 0xB9,
-    0xFF, 0xF9, 0xE0, 0x25, 0x43, 0x94, 0x8F, 0x8E, 0xEA, 0xB6, 0xEA, 0xB6, 0xEA, 0xB6, 0x21, 0xD1,
-    0xF6, 0x42, 0xD0, 0x27, 0xFD, 0x60, 0xFF, 0xFD, 0x41, 0xB0, 0xEF, 0x6F, 0x21, 0xD0, 0xFC, 0x21,
-    0x87, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0x82, 0xE2, 0xBA, 0x21, 0xD1, 0xFC, 0x41, 0x8F, 0xE0, 0xB8,
-    0x21, 0xD1, 0xFC, 0x42, 0xBD, 0xBC, 0xFF, 0xFD, 0xE0, 0xB1, 0x21, 0xD0, 0xF9, 0x41, 0xD0, 0xE9,
-    0x26, 0x21, 0xB0, 0xFC, 0x21, 0xD0, 0xFD, 0x47, 0xB2, 0xBE, 0xBC, 0xBF, 0xBA, 0xB9, 0xBD, 0xFF,
-    0xCA, 0xF8, 0xE0, 0xEA, 0x7C, 0xFF, 0xDB, 0xFF, 0xE2, 0xFF, 0xF3, 0xFF, 0xFD, 0x41, 0x88, 0xF2,
-    0x76, 0x21, 0xD1, 0xFC, 0x41, 0xBE, 0xF2, 0x6F, 0x21, 0xD0, 0xFC, 0x42, 0xBB, 0xB2, 0xFF, 0xFD,
-    0xE0, 0x79, 0x21, 0xD0, 0xF9, 0x45, 0xB4, 0xB6, 0xB7, 0xBB, 0xBC, 0xE0, 0x6F, 0xE0, 0x6F, 0xE0,
-    0x6F, 0xE0, 0x6F, 0xE0, 0x6F, 0x41, 0x85, 0xE0, 0x5F, 0x22, 0xD0, 0xD1, 0xEC, 0xFC, 0x41, 0xD1,
-    0xF2, 0x48, 0x24, 0x8E, 0x8F, 0x97, 0x83, 0xCF, 0xE0, 0xF7, 0xFC, 0x43, 0xD0, 0xD1, 0x2D, 0xFF,
-    0xAC, 0xFF, 0xF7, 0xDF, 0x81, 0x41, 0xB9, 0xF0, 0xF6, 0x42, 0x8E, 0x94, 0xF0, 0xF2, 0xF0, 0xF2,
-    0x22, 0xD0, 0xD1, 0xF5, 0xF9, 0x21, 0xBE, 0xFB, 0x21, 0xD0, 0xFD, 0x42, 0xD0, 0xD1, 0xE0, 0x88,
-    0xE0, 0x11, 0x22, 0x80, 0x83, 0xF6, 0xF9, 0x41, 0xBD, 0xE0, 0x53, 0x21, 0xD0, 0xFC, 0x21, 0xB0,
-    0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xB3, 0xBB, 0xEA, 0x09, 0xFF, 0xFD, 0x21, 0xD0, 0xF9, 0x21, 0xB0,
-    0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xE1, 0xFF, 0xFD, 0xDF, 0x3B, 0x41, 0xBE, 0xFC, 0x37, 0x42,
-    0xD0, 0x2D, 0xFF, 0xFC, 0xDF, 0x2D, 0x41, 0xD1, 0xE7, 0xB4, 0x21, 0xB8, 0xFC, 0x21, 0xD0, 0xFD,
-    0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBA, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD,
-    0xDF, 0x01, 0x43, 0xB0, 0xB5, 0xB8, 0xDE, 0xE2, 0xDE, 0xE2, 0xDE, 0xE2, 0x42, 0x83, 0x96, 0xDE,
-    0xD8, 0xDE, 0xD8, 0x22, 0xD0, 0xD1, 0xEF, 0xF9, 0xA0, 0x05, 0x41, 0x22, 0xBA, 0xBE, 0xF8, 0xFD,
-    0x42, 0xD0, 0x2D, 0xFF, 0xFB, 0xDE, 0xDC, 0x50, 0xBA, 0xBF, 0xB7, 0xB2, 0xB3, 0xB4, 0xBB, 0xBC,
-    0xBD, 0xB0, 0xB1, 0xB9, 0xB5, 0xBE, 0xB6, 0xB8, 0xF1, 0x20, 0xEB, 0xB9, 0xEB, 0xB9, 0xFD, 0xED,
-    0xFE, 0x01, 0xFE, 0x45, 0xEB, 0xC2, 0xFE, 0x5C, 0xFE, 0xB0, 0xFF, 0x54, 0xFF, 0x9A, 0xFF, 0xA8,
-    0xFF, 0xD4, 0xFF, 0xF9, 0xE1, 0x63, 0xE1, 0x63, 0x41, 0xB5, 0xE6, 0xA7, 0xC2, 0x00, 0x42, 0xD0,
-    0x2D, 0xFF, 0xFC, 0xDE, 0xA0, 0xC1, 0x00, 0x92, 0x2E, 0xEB, 0xAB, 0x42, 0xBA, 0xB1, 0xFF, 0xFA,
-    0xEB, 0xA8, 0x42, 0x81, 0x82, 0xFB, 0x6C, 0xFB, 0x6C, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF, 0xF2,
-    0xFF, 0xF9, 0xEB, 0x6D, 0xDE, 0x83, 0x41, 0x83, 0xFB, 0x7C, 0x21, 0xD1, 0xFC, 0x21, 0xB7, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x43, 0xB2, 0xBB, 0xBD, 0xEB, 0x83, 0xEB, 0x83, 0xEB, 0x83,
-    0x21, 0xD0, 0xF6, 0x42, 0x8E, 0x96, 0xFC, 0x5D, 0xFF, 0xFD, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xEB,
-    0x3C, 0xFF, 0xE9, 0xFF, 0xF9, 0xDE, 0x52, 0x41, 0x27, 0xFE, 0x37, 0x42, 0xB2, 0xBC, 0xFF, 0xFC,
-    0xE8, 0xE8, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xDE, 0x3A, 0x41, 0xBE, 0xF2, 0x02, 0x21, 0xD0, 0xFC,
-    0x21, 0x80, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xFD, 0xF3, 0xAE, 0xDE, 0x29, 0x50, 0x81, 0x82,
-    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x80, 0x96, 0x83, 0x94, 0x97, 0x8E, 0x8F, 0xEE, 0x8E,
-    0xEB, 0x03, 0xEB, 0x03, 0xEB, 0x03, 0xEB, 0x03, 0xFF, 0x7F, 0xEB, 0x03, 0xEB, 0x03, 0xFF, 0x9C,
-    0xFF, 0xCD, 0xFF, 0xE5, 0xFF, 0xF6, 0xE0, 0xAD, 0xE0, 0xAD, 0xE0, 0xAD, 0xE0, 0xAD, 0x41, 0xBE,
-    0xF3, 0xAF, 0x21, 0xD0, 0xFC, 0x21, 0x81, 0xFD, 0xA0, 0x01, 0xC1, 0x21, 0xB2, 0xFD, 0x22, 0xD1,
-    0xD0, 0xF7, 0xFD, 0x41, 0xBD, 0xEF, 0x32, 0x21, 0xD0, 0xFC, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD,
-    0x22, 0x8F, 0x94, 0xEE, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFB, 0xDD, 0xC7, 0x44, 0xD0, 0xD1, 0x27,
-    0xD2, 0xFE, 0xEB, 0xFF, 0xA1, 0xFF, 0xF9, 0xE2, 0xE4, 0x41, 0xB0, 0xEC, 0x67, 0x21, 0xD0, 0xFC,
-    0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0xA0, 0x03, 0xD2, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21,
-    0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB9, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0xBF, 0xB8,
-    0xD6, 0xFD, 0x21, 0xD0, 0xFB, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1,
-    0xFD, 0x42, 0xBE, 0xB0, 0xDE, 0x4D, 0xFF, 0xFD, 0x43, 0x2E, 0xD0, 0x2D, 0xEA, 0x4E, 0xFF, 0xF9,
-    0xDD, 0x64, 0x43, 0x2E, 0xD1, 0x2D, 0xEA, 0x44, 0xEA, 0x74, 0xDD, 0x5A, 0x41, 0x87, 0xDE, 0x18,
-    0x21, 0xD1, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x41,
-    0xB4, 0xEE, 0x42, 0x21, 0xD0, 0xFC, 0x21, 0x97, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x21,
-    0xD0, 0xFD, 0x22, 0x83, 0x80, 0xEA, 0xFD, 0x41, 0xB5, 0xDD, 0xED, 0x21, 0xD0, 0xFC, 0x41, 0x80,
-    0xF5, 0x34, 0x21, 0xD1, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB4, 0xFD, 0x21, 0xD0,
-    0xFD, 0x22, 0x80, 0x83, 0xEA, 0xFD, 0x41, 0xB3, 0xED, 0xD2, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD,
-    0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x22, 0xD1, 0xD0, 0xEB, 0xFD, 0x21, 0x80, 0xFB, 0x21, 0xD1,
-    0xFD, 0xA0, 0x0C, 0x43, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD,
-    0x21, 0xB9, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5,
-    0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x82, 0x86, 0xCA, 0xFD, 0x21, 0xD1, 0xFB, 0x41, 0xB3, 0xDD, 0x86,
-    0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0x83, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0xBD, 0xBC, 0xD2, 0xFD, 0x43, 0xD1, 0xD0, 0x2D,
-    0xFF, 0x56, 0xFF, 0xFB, 0xDC, 0x80, 0x41, 0xBD, 0xEB, 0x24, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21,
-    0x85, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xBB, 0xEA, 0x85, 0x21,
-    0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0xA0, 0x0C, 0x22, 0x21, 0x82, 0xFD, 0x21, 0xD1,
-    0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB9, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x8C, 0xFD, 0x21, 0xD1, 0xFD, 0x21,
-    0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x23, 0xB7, 0xBD, 0xBF, 0xBD,
-    0xCA, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xDC, 0x0A, 0x41, 0x80, 0xDC, 0xCB, 0x21, 0xD1, 0xFC,
-    0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x97, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD,
-    0xDB, 0xE1, 0x50, 0xB1, 0xB3, 0xB4, 0xB7, 0xBA, 0xB2, 0xBB, 0xBE, 0xB0, 0xB8, 0xB5, 0xB6, 0xB9,
-    0xBC, 0xBD, 0xBF, 0xE8, 0xBE, 0xE8, 0xBE, 0xE8, 0xBE, 0xE8, 0xBE, 0xEE, 0x25, 0xFE, 0x76, 0xFE,
-    0x80, 0xFF, 0x5A, 0xFF, 0xD0, 0xFF, 0xF9, 0xDE, 0x68, 0xDE, 0x68, 0xDE, 0x68, 0xDE, 0x68, 0xDE,
-    0x68, 0xDE, 0x68, 0xA0, 0x00, 0x42, 0x21, 0xBF, 0xFD, 0xC1, 0x00, 0x42, 0x2E, 0xE8, 0xB7, 0x21,
-    0xBA, 0xF4, 0x42, 0xD0, 0x2E, 0xFF, 0xFD, 0xE8, 0xAE, 0x22, 0x82, 0x8C, 0xF0, 0xF9, 0x44, 0xD0,
-    0xD1, 0x2E, 0x2D, 0xFF, 0xE8, 0xFF, 0xFB, 0xE8, 0x78, 0xDB, 0x8E, 0x41, 0xBD, 0xF3, 0x33, 0x21,
-    0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x43, 0x2E, 0xD0, 0x2D, 0xE8, 0x61, 0xFF, 0xFD, 0xDB, 0x77, 0x41,
-    0x80, 0xE8, 0x84, 0x43, 0x2E, 0xD1, 0x2D, 0xE8, 0x53, 0xFF, 0xFC, 0xDB, 0x69, 0x50, 0x81, 0x80,
-    0x82, 0x85, 0x88, 0x94, 0x96, 0x97, 0x83, 0x84, 0x86, 0x87, 0x89, 0x8C, 0x8E, 0x8F, 0xFF, 0xD1,
-    0xFF, 0xE8, 0xFF, 0xF6, 0xE8, 0x4C, 0xE8, 0x4C, 0xDD, 0xED, 0xDD, 0xED, 0xDD, 0xED, 0xDD, 0xED,
-    0xDD, 0xED, 0xDD, 0xED, 0xDD, 0xED, 0xDD, 0xED, 0xDD, 0xED, 0xDD, 0xED, 0xDD, 0xED, 0x44, 0xD0,
-    0xD1, 0xD2, 0x27, 0xFF, 0x54, 0xFF, 0xCF, 0xE0, 0x52, 0xDD, 0xBC, 0x41, 0x81, 0xE8, 0x38, 0xC3,
-    0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xE8, 0x07, 0xFF, 0xFC, 0xDB, 0x1D, 0x44, 0x8F, 0x94, 0x8E, 0x8C,
-    0xE8, 0x2E, 0xE8, 0x2E, 0xE8, 0x2E, 0xE8, 0x28, 0xC3, 0x00, 0x42, 0xD1, 0x2E, 0x2D, 0xFF, 0xF3,
-    0xE7, 0xEE, 0xDB, 0x04, 0x50, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xB7, 0xBA, 0xBC, 0xBD, 0xBF, 0xBB,
-    0xB0, 0xB5, 0xB8, 0xB9, 0xBE, 0xED, 0x43, 0xE7, 0xDC, 0xED, 0x43, 0xED, 0x43, 0xE7, 0xDC, 0xE7,
-    0xDC, 0xED, 0x43, 0xFF, 0xDB, 0xED, 0x43, 0xED, 0x43, 0xFF, 0xF4, 0xDD, 0x86, 0xDD, 0x86, 0xDD,
-    0x86, 0xDD, 0x86, 0xDD, 0x86, 0x41, 0x91, 0xE7, 0xAB, 0x41, 0xB2, 0xE7, 0xDA, 0xC2, 0x00, 0x42,
-    0xD0, 0x2D, 0xFF, 0xFC, 0xDA, 0xBF, 0x41, 0x81, 0xEA, 0xFB, 0xC2, 0x00, 0x92, 0x2E, 0xD1, 0xE7,
-    0xC6, 0xFF, 0xFC, 0x4B, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xB7, 0xBA, 0xBC, 0xBD, 0xBF, 0xB9, 0xFC,
-    0x12, 0xFC, 0x12, 0xFC, 0x12, 0xFF, 0xF7, 0xF7, 0x8B, 0xFC, 0x12, 0xFC, 0x12, 0xFC, 0x12, 0xFC,
-    0x12, 0xFC, 0x12, 0xF7, 0x8B, 0x42, 0x2E, 0xD0, 0xEA, 0xC9, 0xEA, 0xDF, 0x42, 0x82, 0x8C, 0xF1,
-    0xA0, 0xFF, 0xF9, 0xC2, 0x00, 0x92, 0x2E, 0xD1, 0xE7, 0x8D, 0xFF, 0xF9, 0xC2, 0x00, 0x92, 0x2E,
-    0xD1, 0xE7, 0x84, 0xEA, 0xBB, 0x49, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0xF7,
-    0x49, 0xFF, 0xEE, 0xFF, 0xF7, 0xFB, 0xD0, 0xFB, 0xD0, 0xFB, 0xD0, 0xFB, 0xD0, 0xFB, 0xD0, 0xFB,
-    0xD0, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF, 0xA2, 0xFF, 0xE4, 0xE7, 0x35, 0xDA, 0x4B, 0x50, 0x80,
-    0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x8C, 0x94, 0x96, 0x97, 0x83, 0x88, 0x89, 0x8E, 0x8F, 0xE7,
-    0x22, 0xEC, 0x89, 0xEC, 0x89, 0xE7, 0x22, 0xFF, 0x7F, 0xE7, 0x22, 0xE7, 0x22, 0xFF, 0xF3, 0xDC,
-    0xCC, 0xDC, 0xCC, 0xDC, 0xCC, 0xDC, 0xCC, 0xDC, 0xCC, 0xDC, 0xCC, 0xDC, 0xCC, 0xDC, 0xCC, 0x44,
-    0xD0, 0xD2, 0xD1, 0x27, 0xFF, 0x15, 0xFF, 0x46, 0xFF, 0xCF, 0xDC, 0x9B, 0x41, 0xD1, 0xEE, 0xD2,
-    0x21, 0xBB, 0xFC, 0xC4, 0x00, 0x42, 0x2E, 0xD0, 0xD1, 0x2D, 0xE6, 0xE3, 0xFF, 0xFD, 0xFE, 0x8C,
-    0xD9, 0xF9, 0x41, 0xB5, 0xEB, 0x69, 0x42, 0x83, 0x96, 0xEB, 0x65, 0xEB, 0x65, 0x22, 0xD0, 0xD1,
-    0xF5, 0xF9, 0x21, 0xBD, 0xFB, 0xC3, 0x00, 0x42, 0x2E, 0xD0, 0x2D, 0xE6, 0xC1, 0xFF, 0xFD, 0xD9,
-    0xD7, 0x41, 0xBE, 0xE4, 0x79, 0xC3, 0x00, 0x42, 0x2E, 0xD0, 0x2D, 0xE6, 0xB1, 0xFF, 0xFC, 0xD9,
-    0xC7, 0x41, 0xB9, 0xED, 0x59, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80,
-    0xFD, 0x21, 0xD1, 0xFD, 0x42, 0xBA, 0xBD, 0xFF, 0xFD, 0xF7, 0xE5, 0x42, 0xD0, 0x2D, 0xFF, 0xF9,
-    0xD9, 0xA1, 0x41, 0x82, 0xF0, 0x79, 0x42, 0xD1, 0x2D, 0xFF, 0xFC, 0xD9, 0x96, 0x41, 0xBD, 0xF9,
-    0xB7, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xD9, 0x8B, 0x50, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xB7, 0xBA,
-    0xBB, 0xBD, 0xBF, 0xBC, 0xBE, 0xB5, 0xB0, 0xB8, 0xB9, 0xFF, 0x8B, 0xE6, 0x68, 0xEB, 0xCF, 0xE6,
-    0x68, 0xEB, 0xCF, 0xE6, 0x68, 0xFF, 0xAD, 0xEB, 0x6E, 0xFF, 0xBD, 0xEB, 0xCF, 0xEB, 0xCF, 0xFF,
-    0xE3, 0xFF, 0xEE, 0xFF, 0xF9, 0xDC, 0x12, 0xDC, 0x12, 0x41, 0x82, 0xE4, 0x8D, 0x21, 0xD1, 0xFC,
-    0x21, 0x96, 0xFD, 0xC3, 0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xE6, 0x33, 0xFF, 0xFD, 0xD9, 0x49, 0x42,
-    0x82, 0x8C, 0xF0, 0x5D, 0xEE, 0x1A, 0xC3, 0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xE6, 0x20, 0xFF, 0xF9,
-    0xD9, 0x36, 0xC2, 0x00, 0x42, 0xD0, 0x2D, 0xDC, 0x61, 0xD9, 0x2A, 0x41, 0xBE, 0xE6, 0xF0, 0x21,
-    0xD0, 0xFC, 0x41, 0x80, 0xE6, 0xE9, 0x21, 0xD1, 0xFC, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x22,
-    0xBA, 0xBD, 0xF0, 0xFD, 0x21, 0xD0, 0xFB, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB1, 0xD9,
-    0xD5, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD,
-    0x21, 0x83, 0xFD, 0x41, 0x96, 0xDA, 0xE5, 0x21, 0xD1, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD,
-    0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xB2, 0xBD, 0xFF, 0xFD, 0xE7, 0x5B, 0x21, 0xD0, 0xF9,
-    0x21, 0xB0, 0xFD, 0x22, 0xD1, 0xD0, 0xDD, 0xFD, 0x43, 0xBD, 0xBE, 0xB6, 0xFF, 0xC2, 0xD8, 0xAC,
-    0xFF, 0xFB, 0x42, 0xD0, 0x2D, 0xFF, 0xF6, 0xD8, 0xBA, 0x50, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86,
-    0x87, 0x88, 0x89, 0x96, 0x94, 0x97, 0x83, 0x8C, 0x8E, 0x8F, 0xFF, 0x6A, 0xFF, 0x7D, 0xEA, 0xFE,
-    0xEA, 0xFE, 0xEA, 0xFE, 0xE5, 0x97, 0xE5, 0x97, 0xEA, 0xFE, 0xFF, 0x89, 0xFF, 0xF9, 0xDB, 0x41,
-    0xDB, 0x41, 0xDB, 0x41, 0xDB, 0x41, 0xDB, 0x41, 0xDB, 0x41, 0x41, 0x88, 0xEE, 0x43, 0x21, 0xD1,
-    0xFC, 0x21, 0xBA, 0xFD, 0x41, 0x82, 0xEE, 0x39, 0x22, 0xD0, 0xD1, 0xF9, 0xFC, 0x21, 0x8F, 0xFB,
-    0xC2, 0x00, 0x72, 0xD1, 0x2D, 0xFF, 0xFD, 0xD8, 0x6C, 0x44, 0xD0, 0xD1, 0x27, 0xD2, 0xFE, 0xDF,
-    0xFF, 0xB0, 0xFF, 0xF7, 0xDD, 0x87, 0x42, 0x2E, 0xD1, 0xE5, 0x6A, 0xED, 0x28, 0x21, 0xBB, 0xF9,
-    0x42, 0x80, 0x81, 0xE5, 0x63, 0xE5, 0x63, 0xC4, 0x00, 0x42, 0x2E, 0xD0, 0xD1, 0x2D, 0xE5, 0x2F,
-    0xFF, 0xF6, 0xFF, 0xF9, 0xD8, 0x45, 0x43, 0xB6, 0xB7, 0xBF, 0xE5, 0x4D, 0xE5, 0x4D, 0xE5, 0x4D,
-    0xC4, 0x00, 0x42, 0x2E, 0xD0, 0xD1, 0x2D, 0xE5, 0x16, 0xFF, 0xF6, 0xFC, 0xBF, 0xD8, 0x2C, 0x42,
-    0x81, 0x82, 0xE5, 0x34, 0xE5, 0x34, 0xC3, 0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xE5, 0x00, 0xFF, 0xF9,
-    0xD8, 0x16, 0xC3, 0x00, 0x42, 0xD1, 0x2E, 0x2D, 0xF0, 0xA5, 0xE4, 0xF4, 0xD8, 0x0A, 0xA0, 0x03,
-    0x52, 0xA1, 0x03, 0x72, 0x27, 0xFD, 0x21, 0xB4, 0xFB, 0x21, 0xD0, 0xFD, 0x41, 0xBC, 0xEA, 0xA7,
-    0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x96, 0x82, 0xF0, 0xFD, 0x21, 0xD1,
-    0xFB, 0xA0, 0x06, 0x22, 0x21, 0x8F, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x27, 0xFD, 0x21, 0xB2, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xBD, 0xEA, 0x7A, 0x21, 0xD0, 0xFC,
-    0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0x97, 0x83, 0xE8, 0xBB, 0xF5, 0xE7, 0x21, 0xD1, 0xF9,
-    0x22, 0xB1, 0xBE, 0xF3, 0xFD, 0x21, 0xD0, 0xFB, 0x41, 0xB6, 0xEA, 0x5B, 0x21, 0xD0, 0xFC, 0x42,
-    0xB8, 0xB0, 0xF8, 0x0F, 0xFF, 0xFD, 0x21, 0xD0, 0xF9, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x41,
-    0xB0, 0xE5, 0xAC, 0x21, 0xD0, 0xFC, 0x41, 0xB5, 0xDD, 0x5C, 0x21, 0xD0, 0xFC, 0x21, 0xB1, 0xFD,
-    0x42, 0xD1, 0xD0, 0xD7, 0x92, 0xFF, 0xFD, 0x21, 0x96, 0xF9, 0x41, 0xB4, 0xDD, 0x59, 0x21, 0xD0,
-    0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xB0, 0xBE, 0xFF, 0xFD, 0xDF, 0x21, 0x22, 0xD1,
-    0xD0, 0xE9, 0xF9, 0x41, 0x8C, 0xD7, 0x72, 0x21, 0xD1, 0xFC, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB0, 0xD7, 0x34, 0x21, 0xD0, 0xFC, 0x41, 0x83, 0xDC,
-    0xD5, 0x21, 0xD1, 0xFC, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xBB, 0xBE, 0xF0, 0xFD, 0x21,
-    0xD0, 0xFB, 0x41, 0x86, 0xD7, 0x12, 0x21, 0xD1, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x45,
-    0xBF, 0xBB, 0xBC, 0xBA, 0xBD, 0xFF, 0x94, 0xFF, 0xBF, 0xFF, 0xD4, 0xFF, 0xF0, 0xFF, 0xFD, 0x41,
-    0x96, 0xD7, 0x26, 0x21, 0xD1, 0xFC, 0x21, 0x84, 0xFD, 0x22, 0xD0, 0xD1, 0xE6, 0xFD, 0x41, 0xB1,
-    0xE9, 0xBF, 0x21, 0xD0, 0xFC, 0x46, 0xB2, 0xBF, 0xB4, 0xB7, 0xBE, 0xB0, 0xFF, 0x19, 0xFF, 0x31,
-    0xFF, 0x50, 0xFF, 0x67, 0xFF, 0xF4, 0xFF, 0xFD, 0x42, 0xD0, 0xD1, 0xF1, 0xFB, 0xE9, 0x9E, 0x41,
-    0x81, 0xF0, 0x37, 0x21, 0xD1, 0xFC, 0x41, 0xBE, 0xF1, 0xF1, 0x21, 0xD0, 0xFC, 0x42, 0x81, 0x80,
-    0xE9, 0xA3, 0xFF, 0xFD, 0x42, 0xD1, 0xD0, 0xFF, 0xF9, 0xF1, 0xDF, 0x44, 0x83, 0x97, 0x8F, 0x8E,
-    0xFF, 0xDD, 0xFF, 0xE8, 0xFF, 0xF9, 0xE9, 0x95, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xBD, 0xFF, 0xF3,
-    0xD6, 0xB4, 0xA0, 0x05, 0x02, 0x41, 0xBE, 0xEB, 0xC8, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x21,
-    0xD1, 0xFD, 0x42, 0x80, 0x82, 0xD7, 0x70, 0xD7, 0x70, 0x21, 0xD1, 0xF9, 0x21, 0xBE, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0x83,
-    0x96, 0xE1, 0xFD, 0xA0, 0x09, 0xC3, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB2, 0xFD, 0x97,
-    0x21, 0xD0, 0xFC, 0x43, 0xB7, 0xB1, 0xB0, 0xFF, 0xF6, 0xFE, 0xB0, 0xFF, 0xFD, 0x23, 0x27, 0xD1,
-    0xD0, 0xB5, 0xE1, 0xF6, 0x42, 0x8F, 0x8E, 0xE0, 0xF6, 0xE0, 0xF6, 0x21, 0xD1, 0xF9, 0x41, 0xB4,
-    0xE9, 0x05, 0x21, 0xD0, 0xFC, 0x21, 0x8F, 0xFD, 0x21, 0xD1, 0xFD, 0x42, 0xB0, 0xB5, 0xE8, 0xF8,
-    0xFE, 0x82, 0x41, 0x8C, 0xE8, 0xF1, 0x21, 0xD1, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21,
-    0x96, 0xFD, 0x22, 0xD0, 0xD1, 0xE9, 0xFD, 0x22, 0x80, 0x87, 0xE1, 0xFB, 0x22, 0x27, 0xD1, 0xCF,
-    0xFB, 0x41, 0xB3, 0xDA, 0x0F, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB1,
-    0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x80, 0xF2, 0x2A, 0x21, 0xD1, 0xFC, 0x21, 0xBF, 0xFD, 0x21, 0xD0,
-    0xFD, 0x41, 0x96, 0xD9, 0xB2, 0x21, 0xD1, 0xFC, 0x21, 0xBA, 0xFD, 0x41, 0x81, 0xE0, 0x3C, 0x22,
-    0xD0, 0xD1, 0xF9, 0xFC, 0x42, 0x80, 0x82, 0xD7, 0xE4, 0xD6, 0xBE, 0x21, 0xD1, 0xF9, 0x21, 0xBE,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD,
-    0x24, 0x83, 0x81, 0x8F, 0x96, 0xC1, 0xCE, 0xDF, 0xFD, 0x41, 0x82, 0xD6, 0x99, 0x21, 0xD1, 0xFC,
-    0x21, 0xBA, 0xFD, 0xA1, 0x02, 0x92, 0xD0, 0xFD, 0x41, 0xD1, 0xE0, 0x21, 0x21, 0xBA, 0xFC, 0x21,
-    0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x84, 0xFD, 0xA1, 0x02, 0x92, 0xD1, 0xFD,
-    0x41, 0xB6, 0xD6, 0x22, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0xA1, 0x09, 0xC3, 0xD0, 0xFD, 0x21,
-    0x80, 0xFB, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x41, 0xB0, 0xE3, 0xF7, 0x21, 0xD0, 0xFC, 0x21,
-    0x80, 0xFD, 0x22, 0xD0, 0xD1, 0xF3, 0xFD, 0x41, 0xB4, 0xFE, 0xFC, 0x21, 0xD0, 0xFC, 0x41, 0xBB,
-    0xFE, 0xF5, 0x21, 0xD0, 0xFC, 0x22, 0xB8, 0xBE, 0xF6, 0xFD, 0x21, 0x8F, 0xF1, 0x21, 0xD1, 0xFD,
-    0x21, 0x80, 0xFD, 0x22, 0xD0, 0xD1, 0xF2, 0xFD, 0x41, 0xBA, 0xFE, 0xDB, 0x21, 0xD0, 0xFC, 0x21,
-    0x83, 0xFD, 0x21, 0xD1, 0xFD, 0x23, 0xB1, 0xB3, 0xBF, 0xCD, 0xEE, 0xFD, 0x41, 0xB9, 0xFE, 0xC7,
-    0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xBD, 0xDF, 0x7E, 0x21, 0xD0, 0xFC,
-    0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0x85, 0x81, 0xEA,
-    0xFD, 0x22, 0xD0, 0xD1, 0xD4, 0xFB, 0x41, 0x81, 0xD8, 0x1C, 0xA1, 0x02, 0xB1, 0xD1, 0xFC, 0x21,
-    0xB0, 0xFB, 0x21, 0xD0, 0xFD, 0x45, 0xB0, 0xB5, 0xBE, 0xBC, 0xBD, 0xFF, 0x4E, 0xFF, 0x66, 0xFF,
-    0xEC, 0xFF, 0xFD, 0xF5, 0x1B, 0x42, 0xD1, 0xD0, 0xFF, 0x2B, 0xFF, 0xF0, 0x41, 0xB7, 0xE7, 0xA7,
-    0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x41,
-    0xB2, 0xE7, 0x94, 0x21, 0xD0, 0xFC, 0x41, 0xB8, 0xDF, 0x60, 0x21, 0xD0, 0xFC, 0x41, 0xBC, 0xE5,
-    0xD4, 0x21, 0xD0, 0xFC, 0x21, 0x83, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0xBB, 0xBE, 0xF0, 0xFD, 0x41,
-    0x80, 0xEC, 0xE5, 0x21, 0xD1, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB2, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96,
-    0xFD, 0x22, 0xD0, 0xD1, 0xD9, 0xFD, 0x48, 0xB4, 0xB2, 0xBC, 0xB9, 0xBE, 0xB1, 0xB7, 0xBF, 0xFE,
-    0x37, 0xFE, 0x76, 0xDF, 0x3D, 0xFF, 0x9F, 0xF8, 0x97, 0xFF, 0xB6, 0xFF, 0xBD, 0xFF, 0xFB, 0x42,
-    0x81, 0x88, 0xD5, 0x45, 0xD5, 0x45, 0x21, 0xD1, 0xF9, 0x45, 0xB2, 0xB6, 0xB7, 0xBB, 0xBC, 0xFF,
-    0xFD, 0xD5, 0x3B, 0xD5, 0x3B, 0xD5, 0x3B, 0xD5, 0x3B, 0x42, 0x81, 0x85, 0xD5, 0x2B, 0xD5, 0x2B,
-    0x22, 0xD0, 0xD1, 0xE9, 0xF9, 0x41, 0xD0, 0xE7, 0x23, 0x43, 0x97, 0x83, 0x8F, 0xFF, 0xF7, 0xF4,
-    0xC5, 0xFF, 0xFC, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xB3, 0xFF, 0xF6, 0xD4, 0x49, 0x41, 0x82, 0xD8,
-    0x33, 0x21, 0xD1, 0xFC, 0x21, 0x83, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD,
-    0x42, 0xBC, 0xBA, 0xDE, 0xD3, 0xFF, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xD4, 0x25, 0x50, 0xB1,
-    0xB2, 0xB3, 0xB4, 0xB6, 0xB7, 0xBA, 0xBB, 0xBC, 0xBF, 0xBD, 0xB5, 0xB0, 0xBE, 0xB8, 0xB9, 0xE1,
-    0x02, 0xE6, 0x69, 0xFB, 0xD9, 0xFB, 0xF2, 0xE6, 0x69, 0xE6, 0x69, 0xFC, 0x08, 0xE1, 0x02, 0xE6,
-    0x69, 0xE1, 0x02, 0xFC, 0x14, 0xFD, 0x6A, 0xFF, 0xD5, 0xFF, 0xF9, 0xD6, 0xAC, 0xD6, 0xAC, 0x41,
-    0xBA, 0xE1, 0x04, 0x41, 0xB9, 0xE4, 0x2E, 0x42, 0x2E, 0xD0, 0xE4, 0x27, 0xFF, 0xFC, 0x21, 0xBA,
-    0xF9, 0x21, 0xD0, 0xFD, 0x42, 0x82, 0x8C, 0xE4, 0x26, 0xFF, 0xFD, 0xC4, 0x00, 0x42, 0x2E, 0xD0,
-    0xD1, 0x2D, 0xE0, 0xBB, 0xFF, 0xE4, 0xFF, 0xF9, 0xD3, 0xD1, 0x41, 0x96, 0xFE, 0xD6, 0x21, 0xD1,
-    0xFC, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD,
-    0x21, 0xD0, 0xFD, 0x42, 0xBA, 0xB0, 0xE0, 0xC0, 0xFF, 0xFD, 0x41, 0x82, 0xEA, 0xC2, 0x21, 0xD1,
-    0xFC, 0x43, 0x80, 0x81, 0x8C, 0xE0, 0xB2, 0xFF, 0xFD, 0xE0, 0xB2, 0xC4, 0x00, 0x42, 0x2E, 0xD0,
-    0xD1, 0x2D, 0xE0, 0x7B, 0xFF, 0xE8, 0xFF, 0xF6, 0xD3, 0x91, 0x47, 0xB1, 0xB3, 0xB7, 0xBA, 0xBB,
-    0xBC, 0xB9, 0xF4, 0xEB, 0xF4, 0xEB, 0xF0, 0x64, 0xF4, 0xEB, 0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x64,
-    0x46, 0x81, 0x82, 0x85, 0x86, 0x87, 0x88, 0xF0, 0x54, 0xF0, 0x4E, 0xF0, 0x4E, 0xF0, 0x4E, 0xF0,
-    0x4E, 0xF0, 0x4E, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF, 0xD7, 0xFF, 0xED, 0xE0, 0x43, 0xD3, 0x59,
-    0x41, 0x82, 0xE6, 0xEA, 0x21, 0xD1, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD,
-    0x21, 0xD1, 0xFD, 0x42, 0x82, 0x8F, 0xFF, 0xFD, 0xEE, 0x54, 0x42, 0xD1, 0x2D, 0xFF, 0xF9, 0xD3,
-    0x32, 0x50, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x96, 0x94, 0x97, 0x83,
-    0x8E, 0x8F, 0xE5, 0x76, 0xFF, 0x5A, 0xFF, 0x9A, 0xE5, 0x76, 0xE5, 0x76, 0xE5, 0x15, 0xE5, 0x76,
-    0xE5, 0x76, 0xE0, 0x0F, 0xFF, 0xD2, 0xFF, 0xF9, 0xD5, 0xB9, 0xD5, 0xB9, 0xD5, 0xB9, 0xD5, 0xB9,
-    0xD5, 0xB9, 0xC1, 0x00, 0x72, 0x2D, 0xD2, 0xFA, 0x44, 0xD0, 0xD1, 0x27, 0xD2, 0xFE, 0xD6, 0xFF,
-    0xC9, 0xFF, 0xFA, 0xD8, 0x18, 0x41, 0x80, 0xE5, 0x9E, 0x21, 0xD1, 0xFC, 0x21, 0xBE, 0xFD, 0x21,
-    0xD0, 0xFD, 0x42, 0xB5, 0xB0, 0xFB, 0x1B, 0xE5, 0x91, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xFC, 0xA6,
-    0x22, 0x82, 0x87, 0xEF, 0xF9, 0x42, 0x27, 0xD1, 0xF2, 0xB9, 0xFF, 0xFB, 0x41, 0x87, 0xE3, 0xC5,
-    0x21, 0xD1, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21,
-    0x83, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xB0, 0xDD, 0x31, 0x21, 0xD0, 0xFC, 0x22, 0xB0, 0xB1, 0xF6,
-    0xFD, 0x21, 0xD0, 0xFB, 0x41, 0x83, 0xE5, 0x4F, 0x21, 0xD1, 0xFC, 0x21, 0xB7, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0xA0, 0x08, 0x42, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0xBB, 0xB5, 0xEE, 0xFD, 0x21, 0xD0, 0xFB, 0x41, 0xB1,
-    0xE5, 0x25, 0x21, 0xD0, 0xFC, 0x42, 0xBE, 0xB0, 0xFF, 0xFD, 0xFD, 0x7B, 0x21, 0xD0, 0xF9, 0x21,
-    0x80, 0xFD, 0x41, 0xB2, 0xF2, 0xA6, 0x22, 0xD1, 0xD0, 0xF9, 0xFC, 0x41, 0x8C, 0xDC, 0xD5, 0x21,
-    0xD1, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBD,
-    0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xBD, 0xE1, 0xC3, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0x82, 0x86,
-    0xFF, 0xFD, 0xE0, 0xEB, 0x41, 0x96, 0xE9, 0x63, 0x21, 0xD1, 0xFC, 0x21, 0xBB, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xBE, 0xB0,
-    0xD2, 0xD5, 0xFF, 0xFD, 0x22, 0xD1, 0xD0, 0xD9, 0xF9, 0x21, 0x96, 0xFB, 0x21, 0xD1, 0xFD, 0x48,
-    0xBE, 0xB2, 0xBC, 0xB7, 0xB1, 0xB4, 0xB6, 0xBB, 0xEA, 0xF8, 0xFF, 0x26, 0xDC, 0x94, 0xFF, 0x52,
-    0xFF, 0x7C, 0xFF, 0x97, 0xFF, 0xB2, 0xFF, 0xFD, 0x42, 0xB5, 0xB8, 0xD2, 0x9C, 0xD2, 0x9C, 0x41,
-    0x83, 0xD2, 0x95, 0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0x21, 0xBD, 0xFB, 0x21, 0xD0, 0xFD, 0xC1, 0x02,
-    0xB1, 0xD0, 0xE4, 0x8E, 0x21, 0x81, 0xFA, 0x42, 0xD0, 0xD1, 0xE4, 0x81, 0xFF, 0xFD, 0x41, 0xB4,
-    0xD2, 0x76, 0x21, 0xD0, 0xFC, 0x42, 0xB4, 0xB7, 0xD2, 0x6F, 0xFF, 0xFD, 0x21, 0xD0, 0xF9, 0x41,
-    0xBD, 0xE8, 0x2E, 0x21, 0xD0, 0xFC, 0x42, 0x8F, 0x96, 0xFF, 0xFD, 0xE1, 0x33, 0x21, 0xD1, 0xF9,
-    0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x96, 0xE8, 0x11,
-    0xA1, 0x03, 0x02, 0xD1, 0xFC, 0x21, 0x86, 0xFB, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0,
-    0xFD, 0x41, 0x81, 0xDB, 0x7E, 0x21, 0xD1, 0xFC, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96,
-    0xFD, 0x21, 0xD1, 0xFD, 0x41, 0x80, 0xE4, 0x50, 0x21, 0xD1, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x24, 0x80, 0x81,
-    0x84, 0x96, 0xBC, 0xD1, 0xE4, 0xFD, 0x41, 0x83, 0xE7, 0xC7, 0xA1, 0x03, 0x02, 0xD1, 0xFC, 0x41,
-    0xB0, 0xE0, 0xCA, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x82, 0xFD, 0x21,
-    0xD1, 0xFD, 0x22, 0xBC, 0xBD, 0xE8, 0xFD, 0x21, 0xD0, 0xFB, 0x41, 0xBF, 0xDB, 0x25, 0x21, 0xD0,
-    0xFC, 0x22, 0xBE, 0xB0, 0xF6, 0xFD, 0x21, 0xD0, 0xFB, 0x41, 0x80, 0xE0, 0xA0, 0x21, 0xD1, 0xFC,
-    0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB7, 0xE0, 0x8D,
-    0x21, 0xD0, 0xFC, 0x21, 0x83, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0xBF, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0xA0, 0x08, 0x32, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD,
-    0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x86, 0xDA, 0xC3,
-    0x21, 0xD1, 0xFC, 0x22, 0xB8, 0xBE, 0xF6, 0xFD, 0x21, 0xD0, 0xFB, 0x21, 0x80, 0xFD, 0x21, 0xD1,
-    0xFD, 0x41, 0xB0, 0xDD, 0xD8, 0x21, 0xD0, 0xFC, 0x41, 0x96, 0xE3, 0x8C, 0x21, 0xD1, 0xFC, 0x21,
-    0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB2, 0xFD, 0x21, 0xD0,
-    0xFD, 0x46, 0xBA, 0xB4, 0xBC, 0xBF, 0xBD, 0xB0, 0xFF, 0x75, 0xFF, 0x88, 0xFF, 0xB3, 0xFF, 0xDD,
-    0xFF, 0xE4, 0xFF, 0xFD, 0x42, 0xD1, 0xD0, 0xFF, 0x29, 0xFF, 0xED, 0x21, 0x82, 0xF9, 0x21, 0xD1,
-    0xFD, 0x41, 0xB5, 0xDD, 0x98, 0x21, 0xD0, 0xFC, 0x41, 0xBB, 0xDA, 0x67, 0x21, 0xD0, 0xFC, 0x21,
-    0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x80, 0x84, 0xF0, 0xFD, 0x42, 0xD0, 0xD1, 0xE3, 0xB7, 0xFF,
-    0xFB, 0x21, 0x82, 0xF9, 0x21, 0xD1, 0xFD, 0x41, 0x82, 0xDF, 0xD2, 0x21, 0xD1, 0xFC, 0x21, 0x81,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB9, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x47, 0x83, 0x87, 0x8F,
-    0x97, 0x81, 0x80, 0x88, 0xF2, 0xD0, 0xFE, 0x4F, 0xFE, 0x5B, 0xFE, 0x70, 0xFF, 0xB2, 0xFF, 0xD8,
-    0xFF, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFE, 0x0D, 0xFF, 0xEA, 0xCF, 0xFA, 0x41, 0xB2, 0xE3, 0xD7,
-    0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x41,
-    0x8F, 0xE0, 0xE2, 0x21, 0xD1, 0xFC, 0x43, 0xB4, 0xBD, 0xBC, 0xE2, 0xCE, 0xFF, 0xFD, 0xE0, 0xDB,
-    0x42, 0xD0, 0xD1, 0xFF, 0xF6, 0xE2, 0xCA, 0x41, 0xB9, 0xE0, 0xCA, 0x21, 0xD0, 0xFC, 0x21, 0x96,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0xA0, 0x0A, 0x32, 0x21, 0xB4, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xB0, 0xE7, 0xB9, 0x21, 0xD0, 0xFC,
-    0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB1, 0xBF, 0xF0, 0xFD, 0x41, 0xBD, 0xE7, 0xA7, 0x21,
-    0xD0, 0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x22, 0xD0, 0xD1, 0xDF, 0xFD, 0x42, 0xBE, 0xB0, 0xFF,
-    0xFB, 0xFA, 0xC3, 0x21, 0xB2, 0xB7, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xBE, 0xF2, 0x3D, 0x21, 0xD0, 0xFC, 0x21, 0x82, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x43, 0x81, 0x83, 0x96, 0xE9, 0x27, 0xFF, 0xEA,
-    0xFF, 0xFD, 0x22, 0xD0, 0xD1, 0xCA, 0xF6, 0x41, 0xBC, 0xE2, 0x2D, 0x21, 0xD0, 0xFC, 0x21, 0xBE,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x47, 0xBE, 0xBC, 0xBF, 0xB9, 0xB3,
-    0xB4, 0xB2, 0xE3, 0x24, 0xF7, 0x50, 0xFF, 0x42, 0xFF, 0x56, 0xFF, 0x6D, 0xFF, 0xE8, 0xFF, 0xFD,
-    0x44, 0xB4, 0xB6, 0xB7, 0xBB, 0xE0, 0x11, 0xE0, 0x11, 0xE0, 0x11, 0xE0, 0x11, 0x42, 0x81, 0x85,
-    0xE0, 0x04, 0xE0, 0x04, 0x22, 0xD0, 0xD1, 0xEC, 0xF9, 0x42, 0x97, 0x83, 0xFF, 0xFB, 0xED, 0x24,
-    0x22, 0xD0, 0xD1, 0xCA, 0xF9, 0x21, 0xB5, 0xFB, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x41, 0xB8,
-    0xD0, 0xDA, 0x21, 0xD0, 0xFC, 0x21, 0x87, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x83, 0xFD, 0x21, 0xD1,
-    0xFD, 0x21, 0xB4, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xE7, 0xFF, 0xFD, 0xCE, 0xC8, 0x41, 0x8C,
-    0xD2, 0xB2, 0x21, 0xD1, 0xFC, 0x21, 0x86, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xB5, 0xF8, 0xF1, 0x21, 0xD0, 0xFC, 0x21, 0x82,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0xBE, 0xB5, 0xEA, 0xFD, 0x21,
-    0xD0, 0xFB, 0x42, 0xBB, 0xBD, 0xE5, 0x69, 0xFF, 0xFD, 0x21, 0xB5, 0xEE, 0x21, 0xD0, 0xFD, 0x21,
-    0x80, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF0, 0xFF, 0xFD, 0xCE, 0x7A, 0x50, 0xB1, 0xB4, 0xB7,
-    0xBF, 0xBB, 0xBE, 0xB5, 0xB0, 0xB2, 0xB3, 0xB6, 0xB8, 0xB9, 0xBA, 0xBC, 0xBD, 0xDB, 0x54, 0xE0,
-    0xBB, 0xDB, 0x54, 0xDB, 0x54, 0xDB, 0x5D, 0xFE, 0x76, 0xFF, 0xA8, 0xFF, 0xF6, 0xD0, 0xFE, 0xD0,
-    0xFE, 0xD0, 0xFE, 0xD0, 0xFE, 0xD0, 0xFE, 0xD0, 0xFE, 0xD0, 0xFE, 0xD0, 0xFE, 0x41, 0xBE, 0xE0,
-    0x97, 0x21, 0xD0, 0xFC, 0x42, 0xB2, 0xBD, 0xCE, 0xE5, 0xCE, 0xE5, 0x21, 0xD0, 0xF9, 0x43, 0xBF,
-    0xBA, 0xBE, 0xF2, 0x85, 0xFF, 0xF3, 0xFF, 0xFD, 0xC1, 0x00, 0x42, 0xD0, 0xDE, 0x6C, 0x43, 0x82,
-    0x8C, 0x83, 0xFF, 0xFA, 0xF2, 0x84, 0xCF, 0x49, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF, 0xE6, 0xFF,
-    0xF6, 0xDA, 0xFE, 0xCE, 0x14, 0xA0, 0x03, 0x94, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB2, 0xFD, 0x42, 0xD0, 0xD1, 0xFF, 0xFD, 0xFC, 0x8A, 0x41, 0xD0,
-    0xED, 0x89, 0x21, 0xB0, 0xFC, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB8,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0x81, 0xDB, 0xD2, 0x21, 0xD1,
-    0xFC, 0x44, 0x84, 0x97, 0x81, 0x8F, 0xFF, 0xD6, 0xCE, 0xA1, 0xFF, 0xF6, 0xFF, 0xFD, 0xA0, 0x0A,
-    0xB2, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBA, 0xFD,
-    0x21, 0xD0, 0xFD, 0x41, 0xBC, 0xCF, 0xA5, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB9, 0xD7, 0xA9, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xBB, 0xFA, 0x41, 0x21, 0xD0, 0xFC,
-    0x45, 0xB5, 0xB1, 0xBC, 0xBF, 0xB9, 0xFF, 0xD0, 0xFF, 0xE3, 0xFF, 0xF6, 0xFF, 0xFD, 0xD8, 0x54,
-    0xC2, 0x00, 0xB2, 0xD1, 0xD0, 0xFF, 0xA1, 0xFF, 0xF0, 0xA0, 0x0A, 0x12, 0x21, 0x81, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0xB9, 0xFD, 0xA1, 0x00, 0xB2, 0xD0, 0xFD, 0x42, 0x97, 0x83, 0xCE, 0x28, 0xF6,
-    0xB5, 0x41, 0x80, 0xCE, 0x21, 0x21, 0xD1, 0xFC, 0x42, 0xB4, 0xBC, 0xCF, 0x40, 0xCE, 0x1A, 0x42,
-    0xD1, 0xD0, 0xD7, 0xAA, 0xFF, 0xF9, 0x41, 0xBF, 0xCD, 0xFE, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0x86, 0xFD, 0x21, 0xD1, 0xFD, 0x45, 0xB2, 0xBC, 0xBE, 0xB9, 0xBD, 0xE2,
-    0x51, 0xE2, 0x51, 0xFF, 0xDC, 0xFF, 0xE6, 0xFF, 0xFD, 0xA2, 0x00, 0xB2, 0xD1, 0xD0, 0xC1, 0xF0,
-    0x43, 0xBE, 0xB5, 0xB8, 0xFF, 0xA0, 0xFF, 0xB5, 0xFF, 0xF9, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xD9,
-    0xEC, 0xFF, 0xF6, 0xCE, 0x9C, 0xCD, 0x02, 0xA0, 0x05, 0x43, 0x21, 0x80, 0xFD, 0x41, 0xB8, 0xDA,
-    0xD3, 0x21, 0xD0, 0xFC, 0x21, 0xB4, 0xFD, 0x22, 0xD1, 0xD0, 0xF3, 0xFD, 0x42, 0xBE, 0xB2, 0xFF,
-    0xFB, 0xE2, 0x0E, 0x41, 0xBD, 0xFD, 0x00, 0x21, 0xD0, 0xFC, 0x42, 0xBC, 0xB9, 0xF5, 0x00, 0xFF,
-    0xFD, 0x21, 0xD0, 0xF9, 0x42, 0x96, 0x83, 0xFF, 0xFD, 0xCE, 0xCA, 0x22, 0xD0, 0xD1, 0xE1, 0xF9,
-    0xA0, 0x0A, 0x53, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x82, 0xFD, 0xA1, 0x02, 0xC1, 0xD1,
-    0xFD, 0x21, 0x81, 0xFB, 0x41, 0x96, 0xD7, 0x2C, 0x21, 0xD1, 0xFC, 0x41, 0xBB, 0xCE, 0x9D, 0x21,
-    0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xBD, 0xB2, 0xF0, 0xFD, 0x22, 0xD1, 0xD0,
-    0xE4, 0xFB, 0x41, 0xBD, 0xFA, 0x3D, 0x21, 0xD0, 0xFC, 0x41, 0xD0, 0xF6, 0xC7, 0x23, 0xBE, 0xB5,
-    0xB0, 0xF0, 0xF9, 0xFC, 0x41, 0x80, 0xCE, 0x74, 0x21, 0xD1, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xBE, 0xFE,
-    0x71, 0x21, 0xD0, 0xFC, 0x21, 0xB3, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x96, 0x83, 0xF0, 0xFD, 0x22,
-    0xD0, 0xD1, 0xCE, 0xFB, 0x41, 0xBC, 0xCD, 0x10, 0x21, 0xD0, 0xFC, 0x43, 0xB4, 0xB2, 0xB9, 0xFF,
-    0x80, 0xFF, 0xF4, 0xFF, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xF6, 0xCC, 0x37, 0x50, 0x81, 0x80, 0x82,
-    0x84, 0x86, 0x96, 0x94, 0x97, 0x83, 0x85, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0xFE, 0x1C, 0xFF,
-    0x2E, 0xF0, 0xC7, 0xD9, 0x1D, 0xD9, 0x1D, 0xFF, 0xF9, 0xCE, 0xBE, 0xCE, 0xBE, 0xCE, 0xBE, 0xCE,
-    0xBE, 0xCE, 0xBE, 0xCE, 0xBE, 0xCE, 0xBE, 0xCE, 0xBE, 0xCE, 0xBE, 0xCE, 0xBE, 0x44, 0xD0, 0xD1,
-    0xD2, 0x27, 0xFD, 0x8F, 0xFF, 0xCF, 0xD1, 0x23, 0xCE, 0x8D, 0x41, 0xBB, 0xD9, 0x09, 0xC3, 0x00,
-    0x42, 0x2E, 0xD0, 0x2D, 0xD8, 0xD8, 0xFF, 0xFC, 0xCB, 0xEE, 0x42, 0x2E, 0xD1, 0xCC, 0x8F, 0xF2,
-    0x8F, 0x43, 0x81, 0x83, 0x96, 0xD8, 0xF2, 0xFF, 0xF9, 0xF2, 0x8C, 0x41, 0xBD, 0xCF, 0x05, 0x21,
-    0xD0, 0xFC, 0x41, 0x89, 0xCC, 0x77, 0x21, 0xD1, 0xFC, 0x41, 0x80, 0xCE, 0xF7, 0x21, 0xD1, 0xFC,
-    0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x44, 0xB0, 0xB5, 0xB8,
-    0xBE, 0xCC, 0x5D, 0xFF, 0xE3, 0xFF, 0xEA, 0xFF, 0xFD, 0xC4, 0x00, 0x42, 0x2E, 0xD1, 0xD0, 0x2D,
-    0xD8, 0x8D, 0xFF, 0xC8, 0xFF, 0xF3, 0xCB, 0xA3, 0x41, 0x81, 0xD1, 0x23, 0xC2, 0x00, 0xE2, 0xD1,
-    0x2D, 0xFF, 0xFC, 0xCB, 0x90, 0x41, 0xB5, 0xEB, 0x94, 0x21, 0xD0, 0xFC, 0x21, 0x82, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xCB, 0x77, 0x50, 0xB1, 0xB2, 0xB3,
-    0xB4, 0xB6, 0xB7, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xB9, 0xBE, 0xB5, 0xB0, 0xB8, 0xDD, 0xBB, 0xDD,
-    0xBB, 0xDD, 0xBB, 0xDD, 0xBB, 0xD8, 0x54, 0xDD, 0xBB, 0xFF, 0x82, 0xDD, 0x5A, 0xFF, 0xCD, 0xF0,
-    0x53, 0xDD, 0xBB, 0xD8, 0x54, 0xFF, 0xE0, 0xFF, 0xF9, 0xCD, 0xFE, 0xCD, 0xFE, 0x42, 0x82, 0x8C,
-    0xDB, 0x8D, 0xE0, 0x1C, 0xC3, 0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xD8, 0x22, 0xFF, 0xF9, 0xCB, 0x38,
-    0x42, 0xBB, 0xBE, 0xDC, 0xAB, 0xCC, 0x57, 0xC3, 0x00, 0x42, 0x2E, 0xD0, 0x2D, 0xD8, 0x0F, 0xFF,
-    0xF9, 0xCB, 0x25, 0x41, 0xB3, 0xCD, 0xDC, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0xB1, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xCB, 0x09, 0x50, 0x80, 0x81, 0x82, 0x84, 0x85,
-    0x86, 0x87, 0x88, 0x89, 0x83, 0x94, 0x96, 0x97, 0x8C, 0x8E, 0x8F, 0xDD, 0x4D, 0xFF, 0xCA, 0xEF,
-    0xE5, 0xDD, 0x4D, 0xDD, 0x4D, 0xDD, 0x4D, 0xDD, 0x4D, 0xFF, 0xDD, 0xD7, 0xE6, 0xFF, 0xF9, 0xCD,
-    0x90, 0xCD, 0x90, 0xCD, 0x90, 0xCD, 0x90, 0xCD, 0x90, 0xCD, 0x90, 0x44, 0xD0, 0xD1, 0xD2, 0x27,
-    0xFF, 0x61, 0xFF, 0xCF, 0xCF, 0xF5, 0xCD, 0x5F, 0x50, 0xB0, 0xB5, 0xB8, 0xBE, 0xB1, 0xB2, 0xB3,
-    0xB4, 0xB6, 0xB7, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xB9, 0xCF, 0xEC, 0xD3, 0x12, 0xD3, 0xD4, 0xD7,
-    0x99, 0xDC, 0x36, 0xE0, 0x9A, 0xE3, 0x52, 0xE8, 0x9F, 0xE9, 0x70, 0xED, 0x04, 0xEF, 0x96, 0xF0,
-    0xB7, 0xF2, 0x61, 0xF7, 0xD0, 0xFE, 0xC5, 0xFF, 0xF3, 0x41, 0x82, 0xCA, 0xA6, 0xC2, 0x00, 0x61,
-    0xD1, 0x2D, 0xFF, 0xFC, 0xCA, 0x8F, 0xC1, 0x00, 0xC1, 0xD0, 0xE8, 0xC0, 0x41, 0xD1, 0xD4, 0x32,
-    0x22, 0xBD, 0xBA, 0xF6, 0xFC, 0xC2, 0x00, 0x61, 0xD0, 0x2D, 0xFF, 0xFB, 0xCA, 0x77, 0xC2, 0x00,
-    0xD1, 0xD1, 0x2D, 0xD2, 0xFC, 0xCA, 0x6E, 0xA0, 0x06, 0x42, 0x21, 0x8E, 0xFD, 0x21, 0xD1, 0xFD,
-    0x21, 0x27, 0xFD, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x42, 0xD1, 0xD0, 0xFF,
-    0xFD, 0xEA, 0xFB, 0x21, 0xB5, 0xF9, 0x21, 0xD0, 0xFD, 0x41, 0xBD, 0xD7, 0xBC, 0x21, 0xD0, 0xFC,
-    0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB3, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0xA1,
-    0x00, 0xB2, 0xD0, 0xFD, 0x21, 0xBC, 0xFB, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD,
-    0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x96, 0xCB, 0x2E, 0x21, 0xD1, 0xFC, 0x21, 0x86, 0xFD,
-    0x21, 0xD1, 0xFD, 0x23, 0x82, 0x84, 0x96, 0xC3, 0xF0, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xF9, 0xCA,
-    0x02, 0x41, 0xBE, 0xD1, 0xFE, 0x21, 0xD0, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE,
-    0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xC9, 0xEB, 0x41, 0x81, 0xD0, 0x5A, 0x21, 0xD1, 0xFC, 0x21,
-    0x8E, 0xFD, 0x41, 0xBB, 0xE3, 0x0D, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xE7, 0xFF, 0xFD,
-    0xC9, 0xC4, 0x41, 0x96, 0xCB, 0x96, 0x21, 0xD1, 0xFC, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0xBE, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xC9, 0xAA, 0x50, 0xB0, 0xB5, 0xB8, 0xBE, 0xB9, 0xBD,
-    0xB7, 0xBB, 0xBC, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xBA, 0xBF, 0xC9, 0xA6, 0xFF, 0x14, 0xCC, 0xCD,
-    0xFF, 0x2C, 0xFF, 0x35, 0xFF, 0xA1, 0xFF, 0xB8, 0xFF, 0xDF, 0xFF, 0xF9, 0xCC, 0x31, 0xCC, 0x31,
-    0xCC, 0x31, 0xCC, 0x31, 0xCC, 0x31, 0xCC, 0x31, 0xCC, 0x31, 0x41, 0x83, 0xCA, 0x9D, 0x21, 0xD1,
-    0xFC, 0x21, 0xBD, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xC9, 0x68, 0x42, 0xD1, 0x2D, 0xCC, 0x39,
-    0xC9, 0x61, 0x50, 0x83, 0x8E, 0x8F, 0x94, 0x97, 0x81, 0x96, 0x80, 0x82, 0x84, 0x85, 0x86, 0x87,
-    0x88, 0x89, 0x8C, 0xCC, 0x84, 0xCC, 0x84, 0xCC, 0x84, 0xCC, 0x84, 0xCC, 0x84, 0xFF, 0xF2, 0xFF,
-    0xF9, 0xCB, 0xE8, 0xCB, 0xE8, 0xCB, 0xE8, 0xCB, 0xE8, 0xCB, 0xE8, 0xCB, 0xE8, 0xCB, 0xE8, 0xCB,
-    0xE8, 0xCB, 0xE8, 0xC4, 0x00, 0x42, 0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x86, 0xFF, 0xCF, 0xCE, 0x4D,
-    0xCB, 0xB7, 0x42, 0xB3, 0xB6, 0xC9, 0xC7, 0xC9, 0xC7, 0x21, 0xD0, 0xF9, 0x21, 0xB0, 0xFD, 0x43,
-    0x27, 0xD0, 0x2D, 0xDB, 0x49, 0xFF, 0xFD, 0xC9, 0x0D, 0x41, 0x96, 0xCA, 0x5E, 0x44, 0x27, 0xD0,
-    0xD1, 0x2D, 0xDB, 0x3B, 0xC9, 0xB5, 0xFF, 0xFC, 0xC8, 0xFF, 0x41, 0xB0, 0xDB, 0x4A, 0x21, 0xD0,
-    0xFC, 0x21, 0x80, 0xFD, 0x41, 0xB5, 0xD0, 0xC4, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1,
-    0xFD, 0x21, 0xB5, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xED, 0xFF, 0xFD, 0xC8, 0xD8, 0x41, 0xB0,
-    0xC9, 0xF9, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xC8, 0xCA, 0x41, 0xD0, 0xE7, 0xEB, 0x21, 0xB3, 0xFC,
-    0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xC8, 0xBC, 0x41, 0xBF, 0xCA, 0x10, 0x21, 0xD0, 0xFC, 0x21, 0xBC,
-    0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xBB, 0xBE, 0xD0, 0x8A, 0xFF, 0xFD, 0x41, 0xBF, 0xCB, 0xD5, 0x21,
-    0xD0, 0xFC, 0xA0, 0x09, 0x73, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB1, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD,
-    0x21, 0xD0, 0xFD, 0x22, 0x83, 0x96, 0xDC, 0xFD, 0x42, 0xB2, 0xB3, 0xF2, 0xC0, 0xFC, 0x00, 0x21,
-    0xD0, 0xF9, 0x41, 0xBA, 0xD6, 0x09, 0x21, 0xD0, 0xFC, 0x22, 0xB0, 0xB5, 0xF6, 0xFD, 0xA2, 0x06,
-    0xA2, 0xD1, 0xD0, 0xE5, 0xFB, 0x21, 0x80, 0xF9, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xAC, 0xFF, 0xFD,
-    0xC8, 0x54, 0x41, 0xBB, 0xCB, 0x84, 0x21, 0xD0, 0xFC, 0x21, 0xB1, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0x8E, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xC8, 0x3A, 0x50, 0xB0, 0xB5, 0xBE, 0xB9, 0xB2, 0xBC,
-    0xBF, 0xB3, 0xB7, 0xBA, 0xBB, 0xB1, 0xB4, 0xB6, 0xB8, 0xBD, 0xCB, 0x5D, 0xCB, 0x5D, 0xCB, 0x5D,
-    0xCE, 0x5F, 0xFF, 0x26, 0xFF, 0x34, 0xFF, 0x5B, 0xFF, 0x69, 0xFF, 0x77, 0xFF, 0xDF, 0xFF, 0xF9,
-    0xD0, 0xDA, 0xCA, 0xC1, 0xCA, 0xC1, 0xCA, 0xC1, 0xCA, 0xC1, 0x41, 0xB2, 0xE1, 0x1A, 0xC2, 0x00,
-    0x61, 0xD0, 0x2D, 0xFF, 0xFC, 0xC7, 0xFE, 0xC2, 0x00, 0x61, 0xD0, 0x2D, 0xCD, 0xA1, 0xC7, 0xF5,
-    0x41, 0x81, 0xC8, 0x9F, 0x21, 0xD1, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x87, 0xFD,
-    0x21, 0xD1, 0xFD, 0x43, 0xB0, 0xB1, 0xBE, 0xDC, 0x97, 0xD9, 0xAB, 0xFF, 0xFD, 0xC1, 0x00, 0xB2,
-    0xD0, 0xE7, 0x09, 0x21, 0xB4, 0xFA, 0x21, 0xD0, 0xFD, 0x21, 0x8F, 0xFD, 0x43, 0xD0, 0xD1, 0x2D,
-    0xFF, 0xE7, 0xFF, 0xFD, 0xC7, 0xC0, 0x41, 0x88, 0xC8, 0x63, 0x21, 0xD1, 0xFC, 0x21, 0x96, 0xFD,
-    0x21, 0xD1, 0xFD, 0x21, 0xBF, 0xFD, 0x41, 0xBD, 0xE6, 0xE4, 0x21, 0xD0, 0xFC, 0x22, 0xB0, 0xBF,
-    0xFD, 0xF3, 0x21, 0xD0, 0xFB, 0x41, 0xB8, 0xC8, 0x44, 0x21, 0xD0, 0xFC, 0x21, 0x82, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x82,
-    0x83, 0xE4, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD0, 0xFF, 0xFB, 0xC7, 0x79, 0x41, 0xB2, 0xC9,
-    0x51, 0x41, 0xB1, 0xCA, 0x9F, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80,
-    0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xFD, 0xC7, 0x5B, 0x50, 0x96, 0x83, 0x8E, 0x8F,
-    0x94, 0x97, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0xFF, 0x53, 0xCA, 0x7B,
-    0xCA, 0x7B, 0xFF, 0x5C, 0xCA, 0x7B, 0xCA, 0x7B, 0xFF, 0x91, 0xFF, 0xD8, 0xFF, 0xF6, 0xC9, 0xDF,
-    0xC9, 0xDF, 0xC9, 0xDF, 0xC9, 0xDF, 0xC9, 0xDF, 0xC9, 0xDF, 0xC9, 0xDF, 0xC4, 0x00, 0x42, 0xD0,
-    0xD1, 0xD2, 0x27, 0xFE, 0xED, 0xFF, 0xCF, 0xCC, 0x44, 0xC9, 0xAE, 0x50, 0xB0, 0xB5, 0xBE, 0xB9,
-    0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xCA, 0x3B, 0xCA, 0x3B,
-    0xCA, 0x3B, 0xCD, 0x3D, 0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F,
-    0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F, 0x50, 0x96, 0x83, 0x8E,
-    0x8F, 0x94, 0x97, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0xCA, 0x0A, 0xCA,
-    0x0A, 0xCA, 0x0A, 0xCA, 0x0A, 0xCA, 0x0A, 0xCA, 0x0A, 0xC9, 0x6E, 0xC9, 0x6E, 0xC9, 0x6E, 0xC9,
-    0x6E, 0xC9, 0x6E, 0xC9, 0x6E, 0xC9, 0x6E, 0xC9, 0x6E, 0xC9, 0x6E, 0xC9, 0x6E, 0xC4, 0x00, 0x42,
-    0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x9E, 0xFF, 0xCF, 0xCB, 0xD3, 0xC9, 0x3D, 0xC2, 0x00, 0x61, 0xD0,
-    0x2D, 0xCC, 0x1D, 0xC6, 0xA0, 0x41, 0xB5, 0xFA, 0xD8, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xC6, 0x93,
-    0x41, 0xBA, 0xC7, 0x39, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xC6,
-    0x82, 0x41, 0x96, 0xC7, 0x79, 0x42, 0xD1, 0x2D, 0xFF, 0xFC, 0xC6, 0x77, 0x50, 0xB0, 0xB5, 0xBE,
-    0xB9, 0xB4, 0xB7, 0xBA, 0xB1, 0xB2, 0xB3, 0xB6, 0xB8, 0xBB, 0xBC, 0xBD, 0xBF, 0xCE, 0xD1, 0xFF,
-    0xD0, 0xC9, 0x9A, 0xCC, 0x9C, 0xFF, 0xDD, 0xFF, 0xEE, 0xFF, 0xF9, 0xC8, 0xFE, 0xC8, 0xFE, 0xC8,
-    0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0x41, 0x83, 0xC7,
-    0x3D, 0x42, 0xD1, 0x2D, 0xFF, 0xFC, 0xC6, 0x3B, 0x41, 0xD0, 0xFD, 0x66, 0x21, 0x80, 0xFC, 0x21,
-    0xD1, 0xFD, 0x42, 0xBA, 0xBE, 0xFF, 0xFD, 0xC7, 0x0C, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xC6, 0x23,
-    0x50, 0x83, 0x8E, 0x8F, 0x94, 0x97, 0x80, 0x81, 0x96, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-    0x8C, 0xC9, 0x46, 0xC9, 0x46, 0xC9, 0x46, 0xC9, 0x46, 0xC9, 0x46, 0xFF, 0xE1, 0xFF, 0xF9, 0xFC,
-    0xBB, 0xC8, 0xAA, 0xC8, 0xAA, 0xC8, 0xAA, 0xC8, 0xAA, 0xC8, 0xAA, 0xC8, 0xAA, 0xC8, 0xAA, 0xC8,
-    0xAA, 0xC4, 0x00, 0x42, 0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x7B, 0xFF, 0xCF, 0xCB, 0x0F, 0xC8, 0x79,
-    0x41, 0xB5, 0xDA, 0x7F, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xC5, 0xD8, 0x50, 0x83, 0x8E, 0x94, 0x97,
-    0x80, 0x96, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8F, 0xC8, 0xFB, 0xC8, 0xFB,
-    0xC8, 0xFB, 0xC8, 0xFB, 0xFF, 0xF9, 0xC8, 0x5F, 0xC8, 0x5F, 0xC8, 0x5F, 0xC8, 0x5F, 0xC8, 0x5F,
-    0xC8, 0x5F, 0xC8, 0x5F, 0xC8, 0x5F, 0xC8, 0x5F, 0xC8, 0x5F, 0xC8, 0x5F, 0xA0, 0x06, 0xC3, 0x42,
-    0xBD, 0xB8, 0xFF, 0xFD, 0xC8, 0xD1, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xC5, 0x96, 0x41, 0xBF, 0xDF,
-    0xD0, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0xA1, 0x00, 0xB2, 0xD0, 0xFD, 0x21, 0xBA, 0xFB, 0x21,
-    0xD0, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xE9, 0x21, 0xBA,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x96, 0xFD, 0x43, 0xD0, 0xD1,
-    0x2D, 0xFF, 0xEB, 0xFF, 0xFD, 0xC5, 0x5F, 0x41, 0xBE, 0xC9, 0xC1, 0x21, 0xD0, 0xFC, 0x21, 0x82,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x42, 0xD1, 0x2D,
-    0xFF, 0xFD, 0xC5, 0x3F, 0x41, 0x80, 0xDC, 0xEA, 0x21, 0xD1, 0xFC, 0x21, 0xB5, 0xFD, 0x42, 0xD0,
-    0x2D, 0xFF, 0xFD, 0xC5, 0x2E, 0x50, 0xB9, 0xB4, 0xBF, 0xB2, 0xB3, 0xB0, 0xB1, 0xB5, 0xB6, 0xB7,
-    0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xCB, 0x53, 0xFF, 0x91, 0xFF, 0xC8, 0xFF, 0xE8, 0xFF, 0xF9,
-    0xC7, 0xB5, 0xC7, 0xB5, 0xC7, 0xB5, 0xC7, 0xB5, 0xC7, 0xB5, 0xC7, 0xB5, 0xC7, 0xB5, 0xC7, 0xB5,
-    0xC7, 0xB5, 0xC7, 0xB5, 0xC7, 0xB5, 0xC4, 0x00, 0x42, 0xD1, 0xD0, 0xD2, 0x27, 0xFF, 0x25, 0xFF,
-    0xCF, 0xCA, 0x1A, 0xC7, 0x84, 0x41, 0xB4, 0xCF, 0x95, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xC4, 0xE3,
-    0x42, 0xD0, 0x2D, 0xCC, 0xB4, 0xC4, 0xDC, 0x50, 0xB5, 0xBE, 0xB9, 0xB6, 0xB7, 0xB0, 0xB1, 0xB2,
-    0xB3, 0xB4, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xC7, 0xFF, 0xC7, 0xFF, 0xCB, 0x01, 0xFF, 0xF2,
-    0xFF, 0xF9, 0xC7, 0x63, 0xC7, 0x63, 0xC7, 0x63, 0xC7, 0x63, 0xC7, 0x63, 0xC7, 0x63, 0xC7, 0x63,
-    0xC7, 0x63, 0xC7, 0x63, 0xC7, 0x63, 0xC7, 0x63, 0x42, 0xD1, 0x2D, 0xC5, 0x54, 0xC4, 0xA4, 0x41,
-    0xB0, 0xE5, 0x3C, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xC4, 0x99, 0x50, 0x8E, 0x81, 0x85, 0x94, 0x96,
-    0x97, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8F, 0xC7, 0xBC, 0xFF, 0xEE, 0xFF,
-    0xF9, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7,
-    0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC4, 0x00, 0x42, 0xD0, 0xD1,
-    0xD2, 0x27, 0xFF, 0x8C, 0xFF, 0xCF, 0xC9, 0x85, 0xC6, 0xEF, 0x42, 0xD0, 0xD1, 0xC5, 0x79, 0xFC,
-    0xC2, 0x21, 0xB0, 0xF9, 0xC4, 0x00, 0x42, 0x2E, 0xD0, 0xD1, 0x2D, 0xD1, 0x32, 0xFF, 0xFD, 0xEA,
-    0xFC, 0xC4, 0x48, 0x42, 0xB2, 0xB6, 0xD1, 0x50, 0xD1, 0x50, 0xC4, 0x00, 0x42, 0x2E, 0xD0, 0xD1,
-    0x2D, 0xD1, 0x1C, 0xFF, 0xF9, 0xD1, 0x4C, 0xC4, 0x32, 0x41, 0xBD, 0xD1, 0x3A, 0xC4, 0x00, 0x42,
-    0x2E, 0xD0, 0xD1, 0x2D, 0xD1, 0x09, 0xFF, 0xFC, 0xD1, 0x39, 0xC4, 0x1F, 0x41, 0xB7, 0xD4, 0x55,
-    0x42, 0x2E, 0xD0, 0xD1, 0x20, 0xFF, 0xFC, 0x21, 0x8C, 0xF9, 0xC3, 0x00, 0x42, 0x2E, 0xD1, 0x2D,
-    0xD0, 0xEC, 0xFF, 0xFD, 0xC4, 0x02, 0xC3, 0x00, 0x42, 0x2E, 0xD0, 0x2D, 0xD0, 0xE0, 0xC4, 0xDB,
-    0xC3, 0xF6, 0x41, 0x82, 0xD4, 0x2F, 0x42, 0x2E, 0xD1, 0xD0, 0xFA, 0xFF, 0xFC, 0x42, 0x81, 0x8C,
-    0xFF, 0xF9, 0xD0, 0xF6, 0xC3, 0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xD0, 0xC2, 0xFF, 0xF9, 0xC3, 0xD8,
-    0x41, 0xBC, 0xCE, 0x50, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB2, 0xEA,
-    0xA2, 0x41, 0xBB, 0xD7, 0x59, 0x21, 0xD0, 0xFC, 0x21, 0x96, 0xFD, 0x22, 0xD0, 0xD1, 0xF2, 0xFD,
-    0x41, 0xBD, 0xE9, 0xFB, 0x21, 0xD0, 0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD,
-    0x21, 0xD1, 0xFD, 0xA0, 0x07, 0x31, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBD, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0xBD, 0xF1, 0x22, 0xD0, 0xD1, 0xFD, 0xF1, 0x41, 0x80, 0xD7, 0x20, 0x21, 0xD1,
-    0xFC, 0x23, 0xB0, 0xB8, 0xB5, 0xEE, 0xF4, 0xFD, 0x21, 0xD0, 0xF9, 0x21, 0xBE, 0xF3, 0x41, 0x80,
-    0xFE, 0x1D, 0x22, 0xD0, 0xD1, 0xF9, 0xFC, 0x41, 0xB2, 0xC3, 0xEB, 0x21, 0xD0, 0xFC, 0x21, 0xB8,
-    0xFD, 0x21, 0xD0, 0xFD, 0xA0, 0x0B, 0xA3, 0x21, 0xBC, 0xFD, 0x41, 0x85, 0xCD, 0xD6, 0xC3, 0x02,
-    0xC1, 0x2E, 0xD0, 0xD1, 0xCD, 0xD2, 0xFF, 0xF9, 0xFF, 0xFC, 0xC1, 0x04, 0xC2, 0x2E, 0xF6, 0x4D,
-    0x41, 0x88, 0xC4, 0x12, 0xA1, 0x02, 0xC1, 0xD1, 0xFC, 0x45, 0xB0, 0xB8, 0xBE, 0xB5, 0xBD, 0xFF,
-    0xE5, 0xFF, 0xF1, 0xCD, 0xB7, 0xFF, 0xFB, 0xC4, 0x09, 0x44, 0x83, 0x8F, 0x8E, 0x96, 0xCD, 0xA7,
-    0xCD, 0xA7, 0xCD, 0xA7, 0xCD, 0xA7, 0x22, 0xD0, 0xD1, 0xE3, 0xF3, 0x21, 0x80, 0xFB, 0x21, 0xD1,
-    0xFD, 0x47, 0xB9, 0xB4, 0xBC, 0xB2, 0xB3, 0xBB, 0xBE, 0xFF, 0x49, 0xFF, 0x5A, 0xFF, 0x6F, 0xFF,
-    0x97, 0xFF, 0xA1, 0xFF, 0xB0, 0xFF, 0xFD, 0x41, 0x87, 0xD0, 0xDF, 0x42, 0xBC, 0xB3, 0xCD, 0x75,
-    0xF6, 0x96, 0x22, 0xD1, 0xD0, 0xF5, 0xF9, 0x41, 0xBC, 0xD0, 0xCF, 0x21, 0xD0, 0xFC, 0x41, 0xBF,
-    0xD6, 0x7C, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x23, 0x83, 0x96, 0x87, 0xE7,
-    0xF0, 0xFD, 0xA0, 0x0A, 0xD2, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB4, 0xFD, 0x21, 0xD0,
-    0xFD, 0xA0, 0x02, 0x01, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x81, 0x80, 0xFD, 0xF7, 0x21,
-    0xD1, 0xFB, 0x22, 0x94, 0x8F, 0xEC, 0xFD, 0x21, 0xD1, 0xFB, 0x43, 0xD0, 0xD1, 0x27, 0xFF, 0x97,
-    0xFF, 0xD1, 0xFF, 0xFD, 0x21, 0xB7, 0xF6, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xC2, 0x95, 0x41, 0xBE,
-    0xC4, 0x8A, 0x21, 0xD0, 0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB2, 0xFD, 0x21, 0xD0,
-    0xFD, 0x42, 0xB4, 0xB9, 0xD8, 0xF0, 0xFF, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xC2, 0x74, 0x41,
-    0xB0, 0xEE, 0xC1, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xC2, 0x69, 0x50, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6,
-    0xB7, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xB9, 0xBE, 0xB0, 0xB5, 0xB8, 0xD4, 0xAD, 0xFE, 0x1A, 0xD4,
-    0xAD, 0xFE, 0x30, 0xD4, 0xAD, 0xFE, 0x43, 0xEA, 0x4C, 0xFE, 0x60, 0xFE, 0x6C, 0xFE, 0x8A, 0xD4,
-    0xAD, 0xCF, 0x46, 0xFF, 0xCD, 0xFF, 0xEE, 0xFF, 0xF9, 0xC4, 0xF0, 0x43, 0x2E, 0xD0, 0xD1, 0xCF,
-    0x45, 0xD2, 0x79, 0xD7, 0x03, 0x43, 0x80, 0x82, 0x8C, 0xCF, 0x3E, 0xFF, 0xF6, 0xD7, 0x04, 0xC3,
-    0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xCF, 0x07, 0xFF, 0xF6, 0xC2, 0x1D, 0xC4, 0x00, 0x42, 0x2E, 0xD0,
-    0xD1, 0x2D, 0xCE, 0xFB, 0xE7, 0x4E, 0xD3, 0xB2, 0xC2, 0x11, 0x41, 0x81, 0xE8, 0x02, 0xC3, 0x00,
-    0x42, 0x2E, 0xD1, 0x2D, 0xCE, 0xE8, 0xFF, 0xFC, 0xC1, 0xFE, 0x41, 0x86, 0xDE, 0xD4, 0x44, 0xD0,
-    0xD1, 0x2E, 0x2D, 0xDE, 0xD3, 0xFF, 0xFC, 0xCE, 0xD8, 0xC1, 0xEE, 0x41, 0x81, 0xD5, 0xCE, 0x21,
-    0xD1, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBA, 0xFD, 0x42, 0xD0, 0x2D,
-    0xFF, 0xFD, 0xC1, 0xBF, 0x50, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x80, 0x83,
-    0x94, 0x96, 0x97, 0x8E, 0x8F, 0xFF, 0x9B, 0xFF, 0xA7, 0xD4, 0x03, 0xD4, 0x03, 0xD3, 0xA2, 0xD4,
-    0x03, 0xD4, 0x03, 0xFF, 0xBA, 0xFF, 0xCA, 0xD4, 0x03, 0xFF, 0xF9, 0xC4, 0x46, 0xC4, 0x46, 0xC4,
-    0x46, 0xC4, 0x46, 0xC4, 0x46, 0x44, 0xD0, 0xD2, 0xD1, 0x27, 0xFF, 0x25, 0xE6, 0xC0, 0xFF, 0xCF,
-    0xEE, 0x8D, 0x41, 0xBF, 0xCE, 0x91, 0x41, 0xBF, 0xD1, 0xBB, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD,
-    0xC3, 0x00, 0x42, 0xD0, 0xD1, 0x2D, 0xFF, 0xF2, 0xFF, 0xFD, 0xC1, 0x6C, 0x41, 0x80, 0xCB, 0x73,
-    0x21, 0xD1, 0xFC, 0x21, 0x83, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xBE, 0xD4, 0xCC, 0x21, 0xD0, 0xFC,
-    0x44, 0xB2, 0xBA, 0xBC, 0xBF, 0xF3, 0x51, 0xFF, 0xF6, 0xFF, 0xFD, 0xE5, 0x4D, 0x42, 0xD0, 0xD1,
-    0xFF, 0xF3, 0xEF, 0xD4, 0x42, 0x86, 0x80, 0xFF, 0xF9, 0xC3, 0x46, 0x42, 0xD1, 0xD0, 0xFF, 0xF9,
-    0xC5, 0xE5, 0x42, 0xD0, 0xD1, 0xD3, 0x7E, 0xD6, 0x24, 0x21, 0xB0, 0xF9, 0x21, 0xD0, 0xFD, 0x41,
-    0x96, 0xC8, 0xF9, 0x21, 0xD1, 0xFC, 0x42, 0xB2, 0xB6, 0xFF, 0xFD, 0xC2, 0x47, 0x41, 0xB5, 0xC2,
-    0xEB, 0x21, 0xD0, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xB8, 0xD5, 0x25, 0x21, 0xD0,
-    0xFC, 0x41, 0xBB, 0xCF, 0xA9, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xBC,
-    0xCF, 0x9C, 0x21, 0xD0, 0xFC, 0x41, 0xB1, 0xCF, 0x95, 0x21, 0xD0, 0xFC, 0x21, 0x83, 0xFD, 0x21,
-    0xD1, 0xFD, 0x22, 0xBE, 0xBB, 0xF0, 0xFD, 0x21, 0xD0, 0xFB, 0x41, 0xB9, 0xCF, 0x80, 0x21, 0xD0,
-    0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x24, 0xB2, 0xB7, 0xBA, 0xBC, 0xC7, 0xD4, 0xF0, 0xFD,
-    0xA0, 0x0B, 0x23, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0x81, 0xFD, 0x22, 0xD0, 0xD1, 0xE5, 0xFD, 0x21, 0x82, 0xFB, 0x21, 0xD1, 0xFD, 0x42, 0x81, 0x80,
-    0xFF, 0x9A, 0xFF, 0xFD, 0x42, 0xD0, 0xD1, 0xFF, 0x82, 0xFF, 0xF9, 0x47, 0xBA, 0xBF, 0xB5, 0xBB,
-    0xB0, 0xB8, 0xBE, 0xE4, 0xE8, 0xE4, 0xE8, 0xFF, 0x60, 0xFF, 0x71, 0xC8, 0x6D, 0xC3, 0xC5, 0xFF,
-    0xF9, 0x41, 0xB4, 0xE2, 0xD5, 0x21, 0xD0, 0xFC, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB2,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB2, 0xFD, 0x42, 0x82, 0x88, 0xCB, 0x9F, 0xC1, 0x12, 0xA2, 0x00,
-    0xB2, 0xD0, 0xD1, 0xF6, 0xF9, 0x41, 0x82, 0xD1, 0xD6, 0x21, 0xD1, 0xFC, 0x42, 0x82, 0x8F, 0xD2,
-    0xD0, 0xFF, 0xFD, 0x21, 0xD1, 0xF9, 0xC1, 0x06, 0x93, 0xD0, 0xCA, 0xF0, 0x21, 0xBE, 0xFA, 0x21,
-    0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x43, 0xB0, 0xB8, 0xBE, 0xD2, 0x8C, 0xFF, 0xEB,
-    0xFF, 0xFD, 0x21, 0xD0, 0xF6, 0x46, 0x81, 0x82, 0x85, 0x87, 0x96, 0x80, 0xE4, 0x7E, 0xE4, 0x7E,
-    0xE4, 0x7E, 0xE4, 0x7E, 0xFF, 0xC9, 0xFF, 0xFD, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF, 0x83, 0xFF,
-    0xED, 0xCC, 0xFE, 0xC0, 0x14, 0x44, 0xB0, 0xB5, 0xB8, 0xBE, 0xD2, 0x01, 0xD1, 0x86, 0xFF, 0xB4,
-    0xD1, 0x86, 0x21, 0xD0, 0xF3, 0x42, 0xBA, 0xBF, 0xC0, 0xA4, 0xC0, 0xA4, 0x41, 0xBE, 0xC2, 0x51,
-    0xA1, 0x00, 0xB2, 0xD0, 0xFC, 0x42, 0x80, 0x87, 0xFF, 0xFB, 0xC0, 0x94, 0x22, 0xD0, 0xD1, 0xE9,
-    0xF9, 0x43, 0xBB, 0xB8, 0xBE, 0xFF, 0xE1, 0xC7, 0xB7, 0xFF, 0xFB, 0x41, 0xBF, 0xFF, 0x7E, 0x21,
-    0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xBB, 0xBF, 0xCA, 0xFE, 0xC1, 0x1F, 0x21,
-    0xD0, 0xF9, 0x22, 0x80, 0x96, 0xF3, 0xFD, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xCC, 0x9F, 0xFF, 0xDA,
-    0xFF, 0xFB, 0xBF, 0xB5, 0xA0, 0x0A, 0xF3, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBA, 0xFD,
-    0x21, 0xD0, 0xFD, 0x41, 0x83, 0xDD, 0xCA, 0x21, 0xD1, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD,
-    0x22, 0xBD, 0xBC, 0xF0, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFB, 0xBF, 0x87, 0x41, 0xB4, 0xCE, 0x16,
-    0x21, 0xD0, 0xFC, 0x21, 0x97, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0x86, 0xFD, 0x21, 0xD1, 0xFD, 0x42, 0x97, 0x80, 0xED, 0xBD, 0xFF, 0xFD, 0x42, 0xD1, 0x2D, 0xFF,
-    0xF9, 0xBF, 0x60, 0x41, 0x82, 0xD2, 0x2D, 0x21, 0xD1, 0xFC, 0x42, 0x80, 0x86, 0xFF, 0xFD, 0xD5,
-    0xC7, 0x42, 0xD1, 0x2D, 0xFF, 0xF9, 0xBF, 0x4B, 0x41, 0x81, 0xC0, 0x0C, 0x21, 0xD1, 0xFC, 0x21,
-    0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x96, 0xED, 0x8D, 0x21, 0xD1, 0xFC, 0x22, 0x87, 0x80, 0xF6,
-    0xFD, 0x21, 0xB8, 0xEB, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0xBA, 0xFD, 0x22, 0xD1, 0xD0, 0xE6, 0xFD, 0x21, 0x94, 0xFB, 0x21, 0xD1,
-    0xFD, 0x21, 0xBE, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xBF, 0x08, 0x50, 0xB1, 0xB3, 0xB4, 0xBF,
-    0xBA, 0xBB, 0xBC, 0xBD, 0xB0, 0xB5, 0xBE, 0xB2, 0xB6, 0xB7, 0xB8, 0xB9, 0xCB, 0xE5, 0xCB, 0xE5,
-    0xFD, 0x95, 0xFE, 0xED, 0xFF, 0x4C, 0xE1, 0xA7, 0xCB, 0xEE, 0xCB, 0xEE, 0xFF, 0x7A, 0xFF, 0xA1,
-    0xFF, 0xB6, 0xFF, 0xF9, 0xC1, 0x8F, 0xC1, 0x8F, 0xC1, 0x8F, 0xC1, 0x8F, 0x41, 0x83, 0xC6, 0x8C,
-    0x21, 0xD1, 0xFC, 0x42, 0xBA, 0xB2, 0xDB, 0xAB, 0xFF, 0xFD, 0x43, 0xD0, 0xD1, 0x2E, 0xFF, 0xF9,
-    0xE0, 0x38, 0xCB, 0xD6, 0x44, 0xB1, 0xB4, 0xBA, 0xBC, 0xE0, 0x21, 0xDB, 0x9A, 0xFF, 0xF6, 0xCB,
-    0xCF, 0x43, 0xD0, 0x2E, 0x2D, 0xFF, 0xF3, 0xCB, 0x95, 0xBE, 0xAB, 0x41, 0xD0, 0xE3, 0x04, 0x21,
-    0x8C, 0xFC, 0xC3, 0x00, 0x42, 0xD1, 0x2E, 0x2D, 0xFF, 0xFD, 0xCB, 0x84, 0xBE, 0x9A, 0x41, 0x80,
-    0xD0, 0x0D, 0x21, 0xD1, 0xFC, 0x21, 0xBE, 0xFD, 0x42, 0x2E, 0xD0, 0xCB, 0x98, 0xFF, 0xFD, 0x41,
-    0xD1, 0xF5, 0x7A, 0x47, 0xB1, 0xB2, 0xB4, 0xB7, 0xB9, 0xBB, 0xBD, 0xFF, 0xFC, 0xBF, 0x26, 0xBF,
-    0x26, 0xBF, 0x26, 0xC1, 0xAD, 0xBF, 0x26, 0xBF, 0x26, 0xC1, 0x00, 0xB2, 0xD0, 0xC9, 0x20, 0xA0,
-    0x05, 0x21, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBF, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x83,
-    0xFD, 0xA1, 0x00, 0xB2, 0xD1, 0xFD, 0x44, 0x80, 0x82, 0x87, 0x94, 0xFF, 0xE3, 0xFF, 0xFB, 0xBE,
-    0xF3, 0xBE, 0xF3, 0x22, 0xD0, 0xD1, 0xC0, 0xF3, 0x41, 0x96, 0xC4, 0x6A, 0x42, 0xD0, 0xD1, 0xC8,
-    0xE1, 0xFF, 0xFC, 0x21, 0x80, 0xF9, 0x42, 0xD0, 0xD1, 0xC6, 0x25, 0xFF, 0xFD, 0x41, 0x83, 0xBE,
-    0xCC, 0x21, 0xD1, 0xFC, 0x42, 0x81, 0x82, 0xBF, 0x73, 0xFF, 0xFD, 0x42, 0xD0, 0xD1, 0xF4, 0xF7,
-    0xFF, 0xF9, 0x42, 0xB2, 0xB9, 0xCA, 0x66, 0xBE, 0xB7, 0x41, 0x96, 0xC1, 0x37, 0x42, 0xD0, 0xD1,
-    0xC8, 0xC9, 0xFF, 0xFC, 0x42, 0xD0, 0xD1, 0xC9, 0x4F, 0xFF, 0xD9, 0x44, 0x80, 0x81, 0x8E, 0x8F,
-    0xFF, 0xF2, 0xFF, 0xF9, 0xBE, 0x9E, 0xC1, 0x25, 0x22, 0xD0, 0xD1, 0xDA, 0xF3, 0x49, 0xBA, 0xBF,
-    0xB2, 0xB9, 0xBC, 0xB0, 0xB5, 0xB8, 0xBE, 0xE2, 0x36, 0xE2, 0x36, 0xFF, 0x5B, 0xCA, 0xF6, 0xCA,
-    0xF6, 0xFF, 0xA6, 0xFF, 0xB9, 0xFF, 0xCE, 0xFF, 0xFB, 0x41, 0x8C, 0xE2, 0x1A, 0xA1, 0x00, 0x42,
-    0xD1, 0xFC, 0x42, 0x82, 0x86, 0xCF, 0x39, 0xCF, 0x39, 0x21, 0xD1, 0xF9, 0x21, 0xBA, 0xFD, 0x21,
-    0xD0, 0xFD, 0x42, 0xB9, 0xBB, 0xCF, 0x29, 0xCF, 0x29, 0x41, 0x87, 0xCF, 0x22, 0x22, 0xD0, 0xD1,
-    0xF5, 0xFC, 0x43, 0x8C, 0x83, 0x96, 0xCD, 0xDF, 0xFF, 0xED, 0xFF, 0xFB, 0x41, 0xB6, 0xCF, 0x8A,
-    0x41, 0x85, 0xCF, 0x0B, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x42, 0xB1, 0xB6, 0xCF, 0x02, 0xCF, 0x02,
-    0x21, 0xD0, 0xF9, 0x43, 0xB9, 0xBA, 0xBC, 0xCE, 0xF8, 0xCE, 0xF8, 0xCE, 0xF8, 0x46, 0x84, 0x87,
-    0x8E, 0x8F, 0x94, 0x97, 0xCE, 0xEE, 0xCE, 0xEE, 0xCE, 0xEE, 0xCE, 0xEE, 0xCE, 0xEE, 0xCE, 0xEE,
-    0x22, 0xD0, 0xD1, 0xE3, 0xED, 0x23, 0xB0, 0xB8, 0xBE, 0xCF, 0xDB, 0xFB, 0x43, 0x2E, 0xD1, 0xD0,
-    0xCA, 0x64, 0xFF, 0xB6, 0xFF, 0xF9, 0x43, 0xB1, 0xB9, 0xBB, 0xBD, 0xF3, 0xBD, 0xF3, 0xC8, 0x80,
-    0x42, 0xD0, 0xD1, 0xFF, 0xF6, 0xBF, 0x14, 0x49, 0x81, 0x82, 0x84, 0x86, 0x80, 0x8C, 0x83, 0x8F,
-    0x96, 0xFF, 0x76, 0xE1, 0x8C, 0xE1, 0x8C, 0xE1, 0x8C, 0xFF, 0xE5, 0xCA, 0x4C, 0xC5, 0x38, 0xC3,
-    0x6B, 0xFF, 0xF9, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF, 0x3A, 0xFF, 0xE4, 0xCA, 0x03, 0xBD, 0x19,
-    0x41, 0x82, 0xE1, 0x63, 0x42, 0xD1, 0x2D, 0xFF, 0xFC, 0xBD, 0x08, 0x41, 0xB7, 0xD5, 0x17, 0x21,
-    0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB1,
-    0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB5, 0xD5, 0x0A, 0x21, 0xD0, 0xFC, 0x21, 0x84, 0xFD, 0x21, 0xD1,
-    0xFD, 0x43, 0xBE, 0xB0, 0xB5, 0xFF, 0xF0, 0xE8, 0x2E, 0xFF, 0xFD, 0x21, 0xD0, 0xF6, 0x21, 0x80,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xBC, 0xBF, 0xC7, 0x69, 0xFF,
-    0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xBC, 0xBB, 0x42, 0xD0, 0x2D, 0xFB, 0xA5, 0xBC, 0xB4, 0x42,
-    0xB8, 0xBE, 0xBE, 0x08, 0xBD, 0xD8, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF9, 0xFB, 0x89, 0xBC, 0xA6,
-    0x50, 0x8C, 0x81, 0x82, 0x88, 0x86, 0x83, 0x84, 0x85, 0x94, 0x96, 0x97, 0x80, 0x87, 0x89, 0x8E,
-    0x8F, 0xFD, 0xF1, 0xFE, 0x02, 0xFF, 0x83, 0xFF, 0x94, 0xDA, 0xB1, 0xFF, 0xE1, 0xFF, 0xE8, 0xFF,
-    0xF6, 0xBF, 0x2A, 0xBF, 0x2A, 0xBF, 0x2A, 0xBF, 0x2A, 0xBF, 0x2A, 0xBF, 0x2A, 0xBF, 0x2A, 0xBF,
-    0x2A, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFD, 0x6A, 0xFF, 0xCF, 0xC1, 0x8F, 0xBE, 0xF9, 0x41, 0x82,
-    0xC9, 0x75, 0xC2, 0x00, 0x42, 0xD1, 0x2D, 0xFF, 0xFC, 0xBC, 0x5A, 0x43, 0x2E, 0xD1, 0x2D, 0xC9,
-    0x3B, 0xFF, 0xF3, 0xBC, 0x51, 0xA0, 0x03, 0xF4, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x85, 0xFD, 0x41, 0xBB, 0xE5,
-    0x26, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xB4, 0xBB, 0xFF, 0xFD, 0xC3,
-    0xE4, 0x41, 0x84, 0xBC, 0x03, 0x21, 0xD1, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x81,
-    0xFD, 0x22, 0xD0, 0xD1, 0xE9, 0xFD, 0x21, 0xBE, 0xFB, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xD1, 0xFF,
-    0xFD, 0xBC, 0x03, 0x41, 0xB5, 0xCE, 0x79, 0x21, 0xD0, 0xFC, 0x42, 0xBD, 0xB0, 0xFF, 0xFD, 0xBF,
-    0x26, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xBB, 0xEB, 0x41, 0xB5, 0xC5, 0xFD, 0x21, 0xD0, 0xFC, 0x21,
-    0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBF, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB3, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0x80, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xBB, 0xC8, 0x50, 0xB1, 0xB3, 0xB4, 0xB6,
-    0xB7, 0xB2, 0xBB, 0xBC, 0xB5, 0xBA, 0xBE, 0xB0, 0xB8, 0xB9, 0xBD, 0xBF, 0xC8, 0xA5, 0xC8, 0xA5,
-    0xC8, 0xA5, 0xC8, 0xA5, 0xFF, 0x67, 0xFF, 0x70, 0xDE, 0x67, 0xE0, 0x58, 0xFF, 0xBE, 0xFF, 0xD6,
-    0xFF, 0xF9, 0xBE, 0x4F, 0xBE, 0x4F, 0xBE, 0x4F, 0xBE, 0x4F, 0xBE, 0x4F, 0x41, 0xB0, 0xFD, 0x06,
-    0x41, 0x96, 0xCD, 0x0B, 0x21, 0xD1, 0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x8F, 0xFD,
-    0x22, 0xD0, 0xD1, 0xEC, 0xFD, 0x42, 0xB1, 0xBC, 0xD8, 0x59, 0xFF, 0xFB, 0x44, 0xD0, 0x2E, 0xD1,
-    0x2D, 0xFF, 0xF9, 0xC8, 0x5A, 0xF9, 0x6E, 0xBB, 0x70, 0x42, 0xBA, 0xBF, 0xDF, 0xBA, 0xDF, 0xBA,
-    0xC1, 0x00, 0x42, 0x2E, 0xCB, 0x9E, 0x21, 0xBA, 0xFA, 0x21, 0xD0, 0xFD, 0x42, 0x82, 0x8C, 0xED,
-    0x2C, 0xFF, 0xFD, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF, 0xE6, 0xFF, 0xF9, 0xC8, 0x33, 0xBB, 0x49,
-    0x42, 0xD0, 0x2D, 0xDF, 0x9F, 0xBB, 0x3C, 0x42, 0x8F, 0x8E, 0xC8, 0x52, 0xC8, 0x52, 0xC3, 0x00,
-    0x42, 0xD1, 0x2E, 0x2D, 0xFF, 0xF9, 0xC8, 0x18, 0xBB, 0x2E, 0x41, 0x81, 0xC9, 0xD0, 0x21, 0xD1,
-    0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x43, 0x2E, 0xD0, 0x2D, 0xC7, 0xFC,
-    0xFF, 0xFD, 0xBB, 0x12, 0x41, 0xB5, 0xCE, 0x81, 0x21, 0xD0, 0xFC, 0x21, 0xBC, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xBA,
-    0xF2, 0x50, 0x8C, 0x81, 0x88, 0x82, 0x80, 0x86, 0x87, 0x83, 0x94, 0x96, 0x97, 0x84, 0x85, 0x89,
-    0x8E, 0x8F, 0xFF, 0x7B, 0xFF, 0xA2, 0xFF, 0xAF, 0xFF, 0xBD, 0xFF, 0xD9, 0xC7, 0xD8, 0xC7, 0xD8,
-    0xFF, 0xF9, 0xBD, 0x79, 0xBD, 0x79, 0xBD, 0x79, 0xBD, 0x79, 0xBD, 0x79, 0xBD, 0x79, 0xBD, 0x79,
-    0xBD, 0x79, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFE, 0xF9, 0xFF, 0xCF, 0xBF, 0xDE, 0xBD, 0x48, 0xA0,
-    0x0C, 0x74, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB9,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x80, 0xFD, 0x42,
-    0xD1, 0x2D, 0xFF, 0xFD, 0xBA, 0x7D, 0x50, 0xB1, 0xB3, 0xB7, 0xBC, 0xBE, 0xB0, 0xB2, 0xB4, 0xB5,
-    0xB6, 0xB8, 0xB9, 0xBA, 0xBB, 0xBD, 0xBF, 0xC7, 0x5A, 0xC7, 0x5A, 0xC7, 0x5A, 0xC7, 0x63, 0xFF,
-    0xF9, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD,
-    0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0x42, 0x82, 0x8C, 0xEC, 0x21, 0xFB, 0xA4, 0x43, 0xD0,
-    0xD1, 0x2D, 0xDE, 0x98, 0xFF, 0xF9, 0xBA, 0x3E, 0x41, 0xB7, 0xD0, 0xA9, 0x42, 0xD0, 0x2D, 0xFF,
-    0xFC, 0xBA, 0x30, 0x50, 0x81, 0x88, 0x84, 0x80, 0x82, 0x8C, 0x96, 0x94, 0x97, 0x83, 0x85, 0x86,
-    0x87, 0x89, 0x8E, 0x8F, 0xFF, 0xEB, 0xFD, 0x21, 0xCC, 0x74, 0xC7, 0x16, 0xDC, 0xCF, 0xC7, 0x16,
-    0xFF, 0xF9, 0xBC, 0xB7, 0xBC, 0xB7, 0xBC, 0xB7, 0xBC, 0xB7, 0xBC, 0xB7, 0xBC, 0xB7, 0xBC, 0xB7,
-    0xBC, 0xB7, 0xBC, 0xB7, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x82, 0xFF, 0xCF, 0xBF, 0x1C, 0xBC,
-    0x86, 0x41, 0xB7, 0xD0, 0x8B, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB3, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x94, 0xFD, 0x21, 0xD1, 0xFD,
-    0x21, 0xBE, 0xFD, 0x43, 0x2E, 0xD0, 0x2D, 0xC6, 0xB3, 0xFF, 0xFD, 0xB9, 0xC9, 0x41, 0x80, 0xD0,
-    0x92, 0x43, 0xD0, 0xD1, 0x2D, 0xC2, 0x35, 0xFF, 0xFC, 0xB9, 0xBB, 0x50, 0xB3, 0xB4, 0xB2, 0xBC,
-    0xBD, 0xBE, 0xB0, 0xB1, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBF, 0xC6, 0x95, 0xC6, 0x95,
-    0xFF, 0xE8, 0xC6, 0x9E, 0xC6, 0x9E, 0xFF, 0xF6, 0xBC, 0x3F, 0xBC, 0x3F, 0xBC, 0x3F, 0xBC, 0x3F,
-    0xBC, 0x3F, 0xBC, 0x3F, 0xBC, 0x3F, 0xBC, 0x3F, 0xBC, 0x3F, 0xBC, 0x3F, 0x42, 0x82, 0x8C, 0xDD,
-    0xD7, 0xFA, 0xDF, 0x42, 0xD1, 0x2D, 0xFF, 0xF9, 0xB9, 0x79, 0x43, 0x2E, 0xD0, 0x2D, 0xC6, 0x5C,
-    0xC4, 0xC9, 0xB9, 0x72, 0x41, 0xBC, 0xCF, 0xDD, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xB9, 0x64, 0x50,
-    0x81, 0x85, 0x80, 0x82, 0x88, 0x96, 0x94, 0x97, 0x83, 0x84, 0x86, 0x87, 0x89, 0x8C, 0x8E, 0x8F,
-    0xFF, 0xE4, 0xC6, 0x41, 0xC6, 0x4A, 0xFF, 0xEB, 0xC6, 0x4A, 0xFF, 0xF9, 0xBB, 0xEB, 0xBB, 0xEB,
-    0xBB, 0xEB, 0xBB, 0xEB, 0xBB, 0xEB, 0xBB, 0xEB, 0xBB, 0xEB, 0xBB, 0xEB, 0xBB, 0xEB, 0xBB, 0xEB,
-    0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x7B, 0xFF, 0xCF, 0xBE, 0x50, 0xBB, 0xBA, 0x41, 0xB3, 0xF9,
-    0x77, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBD, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD,
-    0xB8, 0xF1, 0x50, 0xB1, 0xB3, 0xB4, 0xB7, 0xB5, 0xB0, 0xB2, 0xB6, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC,
-    0xBD, 0xBE, 0xBF, 0xC5, 0xCE, 0xC5, 0xCE, 0xC5, 0xCE, 0xC5, 0xCE, 0xFF, 0xF9, 0xDF, 0x5F, 0xBB,
-    0x78, 0xBB, 0x78, 0xBB, 0x78, 0xBB, 0x78, 0xBB, 0x78, 0xBB, 0x78, 0xBB, 0x78, 0xBB, 0x78, 0xBB,
-    0x78, 0xBB, 0x78, 0x42, 0xD0, 0x2D, 0xDD, 0xF6, 0xB8, 0xB9, 0x43, 0x2E, 0xD0, 0x2D, 0xC5, 0x9C,
-    0xE4, 0xC5, 0xB8, 0xB2, 0x41, 0xBE, 0xC2, 0x33, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1,
-    0xFD, 0x21, 0xBA, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xB8, 0x98, 0x50, 0x81, 0x88, 0x86, 0x82,
-    0x8C, 0x83, 0x94, 0x96, 0x97, 0x80, 0x84, 0x85, 0x87, 0x89, 0x8E, 0x8F, 0xFB, 0x89, 0xFD, 0x55,
-    0xC5, 0x75, 0xFF, 0xD8, 0xFF, 0xDF, 0xFF, 0xF9, 0xBB, 0x1F, 0xBB, 0x1F, 0xBB, 0x1F, 0xBB, 0x1F,
-    0xBB, 0x1F, 0xBB, 0x1F, 0xBB, 0x1F, 0xBB, 0x1F, 0xBB, 0x1F, 0xBB, 0x1F, 0x44, 0xD0, 0xD1, 0xD2,
-    0x27, 0xFF, 0x76, 0xFF, 0xCF, 0xBD, 0x84, 0xBA, 0xEE, 0x41, 0xB2, 0xD0, 0x69, 0x21, 0xD0, 0xFC,
-    0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB1, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80,
-    0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xB8, 0x2B, 0x50, 0xB1, 0xB4, 0xB6, 0xBC, 0xBD, 0xBE, 0xB0,
-    0xB2, 0xB3, 0xB5, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBF, 0xCA, 0x6F, 0xC5, 0x08, 0xC5, 0x08, 0xC5,
-    0x11, 0xC5, 0x11, 0xFF, 0xF9, 0xBA, 0xB2, 0xBA, 0xB2, 0xBA, 0xB2, 0xBA, 0xB2, 0xBA, 0xB2, 0xBA,
-    0xB2, 0xBA, 0xB2, 0xBA, 0xB2, 0xBA, 0xB2, 0xBA, 0xB2, 0x50, 0x87, 0x82, 0x94, 0x96, 0x97, 0x80,
-    0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0xC4, 0xD7, 0xC4, 0xE0, 0xBA, 0x81,
-    0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81,
-    0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFF,
-    0x9E, 0xFF, 0xCF, 0xBC, 0xE6, 0xBA, 0x50, 0x43, 0x2E, 0xD0, 0x2D, 0xC4, 0x9F, 0xEB, 0xC3, 0xB7,
-    0xB5, 0x42, 0xB4, 0xBB, 0xB8, 0x58, 0xB8, 0x58, 0x21, 0xD0, 0xF9, 0x21, 0xBE, 0xFD, 0x42, 0xB4,
-    0xBB, 0xB8, 0xF9, 0xB8, 0x4B, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xB9, 0x6F, 0x21, 0x96, 0xF9, 0x43,
-    0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xFD, 0xB7, 0x8D, 0x41, 0x96, 0xC6, 0x55, 0x21, 0xD1, 0xFC,
-    0x21, 0xBF, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xB7, 0x79, 0x50, 0xB1, 0xB3, 0xB2, 0xBB, 0xBC,
-    0xBD, 0xBA, 0xB0, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBE, 0xBF, 0xC4, 0x56, 0xC4, 0x56, 0xC4,
-    0x5F, 0xD5, 0x87, 0xC4, 0x5F, 0xFF, 0xBD, 0xFF, 0xE5, 0xFF, 0xF9, 0xBA, 0x00, 0xBA, 0x00, 0xBA,
-    0x00, 0xBA, 0x00, 0xBA, 0x00, 0xBA, 0x00, 0xBA, 0x00, 0xBA, 0x00, 0x42, 0xB1, 0xBB, 0xB7, 0xEE,
-    0xCE, 0xF3, 0x21, 0xD0, 0xF9, 0x43, 0xBA, 0xB2, 0xB0, 0xDB, 0x8E, 0xC4, 0x4E, 0xFF, 0xFD, 0x41,
-    0xD1, 0xF9, 0x6A, 0x42, 0x81, 0x83, 0xFF, 0xFC, 0xB9, 0x8A, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF,
-    0xEB, 0xFF, 0xF9, 0xC4, 0x0C, 0xB7, 0x22, 0x50, 0x82, 0x88, 0x81, 0x94, 0x96, 0x97, 0x80, 0x83,
-    0x84, 0x85, 0x86, 0x87, 0x89, 0x8C, 0x8E, 0x8F, 0xFF, 0xF3, 0xC3, 0xF9, 0xD5, 0x2A, 0xB9, 0xA3,
-    0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3,
-    0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x72, 0xFF,
-    0xCF, 0xBC, 0x08, 0xB9, 0x72, 0x50, 0x89, 0x81, 0x94, 0x96, 0x97, 0x80, 0x82, 0x83, 0x84, 0x85,
-    0x86, 0x87, 0x88, 0x8C, 0x8E, 0x8F, 0xC3, 0xBB, 0xD4, 0xEC, 0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65,
-    0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65,
-    0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8,
-    0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB9, 0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9,
-    0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9,
-    0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9, 0x34, 0x44, 0xD1, 0xD0, 0xD2, 0x27, 0xFF, 0x9E, 0xFF, 0xCF,
-    0xBB, 0x99, 0xB9, 0x03, 0xC1, 0x00, 0xF1, 0x2D, 0xB6, 0x68, 0x50, 0xBE, 0xB0, 0xB1, 0xB2, 0xB3,
-    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xFF, 0xFA, 0xB8, 0xF0, 0xB8,
-    0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8,
-    0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0x50, 0x94, 0x96, 0x97, 0x80,
-    0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0xB8, 0xBF, 0xB8, 0xBF,
-    0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF,
-    0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xC4, 0x01, 0x01, 0xD0,
-    0xD2, 0xD1, 0x27, 0xFF, 0x9E, 0xBB, 0x24, 0xFF, 0xCF, 0xB8, 0x8E, 0x50, 0x96, 0x83, 0x8E, 0x8F,
-    0x94, 0x97, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0xEC, 0xC8, 0xEE, 0xD1,
-    0xEF, 0x42, 0xF0, 0x06, 0xF0, 0xFB, 0xF1, 0x90, 0xF4, 0x6A, 0xF9, 0x86, 0xFB, 0x37, 0xFB, 0xF9,
-    0xFC, 0xC5, 0xFD, 0x91, 0xFE, 0x2F, 0xFF, 0x0D, 0xFF, 0x7C, 0xFF, 0xF1, 0x41, 0xBD, 0xC6, 0x5C,
-    0x21, 0xD0, 0xFC, 0x21, 0x83, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xB5, 0xB6, 0x50, 0x80, 0x94,
-    0x96, 0x97, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0xFF, 0xF9,
-    0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D,
-    0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0x44, 0xD2,
-    0xD1, 0xD0, 0x27, 0xDA, 0xB7, 0xFF, 0xCF, 0xFE, 0xD8, 0xB8, 0x0C, 0x21, 0x91, 0xF3, 0x46, 0xB2,
-    0xB7, 0xB4, 0xB6, 0xBB, 0xBC, 0xC6, 0xC7, 0xC6, 0xC7, 0xC6, 0xC7, 0xC6, 0xC7, 0xC6, 0xC7, 0xC6,
-    0xC7, 0x42, 0x81, 0x85, 0xC6, 0xB4, 0xC6, 0xB4, 0xA0, 0x0E, 0x42, 0x23, 0xD0, 0xD1, 0x2D, 0xE3,
-    0xF6, 0xFD, 0x21, 0x2D, 0xF6, 0x30, 0x97, 0x94, 0x96, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86,
-    0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0xF6, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x30, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8,
-    0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC,
-    0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0x41, 0x91, 0xFF, 0xBB, 0xC4, 0x01, 0x01, 0xD1, 0xD0,
-    0xD2, 0x27, 0xFF, 0xBA, 0xFF, 0xDB, 0xFF, 0xFC, 0xFF, 0xB7, 0xA0, 0x01, 0x11, 0xA0, 0x01, 0x21,
-    0xA0, 0x01, 0xC2, 0xA0, 0x02, 0x83, 0x21, 0xB7, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21,
-    0xD0, 0xFD, 0x42, 0x83, 0x80, 0xF2, 0x1F, 0xFF, 0xFD, 0xA0, 0x02, 0x13, 0x21, 0xB4, 0xFD, 0xA0,
-    0x02, 0x42, 0x21, 0xB1, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x81,
-    0xFD, 0x22, 0xD0, 0xD1, 0xEB, 0xFD, 0xA0, 0x02, 0x62, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0x96, 0xFD, 0x21, 0xD1, 0xFD, 0xA0, 0x02, 0x11, 0x21, 0x2E, 0xFD, 0x23, 0xBE, 0xB2, 0xB5, 0xE6,
-    0xF7, 0xFD, 0xA3, 0x01, 0xE2, 0x27, 0xD1, 0xD0, 0xAE, 0xC0, 0xF9, 0x21, 0xB7, 0xF7, 0x21, 0xD0,
-    0xFD, 0xA0, 0x04, 0xA2, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0xB3, 0xF1, 0x21, 0xD0, 0xFD, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0x82, 0xDF, 0x21, 0xD1, 0xFD, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBF,
-    0xFD, 0x21, 0xD0, 0xFD, 0x23, 0xB0, 0xBA, 0xBE, 0xD9, 0xEB, 0xFD, 0x21, 0x80, 0xD8, 0x21, 0xD1,
-    0xFD, 0x21, 0xBE, 0xFD, 0x21, 0x80, 0xBD, 0x21, 0xD1, 0xFD, 0x21, 0x83, 0xFD, 0x22, 0xD0, 0xD1,
-    0xF4, 0xFD, 0xA0, 0x0C, 0xB3, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB8, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xBF, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0x82, 0x96,
-    0xE0, 0xFD, 0x22, 0xD0, 0xD1, 0xC2, 0xFB, 0x21, 0x86, 0xFB, 0x21, 0xD1, 0xFD, 0x21, 0x96, 0xFD,
-    0x21, 0xD1, 0xFD, 0x43, 0xB4, 0xB5, 0xBB, 0xFF, 0x1A, 0xFF, 0x7B, 0xFF, 0xFD, 0x41, 0x80, 0xFF,
-    0x10, 0x44, 0x27, 0xD0, 0xD1, 0x2D, 0xFF, 0x09, 0xFF, 0xF2, 0xFF, 0xFC, 0xFF, 0x09, 0xA0, 0x01,
-    0x32, 0xA1, 0x01, 0x21, 0x27, 0xFD, 0x21, 0x27, 0xF8, 0xA0, 0x01, 0x52, 0x21, 0xB4, 0xFD, 0xA1,
-    0x01, 0x21, 0xD0, 0xFD, 0x21, 0x85, 0xF5, 0xA2, 0x01, 0x21, 0x27, 0xD1, 0xE7, 0xFD, 0xA0, 0x0D,
-    0x22, 0x21, 0x87, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x80, 0xF7, 0x21, 0xD1, 0xFD, 0x22, 0xB2, 0xBC,
-    0xF7, 0xFD, 0x21, 0xD0, 0xFB, 0x4B, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xB7, 0xBA, 0xBB, 0xBC, 0xBF,
-    0xB8, 0xFF, 0xCC, 0xFF, 0xD1, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xC8, 0xFF, 0xDA, 0xFE, 0xC8, 0xFE,
-    0xC8, 0xFF, 0xCC, 0xFF, 0xE2, 0xFF, 0xFD, 0x21, 0x82, 0xB2, 0xA1, 0x01, 0x21, 0xD1, 0xFD, 0x21,
-    0xBA, 0xAA, 0x21, 0xD0, 0xFD, 0xA0, 0x02, 0x12, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xBC,
-    0xB7, 0xF7, 0xFD, 0x21, 0xD0, 0xFB, 0x21, 0x80, 0xEF, 0x21, 0xD1, 0xFD, 0x23, 0xBE, 0xB0, 0xB5,
-    0xF7, 0xE9, 0xFD, 0x21, 0xBD, 0xE2, 0x21, 0xD0, 0xFD, 0xA0, 0x0D, 0x62, 0x21, 0x80, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0xBC, 0xFD, 0xA1, 0x02, 0x12, 0xD0, 0xFD, 0x22, 0x83, 0x96, 0xEC, 0xFB, 0xA0,
-    0x02, 0xD1, 0xA3, 0x01, 0xE2, 0xD0, 0xD1, 0x27, 0xDA, 0xF8, 0xFD, 0x21, 0xB4, 0xF7, 0x21, 0xD0,
-    0xFD, 0x44, 0x81, 0x82, 0x88, 0x96, 0xFF, 0xA9, 0xFE, 0x4C, 0xFF, 0xB1, 0xFF, 0xFD, 0x44, 0x27,
-    0xD0, 0xD1, 0x2D, 0xFE, 0x3C, 0xFF, 0x77, 0xFF, 0xF3, 0xFE, 0x3C, 0xA0, 0x04, 0xA1, 0xA0, 0x02,
-    0x41, 0x21, 0x8C, 0xFD, 0xA1, 0x04, 0xA1, 0xD1, 0xFD, 0x22, 0xB2, 0xBB, 0xF2, 0xFB, 0x21, 0xD0,
-    0xFB, 0x21, 0x97, 0xFD, 0x41, 0xB2, 0xFF, 0x40, 0x22, 0xD1, 0xD0, 0xF9, 0xFC, 0x44, 0xB6, 0xB7,
-    0xBB, 0xBE, 0xFE, 0x10, 0xFE, 0x10, 0xFE, 0x10, 0xFF, 0xFB, 0x41, 0x81, 0xFE, 0x03, 0x44, 0x27,
-    0xD0, 0xD1, 0x2D, 0xFD, 0xFC, 0xFF, 0xEF, 0xFF, 0xFC, 0xFD, 0xFC, 0x41, 0xB7, 0xFE, 0xFE, 0xA1,
-    0x01, 0x21, 0xD0, 0xFC, 0x21, 0xBA, 0xB7, 0x22, 0x86, 0x87, 0xB4, 0xB4, 0x22, 0xD0, 0xD1, 0xF8,
-    0xFB, 0x21, 0x97, 0xFB, 0xA0, 0x0D, 0x42, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBC, 0xFD,
-    0x42, 0xD1, 0xD0, 0xFE, 0xF1, 0xFF, 0xFD, 0x42, 0xB2, 0xBC, 0xFF, 0xF9, 0xFE, 0xF3, 0x22, 0xD1,
-    0xD0, 0xE3, 0xF9, 0x47, 0xB1, 0xB2, 0xB3, 0xB4, 0xBB, 0xBC, 0xB0, 0xFD, 0xBA, 0xFE, 0xC3, 0xFD,
-    0xBA, 0xFF, 0xCC, 0xFD, 0xBA, 0xFE, 0xC3, 0xFF, 0xFB, 0xC2, 0x01, 0x21, 0xD0, 0xD1, 0xFF, 0x06,
-    0xFE, 0xFE, 0xC1, 0x01, 0x21, 0xD0, 0xFE, 0xFD, 0x41, 0xBC, 0xFE, 0xC2, 0x21, 0xD0, 0xFC, 0x44,
-    0x81, 0x87, 0x88, 0x96, 0xFF, 0xEA, 0xFD, 0x8E, 0xFF, 0xF3, 0xFF, 0xFD, 0x41, 0x91, 0xFD, 0x81,
-    0x45, 0x27, 0xD0, 0xD1, 0xD2, 0x2D, 0xFD, 0x7A, 0xFF, 0xC3, 0xFF, 0xEF, 0xFF, 0xFC, 0xFD, 0x7A,
-    0xA0, 0x01, 0xE2, 0x21, 0xB6, 0xFD, 0x21, 0xD0, 0xFD, 0x43, 0x81, 0x84, 0x96, 0xFD, 0x64, 0xFD,
-    0x64, 0xFF, 0xFD, 0x43, 0x27, 0xD1, 0x2D, 0xFD, 0x57, 0xFF, 0xF6, 0xFD, 0x57, 0xA0, 0x04, 0x32,
-    0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x43, 0xBF, 0xB2, 0xBC,
-    0xFF, 0xFD, 0xFE, 0x68, 0xFE, 0x6E, 0x41, 0xB4, 0xFF, 0x05, 0x21, 0xD0, 0xFC, 0x21, 0x97, 0xFD,
-    0x22, 0xD0, 0xD1, 0xEC, 0xFD, 0x42, 0xB1, 0xB0, 0xFD, 0x28, 0xFF, 0xFB, 0x43, 0x27, 0xD0, 0x2D,
-    0xFD, 0x1E, 0xFF, 0xF9, 0xFD, 0x1E, 0x41, 0x87, 0xFF, 0x3E, 0x21, 0xD1, 0xFC, 0x42, 0xB2, 0xBC,
-    0xFF, 0xFD, 0xFF, 0x3D, 0x21, 0xD0, 0xF9, 0x21, 0xB8, 0xFD, 0xA1, 0x01, 0x21, 0xD0, 0xFD, 0x43,
-    0xBE, 0xB5, 0xB8, 0xFE, 0x66, 0xFE, 0x66, 0xFE, 0x66, 0x42, 0x96, 0x83, 0xFE, 0x5C, 0xFE, 0x5C,
-    0xC3, 0x01, 0xE2, 0xD0, 0xD1, 0x27, 0xFF, 0xEF, 0xFF, 0xF9, 0xFE, 0x8F, 0x42, 0xB4, 0xB2, 0xFF,
-    0xF4, 0xFF, 0x74, 0x21, 0xD0, 0xF9, 0x44, 0x80, 0x81, 0x85, 0x96, 0xFF, 0xD4, 0xFC, 0xD7, 0xFC,
-    0xD7, 0xFF, 0xFD, 0x41, 0x87, 0xFF, 0x7A, 0x21, 0xD1, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD,
-    0x41, 0xB1, 0xFF, 0x6D, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x82, 0xFF,
-    0x60, 0x21, 0xD1, 0xFC, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xB0, 0xFF, 0x53, 0x21, 0xD0,
-    0xFC, 0x41, 0xBA, 0xFF, 0x4C, 0x21, 0xD0, 0xFC, 0x22, 0xBB, 0xBE, 0xF6, 0xFD, 0x21, 0xD0, 0xFB,
-    0x47, 0xB1, 0xB2, 0xB3, 0xB4, 0xBC, 0xBE, 0xBF, 0xFF, 0xCD, 0xFF, 0xDA, 0xFF, 0x3D, 0xFF, 0x3D,
-    0xFF, 0x3D, 0xFF, 0xE7, 0xFF, 0xFD, 0x41, 0xBE, 0xFF, 0x2D, 0x21, 0xD0, 0xFC, 0x21, 0xBC, 0xFD,
-    0x41, 0x96, 0xFF, 0x1D, 0x21, 0xD1, 0xFC, 0x21, 0x81, 0xFD, 0x22, 0xD0, 0xD1, 0xF3, 0xFD, 0x41,
-    0x80, 0xFF, 0x0E, 0x21, 0xD1, 0xFC, 0x45, 0x80, 0x81, 0x83, 0x84, 0x87, 0xFF, 0x07, 0xFF, 0x0D,
-    0xFF, 0xF4, 0xFF, 0xFD, 0xFF, 0x07, 0xA0, 0x04, 0x52, 0x23, 0xD0, 0xD1, 0x27, 0xB7, 0xED, 0xFD,
-    0x42, 0xB4, 0xBC, 0xFF, 0xF9, 0xFD, 0xCF, 0xA1, 0x04, 0x71, 0xD0, 0xF9, 0x21, 0xB5, 0xFB, 0x21,
-    0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x41, 0x2E, 0xD3, 0x33, 0x21, 0xBC, 0xFC, 0x21, 0xD0, 0xFD, 0x21,
-    0xBE, 0xFD, 0x22, 0xD1, 0xD0, 0xF0, 0xFD, 0xA0, 0x04, 0x82, 0x22, 0x96, 0x8F, 0xFD, 0xFD, 0x21,
-    0xB8, 0xF8, 0xA2, 0x04, 0x32, 0xD1, 0xD0, 0xF8, 0xFD, 0x21, 0xB4, 0xF9, 0x21, 0xD0, 0xFD, 0x21,
-    0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x43, 0xBD, 0xB2, 0xBC, 0xFF, 0xFD, 0xFD, 0x1F, 0xFD, 0x25, 0x41,
-    0x97, 0xFD, 0xBC, 0x22, 0xD0, 0xD1, 0xF2, 0xFC, 0x22, 0xB5, 0xBE, 0xCA, 0xFB, 0x44, 0x27, 0xD1,
-    0xD0, 0x2D, 0xFB, 0xDD, 0xFF, 0x09, 0xFF, 0xFB, 0xFB, 0xDD, 0x41, 0x88, 0xFB, 0xD3, 0x42, 0xD1,
-    0x2D, 0xFF, 0xFC, 0xFB, 0xCC, 0x42, 0xBB, 0xBF, 0xFB, 0xC8, 0xFB, 0xC8, 0x43, 0x81, 0x85, 0x88,
-    0xFB, 0xC1, 0xFB, 0xC1, 0xFB, 0xC1, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEF, 0xFF, 0xF6, 0xFB, 0xB4,
-    0x41, 0x81, 0xFC, 0xB9, 0x21, 0xD1, 0xFC, 0x21, 0xBA, 0xFD, 0x42, 0x81, 0x8C, 0xFB, 0xA3, 0xFB,
-    0xA3, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF6, 0xFF, 0xF9, 0xFB, 0x99, 0x41, 0x96, 0xD2, 0x9D, 0x21,
-    0xD1, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBC, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD,
-    0xFB, 0x7F, 0x41, 0x2D, 0xFB, 0x78, 0x50, 0xB1, 0xB2, 0xB4, 0xB7, 0xBC, 0xBD, 0xBF, 0xB9, 0xBA,
-    0xBB, 0xBE, 0xB0, 0xB3, 0xB5, 0xB6, 0xB8, 0xFC, 0x6B, 0xFD, 0x38, 0xFD, 0x78, 0xFD, 0xFA, 0xFE,
-    0x1D, 0xFE, 0x56, 0xFF, 0x97, 0xFF, 0xA8, 0xFF, 0xC0, 0xFF, 0xDB, 0xFF, 0xF5, 0xFF, 0xFC, 0xFF,
-    0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x41, 0x82, 0xFB, 0x46, 0x41, 0x96, 0xFC, 0xAA, 0x43,
-    0xB5, 0xB0, 0xBC, 0xFC, 0xA6, 0xFC, 0xA6, 0xFD, 0x6B, 0xC3, 0x01, 0xE2, 0xD1, 0xD0, 0x27, 0xFF,
-    0xF2, 0xFF, 0xF6, 0xFB, 0x37, 0x21, 0xB7, 0xF4, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x44, 0x27,
-    0xD1, 0xD0, 0x2D, 0xFB, 0x1C, 0xFF, 0xD9, 0xFF, 0xFD, 0xFB, 0x1C, 0x41, 0xBA, 0xFB, 0x12, 0x43,
-    0x80, 0x85, 0x8C, 0xFB, 0x0E, 0xFB, 0x0E, 0xFB, 0x0E, 0x44, 0x27, 0xD0, 0xD1, 0x2D, 0xFB, 0x01,
-    0xFF, 0xF2, 0xFF, 0xF6, 0xFB, 0x01, 0x41, 0xBB, 0xFA, 0xF7, 0x43, 0x27, 0xD0, 0x2D, 0xFA, 0xF0,
-    0xFF, 0xFC, 0xFA, 0xF0, 0x43, 0xBA, 0xBB, 0xBF, 0xFA, 0xE9, 0xFA, 0xE9, 0xFA, 0xE9, 0x44, 0x27,
-    0xD0, 0xD1, 0x2D, 0xFA, 0xDC, 0xFF, 0xF6, 0xFF, 0x99, 0xFA, 0xDC, 0x41, 0xBB, 0xFB, 0xDE, 0xA1,
-    0x01, 0x21, 0xD0, 0xFC, 0x41, 0xB2, 0xFB, 0x2D, 0x21, 0xD0, 0xFC, 0x42, 0x85, 0x96, 0xFB, 0xCE,
-    0xFF, 0xFD, 0xC3, 0x01, 0x21, 0x27, 0xD0, 0xD1, 0xFB, 0xBC, 0xFF, 0xE9, 0xFF, 0xF9, 0x43, 0xBA,
-    0xBB, 0xBF, 0xFF, 0xE1, 0xFA, 0xAF, 0xFF, 0xF4, 0x42, 0x82, 0x85, 0xFA, 0xA5, 0xFF, 0xD7, 0x43,
-    0xD0, 0xD1, 0x2D, 0xFF, 0xEF, 0xFF, 0xF9, 0xFA, 0x9B, 0x42, 0xD0, 0x2D, 0xFF, 0x9D, 0xFA, 0x91,
-    0x41, 0x8C, 0xFA, 0x8D, 0x42, 0xD1, 0x2D, 0xFF, 0xFC, 0xFA, 0x86, 0x41, 0x85, 0xFA, 0x82, 0xC1,
-    0x04, 0x32, 0x27, 0xFE, 0x37, 0x21, 0xB7, 0xFA, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xE1,
-    0xFF, 0xFD, 0xFA, 0x60, 0x42, 0xB8, 0xB5, 0xD1, 0x64, 0xD1, 0x64, 0x42, 0x96, 0x83, 0xD1, 0x5D,
-    0xD1, 0x5D, 0x22, 0xD0, 0xD1, 0xF2, 0xF9, 0x21, 0x80, 0xFB, 0x21, 0xD1, 0xFD, 0x21, 0xBC, 0xFD,
-    0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xFA, 0x3A, 0x50, 0x80, 0x82, 0x84, 0x88, 0x81, 0x85, 0x86, 0x87,
-    0x83, 0x94, 0x96, 0x97, 0x89, 0x8C, 0x8E, 0x8F, 0xFF, 0x17, 0xFF, 0x32, 0xFF, 0x43, 0xFF, 0x57,
-    0xFF, 0x98, 0xFF, 0xA2, 0xFF, 0xAD, 0xFF, 0xD3, 0xFF, 0xF9, 0xFE, 0xBB, 0xFE, 0xBB, 0xFE, 0xBB,
-    0xFE, 0xBB, 0xFE, 0xBB, 0xFE, 0xBB, 0xFE, 0xBB, 0x41, 0x91, 0xFE, 0x8A, 0xA0, 0x0D, 0xB1, 0x21,
-    0x2D, 0xFD, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFE, 0x84, 0xFF, 0xC5, 0xFF, 0xF6, 0xFF, 0xFD, 0xA0,
-    0x0D, 0xA1, 0xA0, 0x0D, 0xC2, 0x30, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9,
-    0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x21, 0x91, 0xDC, 0x30, 0x94, 0x96, 0x97, 0x80, 0x81, 0x82,
-    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9,
-    0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xA0, 0x0E, 0x02, 0x44, 0xD0, 0xD2,
-    0xD1, 0x27, 0xFF, 0xB8, 0xFF, 0xD9, 0xFF, 0xDC, 0xFF, 0xFD, 0x30, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4,
-    0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
-    0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0x21, 0x91, 0xD2, 0x30, 0x94,
-    0x96, 0x97, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0xCF,
-    0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xA0,
-    0x0E, 0x22, 0x30, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC,
-    0xBD, 0xBE, 0xBF, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0xFD, 0xFD, 0x21, 0x91, 0xDC, 0x30, 0x94, 0x96, 0x97, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
-    0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9,
-    0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xA0, 0x0E, 0x62, 0x44, 0xD0, 0xD2, 0xD1, 0x27, 0xFF,
-    0xB8, 0xFF, 0xD9, 0xFF, 0xDC, 0xFF, 0xFD, 0xC5, 0x0D, 0x82, 0x2D, 0xD0, 0xD2, 0xD1, 0x27, 0xFF,
-    0x08, 0xFF, 0x63, 0xFF, 0x84, 0xFF, 0x87, 0xFF, 0xF3, 0x46, 0xD0, 0xD1, 0xD2, 0x27, 0x2E, 0x2D,
-    0xE3, 0x0F, 0xF7, 0xE2, 0xF8, 0x62, 0xF8, 0xD2, 0xFE, 0xE9, 0xFF, 0xEE,
+constexpr uint8_t uk_trie_classes[256] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x00, 0x00, 0x0E, 0x00, 0x0F, 0x10,
+    0x00, 0x11, 0x00, 0x00, 0x12, 0x00, 0x13, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0x26, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+constexpr uint32_t uk_trie_dense[] = {
+    0x00000000u, 0x00000002u, 0x00000016u, 0x0000002Eu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000040u, 0x00000082u, 0x000000C4u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x000000CAu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x000000D0u, 0x00000112u, 0x00000154u,
+    0x00000000u, 0x0000015Au, 0x0000016Cu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000170u, 0x000001B2u, 0x000001F4u,
+    0x00000000u, 0x000001FAu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000200u, 0x00000242u, 0x00000284u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x0000028Au, 0x0000029Eu, 0x000002B0u,
+    0x000002C2u, 0x000002D4u, 0x000002E6u, 0x000002FAu, 0x0000030Cu, 0x0000031Eu, 0x00000332u, 0x00000344u,
+    0x00000356u, 0x00000368u, 0x0000037Au, 0x0000038Cu, 0x000003A0u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x000003B2u, 0x000003C4u, 0x000003D6u, 0x000003E8u,
+    0x000003FCu, 0x0000040Eu, 0x00000420u, 0x00000432u, 0x00000444u, 0x00000456u, 0x00000468u, 0x0000047Cu,
+    0x00000490u, 0x00000000u, 0x000004A4u, 0x000004B8u, 0x000004CCu, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x000004E0u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+};
+
+constexpr uint8_t uk_trie_nodes[] = {
+    0x00, 0x00, 0x04, 0x01, 0x3A, 0x00, 0x27, 0xD0, 0xD1, 0xD2, 0xCA, 0x00, 0x00, 0xD0, 0x00, 0x00,
+    0x12, 0x01, 0x00, 0x54, 0x01, 0x00, 0x05, 0x02, 0x00, 0x00, 0x27, 0x2D, 0xD0, 0xD1, 0xD2, 0x5A,
+    0x01, 0x00, 0x6C, 0x01, 0x00, 0x70, 0x01, 0x00, 0xB2, 0x01, 0x00, 0xF4, 0x01, 0x00, 0x04, 0x00,
+    0x27, 0xD0, 0xD1, 0xD2, 0xFA, 0x01, 0x00, 0x00, 0x02, 0x00, 0x42, 0x02, 0x00, 0x84, 0x02, 0x00,
+    0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0x8A, 0x02, 0x00, 0x9E, 0x02, 0x00, 0xB0, 0x02, 0x00, 0xC2, 0x02, 0x00, 0xD4, 0x02,
+    0x00, 0xE6, 0x02, 0x00, 0xFA, 0x02, 0x00, 0x0C, 0x03, 0x00, 0x1E, 0x03, 0x00, 0x32, 0x03, 0x00,
+    0x44, 0x03, 0x00, 0x56, 0x03, 0x00, 0x68, 0x03, 0x00, 0x7A, 0x03, 0x00, 0x8C, 0x03, 0x00, 0xA0,
+    0x03, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E,
+    0x8F, 0x94, 0x96, 0x97, 0xB2, 0x03, 0x00, 0xC4, 0x03, 0x00, 0xD6, 0x03, 0x00, 0xE8, 0x03, 0x00,
+    0xFC, 0x03, 0x00, 0x0E, 0x04, 0x00, 0x20, 0x04, 0x00, 0x32, 0x04, 0x00, 0x44, 0x04, 0x00, 0x56,
+    0x04, 0x00, 0x68, 0x04, 0x00, 0x7C, 0x04, 0x00, 0x90, 0x04, 0x00, 0xA4, 0x04, 0x00, 0xB8, 0x04,
+    0x00, 0xCC, 0x04, 0x00, 0x01, 0x00, 0x91, 0xE0, 0x04, 0x00, 0x01, 0x00, 0x2D, 0xF2, 0x04, 0x00,
+    0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xCA, 0x00, 0x00, 0xCA, 0x00, 0x00, 0xCA, 0x00, 0x00, 0xCA, 0x00, 0x00, 0xCA, 0x00,
+    0x00, 0xCA, 0x00, 0x00, 0xCA, 0x00, 0x00, 0xCA, 0x00, 0x00, 0xCA, 0x00, 0x00, 0xCA, 0x00, 0x00,
+    0xCA, 0x00, 0x00, 0xCA, 0x00, 0x00, 0xCA, 0x00, 0x00, 0xCA, 0x00, 0x00, 0xCA, 0x00, 0x00, 0xCA,
+    0x00, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E,
+    0x8F, 0x94, 0x96, 0x97, 0xCA, 0x00, 0x00, 0xCA, 0x00, 0x00, 0xCA, 0x00, 0x00, 0xCA, 0x00, 0x00,
+    0xCA, 0x00, 0x00, 0xCA, 0x00, 0x00, 0xCA, 0x00, 0x00, 0xCA, 0x00, 0x00, 0xCA, 0x00, 0x00, 0xCA,
+    0x00, 0x00, 0xCA, 0x00, 0x00, 0xCA, 0x00, 0x00, 0xCA, 0x00, 0x00, 0xCA, 0x00, 0x00, 0xCA, 0x00,
+    0x00, 0xF6, 0x04, 0x00, 0x01, 0x00, 0x91, 0xCA, 0x00, 0x00, 0x04, 0x00, 0x27, 0xD0, 0xD1, 0xD2,
+    0x04, 0x05, 0x00, 0x08, 0x05, 0x00, 0x4A, 0x05, 0x00, 0x8C, 0x05, 0x00, 0x00, 0x01, 0x0A, 0x00,
+    0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0x92, 0x05, 0x00, 0x92, 0x05, 0x00, 0x92, 0x05, 0x00, 0x92, 0x05, 0x00, 0x92, 0x05,
+    0x00, 0x92, 0x05, 0x00, 0x92, 0x05, 0x00, 0x92, 0x05, 0x00, 0x92, 0x05, 0x00, 0x92, 0x05, 0x00,
+    0x92, 0x05, 0x00, 0x92, 0x05, 0x00, 0x92, 0x05, 0x00, 0x92, 0x05, 0x00, 0x92, 0x05, 0x00, 0x92,
+    0x05, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E,
+    0x8F, 0x94, 0x96, 0x97, 0x92, 0x05, 0x00, 0x92, 0x05, 0x00, 0x92, 0x05, 0x00, 0x92, 0x05, 0x00,
+    0x92, 0x05, 0x00, 0x92, 0x05, 0x00, 0x92, 0x05, 0x00, 0x92, 0x05, 0x00, 0x92, 0x05, 0x00, 0x92,
+    0x05, 0x00, 0x92, 0x05, 0x00, 0x92, 0x05, 0x00, 0x92, 0x05, 0x00, 0x92, 0x05, 0x00, 0x92, 0x05,
+    0x00, 0x92, 0x05, 0x00, 0x01, 0x00, 0x91, 0x92, 0x05, 0x00, 0x01, 0x00, 0x2D, 0xA4, 0x05, 0x00,
+    0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xA8, 0x05, 0x00, 0xAE, 0x05, 0x00, 0xC0, 0x05, 0x00, 0xA8, 0x05, 0x00, 0xD2, 0x05,
+    0x00, 0xA8, 0x05, 0x00, 0xA8, 0x05, 0x00, 0xE4, 0x05, 0x00, 0xA8, 0x05, 0x00, 0xFA, 0x05, 0x00,
+    0x04, 0x06, 0x00, 0x12, 0x06, 0x00, 0x20, 0x06, 0x00, 0x2E, 0x06, 0x00, 0x3C, 0x06, 0x00, 0x46,
+    0x06, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E,
+    0x8F, 0x94, 0x96, 0x97, 0x58, 0x06, 0x00, 0x6A, 0x06, 0x00, 0x78, 0x06, 0x00, 0x8A, 0x06, 0x00,
+    0x94, 0x06, 0x00, 0xA2, 0x06, 0x00, 0xAC, 0x06, 0x00, 0xB6, 0x06, 0x00, 0xC4, 0x06, 0x00, 0xA8,
+    0x05, 0x00, 0xA8, 0x05, 0x00, 0xA8, 0x05, 0x00, 0xA8, 0x05, 0x00, 0xA8, 0x05, 0x00, 0xA8, 0x05,
+    0x00, 0xA8, 0x05, 0x00, 0x01, 0x00, 0x91, 0xA8, 0x05, 0x00, 0x04, 0x02, 0x41, 0x00, 0x27, 0xD0,
+    0xD1, 0xD2, 0xD6, 0x06, 0x00, 0xDC, 0x06, 0x00, 0x1E, 0x07, 0x00, 0x60, 0x07, 0x00, 0x04, 0x00,
+    0x27, 0xD0, 0xD1, 0xD2, 0x66, 0x07, 0x00, 0x70, 0x07, 0x00, 0xB2, 0x07, 0x00, 0x60, 0x07, 0x00,
+    0x04, 0x00, 0x27, 0xD0, 0xD1, 0xD2, 0xF4, 0x07, 0x00, 0x00, 0x08, 0x00, 0x42, 0x08, 0x00, 0x60,
+    0x07, 0x00, 0x04, 0x00, 0x27, 0xD0, 0xD1, 0xD2, 0xD6, 0x06, 0x00, 0x84, 0x08, 0x00, 0xC6, 0x08,
+    0x00, 0x60, 0x07, 0x00, 0x04, 0x00, 0x27, 0xD0, 0xD1, 0xD2, 0xD6, 0x06, 0x00, 0x08, 0x09, 0x00,
+    0x4A, 0x09, 0x00, 0x60, 0x07, 0x00, 0x04, 0x02, 0x41, 0x00, 0x27, 0xD0, 0xD1, 0xD2, 0xD6, 0x06,
+    0x00, 0x8C, 0x09, 0x00, 0xCE, 0x09, 0x00, 0x60, 0x07, 0x00, 0x04, 0x00, 0x27, 0xD0, 0xD1, 0xD2,
+    0xD6, 0x06, 0x00, 0x10, 0x0A, 0x00, 0x52, 0x0A, 0x00, 0x60, 0x07, 0x00, 0x04, 0x00, 0x27, 0xD0,
+    0xD1, 0xD2, 0x94, 0x0A, 0x00, 0x9E, 0x0A, 0x00, 0xE0, 0x0A, 0x00, 0x60, 0x07, 0x00, 0x04, 0x02,
+    0x41, 0x00, 0x27, 0xD0, 0xD1, 0xD2, 0xD6, 0x06, 0x00, 0x22, 0x0B, 0x00, 0x64, 0x0B, 0x00, 0x60,
+    0x07, 0x00, 0x04, 0x00, 0x27, 0xD0, 0xD1, 0xD2, 0xD6, 0x06, 0x00, 0xA6, 0x0B, 0x00, 0xE8, 0x0B,
+    0x00, 0x60, 0x07, 0x00, 0x04, 0x00, 0x27, 0xD0, 0xD1, 0xD2, 0xD6, 0x06, 0x00, 0x2A, 0x0C, 0x00,
+    0x6C, 0x0C, 0x00, 0x60, 0x07, 0x00, 0x04, 0x00, 0x27, 0xD0, 0xD1, 0xD2, 0xD6, 0x06, 0x00, 0xAE,
+    0x0C, 0x00, 0xF0, 0x0C, 0x00, 0x32, 0x0D, 0x00, 0x04, 0x00, 0x27, 0xD0, 0xD1, 0xD2, 0x38, 0x0D,
+    0x00, 0x44, 0x0D, 0x00, 0x86, 0x0D, 0x00, 0x60, 0x07, 0x00, 0x04, 0x00, 0x27, 0xD0, 0xD1, 0xD2,
+    0xC8, 0x0D, 0x00, 0xD0, 0x0D, 0x00, 0x12, 0x0E, 0x00, 0x60, 0x07, 0x00, 0x04, 0x02, 0x41, 0x00,
+    0x27, 0xD0, 0xD1, 0xD2, 0xD6, 0x06, 0x00, 0x54, 0x0E, 0x00, 0x96, 0x0E, 0x00, 0x60, 0x07, 0x00,
+    0x04, 0x00, 0x27, 0xD0, 0xD1, 0xD2, 0xD6, 0x06, 0x00, 0xD8, 0x0E, 0x00, 0x1A, 0x0F, 0x00, 0x60,
+    0x07, 0x00, 0x04, 0x00, 0x27, 0xD0, 0xD1, 0xD2, 0xC8, 0x0D, 0x00, 0x5C, 0x0F, 0x00, 0x9E, 0x0F,
+    0x00, 0x32, 0x0D, 0x00, 0x04, 0x00, 0x27, 0xD0, 0xD1, 0xD2, 0xD6, 0x06, 0x00, 0xE0, 0x0F, 0x00,
+    0x22, 0x10, 0x00, 0x60, 0x07, 0x00, 0x04, 0x00, 0x27, 0xD0, 0xD1, 0xD2, 0xD6, 0x06, 0x00, 0x64,
+    0x10, 0x00, 0xA6, 0x10, 0x00, 0x60, 0x07, 0x00, 0x04, 0x02, 0x41, 0x00, 0x27, 0xD0, 0xD1, 0xD2,
+    0xD6, 0x06, 0x00, 0xE8, 0x10, 0x00, 0x2A, 0x11, 0x00, 0x60, 0x07, 0x00, 0x04, 0x00, 0x27, 0xD0,
+    0xD1, 0xD2, 0xD6, 0x06, 0x00, 0x6C, 0x11, 0x00, 0xAE, 0x11, 0x00, 0x60, 0x07, 0x00, 0x04, 0x00,
+    0x27, 0xD0, 0xD1, 0xD2, 0xD6, 0x06, 0x00, 0xF0, 0x11, 0x00, 0x32, 0x12, 0x00, 0x60, 0x07, 0x00,
+    0x04, 0x00, 0x27, 0xD0, 0xD1, 0xD2, 0xD6, 0x06, 0x00, 0x74, 0x12, 0x00, 0xB6, 0x12, 0x00, 0x60,
+    0x07, 0x00, 0x04, 0x00, 0x27, 0xD0, 0xD1, 0xD2, 0xD6, 0x06, 0x00, 0xF8, 0x12, 0x00, 0x3A, 0x13,
+    0x00, 0x60, 0x07, 0x00, 0x04, 0x00, 0x27, 0xD0, 0xD1, 0xD2, 0xD6, 0x06, 0x00, 0x7C, 0x13, 0x00,
+    0xBE, 0x13, 0x00, 0x60, 0x07, 0x00, 0x04, 0x00, 0x27, 0xD0, 0xD1, 0xD2, 0xD6, 0x06, 0x00, 0x00,
+    0x14, 0x00, 0x42, 0x14, 0x00, 0x60, 0x07, 0x00, 0x04, 0x01, 0x3A, 0x00, 0x27, 0xD0, 0xD1, 0xD2,
+    0xD6, 0x06, 0x00, 0x84, 0x14, 0x00, 0xC6, 0x14, 0x00, 0x60, 0x07, 0x00, 0x04, 0x02, 0x41, 0x00,
+    0x27, 0xD0, 0xD1, 0xD2, 0xD6, 0x06, 0x00, 0x08, 0x15, 0x00, 0x4A, 0x15, 0x00, 0x60, 0x07, 0x00,
+    0x04, 0x02, 0x41, 0x00, 0x27, 0xD0, 0xD1, 0xD2, 0xD6, 0x06, 0x00, 0x8C, 0x15, 0x00, 0xCE, 0x15,
+    0x00, 0x60, 0x07, 0x00, 0x04, 0x02, 0x41, 0x00, 0x27, 0xD0, 0xD1, 0xD2, 0xD6, 0x06, 0x00, 0x10,
+    0x16, 0x00, 0x52, 0x16, 0x00, 0x60, 0x07, 0x00, 0x04, 0x02, 0x41, 0x00, 0x27, 0xD0, 0xD1, 0xD2,
+    0xD6, 0x06, 0x00, 0x94, 0x16, 0x00, 0xD6, 0x16, 0x00, 0x60, 0x07, 0x00, 0x04, 0x02, 0x41, 0x00,
+    0x27, 0xD0, 0xD1, 0xD2, 0xD6, 0x06, 0x00, 0x18, 0x17, 0x00, 0x5A, 0x17, 0x00, 0x60, 0x07, 0x00,
+    0x04, 0x00, 0x27, 0xD0, 0xD1, 0xD2, 0xD6, 0x06, 0x00, 0x00, 0x14, 0x00, 0x9C, 0x17, 0x00, 0x32,
+    0x0D, 0x00, 0x00, 0x02, 0x3B, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0xF2, 0x04, 0x00, 0xDE, 0x17,
+    0x00, 0xF8, 0x17, 0x00, 0x00, 0x02, 0x02, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5,
+    0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x02, 0x18, 0x00, 0x02, 0x18, 0x00,
+    0x02, 0x18, 0x00, 0x02, 0x18, 0x00, 0x02, 0x18, 0x00, 0x02, 0x18, 0x00, 0x02, 0x18, 0x00, 0x02,
+    0x18, 0x00, 0x02, 0x18, 0x00, 0x02, 0x18, 0x00, 0x02, 0x18, 0x00, 0x02, 0x18, 0x00, 0x02, 0x18,
+    0x00, 0x02, 0x18, 0x00, 0x02, 0x18, 0x00, 0x02, 0x18, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83,
+    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0x02, 0x18, 0x00, 0x02,
+    0x18, 0x00, 0x02, 0x18, 0x00, 0x02, 0x18, 0x00, 0x02, 0x18, 0x00, 0x02, 0x18, 0x00, 0x02, 0x18,
+    0x00, 0x02, 0x18, 0x00, 0x02, 0x18, 0x00, 0x02, 0x18, 0x00, 0x02, 0x18, 0x00, 0x02, 0x18, 0x00,
+    0x02, 0x18, 0x00, 0x02, 0x18, 0x00, 0x02, 0x18, 0x00, 0x02, 0x18, 0x00, 0x01, 0x00, 0x91, 0x02,
+    0x18, 0x00, 0x04, 0x00, 0x27, 0xD0, 0xD1, 0xD2, 0x06, 0x18, 0x00, 0x0A, 0x18, 0x00, 0x4C, 0x18,
+    0x00, 0x8E, 0x18, 0x00, 0x00, 0x01, 0x0B, 0x00, 0x01, 0x00, 0x2D, 0x94, 0x18, 0x00, 0x04, 0x00,
+    0x27, 0x2D, 0xD0, 0xD1, 0x94, 0x18, 0x00, 0x94, 0x18, 0x00, 0x98, 0x18, 0x00, 0xA6, 0x18, 0x00,
+    0x04, 0x00, 0x27, 0x2D, 0xD0, 0xD1, 0x94, 0x18, 0x00, 0x94, 0x18, 0x00, 0xAC, 0x18, 0x00, 0xDA,
+    0x18, 0x00, 0x04, 0x00, 0x27, 0x2D, 0xD0, 0xD1, 0x94, 0x18, 0x00, 0x94, 0x18, 0x00, 0xEC, 0x18,
+    0x00, 0xFE, 0x18, 0x00, 0x05, 0x00, 0x27, 0x2D, 0xD0, 0xD1, 0xD2, 0x94, 0x18, 0x00, 0x94, 0x18,
+    0x00, 0x04, 0x19, 0x00, 0x22, 0x19, 0x00, 0x34, 0x19, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0x94, 0x18,
+    0x00, 0x3A, 0x19, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x94, 0x18, 0x00, 0x40, 0x19, 0x00, 0x4A,
+    0x19, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x94, 0x18, 0x00, 0x58, 0x19, 0x00, 0x5E, 0x19, 0x00,
+    0x03, 0x00, 0x27, 0x2D, 0xD1, 0x94, 0x18, 0x00, 0x94, 0x18, 0x00, 0x68, 0x19, 0x00, 0x03, 0x00,
+    0x27, 0x2D, 0xD0, 0x94, 0x18, 0x00, 0x94, 0x18, 0x00, 0x76, 0x19, 0x00, 0x02, 0x00, 0x2D, 0xD0,
+    0x94, 0x18, 0x00, 0x80, 0x19, 0x00, 0x04, 0x00, 0x27, 0x2D, 0xD0, 0xD1, 0x94, 0x18, 0x00, 0x94,
+    0x18, 0x00, 0x86, 0x19, 0x00, 0x90, 0x19, 0x00, 0x04, 0x00, 0x27, 0x2D, 0xD0, 0xD1, 0x94, 0x18,
+    0x00, 0x94, 0x18, 0x00, 0xA2, 0x19, 0x00, 0xA8, 0x19, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x94,
+    0x18, 0x00, 0xAE, 0x19, 0x00, 0xBC, 0x19, 0x00, 0x04, 0x00, 0x27, 0x2D, 0xD0, 0xD1, 0x94, 0x18,
+    0x00, 0x94, 0x18, 0x00, 0xC6, 0x19, 0x00, 0xCC, 0x19, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x94, 0x18,
+    0x00, 0xDA, 0x19, 0x00, 0x03, 0x00, 0x27, 0x2D, 0xD0, 0x94, 0x18, 0x00, 0x94, 0x18, 0x00, 0xE0,
+    0x19, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x94, 0x18, 0x00, 0xE0, 0x19, 0x00, 0x02, 0x00, 0x2D, 0xD1,
+    0x94, 0x18, 0x00, 0xE6, 0x19, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x94, 0x18, 0x00, 0xEC, 0x19,
+    0x00, 0xF2, 0x19, 0x00, 0x04, 0x00, 0x27, 0x2D, 0xD0, 0xD1, 0x94, 0x18, 0x00, 0x94, 0x18, 0x00,
+    0xF8, 0x19, 0x00, 0xA8, 0x19, 0x00, 0x01, 0x00, 0x2D, 0x06, 0x1A, 0x00, 0x10, 0x00, 0xB0, 0xB1,
+    0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x0A, 0x1A,
+    0x00, 0x16, 0x1A, 0x00, 0x20, 0x1A, 0x00, 0x2E, 0x1A, 0x00, 0x3C, 0x1A, 0x00, 0x46, 0x1A, 0x00,
+    0xD6, 0x06, 0x00, 0x52, 0x1A, 0x00, 0xD6, 0x06, 0x00, 0x5C, 0x1A, 0x00, 0x68, 0x1A, 0x00, 0x72,
+    0x1A, 0x00, 0x80, 0x1A, 0x00, 0x8A, 0x1A, 0x00, 0x94, 0x1A, 0x00, 0xA4, 0x1A, 0x00, 0x10, 0x00,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97,
+    0xB2, 0x1A, 0x00, 0xC0, 0x1A, 0x00, 0xCA, 0x1A, 0x00, 0xD4, 0x1A, 0x00, 0xD6, 0x06, 0x00, 0xE4,
+    0x1A, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06,
+    0x00, 0xEE, 0x1A, 0x00, 0xEE, 0x1A, 0x00, 0xEE, 0x1A, 0x00, 0xF6, 0x1A, 0x00, 0xEE, 0x1A, 0x00,
+    0x01, 0x00, 0x91, 0xD6, 0x06, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0x06, 0x1A, 0x00, 0x02, 0x1B, 0x00,
+    0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0x08, 0x1B, 0x00, 0x16, 0x1B, 0x00, 0x1E, 0x1B, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06,
+    0x00, 0x28, 0x1B, 0x00, 0xD6, 0x06, 0x00, 0x1E, 0x1B, 0x00, 0xD6, 0x06, 0x00, 0x32, 0x1B, 0x00,
+    0x16, 0x1B, 0x00, 0x40, 0x1B, 0x00, 0xD6, 0x06, 0x00, 0x1E, 0x1B, 0x00, 0x52, 0x1B, 0x00, 0x16,
+    0x1B, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E,
+    0x8F, 0x94, 0x96, 0x97, 0x60, 0x1B, 0x00, 0x72, 0x1B, 0x00, 0x16, 0x1B, 0x00, 0xD6, 0x06, 0x00,
+    0x16, 0x1B, 0x00, 0x16, 0x1B, 0x00, 0x82, 0x1B, 0x00, 0x16, 0x1B, 0x00, 0x16, 0x1B, 0x00, 0x16,
+    0x1B, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x8E, 0x1B,
+    0x00, 0xD6, 0x06, 0x00, 0x02, 0x02, 0x7B, 0x00, 0x2D, 0xD1, 0x06, 0x1A, 0x00, 0x98, 0x1B, 0x00,
+    0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0x9E, 0x1B, 0x00, 0xA8, 0x1B, 0x00, 0xB8, 0x1B, 0x00, 0x16, 0x1B, 0x00, 0xC8, 0x1B,
+    0x00, 0xDC, 0x1B, 0x00, 0xEA, 0x1B, 0x00, 0xFA, 0x1B, 0x00, 0x0A, 0x1C, 0x00, 0x18, 0x1C, 0x00,
+    0x24, 0x1C, 0x00, 0x34, 0x1C, 0x00, 0x48, 0x1C, 0x00, 0x18, 0x1C, 0x00, 0x58, 0x1C, 0x00, 0x66,
+    0x1C, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E,
+    0x8F, 0x94, 0x96, 0x97, 0x7A, 0x1C, 0x00, 0x8A, 0x1C, 0x00, 0x9A, 0x1C, 0x00, 0xAA, 0x1C, 0x00,
+    0x16, 0x1B, 0x00, 0x18, 0x1C, 0x00, 0x82, 0x1B, 0x00, 0x18, 0x1C, 0x00, 0x18, 0x1C, 0x00, 0x18,
+    0x1C, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xB4, 0x1C,
+    0x00, 0xD6, 0x06, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9,
+    0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x1E, 0x1B, 0x00, 0x18,
+    0x1C, 0x00, 0x1E, 0x1B, 0x00, 0xBE, 0x1C, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06,
+    0x00, 0xD6, 0x06, 0x00, 0x16, 0x1B, 0x00, 0xCC, 0x1C, 0x00, 0x1E, 0x1B, 0x00, 0xDE, 0x1C, 0x00,
+    0xF0, 0x1C, 0x00, 0x16, 0x1B, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xFE, 0x1C, 0x00, 0x10, 0x1D, 0x00, 0x18, 0x1C,
+    0x00, 0xD6, 0x06, 0x00, 0x16, 0x1B, 0x00, 0xD6, 0x06, 0x00, 0x16, 0x1B, 0x00, 0x16, 0x1B, 0x00,
+    0x16, 0x1B, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6,
+    0x06, 0x00, 0x20, 0x1D, 0x00, 0xD6, 0x06, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5,
+    0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x2A, 0x1D, 0x00, 0x34, 0x1D, 0x00,
+    0x3E, 0x1D, 0x00, 0xD6, 0x06, 0x00, 0x4C, 0x1D, 0x00, 0x58, 0x1D, 0x00, 0x66, 0x1D, 0x00, 0x76,
+    0x1D, 0x00, 0x8A, 0x1D, 0x00, 0xD6, 0x06, 0x00, 0x16, 0x1B, 0x00, 0x1E, 0x1B, 0x00, 0x1E, 0x1B,
+    0x00, 0x94, 0x1D, 0x00, 0xA2, 0x1D, 0x00, 0x16, 0x1B, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83,
+    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xB0, 0x1D, 0x00, 0xC2,
+    0x1D, 0x00, 0x18, 0x1C, 0x00, 0xCE, 0x1D, 0x00, 0x16, 0x1B, 0x00, 0x16, 0x1B, 0x00, 0x16, 0x1B,
+    0x00, 0x16, 0x1B, 0x00, 0x16, 0x1B, 0x00, 0x16, 0x1B, 0x00, 0xD8, 0x1D, 0x00, 0xD6, 0x06, 0x00,
+    0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xEA, 0x1D, 0x00, 0xD6, 0x06, 0x00, 0x10, 0x00, 0xB0, 0xB1,
+    0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xF8, 0x1D,
+    0x00, 0xD6, 0x06, 0x00, 0x04, 0x1E, 0x00, 0xD6, 0x06, 0x00, 0x0E, 0x1E, 0x00, 0x18, 0x1E, 0x00,
+    0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x28, 0x1E, 0x00, 0x30, 0x1E, 0x00, 0x3E,
+    0x1E, 0x00, 0x48, 0x1E, 0x00, 0x56, 0x1E, 0x00, 0x64, 0x1E, 0x00, 0xD6, 0x06, 0x00, 0x10, 0x00,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97,
+    0xD6, 0x06, 0x00, 0x74, 0x1E, 0x00, 0x7E, 0x1E, 0x00, 0x8C, 0x1E, 0x00, 0xD6, 0x06, 0x00, 0xD6,
+    0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06,
+    0x00, 0xEE, 0x1A, 0x00, 0xEE, 0x1A, 0x00, 0xEE, 0x1A, 0x00, 0x9C, 0x1E, 0x00, 0xEE, 0x1A, 0x00,
+    0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xD6, 0x06, 0x00, 0x1E, 0x1B, 0x00, 0xA8, 0x1E, 0x00, 0xD6, 0x06, 0x00, 0xB6, 0x1E,
+    0x00, 0xD6, 0x06, 0x00, 0x16, 0x1B, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00,
+    0xC0, 0x1E, 0x00, 0xD6, 0x06, 0x00, 0xCC, 0x1E, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x1E, 0x00, 0x16,
+    0x1B, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E,
+    0x8F, 0x94, 0x96, 0x97, 0xCC, 0x1E, 0x00, 0x82, 0x1B, 0x00, 0x16, 0x1B, 0x00, 0xD6, 0x06, 0x00,
+    0x16, 0x1B, 0x00, 0x16, 0x1B, 0x00, 0x16, 0x1B, 0x00, 0x16, 0x1B, 0x00, 0x16, 0x1B, 0x00, 0xD6,
+    0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06,
+    0x00, 0xD6, 0x06, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0x06, 0x1A, 0x00, 0xE0, 0x1E, 0x00, 0x10, 0x00,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xEA, 0x1E, 0x00, 0xF8, 0x1E, 0x00, 0x06, 0x1F, 0x00, 0x1C, 0x1F, 0x00, 0x2A, 0x1F, 0x00, 0x3C,
+    0x1F, 0x00, 0xD6, 0x06, 0x00, 0x16, 0x1B, 0x00, 0xD6, 0x06, 0x00, 0x46, 0x1F, 0x00, 0x18, 0x1C,
+    0x00, 0x1E, 0x1B, 0x00, 0x50, 0x1F, 0x00, 0x62, 0x1F, 0x00, 0x74, 0x1F, 0x00, 0x16, 0x1B, 0x00,
+    0x10, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94,
+    0x96, 0x97, 0x7E, 0x1F, 0x00, 0x82, 0x1B, 0x00, 0x16, 0x1B, 0x00, 0x90, 0x1F, 0x00, 0x16, 0x1B,
+    0x00, 0x16, 0x1B, 0x00, 0x16, 0x1B, 0x00, 0x9E, 0x1F, 0x00, 0x16, 0x1B, 0x00, 0x16, 0x1B, 0x00,
+    0xAA, 0x1F, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xBC, 0x1F, 0x00, 0xD6,
+    0x06, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB,
+    0xBC, 0xBD, 0xBE, 0xBF, 0xC6, 0x1F, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD2, 0x1F, 0x00,
+    0xD6, 0x06, 0x00, 0xDC, 0x1F, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xEC,
+    0x1F, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xFC, 0x1F,
+    0x00, 0xD6, 0x06, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+    0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xEE,
+    0x1A, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06,
+    0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xEE, 0x1A, 0x00, 0xEE, 0x1A, 0x00, 0xEE, 0x1A, 0x00,
+    0xF6, 0x1A, 0x00, 0xEE, 0x1A, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
+    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xD6, 0x06, 0x00, 0x18, 0x1C, 0x00, 0x18, 0x1C,
+    0x00, 0x18, 0x1C, 0x00, 0x18, 0x1C, 0x00, 0x08, 0x20, 0x00, 0x16, 0x1B, 0x00, 0x18, 0x1C, 0x00,
+    0xD6, 0x06, 0x00, 0x16, 0x1B, 0x00, 0x12, 0x20, 0x00, 0xFA, 0x1B, 0x00, 0x22, 0x20, 0x00, 0x36,
+    0x20, 0x00, 0x46, 0x20, 0x00, 0x18, 0x1C, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+    0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0x18, 0x1C, 0x00, 0x52, 0x20, 0x00,
+    0x36, 0x20, 0x00, 0x62, 0x20, 0x00, 0x18, 0x1C, 0x00, 0x18, 0x1C, 0x00, 0x18, 0x1C, 0x00, 0x18,
+    0x1C, 0x00, 0x6C, 0x20, 0x00, 0x16, 0x1B, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06,
+    0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3,
+    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x7C, 0x20, 0x00, 0x16,
+    0x1B, 0x00, 0x86, 0x20, 0x00, 0x16, 0x1B, 0x00, 0x16, 0x1B, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06,
+    0x00, 0x16, 0x1B, 0x00, 0x94, 0x20, 0x00, 0xD6, 0x06, 0x00, 0x18, 0x1C, 0x00, 0x9E, 0x20, 0x00,
+    0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xAC, 0x20, 0x00, 0xD6, 0x06, 0x00, 0x10, 0x00, 0x80, 0x81,
+    0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xBA, 0x20,
+    0x00, 0xC8, 0x20, 0x00, 0xDA, 0x20, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x1E, 0x1B, 0x00,
+    0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x1E, 0x1B, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6,
+    0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x10, 0x00,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xD6, 0x06, 0x00, 0x18, 0x1C, 0x00, 0x16, 0x1B, 0x00, 0x18, 0x1C, 0x00, 0x18, 0x1C, 0x00, 0xD6,
+    0x06, 0x00, 0x16, 0x1B, 0x00, 0x16, 0x1B, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x18, 0x1C,
+    0x00, 0xE8, 0x20, 0x00, 0x36, 0x20, 0x00, 0x18, 0x1C, 0x00, 0xD6, 0x06, 0x00, 0x18, 0x1C, 0x00,
+    0x10, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94,
+    0x96, 0x97, 0x16, 0x1B, 0x00, 0x18, 0x1C, 0x00, 0x18, 0x1C, 0x00, 0xD6, 0x06, 0x00, 0x16, 0x1B,
+    0x00, 0xF8, 0x20, 0x00, 0x16, 0x1B, 0x00, 0x16, 0x1B, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00,
+    0x04, 0x21, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6,
+    0x06, 0x00, 0x01, 0x00, 0x91, 0x16, 0x1B, 0x00, 0x02, 0x02, 0x7B, 0x00, 0x2D, 0xD1, 0x06, 0x1A,
+    0x00, 0x16, 0x21, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9,
+    0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x1C, 0x21, 0x00, 0x26, 0x21, 0x00, 0x16, 0x1B, 0x00, 0x18,
+    0x1C, 0x00, 0x16, 0x1B, 0x00, 0x3A, 0x21, 0x00, 0x18, 0x1C, 0x00, 0x16, 0x1B, 0x00, 0xD6, 0x06,
+    0x00, 0xD6, 0x06, 0x00, 0x44, 0x21, 0x00, 0xFA, 0x1B, 0x00, 0x18, 0x1C, 0x00, 0x54, 0x21, 0x00,
+    0x64, 0x21, 0x00, 0x18, 0x1C, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0x6E, 0x21, 0x00, 0x7E, 0x21, 0x00, 0x18, 0x1C,
+    0x00, 0xD6, 0x06, 0x00, 0x18, 0x1C, 0x00, 0x18, 0x1C, 0x00, 0x16, 0x1B, 0x00, 0x16, 0x1B, 0x00,
+    0x18, 0x1C, 0x00, 0x8E, 0x21, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6,
+    0x06, 0x00, 0x9A, 0x21, 0x00, 0xD6, 0x06, 0x00, 0x01, 0x02, 0x7B, 0x00, 0x2D, 0x06, 0x1A, 0x00,
+    0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xA4, 0x21, 0x00, 0x16, 0x1B, 0x00, 0x18, 0x1C, 0x00, 0xB2, 0x21, 0x00, 0xC6, 0x21,
+    0x00, 0xDA, 0x21, 0x00, 0x18, 0x1C, 0x00, 0x18, 0x1C, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00,
+    0xE8, 0x21, 0x00, 0x16, 0x1B, 0x00, 0x18, 0x1C, 0x00, 0xF8, 0x21, 0x00, 0x08, 0x22, 0x00, 0x16,
+    0x1B, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E,
+    0x8F, 0x94, 0x96, 0x97, 0x18, 0x1C, 0x00, 0x12, 0x22, 0x00, 0x26, 0x22, 0x00, 0xD6, 0x06, 0x00,
+    0x18, 0x1C, 0x00, 0x18, 0x1C, 0x00, 0xFA, 0x1B, 0x00, 0x18, 0x1C, 0x00, 0x18, 0x1C, 0x00, 0x16,
+    0x1B, 0x00, 0x3A, 0x22, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x4C, 0x22,
+    0x00, 0xD6, 0x06, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9,
+    0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x56, 0x22, 0x00, 0x66, 0x22, 0x00, 0x78, 0x22, 0x00, 0xD6,
+    0x06, 0x00, 0x86, 0x22, 0x00, 0x98, 0x22, 0x00, 0xD6, 0x06, 0x00, 0xA8, 0x22, 0x00, 0xD6, 0x06,
+    0x00, 0x28, 0x1E, 0x00, 0xB2, 0x22, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xBC, 0x22, 0x00,
+    0xC6, 0x22, 0x00, 0xD6, 0x22, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xE4, 0x22, 0x00, 0xEE, 0x22, 0x00, 0xD6, 0x06,
+    0x00, 0xFC, 0x22, 0x00, 0xD6, 0x06, 0x00, 0x0C, 0x23, 0x00, 0xD6, 0x06, 0x00, 0x16, 0x23, 0x00,
+    0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xEE, 0x1A, 0x00, 0xEE, 0x1A, 0x00, 0xEE,
+    0x1A, 0x00, 0x20, 0x23, 0x00, 0xEE, 0x1A, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5,
+    0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x30, 0x23, 0x00, 0x16, 0x1B, 0x00,
+    0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x18, 0x1C, 0x00, 0x3E, 0x23, 0x00, 0xD6, 0x06, 0x00, 0x16,
+    0x1B, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x1E, 0x1B, 0x00, 0xD6, 0x06,
+    0x00, 0xD6, 0x06, 0x00, 0x4C, 0x23, 0x00, 0x16, 0x1B, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83,
+    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0x5A, 0x23, 0x00, 0x6C,
+    0x23, 0x00, 0xDA, 0x20, 0x00, 0xD6, 0x06, 0x00, 0x1E, 0x1B, 0x00, 0xD6, 0x06, 0x00, 0x1E, 0x1B,
+    0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00,
+    0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x7E, 0x23, 0x00, 0xD6, 0x06, 0x00, 0x10, 0x00, 0xB0, 0xB1,
+    0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x88, 0x23,
+    0x00, 0x18, 0x1C, 0x00, 0x92, 0x23, 0x00, 0x18, 0x1C, 0x00, 0xA6, 0x23, 0x00, 0xBA, 0x23, 0x00,
+    0x18, 0x1C, 0x00, 0xC4, 0x23, 0x00, 0xD6, 0x06, 0x00, 0x16, 0x1B, 0x00, 0xE8, 0x21, 0x00, 0xD8,
+    0x23, 0x00, 0xE8, 0x23, 0x00, 0xF8, 0x23, 0x00, 0x08, 0x24, 0x00, 0x18, 0x1C, 0x00, 0x10, 0x00,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97,
+    0x18, 0x1C, 0x00, 0x12, 0x24, 0x00, 0x22, 0x24, 0x00, 0x36, 0x24, 0x00, 0x18, 0x1C, 0x00, 0x18,
+    0x1C, 0x00, 0xFA, 0x1B, 0x00, 0x18, 0x1C, 0x00, 0x18, 0x1C, 0x00, 0x40, 0x24, 0x00, 0x50, 0x24,
+    0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00,
+    0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0x62, 0x24, 0x00, 0x16, 0x1B, 0x00, 0x6C, 0x24, 0x00, 0x16, 0x1B, 0x00, 0x76, 0x24,
+    0x00, 0x86, 0x24, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00,
+    0x90, 0x24, 0x00, 0x9E, 0x20, 0x00, 0x1E, 0x1B, 0x00, 0x1E, 0x1B, 0x00, 0xA2, 0x24, 0x00, 0xAC,
+    0x24, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E,
+    0x8F, 0x94, 0x96, 0x97, 0xD6, 0x06, 0x00, 0xBE, 0x24, 0x00, 0xCE, 0x24, 0x00, 0xE0, 0x24, 0x00,
+    0xEA, 0x24, 0x00, 0xF4, 0x24, 0x00, 0xB6, 0x1E, 0x00, 0xD6, 0x06, 0x00, 0x02, 0x25, 0x00, 0xD6,
+    0x06, 0x00, 0x0C, 0x25, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06,
+    0x00, 0xD6, 0x06, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9,
+    0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xD6, 0x06, 0x00, 0x16, 0x1B, 0x00, 0x1A, 0x25, 0x00, 0x16,
+    0x1B, 0x00, 0x16, 0x1B, 0x00, 0x28, 0x25, 0x00, 0x16, 0x1B, 0x00, 0x36, 0x25, 0x00, 0xD6, 0x06,
+    0x00, 0xD6, 0x06, 0x00, 0x42, 0x25, 0x00, 0x9E, 0x20, 0x00, 0xDA, 0x20, 0x00, 0xD6, 0x06, 0x00,
+    0x4C, 0x25, 0x00, 0xD6, 0x06, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0x56, 0x25, 0x00, 0x64, 0x25, 0x00, 0x76, 0x25,
+    0x00, 0x86, 0x25, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x1E, 0x1B, 0x00, 0x1E, 0x1B, 0x00,
+    0x90, 0x25, 0x00, 0xD6, 0x06, 0x00, 0x9A, 0x25, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6,
+    0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5,
+    0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xEE, 0x1A, 0x00, 0xD2, 0x1F, 0x00,
+    0xAC, 0x25, 0x00, 0xBA, 0x25, 0x00, 0xD6, 0x06, 0x00, 0xEE, 0x1A, 0x00, 0xD6, 0x06, 0x00, 0xC4,
+    0x25, 0x00, 0xD6, 0x06, 0x00, 0x28, 0x1E, 0x00, 0xCE, 0x25, 0x00, 0xDC, 0x25, 0x00, 0xE6, 0x25,
+    0x00, 0xD6, 0x06, 0x00, 0xEE, 0x1A, 0x00, 0xF8, 0x25, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83,
+    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0x06, 0x26, 0x00, 0x14,
+    0x26, 0x00, 0x22, 0x26, 0x00, 0xEE, 0x1A, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06,
+    0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xEE, 0x1A, 0x00,
+    0x30, 0x26, 0x00, 0xEE, 0x1A, 0x00, 0x3C, 0x26, 0x00, 0xEE, 0x1A, 0x00, 0x10, 0x00, 0xB0, 0xB1,
+    0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xD6, 0x06,
+    0x00, 0x16, 0x1B, 0x00, 0xD6, 0x06, 0x00, 0x16, 0x1B, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00,
+    0xD6, 0x06, 0x00, 0x16, 0x1B, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6,
+    0x06, 0x00, 0x1E, 0x1B, 0x00, 0xD6, 0x06, 0x00, 0x48, 0x26, 0x00, 0xD6, 0x06, 0x00, 0x10, 0x00,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97,
+    0x1E, 0x1B, 0x00, 0x52, 0x26, 0x00, 0x9E, 0x20, 0x00, 0xD6, 0x06, 0x00, 0x18, 0x1C, 0x00, 0xD6,
+    0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x02, 0x25, 0x00, 0xD6, 0x06, 0x00, 0x1E, 0x1B,
+    0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x60, 0x26, 0x00, 0xD6, 0x06, 0x00,
+    0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x6A, 0x26, 0x00, 0x16, 0x1B, 0x00, 0x16, 0x1B,
+    0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00,
+    0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x1E, 0x1B, 0x00, 0x1E, 0x1B, 0x00, 0x78, 0x26, 0x00, 0xD6,
+    0x06, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E,
+    0x8F, 0x94, 0x96, 0x97, 0x1E, 0x1B, 0x00, 0x86, 0x26, 0x00, 0x90, 0x26, 0x00, 0xD6, 0x06, 0x00,
+    0xD6, 0x06, 0x00, 0x16, 0x1B, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x1E, 0x1B, 0x00, 0xD6,
+    0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x9E, 0x26,
+    0x00, 0xD6, 0x06, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9,
+    0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x1C, 0x21, 0x00, 0x16, 0x1B, 0x00, 0xD6, 0x06, 0x00, 0x16,
+    0x1B, 0x00, 0x16, 0x1B, 0x00, 0xA8, 0x26, 0x00, 0xD6, 0x06, 0x00, 0x16, 0x1B, 0x00, 0xD6, 0x06,
+    0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00,
+    0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xD6, 0x06, 0x00, 0x02, 0x25, 0x00, 0xB2, 0x26,
+    0x00, 0xBC, 0x26, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x16, 0x1B, 0x00, 0xD6, 0x06, 0x00,
+    0x90, 0x25, 0x00, 0xD6, 0x06, 0x00, 0xC6, 0x26, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6,
+    0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5,
+    0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xD6, 0x06, 0x00, 0x18, 0x1C, 0x00,
+    0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x16, 0x1B, 0x00, 0xD6, 0x06, 0x00, 0x16, 0x1B, 0x00, 0xD6,
+    0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x1E, 0x1B,
+    0x00, 0x1E, 0x1B, 0x00, 0xD4, 0x26, 0x00, 0xD6, 0x06, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83,
+    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xD6, 0x06, 0x00, 0xD6,
+    0x06, 0x00, 0x1E, 0x1B, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06,
+    0x00, 0x16, 0x1B, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00,
+    0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x10, 0x00, 0xB0, 0xB1,
+    0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xDE, 0x26,
+    0x00, 0x16, 0x1B, 0x00, 0x1E, 0x1B, 0x00, 0x16, 0x1B, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00,
+    0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xE8, 0x26, 0x00, 0xB6,
+    0x1E, 0x00, 0x1E, 0x1B, 0x00, 0xF6, 0x26, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x10, 0x00,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97,
+    0xD6, 0x06, 0x00, 0xB6, 0x1E, 0x00, 0x04, 0x27, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6,
+    0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x16, 0x1B, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06,
+    0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00,
+    0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06,
+    0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00,
+    0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6,
+    0x06, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E,
+    0x8F, 0x94, 0x96, 0x97, 0xD6, 0x06, 0x00, 0xB6, 0x1E, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00,
+    0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x16,
+    0x1B, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06,
+    0x00, 0xD6, 0x06, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9,
+    0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6,
+    0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06,
+    0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00,
+    0x16, 0x27, 0x00, 0xD6, 0x06, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06,
+    0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00,
+    0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6,
+    0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5,
+    0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xEE, 0x1A, 0x00, 0xD6, 0x06, 0x00,
+    0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xEE, 0x1A, 0x00, 0xD6, 0x06, 0x00, 0xD6,
+    0x06, 0x00, 0xD6, 0x06, 0x00, 0x28, 0x1E, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06,
+    0x00, 0xD6, 0x06, 0x00, 0xEE, 0x1A, 0x00, 0xD6, 0x06, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83,
+    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xD6, 0x06, 0x00, 0xD6,
+    0x06, 0x00, 0xD6, 0x06, 0x00, 0xEE, 0x1A, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06,
+    0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xEE, 0x1A, 0x00,
+    0xEE, 0x1A, 0x00, 0xEE, 0x1A, 0x00, 0xEE, 0x1A, 0x00, 0xEE, 0x1A, 0x00, 0x10, 0x00, 0xB0, 0xB1,
+    0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xC6, 0x1F,
+    0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x1E, 0x27, 0x00, 0x28, 0x27, 0x00,
+    0xD6, 0x06, 0x00, 0x34, 0x27, 0x00, 0xD6, 0x06, 0x00, 0x28, 0x1E, 0x00, 0x3E, 0x27, 0x00, 0xD6,
+    0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xEE, 0x1A, 0x00, 0xD6, 0x06, 0x00, 0x10, 0x00,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97,
+    0x48, 0x27, 0x00, 0x52, 0x27, 0x00, 0xD6, 0x06, 0x00, 0xEE, 0x1A, 0x00, 0xD6, 0x06, 0x00, 0xD6,
+    0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06,
+    0x00, 0xEE, 0x1A, 0x00, 0xEE, 0x1A, 0x00, 0xEE, 0x1A, 0x00, 0x5C, 0x27, 0x00, 0xEE, 0x1A, 0x00,
+    0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x66, 0x27, 0x00, 0x70, 0x27, 0x00, 0x7A, 0x27,
+    0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x28, 0x1E, 0x00,
+    0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x84,
+    0x27, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E,
+    0x8F, 0x94, 0x96, 0x97, 0x92, 0x27, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xEE, 0x1A, 0x00,
+    0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6,
+    0x06, 0x00, 0xD6, 0x06, 0x00, 0xEE, 0x1A, 0x00, 0xD6, 0x06, 0x00, 0xEE, 0x1A, 0x00, 0xD6, 0x06,
+    0x00, 0xEE, 0x1A, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9,
+    0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x0A, 0x1A, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6,
+    0x06, 0x00, 0xD6, 0x06, 0x00, 0x9C, 0x27, 0x00, 0xD6, 0x06, 0x00, 0xA8, 0x27, 0x00, 0xEE, 0x1A,
+    0x00, 0xB2, 0x27, 0x00, 0xD6, 0x06, 0x00, 0xBE, 0x27, 0x00, 0xCC, 0x27, 0x00, 0xD6, 0x27, 0x00,
+    0xE0, 0x27, 0x00, 0xD6, 0x06, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xD6, 0x06, 0x00, 0xEC, 0x27, 0x00, 0xD6, 0x06,
+    0x00, 0xEE, 0x1A, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00,
+    0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xEE, 0x1A, 0x00, 0xEE, 0x1A, 0x00, 0xEE,
+    0x1A, 0x00, 0x5C, 0x27, 0x00, 0xEE, 0x1A, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5,
+    0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00,
+    0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xEE, 0x1A, 0x00, 0xF6, 0x27, 0x00, 0x00,
+    0x28, 0x00, 0xD6, 0x06, 0x00, 0x28, 0x1E, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06,
+    0x00, 0xD6, 0x06, 0x00, 0xEE, 0x1A, 0x00, 0xD6, 0x06, 0x00, 0x10, 0x00, 0x80, 0x81, 0x82, 0x83,
+    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xD6, 0x06, 0x00, 0x0A,
+    0x28, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x14, 0x28, 0x00, 0xD6, 0x06,
+    0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xEE, 0x1A, 0x00,
+    0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x10, 0x00, 0x80, 0x81,
+    0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0x1E, 0x28,
+    0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00,
+    0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6,
+    0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0xD6, 0x06, 0x00, 0x06, 0x00,
+    0xB2, 0xB4, 0xB6, 0xB7, 0xBB, 0xBC, 0x28, 0x28, 0x00, 0x28, 0x28, 0x00, 0x28, 0x28, 0x00, 0x28,
+    0x28, 0x00, 0x28, 0x28, 0x00, 0x28, 0x28, 0x00, 0x02, 0x00, 0x81, 0x85, 0x28, 0x28, 0x00, 0x28,
+    0x28, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x02, 0x06, 0x00, 0x10, 0x00, 0xB0, 0xB1, 0xB2, 0xB3,
+    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x2C, 0x28, 0x00, 0x2C,
+    0x28, 0x00, 0x2C, 0x28, 0x00, 0x2C, 0x28, 0x00, 0x2C, 0x28, 0x00, 0x2C, 0x28, 0x00, 0x2C, 0x28,
+    0x00, 0x2C, 0x28, 0x00, 0x2C, 0x28, 0x00, 0x2C, 0x28, 0x00, 0x2C, 0x28, 0x00, 0x2C, 0x28, 0x00,
+    0x2C, 0x28, 0x00, 0x2C, 0x28, 0x00, 0x2C, 0x28, 0x00, 0x2C, 0x28, 0x00, 0x10, 0x00, 0x80, 0x81,
+    0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0x2C, 0x28,
+    0x00, 0x2C, 0x28, 0x00, 0x2C, 0x28, 0x00, 0x2C, 0x28, 0x00, 0x2C, 0x28, 0x00, 0x2C, 0x28, 0x00,
+    0x2C, 0x28, 0x00, 0x2C, 0x28, 0x00, 0x2C, 0x28, 0x00, 0x2C, 0x28, 0x00, 0x2C, 0x28, 0x00, 0x2C,
+    0x28, 0x00, 0x2C, 0x28, 0x00, 0x2C, 0x28, 0x00, 0x2C, 0x28, 0x00, 0x2C, 0x28, 0x00, 0x01, 0x00,
+    0x91, 0x2C, 0x28, 0x00, 0x00, 0x01, 0x0C, 0x00, 0x03, 0x00, 0xB4, 0xB5, 0xBB, 0x30, 0x28, 0x00,
+    0x34, 0x28, 0x00, 0x3A, 0x28, 0x00, 0x01, 0x00, 0x80, 0x30, 0x28, 0x00, 0x0B, 0x00, 0xB1, 0xB2,
+    0xB3, 0xB4, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBF, 0x40, 0x28, 0x00, 0x48, 0x28, 0x00, 0x30,
+    0x28, 0x00, 0x30, 0x28, 0x00, 0x30, 0x28, 0x00, 0x4E, 0x28, 0x00, 0x56, 0x28, 0x00, 0x30, 0x28,
+    0x00, 0x30, 0x28, 0x00, 0x40, 0x28, 0x00, 0x5C, 0x28, 0x00, 0x04, 0x00, 0x81, 0x82, 0x88, 0x96,
+    0x68, 0x28, 0x00, 0x30, 0x28, 0x00, 0x70, 0x28, 0x00, 0x76, 0x28, 0x00, 0x04, 0x00, 0xB6, 0xB7,
+    0xBB, 0xBE, 0x30, 0x28, 0x00, 0x30, 0x28, 0x00, 0x30, 0x28, 0x00, 0x7C, 0x28, 0x00, 0x01, 0x00,
+    0x81, 0x30, 0x28, 0x00, 0x07, 0x00, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xBB, 0xBC, 0x86, 0x28, 0x00,
+    0x30, 0x28, 0x00, 0x48, 0x28, 0x00, 0x30, 0x28, 0x00, 0x90, 0x28, 0x00, 0x30, 0x28, 0x00, 0x48,
+    0x28, 0x00, 0x04, 0x00, 0x81, 0x87, 0x88, 0x96, 0x98, 0x28, 0x00, 0x30, 0x28, 0x00, 0xA4, 0x28,
+    0x00, 0xAC, 0x28, 0x00, 0x01, 0x00, 0x91, 0x30, 0x28, 0x00, 0x01, 0x00, 0x88, 0x30, 0x28, 0x00,
+    0x02, 0x00, 0xBB, 0xBF, 0x30, 0x28, 0x00, 0x30, 0x28, 0x00, 0x03, 0x00, 0x81, 0x85, 0x88, 0x30,
+    0x28, 0x00, 0x30, 0x28, 0x00, 0x30, 0x28, 0x00, 0x01, 0x00, 0xBA, 0xB2, 0x28, 0x00, 0x02, 0x00,
+    0x81, 0x8C, 0x30, 0x28, 0x00, 0x30, 0x28, 0x00, 0x03, 0x00, 0x81, 0x84, 0x96, 0x30, 0x28, 0x00,
+    0x30, 0x28, 0x00, 0xB8, 0x28, 0x00, 0x02, 0x00, 0xB0, 0xB1, 0xBE, 0x28, 0x00, 0x30, 0x28, 0x00,
+    0x01, 0x00, 0xBC, 0xC8, 0x28, 0x00, 0x02, 0x00, 0xB5, 0xBE, 0xCE, 0x28, 0x00, 0xD8, 0x28, 0x00,
+    0x04, 0x00, 0x80, 0x81, 0x85, 0x96, 0xE2, 0x28, 0x00, 0x30, 0x28, 0x00, 0x30, 0x28, 0x00, 0xEA,
+    0x28, 0x00, 0x01, 0x00, 0xBE, 0xF0, 0x28, 0x00, 0x01, 0x00, 0x82, 0x30, 0x28, 0x00, 0x03, 0x00,
+    0xBA, 0xBB, 0xBF, 0xF6, 0x28, 0x00, 0x30, 0x28, 0x00, 0xFE, 0x28, 0x00, 0x02, 0x00, 0x82, 0x85,
+    0x30, 0x28, 0x00, 0xF6, 0x28, 0x00, 0x01, 0x00, 0xBA, 0x30, 0x28, 0x00, 0x03, 0x00, 0x80, 0x85,
+    0x8C, 0x30, 0x28, 0x00, 0x30, 0x28, 0x00, 0x30, 0x28, 0x00, 0x01, 0x00, 0xBC, 0x0E, 0x29, 0x00,
+    0x01, 0x00, 0xBB, 0x30, 0x28, 0x00, 0x01, 0x00, 0x8C, 0x30, 0x28, 0x00, 0x01, 0x00, 0xB5, 0x14,
+    0x29, 0x00, 0x01, 0x00, 0x85, 0x30, 0x28, 0x00, 0x03, 0x00, 0xBA, 0xBB, 0xBF, 0x30, 0x28, 0x00,
+    0x30, 0x28, 0x00, 0x30, 0x28, 0x00, 0x00, 0x02, 0x3E, 0x00, 0x02, 0x01, 0x95, 0x00, 0x2D, 0xD0,
+    0x06, 0x1A, 0x00, 0x1A, 0x29, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x20, 0x29, 0x00,
+    0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x26, 0x29, 0x00, 0x2C, 0x29, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x36, 0x29, 0x00, 0x3C, 0x29, 0x00, 0x02, 0x00, 0x2D, 0xD0,
+    0x06, 0x1A, 0x00, 0x42, 0x29, 0x00, 0x02, 0x01, 0x95, 0x00, 0x2D, 0xD1, 0x06, 0x1A, 0x00, 0x4C,
+    0x29, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x56, 0x29, 0x00, 0x02, 0x01, 0x96, 0x00,
+    0x2D, 0xD1, 0x06, 0x1A, 0x00, 0x5C, 0x29, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0x06, 0x1A, 0x00, 0x62,
+    0x29, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x70, 0x29, 0x00, 0x76, 0x29, 0x00,
+    0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x7C, 0x29, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A,
+    0x00, 0x82, 0x29, 0x00, 0x03, 0x01, 0x95, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x88, 0x29,
+    0x00, 0x92, 0x29, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x9C, 0x29, 0x00, 0xAA,
+    0x29, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0xB0, 0x29, 0x00, 0xBA, 0x29, 0x00,
+    0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0xC0, 0x29, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A,
+    0x00, 0xCA, 0x29, 0x00, 0x03, 0x01, 0x95, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0xD0, 0x29,
+    0x00, 0xDA, 0x29, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0xE0, 0x29, 0x00, 0x01, 0x01,
+    0x95, 0x00, 0x2D, 0x06, 0x1A, 0x00, 0x02, 0x01, 0x95, 0x00, 0x2D, 0xD1, 0x06, 0x1A, 0x00, 0xEA,
+    0x29, 0x00, 0x01, 0x00, 0x94, 0xF0, 0x29, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00,
+    0xF6, 0x29, 0x00, 0x04, 0x2A, 0x00, 0x01, 0x02, 0x41, 0x00, 0x2D, 0x06, 0x1A, 0x00, 0x02, 0x00,
+    0x2D, 0x2E, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x0E,
+    0x2A, 0x00, 0x03, 0x00, 0x2D, 0x2E, 0xD0, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x1C, 0x2A, 0x00,
+    0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x22, 0x2A, 0x00, 0x30,
+    0x2A, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x36, 0x2A, 0x00, 0x3C, 0x2A, 0x00,
+    0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x46, 0x2A, 0x00, 0x54,
+    0x2A, 0x00, 0x03, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x5E,
+    0x2A, 0x00, 0x02, 0x02, 0x41, 0x00, 0x2D, 0xD1, 0x06, 0x1A, 0x00, 0x30, 0x2A, 0x00, 0x02, 0x00,
+    0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x68, 0x2A, 0x00, 0x01, 0x00, 0x8F, 0x72, 0x2A, 0x00, 0x02, 0x00,
+    0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x78, 0x2A, 0x00, 0x03, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD0, 0x06,
+    0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x82, 0x2A, 0x00, 0x03, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD0, 0x06,
+    0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x8C, 0x2A, 0x00, 0x04, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD0, 0xD1,
+    0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x92, 0x2A, 0x00, 0x9C, 0x2A, 0x00, 0x03, 0x00, 0x2D, 0xD0,
+    0xD1, 0x06, 0x1A, 0x00, 0xA6, 0x2A, 0x00, 0xAC, 0x2A, 0x00, 0x03, 0x02, 0x41, 0x00, 0x2D, 0x2E,
+    0xD0, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0xB2, 0x2A, 0x00, 0x03, 0x02, 0x41, 0x00, 0x2D, 0x2E,
+    0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x30, 0x2A, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06,
+    0x1A, 0x00, 0xB8, 0x2A, 0x00, 0xC2, 0x2A, 0x00, 0x02, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0x06, 0x1A,
+    0x00, 0x0A, 0x2A, 0x00, 0x03, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD0, 0x06, 0x1A, 0x00, 0x0A, 0x2A,
+    0x00, 0xD0, 0x2A, 0x00, 0x04, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x0A,
+    0x2A, 0x00, 0xD6, 0x2A, 0x00, 0x30, 0x2A, 0x00, 0x03, 0x02, 0x41, 0x00, 0x27, 0x2D, 0x2E, 0xE0,
+    0x2A, 0x00, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00,
+    0xE6, 0x2A, 0x00, 0xF0, 0x2A, 0x00, 0x04, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A,
+    0x00, 0x0A, 0x2A, 0x00, 0xFA, 0x2A, 0x00, 0x08, 0x2B, 0x00, 0x03, 0x02, 0x41, 0x00, 0x2D, 0x2E,
+    0xD0, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x0E, 0x2B, 0x00, 0x03, 0x02, 0x41, 0x00, 0x2D, 0x2E,
+    0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x18, 0x2B, 0x00, 0x03, 0x02, 0x41, 0x00, 0x2D, 0x2E,
+    0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x26, 0x2B, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A,
+    0x00, 0x30, 0x2B, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x36, 0x2B, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x3C, 0x2B, 0x00, 0x4A, 0x2B, 0x00, 0x04, 0x00, 0x2D, 0x2E,
+    0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x50, 0x2B, 0x00, 0x5E, 0x2B, 0x00, 0x04, 0x00,
+    0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x6C, 0x2B, 0x00, 0x7A, 0x2B, 0x00,
+    0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x80, 0x2B, 0x00, 0x86, 0x2B, 0x00, 0x04, 0x00,
+    0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x90, 0x2B, 0x00, 0x9E, 0x2B, 0x00,
+    0x03, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0xA8, 0x2B, 0x00,
+    0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0xB2, 0x2B, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A,
+    0x00, 0xBC, 0x2B, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0xC2, 0x2B, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0xC8, 0x2B, 0x00, 0xD2, 0x2B, 0x00, 0x02, 0x02, 0x41, 0x00,
+    0x2D, 0xD1, 0x06, 0x1A, 0x00, 0xD8, 0x2B, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00,
+    0xDE, 0x2B, 0x00, 0xE4, 0x2B, 0x00, 0x03, 0x01, 0xAA, 0x00, 0x2D, 0x2E, 0xD0, 0x06, 0x1A, 0x00,
+    0x0A, 0x2A, 0x00, 0xEE, 0x2B, 0x00, 0x04, 0x01, 0xAA, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A,
+    0x00, 0x0A, 0x2A, 0x00, 0xF4, 0x2B, 0x00, 0x30, 0x2A, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0x06, 0x1A,
+    0x00, 0xFA, 0x2B, 0x00, 0x03, 0x00, 0x2D, 0x2E, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x00,
+    0x2C, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x06, 0x2C, 0x00, 0x1C, 0x2C, 0x00,
+    0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x2A, 0x2C, 0x00, 0x34,
+    0x2C, 0x00, 0x02, 0x02, 0x41, 0x00, 0x2D, 0xD1, 0x06, 0x1A, 0x00, 0x42, 0x2C, 0x00, 0x02, 0x00,
+    0x2D, 0xD1, 0x06, 0x1A, 0x00, 0x4C, 0x2C, 0x00, 0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A,
+    0x00, 0x0A, 0x2A, 0x00, 0x52, 0x2C, 0x00, 0x58, 0x2C, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06,
+    0x1A, 0x00, 0x66, 0x2C, 0x00, 0x74, 0x2C, 0x00, 0x02, 0x01, 0x95, 0x00, 0x2D, 0xD0, 0x06, 0x1A,
+    0x00, 0x7A, 0x2C, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x88, 0x2C, 0x00, 0x02, 0x00,
+    0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x92, 0x2C, 0x00, 0x03, 0x01, 0x95, 0x00, 0x2D, 0xD0, 0xD1, 0x06,
+    0x1A, 0x00, 0x98, 0x2C, 0x00, 0x9E, 0x2C, 0x00, 0x01, 0x01, 0x96, 0x00, 0x2D, 0x06, 0x1A, 0x00,
+    0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0xA8, 0x2C, 0x00, 0xAE, 0x2C, 0x00, 0x02, 0x00,
+    0x2D, 0xD0, 0x06, 0x1A, 0x00, 0xB4, 0x2C, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00,
+    0xBA, 0x2C, 0x00, 0xC0, 0x2C, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0xCA, 0x2C,
+    0x00, 0xD4, 0x2C, 0x00, 0x03, 0x01, 0x95, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0xDA, 0x2C,
+    0x00, 0xF0, 0x2C, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0x06, 0x1A, 0x00, 0x02, 0x2D, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x08, 0x2D, 0x00, 0x0E, 0x2D, 0x00, 0x03, 0x01, 0x95, 0x00,
+    0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x14, 0x2D, 0x00, 0x1E, 0x2D, 0x00, 0x02, 0x01, 0x95, 0x00,
+    0x2D, 0xD1, 0x06, 0x1A, 0x00, 0x24, 0x2D, 0x00, 0x03, 0x00, 0x2D, 0x2E, 0xD0, 0x06, 0x1A, 0x00,
+    0x0A, 0x2A, 0x00, 0x2A, 0x2D, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0x06, 0x1A, 0x00, 0x30, 0x2A, 0x00,
+    0x02, 0x02, 0x41, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x30, 0x2D, 0x00, 0x02, 0x00, 0x2D, 0xD1,
+    0x06, 0x1A, 0x00, 0x36, 0x2D, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x3C, 0x2D, 0x00,
+    0x02, 0x00, 0x8F, 0x94, 0x42, 0x2D, 0x00, 0x4C, 0x2D, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06,
+    0x1A, 0x00, 0x52, 0x2D, 0x00, 0x70, 0x2D, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00,
+    0x82, 0x2D, 0x00, 0x88, 0x2D, 0x00, 0x05, 0x00, 0x27, 0x2D, 0x2E, 0xD0, 0xD1, 0x92, 0x2D, 0x00,
+    0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x98, 0x2D, 0x00, 0xAA, 0x2D, 0x00, 0x03, 0x00, 0x2D, 0x2E,
+    0xD0, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0xB4, 0x2D, 0x00, 0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1,
+    0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0xBA, 0x2D, 0x00, 0xCC, 0x2D, 0x00, 0x02, 0x00, 0x2D, 0xD0,
+    0x06, 0x1A, 0x00, 0xD6, 0x2D, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0xDC, 0x2D, 0x00,
+    0x04, 0x00, 0x27, 0x2D, 0x2E, 0xD1, 0xE0, 0x2A, 0x00, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0xE2,
+    0x2D, 0x00, 0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0xE8, 0x2D,
+    0x00, 0xF2, 0x2D, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0xFC, 0x2D, 0x00, 0x04, 0x00,
+    0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x06, 0x2E, 0x00, 0x0C, 0x2E, 0x00,
+    0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x30, 0x2B, 0x00, 0x16, 0x2E, 0x00, 0x02, 0x02,
+    0x41, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x1C, 0x2E, 0x00, 0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1,
+    0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x22, 0x2E, 0x00, 0x2C, 0x2E, 0x00, 0x02, 0x00, 0x2D, 0xD0,
+    0x06, 0x1A, 0x00, 0x36, 0x2E, 0x00, 0x02, 0x01, 0x95, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x40,
+    0x2E, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x26, 0x29, 0x00, 0x03, 0x01, 0x95, 0x00,
+    0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x98, 0x2C, 0x00, 0x46, 0x2E, 0x00, 0x03, 0x01, 0x96, 0x00,
+    0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x4C, 0x2E, 0x00, 0x52, 0x2E, 0x00, 0x02, 0x01, 0x95, 0x00,
+    0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x58, 0x2E, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0x06, 0x1A, 0x00, 0x5E,
+    0x2E, 0x00, 0x03, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD0, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x64,
+    0x2E, 0x00, 0x04, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00,
+    0x6A, 0x2E, 0x00, 0x7C, 0x2E, 0x00, 0x03, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD1, 0x06, 0x1A, 0x00,
+    0x0A, 0x2A, 0x00, 0x8A, 0x2E, 0x00, 0x02, 0x02, 0xAB, 0x00, 0x2D, 0xD1, 0x06, 0x1A, 0x00, 0x90,
+    0x2E, 0x00, 0x03, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x96,
+    0x2E, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0xA0, 0x2E, 0x00, 0x03, 0x02, 0x41, 0x00,
+    0x2D, 0x2E, 0xD0, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0xA6, 0x2E, 0x00, 0x02, 0x00, 0x2D, 0xD0,
+    0x06, 0x1A, 0x00, 0xB0, 0x2E, 0x00, 0x03, 0x00, 0x2D, 0x2E, 0xD0, 0x06, 0x1A, 0x00, 0x0A, 0x2A,
+    0x00, 0xBE, 0x2E, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0x06, 0x1A, 0x00, 0xC8, 0x2E, 0x00, 0x03, 0x00,
+    0x2D, 0x2E, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x30, 0x2A, 0x00, 0x03, 0x00, 0x2D, 0xD0,
+    0xD1, 0x06, 0x1A, 0x00, 0xCE, 0x2E, 0x00, 0xD8, 0x2E, 0x00, 0x03, 0x00, 0x2D, 0x2E, 0xD0, 0x06,
+    0x1A, 0x00, 0x0A, 0x2A, 0x00, 0xE2, 0x2E, 0x00, 0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A,
+    0x00, 0x0A, 0x2A, 0x00, 0xE8, 0x2E, 0x00, 0xEE, 0x2E, 0x00, 0x03, 0x00, 0x2D, 0x2E, 0xD1, 0x06,
+    0x1A, 0x00, 0x0A, 0x2A, 0x00, 0xF8, 0x2E, 0x00, 0x03, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD1, 0x06,
+    0x1A, 0x00, 0x0A, 0x2A, 0x00, 0xFE, 0x2E, 0x00, 0x02, 0x02, 0x41, 0x00, 0x2D, 0xD0, 0x06, 0x1A,
+    0x00, 0x10, 0x2F, 0x00, 0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00,
+    0x16, 0x2F, 0x00, 0x44, 0x2F, 0x00, 0x01, 0x00, 0x8F, 0x6A, 0x2F, 0x00, 0x02, 0x00, 0x2D, 0xD0,
+    0x06, 0x1A, 0x00, 0x74, 0x2F, 0x00, 0x04, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A,
+    0x00, 0x0A, 0x2A, 0x00, 0x7A, 0x2F, 0x00, 0xF8, 0x2E, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0x06, 0x1A,
+    0x00, 0x80, 0x2F, 0x00, 0x03, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD0, 0x06, 0x1A, 0x00, 0x0A, 0x2A,
+    0x00, 0x86, 0x2F, 0x00, 0x03, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD0, 0x06, 0x1A, 0x00, 0x0A, 0x2A,
+    0x00, 0x8C, 0x2F, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x92, 0x2F, 0x00, 0x03, 0x02,
+    0x41, 0x00, 0x2D, 0x2E, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x9C, 0x2F, 0x00, 0x03, 0x02,
+    0x41, 0x00, 0x2D, 0x2E, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0xA2, 0x2F, 0x00, 0x02, 0x02,
+    0x41, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0xAC, 0x2F, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A,
+    0x00, 0xB2, 0x2F, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0xC0, 0x2F, 0x00, 0xE2,
+    0x2F, 0x00, 0x04, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00,
+    0xF0, 0x2F, 0x00, 0xF6, 0x2F, 0x00, 0x04, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A,
+    0x00, 0x0A, 0x2A, 0x00, 0x00, 0x30, 0x00, 0xF8, 0x2E, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06,
+    0x1A, 0x00, 0x0E, 0x30, 0x00, 0x28, 0x30, 0x00, 0x03, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD1, 0x06,
+    0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x3A, 0x30, 0x00, 0x03, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD1, 0x06,
+    0x1A, 0x00, 0x0A, 0x2A, 0x00, 0xD8, 0x2B, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x44,
+    0x30, 0x00, 0x04, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00,
+    0x4E, 0x30, 0x00, 0x54, 0x30, 0x00, 0x04, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A,
+    0x00, 0x0A, 0x2A, 0x00, 0x5E, 0x30, 0x00, 0x68, 0x30, 0x00, 0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1,
+    0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x76, 0x30, 0x00, 0x94, 0x30, 0x00, 0x02, 0x00, 0x2D, 0xD1,
+    0x06, 0x1A, 0x00, 0xAE, 0x30, 0x00, 0x03, 0x01, 0x95, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00,
+    0xB8, 0x30, 0x00, 0xCA, 0x30, 0x00, 0x04, 0x00, 0x27, 0x2D, 0xD0, 0xD1, 0xD0, 0x30, 0x00, 0x06,
+    0x1A, 0x00, 0xD8, 0x30, 0x00, 0xF2, 0x30, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00,
+    0x88, 0x2C, 0x00, 0xFC, 0x30, 0x00, 0x04, 0x00, 0x27, 0x2D, 0xD0, 0xD1, 0x02, 0x31, 0x00, 0x06,
+    0x1A, 0x00, 0x06, 0x31, 0x00, 0x0C, 0x31, 0x00, 0x03, 0x01, 0x95, 0x00, 0x2D, 0xD0, 0xD1, 0x06,
+    0x1A, 0x00, 0x12, 0x31, 0x00, 0x9E, 0x2C, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x1C,
+    0x31, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0x06, 0x1A, 0x00, 0x26, 0x31, 0x00, 0x02, 0x00, 0x2D, 0xD0,
+    0x06, 0x1A, 0x00, 0x2C, 0x31, 0x00, 0x03, 0x01, 0x95, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00,
+    0x36, 0x31, 0x00, 0x48, 0x31, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x56, 0x31,
+    0x00, 0x60, 0x31, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x6A, 0x31, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x74, 0x31, 0x00, 0x7A, 0x31, 0x00, 0x03, 0x01, 0x95, 0x00,
+    0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x80, 0x31, 0x00, 0x8E, 0x31, 0x00, 0x02, 0x00, 0x2D, 0xD0,
+    0x06, 0x1A, 0x00, 0x94, 0x31, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x9A, 0x31, 0x00,
+    0x03, 0x01, 0x95, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0xA0, 0x31, 0x00, 0x24, 0x2D, 0x00,
+    0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0xA6, 0x31, 0x00, 0xB0, 0x31, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0xB6, 0x31, 0x00, 0xBC, 0x31, 0x00, 0x03, 0x00, 0x2D, 0xD0,
+    0xD1, 0x06, 0x1A, 0x00, 0xC2, 0x31, 0x00, 0xE4, 0x31, 0x00, 0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1,
+    0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x02, 0x32, 0x00, 0x10, 0x32, 0x00, 0x04, 0x00, 0x2D, 0x2E,
+    0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x16, 0x32, 0x00, 0x24, 0x32, 0x00, 0x02, 0x00,
+    0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x32, 0x32, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x40,
+    0x32, 0x00, 0x04, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00,
+    0x4A, 0x32, 0x00, 0x9C, 0x2F, 0x00, 0x04, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A,
+    0x00, 0x0A, 0x2A, 0x00, 0x50, 0x32, 0x00, 0x30, 0x2A, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A,
+    0x00, 0x5A, 0x32, 0x00, 0x04, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x0A,
+    0x2A, 0x00, 0x60, 0x32, 0x00, 0x30, 0x2A, 0x00, 0x03, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD1, 0x06,
+    0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x66, 0x32, 0x00, 0x03, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD0, 0x06,
+    0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x26, 0x29, 0x00, 0x03, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD1, 0x06,
+    0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x6C, 0x32, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x76,
+    0x32, 0x00, 0x03, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x7C,
+    0x32, 0x00, 0x04, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00,
+    0x10, 0x2F, 0x00, 0x9C, 0x2A, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x8A, 0x32, 0x00,
+    0x03, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x90, 0x32, 0x00,
+    0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x52, 0x2C, 0x00, 0x96,
+    0x32, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x9C, 0x32, 0x00, 0x02, 0x00, 0x2D, 0xD0,
+    0x06, 0x1A, 0x00, 0xA6, 0x32, 0x00, 0x03, 0x02, 0x41, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00,
+    0xAC, 0x32, 0x00, 0xB2, 0x32, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0x06, 0x1A, 0x00, 0xB8, 0x32, 0x00,
+    0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0xC2, 0x32, 0x00, 0xD0,
+    0x32, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0x06, 0x1A, 0x00, 0xDA, 0x32, 0x00, 0x04, 0x00, 0x2D, 0x2E,
+    0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0xE4, 0x32, 0x00, 0x02, 0x33, 0x00, 0x03, 0x02,
+    0x41, 0x00, 0x2D, 0x2E, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x1C, 0x33, 0x00, 0x04, 0x00,
+    0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x22, 0x33, 0x00, 0x48, 0x33, 0x00,
+    0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x6E, 0x33, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A,
+    0x00, 0x78, 0x33, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x7E, 0x33, 0x00, 0x88,
+    0x33, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0x06, 0x1A, 0x00, 0x8E, 0x33, 0x00, 0x03, 0x00, 0x2D, 0x2E,
+    0xD0, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x94, 0x33, 0x00, 0x03, 0x00, 0x2D, 0x2E, 0xD1, 0x06,
+    0x1A, 0x00, 0x0A, 0x2A, 0x00, 0xA6, 0x33, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00,
+    0xAC, 0x33, 0x00, 0xB2, 0x33, 0x00, 0x02, 0x02, 0x41, 0x00, 0x2D, 0xD1, 0x06, 0x1A, 0x00, 0xA6,
+    0x33, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0xB8, 0x33, 0x00, 0x02, 0x00, 0x2D, 0xD1,
+    0x06, 0x1A, 0x00, 0xC2, 0x33, 0x00, 0x03, 0x00, 0x2D, 0x2E, 0xD0, 0x06, 0x1A, 0x00, 0x0A, 0x2A,
+    0x00, 0xC8, 0x33, 0x00, 0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00,
+    0xCE, 0x33, 0x00, 0xD8, 0x33, 0x00, 0x03, 0x02, 0x41, 0x00, 0x2D, 0x2E, 0xD1, 0x06, 0x1A, 0x00,
+    0x0A, 0x2A, 0x00, 0xE2, 0x33, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0x06, 0x1A, 0x00, 0xEC, 0x33, 0x00,
+    0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0xF2, 0x33, 0x00, 0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1,
+    0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0xF8, 0x33, 0x00, 0x90, 0x32, 0x00, 0x03, 0x00, 0x27, 0x2D,
+    0xD0, 0xE0, 0x2A, 0x00, 0x06, 0x1A, 0x00, 0x02, 0x34, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A,
+    0x00, 0x08, 0x34, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x0E, 0x34, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x14, 0x34, 0x00, 0x1E, 0x34, 0x00, 0x02, 0x00, 0x2D, 0xD1,
+    0x06, 0x1A, 0x00, 0x24, 0x34, 0x00, 0x04, 0x00, 0x27, 0x2D, 0xD0, 0xD1, 0xE0, 0x2A, 0x00, 0x06,
+    0x1A, 0x00, 0x2A, 0x34, 0x00, 0x30, 0x34, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00,
+    0x36, 0x34, 0x00, 0x3C, 0x34, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x42, 0x34,
+    0x00, 0x50, 0x34, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x56, 0x34, 0x00, 0x5C,
+    0x34, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x66, 0x34, 0x00, 0x6C, 0x34, 0x00,
+    0x02, 0x01, 0x95, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x72, 0x34, 0x00, 0x02, 0x01, 0x95, 0x00,
+    0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x78, 0x34, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0x06, 0x1A, 0x00, 0x7E,
+    0x34, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0xE8, 0x2E, 0x00, 0x84, 0x34, 0x00,
+    0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x8E, 0x34, 0x00, 0x03, 0x00, 0x2D, 0x2E, 0xD0, 0x06,
+    0x1A, 0x00, 0x0A, 0x2A, 0x00, 0x94, 0x34, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00,
+    0x58, 0x2E, 0x00, 0x9A, 0x34, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0x06, 0x1A, 0x00, 0xA0, 0x34, 0x00,
+    0x03, 0x00, 0x2D, 0x2E, 0xD0, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00, 0xAA, 0x34, 0x00, 0x02, 0x00,
+    0x2D, 0xD0, 0x06, 0x1A, 0x00, 0xB0, 0x34, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0xB6,
+    0x34, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x10, 0x2F, 0x00, 0x02, 0x00, 0x2D, 0xD0,
+    0x06, 0x1A, 0x00, 0xBC, 0x34, 0x00, 0x03, 0x00, 0x2D, 0x2E, 0xD0, 0x06, 0x1A, 0x00, 0x0A, 0x2A,
+    0x00, 0x4E, 0x30, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0x06, 0x1A, 0x00, 0xC2, 0x34, 0x00, 0x02, 0x00,
+    0x2D, 0xD0, 0x06, 0x1A, 0x00, 0xC8, 0x34, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00,
+    0xCE, 0x34, 0x00, 0xD4, 0x34, 0x00, 0x03, 0x00, 0x2D, 0x2E, 0xD0, 0x06, 0x1A, 0x00, 0x0A, 0x2A,
+    0x00, 0x64, 0x2E, 0x00, 0x04, 0x00, 0x2D, 0x2E, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x0A, 0x2A, 0x00,
+    0xDA, 0x34, 0x00, 0xE8, 0x34, 0x00, 0x01, 0x01, 0x43, 0x00, 0x2D, 0x06, 0x1A, 0x00, 0x02, 0x00,
+    0x2D, 0xD0, 0x06, 0x1A, 0x00, 0xF2, 0x34, 0x00, 0x02, 0x01, 0x95, 0x00, 0x2D, 0xD0, 0x06, 0x1A,
+    0x00, 0x98, 0x2C, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0xF8, 0x34, 0x00, 0x02, 0x00,
+    0x2D, 0xD1, 0x06, 0x1A, 0x00, 0xFE, 0x34, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0x06, 0x1A, 0x00, 0x04,
+    0x35, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x0A, 0x35, 0x00, 0x02, 0x00, 0x2D, 0xD1,
+    0x06, 0x1A, 0x00, 0xEA, 0x29, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0x06, 0x1A, 0x00, 0x14, 0x35, 0x00,
+    0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x1A, 0x35, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A,
+    0x00, 0x20, 0x35, 0x00, 0x03, 0x00, 0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x2A, 0x35, 0x00, 0x30,
+    0x35, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x36, 0x35, 0x00, 0x02, 0x01, 0x95, 0x00,
+    0x2D, 0xD1, 0x06, 0x1A, 0x00, 0x3C, 0x35, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x42,
+    0x35, 0x00, 0x02, 0x01, 0x96, 0x00, 0x2D, 0xD1, 0x06, 0x1A, 0x00, 0x52, 0x2E, 0x00, 0x03, 0x00,
+    0x2D, 0xD0, 0xD1, 0x06, 0x1A, 0x00, 0x48, 0x35, 0x00, 0x4E, 0x35, 0x00, 0x02, 0x00, 0x2D, 0xD0,
+    0x06, 0x1A, 0x00, 0x54, 0x35, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0x06, 0x1A, 0x00, 0x5A, 0x35, 0x00,
+    0x02, 0x01, 0x95, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x68, 0x35, 0x00, 0x02, 0x00, 0x2D, 0xD0,
+    0x06, 0x1A, 0x00, 0x72, 0x35, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x78, 0x35, 0x00,
+    0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x7E, 0x35, 0x00, 0x02, 0x00, 0x2D, 0xD1, 0x06, 0x1A,
+    0x00, 0x84, 0x35, 0x00, 0x02, 0x00, 0x2D, 0xD0, 0x06, 0x1A, 0x00, 0x8A, 0x35, 0x00, 0x02, 0x00,
+    0x2D, 0xD1, 0x06, 0x1A, 0x00, 0x90, 0x35, 0x00, 0x00, 0x01, 0x3D, 0x00, 0x00, 0x02, 0x08, 0x00,
+    0x00, 0x01, 0x12, 0x00, 0x01, 0x00, 0xD0, 0x96, 0x35, 0x00, 0x01, 0x00, 0xD1, 0x9C, 0x35, 0x00,
+    0x01, 0x01, 0x12, 0x00, 0x27, 0xA2, 0x35, 0x00, 0x01, 0x00, 0x27, 0xA2, 0x35, 0x00, 0x01, 0x01,
+    0x12, 0x00, 0xD0, 0xA6, 0x35, 0x00, 0x01, 0x00, 0xD0, 0xAC, 0x35, 0x00, 0x02, 0x01, 0x12, 0x00,
+    0x27, 0xD1, 0xA2, 0x35, 0x00, 0xB6, 0x35, 0x00, 0x01, 0x01, 0x12, 0x00, 0xD1, 0xBC, 0x35, 0x00,
+    0x01, 0x00, 0xD0, 0xC2, 0x35, 0x00, 0x01, 0x00, 0xD0, 0xC8, 0x35, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xCE, 0x35, 0x00, 0xD4, 0x35, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xDA, 0x35, 0x00, 0xE4, 0x35, 0x00,
+    0x01, 0x01, 0x12, 0x00, 0xD0, 0xEA, 0x35, 0x00, 0x02, 0x01, 0x12, 0x00, 0xD0, 0xD1, 0xC2, 0x35,
+    0x00, 0xBC, 0x35, 0x00, 0x01, 0x01, 0x12, 0x00, 0xD0, 0xC2, 0x35, 0x00, 0x01, 0x00, 0xD0, 0xF0,
+    0x35, 0x00, 0x01, 0x00, 0xD1, 0xF6, 0x35, 0x00, 0x01, 0x00, 0xD0, 0xFC, 0x35, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x02, 0x36, 0x00, 0x10, 0x36, 0x00, 0x01, 0x00, 0xD1, 0x16, 0x36, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x1C, 0x36, 0x00, 0x22, 0x36, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x28, 0x36, 0x00, 0x36,
+    0x36, 0x00, 0x01, 0x01, 0x12, 0x00, 0xD0, 0x3C, 0x36, 0x00, 0x01, 0x00, 0xD0, 0x42, 0x36, 0x00,
+    0x01, 0x00, 0xD0, 0x4C, 0x36, 0x00, 0x01, 0x01, 0x12, 0x00, 0xD0, 0x52, 0x36, 0x00, 0x03, 0x01,
+    0x12, 0x00, 0x27, 0xD0, 0xD1, 0xA2, 0x35, 0x00, 0x52, 0x36, 0x00, 0x58, 0x36, 0x00, 0x01, 0x00,
+    0xD1, 0x62, 0x36, 0x00, 0x01, 0x00, 0xD1, 0x68, 0x36, 0x00, 0x01, 0x00, 0xB4, 0x6E, 0x36, 0x00,
+    0x01, 0x00, 0xB8, 0x74, 0x36, 0x00, 0x01, 0x00, 0xBE, 0x7A, 0x36, 0x00, 0x02, 0x00, 0x82, 0x96,
+    0x80, 0x36, 0x00, 0x86, 0x36, 0x00, 0x01, 0x00, 0xB5, 0x8C, 0x36, 0x00, 0x01, 0x00, 0x80, 0x92,
+    0x36, 0x00, 0x02, 0x00, 0xB5, 0xB8, 0x98, 0x36, 0x00, 0x9E, 0x36, 0x00, 0x02, 0x00, 0x82, 0x84,
+    0xA4, 0x36, 0x00, 0xAA, 0x36, 0x00, 0x01, 0x00, 0xB0, 0xB0, 0x36, 0x00, 0x01, 0x00, 0x81, 0xB6,
+    0x36, 0x00, 0x03, 0x00, 0x82, 0x83, 0x86, 0xBC, 0x36, 0x00, 0xC6, 0x36, 0x00, 0xCC, 0x36, 0x00,
+    0x01, 0x00, 0xB5, 0xD2, 0x36, 0x00, 0x01, 0x00, 0x8C, 0xD8, 0x36, 0x00, 0x01, 0x00, 0xB0, 0xDE,
+    0x36, 0x00, 0x01, 0x00, 0xB0, 0xE4, 0x36, 0x00, 0x02, 0x00, 0xB1, 0xBF, 0xEE, 0x36, 0x00, 0xF4,
+    0x36, 0x00, 0x02, 0x00, 0x85, 0x89, 0xFE, 0x36, 0x00, 0x04, 0x37, 0x00, 0x03, 0x00, 0xB0, 0xB5,
+    0xBE, 0x0A, 0x37, 0x00, 0x10, 0x37, 0x00, 0x16, 0x37, 0x00, 0x01, 0x00, 0x82, 0x1C, 0x37, 0x00,
+    0x02, 0x00, 0xB3, 0xBE, 0x22, 0x37, 0x00, 0x28, 0x37, 0x00, 0x01, 0x00, 0x82, 0x2E, 0x37, 0x00,
+    0x02, 0x00, 0xBE, 0xBF, 0x38, 0x37, 0x00, 0x3E, 0x37, 0x00, 0x01, 0x00, 0xBB, 0x44, 0x37, 0x00,
+    0x02, 0x00, 0xB3, 0xB4, 0x4A, 0x37, 0x00, 0x50, 0x37, 0x00, 0x01, 0x00, 0x82, 0x5A, 0x37, 0x00,
+    0x02, 0x00, 0xB0, 0xBE, 0x60, 0x37, 0x00, 0x7A, 0x36, 0x00, 0x01, 0x00, 0x81, 0x66, 0x37, 0x00,
+    0x01, 0x00, 0xD1, 0x6C, 0x37, 0x00, 0x03, 0x00, 0xB3, 0xBA, 0xBB, 0x72, 0x37, 0x00, 0x78, 0x37,
+    0x00, 0x82, 0x37, 0x00, 0x01, 0x00, 0x81, 0x8C, 0x37, 0x00, 0x00, 0x01, 0x3A, 0x00, 0x03, 0x00,
+    0xB7, 0xB9, 0xBA, 0x92, 0x37, 0x00, 0x9C, 0x37, 0x00, 0xA2, 0x37, 0x00, 0x01, 0x00, 0xBE, 0xA8,
+    0x37, 0x00, 0x03, 0x00, 0xB0, 0xB8, 0xBE, 0xAE, 0x37, 0x00, 0xB4, 0x37, 0x00, 0xBE, 0x37, 0x00,
+    0x01, 0x00, 0x8C, 0xC8, 0x37, 0x00, 0x01, 0x00, 0xB3, 0xCE, 0x37, 0x00, 0x02, 0x00, 0x80, 0x94,
+    0xD4, 0x37, 0x00, 0xDE, 0x37, 0x00, 0x03, 0x00, 0xB0, 0xB5, 0xB8, 0xE4, 0x37, 0x00, 0xEE, 0x37,
+    0x00, 0xF4, 0x37, 0x00, 0x02, 0x00, 0x83, 0x96, 0xFE, 0x37, 0x00, 0x04, 0x38, 0x00, 0x02, 0x00,
+    0x82, 0x8C, 0x0A, 0x38, 0x00, 0x18, 0x38, 0x00, 0x02, 0x00, 0xB1, 0xBE, 0x1E, 0x38, 0x00, 0x24,
+    0x38, 0x00, 0x01, 0x00, 0xD0, 0x28, 0x38, 0x00, 0x02, 0x00, 0xBB, 0xBD, 0x2E, 0x38, 0x00, 0x34,
+    0x38, 0x00, 0x02, 0x00, 0xB8, 0xBB, 0x3A, 0x38, 0x00, 0x40, 0x38, 0x00, 0x01, 0x00, 0xB5, 0x46,
+    0x38, 0x00, 0x02, 0x00, 0xB0, 0xBE, 0x4C, 0x38, 0x00, 0x52, 0x38, 0x00, 0x02, 0x00, 0x80, 0x8C,
+    0xC8, 0x37, 0x00, 0xC8, 0x37, 0x00, 0x01, 0x00, 0xBB, 0x58, 0x38, 0x00, 0x01, 0x00, 0x80, 0x5E,
+    0x38, 0x00, 0x01, 0x00, 0xB8, 0x64, 0x38, 0x00, 0x02, 0x00, 0xB9, 0xBD, 0x6A, 0x38, 0x00, 0x74,
+    0x38, 0x00, 0x03, 0x00, 0x83, 0x8F, 0x97, 0x7A, 0x38, 0x00, 0x84, 0x38, 0x00, 0x8E, 0x38, 0x00,
+    0x01, 0x00, 0xBB, 0x92, 0x38, 0x00, 0x02, 0x00, 0xB0, 0xBE, 0x98, 0x38, 0x00, 0x3A, 0x38, 0x00,
+    0x01, 0x00, 0xD1, 0xA2, 0x38, 0x00, 0x02, 0x00, 0xB4, 0xBB, 0xA8, 0x38, 0x00, 0xAE, 0x38, 0x00,
+    0x02, 0x00, 0x81, 0x94, 0xB4, 0x38, 0x00, 0xBE, 0x38, 0x00, 0x03, 0x00, 0xB5, 0xBB, 0xBE, 0xC4,
+    0x38, 0x00, 0xCA, 0x38, 0x00, 0xD0, 0x38, 0x00, 0x01, 0x00, 0x80, 0xD6, 0x38, 0x00, 0x02, 0x00,
+    0xB0, 0xBE, 0xDC, 0x38, 0x00, 0xE2, 0x38, 0x00, 0x03, 0x00, 0x82, 0x8C, 0x8E, 0xE8, 0x38, 0x00,
+    0xF2, 0x38, 0x00, 0xFC, 0x38, 0x00, 0x02, 0x00, 0x80, 0x96, 0x02, 0x39, 0x00, 0x4C, 0x38, 0x00,
+    0x01, 0x00, 0xB4, 0x08, 0x39, 0x00, 0x01, 0x00, 0xB4, 0x0E, 0x39, 0x00, 0x03, 0x00, 0xBB, 0xBD,
+    0xBE, 0x18, 0x39, 0x00, 0x1E, 0x39, 0x00, 0x24, 0x39, 0x00, 0x01, 0x00, 0x82, 0x28, 0x39, 0x00,
+    0x03, 0x00, 0xB0, 0xB8, 0xBE, 0xFE, 0x37, 0x00, 0x2E, 0x39, 0x00, 0x34, 0x39, 0x00, 0x03, 0x00,
+    0x83, 0x8C, 0x8F, 0x3A, 0x39, 0x00, 0xC8, 0x37, 0x00, 0x44, 0x39, 0x00, 0x03, 0x00, 0xB0, 0xB8,
+    0xBE, 0x4A, 0x39, 0x00, 0x50, 0x39, 0x00, 0x56, 0x39, 0x00, 0x01, 0x00, 0x83, 0x5C, 0x39, 0x00,
+    0x01, 0x00, 0xBC, 0x62, 0x39, 0x00, 0x02, 0x00, 0x81, 0x84, 0x68, 0x39, 0x00, 0x6E, 0x39, 0x00,
+    0x03, 0x00, 0xB0, 0xB5, 0xBE, 0x74, 0x39, 0x00, 0x7E, 0x39, 0x00, 0x84, 0x39, 0x00, 0x02, 0x00,
+    0x83, 0x96, 0x8E, 0x39, 0x00, 0x94, 0x39, 0x00, 0x02, 0x00, 0x82, 0x8C, 0x9E, 0x39, 0x00, 0xC8,
+    0x37, 0x00, 0x02, 0x00, 0xB4, 0xBF, 0xA4, 0x39, 0x00, 0xAA, 0x39, 0x00, 0x01, 0x00, 0xBD, 0xB0,
+    0x39, 0x00, 0x01, 0x00, 0xB0, 0xB4, 0x39, 0x00, 0x02, 0x00, 0xB8, 0xBE, 0xBE, 0x39, 0x00, 0xC4,
+    0x39, 0x00, 0x01, 0x00, 0x96, 0xCA, 0x39, 0x00, 0x01, 0x00, 0x8F, 0xD4, 0x39, 0x00, 0x01, 0x00,
+    0xBA, 0xD8, 0x39, 0x00, 0x02, 0x00, 0x80, 0x8F, 0xDE, 0x39, 0x00, 0xE4, 0x39, 0x00, 0x01, 0x00,
+    0xB5, 0xEA, 0x39, 0x00, 0x01, 0x00, 0xB5, 0xF0, 0x39, 0x00, 0x01, 0x00, 0x81, 0xF6, 0x39, 0x00,
+    0x01, 0x00, 0x96, 0x00, 0x3A, 0x00, 0x05, 0x00, 0xB2, 0xB7, 0xB9, 0xBA, 0xBE, 0x06, 0x3A, 0x00,
+    0x0C, 0x3A, 0x00, 0x12, 0x3A, 0x00, 0x6E, 0x39, 0x00, 0x18, 0x3A, 0x00, 0x03, 0x00, 0x80, 0x83,
+    0x97, 0x1E, 0x3A, 0x00, 0x24, 0x3A, 0x00, 0x2A, 0x3A, 0x00, 0x02, 0x00, 0xB0, 0xBE, 0xAE, 0x37,
+    0x00, 0x34, 0x3A, 0x00, 0x03, 0x00, 0x83, 0x8F, 0x96, 0x3A, 0x3A, 0x00, 0x40, 0x3A, 0x00, 0x46,
+    0x3A, 0x00, 0x02, 0x00, 0x82, 0x8C, 0x9E, 0x39, 0x00, 0x18, 0x38, 0x00, 0x01, 0x00, 0x81, 0x4C,
+    0x3A, 0x00, 0x01, 0x00, 0xBA, 0x52, 0x3A, 0x00, 0x03, 0x00, 0x81, 0x82, 0x86, 0x56, 0x3A, 0x00,
+    0x52, 0x3A, 0x00, 0x52, 0x3A, 0x00, 0x03, 0x00, 0xB0, 0xB9, 0xBE, 0x5E, 0x3A, 0x00, 0x64, 0x3A,
+    0x00, 0x6E, 0x3A, 0x00, 0x01, 0x00, 0x94, 0x76, 0x3A, 0x00, 0x03, 0x00, 0xB2, 0xB4, 0xBA, 0x7C,
+    0x3A, 0x00, 0x6E, 0x36, 0x00, 0x82, 0x3A, 0x00, 0x02, 0x00, 0xB8, 0xBA, 0x88, 0x3A, 0x00, 0x8E,
+    0x3A, 0x00, 0x01, 0x00, 0xBE, 0x88, 0x3A, 0x00, 0x01, 0x00, 0xBC, 0x94, 0x3A, 0x00, 0x02, 0x00,
+    0x81, 0x84, 0x9A, 0x3A, 0x00, 0xAA, 0x36, 0x00, 0x01, 0x00, 0xBE, 0xA0, 0x3A, 0x00, 0x01, 0x00,
+    0x81, 0xA6, 0x3A, 0x00, 0x01, 0x00, 0xB5, 0xB0, 0x3A, 0x00, 0x01, 0x00, 0xBE, 0x38, 0x37, 0x00,
+    0x02, 0x00, 0x80, 0x96, 0xB6, 0x3A, 0x00, 0xBC, 0x3A, 0x00, 0x02, 0x00, 0xB0, 0xB5, 0x88, 0x3A,
+    0x00, 0xC2, 0x3A, 0x00, 0x01, 0x00, 0x8C, 0xC8, 0x3A, 0x00, 0x05, 0x00, 0xB1, 0xB3, 0xB7, 0xBA,
+    0xBF, 0xCE, 0x3A, 0x00, 0xD4, 0x3A, 0x00, 0xDA, 0x3A, 0x00, 0xE0, 0x3A, 0x00, 0xE6, 0x3A, 0x00,
+    0x04, 0x00, 0x81, 0x85, 0x86, 0x89, 0xEC, 0x3A, 0x00, 0xFE, 0x36, 0x00, 0xF2, 0x3A, 0x00, 0x04,
+    0x37, 0x00, 0x01, 0x00, 0x82, 0xF8, 0x3A, 0x00, 0x01, 0x00, 0xB0, 0xFE, 0x3A, 0x00, 0x01, 0x00,
+    0x96, 0x04, 0x3B, 0x00, 0x02, 0x00, 0xB1, 0xB3, 0x0A, 0x3B, 0x00, 0x4A, 0x37, 0x00, 0x01, 0x00,
+    0x81, 0x10, 0x3B, 0x00, 0x01, 0x00, 0x81, 0x16, 0x3B, 0x00, 0x01, 0x00, 0xB0, 0x1C, 0x3B, 0x00,
+    0x01, 0x00, 0xBE, 0x22, 0x3B, 0x00, 0x01, 0x00, 0x96, 0x28, 0x3B, 0x00, 0x01, 0x00, 0xBD, 0x2E,
+    0x3B, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x34, 0x3B, 0x00, 0x3A, 0x3B, 0x00, 0x01, 0x00, 0xD0, 0x40,
+    0x3B, 0x00, 0x07, 0x00, 0xB2, 0xB9, 0xBA, 0xBC, 0xBD, 0xBE, 0xBF, 0x46, 0x3B, 0x00, 0x50, 0x3B,
+    0x00, 0x56, 0x3B, 0x00, 0x5C, 0x3B, 0x00, 0x62, 0x3B, 0x00, 0x18, 0x3A, 0x00, 0x68, 0x3B, 0x00,
+    0x04, 0x00, 0x83, 0x8E, 0x8F, 0x97, 0x6E, 0x3B, 0x00, 0x74, 0x3B, 0x00, 0x7A, 0x3B, 0x00, 0x80,
+    0x3B, 0x00, 0x01, 0x00, 0xB0, 0x8A, 0x3B, 0x00, 0x02, 0x00, 0x80, 0x83, 0x90, 0x3B, 0x00, 0x96,
+    0x3B, 0x00, 0x01, 0x00, 0xD1, 0xA0, 0x3B, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE, 0xA6, 0x3B,
+    0x00, 0xAC, 0x3B, 0x00, 0xB6, 0x3B, 0x00, 0xBC, 0x3B, 0x00, 0x02, 0x00, 0x83, 0x96, 0xC2, 0x3B,
+    0x00, 0xCC, 0x3B, 0x00, 0x01, 0x00, 0xBE, 0xFC, 0x38, 0x00, 0x04, 0x00, 0xB0, 0xB2, 0xBD, 0xBE,
+    0xD2, 0x3B, 0x00, 0xC8, 0x37, 0x00, 0xC8, 0x37, 0x00, 0xD8, 0x3B, 0x00, 0x02, 0x00, 0x8C, 0x96,
+    0xC8, 0x37, 0x00, 0xE2, 0x3B, 0x00, 0x01, 0x00, 0xBA, 0xE8, 0x3B, 0x00, 0x01, 0x00, 0xBE, 0x34,
+    0x3A, 0x00, 0x01, 0x00, 0x96, 0xEE, 0x3B, 0x00, 0x02, 0x00, 0xB0, 0xB8, 0xF8, 0x3B, 0x00, 0xAE,
+    0x37, 0x00, 0x02, 0x00, 0x8C, 0x96, 0xC8, 0x37, 0x00, 0x34, 0x3A, 0x00, 0x02, 0x00, 0xBA, 0xBE,
+    0x02, 0x3C, 0x00, 0x0C, 0x3C, 0x00, 0x01, 0x00, 0xBE, 0x10, 0x3C, 0x00, 0x02, 0x00, 0x8E, 0x96,
+    0x1C, 0x3B, 0x00, 0x16, 0x3C, 0x00, 0x01, 0x00, 0x80, 0x1C, 0x3C, 0x00, 0x01, 0x00, 0xB5, 0xFE,
+    0x3A, 0x00, 0x02, 0x00, 0xB1, 0xBA, 0xC8, 0x37, 0x00, 0x22, 0x3C, 0x00, 0x02, 0x00, 0x81, 0x82,
+    0x52, 0x3A, 0x00, 0x52, 0x3A, 0x00, 0x02, 0x00, 0xB2, 0xBC, 0x2A, 0x3C, 0x00, 0x5C, 0x3B, 0x00,
+    0x01, 0x00, 0xB2, 0x7C, 0x3A, 0x00, 0x01, 0x00, 0x81, 0x9A, 0x3A, 0x00, 0x01, 0x00, 0xBD, 0x30,
+    0x3C, 0x00, 0x01, 0x00, 0x82, 0x36, 0x3C, 0x00, 0x01, 0x00, 0xBA, 0xE0, 0x3A, 0x00, 0x01, 0x00,
+    0x81, 0x3C, 0x3C, 0x00, 0x01, 0x00, 0xBB, 0xC8, 0x37, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE,
+    0xB0, 0x39, 0x00, 0x42, 0x3C, 0x00, 0x48, 0x3C, 0x00, 0x4E, 0x3C, 0x00, 0x03, 0x00, 0x81, 0x83,
+    0x96, 0xC8, 0x37, 0x00, 0x54, 0x3C, 0x00, 0x5E, 0x3C, 0x00, 0x01, 0x00, 0x81, 0xC8, 0x37, 0x00,
+    0x01, 0x00, 0x81, 0xEC, 0x3A, 0x00, 0x02, 0x00, 0x82, 0x8C, 0x0A, 0x38, 0x00, 0xF2, 0x38, 0x00,
+    0x01, 0x00, 0xB1, 0x64, 0x3C, 0x00, 0x02, 0x00, 0xBB, 0xBE, 0x6A, 0x3C, 0x00, 0x3A, 0x38, 0x00,
+    0x03, 0x00, 0xB7, 0xBD, 0xBF, 0x6E, 0x3C, 0x00, 0x74, 0x3C, 0x00, 0x7A, 0x3C, 0x00, 0x02, 0x00,
+    0xB0, 0xBE, 0x80, 0x3C, 0x00, 0x7A, 0x36, 0x00, 0x01, 0x00, 0x97, 0x86, 0x3C, 0x00, 0x02, 0x00,
+    0xBC, 0xBD, 0x8C, 0x3C, 0x00, 0x92, 0x3C, 0x00, 0x02, 0x00, 0x80, 0x83, 0x98, 0x3C, 0x00, 0x9E,
+    0x3C, 0x00, 0x01, 0x00, 0xB0, 0xA4, 0x3C, 0x00, 0x01, 0x00, 0xBF, 0xAA, 0x3C, 0x00, 0x02, 0x00,
+    0x82, 0x8C, 0xAE, 0x3C, 0x00, 0xB6, 0x3C, 0x00, 0x01, 0x00, 0x80, 0xC8, 0x37, 0x00, 0x04, 0x00,
+    0x8C, 0x8E, 0x8F, 0x94, 0xC8, 0x37, 0x00, 0xD4, 0x39, 0x00, 0xD4, 0x39, 0x00, 0xD4, 0x39, 0x00,
+    0x01, 0x00, 0xB2, 0xC8, 0x37, 0x00, 0x0B, 0x00, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xB7, 0xB9, 0xBA,
+    0xBC, 0xBD, 0xBF, 0x22, 0x3C, 0x00, 0x22, 0x3C, 0x00, 0x22, 0x3C, 0x00, 0xC0, 0x3C, 0x00, 0x52,
+    0x3A, 0x00, 0x22, 0x3C, 0x00, 0x52, 0x3A, 0x00, 0x22, 0x3C, 0x00, 0x22, 0x3C, 0x00, 0x22, 0x3C,
+    0x00, 0x22, 0x3C, 0x00, 0x09, 0x00, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x52,
+    0x3A, 0x00, 0xCC, 0x3C, 0x00, 0xD8, 0x3C, 0x00, 0x22, 0x3C, 0x00, 0x22, 0x3C, 0x00, 0x22, 0x3C,
+    0x00, 0x22, 0x3C, 0x00, 0x22, 0x3C, 0x00, 0x22, 0x3C, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xE4, 0x3C,
+    0x00, 0xEA, 0x3C, 0x00, 0x01, 0x00, 0xBD, 0x62, 0x3B, 0x00, 0x01, 0x00, 0xBB, 0xF0, 0x3C, 0x00,
+    0x01, 0x00, 0x82, 0x62, 0x39, 0x00, 0x01, 0x00, 0xBD, 0xF6, 0x3C, 0x00, 0x01, 0x00, 0xBE, 0x00,
+    0x3D, 0x00, 0x02, 0x00, 0xBA, 0xBD, 0x06, 0x3D, 0x00, 0x2E, 0x3B, 0x00, 0x01, 0x00, 0x96, 0x5E,
+    0x3C, 0x00, 0x02, 0x00, 0x82, 0x8C, 0x9E, 0x39, 0x00, 0xF2, 0x38, 0x00, 0x01, 0x00, 0xB5, 0x0C,
+    0x3D, 0x00, 0x03, 0x00, 0xB6, 0xBD, 0xBE, 0x12, 0x3D, 0x00, 0x1C, 0x3D, 0x00, 0x24, 0x39, 0x00,
+    0x08, 0x00, 0xB1, 0xB2, 0xB4, 0xB7, 0xB9, 0xBC, 0xBE, 0xBF, 0x22, 0x3D, 0x00, 0x28, 0x3D, 0x00,
+    0x32, 0x3D, 0x00, 0x40, 0x3D, 0x00, 0x46, 0x3D, 0x00, 0x5C, 0x3B, 0x00, 0x50, 0x3D, 0x00, 0x56,
+    0x3D, 0x00, 0x03, 0x00, 0x83, 0x8F, 0x97, 0x6E, 0x3B, 0x00, 0x60, 0x3D, 0x00, 0x66, 0x3D, 0x00,
+    0x01, 0x00, 0xBB, 0x70, 0x3D, 0x00, 0x02, 0x00, 0x80, 0x81, 0xC8, 0x37, 0x00, 0xC8, 0x37, 0x00,
+    0x03, 0x00, 0xB6, 0xB7, 0xBF, 0xC8, 0x37, 0x00, 0xC8, 0x37, 0x00, 0xC8, 0x37, 0x00, 0x06, 0x00,
+    0xB0, 0xB2, 0xB4, 0xB7, 0xBE, 0xBF, 0x7A, 0x3D, 0x00, 0x80, 0x3D, 0x00, 0x86, 0x3D, 0x00, 0x8C,
+    0x3D, 0x00, 0x92, 0x3D, 0x00, 0x9C, 0x3D, 0x00, 0x04, 0x00, 0x83, 0x8E, 0x8F, 0x97, 0xA2, 0x3D,
+    0x00, 0xAC, 0x3D, 0x00, 0xB2, 0x3D, 0x00, 0xBC, 0x3D, 0x00, 0x02, 0x00, 0x81, 0x82, 0xC8, 0x37,
+    0x00, 0xC8, 0x37, 0x00, 0x02, 0x00, 0xBA, 0xBC, 0xC2, 0x3D, 0x00, 0x5C, 0x3B, 0x00, 0x01, 0x00,
+    0xBA, 0xC8, 0x37, 0x00, 0x02, 0x00, 0x82, 0x8C, 0x0A, 0x38, 0x00, 0xC8, 0x3D, 0x00, 0x02, 0x00,
+    0xB0, 0xBA, 0xCE, 0x3D, 0x00, 0xC8, 0x37, 0x00, 0x03, 0x00, 0x80, 0x81, 0x8C, 0xC8, 0x37, 0x00,
+    0xD4, 0x3D, 0x00, 0xC8, 0x37, 0x00, 0x07, 0x00, 0xB1, 0xB3, 0xB7, 0xB9, 0xBA, 0xBB, 0xBC, 0x22,
+    0x3C, 0x00, 0x22, 0x3C, 0x00, 0x52, 0x3A, 0x00, 0x52, 0x3A, 0x00, 0x22, 0x3C, 0x00, 0x52, 0x3A,
+    0x00, 0x52, 0x3A, 0x00, 0x06, 0x00, 0x81, 0x82, 0x85, 0x86, 0x87, 0x88, 0x56, 0x3A, 0x00, 0x52,
+    0x3A, 0x00, 0x52, 0x3A, 0x00, 0x52, 0x3A, 0x00, 0x52, 0x3A, 0x00, 0x52, 0x3A, 0x00, 0x02, 0x00,
+    0x82, 0x8F, 0xDA, 0x3D, 0x00, 0xE4, 0x39, 0x00, 0x04, 0x00, 0xB2, 0xB4, 0xBA, 0xBD, 0x7C, 0x3A,
+    0x00, 0x6E, 0x36, 0x00, 0xE0, 0x3D, 0x00, 0xEA, 0x3D, 0x00, 0x01, 0x00, 0x82, 0xF0, 0x3D, 0x00,
+    0x01, 0x01, 0xFC, 0x00, 0xD1, 0xF6, 0x3D, 0x00, 0x06, 0x00, 0xB2, 0xB5, 0xB8, 0xBB, 0xBC, 0xBE,
+    0x5C, 0x3B, 0x00, 0xFC, 0x3D, 0x00, 0x02, 0x3E, 0x00, 0x08, 0x3E, 0x00, 0x5C, 0x3B, 0x00, 0x0E,
+    0x3E, 0x00, 0x02, 0x00, 0x83, 0x96, 0x18, 0x3E, 0x00, 0x1E, 0x3E, 0x00, 0x01, 0x00, 0x96, 0x28,
+    0x3E, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x01, 0x00, 0xB0, 0x2E, 0x3E, 0x00, 0x01, 0x00, 0x8F, 0x34,
+    0x3E, 0x00, 0x02, 0x00, 0xBA, 0xBC, 0x3A, 0x3E, 0x00, 0x94, 0x3A, 0x00, 0x02, 0x00, 0xB0, 0xB1,
+    0x88, 0x3A, 0x00, 0x40, 0x3E, 0x00, 0x01, 0x00, 0x80, 0x46, 0x3E, 0x00, 0x02, 0x00, 0xB0, 0xBE,
+    0x7A, 0x36, 0x00, 0x7A, 0x36, 0x00, 0x04, 0x00, 0xB1, 0xB4, 0xBA, 0xBF, 0x4C, 0x3E, 0x00, 0x5C,
+    0x3E, 0x00, 0x62, 0x3E, 0x00, 0xE6, 0x3A, 0x00, 0x03, 0x00, 0x81, 0x86, 0x87, 0xEC, 0x3A, 0x00,
+    0xF2, 0x3A, 0x00, 0x6E, 0x3E, 0x00, 0x02, 0x00, 0xB5, 0xBB, 0x0A, 0x37, 0x00, 0x74, 0x3E, 0x00,
+    0x02, 0x00, 0x82, 0x83, 0x7A, 0x3E, 0x00, 0x80, 0x3E, 0x00, 0x02, 0x00, 0xB4, 0xB5, 0x86, 0x3E,
+    0x00, 0x8C, 0x3E, 0x00, 0x01, 0x00, 0xBE, 0x92, 0x3E, 0x00, 0x01, 0x00, 0x8F, 0x98, 0x3E, 0x00,
+    0x03, 0x00, 0xB3, 0xB4, 0xBA, 0x4A, 0x37, 0x00, 0x08, 0x39, 0x00, 0xF0, 0x3D, 0x00, 0x01, 0x00,
+    0x81, 0x9E, 0x3E, 0x00, 0x01, 0x00, 0xBE, 0xA6, 0x3E, 0x00, 0x01, 0x00, 0xB8, 0xB0, 0x3E, 0x00,
+    0x01, 0x00, 0xB7, 0xB6, 0x3E, 0x00, 0x02, 0x00, 0xBB, 0xBD, 0x62, 0x39, 0x00, 0xBC, 0x3E, 0x00,
+    0x01, 0x00, 0x80, 0xC2, 0x3E, 0x00, 0x01, 0x00, 0xB4, 0xC8, 0x3E, 0x00, 0x01, 0x00, 0x80, 0xCE,
+    0x3E, 0x00, 0x08, 0x00, 0xB1, 0xB2, 0xB4, 0xB6, 0xB7, 0xBB, 0xBC, 0xBE, 0xD4, 0x3E, 0x00, 0xDA,
+    0x3E, 0x00, 0xE4, 0x3E, 0x00, 0xEE, 0x3E, 0x00, 0xF4, 0x3E, 0x00, 0xFA, 0x3E, 0x00, 0x5C, 0x3B,
+    0x00, 0x18, 0x3A, 0x00, 0x07, 0x00, 0x80, 0x81, 0x83, 0x87, 0x88, 0x8F, 0x97, 0x00, 0x3F, 0x00,
+    0x06, 0x3F, 0x00, 0x9E, 0x3C, 0x00, 0x0C, 0x3F, 0x00, 0x12, 0x3F, 0x00, 0x18, 0x3F, 0x00, 0x22,
+    0x3F, 0x00, 0x03, 0x00, 0xB5, 0xB8, 0xBE, 0x28, 0x3F, 0x00, 0x30, 0x3F, 0x00, 0x3C, 0x3F, 0x00,
+    0x01, 0x00, 0x96, 0xB0, 0x39, 0x00, 0x03, 0x00, 0xBA, 0xBE, 0xBF, 0x48, 0x3F, 0x00, 0x4E, 0x3F,
+    0x00, 0xAA, 0x3C, 0x00, 0x03, 0x00, 0x82, 0x83, 0x8C, 0x54, 0x3F, 0x00, 0x3A, 0x38, 0x00, 0xB6,
+    0x3C, 0x00, 0x03, 0x00, 0xB2, 0xB4, 0xB9, 0x5C, 0x3F, 0x00, 0x66, 0x3F, 0x00, 0x70, 0x3F, 0x00,
+    0x02, 0x00, 0xB4, 0xB9, 0x18, 0x39, 0x00, 0x76, 0x3F, 0x00, 0x01, 0x00, 0xB0, 0x7C, 0x3F, 0x00,
+    0x02, 0x00, 0xB2, 0xB6, 0xC8, 0x37, 0x00, 0xC8, 0x37, 0x00, 0x01, 0x00, 0xB0, 0xCE, 0x3D, 0x00,
+    0x01, 0x00, 0xBD, 0xC8, 0x37, 0x00, 0x01, 0x00, 0x8C, 0x86, 0x3F, 0x00, 0x02, 0x00, 0x81, 0x8C,
+    0x90, 0x3F, 0x00, 0xC8, 0x37, 0x00, 0x01, 0x00, 0xB7, 0x9A, 0x3F, 0x00, 0x03, 0x00, 0x80, 0x82,
+    0x8C, 0xC8, 0x37, 0x00, 0xA8, 0x3F, 0x00, 0xF2, 0x38, 0x00, 0x01, 0x00, 0xBA, 0xB6, 0x3F, 0x00,
+    0x01, 0x00, 0x81, 0xF0, 0x3C, 0x00, 0x01, 0x00, 0x86, 0x52, 0x3A, 0x00, 0x02, 0x00, 0xBC, 0xBD,
+    0xBC, 0x3F, 0x00, 0xC2, 0x3F, 0x00, 0x01, 0x00, 0xBE, 0xC8, 0x3F, 0x00, 0x01, 0x00, 0xBF, 0xC8,
+    0x37, 0x00, 0x01, 0x00, 0x80, 0xCE, 0x3F, 0x00, 0x02, 0x00, 0x80, 0x97, 0xD4, 0x3F, 0x00, 0xDA,
+    0x3F, 0x00, 0x03, 0x00, 0xB8, 0xBB, 0xBE, 0xFC, 0x38, 0x00, 0xE0, 0x3F, 0x00, 0xE6, 0x3F, 0x00,
+    0x02, 0x00, 0x80, 0x96, 0xF0, 0x3F, 0x00, 0xF6, 0x3F, 0x00, 0x02, 0x00, 0x80, 0x86, 0xFC, 0x3F,
+    0x00, 0x18, 0x39, 0x00, 0x07, 0x00, 0xB0, 0xB5, 0xB8, 0xBA, 0xBB, 0xBE, 0xBF, 0xFC, 0x38, 0x00,
+    0x02, 0x40, 0x00, 0x0C, 0x3D, 0x00, 0xAA, 0x3C, 0x00, 0x0C, 0x40, 0x00, 0x12, 0x40, 0x00, 0xAA,
+    0x3C, 0x00, 0x06, 0x00, 0x80, 0x81, 0x82, 0x85, 0x87, 0x96, 0x1C, 0x40, 0x00, 0xAA, 0x3C, 0x00,
+    0xAA, 0x3C, 0x00, 0xAA, 0x3C, 0x00, 0xAA, 0x3C, 0x00, 0x22, 0x40, 0x00, 0x01, 0x00, 0x8C, 0x2E,
+    0x40, 0x00, 0x09, 0x00, 0xB0, 0xB2, 0xB5, 0xB8, 0xB9, 0xBA, 0xBC, 0xBE, 0xBF, 0x34, 0x40, 0x00,
+    0x3E, 0x40, 0x00, 0x48, 0x40, 0x00, 0x52, 0x40, 0x00, 0xC8, 0x37, 0x00, 0xAA, 0x3C, 0x00, 0xC8,
+    0x37, 0x00, 0x5C, 0x40, 0x00, 0xAA, 0x3C, 0x00, 0x09, 0x00, 0x80, 0x81, 0x82, 0x83, 0x84, 0x86,
+    0x8C, 0x8F, 0x96, 0x66, 0x40, 0x00, 0x74, 0x40, 0x00, 0xAA, 0x3C, 0x00, 0xFE, 0x3A, 0x00, 0xAA,
+    0x3C, 0x00, 0xAA, 0x3C, 0x00, 0xC8, 0x37, 0x00, 0x34, 0x3E, 0x00, 0x7C, 0x40, 0x00, 0x02, 0x00,
+    0xBC, 0xBF, 0x5C, 0x3B, 0x00, 0x86, 0x40, 0x00, 0x01, 0x00, 0xB5, 0x8C, 0x40, 0x00, 0x02, 0x00,
+    0xB8, 0xBE, 0x4C, 0x38, 0x00, 0x3A, 0x38, 0x00, 0x01, 0x00, 0x96, 0xFC, 0x38, 0x00, 0x01, 0x00,
+    0x82, 0xAA, 0x3C, 0x00, 0x04, 0x00, 0xB1, 0xB4, 0xBA, 0xBC, 0x22, 0x3C, 0x00, 0x52, 0x3A, 0x00,
+    0x92, 0x40, 0x00, 0xC8, 0x37, 0x00, 0x01, 0x00, 0x82, 0xC8, 0x37, 0x00, 0x01, 0x00, 0xBE, 0xA0,
+    0x40, 0x00, 0x01, 0x00, 0x85, 0xAA, 0x40, 0x00, 0x02, 0x00, 0xB0, 0xBD, 0x0C, 0x3D, 0x00, 0xB0,
+    0x40, 0x00, 0x01, 0x00, 0x80, 0xB6, 0x40, 0x00, 0x01, 0x00, 0xB0, 0xBC, 0x40, 0x00, 0x02, 0x00,
+    0xBA, 0xBF, 0xAA, 0x3C, 0x00, 0xAA, 0x3C, 0x00, 0x02, 0x00, 0x82, 0x8C, 0x54, 0x3F, 0x00, 0xC2,
+    0x40, 0x00, 0x02, 0x00, 0x8E, 0x8F, 0xD4, 0x39, 0x00, 0xD4, 0x39, 0x00, 0x01, 0x00, 0x80, 0xC8,
+    0x40, 0x00, 0x01, 0x00, 0xBA, 0xAA, 0x3C, 0x00, 0x02, 0x00, 0xB1, 0xBC, 0x52, 0x3A, 0x00, 0xCE,
+    0x40, 0x00, 0x01, 0x00, 0xB0, 0xD8, 0x40, 0x00, 0x01, 0x00, 0xB0, 0x3A, 0x38, 0x00, 0x01, 0x00,
+    0xB3, 0xDE, 0x40, 0x00, 0x02, 0x00, 0xBB, 0xBE, 0xE4, 0x40, 0x00, 0xEA, 0x40, 0x00, 0x01, 0x00,
+    0x80, 0xF0, 0x40, 0x00, 0x01, 0x00, 0x8E, 0xFC, 0x40, 0x00, 0x01, 0x00, 0xB8, 0xD2, 0x3B, 0x00,
+    0x01, 0x00, 0x96, 0x4C, 0x38, 0x00, 0x01, 0x00, 0xB5, 0x02, 0x41, 0x00, 0x01, 0x00, 0x80, 0x08,
+    0x41, 0x00, 0x03, 0x00, 0xB0, 0xB1, 0xBE, 0xDC, 0x38, 0x00, 0x0E, 0x41, 0x00, 0x14, 0x41, 0x00,
+    0x01, 0x00, 0x8F, 0x1A, 0x41, 0x00, 0x01, 0x00, 0xBF, 0x20, 0x41, 0x00, 0x02, 0x00, 0x82, 0x83,
+    0x26, 0x41, 0x00, 0x2C, 0x41, 0x00, 0x01, 0x00, 0xB2, 0x32, 0x41, 0x00, 0x01, 0x00, 0x80, 0x38,
+    0x41, 0x00, 0x01, 0x00, 0xB2, 0x24, 0x39, 0x00, 0x01, 0x00, 0xB2, 0x06, 0x3A, 0x00, 0x01, 0x00,
+    0x80, 0x3E, 0x41, 0x00, 0x02, 0x00, 0x82, 0x8C, 0x54, 0x3F, 0x00, 0x2E, 0x40, 0x00, 0x01, 0x00,
+    0xB7, 0x18, 0x39, 0x00, 0x01, 0x00, 0xBE, 0x44, 0x41, 0x00, 0x01, 0x00, 0x80, 0x6E, 0x39, 0x00,
+    0x02, 0x00, 0x82, 0x8C, 0xAA, 0x3C, 0x00, 0x2E, 0x40, 0x00, 0x01, 0x00, 0xBE, 0xB0, 0x39, 0x00,
+    0x01, 0x00, 0xBC, 0x18, 0x39, 0x00, 0x01, 0x00, 0xBD, 0x4A, 0x41, 0x00, 0x01, 0x00, 0xBA, 0x50,
+    0x41, 0x00, 0x01, 0x00, 0x80, 0x56, 0x41, 0x00, 0x01, 0x00, 0xBF, 0x5C, 0x41, 0x00, 0x01, 0x00,
+    0xBE, 0x62, 0x41, 0x00, 0x01, 0x00, 0x96, 0x68, 0x41, 0x00, 0x03, 0x00, 0xB0, 0xB2, 0xBA, 0x72,
+    0x41, 0x00, 0xC8, 0x37, 0x00, 0xAA, 0x3C, 0x00, 0x02, 0x00, 0x81, 0x83, 0x78, 0x41, 0x00, 0x7E,
+    0x41, 0x00, 0x01, 0x00, 0xB5, 0x84, 0x41, 0x00, 0x01, 0x00, 0xB8, 0x8A, 0x41, 0x00, 0x01, 0x00,
+    0x96, 0x90, 0x41, 0x00, 0x01, 0x00, 0x83, 0x90, 0x41, 0x00, 0x02, 0x00, 0xBA, 0xBE, 0x96, 0x41,
+    0x00, 0x7A, 0x36, 0x00, 0x01, 0x00, 0x80, 0x9C, 0x41, 0x00, 0x01, 0x00, 0xB5, 0xA2, 0x41, 0x00,
+    0x02, 0x00, 0xB8, 0xBD, 0x0C, 0x3D, 0x00, 0xA8, 0x41, 0x00, 0x01, 0x00, 0xB8, 0xAC, 0x41, 0x00,
+    0x01, 0x00, 0x96, 0xB2, 0x41, 0x00, 0x01, 0x00, 0xB5, 0xB8, 0x41, 0x00, 0x01, 0x00, 0x82, 0xA4,
+    0x36, 0x00, 0x01, 0x00, 0xBE, 0xBE, 0x41, 0x00, 0x01, 0x00, 0xB5, 0xC4, 0x41, 0x00, 0x01, 0x00,
+    0x8E, 0xCA, 0x41, 0x00, 0x01, 0x00, 0xBE, 0xD0, 0x41, 0x00, 0x03, 0x00, 0x82, 0x84, 0x96, 0xD6,
+    0x41, 0x00, 0xDC, 0x41, 0x00, 0xE2, 0x41, 0x00, 0x02, 0x00, 0xBA, 0xBD, 0xE8, 0x41, 0x00, 0xEE,
+    0x41, 0x00, 0x01, 0x00, 0xBD, 0xF6, 0x41, 0x00, 0x01, 0x00, 0xB4, 0x00, 0x3D, 0x00, 0x01, 0x00,
+    0xB4, 0xB0, 0x39, 0x00, 0x01, 0x00, 0x82, 0xB0, 0x39, 0x00, 0x01, 0x00, 0xB0, 0x96, 0x3B, 0x00,
+    0x01, 0x00, 0x83, 0xFC, 0x41, 0x00, 0x01, 0x00, 0xB7, 0x02, 0x42, 0x00, 0x01, 0x00, 0x96, 0x12,
+    0x42, 0x00, 0x00, 0x02, 0x17, 0x00, 0x01, 0x00, 0xB4, 0x18, 0x42, 0x00, 0x02, 0x00, 0xB2, 0xBC,
+    0x1C, 0x42, 0x00, 0x22, 0x42, 0x00, 0x01, 0x00, 0x85, 0x18, 0x42, 0x00, 0x01, 0x00, 0x82, 0x18,
+    0x42, 0x00, 0x01, 0x00, 0xBA, 0x18, 0x42, 0x00, 0x01, 0x00, 0xB4, 0x28, 0x42, 0x00, 0x01, 0x00,
+    0xB2, 0x1C, 0x42, 0x00, 0x01, 0x00, 0x97, 0x38, 0x42, 0x00, 0x02, 0x00, 0xB2, 0xBC, 0x3E, 0x42,
+    0x00, 0x22, 0x42, 0x00, 0x01, 0x00, 0x97, 0x48, 0x42, 0x00, 0x01, 0x00, 0xB7, 0x18, 0x42, 0x00,
+    0x01, 0x00, 0xBC, 0x22, 0x42, 0x00, 0x01, 0x00, 0x81, 0x18, 0x42, 0x00, 0x01, 0x00, 0xB6, 0x52,
+    0x42, 0x00, 0x03, 0x00, 0xB2, 0xBC, 0xBF, 0x1C, 0x42, 0x00, 0x22, 0x42, 0x00, 0x56, 0x42, 0x00,
+    0x01, 0x00, 0x97, 0x5C, 0x42, 0x00, 0x01, 0x00, 0x80, 0x62, 0x42, 0x00, 0x01, 0x00, 0xBE, 0x68,
+    0x42, 0x00, 0x01, 0x00, 0x80, 0x6E, 0x42, 0x00, 0x03, 0x00, 0xB2, 0xBC, 0xBD, 0x1C, 0x42, 0x00,
+    0x22, 0x42, 0x00, 0x74, 0x42, 0x00, 0x01, 0x00, 0x97, 0x7A, 0x42, 0x00, 0x01, 0x00, 0xB8, 0x7E,
+    0x42, 0x00, 0x02, 0x00, 0xB2, 0xB4, 0x52, 0x42, 0x00, 0x84, 0x42, 0x00, 0x01, 0x00, 0xB7, 0x94,
+    0x42, 0x00, 0x01, 0x00, 0xBB, 0x18, 0x42, 0x00, 0x02, 0x00, 0x85, 0x96, 0x18, 0x42, 0x00, 0xA4,
+    0x42, 0x00, 0x01, 0x00, 0x80, 0xAA, 0x42, 0x00, 0x01, 0x00, 0x80, 0xB4, 0x42, 0x00, 0x01, 0x00,
+    0xD1, 0xBA, 0x42, 0x00, 0x01, 0x00, 0xD1, 0xC0, 0x42, 0x00, 0x01, 0x00, 0xD1, 0xC6, 0x42, 0x00,
+    0x01, 0x00, 0xD0, 0xCC, 0x42, 0x00, 0x01, 0x00, 0xD0, 0xD2, 0x42, 0x00, 0x01, 0x00, 0xD0, 0xD8,
+    0x42, 0x00, 0x01, 0x00, 0xD0, 0xDE, 0x42, 0x00, 0x01, 0x00, 0xD0, 0xE4, 0x42, 0x00, 0x01, 0x00,
+    0xD1, 0xEA, 0x42, 0x00, 0x01, 0x00, 0xD0, 0xF0, 0x42, 0x00, 0x01, 0x00, 0xD0, 0xF6, 0x42, 0x00,
+    0x01, 0x00, 0xD1, 0xFC, 0x42, 0x00, 0x01, 0x00, 0xD0, 0x02, 0x43, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x08, 0x43, 0x00, 0x0E, 0x43, 0x00, 0x01, 0x00, 0xD1, 0x14, 0x43, 0x00, 0x01, 0x00, 0xD0, 0x1E,
+    0x43, 0x00, 0x01, 0x00, 0xD1, 0x28, 0x43, 0x00, 0x01, 0x00, 0xD0, 0x2E, 0x43, 0x00, 0x01, 0x00,
+    0xD1, 0x34, 0x43, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x3A, 0x43, 0x00, 0x44, 0x43, 0x00, 0x01, 0x00,
+    0xD1, 0x4A, 0x43, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x50, 0x43, 0x00, 0x56, 0x43, 0x00, 0x01, 0x00,
+    0xD0, 0x5C, 0x43, 0x00, 0x01, 0x00, 0xD0, 0x66, 0x43, 0x00, 0x01, 0x00, 0xD1, 0x6C, 0x43, 0x00,
+    0x01, 0x00, 0xD0, 0x72, 0x43, 0x00, 0x01, 0x00, 0xD1, 0x78, 0x43, 0x00, 0x01, 0x00, 0xD0, 0x7E,
+    0x43, 0x00, 0x01, 0x00, 0xD1, 0x84, 0x43, 0x00, 0x01, 0x00, 0xD0, 0x8A, 0x43, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x90, 0x43, 0x00, 0xAE, 0x43, 0x00, 0x01, 0x00, 0xD1, 0xC4, 0x43, 0x00, 0x01, 0x00,
+    0xD0, 0xCA, 0x43, 0x00, 0x01, 0x00, 0xD0, 0xD0, 0x43, 0x00, 0x01, 0x00, 0xD0, 0xD6, 0x43, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0xDC, 0x43, 0x00, 0xE2, 0x43, 0x00, 0x01, 0x00, 0xD0, 0xE8, 0x43, 0x00,
+    0x01, 0x00, 0xD0, 0xEE, 0x43, 0x00, 0x01, 0x00, 0xD1, 0xF4, 0x43, 0x00, 0x01, 0x00, 0x82, 0xFA,
+    0x43, 0x00, 0x01, 0x00, 0xD0, 0x00, 0x44, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x06, 0x44, 0x00, 0x0C,
+    0x44, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x12, 0x44, 0x00, 0x18, 0x44, 0x00, 0x01, 0x00, 0xD0, 0x1E,
+    0x44, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x28, 0x44, 0x00, 0x36, 0x44, 0x00, 0x01, 0x00, 0xD1, 0x40,
+    0x44, 0x00, 0x01, 0x00, 0xD0, 0x46, 0x44, 0x00, 0x01, 0x00, 0xD1, 0x4C, 0x44, 0x00, 0x01, 0x00,
+    0xD0, 0x52, 0x44, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x58, 0x44, 0x00, 0x62, 0x44, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x68, 0x44, 0x00, 0x6E, 0x44, 0x00, 0x01, 0x00, 0x2E, 0x74, 0x44, 0x00, 0x01, 0x00,
+    0xD0, 0x78, 0x44, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x7E, 0x44, 0x00, 0x84, 0x44, 0x00, 0x01, 0x00,
+    0xD0, 0x8A, 0x44, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x9C, 0x44, 0x00, 0xA2, 0x44, 0x00, 0x01, 0x00,
+    0xD1, 0xA8, 0x44, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xAE, 0x44, 0x00, 0xB4, 0x44, 0x00, 0x01, 0x00,
+    0xD0, 0xBA, 0x44, 0x00, 0x01, 0x00, 0xD0, 0xC0, 0x44, 0x00, 0x03, 0x00, 0x2E, 0xD0, 0xD1, 0x74,
+    0x44, 0x00, 0xC6, 0x44, 0x00, 0xCC, 0x44, 0x00, 0x01, 0x00, 0xD0, 0xD2, 0x44, 0x00, 0x01, 0x00,
+    0xD0, 0xD8, 0x44, 0x00, 0x00, 0x02, 0x55, 0x00, 0x01, 0x00, 0xB7, 0xDE, 0x44, 0x00, 0x01, 0x00,
+    0xD1, 0xE2, 0x44, 0x00, 0x01, 0x00, 0xD1, 0xE8, 0x44, 0x00, 0x01, 0x00, 0xD0, 0xEE, 0x44, 0x00,
+    0x01, 0x00, 0xD0, 0xF4, 0x44, 0x00, 0x01, 0x00, 0xD0, 0xFA, 0x44, 0x00, 0x01, 0x00, 0xD0, 0x00,
+    0x45, 0x00, 0x01, 0x00, 0xD0, 0x06, 0x45, 0x00, 0x01, 0x00, 0xD1, 0x0C, 0x45, 0x00, 0x01, 0x00,
+    0xD1, 0x12, 0x45, 0x00, 0x01, 0x00, 0xD0, 0x18, 0x45, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x1E, 0x45,
+    0x00, 0x28, 0x45, 0x00, 0x01, 0x00, 0xD0, 0x2E, 0x45, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x34, 0x45,
+    0x00, 0x3A, 0x45, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x40, 0x45, 0x00, 0x46, 0x45, 0x00, 0x00, 0x01,
+    0x6E, 0x00, 0x01, 0x00, 0xD0, 0x4C, 0x45, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x7E, 0x35, 0x00, 0x52,
+    0x45, 0x00, 0x01, 0x00, 0x8F, 0x5C, 0x45, 0x00, 0x01, 0x00, 0xD0, 0x60, 0x45, 0x00, 0x01, 0x00,
+    0xD1, 0x66, 0x45, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x6C, 0x45, 0x00, 0x72, 0x45, 0x00, 0x01, 0x00,
+    0xD0, 0x78, 0x45, 0x00, 0x01, 0x00, 0xD0, 0x82, 0x45, 0x00, 0x01, 0x00, 0xD0, 0x88, 0x45, 0x00,
+    0x01, 0x00, 0xD1, 0x8E, 0x45, 0x00, 0x01, 0x00, 0xD0, 0x94, 0x45, 0x00, 0x01, 0x00, 0xD0, 0x9A,
+    0x45, 0x00, 0x01, 0x00, 0xD0, 0xA0, 0x45, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xC6, 0x44, 0x00, 0xAA,
+    0x45, 0x00, 0x02, 0x00, 0x2E, 0xD0, 0x74, 0x44, 0x00, 0xD2, 0x44, 0x00, 0x01, 0x00, 0xD0, 0x7E,
+    0x35, 0x00, 0x01, 0x00, 0xD1, 0xB0, 0x45, 0x00, 0x01, 0x00, 0xD0, 0xDC, 0x43, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0xB6, 0x45, 0x00, 0xC8, 0x45, 0x00, 0x01, 0x00, 0xD1, 0xE2, 0x43, 0x00, 0x01, 0x00,
+    0xD0, 0x06, 0x44, 0x00, 0x00, 0x01, 0x66, 0x00, 0x01, 0x00, 0xD1, 0xCE, 0x45, 0x00, 0x01, 0x00,
+    0xD0, 0xD4, 0x45, 0x00, 0x01, 0x00, 0xD0, 0xDE, 0x45, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xE4, 0x45,
+    0x00, 0xEA, 0x45, 0x00, 0x01, 0x00, 0xD0, 0xF0, 0x45, 0x00, 0x01, 0x00, 0xD0, 0xFA, 0x45, 0x00,
+    0x01, 0x00, 0xD0, 0x00, 0x46, 0x00, 0x01, 0x00, 0xD0, 0xE4, 0x45, 0x00, 0x01, 0x00, 0xD1, 0x06,
+    0x46, 0x00, 0x01, 0x00, 0xD0, 0x0C, 0x46, 0x00, 0x01, 0x00, 0xD0, 0x12, 0x46, 0x00, 0x01, 0x00,
+    0xD0, 0x18, 0x46, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x1E, 0x46, 0x00, 0x34, 0x46, 0x00, 0x01, 0x00,
+    0xD1, 0x4A, 0x46, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x54, 0x46, 0x00, 0x66, 0x46, 0x00, 0x01, 0x00,
+    0xD0, 0x6C, 0x46, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x7A, 0x46, 0x00, 0x80, 0x46, 0x00, 0x01, 0x00,
+    0xD0, 0xC6, 0x44, 0x00, 0x01, 0x00, 0xD1, 0x8A, 0x46, 0x00, 0x01, 0x00, 0xD0, 0x90, 0x46, 0x00,
+    0x00, 0x02, 0x46, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x96, 0x46, 0x00, 0xA4, 0x46, 0x00, 0x01, 0x00,
+    0xD0, 0xAE, 0x46, 0x00, 0x01, 0x00, 0xD1, 0xB4, 0x46, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xC2, 0x46,
+    0x00, 0xC8, 0x46, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0x00, 0xD1, 0xD2, 0x46, 0x00, 0x01, 0x00,
+    0xD0, 0xD8, 0x46, 0x00, 0x01, 0x00, 0xD0, 0xDE, 0x46, 0x00, 0x01, 0x00, 0xD0, 0xE4, 0x46, 0x00,
+    0x01, 0x00, 0xD0, 0xEA, 0x46, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xF0, 0x46, 0x00, 0x06, 0x47, 0x00,
+    0x01, 0x00, 0xD0, 0x10, 0x47, 0x00, 0x01, 0x00, 0x27, 0x16, 0x47, 0x00, 0x01, 0x00, 0xD0, 0x1C,
+    0x47, 0x00, 0x01, 0x00, 0xD0, 0x22, 0x47, 0x00, 0x01, 0x00, 0xD1, 0x28, 0x47, 0x00, 0x01, 0x00,
+    0xD0, 0x2E, 0x47, 0x00, 0x01, 0x00, 0xD0, 0x34, 0x47, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x3E, 0x47,
+    0x00, 0x4C, 0x47, 0x00, 0x01, 0x00, 0xD0, 0x56, 0x47, 0x00, 0x01, 0x00, 0xD0, 0x5C, 0x47, 0x00,
+    0x01, 0x00, 0xD0, 0x66, 0x47, 0x00, 0x01, 0x00, 0xD0, 0x6C, 0x47, 0x00, 0x01, 0x00, 0xD1, 0x76,
+    0x47, 0x00, 0x00, 0x02, 0x64, 0x00, 0x01, 0x02, 0x64, 0x00, 0xD1, 0xAA, 0x45, 0x00, 0x01, 0x00,
+    0xD0, 0x7C, 0x47, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x82, 0x47, 0x00, 0x28, 0x45, 0x00, 0x01, 0x01,
+    0x66, 0x00, 0xD0, 0x8C, 0x47, 0x00, 0x01, 0x00, 0xD0, 0x92, 0x47, 0x00, 0x01, 0x00, 0xD0, 0x98,
+    0x47, 0x00, 0x01, 0x00, 0xD1, 0x9E, 0x47, 0x00, 0x01, 0x00, 0xD0, 0xA4, 0x47, 0x00, 0x01, 0x00,
+    0xD0, 0xAA, 0x47, 0x00, 0x01, 0x00, 0xD1, 0xB0, 0x47, 0x00, 0x01, 0x00, 0xD1, 0xB6, 0x47, 0x00,
+    0x01, 0x00, 0xD0, 0xBC, 0x47, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xC6, 0x47, 0x00, 0xD0, 0x47, 0x00,
+    0x01, 0x00, 0xD0, 0xDA, 0x47, 0x00, 0x01, 0x00, 0xD1, 0xE8, 0x47, 0x00, 0x01, 0x00, 0xD0, 0xEE,
+    0x47, 0x00, 0x01, 0x00, 0xD1, 0xF4, 0x47, 0x00, 0x01, 0x00, 0xD0, 0xFA, 0x47, 0x00, 0x01, 0x00,
+    0xD1, 0x00, 0x48, 0x00, 0x01, 0x00, 0xD0, 0x0A, 0x48, 0x00, 0x01, 0x00, 0xD0, 0x10, 0x48, 0x00,
+    0x01, 0x00, 0xD0, 0x16, 0x48, 0x00, 0x01, 0x00, 0xD0, 0x1C, 0x48, 0x00, 0x01, 0x00, 0xD0, 0x2A,
+    0x48, 0x00, 0x01, 0x00, 0xD1, 0x30, 0x48, 0x00, 0x01, 0x00, 0xD0, 0x36, 0x48, 0x00, 0x01, 0x00,
+    0xD0, 0x40, 0x48, 0x00, 0x01, 0x00, 0xD0, 0x46, 0x48, 0x00, 0x01, 0x00, 0xD0, 0x4C, 0x48, 0x00,
+    0x01, 0x00, 0xD1, 0x52, 0x48, 0x00, 0x01, 0x00, 0xD1, 0x58, 0x48, 0x00, 0x01, 0x00, 0xD0, 0x7A,
+    0x46, 0x00, 0x01, 0x00, 0xD0, 0x5E, 0x48, 0x00, 0x01, 0x00, 0xD1, 0x64, 0x48, 0x00, 0x01, 0x00,
+    0xD0, 0x6A, 0x48, 0x00, 0x01, 0x00, 0xB2, 0x70, 0x48, 0x00, 0x01, 0x00, 0x81, 0x74, 0x48, 0x00,
+    0x01, 0x00, 0xB4, 0x7A, 0x48, 0x00, 0x02, 0x00, 0x27, 0xD0, 0x80, 0x48, 0x00, 0x92, 0x47, 0x00,
+    0x01, 0x00, 0xD0, 0x86, 0x48, 0x00, 0x01, 0x00, 0xD1, 0x90, 0x48, 0x00, 0x01, 0x00, 0x27, 0x96,
+    0x48, 0x00, 0x01, 0x00, 0xD0, 0x9C, 0x48, 0x00, 0x01, 0x00, 0xD1, 0xA2, 0x48, 0x00, 0x01, 0x00,
+    0xD1, 0x3A, 0x45, 0x00, 0x01, 0x00, 0xD1, 0xA8, 0x48, 0x00, 0x01, 0x00, 0xD0, 0xAE, 0x48, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0xB8, 0x48, 0x00, 0xCE, 0x48, 0x00, 0x01, 0x00, 0xD0, 0xD4, 0x48, 0x00,
+    0x01, 0x00, 0xD0, 0xDE, 0x48, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xEE, 0x44, 0x00, 0x84, 0x35, 0x00,
+    0x01, 0x00, 0x8F, 0xE4, 0x48, 0x00, 0x01, 0x00, 0xD0, 0xEC, 0x48, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xF6, 0x48, 0x00, 0xA8, 0x44, 0x00, 0x01, 0x00, 0xD1, 0x00, 0x49, 0x00, 0x01, 0x00, 0xD1, 0x0E,
+    0x49, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x14, 0x49, 0x00, 0x1A, 0x49, 0x00, 0x01, 0x00, 0xD1, 0x20,
+    0x49, 0x00, 0x01, 0x00, 0xD1, 0x84, 0x35, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x26, 0x49, 0x00, 0x2C,
+    0x49, 0x00, 0x01, 0x00, 0xD0, 0x32, 0x49, 0x00, 0x01, 0x00, 0xD0, 0x38, 0x49, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0xFA, 0x45, 0x00, 0xEA, 0x45, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x3E, 0x49, 0x00, 0x54,
+    0x49, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x6A, 0x49, 0x00, 0x78, 0x49, 0x00, 0x00, 0x01, 0xDB, 0x00,
+    0x01, 0x00, 0xD0, 0x82, 0x49, 0x00, 0x01, 0x00, 0xD0, 0x88, 0x49, 0x00, 0x01, 0x00, 0xD0, 0x96,
+    0x49, 0x00, 0x01, 0x02, 0x64, 0x00, 0x2E, 0x74, 0x44, 0x00, 0x01, 0x00, 0x27, 0x80, 0x48, 0x00,
+    0x01, 0x00, 0xD1, 0x9C, 0x49, 0x00, 0x01, 0x00, 0xD0, 0xA2, 0x49, 0x00, 0x01, 0x00, 0xD1, 0xA8,
+    0x49, 0x00, 0x01, 0x00, 0xD0, 0xAE, 0x49, 0x00, 0x01, 0x00, 0xD1, 0xB4, 0x49, 0x00, 0x01, 0x00,
+    0xD0, 0xBA, 0x49, 0x00, 0x02, 0x00, 0x2E, 0xD1, 0xB0, 0x39, 0x00, 0xC0, 0x49, 0x00, 0x01, 0x00,
+    0xD1, 0xC0, 0x49, 0x00, 0x01, 0x00, 0xD0, 0xC6, 0x49, 0x00, 0x00, 0x03, 0x61, 0x00, 0x01, 0x00,
+    0xD0, 0xCC, 0x49, 0x00, 0x01, 0x00, 0xD0, 0xD2, 0x49, 0x00, 0x01, 0x00, 0xD0, 0xD8, 0x49, 0x00,
+    0x01, 0x00, 0xD1, 0xDE, 0x49, 0x00, 0x01, 0x00, 0xD0, 0xE4, 0x49, 0x00, 0x01, 0x00, 0xD1, 0xEA,
+    0x49, 0x00, 0x01, 0x00, 0xD1, 0xF0, 0x49, 0x00, 0x01, 0x00, 0xD0, 0xFA, 0x49, 0x00, 0x01, 0x00,
+    0xD1, 0x00, 0x4A, 0x00, 0x01, 0x00, 0xD0, 0x06, 0x4A, 0x00, 0x00, 0x02, 0x41, 0x00, 0x01, 0x02,
+    0x41, 0x00, 0x2E, 0x74, 0x44, 0x00, 0x02, 0x00, 0x2E, 0xD0, 0x74, 0x44, 0x00, 0xF2, 0x33, 0x00,
+    0x02, 0x02, 0x64, 0x00, 0x2E, 0xD1, 0x74, 0x44, 0x00, 0x0C, 0x4A, 0x00, 0x02, 0x02, 0x64, 0x00,
+    0x2E, 0xD1, 0x74, 0x44, 0x00, 0x12, 0x4A, 0x00, 0x02, 0x02, 0x64, 0x00, 0x2E, 0xD1, 0x74, 0x44,
+    0x00, 0xCC, 0x44, 0x00, 0x01, 0x00, 0xBA, 0x1C, 0x4A, 0x00, 0x01, 0x00, 0x82, 0xDE, 0x44, 0x00,
+    0x01, 0x00, 0xD1, 0xAA, 0x45, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x22, 0x4A, 0x00, 0x28, 0x4A, 0x00,
+    0x01, 0x00, 0xD0, 0x32, 0x4A, 0x00, 0x01, 0x00, 0xD1, 0x38, 0x4A, 0x00, 0x01, 0x00, 0xD0, 0xBC,
+    0x2B, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x3E, 0x4A, 0x00, 0x44, 0x4A, 0x00, 0x01, 0x00, 0xD0, 0x4A,
+    0x4A, 0x00, 0x01, 0x00, 0xD0, 0x50, 0x4A, 0x00, 0x02, 0x00, 0x27, 0xD1, 0x56, 0x4A, 0x00, 0x5C,
+    0x4A, 0x00, 0x03, 0x00, 0x27, 0xD0, 0xD1, 0x66, 0x4A, 0x00, 0x6A, 0x4A, 0x00, 0x78, 0x4A, 0x00,
+    0x01, 0x00, 0xD0, 0x82, 0x4A, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x88, 0x4A, 0x00, 0x9E, 0x4A, 0x00,
+    0x01, 0x00, 0xD1, 0xB0, 0x4A, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xB6, 0x4A, 0x00, 0xC0, 0x4A, 0x00,
+    0x01, 0x00, 0xD0, 0x40, 0x45, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xC6, 0x4A, 0x00, 0xDC, 0x4A, 0x00,
+    0x02, 0x00, 0x2E, 0xD1, 0x74, 0x44, 0x00, 0xAA, 0x45, 0x00, 0x01, 0x00, 0xD0, 0xE6, 0x4A, 0x00,
+    0x01, 0x00, 0xD1, 0xEC, 0x4A, 0x00, 0x01, 0x00, 0xD0, 0xF6, 0x4A, 0x00, 0x01, 0x00, 0xD0, 0x00,
+    0x4B, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x06, 0x4B, 0x00, 0x1C, 0x4B, 0x00, 0x01, 0x00, 0xD0, 0x22,
+    0x4B, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xDE, 0x46, 0x00, 0x3A, 0x45, 0x00, 0x01, 0x00, 0xD0, 0x28,
+    0x4B, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xDE, 0x46, 0x00, 0x2E, 0x4B, 0x00, 0x01, 0x00, 0xD1, 0x38,
+    0x4B, 0x00, 0x01, 0x00, 0xD0, 0x3E, 0x4B, 0x00, 0x01, 0x00, 0xD0, 0x44, 0x4B, 0x00, 0x01, 0x00,
+    0xD0, 0x4A, 0x4B, 0x00, 0x01, 0x00, 0xD1, 0x50, 0x4B, 0x00, 0x01, 0x00, 0xD1, 0x56, 0x4B, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x5C, 0x4B, 0x00, 0x9E, 0x47, 0x00, 0x01, 0x00, 0xD0, 0x62, 0x4B, 0x00,
+    0x01, 0x00, 0xD0, 0x68, 0x4B, 0x00, 0x01, 0x00, 0x94, 0x6E, 0x4B, 0x00, 0x01, 0x00, 0xD1, 0x74,
+    0x4B, 0x00, 0x01, 0x00, 0xD1, 0x7A, 0x4B, 0x00, 0x01, 0x00, 0xD0, 0x80, 0x4B, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x8A, 0x4B, 0x00, 0x90, 0x4B, 0x00, 0x01, 0x00, 0xD0, 0x96, 0x4B, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x9C, 0x4B, 0x00, 0xAA, 0x4B, 0x00, 0x01, 0x00, 0xD0, 0xB0, 0x4B, 0x00, 0x01, 0x00,
+    0xD0, 0xB6, 0x4B, 0x00, 0x01, 0x00, 0xD0, 0xBC, 0x4B, 0x00, 0x01, 0x00, 0xD0, 0xC2, 0x4B, 0x00,
+    0x01, 0x00, 0xD1, 0xC8, 0x4B, 0x00, 0x01, 0x00, 0xD0, 0xCE, 0x4B, 0x00, 0x03, 0x01, 0x66, 0x00,
+    0x27, 0xD0, 0xD1, 0xD4, 0x4B, 0x00, 0xD8, 0x4B, 0x00, 0xDE, 0x4B, 0x00, 0x01, 0x00, 0xD0, 0xE8,
+    0x4B, 0x00, 0x02, 0x01, 0x66, 0x00, 0xD0, 0xD1, 0x16, 0x48, 0x00, 0xF2, 0x4B, 0x00, 0x01, 0x00,
+    0xD0, 0xF8, 0x4B, 0x00, 0x01, 0x00, 0xD0, 0xFE, 0x4B, 0x00, 0x01, 0x00, 0xD0, 0x04, 0x4C, 0x00,
+    0x01, 0x00, 0xD1, 0x0A, 0x4C, 0x00, 0x01, 0x00, 0xD0, 0x18, 0x4C, 0x00, 0x01, 0x00, 0xD0, 0x1E,
+    0x4C, 0x00, 0x01, 0x00, 0xD0, 0x24, 0x4C, 0x00, 0x01, 0x00, 0xD0, 0x2A, 0x4C, 0x00, 0x01, 0x01,
+    0x66, 0x00, 0xD1, 0x30, 0x4C, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x3A, 0x4C, 0x00, 0x40, 0x4C, 0x00,
+    0x01, 0x00, 0xD1, 0x4A, 0x4C, 0x00, 0x01, 0x00, 0xD0, 0x54, 0x4C, 0x00, 0x01, 0x00, 0xD0, 0x5A,
+    0x4C, 0x00, 0x01, 0x00, 0xD0, 0x64, 0x4C, 0x00, 0x01, 0x00, 0xD1, 0x6A, 0x4C, 0x00, 0x01, 0x00,
+    0xD0, 0x70, 0x4C, 0x00, 0x01, 0x00, 0xD0, 0x76, 0x4C, 0x00, 0x02, 0x00, 0x27, 0xD1, 0x80, 0x48,
+    0x00, 0x80, 0x4C, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x8A, 0x4C, 0x00, 0x90, 0x4C, 0x00, 0x01, 0x00,
+    0xD0, 0x96, 0x4C, 0x00, 0x01, 0x00, 0xD0, 0x9C, 0x4C, 0x00, 0x01, 0x00, 0xD1, 0xA6, 0x4C, 0x00,
+    0x01, 0x00, 0xD1, 0xAC, 0x4C, 0x00, 0x01, 0x00, 0xD1, 0xB2, 0x4C, 0x00, 0x01, 0x00, 0xD0, 0xB8,
+    0x4C, 0x00, 0x01, 0x00, 0xD1, 0xBE, 0x4C, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x40, 0x45, 0x00, 0xC4,
+    0x4C, 0x00, 0x01, 0x00, 0xD0, 0xCA, 0x4C, 0x00, 0x01, 0x02, 0x46, 0x00, 0xD0, 0xD4, 0x4C, 0x00,
+    0x02, 0x02, 0x46, 0x00, 0xD0, 0xD1, 0xDA, 0x4C, 0x00, 0xF0, 0x4C, 0x00, 0x02, 0x02, 0x46, 0x00,
+    0xD0, 0xD1, 0xFA, 0x4C, 0x00, 0x10, 0x4D, 0x00, 0x01, 0x00, 0xD0, 0x22, 0x4D, 0x00, 0x01, 0x00,
+    0xD0, 0x28, 0x4D, 0x00, 0x01, 0x02, 0x41, 0x00, 0xD0, 0xC6, 0x44, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x32, 0x4D, 0x00, 0x40, 0x4D, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x4A, 0x4D, 0x00, 0x54, 0x4D, 0x00,
+    0x01, 0x00, 0xD0, 0x5E, 0x4D, 0x00, 0x01, 0x00, 0xD0, 0x64, 0x4D, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xEE, 0x44, 0x00, 0x6A, 0x4D, 0x00, 0x02, 0x00, 0x2E, 0xD0, 0x74, 0x44, 0x00, 0x70, 0x4D, 0x00,
+    0x02, 0x00, 0x2E, 0xD1, 0x74, 0x44, 0x00, 0x76, 0x4D, 0x00, 0x03, 0x00, 0x27, 0xD0, 0xD1, 0x7C,
+    0x4D, 0x00, 0x82, 0x4D, 0x00, 0xA0, 0x4D, 0x00, 0x03, 0x00, 0x2E, 0xD0, 0xD1, 0x74, 0x44, 0x00,
+    0xC6, 0x44, 0x00, 0xAA, 0x45, 0x00, 0x01, 0x00, 0xD0, 0xAE, 0x4D, 0x00, 0x01, 0x00, 0xD0, 0xB4,
+    0x4D, 0x00, 0x01, 0x00, 0xD0, 0xBA, 0x4D, 0x00, 0x01, 0x00, 0xD1, 0xC0, 0x4D, 0x00, 0x01, 0x00,
+    0xD0, 0xC6, 0x4D, 0x00, 0x01, 0x00, 0xD1, 0xCC, 0x4D, 0x00, 0x01, 0x00, 0xD0, 0xD2, 0x4D, 0x00,
+    0x01, 0x00, 0xD0, 0xD8, 0x4D, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xEA, 0x4D, 0x00, 0xF4, 0x4D, 0x00,
+    0x01, 0x00, 0xD0, 0xFE, 0x4D, 0x00, 0x01, 0x00, 0xD0, 0x04, 0x4E, 0x00, 0x01, 0x00, 0xD1, 0x0E,
+    0x4E, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x14, 0x4E, 0x00, 0x1A, 0x4E, 0x00, 0x01, 0x00, 0xD0, 0x24,
+    0x4E, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x2A, 0x4E, 0x00, 0x34, 0x4E, 0x00, 0x01, 0x00, 0xD0, 0x3E,
+    0x4E, 0x00, 0x02, 0x02, 0x46, 0x00, 0xD0, 0xD1, 0x4C, 0x4E, 0x00, 0x52, 0x4E, 0x00, 0x01, 0x00,
+    0xD0, 0xF2, 0x33, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x5C, 0x4E, 0x00, 0x7A, 0x4E, 0x00, 0x02, 0x00,
+    0x2E, 0xD0, 0x74, 0x44, 0x00, 0x8C, 0x4E, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x40, 0x48, 0x00, 0x92,
+    0x4E, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x98, 0x4E, 0x00, 0xA2, 0x4E, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xAC, 0x4E, 0x00, 0xB6, 0x4E, 0x00, 0x03, 0x00, 0x2E, 0xD0, 0xD1, 0x74, 0x44, 0x00, 0xC8, 0x4E,
+    0x00, 0xD6, 0x4E, 0x00, 0x01, 0x02, 0x41, 0x00, 0xD1, 0xE4, 0x4E, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xEA, 0x4E, 0x00, 0xF8, 0x4E, 0x00, 0x01, 0x00, 0xD0, 0xFE, 0x4E, 0x00, 0x01, 0x00, 0xD1, 0xF8,
+    0x4E, 0x00, 0x03, 0x00, 0x2E, 0xD0, 0xD1, 0x74, 0x44, 0x00, 0x04, 0x4F, 0x00, 0x2C, 0x2E, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x0E, 0x4F, 0x00, 0x18, 0x4F, 0x00, 0x01, 0x00, 0xD0, 0x1E, 0x4F, 0x00,
+    0x01, 0x00, 0xD0, 0x24, 0x4F, 0x00, 0x01, 0x00, 0xD0, 0x2A, 0x4F, 0x00, 0x01, 0x00, 0xD0, 0x30,
+    0x4F, 0x00, 0x01, 0x00, 0xD0, 0x36, 0x4F, 0x00, 0x01, 0x00, 0xD0, 0x3C, 0x4F, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x42, 0x4F, 0x00, 0x48, 0x4F, 0x00, 0x01, 0x00, 0xD0, 0x98, 0x4E, 0x00, 0x01, 0x00,
+    0xD0, 0xB4, 0x2D, 0x00, 0x01, 0x00, 0xD0, 0x4E, 0x4F, 0x00, 0x01, 0x00, 0xD0, 0x54, 0x4F, 0x00,
+    0x02, 0x02, 0x9C, 0x00, 0xD0, 0xD1, 0x5A, 0x4F, 0x00, 0x64, 0x4F, 0x00, 0x01, 0x00, 0xD0, 0x6E,
+    0x4F, 0x00, 0x01, 0x00, 0xD1, 0x74, 0x4F, 0x00, 0x01, 0x00, 0xD0, 0x7A, 0x4F, 0x00, 0x01, 0x00,
+    0xD0, 0x80, 0x4F, 0x00, 0x01, 0x00, 0xD1, 0x86, 0x4F, 0x00, 0x01, 0x00, 0xD0, 0x8C, 0x4F, 0x00,
+    0x01, 0x00, 0xD1, 0x92, 0x4F, 0x00, 0x01, 0x00, 0xD0, 0x98, 0x4F, 0x00, 0x01, 0x00, 0xD0, 0xA2,
+    0x4F, 0x00, 0x01, 0x00, 0xD0, 0xA8, 0x4F, 0x00, 0x01, 0x00, 0xD0, 0xAE, 0x4F, 0x00, 0x01, 0x00,
+    0xD1, 0xB4, 0x4F, 0x00, 0x01, 0x00, 0xD1, 0xBA, 0x4F, 0x00, 0x01, 0x00, 0xD1, 0xC0, 0x4F, 0x00,
+    0x01, 0x00, 0xD1, 0xC6, 0x4F, 0x00, 0x01, 0x00, 0xD0, 0xCC, 0x4F, 0x00, 0x01, 0x00, 0xD1, 0xD2,
+    0x4F, 0x00, 0x01, 0x00, 0xD0, 0xD8, 0x4F, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xE2, 0x4F, 0x00, 0xF8,
+    0x4E, 0x00, 0x01, 0x00, 0xD0, 0xEC, 0x4F, 0x00, 0x01, 0x00, 0xD1, 0xE4, 0x4E, 0x00, 0x01, 0x00,
+    0xD1, 0xF6, 0x4F, 0x00, 0x01, 0x00, 0xD1, 0xFC, 0x4F, 0x00, 0x01, 0x00, 0xD0, 0x02, 0x50, 0x00,
+    0x01, 0x00, 0xD1, 0x08, 0x50, 0x00, 0x01, 0x00, 0xD1, 0x0E, 0x50, 0x00, 0x01, 0x00, 0xD0, 0x14,
+    0x50, 0x00, 0x01, 0x00, 0xD1, 0x1A, 0x50, 0x00, 0x00, 0x03, 0x99, 0x00, 0x01, 0x00, 0xD1, 0x20,
+    0x50, 0x00, 0x01, 0x00, 0xD1, 0x26, 0x50, 0x00, 0x01, 0x00, 0xD0, 0x2C, 0x50, 0x00, 0x01, 0x00,
+    0xD1, 0x32, 0x50, 0x00, 0x01, 0x00, 0xD1, 0x38, 0x50, 0x00, 0x01, 0x00, 0xD1, 0x3E, 0x50, 0x00,
+    0x01, 0x00, 0xD0, 0x44, 0x50, 0x00, 0x01, 0x00, 0xD0, 0x4A, 0x50, 0x00, 0x01, 0x00, 0xD0, 0x50,
+    0x50, 0x00, 0x01, 0x00, 0xD1, 0x56, 0x50, 0x00, 0x01, 0x00, 0xD1, 0xF2, 0x4B, 0x00, 0x01, 0x01,
+    0xAA, 0x00, 0xD0, 0x6A, 0x48, 0x00, 0x01, 0x00, 0xD1, 0x5C, 0x50, 0x00, 0x01, 0x00, 0xD0, 0x62,
+    0x50, 0x00, 0x03, 0x02, 0x19, 0x00, 0x27, 0xD0, 0xD1, 0x68, 0x50, 0x00, 0x6C, 0x50, 0x00, 0x7A,
+    0x50, 0x00, 0x01, 0x00, 0xD1, 0x84, 0x50, 0x00, 0x00, 0x02, 0x13, 0x00, 0x01, 0x00, 0xD1, 0x8A,
+    0x50, 0x00, 0x01, 0x00, 0xD1, 0x90, 0x50, 0x00, 0x03, 0x02, 0x19, 0x00, 0x27, 0xD0, 0xD1, 0x96,
+    0x50, 0x00, 0x9A, 0x50, 0x00, 0xA8, 0x50, 0x00, 0x01, 0x00, 0xD0, 0xB2, 0x50, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0xBC, 0x50, 0x00, 0x8A, 0x50, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xC2, 0x50, 0x00, 0xC8,
+    0x50, 0x00, 0x00, 0x02, 0x19, 0x00, 0x01, 0x00, 0xD1, 0xD2, 0x50, 0x00, 0x01, 0x00, 0xD0, 0xD8,
+    0x50, 0x00, 0x01, 0x00, 0xD1, 0xDE, 0x50, 0x00, 0x01, 0x00, 0xD0, 0xE4, 0x50, 0x00, 0x01, 0x00,
+    0xD0, 0xEA, 0x50, 0x00, 0x01, 0x00, 0xD0, 0xF0, 0x50, 0x00, 0x00, 0x01, 0x21, 0x00, 0x01, 0x00,
+    0xD0, 0xF6, 0x50, 0x00, 0x03, 0x02, 0x19, 0x00, 0x27, 0xD0, 0xD1, 0x96, 0x50, 0x00, 0x00, 0x51,
+    0x00, 0x0E, 0x51, 0x00, 0x03, 0x02, 0x19, 0x00, 0x27, 0xD0, 0xD1, 0x68, 0x50, 0x00, 0x18, 0x51,
+    0x00, 0x26, 0x51, 0x00, 0x01, 0x00, 0xD0, 0x2C, 0x51, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x32, 0x51,
+    0x00, 0x3C, 0x51, 0x00, 0x01, 0x00, 0xD0, 0x46, 0x51, 0x00, 0x01, 0x00, 0x80, 0x4C, 0x51, 0x00,
+    0x01, 0x00, 0x8F, 0x52, 0x51, 0x00, 0x01, 0x00, 0x97, 0x58, 0x51, 0x00, 0x01, 0x00, 0xBE, 0x5E,
+    0x51, 0x00, 0x01, 0x00, 0xB0, 0x8E, 0x38, 0x00, 0x01, 0x00, 0xBD, 0xD2, 0x3B, 0x00, 0x01, 0x00,
+    0xB5, 0x90, 0x41, 0x00, 0x01, 0x00, 0xBA, 0x64, 0x51, 0x00, 0x01, 0x00, 0x82, 0x6A, 0x51, 0x00,
+    0x01, 0x00, 0xB8, 0x70, 0x51, 0x00, 0x01, 0x00, 0xB5, 0x76, 0x51, 0x00, 0x01, 0x00, 0x80, 0xD2,
+    0x3B, 0x00, 0x01, 0x00, 0xB1, 0x7C, 0x51, 0x00, 0x01, 0x00, 0xB8, 0x3A, 0x38, 0x00, 0x01, 0x00,
+    0x83, 0x82, 0x51, 0x00, 0x02, 0x00, 0x80, 0x81, 0x74, 0x3E, 0x00, 0xD2, 0x3B, 0x00, 0x02, 0x00,
+    0xB5, 0xB8, 0x88, 0x51, 0x00, 0x8E, 0x51, 0x00, 0x01, 0x00, 0x80, 0x94, 0x51, 0x00, 0x01, 0x00,
+    0xB1, 0x9A, 0x51, 0x00, 0x01, 0x00, 0x82, 0x32, 0x41, 0x00, 0x02, 0x00, 0xB2, 0xBB, 0xA0, 0x51,
+    0x00, 0xA6, 0x51, 0x00, 0x01, 0x00, 0x82, 0xAC, 0x51, 0x00, 0x01, 0x00, 0x80, 0xB2, 0x51, 0x00,
+    0x01, 0x00, 0xB8, 0xB8, 0x51, 0x00, 0x01, 0x00, 0x96, 0xBE, 0x51, 0x00, 0x02, 0x00, 0xB0, 0xBE,
+    0x24, 0x39, 0x00, 0x82, 0x3A, 0x00, 0x01, 0x00, 0xB0, 0xC4, 0x51, 0x00, 0x01, 0x00, 0x80, 0x74,
+    0x3E, 0x00, 0x01, 0x00, 0xBB, 0xCA, 0x51, 0x00, 0x01, 0x00, 0x81, 0xD0, 0x51, 0x00, 0x01, 0x00,
+    0xB5, 0x7E, 0x41, 0x00, 0x01, 0x00, 0x83, 0xD6, 0x51, 0x00, 0x01, 0x00, 0xBC, 0x74, 0x3E, 0x00,
+    0x07, 0x00, 0xB0, 0xB2, 0xB4, 0xBA, 0xBC, 0xBE, 0xBF, 0xDC, 0x51, 0x00, 0xE2, 0x51, 0x00, 0xE8,
+    0x51, 0x00, 0xEE, 0x51, 0x00, 0xF4, 0x51, 0x00, 0xFE, 0x51, 0x00, 0x04, 0x52, 0x00, 0x05, 0x00,
+    0x80, 0x83, 0x84, 0x85, 0x86, 0x0A, 0x52, 0x00, 0x10, 0x52, 0x00, 0x16, 0x52, 0x00, 0x1C, 0x52,
+    0x00, 0x22, 0x52, 0x00, 0x01, 0x00, 0x86, 0x28, 0x52, 0x00, 0x01, 0x00, 0xB5, 0x2E, 0x52, 0x00,
+    0x01, 0x00, 0xB5, 0xD2, 0x3B, 0x00, 0x01, 0x00, 0xBE, 0xC4, 0x51, 0x00, 0x01, 0x00, 0xB0, 0x34,
+    0x52, 0x00, 0x01, 0x00, 0x96, 0x3A, 0x52, 0x00, 0x01, 0x00, 0xB5, 0x40, 0x52, 0x00, 0x01, 0x00,
+    0xBB, 0x28, 0x52, 0x00, 0x01, 0x00, 0x82, 0x46, 0x52, 0x00, 0x01, 0x00, 0xD1, 0x4C, 0x52, 0x00,
+    0x01, 0x00, 0xB5, 0x52, 0x52, 0x00, 0x01, 0x00, 0xB0, 0x58, 0x52, 0x00, 0x01, 0x00, 0x82, 0x5E,
+    0x52, 0x00, 0x01, 0x00, 0xB5, 0x64, 0x52, 0x00, 0x01, 0x00, 0x8C, 0x6A, 0x52, 0x00, 0x02, 0x00,
+    0xB0, 0xB5, 0x70, 0x52, 0x00, 0x76, 0x52, 0x00, 0x03, 0x00, 0xB0, 0xB2, 0xB5, 0x7C, 0x52, 0x00,
+    0x82, 0x52, 0x00, 0x88, 0x52, 0x00, 0x02, 0x00, 0x83, 0x96, 0x8E, 0x52, 0x00, 0x94, 0x52, 0x00,
+    0x01, 0x00, 0x81, 0x9A, 0x52, 0x00, 0x01, 0x00, 0xBE, 0xA0, 0x52, 0x00, 0x01, 0x00, 0x80, 0xA6,
+    0x52, 0x00, 0x01, 0x00, 0xB6, 0xD4, 0x39, 0x00, 0x02, 0x00, 0xB6, 0xB7, 0xD4, 0x39, 0x00, 0xD4,
+    0x39, 0x00, 0x01, 0x00, 0x81, 0xAC, 0x52, 0x00, 0x01, 0x00, 0xBA, 0xB2, 0x52, 0x00, 0x01, 0x00,
+    0x86, 0xBA, 0x52, 0x00, 0x00, 0x02, 0x44, 0x00, 0x01, 0x00, 0xB4, 0xC0, 0x52, 0x00, 0x01, 0x00,
+    0xB8, 0xC6, 0x52, 0x00, 0x01, 0x00, 0x82, 0xCC, 0x52, 0x00, 0x04, 0x00, 0xB3, 0xB7, 0xBA, 0xBF,
+    0xD6, 0x52, 0x00, 0xDC, 0x52, 0x00, 0xE2, 0x52, 0x00, 0xE8, 0x52, 0x00, 0x01, 0x00, 0xBD, 0xF2,
+    0x52, 0x00, 0x01, 0x00, 0x82, 0xFA, 0x52, 0x00, 0x01, 0x00, 0x81, 0xCC, 0x3B, 0x00, 0x01, 0x00,
+    0xB7, 0xAC, 0x52, 0x00, 0x01, 0x00, 0x82, 0x00, 0x53, 0x00, 0x01, 0x00, 0xB4, 0xD4, 0x39, 0x00,
+    0x01, 0x00, 0xB4, 0x06, 0x53, 0x00, 0x01, 0x00, 0xB2, 0x0C, 0x53, 0x00, 0x01, 0x00, 0x80, 0x0C,
+    0x53, 0x00, 0x01, 0x00, 0xBA, 0x0C, 0x53, 0x00, 0x01, 0x00, 0xBB, 0x12, 0x53, 0x00, 0x00, 0x02,
+    0xD1, 0x00, 0x01, 0x00, 0x8C, 0x18, 0x53, 0x00, 0x01, 0x00, 0x82, 0x1E, 0x53, 0x00, 0x01, 0x00,
+    0xB2, 0xB0, 0x39, 0x00, 0x01, 0x00, 0xB0, 0x24, 0x53, 0x00, 0x01, 0x00, 0xB4, 0x2A, 0x53, 0x00,
+    0x01, 0x00, 0xBB, 0xB0, 0x39, 0x00, 0x01, 0x00, 0xB2, 0x30, 0x53, 0x00, 0x01, 0x00, 0x8C, 0x36,
+    0x53, 0x00, 0x01, 0x00, 0x85, 0x3C, 0x53, 0x00, 0x01, 0x00, 0xB2, 0x0E, 0x41, 0x00, 0x02, 0x00,
+    0xB4, 0xBC, 0x42, 0x53, 0x00, 0x8E, 0x38, 0x00, 0x01, 0x00, 0x82, 0x42, 0x53, 0x00, 0x01, 0x00,
+    0xB0, 0x46, 0x53, 0x00, 0x01, 0x00, 0xB4, 0x4C, 0x53, 0x00, 0x01, 0x00, 0x87, 0x42, 0x53, 0x00,
+    0x01, 0x00, 0xB2, 0x8E, 0x38, 0x00, 0x01, 0x00, 0x81, 0xAC, 0x3D, 0x00, 0x01, 0x00, 0xB0, 0x52,
+    0x53, 0x00, 0x02, 0x00, 0x81, 0x88, 0x0C, 0x3D, 0x00, 0xD2, 0x3B, 0x00, 0x00, 0x02, 0xA1, 0x00,
+    0x01, 0x00, 0xBE, 0x58, 0x53, 0x00, 0x01, 0x00, 0x8C, 0x62, 0x53, 0x00, 0x01, 0x00, 0xBA, 0x68,
+    0x53, 0x00, 0x01, 0x00, 0x82, 0x6E, 0x53, 0x00, 0x02, 0x00, 0xB2, 0xBD, 0x4A, 0x37, 0x00, 0x74,
+    0x53, 0x00, 0x01, 0x00, 0xB2, 0x0C, 0x3D, 0x00, 0x01, 0x00, 0xB8, 0x7A, 0x53, 0x00, 0x01, 0x00,
+    0x80, 0x80, 0x53, 0x00, 0x01, 0x00, 0xB0, 0x86, 0x53, 0x00, 0x01, 0x00, 0xB7, 0x8C, 0x53, 0x00,
+    0x02, 0x00, 0xB4, 0xB6, 0x92, 0x53, 0x00, 0x98, 0x53, 0x00, 0x01, 0x00, 0x8C, 0x0C, 0x53, 0x00,
+    0x01, 0x00, 0x83, 0x9E, 0x53, 0x00, 0x04, 0x00, 0xB2, 0xB5, 0xB7, 0xBE, 0xA4, 0x53, 0x00, 0xAA,
+    0x53, 0x00, 0xB0, 0x53, 0x00, 0xB6, 0x53, 0x00, 0x01, 0x00, 0x83, 0xBC, 0x53, 0x00, 0x01, 0x00,
+    0x8C, 0xC2, 0x53, 0x00, 0x02, 0x00, 0xB1, 0xBD, 0xD4, 0x39, 0x00, 0xD4, 0x39, 0x00, 0x01, 0x00,
+    0xB1, 0xD4, 0x39, 0x00, 0x01, 0x00, 0xB7, 0xD4, 0x39, 0x00, 0x01, 0x00, 0x88, 0xD4, 0x39, 0x00,
+    0x02, 0x00, 0xB4, 0xBD, 0xD4, 0x39, 0x00, 0xD4, 0x39, 0x00, 0x01, 0x00, 0xBD, 0xD4, 0x39, 0x00,
+    0x01, 0x00, 0xBB, 0xD4, 0x39, 0x00, 0x01, 0x00, 0x87, 0xAC, 0x52, 0x00, 0x01, 0x00, 0xB5, 0x3A,
+    0x52, 0x00, 0x01, 0x00, 0xBF, 0xC8, 0x53, 0x00, 0x01, 0x00, 0xBC, 0xCE, 0x53, 0x00, 0x05, 0x00,
+    0xB2, 0xB4, 0xB9, 0xBC, 0xBD, 0xD4, 0x39, 0x00, 0xD4, 0x39, 0x00, 0xD4, 0x39, 0x00, 0xD4, 0x39,
+    0x00, 0xD4, 0x39, 0x00, 0x05, 0x00, 0x82, 0x84, 0x88, 0x8E, 0x94, 0xFA, 0x52, 0x00, 0xD4, 0x53,
+    0x00, 0xD4, 0x39, 0x00, 0xD4, 0x39, 0x00, 0xD4, 0x39, 0x00, 0x02, 0x00, 0x81, 0x86, 0xD4, 0x39,
+    0x00, 0xDC, 0x53, 0x00, 0x04, 0x00, 0xB1, 0xB6, 0xB7, 0xBC, 0xD4, 0x39, 0x00, 0xD4, 0x39, 0x00,
+    0xD4, 0x39, 0x00, 0xE2, 0x53, 0x00, 0x01, 0x00, 0x81, 0xE8, 0x53, 0x00, 0x03, 0x00, 0xB2, 0xBD,
+    0xBF, 0x00, 0x53, 0x00, 0xCC, 0x3B, 0x00, 0xD4, 0x39, 0x00, 0x01, 0x00, 0xB2, 0xD4, 0x39, 0x00,
+    0x02, 0x00, 0x82, 0x88, 0xD4, 0x39, 0x00, 0xD4, 0x39, 0x00, 0x01, 0x00, 0x80, 0xEE, 0x53, 0x00,
+    0x01, 0x00, 0xB5, 0xF4, 0x53, 0x00, 0x03, 0x00, 0xB2, 0xBB, 0xBD, 0xB0, 0x39, 0x00, 0xB0, 0x39,
+    0x00, 0xB0, 0x39, 0x00, 0x02, 0x00, 0x82, 0x94, 0xB0, 0x39, 0x00, 0xB0, 0x39, 0x00, 0x01, 0x00,
+    0xB3, 0xD4, 0x39, 0x00, 0x03, 0x00, 0x85, 0x8E, 0x94, 0xFA, 0x53, 0x00, 0xD4, 0x39, 0x00, 0xD4,
+    0x39, 0x00, 0x01, 0x00, 0xB9, 0xD4, 0x39, 0x00, 0x02, 0x00, 0x80, 0x87, 0xD4, 0x39, 0x00, 0xBA,
+    0x52, 0x00, 0x01, 0x00, 0x80, 0x00, 0x54, 0x00, 0x01, 0x00, 0xB6, 0x06, 0x54, 0x00, 0x01, 0x00,
+    0xBA, 0x8E, 0x38, 0x00, 0x01, 0x00, 0xBD, 0x10, 0x54, 0x00, 0x01, 0x00, 0xBC, 0x16, 0x54, 0x00,
+    0x05, 0x00, 0xB1, 0xB3, 0xBA, 0xBB, 0xBF, 0x1A, 0x54, 0x00, 0x20, 0x54, 0x00, 0x26, 0x54, 0x00,
+    0x30, 0x54, 0x00, 0x36, 0x54, 0x00, 0x02, 0x00, 0x82, 0x84, 0x40, 0x54, 0x00, 0x4A, 0x54, 0x00,
+    0x01, 0x00, 0xBF, 0x50, 0x54, 0x00, 0x01, 0x00, 0xD1, 0x56, 0x54, 0x00, 0x01, 0x00, 0xB2, 0x60,
+    0x54, 0x00, 0x01, 0x00, 0xBC, 0x6A, 0x54, 0x00, 0x01, 0x00, 0x80, 0x6E, 0x54, 0x00, 0x01, 0x00,
+    0xBE, 0x72, 0x54, 0x00, 0x02, 0x00, 0xBA, 0xBC, 0x8E, 0x38, 0x00, 0x8E, 0x38, 0x00, 0x03, 0x00,
+    0xB4, 0xB6, 0xBC, 0x8E, 0x38, 0x00, 0x8E, 0x38, 0x00, 0x8E, 0x38, 0x00, 0x02, 0x00, 0x81, 0x85,
+    0x78, 0x54, 0x00, 0x8E, 0x38, 0x00, 0x01, 0x00, 0xBC, 0xD4, 0x39, 0x00, 0x02, 0x00, 0xB6, 0xBA,
+    0xD4, 0x39, 0x00, 0xD4, 0x39, 0x00, 0x01, 0x00, 0xBF, 0xD4, 0x39, 0x00, 0x02, 0x00, 0xB1, 0xBC,
+    0xD4, 0x39, 0x00, 0x7E, 0x54, 0x00, 0x01, 0x00, 0x96, 0x84, 0x54, 0x00, 0x01, 0x00, 0xBB, 0x0A,
+    0x3B, 0x00, 0x02, 0x00, 0xB4, 0xBC, 0x42, 0x53, 0x00, 0x86, 0x36, 0x00, 0x01, 0x00, 0xB3, 0x8A,
+    0x54, 0x00, 0x01, 0x00, 0xB2, 0x90, 0x54, 0x00, 0x01, 0x00, 0xB0, 0x96, 0x54, 0x00, 0x01, 0x00,
+    0x82, 0x24, 0x39, 0x00, 0x01, 0x00, 0xB2, 0xA0, 0x51, 0x00, 0x01, 0x00, 0xB0, 0x9C, 0x54, 0x00,
+    0x01, 0x00, 0x96, 0xA2, 0x54, 0x00, 0x01, 0x00, 0x82, 0xA8, 0x54, 0x00, 0x02, 0x00, 0xBB, 0xBD,
+    0xAE, 0x54, 0x00, 0xAC, 0x51, 0x00, 0x02, 0x00, 0xBA, 0xBF, 0xB4, 0x54, 0x00, 0xB4, 0x54, 0x00,
+    0x02, 0x00, 0x82, 0x86, 0xB4, 0x54, 0x00, 0xB4, 0x54, 0x00, 0x03, 0x00, 0xB3, 0xBA, 0xBC, 0xB8,
+    0x54, 0x00, 0xBE, 0x54, 0x00, 0xC4, 0x54, 0x00, 0x01, 0x00, 0x96, 0xCA, 0x54, 0x00, 0x01, 0x00,
+    0xB3, 0x8C, 0x40, 0x00, 0x01, 0x00, 0x80, 0xD0, 0x54, 0x00, 0x01, 0x00, 0xBE, 0xD6, 0x54, 0x00,
+    0x02, 0x00, 0x80, 0x83, 0xB2, 0x51, 0x00, 0xDC, 0x54, 0x00, 0x01, 0x00, 0xBE, 0xE2, 0x54, 0x00,
+    0x01, 0x00, 0xBE, 0xDC, 0x54, 0x00, 0x01, 0x00, 0xB8, 0xE8, 0x54, 0x00, 0x03, 0x00, 0xB0, 0xB8,
+    0xBB, 0x70, 0x51, 0x00, 0xB8, 0x51, 0x00, 0xEE, 0x54, 0x00, 0x01, 0x00, 0xB2, 0xF4, 0x54, 0x00,
+    0x01, 0x00, 0x96, 0xFA, 0x54, 0x00, 0x02, 0x00, 0xB0, 0xB5, 0x00, 0x55, 0x00, 0xD2, 0x3B, 0x00,
+    0x01, 0x00, 0xBF, 0xB0, 0x39, 0x00, 0x01, 0x00, 0xBE, 0x8E, 0x38, 0x00, 0x01, 0x00, 0xBE, 0x06,
+    0x55, 0x00, 0x01, 0x00, 0x82, 0xDC, 0x54, 0x00, 0x01, 0x00, 0x82, 0x0C, 0x55, 0x00, 0x01, 0x00,
+    0xBC, 0x12, 0x55, 0x00, 0x01, 0x00, 0x82, 0xDC, 0x53, 0x00, 0x01, 0x00, 0xB0, 0x18, 0x55, 0x00,
+    0x00, 0x01, 0x0D, 0x00, 0x01, 0x00, 0xD0, 0x1E, 0x55, 0x00, 0x01, 0x00, 0xD0, 0x24, 0x55, 0x00,
+    0x01, 0x00, 0xD1, 0x2A, 0x55, 0x00, 0x02, 0x00, 0xBC, 0xBD, 0x8E, 0x38, 0x00, 0x38, 0x55, 0x00,
+    0x01, 0x00, 0x82, 0x3E, 0x55, 0x00, 0x01, 0x00, 0xD1, 0x42, 0x55, 0x00, 0x01, 0x00, 0xB0, 0x48,
+    0x55, 0x00, 0x01, 0x00, 0x87, 0x4E, 0x55, 0x00, 0x01, 0x00, 0x88, 0x42, 0x53, 0x00, 0x02, 0x00,
+    0xB2, 0xBB, 0x8E, 0x38, 0x00, 0x54, 0x55, 0x00, 0x05, 0x00, 0xB4, 0xB6, 0xB7, 0xBB, 0xBC, 0x8E,
+    0x38, 0x00, 0x8E, 0x38, 0x00, 0x8E, 0x38, 0x00, 0x8E, 0x38, 0x00, 0x8E, 0x38, 0x00, 0x01, 0x00,
+    0x85, 0x8E, 0x38, 0x00, 0x02, 0x00, 0xB3, 0xBB, 0x5A, 0x55, 0x00, 0x60, 0x55, 0x00, 0x01, 0x00,
+    0xBE, 0x66, 0x55, 0x00, 0x01, 0x02, 0xA1, 0x00, 0xD0, 0x70, 0x55, 0x00, 0x02, 0x00, 0xB6, 0xBD,
+    0xD4, 0x39, 0x00, 0xD4, 0x39, 0x00, 0x02, 0x00, 0xB4, 0xBB, 0xD4, 0x39, 0x00, 0xD4, 0x39, 0x00,
+    0x03, 0x00, 0x81, 0x87, 0x89, 0xDC, 0x53, 0x00, 0xD4, 0x39, 0x00, 0xD4, 0x39, 0x00, 0x01, 0x00,
+    0x80, 0x76, 0x55, 0x00, 0x01, 0x00, 0xBA, 0xD4, 0x39, 0x00, 0x01, 0x00, 0x87, 0xD4, 0x39, 0x00,
+    0x01, 0x00, 0x82, 0xD4, 0x39, 0x00, 0x01, 0x00, 0xB2, 0x00, 0x3D, 0x00, 0x01, 0x00, 0x80, 0x7C,
+    0x55, 0x00, 0x01, 0x00, 0xB9, 0x82, 0x55, 0x00, 0x01, 0x00, 0xBE, 0x8C, 0x55, 0x00, 0x05, 0x00,
+    0xB2, 0xB9, 0xBA, 0xBB, 0xBD, 0xD4, 0x39, 0x00, 0x92, 0x55, 0x00, 0xD4, 0x39, 0x00, 0xD4, 0x39,
+    0x00, 0xD4, 0x39, 0x00, 0x05, 0x00, 0x82, 0x85, 0x87, 0x8E, 0x94, 0xD4, 0x39, 0x00, 0x9E, 0x55,
+    0x00, 0xD4, 0x39, 0x00, 0xD4, 0x39, 0x00, 0xD4, 0x39, 0x00, 0x03, 0x00, 0xB0, 0xB5, 0xB8, 0x24,
+    0x39, 0x00, 0x24, 0x39, 0x00, 0x24, 0x39, 0x00, 0x02, 0x00, 0x83, 0x96, 0x24, 0x39, 0x00, 0x24,
+    0x39, 0x00, 0x01, 0x00, 0xB7, 0xA4, 0x55, 0x00, 0x03, 0x00, 0xB2, 0xBB, 0xBD, 0xD4, 0x39, 0x00,
+    0xD4, 0x39, 0x00, 0xD4, 0x39, 0x00, 0x01, 0x00, 0xBE, 0xAA, 0x55, 0x00, 0x01, 0x00, 0x8F, 0x24,
+    0x39, 0x00, 0x01, 0x00, 0xB8, 0x24, 0x39, 0x00, 0x01, 0x00, 0x82, 0xB0, 0x55, 0x00, 0x01, 0x00,
+    0xBD, 0x0C, 0x3D, 0x00, 0x01, 0x00, 0x89, 0xB0, 0x39, 0x00, 0x01, 0x00, 0xB2, 0xB6, 0x55, 0x00,
+    0x01, 0x00, 0x82, 0xBC, 0x55, 0x00, 0x01, 0x00, 0xBE, 0xC2, 0x55, 0x00, 0x01, 0x00, 0xB0, 0xC8,
+    0x55, 0x00, 0x01, 0x00, 0xB0, 0xCE, 0x55, 0x00, 0x01, 0x00, 0xB5, 0xD4, 0x55, 0x00, 0x01, 0x00,
+    0x80, 0xDA, 0x55, 0x00, 0x01, 0x00, 0xB2, 0xE0, 0x55, 0x00, 0x01, 0x00, 0x83, 0xE6, 0x55, 0x00,
+    0x02, 0x00, 0x82, 0x86, 0xEC, 0x55, 0x00, 0xF2, 0x55, 0x00, 0x01, 0x00, 0xBE, 0xF8, 0x55, 0x00,
+    0x01, 0x00, 0x80, 0xFE, 0x55, 0x00, 0x01, 0x00, 0xBD, 0xE8, 0x53, 0x00, 0x01, 0x00, 0x81, 0x0C,
+    0x53, 0x00, 0x02, 0x00, 0x82, 0x8C, 0x9E, 0x39, 0x00, 0x04, 0x56, 0x00, 0x01, 0x00, 0xD1, 0x0E,
+    0x56, 0x00, 0x01, 0x00, 0xB5, 0x6A, 0x3C, 0x00, 0x02, 0x00, 0x83, 0x96, 0x6A, 0x3C, 0x00, 0x6A,
+    0x3C, 0x00, 0x01, 0x00, 0xB6, 0xB0, 0x39, 0x00, 0x01, 0x00, 0x80, 0x14, 0x56, 0x00, 0x01, 0x00,
+    0xB0, 0x1A, 0x56, 0x00, 0x01, 0x00, 0x83, 0x20, 0x56, 0x00, 0x01, 0x00, 0xB5, 0x26, 0x56, 0x00,
+    0x01, 0x00, 0xBB, 0x2C, 0x56, 0x00, 0x01, 0x00, 0xD1, 0x32, 0x56, 0x00, 0x02, 0x00, 0x80, 0x87,
+    0x3C, 0x56, 0x00, 0x42, 0x56, 0x00, 0x00, 0x02, 0xCD, 0x00, 0x03, 0x00, 0xB0, 0xB1, 0xB7, 0x4C,
+    0x56, 0x00, 0x52, 0x56, 0x00, 0x58, 0x56, 0x00, 0x02, 0x00, 0x83, 0x96, 0x5E, 0x56, 0x00, 0x64,
+    0x56, 0x00, 0x01, 0x00, 0xB2, 0x42, 0x53, 0x00, 0x05, 0x00, 0xB0, 0xB5, 0xBC, 0xBD, 0xBE, 0x6A,
+    0x56, 0x00, 0x72, 0x56, 0x00, 0x7A, 0x56, 0x00, 0x38, 0x55, 0x00, 0x80, 0x56, 0x00, 0x04, 0x00,
+    0x81, 0x83, 0x8F, 0x96, 0x8A, 0x56, 0x00, 0x90, 0x56, 0x00, 0x96, 0x56, 0x00, 0xA0, 0x56, 0x00,
+    0x01, 0x00, 0x80, 0x8E, 0x38, 0x00, 0x02, 0x00, 0xBB, 0xBE, 0xA6, 0x56, 0x00, 0xAC, 0x56, 0x00,
+    0x01, 0x00, 0x96, 0xB2, 0x56, 0x00, 0x05, 0x00, 0xB2, 0xB6, 0xB7, 0xBB, 0xBC, 0xB8, 0x56, 0x00,
+    0x8E, 0x38, 0x00, 0x8E, 0x38, 0x00, 0x8E, 0x38, 0x00, 0x8E, 0x38, 0x00, 0x02, 0x00, 0x81, 0x85,
+    0x8E, 0x38, 0x00, 0x8E, 0x38, 0x00, 0x01, 0x00, 0xB1, 0x4C, 0x53, 0x00, 0x02, 0x00, 0x82, 0x96,
+    0xBE, 0x56, 0x00, 0xC4, 0x56, 0x00, 0x02, 0x00, 0xB1, 0xBE, 0x52, 0x56, 0x00, 0xCA, 0x56, 0x00,
+    0x01, 0x00, 0xB2, 0xD0, 0x56, 0x00, 0x05, 0x00, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xD6, 0x56, 0x00,
+    0xDC, 0x56, 0x00, 0xE6, 0x56, 0x00, 0xEC, 0x56, 0x00, 0xF2, 0x56, 0x00, 0x01, 0x00, 0x84, 0xF8,
+    0x56, 0x00, 0x01, 0x00, 0xBE, 0xFE, 0x56, 0x00, 0x01, 0x00, 0xBD, 0x8E, 0x38, 0x00, 0x02, 0x00,
+    0x80, 0x81, 0x04, 0x57, 0x00, 0xAC, 0x3D, 0x00, 0x01, 0x00, 0x81, 0x78, 0x54, 0x00, 0x01, 0x00,
+    0xB0, 0x0A, 0x57, 0x00, 0x01, 0x00, 0xBA, 0x10, 0x57, 0x00, 0x01, 0x00, 0xBD, 0x1A, 0x57, 0x00,
+    0x01, 0x00, 0x82, 0x9E, 0x39, 0x00, 0x01, 0x00, 0x80, 0x20, 0x57, 0x00, 0x01, 0x00, 0xB0, 0x26,
+    0x57, 0x00, 0x01, 0x00, 0xB0, 0x2C, 0x57, 0x00, 0x01, 0x00, 0xBE, 0x34, 0x57, 0x00, 0x01, 0x00,
+    0xD0, 0x3A, 0x57, 0x00, 0x01, 0x00, 0x80, 0x44, 0x57, 0x00, 0x01, 0x00, 0x80, 0x5A, 0x55, 0x00,
+    0x02, 0x00, 0xB0, 0xB4, 0x4A, 0x57, 0x00, 0x50, 0x57, 0x00, 0x01, 0x00, 0xB9, 0x56, 0x57, 0x00,
+    0x01, 0x00, 0x80, 0x5C, 0x57, 0x00, 0x01, 0x00, 0xBC, 0x62, 0x57, 0x00, 0x03, 0x00, 0xB2, 0xB4,
+    0xB9, 0x68, 0x57, 0x00, 0x6E, 0x57, 0x00, 0x76, 0x57, 0x00, 0x01, 0x00, 0x86, 0xB0, 0x39, 0x00,
+    0x01, 0x00, 0xB4, 0x80, 0x57, 0x00, 0x01, 0x00, 0xBB, 0xBC, 0x55, 0x00, 0x01, 0x00, 0xB3, 0xB0,
+    0x39, 0x00, 0x01, 0x00, 0xBE, 0x24, 0x39, 0x00, 0x01, 0x00, 0x80, 0x84, 0x57, 0x00, 0x01, 0x00,
+    0xB5, 0x8A, 0x57, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xBC, 0x90, 0x57, 0x00, 0x02, 0x00,
+    0x80, 0x96, 0x94, 0x57, 0x00, 0x06, 0x55, 0x00, 0x02, 0x00, 0xB5, 0xB8, 0x9A, 0x57, 0x00, 0xA0,
+    0x57, 0x00, 0x01, 0x00, 0x82, 0xA6, 0x57, 0x00, 0x01, 0x00, 0xB8, 0xAC, 0x57, 0x00, 0x01, 0x00,
+    0xB0, 0xD2, 0x3B, 0x00, 0x01, 0x00, 0xB8, 0x8A, 0x57, 0x00, 0x03, 0x00, 0x81, 0x88, 0x89, 0xD2,
+    0x3B, 0x00, 0xB2, 0x57, 0x00, 0xB2, 0x57, 0x00, 0x01, 0x00, 0xB8, 0xB8, 0x57, 0x00, 0x01, 0x00,
+    0xBD, 0xFC, 0x38, 0x00, 0x01, 0x00, 0xB1, 0xB0, 0x39, 0x00, 0x01, 0x00, 0xB6, 0x0C, 0x3D, 0x00,
+    0x02, 0x00, 0x82, 0x83, 0xDC, 0x54, 0x00, 0xFA, 0x54, 0x00, 0x01, 0x00, 0xBB, 0x84, 0x57, 0x00,
+    0x02, 0x00, 0x80, 0x87, 0x5C, 0x57, 0x00, 0xB0, 0x39, 0x00, 0x02, 0x00, 0x81, 0x89, 0x0C, 0x3D,
+    0x00, 0xB0, 0x39, 0x00, 0x01, 0x00, 0xBE, 0x70, 0x51, 0x00, 0x02, 0x00, 0xB5, 0xBE, 0xBE, 0x57,
+    0x00, 0xC4, 0x57, 0x00, 0x01, 0x00, 0xB5, 0xBE, 0x57, 0x00, 0x01, 0x00, 0x83, 0xCA, 0x57, 0x00,
+    0x01, 0x00, 0xB5, 0xD0, 0x57, 0x00, 0x02, 0x00, 0xB5, 0xBB, 0xDA, 0x57, 0x00, 0xE0, 0x57, 0x00,
+    0x02, 0x00, 0x82, 0x87, 0xE6, 0x57, 0x00, 0xEC, 0x57, 0x00, 0x01, 0x00, 0xB2, 0x54, 0x55, 0x00,
+    0x01, 0x00, 0x80, 0xF6, 0x57, 0x00, 0x01, 0x00, 0xBD, 0xFC, 0x57, 0x00, 0x02, 0x00, 0xB0, 0xB1,
+    0x02, 0x58, 0x00, 0x08, 0x58, 0x00, 0x01, 0x00, 0x96, 0x0E, 0x58, 0x00, 0x01, 0x00, 0x82, 0x18,
+    0x58, 0x00, 0x01, 0x00, 0x82, 0x22, 0x58, 0x00, 0x01, 0x00, 0xBD, 0x2C, 0x58, 0x00, 0x01, 0x00,
+    0x82, 0x36, 0x58, 0x00, 0x01, 0x00, 0x81, 0x3C, 0x58, 0x00, 0x02, 0x00, 0xB4, 0xB7, 0x8E, 0x38,
+    0x00, 0xDA, 0x3F, 0x00, 0x01, 0x00, 0xB9, 0x44, 0x58, 0x00, 0x05, 0x00, 0xB2, 0xB9, 0xBC, 0xBD,
+    0xBE, 0xA4, 0x53, 0x00, 0x4A, 0x58, 0x00, 0xA4, 0x53, 0x00, 0x54, 0x58, 0x00, 0x5A, 0x58, 0x00,
+    0x02, 0x00, 0x83, 0x97, 0x5E, 0x56, 0x00, 0x60, 0x58, 0x00, 0x05, 0x00, 0xB1, 0xB5, 0xB9, 0xBC,
+    0xBF, 0x64, 0x58, 0x00, 0x6A, 0x58, 0x00, 0x56, 0x57, 0x00, 0x70, 0x58, 0x00, 0x76, 0x58, 0x00,
+    0x04, 0x00, 0x81, 0x84, 0x8F, 0x97, 0x7C, 0x58, 0x00, 0x82, 0x58, 0x00, 0x8C, 0x58, 0x00, 0x60,
+    0x58, 0x00, 0x01, 0x00, 0xBE, 0x7A, 0x53, 0x00, 0x02, 0x00, 0xB2, 0xBD, 0xB0, 0x39, 0x00, 0xB0,
+    0x39, 0x00, 0x03, 0x00, 0xB0, 0xB5, 0xBE, 0x92, 0x58, 0x00, 0x98, 0x58, 0x00, 0x9E, 0x58, 0x00,
+    0x02, 0x00, 0x83, 0x96, 0xA8, 0x58, 0x00, 0xAE, 0x58, 0x00, 0x02, 0x00, 0xB2, 0xBE, 0xA4, 0x53,
+    0x00, 0xB4, 0x58, 0x00, 0x02, 0x00, 0x83, 0x96, 0xA0, 0x51, 0x00, 0xBE, 0x58, 0x00, 0x01, 0x00,
+    0xBC, 0x8E, 0x38, 0x00, 0x01, 0x00, 0xB2, 0xC4, 0x58, 0x00, 0x01, 0x00, 0x82, 0xCA, 0x58, 0x00,
+    0x01, 0x00, 0xB7, 0x0C, 0x53, 0x00, 0x01, 0x00, 0x82, 0x0C, 0x53, 0x00, 0x01, 0x00, 0xD1, 0xD0,
+    0x58, 0x00, 0x07, 0x00, 0xB2, 0xB3, 0xB4, 0xB9, 0xBB, 0xBC, 0xBE, 0xDA, 0x58, 0x00, 0xE0, 0x58,
+    0x00, 0xEA, 0x58, 0x00, 0xF4, 0x58, 0x00, 0xFA, 0x58, 0x00, 0x00, 0x59, 0x00, 0x06, 0x59, 0x00,
+    0x03, 0x00, 0x83, 0x87, 0x96, 0x0C, 0x59, 0x00, 0x16, 0x59, 0x00, 0x1C, 0x59, 0x00, 0x01, 0x00,
+    0xBE, 0x22, 0x59, 0x00, 0x01, 0x00, 0xBE, 0x28, 0x59, 0x00, 0x01, 0x00, 0xBA, 0x2E, 0x59, 0x00,
+    0x01, 0x00, 0x94, 0x34, 0x59, 0x00, 0x01, 0x00, 0xBF, 0x0C, 0x53, 0x00, 0x01, 0x00, 0x86, 0x3E,
+    0x59, 0x00, 0x01, 0x00, 0xB4, 0x8E, 0x38, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xB8, 0xBE, 0x52, 0x53,
+    0x00, 0x6A, 0x3C, 0x00, 0x44, 0x59, 0x00, 0x6A, 0x3C, 0x00, 0x02, 0x00, 0xBA, 0xBF, 0xB0, 0x39,
+    0x00, 0xB0, 0x39, 0x00, 0x02, 0x00, 0x80, 0x87, 0x4A, 0x59, 0x00, 0xB0, 0x39, 0x00, 0x01, 0x00,
+    0xB8, 0x52, 0x59, 0x00, 0x02, 0x00, 0xBB, 0xBF, 0xBC, 0x55, 0x00, 0x4C, 0x38, 0x00, 0x01, 0x00,
+    0x82, 0xAC, 0x3D, 0x00, 0x01, 0x00, 0xBA, 0xD2, 0x3B, 0x00, 0x02, 0x00, 0x80, 0x86, 0x8A, 0x57,
+    0x00, 0x58, 0x59, 0x00, 0x01, 0x00, 0xB0, 0x62, 0x59, 0x00, 0x02, 0x00, 0xB2, 0xB6, 0x6C, 0x59,
+    0x00, 0x6A, 0x51, 0x00, 0x02, 0x00, 0x80, 0x81, 0x72, 0x59, 0x00, 0x78, 0x59, 0x00, 0x03, 0x00,
+    0xB0, 0xB8, 0xBE, 0x7A, 0x53, 0x00, 0x7E, 0x59, 0x00, 0x84, 0x59, 0x00, 0x01, 0x00, 0xB2, 0x8A,
+    0x59, 0x00, 0x02, 0x00, 0x82, 0x88, 0xBC, 0x55, 0x00, 0xB0, 0x39, 0x00, 0x07, 0x00, 0xB1, 0xB2,
+    0xB4, 0xB7, 0xB9, 0xBB, 0xBD, 0x90, 0x59, 0x00, 0xB0, 0x39, 0x00, 0xB0, 0x39, 0x00, 0xB0, 0x39,
+    0x00, 0x0C, 0x3D, 0x00, 0xB0, 0x39, 0x00, 0xB0, 0x39, 0x00, 0x04, 0x00, 0x80, 0x82, 0x87, 0x94,
+    0x96, 0x59, 0x00, 0x9E, 0x59, 0x00, 0xB0, 0x39, 0x00, 0xB0, 0x39, 0x00, 0x01, 0x00, 0xBE, 0xA6,
+    0x59, 0x00, 0x01, 0x00, 0x80, 0xAC, 0x59, 0x00, 0x02, 0x00, 0xB3, 0xB6, 0xB0, 0x39, 0x00, 0xB0,
+    0x39, 0x00, 0x02, 0x00, 0x81, 0x82, 0x4C, 0x38, 0x00, 0xB6, 0x59, 0x00, 0x02, 0x00, 0xB2, 0xB9,
+    0x92, 0x3E, 0x00, 0xB0, 0x39, 0x00, 0x04, 0x00, 0x80, 0x81, 0x8E, 0x8F, 0xBC, 0x59, 0x00, 0xC6,
+    0x59, 0x00, 0xB0, 0x39, 0x00, 0x0C, 0x3D, 0x00, 0x03, 0x00, 0xB0, 0xB8, 0xBE, 0xD0, 0x59, 0x00,
+    0xDA, 0x59, 0x00, 0xE0, 0x59, 0x00, 0x03, 0x00, 0x83, 0x8C, 0x96, 0xEA, 0x59, 0x00, 0x0C, 0x53,
+    0x00, 0xF0, 0x59, 0x00, 0x01, 0x00, 0x8C, 0xAA, 0x3C, 0x00, 0x03, 0x00, 0xB1, 0xB9, 0xBB, 0xB0,
+    0x39, 0x00, 0xB0, 0x39, 0x00, 0xBC, 0x55, 0x00, 0x01, 0x00, 0x80, 0xB0, 0x39, 0x00, 0x01, 0x00,
+    0xB5, 0xFA, 0x59, 0x00, 0x02, 0x00, 0xB2, 0xBA, 0x00, 0x5A, 0x00, 0x52, 0x3A, 0x00, 0x02, 0x00,
+    0xB4, 0xBB, 0x06, 0x5A, 0x00, 0x0A, 0x3B, 0x00, 0x01, 0x00, 0x81, 0x0C, 0x5A, 0x00, 0x01, 0x00,
+    0xB2, 0x12, 0x5A, 0x00, 0x01, 0x00, 0xB5, 0x18, 0x5A, 0x00, 0x01, 0x00, 0xB3, 0x1E, 0x5A, 0x00,
+    0x01, 0x00, 0xBD, 0x24, 0x5A, 0x00, 0x01, 0x00, 0xBA, 0x2A, 0x5A, 0x00, 0x01, 0x00, 0xBA, 0x32,
+    0x5A, 0x00, 0x01, 0x00, 0xB0, 0xA6, 0x59, 0x00, 0x01, 0x00, 0x8F, 0x38, 0x5A, 0x00, 0x01, 0x00,
+    0xB0, 0xFC, 0x38, 0x00, 0x01, 0x00, 0xBC, 0x3E, 0x5A, 0x00, 0x02, 0x00, 0xB0, 0xB5, 0x44, 0x5A,
+    0x00, 0x4A, 0x5A, 0x00, 0x02, 0x00, 0x83, 0x96, 0x50, 0x5A, 0x00, 0x56, 0x5A, 0x00, 0x01, 0x00,
+    0xB1, 0x5C, 0x5A, 0x00, 0x01, 0x00, 0x80, 0x62, 0x5A, 0x00, 0x01, 0x00, 0xB0, 0x7A, 0x53, 0x00,
+    0x01, 0x00, 0xB0, 0x0C, 0x3D, 0x00, 0x01, 0x00, 0x87, 0x68, 0x5A, 0x00, 0x01, 0x00, 0xB4, 0x6E,
+    0x5A, 0x00, 0x01, 0x00, 0x96, 0x76, 0x5A, 0x00, 0x02, 0x00, 0xB0, 0xBF, 0x7C, 0x5A, 0x00, 0x20,
+    0x41, 0x00, 0x01, 0x00, 0xB2, 0x82, 0x5A, 0x00, 0x01, 0x00, 0xBE, 0x8C, 0x40, 0x00, 0x01, 0x00,
+    0xBE, 0x88, 0x5A, 0x00, 0x01, 0x00, 0x81, 0x8E, 0x5A, 0x00, 0x01, 0x00, 0x94, 0x94, 0x5A, 0x00,
+    0x01, 0x00, 0x82, 0x9A, 0x5A, 0x00, 0x01, 0x00, 0x80, 0xA0, 0x5A, 0x00, 0x01, 0x00, 0xBD, 0xA6,
+    0x5A, 0x00, 0x01, 0x00, 0x96, 0x64, 0x52, 0x00, 0x02, 0x00, 0xB4, 0xBB, 0xB0, 0x39, 0x00, 0xB0,
+    0x39, 0x00, 0x02, 0x00, 0xB4, 0xBB, 0x4C, 0x38, 0x00, 0xB0, 0x39, 0x00, 0x02, 0x00, 0xB1, 0xBB,
+    0xB0, 0x39, 0x00, 0xE8, 0x53, 0x00, 0x01, 0x00, 0x87, 0xB0, 0x39, 0x00, 0x01, 0x00, 0x80, 0x0C,
+    0x3D, 0x00, 0x01, 0x00, 0xBA, 0xB0, 0x39, 0x00, 0x01, 0x00, 0x81, 0xB0, 0x39, 0x00, 0x01, 0x00,
+    0x80, 0xAC, 0x5A, 0x00, 0x01, 0x00, 0xB0, 0xB2, 0x5A, 0x00, 0x01, 0x00, 0x80, 0xE8, 0x53, 0x00,
+    0x01, 0x00, 0x81, 0xB8, 0x5A, 0x00, 0x01, 0x00, 0x81, 0xBE, 0x5A, 0x00, 0x01, 0x00, 0xB9, 0xB0,
+    0x39, 0x00, 0x01, 0x00, 0x82, 0xC4, 0x5A, 0x00, 0x01, 0x00, 0x82, 0xCA, 0x5A, 0x00, 0x01, 0x00,
+    0x81, 0xBE, 0x54, 0x00, 0x01, 0x00, 0xB2, 0xD0, 0x5A, 0x00, 0x01, 0x00, 0xB5, 0xD6, 0x5A, 0x00,
+    0x01, 0x00, 0xBE, 0xE0, 0x5A, 0x00, 0x01, 0x00, 0x86, 0xE6, 0x5A, 0x00, 0x01, 0x00, 0x83, 0x3A,
+    0x38, 0x00, 0x01, 0x00, 0xBD, 0xCC, 0x3B, 0x00, 0x00, 0x02, 0x1B, 0x00, 0x03, 0x00, 0xB2, 0xB5,
+    0xBE, 0xEC, 0x5A, 0x00, 0xF2, 0x5A, 0x00, 0xF8, 0x5A, 0x00, 0x02, 0x00, 0x80, 0x83, 0x02, 0x5B,
+    0x00, 0x08, 0x5B, 0x00, 0x01, 0x00, 0x86, 0x0C, 0x5B, 0x00, 0x01, 0x00, 0x87, 0x16, 0x5B, 0x00,
+    0x01, 0x00, 0x80, 0x16, 0x5B, 0x00, 0x00, 0x01, 0x29, 0x00, 0x03, 0x00, 0xB0, 0xB5, 0xBE, 0x1A,
+    0x5B, 0x00, 0x1E, 0x5B, 0x00, 0x24, 0x5B, 0x00, 0x02, 0x00, 0x83, 0x96, 0x2A, 0x5B, 0x00, 0x30,
+    0x5B, 0x00, 0x02, 0x00, 0xB2, 0xBB, 0x7A, 0x42, 0x00, 0x38, 0x5B, 0x00, 0x01, 0x00, 0xBC, 0x40,
+    0x5B, 0x00, 0x01, 0x00, 0xBA, 0x7A, 0x42, 0x00, 0x02, 0x00, 0x86, 0x87, 0x7A, 0x42, 0x00, 0x7A,
+    0x42, 0x00, 0x01, 0x00, 0x96, 0x46, 0x5B, 0x00, 0x01, 0x00, 0xB4, 0x7A, 0x42, 0x00, 0x01, 0x00,
+    0x96, 0x70, 0x48, 0x00, 0x01, 0x00, 0xBC, 0x4C, 0x5B, 0x00, 0x01, 0x00, 0xB5, 0x52, 0x5B, 0x00,
+    0x01, 0x00, 0xB0, 0x5A, 0x5B, 0x00, 0x02, 0x00, 0xB2, 0xBC, 0x60, 0x5B, 0x00, 0x40, 0x5B, 0x00,
+    0x03, 0x00, 0xB5, 0xB8, 0xBE, 0x1A, 0x5B, 0x00, 0x1A, 0x5B, 0x00, 0x1A, 0x5B, 0x00, 0x02, 0x00,
+    0x83, 0x96, 0x1A, 0x5B, 0x00, 0x1A, 0x5B, 0x00, 0x03, 0x00, 0xB0, 0xB5, 0xBC, 0x1A, 0x5B, 0x00,
+    0x1A, 0x5B, 0x00, 0x40, 0x5B, 0x00, 0x01, 0x00, 0x96, 0x1A, 0x5B, 0x00, 0x01, 0x00, 0xB2, 0x66,
+    0x5B, 0x00, 0x02, 0x00, 0xB5, 0xB8, 0x70, 0x48, 0x00, 0x70, 0x48, 0x00, 0x02, 0x00, 0x83, 0x96,
+    0x70, 0x48, 0x00, 0x70, 0x48, 0x00, 0x01, 0x00, 0xB5, 0x6A, 0x5B, 0x00, 0x01, 0x00, 0xD0, 0x70,
+    0x5B, 0x00, 0x01, 0x00, 0xD0, 0x76, 0x5B, 0x00, 0x01, 0x00, 0xD0, 0x7C, 0x5B, 0x00, 0x01, 0x00,
+    0xD1, 0x82, 0x5B, 0x00, 0x01, 0x00, 0xD0, 0x88, 0x5B, 0x00, 0x01, 0x00, 0xD0, 0x08, 0x43, 0x00,
+    0x01, 0x00, 0xD0, 0x8E, 0x5B, 0x00, 0x01, 0x00, 0xD0, 0x94, 0x5B, 0x00, 0x01, 0x00, 0xD0, 0x9A,
+    0x5B, 0x00, 0x01, 0x00, 0xD0, 0xA0, 0x5B, 0x00, 0x01, 0x00, 0xD0, 0xA6, 0x5B, 0x00, 0x01, 0x00,
+    0xD0, 0xAC, 0x5B, 0x00, 0x01, 0x00, 0xD0, 0xB2, 0x5B, 0x00, 0x01, 0x00, 0xD1, 0xB8, 0x5B, 0x00,
+    0x01, 0x00, 0xD1, 0xBE, 0x5B, 0x00, 0x01, 0x00, 0xD1, 0xC4, 0x5B, 0x00, 0x01, 0x00, 0xD0, 0xCA,
+    0x5B, 0x00, 0x01, 0x00, 0xD0, 0xD0, 0x5B, 0x00, 0x01, 0x00, 0xD1, 0xD6, 0x5B, 0x00, 0x01, 0x00,
+    0xD0, 0xDC, 0x5B, 0x00, 0x01, 0x00, 0xD0, 0xE2, 0x5B, 0x00, 0x01, 0x00, 0xD1, 0xE8, 0x5B, 0x00,
+    0x01, 0x00, 0xD1, 0xEE, 0x5B, 0x00, 0x01, 0x00, 0xD0, 0xF4, 0x5B, 0x00, 0x01, 0x00, 0xD1, 0xFA,
+    0x5B, 0x00, 0x01, 0x00, 0xD0, 0x00, 0x5C, 0x00, 0x01, 0x00, 0xD0, 0x06, 0x5C, 0x00, 0x01, 0x00,
+    0xD0, 0x0C, 0x5C, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x12, 0x5C, 0x00, 0x1C, 0x5C, 0x00, 0x01, 0x00,
+    0xD0, 0x22, 0x5C, 0x00, 0x01, 0x00, 0xD1, 0x30, 0x5C, 0x00, 0x01, 0x00, 0xD0, 0x36, 0x5C, 0x00,
+    0x01, 0x00, 0xD1, 0x3C, 0x5C, 0x00, 0x01, 0x00, 0xD0, 0x42, 0x5C, 0x00, 0x01, 0x00, 0xD1, 0x48,
+    0x5C, 0x00, 0x01, 0x00, 0xD0, 0x4E, 0x5C, 0x00, 0x01, 0x00, 0xD1, 0x10, 0x32, 0x00, 0x01, 0x00,
+    0xD0, 0x14, 0x4E, 0x00, 0x01, 0x00, 0xD1, 0x54, 0x5C, 0x00, 0x01, 0x00, 0xD0, 0x5A, 0x5C, 0x00,
+    0x01, 0x00, 0xD0, 0x60, 0x5C, 0x00, 0x01, 0x00, 0xD0, 0x66, 0x5C, 0x00, 0x01, 0x00, 0x8C, 0x28,
+    0x28, 0x00, 0x01, 0x00, 0xD1, 0x6C, 0x5C, 0x00, 0x01, 0x00, 0xD0, 0x72, 0x5C, 0x00, 0x01, 0x00,
+    0xD0, 0x78, 0x5C, 0x00, 0x01, 0x00, 0xD1, 0x7E, 0x5C, 0x00, 0x01, 0x00, 0xD0, 0x84, 0x5C, 0x00,
+    0x01, 0x00, 0xD0, 0x8A, 0x5C, 0x00, 0x01, 0x00, 0xD0, 0x90, 0x5C, 0x00, 0x01, 0x00, 0xD0, 0x96,
+    0x5C, 0x00, 0x01, 0x00, 0xD1, 0xA0, 0x5C, 0x00, 0x01, 0x00, 0xD0, 0xA6, 0x5C, 0x00, 0x01, 0x00,
+    0xD0, 0xAC, 0x5C, 0x00, 0x01, 0x00, 0xD0, 0xB6, 0x5C, 0x00, 0x01, 0x00, 0xD0, 0xC0, 0x5C, 0x00,
+    0x01, 0x00, 0xD0, 0xC6, 0x5C, 0x00, 0x01, 0x00, 0xD0, 0xCC, 0x5C, 0x00, 0x01, 0x00, 0xD0, 0x14,
+    0x49, 0x00, 0x01, 0x01, 0x40, 0x00, 0xD0, 0xD2, 0x5C, 0x00, 0x01, 0x00, 0xD1, 0xD8, 0x5C, 0x00,
+    0x01, 0x00, 0xD0, 0xDE, 0x5C, 0x00, 0x01, 0x00, 0xD1, 0xE4, 0x5C, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xEA, 0x5C, 0x00, 0xF8, 0x5C, 0x00, 0x01, 0x00, 0xD0, 0x02, 0x5D, 0x00, 0x01, 0x00, 0xD0, 0x08,
+    0x5D, 0x00, 0x01, 0x00, 0xD0, 0x12, 0x5D, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x18, 0x5D, 0x00, 0x1E,
+    0x5D, 0x00, 0x01, 0x01, 0x40, 0x00, 0xD0, 0x24, 0x5D, 0x00, 0x01, 0x00, 0xD0, 0x2A, 0x5D, 0x00,
+    0x01, 0x00, 0xD0, 0x30, 0x5D, 0x00, 0x01, 0x00, 0xD0, 0x36, 0x5D, 0x00, 0x01, 0x00, 0x2E, 0x3C,
+    0x5D, 0x00, 0x01, 0x00, 0xD1, 0x40, 0x5D, 0x00, 0x01, 0x00, 0xD0, 0x46, 0x5D, 0x00, 0x01, 0x00,
+    0xD1, 0x4C, 0x5D, 0x00, 0x01, 0x00, 0xD0, 0x52, 0x5D, 0x00, 0x01, 0x00, 0xD0, 0xAC, 0x2F, 0x00,
+    0x01, 0x00, 0xD0, 0x58, 0x5D, 0x00, 0x01, 0x00, 0xD1, 0x62, 0x5D, 0x00, 0x01, 0x00, 0xD0, 0x68,
+    0x5D, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x01, 0x00, 0xD0, 0x6E, 0x5D, 0x00, 0x01, 0x00, 0xD0, 0x74,
+    0x5D, 0x00, 0x01, 0x00, 0xD0, 0x7A, 0x5D, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x80, 0x5D, 0x00, 0x86,
+    0x5D, 0x00, 0x01, 0x00, 0xD1, 0x8C, 0x5D, 0x00, 0x01, 0x00, 0xD0, 0x92, 0x5D, 0x00, 0x01, 0x00,
+    0xD0, 0x98, 0x5D, 0x00, 0x01, 0x00, 0xD0, 0x9E, 0x5D, 0x00, 0x01, 0x00, 0xD0, 0xA4, 0x5D, 0x00,
+    0x01, 0x00, 0xD1, 0xAA, 0x5D, 0x00, 0x01, 0x00, 0xD0, 0xB0, 0x5D, 0x00, 0x01, 0x00, 0xD0, 0xB6,
+    0x5D, 0x00, 0x01, 0x00, 0xD0, 0xBC, 0x5D, 0x00, 0x01, 0x00, 0xD0, 0xC2, 0x5D, 0x00, 0x01, 0x00,
+    0xD1, 0xC8, 0x5D, 0x00, 0x01, 0x00, 0x27, 0xD2, 0x5D, 0x00, 0x01, 0x00, 0xD0, 0xD8, 0x5D, 0x00,
+    0x01, 0x00, 0xD0, 0xE2, 0x5D, 0x00, 0x01, 0x00, 0xD0, 0xE8, 0x5D, 0x00, 0x01, 0x00, 0xD1, 0xF2,
+    0x5D, 0x00, 0x01, 0x00, 0xD0, 0xF8, 0x5D, 0x00, 0x01, 0x00, 0xD1, 0xFE, 0x5D, 0x00, 0x01, 0x00,
+    0xD0, 0x08, 0x5E, 0x00, 0x01, 0x01, 0x40, 0x00, 0xD0, 0x0E, 0x5E, 0x00, 0x01, 0x00, 0xD1, 0x14,
+    0x5E, 0x00, 0x01, 0x00, 0xD0, 0x1A, 0x5E, 0x00, 0x01, 0x00, 0xD0, 0x20, 0x5E, 0x00, 0x01, 0x00,
+    0xD0, 0x26, 0x5E, 0x00, 0x01, 0x00, 0xD1, 0x2C, 0x5E, 0x00, 0x01, 0x00, 0xD0, 0x32, 0x5E, 0x00,
+    0x01, 0x00, 0xD0, 0x38, 0x5E, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x3E, 0x5E, 0x00, 0x5C, 0x5E, 0x00,
+    0x01, 0x00, 0xD1, 0x66, 0x5E, 0x00, 0x00, 0x02, 0xE7, 0x00, 0x01, 0x00, 0xD0, 0x6C, 0x5E, 0x00,
+    0x01, 0x00, 0xD0, 0x72, 0x5E, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x78, 0x5E, 0x00, 0x82, 0x5E, 0x00,
+    0x01, 0x00, 0xD0, 0x8C, 0x5E, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x92, 0x5E, 0x00, 0xA4, 0x5E, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0xAE, 0x5E, 0x00, 0xB4, 0x5E, 0x00, 0x01, 0x00, 0xD1, 0xBA, 0x5E, 0x00,
+    0x01, 0x00, 0xD1, 0xC0, 0x5E, 0x00, 0x02, 0x00, 0x8E, 0x94, 0xC6, 0x5E, 0x00, 0xC6, 0x5E, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0xCA, 0x5E, 0x00, 0xD0, 0x5E, 0x00, 0x00, 0x03, 0xA3, 0x00, 0x00, 0x02,
+    0x89, 0x00, 0x01, 0x00, 0xD0, 0xD6, 0x5E, 0x00, 0x01, 0x00, 0xD1, 0xDC, 0x5E, 0x00, 0x01, 0x00,
+    0xD0, 0xE2, 0x5E, 0x00, 0x01, 0x00, 0xD0, 0xE8, 0x5E, 0x00, 0x01, 0x00, 0xD0, 0xEE, 0x5E, 0x00,
+    0x01, 0x00, 0xD1, 0xF4, 0x5E, 0x00, 0x01, 0x00, 0xD1, 0xFA, 0x5E, 0x00, 0x01, 0x00, 0xD0, 0x00,
+    0x5F, 0x00, 0x01, 0x00, 0xD1, 0x06, 0x5F, 0x00, 0x01, 0x00, 0xD0, 0x0C, 0x5F, 0x00, 0x01, 0x00,
+    0xD0, 0x12, 0x5F, 0x00, 0x00, 0x02, 0x04, 0x01, 0x01, 0x00, 0xD0, 0x18, 0x5F, 0x00, 0x01, 0x00,
+    0xD1, 0x1E, 0x5F, 0x00, 0x01, 0x00, 0xD0, 0x36, 0x29, 0x00, 0x01, 0x00, 0xD0, 0x24, 0x5F, 0x00,
+    0x01, 0x00, 0xD0, 0x2A, 0x5F, 0x00, 0x01, 0x00, 0xD0, 0x30, 0x5F, 0x00, 0x01, 0x00, 0xD1, 0x36,
+    0x5F, 0x00, 0x01, 0x00, 0xD0, 0x3C, 0x5F, 0x00, 0x01, 0x00, 0xD1, 0x42, 0x5F, 0x00, 0x01, 0x00,
+    0xD0, 0x48, 0x5F, 0x00, 0x01, 0x00, 0xD1, 0x4E, 0x5F, 0x00, 0x01, 0x00, 0xD0, 0x54, 0x5F, 0x00,
+    0x01, 0x00, 0xD0, 0x5A, 0x5F, 0x00, 0x01, 0x00, 0xD0, 0x60, 0x5F, 0x00, 0x01, 0x00, 0xD0, 0x66,
+    0x5F, 0x00, 0x01, 0x00, 0xD0, 0x6C, 0x5F, 0x00, 0x01, 0x00, 0xD0, 0x72, 0x5F, 0x00, 0x01, 0x00,
+    0xBE, 0xDE, 0x44, 0x00, 0x01, 0x00, 0xBD, 0x28, 0x28, 0x00, 0x03, 0x00, 0x8E, 0x8F, 0x94, 0xC6,
+    0x5E, 0x00, 0xC6, 0x5E, 0x00, 0xC6, 0x5E, 0x00, 0x01, 0x00, 0xD1, 0x78, 0x5F, 0x00, 0x00, 0x02,
+    0x4F, 0x00, 0x01, 0x00, 0x8F, 0xC6, 0x5E, 0x00, 0x01, 0x00, 0xD0, 0x7E, 0x5F, 0x00, 0x01, 0x00,
+    0xD0, 0x84, 0x5F, 0x00, 0x01, 0x00, 0xD0, 0x8A, 0x5F, 0x00, 0x01, 0x00, 0xD0, 0x90, 0x5F, 0x00,
+    0x01, 0x00, 0xD0, 0x96, 0x5F, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x9C, 0x5F, 0x00, 0xA2, 0x5F, 0x00,
+    0x01, 0x00, 0xB7, 0x6A, 0x3C, 0x00, 0x01, 0x00, 0xD1, 0xAC, 0x5F, 0x00, 0x01, 0x00, 0xD0, 0xB2,
+    0x5F, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xB8, 0x5F, 0x00, 0xBE, 0x5F, 0x00, 0x01, 0x00, 0xD0, 0xC4,
+    0x5F, 0x00, 0x02, 0x01, 0x40, 0x00, 0xD0, 0xD1, 0xCA, 0x5F, 0x00, 0xD0, 0x5F, 0x00, 0x01, 0x00,
+    0xD0, 0xD6, 0x5F, 0x00, 0x01, 0x00, 0xD1, 0xDC, 0x5F, 0x00, 0x01, 0x00, 0xD1, 0xE2, 0x5F, 0x00,
+    0x01, 0x00, 0xD0, 0xE8, 0x5F, 0x00, 0x01, 0x00, 0xD1, 0xEE, 0x5F, 0x00, 0x01, 0x00, 0xD1, 0xF4,
+    0x5F, 0x00, 0x01, 0x00, 0xD0, 0xFA, 0x5F, 0x00, 0x01, 0x00, 0xD1, 0x00, 0x60, 0x00, 0x01, 0x00,
+    0xD0, 0x06, 0x60, 0x00, 0x01, 0x00, 0xD0, 0x0C, 0x60, 0x00, 0x01, 0x00, 0xD1, 0x12, 0x60, 0x00,
+    0x01, 0x00, 0xD0, 0x18, 0x60, 0x00, 0x01, 0x00, 0xD0, 0x1E, 0x60, 0x00, 0x01, 0x00, 0xD1, 0x24,
+    0x60, 0x00, 0x01, 0x00, 0xD0, 0x2A, 0x60, 0x00, 0x01, 0x00, 0xD1, 0x30, 0x60, 0x00, 0x01, 0x00,
+    0xD0, 0x36, 0x60, 0x00, 0x02, 0x00, 0x2E, 0xD0, 0x3C, 0x5D, 0x00, 0xD2, 0x44, 0x00, 0x01, 0x00,
+    0x88, 0xDE, 0x44, 0x00, 0x01, 0x00, 0xD0, 0x3C, 0x60, 0x00, 0x01, 0x00, 0xD0, 0x42, 0x60, 0x00,
+    0x01, 0x00, 0xD1, 0x4C, 0x60, 0x00, 0x01, 0x00, 0xD0, 0x52, 0x60, 0x00, 0x01, 0x00, 0xD0, 0x5C,
+    0x60, 0x00, 0x02, 0x00, 0x8E, 0x8F, 0xC6, 0x5E, 0x00, 0xC6, 0x5E, 0x00, 0x01, 0x00, 0xD1, 0x62,
+    0x60, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x68, 0x60, 0x00, 0x72, 0x60, 0x00, 0x01, 0x00, 0xD0, 0x78,
+    0x60, 0x00, 0x01, 0x00, 0xD0, 0x7E, 0x60, 0x00, 0x01, 0x00, 0xD0, 0x84, 0x60, 0x00, 0x01, 0x00,
+    0xD1, 0x8A, 0x60, 0x00, 0x01, 0x00, 0xD1, 0x90, 0x60, 0x00, 0x01, 0x02, 0x55, 0x00, 0xD0, 0x96,
+    0x60, 0x00, 0x01, 0x02, 0x55, 0x00, 0xD1, 0x9C, 0x60, 0x00, 0x01, 0x00, 0xD0, 0xA2, 0x60, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0xA8, 0x60, 0x00, 0xB6, 0x60, 0x00, 0x01, 0x00, 0xD0, 0xC0, 0x60, 0x00,
+    0x01, 0x00, 0xD0, 0xC6, 0x60, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xCC, 0x60, 0x00, 0xD2, 0x60, 0x00,
+    0x01, 0x00, 0xD1, 0xD8, 0x60, 0x00, 0x01, 0x00, 0xD0, 0xDE, 0x60, 0x00, 0x01, 0x00, 0xD1, 0xE4,
+    0x60, 0x00, 0x01, 0x00, 0xD0, 0xEA, 0x60, 0x00, 0x01, 0x00, 0xD1, 0xF0, 0x60, 0x00, 0x01, 0x00,
+    0xD0, 0xFA, 0x60, 0x00, 0x01, 0x00, 0xD0, 0x00, 0x61, 0x00, 0x01, 0x00, 0xD1, 0x06, 0x61, 0x00,
+    0x01, 0x00, 0xD0, 0x10, 0x61, 0x00, 0x01, 0x00, 0xD0, 0x1A, 0x61, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x24, 0x61, 0x00, 0x2E, 0x61, 0x00, 0x01, 0x00, 0xD0, 0x34, 0x61, 0x00, 0x01, 0x00, 0xD0, 0x3A,
+    0x61, 0x00, 0x01, 0x00, 0xD0, 0x40, 0x61, 0x00, 0x01, 0x00, 0xD1, 0x46, 0x61, 0x00, 0x01, 0x00,
+    0xD0, 0x4C, 0x61, 0x00, 0x01, 0x00, 0xD0, 0x52, 0x61, 0x00, 0x01, 0x00, 0xD1, 0x58, 0x61, 0x00,
+    0x02, 0x00, 0x2E, 0xD0, 0x3C, 0x5D, 0x00, 0x5E, 0x61, 0x00, 0x01, 0x00, 0xD0, 0x64, 0x61, 0x00,
+    0x01, 0x00, 0xD0, 0x6A, 0x61, 0x00, 0x01, 0x00, 0xD1, 0x70, 0x61, 0x00, 0x01, 0x01, 0x66, 0x00,
+    0xD0, 0x7E, 0x5F, 0x00, 0x01, 0x00, 0xD0, 0x76, 0x61, 0x00, 0x02, 0x00, 0xB4, 0xBA, 0x0C, 0x3D,
+    0x00, 0xD2, 0x3B, 0x00, 0x01, 0x00, 0xD0, 0x7C, 0x61, 0x00, 0x01, 0x00, 0xD0, 0x82, 0x61, 0x00,
+    0x01, 0x00, 0xD0, 0x88, 0x61, 0x00, 0x01, 0x00, 0xD0, 0x8E, 0x61, 0x00, 0x01, 0x00, 0xD0, 0x94,
+    0x61, 0x00, 0x01, 0x00, 0xD0, 0x9A, 0x61, 0x00, 0x01, 0x00, 0x27, 0xA0, 0x61, 0x00, 0x01, 0x02,
+    0x46, 0x00, 0xD1, 0xA6, 0x61, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xAC, 0x61, 0x00, 0xD0, 0x5F, 0x00,
+    0x00, 0x02, 0x48, 0x00, 0x01, 0x00, 0xD0, 0xAA, 0x34, 0x00, 0x01, 0x00, 0xD0, 0xBA, 0x61, 0x00,
+    0x00, 0x01, 0x4E, 0x00, 0x01, 0x00, 0xD0, 0xC0, 0x61, 0x00, 0x01, 0x00, 0xD1, 0xCA, 0x61, 0x00,
+    0x01, 0x00, 0xD0, 0xD0, 0x61, 0x00, 0x01, 0x00, 0xD0, 0xD6, 0x61, 0x00, 0x01, 0x00, 0xD1, 0xDC,
+    0x61, 0x00, 0x01, 0x00, 0xD0, 0xE6, 0x61, 0x00, 0x01, 0x00, 0xD0, 0xEC, 0x61, 0x00, 0x01, 0x00,
+    0xD1, 0xF2, 0x61, 0x00, 0x01, 0x00, 0xD1, 0xF8, 0x61, 0x00, 0x01, 0x00, 0xD1, 0xFE, 0x61, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x04, 0x62, 0x00, 0x22, 0x62, 0x00, 0x01, 0x00, 0xD1, 0x2C, 0x62, 0x00,
+    0x01, 0x00, 0xD0, 0x32, 0x62, 0x00, 0x01, 0x00, 0xD0, 0x38, 0x62, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x3E, 0x62, 0x00, 0x72, 0x60, 0x00, 0x01, 0x00, 0xD0, 0x48, 0x62, 0x00, 0x01, 0x00, 0xD1, 0x52,
+    0x62, 0x00, 0x01, 0x00, 0xD1, 0x58, 0x62, 0x00, 0x01, 0x00, 0xD0, 0x5E, 0x62, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x64, 0x62, 0x00, 0x6E, 0x62, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x68, 0x5D, 0x00, 0x78,
+    0x62, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x82, 0x62, 0x00, 0x9C, 0x62, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xAE, 0x62, 0x00, 0xB8, 0x62, 0x00, 0x01, 0x00, 0xD0, 0xBE, 0x62, 0x00, 0x01, 0x01, 0x6E, 0x00,
+    0xD0, 0x28, 0x4B, 0x00, 0x01, 0x00, 0xD1, 0xC4, 0x62, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xCA, 0x62,
+    0x00, 0xD0, 0x5F, 0x00, 0x01, 0x00, 0xD1, 0xD4, 0x62, 0x00, 0x01, 0x00, 0xD1, 0xDA, 0x62, 0x00,
+    0x00, 0x01, 0x54, 0x00, 0x01, 0x00, 0xD0, 0xE0, 0x62, 0x00, 0x01, 0x00, 0xD0, 0xE6, 0x62, 0x00,
+    0x01, 0x00, 0xD0, 0xEC, 0x62, 0x00, 0x01, 0x00, 0xD0, 0xF2, 0x62, 0x00, 0x01, 0x00, 0xD1, 0xF8,
+    0x62, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xFE, 0x62, 0x00, 0x04, 0x63, 0x00, 0x01, 0x00, 0xD1, 0x0A,
+    0x63, 0x00, 0x01, 0x00, 0xD0, 0x96, 0x60, 0x00, 0x01, 0x00, 0xD0, 0x10, 0x63, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x16, 0x63, 0x00, 0x20, 0x63, 0x00, 0x01, 0x00, 0xD0, 0x26, 0x63, 0x00, 0x01, 0x00,
+    0xD1, 0x2C, 0x63, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x32, 0x63, 0x00, 0x38, 0x63, 0x00, 0x01, 0x00,
+    0xD0, 0x3E, 0x63, 0x00, 0x01, 0x00, 0xD0, 0x48, 0x63, 0x00, 0x01, 0x00, 0xD0, 0x4E, 0x63, 0x00,
+    0x02, 0x00, 0x8F, 0x94, 0x54, 0x63, 0x00, 0x5A, 0x63, 0x00, 0x01, 0x00, 0xD0, 0x60, 0x63, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x6E, 0x63, 0x00, 0x74, 0x63, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x7A, 0x63,
+    0x00, 0x80, 0x63, 0x00, 0x01, 0x00, 0xD0, 0x86, 0x63, 0x00, 0x01, 0x00, 0xD0, 0x8C, 0x63, 0x00,
+    0x01, 0x00, 0xD1, 0x92, 0x63, 0x00, 0x01, 0x00, 0xD1, 0x98, 0x63, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x9E, 0x63, 0x00, 0xA8, 0x63, 0x00, 0x01, 0x00, 0xD0, 0xAE, 0x63, 0x00, 0x01, 0x00, 0xD0, 0xB4,
+    0x63, 0x00, 0x01, 0x00, 0xD1, 0xBA, 0x63, 0x00, 0x01, 0x00, 0xD1, 0xC0, 0x63, 0x00, 0x01, 0x00,
+    0xD1, 0xC6, 0x63, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xCC, 0x63, 0x00, 0xD2, 0x63, 0x00, 0x01, 0x00,
+    0xD0, 0xDC, 0x63, 0x00, 0x01, 0x00, 0xD1, 0xE2, 0x63, 0x00, 0x01, 0x02, 0x46, 0x00, 0xD0, 0xE8,
+    0x63, 0x00, 0x01, 0x00, 0xD0, 0xEE, 0x63, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xF4, 0x63, 0x00, 0x04,
+    0x63, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xA4, 0x5D, 0x00, 0xC8, 0x5D, 0x00, 0x01, 0x00, 0xD1, 0x88,
+    0x33, 0x00, 0x01, 0x00, 0xD1, 0x06, 0x64, 0x00, 0x01, 0x00, 0xD1, 0x0C, 0x64, 0x00, 0x01, 0x00,
+    0xD1, 0x12, 0x64, 0x00, 0x01, 0x00, 0xD0, 0x1C, 0x64, 0x00, 0x01, 0x00, 0xD0, 0x22, 0x64, 0x00,
+    0x01, 0x00, 0xD1, 0x30, 0x34, 0x00, 0x01, 0x02, 0x46, 0x00, 0xD0, 0x90, 0x5F, 0x00, 0x01, 0x02,
+    0x46, 0x00, 0xD1, 0x28, 0x64, 0x00, 0x01, 0x00, 0xD1, 0x2E, 0x64, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x7C, 0x61, 0x00, 0x34, 0x64, 0x00, 0x01, 0x00, 0xD1, 0x3A, 0x64, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x94, 0x61, 0x00, 0x40, 0x64, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xAA, 0x34, 0x00, 0x3A, 0x64, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x46, 0x64, 0x00, 0x4C, 0x64, 0x00, 0x01, 0x00, 0xD0, 0x52, 0x64, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x5C, 0x64, 0x00, 0x6A, 0x64, 0x00, 0x01, 0x00, 0xD0, 0x84, 0x64, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x8A, 0x64, 0x00, 0x94, 0x64, 0x00, 0x01, 0x00, 0xD1, 0x9A, 0x64, 0x00,
+    0x01, 0x00, 0xD1, 0xA0, 0x64, 0x00, 0x01, 0x00, 0xD0, 0xA6, 0x64, 0x00, 0x01, 0x00, 0xD0, 0xAC,
+    0x64, 0x00, 0x01, 0x00, 0xD1, 0xB2, 0x64, 0x00, 0x01, 0x00, 0xD0, 0xB8, 0x64, 0x00, 0x01, 0x00,
+    0xD0, 0xBE, 0x64, 0x00, 0x01, 0x00, 0xD1, 0xC4, 0x64, 0x00, 0x01, 0x02, 0x41, 0x00, 0x2E, 0x3C,
+    0x5D, 0x00, 0x01, 0x00, 0xD0, 0xCA, 0x64, 0x00, 0x01, 0x00, 0xD0, 0xD0, 0x64, 0x00, 0x01, 0x00,
+    0xD0, 0xD6, 0x64, 0x00, 0x01, 0x00, 0xD0, 0xDC, 0x64, 0x00, 0x01, 0x00, 0xD0, 0xE6, 0x64, 0x00,
+    0x01, 0x00, 0xD0, 0xEC, 0x64, 0x00, 0x01, 0x00, 0xD0, 0xF2, 0x64, 0x00, 0x01, 0x00, 0xD0, 0xF8,
+    0x64, 0x00, 0x01, 0x00, 0xD0, 0xFE, 0x64, 0x00, 0x01, 0x00, 0xD0, 0x04, 0x65, 0x00, 0x01, 0x02,
+    0x46, 0x00, 0xD0, 0xB2, 0x5F, 0x00, 0x01, 0x00, 0xD1, 0x0A, 0x65, 0x00, 0x01, 0x00, 0xD0, 0x10,
+    0x65, 0x00, 0x01, 0x00, 0xD0, 0x16, 0x65, 0x00, 0x01, 0x00, 0xD0, 0x1C, 0x65, 0x00, 0x01, 0x00,
+    0xD1, 0x22, 0x65, 0x00, 0x01, 0x00, 0xD0, 0x28, 0x65, 0x00, 0x01, 0x00, 0xD1, 0x2E, 0x65, 0x00,
+    0x01, 0x00, 0xD0, 0x34, 0x65, 0x00, 0x01, 0x00, 0xD0, 0x3A, 0x65, 0x00, 0x01, 0x00, 0xD0, 0x08,
+    0x34, 0x00, 0x01, 0x00, 0xD1, 0x40, 0x65, 0x00, 0x01, 0x00, 0xD0, 0x46, 0x65, 0x00, 0x01, 0x00,
+    0xD0, 0x4C, 0x65, 0x00, 0x01, 0x00, 0xD0, 0x52, 0x65, 0x00, 0x01, 0x00, 0xD0, 0x58, 0x65, 0x00,
+    0x01, 0x00, 0xD1, 0x5E, 0x65, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x64, 0x65, 0x00, 0x6A, 0x65, 0x00,
+    0x01, 0x00, 0xD1, 0x70, 0x65, 0x00, 0x01, 0x00, 0xD1, 0x76, 0x65, 0x00, 0x01, 0x00, 0xD1, 0x7C,
+    0x65, 0x00, 0x01, 0x00, 0x2E, 0x82, 0x65, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x86, 0x65, 0x00, 0x8C,
+    0x65, 0x00, 0x01, 0x00, 0xD0, 0x92, 0x65, 0x00, 0x00, 0x01, 0x39, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0x98, 0x65, 0x00, 0xA6, 0x65, 0x00, 0x00, 0x02, 0x22, 0x00, 0x00, 0x02, 0x1F, 0x00, 0x01, 0x00,
+    0xD1, 0xB0, 0x65, 0x00, 0x01, 0x00, 0xD0, 0xB6, 0x65, 0x00, 0x01, 0x00, 0xD0, 0xC0, 0x65, 0x00,
+    0x01, 0x02, 0x1F, 0x00, 0xD0, 0xC6, 0x65, 0x00, 0x01, 0x01, 0x21, 0x00, 0xD1, 0xCC, 0x65, 0x00,
+    0x01, 0x00, 0xD1, 0xD2, 0x65, 0x00, 0x01, 0x00, 0xD0, 0xD8, 0x65, 0x00, 0x01, 0x00, 0x2E, 0x70,
+    0x48, 0x00, 0x01, 0x01, 0x26, 0x00, 0xD0, 0xDE, 0x65, 0x00, 0x01, 0x00, 0xD0, 0xE8, 0x65, 0x00,
+    0x01, 0x00, 0xD1, 0xEE, 0x65, 0x00, 0x00, 0x02, 0x15, 0x00, 0x01, 0x00, 0xD0, 0xF4, 0x65, 0x00,
+    0x01, 0x00, 0xB5, 0xB8, 0x51, 0x00, 0x01, 0x00, 0xBA, 0x60, 0x58, 0x00, 0x01, 0x00, 0xB4, 0x60,
+    0x58, 0x00, 0x01, 0x00, 0x80, 0xFA, 0x65, 0x00, 0x01, 0x00, 0xB2, 0x74, 0x3E, 0x00, 0x01, 0x00,
+    0xBB, 0x24, 0x39, 0x00, 0x01, 0x00, 0xBA, 0x82, 0x3A, 0x00, 0x01, 0x00, 0xB5, 0x00, 0x66, 0x00,
+    0x01, 0x00, 0xB0, 0x4C, 0x38, 0x00, 0x01, 0x00, 0xBF, 0xD2, 0x3B, 0x00, 0x01, 0x00, 0xB7, 0xB0,
+    0x39, 0x00, 0x01, 0x00, 0xB3, 0x28, 0x52, 0x00, 0x01, 0x00, 0x96, 0x06, 0x66, 0x00, 0x01, 0x00,
+    0x87, 0x0C, 0x66, 0x00, 0x01, 0x00, 0x96, 0x8E, 0x51, 0x00, 0x01, 0x00, 0xBE, 0x8A, 0x57, 0x00,
+    0x01, 0x00, 0xB0, 0x10, 0x66, 0x00, 0x01, 0x00, 0x81, 0x24, 0x39, 0x00, 0x01, 0x00, 0xBA, 0x24,
+    0x39, 0x00, 0x01, 0x00, 0xB4, 0x24, 0x39, 0x00, 0x01, 0x00, 0x8F, 0x16, 0x66, 0x00, 0x01, 0x00,
+    0x82, 0x1C, 0x66, 0x00, 0x01, 0x00, 0xBC, 0x2A, 0x53, 0x00, 0x01, 0x00, 0x84, 0x22, 0x66, 0x00,
+    0x01, 0x00, 0xB7, 0x28, 0x66, 0x00, 0x01, 0x00, 0xB5, 0x2E, 0x66, 0x00, 0x01, 0x00, 0xB0, 0x34,
+    0x66, 0x00, 0x02, 0x00, 0xB0, 0xB5, 0x3A, 0x66, 0x00, 0x40, 0x66, 0x00, 0x01, 0x00, 0x96, 0x46,
+    0x66, 0x00, 0x03, 0x00, 0xB1, 0xB4, 0xB7, 0x4C, 0x66, 0x00, 0x52, 0x66, 0x00, 0x58, 0x66, 0x00,
+    0x01, 0x00, 0x96, 0x5E, 0x66, 0x00, 0x01, 0x00, 0xB8, 0x46, 0x66, 0x00, 0x01, 0x00, 0x81, 0x64,
+    0x66, 0x00, 0x01, 0x00, 0xB0, 0x6A, 0x66, 0x00, 0x01, 0x00, 0x96, 0x70, 0x66, 0x00, 0x01, 0x00,
+    0xB5, 0x76, 0x66, 0x00, 0x01, 0x00, 0x80, 0x3E, 0x55, 0x00, 0x01, 0x00, 0xBE, 0x60, 0x58, 0x00,
+    0x01, 0x00, 0xBA, 0x7C, 0x66, 0x00, 0x01, 0x00, 0xBE, 0x34, 0x52, 0x00, 0x01, 0x00, 0x80, 0x82,
+    0x66, 0x00, 0x01, 0x00, 0xBD, 0x88, 0x66, 0x00, 0x01, 0x00, 0xB5, 0x8E, 0x66, 0x00, 0x01, 0x00,
+    0x82, 0x82, 0x66, 0x00, 0x01, 0x00, 0xBD, 0x94, 0x66, 0x00, 0x01, 0x00, 0xBD, 0x9A, 0x66, 0x00,
+    0x01, 0x00, 0xBD, 0xA0, 0x66, 0x00, 0x02, 0x00, 0xB2, 0xB4, 0xA6, 0x66, 0x00, 0xAC, 0x66, 0x00,
+    0x01, 0x00, 0x96, 0xB2, 0x66, 0x00, 0x01, 0x00, 0xBC, 0xB8, 0x66, 0x00, 0x02, 0x00, 0xB3, 0xBF,
+    0xBE, 0x66, 0x00, 0xC4, 0x66, 0x00, 0x02, 0x00, 0xB4, 0xBC, 0xCA, 0x66, 0x00, 0xD0, 0x66, 0x00,
+    0x01, 0x00, 0xB1, 0xD6, 0x66, 0x00, 0x01, 0x00, 0xBD, 0xDC, 0x66, 0x00, 0x01, 0x00, 0xBD, 0xE0,
+    0x66, 0x00, 0x01, 0x00, 0xBF, 0xE6, 0x66, 0x00, 0x01, 0x00, 0x96, 0xD4, 0x39, 0x00, 0x01, 0x00,
+    0xB0, 0x46, 0x66, 0x00, 0x01, 0x00, 0x81, 0xEC, 0x66, 0x00, 0x03, 0x00, 0xBC, 0xBE, 0xBF, 0xF2,
+    0x66, 0x00, 0xF8, 0x66, 0x00, 0xFE, 0x66, 0x00, 0x02, 0x00, 0x80, 0x96, 0x04, 0x67, 0x00, 0x0A,
+    0x67, 0x00, 0x01, 0x00, 0xBE, 0x10, 0x67, 0x00, 0x02, 0x00, 0xB0, 0xB4, 0x1A, 0x67, 0x00, 0x20,
+    0x67, 0x00, 0x01, 0x00, 0xBE, 0x26, 0x67, 0x00, 0x01, 0x00, 0xBE, 0x2C, 0x67, 0x00, 0x01, 0x00,
+    0x80, 0x32, 0x67, 0x00, 0x01, 0x00, 0xB4, 0x38, 0x67, 0x00, 0x01, 0x00, 0xB8, 0xD4, 0x39, 0x00,
+    0x01, 0x00, 0xB0, 0x4A, 0x39, 0x00, 0x01, 0x00, 0xB6, 0x40, 0x67, 0x00, 0x00, 0x03, 0x5A, 0x00,
+    0x01, 0x00, 0x96, 0x46, 0x67, 0x00, 0x01, 0x00, 0xB4, 0x4C, 0x67, 0x00, 0x01, 0x00, 0x80, 0x52,
+    0x67, 0x00, 0x01, 0x00, 0xB3, 0x6A, 0x3C, 0x00, 0x02, 0x00, 0xB7, 0xBE, 0xB0, 0x39, 0x00, 0x4C,
+    0x38, 0x00, 0x01, 0x00, 0x82, 0x4C, 0x67, 0x00, 0x01, 0x00, 0xBD, 0x80, 0x57, 0x00, 0x01, 0x00,
+    0xB9, 0x58, 0x67, 0x00, 0x01, 0x00, 0xB8, 0x8E, 0x38, 0x00, 0x01, 0x00, 0xB4, 0x6A, 0x3C, 0x00,
+    0x01, 0x00, 0xB7, 0x62, 0x67, 0x00, 0x01, 0x00, 0x81, 0x68, 0x67, 0x00, 0x01, 0x00, 0x82, 0x6E,
+    0x67, 0x00, 0x01, 0x00, 0xBE, 0x74, 0x67, 0x00, 0x01, 0x00, 0xB0, 0x78, 0x67, 0x00, 0x01, 0x00,
+    0xB0, 0xAA, 0x55, 0x00, 0x01, 0x00, 0xB2, 0x6A, 0x3C, 0x00, 0x01, 0x00, 0x8F, 0xFC, 0x38, 0x00,
+    0x01, 0x00, 0xB2, 0x18, 0x5A, 0x00, 0x01, 0x00, 0xBB, 0x6A, 0x51, 0x00, 0x01, 0x00, 0xBB, 0xCA,
+    0x38, 0x00, 0x01, 0x00, 0xB0, 0xB8, 0x41, 0x00, 0x02, 0x00, 0x82, 0x87, 0x6A, 0x3C, 0x00, 0x6A,
+    0x3C, 0x00, 0x01, 0x00, 0xD1, 0x7E, 0x67, 0x00, 0x02, 0x00, 0xBD, 0xBE, 0x6E, 0x54, 0x00, 0x84,
+    0x67, 0x00, 0x01, 0x00, 0xBD, 0x88, 0x67, 0x00, 0x02, 0x00, 0xB1, 0xBC, 0x8E, 0x67, 0x00, 0x6E,
+    0x54, 0x00, 0x01, 0x00, 0x87, 0x60, 0x58, 0x00, 0x01, 0x00, 0xBC, 0x94, 0x67, 0x00, 0x02, 0x00,
+    0x80, 0x83, 0x9A, 0x67, 0x00, 0xA0, 0x67, 0x00, 0x01, 0x00, 0xB5, 0xA6, 0x67, 0x00, 0x01, 0x00,
+    0xBE, 0xAC, 0x67, 0x00, 0x01, 0x00, 0x8C, 0xD4, 0x39, 0x00, 0x01, 0x00, 0xB0, 0xFE, 0x37, 0x00,
+    0x01, 0x00, 0xBC, 0xB2, 0x67, 0x00, 0x01, 0x00, 0xBE, 0xB8, 0x67, 0x00, 0x01, 0x00, 0x80, 0xC0,
+    0x67, 0x00, 0x01, 0x00, 0xB0, 0xC6, 0x67, 0x00, 0x01, 0x00, 0xB5, 0xCC, 0x67, 0x00, 0x07, 0x00,
+    0xB0, 0xB1, 0xB2, 0xB4, 0xB7, 0xBA, 0xBD, 0xD2, 0x67, 0x00, 0xDC, 0x67, 0x00, 0xE6, 0x67, 0x00,
+    0xEC, 0x67, 0x00, 0xF2, 0x67, 0x00, 0xF8, 0x67, 0x00, 0xFE, 0x67, 0x00, 0x02, 0x00, 0x80, 0x81,
+    0x04, 0x68, 0x00, 0x0A, 0x68, 0x00, 0x01, 0x00, 0x82, 0x14, 0x68, 0x00, 0x01, 0x00, 0xB0, 0x1A,
+    0x68, 0x00, 0x01, 0x00, 0xB0, 0x20, 0x68, 0x00, 0x02, 0x00, 0xB2, 0xBE, 0x26, 0x68, 0x00, 0x2C,
+    0x68, 0x00, 0x02, 0x00, 0x80, 0x83, 0x32, 0x68, 0x00, 0x38, 0x68, 0x00, 0x01, 0x00, 0xBE, 0x3E,
+    0x68, 0x00, 0x04, 0x00, 0xB0, 0xB5, 0xBB, 0xBE, 0x44, 0x68, 0x00, 0x4A, 0x68, 0x00, 0x50, 0x68,
+    0x00, 0x56, 0x68, 0x00, 0x02, 0x00, 0x80, 0x83, 0x5C, 0x68, 0x00, 0x62, 0x68, 0x00, 0x01, 0x00,
+    0xB8, 0x68, 0x68, 0x00, 0x01, 0x00, 0x80, 0x6E, 0x68, 0x00, 0x01, 0x00, 0x83, 0x74, 0x68, 0x00,
+    0x01, 0x00, 0x80, 0x7A, 0x68, 0x00, 0x00, 0x02, 0x6B, 0x00, 0x01, 0x00, 0xBE, 0x7E, 0x68, 0x00,
+    0x01, 0x00, 0x96, 0x7E, 0x68, 0x00, 0x01, 0x00, 0xB3, 0x84, 0x68, 0x00, 0x01, 0x00, 0x82, 0x8E,
+    0x38, 0x00, 0x01, 0x00, 0xB0, 0xD4, 0x39, 0x00, 0x01, 0x00, 0xBC, 0x3E, 0x55, 0x00, 0x01, 0x00,
+    0xB5, 0xFA, 0x54, 0x00, 0x01, 0x00, 0x96, 0x8A, 0x68, 0x00, 0x01, 0x00, 0x80, 0xF4, 0x54, 0x00,
+    0x01, 0x00, 0xB7, 0x3E, 0x55, 0x00, 0x01, 0x00, 0x81, 0xF4, 0x54, 0x00, 0x01, 0x00, 0xB5, 0x82,
+    0x3A, 0x00, 0x01, 0x00, 0xBE, 0x34, 0x3E, 0x00, 0x01, 0x00, 0xB0, 0x8C, 0x36, 0x00, 0x01, 0x00,
+    0x82, 0x8C, 0x40, 0x00, 0x01, 0x00, 0xB9, 0x3E, 0x55, 0x00, 0x01, 0x00, 0xB3, 0x90, 0x68, 0x00,
+    0x01, 0x00, 0xBA, 0x98, 0x68, 0x00, 0x01, 0x00, 0x80, 0x24, 0x39, 0x00, 0x01, 0x00, 0xBB, 0x9E,
+    0x68, 0x00, 0x01, 0x00, 0x81, 0xA4, 0x68, 0x00, 0x01, 0x00, 0xB0, 0xAA, 0x68, 0x00, 0x01, 0x00,
+    0x96, 0x24, 0x39, 0x00, 0x01, 0x00, 0xBD, 0x24, 0x39, 0x00, 0x01, 0x00, 0xBA, 0xE4, 0x40, 0x00,
+    0x01, 0x00, 0xB3, 0x24, 0x39, 0x00, 0x01, 0x00, 0xBE, 0xB0, 0x68, 0x00, 0x01, 0x00, 0xB0, 0xB6,
+    0x68, 0x00, 0x01, 0x00, 0xB2, 0xBC, 0x68, 0x00, 0x01, 0x00, 0x8F, 0x8E, 0x38, 0x00, 0x01, 0x00,
+    0xBB, 0xC2, 0x68, 0x00, 0x01, 0x00, 0xB0, 0x2C, 0x67, 0x00, 0x01, 0x00, 0xBE, 0x42, 0x53, 0x00,
+    0x01, 0x00, 0xB0, 0xB0, 0x39, 0x00, 0x01, 0x00, 0xB0, 0xC8, 0x68, 0x00, 0x01, 0x00, 0xB9, 0x6A,
+    0x3C, 0x00, 0x02, 0x00, 0x8E, 0x94, 0x6A, 0x3C, 0x00, 0x6A, 0x3C, 0x00, 0x01, 0x00, 0x83, 0xCE,
+    0x68, 0x00, 0x01, 0x00, 0xBE, 0x3A, 0x38, 0x00, 0x01, 0x00, 0xBD, 0xD4, 0x68, 0x00, 0x01, 0x00,
+    0x81, 0x0C, 0x3D, 0x00, 0x01, 0x00, 0xBD, 0xDA, 0x68, 0x00, 0x01, 0x00, 0xB4, 0x0C, 0x66, 0x00,
+    0x01, 0x00, 0x82, 0x0C, 0x66, 0x00, 0x01, 0x00, 0xBE, 0xFE, 0x37, 0x00, 0x01, 0x00, 0x83, 0x34,
+    0x3A, 0x00, 0x01, 0x00, 0x87, 0x24, 0x39, 0x00, 0x01, 0x00, 0xB5, 0x56, 0x3B, 0x00, 0x01, 0x00,
+    0x96, 0x84, 0x41, 0x00, 0x01, 0x00, 0x8C, 0xB0, 0x39, 0x00, 0x01, 0x00, 0xB3, 0x3E, 0x55, 0x00,
+    0x01, 0x00, 0x85, 0xE0, 0x68, 0x00, 0x01, 0x00, 0xBB, 0xDC, 0x66, 0x00, 0x01, 0x00, 0xBB, 0xE6,
+    0x68, 0x00, 0x01, 0x00, 0x82, 0xEC, 0x68, 0x00, 0x01, 0x00, 0xB5, 0xF2, 0x68, 0x00, 0x01, 0x00,
+    0xBD, 0xF8, 0x68, 0x00, 0x01, 0x00, 0x80, 0xFE, 0x68, 0x00, 0x01, 0x00, 0xB5, 0x08, 0x69, 0x00,
+    0x01, 0x00, 0x97, 0x0E, 0x69, 0x00, 0x01, 0x00, 0xBE, 0x14, 0x69, 0x00, 0x01, 0x00, 0xB8, 0x1A,
+    0x69, 0x00, 0x02, 0x00, 0xB2, 0xBD, 0x20, 0x69, 0x00, 0x88, 0x66, 0x00, 0x01, 0x00, 0x81, 0x26,
+    0x69, 0x00, 0x02, 0x00, 0xBA, 0xBD, 0x2C, 0x69, 0x00, 0x32, 0x69, 0x00, 0x01, 0x00, 0xB8, 0x38,
+    0x69, 0x00, 0x01, 0x00, 0x8F, 0x3E, 0x69, 0x00, 0x02, 0x00, 0xB0, 0xB5, 0x42, 0x53, 0x00, 0x44,
+    0x69, 0x00, 0x01, 0x00, 0x96, 0x4A, 0x69, 0x00, 0x01, 0x00, 0xB2, 0x20, 0x69, 0x00, 0x01, 0x00,
+    0xB0, 0x44, 0x69, 0x00, 0x01, 0x00, 0xB2, 0x50, 0x69, 0x00, 0x01, 0x00, 0x80, 0x54, 0x69, 0x00,
+    0x01, 0x00, 0x81, 0x5A, 0x69, 0x00, 0x01, 0x00, 0xBA, 0x60, 0x69, 0x00, 0x01, 0x00, 0x84, 0x66,
+    0x69, 0x00, 0x01, 0x00, 0xB0, 0x6C, 0x69, 0x00, 0x03, 0x00, 0xB1, 0xB3, 0xBF, 0x74, 0x69, 0x00,
+    0x7E, 0x69, 0x00, 0x88, 0x69, 0x00, 0x02, 0x00, 0x81, 0x85, 0x8E, 0x69, 0x00, 0x94, 0x69, 0x00,
+    0x01, 0x00, 0xBF, 0x9A, 0x69, 0x00, 0x01, 0x00, 0xB1, 0xA0, 0x69, 0x00, 0x01, 0x00, 0xBA, 0xA6,
+    0x69, 0x00, 0x01, 0x00, 0x81, 0xAC, 0x69, 0x00, 0x01, 0x00, 0x81, 0xB2, 0x69, 0x00, 0x01, 0x00,
+    0xB8, 0xB8, 0x69, 0x00, 0x01, 0x00, 0x83, 0xBE, 0x69, 0x00, 0x01, 0x00, 0xB2, 0xC4, 0x69, 0x00,
+    0x02, 0x00, 0x81, 0x88, 0x8E, 0x38, 0x00, 0x8E, 0x38, 0x00, 0x01, 0x00, 0xBE, 0xCA, 0x69, 0x00,
+    0x01, 0x00, 0xB4, 0xD0, 0x69, 0x00, 0x02, 0x00, 0x83, 0x97, 0xBC, 0x68, 0x00, 0xD8, 0x69, 0x00,
+    0x02, 0x00, 0xB0, 0xB8, 0xDC, 0x69, 0x00, 0x6E, 0x3B, 0x00, 0x02, 0x00, 0xBB, 0xBE, 0xE2, 0x69,
+    0x00, 0xE8, 0x69, 0x00, 0x02, 0x00, 0xB0, 0xBE, 0xEE, 0x69, 0x00, 0x06, 0x55, 0x00, 0x01, 0x00,
+    0x96, 0xF4, 0x69, 0x00, 0x01, 0x00, 0xB0, 0xFE, 0x69, 0x00, 0x01, 0x00, 0xB0, 0x04, 0x6A, 0x00,
+    0x01, 0x00, 0xB0, 0x0A, 0x6A, 0x00, 0x01, 0x00, 0x96, 0x82, 0x3A, 0x00, 0x01, 0x00, 0xB2, 0x10,
+    0x6A, 0x00, 0x01, 0x00, 0xBE, 0xE4, 0x39, 0x00, 0x01, 0x00, 0x83, 0x16, 0x6A, 0x00, 0x01, 0x00,
+    0xB9, 0x0C, 0x53, 0x00, 0x01, 0x00, 0xB0, 0x1C, 0x6A, 0x00, 0x01, 0x00, 0xB0, 0x22, 0x6A, 0x00,
+    0x01, 0x00, 0x86, 0xF4, 0x54, 0x00, 0x01, 0x00, 0xBC, 0x24, 0x39, 0x00, 0x01, 0x00, 0xB5, 0x00,
+    0x3D, 0x00, 0x01, 0x00, 0xB4, 0x28, 0x6A, 0x00, 0x01, 0x00, 0xB5, 0x2E, 0x6A, 0x00, 0x01, 0x00,
+    0xBC, 0x60, 0x58, 0x00, 0x01, 0x00, 0xBE, 0x0C, 0x3D, 0x00, 0x01, 0x00, 0xBE, 0xB8, 0x69, 0x00,
+    0x01, 0x00, 0xD1, 0x34, 0x6A, 0x00, 0x01, 0x00, 0x80, 0x3A, 0x6A, 0x00, 0x03, 0x00, 0xB4, 0xBC,
+    0xBD, 0x0C, 0x66, 0x00, 0x60, 0x58, 0x00, 0xD4, 0x68, 0x00, 0x01, 0x00, 0xBC, 0xB0, 0x39, 0x00,
+    0x02, 0x00, 0xB0, 0xBE, 0x10, 0x66, 0x00, 0x90, 0x57, 0x00, 0x01, 0x00, 0x80, 0x40, 0x6A, 0x00,
+    0x01, 0x00, 0xBD, 0x46, 0x6A, 0x00, 0x01, 0x00, 0xB0, 0xFA, 0x54, 0x00, 0x02, 0x00, 0x81, 0x89,
+    0x82, 0x3A, 0x00, 0x24, 0x39, 0x00, 0x01, 0x00, 0xB5, 0xB0, 0x39, 0x00, 0x01, 0x00, 0xBD, 0x4C,
+    0x6A, 0x00, 0x01, 0x00, 0x81, 0x52, 0x6A, 0x00, 0x01, 0x00, 0x82, 0x58, 0x6A, 0x00, 0x01, 0x00,
+    0x87, 0x5E, 0x6A, 0x00, 0x07, 0x00, 0xB2, 0xB3, 0xB4, 0xB9, 0xBC, 0xBE, 0xBF, 0x64, 0x6A, 0x00,
+    0x6A, 0x6A, 0x00, 0x70, 0x6A, 0x00, 0x7A, 0x6A, 0x00, 0x10, 0x6A, 0x00, 0x84, 0x6A, 0x00, 0x8A,
+    0x6A, 0x00, 0x02, 0x00, 0x83, 0x97, 0xBC, 0x68, 0x00, 0x90, 0x6A, 0x00, 0x01, 0x00, 0x80, 0x9A,
+    0x6A, 0x00, 0x01, 0x00, 0xB8, 0xA0, 0x6A, 0x00, 0x01, 0x00, 0xBE, 0xA6, 0x6A, 0x00, 0x02, 0x00,
+    0xB0, 0xB5, 0x42, 0x53, 0x00, 0x44, 0x69, 0x00, 0x02, 0x00, 0xB0, 0xBE, 0x38, 0x69, 0x00, 0xAC,
+    0x6A, 0x00, 0x01, 0x00, 0x96, 0xB2, 0x6A, 0x00, 0x01, 0x00, 0x83, 0xB8, 0x6A, 0x00, 0x01, 0x00,
+    0xB0, 0xB8, 0x69, 0x00, 0x02, 0x00, 0xB0, 0xBE, 0xBE, 0x6A, 0x00, 0x60, 0x58, 0x00, 0x02, 0x00,
+    0x82, 0x86, 0xC4, 0x6A, 0x00, 0x82, 0x66, 0x00, 0x02, 0x00, 0x80, 0x84, 0xCA, 0x6A, 0x00, 0xD0,
+    0x6A, 0x00, 0x06, 0x00, 0xB0, 0xB4, 0xBA, 0xBC, 0xBD, 0xBF, 0xD6, 0x6A, 0x00, 0xDC, 0x6A, 0x00,
+    0xE2, 0x6A, 0x00, 0xE8, 0x6A, 0x00, 0xEE, 0x6A, 0x00, 0xF4, 0x6A, 0x00, 0x04, 0x00, 0x80, 0x81,
+    0x84, 0x96, 0xFA, 0x6A, 0x00, 0x00, 0x6B, 0x00, 0x06, 0x6B, 0x00, 0x0C, 0x6B, 0x00, 0x02, 0x00,
+    0xB5, 0xB8, 0x8E, 0x38, 0x00, 0x8E, 0x38, 0x00, 0x01, 0x00, 0x83, 0x8E, 0x38, 0x00, 0x01, 0x00,
+    0xBC, 0x12, 0x6B, 0x00, 0x01, 0x00, 0x81, 0x18, 0x6B, 0x00, 0x02, 0x00, 0xB4, 0xBC, 0x0C, 0x66,
+    0x00, 0x60, 0x58, 0x00, 0x01, 0x00, 0x86, 0x1C, 0x6B, 0x00, 0x01, 0x00, 0x80, 0x60, 0x58, 0x00,
+    0x01, 0x00, 0xBB, 0x22, 0x6B, 0x00, 0x01, 0x00, 0xBA, 0x28, 0x6B, 0x00, 0x01, 0x00, 0xBC, 0x2E,
+    0x6B, 0x00, 0x01, 0x00, 0xBB, 0x20, 0x57, 0x00, 0x01, 0x00, 0x82, 0x34, 0x6B, 0x00, 0x01, 0x00,
+    0xB2, 0x3A, 0x6B, 0x00, 0x01, 0x00, 0x81, 0x80, 0x57, 0x00, 0x01, 0x00, 0x81, 0x40, 0x6B, 0x00,
+    0x01, 0x00, 0xBD, 0x46, 0x6B, 0x00, 0x02, 0x00, 0xB2, 0xBD, 0x4C, 0x6B, 0x00, 0x52, 0x6B, 0x00,
+    0x01, 0x00, 0x81, 0x58, 0x6B, 0x00, 0x01, 0x00, 0xB3, 0x60, 0x6B, 0x00, 0x01, 0x00, 0x81, 0x66,
+    0x6B, 0x00, 0x01, 0x00, 0xB4, 0x6C, 0x6B, 0x00, 0x01, 0x00, 0x80, 0x72, 0x6B, 0x00, 0x02, 0x00,
+    0xB9, 0xBC, 0x76, 0x6B, 0x00, 0x10, 0x6A, 0x00, 0x01, 0x00, 0xBD, 0x7C, 0x6B, 0x00, 0x01, 0x00,
+    0xB8, 0xB0, 0x39, 0x00, 0x01, 0x00, 0xD1, 0x82, 0x6B, 0x00, 0x01, 0x00, 0xD0, 0x8C, 0x6B, 0x00,
+    0x03, 0x00, 0xB0, 0xB5, 0xB8, 0x92, 0x6B, 0x00, 0x98, 0x6B, 0x00, 0x9E, 0x6B, 0x00, 0x01, 0x00,
+    0xBE, 0x98, 0x6B, 0x00, 0x01, 0x00, 0x80, 0xA8, 0x6B, 0x00, 0x01, 0x00, 0xB2, 0x2C, 0x69, 0x00,
+    0x01, 0x00, 0x96, 0xAE, 0x6B, 0x00, 0x01, 0x00, 0xBE, 0xB4, 0x6B, 0x00, 0x01, 0x00, 0xB8, 0xBA,
+    0x6B, 0x00, 0x01, 0x00, 0x96, 0xC0, 0x6B, 0x00, 0x01, 0x00, 0x80, 0xC6, 0x6B, 0x00, 0x02, 0x00,
+    0xB3, 0xBC, 0x60, 0x6B, 0x00, 0x6E, 0x54, 0x00, 0x01, 0x00, 0x87, 0xD0, 0x66, 0x00, 0x01, 0x00,
+    0xB5, 0xD0, 0x6B, 0x00, 0x01, 0x00, 0xBC, 0xD0, 0x66, 0x00, 0x01, 0x00, 0x81, 0xD6, 0x6B, 0x00,
+    0x01, 0x00, 0x83, 0xBC, 0x68, 0x00, 0x01, 0x00, 0x82, 0xDC, 0x6B, 0x00, 0x01, 0x00, 0xBA, 0xE0,
+    0x6B, 0x00, 0x02, 0x00, 0x80, 0x87, 0xE6, 0x6B, 0x00, 0xEC, 0x6B, 0x00, 0x01, 0x00, 0xB5, 0xF2,
+    0x6B, 0x00, 0x01, 0x00, 0x82, 0x6A, 0x3C, 0x00, 0x01, 0x00, 0xBE, 0x7E, 0x41, 0x00, 0x01, 0x00,
+    0xBF, 0x44, 0x59, 0x00, 0x04, 0x00, 0xB2, 0xBA, 0xBC, 0xBF, 0x3A, 0x6B, 0x00, 0xF8, 0x6B, 0x00,
+    0xFE, 0x6B, 0x00, 0x50, 0x3D, 0x00, 0x01, 0x00, 0x82, 0x04, 0x6C, 0x00, 0x01, 0x00, 0x82, 0x0E,
+    0x6C, 0x00, 0x02, 0x00, 0x82, 0x8F, 0x18, 0x5A, 0x00, 0x44, 0x59, 0x00, 0x01, 0x00, 0xBC, 0x14,
+    0x6C, 0x00, 0x01, 0x00, 0xB2, 0x1A, 0x6C, 0x00, 0x01, 0x00, 0x83, 0x20, 0x6C, 0x00, 0x01, 0x00,
+    0x80, 0x6A, 0x3C, 0x00, 0x01, 0x00, 0x96, 0x34, 0x3E, 0x00, 0x01, 0x00, 0x83, 0xB0, 0x39, 0x00,
+    0x01, 0x00, 0x96, 0x0C, 0x3D, 0x00, 0x01, 0x00, 0xB6, 0x52, 0x53, 0x00, 0x01, 0x00, 0x85, 0x6A,
+    0x3C, 0x00, 0x02, 0x00, 0xB1, 0xB6, 0x6A, 0x3C, 0x00, 0x6A, 0x3C, 0x00, 0x03, 0x00, 0xB9, 0xBA,
+    0xBC, 0x6A, 0x3C, 0x00, 0x6A, 0x3C, 0x00, 0x6A, 0x3C, 0x00, 0x06, 0x00, 0x84, 0x87, 0x8E, 0x8F,
+    0x94, 0x97, 0x6A, 0x3C, 0x00, 0x6A, 0x3C, 0x00, 0x6A, 0x3C, 0x00, 0x6A, 0x3C, 0x00, 0x6A, 0x3C,
+    0x00, 0x6A, 0x3C, 0x00, 0x01, 0x00, 0xBA, 0x26, 0x6C, 0x00, 0x02, 0x00, 0xB9, 0xBB, 0x6A, 0x3C,
+    0x00, 0x6A, 0x3C, 0x00, 0x01, 0x00, 0x87, 0x6A, 0x3C, 0x00, 0x01, 0x00, 0x80, 0x2C, 0x6C, 0x00,
+    0x01, 0x00, 0x83, 0x06, 0x55, 0x00, 0x01, 0x00, 0xBE, 0x32, 0x6C, 0x00, 0x01, 0x00, 0xBE, 0x38,
+    0x6C, 0x00, 0x01, 0x00, 0x96, 0x3E, 0x6C, 0x00, 0x01, 0x00, 0xBD, 0x6A, 0x3C, 0x00, 0x01, 0x00,
+    0xBF, 0x44, 0x6C, 0x00, 0x01, 0x00, 0x81, 0x4A, 0x6C, 0x00, 0x01, 0x00, 0xBC, 0x4E, 0x6C, 0x00,
+    0x01, 0x00, 0xBD, 0x54, 0x6C, 0x00, 0x01, 0x00, 0xBF, 0x4C, 0x38, 0x00, 0x02, 0x00, 0xB2, 0xB3,
+    0x5A, 0x6C, 0x00, 0x60, 0x6C, 0x00, 0x01, 0x00, 0xBA, 0x66, 0x6C, 0x00, 0x01, 0x00, 0xBF, 0x0C,
+    0x3D, 0x00, 0x01, 0x00, 0xBD, 0x6C, 0x6C, 0x00, 0x01, 0x00, 0xBB, 0x2A, 0x53, 0x00, 0x01, 0x00,
+    0xB5, 0xFC, 0x38, 0x00, 0x01, 0x00, 0xB8, 0x72, 0x6C, 0x00, 0x01, 0x00, 0x88, 0xB0, 0x39, 0x00,
+    0x01, 0x00, 0xBD, 0x7C, 0x55, 0x00, 0x01, 0x00, 0xB0, 0x78, 0x6C, 0x00, 0x01, 0x00, 0xB1, 0x0C,
+    0x3D, 0x00, 0x01, 0x00, 0x82, 0x7E, 0x6C, 0x00, 0x01, 0x00, 0xB3, 0x84, 0x6C, 0x00, 0x01, 0x00,
+    0x80, 0x8A, 0x6C, 0x00, 0x01, 0x00, 0xBE, 0x90, 0x57, 0x00, 0x01, 0x00, 0xBE, 0x90, 0x6C, 0x00,
+    0x01, 0x00, 0x82, 0xA8, 0x6B, 0x00, 0x01, 0x00, 0xBA, 0x96, 0x6C, 0x00, 0x01, 0x00, 0xBA, 0x9E,
+    0x6C, 0x00, 0x01, 0x00, 0xBE, 0xFE, 0x3A, 0x00, 0x01, 0x00, 0xB8, 0xA4, 0x6C, 0x00, 0x01, 0x00,
+    0x96, 0x8C, 0x40, 0x00, 0x01, 0x00, 0xBD, 0x90, 0x41, 0x00, 0x01, 0x00, 0x80, 0xAA, 0x6C, 0x00,
+    0x01, 0x00, 0x80, 0xB0, 0x6C, 0x00, 0x01, 0x00, 0x96, 0x74, 0x3E, 0x00, 0x01, 0x00, 0x96, 0xB6,
+    0x6C, 0x00, 0x00, 0x01, 0x2E, 0x00, 0x01, 0x00, 0xB4, 0xBC, 0x6C, 0x00, 0x01, 0x00, 0x81, 0xC0,
+    0x6C, 0x00, 0x01, 0x00, 0xBE, 0xC6, 0x6C, 0x00, 0x03, 0x00, 0xB0, 0xBA, 0xBE, 0xCC, 0x6C, 0x00,
+    0xD2, 0x6C, 0x00, 0xD8, 0x6C, 0x00, 0x02, 0x00, 0x82, 0x96, 0xDE, 0x6C, 0x00, 0xE8, 0x6C, 0x00,
+    0x01, 0x00, 0x80, 0x1A, 0x5B, 0x00, 0x02, 0x00, 0xB7, 0xBC, 0xEE, 0x6C, 0x00, 0x1A, 0x5B, 0x00,
+    0x01, 0x00, 0xBD, 0x1A, 0x5B, 0x00, 0x01, 0x00, 0xBC, 0xF4, 0x6C, 0x00, 0x01, 0x00, 0x8C, 0xFA,
+    0x6C, 0x00, 0x01, 0x00, 0x80, 0xFE, 0x6C, 0x00, 0x01, 0x00, 0xB2, 0x02, 0x6D, 0x00, 0x02, 0x00,
+    0xB4, 0xBC, 0x06, 0x6D, 0x00, 0xF4, 0x6C, 0x00, 0x01, 0x00, 0xB4, 0x14, 0x6D, 0x00, 0x01, 0x00,
+    0x87, 0xFE, 0x6C, 0x00, 0x01, 0x00, 0xB7, 0x20, 0x6D, 0x00, 0x01, 0x00, 0xD0, 0x2A, 0x34, 0x00,
+    0x01, 0x00, 0xD1, 0x28, 0x6D, 0x00, 0x01, 0x00, 0xD0, 0x2E, 0x6D, 0x00, 0x00, 0x02, 0x81, 0x00,
+    0x01, 0x00, 0xD0, 0x34, 0x6D, 0x00, 0x01, 0x00, 0xD1, 0xAA, 0x4B, 0x00, 0x01, 0x00, 0xD0, 0x3A,
+    0x6D, 0x00, 0x01, 0x00, 0xD1, 0x40, 0x6D, 0x00, 0x01, 0x00, 0xD0, 0x46, 0x6D, 0x00, 0x01, 0x00,
+    0xD1, 0x4C, 0x6D, 0x00, 0x01, 0x00, 0xD1, 0x52, 0x6D, 0x00, 0x01, 0x00, 0xD0, 0x58, 0x6D, 0x00,
+    0x01, 0x00, 0xD0, 0x5E, 0x6D, 0x00, 0x01, 0x00, 0xD0, 0x68, 0x6D, 0x00, 0x01, 0x00, 0xD1, 0x6E,
+    0x6D, 0x00, 0x01, 0x00, 0xD0, 0x74, 0x6D, 0x00, 0x01, 0x00, 0xD0, 0x7A, 0x6D, 0x00, 0x01, 0x00,
+    0xD0, 0x80, 0x6D, 0x00, 0x01, 0x00, 0xD1, 0x86, 0x6D, 0x00, 0x01, 0x00, 0xD0, 0x8C, 0x6D, 0x00,
+    0x01, 0x00, 0xD0, 0x92, 0x6D, 0x00, 0x01, 0x00, 0xD0, 0x98, 0x6D, 0x00, 0x01, 0x00, 0xD0, 0x9E,
+    0x6D, 0x00, 0x01, 0x00, 0xD0, 0xA4, 0x6D, 0x00, 0x01, 0x00, 0xD0, 0xAA, 0x6D, 0x00, 0x01, 0x00,
+    0xD1, 0xB0, 0x6D, 0x00, 0x01, 0x00, 0xD0, 0xB6, 0x6D, 0x00, 0x01, 0x00, 0xD1, 0xBC, 0x6D, 0x00,
+    0x01, 0x00, 0xD0, 0xC2, 0x6D, 0x00, 0x01, 0x00, 0xD0, 0xC8, 0x6D, 0x00, 0x01, 0x00, 0xD1, 0xCE,
+    0x6D, 0x00, 0x01, 0x00, 0xD0, 0xD4, 0x6D, 0x00, 0x01, 0x00, 0xD1, 0xDA, 0x6D, 0x00, 0x01, 0x00,
+    0xD0, 0xE0, 0x6D, 0x00, 0x01, 0x00, 0xD0, 0xE6, 0x6D, 0x00, 0x01, 0x00, 0xD0, 0xEC, 0x6D, 0x00,
+    0x01, 0x00, 0xD0, 0xF2, 0x6D, 0x00, 0x01, 0x00, 0xD0, 0xF8, 0x6D, 0x00, 0x00, 0x01, 0xD5, 0x00,
+    0x01, 0x00, 0xD1, 0xFE, 0x6D, 0x00, 0x01, 0x00, 0xD0, 0x04, 0x6E, 0x00, 0x01, 0x00, 0xD0, 0x0A,
+    0x6E, 0x00, 0x01, 0x00, 0xD0, 0x10, 0x6E, 0x00, 0x01, 0x00, 0xD0, 0x16, 0x6E, 0x00, 0x01, 0x00,
+    0xD1, 0x1C, 0x6E, 0x00, 0x01, 0x00, 0xD0, 0x22, 0x6E, 0x00, 0x01, 0x00, 0xD0, 0x28, 0x6E, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x2E, 0x6E, 0x00, 0x34, 0x6E, 0x00, 0x01, 0x00, 0xD0, 0x3A, 0x6E, 0x00,
+    0x01, 0x00, 0xD0, 0x40, 0x6E, 0x00, 0x01, 0x00, 0xD0, 0x46, 0x6E, 0x00, 0x01, 0x00, 0xD1, 0x4C,
+    0x6E, 0x00, 0x01, 0x00, 0xD0, 0x52, 0x6E, 0x00, 0x01, 0x01, 0x54, 0x00, 0xD0, 0xA4, 0x6D, 0x00,
+    0x01, 0x00, 0xD0, 0x58, 0x6E, 0x00, 0x01, 0x00, 0xD0, 0x5E, 0x6E, 0x00, 0x01, 0x00, 0xD0, 0x64,
+    0x6E, 0x00, 0x01, 0x00, 0xD0, 0x6A, 0x6E, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x70, 0x6E, 0x00, 0x76,
+    0x6E, 0x00, 0x01, 0x00, 0xD0, 0x7C, 0x6E, 0x00, 0x01, 0x00, 0xD1, 0x82, 0x6E, 0x00, 0x01, 0x00,
+    0xD0, 0x88, 0x6E, 0x00, 0x00, 0x02, 0x85, 0x00, 0x01, 0x00, 0xD0, 0x92, 0x6E, 0x00, 0x01, 0x00,
+    0x8F, 0x98, 0x6E, 0x00, 0x00, 0x03, 0xEE, 0x00, 0x01, 0x00, 0xD0, 0x9C, 0x6E, 0x00, 0x01, 0x00,
+    0xD1, 0xA2, 0x6E, 0x00, 0x01, 0x00, 0xD0, 0xA8, 0x6E, 0x00, 0x01, 0x00, 0xD0, 0xAE, 0x6E, 0x00,
+    0x01, 0x00, 0xD0, 0xB4, 0x6E, 0x00, 0x01, 0x00, 0xD0, 0xBA, 0x6E, 0x00, 0x01, 0x00, 0xD0, 0xC0,
+    0x6E, 0x00, 0x01, 0x00, 0xD0, 0xC6, 0x6E, 0x00, 0x01, 0x02, 0x46, 0x00, 0xD0, 0xCC, 0x6E, 0x00,
+    0x01, 0x00, 0xD0, 0xD2, 0x6E, 0x00, 0x01, 0x00, 0xD1, 0xDC, 0x6E, 0x00, 0x01, 0x00, 0xD1, 0xE2,
+    0x6E, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xE8, 0x6E, 0x00, 0xEE, 0x6E, 0x00, 0x02, 0x00, 0xD0, 0xD1,
+    0xF4, 0x6E, 0x00, 0xFA, 0x6E, 0x00, 0x01, 0x00, 0xD0, 0x00, 0x6F, 0x00, 0x01, 0x00, 0xD1, 0x06,
+    0x6F, 0x00, 0x01, 0x00, 0xD0, 0x0C, 0x6F, 0x00, 0x01, 0x00, 0xD0, 0x12, 0x6F, 0x00, 0x01, 0x00,
+    0xD0, 0x18, 0x6F, 0x00, 0x01, 0x00, 0xD0, 0x1E, 0x6F, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x24, 0x6F,
+    0x00, 0x2A, 0x6F, 0x00, 0x01, 0x00, 0xD0, 0x30, 0x6F, 0x00, 0x01, 0x00, 0xD0, 0x36, 0x6F, 0x00,
+    0x01, 0x00, 0xD1, 0x3C, 0x6F, 0x00, 0x01, 0x00, 0xD0, 0x42, 0x6F, 0x00, 0x01, 0x00, 0xD0, 0x48,
+    0x6F, 0x00, 0x01, 0x00, 0xD0, 0x52, 0x6F, 0x00, 0x01, 0x00, 0xD1, 0x5C, 0x6F, 0x00, 0x01, 0x00,
+    0xD0, 0x66, 0x6F, 0x00, 0x01, 0x00, 0xD1, 0x6C, 0x6F, 0x00, 0x01, 0x00, 0xD1, 0x72, 0x6F, 0x00,
+    0x01, 0x00, 0xD0, 0x7C, 0x6F, 0x00, 0x01, 0x00, 0xD0, 0x82, 0x6F, 0x00, 0x01, 0x00, 0xD0, 0x88,
+    0x6F, 0x00, 0x01, 0x00, 0xD1, 0x34, 0x6E, 0x00, 0x01, 0x00, 0xD0, 0x2E, 0x6E, 0x00, 0x01, 0x00,
+    0xD0, 0x8E, 0x6F, 0x00, 0x01, 0x00, 0xD0, 0x98, 0x6F, 0x00, 0x00, 0x03, 0xE4, 0x00, 0x01, 0x00,
+    0xD0, 0x9E, 0x6F, 0x00, 0x01, 0x00, 0xD0, 0xA4, 0x6F, 0x00, 0x01, 0x00, 0xD0, 0xAA, 0x6F, 0x00,
+    0x01, 0x02, 0x46, 0x00, 0xD0, 0xB0, 0x6F, 0x00, 0x01, 0x00, 0xD0, 0xB6, 0x6F, 0x00, 0x01, 0x00,
+    0xD0, 0xBC, 0x6F, 0x00, 0x01, 0x00, 0xD0, 0xC2, 0x6F, 0x00, 0x01, 0x00, 0xD1, 0xC8, 0x6F, 0x00,
+    0x01, 0x00, 0xD1, 0xCE, 0x6F, 0x00, 0x01, 0x00, 0xD1, 0xEE, 0x6E, 0x00, 0x01, 0x00, 0xD1, 0xD8,
+    0x6F, 0x00, 0x01, 0x00, 0xD1, 0xDE, 0x6F, 0x00, 0x01, 0x00, 0xD0, 0x64, 0x65, 0x00, 0x01, 0x00,
+    0xD1, 0xEA, 0x45, 0x00, 0x01, 0x00, 0xD1, 0xE4, 0x6F, 0x00, 0x01, 0x00, 0xD0, 0xEA, 0x6F, 0x00,
+    0x01, 0x00, 0xD1, 0xF0, 0x6F, 0x00, 0x01, 0x00, 0xD1, 0xF6, 0x6F, 0x00, 0x01, 0x00, 0xD0, 0xFC,
+    0x6F, 0x00, 0x01, 0x00, 0xD0, 0x06, 0x70, 0x00, 0x01, 0x00, 0xD0, 0x0C, 0x70, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x12, 0x70, 0x00, 0x18, 0x70, 0x00, 0x01, 0x00, 0xD1, 0x22, 0x70, 0x00, 0x01, 0x00,
+    0xD0, 0x28, 0x70, 0x00, 0x01, 0x00, 0xD1, 0x2E, 0x70, 0x00, 0x01, 0x00, 0xD0, 0x34, 0x70, 0x00,
+    0x01, 0x00, 0xD0, 0x3A, 0x70, 0x00, 0x01, 0x00, 0xD0, 0x40, 0x70, 0x00, 0x01, 0x00, 0xD0, 0x46,
+    0x70, 0x00, 0x01, 0x00, 0xD0, 0x4C, 0x70, 0x00, 0x01, 0x00, 0xD0, 0x52, 0x70, 0x00, 0x01, 0x00,
+    0xD0, 0x58, 0x70, 0x00, 0x01, 0x00, 0xD0, 0x5E, 0x70, 0x00, 0x01, 0x00, 0xD1, 0x64, 0x70, 0x00,
+    0x00, 0x03, 0xCA, 0x00, 0x01, 0x00, 0xD0, 0x6A, 0x70, 0x00, 0x01, 0x00, 0xD1, 0x70, 0x70, 0x00,
+    0x01, 0x00, 0xD1, 0x76, 0x70, 0x00, 0x01, 0x00, 0xD0, 0x7C, 0x70, 0x00, 0x01, 0x01, 0x6E, 0x00,
+    0xD1, 0x82, 0x70, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x88, 0x70, 0x00, 0x8E, 0x70, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x94, 0x70, 0x00, 0x9E, 0x70, 0x00, 0x01, 0x00, 0xD1, 0xA4, 0x70, 0x00, 0x01, 0x00,
+    0xD1, 0xAA, 0x70, 0x00, 0x01, 0x00, 0xD0, 0xB0, 0x70, 0x00, 0x01, 0x00, 0xD1, 0xB6, 0x70, 0x00,
+    0x01, 0x00, 0xD0, 0xBC, 0x70, 0x00, 0x01, 0x00, 0xD1, 0xC2, 0x70, 0x00, 0x01, 0x00, 0xD0, 0xC8,
+    0x70, 0x00, 0x01, 0x00, 0xD1, 0xCE, 0x70, 0x00, 0x01, 0x00, 0xD0, 0xD4, 0x70, 0x00, 0x01, 0x00,
+    0xD0, 0xDA, 0x70, 0x00, 0x01, 0x00, 0xD0, 0xE0, 0x70, 0x00, 0x01, 0x00, 0xD0, 0xE6, 0x70, 0x00,
+    0x01, 0x02, 0x4A, 0x00, 0x27, 0xEC, 0x70, 0x00, 0x00, 0x01, 0xB0, 0x00, 0x01, 0x00, 0xD0, 0xF0,
+    0x70, 0x00, 0x01, 0x00, 0xD0, 0xF6, 0x70, 0x00, 0x01, 0x00, 0xD0, 0xFC, 0x70, 0x00, 0x01, 0x00,
+    0xD0, 0x02, 0x71, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x08, 0x71, 0x00, 0x9E, 0x47, 0x00, 0x01, 0x00,
+    0xD0, 0x0E, 0x71, 0x00, 0x01, 0x00, 0xD1, 0x14, 0x71, 0x00, 0x01, 0x00, 0xD0, 0x1A, 0x71, 0x00,
+    0x01, 0x00, 0x27, 0x20, 0x71, 0x00, 0x01, 0x00, 0xD1, 0x26, 0x71, 0x00, 0x01, 0x00, 0xD0, 0x2C,
+    0x71, 0x00, 0x01, 0x00, 0xD1, 0x32, 0x71, 0x00, 0x01, 0x00, 0xD0, 0x38, 0x71, 0x00, 0x01, 0x00,
+    0xD1, 0x3E, 0x71, 0x00, 0x01, 0x00, 0x94, 0x98, 0x6E, 0x00, 0x01, 0x00, 0xD0, 0x44, 0x71, 0x00,
+    0x01, 0x00, 0xD0, 0x4A, 0x71, 0x00, 0x01, 0x00, 0xD0, 0x50, 0x71, 0x00, 0x01, 0x00, 0xD0, 0x56,
+    0x71, 0x00, 0x01, 0x00, 0xD1, 0x5C, 0x71, 0x00, 0x01, 0x00, 0xD0, 0x62, 0x71, 0x00, 0x01, 0x00,
+    0xD0, 0x68, 0x71, 0x00, 0x01, 0x00, 0xD1, 0x6E, 0x71, 0x00, 0x01, 0x00, 0xD0, 0x74, 0x71, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x7A, 0x71, 0x00, 0x84, 0x71, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x92, 0x71,
+    0x00, 0x76, 0x6E, 0x00, 0x01, 0x00, 0xD1, 0xA0, 0x71, 0x00, 0x01, 0x00, 0xD0, 0xA6, 0x71, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0xAC, 0x71, 0x00, 0xBE, 0x71, 0x00, 0x01, 0x00, 0xD0, 0xC8, 0x71, 0x00,
+    0x01, 0x00, 0xD0, 0xCE, 0x71, 0x00, 0x01, 0x00, 0xD1, 0xD4, 0x71, 0x00, 0x01, 0x00, 0xD0, 0xDA,
+    0x71, 0x00, 0x01, 0x00, 0xD1, 0xE0, 0x71, 0x00, 0x01, 0x00, 0xD1, 0xE6, 0x71, 0x00, 0x01, 0x00,
+    0xD0, 0xEC, 0x71, 0x00, 0x01, 0x00, 0xD0, 0xF2, 0x71, 0x00, 0x01, 0x00, 0xD0, 0xF8, 0x71, 0x00,
+    0x01, 0x00, 0xD0, 0xFE, 0x71, 0x00, 0x01, 0x00, 0xD0, 0x04, 0x72, 0x00, 0x01, 0x00, 0xD0, 0x0A,
+    0x72, 0x00, 0x01, 0x00, 0xD0, 0x10, 0x72, 0x00, 0x01, 0x00, 0xD0, 0x1A, 0x72, 0x00, 0x01, 0x00,
+    0xD0, 0x20, 0x72, 0x00, 0x01, 0x00, 0xD1, 0x26, 0x72, 0x00, 0x01, 0x00, 0xD0, 0x2C, 0x72, 0x00,
+    0x01, 0x00, 0xD0, 0x32, 0x72, 0x00, 0x01, 0x00, 0xD1, 0x38, 0x72, 0x00, 0x01, 0x00, 0xD1, 0x3E,
+    0x72, 0x00, 0x01, 0x00, 0xD0, 0x44, 0x72, 0x00, 0x00, 0x02, 0xB5, 0x00, 0x01, 0x00, 0xD0, 0x4A,
+    0x72, 0x00, 0x01, 0x00, 0xD0, 0x50, 0x72, 0x00, 0x01, 0x00, 0xD1, 0x56, 0x72, 0x00, 0x01, 0x00,
+    0xD0, 0x5C, 0x72, 0x00, 0x01, 0x00, 0xD0, 0x62, 0x72, 0x00, 0x01, 0x00, 0xD1, 0x68, 0x72, 0x00,
+    0x01, 0x00, 0xD0, 0x6E, 0x72, 0x00, 0x01, 0x00, 0xD1, 0x74, 0x72, 0x00, 0x01, 0x00, 0xD0, 0x7A,
+    0x72, 0x00, 0x01, 0x00, 0xD1, 0x80, 0x72, 0x00, 0x01, 0x01, 0x54, 0x00, 0xD1, 0x86, 0x72, 0x00,
+    0x01, 0x00, 0xD0, 0x8C, 0x72, 0x00, 0x01, 0x00, 0xD1, 0x92, 0x72, 0x00, 0x01, 0x00, 0xD0, 0x98,
+    0x72, 0x00, 0x00, 0x03, 0x8B, 0x00, 0x01, 0x00, 0xD0, 0x9E, 0x72, 0x00, 0x01, 0x00, 0xD0, 0xA4,
+    0x72, 0x00, 0x02, 0x00, 0x80, 0x81, 0x08, 0x5B, 0x00, 0xAA, 0x72, 0x00, 0x01, 0x00, 0xB4, 0xB0,
+    0x72, 0x00, 0x01, 0x00, 0xD0, 0xB6, 0x72, 0x00, 0x01, 0x00, 0xD1, 0xBC, 0x72, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0xC2, 0x72, 0x00, 0xC8, 0x72, 0x00, 0x01, 0x00, 0xD0, 0xCE, 0x72, 0x00, 0x01, 0x00,
+    0xD0, 0xD4, 0x72, 0x00, 0x01, 0x00, 0xD0, 0xDA, 0x72, 0x00, 0x01, 0x00, 0xD0, 0xE0, 0x72, 0x00,
+    0x01, 0x00, 0xD0, 0xE6, 0x72, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xEC, 0x72, 0x00, 0x02, 0x73, 0x00,
+    0x01, 0x00, 0xD0, 0x14, 0x73, 0x00, 0x01, 0x00, 0xD1, 0x1A, 0x73, 0x00, 0x00, 0x03, 0x51, 0x00,
+    0x01, 0x00, 0xD0, 0x20, 0x73, 0x00, 0x01, 0x00, 0xD1, 0x26, 0x73, 0x00, 0x01, 0x00, 0xD0, 0x2C,
+    0x73, 0x00, 0x01, 0x00, 0xD1, 0x32, 0x73, 0x00, 0x01, 0x00, 0xD1, 0x38, 0x73, 0x00, 0x01, 0x00,
+    0xD0, 0x3E, 0x73, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x44, 0x73, 0x00, 0x56, 0x73, 0x00, 0x01, 0x00,
+    0xD0, 0x78, 0x33, 0x00, 0x01, 0x00, 0xD0, 0x5C, 0x73, 0x00, 0x01, 0x00, 0xD1, 0x62, 0x73, 0x00,
+    0x01, 0x00, 0xD0, 0x68, 0x73, 0x00, 0x01, 0x00, 0xD1, 0x6E, 0x73, 0x00, 0x01, 0x00, 0xD0, 0x78,
+    0x73, 0x00, 0x01, 0x00, 0xD0, 0x86, 0x73, 0x00, 0x01, 0x00, 0xD1, 0x8C, 0x73, 0x00, 0x01, 0x00,
+    0xD0, 0x92, 0x73, 0x00, 0x01, 0x00, 0xD1, 0x98, 0x73, 0x00, 0x00, 0x02, 0x4A, 0x00, 0x01, 0x00,
+    0xD0, 0x9E, 0x73, 0x00, 0x01, 0x00, 0xD1, 0xA4, 0x73, 0x00, 0x01, 0x00, 0xD1, 0xD0, 0x5F, 0x00,
+    0x01, 0x00, 0xD1, 0xAA, 0x73, 0x00, 0x01, 0x00, 0xD1, 0xB0, 0x73, 0x00, 0x01, 0x00, 0xD0, 0xB6,
+    0x73, 0x00, 0x01, 0x00, 0xD1, 0xBC, 0x73, 0x00, 0x01, 0x00, 0xD1, 0x6A, 0x4D, 0x00, 0x01, 0x00,
+    0xD0, 0xC2, 0x73, 0x00, 0x01, 0x00, 0xD1, 0xC8, 0x73, 0x00, 0x01, 0x00, 0xD0, 0xCE, 0x73, 0x00,
+    0x01, 0x00, 0xD0, 0xD4, 0x73, 0x00, 0x01, 0x02, 0x46, 0x00, 0xD0, 0xDA, 0x73, 0x00, 0x01, 0x00,
+    0xD0, 0xDA, 0x73, 0x00, 0x01, 0x00, 0xD0, 0xE0, 0x73, 0x00, 0x01, 0x00, 0xD0, 0xE6, 0x73, 0x00,
+    0x01, 0x00, 0xD0, 0xEC, 0x73, 0x00, 0x01, 0x00, 0xD0, 0xF2, 0x73, 0x00, 0x00, 0x03, 0x33, 0x00,
+    0x01, 0x00, 0xD0, 0xF8, 0x73, 0x00, 0x01, 0x00, 0xD0, 0xFE, 0x73, 0x00, 0x01, 0x00, 0xD0, 0x04,
+    0x74, 0x00, 0x01, 0x00, 0xD1, 0x0A, 0x74, 0x00, 0x01, 0x00, 0xD0, 0x10, 0x74, 0x00, 0x02, 0x00,
+    0xD0, 0xD1, 0x16, 0x74, 0x00, 0x1C, 0x74, 0x00, 0x01, 0x00, 0xD1, 0x22, 0x74, 0x00, 0x01, 0x00,
+    0xD0, 0x28, 0x74, 0x00, 0x01, 0x00, 0xD1, 0x2E, 0x74, 0x00, 0x00, 0x01, 0x2A, 0x00, 0x00, 0x02,
+    0x1D, 0x00, 0x00, 0x02, 0x0E, 0x00, 0x03, 0x00, 0x27, 0xD0, 0xD1, 0x34, 0x74, 0x00, 0x38, 0x74,
+    0x00, 0x56, 0x74, 0x00, 0x02, 0x02, 0x0E, 0x00, 0xD0, 0xD1, 0x6C, 0x74, 0x00, 0x72, 0x74, 0x00,
+    0x01, 0x02, 0x0E, 0x00, 0x27, 0x34, 0x74, 0x00, 0x01, 0x00, 0x80, 0x7C, 0x74, 0x00, 0x01, 0x00,
+    0xBE, 0x82, 0x74, 0x00, 0x01, 0x00, 0xB7, 0x24, 0x39, 0x00, 0x01, 0x00, 0xBE, 0x4C, 0x38, 0x00,
+    0x01, 0x00, 0x96, 0x88, 0x74, 0x00, 0x01, 0x00, 0xB2, 0x8E, 0x74, 0x00, 0x01, 0x00, 0x81, 0x94,
+    0x74, 0x00, 0x01, 0x00, 0x84, 0x9A, 0x74, 0x00, 0x01, 0x00, 0xB9, 0xA0, 0x74, 0x00, 0x02, 0x00,
+    0xB4, 0xB9, 0xA6, 0x74, 0x00, 0xAC, 0x74, 0x00, 0x01, 0x00, 0xBD, 0x24, 0x38, 0x00, 0x01, 0x00,
+    0x81, 0xB2, 0x74, 0x00, 0x01, 0x00, 0xB8, 0xB8, 0x74, 0x00, 0x01, 0x00, 0xB1, 0xBE, 0x74, 0x00,
+    0x01, 0x00, 0xB4, 0x24, 0x38, 0x00, 0x01, 0x00, 0x82, 0xC4, 0x74, 0x00, 0x01, 0x00, 0xBA, 0x62,
+    0x68, 0x00, 0x01, 0x00, 0xBC, 0x24, 0x38, 0x00, 0x01, 0x00, 0xBD, 0xCA, 0x74, 0x00, 0x01, 0x00,
+    0xBE, 0x68, 0x68, 0x00, 0x01, 0x00, 0xBC, 0xD0, 0x74, 0x00, 0x01, 0x00, 0xB0, 0xD6, 0x74, 0x00,
+    0x01, 0x00, 0x80, 0xDC, 0x74, 0x00, 0x01, 0x00, 0xB5, 0xE2, 0x74, 0x00, 0x01, 0x00, 0x82, 0xE8,
+    0x74, 0x00, 0x01, 0x00, 0xB5, 0xEE, 0x74, 0x00, 0x01, 0x00, 0xB0, 0xF4, 0x74, 0x00, 0x01, 0x00,
+    0x80, 0xFA, 0x74, 0x00, 0x01, 0x00, 0xB4, 0x00, 0x75, 0x00, 0x01, 0x00, 0x96, 0x04, 0x75, 0x00,
+    0x01, 0x00, 0xBB, 0x60, 0x58, 0x00, 0x01, 0x00, 0xB8, 0x40, 0x6B, 0x00, 0x01, 0x00, 0xB5, 0x0A,
+    0x75, 0x00, 0x01, 0x00, 0xB5, 0x10, 0x75, 0x00, 0x01, 0x00, 0xBE, 0x0A, 0x6A, 0x00, 0x01, 0x00,
+    0x81, 0x60, 0x58, 0x00, 0x01, 0x00, 0xBE, 0x16, 0x75, 0x00, 0x01, 0x00, 0xBF, 0x1C, 0x75, 0x00,
+    0x01, 0x00, 0xB5, 0x20, 0x75, 0x00, 0x01, 0x00, 0xBF, 0x26, 0x75, 0x00, 0x01, 0x00, 0x80, 0x2C,
+    0x75, 0x00, 0x01, 0x00, 0xB0, 0x32, 0x75, 0x00, 0x01, 0x00, 0xBD, 0x38, 0x75, 0x00, 0x01, 0x00,
+    0xBB, 0x24, 0x38, 0x00, 0x01, 0x00, 0x82, 0x24, 0x38, 0x00, 0x01, 0x00, 0xBF, 0x24, 0x38, 0x00,
+    0x01, 0x00, 0xB0, 0x62, 0x68, 0x00, 0x01, 0x00, 0xBC, 0x1A, 0x67, 0x00, 0x01, 0x00, 0x81, 0x62,
+    0x68, 0x00, 0x01, 0x00, 0xB8, 0x1A, 0x67, 0x00, 0x01, 0x00, 0xBF, 0x3E, 0x75, 0x00, 0x01, 0x00,
+    0xBE, 0xD8, 0x69, 0x00, 0x01, 0x00, 0xBC, 0x44, 0x75, 0x00, 0x01, 0x00, 0xB0, 0x4A, 0x75, 0x00,
+    0x01, 0x00, 0xB4, 0x50, 0x75, 0x00, 0x01, 0x00, 0x82, 0x50, 0x75, 0x00, 0x01, 0x00, 0xB1, 0x54,
+    0x75, 0x00, 0x01, 0x00, 0x82, 0x5A, 0x75, 0x00, 0x02, 0x00, 0xB0, 0xBC, 0x60, 0x75, 0x00, 0x66,
+    0x75, 0x00, 0x01, 0x00, 0xBD, 0x6C, 0x75, 0x00, 0x00, 0x02, 0xB3, 0x00, 0x01, 0x00, 0xB0, 0x72,
+    0x75, 0x00, 0x01, 0x00, 0x80, 0x76, 0x75, 0x00, 0x01, 0x00, 0xB0, 0x7C, 0x75, 0x00, 0x01, 0x00,
+    0xBE, 0x82, 0x75, 0x00, 0x01, 0x00, 0xB3, 0x88, 0x75, 0x00, 0x01, 0x00, 0xB9, 0x2C, 0x67, 0x00,
+    0x01, 0x00, 0xB1, 0x8E, 0x75, 0x00, 0x01, 0x00, 0xB5, 0x94, 0x75, 0x00, 0x01, 0x00, 0xBC, 0x9A,
+    0x75, 0x00, 0x02, 0x00, 0xB0, 0xB5, 0xA0, 0x75, 0x00, 0xA6, 0x75, 0x00, 0x01, 0x00, 0x82, 0xAC,
+    0x75, 0x00, 0x01, 0x00, 0x82, 0xB2, 0x75, 0x00, 0x01, 0x00, 0xB4, 0xB8, 0x75, 0x00, 0x01, 0x00,
+    0x82, 0xBE, 0x75, 0x00, 0x01, 0x00, 0xB5, 0xC4, 0x75, 0x00, 0x01, 0x00, 0x8E, 0xCA, 0x75, 0x00,
+    0x01, 0x00, 0xB8, 0xD0, 0x75, 0x00, 0x01, 0x00, 0x83, 0xD6, 0x75, 0x00, 0x01, 0x00, 0xB0, 0xDC,
+    0x75, 0x00, 0x01, 0x00, 0xBE, 0xD6, 0x75, 0x00, 0x01, 0x00, 0xB0, 0xE2, 0x75, 0x00, 0x01, 0x00,
+    0xB5, 0xE8, 0x75, 0x00, 0x01, 0x00, 0xBB, 0xF2, 0x75, 0x00, 0x01, 0x00, 0x82, 0xF8, 0x75, 0x00,
+    0x01, 0x00, 0xBB, 0xFE, 0x75, 0x00, 0x01, 0x00, 0xBB, 0x04, 0x76, 0x00, 0x01, 0x00, 0x80, 0x70,
+    0x66, 0x00, 0x01, 0x00, 0xB0, 0x68, 0x68, 0x00, 0x02, 0x00, 0xBC, 0xBD, 0x0A, 0x76, 0x00, 0x62,
+    0x68, 0x00, 0x02, 0x00, 0xB5, 0xB8, 0x10, 0x76, 0x00, 0x70, 0x66, 0x00, 0x02, 0x00, 0x81, 0x82,
+    0x1A, 0x76, 0x00, 0x20, 0x76, 0x00, 0x01, 0x00, 0xBA, 0x24, 0x38, 0x00, 0x01, 0x00, 0x80, 0x26,
+    0x76, 0x00, 0x02, 0x00, 0x80, 0x82, 0xA0, 0x74, 0x00, 0x2C, 0x76, 0x00, 0x01, 0x00, 0xB5, 0x32,
+    0x76, 0x00, 0x01, 0x00, 0xB7, 0x3A, 0x76, 0x00, 0x01, 0x00, 0xBE, 0x1A, 0x67, 0x00, 0x02, 0x00,
+    0xB8, 0xBE, 0x40, 0x76, 0x00, 0x0A, 0x76, 0x00, 0x01, 0x00, 0xBD, 0x46, 0x76, 0x00, 0x01, 0x00,
+    0xBB, 0x42, 0x53, 0x00, 0x01, 0x00, 0xBE, 0x4C, 0x76, 0x00, 0x01, 0x00, 0xB4, 0x52, 0x76, 0x00,
+    0x01, 0x00, 0xBE, 0x56, 0x76, 0x00, 0x01, 0x00, 0xB8, 0x5C, 0x76, 0x00, 0x01, 0x00, 0xBE, 0x62,
+    0x76, 0x00, 0x01, 0x00, 0xBB, 0x3E, 0x55, 0x00, 0x01, 0x00, 0x87, 0x68, 0x76, 0x00, 0x02, 0x00,
+    0x80, 0x82, 0x3E, 0x55, 0x00, 0x24, 0x39, 0x00, 0x01, 0x00, 0x87, 0x50, 0x75, 0x00, 0x01, 0x00,
+    0x96, 0x9C, 0x54, 0x00, 0x01, 0x00, 0x8F, 0x60, 0x58, 0x00, 0x01, 0x00, 0xBE, 0x6E, 0x76, 0x00,
+    0x01, 0x00, 0x81, 0x74, 0x76, 0x00, 0x01, 0x00, 0x8C, 0x7A, 0x76, 0x00, 0x02, 0x00, 0xB8, 0xBF,
+    0x80, 0x76, 0x00, 0x86, 0x76, 0x00, 0x01, 0x00, 0xBD, 0x8C, 0x76, 0x00, 0x01, 0x00, 0xB5, 0x92,
+    0x76, 0x00, 0x01, 0x00, 0xB0, 0x98, 0x76, 0x00, 0x02, 0x00, 0x80, 0x83, 0x9E, 0x76, 0x00, 0xA4,
+    0x76, 0x00, 0x01, 0x00, 0x80, 0xAA, 0x76, 0x00, 0x01, 0x00, 0xB4, 0xD8, 0x69, 0x00, 0x01, 0x00,
+    0x87, 0x8E, 0x38, 0x00, 0x01, 0x00, 0xB9, 0x74, 0x67, 0x00, 0x01, 0x00, 0xB0, 0xB0, 0x76, 0x00,
+    0x01, 0x00, 0xBE, 0xB6, 0x76, 0x00, 0x01, 0x00, 0xBE, 0xBC, 0x76, 0x00, 0x01, 0x00, 0xB5, 0xC0,
+    0x76, 0x00, 0x01, 0x00, 0xB7, 0x42, 0x53, 0x00, 0x01, 0x00, 0xB4, 0x42, 0x53, 0x00, 0x01, 0x00,
+    0xBD, 0x42, 0x53, 0x00, 0x01, 0x00, 0x82, 0xC6, 0x76, 0x00, 0x01, 0x00, 0xBE, 0xBC, 0x53, 0x00,
+    0x01, 0x00, 0x82, 0xCC, 0x76, 0x00, 0x01, 0x00, 0x82, 0x60, 0x58, 0x00, 0x01, 0x00, 0xB5, 0xD2,
+    0x76, 0x00, 0x01, 0x00, 0x81, 0x68, 0x68, 0x00, 0x01, 0x00, 0xB5, 0xD8, 0x76, 0x00, 0x01, 0x00,
+    0x80, 0xDE, 0x76, 0x00, 0x02, 0x00, 0xB8, 0xBE, 0xE4, 0x76, 0x00, 0xEA, 0x76, 0x00, 0x01, 0x00,
+    0x80, 0xF0, 0x76, 0x00, 0x01, 0x00, 0x83, 0xF6, 0x76, 0x00, 0x01, 0x00, 0x82, 0xFC, 0x76, 0x00,
+    0x01, 0x00, 0xB0, 0x02, 0x77, 0x00, 0x01, 0x00, 0x80, 0x3A, 0x76, 0x00, 0x01, 0x00, 0xBE, 0x08,
+    0x77, 0x00, 0x01, 0x00, 0x96, 0xA0, 0x74, 0x00, 0x01, 0x00, 0xBD, 0x0C, 0x66, 0x00, 0x01, 0x00,
+    0x82, 0x0E, 0x77, 0x00, 0x01, 0x00, 0xB2, 0x6E, 0x54, 0x00, 0x01, 0x00, 0xBC, 0xD8, 0x69, 0x00,
+    0x01, 0x00, 0xB0, 0x14, 0x77, 0x00, 0x01, 0x00, 0xBC, 0x42, 0x53, 0x00, 0x00, 0x02, 0xCF, 0x00,
+    0x01, 0x00, 0xB6, 0x42, 0x53, 0x00, 0x01, 0x00, 0xB0, 0xB8, 0x51, 0x00, 0x01, 0x00, 0xBC, 0x1A,
+    0x77, 0x00, 0x01, 0x00, 0xBD, 0x20, 0x77, 0x00, 0x01, 0x00, 0xB1, 0x26, 0x77, 0x00, 0x01, 0x00,
+    0xBB, 0x2C, 0x77, 0x00, 0x01, 0x00, 0x86, 0x24, 0x39, 0x00, 0x01, 0x00, 0xBB, 0x8E, 0x38, 0x00,
+    0x01, 0x00, 0xD1, 0x32, 0x77, 0x00, 0x01, 0x00, 0x82, 0x38, 0x77, 0x00, 0x01, 0x00, 0xBB, 0x3C,
+    0x77, 0x00, 0x01, 0x00, 0x82, 0x74, 0x67, 0x00, 0x01, 0x00, 0xBC, 0x42, 0x77, 0x00, 0x01, 0x00,
+    0x80, 0x48, 0x77, 0x00, 0x01, 0x00, 0xB0, 0xAC, 0x69, 0x00, 0x01, 0x00, 0xB6, 0x24, 0x39, 0x00,
+    0x01, 0x00, 0xBE, 0xBE, 0x51, 0x00, 0x01, 0x00, 0xB0, 0x16, 0x66, 0x00, 0x01, 0x00, 0x82, 0x4E,
+    0x77, 0x00, 0x01, 0x00, 0xB5, 0x54, 0x77, 0x00, 0x01, 0x00, 0xB8, 0x0C, 0x66, 0x00, 0x01, 0x00,
+    0x82, 0x5A, 0x77, 0x00, 0x01, 0x00, 0xBD, 0x60, 0x77, 0x00, 0x02, 0x00, 0xB0, 0xBE, 0x14, 0x77,
+    0x00, 0x66, 0x77, 0x00, 0x03, 0x00, 0x81, 0x83, 0x96, 0x70, 0x77, 0x00, 0x76, 0x77, 0x00, 0x7C,
+    0x77, 0x00, 0x03, 0x00, 0xB4, 0xBC, 0xBD, 0x50, 0x75, 0x00, 0xD8, 0x69, 0x00, 0x82, 0x77, 0x00,
+    0x01, 0x00, 0x80, 0x88, 0x77, 0x00, 0x01, 0x00, 0xBB, 0x8C, 0x77, 0x00, 0x04, 0x00, 0xB4, 0xB6,
+    0xB7, 0xBB, 0xD8, 0x69, 0x00, 0xD8, 0x69, 0x00, 0xD8, 0x69, 0x00, 0xD8, 0x69, 0x00, 0x02, 0x00,
+    0x81, 0x85, 0xD8, 0x69, 0x00, 0xD8, 0x69, 0x00, 0x01, 0x00, 0xB5, 0x92, 0x77, 0x00, 0x01, 0x00,
+    0xB7, 0x96, 0x77, 0x00, 0x01, 0x00, 0x80, 0x42, 0x53, 0x00, 0x01, 0x00, 0xB1, 0x42, 0x53, 0x00,
+    0x01, 0x00, 0x82, 0x46, 0x6B, 0x00, 0x01, 0x00, 0x80, 0x9C, 0x77, 0x00, 0x01, 0x00, 0xBD, 0xA2,
+    0x77, 0x00, 0x01, 0x00, 0xB5, 0xA8, 0x77, 0x00, 0x01, 0x00, 0xB5, 0xAE, 0x77, 0x00, 0x01, 0x00,
+    0xB5, 0xB4, 0x77, 0x00, 0x01, 0x00, 0xB2, 0xBA, 0x77, 0x00, 0x01, 0x00, 0xB5, 0xC0, 0x77, 0x00,
+    0x02, 0x00, 0xB0, 0xBE, 0xC6, 0x77, 0x00, 0xCC, 0x77, 0x00, 0x01, 0x00, 0xB5, 0xD2, 0x77, 0x00,
+    0x01, 0x00, 0xB0, 0xAE, 0x77, 0x00, 0x01, 0x00, 0x80, 0xD8, 0x77, 0x00, 0x01, 0x00, 0xB0, 0xDE,
+    0x77, 0x00, 0x01, 0x00, 0xBE, 0xE4, 0x77, 0x00, 0x01, 0x00, 0x96, 0xEA, 0x77, 0x00, 0x01, 0x00,
+    0x81, 0xF0, 0x77, 0x00, 0x01, 0x00, 0xB5, 0xF6, 0x77, 0x00, 0x01, 0x00, 0xB8, 0xFC, 0x77, 0x00,
+    0x01, 0x00, 0xB5, 0x02, 0x78, 0x00, 0x01, 0x00, 0x82, 0x08, 0x78, 0x00, 0x01, 0x00, 0xB0, 0x0E,
+    0x78, 0x00, 0x01, 0x00, 0xB8, 0x14, 0x78, 0x00, 0x01, 0x00, 0x96, 0x1A, 0x78, 0x00, 0x01, 0x00,
+    0xBD, 0x60, 0x58, 0x00, 0x01, 0x00, 0x8C, 0x6E, 0x54, 0x00, 0x01, 0x00, 0xB0, 0x20, 0x78, 0x00,
+    0x01, 0x00, 0x96, 0x6E, 0x54, 0x00, 0x01, 0x00, 0x82, 0x26, 0x78, 0x00, 0x01, 0x00, 0xBE, 0x2C,
+    0x78, 0x00, 0x01, 0x00, 0x82, 0x32, 0x78, 0x00, 0x01, 0x00, 0xB8, 0x10, 0x75, 0x00, 0x01, 0x00,
+    0xBD, 0x82, 0x77, 0x00, 0x01, 0x00, 0xBE, 0x0C, 0x66, 0x00, 0x01, 0x00, 0xD0, 0x38, 0x78, 0x00,
+    0x01, 0x00, 0xD0, 0x3E, 0x78, 0x00, 0x01, 0x00, 0xBD, 0x44, 0x78, 0x00, 0x01, 0x00, 0x80, 0x74,
+    0x67, 0x00, 0x01, 0x00, 0xBD, 0x4A, 0x78, 0x00, 0x01, 0x00, 0x82, 0x4A, 0x78, 0x00, 0x01, 0x00,
+    0xBE, 0x70, 0x66, 0x00, 0x01, 0x00, 0xBB, 0x74, 0x67, 0x00, 0x01, 0x00, 0xBC, 0x6E, 0x54, 0x00,
+    0x01, 0x00, 0xB2, 0x24, 0x38, 0x00, 0x01, 0x00, 0xBD, 0x4E, 0x78, 0x00, 0x05, 0x00, 0xB0, 0xB5,
+    0xB8, 0xBD, 0xBE, 0x54, 0x78, 0x00, 0x64, 0x78, 0x00, 0x6C, 0x78, 0x00, 0x60, 0x58, 0x00, 0x6E,
+    0x54, 0x00, 0x04, 0x00, 0x83, 0x8E, 0x8F, 0x96, 0x6E, 0x54, 0x00, 0x6E, 0x54, 0x00, 0x6E, 0x54,
+    0x00, 0x6E, 0x54, 0x00, 0x01, 0x00, 0xBF, 0x74, 0x67, 0x00, 0x01, 0x00, 0x82, 0x74, 0x78, 0x00,
+    0x01, 0x00, 0xBE, 0x7A, 0x78, 0x00, 0x01, 0x00, 0x96, 0xDA, 0x3F, 0x00, 0x01, 0x00, 0xB0, 0x80,
+    0x78, 0x00, 0x01, 0x00, 0x97, 0x86, 0x78, 0x00, 0x01, 0x00, 0x83, 0x8C, 0x78, 0x00, 0x01, 0x00,
+    0xBE, 0x3C, 0x53, 0x00, 0x04, 0x00, 0xB2, 0xB7, 0xBA, 0xBC, 0x92, 0x78, 0x00, 0x98, 0x78, 0x00,
+    0x9E, 0x78, 0x00, 0xA4, 0x78, 0x00, 0x01, 0x00, 0x81, 0xAA, 0x78, 0x00, 0x01, 0x00, 0xBE, 0xB0,
+    0x78, 0x00, 0x01, 0x00, 0x96, 0xB8, 0x78, 0x00, 0x01, 0x00, 0xBF, 0xBE, 0x78, 0x00, 0x02, 0x00,
+    0x82, 0x86, 0x6A, 0x3C, 0x00, 0x6A, 0x3C, 0x00, 0x03, 0x00, 0xB0, 0xB5, 0xBE, 0x14, 0x77, 0x00,
+    0xC4, 0x78, 0x00, 0xCA, 0x78, 0x00, 0x01, 0x00, 0xBB, 0xF8, 0x56, 0x00, 0x01, 0x00, 0x84, 0x24,
+    0x39, 0x00, 0x01, 0x00, 0xB4, 0xD0, 0x78, 0x00, 0x01, 0x00, 0x80, 0xD4, 0x78, 0x00, 0x01, 0x00,
+    0xB5, 0x3C, 0x53, 0x00, 0x01, 0x00, 0x96, 0x6A, 0x3C, 0x00, 0x01, 0x00, 0x80, 0x0C, 0x66, 0x00,
+    0x01, 0x00, 0x81, 0x0C, 0x66, 0x00, 0x01, 0x00, 0xB1, 0xDA, 0x78, 0x00, 0x01, 0x00, 0x81, 0xD2,
+    0x3B, 0x00, 0x01, 0x00, 0xBC, 0xE0, 0x78, 0x00, 0x01, 0x00, 0x80, 0xE6, 0x78, 0x00, 0x01, 0x00,
+    0xB5, 0xEC, 0x78, 0x00, 0x01, 0x00, 0xB1, 0xF2, 0x78, 0x00, 0x01, 0x00, 0xBE, 0xF8, 0x78, 0x00,
+    0x01, 0x00, 0xBB, 0x6A, 0x54, 0x00, 0x01, 0x00, 0xB2, 0xFE, 0x78, 0x00, 0x01, 0x00, 0xBC, 0x04,
+    0x79, 0x00, 0x01, 0x00, 0xB4, 0x0C, 0x79, 0x00, 0x01, 0x00, 0xBE, 0x10, 0x79, 0x00, 0x01, 0x00,
+    0xB7, 0x16, 0x79, 0x00, 0x01, 0x00, 0xBD, 0x1A, 0x79, 0x00, 0x01, 0x00, 0x80, 0x20, 0x79, 0x00,
+    0x01, 0x00, 0xBF, 0x26, 0x79, 0x00, 0x01, 0x00, 0xBE, 0x2C, 0x79, 0x00, 0x01, 0x00, 0x83, 0x32,
+    0x79, 0x00, 0x01, 0x00, 0x81, 0x38, 0x79, 0x00, 0x01, 0x00, 0xB2, 0x1A, 0x5B, 0x00, 0x01, 0x00,
+    0x80, 0x3E, 0x79, 0x00, 0x00, 0x02, 0x10, 0x00, 0x07, 0x00, 0xB1, 0xB2, 0xB3, 0xB4, 0xBC, 0xBE,
+    0xBF, 0x42, 0x79, 0x00, 0x48, 0x79, 0x00, 0x02, 0x6D, 0x00, 0x02, 0x6D, 0x00, 0x02, 0x6D, 0x00,
+    0x4E, 0x79, 0x00, 0x54, 0x79, 0x00, 0x05, 0x00, 0x80, 0x81, 0x83, 0x84, 0x87, 0x02, 0x6D, 0x00,
+    0x46, 0x5B, 0x00, 0x5A, 0x79, 0x00, 0x64, 0x79, 0x00, 0x02, 0x6D, 0x00, 0x01, 0x00, 0xB8, 0x6A,
+    0x79, 0x00, 0x02, 0x00, 0x8F, 0x96, 0x6A, 0x79, 0x00, 0x6A, 0x79, 0x00, 0x01, 0x00, 0xD0, 0x6E,
+    0x79, 0x00, 0x01, 0x00, 0xD0, 0x74, 0x79, 0x00, 0x01, 0x00, 0xD1, 0x7A, 0x79, 0x00, 0x01, 0x00,
+    0xD0, 0x80, 0x79, 0x00, 0x01, 0x00, 0xD0, 0x86, 0x79, 0x00, 0x01, 0x00, 0xD0, 0x8C, 0x79, 0x00,
+    0x01, 0x00, 0xD1, 0x92, 0x79, 0x00, 0x01, 0x00, 0xD1, 0x98, 0x79, 0x00, 0x01, 0x00, 0xD1, 0x9E,
+    0x79, 0x00, 0x01, 0x00, 0xD1, 0xA4, 0x79, 0x00, 0x01, 0x00, 0xD0, 0xAA, 0x79, 0x00, 0x01, 0x00,
+    0xD1, 0xB0, 0x79, 0x00, 0x01, 0x00, 0xD0, 0xB6, 0x79, 0x00, 0x01, 0x00, 0xD1, 0xBC, 0x79, 0x00,
+    0x01, 0x00, 0xD0, 0xC2, 0x79, 0x00, 0x01, 0x00, 0xD0, 0xC8, 0x79, 0x00, 0x01, 0x00, 0xD1, 0xCE,
+    0x79, 0x00, 0x01, 0x00, 0xD0, 0xD4, 0x79, 0x00, 0x01, 0x00, 0xD1, 0xDA, 0x79, 0x00, 0x01, 0x00,
+    0xD1, 0xE0, 0x79, 0x00, 0x01, 0x00, 0xD1, 0xE6, 0x79, 0x00, 0x01, 0x00, 0xD0, 0xEC, 0x79, 0x00,
+    0x00, 0x02, 0xA6, 0x00, 0x01, 0x00, 0xD1, 0xF2, 0x79, 0x00, 0x01, 0x00, 0xD0, 0xF8, 0x79, 0x00,
+    0x01, 0x00, 0xD0, 0xFE, 0x79, 0x00, 0x01, 0x00, 0xD1, 0x04, 0x7A, 0x00, 0x00, 0x02, 0xBE, 0x00,
+    0x01, 0x00, 0xD1, 0x0A, 0x7A, 0x00, 0x01, 0x00, 0xD0, 0x10, 0x7A, 0x00, 0x01, 0x00, 0xD0, 0x16,
+    0x7A, 0x00, 0x01, 0x00, 0xD0, 0x1C, 0x7A, 0x00, 0x01, 0x00, 0xD0, 0x22, 0x7A, 0x00, 0x01, 0x00,
+    0xD0, 0x28, 0x7A, 0x00, 0x01, 0x00, 0xD0, 0x2E, 0x7A, 0x00, 0x01, 0x00, 0xD1, 0x34, 0x7A, 0x00,
+    0x00, 0x02, 0x70, 0x00, 0x01, 0x00, 0xD1, 0x3A, 0x7A, 0x00, 0x01, 0x00, 0xD0, 0x40, 0x7A, 0x00,
+    0x01, 0x00, 0xD0, 0x46, 0x7A, 0x00, 0x01, 0x00, 0xD0, 0x4C, 0x7A, 0x00, 0x01, 0x00, 0xD0, 0x52,
+    0x7A, 0x00, 0x00, 0x01, 0xF1, 0x00, 0x01, 0x00, 0xD0, 0x58, 0x7A, 0x00, 0x01, 0x00, 0xD0, 0x5E,
+    0x7A, 0x00, 0x01, 0x00, 0xD0, 0x64, 0x7A, 0x00, 0x01, 0x00, 0xD0, 0x6A, 0x7A, 0x00, 0x01, 0x00,
+    0xD1, 0x70, 0x7A, 0x00, 0x01, 0x00, 0xD0, 0x76, 0x7A, 0x00, 0x01, 0x00, 0xD0, 0x7C, 0x7A, 0x00,
+    0x01, 0x00, 0xD0, 0x82, 0x7A, 0x00, 0x01, 0x00, 0xD0, 0x88, 0x7A, 0x00, 0x01, 0x00, 0xD0, 0x8E,
+    0x7A, 0x00, 0x01, 0x00, 0xD0, 0x94, 0x7A, 0x00, 0x01, 0x00, 0xD0, 0x9A, 0x7A, 0x00, 0x01, 0x00,
+    0xD0, 0xA0, 0x7A, 0x00, 0x01, 0x00, 0xD0, 0xA6, 0x7A, 0x00, 0x01, 0x00, 0xD0, 0xAC, 0x7A, 0x00,
+    0x01, 0x00, 0xD0, 0xB2, 0x7A, 0x00, 0x01, 0x00, 0xD0, 0xB8, 0x7A, 0x00, 0x01, 0x00, 0xD0, 0xBE,
+    0x7A, 0x00, 0x01, 0x00, 0xD1, 0xC4, 0x7A, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xCA, 0x7A, 0x00, 0xD0,
+    0x7A, 0x00, 0x01, 0x00, 0xD1, 0xD6, 0x7A, 0x00, 0x01, 0x00, 0xD1, 0xDC, 0x7A, 0x00, 0x01, 0x00,
+    0xD1, 0xE2, 0x7A, 0x00, 0x01, 0x00, 0xD0, 0xE8, 0x7A, 0x00, 0x01, 0x00, 0xD1, 0xEE, 0x7A, 0x00,
+    0x02, 0x00, 0xD0, 0xD1, 0x80, 0x6D, 0x00, 0xF4, 0x7A, 0x00, 0x01, 0x00, 0xD1, 0xFE, 0x7A, 0x00,
+    0x01, 0x00, 0xD1, 0x04, 0x7B, 0x00, 0x01, 0x00, 0xD0, 0x0A, 0x7B, 0x00, 0x01, 0x00, 0xD1, 0x10,
+    0x7B, 0x00, 0x01, 0x02, 0x55, 0x00, 0xD0, 0x16, 0x7B, 0x00, 0x01, 0x00, 0xD0, 0x1C, 0x7B, 0x00,
+    0x01, 0x00, 0xD0, 0x22, 0x7B, 0x00, 0x01, 0x00, 0xD0, 0x28, 0x7B, 0x00, 0x01, 0x00, 0xD0, 0x2E,
+    0x7B, 0x00, 0x00, 0x03, 0xDC, 0x00, 0x01, 0x00, 0xD0, 0x34, 0x7B, 0x00, 0x01, 0x00, 0xD1, 0x3A,
+    0x7B, 0x00, 0x01, 0x00, 0xD1, 0x40, 0x7B, 0x00, 0x01, 0x00, 0xD1, 0x46, 0x7B, 0x00, 0x01, 0x00,
+    0xD0, 0x4C, 0x7B, 0x00, 0x01, 0x00, 0xD1, 0x52, 0x7B, 0x00, 0x01, 0x00, 0xD0, 0x58, 0x7B, 0x00,
+    0x01, 0x00, 0xD1, 0x5E, 0x7B, 0x00, 0x01, 0x00, 0xD0, 0x64, 0x7B, 0x00, 0x01, 0x00, 0xD0, 0x6A,
+    0x7B, 0x00, 0x01, 0x00, 0xD0, 0x70, 0x7B, 0x00, 0x01, 0x00, 0xD1, 0x76, 0x7B, 0x00, 0x01, 0x00,
+    0xD0, 0x7C, 0x7B, 0x00, 0x01, 0x00, 0xD0, 0x82, 0x7B, 0x00, 0x01, 0x00, 0xD1, 0x88, 0x7B, 0x00,
+    0x01, 0x00, 0xD1, 0x8E, 0x7B, 0x00, 0x01, 0x00, 0xD0, 0x94, 0x7B, 0x00, 0x00, 0x03, 0x92, 0x00,
+    0x01, 0x00, 0xD1, 0x9A, 0x7B, 0x00, 0x01, 0x00, 0xD1, 0xA0, 0x7B, 0x00, 0x01, 0x00, 0xD0, 0xA6,
+    0x7B, 0x00, 0x01, 0x00, 0xD0, 0xAC, 0x7B, 0x00, 0x01, 0x00, 0xD1, 0xB2, 0x7B, 0x00, 0x01, 0x00,
+    0xD0, 0xB8, 0x7B, 0x00, 0x01, 0x00, 0xD0, 0xBE, 0x7B, 0x00, 0x01, 0x00, 0xD0, 0xC4, 0x7B, 0x00,
+    0x01, 0x00, 0xD1, 0xCA, 0x7B, 0x00, 0x01, 0x00, 0xD0, 0xD0, 0x7B, 0x00, 0x01, 0x00, 0xD0, 0xD6,
+    0x7B, 0x00, 0x01, 0x00, 0xD0, 0xDC, 0x7B, 0x00, 0x01, 0x00, 0xD0, 0xE2, 0x7B, 0x00, 0x01, 0x00,
+    0xD0, 0xE8, 0x7B, 0x00, 0x01, 0x00, 0xD0, 0xEE, 0x7B, 0x00, 0x01, 0x00, 0xD1, 0xF4, 0x7B, 0x00,
+    0x01, 0x00, 0xD0, 0xFA, 0x7B, 0x00, 0x01, 0x00, 0xD0, 0x00, 0x7C, 0x00, 0x01, 0x00, 0xD1, 0x06,
+    0x7C, 0x00, 0x01, 0x00, 0x8F, 0x0C, 0x7C, 0x00, 0x00, 0x03, 0xB9, 0x00, 0x01, 0x00, 0xD1, 0x10,
+    0x7C, 0x00, 0x01, 0x00, 0xD1, 0x16, 0x7C, 0x00, 0x01, 0x00, 0xD0, 0x1C, 0x7C, 0x00, 0x01, 0x00,
+    0xD0, 0x22, 0x7C, 0x00, 0x01, 0x00, 0xD1, 0x28, 0x7C, 0x00, 0x01, 0x00, 0xD0, 0x2E, 0x7C, 0x00,
+    0x01, 0x00, 0xD1, 0x34, 0x7C, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x3A, 0x7C, 0x00, 0x44, 0x7C, 0x00,
+    0x01, 0x00, 0xD0, 0x4A, 0x7C, 0x00, 0x01, 0x00, 0xD0, 0x50, 0x7C, 0x00, 0x01, 0x00, 0xD1, 0x56,
+    0x7C, 0x00, 0x01, 0x00, 0xD1, 0x5C, 0x7C, 0x00, 0x00, 0x02, 0x7D, 0x00, 0x01, 0x00, 0xD0, 0x62,
+    0x7C, 0x00, 0x00, 0x02, 0xC8, 0x00, 0x01, 0x00, 0xD1, 0x68, 0x7C, 0x00, 0x01, 0x00, 0xD0, 0x6E,
+    0x7C, 0x00, 0x01, 0x00, 0xD0, 0x74, 0x7C, 0x00, 0x01, 0x00, 0xD0, 0x7A, 0x7C, 0x00, 0x01, 0x00,
+    0xD1, 0x80, 0x7C, 0x00, 0x01, 0x00, 0xD0, 0x86, 0x7C, 0x00, 0x01, 0x00, 0xD0, 0x8C, 0x7C, 0x00,
+    0x01, 0x00, 0xD0, 0x92, 0x7C, 0x00, 0x01, 0x00, 0xD0, 0x98, 0x7C, 0x00, 0x01, 0x00, 0xD0, 0x9E,
+    0x7C, 0x00, 0x01, 0x00, 0xD0, 0xA8, 0x7C, 0x00, 0x01, 0x00, 0xD0, 0xAE, 0x7C, 0x00, 0x01, 0x00,
+    0xD0, 0xB8, 0x7C, 0x00, 0x01, 0x00, 0xD1, 0xBE, 0x7C, 0x00, 0x01, 0x00, 0xD0, 0xC4, 0x7C, 0x00,
+    0x01, 0x00, 0xD1, 0xCA, 0x7C, 0x00, 0x01, 0x00, 0xD0, 0xD0, 0x7C, 0x00, 0x01, 0x00, 0xD0, 0xD6,
+    0x7C, 0x00, 0x01, 0x00, 0xD0, 0xDC, 0x7C, 0x00, 0x01, 0x00, 0xD0, 0xE2, 0x7C, 0x00, 0x01, 0x00,
+    0xD0, 0xE8, 0x7C, 0x00, 0x01, 0x00, 0xD1, 0xEE, 0x7C, 0x00, 0x01, 0x00, 0xD0, 0xF4, 0x7C, 0x00,
+    0x01, 0x00, 0xD0, 0xFA, 0x7C, 0x00, 0x01, 0x00, 0xD1, 0x00, 0x7D, 0x00, 0x01, 0x00, 0xD0, 0xCA,
+    0x5F, 0x00, 0x01, 0x00, 0xD0, 0x06, 0x7D, 0x00, 0x01, 0x00, 0xBD, 0x08, 0x5B, 0x00, 0x01, 0x00,
+    0xBD, 0x0C, 0x7D, 0x00, 0x01, 0x00, 0xD1, 0xC8, 0x72, 0x00, 0x00, 0x01, 0x91, 0x00, 0x01, 0x00,
+    0xD0, 0x10, 0x7D, 0x00, 0x03, 0x01, 0x54, 0x00, 0x2E, 0xD0, 0xD1, 0x6E, 0x54, 0x00, 0x16, 0x7D,
+    0x00, 0x1C, 0x7D, 0x00, 0x01, 0x01, 0x54, 0x00, 0xD1, 0x22, 0x7D, 0x00, 0x01, 0x02, 0x89, 0x00,
+    0x2E, 0x72, 0x6B, 0x00, 0x01, 0x00, 0xD0, 0x28, 0x7D, 0x00, 0x01, 0x00, 0xD1, 0x2E, 0x7D, 0x00,
+    0x01, 0x00, 0xD1, 0x34, 0x7D, 0x00, 0x01, 0x00, 0xD0, 0x3A, 0x7D, 0x00, 0x01, 0x00, 0xD1, 0x40,
+    0x7D, 0x00, 0x01, 0x00, 0xD0, 0x46, 0x7D, 0x00, 0x01, 0x00, 0xD0, 0x4C, 0x7D, 0x00, 0x01, 0x00,
+    0xD0, 0x52, 0x7D, 0x00, 0x01, 0x00, 0xD0, 0x5C, 0x7D, 0x00, 0x01, 0x00, 0xD0, 0x62, 0x7D, 0x00,
+    0x01, 0x03, 0x61, 0x00, 0xD0, 0x32, 0x4A, 0x00, 0x01, 0x00, 0xD0, 0x68, 0x7D, 0x00, 0x01, 0x00,
+    0xD1, 0x6E, 0x7D, 0x00, 0x01, 0x00, 0xD1, 0x74, 0x7D, 0x00, 0x01, 0x00, 0xD0, 0x7A, 0x7D, 0x00,
+    0x00, 0x04, 0x67, 0x00, 0x01, 0x00, 0xD0, 0x80, 0x7D, 0x00, 0x01, 0x00, 0xD0, 0x86, 0x7D, 0x00,
+    0x01, 0x00, 0xD0, 0x8C, 0x7D, 0x00, 0x01, 0x00, 0xD0, 0x92, 0x7D, 0x00, 0x01, 0x00, 0xD0, 0x98,
+    0x7D, 0x00, 0x01, 0x00, 0xD1, 0x9E, 0x7D, 0x00, 0x01, 0x00, 0xD0, 0xA4, 0x7D, 0x00, 0x01, 0x00,
+    0x27, 0xAA, 0x7D, 0x00, 0x01, 0x02, 0x46, 0x00, 0xD0, 0xB0, 0x7D, 0x00, 0x00, 0x02, 0x2F, 0x00,
+    0x01, 0x00, 0xD0, 0xB6, 0x7D, 0x00, 0x00, 0x03, 0x36, 0x00, 0x01, 0x00, 0xD0, 0xBC, 0x7D, 0x00,
+    0x01, 0x00, 0xD0, 0xC2, 0x7D, 0x00, 0x01, 0x00, 0xD0, 0xC8, 0x7D, 0x00, 0x01, 0x00, 0xD1, 0xCE,
+    0x7D, 0x00, 0x01, 0x00, 0xD1, 0xD4, 0x7D, 0x00, 0x01, 0x00, 0xD0, 0xDA, 0x7D, 0x00, 0x00, 0x02,
+    0x27, 0x00, 0x01, 0x00, 0xD0, 0xE0, 0x7D, 0x00, 0x01, 0x00, 0xD0, 0xE6, 0x7D, 0x00, 0x01, 0x00,
+    0xD1, 0xEC, 0x7D, 0x00, 0x01, 0x00, 0xD0, 0xF2, 0x7D, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0xFC, 0x7D,
+    0x00, 0x02, 0x7E, 0x00, 0x01, 0x00, 0xD1, 0x08, 0x7E, 0x00, 0x00, 0x02, 0x24, 0x00, 0x01, 0x00,
+    0xB3, 0x24, 0x38, 0x00, 0x01, 0x00, 0xBD, 0x0E, 0x7E, 0x00, 0x01, 0x00, 0x88, 0x24, 0x38, 0x00,
+    0x01, 0x00, 0xBE, 0x5E, 0x66, 0x00, 0x01, 0x00, 0xB0, 0x12, 0x7E, 0x00, 0x01, 0x00, 0xB5, 0x24,
+    0x38, 0x00, 0x01, 0x00, 0x81, 0x24, 0x38, 0x00, 0x01, 0x00, 0x96, 0x18, 0x7E, 0x00, 0x01, 0x00,
+    0x81, 0x1E, 0x7E, 0x00, 0x01, 0x00, 0x82, 0xBE, 0x74, 0x00, 0x01, 0x00, 0xBD, 0x38, 0x77, 0x00,
+    0x01, 0x00, 0x80, 0x38, 0x77, 0x00, 0x01, 0x00, 0xB0, 0xB8, 0x74, 0x00, 0x01, 0x00, 0x82, 0xEE,
+    0x74, 0x00, 0x01, 0x00, 0xB5, 0x26, 0x7E, 0x00, 0x01, 0x00, 0xBB, 0x2C, 0x7E, 0x00, 0x01, 0x00,
+    0x96, 0x32, 0x7E, 0x00, 0x01, 0x00, 0xBE, 0x38, 0x7E, 0x00, 0x01, 0x00, 0x80, 0x18, 0x7E, 0x00,
+    0x01, 0x00, 0x80, 0x24, 0x38, 0x00, 0x01, 0x00, 0x80, 0x3C, 0x7E, 0x00, 0x01, 0x00, 0xB5, 0x66,
+    0x6C, 0x00, 0x01, 0x00, 0x81, 0x3C, 0x7E, 0x00, 0x01, 0x00, 0xB9, 0xBC, 0x76, 0x00, 0x01, 0x00,
+    0xBD, 0x42, 0x7E, 0x00, 0x01, 0x00, 0x81, 0xAE, 0x77, 0x00, 0x01, 0x00, 0x85, 0x46, 0x7E, 0x00,
+    0x01, 0x00, 0xB5, 0x4A, 0x7E, 0x00, 0x01, 0x00, 0xBE, 0x46, 0x7E, 0x00, 0x01, 0x00, 0xB4, 0x46,
+    0x7E, 0x00, 0x01, 0x00, 0xB6, 0x50, 0x7E, 0x00, 0x01, 0x00, 0xBE, 0x54, 0x7E, 0x00, 0x01, 0x00,
+    0xB5, 0x5A, 0x7E, 0x00, 0x01, 0x00, 0x86, 0x60, 0x7E, 0x00, 0x01, 0x00, 0x96, 0x84, 0x6A, 0x00,
+    0x01, 0x00, 0xBE, 0x64, 0x7E, 0x00, 0x01, 0x00, 0xBC, 0x6A, 0x7E, 0x00, 0x01, 0x00, 0xB5, 0x70,
+    0x7E, 0x00, 0x01, 0x00, 0xBD, 0x76, 0x7E, 0x00, 0x01, 0x00, 0xB0, 0x7C, 0x7E, 0x00, 0x01, 0x00,
+    0xBD, 0x82, 0x7E, 0x00, 0x01, 0x00, 0xB7, 0x86, 0x7E, 0x00, 0x01, 0x00, 0xBE, 0x8A, 0x7E, 0x00,
+    0x01, 0x00, 0x80, 0x90, 0x7E, 0x00, 0x01, 0x00, 0xB9, 0x16, 0x75, 0x00, 0x01, 0x00, 0xB5, 0x96,
+    0x7E, 0x00, 0x01, 0x00, 0xBA, 0x9C, 0x7E, 0x00, 0x01, 0x00, 0xBC, 0xA2, 0x7E, 0x00, 0x01, 0x00,
+    0xBE, 0x70, 0x77, 0x00, 0x01, 0x00, 0xBC, 0xA8, 0x7E, 0x00, 0x01, 0x00, 0xBC, 0xAE, 0x7E, 0x00,
+    0x01, 0x00, 0xBE, 0xB8, 0x75, 0x00, 0x01, 0x00, 0xB7, 0x80, 0x57, 0x00, 0x01, 0x00, 0xB4, 0xB2,
+    0x7E, 0x00, 0x01, 0x00, 0xB4, 0xB8, 0x7E, 0x00, 0x01, 0x00, 0xBC, 0xB8, 0x7E, 0x00, 0x01, 0x00,
+    0xBC, 0xBC, 0x7E, 0x00, 0x01, 0x00, 0x84, 0xC2, 0x7E, 0x00, 0x01, 0x00, 0xB7, 0xC8, 0x7E, 0x00,
+    0x01, 0x00, 0x94, 0xCE, 0x7E, 0x00, 0x01, 0x00, 0x83, 0xB2, 0x7E, 0x00, 0x01, 0x00, 0x80, 0xB8,
+    0x7E, 0x00, 0x01, 0x00, 0x8C, 0x60, 0x58, 0x00, 0x01, 0x00, 0xB0, 0xD4, 0x7E, 0x00, 0x01, 0x00,
+    0x84, 0x24, 0x38, 0x00, 0x02, 0x00, 0x82, 0x86, 0x24, 0x38, 0x00, 0x24, 0x38, 0x00, 0x01, 0x00,
+    0x96, 0x24, 0x38, 0x00, 0x01, 0x00, 0x83, 0x24, 0x38, 0x00, 0x01, 0x00, 0xB8, 0x62, 0x68, 0x00,
+    0x01, 0x00, 0x87, 0x24, 0x38, 0x00, 0x01, 0x00, 0xB9, 0x24, 0x38, 0x00, 0x01, 0x00, 0xB8, 0x24,
+    0x38, 0x00, 0x01, 0x00, 0xB1, 0x24, 0x38, 0x00, 0x01, 0x00, 0xBA, 0xDA, 0x7E, 0x00, 0x01, 0x00,
+    0xB2, 0xE0, 0x7E, 0x00, 0x01, 0x00, 0xB7, 0xE6, 0x7E, 0x00, 0x01, 0x00, 0x81, 0xEC, 0x7E, 0x00,
+    0x01, 0x00, 0x88, 0x24, 0x39, 0x00, 0x01, 0x00, 0x83, 0xF2, 0x7E, 0x00, 0x01, 0x00, 0xBC, 0xF8,
+    0x7E, 0x00, 0x01, 0x00, 0x82, 0xFE, 0x7E, 0x00, 0x01, 0x00, 0xBC, 0x04, 0x7F, 0x00, 0x01, 0x00,
+    0x80, 0x0A, 0x7F, 0x00, 0x01, 0x00, 0xBB, 0x10, 0x7F, 0x00, 0x01, 0x00, 0xB5, 0x50, 0x3D, 0x00,
+    0x01, 0x00, 0xBD, 0x16, 0x7F, 0x00, 0x01, 0x00, 0x80, 0x1C, 0x7F, 0x00, 0x01, 0x00, 0xB5, 0x8E,
+    0x38, 0x00, 0x01, 0x00, 0xB4, 0x22, 0x7F, 0x00, 0x01, 0x00, 0x82, 0x28, 0x7F, 0x00, 0x01, 0x00,
+    0x80, 0x2E, 0x7F, 0x00, 0x01, 0x00, 0xB1, 0x60, 0x58, 0x00, 0x01, 0x00, 0x80, 0xBC, 0x76, 0x00,
+    0x01, 0x00, 0x8C, 0x42, 0x53, 0x00, 0x01, 0x00, 0xBE, 0x34, 0x7F, 0x00, 0x01, 0x00, 0xBA, 0x5A,
+    0x6C, 0x00, 0x01, 0x00, 0x80, 0x3A, 0x7F, 0x00, 0x01, 0x00, 0xB0, 0x42, 0x7F, 0x00, 0x01, 0x00,
+    0xB4, 0x50, 0x69, 0x00, 0x01, 0x00, 0xBB, 0x50, 0x69, 0x00, 0x01, 0x00, 0x8F, 0xE4, 0x76, 0x00,
+    0x01, 0x00, 0xBA, 0x50, 0x69, 0x00, 0x01, 0x00, 0xB0, 0x48, 0x7F, 0x00, 0x01, 0x00, 0xB9, 0x50,
+    0x69, 0x00, 0x01, 0x00, 0xB3, 0x38, 0x77, 0x00, 0x01, 0x00, 0xBE, 0x4E, 0x7F, 0x00, 0x01, 0x00,
+    0xB2, 0x54, 0x7F, 0x00, 0x01, 0x00, 0x83, 0xFA, 0x54, 0x00, 0x01, 0x00, 0xB4, 0x62, 0x76, 0x00,
+    0x01, 0x00, 0xB5, 0xDC, 0x54, 0x00, 0x01, 0x00, 0x8C, 0x82, 0x3A, 0x00, 0x00, 0x02, 0xB1, 0x00,
+    0x01, 0x00, 0x96, 0x38, 0x69, 0x00, 0x01, 0x00, 0x96, 0xB8, 0x74, 0x00, 0x01, 0x00, 0xB6, 0x5A,
+    0x7F, 0x00, 0x01, 0x00, 0xB5, 0x5A, 0x6C, 0x00, 0x01, 0x00, 0x86, 0x5E, 0x7F, 0x00, 0x01, 0x00,
+    0xBE, 0x64, 0x7F, 0x00, 0x01, 0x00, 0x96, 0x6A, 0x7F, 0x00, 0x02, 0x00, 0xB1, 0xBF, 0x70, 0x7F,
+    0x00, 0x76, 0x7F, 0x00, 0x01, 0x00, 0x81, 0x7C, 0x7F, 0x00, 0x01, 0x00, 0xBC, 0x1C, 0x75, 0x00,
+    0x01, 0x00, 0xBC, 0x82, 0x7F, 0x00, 0x01, 0x00, 0x81, 0x88, 0x7F, 0x00, 0x01, 0x00, 0x8F, 0xD8,
+    0x69, 0x00, 0x01, 0x00, 0xB8, 0x8E, 0x7F, 0x00, 0x01, 0x00, 0x83, 0x42, 0x53, 0x00, 0x01, 0x00,
+    0xBE, 0x94, 0x7F, 0x00, 0x01, 0x00, 0xB0, 0x9A, 0x7F, 0x00, 0x01, 0x00, 0xBA, 0xA0, 0x7F, 0x00,
+    0x01, 0x00, 0x82, 0x80, 0x57, 0x00, 0x01, 0x00, 0xBB, 0x80, 0x57, 0x00, 0x01, 0x00, 0xB0, 0xA6,
+    0x7F, 0x00, 0x01, 0x00, 0xBA, 0xAC, 0x7F, 0x00, 0x01, 0x00, 0xBF, 0x80, 0x57, 0x00, 0x02, 0x00,
+    0xBC, 0xBD, 0xB2, 0x7F, 0x00, 0xBA, 0x7F, 0x00, 0x01, 0x00, 0xBD, 0xC0, 0x7F, 0x00, 0x02, 0x00,
+    0xB8, 0xBE, 0xC6, 0x7F, 0x00, 0xCC, 0x7F, 0x00, 0x01, 0x00, 0xB4, 0xD2, 0x7F, 0x00, 0x01, 0x00,
+    0x86, 0xD8, 0x7F, 0x00, 0x01, 0x00, 0xBA, 0xE0, 0x7F, 0x00, 0x01, 0x00, 0x82, 0xE6, 0x7F, 0x00,
+    0x01, 0x00, 0xB9, 0xEC, 0x7F, 0x00, 0x01, 0x00, 0xBF, 0x8E, 0x38, 0x00, 0x01, 0x00, 0xBC, 0x0C,
+    0x66, 0x00, 0x01, 0x00, 0xBD, 0xF2, 0x7F, 0x00, 0x01, 0x00, 0xB9, 0x80, 0x57, 0x00, 0x01, 0x00,
+    0x80, 0xF6, 0x7F, 0x00, 0x01, 0x00, 0xB4, 0xFC, 0x7F, 0x00, 0x01, 0x00, 0xBB, 0x0C, 0x66, 0x00,
+    0x01, 0x00, 0x80, 0x00, 0x80, 0x00, 0x01, 0x00, 0xBE, 0x60, 0x6C, 0x00, 0x00, 0x02, 0x83, 0x00,
+    0x01, 0x00, 0xBD, 0x14, 0x56, 0x00, 0x01, 0x00, 0xBC, 0x04, 0x80, 0x00, 0x01, 0x00, 0x85, 0x6E,
+    0x54, 0x00, 0x01, 0x00, 0x88, 0x60, 0x58, 0x00, 0x01, 0x00, 0xB8, 0x08, 0x80, 0x00, 0x01, 0x00,
+    0x80, 0x0E, 0x80, 0x00, 0x01, 0x00, 0x81, 0x8E, 0x38, 0x00, 0x01, 0x00, 0xB4, 0x38, 0x7E, 0x00,
+    0x01, 0x00, 0x80, 0x80, 0x57, 0x00, 0x01, 0x00, 0xB8, 0x14, 0x80, 0x00, 0x01, 0x00, 0xB0, 0x1A,
+    0x80, 0x00, 0x02, 0x00, 0xBB, 0xBE, 0x20, 0x80, 0x00, 0x26, 0x80, 0x00, 0x01, 0x00, 0xB0, 0x2C,
+    0x80, 0x00, 0x01, 0x00, 0xBC, 0x32, 0x80, 0x00, 0x01, 0x00, 0xB4, 0x38, 0x80, 0x00, 0x01, 0x00,
+    0x80, 0x3C, 0x80, 0x00, 0x01, 0x00, 0x84, 0x40, 0x80, 0x00, 0x01, 0x00, 0xB1, 0x46, 0x80, 0x00,
+    0x01, 0x00, 0xB5, 0x28, 0x3E, 0x00, 0x01, 0x00, 0xB0, 0x4C, 0x80, 0x00, 0x01, 0x00, 0xB5, 0x52,
+    0x80, 0x00, 0x01, 0x00, 0xB8, 0x58, 0x80, 0x00, 0x01, 0x00, 0xBD, 0x5E, 0x80, 0x00, 0x01, 0x00,
+    0x80, 0x64, 0x80, 0x00, 0x01, 0x00, 0xBF, 0xB8, 0x7E, 0x00, 0x01, 0x00, 0xD1, 0x6A, 0x80, 0x00,
+    0x01, 0x00, 0xB0, 0x70, 0x80, 0x00, 0x01, 0x00, 0xB1, 0x76, 0x80, 0x00, 0x01, 0x00, 0xB0, 0x66,
+    0x5B, 0x00, 0x01, 0x00, 0xB8, 0x7A, 0x80, 0x00, 0x01, 0x00, 0xB8, 0x80, 0x80, 0x00, 0x01, 0x00,
+    0x80, 0x7A, 0x80, 0x00, 0x01, 0x00, 0x80, 0x66, 0x5B, 0x00, 0x01, 0x00, 0xBF, 0x86, 0x80, 0x00,
+    0x01, 0x00, 0xB0, 0x8C, 0x80, 0x00, 0x01, 0x00, 0xB8, 0x92, 0x80, 0x00, 0x01, 0x00, 0x81, 0x98,
+    0x80, 0x00, 0x02, 0x00, 0xBB, 0xBE, 0x9E, 0x80, 0x00, 0xA4, 0x80, 0x00, 0x01, 0x00, 0xBC, 0xAA,
+    0x80, 0x00, 0x01, 0x00, 0x81, 0xB0, 0x80, 0x00, 0x01, 0x00, 0x80, 0x02, 0x6D, 0x00, 0x00, 0x01,
+    0x06, 0x01, 0x01, 0x00, 0xD0, 0xB6, 0x80, 0x00, 0x01, 0x00, 0xD0, 0xBC, 0x80, 0x00, 0x01, 0x02,
+    0x55, 0x00, 0xD1, 0x34, 0x6E, 0x00, 0x01, 0x00, 0xD0, 0xC2, 0x80, 0x00, 0x01, 0x00, 0xD1, 0xC8,
+    0x80, 0x00, 0x01, 0x00, 0xD0, 0xCE, 0x80, 0x00, 0x00, 0x01, 0x6F, 0x00, 0x01, 0x00, 0xD1, 0xD4,
+    0x80, 0x00, 0x00, 0x02, 0x87, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0x00, 0xD1, 0xDA, 0x80, 0x00,
+    0x00, 0x04, 0xF7, 0x00, 0x01, 0x00, 0xD1, 0xE0, 0x80, 0x00, 0x01, 0x00, 0xD0, 0xE6, 0x80, 0x00,
+    0x00, 0x02, 0xF5, 0x00, 0x01, 0x00, 0xD0, 0xEC, 0x80, 0x00, 0x01, 0x00, 0xD0, 0xF2, 0x80, 0x00,
+    0x01, 0x00, 0xD1, 0xF8, 0x80, 0x00, 0x01, 0x00, 0xD1, 0xFE, 0x80, 0x00, 0x01, 0x00, 0xD0, 0x04,
+    0x81, 0x00, 0x00, 0x02, 0xEC, 0x00, 0x00, 0x03, 0xC5, 0x00, 0x01, 0x00, 0xD0, 0x0E, 0x81, 0x00,
+    0x01, 0x00, 0xD0, 0x14, 0x81, 0x00, 0x01, 0x00, 0xD1, 0x1A, 0x81, 0x00, 0x01, 0x00, 0xD1, 0x20,
+    0x81, 0x00, 0x01, 0x00, 0xD1, 0x26, 0x81, 0x00, 0x01, 0x00, 0xD0, 0x2C, 0x81, 0x00, 0x00, 0x03,
+    0xDF, 0x00, 0x01, 0x00, 0xD0, 0x32, 0x81, 0x00, 0x00, 0x02, 0x97, 0x00, 0x01, 0x00, 0xD0, 0x38,
+    0x81, 0x00, 0x01, 0x00, 0xD1, 0x3E, 0x81, 0x00, 0x01, 0x00, 0xD0, 0x44, 0x81, 0x00, 0x01, 0x00,
+    0xD1, 0x4A, 0x81, 0x00, 0x01, 0x00, 0xD0, 0x50, 0x81, 0x00, 0x01, 0x00, 0xD1, 0x56, 0x81, 0x00,
+    0x01, 0x00, 0xD0, 0x5C, 0x81, 0x00, 0x01, 0x00, 0xD0, 0x62, 0x81, 0x00, 0x01, 0x00, 0xD0, 0x68,
+    0x81, 0x00, 0x01, 0x00, 0xD0, 0x72, 0x34, 0x00, 0x01, 0x00, 0xD0, 0x6E, 0x81, 0x00, 0x01, 0x00,
+    0xD0, 0x74, 0x81, 0x00, 0x01, 0x00, 0xD0, 0x7A, 0x81, 0x00, 0x01, 0x00, 0xD0, 0x80, 0x81, 0x00,
+    0x01, 0x00, 0xD0, 0x86, 0x81, 0x00, 0x01, 0x00, 0xD0, 0x8C, 0x81, 0x00, 0x01, 0x00, 0xD0, 0x92,
+    0x81, 0x00, 0x01, 0x00, 0xD0, 0x98, 0x81, 0x00, 0x01, 0x00, 0xD0, 0x9E, 0x81, 0x00, 0x01, 0x00,
+    0xD1, 0xA4, 0x81, 0x00, 0x01, 0x00, 0xD1, 0xAA, 0x81, 0x00, 0x01, 0x03, 0xCA, 0x00, 0xD0, 0xB4,
+    0x81, 0x00, 0x01, 0x00, 0xD0, 0xBA, 0x81, 0x00, 0x01, 0x00, 0xD0, 0xC0, 0x81, 0x00, 0x01, 0x00,
+    0xD1, 0xC6, 0x81, 0x00, 0x01, 0x00, 0xD0, 0xD0, 0x81, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x01, 0x00,
+    0xD1, 0xD6, 0x81, 0x00, 0x01, 0x00, 0xD0, 0xDC, 0x81, 0x00, 0x01, 0x00, 0xD0, 0xE2, 0x81, 0x00,
+    0x01, 0x00, 0xD1, 0xE8, 0x81, 0x00, 0x01, 0x00, 0xD0, 0xEE, 0x81, 0x00, 0x01, 0x00, 0xD1, 0xF4,
+    0x81, 0x00, 0x01, 0x00, 0xD0, 0xFA, 0x81, 0x00, 0x01, 0x00, 0xD1, 0x00, 0x82, 0x00, 0x01, 0x00,
+    0xD0, 0x06, 0x82, 0x00, 0x01, 0x00, 0xD1, 0x0C, 0x82, 0x00, 0x01, 0x00, 0xD0, 0x12, 0x82, 0x00,
+    0x01, 0x00, 0xD0, 0x18, 0x82, 0x00, 0x01, 0x00, 0xD1, 0x1E, 0x82, 0x00, 0x01, 0x00, 0xD1, 0x24,
+    0x82, 0x00, 0x01, 0x02, 0x48, 0x00, 0xD1, 0x2A, 0x82, 0x00, 0x01, 0x00, 0xD1, 0x30, 0x82, 0x00,
+    0x01, 0x00, 0xD0, 0x36, 0x82, 0x00, 0x01, 0x00, 0xD0, 0x3C, 0x82, 0x00, 0x01, 0x00, 0xD1, 0x42,
+    0x82, 0x00, 0x01, 0x00, 0xD1, 0x48, 0x82, 0x00, 0x01, 0x02, 0x48, 0x00, 0xD1, 0x52, 0x82, 0x00,
+    0x01, 0x00, 0xD1, 0x04, 0x63, 0x00, 0x01, 0x00, 0xD0, 0x58, 0x82, 0x00, 0x01, 0x00, 0xD1, 0x5E,
+    0x82, 0x00, 0x00, 0x02, 0xB7, 0x00, 0x01, 0x00, 0xD0, 0x64, 0x82, 0x00, 0x00, 0x04, 0x77, 0x00,
+    0x00, 0x03, 0xAD, 0x00, 0x00, 0x03, 0x8E, 0x00, 0x01, 0x00, 0xD1, 0x6A, 0x82, 0x00, 0x01, 0x00,
+    0xD0, 0x70, 0x82, 0x00, 0x01, 0x00, 0xD1, 0x76, 0x82, 0x00, 0x01, 0x00, 0xD0, 0x7C, 0x82, 0x00,
+    0x01, 0x00, 0xD1, 0x82, 0x82, 0x00, 0x01, 0x00, 0xD0, 0x88, 0x82, 0x00, 0x01, 0x00, 0xD0, 0x8E,
+    0x82, 0x00, 0x01, 0x00, 0xD0, 0x94, 0x82, 0x00, 0x00, 0x02, 0x72, 0x00, 0x00, 0x01, 0x6D, 0x00,
+    0x01, 0x00, 0xD0, 0x9A, 0x82, 0x00, 0x01, 0x00, 0xD1, 0xA0, 0x82, 0x00, 0x01, 0x00, 0xD0, 0xA6,
+    0x82, 0x00, 0x01, 0x00, 0xD0, 0xAC, 0x82, 0x00, 0x01, 0x00, 0xD0, 0xB2, 0x82, 0x00, 0x01, 0x00,
+    0xD0, 0xB8, 0x82, 0x00, 0x01, 0x00, 0xD0, 0xBE, 0x82, 0x00, 0x01, 0x00, 0x8E, 0xC4, 0x82, 0x00,
+    0x01, 0x00, 0xD0, 0xC8, 0x82, 0x00, 0x00, 0x02, 0x31, 0x00, 0x01, 0x00, 0xD0, 0xCE, 0x82, 0x00,
+    0x01, 0x00, 0xD1, 0xD4, 0x82, 0x00, 0x01, 0x00, 0xD0, 0xDA, 0x82, 0x00, 0x01, 0x00, 0xD1, 0xE0,
+    0x82, 0x00, 0x01, 0x00, 0xD0, 0xE6, 0x82, 0x00, 0x01, 0x00, 0xD1, 0xEC, 0x82, 0x00, 0x01, 0x00,
+    0xD0, 0xF2, 0x82, 0x00, 0x01, 0x00, 0xD0, 0xF8, 0x82, 0x00, 0x01, 0x00, 0xD0, 0xFE, 0x82, 0x00,
+    0x01, 0x00, 0xD1, 0x04, 0x83, 0x00, 0x01, 0x00, 0xBD, 0x62, 0x68, 0x00, 0x01, 0x00, 0xB0, 0x24,
+    0x38, 0x00, 0x01, 0x00, 0xB9, 0x0A, 0x83, 0x00, 0x01, 0x00, 0x96, 0x42, 0x7F, 0x00, 0x01, 0x00,
+    0xBE, 0x10, 0x83, 0x00, 0x01, 0x00, 0x96, 0x60, 0x58, 0x00, 0x01, 0x00, 0x80, 0x50, 0x7E, 0x00,
+    0x01, 0x00, 0x80, 0x14, 0x83, 0x00, 0x01, 0x00, 0xB9, 0x1A, 0x83, 0x00, 0x01, 0x00, 0xBA, 0x88,
+    0x77, 0x00, 0x01, 0x00, 0xBF, 0x20, 0x83, 0x00, 0x01, 0x00, 0x82, 0x14, 0x80, 0x00, 0x01, 0x00,
+    0x94, 0x24, 0x39, 0x00, 0x02, 0x00, 0xB6, 0xB7, 0x42, 0x7E, 0x00, 0x42, 0x7E, 0x00, 0x01, 0x00,
+    0xB4, 0x26, 0x83, 0x00, 0x01, 0x00, 0xB0, 0x2A, 0x83, 0x00, 0x01, 0x00, 0x82, 0x30, 0x83, 0x00,
+    0x01, 0x00, 0x82, 0x34, 0x83, 0x00, 0x01, 0x00, 0x96, 0x38, 0x83, 0x00, 0x01, 0x00, 0xB5, 0x3E,
+    0x83, 0x00, 0x01, 0x00, 0xB6, 0xB8, 0x7E, 0x00, 0x01, 0x00, 0xBE, 0x44, 0x83, 0x00, 0x01, 0x00,
+    0x82, 0xB8, 0x7E, 0x00, 0x01, 0x00, 0xB5, 0x4A, 0x83, 0x00, 0x01, 0x00, 0x81, 0xB8, 0x7E, 0x00,
+    0x01, 0x00, 0xBD, 0x50, 0x83, 0x00, 0x01, 0x00, 0x86, 0x24, 0x38, 0x00, 0x01, 0x00, 0xBA, 0x56,
+    0x83, 0x00, 0x01, 0x00, 0xB1, 0x5C, 0x83, 0x00, 0x01, 0x00, 0xBB, 0x62, 0x83, 0x00, 0x01, 0x00,
+    0xB8, 0x66, 0x83, 0x00, 0x01, 0x00, 0xB0, 0x6C, 0x83, 0x00, 0x01, 0x00, 0xB5, 0x72, 0x83, 0x00,
+    0x01, 0x00, 0xBC, 0x78, 0x83, 0x00, 0x01, 0x00, 0xB0, 0x7E, 0x83, 0x00, 0x01, 0x00, 0xB5, 0x84,
+    0x83, 0x00, 0x01, 0x00, 0xB3, 0x8A, 0x83, 0x00, 0x01, 0x00, 0xB0, 0x8E, 0x83, 0x00, 0x01, 0x00,
+    0xBC, 0x94, 0x83, 0x00, 0x01, 0x00, 0x96, 0x0C, 0x66, 0x00, 0x02, 0x00, 0x80, 0x82, 0x60, 0x58,
+    0x00, 0x60, 0x58, 0x00, 0x01, 0x00, 0xB5, 0x9A, 0x83, 0x00, 0x01, 0x00, 0xB7, 0x0C, 0x66, 0x00,
+    0x01, 0x00, 0xBD, 0xAC, 0x69, 0x00, 0x02, 0x00, 0x80, 0x82, 0x0C, 0x66, 0x00, 0x60, 0x58, 0x00,
+    0x01, 0x00, 0xB0, 0xA0, 0x83, 0x00, 0x01, 0x00, 0x8C, 0x38, 0x77, 0x00, 0x01, 0x00, 0xBC, 0x50,
+    0x75, 0x00, 0x01, 0x00, 0xB9, 0xD8, 0x69, 0x00, 0x01, 0x00, 0x96, 0xA6, 0x83, 0x00, 0x01, 0x00,
+    0xBB, 0xAC, 0x83, 0x00, 0x01, 0x00, 0x82, 0xB2, 0x83, 0x00, 0x01, 0x00, 0xBE, 0xB8, 0x83, 0x00,
+    0x01, 0x00, 0x82, 0xBE, 0x83, 0x00, 0x01, 0x00, 0xB2, 0x88, 0x77, 0x00, 0x01, 0x00, 0x87, 0xD8,
+    0x69, 0x00, 0x01, 0x00, 0xBB, 0xC4, 0x83, 0x00, 0x01, 0x00, 0xBE, 0xCA, 0x83, 0x00, 0x01, 0x00,
+    0x80, 0xD0, 0x83, 0x00, 0x01, 0x00, 0x80, 0x46, 0x7E, 0x00, 0x01, 0x00, 0x83, 0x86, 0x7E, 0x00,
+    0x01, 0x00, 0x82, 0xD6, 0x83, 0x00, 0x01, 0x00, 0xBE, 0xDC, 0x83, 0x00, 0x01, 0x00, 0xB2, 0xE2,
+    0x83, 0x00, 0x01, 0x00, 0x86, 0x80, 0x57, 0x00, 0x02, 0x00, 0x8F, 0x96, 0xE8, 0x83, 0x00, 0x46,
+    0x7E, 0x00, 0x01, 0x00, 0x96, 0x86, 0x7E, 0x00, 0x01, 0x00, 0xBE, 0xEE, 0x83, 0x00, 0x01, 0x00,
+    0x81, 0xF4, 0x83, 0x00, 0x01, 0x00, 0xB0, 0x2C, 0x78, 0x00, 0x01, 0x00, 0x81, 0x64, 0x7E, 0x00,
+    0x01, 0x00, 0xB8, 0x80, 0x78, 0x00, 0x01, 0x00, 0x80, 0x4A, 0x6C, 0x00, 0x01, 0x00, 0xBB, 0x4A,
+    0x6C, 0x00, 0x01, 0x00, 0x83, 0xFA, 0x83, 0x00, 0x01, 0x00, 0xBC, 0x4A, 0x6C, 0x00, 0x01, 0x00,
+    0xB9, 0x4A, 0x6C, 0x00, 0x01, 0x00, 0xB5, 0x00, 0x84, 0x00, 0x01, 0x00, 0xB5, 0xA0, 0x75, 0x00,
+    0x01, 0x00, 0x80, 0x04, 0x84, 0x00, 0x01, 0x00, 0xBD, 0x0A, 0x84, 0x00, 0x01, 0x00, 0xB9, 0x10,
+    0x84, 0x00, 0x01, 0x00, 0xB7, 0x26, 0x83, 0x00, 0x01, 0x00, 0xB5, 0x16, 0x84, 0x00, 0x01, 0x00,
+    0xB8, 0x1C, 0x84, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x01, 0x00, 0xB3, 0x22, 0x84, 0x00, 0x01, 0x00,
+    0xB3, 0x66, 0x5B, 0x00, 0x01, 0x00, 0x82, 0x66, 0x5B, 0x00, 0x01, 0x00, 0xB8, 0x28, 0x84, 0x00,
+    0x01, 0x00, 0x87, 0x02, 0x6D, 0x00, 0x01, 0x00, 0xB1, 0x02, 0x6D, 0x00, 0x01, 0x00, 0x82, 0x02,
+    0x6D, 0x00, 0x01, 0x00, 0xB0, 0x02, 0x6D, 0x00, 0x01, 0x00, 0xBA, 0x02, 0x6D, 0x00, 0x01, 0x00,
+    0xBE, 0x46, 0x5B, 0x00, 0x01, 0x00, 0x96, 0x02, 0x6D, 0x00, 0x01, 0x00, 0xD1, 0x2E, 0x84, 0x00,
+    0x00, 0x01, 0xFB, 0x00, 0x01, 0x00, 0xD1, 0x34, 0x84, 0x00, 0x01, 0x00, 0xD1, 0x3A, 0x84, 0x00,
+    0x01, 0x00, 0xD0, 0x40, 0x84, 0x00, 0x00, 0x03, 0x57, 0x00, 0x01, 0x00, 0xD0, 0x46, 0x84, 0x00,
+    0x00, 0x03, 0xE9, 0x00, 0x00, 0x02, 0x4C, 0x00, 0x01, 0x00, 0xD1, 0x4C, 0x84, 0x00, 0x01, 0x00,
+    0xD0, 0x52, 0x84, 0x00, 0x01, 0x00, 0xD0, 0x58, 0x84, 0x00, 0x01, 0x00, 0xD1, 0x5E, 0x84, 0x00,
+    0x01, 0x00, 0xD1, 0x64, 0x84, 0x00, 0x01, 0x00, 0xD0, 0x6A, 0x84, 0x00, 0x01, 0x00, 0xD0, 0x70,
+    0x84, 0x00, 0x00, 0x02, 0x00, 0x01, 0x01, 0x00, 0xD1, 0x52, 0x2E, 0x00, 0x01, 0x00, 0xD0, 0x76,
+    0x84, 0x00, 0x01, 0x00, 0xD0, 0x7C, 0x84, 0x00, 0x01, 0x00, 0xD0, 0x82, 0x84, 0x00, 0x01, 0x00,
+    0xD1, 0x88, 0x84, 0x00, 0x01, 0x00, 0xD1, 0x8E, 0x84, 0x00, 0x00, 0x02, 0xD9, 0x00, 0x01, 0x00,
+    0xD1, 0x94, 0x84, 0x00, 0x01, 0x00, 0xD0, 0x9A, 0x84, 0x00, 0x01, 0x00, 0xD0, 0xA0, 0x84, 0x00,
+    0x01, 0x00, 0xD1, 0xA6, 0x84, 0x00, 0x01, 0x00, 0xD0, 0xAC, 0x84, 0x00, 0x01, 0x00, 0xD0, 0xB2,
+    0x84, 0x00, 0x01, 0x00, 0xD0, 0xB8, 0x84, 0x00, 0x01, 0x00, 0xD0, 0xBE, 0x84, 0x00, 0x01, 0x00,
+    0xD0, 0xC4, 0x84, 0x00, 0x01, 0x00, 0xD1, 0xCA, 0x84, 0x00, 0x01, 0x00, 0xD0, 0xD0, 0x84, 0x00,
+    0x01, 0x00, 0xD1, 0xD6, 0x84, 0x00, 0x01, 0x00, 0xD1, 0xDC, 0x84, 0x00, 0x01, 0x00, 0xD0, 0xE2,
+    0x84, 0x00, 0x01, 0x00, 0xD0, 0xE8, 0x84, 0x00, 0x01, 0x00, 0xD0, 0xEE, 0x84, 0x00, 0x01, 0x00,
+    0xD1, 0xF4, 0x84, 0x00, 0x01, 0x00, 0xD1, 0xFA, 0x84, 0x00, 0x01, 0x00, 0xD0, 0x00, 0x85, 0x00,
+    0x00, 0x03, 0x74, 0x00, 0x01, 0x00, 0xD0, 0x06, 0x85, 0x00, 0x01, 0x00, 0xD0, 0x0C, 0x85, 0x00,
+    0x01, 0x00, 0xD1, 0x12, 0x85, 0x00, 0x01, 0x00, 0xD1, 0x18, 0x85, 0x00, 0x01, 0x00, 0xD0, 0x1E,
+    0x85, 0x00, 0x01, 0x00, 0xD0, 0x24, 0x85, 0x00, 0x01, 0x00, 0xD1, 0x2A, 0x85, 0x00, 0x01, 0x00,
+    0x81, 0x7E, 0x83, 0x00, 0x01, 0x00, 0x82, 0x8A, 0x83, 0x00, 0x01, 0x00, 0x81, 0x30, 0x85, 0x00,
+    0x01, 0x00, 0xB5, 0x14, 0x80, 0x00, 0x01, 0x00, 0xB7, 0x50, 0x75, 0x00, 0x01, 0x00, 0x81, 0x36,
+    0x85, 0x00, 0x01, 0x00, 0xB9, 0x3C, 0x85, 0x00, 0x01, 0x00, 0xB2, 0xB8, 0x7E, 0x00, 0x01, 0x00,
+    0x80, 0x42, 0x85, 0x00, 0x01, 0x00, 0x81, 0x48, 0x85, 0x00, 0x01, 0x00, 0xB0, 0x4A, 0x85, 0x00,
+    0x01, 0x00, 0xB5, 0x50, 0x85, 0x00, 0x01, 0x00, 0xBD, 0x4A, 0x6C, 0x00, 0x01, 0x00, 0xB9, 0x56,
+    0x85, 0x00, 0x01, 0x00, 0xB5, 0x5C, 0x85, 0x00, 0x01, 0x00, 0x82, 0x4A, 0x6C, 0x00, 0x01, 0x00,
+    0x80, 0x62, 0x85, 0x00, 0x01, 0x00, 0x80, 0x34, 0x83, 0x00, 0x01, 0x00, 0xB5, 0x68, 0x85, 0x00,
+    0x01, 0x00, 0xB6, 0x24, 0x38, 0x00, 0x01, 0x00, 0x80, 0x36, 0x85, 0x00, 0x01, 0x00, 0xB4, 0x6E,
+    0x85, 0x00, 0x01, 0x00, 0xB0, 0x34, 0x83, 0x00, 0x01, 0x00, 0xB0, 0x72, 0x85, 0x00, 0x01, 0x00,
+    0xB2, 0x6E, 0x85, 0x00, 0x01, 0x00, 0xBE, 0x8E, 0x83, 0x00, 0x01, 0x00, 0x96, 0x2A, 0x83, 0x00,
+    0x01, 0x00, 0xBD, 0x1C, 0x75, 0x00, 0x01, 0x00, 0x96, 0x50, 0x75, 0x00, 0x01, 0x00, 0x80, 0x78,
+    0x85, 0x00, 0x01, 0x00, 0xBF, 0x7E, 0x85, 0x00, 0x01, 0x00, 0xB0, 0x84, 0x85, 0x00, 0x01, 0x00,
+    0xBD, 0x86, 0x7E, 0x00, 0x01, 0x00, 0x80, 0x50, 0x75, 0x00, 0x01, 0x00, 0x82, 0x46, 0x7E, 0x00,
+    0x01, 0x00, 0xB1, 0x4A, 0x6C, 0x00, 0x01, 0x00, 0xB0, 0x8A, 0x85, 0x00, 0x01, 0x00, 0xBA, 0x90,
+    0x85, 0x00, 0x01, 0x00, 0x81, 0x94, 0x85, 0x00, 0x01, 0x00, 0x80, 0x9A, 0x85, 0x00, 0x01, 0x00,
+    0xB2, 0x34, 0x83, 0x00, 0x01, 0x00, 0xB5, 0xA0, 0x85, 0x00, 0x01, 0x00, 0x82, 0xA6, 0x85, 0x00,
+    0x01, 0x00, 0xD1, 0xAA, 0x85, 0x00, 0x01, 0x00, 0xD1, 0xB0, 0x85, 0x00, 0x01, 0x00, 0xD1, 0xB6,
+    0x85, 0x00, 0x01, 0x00, 0xD0, 0xBC, 0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0xD0, 0xC2, 0x85, 0x00,
+    0x01, 0x00, 0xD1, 0xC8, 0x85, 0x00, 0x01, 0x00, 0xD1, 0xCE, 0x85, 0x00, 0x01, 0x00, 0xD0, 0xD4,
+    0x85, 0x00, 0x01, 0x00, 0xD0, 0xDA, 0x85, 0x00, 0x01, 0x00, 0xD0, 0xE0, 0x85, 0x00, 0x00, 0x02,
+    0xBC, 0x00, 0x01, 0x00, 0xD0, 0xE6, 0x85, 0x00, 0x01, 0x00, 0xD0, 0xEC, 0x85, 0x00, 0x01, 0x00,
+    0xD0, 0xF2, 0x85, 0x00, 0x01, 0x00, 0xD1, 0xF8, 0x85, 0x00, 0x01, 0x00, 0xD0, 0xFE, 0x85, 0x00,
+    0x00, 0x03, 0x9E, 0x00, 0x01, 0x00, 0xD1, 0x04, 0x86, 0x00, 0x01, 0x00, 0xD0, 0x0A, 0x86, 0x00,
+    0x01, 0x00, 0xD0, 0x10, 0x86, 0x00, 0x00, 0x03, 0x2B, 0x00, 0x01, 0x00, 0x82, 0x16, 0x86, 0x00,
+    0x01, 0x00, 0x96, 0x34, 0x83, 0x00, 0x01, 0x00, 0x81, 0x1A, 0x86, 0x00, 0x01, 0x00, 0xB2, 0x80,
+    0x57, 0x00, 0x01, 0x00, 0xB7, 0x20, 0x86, 0x00, 0x01, 0x00, 0x80, 0x24, 0x86, 0x00, 0x01, 0x00,
+    0x81, 0x2E, 0x86, 0x00, 0x01, 0x00, 0xB9, 0x34, 0x86, 0x00, 0x01, 0x00, 0xB3, 0x60, 0x58, 0x00,
+    0x01, 0x00, 0xB9, 0x3A, 0x86, 0x00, 0x01, 0x00, 0xBD, 0x40, 0x86, 0x00, 0x01, 0x00, 0xB0, 0x46,
+    0x7E, 0x00, 0x01, 0x00, 0xB0, 0x46, 0x86, 0x00, 0x01, 0x00, 0x82, 0x4C, 0x86, 0x00, 0x01, 0x00,
+    0xB7, 0x34, 0x83, 0x00, 0x01, 0x00, 0x82, 0x50, 0x86, 0x00, 0x01, 0x00, 0xB3, 0xDC, 0x6B, 0x00,
+    0x01, 0x00, 0xBD, 0x00, 0x75, 0x00, 0x00, 0x03, 0xF2, 0x00, 0x01, 0x00, 0xD1, 0x54, 0x86, 0x00,
+    0x00, 0x02, 0xE2, 0x00, 0x02, 0x00, 0xD0, 0xD1, 0x5A, 0x86, 0x00, 0x60, 0x86, 0x00, 0x01, 0x00,
+    0xD1, 0x66, 0x86, 0x00, 0x01, 0x00, 0xD1, 0x6C, 0x86, 0x00, 0x01, 0x00, 0xD1, 0x72, 0x86, 0x00,
+    0x01, 0x00, 0xD0, 0x78, 0x86, 0x00, 0x01, 0x00, 0xD1, 0x7E, 0x86, 0x00, 0x00, 0x02, 0xC3, 0x00,
+    0x00, 0x04, 0x5D, 0x00, 0x01, 0x00, 0x82, 0x00, 0x75, 0x00, 0x01, 0x00, 0xB5, 0x84, 0x86, 0x00,
+    0x01, 0x00, 0x96, 0x8A, 0x86, 0x00, 0x01, 0x00, 0x82, 0x90, 0x86, 0x00, 0x01, 0x00, 0x81, 0x94,
+    0x86, 0x00, 0x01, 0x00, 0x81, 0x9A, 0x86, 0x00, 0x01, 0x00, 0xBD, 0x34, 0x83, 0x00, 0x01, 0x00,
+    0x83, 0xA0, 0x86, 0x00, 0x01, 0x00, 0xD0, 0xA6, 0x86, 0x00, 0x01, 0x00, 0xD0, 0xAC, 0x86, 0x00,
+    0x00, 0x02, 0xD3, 0x00, 0x01, 0x00, 0xD1, 0xB2, 0x86, 0x00, 0x01, 0x00, 0xD1, 0xB8, 0x86, 0x00,
+    0x01, 0x00, 0xD0, 0xBE, 0x86, 0x00, 0x01, 0x00, 0xB6, 0xC4, 0x86, 0x00, 0x01, 0x00, 0xB3, 0xC4,
+    0x86, 0x00, 0x01, 0x00, 0x82, 0x38, 0x80, 0x00, 0x01, 0x00, 0x82, 0xC8, 0x86, 0x00, 0x01, 0x00,
+    0xB7, 0x46, 0x7E, 0x00, 0x00, 0x02, 0x02, 0x01, 0x00, 0x03, 0xD6, 0x00,
+};
+
+constexpr uint8_t uk_trie_levels[] = {
+    0x08, 0x17, 0x28, 0x38, 0x28, 0x48, 0x38, 0x48, 0x38, 0x58, 0x28, 0x38, 0x48, 0x54, 0x94, 0xB3,
+    0x94, 0xC3, 0x56, 0x56, 0x76, 0x74, 0x93, 0x56, 0x66, 0x54, 0x73, 0x54, 0x83, 0x73, 0x94, 0x55,
+    0x74, 0x74, 0x53, 0x74, 0x95, 0xB4, 0x93, 0x93, 0xB4, 0x83, 0x75, 0x74, 0x93, 0xB4, 0x55, 0xB4,
+    0xD3, 0x75, 0x94, 0x55, 0x74, 0x93, 0x73, 0xB4, 0xD3, 0x94, 0x06, 0x08, 0x18, 0x34, 0x08, 0x28,
+    0x03, 0x02, 0x21, 0x26, 0x06, 0x26, 0x03, 0x24, 0x64, 0x83, 0x84, 0xA3, 0xA3, 0xC4, 0x63, 0x23,
+    0x44, 0x64, 0x84, 0xA3, 0x84, 0x44, 0x63, 0x64, 0x83, 0xA4, 0x06, 0x26, 0x46, 0x44, 0x64, 0x84,
+    0xA3, 0x03, 0x24, 0x44, 0x02, 0x41, 0x44, 0x44, 0x63, 0xA4, 0xC3, 0x43, 0x74, 0x85, 0x64, 0xC4,
+    0x83, 0xA4, 0xC4, 0xE3, 0x84, 0xA4, 0xC3, 0x64, 0x83, 0xC4, 0xE3, 0x02, 0x33, 0x85, 0xA4, 0x43,
+    0x64, 0x63, 0x84, 0x44, 0x75, 0x44, 0x65, 0x65, 0x84, 0x45, 0x64, 0x46, 0x65, 0x84, 0x45, 0x64,
+    0x85, 0x65, 0x44, 0x65, 0x84, 0x23, 0x22, 0x64, 0x85, 0x03, 0x24, 0x43, 0x24, 0x44, 0x63, 0x84,
+    0xA4, 0x23, 0x54, 0x24, 0x43, 0x64, 0xA4, 0xC3, 0xA3, 0xD4, 0x24, 0x03, 0x26, 0x65, 0x84, 0xA4,
+    0xA4, 0x83, 0xB4, 0x63, 0x94, 0x64, 0x84, 0x64, 0xC3, 0x44, 0x63, 0x84, 0xA5, 0xC4, 0x84, 0xA5,
+    0x44, 0x64, 0x83, 0x44, 0x64, 0x44, 0x64, 0x85, 0x24, 0x45, 0x44, 0x67, 0x84, 0x44, 0x73, 0x84,
+    0xB3, 0x03, 0x34, 0x84, 0xC3, 0x45, 0xA4, 0xC4, 0xE3, 0x64, 0xA3, 0x46, 0x44, 0xA4, 0xC3, 0x64,
+    0x85, 0xA4, 0xC5, 0xE4, 0x24, 0x63, 0x84, 0x04, 0x27, 0x44, 0x65, 0xA5, 0x42, 0x83, 0x45, 0x64,
+    0x84, 0x67, 0x44, 0x84, 0xA3, 0x04, 0x23, 0x44, 0x64, 0x83, 0xA4, 0xE4, 0x53, 0x44, 0xC4, 0x73,
+    0x67, 0x84, 0xC3, 0xE4, 0x42, 0x61, 0xA5,
+};
+
+constexpr DenseHyphenationTrie uk_dense_trie = {
+    uk_trie_classes, 40u, uk_trie_dense, uk_trie_nodes, sizeof(uk_trie_nodes),
+    uk_trie_levels, sizeof(uk_trie_levels),
 };
 
 constexpr SerializedHyphenationPatterns uk_patterns = {
-    0x5329u,
-    uk_trie_data,
-    sizeof(uk_trie_data),
+    0u,
+    nullptr,
+    0,
+    &uk_dense_trie,
 };
@@ -7,24 +7,20 @@
 #include <memory>
 #include <vector>
 
-#include "../FootnoteEntry.h"
-#include "../ParsedText.h"
-#include "../blocks/ImageBlock.h"
-#include "../blocks/TextBlock.h"
+#include "../ParsedContent.h"
 #include "../css/CssParser.h"
 #include "../css/CssStyle.h"
 
-class Page;
-class GfxRenderer;
 class Epub;
 
 #define MAX_WORD_SIZE 200
 
+// Parses a chapter's XHTML and resolves its CSS into a layout-independent parsed content stream.
+// Line breaking and pagination happen later in PageLayoutBuilder.
 class ChapterHtmlSlimParser {
   std::shared_ptr<Epub> epub;
   const std::string& filepath;
-  GfxRenderer& renderer;
-  std::function<void(std::unique_ptr<Page>)> completePageFn;
+  ParsedContentWriter& writer;
   std::function<void()> popupFn;  // Popup callback
   int depth = 0;
   int skipUntilDepth = INT_MAX;
@@ -36,16 +32,6 @@ class ChapterHtmlSlimParser {
   char partWordBuffer[MAX_WORD_SIZE + 1] = {};
   int partWordBufferIndex = 0;
   bool nextWordContinues = false;  // true when next flushed word attaches to previous (inline element boundary)
-  std::unique_ptr<ParsedText> currentTextBlock = nullptr;
-  std::unique_ptr<Page> currentPage = nullptr;
-  int16_t currentPageNextY = 0;
-  int fontId;
-  float lineCompression;
-  bool extraParagraphSpacing;
-  uint8_t paragraphAlignment;
-  uint16_t viewportWidth;
-  uint16_t viewportHeight;
-  bool hyphenationEnabled;
   const CssParser* cssParser;
   bool embeddedStyle;
   std::string contentBase;
@@ -74,13 +60,11 @@ class ChapterHtmlSlimParser {
   char currentFootnoteLinkText[24] = {};
   int currentFootnoteLinkTextLen = 0;
   char currentFootnoteLinkHref[64] = {};
-  std::vector<std::pair<int, FootnoteEntry>> pendingFootnotes;  // <wordIndex, entry>
-  int wordsExtractedInBlock = 0;
 
   void updateEffectiveInlineStyle();
-  void startNewTextBlock(const BlockStyle& blockStyle);
+  void startNewTextBlock(ParsedBlockKind kind, const CssStyle& cssStyle = CssStyle());
   void flushPartWordBuffer();
-  void makePages();
+  void addAnchor(const char* id);
   // XML callbacks
   static void XMLCALL startElement(void* userData, const XML_Char* name, const XML_Char** atts);
   static void XMLCALL characterData(void* userData, const XML_Char* s, int len);
@@ -88,26 +72,14 @@ class ChapterHtmlSlimParser {
   static void XMLCALL endElement(void* userData, const XML_Char* name);
 
  public:
-  explicit ChapterHtmlSlimParser(std::shared_ptr<Epub> epub, const std::string& filepath, GfxRenderer& renderer,
-                                 const int fontId, const float lineCompression, const bool extraParagraphSpacing,
-                                 const uint8_t paragraphAlignment, const uint16_t viewportWidth,
-                                 const uint16_t viewportHeight, const bool hyphenationEnabled,
-                                 const std::function<void(std::unique_ptr<Page>)>& completePageFn,
+  explicit ChapterHtmlSlimParser(std::shared_ptr<Epub> epub, const std::string& filepath, ParsedContentWriter& writer,
                                  const bool embeddedStyle, const std::string& contentBase,
                                  const std::string& imageBasePath, const std::function<void()>& popupFn = nullptr,
                                  const CssParser* cssParser = nullptr)
 
       : epub(epub),
         filepath(filepath),
-        renderer(renderer),
-        fontId(fontId),
-        lineCompression(lineCompression),
-        extraParagraphSpacing(extraParagraphSpacing),
-        paragraphAlignment(paragraphAlignment),
-        viewportWidth(viewportWidth),
-        viewportHeight(viewportHeight),
-        hyphenationEnabled(hyphenationEnabled),
-        completePageFn(completePageFn),
+        writer(writer),
         popupFn(popupFn),
         cssParser(cssParser),
         embeddedStyle(embeddedStyle),
@@ -115,6 +87,6 @@ class ChapterHtmlSlimParser {
         imageBasePath(imageBasePath) {}
 
   ~ChapterHtmlSlimParser() = default;
-  bool parseAndBuildPages();
-  void addLineToPage(std::shared_ptr<TextBlock> line);
+  // Parse the chapter and write its records, ending with ParsedContentTag::End on success
+  bool parse();
 };
@@ -1,4 +1,5 @@
 #pragma once
+#include <Fnv1a.h>
 #include <Print.h>
 
 #include <algorithm>
@@ -42,15 +43,7 @@ class ContentOpfParser final : public Print {
 
   static constexpr uint16_t LARGE_SPINE_THRESHOLD = 400;
 
-  // FNV-1a hash function
-  static uint32_t fnvHash(const std::string& s) {
-    uint32_t hash = 2166136261u;
-    for (char c : s) {
-      hash ^= static_cast<uint8_t>(c);
-      hash *= 16777619u;
-    }
-    return hash;
-  }
+  static uint32_t fnvHash(const std::string& s) { return fnv1a32(s); }
 
   static void startElement(void* userData, const XML_Char* name, const XML_Char** atts);
   static void characterData(void* userData, const XML_Char* s, int len);
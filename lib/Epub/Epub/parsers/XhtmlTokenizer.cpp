@@ -0,0 +1,574 @@
+#include "XhtmlTokenizer.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+
+#include "../htmlEntities.h"
+
+namespace {
+using Token = XhtmlTokenizer::Token;
+
+// Returned by the read functions when they consumed input without producing a token
+constexpr auto CONTINUE = static_cast<Token>(0xFF);
+constexpr size_t MAX_ENTITY_LENGTH = 32;
+
+const char* VOID_ELEMENTS[] = {"area",  "base", "br",   "col",   "embed",  "hr",    "img",
+                               "input", "link", "meta", "param", "source", "track", "wbr"};
+
+bool isSpace(const char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+
+bool isNameStart(const char c) {
+  const auto u = static_cast<unsigned char>(c);
+  return std::isalpha(u) || c == '_' || c == ':' || u >= 0x80;
+}
+
+bool isVoidElement(const char* name) {
+  for (const char* element : VOID_ELEMENTS) {
+    if (strcmp(name, element) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+size_t encodeUtf8(uint32_t cp, char* out) {
+  if (cp == 0 || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+    cp = 0xFFFD;
+  }
+  if (cp < 0x80) {
+    out[0] = static_cast<char>(cp);
+    return 1;
+  }
+  if (cp < 0x800) {
+    out[0] = static_cast<char>(0xC0 | cp >> 6);
+    out[1] = static_cast<char>(0x80 | (cp & 0x3F));
+    return 2;
+  }
+  if (cp < 0x10000) {
+    out[0] = static_cast<char>(0xE0 | cp >> 12);
+    out[1] = static_cast<char>(0x80 | (cp >> 6 & 0x3F));
+    out[2] = static_cast<char>(0x80 | (cp & 0x3F));
+    return 3;
+  }
+  out[0] = static_cast<char>(0xF0 | cp >> 18);
+  out[1] = static_cast<char>(0x80 | (cp >> 12 & 0x3F));
+  out[2] = static_cast<char>(0x80 | (cp >> 6 & 0x3F));
+  out[3] = static_cast<char>(0x80 | (cp & 0x3F));
+  return 4;
+}
+
+// Bytes at the end of [start, limit) that begin a UTF-8 sequence the next chunk completes
+size_t incompleteUtf8Tail(const char* start, const char* limit) {
+  for (size_t k = 1; k <= 3 && limit - k >= start; k++) {
+    const auto c = static_cast<unsigned char>(limit[-static_cast<ptrdiff_t>(k)]);
+    if ((c & 0xC0) == 0x80) {
+      continue;
+    }
+    const size_t length = c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : c >= 0xC0 ? 2 : 1;
+    return length > k ? k : 0;
+  }
+  return 0;
+}
+
+// Decodes the entity at `in` (which starts with '&'), writing its UTF-8 to `out`, which may overlap `in` as no value
+// is longer than its entity. Returns the bytes read from `in`: 0 when input ending at `limit` cuts it off and `more`
+// follows, or 1 with a literal '&' written when it isn't an entity this knows.
+size_t decodeEntity(const char* in, const char* limit, const bool more, char* out, size_t* written) {
+  const char* p = in + 1;
+  while (p < limit && p < in + MAX_ENTITY_LENGTH && (std::isalnum(static_cast<unsigned char>(*p)) || *p == '#')) {
+    p++;
+  }
+  if (p == limit && more && p < in + MAX_ENTITY_LENGTH) {
+    return 0;
+  }
+  if (p == limit || *p != ';' || p == in + 1) {
+    *out = '&';
+    *written = 1;
+    return 1;
+  }
+
+  const size_t length = p - in + 1;
+  if (in[1] == '#') {
+    const bool hex = in[2] == 'x' || in[2] == 'X';
+    const char* digits = in + (hex ? 3 : 2);
+    uint32_t cp = 0;
+    for (const char* d = digits; d < p; d++) {
+      const auto c = static_cast<unsigned char>(*d);
+      const int value = std::isdigit(c) ? c - '0' : hex && std::isxdigit(c) ? (std::tolower(c) - 'a' + 10) : -1;
+      if (value < 0) {
+        cp = UINT32_MAX;
+        break;
+      }
+      cp = cp > 0x10FFFF ? cp : cp * (hex ? 16 : 10) + value;
+    }
+    if (digits == p || cp == UINT32_MAX) {
+      *out = '&';
+      *written = 1;
+      return 1;
+    }
+    *written = encodeUtf8(cp, out);
+    return length;
+  }
+
+  // &apos; is predefined in XML but not an HTML 4 entity
+  const char* value = length == 6 && memcmp(in, "&apos;", 6) == 0 ? "'" : lookupHtmlEntity(in, length);
+  if (!value) {
+    *out = '&';
+    *written = 1;
+    return 1;
+  }
+  const size_t valueLength = strlen(value);
+  memcpy(out, value, valueLength);
+  *written = valueLength;
+  return length;
+}
+
+// Decodes an attribute value in place, turning line breaks and tabs into spaces as XML does, and null-terminates it
+void decodeValue(char* value, const char* valueEnd) {
+  const char* r = value;
+  char* w = value;
+  while (r < valueEnd) {
+    if (*r == '&') {
+      size_t written;
+      r += decodeEntity(r, valueEnd, false, w, &written);
+      w += written;
+      continue;
+    }
+    if (r[0] == '\r' && r + 1 < valueEnd && r[1] == '\n') {
+      r++;
+    }
+    *w++ = isSpace(*r) ? ' ' : *r;
+    r++;
+  }
+  *w = '\0';
+}
+}  // namespace
+
+XhtmlTokenizer::~XhtmlTokenizer() { free(buffer); }
+
+char* XhtmlTokenizer::getBuffer(const size_t len) {
+  if (begin > 0) {
+    memmove(buffer, buffer + begin, end - begin);
+    end -= begin;
+    begin = 0;
+  }
+  if (capacity - end < len) {
+    const size_t grownCapacity = end + len > capacity + capacity / 2 ? end + len : capacity + capacity / 2;
+    auto* grown = static_cast<char*>(realloc(buffer, grownCapacity));
+    if (!grown) {
+      failed = true;
+      return nullptr;
+    }
+    buffer = grown;
+    capacity = grownCapacity;
+  }
+  return buffer + end;
+}
+
+void XhtmlTokenizer::commit(const size_t len, const bool isFinal) {
+  end += len;
+  final = isFinal;
+}
+
+XhtmlTokenizer::Token XhtmlTokenizer::next() {
+  if (failed) {
+    return Token::Error;
+  }
+  if (pendingEnd) {
+    pendingEnd = false;
+    return Token::EndTag;
+  }
+  if (closeToDepth >= 0) {
+    if (depth + overflowDepth > closeToDepth) {
+      return popElement();
+    }
+    closeToDepth = -1;
+  }
+
+  while (true) {
+    Token token = CONTINUE;
+    switch (state) {
+      case State::Content:
+        if (begin == end) {
+          if (!final) {
+            return Token::NeedInput;
+          }
+          // Close whatever is still open
+          if (depth + overflowDepth > 0) {
+            closeToDepth = 0;
+            return popElement();
+          }
+          return Token::End;
+        }
+        token = buffer[begin] == '<' ? readTag() : readText();
+        break;
+      case State::Comment:
+        token = skipUntil("-->") ? CONTINUE : Token::NeedInput;
+        break;
+      case State::Instruction:
+        token = skipUntil("?>") ? CONTINUE : Token::NeedInput;
+        break;
+      case State::SkipTag:
+        token = skipUntil(">") ? CONTINUE : Token::NeedInput;
+        break;
+      case State::Declaration:
+        token = skipDeclaration() ? CONTINUE : Token::NeedInput;
+        break;
+      case State::Cdata:
+        token = readCdata();
+        break;
+    }
+    if (token != CONTINUE) {
+      return token;
+    }
+  }
+}
+
+XhtmlTokenizer::Token XhtmlTokenizer::needInput() {
+  if (final) {
+    // Input ended inside a token; drop it
+    begin = end;
+    return CONTINUE;
+  }
+  return Token::NeedInput;
+}
+
+XhtmlTokenizer::Token XhtmlTokenizer::readText() {
+  char* const start = buffer + begin;
+  const char* limit = buffer + end;
+  if (!final) {
+    limit -= incompleteUtf8Tail(start, limit);
+  }
+
+  const char* r = start;
+  char* w = start;
+  while (r < limit && *r != '<') {
+    if (*r == '&') {
+      size_t written;
+      const size_t used = decodeEntity(r, limit, !final, w, &written);
+      if (used == 0) {
+        break;
+      }
+      r += used;
+      w += written;
+    } else if (*r == '\r') {
+      // Line ends become "\n" as in XML; a "\r" at the end of the chunk waits for the "\n" that may follow
+      if (r + 1 == limit && !final) {
+        break;
+      }
+      *w++ = '\n';
+      r += r + 1 < limit && r[1] == '\n' ? 2 : 1;
+    } else {
+      *w++ = *r++;
+    }
+  }
+  begin = r - buffer;
+
+  if (w == start) {
+    return needInput();
+  }
+  // Text outside the root element isn't content
+  if (depth + overflowDepth == 0) {
+    return CONTINUE;
+  }
+  tokenText = start;
+  tokenTextLength = w - start;
+  return Token::Text;
+}
+
+XhtmlTokenizer::Token XhtmlTokenizer::readCdata() {
+  char* const start = buffer + begin;
+  const char* limit = buffer + end;
+  const char* stop = nullptr;
+  for (const char* p = start; p + 3 <= limit; p++) {
+    if (p[0] == ']' && p[1] == ']' && p[2] == '>') {
+      stop = p;
+      break;
+    }
+  }
+
+  if (stop) {
+    begin = stop + 3 - buffer;
+    state = State::Content;
+    limit = stop;
+  } else if (final) {
+    begin = end;
+    state = State::Content;
+  } else {
+    // The last two bytes may start the "]]>", and a "\r" may be followed by "\n"
+    limit = limit - start > 2 ? limit - 2 : start;
+    limit -= incompleteUtf8Tail(start, limit);
+    if (limit > start && limit[-1] == '\r') {
+      limit--;
+    }
+    if (limit == start) {
+      return Token::NeedInput;
+    }
+    begin = limit - buffer;
+  }
+
+  // Line ends become "\n" as in text
+  char* w = start;
+  for (const char* r = start; r < limit; r++) {
+    if (*r == '\r') {
+      *w++ = '\n';
+      if (r + 1 < limit && r[1] == '\n') {
+        r++;
+      }
+    } else {
+      *w++ = *r;
+    }
+  }
+  if (w == start || depth + overflowDepth == 0) {
+    return CONTINUE;
+  }
+  tokenText = start;
+  tokenTextLength = w - start;
+  return Token::Text;
+}
+
+XhtmlTokenizer::Token XhtmlTokenizer::readTag() {
+  const char* start = buffer + begin;
+  const size_t available = end - begin;
+
+  if (available < 2) {
+    if (!final) {
+      return Token::NeedInput;
+    }
+  } else if (start[1] == '!') {
+    if (available < 9 && !final) {
+      return Token::NeedInput;
+    }
+    if (available >= 4 && memcmp(start, "<!--", 4) == 0) {
+      begin += 4;
+      state = State::Comment;
+    } else if (available >= 9 && memcmp(start, "<![CDATA[", 9) == 0) {
+      begin += 9;
+      state = State::Cdata;
+    } else {
+      begin += 2;
+      declarationBrackets = 0;
+      declarationQuote = 0;
+      state = State::Declaration;
+    }
+    return CONTINUE;
+  } else if (start[1] == '?') {
+    begin += 2;
+    state = State::Instruction;
+    return CONTINUE;
+  } else if (start[1] == '/' || isNameStart(start[1])) {
+    // Find the '>' closing the tag; quotes only open a value right after '='
+    char quote = 0;
+    char previous = 0;
+    size_t close = begin + 1;
+    for (; close < end; close++) {
+      const char c = buffer[close];
+      if (quote) {
+        if (c == quote) {
+          quote = 0;
+        }
+      } else if ((c == '"' || c == '\'') && previous == '=') {
+        quote = c;
+      } else if (c == '>') {
+        break;
+      }
+      if (!isSpace(c)) {
+        previous = c;
+      }
+    }
+    if (close == end) {
+      if (!final && available >= MAX_TOKEN_SIZE) {
+        state = State::SkipTag;
+        return CONTINUE;
+      }
+      return needInput();
+    }
+    return start[1] == '/' ? readEndTag(close) : readStartTag(close);
+  }
+
+  // A '<' that starts no tag is text
+  tokenText = start;
+  tokenTextLength = 1;
+  begin++;
+  return Token::Text;
+}
+
+XhtmlTokenizer::Token XhtmlTokenizer::readStartTag(const size_t close) {
+  char* const name = buffer + begin + 1;
+  char* const tagEnd = buffer + close;
+  const bool selfClosing = tagEnd[-1] == '/';
+
+  char* p = name;
+  while (p < tagEnd && !isSpace(*p) && *p != '/') {
+    p++;
+  }
+  char* const nameEnd = p;
+
+  int count = 0;
+  while (true) {
+    while (p < tagEnd && (isSpace(*p) || *p == '/')) {
+      p++;
+    }
+    if (p >= tagEnd) {
+      break;
+    }
+
+    char* const attributeName = p;
+    while (p < tagEnd && !isSpace(*p) && *p != '=' && *p != '/') {
+      p++;
+    }
+    char* const attributeNameEnd = p;
+    while (p < tagEnd && isSpace(*p)) {
+      p++;
+    }
+
+    const char* value = "";
+    if (p < tagEnd && *p == '=') {
+      p++;
+      while (p < tagEnd && isSpace(*p)) {
+        p++;
+      }
+      char* valueStart = p;
+      char* valueEnd;
+      if (p < tagEnd && (*p == '"' || *p == '\'')) {
+        const char quote = *p++;
+        valueStart = p;
+        while (p < tagEnd && *p != quote) {
+          p++;
+        }
+        valueEnd = p;
+        if (p < tagEnd) {
+          p++;
+        }
+      } else {
+        while (p < tagEnd && !isSpace(*p)) {
+          p++;
+        }
+        valueEnd = p;
+        // The whitespace ending the value is where its terminator goes
+        if (p < tagEnd) {
+          p++;
+        }
+      }
+      decodeValue(valueStart, valueEnd);
+      value = valueStart;
+    }
+
+    // Everything up to p is read, so the name can be terminated where it ends
+    *attributeNameEnd = '\0';
+    if (attributeNameEnd != attributeName && count < MAX_ATTRIBUTES) {
+      tokenAttributes[count * 2] = attributeName;
+      tokenAttributes[count * 2 + 1] = value;
+      count++;
+    }
+  }
+  tokenAttributes[count * 2] = nullptr;
+  *nameEnd = '\0';
+
+  begin = close + 1;
+  tokenName = name;
+  if (selfClosing || isVoidElement(name)) {
+    pendingEnd = true;
+  } else {
+    pushElement(name);
+  }
+  return Token::StartTag;
+}
+
+XhtmlTokenizer::Token XhtmlTokenizer::readEndTag(const size_t close) {
+  char* const name = buffer + begin + 2;
+  char* nameEnd = name;
+  while (nameEnd < buffer + close && !isSpace(*nameEnd)) {
+    nameEnd++;
+  }
+  *nameEnd = '\0';
+  begin = close + 1;
+
+  // Past MAX_DEPTH the names aren't kept, so trust the document
+  if (overflowDepth > 0) {
+    overflowDepth--;
+    tokenName = name;
+    return Token::EndTag;
+  }
+  for (int i = depth - 1; i >= 0; i--) {
+    if (strcmp(nameArena + nameOffsets[i], name) == 0) {
+      // Elements opened inside this one and left open are closed with it
+      closeToDepth = i;
+      return popElement();
+    }
+  }
+  // Closes nothing that is open
+  return CONTINUE;
+}
+
+XhtmlTokenizer::Token XhtmlTokenizer::popElement() {
+  if (overflowDepth > 0) {
+    overflowDepth--;
+    tokenName = "";
+  } else {
+    depth--;
+    tokenName = nameArena + nameOffsets[depth];
+  }
+  return Token::EndTag;
+}
+
+void XhtmlTokenizer::pushElement(const char* name) {
+  const size_t offset = depth == 0 ? 0 : nameOffsets[depth - 1] + strlen(nameArena + nameOffsets[depth - 1]) + 1;
+  const size_t length = strlen(name);
+  if (overflowDepth > 0 || depth == MAX_DEPTH || offset + length + 1 > NAME_ARENA_SIZE) {
+    overflowDepth++;
+    return;
+  }
+  memcpy(nameArena + offset, name, length + 1);
+  nameOffsets[depth++] = static_cast<uint16_t>(offset);
+}
+
+bool XhtmlTokenizer::skipUntil(const char* terminator) {
+  const size_t length = strlen(terminator);
+  const char* start = buffer + begin;
+  const char* limit = buffer + end;
+  for (const char* p = start; p + length <= limit; p++) {
+    if (memcmp(p, terminator, length) == 0) {
+      begin = p + length - buffer;
+      state = State::Content;
+      return true;
+    }
+  }
+  if (final) {
+    begin = end;
+    state = State::Content;
+    return true;
+  }
+  // Keep what could be the start of the terminator
+  if (end - begin >= length) {
+    begin = end - (length - 1);
+  }
+  return false;
+}
+
+bool XhtmlTokenizer::skipDeclaration() {
+  for (; begin < end; begin++) {
+    const char c = buffer[begin];
+    if (declarationQuote) {
+      if (c == declarationQuote) {
+        declarationQuote = 0;
+      }
+    } else if (c == '"' || c == '\'') {
+      declarationQuote = c;
+    } else if (c == '[') {
+      declarationBrackets++;
+    } else if (c == ']') {
+      declarationBrackets--;
+    } else if (c == '>' && declarationBrackets <= 0) {
+      begin++;
+      state = State::Content;
+      return true;
+    }
+  }
+  if (final) {
+    state = State::Content;
+    return true;
+  }
+  return false;
+}
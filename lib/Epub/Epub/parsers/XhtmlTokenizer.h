@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Pull tokenizer for chapter XHTML, which ChapterHtmlSlimParser uses instead of expat when built with
+// -DXHTML_PULL_TOKENIZER=1.
+//
+// Input is fed in chunks the way expat takes it: getBuffer(), read into it, commit(). next() then returns tokens until
+// it needs more input. Tokens point into the input buffer, which is tokenized in place: names and attribute values are
+// null-terminated where they stand and entities (the XML ones, numeric ones and the HTML ones in htmlEntities) are
+// decoded in place, so nothing is copied. Attributes come as expat passes them, name/value pairs in a nullptr-ended
+// array, so the same element handlers serve both.
+//
+// Real-world XHTML that expat rejects is read the way browsers would: undeclared entities are decoded, unquoted and
+// valueless attributes are accepted, HTML void elements (<br>, <img>) need no closing tag, an end tag closes every
+// element opened after the one it matches, stray end tags are dropped, and the elements still open at the end are
+// closed. Text outside the root element is dropped, as expat rejects it. Only running out of memory stops it.
+class XhtmlTokenizer {
+ public:
+  enum class Token : uint8_t {
+    NeedInput,  // Feed the next chunk (getBuffer() + commit())
+    StartTag,   // name(), attributes(); a matching EndTag always follows, even for <br/> and void elements
+    EndTag,     // name()
+    Text,       // text(), textLength(); a long run of text may come in several tokens
+    End,        // All input was read and every open element closed
+    Error,      // Out of memory
+  };
+
+  static constexpr int MAX_ATTRIBUTES = 16;  // More are dropped
+  static constexpr size_t MAX_TOKEN_SIZE = 16 * 1024;  // Longer tags, comments and the like are skipped
+
+ private:
+  enum class State : uint8_t { Content, Comment, Cdata, Declaration, Instruction, SkipTag };
+
+  static constexpr int MAX_DEPTH = 64;  // Elements nested deeper are closed without checking their names
+  static constexpr size_t NAME_ARENA_SIZE = 768;
+
+  char* buffer = nullptr;
+  size_t capacity = 0;
+  size_t begin = 0;  // Next unread byte
+  size_t end = 0;    // End of the input read so far
+  bool final = false;
+  bool failed = false;
+  State state = State::Content;
+  int declarationBrackets = 0;
+  char declarationQuote = 0;
+
+  // Current token
+  const char* tokenName = "";
+  const char* tokenAttributes[MAX_ATTRIBUTES * 2 + 1] = {};
+  const char* tokenText = nullptr;
+  size_t tokenTextLength = 0;
+  bool pendingEnd = false;  // The last StartTag was self-closing
+  int closeToDepth = -1;    // An end tag closes the open elements down to this depth
+
+  // Names of the open elements
+  char nameArena[NAME_ARENA_SIZE] = {};
+  uint16_t nameOffsets[MAX_DEPTH] = {};
+  int depth = 0;
+  int overflowDepth = 0;  // Open elements beyond MAX_DEPTH or NAME_ARENA_SIZE
+
+  Token readText();
+  Token readCdata();
+  Token readTag();
+  Token readStartTag(size_t close);
+  Token readEndTag(size_t close);
+  Token popElement();
+  Token needInput();
+  bool skipUntil(const char* terminator);
+  bool skipDeclaration();
+  void pushElement(const char* name);
+
+ public:
+  XhtmlTokenizer() = default;
+  ~XhtmlTokenizer();
+  XhtmlTokenizer(const XhtmlTokenizer&) = delete;
+  XhtmlTokenizer& operator=(const XhtmlTokenizer&) = delete;
+
+  // Room for `len` more bytes of input, or nullptr when out of memory. Invalidates the current token.
+  char* getBuffer(size_t len);
+  // `len` bytes were written to the buffer; `isFinal` when no input follows
+  void commit(size_t len, bool isFinal);
+  Token next();
+
+  // Valid until the next call to next() or getBuffer()
+  const char* name() const { return tokenName; }
+  const char** attributes() { return tokenAttributes; }
+  const char* text() const { return tokenText; }
+  size_t textLength() const { return tokenTextLength; }
+  // Bytes held for tokens that span chunks, for measuring
+  size_t bufferCapacity() const { return capacity; }
+};
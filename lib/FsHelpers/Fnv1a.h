@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// 32-bit FNV-1a, for naming cache files after a key (a path, a URL) and for checksumming buffers. Pass the previous
+// result as `hash` to continue over data that comes in parts.
+constexpr uint32_t FNV1A32_OFFSET_BASIS = 2166136261u;
+
+inline uint32_t fnv1a32(const void* data, const size_t size, uint32_t hash = FNV1A32_OFFSET_BASIS) {
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  for (size_t i = 0; i < size; i++) {
+    hash = (hash ^ bytes[i]) * 16777619u;
+  }
+  return hash;
+}
+
+inline uint32_t fnv1a32(const std::string& text) { return fnv1a32(text.data(), text.size()); }
@@ -1,8 +1,30 @@
 #include "GfxRenderer.h"
 
+#include <Fnv1a.h>
+#include <HeapTags.h>
 #include <Logging.h>
 #include <Utf8.h>
 
+#ifdef GFX_RENDER_STATS
+// Counts a drawing call, unless it was made by another drawing call
+class GfxRenderer::StatsScope {
+  const GfxRenderer& renderer;
+
+ public:
+  explicit StatsScope(const GfxRenderer& renderer) : renderer(renderer) {
+    if (renderer.statsDepth++ == 0) {
+      renderer.stats.calls++;
+    }
+  }
+  ~StatsScope() { renderer.statsDepth--; }
+};
+#define GFX_STATS_CALL() const StatsScope statsScope(*this)
+#define GFX_STATS_COUNT(counter) stats.counter++
+#else
+#define GFX_STATS_CALL()
+#define GFX_STATS_COUNT(counter)
+#endif
+
 const uint8_t* GfxRenderer::getGlyphBitmap(const EpdFontData* fontData, const EpdGlyph* glyph) const {
   if (fontData->groups != nullptr) {
     if (!fontDecompressor) {
@@ -25,6 +47,14 @@ void GfxRenderer::begin() {
 
 void GfxRenderer::insertFont(const int fontId, EpdFontFamily font) { fontMap.insert({fontId, font}); }
 
+const EpdFontFamily* GfxRenderer::findFont(const int fontId) const {
+  const auto it = fontMap.find(fontId);
+  if (it != fontMap.end()) {
+    return &it->second;
+  }
+  return fontResolver ? fontResolver(fontId) : nullptr;
+}
+
 // Translate logical (x,y) coordinates to physical panel coordinates based on current orientation
 // This should always be inlined for better performance
 static inline void rotateCoordinates(const GfxRenderer::Orientation orientation, const int x, const int y, int* phyX,
@@ -163,6 +193,8 @@ static void renderCharImpl(const GfxRenderer& renderer, GfxRenderer::RenderMode
 // IMPORTANT: This function is in critical rendering path and is called for every pixel. Please keep it as simple and
 // efficient as possible.
 void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
+  GFX_STATS_CALL();
+  GFX_STATS_COUNT(pixels);
   int phyX = 0;
   int phyY = 0;
 
@@ -187,25 +219,27 @@ void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
 }
 
 int GfxRenderer::getTextWidth(const int fontId, const char* text, const EpdFontFamily::Style style) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
+  const EpdFontFamily* family = findFont(fontId);
+  if (!family) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return 0;
   }
 
   int w = 0, h = 0;
-  fontIt->second.getTextDimensions(text, &w, &h, style);
+  family->getTextDimensions(text, &w, &h, style);
   return w;
 }
 
 void GfxRenderer::drawCenteredText(const int fontId, const int y, const char* text, const bool black,
                                    const EpdFontFamily::Style style) const {
+  GFX_STATS_CALL();
   const int x = (getScreenWidth() - getTextWidth(fontId, text, style)) / 2;
   drawText(fontId, x, y, text, black, style);
 }
 
 void GfxRenderer::drawText(const int fontId, const int x, const int y, const char* text, const bool black,
                            const EpdFontFamily::Style style) const {
+  GFX_STATS_CALL();
   int yPos = y + getFontAscenderSize(fontId);
   int xPos = x;
   int lastBaseX = x;
@@ -218,12 +252,12 @@ void GfxRenderer::drawText(const int fontId, const int x, const int y, const cha
     return;
   }
 
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
+  const EpdFontFamily* family = findFont(fontId);
+  if (!family) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return;
   }
-  const auto& font = fontIt->second;
+  const auto& font = *family;
   constexpr int MIN_COMBINING_GAP_PX = 1;
 
   uint32_t cp;
@@ -263,20 +297,11 @@ void GfxRenderer::drawText(const int fontId, const int x, const int y, const cha
 }
 
 void GfxRenderer::drawLine(int x1, int y1, int x2, int y2, const bool state) const {
+  GFX_STATS_CALL();
   if (x1 == x2) {
-    if (y2 < y1) {
-      std::swap(y1, y2);
-    }
-    for (int y = y1; y <= y2; y++) {
-      drawPixel(x1, y, state);
-    }
+    fillBox(x1, std::min(y1, y2), x1, std::max(y1, y2), state ? Color::Black : Color::White);
   } else if (y1 == y2) {
-    if (x2 < x1) {
-      std::swap(x1, x2);
-    }
-    for (int x = x1; x <= x2; x++) {
-      drawPixel(x, y1, state);
-    }
+    fillSpan(x1, x2, y1, state ? Color::Black : Color::White);
   } else {
     // Bresenham's line algorithm — integer arithmetic only
     int dx = x2 - x1;
@@ -304,12 +329,14 @@ void GfxRenderer::drawLine(int x1, int y1, int x2, int y2, const bool state) con
 }
 
 void GfxRenderer::drawLine(int x1, int y1, int x2, int y2, const int lineWidth, const bool state) const {
+  GFX_STATS_CALL();
   for (int i = 0; i < lineWidth; i++) {
     drawLine(x1, y1 + i, x2, y2 + i, state);
   }
 }
 
 void GfxRenderer::drawRect(const int x, const int y, const int width, const int height, const bool state) const {
+  GFX_STATS_CALL();
   drawLine(x, y, x + width - 1, y, state);
   drawLine(x + width - 1, y, x + width - 1, y + height - 1, state);
   drawLine(x + width - 1, y + height - 1, x, y + height - 1, state);
@@ -319,6 +346,7 @@ void GfxRenderer::drawRect(const int x, const int y, const int width, const int
 // Border is inside the rectangle
 void GfxRenderer::drawRect(const int x, const int y, const int width, const int height, const int lineWidth,
                            const bool state) const {
+  GFX_STATS_CALL();
   for (int i = 0; i < lineWidth; i++) {
     drawLine(x + i, y + i, x + width - i, y + i, state);
     drawLine(x + width - i, y + i, x + width - i, y + height - i, state);
@@ -329,19 +357,23 @@ void GfxRenderer::drawRect(const int x, const int y, const int width, const int
 
 void GfxRenderer::drawArc(const int maxRadius, const int cx, const int cy, const int xDir, const int yDir,
                           const int lineWidth, const bool state) const {
+  GFX_STATS_CALL();
   const int stroke = std::min(lineWidth, maxRadius);
   const int innerRadius = std::max(maxRadius - stroke, 0);
   const int outerRadiusSq = maxRadius * maxRadius;
   const int innerRadiusSq = innerRadius * innerRadius;
+  // On each row the pixels between the two radii are one run; both of its ends move inwards as dy grows
+  int dxMin = innerRadius;
+  int dxMax = maxRadius;
   for (int dy = 0; dy <= maxRadius; ++dy) {
-    for (int dx = 0; dx <= maxRadius; ++dx) {
-      const int distSq = dx * dx + dy * dy;
-      if (distSq > outerRadiusSq || distSq < innerRadiusSq) {
-        continue;
-      }
-      const int px = cx + xDir * dx;
-      const int py = cy + yDir * dy;
-      drawPixel(px, py, state);
+    while (dxMin > 0 && (dxMin - 1) * (dxMin - 1) + dy * dy >= innerRadiusSq) {
+      dxMin--;
+    }
+    while (dxMax * dxMax + dy * dy > outerRadiusSq) {
+      dxMax--;
+    }
+    if (dxMin <= dxMax) {
+      fillSpan(cx + xDir * dxMin, cx + xDir * dxMax, cy + yDir * dy, state ? Color::Black : Color::White);
     }
   }
 };
@@ -349,6 +381,7 @@ void GfxRenderer::drawArc(const int maxRadius, const int cx, const int cy, const
 // Border is inside the rectangle, rounded corners
 void GfxRenderer::drawRoundedRect(const int x, const int y, const int width, const int height, const int lineWidth,
                                   const int cornerRadius, bool state) const {
+  GFX_STATS_CALL();
   drawRoundedRect(x, y, width, height, lineWidth, cornerRadius, true, true, true, true, state);
 }
 
@@ -356,6 +389,7 @@ void GfxRenderer::drawRoundedRect(const int x, const int y, const int width, con
 void GfxRenderer::drawRoundedRect(const int x, const int y, const int width, const int height, const int lineWidth,
                                   const int cornerRadius, bool roundTopLeft, bool roundTopRight, bool roundBottomLeft,
                                   bool roundBottomRight, bool state) const {
+  GFX_STATS_CALL();
   if (lineWidth <= 0 || width <= 0 || height <= 0) {
     return;
   }
@@ -405,82 +439,173 @@ void GfxRenderer::drawRoundedRect(const int x, const int y, const int width, con
 }
 
 void GfxRenderer::fillRect(const int x, const int y, const int width, const int height, const bool state) const {
-  for (int fillY = y; fillY < y + height; fillY++) {
-    drawLine(x, fillY, x + width - 1, fillY, state);
+  GFX_STATS_CALL();
+  if (height <= 0) {
+    return;
   }
+  // As a line per row used to: a width of 0 or less still fills from x + width - 1 to x
+  const int right = x + width - 1;
+  fillBox(std::min(x, right), y, std::max(x, right), y + height - 1, state ? Color::Black : Color::White);
 }
 
-// NOTE: Those are in critical path, and need to be templated to avoid runtime checks for every pixel.
-// Any branching must be done outside the loops to avoid performance degradation.
-template <>
-void GfxRenderer::drawPixelDither<Color::Clear>(const int x, const int y) const {
-  // Do nothing
-}
+namespace {
+// A gray with n black cells out of 16 is black where the threshold is below n, so each gray is 4x4 periodic
+constexpr uint8_t BAYER_4X4[4][4] = {{0, 8, 2, 10}, {12, 4, 14, 6}, {3, 11, 1, 9}, {15, 7, 13, 5}};
+constexpr int LIGHT_GRAY_BLACK_CELLS = 4;  // Black where x and y are both even
+constexpr int DARK_GRAY_BLACK_CELLS = 8;   // Checkerboard
+
+// Frame buffer bytes for physical rows 0-3 (mod 4) of a gray in one orientation, 0 bits black. The pattern stays fixed
+// to logical coordinates: each physical pixel is looked up where rotateCoordinates() maps from. Every period divides
+// 8, so one byte serves the whole row.
+struct DitherTile {
+  uint8_t rows[4];
+};
 
-template <>
-void GfxRenderer::drawPixelDither<Color::Black>(const int x, const int y) const {
-  drawPixel(x, y, true);
+constexpr DitherTile makeDitherTile(const GfxRenderer::Orientation orientation, const int blackCells) {
+  DitherTile tile = {};
+  for (int phyY = 0; phyY < 4; phyY++) {
+    uint8_t bits = 0xFF;
+    for (int phyX = 0; phyX < 8; phyX++) {
+      int x = phyX;
+      int y = phyY;
+      switch (orientation) {
+        case GfxRenderer::Portrait:
+          x = HalDisplay::DISPLAY_HEIGHT - 1 - phyY;
+          y = phyX;
+          break;
+        case GfxRenderer::LandscapeClockwise:
+          x = HalDisplay::DISPLAY_WIDTH - 1 - phyX;
+          y = HalDisplay::DISPLAY_HEIGHT - 1 - phyY;
+          break;
+        case GfxRenderer::PortraitInverted:
+          x = phyY;
+          y = HalDisplay::DISPLAY_WIDTH - 1 - phyX;
+          break;
+        case GfxRenderer::LandscapeCounterClockwise:
+          break;
+      }
+      if (BAYER_4X4[y % 4][x % 4] < blackCells) {
+        bits &= ~(0x80 >> phyX);
+      }
+    }
+    tile.rows[phyY] = bits;
+  }
+  return tile;
 }
 
-template <>
-void GfxRenderer::drawPixelDither<Color::White>(const int x, const int y) const {
-  drawPixel(x, y, false);
+// Indexed by orientation
+constexpr DitherTile LIGHT_GRAY_TILES[] = {
+    makeDitherTile(GfxRenderer::Portrait, LIGHT_GRAY_BLACK_CELLS),
+    makeDitherTile(GfxRenderer::LandscapeClockwise, LIGHT_GRAY_BLACK_CELLS),
+    makeDitherTile(GfxRenderer::PortraitInverted, LIGHT_GRAY_BLACK_CELLS),
+    makeDitherTile(GfxRenderer::LandscapeCounterClockwise, LIGHT_GRAY_BLACK_CELLS),
+};
+constexpr DitherTile DARK_GRAY_TILES[] = {
+    makeDitherTile(GfxRenderer::Portrait, DARK_GRAY_BLACK_CELLS),
+    makeDitherTile(GfxRenderer::LandscapeClockwise, DARK_GRAY_BLACK_CELLS),
+    makeDitherTile(GfxRenderer::PortraitInverted, DARK_GRAY_BLACK_CELLS),
+    makeDitherTile(GfxRenderer::LandscapeCounterClockwise, DARK_GRAY_BLACK_CELLS),
+};
+constexpr DitherTile BLACK_TILE = {{0x00, 0x00, 0x00, 0x00}};
+constexpr DitherTile WHITE_TILE = {{0xFF, 0xFF, 0xFF, 0xFF}};
+}  // namespace
+
+void GfxRenderer::fillSpan(const int x1, const int x2, const int y, const Color color) const {
+  fillBox(std::min(x1, x2), y, std::max(x1, x2), y, color);
 }
 
-template <>
-void GfxRenderer::drawPixelDither<Color::LightGray>(const int x, const int y) const {
-  drawPixel(x, y, x % 2 == 0 && y % 2 == 0);
+// Rotation maps a logical box onto a physical one, so only two corners need mapping
+void GfxRenderer::fillBox(int left, int top, int right, int bottom, const Color color) const {
+  left = std::max(left, 0);
+  top = std::max(top, 0);
+  right = std::min(right, getScreenWidth() - 1);
+  bottom = std::min(bottom, getScreenHeight() - 1);
+  if (left > right || top > bottom) {
+    return;
+  }
+
+  const DitherTile* tile = nullptr;
+  switch (color) {
+    case Color::Clear:
+      return;
+    case Color::Black:
+      tile = &BLACK_TILE;
+      break;
+    case Color::White:
+      tile = &WHITE_TILE;
+      break;
+    case Color::LightGray:
+      tile = &LIGHT_GRAY_TILES[orientation];
+      break;
+    case Color::DarkGray:
+      tile = &DARK_GRAY_TILES[orientation];
+      break;
+  }
+
+  int x1 = 0, y1 = 0, x2 = 0, y2 = 0;
+  rotateCoordinates(orientation, left, top, &x1, &y1);
+  rotateCoordinates(orientation, right, bottom, &x2, &y2);
+  fillPhysicalBox(std::min(x1, x2), std::min(y1, y2), std::max(x1, x2), std::max(y1, y2), tile->rows);
 }
 
-template <>
-void GfxRenderer::drawPixelDither<Color::DarkGray>(const int x, const int y) const {
-  drawPixel(x, y, (x + y) % 2 == 0);  // TODO: maybe find a better pattern?
+// IMPORTANT: Every fill ends up here. Whole bytes in a row are set at once, the partial bytes at either end through a
+// mask.
+void GfxRenderer::fillPhysicalBox(const int left, const int top, const int right, const int bottom,
+                                  const uint8_t* pattern) const {
+  GFX_STATS_COUNT(spans);
+  const int firstByte = left / 8;
+  const int lastByte = right / 8;
+  uint8_t firstMask = 0xFF >> (left % 8);
+  const uint8_t lastMask = 0xFF << (7 - right % 8);
+  if (firstByte == lastByte) {
+    firstMask &= lastMask;
+  }
+
+  uint8_t* row = frameBuffer + top * HalDisplay::DISPLAY_WIDTH_BYTES;
+  for (int y = top; y <= bottom; y++, row += HalDisplay::DISPLAY_WIDTH_BYTES) {
+    const uint8_t bits = pattern[y % 4];
+    row[firstByte] = (row[firstByte] & ~firstMask) | (bits & firstMask);
+    if (lastByte > firstByte) {
+      memset(row + firstByte + 1, bits, lastByte - firstByte - 1);
+      row[lastByte] = (row[lastByte] & ~lastMask) | (bits & lastMask);
+    }
+  }
 }
 
 void GfxRenderer::fillRectDither(const int x, const int y, const int width, const int height, Color color) const {
-  if (color == Color::Clear) {
-  } else if (color == Color::Black) {
+  GFX_STATS_CALL();
+  if (color == Color::Black) {
     fillRect(x, y, width, height, true);
   } else if (color == Color::White) {
     fillRect(x, y, width, height, false);
-  } else if (color == Color::LightGray) {
-    for (int fillY = y; fillY < y + height; fillY++) {
-      for (int fillX = x; fillX < x + width; fillX++) {
-        drawPixelDither<Color::LightGray>(fillX, fillY);
-      }
-    }
-  } else if (color == Color::DarkGray) {
-    for (int fillY = y; fillY < y + height; fillY++) {
-      for (int fillX = x; fillX < x + width; fillX++) {
-        drawPixelDither<Color::DarkGray>(fillX, fillY);
-      }
-    }
+  } else if (width > 0 && height > 0) {
+    fillBox(x, y, x + width - 1, y + height - 1, color);
   }
 }
 
-template <Color color>
-void GfxRenderer::fillArc(const int maxRadius, const int cx, const int cy, const int xDir, const int yDir) const {
+// One run per row: dxMax shrinks as dy grows
+void GfxRenderer::fillArc(const int maxRadius, const int cx, const int cy, const int xDir, const int yDir,
+                          const Color color) const {
   const int radiusSq = maxRadius * maxRadius;
+  int dxMax = maxRadius;
   for (int dy = 0; dy <= maxRadius; ++dy) {
-    for (int dx = 0; dx <= maxRadius; ++dx) {
-      const int distSq = dx * dx + dy * dy;
-      const int px = cx + xDir * dx;
-      const int py = cy + yDir * dy;
-      if (distSq <= radiusSq) {
-        drawPixelDither<color>(px, py);
-      }
+    while (dxMax * dxMax + dy * dy > radiusSq) {
+      dxMax--;
     }
+    fillSpan(cx, cx + xDir * dxMax, cy + yDir * dy, color);
   }
 }
 
 void GfxRenderer::fillRoundedRect(const int x, const int y, const int width, const int height, const int cornerRadius,
                                   const Color color) const {
+  GFX_STATS_CALL();
   fillRoundedRect(x, y, width, height, cornerRadius, true, true, true, true, color);
 }
 
 void GfxRenderer::fillRoundedRect(const int x, const int y, const int width, const int height, const int cornerRadius,
                                   bool roundTopLeft, bool roundTopRight, bool roundBottomLeft, bool roundBottomRight,
                                   const Color color) const {
+  GFX_STATS_CALL();
   if (width <= 0 || height <= 0) {
     return;
   }
@@ -510,43 +635,25 @@ void GfxRenderer::fillRoundedRect(const int x, const int y, const int width, con
     fillRectDither(x + width - maxRadius - 1, rightFillTop, maxRadius + 1, rightFillBottom - rightFillTop + 1, color);
   }
 
-  auto fillArcTemplated = [this](int maxRadius, int cx, int cy, int xDir, int yDir, Color color) {
-    switch (color) {
-      case Color::Clear:
-        break;
-      case Color::Black:
-        fillArc<Color::Black>(maxRadius, cx, cy, xDir, yDir);
-        break;
-      case Color::White:
-        fillArc<Color::White>(maxRadius, cx, cy, xDir, yDir);
-        break;
-      case Color::LightGray:
-        fillArc<Color::LightGray>(maxRadius, cx, cy, xDir, yDir);
-        break;
-      case Color::DarkGray:
-        fillArc<Color::DarkGray>(maxRadius, cx, cy, xDir, yDir);
-        break;
-    }
-  };
-
   if (roundTopLeft) {
-    fillArcTemplated(maxRadius, x + maxRadius, y + maxRadius, -1, -1, color);
+    fillArc(maxRadius, x + maxRadius, y + maxRadius, -1, -1, color);
   }
 
   if (roundTopRight) {
-    fillArcTemplated(maxRadius, x + width - maxRadius - 1, y + maxRadius, 1, -1, color);
+    fillArc(maxRadius, x + width - maxRadius - 1, y + maxRadius, 1, -1, color);
   }
 
   if (roundBottomRight) {
-    fillArcTemplated(maxRadius, x + width - maxRadius - 1, y + height - maxRadius - 1, 1, 1, color);
+    fillArc(maxRadius, x + width - maxRadius - 1, y + height - maxRadius - 1, 1, 1, color);
   }
 
   if (roundBottomLeft) {
-    fillArcTemplated(maxRadius, x + maxRadius, y + height - maxRadius - 1, -1, 1, color);
+    fillArc(maxRadius, x + maxRadius, y + height - maxRadius - 1, -1, 1, color);
   }
 }
 
 void GfxRenderer::drawImage(const uint8_t bitmap[], const int x, const int y, const int width, const int height) const {
+  GFX_STATS_CALL();
   int rotatedX = 0;
   int rotatedY = 0;
   rotateCoordinates(orientation, x, y, &rotatedX, &rotatedY);
@@ -570,11 +677,13 @@ void GfxRenderer::drawImage(const uint8_t bitmap[], const int x, const int y, co
 }
 
 void GfxRenderer::drawIcon(const uint8_t bitmap[], const int x, const int y, const int width, const int height) const {
+  GFX_STATS_CALL();
   display.drawImageTransparent(bitmap, y, getScreenWidth() - width - x, height, width);
 }
 
 void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, const int maxWidth, const int maxHeight,
                              const float cropX, const float cropY) const {
+  GFX_STATS_CALL();
   // For 1-bit bitmaps, use optimized 1-bit rendering path (no crop support for 1-bit)
   if (bitmap.is1Bit() && cropX == 0.0f && cropY == 0.0f) {
     drawBitmap1Bit(bitmap, x, y, maxWidth, maxHeight);
@@ -670,6 +779,7 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
 
 void GfxRenderer::drawBitmap1Bit(const Bitmap& bitmap, const int x, const int y, const int maxWidth,
                                  const int maxHeight) const {
+  GFX_STATS_CALL();
   float scale = 1.0f;
   bool isScaled = false;
   if (maxWidth > 0 && bitmap.getWidth() > maxWidth) {
@@ -738,6 +848,7 @@ void GfxRenderer::drawBitmap1Bit(const Bitmap& bitmap, const int x, const int y,
 }
 
 void GfxRenderer::fillPolygon(const int* xPoints, const int* yPoints, int numPoints, bool state) const {
+  GFX_STATS_CALL();
   if (numPoints < 3) return;
 
   // Find bounding box
@@ -751,11 +862,16 @@ void GfxRenderer::fillPolygon(const int* xPoints, const int* yPoints, int numPoi
   if (minY < 0) minY = 0;
   if (maxY >= getScreenHeight()) maxY = getScreenHeight() - 1;
 
-  // Allocate node buffer for scanline algorithm
-  auto* nodeX = static_cast<int*>(malloc(numPoints * sizeof(int)));
-  if (!nodeX) {
-    LOG_ERR("GFX", "!! Failed to allocate polygon node buffer");
-    return;
+  // Node buffer for the scanline algorithm; only polygons with more edges than the themes draw need the heap
+  constexpr int STACK_NODES = 32;
+  int stackNodes[STACK_NODES];
+  int* nodeX = stackNodes;
+  if (numPoints > STACK_NODES) {
+    nodeX = static_cast<int*>(malloc(numPoints * sizeof(int)));
+    if (!nodeX) {
+      LOG_ERR("GFX", "!! Failed to allocate polygon node buffer");
+      return;
+    }
   }
 
   // Scanline fill algorithm
@@ -775,15 +891,14 @@ void GfxRenderer::fillPolygon(const int* xPoints, const int* yPoints, int numPoi
       j = i;
     }
 
-    // Sort nodes by X (simple bubble sort, numPoints is small)
-    for (int i = 0; i < nodes - 1; i++) {
-      for (int k = i + 1; k < nodes; k++) {
-        if (nodeX[i] > nodeX[k]) {
-          int temp = nodeX[i];
-          nodeX[i] = nodeX[k];
-          nodeX[k] = temp;
-        }
+    // Sort nodes by X (insertion sort, there are only a few)
+    for (int i = 1; i < nodes; i++) {
+      const int node = nodeX[i];
+      int k = i;
+      for (; k > 0 && nodeX[k - 1] > node; k--) {
+        nodeX[k] = nodeX[k - 1];
       }
+      nodeX[k] = node;
     }
 
     // Fill between pairs of nodes
@@ -795,26 +910,29 @@ void GfxRenderer::fillPolygon(const int* xPoints, const int* yPoints, int numPoi
       if (startX < 0) startX = 0;
       if (endX >= getScreenWidth()) endX = getScreenWidth() - 1;
 
-      // Draw horizontal line
-      for (int x = startX; x <= endX; x++) {
-        drawPixel(x, scanY, state);
+      if (startX <= endX) {
+        fillSpan(startX, endX, scanY, state ? Color::Black : Color::White);
       }
     }
   }
 
-  free(nodeX);
+  if (nodeX != stackNodes) {
+    free(nodeX);
+  }
 }
 
 // For performance measurement (using static to allow "const" methods)
 static unsigned long start_ms = 0;
 
 void GfxRenderer::clearScreen(const uint8_t color) const {
+  GFX_STATS_CALL();
   start_ms = millis();
   display.clearScreen(color);
 }
 
 void GfxRenderer::invertScreen() const {
-  for (int i = 0; i < HalDisplay::BUFFER_SIZE; i++) {
+  GFX_STATS_CALL();
+  for (uint32_t i = 0; i < HalDisplay::BUFFER_SIZE; i++) {
     frameBuffer[i] = ~frameBuffer[i];
   }
 }
@@ -822,9 +940,26 @@ void GfxRenderer::invertScreen() const {
 void GfxRenderer::displayBuffer(const HalDisplay::RefreshMode refreshMode) const {
   auto elapsed = millis() - start_ms;
   LOG_DBG("GFX", "Time = %lu ms from clearScreen to displayBuffer", elapsed);
+  if (hasPresentedFrame) {
+    hasPresentedFrame = false;
+    const bool unchanged = frameChecksum(frameBuffer) == presentedFrameChecksum;
+    LOG_INF("GFX", "Replacing presented frame at %lu ms: %s", millis(), unchanged ? "unchanged" : "refreshing");
+    if (unchanged) {
+      return;
+    }
+  }
   display.displayBuffer(refreshMode, fadingFix);
 }
 
+void GfxRenderer::setPresentedFrame(const uint32_t checksum) {
+  presentedFrameChecksum = checksum;
+  hasPresentedFrame = true;
+}
+
+uint32_t GfxRenderer::frameChecksum(const uint8_t* buffer) {
+  return fnv1a32(buffer, HalDisplay::BUFFER_SIZE);
+}
+
 std::string GfxRenderer::truncatedText(const int fontId, const char* text, const int maxWidth,
                                        const EpdFontFamily::Style style) const {
   if (!text || maxWidth <= 0) return "";
@@ -939,34 +1074,34 @@ int GfxRenderer::getScreenHeight() const {
 }
 
 int GfxRenderer::getSpaceWidth(const int fontId, const EpdFontFamily::Style style) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
+  const EpdFontFamily* family = findFont(fontId);
+  if (!family) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return 0;
   }
 
-  const EpdGlyph* spaceGlyph = fontIt->second.getGlyph(' ', style);
+  const EpdGlyph* spaceGlyph = family->getGlyph(' ', style);
   return spaceGlyph ? spaceGlyph->advanceX : 0;
 }
 
 int GfxRenderer::getSpaceKernAdjust(const int fontId, const uint32_t leftCp, const uint32_t rightCp,
                                     const EpdFontFamily::Style style) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) return 0;
-  const auto& font = fontIt->second;
+  const EpdFontFamily* family = findFont(fontId);
+  if (!family) return 0;
+  const auto& font = *family;
   return font.getKerning(leftCp, ' ', style) + font.getKerning(' ', rightCp, style);
 }
 
 int GfxRenderer::getKerning(const int fontId, const uint32_t leftCp, const uint32_t rightCp,
                             const EpdFontFamily::Style style) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) return 0;
-  return fontIt->second.getKerning(leftCp, rightCp, style);
+  const EpdFontFamily* family = findFont(fontId);
+  if (!family) return 0;
+  return family->getKerning(leftCp, rightCp, style);
 }
 
 int GfxRenderer::getTextAdvanceX(const int fontId, const char* text, EpdFontFamily::Style style) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
+  const EpdFontFamily* family = findFont(fontId);
+  if (!family) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return 0;
   }
@@ -974,7 +1109,7 @@ int GfxRenderer::getTextAdvanceX(const int fontId, const char* text, EpdFontFami
   uint32_t cp;
   uint32_t prevCp = 0;
   int width = 0;
-  const auto& font = fontIt->second;
+  const auto& font = *family;
   while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
     if (utf8IsCombiningMark(cp)) {
       continue;
@@ -991,48 +1126,49 @@ int GfxRenderer::getTextAdvanceX(const int fontId, const char* text, EpdFontFami
 }
 
 int GfxRenderer::getFontAscenderSize(const int fontId) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
+  const EpdFontFamily* family = findFont(fontId);
+  if (!family) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return 0;
   }
 
-  return fontIt->second.getData(EpdFontFamily::REGULAR)->ascender;
+  return family->getData(EpdFontFamily::REGULAR)->ascender;
 }
 
 int GfxRenderer::getLineHeight(const int fontId) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
+  const EpdFontFamily* family = findFont(fontId);
+  if (!family) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return 0;
   }
 
-  return fontIt->second.getData(EpdFontFamily::REGULAR)->advanceY;
+  return family->getData(EpdFontFamily::REGULAR)->advanceY;
 }
 
 int GfxRenderer::getTextHeight(const int fontId) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
+  const EpdFontFamily* family = findFont(fontId);
+  if (!family) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return 0;
   }
-  return fontIt->second.getData(EpdFontFamily::REGULAR)->ascender;
+  return family->getData(EpdFontFamily::REGULAR)->ascender;
 }
 
 void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y, const char* text, const bool black,
                                       const EpdFontFamily::Style style) const {
+  GFX_STATS_CALL();
   // Cannot draw a NULL / empty string
   if (text == nullptr || *text == '\0') {
     return;
   }
 
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
+  const EpdFontFamily* family = findFont(fontId);
+  if (!family) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return;
   }
 
-  const auto& font = fontIt->second;
+  const auto& font = *family;
 
   int xPos = x;
   int yPos = y;
@@ -1057,6 +1193,7 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
 
       int combiningX = lastBaseX - raiseBy;
       int combiningY = lastBaseY - lastBaseAdvance / 2;
+      GFX_STATS_COUNT(glyphs);
       renderCharImpl<TextRotation::Rotated90CW>(*this, renderMode, font, cp, &combiningX, &combiningY, black, style);
       continue;
     }
@@ -1073,6 +1210,7 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
     lastBaseAdvance = glyph ? glyph->advanceX : 0;
     lastBaseTop = glyph ? glyph->top : 0;
 
+    GFX_STATS_COUNT(glyphs);
     renderCharImpl<TextRotation::Rotated90CW>(*this, renderMode, font, cp, &xPos, &yPos, black, style);
     prevCp = cp;
   }
@@ -1094,7 +1232,7 @@ void GfxRenderer::displayGrayBuffer() const { display.displayGrayBuffer(fadingFi
 void GfxRenderer::freeBwBufferChunks() {
   for (auto& bwBufferChunk : bwBufferChunks) {
     if (bwBufferChunk) {
-      free(bwBufferChunk);
+      HeapTags::release(bwBufferChunk);
       bwBufferChunk = nullptr;
     }
   }
@@ -1112,12 +1250,12 @@ bool GfxRenderer::storeBwBuffer() {
     // Check if any chunks are already allocated
     if (bwBufferChunks[i]) {
       LOG_ERR("GFX", "!! BW buffer chunk %zu already stored - this is likely a bug, freeing chunk", i);
-      free(bwBufferChunks[i]);
+      HeapTags::release(bwBufferChunks[i]);
       bwBufferChunks[i] = nullptr;
     }
 
     const size_t offset = i * BW_BUFFER_CHUNK_SIZE;
-    bwBufferChunks[i] = static_cast<uint8_t*>(malloc(BW_BUFFER_CHUNK_SIZE));
+    bwBufferChunks[i] = static_cast<uint8_t*>(HeapTags::allocate(BW_BUFFER_CHUNK_SIZE, HeapTag::Render));
 
     if (!bwBufferChunks[i]) {
       LOG_ERR("GFX", "!! Failed to allocate BW buffer chunk %zu (%zu bytes)", i, BW_BUFFER_CHUNK_SIZE);
@@ -1164,6 +1302,63 @@ void GfxRenderer::restoreBwBuffer() {
   LOG_DBG("GFX", "Restored and freed BW buffer chunks");
 }
 
+/**
+ * Copy the frame buffer into a spare frame, allocating its chunks on first use.
+ * Returns false (and frees the spare frame) if allocation fails.
+ */
+bool GfxRenderer::storeSpareFrame(const SpareFrame frame) {
+  uint8_t** chunks = spareFrameChunks[frame];
+  for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
+    if (!chunks[i]) {
+      chunks[i] = static_cast<uint8_t*>(HeapTags::allocate(BW_BUFFER_CHUNK_SIZE, HeapTag::Render));
+      if (!chunks[i]) {
+        LOG_DBG("GFX", "Not enough memory for spare frame %d", frame);
+        freeSpareFrame(frame);
+        return false;
+      }
+    }
+    memcpy(chunks[i], frameBuffer + i * BW_BUFFER_CHUNK_SIZE, BW_BUFFER_CHUNK_SIZE);
+  }
+  return true;
+}
+
+bool GfxRenderer::loadSpareFrame(const SpareFrame frame) {
+  if (!hasSpareFrame(frame)) {
+    return false;
+  }
+  for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
+    memcpy(frameBuffer + i * BW_BUFFER_CHUNK_SIZE, spareFrameChunks[frame][i], BW_BUFFER_CHUNK_SIZE);
+  }
+  return true;
+}
+
+// Chunks are all allocated or all freed, so the first one tells whether the frame is stored
+bool GfxRenderer::hasSpareFrame(const SpareFrame frame) const { return spareFrameChunks[frame][0] != nullptr; }
+
+bool GfxRenderer::readSpareFrame(const SpareFrame frame, size_t offset, uint8_t* out, size_t length) const {
+  if (!hasSpareFrame(frame) || offset + length > HalDisplay::BUFFER_SIZE) {
+    return false;
+  }
+  while (length > 0) {
+    const size_t within = offset % BW_BUFFER_CHUNK_SIZE;
+    const size_t n = std::min(length, BW_BUFFER_CHUNK_SIZE - within);
+    memcpy(out, spareFrameChunks[frame][offset / BW_BUFFER_CHUNK_SIZE] + within, n);
+    out += n;
+    offset += n;
+    length -= n;
+  }
+  return true;
+}
+
+void GfxRenderer::freeSpareFrame(const SpareFrame frame) {
+  for (auto& chunk : spareFrameChunks[frame]) {
+    if (chunk) {
+      HeapTags::release(chunk);
+      chunk = nullptr;
+    }
+  }
+}
+
 /**
  * Cleanup grayscale buffers using the current frame buffer.
  * Use this when BW buffer was re-rendered instead of stored/restored.
@@ -1176,6 +1371,7 @@ void GfxRenderer::cleanupGrayscaleWithFrameBuffer() const {
 
 void GfxRenderer::renderChar(const EpdFontFamily& fontFamily, uint32_t cp, int* x, int* y, bool pixelState,
                              EpdFontFamily::Style style) const {
+  GFX_STATS_COUNT(glyphs);
   renderCharImpl<TextRotation::None>(*this, renderMode, fontFamily, cp, x, y, pixelState, style);
 }
 
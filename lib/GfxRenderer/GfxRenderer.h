@@ -18,6 +18,11 @@ class GfxRenderer {
  public:
   enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB };
 
+  // Off-screen copies of the frame buffer, e.g. for pre-rendering the next page while idle
+  enum SpareFrame { SPARE_DISPLAYED, SPARE_GRAYSCALE_LSB, SPARE_GRAYSCALE_MSB, SPARE_FRAME_COUNT };
+  // Frame buffers, spare ones included, are allocated in pieces of this size
+  static constexpr size_t BW_BUFFER_CHUNK_SIZE = 8000;  // 8KB chunks to allow for non-contiguous memory
+
   // Logical screen orientation from the perspective of callers
   enum Orientation {
     Portrait,                  // 480x800 logical coordinates (current default)
@@ -27,7 +32,6 @@ class GfxRenderer {
   };
 
  private:
-  static constexpr size_t BW_BUFFER_CHUNK_SIZE = 8000;  // 8KB chunks to allow for non-contiguous memory
   static constexpr size_t BW_BUFFER_NUM_CHUNKS = HalDisplay::BUFFER_SIZE / BW_BUFFER_CHUNK_SIZE;
   static_assert(BW_BUFFER_CHUNK_SIZE * BW_BUFFER_NUM_CHUNKS == HalDisplay::BUFFER_SIZE,
                 "BW buffer chunking does not line up with display buffer size");
@@ -38,20 +42,34 @@ class GfxRenderer {
   bool fadingFix;
   uint8_t* frameBuffer = nullptr;
   uint8_t* bwBufferChunks[BW_BUFFER_NUM_CHUNKS] = {nullptr};
+  // Same chunking as the BW buffer so a spare frame never needs 48KB of contiguous memory
+  uint8_t* spareFrameChunks[SPARE_FRAME_COUNT][BW_BUFFER_NUM_CHUNKS] = {};
   std::map<int, EpdFontFamily> fontMap;
   FontDecompressor* fontDecompressor = nullptr;
+  const EpdFontFamily* (*fontResolver)(int fontId) = nullptr;
+  // Checksum of a frame put on the panel behind displayBuffer()'s back, see setPresentedFrame()
+  mutable uint32_t presentedFrameChecksum = 0;
+  mutable bool hasPresentedFrame = false;
+  const EpdFontFamily* findFont(int fontId) const;
   void renderChar(const EpdFontFamily& fontFamily, uint32_t cp, int* x, int* y, bool pixelState,
                   EpdFontFamily::Style style) const;
   void freeBwBufferChunks();
-  template <Color color>
-  void drawPixelDither(int x, int y) const;
-  template <Color color>
-  void fillArc(int maxRadius, int cx, int cy, int xDir, int yDir) const;
+  // Span fill engine: logical runs and boxes (inclusive ends, clipped to the screen) are mapped to a box on the panel
+  // and written a byte at a time with the color's dither pattern
+  void fillSpan(int x1, int x2, int y, Color color) const;
+  void fillBox(int left, int top, int right, int bottom, Color color) const;
+  void fillPhysicalBox(int left, int top, int right, int bottom, const uint8_t* pattern) const;
+  void fillArc(int maxRadius, int cx, int cy, int xDir, int yDir, Color color) const;
 
  public:
   explicit GfxRenderer(HalDisplay& halDisplay)
       : display(halDisplay), renderMode(BW), orientation(Portrait), fadingFix(false) {}
-  ~GfxRenderer() { freeBwBufferChunks(); }
+  ~GfxRenderer() {
+    freeBwBufferChunks();
+    for (int i = 0; i < SPARE_FRAME_COUNT; i++) {
+      freeSpareFrame(static_cast<SpareFrame>(i));
+    }
+  }
 
   static constexpr int VIEWABLE_MARGIN_TOP = 9;
   static constexpr int VIEWABLE_MARGIN_RIGHT = 3;
@@ -61,6 +79,9 @@ class GfxRenderer {
   // Setup
   void begin();  // must be called right after display.begin()
   void insertFont(int fontId, EpdFontFamily font);
+  // Called for font ids that were not inserted, so fonts can be resolved on first use instead of all being inserted
+  // at boot. Returns nullptr for unknown ids; the family must outlive the renderer.
+  void setFontResolver(const EpdFontFamily* (*resolver)(int fontId)) { fontResolver = resolver; }
   void setFontDecompressor(FontDecompressor* d) { fontDecompressor = d; }
   void clearFontCache() {
     if (fontDecompressor) fontDecompressor->clearCache();
@@ -77,6 +98,10 @@ class GfxRenderer {
   int getScreenWidth() const;
   int getScreenHeight() const;
   void displayBuffer(HalDisplay::RefreshMode refreshMode = HalDisplay::FAST_REFRESH) const;
+  // The panel already shows the frame with this checksum (e.g. the wake frame restored at boot). The next
+  // displayBuffer() skips the refresh if the frame buffer still holds exactly that frame.
+  void setPresentedFrame(uint32_t checksum);
+  static uint32_t frameChecksum(const uint8_t* buffer);
   // EXPERIMENTAL: Windowed update - display only a rectangular region
   // void displayWindow(int x, int y, int width, int height) const;
   void invertScreen() const;
@@ -143,10 +168,35 @@ class GfxRenderer {
   void restoreBwBuffer();  // Restore and free the stored buffer
   void cleanupGrayscaleWithFrameBuffer() const;
 
+  // Spare frames
+  bool storeSpareFrame(SpareFrame frame);  // Copy the frame buffer into `frame`, allocating it if needed
+  bool loadSpareFrame(SpareFrame frame);   // Copy a stored `frame` back into the frame buffer; keeps the copy
+  bool hasSpareFrame(SpareFrame frame) const;
+  // Copy `length` bytes at `offset` of a stored `frame` into `out`, e.g. to save it without loading it
+  bool readSpareFrame(SpareFrame frame, size_t offset, uint8_t* out, size_t length) const;
+  void freeSpareFrame(SpareFrame frame);
+
   // Font helpers
   const uint8_t* getGlyphBitmap(const EpdFontData* fontData, const EpdGlyph* glyph) const;
 
   // Low level functions
   uint8_t* getFrameBuffer() const;
   static size_t getBufferSize();
+
+#ifdef GFX_RENDER_STATS
+  // Draw counters for the host render harness (test/run_render.sh); not part of firmware builds
+  struct Stats {
+    uint32_t calls;   // Drawing calls, not counting those made by other drawing calls
+    uint32_t glyphs;  // Glyphs rendered
+    uint32_t pixels;  // Pixels drawn one at a time through drawPixel
+    uint32_t spans;   // Runs and boxes filled a byte at a time
+  };
+  const Stats& getStats() const { return stats; }
+  void resetStats() { stats = {}; }
+
+ private:
+  class StatsScope;
+  mutable Stats stats = {};
+  mutable int statsDepth = 0;
+#endif
 };
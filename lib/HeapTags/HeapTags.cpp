@@ -0,0 +1,217 @@
+#include "HeapTags.h"
+
+#include <Logging.h>
+
+#include <cassert>
+#include <cstdlib>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+
+namespace {
+portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
+
+uint32_t nowMs() { return millis(); }
+
+class EspBackend final : public HeapTags::Backend {
+ public:
+  void* allocate(const size_t size) override { return malloc(size); }
+  void release(void* block) override { free(block); }
+  size_t freeBytes() const override { return ESP.getFreeHeap(); }
+  size_t largestFreeBlock() const override { return ESP.getMaxAllocHeap(); }
+};
+EspBackend espBackend;
+HeapTags::Backend* backend = &espBackend;
+}  // namespace
+#define HEAP_TAGS_LOCK() portENTER_CRITICAL(&statsMux)
+#define HEAP_TAGS_UNLOCK() portEXIT_CRITICAL(&statsMux)
+#else
+#include <chrono>
+#include <mutex>
+
+namespace {
+std::mutex statsMutex;
+
+uint32_t nowMs() {
+  return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                   std::chrono::steady_clock::now().time_since_epoch())
+                                   .count());
+}
+
+// Knows nothing about the free heap
+class MallocBackend final : public HeapTags::Backend {
+ public:
+  void* allocate(const size_t size) override { return malloc(size); }
+  void release(void* block) override { free(block); }
+  size_t freeBytes() const override { return 0; }
+  size_t largestFreeBlock() const override { return 0; }
+};
+MallocBackend mallocBackend;
+HeapTags::Backend* backend = &mallocBackend;
+}  // namespace
+#define HEAP_TAGS_LOCK() statsMutex.lock()
+#define HEAP_TAGS_UNLOCK() statsMutex.unlock()
+#endif
+
+namespace {
+constexpr size_t TAG_COUNT = static_cast<size_t>(HeapTag::Count);
+constexpr uint16_t BLOCK_MAGIC = 0x4854;
+
+// In front of every block; 8 bytes so the caller's block keeps malloc's alignment
+struct BlockHeader {
+  uint32_t size;
+  uint16_t magic;
+  HeapTag tag;
+  uint8_t reserved;
+};
+static_assert(sizeof(BlockHeader) == 8, "BlockHeader must keep the block 8-byte aligned");
+
+constexpr const char* TAG_NAMES[TAG_COUNT] = {"untagged", "activity",     "fontCache", "sectionBuild",
+                                              "css",      "imageDecode", "render",    "webServer"};
+
+thread_local HeapTag currentTag = HeapTag::Untagged;
+
+HeapTags::TagStats tagStats[TAG_COUNT];
+HeapTags::Sample samples[HeapTags::HISTORY_SIZE];
+size_t sampleCount = 0;  // Samples ever taken
+HeapTags::Failure failure;
+bool hasFailure = false;
+
+size_t tagIndex(const HeapTag tag) {
+  const auto index = static_cast<size_t>(tag);
+  return index < TAG_COUNT ? index : 0;
+}
+}  // namespace
+
+HeapTagScope::HeapTagScope(const HeapTag tag) : previous(currentTag) { currentTag = tag; }
+
+HeapTagScope::~HeapTagScope() { currentTag = previous; }
+
+namespace HeapTags {
+#ifndef ARDUINO
+void setBackend(Backend* newBackend) { backend = newBackend ? newBackend : &mallocBackend; }
+
+void reset() {
+  HEAP_TAGS_LOCK();
+  for (auto& entry : tagStats) {
+    entry = {};
+  }
+  sampleCount = 0;
+  hasFailure = false;
+  HEAP_TAGS_UNLOCK();
+}
+#endif
+
+HeapTag current() { return currentTag; }
+
+void* allocate(const size_t size, const HeapTag tag) {
+  const size_t index = tagIndex(tag);
+  auto* header = size <= UINT32_MAX - sizeof(BlockHeader)
+                     ? static_cast<BlockHeader*>(backend->allocate(sizeof(BlockHeader) + size))
+                     : nullptr;
+
+  if (!header) {
+    const auto available = static_cast<uint32_t>(backend->freeBytes());
+    const auto largest = static_cast<uint32_t>(backend->largestFreeBlock());
+    HEAP_TAGS_LOCK();
+    tagStats[index].failures++;
+    [[maybe_unused]] const uint32_t held = tagStats[index].liveBytes;
+    failure = {nowMs(), static_cast<HeapTag>(index), static_cast<uint32_t>(size), available, largest};
+    hasFailure = true;
+    HEAP_TAGS_UNLOCK();
+    LOG_ERR("HEAP", "%s: %u bytes failed (free %u, largest block %u, %s holds %u)", TAG_NAMES[index],
+            static_cast<unsigned>(size), available, largest, TAG_NAMES[index], held);
+    return nullptr;
+  }
+
+  header->size = static_cast<uint32_t>(size);
+  header->magic = BLOCK_MAGIC;
+  header->tag = static_cast<HeapTag>(index);
+  header->reserved = 0;
+  HEAP_TAGS_LOCK();
+  TagStats& entry = tagStats[index];
+  entry.liveBytes += header->size;
+  entry.allocations++;
+  if (entry.liveBytes > entry.peakBytes) {
+    entry.peakBytes = entry.liveBytes;
+  }
+  HEAP_TAGS_UNLOCK();
+  return header + 1;
+}
+
+void release(void* block) {
+  if (!block) {
+    return;
+  }
+  auto* header = static_cast<BlockHeader*>(block) - 1;
+  assert(header->magic == BLOCK_MAGIC && "Block was not allocated by HeapTags::allocate");
+  header->magic = 0;
+  HEAP_TAGS_LOCK();
+  tagStats[tagIndex(header->tag)].liveBytes -= header->size;
+  HEAP_TAGS_UNLOCK();
+  backend->release(header);
+}
+
+const char* name(const HeapTag tag) { return TAG_NAMES[tagIndex(tag)]; }
+
+TagStats stats(const HeapTag tag) {
+  HEAP_TAGS_LOCK();
+  const TagStats copy = tagStats[tagIndex(tag)];
+  HEAP_TAGS_UNLOCK();
+  return copy;
+}
+
+size_t freeBytes() { return backend->freeBytes(); }
+
+size_t largestFreeBlock() { return backend->largestFreeBlock(); }
+
+void sample(const uint32_t nowMs) {
+  const Sample entry{nowMs, static_cast<uint32_t>(backend->freeBytes()),
+                     static_cast<uint32_t>(backend->largestFreeBlock())};
+  HEAP_TAGS_LOCK();
+  samples[sampleCount % HISTORY_SIZE] = entry;
+  sampleCount++;
+  HEAP_TAGS_UNLOCK();
+}
+
+size_t history(Sample* out, const size_t maxSamples) {
+  HEAP_TAGS_LOCK();
+  const size_t available = sampleCount < HISTORY_SIZE ? sampleCount : HISTORY_SIZE;
+  const size_t count = available < maxSamples ? available : maxSamples;
+  // The newest `count` samples, oldest first
+  for (size_t i = 0; i < count; i++) {
+    out[i] = samples[(sampleCount - count + i) % HISTORY_SIZE];
+  }
+  HEAP_TAGS_UNLOCK();
+  return count;
+}
+
+bool lastFailure(Failure& out) {
+  HEAP_TAGS_LOCK();
+  const bool found = hasFailure;
+  if (found) {
+    out = failure;
+  }
+  HEAP_TAGS_UNLOCK();
+  return found;
+}
+
+void logSummary() {
+  LOG_INF("HEAP", "Free %u bytes, largest block %u bytes", static_cast<unsigned>(freeBytes()),
+          static_cast<unsigned>(largestFreeBlock()));
+  for (size_t i = 0; i < TAG_COUNT; i++) {
+    const TagStats entry = stats(static_cast<HeapTag>(i));
+    if (entry.allocations == 0 && entry.failures == 0) {
+      continue;
+    }
+    LOG_INF("HEAP", "%-12s live %6u peak %6u allocs %5u failed %u", TAG_NAMES[i], entry.liveBytes, entry.peakBytes,
+            entry.allocations, entry.failures);
+  }
+  Failure last;
+  if (lastFailure(last)) {
+    LOG_INF("HEAP", "Last failure at %u ms: %s wanted %u bytes, largest block was %u of %u free", last.atMs,
+            name(last.tag), last.requested, last.largestFreeBlock, last.freeBytes);
+  }
+}
+}  // namespace HeapTags
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Which subsystem a heap buffer belongs to. Buffers allocated through HeapTags are counted against their tag, so a
+// failed allocation can be explained by who was holding the memory at the time.
+enum class HeapTag : uint8_t {
+  Untagged,
+  Activity,      // Activity state and per-screen buffers
+  FontCache,     // Decompressed glyph groups
+  SectionBuild,  // Laying out a chapter into its section cache
+  Css,           // Parsing stylesheets
+  ImageDecode,   // PNG/JPEG decoders and their pixel caches
+  Render,        // Renderer scratch, e.g. the BW buffer backup for grayscale
+  WebServer,     // Uploads and file responses
+  Count
+};
+
+/**
+ * Tagged heap accounting.
+ *
+ * allocate()/release() wrap malloc/free with an 8-byte header recording the size and tag of each block, and keep live
+ * bytes, peak bytes, allocation and failure counts per tag. The tag is either given or taken from the innermost
+ * HeapTagScope on the calling task, so shared code (ZIP inflate buffers, BufferedFile) is counted against whoever
+ * called it. Only buffers allocated here are counted; the rest of the heap shows up in freeBytes().
+ *
+ * sample() records free heap and largest free block into a short history, which together with the last failed
+ * allocation tells fragmentation apart from exhaustion.
+ */
+namespace HeapTags {
+struct TagStats {
+  uint32_t liveBytes;
+  uint32_t peakBytes;
+  uint32_t allocations;  // Since boot
+  uint32_t failures;
+};
+
+struct Sample {
+  uint32_t atMs;
+  uint32_t freeBytes;
+  uint32_t largestFreeBlock;
+};
+
+struct Failure {
+  uint32_t atMs;
+  HeapTag tag;
+  uint32_t requested;
+  uint32_t freeBytes;
+  uint32_t largestFreeBlock;
+};
+
+constexpr size_t HISTORY_SIZE = 16;
+
+// The heap underneath. The firmware uses the ESP heap; host builds default to malloc and can account against a fake
+// heap instead.
+class Backend {
+ public:
+  virtual ~Backend() = default;
+  virtual void* allocate(size_t size) = 0;
+  virtual void release(void* block) = 0;
+  virtual size_t freeBytes() const = 0;
+  virtual size_t largestFreeBlock() const = 0;
+};
+#ifndef ARDUINO
+void setBackend(Backend* backend);  // nullptr restores malloc
+void reset();                       // Clears all statistics
+#endif
+
+HeapTag current();
+// nullptr when the heap cannot satisfy the request; the failure is counted and logged
+void* allocate(size_t size, HeapTag tag = current());
+// Accepts nullptr. `block` must come from allocate().
+void release(void* block);
+
+const char* name(HeapTag tag);
+TagStats stats(HeapTag tag);
+size_t freeBytes();
+size_t largestFreeBlock();
+
+void sample(uint32_t nowMs);
+// Copies up to `maxSamples` samples, oldest first; returns how many
+size_t history(Sample* out, size_t maxSamples);
+// False if no allocation has failed since boot
+bool lastFailure(Failure& out);
+// Logs the heap and every tag that has allocated anything
+void logSummary();
+}  // namespace HeapTags
+
+// Sets the tag for allocations made by this task until the scope ends; scopes nest
+class HeapTagScope {
+  HeapTag previous;
+
+ public:
+  explicit HeapTagScope(HeapTag tag);
+  ~HeapTagScope();
+  HeapTagScope(const HeapTagScope&) = delete;
+  HeapTagScope& operator=(const HeapTagScope&) = delete;
+};
@@ -1,5 +1,7 @@
 #include "InflateReader.h"
 
+#include <HeapTags.h>
+
 #include <cstring>
 #include <type_traits>
 
@@ -17,7 +19,7 @@ bool InflateReader::init(const bool streaming) {
   deinit();  // free any previously allocated ring buffer and reset state
 
   if (streaming) {
-    ringBuffer = static_cast<uint8_t*>(malloc(INFLATE_DICT_SIZE));
+    ringBuffer = static_cast<uint8_t*>(HeapTags::allocate(INFLATE_DICT_SIZE));  // Counted against the caller
     if (!ringBuffer) return false;
     memset(ringBuffer, 0, INFLATE_DICT_SIZE);
   }
@@ -28,7 +30,7 @@ bool InflateReader::init(const bool streaming) {
 
 void InflateReader::deinit() {
   if (ringBuffer) {
-    free(ringBuffer);
+    HeapTags::release(ringBuffer);
     ringBuffer = nullptr;
   }
   memset(&decomp, 0, sizeof(decomp));
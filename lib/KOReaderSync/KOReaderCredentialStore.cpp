@@ -34,12 +34,15 @@ void legacyDeobfuscate(std::string& data) {
 }
 }  // namespace
 
-bool KOReaderCredentialStore::saveToFile() const {
+bool KOReaderCredentialStore::saveToFile() {
+  // Never write the defaults over credentials that were not read yet
+  ensureLoaded();
   Storage.mkdir("/.crosspoint");
   return JsonSettingsIO::saveKOReader(*this, KOREADER_FILE_JSON);
 }
 
 bool KOReaderCredentialStore::loadFromFile() {
+  loaded = true;
   // Try JSON first
   if (Storage.exists(KOREADER_FILE_JSON)) {
     String json = Storage.readFile(KOREADER_FILE_JSON);
@@ -119,12 +122,14 @@ bool KOReaderCredentialStore::loadFromBinaryFile() {
 }
 
 void KOReaderCredentialStore::setCredentials(const std::string& user, const std::string& pass) {
+  ensureLoaded();
   username = user;
   password = pass;
   LOG_DBG("KRS", "Set credentials for user: %s", user.c_str());
 }
 
-std::string KOReaderCredentialStore::getMd5Password() const {
+std::string KOReaderCredentialStore::getMd5Password() {
+  ensureLoaded();
   if (password.empty()) {
     return "";
   }
@@ -138,9 +143,13 @@ std::string KOReaderCredentialStore::getMd5Password() const {
   return md5.toString().c_str();
 }
 
-bool KOReaderCredentialStore::hasCredentials() const { return !username.empty() && !password.empty(); }
+bool KOReaderCredentialStore::hasCredentials() {
+  ensureLoaded();
+  return !username.empty() && !password.empty();
+}
 
 void KOReaderCredentialStore::clearCredentials() {
+  ensureLoaded();
   username.clear();
   password.clear();
   saveToFile();
@@ -148,11 +157,13 @@ void KOReaderCredentialStore::clearCredentials() {
 }
 
 void KOReaderCredentialStore::setServerUrl(const std::string& url) {
+  ensureLoaded();
   serverUrl = url;
   LOG_DBG("KRS", "Set server URL: %s", url.empty() ? "(default)" : url.c_str());
 }
 
-std::string KOReaderCredentialStore::getBaseUrl() const {
+std::string KOReaderCredentialStore::getBaseUrl() {
+  ensureLoaded();
   if (serverUrl.empty()) {
     return DEFAULT_SERVER_URL;
   }
@@ -166,6 +177,7 @@ std::string KOReaderCredentialStore::getBaseUrl() const {
 }
 
 void KOReaderCredentialStore::setMatchMethod(DocumentMatchMethod method) {
+  ensureLoaded();
   matchMethod = method;
   LOG_DBG("KRS", "Set match method: %s", method == DocumentMatchMethod::FILENAME ? "Filename" : "Binary");
 }
@@ -27,11 +27,19 @@ class KOReaderCredentialStore {
   std::string password;
   std::string serverUrl;                                            // Custom sync server URL (empty = default)
   DocumentMatchMethod matchMethod = DocumentMatchMethod::FILENAME;  // Default to filename for compatibility
+  bool loaded = false;
 
   // Private constructor for singleton
   KOReaderCredentialStore() = default;
 
   bool loadFromBinaryFile();
+  // The credentials are only needed for syncing, so the file is read (and the password deobfuscated) on first use
+  // rather than at boot. Every getter may load, so none of them is const.
+  void ensureLoaded() {
+    if (!loaded) {
+      loadFromFile();
+    }
+  }
 
   friend bool JsonSettingsIO::saveKOReader(const KOReaderCredentialStore&, const char*);
   friend bool JsonSettingsIO::loadKOReader(KOReaderCredentialStore&, const char*, bool*);
@@ -45,33 +53,45 @@ class KOReaderCredentialStore {
   static KOReaderCredentialStore& getInstance() { return instance; }
 
   // Save/load from SD card
-  bool saveToFile() const;
+  bool saveToFile();
   bool loadFromFile();
 
   // Credential management
   void setCredentials(const std::string& user, const std::string& pass);
-  const std::string& getUsername() const { return username; }
-  const std::string& getPassword() const { return password; }
+  const std::string& getUsername() {
+    ensureLoaded();
+    return username;
+  }
+  const std::string& getPassword() {
+    ensureLoaded();
+    return password;
+  }
 
   // Get MD5 hash of password for API authentication
-  std::string getMd5Password() const;
+  std::string getMd5Password();
 
   // Check if credentials are set
-  bool hasCredentials() const;
+  bool hasCredentials();
 
   // Clear credentials
   void clearCredentials();
 
   // Server URL management
   void setServerUrl(const std::string& url);
-  const std::string& getServerUrl() const { return serverUrl; }
+  const std::string& getServerUrl() {
+    ensureLoaded();
+    return serverUrl;
+  }
 
   // Get base URL for API calls (with http:// normalization if no protocol, falls back to default)
-  std::string getBaseUrl() const;
+  std::string getBaseUrl();
 
   // Document matching method
   void setMatchMethod(DocumentMatchMethod method);
-  DocumentMatchMethod getMatchMethod() const { return matchMethod; }
+  DocumentMatchMethod getMatchMethod() {
+    ensureLoaded();
+    return matchMethod;
+  }
 };
 
 // Helper macro to access credential store
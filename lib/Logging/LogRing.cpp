@@ -0,0 +1,253 @@
+#include "LogRing.h"
+
+#include <cstdio>
+
+#ifdef ARDUINO
+#include <freertos/FreeRTOS.h>
+
+namespace {
+portMUX_TYPE reserveMux = portMUX_INITIALIZER_UNLOCKED;
+}  // namespace
+#define LOG_RING_LOCK() portENTER_CRITICAL(&reserveMux)
+#define LOG_RING_UNLOCK() portEXIT_CRITICAL(&reserveMux)
+#else
+#include <thread>
+
+// Host builds (tests): a spinlock that yields, since the holder may be preempted unlike in a critical section
+namespace {
+std::atomic_flag reserveFlag = ATOMIC_FLAG_INIT;
+}  // namespace
+#define LOG_RING_LOCK()                                         \
+  while (reserveFlag.test_and_set(std::memory_order_acquire)) { \
+    std::this_thread::yield();                                  \
+  }
+#define LOG_RING_UNLOCK() reserveFlag.clear(std::memory_order_release)
+#endif
+
+uint8_t* LogRing::reserve(const size_t argsSize) {
+  const auto size = static_cast<uint32_t>((sizeof(Header) + argsSize + ALIGN - 1) & ~(ALIGN - 1));
+  uint8_t* record = nullptr;
+
+  LOG_RING_LOCK();
+  const uint32_t reserved = head.load(std::memory_order_relaxed);
+  const uint32_t contiguous = capacity - (reserved & (capacity - 1));
+  // A record never wraps; the end of the ring is skipped instead
+  const uint32_t needed = size <= contiguous ? size : contiguous + size;
+  if (reserved + needed - tail.load(std::memory_order_acquire) <= capacity) {
+    if (size > contiguous) {
+      at(reserved)->size.store(contiguous | PADDING, std::memory_order_release);
+    }
+    record = storage + ((reserved + needed - size) & (capacity - 1));
+    head.store(reserved + needed, std::memory_order_release);
+  } else {
+    dropped++;
+  }
+  LOG_RING_UNLOCK();
+  return record;
+}
+
+void LogRing::publish(uint8_t* record, const uint32_t timestamp, const LogSite* site, const uint32_t types,
+                      const size_t argsSize) {
+  auto* header = reinterpret_cast<Header*>(record);
+  header->timestamp = timestamp;
+  header->site = site;
+  header->types = types;
+  header->argsSize = static_cast<uint32_t>(argsSize);
+  header->size.store(static_cast<uint32_t>((sizeof(Header) + argsSize + ALIGN - 1) & ~(ALIGN - 1)),
+                     std::memory_order_release);
+}
+
+bool LogRing::read(Record& record) {
+  while (true) {
+    const uint32_t position = tail.load(std::memory_order_relaxed);
+    if (position == head.load(std::memory_order_acquire)) {
+      return false;
+    }
+    Header* header = at(position);
+    const uint32_t size = header->size.load(std::memory_order_acquire);
+    if (size == 0) {
+      return false;  // Reserved but not published yet
+    }
+    if (size & PADDING) {
+      memset(static_cast<void*>(header), 0, size & ~PADDING);
+      tail.store(position + (size & ~PADDING), std::memory_order_release);
+      continue;
+    }
+    record.timestamp = header->timestamp;
+    record.site = header->site;
+    record.types = header->types;
+    record.args = reinterpret_cast<const uint8_t*>(header) + sizeof(Header);
+    record.argsSize = header->argsSize;
+    readSize = size;
+    return true;
+  }
+}
+
+void LogRing::release() {
+  const uint32_t position = tail.load(std::memory_order_relaxed);
+  memset(static_cast<void*>(at(position)), 0, readSize);
+  tail.store(position + readSize, std::memory_order_release);
+  readSize = 0;
+}
+
+uint32_t LogRing::takeDropped() {
+  LOG_RING_LOCK();
+  const uint32_t count = dropped;
+  dropped = 0;
+  LOG_RING_UNLOCK();
+  return count;
+}
+
+namespace {
+constexpr char ELLIPSIS[] = "\xE2\x80\xA6";  // "…" in UTF-8
+
+// Next argument of the record, consumed in order
+class ArgReader {
+  const LogRing::Record& record;
+  size_t offset = 0;
+  uint32_t index = 0;
+
+ public:
+  explicit ArgReader(const LogRing::Record& record) : record(record) {}
+
+  LogRing::ArgType nextType() const {
+    return index < LogRing::MAX_ARGS ? static_cast<LogRing::ArgType>(record.types >> (3 * index) & 7u)
+                                     : static_cast<LogRing::ArgType>(0);
+  }
+
+  uint64_t integer() {
+    const LogRing::ArgType type = nextType();
+    const size_t size = type == LogRing::Int64 || type == LogRing::Double ? 8
+                        : type == LogRing::Pointer                        ? sizeof(uintptr_t)
+                                                                          : 4;
+    uint64_t value = 0;
+    if (offset + size <= record.argsSize) {
+      memcpy(&value, record.args + offset, size);
+    }
+    offset += size;
+    index++;
+    return value;
+  }
+
+  double real() {
+    const uint64_t bits = integer();
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  // Copies the string argument into `out`
+  // Copies the next string into `out`, marking one that was cut when recorded with a trailing "…"
+  void string(char* out, const size_t size) {
+    const uint8_t lengthByte = offset < record.argsSize ? record.args[offset] : 0;
+    size_t length = lengthByte & ~LogRing::STRING_CUT;
+    offset++;
+    const size_t available = offset < record.argsSize ? record.argsSize - offset : 0;
+    length = length < available ? length : available;
+    const size_t copied = length < size - 1 ? length : size - 1;
+    memcpy(out, record.args + offset, copied);
+    out[copied] = '\0';
+    if ((lengthByte & LogRing::STRING_CUT) && copied + sizeof(ELLIPSIS) <= size) {
+      memcpy(out + copied, ELLIPSIS, sizeof(ELLIPSIS));
+    }
+    offset += length;
+    index++;
+  }
+};
+
+bool isFlagOrDigit(const char c) {
+  return c == '-' || c == '+' || c == ' ' || c == '#' || c == '.' || (c >= '0' && c <= '9');
+}
+}  // namespace
+
+// Walks the format and hands each conversion to snprintf with the argument's recorded type, so length modifiers
+// in the format (%lu, %zu, %lld) are replaced by the ones matching what was actually stored.
+size_t formatLogMessage(const LogRing::Record& record, char* out, const size_t size) {
+  if (size == 0) {
+    return 0;
+  }
+  ArgReader args(record);
+  size_t length = 0;
+  const auto room = [&] { return size - length; };
+  const char* f = record.site->format;
+
+  while (*f && length + 1 < size) {
+    if (*f != '%') {
+      out[length++] = *f++;
+      continue;
+    }
+    if (f[1] == '%') {
+      out[length++] = '%';
+      f += 2;
+      continue;
+    }
+
+    // Copy flags, width and precision, resolving '*' from the arguments
+    char spec[32] = "%";
+    size_t specLength = 1;
+    const char* p = f + 1;
+    while ((isFlagOrDigit(*p) || *p == '*') && specLength < sizeof(spec) - 16) {
+      if (*p == '*') {
+        specLength += snprintf(spec + specLength, sizeof(spec) - specLength, "%d",
+                               static_cast<int>(static_cast<int32_t>(args.integer())));
+      } else {
+        spec[specLength++] = *p;
+      }
+      p++;
+    }
+    while (*p == 'h' || *p == 'l' || *p == 'L' || *p == 'z' || *p == 'j' || *p == 't' || *p == 'q') {
+      p++;
+    }
+    const char conversion = *p;
+    if (conversion == '\0') {
+      break;
+    }
+    f = p + 1;
+
+    const LogRing::ArgType type = args.nextType();
+    int written = 0;
+    if (type == 0) {
+      // More conversions than arguments
+      written = snprintf(out + length, room(), "%%%c", conversion);
+    } else if (type == LogRing::String) {
+      char value[LogRing::MAX_STRING + sizeof(ELLIPSIS)];
+      args.string(value, sizeof(value));
+      spec[specLength++] = 's';
+      spec[specLength] = '\0';
+      written = snprintf(out + length, room(), spec, value);
+    } else if (type == LogRing::Double) {
+      const bool isFloatConversion = strchr("fFeEgGaA", conversion) != nullptr;
+      spec[specLength++] = isFloatConversion ? conversion : 'f';
+      spec[specLength] = '\0';
+      written = snprintf(out + length, room(), spec, args.real());
+    } else if (type == LogRing::Pointer && conversion == 'p') {
+      spec[specLength++] = 'p';
+      spec[specLength] = '\0';
+      written = snprintf(out + length, room(), spec, reinterpret_cast<void*>(static_cast<uintptr_t>(args.integer())));
+    } else {
+      const bool isIntConversion = strchr("diouxXc", conversion) != nullptr;
+      const char c = isIntConversion ? conversion : 'u';
+      const bool wide = type == LogRing::Int64 || (type == LogRing::Pointer && sizeof(uintptr_t) > 4);
+      const uint64_t value = args.integer();
+      if (wide) {
+        spec[specLength++] = 'l';
+        spec[specLength++] = 'l';
+      }
+      spec[specLength++] = c;
+      spec[specLength] = '\0';
+      if (c == 'd' || c == 'i') {
+        written = wide ? snprintf(out + length, room(), spec, static_cast<long long>(value))
+                       : snprintf(out + length, room(), spec, static_cast<int>(static_cast<int32_t>(value)));
+      } else {
+        written = wide ? snprintf(out + length, room(), spec, static_cast<unsigned long long>(value))
+                       : snprintf(out + length, room(), spec, static_cast<unsigned>(value));
+      }
+    }
+    if (written < 0) {
+      break;
+    }
+    length += static_cast<size_t>(written) < room() ? static_cast<size_t>(written) : room() - 1;
+  }
+  out[length] = '\0';
+  return length;
+}
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// Everything about a LOG_* call site that is the same on every call. Records point at it, so logging copies only the
+// timestamp and the arguments, and the message is formatted later by whoever drains the ring.
+struct LogSite {
+  char level;  // 'E', 'I' or 'D'
+  const char* origin;
+  const char* format;
+};
+
+// Ring of deferred log records: (timestamp, site, raw arguments). Any task may write; one consumer reads.
+//
+// A writer reserves its space in a critical section of a few instructions (the ESP32-C3 has no atomic
+// read-modify-write), copies the arguments outside it, and publishes the record by storing its size last. The reader
+// takes records in order, stops at the first one still being written, and zeroes what it consumed so a record header
+// reads 0 until it is published. When the ring is full the record is dropped and counted.
+class LogRing {
+ public:
+  enum ArgType : uint8_t { Int32 = 1, Int64 = 2, Double = 3, String = 4, Pointer = 5 };
+  static constexpr size_t MAX_ARGS = 10;    // Types are packed 3 bits each into a uint32_t
+  static constexpr size_t MAX_STRING = 95;  // Longer %s arguments are cut, and print with a trailing "…"
+  static constexpr uint8_t STRING_CUT = 0x80;  // Set in a string's length byte when it was cut
+  static_assert(MAX_STRING < STRING_CUT, "String lengths must leave the cut bit free");
+
+  struct Record {
+    uint32_t timestamp;
+    const LogSite* site;
+    uint32_t types;  // ArgType of argument i in bits 3i..3i+2
+    const uint8_t* args;
+    size_t argsSize;
+  };
+
+ private:
+  struct Header {
+    std::atomic<uint32_t> size;  // Bytes including this header, or 0 while being written; PADDING skips to the start
+    uint32_t timestamp;
+    const LogSite* site;
+    uint32_t types;
+    uint32_t argsSize;
+  };
+  static constexpr uint32_t PADDING = 0x80000000u;
+  static constexpr size_t ALIGN = alignof(Header);
+
+  uint8_t* storage;
+  uint32_t capacity;
+  std::atomic<uint32_t> head{0};  // Bytes ever reserved
+  std::atomic<uint32_t> tail{0};  // Bytes ever consumed
+  uint32_t dropped = 0;
+  uint32_t readSize = 0;  // Size of the record read() returned, until release()
+
+  Header* at(uint32_t position) const { return reinterpret_cast<Header*>(storage + (position & (capacity - 1))); }
+  uint8_t* reserve(size_t argsSize);
+  static void publish(uint8_t* record, uint32_t timestamp, const LogSite* site, uint32_t types, size_t argsSize);
+
+  template <typename T>
+  static const char* stringArg(const T* s) {
+    return s ? reinterpret_cast<const char*>(s) : "(null)";
+  }
+
+  // Length of `s` as recorded: at most MAX_STRING bytes, backed off to a UTF-8 character boundary when cut
+  static size_t storedLength(const char* s) {
+    size_t length = strnlen(s, MAX_STRING + 1);
+    if (length > MAX_STRING) {
+      length = MAX_STRING;
+      while (length > 0 && (static_cast<uint8_t>(s[length]) & 0xC0) == 0x80) {
+        length--;
+      }
+    }
+    return length;
+  }
+
+  template <typename T>
+  static size_t argSize(const T& arg) {
+    constexpr ArgType type = argType<T>();
+    if constexpr (type == String) {
+      return 1 + storedLength(stringArg(arg));
+    } else if constexpr (type == Pointer) {
+      return sizeof(uintptr_t);
+    } else if constexpr (type == Int64 || type == Double) {
+      return 8;
+    } else {
+      return 4;
+    }
+  }
+
+  template <typename T>
+  static void putArg(uint8_t*& out, const T& arg) {
+    constexpr ArgType type = argType<T>();
+    if constexpr (type == String) {
+      const char* s = stringArg(arg);
+      const size_t length = storedLength(s);
+      *out++ = static_cast<uint8_t>(length | (s[length] ? STRING_CUT : 0));
+      memcpy(out, s, length);
+      out += length;
+    } else if constexpr (type == Pointer) {
+      const auto value = reinterpret_cast<uintptr_t>(arg);
+      memcpy(out, &value, sizeof(value));
+      out += sizeof(value);
+    } else if constexpr (type == Double) {
+      const double value = arg;
+      memcpy(out, &value, sizeof(value));
+      out += sizeof(value);
+    } else if constexpr (type == Int64) {
+      const auto value = static_cast<uint64_t>(arg);
+      memcpy(out, &value, sizeof(value));
+      out += sizeof(value);
+    } else {
+      const auto value = static_cast<uint32_t>(arg);
+      memcpy(out, &value, sizeof(value));
+      out += sizeof(value);
+    }
+  }
+
+ public:
+  // `storage` is aligned for pointers and zeroed; `size` is a power of two
+  constexpr LogRing(uint8_t* storage, size_t size) : storage(storage), capacity(static_cast<uint32_t>(size)) {}
+
+  template <typename T>
+  static constexpr ArgType argType() {
+    using D = std::decay_t<T>;
+    using Pointee = std::remove_cv_t<std::remove_pointer_t<D>>;
+    if constexpr (std::is_pointer_v<D> && (std::is_same_v<Pointee, char> || std::is_same_v<Pointee, unsigned char> ||
+                                           std::is_same_v<Pointee, signed char>)) {
+      return String;
+    } else if constexpr (std::is_pointer_v<D> || std::is_null_pointer_v<D>) {
+      return Pointer;
+    } else if constexpr (std::is_floating_point_v<D>) {
+      return Double;
+    } else {
+      static_assert(std::is_integral_v<D> || std::is_enum_v<D>,
+                    "LOG_* arguments must be numbers, pointers or C strings");
+      return sizeof(D) > 4 ? Int64 : Int32;
+    }
+  }
+
+  template <typename... Args>
+  static constexpr uint32_t packTypes() {
+    static_assert(sizeof...(Args) <= MAX_ARGS, "Too many LOG_* arguments");
+    uint32_t types = 0;
+    uint32_t shift = 0;
+    ((types |= static_cast<uint32_t>(argType<Args>()) << shift, shift += 3), ...);
+    return types;
+  }
+
+  // Records the call; false when the ring is full
+  template <typename... Args>
+  bool write(const uint32_t timestamp, const LogSite* site, const Args&... args) {
+    const size_t argsSize = (size_t{0} + ... + argSize(args));
+    uint8_t* const record = reserve(argsSize);
+    if (!record) {
+      return false;
+    }
+    [[maybe_unused]] uint8_t* out = record + sizeof(Header);
+    (putArg(out, args), ...);
+    publish(record, timestamp, site, packTypes<Args...>(), argsSize);
+    return true;
+  }
+
+  // Oldest published record, valid until release(). False when there is none.
+  bool read(Record& record);
+  void release();
+  // Records dropped since the last call
+  uint32_t takeDropped();
+};
+
+// Formats the record's message as printf would have, into `out` (always null-terminated). Returns its length.
+size_t formatLogMessage(const LogRing::Record& record, char* out, size_t size);
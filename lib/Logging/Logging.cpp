@@ -45,3 +45,203 @@ void logPrintf(const char* level, const char* origin, const char* format, ...) {
   va_end(args);
   logSerial.print(buf);
 }
+
+#if defined(ENABLE_SERIAL_LOG) && LOG_DEFERRED
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#ifndef LOG_RING_SIZE
+#define LOG_RING_SIZE 8192
+#endif
+
+namespace {
+alignas(8) uint8_t ringStorage[LOG_RING_SIZE];
+
+constexpr uint32_t DRAIN_PERIOD_MS = 50;
+constexpr uint32_t SINK_FLUSH_MS = 2000;
+
+TaskHandle_t drainTask = nullptr;
+SemaphoreHandle_t drainMutex = nullptr;
+
+// Everything below is only touched with drainMutex held (or before the drain task exists)
+char line[256];
+
+// Binary log: a session header, then tagged entries. Site definitions come before the first record using them, so
+// each file can be decoded on its own. All integers are little-endian.
+enum BinaryTag : uint8_t { SessionTag = 0, SiteTag = 1, RecordTag = 2, DroppedTag = 3 };
+constexpr char BINARY_MAGIC[4] = {'C', 'P', 'L', 'G'};
+constexpr uint8_t BINARY_VERSION = 1;
+
+Print* binarySink = nullptr;
+uint8_t sinkBuffer[512];
+size_t sinkBuffered = 0;
+uint32_t sinkFlushedAt = 0;
+// Sites already defined in this session; forgotten (and defined again) when the table is full
+const LogSite* sitesDefined[64];
+size_t sitesDefinedCount = 0;
+
+void sinkFlush() {
+  if (sinkBuffered > 0) {
+    binarySink->write(sinkBuffer, sinkBuffered);
+    sinkBuffered = 0;
+  }
+  binarySink->flush();
+  sinkFlushedAt = millis();
+}
+
+void sinkPut(const void* data, const size_t size) {
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  if (size > sizeof(sinkBuffer)) {
+    sinkFlush();
+    binarySink->write(bytes, size);
+    return;
+  }
+  if (sinkBuffered + size > sizeof(sinkBuffer)) {
+    binarySink->write(sinkBuffer, sinkBuffered);
+    sinkBuffered = 0;
+  }
+  memcpy(sinkBuffer + sinkBuffered, bytes, size);
+  sinkBuffered += size;
+}
+
+template <typename T>
+void sinkPutValue(const T value) {
+  sinkPut(&value, sizeof(value));
+}
+
+void sinkPutString(const char* s) { sinkPut(s, strlen(s) + 1); }
+
+void sinkDefineSite(const LogSite* site) {
+  for (size_t i = 0; i < sitesDefinedCount; i++) {
+    if (sitesDefined[i] == site) {
+      return;
+    }
+  }
+  if (sitesDefinedCount == sizeof(sitesDefined) / sizeof(sitesDefined[0])) {
+    sitesDefinedCount = 0;
+  }
+  sitesDefined[sitesDefinedCount++] = site;
+  sinkPutValue(SiteTag);
+  sinkPutValue(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(site)));
+  sinkPutValue(site->level);
+  sinkPutString(site->origin);
+  sinkPutString(site->format);
+}
+
+void sinkRecord(const LogRing::Record& record) {
+  sinkDefineSite(record.site);
+  sinkPutValue(RecordTag);
+  sinkPutValue(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(record.site)));
+  sinkPutValue(record.timestamp);
+  sinkPutValue(record.types);
+  sinkPutValue(static_cast<uint16_t>(record.argsSize));
+  sinkPut(record.args, record.argsSize);
+}
+
+void printRecord(const LogRing::Record& record) {
+  const char* level = record.site->level == 'E' ? "ERR" : record.site->level == 'I' ? "INF" : "DBG";
+  int length = snprintf(line, sizeof(line), "[%lu] [%s] [%s] ", static_cast<unsigned long>(record.timestamp), level,
+                        record.site->origin);
+  if (length < 0) {
+    return;
+  }
+  if (static_cast<size_t>(length) < sizeof(line) - 1) {
+    formatLogMessage(record, line + length, sizeof(line) - length);
+  }
+  logSerial.print(line);
+}
+
+// Writes out every published record; called with drainMutex held
+void drain() {
+  bool sawError = false;
+  LogRing::Record record;
+  while (logRing.read(record)) {
+    if (logSerial) {
+      printRecord(record);
+    }
+    if (binarySink) {
+      sinkRecord(record);
+    }
+    sawError |= record.site->level == 'E';
+    logRing.release();
+  }
+
+  if (const uint32_t dropped = logRing.takeDropped()) {
+    if (logSerial) {
+      logSerial.printf("[%lu] [ERR] [LOG] %lu messages dropped\n", millis(), static_cast<unsigned long>(dropped));
+    }
+    if (binarySink) {
+      sinkPutValue(DroppedTag);
+      sinkPutValue(dropped);
+    }
+  }
+
+  if (binarySink && (sawError || millis() - sinkFlushedAt >= SINK_FLUSH_MS)) {
+    sinkFlush();
+  }
+}
+
+void drainLoop(void*) {
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(DRAIN_PERIOD_MS));
+    xSemaphoreTake(drainMutex, portMAX_DELAY);
+    drain();
+    xSemaphoreGive(drainMutex);
+  }
+}
+}  // namespace
+
+LogRing logRing(ringStorage, sizeof(ringStorage));
+
+void logWake() {
+  if (drainTask) {
+    xTaskNotifyGive(drainTask);
+  }
+}
+
+void logBegin() {
+  if (drainTask) {
+    return;
+  }
+  drainMutex = xSemaphoreCreateMutex();
+  xTaskCreate(drainLoop, "LogDrain", 4096, nullptr, 1, &drainTask);
+}
+
+void logFlush() {
+  if (drainMutex) {
+    xSemaphoreTake(drainMutex, portMAX_DELAY);
+  }
+  drain();
+  if (binarySink) {
+    sinkFlush();
+  }
+  if (drainMutex) {
+    xSemaphoreGive(drainMutex);
+  }
+  if (logSerial) {
+    logSerial.flush();
+  }
+}
+
+void logSetBinarySink(Print* sink) {
+  if (drainMutex) {
+    xSemaphoreTake(drainMutex, portMAX_DELAY);
+  }
+  if (binarySink) {
+    drain();
+    sinkFlush();
+  }
+  binarySink = sink;
+  sitesDefinedCount = 0;
+  if (binarySink) {
+    sinkPutValue(SessionTag);
+    sinkPut(BINARY_MAGIC, sizeof(BINARY_MAGIC));
+    sinkPutValue(BINARY_VERSION);
+    sinkPutValue(static_cast<uint32_t>(millis()));
+  }
+  if (drainMutex) {
+    xSemaphoreGive(drainMutex);
+  }
+}
+#endif
@@ -12,6 +12,11 @@ Define LOG_LEVEL to control log verbosity:
 2 = ERR + INF + DBG
 If not defined, defaults to 0
 
+Messages are deferred by default: a LOG_* call only copies its timestamp, call site and raw arguments into a ring
+buffer (see LogRing.h), and a low-priority task formats them and writes them to Serial, and in binary to the sink set
+with logSetBinarySink() (scripts/decode_binary_log.py reads that). Define LOG_DEFERRED=0 to format and print at the
+call site instead. Call logFlush() before anything that would lose the ring, such as deep sleep or a restart.
+
 If you have a legitimate need for raw Serial access (e.g., binary data,
 special formatting), use the underlying logSerial object directly:
     logSerial.printf("Special case: %d\n", value);
@@ -25,25 +30,64 @@ won't trigger deprecation warnings.
 #define LOG_LEVEL 0
 #endif
 
+#ifndef LOG_DEFERRED
+#define LOG_DEFERRED 1
+#endif
+
 static HWCDC& logSerial = Serial;
 
 void logPrintf(const char* level, const char* origin, const char* format, ...);
 
+#if defined(ENABLE_SERIAL_LOG) && LOG_DEFERRED
+#include "LogRing.h"
+
+extern LogRing logRing;
+void logWake();
+
+// Starts the task draining the ring. Records made before are kept until then (or dropped once the ring is full).
+void logBegin();
+// Writes out everything recorded so far before returning
+void logFlush();
+// Also write records in binary to `sink` (e.g. a file on the SD card), or stop with nullptr
+void logSetBinarySink(Print* sink);
+
+template <typename... Args>
+inline void logDeferred(const LogSite* site, const Args... args) {  // By value: arguments may be bit-fields
+  logRing.write(millis(), site, args...);
+  if (site->level == 'E') {
+    logWake();  // Errors come out right away
+  }
+}
+
+#define LOG_AT_SITE(level, origin, format, ...)                    \
+  do {                                                             \
+    static constexpr LogSite logSite_{level, origin, format "\n"}; \
+    logDeferred(&logSite_, ##__VA_ARGS__);                         \
+  } while (0)
+#else
+inline void logBegin() {}
+inline void logFlush() {}
+inline void logSetBinarySink(Print*) {}
+
+#define LOG_AT_SITE(level, origin, format, ...) \
+  logPrintf(level == 'E' ? "[ERR]" : level == 'I' ? "[INF]" : "[DBG]", origin, format "\n", ##__VA_ARGS__)
+#endif
+
 #ifdef ENABLE_SERIAL_LOG
 #if LOG_LEVEL >= 0
-#define LOG_ERR(origin, format, ...) logPrintf("[ERR]", origin, format "\n", ##__VA_ARGS__)
+#define LOG_ERR(origin, format, ...) LOG_AT_SITE('E', origin, format, ##__VA_ARGS__)
 #else
 #define LOG_ERR(origin, format, ...)
 #endif
 
 #if LOG_LEVEL >= 1
-#define LOG_INF(origin, format, ...) logPrintf("[INF]", origin, format "\n", ##__VA_ARGS__)
+#define LOG_INF(origin, format, ...) LOG_AT_SITE('I', origin, format, ##__VA_ARGS__)
 #else
 #define LOG_INF(origin, format, ...)
 #endif
 
 #if LOG_LEVEL >= 2
-#define LOG_DBG(origin, format, ...) logPrintf("[DBG]", origin, format "\n", ##__VA_ARGS__)
+#define LOG_DBG(origin, format, ...) LOG_AT_SITE('D', origin, format, ##__VA_ARGS__)
 #else
 #define LOG_DBG(origin, format, ...)
 #endif
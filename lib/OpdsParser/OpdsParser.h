@@ -2,6 +2,7 @@
 #include <Print.h>
 #include <expat.h>
 
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -42,6 +43,9 @@ using OpdsBook = OpdsEntry;
  *       }
  *     }
  *   }
+ *
+ * With an entry callback set, each entry is handed over as soon as its </entry> is parsed and nothing is collected, so
+ * a feed of any length can be streamed to storage.
  */
 class OpdsParser final : public Print {
  public:
@@ -68,6 +72,16 @@ class OpdsParser final : public Print {
   const std::vector<OpdsEntry>& getEntries() const& { return entries; }
   std::vector<OpdsEntry> getEntries() && { return std::move(entries); }
 
+  /**
+   * Hand each parsed entry to `callback` instead of collecting it in getEntries().
+   */
+  void setEntryCallback(std::function<void(const OpdsEntry&)> callback) { onEntry = std::move(callback); }
+
+  /**
+   * Get the href of the feed's rel="next" link (the next page of a paginated feed), or an empty string.
+   */
+  const std::string& getNextHref() const { return nextHref; }
+
   /**
    * Get only book entries (legacy compatibility).
    * @return Vector of book entries
@@ -90,6 +104,8 @@ class OpdsParser final : public Print {
 
   XML_Parser parser = nullptr;
   std::vector<OpdsEntry> entries;
+  std::function<void(const OpdsEntry&)> onEntry;
+  std::string nextHref;
   OpdsEntry currentEntry;
   std::string currentText;
 
@@ -0,0 +1,156 @@
+#include "BufferedFile.h"
+
+#include <Logging.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+BufferedReader::BufferedReader(HalFile& file, const size_t blockSize)
+    : file(file), blockSize(blockSize), bufferStart(file.position()) {
+  buffer = static_cast<uint8_t*>(malloc(blockSize));
+  if (!buffer) {
+    LOG_DBG("BUF", "No memory for %u byte read buffer, reading unbuffered", blockSize);
+  }
+}
+
+BufferedReader::~BufferedReader() { free(buffer); }
+
+bool BufferedReader::refill() {
+  bufferStart += bufferLength;
+  bufferLength = 0;
+  cursor = 0;
+  const int bytesRead = file.read(buffer, blockSize);
+  if (bytesRead <= 0) {
+    return false;
+  }
+  bufferLength = bytesRead;
+  return true;
+}
+
+int BufferedReader::read(void* buf, const size_t count) {
+  if (!buffer) {
+    const int bytesRead = file.read(buf, count);
+    if (bytesRead > 0) {
+      bufferStart += bytesRead;
+    }
+    return bytesRead;
+  }
+
+  auto* out = static_cast<uint8_t*>(buf);
+  size_t total = 0;
+  while (total < count) {
+    if (cursor == bufferLength) {
+      const size_t remaining = count - total;
+      if (remaining >= blockSize) {
+        // Nothing left in the block and the rest would not fit anyway, so read it straight into the caller's buffer
+        bufferStart += bufferLength;
+        bufferLength = 0;
+        cursor = 0;
+        const int bytesRead = file.read(out + total, remaining);
+        if (bytesRead > 0) {
+          bufferStart += bytesRead;
+          total += bytesRead;
+        }
+        break;
+      }
+      if (!refill()) {
+        break;
+      }
+    }
+    const size_t chunk = std::min(count - total, bufferLength - cursor);
+    memcpy(out + total, buffer + cursor, chunk);
+    cursor += chunk;
+    total += chunk;
+  }
+  return static_cast<int>(total);
+}
+
+int BufferedReader::read() {
+  uint8_t b;
+  return read(&b, 1) == 1 ? b : -1;
+}
+
+bool BufferedReader::seek(const size_t pos) {
+  if (buffer && pos >= bufferStart && pos <= bufferStart + bufferLength) {
+    cursor = pos - bufferStart;
+    return true;
+  }
+  if (!file.seek(pos)) {
+    return false;
+  }
+  bufferStart = pos;
+  bufferLength = 0;
+  cursor = 0;
+  return true;
+}
+
+BufferedWriter::BufferedWriter(HalFile& file, const size_t blockSize)
+    : file(file), blockSize(blockSize), flushedPosition(file.position()) {
+  buffer = static_cast<uint8_t*>(malloc(blockSize));
+  if (!buffer) {
+    LOG_DBG("BUF", "No memory for %u byte write buffer, writing unbuffered", blockSize);
+  }
+}
+
+BufferedWriter::~BufferedWriter() {
+  flush();
+  free(buffer);
+}
+
+size_t BufferedWriter::write(const void* buf, const size_t count) {
+  if (!buffer) {
+    const size_t written = file.write(buf, count);
+    flushedPosition += written;
+    failed |= written != count;
+    return written;
+  }
+
+  const auto* in = static_cast<const uint8_t*>(buf);
+  size_t total = 0;
+  while (total < count) {
+    if (bufferLength == blockSize && !flush()) {
+      break;
+    }
+    const size_t remaining = count - total;
+    if (bufferLength == 0 && remaining >= blockSize) {
+      // A whole block or more with nothing buffered ahead of it: no point copying it through the buffer
+      const size_t written = file.write(in + total, remaining);
+      flushedPosition += written;
+      failed |= written != remaining;
+      total += written;
+      break;
+    }
+    const size_t chunk = std::min(remaining, blockSize - bufferLength);
+    memcpy(buffer + bufferLength, in + total, chunk);
+    bufferLength += chunk;
+    total += chunk;
+  }
+  return total;
+}
+
+size_t BufferedWriter::write(const uint8_t b) { return write(&b, 1); }
+
+bool BufferedWriter::flush() {
+  if (bufferLength == 0) {
+    return true;
+  }
+  const size_t written = file.write(buffer, bufferLength);
+  flushedPosition += written;
+  const bool ok = written == bufferLength;
+  if (!ok) {
+    LOG_ERR("BUF", "Short write: %u of %u bytes", written, bufferLength);
+    failed = true;
+  }
+  bufferLength = 0;
+  return ok;
+}
+
+bool BufferedWriter::seek(const size_t pos) {
+  const bool flushed = flush();
+  if (!file.seek(pos)) {
+    return false;
+  }
+  flushedPosition = pos;
+  return flushed;
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include <HalStorage.h>
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Block-buffered adaptors over HalFile for record-by-record (de)serialization.
+ *
+ * Every HalFile call takes the global storage mutex and goes down to SdFat, which adds up quickly when a record is
+ * read one 1-4 byte field at a time. These adaptors move whole blocks between the file and a small heap buffer, so
+ * the storage lock is taken once per refill or flush instead of once per field.
+ *
+ * The underlying file must not be used directly while an adaptor is attached to it: the reader assumes the file
+ * position is just past its buffered block, and the writer only hands its bytes to the file on flush(). If the
+ * buffer cannot be allocated, both fall back to passing calls straight through to the file.
+ */
+class BufferedReader {
+ public:
+  static constexpr size_t DEFAULT_BLOCK_SIZE = 512;
+
+  // Starts reading at the file's current position
+  explicit BufferedReader(HalFile& file, size_t blockSize = DEFAULT_BLOCK_SIZE);
+  ~BufferedReader();
+  BufferedReader(const BufferedReader&) = delete;
+  BufferedReader& operator=(const BufferedReader&) = delete;
+
+  // Same contract as HalFile::read: bytes read, which is short at end of file
+  int read(void* buf, size_t count);
+  // Single byte, or -1 at end of file
+  int read();
+  // File offset of the next byte read() returns
+  size_t position() const { return bufferStart + cursor; }
+  // Moves within the buffered block without touching the file; anything else drops the block
+  bool seek(size_t pos);
+
+ private:
+  HalFile& file;
+  uint8_t* buffer = nullptr;
+  size_t blockSize;
+  size_t bufferStart = 0;  // file offset of buffer[0]
+  size_t bufferLength = 0;
+  size_t cursor = 0;
+
+  bool refill();
+};
+
+class BufferedWriter {
+ public:
+  static constexpr size_t DEFAULT_BLOCK_SIZE = 512;
+
+  // Starts writing at the file's current position
+  explicit BufferedWriter(HalFile& file, size_t blockSize = DEFAULT_BLOCK_SIZE);
+  // Flushes whatever is still buffered
+  ~BufferedWriter();
+  BufferedWriter(const BufferedWriter&) = delete;
+  BufferedWriter& operator=(const BufferedWriter&) = delete;
+
+  // Same contract as HalFile::write. Bytes are only on the file after flush(), so a short write from the file shows
+  // up there (and in hasError()) rather than here.
+  size_t write(const void* buf, size_t count);
+  size_t write(uint8_t b);
+  // Hands the buffered bytes to the file. Returns false if the file took fewer bytes than it was given.
+  bool flush();
+  // File offset the next write() lands at
+  size_t position() const { return flushedPosition + bufferLength; }
+  // Flushes, then seeks the file
+  bool seek(size_t pos);
+  // A flush has failed since this writer was created
+  bool hasError() const { return failed; }
+
+ private:
+  HalFile& file;
+  uint8_t* buffer = nullptr;
+  size_t blockSize;
+  size_t flushedPosition = 0;
+  size_t bufferLength = 0;
+  bool failed = false;
+};
@@ -3,6 +3,8 @@
 
 #include <iostream>
 
+#include "BufferedFile.h"
+
 namespace serialization {
 template <typename T>
 static void writePod(std::ostream& os, const T& value) {
@@ -24,6 +26,16 @@ static void readPod(FsFile& file, T& value) {
   file.read(reinterpret_cast<uint8_t*>(&value), sizeof(T));
 }
 
+template <typename T>
+static void writePod(BufferedWriter& writer, const T& value) {
+  writer.write(reinterpret_cast<const uint8_t*>(&value), sizeof(T));
+}
+
+template <typename T>
+static void readPod(BufferedReader& reader, T& value) {
+  reader.read(reinterpret_cast<uint8_t*>(&value), sizeof(T));
+}
+
 static void writeString(std::ostream& os, const std::string& s) {
   const uint32_t len = s.size();
   writePod(os, len);
@@ -49,4 +61,17 @@ static void readString(FsFile& file, std::string& s) {
   s.resize(len);
   file.read(&s[0], len);
 }
+
+static void writeString(BufferedWriter& writer, const std::string& s) {
+  const uint32_t len = s.size();
+  writePod(writer, len);
+  writer.write(reinterpret_cast<const uint8_t*>(s.data()), len);
+}
+
+static void readString(BufferedReader& reader, std::string& s) {
+  uint32_t len;
+  readPod(reader, len);
+  s.resize(len);
+  reader.read(&s[0], len);
+}
 }  // namespace serialization
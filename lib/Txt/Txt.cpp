@@ -1,14 +1,14 @@
 #include "Txt.h"
 
+#include <BookCacheId.h>
 #include <FsHelpers.h>
 #include <JpegToBmpConverter.h>
 #include <Logging.h>
 
 Txt::Txt(std::string path, std::string cacheBasePath)
     : filepath(std::move(path)), cacheBasePath(std::move(cacheBasePath)) {
-  // Generate cache path from file path hash
-  const size_t hash = std::hash<std::string>{}(filepath);
-  cachePath = this->cacheBasePath + "/txt_" + std::to_string(hash);
+  // Cache directory keyed on the file's content (same as Epub)
+  cachePath = BookCacheId::cachePathFor(filepath, this->cacheBasePath, "txt", &cacheRecorded);
 }
 
 bool Txt::load() {
@@ -30,6 +30,11 @@ bool Txt::load() {
   fileSize = file.size();
   file.close();
 
+  if (!cacheRecorded) {
+    cachePath = BookCacheId::record(filepath, cachePath);
+    cacheRecorded = true;
+  }
+
   loaded = true;
   LOG_DBG("TXT", "Loaded TXT file: %s (%zu bytes)", filepath.c_str(), fileSize);
   return true;
@@ -9,6 +9,7 @@ class Txt {
   std::string filepath;
   std::string cacheBasePath;
   std::string cachePath;
+  bool cacheRecorded = false;  // see Epub
   bool loaded = false;
   size_t fileSize = 0;
 
@@ -13,6 +13,11 @@
 bool Xtc::load() {
   LOG_DBG("XTC", "Loading XTC: %s", filepath.c_str());
 
+  if (!cacheRecorded) {
+    cachePath = BookCacheId::record(filepath, cachePath);
+    cacheRecorded = true;
+  }
+
   // Initialize parser
   parser.reset(new xtc::XtcParser());
 
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <BookCacheId.h>
+
 #include <memory>
 #include <string>
 #include <vector>
@@ -23,13 +25,14 @@
 class Xtc {
   std::string filepath;
   std::string cachePath;
+  bool cacheRecorded = false;  // see Epub
   std::unique_ptr<xtc::XtcParser> parser;
   bool loaded;
 
  public:
   explicit Xtc(std::string filepath, const std::string& cacheDir) : filepath(std::move(filepath)), loaded(false) {
-    // Create cache key based on filepath (same as Epub)
-    cachePath = cacheDir + "/xtc_" + std::to_string(std::hash<std::string>{}(this->filepath));
+    // Cache directory keyed on the file's content (same as Epub)
+    cachePath = BookCacheId::cachePathFor(this->filepath, cacheDir, "xtc", &cacheRecorded);
   }
   ~Xtc() = default;
 
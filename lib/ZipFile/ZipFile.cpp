@@ -1,6 +1,7 @@
 #include "ZipFile.h"
 
 #include <HalStorage.h>
+#include <HeapTags.h>
 #include <InflateReader.h>
 #include <Logging.h>
 
@@ -235,7 +236,7 @@ bool ZipFile::loadZipDetails() {
   // We scan the last 1KB (or the whole file if smaller) for the EOCD signature
   // 0x06054b50 is stored as 0x50, 0x4b, 0x05, 0x06 in little-endian
   const int scanRange = fileSize > 1024 ? 1024 : fileSize;
-  const auto buffer = static_cast<uint8_t*>(malloc(scanRange));
+  const auto buffer = static_cast<uint8_t*>(HeapTags::allocate(scanRange));
   if (!buffer) {
     LOG_ERR("ZIP", "Failed to allocate memory for EOCD scan buffer");
     if (!wasOpen) {
@@ -259,7 +260,7 @@ bool ZipFile::loadZipDetails() {
 
   if (foundOffset == -1) {
     LOG_ERR("ZIP", "EOCD signature not found in zip file");
-    free(buffer);
+    HeapTags::release(buffer);
     if (!wasOpen) {
       close();
     }
@@ -274,7 +275,7 @@ bool ZipFile::loadZipDetails() {
   zipDetails.centralDirOffset = *reinterpret_cast<uint32_t*>(&buffer[foundOffset + 16]);
   zipDetails.isSet = true;
 
-  free(buffer);
+  HeapTags::release(buffer);
   if (!wasOpen) {
     close();
   }
@@ -433,7 +434,7 @@ uint8_t* ZipFile::readFileToMemory(const char* filename, size_t* size, const boo
     // Continue out of block with data set
   } else if (fileStat.method == ZIP_METHOD_DEFLATED) {
     // Read out deflated content from file
-    const auto deflatedData = static_cast<uint8_t*>(malloc(deflatedDataSize));
+    const auto deflatedData = static_cast<uint8_t*>(HeapTags::allocate(deflatedDataSize));
     if (deflatedData == nullptr) {
       LOG_ERR("ZIP", "Failed to allocate memory for decompression buffer");
       if (!wasOpen) {
@@ -449,7 +450,7 @@ uint8_t* ZipFile::readFileToMemory(const char* filename, size_t* size, const boo
 
     if (dataRead != deflatedDataSize) {
       LOG_ERR("ZIP", "Failed to read data, expected %d got %d", deflatedDataSize, dataRead);
-      free(deflatedData);
+      HeapTags::release(deflatedData);
       free(data);
       return nullptr;
     }
@@ -461,7 +462,7 @@ uint8_t* ZipFile::readFileToMemory(const char* filename, size_t* size, const boo
       r.setSource(deflatedData, deflatedDataSize);
       success = r.read(data, inflatedDataSize);
     }
-    free(deflatedData);
+    HeapTags::release(deflatedData);
 
     if (!success) {
       LOG_ERR("ZIP", "Failed to inflate file");
@@ -505,7 +506,7 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
 
   if (fileStat.method == ZIP_METHOD_STORED) {
     // no deflation, just read content
-    const auto buffer = static_cast<uint8_t*>(malloc(chunkSize));
+    const auto buffer = static_cast<uint8_t*>(HeapTags::allocate(chunkSize));
     if (!buffer) {
       LOG_ERR("ZIP", "Failed to allocate memory for buffer");
       if (!wasOpen) {
@@ -519,7 +520,7 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
       const size_t dataRead = file.read(buffer, remaining < chunkSize ? remaining : chunkSize);
       if (dataRead == 0) {
         LOG_ERR("ZIP", "Could not read more bytes");
-        free(buffer);
+        HeapTags::release(buffer);
         if (!wasOpen) {
           close();
         }
@@ -533,12 +534,12 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
     if (!wasOpen) {
       close();
     }
-    free(buffer);
+    HeapTags::release(buffer);
     return true;
   }
 
   if (fileStat.method == ZIP_METHOD_DEFLATED) {
-    auto* fileReadBuffer = static_cast<uint8_t*>(malloc(chunkSize));
+    auto* fileReadBuffer = static_cast<uint8_t*>(HeapTags::allocate(chunkSize));
     if (!fileReadBuffer) {
       LOG_ERR("ZIP", "Failed to allocate memory for zip file read buffer");
       if (!wasOpen) {
@@ -547,10 +548,10 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
       return false;
     }
 
-    auto* outputBuffer = static_cast<uint8_t*>(malloc(chunkSize));
+    auto* outputBuffer = static_cast<uint8_t*>(HeapTags::allocate(chunkSize));
     if (!outputBuffer) {
       LOG_ERR("ZIP", "Failed to allocate memory for output buffer");
-      free(fileReadBuffer);
+      HeapTags::release(fileReadBuffer);
       if (!wasOpen) {
         close();
       }
@@ -565,8 +566,8 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
 
     if (!ctx.reader.init(true)) {
       LOG_ERR("ZIP", "Failed to init inflate reader");
-      free(outputBuffer);
-      free(fileReadBuffer);
+      HeapTags::release(outputBuffer);
+      HeapTags::release(fileReadBuffer);
       if (!wasOpen) {
         close();
       }
@@ -616,8 +617,8 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
     if (!wasOpen) {
       close();
     }
-    free(outputBuffer);
-    free(fileReadBuffer);
+    HeapTags::release(outputBuffer);
+    HeapTags::release(fileReadBuffer);
     return success;  // ctx.reader destructor frees the ring buffer
   }
 
@@ -0,0 +1,163 @@
+#include "ZipStreamScanner.h"
+
+#include <HeapTags.h>
+#include <InflateReader.h>
+#include <Logging.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+constexpr uint32_t LOCAL_HEADER_SIGNATURE = 0x04034b50;
+constexpr uint32_t CENTRAL_DIRECTORY_SIGNATURE = 0x02014b50;
+constexpr uint32_t END_OF_CENTRAL_DIRECTORY_SIGNATURE = 0x06054b50;
+constexpr uint16_t FLAG_ENCRYPTED = 0x0001;
+constexpr uint16_t FLAG_DATA_DESCRIPTOR = 0x0008;
+constexpr uint16_t METHOD_STORED = 0;
+constexpr uint16_t METHOD_DEFLATED = 8;
+
+uint16_t readU16(const uint8_t* p) { return p[0] | (p[1] << 8); }
+uint32_t readU32(const uint8_t* p) { return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24); }
+}  // namespace
+
+ZipStreamScanner::~ZipStreamScanner() { dropCapture(); }
+
+size_t ZipStreamScanner::write(const uint8_t byte) { return write(&byte, 1); }
+
+size_t ZipStreamScanner::write(const uint8_t* buffer, const size_t size) {
+  size_t pos = 0;
+  while (pos < size && state == Status::SCANNING) {
+    const size_t available = size - pos;
+    switch (part) {
+      case Part::HEADER: {
+        const size_t n = std::min(LOCAL_HEADER_SIZE - headerFill, available);
+        memcpy(header + headerFill, buffer + pos, n);
+        headerFill += n;
+        pos += n;
+        if (headerFill < 4) {
+          break;
+        }
+        const uint32_t signature = readU32(header);
+        if (signature == CENTRAL_DIRECTORY_SIGNATURE || signature == END_OF_CENTRAL_DIRECTORY_SIGNATURE) {
+          state = Status::FINISHED;
+        } else if (signature != LOCAL_HEADER_SIGNATURE) {
+          LOG_DBG("ZSS", "Unexpected signature %08x after %zu entries", signature, entries);
+          state = entries == 0 ? Status::INVALID : Status::UNSCANNABLE;
+        } else if (headerFill == LOCAL_HEADER_SIZE) {
+          parseHeader();
+        }
+        break;
+      }
+      case Part::NAME: {
+        const size_t n = std::min(remaining, available);
+        entry.name.append(reinterpret_cast<const char*>(buffer + pos), n);
+        pos += n;
+        remaining -= n;
+        if (remaining == 0) {
+          part = Part::EXTRA;
+          remaining = readU16(header + 28);
+        }
+        break;
+      }
+      case Part::EXTRA: {
+        const size_t n = std::min(remaining, available);
+        pos += n;
+        remaining -= n;
+        if (remaining == 0) {
+          startData();
+        }
+        break;
+      }
+      case Part::DATA: {
+        const size_t n = std::min(remaining, available);
+        if (capture) {
+          memcpy(capture + captureFill, buffer + pos, n);
+          captureFill += n;
+        }
+        pos += n;
+        remaining -= n;
+        if (remaining == 0) {
+          finishData();
+        }
+        break;
+      }
+    }
+  }
+  return state == Status::INVALID ? 0 : size;
+}
+
+void ZipStreamScanner::parseHeader() {
+  const uint16_t flags = readU16(header + 6);
+  entry.method = readU16(header + 8);
+  entry.compressedSize = readU32(header + 18);
+  entry.uncompressedSize = readU32(header + 22);
+  if ((flags & FLAG_DATA_DESCRIPTOR) || entry.compressedSize == UINT32_MAX || entry.uncompressedSize == UINT32_MAX) {
+    LOG_DBG("ZSS", "Entry %zu has no sizes in its local header, stopping", entries);
+    state = Status::UNSCANNABLE;
+    return;
+  }
+  entry.name.clear();
+  part = Part::NAME;
+  remaining = readU16(header + 26);
+}
+
+void ZipStreamScanner::startData() {
+  entries++;
+  const bool wanted = onEntry && onEntry(entry);
+  const bool readable = (entry.method == METHOD_STORED || entry.method == METHOD_DEFLATED) &&
+                        !(readU16(header + 6) & FLAG_ENCRYPTED);
+  if (wanted && readable && entry.compressedSize <= MAX_CAPTURE_SIZE && entry.uncompressedSize <= MAX_CAPTURE_SIZE) {
+    // One extra byte so an empty entry still gets a buffer
+    capture = static_cast<uint8_t*>(HeapTags::allocate(entry.compressedSize + 1));
+    captureFill = 0;
+    if (!capture) {
+      LOG_ERR("ZSS", "No memory to keep %s", entry.name.c_str());
+    }
+  } else if (wanted) {
+    LOG_DBG("ZSS", "Not keeping %s: method %u, %u bytes", entry.name.c_str(), entry.method, entry.uncompressedSize);
+  }
+  part = Part::DATA;
+  remaining = entry.compressedSize;
+  if (remaining == 0) {
+    finishData();
+  }
+}
+
+void ZipStreamScanner::finishData() {
+  part = Part::HEADER;
+  headerFill = 0;
+  if (!capture) {
+    return;
+  }
+
+  uint8_t* contents = capture;
+  size_t size = captureFill;
+  if (entry.method == METHOD_DEFLATED) {
+    contents = static_cast<uint8_t*>(HeapTags::allocate(entry.uncompressedSize + 1));
+    bool inflated = false;
+    if (contents) {
+      InflateReader r;
+      r.init(false);
+      r.setSource(capture, captureFill);
+      inflated = r.read(contents, entry.uncompressedSize);
+    }
+    size = entry.uncompressedSize;
+    dropCapture();
+    if (!inflated) {
+      LOG_ERR("ZSS", "Could not inflate %s", entry.name.c_str());
+      HeapTags::release(contents);
+      return;
+    }
+  } else {
+    capture = nullptr;
+  }
+
+  if (!onContents || !onContents(entry, contents, size)) {
+    HeapTags::release(contents);
+  }
+}
+
+void ZipStreamScanner::dropCapture() {
+  HeapTags::release(capture);
+  capture = nullptr;
+}
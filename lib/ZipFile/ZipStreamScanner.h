@@ -0,0 +1,80 @@
+#pragma once
+#include <Print.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+/**
+ * Walks the local file headers of a ZIP archive as its bytes stream past, e.g. while it is being downloaded, without
+ * seeking and without the central directory at the end.
+ *
+ * Each entry is reported when its header has been seen. Entries the caller asks for are kept until their data is
+ * complete and handed back inflated, as long as they are stored or deflated and no bigger than MAX_CAPTURE_SIZE.
+ * Anything else only costs the bytes of its header.
+ *
+ * A stream that doesn't start with a local file header is INVALID, and write() refuses its bytes so a tee can stop the
+ * transfer. An entry whose sizes are only given after its data (general purpose flag bit 3, or ZIP64) can't be
+ * walked past; the scan stops there as UNSCANNABLE and the rest of the stream is accepted and ignored.
+ */
+class ZipStreamScanner final : public Print {
+ public:
+  static constexpr size_t MAX_CAPTURE_SIZE = 48 * 1024;
+
+  enum class Status : uint8_t {
+    SCANNING,
+    FINISHED,     // Reached the central directory
+    UNSCANNABLE,  // Stopped at an entry without sizes in its local header
+    INVALID,      // Not a ZIP archive
+  };
+
+  struct Entry {
+    std::string name;
+    uint16_t method;
+    uint32_t compressedSize;
+    uint32_t uncompressedSize;
+  };
+
+  // Called for each entry once its name is known. Return true to have its contents passed to the ContentsCallback.
+  using EntryCallback = std::function<bool(const Entry& entry)>;
+  // Called with the inflated contents of a captured entry, in a buffer from HeapTags::allocate(). Return true to keep
+  // the buffer, which the callback must then release, or false to have it released after the call.
+  using ContentsCallback = std::function<bool(const Entry& entry, uint8_t* data, size_t size)>;
+
+  ZipStreamScanner(EntryCallback onEntry, ContentsCallback onContents)
+      : onEntry(std::move(onEntry)), onContents(std::move(onContents)) {}
+  ~ZipStreamScanner() override;
+
+  ZipStreamScanner(const ZipStreamScanner&) = delete;
+  ZipStreamScanner& operator=(const ZipStreamScanner&) = delete;
+
+  size_t write(uint8_t byte) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+
+  Status status() const { return state; }
+  size_t entryCount() const { return entries; }
+
+ private:
+  static constexpr size_t LOCAL_HEADER_SIZE = 30;
+
+  enum class Part : uint8_t { HEADER, NAME, EXTRA, DATA };
+
+  EntryCallback onEntry;
+  ContentsCallback onContents;
+  Status state = Status::SCANNING;
+  Part part = Part::HEADER;
+  uint8_t header[LOCAL_HEADER_SIZE] = {};
+  size_t headerFill = 0;
+  Entry entry;
+  size_t nameLength = 0;
+  size_t remaining = 0;  // Bytes left in the current part (name, extra field or data)
+  uint8_t* capture = nullptr;
+  size_t captureFill = 0;
+  size_t entries = 0;
+
+  void parseHeader();
+  void startData();
+  void finishData();
+  void dropCapture();
+};
@@ -60,6 +60,8 @@ void HalPowerManager::startDeepSleep(HalGPIO& gpio) const {
   }
   // Arm the wakeup trigger *after* the button is released
   esp_deep_sleep_enable_gpio_wakeup(1ULL << InputManager::POWER_BUTTON_PIN, ESP_GPIO_WAKEUP_GPIO_LOW);
+  // Deferred log records would be lost with RAM
+  logFlush();
   // Enter Deep Sleep
   esp_deep_sleep_start();
 }
@@ -84,9 +84,12 @@ class HalFile : public Print {
   int read(void* buf, size_t count);
   int read();  // read a single byte
   size_t write(const void* buf, size_t count);
+  size_t write(const uint8_t* buf, size_t count) override;  // Whole buffers also when written through Print
   size_t write(uint8_t b) override;
   bool rename(const char* newPath);
   bool isDirectory() const;
+  // Last-modified stamp in FAT format: date is (year - 1980) << 9 | month << 5 | day, time is h << 11 | m << 5 | s / 2
+  bool getModifyDateTime(uint16_t* date, uint16_t* time);
   void rewindDirectory();
   bool close();
   HalFile openNextFile();
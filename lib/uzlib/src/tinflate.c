@@ -122,75 +122,113 @@ static void tinf_build_bits_base(unsigned char *bits, unsigned short *base, int
 }
 #endif
 
-/* build the fixed huffman trees */
-static void tinf_build_fixed_trees(TINF_TREE *lt, TINF_TREE *dt)
+/* reverse the low len bits of code */
+static unsigned int tinf_reverse_bits(unsigned int code, unsigned int len)
 {
-   int i;
-
-   /* build fixed length tree */
-   for (i = 0; i < 7; ++i) lt->table[i] = 0;
-
-   lt->table[7] = 24;
-   lt->table[8] = 152;
-   lt->table[9] = 112;
-
-   for (i = 0; i < 24; ++i) lt->trans[i] = 256 + i;
-   for (i = 0; i < 144; ++i) lt->trans[24 + i] = i;
-   for (i = 0; i < 8; ++i) lt->trans[24 + 144 + i] = 280 + i;
-   for (i = 0; i < 112; ++i) lt->trans[24 + 144 + 8 + i] = 144 + i;
+   unsigned int rev = 0;
 
-   /* build fixed distance tree */
-   for (i = 0; i < 5; ++i) dt->table[i] = 0;
-
-   dt->table[5] = 32;
+   while (len--)
+   {
+      rev = (rev << 1) | (code & 1);
+      code >>= 1;
+   }
 
-   for (i = 0; i < 32; ++i) dt->trans[i] = i;
+   return rev;
 }
 
-/* given an array of code lengths, build a tree */
-static void tinf_build_tree(TINF_TREE *t, const unsigned char *lengths, unsigned int num)
+/* given an array of code lengths, build a tree: code length counts,
+   symbols in code order, and the lookup table for codes of up to
+   fast_bits bits */
+static void tinf_build_tree(unsigned short *table, unsigned short *trans, unsigned short *fast,
+                            unsigned int fast_bits, const unsigned char *lengths, unsigned int num)
 {
    unsigned short offs[16];
-   unsigned int i, sum;
+   unsigned int i, sum, len, code;
 
    /* clear code length count table */
-   for (i = 0; i < 16; ++i) t->table[i] = 0;
+   for (i = 0; i < 16; ++i) table[i] = 0;
 
    /* scan symbol lengths, and sum code length counts */
-   for (i = 0; i < num; ++i) t->table[lengths[i]]++;
+   for (i = 0; i < num; ++i) table[lengths[i]]++;
 
    #if UZLIB_CONF_DEBUG_LOG >= 2
-   UZLIB_DUMP_ARRAY("codelen counts:", t->table, TINF_ARRAY_SIZE(t->table));
+   UZLIB_DUMP_ARRAY("codelen counts:", table, 16);
    #endif
 
-   /* In the lengths array, 0 means unused code. So, t->table[0] now contains
+   /* In the lengths array, 0 means unused code. So, table[0] now contains
       number of unused codes. But table's purpose is to contain # of codes of
       particular length, and there're 0 codes of length 0. */
-   t->table[0] = 0;
+   table[0] = 0;
 
    /* compute offset table for distribution sort */
    for (sum = 0, i = 0; i < 16; ++i)
    {
       offs[i] = sum;
-      sum += t->table[i];
+      sum += table[i];
    }
 
    #if UZLIB_CONF_DEBUG_LOG >= 2
-   UZLIB_DUMP_ARRAY("codelen offsets:", offs, TINF_ARRAY_SIZE(offs));
+   UZLIB_DUMP_ARRAY("codelen offsets:", offs, 16);
    #endif
 
    /* create code->symbol translation table (symbols sorted by code) */
    for (i = 0; i < num; ++i)
    {
-      if (lengths[i]) t->trans[offs[lengths[i]]++] = i;
+      if (lengths[i]) trans[offs[lengths[i]]++] = i;
+   }
+
+   /* Fill the lookup table with the codes of up to fast_bits bits. Codes
+      are sent most significant bit first but the bit buffer is read from
+      its least significant bit, so a code's entries are at its reversed
+      bits plus every combination of the bits after it. */
+   memset(fast, 0, sizeof(*fast) << fast_bits);
+   for (code = 0, sum = 0, len = 1; len <= fast_bits; ++len, code <<= 1)
+   {
+      for (i = 0; i < table[len]; ++i, ++code, ++sum)
+      {
+         unsigned int idx;
+         unsigned short entry = (unsigned short)(trans[sum] << 4 | len);
+
+         /* over-subscribed set of lengths, left to the bitwise decoder */
+         if (code >> len) return;
+
+         for (idx = tinf_reverse_bits(code, len); idx < (1u << fast_bits); idx += 1u << len)
+         {
+            fast[idx] = entry;
+         }
+      }
    }
 }
 
+#define tinf_build_ltree(t, lengths, num) \
+   tinf_build_tree((t)->table, (t)->trans, (t)->fast, TINF_LFAST_BITS, lengths, num)
+#define tinf_build_dtree(t, lengths, num) \
+   tinf_build_tree((t)->table, (t)->trans, (t)->fast, TINF_DFAST_BITS, lengths, num)
+
+/* build the fixed huffman trees */
+static void tinf_build_fixed_trees(TINF_TREE *lt, TINF_DTREE *dt)
+{
+   unsigned char lengths[288];
+   int i;
+
+   /* build fixed length tree */
+   for (i = 0; i < 144; ++i) lengths[i] = 8;
+   for (; i < 256; ++i) lengths[i] = 9;
+   for (; i < 280; ++i) lengths[i] = 7;
+   for (; i < 288; ++i) lengths[i] = 8;
+   tinf_build_ltree(lt, lengths, 288);
+
+   /* build fixed distance tree */
+   for (i = 0; i < 32; ++i) lengths[i] = 5;
+   tinf_build_dtree(dt, lengths, 32);
+}
+
 /* ---------------------- *
  * -- decode functions -- *
  * ---------------------- */
 
-unsigned char uzlib_get_byte(TINF_DATA *d)
+/* next byte of the source stream, 0 past its end */
+static unsigned char tinf_next_byte(TINF_DATA *d)
 {
     /* If end of source buffer is not reached, return next byte from source
        buffer. */
@@ -216,6 +254,71 @@ unsigned char uzlib_get_byte(TINF_DATA *d)
     return 0;
 }
 
+/* drop bits from the bit buffer */
+static void tinf_consume(TINF_DATA *d, unsigned int num)
+{
+   d->tag >>= num;
+   d->bitcount -= num;
+}
+
+/* top the bit buffer up to at least 25 bits, which is enough for any code,
+   or any count of extra bits. Past the end of the input it is padded with
+   zeros; decoding them is an error (see tinf_overrun). */
+static void tinf_refill(TINF_DATA *d)
+{
+   while (d->bitcount <= 24)
+   {
+      unsigned int byte;
+
+      if (d->source < d->source_limit) {
+         byte = *d->source++;
+      } else {
+         byte = tinf_next_byte(d);
+         if (d->eof) d->padbits += 8;
+      }
+
+      d->tag |= byte << d->bitcount;
+      d->bitcount += 8;
+   }
+}
+
+/* whether bits past the end of the input were decoded */
+static int tinf_overrun(const TINF_DATA *d)
+{
+   return d->bitcount < d->padbits;
+}
+
+/* skip to the next byte boundary of the input */
+static void tinf_align(TINF_DATA *d)
+{
+   tinf_consume(d, d->bitcount & 7);
+}
+
+/* whether uzlib_get_byte() ran past the end of the input: it only empties
+   the bit buffer once the bytes read ahead are used up */
+static int tinf_past_end(const TINF_DATA *d)
+{
+   return d->eof && d->bitcount == 0;
+}
+
+unsigned char uzlib_get_byte(TINF_DATA *d)
+{
+    /* Whole bytes the bit buffer read ahead come first. This is only
+       called on a byte boundary (see tinf_align). */
+    if (d->bitcount >= d->padbits + 8) {
+        unsigned char c = d->tag & 0xff;
+        tinf_consume(d, 8);
+        return c;
+    }
+
+    /* what's left is padding past the end of the input */
+    d->tag = 0;
+    d->bitcount = 0;
+    d->padbits = 0;
+
+    return tinf_next_byte(d);
+}
+
 uint32_t tinf_get_le_uint32(TINF_DATA *d)
 {
     uint32_t val = 0;
@@ -236,75 +339,67 @@ uint32_t tinf_get_be_uint32(TINF_DATA *d)
     return val;
 }
 
-/* get one bit from source stream */
-static int tinf_getbit(TINF_DATA *d)
-{
-   unsigned int bit;
-
-   /* check if tag is empty */
-   if (!d->bitcount--)
-   {
-      /* load next tag */
-      d->tag = uzlib_get_byte(d);
-      d->bitcount = 7;
-   }
-
-   /* shift bit out of tag */
-   bit = d->tag & 0x01;
-   d->tag >>= 1;
-
-   return bit;
-}
-
 /* read a num bit value from a stream and add base */
 static unsigned int tinf_read_bits(TINF_DATA *d, int num, int base)
 {
-   unsigned int val = 0;
+   unsigned int val;
 
-   /* read num bits */
-   if (num)
-   {
-      unsigned int limit = 1 << (num);
-      unsigned int mask;
+   if (!num) return base;
 
-      for (mask = 1; mask < limit; mask *= 2)
-         if (tinf_getbit(d)) val += mask;
-   }
+   tinf_refill(d);
+   val = d->tag & ((1u << num) - 1);
+   tinf_consume(d, num);
 
    return val + base;
 }
 
 /* given a data stream and a tree, decode a symbol */
-static int tinf_decode_symbol(TINF_DATA *d, TINF_TREE *t)
+static int tinf_decode_symbol(TINF_DATA *d, const unsigned short *table, const unsigned short *trans,
+                              const unsigned short *fast, unsigned int fast_bits)
 {
    int sum = 0, cur = 0, len = 0;
+   unsigned int entry;
 
-   /* get more bits while code value is above sum */
+   tinf_refill(d);
+
+   /* short codes: one lookup */
+   entry = fast[d->tag & ((1u << fast_bits) - 1)];
+   if (entry) {
+      tinf_consume(d, entry & 15);
+      return entry >> 4;
+   }
+
+   /* longer codes: walk the code a bit at a time, within the buffered bits */
    do {
 
-      cur = 2*cur + tinf_getbit(d);
+      cur = 2*cur + ((d->tag >> len) & 1);
 
-      if (++len == TINF_ARRAY_SIZE(t->table)) {
+      if (++len == 16) {
          return TINF_DATA_ERROR;
       }
 
-      sum += t->table[len];
-      cur -= t->table[len];
+      sum += table[len];
+      cur -= table[len];
 
    } while (cur >= 0);
 
+   tinf_consume(d, len);
+
    sum += cur;
    #if UZLIB_CONF_PARANOID_CHECKS
-   if (sum < 0 || sum >= TINF_ARRAY_SIZE(t->trans)) {
+   if (sum < 0 || sum >= 288) {
       return TINF_DATA_ERROR;
    }
    #endif
 
-   return t->trans[sum];
+   return trans[sum];
 }
 
+#define tinf_decode_lsymbol(d, t) tinf_decode_symbol(d, (t)->table, (t)->trans, (t)->fast, TINF_LFAST_BITS)
+#define tinf_decode_dsymbol(d, t) tinf_decode_symbol(d, (t)->table, (t)->trans, (t)->fast, TINF_DFAST_BITS)
+
 /* given a data stream, decode dynamic trees from it */
-static int tinf_decode_trees(TINF_DATA *d, TINF_TREE *lt, TINF_TREE *dt)
+static int tinf_decode_trees(TINF_DATA *d, TINF_TREE *lt, TINF_DTREE *dt)
 {
    /* code lengths for 288 literal/len symbols and 32 dist symbols */
    unsigned char lengths[288+32];
@@ -332,13 +427,13 @@ static int tinf_decode_trees(TINF_DATA *d, TINF_TREE *lt, TINF_TREE *dt)
    }
 
    /* build code length tree, temporarily use length tree */
-   tinf_build_tree(lt, lengths, 19);
+   tinf_build_ltree(lt, lengths, 19);
 
    /* decode code lengths for the dynamic trees */
    hlimit = hlit + hdist;
    for (num = 0; num < hlimit; )
    {
-      int sym = tinf_decode_symbol(d, lt);
+      int sym = tinf_decode_lsymbol(d, lt);
       unsigned char fill_value = 0;
       int lbits, lbase = 3;
 
@@ -393,8 +488,8 @@ static int tinf_decode_trees(TINF_DATA *d, TINF_TREE *lt, TINF_TREE *dt)
    #endif
 
    /* build dynamic trees */
-   tinf_build_tree(lt, lengths, hlit);
-   tinf_build_tree(dt, lengths + hlit, hdist);
+   tinf_build_ltree(lt, lengths, hlit);
+   tinf_build_dtree(dt, lengths + hlit, hdist);
 
    return TINF_OK;
 }
@@ -403,23 +498,33 @@ static int tinf_decode_trees(TINF_DATA *d, TINF_TREE *lt, TINF_TREE *dt)
  * -- block inflate functions -- *
  * ----------------------------- */
 
-/* given a stream and two trees, inflate next chunk of output (a byte or more) */
-static int tinf_inflate_block_data(TINF_DATA *d, TINF_TREE *lt, TINF_TREE *dt)
+/* given a stream and two trees, inflate next chunk of output (a byte or more,
+   up to the end of the output buffer) */
+static int tinf_inflate_block_data(TINF_DATA *d, TINF_TREE *lt, TINF_DTREE *dt)
 {
-    if (d->curlen == 0) {
+    unsigned int to_copy;
+
+    if (d->dest >= d->dest_limit) {
+        return TINF_OK;
+    }
+
+    while (d->curlen == 0) {
         unsigned int offs;
         int dist;
-        int sym = tinf_decode_symbol(d, lt);
+        int sym = tinf_decode_lsymbol(d, lt);
         //printf("huff sym: %02x\n", sym);
 
-        if (d->eof) {
+        if (sym < 0 || tinf_overrun(d)) {
             return TINF_DATA_ERROR;
         }
 
-        /* literal byte */
+        /* literal byte; keep decoding while there is room for more */
         if (sym < 256) {
             TINF_PUT(d, sym);
-            return TINF_OK;
+            if (d->dest >= d->dest_limit) {
+                return TINF_OK;
+            }
+            continue;
         }
 
         /* end of block */
@@ -436,8 +541,8 @@ static int tinf_inflate_block_data(TINF_DATA *d, TINF_TREE *lt, TINF_TREE *dt)
         /* possibly get more bits from length code */
         d->curlen = tinf_read_bits(d, length_bits[sym], length_base[sym]);
 
-        dist = tinf_decode_symbol(d, dt);
-        if (dist >= 30) {
+        dist = tinf_decode_dsymbol(d, dt);
+        if (dist < 0 || dist >= 30) {
             return TINF_DATA_ERROR;
         }
 
@@ -472,29 +577,32 @@ static int tinf_inflate_block_data(TINF_DATA *d, TINF_TREE *lt, TINF_TREE *dt)
         }
     }
 
-    /* copy next byte from dict substring */
+    /* copy as much of the dict substring as fits */
+    to_copy = d->curlen;
+    if (to_copy > (unsigned)(d->dest_limit - d->dest)) {
+        to_copy = d->dest_limit - d->dest;
+    }
+    d->curlen -= to_copy;
+
     if (d->dict_ring) {
-        TINF_PUT(d, d->dict_ring[d->lzOff]);
-        if ((unsigned)++d->lzOff == d->dict_size) {
-            d->lzOff = 0;
+        for (; to_copy; --to_copy) {
+            TINF_PUT(d, d->dict_ring[d->lzOff]);
+            if ((unsigned)++d->lzOff == d->dict_size) {
+                d->lzOff = 0;
+            }
         }
     } else {
         #if UZLIB_CONF_USE_MEMCPY
         /* copy as much as possible, in one memcpy() call */
-        unsigned int to_copy = d->curlen, dest_len = d->dest_limit - d->dest;
-        if (to_copy > dest_len) {
-            to_copy = dest_len;
-        }
         memcpy(d->dest, d->dest + d->lzOff, to_copy);
         d->dest += to_copy;
-        d->curlen -= to_copy;
-        return TINF_OK;
         #else
-        d->dest[0] = d->dest[d->lzOff];
-        d->dest++;
+        for (; to_copy; --to_copy) {
+            d->dest[0] = d->dest[d->lzOff];
+            d->dest++;
+        }
         #endif
     }
-    d->curlen--;
     return TINF_OK;
 }
 
@@ -504,6 +612,9 @@ static int tinf_inflate_uncompressed_block(TINF_DATA *d)
     if (d->curlen == 0) {
         unsigned int length, invlength;
 
+        /* the block starts on a byte boundary */
+        tinf_align(d);
+
         /* get length */
         length = uzlib_get_byte(d);
         length += 256 * uzlib_get_byte(d);
@@ -512,13 +623,11 @@ static int tinf_inflate_uncompressed_block(TINF_DATA *d)
         invlength += 256 * uzlib_get_byte(d);
         /* check length */
         if (length != (~invlength & 0x0000ffff)) return TINF_DATA_ERROR;
+        if (tinf_past_end(d)) return TINF_DATA_ERROR;
 
         /* increment length to properly return TINF_DONE below, without
            producing data at the same time */
         d->curlen = length + 1;
-
-        /* make sure we start next block on a byte boundary */
-        d->bitcount = 0;
     }
 
     if (--d->curlen == 0) {
@@ -526,6 +635,7 @@ static int tinf_inflate_uncompressed_block(TINF_DATA *d)
     }
 
     unsigned char c = uzlib_get_byte(d);
+    if (tinf_past_end(d)) return TINF_DATA_ERROR;
     TINF_PUT(d, c);
     return TINF_OK;
 }
@@ -552,7 +662,9 @@ void uzlib_init(void)
 void uzlib_uncompress_init(TINF_DATA *d, void *dict, unsigned int dictLen)
 {
    d->eof = 0;
+   d->tag = 0;
    d->bitcount = 0;
+   d->padbits = 0;
    d->bfinal = 0;
    d->btype = -1;
    d->dict_size = dictLen;
@@ -573,7 +685,7 @@ int uzlib_uncompress(TINF_DATA *d)
 next_blk:
             old_btype = d->btype;
             /* read final block flag */
-            d->bfinal = tinf_getbit(d);
+            d->bfinal = tinf_read_bits(d, 1, 0);
             /* read block type (2 bits) */
             d->btype = tinf_read_bits(d, 2, 0);
 
@@ -616,6 +728,12 @@ next_blk:
             goto next_blk;
         }
 
+        if (res == TINF_DONE) {
+            /* whatever follows the stream (e.g. its checksum) starts on
+               the next byte */
+            tinf_align(d);
+        }
+
         if (res != TINF_OK) {
             return res;
         }
@@ -75,11 +75,23 @@ extern "C" {
 
 /* data structures */
 
+/* Codes of up to this many bits are decoded with a single table lookup;
+   longer (rare) ones are decoded from the code length counts. */
+#define TINF_LFAST_BITS 9
+#define TINF_DFAST_BITS 7
+
 typedef struct {
    unsigned short table[16];  /* table of code length counts */
    unsigned short trans[288]; /* code -> symbol translation table */
+   unsigned short fast[1 << TINF_LFAST_BITS]; /* next bits -> symbol << 4 | code length, 0 for longer codes */
 } TINF_TREE;
 
+typedef struct {
+   unsigned short table[16];  /* table of code length counts */
+   unsigned short trans[32];  /* code -> symbol translation table */
+   unsigned short fast[1 << TINF_DFAST_BITS]; /* next bits -> symbol << 4 | code length, 0 for longer codes */
+} TINF_DTREE;
+
 struct uzlib_uncomp {
     /* Pointer to the next byte in the input buffer */
     const unsigned char *source;
@@ -92,8 +104,12 @@ struct uzlib_uncomp {
        source_limit fields, thus allowing for buffered operation. */
     int (*source_read_cb)(struct uzlib_uncomp *uncomp);
 
+    /* Bit buffer, least significant bit first. It is topped up to at least
+       25 bits before each code, so may hold bytes past the current one. */
     unsigned int tag;
     unsigned int bitcount;
+    /* Zero bits in tag standing in for input past its end */
+    unsigned int padbits;
 
     /* Destination (output) buffer start */
     unsigned char *dest_start;
@@ -116,7 +132,7 @@ struct uzlib_uncomp {
     unsigned int dict_idx;
 
     TINF_TREE ltree; /* dynamic length/symbol tree */
-    TINF_TREE dtree; /* dynamic distance tree */
+    TINF_DTREE dtree; /* dynamic distance tree */
 };
 
 #include "tinf_compat.h"
@@ -0,0 +1,183 @@
+#!/usr/bin/env python3
+"""
+Decode the binary log written by firmware built with -DLOG_TO_SD=1
+
+The firmware records each LOG_* call as (call site, timestamp, raw arguments) and leaves formatting to the reader.
+This script turns /.crosspoint/log.bin (or log.old.bin) back into the lines the serial console shows:
+
+    [12345] [INF] [MAIN] Boot: display and fonts ready at 812 ms
+
+File layout (little-endian), see lib/Logging/Logging.cpp:
+    0  session   'CPLG', u8 version, u32 millis
+    1  site      u32 id, char level, origin\\0, format\\0
+    2  record    u32 site id, u32 millis, u32 argument types (3 bits each), u16 size, arguments
+    3  dropped   u32 count of records lost because the ring was full
+
+Usage:
+    python decode_binary_log.py log.bin [--level ERR|INF|DBG] [--origin MAIN]
+"""
+
+from __future__ import annotations
+
+import argparse
+import re
+import struct
+import sys
+
+MAGIC = b"CPLG"
+LEVELS = {"E": "ERR", "I": "INF", "D": "DBG"}
+LEVEL_ORDER = ["ERR", "INF", "DBG"]
+
+INT32, INT64, DOUBLE, STRING, POINTER = 1, 2, 3, 4, 5
+POINTER_SIZE = 4  # RV32
+
+CONVERSION = re.compile(r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d+))?(hh|h|ll|l|L|z|j|t|q)?([diouxXcsfFeEgGaAp%])")
+
+
+class Reader:
+    def __init__(self, data: bytes):
+        self.data = data
+        self.offset = 0
+
+    def left(self) -> int:
+        return len(self.data) - self.offset
+
+    def take(self, size: int) -> bytes:
+        if self.offset + size > len(self.data):
+            raise EOFError
+        chunk = self.data[self.offset : self.offset + size]
+        self.offset += size
+        return chunk
+
+    def unpack(self, fmt: str):
+        values = struct.unpack("<" + fmt, self.take(struct.calcsize("<" + fmt)))
+        return values if len(values) > 1 else values[0]
+
+    def cstring(self) -> str:
+        end = self.data.index(b"\0", self.offset)
+        text = self.data[self.offset : end].decode("utf-8", "replace")
+        self.offset = end + 1
+        return text
+
+
+def unpack_args(types: int, raw: bytes) -> list[tuple[int, object]]:
+    """(type, value) of each recorded argument"""
+    args = []
+    reader = Reader(raw)
+    for index in range(10):
+        kind = (types >> (3 * index)) & 7
+        if kind == 0:
+            break
+        try:
+            if kind == INT32:
+                value = reader.unpack("I")
+            elif kind == INT64:
+                value = reader.unpack("Q")
+            elif kind == DOUBLE:
+                value = reader.unpack("d")
+            elif kind == STRING:
+                value = reader.take(reader.unpack("B")).decode("utf-8", "replace")
+            elif kind == POINTER:
+                value = int.from_bytes(reader.take(POINTER_SIZE), "little")
+            else:
+                break
+            args.append((kind, value))
+        except EOFError:
+            break
+    return args
+
+
+def signed(value: int, bits: int) -> int:
+    return value - (1 << bits) if value >= 1 << (bits - 1) else value
+
+
+def format_message(fmt: str, args: list[tuple[int, object]]) -> str:
+    """printf as the device would, with the argument types that were recorded rather than the length modifiers"""
+    queue = list(args)
+
+    def take():
+        return queue.pop(0) if queue else (0, None)
+
+    def replace(match: re.Match) -> str:
+        flags, width, precision, _length, conversion = match.groups()
+        if conversion == "%":
+            return "%"
+        if width == "*":
+            width = str(signed(take()[1] or 0, 32))
+        if precision == "*":
+            precision = str(signed(take()[1] or 0, 32))
+        kind, value = take()
+        if value is None:
+            return "%" + conversion
+        spec = "%" + flags + (width or "") + ("." + precision if precision is not None else "")
+        if kind == STRING:
+            return (spec + "s") % value
+        if kind == DOUBLE:
+            return (spec + (conversion if conversion in "fFeEgG" else "f")) % value
+        if conversion == "p":
+            return (spec + "s") % hex(value)
+        if conversion in "di":
+            return (spec + "d") % signed(value, 64 if kind == INT64 else 32)
+        if conversion == "c":
+            return chr(value & 0xFF)
+        if conversion in "oxX":
+            return (spec + conversion) % value
+        return (spec + "d") % value
+
+    return CONVERSION.sub(replace, fmt)
+
+
+def decode(data: bytes, min_level: str, origin: str | None, out) -> None:
+    reader = Reader(data)
+    sites: dict[int, tuple[str, str, str]] = {}
+    keep = set(LEVEL_ORDER[: LEVEL_ORDER.index(min_level) + 1])
+    while reader.left() > 0:
+        try:
+            tag = reader.unpack("B")
+            if tag == 0:
+                if reader.take(4) != MAGIC:
+                    raise ValueError("bad session magic")
+                version, millis = reader.unpack("BI")
+                out.write(f"---- session (format {version}) started at {millis} ms ----\n")
+                sites.clear()
+            elif tag == 1:
+                site_id = reader.unpack("I")
+                level = LEVELS.get(chr(reader.unpack("B")), "???")
+                sites[site_id] = (level, reader.cstring(), reader.cstring())
+            elif tag == 2:
+                site_id, millis, types, size = reader.unpack("IIIH")
+                raw = reader.take(size)
+                level, site_origin, fmt = sites.get(site_id, ("???", "?", f"<unknown site {site_id:#x}>\n"))
+                if (level in keep or level == "???") and (origin is None or origin == site_origin):
+                    message = format_message(fmt, unpack_args(types, raw))
+                    out.write(f"[{millis}] [{level}] [{site_origin}] {message}")
+                    if not message.endswith("\n"):
+                        out.write("\n")
+            elif tag == 3:
+                out.write(f"[LOG] {reader.unpack('I')} messages dropped\n")
+            else:
+                raise ValueError(f"unknown entry {tag} at offset {reader.offset - 1}")
+        except (EOFError, ValueError) as error:
+            # A session cut short by a reset or power loss ends mid-entry; resynchronise on the next session
+            next_session = data.find(b"\0" + MAGIC, reader.offset)
+            if next_session < 0:
+                if not isinstance(error, EOFError):
+                    print(f"decode_binary_log: {error}", file=sys.stderr)
+                return
+            reader.offset = next_session
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description="Decode the binary log written with LOG_TO_SD")
+    parser.add_argument("file", help="log.bin copied from the SD card")
+    parser.add_argument("--level", choices=LEVEL_ORDER, default="DBG", help="most verbose level to print")
+    parser.add_argument("--origin", help="only print messages from this origin")
+    args = parser.parse_args()
+
+    with open(args.file, "rb") as f:
+        data = f.read()
+    decode(data, args.level, args.origin, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
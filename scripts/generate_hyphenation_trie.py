@@ -5,6 +5,10 @@ from __future__ import annotations
 
 import argparse
 import pathlib
+import re
+
+# Classes are direct-indexed in the dense tables, so their square bounds the depth-2 table
+MAX_DENSE_CLASSES = 96
 
 
 def _format_bytes(blob: bytes, per_line: int = 16) -> str:
@@ -18,6 +22,15 @@ def _format_bytes(blob: bytes, per_line: int = 16) -> str:
     return '\n'.join(lines)
 
 
+def _format_words(words: list[int], per_line: int = 8) -> str:
+    # Same wrapping as _format_bytes for uint32_t arrays.
+    lines = []
+    for i in range(0, len(words), per_line):
+        chunk = ', '.join(f"0x{w:08X}u" for w in words[i : i + per_line])
+        lines.append(f"    {chunk},")
+    return '\n'.join(lines)
+
+
 def _symbol_from_output(path: pathlib.Path) -> str:
     # Derive a stable C identifier from the destination header name (e.g., hyph-en.trie.h -> en).
     name = path.name
@@ -31,6 +44,135 @@ def _symbol_from_output(path: pathlib.Path) -> str:
     return name
 
 
+def read_blob(path: pathlib.Path) -> bytes:
+    # A hypher `.bin`, or a header this script wrote in the Typst layout, so committed languages can be re-encoded
+    # without the original `.bin`.
+    if path.suffix != '.h':
+        return path.read_bytes()
+    text = path.read_text()
+    data_part, _, descriptor = text.partition('constexpr SerializedHyphenationPatterns')
+    root = re.search(r'0x([0-9A-Fa-f]+)u', descriptor)
+    if not root or '_trie_data[]' not in data_part:
+        raise ValueError(f"{path} is not a Typst-layout header")
+    data = bytes(int(b, 16) for b in re.findall(r'0x([0-9A-Fa-f]{2}),', data_part))
+    return (int(root.group(1), 16) + 4).to_bytes(4, 'big') + data
+
+
+def decode_automaton(blob: bytes) -> tuple[int, dict[int, tuple[tuple[tuple[int, int], ...], list[tuple[int, int]]]]]:
+    # Decode every node reachable from the root into (levels, transitions). Levels are (dist, level) pairs with `dist`
+    # counted from the start of the match; transitions are (byte, target address) pairs sorted by byte.
+    root = int.from_bytes(blob[:4], 'big')
+    nodes = {}
+    pending = [root]
+    while pending:
+        addr = pending.pop()
+        if addr in nodes:
+            continue
+        header = blob[addr]
+        pos = addr + 1
+        stride = (header >> 5) & 0x03 or 1
+        count = header & 0x1F
+        if count == 31:
+            count = blob[pos]
+            pos += 1
+        levels = []
+        if header >> 7:
+            offset = (blob[pos] << 4) | (blob[pos + 1] >> 4)
+            length = blob[pos + 1] & 0x0F
+            pos += 2
+            dist = 0
+            for packed in blob[offset : offset + length]:
+                dist += packed // 10
+                levels.append((dist, packed % 10))
+        labels = blob[pos : pos + count]
+        pos += count
+        transitions = []
+        for i, label in enumerate(labels):
+            raw = int.from_bytes(blob[pos + i * stride : pos + (i + 1) * stride], 'big')
+            if stride == 3:
+                delta = raw - (1 << 23)
+            else:
+                bits = 8 * stride
+                delta = raw - (1 << bits) if raw >= 1 << (bits - 1) else raw
+            transitions.append((label, addr + delta))
+            pending.append(addr + delta)
+        nodes[addr] = (tuple(levels), sorted(transitions))
+    return root, nodes
+
+
+def encode_dense(blob: bytes) -> tuple[bytes, int, list[int], bytes, bytes] | None:
+    # Re-encode the automaton for the dense layout (see docs/hyphenation-trie-format.md), or None when it doesn't fit.
+    root, nodes = decode_automaton(blob)
+    if nodes[root][0]:
+        return None
+    alphabet = sorted({label for _, transitions in nodes.values() for label, _ in transitions})
+    class_count = len(alphabet) + 1
+    if class_count > MAX_DENSE_CLASSES:
+        return None
+    classes = bytearray(256)
+    for index, byte in enumerate(alphabet):
+        classes[byte] = index + 1
+
+    # Level data out of line, each distinct run once, as `dist << 4 | level`
+    levels = bytearray()
+    level_offsets = {}
+    for node_levels, _ in nodes.values():
+        if not node_levels or node_levels in level_offsets:
+            continue
+        if any(dist > 15 for dist, _ in node_levels) or len(node_levels) > 255:
+            return None
+        level_offsets[node_levels] = len(levels)
+        levels.extend((dist << 4) | level for dist, level in node_levels)
+    if len(levels) > 0xFFFF:
+        return None
+
+    # Node records, in breadth-first order so the nodes near the root sit together. Offset 0 is an empty node that
+    # stands for "no node" in the dense tables.
+    order = []
+    seen = {root}
+    queue = [root]
+    while queue:
+        addr = queue.pop(0)
+        if addr != root:
+            order.append(addr)
+        for _, target in nodes[addr][1]:
+            if target not in seen:
+                seen.add(target)
+                queue.append(target)
+
+    def record_size(addr: int) -> int:
+        node_levels, transitions = nodes[addr]
+        return 2 + (2 if node_levels else 0) + 4 * len(transitions)
+
+    offsets = {}
+    position = 2
+    for addr in order:
+        offsets[addr] = position
+        position += record_size(addr)
+    if position > 0xFFFFFF:
+        return None
+
+    records = bytearray(2)
+    for addr in order:
+        node_levels, transitions = nodes[addr]
+        if len(transitions) > 255:
+            return None
+        records += bytes((len(transitions), len(node_levels)))
+        if node_levels:
+            records += level_offsets[node_levels].to_bytes(2, 'little')
+        records += bytes(label for label, _ in transitions)
+        for _, target in transitions:
+            records += offsets[target].to_bytes(3, 'little')
+
+    dense = [0] * (class_count + class_count * class_count)
+    for first, child in nodes[root][1]:
+        first_class = classes[first]
+        dense[first_class] = offsets[child]
+        for second, grandchild in nodes[child][1]:
+            dense[class_count + first_class * class_count + classes[second]] = offsets[grandchild]
+    return bytes(classes), class_count, dense, bytes(records), bytes(levels)
+
+
 def write_header(path: pathlib.Path, blob: bytes, symbol: str) -> None:
     # Emit a constexpr header containing the raw bytes plus a SerializedHyphenationPatterns descriptor.
     # The binary format has:
@@ -76,12 +218,58 @@ constexpr SerializedHyphenationPatterns {patterns_symbol} = {{
     path.write_text(content)
 
 
+def write_dense_header(path: pathlib.Path, encoded: tuple[bytes, int, list[int], bytes, bytes], symbol: str) -> None:
+    # Emit the dense layout: the byte classes, the depth-1/depth-2 tables and the node and level arrays, tied together
+    # by a DenseHyphenationTrie that the SerializedHyphenationPatterns descriptor points at.
+    classes, class_count, dense, records, levels = encoded
+    path.parent.mkdir(parents=True, exist_ok=True)
+    content = f"""#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../SerializedHyphenationTrie.h"
+
+// Auto-generated by generate_hyphenation_trie.py. Do not edit manually.
+constexpr uint8_t {symbol}_trie_classes[256] = {{
+{_format_bytes(classes)}
+}};
+
+constexpr uint32_t {symbol}_trie_dense[] = {{
+{_format_words(dense)}
+}};
+
+constexpr uint8_t {symbol}_trie_nodes[] = {{
+{_format_bytes(records)}
+}};
+
+constexpr uint8_t {symbol}_trie_levels[] = {{
+{_format_bytes(levels)}
+}};
+
+constexpr DenseHyphenationTrie {symbol}_dense_trie = {{
+    {symbol}_trie_classes, {class_count}u, {symbol}_trie_dense, {symbol}_trie_nodes, sizeof({symbol}_trie_nodes),
+    {symbol}_trie_levels, sizeof({symbol}_trie_levels),
+}};
+
+constexpr SerializedHyphenationPatterns {symbol}_patterns = {{
+    0u,
+    nullptr,
+    0,
+    &{symbol}_dense_trie,
+}};
+"""
+    path.write_text(content)
+
+
 def main() -> None:
     parser = argparse.ArgumentParser()
     parser.add_argument('--input', dest='inputs', action='append', required=True,
-                        help='Path to a hypher-generated .bin trie')
+                        help='Path to a hypher-generated .bin trie, or to a Typst-layout header to re-encode')
     parser.add_argument('--output', dest='outputs', action='append', required=True,
                         help='Destination header path (hyph-*.trie.h)')
+    parser.add_argument('--layout', choices=('dense', 'typst'), default='dense',
+                        help='dense (default) falls back to typst for tries it cannot encode')
     args = parser.parse_args()
 
     if len(args.inputs) != len(args.outputs):
@@ -90,11 +278,20 @@ def main() -> None:
     for src, dst in zip(args.inputs, args.outputs):
         # Process each input/output pair independently so mixed-language refreshes work in one invocation.
         src_path = pathlib.Path(src)
-        blob = src_path.read_bytes()
+        blob = read_blob(src_path)
         out_path = pathlib.Path(dst)
         symbol = _symbol_from_output(out_path)
-        write_header(out_path, blob, symbol)
-        print(f'wrote {dst} ({len(blob)} bytes payload)')
+        encoded = encode_dense(blob) if args.layout == 'dense' else None
+        if encoded:
+            write_dense_header(out_path, encoded, symbol)
+            _, class_count, dense, records, levels = encoded
+            size = 256 + 4 * len(dense) + len(records) + len(levels)
+            print(f'wrote {dst} (dense, {class_count} classes, {size} bytes from {len(blob)})')
+        else:
+            if args.layout == 'dense':
+                print(f'{src}: dense layout does not fit, keeping the Typst layout')
+            write_header(out_path, blob, symbol)
+            print(f'wrote {dst} ({len(blob)} bytes payload)')
 
 
 if __name__ == '__main__':
@@ -0,0 +1,386 @@
+#include "BootSnapshot.h"
+
+#include <Fnv1a.h>
+#include <HalStorage.h>
+#include <Logging.h>
+#include <ObfuscationUtils.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "CrossPointSettings.h"
+#include "CrossPointState.h"
+#include "RecentBooksStore.h"
+
+namespace {
+constexpr char SNAPSHOT_FILE[] = "/.crosspoint/boot.bin";
+constexpr uint32_t SNAPSHOT_MAGIC = 0x53425043;  // "CPBS"
+constexpr uint8_t SNAPSHOT_VERSION = 2;
+// Settings, state and ten recent books come to a few KB; anything bigger is not a snapshot
+constexpr size_t MAX_SNAPSHOT_SIZE = 16 * 1024;
+// magic, version, FNV-1a of everything after the header
+constexpr size_t HEADER_SIZE = 4 + 1 + 4;
+
+// The settings JsonSettingsIO::saveSettings writes, so that a restored snapshot matches loading settings.json. Fields
+// that are not in the JSON keep their defaults either way.
+constexpr uint8_t CrossPointSettings::* const SETTINGS_FIELDS[] = {
+    &CrossPointSettings::sleepScreen,
+    &CrossPointSettings::sleepScreenCoverMode,
+    &CrossPointSettings::sleepScreenCoverFilter,
+    &CrossPointSettings::statusBar,
+    &CrossPointSettings::extraParagraphSpacing,
+    &CrossPointSettings::textAntiAliasing,
+    &CrossPointSettings::shortPwrBtn,
+    &CrossPointSettings::orientation,
+    &CrossPointSettings::sideButtonLayout,
+    &CrossPointSettings::frontButtonBack,
+    &CrossPointSettings::frontButtonConfirm,
+    &CrossPointSettings::frontButtonLeft,
+    &CrossPointSettings::frontButtonRight,
+    &CrossPointSettings::fontFamily,
+    &CrossPointSettings::fontSize,
+    &CrossPointSettings::lineSpacing,
+    &CrossPointSettings::paragraphAlignment,
+    &CrossPointSettings::sleepTimeout,
+    &CrossPointSettings::refreshFrequency,
+    &CrossPointSettings::screenMargin,
+    &CrossPointSettings::hideBatteryPercentage,
+    &CrossPointSettings::longPressChapterSkip,
+    &CrossPointSettings::hyphenationEnabled,
+    &CrossPointSettings::uiTheme,
+    &CrossPointSettings::fadingFix,
+    &CrossPointSettings::embeddedStyle,
+    &CrossPointSettings::statusBarChapterPageCount,
+    &CrossPointSettings::statusBarBookProgressPercentage,
+    &CrossPointSettings::statusBarProgressBar,
+    &CrossPointSettings::statusBarTitle,
+    &CrossPointSettings::statusBarBattery,
+    &CrossPointSettings::statusBarProgressBarThickness,
+};
+constexpr size_t SETTINGS_FIELD_COUNT = sizeof(SETTINGS_FIELDS) / sizeof(SETTINGS_FIELDS[0]);
+// Adding a setting changes this: give it a place in SETTINGS_FIELDS if it is saved to JSON, then update the size
+static_assert(sizeof(CrossPointSettings) == 291, "CrossPointSettings changed, check BootSnapshot's SETTINGS_FIELDS");
+
+// What a JSON file held when the snapshot was taken. FAT timestamps come from a clock the device doesn't have and
+// are only good to two seconds, so the bytes themselves are checksummed.
+struct FileStamp {
+  uint32_t size = 0;
+  uint32_t checksum = 0;
+
+  bool operator==(const FileStamp& other) const { return size == other.size && checksum == other.checksum; }
+};
+
+bool stampOf(const char* path, FileStamp& stamp) {
+  HalFile file = Storage.open(path);
+  if (!file || file.isDirectory()) {
+    return false;
+  }
+  stamp.size = static_cast<uint32_t>(file.fileSize());
+  stamp.checksum = FNV1A32_OFFSET_BASIS;
+  uint8_t buffer[256];
+  size_t remaining = stamp.size;
+  while (remaining > 0) {
+    const int bytesRead = file.read(buffer, std::min(remaining, sizeof(buffer)));
+    if (bytesRead <= 0) {
+      break;
+    }
+    stamp.checksum = fnv1a32(buffer, bytesRead, stamp.checksum);
+    remaining -= bytesRead;
+  }
+  file.close();
+  // An empty JSON file is treated as missing by the stores
+  return remaining == 0 && stamp.size > 0;
+}
+
+class Writer {
+  std::string& out;
+
+ public:
+  explicit Writer(std::string& out) : out(out) {}
+
+  template <typename T>
+  void pod(const T& value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+  void string(const char* text, const size_t length) {
+    const auto size = static_cast<uint16_t>(length);
+    pod(size);
+    out.append(text, size);
+  }
+  void string(const std::string& text) { string(text.data(), text.size()); }
+};
+
+// Reads from the snapshot buffer; any read past the end leaves ok false and returns zeroes
+class Reader {
+  const uint8_t* position;
+  const uint8_t* end;
+
+ public:
+  bool ok = true;
+
+  Reader(const uint8_t* data, const size_t size) : position(data), end(data + size) {}
+
+  bool atEnd() const { return position == end; }
+  template <typename T>
+  T pod() {
+    T value{};
+    if (ok && static_cast<size_t>(end - position) >= sizeof(T)) {
+      memcpy(&value, position, sizeof(T));
+      position += sizeof(T);
+    } else {
+      ok = false;
+    }
+    return value;
+  }
+  std::string string() {
+    const auto size = pod<uint16_t>();
+    if (!ok || static_cast<size_t>(end - position) < size) {
+      ok = false;
+      return {};
+    }
+    std::string text(reinterpret_cast<const char*>(position), size);
+    position += size;
+    return text;
+  }
+  Reader section(const size_t size) {
+    if (!ok || static_cast<size_t>(end - position) < size) {
+      ok = false;
+      return {position, 0};
+    }
+    Reader inner(position, size);
+    position += size;
+    return inner;
+  }
+};
+
+void copyString(char* destination, const size_t capacity, const std::string& source) {
+  strncpy(destination, source.c_str(), capacity - 1);
+  destination[capacity - 1] = '\0';
+}
+
+void writeSettings(Writer& out) {
+  const CrossPointSettings& settings = SETTINGS;
+  out.pod(static_cast<uint8_t>(SETTINGS_FIELD_COUNT));
+  for (const auto field : SETTINGS_FIELDS) {
+    out.pod(settings.*field);
+  }
+  out.string(settings.opdsServerUrl, strlen(settings.opdsServerUrl));
+  out.string(settings.opdsUsername, strlen(settings.opdsUsername));
+  // Same protection as in the JSON file
+  std::string password = settings.opdsPassword;
+  obfuscation::xorTransform(password);
+  out.string(password);
+}
+
+bool readSettings(Reader& in) {
+  uint8_t values[SETTINGS_FIELD_COUNT];
+  if (in.pod<uint8_t>() != SETTINGS_FIELD_COUNT) {
+    return false;
+  }
+  for (auto& value : values) {
+    value = in.pod<uint8_t>();
+  }
+  const std::string url = in.string();
+  const std::string username = in.string();
+  std::string password = in.string();
+  if (!in.ok || !in.atEnd()) {
+    return false;
+  }
+  obfuscation::xorTransform(password);
+
+  CrossPointSettings& settings = SETTINGS;
+  for (size_t i = 0; i < SETTINGS_FIELD_COUNT; i++) {
+    settings.*SETTINGS_FIELDS[i] = values[i];
+  }
+  copyString(settings.opdsServerUrl, sizeof(settings.opdsServerUrl), url);
+  copyString(settings.opdsUsername, sizeof(settings.opdsUsername), username);
+  copyString(settings.opdsPassword, sizeof(settings.opdsPassword), password);
+  return true;
+}
+
+void writeState(Writer& out) {
+  const CrossPointState& state = APP_STATE;
+  out.string(state.openEpubPath);
+  out.pod(state.lastSleepImage);
+  out.pod(state.readerActivityLoadCount);
+  out.pod(static_cast<uint8_t>(state.lastSleepFromReader));
+}
+
+bool readState(Reader& in) {
+  std::string openEpubPath = in.string();
+  const auto lastSleepImage = in.pod<uint8_t>();
+  const auto readerActivityLoadCount = in.pod<uint8_t>();
+  const auto lastSleepFromReader = in.pod<uint8_t>();
+  if (!in.ok || !in.atEnd()) {
+    return false;
+  }
+  CrossPointState& state = APP_STATE;
+  state.openEpubPath = std::move(openEpubPath);
+  state.lastSleepImage = lastSleepImage;
+  state.readerActivityLoadCount = readerActivityLoadCount;
+  state.lastSleepFromReader = lastSleepFromReader != 0;
+  return true;
+}
+
+void writeRecentBooks(Writer& out) {
+  const auto& books = RECENT_BOOKS.getBooks();
+  out.pod(static_cast<uint8_t>(books.size()));
+  for (const auto& book : books) {
+    out.string(book.path);
+    out.string(book.title);
+    out.string(book.author);
+    out.string(book.coverBmpPath);
+  }
+}
+
+bool readRecentBooks(Reader& in, std::vector<RecentBook>& books) {
+  const auto count = in.pod<uint8_t>();
+  books.reserve(count);
+  for (uint8_t i = 0; i < count && in.ok; i++) {
+    RecentBook book;
+    book.path = in.string();
+    book.title = in.string();
+    book.author = in.string();
+    book.coverBmpPath = in.string();
+    books.push_back(std::move(book));
+  }
+  return in.ok && in.atEnd();
+}
+
+struct Section {
+  BootSnapshot::Part part;
+  const char* jsonFile;
+};
+
+constexpr Section SECTIONS[] = {
+    {BootSnapshot::PART_SETTINGS, CrossPointSettings::JSON_FILE},
+    {BootSnapshot::PART_STATE, CrossPointState::JSON_FILE},
+    {BootSnapshot::PART_RECENT_BOOKS, RecentBooksStore::JSON_FILE},
+};
+
+bool active = false;
+}  // namespace
+
+uint8_t BootSnapshot::load() {
+  HalFile file = Storage.open(SNAPSHOT_FILE);
+  if (!file) {
+    return 0;
+  }
+  const size_t size = file.fileSize();
+  if (size < HEADER_SIZE || size > MAX_SNAPSHOT_SIZE) {
+    file.close();
+    return 0;
+  }
+  std::vector<uint8_t> buffer(size);
+  const bool complete = file.read(buffer.data(), size) == static_cast<int>(size);
+  file.close();
+
+  Reader in(buffer.data(), size);
+  const auto magic = in.pod<uint32_t>();
+  const auto version = in.pod<uint8_t>();
+  const auto checksum = in.pod<uint32_t>();
+  if (!complete || magic != SNAPSHOT_MAGIC || version != SNAPSHOT_VERSION ||
+      checksum != fnv1a32(buffer.data() + HEADER_SIZE, size - HEADER_SIZE)) {
+    LOG_DBG("BOOT", "Snapshot unusable, loading JSON");
+    return 0;
+  }
+
+  uint8_t restored = 0;
+  while (in.ok && !in.atEnd()) {
+    const auto part = in.pod<uint8_t>();
+    FileStamp taken;
+    taken.size = in.pod<uint32_t>();
+    taken.checksum = in.pod<uint32_t>();
+    Reader payload = in.section(in.pod<uint16_t>());
+    if (!in.ok) {
+      break;
+    }
+
+    const char* jsonFile = nullptr;
+    for (const auto& section : SECTIONS) {
+      if (section.part == part) {
+        jsonFile = section.jsonFile;
+      }
+    }
+    FileStamp current;
+    if (!jsonFile || (restored & part) || !stampOf(jsonFile, current) || !(current == taken)) {
+      LOG_DBG("BOOT", "Snapshot part %u is stale", part);
+      continue;
+    }
+
+    bool ok = false;
+    if (part == PART_SETTINGS) {
+      ok = readSettings(payload);
+    } else if (part == PART_STATE) {
+      ok = readState(payload);
+    } else if (part == PART_RECENT_BOOKS) {
+      std::vector<RecentBook> books;
+      ok = readRecentBooks(payload, books);
+      if (ok) {
+        RECENT_BOOKS.recentBooks = std::move(books);
+      }
+    }
+    if (ok) {
+      restored |= part;
+    }
+  }
+  return restored;
+}
+
+void BootSnapshot::bootComplete(const uint8_t restoredParts) {
+  active = true;
+  if (restoredParts != ALL_PARTS) {
+    save();
+  }
+}
+
+void BootSnapshot::save() {
+  if (!active) {
+    return;
+  }
+
+  std::string data;
+  data.reserve(1024);
+  Writer out(data);
+  out.pod(SNAPSHOT_MAGIC);
+  out.pod(SNAPSHOT_VERSION);
+  out.pod(uint32_t{0});  // Checksum, filled in below
+
+  for (const auto& section : SECTIONS) {
+    FileStamp stamp;
+    // Nothing to vouch for without the JSON file
+    if (!stampOf(section.jsonFile, stamp)) {
+      continue;
+    }
+    std::string payload;
+    Writer sectionOut(payload);
+    if (section.part == PART_SETTINGS) {
+      writeSettings(sectionOut);
+    } else if (section.part == PART_STATE) {
+      writeState(sectionOut);
+    } else {
+      writeRecentBooks(sectionOut);
+    }
+    out.pod(static_cast<uint8_t>(section.part));
+    out.pod(stamp.size);
+    out.pod(stamp.checksum);
+    out.string(payload);
+  }
+  const uint32_t checksum =
+      fnv1a32(data.data() + HEADER_SIZE, data.size() - HEADER_SIZE);
+  memcpy(&data[HEADER_SIZE - sizeof(checksum)], &checksum, sizeof(checksum));
+
+  FsFile file;
+  if (!Storage.openFileForWrite("BOOT", SNAPSHOT_FILE, file)) {
+    return;
+  }
+  const bool written = file.write(data.data(), data.size()) == data.size();
+  file.close();
+  if (!written) {
+    // A short snapshot fails its checksum, but don't leave it around
+    Storage.remove(SNAPSHOT_FILE);
+    LOG_ERR("BOOT", "Failed to write snapshot");
+  }
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * Binary copy of settings, app state and recent books in /.crosspoint/boot.bin, read in one go at boot.
+ *
+ * The JSON files stay the source of truth and the only thing users edit; loading them means three file reads and
+ * three ArduinoJson parses before the first screen. Each store's JSON save also rewrites the snapshot, which records
+ * the size and an FNV-1a checksum of each JSON file's bytes when it was taken. A section is only used if its JSON file
+ * still has that size and checksum, so a JSON file edited on a computer is loaded from JSON again (and the snapshot
+ * refreshed). Reading a few KB of JSON to checksum it is cheap next to parsing it.
+ * A missing, truncated or corrupt snapshot falls back to JSON for everything.
+ */
+class BootSnapshot {
+ public:
+  enum Part : uint8_t { PART_SETTINGS = 1 << 0, PART_STATE = 1 << 1, PART_RECENT_BOOKS = 1 << 2, ALL_PARTS = 0x07 };
+
+  // Restores every part whose JSON file is unchanged since the snapshot. Returns the restored parts; the caller loads
+  // the rest from JSON.
+  static uint8_t load();
+  // Boot has loaded every store. Saves are ignored until then, since a snapshot of half-loaded stores would be
+  // trusted at the next boot. Writes a fresh snapshot if any part came from JSON.
+  static void bootComplete(uint8_t restoredParts);
+  // Rewrites the snapshot from the stores in memory; called after each store's JSON save
+  static void save();
+};
@@ -8,6 +8,7 @@
 #include <cstring>
 #include <string>
 
+#include "BootSnapshot.h"
 #include "fontIds.h"
 
 // Initialize the static instance
@@ -24,7 +25,6 @@ void readAndValidate(FsFile& file, uint8_t& member, const uint8_t maxValue) {
 namespace {
 constexpr uint8_t SETTINGS_FILE_VERSION = 1;
 constexpr char SETTINGS_FILE_BIN[] = "/.crosspoint/settings.bin";
-constexpr char SETTINGS_FILE_JSON[] = "/.crosspoint/settings.json";
 constexpr char SETTINGS_FILE_BAK[] = "/.crosspoint/settings.bin.bak";
 
 // Convert legacy front button layout into explicit logical->hardware mapping.
@@ -79,13 +79,17 @@ void CrossPointSettings::validateFrontButtonMapping(CrossPointSettings& settings
 
 bool CrossPointSettings::saveToFile() const {
   Storage.mkdir("/.crosspoint");
-  return JsonSettingsIO::saveSettings(*this, SETTINGS_FILE_JSON);
+  if (!JsonSettingsIO::saveSettings(*this, JSON_FILE)) {
+    return false;
+  }
+  BootSnapshot::save();
+  return true;
 }
 
 bool CrossPointSettings::loadFromFile() {
   // Try JSON first
-  if (Storage.exists(SETTINGS_FILE_JSON)) {
-    String json = Storage.readFile(SETTINGS_FILE_JSON);
+  if (Storage.exists(JSON_FILE)) {
+    String json = Storage.readFile(JSON_FILE);
     if (!json.isEmpty()) {
       bool resave = false;
       bool result = JsonSettingsIO::loadSettings(*this, json.c_str(), &resave);
@@ -202,6 +202,8 @@ class CrossPointSettings {
 
   ~CrossPointSettings() = default;
 
+  static constexpr char JSON_FILE[] = "/.crosspoint/settings.json";
+
   // Get singleton instance
   static CrossPointSettings& getInstance() { return instance; }
 
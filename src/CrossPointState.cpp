@@ -5,10 +5,11 @@
 #include <Logging.h>
 #include <Serialization.h>
 
+#include "BootSnapshot.h"
+
 namespace {
 constexpr uint8_t STATE_FILE_VERSION = 4;
 constexpr char STATE_FILE_BIN[] = "/.crosspoint/state.bin";
-constexpr char STATE_FILE_JSON[] = "/.crosspoint/state.json";
 constexpr char STATE_FILE_BAK[] = "/.crosspoint/state.bin.bak";
 }  // namespace
 
@@ -16,13 +17,17 @@ CrossPointState CrossPointState::instance;
 
 bool CrossPointState::saveToFile() const {
   Storage.mkdir("/.crosspoint");
-  return JsonSettingsIO::saveState(*this, STATE_FILE_JSON);
+  if (!JsonSettingsIO::saveState(*this, JSON_FILE)) {
+    return false;
+  }
+  BootSnapshot::save();
+  return true;
 }
 
 bool CrossPointState::loadFromFile() {
   // Try JSON first
-  if (Storage.exists(STATE_FILE_JSON)) {
-    String json = Storage.readFile(STATE_FILE_JSON);
+  if (Storage.exists(JSON_FILE)) {
+    String json = Storage.readFile(JSON_FILE);
     if (!json.isEmpty()) {
       return JsonSettingsIO::loadState(*this, json.c_str());
     }
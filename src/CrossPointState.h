@@ -13,6 +13,8 @@ class CrossPointState {
   bool lastSleepFromReader = false;
   ~CrossPointState() = default;
 
+  static constexpr char JSON_FILE[] = "/.crosspoint/state.json";
+
   // Get singleton instance
   static CrossPointState& getInstance() { return instance; }
 
@@ -224,10 +224,11 @@ bool JsonSettingsIO::loadSettings(CrossPointSettings& s, const char* json, bool*
 
 bool JsonSettingsIO::saveKOReader(const KOReaderCredentialStore& store, const char* path) {
   JsonDocument doc;
-  doc["username"] = store.getUsername();
-  doc["password_obf"] = obfuscation::obfuscateToBase64(store.getPassword());
-  doc["serverUrl"] = store.getServerUrl();
-  doc["matchMethod"] = static_cast<uint8_t>(store.getMatchMethod());
+  // The fields directly: the getters would load the store, which is already loaded when it is saved
+  doc["username"] = store.username;
+  doc["password_obf"] = obfuscation::obfuscateToBase64(store.password);
+  doc["serverUrl"] = store.serverUrl;
+  doc["matchMethod"] = static_cast<uint8_t>(store.matchMethod);
 
   String json;
   serializeJson(doc, json);
@@ -0,0 +1,633 @@
+#include "LibraryCatalog.h"
+
+#include <BookCacheId.h>
+#include <BufferedFile.h>
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <functional>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "util/StringUtils.h"
+
+namespace {
+constexpr char CATALOG_FILE[] = "/.crosspoint/catalog.bin";
+constexpr char CATALOG_TMP_FILE[] = "/.crosspoint/catalog.bin.tmp";
+constexpr uint8_t CATALOG_VERSION = 2;
+constexpr size_t CATALOG_BLOCK_SIZE = 1024;
+
+struct Section {
+  std::string folder;
+  std::vector<CatalogEntry> entries;
+};
+
+// "/a/b/" and "a/b" both become "/a/b"; the root stays "/"
+std::string normalizeFolder(const std::string& path) {
+  std::string folder = path;
+  if (folder.empty() || folder[0] != '/') folder.insert(folder.begin(), '/');
+  while (folder.size() > 1 && folder.back() == '/') folder.pop_back();
+  return folder;
+}
+
+void splitPath(const std::string& path, std::string& folder, std::string& name) {
+  const std::string normalized = normalizeFolder(path);
+  const size_t slash = normalized.rfind('/');
+  folder = slash == 0 ? "/" : normalized.substr(0, slash);
+  name = normalized.substr(slash + 1);
+}
+
+bool isSameOrInside(const std::string& path, const std::string& base) {
+  if (base == "/") return true;
+  return path.compare(0, base.size(), base) == 0 && (path.size() == base.size() || path[base.size()] == '/');
+}
+
+// Strings are stored with a u8 length; longer ones are cut at a UTF-8 character boundary
+void writeShortString(BufferedWriter& writer, const std::string& s) {
+  size_t length = std::min<size_t>(s.size(), UINT8_MAX);
+  while (length < s.size() && length > 0 && (static_cast<uint8_t>(s[length]) & 0xC0) == 0x80) length--;
+  serialization::writePod(writer, static_cast<uint8_t>(length));
+  writer.write(s.data(), length);
+}
+
+bool readShortString(BufferedReader& reader, std::string& s) {
+  uint8_t length;
+  if (reader.read(&length, 1) != 1) return false;
+  s.resize(length);
+  return length == 0 || reader.read(&s[0], length) == length;
+}
+
+uint32_t entrySize(const CatalogEntry& entry) {
+  auto shortString = [](const std::string& s) { return 1 + std::min<size_t>(s.size(), UINT8_MAX); };
+  return shortString(entry.name) + 1 + 4 + 4 + shortString(entry.title) + shortString(entry.author) +
+         shortString(entry.language) + shortString(entry.cacheId);
+}
+
+void writeEntry(BufferedWriter& writer, const CatalogEntry& entry) {
+  writeShortString(writer, entry.name);
+  serialization::writePod(writer, entry.flags);
+  serialization::writePod(writer, entry.size);
+  serialization::writePod(writer, entry.modified);
+  writeShortString(writer, entry.title);
+  writeShortString(writer, entry.author);
+  writeShortString(writer, entry.language);
+  writeShortString(writer, entry.cacheId);
+}
+
+bool readEntry(BufferedReader& reader, CatalogEntry& entry) {
+  return readShortString(reader, entry.name) && reader.read(&entry.flags, 1) == 1 &&
+         reader.read(&entry.size, sizeof(entry.size)) == sizeof(entry.size) &&
+         reader.read(&entry.modified, sizeof(entry.modified)) == sizeof(entry.modified) &&
+         readShortString(reader, entry.title) && readShortString(reader, entry.author) &&
+         readShortString(reader, entry.language) && readShortString(reader, entry.cacheId);
+}
+
+// Section header: u16 folder length, folder, u16 entry count, u32 byte length of the entries that follow
+bool readSectionHeader(BufferedReader& reader, std::string& folder, uint16_t& count, uint32_t& bytes) {
+  uint16_t folderLength;
+  if (reader.read(&folderLength, sizeof(folderLength)) != sizeof(folderLength)) return false;
+  folder.resize(folderLength);
+  return (folderLength == 0 || reader.read(&folder[0], folderLength) == folderLength) &&
+         reader.read(&count, sizeof(count)) == sizeof(count) && reader.read(&bytes, sizeof(bytes)) == sizeof(bytes);
+}
+
+void writeSectionHeader(BufferedWriter& writer, const std::string& folder, const uint16_t count, const uint32_t bytes) {
+  serialization::writePod(writer, static_cast<uint16_t>(folder.size()));
+  writer.write(folder.data(), folder.size());
+  serialization::writePod(writer, count);
+  serialization::writePod(writer, bytes);
+}
+
+// Names in natural order, ignoring ASCII case: runs of digits compare by value, leading zeros aside
+bool naturalLess(const std::string_view a, const std::string_view b) {
+  size_t i = 0, j = 0;
+  while (i < a.size() && j < b.size()) {
+    if (isdigit(static_cast<unsigned char>(a[i])) && isdigit(static_cast<unsigned char>(b[j]))) {
+      while (i < a.size() && a[i] == '0') i++;
+      while (j < b.size() && b[j] == '0') j++;
+      // Count digits to compare lengths first
+      size_t len1 = 0, len2 = 0;
+      while (i + len1 < a.size() && isdigit(static_cast<unsigned char>(a[i + len1]))) len1++;
+      while (j + len2 < b.size() && isdigit(static_cast<unsigned char>(b[j + len2]))) len2++;
+      if (len1 != len2) return len1 < len2;
+      for (size_t k = 0; k < len1; k++) {
+        if (a[i + k] != b[j + k]) return a[i + k] < b[j + k];
+      }
+      i += len1;
+      j += len2;
+    } else {
+      const int c1 = tolower(static_cast<unsigned char>(a[i]));
+      const int c2 = tolower(static_cast<unsigned char>(b[j]));
+      if (c1 != c2) return c1 < c2;
+      i++;
+      j++;
+    }
+  }
+  // One is a prefix of the other
+  return i == a.size() && j < b.size();
+}
+
+bool listOrder(const bool aIsDirectory, const std::string_view a, const bool bIsDirectory, const std::string_view b) {
+  if (aIsDirectory != bIsDirectory) return aIsDirectory;
+  return naturalLess(a, b);
+}
+
+// Writes the section in list order
+void writeSection(BufferedWriter& writer, Section& section) {
+  std::sort(section.entries.begin(), section.entries.end(), [](const CatalogEntry& a, const CatalogEntry& b) {
+    return listOrder(a.isDirectory(), a.name, b.isDirectory(), b.name);
+  });
+  const size_t count = std::min<size_t>(section.entries.size(), UINT16_MAX);
+  uint32_t bytes = 0;
+  for (size_t i = 0; i < count; i++) bytes += entrySize(section.entries[i]);
+  writeSectionHeader(writer, section.folder, count, bytes);
+  for (size_t i = 0; i < count; i++) writeEntry(writer, section.entries[i]);
+}
+
+// Opens the catalog and checks its version. The file is left positioned at the first section.
+bool openCatalog(FsFile& file) {
+  if (!Storage.exists(CATALOG_FILE) || !Storage.openFileForRead("CAT", CATALOG_FILE, file)) {
+    return false;
+  }
+  uint8_t version;
+  if (file.read(&version, 1) != 1 || version != CATALOG_VERSION) {
+    LOG_ERR("CAT", "Unknown catalog version, ignoring it");
+    file.close();
+    return false;
+  }
+  return true;
+}
+
+// Streams the entries of `folder`'s section to `visit`, and its entry count to `sectionCount` if given. Returns false
+// if the folder has no section.
+template <typename Visitor>
+bool visitSection(const std::string& folder, Visitor&& visit, uint16_t* sectionCount = nullptr) {
+  FsFile file;
+  if (!openCatalog(file)) {
+    return false;
+  }
+  bool found = false;
+  {
+    BufferedReader reader(file, CATALOG_BLOCK_SIZE);
+    std::string sectionFolder;
+    uint16_t count;
+    uint32_t bytes;
+    while (!found && readSectionHeader(reader, sectionFolder, count, bytes)) {
+      if (sectionFolder != folder) {
+        if (!reader.seek(reader.position() + bytes)) break;
+        continue;
+      }
+      found = true;
+      if (sectionCount) *sectionCount = count;
+      CatalogEntry entry;
+      for (uint16_t i = 0; i < count && readEntry(reader, entry); i++) {
+        if (!visit(entry)) break;
+      }
+    }
+  }
+  file.close();
+  return found;
+}
+
+bool readSection(const std::string& folder, Section& section) {
+  section.folder = folder;
+  section.entries.clear();
+  return visitSection(folder, [&section](CatalogEntry& entry) {
+    section.entries.push_back(std::move(entry));
+    return true;
+  });
+}
+
+// Rewrites the catalog. Sections `touches` selects are parsed and handed to `edit`, which changes them in place or
+// returns false to drop them; all others are copied through unparsed. `appended` is added at the end.
+bool rewrite(const std::function<bool(const std::string&)>& touches, const std::function<bool(Section&)>& edit,
+             Section* appended = nullptr) {
+  Storage.mkdir("/.crosspoint");
+  FsFile out;
+  if (!Storage.openFileForWrite("CAT", CATALOG_TMP_FILE, out)) {
+    return false;
+  }
+
+  bool written;
+  bool copied = true;
+  {
+    BufferedWriter writer(out, CATALOG_BLOCK_SIZE);
+    serialization::writePod(writer, CATALOG_VERSION);
+
+    FsFile in;
+    if (openCatalog(in)) {
+      const size_t catalogSize = in.size();
+      BufferedReader reader(in, CATALOG_BLOCK_SIZE);
+      Section section;
+      uint16_t count;
+      uint32_t bytes;
+      while (readSectionHeader(reader, section.folder, count, bytes)) {
+        if (!touches(section.folder)) {
+          // A header must not go out ahead of a body that isn't all there: the next section would be read as the rest
+          // of it. A truncated catalog loses this section and whatever followed.
+          if (bytes > catalogSize - reader.position()) {
+            LOG_ERR("CAT", "Catalog section %s is truncated, dropping it", section.folder.c_str());
+            break;
+          }
+          writeSectionHeader(writer, section.folder, count, bytes);
+          uint8_t buffer[256];
+          uint32_t remaining = bytes;
+          while (remaining > 0) {
+            const int chunk = reader.read(buffer, std::min<uint32_t>(remaining, sizeof(buffer)));
+            if (chunk <= 0) break;
+            writer.write(buffer, chunk);
+            remaining -= chunk;
+          }
+          if (remaining > 0) {
+            // A read error after the header went out: keep the old catalog rather than commit a broken section
+            copied = false;
+            break;
+          }
+          continue;
+        }
+
+        section.entries.clear();
+        section.entries.resize(count);
+        bool complete = true;
+        for (auto& entry : section.entries) {
+          if (!readEntry(reader, entry)) {
+            complete = false;
+            break;
+          }
+        }
+        if (!complete) break;
+        if (edit(section)) {
+          writeSection(writer, section);
+        }
+      }
+      in.close();
+    }
+
+    if (appended) {
+      writeSection(writer, *appended);
+    }
+    written = writer.flush() && !writer.hasError() && copied;
+  }
+  out.close();
+
+  if (!written) {
+    LOG_ERR("CAT", "Failed to write library catalog");
+    Storage.remove(CATALOG_TMP_FILE);
+    return false;
+  }
+  Storage.remove(CATALOG_FILE);
+  return Storage.rename(CATALOG_TMP_FILE, CATALOG_FILE);
+}
+
+class CatalogLock {
+  SemaphoreHandle_t mutex;
+
+ public:
+  explicit CatalogLock(SemaphoreHandle_t mutex) : mutex(mutex) { xSemaphoreTakeRecursive(mutex, portMAX_DELAY); }
+  ~CatalogLock() { xSemaphoreGiveRecursive(mutex); }
+  CatalogLock(const CatalogLock&) = delete;
+  CatalogLock& operator=(const CatalogLock&) = delete;
+};
+
+bool hasSection(const std::string& folder) {
+  return visitSection(folder, [](const CatalogEntry&) { return false; });
+}
+}  // namespace
+
+LibraryCatalog LibraryCatalog::instance;
+
+bool LibraryCatalog::isBookFile(const std::string& fileName) {
+  return StringUtils::checkFileExtension(fileName, ".epub") || StringUtils::checkFileExtension(fileName, ".xtch") ||
+         StringUtils::checkFileExtension(fileName, ".xtc") || StringUtils::checkFileExtension(fileName, ".txt") ||
+         StringUtils::checkFileExtension(fileName, ".md") || StringUtils::checkFileExtension(fileName, ".bmp");
+}
+
+bool LibraryCatalog::listsBefore(const std::string& a, const std::string& b) {
+  const bool aIsDirectory = !a.empty() && a.back() == '/';
+  const bool bIsDirectory = !b.empty() && b.back() == '/';
+  return listOrder(aIsDirectory, std::string_view(a).substr(0, a.size() - aIsDirectory), bIsDirectory,
+                   std::string_view(b).substr(0, b.size() - bIsDirectory));
+}
+
+bool LibraryCatalog::loadFolderPage(const std::string& folder, const size_t first, const size_t max,
+                                    std::vector<std::string>& names, size_t& count) const {
+  CatalogLock lock(mutex);
+  names.clear();
+  uint16_t sectionCount = 0;
+  size_t index = 0;
+  const bool found = visitSection(
+      normalizeFolder(folder),
+      [&](const CatalogEntry& entry) {
+        if (index++ < first) return true;
+        if (names.size() >= max) return false;
+        names.push_back(entry.isDirectory() ? entry.name + "/" : entry.name);
+        return names.size() < max;
+      },
+      &sectionCount);
+  count = found ? sectionCount : 0;
+  return found;
+}
+
+bool LibraryCatalog::findInFolder(const std::string& folder, const std::string& name, size_t& index) const {
+  CatalogLock lock(mutex);
+  const bool isDirectory = !name.empty() && name.back() == '/';
+  const std::string entryName = isDirectory ? name.substr(0, name.size() - 1) : name;
+  size_t position = 0;
+  bool listed = false;
+  visitSection(normalizeFolder(folder), [&](const CatalogEntry& entry) {
+    if (entry.isDirectory() == isDirectory && entry.name == entryName) {
+      listed = true;
+      return false;
+    }
+    position++;
+    return true;
+  });
+  if (listed) index = position;
+  return listed;
+}
+
+bool LibraryCatalog::findEntry(const std::string& path, CatalogEntry& entry) const {
+  CatalogLock lock(mutex);
+  std::string folder, name;
+  splitPath(path, folder, name);
+  bool found = false;
+  visitSection(folder, [&](CatalogEntry& candidate) {
+    if (candidate.name != name) return true;
+    entry = std::move(candidate);
+    found = true;
+    return false;
+  });
+  return found;
+}
+
+bool LibraryCatalog::rescanFolder(const std::string& folderPath, bool* changed) {
+  CatalogLock lock(mutex);
+  if (changed) *changed = false;
+  const std::string folder = normalizeFolder(folderPath);
+
+  auto dir = Storage.open(folder.c_str());
+  if (!dir || !dir.isDirectory()) {
+    if (dir) dir.close();
+    return false;
+  }
+
+  Section previous;
+  const bool known = readSection(folder, previous);
+  std::unordered_map<std::string, size_t> previousIndex;
+  for (size_t i = 0; i < previous.entries.size(); i++) {
+    previousIndex.emplace(previous.entries[i].name, i);
+  }
+
+  Section scanned{folder, {}};
+  std::unordered_set<std::string> subfolders;
+  bool different = !known;
+  dir.rewindDirectory();
+  char name[500];
+  for (auto file = dir.openNextFile(); file; file = dir.openNextFile()) {
+    file.getName(name, sizeof(name));
+    const bool isDirectory = file.isDirectory();
+    if (name[0] == '.' || strcmp(name, "System Volume Information") == 0 || (!isDirectory && !isBookFile(name))) {
+      file.close();
+      continue;
+    }
+
+    CatalogEntry entry;
+    entry.name = name;
+    entry.flags = isDirectory ? CatalogEntry::FLAG_DIRECTORY : 0;
+    entry.size = isDirectory ? 0 : file.fileSize();
+    uint16_t date = 0, time = 0;
+    if (file.getModifyDateTime(&date, &time)) {
+      entry.modified = static_cast<uint32_t>(date) << 16 | time;
+    }
+    file.close();
+
+    const auto it = previousIndex.find(entry.name);
+    if (it != previousIndex.end()) {
+      CatalogEntry& old = previous.entries[it->second];
+      if (old.isDirectory() == isDirectory && old.size == entry.size && old.modified == entry.modified) {
+        entry = std::move(old);
+      } else {
+        different = true;
+      }
+    } else {
+      different = true;
+    }
+    if (isDirectory) subfolders.insert(entry.name);
+    scanned.entries.push_back(std::move(entry));
+  }
+  dir.close();
+  different = different || scanned.entries.size() != previous.entries.size();
+
+  if (!different) {
+    return true;
+  }
+  const size_t entryCount = scanned.entries.size();
+
+  // Sections of subfolders that are gone go with them
+  const std::string prefix = folder == "/" ? "/" : folder + "/";
+  const auto isStale = [&](const std::string& sectionFolder) {
+    if (sectionFolder == folder || sectionFolder.compare(0, prefix.size(), prefix) != 0) return false;
+    const size_t end = sectionFolder.find('/', prefix.size());
+    return subfolders.count(sectionFolder.substr(prefix.size(), end - prefix.size())) == 0;
+  };
+  const bool ok = rewrite(
+      [&](const std::string& sectionFolder) { return sectionFolder == folder || isStale(sectionFolder); },
+      [&](Section& section) {
+        if (section.folder != folder) return false;
+        section.entries = std::move(scanned.entries);
+        return true;
+      },
+      known ? nullptr : &scanned);
+  if (ok && changed) *changed = true;
+  LOG_DBG("CAT", "Rescanned %s: %u entries", folder.c_str(), entryCount);
+  return ok;
+}
+
+void LibraryCatalog::onFileWritten(const std::string& path) {
+  CatalogLock lock(mutex);
+  std::string folder, name;
+  splitPath(path, folder, name);
+  if (!isBookFile(name) || !hasSection(folder)) {
+    return;
+  }
+
+  CatalogEntry written;
+  written.name = name;
+  {
+    FsFile file;
+    if (!Storage.openFileForRead("CAT", path, file)) {
+      return;
+    }
+    written.size = file.fileSize();
+    uint16_t date = 0, time = 0;
+    if (file.getModifyDateTime(&date, &time)) {
+      written.modified = static_cast<uint32_t>(date) << 16 | time;
+    }
+    file.close();
+  }
+  written.cacheId = BookCacheId::calculate(path);
+
+  rewrite([&folder](const std::string& sectionFolder) { return sectionFolder == folder; },
+          [&written](Section& section) {
+            const auto it = std::find_if(section.entries.begin(), section.entries.end(),
+                                         [&written](const CatalogEntry& entry) { return entry.name == written.name; });
+            if (it != section.entries.end()) {
+              *it = written;
+            } else {
+              section.entries.push_back(written);
+            }
+            return true;
+          });
+}
+
+void LibraryCatalog::updateBook(const BookMetadata& book) { updateBooks({book}); }
+
+void LibraryCatalog::updateBooks(const std::vector<BookMetadata>& books) {
+  CatalogLock lock(mutex);
+
+  // Skip books the catalog doesn't list or already knows this much about, and the rewrite if that leaves none
+  std::vector<std::pair<std::string, CatalogEntry>> changes;
+  for (const auto& book : books) {
+    CatalogEntry entry;
+    if (!findEntry(book.path, entry)) continue;
+    const size_t separator = book.cachePath.rfind('_');
+    const std::string cacheId = separator == std::string::npos ? "" : book.cachePath.substr(separator + 1);
+    if (entry.title == book.title && entry.author == book.author && entry.language == book.language &&
+        entry.hasCover() == book.hasCover && entry.cacheId == cacheId) {
+      continue;
+    }
+    entry.title = book.title;
+    entry.author = book.author;
+    entry.language = book.language;
+    entry.cacheId = cacheId;
+    entry.flags = book.hasCover ? entry.flags | CatalogEntry::FLAG_HAS_COVER
+                                : entry.flags & ~CatalogEntry::FLAG_HAS_COVER;
+    std::string folder;
+    splitPath(book.path, folder, entry.name);
+    changes.emplace_back(std::move(folder), std::move(entry));
+  }
+  if (changes.empty()) {
+    return;
+  }
+
+  rewrite(
+      [&changes](const std::string& sectionFolder) {
+        return std::any_of(changes.begin(), changes.end(),
+                           [&sectionFolder](const auto& change) { return change.first == sectionFolder; });
+      },
+      [&changes](Section& section) {
+        for (auto& entry : section.entries) {
+          for (const auto& change : changes) {
+            if (change.first == section.folder && change.second.name == entry.name) {
+              entry = change.second;
+            }
+          }
+        }
+        return true;
+      });
+}
+
+bool LibraryCatalog::nextBooks(CatalogCursor& cursor, const size_t max,
+                               std::vector<std::pair<std::string, CatalogEntry>>& books) const {
+  CatalogLock lock(mutex);
+  books.clear();
+  FsFile file;
+  if (!openCatalog(file)) {
+    return false;
+  }
+
+  {
+    BufferedReader reader(file, CATALOG_BLOCK_SIZE);
+    std::string folder;
+    uint16_t count;
+    uint32_t bytes;
+    bool full = false;
+    for (uint16_t section = 0; !full && readSectionHeader(reader, folder, count, bytes); section++) {
+      if (section < cursor.section) {
+        if (!reader.seek(reader.position() + bytes)) break;
+        continue;
+      }
+      if (section > cursor.section) {
+        cursor = {section, 0};
+      }
+      CatalogEntry entry;
+      uint16_t index = 0;
+      for (; index < count && readEntry(reader, entry); index++) {
+        if (index < cursor.entry || entry.isDirectory()) continue;
+        if (books.size() == max) {
+          full = true;
+          break;
+        }
+        books.emplace_back(folder == "/" ? "/" + entry.name : folder + "/" + entry.name, std::move(entry));
+        cursor.entry = index + 1;
+      }
+      if (!full && index < count) break;  // truncated
+      if (!full) cursor = {static_cast<uint16_t>(section + 1), 0};
+    }
+  }
+  file.close();
+  return !books.empty();
+}
+
+void LibraryCatalog::onMoved(const std::string& fromPath, const std::string& toPath) {
+  CatalogLock lock(mutex);
+  const std::string from = normalizeFolder(fromPath);
+  const std::string to = normalizeFolder(toPath);
+  std::string fromFolder, fromName, toFolder, toName;
+  splitPath(from, fromFolder, fromName);
+  splitPath(to, toFolder, toName);
+
+  CatalogEntry moved;
+  const bool found = findEntry(from, moved);
+  moved.name = toName;
+
+  rewrite(
+      [&](const std::string& sectionFolder) {
+        return sectionFolder == fromFolder || sectionFolder == toFolder || isSameOrInside(sectionFolder, from);
+      },
+      [&](Section& section) {
+        if (isSameOrInside(section.folder, from)) {
+          section.folder = to + section.folder.substr(from.size());
+        }
+        if (section.folder == fromFolder || section.folder == toFolder) {
+          auto& entries = section.entries;
+          entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                       [&](const CatalogEntry& entry) {
+                                         return (section.folder == fromFolder && entry.name == fromName) ||
+                                                (section.folder == toFolder && entry.name == toName);
+                                       }),
+                        entries.end());
+          if (section.folder == toFolder && found) {
+            entries.push_back(moved);
+          }
+        }
+        return true;
+      });
+}
+
+void LibraryCatalog::onRemoved(const std::string& path) {
+  CatalogLock lock(mutex);
+  const std::string removed = normalizeFolder(path);
+  std::string folder, name;
+  splitPath(removed, folder, name);
+
+  rewrite(
+      [&](const std::string& sectionFolder) {
+        return sectionFolder == folder || isSameOrInside(sectionFolder, removed);
+      },
+      [&](Section& section) {
+        if (isSameOrInside(section.folder, removed)) {
+          return false;
+        }
+        auto& entries = section.entries;
+        entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                     [&name](const CatalogEntry& entry) { return entry.name == name; }),
+                      entries.end());
+        return true;
+      });
+}
@@ -0,0 +1,112 @@
+#pragma once
+#include <freertos/semphr.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct CatalogEntry {
+  static constexpr uint8_t FLAG_DIRECTORY = 1 << 0;
+  static constexpr uint8_t FLAG_HAS_COVER = 1 << 1;
+
+  std::string name;  // file name, without the folder
+  uint8_t flags = 0;
+  uint32_t size = 0;
+  uint32_t modified = 0;  // FAT date << 16 | FAT time
+  std::string title;
+  std::string author;
+  std::string language;
+  std::string cacheId;  // BookCacheId of the content, empty until known
+
+  bool isDirectory() const { return flags & FLAG_DIRECTORY; }
+  bool hasCover() const { return flags & FLAG_HAS_COVER; }
+};
+
+// Metadata a reader or the thumbnail worker learned by loading a book
+struct BookMetadata {
+  std::string path;
+  std::string title;
+  std::string author;
+  std::string language;
+  bool hasCover = false;
+  std::string cachePath;  // the book's cache directory, whose name carries its cache id
+};
+
+// Position of a walk over every book in the catalog (see nextBooks). Section order survives updates, so a cursor
+// stays usable across them; a rescan that drops or reorders entries can make a walk skip or repeat a few.
+struct CatalogCursor {
+  uint16_t section = 0;
+  uint16_t entry = 0;
+};
+
+/**
+ * Persistent catalog of the books and folders on the SD card, in /.crosspoint/catalog.bin.
+ *
+ * The catalog holds one section per folder that has been browsed, listing the folder's books and subfolders with
+ * their size and modified time, plus the title, author, language, cover flag and cache id of books that have been
+ * opened or indexed. Library screens list a folder from its section without walking the directory first, then call
+ * rescanFolder() to pick up changes made behind the catalog's back (e.g. with the card in a computer).
+ *
+ * A rescan still walks the directory, but only entries whose size or modified time changed lose their metadata.
+ * Writers on the device (uploads, WebDAV, the file browser and the readers) update the catalog eagerly, so a rescan
+ * usually finds nothing to do and the file is left alone.
+ *
+ * The file is only ever streamed: a lookup reads just the section it needs, and an update copies untouched sections
+ * through byte for byte, so neither holds more than one folder in memory. Each section is kept in list order, so a
+ * screen reads only the page it shows. Calls are serialized by a mutex, as the
+ * thumbnail worker walks and updates the catalog from its own task.
+ */
+class LibraryCatalog {
+  static LibraryCatalog instance;
+
+  SemaphoreHandle_t mutex;
+
+ public:
+  LibraryCatalog() : mutex(xSemaphoreCreateRecursiveMutex()) {}
+  static LibraryCatalog& getInstance() { return instance; }
+
+  // File types the library lists
+  static bool isBookFile(const std::string& fileName);
+
+  // Order the library lists a folder in: folders first, then names in natural order ("Vol 2" before "Vol 10"),
+  // ignoring ASCII case. Takes names as loadFolderPage() gives them. Sections are kept in this order.
+  static bool listsBefore(const std::string& a, const std::string& b);
+
+  // Entries `first` to `first + max` of `folder` in list order, as of the last scan, with a trailing '/' on folders.
+  // `count` receives the number of entries in the folder. Only reads the section up to the last entry wanted. Returns
+  // false if the folder has no section yet.
+  bool loadFolderPage(const std::string& folder, size_t first, size_t max, std::vector<std::string>& names,
+                      size_t& count) const;
+
+  // Position of `name` (trailing '/' for a folder) in `folder`'s list order. Returns false if the folder doesn't
+  // list it.
+  bool findInFolder(const std::string& folder, const std::string& name, size_t& index) const;
+
+  // Entry for the file or folder at `path`, if its folder has been scanned and lists it
+  bool findEntry(const std::string& path, CatalogEntry& entry) const;
+
+  // Walks `folder` and brings its section up to date, creating it if needed. Entries whose size and modified time
+  // still match keep their metadata. `changed` is set if the section had to be written.
+  bool rescanFolder(const std::string& folder, bool* changed = nullptr);
+
+  // A book was written at `path` (an upload or WebDAV PUT). Records its new size, modified time and cache id and
+  // forgets the previous content's metadata. Only updates folders that already have a section.
+  void onFileWritten(const std::string& path);
+
+  // A reader loaded a book's metadata
+  void updateBook(const BookMetadata& book);
+  // Same for several books at once, in one rewrite of the catalog
+  void updateBooks(const std::vector<BookMetadata>& books);
+
+  // Up to `max` books (not folders) from `cursor` on, as full paths with their entries. Returns false once the walk
+  // has passed the last book.
+  bool nextBooks(CatalogCursor& cursor, size_t max, std::vector<std::pair<std::string, CatalogEntry>>& books) const;
+
+  // A book or folder was renamed or moved. Entries keep their metadata and a moved folder keeps its sections.
+  void onMoved(const std::string& fromPath, const std::string& toPath);
+
+  // A book or folder was deleted
+  void onRemoved(const std::string& path);
+};
+
+#define LIBRARY_CATALOG LibraryCatalog::getInstance()
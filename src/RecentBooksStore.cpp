@@ -9,12 +9,12 @@
 
 #include <algorithm>
 
+#include "BootSnapshot.h"
 #include "util/StringUtils.h"
 
 namespace {
 constexpr uint8_t RECENT_BOOKS_FILE_VERSION = 3;
 constexpr char RECENT_BOOKS_FILE_BIN[] = "/.crosspoint/recent.bin";
-constexpr char RECENT_BOOKS_FILE_JSON[] = "/.crosspoint/recent.json";
 constexpr char RECENT_BOOKS_FILE_BAK[] = "/.crosspoint/recent.bin.bak";
 constexpr int MAX_RECENT_BOOKS = 10;
 }  // namespace
@@ -66,7 +66,11 @@ void RecentBooksStore::updateBook(const std::string& path, const std::string& ti
 
 bool RecentBooksStore::saveToFile() const {
   Storage.mkdir("/.crosspoint");
-  return JsonSettingsIO::saveRecentBooks(*this, RECENT_BOOKS_FILE_JSON);
+  if (!JsonSettingsIO::saveRecentBooks(*this, JSON_FILE)) {
+    return false;
+  }
+  BootSnapshot::save();
+  return true;
 }
 
 RecentBook RecentBooksStore::getDataFromBook(std::string path) const {
@@ -101,8 +105,8 @@ RecentBook RecentBooksStore::getDataFromBook(std::string path) const {
 
 bool RecentBooksStore::loadFromFile() {
   // Try JSON first
-  if (Storage.exists(RECENT_BOOKS_FILE_JSON)) {
-    String json = Storage.readFile(RECENT_BOOKS_FILE_JSON);
+  if (Storage.exists(JSON_FILE)) {
+    String json = Storage.readFile(JSON_FILE);
     if (!json.isEmpty()) {
       return JsonSettingsIO::loadRecentBooks(*this, json.c_str());
     }
@@ -11,6 +11,7 @@ struct RecentBook {
   bool operator==(const RecentBook& other) const { return path == other.path; }
 };
 
+class BootSnapshot;
 class RecentBooksStore;
 namespace JsonSettingsIO {
 bool loadRecentBooks(RecentBooksStore& store, const char* json);
@@ -23,10 +24,13 @@ class RecentBooksStore {
   std::vector<RecentBook> recentBooks;
 
   friend bool JsonSettingsIO::loadRecentBooks(RecentBooksStore&, const char*);
+  friend class BootSnapshot;
 
  public:
   ~RecentBooksStore() = default;
 
+  static constexpr char JSON_FILE[] = "/.crosspoint/recent.json";
+
   // Get singleton instance
   static RecentBooksStore& getInstance() { return instance; }
 
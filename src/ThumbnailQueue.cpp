@@ -0,0 +1,399 @@
+#include "ThumbnailQueue.h"
+
+#include <Epub.h>
+#include <Epub/Section.h>
+#include <HalGPIO.h>
+#include <HalPowerManager.h>
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Txt.h>
+#include <Xtc.h>
+
+#include <algorithm>
+
+#include "CrossPointSettings.h"
+#include "components/UITheme.h"
+#include "util/StringUtils.h"
+
+namespace {
+constexpr size_t SWEEP_BATCH_SIZE = 8;
+// Sweep jobs wait while the heap is tighter than this; a cover decode needs a few tens of KB on top of the book
+constexpr uint32_t SWEEP_MIN_FREE_HEAP = 96 * 1024;
+// The worker also wakes this often to notice a charger being plugged in or the heap freeing up
+constexpr uint32_t IDLE_POLL_MS = 5000;
+// Catalog updates from a sweep are written in batches, as each one rewrites the catalog
+constexpr size_t METADATA_BATCH_SIZE = 16;
+
+class QueueLock {
+  SemaphoreHandle_t mutex;
+
+ public:
+  explicit QueueLock(SemaphoreHandle_t mutex) : mutex(mutex) { xSemaphoreTake(mutex, portMAX_DELAY); }
+  ~QueueLock() { xSemaphoreGive(mutex); }
+  QueueLock(const QueueLock&) = delete;
+  QueueLock& operator=(const QueueLock&) = delete;
+};
+
+// Mirrors Epub/Xtc::getThumbBmpPath(height) for a cache directory known from the catalog
+std::string thumbPath(const std::string& cacheDir, const int height) {
+  return cacheDir + "/thumb_" + std::to_string(height) + ".bmp";
+}
+}  // namespace
+
+ThumbnailQueue ThumbnailQueue::instance;
+
+void ThumbnailQueue::begin(const HalGPIO& gpio, GfxRenderer& renderer) {
+  this->gpio = &gpio;
+  this->renderer = &renderer;
+  queueMutex = xSemaphoreCreateMutex();
+  workMutex = xSemaphoreCreateMutex();
+  xTaskCreate(&taskTrampoline, "ThumbnailQueue",
+              8192,        // Stack size
+              this,        // Parameters
+              0,           // Priority: below the main loop and render task
+              &taskHandle  // Task handle
+  );
+  assert(taskHandle != nullptr && "Failed to create thumbnail task");
+}
+
+void ThumbnailQueue::taskTrampoline(void* param) {
+  auto* self = static_cast<ThumbnailQueue*>(param);
+  self->taskLoop();
+}
+
+void ThumbnailQueue::taskLoop() {
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(IDLE_POLL_MS));
+
+    Job job;
+    while (true) {
+      xSemaphoreTake(workMutex, portMAX_DELAY);
+      if (!nextJob(job)) {
+        flushMetadata();
+        xSemaphoreGive(workMutex);
+        break;
+      }
+      {
+        HalPowerManager::Lock powerLock;
+        process(job);
+      }
+      {
+        QueueLock lock(queueMutex);
+        currentBook.clear();
+        if (currentIsIndex) {
+          currentIsIndex = false;
+          indexedCount++;
+        }
+      }
+      if (pendingMetadata.size() >= METADATA_BATCH_SIZE) {
+        flushMetadata();
+      }
+      xSemaphoreGive(workMutex);
+    }
+  }
+}
+
+bool ThumbnailQueue::sweepAllowed() const { return sweepRequested || (gpio && gpio->isUsbConnected()); }
+
+bool ThumbnailQueue::nextJob(Job& job) {
+  CatalogCursor cursor;
+  {
+    QueueLock lock(queueMutex);
+    if (!running) {
+      return false;
+    }
+    if (!requests.empty()) {
+      job = std::move(requests.front());
+      requests.pop_front();
+      currentBook = job.bookPath;
+      return true;
+    }
+    if (!sweepAllowed() || ESP.getFreeHeap() < SWEEP_MIN_FREE_HEAP) {
+      return false;
+    }
+    if (!indexRequests.empty()) {
+      job = std::move(indexRequests.front());
+      indexRequests.pop_front();
+      currentBook = job.bookPath;
+      currentIsIndex = true;
+      return true;
+    }
+    if (sweepDone) {
+      return false;
+    }
+    if (!sweepBatch.empty()) {
+      job = std::move(sweepBatch.front());
+      sweepBatch.erase(sweepBatch.begin());
+      currentBook = job.bookPath;
+      return true;
+    }
+    cursor = sweepCursor;
+  }
+
+  // Refill the batch from the catalog without holding the queue, so screens can keep queueing requests
+  std::vector<std::pair<std::string, CatalogEntry>> books;
+  const bool more = LIBRARY_CATALOG.nextBooks(cursor, SWEEP_BATCH_SIZE, books);
+
+  QueueLock lock(queueMutex);
+  sweepCursor = cursor;
+  if (!more) {
+    sweepDone = true;
+    LOG_DBG("THQ", "Library sweep done");
+    return false;
+  }
+  for (auto& [path, entry] : books) {
+    Job sweepJob;
+    sweepJob.bookPath = std::move(path);
+    sweepJob.cacheId = entry.cacheId;
+    sweepJob.catalog = std::move(entry);
+    sweepJob.fromSweep = true;
+    sweepBatch.push_back(std::move(sweepJob));
+  }
+  job = std::move(sweepBatch.front());
+  sweepBatch.erase(sweepBatch.begin());
+  currentBook = job.bookPath;
+  return true;
+}
+
+void ThumbnailQueue::process(const Job& job) {
+  const bool isEpub = StringUtils::checkFileExtension(job.bookPath, ".epub");
+  const bool isXtc = StringUtils::checkFileExtension(job.bookPath, ".xtch") ||
+                     StringUtils::checkFileExtension(job.bookPath, ".xtc");
+  const std::vector<int> heights = job.height > 0 ? std::vector<int>{job.height} : UITheme::getCoverThumbHeights();
+  if (job.preindex) {
+    preindex(job, heights);
+    return;
+  }
+  if (!isEpub && !isXtc) {
+    return;
+  }
+
+  // A sweep skips books it has already been through without loading them: either every thumbnail is there, or the
+  // catalog knows the book and that it has no cover
+  if (job.fromSweep && !job.cacheId.empty()) {
+    if (!job.catalog.title.empty() && !job.catalog.hasCover()) {
+      return;
+    }
+    const std::string cacheDir = std::string("/.crosspoint/") + (isEpub ? "epub_" : "xtc_") + job.cacheId;
+    if (std::all_of(heights.begin(), heights.end(),
+                    [&cacheDir](const int height) { return Storage.exists(thumbPath(cacheDir, height).c_str()); })) {
+      return;
+    }
+  }
+
+  const unsigned long start = millis();
+  int generated = 0;
+  if (isEpub) {
+    Epub epub(job.bookPath, "/.crosspoint");
+    // Builds the metadata cache of books that were never opened; CSS isn't needed for the cover
+    if (!epub.load(true, true)) {
+      LOG_ERR("THQ", "Failed to load %s", job.bookPath.c_str());
+      completedCount++;
+      return;
+    }
+    for (const int height : heights) {
+      if (Storage.exists(epub.getThumbBmpPath(height).c_str())) continue;
+      if (!epub.hasCover() || !epub.generateThumbBmp(height)) break;
+      generated++;
+    }
+    pendingMetadata.push_back({job.bookPath, epub.getTitle(), epub.getAuthor(), epub.getLanguage(), epub.hasCover(),
+                               epub.getCachePath()});
+  } else {
+    Xtc xtc(job.bookPath, "/.crosspoint");
+    if (!xtc.load()) {
+      LOG_ERR("THQ", "Failed to load %s", job.bookPath.c_str());
+      completedCount++;
+      return;
+    }
+    for (const int height : heights) {
+      if (Storage.exists(xtc.getThumbBmpPath(height).c_str())) continue;
+      if (!xtc.generateThumbBmp(height)) break;
+      generated++;
+    }
+    pendingMetadata.push_back({job.bookPath, xtc.getTitle(), xtc.getAuthor(), "", true, xtc.getCachePath()});
+  }
+
+  completedCount++;
+  LOG_DBG("THQ", "%s: %d thumbnail(s) in %lu ms", job.bookPath.c_str(), generated, millis() - start);
+}
+
+void ThumbnailQueue::preindex(const Job& job, const std::vector<int>& heights) {
+  const unsigned long start = millis();
+  bool ok = true;
+  if (StringUtils::checkFileExtension(job.bookPath, ".epub")) {
+    auto epub = std::make_shared<Epub>(job.bookPath, "/.crosspoint");
+    // Unlike a thumbnail job this builds the CSS cache too, as the reader will need it
+    if (!epub->load(true, false)) {
+      LOG_ERR("THQ", "Failed to index %s", job.bookPath.c_str());
+      return;
+    }
+    if (epub->hasCover()) {
+      const bool cropped = SETTINGS.sleepScreenCoverMode == CrossPointSettings::SLEEP_SCREEN_COVER_MODE::CROP;
+      ok = epub->generateCoverBmp(cropped);
+      for (const int height : heights) {
+        if (!ok) break;
+        ok = Storage.exists(epub->getThumbBmpPath(height).c_str()) || epub->generateThumbBmp(height);
+      }
+    }
+    // Parsing the XHTML is the slow part of laying out a chapter and doesn't depend on the layout settings, so the
+    // reader's first page only has to paginate
+    const int firstSpineIndex = std::max(epub->getSpineIndexForTextReference(), 0);
+    if (firstSpineIndex < epub->getSpineItemsCount()) {
+      Section section(epub, firstSpineIndex, *renderer);
+      ok = section.prepareParsedContent(SETTINGS.embeddedStyle) && ok;
+    }
+    pendingMetadata.push_back({job.bookPath, epub->getTitle(), epub->getAuthor(), epub->getLanguage(),
+                               epub->hasCover(), epub->getCachePath()});
+  } else if (StringUtils::checkFileExtension(job.bookPath, ".xtch") ||
+             StringUtils::checkFileExtension(job.bookPath, ".xtc")) {
+    Xtc xtc(job.bookPath, "/.crosspoint");
+    if (!xtc.load()) {
+      LOG_ERR("THQ", "Failed to index %s", job.bookPath.c_str());
+      return;
+    }
+    ok = xtc.generateCoverBmp();
+    for (const int height : heights) {
+      if (!ok) break;
+      ok = Storage.exists(xtc.getThumbBmpPath(height).c_str()) || xtc.generateThumbBmp(height);
+    }
+    pendingMetadata.push_back({job.bookPath, xtc.getTitle(), xtc.getAuthor(), "", true, xtc.getCachePath()});
+  } else {
+    // A text book's pages depend on the layout, so only its cover (an image next to it) can be prepared
+    Txt txt(job.bookPath, "/.crosspoint");
+    if (!txt.load()) {
+      LOG_ERR("THQ", "Failed to index %s", job.bookPath.c_str());
+      return;
+    }
+    if (!txt.findCoverImage().empty()) {
+      ok = txt.generateCoverBmp();
+    }
+  }
+  completedCount++;
+  LOG_INF("THQ", "Indexed %s in %lu ms%s", job.bookPath.c_str(), millis() - start, ok ? "" : " (incomplete)");
+}
+
+void ThumbnailQueue::flushMetadata() {
+  if (pendingMetadata.empty()) {
+    return;
+  }
+  LIBRARY_CATALOG.updateBooks(pendingMetadata);
+  pendingMetadata.clear();
+}
+
+void ThumbnailQueue::requestVisible(const std::vector<std::string>& bookPaths, const int height) {
+  if (!queueMutex) {
+    return;
+  }
+  {
+    QueueLock lock(queueMutex);
+    requests.clear();
+    for (const std::string& bookPath : bookPaths) {
+      Job job;
+      job.bookPath = bookPath;
+      job.height = height;
+      requests.push_back(std::move(job));
+    }
+  }
+  xTaskNotifyGive(taskHandle);
+}
+
+void ThumbnailQueue::index(const std::string& bookPath) {
+  if (!queueMutex || !(StringUtils::checkFileExtension(bookPath, ".epub") ||
+                       StringUtils::checkFileExtension(bookPath, ".xtch") ||
+                       StringUtils::checkFileExtension(bookPath, ".xtc") ||
+                       StringUtils::checkFileExtension(bookPath, ".txt"))) {
+    return;
+  }
+  {
+    QueueLock lock(queueMutex);
+    // A book uploaded twice is only prepared once; the worker re-checks what exists anyway
+    const bool queued = std::any_of(indexRequests.begin(), indexRequests.end(),
+                                    [&bookPath](const Job& job) { return job.bookPath == bookPath; });
+    if (!queued) {
+      Job job;
+      job.bookPath = bookPath;
+      job.preindex = true;
+      indexRequests.push_back(std::move(job));
+    }
+  }
+  xTaskNotifyGive(taskHandle);
+}
+
+void ThumbnailQueue::resume(const bool sweepLibrary) {
+  if (!queueMutex) {
+    return;
+  }
+  {
+    QueueLock lock(queueMutex);
+    running = true;
+    sweepRequested = sweepLibrary;
+  }
+  xTaskNotifyGive(taskHandle);
+}
+
+void ThumbnailQueue::pause() {
+  if (!queueMutex) {
+    return;
+  }
+  {
+    QueueLock lock(queueMutex);
+    running = false;
+    sweepRequested = false;
+  }
+  // The worker checks `running` under workMutex, so once we get it the current book is done and no other will start
+  xSemaphoreTake(workMutex, portMAX_DELAY);
+  xSemaphoreGive(workMutex);
+}
+
+void ThumbnailQueue::restartSweep() {
+  if (!queueMutex) {
+    return;
+  }
+  {
+    QueueLock lock(queueMutex);
+    sweepCursor = {};
+    sweepBatch.clear();
+    sweepDone = false;
+  }
+  xTaskNotifyGive(taskHandle);
+}
+
+bool ThumbnailQueue::isPending(const std::string& bookPath) const {
+  if (!queueMutex) {
+    return false;
+  }
+  QueueLock lock(queueMutex);
+  return currentBook == bookPath || std::any_of(requests.begin(), requests.end(),
+                                                [&bookPath](const Job& job) { return job.bookPath == bookPath; });
+}
+
+bool ThumbnailQueue::isBusy() const {
+  if (!queueMutex) {
+    return false;
+  }
+  QueueLock lock(queueMutex);
+  return running && (!currentBook.empty() || !requests.empty() ||
+                     (sweepAllowed() && (!indexRequests.empty() || !sweepDone)));
+}
+
+bool ThumbnailQueue::canIndex() const {
+  if (!queueMutex) {
+    return false;
+  }
+  QueueLock lock(queueMutex);
+  return running && sweepAllowed() && ESP.getFreeHeap() >= SWEEP_MIN_FREE_HEAP;
+}
+
+ThumbnailQueue::IndexStatus ThumbnailQueue::getIndexStatus() const {
+  IndexStatus status;
+  if (!queueMutex) {
+    return status;
+  }
+  QueueLock lock(queueMutex);
+  status.pending = indexRequests.size() + (currentIsIndex ? 1 : 0);
+  status.completed = indexedCount;
+  if (currentIsIndex) {
+    status.current = currentBook;
+  }
+  return status;
+}
@@ -0,0 +1,108 @@
+#pragma once
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "LibraryCatalog.h"
+
+class GfxRenderer;
+class HalGPIO;
+
+/**
+ * Background queue that renders cover thumbnails on its own FreeRTOS task.
+ *
+ * Screens request the thumbnails they are about to show and keep drawing placeholders until they land; the worker
+ * bumps getCompletedCount() after each one, which the screen polls to repaint. A screen hands over everything it shows
+ * at once, in drawing order, and again whenever that changes: the new set replaces the old one, so books scrolled out
+ * of view are dropped rather than rendered ahead of the ones now on screen. When there are no requests, the worker may
+ * sweep the whole library catalog, making every book's thumbnail at every height a theme uses: it does so while the
+ * device is charging, or when a screen asks for it (the file transfer screen, which otherwise sits idle).
+ *
+ * Loading a book competes with the reader for heap and the SD card, so the worker only runs between resume() and
+ * pause(). Screens that show thumbnails resume it on enter and pause it on exit; the reader never resumes it. The
+ * worker holds a HalPowerManager::Lock while it works, so it doesn't crawl along at the idle clock.
+ *
+ * Books that just arrived over a file transfer are queued with index(). Such a book gets everything its first open
+ * would otherwise build: the metadata and CSS caches, the sleep screen cover, every thumbnail and the parsed first
+ * chapter. These jobs run ahead of the sweep, under the same conditions, so they wait while an upload is writing.
+ */
+class ThumbnailQueue {
+  static ThumbnailQueue instance;
+
+  struct Job {
+    std::string bookPath;
+    int height = 0;        // 0 for every theme height
+    std::string cacheId;   // from the catalog when known, to check for existing thumbnails without loading the book
+    CatalogEntry catalog;  // the catalog's entry for sweep jobs, to tell whether the metadata has to be updated
+    bool fromSweep = false;
+    bool preindex = false;  // queued by index()
+  };
+
+  const HalGPIO* gpio = nullptr;
+  GfxRenderer* renderer = nullptr;
+  TaskHandle_t taskHandle = nullptr;
+  SemaphoreHandle_t queueMutex = nullptr;  // guards the fields below
+  SemaphoreHandle_t workMutex = nullptr;   // held while a book is being processed, so pause() can wait it out
+  std::deque<Job> requests;
+  std::deque<Job> indexRequests;
+  std::vector<Job> sweepBatch;
+  CatalogCursor sweepCursor;
+  bool sweepDone = false;
+  bool running = false;
+  bool sweepRequested = false;
+  std::string currentBook;
+  bool currentIsIndex = false;
+  uint32_t indexedCount = 0;
+  std::vector<BookMetadata> pendingMetadata;
+  std::atomic<uint32_t> completedCount{0};
+
+  static void taskTrampoline(void* param);
+  void taskLoop();
+  bool nextJob(Job& job);
+  bool sweepAllowed() const;
+  void process(const Job& job);
+  void preindex(const Job& job, const std::vector<int>& heights);
+  void flushMetadata();
+
+ public:
+  struct IndexStatus {
+    size_t pending = 0;      // books queued with index() that aren't done yet, including the current one
+    uint32_t completed = 0;  // books prepared since boot
+    std::string current;     // the book being prepared, if any
+  };
+
+  static ThumbnailQueue& getInstance() { return instance; }
+
+  // Starts the worker task. `gpio` tells it whether the device is charging; `renderer` is handed to the section
+  // parser, which doesn't draw.
+  void begin(const HalGPIO& gpio, GfxRenderer& renderer);
+
+  // Replaces the queued requests with the thumbnails at `height` for `bookPaths`, served in that order ahead of any
+  // library sweep. The book being processed is finished either way.
+  void requestVisible(const std::vector<std::string>& bookPaths, int height);
+  // Queues a book that was just written for everything its first open needs. Ignores files that aren't books.
+  void index(const std::string& bookPath);
+  // Lets the worker run. With `sweepLibrary` it also works through the whole catalog once requests run out.
+  void resume(bool sweepLibrary = false);
+  // Stops the worker after the book it is on; returns once it has stopped
+  void pause();
+  // Starts the next library sweep from the top of the catalog, e.g. after books were added
+  void restartSweep();
+
+  // The book has a request queued or being processed
+  bool isPending(const std::string& bookPath) const;
+  bool isBusy() const;
+  IndexStatus getIndexStatus() const;
+  // The worker may start a book queued with index() now: it is resumed, allowed to sweep, and the heap has room.
+  // While this is false and no book is current, queued books wait for a later resume.
+  bool canIndex() const;
+  // Incremented for every thumbnail written
+  uint32_t getCompletedCount() const { return completedCount.load(); }
+};
+
+#define THUMBNAILS ThumbnailQueue::getInstance()
@@ -1,6 +1,7 @@
 #include "ActivityManager.h"
 
 #include <HalPowerManager.h>
+#include <HeapTags.h>
 
 #include "boot_sleep/BootActivity.h"
 #include "boot_sleep/SleepActivity.h"
@@ -49,12 +50,14 @@ void ActivityManager::renderTaskLoop() {
     RenderLock lock;
     if (currentActivity) {
       HalPowerManager::Lock powerLock;  // Ensure we don't go into low-power mode while rendering
+      HeapTagScope heapScope(HeapTag::Activity);
       currentActivity->render(std::move(lock));
     }
   }
 }
 
 void ActivityManager::loop() {
+  HeapTagScope heapScope(HeapTag::Activity);
   if (currentActivity) {
     // Note: do not hold a lock here, the loop() method must be responsible for acquire one if needed
     currentActivity->loop();
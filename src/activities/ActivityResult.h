@@ -25,6 +25,7 @@ struct MenuResult {
 
 struct ChapterResult {
   int spineIndex = 0;
+  std::string anchor;  // TOC entry fragment, empty when the entry points at the start of the spine item
 };
 
 struct PercentResult {
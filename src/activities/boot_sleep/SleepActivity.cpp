@@ -12,6 +12,7 @@
 #include "components/UITheme.h"
 #include "fontIds.h"
 #include "images/Logo120.h"
+#include "util/SleepScreenCache.h"
 #include "util/StringUtils.h"
 
 void SleepActivity::onEnter() {
@@ -75,13 +76,18 @@ void SleepActivity::renderCustomSleepScreen() const {
       APP_STATE.lastSleepImage = randomFileIndex;
       APP_STATE.saveToFile();
       const auto filename = "/sleep/" + files[randomFileIndex];
+      std::string cacheKey;
+      if (renderCachedSleepScreen(filename, cacheKey)) {
+        dir.close();
+        return;
+      }
       FsFile file;
       if (Storage.openFileForRead("SLP", filename, file)) {
         LOG_DBG("SLP", "Randomly loading: /sleep/%s", files[randomFileIndex].c_str());
         delay(100);
         Bitmap bitmap(file, true);
         if (bitmap.parseHeaders() == BmpReaderError::Ok) {
-          renderBitmapSleepScreen(bitmap);
+          renderBitmapSleepScreen(bitmap, cacheKey);
           file.close();
           dir.close();
           return;
@@ -94,12 +100,16 @@ void SleepActivity::renderCustomSleepScreen() const {
 
   // Look for sleep.bmp on the root of the sd card to determine if we should
   // render a custom sleep screen instead of the default.
+  std::string cacheKey;
+  if (renderCachedSleepScreen("/sleep.bmp", cacheKey)) {
+    return;
+  }
   FsFile file;
   if (Storage.openFileForRead("SLP", "/sleep.bmp", file)) {
     Bitmap bitmap(file, true);
     if (bitmap.parseHeaders() == BmpReaderError::Ok) {
       LOG_DBG("SLP", "Loading: /sleep.bmp");
-      renderBitmapSleepScreen(bitmap);
+      renderBitmapSleepScreen(bitmap, cacheKey);
       file.close();
       return;
     }
@@ -126,7 +136,12 @@ void SleepActivity::renderDefaultSleepScreen() const {
   renderer.displayBuffer(HalDisplay::HALF_REFRESH);
 }
 
-void SleepActivity::renderBitmapSleepScreen(const Bitmap& bitmap) const {
+bool SleepActivity::renderCachedSleepScreen(const std::string& imagePath, std::string& cacheKey) const {
+  cacheKey = SleepScreenCache::keyFor(renderer, imagePath);
+  return SleepScreenCache::show(renderer, cacheKey);
+}
+
+void SleepActivity::renderBitmapSleepScreen(const Bitmap& bitmap, const std::string& cacheKey) const {
   int x, y;
   const auto pageWidth = renderer.getScreenWidth();
   const auto pageHeight = renderer.getScreenHeight();
@@ -171,6 +186,8 @@ void SleepActivity::renderBitmapSleepScreen(const Bitmap& bitmap) const {
 
   const bool hasGreyscale = bitmap.hasGreyscale() &&
                             SETTINGS.sleepScreenCoverFilter == CrossPointSettings::SLEEP_SCREEN_COVER_FILTER::NO_FILTER;
+  // Each plane is recorded as it goes to the display, so the next sleep on this image can skip composing it
+  SleepScreenCache::Recorder recorder(cacheKey, hasGreyscale ? 3 : 1);
 
   renderer.drawBitmap(bitmap, x, y, pageWidth, pageHeight, cropX, cropY);
 
@@ -178,6 +195,7 @@ void SleepActivity::renderBitmapSleepScreen(const Bitmap& bitmap) const {
     renderer.invertScreen();
   }
 
+  recorder.addPlane(renderer);
   renderer.displayBuffer(HalDisplay::HALF_REFRESH);
 
   if (hasGreyscale) {
@@ -185,17 +203,20 @@ void SleepActivity::renderBitmapSleepScreen(const Bitmap& bitmap) const {
     renderer.clearScreen(0x00);
     renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
     renderer.drawBitmap(bitmap, x, y, pageWidth, pageHeight, cropX, cropY);
+    recorder.addPlane(renderer);
     renderer.copyGrayscaleLsbBuffers();
 
     bitmap.rewindToData();
     renderer.clearScreen(0x00);
     renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
     renderer.drawBitmap(bitmap, x, y, pageWidth, pageHeight, cropX, cropY);
+    recorder.addPlane(renderer);
     renderer.copyGrayscaleMsbBuffers();
 
     renderer.displayGrayBuffer();
     renderer.setRenderMode(GfxRenderer::BW);
   }
+  recorder.commit();
 }
 
 void SleepActivity::renderCoverSleepScreen() const {
@@ -265,12 +286,16 @@ void SleepActivity::renderCoverSleepScreen() const {
     return (this->*renderNoCoverSleepScreen)();
   }
 
+  std::string cacheKey;
+  if (renderCachedSleepScreen(coverBmpPath, cacheKey)) {
+    return;
+  }
   FsFile file;
   if (Storage.openFileForRead("SLP", coverBmpPath, file)) {
     Bitmap bitmap(file);
     if (bitmap.parseHeaders() == BmpReaderError::Ok) {
       LOG_DBG("SLP", "Rendering sleep cover: %s", coverBmpPath.c_str());
-      renderBitmapSleepScreen(bitmap);
+      renderBitmapSleepScreen(bitmap, cacheKey);
       file.close();
       return;
     }
@@ -1,4 +1,6 @@
 #pragma once
+#include <string>
+
 #include "../Activity.h"
 
 class Bitmap;
@@ -13,6 +15,8 @@ class SleepActivity final : public Activity {
   void renderDefaultSleepScreen() const;
   void renderCustomSleepScreen() const;
   void renderCoverSleepScreen() const;
-  void renderBitmapSleepScreen(const Bitmap& bitmap) const;
+  // Shows the screen composed from the image at `imagePath` from the sleep screen cache. Returns false on a miss.
+  bool renderCachedSleepScreen(const std::string& imagePath, std::string& cacheKey) const;
+  void renderBitmapSleepScreen(const Bitmap& bitmap, const std::string& cacheKey) const;
   void renderBlankSleepScreen() const;
 };
@@ -1,7 +1,10 @@
 #include "OpdsBookBrowserActivity.h"
 
+#include <BookCacheId.h>
 #include <Epub.h>
+#include <Epub/EpubStreamScanner.h>
 #include <GfxRenderer.h>
+#include <HalStorage.h>
 #include <I18n.h>
 #include <Logging.h>
 #include <OpdsStream.h>
@@ -9,6 +12,7 @@
 
 #include "CrossPointSettings.h"
 #include "MappedInputManager.h"
+#include "ThumbnailQueue.h"
 #include "activities/network/WifiSelectionActivity.h"
 #include "components/UITheme.h"
 #include "fontIds.h"
@@ -18,13 +22,17 @@
 
 namespace {
 constexpr int PAGE_ITEMS = 23;
+// Where the last download that didn't finish was going, so its part can be deleted once another book is chosen
+constexpr char UNFINISHED_DOWNLOAD_FILE[] = "/.crosspoint/opds_unfinished.txt";
 }  // namespace
 
 void OpdsBookBrowserActivity::onEnter() {
   Activity::onEnter();
 
   state = BrowserState::CHECK_WIFI;
+  feed.close();
   entries.clear();
+  entriesStart = 0;
   navigationHistory.clear();
   currentPath = "";  // Root path - user provides full URL in settings
   selectorIndex = 0;
@@ -39,9 +47,12 @@ void OpdsBookBrowserActivity::onEnter() {
 void OpdsBookBrowserActivity::onExit() {
   Activity::onExit();
 
+  THUMBNAILS.pause();
+
   // Turn off WiFi when exiting
   WiFi.mode(WIFI_OFF);
 
+  feed.close();
   entries.clear();
   navigationHistory.clear();
 }
@@ -63,7 +74,7 @@ void OpdsBookBrowserActivity::loop() {
         state = BrowserState::LOADING;
         statusMessage = tr(STR_LOADING);
         requestUpdate();
-        fetchFeed(currentPath);
+        openFeed(currentPath, true);
       } else {
         // WiFi not connected - launch WiFi selection
         LOG_DBG("OPDS", "Retry: WiFi not connected, launching selection");
@@ -99,8 +110,11 @@ void OpdsBookBrowserActivity::loop() {
   // Handle browsing state
   if (state == BrowserState::BROWSING) {
     if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
-      if (!entries.empty()) {
-        const auto& entry = entries[selectorIndex];
+      loadScreen();
+      const size_t onScreen = selectorIndex - entriesStart;
+      if (onScreen < entries.size()) {
+        // Copied, since navigating replaces the entries on screen
+        const OpdsEntry entry = entries[onScreen];
         if (entry.type == OpdsEntryType::BOOK) {
           downloadBook(entry);
         } else {
@@ -112,24 +126,32 @@ void OpdsBookBrowserActivity::loop() {
     }
 
     // Handle navigation
-    if (!entries.empty()) {
+    if (feed.size() > 0) {
       buttonNavigator.onNextRelease([this] {
-        selectorIndex = ButtonNavigator::nextIndex(selectorIndex, entries.size());
+        selectorIndex = ButtonNavigator::nextIndex(selectorIndex, feed.size());
+        fetchMoreIfNeeded();
+        loadScreen();
         requestUpdate();
       });
 
       buttonNavigator.onPreviousRelease([this] {
-        selectorIndex = ButtonNavigator::previousIndex(selectorIndex, entries.size());
+        selectorIndex = ButtonNavigator::previousIndex(selectorIndex, feed.size());
+        fetchMoreIfNeeded();
+        loadScreen();
         requestUpdate();
       });
 
       buttonNavigator.onNextContinuous([this] {
-        selectorIndex = ButtonNavigator::nextPageIndex(selectorIndex, entries.size(), PAGE_ITEMS);
+        selectorIndex = ButtonNavigator::nextPageIndex(selectorIndex, feed.size(), PAGE_ITEMS);
+        fetchMoreIfNeeded();
+        loadScreen();
         requestUpdate();
       });
 
       buttonNavigator.onPreviousContinuous([this] {
-        selectorIndex = ButtonNavigator::previousPageIndex(selectorIndex, entries.size(), PAGE_ITEMS);
+        selectorIndex = ButtonNavigator::previousPageIndex(selectorIndex, feed.size(), PAGE_ITEMS);
+        fetchMoreIfNeeded();
+        loadScreen();
         requestUpdate();
       });
     }
@@ -188,8 +210,9 @@ void OpdsBookBrowserActivity::render(RenderLock&&) {
 
   // Browsing state
   // Show appropriate button hint based on selected entry type
+  const size_t selectedOnScreen = selectorIndex - entriesStart;
   const char* confirmLabel = tr(STR_OPEN);
-  if (!entries.empty() && entries[selectorIndex].type == OpdsEntryType::BOOK) {
+  if (selectedOnScreen < entries.size() && entries[selectedOnScreen].type == OpdsEntryType::BOOK) {
     confirmLabel = tr(STR_DOWNLOAD);
   }
   const auto labels = mappedInput.mapLabels(tr(STR_BACK), confirmLabel, tr(STR_DIR_UP), tr(STR_DIR_DOWN));
@@ -201,10 +224,9 @@ void OpdsBookBrowserActivity::render(RenderLock&&) {
     return;
   }
 
-  const auto pageStartIndex = selectorIndex / PAGE_ITEMS * PAGE_ITEMS;
   renderer.fillRect(0, 60 + (selectorIndex % PAGE_ITEMS) * 30 - 2, pageWidth - 1, 30);
 
-  for (size_t i = pageStartIndex; i < entries.size() && i < static_cast<size_t>(pageStartIndex + PAGE_ITEMS); i++) {
+  for (size_t i = 0; i < entries.size(); i++) {
     const auto& entry = entries[i];
 
     // Format display text with type indicator
@@ -220,14 +242,28 @@ void OpdsBookBrowserActivity::render(RenderLock&&) {
     }
 
     auto item = renderer.truncatedText(UI_10_FONT_ID, displayText.c_str(), renderer.getScreenWidth() - 40);
-    renderer.drawText(UI_10_FONT_ID, 20, 60 + (i % PAGE_ITEMS) * 30, item.c_str(),
-                      i != static_cast<size_t>(selectorIndex));
+    renderer.drawText(UI_10_FONT_ID, 20, 60 + i * 30, item.c_str(), i != selectedOnScreen);
   }
 
   renderer.displayBuffer();
 }
 
-void OpdsBookBrowserActivity::fetchFeed(const std::string& path) {
+OpdsFeedCache::FetchResult OpdsBookBrowserActivity::fetchFeedPage(const std::string& href, std::string& etag,
+                                                                   std::string& lastModified, OpdsParser& parser) {
+  const std::string url = UrlUtils::buildUrl(SETTINGS.opdsServerUrl, href);
+  OpdsParserStream stream{parser};
+  switch (HttpDownloader::fetchUrlIfChanged(url, stream, etag, lastModified, true)) {
+    case HttpDownloader::FetchResult::FETCHED:
+      return OpdsFeedCache::FetchResult::FETCHED;
+    case HttpDownloader::FetchResult::NOT_MODIFIED:
+      return OpdsFeedCache::FetchResult::NOT_MODIFIED;
+    case HttpDownloader::FetchResult::FAILED:
+      break;
+  }
+  return OpdsFeedCache::FetchResult::FAILED;
+}
+
+void OpdsBookBrowserActivity::openFeed(const std::string& path, const bool revalidate, const int selection) {
   const char* serverUrl = SETTINGS.opdsServerUrl;
   if (strlen(serverUrl) == 0) {
     state = BrowserState::ERROR;
@@ -236,31 +272,33 @@ void OpdsBookBrowserActivity::fetchFeed(const std::string& path) {
     return;
   }
 
-  std::string url = UrlUtils::buildUrl(serverUrl, path);
-  LOG_DBG("OPDS", "Fetching: %s", url.c_str());
-
-  OpdsParser parser;
+  const std::string url = UrlUtils::buildUrl(serverUrl, path);
+  LOG_DBG("OPDS", "Opening: %s", url.c_str());
 
-  {
-    OpdsParserStream stream{parser};
-    if (!HttpDownloader::fetchUrl(url, stream, true)) {
-      state = BrowserState::ERROR;
-      errorMessage = tr(STR_FETCH_FEED_FAILED);
-      requestUpdate();
-      return;
-    }
+  const auto result = feed.open(url, revalidate);
+  if (result == OpdsFeedCache::OpenResult::FETCH_FAILED) {
+    state = BrowserState::ERROR;
+    errorMessage = tr(STR_FETCH_FEED_FAILED);
+    requestUpdate();
+    return;
   }
 
-  if (!parser) {
+  if (result == OpdsFeedCache::OpenResult::PARSE_FAILED) {
     state = BrowserState::ERROR;
     errorMessage = tr(STR_PARSE_FEED_FAILED);
     requestUpdate();
     return;
   }
 
-  entries = std::move(parser).getEntries();
-  LOG_DBG("OPDS", "Found %d entries", entries.size());
-  selectorIndex = 0;
+  LOG_DBG("OPDS", "Found %u entries", static_cast<unsigned>(feed.size()));
+  nextPageFailed = false;
+  {
+    RenderLock lock(*this);
+    entries.clear();
+    selectorIndex = static_cast<size_t>(selection) < feed.size() ? selection : 0;
+  }
+  fetchMoreIfNeeded();
+  loadScreen();
 
   if (entries.empty()) {
     state = BrowserState::ERROR;
@@ -273,18 +311,45 @@ void OpdsBookBrowserActivity::fetchFeed(const std::string& path) {
   requestUpdate();
 }
 
+void OpdsBookBrowserActivity::loadScreen() {
+  const size_t screenStart = selectorIndex / PAGE_ITEMS * PAGE_ITEMS;
+  if (!entries.empty() && entriesStart == screenStart && selectorIndex - screenStart < entries.size()) {
+    return;
+  }
+  RenderLock lock(*this);
+  entriesStart = screenStart;
+  if (!feed.read(screenStart, PAGE_ITEMS, entries)) {
+    entries.clear();
+  }
+}
+
+void OpdsBookBrowserActivity::fetchMoreIfNeeded() {
+  if (nextPageFailed || !feed.hasNextPage() || static_cast<size_t>(selectorIndex) + PAGE_ITEMS < feed.size()) {
+    return;
+  }
+  const size_t before = feed.size();
+  nextPageFailed = !feed.fetchNextPage();
+  if (nextPageFailed) {
+    LOG_ERR("OPDS", "Failed to fetch the next page of the feed");
+  }
+  if (feed.size() != before) {
+    // The last screen may have been short of entries
+    RenderLock lock(*this);
+    entries.clear();
+  }
+}
+
 void OpdsBookBrowserActivity::navigateToEntry(const OpdsEntry& entry) {
-  // Push current path to history before navigating
-  navigationHistory.push_back(currentPath);
+  // Push current path and selection to history before navigating
+  navigationHistory.push_back({currentPath, selectorIndex});
   currentPath = entry.href;
 
   state = BrowserState::LOADING;
   statusMessage = tr(STR_LOADING);
-  entries.clear();
   selectorIndex = 0;
   requestUpdate(true);  // Force update to show loading state immediately before fetch
 
-  fetchFeed(currentPath);
+  openFeed(currentPath, true);
 }
 
 void OpdsBookBrowserActivity::navigateBack() {
@@ -292,17 +357,16 @@ void OpdsBookBrowserActivity::navigateBack() {
     // At root, go home
     onGoHome();
   } else {
-    // Go back to previous catalog
-    currentPath = navigationHistory.back();
+    // Go back to previous catalog, as cached when it was shown
+    const HistoryItem previous = navigationHistory.back();
     navigationHistory.pop_back();
+    currentPath = previous.path;
 
     state = BrowserState::LOADING;
     statusMessage = tr(STR_LOADING);
-    entries.clear();
-    selectorIndex = 0;
     requestUpdate();
 
-    fetchFeed(currentPath);
+    openFeed(currentPath, false, previous.selectorIndex);
   }
 }
 
@@ -325,6 +389,19 @@ void OpdsBookBrowserActivity::downloadBook(const OpdsEntry& book) {
 
   LOG_DBG("OPDS", "Downloading: %s -> %s", downloadUrl.c_str(), filename.c_str());
 
+  // Only the latest book's download is kept for resuming; one given up on for another would hold its space for good
+  const std::string unfinished = Storage.readFile(UNFINISHED_DOWNLOAD_FILE).c_str();
+  if (!unfinished.empty() && unfinished != filename) {
+    LOG_DBG("OPDS", "Dropping unfinished download: %s", unfinished.c_str());
+    HttpDownloader::discardPart(unfinished);
+  }
+  Storage.writeFile(UNFINISHED_DOWNLOAD_FILE, filename.c_str());
+
+  // The worker may be preparing the previous download; the heap is needed for this one
+  THUMBNAILS.pause();
+
+  // Keeps the archive's container.xml and OPF as they arrive, and stops a download that isn't an EPUB
+  EpubStreamScanner scanner;
   const auto result = HttpDownloader::downloadToFile(
       downloadUrl, filename,
       [this](const size_t downloaded, const size_t total) {
@@ -332,15 +409,27 @@ void OpdsBookBrowserActivity::downloadBook(const OpdsEntry& book) {
         downloadTotal = total;
         requestUpdate(true);  // Force update to refresh progress bar
       },
-      true);
+      true, &scanner);
 
   if (result == HttpDownloader::OK) {
     LOG_DBG("OPDS", "Download complete: %s", filename.c_str());
+    Storage.remove(UNFINISHED_DOWNLOAD_FILE);
 
-    // Invalidate any existing cache for this file to prevent stale metadata issues
+    // The download overwrote whatever was at this path: release that content's cache, which a copy of the old book
+    // elsewhere may share, and keep it if the same book was downloaded again
+    BookCacheId::onRemoved(filename, "/.crosspoint");
     Epub epub(filename, "/.crosspoint");
-    epub.clearCache();
-    LOG_DBG("OPDS", "Cleared cache for: %s", filename.c_str());
+
+    // Build book.bin now, from the OPF kept during the download, then let the worker make the cover, thumbnails
+    // and first chapter while browsing goes on
+    if (scanner.hasPackage()) {
+      epub.preloadFrom(scanner);
+    }
+    if (!epub.load(true, true)) {
+      LOG_ERR("OPDS", "Could not load downloaded book: %s", filename.c_str());
+    }
+    THUMBNAILS.index(filename);
+    THUMBNAILS.resume(true);
 
     state = BrowserState::BROWSING;
     requestUpdate();
@@ -357,7 +446,7 @@ void OpdsBookBrowserActivity::checkAndConnectWifi() {
     state = BrowserState::LOADING;
     statusMessage = tr(STR_LOADING);
     requestUpdate();
-    fetchFeed(currentPath);
+    openFeed(currentPath, true);
     return;
   }
 
@@ -379,7 +468,7 @@ void OpdsBookBrowserActivity::onWifiSelectionComplete(const bool connected) {
     state = BrowserState::LOADING;
     statusMessage = tr(STR_LOADING);
     requestUpdate(true);  // Force update to show loading state immediately before fetch
-    fetchFeed(currentPath);
+    openFeed(currentPath, true);
   } else {
     LOG_DBG("OPDS", "WiFi selection cancelled/failed");
     // Force disconnect to ensure clean state for next retry
@@ -6,12 +6,15 @@
 #include <vector>
 
 #include "../Activity.h"
+#include "network/OpdsFeedCache.h"
 #include "util/ButtonNavigator.h"
 
 /**
  * Activity for browsing and downloading books from an OPDS server.
  * Supports navigation through catalog hierarchy and downloading EPUBs.
  * When WiFi connection fails, launches WiFi selection to let user connect.
+ * Feeds are cached on the SD card (OpdsFeedCache) and only the entries on screen are held in memory; further pages
+ * of a paginated feed are fetched when the selection gets within a screen of the last entry.
  */
 class OpdsBookBrowserActivity final : public Activity {
  public:
@@ -25,7 +28,7 @@ class OpdsBookBrowserActivity final : public Activity {
   };
 
   explicit OpdsBookBrowserActivity(GfxRenderer& renderer, MappedInputManager& mappedInput)
-      : Activity("OpdsBookBrowser", renderer, mappedInput) {}
+      : Activity("OpdsBookBrowser", renderer, mappedInput), feed(fetchFeedPage) {}
 
   void onEnter() override;
   void onExit() override;
@@ -34,11 +37,19 @@ class OpdsBookBrowserActivity final : public Activity {
 
  private:
   ButtonNavigator buttonNavigator;
+  struct HistoryItem {
+    std::string path;
+    int selectorIndex;
+  };
+
   BrowserState state = BrowserState::LOADING;
-  std::vector<OpdsEntry> entries;
-  std::vector<std::string> navigationHistory;  // Stack of previous feed paths for back navigation
+  OpdsFeedCache feed;
+  std::vector<OpdsEntry> entries;              // Entries on the current screen
+  size_t entriesStart = 0;                     // Index in the feed of entries[0]
+  std::vector<HistoryItem> navigationHistory;  // Stack of previous feeds for back navigation
   std::string currentPath;                     // Current feed path being displayed
   int selectorIndex = 0;
+  bool nextPageFailed = false;  // Not retried until the feed is opened again
   std::string errorMessage;
   std::string statusMessage;
   size_t downloadProgress = 0;
@@ -47,8 +58,14 @@ class OpdsBookBrowserActivity final : public Activity {
   void checkAndConnectWifi();
   void launchWifiSelection();
   void onWifiSelectionComplete(bool connected);
-  void fetchFeed(const std::string& path);
-  void navigateToEntry(const OpdsEntry& entry);
+  static OpdsFeedCache::FetchResult fetchFeedPage(const std::string& href, std::string& etag,
+                                                  std::string& lastModified, OpdsParser& parser);
+  // Opens the feed at `path`, from the SD card cache unless `revalidate`, and selects `selection`
+  void openFeed(const std::string& path, bool revalidate, int selection = 0);
+  // Loads the entries of the screen holding the selection, if they aren't loaded yet
+  void loadScreen();
+  // Fetches the next page of the feed once the selection is within a screen of the last entry
+  void fetchMoreIfNeeded();  void navigateToEntry(const OpdsEntry& entry);
   void navigateBack();
   void downloadBook(const OpdsEntry& book);
   bool preventAutoSleep() override { return true; }
@@ -6,27 +6,11 @@
 #include <Logging.h>
 
 #include "../ActivityManager.h"
+#include "AppsMenuView.h"
 #include "MappedInputManager.h"
 #include "activities/util/ConfirmationActivity.h"
 #include "apps/AppLoader.h"
 #include "components/UITheme.h"
-#include "fontIds.h"
-
-namespace {
-UIIcon iconForAppType(const std::string& type) {
-  if (type == "art") return UIIcon::Art;
-  if (type == "calculator") return UIIcon::Calculator;
-  if (type == "minesweeper") return UIIcon::Minesweeper;
-  if (type == "rosary") return UIIcon::Rosary;
-  if (type == "flashcard") return UIIcon::Flashcard;
-  if (type == "randomquote") return UIIcon::Quote;
-  if (type == "bookhighlights") return UIIcon::Quote;
-  if (type == "texteditor") return UIIcon::TextEditor;
-  if (type == "textviewer") return UIIcon::Text;
-  if (type == "imageviewer") return UIIcon::Image;
-  return UIIcon::File;
-}
-}  // namespace
 
 void AppsMenuActivity::onEnter() {
   Activity::onEnter();
@@ -167,33 +151,9 @@ void AppsMenuActivity::deleteAppAtIndex(const size_t appIndex) {
 }
 
 void AppsMenuActivity::render(RenderLock&&) {
-  renderer.clearScreen();
-
-  const auto pageWidth = renderer.getScreenWidth();
-  const auto pageHeight = renderer.getScreenHeight();
-  auto metrics = UITheme::getInstance().getMetrics();
-
-  GUI.drawHeader(renderer, Rect{0, metrics.topPadding, pageWidth, metrics.headerHeight}, tr(STR_APPS));
-
-  const int contentTop = metrics.topPadding + metrics.headerHeight + metrics.verticalSpacing;
-  const int contentHeight = pageHeight - contentTop - metrics.buttonHintsHeight - metrics.verticalSpacing;
-
-  const int totalItems = static_cast<int>(loadedApps.size());
-
-  GUI.drawList(
-      renderer, Rect{0, contentTop, pageWidth, contentHeight}, totalItems, selectorIndex,
-      [this](int index) { return loadedApps[index].name; }, nullptr,
-      [this](int index) { return iconForAppType(loadedApps[index].type); }, nullptr);
-
-  if (!deleteStatus.empty()) {
-    renderer.drawCenteredText(SMALL_FONT_ID, pageHeight - metrics.buttonHintsHeight - 20, deleteStatus.c_str(), true,
-                              EpdFontFamily::BOLD);
-  }
-
   const char* backLabel = deleteArmed ? tr(STR_CANCEL) : tr(STR_HOME);
   const char* confirmLabel = deleteArmed ? tr(STR_DELETE) : tr(STR_OPEN);
-  const auto labels = mappedInput.mapLabels(backLabel, confirmLabel, tr(STR_DIR_UP), tr(STR_DIR_DOWN));
-  GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
-
+  AppsMenuView::render(renderer, {loadedApps, selectorIndex, deleteStatus,
+                                  mappedInput.mapLabels(backLabel, confirmLabel, tr(STR_DIR_UP), tr(STR_DIR_DOWN))});
   renderer.displayBuffer();
 }
@@ -0,0 +1,50 @@
+#include "AppsMenuView.h"
+
+#include <GfxRenderer.h>
+#include <I18n.h>
+
+#include "components/UITheme.h"
+#include "fontIds.h"
+
+namespace {
+UIIcon iconForAppType(const std::string& type) {
+  if (type == "art") return UIIcon::Art;
+  if (type == "calculator") return UIIcon::Calculator;
+  if (type == "minesweeper") return UIIcon::Minesweeper;
+  if (type == "rosary") return UIIcon::Rosary;
+  if (type == "flashcard") return UIIcon::Flashcard;
+  if (type == "randomquote") return UIIcon::Quote;
+  if (type == "bookhighlights") return UIIcon::Quote;
+  if (type == "texteditor") return UIIcon::TextEditor;
+  if (type == "textviewer") return UIIcon::Text;
+  if (type == "imageviewer") return UIIcon::Image;
+  return UIIcon::File;
+}
+}  // namespace
+
+void AppsMenuView::render(GfxRenderer& renderer, const State& state) {
+  renderer.clearScreen();
+
+  const auto pageWidth = renderer.getScreenWidth();
+  const auto pageHeight = renderer.getScreenHeight();
+  auto metrics = UITheme::getInstance().getMetrics();
+
+  GUI.drawHeader(renderer, Rect{0, metrics.topPadding, pageWidth, metrics.headerHeight}, tr(STR_APPS));
+
+  const int contentTop = metrics.topPadding + metrics.headerHeight + metrics.verticalSpacing;
+  const int contentHeight = pageHeight - contentTop - metrics.buttonHintsHeight - metrics.verticalSpacing;
+
+  const int totalItems = static_cast<int>(state.apps.size());
+
+  GUI.drawList(
+      renderer, Rect{0, contentTop, pageWidth, contentHeight}, totalItems, state.selectorIndex,
+      [&state](int index) { return state.apps[index].name; }, nullptr,
+      [&state](int index) { return iconForAppType(state.apps[index].type); }, nullptr);
+
+  if (!state.deleteStatus.empty()) {
+    renderer.drawCenteredText(SMALL_FONT_ID, pageHeight - metrics.buttonHintsHeight - 20, state.deleteStatus.c_str(),
+                              true, EpdFontFamily::BOLD);
+  }
+
+  GUI.drawButtonHints(renderer, state.hints.btn1, state.hints.btn2, state.hints.btn3, state.hints.btn4);
+}
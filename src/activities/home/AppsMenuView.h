@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "MappedInputManager.h"
+#include "apps/AppManifest.h"
+
+class GfxRenderer;
+
+// The app list as AppsMenuActivity draws it, split out so it can be drawn without the activity (test/render)
+namespace AppsMenuView {
+
+struct State {
+  const std::vector<AppManifest>& apps;
+  int selectorIndex;
+  // Outcome of the last delete, shown above the button hints while not empty
+  const std::string& deleteStatus;
+  MappedInputManager::Labels hints;
+};
+
+// Clears the frame buffer and draws the screen into it; the caller displays it
+void render(GfxRenderer& renderer, const State& state);
+
+}  // namespace AppsMenuView
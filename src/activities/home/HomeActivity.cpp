@@ -1,23 +1,22 @@
 #include "HomeActivity.h"
 
 #include <Bitmap.h>
-#include <Epub.h>
 #include <GfxRenderer.h>
 #include <HalStorage.h>
+#include <HeapTags.h>
 #include <I18n.h>
 #include <Utf8.h>
-#include <Xtc.h>
 
 #include <cstring>
 #include <vector>
 
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
+#include "HomeView.h"
 #include "MappedInputManager.h"
 #include "RecentBooksStore.h"
+#include "ThumbnailQueue.h"
 #include "components/UITheme.h"
-#include "fontIds.h"
-#include "util/StringUtils.h"
 
 int HomeActivity::getMenuItemCount() const {
   // My Library, Recents, [OPDS], Apps, App Store, File transfer, Settings
@@ -51,62 +50,43 @@ void HomeActivity::loadRecentBooks(int maxBooks) {
   }
 }
 
-void HomeActivity::loadRecentCovers(int coverHeight) {
-  recentsLoading = true;
-  bool showingLoading = false;
-  Rect popupRect;
-
-  int progress = 0;
-  for (RecentBook& book : recentBooks) {
-    if (!book.coverBmpPath.empty()) {
-      std::string coverPath = UITheme::getCoverThumbPath(book.coverBmpPath, coverHeight);
-      if (!Storage.exists(coverPath.c_str())) {
-        // If epub, try to load the metadata for title/author and cover
-        if (StringUtils::checkFileExtension(book.path, ".epub")) {
-          Epub epub(book.path, "/.crosspoint");
-          // Skip loading css since we only need metadata here
-          epub.load(false, true);
-
-          // Try to generate thumbnail image for Continue Reading card
-          if (!showingLoading) {
-            showingLoading = true;
-            popupRect = GUI.drawPopup(renderer, tr(STR_LOADING_POPUP));
-          }
-          GUI.fillPopupProgress(renderer, popupRect, 10 + progress * (90 / recentBooks.size()));
-          bool success = epub.generateThumbBmp(coverHeight);
-          if (!success) {
-            RECENT_BOOKS.updateBook(book.path, book.title, book.author, "");
-            book.coverBmpPath = "";
-          }
-          coverRendered = false;
-          requestUpdate();
-        } else if (StringUtils::checkFileExtension(book.path, ".xtch") ||
-                   StringUtils::checkFileExtension(book.path, ".xtc")) {
-          // Handle XTC file
-          Xtc xtc(book.path, "/.crosspoint");
-          if (xtc.load()) {
-            // Try to generate thumbnail image for Continue Reading card
-            if (!showingLoading) {
-              showingLoading = true;
-              popupRect = GUI.drawPopup(renderer, tr(STR_LOADING_POPUP));
-            }
-            GUI.fillPopupProgress(renderer, popupRect, 10 + progress * (90 / recentBooks.size()));
-            bool success = xtc.generateThumbBmp(coverHeight);
-            if (!success) {
-              RECENT_BOOKS.updateBook(book.path, book.title, book.author, "");
-              book.coverBmpPath = "";
-            }
-            coverRendered = false;
-            requestUpdate();
-          }
-        }
-      }
+void HomeActivity::requestRecentCovers(int coverHeight) {
+  // Covers are generated in the background; the theme draws a placeholder until they land
+  pendingCovers.clear();
+  for (const RecentBook& book : recentBooks) {
+    if (!book.coverBmpPath.empty() &&
+        !Storage.exists(UITheme::getCoverThumbPath(book.coverBmpPath, coverHeight).c_str())) {
+      pendingCovers.push_back(book.path);
     }
-    progress++;
   }
+  THUMBNAILS.requestVisible(pendingCovers, coverHeight);
+}
 
-  recentsLoaded = true;
-  recentsLoading = false;
+void HomeActivity::onThumbnailsCompleted(int coverHeight) {
+  RenderLock lock(*this);
+  bool changed = false;
+  for (auto it = pendingCovers.begin(); it != pendingCovers.end();) {
+    if (THUMBNAILS.isPending(*it)) {
+      ++it;
+      continue;
+    }
+    for (RecentBook& book : recentBooks) {
+      if (book.path == *it && !book.coverBmpPath.empty() &&
+          !Storage.exists(UITheme::getCoverThumbPath(book.coverBmpPath, coverHeight).c_str())) {
+        // The book has no cover we can render, don't ask again
+        RECENT_BOOKS.updateBook(book.path, book.title, book.author, "");
+        book.coverBmpPath = "";
+      }
+    }
+    it = pendingCovers.erase(it);
+    changed = true;
+  }
+  if (!changed) {
+    return;
+  }
+  freeCoverBuffer();
+  coverRendered = false;
+  requestUpdate();
 }
 
 void HomeActivity::onEnter() {
@@ -119,6 +99,9 @@ void HomeActivity::onEnter() {
 
   const auto& metrics = UITheme::getInstance().getMetrics();
   loadRecentBooks(metrics.homeRecentBooksCount);
+  seenThumbnailCount = THUMBNAILS.getCompletedCount();
+  requestRecentCovers(metrics.homeCoverHeight);
+  THUMBNAILS.resume();
 
   // Trigger first update
   requestUpdate();
@@ -127,6 +110,9 @@ void HomeActivity::onEnter() {
 void HomeActivity::onExit() {
   Activity::onExit();
 
+  // Opening a book needs the heap and the SD card to itself
+  THUMBNAILS.pause();
+
   // Free the stored cover buffer if any
   freeCoverBuffer();
 }
@@ -141,7 +127,7 @@ bool HomeActivity::storeCoverBuffer() {
   freeCoverBuffer();
 
   const size_t bufferSize = GfxRenderer::getBufferSize();
-  coverBuffer = static_cast<uint8_t*>(malloc(bufferSize));
+  coverBuffer = static_cast<uint8_t*>(HeapTags::allocate(bufferSize, HeapTag::Activity));
   if (!coverBuffer) {
     return false;
   }
@@ -167,13 +153,21 @@ bool HomeActivity::restoreCoverBuffer() {
 
 void HomeActivity::freeCoverBuffer() {
   if (coverBuffer) {
-    free(coverBuffer);
+    HeapTags::release(coverBuffer);
     coverBuffer = nullptr;
   }
   coverBufferStored = false;
 }
 
+bool HomeActivity::preventAutoSleep() { return !pendingCovers.empty(); }
+
 void HomeActivity::loop() {
+  const uint32_t thumbnailCount = THUMBNAILS.getCompletedCount();
+  if (thumbnailCount != seenThumbnailCount) {
+    seenThumbnailCount = thumbnailCount;
+    onThumbnailsCompleted(UITheme::getInstance().getMetrics().homeCoverHeight);
+  }
+
   const int menuCount = getMenuItemCount();
 
   buttonNavigator.onNext([this, menuCount] {
@@ -221,61 +215,11 @@ void HomeActivity::loop() {
 }
 
 void HomeActivity::render(RenderLock&&) {
-  const auto& metrics = UITheme::getInstance().getMetrics();
-  const auto pageWidth = renderer.getScreenWidth();
-  const auto pageHeight = renderer.getScreenHeight();
-
-  renderer.clearScreen();
-  bool bufferRestored = coverBufferStored && restoreCoverBuffer();
-
-  GUI.drawHeader(renderer, Rect{0, metrics.topPadding, pageWidth, metrics.homeTopPadding}, nullptr);
-
-  if (metrics.homeCoverTileHeight > 0) {
-    GUI.drawRecentBookCover(renderer, Rect{0, metrics.homeTopPadding, pageWidth, metrics.homeCoverTileHeight},
-                            recentBooks, selectorIndex, coverRendered, coverBufferStored, bufferRestored,
-                            std::bind(&HomeActivity::storeCoverBuffer, this));
-  }
-
-  // Build menu items dynamically
-  // Menu order: My Library, Recents, [OPDS], Apps, App Store, File Transfer, Settings
-  std::vector<const char*> menuItems = {tr(STR_BROWSE_FILES), tr(STR_MENU_RECENT_BOOKS)};
-  std::vector<UIIcon> menuIcons = {Folder, Recent};
-
-  if (hasOpdsUrl) {
-    menuItems.push_back(tr(STR_OPDS_BROWSER));
-    menuIcons.push_back(Library);
-  }
-
-  menuItems.push_back(tr(STR_APPS));
-  menuIcons.push_back(Folder);
-  menuItems.push_back(tr(STR_APP_STORE));
-  menuIcons.push_back(Library);
-  menuItems.push_back(tr(STR_FILE_TRANSFER));
-  menuIcons.push_back(Transfer);
-  menuItems.push_back(tr(STR_SETTINGS_TITLE));
-  menuIcons.push_back(Settings);
-
-  GUI.drawButtonMenu(
-      renderer,
-      Rect{0, metrics.homeTopPadding + metrics.homeCoverTileHeight + metrics.verticalSpacing, pageWidth,
-           pageHeight - (metrics.headerHeight + metrics.homeTopPadding + metrics.verticalSpacing * 2 +
-                         metrics.buttonHintsHeight)},
-      static_cast<int>(menuItems.size()), selectorIndex - recentBooks.size(),
-      [&menuItems](int index) { return std::string(menuItems[index]); },
-      [&menuIcons](int index) { return menuIcons[index]; });
-
-  const auto labels = mappedInput.mapLabels("", tr(STR_SELECT), tr(STR_DIR_UP), tr(STR_DIR_DOWN));
-  GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
-
+  HomeView::render(renderer, {recentBooks, selectorIndex, hasOpdsUrl,
+                              mappedInput.mapLabels("", tr(STR_SELECT), tr(STR_DIR_UP), tr(STR_DIR_DOWN)),
+                              coverRendered, coverBufferStored, std::bind(&HomeActivity::storeCoverBuffer, this),
+                              std::bind(&HomeActivity::restoreCoverBuffer, this)});
   renderer.displayBuffer();
-
-  if (!firstRenderDone) {
-    firstRenderDone = true;
-    requestUpdate();
-  } else if (!recentsLoaded && !recentsLoading) {
-    recentsLoading = true;
-    loadRecentCovers(metrics.homeCoverHeight);
-  }
 }
 
 void HomeActivity::onMyLibraryOpen() { activityManager.goToMyLibrary(); }
@@ -1,5 +1,6 @@
 #pragma once
 #include <functional>
+#include <string>
 #include <vector>
 
 #include "../Activity.h"
@@ -12,14 +13,13 @@ struct Rect;
 class HomeActivity final : public Activity {
   ButtonNavigator buttonNavigator;
   int selectorIndex = 0;
-  bool recentsLoading = false;
-  bool recentsLoaded = false;
-  bool firstRenderDone = false;
   bool hasOpdsUrl = false;
-  bool coverRendered = false;      // Track if cover has been rendered once
-  bool coverBufferStored = false;  // Track if cover buffer is stored
-  uint8_t* coverBuffer = nullptr;  // HomeActivity's own buffer for cover image
+  bool coverRendered = false;       // Track if cover has been rendered once
+  bool coverBufferStored = false;   // Track if cover buffer is stored
+  uint8_t* coverBuffer = nullptr;   // HomeActivity's own buffer for cover image
+  uint32_t seenThumbnailCount = 0;  // THUMBNAILS.getCompletedCount() as of the last cover render
   std::vector<RecentBook> recentBooks;
+  std::vector<std::string> pendingCovers;  // books whose thumbnail was requested from THUMBNAILS
   void onMyLibraryOpen();
   void onRecentsOpen();
   void onSettingsOpen();
@@ -33,7 +33,8 @@ class HomeActivity final : public Activity {
   bool restoreCoverBuffer();  // Restore frame buffer from stored cover
   void freeCoverBuffer();     // Free the stored cover buffer
   void loadRecentBooks(int maxBooks);
-  void loadRecentCovers(int coverHeight);
+  void requestRecentCovers(int coverHeight);
+  void onThumbnailsCompleted(int coverHeight);
 
  public:
   explicit HomeActivity(GfxRenderer& renderer, MappedInputManager& mappedInput)
@@ -42,4 +43,5 @@ class HomeActivity final : public Activity {
   void onExit() override;
   void loop() override;
   void render(RenderLock&&) override;
+  bool preventAutoSleep() override;
 };
@@ -0,0 +1,56 @@
+#include "HomeView.h"
+
+#include <GfxRenderer.h>
+#include <I18n.h>
+
+#include <string>
+
+#include "RecentBooksStore.h"
+#include "components/UITheme.h"
+
+void HomeView::render(GfxRenderer& renderer, const State& state) {
+  const auto& metrics = UITheme::getInstance().getMetrics();
+  const auto pageWidth = renderer.getScreenWidth();
+  const auto pageHeight = renderer.getScreenHeight();
+
+  renderer.clearScreen();
+  bool bufferRestored = state.coverBufferStored && state.restoreCoverBuffer();
+
+  GUI.drawHeader(renderer, Rect{0, metrics.topPadding, pageWidth, metrics.homeTopPadding}, nullptr);
+
+  if (metrics.homeCoverTileHeight > 0) {
+    GUI.drawRecentBookCover(renderer, Rect{0, metrics.homeTopPadding, pageWidth, metrics.homeCoverTileHeight},
+                            state.recentBooks, state.selectorIndex, state.coverRendered, state.coverBufferStored,
+                            bufferRestored, state.storeCoverBuffer);
+  }
+
+  // Build menu items dynamically
+  // Menu order: My Library, Recents, [OPDS], Apps, App Store, File Transfer, Settings
+  std::vector<const char*> menuItems = {tr(STR_BROWSE_FILES), tr(STR_MENU_RECENT_BOOKS)};
+  std::vector<UIIcon> menuIcons = {Folder, Recent};
+
+  if (state.hasOpdsUrl) {
+    menuItems.push_back(tr(STR_OPDS_BROWSER));
+    menuIcons.push_back(Library);
+  }
+
+  menuItems.push_back(tr(STR_APPS));
+  menuIcons.push_back(Folder);
+  menuItems.push_back(tr(STR_APP_STORE));
+  menuIcons.push_back(Library);
+  menuItems.push_back(tr(STR_FILE_TRANSFER));
+  menuIcons.push_back(Transfer);
+  menuItems.push_back(tr(STR_SETTINGS_TITLE));
+  menuIcons.push_back(Settings);
+
+  GUI.drawButtonMenu(
+      renderer,
+      Rect{0, metrics.homeTopPadding + metrics.homeCoverTileHeight + metrics.verticalSpacing, pageWidth,
+           pageHeight - (metrics.headerHeight + metrics.homeTopPadding + metrics.verticalSpacing * 2 +
+                         metrics.buttonHintsHeight)},
+      static_cast<int>(menuItems.size()), state.selectorIndex - static_cast<int>(state.recentBooks.size()),
+      [&menuItems](int index) { return std::string(menuItems[index]); },
+      [&menuIcons](int index) { return menuIcons[index]; });
+
+  GUI.drawButtonHints(renderer, state.hints.btn1, state.hints.btn2, state.hints.btn3, state.hints.btn4);
+}
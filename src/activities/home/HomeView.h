@@ -0,0 +1,29 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "MappedInputManager.h"
+
+class GfxRenderer;
+struct RecentBook;
+
+// The home screen as HomeActivity draws it, split out so it can be drawn without the activity (test/render)
+namespace HomeView {
+
+struct State {
+  const std::vector<RecentBook>& recentBooks;
+  int selectorIndex;
+  bool hasOpdsUrl;
+  MappedInputManager::Labels hints;
+  // The cover tile is drawn once and put back from a stored copy after that (see BaseTheme::drawRecentBookCover)
+  bool& coverRendered;
+  bool& coverBufferStored;
+  std::function<bool()> storeCoverBuffer;
+  std::function<bool()> restoreCoverBuffer;
+};
+
+// Clears the frame buffer and draws the screen into it; the caller displays it
+void render(GfxRenderer& renderer, const State& state);
+
+}  // namespace HomeView
@@ -0,0 +1,99 @@
+#include "LibraryView.h"
+
+#include <GfxRenderer.h>
+#include <I18n.h>
+
+#include "components/UITheme.h"
+#include "fontIds.h"
+
+namespace {
+std::string getFileName(std::string filename) {
+  if (filename.back() == '/') {
+    return filename.substr(0, filename.length() - 1);
+  }
+  const auto pos = filename.rfind('.');
+  return filename.substr(0, pos);
+}
+}  // namespace
+
+void LibraryView::renderList(GfxRenderer& renderer, const ListState& state) {
+  renderer.clearScreen();
+
+  const auto pageWidth = renderer.getScreenWidth();
+  const auto pageHeight = renderer.getScreenHeight();
+  const auto& metrics = UITheme::getInstance().getMetrics();
+
+  GUI.drawHeader(renderer, Rect{0, metrics.topPadding, pageWidth, metrics.headerHeight}, state.title);
+
+  const int contentTop = metrics.topPadding + metrics.headerHeight + metrics.verticalSpacing;
+  const int contentHeight = pageHeight - contentTop - metrics.buttonHintsHeight - metrics.verticalSpacing;
+  if (state.entryCount == 0) {
+    renderer.drawText(UI_10_FONT_ID, metrics.contentSidePadding, contentTop + 20, tr(STR_NO_BOOKS_FOUND));
+  } else {
+    GUI.drawList(
+        renderer, Rect{0, contentTop, pageWidth, contentHeight}, state.entryCount, state.selectorIndex,
+        [&state](int index) { return getFileName(state.entryAt(index)); }, nullptr,
+        [&state](int index) { return UITheme::getFileIcon(state.entryAt(index)); });
+  }
+
+  GUI.drawButtonHints(renderer, state.hints.btn1, state.hints.btn2, state.hints.btn3, state.hints.btn4);
+}
+
+void LibraryView::renderDeleteConfirm(GfxRenderer& renderer, const std::string& itemName, const std::string& error,
+                                      const MappedInputManager::Labels& hints) {
+  renderer.clearScreen();
+
+  const auto pageWidth = renderer.getScreenWidth();
+  const auto pageHeight = renderer.getScreenHeight();
+  const auto& metrics = UITheme::getInstance().getMetrics();
+
+  GUI.drawHeader(renderer, Rect{0, metrics.topPadding, pageWidth, metrics.headerHeight}, "Delete Item");
+
+  if (error.empty()) {
+    renderer.drawCenteredText(UI_10_FONT_ID, pageHeight / 2 - 40, "Are you sure you want to delete:", true);
+    renderer.drawCenteredText(UI_10_FONT_ID, pageHeight / 2 - 10, itemName.c_str(), true, EpdFontFamily::BOLD);
+    renderer.drawCenteredText(UI_10_FONT_ID, pageHeight / 2 + 30, "This action cannot be undone!", true);
+  } else {
+    renderer.drawCenteredText(UI_10_FONT_ID, pageHeight / 2 - 20, error.c_str(), true, EpdFontFamily::BOLD);
+    renderer.drawCenteredText(UI_10_FONT_ID, pageHeight / 2 + 10, itemName.c_str(), true);
+  }
+
+  GUI.drawButtonHints(renderer, hints.btn1, hints.btn2, hints.btn3, hints.btn4);
+}
+
+void LibraryView::renderMovePicker(GfxRenderer& renderer, const std::string& folderName,
+                                   const std::vector<std::string>& dirs, const size_t selectorIndex,
+                                   const std::string& error, const MappedInputManager::Labels& hints) {
+  renderer.clearScreen();
+
+  const auto pageWidth = renderer.getScreenWidth();
+  const auto pageHeight = renderer.getScreenHeight();
+  const auto& metrics = UITheme::getInstance().getMetrics();
+
+  const std::string headerTitle = "Move to: " + folderName;
+  GUI.drawHeader(renderer, Rect{0, metrics.topPadding, pageWidth, metrics.headerHeight}, headerTitle.c_str());
+
+  const int contentTop = metrics.topPadding + metrics.headerHeight + metrics.verticalSpacing;
+  const int contentHeight = pageHeight - contentTop - metrics.buttonHintsHeight - metrics.verticalSpacing;
+
+  const int totalItems = static_cast<int>(dirs.size()) + 1;  // +1 for "Move here"
+  GUI.drawList(
+      renderer, Rect{0, contentTop, pageWidth, contentHeight}, totalItems, static_cast<int>(selectorIndex),
+      [&dirs](int index) -> std::string {
+        if (index == 0) return "> Move here <";
+        return dirs[index - 1];
+      },
+      nullptr, nullptr, nullptr);
+
+  if (!error.empty()) {
+    // Draw error text centered below the header
+    const int errorY = contentTop;
+    const int errorWidth = renderer.getTextWidth(UI_10_FONT_ID, error.c_str());
+    // Draw a white background behind the error text so it's readable over the list
+    renderer.fillRect((pageWidth - errorWidth) / 2 - 4, errorY - 2, errorWidth + 8,
+                      renderer.getLineHeight(UI_10_FONT_ID) + 4, false);
+    renderer.drawCenteredText(UI_10_FONT_ID, errorY, error.c_str(), true);
+  }
+
+  GUI.drawButtonHints(renderer, hints.btn1, hints.btn2, hints.btn3, hints.btn4);
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "MappedInputManager.h"
+
+class GfxRenderer;
+
+// The screens MyLibraryActivity draws, split out so they can be drawn without the activity (test/render). Each clears
+// the frame buffer and draws into it; the caller displays it.
+namespace LibraryView {
+
+struct ListState {
+  const char* title;
+  size_t entryCount;
+  size_t selectorIndex;
+  // Entry names as the catalog lists them, e.g. "Books/" or "notes.txt"
+  std::function<std::string(int index)> entryAt;
+  MappedInputManager::Labels hints;
+};
+
+void renderList(GfxRenderer& renderer, const ListState& state);
+
+// Asks to confirm deleting `itemName`, or says why deleting it failed when `error` is set
+void renderDeleteConfirm(GfxRenderer& renderer, const std::string& itemName, const std::string& error,
+                         const MappedInputManager::Labels& hints);
+
+// The folder picker for a move: "Move here", then the subfolders of the folder being browsed
+void renderMovePicker(GfxRenderer& renderer, const std::string& folderName, const std::vector<std::string>& dirs,
+                      size_t selectorIndex, const std::string& error, const MappedInputManager::Labels& hints);
+
+}  // namespace LibraryView
@@ -1,6 +1,6 @@
 #include "MyLibraryActivity.h"
 
-#include <Epub.h>
+#include <BookCacheId.h>
 #include <GfxRenderer.h>
 #include <HalStorage.h>
 #include <I18n.h>
@@ -8,102 +8,45 @@
 #include <algorithm>
 
 #include "../util/ConfirmationActivity.h"
+#include "LibraryCatalog.h"
+#include "LibraryView.h"
 #include "MappedInputManager.h"
+#include "ThumbnailQueue.h"
 #include "activities/util/KeyboardFactory.h"
 #include "components/UITheme.h"
-#include "fontIds.h"
-#include "util/StringUtils.h"
 
 namespace {
 constexpr unsigned long GO_HOME_MS = 1000;
 constexpr unsigned long DELETE_CONFIRM_MS = 1000;
 }  // namespace
 
-void sortFileList(std::vector<std::string>& strs) {
-  std::sort(begin(strs), end(strs), [](const std::string& str1, const std::string& str2) {
-    // Directories first
-    bool isDir1 = str1.back() == '/';
-    bool isDir2 = str2.back() == '/';
-    if (isDir1 != isDir2) return isDir1;
-
-    // Start naive natural sort
-    const char* s1 = str1.c_str();
-    const char* s2 = str2.c_str();
-
-    // Iterate while both strings have characters
-    while (*s1 && *s2) {
-      // Check if both are at the start of a number
-      if (isdigit(*s1) && isdigit(*s2)) {
-        // Skip leading zeros and track them
-        const char* start1 = s1;
-        const char* start2 = s2;
-        while (*s1 == '0') s1++;
-        while (*s2 == '0') s2++;
-
-        // Count digits to compare lengths first
-        int len1 = 0, len2 = 0;
-        while (isdigit(s1[len1])) len1++;
-        while (isdigit(s2[len2])) len2++;
-
-        // Different length so return smaller integer value
-        if (len1 != len2) return len1 < len2;
-
-        // Same length so compare digit by digit
-        for (int i = 0; i < len1; i++) {
-          if (s1[i] != s2[i]) return s1[i] < s2[i];
-        }
-
-        // Numbers equal so advance pointers
-        s1 += len1;
-        s2 += len2;
-      } else {
-        // Regular case-insensitive character comparison
-        char c1 = tolower(*s1);
-        char c2 = tolower(*s2);
-        if (c1 != c2) return c1 < c2;
-        s1++;
-        s2++;
-      }
-    }
-
-    // One string is prefix of other
-    return *s1 == '\0' && *s2 != '\0';
-  });
-}
-
 void MyLibraryActivity::loadFiles() {
-  files.clear();
+  // List the folder from the catalog straight away and leave checking it against the card to loop(). A folder seen
+  // for the first time has to be scanned before there is anything to show.
+  filesFirst = 0;
+  if (LIBRARY_CATALOG.loadFolderPage(basepath, 0, filesPerPage(), files, fileCount)) {
+    rescanPending = true;
+  } else {
+    LIBRARY_CATALOG.rescanFolder(basepath);
+    LIBRARY_CATALOG.loadFolderPage(basepath, 0, filesPerPage(), files, fileCount);
+    rescanPending = false;
+  }
+}
 
-  auto root = Storage.open(basepath.c_str());
-  if (!root || !root.isDirectory()) {
-    if (root) root.close();
+void MyLibraryActivity::rescanFiles() {
+  rescanPending = false;
+  bool changed = false;
+  if (!LIBRARY_CATALOG.rescanFolder(basepath, &changed) || !changed) {
     return;
   }
 
-  root.rewindDirectory();
-
-  char name[500];
-  for (auto file = root.openNextFile(); file; file = root.openNextFile()) {
-    file.getName(name, sizeof(name));
-    if (name[0] == '.' || strcmp(name, "System Volume Information") == 0) {
-      file.close();
-      continue;
-    }
-
-    if (file.isDirectory()) {
-      files.emplace_back(std::string(name) + "/");
-    } else {
-      auto filename = std::string(name);
-      if (StringUtils::checkFileExtension(filename, ".epub") || StringUtils::checkFileExtension(filename, ".xtch") ||
-          StringUtils::checkFileExtension(filename, ".xtc") || StringUtils::checkFileExtension(filename, ".txt") ||
-          StringUtils::checkFileExtension(filename, ".md") || StringUtils::checkFileExtension(filename, ".bmp")) {
-        files.emplace_back(filename);
-      }
-    }
-    file.close();
-  }
-  root.close();
-  sortFileList(files);
+  RenderLock lock(*this);
+  const std::string selected = selectorIndex < fileCount ? fileAt(selectorIndex) : "";
+  filesFirst = 0;
+  LIBRARY_CATALOG.loadFolderPage(basepath, 0, filesPerPage(), files, fileCount);
+  selectorIndex = findEntry(selected);
+  lock.unlock();
+  requestUpdate();
 }
 
 void MyLibraryActivity::onEnter() {
@@ -111,21 +54,23 @@ void MyLibraryActivity::onEnter() {
 
   loadFiles();
   selectorIndex = 0;
+  // Nothing here asks for thumbnails, but the worker sweeps the library while the device is charging
+  THUMBNAILS.resume();
 
   requestUpdate();
 }
 
 void MyLibraryActivity::onExit() {
   Activity::onExit();
+  THUMBNAILS.pause();
   files.clear();
+  fileCount = 0;
 }
 
 void MyLibraryActivity::clearFileMetadata(const std::string& fullPath) {
-  // Only clear cache for .epub files
-  if (StringUtils::checkFileExtension(fullPath, ".epub")) {
-    Epub(fullPath, "/.crosspoint").clearCache();
-    LOG_DBG("MyLibrary", "Cleared metadata cache for: %s", fullPath.c_str());
-  }
+  BookCacheId::onRemoved(fullPath, "/.crosspoint");
+  LIBRARY_CATALOG.onRemoved(fullPath);
+  LOG_DBG("MyLibrary", "Released metadata cache for: %s", fullPath.c_str());
 }
 
 void MyLibraryActivity::loop() {
@@ -261,6 +206,11 @@ void MyLibraryActivity::loop() {
     return;
   }
 
+  // The folder is listed from the catalog; check it against the card now that the list is up
+  if (rescanPending) {
+    rescanFiles();
+  }
+
   // Long press BACK (1s+) goes to root folder
   if (mappedInput.isPressed(MappedInputManager::Button::Back) && mappedInput.getHeldTime() >= GO_HOME_MS &&
       basepath != "/") {
@@ -273,7 +223,7 @@ void MyLibraryActivity::loop() {
   const int pageItems = UITheme::getInstance().getNumberOfItemsPerPage(renderer, true, false, true, false);
 
   // Long press CONFIRM (1s+) opens file actions menu (Cancel, Delete, Rename, Move)
-  if (!files.empty() && mappedInput.isPressed(MappedInputManager::Button::Confirm) &&
+  if (fileCount > 0 && mappedInput.isPressed(MappedInputManager::Button::Confirm) &&
       mappedInput.getHeldTime() >= DELETE_CONFIRM_MS) {
     state = State::FILE_ACTIONS;
     requestUpdate();
@@ -285,20 +235,21 @@ void MyLibraryActivity::loop() {
       skipNextConfirmRelease = false;
       return;
     }
-    if (files.empty()) {
+    if (fileCount == 0) {
       return;
     }
 
     // Only open on short press (long press already handled above)
     if (mappedInput.getHeldTime() < DELETE_CONFIRM_MS) {
+      const std::string selected = fileAt(selectorIndex);
       if (basepath.back() != '/') basepath += "/";
-      if (files[selectorIndex].back() == '/') {
-        basepath += files[selectorIndex].substr(0, files[selectorIndex].length() - 1);
+      if (selected.back() == '/') {
+        basepath += selected.substr(0, selected.length() - 1);
         loadFiles();
         selectorIndex = 0;
         requestUpdate();
       } else {
-        onSelectBook(basepath + files[selectorIndex]);
+        onSelectBook(basepath + selected);
         return;
       }
     }
@@ -326,7 +277,7 @@ void MyLibraryActivity::loop() {
     }
   }
 
-  int listSize = static_cast<int>(files.size());
+  int listSize = static_cast<int>(fileCount);
   buttonNavigator.onNextRelease([this, listSize] {
     selectorIndex = ButtonNavigator::nextIndex(static_cast<int>(selectorIndex), listSize);
     requestUpdate();
@@ -349,9 +300,9 @@ void MyLibraryActivity::loop() {
 }
 
 void MyLibraryActivity::deleteSelectedItem() {
-  if (selectorIndex >= files.size()) return;
+  if (selectorIndex >= fileCount) return;
 
-  std::string itemName = files[selectorIndex];
+  std::string itemName = fileAt(selectorIndex);
   const bool isDir = !itemName.empty() && itemName.back() == '/';
   if (isDir) itemName = itemName.substr(0, itemName.length() - 1);
 
@@ -374,10 +325,11 @@ void MyLibraryActivity::deleteSelectedItem() {
     if (!isDir) {
       RECENT_BOOKS.removeBook(fullPath);
     }
+    clearFileMetadata(fullPath);
 
     loadFiles();
-    if (selectorIndex >= files.size() && !files.empty()) {
-      selectorIndex = files.size() - 1;
+    if (selectorIndex >= fileCount && fileCount > 0) {
+      selectorIndex = fileCount - 1;
     }
     state = State::BROWSING;
     deleteError.clear();
@@ -391,9 +343,9 @@ void MyLibraryActivity::deleteSelectedItem() {
 }
 
 void MyLibraryActivity::startRename() {
-  if (selectorIndex >= files.size()) return;
+  if (selectorIndex >= fileCount) return;
 
-  std::string itemName = files[selectorIndex];
+  std::string itemName = fileAt(selectorIndex);
   const bool isDir = !itemName.empty() && itemName.back() == '/';
   if (isDir) itemName = itemName.substr(0, itemName.length() - 1);
 
@@ -418,12 +370,12 @@ void MyLibraryActivity::startRename() {
       [this, isDir, extension](const ActivityResult& res) {
         if (!res.isCancelled) {
           auto* keyboardResult = std::get_if<KeyboardResult>(&res.data);
-          if (keyboardResult && !keyboardResult->text.empty() && selectorIndex < files.size()) {
+          if (keyboardResult && !keyboardResult->text.empty() && selectorIndex < fileCount) {
             const std::string& newName = keyboardResult->text;
             std::string dir = basepath;
             if (dir.back() != '/') dir += "/";
 
-            std::string oldItemName = files[selectorIndex];
+            std::string oldItemName = fileAt(selectorIndex);
             if (isDir) oldItemName = oldItemName.substr(0, oldItemName.length() - 1);
 
             const std::string oldPath = dir + oldItemName;
@@ -434,6 +386,8 @@ void MyLibraryActivity::startRename() {
 
             if (Storage.rename(oldPath.c_str(), newPath.c_str())) {
               LOG_DBG("MY_LIBRARY", "Renamed successfully");
+              BookCacheId::onMoved(oldPath, newPath);
+              LIBRARY_CATALOG.onMoved(oldPath, newPath);
 
               if (!isDir) {
                 const auto bookData = RECENT_BOOKS.getDataFromBook(oldPath);
@@ -489,13 +443,13 @@ void MyLibraryActivity::loadMoveDirs() {
     file.close();
   }
   root.close();
-  sortFileList(moveDirs);
+  std::sort(moveDirs.begin(), moveDirs.end(), LibraryCatalog::listsBefore);
 }
 
 void MyLibraryActivity::startMove() {
-  if (selectorIndex >= files.size()) return;
+  if (selectorIndex >= fileCount) return;
 
-  std::string itemName = files[selectorIndex];
+  std::string itemName = fileAt(selectorIndex);
   moveSourceIsDir = !itemName.empty() && itemName.back() == '/';
   if (moveSourceIsDir) itemName = itemName.substr(0, itemName.length() - 1);
 
@@ -539,6 +493,8 @@ void MyLibraryActivity::executeMoveHere() {
 
   if (Storage.rename(moveSourcePath.c_str(), newPath.c_str())) {
     LOG_DBG("MY_LIBRARY", "Moved successfully");
+    BookCacheId::onMoved(moveSourcePath, newPath);
+    LIBRARY_CATALOG.onMoved(moveSourcePath, newPath);
 
     if (!moveSourceIsDir) {
       // Update recent books store if this book was tracked
@@ -550,8 +506,8 @@ void MyLibraryActivity::executeMoveHere() {
     }
 
     loadFiles();
-    if (selectorIndex >= files.size() && !files.empty()) {
-      selectorIndex = files.size() - 1;
+    if (selectorIndex >= fileCount && fileCount > 0) {
+      selectorIndex = fileCount - 1;
     }
 
     state = State::BROWSING;
@@ -564,111 +520,57 @@ void MyLibraryActivity::executeMoveHere() {
   requestUpdate();
 }
 
-std::string getFileName(std::string filename) {
-  if (filename.back() == '/') {
-    return filename.substr(0, filename.length() - 1);
-  }
-  const auto pos = filename.rfind('.');
-  return filename.substr(0, pos);
-}
-
 void MyLibraryActivity::render(RenderLock&&) {
-  renderer.clearScreen();
-
-  const auto pageWidth = renderer.getScreenWidth();
-  const auto pageHeight = renderer.getScreenHeight();
-  const auto& metrics = UITheme::getInstance().getMetrics();
-
-  if (state == State::DELETE_CONFIRM && selectorIndex < files.size()) {
-    std::string itemName = files[selectorIndex];
+  if (state == State::DELETE_CONFIRM && selectorIndex < fileCount) {
+    std::string itemName = fileAt(selectorIndex);
     const bool isDir = !itemName.empty() && itemName.back() == '/';
     if (isDir) itemName = itemName.substr(0, itemName.length() - 1);
 
-    GUI.drawHeader(renderer, Rect{0, metrics.topPadding, pageWidth, metrics.headerHeight}, "Delete Item");
-
-    if (deleteError.empty()) {
-      renderer.drawCenteredText(UI_10_FONT_ID, pageHeight / 2 - 40, "Are you sure you want to delete:", true);
-      renderer.drawCenteredText(UI_10_FONT_ID, pageHeight / 2 - 10, itemName.c_str(), true, EpdFontFamily::BOLD);
-      renderer.drawCenteredText(UI_10_FONT_ID, pageHeight / 2 + 30, "This action cannot be undone!", true);
-
-      const auto labels = mappedInput.mapLabels("« Cancel", "Delete", "", "");
-      GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
-    } else {
-      renderer.drawCenteredText(UI_10_FONT_ID, pageHeight / 2 - 20, deleteError.c_str(), true, EpdFontFamily::BOLD);
-      renderer.drawCenteredText(UI_10_FONT_ID, pageHeight / 2 + 10, itemName.c_str(), true);
-
-      const auto labels = mappedInput.mapLabels("« Back", "", "", "");
-      GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
-    }
-
+    const auto labels = deleteError.empty() ? mappedInput.mapLabels("« Cancel", "Delete", "", "")
+                                             : mappedInput.mapLabels("« Back", "", "", "");
+    LibraryView::renderDeleteConfirm(renderer, itemName, deleteError, labels);
     renderer.displayBuffer();
     return;
   }
 
   // Move browsing state - directory picker for move destination
   if (state == State::MOVE_BROWSING) {
-    std::string moveFolderName = (moveBrowsePath == "/") ? tr(STR_SD_CARD) : moveBrowsePath.substr(moveBrowsePath.rfind('/') + 1);
-    const std::string headerTitle = "Move to: " + moveFolderName;
-    GUI.drawHeader(renderer, Rect{0, metrics.topPadding, pageWidth, metrics.headerHeight}, headerTitle.c_str());
-
-    const int contentTop = metrics.topPadding + metrics.headerHeight + metrics.verticalSpacing;
-    const int contentHeight = pageHeight - contentTop - metrics.buttonHintsHeight - metrics.verticalSpacing;
-
-    const int totalItems = static_cast<int>(moveDirs.size()) + 1;  // +1 for "Move here"
-    GUI.drawList(
-        renderer, Rect{0, contentTop, pageWidth, contentHeight}, totalItems, static_cast<int>(moveSelectorIndex),
-        [this](int index) -> std::string {
-          if (index == 0) return "> Move here <";
-          return moveDirs[index - 1];
-        },
-        nullptr, nullptr, nullptr);
-
-    if (!moveError.empty()) {
-      // Draw error text centered below the header
-      const int errorY = contentTop;
-      const int errorWidth = renderer.getTextWidth(UI_10_FONT_ID, moveError.c_str());
-      // Draw a white background behind the error text so it's readable over the list
-      renderer.fillRect((pageWidth - errorWidth) / 2 - 4, errorY - 2, errorWidth + 8,
-                        renderer.getLineHeight(UI_10_FONT_ID) + 4, false);
-      renderer.drawCenteredText(UI_10_FONT_ID, errorY, moveError.c_str(), true);
-    }
-
+    const std::string moveFolderName =
+        (moveBrowsePath == "/") ? tr(STR_SD_CARD) : moveBrowsePath.substr(moveBrowsePath.rfind('/') + 1);
     const auto labels = mappedInput.mapLabels(tr(STR_BACK), tr(STR_SELECT), tr(STR_DIR_UP), tr(STR_DIR_DOWN));
-    GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
-
+    LibraryView::renderMovePicker(renderer, moveFolderName, moveDirs, moveSelectorIndex, moveError, labels);
     renderer.displayBuffer();
     return;
   }
 
-  std::string folderName = (basepath == "/") ? tr(STR_SD_CARD) : basepath.substr(basepath.rfind('/') + 1);
-  GUI.drawHeader(renderer, Rect{0, metrics.topPadding, pageWidth, metrics.headerHeight}, folderName.c_str());
-
-  const int contentTop = metrics.topPadding + metrics.headerHeight + metrics.verticalSpacing;
-  const int contentHeight = pageHeight - contentTop - metrics.buttonHintsHeight - metrics.verticalSpacing;
-  if (files.empty()) {
-    renderer.drawText(UI_10_FONT_ID, metrics.contentSidePadding, contentTop + 20, tr(STR_NO_BOOKS_FOUND));
-  } else {
-    GUI.drawList(
-        renderer, Rect{0, contentTop, pageWidth, contentHeight}, files.size(), selectorIndex,
-        [this](int index) { return getFileName(files[index]); }, nullptr,
-        [this](int index) { return UITheme::getFileIcon(files[index]); });
-  }
-
+  const std::string folderName = (basepath == "/") ? tr(STR_SD_CARD) : basepath.substr(basepath.rfind('/') + 1);
   // File actions menu: show action buttons instead of normal hints
-  if (state == State::FILE_ACTIONS) {
-    const auto labels = mappedInput.mapLabels(tr(STR_CANCEL), "Delete", "Rename", "Move");
-    GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
-  } else {
-    const auto labels = mappedInput.mapLabels(basepath == "/" ? tr(STR_HOME) : tr(STR_BACK), tr(STR_OPEN), tr(STR_DIR_UP),
-                                              tr(STR_DIR_DOWN));
-    GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
-  }
-
+  const auto labels = state == State::FILE_ACTIONS
+                          ? mappedInput.mapLabels(tr(STR_CANCEL), "Delete", "Rename", "Move")
+                          : mappedInput.mapLabels(basepath == "/" ? tr(STR_HOME) : tr(STR_BACK), tr(STR_OPEN),
+                                                  tr(STR_DIR_UP), tr(STR_DIR_DOWN));
+  LibraryView::renderList(renderer, {folderName.c_str(), fileCount, selectorIndex,
+                                     [this](int index) { return fileAt(index); }, labels});
   renderer.displayBuffer();
 }
 
 size_t MyLibraryActivity::findEntry(const std::string& name) const {
-  for (size_t i = 0; i < files.size(); i++)
-    if (files[i] == name) return i;
-  return 0;
+  size_t index = 0;
+  LIBRARY_CATALOG.findInFolder(basepath, name, index);
+  return index;
+}
+
+std::string MyLibraryActivity::fileAt(const size_t index) {
+  if (index < filesFirst || index - filesFirst >= files.size()) {
+    // The page the list draws the entry on, as the theme pages it
+    const size_t perPage = filesPerPage();
+    filesFirst = index / perPage * perPage;
+    LIBRARY_CATALOG.loadFolderPage(basepath, filesFirst, perPage, files, fileCount);
+  }
+  return index >= filesFirst && index - filesFirst < files.size() ? files[index - filesFirst] : "";
+}
+
+size_t MyLibraryActivity::filesPerPage() const {
+  const int perPage = UITheme::getInstance().getNumberOfItemsPerPage(renderer, true, false, true, false);
+  return perPage > 0 ? perPage : 1;
 }
\ No newline at end of file
@@ -22,9 +22,13 @@ class MyLibraryActivity final : public Activity {
   std::string deleteError;
   bool skipNextConfirmRelease = false;
 
-  // Files state
+  // Files state. The folder is read from the library catalog a page at a time: `files` holds the entries from index
+  // `filesFirst` on, and fileAt() loads the page holding any other one.
   std::string basepath = "/";
+  size_t fileCount = 0;
+  size_t filesFirst = 0;
   std::vector<std::string> files;
+  bool rescanPending = false;
 
   // Move state
   std::string moveSourcePath;
@@ -37,8 +41,11 @@ class MyLibraryActivity final : public Activity {
 
   // Data loading
   void loadFiles();
+  void rescanFiles();
   void loadMoveDirs();
   size_t findEntry(const std::string& name) const;
+  std::string fileAt(size_t index);
+  size_t filesPerPage() const;
 
   // Delete
   void deleteSelectedItem();
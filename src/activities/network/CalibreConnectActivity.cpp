@@ -7,6 +7,7 @@
 #include <esp_task_wdt.h>
 
 #include "MappedInputManager.h"
+#include "ThumbnailQueue.h"
 #include "WifiSelectionActivity.h"
 #include "components/UITheme.h"
 #include "fontIds.h"
@@ -84,6 +85,9 @@ void CalibreConnectActivity::startWebServer() {
 
   if (webServer->isRunning()) {
     state = CalibreConnectState::SERVER_RUNNING;
+    // Prepare received books between uploads; whatever is left is finished when file transfer closes
+    uploadActive = false;
+    THUMBNAILS.resume(true);
     requestUpdate();
   } else {
     state = CalibreConnectState::ERROR;
@@ -92,6 +96,7 @@ void CalibreConnectActivity::startWebServer() {
 }
 
 void CalibreConnectActivity::stopWebServer() {
+  THUMBNAILS.pause();
   if (webServer) {
     webServer->stop();
     webServer.reset();
@@ -127,6 +132,10 @@ void CalibreConnectActivity::loop() {
     lastHandleClientTime = millis();
 
     const auto status = webServer->getWsUploadStatus();
+    if (status.inProgress != uploadActive) {
+      uploadActive = status.inProgress;
+      THUMBNAILS.resume(!uploadActive);
+    }
     bool changed = false;
     if (status.inProgress) {
       if (status.received != lastProgressReceived || status.total != lastProgressTotal ||
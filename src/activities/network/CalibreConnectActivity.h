@@ -27,6 +27,7 @@ class CalibreConnectActivity final : public Activity {
   unsigned long lastCompleteAt = 0;
   unsigned long lastProcessedCompleteAt = 0;  // Track which server value we've already processed
   bool exitRequested = false;
+  bool uploadActive = false;  // THUMBNAILS stands aside while an upload is writing to the SD card
 
   void renderServerRunning() const;
 
@@ -11,6 +11,7 @@
 
 #include "MappedInputManager.h"
 #include "NetworkModeSelectionActivity.h"
+#include "ThumbnailQueue.h"
 #include "WifiSelectionActivity.h"
 #include "activities/network/CalibreConnectActivity.h"
 #include "components/UITheme.h"
@@ -96,9 +97,50 @@ void CrossPointWebServerActivity::onExit() {
   WiFi.mode(WIFI_OFF);
   delay(30);  // Allow WiFi hardware to power down
 
+  // With the network gone the books that just arrived have the heap to themselves
+  finishIndexing();
+  THUMBNAILS.pause();
+
   LOG_DBG("WEBACT", "Free heap at onExit end: %d bytes", ESP.getFreeHeap());
 }
 
+void CrossPointWebServerActivity::finishIndexing() {
+  auto status = THUMBNAILS.getIndexStatus();
+  if (status.pending == 0) {
+    return;
+  }
+  LOG_DBG("WEBACT", "Preparing %u new book(s) before leaving", static_cast<unsigned>(status.pending));
+
+  // Prepare the books that were just transferred now, so their first open is quick. Back skips the rest, which then
+  // waits for the next time the worker may sweep.
+  THUMBNAILS.resume(true);
+  const uint32_t startCompleted = status.completed;
+  const size_t total = status.pending;
+  const Rect popupRect = GUI.drawPopup(renderer, tr(STR_INDEXING));
+  int shownProgress = 0;
+  while (status.pending > 0) {
+    delay(100);
+    esp_task_wdt_reset();
+    mappedInput.update();
+    if (mappedInput.wasPressed(MappedInputManager::Button::Back)) {
+      LOG_DBG("WEBACT", "Skipped preparing %u book(s)", static_cast<unsigned>(status.pending));
+      break;
+    }
+    status = THUMBNAILS.getIndexStatus();
+    // Between books the worker may find it can't start the next one, e.g. with the heap still tight; it would only
+    // retry on a later poll, so don't hold the screen waiting for it
+    if (status.pending > 0 && status.current.empty() && !THUMBNAILS.canIndex()) {
+      LOG_DBG("WEBACT", "Can't prepare %u book(s) now, leaving them queued", static_cast<unsigned>(status.pending));
+      break;
+    }
+    const int progress = static_cast<int>((status.completed - startCompleted) * 100 / total);
+    if (progress != shownProgress) {
+      shownProgress = progress;
+      GUI.fillPopupProgress(renderer, popupRect, progress);
+    }
+  }
+}
+
 void CrossPointWebServerActivity::onNetworkModeSelected(const NetworkMode mode) {
   const char* modeName = "Join Network";
   if (mode == NetworkMode::CONNECT_CALIBRE) {
@@ -248,6 +290,11 @@ void CrossPointWebServerActivity::startWebServer() {
     state = WebServerActivityState::SERVER_RUNNING;
     LOG_DBG("WEBACT", "Web server started successfully");
 
+    // The screen sits idle while the server runs, a good time to make thumbnails for the whole library
+    uploadActive = false;
+    THUMBNAILS.restartSweep();
+    THUMBNAILS.resume(true);
+
     // Force an immediate render since we're transitioning from a subactivity
     // that had its own rendering task. We need to make sure our display is shown.
     requestUpdate();
@@ -332,6 +379,16 @@ void CrossPointWebServerActivity::loop() {
         }
       }
       lastHandleClientTime = millis();
+
+      const bool uploading = webServer->getWsUploadStatus().inProgress || webServer->upload.file;
+      if (uploading != uploadActive) {
+        uploadActive = uploading;
+        if (!uploading) {
+          // Pick up the books that just arrived
+          THUMBNAILS.restartSweep();
+        }
+        THUMBNAILS.resume(!uploading);
+      }
     }
 
     // Handle exit on Back button (also check outside loop)
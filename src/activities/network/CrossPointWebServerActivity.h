@@ -25,7 +25,7 @@ enum class WebServerActivityState {
  * - For AP mode: Creates an Access Point that clients can connect to
  * - Starts the CrossPointWebServer when connected
  * - Handles client requests in its loop() function
- * - Cleans up the server and shuts down WiFi on exit
+ * - Cleans up the server and shuts down WiFi on exit, then prepares the books that arrived (see THUMBNAILS.index())
  */
 class CrossPointWebServerActivity final : public Activity {
   WebServerActivityState state = WebServerActivityState::MODE_SELECTION;
@@ -44,6 +44,9 @@ class CrossPointWebServerActivity final : public Activity {
   // Performance monitoring
   unsigned long lastHandleClientTime = 0;
 
+  // The library sweep of THUMBNAILS stands aside while an upload is writing to the SD card
+  bool uploadActive = false;
+
   void renderServerRunning() const;
 
   void onNetworkModeSelected(NetworkMode mode);
@@ -51,6 +54,7 @@ class CrossPointWebServerActivity final : public Activity {
   void startAccessPoint();
   void startWebServer();
   void stopWebServer();
+  void finishIndexing();
 
  public:
   explicit CrossPointWebServerActivity(GfxRenderer& renderer, MappedInputManager& mappedInput)
@@ -15,20 +15,36 @@
 #include "EpubReaderPercentSelectionActivity.h"
 #include "KOReaderCredentialStore.h"
 #include "KOReaderSyncActivity.h"
+#include "LibraryCatalog.h"
 #include "MappedInputManager.h"
 #include "QrDisplayActivity.h"
+#include "ReaderView.h"
 #include "RecentBooksStore.h"
 #include "components/UITheme.h"
 #include "fontIds.h"
 #include "util/ScreenshotUtil.h"
+#include "util/SpeculationStats.h"
 
 namespace {
 // pagesPerRefresh now comes from SETTINGS.getRefreshFrequency()
 constexpr unsigned long skipChapterMs = 700;
 constexpr unsigned long goHomeMs = 1000;
+// A pre-rendered page includes the status bar (battery level), so don't show one that has been sitting for too long
+constexpr unsigned long maxSpeculationAgeMs = 5 * 60 * 1000;
+// Free heap to keep after storing the displayed page for pre-rendering the next one
+constexpr uint32_t speculationDisplayedReserve = 32 * 1024;
+// Free heap to keep after pre-rendering both grayscale planes of the next page
+constexpr uint32_t speculationHeapReserve = 64 * 1024;
 // pages per minute, first item is 1 to prevent division by zero if accessed
 const std::vector<int> PAGE_TURN_LABELS = {1, 1, 3, 6, 12};
 
+// Whether `frames` more spare frames fit in the heap with `reserve` to spare. They are allocated in
+// BW_BUFFER_CHUNK_SIZE pieces, so the largest free block only has to hold one piece.
+bool spareFramesFit(const uint32_t frames, const uint32_t reserve) {
+  return ESP.getFreeHeap() >= frames * HalDisplay::BUFFER_SIZE + reserve &&
+         ESP.getMaxAllocHeap() >= GfxRenderer::BW_BUFFER_CHUNK_SIZE;
+}
+
 int clampPercent(int percent) {
   if (percent < 0) {
     return 0;
@@ -104,6 +120,8 @@ void EpubReaderActivity::onEnter() {
   APP_STATE.openEpubPath = epub->getPath();
   APP_STATE.saveToFile();
   RECENT_BOOKS.addBook(epub->getPath(), epub->getTitle(), epub->getAuthor(), epub->getThumbBmpPath());
+  LIBRARY_CATALOG.updateBook({epub->getPath(), epub->getTitle(), epub->getAuthor(), epub->getLanguage(),
+                              epub->hasCover(), epub->getCachePath()});
 
   // Trigger first update
   requestUpdate();
@@ -117,6 +135,7 @@ void EpubReaderActivity::onExit() {
 
   APP_STATE.readerActivityLoadCount = 0;
   APP_STATE.saveToFile();
+  discardSpeculation();
   section.reset();
   epub.reset();
 }
@@ -156,6 +175,12 @@ void EpubReaderActivity::loop() {
 
   // Enter reader menu activity.
   if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
+    pageTurns.clear();
+    {
+      // The menu draws over the frame buffer, which may hold the pre-rendered next page
+      RenderLock lock(*this);
+      discardSpeculation();
+    }
     const int currentPage = section ? section->currentPage + 1 : 0;
     const int totalPages = section ? section->pageCount : 0;
     float bookProgress = 0.0f;
@@ -224,6 +249,7 @@ void EpubReaderActivity::loop() {
 
   if (skipChapter) {
     lastPageTurnTime = millis();
+    pageTurns.clear();
     // We don't want to delete the section mid-render, so grab the semaphore
     {
       RenderLock lock(*this);
@@ -319,9 +345,15 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
       startActivityForResult(
           std::make_unique<EpubReaderChapterSelectionActivity>(renderer, mappedInput, epub, path, spineIdx),
           [this](const ActivityResult& result) {
-            if (!result.isCancelled && currentSpineIndex != std::get<ChapterResult>(result.data).spineIndex) {
+            if (result.isCancelled) {
+              return;
+            }
+            const auto& chapter = std::get<ChapterResult>(result.data);
+            if (!chapter.anchor.empty()) {
+              jumpToAnchor(chapter.spineIndex, chapter.anchor);
+            } else if (currentSpineIndex != chapter.spineIndex) {
               RenderLock lock(*this);
-              currentSpineIndex = std::get<ChapterResult>(result.data).spineIndex;
+              currentSpineIndex = chapter.spineIndex;
               nextPageNumber = 0;
               section.reset();
             }
@@ -487,42 +519,52 @@ void EpubReaderActivity::toggleAutoPageTurn(const uint8_t selectedPageTurnOption
   }
 }
 
-void EpubReaderActivity::pageTurn(bool isForwardTurn) {
-  if (isForwardTurn) {
-    if (section->currentPage < section->pageCount - 1) {
-      section->currentPage++;
-    } else {
-      // We don't want to delete the section mid-render, so grab the semaphore
-      {
-        RenderLock lock(*this);
-        nextPageNumber = 0;
-        currentSpineIndex++;
-        section.reset();
-      }
-    }
-  } else {
-    if (section->currentPage > 0) {
-      section->currentPage--;
-    } else if (currentSpineIndex > 0) {
-      // We don't want to delete the section mid-render, so grab the semaphore
-      {
-        RenderLock lock(*this);
-        nextPageNumber = UINT16_MAX;
-        currentSpineIndex--;
-        section.reset();
-      }
-    }
-  }
+// Page turns are queued rather than applied here, so presses that arrive while a page is still rendering or
+// refreshing don't block the input loop and are collapsed into a single jump by the next render.
+void EpubReaderActivity::pageTurn(const bool isForwardTurn) {
   lastPageTurnTime = millis();
+  pageTurns.push(isForwardTurn ? 1 : -1, lastPageTurnTime);
   requestUpdate();
 }
 
+// Called by render() with the render lock held
+void EpubReaderActivity::applyPendingPageTurns() {
+  int delta;
+  if (!pageTurns.take(delta) || delta == 0) {
+    return;
+  }
+  if (!section) {
+    // The reader jumped elsewhere after these turns were pressed; they no longer apply
+    LOG_DBG("ERS", "Dropping %d page turn(s) queued before section reload", delta);
+    return;
+  }
+  if (delta > 1 || delta < -1) {
+    LOG_DBG("ERS", "Coalesced page turns: %d", delta);
+  }
+
+  const auto landing = PageTurnCoalescer::land(section->currentPage, section->pageCount, delta, currentSpineIndex == 0);
+  if (landing.chapterStep == 0) {
+    section->currentPage = landing.page;
+    return;
+  }
+  // LAST_PAGE is the UINT16_MAX that render() resolves once the previous chapter is laid out
+  nextPageNumber = landing.page;
+  currentSpineIndex += landing.chapterStep;
+  section.reset();
+}
+
 // TODO: Failure handling
 void EpubReaderActivity::render(RenderLock&& lock) {
   if (!epub) {
     return;
   }
 
+  applyPendingPageTurns();
+  if (!section) {
+    // Settings, orientation or position changed since the next page was pre-rendered
+    discardSpeculation();
+  }
+
   // edge case handling for sub-zero spine index
   if (currentSpineIndex < 0) {
     currentSpineIndex = 0;
@@ -542,24 +584,8 @@ void EpubReaderActivity::render(RenderLock&& lock) {
   }
 
   // Apply screen viewable areas and additional padding
-  int orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft;
-  renderer.getOrientedViewableTRBL(&orientedMarginTop, &orientedMarginRight, &orientedMarginBottom,
-                                   &orientedMarginLeft);
-  orientedMarginTop += SETTINGS.screenMargin;
-  orientedMarginLeft += SETTINGS.screenMargin;
-  orientedMarginRight += SETTINGS.screenMargin;
-
-  const uint8_t statusBarHeight = UITheme::getInstance().getStatusBarHeight();
-
-  // reserves space for automatic page turn indicator when no status bar or progress bar only
-  if (automaticPageTurnActive &&
-      (statusBarHeight == 0 || statusBarHeight == UITheme::getInstance().getProgressBarHeight())) {
-    orientedMarginBottom +=
-        std::max(SETTINGS.screenMargin,
-                 static_cast<uint8_t>(statusBarHeight + UITheme::getInstance().getMetrics().statusBarVerticalMargin));
-  } else {
-    orientedMarginBottom += std::max(SETTINGS.screenMargin, statusBarHeight);
-  }
+  const auto [orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft] =
+      ReaderView::pageMargins(renderer, automaticPageTurnActive);
 
   if (!section) {
     const auto filepath = epub->getSpineItem(currentSpineIndex).href;
@@ -613,6 +639,18 @@ void EpubReaderActivity::render(RenderLock&& lock) {
       section->currentPage = newPage;
       pendingPercentJump = false;
     }
+
+    if (!pendingAnchor.empty()) {
+      const int anchorPage = section->findPageForAnchor(pendingAnchor);
+      if (anchorPage >= 0 && anchorPage < section->pageCount) {
+        section->currentPage = anchorPage;
+      }
+      pendingAnchor.clear();
+    }
+  }
+
+  if (speculation.valid && showSpeculatedPage(orientedMarginTop, orientedMarginLeft)) {
+    return;
   }
 
   renderer.clearScreen();
@@ -661,6 +699,131 @@ void EpubReaderActivity::render(RenderLock&& lock) {
     pendingScreenshot = false;
     ScreenshotUtil::takeScreenshot(renderer);
   }
+
+  speculateNextPage(orientedMarginTop, orientedMarginLeft);
+}
+
+// Pre-render the next page of this chapter while the render task would otherwise sit idle. The frame buffer is left
+// holding the next page's BW frame (plus both grayscale planes in spare frames when memory allows), so a forward
+// turn only needs to start the refresh. The displayed page goes to a spare frame so it can be put back if the
+// speculation is discarded.
+void EpubReaderActivity::speculateNextPage(const int orientedMarginTop, const int orientedMarginLeft) {
+  if (!section || section->currentPage + 1 >= section->pageCount || pageTurns.hasPending()) {
+    // Nothing to pre-render at a chapter boundary, and queued turns are about to replace the page anyway
+    return;
+  }
+
+  if (!spareFramesFit(1, speculationDisplayedReserve)) {
+    LOG_DBG("ERS", "Not pre-rendering, low memory (free %u, largest block %u)", ESP.getFreeHeap(),
+            ESP.getMaxAllocHeap());
+    return;
+  }
+  if (!renderer.storeSpareFrame(GfxRenderer::SPARE_DISPLAYED)) {
+    return;
+  }
+
+  const int displayedPage = section->currentPage;
+  section->currentPage = displayedPage + 1;
+  auto page = section->loadPageFromSectionFile();
+  if (!page || page->hasImages()) {
+    // Image pages use their own refresh sequence and decode from SD anyway
+    section->currentPage = displayedPage;
+    renderer.freeSpareFrame(GfxRenderer::SPARE_DISPLAYED);
+    return;
+  }
+
+  const auto start = millis();
+  if (SETTINGS.textAntiAliasing && spareFramesFit(2, speculationHeapReserve)) {
+    renderer.clearScreen(0x00);
+    renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
+    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+    bool planesStored = renderer.storeSpareFrame(GfxRenderer::SPARE_GRAYSCALE_LSB);
+    if (planesStored) {
+      renderer.clearScreen(0x00);
+      renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
+      page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+      planesStored = renderer.storeSpareFrame(GfxRenderer::SPARE_GRAYSCALE_MSB);
+    }
+    if (!planesStored) {
+      renderer.freeSpareFrame(GfxRenderer::SPARE_GRAYSCALE_LSB);
+    }
+    renderer.setRenderMode(GfxRenderer::BW);
+  }
+
+  renderer.clearScreen();
+  page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+  renderStatusBar();
+  renderer.clearFontCache();
+  section->currentPage = displayedPage;
+
+  speculation.valid = true;
+  speculation.spineIndex = currentSpineIndex;
+  speculation.pageNumber = displayedPage + 1;
+  speculation.renderedAt = millis();
+  speculation.footnotes = std::move(page->footnotes);
+  speculation.page = std::move(page);
+  LOG_DBG("ERS", "Pre-rendered page %d in %lu ms%s", speculation.pageNumber, millis() - start,
+          renderer.hasSpareFrame(GfxRenderer::SPARE_GRAYSCALE_MSB) ? " (with grayscale)" : "");
+}
+
+// Show the pre-rendered page if it is the one being asked for; otherwise discard it. Returns true if it was shown.
+bool EpubReaderActivity::showSpeculatedPage(const int orientedMarginTop, const int orientedMarginLeft) {
+  if (speculation.spineIndex != currentSpineIndex || speculation.pageNumber != section->currentPage ||
+      millis() - speculation.renderedAt > maxSpeculationAgeMs || pendingScreenshot) {
+    discardSpeculation();
+    return false;
+  }
+
+  SpeculationStats::recordHit();
+  LOG_DBG("ERS", "Showing pre-rendered page %d (hit rate %lu/%lu)", speculation.pageNumber,
+          static_cast<unsigned long>(SpeculationStats::hits()),
+          static_cast<unsigned long>(SpeculationStats::hits() + SpeculationStats::misses()));
+
+  // The frame buffer already holds the page; the displayed page's copy is no longer needed
+  renderer.freeSpareFrame(GfxRenderer::SPARE_DISPLAYED);
+  currentPageFootnotes = std::move(speculation.footnotes);
+  auto page = std::move(speculation.page);
+  speculation.valid = false;
+
+  pageTurns.onRefreshStart(millis());
+  displayWithRefreshCadence();
+
+  if (SETTINGS.textAntiAliasing) {
+    renderer.storeBwBuffer();
+    if (renderer.hasSpareFrame(GfxRenderer::SPARE_GRAYSCALE_LSB) &&
+        renderer.hasSpareFrame(GfxRenderer::SPARE_GRAYSCALE_MSB)) {
+      renderer.loadSpareFrame(GfxRenderer::SPARE_GRAYSCALE_LSB);
+      renderer.copyGrayscaleLsbBuffers();
+      renderer.loadSpareFrame(GfxRenderer::SPARE_GRAYSCALE_MSB);
+      renderer.copyGrayscaleMsbBuffers();
+      renderer.displayGrayBuffer();
+    } else {
+      renderGrayscale(*page, orientedMarginTop, orientedMarginLeft);
+    }
+    renderer.restoreBwBuffer();
+  }
+  renderer.freeSpareFrame(GfxRenderer::SPARE_GRAYSCALE_LSB);
+  renderer.freeSpareFrame(GfxRenderer::SPARE_GRAYSCALE_MSB);
+
+  saveProgress(currentSpineIndex, section->currentPage, section->pageCount);
+  return true;
+}
+
+// Drop the pre-rendered page and put the displayed page back into the frame buffer. Must hold the render lock.
+void EpubReaderActivity::discardSpeculation() {
+  if (!speculation.valid) {
+    return;
+  }
+  SpeculationStats::recordMiss();
+  renderer.loadSpareFrame(GfxRenderer::SPARE_DISPLAYED);
+  for (int i = 0; i < GfxRenderer::SPARE_FRAME_COUNT; i++) {
+    renderer.freeSpareFrame(static_cast<GfxRenderer::SpareFrame>(i));
+  }
+  speculation.valid = false;
+  speculation.page.reset();
+  speculation.footnotes.clear();
+  LOG_DBG("ERS", "Discarded pre-rendered page (hit rate %lu/%lu)", static_cast<unsigned long>(SpeculationStats::hits()),
+          static_cast<unsigned long>(SpeculationStats::hits() + SpeculationStats::misses()));
 }
 
 void EpubReaderActivity::saveProgress(int spineIndex, int currentPage, int pageCount) {
@@ -688,6 +851,12 @@ void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int or
 
   page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
   renderStatusBar();
+
+  pageTurns.onRefreshStart(millis());
+  const auto& turnStats = pageTurns.getStats();
+  LOG_DBG("ERS", "Page turn latency %lu ms (avg %lu, max %lu, %lu turns coalesced)", turnStats.lastLatencyMs,
+          turnStats.averageLatencyMs(), turnStats.maxLatencyMs, turnStats.coalescedTurns());
+
   if (imagePageWithAA) {
     // Double FAST_REFRESH with selective image blanking (pablohc's technique):
     // HALF_REFRESH sets particles too firmly for the grayscale LUT to adjust.
@@ -707,12 +876,8 @@ void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int or
       renderer.displayBuffer(HalDisplay::HALF_REFRESH);
     }
     // Double FAST_REFRESH handles ghosting for image pages; don't count toward full refresh cadence
-  } else if (pagesUntilFullRefresh <= 1) {
-    renderer.displayBuffer(HalDisplay::HALF_REFRESH);
-    pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
   } else {
-    renderer.displayBuffer();
-    pagesUntilFullRefresh--;
+    displayWithRefreshCadence();
   }
 
   // Save bw buffer to reset buffer state after grayscale data sync
@@ -721,26 +886,40 @@ void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int or
   // grayscale rendering
   // TODO: Only do this if font supports it
   if (SETTINGS.textAntiAliasing) {
-    renderer.clearScreen(0x00);
-    renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
-    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
-    renderer.copyGrayscaleLsbBuffers();
-
-    // Render and copy to MSB buffer
-    renderer.clearScreen(0x00);
-    renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
-    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
-    renderer.copyGrayscaleMsbBuffers();
-
-    // display grayscale part
-    renderer.displayGrayBuffer();
-    renderer.setRenderMode(GfxRenderer::BW);
+    renderGrayscale(*page, orientedMarginTop, orientedMarginLeft);
   }
 
   // restore the bw data
   renderer.restoreBwBuffer();
 }
 
+void EpubReaderActivity::displayWithRefreshCadence() {
+  if (pagesUntilFullRefresh <= 1) {
+    renderer.displayBuffer(HalDisplay::HALF_REFRESH);
+    pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
+  } else {
+    renderer.displayBuffer();
+    pagesUntilFullRefresh--;
+  }
+}
+
+void EpubReaderActivity::renderGrayscale(const Page& page, const int orientedMarginTop, const int orientedMarginLeft) {
+  renderer.clearScreen(0x00);
+  renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
+  page.render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+  renderer.copyGrayscaleLsbBuffers();
+
+  // Render and copy to MSB buffer
+  renderer.clearScreen(0x00);
+  renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
+  page.render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+  renderer.copyGrayscaleMsbBuffers();
+
+  // display grayscale part
+  renderer.displayGrayBuffer();
+  renderer.setRenderMode(GfxRenderer::BW);
+}
+
 void EpubReaderActivity::renderStatusBar() const {
   // Calculate progress in book
   const int currentPage = section->currentPage + 1;
@@ -750,19 +929,8 @@ void EpubReaderActivity::renderStatusBar() const {
 
   std::string title;
 
-  int textYOffset = 0;
-
   if (automaticPageTurnActive) {
     title = tr(STR_AUTO_TURN_ENABLED) + std::to_string(60 * 1000 / pageTurnDuration);
-
-    // calculates textYOffset when rendering title in status bar
-    const uint8_t statusBarHeight = UITheme::getInstance().getStatusBarHeight();
-
-    // offsets text if no status bar or progress bar only
-    if (statusBarHeight == 0 || statusBarHeight == UITheme::getInstance().getProgressBarHeight()) {
-      textYOffset += UITheme::getInstance().getMetrics().statusBarVerticalMargin;
-    }
-
   } else if (SETTINGS.statusBarTitle == CrossPointSettings::STATUS_BAR_TITLE::CHAPTER_TITLE) {
     title = tr(STR_UNNAMED);
     const int tocIndex = epub->getTocIndexForSpineIndex(currentSpineIndex);
@@ -775,7 +943,8 @@ void EpubReaderActivity::renderStatusBar() const {
     title = epub->getTitle();
   }
 
-  GUI.drawStatusBar(renderer, bookProgress, currentPage, pageCount, title, 0, textYOffset);
+  ReaderView::renderStatusBar(renderer, {bookProgress, currentPage, static_cast<int>(pageCount), title,
+                                         automaticPageTurnActive});
 }
 
 void EpubReaderActivity::navigateToHref(const std::string& hrefStr, const bool savePosition) {
@@ -793,7 +962,6 @@ void EpubReaderActivity::navigateToHref(const std::string& hrefStr, const bool s
 
   int targetSpineIndex;
   if (sameFile) {
-    // Same file — navigate to page 0 of current spine item
     targetSpineIndex = currentSpineIndex;
   } else {
     targetSpineIndex = epub->resolveHrefToSpineIndex(hrefStr);
@@ -805,14 +973,27 @@ void EpubReaderActivity::navigateToHref(const std::string& hrefStr, const bool s
     return;
   }
 
+  const size_t fragmentPos = hrefStr.find('#');
+  jumpToAnchor(targetSpineIndex, fragmentPos != std::string::npos ? hrefStr.substr(fragmentPos + 1) : "");
+  LOG_DBG("ERS", "Navigated to spine %d for href: %s", targetSpineIndex, hrefStr.c_str());
+}
+
+// Go to the page holding `anchor` in the given spine item, or its first page if the anchor is empty or unknown.
+// The section's anchor table is only available once it is built, so other sections resolve it in render().
+void EpubReaderActivity::jumpToAnchor(const int spineIndex, const std::string& anchor) {
   {
     RenderLock lock(*this);
-    currentSpineIndex = targetSpineIndex;
-    nextPageNumber = 0;
-    section.reset();
+    if (section && spineIndex == currentSpineIndex) {
+      const int anchorPage = section->findPageForAnchor(anchor);
+      section->currentPage = anchorPage >= 0 && anchorPage < section->pageCount ? anchorPage : 0;
+    } else {
+      currentSpineIndex = spineIndex;
+      nextPageNumber = 0;
+      pendingAnchor = anchor;
+      section.reset();
+    }
   }
   requestUpdate();
-  LOG_DBG("ERS", "Navigated to spine %d for href: %s", targetSpineIndex, hrefStr.c_str());
 }
 
 void EpubReaderActivity::restoreSavedPosition() {
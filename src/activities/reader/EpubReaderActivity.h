@@ -1,10 +1,12 @@
 #pragma once
 #include <Epub.h>
 #include <Epub/FootnoteEntry.h>
+#include <Epub/Page.h>
 #include <Epub/Section.h>
 
 #include "EpubReaderMenuActivity.h"
 #include "activities/Activity.h"
+#include "util/PageTurnCoalescer.h"
 
 class EpubReaderActivity final : public Activity {
   std::shared_ptr<Epub> epub;
@@ -21,9 +23,25 @@ class EpubReaderActivity final : public Activity {
   bool pendingPercentJump = false;
   // Normalized 0.0-1.0 progress within the target spine item, computed from book percentage.
   float pendingSpineProgress = 0.0f;
+  // Element id to position on once the target section is loaded (footnote or TOC jump).
+  std::string pendingAnchor;
   bool pendingScreenshot = false;
   bool skipNextButtonCheck = false;  // Skip button processing for one frame after subactivity exit
   bool automaticPageTurnActive = false;
+  // Page turns pressed since the last render; applied together so fast presses skip intermediate pages
+  PageTurnCoalescer pageTurns;
+
+  // The next page, pre-rendered into the frame buffer while idle. The displayed page is kept in a spare frame until
+  // the speculation is either shown or discarded.
+  struct Speculation {
+    bool valid = false;
+    int spineIndex = 0;
+    int pageNumber = 0;
+    unsigned long renderedAt = 0;
+    std::unique_ptr<Page> page;
+    std::vector<FootnoteEntry> footnotes;
+  };
+  Speculation speculation;
 
   // Footnote support
   std::vector<FootnoteEntry> currentPageFootnotes;
@@ -38,6 +56,11 @@ class EpubReaderActivity final : public Activity {
   void renderContents(std::unique_ptr<Page> page, int orientedMarginTop, int orientedMarginRight,
                       int orientedMarginBottom, int orientedMarginLeft);
   void renderStatusBar() const;
+  void displayWithRefreshCadence();
+  void renderGrayscale(const Page& page, int orientedMarginTop, int orientedMarginLeft);
+  void speculateNextPage(int orientedMarginTop, int orientedMarginLeft);
+  bool showSpeculatedPage(int orientedMarginTop, int orientedMarginLeft);
+  void discardSpeculation();
   void saveProgress(int spineIndex, int currentPage, int pageCount);
   // Jump to a percentage of the book (0-100), mapping it to spine and page.
   void jumpToPercent(int percent);
@@ -45,9 +68,11 @@ class EpubReaderActivity final : public Activity {
   void applyOrientation(uint8_t orientation);
   void toggleAutoPageTurn(uint8_t selectedPageTurnOption);
   void pageTurn(bool isForwardTurn);
+  void applyPendingPageTurns();
 
   // Footnote navigation
   void navigateToHref(const std::string& href, bool savePosition = false);
+  void jumpToAnchor(int spineIndex, const std::string& anchor);
   void restoreSavedPosition();
 
  public:
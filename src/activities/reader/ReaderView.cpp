@@ -0,0 +1,44 @@
+#include "ReaderView.h"
+
+#include <GfxRenderer.h>
+
+#include <algorithm>
+
+#include "CrossPointSettings.h"
+#include "components/UITheme.h"
+
+namespace {
+// Whether the status bar draws no text line (hidden, or the progress bar alone)
+bool statusBarHasNoText() {
+  const uint8_t statusBarHeight = UITheme::getInstance().getStatusBarHeight();
+  return statusBarHeight == 0 || statusBarHeight == UITheme::getInstance().getProgressBarHeight();
+}
+}  // namespace
+
+ReaderView::Margins ReaderView::pageMargins(const GfxRenderer& renderer, const bool autoTurnNote) {
+  Margins margins;
+  renderer.getOrientedViewableTRBL(&margins.top, &margins.right, &margins.bottom, &margins.left);
+  margins.top += SETTINGS.screenMargin;
+  margins.left += SETTINGS.screenMargin;
+  margins.right += SETTINGS.screenMargin;
+
+  const uint8_t statusBarHeight = UITheme::getInstance().getStatusBarHeight();
+
+  // reserves space for automatic page turn indicator when no status bar or progress bar only
+  if (autoTurnNote && statusBarHasNoText()) {
+    margins.bottom +=
+        std::max(SETTINGS.screenMargin,
+                 static_cast<uint8_t>(statusBarHeight + UITheme::getInstance().getMetrics().statusBarVerticalMargin));
+  } else {
+    margins.bottom += std::max(SETTINGS.screenMargin, statusBarHeight);
+  }
+  return margins;
+}
+
+void ReaderView::renderStatusBar(GfxRenderer& renderer, const StatusBar& statusBar) {
+  // offsets text if no status bar or progress bar only
+  const int textYOffset =
+      statusBar.autoTurnNote && statusBarHasNoText() ? UITheme::getInstance().getMetrics().statusBarVerticalMargin : 0;
+  GUI.drawStatusBar(renderer, statusBar.bookProgress, statusBar.page, statusBar.pageCount, statusBar.title, 0,
+                    textYOffset);
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <string>
+
+class GfxRenderer;
+
+// The page frame EpubReaderActivity draws around a page, split out so it can be drawn without the activity
+// (test/render): where the page goes on screen, and the status bar under it
+namespace ReaderView {
+
+struct Margins {
+  int top;
+  int right;
+  int bottom;
+  int left;
+};
+
+// The panel's viewable area less the reader's screen margin, with room at the bottom for the status bar, or for the
+// auto page turn note when the status bar has no line of text to hold it
+Margins pageMargins(const GfxRenderer& renderer, bool autoTurnNote);
+
+struct StatusBar {
+  float bookProgress;  // Percent
+  int page;            // 1-based, in the chapter
+  int pageCount;
+  std::string title;
+  bool autoTurnNote;  // The title is the auto page turn note, placed where pageMargins() left room for it
+};
+
+void renderStatusBar(GfxRenderer& renderer, const StatusBar& statusBar);
+
+}  // namespace ReaderView
@@ -0,0 +1,32 @@
+#include "SettingsView.h"
+
+#include <GfxRenderer.h>
+#include <I18n.h>
+
+#include "components/UITheme.h"
+
+void SettingsView::render(GfxRenderer& renderer, const State& state) {
+  renderer.clearScreen();
+
+  const auto pageWidth = renderer.getScreenWidth();
+  const auto pageHeight = renderer.getScreenHeight();
+
+  const auto& metrics = UITheme::getInstance().getMetrics();
+
+  GUI.drawHeader(renderer, Rect{0, metrics.topPadding, pageWidth, metrics.headerHeight}, tr(STR_SETTINGS_TITLE),
+                 CROSSPOINT_VERSION);
+
+  GUI.drawTabBar(renderer, Rect{0, metrics.topPadding + metrics.headerHeight, pageWidth, metrics.tabBarHeight},
+                 state.tabs, false);
+
+  GUI.drawList(
+      renderer,
+      Rect{0, metrics.topPadding + metrics.headerHeight + metrics.tabBarHeight + metrics.verticalSpacing, pageWidth,
+           pageHeight - (metrics.topPadding + metrics.headerHeight + metrics.tabBarHeight + metrics.buttonHintsHeight +
+                         metrics.verticalSpacing * 2)},
+      state.settingCount, state.selectedIndex, state.settingName, nullptr, nullptr, state.settingValue, true);
+
+  // Draw help text: Left/Right for tab navigation, Up/Down on side buttons for list
+  GUI.drawButtonHints(renderer, state.hints.btn1, state.hints.btn2, state.hints.btn3, state.hints.btn4);
+  GUI.drawSideButtonHints(renderer, tr(STR_DIR_UP), tr(STR_DIR_DOWN));
+}
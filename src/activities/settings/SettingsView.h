@@ -0,0 +1,28 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "MappedInputManager.h"
+
+class GfxRenderer;
+struct TabInfo;
+
+// The settings screen as SettingsActivity draws it, split out so it can be drawn without the activity (test/render)
+namespace SettingsView {
+
+struct State {
+  // One tab per category, the one shown selected
+  const std::vector<TabInfo>& tabs;
+  int settingCount;
+  int selectedIndex;
+  std::function<std::string(int index)> settingName;
+  std::function<std::string(int index)> settingValue;
+  MappedInputManager::Labels hints;
+};
+
+// Clears the frame buffer and draws the screen into it; the caller displays it
+void render(GfxRenderer& renderer, const State& state);
+
+}  // namespace SettingsView
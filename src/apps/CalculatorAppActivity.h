@@ -1,17 +1,13 @@
 #pragma once
 
 #include "AppManifest.h"
+#include "CalculatorView.h"
 #include "activities/Activity.h"
 
 class CalculatorAppActivity final : public Activity {
   static constexpr int kDigitCount = 5;
 
-  enum class Mode {
-    EnterFirst,
-    SelectOperator,
-    EnterSecond,
-    ShowResult,
-  };
+  using Mode = CalculatorView::Mode;
 
   static constexpr char kOperators[4] = {'+', '-', '*', '/'};
 
@@ -0,0 +1,105 @@
+#include "CalculatorView.h"
+
+#include <GfxRenderer.h>
+
+#include <string>
+
+#include "components/UITheme.h"
+#include "fontIds.h"
+
+void CalculatorView::render(GfxRenderer& renderer, const State& state) {
+  renderer.clearScreen();
+
+  const int pageWidth = renderer.getScreenWidth();
+  const auto metrics = UITheme::getInstance().getMetrics();
+
+  GUI.drawHeader(renderer, Rect{0, metrics.topPadding, pageWidth, metrics.headerHeight}, state.title);
+
+  const int sidePadding = metrics.contentSidePadding;
+  int contentY = metrics.topPadding + metrics.headerHeight + metrics.verticalSpacing;
+
+  const char* modeTitle = "";
+  switch (state.mode) {
+    case Mode::EnterFirst:
+      modeTitle = "Set first value";
+      break;
+    case Mode::SelectOperator:
+      modeTitle = "Select operator";
+      break;
+    case Mode::EnterSecond:
+      modeTitle = "Set second value";
+      break;
+    case Mode::ShowResult:
+      modeTitle = "Result";
+      break;
+  }
+  renderer.drawText(UI_10_FONT_ID, sidePadding, contentY, modeTitle);
+  contentY += renderer.getLineHeight(UI_10_FONT_ID) + 8;
+
+  std::string firstLine = "A = " + std::to_string(state.firstValue);
+  renderer.drawText(UI_10_FONT_ID, sidePadding, contentY, firstLine.c_str());
+  contentY += renderer.getLineHeight(UI_10_FONT_ID) + 4;
+
+  std::string opLine = "Op = ";
+  opLine += state.operators[state.operatorIndex];
+  renderer.drawText(UI_10_FONT_ID, sidePadding, contentY, opLine.c_str());
+  contentY += renderer.getLineHeight(UI_10_FONT_ID) + 4;
+
+  if (state.mode == Mode::EnterSecond || state.mode == Mode::ShowResult) {
+    std::string secondLine = "B = " + std::to_string(state.secondValue);
+    renderer.drawText(UI_10_FONT_ID, sidePadding, contentY, secondLine.c_str());
+    contentY += renderer.getLineHeight(UI_10_FONT_ID) + 4;
+  }
+
+  if (state.mode == Mode::ShowResult) {
+    std::string resultLine =
+        state.divideByZero ? "Result = undefined" : "Result = " + std::to_string(state.resultValue);
+    renderer.drawText(UI_12_FONT_ID, sidePadding, contentY + 4, resultLine.c_str());
+  } else if (state.mode == Mode::EnterFirst || state.mode == Mode::EnterSecond) {
+    const int boxTop = contentY + 8;
+    const int boxHeight = 46;
+    const int boxWidth = 52;
+    const int gap = 8;
+    const int totalWidth = boxWidth * state.digitCount + gap * (state.digitCount - 1);
+    const int startX = (pageWidth - totalWidth) / 2;
+
+    for (int i = 0; i < state.digitCount; i++) {
+      const int boxX = startX + i * (boxWidth + gap);
+      const bool selected = (i == state.digitCursor);
+
+      if (selected) {
+        renderer.fillRect(boxX, boxTop, boxWidth, boxHeight);
+        renderer.drawRect(boxX, boxTop, boxWidth, boxHeight, false);
+      } else {
+        renderer.drawRect(boxX, boxTop, boxWidth, boxHeight);
+      }
+
+      char digitText[2] = {static_cast<char>('0' + state.digits[i]), '\0'};
+      const int textX = boxX + (boxWidth - renderer.getTextWidth(UI_12_FONT_ID, digitText)) / 2;
+      const int textY = boxTop + (boxHeight - renderer.getLineHeight(UI_12_FONT_ID)) / 2;
+      renderer.drawText(UI_12_FONT_ID, textX, textY, digitText, !selected);
+    }
+  } else if (state.mode == Mode::SelectOperator) {
+    const int cx = pageWidth / 2;
+    const int cy = contentY + 30;
+
+    const std::string prev(1, state.operators[(state.operatorIndex + 3) % 4]);
+    const std::string current(1, state.operators[state.operatorIndex]);
+    const std::string next(1, state.operators[(state.operatorIndex + 1) % 4]);
+
+    renderer.drawText(UI_12_FONT_ID, cx - 70, cy, prev.c_str());
+    renderer.drawText(UI_12_FONT_ID, cx - 8, cy, current.c_str());
+    renderer.drawText(UI_12_FONT_ID, cx + 54, cy, next.c_str());
+    renderer.drawRect(cx - 20, cy - 6, 40, 34);
+  }
+
+  GUI.drawButtonHints(renderer, state.hints.btn1, state.hints.btn2, state.hints.btn3, state.hints.btn4);
+
+  if (state.mode == Mode::EnterFirst || state.mode == Mode::EnterSecond) {
+    GUI.drawSideButtonHints(renderer, "+", "-");
+  } else if (state.mode == Mode::SelectOperator) {
+    GUI.drawSideButtonHints(renderer, "Prev", "Next");
+  } else {
+    GUI.drawSideButtonHints(renderer, "", "");
+  }
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "MappedInputManager.h"
+
+class GfxRenderer;
+
+// The calculator as CalculatorAppActivity draws it, split out so it can be drawn without the activity (test/render)
+namespace CalculatorView {
+
+enum class Mode {
+  EnterFirst,
+  SelectOperator,
+  EnterSecond,
+  ShowResult,
+};
+
+struct State {
+  const char* title;
+  Mode mode;
+  // The value being entered, one digit per box
+  const int* digits;
+  int digitCount;
+  int digitCursor;
+  // The four operators in the order they cycle through
+  const char* operators;
+  int operatorIndex;
+  long firstValue;
+  long secondValue;
+  long resultValue;
+  bool divideByZero;
+  MappedInputManager::Labels hints;
+};
+
+// Clears the frame buffer and draws the screen into it; the caller displays it
+void render(GfxRenderer& renderer, const State& state);
+
+}  // namespace CalculatorView
@@ -1,5 +1,6 @@
 #include "RandomQuoteAppActivity.h"
 
+#include <BufferedFile.h>
 #include <HalStorage.h>
 #include <Logging.h>
 #include <esp_system.h>
@@ -59,9 +60,11 @@ void RandomQuoteAppActivity::loadQuotesFromEntry(const AppManifest::Entry& entry
     return;
   }
 
+  BufferedReader reader(file);
   std::string line;
-  while (file.available()) {
-    const char ch = static_cast<char>(file.read());
+  int c;
+  while ((c = reader.read()) >= 0) {
+    const char ch = static_cast<char>(c);
     if (ch == '\r') {
       continue;
     }
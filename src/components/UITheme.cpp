@@ -3,6 +3,7 @@
 #include <GfxRenderer.h>
 #include <Logging.h>
 
+#include <algorithm>
 #include <memory>
 
 #include "MappedInputManager.h"
@@ -31,6 +32,7 @@ void UITheme::reload() {
 void UITheme::setTheme(CrossPointSettings::UI_THEME type) {
   switch (type) {
     case CrossPointSettings::UI_THEME::CLASSIC:
+    default:  // Out of range values get the classic theme rather than none
       LOG_DBG("UI", "Using Classic theme");
       currentTheme = std::make_unique<BaseTheme>();
       currentMetrics = &BaseMetrics::values;
@@ -79,6 +81,17 @@ std::string UITheme::getCoverThumbPath(std::string coverBmpPath, int coverHeight
   return coverBmpPath;
 }
 
+std::vector<int> UITheme::getCoverThumbHeights() {
+  std::vector<int> heights;
+  for (const int height : {BaseMetrics::values.homeCoverHeight, LyraMetrics::values.homeCoverHeight,
+                           Lyra3CoversMetrics::values.homeCoverHeight}) {
+    if (std::find(heights.begin(), heights.end(), height) == heights.end()) {
+      heights.push_back(height);
+    }
+  }
+  return heights;
+}
+
 UIIcon UITheme::getFileIcon(std::string filename) {
   if (filename.back() == '/') {
     return Folder;
@@ -2,6 +2,7 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include "CrossPointSettings.h"
 #include "components/themes/BaseTheme.h"
@@ -21,6 +22,8 @@ class UITheme {
   static int getNumberOfItemsPerPage(const GfxRenderer& renderer, bool hasHeader, bool hasTabBar, bool hasButtonHints,
                                      bool hasSubtitle);
   static std::string getCoverThumbPath(std::string coverBmpPath, int coverHeight);
+  // Cover thumbnail heights used by any theme, so thumbnails can be made ahead of a theme switch
+  static std::vector<int> getCoverThumbHeights();
   static UIIcon getFileIcon(std::string filename);
   static int getStatusBarHeight();
   static int getProgressBarHeight();
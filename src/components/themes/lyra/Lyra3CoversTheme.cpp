@@ -60,6 +60,9 @@ void Lyra3CoversTheme::drawRecentBookCover(GfxRenderer& renderer, Rect rect, con
               hasCover = false;
             }
             file.close();
+          } else {
+            // Not generated yet (the thumbnail queue repaints once it is)
+            hasCover = false;
           }
         }
         // Draw either way
@@ -6,6 +6,7 @@
 #include <HalGPIO.h>
 #include <HalPowerManager.h>
 #include <HalStorage.h>
+#include <HeapTags.h>
 #include <I18n.h>
 #include <Logging.h>
 #include <SPI.h>
@@ -13,17 +14,21 @@
 
 #include <cstring>
 
+#include "BootSnapshot.h"
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
-#include "KOReaderCredentialStore.h"
 #include "MappedInputManager.h"
 #include "RecentBooksStore.h"
+#include "ThumbnailQueue.h"
 #include "activities/Activity.h"
 #include "activities/ActivityManager.h"
 #include "components/UITheme.h"
 #include "fontIds.h"
+#include "util/BootTimeline.h"
 #include "util/ButtonNavigator.h"
 #include "util/ScreenshotUtil.h"
+#include "util/SpeculationStats.h"
+#include "util/WakeFrame.h"
 
 HalDisplay display;
 HalGPIO gpio;
@@ -31,6 +36,12 @@ MappedInputManager mappedInputManager(gpio);
 GfxRenderer renderer(display);
 ActivityManager activityManager(renderer, mappedInputManager);
 FontDecompressor fontDecompressor;
+#if LOG_TO_SD
+constexpr char LOG_FILE[] = "/.crosspoint/log.bin";
+constexpr char LOG_FILE_OLD[] = "/.crosspoint/log.old.bin";
+constexpr size_t LOG_FILE_MAX_SIZE = 1024 * 1024;
+HalFile logFile;
+#endif
 
 // Fonts
 EpdFont bookerly14RegularFont(&bookerly_14_regular);
@@ -89,6 +100,40 @@ EpdFontFamily opendyslexic14FontFamily(&opendyslexic14RegularFont, &opendyslexic
 EpdFont smallFont(&notosans_8_regular);
 EpdFontFamily smallFontFamily(&smallFont);
 
+// Reader fonts are resolved when first used rather than inserted at boot
+const EpdFontFamily* resolveReaderFont(const int fontId) {
+  switch (fontId) {
+    case BOOKERLY_14_FONT_ID:
+      return &bookerly14FontFamily;
+#ifndef OMIT_FONTS
+    case BOOKERLY_12_FONT_ID:
+      return &bookerly12FontFamily;
+    case BOOKERLY_16_FONT_ID:
+      return &bookerly16FontFamily;
+    case BOOKERLY_18_FONT_ID:
+      return &bookerly18FontFamily;
+    case NOTOSANS_12_FONT_ID:
+      return &notosans12FontFamily;
+    case NOTOSANS_14_FONT_ID:
+      return &notosans14FontFamily;
+    case NOTOSANS_16_FONT_ID:
+      return &notosans16FontFamily;
+    case NOTOSANS_18_FONT_ID:
+      return &notosans18FontFamily;
+    case OPENDYSLEXIC_8_FONT_ID:
+      return &opendyslexic8FontFamily;
+    case OPENDYSLEXIC_10_FONT_ID:
+      return &opendyslexic10FontFamily;
+    case OPENDYSLEXIC_12_FONT_ID:
+      return &opendyslexic12FontFamily;
+    case OPENDYSLEXIC_14_FONT_ID:
+      return &opendyslexic14FontFamily;
+#endif  // OMIT_FONTS
+    default:
+      return nullptr;
+  }
+}
+
 EpdFont ui10RegularFont(&ubuntu_10_regular);
 EpdFont ui10BoldFont(&ubuntu_10_bold);
 EpdFontFamily ui10FontFamily(&ui10RegularFont, &ui10BoldFont);
@@ -158,6 +203,11 @@ void enterDeepSleep() {
   HalPowerManager::Lock powerLock;  // Ensure we are at normal CPU frequency for sleep preparation
   APP_STATE.lastSleepFromReader = activityManager.isReaderActivity();
   APP_STATE.saveToFile();
+  if (APP_STATE.lastSleepFromReader) {
+    // Wait out a render in progress (e.g. pre-rendering the next page); WakeFrame then saves the page on screen
+    RenderLock lock;
+    WakeFrame::save(renderer, APP_STATE.openEpubPath);
+  }
 
   activityManager.goToSleep();
 
@@ -179,21 +229,7 @@ void setupDisplayAndFonts() {
     LOG_ERR("MAIN", "Font decompressor init failed");
   }
   renderer.setFontDecompressor(&fontDecompressor);
-  renderer.insertFont(BOOKERLY_14_FONT_ID, bookerly14FontFamily);
-#ifndef OMIT_FONTS
-  renderer.insertFont(BOOKERLY_12_FONT_ID, bookerly12FontFamily);
-  renderer.insertFont(BOOKERLY_16_FONT_ID, bookerly16FontFamily);
-  renderer.insertFont(BOOKERLY_18_FONT_ID, bookerly18FontFamily);
-
-  renderer.insertFont(NOTOSANS_12_FONT_ID, notosans12FontFamily);
-  renderer.insertFont(NOTOSANS_14_FONT_ID, notosans14FontFamily);
-  renderer.insertFont(NOTOSANS_16_FONT_ID, notosans16FontFamily);
-  renderer.insertFont(NOTOSANS_18_FONT_ID, notosans18FontFamily);
-  renderer.insertFont(OPENDYSLEXIC_8_FONT_ID, opendyslexic8FontFamily);
-  renderer.insertFont(OPENDYSLEXIC_10_FONT_ID, opendyslexic10FontFamily);
-  renderer.insertFont(OPENDYSLEXIC_12_FONT_ID, opendyslexic12FontFamily);
-  renderer.insertFont(OPENDYSLEXIC_14_FONT_ID, opendyslexic14FontFamily);
-#endif  // OMIT_FONTS
+  renderer.setFontResolver(resolveReaderFont);
   renderer.insertFont(UI_10_FONT_ID, ui10FontFamily);
   renderer.insertFont(UI_12_FONT_ID, ui12FontFamily);
   renderer.insertFont(SMALL_FONT_ID, smallFontFamily);
@@ -215,6 +251,7 @@ void setup() {
       delay(10);
     }
   }
+  logBegin();
 
   // SD Card Initialization
   // We need 6 open files concurrently when parsing a new chapter
@@ -224,10 +261,32 @@ void setup() {
     activityManager.goToFullScreenMessage("SD card error", EpdFontFamily::BOLD);
     return;
   }
+  BootTimeline::mark("storage");
+
+#if LOG_TO_SD
+  // Binary log for decoding with scripts/decode_binary_log.py; the previous one is kept when rotating
+  Storage.mkdir("/.crosspoint");
+  if (Storage.exists(LOG_FILE)) {
+    if (HalFile existing = Storage.open(LOG_FILE); existing && existing.fileSize() > LOG_FILE_MAX_SIZE) {
+      existing.close();
+      Storage.remove(LOG_FILE_OLD);
+      Storage.rename(LOG_FILE, LOG_FILE_OLD);
+    }
+  }
+  logFile = Storage.open(LOG_FILE, O_WRONLY | O_CREAT | O_APPEND);
+  if (logFile) {
+    logSetBinarySink(&logFile);
+  }
+#endif
 
-  SETTINGS.loadFromFile();
+  // Settings, state and recent books from the binary snapshot where their JSON is unchanged. The credential store
+  // loads itself on first use; the language is read here, before anything draws, as every screen looks it up.
+  const uint8_t restored = BootSnapshot::load();
+  if (!(restored & BootSnapshot::PART_SETTINGS)) {
+    SETTINGS.loadFromFile();
+  }
   I18N.loadSettings();
-  KOREADER_STORE.loadFromFile();
+  BootTimeline::mark("settings");
   UITheme::getInstance().reload();
   ButtonNavigator::setMappedInputManager(mappedInputManager);
 
@@ -249,20 +308,41 @@ void setup() {
       break;
   }
 
+  BootTimeline::mark("power button");
+
   // First serial output only here to avoid timing inconsistencies for power button press duration verification
   LOG_DBG("MAIN", "Starting CrossPoint version " CROSSPOINT_VERSION);
 
   setupDisplayAndFonts();
+  BootTimeline::mark("display");
 
-  activityManager.goToBoot();
-
-  APP_STATE.loadFromFile();
-  RECENT_BOOKS.loadFromFile();
+  if (!(restored & BootSnapshot::PART_STATE)) {
+    APP_STATE.loadFromFile();
+  }
+  BootTimeline::mark("state");
 
   // Boot to home screen if no book is open, last sleep was not from reader, back button is held, or reader activity
   // crashed (indicated by readerActivityLoadCount > 0)
-  if (APP_STATE.openEpubPath.empty() || !APP_STATE.lastSleepFromReader ||
-      mappedInputManager.isPressed(MappedInputManager::Button::Back) || APP_STATE.readerActivityLoadCount > 0) {
+  const bool resumeReader = !APP_STATE.openEpubPath.empty() && APP_STATE.lastSleepFromReader &&
+                            !mappedInputManager.isPressed(MappedInputManager::Button::Back) &&
+                            APP_STATE.readerActivityLoadCount == 0;
+
+  // When resuming, the page the reader slept on stands in for the boot screen until the reader has loaded
+  if (resumeReader && WakeFrame::show(renderer, APP_STATE.openEpubPath)) {
+    BootTimeline::mark("wake frame");
+  } else {
+    activityManager.goToBoot();
+    BootTimeline::mark("boot screen");
+  }
+
+  if (!(restored & BootSnapshot::PART_RECENT_BOOKS)) {
+    RECENT_BOOKS.loadFromFile();
+  }
+  BootSnapshot::bootComplete(restored);
+  BootTimeline::mark("recent books");
+  THUMBNAILS.begin(gpio, renderer);
+
+  if (!resumeReader) {
     if (SETTINGS.uiTheme == CrossPointSettings::UI_THEME::FILE_BROWSER) {
       activityManager.goToMyLibrary();
     } else {
@@ -276,6 +356,8 @@ void setup() {
     APP_STATE.saveToFile();
     activityManager.goToReader(path);
   }
+  BootTimeline::mark("first activity");
+  BootTimeline::logSummary();
 
   // Ensure we're not still holding the power button before leaving setup
   waitForPowerRelease();
@@ -290,9 +372,13 @@ void loop() {
 
   renderer.setFadingFix(SETTINGS.fadingFix);
 
-  if (Serial && millis() - lastMemPrint >= 10000) {
-    LOG_INF("MEM", "Free: %d bytes, Total: %d bytes, Min Free: %d bytes, MaxAlloc: %d bytes", ESP.getFreeHeap(),
-            ESP.getHeapSize(), ESP.getMinFreeHeap(), ESP.getMaxAllocHeap());
+  if (millis() - lastMemPrint >= 10000) {
+    // Fragmentation history for /api/status, kept whether or not anyone is watching the log
+    HeapTags::sample(millis());
+    if (Serial) {
+      LOG_INF("MEM", "Free: %d bytes, Total: %d bytes, Min Free: %d bytes, MaxAlloc: %d bytes", ESP.getFreeHeap(),
+              ESP.getHeapSize(), ESP.getMinFreeHeap(), ESP.getMaxAllocHeap());
+    }
     lastMemPrint = millis();
   }
 
@@ -308,6 +394,11 @@ void loop() {
         uint8_t* buf = display.getFrameBuffer();
         logSerial.write(buf, HalDisplay::BUFFER_SIZE);
         logSerial.printf("SCREENSHOT_END\n");
+      } else if (cmd == "HEAP") {
+        HeapTags::logSummary();
+        SpeculationStats::logSummary();
+      } else if (cmd == "BOOT") {
+        BootTimeline::logSummary();
       }
     }
   }
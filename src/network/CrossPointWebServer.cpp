@@ -1,9 +1,10 @@
 #include "CrossPointWebServer.h"
 
 #include <ArduinoJson.h>
-#include <Epub.h>
+#include <BookCacheId.h>
 #include <FsHelpers.h>
 #include <HalStorage.h>
+#include <HeapTags.h>
 #include <Logging.h>
 #include <WiFi.h>
 #include <esp_task_wdt.h>
@@ -11,11 +12,17 @@
 #include <algorithm>
 
 #include "CrossPointSettings.h"
+#include "HttpFileResponse.h"
+#include "LibraryCatalog.h"
+#include "ListingCache.h"
 #include "SettingsList.h"
+#include "ThumbnailQueue.h"
 #include "WebDAVHandler.h"
 #include "html/FilesPageHtml.generated.h"
 #include "html/HomePageHtml.generated.h"
 #include "html/SettingsPageHtml.generated.h"
+#include "util/BootTimeline.h"
+#include "util/SpeculationStats.h"
 #include "util/StringUtils.h"
 
 namespace {
@@ -37,17 +44,21 @@ size_t wsUploadSize = 0;
 size_t wsUploadReceived = 0;
 unsigned long wsUploadStartTime = 0;
 bool wsUploadInProgress = false;
+UploadWriter wsUploadWriter;
+uint8_t wsUploadClient = 0;
+size_t wsLastProgressSent = 0;
+// PROGRESS acks go out every this many bytes committed to the SD card
+constexpr size_t WS_PROGRESS_STEP = 65536;
 String wsLastCompleteName;
 size_t wsLastCompleteSize = 0;
 unsigned long wsLastCompleteAt = 0;
 
-// Helper function to clear epub cache after upload
-void clearEpubCacheIfNeeded(const String& filePath) {
-  // Only clear cache for .epub files
-  if (StringUtils::checkFileExtension(filePath, ".epub")) {
-    Epub(filePath.c_str(), "/.crosspoint").clearCache();
-    LOG_DBG("WEB", "Cleared epub cache for: %s", filePath.c_str());
-  }
+// Book caches are keyed on content (see BookCacheId), so deletes and overwrites release the old content's cache and
+// renames/moves just carry the path's cache id along
+void releaseBookCache(const String& filePath) { BookCacheId::onRemoved(filePath.c_str(), "/.crosspoint"); }
+
+void moveBookCache(const String& fromPath, const String& toPath) {
+  BookCacheId::onMoved(fromPath.c_str(), toPath.c_str());
 }
 
 String normalizeWebPath(const String& inputPath) {
@@ -136,6 +147,7 @@ void CrossPointWebServer::begin() {
   server->on("/api/status", HTTP_GET, [this] { handleStatus(); });
   server->on("/api/files", HTTP_GET, [this] { handleFileListData(); });
   server->on("/download", HTTP_GET, [this] { handleDownload(); });
+  server->on("/download", HTTP_HEAD, [this] { handleDownload(); });
 
   // Upload endpoint with special handling for multipart form data
   server->on("/upload", HTTP_POST, [this] { handleUploadPost(upload); }, [this] { handleUpload(upload); });
@@ -160,9 +172,10 @@ void CrossPointWebServer::begin() {
   server->onNotFound([this] { handleNotFound(); });
   LOG_DBG("WEB", "[MEM] Free heap after route setup: %d bytes", ESP.getFreeHeap());
 
-  // Collect WebDAV headers and register handler
-  const char* davHeaders[] = {"Depth", "Destination", "Overwrite", "If", "Lock-Token", "Timeout"};
-  server->collectHeaders(davHeaders, 6);
+  // Collect WebDAV and ranged/conditional download headers and register handler
+  const char* davHeaders[] = {"Depth",   "Destination", "Overwrite",     "If",      "Lock-Token",
+                              "Timeout", "Range",       "If-None-Match", "If-Range"};
+  server->collectHeaders(davHeaders, 9);
   server->addHandler(new WebDAVHandler());  // Note: WebDAVHandler will be deleted by WebServer when server is stopped
   LOG_DBG("WEB", "WebDAV handler initialized");
 
@@ -176,6 +189,9 @@ void CrossPointWebServer::begin() {
   wsServer->onEvent(wsEventCallback);
   LOG_DBG("WEB", "WebSocket server started");
 
+  // The card may have changed since the server last ran
+  ListingCache::clear();
+
   udpActive = udp.begin(LOCAL_UDP_PORT);
   LOG_DBG("WEB", "Discovery UDP %s on port %d", udpActive ? "enabled" : "failed", LOCAL_UDP_PORT);
 
@@ -202,6 +218,7 @@ void CrossPointWebServer::stop() {
 
   // Close any in-progress WebSocket upload
   if (wsUploadInProgress && wsUploadFile) {
+    wsUploadWriter.abort();
     wsUploadFile.close();
     wsUploadInProgress = false;
   }
@@ -258,11 +275,15 @@ void CrossPointWebServer::handleClient() {
     lastDebugPrint = millis();
   }
 
+  // Upload and download buffers allocated by the handlers count against the web server
+  HeapTagScope heapScope(HeapTag::WebServer);
   server->handleClient();
 
   // Handle WebSocket events
   if (wsServer) {
     wsServer->loop();
+    // The writer may have committed more while the client waits for an ack
+    sendWsUploadProgress();
   }
 
   // Respond to discovery broadcasts
@@ -328,69 +349,65 @@ void CrossPointWebServer::handleStatus() const {
   doc["freeHeap"] = ESP.getFreeHeap();
   doc["uptime"] = millis() / 1000;
 
+  // Who holds the heap, and how fragmented it has been lately
+  JsonObject heapObj = doc["heap"].to<JsonObject>();
+  heapObj["free"] = HeapTags::freeBytes();
+  heapObj["largestFreeBlock"] = HeapTags::largestFreeBlock();
+  heapObj["minFree"] = ESP.getMinFreeHeap();
+  JsonObject tagsObj = heapObj["tags"].to<JsonObject>();
+  for (uint8_t i = 0; i < static_cast<uint8_t>(HeapTag::Count); i++) {
+    const auto tag = static_cast<HeapTag>(i);
+    const HeapTags::TagStats stats = HeapTags::stats(tag);
+    JsonObject tagObj = tagsObj[HeapTags::name(tag)].to<JsonObject>();
+    tagObj["live"] = stats.liveBytes;
+    tagObj["peak"] = stats.peakBytes;
+    tagObj["allocations"] = stats.allocations;
+    tagObj["failures"] = stats.failures;
+  }
+  HeapTags::Sample samples[HeapTags::HISTORY_SIZE];
+  const size_t sampleCount = HeapTags::history(samples, HeapTags::HISTORY_SIZE);
+  JsonArray historyArr = heapObj["history"].to<JsonArray>();
+  for (size_t i = 0; i < sampleCount; i++) {
+    JsonObject sampleObj = historyArr.add<JsonObject>();
+    sampleObj["uptimeMs"] = samples[i].atMs;
+    sampleObj["free"] = samples[i].freeBytes;
+    sampleObj["largestFreeBlock"] = samples[i].largestFreeBlock;
+  }
+  HeapTags::Failure failure;
+  if (HeapTags::lastFailure(failure)) {
+    JsonObject failureObj = heapObj["lastFailure"].to<JsonObject>();
+    failureObj["uptimeMs"] = failure.atMs;
+    failureObj["tag"] = HeapTags::name(failure.tag);
+    failureObj["requested"] = failure.requested;
+    failureObj["free"] = failure.freeBytes;
+    failureObj["largestFreeBlock"] = failure.largestFreeBlock;
+  }
+
+  // When each boot phase ended
+  JsonArray bootArr = doc["boot"].to<JsonArray>();
+  for (size_t i = 0; i < BootTimeline::count(); i++) {
+    JsonObject phaseObj = bootArr.add<JsonObject>();
+    phaseObj["phase"] = BootTimeline::at(i).name;
+    phaseObj["atMs"] = BootTimeline::at(i).atMs;
+  }
+
+  // How often the reader's pre-rendered next page was the one turned to
+  JsonObject speculationObj = doc["speculation"].to<JsonObject>();
+  speculationObj["hits"] = SpeculationStats::hits();
+  speculationObj["misses"] = SpeculationStats::misses();
+
+  // Books that arrived over a transfer and are being prepared for their first open
+  const auto indexing = THUMBNAILS.getIndexStatus();
+  JsonObject indexingObj = doc["indexing"].to<JsonObject>();
+  indexingObj["pending"] = indexing.pending;
+  indexingObj["completed"] = indexing.completed;
+  indexingObj["current"] = indexing.current.c_str();
+
   String json;
   serializeJson(doc, json);
   server->send(200, "application/json", json);
 }
 
-void CrossPointWebServer::scanFiles(const char* path, const std::function<void(FileInfo)>& callback) const {
-  FsFile root = Storage.open(path);
-  if (!root) {
-    LOG_DBG("WEB", "Failed to open directory: %s", path);
-    return;
-  }
-
-  if (!root.isDirectory()) {
-    LOG_DBG("WEB", "Not a directory: %s", path);
-    root.close();
-    return;
-  }
-
-  LOG_DBG("WEB", "Scanning files in: %s", path);
-
-  FsFile file = root.openNextFile();
-  char name[500];
-  while (file) {
-    file.getName(name, sizeof(name));
-    auto fileName = String(name);
-
-    // Skip hidden items (starting with ".")
-    bool shouldHide = fileName.startsWith(".");
-
-    // Check against explicitly hidden items list
-    if (!shouldHide) {
-      for (size_t i = 0; i < HIDDEN_ITEMS_COUNT; i++) {
-        if (fileName.equals(HIDDEN_ITEMS[i])) {
-          shouldHide = true;
-          break;
-        }
-      }
-    }
-
-    if (!shouldHide) {
-      FileInfo info;
-      info.name = fileName;
-      info.isDirectory = file.isDirectory();
-
-      if (info.isDirectory) {
-        info.size = 0;
-        info.isEpub = false;
-      } else {
-        info.size = file.size();
-        info.isEpub = isEpubFile(info.name);
-      }
-
-      callback(info);
-    }
-
-    file.close();
-    yield();               // Yield to allow WiFi and other tasks to process during long scans
-    esp_task_wdt_reset();  // Reset watchdog to prevent timeout on large directories
-    file = root.openNextFile();
-  }
-  root.close();
-}
-
 bool CrossPointWebServer::isEpubFile(const String& filename) const {
   String lower = filename;
   lower.toLowerCase();
@@ -416,36 +433,72 @@ void CrossPointWebServer::handleFileListData() const {
     }
   }
 
-  server->setContentLength(CONTENT_LENGTH_UNKNOWN);
-  server->send(200, "application/json", "");
-  server->sendContent("[");
+  // Without offset or limit the whole folder is listed, in the order the card has it, as before paging existed
+  const size_t offset = server->hasArg("offset") ? strtoul(server->arg("offset").c_str(), nullptr, 10) : 0;
+  const size_t limit = server->hasArg("limit") ? strtoul(server->arg("limit").c_str(), nullptr, 10) : SIZE_MAX;
+  const String sort = server->arg("sort");
+  const ListingCache::Order order = sort == "name"       ? ListingCache::Order::Name
+                                    : sort == "size"     ? ListingCache::Order::Size
+                                    : sort == "modified" ? ListingCache::Order::Modified
+                                                         : ListingCache::Order::Directory;
+  const bool descending = server->arg("order") == "desc";
+
+  // The total goes in a header. With a snapshot it is known before the body. Without one (e.g. the heap can't spare
+  // the sort) it is only known once the folder has been walked, so a page is held back until the walk ends rather than
+  // walking the folder twice; a listing without a limit is streamed without the header, as before paging existed.
+  const bool snapshotted = ListingCache::prepare(currentPath.c_str());
+  const bool holdPage = !snapshotted && limit != SIZE_MAX;
+  if (snapshotted) {
+    const int32_t count = ListingCache::list(currentPath.c_str(), order, descending, 0, 0,
+                                             [](const ListingCache::Entry&) { return true; });
+    server->sendHeader("X-Total-Count", String(count < 0 ? 0 : count));
+  }
+  if (!holdPage) {
+    server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server->send(200, "application/json", "");
+  }
+
+  // Entries are batched into chunks of about 1KB rather than sent one chunk each
+  std::string chunk = "[";
   char output[512];
   constexpr size_t outputSize = sizeof(output);
   bool seenFirst = false;
   JsonDocument doc;
-
-  scanFiles(currentPath.c_str(), [this, &output, &doc, seenFirst](const FileInfo& info) mutable {
+  const auto appendEntry = [&](const ListingCache::Entry& entry) {
     doc.clear();
-    doc["name"] = info.name;
-    doc["size"] = info.size;
-    doc["isDirectory"] = info.isDirectory;
-    doc["isEpub"] = info.isEpub;
+    doc["name"] = entry.name;
+    doc["size"] = entry.size;
+    doc["isDirectory"] = entry.isDirectory;
+    doc["isEpub"] = !entry.isDirectory && isEpubFile(entry.name.c_str());
 
     const size_t written = serializeJson(doc, output, outputSize);
     if (written >= outputSize) {
       // JSON output truncated; skip this entry to avoid sending malformed JSON
-      LOG_DBG("WEB", "Skipping file entry with oversized JSON for name: %s", info.name.c_str());
-      return;
+      LOG_DBG("WEB", "Skipping file entry with oversized JSON for name: %s", entry.name.c_str());
+      return true;
     }
 
     if (seenFirst) {
-      server->sendContent(",");
+      chunk += ',';
     } else {
       seenFirst = true;
     }
-    server->sendContent(output);
-  });
-  server->sendContent("]");
+    chunk.append(output, written);
+    if (!holdPage && chunk.size() >= 1024) {
+      server->sendContent(chunk.c_str(), chunk.size());
+      chunk.clear();
+      esp_task_wdt_reset();
+    }
+    return true;
+  };
+  const int32_t total = ListingCache::list(currentPath.c_str(), order, descending, offset, limit, appendEntry);
+  if (holdPage) {
+    server->sendHeader("X-Total-Count", String(total < 0 ? 0 : total));
+    server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server->send(200, "application/json", "");
+  }
+  chunk += ']';
+  server->sendContent(chunk.c_str(), chunk.size());
   // End of streamed response, empty chunk to signal client
   server->sendContent("");
   LOG_DBG("WEB", "Served file listing page for path: %s", currentPath.c_str());
@@ -505,38 +558,13 @@ void CrossPointWebServer::handleDownload() const {
     filename = nameBuf;
   }
 
-  server->setContentLength(file.size());
   server->sendHeader("Content-Disposition", "attachment; filename=\"" + filename + "\"");
-  server->send(200, contentType.c_str(), "");
-
-  NetworkClient client = server->client();
-  client.write(file);
+  HttpFileResponse::send(*server, file, contentType.c_str());
   file.close();
 }
 
 // Diagnostic counters for upload performance analysis
 static unsigned long uploadStartTime = 0;
-static unsigned long totalWriteTime = 0;
-static size_t writeCount = 0;
-
-static bool flushUploadBuffer(CrossPointWebServer::UploadState& state) {
-  if (state.bufferPos > 0 && state.file) {
-    esp_task_wdt_reset();  // Reset watchdog before potentially slow SD write
-    const unsigned long writeStart = millis();
-    const size_t written = state.file.write(state.buffer.data(), state.bufferPos);
-    totalWriteTime += millis() - writeStart;
-    writeCount++;
-    esp_task_wdt_reset();  // Reset watchdog after SD write
-
-    if (written != state.bufferPos) {
-      LOG_DBG("WEB", "[UPLOAD] Buffer flush failed: expected %d, wrote %d", state.bufferPos, written);
-      state.bufferPos = 0;
-      return false;
-    }
-    state.bufferPos = 0;
-  }
-  return true;
-}
 
 void CrossPointWebServer::handleUpload(UploadState& state) const {
   static size_t lastLoggedSize = 0;
@@ -562,9 +590,6 @@ void CrossPointWebServer::handleUpload(UploadState& state) const {
     state.error = "";
     uploadStartTime = millis();
     lastLoggedSize = 0;
-    state.bufferPos = 0;
-    totalWriteTime = 0;
-    writeCount = 0;
 
     // Get upload path from query parameter (defaults to root if not specified)
     // Note: We use query parameter instead of form data because multipart form
@@ -607,32 +632,18 @@ void CrossPointWebServer::handleUpload(UploadState& state) const {
       return;
     }
     esp_task_wdt_reset();
+    state.writer.begin(state.file);
+    ListingCache::invalidate(state.path.c_str());
 
     LOG_DBG("WEB", "[UPLOAD] File created successfully: %s", filePath.c_str());
   } else if (upload.status == UPLOAD_FILE_WRITE) {
     if (state.file && state.error.isEmpty()) {
-      // Buffer incoming data and flush when buffer is full
-      // This reduces SD card write operations and improves throughput
-      const uint8_t* data = upload.buf;
-      size_t remaining = upload.currentSize;
-
-      while (remaining > 0) {
-        const size_t space = UploadState::UPLOAD_BUFFER_SIZE - state.bufferPos;
-        const size_t toCopy = (remaining < space) ? remaining : space;
-
-        memcpy(state.buffer.data() + state.bufferPos, data, toCopy);
-        state.bufferPos += toCopy;
-        data += toCopy;
-        remaining -= toCopy;
-
-        // Flush buffer when full
-        if (state.bufferPos >= UploadState::UPLOAD_BUFFER_SIZE) {
-          if (!flushUploadBuffer(state)) {
-            state.error = "Failed to write to SD card - disk may be full";
-            state.file.close();
-            return;
-          }
-        }
+      // Hand the data to the write-behind buffers; this only blocks while the SD card is behind
+      if (!state.writer.write(upload.buf, upload.currentSize)) {
+        state.error = "Failed to write to SD card - disk may be full";
+        state.writer.abort();
+        state.file.close();
+        return;
       }
 
       state.size += upload.currentSize;
@@ -641,15 +652,17 @@ void CrossPointWebServer::handleUpload(UploadState& state) const {
       if (state.size - lastLoggedSize >= 102400) {
         const unsigned long elapsed = millis() - uploadStartTime;
         const float kbps = (elapsed > 0) ? (state.size / 1024.0) / (elapsed / 1000.0) : 0;
-        LOG_DBG("WEB", "[UPLOAD] %d bytes (%.1f KB), %.1f KB/s, %d writes", state.size, state.size / 1024.0, kbps,
-                writeCount);
+        LOG_DBG("WEB", "[UPLOAD] %d bytes (%.1f KB), %.1f KB/s, %d committed", state.size, state.size / 1024.0, kbps,
+                state.writer.getCommitted());
         lastLoggedSize = state.size;
       }
     }
   } else if (upload.status == UPLOAD_FILE_END) {
     if (state.file) {
-      // Flush any remaining buffered data
-      if (!flushUploadBuffer(state)) {
+      // Wait for the write-behind buffers to drain
+      const unsigned long writeTime = state.writer.getWriteTimeMs();
+      const unsigned long stallTime = state.writer.getStallTimeMs();
+      if (!state.writer.finish()) {
         state.error = "Failed to write final data to SD card";
       }
       state.file.close();
@@ -658,21 +671,25 @@ void CrossPointWebServer::handleUpload(UploadState& state) const {
         state.success = true;
         const unsigned long elapsed = millis() - uploadStartTime;
         const float avgKbps = (elapsed > 0) ? (state.size / 1024.0) / (elapsed / 1000.0) : 0;
-        const float writePercent = (elapsed > 0) ? (totalWriteTime * 100.0 / elapsed) : 0;
+        const float writePercent = (elapsed > 0) ? (writeTime * 100.0 / elapsed) : 0;
         LOG_DBG("WEB", "[UPLOAD] Complete: %s (%d bytes in %lu ms, avg %.1f KB/s)", state.fileName.c_str(), state.size,
                 elapsed, avgKbps);
-        LOG_DBG("WEB", "[UPLOAD] Diagnostics: %d writes, total write time: %lu ms (%.1f%%)", writeCount, totalWriteTime,
-                writePercent);
+        LOG_DBG("WEB", "[UPLOAD] Diagnostics: write time %lu ms (%.1f%%), waited for SD %lu ms", writeTime,
+                writePercent, stallTime);
 
-        // Clear epub cache to prevent stale metadata issues when overwriting files
+        // Release the cache of whatever was at this path before, so overwritten books don't show stale metadata
         String filePath = state.path;
         if (!filePath.endsWith("/")) filePath += "/";
         filePath += state.fileName;
-        clearEpubCacheIfNeeded(filePath);
+        releaseBookCache(filePath);
+        LIBRARY_CATALOG.onFileWritten(filePath.c_str());
+        THUMBNAILS.index(filePath.c_str());
       }
+      // The file's size changed since it was created
+      ListingCache::invalidate(state.path.c_str());
     }
   } else if (upload.status == UPLOAD_FILE_ABORTED) {
-    state.bufferPos = 0;  // Discard buffered data
+    state.writer.abort();  // Discard buffered data
     if (state.file) {
       state.file.close();
       // Try to delete the incomplete file
@@ -680,6 +697,7 @@ void CrossPointWebServer::handleUpload(UploadState& state) const {
       if (!filePath.endsWith("/")) filePath += "/";
       filePath += state.fileName;
       Storage.remove(filePath.c_str());
+      ListingCache::invalidate(state.path.c_str());
     }
     state.error = "Upload aborted";
     LOG_DBG("WEB", "Upload aborted");
@@ -737,6 +755,7 @@ void CrossPointWebServer::handleCreateFolder() const {
 
   // Create the folder
   if (Storage.mkdir(folderPath.c_str())) {
+    ListingCache::invalidate(parentPath.c_str());
     LOG_DBG("WEB", "Folder created successfully: %s", folderPath.c_str());
     server->send(200, "text/plain", "Folder created: " + folderName);
   } else {
@@ -814,11 +833,13 @@ void CrossPointWebServer::handleRename() const {
     return;
   }
 
-  clearEpubCacheIfNeeded(itemPath);
   const bool success = file.rename(newPath.c_str());
   file.close();
 
   if (success) {
+    moveBookCache(itemPath, newPath);
+    LIBRARY_CATALOG.onMoved(itemPath.c_str(), newPath.c_str());
+    ListingCache::invalidate(parentPath.c_str());
     LOG_DBG("WEB", "Renamed file: %s -> %s", itemPath.c_str(), newPath.c_str());
     server->send(200, "text/plain", "Renamed successfully");
   } else {
@@ -907,11 +928,14 @@ void CrossPointWebServer::handleMove() const {
     return;
   }
 
-  clearEpubCacheIfNeeded(itemPath);
   const bool success = file.rename(newPath.c_str());
   file.close();
 
   if (success) {
+    moveBookCache(itemPath, newPath);
+    LIBRARY_CATALOG.onMoved(itemPath.c_str(), newPath.c_str());
+    ListingCache::invalidateParent(itemPath.c_str());
+    ListingCache::invalidate(destPath.c_str());
     LOG_DBG("WEB", "Moved file: %s -> %s", itemPath.c_str(), newPath.c_str());
     server->send(200, "text/plain", "Moved successfully");
   } else {
@@ -1007,14 +1031,23 @@ void CrossPointWebServer::handleDelete() const {
       }
       f.close();
       success = Storage.rmdir(itemPath.c_str());
+      if (success) {
+        LIBRARY_CATALOG.onRemoved(itemPath.c_str());
+        ListingCache::invalidate(itemPath.c_str());
+      }
     } else {
       // It's a file (or couldn't open as dir) — remove file
       if (f) f.close();
       success = Storage.remove(itemPath.c_str());
-      clearEpubCacheIfNeeded(itemPath);
+      if (success) {
+        releaseBookCache(itemPath);
+        LIBRARY_CATALOG.onRemoved(itemPath.c_str());
+      }
     }
 
-    if (!success) {
+    if (success) {
+      ListingCache::invalidateParent(itemPath.c_str());
+    } else {
       failedItems += itemPath + " (deletion failed); ";
       allSuccess = false;
     }
@@ -1200,7 +1233,7 @@ void CrossPointWebServer::wsEventCallback(uint8_t num, WStype_t type, uint8_t* p
 // Protocol:
 //   1. Client sends TEXT message: "START:<filename>:<size>:<path>"
 //   2. Client sends BINARY messages with file data chunks
-//   3. Server sends TEXT "PROGRESS:<received>:<total>" after each chunk
+//   3. Server sends TEXT "PROGRESS:<committed>:<total>" as data reaches the SD card (every 64KB)
 //   4. Server sends TEXT "DONE" or "ERROR:<message>" when complete
 void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t length) {
   switch (type) {
@@ -1208,12 +1241,14 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
       LOG_DBG("WS", "Client %u disconnected", num);
       // Clean up any in-progress upload
       if (wsUploadInProgress && wsUploadFile) {
+        wsUploadWriter.abort();
         wsUploadFile.close();
         // Delete incomplete file
         String filePath = wsUploadPath;
         if (!filePath.endsWith("/")) filePath += "/";
         filePath += wsUploadFileName;
         Storage.remove(filePath.c_str());
+        ListingCache::invalidate(wsUploadPath.c_str());
         LOG_DBG("WS", "Deleted incomplete upload: %s", filePath.c_str());
       }
       wsUploadInProgress = false;
@@ -1270,6 +1305,10 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
           }
           esp_task_wdt_reset();
 
+          wsUploadWriter.begin(wsUploadFile);
+          ListingCache::invalidate(wsUploadPath.c_str());
+          wsUploadClient = num;
+          wsLastProgressSent = 0;
           wsUploadInProgress = true;
           wsServer->sendTXT(num, "READY");
         } else {
@@ -1285,32 +1324,34 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
         return;
       }
 
-      // Write binary data directly to file
+      // Queue the data for the SD card; this only blocks while every write-behind buffer is waiting for the card,
+      // and while it does the socket isn't read, so TCP flow control holds the sender back
       esp_task_wdt_reset();
-      size_t written = wsUploadFile.write(payload, length);
+      const bool queued = wsUploadWriter.write(payload, length);
       esp_task_wdt_reset();
 
-      if (written != length) {
+      if (!queued) {
+        wsUploadWriter.abort();
         wsUploadFile.close();
         wsUploadInProgress = false;
         wsServer->sendTXT(num, "ERROR:Write failed - disk full?");
         return;
       }
 
-      wsUploadReceived += written;
-
-      // Send progress update (every 64KB or at end)
-      static size_t lastProgressSent = 0;
-      if (wsUploadReceived - lastProgressSent >= 65536 || wsUploadReceived >= wsUploadSize) {
-        String progress = "PROGRESS:" + String(wsUploadReceived) + ":" + String(wsUploadSize);
-        wsServer->sendTXT(num, progress);
-        lastProgressSent = wsUploadReceived;
-      }
+      wsUploadReceived += length;
+      sendWsUploadProgress();
 
       // Check if upload complete
       if (wsUploadReceived >= wsUploadSize) {
+        const bool written = wsUploadWriter.finish();
         wsUploadFile.close();
         wsUploadInProgress = false;
+        ListingCache::invalidate(wsUploadPath.c_str());
+        if (!written) {
+          wsServer->sendTXT(num, "ERROR:Write failed - disk full?");
+          return;
+        }
+        wsServer->sendTXT(num, "PROGRESS:" + String(wsUploadSize) + ":" + String(wsUploadSize));
 
         wsLastCompleteName = wsUploadFileName;
         wsLastCompleteSize = wsUploadSize;
@@ -1322,14 +1363,15 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
         LOG_DBG("WS", "Upload complete: %s (%d bytes in %lu ms, %.1f KB/s)", wsUploadFileName.c_str(), wsUploadSize,
                 elapsed, kbps);
 
-        // Clear epub cache to prevent stale metadata issues when overwriting files
+        // Release the cache of whatever was at this path before, so overwritten books don't show stale metadata
         String filePath = wsUploadPath;
         if (!filePath.endsWith("/")) filePath += "/";
         filePath += wsUploadFileName;
-        clearEpubCacheIfNeeded(filePath);
+        releaseBookCache(filePath);
+        LIBRARY_CATALOG.onFileWritten(filePath.c_str());
+        THUMBNAILS.index(filePath.c_str());
 
         wsServer->sendTXT(num, "DONE");
-        lastProgressSent = 0;
       }
       break;
     }
@@ -1338,3 +1380,17 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
       break;
   }
 }
+
+// Acknowledges what has reached the SD card, every WS_PROGRESS_STEP bytes. The page keeps a bounded window of data
+// in flight beyond the last ack, so these pace the sender to the card.
+void CrossPointWebServer::sendWsUploadProgress() {
+  if (!wsUploadInProgress || !wsServer) {
+    return;
+  }
+  const size_t committed = wsUploadWriter.getCommitted();
+  if (committed - wsLastProgressSent >= WS_PROGRESS_STEP) {
+    String progress = "PROGRESS:" + String(committed) + ":" + String(wsUploadSize);
+    wsServer->sendTXT(wsUploadClient, progress);
+    wsLastProgressSent = committed;
+  }
+}
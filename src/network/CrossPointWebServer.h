@@ -9,13 +9,7 @@
 #include <string>
 #include <vector>
 
-// Structure to hold file information
-struct FileInfo {
-  String name;
-  size_t size;
-  bool isEpub;
-  bool isDirectory;
-};
+#include "UploadWriter.h"
 
 class CrossPointWebServer {
  public:
@@ -38,14 +32,8 @@ class CrossPointWebServer {
     bool success = false;
     String error = "";
 
-    // Upload write buffer - batches small writes into larger SD card operations
-    // 4KB is a good balance: large enough to reduce syscall overhead, small enough
-    // to keep individual write times short and avoid watchdog issues
-    static constexpr size_t UPLOAD_BUFFER_SIZE = 4096;  // 4KB buffer
-    std::vector<uint8_t> buffer;
-    size_t bufferPos = 0;
-
-    UploadState() { buffer.resize(UPLOAD_BUFFER_SIZE); }
+    // Writes to the SD card behind the network, so receiving the next part overlaps writing this one
+    UploadWriter writer;
   } upload;
 
   CrossPointWebServer();
@@ -81,9 +69,9 @@ class CrossPointWebServer {
   // WebSocket upload state
   void onWebSocketEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t length);
   static void wsEventCallback(uint8_t num, WStype_t type, uint8_t* payload, size_t length);
+  void sendWsUploadProgress();
 
-  // File scanning
-  void scanFiles(const char* path, const std::function<void(FileInfo)>& callback) const;
+  // File listing
   String formatFileSize(size_t bytes) const;
   bool isEpubFile(const String& filename) const;
 
@@ -7,6 +7,8 @@
 #include <StreamString.h>
 #include <base64.h>
 
+#include <cstdint>
+#include <cstdlib>
 #include <cstring>
 #include <memory>
 #include <utility>
@@ -17,13 +19,17 @@
 namespace {
 class FileWriteStream final : public Stream {
  public:
-  FileWriteStream(FsFile& file, size_t total, HttpDownloader::ProgressCallback progress)
-      : file_(file), total_(total), progress_(std::move(progress)) {}
+  FileWriteStream(FsFile& file, size_t downloaded, size_t total, HttpDownloader::ProgressCallback progress, Print* tee)
+      : file_(file), total_(total), downloaded_(downloaded), progress_(std::move(progress)), tee_(tee) {}
 
   size_t write(uint8_t byte) override { return write(&byte, 1); }
 
   size_t write(const uint8_t* buffer, size_t size) override {
     // Write-through stream for HTTPClient::writeToStream with progress tracking.
+    if (tee_ && tee_->write(buffer, size) != size) {
+      rejected_ = true;
+      return 0;
+    }
     const size_t written = file_.write(buffer, size);
     if (written != size) {
       writeOk_ = false;
@@ -42,13 +48,17 @@ class FileWriteStream final : public Stream {
 
   size_t downloaded() const { return downloaded_; }
   bool ok() const { return writeOk_; }
+  // The tee refused the data
+  bool rejected() const { return rejected_; }
 
  private:
   FsFile& file_;
   size_t total_;
-  size_t downloaded_ = 0;
+  size_t downloaded_;
   bool writeOk_ = true;
+  bool rejected_ = false;
   HttpDownloader::ProgressCallback progress_;
+  Print* tee_;
 };
 
 void configureHttpClient(HTTPClient& http, NetworkClient& client, const std::string& url) {
@@ -88,9 +98,51 @@ void maybeAttachOpdsAuthHeader(HTTPClient& http, const std::string& url, bool us
   String encoded = base64::encode(credentials.c_str());
   http.addHeader("Authorization", "Basic " + encoded);
 }
+
+// First byte position of a Content-Range header ("bytes <first>-<last>/<length>"), or SIZE_MAX
+size_t contentRangeStart(const std::string& contentRange) {
+  if (contentRange.rfind("bytes ", 0) != 0) {
+    return SIZE_MAX;
+  }
+  return strtoul(contentRange.c_str() + 6, nullptr, 10);
+}
+
+// Feeds what an earlier attempt left in a part file to `tee`. Returns false if the tee refuses it.
+bool replayPart(const std::string& partPath, Print& tee) {
+  FsFile part;
+  if (!Storage.openFileForRead("HTTP", partPath, part)) {
+    return false;
+  }
+  uint8_t buffer[HttpDownloader::DOWNLOAD_CHUNK_SIZE];
+  int read;
+  while ((read = part.read(buffer, sizeof(buffer))) > 0) {
+    if (tee.write(buffer, read) != static_cast<size_t>(read)) {
+      return false;
+    }
+  }
+  return read == 0;
+}
+
+void removePart(const std::string& partPath, const std::string& validatorPath) {
+  Storage.remove(partPath.c_str());
+  Storage.remove(validatorPath.c_str());
+}
 }  // namespace
 
+void HttpDownloader::discardPart(const std::string& destPath) {
+  const std::string partPath = destPath + ".part";
+  removePart(partPath, partPath + ".validator");
+}
+
 bool HttpDownloader::fetchUrl(const std::string& url, Stream& outContent, bool useAuth) {
+  std::string etag;
+  std::string lastModified;
+  return fetchUrlIfChanged(url, outContent, etag, lastModified, useAuth) == FetchResult::FETCHED;
+}
+
+HttpDownloader::FetchResult HttpDownloader::fetchUrlIfChanged(const std::string& url, Stream& outContent,
+                                                              std::string& etag, std::string& lastModified,
+                                                              bool useAuth) {
   // Use NetworkClientSecure for HTTPS, regular NetworkClient for HTTP
   std::unique_ptr<NetworkClient> client;
   if (UrlUtils::isHttpsUrl(url)) {
@@ -106,20 +158,40 @@ bool HttpDownloader::fetchUrl(const std::string& url, Stream& outContent, bool u
 
   configureHttpClient(http, *client, url);
   maybeAttachOpdsAuthHeader(http, url, useAuth);
+  if (!etag.empty()) {
+    http.addHeader("If-None-Match", etag.c_str());
+  }
+  if (!lastModified.empty()) {
+    http.addHeader("If-Modified-Since", lastModified.c_str());
+  }
+  const char* validatorHeaders[] = {"ETag", "Last-Modified"};
+  http.collectHeaders(validatorHeaders, 2);
 
   const int httpCode = http.GET();
+  if (httpCode == HTTP_CODE_NOT_MODIFIED && (!etag.empty() || !lastModified.empty())) {
+    LOG_DBG("HTTP", "Not modified");
+    http.end();
+    return FetchResult::NOT_MODIFIED;
+  }
   if (httpCode != HTTP_CODE_OK) {
     LOG_ERR("HTTP", "Fetch failed: %d", httpCode);
     http.end();
-    return false;
+    return FetchResult::FAILED;
   }
+  etag = http.header("ETag").c_str();
+  lastModified = http.header("Last-Modified").c_str();
 
-  http.writeToStream(&outContent);
+  const int writeResult = http.writeToStream(&outContent);
 
   http.end();
 
+  if (writeResult < 0) {
+    LOG_ERR("HTTP", "writeToStream error: %d", writeResult);
+    return FetchResult::FAILED;
+  }
+
   LOG_DBG("HTTP", "Fetch success");
-  return true;
+  return FetchResult::FETCHED;
 }
 
 bool HttpDownloader::fetchUrl(const std::string& url, std::string& outContent, bool useAuth) {
@@ -132,7 +204,7 @@ bool HttpDownloader::fetchUrl(const std::string& url, std::string& outContent, b
 }
 
 HttpDownloader::DownloadError HttpDownloader::downloadToFile(const std::string& url, const std::string& destPath,
-                                                             ProgressCallback progress, bool useAuth) {
+                                                             ProgressCallback progress, bool useAuth, Print* tee) {
   // Use NetworkClientSecure for HTTPS, regular NetworkClient for HTTP
   std::unique_ptr<NetworkClient> client;
   if (UrlUtils::isHttpsUrl(url)) {
@@ -147,13 +219,45 @@ HttpDownloader::DownloadError HttpDownloader::downloadToFile(const std::string&
   LOG_DBG("HTTP", "Downloading: %s", url.c_str());
   LOG_DBG("HTTP", "Destination: %s", destPath.c_str());
 
+  // The body goes to a .part file that is renamed to destPath once complete. A part left by a download cut short is
+  // resumed with a Range request if its validator was kept; If-Range makes the server send the whole file instead
+  // when it has changed since.
+  const std::string partPath = destPath + ".part";
+  const std::string validatorPath = partPath + ".validator";
+  std::string validator;
+  size_t resumeFrom = 0;
+  if (Storage.exists(partPath.c_str())) {
+    validator = Storage.readFile(validatorPath.c_str()).c_str();
+    FsFile part = Storage.open(partPath.c_str());
+    resumeFrom = part && !validator.empty() ? part.fileSize() : 0;
+    if (resumeFrom == 0) {
+      // Nothing there can be resumed, whatever this attempt's outcome
+      part.close();
+      removePart(partPath, validatorPath);
+      validator.clear();
+    }
+  }
+
   configureHttpClient(http, *client, url);
   maybeAttachOpdsAuthHeader(http, url, useAuth);
+  if (resumeFrom > 0) {
+    LOG_DBG("HTTP", "Resuming after %zu bytes", resumeFrom);
+    http.addHeader("Range", ("bytes=" + std::to_string(resumeFrom) + "-").c_str());
+    http.addHeader("If-Range", validator.c_str());
+  }
+  const char* responseHeaders[] = {"ETag", "Last-Modified", "Content-Range"};
+  http.collectHeaders(responseHeaders, 3);
 
   const int httpCode = http.GET();
-  if (httpCode != HTTP_CODE_OK) {
+  const bool resuming = resumeFrom > 0 && httpCode == HTTP_CODE_PARTIAL_CONTENT &&
+                        contentRangeStart(http.header("Content-Range").c_str()) == resumeFrom;
+  if (!resuming && httpCode != HTTP_CODE_OK) {
     LOG_ERR("HTTP", "Download failed: %d", httpCode);
     http.end();
+    if (httpCode == HTTP_CODE_PARTIAL_CONTENT || httpCode == HTTP_CODE_RANGE_NOT_SATISFIABLE) {
+      // The part can't be continued; the next attempt starts over
+      removePart(partPath, validatorPath);
+    }
     return HTTP_ERROR;
   }
 
@@ -165,54 +269,78 @@ HttpDownloader::DownloadError HttpDownloader::downloadToFile(const std::string&
     LOG_DBG("HTTP", "Content-Length: unknown");
   }
 
-  // Remove existing file if present
-  if (Storage.exists(destPath.c_str())) {
-    Storage.remove(destPath.c_str());
-  }
-
-  // Open file for writing
   FsFile file;
-  if (!Storage.openFileForWrite("HTTP", destPath.c_str(), file)) {
+  if (resuming) {
+    file = Storage.open(partPath.c_str(), O_WRONLY | O_APPEND);
+    // The scanner has to see the archive from its first byte
+    if (file && tee && !replayPart(partPath, *tee)) {
+      LOG_ERR("HTTP", "Download rejected");
+      file.close();
+      http.end();
+      removePart(partPath, validatorPath);
+      return ABORTED;
+    }
+  } else {
+    resumeFrom = 0;
+    removePart(partPath, validatorPath);
+    // A weak ETag can't be sent in If-Range
+    validator = http.header("ETag").c_str();
+    if (validator.empty() || validator.rfind("W/", 0) == 0) {
+      validator = http.header("Last-Modified").c_str();
+    }
+    if (!validator.empty()) {
+      Storage.writeFile(validatorPath.c_str(), validator.c_str());
+    }
+    Storage.openFileForWrite("HTTP", partPath, file);
+  }
+  if (!file) {
     LOG_ERR("HTTP", "Failed to open file for writing");
     http.end();
+    if (!resuming) {
+      removePart(partPath, validatorPath);
+    }
     return FILE_ERROR;
   }
 
   // Let HTTPClient handle chunked decoding and stream body bytes into the file.
-  FileWriteStream fileStream(file, contentLength, progress);
+  FileWriteStream fileStream(file, resumeFrom, contentLength > 0 ? resumeFrom + contentLength : 0, progress, tee);
   const int writeResult = http.writeToStream(&fileStream);
 
   file.close();
   http.end();
 
-  if (writeResult < 0) {
-    LOG_ERR("HTTP", "writeToStream error: %d", writeResult);
-    Storage.remove(destPath.c_str());
-    return HTTP_ERROR;
+  if (fileStream.rejected()) {
+    LOG_ERR("HTTP", "Download rejected");
+    removePart(partPath, validatorPath);
+    return ABORTED;
   }
 
-  const size_t downloaded = fileStream.downloaded();
-  LOG_DBG("HTTP", "Downloaded %zu bytes", downloaded);
-
   // Guard against partial writes even if HTTPClient completes.
   if (!fileStream.ok()) {
     LOG_ERR("HTTP", "Write failed during download");
-    Storage.remove(destPath.c_str());
+    removePart(partPath, validatorPath);
     return FILE_ERROR;
   }
 
-  if (contentLength == 0 && downloaded == 0) {
-    LOG_ERR("HTTP", "Download failed: no data received");
-    Storage.remove(destPath.c_str());
-    return HTTP_ERROR;
-  }
+  const size_t received = fileStream.downloaded() - resumeFrom;
+  LOG_DBG("HTTP", "Downloaded %zu bytes", received);
 
-  // Verify download size if known
-  if (contentLength > 0 && downloaded != contentLength) {
-    LOG_ERR("HTTP", "Size mismatch: got %zu, expected %zu", downloaded, contentLength);
-    Storage.remove(destPath.c_str());
+  if (writeResult < 0 || (contentLength == 0 && received == 0) || (contentLength > 0 && received != contentLength)) {
+    LOG_ERR("HTTP", "Download incomplete: %d, got %zu of %zu bytes", writeResult, received, contentLength);
+    if (validator.empty()) {
+      removePart(partPath, validatorPath);
+    } else {
+      LOG_DBG("HTTP", "Keeping %zu bytes to resume", fileStream.downloaded());
+    }
     return HTTP_ERROR;
   }
 
+  Storage.remove(destPath.c_str());
+  if (!Storage.rename(partPath.c_str(), destPath.c_str())) {
+    LOG_ERR("HTTP", "Failed to move download to %s", destPath.c_str());
+    removePart(partPath, validatorPath);
+    return FILE_ERROR;
+  }
+  Storage.remove(validatorPath.c_str());
   return OK;
 }
@@ -36,14 +36,41 @@ class HttpDownloader {
 
   static bool fetchUrl(const std::string& url, Stream& stream, bool useAuth = false);
 
+  enum class FetchResult {
+    FETCHED,
+    NOT_MODIFIED,
+    FAILED,
+  };
+
+  /**
+   * Fetch content from a URL unless it is unchanged since a previous fetch.
+   * @param url The URL to fetch
+   * @param stream Receives the body, only when the result is FETCHED
+   * @param etag In: ETag of the copy on hand, sent as If-None-Match if not empty. Out: ETag of the response.
+   * @param lastModified In: Last-Modified of the copy on hand, sent as If-Modified-Since if not empty. Out: the
+   *                     response's Last-Modified.
+   * @param useAuth If true, send configured OPDS Basic auth credentials
+   * @return NOT_MODIFIED if the server answered 304, which leaves etag and lastModified alone
+   */
+  static FetchResult fetchUrlIfChanged(const std::string& url, Stream& stream, std::string& etag,
+                                       std::string& lastModified, bool useAuth = false);
+
   /**
-   * Download a file to the SD card.
+   * Download a file to the SD card. The file only appears at destPath once complete; until then it is kept in
+   * destPath + ".part", and a download that broke off is resumed from there by the next call for the same destPath.
    * @param url The URL to download
    * @param destPath The destination path on SD card
    * @param progress Optional progress callback
    * @param useAuth If true, send configured OPDS Basic auth credentials
+   * @param tee Optional, also sees the file's bytes in order from the first, before they are written. The download
+   *            is ABORTED, and its part removed, if it doesn't take them all.
    * @return DownloadError indicating success or failure type
   */
   static DownloadError downloadToFile(const std::string& url, const std::string& destPath,
-                                      ProgressCallback progress = nullptr, bool useAuth = false);
+                                      ProgressCallback progress = nullptr, bool useAuth = false, Print* tee = nullptr);
+
+  /**
+   * Delete what a broken off download to destPath left for resuming, once nothing will ask for that file again.
+   */
+  static void discardPart(const std::string& destPath);
 };
@@ -0,0 +1,222 @@
+#include "HttpFileResponse.h"
+
+#include <HeapTags.h>
+#include <Logging.h>
+#include <WebServer.h>
+#include <esp_task_wdt.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+const char* skipSpaces(const char* text) {
+  while (*text == ' ' || *text == '\t') text++;
+  return text;
+}
+
+std::string trim(const std::string& text) {
+  const size_t first = text.find_first_not_of(" \t");
+  if (first == std::string::npos) {
+    return "";
+  }
+  return text.substr(first, text.find_last_not_of(" \t") - first + 1);
+}
+
+// The quoted part of an entity tag, without the weak indicator, for the weak comparison
+std::string opaqueTag(const std::string& tag) { return tag.compare(0, 2, "W/") == 0 ? tag.substr(2) : tag; }
+
+// Parses the decimal number in [begin, end), which may be surrounded by spaces. An empty one is not `present`.
+// Returns false on anything else.
+bool parseNumber(const char* begin, const char* end, bool& present, uint64_t& value) {
+  while (begin < end && (*begin == ' ' || *begin == '\t')) begin++;
+  while (end > begin && (end[-1] == ' ' || end[-1] == '\t')) end--;
+  present = begin < end;
+  value = 0;
+  for (const char* c = begin; c < end; c++) {
+    if (*c < '0' || *c > '9' || value > (UINT64_MAX - 9) / 10) {
+      return false;
+    }
+    value = value * 10 + (*c - '0');
+  }
+  return true;
+}
+}  // namespace
+
+namespace HttpFileResponse {
+
+RangeResult parseRange(const char* header, const size_t fileSize, size_t& start, size_t& length) {
+  if (!header) {
+    return RangeResult::None;
+  }
+  const char* spec = skipSpaces(header);
+  if (strncmp(spec, "bytes=", 6) != 0) {
+    return RangeResult::None;
+  }
+  spec += 6;
+  const char* dash = strchr(spec, '-');
+  if (!dash || strchr(spec, ',')) {
+    return RangeResult::None;
+  }
+
+  bool hasFirst, hasLast;
+  uint64_t first, last;
+  if (!parseNumber(spec, dash, hasFirst, first) || !parseNumber(dash + 1, dash + strlen(dash), hasLast, last) ||
+      (!hasFirst && !hasLast) || (hasFirst && hasLast && last < first)) {
+    return RangeResult::None;
+  }
+
+  if (!hasFirst) {
+    // bytes=-N is the last N bytes
+    if (last == 0 || fileSize == 0) {
+      return RangeResult::Unsatisfiable;
+    }
+    length = static_cast<size_t>(std::min<uint64_t>(last, fileSize));
+    start = fileSize - length;
+    return RangeResult::Satisfiable;
+  }
+  if (first >= fileSize) {
+    return RangeResult::Unsatisfiable;
+  }
+  const uint64_t end = hasLast ? std::min<uint64_t>(last, fileSize - 1) : fileSize - 1;
+  start = static_cast<size_t>(first);
+  length = static_cast<size_t>(end - first + 1);
+  return RangeResult::Satisfiable;
+}
+
+std::string makeETag(const size_t fileSize, const uint16_t fatDate, const uint16_t fatTime) {
+  char etag[32];
+  snprintf(etag, sizeof(etag), "W/\"%lx-%lx\"", static_cast<unsigned long>(fileSize),
+           static_cast<unsigned long>(static_cast<uint32_t>(fatDate) << 16 | fatTime));
+  return etag;
+}
+
+bool etagMatches(const char* ifNoneMatch, const std::string& etag) {
+  if (!ifNoneMatch) {
+    return false;
+  }
+  const std::string header = trim(ifNoneMatch);
+  if (header == "*") {
+    return true;
+  }
+  size_t begin = 0;
+  while (begin <= header.size()) {
+    size_t end = header.find(',', begin);
+    if (end == std::string::npos) end = header.size();
+    if (opaqueTag(trim(header.substr(begin, end - begin))) == opaqueTag(etag)) {
+      return true;
+    }
+    begin = end + 1;
+  }
+  return false;
+}
+
+Plan plan(const size_t fileSize, const std::string& etag, const char* range, const char* ifNoneMatch,
+          const char* ifRange) {
+  Plan response;
+  response.etag = etag;
+  response.length = fileSize;
+
+  if (ifNoneMatch && *ifNoneMatch && etagMatches(ifNoneMatch, etag)) {
+    response.status = 304;
+    response.length = 0;
+    return response;
+  }
+
+  // If-Range carries the validator of the client's partial copy and needs a strong match, which a weak ETag never
+  // gives: with If-Range the whole file is always sent. The date form is never a match either, as the card's
+  // timestamps are too coarse to be a strong validator. A Range without If-Range is still honoured.
+  if (!range || !*range || (ifRange && *ifRange)) {
+    return response;
+  }
+
+  size_t start = 0;
+  size_t length = 0;
+  char contentRange[64];
+  switch (parseRange(range, fileSize, start, length)) {
+    case RangeResult::Satisfiable:
+      response.status = 206;
+      response.start = start;
+      response.length = length;
+      snprintf(contentRange, sizeof(contentRange), "bytes %lu-%lu/%lu", static_cast<unsigned long>(start),
+               static_cast<unsigned long>(start + length - 1), static_cast<unsigned long>(fileSize));
+      response.contentRange = contentRange;
+      break;
+    case RangeResult::Unsatisfiable:
+      response.status = 416;
+      response.length = 0;
+      snprintf(contentRange, sizeof(contentRange), "bytes */%lu", static_cast<unsigned long>(fileSize));
+      response.contentRange = contentRange;
+      break;
+    case RangeResult::None:
+      break;
+  }
+  return response;
+}
+
+bool streamBody(FsFile& file, const size_t start, const size_t length, uint8_t* buffer, const size_t bufferSize,
+                const std::function<bool(const uint8_t*, size_t)>& write) {
+  if (!file.seekSet(start)) {
+    LOG_ERR("HTTP", "Failed to seek to %lu", static_cast<unsigned long>(start));
+    return false;
+  }
+  size_t position = start;
+  size_t remaining = length;
+  while (remaining > 0) {
+    // The first read stops at a multiple of the buffer size, so all the others start on one
+    const size_t wanted = std::min(remaining, bufferSize - position % bufferSize);
+    const int bytesRead = file.read(buffer, wanted);
+    if (bytesRead <= 0) {
+      LOG_ERR("HTTP", "Read failed at %lu", static_cast<unsigned long>(position));
+      return false;
+    }
+    if (!write(buffer, bytesRead)) {
+      return false;
+    }
+    position += bytesRead;
+    remaining -= bytesRead;
+  }
+  return true;
+}
+
+void send(WebServer& server, FsFile& file, const char* contentType) {
+  uint16_t fatDate = 0;
+  uint16_t fatTime = 0;
+  file.getModifyDateTime(&fatDate, &fatTime);
+  const size_t fileSize = file.size();
+  const Plan response = plan(fileSize, makeETag(fileSize, fatDate, fatTime), server.header("Range").c_str(),
+                             server.header("If-None-Match").c_str(), server.header("If-Range").c_str());
+
+  server.sendHeader("Accept-Ranges", "bytes");
+  server.sendHeader("ETag", response.etag.c_str());
+  if (!response.contentRange.empty()) {
+    server.sendHeader("Content-Range", response.contentRange.c_str());
+  }
+  server.setContentLength(response.length);
+  server.send(response.status, contentType, "");
+  if (server.method() == HTTP_HEAD || response.length == 0) {
+    return;
+  }
+
+  NetworkClient client = server.client();
+  const auto write = [&client](const uint8_t* data, const size_t length) {
+    esp_task_wdt_reset();
+    return client.write(data, length) == length;
+  };
+  bool complete;
+  auto* buffer = static_cast<uint8_t*>(HeapTags::allocate(READ_CHUNK_SIZE, HeapTag::WebServer));
+  if (buffer) {
+    complete = streamBody(file, response.start, response.length, buffer, READ_CHUNK_SIZE, write);
+    HeapTags::release(buffer);
+  } else {
+    uint8_t fallback[FALLBACK_CHUNK_SIZE];
+    complete = streamBody(file, response.start, response.length, fallback, sizeof(fallback), write);
+  }
+  if (!complete) {
+    LOG_DBG("HTTP", "Response ended early (%d, %lu bytes from %lu)", response.status,
+            static_cast<unsigned long>(response.length), static_cast<unsigned long>(response.start));
+  }
+}
+
+}  // namespace HttpFileResponse
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <HalStorage.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+class WebServer;
+
+/**
+ * Answers GET and HEAD requests for a file on the SD card, shared by /download and WebDAV GET.
+ *
+ * Supports a single `Range: bytes=` range (206 Partial Content, 416 when it starts past the end), conditional GETs
+ * with a weak ETag built from the file's size and modification time (`If-None-Match` gives 304; `If-Range` needs a
+ * strong validator, so it always falls back to the whole file), and HEAD, which sends the same headers without the body. The body is read
+ * from the card in large reads aligned to the buffer size, so SdFat can read whole sectors straight into it.
+ */
+namespace HttpFileResponse {
+
+// Read size for the body; reads after the first one start on a multiple of it
+constexpr size_t READ_CHUNK_SIZE = 16 * 1024;
+// Used from the stack when READ_CHUNK_SIZE can't be allocated
+constexpr size_t FALLBACK_CHUNK_SIZE = 4096;
+
+struct Plan {
+  int status = 200;  // 200, 206, 304 or 416
+  size_t start = 0;
+  size_t length = 0;  // bytes of body to send
+  std::string etag;
+  std::string contentRange;  // Content-Range header value for 206 and 416, empty otherwise
+};
+
+enum class RangeResult { None, Satisfiable, Unsatisfiable };
+
+// Parses a Range header against a file of `fileSize` bytes. Anything but a single byte range, including syntax this
+// doesn't understand, is None: the whole file is sent, which RFC 9110 allows.
+RangeResult parseRange(const char* header, size_t fileSize, size_t& start, size_t& length);
+
+// Weak validator (`W/"..."`) from the file's size and FAT modification date/time. Without a clock the card's
+// timestamps can repeat, so a file rewritten with the same size may keep its tag.
+std::string makeETag(size_t fileSize, uint16_t fatDate, uint16_t fatTime);
+
+// Whether an If-None-Match header (a list of entity tags or "*") matches `etag`, using the weak comparison
+bool etagMatches(const char* ifNoneMatch, const std::string& etag);
+
+// Decides the response from the request's Range, If-None-Match and If-Range headers (empty when absent)
+Plan plan(size_t fileSize, const std::string& etag, const char* range, const char* ifNoneMatch, const char* ifRange);
+
+// Reads `length` bytes from `start` and hands them to `write`, which returns false to stop (e.g. the client left).
+// Returns true once everything was read and written.
+bool streamBody(FsFile& file, size_t start, size_t length, uint8_t* buffer, size_t bufferSize,
+                const std::function<bool(const uint8_t*, size_t)>& write);
+
+// Sends `file` as the response to the server's current GET or HEAD request. Headers the caller added with
+// sendHeader() before (e.g. Content-Disposition) go out with it. The file is left open.
+void send(WebServer& server, FsFile& file, const char* contentType);
+
+}  // namespace HttpFileResponse
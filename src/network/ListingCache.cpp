@@ -0,0 +1,405 @@
+#include "ListingCache.h"
+
+#include <Arduino.h>
+#include <BufferedFile.h>
+#include <Fnv1a.h>
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+#include <esp_task_wdt.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+namespace {
+constexpr char LISTINGS_DIR[] = "/.crosspoint/listings";
+constexpr uint8_t SNAPSHOT_VERSION = 1;
+// Entries are referred to by uint16_t in the order tables
+constexpr size_t MAX_ENTRIES = UINT16_MAX;
+// Heap a snapshot build leaves to the rest of the server
+constexpr uint32_t BUILD_HEAP_RESERVE = 48 * 1024;
+// Heap per entry while building: offset, size, modified time, name key, flags and two copies of an order, with some
+// slack for the vectors moving when they grow
+constexpr size_t BUILD_BYTES_PER_ENTRY = 32;
+constexpr size_t GROW_STEP = 256;
+constexpr uint16_t MAX_NAME_LENGTH = 1024;
+constexpr uint8_t FLAG_DIRECTORY = 1 << 0;
+// Fixed part of an entry: flags, size, modified time, name length
+constexpr size_t ENTRY_HEADER_SIZE = 11;
+
+// Same items the web server and WebDAV refuse to serve
+const char* HIDDEN_ITEMS[] = {"System Volume Information", "XTCache"};
+
+/*
+ * Snapshot layout (little-endian):
+ *   u8 version, u8 complete, u32 entry count, u32 tables offset   (written last)
+ *   u16 folder path length, folder path                            (catches hash collisions)
+ *   entries in directory order: u8 flags, u32 size, u32 modified, u16 name length, name
+ *   tables: u32 entry offset[count], u16 index by name[count], by size[count], by modified time[count]
+ */
+struct Snapshot {
+  FsFile file;
+  uint32_t count = 0;
+  uint32_t tablesOffset = 0;
+};
+
+std::string normalize(const std::string& folder) {
+  std::string normalized = folder.empty() || folder[0] != '/' ? "/" + folder : folder;
+  while (normalized.size() > 1 && normalized.back() == '/') {
+    normalized.pop_back();
+  }
+  return normalized;
+}
+
+std::string snapshotPath(const std::string& folder) {
+  char path[sizeof(LISTINGS_DIR) + 16];
+  snprintf(path, sizeof(path), "%s/%08lx.bin", LISTINGS_DIR, static_cast<unsigned long>(fnv1a32(folder)));
+  return path;
+}
+
+uint8_t foldCase(const uint8_t c) { return c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c; }
+
+// The first 8 bytes of the case-folded name, so comparing keys compares those bytes
+uint64_t nameKey(const char* name) {
+  uint64_t key = 0;
+  for (int i = 0; i < 8; i++) {
+    key <<= 8;
+    if (*name) {
+      key |= foldCase(static_cast<uint8_t>(*name++));
+    }
+  }
+  return key;
+}
+
+int compareNames(const std::string& a, const std::string& b) {
+  const size_t length = std::min(a.size(), b.size());
+  for (size_t i = 0; i < length; i++) {
+    const uint8_t ca = foldCase(static_cast<uint8_t>(a[i]));
+    const uint8_t cb = foldCase(static_cast<uint8_t>(b[i]));
+    if (ca != cb) {
+      return ca < cb ? -1 : 1;
+    }
+  }
+  return a.size() == b.size() ? 0 : (a.size() < b.size() ? -1 : 1);
+}
+
+template <typename Reader>
+bool readEntry(Reader& reader, ListingCache::Entry& entry) {
+  uint8_t header[ENTRY_HEADER_SIZE];
+  if (reader.read(header, sizeof(header)) != sizeof(header)) {
+    return false;
+  }
+  uint16_t nameLength;
+  entry.isDirectory = header[0] & FLAG_DIRECTORY;
+  memcpy(&entry.size, header + 1, sizeof(entry.size));
+  memcpy(&entry.modified, header + 5, sizeof(entry.modified));
+  memcpy(&nameLength, header + 9, sizeof(nameLength));
+  if (nameLength > MAX_NAME_LENGTH) {
+    return false;
+  }
+  entry.name.resize(nameLength);
+  return reader.read(&entry.name[0], nameLength) == nameLength;
+}
+
+bool readNameAt(FsFile& file, const uint32_t offset, std::string& name) {
+  ListingCache::Entry entry;
+  if (!file.seekSet(offset) || !readEntry(file, entry)) {
+    return false;
+  }
+  name = std::move(entry.name);
+  return true;
+}
+
+template <typename T>
+bool readAt(FsFile& file, const uint32_t offset, T& value) {
+  return file.seekSet(offset) && file.read(&value, sizeof(value)) == sizeof(value);
+}
+
+void writeHeader(BufferedWriter& writer, const bool complete, const uint32_t count, const uint32_t tablesOffset) {
+  serialization::writePod(writer, SNAPSHOT_VERSION);
+  serialization::writePod(writer, static_cast<uint8_t>(complete));
+  serialization::writePod(writer, count);
+  serialization::writePod(writer, tablesOffset);
+}
+
+bool openSnapshot(const std::string& folder, Snapshot& snapshot) {
+  const std::string path = snapshotPath(folder);
+  if (!Storage.exists(path.c_str()) || !Storage.openFileForRead("LST", path, snapshot.file)) {
+    return false;
+  }
+  uint8_t version = 0;
+  uint8_t complete = 0;
+  uint16_t pathLength = 0;
+  bool valid = snapshot.file.read(&version, 1) == 1 && version == SNAPSHOT_VERSION &&
+               snapshot.file.read(&complete, 1) == 1 && complete && readAt(snapshot.file, 2, snapshot.count) &&
+               readAt(snapshot.file, 6, snapshot.tablesOffset) && readAt(snapshot.file, 10, pathLength) &&
+               pathLength == folder.size();
+  if (valid) {
+    std::string recordedFolder(pathLength, '\0');
+    valid = snapshot.file.read(&recordedFolder[0], pathLength) == pathLength && recordedFolder == folder;
+  }
+  if (!valid) {
+    snapshot.file.close();
+  }
+  return valid;
+}
+
+enum class BuildResult { Built, NotFolder, Failed };
+
+BuildResult build(const std::string& folder) {
+  FsFile dir = Storage.open(folder.c_str());
+  if (!dir || !dir.isDirectory()) {
+    if (dir) dir.close();
+    return BuildResult::NotFolder;
+  }
+
+  Storage.mkdir(LISTINGS_DIR);
+  const std::string path = snapshotPath(folder);
+  const std::string tmpPath = path + ".tmp";
+  // Read and write: sorting by name reads back names whose first bytes tie
+  FsFile file = Storage.open(tmpPath.c_str(), O_RDWR | O_CREAT | O_TRUNC);
+  if (!file) {
+    dir.close();
+    return BuildResult::Failed;
+  }
+
+  std::vector<uint32_t> offsets;
+  std::vector<uint32_t> sizes;
+  std::vector<uint32_t> modified;
+  std::vector<uint64_t> keys;
+  std::vector<uint8_t> flags;
+  bool ok = true;
+  {
+    BufferedWriter writer(file, 1024);
+    writeHeader(writer, false, 0, 0);
+    serialization::writePod(writer, static_cast<uint16_t>(folder.size()));
+    writer.write(folder.data(), folder.size());
+
+    char name[500];
+    for (FsFile entry = dir.openNextFile(); entry; entry = dir.openNextFile()) {
+      entry.getName(name, sizeof(name));
+      if (ListingCache::isHidden(name)) {
+        entry.close();
+        continue;
+      }
+      if (offsets.size() == offsets.capacity()) {
+        // Without exceptions a failed allocation aborts, so only grow while the heap can take it
+        const size_t capacity = offsets.size() + GROW_STEP;
+        if (capacity > MAX_ENTRIES || ESP.getFreeHeap() < BUILD_HEAP_RESERVE + capacity * BUILD_BYTES_PER_ENTRY) {
+          LOG_ERR("LST", "Not enough memory to snapshot %s past %u entries", folder.c_str(),
+                  static_cast<unsigned>(offsets.size()));
+          entry.close();
+          ok = false;
+          break;
+        }
+        offsets.reserve(capacity);
+        sizes.reserve(capacity);
+        modified.reserve(capacity);
+        keys.reserve(capacity);
+        flags.reserve(capacity);
+      }
+
+      const bool isDirectory = entry.isDirectory();
+      uint16_t fatDate = 0;
+      uint16_t fatTime = 0;
+      entry.getModifyDateTime(&fatDate, &fatTime);
+      const uint16_t nameLength = std::min<size_t>(strlen(name), MAX_NAME_LENGTH);
+      offsets.push_back(writer.position());
+      sizes.push_back(isDirectory ? 0 : entry.size());
+      modified.push_back(static_cast<uint32_t>(fatDate) << 16 | fatTime);
+      keys.push_back(nameKey(name));
+      flags.push_back(isDirectory ? FLAG_DIRECTORY : 0);
+      entry.close();
+
+      serialization::writePod(writer, flags.back());
+      serialization::writePod(writer, sizes.back());
+      serialization::writePod(writer, modified.back());
+      serialization::writePod(writer, nameLength);
+      writer.write(name, nameLength);
+
+      yield();               // Let WiFi run during long walks
+      esp_task_wdt_reset();  // Large folders take a while
+    }
+    dir.close();
+
+    const uint32_t count = offsets.size();
+    const uint32_t tablesOffset = writer.position();
+    ok = ok && writer.flush();
+
+    if (ok) {
+      std::vector<uint16_t> order(count);
+      std::iota(order.begin(), order.end(), 0);
+      std::string nameA;
+      std::string nameB;
+      std::sort(order.begin(), order.end(), [&](const uint16_t a, const uint16_t b) {
+        if ((flags[a] ^ flags[b]) & FLAG_DIRECTORY) {
+          return (flags[a] & FLAG_DIRECTORY) != 0;
+        }
+        if (keys[a] != keys[b]) {
+          return keys[a] < keys[b];
+        }
+        if (!readNameAt(file, offsets[a], nameA) || !readNameAt(file, offsets[b], nameB)) {
+          return a < b;
+        }
+        const int compared = compareNames(nameA, nameB);
+        return compared != 0 ? compared < 0 : a < b;
+      });
+      const std::vector<uint16_t> nameOrder = order;
+
+      ok = writer.seek(tablesOffset);
+      writer.write(offsets.data(), count * sizeof(uint32_t));
+      writer.write(nameOrder.data(), count * sizeof(uint16_t));
+      std::stable_sort(order.begin(), order.end(),
+                       [&sizes](const uint16_t a, const uint16_t b) { return sizes[a] < sizes[b]; });
+      writer.write(order.data(), count * sizeof(uint16_t));
+      order = nameOrder;
+      std::stable_sort(order.begin(), order.end(),
+                       [&modified](const uint16_t a, const uint16_t b) { return modified[a] < modified[b]; });
+      writer.write(order.data(), count * sizeof(uint16_t));
+
+      // Only now is the snapshot marked complete
+      ok = ok && writer.seek(0);
+      writeHeader(writer, true, count, tablesOffset);
+      ok = ok && writer.flush() && !writer.hasError();
+    }
+  }
+  file.close();
+
+  if (!ok) {
+    Storage.remove(tmpPath.c_str());
+    return BuildResult::Failed;
+  }
+  Storage.remove(path.c_str());
+  if (!Storage.rename(tmpPath.c_str(), path.c_str())) {
+    Storage.remove(tmpPath.c_str());
+    return BuildResult::Failed;
+  }
+  LOG_DBG("LST", "Snapshot of %s: %u entries", folder.c_str(), static_cast<unsigned>(offsets.size()));
+  return BuildResult::Built;
+}
+
+// Lists the folder straight from the card, in directory order, when it can't be snapshotted
+int32_t listDirectly(const std::string& folder, const size_t offset, const size_t limit,
+                     const std::function<bool(const ListingCache::Entry&)>& visit) {
+  FsFile dir = Storage.open(folder.c_str());
+  if (!dir || !dir.isDirectory()) {
+    if (dir) dir.close();
+    return -1;
+  }
+  int32_t count = 0;
+  bool visiting = true;
+  ListingCache::Entry entry;
+  char name[500];
+  for (FsFile file = dir.openNextFile(); file; file = dir.openNextFile()) {
+    file.getName(name, sizeof(name));
+    if (!ListingCache::isHidden(name)) {
+      if (visiting && static_cast<size_t>(count) >= offset && static_cast<size_t>(count) - offset < limit) {
+        uint16_t fatDate = 0;
+        uint16_t fatTime = 0;
+        file.getModifyDateTime(&fatDate, &fatTime);
+        entry.name = name;
+        entry.isDirectory = file.isDirectory();
+        entry.size = entry.isDirectory ? 0 : file.size();
+        entry.modified = static_cast<uint32_t>(fatDate) << 16 | fatTime;
+        visiting = visit(entry);
+      }
+      count++;
+    }
+    file.close();
+    yield();
+    esp_task_wdt_reset();
+  }
+  dir.close();
+  return count;
+}
+}  // namespace
+
+namespace ListingCache {
+
+bool isHidden(const char* name) {
+  if (name[0] == '.') {
+    return true;
+  }
+  return std::any_of(std::begin(HIDDEN_ITEMS), std::end(HIDDEN_ITEMS),
+                     [name](const char* hidden) { return strcmp(name, hidden) == 0; });
+}
+
+bool prepare(const std::string& folderPath) {
+  const std::string folder = normalize(folderPath);
+  Snapshot snapshot;
+  if (!openSnapshot(folder, snapshot)) {
+    if (build(folder) != BuildResult::Built || !openSnapshot(folder, snapshot)) {
+      return false;
+    }
+  }
+  snapshot.file.close();
+  return true;
+}
+
+int32_t list(const std::string& folderPath, const Order order, const bool descending, const size_t offset,
+             const size_t limit, const std::function<bool(const Entry&)>& visit) {
+  const std::string folder = normalize(folderPath);
+  Snapshot snapshot;
+  if (!openSnapshot(folder, snapshot)) {
+    const BuildResult result = build(folder);
+    if (result == BuildResult::NotFolder) {
+      return -1;
+    }
+    if (result == BuildResult::Failed || !openSnapshot(folder, snapshot)) {
+      return listDirectly(folder, offset, limit, visit);
+    }
+  }
+
+  const uint32_t count = snapshot.count;
+  const size_t end = offset >= count ? offset : offset + std::min<size_t>(limit, count - offset);
+  Entry entry;
+  uint32_t entryOffset = 0;
+  if (order == Order::Directory && !descending) {
+    // A page in directory order is one run of the file
+    if (offset < end && readAt(snapshot.file, snapshot.tablesOffset + offset * sizeof(uint32_t), entryOffset) &&
+        snapshot.file.seekSet(entryOffset)) {
+      BufferedReader reader(snapshot.file, 1024);
+      for (size_t i = offset; i < end && readEntry(reader, entry) && visit(entry); i++) {
+      }
+    }
+  } else {
+    const uint32_t orderTable = snapshot.tablesOffset + count * sizeof(uint32_t) +
+                                (order == Order::Directory ? 0 : static_cast<uint32_t>(order) - 1) * count *
+                                                                    sizeof(uint16_t);
+    for (size_t i = offset; i < end; i++) {
+      const size_t position = descending ? count - 1 - i : i;
+      uint16_t index = position;
+      if ((order != Order::Directory && !readAt(snapshot.file, orderTable + position * sizeof(uint16_t), index)) ||
+          !readAt(snapshot.file, snapshot.tablesOffset + index * sizeof(uint32_t), entryOffset) ||
+          !snapshot.file.seekSet(entryOffset) || !readEntry(snapshot.file, entry) || !visit(entry)) {
+        break;
+      }
+    }
+  }
+  snapshot.file.close();
+  return count;
+}
+
+void invalidate(const std::string& folder) {
+  const std::string path = snapshotPath(normalize(folder));
+  if (Storage.exists(path.c_str())) {
+    Storage.remove(path.c_str());
+  }
+}
+
+void invalidateParent(const std::string& path) {
+  const std::string normalized = normalize(path);
+  const size_t slash = normalized.find_last_of('/');
+  invalidate(slash == 0 ? "/" : normalized.substr(0, slash));
+}
+
+void clear() {
+  if (Storage.exists(LISTINGS_DIR)) {
+    Storage.removeDir(LISTINGS_DIR);
+  }
+}
+
+}  // namespace ListingCache
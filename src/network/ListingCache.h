@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+/**
+ * Snapshots of folder listings for the web server and WebDAV, in /.crosspoint/listings/.
+ *
+ * Walking a folder with openNextFile() opens every entry and holds the SD card for the whole walk, which adds up for
+ * folders with thousands of files that the file browser pages through and WebDAV clients PROPFIND again and again.
+ * The first listing of a folder writes a snapshot of its visible entries with their size and modified time, plus the
+ * entry order by name, size and modified time; later listings read just the page they need from it.
+ *
+ * While the server runs it is the only one changing the card outside /.crosspoint, so a snapshot stays valid until a
+ * handler changes the folder and invalidates it. clear() drops every snapshot; the server calls it when it starts, as
+ * the card may have changed since the last session.
+ *
+ * Sorting keeps about 24 bytes per entry in memory while a snapshot is built. When the heap can't spare that, the
+ * folder is listed straight from the card in directory order, as before.
+ */
+namespace ListingCache {
+
+struct Entry {
+  std::string name;
+  bool isDirectory = false;
+  uint32_t size = 0;
+  uint32_t modified = 0;  // FAT date << 16 | FAT time
+};
+
+enum class Order : uint8_t {
+  Directory,  // as the card lists them
+  Name,       // folders first, then by name, ignoring ASCII case
+  Size,       // ties in name order
+  Modified,   // ties in name order
+};
+
+// Items hidden from the file browser and WebDAV, besides names starting with "."
+bool isHidden(const char* name);
+
+// Builds the snapshot of `folder` unless it has one. Returns false if it isn't a folder or can't be snapshotted right
+// now, in which case list() walks the card and only knows the entry count once it has walked all of it.
+bool prepare(const std::string& folder);
+
+// Visits up to `limit` entries of `folder` from `offset` on, in `order` (reversed with `descending`), until `visit`
+// returns false. Returns the number of entries in the folder, or -1 if it isn't a folder.
+int32_t list(const std::string& folder, Order order, bool descending, size_t offset, size_t limit,
+             const std::function<bool(const Entry&)>& visit);
+
+// The server added, removed or renamed entries of `folder`
+void invalidate(const std::string& folder);
+// Same for the folder holding `path`
+void invalidateParent(const std::string& path);
+// Drops every snapshot, e.g. after a folder was moved or deleted, which changes every listing below it
+void clear();
+
+}  // namespace ListingCache
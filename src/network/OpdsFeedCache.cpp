@@ -0,0 +1,316 @@
+#include "OpdsFeedCache.h"
+
+#include <BufferedFile.h>
+#include <Fnv1a.h>
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <algorithm>
+#include <cstdio>
+
+#include "util/CacheLru.h"
+
+namespace {
+constexpr char FEEDS_DIR[] = "/.crosspoint/opds";
+constexpr uint8_t FEED_VERSION = 1;
+// Longer fields are cut when written, and a longer length read back means the file is corrupt
+constexpr uint16_t MAX_FIELD_LENGTH = 4096;
+
+std::string feedBasePath(const std::string& url) {
+  char name[16];
+  snprintf(name, sizeof(name), "/%08x", static_cast<unsigned>(fnv1a32(url)));
+  return std::string(FEEDS_DIR) + name;
+}
+
+void writeField(BufferedWriter& writer, const std::string& value) {
+  const uint16_t length = std::min<size_t>(value.size(), MAX_FIELD_LENGTH);
+  serialization::writePod(writer, length);
+  writer.write(value.data(), length);
+}
+
+bool readField(BufferedReader& reader, std::string& value) {
+  uint16_t length = 0;
+  if (reader.read(&length, sizeof(length)) != sizeof(length) || length > MAX_FIELD_LENGTH) {
+    return false;
+  }
+  value.resize(length);
+  return length == 0 || reader.read(&value[0], length) == length;
+}
+
+void writeEntry(BufferedWriter& writer, const OpdsEntry& entry) {
+  serialization::writePod(writer, static_cast<uint8_t>(entry.type));
+  writeField(writer, entry.title);
+  writeField(writer, entry.author);
+  writeField(writer, entry.href);
+  writeField(writer, entry.id);
+}
+
+bool readEntry(BufferedReader& reader, OpdsEntry& entry) {
+  uint8_t type = 0;
+  if (reader.read(&type, sizeof(type)) != sizeof(type) || type > static_cast<uint8_t>(OpdsEntryType::BOOK)) {
+    return false;
+  }
+  entry.type = static_cast<OpdsEntryType>(type);
+  return readField(reader, entry.title) && readField(reader, entry.author) && readField(reader, entry.href) &&
+         readField(reader, entry.id);
+}
+
+size_t fileSize(const std::string& path) {
+  FsFile file;
+  if (!Storage.exists(path.c_str()) || !Storage.openFileForRead("OPDS", path, file)) {
+    return 0;
+  }
+  const size_t size = file.size();
+  file.close();
+  return size;
+}
+
+void removeFeedFiles(const std::string& basePath) {
+  for (const char* extension : {".hdr", ".ent", ".idx"}) {
+    const std::string path = basePath + extension;
+    if (Storage.exists(path.c_str())) {
+      Storage.remove(path.c_str());
+    }
+  }
+}
+
+// Marks the feed at `basePath` as used last and drops the feeds used longest ago beyond MAX_FEEDS
+void touchFeed(const std::string& basePath) {
+  const std::string name = basePath.substr(sizeof(FEEDS_DIR));
+  for (const auto& dropped : CacheLru::touch(FEEDS_DIR, ".hdr", name, OpdsFeedCache::MAX_FEEDS)) {
+    LOG_DBG("OPDS", "Dropping cached feed %s", dropped.c_str());
+    removeFeedFiles(std::string(FEEDS_DIR) + "/" + dropped);
+  }
+}
+}  // namespace
+
+OpdsFeedCache::OpenResult OpdsFeedCache::open(const std::string& url, const bool revalidate) {
+  close();
+  feedUrl = url;
+  basePath = feedBasePath(url);
+  const bool cached = loadHeader();
+  if (cached) {
+    touchFeed(basePath);
+  }
+  if (cached && !revalidate) {
+    LOG_DBG("OPDS", "Using cached feed: %u entries", static_cast<unsigned>(count));
+    return OpenResult::CACHED;
+  }
+
+  switch (fetchPage(url, true, cached)) {
+    case PageResult::APPENDED:
+      return OpenResult::DOWNLOADED;
+    case PageResult::NOT_MODIFIED:
+      LOG_DBG("OPDS", "Feed unchanged: %u entries", static_cast<unsigned>(count));
+      return OpenResult::UNCHANGED;
+    case PageResult::FETCH_FAILED:
+      return cached ? OpenResult::CACHED : OpenResult::FETCH_FAILED;
+    case PageResult::PARSE_FAILED:
+      return cached ? OpenResult::CACHED : OpenResult::PARSE_FAILED;
+  }
+  return OpenResult::FETCH_FAILED;
+}
+
+bool OpdsFeedCache::fetchNextPage() {
+  if (nextHref.empty()) {
+    return false;
+  }
+  return fetchPage(nextHref, false, false) == PageResult::APPENDED;
+}
+
+void OpdsFeedCache::close() {
+  feedUrl.clear();
+  basePath.clear();
+  etag.clear();
+  lastModified.clear();
+  nextHref.clear();
+  count = 0;
+  entriesSize = 0;
+}
+
+bool OpdsFeedCache::read(const size_t first, const size_t max, std::vector<OpdsEntry>& out) const {
+  out.clear();
+  if (first >= count) {
+    return first == count;
+  }
+  const size_t wanted = std::min<size_t>(max, count - first);
+
+  FsFile file;
+  uint32_t offset = 0;
+  if (!Storage.openFileForRead("OPDS", basePath + ".idx", file)) {
+    return false;
+  }
+  const bool found = file.seekSet(first * sizeof(uint32_t)) && file.read(&offset, sizeof(offset)) == sizeof(offset);
+  file.close();
+  if (!found || offset >= entriesSize || !Storage.openFileForRead("OPDS", basePath + ".ent", file)) {
+    return false;
+  }
+
+  bool ok = file.seekSet(offset);
+  if (ok) {
+    out.reserve(wanted);
+    BufferedReader reader(file, 1024);
+    while (ok && out.size() < wanted) {
+      out.emplace_back();
+      ok = readEntry(reader, out.back());
+    }
+  }
+  file.close();
+  if (!ok) {
+    LOG_ERR("OPDS", "Failed to read cached entries %u+", static_cast<unsigned>(first));
+    out.clear();
+  }
+  return ok;
+}
+
+bool OpdsFeedCache::loadHeader() {
+  const std::string path = basePath + ".hdr";
+  FsFile file;
+  if (!Storage.exists(path.c_str()) || !Storage.openFileForRead("OPDS", path, file)) {
+    return false;
+  }
+  uint8_t version = 0;
+  std::string recordedUrl;
+  bool ok;
+  {
+    BufferedReader reader(file, 256);
+    ok = reader.read(&version, sizeof(version)) == sizeof(version) && version == FEED_VERSION &&
+         reader.read(&count, sizeof(count)) == sizeof(count) &&
+         reader.read(&entriesSize, sizeof(entriesSize)) == sizeof(entriesSize) && readField(reader, recordedUrl) &&
+         recordedUrl == feedUrl && readField(reader, etag) && readField(reader, lastModified) &&
+         readField(reader, nextHref);
+  }
+  file.close();
+
+  // The header is written after the entries, but the entry files may have been lost since
+  ok = ok && fileSize(basePath + ".idx") >= count * sizeof(uint32_t) && fileSize(basePath + ".ent") >= entriesSize;
+  if (!ok) {
+    etag.clear();
+    lastModified.clear();
+    nextHref.clear();
+    count = 0;
+    entriesSize = 0;
+  }
+  return ok;
+}
+
+bool OpdsFeedCache::writeHeader() const {
+  const std::string path = basePath + ".hdr";
+  const std::string tmpPath = path + ".tmp";
+  FsFile file;
+  if (!Storage.openFileForWrite("OPDS", tmpPath, file)) {
+    return false;
+  }
+  bool ok;
+  {
+    BufferedWriter writer(file, 256);
+    serialization::writePod(writer, FEED_VERSION);
+    serialization::writePod(writer, count);
+    serialization::writePod(writer, entriesSize);
+    writeField(writer, feedUrl);
+    writeField(writer, etag);
+    writeField(writer, lastModified);
+    writeField(writer, nextHref);
+    ok = writer.flush() && !writer.hasError();
+  }
+  file.close();
+  if (Storage.exists(path.c_str())) {
+    Storage.remove(path.c_str());
+  }
+  if (!ok || !Storage.rename(tmpPath.c_str(), path.c_str())) {
+    Storage.remove(tmpPath.c_str());
+    return false;
+  }
+  return true;
+}
+
+OpdsFeedCache::PageResult OpdsFeedCache::fetchPage(const std::string& pageUrl, const bool firstPage,
+                                                   const bool conditional) {
+  Storage.mkdir(FEEDS_DIR);
+  // A first page replaces the whole feed, so it is written beside the cached copy and only swapped in once it parsed.
+  // Later pages are appended past the entries the header counts.
+  const std::string entPath = basePath + (firstPage ? ".ent.tmp" : ".ent");
+  const std::string idxPath = basePath + (firstPage ? ".idx.tmp" : ".idx");
+  const oflag_t flags = firstPage ? O_RDWR | O_CREAT | O_TRUNC : O_RDWR;
+  FsFile entFile = Storage.open(entPath.c_str(), flags);
+  FsFile idxFile = Storage.open(idxPath.c_str(), flags);
+  const uint32_t startCount = firstPage ? 0 : count;
+  const uint32_t startSize = firstPage ? 0 : entriesSize;
+  if (!entFile || !idxFile || !entFile.seekSet(startSize) || !idxFile.seekSet(startCount * sizeof(uint32_t))) {
+    LOG_ERR("OPDS", "Failed to open feed cache files");
+    if (entFile) entFile.close();
+    if (idxFile) idxFile.close();
+    return PageResult::FETCH_FAILED;
+  }
+
+  std::string pageEtag = conditional ? etag : "";
+  std::string pageLastModified = conditional ? lastModified : "";
+  std::string pageNextHref;
+  uint32_t pageCount = startCount;
+  uint32_t pageSize = startSize;
+  FetchResult fetched;
+  bool parsed;
+  bool written;
+  {
+    BufferedWriter entWriter(entFile, 1024);
+    BufferedWriter idxWriter(idxFile, 256);
+    OpdsParser parser;
+    parser.setEntryCallback([&](const OpdsEntry& entry) {
+      serialization::writePod(idxWriter, static_cast<uint32_t>(entWriter.position()));
+      writeEntry(entWriter, entry);
+      pageCount++;
+    });
+    fetched = fetcher(pageUrl, pageEtag, pageLastModified, parser);
+    parsed = !parser.error();
+    pageNextHref = parser.getNextHref();
+    written = entWriter.flush() && idxWriter.flush() && !entWriter.hasError() && !idxWriter.hasError();
+    pageSize = entWriter.position();
+  }
+  entFile.close();
+  idxFile.close();
+
+  PageResult result = PageResult::APPENDED;
+  if (fetched == FetchResult::NOT_MODIFIED && conditional) {
+    result = PageResult::NOT_MODIFIED;
+  } else if (fetched != FetchResult::FETCHED) {
+    result = PageResult::FETCH_FAILED;
+  } else if (!parsed) {
+    result = PageResult::PARSE_FAILED;
+  } else if (!written) {
+    LOG_ERR("OPDS", "Failed to write feed cache");
+    result = PageResult::FETCH_FAILED;
+  }
+  if (result != PageResult::APPENDED) {
+    if (firstPage) {
+      Storage.remove(entPath.c_str());
+      Storage.remove(idxPath.c_str());
+    }
+    return result;
+  }
+
+  if (firstPage) {
+    removeFeedFiles(basePath);
+    if (!Storage.rename(entPath.c_str(), (basePath + ".ent").c_str()) ||
+        !Storage.rename(idxPath.c_str(), (basePath + ".idx").c_str())) {
+      LOG_ERR("OPDS", "Failed to replace feed cache");
+      removeFeedFiles(basePath);
+      Storage.remove(entPath.c_str());
+      Storage.remove(idxPath.c_str());
+      return PageResult::FETCH_FAILED;
+    }
+    etag = std::move(pageEtag);
+    lastModified = std::move(pageLastModified);
+    touchFeed(basePath);
+  }
+  count = pageCount;
+  entriesSize = pageSize;
+  // A next link back to the page itself would never end
+  nextHref = pageNextHref == pageUrl ? "" : std::move(pageNextHref);
+  if (!writeHeader()) {
+    LOG_ERR("OPDS", "Failed to write feed cache header");
+  }
+  LOG_DBG("OPDS", "Cached %u entries of %s%s", static_cast<unsigned>(count), feedUrl.c_str(),
+          nextHref.empty() ? "" : ", more pages to come");
+  return PageResult::APPENDED;
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include <OpdsParser.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * Copies of OPDS feeds on the SD card, in /.crosspoint/opds/, that the book browser reads a screen at a time.
+ *
+ * Parsing a whole feed into entries in RAM runs out of memory on big Calibre or COPS catalogs, and refetching it on
+ * every visit is slow over WiFi. Entries are instead streamed from the parser to the card as they arrive, with an
+ * offset table so any window of them can be read back. A paginated feed (rel="next") is fetched one page at a time,
+ * when the browser asks for more.
+ *
+ * A feed is kept with the ETag and Last-Modified its first page came with. Opening it again sends those back, and a
+ * 304 keeps the copy, including the pages fetched after the first. Going back to a feed seen in this session skips
+ * even that request. Without a network, a cached feed is still shown.
+ *
+ * Files per feed, named by the 32-bit FNV-1a hash of its URL in hex:
+ *   <hash>.hdr  u8 version, u32 entry count, u32 entries size, then u16 len + bytes each for URL (catches hash
+ *               collisions), ETag, Last-Modified and the next page's href. Rewritten after each page.
+ *   <hash>.ent  entries: u8 type, then u16 len + bytes each for title, author, href and id
+ *   <hash>.idx  u32 offset in <hash>.ent of each entry
+ * The header's count is written last, so a page cut short leaves the feed as it was before the page. At most
+ * MAX_FEEDS feeds are kept; the one opened longest ago goes first, in the use order kept in .lru (see CacheLru).
+ */
+class OpdsFeedCache {
+ public:
+  static constexpr int MAX_FEEDS = 32;
+
+  enum class FetchResult : uint8_t {
+    FETCHED,
+    NOT_MODIFIED,
+    FAILED,
+  };
+
+  // Fetches `url` into `parser`. `url` is the one passed to open(), or a next page's href as the feed has it, which the
+  // fetcher resolves the way it resolves entry hrefs. etag and lastModified hold the cached copy's validators (empty if
+  // none), to send as If-None-Match and If-Modified-Since; on FETCHED they are replaced by the response's.
+  using Fetcher = std::function<FetchResult(const std::string& url, std::string& etag, std::string& lastModified,
+                                            OpdsParser& parser)>;
+
+  enum class OpenResult : uint8_t {
+    DOWNLOADED,    // Fetched and cached
+    UNCHANGED,     // The server confirmed the cached copy
+    CACHED,        // Cached copy used without the server confirming it
+    FETCH_FAILED,  // No cached copy and the fetch failed
+    PARSE_FAILED,  // No cached copy and the feed didn't parse
+  };
+
+  explicit OpdsFeedCache(Fetcher fetcher) : fetcher(std::move(fetcher)) {}
+
+  // Opens the feed at `url`. With `revalidate`, a cached copy is checked with the server first; without, it is used
+  // as is. Either way a feed that isn't cached is fetched.
+  OpenResult open(const std::string& url, bool revalidate);
+  // Fetches the next page of the open feed and appends its entries. Returns false on a fetch or parse error, or if
+  // there is no next page.
+  bool fetchNextPage();
+  void close();
+
+  const std::string& url() const { return feedUrl; }
+  size_t size() const { return count; }
+  // The feed has a rel="next" page that hasn't been fetched yet
+  bool hasNextPage() const { return !nextHref.empty(); }
+  // Replaces `out` with up to `max` entries starting at entry `first`. Returns false if they can't be read.
+  bool read(size_t first, size_t max, std::vector<OpdsEntry>& out) const;
+
+ private:
+  Fetcher fetcher;
+  std::string feedUrl;
+  std::string basePath;  // Path of the feed's files without the extension
+  std::string etag;
+  std::string lastModified;
+  std::string nextHref;
+  uint32_t count = 0;
+  uint32_t entriesSize = 0;
+
+  bool loadHeader();
+  bool writeHeader() const;
+  enum class PageResult : uint8_t { APPENDED, NOT_MODIFIED, FETCH_FAILED, PARSE_FAILED };
+  PageResult fetchPage(const std::string& pageUrl, bool firstPage, bool conditional);
+};
@@ -0,0 +1,189 @@
+#include "UploadWriter.h"
+
+#include <Arduino.h>
+#include <HeapTags.h>
+#include <Logging.h>
+#include <esp_task_wdt.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+
+namespace {
+// The network side waits for a buffer in slices this long, so it can keep the task watchdog fed
+constexpr uint32_t WAIT_SLICE_MS = 100;
+}  // namespace
+
+void UploadWriter::begin(FsFile& file) {
+  abort();
+  this->file = &file;
+  failed = false;
+  committed = 0;
+  writeTimeMs = 0;
+  stallTimeMs = 0;
+
+  for (auto& buffer : buffers) {
+    buffer = static_cast<uint8_t*>(HeapTags::allocate(BUFFER_SIZE, HeapTag::WebServer));
+  }
+  freeBlocks = xQueueCreate(BUFFER_COUNT, sizeof(int8_t));
+  fullBlocks = xQueueCreate(BUFFER_COUNT + 1, sizeof(Block));
+  stopped = xSemaphoreCreateBinary();
+  TaskHandle_t writerTask = nullptr;
+  writerRunning = freeBlocks && fullBlocks && stopped &&
+                  std::all_of(std::begin(buffers), std::end(buffers), [](const uint8_t* b) { return b; }) &&
+                  xTaskCreate(&writerTrampoline, "UploadWriter",
+                              4096,        // Stack size
+                              this,        // Parameters
+                              1,           // Priority: same as the loop task, so the two take turns
+                              &writerTask  // Task handle
+                              ) == pdPASS;
+  if (!writerRunning) {
+    LOG_ERR("UPW", "Not enough memory for write-behind, writing synchronously");
+    stop();
+    this->file = &file;
+    return;
+  }
+  for (int8_t i = 0; i < static_cast<int8_t>(BUFFER_COUNT); i++) {
+    xQueueSend(freeBlocks, &i, 0);
+  }
+}
+
+void UploadWriter::writerTrampoline(void* param) {
+  auto* self = static_cast<UploadWriter*>(param);
+  self->writerLoop();
+  vTaskDelete(nullptr);
+}
+
+void UploadWriter::writerLoop() {
+  Block block;
+  while (xQueueReceive(fullBlocks, &block, portMAX_DELAY) == pdTRUE && block.index >= 0) {
+    // After a failure the remaining blocks are only recycled, so the network side never waits on a dead writer
+    if (!failed) {
+      const unsigned long start = millis();
+      const size_t written = file->write(buffers[block.index], block.length);
+      writeTimeMs += millis() - start;
+      if (written == block.length) {
+        committed += written;
+      } else {
+        LOG_ERR("UPW", "Write failed: expected %u, wrote %u", static_cast<unsigned>(block.length),
+                static_cast<unsigned>(written));
+        failed = true;
+      }
+    }
+    xQueueSend(freeBlocks, &block.index, portMAX_DELAY);
+  }
+  xSemaphoreGive(stopped);
+}
+
+void UploadWriter::takeFreeBlock() {
+  const unsigned long start = millis();
+  while (xQueueReceive(freeBlocks, &fillIndex, pdMS_TO_TICKS(WAIT_SLICE_MS)) != pdTRUE) {
+    esp_task_wdt_reset();
+  }
+  stallTimeMs += millis() - start;
+  fillLength = 0;
+}
+
+void UploadWriter::submitFillBlock() {
+  const Block block = {fillIndex, fillLength};
+  xQueueSend(fullBlocks, &block, portMAX_DELAY);
+  fillIndex = -1;
+  fillLength = 0;
+}
+
+bool UploadWriter::write(const uint8_t* data, size_t length) {
+  if (!file || failed) {
+    return false;
+  }
+  if (!writerRunning) {
+    // Synchronous fallback
+    const unsigned long start = millis();
+    const size_t written = file->write(data, length);
+    writeTimeMs += millis() - start;
+    committed += written;
+    failed = written != length;
+    return !failed;
+  }
+
+  while (length > 0) {
+    if (fillIndex < 0) {
+      takeFreeBlock();
+    }
+    const size_t toCopy = std::min(length, BUFFER_SIZE - fillLength);
+    memcpy(buffers[fillIndex] + fillLength, data, toCopy);
+    fillLength += toCopy;
+    data += toCopy;
+    length -= toCopy;
+    if (fillLength == BUFFER_SIZE) {
+      submitFillBlock();
+    }
+  }
+  return !failed;
+}
+
+void UploadWriter::waitForBlocks() {
+  // Every buffer is back in freeBlocks once the writer has nothing left
+  int8_t indices[BUFFER_COUNT];
+  for (auto& index : indices) {
+    while (xQueueReceive(freeBlocks, &index, pdMS_TO_TICKS(WAIT_SLICE_MS)) != pdTRUE) {
+      esp_task_wdt_reset();
+    }
+  }
+  for (const auto index : indices) {
+    xQueueSend(freeBlocks, &index, 0);
+  }
+}
+
+bool UploadWriter::finish() {
+  if (!file) {
+    return false;
+  }
+  if (writerRunning) {
+    if (fillIndex >= 0 && fillLength > 0) {
+      submitFillBlock();
+    } else if (fillIndex >= 0) {
+      xQueueSend(freeBlocks, &fillIndex, 0);
+      fillIndex = -1;
+    }
+    waitForBlocks();
+  }
+  const bool ok = !failed;
+  stop();
+  return ok;
+}
+
+void UploadWriter::abort() {
+  if (!file) {
+    return;
+  }
+  failed = true;
+  if (writerRunning && fillIndex >= 0) {
+    xQueueSend(freeBlocks, &fillIndex, 0);
+    fillIndex = -1;
+  }
+  stop();
+}
+
+void UploadWriter::stop() {
+  if (writerRunning) {
+    // fullBlocks has room for one block more than there are buffers, so the stop request always fits
+    const Block stopBlock = {-1, 0};
+    xQueueSend(fullBlocks, &stopBlock, portMAX_DELAY);
+    xSemaphoreTake(stopped, portMAX_DELAY);
+    writerRunning = false;
+  }
+  if (freeBlocks) vQueueDelete(freeBlocks);
+  if (fullBlocks) vQueueDelete(fullBlocks);
+  if (stopped) vSemaphoreDelete(stopped);
+  freeBlocks = nullptr;
+  fullBlocks = nullptr;
+  stopped = nullptr;
+  for (auto& buffer : buffers) {
+    HeapTags::release(buffer);
+    buffer = nullptr;
+  }
+  fillIndex = -1;
+  fillLength = 0;
+  file = nullptr;
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <HalStorage.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Write-behind pipeline between the network and the SD card for uploads.
+ *
+ * The network side copies what it receives into one of a small ring of large buffers and hands full buffers to a
+ * writer task, which drains them to the file while the next one fills. Receiving and writing overlap instead of
+ * adding up. When every buffer is waiting for the card, write() blocks; the web server then stops reading the socket,
+ * so TCP flow control slows the sender down. getCommitted() reports what actually reached the card, for
+ * acknowledgements that should only count data that is safe.
+ *
+ * If the buffers can't be allocated, writes go straight to the file as before.
+ */
+class UploadWriter {
+ public:
+  static constexpr size_t BUFFER_COUNT = 2;
+  static constexpr size_t BUFFER_SIZE = 16 * 1024;
+
+  UploadWriter() = default;
+  ~UploadWriter() { abort(); }
+  UploadWriter(const UploadWriter&) = delete;
+  UploadWriter& operator=(const UploadWriter&) = delete;
+
+  // Starts writing behind to `file`, which must stay open until finish() or abort() returns
+  void begin(FsFile& file);
+  // Queues `data` for the file. Blocks while every buffer is waiting for the card. Returns false once a write failed.
+  bool write(const uint8_t* data, size_t length);
+  // Waits until everything queued is on the card and stops the writer. Returns false if any write failed.
+  bool finish();
+  // Stops the writer, dropping whatever wasn't written yet
+  void abort();
+
+  bool isActive() const { return file != nullptr; }
+  // Bytes written to the card so far
+  size_t getCommitted() const { return committed.load(); }
+  // Time spent in SD writes, and time the network side spent waiting for a free buffer
+  unsigned long getWriteTimeMs() const { return writeTimeMs.load(); }
+  unsigned long getStallTimeMs() const { return stallTimeMs; }
+
+ private:
+  struct Block {
+    int8_t index;  // -1 asks the writer to stop
+    uint32_t length;
+  };
+
+  FsFile* file = nullptr;
+  uint8_t* buffers[BUFFER_COUNT] = {};
+  QueueHandle_t freeBlocks = nullptr;  // indices of buffers the network side may fill
+  QueueHandle_t fullBlocks = nullptr;  // blocks waiting for the writer
+  SemaphoreHandle_t stopped = nullptr;  // given by the writer task on its way out
+  bool writerRunning = false;
+  int8_t fillIndex = -1;
+  uint32_t fillLength = 0;
+  std::atomic<bool> failed{false};
+  std::atomic<size_t> committed{0};
+  std::atomic<unsigned long> writeTimeMs{0};
+  unsigned long stallTimeMs = 0;
+
+  static void writerTrampoline(void* param);
+  void writerLoop();
+  void takeFreeBlock();
+  void submitFillBlock();
+  void waitForBlocks();
+  void stop();
+};
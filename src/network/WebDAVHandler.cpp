@@ -1,11 +1,15 @@
 #include "WebDAVHandler.h"
 
-#include <Epub.h>
+#include <BookCacheId.h>
 #include <FsHelpers.h>
 #include <HalStorage.h>
 #include <Logging.h>
 #include <esp_task_wdt.h>
 
+#include "HttpFileResponse.h"
+#include "LibraryCatalog.h"
+#include "ListingCache.h"
+#include "ThumbnailQueue.h"
 #include "util/StringUtils.h"
 
 namespace {
@@ -82,6 +86,7 @@ void WebDAVHandler::raw(WebServer& server, const String& uri, HTTPRaw& raw) {
     String tempPath = _putPath + ".davtmp";
     Storage.remove(tempPath.c_str());
     _putOk = Storage.openFileForWrite("DAV", tempPath, _putFile);
+    ListingCache::invalidateParent(_putPath.c_str());
     LOG_DBG("DAV", "PUT START: %s", _putPath.c_str());
 
   } else if (raw.status == RAW_WRITE) {
@@ -107,12 +112,14 @@ void WebDAVHandler::raw(WebServer& server, const String& uri, HTTPRaw& raw) {
       }
       if (!_putOk) Storage.remove(tempPath.c_str());
     }
+    ListingCache::invalidateParent(_putPath.c_str());
     LOG_DBG("DAV", "PUT END: %u bytes, ok=%d", raw.totalSize, _putOk);
 
   } else if (raw.status == RAW_ABORTED) {
     if (_putFile) _putFile.close();
     String tempPath = _putPath + ".davtmp";
     Storage.remove(tempPath.c_str());
+    ListingCache::invalidateParent(_putPath.c_str());
     _putOk = false;
   }
 }
@@ -193,7 +200,9 @@ void WebDAVHandler::handlePropfind(WebServer& s) {
       s.sendContent(
           "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
           "<D:multistatus xmlns:D=\"DAV:\">\n");
-      sendPropEntry(s, "/", true, 0, FIXED_DATE);
+      String xml;
+      appendPropEntry(xml, "/", true, 0, FIXED_DATE);
+      s.sendContent(xml);
       s.sendContent("</D:multistatus>\n");
       s.sendContent("");
       return;
@@ -203,75 +212,49 @@ void WebDAVHandler::handlePropfind(WebServer& s) {
   }
 
   bool isDir = root.isDirectory();
+  const size_t size = isDir ? 0 : root.size();
+  root.close();
 
   s.setContentLength(CONTENT_LENGTH_UNKNOWN);
   s.send(207, "application/xml; charset=\"utf-8\"", "");
-  s.sendContent(
-      "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
-      "<D:multistatus xmlns:D=\"DAV:\">\n");
-
-  // Entry for the resource itself
-  if (isDir) {
-    sendPropEntry(s, path, true, 0, FIXED_DATE);
-  } else {
-    sendPropEntry(s, path, false, root.size(), FIXED_DATE);
-    root.close();
-    s.sendContent("</D:multistatus>\n");
-    s.sendContent("");
-    return;
-  }
-
-  // If depth > 0 and it's a directory, list children
-  if (depth > 0) {
-    FsFile file = root.openNextFile();
-    char name[500];
-    while (file) {
-      file.getName(name, sizeof(name));
-      String fileName(name);
-
-      // Skip hidden/protected items
-      bool shouldHide = fileName.startsWith(".");
-      if (!shouldHide) {
-        for (size_t i = 0; i < HIDDEN_ITEMS_COUNT; i++) {
-          if (fileName.equals(HIDDEN_ITEMS[i])) {
-            shouldHide = true;
-            break;
-          }
-        }
-      }
-
-      if (!shouldHide) {
-        String childPath = path;
-        if (!childPath.endsWith("/")) childPath += "/";
-        childPath += fileName;
 
-        if (file.isDirectory()) {
-          sendPropEntry(s, childPath, true, 0, FIXED_DATE);
-        } else {
-          sendPropEntry(s, childPath, false, file.size(), FIXED_DATE);
-        }
-      }
-
-      file.close();
-      yield();
-      esp_task_wdt_reset();
-      file = root.openNextFile();
-    }
-  }
-
-  root.close();
-  s.sendContent("</D:multistatus>\n");
+  // Responses are batched into chunks of about 1KB rather than sent one chunk each
+  String xml =
+      "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+      "<D:multistatus xmlns:D=\"DAV:\">\n";
+  appendPropEntry(xml, path, isDir, size, FIXED_DATE);
+
+  // If depth > 0 and it's a directory, list children from the folder's snapshot
+  if (isDir && depth > 0) {
+    String childPath;
+    ListingCache::list(path.c_str(), ListingCache::Order::Directory, false, 0, SIZE_MAX,
+                       [&](const ListingCache::Entry& entry) {
+                         childPath = path;
+                         if (!childPath.endsWith("/")) childPath += "/";
+                         childPath += entry.name.c_str();
+                         appendPropEntry(xml, childPath, entry.isDirectory, entry.size, FIXED_DATE);
+                         if (xml.length() >= 1024) {
+                           s.sendContent(xml);
+                           xml = "";
+                           esp_task_wdt_reset();
+                         }
+                         return true;
+                       });
+  }
+
+  xml += "</D:multistatus>\n";
+  s.sendContent(xml);
   s.sendContent("");
 }
 
-void WebDAVHandler::sendPropEntry(WebServer& s, const String& path, bool isDir, size_t size,
-                                  const String& lastModified) const {
+void WebDAVHandler::appendPropEntry(String& xml, const String& path, bool isDir, size_t size,
+                                    const String& lastModified) const {
   String href;
   urlEncodePath(path, href);
   // Ensure directory hrefs end with /
   if (isDir && !href.endsWith("/")) href += "/";
 
-  String xml = "<D:response><D:href>";
+  xml += "<D:response><D:href>";
   xml += href;
   xml += "</D:href><D:propstat><D:prop>";
 
@@ -293,8 +276,6 @@ void WebDAVHandler::sendPropEntry(WebServer& s, const String& path, bool isDir,
   xml += "</D:getlastmodified>";
 
   xml += "</D:prop><D:status>HTTP/1.1 200 OK</D:status></D:propstat></D:response>\n";
-
-  s.sendContent(xml);
 }
 
 // ── GET ──────────────────────────────────────────────────────────────────────
@@ -326,11 +307,7 @@ void WebDAVHandler::handleGet(WebServer& s) {
   }
 
   String contentType = getMimeType(path);
-  s.setContentLength(file.size());
-  s.send(200, contentType.c_str(), "");
-
-  NetworkClient client = s.client();
-  client.write(file);
+  HttpFileResponse::send(s, file, contentType.c_str());
   file.close();
 }
 
@@ -362,9 +339,9 @@ void WebDAVHandler::handleHead(WebServer& s) {
     return;
   }
 
+  // Same headers as GET, including the ETag and Range handling
   String contentType = getMimeType(path);
-  s.setContentLength(file.size());
-  s.send(200, contentType.c_str(), "");
+  HttpFileResponse::send(s, file, contentType.c_str());
   file.close();
 }
 
@@ -383,11 +360,14 @@ void WebDAVHandler::handlePut(WebServer& s) {
   if (!_putOk) {
     String tempPath = path + ".davtmp";
     Storage.remove(tempPath.c_str());
+    ListingCache::invalidateParent(path.c_str());
     s.send(500, "text/plain", "Write failed - incomplete upload or disk full");
     return;
   }
 
-  clearEpubCacheIfNeeded(path);
+  releaseBookCache(path);
+  LIBRARY_CATALOG.onFileWritten(path.c_str());
+  THUMBNAILS.index(path.c_str());
   s.send(_putExisted ? 204 : 201);
   LOG_DBG("DAV", "PUT complete: %s", path.c_str());
 }
@@ -430,14 +410,19 @@ void WebDAVHandler::handleDelete(WebServer& s) {
     }
     file.close();
     if (Storage.rmdir(path.c_str())) {
+      LIBRARY_CATALOG.onRemoved(path.c_str());
+      ListingCache::invalidate(path.c_str());
+      ListingCache::invalidateParent(path.c_str());
       s.send(204);
     } else {
       s.send(500, "text/plain", "Failed to remove directory");
     }
   } else {
     file.close();
-    clearEpubCacheIfNeeded(path);
     if (Storage.remove(path.c_str())) {
+      releaseBookCache(path);
+      LIBRARY_CATALOG.onRemoved(path.c_str());
+      ListingCache::invalidateParent(path.c_str());
       s.send(204);
     } else {
       s.send(500, "text/plain", "Failed to delete file");
@@ -478,6 +463,7 @@ void WebDAVHandler::handleMkcol(WebServer& s) {
   }
 
   if (Storage.mkdir(path.c_str())) {
+    ListingCache::invalidateParent(path.c_str());
     s.send(201);
     LOG_DBG("DAV", "Created directory: %s", path.c_str());
   } else {
@@ -537,6 +523,7 @@ void WebDAVHandler::handleMove(WebServer& s) {
 
   if (dstExists) {
     Storage.remove(dstPath.c_str());
+    releaseBookCache(dstPath);
   }
 
   FsFile file = Storage.open(srcPath.c_str());
@@ -545,11 +532,22 @@ void WebDAVHandler::handleMove(WebServer& s) {
     return;
   }
 
-  clearEpubCacheIfNeeded(srcPath);
+  const bool movedFolder = file.isDirectory();
   bool success = file.rename(dstPath.c_str());
   file.close();
 
+  if (dstExists || success) {
+    if (movedFolder) {
+      // Snapshots of the folders below it are keyed by their old paths
+      ListingCache::clear();
+    } else {
+      ListingCache::invalidateParent(srcPath.c_str());
+      ListingCache::invalidateParent(dstPath.c_str());
+    }
+  }
   if (success) {
+    BookCacheId::onMoved(srcPath.c_str(), dstPath.c_str());
+    LIBRARY_CATALOG.onMoved(srcPath.c_str(), dstPath.c_str());
     s.send(dstExists ? 204 : 201);
   } else {
     s.send(500, "text/plain", "Move failed");
@@ -617,6 +615,7 @@ void WebDAVHandler::handleCopy(WebServer& s) {
 
   if (dstExists) {
     Storage.remove(dstPath.c_str());
+    releaseBookCache(dstPath);
   }
 
   FsFile dstFile;
@@ -642,8 +641,10 @@ void WebDAVHandler::handleCopy(WebServer& s) {
 
   srcFile.close();
   dstFile.close();
+  ListingCache::invalidateParent(dstPath.c_str());
 
   if (copyOk) {
+    LIBRARY_CATALOG.onFileWritten(dstPath.c_str());
     s.send(dstExists ? 204 : 201);
   } else {
     Storage.remove(dstPath.c_str());
@@ -800,11 +801,9 @@ bool WebDAVHandler::getOverwrite(WebServer& s) const {
   return true;  // Default is T
 }
 
-void WebDAVHandler::clearEpubCacheIfNeeded(const String& path) const {
-  if (StringUtils::checkFileExtension(path, ".epub")) {
-    Epub(path.c_str(), "/.crosspoint").clearCache();
-    LOG_DBG("DAV", "Cleared epub cache for: %s", path.c_str());
-  }
+// Book caches are keyed on content (see BookCacheId): a delete or overwrite releases the old content's cache
+void WebDAVHandler::releaseBookCache(const String& path) const {
+  BookCacheId::onRemoved(path.c_str(), "/.crosspoint");
 }
 
 String WebDAVHandler::getMimeType(const String& path) const {
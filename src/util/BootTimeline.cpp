@@ -0,0 +1,30 @@
+#include "BootTimeline.h"
+
+#include <Arduino.h>
+#include <Logging.h>
+
+namespace {
+BootTimeline::Phase phases[BootTimeline::MAX_PHASES];
+size_t phaseCount = 0;
+}  // namespace
+
+namespace BootTimeline {
+void mark(const char* phase) {
+  if (phaseCount < MAX_PHASES) {
+    phases[phaseCount++] = {phase, static_cast<uint32_t>(millis())};
+  }
+}
+
+size_t count() { return phaseCount; }
+
+const Phase& at(const size_t index) { return phases[index]; }
+
+void logSummary() {
+  uint32_t previous = 0;
+  for (size_t i = 0; i < phaseCount; i++) {
+    LOG_INF("BOOT", "%-16s %5lu ms (+%lu)", phases[i].name, static_cast<unsigned long>(phases[i].atMs),
+            static_cast<unsigned long>(phases[i].atMs - previous));
+    previous = phases[i].atMs;
+  }
+}
+}  // namespace BootTimeline
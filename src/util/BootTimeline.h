@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Milestones of the current boot, in the order setup() reached them.
+ *
+ * setup() marks the end of each phase (storage, settings, display, first frame, ...). The timeline is logged once
+ * boot is done, served in /api/status and logged again on the serial command CMD:BOOT, so a slow phase shows up
+ * without a debugger attached from power-on.
+ */
+namespace BootTimeline {
+struct Phase {
+  const char* name;  // A string literal
+  uint32_t atMs;     // millis() when the phase ended
+};
+
+constexpr size_t MAX_PHASES = 16;
+
+// Records that `phase` ended now; marks beyond MAX_PHASES are dropped
+void mark(const char* phase);
+size_t count();
+const Phase& at(size_t index);
+// Logs every phase with its own duration
+void logSummary();
+}  // namespace BootTimeline
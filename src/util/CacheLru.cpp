@@ -0,0 +1,110 @@
+#include "CacheLru.h"
+
+#include <HalStorage.h>
+#include <Logging.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace {
+constexpr uint8_t LRU_VERSION = 1;
+// Sanity bound for the count read back from an index
+constexpr uint16_t MAX_ITEMS = 256;
+
+bool readOrder(const std::string& path, std::vector<std::string>& order) {
+  FsFile file;
+  if (!Storage.exists(path.c_str()) || !Storage.openFileForRead("LRU", path, file)) {
+    return false;
+  }
+  uint8_t version = 0;
+  uint16_t count = 0;
+  bool ok = file.read(&version, sizeof(version)) == sizeof(version) && version == LRU_VERSION &&
+            file.read(&count, sizeof(count)) == sizeof(count) && count <= MAX_ITEMS;
+  for (uint16_t i = 0; ok && i < count; i++) {
+    uint8_t length = 0;
+    ok = file.read(&length, sizeof(length)) == sizeof(length);
+    std::string name(length, '\0');
+    ok = ok && (length == 0 || file.read(&name[0], length) == length);
+    order.push_back(std::move(name));
+  }
+  file.close();
+  if (!ok) {
+    order.clear();
+  }
+  return ok;
+}
+
+bool writeOrder(const std::string& path, const std::vector<std::string>& order) {
+  const std::string tmpPath = path + ".tmp";
+  FsFile file;
+  if (!Storage.openFileForWrite("LRU", tmpPath, file)) {
+    return false;
+  }
+  const uint16_t count = order.size();
+  bool ok = file.write(&LRU_VERSION, sizeof(LRU_VERSION)) == sizeof(LRU_VERSION) &&
+            file.write(&count, sizeof(count)) == sizeof(count);
+  for (const auto& name : order) {
+    const uint8_t length = std::min<size_t>(name.size(), UINT8_MAX);
+    ok = ok && file.write(&length, sizeof(length)) == sizeof(length) && file.write(name.data(), length) == length;
+  }
+  file.close();
+  if (Storage.exists(path.c_str())) {
+    Storage.remove(path.c_str());
+  }
+  if (!ok || !Storage.rename(tmpPath.c_str(), path.c_str())) {
+    Storage.remove(tmpPath.c_str());
+    return false;
+  }
+  return true;
+}
+
+// Items in `dir`: files ending in `suffix`, other than dot files
+void listItems(const char* dir, const char* suffix, std::vector<std::string>& items) {
+  auto folder = Storage.open(dir);
+  if (!folder || !folder.isDirectory()) {
+    if (folder) folder.close();
+    return;
+  }
+  const size_t suffixLength = strlen(suffix);
+  char name[64];
+  for (auto file = folder.openNextFile(); file; file = folder.openNextFile()) {
+    file.getName(name, sizeof(name));
+    file.close();
+    const size_t length = strlen(name);
+    if (name[0] != '.' && length > suffixLength && strcmp(name + length - suffixLength, suffix) == 0) {
+      items.emplace_back(name, length - suffixLength);
+    }
+  }
+  folder.close();
+}
+}  // namespace
+
+std::vector<std::string> CacheLru::touch(const char* dir, const char* suffix, const std::string& item,
+                                         const int keep) {
+  const std::string path = std::string(dir) + "/.lru";
+  std::vector<std::string> order;
+  const bool indexed = readOrder(path, order);
+  if (!indexed) {
+    LOG_DBG("LRU", "No use order in %s, listing the folder", dir);
+    listItems(dir, suffix, order);
+  }
+
+  const size_t limit = std::max(keep, 1);
+  std::vector<std::string> dropped;
+  // Reopening the item used last is the common case, and needs no write
+  if (indexed && !order.empty() && order.front() == item && order.size() <= limit) {
+    return dropped;
+  }
+  order.erase(std::remove(order.begin(), order.end(), item), order.end());
+  order.insert(order.begin(), item);
+  if (order.size() > limit) {
+    dropped.assign(order.begin() + limit, order.end());
+    order.resize(limit);
+  }
+
+  if (!writeOrder(path, order)) {
+    LOG_ERR("LRU", "Failed to write use order of %s", dir);
+  }
+  return dropped;
+}
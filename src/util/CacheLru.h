@@ -0,0 +1,20 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+/**
+ * Use order of the items in a cache folder, kept in <dir>/.lru.
+ *
+ * The device has no real-time clock, so file modified times can't tell which item was used last. The index lists item
+ * names, most recently used first: u8 version, u16 count, then u8 len + bytes each. It is rewritten through .lru.tmp.
+ * An item is named by its file name without `suffix` (e.g. "3f9c2a71" for 3f9c2a71.bin). If the index is missing,
+ * the items found in the folder are listed after the one being touched, so caches written before it still get evicted.
+ */
+namespace CacheLru {
+
+// Moves `item` to the front of the use order of `dir` and drops the order past `keep` items. Returns the dropped
+// names, whose files the caller removes.
+std::vector<std::string> touch(const char* dir, const char* suffix, const std::string& item, int keep);
+
+}  // namespace CacheLru
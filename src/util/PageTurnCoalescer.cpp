@@ -0,0 +1,58 @@
+#include "PageTurnCoalescer.h"
+
+PageTurnCoalescer::Landing PageTurnCoalescer::land(const int page, const int pageCount, const int delta,
+                                                   const bool isFirstChapter) {
+  const int target = page + delta;
+  if (target >= pageCount) {
+    return {1, 0};
+  }
+  if (target < 0) {
+    return isFirstChapter ? Landing{0, 0} : Landing{-1, LAST_PAGE};
+  }
+  return {0, target};
+}
+
+void PageTurnCoalescer::push(const int delta, const uint32_t nowMs) {
+  pendingDelta.fetch_add(delta);
+  // The first turn of a batch stamps the press time the latency is measured from
+  if (pendingTurns.fetch_add(1) == 0) {
+    firstPressMs.store(nowMs);
+  }
+}
+
+bool PageTurnCoalescer::take(int& delta) {
+  // A push racing with this call either lands fully in this batch or in the next one; at worst the next batch
+  // reports a slightly early press time. The delta itself is never lost.
+  const uint32_t turns = pendingTurns.exchange(0);
+  if (turns == 0) {
+    delta = 0;
+    return false;
+  }
+  batchPressMs = firstPressMs.load();
+  delta = pendingDelta.exchange(0);
+  batchInFlight = true;
+
+  stats.batches++;
+  stats.turns += turns;
+  return true;
+}
+
+void PageTurnCoalescer::onRefreshStart(const uint32_t nowMs) {
+  if (!batchInFlight) {
+    return;
+  }
+  batchInFlight = false;
+
+  const uint32_t latency = nowMs - batchPressMs;
+  stats.lastLatencyMs = latency;
+  if (latency > stats.maxLatencyMs) {
+    stats.maxLatencyMs = latency;
+  }
+  stats.totalLatencyMs += latency;
+  stats.latencySamples++;
+}
+
+void PageTurnCoalescer::clear() {
+  pendingTurns.store(0);
+  pendingDelta.store(0);
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * Collects page turns between the input loop and the render task.
+ *
+ * The input loop pushes every page turn as it happens. The render task takes the accumulated delta once, when it
+ * starts rendering, so presses that arrive while a page is still being rendered or refreshed collapse into a single
+ * jump to the final target page instead of drawing every intermediate page.
+ *
+ * Times are passed in by the caller (millis() on device), which lets host tests drive it with a simulated clock.
+ */
+class PageTurnCoalescer final {
+ public:
+  struct Stats {
+    uint32_t batches = 0;         // renders that consumed at least one page turn
+    uint32_t turns = 0;           // page turns consumed in total
+    uint32_t lastLatencyMs = 0;   // press-to-refresh-start of the latest batch
+    uint32_t maxLatencyMs = 0;
+    uint64_t totalLatencyMs = 0;  // over latencySamples
+    uint32_t latencySamples = 0;
+
+    uint32_t averageLatencyMs() const {
+      return latencySamples > 0 ? static_cast<uint32_t>(totalLatencyMs / latencySamples) : 0;
+    }
+    // Page turns that were folded into another turn's render instead of getting their own
+    uint32_t coalescedTurns() const { return turns > batches ? turns - batches : 0; }
+  };
+
+  // Where a net `delta` of page turns from `page` of a `pageCount`-page chapter lands
+  struct Landing {
+    int chapterStep;  // -1, 0 or +1
+    int page;         // Page in that chapter, or LAST_PAGE
+  };
+  // Last page of a chapter whose page count isn't known until it is laid out
+  static constexpr int LAST_PAGE = UINT16_MAX;
+  // Turns past the chapter end stop at the start of the next chapter, and turns before its start at the end of the
+  // previous one; the first chapter stops at its first page.
+  static Landing land(int page, int pageCount, int delta, bool isFirstChapter);
+
+  // Input loop: queue a page turn (+1 forward, -1 back) pressed at `nowMs`
+  void push(int delta, uint32_t nowMs);
+
+  // Render task: take every page turn queued since the last call. Returns false if there was none. The net `delta`
+  // can be 0 when turns cancel each other out.
+  bool take(int& delta);
+
+  // Whether page turns are waiting for the render task
+  bool hasPending() const { return pendingTurns.load() != 0; }
+
+  // Render task: the display refresh for the taken batch is starting. Records the press-to-refresh latency.
+  void onRefreshStart(uint32_t nowMs);
+
+  // Input loop: drop queued page turns, e.g. when the reader jumps elsewhere or opens a menu
+  void clear();
+
+  const Stats& getStats() const { return stats; }
+
+ private:
+  // Shared between the input loop and the render task
+  std::atomic<int> pendingDelta{0};
+  std::atomic<uint32_t> pendingTurns{0};
+  std::atomic<uint32_t> firstPressMs{0};
+
+  // Render task only
+  bool batchInFlight = false;
+  uint32_t batchPressMs = 0;
+  Stats stats;
+};
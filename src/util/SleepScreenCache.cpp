@@ -0,0 +1,158 @@
+#include "SleepScreenCache.h"
+
+#include <Fnv1a.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <cstdio>
+#include <cstring>
+
+#include "CacheLru.h"
+#include "CrossPointSettings.h"
+
+namespace {
+constexpr char SLEEP_SCREENS_DIR[] = "/.crosspoint/sleep_screens";
+constexpr uint8_t SLEEP_SCREEN_VERSION = 1;
+// Sanity bound for the key read back from a file
+constexpr uint32_t MAX_KEY_LENGTH = 600;
+
+std::string screenPath(const std::string& key) {
+  // The key is stored inside to catch collisions
+  char name[16];
+  snprintf(name, sizeof(name), "/%08x.bin", static_cast<unsigned>(fnv1a32(key)));
+  return std::string(SLEEP_SCREENS_DIR) + name;
+}
+
+bool readPlane(FsFile& file, uint8_t* frameBuffer) {
+  const size_t bufferSize = GfxRenderer::getBufferSize();
+  return file.read(frameBuffer, bufferSize) == static_cast<int>(bufferSize);
+}
+
+// Marks the screen at `path` as used last and drops the screens used longest ago beyond `keep`
+void touchScreen(const std::string& path, const int keep) {
+  const size_t nameStart = sizeof(SLEEP_SCREENS_DIR);
+  const std::string name = path.substr(nameStart, path.size() - nameStart - strlen(".bin"));
+  for (const auto& dropped : CacheLru::touch(SLEEP_SCREENS_DIR, ".bin", name, keep)) {
+    const std::string droppedPath = std::string(SLEEP_SCREENS_DIR) + "/" + dropped + ".bin";
+    if (Storage.exists(droppedPath.c_str())) {
+      LOG_DBG("SSC", "Dropping cached sleep screen %s", droppedPath.c_str());
+      Storage.remove(droppedPath.c_str());
+    }
+  }
+}
+}  // namespace
+
+SleepScreenCache::Recorder::Recorder(const std::string& key, const uint8_t planeCount) : path(screenPath(key)) {
+  if (key.empty()) {
+    return;
+  }
+  Storage.mkdir(SLEEP_SCREENS_DIR);
+  if (!Storage.openFileForWrite("SSC", path + ".tmp", file)) {
+    return;
+  }
+  serialization::writePod(file, SLEEP_SCREEN_VERSION);
+  serialization::writeString(file, key);
+  serialization::writePod(file, planeCount);
+  ok = true;
+}
+
+SleepScreenCache::Recorder::~Recorder() {
+  if (file) {
+    file.close();
+    Storage.remove((path + ".tmp").c_str());
+  }
+}
+
+void SleepScreenCache::Recorder::addPlane(const GfxRenderer& renderer) {
+  if (!ok) {
+    return;
+  }
+  const size_t bufferSize = GfxRenderer::getBufferSize();
+  ok = file.write(renderer.getFrameBuffer(), bufferSize) == bufferSize;
+}
+
+void SleepScreenCache::Recorder::commit() {
+  if (!file) {
+    return;
+  }
+  file.close();
+  const std::string tmpPath = path + ".tmp";
+  if (!ok) {
+    LOG_ERR("SSC", "Failed to record sleep screen");
+    Storage.remove(tmpPath.c_str());
+    return;
+  }
+  Storage.remove(path.c_str());
+  if (Storage.rename(tmpPath.c_str(), path.c_str())) {
+    touchScreen(path, MAX_SCREENS);
+  }
+}
+
+std::string SleepScreenCache::keyFor(const GfxRenderer& renderer, const std::string& imagePath) {
+  FsFile file;
+  if (!Storage.openFileForRead("SSC", imagePath, file)) {
+    return "";
+  }
+  const uint32_t size = file.fileSize();
+  uint16_t date = 0, time = 0;
+  file.getModifyDateTime(&date, &time);
+  file.close();
+
+  char settings[64];
+  snprintf(settings, sizeof(settings), "|%u|%u|%u|%u|%d", static_cast<unsigned>(size),
+           static_cast<unsigned>(date) << 16 | time, SETTINGS.sleepScreenCoverMode, SETTINGS.sleepScreenCoverFilter,
+           static_cast<int>(renderer.getOrientation()));
+  return imagePath + settings;
+}
+
+bool SleepScreenCache::show(const GfxRenderer& renderer, const std::string& key) {
+  if (key.empty()) {
+    return false;
+  }
+  const std::string path = screenPath(key);
+  FsFile file;
+  if (!Storage.exists(path.c_str()) || !Storage.openFileForRead("SSC", path, file)) {
+    return false;
+  }
+
+  uint8_t version = 0;
+  uint32_t keyLength = 0;
+  serialization::readPod(file, version);
+  serialization::readPod(file, keyLength);
+  if (version != SLEEP_SCREEN_VERSION || keyLength != key.size() || keyLength > MAX_KEY_LENGTH) {
+    file.close();
+    return false;
+  }
+  std::string storedKey(keyLength, '\0');
+  file.read(&storedKey[0], keyLength);
+  uint8_t planeCount = 0;
+  serialization::readPod(file, planeCount);
+  if (storedKey != key || (planeCount != 1 && planeCount != 3)) {
+    file.close();
+    return false;
+  }
+
+  uint8_t* frameBuffer = renderer.getFrameBuffer();
+  if (!readPlane(file, frameBuffer)) {
+    LOG_ERR("SSC", "Cached sleep screen is truncated");
+    file.close();
+    Storage.remove(path.c_str());
+    return false;
+  }
+  LOG_DBG("SSC", "Showing cached sleep screen %s", path.c_str());
+  touchScreen(path, MAX_SCREENS);
+  renderer.displayBuffer(HalDisplay::HALF_REFRESH);
+
+  // The grayscale planes go straight to the display, as SleepActivity does after drawing each of them
+  if (planeCount == 3) {
+    if (readPlane(file, frameBuffer)) {
+      renderer.copyGrayscaleLsbBuffers();
+      if (readPlane(file, frameBuffer)) {
+        renderer.copyGrayscaleMsbBuffers();
+        renderer.displayGrayBuffer();
+      }
+    }
+  }
+  file.close();
+  return true;
+}
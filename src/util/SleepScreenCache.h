@@ -0,0 +1,43 @@
+#pragma once
+#include <GfxRenderer.h>
+#include <HalStorage.h>
+
+#include <string>
+
+/**
+ * Composed sleep screens, kept as raw frame buffer planes in /.crosspoint/sleep_screens/.
+ *
+ * Composing a bitmap sleep screen decodes, scales and dithers the image once per plane (BW, then the grayscale LSB and
+ * MSB planes) right before deep sleep. The first sleep on an image records the planes as they are handed to the
+ * display; later sleeps on the same image load them back and refresh. A screen is keyed by the image (path, size and
+ * modified time), the cover mode, the filter and the orientation, as any of them changes the composed planes.
+ */
+class SleepScreenCache {
+ public:
+  // Number of composed screens kept; the one shown longest ago is dropped beyond that (see CacheLru)
+  static constexpr int MAX_SCREENS = 8;
+
+  // Records the planes of a screen being composed. Nothing reaches the cache unless commit() succeeds.
+  class Recorder {
+    FsFile file;
+    std::string path;
+    bool ok = false;
+
+   public:
+    Recorder(const std::string& key, uint8_t planeCount);
+    ~Recorder();
+    Recorder(const Recorder&) = delete;
+    Recorder& operator=(const Recorder&) = delete;
+
+    // Appends the frame buffer as the next plane
+    void addPlane(const GfxRenderer& renderer);
+    void commit();
+  };
+
+  // Key of the sleep screen composed from the image at `imagePath` with the current settings. Empty if the image
+  // can't be opened.
+  static std::string keyFor(const GfxRenderer& renderer, const std::string& imagePath);
+
+  // Shows the cached screen for `key` the way SleepActivity would have composed it. Returns false if there is none.
+  static bool show(const GfxRenderer& renderer, const std::string& key);
+};
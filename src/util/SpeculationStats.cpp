@@ -0,0 +1,23 @@
+#include "SpeculationStats.h"
+
+#include <Logging.h>
+
+namespace {
+uint32_t hitCount = 0;
+uint32_t missCount = 0;
+}  // namespace
+
+namespace SpeculationStats {
+void recordHit() { hitCount++; }
+
+void recordMiss() { missCount++; }
+
+uint32_t hits() { return hitCount; }
+
+uint32_t misses() { return missCount; }
+
+void logSummary() {
+  LOG_INF("ERS", "Pre-rendered pages: %lu shown, %lu discarded", static_cast<unsigned long>(hitCount),
+          static_cast<unsigned long>(missCount));
+}
+}  // namespace SpeculationStats
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * How often the reader's pre-rendered next page was the page asked for, counted since boot.
+ *
+ * EpubReaderActivity counts a hit when it shows a pre-rendered page and a miss when it has to discard one. The counts
+ * outlive the reader, are served in /api/status and logged on the serial command CMD:HEAP, since every speculation
+ * holds a spare frame or more of heap while it waits.
+ */
+namespace SpeculationStats {
+void recordHit();
+void recordMiss();
+uint32_t hits();
+uint32_t misses();
+// Logs the hit rate so far
+void logSummary();
+}  // namespace SpeculationStats
@@ -0,0 +1,112 @@
+#include "WakeFrame.h"
+
+#include <Fnv1a.h>
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+namespace {
+constexpr char WAKE_FRAME_FILE[] = "/.crosspoint/wake_frame.bin";
+constexpr uint8_t WAKE_FRAME_VERSION = 1;
+// Sanity bound for the book path read back from the file
+constexpr uint32_t MAX_PATH_LENGTH = 512;
+// Bytes copied out of a spare frame at a time
+constexpr size_t SPARE_COPY_SIZE = 1024;
+}  // namespace
+
+// While the reader has its next page pre-rendered (EpubReaderActivity::speculateNextPage), the frame buffer holds that
+// page and the one on the panel waits in the SPARE_DISPLAYED spare frame; that is the one to wake up to.
+bool WakeFrame::save(const GfxRenderer& renderer, const std::string& bookPath) {
+  const uint8_t* frameBuffer = renderer.getFrameBuffer();
+  if (!frameBuffer) {
+    return false;
+  }
+  const bool nextPagePreRendered = renderer.hasSpareFrame(GfxRenderer::SPARE_DISPLAYED);
+  const uint32_t bufferSize = GfxRenderer::getBufferSize();
+  uint8_t copy[SPARE_COPY_SIZE];
+  // The displayed page in pieces of at most SPARE_COPY_SIZE bytes, or all at once from the frame buffer
+  auto displayed = [&](const size_t offset, const size_t length) -> const uint8_t* {
+    if (!nextPagePreRendered) {
+      return frameBuffer + offset;
+    }
+    renderer.readSpareFrame(GfxRenderer::SPARE_DISPLAYED, offset, copy, length);
+    return copy;
+  };
+  const size_t pieceSize = nextPagePreRendered ? SPARE_COPY_SIZE : bufferSize;
+
+  uint32_t checksum = FNV1A32_OFFSET_BASIS;
+  for (size_t offset = 0; offset < bufferSize; offset += pieceSize) {
+    const size_t length = std::min<size_t>(pieceSize, bufferSize - offset);
+    checksum = fnv1a32(displayed(offset, length), length, checksum);
+  }
+
+  const unsigned long start = millis();
+  FsFile file;
+  if (!Storage.openFileForWrite("WAKE", WAKE_FRAME_FILE, file)) {
+    return false;
+  }
+  serialization::writePod(file, WAKE_FRAME_VERSION);
+  serialization::writeString(file, bookPath);
+  serialization::writePod(file, bufferSize);
+  serialization::writePod(file, checksum);
+  bool written = true;
+  for (size_t offset = 0; offset < bufferSize && written; offset += pieceSize) {
+    const size_t length = std::min<size_t>(pieceSize, bufferSize - offset);
+    written = file.write(displayed(offset, length), length) == length;
+  }
+  file.close();
+
+  if (!written) {
+    LOG_ERR("WAKE", "Failed to write wake frame");
+    discard();
+    return false;
+  }
+  LOG_DBG("WAKE", "Saved wake frame in %lu ms", millis() - start);
+  return true;
+}
+
+bool WakeFrame::show(GfxRenderer& renderer, const std::string& bookPath) {
+  uint8_t* frameBuffer = renderer.getFrameBuffer();
+  FsFile file;
+  if (!frameBuffer || !Storage.exists(WAKE_FRAME_FILE) || !Storage.openFileForRead("WAKE", WAKE_FRAME_FILE, file)) {
+    return false;
+  }
+
+  uint8_t version = 0;
+  uint32_t pathLength = 0;
+  serialization::readPod(file, version);
+  serialization::readPod(file, pathLength);
+  if (version != WAKE_FRAME_VERSION || pathLength > MAX_PATH_LENGTH) {
+    file.close();
+    return false;
+  }
+  std::string path(pathLength, '\0');
+  file.read(reinterpret_cast<uint8_t*>(&path[0]), pathLength);
+  uint32_t bufferSize = 0;
+  uint32_t checksum = 0;
+  serialization::readPod(file, bufferSize);
+  serialization::readPod(file, checksum);
+  if (path != bookPath || bufferSize != GfxRenderer::getBufferSize()) {
+    file.close();
+    return false;
+  }
+
+  const bool read = file.read(frameBuffer, bufferSize) == static_cast<int>(bufferSize);
+  file.close();
+  // A short or damaged read must not reach the panel
+  if (!read || GfxRenderer::frameChecksum(frameBuffer) != checksum) {
+    LOG_ERR("WAKE", "Wake frame is damaged, ignoring it");
+    renderer.clearScreen();
+    return false;
+  }
+
+  renderer.displayBuffer(HalDisplay::FAST_REFRESH);
+  renderer.setPresentedFrame(checksum);
+  return true;
+}
+
+void WakeFrame::discard() {
+  if (Storage.exists(WAKE_FRAME_FILE)) {
+    Storage.remove(WAKE_FRAME_FILE);
+  }
+}
@@ -0,0 +1,22 @@
+#pragma once
+#include <GfxRenderer.h>
+
+#include <string>
+
+/**
+ * The reader page the device went to sleep on, kept in /.crosspoint/wake_frame.bin.
+ *
+ * Waking into the reader means loading the book, its CSS and section caches and laying the page out again before
+ * anything shows up. The BW frame buffer is saved just before the sleep screen replaces it, and boot puts it back on
+ * the panel straight away while the reader loads behind it. The reader's first real frame only refreshes the panel if
+ * it differs from the restored one.
+ */
+class WakeFrame {
+ public:
+  // Saves the page on the panel as the wake frame of `bookPath`: the frame buffer, or the SPARE_DISPLAYED spare frame
+  // while the next page is pre-rendered into the buffer. Call before the sleep screen replaces them.
+  static bool save(const GfxRenderer& renderer, const std::string& bookPath);
+  // Shows the wake frame if it was saved for `bookPath`. Returns false (leaving the panel alone) otherwise.
+  static bool show(GfxRenderer& renderer, const std::string& bookPath);
+  static void discard();
+};
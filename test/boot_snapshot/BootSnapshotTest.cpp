@@ -0,0 +1,211 @@
+#include <HalStorage.h>
+#include <sys/time.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "src/BootSnapshot.h"
+#include "src/CrossPointSettings.h"
+#include "src/CrossPointState.h"
+#include "src/RecentBooksStore.h"
+
+// The stores' singletons; their JSON and migration code is not built here
+CrossPointSettings CrossPointSettings::instance;
+CrossPointState CrossPointState::instance;
+RecentBooksStore RecentBooksStore::instance;
+
+// Checks that the boot snapshot only ever stands in for JSON that has not changed since it was taken: parts come back
+// exactly as saved, a JSON file edited afterwards (new size, or new bytes under the same size and timestamp) is loaded
+// from JSON again, and a torn or foreign snapshot is ignored. A restore must take one read of the snapshot plus one
+// read of each JSON file.
+namespace {
+namespace fs = std::filesystem;
+
+int failures = 0;
+
+void check(const bool condition, const std::string& what) {
+  if (!condition) {
+    std::cerr << "FAIL " << what << std::endl;
+    failures++;
+  }
+}
+
+std::string card;
+
+void writeCardFile(const char* path, const std::string& content) {
+  std::ofstream(Storage.local(path), std::ios::binary) << content;
+}
+
+// Sets a file's modification time, as an edit or a copy on a computer would
+void touch(const char* path, const time_t seconds) {
+  const timeval times[2] = {{seconds, 0}, {seconds, 0}};
+  utimes(Storage.local(path).c_str(), times);
+}
+
+void fillStores() {
+  CrossPointSettings& settings = SETTINGS;
+  settings.fontFamily = CrossPointSettings::NOTOSANS;
+  settings.fontSize = CrossPointSettings::LARGE;
+  settings.orientation = CrossPointSettings::LANDSCAPE_CW;
+  settings.screenMargin = 25;
+  settings.statusBarProgressBarThickness = CrossPointSettings::PROGRESS_BAR_THICK;
+  strcpy(settings.opdsServerUrl, "https://books.example.org/opds");
+  strcpy(settings.opdsUsername, "reader");
+  strcpy(settings.opdsPassword, "p4ss word");
+
+  APP_STATE.openEpubPath = "/Books/Some Book.epub";
+  APP_STATE.lastSleepImage = 3;
+  APP_STATE.readerActivityLoadCount = 0;
+  APP_STATE.lastSleepFromReader = true;
+
+  RECENT_BOOKS.addBook("/Books/Second.epub", "Second", "B. Author", "/.crosspoint/epub_2/thumb.bmp");
+  RECENT_BOOKS.addBook("/Books/Some Book.epub", "Some Book", "A. Author", "");
+}
+
+void clearStores() {
+  CrossPointSettings& settings = SETTINGS;
+  settings.fontFamily = CrossPointSettings::BOOKERLY;
+  settings.fontSize = CrossPointSettings::MEDIUM;
+  settings.orientation = CrossPointSettings::PORTRAIT;
+  settings.screenMargin = 5;
+  settings.statusBarProgressBarThickness = CrossPointSettings::PROGRESS_BAR_NORMAL;
+  settings.opdsServerUrl[0] = settings.opdsUsername[0] = settings.opdsPassword[0] = '\0';
+  APP_STATE.openEpubPath.clear();
+  APP_STATE.lastSleepImage = 0;
+  APP_STATE.lastSleepFromReader = false;
+  while (RECENT_BOOKS.getCount() > 0) {
+    RECENT_BOOKS.removeBook(RECENT_BOOKS.getBooks().front().path);
+  }
+}
+
+bool settingsRestored() {
+  const CrossPointSettings& settings = SETTINGS;
+  return settings.fontFamily == CrossPointSettings::NOTOSANS && settings.fontSize == CrossPointSettings::LARGE &&
+         settings.orientation == CrossPointSettings::LANDSCAPE_CW && settings.screenMargin == 25 &&
+         settings.statusBarProgressBarThickness == CrossPointSettings::PROGRESS_BAR_THICK &&
+         strcmp(settings.opdsServerUrl, "https://books.example.org/opds") == 0 &&
+         strcmp(settings.opdsUsername, "reader") == 0 && strcmp(settings.opdsPassword, "p4ss word") == 0;
+}
+
+bool stateRestored() {
+  return APP_STATE.openEpubPath == "/Books/Some Book.epub" && APP_STATE.lastSleepImage == 3 &&
+         APP_STATE.lastSleepFromReader;
+}
+
+bool recentBooksRestored() {
+  const auto& books = RECENT_BOOKS.getBooks();
+  return books.size() == 2 && books[0].path == "/Books/Some Book.epub" && books[0].author == "A. Author" &&
+         books[1].title == "Second" && books[1].coverBmpPath == "/.crosspoint/epub_2/thumb.bmp";
+}
+
+std::string readCardFile(const char* path) {
+  std::ifstream in(Storage.local(path), std::ios::binary);
+  return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+}
+
+}  // namespace
+
+// Stand-ins for the parts of RecentBooksStore.cpp the test uses, which on the device also save to JSON
+void RecentBooksStore::addBook(const std::string& path, const std::string& title, const std::string& author,
+                               const std::string& coverBmpPath) {
+  recentBooks.insert(recentBooks.begin(), {path, title, author, coverBmpPath});
+}
+
+void RecentBooksStore::removeBook(const std::string& path) {
+  std::erase_if(recentBooks, [&](const RecentBook& book) { return book.path == path; });
+}
+
+int main(const int argc, char** argv) {
+  card = argc > 0 ? std::string(argv[0]) + ".card" : "card";
+  fs::remove_all(card);
+  fs::create_directories(card + "/.crosspoint");
+  Storage.root = card;
+
+  writeCardFile(CrossPointSettings::JSON_FILE, R"({"fontFamily":1,"fontSize":2})");
+  writeCardFile(CrossPointState::JSON_FILE, R"({"openEpubPath":"/Books/Some Book.epub"})");
+  writeCardFile(RecentBooksStore::JSON_FILE, R"({"books":[]})");
+  fillStores();
+
+  // Nothing is written for stores that are still loading
+  BootSnapshot::save();
+  check(!Storage.exists("/.crosspoint/boot.bin"), "save before boot completes is ignored");
+  check(BootSnapshot::load() == 0, "no snapshot, nothing restored");
+
+  BootSnapshot::bootComplete(0);
+  check(Storage.exists("/.crosspoint/boot.bin"), "boot from JSON writes the snapshot");
+  const std::string snapshot = readCardFile("/.crosspoint/boot.bin");
+  check(snapshot.find("p4ss word") == std::string::npos, "password is not stored in the clear");
+
+  clearStores();
+  Storage.opens = 0;
+  check(BootSnapshot::load() == BootSnapshot::ALL_PARTS, "unchanged JSON restores every part");
+  check(Storage.opens == 4, "one snapshot read and three JSON reads, got " + std::to_string(Storage.opens));
+  check(settingsRestored(), "settings restored");
+  check(stateRestored(), "state restored");
+  check(recentBooksRestored(), "recent books restored");
+
+  // state.json edited: new size
+  clearStores();
+  writeCardFile(CrossPointState::JSON_FILE, R"({"openEpubPath":""})");
+  check(BootSnapshot::load() == (BootSnapshot::PART_SETTINGS | BootSnapshot::PART_RECENT_BOOKS),
+        "state with a new size is loaded from JSON");
+  check(APP_STATE.openEpubPath.empty() && settingsRestored() && recentBooksRestored(), "only fresh parts restored");
+
+  // settings.json only touched: same bytes, new time
+  fillStores();
+  touch(CrossPointSettings::JSON_FILE, 1700000000);
+  BootSnapshot::save();
+  clearStores();
+  touch(CrossPointSettings::JSON_FILE, 1700000100);
+  check(BootSnapshot::load() == BootSnapshot::ALL_PARTS, "settings with only a new modification time are restored");
+
+  // settings.json edited within the timestamp's resolution: same size, same time, new bytes
+  fillStores();
+  touch(CrossPointSettings::JSON_FILE, 1700000000);
+  BootSnapshot::save();
+  clearStores();
+  writeCardFile(CrossPointSettings::JSON_FILE, R"({"fontFamily":2,"fontSize":2})");
+  touch(CrossPointSettings::JSON_FILE, 1700000000);
+  check(BootSnapshot::load() == (BootSnapshot::PART_STATE | BootSnapshot::PART_RECENT_BOOKS),
+        "settings with new bytes under the same size and time are loaded from JSON");
+  check(SETTINGS.fontFamily == CrossPointSettings::BOOKERLY, "stale settings left alone");
+
+  // recent.json removed
+  fillStores();
+  BootSnapshot::save();
+  fs::remove(Storage.local(RecentBooksStore::JSON_FILE));
+  BootSnapshot::save();
+  clearStores();
+  check(BootSnapshot::load() == (BootSnapshot::PART_SETTINGS | BootSnapshot::PART_STATE),
+        "a part without its JSON file is not saved");
+  writeCardFile(RecentBooksStore::JSON_FILE, R"({"books":[]})");
+
+  // Torn and foreign snapshots
+  fillStores();
+  BootSnapshot::save();
+  const std::string good = readCardFile("/.crosspoint/boot.bin");
+  for (const size_t length : {size_t{0}, size_t{5}, good.size() / 2, good.size() - 1}) {
+    writeCardFile("/.crosspoint/boot.bin", good.substr(0, length));
+    check(BootSnapshot::load() == 0, "snapshot cut to " + std::to_string(length) + " bytes is ignored");
+  }
+  for (const size_t offset : {size_t{0}, size_t{4}, size_t{12}, good.size() - 3}) {
+    std::string corrupt = good;
+    corrupt[offset] = static_cast<char>(corrupt[offset] ^ 0x40);
+    writeCardFile("/.crosspoint/boot.bin", corrupt);
+    check(BootSnapshot::load() == 0, "snapshot with byte " + std::to_string(offset) + " flipped is ignored");
+  }
+  writeCardFile("/.crosspoint/boot.bin", good);
+  check(BootSnapshot::load() == BootSnapshot::ALL_PARTS, "intact snapshot restores again");
+
+  std::cout << "snapshot: " << good.size() << " bytes" << std::endl;
+  fs::remove_all(card);
+  if (failures) {
+    std::cerr << failures << " check(s) failed" << std::endl;
+    return 1;
+  }
+  std::cout << "All checks passed" << std::endl;
+  return 0;
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Host stand-in for lib/Serialization/ObfuscationUtils.h: a fixed key in place of the device's MAC
+namespace obfuscation {
+inline void xorTransform(std::string& data) {
+  constexpr uint8_t key[] = {0x10, 0x32, 0x54, 0x76, 0x98, 0xBA};
+  for (size_t i = 0; i < data.size(); i++) {
+    data[i] = static_cast<char>(data[i] ^ key[i % sizeof(key)]);
+  }
+}
+}  // namespace obfuscation
@@ -0,0 +1,192 @@
+#include <BufferedFile.h>
+#include <Epub/Page.h>
+#include <HalStorage.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Counts storage lock takes for a page load through Page::serialize/Page::deserialize at several BufferedReader and
+// BufferedWriter block sizes, and checks that every size writes the same bytes and reads the page back intact. A block
+// of one byte passes every call straight to the file, which is what a page load cost before the buffering. HalFile is
+// test/host's local file, which counts the lock the real one takes around each call.
+namespace {
+namespace fs = std::filesystem;
+
+constexpr char PAGE_FILE[] = "/page.bin";
+
+Page makePage(const int lineCount, const int wordsPerLine) {
+  static const char* const vocabulary[] = {"the", "reader", "turned", "another", "page", "and", "paused,",
+                                           "listening", "for", "rain", "against", "window"};
+  Page page;
+  BlockStyle style;
+  style.marginLeft = 4;
+  style.textIndent = 18;
+  style.textIndentDefined = true;
+  for (int l = 0; l < lineCount; l++) {
+    std::vector<std::string> words;
+    std::vector<uint16_t> wordXpos;
+    std::vector<EpdFontFamily::Style> wordStyles;
+    uint16_t x = 0;
+    for (int w = 0; w < wordsPerLine; w++) {
+      const std::string word = vocabulary[(l * 7 + w) % 12];
+      words.push_back(word);
+      wordXpos.push_back(x);
+      wordStyles.push_back(w % 3 == 0 ? EpdFontFamily::BOLD : EpdFontFamily::REGULAR);
+      x += static_cast<uint16_t>(word.size() * 11 + 6);
+    }
+    auto block = std::make_shared<TextBlock>(std::move(words), std::move(wordXpos), std::move(wordStyles), style);
+    page.elements.push_back(std::make_shared<PageLine>(std::move(block), 0, static_cast<int16_t>(l * 24)));
+  }
+  page.addFootnote("1", "notes.xhtml#n1");
+  return page;
+}
+
+bool samePage(const Page& a, const Page& b) {
+  if (a.elements.size() != b.elements.size() || a.footnotes.size() != b.footnotes.size()) return false;
+  for (size_t i = 0; i < a.elements.size(); i++) {
+    const auto* x = static_cast<const PageLine*>(a.elements[i].get());
+    const auto* y = static_cast<const PageLine*>(b.elements[i].get());
+    if (y->getTag() != TAG_PageLine || x->xPos != y->xPos || x->yPos != y->yPos ||
+        x->getBlock()->getWords() != y->getBlock()->getWords() ||
+        x->getBlock()->getBlockStyle().textIndent != y->getBlock()->getBlockStyle().textIndent) {
+      return false;
+    }
+  }
+  for (size_t i = 0; i < a.footnotes.size(); i++) {
+    if (std::string(a.footnotes[i].href) != b.footnotes[i].href) return false;
+  }
+  return true;
+}
+
+std::string readCardFile(const char* path) {
+  std::ifstream in(Storage.local(path), std::ios::binary);
+  return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+}
+
+int failures = 0;
+
+void expect(const bool condition, const std::string& what) {
+  if (!condition) {
+    std::cerr << "FAIL " << what << std::endl;
+    failures++;
+  }
+}
+
+// Reads and seeks that cross block boundaries, skip the buffer or run past the end of the file
+void checkReaderEdgeCases() {
+  {
+    std::ofstream out(Storage.local("/edge.bin"), std::ios::binary);
+    for (int i = 0; i < 1000; i++) {
+      out.put(static_cast<char>(i * 31));
+    }
+  }
+  HalFile file;
+  expect(Storage.openFileForRead("BFB", "/edge.bin", file), "open edge case file");
+
+  BufferedReader reader(file, 64);
+  uint8_t buf[300];
+  expect(reader.read(buf, 10) == 10 && buf[9] == static_cast<uint8_t>(9 * 31), "small read");
+  expect(reader.read(buf, 100) == 100 && buf[99] == static_cast<uint8_t>(109 * 31), "read across blocks");
+  expect(reader.position() == 110, "position after reads");
+  expect(reader.seek(100) && reader.read() == static_cast<uint8_t>(100 * 31), "seek back within block");
+  expect(reader.seek(900) && reader.read() == static_cast<uint8_t>(900 * 31), "seek outside block");
+  expect(reader.read(buf, 300) == 99, "short read at end of file");
+  expect(reader.read() == -1, "read past end of file");
+  expect(reader.seek(0) && reader.read(buf, 200) == 200 && buf[199] == static_cast<uint8_t>(199 * 31),
+         "large read skipping the buffer");
+}
+
+void checkWriterEdgeCases() {
+  HalFile file;
+  expect(Storage.openFileForWrite("BFB", "/edge.bin", file), "create edge case file");
+  {
+    BufferedWriter writer(file, 64);
+    std::vector<uint8_t> big(200, 0xAB);
+    writer.write(static_cast<uint8_t>(1));
+    writer.write(big.data(), big.size());
+    expect(writer.position() == 201, "writer position counts buffered bytes");
+    expect(writer.seek(0), "writer seek flushes");
+    writer.write(static_cast<uint8_t>(2));
+  }
+  file.close();
+  const std::string data = readCardFile("/edge.bin");
+  expect(data.size() == 201 && data[0] == 2 && static_cast<uint8_t>(data[200]) == 0xAB,
+         "writer flushes on destruction");
+}
+
+}  // namespace
+
+// ImageBlock's decoders are not built here; the pages in this benchmark carry text only
+void ImageBlock::render(GfxRenderer&, int, int) {}
+bool ImageBlock::serialize(BufferedWriter&) { return false; }
+std::unique_ptr<ImageBlock> ImageBlock::deserialize(BufferedReader&) { return nullptr; }
+
+int main(const int argc, char** argv) {
+  const std::string card = argc > 0 ? std::string(argv[0]) + ".card" : "card";
+  fs::remove_all(card);
+  fs::create_directories(card);
+  Storage.root = card;
+
+  checkReaderEdgeCases();
+  checkWriterEdgeCases();
+
+  const Page page = makePage(24, 9);
+  std::string unbufferedBytes;
+  size_t unbufferedReads = 0;
+
+  std::cout << "Page of " << page.elements.size() << " lines through Page::serialize/deserialize" << std::endl;
+  std::cout << std::left << std::setw(12) << "block size" << std::setw(22) << "write lock takes" << std::setw(22)
+            << "read lock takes" << std::endl;
+
+  for (const size_t blockSize : {1, 64, 128, 256, 512, 1024}) {
+    HalFile file;
+    expect(Storage.openFileForWrite("BFB", PAGE_FILE, file), "create page file");
+    size_t takes = Storage.lockTakes;
+    {
+      BufferedWriter writer(file, blockSize);
+      expect(page.serialize(writer), "serialize");
+      expect(writer.flush(), "flush");
+    }
+    const size_t writes = Storage.lockTakes - takes;
+    file.close();
+
+    const std::string bytes = readCardFile(PAGE_FILE);
+    if (blockSize == 1) {
+      unbufferedBytes = bytes;
+    }
+    expect(bytes == unbufferedBytes, "block size " + std::to_string(blockSize) + " writes the same bytes");
+
+    expect(Storage.openFileForRead("BFB", PAGE_FILE, file), "open page file");
+    takes = Storage.lockTakes;
+    std::unique_ptr<Page> copy;
+    {
+      BufferedReader reader(file, blockSize);
+      copy = Page::deserialize(reader);
+    }
+    const size_t reads = Storage.lockTakes - takes;
+    file.close();
+    expect(copy && samePage(page, *copy), "block size " + std::to_string(blockSize) + " round trip");
+
+    std::cout << std::setw(12) << (blockSize == 1 ? std::string("unbuffered") : std::to_string(blockSize))
+              << std::setw(22) << writes << std::setw(22) << reads << std::endl;
+    if (blockSize == 1) {
+      unbufferedReads = reads;
+    } else {
+      expect(reads * 20 < unbufferedReads, "buffered page load takes at least 20x fewer storage locks");
+    }
+  }
+  std::cout << "Page record: " << unbufferedBytes.size() << " bytes" << std::endl;
+
+  fs::remove_all(card);
+  if (failures > 0) {
+    std::cerr << failures << " check(s) failed" << std::endl;
+    return 1;
+  }
+  std::cout << "All checks passed" << std::endl;
+  return 0;
+}
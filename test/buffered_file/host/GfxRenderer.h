@@ -0,0 +1,14 @@
+#pragma once
+
+#include <EpdFontFamily.h>
+
+// Host stand-in for lib/GfxRenderer: the benchmark serializes pages but never draws them, so TextBlock::render links
+// against these no-ops
+class GfxRenderer {
+ public:
+  void drawLine(int, int, int, int, bool = true) const {}
+  int getTextWidth(int, const char*, EpdFontFamily::Style = EpdFontFamily::REGULAR) const { return 0; }
+  void drawText(int, int, int, const char*, bool = true, EpdFontFamily::Style = EpdFontFamily::REGULAR) const {}
+  int getTextAdvanceX(int, const char*, EpdFontFamily::Style) const { return 0; }
+  int getFontAscenderSize(int) const { return 0; }
+};
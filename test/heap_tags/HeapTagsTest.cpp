@@ -0,0 +1,400 @@
+#include <InflateReader.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "lib/HeapTags/HeapTags.h"
+
+// Runs HeapTags against a fake heap the size of the one the firmware has left after boot, so that accounting,
+// fragmentation and failures behave as on the device and regressions show up on the host:
+// - per-tag live/peak/allocation counts, nested scopes, and scopes being per task
+// - failures recorded with the largest free block, telling fragmentation apart from exhaustion
+// - InflateReader's 32KB ring counted against the scope of whoever inflates
+// - a reader session replayed with the firmware's buffer sizes, checked against per-tag peak budgets
+namespace {
+
+int failures = 0;
+
+void check(const bool condition, const std::string& what) {
+  if (!condition) {
+    std::cerr << "FAIL " << what << std::endl;
+    failures++;
+  }
+}
+
+// First-fit heap over a fixed arena with coalescing, 8-byte granularity; like the ESP heap it can fail with plenty
+// of free bytes when none of the free blocks is large enough
+class FakeHeap final : public HeapTags::Backend {
+  std::vector<uint8_t> arena;
+  std::map<size_t, size_t> freeBlocks;  // offset -> size
+  std::map<size_t, size_t> usedBlocks;
+
+ public:
+  explicit FakeHeap(const size_t size) : arena(size) { freeBlocks[0] = size; }
+
+  void* allocate(size_t size) override {
+    size = (size + 7) & ~size_t{7};
+    for (auto it = freeBlocks.begin(); it != freeBlocks.end(); ++it) {
+      if (it->second < size) {
+        continue;
+      }
+      const size_t offset = it->first;
+      const size_t remaining = it->second - size;
+      freeBlocks.erase(it);
+      if (remaining > 0) {
+        freeBlocks[offset + size] = remaining;
+      }
+      usedBlocks[offset] = size;
+      return arena.data() + offset;
+    }
+    return nullptr;
+  }
+
+  void release(void* block) override {
+    const auto offset = static_cast<size_t>(static_cast<uint8_t*>(block) - arena.data());
+    const auto used = usedBlocks.find(offset);
+    if (used == usedBlocks.end()) {
+      check(false, "fake heap: release of unknown block");
+      return;
+    }
+    size_t start = offset;
+    size_t size = used->second;
+    usedBlocks.erase(used);
+    const auto next = freeBlocks.find(start + size);
+    if (next != freeBlocks.end()) {
+      size += next->second;
+      freeBlocks.erase(next);
+    }
+    const auto after = freeBlocks.lower_bound(start);
+    if (after != freeBlocks.begin()) {
+      const auto previous = std::prev(after);
+      if (previous->first + previous->second == start) {
+        start = previous->first;
+        size += previous->second;
+        freeBlocks.erase(previous);
+      }
+    }
+    freeBlocks[start] = size;
+  }
+
+  size_t freeBytes() const override {
+    size_t total = 0;
+    for (const auto& block : freeBlocks) {
+      total += block.second;
+    }
+    return total;
+  }
+
+  size_t largestFreeBlock() const override {
+    size_t largest = 0;
+    for (const auto& block : freeBlocks) {
+      largest = block.second > largest ? block.second : largest;
+    }
+    return largest;
+  }
+
+  size_t usedCount() const { return usedBlocks.size(); }
+};
+
+void checkAccounting() {
+  FakeHeap heap(64 * 1024);
+  HeapTags::setBackend(&heap);
+  HeapTags::reset();
+
+  check(HeapTags::current() == HeapTag::Untagged, "no scope is untagged");
+  void* untagged = HeapTags::allocate(100);
+  void* font = nullptr;
+  void* css = nullptr;
+  {
+    HeapTagScope section(HeapTag::SectionBuild);
+    void* a = HeapTags::allocate(1000);
+    {
+      HeapTagScope nested(HeapTag::Css);
+      css = HeapTags::allocate(300);
+      font = HeapTags::allocate(500, HeapTag::FontCache);  // An explicit tag wins over the scope
+    }
+    check(HeapTags::current() == HeapTag::SectionBuild, "nested scope restores the outer tag");
+    void* b = HeapTags::allocate(2000);
+    HeapTags::release(a);
+    HeapTags::release(b);
+  }
+  check(HeapTags::current() == HeapTag::Untagged, "scope restores untagged");
+
+  const auto section = HeapTags::stats(HeapTag::SectionBuild);
+  check(section.liveBytes == 0 && section.peakBytes == 3000 && section.allocations == 2,
+        "sectionBuild live 0, peak 3000, 2 allocations; got live " + std::to_string(section.liveBytes) + " peak " +
+            std::to_string(section.peakBytes));
+  check(HeapTags::stats(HeapTag::Css).liveBytes == 300, "css live 300");
+  check(HeapTags::stats(HeapTag::FontCache).liveBytes == 500, "fontCache live 500");
+  check(HeapTags::stats(HeapTag::Untagged).liveBytes == 100, "untagged live 100");
+
+  HeapTags::release(untagged);
+  HeapTags::release(css);
+  HeapTags::release(font);
+  HeapTags::release(nullptr);
+  for (uint8_t i = 0; i < static_cast<uint8_t>(HeapTag::Count); i++) {
+    check(HeapTags::stats(static_cast<HeapTag>(i)).liveBytes == 0,
+          std::string("nothing live under ") + HeapTags::name(static_cast<HeapTag>(i)));
+  }
+  check(heap.usedCount() == 0 && heap.freeBytes() == 64 * 1024, "every block went back to the heap");
+
+  // Blocks keep malloc's alignment for the caller
+  void* aligned = HeapTags::allocate(3);
+  check(reinterpret_cast<uintptr_t>(aligned) % 8 == 0, "blocks are 8-byte aligned");
+  HeapTags::release(aligned);
+  HeapTags::setBackend(nullptr);
+}
+
+void checkFailures() {
+  FakeHeap heap(96 * 1024);
+  HeapTags::setBackend(&heap);
+  HeapTags::reset();
+
+  HeapTags::Failure failure{};
+  check(!HeapTags::lastFailure(failure), "no failure yet");
+
+  // Fragment the heap: alternate 8KB blocks, then free every other one. Half the heap is free, in 8KB pieces.
+  std::vector<void*> blocks;
+  while (void* block = HeapTags::allocate(8 * 1024 - 8, HeapTag::Activity)) {
+    blocks.push_back(block);
+  }
+  for (size_t i = 0; i < blocks.size(); i += 2) {
+    HeapTags::release(blocks[i]);
+  }
+  const size_t freeNow = HeapTags::freeBytes();
+
+  void* ring;
+  {
+    HeapTagScope scope(HeapTag::SectionBuild);
+    ring = HeapTags::allocate(32 * 1024);
+  }
+  check(ring == nullptr, "32KB fails in a heap fragmented into 8KB pieces");
+  check(HeapTags::lastFailure(failure), "failure recorded");
+  check(failure.tag == HeapTag::SectionBuild && failure.requested == 32 * 1024, "failure has tag and size");
+  check(failure.freeBytes == freeNow && failure.freeBytes > 32 * 1024 && failure.largestFreeBlock == 8 * 1024,
+        "failure shows fragmentation: free " + std::to_string(failure.freeBytes) + ", largest " +
+            std::to_string(failure.largestFreeBlock));
+  check(HeapTags::stats(HeapTag::SectionBuild).failures == 1 && HeapTags::stats(HeapTag::SectionBuild).allocations == 0,
+        "failure counted, not allocated");
+
+  // Chunks like the BW buffer backup still fit
+  void* chunk = HeapTags::allocate(8000, HeapTag::Render);
+  check(chunk != nullptr, "8000-byte chunk fits where 32KB did not");
+  HeapTags::release(chunk);
+
+  for (size_t i = 1; i < blocks.size(); i += 2) {
+    HeapTags::release(blocks[i]);
+  }
+  HeapTags::setBackend(nullptr);
+}
+
+void checkHistory() {
+  FakeHeap heap(16 * 1024);
+  HeapTags::setBackend(&heap);
+  HeapTags::reset();
+
+  HeapTags::Sample samples[HeapTags::HISTORY_SIZE];
+  check(HeapTags::history(samples, HeapTags::HISTORY_SIZE) == 0, "history starts empty");
+
+  std::vector<void*> blocks;
+  for (uint32_t i = 0; i < HeapTags::HISTORY_SIZE + 4; i++) {
+    blocks.push_back(HeapTags::allocate(256));
+    HeapTags::sample(i * 10000);
+  }
+  const size_t count = HeapTags::history(samples, HeapTags::HISTORY_SIZE);
+  check(count == HeapTags::HISTORY_SIZE, "history keeps HISTORY_SIZE samples");
+  check(samples[0].atMs == 40000 && samples[count - 1].atMs == (HeapTags::HISTORY_SIZE + 3) * 10000,
+        "history is the newest samples, oldest first");
+  check(samples[0].freeBytes > samples[count - 1].freeBytes, "samples follow the heap");
+  check(HeapTags::history(samples, 3) == 3 && samples[2].atMs == (HeapTags::HISTORY_SIZE + 3) * 10000,
+        "a shorter copy still ends with the newest sample");
+
+  for (void* block : blocks) {
+    HeapTags::release(block);
+  }
+  HeapTags::setBackend(nullptr);
+}
+
+// The ring buffer of a streaming inflate is counted against whoever asked for it
+void checkInflateReader() {
+  FakeHeap heap(64 * 1024);
+  HeapTags::setBackend(&heap);
+  HeapTags::reset();
+  {
+    HeapTagScope scope(HeapTag::Css);
+    InflateReader reader;
+    check(reader.init(true), "streaming inflate gets its ring");
+    check(HeapTags::stats(HeapTag::Css).liveBytes == 32768, "inflate ring counted against css");
+  }
+  check(HeapTags::stats(HeapTag::Css).liveBytes == 0, "inflate ring released with the reader");
+  {
+    HeapTagScope scope(HeapTag::ImageDecode);
+    InflateReader first;
+    InflateReader second;
+    check(first.init(true) && !second.init(true), "a second 32KB ring does not fit in 64KB");
+  }
+  HeapTags::Failure failure{};
+  check(HeapTags::lastFailure(failure) && failure.tag == HeapTag::ImageDecode, "inflate failure under imageDecode");
+  HeapTags::setBackend(nullptr);
+}
+
+// Scopes belong to the task that opened them
+void checkThreads() {
+  HeapTags::reset();
+  constexpr int ROUNDS = 20000;
+  const auto worker = [](const HeapTag tag, const size_t size) {
+    HeapTagScope scope(tag);
+    for (int i = 0; i < ROUNDS; i++) {
+      void* block = HeapTags::allocate(size);
+      if (HeapTags::current() != tag) {
+        failures++;
+      }
+      HeapTags::release(block);
+    }
+  };
+  std::thread render(worker, HeapTag::Render, 64);
+  std::thread web(worker, HeapTag::WebServer, 128);
+  render.join();
+  web.join();
+  check(HeapTags::current() == HeapTag::Untagged, "other tasks' scopes do not leak into this one");
+  const auto renderStats = HeapTags::stats(HeapTag::Render);
+  const auto webStats = HeapTags::stats(HeapTag::WebServer);
+  check(renderStats.allocations == ROUNDS && renderStats.liveBytes == 0 && renderStats.peakBytes == 64,
+        "render counted on its own task");
+  check(webStats.allocations == ROUNDS && webStats.liveBytes == 0 && webStats.peakBytes == 128,
+        "web server counted on its own task");
+}
+
+// Replays a reader session with the buffers the firmware allocates, on a heap the size the device has free once the
+// frame buffer, fonts and WiFi-less services are up. Peaks above budget, or the grayscale backup no longer fitting
+// after an image, mean something started holding more memory.
+void replayReaderSession() {
+  constexpr size_t DEVICE_FREE_HEAP = 200 * 1024;
+  constexpr size_t FONT_GROUP = 6 * 1024;           // A typical decompressed glyph group
+  constexpr size_t INFLATE_RING = 32 * 1024;        // InflateReader
+  constexpr size_t ZIP_CHUNK = 1024;                // ZipFile read chunk
+  constexpr size_t PNG_DECODER = 44 * 1024;         // PNGdec object
+  constexpr size_t PIXEL_CACHE = 120 * 1024;        // A near full-screen 2-bit image
+  constexpr size_t BW_CHUNK = 8000;                 // GfxRenderer::BW_BUFFER_CHUNK_SIZE
+  constexpr size_t BW_CHUNKS = 6;                   // GfxRenderer::BW_BUFFER_NUM_CHUNKS
+  constexpr size_t UPLOAD_BUFFER = 16 * 1024;       // UploadWriter::BUFFER_SIZE, two of them
+
+  struct Budget {
+    HeapTag tag;
+    uint32_t peakBytes;
+  };
+  constexpr Budget budgets[] = {
+      {HeapTag::FontCache, 4 * FONT_GROUP},
+      {HeapTag::SectionBuild, INFLATE_RING + ZIP_CHUNK},
+      {HeapTag::Css, INFLATE_RING + ZIP_CHUNK},
+      {HeapTag::ImageDecode, PNG_DECODER + PIXEL_CACHE},
+      {HeapTag::Render, BW_CHUNK * BW_CHUNKS},
+      {HeapTag::WebServer, 2 * UPLOAD_BUFFER},
+  };
+
+  FakeHeap heap(DEVICE_FREE_HEAP);
+  HeapTags::setBackend(&heap);
+  HeapTags::reset();
+  uint32_t clock = 0;
+  const auto tick = [&clock] { HeapTags::sample(clock += 1000); };
+
+  // Font cache fills as the first pages are laid out and stays
+  std::vector<void*> fontGroups;
+  for (int i = 0; i < 4; i++) {
+    fontGroups.push_back(HeapTags::allocate(FONT_GROUP, HeapTag::FontCache));
+  }
+  tick();
+
+  // CSS, then the chapter, each inflating from the ZIP
+  for (const HeapTag stage : {HeapTag::Css, HeapTag::SectionBuild}) {
+    HeapTagScope scope(stage);
+    InflateReader inflate;
+    inflate.init(true);
+    void* chunk = HeapTags::allocate(ZIP_CHUNK);
+    tick();
+    HeapTags::release(chunk);
+  }
+
+  // A page with a PNG: decoder and pixel cache, the pixel cache kept for the grayscale pass
+  void* pixelCache;
+  {
+    HeapTagScope scope(HeapTag::ImageDecode);
+    void* decoder = HeapTags::allocate(PNG_DECODER);
+    pixelCache = HeapTags::allocate(PIXEL_CACHE);
+    tick();
+    HeapTags::release(decoder);
+  }
+
+  // Grayscale anti-aliasing backs up the BW frame in chunks
+  std::vector<void*> bwChunks;
+  for (size_t i = 0; i < BW_CHUNKS; i++) {
+    bwChunks.push_back(HeapTags::allocate(BW_CHUNK, HeapTag::Render));
+  }
+  tick();
+  bool backupStored = true;
+  for (void* chunk : bwChunks) {
+    backupStored &= chunk != nullptr;
+    HeapTags::release(chunk);
+  }
+  HeapTags::release(pixelCache);
+  check(backupStored, "grayscale backup fits next to the image's pixel cache");
+
+  // Then a transfer over the web server
+  {
+    HeapTagScope scope(HeapTag::WebServer);
+    void* buffers[] = {HeapTags::allocate(UPLOAD_BUFFER), HeapTags::allocate(UPLOAD_BUFFER)};
+    tick();
+    for (void* buffer : buffers) {
+      HeapTags::release(buffer);
+    }
+  }
+  for (void* group : fontGroups) {
+    HeapTags::release(group);
+  }
+  tick();
+
+  printf("%-12s %8s %8s %7s %7s\n", "tag", "peak", "budget", "allocs", "failed");
+  for (const Budget& budget : budgets) {
+    const auto stats = HeapTags::stats(budget.tag);
+    printf("%-12s %8u %8u %7u %7u\n", HeapTags::name(budget.tag), stats.peakBytes, budget.peakBytes,
+           stats.allocations, stats.failures);
+    check(stats.peakBytes <= budget.peakBytes, std::string(HeapTags::name(budget.tag)) + " over its budget");
+    check(stats.failures == 0, std::string(HeapTags::name(budget.tag)) + " had failed allocations");
+    check(stats.liveBytes == 0, std::string(HeapTags::name(budget.tag)) + " leaked");
+  }
+
+  HeapTags::Sample samples[HeapTags::HISTORY_SIZE];
+  const size_t count = HeapTags::history(samples, HeapTags::HISTORY_SIZE);
+  printf("free / largest block over the session:");
+  for (size_t i = 0; i < count; i++) {
+    printf(" %u/%u", samples[i].freeBytes / 1024, samples[i].largestFreeBlock / 1024);
+  }
+  printf(" KB\n");
+  check(count > 0 && samples[count - 1].freeBytes == DEVICE_FREE_HEAP, "heap whole again at the end");
+  HeapTags::setBackend(nullptr);
+}
+
+}  // namespace
+
+int main() {
+  checkAccounting();
+  checkFailures();
+  checkHistory();
+  checkInflateReader();
+  checkThreads();
+  replayReaderSession();
+
+  if (failures) {
+    std::cerr << failures << " check(s) failed" << std::endl;
+    return 1;
+  }
+  std::cout << "All checks passed" << std::endl;
+  return 0;
+}
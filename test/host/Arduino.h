@@ -0,0 +1,24 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+
+// Host stand-in for the Arduino core: the standard headers it brings in, a clock, a no-op yield and a free heap figure
+// a test can lower
+inline unsigned long millis() {
+  static const auto start = std::chrono::steady_clock::now();
+  return static_cast<unsigned long>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+inline void yield() {}
+
+struct EspClass {
+  uint32_t freeHeap = 200 * 1024;
+  uint32_t getFreeHeap() const { return freeHeap; }
+};
+
+inline EspClass ESP;
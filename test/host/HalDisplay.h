@@ -0,0 +1,60 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <cstdint>
+#include <cstring>
+
+// Host stand-in for lib/hal/HalDisplay.h: the panel is three in-memory planes. The frame buffer is what GfxRenderer
+// draws into; the grayscale LSB and MSB planes keep what was last copied to the controller. Refreshes are only counted.
+class HalDisplay {
+ public:
+  enum RefreshMode { FULL_REFRESH, HALF_REFRESH, FAST_REFRESH };
+
+  static constexpr uint16_t DISPLAY_WIDTH = 800;
+  static constexpr uint16_t DISPLAY_HEIGHT = 480;
+  static constexpr uint16_t DISPLAY_WIDTH_BYTES = DISPLAY_WIDTH / 8;
+  static constexpr uint32_t BUFFER_SIZE = DISPLAY_WIDTH_BYTES * DISPLAY_HEIGHT;
+
+  mutable uint8_t frame[BUFFER_SIZE] = {};
+  uint8_t lsb[BUFFER_SIZE] = {};
+  uint8_t msb[BUFFER_SIZE] = {};
+  int refreshes = 0;
+  int grayRefreshes = 0;
+
+  void begin() {}
+
+  void clearScreen(const uint8_t color = 0xFF) const { memset(frame, color, BUFFER_SIZE); }
+  void drawImage(const uint8_t* imageData, const uint16_t x, const uint16_t y, const uint16_t w, const uint16_t h,
+                 bool = false) const {
+    for (uint16_t row = 0; row < h && y + row < DISPLAY_HEIGHT; row++) {
+      for (uint16_t byte = 0; byte < w / 8 && x / 8 + byte < DISPLAY_WIDTH_BYTES; byte++) {
+        frame[(y + row) * DISPLAY_WIDTH_BYTES + x / 8 + byte] = imageData[row * (w / 8) + byte];
+      }
+    }
+  }
+  // Only the black (0) bits of the image are drawn
+  void drawImageTransparent(const uint8_t* imageData, const uint16_t x, const uint16_t y, const uint16_t w,
+                            const uint16_t h, bool = false) const {
+    for (uint16_t row = 0; row < h && y + row < DISPLAY_HEIGHT; row++) {
+      for (uint16_t byte = 0; byte < w / 8 && x / 8 + byte < DISPLAY_WIDTH_BYTES; byte++) {
+        frame[(y + row) * DISPLAY_WIDTH_BYTES + x / 8 + byte] &= imageData[row * (w / 8) + byte];
+      }
+    }
+  }
+
+  void displayBuffer(RefreshMode = FAST_REFRESH, bool = false) { refreshes++; }
+  void refreshDisplay(RefreshMode = FAST_REFRESH, bool = false) { refreshes++; }
+
+  uint8_t* getFrameBuffer() const { return frame; }
+
+  void copyGrayscaleBuffers(const uint8_t* lsbBuffer, const uint8_t* msbBuffer) {
+    copyGrayscaleLsbBuffers(lsbBuffer);
+    copyGrayscaleMsbBuffers(msbBuffer);
+  }
+  void copyGrayscaleLsbBuffers(const uint8_t* lsbBuffer) { memcpy(lsb, lsbBuffer, BUFFER_SIZE); }
+  void copyGrayscaleMsbBuffers(const uint8_t* msbBuffer) { memcpy(msb, msbBuffer, BUFFER_SIZE); }
+  void cleanupGrayscaleBuffers(const uint8_t*) {}
+
+  void displayGrayBuffer(bool = false) { grayRefreshes++; }
+};
@@ -0,0 +1,250 @@
+#pragma once
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Host stand-in for lib/hal/HalStorage.h, shared by the test/run_*.sh builds: paths are relative to a local directory
+// (Storage.root) that stands in for the SD card. Every file or folder entry opened is counted, which on the card is a
+// directory entry read; every call the real HalStorage/HalFile wraps in the storage mutex counts one lock taken; every
+// read of a file is recorded; and writes can be slowed to a card's speed.
+using oflag_t = int;
+
+class HalFile {
+  friend class HalStorage;
+
+  FILE* file = nullptr;
+  DIR* dir = nullptr;
+  std::string path;
+  struct stat info {};
+  bool open = false;
+
+  // The real HalFile takes the storage mutex around this call
+  void locked() const;
+  bool release() {
+    if (file) fclose(file);
+    if (dir) closedir(dir);
+    file = nullptr;
+    dir = nullptr;
+    open = false;
+    return true;
+  }
+
+ public:
+  std::vector<std::pair<size_t, size_t>> reads;  // Offset and length of every read
+
+  HalFile() = default;
+  HalFile(HalFile&& other) noexcept { *this = std::move(other); }
+  HalFile& operator=(HalFile&& other) noexcept {
+    if (this != &other) {
+      release();
+      file = std::exchange(other.file, nullptr);
+      dir = std::exchange(other.dir, nullptr);
+      path = std::move(other.path);
+      info = other.info;
+      open = std::exchange(other.open, false);
+      reads = std::move(other.reads);
+    }
+    return *this;
+  }
+  HalFile(const HalFile&) = delete;
+  HalFile& operator=(const HalFile&) = delete;
+  ~HalFile() { release(); }
+
+  bool close() {
+    locked();
+    return release();
+  }
+  operator bool() const { return open; }
+  bool isDirectory() const { return S_ISDIR(info.st_mode); }
+
+  size_t getName(char* name, const size_t length) {
+    locked();
+    snprintf(name, length, "%s", path.substr(path.find_last_of('/') + 1).c_str());
+    return strlen(name);
+  }
+  size_t size() {
+    if (file) {
+      fflush(file);
+      fstat(fileno(file), &info);
+    }
+    return static_cast<size_t>(info.st_size);
+  }
+  size_t fileSize() { return size(); }
+  // FAT date and time of the last modification, as SdFat reports them
+  bool getModifyDateTime(uint16_t* date, uint16_t* time) {
+    locked();
+    std::tm local{};
+    localtime_r(&info.st_mtime, &local);
+    *date = static_cast<uint16_t>((local.tm_year - 80) << 9 | (local.tm_mon + 1) << 5 | local.tm_mday);
+    *time = static_cast<uint16_t>(local.tm_hour << 11 | local.tm_min << 5 | local.tm_sec / 2);
+    return true;
+  }
+
+  HalFile openNextFile();
+
+  bool seek(const size_t offset) {
+    locked();
+    return file && fseek(file, static_cast<long>(offset), SEEK_SET) == 0;
+  }
+  bool seekSet(const size_t offset) { return seek(offset); }
+  size_t position() const {
+    locked();
+    return file ? static_cast<size_t>(ftell(file)) : 0;
+  }
+  bool seekCur(const long offset) {
+    locked();
+    return file && fseek(file, offset, SEEK_CUR) == 0;
+  }
+  int available() {
+    locked();
+    return file ? static_cast<int>(size() - static_cast<size_t>(ftell(file))) : 0;
+  }
+  int read(void* buf, const size_t count) {
+    locked();
+    if (!file) {
+      return -1;
+    }
+    const size_t offset = static_cast<size_t>(ftell(file));
+    const size_t bytesRead = fread(buf, 1, count, file);
+    reads.emplace_back(offset, bytesRead);
+    return static_cast<int>(bytesRead);
+  }
+  int read() {
+    uint8_t b = 0;
+    return read(&b, 1) == 1 ? b : -1;
+  }
+  size_t write(const void* buf, size_t count);
+  size_t write(const uint8_t b) { return write(&b, 1); }
+  bool flush() {
+    locked();
+    return file && fflush(file) == 0;
+  }
+};
+
+class HalStorage {
+  friend class HalFile;
+
+  HalFile openLocal(const std::string& localPath, const oflag_t oflag) {
+    opens++;
+    lockTakes++;
+    HalFile result;
+    result.path = localPath;
+    const bool create = oflag & O_CREAT;
+    if (stat(localPath.c_str(), &result.info) != 0 && !create) {
+      return result;
+    }
+    if (!create && S_ISDIR(result.info.st_mode)) {
+      result.dir = opendir(localPath.c_str());
+      result.open = result.dir != nullptr;
+      return result;
+    }
+    const char* mode = (oflag & O_TRUNC) ? "w+b" : (oflag & (O_RDWR | O_WRONLY)) ? "r+b" : "rb";
+    result.file = fopen(localPath.c_str(), mode);
+    result.open = result.file != nullptr;
+    if (result.open) {
+      fstat(fileno(result.file), &result.info);
+    }
+    return result;
+  }
+
+ public:
+  std::string root;
+  size_t opens = 0;
+  size_t lockTakes = 0;
+  // Simulated card speed: each write call takes writeLatency plus its size at writeBytesPerMicrosecond (0: no delay)
+  std::chrono::microseconds writeLatency{0};
+  double writeBytesPerMicrosecond = 0;
+
+  std::string local(const char* path) const { return root + (path[0] == '/' ? "" : "/") + path; }
+
+  HalFile open(const char* path, const oflag_t oflag = O_RDONLY) { return openLocal(local(path), oflag); }
+  bool openFileForRead(const char*, const char* path, HalFile& file) {
+    file = open(path);
+    return file && !file.isDirectory();
+  }
+  bool openFileForRead(const char* moduleName, const std::string& path, HalFile& file) {
+    return openFileForRead(moduleName, path.c_str(), file);
+  }
+  bool openFileForWrite(const char*, const char* path, HalFile& file) {
+    file = open(path, O_WRONLY | O_CREAT | O_TRUNC);
+    return file;
+  }
+  bool openFileForWrite(const char* moduleName, const std::string& path, HalFile& file) {
+    return openFileForWrite(moduleName, path.c_str(), file);
+  }
+  bool exists(const char* path) {
+    lockTakes++;
+    struct stat info {};
+    return stat(local(path).c_str(), &info) == 0;
+  }
+  bool remove(const char* path) {
+    lockTakes++;
+    return unlink(local(path).c_str()) == 0;
+  }
+  bool rename(const char* from, const char* to) {
+    lockTakes++;
+    return ::rename(local(from).c_str(), local(to).c_str()) == 0;
+  }
+  bool mkdir(const char* path, bool = true) {
+    lockTakes++;
+    std::error_code error;
+    std::filesystem::create_directories(local(path), error);
+    return !error;
+  }
+  bool removeDir(const char* path) {
+    lockTakes++;
+    std::error_code error;
+    std::filesystem::remove_all(local(path), error);
+    return !error;
+  }
+};
+
+inline HalStorage Storage;
+
+inline void HalFile::locked() const { Storage.lockTakes++; }
+
+inline HalFile HalFile::openNextFile() {
+  while (dir) {
+    const dirent* entry = readdir(dir);
+    if (!entry) {
+      break;
+    }
+    if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0) {
+      HalFile child = Storage.openLocal(path + "/" + entry->d_name, O_RDONLY);
+      // Only the entry is needed; don't keep a folder handle per child
+      if (child.dir) {
+        closedir(std::exchange(child.dir, nullptr));
+      }
+      return child;
+    }
+  }
+  return HalFile();
+}
+
+inline size_t HalFile::write(const void* buf, const size_t count) {
+  locked();
+  if (!file) {
+    return 0;
+  }
+  if (Storage.writeBytesPerMicrosecond > 0) {
+    std::this_thread::sleep_for(Storage.writeLatency + std::chrono::microseconds(static_cast<long>(
+                                                           count / Storage.writeBytesPerMicrosecond)));
+  }
+  return fwrite(buf, 1, count, file);
+}
+
+using FsFile = HalFile;
@@ -0,0 +1,9 @@
+#pragma once
+
+// Host stand-in for lib/Logging: messages are dropped, but their arguments still count as used, as on the device
+template <typename... Args>
+inline void logDropped(const char*, const Args&...) {}
+
+#define LOG_ERR(origin, format, ...) logDropped(format __VA_OPT__(, ) __VA_ARGS__)
+#define LOG_INF(origin, format, ...) logDropped(format __VA_OPT__(, ) __VA_ARGS__)
+#define LOG_DBG(origin, format, ...) logDropped(format __VA_OPT__(, ) __VA_ARGS__)
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Host stand-in for the Arduino core's Print
+class Print {
+ public:
+  virtual ~Print() = default;
+  virtual size_t write(uint8_t) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size) {
+    size_t written = 0;
+    while (written < size && write(buffer[written])) {
+      written++;
+    }
+    return written;
+  }
+  virtual void flush() {}
+};
@@ -0,0 +1,4 @@
+#pragma once
+
+// Host stand-in: there is no task watchdog on the host
+inline void esp_task_wdt_reset() {}
@@ -0,0 +1,51 @@
+#include <HalStorage.h>
+#include <WebServer.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "src/network/HttpFileResponse.h"
+
+// Serves the files of a local directory, which stands in for the SD card, through HttpFileResponse, so ranged and
+// conditional requests can be checked with curl (see test/run_http_file.sh). Every response is logged with the number
+// of card reads that didn't start on a multiple of the read size; only the first read of a response may.
+int main(const int argc, char** argv) {
+  if (argc != 3) {
+    std::cerr << "usage: " << argv[0] << " <directory> <port>\n";
+    return 2;
+  }
+  Storage.root = argv[1];
+  WebServer server;
+  if (!server.begin(static_cast<uint16_t>(std::atoi(argv[2])))) {
+    std::cerr << "failed to listen on port " << argv[2] << "\n";
+    return 1;
+  }
+  std::cout << "serving " << Storage.root << " on port " << argv[2] << std::endl;
+
+  while (true) {
+    if (!server.accept()) {
+      continue;
+    }
+    const std::string path = server.uri().str();
+    HalFile file;
+    if (path.find("..") != std::string::npos || !Storage.openFileForRead("HFS", path, file)) {
+      server.send(404, "text/plain", "Not Found");
+      server.finish();
+      std::cout << path << " 404" << std::endl;
+      continue;
+    }
+
+    HttpFileResponse::send(server, file, "application/octet-stream");
+    server.finish();
+
+    size_t misaligned = 0;
+    for (size_t i = 1; i < file.reads.size(); i++) {
+      if (file.reads[i].first % HttpFileResponse::READ_CHUNK_SIZE != 0) {
+        misaligned++;
+      }
+    }
+    std::cout << (server.method() == HTTP_HEAD ? "HEAD " : "GET ") << path << " reads=" << file.reads.size()
+              << " misaligned=" << misaligned << std::endl;
+  }
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+// Host stand-in for the Arduino String, covering what the code under test uses
+class String {
+  std::string value;
+
+ public:
+  String() = default;
+  String(const char* text) : value(text ? text : "") {}  // NOLINT(google-explicit-constructor)
+  String(std::string text) : value(std::move(text)) {}   // NOLINT(google-explicit-constructor)
+
+  const char* c_str() const { return value.c_str(); }
+  size_t length() const { return value.size(); }
+  bool isEmpty() const { return value.empty(); }
+  const std::string& str() const { return value; }
+};
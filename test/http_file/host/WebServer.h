@@ -0,0 +1,165 @@
+#pragma once
+
+#include <WString.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <string>
+
+// Host stand-in for the ESP32 WebServer: a blocking HTTP/1.1 server on localhost that answers one request per
+// connection. It implements the part of the WebServer interface the file responses use.
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_HEAD, HTTP_POST };
+
+class NetworkClient {
+  int fd;
+
+ public:
+  explicit NetworkClient(const int fd) : fd(fd) {}
+
+  size_t write(const uint8_t* data, const size_t length) {
+    size_t written = 0;
+    while (written < length) {
+      const ssize_t sent = ::send(fd, data + written, length - written, MSG_NOSIGNAL);
+      if (sent <= 0) {
+        break;
+      }
+      written += static_cast<size_t>(sent);
+    }
+    return written;
+  }
+};
+
+class WebServer {
+  int listenFd = -1;
+  int clientFd = -1;
+  HTTPMethod currentMethod = HTTP_ANY;
+  String currentUri;
+  std::map<std::string, std::string> requestHeaders;  // lower-case names
+  std::string responseHeaders;
+  size_t contentLength = 0;
+
+  static std::string lower(std::string text) {
+    std::transform(text.begin(), text.end(), text.begin(), [](unsigned char c) { return std::tolower(c); });
+    return text;
+  }
+
+  static const char* reason(const int code) {
+    switch (code) {
+      case 200:
+        return "OK";
+      case 206:
+        return "Partial Content";
+      case 304:
+        return "Not Modified";
+      case 404:
+        return "Not Found";
+      case 416:
+        return "Range Not Satisfiable";
+      default:
+        return "Error";
+    }
+  }
+
+ public:
+  ~WebServer() {
+    finish();
+    if (listenFd >= 0) {
+      ::close(listenFd);
+    }
+  }
+
+  bool begin(const uint16_t port) {
+    listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    const int reuse = 1;
+    setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(port);
+    return listenFd >= 0 && bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0 &&
+           listen(listenFd, 8) == 0;
+  }
+
+  // Waits for the next connection and reads its request line and headers
+  bool accept() {
+    clientFd = ::accept(listenFd, nullptr, nullptr);
+    if (clientFd < 0) {
+      return false;
+    }
+    std::string request;
+    char buffer[1024];
+    while (request.find("\r\n\r\n") == std::string::npos && request.size() < 16384) {
+      const ssize_t received = recv(clientFd, buffer, sizeof(buffer), 0);
+      if (received <= 0) {
+        finish();
+        return false;
+      }
+      request.append(buffer, static_cast<size_t>(received));
+    }
+
+    requestHeaders.clear();
+    responseHeaders.clear();
+    contentLength = 0;
+    size_t lineEnd = request.find("\r\n");
+    const std::string requestLine = request.substr(0, lineEnd);
+    const size_t methodEnd = requestLine.find(' ');
+    const size_t uriEnd = requestLine.find(' ', methodEnd + 1);
+    const std::string method = requestLine.substr(0, methodEnd);
+    currentMethod = method == "GET" ? HTTP_GET : method == "HEAD" ? HTTP_HEAD : HTTP_ANY;
+    currentUri = requestLine.substr(methodEnd + 1, uriEnd - methodEnd - 1);
+
+    size_t lineStart = lineEnd + 2;
+    while ((lineEnd = request.find("\r\n", lineStart)) != std::string::npos && lineEnd > lineStart) {
+      const std::string line = request.substr(lineStart, lineEnd - lineStart);
+      const size_t colon = line.find(':');
+      if (colon != std::string::npos) {
+        const size_t valueStart = line.find_first_not_of(' ', colon + 1);
+        requestHeaders[lower(line.substr(0, colon))] = valueStart == std::string::npos ? "" : line.substr(valueStart);
+      }
+      lineStart = lineEnd + 2;
+    }
+    return true;
+  }
+
+  // Closes the connection of the current request
+  void finish() {
+    if (clientFd >= 0) {
+      ::close(clientFd);
+      clientFd = -1;
+    }
+  }
+
+  HTTPMethod method() const { return currentMethod; }
+  const String& uri() const { return currentUri; }
+
+  String header(const String& name) const {
+    const auto it = requestHeaders.find(lower(name.str()));
+    return it == requestHeaders.end() ? String() : String(it->second);
+  }
+
+  void sendHeader(const String& name, const String& value, bool = false) {
+    responseHeaders += name.str() + ": " + value.str() + "\r\n";
+  }
+
+  void setContentLength(const size_t length) { contentLength = length; }
+
+  void send(const int code, const char* contentType, const String& content) {
+    std::string response = "HTTP/1.1 " + std::to_string(code) + " " + reason(code) + "\r\n";
+    response += std::string("Content-Type: ") + contentType + "\r\n";
+    response += "Content-Length: " + std::to_string(content.isEmpty() ? contentLength : content.length()) + "\r\n";
+    response += "Connection: close\r\n" + responseHeaders + "\r\n";
+    if (currentMethod != HTTP_HEAD) {
+      response += content.str();
+    }
+    client().write(reinterpret_cast<const uint8_t*>(response.data()), response.size());
+  }
+
+  NetworkClient client() const { return NetworkClient(clientFd); }
+};
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <cmath>
 #include <fstream>
 #include <functional>
@@ -302,9 +303,40 @@ void printResults(const std::string& language, const std::vector<TestCase>& test
   }
 }
 
+// Hyphenates every test word of the language repeatedly for about half a second. Codepoints are collected up front so
+// the rate is that of the pattern lookup, which is what page layout pays for each word.
+void printThroughput(const LanguageConfig& lang, const LanguageHyphenator& hyphenator,
+                     const std::vector<TestCase>& testCases) {
+  std::vector<std::vector<CodepointInfo>> words;
+  words.reserve(testCases.size());
+  for (const auto& testCase : testCases) {
+    auto cps = collectCodepoints(testCase.word);
+    trimSurroundingPunctuationAndFootnote(cps);
+    words.push_back(std::move(cps));
+  }
+
+  size_t hyphenated = 0;
+  size_t breaks = 0;
+  const auto start = std::chrono::steady_clock::now();
+  double seconds = 0.0;
+  do {
+    for (const auto& cps : words) {
+      breaks += hyphenator.breakIndexes(cps).size();
+    }
+    hyphenated += words.size();
+    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  } while (seconds < 0.5);
+
+  std::cout << lang.cliName << ": " << static_cast<long long>(hyphenated / seconds) << " words/sec ("
+            << breaks / (hyphenated / words.size()) << " breaks in " << words.size() << " words)" << std::endl;
+}
+
 int main(int argc, char* argv[]) {
-  const bool summaryMode = argc <= 1;
-  const std::string languageSelection = summaryMode ? "all" : argv[1];
+  // --throughput [language] times the hyphenators instead of scoring them
+  const bool throughputMode = argc > 1 && std::string(argv[1]) == "--throughput";
+  const int languageArg = throughputMode ? 2 : 1;
+  const bool summaryMode = argc <= languageArg || throughputMode;
+  const std::string languageSelection = argc > languageArg ? argv[languageArg] : "all";
 
   std::vector<LanguageConfig> languages = resolveLanguages(languageSelection);
   if (languages.empty()) {
@@ -337,6 +369,11 @@ int main(int argc, char* argv[]) {
       std::cout << std::endl;
     }
 
+    if (throughputMode) {
+      printThroughput(lang, *hyphenator, testCases);
+      continue;
+    }
+
     int perfectMatches = 0;
     int partialMatches = 0;
     int completeMisses = 0;
@@ -0,0 +1,432 @@
+#include <InflateReader.h>
+#include <builtinFonts/all.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+// Round-trips uzlib (through InflateReader) against system zlib, and times both.
+//
+// The streams are the deflated entries of the test EPUBs, the compressed groups of the built-in fonts, the IDAT data
+// of the PNGs in the tree and in the EPUBs, and text and binary data deflated here at every level and strategy (stored,
+// fixed and dynamic blocks, and skewed data for 15-bit codes). Each is inflated one-shot, and streamed from input
+// chunks of 1, 13 and 4096 bytes into output chunks of 1, 509 and 8192 bytes. zlib-wrapped streams also have their
+// Adler-32 read after the end of the deflate data, which checks the bit reader gives back the bytes it read ahead.
+// Truncated streams must fail, and damaged ones must not crash or write out of bounds (run under ASan by
+// test/run_inflate.sh).
+//
+//   --check   correctness only (default runs both)
+//   --bench   timing only
+
+namespace {
+using Bytes = std::vector<uint8_t>;
+
+struct Stream {
+  std::string group;  // epub, font, png or synthetic
+  std::string name;
+  Bytes deflated;     // raw deflate, or zlib-wrapped when `zlib`
+  bool zlib = false;
+  Bytes expected;
+};
+
+int failures = 0;
+
+void fail(const Stream& stream, const std::string& what) {
+  if (failures++ < 20) {
+    std::cout << "FAIL: " << stream.group << " " << stream.name << ": " << what << "\n";
+  }
+}
+
+Bytes readFile(const std::filesystem::path& path) {
+  std::ifstream in(path, std::ios::binary);
+  return Bytes(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+uint32_t le32(const uint8_t* p) { return p[0] | p[1] << 8 | p[2] << 16 | static_cast<uint32_t>(p[3]) << 24; }
+uint16_t le16(const uint8_t* p) { return static_cast<uint16_t>(p[0] | p[1] << 8); }
+uint32_t be32(const uint8_t* p) { return static_cast<uint32_t>(p[0]) << 24 | p[1] << 16 | p[2] << 8 | p[3]; }
+
+bool zlibInflate(const Bytes& in, const bool wrapped, Bytes& out, const size_t sizeHint) {
+  z_stream z{};
+  if (inflateInit2(&z, wrapped ? 15 : -15) != Z_OK) {
+    return false;
+  }
+  out.assign(std::max<size_t>(sizeHint, 1024), 0);
+  z.next_in = const_cast<Bytef*>(in.data());
+  z.avail_in = static_cast<uInt>(in.size());
+  int res;
+  do {
+    if (z.total_out == out.size()) {
+      out.resize(out.size() * 2);
+    }
+    z.next_out = out.data() + z.total_out;
+    z.avail_out = static_cast<uInt>(out.size() - z.total_out);
+    res = inflate(&z, Z_NO_FLUSH);
+  } while (res == Z_OK);
+  out.resize(z.total_out);
+  inflateEnd(&z);
+  return res == Z_STREAM_END;
+}
+
+Bytes zlibDeflate(const Bytes& in, const int level, const int strategy) {
+  z_stream z{};
+  deflateInit2(&z, level, Z_DEFLATED, -15, 9, strategy);
+  Bytes out(deflateBound(&z, in.size()));
+  z.next_in = const_cast<Bytef*>(in.data());
+  z.avail_in = static_cast<uInt>(in.size());
+  z.next_out = out.data();
+  z.avail_out = static_cast<uInt>(out.size());
+  deflate(&z, Z_FINISH);
+  out.resize(z.total_out);
+  deflateEnd(&z);
+  return out;
+}
+
+// Deflated entries of a ZIP, found through its central directory
+void addZipEntries(const std::filesystem::path& path, std::vector<Stream>& streams, std::vector<Bytes>& pngs) {
+  const Bytes zip = readFile(path);
+  size_t eocd = zip.size() - 22;
+  while (eocd > 0 && le32(&zip[eocd]) != 0x06054b50) eocd--;
+  size_t entry = le32(&zip[eocd + 16]);
+  for (uint16_t i = 0; i < le16(&zip[eocd + 10]); i++) {
+    const uint16_t method = le16(&zip[entry + 10]);
+    const uint32_t compressedSize = le32(&zip[entry + 20]);
+    const uint32_t size = le32(&zip[entry + 24]);
+    const uint16_t nameLength = le16(&zip[entry + 28]);
+    const std::string name(reinterpret_cast<const char*>(&zip[entry + 46]), nameLength);
+    const uint32_t local = le32(&zip[entry + 42]);
+    const size_t data = local + 30 + le16(&zip[local + 26]) + le16(&zip[local + 28]);
+    entry += 46 + nameLength + le16(&zip[entry + 30]) + le16(&zip[entry + 32]);
+
+    Bytes contents;
+    if (method == 8) {
+      Stream stream{"epub", path.filename().string() + ":" + name,
+                    Bytes(zip.begin() + data, zip.begin() + data + compressedSize), false, {}};
+      if (!zlibInflate(stream.deflated, false, stream.expected, size)) {
+        std::cerr << "zlib can't inflate " << stream.name << "\n";
+        continue;
+      }
+      contents = stream.expected;
+      streams.push_back(std::move(stream));
+    } else if (method == 0) {
+      contents.assign(zip.begin() + data, zip.begin() + data + size);
+    }
+    if (name.size() > 4 && name.compare(name.size() - 4, 4, ".png") == 0) {
+      pngs.push_back(contents);
+    }
+  }
+}
+
+// The zlib stream of a PNG: its IDAT chunks, concatenated
+void addPng(const std::string& name, const Bytes& png, std::vector<Stream>& streams) {
+  Stream stream{"png", name, {}, true, {}};
+  for (size_t chunk = 8; chunk + 12 <= png.size();) {
+    const uint32_t length = be32(&png[chunk]);
+    if (memcmp(&png[chunk + 4], "IDAT", 4) == 0) {
+      stream.deflated.insert(stream.deflated.end(), png.begin() + chunk + 8, png.begin() + chunk + 8 + length);
+    }
+    chunk += 12 + length;
+  }
+  if (!stream.deflated.empty() && zlibInflate(stream.deflated, true, stream.expected, 0)) {
+    streams.push_back(std::move(stream));
+  }
+}
+
+void addFont(const char* name, const EpdFontData& font, std::vector<Stream>& streams) {
+  for (uint16_t i = 0; i < font.groupCount; i++) {
+    const EpdFontGroup& group = font.groups[i];
+    const uint8_t* data = font.bitmap + group.compressedOffset;
+    Stream stream{"font", std::string(name) + "#" + std::to_string(i), Bytes(data, data + group.compressedSize), false,
+                  {}};
+    if (zlibInflate(stream.deflated, false, stream.expected, group.uncompressedSize) &&
+        stream.expected.size() == group.uncompressedSize) {
+      streams.push_back(std::move(stream));
+    }
+  }
+}
+
+void addSynthetic(const Bytes& text, std::vector<Stream>& streams) {
+  std::mt19937 random(7);
+  Bytes noise(65536);
+  for (auto& byte : noise) byte = static_cast<uint8_t>(random());
+  // Symbol frequencies falling off like Fibonacci numbers give the longest codes deflate allows
+  Bytes skewed;
+  uint32_t a = 1, b = 1;
+  for (int symbol = 0; symbol < 24 && skewed.size() < 400000; symbol++) {
+    skewed.insert(skewed.end(), a, static_cast<uint8_t>(symbol * 7));
+    const uint32_t next = a + b;
+    a = b;
+    b = next;
+  }
+  std::shuffle(skewed.begin(), skewed.end(), random);
+
+  const struct {
+    const char* name;
+    const Bytes& data;
+  } inputs[] = {{"text", text}, {"noise", noise}, {"skewed", skewed}};
+  const struct {
+    const char* name;
+    int strategy;
+  } strategies[] = {{"default", Z_DEFAULT_STRATEGY}, {"fixed", Z_FIXED}, {"huffman", Z_HUFFMAN_ONLY}, {"rle", Z_RLE}};
+  for (const auto& input : inputs) {
+    for (const int level : {0, 1, 6, 9}) {
+      for (const auto& strategy : strategies) {
+        if (level == 0 && strategy.strategy != Z_DEFAULT_STRATEGY) {
+          continue;
+        }
+        streams.push_back({"synthetic", std::string(input.name) + "/" + std::to_string(level) + "/" + strategy.name,
+                           zlibDeflate(input.data, level, strategy.strategy), false, input.data});
+      }
+    }
+  }
+}
+
+// Raw deflate data of a stream; zlib-wrapped ones are read through InflateReader::skipZlibHeader instead
+const uint8_t* deflateData(const Stream& stream) { return stream.deflated.data() + (stream.zlib ? 2 : 0); }
+
+bool checkTrailer(InflateReader& reader, const Stream& stream) {
+  if (!stream.zlib) {
+    return true;
+  }
+  uint8_t trailer[4];
+  for (auto& byte : trailer) byte = uzlib_get_byte(reader.raw());
+  return be32(trailer) == be32(&stream.deflated[stream.deflated.size() - 4]);
+}
+
+void checkOneShot(const Stream& stream) {
+  Bytes out(stream.expected.size() + 1, 0xAA);
+  InflateReader reader;
+  reader.init(false);
+  reader.setSource(stream.deflated.data(), stream.deflated.size());
+  if (stream.zlib) {
+    reader.skipZlibHeader();
+  }
+  if (!reader.read(out.data(), stream.expected.size())) {
+    fail(stream, "one-shot read failed");
+  } else if (!std::equal(stream.expected.begin(), stream.expected.end(), out.begin()) || out.back() != 0xAA) {
+    fail(stream, "one-shot output differs");
+  }
+}
+
+struct ChunkedSource {
+  InflateReader reader;  // Must be first — the callback casts uzlib_uncomp* to ChunkedSource*
+  const uint8_t* next = nullptr;
+  const uint8_t* end = nullptr;
+  size_t chunkSize = 0;
+};
+
+int chunkedRead(uzlib_uncomp* uncomp) {
+  auto* source = reinterpret_cast<ChunkedSource*>(uncomp);
+  if (source->next >= source->end) return -1;
+  const size_t length = std::min<size_t>(source->chunkSize, source->end - source->next);
+  uncomp->source = source->next + 1;
+  uncomp->source_limit = source->next + length;
+  source->next += length;
+  return uncomp->source[-1];
+}
+
+// Streams `length` bytes of the stream's input through `inChunk` sized reads into `outChunk` sized outputs
+InflateStatus stream(const Stream& stream, const size_t length, const size_t inChunk, const size_t outChunk, Bytes& out,
+                     ChunkedSource& source) {
+  source.reader.init(true);
+  source.reader.setReadCallback(chunkedRead);
+  source.next = stream.deflated.data();
+  source.end = stream.deflated.data() + length;
+  source.chunkSize = inChunk;
+  if (stream.zlib) {
+    source.reader.skipZlibHeader();
+  }
+  out.clear();
+  Bytes buffer(outChunk);
+  InflateStatus status;
+  do {
+    size_t produced = 0;
+    status = source.reader.readAtMost(buffer.data(), outChunk, &produced);
+    out.insert(out.end(), buffer.begin(), buffer.begin() + produced);
+  } while (status == InflateStatus::Ok && out.size() <= stream.expected.size() + outChunk);
+  return status;
+}
+
+void checkStreaming(const Stream& stream) {
+  ChunkedSource source;
+  Bytes out;
+  for (const size_t inChunk : {1, 13, 4096}) {
+    for (const size_t outChunk : {1, 509, 8192}) {
+      if (inChunk * outChunk == 1 && stream.expected.size() > 200000) {
+        continue;  // byte at a time in both directions takes too long for big streams
+      }
+      const std::string mode = " (in " + std::to_string(inChunk) + ", out " + std::to_string(outChunk) + ")";
+      if (::stream(stream, stream.deflated.size(), inChunk, outChunk, out, source) != InflateStatus::Done) {
+        fail(stream, "streaming didn't finish" + mode);
+      } else if (out != stream.expected) {
+        fail(stream, "streaming output differs" + mode);
+      } else if (!checkTrailer(source.reader, stream)) {
+        fail(stream, "streaming trailer misread" + mode);
+      }
+    }
+  }
+}
+
+void checkDamaged(const Stream& stream, std::mt19937& random) {
+  const size_t deflateEnd = stream.deflated.size() - (stream.zlib ? 4 : 0);
+  Bytes out(stream.expected.size() + 64);
+  for (int i = 0; i < 4; i++) {
+    // Every byte of the deflate data carries bits of the stream, so without any of them it must not end cleanly.
+    // (read() may still succeed when only the end-of-block code is missing, as it stops once it has `len` bytes.)
+    const size_t length = (stream.zlib ? 2 : 0) + random() % (deflateEnd - (stream.zlib ? 2 : 0));
+    InflateReader reader;
+    reader.init(false);
+    reader.setSource(stream.deflated.data(), length);
+    if (stream.zlib) {
+      reader.skipZlibHeader();
+    }
+    size_t produced = 0;
+    if (reader.readAtMost(out.data(), out.size(), &produced) == InflateStatus::Done) {
+      fail(stream, "truncated to " + std::to_string(length) + " bytes but ended cleanly");
+    }
+  }
+  for (int i = 0; i < 4; i++) {
+    Stream damaged = stream;
+    damaged.deflated[(stream.zlib ? 2 : 0) + random() % (deflateEnd - (stream.zlib ? 2 : 0))] ^= 1 << (random() % 8);
+    InflateReader reader;
+    reader.init(false);
+    reader.setSource(damaged.deflated.data(), damaged.deflated.size());
+    if (stream.zlib) {
+      reader.skipZlibHeader();
+    }
+    reader.read(out.data(), stream.expected.size());
+    ChunkedSource source;
+    ::stream(damaged, damaged.deflated.size(), 4096, 8192, out, source);
+  }
+}
+
+double throughput(const std::vector<const Stream*>& streams, const bool useZlib) {
+  size_t bytes = 0;
+  size_t maxSize = 0;
+  for (const Stream* stream : streams) maxSize = std::max(maxSize, stream->expected.size());
+  Bytes out(maxSize);
+  const auto start = std::chrono::steady_clock::now();
+  double seconds = 0;
+  do {
+    for (const Stream* stream : streams) {
+      if (useZlib) {
+        z_stream z{};
+        inflateInit2(&z, stream->zlib ? 15 : -15);
+        z.next_in = const_cast<Bytef*>(stream->deflated.data());
+        z.avail_in = static_cast<uInt>(stream->deflated.size());
+        z.next_out = out.data();
+        z.avail_out = static_cast<uInt>(stream->expected.size());
+        inflate(&z, Z_FINISH);
+        inflateEnd(&z);
+      } else {
+        InflateReader reader;
+        reader.init(false);
+        reader.setSource(deflateData(*stream), stream->deflated.size() - (stream->zlib ? 2 : 0));
+        reader.read(out.data(), stream->expected.size());
+      }
+      bytes += stream->expected.size();
+    }
+    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  } while (seconds < 0.5);
+  return bytes / seconds / 1e6;
+}
+}  // namespace
+
+int main(const int argc, char** argv) {
+  bool check = true;
+  bool bench = true;
+  std::filesystem::path root = ".";
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    if (arg == "--check") {
+      bench = false;
+    } else if (arg == "--bench") {
+      check = false;
+    } else if (arg == "--root" && i + 1 < argc) {
+      root = argv[++i];
+    } else {
+      std::cerr << "usage: " << argv[0] << " [--check | --bench] [--root DIR]\n";
+      return 2;
+    }
+  }
+
+  std::vector<Stream> streams;
+  std::vector<Bytes> pngs;
+  for (const auto& entry : std::filesystem::directory_iterator(root / "test/epubs")) {
+    if (entry.path().extension() == ".epub") {
+      addZipEntries(entry.path(), streams, pngs);
+    }
+  }
+  for (size_t i = 0; i < pngs.size(); i++) {
+    addPng("epub image " + std::to_string(i), pngs[i], streams);
+  }
+  for (const char* png : {"src/images/Logo120.png", "docs/images/wifi/webserver_homepage.png",
+                          "docs/images/wifi/webserver_upload.png", "docs/images/wifi/webserver_files.png"}) {
+    if (std::filesystem::exists(root / png)) {
+      addPng(png, readFile(root / png), streams);
+    }
+  }
+  addFont("bookerly_14_regular", bookerly_14_regular, streams);
+  addFont("bookerly_14_bold", bookerly_14_bold, streams);
+  addFont("bookerly_14_italic", bookerly_14_italic, streams);
+  addFont("notosans_8_regular", notosans_8_regular, streams);
+  addFont("ubuntu_10_regular", ubuntu_10_regular, streams);
+  addFont("ubuntu_10_bold", ubuntu_10_bold, streams);
+  addFont("ubuntu_12_regular", ubuntu_12_regular, streams);
+  addFont("ubuntu_12_bold", ubuntu_12_bold, streams);
+  Bytes text;
+  for (const Stream& stream : streams) {
+    if (stream.group == "epub" && stream.name.find("htm") != std::string::npos) {
+      text.insert(text.end(), stream.expected.begin(), stream.expected.end());
+    }
+  }
+  addSynthetic(text, streams);
+
+  const char* groups[] = {"epub", "font", "png", "synthetic"};
+  for (const char* group : groups) {
+    size_t count = 0, in = 0, out = 0;
+    for (const Stream& stream : streams) {
+      if (stream.group == group) {
+        count++;
+        in += stream.deflated.size();
+        out += stream.expected.size();
+      }
+    }
+    std::printf("%-10s %4zu streams, %8zu bytes deflated, %9zu inflated\n", group, count, in, out);
+  }
+
+  if (check) {
+    std::mt19937 random(1);
+    for (const Stream& stream : streams) {
+      checkOneShot(stream);
+      checkStreaming(stream);
+      if (stream.deflated.size() > (stream.zlib ? 8u : 2u)) {
+        checkDamaged(stream, random);
+      }
+    }
+    std::cout << (failures == 0 ? "round trips: PASS" : "round trips: FAILED") << "\n";
+  }
+
+  if (bench) {
+    std::printf("%-10s %12s %12s\n", "", "uzlib MB/s", "zlib MB/s");
+    for (const char* group : groups) {
+      std::vector<const Stream*> selected;
+      for (const Stream& stream : streams) {
+        if (stream.group == group) selected.push_back(&stream);
+      }
+      std::printf("%-10s %12.1f %12.1f\n", group, throughput(selected, false), throughput(selected, true));
+    }
+  }
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,246 @@
+#include <Arduino.h>
+#include <HalStorage.h>
+#include <sys/time.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "src/network/ListingCache.h"
+
+// Checks ListingCache against listings sorted here, and times a page from a snapshot against walking the folder.
+//
+// A folder of --files files (and a few folders, hidden items and names that only differ past their 8th byte) is made
+// in a local directory standing in for the SD card. Every order is listed whole and in pages and compared with the
+// folder walked and sorted here; then the snapshot must survive until invalidated, and a heap too small for a snapshot
+// must fall back to walking the folder.
+
+namespace {
+using Entries = std::vector<ListingCache::Entry>;
+
+struct Options {
+  int files = 3000;
+  int pageSize = 50;
+  std::string card;
+};
+
+int failures = 0;
+
+void check(const bool condition, const std::string& what) {
+  if (!condition) {
+    std::cout << "FAIL: " << what << "\n";
+    failures++;
+  }
+}
+
+int compareNames(const std::string& a, const std::string& b) {
+  const size_t length = std::min(a.size(), b.size());
+  for (size_t i = 0; i < length; i++) {
+    const int ca = std::tolower(static_cast<unsigned char>(a[i]));
+    const int cb = std::tolower(static_cast<unsigned char>(b[i]));
+    if (ca != cb) {
+      return ca < cb ? -1 : 1;
+    }
+  }
+  return a.size() == b.size() ? 0 : (a.size() < b.size() ? -1 : 1);
+}
+
+void makeCard(const Options& options) {
+  namespace fs = std::filesystem;
+  fs::remove_all(options.card);
+  fs::create_directories(options.card + "/Books");
+  std::mt19937 random(42);
+  const char* prefixes[] = {"Chapter ", "chapter ", "The Adventures of ", "A", "zebra", "Éclair "};
+  for (int i = 0; i < options.files; i++) {
+    const std::string name = std::string(prefixes[random() % 6]) + std::to_string(random() % (options.files * 4)) +
+                             (random() % 2 ? ".epub" : ".TXT");
+    const std::string path = options.card + "/Books/" + name;
+    if (fs::exists(path)) {
+      continue;
+    }
+    std::ofstream(path).close();
+    fs::resize_file(path, random() % 2000000);
+    const timeval times[2] = {{1600000000 + static_cast<time_t>(random() % 100000000), 0},
+                              {1600000000 + static_cast<time_t>(random() % 100000000), 0}};
+    utimes(path.c_str(), times);
+  }
+  for (const char* folder : {"Series", "archive", "XTCache", ".hidden-folder"}) {
+    fs::create_directories(options.card + "/Books/" + folder);
+  }
+  std::ofstream(options.card + "/Books/.hidden").close();
+}
+
+// The folder as the card lists it, hidden items left out
+Entries walk(const std::string& folder) {
+  Entries entries;
+  HalFile dir = Storage.open(folder.c_str());
+  char name[500];
+  for (HalFile file = dir.openNextFile(); file; file = dir.openNextFile()) {
+    file.getName(name, sizeof(name));
+    if (ListingCache::isHidden(name)) {
+      continue;
+    }
+    ListingCache::Entry entry;
+    uint16_t date, time;
+    file.getModifyDateTime(&date, &time);
+    entry.name = name;
+    entry.isDirectory = file.isDirectory();
+    entry.size = entry.isDirectory ? 0 : file.size();
+    entry.modified = static_cast<uint32_t>(date) << 16 | time;
+    entries.push_back(entry);
+  }
+  return entries;
+}
+
+Entries expected(Entries entries, const ListingCache::Order order, const bool descending) {
+  if (order != ListingCache::Order::Directory) {
+    std::stable_sort(entries.begin(), entries.end(), [](const ListingCache::Entry& a, const ListingCache::Entry& b) {
+      if (a.isDirectory != b.isDirectory) {
+        return a.isDirectory;
+      }
+      return compareNames(a.name, b.name) < 0;
+    });
+  }
+  if (order == ListingCache::Order::Size) {
+    std::stable_sort(entries.begin(), entries.end(),
+                     [](const ListingCache::Entry& a, const ListingCache::Entry& b) { return a.size < b.size; });
+  } else if (order == ListingCache::Order::Modified) {
+    std::stable_sort(entries.begin(), entries.end(), [](const ListingCache::Entry& a, const ListingCache::Entry& b) {
+      return a.modified < b.modified;
+    });
+  }
+  if (descending) {
+    std::reverse(entries.begin(), entries.end());
+  }
+  return entries;
+}
+
+Entries list(const std::string& folder, const ListingCache::Order order, const bool descending, const size_t offset,
+             const size_t limit, int32_t& total) {
+  Entries entries;
+  total = ListingCache::list(folder, order, descending, offset, limit, [&entries](const ListingCache::Entry& entry) {
+    entries.push_back(entry);
+    return true;
+  });
+  return entries;
+}
+
+bool same(const Entries& a, const Entries& b) {
+  return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](const auto& x, const auto& y) {
+           return x.name == y.name && x.isDirectory == y.isDirectory && x.size == y.size && x.modified == y.modified;
+         });
+}
+
+double millisecondsSince(const std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+}  // namespace
+
+int main(const int argc, char** argv) {
+  Options options;
+  options.card = argc > 0 ? std::string(argv[0]) + ".card" : "card";
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    if (arg == "--files" && i + 1 < argc) {
+      options.files = std::atoi(argv[++i]);
+    } else if (arg == "--page" && i + 1 < argc) {
+      options.pageSize = std::atoi(argv[++i]);
+    } else if (arg == "--card" && i + 1 < argc) {
+      options.card = argv[++i];
+    } else {
+      std::cerr << "usage: " << argv[0] << " [--files N] [--page N] [--card DIR]\n";
+      return 2;
+    }
+  }
+
+  makeCard(options);
+  Storage.root = options.card;
+  const Entries directoryOrder = walk("/Books");
+  std::cout << "folder: " << directoryOrder.size() << " visible entries\n";
+
+  using Order = ListingCache::Order;
+  int32_t total = 0;
+  auto start = std::chrono::steady_clock::now();
+  list("/Books", Order::Name, false, 0, 0, total);
+  std::cout << "first listing (builds the snapshot): " << millisecondsSince(start) << " ms\n";
+  check(total == static_cast<int32_t>(directoryOrder.size()), "total count");
+  check(Storage.exists("/.crosspoint/listings"), "snapshot written");
+
+  for (const Order order : {Order::Directory, Order::Name, Order::Size, Order::Modified}) {
+    for (const bool descending : {false, true}) {
+      const std::string what = "order " + std::to_string(static_cast<int>(order)) + (descending ? " desc" : " asc");
+      const Entries want = expected(directoryOrder, order, descending);
+      check(same(list("/Books", order, descending, 0, SIZE_MAX, total), want), what + " whole");
+
+      Entries paged;
+      for (size_t offset = 0;; offset += options.pageSize) {
+        const Entries page = list("/Books", order, descending, offset, options.pageSize, total);
+        if (page.empty()) {
+          break;
+        }
+        paged.insert(paged.end(), page.begin(), page.end());
+      }
+      check(same(paged, want), what + " paged");
+    }
+  }
+
+  Entries stopped;
+  ListingCache::list("/Books", Order::Name, false, 0, SIZE_MAX, [&stopped](const ListingCache::Entry& entry) {
+    stopped.push_back(entry);
+    return stopped.size() < 3;
+  });
+  check(stopped.size() == 3, "visit returning false stops the listing");
+  check(ListingCache::list("/Books/missing", Order::Name, false, 0, 10, [](const auto&) { return true; }) == -1,
+        "missing folder");
+  check(list("/", Order::Name, false, 0, SIZE_MAX, total).size() == 1 && total == 1, "root hides .crosspoint");
+  check(ListingCache::prepare("/Books") && !ListingCache::prepare("/Books/missing"), "prepare");
+
+  // Changes only show once the folder is invalidated
+  std::ofstream(options.card + "/Books/!new book.epub").close();
+  list("/Books", Order::Name, false, 0, 1, total);
+  check(total == static_cast<int32_t>(directoryOrder.size()), "snapshot kept until invalidated");
+  ListingCache::invalidateParent("/Books/!new book.epub");
+  const Entries first = list("/Books/", Order::Name, false, 2, 1, total);
+  check(total == static_cast<int32_t>(directoryOrder.size() + 1), "count after invalidating");
+  check(first.size() == 1 && first[0].name == "!new book.epub", "new file listed in order");
+
+  // A page from the snapshot against walking the whole folder, as the server did before
+  const size_t middle = directoryOrder.size() / 2;
+  Storage.opens = 0;
+  start = std::chrono::steady_clock::now();
+  const Entries page = list("/Books", Order::Modified, true, middle, options.pageSize, total);
+  const double cachedMs = millisecondsSince(start);
+  const size_t cachedOpens = Storage.opens;
+
+  ESP.freeHeap = 40 * 1024;
+  ListingCache::clear();
+  check(!ListingCache::prepare("/Books"), "no snapshot to prepare without memory");
+  Storage.opens = 0;
+  start = std::chrono::steady_clock::now();
+  const Entries walked = list("/Books", Order::Modified, true, middle, options.pageSize, total);
+  const double walkedMs = millisecondsSince(start);
+  const size_t walkedOpens = Storage.opens;
+  ESP.freeHeap = 200 * 1024;
+
+  check(walked.size() == static_cast<size_t>(options.pageSize) && total == static_cast<int32_t>(walk("/Books").size()),
+        "listing without memory for a snapshot");
+  check(!Storage.exists("/.crosspoint/listings") || std::filesystem::is_empty(options.card + "/.crosspoint/listings"),
+        "no snapshot left without memory");
+  check(page.size() == static_cast<size_t>(options.pageSize), "page size");
+
+  std::cout << "page of " << options.pageSize << " from the snapshot: " << cachedMs << " ms, " << cachedOpens
+            << " opens\n";
+  std::cout << "page of " << options.pageSize << " walking the folder: " << walkedMs << " ms, " << walkedOpens
+            << " opens\n";
+
+  std::filesystem::remove_all(options.card);
+  std::cout << (failures == 0 ? "PASS" : "FAILED") << "\n";
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,311 @@
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "lib/Logging/LogRing.h"
+
+// Checks LogRing against what the firmware relies on: messages formatted at drain time read exactly as printf would
+// have printed them at the call site, records come out whole and in order across the wrap, a full ring drops and
+// counts instead of blocking, and concurrent writers never interleave. With --bench, compares the cost of recording a
+// message against formatting it on the spot.
+namespace {
+
+int failures = 0;
+
+void fail(const std::string& what) {
+  std::cerr << "FAIL " << what << std::endl;
+  failures++;
+}
+
+template <typename... Args>
+std::string formatDeferred(const LogSite& site, const Args&... args) {
+  alignas(8) static uint8_t storage[1024];
+  memset(storage, 0, sizeof(storage));
+  LogRing ring(storage, sizeof(storage));
+  if (!ring.write(1, &site, args...)) {
+    return "<dropped>";
+  }
+  LogRing::Record record;
+  if (!ring.read(record)) {
+    return "<missing>";
+  }
+  char out[256];
+  formatLogMessage(record, out, sizeof(out));
+  ring.release();
+  return out;
+}
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-security"
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+template <typename... Args>
+void checkFormat(const char* format, const Args&... args) {
+  const LogSite site{'I', "TEST", format};
+  char expected[256];
+  snprintf(expected, sizeof(expected), format, args...);
+  const std::string actual = formatDeferred(site, args...);
+  if (actual != expected) {
+    fail(std::string("format \"") + format + "\": expected \"" + expected + "\", got \"" + actual + "\"");
+  }
+}
+#pragma GCC diagnostic pop
+
+void checkFormats() {
+  const char* const nullString = nullptr;
+  const std::string longString(LogRing::MAX_STRING + 20, 'a');
+  const std::string path = "/books/Some Book.epub";
+  const int array[2] = {1, 2};
+
+  checkFormat("plain text\n");
+  checkFormat("100%% done\n");
+  checkFormat("%d %i %u\n", -42, 42, 42u);
+  checkFormat("%d\n", INT32_MIN);
+  checkFormat("%u %x %X %o\n", UINT32_MAX, 0xdeadbeefu, 0xcafeu, 8u);
+  checkFormat("%lu ms\n", 123456789ul);
+  checkFormat("%ld\n", -5l);
+  checkFormat("%lld %llu\n", INT64_MIN, UINT64_MAX);
+  checkFormat("%" PRIu64 " bytes\n", uint64_t{1} << 40);
+  checkFormat("%zu items\n", size_t{17});
+  checkFormat("%5d|%-5d|%05d|%+d\n", 7, 7, 7, 7);
+  checkFormat("%08x %#x\n", 0x1234u, 0x1234u);
+  checkFormat("%.2f %8.3f %e %g\n", 3.14159, 2.5, 1e-7, 0.0001);
+  checkFormat("%.1f%%\n", 99.94f);
+  checkFormat("%s\n", "hello");
+  checkFormat("[%10s] [%-10s] [%.3s]\n", "right", "left", "truncated");
+  checkFormat("%s: %d/%d\n", path.c_str(), 3, 10);
+  checkFormat("%c%c\n", 'o', 'k');
+  checkFormat("%*d|%-*d|%.*s\n", 6, 42, 4, 1, 2, "abc");
+  checkFormat("%d %s %u %s %d %s %u %s %d %s\n", 1, "a", 2u, "b", 3, "c", 4u, "d", 5, "e");
+  checkFormat("%p\n", static_cast<const void*>(array));
+  checkFormat("%d %d\n", true, false);
+
+  // Differences that are deliberate: null strings print as glibc does, long strings are cut
+  const LogSite nullSite{'I', "TEST", "%s\n"};
+  if (formatDeferred(nullSite, nullString) != "(null)\n") {
+    fail("null string");
+  }
+  const std::string cut = formatDeferred(nullSite, longString.c_str());
+  if (cut != longString.substr(0, LogRing::MAX_STRING) + "\xE2\x80\xA6\n") {
+    fail("long string cut to MAX_STRING and marked, got \"" + cut + "\"");
+  }
+  const std::string exact(LogRing::MAX_STRING, 'x');
+  if (formatDeferred(nullSite, exact.c_str()) != exact + "\n") {
+    fail("string of exactly MAX_STRING bytes is not marked");
+  }
+  // A cut never splits a UTF-8 character: "é" straddling the limit is left out whole
+  const std::string accented = std::string(LogRing::MAX_STRING - 1, 'x') + "\xC3\xA9 and more";
+  if (formatDeferred(nullSite, accented.c_str()) != std::string(LogRing::MAX_STRING - 1, 'x') + "\xE2\x80\xA6\n") {
+    fail("cut at a UTF-8 character boundary");
+  }
+  // More conversions than arguments must not read past the record
+  const LogSite missingSite{'I', "TEST", "%d and %s\n"};
+  if (formatDeferred(missingSite, 5) != "5 and %s\n") {
+    fail("missing argument");
+  }
+}
+
+// Writes records of varying size through a small ring, reading them back in bursts so the ring wraps many times
+void checkWrap() {
+  alignas(8) static uint8_t storage[256];
+  memset(storage, 0, sizeof(storage));
+  LogRing ring(storage, sizeof(storage));
+  const LogSite site{'D', "WRAP", "%u %s\n"};
+  const char* const words[] = {"", "a", "abc", "a longer string argument", "abcdefghijklmnopqrstuvwxyz0123456789"};
+
+  uint32_t written = 0;
+  uint32_t read = 0;
+  uint32_t dropped = 0;
+  for (uint32_t round = 0; round < 2000; round++) {
+    const uint32_t burst = round % 7;
+    for (uint32_t i = 0; i < burst; i++) {
+      if (ring.write(written, &site, written, words[written % 5])) {
+        written++;
+      } else {
+        dropped++;
+        break;
+      }
+    }
+    const uint32_t take = round % 5;
+    LogRing::Record record;
+    for (uint32_t i = 0; i < take && ring.read(record); i++) {
+      char out[128];
+      formatLogMessage(record, out, sizeof(out));
+      char expected[128];
+      snprintf(expected, sizeof(expected), "%u %s\n", read, words[read % 5]);
+      if (record.timestamp != read || strcmp(out, expected) != 0) {
+        fail("wrap: record " + std::to_string(read) + " read as \"" + out + "\"");
+        return;
+      }
+      ring.release();
+      read++;
+    }
+  }
+  LogRing::Record record;
+  while (ring.read(record)) {
+    ring.release();
+    read++;
+  }
+  if (read != written) {
+    fail("wrap: wrote " + std::to_string(written) + ", read " + std::to_string(read));
+  }
+  if (ring.takeDropped() != dropped || dropped == 0) {
+    fail("wrap: dropped count");
+  }
+  // A drained ring is all zeroes again, so stale data is never taken for a published record
+  for (const uint8_t byte : storage) {
+    if (byte != 0) {
+      fail("wrap: drained ring not cleared");
+      break;
+    }
+  }
+  std::cout << "wrap: " << written << " records through 256 bytes, " << dropped << " dropped while full" << std::endl;
+}
+
+// Several writers against one reader; each writer's records must arrive complete and in its own order. Writers retry
+// when the ring is full so that every record goes through.
+void checkConcurrentWriters() {
+  constexpr int WRITERS = 4;
+  constexpr uint32_t PER_WRITER = 50000;
+  alignas(8) static uint8_t storage[4096];
+  memset(storage, 0, sizeof(storage));
+  LogRing ring(storage, sizeof(storage));
+  static const LogSite sites[WRITERS] = {
+      {'I', "W0", "%u %s\n"}, {'I', "W1", "%u %s\n"}, {'I', "W2", "%u %s\n"}, {'I', "W3", "%u %s\n"}};
+  const char* const payload[] = {"x", "payload", "a somewhat longer payload string"};
+
+  std::atomic<int> running{WRITERS};
+  std::atomic<uint32_t> retries{0};
+  std::vector<std::thread> writers;
+  for (int w = 0; w < WRITERS; w++) {
+    writers.emplace_back([&, w] {
+      for (uint32_t i = 0; i < PER_WRITER; i++) {
+        while (!ring.write(i, &sites[w], i, payload[i % 3])) {
+          retries.fetch_add(1, std::memory_order_relaxed);
+          std::this_thread::yield();
+        }
+      }
+      running.fetch_sub(1);
+    });
+  }
+
+  uint32_t next[WRITERS] = {};
+  uint32_t received = 0;
+  uint32_t dropped = 0;
+  bool ordered = true;
+  LogRing::Record record;
+  while (true) {
+    const bool done = running.load() == 0;
+    while (ring.read(record)) {
+      const int w = static_cast<int>(record.site - sites);
+      char out[128];
+      formatLogMessage(record, out, sizeof(out));
+      char expected[128];
+      snprintf(expected, sizeof(expected), "%u %s\n", record.timestamp, payload[record.timestamp % 3]);
+      if (w < 0 || w >= WRITERS || record.timestamp != next[w] || strcmp(out, expected) != 0) {
+        ordered = false;
+      } else {
+        next[w] = record.timestamp + 1;
+      }
+      ring.release();
+      received++;
+    }
+    dropped += ring.takeDropped();
+    if (done) {
+      break;
+    }
+    std::this_thread::yield();
+  }
+  for (auto& writer : writers) {
+    writer.join();
+  }
+
+  if (!ordered) {
+    fail("concurrent: record out of order or corrupted");
+  }
+  if (received != WRITERS * PER_WRITER || dropped != retries.load()) {
+    fail("concurrent: received " + std::to_string(received) + ", dropped " + std::to_string(dropped) + " for " +
+         std::to_string(retries.load()) + " retries");
+  }
+  std::cout << "concurrent: " << received << " records from " << WRITERS << " writers in order, " << dropped
+            << " writes retried while full" << std::endl;
+}
+
+void bench() {
+  constexpr int ITERATIONS = 2000000;
+  alignas(8) static uint8_t storage[8192];
+  memset(storage, 0, sizeof(storage));
+  LogRing ring(storage, sizeof(storage));
+  static const LogSite site{'D', "EHP", "Parsed %s: %d words in %lu ms\n"};
+  const char* const file = "chapter12.xhtml";
+  using Clock = std::chrono::steady_clock;
+
+  // The call site's cost: record, with a reader freeing the space between batches as the drain task would
+  auto start = Clock::now();
+  LogRing::Record record;
+  for (int i = 0; i < ITERATIONS; i++) {
+    if (!ring.write(static_cast<uint32_t>(i), &site, file, i, static_cast<unsigned long>(i))) {
+      while (ring.read(record)) {
+        ring.release();
+      }
+    }
+  }
+  const double recordNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / ITERATIONS;
+  while (ring.read(record)) {
+    ring.release();
+  }
+
+  char line[256];
+  volatile size_t sink = 0;
+  start = Clock::now();
+  for (int i = 0; i < ITERATIONS; i++) {
+    sink = sink + static_cast<size_t>(
+                      snprintf(line, sizeof(line), site.format, file, i, static_cast<unsigned long>(i)));
+  }
+  const double snprintfNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / ITERATIONS;
+
+  ring.write(1, &site, file, 1, 1ul);
+  ring.read(record);
+  start = Clock::now();
+  for (int i = 0; i < ITERATIONS / 4; i++) {
+    sink = sink + formatLogMessage(record, line, sizeof(line));
+  }
+  const double drainNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / (ITERATIONS / 4);
+  ring.release();
+
+  printf("call site: %.1f ns to record vs %.1f ns to snprintf (%.1fx); drain formats in %.1f ns\n", recordNs,
+         snprintfNs, snprintfNs / recordNs, drainNs);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  bool runBench = false;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--bench") == 0) {
+      runBench = true;
+    } else {
+      std::cerr << "usage: " << argv[0] << " [--bench]" << std::endl;
+      return 2;
+    }
+  }
+
+  checkFormats();
+  checkWrap();
+  checkConcurrentWriters();
+  if (runBench) {
+    bench();
+  }
+
+  if (failures) {
+    std::cerr << failures << " check(s) failed" << std::endl;
+    return 1;
+  }
+  std::cout << "All checks passed" << std::endl;
+  return 0;
+}
@@ -0,0 +1,290 @@
+#include <HalStorage.h>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "src/network/OpdsFeedCache.h"
+
+// Browses a generated catalog through the feed cache, with a stand-in for the OPDS server that serves static files
+// from a local directory the way a plain web server does: ETag from size and modified time, Last-Modified, and 304
+// for a matching If-None-Match or If-Modified-Since. Checks that entries read back in windows match the feed, that
+// revalidation and back navigation cost a 304 or nothing, that next pages are appended on demand, and that a failed
+// or torn fetch leaves the cached copy as it was.
+namespace {
+namespace fs = std::filesystem;
+
+constexpr char HOST[] = "http://opds.test";
+
+int failures = 0;
+
+void check(const bool condition, const std::string& what) {
+  if (!condition) {
+    std::cerr << "FAIL " << what << std::endl;
+    failures++;
+  }
+}
+
+struct StaticServer {
+  std::string root;
+  bool offline = false;
+  size_t truncateNext = 0;  // Cut the next body to this many bytes, as a dropped connection would
+  int requests = 0;
+  int notModified = 0;
+  size_t bytesSent = 0;
+
+  OpdsFeedCache::FetchResult fetch(const std::string& href, std::string& etag, std::string& lastModified,
+                                   OpdsParser& parser) {
+    requests++;
+    if (offline) {
+      return OpdsFeedCache::FetchResult::FAILED;
+    }
+    std::string path = href.rfind(HOST, 0) == 0 ? href.substr(strlen(HOST)) : href;
+    std::error_code error;
+    const auto size = fs::file_size(root + path, error);
+    if (error) {
+      return OpdsFeedCache::FetchResult::FAILED;
+    }
+    const auto modified = fs::last_write_time(root + path).time_since_epoch().count();
+    const std::string fileEtag = "\"" + std::to_string(size) + "-" + std::to_string(modified) + "\"";
+    const std::string fileLastModified = std::to_string(modified);
+    const bool etagMatches = !etag.empty() && etag == fileEtag;
+    if (etagMatches || (etag.empty() && !lastModified.empty() && lastModified == fileLastModified)) {
+      notModified++;
+      return OpdsFeedCache::FetchResult::NOT_MODIFIED;
+    }
+    etag = fileEtag;
+    lastModified = fileLastModified;
+
+    std::ifstream in(root + path, std::ios::binary);
+    std::string body{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+    if (truncateNext > 0) {
+      body.resize(std::min(body.size(), truncateNext));
+      truncateNext = 0;
+    }
+    // In the pieces a TCP stream would deliver
+    for (size_t offset = 0; offset < body.size(); offset += 700) {
+      const size_t length = std::min<size_t>(700, body.size() - offset);
+      parser.write(reinterpret_cast<const uint8_t*>(body.data() + offset), length);
+    }
+    parser.flush();
+    bytesSent += body.size();
+    return OpdsFeedCache::FetchResult::FETCHED;
+  }
+};
+
+StaticServer server;
+
+void writeServerFile(const std::string& path, const std::string& content) {
+  fs::create_directories(fs::path(server.root + path).parent_path());
+  std::ofstream(server.root + path, std::ios::binary) << content;
+}
+
+std::string feedXml(const std::string& self, const std::string& next, const std::string& entries) {
+  std::string xml = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<feed xmlns=\"http://www.w3.org/2005/Atom\">\n";
+  xml += "<id>urn:feed:" + self + "</id><title>Feed " + self + "</title>\n";
+  xml += "<link rel=\"self\" href=\"" + self + "\" type=\"application/atom+xml;profile=opds-catalog\"/>\n";
+  if (!next.empty()) {
+    xml += "<link rel=\"next\" href=\"" + next + "\" type=\"application/atom+xml;profile=opds-catalog\"/>\n";
+  }
+  return xml + entries + "</feed>\n";
+}
+
+std::string bookXml(const int number) {
+  const std::string n = std::to_string(number);
+  return "<entry><title>Book " + n + "</title><id>urn:book:" + n + "</id><author><name>Author " + n +
+         "</name></author><link rel=\"http://opds-spec.org/acquisition\" type=\"application/epub+zip\" "
+         "href=\"/get/" + n + ".epub\"/></entry>\n";
+}
+
+std::string navigationXml(const std::string& title, const std::string& href) {
+  return "<entry><title>" + title + "</title><id>urn:nav:" + href + "</id><link rel=\"subsection\" href=\"" + href +
+         "\" type=\"application/atom+xml;profile=opds-catalog\"/></entry>\n";
+}
+
+// /books/p<n>.xml, pages of 50 books (plus `firstPageExtra` on the first) linked by rel="next"
+void writeBookPages(const int pages, const int firstPageExtra = 0) {
+  int number = 0;
+  for (int page = 1; page <= pages; page++) {
+    std::string entries;
+    for (int i = 0; i < 50 + (page == 1 ? firstPageExtra : 0); i++) {
+      entries += bookXml(number++);
+    }
+    const std::string self = "/books/p" + std::to_string(page) + ".xml";
+    const std::string next = page < pages ? "/books/p" + std::to_string(page + 1) + ".xml" : "";
+    writeServerFile(self, feedXml(self, next, entries));
+  }
+}
+
+bool windowMatches(const OpdsFeedCache& feed, const size_t first, const size_t length) {
+  std::vector<OpdsEntry> window;
+  if (!feed.read(first, length, window) || window.size() != length) {
+    return false;
+  }
+  for (size_t i = 0; i < length; i++) {
+    const std::string n = std::to_string(first + i);
+    const OpdsEntry& entry = window[i];
+    if (entry.type != OpdsEntryType::BOOK || entry.title != "Book " + n || entry.author != "Author " + n ||
+        entry.href != "/get/" + n + ".epub" || entry.id != "urn:book:" + n) {
+      return false;
+    }
+  }
+  return true;
+}
+
+size_t cachedFeeds() {
+  size_t count = 0;
+  for (const auto& file : fs::directory_iterator(Storage.local("/.crosspoint/opds"))) {
+    count += file.path().extension() == ".hdr";
+  }
+  return count;
+}
+
+}  // namespace
+
+int main(const int argc, char** argv) {
+  const std::string base = argc > 0 ? std::string(argv[0]) : "opds";
+  fs::remove_all(base + ".card");
+  fs::remove_all(base + ".server");
+  fs::create_directories(base + ".card/.crosspoint");
+  Storage.root = base + ".card";
+  server.root = base + ".server";
+
+  const std::string navigation = navigationXml("All books", "/books/p1.xml") +
+                                 navigationXml("Authors", "/authors.xml") + navigationXml("New", "/new.xml");
+  writeServerFile("/index.xml", feedXml("/index.xml", "", navigation));
+  writeBookPages(40);
+
+  OpdsFeedCache feed([](const std::string& url, std::string& etag, std::string& lastModified, OpdsParser& parser) {
+    return server.fetch(url, etag, lastModified, parser);
+  });
+  const std::string root = std::string(HOST) + "/index.xml";
+  const std::string books = std::string(HOST) + "/books/p1.xml";
+
+  // First visit downloads, a revisit costs a 304, and going back costs nothing
+  check(feed.open(root, true) == OpdsFeedCache::OpenResult::DOWNLOADED, "first visit downloads");
+  std::vector<OpdsEntry> window;
+  check(feed.size() == 3 && !feed.hasNextPage() && feed.read(0, 23, window) && window.size() == 3 &&
+            window[0].title == "All books" && window[0].href == "/books/p1.xml" &&
+            window[2].type == OpdsEntryType::NAVIGATION,
+        "navigation entries read back");
+  check(feed.open(root, true) == OpdsFeedCache::OpenResult::UNCHANGED && feed.size() == 3 && server.notModified == 1,
+        "revisit is revalidated with a 304");
+  const int requests = server.requests;
+  check(feed.open(root, false) == OpdsFeedCache::OpenResult::CACHED && feed.size() == 3 &&
+            server.requests == requests,
+        "back navigation uses the cache without a request");
+
+  // A paginated feed grows a page at a time
+  check(feed.open(books, true) == OpdsFeedCache::OpenResult::DOWNLOADED && feed.size() == 50 && feed.hasNextPage(),
+        "first page of a paginated feed");
+  int pages = 1;
+  while (feed.hasNextPage() && feed.fetchNextPage()) {
+    pages++;
+  }
+  check(pages == 40 && feed.size() == 2000 && !feed.hasNextPage(), "all next pages appended");
+  check(windowMatches(feed, 0, 23) && windowMatches(feed, 977, 23) && windowMatches(feed, 1990, 10),
+        "windows anywhere in the feed");
+  check(feed.read(2000, 23, window) && window.empty() && !feed.read(2001, 23, window), "reads past the end");
+  const size_t sentForAllPages = server.bytesSent;
+
+  check(feed.open(books, true) == OpdsFeedCache::OpenResult::UNCHANGED && feed.size() == 2000 &&
+            !feed.hasNextPage() && windowMatches(feed, 1977, 23) && server.bytesSent == sentForAllPages,
+        "an unchanged first page keeps every page fetched");
+
+  // The catalog changed: only its first page is kept, and the rest is fetched again on demand
+  writeBookPages(40, 1);
+  check(feed.open(books, true) == OpdsFeedCache::OpenResult::DOWNLOADED && feed.size() == 51 && feed.hasNextPage(),
+        "a changed first page replaces the feed");
+
+  // A torn next page is dropped, and the same page fetched again lands where it should have
+  server.truncateNext = 3000;
+  check(!feed.fetchNextPage() && feed.size() == 51 && feed.hasNextPage(), "torn next page is not appended");
+  check(feed.open(books, false) == OpdsFeedCache::OpenResult::CACHED && feed.size() == 51, "torn page left no trace");
+  check(feed.fetchNextPage() && feed.size() == 101 && windowMatches(feed, 40, 23) && windowMatches(feed, 51, 50),
+        "next page appended after a torn one");
+
+  // Offline: a cached feed is still shown
+  server.offline = true;
+  check(feed.open(root, true) == OpdsFeedCache::OpenResult::CACHED && feed.size() == 3, "offline uses the cache");
+  check(feed.open(std::string(HOST) + "/new.xml", true) == OpdsFeedCache::OpenResult::FETCH_FAILED,
+        "offline without a cached copy fails");
+  server.offline = false;
+
+  // Broken XML: the cached copy survives; without one, it is a parse error
+  writeServerFile("/index.xml", "<feed><entry><title>Broken</entry></feed>");
+  check(feed.open(root, true) == OpdsFeedCache::OpenResult::CACHED && feed.size() == 3 && feed.read(0, 3, window) &&
+            window[1].title == "Authors",
+        "bad XML keeps the cached copy");
+  writeServerFile("/authors.xml", "<feed><entry>");
+  check(feed.open(std::string(HOST) + "/authors.xml", true) == OpdsFeedCache::OpenResult::PARSE_FAILED,
+        "bad XML without a cached copy");
+
+  // Lost entry files: fetched again
+  for (const auto& file : fs::directory_iterator(Storage.local("/.crosspoint/opds"))) {
+    if (file.path().extension() == ".ent") {
+      fs::remove(file.path());
+    }
+  }
+  writeServerFile("/index.xml", feedXml("/index.xml", "", navigationXml("All books", "/books/p1.xml")));
+  check(feed.open(root, false) == OpdsFeedCache::OpenResult::DOWNLOADED && feed.size() == 1,
+        "feed with lost entries is fetched again");
+
+  // A next link back to the same page ends the feed
+  writeServerFile("/loop.xml", feedXml("/loop.xml", std::string(HOST) + "/loop.xml", bookXml(0)));
+  check(feed.open(std::string(HOST) + "/loop.xml", true) == OpdsFeedCache::OpenResult::DOWNLOADED &&
+            !feed.hasNextPage(),
+        "self-referencing next link");
+
+  // Old feeds make room for new ones, the one opened longest ago first. Modified times don't count: the device has
+  // no clock.
+  const auto manyUrl = [](const int i) { return std::string(HOST) + "/many/" + std::to_string(i) + ".xml"; };
+  for (int i = 0; i < OpdsFeedCache::MAX_FEEDS + 5; i++) {
+    const std::string path = "/many/" + std::to_string(i) + ".xml";
+    writeServerFile(path, feedXml(path, "", bookXml(i)));
+    feed.open(manyUrl(i), true);
+    // Reopening a cached feed counts as a use, though nothing is written to it
+    feed.open(manyUrl(0), false);
+  }
+  feed.open(manyUrl(OpdsFeedCache::MAX_FEEDS + 4), false);
+  check(cachedFeeds() == OpdsFeedCache::MAX_FEEDS, "at most MAX_FEEDS feeds, got " + std::to_string(cachedFeeds()));
+  check(feed.size() == 1 && feed.read(0, 1, window) &&
+            window[0].title == "Book " + std::to_string(OpdsFeedCache::MAX_FEEDS + 4),
+        "the open feed survives eviction");
+  server.offline = true;
+  check(feed.open(manyUrl(0), false) == OpdsFeedCache::OpenResult::CACHED, "a feed in use survives eviction");
+  check(feed.open(manyUrl(5), false) == OpdsFeedCache::OpenResult::FETCH_FAILED,
+        "the feed opened longest ago is dropped");
+  check(feed.open(manyUrl(6), false) == OpdsFeedCache::OpenResult::CACHED, "later feeds are kept");
+  server.offline = false;
+
+  // Without a use order, the feeds on the card are still evicted
+  fs::remove(Storage.local("/.crosspoint/opds/.lru"));
+  feed.open(manyUrl(OpdsFeedCache::MAX_FEEDS + 5), true);
+  check(cachedFeeds() == OpdsFeedCache::MAX_FEEDS, "feeds without a use order are evicted, got " +
+                                                       std::to_string(cachedFeeds()));
+
+  // Without an entry callback the parser still collects entries, and reports the next page either way
+  {
+    OpdsParser parser;
+    const std::string xml = feedXml("/p1.xml", "/p2.xml", bookXml(1) + bookXml(2));
+    parser.write(reinterpret_cast<const uint8_t*>(xml.data()), xml.size());
+    parser.flush();
+    check(parser && parser.getEntries().size() == 2 && parser.getNextHref() == "/p2.xml", "collecting parser");
+  }
+
+  std::cout << "requests: " << server.requests << ", 304s: " << server.notModified << ", bytes served: "
+            << server.bytesSent << std::endl;
+  fs::remove_all(base + ".card");
+  fs::remove_all(base + ".server");
+  if (failures) {
+    std::cerr << failures << " check(s) failed" << std::endl;
+    return 1;
+  }
+  std::cout << "All checks passed" << std::endl;
+  return 0;
+}
@@ -0,0 +1,155 @@
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "src/util/PageTurnCoalescer.h"
+
+// Drives PageTurnCoalescer the way EpubReaderActivity does, against a simulated clock: the input loop pushes turns
+// as presses arrive, and a single render task takes the pending turns whenever it is idle and an update was requested.
+// Rendering a page takes `renderMs` before the refresh starts, and the refresh keeps the task busy for `refreshMs`.
+// The net delta lands through PageTurnCoalescer::land(), as in the reader; every chapter has `pageCount` pages.
+namespace {
+
+struct Press {
+  uint32_t atMs;
+  int delta;
+};
+
+struct Scenario {
+  std::string name;
+  int startChapter;
+  int startPage;
+  int pageCount;
+  uint32_t renderMs;
+  uint32_t refreshMs;
+  std::vector<Press> presses;
+  // Expectations
+  int expectedFinalChapter;
+  int expectedFinalPage;
+  int expectedRenders;
+  uint32_t expectedMaxLatencyMs;
+};
+
+struct Outcome {
+  int finalChapter = 0;
+  int finalPage = 0;
+  int renders = 0;
+  std::vector<int> renderedPages;
+  PageTurnCoalescer::Stats stats;
+};
+
+Outcome simulate(const Scenario& scenario) {
+  PageTurnCoalescer coalescer;
+  Outcome outcome;
+  int currentChapter = scenario.startChapter;
+  int currentPage = scenario.startPage;
+  bool updateRequested = false;
+  uint32_t busyUntilMs = 0;
+  size_t nextPress = 0;
+
+  const uint32_t lastPressMs = scenario.presses.empty() ? 0 : scenario.presses.back().atMs;
+  const uint32_t endMs = lastPressMs + 10 * (scenario.renderMs + scenario.refreshMs) + 1;
+  for (uint32_t nowMs = 0; nowMs <= endMs; nowMs++) {
+    // Input loop
+    while (nextPress < scenario.presses.size() && scenario.presses[nextPress].atMs == nowMs) {
+      coalescer.push(scenario.presses[nextPress].delta, nowMs);
+      updateRequested = true;
+      nextPress++;
+    }
+
+    // Render task
+    if (updateRequested && nowMs >= busyUntilMs) {
+      updateRequested = false;
+      int delta;
+      if (coalescer.take(delta)) {
+        const auto landing = PageTurnCoalescer::land(currentPage, scenario.pageCount, delta, currentChapter == 0);
+        currentChapter += landing.chapterStep;
+        currentPage = landing.page == PageTurnCoalescer::LAST_PAGE ? scenario.pageCount - 1 : landing.page;
+      }
+      coalescer.onRefreshStart(nowMs + scenario.renderMs);
+      busyUntilMs = nowMs + scenario.renderMs + scenario.refreshMs;
+      outcome.renders++;
+      outcome.renderedPages.push_back(currentPage);
+    }
+  }
+
+  outcome.finalChapter = currentChapter;
+  outcome.finalPage = currentPage;
+  outcome.stats = coalescer.getStats();
+  return outcome;
+}
+
+bool check(const bool condition, const std::string& scenario, const std::string& what, const long expected,
+           const long actual) {
+  if (!condition) {
+    std::cerr << "FAIL [" << scenario << "] " << what << ": expected " << expected << ", got " << actual << std::endl;
+  }
+  return condition;
+}
+
+}  // namespace
+
+int main() {
+  const std::vector<Scenario> scenarios = {
+      {"single press", 1, 10, 100, 120, 400, {{0, 1}}, 1, 11, 1, 120},
+      // The first press renders immediately, the other four arrive during that render and collapse into one jump
+      {"five fast forward presses", 1, 10, 100, 120, 400, {{0, 1}, {50, 1}, {100, 1}, {150, 1}, {200, 1}}, 1, 15, 2,
+       590},
+      {"presses spaced beyond refresh", 1, 0, 100, 120, 400, {{0, 1}, {1000, 1}, {2000, 1}}, 1, 3, 3, 120},
+      // Forward and back during one refresh cancel out, but the page is still redrawn once
+      {"forward then back", 1, 5, 100, 120, 400, {{0, 1}, {100, 1}, {200, -1}}, 1, 6, 2, 540},
+      {"stops at next chapter start", 1, 97, 100, 120, 400, {{0, 1}, {10, 1}, {20, 1}, {30, 1}}, 2, 0, 2, 630},
+      {"stops at previous chapter end", 1, 2, 100, 120, 400, {{0, -1}, {10, -1}, {20, -1}, {30, -1}}, 0, 99, 2, 630},
+      {"stops at first page of the book", 0, 2, 100, 120, 400, {{0, -1}, {10, -1}, {20, -1}, {30, -1}}, 0, 0, 2, 630},
+      {"backwards burst", 1, 20, 100, 120, 400, {{0, -1}, {30, -1}, {60, -1}, {90, -1}, {120, -1}, {150, -1}}, 1, 14,
+       2, 610},
+  };
+
+  int failures = 0;
+  for (const auto& scenario : scenarios) {
+    const Outcome outcome = simulate(scenario);
+    bool ok = true;
+    ok &= check(outcome.finalChapter == scenario.expectedFinalChapter, scenario.name, "final chapter",
+                scenario.expectedFinalChapter, outcome.finalChapter);
+    ok &= check(outcome.finalPage == scenario.expectedFinalPage, scenario.name, "final page",
+                scenario.expectedFinalPage, outcome.finalPage);
+    ok &= check(outcome.renders == scenario.expectedRenders, scenario.name, "renders", scenario.expectedRenders,
+                outcome.renders);
+    ok &= check(outcome.stats.maxLatencyMs == scenario.expectedMaxLatencyMs, scenario.name, "max latency",
+                scenario.expectedMaxLatencyMs, outcome.stats.maxLatencyMs);
+    ok &= check(outcome.stats.turns == scenario.presses.size(), scenario.name, "turns consumed",
+                static_cast<long>(scenario.presses.size()), outcome.stats.turns);
+
+    std::cout << (ok ? "PASS" : "FAIL") << "  " << scenario.name << ": " << outcome.renders << " render(s), pages";
+    for (const int page : outcome.renderedPages) {
+      std::cout << " " << page;
+    }
+    std::cout << ", latency avg " << outcome.stats.averageLatencyMs() << " ms, max " << outcome.stats.maxLatencyMs
+              << " ms, " << outcome.stats.coalescedTurns() << " coalesced" << std::endl;
+    if (!ok) {
+      failures++;
+    }
+  }
+
+  // clear() drops turns that have not been taken yet
+  {
+    PageTurnCoalescer coalescer;
+    coalescer.push(1, 0);
+    coalescer.push(1, 5);
+    coalescer.clear();
+    int delta = 0;
+    const bool took = coalescer.take(delta);
+    const bool ok = check(!took && delta == 0, "clear", "pending after clear", 0, delta);
+    std::cout << (ok ? "PASS" : "FAIL") << "  clear drops queued turns" << std::endl;
+    if (!ok) {
+      failures++;
+    }
+  }
+
+  if (failures > 0) {
+    std::cerr << failures << " scenario(s) failed" << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,786 @@
+#include <FontDecompressor.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <HalStorage.h>
+#include <I18n.h>
+#include <builtinFonts/all.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "lib/Epub/Epub/ParsedText.h"
+#include "lib/Epub/Epub/hyphenation/Hyphenator.h"
+#include "src/CrossPointSettings.h"
+#include "src/RecentBooksStore.h"
+#include "src/activities/home/AppsMenuView.h"
+#include "src/activities/home/HomeView.h"
+#include "src/activities/home/LibraryView.h"
+#include "src/activities/reader/ReaderView.h"
+#include "src/activities/settings/SettingsView.h"
+#include "src/apps/CalculatorView.h"
+#include "src/components/UITheme.h"
+#include "src/fontIds.h"
+
+// The stores' singletons; their JSON and migration code is not built here
+CrossPointSettings CrossPointSettings::instance;
+RecentBooksStore RecentBooksStore::instance;
+
+// Draws a fixed set of screens into an in-memory panel (host/HalDisplay.h) and compares each plane, bit for bit, with
+// the PNGs in test/render/golden. The activities themselves need FreeRTOS, the buttons and the SD card, so each screen
+// calls the view its activity draws through (HomeView, LibraryView, ...) with fixed state, and the real GfxRenderer,
+// fonts and themes:
+//
+//   <theme>_home, _library, _settings, _apps   HomeActivity, MyLibraryActivity, SettingsActivity and
+//                                               AppsMenuActivity, in each UI theme
+//   <theme>_popup                               the indexing progress popup over the library
+//   calculator_*                                CalculatorAppActivity entering a value and showing a result
+//   reader_*                                    text laid out by ParsedText (justified, hyphenated Bookerly 14) and
+//                                               drawn by TextBlock inside ReaderView's margins and status bar, in BW
+//                                               and in both grayscale planes. The page is not read from a section
+//                                               file, as EpubReaderActivity would.
+//   shapes_*                                    every fill and outline primitive, in each orientation
+//
+// A mismatch writes the drawn plane and a diff (changed pixels black) next to the build. Each screen also reports its
+// draw time (median of --repeat runs) and GfxRenderer's draw counters, next to the counters recorded with the goldens.
+//
+//   --update      rewrite the goldens and recorded counters from this build
+//   --repeat N    draws per screen for the timing (default 1)
+//   --root DIR    repository root (default .)
+//   --out DIR     where mismatches and the SD card stand-in go (default build/render)
+//   --primitives  also time each fill and line primitive on its own, in each orientation (no goldens involved)
+namespace {
+namespace fs = std::filesystem;
+using Clock = std::chrono::steady_clock;
+
+// Fonts as src/main.cpp sets them up, less those left out by OMIT_FONTS
+EpdFont bookerly14RegularFont(&bookerly_14_regular);
+EpdFont bookerly14BoldFont(&bookerly_14_bold);
+EpdFont bookerly14ItalicFont(&bookerly_14_italic);
+EpdFontFamily bookerly14FontFamily(&bookerly14RegularFont, &bookerly14BoldFont, &bookerly14ItalicFont);
+EpdFont smallFont(&notosans_8_regular);
+EpdFontFamily smallFontFamily(&smallFont);
+EpdFont ui10RegularFont(&ubuntu_10_regular);
+EpdFont ui10BoldFont(&ubuntu_10_bold);
+EpdFontFamily ui10FontFamily(&ui10RegularFont, &ui10BoldFont);
+EpdFont ui12RegularFont(&ubuntu_12_regular);
+EpdFont ui12BoldFont(&ubuntu_12_bold);
+EpdFontFamily ui12FontFamily(&ui12RegularFont, &ui12BoldFont);
+
+const EpdFontFamily* resolveReaderFont(const int fontId) {
+  return fontId == BOOKERLY_14_FONT_ID ? &bookerly14FontFamily : nullptr;
+}
+
+HalDisplay display;
+GfxRenderer renderer(display);
+FontDecompressor fontDecompressor;
+
+// ---- Screens ----
+
+struct Screen {
+  std::string name;
+  GfxRenderer::Orientation orientation;
+  std::function<void()> draw;
+  std::function<void()> drawGray;  // Redraws the grayscale-capable parts, as the reader does for each plane
+};
+
+void useTheme(const CrossPointSettings::UI_THEME theme) {
+  SETTINGS.uiTheme = theme;
+  UITheme::getInstance().reload();
+}
+
+// Button hints as mapLabels() gives them with the default button layout
+MappedInputManager::Labels hints(const char* back, const char* confirm, const char* previous, const char* next) {
+  return {back, confirm, previous, next};
+}
+
+void drawHome() {
+  const std::vector<RecentBook> recentBooks = {
+      {"/Books/Pride and Prejudice.epub", "Pride and Prejudice", "Jane Austen", "/cover_[HEIGHT].bmp"},
+      {"/Books/Moby Dick.epub", "Moby Dick; or, The Whale", "Herman Melville", ""},
+      {"/Books/Middlemarch.epub", "Middlemarch", "George Eliot", ""},
+  };
+  bool coverRendered = false;
+  bool coverBufferStored = false;
+  HomeView::render(renderer, {recentBooks, 0, false, hints("", tr(STR_SELECT), tr(STR_DIR_UP), tr(STR_DIR_DOWN)),
+                              coverRendered, coverBufferStored, [] { return false; }, [] { return false; }});
+}
+
+void drawLibrary() {
+  const std::vector<std::string> files = {
+      "Comics/", "Books/", "Pride and Prejudice.epub", "notes.txt", "cover.bmp", "Moby Dick.xtc", "README.md",
+      "archive.zip", "Middlemarch.epub"};
+  LibraryView::renderList(renderer,
+                          {tr(STR_SD_CARD), files.size(), 2, [&files](const int index) { return files[index]; },
+                           hints(tr(STR_HOME), tr(STR_OPEN), tr(STR_DIR_UP), tr(STR_DIR_DOWN))});
+}
+
+void drawSettings() {
+  const std::vector<std::pair<std::string, std::string>> settings = {
+      {tr(STR_SLEEP_SCREEN), tr(STR_DARK)},
+      {tr(STR_SLEEP_COVER_MODE), tr(STR_FIT)},
+      {tr(STR_HIDE_BATTERY), tr(STR_NEVER)},
+      {tr(STR_UI_THEME), "Lyra"},
+      {tr(STR_SUNLIGHT_FADING_FIX), tr(STR_STATE_OFF)},
+      {tr(STR_SCREEN_MARGIN), "5"},
+  };
+  const std::vector<TabInfo> tabs = {
+      {tr(STR_CAT_DISPLAY), true}, {tr(STR_CAT_READER), false}, {tr(STR_CAT_CONTROLS), false},
+      {tr(STR_CAT_SYSTEM), false}};
+  SettingsView::render(renderer, {tabs, static_cast<int>(settings.size()), 1,
+                                  [&settings](const int index) { return settings[index].first; },
+                                  [&settings](const int index) { return settings[index].second; },
+                                  hints(tr(STR_BACK), tr(STR_TOGGLE), tr(STR_DIR_LEFT), tr(STR_DIR_RIGHT))});
+}
+
+void drawApps() {
+  const std::vector<AppManifest> apps = {
+      {"Calculator", "calculator", "/apps/calculator", "1.0", {}},
+      {"Minesweeper", "minesweeper", "/apps/minesweeper", "1.0", {}},
+      {"Morning Prayers", "textviewer", "/apps/prayers", "1.2", {}},
+      {"Quote of the Day", "randomquote", "/apps/quotes", "1.0", {}},
+      {"Sketches", "imageviewer", "/apps/sketches", "0.3", {}},
+  };
+  const std::string deleteStatus;
+  AppsMenuView::render(renderer,
+                       {apps, 1, deleteStatus, hints(tr(STR_HOME), tr(STR_OPEN), tr(STR_DIR_UP), tr(STR_DIR_DOWN))});
+}
+
+void drawPopup() {
+  drawLibrary();
+  const Rect popup = GUI.drawPopup(renderer, tr(STR_INDEXING));
+  GUI.fillPopupProgress(renderer, popup, 60);
+}
+
+constexpr char CALCULATOR_OPERATORS[] = {'+', '-', '*', '/'};
+
+void drawCalculatorEntry() {
+  const int digits[] = {0, 4, 2, 7, 0};
+  CalculatorView::render(renderer, {"Calculator", CalculatorView::Mode::EnterSecond, digits, 5, 3,
+                                    CALCULATOR_OPERATORS, 2, 1250, 4270, 0, false,
+                                    hints("« Back", "Next", "Digit", "Digit")});
+}
+
+void drawCalculatorResult() {
+  const int digits[] = {0, 0, 0, 0, 0};
+  CalculatorView::render(renderer, {"Calculator", CalculatorView::Mode::ShowResult, digits, 5, 4,
+                                    CALCULATOR_OPERATORS, 3, 1250, 0, 0, true,
+                                    hints("« Back", "Chain", "Reset", "Reset")});
+}
+
+// The opening of Pride and Prejudice, with the emphasis a book would give it
+const char* const READER_TEXT[] = {
+    "It is a truth universally acknowledged, that a single man in possession of a good fortune, must be in want of "
+    "a *wife.*",
+    "However little known the feelings or views of such a man may be on his first entering a neighbourhood, this "
+    "truth is so well fixed in the minds of the surrounding families, that he is considered the rightful property of "
+    "some one or other of their daughters.",
+    "\xe2\x80\x9cMy dear Mr. Bennet,\xe2\x80\x9d said his lady to him one day, \xe2\x80\x9chave you heard that "
+    "_Netherfield_ Park is let at last?\xe2\x80\x9d",
+    "Mr. Bennet replied that he had not.",
+    "\xe2\x80\x9c" "But it is,\xe2\x80\x9d returned she; \xe2\x80\x9c" "for Mrs. Long has just been here, and she told "
+    "me all about it.\xe2\x80\x9d",
+    "Mr. Bennet made no answer.",
+    "\xe2\x80\x9c" "Do you not want to know who has taken it?\xe2\x80\x9d cried his wife impatiently.",
+    "\xe2\x80\x9cYou want to tell me, and I have no objection to hearing it.\xe2\x80\x9d",
+    "This was invitation enough.",
+    "\xe2\x80\x9cWhy, my dear, you must know, Mrs. Long says that Netherfield is taken by a young man of large "
+    "fortune from the north of England; that he came down on Monday in a chaise and four to see the place, and was so "
+    "much delighted with it, that he agreed with Mr. Morris immediately; that he is to take possession before "
+    "Michaelmas, and some of his servants are to be in the house by the end of next week.\xe2\x80\x9d",
+};
+
+// Lays the text out as a chapter section would and returns the lines on page `pageIndex` with their positions
+struct PageLine {
+  std::shared_ptr<TextBlock> line;
+  int x;
+  int y;
+};
+
+std::vector<PageLine> layoutReaderPage(const int viewportWidth, const int viewportHeight, const int pageIndex) {
+  const int lineHeight = renderer.getLineHeight(BOOKERLY_14_FONT_ID);
+  std::vector<PageLine> lines;
+  int page = 0;
+  int y = 0;
+  for (const char* paragraph : READER_TEXT) {
+    ParsedText text(false, true);
+    std::istringstream words(paragraph);
+    std::string word;
+    while (words >> word) {
+      // *bold* and _italic_ words
+      auto style = EpdFontFamily::REGULAR;
+      const char marker = word.front();
+      if (word.size() > 2 && (marker == '*' || marker == '_')) {
+        style = marker == '*' ? EpdFontFamily::BOLD : EpdFontFamily::ITALIC;
+        word.erase(std::remove(word.begin(), word.end(), marker), word.end());
+      }
+      text.addWord(word, style);
+    }
+    text.layoutAndExtractLines(renderer, BOOKERLY_14_FONT_ID, viewportWidth,
+                               [&](const std::shared_ptr<TextBlock>& line) {
+                                 if (y + lineHeight > viewportHeight) {
+                                   page++;
+                                   y = 0;
+                                 }
+                                 if (page == pageIndex) {
+                                   lines.push_back({line, 0, y});
+                                 }
+                                 y += lineHeight;
+                               });
+  }
+  return lines;
+}
+
+// With `autoTurn` the status bar is the progress bar alone and the auto page turn note goes under it, as when
+// turning pages automatically with the status bar text hidden
+Screen readerScreen(const std::string& name, const GfxRenderer::Orientation orientation,
+                    const CrossPointSettings::UI_THEME theme, const uint8_t progressBar, const bool autoTurn,
+                    const int pageIndex) {
+  auto margins = std::make_shared<ReaderView::Margins>();
+  auto page = std::make_shared<std::vector<PageLine>>();
+  auto setup = [=] {
+    useTheme(theme);
+    SETTINGS.statusBarProgressBar = progressBar;
+    SETTINGS.statusBarChapterPageCount = !autoTurn;
+    SETTINGS.statusBarBookProgressPercentage = !autoTurn;
+    SETTINGS.statusBarBattery = !autoTurn;
+    SETTINGS.statusBarTitle = autoTurn ? CrossPointSettings::HIDE_TITLE : CrossPointSettings::CHAPTER_TITLE;
+    *margins = ReaderView::pageMargins(renderer, autoTurn);
+    *page = layoutReaderPage(renderer.getScreenWidth() - margins->left - margins->right,
+                             renderer.getScreenHeight() - margins->top - margins->bottom, pageIndex);
+  };
+  auto renderPage = [=] {
+    for (const auto& line : *page) {
+      line.line->render(renderer, BOOKERLY_14_FONT_ID, margins->left + line.x, margins->top + line.y);
+    }
+  };
+  return {name, orientation,
+          [=] {
+            setup();
+            renderer.clearScreen();
+            renderPage();
+            const std::string title = autoTurn ? std::string(tr(STR_AUTO_TURN_ENABLED)) + "3" : "Chapter 1";
+            ReaderView::renderStatusBar(renderer, {12.5f + pageIndex * 0.5f, 3 + pageIndex, 24, title, autoTurn});
+          },
+          renderPage};
+}
+
+// Every primitive, sized from the screen so each orientation draws the same picture turned its own way. Some shapes
+// run off the edges, where pixels must be dropped.
+void drawShapes() {
+  const int w = renderer.getScreenWidth();
+  const int h = renderer.getScreenHeight();
+  renderer.clearScreen();
+
+  // Gray fills at odd and even origins, so both phases of each pattern show
+  renderer.fillRectDither(10, 10, w / 3, 60, LightGray);
+  renderer.fillRectDither(w / 3 + 13, 11, w / 3, 61, DarkGray);
+  renderer.fillRectDither(2 * w / 3 + 17, 10, w / 3, 60, Black);
+  renderer.fillRectDither(2 * w / 3 + 27, 20, 20, 20, White);
+  renderer.fillRect(5, 80, w - 10, 3, true);
+  renderer.fillRect(w - 40, 90, 80, 30, true);  // Off the right edge
+  renderer.fillRect(-30, 90, 60, 30, true);     // Off the left edge
+  renderer.fillRect(20, 95, 40, 10, false);
+
+  // Rounded fills in every color, with all and some corners rounded
+  const Color colors[] = {Black, DarkGray, LightGray, White};
+  int x = 10;
+  for (const Color color : colors) {
+    renderer.fillRoundedRect(x, 130, w / 5, 70, 12, color);
+    renderer.fillRoundedRect(x + 3, 210, w / 5 - 5, 41, 9, true, true, false, false, color);
+    renderer.fillRoundedRect(x + 1, 260, w / 5 - 2, 33, 7, false, true, false, true, color);
+    renderer.drawRoundedRect(x, 130, w / 5, 70, 1, 12, true);
+    x += w / 5 + 7;
+  }
+  renderer.fillRoundedRect(w - 30, 300, 60, 40, 10, DarkGray);  // Off the right edge
+
+  // Outlines
+  renderer.drawRoundedRect(10, 300, w / 2 - 20, 80, 3, 16, true);
+  renderer.drawRoundedRect(w / 2, 300, w / 2 - 40, 80, 2, 30, true, false, false, true, true);
+  renderer.drawRect(14, 310, 40, 30, true);
+  renderer.drawRect(60, 310, 40, 30, 4, true);
+  renderer.drawArc(40, w / 2 + 60, 360, 1, -1, 5, true);
+  renderer.drawArc(25, w / 2 + 120, 340, -1, 1, 30, true);
+
+  // Lines in each direction and width
+  renderer.drawLine(10, 400, w - 10, 400, true);
+  renderer.drawLine(10, 410, 10, h - 60, true);
+  renderer.drawLine(20, 410, w / 2, h - 60, true);
+  renderer.drawLine(w / 2, 410, 30, h - 80, true);
+  renderer.drawLine(40, 420, w - 20, 440, 3, true);
+  renderer.drawLine(w - 5, 450, w + 20, 470, true);  // Off the right edge
+
+  // Polygons: a concave star and a triangle cut by the bottom edge
+  int starX[10];
+  int starY[10];
+  const int cx = w / 2;
+  const int cy = h - 150;
+  // Points of a five-pointed star, from a table so the picture doesn't depend on libm
+  constexpr int STAR_X[] = {0, 22, 95, 36, 59, 0, -59, -36, -95, -22};
+  constexpr int STAR_Y[] = {-100, -31, -31, 12, 81, 38, 81, 12, -31, -31};
+  for (int i = 0; i < 10; i++) {
+    starX[i] = cx + STAR_X[i];
+    starY[i] = cy + STAR_Y[i];
+  }
+  renderer.fillPolygon(starX, starY, 10, true);
+  const int triangleX[] = {30, w / 3, 60};
+  const int triangleY[] = {h - 120, h - 40, h + 40};
+  renderer.fillPolygon(triangleX, triangleY, 3, true);
+  const int quadX[] = {w - 150, w - 20, w - 60, w - 170};
+  const int quadY[] = {h - 200, h - 190, h - 40, h - 70};
+  renderer.fillPolygon(quadX, quadY, 4, true);
+  renderer.fillPolygon(quadX, quadY, 3, false);
+
+  renderer.drawPixel(w - 1, h - 1, true);
+  renderer.drawPixel(0, 0, true);
+}
+
+std::vector<Screen> screens() {
+  std::vector<Screen> list;
+  const std::pair<const char*, CrossPointSettings::UI_THEME> themes[] = {
+      {"classic", CrossPointSettings::CLASSIC},
+      {"lyra", CrossPointSettings::LYRA},
+      {"lyra3", CrossPointSettings::LYRA_3_COVERS},
+  };
+  for (const auto& [name, theme] : themes) {
+    const std::string prefix = name;
+    const auto themed = [theme](void (*draw)()) {
+      return [theme, draw] {
+        useTheme(theme);
+        draw();
+      };
+    };
+    list.push_back({prefix + "_home", GfxRenderer::Portrait, themed(drawHome), nullptr});
+    list.push_back({prefix + "_library", GfxRenderer::Portrait, themed(drawLibrary), nullptr});
+    list.push_back({prefix + "_settings", GfxRenderer::Portrait, themed(drawSettings), nullptr});
+    list.push_back({prefix + "_apps", GfxRenderer::Portrait, themed(drawApps), nullptr});
+    list.push_back({prefix + "_popup", GfxRenderer::Portrait, themed(drawPopup), nullptr});
+  }
+  const auto lyra = [](void (*draw)()) {
+    return [draw] {
+      useTheme(CrossPointSettings::LYRA);
+      draw();
+    };
+  };
+  list.push_back({"calculator_entry", GfxRenderer::Portrait, lyra(drawCalculatorEntry), nullptr});
+  list.push_back({"calculator_result", GfxRenderer::Portrait, lyra(drawCalculatorResult), nullptr});
+  list.push_back(readerScreen("reader_portrait", GfxRenderer::Portrait, CrossPointSettings::CLASSIC,
+                              CrossPointSettings::HIDE_PROGRESS, false, 0));
+  list.push_back(readerScreen("reader_landscape", GfxRenderer::LandscapeClockwise, CrossPointSettings::LYRA,
+                              CrossPointSettings::BOOK_PROGRESS, false, 0));
+  list.push_back(readerScreen("reader_autoturn", GfxRenderer::Portrait, CrossPointSettings::LYRA,
+                              CrossPointSettings::CHAPTER_PROGRESS, true, 1));
+  const std::pair<const char*, GfxRenderer::Orientation> orientations[] = {
+      {"portrait", GfxRenderer::Portrait},
+      {"landscape_cw", GfxRenderer::LandscapeClockwise},
+      {"portrait_inverted", GfxRenderer::PortraitInverted},
+      {"landscape_ccw", GfxRenderer::LandscapeCounterClockwise},
+  };
+  for (const auto& [name, orientation] : orientations) {
+    list.push_back({std::string("shapes_") + name, orientation, drawShapes, nullptr});
+  }
+  return list;
+}
+
+// ---- 1-bit PNG of a plane as the frame buffer holds it: 0 is black, and portrait screens lie on their side ----
+
+using Bytes = std::vector<uint8_t>;
+
+void putBe32(Bytes& out, const uint32_t v) {
+  for (int shift = 24; shift >= 0; shift -= 8) {
+    out.push_back(static_cast<uint8_t>(v >> shift));
+  }
+}
+
+uint32_t be32(const uint8_t* p) { return static_cast<uint32_t>(p[0]) << 24 | p[1] << 16 | p[2] << 8 | p[3]; }
+
+void putChunk(Bytes& out, const char* type, const Bytes& data) {
+  putBe32(out, static_cast<uint32_t>(data.size()));
+  const size_t start = out.size();
+  out.insert(out.end(), type, type + 4);
+  out.insert(out.end(), data.begin(), data.end());
+  putBe32(out, static_cast<uint32_t>(crc32(0, out.data() + start, static_cast<uInt>(out.size() - start))));
+}
+
+constexpr uint8_t PNG_SIGNATURE[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+
+bool writePng(const fs::path& path, const uint8_t* plane) {
+  Bytes raw;
+  for (int y = 0; y < HalDisplay::DISPLAY_HEIGHT; y++) {
+    raw.push_back(0);  // Filter: none
+    raw.insert(raw.end(), plane + y * HalDisplay::DISPLAY_WIDTH_BYTES,
+               plane + (y + 1) * HalDisplay::DISPLAY_WIDTH_BYTES);
+  }
+  uLongf deflatedSize = compressBound(raw.size());
+  Bytes deflated(deflatedSize);
+  if (compress2(deflated.data(), &deflatedSize, raw.data(), raw.size(), Z_BEST_COMPRESSION) != Z_OK) {
+    return false;
+  }
+  deflated.resize(deflatedSize);
+
+  Bytes header;
+  putBe32(header, HalDisplay::DISPLAY_WIDTH);
+  putBe32(header, HalDisplay::DISPLAY_HEIGHT);
+  header.insert(header.end(), {1, 0, 0, 0, 0});  // 1 bit, grayscale, deflate, no filtering, no interlace
+
+  Bytes png(std::begin(PNG_SIGNATURE), std::end(PNG_SIGNATURE));
+  putChunk(png, "IHDR", header);
+  putChunk(png, "IDAT", deflated);
+  putChunk(png, "IEND", {});
+  std::ofstream out(path, std::ios::binary);
+  out.write(reinterpret_cast<const char*>(png.data()), static_cast<std::streamsize>(png.size()));
+  return static_cast<bool>(out);
+}
+
+// Reads back what writePng() wrote; anything else (another size or depth, filtered rows) is refused
+bool readPng(const fs::path& path, Bytes& plane) {
+  std::ifstream in(path, std::ios::binary);
+  const Bytes png((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  if (png.size() < sizeof(PNG_SIGNATURE) || memcmp(png.data(), PNG_SIGNATURE, sizeof(PNG_SIGNATURE)) != 0) {
+    return false;
+  }
+  Bytes deflated;
+  bool headerOk = false;
+  for (size_t pos = sizeof(PNG_SIGNATURE); pos + 12 <= png.size();) {
+    const uint32_t length = be32(&png[pos]);
+    if (pos + 12 + length > png.size()) {
+      return false;
+    }
+    const uint8_t* type = &png[pos + 4];
+    const uint8_t* data = &png[pos + 8];
+    if (memcmp(type, "IHDR", 4) == 0) {
+      headerOk = length == 13 && be32(data) == HalDisplay::DISPLAY_WIDTH &&
+                 be32(data + 4) == HalDisplay::DISPLAY_HEIGHT && data[8] == 1 && data[9] == 0 && data[12] == 0;
+    } else if (memcmp(type, "IDAT", 4) == 0) {
+      deflated.insert(deflated.end(), data, data + length);
+    }
+    pos += 12 + length;
+  }
+  const size_t stride = HalDisplay::DISPLAY_WIDTH_BYTES + 1;
+  Bytes raw(stride * HalDisplay::DISPLAY_HEIGHT);
+  uLongf rawSize = raw.size();
+  if (!headerOk || uncompress(raw.data(), &rawSize, deflated.data(), deflated.size()) != Z_OK ||
+      rawSize != raw.size()) {
+    return false;
+  }
+  plane.clear();
+  for (int y = 0; y < HalDisplay::DISPLAY_HEIGHT; y++) {
+    if (raw[y * stride] != 0) {
+      return false;
+    }
+    plane.insert(plane.end(), raw.begin() + y * stride + 1, raw.begin() + (y + 1) * stride);
+  }
+  return true;
+}
+
+// ---- Draw counters recorded with the goldens ----
+
+struct Counters {
+  uint32_t calls = 0;
+  uint32_t glyphs = 0;
+  uint32_t pixels = 0;
+  uint32_t spans = 0;
+};
+
+std::map<std::string, Counters> readCounters(const fs::path& path) {
+  std::map<std::string, Counters> counters;
+  std::ifstream in(path);
+  std::string name;
+  Counters c;
+  while (in >> name >> c.calls >> c.glyphs >> c.pixels >> c.spans) {
+    counters[name] = c;
+  }
+  return counters;
+}
+
+std::string withDelta(const uint32_t value, const std::map<std::string, Counters>& recorded, const std::string& name,
+                      uint32_t Counters::*field) {
+  std::string text = std::to_string(value);
+  const auto it = recorded.find(name);
+  if (it != recorded.end() && it->second.*field != value) {
+    const long long delta = static_cast<long long>(value) - static_cast<long long>(it->second.*field);
+    text += std::string(" (") + (delta > 0 ? "+" : "") + std::to_string(delta) + ")";
+  }
+  return text;
+}
+
+// ---- Cover thumbnail on the SD card stand-in ----
+
+// An 8-bit grayscale BMP with a gradient and a band across it, at each cover height a theme asks for
+void writeCovers() {
+  for (const int height : UITheme::getCoverThumbHeights()) {
+    const int width = height * 3 / 5;
+    const int rowBytes = (width + 3) & ~3;
+    const uint32_t dataOffset = 14 + 40 + 256 * 4;
+    Bytes bmp;
+    auto put16 = [&bmp](const uint32_t v) { bmp.insert(bmp.end(), {uint8_t(v), uint8_t(v >> 8)}); };
+    auto put32 = [&bmp](const uint32_t v) {
+      bmp.insert(bmp.end(), {uint8_t(v), uint8_t(v >> 8), uint8_t(v >> 16), uint8_t(v >> 24)});
+    };
+    put16(0x4D42);
+    put32(dataOffset + rowBytes * height);
+    put32(0);
+    put32(dataOffset);
+    put32(40);
+    put32(width);
+    put32(height);
+    put16(1);
+    put16(8);
+    put32(0);
+    put32(rowBytes * height);
+    put32(2835);
+    put32(2835);
+    put32(256);
+    put32(0);
+    for (int i = 0; i < 256; i++) {
+      bmp.insert(bmp.end(), {uint8_t(i), uint8_t(i), uint8_t(i), 0});
+    }
+    for (int y = 0; y < height; y++) {
+      for (int x = 0; x < rowBytes; x++) {
+        const bool band = std::abs(x - y / 2) < width / 8;
+        bmp.push_back(band ? 20 : static_cast<uint8_t>(255 * y / height));
+      }
+    }
+    std::ofstream out(Storage.local(("/cover_" + std::to_string(height) + ".bmp").c_str()), std::ios::binary);
+    out.write(reinterpret_cast<const char*>(bmp.data()), static_cast<std::streamsize>(bmp.size()));
+  }
+}
+
+// ---- Primitive timings ----
+
+struct Primitive {
+  const char* name;
+  std::function<void(int w, int h)> draw;
+};
+
+// Shapes the size the themes draw: list selections, popups, buttons, progress bars and the ArtGallery polygons
+const std::vector<Primitive>& primitives() {
+  static const std::vector<Primitive> list = {
+      {"fillRect black 400x60", [](int, int) { renderer.fillRect(13, 40, 400, 60, true); }},
+      {"fillRect full screen", [](const int w, const int h) { renderer.fillRect(0, 0, w, h, false); }},
+      {"fillRectDither light 400x60", [](int, int) { renderer.fillRectDither(13, 40, 400, 60, LightGray); }},
+      {"fillRectDither dark 400x60", [](int, int) { renderer.fillRectDither(13, 40, 400, 60, DarkGray); }},
+      {"fillRoundedRect dark 300x120", [](int, int) { renderer.fillRoundedRect(21, 150, 300, 120, 18, DarkGray); }},
+      {"fillRoundedRect black 120x40", [](int, int) { renderer.fillRoundedRect(41, 300, 120, 40, 8, Black); }},
+      {"drawRoundedRect 300x120 w3", [](int, int) { renderer.drawRoundedRect(21, 150, 300, 120, 3, 18, true); }},
+      {"drawRect 400x60 w2", [](int, int) { renderer.drawRect(13, 40, 400, 60, 2, true); }},
+      {"drawLine horizontal 400", [](int, int) { renderer.drawLine(13, 200, 412, 200, true); }},
+      {"drawLine vertical 400", [](int, int) { renderer.drawLine(30, 13, 30, 412, true); }},
+      {"fillPolygon star", [](int, int) {
+         static const int xs[] = {200, 229, 295, 247, 259, 200, 141, 153, 105, 171};
+         static const int ys[] = {100, 160, 169, 216, 281, 250, 281, 216, 169, 160};
+         renderer.fillPolygon(xs, ys, 10, true);
+       }},
+  };
+  return list;
+}
+
+// Median over --repeat batches of the time per call; each batch runs long enough to swamp the clock
+void timePrimitives(const int repeat) {
+  constexpr int CALLS_PER_BATCH = 200;
+  const std::pair<const char*, GfxRenderer::Orientation> orientations[] = {
+      {"portrait", GfxRenderer::Portrait},
+      {"landscape_cw", GfxRenderer::LandscapeClockwise},
+      {"portrait_inv", GfxRenderer::PortraitInverted},
+      {"landscape_ccw", GfxRenderer::LandscapeCounterClockwise},
+  };
+  printf("\n%-30s", "primitive (us per call)");
+  for (const auto& [name, orientation] : orientations) {
+    printf(" %14s", name);
+  }
+  printf("\n");
+  for (const Primitive& primitive : primitives()) {
+    printf("%-30s", primitive.name);
+    for (const auto& [name, orientation] : orientations) {
+      renderer.setOrientation(orientation);
+      renderer.clearScreen();
+      const int w = renderer.getScreenWidth();
+      const int h = renderer.getScreenHeight();
+      std::vector<double> times;
+      for (int run = 0; run < repeat; run++) {
+        const auto start = Clock::now();
+        for (int call = 0; call < CALLS_PER_BATCH; call++) {
+          primitive.draw(w, h);
+        }
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+        times.push_back(static_cast<double>(elapsed) / CALLS_PER_BATCH / 1000.0);
+      }
+      std::sort(times.begin(), times.end());
+      printf(" %14.2f", times[times.size() / 2]);
+    }
+    printf("\n");
+  }
+}
+
+// ---- Running ----
+
+struct Plane {
+  const char* name;
+  const uint8_t* data;
+};
+
+int failures = 0;
+
+void fail(const std::string& what) {
+  failures++;
+  std::cout << "FAIL: " << what << "\n";
+}
+
+// Draws the screen as the activity would put it on the panel, with the grayscale planes after the BW frame
+long long drawScreen(const Screen& screen) {
+  renderer.setOrientation(screen.orientation);
+  renderer.setRenderMode(GfxRenderer::BW);
+  const auto start = Clock::now();
+  screen.draw();
+  renderer.displayBuffer();
+  if (screen.drawGray) {
+    // The reader keeps the BW frame aside (storeBwBuffer) and puts it back after the grayscale passes
+    const Bytes bw(display.frame, display.frame + HalDisplay::BUFFER_SIZE);
+    renderer.clearScreen(0x00);
+    renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
+    screen.drawGray();
+    renderer.copyGrayscaleLsbBuffers();
+    renderer.clearScreen(0x00);
+    renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
+    screen.drawGray();
+    renderer.copyGrayscaleMsbBuffers();
+    renderer.displayGrayBuffer();
+    renderer.setRenderMode(GfxRenderer::BW);
+    memcpy(display.frame, bw.data(), HalDisplay::BUFFER_SIZE);
+  }
+  return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+}
+
+void checkPlane(const std::string& name, const uint8_t* plane, const fs::path& goldenDir, const fs::path& outDir,
+                const bool update) {
+  const fs::path golden = goldenDir / (name + ".png");
+  if (update) {
+    if (!writePng(golden, plane)) {
+      fail("could not write " + golden.string());
+    }
+    return;
+  }
+
+  Bytes expected;
+  if (!readPng(golden, expected)) {
+    fail(name + ": no readable golden at " + golden.string() + " (run with --update to record it)");
+    writePng(outDir / (name + ".actual.png"), plane);
+    return;
+  }
+  size_t changed = 0;
+  Bytes diff(HalDisplay::BUFFER_SIZE);
+  for (size_t i = 0; i < HalDisplay::BUFFER_SIZE; i++) {
+    const uint8_t bits = expected[i] ^ plane[i];
+    changed += __builtin_popcount(bits);
+    diff[i] = static_cast<uint8_t>(~bits);
+  }
+  if (changed > 0) {
+    writePng(outDir / (name + ".actual.png"), plane);
+    writePng(outDir / (name + ".diff.png"), diff.data());
+    fail(name + ": " + std::to_string(changed) + " pixels differ, see " + (outDir / (name + ".diff.png")).string());
+  }
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  fs::path root = ".";
+  fs::path outDir;
+  bool update = false;
+  bool timeEachPrimitive = false;
+  int repeat = 1;
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    if (arg == "--update") {
+      update = true;
+    } else if (arg == "--primitives") {
+      timeEachPrimitive = true;
+    } else if (arg == "--repeat" && i + 1 < argc) {
+      repeat = std::max(1, std::atoi(argv[++i]));
+    } else if (arg == "--root" && i + 1 < argc) {
+      root = argv[++i];
+    } else if (arg == "--out" && i + 1 < argc) {
+      outDir = argv[++i];
+    } else {
+      std::cerr << "Unknown argument: " << arg << "\n";
+      return 2;
+    }
+  }
+  if (outDir.empty()) {
+    outDir = root / "build" / "render";
+  }
+  const fs::path goldenDir = root / "test" / "render" / "golden";
+  const fs::path statsPath = goldenDir / "stats.txt";
+  fs::create_directories(outDir / "card");
+  fs::create_directories(goldenDir);
+
+  Storage.root = (outDir / "card").string();
+  writeCovers();
+
+  display.begin();
+  renderer.begin();
+  fontDecompressor.init();
+  renderer.setFontDecompressor(&fontDecompressor);
+  renderer.setFontResolver(resolveReaderFont);
+  renderer.insertFont(UI_10_FONT_ID, ui10FontFamily);
+  renderer.insertFont(UI_12_FONT_ID, ui12FontFamily);
+  renderer.insertFont(SMALL_FONT_ID, smallFontFamily);
+  Hyphenator::setPreferredLanguage("en");
+
+  const auto recorded = readCounters(statsPath);
+  std::ofstream statsOut;
+  if (update) {
+    statsOut.open(statsPath);
+  }
+
+  printf("%-26s %9s %16s %16s %20s %16s\n", "screen", "time (us)", "calls", "glyphs", "pixels", "spans");
+  for (const Screen& screen : screens()) {
+    std::vector<long long> times;
+    Counters counters;
+    for (int run = 0; run < repeat; run++) {
+      renderer.resetStats();
+      times.push_back(drawScreen(screen));
+      const auto& stats = renderer.getStats();
+      counters = {stats.calls, stats.glyphs, stats.pixels, stats.spans};
+    }
+    std::sort(times.begin(), times.end());
+
+    printf("%-26s %9lld %16s %16s %20s %16s\n", screen.name.c_str(), times[times.size() / 2],
+           withDelta(counters.calls, recorded, screen.name, &Counters::calls).c_str(),
+           withDelta(counters.glyphs, recorded, screen.name, &Counters::glyphs).c_str(),
+           withDelta(counters.pixels, recorded, screen.name, &Counters::pixels).c_str(),
+           withDelta(counters.spans, recorded, screen.name, &Counters::spans).c_str());
+    if (update) {
+      statsOut << screen.name << " " << counters.calls << " " << counters.glyphs << " " << counters.pixels << " "
+               << counters.spans << "\n";
+    }
+
+    checkPlane(screen.name + "_bw", display.frame, goldenDir, outDir, update);
+    if (screen.drawGray) {
+      checkPlane(screen.name + "_lsb", display.lsb, goldenDir, outDir, update);
+      checkPlane(screen.name + "_msb", display.msb, goldenDir, outDir, update);
+    }
+  }
+
+  if (timeEachPrimitive) {
+    timePrimitives(repeat);
+  }
+
+  if (failures > 0) {
+    std::cout << failures << " check(s) failed\n";
+    return 1;
+  }
+  std::cout << (update ? "Goldens updated\n" : "All screens match their goldens\n");
+  return 0;
+}
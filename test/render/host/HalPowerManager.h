@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstdint>
+
+// Host stand-in for lib/hal/HalPowerManager.h: a battery that always reads the same, so headers draw the same
+class HalPowerManager {
+ public:
+  uint16_t getBatteryPercentage() const { return 73; }
+};
+
+inline HalPowerManager powerManager;
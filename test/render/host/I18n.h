@@ -0,0 +1,4 @@
+#pragma once
+
+// Host stand-in for lib/I18n: strings render as their ids, so goldens don't change with a translation
+#define tr(id) #id
@@ -0,0 +1,13 @@
+#pragma once
+
+// Host stand-in for src/MappedInputManager.h; nothing the harness draws reads buttons, and the views take their hint
+// labels already mapped
+class MappedInputManager {
+ public:
+  struct Labels {
+    const char* btn1;
+    const char* btn2;
+    const char* btn3;
+    const char* btn4;
+  };
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <string>
+
+// Host stand-in for the Arduino String, covering what src/util/StringUtils.cpp uses
+class String {
+  std::string value;
+
+ public:
+  String() = default;
+  String(const char* text) : value(text ? text : "") {}  // NOLINT(google-explicit-constructor)
+
+  size_t length() const { return value.size(); }
+  void toLowerCase() {
+    std::transform(value.begin(), value.end(), value.begin(), [](const unsigned char c) { return std::tolower(c); });
+  }
+  bool endsWith(const String& suffix) const {
+    return value.size() >= suffix.value.size() &&
+           value.compare(value.size() - suffix.value.size(), suffix.value.size(), suffix.value) == 0;
+  }
+};
@@ -0,0 +1,34 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/boot_snapshot"
+BINARY="$BUILD_DIR/BootSnapshotTest"
+
+mkdir -p "$BUILD_DIR"
+
+SOURCES=(
+  "$ROOT_DIR/test/boot_snapshot/BootSnapshotTest.cpp"
+  "$ROOT_DIR/src/BootSnapshot.cpp"
+)
+
+# host/ stands in for the hardware-keyed obfuscation; test/host for Logging and HalStorage (a local directory as the SD
+# card)
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -g
+  -Wall
+  -Wextra
+  -pedantic
+  -fsanitize=address,undefined
+  -I"$ROOT_DIR/test/boot_snapshot/host"
+  -I"$ROOT_DIR/test/host"
+  -I"$ROOT_DIR/lib/FsHelpers"
+  -I"$ROOT_DIR/src"
+  -I"$ROOT_DIR"
+)
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" -o "$BINARY"
+
+"$BINARY" "$@"
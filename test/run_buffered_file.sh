@@ -0,0 +1,36 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/buffered_file"
+BINARY="$BUILD_DIR/BufferedFileBenchmark"
+
+mkdir -p "$BUILD_DIR"
+
+SOURCES=(
+  "$ROOT_DIR/test/buffered_file/BufferedFileBenchmark.cpp"
+  "$ROOT_DIR/lib/Serialization/BufferedFile.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/Page.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/blocks/TextBlock.cpp"
+)
+
+# host/ stands in for the renderer, which pages are never drawn with here, and test/host for Logging and HalStorage (a
+# local directory as the SD card), so both must come before the library folders. ImageBlock is stubbed in the benchmark.
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -pedantic
+  -Wno-unused-function
+  -Wno-unused-parameter
+  -I"$ROOT_DIR/test/buffered_file/host"
+  -I"$ROOT_DIR/test/host"
+  -I"$ROOT_DIR/lib/Serialization"
+  -I"$ROOT_DIR/lib/Epub"
+  -I"$ROOT_DIR/lib/EpdFont"
+)
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" -o "$BINARY"
+
+"$BINARY" "$@"
@@ -0,0 +1,43 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/heap_tags"
+BINARY="$BUILD_DIR/HeapTagsTest"
+
+mkdir -p "$BUILD_DIR"
+
+CFLAGS=(
+  -O2
+  -ffunction-sections
+  -I"$ROOT_DIR/lib/uzlib/src"
+)
+
+SOURCES=(
+  "$ROOT_DIR/test/heap_tags/HeapTagsTest.cpp"
+  "$ROOT_DIR/lib/HeapTags/HeapTags.cpp"
+  "$ROOT_DIR/lib/InflateReader/InflateReader.cpp"
+  "$BUILD_DIR/tinflate.o"
+)
+
+# test/host stands in for Logging
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -g
+  -Wall
+  -Wextra
+  -pedantic
+  -pthread
+  -fsanitize=address,undefined
+  -I"$ROOT_DIR/test/host"
+  -I"$ROOT_DIR/lib/HeapTags"
+  -I"$ROOT_DIR/lib/InflateReader"
+  -I"$ROOT_DIR/lib/uzlib/src"
+  -I"$ROOT_DIR"
+)
+
+cc "${CFLAGS[@]}" -c "$ROOT_DIR/lib/uzlib/src/tinflate.c" -o "$BUILD_DIR/tinflate.o"
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" -Wl,--gc-sections -o "$BINARY"
+
+"$BINARY" "$@"
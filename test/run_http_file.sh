@@ -0,0 +1,99 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/http_file"
+BINARY="$BUILD_DIR/HttpFileServer"
+PORT="${PORT:-18380}"
+
+mkdir -p "$BUILD_DIR"
+
+SOURCES=(
+  "$ROOT_DIR/test/http_file/HttpFileServer.cpp"
+  "$ROOT_DIR/src/network/HttpFileResponse.cpp"
+  "$ROOT_DIR/lib/HeapTags/HeapTags.cpp"
+)
+
+# host/ stands in for the WebServer (a loopback HTTP server) and the Arduino String; test/host for Logging, the task
+# watchdog and HalStorage (a local directory as the SD card)
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -pedantic
+  -I"$ROOT_DIR/test/http_file/host"
+  -I"$ROOT_DIR/test/host"
+  -I"$ROOT_DIR/lib/HeapTags"
+  -I"$ROOT_DIR"
+)
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" -o "$BINARY"
+
+CARD="$BUILD_DIR/card"
+rm -rf "$CARD"
+mkdir -p "$CARD"
+head -c 300000 /dev/urandom >"$CARD/book.epub"
+SIZE=300000
+
+"$BINARY" "$CARD" "$PORT" >"$BUILD_DIR/server.log" 2>&1 &
+SERVER_PID=$!
+trap 'kill $SERVER_PID 2>/dev/null || true' EXIT
+for _ in $(seq 50); do
+  curl -s -o /dev/null "http://127.0.0.1:$PORT/book.epub" && break
+  sleep 0.1
+done
+
+URL="http://127.0.0.1:$PORT/book.epub"
+FAILED=0
+check() {
+  if [ "$2" = "$3" ]; then
+    echo "PASS: $1"
+  else
+    echo "FAIL: $1 (expected '$3', got '$2')"
+    FAILED=1
+  fi
+}
+status() { curl -s -o "$BUILD_DIR/body" -w '%{http_code}' "$@" "$URL"; }
+header() { curl -s -D - -o /dev/null "${@:2}" "$URL" | tr -d '\r' | sed -n "s/^$1: //Ip"; }
+slice() {
+  [ "$(wc -c <"$BUILD_DIR/body")" -eq "$2" ] && cmp -s -i "$1:0" -n "$2" "$CARD/book.epub" "$BUILD_DIR/body" &&
+    echo same || echo differs
+}
+
+check "full download" "$(status)" 200
+check "full body" "$(slice 0 $SIZE)" same
+ETAG="$(header ETag)"
+check "ETag is weak" "$(case "$ETAG" in W/\"*\") echo yes ;; esac)" yes
+check "Accept-Ranges" "$(header Accept-Ranges)" bytes
+
+check "range status" "$(status -H 'Range: bytes=1000-1999')" 206
+check "range body" "$(slice 1000 1000)" same
+check "Content-Range" "$(header Content-Range -H 'Range: bytes=1000-1999')" "bytes 1000-1999/$SIZE"
+check "suffix range" "$(status -H 'Range: bytes=-500')" 206
+check "suffix body" "$(slice $((SIZE - 500)) 500)" same
+check "open range" "$(status -H 'Range: bytes=250000-')" 206
+check "open range body" "$(slice 250000 50000)" same
+check "range past the end" "$(status -H 'Range: bytes=400000-')" 416
+check "416 Content-Range" "$(header Content-Range -H 'Range: bytes=400000-')" "bytes */$SIZE"
+check "multiple ranges send everything" "$(status -H 'Range: bytes=0-1,5-6')" 200
+
+check "If-None-Match" "$(status -H "If-None-Match: $ETAG")" 304
+check "If-None-Match strong form" "$(status -H "If-None-Match: \"x\", ${ETAG#W/}")" 304
+check "If-None-Match stale" "$(status -H 'If-None-Match: "stale"')" 200
+check "If-Range weak" "$(status -H "If-Range: $ETAG" -H 'Range: bytes=10-19')" 200
+check "If-Range stale" "$(status -H 'If-Range: "stale"' -H 'Range: bytes=10-19')" 200
+
+check "HEAD status" "$(curl -s -I -o /dev/null -w '%{http_code}' "$URL")" 200
+check "HEAD Content-Length" "$(header Content-Length -I)" "$SIZE"
+check "HEAD ETag" "$(header ETag -I)" "$ETAG"
+check "HEAD range" "$(header Content-Range -I -H 'Range: bytes=5-9')" "bytes 5-9/$SIZE"
+
+# An interrupted download resumed with curl -C -
+head -c 123457 "$CARD/book.epub" >"$BUILD_DIR/resumed"
+curl -s -C - -o "$BUILD_DIR/resumed" "$URL"
+check "resumed download" "$(cmp -s "$CARD/book.epub" "$BUILD_DIR/resumed" && echo same || echo differs)" same
+
+check "aligned card reads" "$(grep -c 'misaligned=[1-9]' "$BUILD_DIR/server.log" || true)" 0
+
+exit $FAILED
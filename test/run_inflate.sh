@@ -0,0 +1,46 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/inflate"
+# UZLIB_DIR points at another copy of lib/uzlib/src, e.g. an older checkout, to compare its speed
+UZLIB_DIR="${UZLIB_DIR:-$ROOT_DIR/lib/uzlib/src}"
+
+mkdir -p "$BUILD_DIR"
+
+# The bundled uzlib leaves out its checksum functions; as in the firmware, the linker drops the code calling them
+CFLAGS=(
+  -ffunction-sections
+  -Wall
+  -Wextra
+  -I"$UZLIB_DIR"
+)
+
+CXXFLAGS=(
+  -std=c++20
+  -Wall
+  -Wextra
+  -pedantic
+  -DOMIT_FONTS
+  -I"$UZLIB_DIR"
+  -I"$ROOT_DIR/test/host"
+  -I"$ROOT_DIR/lib/InflateReader"
+  -I"$ROOT_DIR/lib/HeapTags"
+  -I"$ROOT_DIR/lib/EpdFont"
+)
+
+build() {
+  local name="$1"
+  shift
+  cc "${CFLAGS[@]}" "$@" -c "$UZLIB_DIR/tinflate.c" -o "$BUILD_DIR/$name-tinflate.o"
+  c++ "${CXXFLAGS[@]}" "$@" "$ROOT_DIR/test/inflate/InflateBenchmark.cpp" \
+    "$ROOT_DIR/lib/InflateReader/InflateReader.cpp" "$ROOT_DIR/lib/HeapTags/HeapTags.cpp" \
+    "$BUILD_DIR/$name-tinflate.o" -lz -Wl,--gc-sections -o "$BUILD_DIR/$name"
+}
+
+# Round trips under the sanitizers, then timing from an optimized build
+build InflateCheck -O1 -g -fsanitize=address,undefined -fno-sanitize-recover=undefined
+build InflateBenchmark -O2
+
+"$BUILD_DIR/InflateCheck" --check --root "$ROOT_DIR"
+"$BUILD_DIR/InflateBenchmark" --bench --root "$ROOT_DIR"
@@ -0,0 +1,33 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/listing_cache"
+BINARY="$BUILD_DIR/ListingCacheBenchmark"
+
+mkdir -p "$BUILD_DIR"
+
+SOURCES=(
+  "$ROOT_DIR/test/listing_cache/ListingCacheBenchmark.cpp"
+  "$ROOT_DIR/src/network/ListingCache.cpp"
+  "$ROOT_DIR/lib/Serialization/BufferedFile.cpp"
+)
+
+# test/host stands in for the Arduino core, Logging, the task watchdog and HalStorage (a local directory as the SD
+# card), so it must come before lib/Serialization
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -pedantic
+  -Wno-unused-function
+  -I"$ROOT_DIR/test/host"
+  -I"$ROOT_DIR/lib/FsHelpers"
+  -I"$ROOT_DIR/lib/Serialization"
+  -I"$ROOT_DIR"
+)
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" -o "$BINARY"
+
+"$BINARY" --card "$BUILD_DIR/card" "$@"
@@ -0,0 +1,34 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/log_ring"
+BINARY="$BUILD_DIR/LogRingTest"
+
+mkdir -p "$BUILD_DIR"
+
+SOURCES=(
+  "$ROOT_DIR/test/log_ring/LogRingTest.cpp"
+  "$ROOT_DIR/lib/Logging/LogRing.cpp"
+)
+
+# Sanitizers are on by default; SANITIZE=thread runs the concurrent writers under ThreadSanitizer, and SANITIZE=
+# (empty) builds without any for meaningful --bench numbers
+SANITIZE="${SANITIZE-address,undefined}"
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -g
+  -Wall
+  -Wextra
+  -pedantic
+  -pthread
+  -I"$ROOT_DIR"
+)
+if [[ -n "$SANITIZE" ]]; then
+  CXXFLAGS+=(-fsanitize="$SANITIZE")
+fi
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" -o "$BINARY"
+
+"$BINARY" "$@"
@@ -0,0 +1,53 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/opds_feed"
+BINARY="$BUILD_DIR/OpdsFeedCacheTest"
+
+mkdir -p "$BUILD_DIR"
+
+# expat is built as the firmware builds it (see platformio.ini)
+CFLAGS=(
+  -DXML_GE=0
+  -DXML_CONTEXT_BYTES=1024
+  -I"$ROOT_DIR/lib/expat"
+)
+
+OBJECTS=()
+for source in xmlparse xmlrole xmltok; do
+  cc "${CFLAGS[@]}" -O1 -c "$ROOT_DIR/lib/expat/$source.c" -o "$BUILD_DIR/$source.o"
+  OBJECTS+=("$BUILD_DIR/$source.o")
+done
+
+SOURCES=(
+  "$ROOT_DIR/test/opds_feed/OpdsFeedCacheTest.cpp"
+  "$ROOT_DIR/src/network/OpdsFeedCache.cpp"
+  "$ROOT_DIR/src/util/CacheLru.cpp"
+  "$ROOT_DIR/lib/OpdsParser/OpdsParser.cpp"
+  "$ROOT_DIR/lib/Serialization/BufferedFile.cpp"
+)
+
+# test/host stands in for the Arduino core's Print, Logging and HalStorage (a local directory as the SD card), so it
+# must come before lib/Serialization
+CXXFLAGS=(
+  -std=c++20
+  -O1
+  -g
+  -Wall
+  -Wextra
+  -pedantic
+  -Wno-unused-function
+  -fsanitize=address,undefined
+  -I"$ROOT_DIR/test/host"
+  -I"$ROOT_DIR/lib/FsHelpers"
+  -I"$ROOT_DIR/lib/Serialization"
+  -I"$ROOT_DIR/lib/OpdsParser"
+  -I"$ROOT_DIR/lib/expat"
+  -I"$ROOT_DIR/src"
+  -I"$ROOT_DIR"
+)
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" "${OBJECTS[@]}" -o "$BINARY"
+
+"$BINARY" "$@"
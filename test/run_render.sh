@@ -0,0 +1,88 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/render"
+UZLIB_DIR="$ROOT_DIR/lib/uzlib/src"
+
+mkdir -p "$BUILD_DIR"
+
+# The bundled uzlib leaves out its checksum functions; as in the firmware, the linker drops the code calling them
+CFLAGS=(
+  -ffunction-sections
+  -I"$UZLIB_DIR"
+)
+
+SOURCES=(
+  "$ROOT_DIR/test/render/RenderGoldenTest.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/GfxRenderer.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/Bitmap.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/BitmapHelpers.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFont.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFontFamily.cpp"
+  "$ROOT_DIR/lib/EpdFont/FontDecompressor.cpp"
+  "$ROOT_DIR/lib/InflateReader/InflateReader.cpp"
+  "$ROOT_DIR/lib/HeapTags/HeapTags.cpp"
+  "$ROOT_DIR/lib/Utf8/Utf8.cpp"
+  "$ROOT_DIR/lib/Serialization/BufferedFile.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/ParsedText.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/blocks/TextBlock.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/Hyphenator.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/LanguageRegistry.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/LiangHyphenation.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/HyphenationCommon.cpp"
+  "$ROOT_DIR/src/activities/home/AppsMenuView.cpp"
+  "$ROOT_DIR/src/activities/home/HomeView.cpp"
+  "$ROOT_DIR/src/activities/home/LibraryView.cpp"
+  "$ROOT_DIR/src/activities/reader/ReaderView.cpp"
+  "$ROOT_DIR/src/activities/settings/SettingsView.cpp"
+  "$ROOT_DIR/src/apps/CalculatorView.cpp"
+  "$ROOT_DIR/src/components/UITheme.cpp"
+  "$ROOT_DIR/src/components/themes/BaseTheme.cpp"
+  "$ROOT_DIR/src/components/themes/lyra/LyraTheme.cpp"
+  "$ROOT_DIR/src/components/themes/lyra/Lyra3CoversTheme.cpp"
+  "$ROOT_DIR/src/util/StringUtils.cpp"
+)
+
+# host/ stands in for the battery, I18n and the Arduino String, and test/host for the Arduino core, Logging, the panel
+# (an in-memory HalDisplay) and HalStorage (a local directory as the SD card), so both must come before the library
+# folders
+CXXFLAGS=(
+  -std=c++20
+  -Wall
+  -Wextra
+  -Wno-unused-parameter
+  -Wno-unused-function
+  -DOMIT_FONTS
+  -DGFX_RENDER_STATS
+  -DCROSSPOINT_VERSION=\"1.0.0\"
+  -I"$ROOT_DIR/test/render/host"
+  -I"$ROOT_DIR/test/host"
+  -I"$ROOT_DIR/lib/FsHelpers"
+  -I"$ROOT_DIR/lib/GfxRenderer"
+  -I"$ROOT_DIR/lib/EpdFont"
+  -I"$ROOT_DIR/lib/InflateReader"
+  -I"$ROOT_DIR/lib/HeapTags"
+  -I"$ROOT_DIR/lib/Utf8"
+  -I"$ROOT_DIR/lib/Serialization"
+  -I"$ROOT_DIR/lib/Epub"
+  -I"$UZLIB_DIR"
+  -I"$ROOT_DIR/src"
+  -I"$ROOT_DIR"
+)
+
+build() {
+  local name="$1"
+  shift
+  cc "${CFLAGS[@]}" "$@" -c "$UZLIB_DIR/tinflate.c" -o "$BUILD_DIR/$name-tinflate.o"
+  c++ "${CXXFLAGS[@]}" "$@" "${SOURCES[@]}" "$BUILD_DIR/$name-tinflate.o" -lz -Wl,--gc-sections \
+    -o "$BUILD_DIR/$name"
+}
+
+# Goldens are checked under the sanitizers, then timed from an optimized build. Arguments (e.g. --update) go to the
+# check; the timing run only reports, screen by screen and then primitive by primitive.
+build RenderCheck -O1 -g -fsanitize=address,undefined -fno-sanitize-recover=undefined
+build RenderBench -O2
+
+"$BUILD_DIR/RenderCheck" --root "$ROOT_DIR" "$@"
+"$BUILD_DIR/RenderBench" --root "$ROOT_DIR" --repeat 9 --primitives
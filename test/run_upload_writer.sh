@@ -0,0 +1,33 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/upload_writer"
+BINARY="$BUILD_DIR/UploadWriterBenchmark"
+
+mkdir -p "$BUILD_DIR"
+
+SOURCES=(
+  "$ROOT_DIR/test/upload_writer/UploadWriterBenchmark.cpp"
+  "$ROOT_DIR/src/network/UploadWriter.cpp"
+  "$ROOT_DIR/lib/HeapTags/HeapTags.cpp"
+)
+
+# host/ stands in for FreeRTOS; test/host for the Arduino clock, Logging, the task watchdog and HalStorage (a local
+# directory as the SD card, slowed to the simulated card's speed)
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -pedantic
+  -pthread
+  -I"$ROOT_DIR/test/upload_writer/host"
+  -I"$ROOT_DIR/test/host"
+  -I"$ROOT_DIR/lib/HeapTags"
+  -I"$ROOT_DIR"
+)
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" -o "$BINARY"
+
+"$BINARY" "$@"
@@ -0,0 +1,55 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/wake_frame"
+BINARY="$BUILD_DIR/WakeFrameTest"
+UZLIB_DIR="$ROOT_DIR/lib/uzlib/src"
+
+mkdir -p "$BUILD_DIR"
+
+# The bundled uzlib leaves out its checksum functions; as in the firmware, the linker drops the code calling them
+cc -ffunction-sections -I"$UZLIB_DIR" -O1 -c "$UZLIB_DIR/tinflate.c" -o "$BUILD_DIR/tinflate.o"
+
+SOURCES=(
+  "$ROOT_DIR/test/wake_frame/WakeFrameTest.cpp"
+  "$ROOT_DIR/src/util/WakeFrame.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/GfxRenderer.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/Bitmap.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/BitmapHelpers.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFont.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFontFamily.cpp"
+  "$ROOT_DIR/lib/EpdFont/FontDecompressor.cpp"
+  "$ROOT_DIR/lib/InflateReader/InflateReader.cpp"
+  "$ROOT_DIR/lib/HeapTags/HeapTags.cpp"
+  "$ROOT_DIR/lib/Utf8/Utf8.cpp"
+  "$ROOT_DIR/lib/Serialization/BufferedFile.cpp"
+)
+
+# test/host stands in for the Arduino core, Logging, the panel (an in-memory HalDisplay) and HalStorage (a local
+# directory as the SD card), so it must come before the library folders
+CXXFLAGS=(
+  -std=c++20
+  -O1
+  -g
+  -Wall
+  -Wextra
+  -pedantic
+  -Wno-unused-function
+  -ffunction-sections
+  -fsanitize=address,undefined
+  -I"$ROOT_DIR/test/host"
+  -I"$ROOT_DIR/lib/FsHelpers"
+  -I"$ROOT_DIR/lib/GfxRenderer"
+  -I"$ROOT_DIR/lib/EpdFont"
+  -I"$ROOT_DIR/lib/InflateReader"
+  -I"$ROOT_DIR/lib/HeapTags"
+  -I"$ROOT_DIR/lib/Utf8"
+  -I"$ROOT_DIR/lib/Serialization"
+  -I"$UZLIB_DIR"
+  -I"$ROOT_DIR"
+)
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" "$BUILD_DIR/tinflate.o" -Wl,--gc-sections -o "$BINARY"
+
+"$BINARY" "$@"
@@ -0,0 +1,44 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/xhtml_tokenizer"
+
+mkdir -p "$BUILD_DIR"
+
+# expat is built as the firmware builds it (see platformio.ini)
+CFLAGS=(
+  -DXML_GE=0
+  -DXML_CONTEXT_BYTES=1024
+  -I"$ROOT_DIR/lib/expat"
+)
+
+CXXFLAGS=(
+  -std=c++20
+  -Wall
+  -Wextra
+  -pedantic
+  -I"$ROOT_DIR/lib/expat"
+  -I"$ROOT_DIR/lib/Epub/Epub"
+  -I"$ROOT_DIR/lib/Epub/Epub/parsers"
+)
+
+build() {
+  local name="$1"
+  shift
+  local objects=()
+  for source in xmlparse xmlrole xmltok; do
+    cc "${CFLAGS[@]}" "$@" -c "$ROOT_DIR/lib/expat/$source.c" -o "$BUILD_DIR/$name-$source.o"
+    objects+=("$BUILD_DIR/$name-$source.o")
+  done
+  c++ "${CXXFLAGS[@]}" "$@" "$ROOT_DIR/test/xhtml_tokenizer/XhtmlTokenizerBenchmark.cpp" \
+    "$ROOT_DIR/lib/Epub/Epub/parsers/XhtmlTokenizer.cpp" "$ROOT_DIR/lib/Epub/Epub/htmlEntities.cpp" "${objects[@]}" \
+    -lz -o "$BUILD_DIR/$name"
+}
+
+# Differential runs under the sanitizers, then timing from an optimized build. Extra documents: --corpus DIR
+build XhtmlTokenizerCheck -O1 -g -fsanitize=address,undefined -fno-sanitize-recover=undefined
+build XhtmlTokenizerBenchmark -O2
+
+"$BUILD_DIR/XhtmlTokenizerCheck" --check --root "$ROOT_DIR" "$@"
+"$BUILD_DIR/XhtmlTokenizerBenchmark" --bench --root "$ROOT_DIR" "$@"
@@ -0,0 +1,57 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/zip_stream"
+BINARY="$BUILD_DIR/ZipStreamScannerTest"
+UZLIB_DIR="$ROOT_DIR/lib/uzlib/src"
+
+mkdir -p "$BUILD_DIR"
+
+# expat is built as the firmware builds it (see platformio.ini)
+CFLAGS=(
+  -DXML_GE=0
+  -DXML_CONTEXT_BYTES=1024
+  -I"$ROOT_DIR/lib/expat"
+)
+
+OBJECTS=()
+for source in xmlparse xmlrole xmltok; do
+  cc "${CFLAGS[@]}" -O1 -c "$ROOT_DIR/lib/expat/$source.c" -o "$BUILD_DIR/$source.o"
+  OBJECTS+=("$BUILD_DIR/$source.o")
+done
+# The bundled uzlib leaves out its checksum functions; as in the firmware, the linker drops the code calling them
+cc -ffunction-sections -O1 -I"$UZLIB_DIR" -c "$UZLIB_DIR/tinflate.c" -o "$BUILD_DIR/tinflate.o"
+OBJECTS+=("$BUILD_DIR/tinflate.o")
+
+SOURCES=(
+  "$ROOT_DIR/test/zip_stream/ZipStreamScannerTest.cpp"
+  "$ROOT_DIR/lib/ZipFile/ZipStreamScanner.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/EpubStreamScanner.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/parsers/ContainerParser.cpp"
+  "$ROOT_DIR/lib/InflateReader/InflateReader.cpp"
+  "$ROOT_DIR/lib/HeapTags/HeapTags.cpp"
+)
+
+# test/host stands in for the Arduino core's Print and for Logging
+CXXFLAGS=(
+  -std=c++20
+  -O1
+  -g
+  -Wall
+  -Wextra
+  -pedantic
+  -fsanitize=address,undefined
+  -fno-sanitize-recover=undefined
+  -I"$ROOT_DIR/test/host"
+  -I"$ROOT_DIR/lib/ZipFile"
+  -I"$ROOT_DIR/lib/InflateReader"
+  -I"$ROOT_DIR/lib/HeapTags"
+  -I"$ROOT_DIR/lib/expat"
+  -I"$UZLIB_DIR"
+  -I"$ROOT_DIR"
+)
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" "${OBJECTS[@]}" -lz -Wl,--gc-sections -o "$BINARY"
+
+"$BINARY" --root "$ROOT_DIR" "$@"
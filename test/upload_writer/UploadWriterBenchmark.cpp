@@ -0,0 +1,170 @@
+#include <HalStorage.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "src/network/UploadWriter.h"
+
+// Loopback benchmark for the upload write path. A simulated network delivers WebSocket-sized frames at a fixed rate
+// while the SD card (test/host/HalStorage.h) is slowed to a latency per write plus a per-byte cost. The synchronous path
+// writes each frame before accepting the next, as uploads did before UploadWriter; the write-behind path hands frames
+// to UploadWriter. Both must deliver the same bytes.
+namespace {
+
+struct Options {
+  double sizeMb = 4;
+  double netMbps = 4;      // network receive rate, MB/s
+  double sdMbps = 3;       // SD card write rate, MB/s
+  long sdLatencyUs = 500;  // fixed cost of every SD write call
+  size_t frameSize = 4096;  // matches WS_CHUNK_SIZE in FilesPage.html
+};
+
+struct Result {
+  double seconds = 0;
+  uint64_t checksum = 0;
+  size_t size = 0;
+};
+
+std::vector<uint8_t> makeFrame(const size_t index, const size_t size) {
+  std::vector<uint8_t> frame(size);
+  for (size_t i = 0; i < size; i++) {
+    frame[i] = static_cast<uint8_t>((index * 131 + i * 7) & 0xFF);
+  }
+  return frame;
+}
+
+HalFile openCard(const char* path) {
+  HalFile card;
+  if (!Storage.openFileForWrite("UWB", path, card)) {
+    std::cerr << "cannot create " << Storage.local(path) << "\n";
+    std::exit(1);
+  }
+  return card;
+}
+
+// FNV-1a of what reached the card, read back without the simulated write cost
+uint64_t checksumOf(const char* path) {
+  HalFile file;
+  Storage.openFileForRead("UWB", path, file);
+  uint64_t checksum = 14695981039346656037ull;
+  uint8_t buffer[4096];
+  int n = 0;
+  while ((n = file.read(buffer, sizeof(buffer))) > 0) {
+    for (int i = 0; i < n; i++) {
+      checksum ^= buffer[i];
+      checksum *= 1099511628211ull;
+    }
+  }
+  return checksum;
+}
+
+// Waits for the next frame to arrive over the simulated network
+void receiveFrame(const Options& options) {
+  std::this_thread::sleep_for(std::chrono::microseconds(static_cast<long>(options.frameSize / options.netMbps)));
+}
+
+template <typename WriteFrame, typename Finish>
+Result run(const Options& options, const char* path, HalFile& card, WriteFrame&& writeFrame, Finish&& finish) {
+  const size_t total = static_cast<size_t>(options.sizeMb * 1024 * 1024);
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t offset = 0, index = 0; offset < total; offset += options.frameSize, index++) {
+    receiveFrame(options);
+    const auto frame = makeFrame(index, std::min(options.frameSize, total - offset));
+    if (!writeFrame(frame)) {
+      std::cerr << "write failed\n";
+      std::exit(1);
+    }
+  }
+  if (!finish()) {
+    std::cerr << "finish failed\n";
+    std::exit(1);
+  }
+  Result result;
+  result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  result.size = card.size();
+  card.close();
+  result.checksum = checksumOf(path);
+  return result;
+}
+
+void report(const char* label, const Result& result) {
+  std::cout << std::left << std::setw(14) << label << std::right << std::fixed << std::setprecision(2)
+            << std::setw(8) << result.size / (1024.0 * 1024.0) / result.seconds << " MB/s  (" << std::setprecision(3)
+            << result.seconds << " s)\n";
+}
+
+bool parseOptions(const int argc, char** argv, Options& options) {
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    if (i + 1 >= argc) {
+      return false;
+    }
+    const char* value = argv[++i];
+    if (arg == "--size-mb") {
+      options.sizeMb = std::atof(value);
+    } else if (arg == "--net-mbps") {
+      options.netMbps = std::atof(value);
+    } else if (arg == "--sd-mbps") {
+      options.sdMbps = std::atof(value);
+    } else if (arg == "--sd-latency-us") {
+      options.sdLatencyUs = std::atol(value);
+    } else {
+      return false;
+    }
+  }
+  return options.sizeMb > 0 && options.netMbps > 0 && options.sdMbps > 0 && options.sdLatencyUs >= 0;
+}
+
+}  // namespace
+
+int main(const int argc, char** argv) {
+  Options options;
+  if (!parseOptions(argc, argv, options)) {
+    std::cerr << "usage: " << argv[0] << " [--size-mb N] [--net-mbps N] [--sd-mbps N] [--sd-latency-us N]\n";
+    return 2;
+  }
+  std::cout << "Upload of " << options.sizeMb << " MB in " << options.frameSize << " byte frames: network "
+            << options.netMbps << " MB/s, SD card " << options.sdMbps << " MB/s + " << options.sdLatencyUs
+            << " us per write\n";
+
+  const auto card = std::filesystem::temp_directory_path() / "upload_writer";
+  std::filesystem::create_directories(card);
+  Storage.root = card.string();
+  Storage.writeLatency = std::chrono::microseconds(options.sdLatencyUs);
+  Storage.writeBytesPerMicrosecond = options.sdMbps;  // 1 MB/s is 1 byte per microsecond
+
+  HalFile syncCard = openCard("/sync.bin");
+  const Result sync = run(
+      options, "/sync.bin", syncCard,
+      [&syncCard](const std::vector<uint8_t>& frame) {
+        return syncCard.write(frame.data(), frame.size()) == frame.size();
+      },
+      [] { return true; });
+
+  HalFile pipelinedCard = openCard("/pipelined.bin");
+  UploadWriter writer;
+  writer.begin(pipelinedCard);
+  const Result pipelined = run(
+      options, "/pipelined.bin", pipelinedCard,
+      [&writer](const std::vector<uint8_t>& frame) { return writer.write(frame.data(), frame.size()); },
+      [&writer] { return writer.finish(); });
+
+  report("synchronous", sync);
+  report("write-behind", pipelined);
+  std::cout << "speedup       " << std::setprecision(2) << sync.seconds / pipelined.seconds << "x\n";
+
+  if (sync.size != pipelined.size || sync.checksum != pipelined.checksum) {
+    std::cerr << "FAIL: write-behind delivered different bytes (" << pipelined.size << " vs " << sync.size << ")\n";
+    return 1;
+  }
+  std::cout << "PASS: both paths delivered the same " << sync.size << " bytes\n";
+  return 0;
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Host stand-in for the parts of FreeRTOS that UploadWriter uses: queues, binary semaphores and tasks, on top of the
+// standard library. Ticks are milliseconds.
+using BaseType_t = int;
+using UBaseType_t = unsigned;
+using TickType_t = uint32_t;
+constexpr BaseType_t pdTRUE = 1;
+constexpr BaseType_t pdFALSE = 0;
+constexpr BaseType_t pdPASS = 1;
+constexpr TickType_t portMAX_DELAY = UINT32_MAX;
+#define pdMS_TO_TICKS(ms) (static_cast<TickType_t>(ms))
+
+struct HostQueue {
+  std::mutex mutex;
+  std::condition_variable changed;
+  std::deque<std::vector<uint8_t>> items;
+  size_t capacity;
+  size_t itemSize;
+
+  HostQueue(const size_t capacity, const size_t itemSize) : capacity(capacity), itemSize(itemSize) {}
+
+  template <typename Predicate>
+  bool waitFor(std::unique_lock<std::mutex>& lock, const TickType_t ticks, Predicate ready) {
+    if (ticks == portMAX_DELAY) {
+      changed.wait(lock, ready);
+      return true;
+    }
+    return changed.wait_for(lock, std::chrono::milliseconds(ticks), ready);
+  }
+};
+using QueueHandle_t = HostQueue*;
+using SemaphoreHandle_t = HostQueue*;
+using TaskHandle_t = void*;
+using TaskFunction_t = void (*)(void*);
+
+inline QueueHandle_t xQueueCreate(const UBaseType_t length, const UBaseType_t itemSize) {
+  return new HostQueue(length, itemSize);
+}
+
+inline void vQueueDelete(const QueueHandle_t queue) { delete queue; }
+
+inline BaseType_t xQueueSend(const QueueHandle_t queue, const void* item, const TickType_t ticks) {
+  std::unique_lock lock(queue->mutex);
+  if (!queue->waitFor(lock, ticks, [queue] { return queue->items.size() < queue->capacity; })) {
+    return pdFALSE;
+  }
+  const auto* bytes = static_cast<const uint8_t*>(item);
+  queue->items.emplace_back(bytes, bytes + queue->itemSize);
+  queue->changed.notify_all();
+  return pdTRUE;
+}
+
+inline BaseType_t xQueueReceive(const QueueHandle_t queue, void* item, const TickType_t ticks) {
+  std::unique_lock lock(queue->mutex);
+  if (!queue->waitFor(lock, ticks, [queue] { return !queue->items.empty(); })) {
+    return pdFALSE;
+  }
+  if (queue->itemSize > 0) {
+    memcpy(item, queue->items.front().data(), queue->itemSize);
+  }
+  queue->items.pop_front();
+  queue->changed.notify_all();
+  return pdTRUE;
+}
+
+inline UBaseType_t uxQueueMessagesWaiting(const QueueHandle_t queue) {
+  std::lock_guard lock(queue->mutex);
+  return queue->items.size();
+}
+
+inline BaseType_t xTaskCreate(const TaskFunction_t function, const char*, uint32_t, void* param, UBaseType_t,
+                              TaskHandle_t* handle) {
+  std::thread(function, param).detach();
+  if (handle) {
+    *handle = param;
+  }
+  return pdPASS;
+}
+
+// The host thread simply returns after this
+inline void vTaskDelete(TaskHandle_t) {}
@@ -0,0 +1,9 @@
+#pragma once
+#include "FreeRTOS.h"
+
+inline SemaphoreHandle_t xSemaphoreCreateBinary() { return xQueueCreate(1, 0); }
+inline BaseType_t xSemaphoreGive(const SemaphoreHandle_t semaphore) { return xQueueSend(semaphore, nullptr, 0); }
+inline BaseType_t xSemaphoreTake(const SemaphoreHandle_t semaphore, const TickType_t ticks) {
+  return xQueueReceive(semaphore, nullptr, ticks);
+}
+inline void vSemaphoreDelete(const SemaphoreHandle_t semaphore) { vQueueDelete(semaphore); }
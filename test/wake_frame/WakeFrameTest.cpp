@@ -0,0 +1,110 @@
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <HalStorage.h>
+
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "src/util/WakeFrame.h"
+
+// Checks that the wake frame is the page on the panel when the device goes to sleep. While the reader has the next
+// page pre-rendered (EpubReaderActivity::speculateNextPage), the frame buffer holds that page and the displayed one
+// waits in the SPARE_DISPLAYED spare frame; waking up must show the displayed one. A wake frame only comes back for
+// its own book, and never damaged.
+namespace {
+namespace fs = std::filesystem;
+
+constexpr char BOOK[] = "/Books/Some Book.epub";
+constexpr char WAKE_FRAME_FILE[] = "/.crosspoint/wake_frame.bin";
+
+HalDisplay display;
+GfxRenderer renderer(display);
+int failures = 0;
+
+void check(const bool condition, const std::string& what) {
+  if (!condition) {
+    std::cerr << "FAIL " << what << std::endl;
+    failures++;
+  }
+}
+
+using Frame = std::vector<uint8_t>;
+
+Frame frame() { return Frame(display.frame, display.frame + HalDisplay::BUFFER_SIZE); }
+
+// Two pages that differ all over the buffer, so a mix of both can't pass for either
+Frame drawPage(const int number) {
+  renderer.clearScreen();
+  for (int y = number * 7; y < renderer.getScreenHeight(); y += 20) {
+    renderer.fillRect(10 + number * 13, y, renderer.getScreenWidth() - 40, 9, true);
+  }
+  return frame();
+}
+
+// What the next boot sees: a blank buffer, then the wake frame if there is one for `book`
+bool wakeUp(const std::string& book) {
+  renderer.clearScreen();
+  return WakeFrame::show(renderer, book);
+}
+
+// What the reader does when it pre-renders: the displayed page goes aside and the next page is drawn over it
+bool preRenderNextPage(const int number) {
+  if (!renderer.storeSpareFrame(GfxRenderer::SPARE_DISPLAYED)) {
+    return false;
+  }
+  drawPage(number);
+  return true;
+}
+}  // namespace
+
+int main(const int argc, char** argv) {
+  const std::string card = argc > 0 ? std::string(argv[0]) + ".card" : "card";
+  fs::remove_all(card);
+  fs::create_directories(card + "/.crosspoint");
+  Storage.root = card;
+  renderer.begin();
+
+  // Asleep on a page with nothing pre-rendered
+  const Frame page1 = drawPage(1);
+  check(WakeFrame::save(renderer, BOOK), "save the displayed page");
+  check(wakeUp(BOOK), "wake frame shown for its book");
+  check(frame() == page1, "woke up on the page slept on");
+  check(display.refreshes == 1, "wake frame refreshes the panel once");
+
+  // Asleep with the next page pre-rendered into the frame buffer
+  const Frame page2 = drawPage(2);
+  check(preRenderNextPage(3), "next page pre-rendered");
+  check(frame() != page2, "frame buffer holds the pre-rendered page");
+  check(WakeFrame::save(renderer, BOOK), "save with a page pre-rendered");
+  const Frame preRendered = frame();
+  check(renderer.hasSpareFrame(GfxRenderer::SPARE_DISPLAYED), "saving leaves the pre-rendered page pending");
+  renderer.freeSpareFrame(GfxRenderer::SPARE_DISPLAYED);
+  check(wakeUp(BOOK), "wake frame shown after a pending pre-render");
+  check(frame() == page2, "woke up on the displayed page, not the pre-rendered one");
+  check(frame() != preRendered, "pre-rendered page not shown");
+
+  // Another book, or a damaged file, leaves the panel alone
+  display.refreshes = 0;
+  check(!wakeUp("/Books/Other Book.epub"), "no wake frame for another book");
+  check(display.refreshes == 0, "panel untouched for another book");
+  {
+    HalFile file = Storage.open(WAKE_FRAME_FILE, O_RDWR);
+    file.seek(file.size() - 100);
+    file.write(static_cast<uint8_t>(0x5A));
+  }
+  check(!wakeUp(BOOK), "damaged wake frame refused");
+  check(display.refreshes == 0, "damaged wake frame not shown");
+
+  WakeFrame::discard();
+  check(!Storage.exists(WAKE_FRAME_FILE), "discard removes the wake frame");
+
+  if (failures > 0) {
+    std::cout << failures << " check(s) failed\n";
+    return 1;
+  }
+  std::cout << "All checks passed\n";
+  return 0;
+}
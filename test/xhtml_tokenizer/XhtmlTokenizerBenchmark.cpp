@@ -0,0 +1,483 @@
+#include <XhtmlTokenizer.h>
+#include <expat.h>
+#include <htmlEntities.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+// Differential test of XhtmlTokenizer against expat, set up as ChapterHtmlSlimParser sets them up, and timing of both.
+//
+// The documents are the XHTML entries of the EPUBs in test/epubs and in any directories given with --corpus (which may
+// also hold loose .xhtml/.html files), plus hand-written edge cases. Each is fed to the tokenizer in chunks of 1, 7
+// and 1024 bytes; the element and text events must match expat's wherever expat accepts the document, and must be the
+// same for every chunk size. Every document is also damaged (end tags dropped, tags cut, unknown entities, stray '<'
+// and '&', truncation) and must then still give balanced events without crashing or reading out of bounds (run under
+// ASan by test/run_xhtml_tokenizer.sh). A few malformed documents are also checked for the events they recover to.
+//
+//   --check   correctness only (default runs both)
+//   --bench   timing and peak heap only
+
+namespace {
+using Bytes = std::vector<uint8_t>;
+constexpr size_t PARSE_BUFFER_SIZE = 1024;  // As ChapterHtmlSlimParser reads
+
+struct Document {
+  std::string name;
+  std::string xhtml;
+};
+
+int failures = 0;
+
+void fail(const std::string& name, const std::string& what) {
+  if (failures++ < 20) {
+    std::cout << "FAIL: " << name << ": " << what << "\n";
+  }
+}
+
+Bytes readFile(const std::filesystem::path& path) {
+  std::ifstream in(path, std::ios::binary);
+  return Bytes(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+uint32_t le32(const uint8_t* p) { return p[0] | p[1] << 8 | p[2] << 16 | static_cast<uint32_t>(p[3]) << 24; }
+uint16_t le16(const uint8_t* p) { return static_cast<uint16_t>(p[0] | p[1] << 8); }
+
+bool endsWith(const std::string& s, const char* suffix) {
+  const size_t n = strlen(suffix);
+  return s.size() >= n && s.compare(s.size() - n, n, suffix) == 0;
+}
+
+bool isXhtml(const std::string& name) {
+  return endsWith(name, ".xhtml") || endsWith(name, ".html") || endsWith(name, ".htm");
+}
+
+bool zlibInflate(const uint8_t* in, const size_t inLength, std::string& out, const size_t size) {
+  out.assign(size, '\0');
+  z_stream z{};
+  if (inflateInit2(&z, -15) != Z_OK) {
+    return false;
+  }
+  z.next_in = const_cast<Bytef*>(in);
+  z.avail_in = static_cast<uInt>(inLength);
+  z.next_out = reinterpret_cast<Bytef*>(out.data());
+  z.avail_out = static_cast<uInt>(out.size());
+  const int res = inflate(&z, Z_FINISH);
+  inflateEnd(&z);
+  return res == Z_STREAM_END && z.total_out == size;
+}
+
+// XHTML entries of a ZIP, found through its central directory
+void addEpub(const std::filesystem::path& path, std::vector<Document>& documents) {
+  const Bytes zip = readFile(path);
+  if (zip.size() < 22) {
+    return;
+  }
+  size_t eocd = zip.size() - 22;
+  while (eocd > 0 && le32(&zip[eocd]) != 0x06054b50) eocd--;
+  size_t entry = le32(&zip[eocd + 16]);
+  for (uint16_t i = 0; i < le16(&zip[eocd + 10]); i++) {
+    const uint16_t method = le16(&zip[entry + 10]);
+    const uint32_t compressedSize = le32(&zip[entry + 20]);
+    const uint32_t size = le32(&zip[entry + 24]);
+    const uint16_t nameLength = le16(&zip[entry + 28]);
+    const std::string name(reinterpret_cast<const char*>(&zip[entry + 46]), nameLength);
+    const uint32_t local = le32(&zip[entry + 42]);
+    const size_t data = local + 30 + le16(&zip[local + 26]) + le16(&zip[local + 28]);
+    entry += 46 + nameLength + le16(&zip[entry + 30]) + le16(&zip[entry + 32]);
+    if (!isXhtml(name)) {
+      continue;
+    }
+
+    Document document{path.filename().string() + ":" + name, {}};
+    if (method == 0) {
+      document.xhtml.assign(reinterpret_cast<const char*>(&zip[data]), size);
+    } else if (method != 8 || !zlibInflate(&zip[data], compressedSize, document.xhtml, size)) {
+      std::cerr << "can't inflate " << document.name << "\n";
+      continue;
+    }
+    documents.push_back(std::move(document));
+  }
+}
+
+void addDirectory(const std::filesystem::path& directory, std::vector<Document>& documents) {
+  for (const auto& entry : std::filesystem::recursive_directory_iterator(directory)) {
+    const std::string name = entry.path().string();
+    if (endsWith(name, ".epub")) {
+      addEpub(entry.path(), documents);
+    } else if (isXhtml(name)) {
+      const Bytes contents = readFile(entry.path());
+      documents.push_back({name, std::string(contents.begin(), contents.end())});
+    }
+  }
+}
+
+// Cases the EPUBs may not have: entities of every kind, CDATA, comments, PIs, a DOCTYPE with an internal subset,
+// character references beyond the BMP, attribute whitespace and quoting, CRLF line ends and void elements
+void addEdgeCases(std::vector<Document>& documents) {
+  const char* prolog =
+      "<?xml version=\"1.0\" encoding=\"utf-8\"?>\r\n"
+      "<!DOCTYPE html PUBLIC \"-//W3C//DTD XHTML 1.1//EN\" \"http://www.w3.org/TR/xhtml11/DTD/xhtml11.dtd\">\r\n";
+  const char* bodies[] = {
+      "<p>a &amp; b &lt;c&gt; &quot;d&quot; &apos;e&apos; &#65;&#x42;&#x1F600; &nbsp;&mdash;&eacute;&hellip;</p>",
+      "<p>unknown &bogus; entity, bare & ampersand, &amp;amp; and &#xZZ; &#; &;</p>",
+      "<p class=\"a b\" style='color: red' id=x1 data-a = \"1 &amp; 2\" title=\"line\r\nbreak\ttab\">t</p>",
+      "<p>before<!-- comment with <tags> and -- dashes -->after<?pi data?>end</p>",
+      "<p><![CDATA[raw <b>not a tag</b> &amp; ]] ]> ]]]]></p>",
+      "<p>line\r\nline\rline\n</p><br/><hr /><img src=\"a.png\" alt=\"x\"/>",
+      "<div><p>deep<span>er<em>est</em></span></p></div>",
+      "<p>\xE4\xB8\xAD\xE6\x96\x87 \xF0\x9F\x98\x80 caf\xC3\xA9</p>",
+      "<p title=\"a>b\" alt='c\"d'>quoted angle</p>",
+      "<p>   </p>\n\n<p>\t</p>",
+  };
+  int i = 0;
+  for (const char* body : bodies) {
+    const std::string xhtml = std::string(prolog) +
+                              "<html xmlns=\"http://www.w3.org/1999/xhtml\"><head><title>t</title></head><body>" +
+                              body + "</body></html>\n";
+    documents.push_back({"edge case " + std::to_string(i++), xhtml});
+  }
+  documents.push_back({"edge case internal subset",
+                       "<?xml version=\"1.0\"?><!DOCTYPE html [<!ENTITY foo \"bar\"> <!ELEMENT p (#PCDATA)>]>"
+                       "<html><body><p>x</p></body></html>"});
+}
+
+// Events as ChapterHtmlSlimParser sees them: "<name a=v ...", "/name" and text, with adjacent text joined
+struct Events {
+  std::vector<std::string> events;
+  std::string text;
+  std::vector<std::string> open;
+  bool balanced = true;
+
+  void flush() {
+    if (!text.empty()) {
+      events.push_back("#" + text);
+      text.clear();
+    }
+  }
+  void start(const char* name, const char** atts) {
+    flush();
+    std::string event = std::string("<") + name;
+    for (int i = 0; atts && atts[i]; i += 2) {
+      event += std::string(" ") + atts[i] + "=" + atts[i + 1];
+    }
+    events.push_back(event);
+    open.emplace_back(name);
+  }
+  void end(const char* name) {
+    flush();
+    events.push_back(std::string("/") + name);
+    if (open.empty() || open.back() != name) {
+      balanced = false;
+    } else {
+      open.pop_back();
+    }
+  }
+  void characters(const char* s, const size_t len) { text.append(s, len); }
+};
+
+void XMLCALL expatStart(void* userData, const XML_Char* name, const XML_Char** atts) {
+  static_cast<Events*>(userData)->start(name, atts);
+}
+void XMLCALL expatEnd(void* userData, const XML_Char* name) { static_cast<Events*>(userData)->end(name); }
+void XMLCALL expatCharacters(void* userData, const XML_Char* s, const int len) {
+  static_cast<Events*>(userData)->characters(s, len);
+}
+// As ChapterHtmlSlimParser::defaultHandlerExpand
+void XMLCALL expatDefault(void* userData, const XML_Char* s, const int len) {
+  if (len >= 3 && s[0] == '&' && s[len - 1] == ';') {
+    const char* value = lookupHtmlEntity(s, static_cast<size_t>(len));
+    if (value) {
+      static_cast<Events*>(userData)->characters(value, strlen(value));
+    } else {
+      static_cast<Events*>(userData)->characters(s, len);
+    }
+  }
+}
+
+// Counting allocator for expat's peak heap
+size_t heapInUse = 0;
+size_t heapPeak = 0;
+
+void* countingMalloc(const size_t size) {
+  auto* block = static_cast<size_t*>(malloc(size + sizeof(size_t)));
+  if (!block) return nullptr;
+  *block = size;
+  heapInUse += size;
+  heapPeak = std::max(heapPeak, heapInUse);
+  return block + 1;
+}
+void countingFree(void* ptr) {
+  if (!ptr) return;
+  auto* block = static_cast<size_t*>(ptr) - 1;
+  heapInUse -= *block;
+  free(block);
+}
+void* countingRealloc(void* ptr, const size_t size) {
+  if (!ptr) return countingMalloc(size);
+  auto* block = static_cast<size_t*>(ptr) - 1;
+  const size_t old = *block;
+  auto* grown = static_cast<size_t*>(realloc(block, size + sizeof(size_t)));
+  if (!grown) return nullptr;
+  *grown = size;
+  heapInUse = heapInUse - old + size;
+  heapPeak = std::max(heapPeak, heapInUse);
+  return grown + 1;
+}
+const XML_Memory_Handling_Suite COUNTING_SUITE = {countingMalloc, countingRealloc, countingFree};
+
+// Parses with expat the way ChapterHtmlSlimParser does; false on a parse error
+bool parseExpat(const std::string& xhtml, Events* events) {
+  const XML_Parser parser = XML_ParserCreate_MM(nullptr, &COUNTING_SUITE, nullptr);
+  XML_SetUserData(parser, events);
+  if (events) {
+    XML_SetDefaultHandlerExpand(parser, expatDefault);
+    XML_SetElementHandler(parser, expatStart, expatEnd);
+    XML_SetCharacterDataHandler(parser, expatCharacters);
+  }
+  bool ok = true;
+  size_t offset = 0;
+  do {
+    const size_t len = std::min(PARSE_BUFFER_SIZE, xhtml.size() - offset);
+    void* const buf = XML_GetBuffer(parser, PARSE_BUFFER_SIZE);
+    memcpy(buf, xhtml.data() + offset, len);
+    offset += len;
+    if (XML_ParseBuffer(parser, static_cast<int>(len), offset == xhtml.size()) == XML_STATUS_ERROR) {
+      ok = false;
+      break;
+    }
+  } while (offset < xhtml.size());
+  XML_ParserFree(parser);
+  if (events) events->flush();
+  return ok;
+}
+
+// Tokenizes in chunks of `chunkSize`; returns the tokenizer's peak footprint
+size_t parseTokenizer(const std::string& xhtml, const size_t chunkSize, Events* events) {
+  XhtmlTokenizer tokenizer;
+  size_t offset = 0;
+  size_t peak = 0;
+  while (true) {
+    const XhtmlTokenizer::Token token = tokenizer.next();
+    if (token == XhtmlTokenizer::Token::End || token == XhtmlTokenizer::Token::Error) {
+      break;
+    }
+    switch (token) {
+      case XhtmlTokenizer::Token::NeedInput: {
+        const size_t len = std::min(chunkSize, xhtml.size() - offset);
+        char* const buf = tokenizer.getBuffer(chunkSize);
+        memcpy(buf, xhtml.data() + offset, len);
+        offset += len;
+        tokenizer.commit(len, offset == xhtml.size());
+        peak = std::max(peak, tokenizer.bufferCapacity());
+        break;
+      }
+      case XhtmlTokenizer::Token::StartTag:
+        if (events) events->start(tokenizer.name(), tokenizer.attributes());
+        break;
+      case XhtmlTokenizer::Token::EndTag:
+        if (events) events->end(tokenizer.name());
+        break;
+      case XhtmlTokenizer::Token::Text:
+        if (events) events->characters(tokenizer.text(), tokenizer.textLength());
+        break;
+      default:
+        break;
+    }
+  }
+  if (events) events->flush();
+  return peak + sizeof(XhtmlTokenizer);
+}
+
+std::string firstDifference(const Events& a, const Events& b) {
+  for (size_t i = 0; i < std::max(a.events.size(), b.events.size()); i++) {
+    const std::string x = i < a.events.size() ? a.events[i] : "(none)";
+    const std::string y = i < b.events.size() ? b.events[i] : "(none)";
+    if (x != y) {
+      return "event " + std::to_string(i) + ": [" + x.substr(0, 120) + "] vs [" + y.substr(0, 120) + "]";
+    }
+  }
+  return "";
+}
+
+// Returns whether expat accepts the document, and so whether the events were compared with expat's
+bool checkDocument(const Document& document) {
+  Events reference;
+  const bool expatAccepts = parseExpat(document.xhtml, &reference);
+  Events first;
+  for (const size_t chunkSize : {size_t{1}, size_t{7}, PARSE_BUFFER_SIZE}) {
+    Events events;
+    parseTokenizer(document.xhtml, chunkSize, &events);
+    if (!events.balanced || !events.open.empty()) {
+      fail(document.name, "unbalanced events with " + std::to_string(chunkSize) + " byte chunks");
+    }
+    if (chunkSize == 1) {
+      first = events;
+    } else if (events.events != first.events) {
+      fail(document.name, std::to_string(chunkSize) + " vs 1 byte chunks: " + firstDifference(events, first));
+    }
+  }
+  if (expatAccepts) {
+    if (first.events != reference.events) {
+      fail(document.name, "tokenizer vs expat: " + firstDifference(first, reference));
+    }
+  }
+  return expatAccepts;
+}
+
+// Malformed documents expat rejects, with the events ChapterHtmlSlimParser should get from the tokenizer
+void checkRecovery() {
+  const struct {
+    const char* xhtml;
+    const char* expected;
+  } cases[] = {
+      {"<html><body><p>a &bogus; & b &nbsp;c</p></body></html>",
+       "<html|<body|<p|#a &bogus; & b \xC2\xA0" "c|/p|/body|/html"},
+      {"<html><body><p id=x1 hidden class = \"a\">t<br><img src=a.png></p></body></html>",
+       "<html|<body|<p id=x1 hidden= class=a|#t|<br|/br|<img src=a.png|/img|/p|/body|/html"},
+      {"<html><body><div><span>x</div>y</i><p>z", "<html|<body|<div|<span|#x|/span|/div|#y|<p|#z|/p|/body|/html"},
+      {"<html><body><p>cut <b", "<html|<body|<p|#cut |/p|/body|/html"},
+  };
+  for (const auto& c : cases) {
+    Events events;
+    parseTokenizer(c.xhtml, 3, &events);
+    std::string joined;
+    for (const std::string& event : events.events) {
+      joined += (joined.empty() ? "" : "|") + event;
+    }
+    if (joined != c.expected) {
+      fail(c.xhtml, "recovered as " + joined);
+    }
+  }
+}
+
+std::string damage(const std::string& xhtml, std::mt19937& random) {
+  std::string damaged = xhtml;
+  const int edits = 1 + static_cast<int>(random() % 8);
+  for (int i = 0; i < edits && !damaged.empty(); i++) {
+    const size_t at = random() % damaged.size();
+    switch (random() % 6) {
+      case 0: {  // Drop an end tag
+        const size_t tag = damaged.find("</", at);
+        const size_t close = tag == std::string::npos ? tag : damaged.find('>', tag);
+        if (close != std::string::npos) damaged.erase(tag, close - tag + 1);
+        break;
+      }
+      case 1: {  // Cut a tag open
+        const size_t close = damaged.find('>', at);
+        if (close != std::string::npos) damaged.erase(close, 1);
+        break;
+      }
+      case 2:
+        damaged.insert(at, "&unknown;&amp");
+        break;
+      case 3:
+        damaged.insert(at, random() % 2 ? "<" : "&");
+        break;
+      case 4:
+        damaged.insert(at, "</p></div><b><i>");
+        break;
+      default:
+        damaged.resize(at);
+        break;
+    }
+  }
+  return damaged;
+}
+
+double throughput(const std::vector<Document>& documents, const bool expat) {
+  size_t bytes = 0;
+  const auto start = std::chrono::steady_clock::now();
+  double seconds = 0;
+  do {
+    for (const Document& document : documents) {
+      if (expat) {
+        parseExpat(document.xhtml, nullptr);
+      } else {
+        parseTokenizer(document.xhtml, PARSE_BUFFER_SIZE, nullptr);
+      }
+      bytes += document.xhtml.size();
+    }
+    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  } while (seconds < 0.5);
+  return static_cast<double>(bytes) / seconds / 1e6;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  bool check = true;
+  bool bench = true;
+  std::filesystem::path root = ".";
+  std::vector<std::filesystem::path> corpora;
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    if (arg == "--check") {
+      bench = false;
+    } else if (arg == "--bench") {
+      check = false;
+    } else if (arg == "--root" && i + 1 < argc) {
+      root = argv[++i];
+    } else if (arg == "--corpus" && i + 1 < argc) {
+      corpora.emplace_back(argv[++i]);
+    } else {
+      std::cerr << "usage: " << argv[0] << " [--check | --bench] [--root DIR] [--corpus DIR]...\n";
+      return 2;
+    }
+  }
+
+  std::vector<Document> documents;
+  addDirectory(root / "test/epubs", documents);
+  for (const auto& corpus : corpora) {
+    addDirectory(corpus, documents);
+  }
+  addEdgeCases(documents);
+  size_t total = 0;
+  for (const Document& document : documents) total += document.xhtml.size();
+  std::printf("%zu documents, %zu bytes\n", documents.size(), total);
+
+  if (check) {
+    int comparedWithExpat = 0;
+    for (const Document& document : documents) {
+      if (checkDocument(document)) {
+        comparedWithExpat++;
+      } else {
+        std::cout << "expat rejects " << document.name << "\n";
+      }
+    }
+    checkRecovery();
+    std::mt19937 random(1);
+    for (int round = 0; round < 20; round++) {
+      for (const Document& document : documents) {
+        Document damaged{document.name + " (damaged)", damage(document.xhtml, random)};
+        checkDocument(damaged);
+      }
+    }
+    std::printf("%d documents compared with expat\n", comparedWithExpat);
+    std::cout << (failures == 0 ? "differential: PASS" : "differential: FAILED") << "\n";
+  }
+
+  if (bench) {
+    size_t expatPeak = 0, tokenizerPeak = 0;
+    for (const Document& document : documents) {
+      heapPeak = heapInUse = 0;
+      parseExpat(document.xhtml, nullptr);
+      expatPeak = std::max(expatPeak, heapPeak);
+      tokenizerPeak = std::max(tokenizerPeak, parseTokenizer(document.xhtml, PARSE_BUFFER_SIZE, nullptr));
+    }
+    std::printf("%-10s %10s %16s\n", "", "MB/s", "peak heap bytes");
+    std::printf("%-10s %10.1f %16zu\n", "expat", throughput(documents, true), expatPeak);
+    std::printf("%-10s %10.1f %16zu\n", "tokenizer", throughput(documents, false), tokenizerPeak);
+  }
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,315 @@
+#include <HeapTags.h>
+#include <ZipStreamScanner.h>
+#include <zlib.h>
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "lib/Epub/Epub/EpubStreamScanner.h"
+
+// Streams the test EPUBs through ZipStreamScanner and EpubStreamScanner in chunks of 1, 7 and 1460 bytes and in one
+// piece, as a download would hand them over, and checks the entries against each archive's central directory and the
+// kept container.xml and OPF against zlib's inflate of them. Also checks that a page that isn't a ZIP is refused on
+// its first bytes, that a scan stops at an entry sized by a data descriptor, that an OPF seen before container.xml is
+// only kept if it is the one container.xml names, and that nothing is left allocated (run under ASan by
+// test/run_zip_stream.sh).
+namespace {
+namespace fs = std::filesystem;
+using Bytes = std::vector<uint8_t>;
+
+int failures = 0;
+
+void check(const bool condition, const std::string& what) {
+  if (!condition) {
+    std::cerr << "FAIL " << what << std::endl;
+    failures++;
+  }
+}
+
+Bytes readFile(const fs::path& path) {
+  std::ifstream in(path, std::ios::binary);
+  return Bytes(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+uint32_t le32(const uint8_t* p) { return p[0] | p[1] << 8 | p[2] << 16 | static_cast<uint32_t>(p[3]) << 24; }
+uint16_t le16(const uint8_t* p) { return static_cast<uint16_t>(p[0] | p[1] << 8); }
+
+struct CentralEntry {
+  std::string name;
+  uint16_t method;
+  uint32_t compressedSize;
+  uint32_t size;
+  Bytes contents;
+};
+
+Bytes inflateRaw(const uint8_t* data, const size_t size, const size_t expected) {
+  Bytes out(expected + 1);
+  z_stream z{};
+  inflateInit2(&z, -15);
+  z.next_in = const_cast<Bytef*>(data);
+  z.avail_in = static_cast<uInt>(size);
+  z.next_out = out.data();
+  z.avail_out = static_cast<uInt>(out.size());
+  inflate(&z, Z_FINISH);
+  out.resize(z.total_out);
+  inflateEnd(&z);
+  return out;
+}
+
+// The entries of a ZIP in order, from its central directory
+std::vector<CentralEntry> readCentralDirectory(const Bytes& zip) {
+  std::vector<CentralEntry> entries;
+  size_t eocd = zip.size() - 22;
+  while (eocd > 0 && le32(&zip[eocd]) != 0x06054b50) eocd--;
+  size_t entry = le32(&zip[eocd + 16]);
+  for (uint16_t i = 0; i < le16(&zip[eocd + 10]); i++) {
+    CentralEntry e;
+    e.method = le16(&zip[entry + 10]);
+    e.compressedSize = le32(&zip[entry + 20]);
+    e.size = le32(&zip[entry + 24]);
+    const uint16_t nameLength = le16(&zip[entry + 28]);
+    e.name.assign(reinterpret_cast<const char*>(&zip[entry + 46]), nameLength);
+    const uint32_t local = le32(&zip[entry + 42]);
+    const size_t data = local + 30 + le16(&zip[local + 26]) + le16(&zip[local + 28]);
+    e.contents = e.method == 8 ? inflateRaw(&zip[data], e.compressedSize, e.size)
+                               : Bytes(zip.begin() + data, zip.begin() + data + e.size);
+    entry += 46 + nameLength + le16(&zip[entry + 30]) + le16(&zip[entry + 32]);
+    entries.push_back(std::move(e));
+  }
+  return entries;
+}
+
+// Feeds `data` to `out` in pieces of `chunk` bytes. Returns the bytes it took.
+size_t feed(Print& out, const Bytes& data, const size_t chunk) {
+  size_t taken = 0;
+  for (size_t pos = 0; pos < data.size(); pos += chunk) {
+    const size_t n = std::min(chunk, data.size() - pos);
+    taken += out.write(data.data() + pos, n);
+  }
+  return taken;
+}
+
+bool sameContents(const uint8_t* data, const size_t size, const Bytes& expected) {
+  return size == expected.size() && memcmp(data, expected.data(), size) == 0;
+}
+
+// Builds a ZIP of stored entries, ending in a central directory the scanner only needs the signature of
+struct ZipBuilder {
+  Bytes bytes;
+
+  void u16(const uint16_t v) { bytes.insert(bytes.end(), {static_cast<uint8_t>(v), static_cast<uint8_t>(v >> 8)}); }
+  void u32(const uint32_t v) {
+    u16(static_cast<uint16_t>(v));
+    u16(static_cast<uint16_t>(v >> 16));
+  }
+
+  void add(const std::string& name, const std::string& contents, const uint16_t flags = 0) {
+    const bool descriptor = flags & 0x08;
+    u32(0x04034b50);
+    u16(20);
+    u16(flags);
+    u16(0);  // stored
+    u32(0);  // time, date
+    u32(0);  // CRC-32, not checked
+    u32(descriptor ? 0 : contents.size());
+    u32(descriptor ? 0 : contents.size());
+    u16(static_cast<uint16_t>(name.size()));
+    u16(4);
+    bytes.insert(bytes.end(), name.begin(), name.end());
+    u32(0xcafe0000);  // an extra field, skipped
+    bytes.insert(bytes.end(), contents.begin(), contents.end());
+    if (descriptor) {
+      u32(0x08074b50);
+      u32(0);
+      u32(contents.size());
+      u32(contents.size());
+    }
+  }
+
+  Bytes finish() {
+    u32(0x02014b50);
+    bytes.resize(bytes.size() + 42);
+    return bytes;
+  }
+};
+
+std::string containerXml(const std::string& opfPath) {
+  return R"(<?xml version="1.0"?><container version="1.0" xmlns="urn:oasis:names:tc:opendocument:xmlns:container">)"
+         R"(<rootfiles><rootfile full-path=")" +
+         opfPath + R"(" media-type="application/oebps-package+xml"/></rootfiles></container>)";
+}
+
+void checkEpub(const fs::path& path) {
+  const Bytes zip = readFile(path);
+  const std::vector<CentralEntry> expected = readCentralDirectory(zip);
+  const std::string name = path.filename().string();
+
+  const CentralEntry* container = nullptr;
+  for (const auto& e : expected) {
+    if (e.name == EpubStreamScanner::CONTAINER_PATH) {
+      container = &e;
+    }
+  }
+  check(container != nullptr, name + ": has container.xml");
+  if (!container) {
+    return;
+  }
+
+  for (const size_t chunk : {size_t{1}, size_t{7}, size_t{1460}, zip.size()}) {
+    const std::string what = name + " in chunks of " + std::to_string(chunk);
+
+    std::vector<ZipStreamScanner::Entry> seen;
+    size_t captured = 0;
+    ZipStreamScanner zipScanner(
+        [&](const ZipStreamScanner::Entry& entry) {
+          seen.push_back(entry);
+          return true;
+        },
+        [&](const ZipStreamScanner::Entry& entry, uint8_t* data, const size_t size) {
+          for (const auto& e : expected) {
+            if (e.name == entry.name) {
+              check(sameContents(data, size, e.contents), what + ": contents of " + entry.name);
+            }
+          }
+          captured++;
+          return false;
+        });
+    check(feed(zipScanner, zip, chunk) == zip.size(), what + ": takes every byte");
+    check(zipScanner.status() == ZipStreamScanner::Status::FINISHED, what + ": reaches the central directory");
+    check(seen.size() == expected.size(), what + ": " + std::to_string(seen.size()) + " entries");
+    for (size_t i = 0; i < std::min(seen.size(), expected.size()); i++) {
+      check(seen[i].name == expected[i].name && seen[i].method == expected[i].method &&
+                seen[i].compressedSize == expected[i].compressedSize && seen[i].uncompressedSize == expected[i].size,
+            what + ": entry " + expected[i].name);
+    }
+    size_t capturable = 0;
+    for (const auto& e : expected) {
+      capturable += e.size <= ZipStreamScanner::MAX_CAPTURE_SIZE ? 1 : 0;
+    }
+    check(captured == capturable, what + ": every entry up to the capture size is handed over");
+
+    EpubStreamScanner epubScanner;
+    feed(epubScanner, zip, chunk);
+    check(!epubScanner.rejected(), what + ": accepted");
+    check(epubScanner.hasPackage(), what + ": container.xml and OPF kept");
+    const uint8_t* data;
+    size_t size;
+    check(epubScanner.find(EpubStreamScanner::CONTAINER_PATH, &data, &size) &&
+              sameContents(data, size, container->contents),
+          what + ": container.xml");
+    bool opfMatched = false;
+    for (const auto& e : expected) {
+      if (e.name == epubScanner.getOpfPath()) {
+        opfMatched = epubScanner.find(e.name, &data, &size) && sameContents(data, size, e.contents);
+      }
+    }
+    check(opfMatched, what + ": OPF " + epubScanner.getOpfPath());
+    check(!epubScanner.find("mimetype", &data, &size), what + ": other entries aren't kept");
+  }
+}
+
+void checkNotZip() {
+  const std::string page = "<!DOCTYPE html><html><body>Please log in</body></html>";
+  const Bytes bytes(page.begin(), page.end());
+  EpubStreamScanner scanner;
+  check(scanner.write(bytes.data(), 2) == 2, "two bytes can't tell yet");
+  check(scanner.write(bytes.data() + 2, bytes.size() - 2) == 0, "HTML page refused");
+  check(scanner.rejected(), "HTML page rejected");
+  check(scanner.write(bytes.data(), bytes.size()) == 0, "and stays refused");
+}
+
+void checkDataDescriptor() {
+  ZipBuilder builder;
+  builder.add("mimetype", "application/epub+zip");
+  builder.add(EpubStreamScanner::CONTAINER_PATH, containerXml("content.opf"), 0x08);
+  builder.add("content.opf", "<package/>");
+  const Bytes zip = builder.finish();
+
+  size_t seen = 0;
+  ZipStreamScanner scanner([&](const ZipStreamScanner::Entry&) { return ++seen > 0; },
+                           [](const ZipStreamScanner::Entry&, uint8_t*, size_t) { return false; });
+  check(feed(scanner, zip, 5) == zip.size(), "unscannable archive still taken whole");
+  check(scanner.status() == ZipStreamScanner::Status::UNSCANNABLE, "stops at a data descriptor");
+  check(seen == 1, "entries before it are reported");
+
+  EpubStreamScanner epubScanner;
+  feed(epubScanner, zip, zip.size());
+  check(!epubScanner.rejected() && !epubScanner.hasPackage(), "EPUB with data descriptors is kept, unscanned");
+}
+
+void checkOpfOrder() {
+  const std::string opf = "<package><metadata/></package>";
+  {
+    ZipBuilder builder;
+    builder.add("OEBPS/content.opf", opf);
+    builder.add(EpubStreamScanner::CONTAINER_PATH, containerXml("OEBPS/content.opf"));
+    EpubStreamScanner scanner;
+    feed(scanner, builder.finish(), 3);
+    const uint8_t* data;
+    size_t size;
+    check(scanner.hasPackage() && scanner.find("OEBPS/content.opf", &data, &size) &&
+              std::string(reinterpret_cast<const char*>(data), size) == opf,
+          "OPF before container.xml is kept");
+  }
+  {
+    ZipBuilder builder;
+    builder.add("extra/other.opf", "<package>not this one</package>");
+    builder.add(EpubStreamScanner::CONTAINER_PATH, containerXml("OEBPS/content.opf"));
+    builder.add("OEBPS/content.opf", opf);
+    EpubStreamScanner scanner;
+    feed(scanner, builder.finish(), 64);
+    const uint8_t* data;
+    size_t size;
+    check(scanner.getOpfPath() == "OEBPS/content.opf", "OPF path from container.xml");
+    check(!scanner.find("extra/other.opf", &data, &size), "OPF container.xml doesn't name is dropped");
+    check(scanner.hasPackage() && scanner.find("OEBPS/content.opf", &data, &size) &&
+              std::string(reinterpret_cast<const char*>(data), size) == opf,
+          "named OPF after container.xml is kept");
+  }
+  {
+    ZipBuilder builder;
+    builder.add(EpubStreamScanner::CONTAINER_PATH, containerXml("content.opf"));
+    builder.add("content.opf", std::string(ZipStreamScanner::MAX_CAPTURE_SIZE + 1, ' '));
+    EpubStreamScanner scanner;
+    feed(scanner, builder.finish(), 4096);
+    check(!scanner.rejected() && !scanner.hasPackage(), "OPF over the capture size is left in the archive");
+  }
+}
+
+}  // namespace
+
+int main(const int argc, char** argv) {
+  fs::path root = ".";
+  for (int i = 1; i + 1 < argc; i++) {
+    if (std::string(argv[i]) == "--root") {
+      root = argv[i + 1];
+    }
+  }
+
+  size_t books = 0;
+  for (const auto& file : fs::directory_iterator(root / "test" / "epubs")) {
+    if (file.path().extension() == ".epub") {
+      checkEpub(file.path());
+      books++;
+    }
+  }
+  check(books > 0, "test EPUBs found");
+  checkNotZip();
+  checkDataDescriptor();
+  checkOpfOrder();
+  check(HeapTags::stats(HeapTag::Untagged).liveBytes == 0, "every buffer released");
+
+  std::cout << books << " books scanned" << std::endl;
+  if (failures) {
+    std::cerr << failures << " check(s) failed" << std::endl;
+    return 1;
+  }
+  std::cout << "All checks passed" << std::endl;
+  return 0;
+}